@@ -24,11 +24,17 @@
 
 // Tests the speed of various amounts of points of various stamp sizes.
 
-// In the past, I already did the following:
-// Test the speed of calling the heatmap point adding function once for
+// It also compares calling the heatmap point adding function once for
 // every single point (a la glVertex3f) vs. calling one function which
 // adds a whole buffer of points (a la glVertexPointer). Basically, time
-// the function call overhead.
+// the function call and clipping overhead.
+//
+// For large stamps, it also compares the usual line-by-line layout of the
+// heatmap to the tiled one (HEATMAP_TILED).
+//
+// Finally, it times adding the points using a separable stamp of the same
+// size, which is done in two 1D passes instead of stamping each point, and
+// for very large stamps, approximating a Gaussian one by box blurs.
 
 #include "benchs/common.hpp"
 
@@ -37,6 +43,8 @@ static const size_t NPOINTS_MAX = 1000*1000;
 static const size_t STAMP_MIN = 1;
 static const size_t STAMP_MAX = 512;
 static const size_t MAPSIZE = STAMP_MAX*30;
+static const size_t TILED_STAMP_MIN = 32;
+static const size_t BLUR_STAMP_MIN = 128;
 
 int main(/* int argc, char *argv[] */)
 {
@@ -48,19 +56,70 @@ int main(/* int argc, char *argv[] */)
     std::cerr << "[" << std::endl;
     for(size_t stampsize = STAMP_MIN ; stampsize <= STAMP_MAX ; stampsize *= 2) {
         std::unique_ptr<heatmap_stamp_t> stamp(heatmap_stamp_gen(stampsize));
+        std::unique_ptr<heatmap_sepstamp_t> sepstamp(heatmap_sepstamp_gen(stampsize));
         for(size_t npoints = NPOINTS_MIN ; npoints <= NPOINTS_MAX ; npoints *= 10) {
             std::unique_ptr<heatmap_t> hm(heatmap_new(MAPSIZE, MAPSIZE));
-            std::cerr << "{'npoints': " << npoints << ", 'size': " << stampsize << ", ";
+            std::cerr << "{'npoints': " << npoints << ", 'size': " << stampsize << ", 'batch': false, 'tiled': false, 'sep': false, 'blur': false, ";
             std::cout << "Adding " << npoints << " points of size " << stampsize << " one after another... " << std::flush;
             for(RepeatTimer t(5) ; t ; t.next()) {
                 for(size_t i = 0 ; i < npoints ; ++i) {
                     heatmap_add_point_with_stamp(hm.get(), points[2*i], points[2*i+1], stamp.get());
                 }
             }
-            if(npoints < NPOINTS_MAX || stampsize < STAMP_MAX)
-                std::cerr << "," << std::endl;
+            std::cerr << "," << std::endl;
 
             ret += hm->buf[0] > 0.0f;
+
+            // Each map is freed before the next one is made, as at the largest
+            // size they're about a GiB each once the points have touched them.
+            hm.reset();
+
+            std::unique_ptr<heatmap_t> hm_batch(heatmap_new(MAPSIZE, MAPSIZE));
+            std::cerr << "{'npoints': " << npoints << ", 'size': " << stampsize << ", 'batch': true, 'tiled': false, 'sep': false, 'blur': false, ";
+            std::cout << "Adding " << npoints << " points of size " << stampsize << " as one buffer... " << std::flush;
+            for(RepeatTimer t(5) ; t ; t.next()) {
+                heatmap_add_points_with_stamp(hm_batch.get(), &points[0], npoints, stamp.get());
+            }
+            ret += hm_batch->buf[0] > 0.0f;
+            hm_batch.reset();
+
+            if(stampsize >= TILED_STAMP_MIN) {
+                std::cerr << "," << std::endl;
+
+                std::unique_ptr<heatmap_t> hm_tiled(heatmap_new_ex(MAPSIZE, MAPSIZE, HEATMAP_TILED));
+                std::cerr << "{'npoints': " << npoints << ", 'size': " << stampsize << ", 'batch': true, 'tiled': true, 'sep': false, 'blur': false, ";
+                std::cout << "Adding " << npoints << " points of size " << stampsize << " as one buffer to a tiled map... " << std::flush;
+                for(RepeatTimer t(5) ; t ; t.next()) {
+                    heatmap_add_points_with_stamp(hm_tiled.get(), &points[0], npoints, stamp.get());
+                }
+                ret += hm_tiled->buf[0] > 0.0f;
+            }
+
+            std::cerr << "," << std::endl;
+
+            std::unique_ptr<heatmap_t> hm_sep(heatmap_new(MAPSIZE, MAPSIZE));
+            std::cerr << "{'npoints': " << npoints << ", 'size': " << stampsize << ", 'batch': true, 'tiled': false, 'sep': true, 'blur': false, ";
+            std::cout << "Adding " << npoints << " points of size " << stampsize << " using a separable stamp... " << std::flush;
+            for(RepeatTimer t(5) ; t ; t.next()) {
+                heatmap_add_points_with_sepstamp(hm_sep.get(), &points[0], npoints, sepstamp.get());
+            }
+            ret += hm_sep->buf[0] > 0.0f;
+            hm_sep.reset();
+
+            if(stampsize >= BLUR_STAMP_MIN) {
+                std::cerr << "," << std::endl;
+
+                std::unique_ptr<heatmap_t> hm_blur(heatmap_new(MAPSIZE, MAPSIZE));
+                std::cerr << "{'npoints': " << npoints << ", 'size': " << stampsize << ", 'batch': true, 'tiled': false, 'sep': false, 'blur': true, ";
+                std::cout << "Adding " << npoints << " points of size " << stampsize << " using box blurs... " << std::flush;
+                for(RepeatTimer t(5) ; t ; t.next()) {
+                    heatmap_add_points_boxblurred(hm_blur.get(), &points[0], npoints, stampsize);
+                }
+                ret += hm_blur->buf[0] > 0.0f;
+            }
+
+            if(npoints < NPOINTS_MAX || stampsize < STAMP_MAX)
+                std::cerr << "," << std::endl;
         }
     }
     std::cerr << std::endl << "]" << std::endl;
@@ -44,6 +44,14 @@ namespace std {
     struct default_delete<heatmap_stamp_t> {
         void operator()(heatmap_stamp_t* p) { heatmap_stamp_free(p); }
     };
+    template<>
+    struct default_delete<heatmap_sepstamp_t> {
+        void operator()(heatmap_sepstamp_t* p) { heatmap_sepstamp_free(p); }
+    };
+    template<>
+    struct default_delete<heatmap_half_t> {
+        void operator()(heatmap_half_t* p) { heatmap_half_free(p); }
+    };
 }
 
 inline std::vector<unsigned> genpoints(size_t npoints, unsigned maxval)
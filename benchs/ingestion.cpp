@@ -0,0 +1,185 @@
+/* heatmap - High performance heatmap creation in C.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2013 Lucas Beyer
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Compare how fast points can be read from disk in the formats understood by
+// `examples/heatmap_gen`: whitespace-separated text parsed by iostreams and by
+// the hand-written parser vs. packed uint32 records, once `read` into a buffer
+// and once `mmap`ed.
+// The last case additionally adds the mmaped points to a heatmap in one
+// batch call, to put the ingestion numbers in perspective.
+//
+// Both files are written right before being read, so they will mostly be
+// served from the page cache; drop it (`echo 1 > /proc/sys/vm/drop_caches`)
+// between runs to include the disk. Usage:
+//
+//   benchs/ingestion [NPOINTS [DIRECTORY]]
+//
+// The default of 100M points needs about 2GB of space in DIRECTORY.
+
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <fcntl.h>
+
+#include "benchs/common.hpp"
+#include "examples/pointio.hpp"
+
+static const size_t NPOINTS = 100*1000*1000;
+static const size_t MAPSIZE = 1024;
+static const size_t STAMP = 1;
+static const size_t GENCHUNK = 1000*1000;
+
+static unsigned long long checksum(const unsigned* xy, size_t npoints)
+{
+    unsigned long long sum = 0;
+    for(size_t i = 0 ; i < 2*npoints ; ++i) {
+        sum += xy[i];
+    }
+    return sum;
+}
+
+static unsigned long long read_text(const std::string& fname)
+{
+    unsigned long long sum = 0;
+    bool invalid = false;
+    int fd = open(fname.c_str(), O_RDONLY);
+    for_each_text_chunk(fd, [&](const char* lo, const char* data, size_t size, bool last) {
+        return parse_text_points(lo, data, size, last, false, [&](const unsigned* xy, const float*, size_t n) {
+            sum += checksum(xy, n);
+        }, &invalid);
+    });
+    close(fd);
+    return invalid ? 0 : sum;
+}
+
+static unsigned long long read_binary(const std::string& fname, bool use_mmap)
+{
+    unsigned long long sum = 0;
+    int fd = open(fname.c_str(), O_RDONLY);
+    for_each_record_chunk(fd, point_record_size(false), [&](const unsigned char* data, size_t n) {
+        sum += checksum(reinterpret_cast<const unsigned*>(data), n);
+    }, use_mmap);
+    close(fd);
+    return sum;
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t npoints = argc > 1 ? std::stoull(argv[1]) : NPOINTS;
+    const std::string dir = argc > 2 ? argv[2] : "/tmp";
+    const std::string txtname = dir + "/heatmap_ingestion.txt";
+    const std::string binname = dir + "/heatmap_ingestion.u32";
+
+    // We'll do something funky with ret in order to avoid optimizing
+    // whole code-blocks away.
+    int ret = 0;
+
+    // Generate the files chunk-wise, keeping all points in memory at once
+    // wouldn't leave much for the page cache.
+    std::cout << "Writing " << npoints << " random points to " << txtname << " and " << binname << "... " << std::flush;
+    unsigned long long expected = 0;
+    { Timer t;
+        std::ofstream txt(txtname);
+        FILE* bin = std::fopen(binname.c_str(), "wb");
+        std::mt19937 prng(1337);
+        std::uniform_int_distribution<unsigned> dist(0, MAPSIZE-1);
+        std::vector<unsigned> xy(2*GENCHUNK);
+        for(size_t i0 = 0 ; i0 < npoints ; i0 += GENCHUNK) {
+            const size_t n = std::min(GENCHUNK, npoints - i0);
+            for(size_t i = 0 ; i < n ; ++i) {
+                xy[2*i] = dist(prng);
+                xy[2*i+1] = dist(prng);
+                // Some garbage far beyond the map, as files from elsewhere have.
+                if(i % 1000 == 999)
+                    xy[2*i + i/1000 % 2] = UINT_MAX;
+                txt << xy[2*i] << " " << xy[2*i+1] << "\n";
+            }
+            std::fwrite(&xy[0], sizeof(unsigned), 2*n, bin);
+            expected += checksum(&xy[0], n);
+        }
+        std::fclose(bin);
+    }
+    const size_t txtbytes = std::ifstream(txtname, std::ios::binary | std::ios::ate).tellg();
+    const size_t binbytes = npoints*point_record_size(false);
+
+    std::cerr << "[" << std::endl;
+
+    std::cout << "Parsing " << txtbytes << " bytes of text with iostreams... " << std::flush;
+    std::cerr << "{'npoints': " << npoints << ", 'bytes': " << txtbytes << ", 'format': 'text', ";
+    for(RepeatTimer t(3) ; t ; t.next()) {
+        std::ifstream txt(txtname);
+        unsigned long long sum = 0;
+        unsigned x, y;
+        while(txt >> x >> y) {
+            sum += x;
+            sum += y;
+        }
+        ret += sum == expected;
+    }
+    std::cerr << "," << std::endl;
+
+    std::cout << "Parsing " << txtbytes << " bytes of text by hand... " << std::flush;
+    std::cerr << "{'npoints': " << npoints << ", 'bytes': " << txtbytes << ", 'format': 'textfast', ";
+    for(RepeatTimer t(3) ; t ; t.next()) {
+        ret += read_text(txtname) == expected;
+    }
+    std::cerr << "," << std::endl;
+
+    std::cout << "Reading " << binbytes << " bytes of binary with read... " << std::flush;
+    std::cerr << "{'npoints': " << npoints << ", 'bytes': " << binbytes << ", 'format': 'read', ";
+    for(RepeatTimer t(3) ; t ; t.next()) {
+        ret += read_binary(binname, false) == expected;
+    }
+    std::cerr << "," << std::endl;
+
+    std::cout << "Reading " << binbytes << " bytes of binary with mmap... " << std::flush;
+    std::cerr << "{'npoints': " << npoints << ", 'bytes': " << binbytes << ", 'format': 'mmap', ";
+    for(RepeatTimer t(3) ; t ; t.next()) {
+        ret += read_binary(binname, true) == expected;
+    }
+    std::cerr << "," << std::endl;
+
+    std::unique_ptr<heatmap_stamp_t> stamp(heatmap_stamp_gen(STAMP));
+    std::unique_ptr<heatmap_t> hm(heatmap_new(MAPSIZE, MAPSIZE));
+    std::cout << "Adding them from the mmap to a heatmap in batches... " << std::flush;
+    std::cerr << "{'npoints': " << npoints << ", 'bytes': " << binbytes << ", 'format': 'mmap+add', ";
+    for(RepeatTimer t(3) ; t ; t.next()) {
+        int fd = open(binname.c_str(), O_RDONLY);
+        for_each_record_chunk(fd, point_record_size(false), [&](const unsigned char* data, size_t n) {
+            heatmap_add_points_with_stamp(hm.get(), reinterpret_cast<const unsigned*>(data), n, stamp.get());
+        });
+        close(fd);
+    }
+    std::cerr << std::endl << "]" << std::endl;
+
+    std::remove(txtname.c_str());
+    std::remove(binname.c_str());
+
+    if(ret != 4*3) {
+        std::cout << "Some reader got a different checksum!" << std::endl;
+    }
+    return ret + (hm->max > 0.0f);
+}
@@ -41,6 +41,13 @@ int main(/* int argc, char *argv[] */)
     int ret = 0;
 
     std::unique_ptr<heatmap_stamp_t> stamp(heatmap_stamp_gen(STAMP));
+    std::cout << "Using the " << heatmap_simd_name() << " kernels." << std::endl;
+
+#ifdef _OPENMP
+    const unsigned maxthreads = omp_get_max_threads();
+#else
+    const unsigned maxthreads = 1;
+#endif
 
     std::cerr << "[" << std::endl;
     for(size_t mapsize = MAPSIZE_MIN ; mapsize <= MAPSIZE_MAX ; mapsize *= 2) {
@@ -68,6 +75,28 @@ int main(/* int argc, char *argv[] */)
             heatmap_render_saturated_to(hm.get(), heatmap_cs_default, 0.5f, &imgbuf[0]);
         }
         ret += imgbuf[0];
+        std::cerr << "," << std::endl;
+
+        // The same, but from half the memory.
+        std::unique_ptr<heatmap_half_t> hmh(heatmap_half_new(mapsize, mapsize));
+        heatmap_half_add_points_with_stamp(hmh.get(), &points[0], NPOINTS, stamp.get());
+        std::cerr << "{'mapsize': " << mapsize << ", 'saturation': true, 'half': true, ";
+        std::cout << "Rendering a " << mapsize << "² half-precision map with saturation... " << std::flush;
+        for(RepeatTimer t(5) ; t ; t.next()) {
+            heatmap_half_render_saturated_to(hmh.get(), heatmap_cs_default, 0.5f, &imgbuf[0]);
+        }
+        ret += imgbuf[0];
+
+        // And now see how well it scales when throwing more threads at it.
+        for(unsigned nthreads = 1 ; nthreads <= maxthreads ; ++nthreads) {
+            std::cerr << "," << std::endl;
+            std::cerr << "{'mapsize': " << mapsize << ", 'saturation': false, 'nthreads': " << nthreads << ", ";
+            std::cout << "Rendering a " << mapsize << "² map using " << nthreads << " threads... " << std::flush;
+            for(RepeatTimer t(5) ; t ; t.next()) {
+                heatmap_render_to_parallel(hm.get(), heatmap_cs_default, &imgbuf[0], nthreads);
+            }
+            ret += imgbuf[0];
+        }
 
         if(mapsize < MAPSIZE_MAX)
             std::cerr << "," << std::endl;
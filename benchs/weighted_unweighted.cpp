@@ -24,6 +24,11 @@
 
 // The same as `benchs/add_point_with_stamp.cpp` but compares that to the same
 // calls using weights.
+//
+// The hot loops use the best instruction set the CPU supports. In order to
+// compare them, run this with HEATMAP_SIMD set to c, sse2, avx2, or avx512.
+
+#include <string>
 
 #include "benchs/common.hpp"
 
@@ -39,13 +44,15 @@ int main(/* int argc, char *argv[] */)
     // whole code-blocks away.
     int ret = 0;
     auto points = genpoints(NPOINTS_MAX, MAPSIZE);
+    const std::string simd = heatmap_simd_name();
+    std::cout << "Using the " << simd << " kernels." << std::endl;
 
     std::cerr << "[" << std::endl;
     for(size_t stampsize = STAMP_MIN ; stampsize <= STAMP_MAX ; stampsize *= 2) {
         std::unique_ptr<heatmap_stamp_t> stamp(heatmap_stamp_gen(stampsize));
         for(size_t npoints = NPOINTS_MIN ; npoints <= NPOINTS_MAX ; npoints *= 10) {
             std::unique_ptr<heatmap_t> hm(heatmap_new(MAPSIZE, MAPSIZE));
-            std::cerr << "{'npoints': " << npoints << ", 'size': " << stampsize << ", 'weighted': false, ";
+            std::cerr << "{'npoints': " << npoints << ", 'size': " << stampsize << ", 'weighted': false, 'simd': '" << simd << "', ";
             std::cout << "Adding " << npoints << " points of size " << stampsize << " one after another... " << std::flush;
             for(RepeatTimer t(5) ; t ; t.next()) {
                 for(size_t i = 0 ; i < npoints ; ++i) {
@@ -62,7 +69,7 @@ int main(/* int argc, char *argv[] */)
         std::unique_ptr<heatmap_stamp_t> stamp(heatmap_stamp_gen(stampsize));
         for(size_t npoints = NPOINTS_MIN ; npoints <= NPOINTS_MAX ; npoints *= 10) {
             std::unique_ptr<heatmap_t> hm(heatmap_new(MAPSIZE, MAPSIZE));
-            std::cerr << "{'npoints': " << npoints << ", 'size': " << stampsize << ", 'weighted': true, ";
+            std::cerr << "{'npoints': " << npoints << ", 'size': " << stampsize << ", 'weighted': true, 'simd': '" << simd << "', ";
             std::cout << "Adding " << npoints << " points of size " << stampsize << " one after another... " << std::flush;
             for(RepeatTimer t(5) ; t ; t.next()) {
                 for(size_t i = 0 ; i < npoints ; ++i) {
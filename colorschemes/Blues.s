@@ -0,0 +1,4061 @@
+GAS LISTING /tmp/ccK8DYMt.s 			page 1
+
+
+   1              		.file	"Blues.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/Blues.c"
+   5              		.globl	heatmap_cs_Blues_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_Blues_mixed_exp, @object
+   9              		.size	heatmap_cs_Blues_mixed_exp, 8
+  10              	heatmap_cs_Blues_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 082F6B00 		.string	"\b/k"
+  29 0008 08316D18 		.ascii	"\b1m\030\b3p1\t5sJ\t7vc\t9y|\t;|\225\nD\211\256\nF\214\307\t"
+  29      08337031 
+  29      0935734A 
+  29      09377663 
+  29      0939797C 
+  30 0029 488FE009 		.ascii	"H\217\340\tJ\221\371\tL\224\377\bM\227\377\bO\232\377\bQ\234"
+  30      4A91F909 
+  30      4C94FF08 
+  30      4D97FF08 
+  30      4F9AFF08 
+  31 003f FF09539E 		.ascii	"\377\tS\236\377\nU\237\377\013V\240\377\rX\242\377\016Z\243\377"
+  31      FF0A559F 
+  31      FF0B56A0 
+  31      FF0D58A2 
+  31      FF0E5AA3 
+  32 0054 0F5CA4FF 		.ascii	"\017\\\244\377\021]\246\377\027e\254\377\030g\255\377\032h\256"
+  32      115DA6FF 
+  32      1765ACFF 
+  32      1867ADFF 
+  32      1A68AE
+  33 0067 FF1B6AB0 		.ascii	"\377\033j\260\377\034l\261\377\036m\262\377\037o\263\377 p\264"
+  33      FF1C6CB1 
+  33      FF1E6DB2 
+  33      FF1F6FB3 
+  33      FF2070B4 
+  34 007b FF2272B5 		.ascii	"\377\"r\265\377#t\266\377$u\267\377&w\270\377'x\271\377(z\272"
+GAS LISTING /tmp/ccK8DYMt.s 			page 2
+
+
+  34      FF2374B6 
+  34      FF2475B7 
+  34      FF2677B8 
+  34      FF2778B9 
+  35 0093 FF2A7BBA 		.ascii	"\377*{\272\377+}\273\3773\205\277\3775\206\300\3776\210\301\377"
+  35      FF2B7DBB 
+  35      FF3385BF 
+  35      FF3586C0 
+  35      FF3688C1 
+  36 00a8 3889C1FF 		.ascii	"8\211\301\377:\213\302\377;\214\303\377=\215\304\377>\217\304"
+  36      3A8BC2FF 
+  36      3B8CC3FF 
+  36      3D8DC4FF 
+  36      3E8FC4
+  37 00bb FF4090C5 		.ascii	"\377@\220\305\377A\221\305\377C\223\306\377E\224\307\377G\225"
+  37      FF4191C5 
+  37      FF4393C6 
+  37      FF4594C7 
+  37      FF4795
+  38 00ce C7FF4896 		.ascii	"\307\377H\226\310\377J\227\311\377L\230\311\377M\231\312\377"
+  38      C8FF4A97 
+  38      C9FF4C98 
+  38      C9FF4D99 
+  38      CAFF
+  39 00e0 4F9ACBFF 		.ascii	"O\232\313\377P\233\313\377R\234\314\377\\\243\320\377]\244\320"
+  39      509BCBFF 
+  39      529CCCFF 
+  39      5CA3D0FF 
+  39      5DA4D0
+  40 00f3 FF5FA5D1 		.ascii	"\377_\245\321\377`\246\321\377a\247\322\377c\250\322\377d\251"
+  40      FF60A6D1 
+  40      FF61A7D2 
+  40      FF63A8D2 
+  40      FF64A9
+  41 0106 D3FF66AA 		.ascii	"\323\377f\252\324\377g\253\324\377h\254\325\377j\255\325\377"
+  41      D4FF67AB 
+  41      D4FF68AC 
+  41      D5FF6AAD 
+  41      D5FF
+  42 0118 6BAED6FF 		.ascii	"k\256\326\377m\257\326\377o\260\326\377p\261\327\377r\262\327"
+  42      6DAFD6FF 
+  42      6FB0D6FF 
+  42      70B1D7FF 
+  42      72B2D7
+  43 012b FF74B2D7 		.ascii	"\377t\262\327\377u\263\330\377w\264\330\377y\265\330\377z\266"
+  43      FF75B3D8 
+  43      FF77B4D8 
+  43      FF79B5D8 
+  43      FF7AB6
+  44 013e D9FF7CB7 		.ascii	"\331\377|\267\331\377}\270\331\377\177\271\332\377\212\277\334"
+  44      D9FF7DB8 
+  44      D9FF7FB9 
+  44      DAFF8ABF 
+  44      DC
+  45 014f FF8CC0DD 		.ascii	"\377\214\300\335\377\215\301\335\377\217\301\335\377\220\302"
+  45      FF8DC1DD 
+  45      FF8FC1DD 
+GAS LISTING /tmp/ccK8DYMt.s 			page 3
+
+
+  45      FF90C2
+  46 015e DDFF92C3 		.ascii	"\335\377\222\303\336\377\223\304\336\377\225\305\336\377\226"
+  46      DEFF93C4 
+  46      DEFF95C5 
+  46      DEFF96
+  47 016d C5DFFF97 		.ascii	"\305\337\377\227\306\337\377\231\307\337\377\232\310\340\377"
+  47      C6DFFF99 
+  47      C7DFFF9A 
+  47      C8E0FF
+  48 017c 9BC8E0FF 		.ascii	"\233\310\340\377\235\311\340\377\236\312\341\377\237\312\341"
+  48      9DC9E0FF 
+  48      9ECAE1FF 
+  48      9FCAE1
+  49 018b FFA0CAE1 		.ascii	"\377\240\312\341\377\241\313\342\377\242\313\342\377\243\314"
+  49      FFA1CBE2 
+  49      FFA2CBE2 
+  49      FFA3CC
+  50 019a E3FFA4CC 		.ascii	"\343\377\244\314\343\377\245\315\343\377\246\315\344\377\247"
+  50      E3FFA5CD 
+  50      E3FFA6CD 
+  50      E4FFA7
+  51 01a9 CDE4FFA8 		.ascii	"\315\344\377\250\316\344\377\251\316\345\377\252\316\345\377"
+  51      CEE4FFA9 
+  51      CEE5FFAA 
+  51      CEE5FF
+  52 01b8 ABCFE5FF 		.ascii	"\253\317\345\377\254\317\346\377\255\320\346\377\256\320\346"
+  52      ACCFE6FF 
+  52      ADD0E6FF 
+  52      AED0E6
+  53 01c7 FFB7D4EA 		.ascii	"\377\267\324\352\377\267\324\352\377\270\325\352\377\271\325"
+  53      FFB7D4EA 
+  53      FFB8D5EA 
+  53      FFB9D5
+  54 01d6 EAFFBAD5 		.ascii	"\352\377\272\325\353\377\273\326\353\377\274\326\353\377\274"
+  54      EBFFBBD6 
+  54      EBFFBCD6 
+  54      EBFFBC
+  55 01e5 D6EBFFBD 		.ascii	"\326\353\377\275\327\354\377\276\327\354\377\277\327\354\377"
+  55      D7ECFFBE 
+  55      D7ECFFBF 
+  55      D7ECFF
+  56 01f4 BFD8EDFF 		.ascii	"\277\330\355\377\300\330\355\377\301\330\355\377\302\331\355"
+  56      C0D8EDFF 
+  56      C1D8EDFF 
+  56      C2D9ED
+  57 0203 FFC2D9ED 		.ascii	"\377\302\331\355\377\303\331\356\377\304\332\356\377\304\332"
+  57      FFC3D9EE 
+  57      FFC4DAEE 
+  57      FFC4DA
+  58 0212 EEFFC5DA 		.ascii	"\356\377\305\332\356\377\306\333\357\377\306\333\357\377\307"
+  58      EEFFC6DB 
+  58      EFFFC6DB 
+  58      EFFFC7
+  59 0221 DBEFFFC7 		.ascii	"\333\357\377\307\333\357\377\307\334\357\377\310\334\357\377"
+  59      DBEFFFC7 
+  59      DCEFFFC8 
+  59      DCEFFF
+GAS LISTING /tmp/ccK8DYMt.s 			page 4
+
+
+  60 0230 C8DCEFFF 		.ascii	"\310\334\357\377\311\335\360\377\311\335\360\377\311\335\360"
+  60      C9DDF0FF 
+  60      C9DDF0FF 
+  60      C9DDF0
+  61 023f FFCADDF0 		.ascii	"\377\312\335\360\377\312\336\360\377\313\336\360\377\313\336"
+  61      FFCADEF0 
+  61      FFCBDEF0 
+  61      FFCBDE
+  62 024e F0FFCBDE 		.ascii	"\360\377\313\336\360\377\314\337\361\377\314\337\361\377\314"
+  62      F0FFCCDF 
+  62      F1FFCCDF 
+  62      F1FFCC
+  63 025d DFF1FFCD 		.ascii	"\337\361\377\315\337\361\377\315\340\361\377\315\340\361\377"
+  63      DFF1FFCD 
+  63      E0F1FFCD 
+  63      E0F1FF
+  64 026c CEE0F1FF 		.ascii	"\316\340\361\377\316\340\361\377\316\340\361\377\317\341\362"
+  64      CEE0F1FF 
+  64      CEE0F1FF 
+  64      CFE1F2
+  65 027b FFD4E4F3 		.ascii	"\377\324\344\363\377\324\344\363\377\325\345\364\377\325\345"
+  65      FFD4E4F3 
+  65      FFD5E5F4 
+  65      FFD5E5
+  66 028a F4FFD5E5 		.ascii	"\364\377\325\345\364\377\326\345\364\377\326\345\364\377\326"
+  66      F4FFD6E5 
+  66      F4FFD6E5 
+  66      F4FFD6
+  67 0299 E6F4FFD6 		.ascii	"\346\364\377\326\346\364\377\327\346\364\377\327\346\364\377"
+  67      E6F4FFD7 
+  67      E6F4FFD7 
+  67      E6F4FF
+  68 02a8 D7E6F4FF 		.ascii	"\327\346\364\377\330\347\365\377\330\347\365\377\330\347\365"
+  68      D8E7F5FF 
+  68      D8E7F5FF 
+  68      D8E7F5
+  69 02b7 FFD9E7F5 		.ascii	"\377\331\347\365\377\331\347\365\377\331\350\365\377\331\350"
+  69      FFD9E7F5 
+  69      FFD9E8F5 
+  69      FFD9E8
+  70 02c6 F5FFDAE8 		.ascii	"\365\377\332\350\365\377\332\350\365\377\332\350\365\377\332"
+  70      F5FFDAE8 
+  70      F5FFDAE8 
+  70      F5FFDA
+  71 02d5 E8F5FFDB 		.ascii	"\350\365\377\333\351\366\377\333\351\366\377\333\351\366\377"
+  71      E9F6FFDB 
+  71      E9F6FFDB 
+  71      E9F6FF
+  72 02e4 DBE9F6FF 		.ascii	"\333\351\366\377\334\351\366\377\334\352\366\377\334\352\366"
+  72      DCE9F6FF 
+  72      DCEAF6FF 
+  72      DCEAF6
+  73 02f3 FFDCEAF6 		.ascii	"\377\334\352\366\377\335\352\366\377\335\352\366\377\335\352"
+  73      FFDDEAF6 
+  73      FFDDEAF6 
+  73      FFDDEA
+  74 0302 F6FFDDEA 		.ascii	"\366\377\335\352\366\377\336\353\367\377\336\353\367\377\336"
+GAS LISTING /tmp/ccK8DYMt.s 			page 5
+
+
+  74      F6FFDEEB 
+  74      F7FFDEEB 
+  74      F7FFDE
+  75 0311 EBF7FFDE 		.ascii	"\353\367\377\336\353\367\377\337\353\367\377\337\353\367\377"
+  75      EBF7FFDF 
+  75      EBF7FFDF 
+  75      EBF7FF
+  76 0320 DFEBF7FF 		.ascii	"\337\353\367\377\337\354\367\377\340\354\367\377\340\354\367"
+  76      DFECF7FF 
+  76      E0ECF7FF 
+  76      E0ECF7
+  77 032f FFE0ECF7 		.ascii	"\377\340\354\367\377\340\354\367\377\340\354\367\377\341\354"
+  77      FFE0ECF7 
+  77      FFE0ECF7 
+  77      FFE1EC
+  78 033e F7FFE1ED 		.ascii	"\367\377\341\355\370\377\341\355\370\377\341\355\370\377\341"
+  78      F8FFE1ED 
+  78      F8FFE1ED 
+  78      F8FFE1
+  79 034d EDF8FFE2 		.ascii	"\355\370\377\342\355\370\377\342\355\370\377\342\355\370\377"
+  79      EDF8FFE2 
+  79      EDF8FFE2 
+  79      EDF8FF
+  80 035c E2EDF8FF 		.ascii	"\342\355\370\377\342\356\370\377\343\356\370\377\343\356\370"
+  80      E2EEF8FF 
+  80      E3EEF8FF 
+  80      E3EEF8
+  81 036b FFE3EEF8 		.ascii	"\377\343\356\370\377\343\356\370\377\343\356\370\377\343\356"
+  81      FFE3EEF8 
+  81      FFE3EEF8 
+  81      FFE3EE
+  82 037a F8FFE4EE 		.ascii	"\370\377\344\356\370\377\344\356\371\377\344\357\371\377\344"
+  82      F8FFE4EE 
+  82      F9FFE4EF 
+  82      F9FFE4
+  83 0389 EFF9FFE4 		.ascii	"\357\371\377\344\357\371\377\345\357\371\377\345\357\371\377"
+  83      EFF9FFE5 
+  83      EFF9FFE5 
+  83      EFF9FF
+  84 0398 E5EFF9FF 		.ascii	"\345\357\371\377\345\357\371\377\345\357\371\377\345\357\371"
+  84      E5EFF9FF 
+  84      E5EFF9FF 
+  84      E5EFF9
+  85 03a7 FFE5F0F9 		.ascii	"\377\345\360\371\377\346\360\371\377\346\360\371\377\346\360"
+  85      FFE6F0F9 
+  85      FFE6F0F9 
+  85      FFE6F0
+  86 03b6 F9FFE6F0 		.ascii	"\371\377\346\360\371\377\346\360\371\377\346\360\371\377\346"
+  86      F9FFE6F0 
+  86      F9FFE6F0 
+  86      F9FFE6
+  87 03c5 F0F9FFE7 		.ascii	"\360\371\377\347\360\371\377\347\360\371\377\347\360\372\377"
+  87      F0F9FFE7 
+  87      F0F9FFE7 
+  87      F0FAFF
+  88 03d4 E7F1FAFF 		.ascii	"\347\361\372\377\347\361\372\377\347\361\372\377\347\361\372"
+  88      E7F1FAFF 
+GAS LISTING /tmp/ccK8DYMt.s 			page 6
+
+
+  88      E7F1FAFF 
+  88      E7F1FA
+  89 03e3 FFEDF4FB 		.ascii	"\377\355\364\373\377\355\364\373\377\355\364\373\377\355\364"
+  89      FFEDF4FB 
+  89      FFEDF4FB 
+  89      FFEDF4
+  90 03f2 FBFFEDF4 		.ascii	"\373\377\355\364\373\377\355\364\374\377\355\365\374\377\355"
+  90      FBFFEDF4 
+  90      FCFFEDF5 
+  90      FCFFED
+  91 0401 F5FCFFEE 		.ascii	"\365\374\377\356\365\374\377\356\365\374\377\356\365\374\377"
+  91      F5FCFFEE 
+  91      F5FCFFEE 
+  91      F5FCFF
+  92 0410 EEF5FCFF 		.ascii	"\356\365\374\377\356\365\374\377\356\365\374\377\356\365\374"
+  92      EEF5FCFF 
+  92      EEF5FCFF 
+  92      EEF5FC
+  93 041f FFEEF5FC 		.ascii	"\377\356\365\374\377\356\365\374\377\357\365\374\377\357\365"
+  93      FFEEF5FC 
+  93      FFEFF5FC 
+  93      FFEFF5
+  94 042e FCFFEFF5 		.ascii	"\374\377\357\365\374\377\357\366\374\377\357\366\374\377\357"
+  94      FCFFEFF6 
+  94      FCFFEFF6 
+  94      FCFFEF
+  95 043d F6FCFFEF 		.ascii	"\366\374\377\357\366\374\377\357\366\374\377\357\366\374\377"
+  95      F6FCFFEF 
+  95      F6FCFFEF 
+  95      F6FCFF
+  96 044c EFF6FCFF 		.ascii	"\357\366\374\377\360\366\374\377\360\366\374\377\360\366\374"
+  96      F0F6FCFF 
+  96      F0F6FCFF 
+  96      F0F6FC
+  97 045b FFF0F6FC 		.ascii	"\377\360\366\374\377\360\366\374\377\360\366\374\377\360\366"
+  97      FFF0F6FC 
+  97      FFF0F6FC 
+  97      FFF0F6
+  98 046a FCFFF0F6 		.ascii	"\374\377\360\366\374\377\360\366\374\377\360\366\375\377\360"
+  98      FCFFF0F6 
+  98      FCFFF0F6 
+  98      FDFFF0
+  99 0479 F7FDFFF1 		.ascii	"\367\375\377\361\367\375\377\361\367\375\377\361\367\375\377"
+  99      F7FDFFF1 
+  99      F7FDFFF1 
+  99      F7FDFF
+ 100 0488 F1F7FDFF 		.ascii	"\361\367\375\377\361\367\375\377\361\367\375\377\361\367\375"
+ 100      F1F7FDFF 
+ 100      F1F7FDFF 
+ 100      F1F7FD
+ 101 0497 FFF1F7FD 		.ascii	"\377\361\367\375\377\361\367\375\377\361\367\375\377\361\367"
+ 101      FFF1F7FD 
+ 101      FFF1F7FD 
+ 101      FFF1F7
+ 102 04a6 FDFFF1F7 		.ascii	"\375\377\361\367\375\377\361\367\375\377\361\367\375\377\362"
+ 102      FDFFF1F7 
+ 102      FDFFF1F7 
+GAS LISTING /tmp/ccK8DYMt.s 			page 7
+
+
+ 102      FDFFF2
+ 103 04b5 F7FDFFF2 		.ascii	"\367\375\377\362\367\375\377\362\367\375\377\362\367\375\377"
+ 103      F7FDFFF2 
+ 103      F7FDFFF2 
+ 103      F7FDFF
+ 104 04c4 F2F7FDFF 		.ascii	"\362\367\375\377\362\367\375\377\362\370\375\377\362\370\375"
+ 104      F2F7FDFF 
+ 104      F2F8FDFF 
+ 104      F2F8FD
+ 105 04d3 FFF2F8FD 		.ascii	"\377\362\370\375\377\362\370\375\377\362\370\375\377\362\370"
+ 105      FFF2F8FD 
+ 105      FFF2F8FD 
+ 105      FFF2F8
+ 106 04e2 FDFFF2F8 		.ascii	"\375\377\362\370\375\377\362\370\375\377\362\370\375\377\362"
+ 106      FDFFF2F8 
+ 106      FDFFF2F8 
+ 106      FDFFF2
+ 107 04f1 F8FDFFF3 		.ascii	"\370\375\377\363\370\375\377\363\370\375\377\363\370\375\377"
+ 107      F8FDFFF3 
+ 107      F8FDFFF3 
+ 107      F8FDFF
+ 108 0500 F3F8FDFF 		.ascii	"\363\370\375\377\363\370\375\377\363\370\375\377\363\370\375"
+ 108      F3F8FDFF 
+ 108      F3F8FDFF 
+ 108      F3F8FD
+ 109 050f FFF3F8FD 		.ascii	"\377\363\370\375\377\363\370\375\377\363\370\375\377\363\370"
+ 109      FFF3F8FD 
+ 109      FFF3F8FD 
+ 109      FFF3F8
+ 110 051e FDFFF3F8 		.ascii	"\375\377\363\370\375\377\363\370\375\377\363\370\375\377\363"
+ 110      FDFFF3F8 
+ 110      FDFFF3F8 
+ 110      FDFFF3
+ 111 052d F8FDFFF3 		.ascii	"\370\375\377\363\370\375\377\363\370\375\377\363\370\376\377"
+ 111      F8FDFFF3 
+ 111      F8FDFFF3 
+ 111      F8FEFF
+ 112 053c F3F9FEFF 		.ascii	"\363\371\376\377\363\371\376\377\364\371\376\377\364\371\376"
+ 112      F3F9FEFF 
+ 112      F4F9FEFF 
+ 112      F4F9FE
+ 113 054b FFF4F9FE 		.ascii	"\377\364\371\376\377\364\371\376\377\364\371\376\377\364\371"
+ 113      FFF4F9FE 
+ 113      FFF4F9FE 
+ 113      FFF4F9
+ 114 055a FEFFF4F9 		.ascii	"\376\377\364\371\376\377\364\371\376\377\364\371\376\377\364"
+ 114      FEFFF4F9 
+ 114      FEFFF4F9 
+ 114      FEFFF4
+ 115 0569 F9FEFFF4 		.ascii	"\371\376\377\364\371\376\377\364\371\376\377\364\371\376\377"
+ 115      F9FEFFF4 
+ 115      F9FEFFF4 
+ 115      F9FEFF
+ 116 0578 F4F9FEFF 		.ascii	"\364\371\376\377\364\371\376\377\364\371\376\377\364\371\376"
+ 116      F4F9FEFF 
+ 116      F4F9FEFF 
+ 116      F4F9FE
+GAS LISTING /tmp/ccK8DYMt.s 			page 8
+
+
+ 117 0587 FFF4F9FE 		.ascii	"\377\364\371\376\377\364\371\376\377\364\371\376\377\364\371"
+ 117      FFF4F9FE 
+ 117      FFF4F9FE 
+ 117      FFF4F9
+ 118 0596 FEFFF4F9 		.ascii	"\376\377\364\371\376\377\364\371\376\377\364\371\376\377\364"
+ 118      FEFFF4F9 
+ 118      FEFFF4F9 
+ 118      FEFFF4
+ 119 05a5 F9FEFFF4 		.ascii	"\371\376\377\364\371\376\377\364\371\376\377\365\371\376\377"
+ 119      F9FEFFF4 
+ 119      F9FEFFF5 
+ 119      F9FEFF
+ 120 05b4 F5F9FEFF 		.ascii	"\365\371\376\377\365\371\376\377\365\371\376\377\365\371\376"
+ 120      F5F9FEFF 
+ 120      F5F9FEFF 
+ 120      F5F9FE
+ 121 05c3 FFF5F9FE 		.ascii	"\377\365\371\376\377\365\371\376\377\365\371\376\377\365\371"
+ 121      FFF5F9FE 
+ 121      FFF5F9FE 
+ 121      FFF5F9
+ 122 05d2 FEFFF5F9 		.ascii	"\376\377\365\371\376\377\365\371\376\377\365\371\376\377\365"
+ 122      FEFFF5F9 
+ 122      FEFFF5F9 
+ 122      FEFFF5
+ 123 05e1 F9FEFFF5 		.ascii	"\371\376\377\365\371\376\377\365\371\376\377\365\371\376\377"
+ 123      F9FEFFF5 
+ 123      F9FEFFF5 
+ 123      F9FEFF
+ 124 05f0 F5F9FEFF 		.ascii	"\365\371\376\377\365\371\376\377\365\372\376\377\365\372\376"
+ 124      F5F9FEFF 
+ 124      F5FAFEFF 
+ 124      F5FAFE
+ 125 05ff FFF5FAFE 		.ascii	"\377\365\372\376\377\365\372\376\377\365\372\376\377\365\372"
+ 125      FFF5FAFE 
+ 125      FFF5FAFE 
+ 125      FFF5FA
+ 126 060e FEFFF5FA 		.ascii	"\376\377\365\372\376\377\365\372\376\377\365\372\376\377\365"
+ 126      FEFFF5FA 
+ 126      FEFFF5FA 
+ 126      FEFFF5
+ 127 061d FAFEFFF5 		.ascii	"\372\376\377\365\372\376\377\365\372\376\377\365\372\376\377"
+ 127      FAFEFFF5 
+ 127      FAFEFFF5 
+ 127      FAFEFF
+ 128 062c F5FAFEFF 		.ascii	"\365\372\376\377\365\372\376\377\365\372\376\377\365\372\376"
+ 128      F5FAFEFF 
+ 128      F5FAFEFF 
+ 128      F5FAFE
+ 129 063b FFF5FAFE 		.ascii	"\377\365\372\376\377\365\372\376\377\365\372\376\377\365\372"
+ 129      FFF5FAFE 
+ 129      FFF5FAFE 
+ 129      FFF5FA
+ 130 064a FEFFF5FA 		.ascii	"\376\377\365\372\376\377\365\372\376\377\365\372\376\377\365"
+ 130      FEFFF5FA 
+ 130      FEFFF5FA 
+ 130      FEFFF5
+ 131 0659 FAFEFFF5 		.ascii	"\372\376\377\365\372\376\377\366\372\376\377\366\372\376\377"
+GAS LISTING /tmp/ccK8DYMt.s 			page 9
+
+
+ 131      FAFEFFF6 
+ 131      FAFEFFF6 
+ 131      FAFEFF
+ 132 0668 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 132      F6FAFEFF 
+ 132      F6FAFEFF 
+ 132      F6FAFE
+ 133 0677 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 133      FFF6FAFE 
+ 133      FFF6FAFE 
+ 133      FFF6FA
+ 134 0686 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 134      FEFFF6FA 
+ 134      FEFFF6FA 
+ 134      FEFFF6
+ 135 0695 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 135      FAFEFFF6 
+ 135      FAFEFFF6 
+ 135      FAFEFF
+ 136 06a4 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 136      F6FAFEFF 
+ 136      F6FAFEFF 
+ 136      F6FAFE
+ 137 06b3 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 137      FFF6FAFE 
+ 137      FFF6FAFE 
+ 137      FFF6FA
+ 138 06c2 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 138      FEFFF6FA 
+ 138      FEFFF6FA 
+ 138      FEFFF6
+ 139 06d1 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 139      FAFEFFF6 
+ 139      FAFEFFF6 
+ 139      FAFEFF
+ 140 06e0 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 140      F6FAFEFF 
+ 140      F6FAFEFF 
+ 140      F6FAFE
+ 141 06ef FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 141      FFF6FAFE 
+ 141      FFF6FAFE 
+ 141      FFF6FA
+ 142 06fe FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 142      FEFFF6FA 
+ 142      FEFFF6FA 
+ 142      FEFFF6
+ 143 070d FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 143      FAFEFFF6 
+ 143      FAFEFFF6 
+ 143      FAFEFF
+ 144 071c F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 144      F6FAFEFF 
+ 144      F6FAFEFF 
+ 144      F6FAFE
+ 145 072b FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 145      FFF6FAFE 
+GAS LISTING /tmp/ccK8DYMt.s 			page 10
+
+
+ 145      FFF6FAFE 
+ 145      FFF6FA
+ 146 073a FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 146      FEFFF6FA 
+ 146      FEFFF6FA 
+ 146      FEFFF6
+ 147 0749 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 147      FAFEFFF6 
+ 147      FAFEFFF6 
+ 147      FAFEFF
+ 148 0758 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 148      F6FAFEFF 
+ 148      F6FAFEFF 
+ 148      F6FAFE
+ 149 0767 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 149      FFF6FAFE 
+ 149      FFF6FAFE 
+ 149      FFF6FA
+ 150 0776 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 150      FEFFF6FA 
+ 150      FEFFF6FA 
+ 150      FEFFF6
+ 151 0785 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 151      FAFEFFF6 
+ 151      FAFEFFF6 
+ 151      FAFEFF
+ 152 0794 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 152      F6FAFEFF 
+ 152      F6FAFEFF 
+ 152      F6FAFE
+ 153 07a3 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 153      FFF6FAFE 
+ 153      FFF6FAFE 
+ 153      FFF6FA
+ 154 07b2 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 154      FEFFF6FA 
+ 154      FEFFF6FA 
+ 154      FEFFF6
+ 155 07c1 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 155      FAFEFFF6 
+ 155      FAFEFFF6 
+ 155      FAFEFF
+ 156 07d0 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 156      F6FAFEFF 
+ 156      F6FAFEFF 
+ 156      F6FAFE
+ 157 07df FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 157      FFF6FAFE 
+ 157      FFF6FAFE 
+ 157      FFF6FA
+ 158 07ee FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 158      FEFFF6FA 
+ 158      FEFFF6FA 
+ 158      FEFFF6
+ 159 07fd FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 159      FAFEFFF6 
+ 159      FAFEFFF6 
+GAS LISTING /tmp/ccK8DYMt.s 			page 11
+
+
+ 159      FAFEFF
+ 160 080c F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 160      F6FAFEFF 
+ 160      F6FAFEFF 
+ 160      F6FAFE
+ 161 081b FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 161      FFF6FAFE 
+ 161      FFF6FAFE 
+ 161      FFF6FA
+ 162 082a FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 162      FEFFF6FA 
+ 162      FEFFF6FA 
+ 162      FEFFF6
+ 163 0839 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 163      FAFEFFF6 
+ 163      FAFEFFF6 
+ 163      FAFEFF
+ 164 0848 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 164      F6FAFEFF 
+ 164      F6FAFEFF 
+ 164      F6FAFE
+ 165 0857 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 165      FFF6FAFE 
+ 165      FFF6FAFE 
+ 165      FFF6FA
+ 166 0866 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 166      FEFFF6FA 
+ 166      FEFFF6FA 
+ 166      FEFFF6
+ 167 0875 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 167      FAFEFFF6 
+ 167      FAFEFFF6 
+ 167      FAFEFF
+ 168 0884 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 168      F6FAFEFF 
+ 168      F6FAFEFF 
+ 168      F6FAFE
+ 169 0893 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 169      FFF6FAFE 
+ 169      FFF6FAFE 
+ 169      FFF6FA
+ 170 08a2 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 170      FEFFF6FA 
+ 170      FEFFF6FA 
+ 170      FEFFF6
+ 171 08b1 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 171      FAFEFFF6 
+ 171      FAFEFFF6 
+ 171      FAFEFF
+ 172 08c0 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 172      F6FAFEFF 
+ 172      F6FAFEFF 
+ 172      F6FAFE
+ 173 08cf FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 173      FFF6FAFE 
+ 173      FFF6FAFE 
+ 173      FFF6FA
+GAS LISTING /tmp/ccK8DYMt.s 			page 12
+
+
+ 174 08de FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 174      FEFFF6FA 
+ 174      FEFFF6FA 
+ 174      FEFFF6
+ 175 08ed FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 175      FAFEFFF6 
+ 175      FAFEFFF6 
+ 175      FAFEFF
+ 176 08fc F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 176      F6FAFEFF 
+ 176      F6FAFEFF 
+ 176      F6FAFE
+ 177 090b FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 177      FFF6FAFE 
+ 177      FFF6FAFE 
+ 177      FFF6FA
+ 178 091a FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 178      FEFFF6FA 
+ 178      FEFFF6FA 
+ 178      FEFFF6
+ 179 0929 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 179      FAFEFFF6 
+ 179      FAFEFFF6 
+ 179      FAFEFF
+ 180 0938 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 180      F6FAFEFF 
+ 180      F6FAFEFF 
+ 180      F6FAFE
+ 181 0947 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 181      FFF6FAFE 
+ 181      FFF6FAFE 
+ 181      FFF6FA
+ 182 0956 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 182      FEFFF6FA 
+ 182      FEFFF6FA 
+ 182      FEFFF6
+ 183 0965 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 183      FAFEFFF6 
+ 183      FAFEFFF6 
+ 183      FAFEFF
+ 184 0974 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 184      F6FAFEFF 
+ 184      F6FAFEFF 
+ 184      F6FAFE
+ 185 0983 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 185      FFF6FAFE 
+ 185      FFF6FAFE 
+ 185      FFF6FA
+ 186 0992 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 186      FEFFF6FA 
+ 186      FEFFF6FA 
+ 186      FEFFF6
+ 187 09a1 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 187      FAFEFFF6 
+ 187      FAFEFFF6 
+ 187      FAFEFF
+ 188 09b0 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+GAS LISTING /tmp/ccK8DYMt.s 			page 13
+
+
+ 188      F6FAFEFF 
+ 188      F6FAFEFF 
+ 188      F6FAFE
+ 189 09bf FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 189      FFF6FAFE 
+ 189      FFF6FAFE 
+ 189      FFF6FA
+ 190 09ce FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 190      FEFFF6FA 
+ 190      FEFFF6FA 
+ 190      FEFFF6
+ 191 09dd FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 191      FAFEFFF6 
+ 191      FAFEFFF6 
+ 191      FAFEFF
+ 192 09ec F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 192      F6FAFEFF 
+ 192      F6FAFEFF 
+ 192      F6FAFE
+ 193 09fb FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 193      FFF6FAFE 
+ 193      FFF6FAFE 
+ 193      FFF6FA
+ 194 0a0a FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 194      FEFFF6FA 
+ 194      FEFFF6FA 
+ 194      FEFFF6
+ 195 0a19 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 195      FAFEFFF6 
+ 195      FAFEFFF6 
+ 195      FAFEFF
+ 196 0a28 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 196      F6FAFEFF 
+ 196      F6FAFEFF 
+ 196      F6FAFE
+ 197 0a37 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 197      FFF6FAFE 
+ 197      FFF6FAFE 
+ 197      FFF6FA
+ 198 0a46 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 198      FEFFF6FA 
+ 198      FEFFF6FA 
+ 198      FEFFF6
+ 199 0a55 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 199      FAFEFFF6 
+ 199      FAFEFFF6 
+ 199      FAFEFF
+ 200 0a64 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 200      F6FAFEFF 
+ 200      F6FAFEFF 
+ 200      F6FAFE
+ 201 0a73 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 201      FFF6FAFE 
+ 201      FFF6FAFE 
+ 201      FFF6FA
+ 202 0a82 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 202      FEFFF6FA 
+GAS LISTING /tmp/ccK8DYMt.s 			page 14
+
+
+ 202      FEFFF6FA 
+ 202      FEFFF6
+ 203 0a91 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 203      FAFEFFF6 
+ 203      FAFEFFF6 
+ 203      FAFEFF
+ 204 0aa0 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 204      F6FAFEFF 
+ 204      F6FAFEFF 
+ 204      F6FAFE
+ 205 0aaf FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 205      FFF6FAFE 
+ 205      FFF6FAFE 
+ 205      FFF6FA
+ 206 0abe FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 206      FEFFF6FA 
+ 206      FEFFF6FA 
+ 206      FEFFF6
+ 207 0acd FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 207      FAFEFFF6 
+ 207      FAFEFFF6 
+ 207      FAFEFF
+ 208 0adc F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 208      F6FAFEFF 
+ 208      F6FAFEFF 
+ 208      F6FAFE
+ 209 0aeb FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 209      FFF6FAFE 
+ 209      FFF6FAFE 
+ 209      FFF6FA
+ 210 0afa FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 210      FEFFF6FA 
+ 210      FEFFF6FA 
+ 210      FEFFF6
+ 211 0b09 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 211      FAFEFFF6 
+ 211      FAFEFFF6 
+ 211      FAFEFF
+ 212 0b18 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 212      F6FAFEFF 
+ 212      F6FAFEFF 
+ 212      F6FAFE
+ 213 0b27 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 213      FFF6FAFE 
+ 213      FFF6FAFE 
+ 213      FFF6FA
+ 214 0b36 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 214      FEFFF6FA 
+ 214      FEFFF6FA 
+ 214      FEFFF6
+ 215 0b45 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 215      FAFEFFF6 
+ 215      FAFEFFF6 
+ 215      FAFEFF
+ 216 0b54 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 216      F6FAFEFF 
+ 216      F6FAFEFF 
+GAS LISTING /tmp/ccK8DYMt.s 			page 15
+
+
+ 216      F6FAFE
+ 217 0b63 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 217      FFF6FAFE 
+ 217      FFF6FAFE 
+ 217      FFF6FA
+ 218 0b72 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 218      FEFFF6FA 
+ 218      FEFFF6FA 
+ 218      FEFFF6
+ 219 0b81 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 219      FAFEFFF6 
+ 219      FAFEFFF6 
+ 219      FAFEFF
+ 220 0b90 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 220      F6FAFEFF 
+ 220      F6FAFEFF 
+ 220      F6FAFE
+ 221 0b9f FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 221      FFF6FAFE 
+ 221      FFF6FAFE 
+ 221      FFF6FA
+ 222 0bae FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 222      FEFFF6FA 
+ 222      FEFFF6FA 
+ 222      FEFFF6
+ 223 0bbd FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 223      FAFEFFF6 
+ 223      FAFEFFF6 
+ 223      FAFEFF
+ 224 0bcc F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 224      F6FAFEFF 
+ 224      F6FAFEFF 
+ 224      F6FAFE
+ 225 0bdb FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 225      FFF6FAFE 
+ 225      FFF6FAFE 
+ 225      FFF6FA
+ 226 0bea FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 226      FEFFF6FA 
+ 226      FEFFF6FA 
+ 226      FEFFF6
+ 227 0bf9 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 227      FAFEFFF6 
+ 227      FAFEFFF6 
+ 227      FAFEFF
+ 228 0c08 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 228      F6FAFEFF 
+ 228      F6FAFEFF 
+ 228      F6FAFE
+ 229 0c17 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 229      FFF6FAFE 
+ 229      FFF6FAFE 
+ 229      FFF6FA
+ 230 0c26 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 230      FEFFF6FA 
+ 230      FEFFF6FA 
+ 230      FEFFF6
+GAS LISTING /tmp/ccK8DYMt.s 			page 16
+
+
+ 231 0c35 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 231      FAFEFFF6 
+ 231      FAFEFFF6 
+ 231      FAFEFF
+ 232 0c44 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 232      F6FAFEFF 
+ 232      F6FAFEFF 
+ 232      F6FAFE
+ 233 0c53 FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 233      FFF6FAFE 
+ 233      FFF6FAFE 
+ 233      FFF6FA
+ 234 0c62 FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 234      FEFFF6FA 
+ 234      FEFFF6FA 
+ 234      FEFFF6
+ 235 0c71 FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 235      FAFEFFF6 
+ 235      FAFEFFF6 
+ 235      FAFEFF
+ 236 0c80 F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\372\376\377\366\372\376"
+ 236      F6FAFEFF 
+ 236      F6FAFEFF 
+ 236      F6FAFE
+ 237 0c8f FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 237      FFF6FAFE 
+ 237      FFF6FAFE 
+ 237      FFF6FA
+ 238 0c9e FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377\366\372\376\377\366"
+ 238      FEFFF6FA 
+ 238      FEFFF6FA 
+ 238      FEFFF6
+ 239 0cad FAFEFFF6 		.ascii	"\372\376\377\366\372\376\377\366\372\376\377\366\372\376\377"
+ 239      FAFEFFF6 
+ 239      FAFEFFF6 
+ 239      FAFEFF
+ 240 0cbc F6FAFEFF 		.ascii	"\366\372\376\377\366\372\376\377\366\373\376\377\366\373\376"
+ 240      F6FAFEFF 
+ 240      F6FBFEFF 
+ 240      F6FBFE
+ 241 0ccb FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 241      FFF6FBFE 
+ 241      FFF6FBFE 
+ 241      FFF6FB
+ 242 0cda FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 242      FEFFF6FB 
+ 242      FEFFF6FB 
+ 242      FEFFF6
+ 243 0ce9 FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 243      FBFEFFF6 
+ 243      FBFEFFF6 
+ 243      FBFEFF
+ 244 0cf8 F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 244      F6FBFEFF 
+ 244      F6FBFEFF 
+ 244      F6FBFE
+ 245 0d07 FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+GAS LISTING /tmp/ccK8DYMt.s 			page 17
+
+
+ 245      FFF6FBFE 
+ 245      FFF6FBFE 
+ 245      FFF6FB
+ 246 0d16 FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 246      FEFFF6FB 
+ 246      FEFFF6FB 
+ 246      FEFFF6
+ 247 0d25 FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 247      FBFEFFF6 
+ 247      FBFEFFF6 
+ 247      FBFEFF
+ 248 0d34 F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 248      F6FBFEFF 
+ 248      F6FBFEFF 
+ 248      F6FBFE
+ 249 0d43 FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 249      FFF6FBFE 
+ 249      FFF6FBFE 
+ 249      FFF6FB
+ 250 0d52 FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 250      FEFFF6FB 
+ 250      FEFFF6FB 
+ 250      FEFFF6
+ 251 0d61 FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 251      FBFEFFF6 
+ 251      FBFEFFF6 
+ 251      FBFEFF
+ 252 0d70 F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 252      F6FBFEFF 
+ 252      F6FBFEFF 
+ 252      F6FBFE
+ 253 0d7f FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 253      FFF6FBFE 
+ 253      FFF6FBFE 
+ 253      FFF6FB
+ 254 0d8e FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 254      FEFFF6FB 
+ 254      FEFFF6FB 
+ 254      FEFFF6
+ 255 0d9d FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 255      FBFEFFF6 
+ 255      FBFEFFF6 
+ 255      FBFEFF
+ 256 0dac F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 256      F6FBFEFF 
+ 256      F6FBFEFF 
+ 256      F6FBFE
+ 257 0dbb FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 257      FFF6FBFE 
+ 257      FFF6FBFE 
+ 257      FFF6FB
+ 258 0dca FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 258      FEFFF6FB 
+ 258      FEFFF6FB 
+ 258      FEFFF6
+ 259 0dd9 FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 259      FBFEFFF6 
+GAS LISTING /tmp/ccK8DYMt.s 			page 18
+
+
+ 259      FBFEFFF6 
+ 259      FBFEFF
+ 260 0de8 F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 260      F6FBFEFF 
+ 260      F6FBFEFF 
+ 260      F6FBFE
+ 261 0df7 FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 261      FFF6FBFE 
+ 261      FFF6FBFE 
+ 261      FFF6FB
+ 262 0e06 FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 262      FEFFF6FB 
+ 262      FEFFF6FB 
+ 262      FEFFF6
+ 263 0e15 FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 263      FBFEFFF6 
+ 263      FBFEFFF6 
+ 263      FBFEFF
+ 264 0e24 F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 264      F6FBFEFF 
+ 264      F6FBFEFF 
+ 264      F6FBFE
+ 265 0e33 FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 265      FFF6FBFE 
+ 265      FFF6FBFE 
+ 265      FFF6FB
+ 266 0e42 FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 266      FEFFF6FB 
+ 266      FEFFF6FB 
+ 266      FEFFF6
+ 267 0e51 FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 267      FBFEFFF6 
+ 267      FBFEFFF6 
+ 267      FBFEFF
+ 268 0e60 F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 268      F6FBFEFF 
+ 268      F6FBFEFF 
+ 268      F6FBFE
+ 269 0e6f FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 269      FFF6FBFE 
+ 269      FFF6FBFE 
+ 269      FFF6FB
+ 270 0e7e FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 270      FEFFF6FB 
+ 270      FEFFF6FB 
+ 270      FEFFF6
+ 271 0e8d FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 271      FBFEFFF6 
+ 271      FBFEFFF6 
+ 271      FBFEFF
+ 272 0e9c F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 272      F6FBFEFF 
+ 272      F6FBFEFF 
+ 272      F6FBFE
+ 273 0eab FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 273      FFF6FBFE 
+ 273      FFF6FBFE 
+GAS LISTING /tmp/ccK8DYMt.s 			page 19
+
+
+ 273      FFF6FB
+ 274 0eba FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 274      FEFFF6FB 
+ 274      FEFFF6FB 
+ 274      FEFFF6
+ 275 0ec9 FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 275      FBFEFFF6 
+ 275      FBFEFFF6 
+ 275      FBFEFF
+ 276 0ed8 F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 276      F6FBFEFF 
+ 276      F6FBFEFF 
+ 276      F6FBFE
+ 277 0ee7 FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 277      FFF6FBFE 
+ 277      FFF6FBFE 
+ 277      FFF6FB
+ 278 0ef6 FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 278      FEFFF6FB 
+ 278      FEFFF6FB 
+ 278      FEFFF6
+ 279 0f05 FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 279      FBFEFFF6 
+ 279      FBFEFFF6 
+ 279      FBFEFF
+ 280 0f14 F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 280      F6FBFEFF 
+ 280      F6FBFEFF 
+ 280      F6FBFE
+ 281 0f23 FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 281      FFF6FBFE 
+ 281      FFF6FBFE 
+ 281      FFF6FB
+ 282 0f32 FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 282      FEFFF6FB 
+ 282      FEFFF6FB 
+ 282      FEFFF6
+ 283 0f41 FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 283      FBFEFFF6 
+ 283      FBFEFFF6 
+ 283      FBFEFF
+ 284 0f50 F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 284      F6FBFEFF 
+ 284      F6FBFEFF 
+ 284      F6FBFE
+ 285 0f5f FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 285      FFF6FBFE 
+ 285      FFF6FBFE 
+ 285      FFF6FB
+ 286 0f6e FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 286      FEFFF6FB 
+ 286      FEFFF6FB 
+ 286      FEFFF6
+ 287 0f7d FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 287      FBFEFFF6 
+ 287      FBFEFFF6 
+ 287      FBFEFF
+GAS LISTING /tmp/ccK8DYMt.s 			page 20
+
+
+ 288 0f8c F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 288      F6FBFEFF 
+ 288      F6FBFEFF 
+ 288      F6FBFE
+ 289 0f9b FFF6FBFE 		.ascii	"\377\366\373\376\377"
+ 289      FF
+ 290 0fa0 F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 290      F6FBFEFF 
+ 290      F6FBFEFF 
+ 290      F6FBFE
+ 291 0faf FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 291      FFF6FBFE 
+ 291      FFF6FBFE 
+ 291      FFF6FB
+ 292 0fbe FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377\366\373\376\377\366"
+ 292      FEFFF6FB 
+ 292      FEFFF6FB 
+ 292      FEFFF6
+ 293 0fcd FBFEFFF6 		.ascii	"\373\376\377\366\373\376\377\366\373\376\377\366\373\376\377"
+ 293      FBFEFFF6 
+ 293      FBFEFFF6 
+ 293      FBFEFF
+ 294 0fdc F6FBFEFF 		.ascii	"\366\373\376\377\366\373\376\377\366\373\376\377\366\373\376"
+ 294      F6FBFEFF 
+ 294      F6FBFEFF 
+ 294      F6FBFE
+ 295 0feb FFF6FBFE 		.ascii	"\377\366\373\376\377\366\373\376\377\366\373\376\377\366\373"
+ 295      FFF6FBFE 
+ 295      FFF6FBFE 
+ 295      FFF6FB
+ 296 0ffa FEFFF6FB 		.ascii	"\376\377\366\373\376\377\366\373\376\377"
+ 296      FEFFF6FB 
+ 296      FEFF
+ 297              		.globl	heatmap_cs_Blues_mixed
+ 298              		.section	.data.rel.local
+ 299              		.align 8
+ 300              		.type	heatmap_cs_Blues_mixed, @object
+ 301              		.size	heatmap_cs_Blues_mixed, 8
+ 302              	heatmap_cs_Blues_mixed:
+ 303 0008 00000000 		.quad	mixed
+ 303      00000000 
+ 304              		.section	.data.rel.ro.local
+ 305              		.align 16
+ 306              		.type	mixed, @object
+ 307              		.size	mixed, 16
+ 308              	mixed:
+ 309 0010 00000000 		.quad	mixed_data
+ 309      00000000 
+ 310 0018 01040000 		.quad	1025
+ 310      00000000 
+ 311              		.section	.rodata
+ 312 1004 00000000 		.align 32
+ 312      00000000 
+ 312      00000000 
+ 312      00000000 
+ 312      00000000 
+ 313              		.type	mixed_data, @object
+GAS LISTING /tmp/ccK8DYMt.s 			page 21
+
+
+ 314              		.size	mixed_data, 4100
+ 315              	mixed_data:
+ 316 1020 00       		.string	""
+ 317 1021 00       		.string	""
+ 318 1022 00       		.string	""
+ 319 1023 00       		.string	""
+ 320 1024 082F6B00 		.string	"\b/k"
+ 321 1028 08306B07 		.ascii	"\b0k\007\b0k\016\b0k\026\b0l\035\b0l%\b1l,\b1m4\b1m;\b1mC\b1"
+ 321      08306B0E 
+ 321      08306B16 
+ 321      08306C1D 
+ 321      08306C25 
+ 322 104e 6D4A0832 		.ascii	"mJ\b2nR\b2nY\b2na\b2oh\b2op\b3ow\b3p\177\b3p\206\b3p\215\b3p"
+ 322      6E520832 
+ 322      6E590832 
+ 322      6E610832 
+ 322      6F680832 
+ 323 1077 95083471 		.ascii	"\225\b4q\234\b4q\244\t4q\253\t4r\263\t4r\272\t5r\302\t5s\311"
+ 323      9C083471 
+ 323      A4093471 
+ 323      AB093472 
+ 323      B3093472 
+ 324 1094 093573D1 		.ascii	"\t5s\321\t5s\330\t5s\340\t6t\347\t6t\357\t6t\366\t6u\376\t6u"
+ 324      093573D8 
+ 324      093573E0 
+ 324      093674E7 
+ 324      093674EF 
+ 325 10b3 FF093775 		.ascii	"\377\t7u\377\t7v\377\t7v\377\t7v\377\t7v\377\t8w\377\t8w\377"
+ 325      FF093776 
+ 325      FF093776 
+ 325      FF093776 
+ 325      FF093776 
+ 326 10d0 093877FF 		.ascii	"\t8w\377\t8x\377\t8x\377\t9x\377\t9y\377\t9y\377\t9y\377\t9z"
+ 326      093878FF 
+ 326      093878FF 
+ 326      093978FF 
+ 326      093979FF 
+ 327 10ef FF093A7A 		.ascii	"\377\t:z\377\t:z\377\t:z\377\t:{\377\t;{\377\t;{\377\t;|\377"
+ 327      FF093A7A 
+ 327      FF093A7A 
+ 327      FF093A7B 
+ 327      FF093B7B 
+ 328 110c 093B7CFF 		.ascii	"\t;|\377\t;|\377\t<}\377\t<}\377\t<}\377\t<}\377\nC\210\377\n"
+ 328      093B7CFF 
+ 328      093C7DFF 
+ 328      093C7DFF 
+ 328      093C7DFF 
+ 329 1129 4388FF0A 		.ascii	"C\210\377\nC\210\377\nD\210\377\nD\211\377\nD\211\377\nD\211"
+ 329      4388FF0A 
+ 329      4488FF0A 
+ 329      4489FF0A 
+ 329      4489FF0A 
+ 330 113f FF0A448A 		.ascii	"\377\nD\212\377\nE\212\377\nE\212\377\nE\213\377\nE\213\377\n"
+ 330      FF0A458A 
+ 330      FF0A458A 
+ 330      FF0A458B 
+ 330      FF0A458B 
+GAS LISTING /tmp/ccK8DYMt.s 			page 22
+
+
+ 331 1155 458BFF0A 		.ascii	"E\213\377\nF\214\377\nF\214\377\tF\214\377\tF\215\377\tF\215"
+ 331      468CFF0A 
+ 331      468CFF09 
+ 331      468CFF09 
+ 331      468DFF09 
+ 332 116b FF09478D 		.ascii	"\377\tG\215\377\tG\215\377\tG\216\377\tG\216\377\tH\216\377\t"
+ 332      FF09478D 
+ 332      FF09478E 
+ 332      FF09478E 
+ 332      FF09488E 
+ 333 1181 488FFF09 		.ascii	"H\217\377\tH\217\377\tH\217\377\tH\220\377\tI\220\377\tI\220"
+ 333      488FFF09 
+ 333      488FFF09 
+ 333      4890FF09 
+ 333      4990FF09 
+ 334 1197 FF094991 		.ascii	"\377\tI\221\377\tI\221\377\tI\221\377\tJ\221\377\tJ\222\377\t"
+ 334      FF094991 
+ 334      FF094991 
+ 334      FF094A91 
+ 334      FF094A92 
+ 335 11ad 4A92FF09 		.ascii	"J\222\377\tJ\222\377\tJ\223\377\tK\223\377\tK\223\377\tK\224"
+ 335      4A92FF09 
+ 335      4A93FF09 
+ 335      4B93FF09 
+ 335      4B93FF09 
+ 336 11c3 FF094B94 		.ascii	"\377\tK\224\377\tL\224\377\tL\225\377\tL\225\377\tL\225\377\t"
+ 336      FF094C94 
+ 336      FF094C95 
+ 336      FF094C95 
+ 336      FF094C95 
+ 337 11d9 4C96FF09 		.ascii	"L\226\377\tM\226\377\tM\226\377\tM\226\377\bM\227\377\bM\227"
+ 337      4D96FF09 
+ 337      4D96FF09 
+ 337      4D96FF08 
+ 337      4D97FF08 
+ 338 11ef FF084E97 		.ascii	"\377\bN\227\377\bN\230\377\bN\230\377\bN\230\377\bO\231\377\b"
+ 338      FF084E98 
+ 338      FF084E98 
+ 338      FF084E98 
+ 338      FF084F99 
+ 339 1205 4F99FF08 		.ascii	"O\231\377\bO\231\377\bO\232\377\bO\232\377\bP\232\377\bP\233"
+ 339      4F99FF08 
+ 339      4F9AFF08 
+ 339      4F9AFF08 
+ 339      509AFF08 
+ 340 121b FF08509B 		.ascii	"\377\bP\233\377\bP\233\377\bP\234\377\bQ\234\377\bQ\234\377\b"
+ 340      FF08509B 
+ 340      FF08509C 
+ 340      FF08519C 
+ 340      FF08519C 
+ 341 1231 519CFF08 		.ascii	"Q\234\377\bQ\234\377\bQ\234\377\bR\234\377\bR\235\377\bR\235"
+ 341      519CFF08 
+ 341      519CFF08 
+ 341      529CFF08 
+ 341      529DFF08 
+ 342 1247 FF09529D 		.ascii	"\377\tR\235\377\tR\235\377\tS\235\377\tS\235\377\tS\236\377\t"
+ 342      FF09529D 
+GAS LISTING /tmp/ccK8DYMt.s 			page 23
+
+
+ 342      FF09539D 
+ 342      FF09539D 
+ 342      FF09539E 
+ 343 125d 539EFF09 		.ascii	"S\236\377\tS\236\377\tT\236\377\nT\236\377\nT\236\377\nT\237"
+ 343      539EFF09 
+ 343      549EFF0A 
+ 343      549EFF0A 
+ 343      549EFF0A 
+ 344 1273 FF0A549F 		.ascii	"\377\nT\237\377\nU\237\377\nU\237\377\nU\237\377\013U\237\377"
+ 344      FF0A559F 
+ 344      FF0A559F 
+ 344      FF0A559F 
+ 344      FF0B559F 
+ 345 1288 0B55A0FF 		.ascii	"\013U\240\377\013V\240\377\013V\240\377\013V\240\377\013V\240"
+ 345      0B56A0FF 
+ 345      0B56A0FF 
+ 345      0B56A0FF 
+ 345      0B56A0
+ 346 129b FF0B56A0 		.ascii	"\377\013V\240\377\fW\241\377\fW\241\377\fW\241\377\fW\241\377"
+ 346      FF0C57A1 
+ 346      FF0C57A1 
+ 346      FF0C57A1 
+ 346      FF0C57A1 
+ 347 12b0 0C57A1FF 		.ascii	"\fW\241\377\fX\241\377\rX\241\377\rX\242\377\rX\242\377\rX\242"
+ 347      0C58A1FF 
+ 347      0D58A1FF 
+ 347      0D58A2FF 
+ 347      0D58A2FF 
+ 348 12c7 FF0D59A2 		.ascii	"\377\rY\242\377\rY\242\377\rY\242\377\016Y\243\377\016Y\243\377"
+ 348      FF0D59A2 
+ 348      FF0D59A2 
+ 348      FF0E59A3 
+ 348      FF0E59A3 
+ 349 12dc 0E5AA3FF 		.ascii	"\016Z\243\377\016Z\243\377\016Z\243\377\016Z\243\377\016Z\244"
+ 349      0E5AA3FF 
+ 349      0E5AA3FF 
+ 349      0E5AA3FF 
+ 349      0E5AA4
+ 350 12ef FF0F5BA4 		.ascii	"\377\017[\244\377\017[\244\377\017[\244\377\017[\244\377\017"
+ 350      FF0F5BA4 
+ 350      FF0F5BA4 
+ 350      FF0F5BA4 
+ 350      FF0F
+ 351 1301 5BA4FF0F 		.ascii	"[\244\377\017\\\244\377\020\\\245\377\020\\\245\377\020\\\245"
+ 351      5CA4FF10 
+ 351      5CA5FF10 
+ 351      5CA5FF10 
+ 351      5CA5
+ 352 1313 FF105CA5 		.ascii	"\377\020\\\245\377\020]\245\377\020]\245\377\021]\246\377\026"
+ 352      FF105DA5 
+ 352      FF105DA5 
+ 352      FF115DA6 
+ 352      FF16
+ 353 1325 64ABFF16 		.ascii	"d\253\377\026d\253\377\026d\253\377\026d\253\377\026d\253\377"
+ 353      64ABFF16 
+ 353      64ABFF16 
+ 353      64ABFF16 
+GAS LISTING /tmp/ccK8DYMt.s 			page 24
+
+
+ 353      64ABFF
+ 354 1338 1665ACFF 		.ascii	"\026e\254\377\027e\254\377\027e\254\377\027e\254\377\027e\254"
+ 354      1765ACFF 
+ 354      1765ACFF 
+ 354      1765ACFF 
+ 354      1765AC
+ 355 134b FF1766AC 		.ascii	"\377\027f\254\377\027f\254\377\030f\255\377\030f\255\377\030"
+ 355      FF1766AC 
+ 355      FF1866AD 
+ 355      FF1866AD 
+ 355      FF18
+ 356 135d 66ADFF18 		.ascii	"f\255\377\030g\255\377\030g\255\377\030g\255\377\031g\256\377"
+ 356      67ADFF18 
+ 356      67ADFF18 
+ 356      67ADFF19 
+ 356      67AEFF
+ 357 1370 1967AEFF 		.ascii	"\031g\256\377\031h\256\377\031h\256\377\031h\256\377\031h\256"
+ 357      1968AEFF 
+ 357      1968AEFF 
+ 357      1968AEFF 
+ 357      1968AE
+ 358 1383 FF1A68AE 		.ascii	"\377\032h\256\377\032i\257\377\032i\257\377\032i\257\377\032"
+ 358      FF1A69AF 
+ 358      FF1A69AF 
+ 358      FF1A69AF 
+ 358      FF1A
+ 359 1395 69AFFF1A 		.ascii	"i\257\377\032i\257\377\033j\257\377\033j\260\377\033j\260\377"
+ 359      69AFFF1B 
+ 359      6AAFFF1B 
+ 359      6AB0FF1B 
+ 359      6AB0FF
+ 360 13a8 1B6AB0FF 		.ascii	"\033j\260\377\033j\260\377\033k\260\377\034k\260\377\034k\260"
+ 360      1B6AB0FF 
+ 360      1B6BB0FF 
+ 360      1C6BB0FF 
+ 360      1C6BB0
+ 361 13bb FF1C6BB1 		.ascii	"\377\034k\261\377\034k\261\377\034l\261\377\034l\261\377\035"
+ 361      FF1C6BB1 
+ 361      FF1C6CB1 
+ 361      FF1C6CB1 
+ 361      FF1D
+ 362 13cd 6CB1FF1D 		.ascii	"l\261\377\035l\261\377\035l\261\377\035m\262\377\035m\262\377"
+ 362      6CB1FF1D 
+ 362      6CB1FF1D 
+ 362      6DB2FF1D 
+ 362      6DB2FF
+ 363 13e0 1E6DB2FF 		.ascii	"\036m\262\377\036m\262\377\036m\262\377\036n\262\377\036n\263"
+ 363      1E6DB2FF 
+ 363      1E6DB2FF 
+ 363      1E6EB2FF 
+ 363      1E6EB3
+ 364 13f3 FF1E6EB3 		.ascii	"\377\036n\263\377\037n\263\377\037n\263\377\037o\263\377\037"
+ 364      FF1F6EB3 
+ 364      FF1F6EB3 
+ 364      FF1F6FB3 
+ 364      FF1F
+ 365 1405 6FB3FF1F 		.ascii	"o\263\377\037o\263\377\037o\264\377 o\264\377 p\264\377 p\264"
+GAS LISTING /tmp/ccK8DYMt.s 			page 25
+
+
+ 365      6FB3FF1F 
+ 365      6FB4FF20 
+ 365      6FB4FF20 
+ 365      70B4FF20 
+ 366 141b FF2070B4 		.ascii	"\377 p\264\377 p\264\377!q\265\377!q\265\377!q\265\377!q\265"
+ 366      FF2070B4 
+ 366      FF2171B5 
+ 366      FF2171B5 
+ 366      FF2171B5 
+ 367 1433 FF2171B5 		.ascii	"\377!q\265\377!r\265\377!r\265\377\"r\265\377\"r\265\377\"r\266"
+ 367      FF2172B5 
+ 367      FF2172B5 
+ 367      FF2272B5 
+ 367      FF2272B5 
+ 368 144b FF2273B6 		.ascii	"\377\"s\266\377\"s\266\377\"s\266\377#s\266\377#s\266\377#t\266"
+ 368      FF2273B6 
+ 368      FF2273B6 
+ 368      FF2373B6 
+ 368      FF2373B6 
+ 369 1463 FF2374B6 		.ascii	"\377#t\266\377#t\266\377#t\267\377$t\267\377$u\267\377$u\267"
+ 369      FF2374B6 
+ 369      FF2374B7 
+ 369      FF2474B7 
+ 369      FF2475B7 
+ 370 147b FF2475B7 		.ascii	"\377$u\267\377$u\267\377$u\267\377%v\267\377%v\270\377%v\270"
+ 370      FF2475B7 
+ 370      FF2475B7 
+ 370      FF2576B7 
+ 370      FF2576B8 
+ 371 1493 FF2576B8 		.ascii	"\377%v\270\377%w\270\377&w\270\377&w\270\377&w\270\377&w\270"
+ 371      FF2577B8 
+ 371      FF2677B8 
+ 371      FF2677B8 
+ 371      FF2677B8 
+ 372 14ab FF2678B8 		.ascii	"\377&x\270\377&x\271\377'x\271\377'x\271\377'x\271\377'y\271"
+ 372      FF2678B9 
+ 372      FF2778B9 
+ 372      FF2778B9 
+ 372      FF2778B9 
+ 373 14c3 FF2779B9 		.ascii	"\377'y\271\377(y\271\377(y\271\377(y\271\377(z\272\377(z\272"
+ 373      FF2879B9 
+ 373      FF2879B9 
+ 373      FF2879B9 
+ 373      FF287ABA 
+ 374 14db FF297ABA 		.ascii	"\377)z\272\377)z\272\377)z\272\377){\272\377){\272\377*{\272"
+ 374      FF297ABA 
+ 374      FF297ABA 
+ 374      FF297BBA 
+ 374      FF297BBA 
+ 375 14f3 FF2A7BBA 		.ascii	"\377*{\272\377*|\272\377*|\273\377*|\273\377+|\273\377+|\273"
+ 375      FF2A7CBA 
+ 375      FF2A7CBB 
+ 375      FF2A7CBB 
+ 375      FF2B7CBB 
+ 376 150b FF2B7DBB 		.ascii	"\377+}\273\377+}\273\377+}\273\377,}\273\377,}\273\377,~\274"
+ 376      FF2B7DBB 
+ 376      FF2B7DBB 
+GAS LISTING /tmp/ccK8DYMt.s 			page 26
+
+
+ 376      FF2C7DBB 
+ 376      FF2C7DBB 
+ 377 1523 FF3384BF 		.ascii	"\3773\204\277\3773\205\277\3773\205\277\3773\205\277\3774\205"
+ 377      FF3385BF 
+ 377      FF3385BF 
+ 377      FF3385BF 
+ 377      FF3485
+ 378 1536 BFFF3485 		.ascii	"\277\3774\205\300\3774\206\300\3774\206\300\3775\206\300\377"
+ 378      C0FF3486 
+ 378      C0FF3486 
+ 378      C0FF3586 
+ 378      C0FF
+ 379 1548 3586C0FF 		.ascii	"5\206\300\3775\206\300\3775\207\300\3775\207\300\3776\207\300"
+ 379      3586C0FF 
+ 379      3587C0FF 
+ 379      3587C0FF 
+ 379      3687C0
+ 380 155b FF3687C1 		.ascii	"\3776\207\301\3776\207\301\3776\210\301\3777\210\301\3777\210"
+ 380      FF3687C1 
+ 380      FF3688C1 
+ 380      FF3788C1 
+ 380      FF3788
+ 381 156e C1FF3788 		.ascii	"\301\3777\210\301\3777\210\301\3777\211\301\3778\211\301\377"
+ 381      C1FF3788 
+ 381      C1FF3789 
+ 381      C1FF3889 
+ 381      C1FF
+ 382 1580 3889C1FF 		.ascii	"8\211\301\3778\211\302\3778\212\302\3779\212\302\3779\212\302"
+ 382      3889C2FF 
+ 382      388AC2FF 
+ 382      398AC2FF 
+ 382      398AC2
+ 383 1593 FF398AC2 		.ascii	"\3779\212\302\3779\212\302\3779\213\302\377:\213\302\377:\213"
+ 383      FF398AC2 
+ 383      FF398BC2 
+ 383      FF3A8BC2 
+ 383      FF3A8B
+ 384 15a6 C2FF3A8B 		.ascii	"\302\377:\213\302\377:\213\303\377;\214\303\377;\214\303\377"
+ 384      C2FF3A8B 
+ 384      C3FF3B8C 
+ 384      C3FF3B8C 
+ 384      C3FF
+ 385 15b8 3B8CC3FF 		.ascii	";\214\303\377;\214\303\377<\214\303\377<\215\303\377<\215\303"
+ 385      3B8CC3FF 
+ 385      3C8CC3FF 
+ 385      3C8DC3FF 
+ 385      3C8DC3
+ 386 15cb FF3C8DC3 		.ascii	"\377<\215\303\377<\215\303\377=\215\304\377=\216\304\377=\216"
+ 386      FF3C8DC3 
+ 386      FF3D8DC4 
+ 386      FF3D8EC4 
+ 386      FF3D8E
+ 387 15de C4FF3D8E 		.ascii	"\304\377=\216\304\377>\216\304\377>\216\304\377>\217\304\377"
+ 387      C4FF3E8E 
+ 387      C4FF3E8E 
+ 387      C4FF3E8F 
+ 387      C4FF
+GAS LISTING /tmp/ccK8DYMt.s 			page 27
+
+
+ 388 15f0 3E8FC4FF 		.ascii	">\217\304\377?\217\304\377?\217\304\377?\217\305\377?\220\305"
+ 388      3F8FC4FF 
+ 388      3F8FC4FF 
+ 388      3F8FC5FF 
+ 388      3F90C5
+ 389 1603 FF4090C5 		.ascii	"\377@\220\305\377@\220\305\377@\220\305\377@\220\305\377A\221"
+ 389      FF4090C5 
+ 389      FF4090C5 
+ 389      FF4090C5 
+ 389      FF4191
+ 390 1616 C5FF4191 		.ascii	"\305\377A\221\305\377A\221\305\377A\221\305\377B\222\306\377"
+ 390      C5FF4191 
+ 390      C5FF4191 
+ 390      C5FF4292 
+ 390      C6FF
+ 391 1628 4292C6FF 		.ascii	"B\222\306\377B\222\306\377B\222\306\377C\222\306\377C\222\306"
+ 391      4292C6FF 
+ 391      4292C6FF 
+ 391      4392C6FF 
+ 391      4392C6
+ 392 163b FF4393C6 		.ascii	"\377C\223\306\377C\223\306\377D\223\306\377D\223\306\377D\223"
+ 392      FF4393C6 
+ 392      FF4493C6 
+ 392      FF4493C6 
+ 392      FF4493
+ 393 164e C7FF4493 		.ascii	"\307\377D\223\307\377E\224\307\377E\224\307\377E\224\307\377"
+ 393      C7FF4594 
+ 393      C7FF4594 
+ 393      C7FF4594 
+ 393      C7FF
+ 394 1660 4694C7FF 		.ascii	"F\224\307\377F\224\307\377F\224\307\377F\225\307\377G\225\307"
+ 394      4694C7FF 
+ 394      4694C7FF 
+ 394      4695C7FF 
+ 394      4795C7
+ 395 1673 FF4795C8 		.ascii	"\377G\225\310\377G\225\310\377G\225\310\377H\226\310\377H\226"
+ 395      FF4795C8 
+ 395      FF4795C8 
+ 395      FF4896C8 
+ 395      FF4896
+ 396 1686 C8FF4896 		.ascii	"\310\377H\226\310\377H\226\310\377I\226\310\377I\226\310\377"
+ 396      C8FF4896 
+ 396      C8FF4996 
+ 396      C8FF4996 
+ 396      C8FF
+ 397 1698 4997C8FF 		.ascii	"I\227\310\377I\227\311\377J\227\311\377J\227\311\377J\227\311"
+ 397      4997C9FF 
+ 397      4A97C9FF 
+ 397      4A97C9FF 
+ 397      4A97C9
+ 398 16ab FF4B97C9 		.ascii	"\377K\227\311\377K\230\311\377K\230\311\377K\230\311\377L\230"
+ 398      FF4B98C9 
+ 398      FF4B98C9 
+ 398      FF4B98C9 
+ 398      FF4C98
+ 399 16be C9FF4C98 		.ascii	"\311\377L\230\311\377L\230\312\377L\231\312\377M\231\312\377"
+ 399      C9FF4C98 
+GAS LISTING /tmp/ccK8DYMt.s 			page 28
+
+
+ 399      CAFF4C99 
+ 399      CAFF4D99 
+ 399      CAFF
+ 400 16d0 4D99CAFF 		.ascii	"M\231\312\377M\231\312\377M\231\312\377N\232\312\377N\232\312"
+ 400      4D99CAFF 
+ 400      4D99CAFF 
+ 400      4E9ACAFF 
+ 400      4E9ACA
+ 401 16e3 FF4E9ACA 		.ascii	"\377N\232\312\377N\232\312\377O\232\313\377O\232\313\377O\233"
+ 401      FF4E9ACA 
+ 401      FF4F9ACB 
+ 401      FF4F9ACB 
+ 401      FF4F9B
+ 402 16f6 CBFF4F9B 		.ascii	"\313\377O\233\313\377P\233\313\377P\233\313\377P\233\313\377"
+ 402      CBFF509B 
+ 402      CBFF509B 
+ 402      CBFF509B 
+ 402      CBFF
+ 403 1708 509BCBFF 		.ascii	"P\233\313\377Q\234\313\377Q\234\313\377Q\234\314\377Q\234\314"
+ 403      519CCBFF 
+ 403      519CCBFF 
+ 403      519CCCFF 
+ 403      519CCC
+ 404 171b FF529CCC 		.ascii	"\377R\234\314\377R\235\314\377Z\242\317\377[\242\317\377[\243"
+ 404      FF529DCC 
+ 404      FF5AA2CF 
+ 404      FF5BA2CF 
+ 404      FF5BA3
+ 405 172e CFFF5BA3 		.ascii	"\317\377[\243\317\377[\243\320\377\\\243\320\377\\\243\320\377"
+ 405      CFFF5BA3 
+ 405      D0FF5CA3 
+ 405      D0FF5CA3 
+ 405      D0FF
+ 406 1740 5CA4D0FF 		.ascii	"\\\244\320\377\\\244\320\377]\244\320\377]\244\320\377]\244\320"
+ 406      5CA4D0FF 
+ 406      5DA4D0FF 
+ 406      5DA4D0FF 
+ 406      5DA4D0
+ 407 1753 FF5DA4D0 		.ascii	"\377]\244\320\377^\245\320\377^\245\321\377^\245\321\377^\245"
+ 407      FF5EA5D0 
+ 407      FF5EA5D1 
+ 407      FF5EA5D1 
+ 407      FF5EA5
+ 408 1766 D1FF5FA5 		.ascii	"\321\377_\245\321\377_\245\321\377_\246\321\377_\246\321\377"
+ 408      D1FF5FA5 
+ 408      D1FF5FA6 
+ 408      D1FF5FA6 
+ 408      D1FF
+ 409 1778 60A6D1FF 		.ascii	"`\246\321\377`\246\321\377`\246\321\377`\246\322\377a\247\322"
+ 409      60A6D1FF 
+ 409      60A6D1FF 
+ 409      60A6D2FF 
+ 409      61A7D2
+ 410 178b FF61A7D2 		.ascii	"\377a\247\322\377a\247\322\377a\247\322\377b\247\322\377b\250"
+ 410      FF61A7D2 
+ 410      FF61A7D2 
+ 410      FF62A7D2 
+GAS LISTING /tmp/ccK8DYMt.s 			page 29
+
+
+ 410      FF62A8
+ 411 179e D2FF62A8 		.ascii	"\322\377b\250\322\377c\250\322\377c\250\322\377c\250\323\377"
+ 411      D2FF63A8 
+ 411      D2FF63A8 
+ 411      D2FF63A8 
+ 411      D3FF
+ 412 17b0 63A8D3FF 		.ascii	"c\250\323\377d\251\323\377d\251\323\377d\251\323\377d\251\323"
+ 412      64A9D3FF 
+ 412      64A9D3FF 
+ 412      64A9D3FF 
+ 412      64A9D3
+ 413 17c3 FF65A9D3 		.ascii	"\377e\251\323\377e\251\323\377e\252\323\377e\252\323\377f\252"
+ 413      FF65A9D3 
+ 413      FF65AAD3 
+ 413      FF65AAD3 
+ 413      FF66AA
+ 414 17d6 D4FF66AA 		.ascii	"\324\377f\252\324\377f\252\324\377f\253\324\377g\253\324\377"
+ 414      D4FF66AA 
+ 414      D4FF66AB 
+ 414      D4FF67AB 
+ 414      D4FF
+ 415 17e8 67ABD4FF 		.ascii	"g\253\324\377g\253\324\377"
+ 415      67ABD4FF 
+ 416 17f0 67ABD4FF 		.ascii	"g\253\324\377h\253\324\377h\254\324\377h\254\324\377h\254\325"
+ 416      68ABD4FF 
+ 416      68ACD4FF 
+ 416      68ACD4FF 
+ 416      68ACD5
+ 417 1803 FF69ACD5 		.ascii	"\377i\254\325\377i\254\325\377i\254\325\377i\255\325\377j\255"
+ 417      FF69ACD5 
+ 417      FF69ACD5 
+ 417      FF69ADD5 
+ 417      FF6AAD
+ 418 1816 D5FF6AAD 		.ascii	"\325\377j\255\325\377j\255\325\377j\255\325\377k\256\326\377"
+ 418      D5FF6AAD 
+ 418      D5FF6AAD 
+ 418      D5FF6BAE 
+ 418      D6FF
+ 419 1828 6BAED6FF 		.ascii	"k\256\326\377k\256\326\377k\256\326\377l\256\326\377l\256\326"
+ 419      6BAED6FF 
+ 419      6BAED6FF 
+ 419      6CAED6FF 
+ 419      6CAED6
+ 420 183b FF6CAFD6 		.ascii	"\377l\257\326\377m\257\326\377m\257\326\377m\257\326\377n\257"
+ 420      FF6DAFD6 
+ 420      FF6DAFD6 
+ 420      FF6DAFD6 
+ 420      FF6EAF
+ 421 184e D6FF6EAF 		.ascii	"\326\377n\257\326\377n\260\326\377o\260\326\377o\260\326\377"
+ 421      D6FF6EB0 
+ 421      D6FF6FB0 
+ 421      D6FF6FB0 
+ 421      D6FF
+ 422 1860 6FB0D6FF 		.ascii	"o\260\326\377p\260\327\377p\261\327\377p\261\327\377q\261\327"
+ 422      70B0D7FF 
+ 422      70B1D7FF 
+ 422      70B1D7FF 
+GAS LISTING /tmp/ccK8DYMt.s 			page 30
+
+
+ 422      71B1D7
+ 423 1873 FF71B1D7 		.ascii	"\377q\261\327\377q\261\327\377r\261\327\377r\262\327\377r\262"
+ 423      FF71B1D7 
+ 423      FF72B1D7 
+ 423      FF72B2D7 
+ 423      FF72B2
+ 424 1886 D7FF73B2 		.ascii	"\327\377s\262\327\377s\262\327\377s\262\327\377t\262\327\377"
+ 424      D7FF73B2 
+ 424      D7FF73B2 
+ 424      D7FF74B2 
+ 424      D7FF
+ 425 1898 74B3D7FF 		.ascii	"t\263\327\377t\263\327\377u\263\330\377u\263\330\377u\263\330"
+ 425      74B3D7FF 
+ 425      75B3D8FF 
+ 425      75B3D8FF 
+ 425      75B3D8
+ 426 18ab FF76B3D8 		.ascii	"\377v\263\330\377v\264\330\377v\264\330\377w\264\330\377w\264"
+ 426      FF76B4D8 
+ 426      FF76B4D8 
+ 426      FF77B4D8 
+ 426      FF77B4
+ 427 18be D8FF77B4 		.ascii	"\330\377w\264\330\377w\265\330\377x\265\330\377x\265\330\377"
+ 427      D8FF77B5 
+ 427      D8FF78B5 
+ 427      D8FF78B5 
+ 427      D8FF
+ 428 18d0 78B5D8FF 		.ascii	"x\265\330\377y\265\330\377y\265\330\377y\266\331\377z\266\331"
+ 428      79B5D8FF 
+ 428      79B5D8FF 
+ 428      79B6D9FF 
+ 428      7AB6D9
+ 429 18e3 FF7AB6D9 		.ascii	"\377z\266\331\377z\266\331\377{\266\331\377{\266\331\377{\267"
+ 429      FF7AB6D9 
+ 429      FF7BB6D9 
+ 429      FF7BB6D9 
+ 429      FF7BB7
+ 430 18f6 D9FF7CB7 		.ascii	"\331\377|\267\331\377|\267\331\377|\267\331\377}\267\331\377"
+ 430      D9FF7CB7 
+ 430      D9FF7CB7 
+ 430      D9FF7DB7 
+ 430      D9FF
+ 431 1908 7DB8D9FF 		.ascii	"}\270\331\377}\270\331\377~\270\331\377~\270\331\377~\270\332"
+ 431      7DB8D9FF 
+ 431      7EB8D9FF 
+ 431      7EB8D9FF 
+ 431      7EB8DA
+ 432 191b FF7EB8DA 		.ascii	"\377~\270\332\377\177\271\332\377\211\276\334\377\212\277\334"
+ 432      FF7FB9DA 
+ 432      FF89BEDC 
+ 432      FF8ABFDC 
+ 433 192b FF8ABFDC 		.ascii	"\377\212\277\334\377\212\277\334\377\213\277\334\377\213\277"
+ 433      FF8ABFDC 
+ 433      FF8BBFDC 
+ 433      FF8BBF
+ 434 193a DCFF8BBF 		.ascii	"\334\377\213\277\334\377\214\300\334\377\214\300\335\377\214"
+ 434      DCFF8CC0 
+ 434      DCFF8CC0 
+GAS LISTING /tmp/ccK8DYMt.s 			page 31
+
+
+ 434      DDFF8C
+ 435 1949 C0DDFF8C 		.ascii	"\300\335\377\214\300\335\377\215\300\335\377\215\300\335\377"
+ 435      C0DDFF8D 
+ 435      C0DDFF8D 
+ 435      C0DDFF
+ 436 1958 8DC1DDFF 		.ascii	"\215\301\335\377\216\301\335\377\216\301\335\377\216\301\335"
+ 436      8EC1DDFF 
+ 436      8EC1DDFF 
+ 436      8EC1DD
+ 437 1967 FF8FC1DD 		.ascii	"\377\217\301\335\377\217\302\335\377\217\302\335\377\220\302"
+ 437      FF8FC2DD 
+ 437      FF8FC2DD 
+ 437      FF90C2
+ 438 1976 DDFF90C2 		.ascii	"\335\377\220\302\335\377\220\302\335\377\221\302\336\377\221"
+ 438      DDFF90C2 
+ 438      DDFF91C2 
+ 438      DEFF91
+ 439 1985 C3DEFF91 		.ascii	"\303\336\377\221\303\336\377\222\303\336\377\222\303\336\377"
+ 439      C3DEFF92 
+ 439      C3DEFF92 
+ 439      C3DEFF
+ 440 1994 92C3DEFF 		.ascii	"\222\303\336\377\222\303\336\377\223\304\336\377\223\304\336"
+ 440      92C3DEFF 
+ 440      93C4DEFF 
+ 440      93C4DE
+ 441 19a3 FF93C4DE 		.ascii	"\377\223\304\336\377\224\304\336\377\224\304\336\377\224\304"
+ 441      FF94C4DE 
+ 441      FF94C4DE 
+ 441      FF94C4
+ 442 19b2 DEFF95C5 		.ascii	"\336\377\225\305\336\377\225\305\337\377\225\305\337\377\226"
+ 442      DEFF95C5 
+ 442      DFFF95C5 
+ 442      DFFF96
+ 443 19c1 C5DFFF96 		.ascii	"\305\337\377\226\305\337\377\226\306\337\377\227\306\337\377"
+ 443      C5DFFF96 
+ 443      C6DFFF97 
+ 443      C6DFFF
+ 444 19d0 97C6DFFF 		.ascii	"\227\306\337\377\227\306\337\377\230\306\337\377\230\306\337"
+ 444      97C6DFFF 
+ 444      98C6DFFF 
+ 444      98C6DF
+ 445 19df FF98C7DF 		.ascii	"\377\230\307\337\377\230\307\337\377\231\307\337\377\231\307"
+ 445      FF98C7DF 
+ 445      FF99C7DF 
+ 445      FF99C7
+ 446 19ee DFFF99C7 		.ascii	"\337\377\231\307\340\377\232\307\340\377\232\310\340\377\232"
+ 446      E0FF9AC7 
+ 446      E0FF9AC8 
+ 446      E0FF9A
+ 447 19fd C8E0FF9B 		.ascii	"\310\340\377\233\310\340\377\233\310\340\377\233\310\340\377"
+ 447      C8E0FF9B 
+ 447      C8E0FF9B 
+ 447      C8E0FF
+ 448 1a0c 9CC8E0FF 		.ascii	"\234\310\340\377\234\311\340\377\234\311\340\377\235\311\340"
+ 448      9CC9E0FF 
+ 448      9CC9E0FF 
+ 448      9DC9E0
+GAS LISTING /tmp/ccK8DYMt.s 			page 32
+
+
+ 449 1a1b FF9DC9E0 		.ascii	"\377\235\311\340\377\235\311\340\377\235\312\340\377\236\312"
+ 449      FF9DC9E0 
+ 449      FF9DCAE0 
+ 449      FF9ECA
+ 450 1a2a E1FF9ECA 		.ascii	"\341\377\236\312\341\377\236\312\341\377\237\312\341\377\237"
+ 450      E1FF9ECA 
+ 450      E1FF9FCA 
+ 450      E1FF9F
+ 451 1a39 CAE1FF9F 		.ascii	"\312\341\377\237\312\341\377\237\312\341\377\240\312\341\377"
+ 451      CAE1FF9F 
+ 451      CAE1FFA0 
+ 451      CAE1FF
+ 452 1a48 A0CAE1FF 		.ascii	"\240\312\341\377\240\313\342\377\240\313\342\377\241\313\342"
+ 452      A0CBE2FF 
+ 452      A0CBE2FF 
+ 452      A1CBE2
+ 453 1a57 FFA1CBE2 		.ascii	"\377\241\313\342\377\241\313\342\377\241\313\342\377\242\313"
+ 453      FFA1CBE2 
+ 453      FFA1CBE2 
+ 453      FFA2CB
+ 454 1a66 E2FFA2CB 		.ascii	"\342\377\242\313\342\377\242\313\342\377\243\313\342\377\243"
+ 454      E2FFA2CB 
+ 454      E2FFA3CB 
+ 454      E2FFA3
+ 455 1a75 CCE2FFA3 		.ascii	"\314\342\377\243\314\343\377\243\314\343\377\244\314\343\377"
+ 455      CCE3FFA3 
+ 455      CCE3FFA4 
+ 455      CCE3FF
+ 456 1a84 A4CCE3FF 		.ascii	"\244\314\343\377\244\314\343\377\244\314\343\377\245\314\343"
+ 456      A4CCE3FF 
+ 456      A4CCE3FF 
+ 456      A5CCE3
+ 457 1a93 FFA5CCE3 		.ascii	"\377\245\314\343\377\245\314\343\377\245\315\343\377\246\315"
+ 457      FFA5CCE3 
+ 457      FFA5CDE3 
+ 457      FFA6CD
+ 458 1aa2 E4FFA6CD 		.ascii	"\344\377\246\315\344\377\246\315\344\377\246\315\344\377\247"
+ 458      E4FFA6CD 
+ 458      E4FFA6CD 
+ 458      E4FFA7
+ 459 1ab1 CDE4FFA7 		.ascii	"\315\344\377\247\315\344\377\247\315\344\377\247\315\344\377"
+ 459      CDE4FFA7 
+ 459      CDE4FFA7 
+ 459      CDE4FF
+ 460 1ac0 A8CEE4FF 		.ascii	"\250\316\344\377\250\316\344\377\250\316\344\377\250\316\345"
+ 460      A8CEE4FF 
+ 460      A8CEE4FF 
+ 460      A8CEE5
+ 461 1acf FFA9CEE5 		.ascii	"\377\251\316\345\377\251\316\345\377\251\316\345\377\252\316"
+ 461      FFA9CEE5 
+ 461      FFA9CEE5 
+ 461      FFAACE
+ 462 1ade E5FFAACE 		.ascii	"\345\377\252\316\345\377\252\316\345\377\252\317\345\377\253"
+ 462      E5FFAACE 
+ 462      E5FFAACF 
+ 462      E5FFAB
+ 463 1aed CFE5FFAB 		.ascii	"\317\345\377\253\317\345\377\253\317\345\377\253\317\346\377"
+GAS LISTING /tmp/ccK8DYMt.s 			page 33
+
+
+ 463      CFE5FFAB 
+ 463      CFE5FFAB 
+ 463      CFE6FF
+ 464 1afc ACCFE6FF 		.ascii	"\254\317\346\377\254\317\346\377\254\317\346\377\254\317\346"
+ 464      ACCFE6FF 
+ 464      ACCFE6FF 
+ 464      ACCFE6
+ 465 1b0b FFADD0E6 		.ascii	"\377\255\320\346\377\255\320\346\377\255\320\346\377\255\320"
+ 465      FFADD0E6 
+ 465      FFADD0E6 
+ 465      FFADD0
+ 466 1b1a E6FFAED0 		.ascii	"\346\377\256\320\346\377\256\320\346\377\266\324\351\377\266"
+ 466      E6FFAED0 
+ 466      E6FFB6D4 
+ 466      E9FFB6
+ 467 1b29 D4E9FFB7 		.ascii	"\324\351\377\267\324\352\377\267\324\352\377\267\324\352\377"
+ 467      D4EAFFB7 
+ 467      D4EAFFB7 
+ 467      D4EAFF
+ 468 1b38 B7D4EAFF 		.ascii	"\267\324\352\377\270\324\352\377\270\324\352\377\270\324\352"
+ 468      B8D4EAFF 
+ 468      B8D4EAFF 
+ 468      B8D4EA
+ 469 1b47 FFB8D5EA 		.ascii	"\377\270\325\352\377\271\325\352\377\271\325\352\377\271\325"
+ 469      FFB9D5EA 
+ 469      FFB9D5EA 
+ 469      FFB9D5
+ 470 1b56 EAFFB9D5 		.ascii	"\352\377\271\325\352\377\272\325\353\377\272\325\353\377\272"
+ 470      EAFFBAD5 
+ 470      EBFFBAD5 
+ 470      EBFFBA
+ 471 1b65 D5EBFFBA 		.ascii	"\325\353\377\272\325\353\377\273\325\353\377\273\326\353\377"
+ 471      D5EBFFBB 
+ 471      D5EBFFBB 
+ 471      D6EBFF
+ 472 1b74 BBD6EBFF 		.ascii	"\273\326\353\377\273\326\353\377\273\326\353\377\274\326\353"
+ 472      BBD6EBFF 
+ 472      BBD6EBFF 
+ 472      BCD6EB
+ 473 1b83 FFBCD6EB 		.ascii	"\377\274\326\353\377\274\326\353\377\274\326\354\377\275\326"
+ 473      FFBCD6EB 
+ 473      FFBCD6EC 
+ 473      FFBDD6
+ 474 1b92 ECFFBDD7 		.ascii	"\354\377\275\327\354\377\275\327\354\377\275\327\354\377\276"
+ 474      ECFFBDD7 
+ 474      ECFFBDD7 
+ 474      ECFFBE
+ 475 1ba1 D7ECFFBE 		.ascii	"\327\354\377\276\327\354\377\276\327\354\377\276\327\354\377"
+ 475      D7ECFFBE 
+ 475      D7ECFFBE 
+ 475      D7ECFF
+ 476 1bb0 BFD7ECFF 		.ascii	"\277\327\354\377\277\327\354\377\277\330\354\377\277\330\354"
+ 476      BFD7ECFF 
+ 476      BFD8ECFF 
+ 476      BFD8EC
+ 477 1bbf FFC0D8ED 		.ascii	"\377\300\330\355\377\300\330\355\377\300\330\355\377\300\330"
+ 477      FFC0D8ED 
+GAS LISTING /tmp/ccK8DYMt.s 			page 34
+
+
+ 477      FFC0D8ED 
+ 477      FFC0D8
+ 478 1bce EDFFC1D8 		.ascii	"\355\377\301\330\355\377\301\330\355\377\301\330\355\377\301"
+ 478      EDFFC1D8 
+ 478      EDFFC1D8 
+ 478      EDFFC1
+ 479 1bdd D9EDFFC2 		.ascii	"\331\355\377\302\331\355\377\302\331\355\377\302\331\355\377"
+ 479      D9EDFFC2 
+ 479      D9EDFFC2 
+ 479      D9EDFF
+ 480 1bec C2D9EDFF 		.ascii	"\302\331\355\377\302\331\356\377\303\331\356\377\303\331\356"
+ 480      C2D9EEFF 
+ 480      C3D9EEFF 
+ 480      C3D9EE
+ 481 1bfb FFC3D9EE 		.ascii	"\377\303\331\356\377\303\332\356\377\304\332\356\377\304\332"
+ 481      FFC3DAEE 
+ 481      FFC4DAEE 
+ 481      FFC4DA
+ 482 1c0a EEFFC4DA 		.ascii	"\356\377\304\332\356\377\304\332\356\377\305\332\356\377\305"
+ 482      EEFFC4DA 
+ 482      EEFFC5DA 
+ 482      EEFFC5
+ 483 1c19 DAEEFFC5 		.ascii	"\332\356\377\305\332\356\377\305\332\356\377\305\333\356\377"
+ 483      DAEEFFC5 
+ 483      DAEEFFC5 
+ 483      DBEEFF
+ 484 1c28 C6DBEFFF 		.ascii	"\306\333\357\377\306\333\357\377\306\333\357\377\306\333\357"
+ 484      C6DBEFFF 
+ 484      C6DBEFFF 
+ 484      C6DBEF
+ 485 1c37 FFC6DBEF 		.ascii	"\377\306\333\357\377\306\333\357\377\307\333\357\377\307\333"
+ 485      FFC6DBEF 
+ 485      FFC7DBEF 
+ 485      FFC7DB
+ 486 1c46 EFFFC7DB 		.ascii	"\357\377\307\333\357\377\307\333\357\377\307\334\357\377\307"
+ 486      EFFFC7DB 
+ 486      EFFFC7DC 
+ 486      EFFFC7
+ 487 1c55 DCEFFFC7 		.ascii	"\334\357\377\307\334\357\377\310\334\357\377\310\334\357\377"
+ 487      DCEFFFC8 
+ 487      DCEFFFC8 
+ 487      DCEFFF
+ 488 1c64 C8DCEFFF 		.ascii	"\310\334\357\377\310\334\357\377\310\334\357\377\310\334\357"
+ 488      C8DCEFFF 
+ 488      C8DCEFFF 
+ 488      C8DCEF
+ 489 1c73 FFC8DCEF 		.ascii	"\377\310\334\357\377\311\335\360\377\311\335\360\377\311\335"
+ 489      FFC9DDF0 
+ 489      FFC9DDF0 
+ 489      FFC9DD
+ 490 1c82 F0FFC9DD 		.ascii	"\360\377\311\335\360\377\311\335\360\377\311\335\360\377\312"
+ 490      F0FFC9DD 
+ 490      F0FFC9DD 
+ 490      F0FFCA
+ 491 1c91 DDF0FFCA 		.ascii	"\335\360\377\312\335\360\377\312\335\360\377\312\335\360\377"
+ 491      DDF0FFCA 
+ 491      DDF0FFCA 
+GAS LISTING /tmp/ccK8DYMt.s 			page 35
+
+
+ 491      DDF0FF
+ 492 1ca0 CADEF0FF 		.ascii	"\312\336\360\377\312\336\360\377\312\336\360\377\313\336\360"
+ 492      CADEF0FF 
+ 492      CADEF0FF 
+ 492      CBDEF0
+ 493 1caf FFCBDEF0 		.ascii	"\377\313\336\360\377\313\336\360\377\313\336\360\377\313\336"
+ 493      FFCBDEF0 
+ 493      FFCBDEF0 
+ 493      FFCBDE
+ 494 1cbe F0FFCBDE 		.ascii	"\360\377\313\336\360\377\313\336\360\377\314\337\361\377\314"
+ 494      F0FFCBDE 
+ 494      F0FFCCDF 
+ 494      F1FFCC
+ 495 1ccd DFF1FFCC 		.ascii	"\337\361\377\314\337\361\377\314\337\361\377\314\337\361\377"
+ 495      DFF1FFCC 
+ 495      DFF1FFCC 
+ 495      DFF1FF
+ 496 1cdc CCDFF1FF 		.ascii	"\314\337\361\377\315\337\361\377\315\337\361\377\315\337\361"
+ 496      CDDFF1FF 
+ 496      CDDFF1FF 
+ 496      CDDFF1
+ 497 1ceb FFCDDFF1 		.ascii	"\377\315\337\361\377\315\340\361\377\315\340\361\377\315\340"
+ 497      FFCDE0F1 
+ 497      FFCDE0F1 
+ 497      FFCDE0
+ 498 1cfa F1FFCEE0 		.ascii	"\361\377\316\340\361\377\316\340\361\377\316\340\361\377\316"
+ 498      F1FFCEE0 
+ 498      F1FFCEE0 
+ 498      F1FFCE
+ 499 1d09 E0F1FFCE 		.ascii	"\340\361\377\316\340\361\377\316\340\361\377\316\340\361\377"
+ 499      E0F1FFCE 
+ 499      E0F1FFCE 
+ 499      E0F1FF
+ 500 1d18 CFE1F2FF 		.ascii	"\317\341\362\377\317\341\362\377\317\341\362\377\324\344\363"
+ 500      CFE1F2FF 
+ 500      CFE1F2FF 
+ 500      D4E4F3
+ 501 1d27 FFD4E4F3 		.ascii	"\377\324\344\363\377\324\344\363\377\324\344\363\377\324\344"
+ 501      FFD4E4F3 
+ 501      FFD4E4F3 
+ 501      FFD4E4
+ 502 1d36 F3FFD5E5 		.ascii	"\363\377\325\345\364\377\325\345\364\377\325\345\364\377\325"
+ 502      F4FFD5E5 
+ 502      F4FFD5E5 
+ 502      F4FFD5
+ 503 1d45 E5F4FFD5 		.ascii	"\345\364\377\325\345\364\377\325\345\364\377\326\345\364\377"
+ 503      E5F4FFD5 
+ 503      E5F4FFD6 
+ 503      E5F4FF
+ 504 1d54 D6E5F4FF 		.ascii	"\326\345\364\377\326\345\364\377\326\345\364\377\326\346\364"
+ 504      D6E5F4FF 
+ 504      D6E5F4FF 
+ 504      D6E6F4
+ 505 1d63 FFD6E6F4 		.ascii	"\377\326\346\364\377\326\346\364\377\327\346\364\377\327\346"
+ 505      FFD6E6F4 
+ 505      FFD7E6F4 
+ 505      FFD7E6
+GAS LISTING /tmp/ccK8DYMt.s 			page 36
+
+
+ 506 1d72 F4FFD7E6 		.ascii	"\364\377\327\346\364\377\327\346\364\377\327\346\364\377\327"
+ 506      F4FFD7E6 
+ 506      F4FFD7E6 
+ 506      F4FFD7
+ 507 1d81 E6F4FFD7 		.ascii	"\346\364\377\327\346\364\377\330\347\365\377\330\347\365\377"
+ 507      E6F4FFD8 
+ 507      E7F5FFD8 
+ 507      E7F5FF
+ 508 1d90 D8E7F5FF 		.ascii	"\330\347\365\377\330\347\365\377\330\347\365\377\330\347\365"
+ 508      D8E7F5FF 
+ 508      D8E7F5FF 
+ 508      D8E7F5
+ 509 1d9f FFD9E7F5 		.ascii	"\377\331\347\365\377\331\347\365\377\331\347\365\377\331\347"
+ 509      FFD9E7F5 
+ 509      FFD9E7F5 
+ 509      FFD9E7
+ 510 1dae F5FFD9E8 		.ascii	"\365\377\331\350\365\377\331\350\365\377\331\350\365\377\332"
+ 510      F5FFD9E8 
+ 510      F5FFD9E8 
+ 510      F5FFDA
+ 511 1dbd E8F5FFDA 		.ascii	"\350\365\377\332\350\365\377\332\350\365\377\332\350\365\377"
+ 511      E8F5FFDA 
+ 511      E8F5FFDA 
+ 511      E8F5FF
+ 512 1dcc DAE8F5FF 		.ascii	"\332\350\365\377\332\350\365\377\332\350\365\377\333\351\366"
+ 512      DAE8F5FF 
+ 512      DAE8F5FF 
+ 512      DBE9F6
+ 513 1ddb FFDBE9F6 		.ascii	"\377\333\351\366\377\333\351\366\377\333\351\366\377\333\351"
+ 513      FFDBE9F6 
+ 513      FFDBE9F6 
+ 513      FFDBE9
+ 514 1dea F6FFDBE9 		.ascii	"\366\377\333\351\366\377\334\351\366\377\334\351\366\377\334"
+ 514      F6FFDCE9 
+ 514      F6FFDCE9 
+ 514      F6FFDC
+ 515 1df9 E9F6FFDC 		.ascii	"\351\366\377\334\351\366\377\334\352\366\377\334\352\366\377"
+ 515      E9F6FFDC 
+ 515      EAF6FFDC 
+ 515      EAF6FF
+ 516 1e08 DCEAF6FF 		.ascii	"\334\352\366\377\335\352\366\377\335\352\366\377\335\352\366"
+ 516      DDEAF6FF 
+ 516      DDEAF6FF 
+ 516      DDEAF6
+ 517 1e17 FFDDEAF6 		.ascii	"\377\335\352\366\377\335\352\366\377\335\352\366\377\335\353"
+ 517      FFDDEAF6 
+ 517      FFDDEAF6 
+ 517      FFDDEB
+ 518 1e26 F6FFDEEB 		.ascii	"\366\377\336\353\367\377\336\353\367\377\336\353\367\377\336"
+ 518      F7FFDEEB 
+ 518      F7FFDEEB 
+ 518      F7FFDE
+ 519 1e35 EBF7FFDE 		.ascii	"\353\367\377\336\353\367\377\336\353\367\377\337\353\367\377"
+ 519      EBF7FFDE 
+ 519      EBF7FFDF 
+ 519      EBF7FF
+ 520 1e44 DFEBF7FF 		.ascii	"\337\353\367\377\337\353\367\377\337\353\367\377\337\354\367"
+GAS LISTING /tmp/ccK8DYMt.s 			page 37
+
+
+ 520      DFEBF7FF 
+ 520      DFEBF7FF 
+ 520      DFECF7
+ 521 1e53 FFDFECF7 		.ascii	"\377\337\354\367\377\340\354\367\377\340\354\367\377\340\354"
+ 521      FFE0ECF7 
+ 521      FFE0ECF7 
+ 521      FFE0EC
+ 522 1e62 F7FFE0EC 		.ascii	"\367\377\340\354\367\377\340\354\367\377\340\354\367\377\340"
+ 522      F7FFE0EC 
+ 522      F7FFE0EC 
+ 522      F7FFE0
+ 523 1e71 ECF7FFE1 		.ascii	"\354\367\377\341\354\370\377\341\355\370\377\341\355\370\377"
+ 523      ECF8FFE1 
+ 523      EDF8FFE1 
+ 523      EDF8FF
+ 524 1e80 E1EDF8FF 		.ascii	"\341\355\370\377\341\355\370\377\341\355\370\377\342\355\370"
+ 524      E1EDF8FF 
+ 524      E1EDF8FF 
+ 524      E2EDF8
+ 525 1e8f FFE2EDF8 		.ascii	"\377\342\355\370\377\342\355\370\377\342\355\370\377\342\355"
+ 525      FFE2EDF8 
+ 525      FFE2EDF8 
+ 525      FFE2ED
+ 526 1e9e F8FFE2EE 		.ascii	"\370\377\342\356\370\377\343\356\370\377\343\356\370\377\343"
+ 526      F8FFE3EE 
+ 526      F8FFE3EE 
+ 526      F8FFE3
+ 527 1ead EEF8FFE3 		.ascii	"\356\370\377\343\356\370\377\343\356\370\377\343\356\370\377"
+ 527      EEF8FFE3 
+ 527      EEF8FFE3 
+ 527      EEF8FF
+ 528 1ebc E3EEF8FF 		.ascii	"\343\356\370\377\344\356\370\377\344\356\371\377\344\357\371"
+ 528      E4EEF8FF 
+ 528      E4EEF9FF 
+ 528      E4EFF9
+ 529 1ecb FFE4EFF9 		.ascii	"\377\344\357\371\377\344\357\371\377\344\357\371\377\345\357"
+ 529      FFE4EFF9 
+ 529      FFE4EFF9 
+ 529      FFE5EF
+ 530 1eda F9FFE5EF 		.ascii	"\371\377\345\357\371\377\345\357\371\377\345\357\371\377\345"
+ 530      F9FFE5EF 
+ 530      F9FFE5EF 
+ 530      F9FFE5
+ 531 1ee9 EFF9FFE5 		.ascii	"\357\371\377\345\357\371\377\346\360\371\377\346\360\371\377"
+ 531      EFF9FFE6 
+ 531      F0F9FFE6 
+ 531      F0F9FF
+ 532 1ef8 E6F0F9FF 		.ascii	"\346\360\371\377\346\360\371\377\346\360\371\377\346\360\371"
+ 532      E6F0F9FF 
+ 532      E6F0F9FF 
+ 532      E6F0F9
+ 533 1f07 FFE6F0F9 		.ascii	"\377\346\360\371\377\347\360\371\377\347\360\371\377\347\360"
+ 533      FFE7F0F9 
+ 533      FFE7F0F9 
+ 533      FFE7F0
+ 534 1f16 FAFFE7F1 		.ascii	"\372\377\347\361\372\377\347\361\372\377\347\361\372\377\355"
+ 534      FAFFE7F1 
+GAS LISTING /tmp/ccK8DYMt.s 			page 38
+
+
+ 534      FAFFE7F1 
+ 534      FAFFED
+ 535 1f25 F4FBFFED 		.ascii	"\364\373\377\355\364\373\377\355\364\373\377\355\364\373\377"
+ 535      F4FBFFED 
+ 535      F4FBFFED 
+ 535      F4FBFF
+ 536 1f34 EDF4FCFF 		.ascii	"\355\364\374\377\355\365\374\377\355\365\374\377\356\365\374"
+ 536      EDF5FCFF 
+ 536      EDF5FCFF 
+ 536      EEF5FC
+ 537 1f43 FFEEF5FC 		.ascii	"\377\356\365\374\377\356\365\374\377\356\365\374\377\356\365"
+ 537      FFEEF5FC 
+ 537      FFEEF5FC 
+ 537      FFEEF5
+ 538 1f52 FCFFEEF5 		.ascii	"\374\377\356\365\374\377\357\365\374\377\357\365\374\377\357"
+ 538      FCFFEFF5 
+ 538      FCFFEFF5 
+ 538      FCFFEF
+ 539 1f61 F6FCFFEF 		.ascii	"\366\374\377\357\366\374\377\357\366\374\377\357\366\374\377"
+ 539      F6FCFFEF 
+ 539      F6FCFFEF 
+ 539      F6FCFF
+ 540 1f70 F0F6FCFF 		.ascii	"\360\366\374\377\360\366\374\377\360\366\374\377\360\366\374"
+ 540      F0F6FCFF 
+ 540      F0F6FCFF 
+ 540      F0F6FC
+ 541 1f7f FFF0F6FC 		.ascii	"\377\360\366\374\377\360\366\375\377\360\367\375\377\361\367"
+ 541      FFF0F6FD 
+ 541      FFF0F7FD 
+ 541      FFF1F7
+ 542 1f8e FDFFF1F7 		.ascii	"\375\377\361\367\375\377\361\367\375\377\361\367\375\377\361"
+ 542      FDFFF1F7 
+ 542      FDFFF1F7 
+ 542      FDFFF1
+ 543 1f9d F7FDFFF1 		.ascii	"\367\375\377\361\367\375\377\362\367\375\377\362\367\375\377"
+ 543      F7FDFFF2 
+ 543      F7FDFFF2 
+ 543      F7FDFF
+ 544 1fac F2F7FDFF 		.ascii	"\362\367\375\377\362\370\375\377\362\370\375\377\362\370\375"
+ 544      F2F8FDFF 
+ 544      F2F8FDFF 
+ 544      F2F8FD
+ 545 1fbb FFF2F8FD 		.ascii	"\377\362\370\375\377"
+ 545      FF
+ 546 1fc0 F3F8FDFF 		.ascii	"\363\370\375\377\363\370\375\377\363\370\375\377\363\370\375"
+ 546      F3F8FDFF 
+ 546      F3F8FDFF 
+ 546      F3F8FD
+ 547 1fcf FFF3F8FD 		.ascii	"\377\363\370\375\377\363\370\376\377\364\371\376\377\364\371"
+ 547      FFF3F8FE 
+ 547      FFF4F9FE 
+ 547      FFF4F9
+ 548 1fde FEFFF4F9 		.ascii	"\376\377\364\371\376\377\364\371\376\377\364\371\376\377\364"
+ 548      FEFFF4F9 
+ 548      FEFFF4F9 
+ 548      FEFFF4
+ 549 1fed F9FEFFF4 		.ascii	"\371\376\377\364\371\376\377\365\371\376\377\365\371\376\377"
+GAS LISTING /tmp/ccK8DYMt.s 			page 39
+
+
+ 549      F9FEFFF5 
+ 549      F9FEFFF5 
+ 549      F9FEFF
+ 550 1ffc F5F9FEFF 		.ascii	"\365\371\376\377\365\372\376\377\365\372\376\377\365\372\376"
+ 550      F5FAFEFF 
+ 550      F5FAFEFF 
+ 550      F5FAFE
+ 551 200b FFF6FAFE 		.ascii	"\377\366\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 551      FFF6FAFE 
+ 551      FFF6FAFE 
+ 551      FFF6FA
+ 552 201a FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377"
+ 552      FEFFF6FA 
+ 552      FEFF
+ 553              		.globl	heatmap_cs_Blues_soft
+ 554              		.section	.data.rel.local
+ 555              		.align 8
+ 556              		.type	heatmap_cs_Blues_soft, @object
+ 557              		.size	heatmap_cs_Blues_soft, 8
+ 558              	heatmap_cs_Blues_soft:
+ 559 0010 00000000 		.quad	soft
+ 559      00000000 
+ 560              		.section	.data.rel.ro.local
+ 561              		.align 16
+ 562              		.type	soft, @object
+ 563              		.size	soft, 16
+ 564              	soft:
+ 565 0020 00000000 		.quad	soft_data
+ 565      00000000 
+ 566 0028 01040000 		.quad	1025
+ 566      00000000 
+ 567              		.section	.rodata
+ 568 2024 00000000 		.align 32
+ 568      00000000 
+ 568      00000000 
+ 568      00000000 
+ 568      00000000 
+ 569              		.type	soft_data, @object
+ 570              		.size	soft_data, 4100
+ 571              	soft_data:
+ 572 2040 00       		.string	""
+ 573 2041 00       		.string	""
+ 574 2042 00       		.string	""
+ 575 2043 00       		.string	""
+ 576 2044 082F6B00 		.string	"\b/k"
+ 577 2048 08306B07 		.ascii	"\b0k\007\b0k\016\b0l\026\b0l\035\b1l%\b1m,\b1m4\b1m;\b2nC\b2"
+ 577      08306B0E 
+ 577      08306C16 
+ 577      08306C1D 
+ 577      08316C25 
+ 578 206e 6E4A0832 		.ascii	"nJ\b2oR\b2oY\b3oa\b3ph\b3pp\b3pw\b4q\177\t4q\206\t4r\215\t4r"
+ 578      6F520832 
+ 578      6F590833 
+ 578      6F610833 
+ 578      70680833 
+ 579 2097 95093572 		.ascii	"\225\t5r\234\t5s\244\t5s\253\t5s\263\t6t\272\t6t\302\t6u\311"
+ 579      9C093573 
+GAS LISTING /tmp/ccK8DYMt.s 			page 40
+
+
+ 579      A4093573 
+ 579      AB093573 
+ 579      B3093674 
+ 580 20b4 093675D1 		.ascii	"\t6u\321\t7u\330\t7v\340\t7v\347\t7v\357\t8w\366\t8w\376\t8x"
+ 580      093775D8 
+ 580      093776E0 
+ 580      093776E7 
+ 580      093776EF 
+ 581 20d3 FF093878 		.ascii	"\377\t8x\377\t9x\377\t9y\377\t9y\377\t9y\377\n:z\377\n:z\377"
+ 581      FF093978 
+ 581      FF093979 
+ 581      FF093979 
+ 581      FF093979 
+ 582 20f0 0A3A7BFF 		.ascii	"\n:{\377\n:{\377\n;{\377\n;|\377\n;|\377\n;|\377\n<}\377\n<}"
+ 582      0A3A7BFF 
+ 582      0A3B7BFF 
+ 582      0A3B7CFF 
+ 582      0A3B7CFF 
+ 583 210f FF0A3C7E 		.ascii	"\377\n<~\377\n<~\377\n=~\377\n=\177\377\n=\177\377\n>\200\377"
+ 583      FF0A3C7E 
+ 583      FF0A3D7E 
+ 583      FF0A3D7F 
+ 583      FF0A3D7F 
+ 584 2128 0A3E80FF 		.ascii	"\n>\200\377\n>\200\377\n>\201\377\n?\201\377\n?\201\377\n?\202"
+ 584      0A3E80FF 
+ 584      0A3E81FF 
+ 584      0A3F81FF 
+ 584      0A3F81FF 
+ 585 213f FF0A3F82 		.ascii	"\377\n?\202\377\n@\203\377\n@\203\377\n@\203\377\n@\204\377\n"
+ 585      FF0A4083 
+ 585      FF0A4083 
+ 585      FF0A4083 
+ 585      FF0A4084 
+ 586 2155 4184FF0A 		.ascii	"A\204\377\nA\205\377\nA\205\377\nA\205\377\nB\206\377\nB\206"
+ 586      4185FF0A 
+ 586      4185FF0A 
+ 586      4185FF0A 
+ 586      4286FF0A 
+ 587 216b FF0A4286 		.ascii	"\377\nB\206\377\nB\207\377\nC\207\377\nC\210\377\nC\210\377\n"
+ 587      FF0A4287 
+ 587      FF0A4387 
+ 587      FF0A4388 
+ 587      FF0A4388 
+ 588 2181 4388FF0A 		.ascii	"C\210\377\nD\211\377\nD\211\377\nD\212\377\nE\212\377\nE\212"
+ 588      4489FF0A 
+ 588      4489FF0A 
+ 588      448AFF0A 
+ 588      458AFF0A 
+ 589 2197 FF0A458B 		.ascii	"\377\nE\213\377\nE\213\377\nF\213\377\nF\214\377\nF\214\377\n"
+ 589      FF0A458B 
+ 589      FF0A468B 
+ 589      FF0A468C 
+ 589      FF0A468C 
+ 590 21ad 468DFF0A 		.ascii	"F\215\377\nG\215\377\nG\215\377\nG\216\377\nG\216\377\nH\217"
+ 590      478DFF0A 
+ 590      478DFF0A 
+ 590      478EFF0A 
+GAS LISTING /tmp/ccK8DYMt.s 			page 41
+
+
+ 590      478EFF0A 
+ 591 21c3 FF0A488F 		.ascii	"\377\nH\217\377\nH\217\377\nH\220\377\tI\220\377\tI\221\377\t"
+ 591      FF0A488F 
+ 591      FF0A4890 
+ 591      FF094990 
+ 591      FF094991 
+ 592 21d9 4991FF09 		.ascii	"I\221\377\tJ\221\377\tJ\222\377\tJ\222\377\tJ\222\377\tK\223"
+ 592      4A91FF09 
+ 592      4A92FF09 
+ 592      4A92FF09 
+ 592      4A92FF09 
+ 593 21ef FF094B93 		.ascii	"\377\tK\223\377\tK\224\377\tK\224\377\tL\224\377\tL\225\377\t"
+ 593      FF094B94 
+ 593      FF094B94 
+ 593      FF094C94 
+ 593      FF094C95 
+ 594 2205 4C95FF09 		.ascii	"L\225\377\tL\226\377\tM\226\377\tM\226\377\tM\227\377\bN\227"
+ 594      4C96FF09 
+ 594      4D96FF09 
+ 594      4D96FF09 
+ 594      4D97FF08 
+ 595 221b FF084E98 		.ascii	"\377\bN\230\377\bN\230\377\bN\230\377\bO\231\377\bO\231\377\b"
+ 595      FF084E98 
+ 595      FF084E98 
+ 595      FF084F99 
+ 595      FF084F99 
+ 596 2231 4F9AFF08 		.ascii	"O\232\377\bO\232\377\bP\232\377\bP\233\377\bP\233\377\bP\234"
+ 596      4F9AFF08 
+ 596      509AFF08 
+ 596      509BFF08 
+ 596      509BFF08 
+ 597 2247 FF08519C 		.ascii	"\377\bQ\234\377\bQ\234\377\bQ\234\377\bQ\234\377\bR\235\377\b"
+ 597      FF08519C 
+ 597      FF08519C 
+ 597      FF08519C 
+ 597      FF08529D 
+ 598 225d 529DFF09 		.ascii	"R\235\377\tR\235\377\tR\235\377\tS\235\377\tS\236\377\tS\236"
+ 598      529DFF09 
+ 598      529DFF09 
+ 598      539DFF09 
+ 598      539EFF09 
+ 599 2273 FF09539E 		.ascii	"\377\tS\236\377\tT\236\377\nT\236\377\nT\237\377\nT\237\377\n"
+ 599      FF09549E 
+ 599      FF0A549E 
+ 599      FF0A549F 
+ 599      FF0A549F 
+ 600 2289 559FFF0A 		.ascii	"U\237\377\nU\237\377\013U\237\377\013U\240\377\013V\240\377\013"
+ 600      559FFF0B 
+ 600      559FFF0B 
+ 600      55A0FF0B 
+ 600      56A0FF0B 
+ 601 229d 56A0FF0B 		.ascii	"V\240\377\013V\240\377\013V\240\377\fW\241\377\fW\241\377\fW"
+ 601      56A0FF0B 
+ 601      56A0FF0C 
+ 601      57A1FF0C 
+ 601      57A1FF0C 
+ 602 22b2 A1FF0C57 		.ascii	"\241\377\fW\241\377\fX\241\377\fX\242\377\rX\242\377\rX\242\377"
+GAS LISTING /tmp/ccK8DYMt.s 			page 42
+
+
+ 602      A1FF0C58 
+ 602      A1FF0C58 
+ 602      A2FF0D58 
+ 602      A2FF0D58 
+ 603 22c8 0D59A2FF 		.ascii	"\rY\242\377\rY\242\377\rY\243\377\016Y\243\377\016Z\243\377\016"
+ 603      0D59A2FF 
+ 603      0D59A3FF 
+ 603      0E59A3FF 
+ 603      0E5AA3FF 
+ 604 22dd 5AA3FF0E 		.ascii	"Z\243\377\016Z\243\377\016Z\244\377\017[\244\377\017[\244\377"
+ 604      5AA3FF0E 
+ 604      5AA4FF0F 
+ 604      5BA4FF0F 
+ 604      5BA4FF
+ 605 22f0 0F5BA4FF 		.ascii	"\017[\244\377\017[\244\377\017\\\245\377\017\\\245\377\020\\"
+ 605      0F5BA4FF 
+ 605      0F5CA5FF 
+ 605      0F5CA5FF 
+ 605      105C
+ 606 2302 A5FF105C 		.ascii	"\245\377\020\\\245\377\020]\245\377\020]\246\377\020]\246\377"
+ 606      A5FF105D 
+ 606      A5FF105D 
+ 606      A6FF105D 
+ 606      A6FF
+ 607 2314 115DA6FF 		.ascii	"\021]\246\377\021^\246\377\021^\246\377\021^\247\377\021^\247"
+ 607      115EA6FF 
+ 607      115EA6FF 
+ 607      115EA7FF 
+ 607      115EA7
+ 608 2327 FF125FA7 		.ascii	"\377\022_\247\377\022_\247\377\022_\247\377\022_\250\377\022"
+ 608      FF125FA7 
+ 608      FF125FA7 
+ 608      FF125FA8 
+ 608      FF12
+ 609 2339 60A8FF13 		.ascii	"`\250\377\023`\250\377\023`\250\377\023`\250\377\023a\250\377"
+ 609      60A8FF13 
+ 609      60A8FF13 
+ 609      60A8FF13 
+ 609      61A8FF
+ 610 234c 1361A9FF 		.ascii	"\023a\251\377\024a\251\377\024a\251\377\024b\251\377\024b\251"
+ 610      1461A9FF 
+ 610      1461A9FF 
+ 610      1462A9FF 
+ 610      1462A9
+ 611 235f FF1462AA 		.ascii	"\377\024b\252\377\025b\252\377\025c\252\377\025c\252\377\025"
+ 611      FF1562AA 
+ 611      FF1563AA 
+ 611      FF1563AA 
+ 611      FF15
+ 612 2371 63AAFF15 		.ascii	"c\252\377\025c\253\377\026d\253\377\026d\253\377\026d\253\377"
+ 612      63ABFF16 
+ 612      64ABFF16 
+ 612      64ABFF16 
+ 612      64ABFF
+ 613 2384 1664ABFF 		.ascii	"\026d\253\377\026e\254\377\027e\254\377\027e\254\377\027e\254"
+ 613      1665ACFF 
+ 613      1765ACFF 
+GAS LISTING /tmp/ccK8DYMt.s 			page 43
+
+
+ 613      1765ACFF 
+ 613      1765AC
+ 614 2397 FF1766AC 		.ascii	"\377\027f\254\377\027f\255\377\030f\255\377\030f\255\377\030"
+ 614      FF1766AD 
+ 614      FF1866AD 
+ 614      FF1866AD 
+ 614      FF18
+ 615 23a9 67ADFF18 		.ascii	"g\255\377\030g\255\377\030g\256\377\031g\256\377\031h\256\377"
+ 615      67ADFF18 
+ 615      67AEFF19 
+ 615      67AEFF19 
+ 615      68AEFF
+ 616 23bc 1968AEFF 		.ascii	"\031h\256\377\031h\256\377\032h\256\377\032i\257\377\032i\257"
+ 616      1968AEFF 
+ 616      1A68AEFF 
+ 616      1A69AFFF 
+ 616      1A69AF
+ 617 23cf FF1A69AF 		.ascii	"\377\032i\257\377\032i\257\377\033j\257\377\033j\260\377\033"
+ 617      FF1A69AF 
+ 617      FF1B6AAF 
+ 617      FF1B6AB0 
+ 617      FF1B
+ 618 23e1 6AB0FF1B 		.ascii	"j\260\377\033j\260\377\033k\260\377\034k\260\377\034k\261\377"
+ 618      6AB0FF1B 
+ 618      6BB0FF1C 
+ 618      6BB0FF1C 
+ 618      6BB1FF
+ 619 23f4 1C6BB1FF 		.ascii	"\034k\261\377\034l\261\377\035l\261\377\035l\261\377\035l\262"
+ 619      1C6CB1FF 
+ 619      1D6CB1FF 
+ 619      1D6CB1FF 
+ 619      1D6CB2
+ 620 2407 FF1D6DB2 		.ascii	"\377\035m\262\377\035m\262\377\036m\262\377\036m\262\377\036"
+ 620      FF1D6DB2 
+ 620      FF1E6DB2 
+ 620      FF1E6DB2 
+ 620      FF1E
+ 621 2419 6EB2FF1E 		.ascii	"n\262\377\036n\263\377\037n\263\377\037n\263\377\037o\263\377"
+ 621      6EB3FF1F 
+ 621      6EB3FF1F 
+ 621      6EB3FF1F 
+ 621      6FB3FF
+ 622 242c 1F6FB3FF 		.ascii	"\037o\263\377\037o\264\377 o\264\377 p\264\377 p\264\377 p\264"
+ 622      1F6FB4FF 
+ 622      206FB4FF 
+ 622      2070B4FF 
+ 622      2070B4FF 
+ 623 2443 FF2171B5 		.ascii	"\377!q\265\377!q\265\377!q\265\377!q\265\377!r\265\377!r\265"
+ 623      FF2171B5 
+ 623      FF2171B5 
+ 623      FF2171B5 
+ 623      FF2172B5 
+ 624 245b FF2272B5 		.ascii	"\377\"r\265\377\"r\266\377\"s\266\377\"s\266\377\"s\266\377#"
+ 624      FF2272B6 
+ 624      FF2273B6 
+ 624      FF2273B6 
+ 624      FF2273B6 
+GAS LISTING /tmp/ccK8DYMt.s 			page 44
+
+
+ 625 2471 73B6FF23 		.ascii	"s\266\377#t\266\377#t\266\377#t\267\377#t\267\377$u\267\377$"
+ 625      74B6FF23 
+ 625      74B6FF23 
+ 625      74B7FF23 
+ 625      74B7FF24 
+ 626 2489 75B7FF24 		.ascii	"u\267\377$u\267\377$u\267\377%v\267\377%v\270\377%v\270\377%"
+ 626      75B7FF24 
+ 626      75B7FF25 
+ 626      76B7FF25 
+ 626      76B8FF25 
+ 627 24a1 76B8FF25 		.ascii	"v\270\377%w\270\377&w\270\377&w\270\377&x\270\377&x\271\377'"
+ 627      77B8FF26 
+ 627      77B8FF26 
+ 627      77B8FF26 
+ 627      78B8FF26 
+ 628 24b9 78B9FF27 		.ascii	"x\271\377'x\271\377'y\271\377'y\271\377'y\271\377(y\271\377("
+ 628      78B9FF27 
+ 628      79B9FF27 
+ 628      79B9FF27 
+ 628      79B9FF28 
+ 629 24d1 7ABAFF28 		.ascii	"z\272\377(z\272\377(z\272\377)z\272\377){\272\377){\272\377)"
+ 629      7ABAFF28 
+ 629      7ABAFF29 
+ 629      7ABAFF29 
+ 629      7BBAFF29 
+ 630 24e9 7BBAFF2A 		.ascii	"{\272\377*{\272\377*|\273\377*|\273\377*|\273\377+|\273\377+"
+ 630      7BBAFF2A 
+ 630      7CBBFF2A 
+ 630      7CBBFF2A 
+ 630      7CBBFF2B 
+ 631 2501 7DBBFF2B 		.ascii	"}\273\377+}\273\377+}\273\377,}\274\377,~\274\377,~\274\377,"
+ 631      7DBBFF2B 
+ 631      7DBBFF2C 
+ 631      7DBCFF2C 
+ 631      7EBCFF2C 
+ 632 2519 7EBCFF2D 		.ascii	"~\274\377-\177\274\377-\177\274\377-\177\274\377-\177\275\377"
+ 632      7FBCFF2D 
+ 632      7FBCFF2D 
+ 632      7FBCFF2D 
+ 632      7FBDFF
+ 633 252c 2E80BDFF 		.ascii	".\200\275\377.\200\275\377.\200\275\377.\200\275\377/\201\275"
+ 633      2E80BDFF 
+ 633      2E80BDFF 
+ 633      2E80BDFF 
+ 633      2F81BD
+ 634 253f FF2F81BD 		.ascii	"\377/\201\275\377/\201\275\377/\201\276\3770\202\276\3770\202"
+ 634      FF2F81BD 
+ 634      FF2F81BE 
+ 634      FF3082BE 
+ 634      FF3082
+ 635 2552 BEFF3082 		.ascii	"\276\3770\202\276\3771\202\276\3771\203\276\3771\203\276\377"
+ 635      BEFF3182 
+ 635      BEFF3183 
+ 635      BEFF3183 
+ 635      BEFF
+ 636 2564 3183BFFF 		.ascii	"1\203\277\3772\203\277\3772\204\277\3772\204\277\3772\204\277"
+ 636      3283BFFF 
+GAS LISTING /tmp/ccK8DYMt.s 			page 45
+
+
+ 636      3284BFFF 
+ 636      3284BFFF 
+ 636      3284BF
+ 637 2577 FF3384BF 		.ascii	"\3773\204\277\3773\205\277\3773\205\277\3773\205\300\3774\205"
+ 637      FF3385BF 
+ 637      FF3385BF 
+ 637      FF3385C0 
+ 637      FF3485
+ 638 258a C0FF3486 		.ascii	"\300\3774\206\300\3774\206\300\3775\206\300\3775\206\300\377"
+ 638      C0FF3486 
+ 638      C0FF3586 
+ 638      C0FF3586 
+ 638      C0FF
+ 639 259c 3587C0FF 		.ascii	"5\207\300\3775\207\300\3776\207\301\3776\210\301\3776\210\301"
+ 639      3587C0FF 
+ 639      3687C1FF 
+ 639      3688C1FF 
+ 639      3688C1
+ 640 25af FF3788C1 		.ascii	"\3777\210\301\3777\210\301\3777\211\301\3777\211\301\3778\211"
+ 640      FF3788C1 
+ 640      FF3789C1 
+ 640      FF3789C1 
+ 640      FF3889
+ 641 25c2 C1FF3889 		.ascii	"\301\3778\211\302\3778\212\302\3779\212\302\3779\212\302\377"
+ 641      C2FF388A 
+ 641      C2FF398A 
+ 641      C2FF398A 
+ 641      C2FF
+ 642 25d4 398AC2FF 		.ascii	"9\212\302\3779\213\302\377:\213\302\377:\213\302\377:\213\303"
+ 642      398BC2FF 
+ 642      3A8BC2FF 
+ 642      3A8BC2FF 
+ 642      3A8BC3
+ 643 25e7 FF3B8CC3 		.ascii	"\377;\214\303\377;\214\303\377;\214\303\377<\214\303\377<\215"
+ 643      FF3B8CC3 
+ 643      FF3B8CC3 
+ 643      FF3C8CC3 
+ 643      FF3C8D
+ 644 25fa C3FF3C8D 		.ascii	"\303\377<\215\303\377<\215\303\377=\215\304\377=\216\304\377"
+ 644      C3FF3C8D 
+ 644      C3FF3D8D 
+ 644      C4FF3D8E 
+ 644      C4FF
+ 645 260c 3D8EC4FF 		.ascii	"=\216\304\377>\216\304\377>\216\304\377>\217\304\377>\217\304"
+ 645      3E8EC4FF 
+ 645      3E8EC4FF 
+ 645      3E8FC4FF 
+ 645      3E8FC4
+ 646 261f FF3F8FC4 		.ascii	"\377?\217\304\377?\217\305\377?\220\305\377@\220\305\377@\220"
+ 646      FF3F8FC5 
+ 646      FF3F90C5 
+ 646      FF4090C5 
+ 646      FF4090
+ 647 2632 C5FF4090 		.ascii	"\305\377@\220\305\377A\221\305\377A\221\305\377A\221\305\377"
+ 647      C5FF4191 
+ 647      C5FF4191 
+ 647      C5FF4191 
+GAS LISTING /tmp/ccK8DYMt.s 			page 46
+
+
+ 647      C5FF
+ 648 2644 4292C6FF 		.ascii	"B\222\306\377B\222\306\377B\222\306\377C\222\306\377C\222\306"
+ 648      4292C6FF 
+ 648      4292C6FF 
+ 648      4392C6FF 
+ 648      4392C6
+ 649 2657 FF4393C6 		.ascii	"\377C\223\306\377D\223\306\377D\223\306\377D\223\307\377E\223"
+ 649      FF4493C6 
+ 649      FF4493C6 
+ 649      FF4493C7 
+ 649      FF4593
+ 650 266a C7FF4594 		.ascii	"\307\377E\224\307\377E\224\307\377F\224\307\377F\224\307\377"
+ 650      C7FF4594 
+ 650      C7FF4694 
+ 650      C7FF4694 
+ 650      C7FF
+ 651 267c 4695C7FF 		.ascii	"F\225\307\377G\225\307\377G\225\310\377G\225\310\377H\225\310"
+ 651      4795C7FF 
+ 651      4795C8FF 
+ 651      4795C8FF 
+ 651      4895C8
+ 652 268f FF4896C8 		.ascii	"\377H\226\310\377H\226\310\377I\226\310\377I\226\310\377I\227"
+ 652      FF4896C8 
+ 652      FF4996C8 
+ 652      FF4996C8 
+ 652      FF4997
+ 653 26a2 C8FF4A97 		.ascii	"\310\377J\227\311\377J\227\311\377J\227\311\377J\227\311\377"
+ 653      C9FF4A97 
+ 653      C9FF4A97 
+ 653      C9FF4A97 
+ 653      C9FF
+ 654 26b4 4B98C9FF 		.ascii	"K\230\311\377K\230\311\377K\230\311\377L\230\311\377L\230\312"
+ 654      4B98C9FF 
+ 654      4B98C9FF 
+ 654      4C98C9FF 
+ 654      4C98CA
+ 655 26c7 FF4C99CA 		.ascii	"\377L\231\312\377M\231\312\377M\231\312\377M\231\312\377N\232"
+ 655      FF4D99CA 
+ 655      FF4D99CA 
+ 655      FF4D99CA 
+ 655      FF4E9A
+ 656 26da CAFF4E9A 		.ascii	"\312\377N\232\312\377N\232\312\377O\232\313\377O\232\313\377"
+ 656      CAFF4E9A 
+ 656      CAFF4F9A 
+ 656      CBFF4F9A 
+ 656      CBFF
+ 657 26ec 4F9BCBFF 		.ascii	"O\233\313\377P\233\313\377P\233\313\377P\233\313\377Q\234\313"
+ 657      509BCBFF 
+ 657      509BCBFF 
+ 657      509BCBFF 
+ 657      519CCB
+ 658 26ff FF519CCB 		.ascii	"\377Q\234\313\377Q\234\314\377R\234\314\377R\234\314\377R\235"
+ 658      FF519CCC 
+ 658      FF529CCC 
+ 658      FF529CCC 
+ 658      FF529D
+ 659 2712 CCFF539D 		.ascii	"\314\377S\235\314\377S\235\314\377S\235\314\377T\236\314\377"
+GAS LISTING /tmp/ccK8DYMt.s 			page 47
+
+
+ 659      CCFF539D 
+ 659      CCFF539D 
+ 659      CCFF549E 
+ 659      CCFF
+ 660 2724 549ECDFF 		.ascii	"T\236\315\377T\236\315\377T\236\315\377U\236\315\377U\237\315"
+ 660      549ECDFF 
+ 660      549ECDFF 
+ 660      559ECDFF 
+ 660      559FCD
+ 661 2737 FF559FCD 		.ascii	"\377U\237\315\377V\237\315\377V\237\315\377V\237\316\377W\240"
+ 661      FF569FCD 
+ 661      FF569FCD 
+ 661      FF569FCE 
+ 661      FF57A0
+ 662 274a CEFF57A0 		.ascii	"\316\377W\240\316\377W\240\316\377X\240\316\377X\241\316\377"
+ 662      CEFF57A0 
+ 662      CEFF58A0 
+ 662      CEFF58A1 
+ 662      CEFF
+ 663 275c 58A1CEFF 		.ascii	"X\241\316\377Y\241\316\377Y\241\317\377Y\241\317\377Z\242\317"
+ 663      59A1CEFF 
+ 663      59A1CFFF 
+ 663      59A1CFFF 
+ 663      5AA2CF
+ 664 276f FF5AA2CF 		.ascii	"\377Z\242\317\377Z\242\317\377[\242\317\377[\243\317\377[\243"
+ 664      FF5AA2CF 
+ 664      FF5BA2CF 
+ 664      FF5BA3CF 
+ 664      FF5BA3
+ 665 2782 CFFF5BA3 		.ascii	"\317\377[\243\320\377\\\243\320\377\\\243\320\377\\\244\320\377"
+ 665      D0FF5CA3 
+ 665      D0FF5CA3 
+ 665      D0FF5CA4 
+ 665      D0FF
+ 666 2794 5DA4D0FF 		.ascii	"]\244\320\377]\244\320\377]\244\320\377^\245\320\377^\245\321"
+ 666      5DA4D0FF 
+ 666      5DA4D0FF 
+ 666      5EA5D0FF 
+ 666      5EA5D1
+ 667 27a7 FF5EA5D1 		.ascii	"\377^\245\321\377_\245\321\377_\245\321\377_\246\321\377`\246"
+ 667      FF5FA5D1 
+ 667      FF5FA5D1 
+ 667      FF5FA6D1 
+ 667      FF60A6
+ 668 27ba D1FF60A6 		.ascii	"\321\377`\246\321\377`\246\321\377a\246\322\377a\247\322\377"
+ 668      D1FF60A6 
+ 668      D1FF61A6 
+ 668      D2FF61A7 
+ 668      D2FF
+ 669 27cc 61A7D2FF 		.ascii	"a\247\322\377a\247\322\377b\247\322\377b\250\322\377b\250\322"
+ 669      61A7D2FF 
+ 669      62A7D2FF 
+ 669      62A8D2FF 
+ 669      62A8D2
+ 670 27df FF63A8D2 		.ascii	"\377c\250\322\377c\250\323\377c\250\323\377d\251\323\377d\251"
+ 670      FF63A8D3 
+ 670      FF63A8D3 
+GAS LISTING /tmp/ccK8DYMt.s 			page 48
+
+
+ 670      FF64A9D3 
+ 670      FF64A9
+ 671 27f2 D3FF64A9 		.ascii	"\323\377d\251\323\377e\251\323\377e\252\323\377e\252\323\377"
+ 671      D3FF65A9 
+ 671      D3FF65AA 
+ 671      D3FF65AA 
+ 671      D3FF
+ 672 2804 66AAD3FF 		.ascii	"f\252\323\377f\252\324\377f\252\324\377"
+ 672      66AAD4FF 
+ 672      66AAD4FF 
+ 673 2810 66ABD4FF 		.ascii	"f\253\324\377g\253\324\377g\253\324\377g\253\324\377h\254\324"
+ 673      67ABD4FF 
+ 673      67ABD4FF 
+ 673      67ABD4FF 
+ 673      68ACD4
+ 674 2823 FF68ACD4 		.ascii	"\377h\254\324\377h\254\325\377i\254\325\377i\254\325\377i\255"
+ 674      FF68ACD5 
+ 674      FF69ACD5 
+ 674      FF69ACD5 
+ 674      FF69AD
+ 675 2836 D5FF6AAD 		.ascii	"\325\377j\255\325\377j\255\325\377j\255\325\377k\256\326\377"
+ 675      D5FF6AAD 
+ 675      D5FF6AAD 
+ 675      D5FF6BAE 
+ 675      D6FF
+ 676 2848 6BAED6FF 		.ascii	"k\256\326\377k\256\326\377l\256\326\377l\256\326\377m\257\326"
+ 676      6BAED6FF 
+ 676      6CAED6FF 
+ 676      6CAED6FF 
+ 676      6DAFD6
+ 677 285b FF6DAFD6 		.ascii	"\377m\257\326\377m\257\326\377n\257\326\377n\257\326\377o\260"
+ 677      FF6DAFD6 
+ 677      FF6EAFD6 
+ 677      FF6EAFD6 
+ 677      FF6FB0
+ 678 286e D6FF6FB0 		.ascii	"\326\377o\260\326\377o\260\326\377p\260\327\377p\261\327\377"
+ 678      D6FF6FB0 
+ 678      D6FF70B0 
+ 678      D7FF70B1 
+ 678      D7FF
+ 679 2880 71B1D7FF 		.ascii	"q\261\327\377q\261\327\377q\261\327\377r\261\327\377r\262\327"
+ 679      71B1D7FF 
+ 679      71B1D7FF 
+ 679      72B1D7FF 
+ 679      72B2D7
+ 680 2893 FF73B2D7 		.ascii	"\377s\262\327\377s\262\327\377s\262\327\377t\263\327\377t\263"
+ 680      FF73B2D7 
+ 680      FF73B2D7 
+ 680      FF74B3D7 
+ 680      FF74B3
+ 681 28a6 D7FF75B3 		.ascii	"\327\377u\263\330\377u\263\330\377u\263\330\377v\264\330\377"
+ 681      D8FF75B3 
+ 681      D8FF75B3 
+ 681      D8FF76B4 
+ 681      D8FF
+ 682 28b8 76B4D8FF 		.ascii	"v\264\330\377w\264\330\377w\264\330\377x\265\330\377x\265\330"
+ 682      77B4D8FF 
+GAS LISTING /tmp/ccK8DYMt.s 			page 49
+
+
+ 682      77B4D8FF 
+ 682      78B5D8FF 
+ 682      78B5D8
+ 683 28cb FF78B5D8 		.ascii	"\377x\265\330\377y\265\330\377y\265\330\377z\266\331\377z\266"
+ 683      FF79B5D8 
+ 683      FF79B5D8 
+ 683      FF7AB6D9 
+ 683      FF7AB6
+ 684 28de D9FF7AB6 		.ascii	"\331\377z\266\331\377{\266\331\377{\267\331\377|\267\331\377"
+ 684      D9FF7BB6 
+ 684      D9FF7BB7 
+ 684      D9FF7CB7 
+ 684      D9FF
+ 685 28f0 7CB7D9FF 		.ascii	"|\267\331\377|\267\331\377}\267\331\377}\270\331\377~\270\331"
+ 685      7CB7D9FF 
+ 685      7DB7D9FF 
+ 685      7DB8D9FF 
+ 685      7EB8D9
+ 686 2903 FF7EB8D9 		.ascii	"\377~\270\331\377~\270\332\377\177\271\332\377\177\271\332\377"
+ 686      FF7EB8DA 
+ 686      FF7FB9DA 
+ 686      FF7FB9DA 
+ 686      FF
+ 687 2914 80B9DAFF 		.ascii	"\200\271\332\377\200\271\332\377\200\271\332\377\201\272\332"
+ 687      80B9DAFF 
+ 687      80B9DAFF 
+ 687      81BADA
+ 688 2923 FF81BADA 		.ascii	"\377\201\272\332\377\201\272\332\377\202\272\332\377\202\272"
+ 688      FF81BADA 
+ 688      FF82BADA 
+ 688      FF82BA
+ 689 2932 DAFF83BB 		.ascii	"\332\377\203\273\332\377\203\273\333\377\203\273\333\377\204"
+ 689      DAFF83BB 
+ 689      DBFF83BB 
+ 689      DBFF84
+ 690 2941 BBDBFF84 		.ascii	"\273\333\377\204\274\333\377\205\274\333\377\205\274\333\377"
+ 690      BCDBFF85 
+ 690      BCDBFF85 
+ 690      BCDBFF
+ 691 2950 85BCDBFF 		.ascii	"\205\274\333\377\206\274\333\377\206\275\333\377\207\275\333"
+ 691      86BCDBFF 
+ 691      86BDDBFF 
+ 691      87BDDB
+ 692 295f FF87BDDB 		.ascii	"\377\207\275\333\377\207\275\334\377\210\276\334\377\210\276"
+ 692      FF87BDDC 
+ 692      FF88BEDC 
+ 692      FF88BE
+ 693 296e DCFF89BE 		.ascii	"\334\377\211\276\334\377\211\276\334\377\211\276\334\377\212"
+ 693      DCFF89BE 
+ 693      DCFF89BE 
+ 693      DCFF8A
+ 694 297d BFDCFF8A 		.ascii	"\277\334\377\212\277\334\377\213\277\334\377\213\277\334\377"
+ 694      BFDCFF8B 
+ 694      BFDCFF8B 
+ 694      BFDCFF
+ 695 298c 8BC0DCFF 		.ascii	"\213\300\334\377\214\300\334\377\214\300\335\377\215\300\335"
+ 695      8CC0DCFF 
+GAS LISTING /tmp/ccK8DYMt.s 			page 50
+
+
+ 695      8CC0DDFF 
+ 695      8DC0DD
+ 696 299b FF8DC0DD 		.ascii	"\377\215\300\335\377\215\301\335\377\216\301\335\377\216\301"
+ 696      FF8DC1DD 
+ 696      FF8EC1DD 
+ 696      FF8EC1
+ 697 29aa DDFF8FC1 		.ascii	"\335\377\217\301\335\377\217\301\335\377\217\302\335\377\220"
+ 697      DDFF8FC1 
+ 697      DDFF8FC2 
+ 697      DDFF90
+ 698 29b9 C2DDFF90 		.ascii	"\302\335\377\220\302\335\377\221\302\336\377\221\303\336\377"
+ 698      C2DDFF91 
+ 698      C2DEFF91 
+ 698      C3DEFF
+ 699 29c8 91C3DEFF 		.ascii	"\221\303\336\377\222\303\336\377\222\303\336\377\222\303\336"
+ 699      92C3DEFF 
+ 699      92C3DEFF 
+ 699      92C3DE
+ 700 29d7 FF93C4DE 		.ascii	"\377\223\304\336\377\223\304\336\377\224\304\336\377\224\304"
+ 700      FF93C4DE 
+ 700      FF94C4DE 
+ 700      FF94C4
+ 701 29e6 DEFF94C5 		.ascii	"\336\377\224\305\336\377\225\305\337\377\225\305\337\377\226"
+ 701      DEFF95C5 
+ 701      DFFF95C5 
+ 701      DFFF96
+ 702 29f5 C5DFFF96 		.ascii	"\305\337\377\226\305\337\377\226\306\337\377\227\306\337\377"
+ 702      C5DFFF96 
+ 702      C6DFFF97 
+ 702      C6DFFF
+ 703 2a04 97C6DFFF 		.ascii	"\227\306\337\377\230\306\337\377\230\306\337\377\230\307\337"
+ 703      98C6DFFF 
+ 703      98C6DFFF 
+ 703      98C7DF
+ 704 2a13 FF99C7DF 		.ascii	"\377\231\307\337\377\231\307\337\377\232\307\340\377\232\310"
+ 704      FF99C7DF 
+ 704      FF9AC7E0 
+ 704      FF9AC8
+ 705 2a22 E0FF9AC8 		.ascii	"\340\377\232\310\340\377\233\310\340\377\233\310\340\377\234"
+ 705      E0FF9BC8 
+ 705      E0FF9BC8 
+ 705      E0FF9C
+ 706 2a31 C8E0FF9C 		.ascii	"\310\340\377\234\311\340\377\234\311\340\377\235\311\340\377"
+ 706      C9E0FF9C 
+ 706      C9E0FF9D 
+ 706      C9E0FF
+ 707 2a40 9DC9E0FF 		.ascii	"\235\311\340\377\235\312\340\377\236\312\341\377\236\312\341"
+ 707      9DCAE0FF 
+ 707      9ECAE1FF 
+ 707      9ECAE1
+ 708 2a4f FF9ECAE1 		.ascii	"\377\236\312\341\377\237\312\341\377\237\312\341\377\237\312"
+ 708      FF9FCAE1 
+ 708      FF9FCAE1 
+ 708      FF9FCA
+ 709 2a5e E1FFA0CA 		.ascii	"\341\377\240\312\341\377\240\313\342\377\240\313\342\377\241"
+ 709      E1FFA0CB 
+ 709      E2FFA0CB 
+GAS LISTING /tmp/ccK8DYMt.s 			page 51
+
+
+ 709      E2FFA1
+ 710 2a6d CBE2FFA1 		.ascii	"\313\342\377\241\313\342\377\241\313\342\377\242\313\342\377"
+ 710      CBE2FFA1 
+ 710      CBE2FFA2 
+ 710      CBE2FF
+ 711 2a7c A2CBE2FF 		.ascii	"\242\313\342\377\242\313\342\377\243\314\343\377\243\314\343"
+ 711      A2CBE2FF 
+ 711      A3CCE3FF 
+ 711      A3CCE3
+ 712 2a8b FFA3CCE3 		.ascii	"\377\243\314\343\377\244\314\343\377\244\314\343\377\244\314"
+ 712      FFA4CCE3 
+ 712      FFA4CCE3 
+ 712      FFA4CC
+ 713 2a9a E3FFA5CC 		.ascii	"\343\377\245\314\343\377\245\314\343\377\245\315\343\377\246"
+ 713      E3FFA5CC 
+ 713      E3FFA5CD 
+ 713      E3FFA6
+ 714 2aa9 CDE4FFA6 		.ascii	"\315\344\377\246\315\344\377\246\315\344\377\247\315\344\377"
+ 714      CDE4FFA6 
+ 714      CDE4FFA7 
+ 714      CDE4FF
+ 715 2ab8 A7CDE4FF 		.ascii	"\247\315\344\377\247\315\344\377\250\316\344\377\250\316\344"
+ 715      A7CDE4FF 
+ 715      A8CEE4FF 
+ 715      A8CEE4
+ 716 2ac7 FFA8CEE5 		.ascii	"\377\250\316\345\377\251\316\345\377\251\316\345\377\251\316"
+ 716      FFA9CEE5 
+ 716      FFA9CEE5 
+ 716      FFA9CE
+ 717 2ad6 E5FFAACE 		.ascii	"\345\377\252\316\345\377\252\316\345\377\252\317\345\377\253"
+ 717      E5FFAACE 
+ 717      E5FFAACF 
+ 717      E5FFAB
+ 718 2ae5 CFE5FFAB 		.ascii	"\317\345\377\253\317\345\377\253\317\346\377\254\317\346\377"
+ 718      CFE5FFAB 
+ 718      CFE6FFAC 
+ 718      CFE6FF
+ 719 2af4 ACCFE6FF 		.ascii	"\254\317\346\377\254\317\346\377\255\317\346\377\255\320\346"
+ 719      ACCFE6FF 
+ 719      ADCFE6FF 
+ 719      ADD0E6
+ 720 2b03 FFADD0E6 		.ascii	"\377\255\320\346\377\255\320\346\377\256\320\346\377\256\320"
+ 720      FFADD0E6 
+ 720      FFAED0E6 
+ 720      FFAED0
+ 721 2b12 E7FFAED0 		.ascii	"\347\377\256\320\347\377\257\320\347\377\257\321\347\377\257"
+ 721      E7FFAFD0 
+ 721      E7FFAFD1 
+ 721      E7FFAF
+ 722 2b21 D1E7FFB0 		.ascii	"\321\347\377\260\321\347\377\260\321\347\377\260\321\347\377"
+ 722      D1E7FFB0 
+ 722      D1E7FFB0 
+ 722      D1E7FF
+ 723 2b30 B1D1E7FF 		.ascii	"\261\321\347\377\261\321\350\377\261\321\350\377\262\322\350"
+ 723      B1D1E8FF 
+ 723      B1D1E8FF 
+ 723      B2D2E8
+GAS LISTING /tmp/ccK8DYMt.s 			page 52
+
+
+ 724 2b3f FFB2D2E8 		.ascii	"\377\262\322\350\377\262\322\350\377\263\322\350\377\263\322"
+ 724      FFB2D2E8 
+ 724      FFB3D2E8 
+ 724      FFB3D2
+ 725 2b4e E8FFB3D2 		.ascii	"\350\377\263\322\350\377\263\322\350\377\264\322\351\377\264"
+ 725      E8FFB3D2 
+ 725      E8FFB4D2 
+ 725      E9FFB4
+ 726 2b5d D3E9FFB4 		.ascii	"\323\351\377\264\323\351\377\265\323\351\377\265\323\351\377"
+ 726      D3E9FFB5 
+ 726      D3E9FFB5 
+ 726      D3E9FF
+ 727 2b6c B5D3E9FF 		.ascii	"\265\323\351\377\266\323\351\377\266\323\351\377\266\324\351"
+ 727      B6D3E9FF 
+ 727      B6D3E9FF 
+ 727      B6D4E9
+ 728 2b7b FFB7D4EA 		.ascii	"\377\267\324\352\377\267\324\352\377\267\324\352\377\267\324"
+ 728      FFB7D4EA 
+ 728      FFB7D4EA 
+ 728      FFB7D4
+ 729 2b8a EAFFB8D4 		.ascii	"\352\377\270\324\352\377\270\324\352\377\270\324\352\377\271"
+ 729      EAFFB8D4 
+ 729      EAFFB8D4 
+ 729      EAFFB9
+ 730 2b99 D5EAFFB9 		.ascii	"\325\352\377\271\325\352\377\271\325\352\377\272\325\353\377"
+ 730      D5EAFFB9 
+ 730      D5EAFFBA 
+ 730      D5EBFF
+ 731 2ba8 BAD5EBFF 		.ascii	"\272\325\353\377\272\325\353\377\273\325\353\377\273\326\353"
+ 731      BAD5EBFF 
+ 731      BBD5EBFF 
+ 731      BBD6EB
+ 732 2bb7 FFBBD6EB 		.ascii	"\377\273\326\353\377\273\326\353\377\274\326\353\377\274\326"
+ 732      FFBBD6EB 
+ 732      FFBCD6EB 
+ 732      FFBCD6
+ 733 2bc6 EBFFBCD6 		.ascii	"\353\377\274\326\353\377\275\326\354\377\275\327\354\377\275"
+ 733      EBFFBDD6 
+ 733      ECFFBDD7 
+ 733      ECFFBD
+ 734 2bd5 D7ECFFBE 		.ascii	"\327\354\377\276\327\354\377\276\327\354\377\276\327\354\377"
+ 734      D7ECFFBE 
+ 734      D7ECFFBE 
+ 734      D7ECFF
+ 735 2be4 BED7ECFF 		.ascii	"\276\327\354\377\277\327\354\377\277\327\354\377\277\330\354"
+ 735      BFD7ECFF 
+ 735      BFD7ECFF 
+ 735      BFD8EC
+ 736 2bf3 FFC0D8ED 		.ascii	"\377\300\330\355\377\300\330\355\377\300\330\355\377\301\330"
+ 736      FFC0D8ED 
+ 736      FFC0D8ED 
+ 736      FFC1D8
+ 737 2c02 EDFFC1D8 		.ascii	"\355\377\301\330\355\377\301\330\355\377\301\331\355\377\302"
+ 737      EDFFC1D8 
+ 737      EDFFC1D9 
+ 737      EDFFC2
+ 738 2c11 D9EDFFC2 		.ascii	"\331\355\377\302\331\355\377\302\331\355\377\303\331\356\377"
+GAS LISTING /tmp/ccK8DYMt.s 			page 53
+
+
+ 738      D9EDFFC2 
+ 738      D9EDFFC3 
+ 738      D9EEFF
+ 739 2c20 C3D9EEFF 		.ascii	"\303\331\356\377\303\331\356\377\303\332\356\377\304\332\356"
+ 739      C3D9EEFF 
+ 739      C3DAEEFF 
+ 739      C4DAEE
+ 740 2c2f FFC4DAEE 		.ascii	"\377\304\332\356\377\304\332\356\377\305\332\356\377\305\332"
+ 740      FFC4DAEE 
+ 740      FFC5DAEE 
+ 740      FFC5DA
+ 741 2c3e EEFFC5DA 		.ascii	"\356\377\305\332\356\377\305\333\356\377\306\333\357\377\306"
+ 741      EEFFC5DB 
+ 741      EEFFC6DB 
+ 741      EFFFC6
+ 742 2c4d DBEFFFC6 		.ascii	"\333\357\377\306\333\357\377\306\333\357\377\306\333\357\377"
+ 742      DBEFFFC6 
+ 742      DBEFFFC6 
+ 742      DBEFFF
+ 743 2c5c C7DBEFFF 		.ascii	"\307\333\357\377\307\333\357\377\307\333\357\377\307\334\357"
+ 743      C7DBEFFF 
+ 743      C7DBEFFF 
+ 743      C7DCEF
+ 744 2c6b FFC7DCEF 		.ascii	"\377\307\334\357\377\310\334\357\377\310\334\357\377\310\334"
+ 744      FFC8DCEF 
+ 744      FFC8DCEF 
+ 744      FFC8DC
+ 745 2c7a EFFFC8DC 		.ascii	"\357\377\310\334\357\377\310\334\357\377\310\334\357\377\311"
+ 745      EFFFC8DC 
+ 745      EFFFC8DC 
+ 745      EFFFC9
+ 746 2c89 DDF0FFC9 		.ascii	"\335\360\377\311\335\360\377\311\335\360\377\311\335\360\377"
+ 746      DDF0FFC9 
+ 746      DDF0FFC9 
+ 746      DDF0FF
+ 747 2c98 C9DDF0FF 		.ascii	"\311\335\360\377\312\335\360\377\312\335\360\377\312\335\360"
+ 747      CADDF0FF 
+ 747      CADDF0FF 
+ 747      CADDF0
+ 748 2ca7 FFCADEF0 		.ascii	"\377\312\336\360\377\312\336\360\377\313\336\360\377\313\336"
+ 748      FFCADEF0 
+ 748      FFCBDEF0 
+ 748      FFCBDE
+ 749 2cb6 F0FFCBDE 		.ascii	"\360\377\313\336\360\377\313\336\360\377\313\336\360\377\313"
+ 749      F0FFCBDE 
+ 749      F0FFCBDE 
+ 749      F0FFCB
+ 750 2cc5 DEF0FFCC 		.ascii	"\336\360\377\314\337\361\377\314\337\361\377\314\337\361\377"
+ 750      DFF1FFCC 
+ 750      DFF1FFCC 
+ 750      DFF1FF
+ 751 2cd4 CCDFF1FF 		.ascii	"\314\337\361\377\314\337\361\377\315\337\361\377\315\337\361"
+ 751      CCDFF1FF 
+ 751      CDDFF1FF 
+ 751      CDDFF1
+ 752 2ce3 FFCDDFF1 		.ascii	"\377\315\337\361\377\315\340\361\377\315\340\361\377\316\340"
+ 752      FFCDE0F1 
+GAS LISTING /tmp/ccK8DYMt.s 			page 54
+
+
+ 752      FFCDE0F1 
+ 752      FFCEE0
+ 753 2cf2 F1FFCEE0 		.ascii	"\361\377\316\340\361\377\316\340\361\377\316\340\361\377\316"
+ 753      F1FFCEE0 
+ 753      F1FFCEE0 
+ 753      F1FFCE
+ 754 2d01 E0F1FFCE 		.ascii	"\340\361\377\316\340\361\377\317\341\362\377\317\341\362\377"
+ 754      E0F1FFCF 
+ 754      E1F2FFCF 
+ 754      E1F2FF
+ 755 2d10 CFE1F2FF 		.ascii	"\317\341\362\377\317\341\362\377\317\341\362\377\320\341\362"
+ 755      CFE1F2FF 
+ 755      CFE1F2FF 
+ 755      D0E1F2
+ 756 2d1f FFD0E1F2 		.ascii	"\377\320\341\362\377\320\341\362\377\320\342\362\377\320\342"
+ 756      FFD0E1F2 
+ 756      FFD0E2F2 
+ 756      FFD0E2
+ 757 2d2e F2FFD1E2 		.ascii	"\362\377\321\342\362\377\321\342\362\377\321\342\362\377\321"
+ 757      F2FFD1E2 
+ 757      F2FFD1E2 
+ 757      F2FFD1
+ 758 2d3d E2F2FFD1 		.ascii	"\342\362\377\321\342\362\377\321\342\362\377\322\343\363\377"
+ 758      E2F2FFD1 
+ 758      E2F2FFD2 
+ 758      E3F3FF
+ 759 2d4c D2E3F3FF 		.ascii	"\322\343\363\377\322\343\363\377\322\343\363\377\322\343\363"
+ 759      D2E3F3FF 
+ 759      D2E3F3FF 
+ 759      D2E3F3
+ 760 2d5b FFD3E3F3 		.ascii	"\377\323\343\363\377\323\343\363\377\323\343\363\377\323\344"
+ 760      FFD3E3F3 
+ 760      FFD3E3F3 
+ 760      FFD3E4
+ 761 2d6a F3FFD3E4 		.ascii	"\363\377\323\344\363\377\324\344\363\377\324\344\363\377\324"
+ 761      F3FFD4E4 
+ 761      F3FFD4E4 
+ 761      F3FFD4
+ 762 2d79 E4F3FFD4 		.ascii	"\344\363\377\324\344\363\377\324\344\363\377\324\344\363\377"
+ 762      E4F3FFD4 
+ 762      E4F3FFD4 
+ 762      E4F3FF
+ 763 2d88 D5E5F4FF 		.ascii	"\325\345\364\377\325\345\364\377\325\345\364\377\325\345\364"
+ 763      D5E5F4FF 
+ 763      D5E5F4FF 
+ 763      D5E5F4
+ 764 2d97 FFD5E5F4 		.ascii	"\377\325\345\364\377\326\345\364\377\326\345\364\377\326\345"
+ 764      FFD6E5F4 
+ 764      FFD6E5F4 
+ 764      FFD6E5
+ 765 2da6 F4FFD6E6 		.ascii	"\364\377\326\346\364\377\326\346\364\377\327\346\364\377\327"
+ 765      F4FFD6E6 
+ 765      F4FFD7E6 
+ 765      F4FFD7
+ 766 2db5 E6F4FFD7 		.ascii	"\346\364\377\327\346\364\377\327\346\364\377\327\346\364\377"
+ 766      E6F4FFD7 
+ 766      E6F4FFD7 
+GAS LISTING /tmp/ccK8DYMt.s 			page 55
+
+
+ 766      E6F4FF
+ 767 2dc4 D7E6F4FF 		.ascii	"\327\346\364\377\330\347\365\377\330\347\365\377\330\347\365"
+ 767      D8E7F5FF 
+ 767      D8E7F5FF 
+ 767      D8E7F5
+ 768 2dd3 FFD8E7F5 		.ascii	"\377\330\347\365\377\330\347\365\377\331\347\365\377\331\347"
+ 768      FFD8E7F5 
+ 768      FFD9E7F5 
+ 768      FFD9E7
+ 769 2de2 F5FFD9E7 		.ascii	"\365\377\331\347\365\377\331\350\365\377\331\350\365\377\332"
+ 769      F5FFD9E8 
+ 769      F5FFD9E8 
+ 769      F5FFDA
+ 770 2df1 E8F5FFDA 		.ascii	"\350\365\377\332\350\365\377\332\350\365\377\332\350\365\377"
+ 770      E8F5FFDA 
+ 770      E8F5FFDA 
+ 770      E8F5FF
+ 771 2e00 DAE8F5FF 		.ascii	"\332\350\365\377\332\350\365\377\333\351\366\377\333\351\366"
+ 771      DAE8F5FF 
+ 771      DBE9F6FF 
+ 771      DBE9F6
+ 772 2e0f FFDBE9F6 		.ascii	"\377\333\351\366\377\333\351\366\377\333\351\366\377\334\351"
+ 772      FFDBE9F6 
+ 772      FFDBE9F6 
+ 772      FFDCE9
+ 773 2e1e F6FFDCE9 		.ascii	"\366\377\334\351\366\377\334\351\366\377\334\352\366\377\334"
+ 773      F6FFDCE9 
+ 773      F6FFDCEA 
+ 773      F6FFDC
+ 774 2e2d EAF6FFDD 		.ascii	"\352\366\377\335\352\366\377\335\352\366\377\335\352\366\377"
+ 774      EAF6FFDD 
+ 774      EAF6FFDD 
+ 774      EAF6FF
+ 775 2e3c DDEAF6FF 		.ascii	"\335\352\366\377\335\352\366\377\335\353\366\377\336\353\367"
+ 775      DDEAF6FF 
+ 775      DDEBF6FF 
+ 775      DEEBF7
+ 776 2e4b FFDEEBF7 		.ascii	"\377\336\353\367\377\336\353\367\377\336\353\367\377\336\353"
+ 776      FFDEEBF7 
+ 776      FFDEEBF7 
+ 776      FFDEEB
+ 777 2e5a F7FFDFEB 		.ascii	"\367\377\337\353\367\377\337\353\367\377\337\353\367\377\337"
+ 777      F7FFDFEB 
+ 777      F7FFDFEB 
+ 777      F7FFDF
+ 778 2e69 ECF7FFDF 		.ascii	"\354\367\377\337\354\367\377\340\354\367\377\340\354\367\377"
+ 778      ECF7FFE0 
+ 778      ECF7FFE0 
+ 778      ECF7FF
+ 779 2e78 E0ECF7FF 		.ascii	"\340\354\367\377\340\354\367\377\340\354\367\377\341\354\370"
+ 779      E0ECF7FF 
+ 779      E0ECF7FF 
+ 779      E1ECF8
+ 780 2e87 FFE1EDF8 		.ascii	"\377\341\355\370\377\341\355\370\377\341\355\370\377\341\355"
+ 780      FFE1EDF8 
+ 780      FFE1EDF8 
+ 780      FFE1ED
+GAS LISTING /tmp/ccK8DYMt.s 			page 56
+
+
+ 781 2e96 F8FFE2ED 		.ascii	"\370\377\342\355\370\377\342\355\370\377\342\355\370\377\342"
+ 781      F8FFE2ED 
+ 781      F8FFE2ED 
+ 781      F8FFE2
+ 782 2ea5 EDF8FFE2 		.ascii	"\355\370\377\342\356\370\377\343\356\370\377\343\356\370\377"
+ 782      EEF8FFE3 
+ 782      EEF8FFE3 
+ 782      EEF8FF
+ 783 2eb4 E3EEF8FF 		.ascii	"\343\356\370\377\343\356\370\377\343\356\370\377\344\356\370"
+ 783      E3EEF8FF 
+ 783      E3EEF8FF 
+ 783      E4EEF8
+ 784 2ec3 FFE4EEF9 		.ascii	"\377\344\356\371\377\344\357\371\377\344\357\371\377\344\357"
+ 784      FFE4EFF9 
+ 784      FFE4EFF9 
+ 784      FFE4EF
+ 785 2ed2 F9FFE5EF 		.ascii	"\371\377\345\357\371\377\345\357\371\377\345\357\371\377\345"
+ 785      F9FFE5EF 
+ 785      F9FFE5EF 
+ 785      F9FFE5
+ 786 2ee1 EFF9FFE5 		.ascii	"\357\371\377\345\357\371\377\346\360\371\377\346\360\371\377"
+ 786      EFF9FFE6 
+ 786      F0F9FFE6 
+ 786      F0F9FF
+ 787 2ef0 E6F0F9FF 		.ascii	"\346\360\371\377\346\360\371\377\346\360\371\377\347\360\371"
+ 787      E6F0F9FF 
+ 787      E6F0F9FF 
+ 787      E7F0F9
+ 788 2eff FFE7F0F9 		.ascii	"\377\347\360\371\377\347\360\372\377\347\361\372\377\347\361"
+ 788      FFE7F0FA 
+ 788      FFE7F1FA 
+ 788      FFE7F1
+ 789 2f0e FAFFE8F1 		.ascii	"\372\377\350\361\372\377\350\361\372\377\350\361\372\377\350"
+ 789      FAFFE8F1 
+ 789      FAFFE8F1 
+ 789      FAFFE8
+ 790 2f1d F1FAFFE8 		.ascii	"\361\372\377\350\361\372\377\351\361\372\377\351\362\372\377"
+ 790      F1FAFFE9 
+ 790      F1FAFFE9 
+ 790      F2FAFF
+ 791 2f2c E9F2FAFF 		.ascii	"\351\362\372\377\351\362\372\377\351\362\372\377\351\362\372"
+ 791      E9F2FAFF 
+ 791      E9F2FAFF 
+ 791      E9F2FA
+ 792 2f3b FFEAF2FA 		.ascii	"\377\352\362\372\377\352\362\372\377\352\362\373\377\352\363"
+ 792      FFEAF2FA 
+ 792      FFEAF2FB 
+ 792      FFEAF3
+ 793 2f4a FBFFEAF3 		.ascii	"\373\377\352\363\373\377\353\363\373\377\353\363\373\377\353"
+ 793      FBFFEBF3 
+ 793      FBFFEBF3 
+ 793      FBFFEB
+ 794 2f59 F3FBFFEB 		.ascii	"\363\373\377\353\363\373\377\353\363\373\377\354\363\373\377"
+ 794      F3FBFFEB 
+ 794      F3FBFFEC 
+ 794      F3FBFF
+ 795 2f68 ECF4FBFF 		.ascii	"\354\364\373\377\354\364\373\377\354\364\373\377\354\364\373"
+GAS LISTING /tmp/ccK8DYMt.s 			page 57
+
+
+ 795      ECF4FBFF 
+ 795      ECF4FBFF 
+ 795      ECF4FB
+ 796 2f77 FFEDF4FB 		.ascii	"\377\355\364\373\377\355\364\373\377\355\364\373\377\355\364"
+ 796      FFEDF4FB 
+ 796      FFEDF4FB 
+ 796      FFEDF4
+ 797 2f86 FCFFEDF5 		.ascii	"\374\377\355\365\374\377\356\365\374\377\356\365\374\377\356"
+ 797      FCFFEEF5 
+ 797      FCFFEEF5 
+ 797      FCFFEE
+ 798 2f95 F5FCFFEE 		.ascii	"\365\374\377\356\365\374\377\356\365\374\377\357\365\374\377"
+ 798      F5FCFFEE 
+ 798      F5FCFFEF 
+ 798      F5FCFF
+ 799 2fa4 EFF5FCFF 		.ascii	"\357\365\374\377\357\366\374\377\357\366\374\377\357\366\374"
+ 799      EFF6FCFF 
+ 799      EFF6FCFF 
+ 799      EFF6FC
+ 800 2fb3 FFF0F6FC 		.ascii	"\377\360\366\374\377\360\366\374\377\360\366\374\377\360\366"
+ 800      FFF0F6FC 
+ 800      FFF0F6FC 
+ 800      FFF0F6
+ 801 2fc2 FCFFF0F6 		.ascii	"\374\377\360\366\375\377\360\367\375\377\361\367\375\377\361"
+ 801      FDFFF0F7 
+ 801      FDFFF1F7 
+ 801      FDFFF1
+ 802 2fd1 F7FDFFF1 		.ascii	"\367\375\377\361\367\375\377\361\367\375\377\361\367\375\377"
+ 802      F7FDFFF1 
+ 802      F7FDFFF1 
+ 802      F7FDFF
+ 803 2fe0 F2F7FDFF 		.ascii	"\362\367\375\377\362\367\375\377\362\370\375\377\362\370\375"
+ 803      F2F7FDFF 
+ 803      F2F8FDFF 
+ 803      F2F8FD
+ 804 2fef FFF2F8FD 		.ascii	"\377\362\370\375\377\363\370\375\377\363\370\375\377\363\370"
+ 804      FFF3F8FD 
+ 804      FFF3F8FD 
+ 804      FFF3F8
+ 805 2ffe FDFFF3F8 		.ascii	"\375\377\363\370\375\377\363\370\376\377\364\371\376\377\364"
+ 805      FDFFF3F8 
+ 805      FEFFF4F9 
+ 805      FEFFF4
+ 806 300d F9FEFFF4 		.ascii	"\371\376\377\364\371\376\377\364\371\376\377\364\371\376\377"
+ 806      F9FEFFF4 
+ 806      F9FEFFF4 
+ 806      F9FEFF
+ 807 301c F5F9FEFF 		.ascii	"\365\371\376\377\365\371\376\377\365\371\376\377\365\372\376"
+ 807      F5F9FEFF 
+ 807      F5F9FEFF 
+ 807      F5FAFE
+ 808 302b FFF5FAFE 		.ascii	"\377\365\372\376\377\366\372\376\377\366\372\376\377\366\372"
+ 808      FFF6FAFE 
+ 808      FFF6FAFE 
+ 808      FFF6FA
+ 809 303a FEFFF6FA 		.ascii	"\376\377\366\372\376\377\366\372\376\377"
+ 809      FEFFF6FA 
+GAS LISTING /tmp/ccK8DYMt.s 			page 58
+
+
+ 809      FEFF
+ 810              		.globl	heatmap_cs_Blues_discrete
+ 811              		.section	.data.rel.local
+ 812              		.align 8
+ 813              		.type	heatmap_cs_Blues_discrete, @object
+ 814              		.size	heatmap_cs_Blues_discrete, 8
+ 815              	heatmap_cs_Blues_discrete:
+ 816 0018 00000000 		.quad	discrete
+ 816      00000000 
+ 817              		.section	.data.rel.ro.local
+ 818              		.align 16
+ 819              		.type	discrete, @object
+ 820              		.size	discrete, 16
+ 821              	discrete:
+ 822 0030 00000000 		.quad	discrete_data
+ 822      00000000 
+ 823 0038 0A000000 		.quad	10
+ 823      00000000 
+ 824              		.section	.rodata
+ 825 3044 00000000 		.align 32
+ 825      00000000 
+ 825      00000000 
+ 825      00000000 
+ 825      00000000 
+ 826              		.type	discrete_data, @object
+ 827              		.size	discrete_data, 40
+ 828              	discrete_data:
+ 829 3060 00       		.string	""
+ 830 3061 00       		.string	""
+ 831 3062 00       		.string	""
+ 832 3063 00       		.string	""
+ 833 3064 08306BFF 		.ascii	"\b0k\377\bQ\234\377!q\265\377B\222\306\377k\256\326\377\236\312"
+ 833      08519CFF 
+ 833      2171B5FF 
+ 833      4292C6FF 
+ 833      6BAED6FF 
+ 834 307a E1FFC6DB 		.ascii	"\341\377\306\333\357\377\336\353\367\377\367\373\377\377"
+ 834      EFFFDEEB 
+ 834      F7FFF7FB 
+ 834      FFFF
+ 835              		.text
+ 836              	.Letext0:
+ 837              		.file 1 "./heatmap.h"
+ 838              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 839              		.file 3 "./colorschemes/Blues.h"
+ 840              		.file 4 "colorschemes/Blues.c"
+ 841              		.section	.debug_info,"",@progbits
+ 842              	.Ldebug_info0:
+ 843 0000 E3010000 		.long	0x1e3
+ 844 0004 0500     		.value	0x5
+ 845 0006 01       		.byte	0x1
+ 846 0007 08       		.byte	0x8
+ 847 0008 00000000 		.long	.Ldebug_abbrev0
+ 848 000c 0A       		.uleb128 0xa
+ 849 000d 00000000 		.long	.LASF26
+ 850 0011 1D       		.byte	0x1d
+ 851 0012 00000000 		.long	.LASF0
+GAS LISTING /tmp/ccK8DYMt.s 			page 59
+
+
+ 852 0016 00000000 		.long	.LASF1
+ 853 001a 00000000 		.long	.Ldebug_line0
+ 854 001e 01       		.uleb128 0x1
+ 855 001f 08       		.byte	0x8
+ 856 0020 05       		.byte	0x5
+ 857 0021 00000000 		.long	.LASF2
+ 858 0025 06       		.uleb128 0x6
+ 859 0026 00000000 		.long	.LASF12
+ 860 002a 02       		.byte	0x2
+ 861 002b D6       		.byte	0xd6
+ 862 002c 17       		.byte	0x17
+ 863 002d 31000000 		.long	0x31
+ 864 0031 01       		.uleb128 0x1
+ 865 0032 08       		.byte	0x8
+ 866 0033 07       		.byte	0x7
+ 867 0034 00000000 		.long	.LASF3
+ 868 0038 0B       		.uleb128 0xb
+ 869 0039 04       		.byte	0x4
+ 870 003a 05       		.byte	0x5
+ 871 003b 696E7400 		.string	"int"
+ 872 003f 01       		.uleb128 0x1
+ 873 0040 08       		.byte	0x8
+ 874 0041 05       		.byte	0x5
+ 875 0042 00000000 		.long	.LASF4
+ 876 0046 01       		.uleb128 0x1
+ 877 0047 10       		.byte	0x10
+ 878 0048 04       		.byte	0x4
+ 879 0049 00000000 		.long	.LASF5
+ 880 004d 01       		.uleb128 0x1
+ 881 004e 04       		.byte	0x4
+ 882 004f 04       		.byte	0x4
+ 883 0050 00000000 		.long	.LASF6
+ 884 0054 01       		.uleb128 0x1
+ 885 0055 04       		.byte	0x4
+ 886 0056 07       		.byte	0x7
+ 887 0057 00000000 		.long	.LASF7
+ 888 005b 01       		.uleb128 0x1
+ 889 005c 02       		.byte	0x2
+ 890 005d 07       		.byte	0x7
+ 891 005e 00000000 		.long	.LASF8
+ 892 0062 0C       		.uleb128 0xc
+ 893 0063 10       		.byte	0x10
+ 894 0064 01       		.byte	0x1
+ 895 0065 BB       		.byte	0xbb
+ 896 0066 09       		.byte	0x9
+ 897 0067 84000000 		.long	0x84
+ 898 006b 07       		.uleb128 0x7
+ 899 006c 00000000 		.long	.LASF9
+ 900 0070 BC       		.byte	0xbc
+ 901 0071 1A       		.byte	0x1a
+ 902 0072 84000000 		.long	0x84
+ 903 0076 00       		.byte	0
+ 904 0077 07       		.uleb128 0x7
+ 905 0078 00000000 		.long	.LASF10
+ 906 007c BD       		.byte	0xbd
+ 907 007d 0C       		.byte	0xc
+ 908 007e 25000000 		.long	0x25
+GAS LISTING /tmp/ccK8DYMt.s 			page 60
+
+
+ 909 0082 08       		.byte	0x8
+ 910 0083 00       		.byte	0
+ 911 0084 08       		.uleb128 0x8
+ 912 0085 90000000 		.long	0x90
+ 913 0089 01       		.uleb128 0x1
+ 914 008a 01       		.byte	0x1
+ 915 008b 08       		.byte	0x8
+ 916 008c 00000000 		.long	.LASF11
+ 917 0090 03       		.uleb128 0x3
+ 918 0091 89000000 		.long	0x89
+ 919 0095 06       		.uleb128 0x6
+ 920 0096 00000000 		.long	.LASF13
+ 921 009a 01       		.byte	0x1
+ 922 009b BE       		.byte	0xbe
+ 923 009c 03       		.byte	0x3
+ 924 009d 62000000 		.long	0x62
+ 925 00a1 03       		.uleb128 0x3
+ 926 00a2 95000000 		.long	0x95
+ 927 00a6 08       		.uleb128 0x8
+ 928 00a7 A1000000 		.long	0xa1
+ 929 00ab 04       		.uleb128 0x4
+ 930 00ac 00000000 		.long	.LASF14
+ 931 00b0 21       		.byte	0x21
+ 932 00b1 A6000000 		.long	0xa6
+ 933 00b5 04       		.uleb128 0x4
+ 934 00b6 00000000 		.long	.LASF15
+ 935 00ba 23       		.byte	0x23
+ 936 00bb A6000000 		.long	0xa6
+ 937 00bf 04       		.uleb128 0x4
+ 938 00c0 00000000 		.long	.LASF16
+ 939 00c4 25       		.byte	0x25
+ 940 00c5 A6000000 		.long	0xa6
+ 941 00c9 04       		.uleb128 0x4
+ 942 00ca 00000000 		.long	.LASF17
+ 943 00ce 28       		.byte	0x28
+ 944 00cf A6000000 		.long	0xa6
+ 945 00d3 09       		.uleb128 0x9
+ 946 00d4 90000000 		.long	0x90
+ 947 00d8 E3000000 		.long	0xe3
+ 948 00dc 0D       		.uleb128 0xd
+ 949 00dd 31000000 		.long	0x31
+ 950 00e1 27       		.byte	0x27
+ 951 00e2 00       		.byte	0
+ 952 00e3 03       		.uleb128 0x3
+ 953 00e4 D3000000 		.long	0xd3
+ 954 00e8 02       		.uleb128 0x2
+ 955 00e9 00000000 		.long	.LASF18
+ 956 00ed 20       		.byte	0x20
+ 957 00ee 1C       		.byte	0x1c
+ 958 00ef E3000000 		.long	0xe3
+ 959 00f3 09       		.uleb128 0x9
+ 960 00f4 03       		.byte	0x3
+ 961 00f5 00000000 		.quad	discrete_data
+ 961      00000000 
+ 962 00fd 02       		.uleb128 0x2
+ 963 00fe 00000000 		.long	.LASF19
+ 964 0102 23       		.byte	0x23
+GAS LISTING /tmp/ccK8DYMt.s 			page 61
+
+
+ 965 0103 24       		.byte	0x24
+ 966 0104 A1000000 		.long	0xa1
+ 967 0108 09       		.uleb128 0x9
+ 968 0109 03       		.byte	0x3
+ 969 010a 00000000 		.quad	discrete
+ 969      00000000 
+ 970 0112 05       		.uleb128 0x5
+ 971 0113 AB000000 		.long	0xab
+ 972 0117 24       		.byte	0x24
+ 973 0118 09       		.uleb128 0x9
+ 974 0119 03       		.byte	0x3
+ 975 011a 00000000 		.quad	heatmap_cs_Blues_discrete
+ 975      00000000 
+ 976 0122 09       		.uleb128 0x9
+ 977 0123 90000000 		.long	0x90
+ 978 0127 33010000 		.long	0x133
+ 979 012b 0E       		.uleb128 0xe
+ 980 012c 31000000 		.long	0x31
+ 981 0130 0310     		.value	0x1003
+ 982 0132 00       		.byte	0
+ 983 0133 03       		.uleb128 0x3
+ 984 0134 22010000 		.long	0x122
+ 985 0138 02       		.uleb128 0x2
+ 986 0139 00000000 		.long	.LASF20
+ 987 013d 26       		.byte	0x26
+ 988 013e 1C       		.byte	0x1c
+ 989 013f 33010000 		.long	0x133
+ 990 0143 09       		.uleb128 0x9
+ 991 0144 03       		.byte	0x3
+ 992 0145 00000000 		.quad	soft_data
+ 992      00000000 
+ 993 014d 02       		.uleb128 0x2
+ 994 014e 00000000 		.long	.LASF21
+ 995 0152 29       		.byte	0x29
+ 996 0153 24       		.byte	0x24
+ 997 0154 A1000000 		.long	0xa1
+ 998 0158 09       		.uleb128 0x9
+ 999 0159 03       		.byte	0x3
+ 1000 015a 00000000 		.quad	soft
+ 1000      00000000 
+ 1001 0162 05       		.uleb128 0x5
+ 1002 0163 B5000000 		.long	0xb5
+ 1003 0167 2A       		.byte	0x2a
+ 1004 0168 09       		.uleb128 0x9
+ 1005 0169 03       		.byte	0x3
+ 1006 016a 00000000 		.quad	heatmap_cs_Blues_soft
+ 1006      00000000 
+ 1007 0172 02       		.uleb128 0x2
+ 1008 0173 00000000 		.long	.LASF22
+ 1009 0177 2C       		.byte	0x2c
+ 1010 0178 1C       		.byte	0x1c
+ 1011 0179 33010000 		.long	0x133
+ 1012 017d 09       		.uleb128 0x9
+ 1013 017e 03       		.byte	0x3
+ 1014 017f 00000000 		.quad	mixed_data
+ 1014      00000000 
+ 1015 0187 02       		.uleb128 0x2
+GAS LISTING /tmp/ccK8DYMt.s 			page 62
+
+
+ 1016 0188 00000000 		.long	.LASF23
+ 1017 018c 2F       		.byte	0x2f
+ 1018 018d 24       		.byte	0x24
+ 1019 018e A1000000 		.long	0xa1
+ 1020 0192 09       		.uleb128 0x9
+ 1021 0193 03       		.byte	0x3
+ 1022 0194 00000000 		.quad	mixed
+ 1022      00000000 
+ 1023 019c 05       		.uleb128 0x5
+ 1024 019d BF000000 		.long	0xbf
+ 1025 01a1 30       		.byte	0x30
+ 1026 01a2 09       		.uleb128 0x9
+ 1027 01a3 03       		.byte	0x3
+ 1028 01a4 00000000 		.quad	heatmap_cs_Blues_mixed
+ 1028      00000000 
+ 1029 01ac 02       		.uleb128 0x2
+ 1030 01ad 00000000 		.long	.LASF24
+ 1031 01b1 32       		.byte	0x32
+ 1032 01b2 1C       		.byte	0x1c
+ 1033 01b3 33010000 		.long	0x133
+ 1034 01b7 09       		.uleb128 0x9
+ 1035 01b8 03       		.byte	0x3
+ 1036 01b9 00000000 		.quad	mixed_exp_data
+ 1036      00000000 
+ 1037 01c1 02       		.uleb128 0x2
+ 1038 01c2 00000000 		.long	.LASF25
+ 1039 01c6 35       		.byte	0x35
+ 1040 01c7 24       		.byte	0x24
+ 1041 01c8 A1000000 		.long	0xa1
+ 1042 01cc 09       		.uleb128 0x9
+ 1043 01cd 03       		.byte	0x3
+ 1044 01ce 00000000 		.quad	mixed_exp
+ 1044      00000000 
+ 1045 01d6 05       		.uleb128 0x5
+ 1046 01d7 C9000000 		.long	0xc9
+ 1047 01db 36       		.byte	0x36
+ 1048 01dc 09       		.uleb128 0x9
+ 1049 01dd 03       		.byte	0x3
+ 1050 01de 00000000 		.quad	heatmap_cs_Blues_mixed_exp
+ 1050      00000000 
+ 1051 01e6 00       		.byte	0
+ 1052              		.section	.debug_abbrev,"",@progbits
+ 1053              	.Ldebug_abbrev0:
+ 1054 0000 01       		.uleb128 0x1
+ 1055 0001 24       		.uleb128 0x24
+ 1056 0002 00       		.byte	0
+ 1057 0003 0B       		.uleb128 0xb
+ 1058 0004 0B       		.uleb128 0xb
+ 1059 0005 3E       		.uleb128 0x3e
+ 1060 0006 0B       		.uleb128 0xb
+ 1061 0007 03       		.uleb128 0x3
+ 1062 0008 0E       		.uleb128 0xe
+ 1063 0009 00       		.byte	0
+ 1064 000a 00       		.byte	0
+ 1065 000b 02       		.uleb128 0x2
+ 1066 000c 34       		.uleb128 0x34
+ 1067 000d 00       		.byte	0
+GAS LISTING /tmp/ccK8DYMt.s 			page 63
+
+
+ 1068 000e 03       		.uleb128 0x3
+ 1069 000f 0E       		.uleb128 0xe
+ 1070 0010 3A       		.uleb128 0x3a
+ 1071 0011 21       		.uleb128 0x21
+ 1072 0012 04       		.sleb128 4
+ 1073 0013 3B       		.uleb128 0x3b
+ 1074 0014 0B       		.uleb128 0xb
+ 1075 0015 39       		.uleb128 0x39
+ 1076 0016 0B       		.uleb128 0xb
+ 1077 0017 49       		.uleb128 0x49
+ 1078 0018 13       		.uleb128 0x13
+ 1079 0019 02       		.uleb128 0x2
+ 1080 001a 18       		.uleb128 0x18
+ 1081 001b 00       		.byte	0
+ 1082 001c 00       		.byte	0
+ 1083 001d 03       		.uleb128 0x3
+ 1084 001e 26       		.uleb128 0x26
+ 1085 001f 00       		.byte	0
+ 1086 0020 49       		.uleb128 0x49
+ 1087 0021 13       		.uleb128 0x13
+ 1088 0022 00       		.byte	0
+ 1089 0023 00       		.byte	0
+ 1090 0024 04       		.uleb128 0x4
+ 1091 0025 34       		.uleb128 0x34
+ 1092 0026 00       		.byte	0
+ 1093 0027 03       		.uleb128 0x3
+ 1094 0028 0E       		.uleb128 0xe
+ 1095 0029 3A       		.uleb128 0x3a
+ 1096 002a 21       		.uleb128 0x21
+ 1097 002b 03       		.sleb128 3
+ 1098 002c 3B       		.uleb128 0x3b
+ 1099 002d 0B       		.uleb128 0xb
+ 1100 002e 39       		.uleb128 0x39
+ 1101 002f 21       		.uleb128 0x21
+ 1102 0030 25       		.sleb128 37
+ 1103 0031 49       		.uleb128 0x49
+ 1104 0032 13       		.uleb128 0x13
+ 1105 0033 3F       		.uleb128 0x3f
+ 1106 0034 19       		.uleb128 0x19
+ 1107 0035 3C       		.uleb128 0x3c
+ 1108 0036 19       		.uleb128 0x19
+ 1109 0037 00       		.byte	0
+ 1110 0038 00       		.byte	0
+ 1111 0039 05       		.uleb128 0x5
+ 1112 003a 34       		.uleb128 0x34
+ 1113 003b 00       		.byte	0
+ 1114 003c 47       		.uleb128 0x47
+ 1115 003d 13       		.uleb128 0x13
+ 1116 003e 3A       		.uleb128 0x3a
+ 1117 003f 21       		.uleb128 0x21
+ 1118 0040 04       		.sleb128 4
+ 1119 0041 3B       		.uleb128 0x3b
+ 1120 0042 0B       		.uleb128 0xb
+ 1121 0043 39       		.uleb128 0x39
+ 1122 0044 21       		.uleb128 0x21
+ 1123 0045 1E       		.sleb128 30
+ 1124 0046 02       		.uleb128 0x2
+GAS LISTING /tmp/ccK8DYMt.s 			page 64
+
+
+ 1125 0047 18       		.uleb128 0x18
+ 1126 0048 00       		.byte	0
+ 1127 0049 00       		.byte	0
+ 1128 004a 06       		.uleb128 0x6
+ 1129 004b 16       		.uleb128 0x16
+ 1130 004c 00       		.byte	0
+ 1131 004d 03       		.uleb128 0x3
+ 1132 004e 0E       		.uleb128 0xe
+ 1133 004f 3A       		.uleb128 0x3a
+ 1134 0050 0B       		.uleb128 0xb
+ 1135 0051 3B       		.uleb128 0x3b
+ 1136 0052 0B       		.uleb128 0xb
+ 1137 0053 39       		.uleb128 0x39
+ 1138 0054 0B       		.uleb128 0xb
+ 1139 0055 49       		.uleb128 0x49
+ 1140 0056 13       		.uleb128 0x13
+ 1141 0057 00       		.byte	0
+ 1142 0058 00       		.byte	0
+ 1143 0059 07       		.uleb128 0x7
+ 1144 005a 0D       		.uleb128 0xd
+ 1145 005b 00       		.byte	0
+ 1146 005c 03       		.uleb128 0x3
+ 1147 005d 0E       		.uleb128 0xe
+ 1148 005e 3A       		.uleb128 0x3a
+ 1149 005f 21       		.uleb128 0x21
+ 1150 0060 01       		.sleb128 1
+ 1151 0061 3B       		.uleb128 0x3b
+ 1152 0062 0B       		.uleb128 0xb
+ 1153 0063 39       		.uleb128 0x39
+ 1154 0064 0B       		.uleb128 0xb
+ 1155 0065 49       		.uleb128 0x49
+ 1156 0066 13       		.uleb128 0x13
+ 1157 0067 38       		.uleb128 0x38
+ 1158 0068 0B       		.uleb128 0xb
+ 1159 0069 00       		.byte	0
+ 1160 006a 00       		.byte	0
+ 1161 006b 08       		.uleb128 0x8
+ 1162 006c 0F       		.uleb128 0xf
+ 1163 006d 00       		.byte	0
+ 1164 006e 0B       		.uleb128 0xb
+ 1165 006f 21       		.uleb128 0x21
+ 1166 0070 08       		.sleb128 8
+ 1167 0071 49       		.uleb128 0x49
+ 1168 0072 13       		.uleb128 0x13
+ 1169 0073 00       		.byte	0
+ 1170 0074 00       		.byte	0
+ 1171 0075 09       		.uleb128 0x9
+ 1172 0076 01       		.uleb128 0x1
+ 1173 0077 01       		.byte	0x1
+ 1174 0078 49       		.uleb128 0x49
+ 1175 0079 13       		.uleb128 0x13
+ 1176 007a 01       		.uleb128 0x1
+ 1177 007b 13       		.uleb128 0x13
+ 1178 007c 00       		.byte	0
+ 1179 007d 00       		.byte	0
+ 1180 007e 0A       		.uleb128 0xa
+ 1181 007f 11       		.uleb128 0x11
+GAS LISTING /tmp/ccK8DYMt.s 			page 65
+
+
+ 1182 0080 01       		.byte	0x1
+ 1183 0081 25       		.uleb128 0x25
+ 1184 0082 0E       		.uleb128 0xe
+ 1185 0083 13       		.uleb128 0x13
+ 1186 0084 0B       		.uleb128 0xb
+ 1187 0085 03       		.uleb128 0x3
+ 1188 0086 1F       		.uleb128 0x1f
+ 1189 0087 1B       		.uleb128 0x1b
+ 1190 0088 1F       		.uleb128 0x1f
+ 1191 0089 10       		.uleb128 0x10
+ 1192 008a 17       		.uleb128 0x17
+ 1193 008b 00       		.byte	0
+ 1194 008c 00       		.byte	0
+ 1195 008d 0B       		.uleb128 0xb
+ 1196 008e 24       		.uleb128 0x24
+ 1197 008f 00       		.byte	0
+ 1198 0090 0B       		.uleb128 0xb
+ 1199 0091 0B       		.uleb128 0xb
+ 1200 0092 3E       		.uleb128 0x3e
+ 1201 0093 0B       		.uleb128 0xb
+ 1202 0094 03       		.uleb128 0x3
+ 1203 0095 08       		.uleb128 0x8
+ 1204 0096 00       		.byte	0
+ 1205 0097 00       		.byte	0
+ 1206 0098 0C       		.uleb128 0xc
+ 1207 0099 13       		.uleb128 0x13
+ 1208 009a 01       		.byte	0x1
+ 1209 009b 0B       		.uleb128 0xb
+ 1210 009c 0B       		.uleb128 0xb
+ 1211 009d 3A       		.uleb128 0x3a
+ 1212 009e 0B       		.uleb128 0xb
+ 1213 009f 3B       		.uleb128 0x3b
+ 1214 00a0 0B       		.uleb128 0xb
+ 1215 00a1 39       		.uleb128 0x39
+ 1216 00a2 0B       		.uleb128 0xb
+ 1217 00a3 01       		.uleb128 0x1
+ 1218 00a4 13       		.uleb128 0x13
+ 1219 00a5 00       		.byte	0
+ 1220 00a6 00       		.byte	0
+ 1221 00a7 0D       		.uleb128 0xd
+ 1222 00a8 21       		.uleb128 0x21
+ 1223 00a9 00       		.byte	0
+ 1224 00aa 49       		.uleb128 0x49
+ 1225 00ab 13       		.uleb128 0x13
+ 1226 00ac 2F       		.uleb128 0x2f
+ 1227 00ad 0B       		.uleb128 0xb
+ 1228 00ae 00       		.byte	0
+ 1229 00af 00       		.byte	0
+ 1230 00b0 0E       		.uleb128 0xe
+ 1231 00b1 21       		.uleb128 0x21
+ 1232 00b2 00       		.byte	0
+ 1233 00b3 49       		.uleb128 0x49
+ 1234 00b4 13       		.uleb128 0x13
+ 1235 00b5 2F       		.uleb128 0x2f
+ 1236 00b6 05       		.uleb128 0x5
+ 1237 00b7 00       		.byte	0
+ 1238 00b8 00       		.byte	0
+GAS LISTING /tmp/ccK8DYMt.s 			page 66
+
+
+ 1239 00b9 00       		.byte	0
+ 1240              		.section	.debug_aranges,"",@progbits
+ 1241 0000 1C000000 		.long	0x1c
+ 1242 0004 0200     		.value	0x2
+ 1243 0006 00000000 		.long	.Ldebug_info0
+ 1244 000a 08       		.byte	0x8
+ 1245 000b 00       		.byte	0
+ 1246 000c 0000     		.value	0
+ 1247 000e 0000     		.value	0
+ 1248 0010 00000000 		.quad	0
+ 1248      00000000 
+ 1249 0018 00000000 		.quad	0
+ 1249      00000000 
+ 1250              		.section	.debug_line,"",@progbits
+ 1251              	.Ldebug_line0:
+ 1252 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1252      05000800 
+ 1252      49000000 
+ 1252      010101FB 
+ 1252      0E0D0001 
+ 1253              	.LASF20:
+ 1254 0000 736F6674 		.string	"soft_data"
+ 1254      5F646174 
+ 1254      6100
+ 1255              	.LASF12:
+ 1256 000a 73697A65 		.string	"size_t"
+ 1256      5F7400
+ 1257              	.LASF13:
+ 1258 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1258      6D61705F 
+ 1258      636F6C6F 
+ 1258      72736368 
+ 1258      656D655F 
+ 1259              	.LASF17:
+ 1260 0027 68656174 		.string	"heatmap_cs_Blues_mixed_exp"
+ 1260      6D61705F 
+ 1260      63735F42 
+ 1260      6C756573 
+ 1260      5F6D6978 
+ 1261              	.LASF26:
+ 1262 0042 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1262      43313720 
+ 1262      31322E32 
+ 1262      2E30202D 
+ 1262      6D74756E 
+ 1263              	.LASF6:
+ 1264 00a1 666C6F61 		.string	"float"
+ 1264      7400
+ 1265              	.LASF14:
+ 1266 00a7 68656174 		.string	"heatmap_cs_Blues_discrete"
+ 1266      6D61705F 
+ 1266      63735F42 
+ 1266      6C756573 
+ 1266      5F646973 
+ 1267              	.LASF11:
+ 1268 00c1 756E7369 		.string	"unsigned char"
+ 1268      676E6564 
+GAS LISTING /tmp/ccK8DYMt.s 			page 67
+
+
+ 1268      20636861 
+ 1268      7200
+ 1269              	.LASF3:
+ 1270 00cf 6C6F6E67 		.string	"long unsigned int"
+ 1270      20756E73 
+ 1270      69676E65 
+ 1270      6420696E 
+ 1270      7400
+ 1271              	.LASF8:
+ 1272 00e1 73686F72 		.string	"short unsigned int"
+ 1272      7420756E 
+ 1272      7369676E 
+ 1272      65642069 
+ 1272      6E7400
+ 1273              	.LASF25:
+ 1274 00f4 6D697865 		.string	"mixed_exp"
+ 1274      645F6578 
+ 1274      7000
+ 1275              	.LASF16:
+ 1276 00fe 68656174 		.string	"heatmap_cs_Blues_mixed"
+ 1276      6D61705F 
+ 1276      63735F42 
+ 1276      6C756573 
+ 1276      5F6D6978 
+ 1277              	.LASF23:
+ 1278 0115 6D697865 		.string	"mixed"
+ 1278      6400
+ 1279              	.LASF21:
+ 1280 011b 736F6674 		.string	"soft"
+ 1280      00
+ 1281              	.LASF7:
+ 1282 0120 756E7369 		.string	"unsigned int"
+ 1282      676E6564 
+ 1282      20696E74 
+ 1282      00
+ 1283              	.LASF19:
+ 1284 012d 64697363 		.string	"discrete"
+ 1284      72657465 
+ 1284      00
+ 1285              	.LASF10:
+ 1286 0136 6E636F6C 		.string	"ncolors"
+ 1286      6F727300 
+ 1287              	.LASF4:
+ 1288 013e 6C6F6E67 		.string	"long long int"
+ 1288      206C6F6E 
+ 1288      6720696E 
+ 1288      7400
+ 1289              	.LASF24:
+ 1290 014c 6D697865 		.string	"mixed_exp_data"
+ 1290      645F6578 
+ 1290      705F6461 
+ 1290      746100
+ 1291              	.LASF22:
+ 1292 015b 6D697865 		.string	"mixed_data"
+ 1292      645F6461 
+ 1292      746100
+ 1293              	.LASF2:
+GAS LISTING /tmp/ccK8DYMt.s 			page 68
+
+
+ 1294 0166 6C6F6E67 		.string	"long int"
+ 1294      20696E74 
+ 1294      00
+ 1295              	.LASF5:
+ 1296 016f 6C6F6E67 		.string	"long double"
+ 1296      20646F75 
+ 1296      626C6500 
+ 1297              	.LASF18:
+ 1298 017b 64697363 		.string	"discrete_data"
+ 1298      72657465 
+ 1298      5F646174 
+ 1298      6100
+ 1299              	.LASF15:
+ 1300 0189 68656174 		.string	"heatmap_cs_Blues_soft"
+ 1300      6D61705F 
+ 1300      63735F42 
+ 1300      6C756573 
+ 1300      5F736F66 
+ 1301              	.LASF9:
+ 1302 019f 636F6C6F 		.string	"colors"
+ 1302      727300
+ 1303              		.section	.debug_line_str,"MS",@progbits,1
+ 1304              	.LASF1:
+ 1305 0000 2F726F6F 		.string	"/root/repo"
+ 1305      742F7265 
+ 1305      706F00
+ 1306              	.LASF0:
+ 1307 000b 636F6C6F 		.string	"colorschemes/Blues.c"
+ 1307      72736368 
+ 1307      656D6573 
+ 1307      2F426C75 
+ 1307      65732E63 
+ 1308              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1309 0020 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1309      742F7265 
+ 1309      706F0063 
+ 1309      6F6C6F72 
+ 1309      73636865 
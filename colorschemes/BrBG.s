@@ -0,0 +1,3858 @@
+GAS LISTING /tmp/cc60kbk9.s 			page 1
+
+
+   1              		.file	"BrBG.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/BrBG.c"
+   5              		.globl	heatmap_cs_BrBG_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_BrBG_mixed_exp, @object
+   9              		.size	heatmap_cs_BrBG_mixed_exp, 8
+  10              	heatmap_cs_BrBG_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 00       		.string	""
+  29 0005 3C2F00   		.string	"</"
+  30 0008 00       		.string	""
+  31 0009 3F331800 		.string	"?3\030"
+  32 000d 42363100 		.string	"B61"
+  33 0011 45394A00 		.string	"E9J"
+  34 0015 483D6300 		.string	"H=c"
+  35 0019 4B407C00 		.string	"K@|"
+  36 001d 574D9501 		.ascii	"WM\225\001ZP\256\001]T\307\001`W\340\001c[\371\002f^\377\007"
+  36      5A50AE01 
+  36      5D54C701 
+  36      6057E001 
+  36      635BF902 
+  37 0035 6A62FF0C 		.ascii	"jb\377\fme\377\020ph\377\023tl\377\027wo\377$\204|\377(\207\177"
+  37      6D65FF10 
+  37      7068FF13 
+  37      746CFF17 
+  37      776FFF24 
+  38 004f FF2A8B83 		.ascii	"\377*\213\203\377-\216\206\3770\221\211\3773\225\215\3777\230"
+  38      FF2D8E86 
+  38      FF309189 
+  38      FF33958D 
+  38      FF3798
+  39 0062 90FF3C9B 		.ascii	"\220\377<\233\223\377A\237\226\377F\242\231\377K\245\234\377"
+  39      93FF419F 
+  39      96FF46A2 
+  39      99FF4BA5 
+GAS LISTING /tmp/cc60kbk9.s 			page 2
+
+
+  39      9CFF
+  40 0074 4FA89FFF 		.ascii	"O\250\237\377T\254\242\377g\272\257\377l\275\262\377p\300\265"
+  40      54ACA2FF 
+  40      67BAAFFF 
+  40      6CBDB2FF 
+  40      70C0B5
+  41 0087 FF74C3B8 		.ascii	"\377t\303\270\377x\307\273\377|\312\276\377\200\315\301\377\204"
+  41      FF78C7BB 
+  41      FF7CCABE 
+  41      FF80CDC1 
+  41      FF84
+  42 0099 CEC3FF88 		.ascii	"\316\303\377\210\320\305\377\214\322\307\377\220\323\311\377"
+  42      D0C5FF8C 
+  42      D2C7FF90 
+  42      D3C9FF
+  43 00a8 94D5CBFF 		.ascii	"\224\325\313\377\230\326\315\377\234\330\317\377\256\337\330"
+  43      98D6CDFF 
+  43      9CD8CFFF 
+  43      AEDFD8
+  44 00b7 FFB1E1DA 		.ascii	"\377\261\341\332\377\265\342\334\377\271\344\335\377\274\345"
+  44      FFB5E2DC 
+  44      FFB9E4DD 
+  44      FFBCE5
+  45 00c6 DFFFC0E7 		.ascii	"\337\377\300\347\341\377\303\350\343\377\360\335\343\377\356"
+  45      E1FFC3E8 
+  45      E3FFF0DD 
+  45      E3FFEE
+  46 00d5 DFE7FFEC 		.ascii	"\337\347\377\354\341\353\377\351\342\356\377\347\344\360\377"
+  46      E1EBFFE9 
+  46      E2EEFFE7 
+  46      E4F0FF
+  47 00e4 E5E6F2FF 		.ascii	"\345\346\362\377\343\350\363\377\341\351\363\377\340\353\363"
+  47      E3E8F3FF 
+  47      E1E9F3FF 
+  47      E0EBF3
+  48 00f3 FFE9EEF6 		.ascii	"\377\351\356\366\377\351\357\366\377\351\360\366\377\353\361"
+  48      FFE9EFF6 
+  48      FFE9F0F6 
+  48      FFEBF1
+  49 0102 F5FFECF2 		.ascii	"\365\377\354\362\364\377\356\363\364\377\357\363\364\377\361"
+  49      F4FFEEF3 
+  49      F4FFEFF3 
+  49      F4FFF1
+  50 0111 F4F4FFF3 		.ascii	"\364\364\377\363\364\364\377\365\364\364\377\366\363\364\377"
+  50      F4F4FFF5 
+  50      F4F4FFF6 
+  50      F3F4FF
+  51 0120 F8F2F3FF 		.ascii	"\370\362\363\377\371\361\361\377\372\360\360\377\373\357\356"
+  51      F9F1F1FF 
+  51      FAF0F0FF 
+  51      FBEFEE
+  52 012f FFFCEEEC 		.ascii	"\377\374\356\354\377\375\355\352\377\375\355\350\377\375\354"
+  52      FFFDEDEA 
+  52      FFFDEDE8 
+  52      FFFDEC
+  53 013e E6FFFDE9 		.ascii	"\346\377\375\351\332\377\375\350\327\377\375\350\325\377\375"
+  53      DAFFFDE8 
+GAS LISTING /tmp/cc60kbk9.s 			page 3
+
+
+  53      D7FFFDE8 
+  53      D5FFFD
+  54 014d E8D3FFFD 		.ascii	"\350\323\377\375\347\320\377\375\347\316\377\375\347\314\377"
+  54      E7D0FFFD 
+  54      E7CEFFFD 
+  54      E7CCFF
+  55 015c FCE7CAFF 		.ascii	"\374\347\312\377\372\347\307\377\371\347\305\377\367\347\304"
+  55      FAE7C7FF 
+  55      F9E7C5FF 
+  55      F7E7C4
+  56 016b FFF5E7C2 		.ascii	"\377\365\347\302\377\364\346\277\377\364\344\275\377\363\343"
+  56      FFF4E6BF 
+  56      FFF4E4BD 
+  56      FFF3E3
+  57 017a BAFFF2E2 		.ascii	"\272\377\362\342\270\377\361\341\266\377\361\340\264\377\360"
+  57      B8FFF1E1 
+  57      B6FFF1E0 
+  57      B4FFF0
+  58 0189 DEB1FFEF 		.ascii	"\336\261\377\357\335\257\377\356\334\255\377\356\333\253\377"
+  58      DDAFFFEE 
+  58      DCADFFEE 
+  58      DBABFF
+  59 0198 EDDAA9FF 		.ascii	"\355\332\251\377\354\330\246\377\347\320\226\377\346\316\224"
+  59      ECD8A6FF 
+  59      E7D096FF 
+  59      E6CE94
+  60 01a7 FFE6CD92 		.ascii	"\377\346\315\222\377\345\314\220\377\344\313\216\377\344\312"
+  60      FFE5CC90 
+  60      FFE4CB8E 
+  60      FFE4CA
+  61 01b6 8CFFE3C9 		.ascii	"\214\377\343\311\212\377\342\310\210\377\342\307\206\377\341"
+  61      8AFFE2C8 
+  61      88FFE2C7 
+  61      86FFE1
+  62 01c5 C684FFE0 		.ascii	"\306\204\377\340\305\202\377\340\304\200\377\337\303\177\377"
+  62      C582FFE0 
+  62      C480FFDF 
+  62      C37FFF
+  63 01d4 DFC27DFF 		.ascii	"\337\302}\377\336\301{\377\336\301y\377\335\301w\377\335\301"
+  63      DEC17BFF 
+  63      DEC179FF 
+  63      DDC177FF 
+  63      DDC1
+  64 01e6 75FFDDC1 		.ascii	"u\377\335\301s\377\334\301q\377\334\301p\377\333\301n\377\332"
+  64      73FFDCC1 
+  64      71FFDCC1 
+  64      70FFDBC1 
+  64      6EFFDA
+  65 01f9 C16CFFDA 		.ascii	"\301l\377\332\301j\377\331\301h\377\331\301g\377\330\301e\377"
+  65      C16AFFD9 
+  65      C168FFD9 
+  65      C167FFD8 
+  65      C165FF
+  66 020c D7C163FF 		.ascii	"\327\301c\377\327\301a\377\326\301`\377\317\301N\377\316\301"
+  66      D7C161FF 
+  66      D6C160FF 
+  66      CFC14EFF 
+GAS LISTING /tmp/cc60kbk9.s 			page 4
+
+
+  66      CEC1
+  67 021e 4CFFCDC1 		.ascii	"L\377\315\301J\377\315\301I\377\314\301G\377\313\301E\377\312"
+  67      4AFFCDC1 
+  67      49FFCCC1 
+  67      47FFCBC1 
+  67      45FFCA
+  68 0231 C144FFC9 		.ascii	"\301D\377\311\301B\377\311\301@\377\310\301>\377\307\301=\377"
+  68      C142FFC9 
+  68      C140FFC8 
+  68      C13EFFC7 
+  68      C13DFF
+  69 0244 C6C13BFF 		.ascii	"\306\301;\377\305\3019\377\304\3018\377\303\3016\377\302\301"
+  69      C5C139FF 
+  69      C4C138FF 
+  69      C3C136FF 
+  69      C2C1
+  70 0256 34FFC1C1 		.ascii	"4\377\301\3012\377\301\3011\377\300\301/\377\277\301-\377\276"
+  70      32FFC1C1 
+  70      31FFC0C1 
+  70      2FFFBFC1 
+  70      2DFFBE
+  71 0269 C02BFFBE 		.ascii	"\300+\377\276\276*\377\275\273)\377\275\271'\377\275\267&\377"
+  71      BE2AFFBD 
+  71      BB29FFBD 
+  71      B927FFBD 
+  71      B726FF
+  72 027c BCB525FF 		.ascii	"\274\265%\377\274\263#\377\273\261\"\377\273\257!\377\272\255"
+  72      BCB323FF 
+  72      BBB122FF 
+  72      BBAF21FF 
+  72      BAAD
+  73 028e 20FFB9AB 		.ascii	" \377\271\253\037\377\271\251\036\377\270\247\035\377\270\245"
+  73      1FFFB9A9 
+  73      1EFFB8A7 
+  73      1DFFB8A5 
+  74 029e 1CFFB7A3 		.ascii	"\034\377\267\243\033\377\266\241\033\377\266\240\032\377\265"
+  74      1BFFB6A1 
+  74      1BFFB6A0 
+  74      1AFFB5
+  75 02ad 9E19FFB4 		.ascii	"\236\031\377\264\234\030\377\264\232\030\377\263\231\027\377"
+  75      9C18FFB4 
+  75      9A18FFB3 
+  75      9917FF
+  76 02bc B29717FF 		.ascii	"\262\227\027\377\261\225\026\377\261\224\026\377\246{\016\377"
+  76      B19516FF 
+  76      B19416FF 
+  76      A67B0EFF 
+  77 02cc A57A0EFF 		.ascii	"\245z\016\377\244x\r\377\244w\r\377\243u\f\377\242t\f\377\241"
+  77      A4780DFF 
+  77      A4770DFF 
+  77      A3750CFF 
+  77      A2740CFF 
+  78 02e1 720CFFA0 		.ascii	"r\f\377\240q\f\377\240o\013\377\237n\013\377\236l\013\377\235"
+  78      710CFFA0 
+  78      6F0BFF9F 
+  78      6E0BFF9E 
+  78      6C0BFF9D 
+GAS LISTING /tmp/cc60kbk9.s 			page 5
+
+
+  79 02f5 6B0BFF9D 		.ascii	"k\013\377\235j\013\377\234h\n\377\233g\n\377\232f\n\377\231d"
+  79      6A0BFF9C 
+  79      680AFF9B 
+  79      670AFF9A 
+  79      660AFF99 
+  80 030a 0AFF9963 		.ascii	"\n\377\231c\n\377\230b\n\377\227a\n\377\226_\n\377\225^\n\377"
+  80      0AFF9862 
+  80      0AFF9761 
+  80      0AFF965F 
+  80      0AFF955E 
+  81 0320 955D0AFF 		.ascii	"\225]\n\377\224\\\n\377\223[\n\377\222Z\n\377\221X\n\377\221"
+  81      945C0AFF 
+  81      935B0AFF 
+  81      925A0AFF 
+  81      91580AFF 
+  82 0335 570AFF90 		.ascii	"W\n\377\220V\n\377\217U\n\377\216T\n\377\216S\n\377\215R\n\377"
+  82      560AFF8F 
+  82      550AFF8E 
+  82      540AFF8E 
+  82      530AFF8D 
+  83 034c 8C510AFF 		.ascii	"\214Q\n\377\213P\t\377\213P\t\377\212P\t\377\212O\t\377\211O"
+  83      8B5009FF 
+  83      8B5009FF 
+  83      8A5009FF 
+  83      8A4F09FF 
+  84 0362 09FF884F 		.ascii	"\t\377\210O\t\377\210N\t\377\207N\t\377\207N\t\377\206N\t\377"
+  84      09FF884E 
+  84      09FF874E 
+  84      09FF874E 
+  84      09FF864E 
+  85 0378 864D09FF 		.ascii	"\206M\t\377\205M\t\377\205M\t\377\204L\t\377\204L\t\377\203L"
+  85      854D09FF 
+  85      854D09FF 
+  85      844C09FF 
+  85      844C09FF 
+  86 038e 09FF834B 		.ascii	"\t\377\203K\t\377\202K\t\377\202K\t\377\202K\t\377\201J\t\377"
+  86      09FF824B 
+  86      09FF824B 
+  86      09FF824B 
+  86      09FF814A 
+  87 03a4 814A09FF 		.ascii	"\201J\t\377\200J\t\377\200J\t\377\177I\t\377\177I\t\377~I\t\377"
+  87      804A09FF 
+  87      804A09FF 
+  87      7F4909FF 
+  87      7F4909FF 
+  88 03bc 7E4909FF 		.ascii	"~I\t\377~H\b\377}H\b\377}H\b\377|H\b\377|G\b\377|G\b\377{G\b"
+  88      7E4808FF 
+  88      7D4808FF 
+  88      7D4808FF 
+  88      7C4808FF 
+  89 03db FF7B4708 		.ascii	"\377{G\b\377{G\b\377zF\b\377zF\b\377yF\b\377yF\b\377yF\b\377"
+  89      FF7B4708 
+  89      FF7A4608 
+  89      FF7A4608 
+  89      FF794608 
+  90 03f8 784508FF 		.ascii	"xE\b\377xE\b\377xE\b\377wE\b\377wE\b\377wD\b\377vD\b\377vD\b"
+  90      784508FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 6
+
+
+  90      784508FF 
+  90      774508FF 
+  90      774508FF 
+  91 0417 FF764408 		.ascii	"\377vD\b\377uD\b\377uC\b\377uC\b\377uC\b\377i<\007\377i<\007"
+  91      FF754408 
+  91      FF754308 
+  91      FF754308 
+  91      FF754308 
+  92 0433 FF683C07 		.ascii	"\377h<\007\377h<\007\377h<\007\377h;\007\377g;\007\377g;\007"
+  92      FF683C07 
+  92      FF683C07 
+  92      FF683B07 
+  92      FF673B07 
+  93 044b FF673B07 		.ascii	"\377g;\007\377g;\007\377f;\007\377f;\007\377f:\007\377f:\007"
+  93      FF673B07 
+  93      FF663B07 
+  93      FF663B07 
+  93      FF663A07 
+  94 0463 FF653A07 		.ascii	"\377e:\007\377e:\007\377e:\007\377e:\007\377d:\006\377d9\006"
+  94      FF653A07 
+  94      FF653A07 
+  94      FF653A07 
+  94      FF643A06 
+  95 047b FF643906 		.ascii	"\377d9\006\377d9\006\377c9\006\377c9\006\377c9\006\377c9\006"
+  95      FF643906 
+  95      FF633906 
+  95      FF633906 
+  95      FF633906 
+  96 0493 FF633806 		.ascii	"\377c8\006\377b8\006\377b8\006\377b8\006\377b8\006\377b8\006"
+  96      FF623806 
+  96      FF623806 
+  96      FF623806 
+  96      FF623806 
+  97 04ab FF613806 		.ascii	"\377a8\006\377a8\006\377a8\006\377a7\006\377a7\006\377`7\006"
+  97      FF613806 
+  97      FF613806 
+  97      FF613706 
+  97      FF613706 
+  98 04c3 FF603706 		.ascii	"\377`7\006\377`7\006\377`7\006\377`7\006\377`7\006\377_7\006"
+  98      FF603706 
+  98      FF603706 
+  98      FF603706 
+  98      FF603706 
+  99 04db FF5F3606 		.ascii	"\377_6\006\377_6\006\377_6\006\377_6\006\377_6\006\377^6\006"
+  99      FF5F3606 
+  99      FF5F3606 
+  99      FF5F3606 
+  99      FF5F3606 
+ 100 04f3 FF5E3606 		.ascii	"\377^6\006\377^6\006\377^6\006\377^6\006\377^6\006\377]5\006"
+ 100      FF5E3606 
+ 100      FF5E3606 
+ 100      FF5E3606 
+ 100      FF5E3606 
+ 101 050b FF5D3506 		.ascii	"\377]5\006\377]5\006\377]5\006\377]5\006\377]5\006\377]5\006"
+ 101      FF5D3506 
+ 101      FF5D3506 
+ 101      FF5D3506 
+GAS LISTING /tmp/cc60kbk9.s 			page 7
+
+
+ 101      FF5D3506 
+ 102 0523 FF5D3506 		.ascii	"\377]5\006\377\\5\006\377\\5\006\377\\5\006\377\\5\006\377\\"
+ 102      FF5C3506 
+ 102      FF5C3506 
+ 102      FF5C3506 
+ 102      FF5C3506 
+ 103 0539 3506FF5C 		.ascii	"5\006\377\\4\006\377\\4\006\377\\4\006\377[4\006\377[4\006\377"
+ 103      3406FF5C 
+ 103      3406FF5C 
+ 103      3406FF5B 
+ 103      3406FF5B 
+ 104 0550 5B3406FF 		.ascii	"[4\006\377[4\006\377[4\006\377[4\006\377[4\006\377[4\006\377"
+ 104      5B3406FF 
+ 104      5B3406FF 
+ 104      5B3406FF 
+ 104      5B3406FF 
+ 105 0568 5B3406FF 		.ascii	"[4\006\377Z4\006\377Z4\006\377Z4\006\377Z3\006\377Z3\006\377"
+ 105      5A3406FF 
+ 105      5A3406FF 
+ 105      5A3406FF 
+ 105      5A3306FF 
+ 106 0580 5A3306FF 		.ascii	"Z3\006\377Z3\006\377Z3\006\377Z3\005\377Z3\005\377Y3\005\377"
+ 106      5A3306FF 
+ 106      5A3306FF 
+ 106      5A3305FF 
+ 106      5A3305FF 
+ 107 0598 593305FF 		.ascii	"Y3\005\377Y3\005\377Y3\005\377Y3\005\377Y3\005\377Y3\005\377"
+ 107      593305FF 
+ 107      593305FF 
+ 107      593305FF 
+ 107      593305FF 
+ 108 05b0 593305FF 		.ascii	"Y3\005\377Y3\005\377Y3\005\377Y3\005\377Y3\005\377X2\005\377"
+ 108      593305FF 
+ 108      593305FF 
+ 108      593305FF 
+ 108      593305FF 
+ 109 05c8 583205FF 		.ascii	"X2\005\377X2\005\377X2\005\377X2\005\377X2\005\377X2\005\377"
+ 109      583205FF 
+ 109      583205FF 
+ 109      583205FF 
+ 109      583205FF 
+ 110 05e0 583205FF 		.ascii	"X2\005\377X2\005\377X2\005\377X2\005\377X2\005\377X2\005\377"
+ 110      583205FF 
+ 110      583205FF 
+ 110      583205FF 
+ 110      583205FF 
+ 111 05f8 583205FF 		.ascii	"X2\005\377W2\005\377W2\005\377W2\005\377W2\005\377W2\005\377"
+ 111      573205FF 
+ 111      573205FF 
+ 111      573205FF 
+ 111      573205FF 
+ 112 0610 573205FF 		.ascii	"W2\005\377W2\005\377W2\005\377W2\005\377W2\005\377W2\005\377"
+ 112      573205FF 
+ 112      573205FF 
+ 112      573205FF 
+ 112      573205FF 
+ 113 0628 573205FF 		.ascii	"W2\005\377W1\005\377W1\005\377W1\005\377W1\005\377W1\005\377"
+GAS LISTING /tmp/cc60kbk9.s 			page 8
+
+
+ 113      573105FF 
+ 113      573105FF 
+ 113      573105FF 
+ 113      573105FF 
+ 114 0640 573105FF 		.ascii	"W1\005\377V1\005\377V1\005\377V1\005\377V1\005\377V1\005\377"
+ 114      563105FF 
+ 114      563105FF 
+ 114      563105FF 
+ 114      563105FF 
+ 115 0658 563105FF 		.ascii	"V1\005\377V1\005\377V1\005\377V1\005\377V1\005\377V1\005\377"
+ 115      563105FF 
+ 115      563105FF 
+ 115      563105FF 
+ 115      563105FF 
+ 116 0670 563105FF 		.ascii	"V1\005\377V1\005\377V1\005\377V1\005\377V1\005\377V1\005\377"
+ 116      563105FF 
+ 116      563105FF 
+ 116      563105FF 
+ 116      563105FF 
+ 117 0688 563105FF 		.ascii	"V1\005\377V1\005\377V1\005\377V1\005\377V1\005\377V1\005\377"
+ 117      563105FF 
+ 117      563105FF 
+ 117      563105FF 
+ 117      563105FF 
+ 118 06a0 563105FF 		.ascii	"V1\005\377V1\005\377U1\005\377U1\005\377U1\005\377U1\005\377"
+ 118      563105FF 
+ 118      553105FF 
+ 118      553105FF 
+ 118      553105FF 
+ 119 06b8 553105FF 		.ascii	"U1\005\377U1\005\377U1\005\377U1\005\377U1\005\377U1\005\377"
+ 119      553105FF 
+ 119      553105FF 
+ 119      553105FF 
+ 119      553105FF 
+ 120 06d0 553105FF 		.ascii	"U1\005\377U0\005\377U0\005\377U0\005\377U0\005\377U0\005\377"
+ 120      553005FF 
+ 120      553005FF 
+ 120      553005FF 
+ 120      553005FF 
+ 121 06e8 553005FF 		.ascii	"U0\005\377U0\005\377U0\005\377U0\005\377U0\005\377U0\005\377"
+ 121      553005FF 
+ 121      553005FF 
+ 121      553005FF 
+ 121      553005FF 
+ 122 0700 553005FF 		.ascii	"U0\005\377U0\005\377U0\005\377U0\005\377U0\005\377U0\005\377"
+ 122      553005FF 
+ 122      553005FF 
+ 122      553005FF 
+ 122      553005FF 
+ 123 0718 553005FF 		.ascii	"U0\005\377U0\005\377U0\005\377U0\005\377U0\005\377U0\005\377"
+ 123      553005FF 
+ 123      553005FF 
+ 123      553005FF 
+ 123      553005FF 
+ 124 0730 553005FF 		.ascii	"U0\005\377U0\005\377U0\005\377U0\005\377U0\005\377U0\005\377"
+ 124      553005FF 
+ 124      553005FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 9
+
+
+ 124      553005FF 
+ 124      553005FF 
+ 125 0748 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 125      543005FF 
+ 125      543005FF 
+ 125      543005FF 
+ 125      543005FF 
+ 126 0760 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 126      543005FF 
+ 126      543005FF 
+ 126      543005FF 
+ 126      543005FF 
+ 127 0778 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 127      543005FF 
+ 127      543005FF 
+ 127      543005FF 
+ 127      543005FF 
+ 128 0790 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 128      543005FF 
+ 128      543005FF 
+ 128      543005FF 
+ 128      543005FF 
+ 129 07a8 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 129      543005FF 
+ 129      543005FF 
+ 129      543005FF 
+ 129      543005FF 
+ 130 07c0 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377"
+ 130      543005FF 
+ 130      543005FF 
+ 130      543005FF 
+ 131 07d0 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 131      543005FF 
+ 131      543005FF 
+ 131      543005FF 
+ 131      543005FF 
+ 132 07e8 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 132      543005FF 
+ 132      543005FF 
+ 132      543005FF 
+ 132      543005FF 
+ 133 0800 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 133      543005FF 
+ 133      543005FF 
+ 133      543005FF 
+ 133      543005FF 
+ 134 0818 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 134      543005FF 
+ 134      543005FF 
+ 134      543005FF 
+ 134      543005FF 
+ 135 0830 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 135      543005FF 
+ 135      543005FF 
+ 135      543005FF 
+ 135      543005FF 
+ 136 0848 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+GAS LISTING /tmp/cc60kbk9.s 			page 10
+
+
+ 136      543005FF 
+ 136      543005FF 
+ 136      543005FF 
+ 136      543005FF 
+ 137 0860 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 137      543005FF 
+ 137      543005FF 
+ 137      543005FF 
+ 137      543005FF 
+ 138 0878 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 138      543005FF 
+ 138      543005FF 
+ 138      543005FF 
+ 138      543005FF 
+ 139 0890 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 139      543005FF 
+ 139      543005FF 
+ 139      543005FF 
+ 139      543005FF 
+ 140 08a8 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 140      543005FF 
+ 140      543005FF 
+ 140      543005FF 
+ 140      543005FF 
+ 141 08c0 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 141      543005FF 
+ 141      543005FF 
+ 141      543005FF 
+ 141      543005FF 
+ 142 08d8 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 142      543005FF 
+ 142      543005FF 
+ 142      543005FF 
+ 142      543005FF 
+ 143 08f0 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 143      543005FF 
+ 143      543005FF 
+ 143      543005FF 
+ 143      543005FF 
+ 144 0908 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 144      543005FF 
+ 144      543005FF 
+ 144      543005FF 
+ 144      543005FF 
+ 145 0920 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 145      543005FF 
+ 145      543005FF 
+ 145      543005FF 
+ 145      543005FF 
+ 146 0938 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 146      543005FF 
+ 146      543005FF 
+ 146      543005FF 
+ 146      543005FF 
+ 147 0950 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 147      543005FF 
+ 147      543005FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 11
+
+
+ 147      543005FF 
+ 147      543005FF 
+ 148 0968 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 148      543005FF 
+ 148      543005FF 
+ 148      543005FF 
+ 148      543005FF 
+ 149 0980 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 149      543005FF 
+ 149      543005FF 
+ 149      543005FF 
+ 149      543005FF 
+ 150 0998 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 150      543005FF 
+ 150      543005FF 
+ 150      543005FF 
+ 150      543005FF 
+ 151 09b0 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 151      543005FF 
+ 151      543005FF 
+ 151      543005FF 
+ 151      543005FF 
+ 152 09c8 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 152      543005FF 
+ 152      543005FF 
+ 152      543005FF 
+ 152      543005FF 
+ 153 09e0 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 153      543005FF 
+ 153      543005FF 
+ 153      543005FF 
+ 153      543005FF 
+ 154 09f8 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 154      543005FF 
+ 154      543005FF 
+ 154      543005FF 
+ 154      543005FF 
+ 155 0a10 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 155      543005FF 
+ 155      543005FF 
+ 155      543005FF 
+ 155      543005FF 
+ 156 0a28 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 156      543005FF 
+ 156      543005FF 
+ 156      543005FF 
+ 156      543005FF 
+ 157 0a40 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 157      543005FF 
+ 157      543005FF 
+ 157      543005FF 
+ 157      543005FF 
+ 158 0a58 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 158      543005FF 
+ 158      543005FF 
+ 158      543005FF 
+ 158      543005FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 12
+
+
+ 159 0a70 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 159      543005FF 
+ 159      543005FF 
+ 159      543005FF 
+ 159      543005FF 
+ 160 0a88 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 160      543005FF 
+ 160      543005FF 
+ 160      543005FF 
+ 160      543005FF 
+ 161 0aa0 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 161      543005FF 
+ 161      543005FF 
+ 161      543005FF 
+ 161      543005FF 
+ 162 0ab8 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 162      543005FF 
+ 162      543005FF 
+ 162      543005FF 
+ 162      543005FF 
+ 163 0ad0 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 163      543005FF 
+ 163      543005FF 
+ 163      543005FF 
+ 163      543005FF 
+ 164 0ae8 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 164      543005FF 
+ 164      543005FF 
+ 164      543005FF 
+ 164      543005FF 
+ 165 0b00 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 165      543005FF 
+ 165      543005FF 
+ 165      543005FF 
+ 165      543005FF 
+ 166 0b18 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 166      543005FF 
+ 166      543005FF 
+ 166      543005FF 
+ 166      543005FF 
+ 167 0b30 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 167      543005FF 
+ 167      543005FF 
+ 167      543005FF 
+ 167      543005FF 
+ 168 0b48 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 168      543005FF 
+ 168      543005FF 
+ 168      543005FF 
+ 168      543005FF 
+ 169 0b60 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 169      543005FF 
+ 169      543005FF 
+ 169      543005FF 
+ 169      543005FF 
+ 170 0b78 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 170      543005FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 13
+
+
+ 170      543005FF 
+ 170      543005FF 
+ 170      543005FF 
+ 171 0b90 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 171      543005FF 
+ 171      543005FF 
+ 171      543005FF 
+ 171      543005FF 
+ 172 0ba8 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 172      543005FF 
+ 172      543005FF 
+ 172      543005FF 
+ 172      543005FF 
+ 173 0bc0 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 173      543005FF 
+ 173      543005FF 
+ 173      543005FF 
+ 173      543005FF 
+ 174 0bd8 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 174      543005FF 
+ 174      543005FF 
+ 174      543005FF 
+ 174      543005FF 
+ 175 0bf0 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 175      543005FF 
+ 175      543005FF 
+ 175      543005FF 
+ 175      543005FF 
+ 176 0c08 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 176      543005FF 
+ 176      543005FF 
+ 176      543005FF 
+ 176      543005FF 
+ 177 0c20 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 177      543005FF 
+ 177      543005FF 
+ 177      543005FF 
+ 177      543005FF 
+ 178 0c38 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 178      543005FF 
+ 178      543005FF 
+ 178      543005FF 
+ 178      543005FF 
+ 179 0c50 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 179      543005FF 
+ 179      543005FF 
+ 179      543005FF 
+ 179      543005FF 
+ 180 0c68 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 180      543005FF 
+ 180      543005FF 
+ 180      543005FF 
+ 180      543005FF 
+ 181 0c80 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 181      543005FF 
+ 181      543005FF 
+ 181      543005FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 14
+
+
+ 181      543005FF 
+ 182 0c98 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 182      543005FF 
+ 182      543005FF 
+ 182      543005FF 
+ 182      543005FF 
+ 183 0cb0 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 183      543005FF 
+ 183      543005FF 
+ 183      543005FF 
+ 183      543005FF 
+ 184 0cc8 543005FF 		.ascii	"T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377T0\005\377"
+ 184      543005FF 
+ 184      543005FF 
+ 184      543005FF 
+ 184      543005FF 
+ 185 0ce0 543005FF 		.ascii	"T0\005\377T0\004\377T0\004\377T0\004\377T0\004\377T0\004\377"
+ 185      543004FF 
+ 185      543004FF 
+ 185      543004FF 
+ 185      543004FF 
+ 186 0cf8 543004FF 		.ascii	"T0\004\377T0\004\377T0\004\377T0\004\377T0\004\377T0\004\377"
+ 186      543004FF 
+ 186      543004FF 
+ 186      543004FF 
+ 186      543004FF 
+ 187 0d10 543004FF 		.ascii	"T0\004\377T0\004\377T0\004\377T0\004\377T0\004\377T0\004\377"
+ 187      543004FF 
+ 187      543004FF 
+ 187      543004FF 
+ 187      543004FF 
+ 188 0d28 543004FF 		.ascii	"T0\004\377T0\004\377T0\004\377T0\004\377T0\004\377T0\004\377"
+ 188      543004FF 
+ 188      543004FF 
+ 188      543004FF 
+ 188      543004FF 
+ 189 0d40 543004FF 		.ascii	"T0\004\377T0\004\377T0\004\377T0\004\377T0\004\377T0\004\377"
+ 189      543004FF 
+ 189      543004FF 
+ 189      543004FF 
+ 189      543004FF 
+ 190 0d58 543004FF 		.ascii	"T0\004\377T0\004\377T0\004\377T0\004\377T0\004\377S0\004\377"
+ 190      543004FF 
+ 190      543004FF 
+ 190      543004FF 
+ 190      543004FF 
+ 191 0d70 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 191      533004FF 
+ 191      533004FF 
+ 191      533004FF 
+ 191      533004FF 
+ 192 0d88 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 192      533004FF 
+ 192      533004FF 
+ 192      533004FF 
+ 192      533004FF 
+ 193 0da0 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+GAS LISTING /tmp/cc60kbk9.s 			page 15
+
+
+ 193      533004FF 
+ 193      533004FF 
+ 193      533004FF 
+ 193      533004FF 
+ 194 0db8 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 194      533004FF 
+ 194      533004FF 
+ 194      533004FF 
+ 194      533004FF 
+ 195 0dd0 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 195      533004FF 
+ 195      533004FF 
+ 195      533004FF 
+ 195      533004FF 
+ 196 0de8 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 196      533004FF 
+ 196      533004FF 
+ 196      533004FF 
+ 196      533004FF 
+ 197 0e00 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 197      533004FF 
+ 197      533004FF 
+ 197      533004FF 
+ 197      533004FF 
+ 198 0e18 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 198      533004FF 
+ 198      533004FF 
+ 198      533004FF 
+ 198      533004FF 
+ 199 0e30 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 199      533004FF 
+ 199      533004FF 
+ 199      533004FF 
+ 199      533004FF 
+ 200 0e48 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 200      533004FF 
+ 200      533004FF 
+ 200      533004FF 
+ 200      533004FF 
+ 201 0e60 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 201      533004FF 
+ 201      533004FF 
+ 201      533004FF 
+ 201      533004FF 
+ 202 0e78 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 202      533004FF 
+ 202      533004FF 
+ 202      533004FF 
+ 202      533004FF 
+ 203 0e90 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 203      533004FF 
+ 203      533004FF 
+ 203      533004FF 
+ 203      533004FF 
+ 204 0ea8 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 204      533004FF 
+ 204      533004FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 16
+
+
+ 204      533004FF 
+ 204      533004FF 
+ 205 0ec0 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 205      533004FF 
+ 205      533004FF 
+ 205      533004FF 
+ 205      533004FF 
+ 206 0ed8 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 206      533004FF 
+ 206      533004FF 
+ 206      533004FF 
+ 206      533004FF 
+ 207 0ef0 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 207      533004FF 
+ 207      533004FF 
+ 207      533004FF 
+ 207      533004FF 
+ 208 0f08 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 208      533004FF 
+ 208      533004FF 
+ 208      533004FF 
+ 208      533004FF 
+ 209 0f20 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 209      533004FF 
+ 209      533004FF 
+ 209      533004FF 
+ 209      533004FF 
+ 210 0f38 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 210      533004FF 
+ 210      533004FF 
+ 210      533004FF 
+ 210      533004FF 
+ 211 0f50 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 211      533004FF 
+ 211      533004FF 
+ 211      533004FF 
+ 211      533004FF 
+ 212 0f68 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 212      533004FF 
+ 212      533004FF 
+ 212      533004FF 
+ 212      533004FF 
+ 213 0f80 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 213      533004FF 
+ 213      533004FF 
+ 213      533004FF 
+ 213      533004FF 
+ 214 0f98 533004FF 		.ascii	"S0\004\377S0\004\377"
+ 214      533004FF 
+ 215 0fa0 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 215      533004FF 
+ 215      533004FF 
+ 215      533004FF 
+ 215      533004FF 
+ 216 0fb8 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 216      533004FF 
+ 216      533004FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 17
+
+
+ 216      533004FF 
+ 216      533004FF 
+ 217 0fd0 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 217      533004FF 
+ 217      533004FF 
+ 217      533004FF 
+ 217      533004FF 
+ 218 0fe8 533004FF 		.ascii	"S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377S0\004\377"
+ 218      533004FF 
+ 218      533004FF 
+ 218      533004FF 
+ 218      533004FF 
+ 219 1000 533004FF 		.ascii	"S0\004\377"
+ 220              		.globl	heatmap_cs_BrBG_mixed
+ 221              		.section	.data.rel.local
+ 222              		.align 8
+ 223              		.type	heatmap_cs_BrBG_mixed, @object
+ 224              		.size	heatmap_cs_BrBG_mixed, 8
+ 225              	heatmap_cs_BrBG_mixed:
+ 226 0008 00000000 		.quad	mixed
+ 226      00000000 
+ 227              		.section	.data.rel.ro.local
+ 228              		.align 16
+ 229              		.type	mixed, @object
+ 230              		.size	mixed, 16
+ 231              	mixed:
+ 232 0010 00000000 		.quad	mixed_data
+ 232      00000000 
+ 233 0018 01040000 		.quad	1025
+ 233      00000000 
+ 234              		.section	.rodata
+ 235 1004 00000000 		.align 32
+ 235      00000000 
+ 235      00000000 
+ 235      00000000 
+ 235      00000000 
+ 236              		.type	mixed_data, @object
+ 237              		.size	mixed_data, 4100
+ 238              	mixed_data:
+ 239 1020 00       		.string	""
+ 240 1021 00       		.string	""
+ 241 1022 00       		.string	""
+ 242 1023 00       		.string	""
+ 243 1024 00       		.string	""
+ 244 1025 3C2F00   		.string	"</"
+ 245 1028 00       		.string	""
+ 246 1029 3C300700 		.string	"<0\007"
+ 247 102d 3C300E00 		.string	"<0\016"
+ 248 1031 3C301600 		.string	"<0\026"
+ 249 1035 3D311D00 		.string	"=1\035"
+ 250 1039 3D312500 		.string	"=1%"
+ 251 103d 3D312C00 		.string	"=1,"
+ 252 1041 3E323400 		.string	">24"
+ 253 1045 3E323B00 		.string	">2;"
+ 254 1049 3E324300 		.string	">2C"
+ 255 104d 3F334A00 		.string	"?3J"
+ 256 1051 3F335200 		.string	"?3R"
+GAS LISTING /tmp/cc60kbk9.s 			page 18
+
+
+ 257 1055 3F335900 		.string	"?3Y"
+ 258 1059 40346100 		.string	"@4a"
+ 259 105d 40346800 		.string	"@4h"
+ 260 1061 40347000 		.string	"@4p"
+ 261 1065 41357700 		.string	"A5w"
+ 262 1069 41357F00 		.string	"A5\177"
+ 263 106d 41358600 		.string	"A5\206"
+ 264 1071 42368D00 		.string	"B6\215"
+ 265 1075 42369500 		.string	"B6\225"
+ 266 1079 42369C00 		.string	"B6\234"
+ 267 107d 4237A400 		.string	"B7\244"
+ 268 1081 4337AB00 		.string	"C7\253"
+ 269 1085 4337B300 		.string	"C7\263"
+ 270 1089 4338BA00 		.string	"C8\272"
+ 271 108d 4438C200 		.string	"D8\302"
+ 272 1091 4439C900 		.string	"D9\311"
+ 273 1095 4439D100 		.string	"D9\321"
+ 274 1099 4539D800 		.string	"E9\330"
+ 275 109d 453AE000 		.string	"E:\340"
+ 276 10a1 453AE700 		.string	"E:\347"
+ 277 10a5 463AEF00 		.string	"F:\357"
+ 278 10a9 463BF600 		.string	"F;\366"
+ 279 10ad 463BFE00 		.string	"F;\376"
+ 280 10b1 473BFF00 		.string	"G;\377"
+ 281 10b5 473CFF00 		.string	"G<\377"
+ 282 10b9 473CFF00 		.string	"G<\377"
+ 283 10bd 483CFF00 		.string	"H<\377"
+ 284 10c1 483DFF00 		.string	"H=\377"
+ 285 10c5 483DFF00 		.string	"H=\377"
+ 286 10c9 493DFF00 		.string	"I=\377"
+ 287 10cd 493EFF00 		.string	"I>\377"
+ 288 10d1 493EFF00 		.string	"I>\377"
+ 289 10d5 4A3EFF00 		.string	"J>\377"
+ 290 10d9 4A3FFF00 		.string	"J?\377"
+ 291 10dd 4A3FFF00 		.string	"J?\377"
+ 292 10e1 4B40FF00 		.string	"K@\377"
+ 293 10e5 4B40FF00 		.string	"K@\377"
+ 294 10e9 4B40FF00 		.string	"K@\377"
+ 295 10ed 4C41FF00 		.string	"LA\377"
+ 296 10f1 4C41FF00 		.string	"LA\377"
+ 297 10f5 554BFF00 		.string	"UK\377"
+ 298 10f9 554BFF00 		.string	"UK\377"
+ 299 10fd 554BFF00 		.string	"UK\377"
+ 300 1101 564CFF00 		.string	"VL\377"
+ 301 1105 564CFF00 		.string	"VL\377"
+ 302 1109 564CFF00 		.string	"VL\377"
+ 303 110d 574DFF00 		.string	"WM\377"
+ 304 1111 574DFF01 		.ascii	"WM\377\001WM\377\001XN\377\001XN\377\001XO\377\001YO\377\001"
+ 304      574DFF01 
+ 304      584EFF01 
+ 304      584EFF01 
+ 304      584FFF01 
+ 305 1129 594FFF01 		.ascii	"YO\377\001YP\377\001ZP\377\001ZP\377\001ZQ\377\001[Q\377\001"
+ 305      5950FF01 
+ 305      5A50FF01 
+ 305      5A50FF01 
+ 305      5A51FF01 
+GAS LISTING /tmp/cc60kbk9.s 			page 19
+
+
+ 306 1141 5B51FF01 		.ascii	"[Q\377\001[R\377\001\\R\377\001\\S\377\001\\S\377\001]S\377\001"
+ 306      5B52FF01 
+ 306      5C52FF01 
+ 306      5C53FF01 
+ 306      5C53FF01 
+ 307 1159 5D54FF01 		.ascii	"]T\377\001]T\377\001^T\377\001^U\377\001^U\377\001_V\377\001"
+ 307      5D54FF01 
+ 307      5E54FF01 
+ 307      5E55FF01 
+ 307      5E55FF01 
+ 308 1171 5F56FF01 		.ascii	"_V\377\001_V\377\001`W\377\001`W\377\001`X\377\001aX\377\001"
+ 308      5F56FF01 
+ 308      6057FF01 
+ 308      6057FF01 
+ 308      6058FF01 
+ 309 1189 6158FF01 		.ascii	"aX\377\001aY\377\001bY\377\001bY\377\001bZ\377\001cZ\377\001"
+ 309      6159FF01 
+ 309      6259FF01 
+ 309      6259FF01 
+ 309      625AFF01 
+ 310 11a1 635BFF01 		.ascii	"c[\377\001c[\377\001d[\377\001d\\\377\001d\\\377\001e]\377\001"
+ 310      635BFF01 
+ 310      645BFF01 
+ 310      645CFF01 
+ 310      645CFF01 
+ 311 11b9 655DFF01 		.ascii	"e]\377\001e]\377\001f^\377\001f^\377\002f^\377\002g_\377\003"
+ 311      655DFF01 
+ 311      665EFF01 
+ 311      665EFF02 
+ 311      665EFF02 
+ 312 11d1 675FFF03 		.ascii	"g_\377\003h`\377\004h`\377\004h`\377\005ia\377\006ia\377\006"
+ 312      6860FF04 
+ 312      6860FF04 
+ 312      6860FF05 
+ 312      6961FF06 
+ 313 11e9 6961FF07 		.ascii	"ia\377\007jb\377\007jb\377\bkc\377\tkc\377\tkc\377\nld\377\n"
+ 313      6A62FF07 
+ 313      6A62FF08 
+ 313      6B63FF09 
+ 313      6B63FF09 
+ 314 1205 6C64FF0B 		.ascii	"ld\377\013ld\377\013me\377\fme\377\fne\377\rnf\377\rnf\377\016"
+ 314      6C64FF0B 
+ 314      6D65FF0C 
+ 314      6D65FF0C 
+ 314      6E65FF0D 
+ 315 1221 6F67FF0E 		.ascii	"og\377\016og\377\017og\377\017ph\377\017ph\377\020qh\377\020"
+ 315      6F67FF0F 
+ 315      6F67FF0F 
+ 315      7068FF0F 
+ 315      7068FF10 
+ 316 1239 7169FF11 		.ascii	"qi\377\021qi\377\021rj\377\022rj\377\022rj\377\022sk\377\023"
+ 316      7169FF11 
+ 316      726AFF12 
+ 316      726AFF12 
+ 316      726AFF12 
+ 317 1251 736BFF13 		.ascii	"sk\377\023tl\377\024tl\377\024tl\377\024um\377\025um\377\025"
+ 317      746CFF14 
+GAS LISTING /tmp/cc60kbk9.s 			page 20
+
+
+ 317      746CFF14 
+ 317      746CFF14 
+ 317      756DFF15 
+ 318 1269 756DFF16 		.ascii	"um\377\026vn\377\026vn\377\026wo\377\027wo\377\027wo\377\027"
+ 318      766EFF16 
+ 318      766EFF16 
+ 318      776FFF17 
+ 318      776FFF17 
+ 319 1281 7870FF18 		.ascii	"xp\377\030xp\377\030yp\377#\203{\377#\203{\377$\203{\377$\204"
+ 319      7870FF18 
+ 319      7970FF23 
+ 319      837BFF23 
+ 319      837BFF24 
+ 320 129a 7CFF2484 		.ascii	"|\377$\204|\377%\205}\377%\205}\377&\205}\377&\206~\377&\206"
+ 320      7CFF2585 
+ 320      7DFF2585 
+ 320      7DFF2685 
+ 320      7DFF2686 
+ 321 12b2 7EFF2787 		.ascii	"~\377'\207~\377'\207\177\377'\207\177\377(\210\200\377(\210\200"
+ 321      7EFF2787 
+ 321      7FFF2787 
+ 321      7FFF2888 
+ 321      80FF2888 
+ 322 12c7 FF288880 		.ascii	"\377(\210\200\377)\211\201\377)\211\201\377)\212\202\377*\212"
+ 322      FF298981 
+ 322      FF298981 
+ 322      FF298A82 
+ 322      FF2A8A
+ 323 12da 82FF2A8A 		.ascii	"\202\377*\212\202\377+\213\203\377+\213\203\377+\214\204\377"
+ 323      82FF2B8B 
+ 323      83FF2B8B 
+ 323      83FF2B8C 
+ 323      84FF
+ 324 12ec 2C8C84FF 		.ascii	",\214\204\377,\214\204\377,\215\205\377-\215\205\377-\216\205"
+ 324      2C8C84FF 
+ 324      2C8D85FF 
+ 324      2D8D85FF 
+ 324      2D8E85
+ 325 12ff FF2D8E86 		.ascii	"\377-\216\206\377.\216\206\377.\217\207\377.\217\207\377/\220"
+ 325      FF2E8E86 
+ 325      FF2E8F87 
+ 325      FF2E8F87 
+ 325      FF2F90
+ 326 1312 87FF2F90 		.ascii	"\207\377/\220\210\377/\220\210\3770\221\211\3770\221\211\377"
+ 326      88FF2F90 
+ 326      88FF3091 
+ 326      89FF3091 
+ 326      89FF
+ 327 1324 309189FF 		.ascii	"0\221\211\3771\222\212\3771\222\212\3771\223\213\3772\223\213"
+ 327      31928AFF 
+ 327      31928AFF 
+ 327      31938BFF 
+ 327      32938B
+ 328 1337 FF32938B 		.ascii	"\3772\223\213\3772\224\214\3773\224\214\3773\225\215\3773\225"
+ 328      FF32948C 
+ 328      FF33948C 
+ 328      FF33958D 
+GAS LISTING /tmp/cc60kbk9.s 			page 21
+
+
+ 328      FF3395
+ 329 134a 8DFF3495 		.ascii	"\215\3774\225\215\3774\226\216\3774\226\216\3775\227\217\377"
+ 329      8DFF3496 
+ 329      8EFF3496 
+ 329      8EFF3597 
+ 329      8FFF
+ 330 135c 35978FFF 		.ascii	"5\227\217\3776\227\217\3777\230\220\3777\230\220\3778\231\220"
+ 330      36978FFF 
+ 330      379890FF 
+ 330      379890FF 
+ 330      389990
+ 331 136f FF399991 		.ascii	"\3779\231\221\3779\231\221\377:\232\222\377;\232\222\377;\233"
+ 331      FF399991 
+ 331      FF3A9A92 
+ 331      FF3B9A92 
+ 331      FF3B9B
+ 332 1382 92FF3C9B 		.ascii	"\222\377<\233\223\377=\234\223\377=\234\223\377>\234\224\377"
+ 332      93FF3D9C 
+ 332      93FF3D9C 
+ 332      93FF3E9C 
+ 332      94FF
+ 333 1394 3F9D94FF 		.ascii	"?\235\224\377?\235\225\377@\236\225\377@\236\225\377A\236\226"
+ 333      3F9D95FF 
+ 333      409E95FF 
+ 333      409E95FF 
+ 333      419E96
+ 334 13a7 FF429F96 		.ascii	"\377B\237\226\377B\237\227\377C\240\227\377D\240\227\377D\241"
+ 334      FF429F97 
+ 334      FF43A097 
+ 334      FF44A097 
+ 334      FF44A1
+ 335 13ba 98FF45A1 		.ascii	"\230\377E\241\230\377E\241\230\377F\242\231\377G\242\231\377"
+ 335      98FF45A1 
+ 335      98FF46A2 
+ 335      99FF47A2 
+ 335      99FF
+ 336 13cc 47A39AFF 		.ascii	"G\243\232\377H\243\232\377H\243\232\377I\244\233\377J\244\233"
+ 336      48A39AFF 
+ 336      48A39AFF 
+ 336      49A49BFF 
+ 336      4AA49B
+ 337 13df FF4AA59C 		.ascii	"\377J\245\234\377K\245\234\377K\246\234\377L\246\235\377M\246"
+ 337      FF4BA59C 
+ 337      FF4BA69C 
+ 337      FF4CA69D 
+ 337      FF4DA6
+ 338 13f2 9DFF4DA7 		.ascii	"\235\377M\247\235\377N\247\236\377N\250\236\377O\250\237\377"
+ 338      9DFF4EA7 
+ 338      9EFF4EA8 
+ 338      9EFF4FA8 
+ 338      9FFF
+ 339 1404 50A89FFF 		.ascii	"P\250\237\377P\251\237\377Q\251\240\377Q\252\240\377R\252\241"
+ 339      50A99FFF 
+ 339      51A9A0FF 
+ 339      51AAA0FF 
+ 339      52AAA1
+ 340 1417 FF52ABA1 		.ascii	"\377R\253\241\377S\253\241\377T\253\242\377c\267\254\377d\267"
+GAS LISTING /tmp/cc60kbk9.s 			page 22
+
+
+ 340      FF53ABA1 
+ 340      FF54ABA2 
+ 340      FF63B7AC 
+ 340      FF64B7
+ 341 142a ADFF64B7 		.ascii	"\255\377d\267\255\377e\270\255\377e\270\256\377f\271\256\377"
+ 341      ADFF65B8 
+ 341      ADFF65B8 
+ 341      AEFF66B9 
+ 341      AEFF
+ 342 143c 67B9AEFF 		.ascii	"g\271\256\377g\272\257\377h\272\257\377h\272\260\377i\273\260"
+ 342      67BAAFFF 
+ 342      68BAAFFF 
+ 342      68BAB0FF 
+ 342      69BBB0
+ 343 144f FF69BBB0 		.ascii	"\377i\273\260\377j\274\261\377j\274\261\377k\275\262\377l\275"
+ 343      FF6ABCB1 
+ 343      FF6ABCB1 
+ 343      FF6BBDB2 
+ 343      FF6CBD
+ 344 1462 B2FF6CBD 		.ascii	"\262\377l\275\262\377m\276\263\377m\276\263\377n\277\264\377"
+ 344      B2FF6DBE 
+ 344      B3FF6DBE 
+ 344      B3FF6EBF 
+ 344      B4FF
+ 345 1474 6EBFB4FF 		.ascii	"n\277\264\377o\300\264\377o\300\265\377p\300\265\377q\301\266"
+ 345      6FC0B4FF 
+ 345      6FC0B5FF 
+ 345      70C0B5FF 
+ 345      71C1B6
+ 346 1487 FF71C1B6 		.ascii	"\377q\301\266\377r\302\266\377r\302\267\377s\303\267\377s\303"
+ 346      FF72C2B6 
+ 346      FF72C2B7 
+ 346      FF73C3B7 
+ 346      FF73C3
+ 347 149a B8FF74C3 		.ascii	"\270\377t\303\270\377t\304\270\377u\304\271\377v\305\271\377"
+ 347      B8FF74C4 
+ 347      B8FF75C4 
+ 347      B9FF76C5 
+ 347      B9FF
+ 348 14ac 76C5BAFF 		.ascii	"v\305\272\377w\306\272\377w\306\272\377x\306\273\377x\307\273"
+ 348      77C6BAFF 
+ 348      77C6BAFF 
+ 348      78C6BBFF 
+ 348      78C7BB
+ 349 14bf FF79C7BC 		.ascii	"\377y\307\274\377y\310\274\377z\310\274\377z\311\275\377{\311"
+ 349      FF79C8BC 
+ 349      FF7AC8BC 
+ 349      FF7AC9BD 
+ 349      FF7BC9
+ 350 14d2 BDFF7CC9 		.ascii	"\275\377|\311\276\377|\312\276\377}\312\276\377}\313\277\377"
+ 350      BEFF7CCA 
+ 350      BEFF7DCA 
+ 350      BEFF7DCB 
+ 350      BFFF
+ 351 14e4 7ECBBFFF 		.ascii	"~\313\277\377~\314\300\377\177\314\300\377\177\314\300\377\200"
+ 351      7ECCC0FF 
+ 351      7FCCC0FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 23
+
+
+ 351      7FCCC0FF 
+ 351      80
+ 352 14f5 CDC1FF81 		.ascii	"\315\301\377\201\315\301\377\201\315\301\377\202\315\302\377"
+ 352      CDC1FF81 
+ 352      CDC1FF82 
+ 352      CDC2FF
+ 353 1504 82CEC2FF 		.ascii	"\202\316\302\377\203\316\302\377\203\316\302\377\204\316\303"
+ 353      83CEC2FF 
+ 353      83CEC2FF 
+ 353      84CEC3
+ 354 1513 FF85CFC3 		.ascii	"\377\205\317\303\377\205\317\303\377\206\317\304\377\206\317"
+ 354      FF85CFC3 
+ 354      FF86CFC4 
+ 354      FF86CF
+ 355 1522 C4FF87CF 		.ascii	"\304\377\207\317\304\377\207\320\304\377\210\320\305\377\211"
+ 355      C4FF87D0 
+ 355      C4FF88D0 
+ 355      C5FF89
+ 356 1531 D0C5FF89 		.ascii	"\320\305\377\211\320\305\377\212\321\306\377\212\321\306\377"
+ 356      D0C5FF8A 
+ 356      D1C6FF8A 
+ 356      D1C6FF
+ 357 1540 8BD1C6FF 		.ascii	"\213\321\306\377\213\321\306\377\214\321\307\377\215\322\307"
+ 357      8BD1C6FF 
+ 357      8CD1C7FF 
+ 357      8DD2C7
+ 358 154f FF8DD2C7 		.ascii	"\377\215\322\307\377\216\322\310\377\216\322\310\377\217\323"
+ 358      FF8ED2C8 
+ 358      FF8ED2C8 
+ 358      FF8FD3
+ 359 155e C8FF8FD3 		.ascii	"\310\377\217\323\310\377\220\323\311\377\221\323\311\377\221"
+ 359      C8FF90D3 
+ 359      C9FF91D3 
+ 359      C9FF91
+ 360 156d D4C9FF92 		.ascii	"\324\311\377\222\324\312\377\222\324\312\377\223\324\312\377"
+ 360      D4CAFF92 
+ 360      D4CAFF93 
+ 360      D4CAFF
+ 361 157c 93D4CAFF 		.ascii	"\223\324\312\377\224\325\313\377\224\325\313\377\225\325\313"
+ 361      94D5CBFF 
+ 361      94D5CBFF 
+ 361      95D5CB
+ 362 158b FF96D5CC 		.ascii	"\377\226\325\314\377\226\326\314\377\227\326\314\377\227\326"
+ 362      FF96D6CC 
+ 362      FF97D6CC 
+ 362      FF97D6
+ 363 159a CCFF98D6 		.ascii	"\314\377\230\326\315\377\230\326\315\377\231\327\315\377\231"
+ 363      CDFF98D6 
+ 363      CDFF99D7 
+ 363      CDFF99
+ 364 15a9 D7CEFF9A 		.ascii	"\327\316\377\232\327\316\377\233\327\316\377\233\330\316\377"
+ 364      D7CEFF9B 
+ 364      D7CEFF9B 
+ 364      D8CEFF
+ 365 15b8 9CD8CFFF 		.ascii	"\234\330\317\377\234\330\317\377\253\336\326\377\254\336\327"
+ 365      9CD8CFFF 
+ 365      ABDED6FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 24
+
+
+ 365      ACDED7
+ 366 15c7 FFACDFD7 		.ascii	"\377\254\337\327\377\255\337\327\377\255\337\330\377\256\337"
+ 366      FFADDFD7 
+ 366      FFADDFD8 
+ 366      FFAEDF
+ 367 15d6 D8FFAEDF 		.ascii	"\330\377\256\337\330\377\257\340\330\377\257\340\331\377\260"
+ 367      D8FFAFE0 
+ 367      D8FFAFE0 
+ 367      D9FFB0
+ 368 15e5 E0D9FFB0 		.ascii	"\340\331\377\260\340\331\377\261\341\332\377\262\341\332\377"
+ 368      E0D9FFB1 
+ 368      E1DAFFB2 
+ 368      E1DAFF
+ 369 15f4 B2E1DAFF 		.ascii	"\262\341\332\377\263\341\332\377\263\341\333\377\264\342\333"
+ 369      B3E1DAFF 
+ 369      B3E1DBFF 
+ 369      B4E2DB
+ 370 1603 FFB4E2DB 		.ascii	"\377\264\342\333\377\265\342\333\377\265\342\334\377\266\343"
+ 370      FFB5E2DB 
+ 370      FFB5E2DC 
+ 370      FFB6E3
+ 371 1612 DCFFB6E3 		.ascii	"\334\377\266\343\334\377\267\343\335\377\270\343\335\377\270"
+ 371      DCFFB7E3 
+ 371      DDFFB8E3 
+ 371      DDFFB8
+ 372 1621 E4DDFFB9 		.ascii	"\344\335\377\271\344\335\377\271\344\336\377\272\344\336\377"
+ 372      E4DDFFB9 
+ 372      E4DEFFBA 
+ 372      E4DEFF
+ 373 1630 BAE4DEFF 		.ascii	"\272\344\336\377\273\345\337\377\273\345\337\377\274\345\337"
+ 373      BBE5DFFF 
+ 373      BBE5DFFF 
+ 373      BCE5DF
+ 374 163f FFBCE5DF 		.ascii	"\377\274\345\337\377\275\346\340\377\276\346\340\377\276\346"
+ 374      FFBDE6E0 
+ 374      FFBEE6E0 
+ 374      FFBEE6
+ 375 164e E0FFBFE6 		.ascii	"\340\377\277\346\340\377\277\346\341\377\300\347\341\377\300"
+ 375      E0FFBFE6 
+ 375      E1FFC0E7 
+ 375      E1FFC0
+ 376 165d E7E1FFC1 		.ascii	"\347\341\377\301\347\342\377\301\347\342\377\302\350\342\377"
+ 376      E7E2FFC1 
+ 376      E7E2FFC2 
+ 376      E8E2FF
+ 377 166c C2E8E2FF 		.ascii	"\302\350\342\377\303\350\343\377\303\350\343\377\304\350\343"
+ 377      C3E8E3FF 
+ 377      C3E8E3FF 
+ 377      C4E8E3
+ 378 167b FFC5E9E4 		.ascii	"\377\305\351\344\377\305\351\344\377\306\351\344\377\306\351"
+ 378      FFC5E9E4 
+ 378      FFC6E9E4 
+ 378      FFC6E9
+ 379 168a E4FFF0DD 		.ascii	"\344\377\360\335\343\377\360\336\344\377\357\336\345\377\357"
+ 379      E3FFF0DE 
+ 379      E4FFEFDE 
+ 379      E5FFEF
+GAS LISTING /tmp/cc60kbk9.s 			page 25
+
+
+ 380 1699 DEE5FFEF 		.ascii	"\336\345\377\357\336\346\377\356\337\347\377\356\337\347\377"
+ 380      DEE6FFEE 
+ 380      DFE7FFEE 
+ 380      DFE7FF
+ 381 16a8 EEDFE8FF 		.ascii	"\356\337\350\377\355\337\350\377\355\340\351\377\355\340\352"
+ 381      EDDFE8FF 
+ 381      EDE0E9FF 
+ 381      EDE0EA
+ 382 16b7 FFECE0EA 		.ascii	"\377\354\340\352\377\354\341\353\377\353\341\353\377\353\341"
+ 382      FFECE1EB 
+ 382      FFEBE1EB 
+ 382      FFEBE1
+ 383 16c6 ECFFEBE1 		.ascii	"\354\377\353\341\354\377\352\342\355\377\352\342\355\377\351"
+ 383      ECFFEAE2 
+ 383      EDFFEAE2 
+ 383      EDFFE9
+ 384 16d5 E2EEFFE9 		.ascii	"\342\356\377\351\343\356\377\351\343\356\377\350\343\357\377"
+ 384      E3EEFFE9 
+ 384      E3EEFFE8 
+ 384      E3EFFF
+ 385 16e4 E8E3EFFF 		.ascii	"\350\343\357\377\347\344\360\377\347\344\360\377\347\344\360"
+ 385      E7E4F0FF 
+ 385      E7E4F0FF 
+ 385      E7E4F0
+ 386 16f3 FFE6E5F0 		.ascii	"\377\346\345\360\377\346\345\361\377\346\345\361\377\345\345"
+ 386      FFE6E5F1 
+ 386      FFE6E5F1 
+ 386      FFE5E5
+ 387 1702 F1FFE5E6 		.ascii	"\361\377\345\346\362\377\344\346\362\377\344\346\362\377\344"
+ 387      F2FFE4E6 
+ 387      F2FFE4E6 
+ 387      F2FFE4
+ 388 1711 E7F2FFE3 		.ascii	"\347\362\377\343\347\362\377\343\347\363\377\343\347\363\377"
+ 388      E7F2FFE3 
+ 388      E7F3FFE3 
+ 388      E7F3FF
+ 389 1720 E3E8F3FF 		.ascii	"\343\350\363\377\342\350\363\377\342\350\363\377\342\351\363"
+ 389      E2E8F3FF 
+ 389      E2E8F3FF 
+ 389      E2E9F3
+ 390 172f FFE2E9F3 		.ascii	"\377\342\351\363\377\341\351\363\377\341\351\363\377\341\352"
+ 390      FFE1E9F3 
+ 390      FFE1E9F3 
+ 390      FFE1EA
+ 391 173e F3FFE1EA 		.ascii	"\363\377\341\352\363\377\341\352\363\377\340\352\363\377\340"
+ 391      F3FFE1EA 
+ 391      F3FFE0EA 
+ 391      F3FFE0
+ 392 174d EBF3FFE0 		.ascii	"\353\363\377\340\353\363\377\340\353\363\377\351\355\367\377"
+ 392      EBF3FFE0 
+ 392      EBF3FFE9 
+ 392      EDF7FF
+ 393 175c E9EEF7FF 		.ascii	"\351\356\367\377\351\356\367\377\351\356\367\377\351\356\366"
+ 393      E9EEF7FF 
+ 393      E9EEF7FF 
+ 393      E9EEF6
+ 394 176b FFE9EFF6 		.ascii	"\377\351\357\366\377\351\357\366\377\351\357\366\377\351\357"
+GAS LISTING /tmp/cc60kbk9.s 			page 26
+
+
+ 394      FFE9EFF6 
+ 394      FFE9EFF6 
+ 394      FFE9EF
+ 395 177a F6FFE9EF 		.ascii	"\366\377\351\357\366\377\351\360\366\377\351\360\366\377\351"
+ 395      F6FFE9F0 
+ 395      F6FFE9F0 
+ 395      F6FFE9
+ 396 1789 F0F6FFE9 		.ascii	"\360\366\377\351\360\366\377\351\360\366\377\352\360\365\377"
+ 396      F0F6FFE9 
+ 396      F0F6FFEA 
+ 396      F0F5FF
+ 397 1798 EAF1F5FF 		.ascii	"\352\361\365\377\352\361\365\377\352\361\365\377\352\361\365"
+ 397      EAF1F5FF 
+ 397      EAF1F5FF 
+ 397      EAF1F5
+ 398 17a7 FFEAF1F5 		.ascii	"\377\352\361\365\377\353\361\365\377\353\361\365\377\353\362"
+ 398      FFEBF1F5 
+ 398      FFEBF1F5 
+ 398      FFEBF2
+ 399 17b6 F5FFEBF2 		.ascii	"\365\377\353\362\365\377\354\362\364\377\354\362\364\377\354"
+ 399      F5FFECF2 
+ 399      F4FFECF2 
+ 399      F4FFEC
+ 400 17c5 F2F4FFEC 		.ascii	"\362\364\377\354\362\364\377\355\362\364\377\355\363\364\377"
+ 400      F2F4FFED 
+ 400      F2F4FFED 
+ 400      F3F4FF
+ 401 17d4 EDF3F4FF 		.ascii	"\355\363\364\377\356\363\364\377\356\363\364\377\356\363\364"
+ 401      EEF3F4FF 
+ 401      EEF3F4FF 
+ 401      EEF3F4
+ 402 17e3 FFEFF3F4 		.ascii	"\377\357\363\364\377\357\363\364\377\357\363\364\377"
+ 402      FFEFF3F4 
+ 402      FFEFF3F4 
+ 402      FF
+ 403 17f0 F0F3F4FF 		.ascii	"\360\363\364\377\360\363\364\377\361\364\364\377\361\364\364"
+ 403      F0F3F4FF 
+ 403      F1F4F4FF 
+ 403      F1F4F4
+ 404 17ff FFF1F4F4 		.ascii	"\377\361\364\364\377\362\364\364\377\362\364\364\377\362\364"
+ 404      FFF2F4F4 
+ 404      FFF2F4F4 
+ 404      FFF2F4
+ 405 180e F4FFF3F4 		.ascii	"\364\377\363\364\364\377\363\364\364\377\363\364\364\377\364"
+ 405      F4FFF3F4 
+ 405      F4FFF3F4 
+ 405      F4FFF4
+ 406 181d F4F4FFF4 		.ascii	"\364\364\377\364\364\364\377\364\365\365\377\365\364\364\377"
+ 406      F4F4FFF4 
+ 406      F5F5FFF5 
+ 406      F4F4FF
+ 407 182c F5F4F4FF 		.ascii	"\365\364\364\377\365\364\364\377\365\364\364\377\366\364\364"
+ 407      F5F4F4FF 
+ 407      F5F4F4FF 
+ 407      F6F4F4
+ 408 183b FFF6F3F4 		.ascii	"\377\366\363\364\377\366\363\364\377\366\363\363\377\367\363"
+ 408      FFF6F3F4 
+GAS LISTING /tmp/cc60kbk9.s 			page 27
+
+
+ 408      FFF6F3F3 
+ 408      FFF7F3
+ 409 184a F3FFF7F3 		.ascii	"\363\377\367\363\363\377\367\362\363\377\367\362\363\377\370"
+ 409      F3FFF7F2 
+ 409      F3FFF7F2 
+ 409      F3FFF8
+ 410 1859 F2F3FFF8 		.ascii	"\362\363\377\370\362\362\377\370\362\362\377\370\361\362\377"
+ 410      F2F2FFF8 
+ 410      F2F2FFF8 
+ 410      F1F2FF
+ 411 1868 F9F1F2FF 		.ascii	"\371\361\362\377\371\361\361\377\371\361\361\377\371\361\361"
+ 411      F9F1F1FF 
+ 411      F9F1F1FF 
+ 411      F9F1F1
+ 412 1877 FFFAF0F1 		.ascii	"\377\372\360\361\377\372\360\360\377\372\360\360\377\372\360"
+ 412      FFFAF0F0 
+ 412      FFFAF0F0 
+ 412      FFFAF0
+ 413 1886 F0FFFBF0 		.ascii	"\360\377\373\360\357\377\373\360\357\377\373\357\357\377\373"
+ 413      EFFFFBF0 
+ 413      EFFFFBEF 
+ 413      EFFFFB
+ 414 1895 EFEEFFFB 		.ascii	"\357\356\377\373\357\356\377\374\357\356\377\374\357\355\377"
+ 414      EFEEFFFC 
+ 414      EFEEFFFC 
+ 414      EFEDFF
+ 415 18a4 FCEFEDFF 		.ascii	"\374\357\355\377\374\356\355\377\375\356\354\377\375\356\354"
+ 415      FCEEEDFF 
+ 415      FDEEECFF 
+ 415      FDEEEC
+ 416 18b3 FFFDEEEB 		.ascii	"\377\375\356\353\377\375\356\353\377\375\356\353\377\375\355"
+ 416      FFFDEEEB 
+ 416      FFFDEEEB 
+ 416      FFFDED
+ 417 18c2 EAFFFDED 		.ascii	"\352\377\375\355\352\377\375\355\351\377\375\355\351\377\375"
+ 417      EAFFFDED 
+ 417      E9FFFDED 
+ 417      E9FFFD
+ 418 18d1 EDE9FFFD 		.ascii	"\355\351\377\375\355\350\377\375\355\350\377\375\354\347\377"
+ 418      EDE8FFFD 
+ 418      EDE8FFFD 
+ 418      ECE7FF
+ 419 18e0 FDECE7FF 		.ascii	"\375\354\347\377\375\354\346\377\375\354\346\377\375\354\345"
+ 419      FDECE6FF 
+ 419      FDECE6FF 
+ 419      FDECE5
+ 420 18ef FFFDECE5 		.ascii	"\377\375\354\345\377\375\351\332\377\375\351\332\377\375\351"
+ 420      FFFDE9DA 
+ 420      FFFDE9DA 
+ 420      FFFDE9
+ 421 18fe D9FFFDE9 		.ascii	"\331\377\375\351\331\377\375\351\330\377\375\350\330\377\375"
+ 421      D9FFFDE9 
+ 421      D8FFFDE8 
+ 421      D8FFFD
+ 422 190d E8D8FFFD 		.ascii	"\350\330\377\375\350\327\377\375\350\327\377\375\350\326\377"
+ 422      E8D7FFFD 
+ 422      E8D7FFFD 
+GAS LISTING /tmp/cc60kbk9.s 			page 28
+
+
+ 422      E8D6FF
+ 423 191c FDE8D6FF 		.ascii	"\375\350\326\377\375\350\325\377\375\350\325\377\375\350\324"
+ 423      FDE8D5FF 
+ 423      FDE8D5FF 
+ 423      FDE8D4
+ 424 192b FFFDE8D3 		.ascii	"\377\375\350\323\377\375\350\323\377\375\350\322\377\375\350"
+ 424      FFFDE8D3 
+ 424      FFFDE8D2 
+ 424      FFFDE8
+ 425 193a D2FFFDE7 		.ascii	"\322\377\375\347\321\377\375\347\321\377\375\347\320\377\375"
+ 425      D1FFFDE7 
+ 425      D1FFFDE7 
+ 425      D0FFFD
+ 426 1949 E7D0FFFD 		.ascii	"\347\320\377\375\347\317\377\375\347\317\377\375\347\316\377"
+ 426      E7CFFFFD 
+ 426      E7CFFFFD 
+ 426      E7CEFF
+ 427 1958 FDE7CEFF 		.ascii	"\375\347\316\377\375\347\315\377\375\347\315\377\375\347\314"
+ 427      FDE7CDFF 
+ 427      FDE7CDFF 
+ 427      FDE7CC
+ 428 1967 FFFDE7CC 		.ascii	"\377\375\347\314\377\375\347\313\377\375\347\313\377\374\347"
+ 428      FFFDE7CB 
+ 428      FFFDE7CB 
+ 428      FFFCE7
+ 429 1976 CAFFFCE7 		.ascii	"\312\377\374\347\312\377\374\347\312\377\374\347\311\377\373"
+ 429      CAFFFCE7 
+ 429      CAFFFCE7 
+ 429      C9FFFB
+ 430 1985 E7C9FFFB 		.ascii	"\347\311\377\373\347\310\377\373\347\310\377\372\347\307\377"
+ 430      E7C8FFFB 
+ 430      E7C8FFFA 
+ 430      E7C7FF
+ 431 1994 FAE7C7FF 		.ascii	"\372\347\307\377\372\347\306\377\371\347\306\377\371\347\305"
+ 431      FAE7C6FF 
+ 431      F9E7C6FF 
+ 431      F9E7C5
+ 432 19a3 FFF8E7C5 		.ascii	"\377\370\347\305\377\370\347\305\377\370\347\304\377\367\347"
+ 432      FFF8E7C5 
+ 432      FFF8E7C4 
+ 432      FFF7E7
+ 433 19b2 C4FFF7E7 		.ascii	"\304\377\367\347\303\377\366\347\303\377\366\347\303\377\365"
+ 433      C3FFF6E7 
+ 433      C3FFF6E7 
+ 433      C3FFF5
+ 434 19c1 E7C2FFF5 		.ascii	"\347\302\377\365\347\302\377\365\347\301\377\365\346\300\377"
+ 434      E7C2FFF5 
+ 434      E7C1FFF5 
+ 434      E6C0FF
+ 435 19d0 F5E6C0FF 		.ascii	"\365\346\300\377\364\346\277\377\364\346\277\377\364\345\276"
+ 435      F4E6BFFF 
+ 435      F4E6BFFF 
+ 435      F4E5BE
+ 436 19df FFF4E5BE 		.ascii	"\377\364\345\276\377\364\345\275\377\364\344\275\377\363\344"
+ 436      FFF4E5BD 
+ 436      FFF4E4BD 
+ 436      FFF3E4
+GAS LISTING /tmp/cc60kbk9.s 			page 29
+
+
+ 437 19ee BCFFF3E4 		.ascii	"\274\377\363\344\274\377\363\343\273\377\363\343\272\377\363"
+ 437      BCFFF3E3 
+ 437      BBFFF3E3 
+ 437      BAFFF3
+ 438 19fd E3BAFFF2 		.ascii	"\343\272\377\362\343\271\377\362\342\271\377\362\342\270\377"
+ 438      E3B9FFF2 
+ 438      E2B9FFF2 
+ 438      E2B8FF
+ 439 1a0c F2E2B8FF 		.ascii	"\362\342\270\377\362\341\267\377\362\341\267\377\361\341\266"
+ 439      F2E1B7FF 
+ 439      F2E1B7FF 
+ 439      F1E1B6
+ 440 1a1b FFF1E1B5 		.ascii	"\377\361\341\265\377\361\340\265\377\361\340\264\377\361\340"
+ 440      FFF1E0B5 
+ 440      FFF1E0B4 
+ 440      FFF1E0
+ 441 1a2a B4FFF0DF 		.ascii	"\264\377\360\337\263\377\360\337\263\377\360\337\262\377\360"
+ 441      B3FFF0DF 
+ 441      B3FFF0DF 
+ 441      B2FFF0
+ 442 1a39 DEB2FFF0 		.ascii	"\336\262\377\360\336\261\377\360\336\260\377\357\336\260\377"
+ 442      DEB1FFF0 
+ 442      DEB0FFEF 
+ 442      DEB0FF
+ 443 1a48 EFDDAFFF 		.ascii	"\357\335\257\377\357\335\257\377\357\335\256\377\357\334\256"
+ 443      EFDDAFFF 
+ 443      EFDDAEFF 
+ 443      EFDCAE
+ 444 1a57 FFEFDCAD 		.ascii	"\377\357\334\255\377\356\334\255\377\356\333\254\377\356\333"
+ 444      FFEEDCAD 
+ 444      FFEEDBAC 
+ 444      FFEEDB
+ 445 1a66 ACFFEEDB 		.ascii	"\254\377\356\333\253\377\356\333\252\377\355\332\252\377\355"
+ 445      ABFFEEDB 
+ 445      AAFFEDDA 
+ 445      AAFFED
+ 446 1a75 DAA9FFED 		.ascii	"\332\251\377\355\332\251\377\355\331\250\377\355\331\250\377"
+ 446      DAA9FFED 
+ 446      D9A8FFED 
+ 446      D9A8FF
+ 447 1a84 EDD9A7FF 		.ascii	"\355\331\247\377\354\331\247\377\350\321\230\377\347\320\230"
+ 447      ECD9A7FF 
+ 447      E8D198FF 
+ 447      E7D098
+ 448 1a93 FFE7D097 		.ascii	"\377\347\320\227\377\347\320\226\377\347\317\226\377\347\317"
+ 448      FFE7D096 
+ 448      FFE7CF96 
+ 448      FFE7CF
+ 449 1aa2 95FFE7CF 		.ascii	"\225\377\347\317\225\377\346\317\224\377\346\316\224\377\346"
+ 449      95FFE6CF 
+ 449      94FFE6CE 
+ 449      94FFE6
+ 450 1ab1 CE93FFE6 		.ascii	"\316\223\377\346\316\223\377\346\315\222\377\345\315\222\377"
+ 450      CE93FFE6 
+ 450      CD92FFE5 
+ 450      CD92FF
+ 451 1ac0 E5CD91FF 		.ascii	"\345\315\221\377\345\314\220\377\345\314\220\377\345\314\217"
+GAS LISTING /tmp/cc60kbk9.s 			page 30
+
+
+ 451      E5CC90FF 
+ 451      E5CC90FF 
+ 451      E5CC8F
+ 452 1acf FFE5CC8F 		.ascii	"\377\345\314\217\377\344\313\216\377\344\313\216\377\344\313"
+ 452      FFE4CB8E 
+ 452      FFE4CB8E 
+ 452      FFE4CB
+ 453 1ade 8DFFE4CA 		.ascii	"\215\377\344\312\215\377\344\312\214\377\343\312\214\377\343"
+ 453      8DFFE4CA 
+ 453      8CFFE3CA 
+ 453      8CFFE3
+ 454 1aed C98BFFE3 		.ascii	"\311\213\377\343\311\212\377\343\311\212\377\343\311\211\377"
+ 454      C98AFFE3 
+ 454      C98AFFE3 
+ 454      C989FF
+ 455 1afc E3C889FF 		.ascii	"\343\310\211\377\342\310\210\377\342\310\210\377\342\307\207"
+ 455      E2C888FF 
+ 455      E2C888FF 
+ 455      E2C787
+ 456 1b0b FFE2C787 		.ascii	"\377\342\307\207\377\342\307\206\377\342\307\206\377\341\306"
+ 456      FFE2C786 
+ 456      FFE2C786 
+ 456      FFE1C6
+ 457 1b1a 85FFE1C6 		.ascii	"\205\377\341\306\204\377\341\306\204\377\341\305\203\377\341"
+ 457      84FFE1C6 
+ 457      84FFE1C5 
+ 457      83FFE1
+ 458 1b29 C583FFE0 		.ascii	"\305\203\377\340\305\202\377\340\304\202\377\340\304\201\377"
+ 458      C582FFE0 
+ 458      C482FFE0 
+ 458      C481FF
+ 459 1b38 E0C481FF 		.ascii	"\340\304\201\377\340\304\200\377\340\303\200\377\337\303\177"
+ 459      E0C480FF 
+ 459      E0C380FF 
+ 459      DFC37F
+ 460 1b47 FFDFC37F 		.ascii	"\377\337\303\177\377\337\302~\377\337\302}\377\337\302}\377\336"
+ 460      FFDFC27E 
+ 460      FFDFC27D 
+ 460      FFDFC27D 
+ 460      FFDE
+ 461 1b59 C17CFFDE 		.ascii	"\301|\377\336\301|\377\336\301{\377\336\301{\377\336\301z\377"
+ 461      C17CFFDE 
+ 461      C17BFFDE 
+ 461      C17BFFDE 
+ 461      C17AFF
+ 462 1b6c DEC17AFF 		.ascii	"\336\301z\377\336\301y\377\336\301x\377\336\301x\377\335\301"
+ 462      DEC179FF 
+ 462      DEC178FF 
+ 462      DEC178FF 
+ 462      DDC1
+ 463 1b7e 77FFDDC1 		.ascii	"w\377\335\301w\377\335\301v\377\335\301u\377\335\301u\377\335"
+ 463      77FFDDC1 
+ 463      76FFDDC1 
+ 463      75FFDDC1 
+ 463      75FFDD
+ 464 1b91 C174FFDD 		.ascii	"\301t\377\335\301t\377\334\301s\377\334\301s\377\334\301r\377"
+ 464      C174FFDC 
+GAS LISTING /tmp/cc60kbk9.s 			page 31
+
+
+ 464      C173FFDC 
+ 464      C173FFDC 
+ 464      C172FF
+ 465 1ba4 DCC171FF 		.ascii	"\334\301q\377\334\301q\377\334\301p\377\334\301p\377\333\301"
+ 465      DCC171FF 
+ 465      DCC170FF 
+ 465      DCC170FF 
+ 465      DBC1
+ 466 1bb6 6FFFDBC1 		.ascii	"o\377\333\301o\377\333\301n\377\333\301m\377\333\301m\377\332"
+ 466      6FFFDBC1 
+ 466      6EFFDBC1 
+ 466      6DFFDBC1 
+ 466      6DFFDA
+ 467 1bc9 C16CFFDA 		.ascii	"\301l\377\332\301l\377\332\301k\377\332\301j\377\332\301j\377"
+ 467      C16CFFDA 
+ 467      C16BFFDA 
+ 467      C16AFFDA 
+ 467      C16AFF
+ 468 1bdc DAC169FF 		.ascii	"\332\301i\377\331\301i\377\331\301h\377\331\301h\377\331\301"
+ 468      D9C169FF 
+ 468      D9C168FF 
+ 468      D9C168FF 
+ 468      D9C1
+ 469 1bee 67FFD9C1 		.ascii	"g\377\331\301f\377\330\301f\377\330\301e\377\330\301e\377\330"
+ 469      66FFD8C1 
+ 469      66FFD8C1 
+ 469      65FFD8C1 
+ 469      65FFD8
+ 470 1c01 C164FFD7 		.ascii	"\301d\377\327\301c\377\327\301c\377\327\301b\377\327\301b\377"
+ 470      C163FFD7 
+ 470      C163FFD7 
+ 470      C162FFD7 
+ 470      C162FF
+ 471 1c14 D6C161FF 		.ascii	"\326\301a\377\326\301`\377\326\301`\377\326\301_\377\317\301"
+ 471      D6C160FF 
+ 471      D6C160FF 
+ 471      D6C15FFF 
+ 471      CFC1
+ 472 1c26 4FFFCFC1 		.ascii	"O\377\317\301N\377\317\301M\377\316\301M\377\316\301L\377\316"
+ 472      4EFFCFC1 
+ 472      4DFFCEC1 
+ 472      4DFFCEC1 
+ 472      4CFFCE
+ 473 1c39 C14CFFCE 		.ascii	"\301L\377\316\301K\377\315\301J\377\315\301J\377\315\301I\377"
+ 473      C14BFFCD 
+ 473      C14AFFCD 
+ 473      C14AFFCD 
+ 473      C149FF
+ 474 1c4c CCC149FF 		.ascii	"\314\301I\377\314\301H\377\314\301G\377\314\301G\377\313\301"
+ 474      CCC148FF 
+ 474      CCC147FF 
+ 474      CCC147FF 
+ 474      CBC1
+ 475 1c5e 46FFCBC1 		.ascii	"F\377\313\301E\377\313\301E\377\312\301D\377\312\301D\377\312"
+ 475      45FFCBC1 
+ 475      45FFCAC1 
+ 475      44FFCAC1 
+GAS LISTING /tmp/cc60kbk9.s 			page 32
+
+
+ 475      44FFCA
+ 476 1c71 C143FFCA 		.ascii	"\301C\377\312\301B\377\311\301B\377\311\301A\377\311\301@\377"
+ 476      C142FFC9 
+ 476      C142FFC9 
+ 476      C141FFC9 
+ 476      C140FF
+ 477 1c84 C8C140FF 		.ascii	"\310\301@\377\310\301?\377\310\301>\377\307\301>\377\307\301"
+ 477      C8C13FFF 
+ 477      C8C13EFF 
+ 477      C7C13EFF 
+ 477      C7C1
+ 478 1c96 3DFFC7C1 		.ascii	"=\377\307\301<\377\306\301<\377\306\301;\377\306\301:\377\305"
+ 478      3CFFC6C1 
+ 478      3CFFC6C1 
+ 478      3BFFC6C1 
+ 478      3AFFC5
+ 479 1ca9 C13AFFC5 		.ascii	"\301:\377\305\3019\377\305\3018\377\304\3018\377\304\3017\377"
+ 479      C139FFC5 
+ 479      C138FFC4 
+ 479      C138FFC4 
+ 479      C137FF
+ 480 1cbc C4C136FF 		.ascii	"\304\3016\377\303\3016\377\303\3015\377\302\3014\377\302\301"
+ 480      C3C136FF 
+ 480      C3C135FF 
+ 480      C2C134FF 
+ 480      C2C1
+ 481 1cce 33FFC2C1 		.ascii	"3\377\302\3013\377\301\3012\377\301\3011\377\301\3011\377\300"
+ 481      33FFC1C1 
+ 481      32FFC1C1 
+ 481      31FFC1C1 
+ 481      31FFC0
+ 482 1ce1 C130FFC0 		.ascii	"\3010\377\300\301/\377\277\301.\377\277\301-\377\277\301-\377"
+ 482      C12FFFBF 
+ 482      C12EFFBF 
+ 482      C12DFFBF 
+ 482      C12DFF
+ 483 1cf4 BEC12CFF 		.ascii	"\276\301,\377\276\300+\377\276\277+\377\276\276*\377\276\275"
+ 483      BEC02BFF 
+ 483      BEBF2BFF 
+ 483      BEBE2AFF 
+ 483      BEBD
+ 484 1d06 29FFBEBC 		.ascii	")\377\276\274)\377\275\273(\377\275\272(\377\275\271'\377\275"
+ 484      29FFBDBB 
+ 484      28FFBDBA 
+ 484      28FFBDB9 
+ 484      27FFBD
+ 485 1d19 B827FFBD 		.ascii	"\270'\377\275\267&\377\274\266%\377\274\265%\377\274\264$\377"
+ 485      B726FFBC 
+ 485      B625FFBC 
+ 485      B525FFBC 
+ 485      B424FF
+ 486 1d2c BCB324FF 		.ascii	"\274\263$\377\273\262#\377\273\262#\377\273\261\"\377\273\260"
+ 486      BBB223FF 
+ 486      BBB223FF 
+ 486      BBB122FF 
+ 486      BBB0
+ 487 1d3e 22FFBAAF 		.ascii	"\"\377\272\257!\377\272\256!\377\272\255 \377\272\254 \377\271"
+GAS LISTING /tmp/cc60kbk9.s 			page 33
+
+
+ 487      21FFBAAE 
+ 487      21FFBAAD 
+ 487      20FFBAAC 
+ 487      20FFB9
+ 488 1d51 AB1FFFB9 		.ascii	"\253\037\377\271\252\037\377\271\251\036\377\271\250\036\377"
+ 488      AA1FFFB9 
+ 488      A91EFFB9 
+ 488      A81EFF
+ 489 1d60 B8A71DFF 		.ascii	"\270\247\035\377\270\246\035\377\270\245\034\377\267\244\034"
+ 489      B8A61DFF 
+ 489      B8A51CFF 
+ 489      B7A41C
+ 490 1d6f FFB7A41C 		.ascii	"\377\267\244\034\377\267\243\033\377\266\242\033\377\266\241"
+ 490      FFB7A31B 
+ 490      FFB6A21B 
+ 490      FFB6A1
+ 491 1d7e 1AFFB6A0 		.ascii	"\032\377\266\240\032\377\265\237\032\377\265\236\031\377\265"
+ 491      1AFFB59F 
+ 491      1AFFB59E 
+ 491      19FFB5
+ 492 1d8d 9D19FFB4 		.ascii	"\235\031\377\264\234\031\377\264\233\030\377\264\232\030\377"
+ 492      9C19FFB4 
+ 492      9B18FFB4 
+ 492      9A18FF
+ 493 1d9c B39A17FF 		.ascii	"\263\232\027\377\263\231\027\377\263\230\027\377\262\227\027"
+ 493      B39917FF 
+ 493      B39817FF 
+ 493      B29717
+ 494 1dab FFB29616 		.ascii	"\377\262\226\026\377\261\225\026\377\261\224\026\377\261\223"
+ 494      FFB19516 
+ 494      FFB19416 
+ 494      FFB193
+ 495 1dba 15FFB092 		.ascii	"\025\377\260\222\025\377\246{\016\377\245z\016\377\245y\r\377"
+ 495      15FFA67B 
+ 495      0EFFA57A 
+ 495      0EFFA579 
+ 495      0DFF
+ 496 1dcc A4780DFF 		.ascii	"\244x\r\377\244w\r\377\243w\r\377\243v\r\377\243u\f\377\242t"
+ 496      A4770DFF 
+ 496      A3770DFF 
+ 496      A3760DFF 
+ 496      A3750CFF 
+ 497 1de2 0CFFA273 		.ascii	"\f\377\242s\f\377\241r\f\377\241q\f\377\240p\f\377\240p\013\377"
+ 497      0CFFA172 
+ 497      0CFFA171 
+ 497      0CFFA070 
+ 497      0CFFA070 
+ 498 1df8 9F6F0BFF 		.ascii	"\237o\013\377\237n\013\377\236m\013\377\236l\013\377\235k\013"
+ 498      9F6E0BFF 
+ 498      9E6D0BFF 
+ 498      9E6C0BFF 
+ 498      9D6B0B
+ 499 1e0b FF9D6A0B 		.ascii	"\377\235j\013\377\234j\013\377\234i\n\377\233h\n\377\233g\n\377"
+ 499      FF9C6A0B 
+ 499      FF9C690A 
+ 499      FF9B680A 
+ 499      FF9B670A 
+GAS LISTING /tmp/cc60kbk9.s 			page 34
+
+
+ 500 1e20 9A660AFF 		.ascii	"\232f\n\377\232e\n\377\231e\n\377\231d\n\377\230c\n\377\230b"
+ 500      9A650AFF 
+ 500      99650AFF 
+ 500      99640AFF 
+ 500      98630AFF 
+ 501 1e36 0AFF9761 		.ascii	"\n\377\227a\n\377\227`\n\377\226`\n\377\226_\n\377\225^\n\377"
+ 501      0AFF9760 
+ 501      0AFF9660 
+ 501      0AFF965F 
+ 501      0AFF955E 
+ 502 1e4c 955D0AFF 		.ascii	"\225]\n\377\224\\\n\377\223[\n\377\223[\n\377\222Z\n\377\222"
+ 502      945C0AFF 
+ 502      935B0AFF 
+ 502      935B0AFF 
+ 502      925A0AFF 
+ 503 1e61 590AFF91 		.ascii	"Y\n\377\221X\n\377\221W\n\377\220W\n\377\217V\n\377\217U\n\377"
+ 503      580AFF91 
+ 503      570AFF90 
+ 503      570AFF8F 
+ 503      560AFF8F 
+ 504 1e78 8E540AFF 		.ascii	"\216T\n\377\216S\n\377\215S\n\377\214R\n\377\214Q\n\377\213P"
+ 504      8E530AFF 
+ 504      8D530AFF 
+ 504      8C520AFF 
+ 504      8C510AFF 
+ 505 1e8e 09FF8B50 		.ascii	"\t\377\213P\t\377\212P\t\377\212P\t\377\211O\t\377\211O\t\377"
+ 505      09FF8A50 
+ 505      09FF8A50 
+ 505      09FF894F 
+ 505      09FF894F 
+ 506 1ea4 894F09FF 		.ascii	"\211O\t\377\210O\t\377\210N\t\377\207N\t\377\207N\t\377\206M"
+ 506      884F09FF 
+ 506      884E09FF 
+ 506      874E09FF 
+ 506      874E09FF 
+ 507 1eba 09FF864D 		.ascii	"\t\377\206M\t\377\205M\t\377\205M\t\377\204L\t\377\204L\t\377"
+ 507      09FF854D 
+ 507      09FF854D 
+ 507      09FF844C 
+ 507      09FF844C 
+ 508 1ed0 844C09FF 		.ascii	"\204L\t\377\203L\t\377\203K\t\377\202K\t\377\202K\t\377\201K"
+ 508      834C09FF 
+ 508      834B09FF 
+ 508      824B09FF 
+ 508      824B09FF 
+ 509 1ee6 09FF814A 		.ascii	"\t\377\201J\t\377\200J\t\377\200J\t\377\200J\t\377\177I\t\377"
+ 509      09FF804A 
+ 509      09FF804A 
+ 509      09FF804A 
+ 509      09FF7F49 
+ 510 1efc 7F4909FF 		.ascii	"\177I\t\377~I\t\377~H\b\377}H\b\377}H\b\377|H\b\377|G\b\377|"
+ 510      7E4909FF 
+ 510      7E4808FF 
+ 510      7D4808FF 
+ 510      7D4808FF 
+ 511 1f19 4708FF7B 		.ascii	"G\b\377{G\b\377{G\b\377zF\b\377zF\b\377yF\b\377yF\b\377xE\b\377"
+ 511      4708FF7B 
+GAS LISTING /tmp/cc60kbk9.s 			page 35
+
+
+ 511      4708FF7A 
+ 511      4608FF7A 
+ 511      4608FF79 
+ 512 1f38 784508FF 		.ascii	"xE\b\377xE\b\377wE\b\377wD\b\377vD\b\377vD\b\377uD\b\377uC\b"
+ 512      784508FF 
+ 512      774508FF 
+ 512      774408FF 
+ 512      764408FF 
+ 513 1f57 FF693C07 		.ascii	"\377i<\007\377i<\007\377h<\007\377h<\007\377g;\007\377g;\007"
+ 513      FF693C07 
+ 513      FF683C07 
+ 513      FF683C07 
+ 513      FF673B07 
+ 514 1f6f FF673B07 		.ascii	"\377g;\007\377f;\007\377f:\007\377e:\007\377e:\007\377d:\006"
+ 514      FF663B07 
+ 514      FF663A07 
+ 514      FF653A07 
+ 514      FF653A07 
+ 515 1f87 FF643906 		.ascii	"\377d9\006\377d9\006\377c9\006\377c9\006\377b8\006\377b8\006"
+ 515      FF643906 
+ 515      FF633906 
+ 515      FF633906 
+ 515      FF623806 
+ 516 1f9f FF613806 		.ascii	"\377a8\006\377a8\006\377a7\006\377`7\006\377`7\006\377_7\006"
+ 516      FF613806 
+ 516      FF613706 
+ 516      FF603706 
+ 516      FF603706 
+ 517 1fb7 FF5F3606 		.ascii	"\377_6\006\377^6\006\377"
+ 517      FF5E3606 
+ 517      FF
+ 518 1fc0 5E3606FF 		.ascii	"^6\006\377^6\006\377]5\006\377]5\006\377\\5\006\377\\4\006\377"
+ 518      5E3606FF 
+ 518      5D3506FF 
+ 518      5D3506FF 
+ 518      5C3506FF 
+ 519 1fd8 5B3406FF 		.ascii	"[4\006\377[4\006\377[4\006\377Z3\006\377Z3\006\377Y3\005\377"
+ 519      5B3406FF 
+ 519      5B3406FF 
+ 519      5A3306FF 
+ 519      5A3306FF 
+ 520 1ff0 593305FF 		.ascii	"Y3\005\377X2\005\377X2\005\377X2\005\377W2\005\377W1\005\377"
+ 520      583205FF 
+ 520      583205FF 
+ 520      583205FF 
+ 520      573205FF 
+ 521 2008 563105FF 		.ascii	"V1\005\377V1\005\377V1\005\377U0\005\377U0\005\377T0\005\377"
+ 521      563105FF 
+ 521      563105FF 
+ 521      553005FF 
+ 521      553005FF 
+ 522 2020 543005FF 		.ascii	"T0\005\377"
+ 523              		.globl	heatmap_cs_BrBG_soft
+ 524              		.section	.data.rel.local
+ 525              		.align 8
+ 526              		.type	heatmap_cs_BrBG_soft, @object
+ 527              		.size	heatmap_cs_BrBG_soft, 8
+GAS LISTING /tmp/cc60kbk9.s 			page 36
+
+
+ 528              	heatmap_cs_BrBG_soft:
+ 529 0010 00000000 		.quad	soft
+ 529      00000000 
+ 530              		.section	.data.rel.ro.local
+ 531              		.align 16
+ 532              		.type	soft, @object
+ 533              		.size	soft, 16
+ 534              	soft:
+ 535 0020 00000000 		.quad	soft_data
+ 535      00000000 
+ 536 0028 01040000 		.quad	1025
+ 536      00000000 
+ 537              		.section	.rodata
+ 538 2024 00000000 		.align 32
+ 538      00000000 
+ 538      00000000 
+ 538      00000000 
+ 538      00000000 
+ 539              		.type	soft_data, @object
+ 540              		.size	soft_data, 4100
+ 541              	soft_data:
+ 542 2040 00       		.string	""
+ 543 2041 00       		.string	""
+ 544 2042 00       		.string	""
+ 545 2043 00       		.string	""
+ 546 2044 00       		.string	""
+ 547 2045 3C2F00   		.string	"</"
+ 548 2048 00       		.string	""
+ 549 2049 3C300700 		.string	"<0\007"
+ 550 204d 3C300E00 		.string	"<0\016"
+ 551 2051 3D311600 		.string	"=1\026"
+ 552 2055 3D311D00 		.string	"=1\035"
+ 553 2059 3D322500 		.string	"=2%"
+ 554 205d 3E322C00 		.string	">2,"
+ 555 2061 3E323400 		.string	">24"
+ 556 2065 3F333B00 		.string	"?3;"
+ 557 2069 3F334300 		.string	"?3C"
+ 558 206d 3F344A00 		.string	"?4J"
+ 559 2071 40345200 		.string	"@4R"
+ 560 2075 40345900 		.string	"@4Y"
+ 561 2079 41356100 		.string	"A5a"
+ 562 207d 41356800 		.string	"A5h"
+ 563 2081 41367000 		.string	"A6p"
+ 564 2085 42367700 		.string	"B6w"
+ 565 2089 42377F00 		.string	"B7\177"
+ 566 208d 43378600 		.string	"C7\206"
+ 567 2091 43378D00 		.string	"C7\215"
+ 568 2095 43389500 		.string	"C8\225"
+ 569 2099 44389C00 		.string	"D8\234"
+ 570 209d 4439A400 		.string	"D9\244"
+ 571 20a1 4539AB00 		.string	"E9\253"
+ 572 20a5 4539B300 		.string	"E9\263"
+ 573 20a9 453ABA00 		.string	"E:\272"
+ 574 20ad 463AC200 		.string	"F:\302"
+ 575 20b1 463BC900 		.string	"F;\311"
+ 576 20b5 473BD100 		.string	"G;\321"
+ 577 20b9 473CD800 		.string	"G<\330"
+GAS LISTING /tmp/cc60kbk9.s 			page 37
+
+
+ 578 20bd 473CE000 		.string	"G<\340"
+ 579 20c1 483DE700 		.string	"H=\347"
+ 580 20c5 483DEF00 		.string	"H=\357"
+ 581 20c9 493DF600 		.string	"I=\366"
+ 582 20cd 493EFE00 		.string	"I>\376"
+ 583 20d1 493EFF00 		.string	"I>\377"
+ 584 20d5 4A3FFF00 		.string	"J?\377"
+ 585 20d9 4A3FFF00 		.string	"J?\377"
+ 586 20dd 4B40FF00 		.string	"K@\377"
+ 587 20e1 4B40FF00 		.string	"K@\377"
+ 588 20e5 4B40FF00 		.string	"K@\377"
+ 589 20e9 4C41FF00 		.string	"LA\377"
+ 590 20ed 4C41FF00 		.string	"LA\377"
+ 591 20f1 4D42FF00 		.string	"MB\377"
+ 592 20f5 4D42FF00 		.string	"MB\377"
+ 593 20f9 4E43FF00 		.string	"NC\377"
+ 594 20fd 4E43FF00 		.string	"NC\377"
+ 595 2101 4E44FF00 		.string	"ND\377"
+ 596 2105 4F44FF00 		.string	"OD\377"
+ 597 2109 4F44FF00 		.string	"OD\377"
+ 598 210d 5045FF00 		.string	"PE\377"
+ 599 2111 5045FF00 		.string	"PE\377"
+ 600 2115 5046FF00 		.string	"PF\377"
+ 601 2119 5146FF00 		.string	"QF\377"
+ 602 211d 5147FF00 		.string	"QG\377"
+ 603 2121 5247FF00 		.string	"RG\377"
+ 604 2125 5248FF00 		.string	"RH\377"
+ 605 2129 5248FF00 		.string	"RH\377"
+ 606 212d 5348FF00 		.string	"SH\377"
+ 607 2131 5349FF01 		.ascii	"SI\377\001TI\377\001TJ\377\001UJ\377\001UK\377\001UK\377\001"
+ 607      5449FF01 
+ 607      544AFF01 
+ 607      554AFF01 
+ 607      554BFF01 
+ 608 2149 564CFF01 		.ascii	"VL\377\001VL\377\001WM\377\001WM\377\001WN\377\001XN\377\001"
+ 608      564CFF01 
+ 608      574DFF01 
+ 608      574DFF01 
+ 608      574EFF01 
+ 609 2161 584EFF01 		.ascii	"XN\377\001YO\377\001YO\377\001ZP\377\001ZP\377\001ZQ\377\001"
+ 609      594FFF01 
+ 609      594FFF01 
+ 609      5A50FF01 
+ 609      5A50FF01 
+ 610 2179 5B51FF01 		.ascii	"[Q\377\001[R\377\001\\R\377\001\\S\377\001\\S\377\001]T\377\001"
+ 610      5B52FF01 
+ 610      5C52FF01 
+ 610      5C53FF01 
+ 610      5C53FF01 
+ 611 2191 5D54FF01 		.ascii	"]T\377\001^U\377\001^U\377\001_V\377\001_V\377\001_W\377\001"
+ 611      5E55FF01 
+ 611      5E55FF01 
+ 611      5F56FF01 
+ 611      5F56FF01 
+ 612 21a9 6057FF01 		.ascii	"`W\377\001`W\377\001aX\377\001aX\377\001bY\377\001bY\377\001"
+ 612      6057FF01 
+ 612      6158FF01 
+GAS LISTING /tmp/cc60kbk9.s 			page 38
+
+
+ 612      6158FF01 
+ 612      6259FF01 
+ 613 21c1 625AFF01 		.ascii	"bZ\377\001cZ\377\001c[\377\001d[\377\001d\\\377\001d\\\377\001"
+ 613      635AFF01 
+ 613      635BFF01 
+ 613      645BFF01 
+ 613      645CFF01 
+ 614 21d9 655DFF01 		.ascii	"e]\377\001e]\377\001f^\377\002f^\377\002g_\377\003g_\377\003"
+ 614      655DFF01 
+ 614      665EFF02 
+ 614      665EFF02 
+ 614      675FFF03 
+ 615 21f1 6860FF04 		.ascii	"h`\377\004h`\377\005ia\377\005ia\377\006ia\377\007jb\377\bjb"
+ 615      6860FF05 
+ 615      6961FF05 
+ 615      6961FF06 
+ 615      6961FF07 
+ 616 220b FF086B63 		.ascii	"\377\bkc\377\tkc\377\nld\377\013ld\377\013me\377\fme\377\rnf"
+ 616      FF096B63 
+ 616      FF0A6C64 
+ 616      FF0B6C64 
+ 616      FF0B6D65 
+ 617 2227 FF0D6E66 		.ascii	"\377\rnf\377\016og\377\016og\377\017pg\377\020ph\377\020ph\377"
+ 617      FF0E6F67 
+ 617      FF0E6F67 
+ 617      FF0F7067 
+ 617      FF107068 
+ 618 2240 117169FF 		.ascii	"\021qi\377\021qi\377\022rj\377\023rj\377\023sk\377\024sk\377"
+ 618      117169FF 
+ 618      12726AFF 
+ 618      13726AFF 
+ 618      13736BFF 
+ 619 2258 14746CFF 		.ascii	"\024tl\377\025tl\377\025um\377\026um\377\026vn\377\027vn\377"
+ 619      15746CFF 
+ 619      15756DFF 
+ 619      16756DFF 
+ 619      16766EFF 
+ 620 2270 17776FFF 		.ascii	"\027wo\377\030wo\377\030xo\377\031xp\377\031yp\377\032yq\377"
+ 620      18776FFF 
+ 620      18786FFF 
+ 620      197870FF 
+ 620      197970FF 
+ 621 2288 1A7971FF 		.ascii	"\032yq\377\033zr\377\033zr\377\034{s\377\034{s\377\035|t\377"
+ 621      1B7A72FF 
+ 621      1B7A72FF 
+ 621      1C7B73FF 
+ 621      1C7B73FF 
+ 622 22a0 1D7C74FF 		.ascii	"\035|t\377\036}u\377\036}u\377\037~v\377\037~v\377 \177w\377"
+ 622      1E7D75FF 
+ 622      1E7D75FF 
+ 622      1F7E76FF 
+ 622      1F7E76FF 
+ 623 22b8 207F77FF 		.ascii	" \177w\377 \200x\377!\200x\377!\201y\377\"\201y\377\"\202z\377"
+ 623      208078FF 
+ 623      218078FF 
+ 623      218179FF 
+ 623      228179FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 39
+
+
+ 624 22d0 23827AFF 		.ascii	"#\202z\377#\203z\377$\203{\377$\204{\377%\204|\377%\205|\377"
+ 624      23837AFF 
+ 624      24837BFF 
+ 624      24847BFF 
+ 624      25847CFF 
+ 625 22e8 25857DFF 		.ascii	"%\205}\377&\205}\377&\206~\377'\206~\377'\207\177\377(\207\177"
+ 625      26857DFF 
+ 625      26867EFF 
+ 625      27867EFF 
+ 625      27877FFF 
+ 626 22ff FF288880 		.ascii	"\377(\210\200\377(\210\200\377)\211\201\377)\211\201\377*\212"
+ 626      FF288880 
+ 626      FF298981 
+ 626      FF298981 
+ 626      FF2A8A
+ 627 2312 82FF2A8A 		.ascii	"\202\377*\212\202\377+\213\203\377+\213\203\377+\214\204\377"
+ 627      82FF2B8B 
+ 627      83FF2B8B 
+ 627      83FF2B8C 
+ 627      84FF
+ 628 2324 2C8C84FF 		.ascii	",\214\204\377,\215\205\377-\215\205\377-\216\206\377.\216\206"
+ 628      2C8D85FF 
+ 628      2D8D85FF 
+ 628      2D8E86FF 
+ 628      2E8E86
+ 629 2337 FF2E8F87 		.ascii	"\377.\217\207\377.\217\207\377/\220\210\377/\220\210\3770\221"
+ 629      FF2E8F87 
+ 629      FF2F9088 
+ 629      FF2F9088 
+ 629      FF3091
+ 630 234a 89FF3091 		.ascii	"\211\3770\221\211\3770\222\212\3771\222\212\3771\223\213\377"
+ 630      89FF3092 
+ 630      8AFF3192 
+ 630      8AFF3193 
+ 630      8BFF
+ 631 235c 32938BFF 		.ascii	"2\223\213\3772\224\214\3773\224\214\3773\225\215\3773\225\215"
+ 631      32948CFF 
+ 631      33948CFF 
+ 631      33958DFF 
+ 631      33958D
+ 632 236f FF34968E 		.ascii	"\3774\226\216\3774\226\216\3775\227\217\3776\227\217\3776\230"
+ 632      FF34968E 
+ 632      FF35978F 
+ 632      FF36978F 
+ 632      FF3698
+ 633 2382 90FF3798 		.ascii	"\220\3777\230\220\3778\231\220\3779\231\221\377:\232\221\377"
+ 633      90FF3899 
+ 633      90FF3999 
+ 633      91FF3A9A 
+ 633      91FF
+ 634 2394 3B9A92FF 		.ascii	";\232\222\377;\233\222\377<\233\223\377=\234\223\377>\234\224"
+ 634      3B9B92FF 
+ 634      3C9B93FF 
+ 634      3D9C93FF 
+ 634      3E9C94
+ 635 23a7 FF3F9D94 		.ascii	"\377?\235\224\377@\235\225\377@\236\225\377A\236\226\377B\237"
+ 635      FF409D95 
+GAS LISTING /tmp/cc60kbk9.s 			page 40
+
+
+ 635      FF409E95 
+ 635      FF419E96 
+ 635      FF429F
+ 636 23ba 96FF439F 		.ascii	"\226\377C\237\227\377C\240\227\377D\240\230\377E\241\230\377"
+ 636      97FF43A0 
+ 636      97FF44A0 
+ 636      98FF45A1 
+ 636      98FF
+ 637 23cc 46A199FF 		.ascii	"F\241\231\377G\242\231\377G\243\231\377H\243\232\377I\244\232"
+ 637      47A299FF 
+ 637      47A399FF 
+ 637      48A39AFF 
+ 637      49A49A
+ 638 23df FF4AA49B 		.ascii	"\377J\244\233\377J\245\233\377K\245\234\377L\246\234\377M\246"
+ 638      FF4AA59B 
+ 638      FF4BA59C 
+ 638      FF4CA69C 
+ 638      FF4DA6
+ 639 23f2 9DFF4DA7 		.ascii	"\235\377M\247\235\377N\247\236\377O\250\236\377P\250\237\377"
+ 639      9DFF4EA7 
+ 639      9EFF4FA8 
+ 639      9EFF50A8 
+ 639      9FFF
+ 640 2404 50A99FFF 		.ascii	"P\251\237\377Q\251\240\377R\252\240\377S\252\241\377S\253\241"
+ 640      51A9A0FF 
+ 640      52AAA0FF 
+ 640      53AAA1FF 
+ 640      53ABA1
+ 641 2417 FF54ABA2 		.ascii	"\377T\253\242\377U\254\242\377V\254\243\377V\255\243\377W\255"
+ 641      FF55ACA2 
+ 641      FF56ACA3 
+ 641      FF56ADA3 
+ 641      FF57AD
+ 642 242a A4FF58AE 		.ascii	"\244\377X\256\244\377X\257\245\377Y\257\245\377Z\260\246\377"
+ 642      A4FF58AF 
+ 642      A5FF59AF 
+ 642      A5FF5AB0 
+ 642      A6FF
+ 643 243c 5BB0A6FF 		.ascii	"[\260\246\377[\261\247\377\\\261\247\377]\262\250\377]\262\250"
+ 643      5BB1A7FF 
+ 643      5CB1A7FF 
+ 643      5DB2A8FF 
+ 643      5DB2A8
+ 644 244f FF5EB3A8 		.ascii	"\377^\263\250\377_\263\251\377`\264\251\377`\264\252\377a\265"
+ 644      FF5FB3A9 
+ 644      FF60B4A9 
+ 644      FF60B4AA 
+ 644      FF61B5
+ 645 2462 AAFF62B5 		.ascii	"\252\377b\265\253\377b\266\253\377c\266\254\377d\267\254\377"
+ 645      ABFF62B6 
+ 645      ABFF63B6 
+ 645      ACFF64B7 
+ 645      ACFF
+ 646 2474 64B8ADFF 		.ascii	"d\270\255\377e\270\255\377f\271\256\377g\271\256\377g\272\257"
+ 646      65B8ADFF 
+ 646      66B9AEFF 
+ 646      67B9AEFF 
+GAS LISTING /tmp/cc60kbk9.s 			page 41
+
+
+ 646      67BAAF
+ 647 2487 FF68BAAF 		.ascii	"\377h\272\257\377i\273\260\377i\273\260\377j\274\261\377k\274"
+ 647      FF69BBB0 
+ 647      FF69BBB0 
+ 647      FF6ABCB1 
+ 647      FF6BBC
+ 648 249a B1FF6BBD 		.ascii	"\261\377k\275\262\377l\275\262\377m\276\263\377n\276\263\377"
+ 648      B2FF6CBD 
+ 648      B2FF6DBE 
+ 648      B3FF6EBE 
+ 648      B3FF
+ 649 24ac 6EBFB4FF 		.ascii	"n\277\264\377o\300\264\377p\300\265\377p\301\265\377q\301\266"
+ 649      6FC0B4FF 
+ 649      70C0B5FF 
+ 649      70C1B5FF 
+ 649      71C1B6
+ 650 24bf FF72C2B6 		.ascii	"\377r\302\266\377r\302\267\377s\303\267\377t\303\270\377t\304"
+ 650      FF72C2B7 
+ 650      FF73C3B7 
+ 650      FF74C3B8 
+ 650      FF74C4
+ 651 24d2 B8FF75C4 		.ascii	"\270\377u\304\271\377v\305\271\377v\305\272\377w\306\272\377"
+ 651      B9FF76C5 
+ 651      B9FF76C5 
+ 651      BAFF77C6 
+ 651      BAFF
+ 652 24e4 78C6BBFF 		.ascii	"x\306\273\377y\307\273\377y\310\274\377z\310\274\377{\311\275"
+ 652      79C7BBFF 
+ 652      79C8BCFF 
+ 652      7AC8BCFF 
+ 652      7BC9BD
+ 653 24f7 FF7BC9BD 		.ascii	"\377{\311\275\377|\312\276\377}\312\276\377}\313\277\377~\313"
+ 653      FF7CCABE 
+ 653      FF7DCABE 
+ 653      FF7DCBBF 
+ 653      FF7ECB
+ 654 250a BFFF7FCC 		.ascii	"\277\377\177\314\300\377\177\314\300\377\200\315\301\377\201"
+ 654      C0FF7FCC 
+ 654      C0FF80CD 
+ 654      C1FF81
+ 655 2519 CDC1FF82 		.ascii	"\315\301\377\202\315\302\377\202\316\302\377\203\316\302\377"
+ 655      CDC2FF82 
+ 655      CEC2FF83 
+ 655      CEC2FF
+ 656 2528 84CEC3FF 		.ascii	"\204\316\303\377\204\316\303\377\205\317\303\377\206\317\304"
+ 656      84CEC3FF 
+ 656      85CFC3FF 
+ 656      86CFC4
+ 657 2537 FF87CFC4 		.ascii	"\377\207\317\304\377\207\320\304\377\210\320\305\377\211\320"
+ 657      FF87D0C4 
+ 657      FF88D0C5 
+ 657      FF89D0
+ 658 2546 C5FF89D0 		.ascii	"\305\377\211\320\305\377\212\321\306\377\213\321\306\377\214"
+ 658      C5FF8AD1 
+ 658      C6FF8BD1 
+ 658      C6FF8C
+ 659 2555 D1C7FF8C 		.ascii	"\321\307\377\214\322\307\377\215\322\307\377\216\322\310\377"
+GAS LISTING /tmp/cc60kbk9.s 			page 42
+
+
+ 659      D2C7FF8D 
+ 659      D2C7FF8E 
+ 659      D2C8FF
+ 660 2564 8ED2C8FF 		.ascii	"\216\322\310\377\217\323\310\377\220\323\311\377\221\323\311"
+ 660      8FD3C8FF 
+ 660      90D3C9FF 
+ 660      91D3C9
+ 661 2573 FF91D4C9 		.ascii	"\377\221\324\311\377\222\324\312\377\223\324\312\377\223\324"
+ 661      FF92D4CA 
+ 661      FF93D4CA 
+ 661      FF93D4
+ 662 2582 CAFF94D5 		.ascii	"\312\377\224\325\313\377\225\325\313\377\226\325\314\377\226"
+ 662      CBFF95D5 
+ 662      CBFF96D5 
+ 662      CCFF96
+ 663 2591 D6CCFF97 		.ascii	"\326\314\377\227\326\314\377\230\326\315\377\230\326\315\377"
+ 663      D6CCFF98 
+ 663      D6CDFF98 
+ 663      D6CDFF
+ 664 25a0 99D7CDFF 		.ascii	"\231\327\315\377\232\327\316\377\232\327\316\377\233\330\316"
+ 664      9AD7CEFF 
+ 664      9AD7CEFF 
+ 664      9BD8CE
+ 665 25af FF9CD8CF 		.ascii	"\377\234\330\317\377\234\330\317\377\235\330\317\377\236\331"
+ 665      FF9CD8CF 
+ 665      FF9DD8CF 
+ 665      FF9ED9
+ 666 25be D0FF9FD9 		.ascii	"\320\377\237\331\320\377\237\331\320\377\240\332\321\377\241"
+ 666      D0FF9FD9 
+ 666      D0FFA0DA 
+ 666      D1FFA1
+ 667 25cd DAD1FFA1 		.ascii	"\332\321\377\241\332\322\377\242\332\322\377\243\333\322\377"
+ 667      DAD2FFA2 
+ 667      DAD2FFA3 
+ 667      DBD2FF
+ 668 25dc A3DBD3FF 		.ascii	"\243\333\323\377\244\333\323\377\245\334\323\377\245\334\324"
+ 668      A4DBD3FF 
+ 668      A5DCD3FF 
+ 668      A5DCD4
+ 669 25eb FFA6DCD4 		.ascii	"\377\246\334\324\377\247\334\324\377\250\335\325\377\250\335"
+ 669      FFA7DCD4 
+ 669      FFA8DDD5 
+ 669      FFA8DD
+ 670 25fa D5FFA9DD 		.ascii	"\325\377\251\335\325\377\252\336\326\377\252\336\326\377\253"
+ 670      D5FFAADE 
+ 670      D6FFAADE 
+ 670      D6FFAB
+ 671 2609 DED6FFAC 		.ascii	"\336\326\377\254\336\327\377\254\337\327\377\255\337\327\377"
+ 671      DED7FFAC 
+ 671      DFD7FFAD 
+ 671      DFD7FF
+ 672 2618 AEDFD8FF 		.ascii	"\256\337\330\377\256\337\330\377\257\340\331\377\260\340\331"
+ 672      AEDFD8FF 
+ 672      AFE0D9FF 
+ 672      B0E0D9
+ 673 2627 FFB0E0D9 		.ascii	"\377\260\340\331\377\261\341\332\377\262\341\332\377\262\341"
+ 673      FFB1E1DA 
+GAS LISTING /tmp/cc60kbk9.s 			page 43
+
+
+ 673      FFB2E1DA 
+ 673      FFB2E1
+ 674 2636 DAFFB3E1 		.ascii	"\332\377\263\341\333\377\264\342\333\377\265\342\333\377\265"
+ 674      DBFFB4E2 
+ 674      DBFFB5E2 
+ 674      DBFFB5
+ 675 2645 E2DCFFB6 		.ascii	"\342\334\377\266\343\334\377\267\343\334\377\267\343\335\377"
+ 675      E3DCFFB7 
+ 675      E3DCFFB7 
+ 675      E3DDFF
+ 676 2654 B8E3DDFF 		.ascii	"\270\343\335\377\271\344\335\377\271\344\336\377\272\344\336"
+ 676      B9E4DDFF 
+ 676      B9E4DEFF 
+ 676      BAE4DE
+ 677 2663 FFBBE5DE 		.ascii	"\377\273\345\336\377\273\345\337\377\274\345\337\377\275\345"
+ 677      FFBBE5DF 
+ 677      FFBCE5DF 
+ 677      FFBDE5
+ 678 2672 DFFFBDE6 		.ascii	"\337\377\275\346\340\377\276\346\340\377\277\346\341\377\277"
+ 678      E0FFBEE6 
+ 678      E0FFBFE6 
+ 678      E1FFBF
+ 679 2681 E7E1FFC0 		.ascii	"\347\341\377\300\347\341\377\301\347\342\377\301\347\342\377"
+ 679      E7E1FFC1 
+ 679      E7E2FFC1 
+ 679      E7E2FF
+ 680 2690 C2E8E2FF 		.ascii	"\302\350\342\377\303\350\343\377\303\350\343\377\304\350\343"
+ 680      C3E8E3FF 
+ 680      C3E8E3FF 
+ 680      C4E8E3
+ 681 269f FFC5E9E4 		.ascii	"\377\305\351\344\377\305\351\344\377\306\351\344\377\372\332"
+ 681      FFC5E9E4 
+ 681      FFC6E9E4 
+ 681      FFFADA
+ 682 26ae E3FFFADB 		.ascii	"\343\377\372\333\344\377\372\333\345\377\371\333\346\377\371"
+ 682      E4FFFADB 
+ 682      E5FFF9DB 
+ 682      E6FFF9
+ 683 26bd DCE6FFF8 		.ascii	"\334\346\377\370\334\347\377\370\334\350\377\370\335\351\377"
+ 683      DCE7FFF8 
+ 683      DCE8FFF8 
+ 683      DDE9FF
+ 684 26cc F7DDE9FF 		.ascii	"\367\335\351\377\367\335\352\377\366\336\353\377\366\336\354"
+ 684      F7DDEAFF 
+ 684      F6DEEBFF 
+ 684      F6DEEC
+ 685 26db FFF5DEEC 		.ascii	"\377\365\336\354\377\365\337\355\377\364\337\356\377\364\337"
+ 685      FFF5DFED 
+ 685      FFF4DFEE 
+ 685      FFF4DF
+ 686 26ea EEFFF3E0 		.ascii	"\356\377\363\340\357\377\363\340\357\377\362\340\360\377\362"
+ 686      EFFFF3E0 
+ 686      EFFFF2E0 
+ 686      F0FFF2
+ 687 26f9 E1F0FFF1 		.ascii	"\341\360\377\361\341\361\377\361\342\361\377\360\342\362\377"
+ 687      E1F1FFF1 
+ 687      E2F1FFF0 
+GAS LISTING /tmp/cc60kbk9.s 			page 44
+
+
+ 687      E2F2FF
+ 688 2708 F0E2F2FF 		.ascii	"\360\342\362\377\357\343\363\377\357\343\363\377\356\343\363"
+ 688      EFE3F3FF 
+ 688      EFE3F3FF 
+ 688      EEE3F3
+ 689 2717 FFEEE4F4 		.ascii	"\377\356\344\364\377\355\344\364\377\355\344\365\377\354\345"
+ 689      FFEDE4F4 
+ 689      FFEDE4F5 
+ 689      FFECE5
+ 690 2726 F5FFECE5 		.ascii	"\365\377\354\345\365\377\354\346\365\377\353\346\366\377\353"
+ 690      F5FFECE6 
+ 690      F5FFEBE6 
+ 690      F6FFEB
+ 691 2735 E6F6FFEA 		.ascii	"\346\366\377\352\347\366\377\352\347\366\377\352\347\366\377"
+ 691      E7F6FFEA 
+ 691      E7F6FFEA 
+ 691      E7F6FF
+ 692 2744 E9E8F7FF 		.ascii	"\351\350\367\377\351\350\367\377\351\350\367\377\350\351\367"
+ 692      E9E8F7FF 
+ 692      E9E8F7FF 
+ 692      E8E9F7
+ 693 2753 FFE8E9F7 		.ascii	"\377\350\351\367\377\350\351\367\377\347\352\367\377\347\352"
+ 693      FFE8E9F7 
+ 693      FFE7EAF7 
+ 693      FFE7EA
+ 694 2762 F7FFE7EA 		.ascii	"\367\377\347\352\367\377\347\353\367\377\347\353\367\377\346"
+ 694      F7FFE7EB 
+ 694      F7FFE7EB 
+ 694      F7FFE6
+ 695 2771 EBF7FFE6 		.ascii	"\353\367\377\346\353\367\377\346\354\367\377\346\354\367\377"
+ 695      EBF7FFE6 
+ 695      ECF7FFE6 
+ 695      ECF7FF
+ 696 2780 E6ECF7FF 		.ascii	"\346\354\367\377\346\355\367\377\346\355\367\377\346\355\367"
+ 696      E6EDF7FF 
+ 696      E6EDF7FF 
+ 696      E6EDF7
+ 697 278f FFE6EDF7 		.ascii	"\377\346\355\367\377\346\356\367\377\346\356\367\377\346\356"
+ 697      FFE6EEF7 
+ 697      FFE6EEF7 
+ 697      FFE6EE
+ 698 279e F6FFE6EE 		.ascii	"\366\377\346\356\366\377\346\357\366\377\346\357\366\377\346"
+ 698      F6FFE6EF 
+ 698      F6FFE6EF 
+ 698      F6FFE6
+ 699 27ad EFF6FFE7 		.ascii	"\357\366\377\347\357\366\377\347\357\366\377\347\360\366\377"
+ 699      EFF6FFE7 
+ 699      EFF6FFE7 
+ 699      F0F6FF
+ 700 27bc E7F0F5FF 		.ascii	"\347\360\365\377\347\360\365\377\350\360\365\377\350\360\365"
+ 700      E7F0F5FF 
+ 700      E8F0F5FF 
+ 700      E8F0F5
+ 701 27cb FFE8F1F5 		.ascii	"\377\350\361\365\377\350\361\365\377\351\361\365\377\351\361"
+ 701      FFE8F1F5 
+ 701      FFE9F1F5 
+ 701      FFE9F1
+GAS LISTING /tmp/cc60kbk9.s 			page 45
+
+
+ 702 27da F5FFE9F1 		.ascii	"\365\377\351\361\364\377\352\361\364\377\352\362\364\377\352"
+ 702      F4FFEAF1 
+ 702      F4FFEAF2 
+ 702      F4FFEA
+ 703 27e9 F2F4FFEB 		.ascii	"\362\364\377\353\362\364\377\353\362\364\377\354\362\364\377"
+ 703      F2F4FFEB 
+ 703      F2F4FFEC 
+ 703      F2F4FF
+ 704 27f8 ECF2F4FF 		.ascii	"\354\362\364\377\354\362\364\377\355\363\364\377\355\363\364"
+ 704      ECF2F4FF 
+ 704      EDF3F4FF 
+ 704      EDF3F4
+ 705 2807 FFEEF3F4 		.ascii	"\377\356\363\364\377\356\363\364\377"
+ 705      FFEEF3F4 
+ 705      FF
+ 706 2810 EFF3F4FF 		.ascii	"\357\363\364\377\357\363\364\377\360\363\364\377\360\363\364"
+ 706      EFF3F4FF 
+ 706      F0F3F4FF 
+ 706      F0F3F4
+ 707 281f FFF0F4F4 		.ascii	"\377\360\364\364\377\361\364\364\377\361\364\364\377\362\364"
+ 707      FFF1F4F4 
+ 707      FFF1F4F4 
+ 707      FFF2F4
+ 708 282e F4FFF2F4 		.ascii	"\364\377\362\364\364\377\363\364\364\377\363\364\364\377\364"
+ 708      F4FFF3F4 
+ 708      F4FFF3F4 
+ 708      F4FFF4
+ 709 283d F4F4FFF4 		.ascii	"\364\364\377\364\364\364\377\364\365\365\377\365\364\364\377"
+ 709      F4F4FFF4 
+ 709      F5F5FFF5 
+ 709      F4F4FF
+ 710 284c F5F4F4FF 		.ascii	"\365\364\364\377\365\364\364\377\366\364\364\377\366\363\364"
+ 710      F5F4F4FF 
+ 710      F6F4F4FF 
+ 710      F6F3F4
+ 711 285b FFF6F3F4 		.ascii	"\377\366\363\364\377\367\363\363\377\367\363\363\377\367\362"
+ 711      FFF7F3F3 
+ 711      FFF7F3F3 
+ 711      FFF7F2
+ 712 286a F3FFF7F2 		.ascii	"\363\377\367\362\363\377\370\362\363\377\370\362\362\377\370"
+ 712      F3FFF8F2 
+ 712      F3FFF8F2 
+ 712      F2FFF8
+ 713 2879 F1F2FFF9 		.ascii	"\361\362\377\371\361\362\377\371\361\361\377\371\361\361\377"
+ 713      F1F2FFF9 
+ 713      F1F1FFF9 
+ 713      F1F1FF
+ 714 2888 FAF0F1FF 		.ascii	"\372\360\361\377\372\360\361\377\372\360\360\377\373\360\360"
+ 714      FAF0F1FF 
+ 714      FAF0F0FF 
+ 714      FBF0F0
+ 715 2897 FFFBEFF0 		.ascii	"\377\373\357\360\377\373\357\357\377\373\357\357\377\374\357"
+ 715      FFFBEFEF 
+ 715      FFFBEFEF 
+ 715      FFFCEF
+ 716 28a6 EEFFFCEF 		.ascii	"\356\377\374\357\356\377\374\356\356\377\375\356\355\377\375"
+ 716      EEFFFCEE 
+GAS LISTING /tmp/cc60kbk9.s 			page 46
+
+
+ 716      EEFFFDEE 
+ 716      EDFFFD
+ 717 28b5 EEEDFFFD 		.ascii	"\356\355\377\375\356\354\377\375\355\354\377\376\355\354\377"
+ 717      EEECFFFD 
+ 717      EDECFFFE 
+ 717      EDECFF
+ 718 28c4 FEEDEBFF 		.ascii	"\376\355\353\377\376\355\353\377\377\355\352\377\377\354\352"
+ 718      FEEDEBFF 
+ 718      FFEDEAFF 
+ 718      FFECEA
+ 719 28d3 FFFFECE9 		.ascii	"\377\377\354\351\377\377\354\351\377\377\354\350\377\377\354"
+ 719      FFFFECE9 
+ 719      FFFFECE8 
+ 719      FFFFEC
+ 720 28e2 E8FFFFEB 		.ascii	"\350\377\377\353\347\377\377\353\347\377\377\353\346\377\377"
+ 720      E7FFFFEB 
+ 720      E7FFFFEB 
+ 720      E6FFFF
+ 721 28f1 EBE6FFFF 		.ascii	"\353\346\377\377\353\345\377\377\353\344\377\377\352\344\377"
+ 721      EBE5FFFF 
+ 721      EBE4FFFF 
+ 721      EAE4FF
+ 722 2900 FFEAE3FF 		.ascii	"\377\352\343\377\377\352\343\377\377\352\342\377\377\352\342"
+ 722      FFEAE3FF 
+ 722      FFEAE2FF 
+ 722      FFEAE2
+ 723 290f FFFFEAE1 		.ascii	"\377\377\352\341\377\377\351\340\377\377\351\340\377\377\351"
+ 723      FFFFE9E0 
+ 723      FFFFE9E0 
+ 723      FFFFE9
+ 724 291e DFFFFFE9 		.ascii	"\337\377\377\351\337\377\377\351\336\377\377\351\335\377\377"
+ 724      DFFFFFE9 
+ 724      DEFFFFE9 
+ 724      DDFFFF
+ 725 292d E9DDFFFF 		.ascii	"\351\335\377\377\350\334\377\377\350\334\377\377\350\333\377"
+ 725      E8DCFFFF 
+ 725      E8DCFFFF 
+ 725      E8DBFF
+ 726 293c FFE8DAFF 		.ascii	"\377\350\332\377\377\350\332\377\377\350\331\377\377\350\330"
+ 726      FFE8DAFF 
+ 726      FFE8D9FF 
+ 726      FFE8D8
+ 727 294b FFFFE8D8 		.ascii	"\377\377\350\330\377\377\350\327\377\377\350\326\377\377\350"
+ 727      FFFFE8D7 
+ 727      FFFFE8D6 
+ 727      FFFFE8
+ 728 295a D6FFFFE7 		.ascii	"\326\377\377\347\325\377\377\347\325\377\377\347\324\377\377"
+ 728      D5FFFFE7 
+ 728      D5FFFFE7 
+ 728      D4FFFF
+ 729 2969 E7D3FFFF 		.ascii	"\347\323\377\377\347\323\377\377\347\322\377\377\347\321\377"
+ 729      E7D3FFFF 
+ 729      E7D2FFFF 
+ 729      E7D1FF
+ 730 2978 FFE7D1FF 		.ascii	"\377\347\321\377\377\347\320\377\377\347\320\377\377\347\317"
+ 730      FFE7D0FF 
+ 730      FFE7D0FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 47
+
+
+ 730      FFE7CF
+ 731 2987 FFFFE7CE 		.ascii	"\377\377\347\316\377\377\347\316\377\377\347\315\377\376\347"
+ 731      FFFFE7CE 
+ 731      FFFFE7CD 
+ 731      FFFEE7
+ 732 2996 CCFFFEE7 		.ascii	"\314\377\376\347\314\377\375\347\313\377\375\347\313\377\375"
+ 732      CCFFFDE7 
+ 732      CBFFFDE7 
+ 732      CBFFFD
+ 733 29a5 E7CAFFFC 		.ascii	"\347\312\377\374\347\312\377\374\347\311\377\373\347\310\377"
+ 733      E7CAFFFC 
+ 733      E7C9FFFB 
+ 733      E7C8FF
+ 734 29b4 FBE7C8FF 		.ascii	"\373\347\310\377\373\347\307\377\372\347\307\377\372\347\306"
+ 734      FBE7C7FF 
+ 734      FAE7C7FF 
+ 734      FAE7C6
+ 735 29c3 FFF9E7C6 		.ascii	"\377\371\347\306\377\371\347\305\377\370\347\305\377\367\347"
+ 735      FFF9E7C5 
+ 735      FFF8E7C5 
+ 735      FFF7E7
+ 736 29d2 C4FFF7E7 		.ascii	"\304\377\367\347\304\377\366\347\303\377\366\347\303\377\365"
+ 736      C4FFF6E7 
+ 736      C3FFF6E7 
+ 736      C3FFF5
+ 737 29e1 E7C2FFF5 		.ascii	"\347\302\377\365\347\301\377\365\347\301\377\365\346\300\377"
+ 737      E7C1FFF5 
+ 737      E7C1FFF5 
+ 737      E6C0FF
+ 738 29f0 F4E6BFFF 		.ascii	"\364\346\277\377\364\345\277\377\364\345\276\377\364\345\275"
+ 738      F4E5BFFF 
+ 738      F4E5BEFF 
+ 738      F4E5BD
+ 739 29ff FFF4E4BD 		.ascii	"\377\364\344\275\377\363\344\274\377\363\344\273\377\363\343"
+ 739      FFF3E4BC 
+ 739      FFF3E4BB 
+ 739      FFF3E3
+ 740 2a0e BAFFF3E3 		.ascii	"\272\377\363\343\272\377\362\342\271\377\362\342\270\377\362"
+ 740      BAFFF2E2 
+ 740      B9FFF2E2 
+ 740      B8FFF2
+ 741 2a1d E2B8FFF2 		.ascii	"\342\270\377\362\341\267\377\362\341\266\377\361\341\266\377"
+ 741      E1B7FFF2 
+ 741      E1B6FFF1 
+ 741      E1B6FF
+ 742 2a2c F1E0B5FF 		.ascii	"\361\340\265\377\361\340\264\377\361\340\264\377\360\337\263"
+ 742      F1E0B4FF 
+ 742      F1E0B4FF 
+ 742      F0DFB3
+ 743 2a3b FFF0DFB2 		.ascii	"\377\360\337\262\377\360\336\261\377\360\336\261\377\357\336"
+ 743      FFF0DEB1 
+ 743      FFF0DEB1 
+ 743      FFEFDE
+ 744 2a4a B0FFEFDD 		.ascii	"\260\377\357\335\257\377\357\335\257\377\357\335\256\377\357"
+ 744      AFFFEFDD 
+ 744      AFFFEFDD 
+ 744      AEFFEF
+GAS LISTING /tmp/cc60kbk9.s 			page 48
+
+
+ 745 2a59 DCADFFEE 		.ascii	"\334\255\377\356\334\255\377\356\333\254\377\356\333\253\377"
+ 745      DCADFFEE 
+ 745      DBACFFEE 
+ 745      DBABFF
+ 746 2a68 EEDBABFF 		.ascii	"\356\333\253\377\355\332\252\377\355\332\251\377\355\332\251"
+ 746      EDDAAAFF 
+ 746      EDDAA9FF 
+ 746      EDDAA9
+ 747 2a77 FFEDD9A8 		.ascii	"\377\355\331\250\377\355\331\247\377\354\330\246\377\354\330"
+ 747      FFEDD9A7 
+ 747      FFECD8A6 
+ 747      FFECD8
+ 748 2a86 A6FFECD8 		.ascii	"\246\377\354\330\245\377\354\327\244\377\353\327\244\377\353"
+ 748      A5FFECD7 
+ 748      A4FFEBD7 
+ 748      A4FFEB
+ 749 2a95 D7A3FFEB 		.ascii	"\327\243\377\353\326\242\377\353\326\242\377\353\325\241\377"
+ 749      D6A2FFEB 
+ 749      D6A2FFEB 
+ 749      D5A1FF
+ 750 2aa4 EAD5A0FF 		.ascii	"\352\325\240\377\352\325\240\377\352\324\237\377\352\324\236"
+ 750      EAD5A0FF 
+ 750      EAD49FFF 
+ 750      EAD49E
+ 751 2ab3 FFE9D49E 		.ascii	"\377\351\324\236\377\351\323\235\377\351\323\234\377\351\323"
+ 751      FFE9D39D 
+ 751      FFE9D39C 
+ 751      FFE9D3
+ 752 2ac2 9CFFE9D2 		.ascii	"\234\377\351\322\233\377\350\322\232\377\350\321\231\377\350"
+ 752      9BFFE8D2 
+ 752      9AFFE8D1 
+ 752      99FFE8
+ 753 2ad1 D199FFE8 		.ascii	"\321\231\377\350\321\230\377\347\320\227\377\347\320\227\377"
+ 753      D198FFE7 
+ 753      D097FFE7 
+ 753      D097FF
+ 754 2ae0 E7D096FF 		.ascii	"\347\320\226\377\347\317\225\377\347\317\225\377\346\316\224"
+ 754      E7CF95FF 
+ 754      E7CF95FF 
+ 754      E6CE94
+ 755 2aef FFE6CE93 		.ascii	"\377\346\316\223\377\346\316\223\377\346\315\222\377\345\315"
+ 755      FFE6CE93 
+ 755      FFE6CD92 
+ 755      FFE5CD
+ 756 2afe 91FFE5CD 		.ascii	"\221\377\345\315\221\377\345\314\220\377\345\314\217\377\344"
+ 756      91FFE5CC 
+ 756      90FFE5CC 
+ 756      8FFFE4
+ 757 2b0d CB8FFFE4 		.ascii	"\313\217\377\344\313\216\377\344\313\215\377\344\312\215\377"
+ 757      CB8EFFE4 
+ 757      CB8DFFE4 
+ 757      CA8DFF
+ 758 2b1c E4CA8CFF 		.ascii	"\344\312\214\377\343\312\213\377\343\311\213\377\343\311\212"
+ 758      E3CA8BFF 
+ 758      E3C98BFF 
+ 758      E3C98A
+ 759 2b2b FFE3C889 		.ascii	"\377\343\310\211\377\342\310\211\377\342\310\210\377\342\307"
+GAS LISTING /tmp/cc60kbk9.s 			page 49
+
+
+ 759      FFE2C889 
+ 759      FFE2C888 
+ 759      FFE2C7
+ 760 2b3a 87FFE2C7 		.ascii	"\207\377\342\307\206\377\342\307\206\377\341\306\205\377\341"
+ 760      86FFE2C7 
+ 760      86FFE1C6 
+ 760      85FFE1
+ 761 2b49 C684FFE1 		.ascii	"\306\204\377\341\306\204\377\341\305\203\377\340\305\202\377"
+ 761      C684FFE1 
+ 761      C583FFE0 
+ 761      C582FF
+ 762 2b58 E0C482FF 		.ascii	"\340\304\202\377\340\304\201\377\340\304\200\377\340\303\200"
+ 762      E0C481FF 
+ 762      E0C480FF 
+ 762      E0C380
+ 763 2b67 FFDFC37F 		.ascii	"\377\337\303\177\377\337\303~\377\337\302~\377\337\302}\377\336"
+ 763      FFDFC37E 
+ 763      FFDFC27E 
+ 763      FFDFC27D 
+ 763      FFDE
+ 764 2b79 C17CFFDE 		.ascii	"\301|\377\336\301|\377\336\301{\377\336\301z\377\336\301y\377"
+ 764      C17CFFDE 
+ 764      C17BFFDE 
+ 764      C17AFFDE 
+ 764      C179FF
+ 765 2b8c DEC179FF 		.ascii	"\336\301y\377\336\301x\377\336\301w\377\335\301w\377\335\301"
+ 765      DEC178FF 
+ 765      DEC177FF 
+ 765      DDC177FF 
+ 765      DDC1
+ 766 2b9e 76FFDDC1 		.ascii	"v\377\335\301u\377\335\301t\377\335\301t\377\335\301s\377\334"
+ 766      75FFDDC1 
+ 766      74FFDDC1 
+ 766      74FFDDC1 
+ 766      73FFDC
+ 767 2bb1 C172FFDC 		.ascii	"\301r\377\334\301r\377\334\301q\377\334\301p\377\334\301o\377"
+ 767      C172FFDC 
+ 767      C171FFDC 
+ 767      C170FFDC 
+ 767      C16FFF
+ 768 2bc4 DBC16FFF 		.ascii	"\333\301o\377\333\301n\377\333\301m\377\333\301m\377\333\301"
+ 768      DBC16EFF 
+ 768      DBC16DFF 
+ 768      DBC16DFF 
+ 768      DBC1
+ 769 2bd6 6CFFDAC1 		.ascii	"l\377\332\301k\377\332\301j\377\332\301j\377\332\301i\377\331"
+ 769      6BFFDAC1 
+ 769      6AFFDAC1 
+ 769      6AFFDAC1 
+ 769      69FFD9
+ 770 2be9 C168FFD9 		.ascii	"\301h\377\331\301g\377\331\301g\377\331\301f\377\331\300e\377"
+ 770      C167FFD9 
+ 770      C167FFD9 
+ 770      C166FFD9 
+ 770      C065FF
+ 771 2bfc D8C065FF 		.ascii	"\330\300e\377\330\300d\377\330\300c\377\330\300b\377\327\300"
+ 771      D8C064FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 50
+
+
+ 771      D8C063FF 
+ 771      D8C062FF 
+ 771      D7C0
+ 772 2c0e 62FFD7C0 		.ascii	"b\377\327\300a\377\327\300`\377\326\300_\377\326\300_\377\326"
+ 772      61FFD7C0 
+ 772      60FFD6C0 
+ 772      5FFFD6C0 
+ 772      5FFFD6
+ 773 2c21 C05EFFD6 		.ascii	"\300^\377\326\300]\377\325\300\\\377\325\300\\\377\325\300[\377"
+ 773      C05DFFD5 
+ 773      C05CFFD5 
+ 773      C05CFFD5 
+ 773      C05BFF
+ 774 2c34 D4C05AFF 		.ascii	"\324\300Z\377\324\300Y\377\324\300Y\377\324\300X\377\323\300"
+ 774      D4C059FF 
+ 774      D4C059FF 
+ 774      D4C058FF 
+ 774      D3C0
+ 775 2c46 57FFD3C0 		.ascii	"W\377\323\300V\377\323\300V\377\322\300U\377\322\300T\377\322"
+ 775      56FFD3C0 
+ 775      56FFD2C0 
+ 775      55FFD2C0 
+ 775      54FFD2
+ 776 2c59 C053FFD1 		.ascii	"\300S\377\321\300S\377\321\300R\377\321\300Q\377\320\300P\377"
+ 776      C053FFD1 
+ 776      C052FFD1 
+ 776      C051FFD0 
+ 776      C050FF
+ 777 2c6c D0C050FF 		.ascii	"\320\300P\377\320\300O\377\317\300N\377\317\300M\377\317\300"
+ 777      D0C04FFF 
+ 777      CFC04EFF 
+ 777      CFC04DFF 
+ 777      CFC0
+ 778 2c7e 4CFFCEC1 		.ascii	"L\377\316\301L\377\316\301K\377\315\301J\377\315\301I\377\315"
+ 778      4CFFCEC1 
+ 778      4BFFCDC1 
+ 778      4AFFCDC1 
+ 778      49FFCD
+ 779 2c91 C149FFCC 		.ascii	"\301I\377\314\301H\377\314\301G\377\314\301F\377\313\301E\377"
+ 779      C148FFCC 
+ 779      C147FFCC 
+ 779      C146FFCB 
+ 779      C145FF
+ 780 2ca4 CBC145FF 		.ascii	"\313\301E\377\312\301D\377\312\301C\377\312\301B\377\311\301"
+ 780      CAC144FF 
+ 780      CAC143FF 
+ 780      CAC142FF 
+ 780      C9C1
+ 781 2cb6 41FFC9C1 		.ascii	"A\377\311\301@\377\310\301@\377\310\301?\377\307\301>\377\307"
+ 781      40FFC8C1 
+ 781      40FFC8C1 
+ 781      3FFFC7C1 
+ 781      3EFFC7
+ 782 2cc9 C13DFFC7 		.ascii	"\301=\377\307\301<\377\306\301;\377\306\301;\377\305\301:\377"
+ 782      C13CFFC6 
+ 782      C13BFFC6 
+ 782      C13BFFC5 
+GAS LISTING /tmp/cc60kbk9.s 			page 51
+
+
+ 782      C13AFF
+ 783 2cdc C5C139FF 		.ascii	"\305\3019\377\304\3018\377\304\3017\377\303\3016\377\303\301"
+ 783      C4C138FF 
+ 783      C4C137FF 
+ 783      C3C136FF 
+ 783      C3C1
+ 784 2cee 35FFC2C1 		.ascii	"5\377\302\3014\377\302\3013\377\302\3012\377\301\3012\377\301"
+ 784      34FFC2C1 
+ 784      33FFC2C1 
+ 784      32FFC1C1 
+ 784      32FFC1
+ 785 2d01 C131FFC0 		.ascii	"\3011\377\300\3010\377\300\301/\377\277\301.\377\277\301-\377"
+ 785      C130FFC0 
+ 785      C12FFFBF 
+ 785      C12EFFBF 
+ 785      C12DFF
+ 786 2d14 BEC12CFF 		.ascii	"\276\301,\377\276\277+\377\276\276*\377\276\275*\377\276\274"
+ 786      BEBF2BFF 
+ 786      BEBE2AFF 
+ 786      BEBD2AFF 
+ 786      BEBC
+ 787 2d26 29FFBDBB 		.ascii	")\377\275\273(\377\275\271'\377\275\270&\377\275\267&\377\274"
+ 787      28FFBDB9 
+ 787      27FFBDB8 
+ 787      26FFBDB7 
+ 787      26FFBC
+ 788 2d39 B625FFBC 		.ascii	"\266%\377\274\265$\377\274\263$\377\274\262#\377\273\261\"\377"
+ 788      B524FFBC 
+ 788      B324FFBC 
+ 788      B223FFBB 
+ 788      B122FF
+ 789 2d4c BBB022FF 		.ascii	"\273\260\"\377\273\257!\377\272\256 \377\272\254 \377\272\253"
+ 789      BBAF21FF 
+ 789      BAAE20FF 
+ 789      BAAC20FF 
+ 789      BAAB
+ 790 2d5e 1FFFB9AA 		.ascii	"\037\377\271\252\036\377\271\251\036\377\271\250\035\377\270"
+ 790      1EFFB9A9 
+ 790      1EFFB9A8 
+ 790      1DFFB8
+ 791 2d6d A71CFFB8 		.ascii	"\247\034\377\270\245\034\377\270\244\033\377\267\243\033\377"
+ 791      A51CFFB8 
+ 791      A41BFFB7 
+ 791      A31BFF
+ 792 2d7c B7A21AFF 		.ascii	"\267\242\032\377\267\241\031\377\266\240\031\377\266\236\030"
+ 792      B7A119FF 
+ 792      B6A019FF 
+ 792      B69E18
+ 793 2d8b FFB69D18 		.ascii	"\377\266\235\030\377\265\234\027\377\265\233\027\377\264\232"
+ 793      FFB59C17 
+ 793      FFB59B17 
+ 793      FFB49A
+ 794 2d9a 16FFB499 		.ascii	"\026\377\264\231\026\377\264\230\025\377\263\226\025\377\263"
+ 794      16FFB498 
+ 794      15FFB396 
+ 794      15FFB3
+ 795 2da9 9514FFB2 		.ascii	"\225\024\377\262\224\024\377\262\223\024\377\261\222\023\377"
+GAS LISTING /tmp/cc60kbk9.s 			page 52
+
+
+ 795      9414FFB2 
+ 795      9314FFB1 
+ 795      9213FF
+ 796 2db8 B19113FF 		.ascii	"\261\221\023\377\260\220\022\377\260\216\022\377\260\215\021"
+ 796      B09012FF 
+ 796      B08E12FF 
+ 796      B08D11
+ 797 2dc7 FFAF8C11 		.ascii	"\377\257\214\021\377\257\213\021\377\256\212\020\377\256\211"
+ 797      FFAF8B11 
+ 797      FFAE8A10 
+ 797      FFAE89
+ 798 2dd6 10FFAD88 		.ascii	"\020\377\255\210\020\377\255\207\017\377\254\206\017\377\254"
+ 798      10FFAD87 
+ 798      0FFFAC86 
+ 798      0FFFAC
+ 799 2de5 840FFFAB 		.ascii	"\204\017\377\253\203\016\377\252\202\016\377\252\201\016\377"
+ 799      830EFFAA 
+ 799      820EFFAA 
+ 799      810EFF
+ 800 2df4 A9800EFF 		.ascii	"\251\200\016\377\251\177\r\377\250~\r\377\250}\r\377\247|\r\377"
+ 800      A97F0DFF 
+ 800      A87E0DFF 
+ 800      A87D0DFF 
+ 800      A77C0DFF 
+ 801 2e08 A77B0CFF 		.ascii	"\247{\f\377\246y\f\377\245x\f\377\245w\f\377\244v\f\377\244u"
+ 801      A6790CFF 
+ 801      A5780CFF 
+ 801      A5770CFF 
+ 801      A4760CFF 
+ 802 2e1e 0BFFA374 		.ascii	"\013\377\243t\013\377\243s\013\377\242r\013\377\241q\013\377"
+ 802      0BFFA373 
+ 802      0BFFA272 
+ 802      0BFFA171 
+ 802      0BFF
+ 803 2e30 A1700BFF 		.ascii	"\241p\013\377\240o\013\377\237n\013\377\237m\n\377\236l\n\377"
+ 803      A06F0BFF 
+ 803      9F6E0BFF 
+ 803      9F6D0AFF 
+ 803      9E6C0AFF 
+ 804 2e44 9E6B0AFF 		.ascii	"\236k\n\377\235j\n\377\234h\n\377\234g\n\377\233f\n\377\232e"
+ 804      9D6A0AFF 
+ 804      9C680AFF 
+ 804      9C670AFF 
+ 804      9B660AFF 
+ 805 2e5a 0AFF9A64 		.ascii	"\n\377\232d\n\377\231c\n\377\230b\n\377\230a\n\377\227`\n\377"
+ 805      0AFF9963 
+ 805      0AFF9862 
+ 805      0AFF9861 
+ 805      0AFF9760 
+ 806 2e70 965F0AFF 		.ascii	"\226_\n\377\225^\n\377\225]\n\377\224\\\n\377\223[\n\377\223"
+ 806      955E0AFF 
+ 806      955D0AFF 
+ 806      945C0AFF 
+ 806      935B0AFF 
+ 807 2e85 5A0AFF92 		.ascii	"Z\n\377\222Y\n\377\221X\n\377\220W\n\377\220V\n\377\217U\n\377"
+ 807      590AFF91 
+ 807      580AFF90 
+GAS LISTING /tmp/cc60kbk9.s 			page 53
+
+
+ 807      570AFF90 
+ 807      560AFF8F 
+ 808 2e9c 8E540AFF 		.ascii	"\216T\n\377\215S\n\377\215R\n\377\214Q\n\377\213P\t\377\213P"
+ 808      8D530AFF 
+ 808      8D520AFF 
+ 808      8C510AFF 
+ 808      8B5009FF 
+ 809 2eb2 09FF8A50 		.ascii	"\t\377\212P\t\377\212O\t\377\211O\t\377\210O\t\377\210N\t\377"
+ 809      09FF8A4F 
+ 809      09FF894F 
+ 809      09FF884F 
+ 809      09FF884E 
+ 810 2ec8 874E09FF 		.ascii	"\207N\t\377\207N\t\377\206M\t\377\206M\t\377\205M\t\377\204L"
+ 810      874E09FF 
+ 810      864D09FF 
+ 810      864D09FF 
+ 810      854D09FF 
+ 811 2ede 09FF844C 		.ascii	"\t\377\204L\t\377\203L\t\377\203K\t\377\202K\t\377\202K\t\377"
+ 811      09FF834C 
+ 811      09FF834B 
+ 811      09FF824B 
+ 811      09FF824B 
+ 812 2ef4 814A09FF 		.ascii	"\201J\t\377\200J\t\377\200J\t\377\177I\t\377\177I\t\377~I\t\377"
+ 812      804A09FF 
+ 812      804A09FF 
+ 812      7F4909FF 
+ 812      7F4909FF 
+ 813 2f0c 7E4808FF 		.ascii	"~H\b\377}H\b\377}H\b\377|G\b\377{G\b\377{G\b\377zF\b\377zF\b"
+ 813      7D4808FF 
+ 813      7D4808FF 
+ 813      7C4708FF 
+ 813      7B4708FF 
+ 814 2f2b FF794608 		.ascii	"\377yF\b\377yE\b\377xE\b\377xE\b\377wD\b\377vD\b\377vD\b\377"
+ 814      FF794508 
+ 814      FF784508 
+ 814      FF784508 
+ 814      FF774408 
+ 815 2f48 754408FF 		.ascii	"uD\b\377uC\b\377tC\b\377tC\b\377sB\b\377sB\b\377rB\b\377qA\b"
+ 815      754308FF 
+ 815      744308FF 
+ 815      744308FF 
+ 815      734208FF 
+ 816 2f67 FF714108 		.ascii	"\377qA\b\377pA\b\377p@\007\377o@\007\377o@\007\377n?\007\377"
+ 816      FF704108 
+ 816      FF704007 
+ 816      FF6F4007 
+ 816      FF6F4007 
+ 817 2f80 6E3F07FF 		.ascii	"n?\007\377m?\007\377l>\007\377l>\007\377k>\007\377k=\007\377"
+ 817      6D3F07FF 
+ 817      6C3E07FF 
+ 817      6C3E07FF 
+ 817      6B3E07FF 
+ 818 2f98 6A3D07FF 		.ascii	"j=\007\377j=\007\377i<\007\377i<\007\377h<\007\377h;\007\377"
+ 818      6A3D07FF 
+ 818      693C07FF 
+ 818      693C07FF 
+ 818      683C07FF 
+GAS LISTING /tmp/cc60kbk9.s 			page 54
+
+
+ 819 2fb0 673B07FF 		.ascii	"g;\007\377g;\007\377f:\007\377e:\007\377e:\007\377d:\007\377"
+ 819      673B07FF 
+ 819      663A07FF 
+ 819      653A07FF 
+ 819      653A07FF 
+ 820 2fc8 643907FF 		.ascii	"d9\007\377c9\007\377c9\007\377b8\007\377b8\006\377a8\006\377"
+ 820      633907FF 
+ 820      633907FF 
+ 820      623807FF 
+ 820      623806FF 
+ 821 2fe0 613706FF 		.ascii	"a7\006\377`7\006\377`7\006\377_6\006\377^6\006\377^6\006\377"
+ 821      603706FF 
+ 821      603706FF 
+ 821      5F3606FF 
+ 821      5E3606FF 
+ 822 2ff8 5D3506FF 		.ascii	"]5\006\377]5\006\377\\5\006\377\\4\006\377[4\006\377[4\006\377"
+ 822      5D3506FF 
+ 822      5C3506FF 
+ 822      5C3406FF 
+ 822      5B3406FF 
+ 823 3010 5A3406FF 		.ascii	"Z4\006\377Z3\006\377Y3\005\377Y3\005\377X2\005\377X2\005\377"
+ 823      5A3306FF 
+ 823      593305FF 
+ 823      593305FF 
+ 823      583205FF 
+ 824 3028 573205FF 		.ascii	"W2\005\377W1\005\377V1\005\377V1\005\377U0\005\377U0\005\377"
+ 824      573105FF 
+ 824      563105FF 
+ 824      563105FF 
+ 824      553005FF 
+ 825 3040 543005FF 		.ascii	"T0\005\377"
+ 826              		.globl	heatmap_cs_BrBG_discrete
+ 827              		.section	.data.rel.local
+ 828              		.align 8
+ 829              		.type	heatmap_cs_BrBG_discrete, @object
+ 830              		.size	heatmap_cs_BrBG_discrete, 8
+ 831              	heatmap_cs_BrBG_discrete:
+ 832 0018 00000000 		.quad	discrete
+ 832      00000000 
+ 833              		.section	.data.rel.ro.local
+ 834              		.align 16
+ 835              		.type	discrete, @object
+ 836              		.size	discrete, 16
+ 837              	discrete:
+ 838 0030 00000000 		.quad	discrete_data
+ 838      00000000 
+ 839 0038 0C000000 		.quad	12
+ 839      00000000 
+ 840              		.section	.rodata
+ 841 3044 00000000 		.align 32
+ 841      00000000 
+ 841      00000000 
+ 841      00000000 
+ 841      00000000 
+ 842              		.type	discrete_data, @object
+ 843              		.size	discrete_data, 48
+ 844              	discrete_data:
+GAS LISTING /tmp/cc60kbk9.s 			page 55
+
+
+ 845 3060 00       		.string	""
+ 846 3061 00       		.string	""
+ 847 3062 00       		.string	""
+ 848 3063 00       		.string	""
+ 849 3064 00       		.string	""
+ 850 3065 3C30FF01 		.ascii	"<0\377\001f^\3775\227\217\377\200\315\301\377\307\352\345\377"
+ 850      665EFF35 
+ 850      978FFF80 
+ 850      CDC1FFC7 
+ 850      EAE5FF
+ 851 3078 F5F5F5FF 		.ascii	"\365\365\365\377\366\350\303\377\337\302}\377\277\302-\377\214"
+ 851      F6E8C3FF 
+ 851      DFC27DFF 
+ 851      BFC22DFF 
+ 851      8C
+ 852 3089 510AFF54 		.ascii	"Q\n\377T0\005\377"
+ 852      3005FF
+ 853              		.text
+ 854              	.Letext0:
+ 855              		.file 1 "./heatmap.h"
+ 856              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 857              		.file 3 "./colorschemes/BrBG.h"
+ 858              		.file 4 "colorschemes/BrBG.c"
+ 859              		.section	.debug_info,"",@progbits
+ 860              	.Ldebug_info0:
+ 861 0000 E3010000 		.long	0x1e3
+ 862 0004 0500     		.value	0x5
+ 863 0006 01       		.byte	0x1
+ 864 0007 08       		.byte	0x8
+ 865 0008 00000000 		.long	.Ldebug_abbrev0
+ 866 000c 0A       		.uleb128 0xa
+ 867 000d 00000000 		.long	.LASF26
+ 868 0011 1D       		.byte	0x1d
+ 869 0012 00000000 		.long	.LASF0
+ 870 0016 00000000 		.long	.LASF1
+ 871 001a 00000000 		.long	.Ldebug_line0
+ 872 001e 01       		.uleb128 0x1
+ 873 001f 08       		.byte	0x8
+ 874 0020 05       		.byte	0x5
+ 875 0021 00000000 		.long	.LASF2
+ 876 0025 06       		.uleb128 0x6
+ 877 0026 00000000 		.long	.LASF12
+ 878 002a 02       		.byte	0x2
+ 879 002b D6       		.byte	0xd6
+ 880 002c 17       		.byte	0x17
+ 881 002d 31000000 		.long	0x31
+ 882 0031 01       		.uleb128 0x1
+ 883 0032 08       		.byte	0x8
+ 884 0033 07       		.byte	0x7
+ 885 0034 00000000 		.long	.LASF3
+ 886 0038 0B       		.uleb128 0xb
+ 887 0039 04       		.byte	0x4
+ 888 003a 05       		.byte	0x5
+ 889 003b 696E7400 		.string	"int"
+ 890 003f 01       		.uleb128 0x1
+ 891 0040 08       		.byte	0x8
+ 892 0041 05       		.byte	0x5
+GAS LISTING /tmp/cc60kbk9.s 			page 56
+
+
+ 893 0042 00000000 		.long	.LASF4
+ 894 0046 01       		.uleb128 0x1
+ 895 0047 10       		.byte	0x10
+ 896 0048 04       		.byte	0x4
+ 897 0049 00000000 		.long	.LASF5
+ 898 004d 01       		.uleb128 0x1
+ 899 004e 04       		.byte	0x4
+ 900 004f 04       		.byte	0x4
+ 901 0050 00000000 		.long	.LASF6
+ 902 0054 01       		.uleb128 0x1
+ 903 0055 04       		.byte	0x4
+ 904 0056 07       		.byte	0x7
+ 905 0057 00000000 		.long	.LASF7
+ 906 005b 01       		.uleb128 0x1
+ 907 005c 02       		.byte	0x2
+ 908 005d 07       		.byte	0x7
+ 909 005e 00000000 		.long	.LASF8
+ 910 0062 0C       		.uleb128 0xc
+ 911 0063 10       		.byte	0x10
+ 912 0064 01       		.byte	0x1
+ 913 0065 BB       		.byte	0xbb
+ 914 0066 09       		.byte	0x9
+ 915 0067 84000000 		.long	0x84
+ 916 006b 07       		.uleb128 0x7
+ 917 006c 00000000 		.long	.LASF9
+ 918 0070 BC       		.byte	0xbc
+ 919 0071 1A       		.byte	0x1a
+ 920 0072 84000000 		.long	0x84
+ 921 0076 00       		.byte	0
+ 922 0077 07       		.uleb128 0x7
+ 923 0078 00000000 		.long	.LASF10
+ 924 007c BD       		.byte	0xbd
+ 925 007d 0C       		.byte	0xc
+ 926 007e 25000000 		.long	0x25
+ 927 0082 08       		.byte	0x8
+ 928 0083 00       		.byte	0
+ 929 0084 08       		.uleb128 0x8
+ 930 0085 90000000 		.long	0x90
+ 931 0089 01       		.uleb128 0x1
+ 932 008a 01       		.byte	0x1
+ 933 008b 08       		.byte	0x8
+ 934 008c 00000000 		.long	.LASF11
+ 935 0090 03       		.uleb128 0x3
+ 936 0091 89000000 		.long	0x89
+ 937 0095 06       		.uleb128 0x6
+ 938 0096 00000000 		.long	.LASF13
+ 939 009a 01       		.byte	0x1
+ 940 009b BE       		.byte	0xbe
+ 941 009c 03       		.byte	0x3
+ 942 009d 62000000 		.long	0x62
+ 943 00a1 03       		.uleb128 0x3
+ 944 00a2 95000000 		.long	0x95
+ 945 00a6 08       		.uleb128 0x8
+ 946 00a7 A1000000 		.long	0xa1
+ 947 00ab 04       		.uleb128 0x4
+ 948 00ac 00000000 		.long	.LASF14
+ 949 00b0 21       		.byte	0x21
+GAS LISTING /tmp/cc60kbk9.s 			page 57
+
+
+ 950 00b1 A6000000 		.long	0xa6
+ 951 00b5 04       		.uleb128 0x4
+ 952 00b6 00000000 		.long	.LASF15
+ 953 00ba 23       		.byte	0x23
+ 954 00bb A6000000 		.long	0xa6
+ 955 00bf 04       		.uleb128 0x4
+ 956 00c0 00000000 		.long	.LASF16
+ 957 00c4 25       		.byte	0x25
+ 958 00c5 A6000000 		.long	0xa6
+ 959 00c9 04       		.uleb128 0x4
+ 960 00ca 00000000 		.long	.LASF17
+ 961 00ce 28       		.byte	0x28
+ 962 00cf A6000000 		.long	0xa6
+ 963 00d3 09       		.uleb128 0x9
+ 964 00d4 90000000 		.long	0x90
+ 965 00d8 E3000000 		.long	0xe3
+ 966 00dc 0D       		.uleb128 0xd
+ 967 00dd 31000000 		.long	0x31
+ 968 00e1 2F       		.byte	0x2f
+ 969 00e2 00       		.byte	0
+ 970 00e3 03       		.uleb128 0x3
+ 971 00e4 D3000000 		.long	0xd3
+ 972 00e8 02       		.uleb128 0x2
+ 973 00e9 00000000 		.long	.LASF18
+ 974 00ed 20       		.byte	0x20
+ 975 00ee 1C       		.byte	0x1c
+ 976 00ef E3000000 		.long	0xe3
+ 977 00f3 09       		.uleb128 0x9
+ 978 00f4 03       		.byte	0x3
+ 979 00f5 00000000 		.quad	discrete_data
+ 979      00000000 
+ 980 00fd 02       		.uleb128 0x2
+ 981 00fe 00000000 		.long	.LASF19
+ 982 0102 23       		.byte	0x23
+ 983 0103 24       		.byte	0x24
+ 984 0104 A1000000 		.long	0xa1
+ 985 0108 09       		.uleb128 0x9
+ 986 0109 03       		.byte	0x3
+ 987 010a 00000000 		.quad	discrete
+ 987      00000000 
+ 988 0112 05       		.uleb128 0x5
+ 989 0113 AB000000 		.long	0xab
+ 990 0117 24       		.byte	0x24
+ 991 0118 09       		.uleb128 0x9
+ 992 0119 03       		.byte	0x3
+ 993 011a 00000000 		.quad	heatmap_cs_BrBG_discrete
+ 993      00000000 
+ 994 0122 09       		.uleb128 0x9
+ 995 0123 90000000 		.long	0x90
+ 996 0127 33010000 		.long	0x133
+ 997 012b 0E       		.uleb128 0xe
+ 998 012c 31000000 		.long	0x31
+ 999 0130 0310     		.value	0x1003
+ 1000 0132 00       		.byte	0
+ 1001 0133 03       		.uleb128 0x3
+ 1002 0134 22010000 		.long	0x122
+ 1003 0138 02       		.uleb128 0x2
+GAS LISTING /tmp/cc60kbk9.s 			page 58
+
+
+ 1004 0139 00000000 		.long	.LASF20
+ 1005 013d 26       		.byte	0x26
+ 1006 013e 1C       		.byte	0x1c
+ 1007 013f 33010000 		.long	0x133
+ 1008 0143 09       		.uleb128 0x9
+ 1009 0144 03       		.byte	0x3
+ 1010 0145 00000000 		.quad	soft_data
+ 1010      00000000 
+ 1011 014d 02       		.uleb128 0x2
+ 1012 014e 00000000 		.long	.LASF21
+ 1013 0152 29       		.byte	0x29
+ 1014 0153 24       		.byte	0x24
+ 1015 0154 A1000000 		.long	0xa1
+ 1016 0158 09       		.uleb128 0x9
+ 1017 0159 03       		.byte	0x3
+ 1018 015a 00000000 		.quad	soft
+ 1018      00000000 
+ 1019 0162 05       		.uleb128 0x5
+ 1020 0163 B5000000 		.long	0xb5
+ 1021 0167 2A       		.byte	0x2a
+ 1022 0168 09       		.uleb128 0x9
+ 1023 0169 03       		.byte	0x3
+ 1024 016a 00000000 		.quad	heatmap_cs_BrBG_soft
+ 1024      00000000 
+ 1025 0172 02       		.uleb128 0x2
+ 1026 0173 00000000 		.long	.LASF22
+ 1027 0177 2C       		.byte	0x2c
+ 1028 0178 1C       		.byte	0x1c
+ 1029 0179 33010000 		.long	0x133
+ 1030 017d 09       		.uleb128 0x9
+ 1031 017e 03       		.byte	0x3
+ 1032 017f 00000000 		.quad	mixed_data
+ 1032      00000000 
+ 1033 0187 02       		.uleb128 0x2
+ 1034 0188 00000000 		.long	.LASF23
+ 1035 018c 2F       		.byte	0x2f
+ 1036 018d 24       		.byte	0x24
+ 1037 018e A1000000 		.long	0xa1
+ 1038 0192 09       		.uleb128 0x9
+ 1039 0193 03       		.byte	0x3
+ 1040 0194 00000000 		.quad	mixed
+ 1040      00000000 
+ 1041 019c 05       		.uleb128 0x5
+ 1042 019d BF000000 		.long	0xbf
+ 1043 01a1 30       		.byte	0x30
+ 1044 01a2 09       		.uleb128 0x9
+ 1045 01a3 03       		.byte	0x3
+ 1046 01a4 00000000 		.quad	heatmap_cs_BrBG_mixed
+ 1046      00000000 
+ 1047 01ac 02       		.uleb128 0x2
+ 1048 01ad 00000000 		.long	.LASF24
+ 1049 01b1 32       		.byte	0x32
+ 1050 01b2 1C       		.byte	0x1c
+ 1051 01b3 33010000 		.long	0x133
+ 1052 01b7 09       		.uleb128 0x9
+ 1053 01b8 03       		.byte	0x3
+ 1054 01b9 00000000 		.quad	mixed_exp_data
+GAS LISTING /tmp/cc60kbk9.s 			page 59
+
+
+ 1054      00000000 
+ 1055 01c1 02       		.uleb128 0x2
+ 1056 01c2 00000000 		.long	.LASF25
+ 1057 01c6 35       		.byte	0x35
+ 1058 01c7 24       		.byte	0x24
+ 1059 01c8 A1000000 		.long	0xa1
+ 1060 01cc 09       		.uleb128 0x9
+ 1061 01cd 03       		.byte	0x3
+ 1062 01ce 00000000 		.quad	mixed_exp
+ 1062      00000000 
+ 1063 01d6 05       		.uleb128 0x5
+ 1064 01d7 C9000000 		.long	0xc9
+ 1065 01db 36       		.byte	0x36
+ 1066 01dc 09       		.uleb128 0x9
+ 1067 01dd 03       		.byte	0x3
+ 1068 01de 00000000 		.quad	heatmap_cs_BrBG_mixed_exp
+ 1068      00000000 
+ 1069 01e6 00       		.byte	0
+ 1070              		.section	.debug_abbrev,"",@progbits
+ 1071              	.Ldebug_abbrev0:
+ 1072 0000 01       		.uleb128 0x1
+ 1073 0001 24       		.uleb128 0x24
+ 1074 0002 00       		.byte	0
+ 1075 0003 0B       		.uleb128 0xb
+ 1076 0004 0B       		.uleb128 0xb
+ 1077 0005 3E       		.uleb128 0x3e
+ 1078 0006 0B       		.uleb128 0xb
+ 1079 0007 03       		.uleb128 0x3
+ 1080 0008 0E       		.uleb128 0xe
+ 1081 0009 00       		.byte	0
+ 1082 000a 00       		.byte	0
+ 1083 000b 02       		.uleb128 0x2
+ 1084 000c 34       		.uleb128 0x34
+ 1085 000d 00       		.byte	0
+ 1086 000e 03       		.uleb128 0x3
+ 1087 000f 0E       		.uleb128 0xe
+ 1088 0010 3A       		.uleb128 0x3a
+ 1089 0011 21       		.uleb128 0x21
+ 1090 0012 04       		.sleb128 4
+ 1091 0013 3B       		.uleb128 0x3b
+ 1092 0014 0B       		.uleb128 0xb
+ 1093 0015 39       		.uleb128 0x39
+ 1094 0016 0B       		.uleb128 0xb
+ 1095 0017 49       		.uleb128 0x49
+ 1096 0018 13       		.uleb128 0x13
+ 1097 0019 02       		.uleb128 0x2
+ 1098 001a 18       		.uleb128 0x18
+ 1099 001b 00       		.byte	0
+ 1100 001c 00       		.byte	0
+ 1101 001d 03       		.uleb128 0x3
+ 1102 001e 26       		.uleb128 0x26
+ 1103 001f 00       		.byte	0
+ 1104 0020 49       		.uleb128 0x49
+ 1105 0021 13       		.uleb128 0x13
+ 1106 0022 00       		.byte	0
+ 1107 0023 00       		.byte	0
+ 1108 0024 04       		.uleb128 0x4
+GAS LISTING /tmp/cc60kbk9.s 			page 60
+
+
+ 1109 0025 34       		.uleb128 0x34
+ 1110 0026 00       		.byte	0
+ 1111 0027 03       		.uleb128 0x3
+ 1112 0028 0E       		.uleb128 0xe
+ 1113 0029 3A       		.uleb128 0x3a
+ 1114 002a 21       		.uleb128 0x21
+ 1115 002b 03       		.sleb128 3
+ 1116 002c 3B       		.uleb128 0x3b
+ 1117 002d 0B       		.uleb128 0xb
+ 1118 002e 39       		.uleb128 0x39
+ 1119 002f 21       		.uleb128 0x21
+ 1120 0030 25       		.sleb128 37
+ 1121 0031 49       		.uleb128 0x49
+ 1122 0032 13       		.uleb128 0x13
+ 1123 0033 3F       		.uleb128 0x3f
+ 1124 0034 19       		.uleb128 0x19
+ 1125 0035 3C       		.uleb128 0x3c
+ 1126 0036 19       		.uleb128 0x19
+ 1127 0037 00       		.byte	0
+ 1128 0038 00       		.byte	0
+ 1129 0039 05       		.uleb128 0x5
+ 1130 003a 34       		.uleb128 0x34
+ 1131 003b 00       		.byte	0
+ 1132 003c 47       		.uleb128 0x47
+ 1133 003d 13       		.uleb128 0x13
+ 1134 003e 3A       		.uleb128 0x3a
+ 1135 003f 21       		.uleb128 0x21
+ 1136 0040 04       		.sleb128 4
+ 1137 0041 3B       		.uleb128 0x3b
+ 1138 0042 0B       		.uleb128 0xb
+ 1139 0043 39       		.uleb128 0x39
+ 1140 0044 21       		.uleb128 0x21
+ 1141 0045 1E       		.sleb128 30
+ 1142 0046 02       		.uleb128 0x2
+ 1143 0047 18       		.uleb128 0x18
+ 1144 0048 00       		.byte	0
+ 1145 0049 00       		.byte	0
+ 1146 004a 06       		.uleb128 0x6
+ 1147 004b 16       		.uleb128 0x16
+ 1148 004c 00       		.byte	0
+ 1149 004d 03       		.uleb128 0x3
+ 1150 004e 0E       		.uleb128 0xe
+ 1151 004f 3A       		.uleb128 0x3a
+ 1152 0050 0B       		.uleb128 0xb
+ 1153 0051 3B       		.uleb128 0x3b
+ 1154 0052 0B       		.uleb128 0xb
+ 1155 0053 39       		.uleb128 0x39
+ 1156 0054 0B       		.uleb128 0xb
+ 1157 0055 49       		.uleb128 0x49
+ 1158 0056 13       		.uleb128 0x13
+ 1159 0057 00       		.byte	0
+ 1160 0058 00       		.byte	0
+ 1161 0059 07       		.uleb128 0x7
+ 1162 005a 0D       		.uleb128 0xd
+ 1163 005b 00       		.byte	0
+ 1164 005c 03       		.uleb128 0x3
+ 1165 005d 0E       		.uleb128 0xe
+GAS LISTING /tmp/cc60kbk9.s 			page 61
+
+
+ 1166 005e 3A       		.uleb128 0x3a
+ 1167 005f 21       		.uleb128 0x21
+ 1168 0060 01       		.sleb128 1
+ 1169 0061 3B       		.uleb128 0x3b
+ 1170 0062 0B       		.uleb128 0xb
+ 1171 0063 39       		.uleb128 0x39
+ 1172 0064 0B       		.uleb128 0xb
+ 1173 0065 49       		.uleb128 0x49
+ 1174 0066 13       		.uleb128 0x13
+ 1175 0067 38       		.uleb128 0x38
+ 1176 0068 0B       		.uleb128 0xb
+ 1177 0069 00       		.byte	0
+ 1178 006a 00       		.byte	0
+ 1179 006b 08       		.uleb128 0x8
+ 1180 006c 0F       		.uleb128 0xf
+ 1181 006d 00       		.byte	0
+ 1182 006e 0B       		.uleb128 0xb
+ 1183 006f 21       		.uleb128 0x21
+ 1184 0070 08       		.sleb128 8
+ 1185 0071 49       		.uleb128 0x49
+ 1186 0072 13       		.uleb128 0x13
+ 1187 0073 00       		.byte	0
+ 1188 0074 00       		.byte	0
+ 1189 0075 09       		.uleb128 0x9
+ 1190 0076 01       		.uleb128 0x1
+ 1191 0077 01       		.byte	0x1
+ 1192 0078 49       		.uleb128 0x49
+ 1193 0079 13       		.uleb128 0x13
+ 1194 007a 01       		.uleb128 0x1
+ 1195 007b 13       		.uleb128 0x13
+ 1196 007c 00       		.byte	0
+ 1197 007d 00       		.byte	0
+ 1198 007e 0A       		.uleb128 0xa
+ 1199 007f 11       		.uleb128 0x11
+ 1200 0080 01       		.byte	0x1
+ 1201 0081 25       		.uleb128 0x25
+ 1202 0082 0E       		.uleb128 0xe
+ 1203 0083 13       		.uleb128 0x13
+ 1204 0084 0B       		.uleb128 0xb
+ 1205 0085 03       		.uleb128 0x3
+ 1206 0086 1F       		.uleb128 0x1f
+ 1207 0087 1B       		.uleb128 0x1b
+ 1208 0088 1F       		.uleb128 0x1f
+ 1209 0089 10       		.uleb128 0x10
+ 1210 008a 17       		.uleb128 0x17
+ 1211 008b 00       		.byte	0
+ 1212 008c 00       		.byte	0
+ 1213 008d 0B       		.uleb128 0xb
+ 1214 008e 24       		.uleb128 0x24
+ 1215 008f 00       		.byte	0
+ 1216 0090 0B       		.uleb128 0xb
+ 1217 0091 0B       		.uleb128 0xb
+ 1218 0092 3E       		.uleb128 0x3e
+ 1219 0093 0B       		.uleb128 0xb
+ 1220 0094 03       		.uleb128 0x3
+ 1221 0095 08       		.uleb128 0x8
+ 1222 0096 00       		.byte	0
+GAS LISTING /tmp/cc60kbk9.s 			page 62
+
+
+ 1223 0097 00       		.byte	0
+ 1224 0098 0C       		.uleb128 0xc
+ 1225 0099 13       		.uleb128 0x13
+ 1226 009a 01       		.byte	0x1
+ 1227 009b 0B       		.uleb128 0xb
+ 1228 009c 0B       		.uleb128 0xb
+ 1229 009d 3A       		.uleb128 0x3a
+ 1230 009e 0B       		.uleb128 0xb
+ 1231 009f 3B       		.uleb128 0x3b
+ 1232 00a0 0B       		.uleb128 0xb
+ 1233 00a1 39       		.uleb128 0x39
+ 1234 00a2 0B       		.uleb128 0xb
+ 1235 00a3 01       		.uleb128 0x1
+ 1236 00a4 13       		.uleb128 0x13
+ 1237 00a5 00       		.byte	0
+ 1238 00a6 00       		.byte	0
+ 1239 00a7 0D       		.uleb128 0xd
+ 1240 00a8 21       		.uleb128 0x21
+ 1241 00a9 00       		.byte	0
+ 1242 00aa 49       		.uleb128 0x49
+ 1243 00ab 13       		.uleb128 0x13
+ 1244 00ac 2F       		.uleb128 0x2f
+ 1245 00ad 0B       		.uleb128 0xb
+ 1246 00ae 00       		.byte	0
+ 1247 00af 00       		.byte	0
+ 1248 00b0 0E       		.uleb128 0xe
+ 1249 00b1 21       		.uleb128 0x21
+ 1250 00b2 00       		.byte	0
+ 1251 00b3 49       		.uleb128 0x49
+ 1252 00b4 13       		.uleb128 0x13
+ 1253 00b5 2F       		.uleb128 0x2f
+ 1254 00b6 05       		.uleb128 0x5
+ 1255 00b7 00       		.byte	0
+ 1256 00b8 00       		.byte	0
+ 1257 00b9 00       		.byte	0
+ 1258              		.section	.debug_aranges,"",@progbits
+ 1259 0000 1C000000 		.long	0x1c
+ 1260 0004 0200     		.value	0x2
+ 1261 0006 00000000 		.long	.Ldebug_info0
+ 1262 000a 08       		.byte	0x8
+ 1263 000b 00       		.byte	0
+ 1264 000c 0000     		.value	0
+ 1265 000e 0000     		.value	0
+ 1266 0010 00000000 		.quad	0
+ 1266      00000000 
+ 1267 0018 00000000 		.quad	0
+ 1267      00000000 
+ 1268              		.section	.debug_line,"",@progbits
+ 1269              	.Ldebug_line0:
+ 1270 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1270      05000800 
+ 1270      49000000 
+ 1270      010101FB 
+ 1270      0E0D0001 
+ 1271              	.LASF15:
+ 1272 0000 68656174 		.string	"heatmap_cs_BrBG_soft"
+ 1272      6D61705F 
+GAS LISTING /tmp/cc60kbk9.s 			page 63
+
+
+ 1272      63735F42 
+ 1272      7242475F 
+ 1272      736F6674 
+ 1273              	.LASF17:
+ 1274 0015 68656174 		.string	"heatmap_cs_BrBG_mixed_exp"
+ 1274      6D61705F 
+ 1274      63735F42 
+ 1274      7242475F 
+ 1274      6D697865 
+ 1275              	.LASF12:
+ 1276 002f 73697A65 		.string	"size_t"
+ 1276      5F7400
+ 1277              	.LASF13:
+ 1278 0036 68656174 		.string	"heatmap_colorscheme_t"
+ 1278      6D61705F 
+ 1278      636F6C6F 
+ 1278      72736368 
+ 1278      656D655F 
+ 1279              	.LASF14:
+ 1280 004c 68656174 		.string	"heatmap_cs_BrBG_discrete"
+ 1280      6D61705F 
+ 1280      63735F42 
+ 1280      7242475F 
+ 1280      64697363 
+ 1281              	.LASF26:
+ 1282 0065 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1282      43313720 
+ 1282      31322E32 
+ 1282      2E30202D 
+ 1282      6D74756E 
+ 1283              	.LASF6:
+ 1284 00c4 666C6F61 		.string	"float"
+ 1284      7400
+ 1285              	.LASF11:
+ 1286 00ca 756E7369 		.string	"unsigned char"
+ 1286      676E6564 
+ 1286      20636861 
+ 1286      7200
+ 1287              	.LASF3:
+ 1288 00d8 6C6F6E67 		.string	"long unsigned int"
+ 1288      20756E73 
+ 1288      69676E65 
+ 1288      6420696E 
+ 1288      7400
+ 1289              	.LASF8:
+ 1290 00ea 73686F72 		.string	"short unsigned int"
+ 1290      7420756E 
+ 1290      7369676E 
+ 1290      65642069 
+ 1290      6E7400
+ 1291              	.LASF25:
+ 1292 00fd 6D697865 		.string	"mixed_exp"
+ 1292      645F6578 
+ 1292      7000
+ 1293              	.LASF23:
+ 1294 0107 6D697865 		.string	"mixed"
+ 1294      6400
+GAS LISTING /tmp/cc60kbk9.s 			page 64
+
+
+ 1295              	.LASF7:
+ 1296 010d 756E7369 		.string	"unsigned int"
+ 1296      676E6564 
+ 1296      20696E74 
+ 1296      00
+ 1297              	.LASF19:
+ 1298 011a 64697363 		.string	"discrete"
+ 1298      72657465 
+ 1298      00
+ 1299              	.LASF20:
+ 1300 0123 736F6674 		.string	"soft_data"
+ 1300      5F646174 
+ 1300      6100
+ 1301              	.LASF10:
+ 1302 012d 6E636F6C 		.string	"ncolors"
+ 1302      6F727300 
+ 1303              	.LASF16:
+ 1304 0135 68656174 		.string	"heatmap_cs_BrBG_mixed"
+ 1304      6D61705F 
+ 1304      63735F42 
+ 1304      7242475F 
+ 1304      6D697865 
+ 1305              	.LASF4:
+ 1306 014b 6C6F6E67 		.string	"long long int"
+ 1306      206C6F6E 
+ 1306      6720696E 
+ 1306      7400
+ 1307              	.LASF24:
+ 1308 0159 6D697865 		.string	"mixed_exp_data"
+ 1308      645F6578 
+ 1308      705F6461 
+ 1308      746100
+ 1309              	.LASF22:
+ 1310 0168 6D697865 		.string	"mixed_data"
+ 1310      645F6461 
+ 1310      746100
+ 1311              	.LASF2:
+ 1312 0173 6C6F6E67 		.string	"long int"
+ 1312      20696E74 
+ 1312      00
+ 1313              	.LASF5:
+ 1314 017c 6C6F6E67 		.string	"long double"
+ 1314      20646F75 
+ 1314      626C6500 
+ 1315              	.LASF18:
+ 1316 0188 64697363 		.string	"discrete_data"
+ 1316      72657465 
+ 1316      5F646174 
+ 1316      6100
+ 1317              	.LASF21:
+ 1318 0196 736F6674 		.string	"soft"
+ 1318      00
+ 1319              	.LASF9:
+ 1320 019b 636F6C6F 		.string	"colors"
+ 1320      727300
+ 1321              		.section	.debug_line_str,"MS",@progbits,1
+ 1322              	.LASF1:
+GAS LISTING /tmp/cc60kbk9.s 			page 65
+
+
+ 1323 0000 2F726F6F 		.string	"/root/repo"
+ 1323      742F7265 
+ 1323      706F00
+ 1324              	.LASF0:
+ 1325 000b 636F6C6F 		.string	"colorschemes/BrBG.c"
+ 1325      72736368 
+ 1325      656D6573 
+ 1325      2F427242 
+ 1325      472E6300 
+ 1326              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1327 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1327      742F7265 
+ 1327      706F0063 
+ 1327      6F6C6F72 
+ 1327      73636865 
@@ -0,0 +1,4046 @@
+GAS LISTING /tmp/ccZQdzcl.s 			page 1
+
+
+   1              		.file	"BuGn.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/BuGn.c"
+   5              		.globl	heatmap_cs_BuGn_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_BuGn_mixed_exp, @object
+   9              		.size	heatmap_cs_BuGn_mixed_exp, 8
+  10              	heatmap_cs_BuGn_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 00       		.string	""
+  29 0005 441A00   		.string	"D\032"
+  30 0008 00       		.string	""
+  31 0009 461C1800 		.string	"F\034\030"
+  32 000d 481D3100 		.string	"H\0351"
+  33 0011 4B1E4A00 		.string	"K\036J"
+  34 0015 4D1F6300 		.string	"M\037c"
+  35 0019 50207C00 		.string	"P |"
+  36 001d 52219500 		.string	"R!\225"
+  37 0021 5D25AE00 		.string	"]%\256"
+  38 0025 5F26C700 		.string	"_&\307"
+  39 0029 6227E000 		.string	"b'\340"
+  40 002d 6428F900 		.string	"d(\371"
+  41 0031 6629FF00 		.string	"f)\377"
+  42 0035 692AFF00 		.string	"i*\377"
+  43 0039 6B2BFF00 		.string	"k+\377"
+  44 003d 6D2CFF03 		.ascii	"m,\377\003o-\377\005p/\377\007r0\377\nt1\377\fu3\377\016w4\377"
+  44      6F2DFF05 
+  44      702FFF07 
+  44      7230FF0A 
+  44      7431FF0C 
+  45 0058 107835FF 		.ascii	"\020x5\377\030\200<\377\032\201=\377\033\203>\377\035\204?\377"
+  45      18803CFF 
+  45      1A813DFF 
+  45      1B833EFF 
+  45      1D843FFF 
+  46 006c 1E8641FF 		.ascii	"\036\206A\377 \207B\377!\211C\377\"\212D\377$\214G\377%\216I"
+GAS LISTING /tmp/ccZQdzcl.s 			page 2
+
+
+  46      208742FF 
+  46      218943FF 
+  46      228A44FF 
+  46      248C47FF 
+  47 0083 FF278F4B 		.ascii	"\377'\217K\377(\221N\377)\223P\377+\224R\377,\226T\377-\227W"
+  47      FF28914E 
+  47      FF299350 
+  47      FF2B9452 
+  47      FF2C9654 
+  48 009b FF35A063 		.ascii	"\3775\240c\3776\242e\3777\243g\3779\245i\377:\246k\377;\250m"
+  48      FF36A265 
+  48      FF37A367 
+  48      FF39A569 
+  48      FF3AA66B 
+  49 00b3 FF3DA96F 		.ascii	"\377=\251o\377>\253q\377?\254s\377@\255u\377B\256w\377C\257y"
+  49      FF3EAB71 
+  49      FF3FAC73 
+  49      FF40AD75 
+  49      FF42AE77 
+  50 00cb FF44B07B 		.ascii	"\377D\260{\377E\261}\377G\262\177\377H\262\201\377I\263\203\377"
+  50      FF45B17D 
+  50      FF47B27F 
+  50      FF48B281 
+  50      FF49B383 
+  51 00e0 4BB485FF 		.ascii	"K\264\205\377L\265\207\377N\265\210\377V\272\223\377X\273\225"
+  51      4CB587FF 
+  51      4EB588FF 
+  51      56BA93FF 
+  51      58BB95
+  52 00f3 FF59BC97 		.ascii	"\377Y\274\227\377[\274\230\377\\\275\232\377]\276\233\377_\276"
+  52      FF5BBC98 
+  52      FF5CBD9A 
+  52      FF5DBE9B 
+  52      FF5FBE
+  53 0106 9DFF60BF 		.ascii	"\235\377`\277\236\377b\300\240\377c\300\241\377e\301\243\377"
+  53      9EFF62C0 
+  53      A0FF63C0 
+  53      A1FF65C1 
+  53      A3FF
+  54 0118 66C2A4FF 		.ascii	"f\302\244\377h\303\245\377j\303\247\377k\304\250\377m\305\251"
+  54      68C3A5FF 
+  54      6AC3A7FF 
+  54      6BC4A8FF 
+  54      6DC5A9
+  55 012b FF6EC5AA 		.ascii	"\377n\305\252\377p\306\254\377r\307\255\377s\310\256\377u\310"
+  55      FF70C6AC 
+  55      FF72C7AD 
+  55      FF73C8AE 
+  55      FF75C8
+  56 013e AFFF76C9 		.ascii	"\257\377v\311\260\377x\312\261\377y\312\263\377\205\317\273\377"
+  56      B0FF78CA 
+  56      B1FF79CA 
+  56      B3FF85CF 
+  56      BBFF
+  57 0150 87D0BCFF 		.ascii	"\207\320\274\377\210\321\275\377\212\321\276\377\213\322\277"
+  57      88D1BDFF 
+  57      8AD1BEFF 
+GAS LISTING /tmp/ccZQdzcl.s 			page 3
+
+
+  57      8BD2BF
+  58 015f FF8CD2C0 		.ascii	"\377\214\322\300\377\216\323\301\377\217\324\302\377\221\324"
+  58      FF8ED3C1 
+  58      FF8FD4C2 
+  58      FF91D4
+  59 016e C3FF92D5 		.ascii	"\303\377\222\325\304\377\223\325\305\377\225\326\306\377\226"
+  59      C4FF93D5 
+  59      C5FF95D6 
+  59      C6FF96
+  60 017d D7C7FF98 		.ascii	"\327\307\377\230\327\310\377\231\330\311\377\232\330\312\377"
+  60      D7C8FF99 
+  60      D8C9FF9A 
+  60      D8CAFF
+  61 018c 9CD9CAFF 		.ascii	"\234\331\312\377\235\331\313\377\236\332\314\377\237\332\315"
+  61      9DD9CBFF 
+  61      9EDACCFF 
+  61      9FDACD
+  62 019b FFA1DBCD 		.ascii	"\377\241\333\315\377\242\333\316\377\243\334\317\377\244\334"
+  62      FFA2DBCE 
+  62      FFA3DCCF 
+  62      FFA4DC
+  63 01aa CFFFA5DD 		.ascii	"\317\377\245\335\320\377\247\335\321\377\250\336\322\377\251"
+  63      D0FFA7DD 
+  63      D1FFA8DE 
+  63      D2FFA9
+  64 01b9 DED2FFAA 		.ascii	"\336\322\377\252\336\323\377\253\337\324\377\254\337\324\377"
+  64      DED3FFAB 
+  64      DFD4FFAC 
+  64      DFD4FF
+  65 01c8 B8E4DBFF 		.ascii	"\270\344\333\377\271\344\333\377\272\345\334\377\273\345\334"
+  65      B9E4DBFF 
+  65      BAE5DCFF 
+  65      BBE5DC
+  66 01d7 FFBCE6DD 		.ascii	"\377\274\346\335\377\275\346\336\377\276\346\336\377\277\347"
+  66      FFBDE6DE 
+  66      FFBEE6DE 
+  66      FFBFE7
+  67 01e6 DFFFC0E7 		.ascii	"\337\377\300\347\337\377\301\350\340\377\302\350\341\377\303"
+  67      DFFFC1E8 
+  67      E0FFC2E8 
+  67      E1FFC3
+  68 01f5 E8E1FFC4 		.ascii	"\350\341\377\304\351\342\377\305\351\342\377\306\351\343\377"
+  68      E9E2FFC5 
+  68      E9E2FFC6 
+  68      E9E3FF
+  69 0204 C7EAE3FF 		.ascii	"\307\352\343\377\310\352\344\377\311\353\344\377\312\353\345"
+  69      C8EAE4FF 
+  69      C9EBE4FF 
+  69      CAEBE5
+  70 0213 FFCBEBE5 		.ascii	"\377\313\353\345\377\314\354\346\377\314\354\346\377\314\354"
+  70      FFCCECE6 
+  70      FFCCECE6 
+  70      FFCCEC
+  71 0222 E7FFCDEC 		.ascii	"\347\377\315\354\347\377\315\354\350\377\315\354\350\377\316"
+  71      E7FFCDEC 
+  71      E8FFCDEC 
+  71      E8FFCE
+GAS LISTING /tmp/ccZQdzcl.s 			page 4
+
+
+  72 0231 EDE8FFCE 		.ascii	"\355\350\377\316\355\351\377\316\355\351\377\317\355\352\377"
+  72      EDE9FFCE 
+  72      EDE9FFCF 
+  72      EDEAFF
+  73 0240 CFEDEAFF 		.ascii	"\317\355\352\377\320\355\352\377\320\356\353\377\320\356\353"
+  73      D0EDEAFF 
+  73      D0EEEBFF 
+  73      D0EEEB
+  74 024f FFD1EEEB 		.ascii	"\377\321\356\353\377\321\356\354\377\321\356\354\377\322\356"
+  74      FFD1EEEC 
+  74      FFD1EEEC 
+  74      FFD2EE
+  75 025e ECFFD2EE 		.ascii	"\354\377\322\356\355\377\322\356\355\377\323\357\355\377\323"
+  75      EDFFD2EE 
+  75      EDFFD3EF 
+  75      EDFFD3
+  76 026d EFEEFFD4 		.ascii	"\357\356\377\324\357\356\377\324\357\356\377\324\357\356\377"
+  76      EFEEFFD4 
+  76      EFEEFFD4 
+  76      EFEEFF
+  77 027c DAF1F2FF 		.ascii	"\332\361\362\377\332\361\363\377\332\361\363\377\333\361\363"
+  77      DAF1F3FF 
+  77      DAF1F3FF 
+  77      DBF1F3
+  78 028b FFDBF2F3 		.ascii	"\377\333\362\363\377\333\362\364\377\334\362\364\377\334\362"
+  78      FFDBF2F4 
+  78      FFDCF2F4 
+  78      FFDCF2
+  79 029a F4FFDCF2 		.ascii	"\364\377\334\362\364\377\335\362\365\377\335\362\365\377\335"
+  79      F4FFDDF2 
+  79      F5FFDDF2 
+  79      F5FFDD
+  80 02a9 F2F5FFDE 		.ascii	"\362\365\377\336\362\365\377\336\363\365\377\336\363\366\377"
+  80      F2F5FFDE 
+  80      F3F5FFDE 
+  80      F3F6FF
+  81 02b8 DFF3F6FF 		.ascii	"\337\363\366\377\337\363\366\377\337\363\366\377\340\363\366"
+  81      DFF3F6FF 
+  81      DFF3F6FF 
+  81      E0F3F6
+  82 02c7 FFE0F3F6 		.ascii	"\377\340\363\366\377\340\363\367\377\341\363\367\377\341\363"
+  82      FFE0F3F7 
+  82      FFE1F3F7 
+  82      FFE1F3
+  83 02d6 F7FFE1F3 		.ascii	"\367\377\341\363\367\377\342\364\367\377\342\364\367\377\342"
+  83      F7FFE2F4 
+  83      F7FFE2F4 
+  83      F7FFE2
+  84 02e5 F4F7FFE2 		.ascii	"\364\367\377\342\364\370\377\343\364\370\377\343\364\370\377"
+  84      F4F8FFE3 
+  84      F4F8FFE3 
+  84      F4F8FF
+  85 02f4 E3F4F8FF 		.ascii	"\343\364\370\377\344\364\370\377\344\364\370\377\344\364\370"
+  85      E4F4F8FF 
+  85      E4F4F8FF 
+  85      E4F4F8
+  86 0303 FFE4F4F8 		.ascii	"\377\344\364\370\377\345\365\371\377\345\365\371\377\345\365"
+GAS LISTING /tmp/ccZQdzcl.s 			page 5
+
+
+  86      FFE5F5F9 
+  86      FFE5F5F9 
+  86      FFE5F5
+  87 0312 F9FFE5F5 		.ascii	"\371\377\345\365\371\377\345\365\371\377\345\365\371\377\346"
+  87      F9FFE5F5 
+  87      F9FFE5F5 
+  87      F9FFE6
+  88 0321 F5F9FFE6 		.ascii	"\365\371\377\346\365\371\377\346\365\371\377\346\365\371\377"
+  88      F5F9FFE6 
+  88      F5F9FFE6 
+  88      F5F9FF
+  89 0330 E6F5F9FF 		.ascii	"\346\365\371\377\346\365\371\377\347\365\371\377\347\365\371"
+  89      E6F5F9FF 
+  89      E7F5F9FF 
+  89      E7F5F9
+  90 033f FFE7F5F9 		.ascii	"\377\347\365\371\377\347\365\371\377\347\366\371\377\347\366"
+  90      FFE7F5F9 
+  90      FFE7F6F9 
+  90      FFE7F6
+  91 034e F9FFE7F6 		.ascii	"\371\377\347\366\371\377\350\366\371\377\350\366\371\377\350"
+  91      F9FFE8F6 
+  91      F9FFE8F6 
+  91      F9FFE8
+  92 035d F6F9FFE8 		.ascii	"\366\371\377\350\366\371\377\350\366\371\377\350\366\371\377"
+  92      F6F9FFE8 
+  92      F6F9FFE8 
+  92      F6F9FF
+  93 036c E8F6F9FF 		.ascii	"\350\366\371\377\351\366\371\377\351\366\371\377\351\366\371"
+  93      E9F6F9FF 
+  93      E9F6F9FF 
+  93      E9F6F9
+  94 037b FFE9F6F9 		.ascii	"\377\351\366\371\377\351\366\371\377\351\366\371\377\351\366"
+  94      FFE9F6F9 
+  94      FFE9F6F9 
+  94      FFE9F6
+  95 038a F9FFE9F6 		.ascii	"\371\377\351\366\372\377\351\366\372\377\352\367\372\377\352"
+  95      FAFFE9F6 
+  95      FAFFEAF7 
+  95      FAFFEA
+  96 0399 F7FAFFEA 		.ascii	"\367\372\377\352\367\372\377\352\367\372\377\352\367\372\377"
+  96      F7FAFFEA 
+  96      F7FAFFEA 
+  96      F7FAFF
+  97 03a8 EAF7FAFF 		.ascii	"\352\367\372\377\352\367\372\377\352\367\372\377\353\367\372"
+  97      EAF7FAFF 
+  97      EAF7FAFF 
+  97      EBF7FA
+  98 03b7 FFEBF7FA 		.ascii	"\377\353\367\372\377\353\367\372\377\353\367\372\377\353\367"
+  98      FFEBF7FA 
+  98      FFEBF7FA 
+  98      FFEBF7
+  99 03c6 FAFFEBF7 		.ascii	"\372\377\353\367\372\377\353\367\372\377\353\367\372\377\353"
+  99      FAFFEBF7 
+  99      FAFFEBF7 
+  99      FAFFEB
+ 100 03d5 F7FAFFEB 		.ascii	"\367\372\377\353\367\372\377\354\367\372\377\354\367\372\377"
+ 100      F7FAFFEC 
+GAS LISTING /tmp/ccZQdzcl.s 			page 6
+
+
+ 100      F7FAFFEC 
+ 100      F7FAFF
+ 101 03e4 EFF9FBFF 		.ascii	"\357\371\373\377\357\371\373\377\357\371\373\377\360\371\373"
+ 101      EFF9FBFF 
+ 101      EFF9FBFF 
+ 101      F0F9FB
+ 102 03f3 FFF0F9FB 		.ascii	"\377\360\371\373\377\360\371\373\377\360\371\373\377\360\371"
+ 102      FFF0F9FB 
+ 102      FFF0F9FB 
+ 102      FFF0F9
+ 103 0402 FBFFF0F9 		.ascii	"\373\377\360\371\373\377\360\371\373\377\360\371\373\377\360"
+ 103      FBFFF0F9 
+ 103      FBFFF0F9 
+ 103      FBFFF0
+ 104 0411 F9FBFFF0 		.ascii	"\371\373\377\360\371\373\377\360\371\373\377\360\371\373\377"
+ 104      F9FBFFF0 
+ 104      F9FBFFF0 
+ 104      F9FBFF
+ 105 0420 F1F9FBFF 		.ascii	"\361\371\373\377\361\371\373\377\361\371\373\377\361\371\373"
+ 105      F1F9FBFF 
+ 105      F1F9FBFF 
+ 105      F1F9FB
+ 106 042f FFF1F9FB 		.ascii	"\377\361\371\373\377\361\371\373\377\361\371\373\377\361\371"
+ 106      FFF1F9FB 
+ 106      FFF1F9FB 
+ 106      FFF1F9
+ 107 043e FBFFF1F9 		.ascii	"\373\377\361\371\373\377\361\371\373\377\361\372\373\377\361"
+ 107      FBFFF1F9 
+ 107      FBFFF1FA 
+ 107      FBFFF1
+ 108 044d FAFBFFF1 		.ascii	"\372\373\377\361\372\373\377\362\372\373\377\362\372\373\377"
+ 108      FAFBFFF2 
+ 108      FAFBFFF2 
+ 108      FAFBFF
+ 109 045c F2FAFBFF 		.ascii	"\362\372\373\377\362\372\373\377\362\372\373\377\362\372\373"
+ 109      F2FAFBFF 
+ 109      F2FAFBFF 
+ 109      F2FAFB
+ 110 046b FFF2FAFB 		.ascii	"\377\362\372\373\377\362\372\373\377\362\372\373\377\362\372"
+ 110      FFF2FAFB 
+ 110      FFF2FAFB 
+ 110      FFF2FA
+ 111 047a FBFFF2FA 		.ascii	"\373\377\362\372\373\377\362\372\373\377\362\372\373\377\362"
+ 111      FBFFF2FA 
+ 111      FBFFF2FA 
+ 111      FBFFF2
+ 112 0489 FAFCFFF2 		.ascii	"\372\374\377\362\372\374\377\362\372\374\377\362\372\374\377"
+ 112      FAFCFFF2 
+ 112      FAFCFFF2 
+ 112      FAFCFF
+ 113 0498 F3FAFCFF 		.ascii	"\363\372\374\377\363\372\374\377\363\372\374\377\363\372\374"
+ 113      F3FAFCFF 
+ 113      F3FAFCFF 
+ 113      F3FAFC
+ 114 04a7 FFF3FAFC 		.ascii	"\377\363\372\374\377\363\372\374\377\363\372\374\377\363\372"
+ 114      FFF3FAFC 
+ 114      FFF3FAFC 
+GAS LISTING /tmp/ccZQdzcl.s 			page 7
+
+
+ 114      FFF3FA
+ 115 04b6 FCFFF3FA 		.ascii	"\374\377\363\372\374\377\363\372\374\377\363\372\374\377\363"
+ 115      FCFFF3FA 
+ 115      FCFFF3FA 
+ 115      FCFFF3
+ 116 04c5 FAFCFFF3 		.ascii	"\372\374\377\363\372\374\377\363\372\374\377\363\372\374\377"
+ 116      FAFCFFF3 
+ 116      FAFCFFF3 
+ 116      FAFCFF
+ 117 04d4 F3FAFCFF 		.ascii	"\363\372\374\377\363\372\374\377\363\372\374\377\363\372\374"
+ 117      F3FAFCFF 
+ 117      F3FAFCFF 
+ 117      F3FAFC
+ 118 04e3 FFF3FAFC 		.ascii	"\377\363\372\374\377\363\372\374\377\364\372\374\377\364\372"
+ 118      FFF3FAFC 
+ 118      FFF4FAFC 
+ 118      FFF4FA
+ 119 04f2 FCFFF4FA 		.ascii	"\374\377\364\372\374\377\364\372\374\377\364\372\374\377\364"
+ 119      FCFFF4FA 
+ 119      FCFFF4FA 
+ 119      FCFFF4
+ 120 0501 FAFCFFF4 		.ascii	"\372\374\377\364\372\374\377\364\372\374\377\364\372\374\377"
+ 120      FAFCFFF4 
+ 120      FAFCFFF4 
+ 120      FAFCFF
+ 121 0510 F4FAFCFF 		.ascii	"\364\372\374\377\364\373\374\377\364\373\374\377\364\373\374"
+ 121      F4FBFCFF 
+ 121      F4FBFCFF 
+ 121      F4FBFC
+ 122 051f FFF4FBFC 		.ascii	"\377\364\373\374\377\364\373\374\377\364\373\374\377\364\373"
+ 122      FFF4FBFC 
+ 122      FFF4FBFC 
+ 122      FFF4FB
+ 123 052e FCFFF4FB 		.ascii	"\374\377\364\373\374\377\364\373\374\377\364\373\374\377\364"
+ 123      FCFFF4FB 
+ 123      FCFFF4FB 
+ 123      FCFFF4
+ 124 053d FBFCFFF4 		.ascii	"\373\374\377\364\373\374\377\364\373\374\377\364\373\374\377"
+ 124      FBFCFFF4 
+ 124      FBFCFFF4 
+ 124      FBFCFF
+ 125 054c F4FBFCFF 		.ascii	"\364\373\374\377\364\373\374\377\364\373\374\377\364\373\374"
+ 125      F4FBFCFF 
+ 125      F4FBFCFF 
+ 125      F4FBFC
+ 126 055b FFF5FBFC 		.ascii	"\377\365\373\374\377\365\373\374\377\365\373\374\377\365\373"
+ 126      FFF5FBFC 
+ 126      FFF5FBFC 
+ 126      FFF5FB
+ 127 056a FCFFF5FB 		.ascii	"\374\377\365\373\374\377\365\373\374\377\365\373\374\377\365"
+ 127      FCFFF5FB 
+ 127      FCFFF5FB 
+ 127      FCFFF5
+ 128 0579 FBFCFFF5 		.ascii	"\373\374\377\365\373\374\377\365\373\374\377\365\373\374\377"
+ 128      FBFCFFF5 
+ 128      FBFCFFF5 
+ 128      FBFCFF
+GAS LISTING /tmp/ccZQdzcl.s 			page 8
+
+
+ 129 0588 F5FBFCFF 		.ascii	"\365\373\374\377\365\373\374\377\365\373\374\377\365\373\374"
+ 129      F5FBFCFF 
+ 129      F5FBFCFF 
+ 129      F5FBFC
+ 130 0597 FFF5FBFC 		.ascii	"\377\365\373\374\377\365\373\374\377\365\373\374\377\365\373"
+ 130      FFF5FBFC 
+ 130      FFF5FBFC 
+ 130      FFF5FB
+ 131 05a6 FCFFF5FB 		.ascii	"\374\377\365\373\374\377\365\373\374\377\365\373\374\377\365"
+ 131      FCFFF5FB 
+ 131      FCFFF5FB 
+ 131      FCFFF5
+ 132 05b5 FBFCFFF5 		.ascii	"\373\374\377\365\373\374\377\365\373\374\377\365\373\374\377"
+ 132      FBFCFFF5 
+ 132      FBFCFFF5 
+ 132      FBFCFF
+ 133 05c4 F5FBFCFF 		.ascii	"\365\373\374\377\365\373\374\377\365\373\374\377\365\373\374"
+ 133      F5FBFCFF 
+ 133      F5FBFCFF 
+ 133      F5FBFC
+ 134 05d3 FFF5FBFC 		.ascii	"\377\365\373\374\377\365\373\374\377\365\373\374\377\365\373"
+ 134      FFF5FBFC 
+ 134      FFF5FBFC 
+ 134      FFF5FB
+ 135 05e2 FCFFF5FB 		.ascii	"\374\377\365\373\374\377\365\373\374\377\365\373\374\377\365"
+ 135      FCFFF5FB 
+ 135      FCFFF5FB 
+ 135      FCFFF5
+ 136 05f1 FBFCFFF5 		.ascii	"\373\374\377\365\373\374\377\365\373\374\377\365\373\374\377"
+ 136      FBFCFFF5 
+ 136      FBFCFFF5 
+ 136      FBFCFF
+ 137 0600 F5FBFCFF 		.ascii	"\365\373\374\377\365\373\374\377\365\373\374\377\365\373\374"
+ 137      F5FBFCFF 
+ 137      F5FBFCFF 
+ 137      F5FBFC
+ 138 060f FFF5FBFC 		.ascii	"\377\365\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 138      FFF6FBFC 
+ 138      FFF6FBFC 
+ 138      FFF6FB
+ 139 061e FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 139      FCFFF6FB 
+ 139      FCFFF6FB 
+ 139      FCFFF6
+ 140 062d FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 140      FBFCFFF6 
+ 140      FBFCFFF6 
+ 140      FBFCFF
+ 141 063c F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 141      F6FBFCFF 
+ 141      F6FBFCFF 
+ 141      F6FBFC
+ 142 064b FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 142      FFF6FBFC 
+ 142      FFF6FBFC 
+ 142      FFF6FB
+ 143 065a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+GAS LISTING /tmp/ccZQdzcl.s 			page 9
+
+
+ 143      FCFFF6FB 
+ 143      FCFFF6FB 
+ 143      FCFFF6
+ 144 0669 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 144      FBFCFFF6 
+ 144      FBFCFFF6 
+ 144      FBFCFF
+ 145 0678 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 145      F6FBFCFF 
+ 145      F6FBFCFF 
+ 145      F6FBFC
+ 146 0687 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 146      FFF6FBFC 
+ 146      FFF6FBFC 
+ 146      FFF6FB
+ 147 0696 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 147      FCFFF6FB 
+ 147      FCFFF6FB 
+ 147      FCFFF6
+ 148 06a5 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 148      FBFCFFF6 
+ 148      FBFCFFF6 
+ 148      FBFCFF
+ 149 06b4 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 149      F6FBFCFF 
+ 149      F6FBFCFF 
+ 149      F6FBFC
+ 150 06c3 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 150      FFF6FBFC 
+ 150      FFF6FBFC 
+ 150      FFF6FB
+ 151 06d2 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 151      FCFFF6FB 
+ 151      FCFFF6FB 
+ 151      FCFFF6
+ 152 06e1 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 152      FBFCFFF6 
+ 152      FBFCFFF6 
+ 152      FBFCFF
+ 153 06f0 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 153      F6FBFCFF 
+ 153      F6FBFCFF 
+ 153      F6FBFC
+ 154 06ff FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 154      FFF6FBFC 
+ 154      FFF6FBFC 
+ 154      FFF6FB
+ 155 070e FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 155      FCFFF6FB 
+ 155      FCFFF6FB 
+ 155      FCFFF6
+ 156 071d FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 156      FBFCFFF6 
+ 156      FBFCFFF6 
+ 156      FBFCFF
+ 157 072c F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 157      F6FBFCFF 
+GAS LISTING /tmp/ccZQdzcl.s 			page 10
+
+
+ 157      F6FBFCFF 
+ 157      F6FBFC
+ 158 073b FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 158      FFF6FBFC 
+ 158      FFF6FBFC 
+ 158      FFF6FB
+ 159 074a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 159      FCFFF6FB 
+ 159      FCFFF6FB 
+ 159      FCFFF6
+ 160 0759 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 160      FBFCFFF6 
+ 160      FBFCFFF6 
+ 160      FBFCFF
+ 161 0768 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 161      F6FBFCFF 
+ 161      F6FBFCFF 
+ 161      F6FBFC
+ 162 0777 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 162      FFF6FBFC 
+ 162      FFF6FBFC 
+ 162      FFF6FB
+ 163 0786 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 163      FCFFF6FB 
+ 163      FCFFF6FB 
+ 163      FCFFF6
+ 164 0795 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 164      FBFCFFF6 
+ 164      FBFCFFF6 
+ 164      FBFCFF
+ 165 07a4 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 165      F6FBFCFF 
+ 165      F6FBFCFF 
+ 165      F6FBFC
+ 166 07b3 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 166      FFF6FBFC 
+ 166      FFF6FBFC 
+ 166      FFF6FB
+ 167 07c2 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 167      FCFFF6FB 
+ 167      FCFFF6FB 
+ 167      FCFF
+ 168 07d0 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 168      F6FBFCFF 
+ 168      F6FBFCFF 
+ 168      F6FBFC
+ 169 07df FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 169      FFF6FBFC 
+ 169      FFF6FBFC 
+ 169      FFF6FB
+ 170 07ee FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 170      FCFFF6FB 
+ 170      FCFFF6FB 
+ 170      FCFFF6
+ 171 07fd FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 171      FBFCFFF6 
+ 171      FBFCFFF6 
+GAS LISTING /tmp/ccZQdzcl.s 			page 11
+
+
+ 171      FBFCFF
+ 172 080c F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 172      F6FBFCFF 
+ 172      F6FBFCFF 
+ 172      F6FBFC
+ 173 081b FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 173      FFF6FBFC 
+ 173      FFF6FBFC 
+ 173      FFF6FB
+ 174 082a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 174      FCFFF6FB 
+ 174      FCFFF6FB 
+ 174      FCFFF6
+ 175 0839 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 175      FBFCFFF6 
+ 175      FBFCFFF6 
+ 175      FBFCFF
+ 176 0848 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 176      F6FBFCFF 
+ 176      F6FBFCFF 
+ 176      F6FBFC
+ 177 0857 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 177      FFF6FBFC 
+ 177      FFF6FBFC 
+ 177      FFF6FB
+ 178 0866 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 178      FCFFF6FB 
+ 178      FCFFF6FB 
+ 178      FCFFF6
+ 179 0875 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 179      FBFCFFF6 
+ 179      FBFCFFF6 
+ 179      FBFCFF
+ 180 0884 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 180      F6FBFCFF 
+ 180      F6FBFCFF 
+ 180      F6FBFC
+ 181 0893 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 181      FFF6FBFC 
+ 181      FFF6FBFC 
+ 181      FFF6FB
+ 182 08a2 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 182      FCFFF6FB 
+ 182      FCFFF6FB 
+ 182      FCFFF6
+ 183 08b1 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 183      FBFCFFF6 
+ 183      FBFCFFF6 
+ 183      FBFCFF
+ 184 08c0 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 184      F6FBFCFF 
+ 184      F6FBFCFF 
+ 184      F6FBFC
+ 185 08cf FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 185      FFF6FBFC 
+ 185      FFF6FBFC 
+ 185      FFF6FB
+GAS LISTING /tmp/ccZQdzcl.s 			page 12
+
+
+ 186 08de FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 186      FCFFF6FB 
+ 186      FCFFF6FB 
+ 186      FCFFF6
+ 187 08ed FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 187      FBFCFFF6 
+ 187      FBFCFFF6 
+ 187      FBFCFF
+ 188 08fc F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 188      F6FBFCFF 
+ 188      F6FBFCFF 
+ 188      F6FBFC
+ 189 090b FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 189      FFF6FBFC 
+ 189      FFF6FBFC 
+ 189      FFF6FB
+ 190 091a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 190      FCFFF6FB 
+ 190      FCFFF6FB 
+ 190      FCFFF6
+ 191 0929 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 191      FBFCFFF6 
+ 191      FBFCFFF6 
+ 191      FBFCFF
+ 192 0938 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 192      F6FBFCFF 
+ 192      F6FBFCFF 
+ 192      F6FBFC
+ 193 0947 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 193      FFF6FBFC 
+ 193      FFF6FBFC 
+ 193      FFF6FB
+ 194 0956 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 194      FCFFF6FB 
+ 194      FCFFF6FB 
+ 194      FCFFF6
+ 195 0965 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 195      FBFCFFF6 
+ 195      FBFCFFF6 
+ 195      FBFCFF
+ 196 0974 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 196      F6FBFCFF 
+ 196      F6FBFCFF 
+ 196      F6FBFC
+ 197 0983 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 197      FFF6FBFC 
+ 197      FFF6FBFC 
+ 197      FFF6FB
+ 198 0992 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 198      FCFFF6FB 
+ 198      FCFFF6FB 
+ 198      FCFFF6
+ 199 09a1 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 199      FBFCFFF6 
+ 199      FBFCFFF6 
+ 199      FBFCFF
+ 200 09b0 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+GAS LISTING /tmp/ccZQdzcl.s 			page 13
+
+
+ 200      F6FBFCFF 
+ 200      F6FBFCFF 
+ 200      F6FBFC
+ 201 09bf FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 201      FFF6FBFC 
+ 201      FFF6FBFC 
+ 201      FFF6FB
+ 202 09ce FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 202      FCFFF6FB 
+ 202      FCFFF6FB 
+ 202      FCFFF6
+ 203 09dd FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 203      FBFCFFF6 
+ 203      FBFCFFF6 
+ 203      FBFCFF
+ 204 09ec F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 204      F6FBFCFF 
+ 204      F6FBFCFF 
+ 204      F6FBFC
+ 205 09fb FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 205      FFF6FBFC 
+ 205      FFF6FBFC 
+ 205      FFF6FB
+ 206 0a0a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 206      FCFFF6FB 
+ 206      FCFFF6FB 
+ 206      FCFFF6
+ 207 0a19 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 207      FBFCFFF6 
+ 207      FBFCFFF6 
+ 207      FBFCFF
+ 208 0a28 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 208      F6FBFCFF 
+ 208      F6FBFCFF 
+ 208      F6FBFC
+ 209 0a37 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 209      FFF6FBFC 
+ 209      FFF6FBFC 
+ 209      FFF6FB
+ 210 0a46 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 210      FCFFF6FB 
+ 210      FCFFF6FB 
+ 210      FCFFF6
+ 211 0a55 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 211      FBFCFFF6 
+ 211      FBFCFFF6 
+ 211      FBFCFF
+ 212 0a64 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 212      F6FBFCFF 
+ 212      F6FBFCFF 
+ 212      F6FBFC
+ 213 0a73 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 213      FFF6FBFC 
+ 213      FFF6FBFC 
+ 213      FFF6FB
+ 214 0a82 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 214      FCFFF6FB 
+GAS LISTING /tmp/ccZQdzcl.s 			page 14
+
+
+ 214      FCFFF6FB 
+ 214      FCFFF6
+ 215 0a91 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 215      FBFCFFF6 
+ 215      FBFCFFF6 
+ 215      FBFCFF
+ 216 0aa0 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 216      F6FBFCFF 
+ 216      F6FBFCFF 
+ 216      F6FBFC
+ 217 0aaf FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 217      FFF6FBFC 
+ 217      FFF6FBFC 
+ 217      FFF6FB
+ 218 0abe FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 218      FCFFF6FB 
+ 218      FCFFF6FB 
+ 218      FCFFF6
+ 219 0acd FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 219      FBFCFFF6 
+ 219      FBFCFFF6 
+ 219      FBFCFF
+ 220 0adc F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 220      F6FBFCFF 
+ 220      F6FBFCFF 
+ 220      F6FBFC
+ 221 0aeb FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 221      FFF6FBFC 
+ 221      FFF6FBFC 
+ 221      FFF6FB
+ 222 0afa FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 222      FCFFF6FB 
+ 222      FCFFF6FB 
+ 222      FCFFF6
+ 223 0b09 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 223      FBFCFFF6 
+ 223      FBFCFFF6 
+ 223      FBFCFF
+ 224 0b18 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 224      F6FBFCFF 
+ 224      F6FBFCFF 
+ 224      F6FBFC
+ 225 0b27 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 225      FFF6FBFC 
+ 225      FFF6FBFC 
+ 225      FFF6FB
+ 226 0b36 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 226      FCFFF6FB 
+ 226      FCFFF6FB 
+ 226      FCFFF6
+ 227 0b45 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 227      FBFCFFF6 
+ 227      FBFCFFF6 
+ 227      FBFCFF
+ 228 0b54 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 228      F6FBFCFF 
+ 228      F6FBFCFF 
+GAS LISTING /tmp/ccZQdzcl.s 			page 15
+
+
+ 228      F6FBFC
+ 229 0b63 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 229      FFF6FBFC 
+ 229      FFF6FBFC 
+ 229      FFF6FB
+ 230 0b72 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 230      FCFFF6FB 
+ 230      FCFFF6FB 
+ 230      FCFFF6
+ 231 0b81 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 231      FBFCFFF6 
+ 231      FBFCFFF6 
+ 231      FBFCFF
+ 232 0b90 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 232      F6FBFCFF 
+ 232      F6FBFCFF 
+ 232      F6FBFC
+ 233 0b9f FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 233      FFF6FBFC 
+ 233      FFF6FBFC 
+ 233      FFF6FB
+ 234 0bae FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 234      FCFFF6FB 
+ 234      FCFFF6FB 
+ 234      FCFFF6
+ 235 0bbd FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 235      FBFCFFF6 
+ 235      FBFCFFF6 
+ 235      FBFCFF
+ 236 0bcc F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 236      F6FBFCFF 
+ 236      F6FBFCFF 
+ 236      F6FBFC
+ 237 0bdb FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 237      FFF6FBFC 
+ 237      FFF6FBFC 
+ 237      FFF6FB
+ 238 0bea FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 238      FCFFF6FB 
+ 238      FCFFF6FB 
+ 238      FCFFF6
+ 239 0bf9 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 239      FBFCFFF6 
+ 239      FBFCFFF6 
+ 239      FBFCFF
+ 240 0c08 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 240      F6FBFCFF 
+ 240      F6FBFCFF 
+ 240      F6FBFC
+ 241 0c17 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 241      FFF6FBFC 
+ 241      FFF6FBFC 
+ 241      FFF6FB
+ 242 0c26 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 242      FCFFF6FB 
+ 242      FCFFF6FB 
+ 242      FCFFF6
+GAS LISTING /tmp/ccZQdzcl.s 			page 16
+
+
+ 243 0c35 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 243      FBFCFFF6 
+ 243      FBFCFFF6 
+ 243      FBFCFF
+ 244 0c44 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 244      F6FBFCFF 
+ 244      F6FBFCFF 
+ 244      F6FBFC
+ 245 0c53 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 245      FFF6FBFC 
+ 245      FFF6FBFC 
+ 245      FFF6FB
+ 246 0c62 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 246      FCFFF6FB 
+ 246      FCFFF6FB 
+ 246      FCFFF6
+ 247 0c71 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\374\374\377\366\374\374\377"
+ 247      FBFCFFF6 
+ 247      FCFCFFF6 
+ 247      FCFCFF
+ 248 0c80 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 248      F6FCFCFF 
+ 248      F6FCFCFF 
+ 248      F6FCFC
+ 249 0c8f FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 249      FFF6FCFC 
+ 249      FFF6FCFC 
+ 249      FFF6FC
+ 250 0c9e FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 250      FCFFF6FC 
+ 250      FCFFF6FC 
+ 250      FCFFF6
+ 251 0cad FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 251      FCFCFFF6 
+ 251      FCFCFFF6 
+ 251      FCFCFF
+ 252 0cbc F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 252      F6FCFCFF 
+ 252      F6FCFCFF 
+ 252      F6FCFC
+ 253 0ccb FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 253      FFF6FCFC 
+ 253      FFF6FCFC 
+ 253      FFF6FC
+ 254 0cda FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 254      FCFFF6FC 
+ 254      FCFFF6FC 
+ 254      FCFFF6
+ 255 0ce9 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 255      FCFCFFF6 
+ 255      FCFCFFF6 
+ 255      FCFCFF
+ 256 0cf8 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 256      F6FCFCFF 
+ 256      F6FCFCFF 
+ 256      F6FCFC
+ 257 0d07 FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+GAS LISTING /tmp/ccZQdzcl.s 			page 17
+
+
+ 257      FFF6FCFC 
+ 257      FFF6FCFC 
+ 257      FFF6FC
+ 258 0d16 FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 258      FCFFF6FC 
+ 258      FCFFF6FC 
+ 258      FCFFF6
+ 259 0d25 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 259      FCFCFFF6 
+ 259      FCFCFFF6 
+ 259      FCFCFF
+ 260 0d34 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 260      F6FCFCFF 
+ 260      F6FCFCFF 
+ 260      F6FCFC
+ 261 0d43 FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 261      FFF6FCFC 
+ 261      FFF6FCFC 
+ 261      FFF6FC
+ 262 0d52 FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 262      FCFFF6FC 
+ 262      FCFFF6FC 
+ 262      FCFFF6
+ 263 0d61 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 263      FCFCFFF6 
+ 263      FCFCFFF6 
+ 263      FCFCFF
+ 264 0d70 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 264      F6FCFCFF 
+ 264      F6FCFCFF 
+ 264      F6FCFC
+ 265 0d7f FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 265      FFF6FCFC 
+ 265      FFF6FCFC 
+ 265      FFF6FC
+ 266 0d8e FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 266      FCFFF6FC 
+ 266      FCFFF6FC 
+ 266      FCFFF6
+ 267 0d9d FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 267      FCFCFFF6 
+ 267      FCFCFFF6 
+ 267      FCFCFF
+ 268 0dac F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 268      F6FCFCFF 
+ 268      F6FCFCFF 
+ 268      F6FCFC
+ 269 0dbb FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 269      FFF6FCFC 
+ 269      FFF6FCFC 
+ 269      FFF6FC
+ 270 0dca FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 270      FCFFF6FC 
+ 270      FCFFF6FC 
+ 270      FCFFF6
+ 271 0dd9 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 271      FCFCFFF6 
+GAS LISTING /tmp/ccZQdzcl.s 			page 18
+
+
+ 271      FCFCFFF6 
+ 271      FCFCFF
+ 272 0de8 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 272      F6FCFCFF 
+ 272      F6FCFCFF 
+ 272      F6FCFC
+ 273 0df7 FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 273      FFF6FCFC 
+ 273      FFF6FCFC 
+ 273      FFF6FC
+ 274 0e06 FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 274      FCFFF6FC 
+ 274      FCFFF6FC 
+ 274      FCFFF6
+ 275 0e15 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 275      FCFCFFF6 
+ 275      FCFCFFF6 
+ 275      FCFCFF
+ 276 0e24 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 276      F6FCFCFF 
+ 276      F6FCFCFF 
+ 276      F6FCFC
+ 277 0e33 FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 277      FFF6FCFC 
+ 277      FFF6FCFC 
+ 277      FFF6FC
+ 278 0e42 FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 278      FCFFF6FC 
+ 278      FCFFF6FC 
+ 278      FCFFF6
+ 279 0e51 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 279      FCFCFFF6 
+ 279      FCFCFFF6 
+ 279      FCFCFF
+ 280 0e60 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 280      F6FCFCFF 
+ 280      F6FCFCFF 
+ 280      F6FCFC
+ 281 0e6f FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 281      FFF6FCFC 
+ 281      FFF6FCFC 
+ 281      FFF6FC
+ 282 0e7e FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 282      FCFFF6FC 
+ 282      FCFFF6FC 
+ 282      FCFFF6
+ 283 0e8d FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 283      FCFCFFF6 
+ 283      FCFCFFF6 
+ 283      FCFCFF
+ 284 0e9c F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 284      F6FCFCFF 
+ 284      F6FCFCFF 
+ 284      F6FCFC
+ 285 0eab FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 285      FFF6FCFC 
+ 285      FFF6FCFC 
+GAS LISTING /tmp/ccZQdzcl.s 			page 19
+
+
+ 285      FFF6FC
+ 286 0eba FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 286      FCFFF6FC 
+ 286      FCFFF6FC 
+ 286      FCFFF6
+ 287 0ec9 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 287      FCFCFFF6 
+ 287      FCFCFFF6 
+ 287      FCFCFF
+ 288 0ed8 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 288      F6FCFCFF 
+ 288      F6FCFCFF 
+ 288      F6FCFC
+ 289 0ee7 FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 289      FFF6FCFC 
+ 289      FFF6FCFC 
+ 289      FFF6FC
+ 290 0ef6 FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 290      FCFFF6FC 
+ 290      FCFFF6FC 
+ 290      FCFFF6
+ 291 0f05 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 291      FCFCFFF6 
+ 291      FCFCFFF6 
+ 291      FCFCFF
+ 292 0f14 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 292      F6FCFCFF 
+ 292      F6FCFCFF 
+ 292      F6FCFC
+ 293 0f23 FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 293      FFF6FCFC 
+ 293      FFF6FCFC 
+ 293      FFF6FC
+ 294 0f32 FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 294      FCFFF6FC 
+ 294      FCFFF6FC 
+ 294      FCFFF6
+ 295 0f41 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 295      FCFCFFF6 
+ 295      FCFCFFF6 
+ 295      FCFCFF
+ 296 0f50 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 296      F6FCFCFF 
+ 296      F6FCFCFF 
+ 296      F6FCFC
+ 297 0f5f FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 297      FFF6FCFC 
+ 297      FFF6FCFC 
+ 297      FFF6FC
+ 298 0f6e FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 298      FCFFF6FC 
+ 298      FCFFF6FC 
+ 298      FCFFF6
+ 299 0f7d FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 299      FCFCFFF6 
+ 299      FCFCFFF6 
+ 299      FCFCFF
+GAS LISTING /tmp/ccZQdzcl.s 			page 20
+
+
+ 300 0f8c F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 300      F6FCFCFF 
+ 300      F6FCFCFF 
+ 300      F6FCFC
+ 301 0f9b FFF6FCFC 		.ascii	"\377\366\374\374\377"
+ 301      FF
+ 302 0fa0 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 302      F6FCFCFF 
+ 302      F6FCFCFF 
+ 302      F6FCFC
+ 303 0faf FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 303      FFF6FCFC 
+ 303      FFF6FCFC 
+ 303      FFF6FC
+ 304 0fbe FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 304      FCFFF6FC 
+ 304      FCFFF6FC 
+ 304      FCFFF6
+ 305 0fcd FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 305      FCFCFFF6 
+ 305      FCFCFFF6 
+ 305      FCFCFF
+ 306 0fdc F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 306      F6FCFCFF 
+ 306      F6FCFCFF 
+ 306      F6FCFC
+ 307 0feb FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 307      FFF6FCFC 
+ 307      FFF6FCFC 
+ 307      FFF6FC
+ 308 0ffa FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377"
+ 308      FCFFF6FC 
+ 308      FCFF
+ 309              		.globl	heatmap_cs_BuGn_mixed
+ 310              		.section	.data.rel.local
+ 311              		.align 8
+ 312              		.type	heatmap_cs_BuGn_mixed, @object
+ 313              		.size	heatmap_cs_BuGn_mixed, 8
+ 314              	heatmap_cs_BuGn_mixed:
+ 315 0008 00000000 		.quad	mixed
+ 315      00000000 
+ 316              		.section	.data.rel.ro.local
+ 317              		.align 16
+ 318              		.type	mixed, @object
+ 319              		.size	mixed, 16
+ 320              	mixed:
+ 321 0010 00000000 		.quad	mixed_data
+ 321      00000000 
+ 322 0018 01040000 		.quad	1025
+ 322      00000000 
+ 323              		.section	.rodata
+ 324 1004 00000000 		.align 32
+ 324      00000000 
+ 324      00000000 
+ 324      00000000 
+ 324      00000000 
+ 325              		.type	mixed_data, @object
+GAS LISTING /tmp/ccZQdzcl.s 			page 21
+
+
+ 326              		.size	mixed_data, 4100
+ 327              	mixed_data:
+ 328 1020 00       		.string	""
+ 329 1021 00       		.string	""
+ 330 1022 00       		.string	""
+ 331 1023 00       		.string	""
+ 332 1024 00       		.string	""
+ 333 1025 441A00   		.string	"D\032"
+ 334 1028 00       		.string	""
+ 335 1029 441B0700 		.string	"D\033\007"
+ 336 102d 441B0E00 		.string	"D\033\016"
+ 337 1031 441B1600 		.string	"D\033\026"
+ 338 1035 441B1D00 		.string	"D\033\035"
+ 339 1039 451B2500 		.string	"E\033%"
+ 340 103d 451B2C00 		.string	"E\033,"
+ 341 1041 451B3400 		.string	"E\0334"
+ 342 1045 451B3B00 		.string	"E\033;"
+ 343 1049 461B4300 		.string	"F\033C"
+ 344 104d 461C4A00 		.string	"F\034J"
+ 345 1051 461C5200 		.string	"F\034R"
+ 346 1055 461C5900 		.string	"F\034Y"
+ 347 1059 471C6100 		.string	"G\034a"
+ 348 105d 471C6800 		.string	"G\034h"
+ 349 1061 471C7000 		.string	"G\034p"
+ 350 1065 471C7700 		.string	"G\034w"
+ 351 1069 481C7F00 		.string	"H\034\177"
+ 352 106d 481C8600 		.string	"H\034\206"
+ 353 1071 481D8D00 		.string	"H\035\215"
+ 354 1075 481D9500 		.string	"H\035\225"
+ 355 1079 491D9C00 		.string	"I\035\234"
+ 356 107d 491DA400 		.string	"I\035\244"
+ 357 1081 491DAB00 		.string	"I\035\253"
+ 358 1085 491DB300 		.string	"I\035\263"
+ 359 1089 4A1DBA00 		.string	"J\035\272"
+ 360 108d 4A1DC200 		.string	"J\035\302"
+ 361 1091 4A1DC900 		.string	"J\035\311"
+ 362 1095 4A1DD100 		.string	"J\035\321"
+ 363 1099 4B1ED800 		.string	"K\036\330"
+ 364 109d 4B1EE000 		.string	"K\036\340"
+ 365 10a1 4B1EE700 		.string	"K\036\347"
+ 366 10a5 4B1EEF00 		.string	"K\036\357"
+ 367 10a9 4C1EF600 		.string	"L\036\366"
+ 368 10ad 4C1EFE00 		.string	"L\036\376"
+ 369 10b1 4C1EFF00 		.string	"L\036\377"
+ 370 10b5 4C1EFF00 		.string	"L\036\377"
+ 371 10b9 4D1EFF00 		.string	"M\036\377"
+ 372 10bd 4D1FFF00 		.string	"M\037\377"
+ 373 10c1 4D1FFF00 		.string	"M\037\377"
+ 374 10c5 4D1FFF00 		.string	"M\037\377"
+ 375 10c9 4E1FFF00 		.string	"N\037\377"
+ 376 10cd 4E1FFF00 		.string	"N\037\377"
+ 377 10d1 4E1FFF00 		.string	"N\037\377"
+ 378 10d5 4E1FFF00 		.string	"N\037\377"
+ 379 10d9 4F1FFF00 		.string	"O\037\377"
+ 380 10dd 4F1FFF00 		.string	"O\037\377"
+ 381 10e1 4F1FFF00 		.string	"O\037\377"
+ 382 10e5 4F20FF00 		.string	"O \377"
+GAS LISTING /tmp/ccZQdzcl.s 			page 22
+
+
+ 383 10e9 5020FF00 		.string	"P \377"
+ 384 10ed 5020FF00 		.string	"P \377"
+ 385 10f1 5020FF00 		.string	"P \377"
+ 386 10f5 5120FF00 		.string	"Q \377"
+ 387 10f9 5120FF00 		.string	"Q \377"
+ 388 10fd 5120FF00 		.string	"Q \377"
+ 389 1101 5120FF00 		.string	"Q \377"
+ 390 1105 5220FF00 		.string	"R \377"
+ 391 1109 5221FF00 		.string	"R!\377"
+ 392 110d 5221FF00 		.string	"R!\377"
+ 393 1111 5221FF00 		.string	"R!\377"
+ 394 1115 5321FF00 		.string	"S!\377"
+ 395 1119 5321FF00 		.string	"S!\377"
+ 396 111d 5321FF00 		.string	"S!\377"
+ 397 1121 5321FF00 		.string	"S!\377"
+ 398 1125 5C25FF00 		.string	"\\%\377"
+ 399 1129 5C25FF00 		.string	"\\%\377"
+ 400 112d 5C25FF00 		.string	"\\%\377"
+ 401 1131 5D25FF00 		.string	"]%\377"
+ 402 1135 5D25FF00 		.string	"]%\377"
+ 403 1139 5D25FF00 		.string	"]%\377"
+ 404 113d 5D25FF00 		.string	"]%\377"
+ 405 1141 5E25FF00 		.string	"^%\377"
+ 406 1145 5E26FF00 		.string	"^&\377"
+ 407 1149 5E26FF00 		.string	"^&\377"
+ 408 114d 5E26FF00 		.string	"^&\377"
+ 409 1151 5F26FF00 		.string	"_&\377"
+ 410 1155 5F26FF00 		.string	"_&\377"
+ 411 1159 5F26FF00 		.string	"_&\377"
+ 412 115d 5F26FF00 		.string	"_&\377"
+ 413 1161 6026FF00 		.string	"`&\377"
+ 414 1165 6026FF00 		.string	"`&\377"
+ 415 1169 6027FF00 		.string	"`'\377"
+ 416 116d 6027FF00 		.string	"`'\377"
+ 417 1171 6127FF00 		.string	"a'\377"
+ 418 1175 6127FF00 		.string	"a'\377"
+ 419 1179 6127FF00 		.string	"a'\377"
+ 420 117d 6127FF00 		.string	"a'\377"
+ 421 1181 6227FF00 		.string	"b'\377"
+ 422 1185 6227FF00 		.string	"b'\377"
+ 423 1189 6227FF00 		.string	"b'\377"
+ 424 118d 6327FF00 		.string	"c'\377"
+ 425 1191 6328FF00 		.string	"c(\377"
+ 426 1195 6328FF00 		.string	"c(\377"
+ 427 1199 6328FF00 		.string	"c(\377"
+ 428 119d 6428FF00 		.string	"d(\377"
+ 429 11a1 6428FF00 		.string	"d(\377"
+ 430 11a5 6428FF00 		.string	"d(\377"
+ 431 11a9 6428FF00 		.string	"d(\377"
+ 432 11ad 6528FF00 		.string	"e(\377"
+ 433 11b1 6528FF00 		.string	"e(\377"
+ 434 11b5 6529FF00 		.string	"e)\377"
+ 435 11b9 6529FF00 		.string	"e)\377"
+ 436 11bd 6629FF00 		.string	"f)\377"
+ 437 11c1 6629FF00 		.string	"f)\377"
+ 438 11c5 6629FF00 		.string	"f)\377"
+ 439 11c9 6629FF00 		.string	"f)\377"
+GAS LISTING /tmp/ccZQdzcl.s 			page 23
+
+
+ 440 11cd 6729FF00 		.string	"g)\377"
+ 441 11d1 6729FF00 		.string	"g)\377"
+ 442 11d5 6729FF00 		.string	"g)\377"
+ 443 11d9 6729FF00 		.string	"g)\377"
+ 444 11dd 682AFF00 		.string	"h*\377"
+ 445 11e1 682AFF00 		.string	"h*\377"
+ 446 11e5 682AFF00 		.string	"h*\377"
+ 447 11e9 692AFF00 		.string	"i*\377"
+ 448 11ed 692AFF00 		.string	"i*\377"
+ 449 11f1 692AFF00 		.string	"i*\377"
+ 450 11f5 692AFF00 		.string	"i*\377"
+ 451 11f9 6A2AFF00 		.string	"j*\377"
+ 452 11fd 6A2AFF00 		.string	"j*\377"
+ 453 1201 6A2BFF00 		.string	"j+\377"
+ 454 1205 6A2BFF00 		.string	"j+\377"
+ 455 1209 6B2BFF00 		.string	"k+\377"
+ 456 120d 6B2BFF00 		.string	"k+\377"
+ 457 1211 6B2BFF00 		.string	"k+\377"
+ 458 1215 6B2BFF00 		.string	"k+\377"
+ 459 1219 6C2BFF00 		.string	"l+\377"
+ 460 121d 6C2BFF00 		.string	"l+\377"
+ 461 1221 6C2BFF00 		.string	"l+\377"
+ 462 1225 6D2BFF00 		.string	"m+\377"
+ 463 1229 6D2CFF00 		.string	"m,\377"
+ 464 122d 6D2CFF00 		.string	"m,\377"
+ 465 1231 6D2CFF00 		.string	"m,\377"
+ 466 1235 6D2CFF01 		.ascii	"m,\377\001m,\377\001n,\377\001n-\377\001n-\377\002n-\377\002"
+ 466      6D2CFF01 
+ 466      6E2CFF01 
+ 466      6E2DFF01 
+ 466      6E2DFF02 
+ 467 124d 6E2DFF02 		.ascii	"n-\377\002o-\377\002o-\377\003o-\377\003o.\377\003o.\377\004"
+ 467      6F2DFF02 
+ 467      6F2DFF03 
+ 467      6F2DFF03 
+ 467      6F2EFF03 
+ 468 1265 6F2EFF04 		.ascii	"o.\377\004p.\377\004p.\377\004p.\377\005p/\377\005p/\377\005"
+ 468      702EFF04 
+ 468      702EFF04 
+ 468      702EFF05 
+ 468      702FFF05 
+ 469 127d 712FFF05 		.ascii	"q/\377\005q/\377\006q/\377\006q/\377\006q/\377\007q0\377\007"
+ 469      712FFF06 
+ 469      712FFF06 
+ 469      712FFF06 
+ 469      712FFF07 
+ 470 1295 7230FF07 		.ascii	"r0\377\007r0\377\007r0\377\br0\377\br0\377\bs1\377\ts1\377\t"
+ 470      7230FF07 
+ 470      7230FF08 
+ 470      7230FF08 
+ 470      7230FF08 
+ 471 12b1 7331FF09 		.ascii	"s1\377\ts1\377\ts1\377\nt1\377\nt1\377\nt2\377\nt2\377\013t2"
+ 471      7331FF09 
+ 471      7331FF0A 
+ 471      7431FF0A 
+ 471      7431FF0A 
+ 472 12cf FF0B7432 		.ascii	"\377\013t2\377\013u2\377\013u2\377\fu3\377\fu3\377\fu3\377\f"
+GAS LISTING /tmp/ccZQdzcl.s 			page 24
+
+
+ 472      FF0B7532 
+ 472      FF0B7532 
+ 472      FF0C7533 
+ 472      FF0C7533 
+ 473 12e9 7633FF0D 		.ascii	"v3\377\rv3\377\rv3\377\rv4\377\rv4\377\rw4\377\016w4\377\016"
+ 473      7633FF0D 
+ 473      7633FF0D 
+ 473      7634FF0D 
+ 473      7634FF0D 
+ 474 1305 7734FF0E 		.ascii	"w4\377\016w4\377\016w4\377\017w5\377\017x5\377\017x5\377\017"
+ 474      7734FF0E 
+ 474      7734FF0F 
+ 474      7735FF0F 
+ 474      7835FF0F 
+ 475 131d 7835FF0F 		.ascii	"x5\377\017x5\377\027~:\377\027\177;\377\027\177;\377\027\177"
+ 475      7835FF17 
+ 475      7E3AFF17 
+ 475      7F3BFF17 
+ 475      7F3BFF17 
+ 476 1332 3BFF177F 		.ascii	";\377\027\177;\377\030\177;\377\030\200;\377\030\200;\377\030"
+ 476      3BFF187F 
+ 476      3BFF1880 
+ 476      3BFF1880 
+ 476      3BFF18
+ 477 1345 803CFF18 		.ascii	"\200<\377\030\200<\377\031\200<\377\031\200<\377\031\201<\377"
+ 477      803CFF19 
+ 477      803CFF19 
+ 477      803CFF19 
+ 477      813CFF
+ 478 1358 19813CFF 		.ascii	"\031\201<\377\031\201=\377\032\201=\377\032\201=\377\032\202"
+ 478      19813DFF 
+ 478      1A813DFF 
+ 478      1A813DFF 
+ 478      1A82
+ 479 136a 3DFF1A82 		.ascii	"=\377\032\202=\377\032\202=\377\033\202>\377\033\202>\377\033"
+ 479      3DFF1A82 
+ 479      3DFF1B82 
+ 479      3EFF1B82 
+ 479      3EFF1B
+ 480 137d 833EFF1B 		.ascii	"\203>\377\033\203>\377\033\203>\377\034\203>\377\034\203>\377"
+ 480      833EFF1B 
+ 480      833EFF1C 
+ 480      833EFF1C 
+ 480      833EFF
+ 481 1390 1C833FFF 		.ascii	"\034\203?\377\034\204?\377\034\204?\377\034\204?\377\035\204"
+ 481      1C843FFF 
+ 481      1C843FFF 
+ 481      1C843FFF 
+ 481      1D84
+ 482 13a2 3FFF1D84 		.ascii	"?\377\035\204?\377\035\205@\377\035\205@\377\035\205@\377\036"
+ 482      3FFF1D85 
+ 482      40FF1D85 
+ 482      40FF1D85 
+ 482      40FF1E
+ 483 13b5 8540FF1E 		.ascii	"\205@\377\036\205@\377\036\206@\377\036\206A\377\036\206A\377"
+ 483      8540FF1E 
+ 483      8640FF1E 
+GAS LISTING /tmp/ccZQdzcl.s 			page 25
+
+
+ 483      8641FF1E 
+ 483      8641FF
+ 484 13c8 1E8641FF 		.ascii	"\036\206A\377\037\206A\377\037\206A\377\037\207A\377\037\207"
+ 484      1F8641FF 
+ 484      1F8641FF 
+ 484      1F8741FF 
+ 484      1F87
+ 485 13da 41FF1F87 		.ascii	"A\377\037\207B\377 \207B\377 \207B\377 \210B\377 \210B\377 \210"
+ 485      42FF2087 
+ 485      42FF2087 
+ 485      42FF2088 
+ 485      42FF2088 
+ 486 13f2 42FF2088 		.ascii	"B\377 \210C\377!\210C\377!\211C\377!\211C\377!\211C\377!\211"
+ 486      43FF2188 
+ 486      43FF2189 
+ 486      43FF2189 
+ 486      43FF2189 
+ 487 140a 43FF2189 		.ascii	"C\377!\211D\377\"\212D\377\"\212D\377\"\212D\377\"\212D\377\""
+ 487      44FF228A 
+ 487      44FF228A 
+ 487      44FF228A 
+ 487      44FF228A 
+ 488 1421 8A44FF23 		.ascii	"\212D\377#\213D\377#\213E\377#\213E\377#\213E\377#\213F\377#"
+ 488      8B44FF23 
+ 488      8B45FF23 
+ 488      8B45FF23 
+ 488      8B45FF23 
+ 489 1439 8C46FF24 		.ascii	"\214F\377$\214F\377$\214G\377$\214G\377$\214G\377$\215H\377%"
+ 489      8C46FF24 
+ 489      8C47FF24 
+ 489      8C47FF24 
+ 489      8C47FF24 
+ 490 1451 8D48FF25 		.ascii	"\215H\377%\215H\377%\215H\377%\216I\377%\216I\377%\216I\377&"
+ 490      8D48FF25 
+ 490      8D48FF25 
+ 490      8E49FF25 
+ 490      8E49FF25 
+ 491 1469 8E4AFF26 		.ascii	"\216J\377&\216J\377&\217J\377&\217K\377&\217K\377'\217K\377'"
+ 491      8E4AFF26 
+ 491      8F4AFF26 
+ 491      8F4BFF26 
+ 491      8F4BFF27 
+ 492 1481 8F4CFF27 		.ascii	"\217L\377'\220L\377'\220L\377'\220L\377'\220M\377(\221M\377("
+ 492      904CFF27 
+ 492      904CFF27 
+ 492      904CFF27 
+ 492      904DFF28 
+ 493 1499 914DFF28 		.ascii	"\221M\377(\221N\377(\221N\377(\221N\377)\222O\377)\222O\377)"
+ 493      914EFF28 
+ 493      914EFF28 
+ 493      914EFF29 
+ 493      924FFF29 
+ 494 14b1 924FFF29 		.ascii	"\222O\377)\222P\377)\223P\377)\223P\377*\223P\377*\223Q\377*"
+ 494      9250FF29 
+ 494      9350FF29 
+ 494      9350FF2A 
+ 494      9350FF2A 
+GAS LISTING /tmp/ccZQdzcl.s 			page 26
+
+
+ 495 14c9 9351FF2A 		.ascii	"\223Q\377*\224Q\377*\224R\377+\224R\377+\224R\377+\224S\377+"
+ 495      9451FF2A 
+ 495      9452FF2B 
+ 495      9452FF2B 
+ 495      9452FF2B 
+ 496 14e1 9553FF2B 		.ascii	"\225S\377+\225S\377+\225T\377,\225T\377,\226T\377,\226T\377,"
+ 496      9553FF2B 
+ 496      9554FF2C 
+ 496      9554FF2C 
+ 496      9654FF2C 
+ 497 14f9 9655FF2C 		.ascii	"\226U\377,\226U\377-\226U\377-\227V\377-\227V\377-\227V\377-"
+ 497      9655FF2D 
+ 497      9655FF2D 
+ 497      9756FF2D 
+ 497      9756FF2D 
+ 498 1511 9757FF2E 		.ascii	"\227W\377.\230W\377.\230W\377.\230W\377.\230X\3774\237b\3774"
+ 498      9857FF2E 
+ 498      9857FF2E 
+ 498      9857FF2E 
+ 498      9858FF34 
+ 499 1529 A062FF35 		.ascii	"\240b\3775\240c\3775\240c\3775\240c\3775\241c\3775\241d\3776"
+ 499      A063FF35 
+ 499      A063FF35 
+ 499      A063FF35 
+ 499      A163FF35 
+ 500 1541 A164FF36 		.ascii	"\241d\3776\241d\3776\241e\3776\242e\3776\242e\3777\242f\3777"
+ 500      A164FF36 
+ 500      A165FF36 
+ 500      A265FF36 
+ 500      A265FF37 
+ 501 1559 A266FF37 		.ascii	"\242f\3777\243f\3777\243f\3777\243g\3777\243g\3778\243g\3778"
+ 501      A366FF37 
+ 501      A366FF37 
+ 501      A367FF37 
+ 501      A367FF38 
+ 502 1571 A468FF38 		.ascii	"\244h\3778\244h\3778\244h\3778\244i\3779\244i\3779\245i\3779"
+ 502      A468FF38 
+ 502      A468FF38 
+ 502      A469FF39 
+ 502      A469FF39 
+ 503 1589 A56AFF39 		.ascii	"\245j\3779\245j\3779\245j\377:\246j\377:\246k\377:\246k\377:"
+ 503      A56AFF39 
+ 503      A56AFF3A 
+ 503      A66AFF3A 
+ 503      A66BFF3A 
+ 504 15a1 A66BFF3A 		.ascii	"\246k\377:\246l\377:\247l\377;\247l\377;\247m\377;\247m\377;"
+ 504      A66CFF3A 
+ 504      A76CFF3B 
+ 504      A76CFF3B 
+ 504      A76DFF3B 
+ 505 15b9 A86DFF3B 		.ascii	"\250m\377;\250n\377<\250n\377<\250n\377<\250n\377<\251o\377<"
+ 505      A86EFF3C 
+ 505      A86EFF3C 
+ 505      A86EFF3C 
+ 505      A86EFF3C 
+ 506 15d1 A96FFF3D 		.ascii	"\251o\377=\251o\377=\251p\377=\252p\377=\252p\377=\252q\377>"
+ 506      A96FFF3D 
+GAS LISTING /tmp/ccZQdzcl.s 			page 27
+
+
+ 506      A970FF3D 
+ 506      AA70FF3D 
+ 506      AA70FF3D 
+ 507 15e9 AA71FF3E 		.ascii	"\252q\377>\252q\377>\253r\377>\253r\377>\253r\377?\253r\377?"
+ 507      AA71FF3E 
+ 507      AB72FF3E 
+ 507      AB72FF3E 
+ 507      AB72FF3F 
+ 508 1601 AC73FF3F 		.ascii	"\254s\377?\254s\377?\254s\377?\254t\377@\254t\377@\255t\377@"
+ 508      AC73FF3F 
+ 508      AC73FF3F 
+ 508      AC74FF40 
+ 508      AC74FF40 
+ 509 1619 AD75FF40 		.ascii	"\255u\377@\255u\377@\255u\377A\256u\377A\256v\377A\256v\377A"
+ 509      AD75FF40 
+ 509      AD75FF41 
+ 509      AE75FF41 
+ 509      AE76FF41 
+ 510 1631 AE76FF41 		.ascii	"\256v\377A\256w\377A\256w\377B\256w\377B\256x\377B\257x\377B"
+ 510      AE77FF41 
+ 510      AE77FF42 
+ 510      AE77FF42 
+ 510      AE78FF42 
+ 511 1649 AF78FF42 		.ascii	"\257x\377B\257y\377C\257y\377C\257y\377C\257z\377C\257z\377C"
+ 511      AF79FF43 
+ 511      AF79FF43 
+ 511      AF79FF43 
+ 511      AF7AFF43 
+ 512 1661 AF7AFF44 		.ascii	"\257z\377D\260z\377D\260{\377D\260{\377D\260{\377D\260|\377E"
+ 512      B07AFF44 
+ 512      B07BFF44 
+ 512      B07BFF44 
+ 512      B07BFF44 
+ 513 1679 B07CFF45 		.ascii	"\260|\377E\260|\377E\260}\377E\261}\377E\261}\377F\261}\377F"
+ 513      B07CFF45 
+ 513      B07DFF45 
+ 513      B17DFF45 
+ 513      B17DFF46 
+ 514 1691 B17EFF46 		.ascii	"\261~\377F\261~\377F\261~\377F\261\177\377G\262\177\377G\262"
+ 514      B17EFF46 
+ 514      B17EFF46 
+ 514      B17FFF47 
+ 514      B27FFF47 
+ 515 16a6 7FFF47B2 		.ascii	"\177\377G\262\200\377G\262\200\377G\262\200\377H\262\200\377"
+ 515      80FF47B2 
+ 515      80FF47B2 
+ 515      80FF48B2 
+ 515      80FF
+ 516 16b8 48B281FF 		.ascii	"H\262\201\377H\262\201\377H\263\201\377H\263\202\377I\263\202"
+ 516      48B281FF 
+ 516      48B381FF 
+ 516      48B382FF 
+ 516      49B382
+ 517 16cb FF49B382 		.ascii	"\377I\263\202\377I\263\203\377I\263\203\377J\263\203\377J\263"
+ 517      FF49B383 
+ 517      FF49B383 
+ 517      FF4AB383 
+GAS LISTING /tmp/ccZQdzcl.s 			page 28
+
+
+ 517      FF4AB3
+ 518 16de 83FF4AB4 		.ascii	"\203\377J\264\204\377J\264\204\377J\264\204\377K\264\205\377"
+ 518      84FF4AB4 
+ 518      84FF4AB4 
+ 518      84FF4BB4 
+ 518      85FF
+ 519 16f0 4BB485FF 		.ascii	"K\264\205\377K\264\205\377K\264\206\377L\264\206\377L\265\206"
+ 519      4BB485FF 
+ 519      4BB486FF 
+ 519      4CB486FF 
+ 519      4CB586
+ 520 1703 FF4CB586 		.ascii	"\377L\265\206\377L\265\207\377L\265\207\377M\265\207\377M\265"
+ 520      FF4CB587 
+ 520      FF4CB587 
+ 520      FF4DB587 
+ 520      FF4DB5
+ 521 1716 88FF4DB5 		.ascii	"\210\377M\265\210\377M\265\210\377N\266\210\377U\272\222\377"
+ 521      88FF4DB5 
+ 521      88FF4EB6 
+ 521      88FF55BA 
+ 521      92FF
+ 522 1728 56BA92FF 		.ascii	"V\272\222\377V\272\222\377V\272\223\377V\272\223\377V\272\223"
+ 522      56BA92FF 
+ 522      56BA93FF 
+ 522      56BA93FF 
+ 522      56BA93
+ 523 173b FF57BA94 		.ascii	"\377W\272\224\377W\273\224\377W\273\224\377W\273\224\377X\273"
+ 523      FF57BB94 
+ 523      FF57BB94 
+ 523      FF57BB94 
+ 523      FF58BB
+ 524 174e 95FF58BB 		.ascii	"\225\377X\273\225\377X\273\225\377X\273\226\377Y\273\226\377"
+ 524      95FF58BB 
+ 524      95FF58BB 
+ 524      96FF59BB 
+ 524      96FF
+ 525 1760 59BC96FF 		.ascii	"Y\274\226\377Y\274\226\377Y\274\227\377Z\274\227\377Z\274\227"
+ 525      59BC96FF 
+ 525      59BC97FF 
+ 525      5ABC97FF 
+ 525      5ABC97
+ 526 1773 FF5ABC98 		.ascii	"\377Z\274\230\377Z\274\230\377[\274\230\377[\275\230\377[\275"
+ 526      FF5ABC98 
+ 526      FF5BBC98 
+ 526      FF5BBD98 
+ 526      FF5BBD
+ 527 1786 99FF5BBD 		.ascii	"\231\377[\275\231\377\\\275\231\377\\\275\232\377\\\275\232\377"
+ 527      99FF5CBD 
+ 527      99FF5CBD 
+ 527      9AFF5CBD 
+ 527      9AFF
+ 528 1798 5CBD9AFF 		.ascii	"\\\275\232\377]\275\232\377]\276\233\377]\276\233\377]\276\233"
+ 528      5DBD9AFF 
+ 528      5DBE9BFF 
+ 528      5DBE9BFF 
+ 528      5DBE9B
+ 529 17ab FF5EBE9B 		.ascii	"\377^\276\233\377^\276\234\377^\276\234\377^\276\234\377_\276"
+GAS LISTING /tmp/ccZQdzcl.s 			page 29
+
+
+ 529      FF5EBE9C 
+ 529      FF5EBE9C 
+ 529      FF5EBE9C 
+ 529      FF5FBE
+ 530 17be 9DFF5FBE 		.ascii	"\235\377_\276\235\377_\277\235\377_\277\235\377`\277\236\377"
+ 530      9DFF5FBF 
+ 530      9DFF5FBF 
+ 530      9DFF60BF 
+ 530      9EFF
+ 531 17d0 60BF9EFF 		.ascii	"`\277\236\377`\277\236\377`\277\236\377a\277\237\377a\277\237"
+ 531      60BF9EFF 
+ 531      60BF9EFF 
+ 531      61BF9FFF 
+ 531      61BF9F
+ 532 17e3 FF61C09F 		.ascii	"\377a\300\237\377a\300\240\377b\300\240\377"
+ 532      FF61C0A0 
+ 532      FF62C0A0 
+ 532      FF
+ 533 17f0 62C0A0FF 		.ascii	"b\300\240\377b\300\240\377c\300\241\377c\300\241\377c\300\241"
+ 533      62C0A0FF 
+ 533      63C0A1FF 
+ 533      63C0A1FF 
+ 533      63C0A1
+ 534 1803 FF63C1A1 		.ascii	"\377c\301\241\377d\301\242\377d\301\242\377d\301\242\377d\301"
+ 534      FF64C1A2 
+ 534      FF64C1A2 
+ 534      FF64C1A2 
+ 534      FF64C1
+ 535 1816 A2FF65C1 		.ascii	"\242\377e\301\243\377e\301\243\377e\301\243\377f\302\243\377"
+ 535      A3FF65C1 
+ 535      A3FF65C1 
+ 535      A3FF66C2 
+ 535      A3FF
+ 536 1828 66C2A4FF 		.ascii	"f\302\244\377f\302\244\377f\302\244\377g\302\244\377g\302\245"
+ 536      66C2A4FF 
+ 536      66C2A4FF 
+ 536      67C2A4FF 
+ 536      67C2A5
+ 537 183b FF67C2A5 		.ascii	"\377g\302\245\377h\302\245\377h\303\245\377h\303\246\377i\303"
+ 537      FF68C2A5 
+ 537      FF68C3A5 
+ 537      FF68C3A6 
+ 537      FF69C3
+ 538 184e A6FF69C3 		.ascii	"\246\377i\303\246\377i\303\246\377j\303\247\377j\303\247\377"
+ 538      A6FF69C3 
+ 538      A6FF6AC3 
+ 538      A7FF6AC3 
+ 538      A7FF
+ 539 1860 6AC4A7FF 		.ascii	"j\304\247\377k\304\247\377k\304\250\377k\304\250\377k\304\250"
+ 539      6BC4A7FF 
+ 539      6BC4A8FF 
+ 539      6BC4A8FF 
+ 539      6BC4A8
+ 540 1873 FF6CC4A8 		.ascii	"\377l\304\250\377l\304\251\377l\305\251\377m\305\251\377m\305"
+ 540      FF6CC4A9 
+ 540      FF6CC5A9 
+ 540      FF6DC5A9 
+GAS LISTING /tmp/ccZQdzcl.s 			page 30
+
+
+ 540      FF6DC5
+ 541 1886 A9FF6DC5 		.ascii	"\251\377m\305\252\377n\305\252\377n\305\252\377n\305\252\377"
+ 541      AAFF6EC5 
+ 541      AAFF6EC5 
+ 541      AAFF6EC5 
+ 541      AAFF
+ 542 1898 6FC6ABFF 		.ascii	"o\306\253\377o\306\253\377o\306\253\377p\306\253\377p\306\254"
+ 542      6FC6ABFF 
+ 542      6FC6ABFF 
+ 542      70C6ABFF 
+ 542      70C6AC
+ 543 18ab FF70C6AC 		.ascii	"\377p\306\254\377q\306\254\377q\307\254\377q\307\254\377q\307"
+ 543      FF71C6AC 
+ 543      FF71C7AC 
+ 543      FF71C7AC 
+ 543      FF71C7
+ 544 18be ADFF72C7 		.ascii	"\255\377r\307\255\377r\307\255\377r\307\255\377s\307\256\377"
+ 544      ADFF72C7 
+ 544      ADFF72C7 
+ 544      ADFF73C7 
+ 544      AEFF
+ 545 18d0 73C8AEFF 		.ascii	"s\310\256\377s\310\256\377t\310\256\377t\310\257\377t\310\257"
+ 545      73C8AEFF 
+ 545      74C8AEFF 
+ 545      74C8AFFF 
+ 545      74C8AF
+ 546 18e3 FF75C8AF 		.ascii	"\377u\310\257\377u\310\257\377u\310\260\377v\311\260\377v\311"
+ 546      FF75C8AF 
+ 546      FF75C8B0 
+ 546      FF76C9B0 
+ 546      FF76C9
+ 547 18f6 B0FF76C9 		.ascii	"\260\377v\311\260\377w\311\260\377w\311\261\377w\311\261\377"
+ 547      B0FF77C9 
+ 547      B0FF77C9 
+ 547      B1FF77C9 
+ 547      B1FF
+ 548 1908 77C9B1FF 		.ascii	"w\311\261\377x\312\261\377x\312\262\377x\312\262\377y\312\262"
+ 548      78CAB1FF 
+ 548      78CAB2FF 
+ 548      78CAB2FF 
+ 548      79CAB2
+ 549 191b FF79CAB2 		.ascii	"\377y\312\262\377y\312\263\377\204\317\272\377\204\317\272\377"
+ 549      FF79CAB3 
+ 549      FF84CFBA 
+ 549      FF84CFBA 
+ 549      FF
+ 550 192c 85CFBBFF 		.ascii	"\205\317\273\377\205\317\273\377\205\317\273\377\206\317\273"
+ 550      85CFBBFF 
+ 550      85CFBBFF 
+ 550      86CFBB
+ 551 193b FF86D0BC 		.ascii	"\377\206\320\274\377\206\320\274\377\206\320\274\377\207\320"
+ 551      FF86D0BC 
+ 551      FF86D0BC 
+ 551      FF87D0
+ 552 194a BCFF87D0 		.ascii	"\274\377\207\320\275\377\207\320\275\377\210\320\275\377\210"
+ 552      BDFF87D0 
+ 552      BDFF88D0 
+GAS LISTING /tmp/ccZQdzcl.s 			page 31
+
+
+ 552      BDFF88
+ 553 1959 D1BDFF88 		.ascii	"\321\275\377\210\321\275\377\211\321\276\377\211\321\276\377"
+ 553      D1BDFF89 
+ 553      D1BEFF89 
+ 553      D1BEFF
+ 554 1968 89D1BEFF 		.ascii	"\211\321\276\377\212\321\276\377\212\321\277\377\212\322\277"
+ 554      8AD1BEFF 
+ 554      8AD1BFFF 
+ 554      8AD2BF
+ 555 1977 FF8BD2BF 		.ascii	"\377\213\322\277\377\213\322\277\377\213\322\277\377\214\322"
+ 555      FF8BD2BF 
+ 555      FF8BD2BF 
+ 555      FF8CD2
+ 556 1986 C0FF8CD2 		.ascii	"\300\377\214\322\300\377\214\322\300\377\215\322\300\377\215"
+ 556      C0FF8CD2 
+ 556      C0FF8DD2 
+ 556      C0FF8D
+ 557 1995 D3C1FF8D 		.ascii	"\323\301\377\215\323\301\377\216\323\301\377\216\323\301\377"
+ 557      D3C1FF8E 
+ 557      D3C1FF8E 
+ 557      D3C1FF
+ 558 19a4 8ED3C1FF 		.ascii	"\216\323\301\377\216\323\302\377\217\323\302\377\217\324\302"
+ 558      8ED3C2FF 
+ 558      8FD3C2FF 
+ 558      8FD4C2
+ 559 19b3 FF8FD4C2 		.ascii	"\377\217\324\302\377\220\324\303\377\220\324\303\377\220\324"
+ 559      FF90D4C3 
+ 559      FF90D4C3 
+ 559      FF90D4
+ 560 19c2 C3FF91D4 		.ascii	"\303\377\221\324\303\377\221\324\303\377\221\325\304\377\222"
+ 560      C3FF91D4 
+ 560      C3FF91D5 
+ 560      C4FF92
+ 561 19d1 D5C4FF92 		.ascii	"\325\304\377\222\325\304\377\222\325\304\377\223\325\305\377"
+ 561      D5C4FF92 
+ 561      D5C4FF93 
+ 561      D5C5FF
+ 562 19e0 93D5C5FF 		.ascii	"\223\325\305\377\223\325\305\377\224\325\305\377\224\326\305"
+ 562      93D5C5FF 
+ 562      94D5C5FF 
+ 562      94D6C5
+ 563 19ef FF94D6C6 		.ascii	"\377\224\326\306\377\225\326\306\377\225\326\306\377\225\326"
+ 563      FF95D6C6 
+ 563      FF95D6C6 
+ 563      FF95D6
+ 564 19fe C6FF96D6 		.ascii	"\306\377\226\326\307\377\226\326\307\377\226\327\307\377\227"
+ 564      C7FF96D6 
+ 564      C7FF96D7 
+ 564      C7FF97
+ 565 1a0d D7C7FF97 		.ascii	"\327\307\377\227\327\307\377\227\327\310\377\230\327\310\377"
+ 565      D7C7FF97 
+ 565      D7C8FF98 
+ 565      D7C8FF
+ 566 1a1c 98D7C8FF 		.ascii	"\230\327\310\377\230\327\310\377\230\330\310\377\231\330\311"
+ 566      98D7C8FF 
+ 566      98D8C8FF 
+ 566      99D8C9
+GAS LISTING /tmp/ccZQdzcl.s 			page 32
+
+
+ 567 1a2b FF99D8C9 		.ascii	"\377\231\330\311\377\231\330\311\377\232\330\311\377\232\330"
+ 567      FF99D8C9 
+ 567      FF9AD8C9 
+ 567      FF9AD8
+ 568 1a3a C9FF9AD8 		.ascii	"\311\377\232\330\312\377\233\330\312\377\233\331\312\377\233"
+ 568      CAFF9BD8 
+ 568      CAFF9BD9 
+ 568      CAFF9B
+ 569 1a49 D9CAFF9C 		.ascii	"\331\312\377\234\331\312\377\234\331\313\377\234\331\313\377"
+ 569      D9CAFF9C 
+ 569      D9CBFF9C 
+ 569      D9CBFF
+ 570 1a58 9DD9CBFF 		.ascii	"\235\331\313\377\235\331\313\377\235\331\313\377\236\332\314"
+ 570      9DD9CBFF 
+ 570      9DD9CBFF 
+ 570      9EDACC
+ 571 1a67 FF9EDACC 		.ascii	"\377\236\332\314\377\236\332\314\377\237\332\314\377\237\332"
+ 571      FF9EDACC 
+ 571      FF9FDACC 
+ 571      FF9FDA
+ 572 1a76 CCFF9FDA 		.ascii	"\314\377\237\332\314\377\240\332\315\377\240\332\315\377\240"
+ 572      CCFFA0DA 
+ 572      CDFFA0DA 
+ 572      CDFFA0
+ 573 1a85 DBCDFFA0 		.ascii	"\333\315\377\240\333\315\377\241\333\315\377\241\333\316\377"
+ 573      DBCDFFA1 
+ 573      DBCDFFA1 
+ 573      DBCEFF
+ 574 1a94 A1DBCEFF 		.ascii	"\241\333\316\377\242\333\316\377\242\333\316\377\242\333\316"
+ 574      A2DBCEFF 
+ 574      A2DBCEFF 
+ 574      A2DBCE
+ 575 1aa3 FFA3DCCF 		.ascii	"\377\243\334\317\377\243\334\317\377\243\334\317\377\244\334"
+ 575      FFA3DCCF 
+ 575      FFA3DCCF 
+ 575      FFA4DC
+ 576 1ab2 CFFFA4DC 		.ascii	"\317\377\244\334\317\377\244\334\317\377\245\334\320\377\245"
+ 576      CFFFA4DC 
+ 576      CFFFA5DC 
+ 576      D0FFA5
+ 577 1ac1 DCD0FFA5 		.ascii	"\334\320\377\245\335\320\377\246\335\320\377\246\335\320\377"
+ 577      DDD0FFA6 
+ 577      DDD0FFA6 
+ 577      DDD0FF
+ 578 1ad0 A6DDD1FF 		.ascii	"\246\335\321\377\247\335\321\377\247\335\321\377\247\335\321"
+ 578      A7DDD1FF 
+ 578      A7DDD1FF 
+ 578      A7DDD1
+ 579 1adf FFA7DDD1 		.ascii	"\377\247\335\321\377\250\336\322\377\250\336\322\377\250\336"
+ 579      FFA8DED2 
+ 579      FFA8DED2 
+ 579      FFA8DE
+ 580 1aee D2FFA9DE 		.ascii	"\322\377\251\336\322\377\251\336\322\377\251\336\322\377\252"
+ 580      D2FFA9DE 
+ 580      D2FFA9DE 
+ 580      D2FFAA
+ 581 1afd DED3FFAA 		.ascii	"\336\323\377\252\336\323\377\252\337\323\377\253\337\323\377"
+GAS LISTING /tmp/ccZQdzcl.s 			page 33
+
+
+ 581      DED3FFAA 
+ 581      DFD3FFAB 
+ 581      DFD3FF
+ 582 1b0c ABDFD3FF 		.ascii	"\253\337\323\377\253\337\324\377\254\337\324\377\254\337\324"
+ 582      ABDFD4FF 
+ 582      ACDFD4FF 
+ 582      ACDFD4
+ 583 1b1b FFACDFD4 		.ascii	"\377\254\337\324\377\255\337\324\377\267\344\332\377\267\344"
+ 583      FFADDFD4 
+ 583      FFB7E4DA 
+ 583      FFB7E4
+ 584 1b2a DAFFB8E4 		.ascii	"\332\377\270\344\333\377\270\344\333\377\270\344\333\377\271"
+ 584      DBFFB8E4 
+ 584      DBFFB8E4 
+ 584      DBFFB9
+ 585 1b39 E4DBFFB9 		.ascii	"\344\333\377\271\344\333\377\271\344\334\377\272\345\334\377"
+ 585      E4DBFFB9 
+ 585      E4DCFFBA 
+ 585      E5DCFF
+ 586 1b48 BAE5DCFF 		.ascii	"\272\345\334\377\272\345\334\377\273\345\334\377\273\345\334"
+ 586      BAE5DCFF 
+ 586      BBE5DCFF 
+ 586      BBE5DC
+ 587 1b57 FFBBE5DD 		.ascii	"\377\273\345\335\377\274\345\335\377\274\345\335\377\274\346"
+ 587      FFBCE5DD 
+ 587      FFBCE5DD 
+ 587      FFBCE6
+ 588 1b66 DDFFBCE6 		.ascii	"\335\377\274\346\335\377\275\346\335\377\275\346\336\377\275"
+ 588      DDFFBDE6 
+ 588      DDFFBDE6 
+ 588      DEFFBD
+ 589 1b75 E6DEFFBE 		.ascii	"\346\336\377\276\346\336\377\276\346\336\377\276\346\336\377"
+ 589      E6DEFFBE 
+ 589      E6DEFFBE 
+ 589      E6DEFF
+ 590 1b84 BFE7DFFF 		.ascii	"\277\347\337\377\277\347\337\377\277\347\337\377\300\347\337"
+ 590      BFE7DFFF 
+ 590      BFE7DFFF 
+ 590      C0E7DF
+ 591 1b93 FFC0E7DF 		.ascii	"\377\300\347\337\377\300\347\337\377\301\347\340\377\301\347"
+ 591      FFC0E7DF 
+ 591      FFC1E7E0 
+ 591      FFC1E7
+ 592 1ba2 E0FFC1E8 		.ascii	"\340\377\301\350\340\377\302\350\340\377\302\350\340\377\302"
+ 592      E0FFC2E8 
+ 592      E0FFC2E8 
+ 592      E0FFC2
+ 593 1bb1 E8E0FFC3 		.ascii	"\350\340\377\303\350\341\377\303\350\341\377\303\350\341\377"
+ 593      E8E1FFC3 
+ 593      E8E1FFC3 
+ 593      E8E1FF
+ 594 1bc0 C4E8E1FF 		.ascii	"\304\350\341\377\304\351\341\377\304\351\342\377\304\351\342"
+ 594      C4E9E1FF 
+ 594      C4E9E2FF 
+ 594      C4E9E2
+ 595 1bcf FFC5E9E2 		.ascii	"\377\305\351\342\377\305\351\342\377\305\351\342\377\306\351"
+ 595      FFC5E9E2 
+GAS LISTING /tmp/ccZQdzcl.s 			page 34
+
+
+ 595      FFC5E9E2 
+ 595      FFC6E9
+ 596 1bde E2FFC6E9 		.ascii	"\342\377\306\351\343\377\306\352\343\377\307\352\343\377\307"
+ 596      E3FFC6EA 
+ 596      E3FFC7EA 
+ 596      E3FFC7
+ 597 1bed EAE3FFC7 		.ascii	"\352\343\377\307\352\343\377\310\352\343\377\310\352\344\377"
+ 597      EAE3FFC8 
+ 597      EAE3FFC8 
+ 597      EAE4FF
+ 598 1bfc C8EAE4FF 		.ascii	"\310\352\344\377\311\352\344\377\311\353\344\377\311\353\344"
+ 598      C9EAE4FF 
+ 598      C9EBE4FF 
+ 598      C9EBE4
+ 599 1c0b FFCAEBE4 		.ascii	"\377\312\353\344\377\312\353\345\377\312\353\345\377\313\353"
+ 599      FFCAEBE5 
+ 599      FFCAEBE5 
+ 599      FFCBEB
+ 600 1c1a E5FFCBEB 		.ascii	"\345\377\313\353\345\377\313\353\345\377\313\354\345\377\314"
+ 600      E5FFCBEB 
+ 600      E5FFCBEC 
+ 600      E5FFCC
+ 601 1c29 ECE6FFCC 		.ascii	"\354\346\377\314\354\346\377\314\354\346\377\314\354\346\377"
+ 601      ECE6FFCC 
+ 601      ECE6FFCC 
+ 601      ECE6FF
+ 602 1c38 CCECE6FF 		.ascii	"\314\354\346\377\314\354\346\377\314\354\347\377\314\354\347"
+ 602      CCECE6FF 
+ 602      CCECE7FF 
+ 602      CCECE7
+ 603 1c47 FFCDECE7 		.ascii	"\377\315\354\347\377\315\354\347\377\315\354\347\377\315\354"
+ 603      FFCDECE7 
+ 603      FFCDECE7 
+ 603      FFCDEC
+ 604 1c56 E7FFCDEC 		.ascii	"\347\377\315\354\350\377\315\354\350\377\315\354\350\377\315"
+ 604      E8FFCDEC 
+ 604      E8FFCDEC 
+ 604      E8FFCD
+ 605 1c65 ECE8FFCE 		.ascii	"\354\350\377\316\355\350\377\316\355\350\377\316\355\351\377"
+ 605      EDE8FFCE 
+ 605      EDE8FFCE 
+ 605      EDE9FF
+ 606 1c74 CEEDE9FF 		.ascii	"\316\355\351\377\316\355\351\377\316\355\351\377\316\355\351"
+ 606      CEEDE9FF 
+ 606      CEEDE9FF 
+ 606      CEEDE9
+ 607 1c83 FFCFEDE9 		.ascii	"\377\317\355\351\377\317\355\351\377\317\355\352\377\317\355"
+ 607      FFCFEDE9 
+ 607      FFCFEDEA 
+ 607      FFCFED
+ 608 1c92 EAFFCFED 		.ascii	"\352\377\317\355\352\377\317\355\352\377\317\355\352\377\320"
+ 608      EAFFCFED 
+ 608      EAFFCFED 
+ 608      EAFFD0
+ 609 1ca1 EDEAFFD0 		.ascii	"\355\352\377\320\355\352\377\320\355\353\377\320\356\353\377"
+ 609      EDEAFFD0 
+ 609      EDEBFFD0 
+GAS LISTING /tmp/ccZQdzcl.s 			page 35
+
+
+ 609      EEEBFF
+ 610 1cb0 D0EEEBFF 		.ascii	"\320\356\353\377\320\356\353\377\320\356\353\377\321\356\353"
+ 610      D0EEEBFF 
+ 610      D0EEEBFF 
+ 610      D1EEEB
+ 611 1cbf FFD1EEEB 		.ascii	"\377\321\356\353\377\321\356\354\377\321\356\354\377\321\356"
+ 611      FFD1EEEC 
+ 611      FFD1EEEC 
+ 611      FFD1EE
+ 612 1cce ECFFD1EE 		.ascii	"\354\377\321\356\354\377\321\356\354\377\322\356\354\377\322"
+ 612      ECFFD1EE 
+ 612      ECFFD2EE 
+ 612      ECFFD2
+ 613 1cdd EEECFFD2 		.ascii	"\356\354\377\322\356\354\377\322\356\355\377\322\356\355\377"
+ 613      EEECFFD2 
+ 613      EEEDFFD2 
+ 613      EEEDFF
+ 614 1cec D2EEEDFF 		.ascii	"\322\356\355\377\322\356\355\377\323\357\355\377\323\357\355"
+ 614      D2EEEDFF 
+ 614      D3EFEDFF 
+ 614      D3EFED
+ 615 1cfb FFD3EFED 		.ascii	"\377\323\357\355\377\323\357\356\377\323\357\356\377\323\357"
+ 615      FFD3EFEE 
+ 615      FFD3EFEE 
+ 615      FFD3EF
+ 616 1d0a EEFFD4EF 		.ascii	"\356\377\324\357\356\377\324\357\356\377\324\357\356\377\324"
+ 616      EEFFD4EF 
+ 616      EEFFD4EF 
+ 616      EEFFD4
+ 617 1d19 EFEEFFD4 		.ascii	"\357\356\377\324\357\356\377\324\357\356\377\332\361\362\377"
+ 617      EFEEFFD4 
+ 617      EFEEFFDA 
+ 617      F1F2FF
+ 618 1d28 DAF1F3FF 		.ascii	"\332\361\363\377\332\361\363\377\332\361\363\377\332\361\363"
+ 618      DAF1F3FF 
+ 618      DAF1F3FF 
+ 618      DAF1F3
+ 619 1d37 FFDAF1F3 		.ascii	"\377\332\361\363\377\333\361\363\377\333\361\363\377\333\361"
+ 619      FFDBF1F3 
+ 619      FFDBF1F3 
+ 619      FFDBF1
+ 620 1d46 F3FFDBF2 		.ascii	"\363\377\333\362\363\377\333\362\364\377\333\362\364\377\334"
+ 620      F3FFDBF2 
+ 620      F4FFDBF2 
+ 620      F4FFDC
+ 621 1d55 F2F4FFDC 		.ascii	"\362\364\377\334\362\364\377\334\362\364\377\334\362\364\377"
+ 621      F2F4FFDC 
+ 621      F2F4FFDC 
+ 621      F2F4FF
+ 622 1d64 DCF2F4FF 		.ascii	"\334\362\364\377\334\362\364\377\335\362\364\377\335\362\365"
+ 622      DCF2F4FF 
+ 622      DDF2F4FF 
+ 622      DDF2F5
+ 623 1d73 FFDDF2F5 		.ascii	"\377\335\362\365\377\335\362\365\377\335\362\365\377\335\362"
+ 623      FFDDF2F5 
+ 623      FFDDF2F5 
+ 623      FFDDF2
+GAS LISTING /tmp/ccZQdzcl.s 			page 36
+
+
+ 624 1d82 F5FFDEF2 		.ascii	"\365\377\336\362\365\377\336\362\365\377\336\362\365\377\336"
+ 624      F5FFDEF2 
+ 624      F5FFDEF2 
+ 624      F5FFDE
+ 625 1d91 F2F5FFDE 		.ascii	"\362\365\377\336\363\365\377\336\363\366\377\337\363\366\377"
+ 625      F3F5FFDE 
+ 625      F3F6FFDF 
+ 625      F3F6FF
+ 626 1da0 DFF3F6FF 		.ascii	"\337\363\366\377\337\363\366\377\337\363\366\377\337\363\366"
+ 626      DFF3F6FF 
+ 626      DFF3F6FF 
+ 626      DFF3F6
+ 627 1daf FFDFF3F6 		.ascii	"\377\337\363\366\377\340\363\366\377\340\363\366\377\340\363"
+ 627      FFE0F3F6 
+ 627      FFE0F3F6 
+ 627      FFE0F3
+ 628 1dbe F6FFE0F3 		.ascii	"\366\377\340\363\366\377\340\363\367\377\340\363\367\377\341"
+ 628      F6FFE0F3 
+ 628      F7FFE0F3 
+ 628      F7FFE1
+ 629 1dcd F3F7FFE1 		.ascii	"\363\367\377\341\363\367\377\341\363\367\377\341\363\367\377"
+ 629      F3F7FFE1 
+ 629      F3F7FFE1 
+ 629      F3F7FF
+ 630 1ddc E1F4F7FF 		.ascii	"\341\364\367\377\342\364\367\377\342\364\367\377\342\364\367"
+ 630      E2F4F7FF 
+ 630      E2F4F7FF 
+ 630      E2F4F7
+ 631 1deb FFE2F4F7 		.ascii	"\377\342\364\367\377\342\364\367\377\342\364\370\377\343\364"
+ 631      FFE2F4F7 
+ 631      FFE2F4F8 
+ 631      FFE3F4
+ 632 1dfa F8FFE3F4 		.ascii	"\370\377\343\364\370\377\343\364\370\377\343\364\370\377\343"
+ 632      F8FFE3F4 
+ 632      F8FFE3F4 
+ 632      F8FFE3
+ 633 1e09 F4F8FFE3 		.ascii	"\364\370\377\343\364\370\377\344\364\370\377\344\364\370\377"
+ 633      F4F8FFE4 
+ 633      F4F8FFE4 
+ 633      F4F8FF
+ 634 1e18 E4F4F8FF 		.ascii	"\344\364\370\377\344\364\370\377\344\364\370\377\344\365\370"
+ 634      E4F4F8FF 
+ 634      E4F4F8FF 
+ 634      E4F5F8
+ 635 1e27 FFE5F5F9 		.ascii	"\377\345\365\371\377\345\365\371\377\345\365\371\377\345\365"
+ 635      FFE5F5F9 
+ 635      FFE5F5F9 
+ 635      FFE5F5
+ 636 1e36 F9FFE5F5 		.ascii	"\371\377\345\365\371\377\345\365\371\377\345\365\371\377\345"
+ 636      F9FFE5F5 
+ 636      F9FFE5F5 
+ 636      F9FFE5
+ 637 1e45 F5F9FFE6 		.ascii	"\365\371\377\346\365\371\377\346\365\371\377\346\365\371\377"
+ 637      F5F9FFE6 
+ 637      F5F9FFE6 
+ 637      F5F9FF
+ 638 1e54 E6F5F9FF 		.ascii	"\346\365\371\377\346\365\371\377\346\365\371\377\346\365\371"
+GAS LISTING /tmp/ccZQdzcl.s 			page 37
+
+
+ 638      E6F5F9FF 
+ 638      E6F5F9FF 
+ 638      E6F5F9
+ 639 1e63 FFE6F5F9 		.ascii	"\377\346\365\371\377\346\365\371\377\347\365\371\377\347\365"
+ 639      FFE6F5F9 
+ 639      FFE7F5F9 
+ 639      FFE7F5
+ 640 1e72 F9FFE7F5 		.ascii	"\371\377\347\365\371\377\347\365\371\377\347\365\371\377\347"
+ 640      F9FFE7F5 
+ 640      F9FFE7F5 
+ 640      F9FFE7
+ 641 1e81 F6F9FFE7 		.ascii	"\366\371\377\347\366\371\377\347\366\371\377\347\366\371\377"
+ 641      F6F9FFE7 
+ 641      F6F9FFE7 
+ 641      F6F9FF
+ 642 1e90 E8F6F9FF 		.ascii	"\350\366\371\377\350\366\371\377\350\366\371\377\350\366\371"
+ 642      E8F6F9FF 
+ 642      E8F6F9FF 
+ 642      E8F6F9
+ 643 1e9f FFE8F6F9 		.ascii	"\377\350\366\371\377\350\366\371\377\350\366\371\377\350\366"
+ 643      FFE8F6F9 
+ 643      FFE8F6F9 
+ 643      FFE8F6
+ 644 1eae F9FFE8F6 		.ascii	"\371\377\350\366\371\377\351\366\371\377\351\366\371\377\351"
+ 644      F9FFE9F6 
+ 644      F9FFE9F6 
+ 644      F9FFE9
+ 645 1ebd F6F9FFE9 		.ascii	"\366\371\377\351\366\371\377\351\366\371\377\351\366\371\377"
+ 645      F6F9FFE9 
+ 645      F6F9FFE9 
+ 645      F6F9FF
+ 646 1ecc E9F6F9FF 		.ascii	"\351\366\371\377\351\366\372\377\351\366\372\377\352\366\372"
+ 646      E9F6FAFF 
+ 646      E9F6FAFF 
+ 646      EAF6FA
+ 647 1edb FFEAF7FA 		.ascii	"\377\352\367\372\377\352\367\372\377\352\367\372\377\352\367"
+ 647      FFEAF7FA 
+ 647      FFEAF7FA 
+ 647      FFEAF7
+ 648 1eea FAFFEAF7 		.ascii	"\372\377\352\367\372\377\352\367\372\377\352\367\372\377\352"
+ 648      FAFFEAF7 
+ 648      FAFFEAF7 
+ 648      FAFFEA
+ 649 1ef9 F7FAFFEB 		.ascii	"\367\372\377\353\367\372\377\353\367\372\377\353\367\372\377"
+ 649      F7FAFFEB 
+ 649      F7FAFFEB 
+ 649      F7FAFF
+ 650 1f08 EBF7FAFF 		.ascii	"\353\367\372\377\353\367\372\377\353\367\372\377\353\367\372"
+ 650      EBF7FAFF 
+ 650      EBF7FAFF 
+ 650      EBF7FA
+ 651 1f17 FFEBF7FA 		.ascii	"\377\353\367\372\377\353\367\372\377\354\367\372\377\357\371"
+ 651      FFEBF7FA 
+ 651      FFECF7FA 
+ 651      FFEFF9
+ 652 1f26 FBFFEFF9 		.ascii	"\373\377\357\371\373\377\360\371\373\377\360\371\373\377\360"
+ 652      FBFFF0F9 
+GAS LISTING /tmp/ccZQdzcl.s 			page 38
+
+
+ 652      FBFFF0F9 
+ 652      FBFFF0
+ 653 1f35 F9FBFFF0 		.ascii	"\371\373\377\360\371\373\377\360\371\373\377\360\371\373\377"
+ 653      F9FBFFF0 
+ 653      F9FBFFF0 
+ 653      F9FBFF
+ 654 1f44 F0F9FBFF 		.ascii	"\360\371\373\377\360\371\373\377\360\371\373\377\361\371\373"
+ 654      F0F9FBFF 
+ 654      F0F9FBFF 
+ 654      F1F9FB
+ 655 1f53 FFF1F9FB 		.ascii	"\377\361\371\373\377\361\371\373\377\361\371\373\377\361\371"
+ 655      FFF1F9FB 
+ 655      FFF1F9FB 
+ 655      FFF1F9
+ 656 1f62 FBFFF1F9 		.ascii	"\373\377\361\371\373\377\361\371\373\377\361\372\373\377\361"
+ 656      FBFFF1F9 
+ 656      FBFFF1FA 
+ 656      FBFFF1
+ 657 1f71 FAFBFFF2 		.ascii	"\372\373\377\362\372\373\377\362\372\373\377\362\372\373\377"
+ 657      FAFBFFF2 
+ 657      FAFBFFF2 
+ 657      FAFBFF
+ 658 1f80 F2FAFBFF 		.ascii	"\362\372\373\377\362\372\373\377\362\372\373\377\362\372\373"
+ 658      F2FAFBFF 
+ 658      F2FAFBFF 
+ 658      F2FAFB
+ 659 1f8f FFF2FAFC 		.ascii	"\377\362\372\374\377\362\372\374\377\363\372\374\377\363\372"
+ 659      FFF2FAFC 
+ 659      FFF3FAFC 
+ 659      FFF3FA
+ 660 1f9e FCFFF3FA 		.ascii	"\374\377\363\372\374\377\363\372\374\377\363\372\374\377\363"
+ 660      FCFFF3FA 
+ 660      FCFFF3FA 
+ 660      FCFFF3
+ 661 1fad FAFCFFF3 		.ascii	"\372\374\377\363\372\374\377\363\372\374\377\363\372\374\377"
+ 661      FAFCFFF3 
+ 661      FAFCFFF3 
+ 661      FAFCFF
+ 662 1fbc F4FAFCFF 		.ascii	"\364\372\374\377"
+ 663 1fc0 F4FAFCFF 		.ascii	"\364\372\374\377\364\372\374\377\364\373\374\377\364\373\374"
+ 663      F4FAFCFF 
+ 663      F4FBFCFF 
+ 663      F4FBFC
+ 664 1fcf FFF4FBFC 		.ascii	"\377\364\373\374\377\364\373\374\377\364\373\374\377\364\373"
+ 664      FFF4FBFC 
+ 664      FFF4FBFC 
+ 664      FFF4FB
+ 665 1fde FCFFF5FB 		.ascii	"\374\377\365\373\374\377\365\373\374\377\365\373\374\377\365"
+ 665      FCFFF5FB 
+ 665      FCFFF5FB 
+ 665      FCFFF5
+ 666 1fed FBFCFFF5 		.ascii	"\373\374\377\365\373\374\377\365\373\374\377\365\373\374\377"
+ 666      FBFCFFF5 
+ 666      FBFCFFF5 
+ 666      FBFCFF
+ 667 1ffc F5FBFCFF 		.ascii	"\365\373\374\377\365\373\374\377\366\373\374\377\366\373\374"
+ 667      F5FBFCFF 
+GAS LISTING /tmp/ccZQdzcl.s 			page 39
+
+
+ 667      F6FBFCFF 
+ 667      F6FBFC
+ 668 200b FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 668      FFF6FBFC 
+ 668      FFF6FBFC 
+ 668      FFF6FB
+ 669 201a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377"
+ 669      FCFFF6FB 
+ 669      FCFF
+ 670              		.globl	heatmap_cs_BuGn_soft
+ 671              		.section	.data.rel.local
+ 672              		.align 8
+ 673              		.type	heatmap_cs_BuGn_soft, @object
+ 674              		.size	heatmap_cs_BuGn_soft, 8
+ 675              	heatmap_cs_BuGn_soft:
+ 676 0010 00000000 		.quad	soft
+ 676      00000000 
+ 677              		.section	.data.rel.ro.local
+ 678              		.align 16
+ 679              		.type	soft, @object
+ 680              		.size	soft, 16
+ 681              	soft:
+ 682 0020 00000000 		.quad	soft_data
+ 682      00000000 
+ 683 0028 01040000 		.quad	1025
+ 683      00000000 
+ 684              		.section	.rodata
+ 685 2024 00000000 		.align 32
+ 685      00000000 
+ 685      00000000 
+ 685      00000000 
+ 685      00000000 
+ 686              		.type	soft_data, @object
+ 687              		.size	soft_data, 4100
+ 688              	soft_data:
+ 689 2040 00       		.string	""
+ 690 2041 00       		.string	""
+ 691 2042 00       		.string	""
+ 692 2043 00       		.string	""
+ 693 2044 00       		.string	""
+ 694 2045 441A00   		.string	"D\032"
+ 695 2048 00       		.string	""
+ 696 2049 441B0700 		.string	"D\033\007"
+ 697 204d 441B0E00 		.string	"D\033\016"
+ 698 2051 441B1600 		.string	"D\033\026"
+ 699 2055 451B1D00 		.string	"E\033\035"
+ 700 2059 451B2500 		.string	"E\033%"
+ 701 205d 451B2C00 		.string	"E\033,"
+ 702 2061 461B3400 		.string	"F\0334"
+ 703 2065 461C3B00 		.string	"F\034;"
+ 704 2069 461C4300 		.string	"F\034C"
+ 705 206d 471C4A00 		.string	"G\034J"
+ 706 2071 471C5200 		.string	"G\034R"
+ 707 2075 471C5900 		.string	"G\034Y"
+ 708 2079 481C6100 		.string	"H\034a"
+ 709 207d 481C6800 		.string	"H\034h"
+ 710 2081 481C7000 		.string	"H\034p"
+GAS LISTING /tmp/ccZQdzcl.s 			page 40
+
+
+ 711 2085 481D7700 		.string	"H\035w"
+ 712 2089 491D7F00 		.string	"I\035\177"
+ 713 208d 491D8600 		.string	"I\035\206"
+ 714 2091 491D8D00 		.string	"I\035\215"
+ 715 2095 4A1D9500 		.string	"J\035\225"
+ 716 2099 4A1D9C00 		.string	"J\035\234"
+ 717 209d 4A1DA400 		.string	"J\035\244"
+ 718 20a1 4B1EAB00 		.string	"K\036\253"
+ 719 20a5 4B1EB300 		.string	"K\036\263"
+ 720 20a9 4B1EBA00 		.string	"K\036\272"
+ 721 20ad 4C1EC200 		.string	"L\036\302"
+ 722 20b1 4C1EC900 		.string	"L\036\311"
+ 723 20b5 4C1ED100 		.string	"L\036\321"
+ 724 20b9 4D1ED800 		.string	"M\036\330"
+ 725 20bd 4D1EE000 		.string	"M\036\340"
+ 726 20c1 4D1FE700 		.string	"M\037\347"
+ 727 20c5 4D1FEF00 		.string	"M\037\357"
+ 728 20c9 4E1FF600 		.string	"N\037\366"
+ 729 20cd 4E1FFE00 		.string	"N\037\376"
+ 730 20d1 4E1FFF00 		.string	"N\037\377"
+ 731 20d5 4F1FFF00 		.string	"O\037\377"
+ 732 20d9 4F1FFF00 		.string	"O\037\377"
+ 733 20dd 4F20FF00 		.string	"O \377"
+ 734 20e1 5020FF00 		.string	"P \377"
+ 735 20e5 5020FF00 		.string	"P \377"
+ 736 20e9 5020FF00 		.string	"P \377"
+ 737 20ed 5120FF00 		.string	"Q \377"
+ 738 20f1 5120FF00 		.string	"Q \377"
+ 739 20f5 5120FF00 		.string	"Q \377"
+ 740 20f9 5220FF00 		.string	"R \377"
+ 741 20fd 5221FF00 		.string	"R!\377"
+ 742 2101 5221FF00 		.string	"R!\377"
+ 743 2105 5221FF00 		.string	"R!\377"
+ 744 2109 5321FF00 		.string	"S!\377"
+ 745 210d 5321FF00 		.string	"S!\377"
+ 746 2111 5321FF00 		.string	"S!\377"
+ 747 2115 5421FF00 		.string	"T!\377"
+ 748 2119 5422FF00 		.string	"T\"\377"
+ 749 211d 5422FF00 		.string	"T\"\377"
+ 750 2121 5522FF00 		.string	"U\"\377"
+ 751 2125 5522FF00 		.string	"U\"\377"
+ 752 2129 5522FF00 		.string	"U\"\377"
+ 753 212d 5622FF00 		.string	"V\"\377"
+ 754 2131 5622FF00 		.string	"V\"\377"
+ 755 2135 5622FF00 		.string	"V\"\377"
+ 756 2139 5723FF00 		.string	"W#\377"
+ 757 213d 5723FF00 		.string	"W#\377"
+ 758 2141 5723FF00 		.string	"W#\377"
+ 759 2145 5823FF00 		.string	"X#\377"
+ 760 2149 5823FF00 		.string	"X#\377"
+ 761 214d 5823FF00 		.string	"X#\377"
+ 762 2151 5923FF00 		.string	"Y#\377"
+ 763 2155 5924FF00 		.string	"Y$\377"
+ 764 2159 5924FF00 		.string	"Y$\377"
+ 765 215d 5A24FF00 		.string	"Z$\377"
+ 766 2161 5A24FF00 		.string	"Z$\377"
+ 767 2165 5A24FF00 		.string	"Z$\377"
+GAS LISTING /tmp/ccZQdzcl.s 			page 41
+
+
+ 768 2169 5A24FF00 		.string	"Z$\377"
+ 769 216d 5B24FF00 		.string	"[$\377"
+ 770 2171 5B24FF00 		.string	"[$\377"
+ 771 2175 5B25FF00 		.string	"[%\377"
+ 772 2179 5C25FF00 		.string	"\\%\377"
+ 773 217d 5C25FF00 		.string	"\\%\377"
+ 774 2181 5C25FF00 		.string	"\\%\377"
+ 775 2185 5D25FF00 		.string	"]%\377"
+ 776 2189 5D25FF00 		.string	"]%\377"
+ 777 218d 5D25FF00 		.string	"]%\377"
+ 778 2191 5E26FF00 		.string	"^&\377"
+ 779 2195 5E26FF00 		.string	"^&\377"
+ 780 2199 5E26FF00 		.string	"^&\377"
+ 781 219d 5F26FF00 		.string	"_&\377"
+ 782 21a1 5F26FF00 		.string	"_&\377"
+ 783 21a5 5F26FF00 		.string	"_&\377"
+ 784 21a9 6026FF00 		.string	"`&\377"
+ 785 21ad 6026FF00 		.string	"`&\377"
+ 786 21b1 6027FF00 		.string	"`'\377"
+ 787 21b5 6127FF00 		.string	"a'\377"
+ 788 21b9 6127FF00 		.string	"a'\377"
+ 789 21bd 6127FF00 		.string	"a'\377"
+ 790 21c1 6227FF00 		.string	"b'\377"
+ 791 21c5 6227FF00 		.string	"b'\377"
+ 792 21c9 6227FF00 		.string	"b'\377"
+ 793 21cd 6328FF00 		.string	"c(\377"
+ 794 21d1 6328FF00 		.string	"c(\377"
+ 795 21d5 6328FF00 		.string	"c(\377"
+ 796 21d9 6428FF00 		.string	"d(\377"
+ 797 21dd 6428FF00 		.string	"d(\377"
+ 798 21e1 6428FF00 		.string	"d(\377"
+ 799 21e5 6528FF00 		.string	"e(\377"
+ 800 21e9 6528FF00 		.string	"e(\377"
+ 801 21ed 6529FF00 		.string	"e)\377"
+ 802 21f1 6629FF00 		.string	"f)\377"
+ 803 21f5 6629FF00 		.string	"f)\377"
+ 804 21f9 6629FF00 		.string	"f)\377"
+ 805 21fd 6729FF00 		.string	"g)\377"
+ 806 2201 6729FF00 		.string	"g)\377"
+ 807 2205 6729FF00 		.string	"g)\377"
+ 808 2209 682AFF00 		.string	"h*\377"
+ 809 220d 682AFF00 		.string	"h*\377"
+ 810 2211 682AFF00 		.string	"h*\377"
+ 811 2215 692AFF00 		.string	"i*\377"
+ 812 2219 692AFF00 		.string	"i*\377"
+ 813 221d 692AFF00 		.string	"i*\377"
+ 814 2221 6A2AFF00 		.string	"j*\377"
+ 815 2225 6A2AFF00 		.string	"j*\377"
+ 816 2229 6A2BFF00 		.string	"j+\377"
+ 817 222d 6B2BFF00 		.string	"k+\377"
+ 818 2231 6B2BFF00 		.string	"k+\377"
+ 819 2235 6B2BFF00 		.string	"k+\377"
+ 820 2239 6C2BFF00 		.string	"l+\377"
+ 821 223d 6C2BFF00 		.string	"l+\377"
+ 822 2241 6C2BFF00 		.string	"l+\377"
+ 823 2245 6D2BFF00 		.string	"m+\377"
+ 824 2249 6D2CFF00 		.string	"m,\377"
+GAS LISTING /tmp/ccZQdzcl.s 			page 42
+
+
+ 825 224d 6D2CFF00 		.string	"m,\377"
+ 826 2251 6D2CFF01 		.ascii	"m,\377\001m,\377\001n,\377\001n-\377\002n-\377\002n-\377\002"
+ 826      6D2CFF01 
+ 826      6E2CFF01 
+ 826      6E2DFF02 
+ 826      6E2DFF02 
+ 827 2269 6F2DFF03 		.ascii	"o-\377\003o-\377\003o.\377\003o.\377\004o.\377\004p.\377\004"
+ 827      6F2DFF03 
+ 827      6F2EFF03 
+ 827      6F2EFF04 
+ 827      6F2EFF04 
+ 828 2281 702EFF05 		.ascii	"p.\377\005p/\377\005p/\377\005q/\377\006q/\377\006q/\377\006"
+ 828      702FFF05 
+ 828      702FFF05 
+ 828      712FFF06 
+ 828      712FFF06 
+ 829 2299 7130FF07 		.ascii	"q0\377\007r0\377\007r0\377\007r0\377\br0\377\br0\377\bs1\377"
+ 829      7230FF07 
+ 829      7230FF07 
+ 829      7230FF08 
+ 829      7230FF08 
+ 830 22b4 097331FF 		.ascii	"\ts1\377\ts1\377\ts1\377\nt1\377\nt2\377\nt2\377\013t2\377\013"
+ 830      097331FF 
+ 830      097331FF 
+ 830      0A7431FF 
+ 830      0A7432FF 
+ 831 22d1 7532FF0B 		.ascii	"u2\377\013u2\377\fu3\377\fu3\377\fv3\377\rv3\377\rv3\377\rv4"
+ 831      7532FF0C 
+ 831      7533FF0C 
+ 831      7533FF0C 
+ 831      7633FF0D 
+ 832 22ef FF0E7634 		.ascii	"\377\016v4\377\016w4\377\016w4\377\017w4\377\017w5\377\017x5"
+ 832      FF0E7734 
+ 832      FF0E7734 
+ 832      FF0F7734 
+ 832      FF0F7735 
+ 833 2307 FF107835 		.ascii	"\377\020x5\377\020x5\377\020x5\377\020y6\377\021y6\377\021y6"
+ 833      FF107835 
+ 833      FF107835 
+ 833      FF107936 
+ 833      FF117936 
+ 834 231f FF117936 		.ascii	"\377\021y6\377\021y6\377\022z6\377\022z7\377\022z7\377\023z7"
+ 834      FF117936 
+ 834      FF127A36 
+ 834      FF127A37 
+ 834      FF127A37 
+ 835 2337 FF137B37 		.ascii	"\377\023{7\377\023{7\377\023{8\377\024{8\377\024|8\377\024|8"
+ 835      FF137B37 
+ 835      FF137B38 
+ 835      FF147B38 
+ 835      FF147C38 
+ 836 234f FF147C38 		.ascii	"\377\024|8\377\025|9\377\025}9\377\025}9\377\025}9\377\026}9"
+ 836      FF157C39 
+ 836      FF157D39 
+ 836      FF157D39 
+ 836      FF157D39 
+ 837 2367 FF167D3A 		.ascii	"\377\026}:\377\026~:\377\026~:\377\027~:\377\027~:\377\027\177"
+GAS LISTING /tmp/ccZQdzcl.s 			page 43
+
+
+ 837      FF167E3A 
+ 837      FF167E3A 
+ 837      FF177E3A 
+ 837      FF177E3A 
+ 838 237e 3BFF177F 		.ascii	";\377\027\177;\377\030\177;\377\030\177;\377\030\200;\377\030"
+ 838      3BFF187F 
+ 838      3BFF187F 
+ 838      3BFF1880 
+ 838      3BFF18
+ 839 2391 803CFF19 		.ascii	"\200<\377\031\200<\377\031\200<\377\031\201<\377\031\201<\377"
+ 839      803CFF19 
+ 839      803CFF19 
+ 839      813CFF19 
+ 839      813CFF
+ 840 23a4 1A813DFF 		.ascii	"\032\201=\377\032\201=\377\032\201=\377\032\202=\377\033\202"
+ 840      1A813DFF 
+ 840      1A813DFF 
+ 840      1A823DFF 
+ 840      1B82
+ 841 23b6 3DFF1B82 		.ascii	"=\377\033\202>\377\033\202>\377\033\203>\377\033\203>\377\034"
+ 841      3EFF1B82 
+ 841      3EFF1B83 
+ 841      3EFF1B83 
+ 841      3EFF1C
+ 842 23c9 833EFF1C 		.ascii	"\203>\377\034\203?\377\034\204?\377\034\204?\377\035\204?\377"
+ 842      833FFF1C 
+ 842      843FFF1C 
+ 842      843FFF1D 
+ 842      843FFF
+ 843 23dc 1D843FFF 		.ascii	"\035\204?\377\035\205@\377\035\205@\377\035\205@\377\036\205"
+ 843      1D8540FF 
+ 843      1D8540FF 
+ 843      1D8540FF 
+ 843      1E85
+ 844 23ee 40FF1E85 		.ascii	"@\377\036\205@\377\036\206A\377\036\206A\377\037\206A\377\037"
+ 844      40FF1E86 
+ 844      41FF1E86 
+ 844      41FF1F86 
+ 844      41FF1F
+ 845 2401 8641FF1F 		.ascii	"\206A\377\037\207A\377\037\207B\377\037\207B\377 \207B\377 \210"
+ 845      8741FF1F 
+ 845      8742FF1F 
+ 845      8742FF20 
+ 845      8742FF20 
+ 846 2416 42FF2088 		.ascii	"B\377 \210B\377 \210C\377!\210C\377!\211C\377!\211C\377!\211"
+ 846      42FF2088 
+ 846      43FF2188 
+ 846      43FF2189 
+ 846      43FF2189 
+ 847 242e 43FF2189 		.ascii	"C\377!\211D\377\"\212D\377\"\212D\377\"\212D\377\"\212D\377#"
+ 847      44FF228A 
+ 847      44FF228A 
+ 847      44FF228A 
+ 847      44FF228A 
+ 848 2445 8B44FF23 		.ascii	"\213D\377#\213E\377#\213E\377#\213F\377#\214F\377$\214F\377$"
+ 848      8B45FF23 
+ 848      8B45FF23 
+GAS LISTING /tmp/ccZQdzcl.s 			page 44
+
+
+ 848      8B46FF23 
+ 848      8C46FF24 
+ 849 245d 8C47FF24 		.ascii	"\214G\377$\214G\377$\215H\377%\215H\377%\215H\377%\215I\377%"
+ 849      8C47FF24 
+ 849      8D48FF25 
+ 849      8D48FF25 
+ 849      8D48FF25 
+ 850 2475 8E49FF25 		.ascii	"\216I\377%\216I\377&\216J\377&\217J\377&\217K\377&\217K\377'"
+ 850      8E49FF26 
+ 850      8E4AFF26 
+ 850      8F4AFF26 
+ 850      8F4BFF26 
+ 851 248d 8F4BFF27 		.ascii	"\217K\377'\220L\377'\220L\377'\220M\377(\220M\377(\221M\377("
+ 851      904CFF27 
+ 851      904CFF27 
+ 851      904DFF28 
+ 851      904DFF28 
+ 852 24a5 914EFF28 		.ascii	"\221N\377(\221N\377(\222N\377)\222O\377)\222O\377)\222P\377)"
+ 852      914EFF28 
+ 852      924EFF29 
+ 852      924FFF29 
+ 852      924FFF29 
+ 853 24bd 9350FF2A 		.ascii	"\223P\377*\223P\377*\223Q\377*\223Q\377*\224R\377+\224R\377+"
+ 853      9350FF2A 
+ 853      9351FF2A 
+ 853      9351FF2A 
+ 853      9452FF2B 
+ 854 24d5 9452FF2B 		.ascii	"\224R\377+\225S\377+\225S\377+\225S\377,\225T\377,\226T\377,"
+ 854      9553FF2B 
+ 854      9553FF2B 
+ 854      9553FF2C 
+ 854      9554FF2C 
+ 855 24ed 9655FF2C 		.ascii	"\226U\377,\226U\377-\226U\377-\227V\377-\227V\377-\227V\377."
+ 855      9655FF2D 
+ 855      9655FF2D 
+ 855      9756FF2D 
+ 855      9756FF2D 
+ 856 2505 9857FF2E 		.ascii	"\230W\377.\230W\377.\230X\377.\230X\377.\231X\377/\231Y\377/"
+ 856      9857FF2E 
+ 856      9858FF2E 
+ 856      9858FF2E 
+ 856      9958FF2F 
+ 857 251d 9959FF2F 		.ascii	"\231Y\377/\231Z\377/\232Z\3770\232Z\3770\232[\3770\233[\3770"
+ 857      995AFF2F 
+ 857      9A5AFF30 
+ 857      9A5AFF30 
+ 857      9A5BFF30 
+ 858 2535 9B5BFF31 		.ascii	"\233[\3771\233\\\3771\233\\\3771\234]\3771\234]\3771\234]\377"
+ 858      9B5CFF31 
+ 858      9B5CFF31 
+ 858      9C5DFF31 
+ 858      9C5DFF31 
+ 859 254c 329C5EFF 		.ascii	"2\234^\3772\235^\3772\235_\3772\235_\3773\236_\3773\236`\377"
+ 859      329D5EFF 
+ 859      329D5FFF 
+ 859      329D5FFF 
+ 859      339E5FFF 
+GAS LISTING /tmp/ccZQdzcl.s 			page 45
+
+
+ 860 2564 339E60FF 		.ascii	"3\236`\3773\236`\3774\237a\3774\237a\3774\237b\3774\237b\377"
+ 860      339E60FF 
+ 860      349F61FF 
+ 860      349F61FF 
+ 860      349F62FF 
+ 861 257c 34A062FF 		.ascii	"4\240b\3775\240c\3775\240c\3775\241c\3775\241d\3776\241d\377"
+ 861      35A063FF 
+ 861      35A063FF 
+ 861      35A163FF 
+ 861      35A164FF 
+ 862 2594 36A165FF 		.ascii	"6\241e\3776\242e\3776\242e\3777\242f\3777\242f\3777\243g\377"
+ 862      36A265FF 
+ 862      36A265FF 
+ 862      37A266FF 
+ 862      37A266FF 
+ 863 25ac 37A367FF 		.ascii	"7\243g\3778\243g\3778\244h\3778\244h\3778\244h\3779\244i\377"
+ 863      38A367FF 
+ 863      38A468FF 
+ 863      38A468FF 
+ 863      38A468FF 
+ 864 25c4 39A569FF 		.ascii	"9\245i\3779\245j\3779\245j\3779\246j\377:\246k\377:\246k\377"
+ 864      39A56AFF 
+ 864      39A56AFF 
+ 864      39A66AFF 
+ 864      3AA66BFF 
+ 865 25dc 3AA66CFF 		.ascii	":\246l\377:\247l\377;\247l\377;\247m\377;\247m\377;\250m\377"
+ 865      3AA76CFF 
+ 865      3BA76CFF 
+ 865      3BA76DFF 
+ 865      3BA76DFF 
+ 866 25f4 3CA86EFF 		.ascii	"<\250n\377<\250n\377<\251o\377<\251o\377=\251o\377=\251p\377"
+ 866      3CA86EFF 
+ 866      3CA96FFF 
+ 866      3CA96FFF 
+ 866      3DA96FFF 
+ 867 260c 3DAA70FF 		.ascii	"=\252p\377=\252q\377>\252q\377>\252q\377>\253r\377>\253r\377"
+ 867      3DAA71FF 
+ 867      3EAA71FF 
+ 867      3EAA71FF 
+ 867      3EAB72FF 
+ 868 2624 3FAB72FF 		.ascii	"?\253r\377?\254s\377?\254s\377?\254t\377@\254t\377@\255t\377"
+ 868      3FAC73FF 
+ 868      3FAC73FF 
+ 868      3FAC74FF 
+ 868      40AC74FF 
+ 869 263c 40AD75FF 		.ascii	"@\255u\377@\255u\377A\256u\377A\256v\377A\256v\377A\256w\377"
+ 869      40AD75FF 
+ 869      41AE75FF 
+ 869      41AE76FF 
+ 869      41AE76FF 
+ 870 2654 41AE77FF 		.ascii	"A\256w\377B\256w\377B\256x\377B\257x\377B\257y\377C\257y\377"
+ 870      42AE77FF 
+ 870      42AE78FF 
+ 870      42AF78FF 
+ 870      42AF79FF 
+ 871 266c 43AF79FF 		.ascii	"C\257y\377C\257z\377C\257z\377D\260{\377D\260{\377D\260{\377"
+ 871      43AF7AFF 
+GAS LISTING /tmp/ccZQdzcl.s 			page 46
+
+
+ 871      43AF7AFF 
+ 871      44B07BFF 
+ 871      44B07BFF 
+ 872 2684 44B07CFF 		.ascii	"D\260|\377E\260|\377E\260|\377E\261}\377E\261}\377F\261~\377"
+ 872      45B07CFF 
+ 872      45B07CFF 
+ 872      45B17DFF 
+ 872      45B17DFF 
+ 873 269c 46B17EFF 		.ascii	"F\261~\377F\261~\377F\261\177\377G\262\177\377G\262\177\377G"
+ 873      46B17EFF 
+ 873      46B17FFF 
+ 873      47B27FFF 
+ 873      47B27FFF 
+ 874 26b1 B280FF47 		.ascii	"\262\200\377G\262\200\377H\262\201\377H\262\201\377H\263\201"
+ 874      B280FF48 
+ 874      B281FF48 
+ 874      B281FF48 
+ 874      B381
+ 875 26c3 FF48B382 		.ascii	"\377H\263\202\377I\263\202\377I\263\202\377I\263\203\377I\263"
+ 875      FF49B382 
+ 875      FF49B382 
+ 875      FF49B383 
+ 875      FF49B3
+ 876 26d6 83FF4AB3 		.ascii	"\203\377J\263\204\377J\264\204\377J\264\204\377J\264\205\377"
+ 876      84FF4AB4 
+ 876      84FF4AB4 
+ 876      84FF4AB4 
+ 876      85FF
+ 877 26e8 4BB485FF 		.ascii	"K\264\205\377K\264\205\377K\264\206\377L\265\206\377L\265\207"
+ 877      4BB485FF 
+ 877      4BB486FF 
+ 877      4CB586FF 
+ 877      4CB587
+ 878 26fb FF4CB587 		.ascii	"\377L\265\207\377L\265\207\377M\265\210\377M\265\210\377M\266"
+ 878      FF4CB587 
+ 878      FF4DB588 
+ 878      FF4DB588 
+ 878      FF4DB6
+ 879 270e 88FF4EB6 		.ascii	"\210\377N\266\211\377N\266\211\377N\266\212\377N\266\212\377"
+ 879      89FF4EB6 
+ 879      89FF4EB6 
+ 879      8AFF4EB6 
+ 879      8AFF
+ 880 2720 4FB68AFF 		.ascii	"O\266\212\377O\266\213\377O\267\213\377O\267\213\377P\267\214"
+ 880      4FB68BFF 
+ 880      4FB78BFF 
+ 880      4FB78BFF 
+ 880      50B78C
+ 881 2733 FF50B78C 		.ascii	"\377P\267\214\377P\267\214\377Q\267\215\377Q\270\215\377Q\270"
+ 881      FF50B78C 
+ 881      FF51B78D 
+ 881      FF51B88D 
+ 881      FF51B8
+ 882 2746 8EFF52B8 		.ascii	"\216\377R\270\216\377R\270\216\377R\270\217\377R\270\217\377"
+ 882      8EFF52B8 
+ 882      8EFF52B8 
+ 882      8FFF52B8 
+GAS LISTING /tmp/ccZQdzcl.s 			page 47
+
+
+ 882      8FFF
+ 883 2758 53B98FFF 		.ascii	"S\271\217\377S\271\220\377S\271\220\377T\271\220\377T\271\221"
+ 883      53B990FF 
+ 883      53B990FF 
+ 883      54B990FF 
+ 883      54B991
+ 884 276b FF54B991 		.ascii	"\377T\271\221\377T\271\221\377U\272\222\377U\272\222\377U\272"
+ 884      FF54B991 
+ 884      FF55BA92 
+ 884      FF55BA92 
+ 884      FF55BA
+ 885 277e 92FF56BA 		.ascii	"\222\377V\272\223\377V\272\223\377V\272\224\377W\273\224\377"
+ 885      93FF56BA 
+ 885      93FF56BA 
+ 885      94FF57BB 
+ 885      94FF
+ 886 2790 57BB94FF 		.ascii	"W\273\224\377W\273\225\377X\273\225\377X\273\225\377X\273\226"
+ 886      57BB95FF 
+ 886      58BB95FF 
+ 886      58BB95FF 
+ 886      58BB96
+ 887 27a3 FF58BB96 		.ascii	"\377X\273\226\377Y\274\226\377Y\274\227\377Y\274\227\377Z\274"
+ 887      FF59BC96 
+ 887      FF59BC97 
+ 887      FF59BC97 
+ 887      FF5ABC
+ 888 27b6 97FF5ABC 		.ascii	"\227\377Z\274\230\377Z\274\230\377[\275\230\377[\275\231\377"
+ 888      98FF5ABC 
+ 888      98FF5BBD 
+ 888      98FF5BBD 
+ 888      99FF
+ 889 27c8 5BBD99FF 		.ascii	"[\275\231\377\\\275\231\377\\\275\232\377\\\275\232\377]\275"
+ 889      5CBD99FF 
+ 889      5CBD9AFF 
+ 889      5CBD9AFF 
+ 889      5DBD
+ 890 27da 9AFF5DBE 		.ascii	"\232\377]\276\233\377]\276\233\377^\276\234\377^\276\234\377"
+ 890      9BFF5DBE 
+ 890      9BFF5EBE 
+ 890      9CFF5EBE 
+ 890      9CFF
+ 891 27ec 5EBE9CFF 		.ascii	"^\276\234\377_\276\235\377_\276\235\377_\277\235\377_\277\236"
+ 891      5FBE9DFF 
+ 891      5FBE9DFF 
+ 891      5FBF9DFF 
+ 891      5FBF9E
+ 892 27ff FF60BF9E 		.ascii	"\377`\277\236\377`\277\236\377`\277\237\377a\277\237\377"
+ 892      FF60BF9E 
+ 892      FF60BF9F 
+ 892      FF61BF9F 
+ 892      FF
+ 893 2810 61C09FFF 		.ascii	"a\300\237\377a\300\240\377b\300\240\377b\300\240\377b\300\241"
+ 893      61C0A0FF 
+ 893      62C0A0FF 
+ 893      62C0A0FF 
+ 893      62C0A1
+ 894 2823 FF63C0A1 		.ascii	"\377c\300\241\377c\300\241\377c\301\242\377d\301\242\377d\301"
+GAS LISTING /tmp/ccZQdzcl.s 			page 48
+
+
+ 894      FF63C0A1 
+ 894      FF63C1A2 
+ 894      FF64C1A2 
+ 894      FF64C1
+ 895 2836 A2FF64C1 		.ascii	"\242\377d\301\243\377e\301\243\377e\301\243\377f\302\243\377"
+ 895      A3FF65C1 
+ 895      A3FF65C1 
+ 895      A3FF66C2 
+ 895      A3FF
+ 896 2848 66C2A4FF 		.ascii	"f\302\244\377f\302\244\377g\302\244\377g\302\245\377g\302\245"
+ 896      66C2A4FF 
+ 896      67C2A4FF 
+ 896      67C2A5FF 
+ 896      67C2A5
+ 897 285b FF68C3A5 		.ascii	"\377h\303\245\377h\303\246\377i\303\246\377i\303\246\377i\303"
+ 897      FF68C3A6 
+ 897      FF69C3A6 
+ 897      FF69C3A6 
+ 897      FF69C3
+ 898 286e A7FF6AC3 		.ascii	"\247\377j\303\247\377j\304\247\377k\304\247\377k\304\250\377"
+ 898      A7FF6AC4 
+ 898      A7FF6BC4 
+ 898      A7FF6BC4 
+ 898      A8FF
+ 899 2880 6BC4A8FF 		.ascii	"k\304\250\377l\304\250\377l\304\251\377m\305\251\377m\305\251"
+ 899      6CC4A8FF 
+ 899      6CC4A9FF 
+ 899      6DC5A9FF 
+ 899      6DC5A9
+ 900 2893 FF6DC5AA 		.ascii	"\377m\305\252\377n\305\252\377n\305\252\377o\306\253\377o\306"
+ 900      FF6EC5AA 
+ 900      FF6EC5AA 
+ 900      FF6FC6AB 
+ 900      FF6FC6
+ 901 28a6 ABFF6FC6 		.ascii	"\253\377o\306\253\377p\306\253\377p\306\254\377q\306\254\377"
+ 901      ABFF70C6 
+ 901      ABFF70C6 
+ 901      ACFF71C6 
+ 901      ACFF
+ 902 28b8 71C7ACFF 		.ascii	"q\307\254\377q\307\255\377r\307\255\377r\307\255\377r\307\256"
+ 902      71C7ADFF 
+ 902      72C7ADFF 
+ 902      72C7ADFF 
+ 902      72C7AE
+ 903 28cb FF73C7AE 		.ascii	"\377s\307\256\377s\310\256\377t\310\256\377t\310\257\377t\310"
+ 903      FF73C8AE 
+ 903      FF74C8AE 
+ 903      FF74C8AF 
+ 903      FF74C8
+ 904 28de AFFF75C8 		.ascii	"\257\377u\310\257\377u\310\260\377v\311\260\377v\311\260\377"
+ 904      AFFF75C8 
+ 904      B0FF76C9 
+ 904      B0FF76C9 
+ 904      B0FF
+ 905 28f0 76C9B1FF 		.ascii	"v\311\261\377w\311\261\377w\311\261\377x\312\261\377x\312\262"
+ 905      77C9B1FF 
+ 905      77C9B1FF 
+GAS LISTING /tmp/ccZQdzcl.s 			page 49
+
+
+ 905      78CAB1FF 
+ 905      78CAB2
+ 906 2903 FF78CAB2 		.ascii	"\377x\312\262\377y\312\262\377y\312\263\377z\312\263\377z\313"
+ 906      FF79CAB2 
+ 906      FF79CAB3 
+ 906      FF7ACAB3 
+ 906      FF7ACB
+ 907 2916 B3FF7ACB 		.ascii	"\263\377z\313\263\377{\313\264\377{\313\264\377|\313\264\377"
+ 907      B3FF7BCB 
+ 907      B4FF7BCB 
+ 907      B4FF7CCB 
+ 907      B4FF
+ 908 2928 7CCBB5FF 		.ascii	"|\313\265\377|\314\265\377}\314\265\377}\314\265\377~\314\266"
+ 908      7CCCB5FF 
+ 908      7DCCB5FF 
+ 908      7DCCB5FF 
+ 908      7ECCB6
+ 909 293b FF7ECCB6 		.ascii	"\377~\314\266\377~\314\266\377\177\315\267\377\177\315\267\377"
+ 909      FF7ECCB6 
+ 909      FF7FCDB7 
+ 909      FF7FCDB7 
+ 909      FF
+ 910 294c 80CDB7FF 		.ascii	"\200\315\267\377\200\315\270\377\200\315\270\377\201\315\270"
+ 910      80CDB8FF 
+ 910      80CDB8FF 
+ 910      81CDB8
+ 911 295b FF81CEB8 		.ascii	"\377\201\316\270\377\202\316\271\377\202\316\271\377\202\316"
+ 911      FF82CEB9 
+ 911      FF82CEB9 
+ 911      FF82CE
+ 912 296a B9FF83CE 		.ascii	"\271\377\203\316\272\377\203\317\272\377\204\317\272\377\204"
+ 912      BAFF83CF 
+ 912      BAFF84CF 
+ 912      BAFF84
+ 913 2979 CFBAFF84 		.ascii	"\317\272\377\204\317\273\377\205\317\273\377\205\317\273\377"
+ 913      CFBBFF85 
+ 913      CFBBFF85 
+ 913      CFBBFF
+ 914 2988 86D0BCFF 		.ascii	"\206\320\274\377\206\320\274\377\206\320\274\377\207\320\274"
+ 914      86D0BCFF 
+ 914      86D0BCFF 
+ 914      87D0BC
+ 915 2997 FF87D0BD 		.ascii	"\377\207\320\275\377\210\320\275\377\210\321\275\377\210\321"
+ 915      FF88D0BD 
+ 915      FF88D1BD 
+ 915      FF88D1
+ 916 29a6 BEFF89D1 		.ascii	"\276\377\211\321\276\377\211\321\276\377\212\321\276\377\212"
+ 916      BEFF89D1 
+ 916      BEFF8AD1 
+ 916      BEFF8A
+ 917 29b5 D1BFFF8A 		.ascii	"\321\277\377\212\322\277\377\213\322\277\377\213\322\277\377"
+ 917      D2BFFF8B 
+ 917      D2BFFF8B 
+ 917      D2BFFF
+ 918 29c4 8CD2C0FF 		.ascii	"\214\322\300\377\214\322\300\377\214\322\300\377\215\323\301"
+ 918      8CD2C0FF 
+ 918      8CD2C0FF 
+GAS LISTING /tmp/ccZQdzcl.s 			page 50
+
+
+ 918      8DD3C1
+ 919 29d3 FF8DD3C1 		.ascii	"\377\215\323\301\377\216\323\301\377\216\323\301\377\216\323"
+ 919      FF8ED3C1 
+ 919      FF8ED3C1 
+ 919      FF8ED3
+ 920 29e2 C2FF8FD3 		.ascii	"\302\377\217\323\302\377\217\324\302\377\220\324\303\377\220"
+ 920      C2FF8FD4 
+ 920      C2FF90D4 
+ 920      C3FF90
+ 921 29f1 D4C3FF90 		.ascii	"\324\303\377\220\324\303\377\221\324\303\377\221\324\304\377"
+ 921      D4C3FF91 
+ 921      D4C3FF91 
+ 921      D4C4FF
+ 922 2a00 92D5C4FF 		.ascii	"\222\325\304\377\222\325\304\377\222\325\304\377\223\325\305"
+ 922      92D5C4FF 
+ 922      92D5C4FF 
+ 922      93D5C5
+ 923 2a0f FF93D5C5 		.ascii	"\377\223\325\305\377\224\325\305\377\224\326\306\377\224\326"
+ 923      FF94D5C5 
+ 923      FF94D6C6 
+ 923      FF94D6
+ 924 2a1e C6FF95D6 		.ascii	"\306\377\225\326\306\377\225\326\306\377\226\326\307\377\226"
+ 924      C6FF95D6 
+ 924      C6FF96D6 
+ 924      C7FF96
+ 925 2a2d D6C7FF96 		.ascii	"\326\307\377\226\327\307\377\227\327\307\377\227\327\310\377"
+ 925      D7C7FF97 
+ 925      D7C7FF97 
+ 925      D7C8FF
+ 926 2a3c 98D7C8FF 		.ascii	"\230\327\310\377\230\327\310\377\230\330\310\377\231\330\311"
+ 926      98D7C8FF 
+ 926      98D8C8FF 
+ 926      99D8C9
+ 927 2a4b FF99D8C9 		.ascii	"\377\231\330\311\377\232\330\311\377\232\330\311\377\232\330"
+ 927      FF9AD8C9 
+ 927      FF9AD8C9 
+ 927      FF9AD8
+ 928 2a5a CAFF9BD8 		.ascii	"\312\377\233\330\312\377\233\331\312\377\234\331\312\377\234"
+ 928      CAFF9BD9 
+ 928      CAFF9CD9 
+ 928      CAFF9C
+ 929 2a69 D9CBFF9C 		.ascii	"\331\313\377\234\331\313\377\235\331\313\377\235\331\313\377"
+ 929      D9CBFF9D 
+ 929      D9CBFF9D 
+ 929      D9CBFF
+ 930 2a78 9EDACCFF 		.ascii	"\236\332\314\377\236\332\314\377\236\332\314\377\237\332\314"
+ 930      9EDACCFF 
+ 930      9EDACCFF 
+ 930      9FDACC
+ 931 2a87 FF9FDACD 		.ascii	"\377\237\332\315\377\240\332\315\377\240\333\315\377\240\333"
+ 931      FFA0DACD 
+ 931      FFA0DBCD 
+ 931      FFA0DB
+ 932 2a96 CDFFA1DB 		.ascii	"\315\377\241\333\315\377\241\333\316\377\242\333\316\377\242"
+ 932      CDFFA1DB 
+ 932      CEFFA2DB 
+ 932      CEFFA2
+GAS LISTING /tmp/ccZQdzcl.s 			page 51
+
+
+ 933 2aa5 DBCEFFA2 		.ascii	"\333\316\377\242\333\316\377\243\334\317\377\243\334\317\377"
+ 933      DBCEFFA3 
+ 933      DCCFFFA3 
+ 933      DCCFFF
+ 934 2ab4 A4DCCFFF 		.ascii	"\244\334\317\377\244\334\317\377\244\334\320\377\245\334\320"
+ 934      A4DCCFFF 
+ 934      A4DCD0FF 
+ 934      A5DCD0
+ 935 2ac3 FFA5DDD0 		.ascii	"\377\245\335\320\377\246\335\320\377\246\335\321\377\246\335"
+ 935      FFA6DDD0 
+ 935      FFA6DDD1 
+ 935      FFA6DD
+ 936 2ad2 D1FFA7DD 		.ascii	"\321\377\247\335\321\377\247\335\321\377\250\336\321\377\250"
+ 936      D1FFA7DD 
+ 936      D1FFA8DE 
+ 936      D1FFA8
+ 937 2ae1 DED2FFA8 		.ascii	"\336\322\377\250\336\322\377\251\336\322\377\251\336\322\377"
+ 937      DED2FFA9 
+ 937      DED2FFA9 
+ 937      DED2FF
+ 938 2af0 AADED3FF 		.ascii	"\252\336\323\377\252\336\323\377\252\337\323\377\253\337\323"
+ 938      AADED3FF 
+ 938      AADFD3FF 
+ 938      ABDFD3
+ 939 2aff FFABDFD4 		.ascii	"\377\253\337\324\377\254\337\324\377\254\337\324\377\254\337"
+ 939      FFACDFD4 
+ 939      FFACDFD4 
+ 939      FFACDF
+ 940 2b0e D4FFADE0 		.ascii	"\324\377\255\340\324\377\255\340\325\377\256\340\325\377\256"
+ 940      D4FFADE0 
+ 940      D5FFAEE0 
+ 940      D5FFAE
+ 941 2b1d E0D5FFAE 		.ascii	"\340\325\377\256\340\325\377\257\340\326\377\257\340\326\377"
+ 941      E0D5FFAF 
+ 941      E0D6FFAF 
+ 941      E0D6FF
+ 942 2b2c B0E1D6FF 		.ascii	"\260\341\326\377\260\341\326\377\260\341\327\377\261\341\327"
+ 942      B0E1D6FF 
+ 942      B0E1D7FF 
+ 942      B1E1D7
+ 943 2b3b FFB1E1D7 		.ascii	"\377\261\341\327\377\262\341\327\377\262\342\327\377\262\342"
+ 943      FFB2E1D7 
+ 943      FFB2E2D7 
+ 943      FFB2E2
+ 944 2b4a D8FFB3E2 		.ascii	"\330\377\263\342\330\377\263\342\330\377\264\342\330\377\264"
+ 944      D8FFB3E2 
+ 944      D8FFB4E2 
+ 944      D8FFB4
+ 945 2b59 E2D9FFB4 		.ascii	"\342\331\377\264\343\331\377\265\343\331\377\265\343\331\377"
+ 945      E3D9FFB5 
+ 945      E3D9FFB5 
+ 945      E3D9FF
+ 946 2b68 B6E3D9FF 		.ascii	"\266\343\331\377\266\343\332\377\266\343\332\377\267\343\332"
+ 946      B6E3DAFF 
+ 946      B6E3DAFF 
+ 946      B7E3DA
+ 947 2b77 FFB7E4DA 		.ascii	"\377\267\344\332\377\270\344\333\377\270\344\333\377\270\344"
+GAS LISTING /tmp/ccZQdzcl.s 			page 52
+
+
+ 947      FFB8E4DB 
+ 947      FFB8E4DB 
+ 947      FFB8E4
+ 948 2b86 DBFFB9E4 		.ascii	"\333\377\271\344\333\377\271\344\333\377\272\345\334\377\272"
+ 948      DBFFB9E4 
+ 948      DBFFBAE5 
+ 948      DCFFBA
+ 949 2b95 E5DCFFBA 		.ascii	"\345\334\377\272\345\334\377\273\345\334\377\273\345\335\377"
+ 949      E5DCFFBB 
+ 949      E5DCFFBB 
+ 949      E5DDFF
+ 950 2ba4 BCE5DDFF 		.ascii	"\274\345\335\377\274\345\335\377\274\346\335\377\275\346\335"
+ 950      BCE5DDFF 
+ 950      BCE6DDFF 
+ 950      BDE6DD
+ 951 2bb3 FFBDE6DE 		.ascii	"\377\275\346\336\377\276\346\336\377\276\346\336\377\276\346"
+ 951      FFBEE6DE 
+ 951      FFBEE6DE 
+ 951      FFBEE6
+ 952 2bc2 DEFFBFE7 		.ascii	"\336\377\277\347\337\377\277\347\337\377\300\347\337\377\300"
+ 952      DFFFBFE7 
+ 952      DFFFC0E7 
+ 952      DFFFC0
+ 953 2bd1 E7DFFFC0 		.ascii	"\347\337\377\300\347\337\377\301\347\340\377\301\347\340\377"
+ 953      E7DFFFC1 
+ 953      E7E0FFC1 
+ 953      E7E0FF
+ 954 2be0 C2E8E0FF 		.ascii	"\302\350\340\377\302\350\340\377\302\350\341\377\303\350\341"
+ 954      C2E8E0FF 
+ 954      C2E8E1FF 
+ 954      C3E8E1
+ 955 2bef FFC3E8E1 		.ascii	"\377\303\350\341\377\304\350\341\377\304\351\341\377\304\351"
+ 955      FFC4E8E1 
+ 955      FFC4E9E1 
+ 955      FFC4E9
+ 956 2bfe E2FFC5E9 		.ascii	"\342\377\305\351\342\377\305\351\342\377\306\351\342\377\306"
+ 956      E2FFC5E9 
+ 956      E2FFC6E9 
+ 956      E2FFC6
+ 957 2c0d E9E2FFC6 		.ascii	"\351\342\377\306\351\343\377\307\352\343\377\307\352\343\377"
+ 957      E9E3FFC7 
+ 957      EAE3FFC7 
+ 957      EAE3FF
+ 958 2c1c C8EAE3FF 		.ascii	"\310\352\343\377\310\352\344\377\310\352\344\377\311\352\344"
+ 958      C8EAE4FF 
+ 958      C8EAE4FF 
+ 958      C9EAE4
+ 959 2c2b FFC9EBE4 		.ascii	"\377\311\353\344\377\312\353\344\377\312\353\345\377\312\353"
+ 959      FFCAEBE4 
+ 959      FFCAEBE5 
+ 959      FFCAEB
+ 960 2c3a E5FFCBEB 		.ascii	"\345\377\313\353\345\377\313\353\345\377\313\354\345\377\314"
+ 960      E5FFCBEB 
+ 960      E5FFCBEC 
+ 960      E5FFCC
+ 961 2c49 ECE6FFCC 		.ascii	"\354\346\377\314\354\346\377\314\354\346\377\314\354\346\377"
+ 961      ECE6FFCC 
+GAS LISTING /tmp/ccZQdzcl.s 			page 53
+
+
+ 961      ECE6FFCC 
+ 961      ECE6FF
+ 962 2c58 CCECE7FF 		.ascii	"\314\354\347\377\314\354\347\377\315\354\347\377\315\354\347"
+ 962      CCECE7FF 
+ 962      CDECE7FF 
+ 962      CDECE7
+ 963 2c67 FFCDECE7 		.ascii	"\377\315\354\347\377\315\354\350\377\315\354\350\377\315\354"
+ 963      FFCDECE8 
+ 963      FFCDECE8 
+ 963      FFCDEC
+ 964 2c76 E8FFCDEC 		.ascii	"\350\377\315\354\350\377\316\355\350\377\316\355\350\377\316"
+ 964      E8FFCEED 
+ 964      E8FFCEED 
+ 964      E8FFCE
+ 965 2c85 EDE9FFCE 		.ascii	"\355\351\377\316\355\351\377\316\355\351\377\316\355\351\377"
+ 965      EDE9FFCE 
+ 965      EDE9FFCE 
+ 965      EDE9FF
+ 966 2c94 CFEDE9FF 		.ascii	"\317\355\351\377\317\355\352\377\317\355\352\377\317\355\352"
+ 966      CFEDEAFF 
+ 966      CFEDEAFF 
+ 966      CFEDEA
+ 967 2ca3 FFCFEDEA 		.ascii	"\377\317\355\352\377\317\355\352\377\320\355\353\377\320\356"
+ 967      FFCFEDEA 
+ 967      FFD0EDEB 
+ 967      FFD0EE
+ 968 2cb2 EBFFD0EE 		.ascii	"\353\377\320\356\353\377\320\356\353\377\320\356\353\377\321"
+ 968      EBFFD0EE 
+ 968      EBFFD0EE 
+ 968      EBFFD1
+ 969 2cc1 EEEBFFD1 		.ascii	"\356\353\377\321\356\354\377\321\356\354\377\321\356\354\377"
+ 969      EEECFFD1 
+ 969      EEECFFD1 
+ 969      EEECFF
+ 970 2cd0 D1EEECFF 		.ascii	"\321\356\354\377\321\356\354\377\322\356\355\377\322\356\355"
+ 970      D1EEECFF 
+ 970      D2EEEDFF 
+ 970      D2EEED
+ 971 2cdf FFD2EEED 		.ascii	"\377\322\356\355\377\322\356\355\377\322\357\355\377\323\357"
+ 971      FFD2EEED 
+ 971      FFD2EFED 
+ 971      FFD3EF
+ 972 2cee EDFFD3EF 		.ascii	"\355\377\323\357\356\377\323\357\356\377\323\357\356\377\323"
+ 972      EEFFD3EF 
+ 972      EEFFD3EF 
+ 972      EEFFD3
+ 973 2cfd EFEEFFD3 		.ascii	"\357\356\377\323\357\356\377\324\357\356\377\324\357\357\377"
+ 973      EFEEFFD4 
+ 973      EFEEFFD4 
+ 973      EFEFFF
+ 974 2d0c D4EFEFFF 		.ascii	"\324\357\357\377\324\357\357\377\324\357\357\377\325\357\357"
+ 974      D4EFEFFF 
+ 974      D4EFEFFF 
+ 974      D5EFEF
+ 975 2d1b FFD5EFEF 		.ascii	"\377\325\357\357\377\325\360\360\377\325\360\360\377\325\360"
+ 975      FFD5F0F0 
+ 975      FFD5F0F0 
+GAS LISTING /tmp/ccZQdzcl.s 			page 54
+
+
+ 975      FFD5F0
+ 976 2d2a F0FFD6F0 		.ascii	"\360\377\326\360\360\377\326\360\360\377\326\360\360\377\326"
+ 976      F0FFD6F0 
+ 976      F0FFD6F0 
+ 976      F0FFD6
+ 977 2d39 F0F0FFD6 		.ascii	"\360\360\377\326\360\361\377\327\360\361\377\327\360\361\377"
+ 977      F0F1FFD7 
+ 977      F0F1FFD7 
+ 977      F0F1FF
+ 978 2d48 D7F0F1FF 		.ascii	"\327\360\361\377\327\360\361\377\327\360\361\377\330\360\361"
+ 978      D7F0F1FF 
+ 978      D7F0F1FF 
+ 978      D8F0F1
+ 979 2d57 FFD8F0F2 		.ascii	"\377\330\360\362\377\330\361\362\377\330\361\362\377\330\361"
+ 979      FFD8F1F2 
+ 979      FFD8F1F2 
+ 979      FFD8F1
+ 980 2d66 F2FFD9F1 		.ascii	"\362\377\331\361\362\377\331\361\362\377\331\361\362\377\331"
+ 980      F2FFD9F1 
+ 980      F2FFD9F1 
+ 980      F2FFD9
+ 981 2d75 F1F3FFD9 		.ascii	"\361\363\377\331\361\363\377\332\361\363\377\332\361\363\377"
+ 981      F1F3FFDA 
+ 981      F1F3FFDA 
+ 981      F1F3FF
+ 982 2d84 DAF1F3FF 		.ascii	"\332\361\363\377\332\361\363\377\333\361\363\377\333\361\364"
+ 982      DAF1F3FF 
+ 982      DBF1F3FF 
+ 982      DBF1F4
+ 983 2d93 FFDBF2F4 		.ascii	"\377\333\362\364\377\333\362\364\377\333\362\364\377\334\362"
+ 983      FFDBF2F4 
+ 983      FFDBF2F4 
+ 983      FFDCF2
+ 984 2da2 F4FFDCF2 		.ascii	"\364\377\334\362\364\377\334\362\364\377\334\362\364\377\334"
+ 984      F4FFDCF2 
+ 984      F4FFDCF2 
+ 984      F4FFDC
+ 985 2db1 F2F5FFDD 		.ascii	"\362\365\377\335\362\365\377\335\362\365\377\335\362\365\377"
+ 985      F2F5FFDD 
+ 985      F2F5FFDD 
+ 985      F2F5FF
+ 986 2dc0 DDF2F5FF 		.ascii	"\335\362\365\377\335\362\365\377\336\362\365\377\336\362\365"
+ 986      DDF2F5FF 
+ 986      DEF2F5FF 
+ 986      DEF2F5
+ 987 2dcf FFDEF3F6 		.ascii	"\377\336\363\366\377\336\363\366\377\337\363\366\377\337\363"
+ 987      FFDEF3F6 
+ 987      FFDFF3F6 
+ 987      FFDFF3
+ 988 2dde F6FFDFF3 		.ascii	"\366\377\337\363\366\377\337\363\366\377\337\363\366\377\340"
+ 988      F6FFDFF3 
+ 988      F6FFDFF3 
+ 988      F6FFE0
+ 989 2ded F3F6FFE0 		.ascii	"\363\366\377\340\363\366\377\340\363\367\377\340\363\367\377"
+ 989      F3F6FFE0 
+ 989      F3F7FFE0 
+ 989      F3F7FF
+GAS LISTING /tmp/ccZQdzcl.s 			page 55
+
+
+ 990 2dfc E1F3F7FF 		.ascii	"\341\363\367\377\341\363\367\377\341\363\367\377\341\363\367"
+ 990      E1F3F7FF 
+ 990      E1F3F7FF 
+ 990      E1F3F7
+ 991 2e0b FFE1F4F7 		.ascii	"\377\341\364\367\377\342\364\367\377\342\364\367\377\342\364"
+ 991      FFE2F4F7 
+ 991      FFE2F4F7 
+ 991      FFE2F4
+ 992 2e1a F7FFE2F4 		.ascii	"\367\377\342\364\370\377\343\364\370\377\343\364\370\377\343"
+ 992      F8FFE3F4 
+ 992      F8FFE3F4 
+ 992      F8FFE3
+ 993 2e29 F4F8FFE3 		.ascii	"\364\370\377\343\364\370\377\343\364\370\377\344\364\370\377"
+ 993      F4F8FFE3 
+ 993      F4F8FFE4 
+ 993      F4F8FF
+ 994 2e38 E4F4F8FF 		.ascii	"\344\364\370\377\344\364\370\377\344\364\370\377\344\365\370"
+ 994      E4F4F8FF 
+ 994      E4F4F8FF 
+ 994      E4F5F8
+ 995 2e47 FFE5F5F9 		.ascii	"\377\345\365\371\377\345\365\371\377\345\365\371\377\345\365"
+ 995      FFE5F5F9 
+ 995      FFE5F5F9 
+ 995      FFE5F5
+ 996 2e56 F9FFE5F5 		.ascii	"\371\377\345\365\371\377\345\365\371\377\345\365\371\377\346"
+ 996      F9FFE5F5 
+ 996      F9FFE5F5 
+ 996      F9FFE6
+ 997 2e65 F5F9FFE6 		.ascii	"\365\371\377\346\365\371\377\346\365\371\377\346\365\371\377"
+ 997      F5F9FFE6 
+ 997      F5F9FFE6 
+ 997      F5F9FF
+ 998 2e74 E6F5F9FF 		.ascii	"\346\365\371\377\346\365\371\377\346\365\371\377\347\365\371"
+ 998      E6F5F9FF 
+ 998      E6F5F9FF 
+ 998      E7F5F9
+ 999 2e83 FFE7F5F9 		.ascii	"\377\347\365\371\377\347\365\371\377\347\365\371\377\347\366"
+ 999      FFE7F5F9 
+ 999      FFE7F5F9 
+ 999      FFE7F6
+ 1000 2e92 F9FFE7F6 		.ascii	"\371\377\347\366\371\377\347\366\371\377\350\366\371\377\350"
+ 1000      F9FFE7F6 
+ 1000      F9FFE8F6 
+ 1000      F9FFE8
+ 1001 2ea1 F6F9FFE8 		.ascii	"\366\371\377\350\366\371\377\350\366\371\377\350\366\371\377"
+ 1001      F6F9FFE8 
+ 1001      F6F9FFE8 
+ 1001      F6F9FF
+ 1002 2eb0 E8F6F9FF 		.ascii	"\350\366\371\377\350\366\371\377\351\366\371\377\351\366\371"
+ 1002      E8F6F9FF 
+ 1002      E9F6F9FF 
+ 1002      E9F6F9
+ 1003 2ebf FFE9F6F9 		.ascii	"\377\351\366\371\377\351\366\371\377\351\366\371\377\351\366"
+ 1003      FFE9F6F9 
+ 1003      FFE9F6F9 
+ 1003      FFE9F6
+ 1004 2ece F9FFE9F6 		.ascii	"\371\377\351\366\372\377\352\366\372\377\352\367\372\377\352"
+GAS LISTING /tmp/ccZQdzcl.s 			page 56
+
+
+ 1004      FAFFEAF6 
+ 1004      FAFFEAF7 
+ 1004      FAFFEA
+ 1005 2edd F7FAFFEA 		.ascii	"\367\372\377\352\367\372\377\352\367\372\377\352\367\372\377"
+ 1005      F7FAFFEA 
+ 1005      F7FAFFEA 
+ 1005      F7FAFF
+ 1006 2eec EAF7FAFF 		.ascii	"\352\367\372\377\353\367\372\377\353\367\372\377\353\367\372"
+ 1006      EBF7FAFF 
+ 1006      EBF7FAFF 
+ 1006      EBF7FA
+ 1007 2efb FFEBF7FA 		.ascii	"\377\353\367\372\377\353\367\372\377\353\367\372\377\353\367"
+ 1007      FFEBF7FA 
+ 1007      FFEBF7FA 
+ 1007      FFEBF7
+ 1008 2f0a FAFFECF7 		.ascii	"\372\377\354\367\372\377\354\367\372\377\354\367\372\377\354"
+ 1008      FAFFECF7 
+ 1008      FAFFECF7 
+ 1008      FAFFEC
+ 1009 2f19 F7FAFFEC 		.ascii	"\367\372\377\354\367\372\377\354\370\372\377\354\370\372\377"
+ 1009      F7FAFFEC 
+ 1009      F8FAFFEC 
+ 1009      F8FAFF
+ 1010 2f28 EDF8FAFF 		.ascii	"\355\370\372\377\355\370\372\377\355\370\372\377\355\370\372"
+ 1010      EDF8FAFF 
+ 1010      EDF8FAFF 
+ 1010      EDF8FA
+ 1011 2f37 FFEDF8FA 		.ascii	"\377\355\370\372\377\355\370\372\377\355\370\372\377\355\370"
+ 1011      FFEDF8FA 
+ 1011      FFEDF8FA 
+ 1011      FFEDF8
+ 1012 2f46 FAFFEEF8 		.ascii	"\372\377\356\370\372\377\356\370\372\377\356\370\372\377\356"
+ 1012      FAFFEEF8 
+ 1012      FAFFEEF8 
+ 1012      FAFFEE
+ 1013 2f55 F8FBFFEE 		.ascii	"\370\373\377\356\370\373\377\356\370\373\377\356\370\373\377"
+ 1013      F8FBFFEE 
+ 1013      F8FBFFEE 
+ 1013      F8FBFF
+ 1014 2f64 EFF8FBFF 		.ascii	"\357\370\373\377\357\371\373\377\357\371\373\377\357\371\373"
+ 1014      EFF9FBFF 
+ 1014      EFF9FBFF 
+ 1014      EFF9FB
+ 1015 2f73 FFEFF9FB 		.ascii	"\377\357\371\373\377\357\371\373\377\357\371\373\377\360\371"
+ 1015      FFEFF9FB 
+ 1015      FFEFF9FB 
+ 1015      FFF0F9
+ 1016 2f82 FBFFF0F9 		.ascii	"\373\377\360\371\373\377\360\371\373\377\360\371\373\377\360"
+ 1016      FBFFF0F9 
+ 1016      FBFFF0F9 
+ 1016      FBFFF0
+ 1017 2f91 F9FBFFF0 		.ascii	"\371\373\377\360\371\373\377\360\371\373\377\361\371\373\377"
+ 1017      F9FBFFF0 
+ 1017      F9FBFFF1 
+ 1017      F9FBFF
+ 1018 2fa0 F1F9FBFF 		.ascii	"\361\371\373\377\361\371\373\377\361\371\373\377\361\371\373"
+ 1018      F1F9FBFF 
+GAS LISTING /tmp/ccZQdzcl.s 			page 57
+
+
+ 1018      F1F9FBFF 
+ 1018      F1F9FB
+ 1019 2faf FFF1F9FB 		.ascii	"\377\361\371\373\377\361\372\373\377\362\372\373\377\362\372"
+ 1019      FFF1FAFB 
+ 1019      FFF2FAFB 
+ 1019      FFF2FA
+ 1020 2fbe FBFFF2FA 		.ascii	"\373\377\362\372\373\377\362\372\373\377\362\372\373\377\362"
+ 1020      FBFFF2FA 
+ 1020      FBFFF2FA 
+ 1020      FBFFF2
+ 1021 2fcd FAFBFFF2 		.ascii	"\372\373\377\362\372\374\377\363\372\374\377\363\372\374\377"
+ 1021      FAFCFFF3 
+ 1021      FAFCFFF3 
+ 1021      FAFCFF
+ 1022 2fdc F3FAFCFF 		.ascii	"\363\372\374\377"
+ 1023 2fe0 F3FAFCFF 		.ascii	"\363\372\374\377\363\372\374\377\363\372\374\377\363\372\374"
+ 1023      F3FAFCFF 
+ 1023      F3FAFCFF 
+ 1023      F3FAFC
+ 1024 2fef FFF4FAFC 		.ascii	"\377\364\372\374\377\364\372\374\377\364\372\374\377\364\373"
+ 1024      FFF4FAFC 
+ 1024      FFF4FAFC 
+ 1024      FFF4FB
+ 1025 2ffe FCFFF4FB 		.ascii	"\374\377\364\373\374\377\364\373\374\377\364\373\374\377\365"
+ 1025      FCFFF4FB 
+ 1025      FCFFF4FB 
+ 1025      FCFFF5
+ 1026 300d FBFCFFF5 		.ascii	"\373\374\377\365\373\374\377\365\373\374\377\365\373\374\377"
+ 1026      FBFCFFF5 
+ 1026      FBFCFFF5 
+ 1026      FBFCFF
+ 1027 301c F5FBFCFF 		.ascii	"\365\373\374\377\365\373\374\377\365\373\374\377\366\373\374"
+ 1027      F5FBFCFF 
+ 1027      F5FBFCFF 
+ 1027      F6FBFC
+ 1028 302b FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 1028      FFF6FBFC 
+ 1028      FFF6FBFC 
+ 1028      FFF6FB
+ 1029 303a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377"
+ 1029      FCFFF6FB 
+ 1029      FCFF
+ 1030              		.globl	heatmap_cs_BuGn_discrete
+ 1031              		.section	.data.rel.local
+ 1032              		.align 8
+ 1033              		.type	heatmap_cs_BuGn_discrete, @object
+ 1034              		.size	heatmap_cs_BuGn_discrete, 8
+ 1035              	heatmap_cs_BuGn_discrete:
+ 1036 0018 00000000 		.quad	discrete
+ 1036      00000000 
+ 1037              		.section	.data.rel.ro.local
+ 1038              		.align 16
+ 1039              		.type	discrete, @object
+ 1040              		.size	discrete, 16
+ 1041              	discrete:
+ 1042 0030 00000000 		.quad	discrete_data
+ 1042      00000000 
+GAS LISTING /tmp/ccZQdzcl.s 			page 58
+
+
+ 1043 0038 0A000000 		.quad	10
+ 1043      00000000 
+ 1044              		.section	.rodata
+ 1045 3044 00000000 		.align 32
+ 1045      00000000 
+ 1045      00000000 
+ 1045      00000000 
+ 1045      00000000 
+ 1046              		.type	discrete_data, @object
+ 1047              		.size	discrete_data, 40
+ 1048              	discrete_data:
+ 1049 3060 00       		.string	""
+ 1050 3061 00       		.string	""
+ 1051 3062 00       		.string	""
+ 1052 3063 00       		.string	""
+ 1053 3064 00       		.string	""
+ 1054 3065 441BFF00 		.string	"D\033\377"
+ 1055 3069 6D2CFF23 		.ascii	"m,\377#\213E\377A\256v\377f\302\244\377\231\330\311\377\314\354"
+ 1055      8B45FF41 
+ 1055      AE76FF66 
+ 1055      C2A4FF99 
+ 1055      D8C9FFCC 
+ 1056 307e E6FFE5F5 		.ascii	"\346\377\345\365\371\377\367\374\375\377"
+ 1056      F9FFF7FC 
+ 1056      FDFF
+ 1057              		.text
+ 1058              	.Letext0:
+ 1059              		.file 1 "./heatmap.h"
+ 1060              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1061              		.file 3 "./colorschemes/BuGn.h"
+ 1062              		.file 4 "colorschemes/BuGn.c"
+ 1063              		.section	.debug_info,"",@progbits
+ 1064              	.Ldebug_info0:
+ 1065 0000 E3010000 		.long	0x1e3
+ 1066 0004 0500     		.value	0x5
+ 1067 0006 01       		.byte	0x1
+ 1068 0007 08       		.byte	0x8
+ 1069 0008 00000000 		.long	.Ldebug_abbrev0
+ 1070 000c 0A       		.uleb128 0xa
+ 1071 000d 00000000 		.long	.LASF26
+ 1072 0011 1D       		.byte	0x1d
+ 1073 0012 00000000 		.long	.LASF0
+ 1074 0016 00000000 		.long	.LASF1
+ 1075 001a 00000000 		.long	.Ldebug_line0
+ 1076 001e 01       		.uleb128 0x1
+ 1077 001f 08       		.byte	0x8
+ 1078 0020 05       		.byte	0x5
+ 1079 0021 00000000 		.long	.LASF2
+ 1080 0025 06       		.uleb128 0x6
+ 1081 0026 00000000 		.long	.LASF12
+ 1082 002a 02       		.byte	0x2
+ 1083 002b D6       		.byte	0xd6
+ 1084 002c 17       		.byte	0x17
+ 1085 002d 31000000 		.long	0x31
+ 1086 0031 01       		.uleb128 0x1
+ 1087 0032 08       		.byte	0x8
+ 1088 0033 07       		.byte	0x7
+GAS LISTING /tmp/ccZQdzcl.s 			page 59
+
+
+ 1089 0034 00000000 		.long	.LASF3
+ 1090 0038 0B       		.uleb128 0xb
+ 1091 0039 04       		.byte	0x4
+ 1092 003a 05       		.byte	0x5
+ 1093 003b 696E7400 		.string	"int"
+ 1094 003f 01       		.uleb128 0x1
+ 1095 0040 08       		.byte	0x8
+ 1096 0041 05       		.byte	0x5
+ 1097 0042 00000000 		.long	.LASF4
+ 1098 0046 01       		.uleb128 0x1
+ 1099 0047 10       		.byte	0x10
+ 1100 0048 04       		.byte	0x4
+ 1101 0049 00000000 		.long	.LASF5
+ 1102 004d 01       		.uleb128 0x1
+ 1103 004e 04       		.byte	0x4
+ 1104 004f 04       		.byte	0x4
+ 1105 0050 00000000 		.long	.LASF6
+ 1106 0054 01       		.uleb128 0x1
+ 1107 0055 04       		.byte	0x4
+ 1108 0056 07       		.byte	0x7
+ 1109 0057 00000000 		.long	.LASF7
+ 1110 005b 01       		.uleb128 0x1
+ 1111 005c 02       		.byte	0x2
+ 1112 005d 07       		.byte	0x7
+ 1113 005e 00000000 		.long	.LASF8
+ 1114 0062 0C       		.uleb128 0xc
+ 1115 0063 10       		.byte	0x10
+ 1116 0064 01       		.byte	0x1
+ 1117 0065 BB       		.byte	0xbb
+ 1118 0066 09       		.byte	0x9
+ 1119 0067 84000000 		.long	0x84
+ 1120 006b 07       		.uleb128 0x7
+ 1121 006c 00000000 		.long	.LASF9
+ 1122 0070 BC       		.byte	0xbc
+ 1123 0071 1A       		.byte	0x1a
+ 1124 0072 84000000 		.long	0x84
+ 1125 0076 00       		.byte	0
+ 1126 0077 07       		.uleb128 0x7
+ 1127 0078 00000000 		.long	.LASF10
+ 1128 007c BD       		.byte	0xbd
+ 1129 007d 0C       		.byte	0xc
+ 1130 007e 25000000 		.long	0x25
+ 1131 0082 08       		.byte	0x8
+ 1132 0083 00       		.byte	0
+ 1133 0084 08       		.uleb128 0x8
+ 1134 0085 90000000 		.long	0x90
+ 1135 0089 01       		.uleb128 0x1
+ 1136 008a 01       		.byte	0x1
+ 1137 008b 08       		.byte	0x8
+ 1138 008c 00000000 		.long	.LASF11
+ 1139 0090 03       		.uleb128 0x3
+ 1140 0091 89000000 		.long	0x89
+ 1141 0095 06       		.uleb128 0x6
+ 1142 0096 00000000 		.long	.LASF13
+ 1143 009a 01       		.byte	0x1
+ 1144 009b BE       		.byte	0xbe
+ 1145 009c 03       		.byte	0x3
+GAS LISTING /tmp/ccZQdzcl.s 			page 60
+
+
+ 1146 009d 62000000 		.long	0x62
+ 1147 00a1 03       		.uleb128 0x3
+ 1148 00a2 95000000 		.long	0x95
+ 1149 00a6 08       		.uleb128 0x8
+ 1150 00a7 A1000000 		.long	0xa1
+ 1151 00ab 04       		.uleb128 0x4
+ 1152 00ac 00000000 		.long	.LASF14
+ 1153 00b0 21       		.byte	0x21
+ 1154 00b1 A6000000 		.long	0xa6
+ 1155 00b5 04       		.uleb128 0x4
+ 1156 00b6 00000000 		.long	.LASF15
+ 1157 00ba 23       		.byte	0x23
+ 1158 00bb A6000000 		.long	0xa6
+ 1159 00bf 04       		.uleb128 0x4
+ 1160 00c0 00000000 		.long	.LASF16
+ 1161 00c4 25       		.byte	0x25
+ 1162 00c5 A6000000 		.long	0xa6
+ 1163 00c9 04       		.uleb128 0x4
+ 1164 00ca 00000000 		.long	.LASF17
+ 1165 00ce 28       		.byte	0x28
+ 1166 00cf A6000000 		.long	0xa6
+ 1167 00d3 09       		.uleb128 0x9
+ 1168 00d4 90000000 		.long	0x90
+ 1169 00d8 E3000000 		.long	0xe3
+ 1170 00dc 0D       		.uleb128 0xd
+ 1171 00dd 31000000 		.long	0x31
+ 1172 00e1 27       		.byte	0x27
+ 1173 00e2 00       		.byte	0
+ 1174 00e3 03       		.uleb128 0x3
+ 1175 00e4 D3000000 		.long	0xd3
+ 1176 00e8 02       		.uleb128 0x2
+ 1177 00e9 00000000 		.long	.LASF18
+ 1178 00ed 20       		.byte	0x20
+ 1179 00ee 1C       		.byte	0x1c
+ 1180 00ef E3000000 		.long	0xe3
+ 1181 00f3 09       		.uleb128 0x9
+ 1182 00f4 03       		.byte	0x3
+ 1183 00f5 00000000 		.quad	discrete_data
+ 1183      00000000 
+ 1184 00fd 02       		.uleb128 0x2
+ 1185 00fe 00000000 		.long	.LASF19
+ 1186 0102 23       		.byte	0x23
+ 1187 0103 24       		.byte	0x24
+ 1188 0104 A1000000 		.long	0xa1
+ 1189 0108 09       		.uleb128 0x9
+ 1190 0109 03       		.byte	0x3
+ 1191 010a 00000000 		.quad	discrete
+ 1191      00000000 
+ 1192 0112 05       		.uleb128 0x5
+ 1193 0113 AB000000 		.long	0xab
+ 1194 0117 24       		.byte	0x24
+ 1195 0118 09       		.uleb128 0x9
+ 1196 0119 03       		.byte	0x3
+ 1197 011a 00000000 		.quad	heatmap_cs_BuGn_discrete
+ 1197      00000000 
+ 1198 0122 09       		.uleb128 0x9
+ 1199 0123 90000000 		.long	0x90
+GAS LISTING /tmp/ccZQdzcl.s 			page 61
+
+
+ 1200 0127 33010000 		.long	0x133
+ 1201 012b 0E       		.uleb128 0xe
+ 1202 012c 31000000 		.long	0x31
+ 1203 0130 0310     		.value	0x1003
+ 1204 0132 00       		.byte	0
+ 1205 0133 03       		.uleb128 0x3
+ 1206 0134 22010000 		.long	0x122
+ 1207 0138 02       		.uleb128 0x2
+ 1208 0139 00000000 		.long	.LASF20
+ 1209 013d 26       		.byte	0x26
+ 1210 013e 1C       		.byte	0x1c
+ 1211 013f 33010000 		.long	0x133
+ 1212 0143 09       		.uleb128 0x9
+ 1213 0144 03       		.byte	0x3
+ 1214 0145 00000000 		.quad	soft_data
+ 1214      00000000 
+ 1215 014d 02       		.uleb128 0x2
+ 1216 014e 00000000 		.long	.LASF21
+ 1217 0152 29       		.byte	0x29
+ 1218 0153 24       		.byte	0x24
+ 1219 0154 A1000000 		.long	0xa1
+ 1220 0158 09       		.uleb128 0x9
+ 1221 0159 03       		.byte	0x3
+ 1222 015a 00000000 		.quad	soft
+ 1222      00000000 
+ 1223 0162 05       		.uleb128 0x5
+ 1224 0163 B5000000 		.long	0xb5
+ 1225 0167 2A       		.byte	0x2a
+ 1226 0168 09       		.uleb128 0x9
+ 1227 0169 03       		.byte	0x3
+ 1228 016a 00000000 		.quad	heatmap_cs_BuGn_soft
+ 1228      00000000 
+ 1229 0172 02       		.uleb128 0x2
+ 1230 0173 00000000 		.long	.LASF22
+ 1231 0177 2C       		.byte	0x2c
+ 1232 0178 1C       		.byte	0x1c
+ 1233 0179 33010000 		.long	0x133
+ 1234 017d 09       		.uleb128 0x9
+ 1235 017e 03       		.byte	0x3
+ 1236 017f 00000000 		.quad	mixed_data
+ 1236      00000000 
+ 1237 0187 02       		.uleb128 0x2
+ 1238 0188 00000000 		.long	.LASF23
+ 1239 018c 2F       		.byte	0x2f
+ 1240 018d 24       		.byte	0x24
+ 1241 018e A1000000 		.long	0xa1
+ 1242 0192 09       		.uleb128 0x9
+ 1243 0193 03       		.byte	0x3
+ 1244 0194 00000000 		.quad	mixed
+ 1244      00000000 
+ 1245 019c 05       		.uleb128 0x5
+ 1246 019d BF000000 		.long	0xbf
+ 1247 01a1 30       		.byte	0x30
+ 1248 01a2 09       		.uleb128 0x9
+ 1249 01a3 03       		.byte	0x3
+ 1250 01a4 00000000 		.quad	heatmap_cs_BuGn_mixed
+ 1250      00000000 
+GAS LISTING /tmp/ccZQdzcl.s 			page 62
+
+
+ 1251 01ac 02       		.uleb128 0x2
+ 1252 01ad 00000000 		.long	.LASF24
+ 1253 01b1 32       		.byte	0x32
+ 1254 01b2 1C       		.byte	0x1c
+ 1255 01b3 33010000 		.long	0x133
+ 1256 01b7 09       		.uleb128 0x9
+ 1257 01b8 03       		.byte	0x3
+ 1258 01b9 00000000 		.quad	mixed_exp_data
+ 1258      00000000 
+ 1259 01c1 02       		.uleb128 0x2
+ 1260 01c2 00000000 		.long	.LASF25
+ 1261 01c6 35       		.byte	0x35
+ 1262 01c7 24       		.byte	0x24
+ 1263 01c8 A1000000 		.long	0xa1
+ 1264 01cc 09       		.uleb128 0x9
+ 1265 01cd 03       		.byte	0x3
+ 1266 01ce 00000000 		.quad	mixed_exp
+ 1266      00000000 
+ 1267 01d6 05       		.uleb128 0x5
+ 1268 01d7 C9000000 		.long	0xc9
+ 1269 01db 36       		.byte	0x36
+ 1270 01dc 09       		.uleb128 0x9
+ 1271 01dd 03       		.byte	0x3
+ 1272 01de 00000000 		.quad	heatmap_cs_BuGn_mixed_exp
+ 1272      00000000 
+ 1273 01e6 00       		.byte	0
+ 1274              		.section	.debug_abbrev,"",@progbits
+ 1275              	.Ldebug_abbrev0:
+ 1276 0000 01       		.uleb128 0x1
+ 1277 0001 24       		.uleb128 0x24
+ 1278 0002 00       		.byte	0
+ 1279 0003 0B       		.uleb128 0xb
+ 1280 0004 0B       		.uleb128 0xb
+ 1281 0005 3E       		.uleb128 0x3e
+ 1282 0006 0B       		.uleb128 0xb
+ 1283 0007 03       		.uleb128 0x3
+ 1284 0008 0E       		.uleb128 0xe
+ 1285 0009 00       		.byte	0
+ 1286 000a 00       		.byte	0
+ 1287 000b 02       		.uleb128 0x2
+ 1288 000c 34       		.uleb128 0x34
+ 1289 000d 00       		.byte	0
+ 1290 000e 03       		.uleb128 0x3
+ 1291 000f 0E       		.uleb128 0xe
+ 1292 0010 3A       		.uleb128 0x3a
+ 1293 0011 21       		.uleb128 0x21
+ 1294 0012 04       		.sleb128 4
+ 1295 0013 3B       		.uleb128 0x3b
+ 1296 0014 0B       		.uleb128 0xb
+ 1297 0015 39       		.uleb128 0x39
+ 1298 0016 0B       		.uleb128 0xb
+ 1299 0017 49       		.uleb128 0x49
+ 1300 0018 13       		.uleb128 0x13
+ 1301 0019 02       		.uleb128 0x2
+ 1302 001a 18       		.uleb128 0x18
+ 1303 001b 00       		.byte	0
+ 1304 001c 00       		.byte	0
+GAS LISTING /tmp/ccZQdzcl.s 			page 63
+
+
+ 1305 001d 03       		.uleb128 0x3
+ 1306 001e 26       		.uleb128 0x26
+ 1307 001f 00       		.byte	0
+ 1308 0020 49       		.uleb128 0x49
+ 1309 0021 13       		.uleb128 0x13
+ 1310 0022 00       		.byte	0
+ 1311 0023 00       		.byte	0
+ 1312 0024 04       		.uleb128 0x4
+ 1313 0025 34       		.uleb128 0x34
+ 1314 0026 00       		.byte	0
+ 1315 0027 03       		.uleb128 0x3
+ 1316 0028 0E       		.uleb128 0xe
+ 1317 0029 3A       		.uleb128 0x3a
+ 1318 002a 21       		.uleb128 0x21
+ 1319 002b 03       		.sleb128 3
+ 1320 002c 3B       		.uleb128 0x3b
+ 1321 002d 0B       		.uleb128 0xb
+ 1322 002e 39       		.uleb128 0x39
+ 1323 002f 21       		.uleb128 0x21
+ 1324 0030 25       		.sleb128 37
+ 1325 0031 49       		.uleb128 0x49
+ 1326 0032 13       		.uleb128 0x13
+ 1327 0033 3F       		.uleb128 0x3f
+ 1328 0034 19       		.uleb128 0x19
+ 1329 0035 3C       		.uleb128 0x3c
+ 1330 0036 19       		.uleb128 0x19
+ 1331 0037 00       		.byte	0
+ 1332 0038 00       		.byte	0
+ 1333 0039 05       		.uleb128 0x5
+ 1334 003a 34       		.uleb128 0x34
+ 1335 003b 00       		.byte	0
+ 1336 003c 47       		.uleb128 0x47
+ 1337 003d 13       		.uleb128 0x13
+ 1338 003e 3A       		.uleb128 0x3a
+ 1339 003f 21       		.uleb128 0x21
+ 1340 0040 04       		.sleb128 4
+ 1341 0041 3B       		.uleb128 0x3b
+ 1342 0042 0B       		.uleb128 0xb
+ 1343 0043 39       		.uleb128 0x39
+ 1344 0044 21       		.uleb128 0x21
+ 1345 0045 1E       		.sleb128 30
+ 1346 0046 02       		.uleb128 0x2
+ 1347 0047 18       		.uleb128 0x18
+ 1348 0048 00       		.byte	0
+ 1349 0049 00       		.byte	0
+ 1350 004a 06       		.uleb128 0x6
+ 1351 004b 16       		.uleb128 0x16
+ 1352 004c 00       		.byte	0
+ 1353 004d 03       		.uleb128 0x3
+ 1354 004e 0E       		.uleb128 0xe
+ 1355 004f 3A       		.uleb128 0x3a
+ 1356 0050 0B       		.uleb128 0xb
+ 1357 0051 3B       		.uleb128 0x3b
+ 1358 0052 0B       		.uleb128 0xb
+ 1359 0053 39       		.uleb128 0x39
+ 1360 0054 0B       		.uleb128 0xb
+ 1361 0055 49       		.uleb128 0x49
+GAS LISTING /tmp/ccZQdzcl.s 			page 64
+
+
+ 1362 0056 13       		.uleb128 0x13
+ 1363 0057 00       		.byte	0
+ 1364 0058 00       		.byte	0
+ 1365 0059 07       		.uleb128 0x7
+ 1366 005a 0D       		.uleb128 0xd
+ 1367 005b 00       		.byte	0
+ 1368 005c 03       		.uleb128 0x3
+ 1369 005d 0E       		.uleb128 0xe
+ 1370 005e 3A       		.uleb128 0x3a
+ 1371 005f 21       		.uleb128 0x21
+ 1372 0060 01       		.sleb128 1
+ 1373 0061 3B       		.uleb128 0x3b
+ 1374 0062 0B       		.uleb128 0xb
+ 1375 0063 39       		.uleb128 0x39
+ 1376 0064 0B       		.uleb128 0xb
+ 1377 0065 49       		.uleb128 0x49
+ 1378 0066 13       		.uleb128 0x13
+ 1379 0067 38       		.uleb128 0x38
+ 1380 0068 0B       		.uleb128 0xb
+ 1381 0069 00       		.byte	0
+ 1382 006a 00       		.byte	0
+ 1383 006b 08       		.uleb128 0x8
+ 1384 006c 0F       		.uleb128 0xf
+ 1385 006d 00       		.byte	0
+ 1386 006e 0B       		.uleb128 0xb
+ 1387 006f 21       		.uleb128 0x21
+ 1388 0070 08       		.sleb128 8
+ 1389 0071 49       		.uleb128 0x49
+ 1390 0072 13       		.uleb128 0x13
+ 1391 0073 00       		.byte	0
+ 1392 0074 00       		.byte	0
+ 1393 0075 09       		.uleb128 0x9
+ 1394 0076 01       		.uleb128 0x1
+ 1395 0077 01       		.byte	0x1
+ 1396 0078 49       		.uleb128 0x49
+ 1397 0079 13       		.uleb128 0x13
+ 1398 007a 01       		.uleb128 0x1
+ 1399 007b 13       		.uleb128 0x13
+ 1400 007c 00       		.byte	0
+ 1401 007d 00       		.byte	0
+ 1402 007e 0A       		.uleb128 0xa
+ 1403 007f 11       		.uleb128 0x11
+ 1404 0080 01       		.byte	0x1
+ 1405 0081 25       		.uleb128 0x25
+ 1406 0082 0E       		.uleb128 0xe
+ 1407 0083 13       		.uleb128 0x13
+ 1408 0084 0B       		.uleb128 0xb
+ 1409 0085 03       		.uleb128 0x3
+ 1410 0086 1F       		.uleb128 0x1f
+ 1411 0087 1B       		.uleb128 0x1b
+ 1412 0088 1F       		.uleb128 0x1f
+ 1413 0089 10       		.uleb128 0x10
+ 1414 008a 17       		.uleb128 0x17
+ 1415 008b 00       		.byte	0
+ 1416 008c 00       		.byte	0
+ 1417 008d 0B       		.uleb128 0xb
+ 1418 008e 24       		.uleb128 0x24
+GAS LISTING /tmp/ccZQdzcl.s 			page 65
+
+
+ 1419 008f 00       		.byte	0
+ 1420 0090 0B       		.uleb128 0xb
+ 1421 0091 0B       		.uleb128 0xb
+ 1422 0092 3E       		.uleb128 0x3e
+ 1423 0093 0B       		.uleb128 0xb
+ 1424 0094 03       		.uleb128 0x3
+ 1425 0095 08       		.uleb128 0x8
+ 1426 0096 00       		.byte	0
+ 1427 0097 00       		.byte	0
+ 1428 0098 0C       		.uleb128 0xc
+ 1429 0099 13       		.uleb128 0x13
+ 1430 009a 01       		.byte	0x1
+ 1431 009b 0B       		.uleb128 0xb
+ 1432 009c 0B       		.uleb128 0xb
+ 1433 009d 3A       		.uleb128 0x3a
+ 1434 009e 0B       		.uleb128 0xb
+ 1435 009f 3B       		.uleb128 0x3b
+ 1436 00a0 0B       		.uleb128 0xb
+ 1437 00a1 39       		.uleb128 0x39
+ 1438 00a2 0B       		.uleb128 0xb
+ 1439 00a3 01       		.uleb128 0x1
+ 1440 00a4 13       		.uleb128 0x13
+ 1441 00a5 00       		.byte	0
+ 1442 00a6 00       		.byte	0
+ 1443 00a7 0D       		.uleb128 0xd
+ 1444 00a8 21       		.uleb128 0x21
+ 1445 00a9 00       		.byte	0
+ 1446 00aa 49       		.uleb128 0x49
+ 1447 00ab 13       		.uleb128 0x13
+ 1448 00ac 2F       		.uleb128 0x2f
+ 1449 00ad 0B       		.uleb128 0xb
+ 1450 00ae 00       		.byte	0
+ 1451 00af 00       		.byte	0
+ 1452 00b0 0E       		.uleb128 0xe
+ 1453 00b1 21       		.uleb128 0x21
+ 1454 00b2 00       		.byte	0
+ 1455 00b3 49       		.uleb128 0x49
+ 1456 00b4 13       		.uleb128 0x13
+ 1457 00b5 2F       		.uleb128 0x2f
+ 1458 00b6 05       		.uleb128 0x5
+ 1459 00b7 00       		.byte	0
+ 1460 00b8 00       		.byte	0
+ 1461 00b9 00       		.byte	0
+ 1462              		.section	.debug_aranges,"",@progbits
+ 1463 0000 1C000000 		.long	0x1c
+ 1464 0004 0200     		.value	0x2
+ 1465 0006 00000000 		.long	.Ldebug_info0
+ 1466 000a 08       		.byte	0x8
+ 1467 000b 00       		.byte	0
+ 1468 000c 0000     		.value	0
+ 1469 000e 0000     		.value	0
+ 1470 0010 00000000 		.quad	0
+ 1470      00000000 
+ 1471 0018 00000000 		.quad	0
+ 1471      00000000 
+ 1472              		.section	.debug_line,"",@progbits
+ 1473              	.Ldebug_line0:
+GAS LISTING /tmp/ccZQdzcl.s 			page 66
+
+
+ 1474 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1474      05000800 
+ 1474      49000000 
+ 1474      010101FB 
+ 1474      0E0D0001 
+ 1475              	.LASF20:
+ 1476 0000 736F6674 		.string	"soft_data"
+ 1476      5F646174 
+ 1476      6100
+ 1477              	.LASF12:
+ 1478 000a 73697A65 		.string	"size_t"
+ 1478      5F7400
+ 1479              	.LASF13:
+ 1480 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1480      6D61705F 
+ 1480      636F6C6F 
+ 1480      72736368 
+ 1480      656D655F 
+ 1481              	.LASF15:
+ 1482 0027 68656174 		.string	"heatmap_cs_BuGn_soft"
+ 1482      6D61705F 
+ 1482      63735F42 
+ 1482      75476E5F 
+ 1482      736F6674 
+ 1483              	.LASF26:
+ 1484 003c 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1484      43313720 
+ 1484      31322E32 
+ 1484      2E30202D 
+ 1484      6D74756E 
+ 1485              	.LASF6:
+ 1486 009b 666C6F61 		.string	"float"
+ 1486      7400
+ 1487              	.LASF16:
+ 1488 00a1 68656174 		.string	"heatmap_cs_BuGn_mixed"
+ 1488      6D61705F 
+ 1488      63735F42 
+ 1488      75476E5F 
+ 1488      6D697865 
+ 1489              	.LASF11:
+ 1490 00b7 756E7369 		.string	"unsigned char"
+ 1490      676E6564 
+ 1490      20636861 
+ 1490      7200
+ 1491              	.LASF17:
+ 1492 00c5 68656174 		.string	"heatmap_cs_BuGn_mixed_exp"
+ 1492      6D61705F 
+ 1492      63735F42 
+ 1492      75476E5F 
+ 1492      6D697865 
+ 1493              	.LASF3:
+ 1494 00df 6C6F6E67 		.string	"long unsigned int"
+ 1494      20756E73 
+ 1494      69676E65 
+ 1494      6420696E 
+ 1494      7400
+ 1495              	.LASF8:
+GAS LISTING /tmp/ccZQdzcl.s 			page 67
+
+
+ 1496 00f1 73686F72 		.string	"short unsigned int"
+ 1496      7420756E 
+ 1496      7369676E 
+ 1496      65642069 
+ 1496      6E7400
+ 1497              	.LASF25:
+ 1498 0104 6D697865 		.string	"mixed_exp"
+ 1498      645F6578 
+ 1498      7000
+ 1499              	.LASF23:
+ 1500 010e 6D697865 		.string	"mixed"
+ 1500      6400
+ 1501              	.LASF14:
+ 1502 0114 68656174 		.string	"heatmap_cs_BuGn_discrete"
+ 1502      6D61705F 
+ 1502      63735F42 
+ 1502      75476E5F 
+ 1502      64697363 
+ 1503              	.LASF7:
+ 1504 012d 756E7369 		.string	"unsigned int"
+ 1504      676E6564 
+ 1504      20696E74 
+ 1504      00
+ 1505              	.LASF19:
+ 1506 013a 64697363 		.string	"discrete"
+ 1506      72657465 
+ 1506      00
+ 1507              	.LASF10:
+ 1508 0143 6E636F6C 		.string	"ncolors"
+ 1508      6F727300 
+ 1509              	.LASF4:
+ 1510 014b 6C6F6E67 		.string	"long long int"
+ 1510      206C6F6E 
+ 1510      6720696E 
+ 1510      7400
+ 1511              	.LASF24:
+ 1512 0159 6D697865 		.string	"mixed_exp_data"
+ 1512      645F6578 
+ 1512      705F6461 
+ 1512      746100
+ 1513              	.LASF22:
+ 1514 0168 6D697865 		.string	"mixed_data"
+ 1514      645F6461 
+ 1514      746100
+ 1515              	.LASF2:
+ 1516 0173 6C6F6E67 		.string	"long int"
+ 1516      20696E74 
+ 1516      00
+ 1517              	.LASF5:
+ 1518 017c 6C6F6E67 		.string	"long double"
+ 1518      20646F75 
+ 1518      626C6500 
+ 1519              	.LASF18:
+ 1520 0188 64697363 		.string	"discrete_data"
+ 1520      72657465 
+ 1520      5F646174 
+ 1520      6100
+GAS LISTING /tmp/ccZQdzcl.s 			page 68
+
+
+ 1521              	.LASF21:
+ 1522 0196 736F6674 		.string	"soft"
+ 1522      00
+ 1523              	.LASF9:
+ 1524 019b 636F6C6F 		.string	"colors"
+ 1524      727300
+ 1525              		.section	.debug_line_str,"MS",@progbits,1
+ 1526              	.LASF0:
+ 1527 0000 636F6C6F 		.string	"colorschemes/BuGn.c"
+ 1527      72736368 
+ 1527      656D6573 
+ 1527      2F427547 
+ 1527      6E2E6300 
+ 1528              	.LASF1:
+ 1529 0014 2F726F6F 		.string	"/root/repo"
+ 1529      742F7265 
+ 1529      706F00
+ 1530              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1531 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1531      742F7265 
+ 1531      706F0063 
+ 1531      6F6C6F72 
+ 1531      73636865 
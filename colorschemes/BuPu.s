@@ -0,0 +1,4127 @@
+GAS LISTING /tmp/cceXHuAj.s 			page 1
+
+
+   1              		.file	"BuPu.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/BuPu.c"
+   5              		.globl	heatmap_cs_BuPu_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_BuPu_mixed_exp, @object
+   9              		.size	heatmap_cs_BuPu_mixed_exp, 8
+  10              	heatmap_cs_BuPu_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 4C00     		.string	"L"
+  29 0006 4B00     		.string	"K"
+  30 0008 5000     		.string	"P"
+  31 000a 4D185301 		.ascii	"M\030S\001P1V\001SJY\002Vc\\\003Y|_\004\\\225l\007i\256p\bl\307"
+  31      50315601 
+  31      534A5902 
+  31      56635C03 
+  31      597C5F04 
+  32 0028 73096EE0 		.ascii	"s\tn\340v\013q\371y\ft\377|\rw\377\177\016z\377\201\020|\377"
+  32      760B71F9 
+  32      790C74FF 
+  32      7C0D77FF 
+  32      7F0E7AFF 
+  33 0040 81157EFF 		.ascii	"\201\025~\377\202\030\200\377\202\033\202\377\202\036\204\377"
+  33      821880FF 
+  33      821B82FF 
+  33      821E84FF 
+  34 0050 832185FF 		.ascii	"\203!\205\377\203$\207\377\203&\211\377\2052\221\377\2064\223"
+  34      832487FF 
+  34      832689FF 
+  34      853291FF 
+  34      863493
+  35 0063 FF863795 		.ascii	"\377\2067\225\377\2069\226\377\207;\230\377\207=\231\377\207"
+  35      FF863996 
+  35      FF873B98 
+  35      FF873D99 
+  35      FF87
+GAS LISTING /tmp/cceXHuAj.s 			page 2
+
+
+  36 0075 3F9BFF87 		.ascii	"?\233\377\207@\234\377\210C\236\377\210E\237\377\210G\240\377"
+  36      409CFF88 
+  36      439EFF88 
+  36      459FFF88 
+  36      47A0FF
+  37 0088 8849A1FF 		.ascii	"\210I\241\377\210K\242\377\210M\243\377\210O\244\377\210Q\245"
+  37      884BA2FF 
+  37      884DA3FF 
+  37      884FA4FF 
+  37      8851A5
+  38 009b FF895BAA 		.ascii	"\377\211[\252\377\212]\253\377\212_\253\377\212a\254\377\212"
+  38      FF8A5DAB 
+  38      FF8A5FAB 
+  38      FF8A61AC 
+  38      FF8A
+  39 00ad 62ADFF8A 		.ascii	"b\255\377\212d\256\377\213f\256\377\213g\257\377\213i\260\377"
+  39      64AEFF8B 
+  39      66AEFF8B 
+  39      67AFFF8B 
+  39      69B0FF
+  40 00c0 8B6AB0FF 		.ascii	"\213j\260\377\213l\262\377\213n\263\377\212p\264\377\212r\265"
+  40      8B6CB2FF 
+  40      8B6EB3FF 
+  40      8A70B4FF 
+  40      8A72B5
+  41 00d3 FF8A74B6 		.ascii	"\377\212t\266\377\212u\267\377\211w\270\377\211y\271\377\211"
+  41      FF8A75B7 
+  41      FF8977B8 
+  41      FF8979B9 
+  41      FF89
+  42 00e5 7BBAFF89 		.ascii	"{\272\377\211|\273\377\211\206\300\377\211\210\300\377\211\211"
+  42      7CBBFF89 
+  42      86C0FF89 
+  42      88C0FF89 
+  42      89
+  43 00f6 C1FF898B 		.ascii	"\301\377\211\213\302\377\211\214\302\377\212\216\303\377\212"
+  43      C2FF898C 
+  43      C2FF8A8E 
+  43      C3FF8A
+  44 0105 8FC3FF8A 		.ascii	"\217\303\377\212\221\304\377\212\222\304\377\213\223\305\377"
+  44      91C4FF8A 
+  44      92C4FF8B 
+  44      93C5FF
+  45 0114 8B95C5FF 		.ascii	"\213\225\305\377\214\226\306\377\214\227\307\377\214\231\307"
+  45      8C96C6FF 
+  45      8C97C7FF 
+  45      8C99C7
+  46 0123 FF8C9AC8 		.ascii	"\377\214\232\310\377\215\233\311\377\215\234\312\377\216\236"
+  46      FF8D9BC9 
+  46      FF8D9CCA 
+  46      FF8E9E
+  47 0132 CAFF8E9F 		.ascii	"\312\377\216\237\313\377\216\240\314\377\217\241\314\377\217"
+  47      CBFF8EA0 
+  47      CCFF8FA1 
+  47      CCFF8F
+  48 0141 A2CDFF90 		.ascii	"\242\315\377\220\244\316\377\220\245\316\377\224\256\323\377"
+  48      A4CEFF90 
+GAS LISTING /tmp/cceXHuAj.s 			page 3
+
+
+  48      A5CEFF94 
+  48      AED3FF
+  49 0150 95AFD3FF 		.ascii	"\225\257\323\377\226\260\324\377\226\261\324\377\227\262\325"
+  49      96B0D4FF 
+  49      96B1D4FF 
+  49      97B2D5
+  50 015f FF97B3D6 		.ascii	"\377\227\263\326\377\230\264\326\377\231\265\327\377\231\266"
+  50      FF98B4D6 
+  50      FF99B5D7 
+  50      FF99B6
+  51 016e D7FF9AB7 		.ascii	"\327\377\232\267\327\377\233\270\330\377\234\271\330\377\234"
+  51      D7FF9BB8 
+  51      D8FF9CB9 
+  51      D8FF9C
+  52 017d BAD9FF9D 		.ascii	"\272\331\377\235\273\331\377\236\274\332\377\237\274\332\377"
+  52      BBD9FF9E 
+  52      BCDAFF9F 
+  52      BCDAFF
+  53 018c 9FBDDAFF 		.ascii	"\237\275\332\377\240\275\333\377\241\276\333\377\242\277\333"
+  53      A0BDDBFF 
+  53      A1BEDBFF 
+  53      A2BFDB
+  54 019b FFA3BFDB 		.ascii	"\377\243\277\333\377\243\300\334\377\244\300\334\377\245\301"
+  54      FFA3C0DC 
+  54      FFA4C0DC 
+  54      FFA5C1
+  55 01aa DCFFA6C1 		.ascii	"\334\377\246\301\335\377\247\302\335\377\247\302\335\377\250"
+  55      DDFFA7C2 
+  55      DDFFA7C2 
+  55      DDFFA8
+  56 01b9 C3DDFFA9 		.ascii	"\303\335\377\251\303\336\377\252\304\336\377\252\304\336\377"
+  56      C3DEFFAA 
+  56      C4DEFFAA 
+  56      C4DEFF
+  57 01c8 B2CAE1FF 		.ascii	"\262\312\341\377\262\312\341\377\263\313\341\377\264\313\342"
+  57      B2CAE1FF 
+  57      B3CBE1FF 
+  57      B4CBE2
+  58 01d7 FFB4CCE2 		.ascii	"\377\264\314\342\377\265\314\342\377\266\314\342\377\267\315"
+  58      FFB5CCE2 
+  58      FFB6CCE2 
+  58      FFB7CD
+  59 01e6 E3FFB7CD 		.ascii	"\343\377\267\315\343\377\270\316\343\377\271\316\343\377\271"
+  59      E3FFB8CE 
+  59      E3FFB9CE 
+  59      E3FFB9
+  60 01f5 CFE4FFBA 		.ascii	"\317\344\377\272\317\344\377\272\320\344\377\273\320\344\377"
+  60      CFE4FFBA 
+  60      D0E4FFBB 
+  60      D0E4FF
+  61 0204 BCD1E4FF 		.ascii	"\274\321\344\377\274\321\345\377\275\321\345\377\276\322\345"
+  61      BCD1E5FF 
+  61      BDD1E5FF 
+  61      BED2E5
+  62 0213 FFBED2E5 		.ascii	"\377\276\322\345\377\277\323\346\377\277\323\346\377\300\324"
+  62      FFBFD3E6 
+  62      FFBFD3E6 
+GAS LISTING /tmp/cceXHuAj.s 			page 4
+
+
+  62      FFC0D4
+  63 0222 E6FFC0D4 		.ascii	"\346\377\300\324\346\377\301\324\347\377\301\325\347\377\302"
+  63      E6FFC1D4 
+  63      E7FFC1D5 
+  63      E7FFC2
+  64 0231 D5E7FFC2 		.ascii	"\325\347\377\302\326\347\377\303\326\347\377\304\327\350\377"
+  64      D6E7FFC3 
+  64      D6E7FFC4 
+  64      D7E8FF
+  65 0240 C4D7E8FF 		.ascii	"\304\327\350\377\305\327\350\377\305\330\350\377\306\330\351"
+  65      C5D7E8FF 
+  65      C5D8E8FF 
+  65      C6D8E9
+  66 024f FFC6D9E9 		.ascii	"\377\306\331\351\377\307\331\351\377\307\331\351\377\310\332"
+  66      FFC7D9E9 
+  66      FFC7D9E9 
+  66      FFC8DA
+  67 025e E9FFC8DA 		.ascii	"\351\377\310\332\352\377\310\332\352\377\311\333\352\377\311"
+  67      EAFFC8DA 
+  67      EAFFC9DB 
+  67      EAFFC9
+  68 026d DBEAFFCA 		.ascii	"\333\352\377\312\334\352\377\312\334\353\377\313\334\353\377"
+  68      DCEAFFCA 
+  68      DCEBFFCB 
+  68      DCEBFF
+  69 027c D2E2EEFF 		.ascii	"\322\342\356\377\322\342\356\377\323\342\356\377\323\343\356"
+  69      D2E2EEFF 
+  69      D3E2EEFF 
+  69      D3E3EE
+  70 028b FFD4E3EF 		.ascii	"\377\324\343\357\377\324\343\357\377\325\344\357\377\325\344"
+  70      FFD4E3EF 
+  70      FFD5E4EF 
+  70      FFD5E4
+  71 029a EFFFD5E4 		.ascii	"\357\377\325\344\357\377\326\345\357\377\326\345\360\377\327"
+  71      EFFFD6E5 
+  71      EFFFD6E5 
+  71      F0FFD7
+  72 02a9 E5F0FFD7 		.ascii	"\345\360\377\327\346\360\377\330\346\360\377\330\346\360\377"
+  72      E6F0FFD8 
+  72      E6F0FFD8 
+  72      E6F0FF
+  73 02b8 D8E6F1FF 		.ascii	"\330\346\361\377\331\347\361\377\331\347\361\377\332\347\361"
+  73      D9E7F1FF 
+  73      D9E7F1FF 
+  73      DAE7F1
+  74 02c7 FFDAE8F1 		.ascii	"\377\332\350\361\377\332\350\361\377\333\350\362\377\333\350"
+  74      FFDAE8F1 
+  74      FFDBE8F2 
+  74      FFDBE8
+  75 02d6 F2FFDBE9 		.ascii	"\362\377\333\351\362\377\334\351\362\377\334\351\362\377\335"
+  75      F2FFDCE9 
+  75      F2FFDCE9 
+  75      F2FFDD
+  76 02e5 E9F2FFDD 		.ascii	"\351\362\377\335\352\362\377\335\352\363\377\336\352\363\377"
+  76      EAF2FFDD 
+  76      EAF3FFDE 
+  76      EAF3FF
+GAS LISTING /tmp/cceXHuAj.s 			page 5
+
+
+  77 02f4 DEEAF3FF 		.ascii	"\336\352\363\377\336\353\363\377\337\353\363\377\337\353\363"
+  77      DEEBF3FF 
+  77      DFEBF3FF 
+  77      DFEBF3
+  78 0303 FFDFEBF3 		.ascii	"\377\337\353\363\377\340\354\364\377\340\354\364\377\340\354"
+  78      FFE0ECF4 
+  78      FFE0ECF4 
+  78      FFE0EC
+  79 0312 F4FFE0EC 		.ascii	"\364\377\340\354\364\377\340\354\364\377\341\354\364\377\341"
+  79      F4FFE0EC 
+  79      F4FFE1EC 
+  79      F4FFE1
+  80 0321 EDF4FFE1 		.ascii	"\355\364\377\341\355\364\377\341\355\364\377\341\355\364\377"
+  80      EDF4FFE1 
+  80      EDF4FFE1 
+  80      EDF4FF
+  81 0330 E1EDF4FF 		.ascii	"\341\355\364\377\342\355\364\377\342\355\364\377\342\356\364"
+  81      E2EDF4FF 
+  81      E2EDF4FF 
+  81      E2EEF4
+  82 033f FFE2EEF5 		.ascii	"\377\342\356\365\377\342\356\365\377\342\356\365\377\343\356"
+  82      FFE2EEF5 
+  82      FFE2EEF5 
+  82      FFE3EE
+  83 034e F5FFE3EE 		.ascii	"\365\377\343\356\365\377\343\356\365\377\343\356\365\377\343"
+  83      F5FFE3EE 
+  83      F5FFE3EE 
+  83      F5FFE3
+  84 035d EFF5FFE3 		.ascii	"\357\365\377\343\357\365\377\344\357\365\377\344\357\365\377"
+  84      EFF5FFE4 
+  84      EFF5FFE4 
+  84      EFF5FF
+  85 036c E4EFF5FF 		.ascii	"\344\357\365\377\344\357\365\377\344\357\365\377\344\357\365"
+  85      E4EFF5FF 
+  85      E4EFF5FF 
+  85      E4EFF5
+  86 037b FFE5F0F5 		.ascii	"\377\345\360\365\377\345\360\365\377\345\360\366\377\345\360"
+  86      FFE5F0F5 
+  86      FFE5F0F6 
+  86      FFE5F0
+  87 038a F6FFE5F0 		.ascii	"\366\377\345\360\366\377\345\360\366\377\345\360\366\377\346"
+  87      F6FFE5F0 
+  87      F6FFE5F0 
+  87      F6FFE6
+  88 0399 F0F6FFE6 		.ascii	"\360\366\377\346\360\366\377\346\361\366\377\346\361\366\377"
+  88      F0F6FFE6 
+  88      F1F6FFE6 
+  88      F1F6FF
+  89 03a8 E6F1F6FF 		.ascii	"\346\361\366\377\346\361\366\377\346\361\366\377\347\361\366"
+  89      E6F1F6FF 
+  89      E6F1F6FF 
+  89      E7F1F6
+  90 03b7 FFE7F1F6 		.ascii	"\377\347\361\366\377\347\361\366\377\347\361\366\377\347\361"
+  90      FFE7F1F6 
+  90      FFE7F1F6 
+  90      FFE7F1
+  91 03c6 F6FFE7F1 		.ascii	"\366\377\347\361\366\377\347\362\366\377\347\362\367\377\350"
+GAS LISTING /tmp/cceXHuAj.s 			page 6
+
+
+  91      F6FFE7F2 
+  91      F6FFE7F2 
+  91      F7FFE8
+  92 03d5 F2F7FFE8 		.ascii	"\362\367\377\350\362\367\377\350\362\367\377\350\362\367\377"
+  92      F2F7FFE8 
+  92      F2F7FFE8 
+  92      F2F7FF
+  93 03e4 EDF5F9FF 		.ascii	"\355\365\371\377\355\365\371\377\355\365\371\377\355\366\371"
+  93      EDF5F9FF 
+  93      EDF5F9FF 
+  93      EDF6F9
+  94 03f3 FFEDF6F9 		.ascii	"\377\355\366\371\377\355\366\371\377\355\366\371\377\356\366"
+  94      FFEDF6F9 
+  94      FFEDF6F9 
+  94      FFEEF6
+  95 0402 F9FFEEF6 		.ascii	"\371\377\356\366\371\377\356\366\371\377\356\366\371\377\356"
+  95      F9FFEEF6 
+  95      F9FFEEF6 
+  95      F9FFEE
+  96 0411 F6F9FFEE 		.ascii	"\366\371\377\356\366\371\377\356\366\371\377\356\366\371\377"
+  96      F6F9FFEE 
+  96      F6F9FFEE 
+  96      F6F9FF
+  97 0420 EEF6F9FF 		.ascii	"\356\366\371\377\356\366\371\377\357\367\371\377\357\367\371"
+  97      EEF6F9FF 
+  97      EFF7F9FF 
+  97      EFF7F9
+  98 042f FFEFF7F9 		.ascii	"\377\357\367\371\377\357\367\371\377\357\367\371\377\357\367"
+  98      FFEFF7F9 
+  98      FFEFF7F9 
+  98      FFEFF7
+  99 043e F9FFEFF7 		.ascii	"\371\377\357\367\371\377\357\367\372\377\357\367\372\377\357"
+  99      F9FFEFF7 
+  99      FAFFEFF7 
+  99      FAFFEF
+ 100 044d F7FAFFF0 		.ascii	"\367\372\377\360\367\372\377\360\367\372\377\360\367\372\377"
+ 100      F7FAFFF0 
+ 100      F7FAFFF0 
+ 100      F7FAFF
+ 101 045c F0F7FAFF 		.ascii	"\360\367\372\377\360\367\372\377\360\367\372\377\360\370\372"
+ 101      F0F7FAFF 
+ 101      F0F7FAFF 
+ 101      F0F8FA
+ 102 046b FFF0F8FA 		.ascii	"\377\360\370\372\377\360\370\372\377\360\370\372\377\360\370"
+ 102      FFF0F8FA 
+ 102      FFF0F8FA 
+ 102      FFF0F8
+ 103 047a FAFFF0F8 		.ascii	"\372\377\360\370\372\377\361\370\372\377\361\370\372\377\361"
+ 103      FAFFF1F8 
+ 103      FAFFF1F8 
+ 103      FAFFF1
+ 104 0489 F8FAFFF1 		.ascii	"\370\372\377\361\370\372\377\361\370\372\377\361\370\372\377"
+ 104      F8FAFFF1 
+ 104      F8FAFFF1 
+ 104      F8FAFF
+ 105 0498 F1F8FAFF 		.ascii	"\361\370\372\377\361\370\372\377\361\370\372\377\361\370\372"
+ 105      F1F8FAFF 
+GAS LISTING /tmp/cceXHuAj.s 			page 7
+
+
+ 105      F1F8FAFF 
+ 105      F1F8FA
+ 106 04a7 FFF1F8FA 		.ascii	"\377\361\370\372\377\361\370\372\377\361\370\372\377\361\370"
+ 106      FFF1F8FA 
+ 106      FFF1F8FA 
+ 106      FFF1F8
+ 107 04b6 FAFFF2F8 		.ascii	"\372\377\362\370\372\377\362\371\372\377\362\371\372\377\362"
+ 107      FAFFF2F9 
+ 107      FAFFF2F9 
+ 107      FAFFF2
+ 108 04c5 F9FBFFF2 		.ascii	"\371\373\377\362\371\373\377\362\371\373\377\362\371\373\377"
+ 108      F9FBFFF2 
+ 108      F9FBFFF2 
+ 108      F9FBFF
+ 109 04d4 F2F9FBFF 		.ascii	"\362\371\373\377\362\371\373\377\362\371\373\377\362\371\373"
+ 109      F2F9FBFF 
+ 109      F2F9FBFF 
+ 109      F2F9FB
+ 110 04e3 FFF2F9FB 		.ascii	"\377\362\371\373\377\362\371\373\377\362\371\373\377\362\371"
+ 110      FFF2F9FB 
+ 110      FFF2F9FB 
+ 110      FFF2F9
+ 111 04f2 FBFFF2F9 		.ascii	"\373\377\362\371\373\377\363\371\373\377\363\371\373\377\363"
+ 111      FBFFF3F9 
+ 111      FBFFF3F9 
+ 111      FBFFF3
+ 112 0501 F9FBFFF3 		.ascii	"\371\373\377\363\371\373\377\363\371\373\377\363\371\373\377"
+ 112      F9FBFFF3 
+ 112      F9FBFFF3 
+ 112      F9FBFF
+ 113 0510 F3F9FBFF 		.ascii	"\363\371\373\377\363\371\373\377\363\371\373\377\363\371\373"
+ 113      F3F9FBFF 
+ 113      F3F9FBFF 
+ 113      F3F9FB
+ 114 051f FFF3F9FB 		.ascii	"\377\363\371\373\377\363\371\373\377\363\371\373\377\363\372"
+ 114      FFF3F9FB 
+ 114      FFF3F9FB 
+ 114      FFF3FA
+ 115 052e FBFFF3FA 		.ascii	"\373\377\363\372\373\377\363\372\373\377\363\372\373\377\363"
+ 115      FBFFF3FA 
+ 115      FBFFF3FA 
+ 115      FBFFF3
+ 116 053d FAFBFFF3 		.ascii	"\372\373\377\363\372\373\377\363\372\373\377\364\372\373\377"
+ 116      FAFBFFF3 
+ 116      FAFBFFF4 
+ 116      FAFBFF
+ 117 054c F4FAFBFF 		.ascii	"\364\372\373\377\364\372\373\377\364\372\373\377\364\372\373"
+ 117      F4FAFBFF 
+ 117      F4FAFBFF 
+ 117      F4FAFB
+ 118 055b FFF4FAFB 		.ascii	"\377\364\372\373\377\364\372\373\377\364\372\373\377\364\372"
+ 118      FFF4FAFB 
+ 118      FFF4FAFB 
+ 118      FFF4FA
+ 119 056a FBFFF4FA 		.ascii	"\373\377\364\372\373\377\364\372\373\377\364\372\373\377\364"
+ 119      FBFFF4FA 
+ 119      FBFFF4FA 
+GAS LISTING /tmp/cceXHuAj.s 			page 8
+
+
+ 119      FBFFF4
+ 120 0579 FAFBFFF4 		.ascii	"\372\373\377\364\372\373\377\364\372\373\377\364\372\373\377"
+ 120      FAFBFFF4 
+ 120      FAFBFFF4 
+ 120      FAFBFF
+ 121 0588 F4FAFBFF 		.ascii	"\364\372\373\377\364\372\373\377\364\372\374\377\364\372\374"
+ 121      F4FAFBFF 
+ 121      F4FAFCFF 
+ 121      F4FAFC
+ 122 0597 FFF4FAFC 		.ascii	"\377\364\372\374\377\364\372\374\377\364\372\374\377\364\372"
+ 122      FFF4FAFC 
+ 122      FFF4FAFC 
+ 122      FFF4FA
+ 123 05a6 FCFFF4FA 		.ascii	"\374\377\364\372\374\377\364\372\374\377\364\372\374\377\364"
+ 123      FCFFF4FA 
+ 123      FCFFF4FA 
+ 123      FCFFF4
+ 124 05b5 FAFCFFF5 		.ascii	"\372\374\377\365\372\374\377\365\372\374\377\365\372\374\377"
+ 124      FAFCFFF5 
+ 124      FAFCFFF5 
+ 124      FAFCFF
+ 125 05c4 F5FAFCFF 		.ascii	"\365\372\374\377\365\372\374\377\365\372\374\377\365\372\374"
+ 125      F5FAFCFF 
+ 125      F5FAFCFF 
+ 125      F5FAFC
+ 126 05d3 FFF5FAFC 		.ascii	"\377\365\372\374\377\365\372\374\377\365\372\374\377\365\372"
+ 126      FFF5FAFC 
+ 126      FFF5FAFC 
+ 126      FFF5FA
+ 127 05e2 FCFFF5FA 		.ascii	"\374\377\365\372\374\377\365\373\374\377\365\373\374\377\365"
+ 127      FCFFF5FB 
+ 127      FCFFF5FB 
+ 127      FCFFF5
+ 128 05f1 FBFCFFF5 		.ascii	"\373\374\377\365\373\374\377\365\373\374\377\365\373\374\377"
+ 128      FBFCFFF5 
+ 128      FBFCFFF5 
+ 128      FBFCFF
+ 129 0600 F5FBFCFF 		.ascii	"\365\373\374\377\365\373\374\377\365\373\374\377\365\373\374"
+ 129      F5FBFCFF 
+ 129      F5FBFCFF 
+ 129      F5FBFC
+ 130 060f FFF5FBFC 		.ascii	"\377\365\373\374\377\365\373\374\377\365\373\374\377\365\373"
+ 130      FFF5FBFC 
+ 130      FFF5FBFC 
+ 130      FFF5FB
+ 131 061e FCFFF5FB 		.ascii	"\374\377\365\373\374\377\365\373\374\377\365\373\374\377\365"
+ 131      FCFFF5FB 
+ 131      FCFFF5FB 
+ 131      FCFFF5
+ 132 062d FBFCFFF5 		.ascii	"\373\374\377\365\373\374\377\365\373\374\377\365\373\374\377"
+ 132      FBFCFFF5 
+ 132      FBFCFFF5 
+ 132      FBFCFF
+ 133 063c F5FBFCFF 		.ascii	"\365\373\374\377\365\373\374\377\365\373\374\377\365\373\374"
+ 133      F5FBFCFF 
+ 133      F5FBFCFF 
+ 133      F5FBFC
+GAS LISTING /tmp/cceXHuAj.s 			page 9
+
+
+ 134 064b FFF5FBFC 		.ascii	"\377\365\373\374\377\365\373\374\377\365\373\374\377\365\373"
+ 134      FFF5FBFC 
+ 134      FFF5FBFC 
+ 134      FFF5FB
+ 135 065a FCFFF5FB 		.ascii	"\374\377\365\373\374\377\365\373\374\377\365\373\374\377\366"
+ 135      FCFFF5FB 
+ 135      FCFFF5FB 
+ 135      FCFFF6
+ 136 0669 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 136      FBFCFFF6 
+ 136      FBFCFFF6 
+ 136      FBFCFF
+ 137 0678 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 137      F6FBFCFF 
+ 137      F6FBFCFF 
+ 137      F6FBFC
+ 138 0687 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 138      FFF6FBFC 
+ 138      FFF6FBFC 
+ 138      FFF6FB
+ 139 0696 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 139      FCFFF6FB 
+ 139      FCFFF6FB 
+ 139      FCFFF6
+ 140 06a5 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 140      FBFCFFF6 
+ 140      FBFCFFF6 
+ 140      FBFCFF
+ 141 06b4 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 141      F6FBFCFF 
+ 141      F6FBFCFF 
+ 141      F6FBFC
+ 142 06c3 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 142      FFF6FBFC 
+ 142      FFF6FBFC 
+ 142      FFF6FB
+ 143 06d2 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 143      FCFFF6FB 
+ 143      FCFFF6FB 
+ 143      FCFFF6
+ 144 06e1 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 144      FBFCFFF6 
+ 144      FBFCFFF6 
+ 144      FBFCFF
+ 145 06f0 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 145      F6FBFCFF 
+ 145      F6FBFCFF 
+ 145      F6FBFC
+ 146 06ff FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 146      FFF6FBFC 
+ 146      FFF6FBFC 
+ 146      FFF6FB
+ 147 070e FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 147      FCFFF6FB 
+ 147      FCFFF6FB 
+ 147      FCFFF6
+ 148 071d FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+GAS LISTING /tmp/cceXHuAj.s 			page 10
+
+
+ 148      FBFCFFF6 
+ 148      FBFCFFF6 
+ 148      FBFCFF
+ 149 072c F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 149      F6FBFCFF 
+ 149      F6FBFCFF 
+ 149      F6FBFC
+ 150 073b FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 150      FFF6FBFC 
+ 150      FFF6FBFC 
+ 150      FFF6FB
+ 151 074a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 151      FCFFF6FB 
+ 151      FCFFF6FB 
+ 151      FCFFF6
+ 152 0759 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 152      FBFCFFF6 
+ 152      FBFCFFF6 
+ 152      FBFCFF
+ 153 0768 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 153      F6FBFCFF 
+ 153      F6FBFCFF 
+ 153      F6FBFC
+ 154 0777 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 154      FFF6FBFC 
+ 154      FFF6FBFC 
+ 154      FFF6FB
+ 155 0786 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 155      FCFFF6FB 
+ 155      FCFFF6FB 
+ 155      FCFFF6
+ 156 0795 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 156      FBFCFFF6 
+ 156      FBFCFFF6 
+ 156      FBFCFF
+ 157 07a4 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 157      F6FBFCFF 
+ 157      F6FBFCFF 
+ 157      F6FBFC
+ 158 07b3 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 158      FFF6FBFC 
+ 158      FFF6FBFC 
+ 158      FFF6FB
+ 159 07c2 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 159      FCFFF6FB 
+ 159      FCFFF6FB 
+ 159      FCFF
+ 160 07d0 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 160      F6FBFCFF 
+ 160      F6FBFCFF 
+ 160      F6FBFC
+ 161 07df FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 161      FFF6FBFC 
+ 161      FFF6FBFC 
+ 161      FFF6FB
+ 162 07ee FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 162      FCFFF6FB 
+GAS LISTING /tmp/cceXHuAj.s 			page 11
+
+
+ 162      FCFFF6FB 
+ 162      FCFFF6
+ 163 07fd FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 163      FBFCFFF6 
+ 163      FBFCFFF6 
+ 163      FBFCFF
+ 164 080c F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 164      F6FBFCFF 
+ 164      F6FBFCFF 
+ 164      F6FBFC
+ 165 081b FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 165      FFF6FBFC 
+ 165      FFF6FBFC 
+ 165      FFF6FB
+ 166 082a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 166      FCFFF6FB 
+ 166      FCFFF6FB 
+ 166      FCFFF6
+ 167 0839 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 167      FBFCFFF6 
+ 167      FBFCFFF6 
+ 167      FBFCFF
+ 168 0848 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 168      F6FBFCFF 
+ 168      F6FBFCFF 
+ 168      F6FBFC
+ 169 0857 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 169      FFF6FBFC 
+ 169      FFF6FBFC 
+ 169      FFF6FB
+ 170 0866 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 170      FCFFF6FB 
+ 170      FCFFF6FB 
+ 170      FCFFF6
+ 171 0875 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 171      FBFCFFF6 
+ 171      FBFCFFF6 
+ 171      FBFCFF
+ 172 0884 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 172      F6FBFCFF 
+ 172      F6FBFCFF 
+ 172      F6FBFC
+ 173 0893 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 173      FFF6FBFC 
+ 173      FFF6FBFC 
+ 173      FFF6FB
+ 174 08a2 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 174      FCFFF6FB 
+ 174      FCFFF6FB 
+ 174      FCFFF6
+ 175 08b1 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 175      FBFCFFF6 
+ 175      FBFCFFF6 
+ 175      FBFCFF
+ 176 08c0 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 176      F6FBFCFF 
+ 176      F6FBFCFF 
+GAS LISTING /tmp/cceXHuAj.s 			page 12
+
+
+ 176      F6FBFC
+ 177 08cf FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 177      FFF6FBFC 
+ 177      FFF6FBFC 
+ 177      FFF6FB
+ 178 08de FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 178      FCFFF6FB 
+ 178      FCFFF6FB 
+ 178      FCFFF6
+ 179 08ed FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 179      FBFCFFF6 
+ 179      FBFCFFF6 
+ 179      FBFCFF
+ 180 08fc F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 180      F6FBFCFF 
+ 180      F6FBFCFF 
+ 180      F6FBFC
+ 181 090b FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 181      FFF6FBFC 
+ 181      FFF6FBFC 
+ 181      FFF6FB
+ 182 091a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 182      FCFFF6FB 
+ 182      FCFFF6FB 
+ 182      FCFFF6
+ 183 0929 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 183      FBFCFFF6 
+ 183      FBFCFFF6 
+ 183      FBFCFF
+ 184 0938 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 184      F6FBFCFF 
+ 184      F6FBFCFF 
+ 184      F6FBFC
+ 185 0947 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 185      FFF6FBFC 
+ 185      FFF6FBFC 
+ 185      FFF6FB
+ 186 0956 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 186      FCFFF6FB 
+ 186      FCFFF6FB 
+ 186      FCFFF6
+ 187 0965 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 187      FBFCFFF6 
+ 187      FBFCFFF6 
+ 187      FBFCFF
+ 188 0974 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 188      F6FBFCFF 
+ 188      F6FBFCFF 
+ 188      F6FBFC
+ 189 0983 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 189      FFF6FBFC 
+ 189      FFF6FBFC 
+ 189      FFF6FB
+ 190 0992 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 190      FCFFF6FB 
+ 190      FCFFF6FB 
+ 190      FCFFF6
+GAS LISTING /tmp/cceXHuAj.s 			page 13
+
+
+ 191 09a1 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 191      FBFCFFF6 
+ 191      FBFCFFF6 
+ 191      FBFCFF
+ 192 09b0 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 192      F6FBFCFF 
+ 192      F6FBFCFF 
+ 192      F6FBFC
+ 193 09bf FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 193      FFF6FBFC 
+ 193      FFF6FBFC 
+ 193      FFF6FB
+ 194 09ce FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 194      FCFFF6FB 
+ 194      FCFFF6FB 
+ 194      FCFFF6
+ 195 09dd FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 195      FBFCFFF6 
+ 195      FBFCFFF6 
+ 195      FBFCFF
+ 196 09ec F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 196      F6FBFCFF 
+ 196      F6FBFCFF 
+ 196      F6FBFC
+ 197 09fb FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 197      FFF6FBFC 
+ 197      FFF6FBFC 
+ 197      FFF6FB
+ 198 0a0a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 198      FCFFF6FB 
+ 198      FCFFF6FB 
+ 198      FCFFF6
+ 199 0a19 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 199      FBFCFFF6 
+ 199      FBFCFFF6 
+ 199      FBFCFF
+ 200 0a28 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 200      F6FBFCFF 
+ 200      F6FBFCFF 
+ 200      F6FBFC
+ 201 0a37 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 201      FFF6FBFC 
+ 201      FFF6FBFC 
+ 201      FFF6FB
+ 202 0a46 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 202      FCFFF6FB 
+ 202      FCFFF6FB 
+ 202      FCFFF6
+ 203 0a55 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 203      FBFCFFF6 
+ 203      FBFCFFF6 
+ 203      FBFCFF
+ 204 0a64 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 204      F6FBFCFF 
+ 204      F6FBFCFF 
+ 204      F6FBFC
+ 205 0a73 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+GAS LISTING /tmp/cceXHuAj.s 			page 14
+
+
+ 205      FFF6FBFC 
+ 205      FFF6FBFC 
+ 205      FFF6FB
+ 206 0a82 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 206      FCFFF6FB 
+ 206      FCFFF6FB 
+ 206      FCFFF6
+ 207 0a91 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 207      FBFCFFF6 
+ 207      FBFCFFF6 
+ 207      FBFCFF
+ 208 0aa0 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 208      F6FBFCFF 
+ 208      F6FBFCFF 
+ 208      F6FBFC
+ 209 0aaf FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 209      FFF6FBFC 
+ 209      FFF6FBFC 
+ 209      FFF6FB
+ 210 0abe FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 210      FCFFF6FB 
+ 210      FCFFF6FB 
+ 210      FCFFF6
+ 211 0acd FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 211      FBFCFFF6 
+ 211      FBFCFFF6 
+ 211      FBFCFF
+ 212 0adc F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 212      F6FBFCFF 
+ 212      F6FBFCFF 
+ 212      F6FBFC
+ 213 0aeb FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 213      FFF6FBFC 
+ 213      FFF6FBFC 
+ 213      FFF6FB
+ 214 0afa FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 214      FCFFF6FB 
+ 214      FCFFF6FB 
+ 214      FCFFF6
+ 215 0b09 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 215      FBFCFFF6 
+ 215      FBFCFFF6 
+ 215      FBFCFF
+ 216 0b18 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 216      F6FBFCFF 
+ 216      F6FBFCFF 
+ 216      F6FBFC
+ 217 0b27 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 217      FFF6FBFC 
+ 217      FFF6FBFC 
+ 217      FFF6FB
+ 218 0b36 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 218      FCFFF6FB 
+ 218      FCFFF6FB 
+ 218      FCFFF6
+ 219 0b45 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 219      FBFCFFF6 
+GAS LISTING /tmp/cceXHuAj.s 			page 15
+
+
+ 219      FBFCFFF6 
+ 219      FBFCFF
+ 220 0b54 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 220      F6FBFCFF 
+ 220      F6FBFCFF 
+ 220      F6FBFC
+ 221 0b63 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 221      FFF6FBFC 
+ 221      FFF6FBFC 
+ 221      FFF6FB
+ 222 0b72 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 222      FCFFF6FB 
+ 222      FCFFF6FB 
+ 222      FCFFF6
+ 223 0b81 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 223      FBFCFFF6 
+ 223      FBFCFFF6 
+ 223      FBFCFF
+ 224 0b90 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 224      F6FBFCFF 
+ 224      F6FBFCFF 
+ 224      F6FBFC
+ 225 0b9f FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 225      FFF6FBFC 
+ 225      FFF6FBFC 
+ 225      FFF6FB
+ 226 0bae FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 226      FCFFF6FB 
+ 226      FCFFF6FB 
+ 226      FCFFF6
+ 227 0bbd FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 227      FBFCFFF6 
+ 227      FBFCFFF6 
+ 227      FBFCFF
+ 228 0bcc F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 228      F6FBFCFF 
+ 228      F6FBFCFF 
+ 228      F6FBFC
+ 229 0bdb FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 229      FFF6FBFC 
+ 229      FFF6FBFC 
+ 229      FFF6FB
+ 230 0bea FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 230      FCFFF6FB 
+ 230      FCFFF6FB 
+ 230      FCFFF6
+ 231 0bf9 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 231      FBFCFFF6 
+ 231      FBFCFFF6 
+ 231      FBFCFF
+ 232 0c08 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 232      F6FBFCFF 
+ 232      F6FBFCFF 
+ 232      F6FBFC
+ 233 0c17 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 233      FFF6FBFC 
+ 233      FFF6FBFC 
+GAS LISTING /tmp/cceXHuAj.s 			page 16
+
+
+ 233      FFF6FB
+ 234 0c26 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 234      FCFFF6FB 
+ 234      FCFFF6FB 
+ 234      FCFFF6
+ 235 0c35 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 235      FBFCFFF6 
+ 235      FBFCFFF6 
+ 235      FBFCFF
+ 236 0c44 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 236      F6FBFCFF 
+ 236      F6FBFCFF 
+ 236      F6FBFC
+ 237 0c53 FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 237      FFF6FBFC 
+ 237      FFF6FBFC 
+ 237      FFF6FB
+ 238 0c62 FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 238      FCFFF6FB 
+ 238      FCFFF6FB 
+ 238      FCFFF6
+ 239 0c71 FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 239      FBFCFFF6 
+ 239      FBFCFFF6 
+ 239      FBFCFF
+ 240 0c80 F6FBFCFF 		.ascii	"\366\373\374\377\366\373\374\377\366\373\374\377\366\373\374"
+ 240      F6FBFCFF 
+ 240      F6FBFCFF 
+ 240      F6FBFC
+ 241 0c8f FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 241      FFF6FBFC 
+ 241      FFF6FBFC 
+ 241      FFF6FB
+ 242 0c9e FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377\366\373\374\377\366"
+ 242      FCFFF6FB 
+ 242      FCFFF6FB 
+ 242      FCFFF6
+ 243 0cad FBFCFFF6 		.ascii	"\373\374\377\366\373\374\377\366\373\374\377\366\373\374\377"
+ 243      FBFCFFF6 
+ 243      FBFCFFF6 
+ 243      FBFCFF
+ 244 0cbc F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 244      F6FCFCFF 
+ 244      F6FCFCFF 
+ 244      F6FCFC
+ 245 0ccb FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 245      FFF6FCFC 
+ 245      FFF6FCFC 
+ 245      FFF6FC
+ 246 0cda FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 246      FCFFF6FC 
+ 246      FCFFF6FC 
+ 246      FCFFF6
+ 247 0ce9 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 247      FCFCFFF6 
+ 247      FCFCFFF6 
+ 247      FCFCFF
+GAS LISTING /tmp/cceXHuAj.s 			page 17
+
+
+ 248 0cf8 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 248      F6FCFCFF 
+ 248      F6FCFCFF 
+ 248      F6FCFC
+ 249 0d07 FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 249      FFF6FCFC 
+ 249      FFF6FCFC 
+ 249      FFF6FC
+ 250 0d16 FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 250      FCFFF6FC 
+ 250      FCFFF6FC 
+ 250      FCFFF6
+ 251 0d25 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 251      FCFCFFF6 
+ 251      FCFCFFF6 
+ 251      FCFCFF
+ 252 0d34 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 252      F6FCFCFF 
+ 252      F6FCFCFF 
+ 252      F6FCFC
+ 253 0d43 FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 253      FFF6FCFC 
+ 253      FFF6FCFC 
+ 253      FFF6FC
+ 254 0d52 FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 254      FCFFF6FC 
+ 254      FCFFF6FC 
+ 254      FCFFF6
+ 255 0d61 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 255      FCFCFFF6 
+ 255      FCFCFFF6 
+ 255      FCFCFF
+ 256 0d70 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 256      F6FCFCFF 
+ 256      F6FCFCFF 
+ 256      F6FCFC
+ 257 0d7f FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 257      FFF6FCFC 
+ 257      FFF6FCFC 
+ 257      FFF6FC
+ 258 0d8e FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 258      FCFFF6FC 
+ 258      FCFFF6FC 
+ 258      FCFFF6
+ 259 0d9d FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 259      FCFCFFF6 
+ 259      FCFCFFF6 
+ 259      FCFCFF
+ 260 0dac F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 260      F6FCFCFF 
+ 260      F6FCFCFF 
+ 260      F6FCFC
+ 261 0dbb FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 261      FFF6FCFC 
+ 261      FFF6FCFC 
+ 261      FFF6FC
+ 262 0dca FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+GAS LISTING /tmp/cceXHuAj.s 			page 18
+
+
+ 262      FCFFF6FC 
+ 262      FCFFF6FC 
+ 262      FCFFF6
+ 263 0dd9 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 263      FCFCFFF6 
+ 263      FCFCFFF6 
+ 263      FCFCFF
+ 264 0de8 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 264      F6FCFCFF 
+ 264      F6FCFCFF 
+ 264      F6FCFC
+ 265 0df7 FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 265      FFF6FCFC 
+ 265      FFF6FCFC 
+ 265      FFF6FC
+ 266 0e06 FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 266      FCFFF6FC 
+ 266      FCFFF6FC 
+ 266      FCFFF6
+ 267 0e15 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 267      FCFCFFF6 
+ 267      FCFCFFF6 
+ 267      FCFCFF
+ 268 0e24 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 268      F6FCFCFF 
+ 268      F6FCFCFF 
+ 268      F6FCFC
+ 269 0e33 FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 269      FFF6FCFC 
+ 269      FFF6FCFC 
+ 269      FFF6FC
+ 270 0e42 FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 270      FCFFF6FC 
+ 270      FCFFF6FC 
+ 270      FCFFF6
+ 271 0e51 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 271      FCFCFFF6 
+ 271      FCFCFFF6 
+ 271      FCFCFF
+ 272 0e60 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 272      F6FCFCFF 
+ 272      F6FCFCFF 
+ 272      F6FCFC
+ 273 0e6f FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 273      FFF6FCFC 
+ 273      FFF6FCFC 
+ 273      FFF6FC
+ 274 0e7e FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 274      FCFFF6FC 
+ 274      FCFFF6FC 
+ 274      FCFFF6
+ 275 0e8d FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 275      FCFCFFF6 
+ 275      FCFCFFF6 
+ 275      FCFCFF
+ 276 0e9c F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 276      F6FCFCFF 
+GAS LISTING /tmp/cceXHuAj.s 			page 19
+
+
+ 276      F6FCFCFF 
+ 276      F6FCFC
+ 277 0eab FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 277      FFF6FCFC 
+ 277      FFF6FCFC 
+ 277      FFF6FC
+ 278 0eba FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 278      FCFFF6FC 
+ 278      FCFFF6FC 
+ 278      FCFFF6
+ 279 0ec9 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 279      FCFCFFF6 
+ 279      FCFCFFF6 
+ 279      FCFCFF
+ 280 0ed8 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 280      F6FCFCFF 
+ 280      F6FCFCFF 
+ 280      F6FCFC
+ 281 0ee7 FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 281      FFF6FCFC 
+ 281      FFF6FCFC 
+ 281      FFF6FC
+ 282 0ef6 FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 282      FCFFF6FC 
+ 282      FCFFF6FC 
+ 282      FCFFF6
+ 283 0f05 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 283      FCFCFFF6 
+ 283      FCFCFFF6 
+ 283      FCFCFF
+ 284 0f14 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 284      F6FCFCFF 
+ 284      F6FCFCFF 
+ 284      F6FCFC
+ 285 0f23 FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 285      FFF6FCFC 
+ 285      FFF6FCFC 
+ 285      FFF6FC
+ 286 0f32 FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 286      FCFFF6FC 
+ 286      FCFFF6FC 
+ 286      FCFFF6
+ 287 0f41 FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 287      FCFCFFF6 
+ 287      FCFCFFF6 
+ 287      FCFCFF
+ 288 0f50 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 288      F6FCFCFF 
+ 288      F6FCFCFF 
+ 288      F6FCFC
+ 289 0f5f FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 289      FFF6FCFC 
+ 289      FFF6FCFC 
+ 289      FFF6FC
+ 290 0f6e FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 290      FCFFF6FC 
+ 290      FCFFF6FC 
+GAS LISTING /tmp/cceXHuAj.s 			page 20
+
+
+ 290      FCFFF6
+ 291 0f7d FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 291      FCFCFFF6 
+ 291      FCFCFFF6 
+ 291      FCFCFF
+ 292 0f8c F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 292      F6FCFCFF 
+ 292      F6FCFCFF 
+ 292      F6FCFC
+ 293 0f9b FFF6FCFC 		.ascii	"\377\366\374\374\377"
+ 293      FF
+ 294 0fa0 F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 294      F6FCFCFF 
+ 294      F6FCFCFF 
+ 294      F6FCFC
+ 295 0faf FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 295      FFF6FCFC 
+ 295      FFF6FCFC 
+ 295      FFF6FC
+ 296 0fbe FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377\366\374\374\377\366"
+ 296      FCFFF6FC 
+ 296      FCFFF6FC 
+ 296      FCFFF6
+ 297 0fcd FCFCFFF6 		.ascii	"\374\374\377\366\374\374\377\366\374\374\377\366\374\374\377"
+ 297      FCFCFFF6 
+ 297      FCFCFFF6 
+ 297      FCFCFF
+ 298 0fdc F6FCFCFF 		.ascii	"\366\374\374\377\366\374\374\377\366\374\374\377\366\374\374"
+ 298      F6FCFCFF 
+ 298      F6FCFCFF 
+ 298      F6FCFC
+ 299 0feb FFF6FCFC 		.ascii	"\377\366\374\374\377\366\374\374\377\366\374\374\377\366\374"
+ 299      FFF6FCFC 
+ 299      FFF6FCFC 
+ 299      FFF6FC
+ 300 0ffa FCFFF6FC 		.ascii	"\374\377\366\374\374\377\366\374\374\377"
+ 300      FCFFF6FC 
+ 300      FCFF
+ 301              		.globl	heatmap_cs_BuPu_mixed
+ 302              		.section	.data.rel.local
+ 303              		.align 8
+ 304              		.type	heatmap_cs_BuPu_mixed, @object
+ 305              		.size	heatmap_cs_BuPu_mixed, 8
+ 306              	heatmap_cs_BuPu_mixed:
+ 307 0008 00000000 		.quad	mixed
+ 307      00000000 
+ 308              		.section	.data.rel.ro.local
+ 309              		.align 16
+ 310              		.type	mixed, @object
+ 311              		.size	mixed, 16
+ 312              	mixed:
+ 313 0010 00000000 		.quad	mixed_data
+ 313      00000000 
+ 314 0018 01040000 		.quad	1025
+ 314      00000000 
+ 315              		.section	.rodata
+ 316 1004 00000000 		.align 32
+GAS LISTING /tmp/cceXHuAj.s 			page 21
+
+
+ 316      00000000 
+ 316      00000000 
+ 316      00000000 
+ 316      00000000 
+ 317              		.type	mixed_data, @object
+ 318              		.size	mixed_data, 4100
+ 319              	mixed_data:
+ 320 1020 00       		.string	""
+ 321 1021 00       		.string	""
+ 322 1022 00       		.string	""
+ 323 1023 00       		.string	""
+ 324 1024 4C00     		.string	"L"
+ 325 1026 4B00     		.string	"K"
+ 326 1028 4D00     		.string	"M"
+ 327 102a 4B074D00 		.string	"K\007M"
+ 328 102e 4B0E4D00 		.string	"K\016M"
+ 329 1032 4B164E00 		.string	"K\026N"
+ 330 1036 4C1D4E00 		.string	"L\035N"
+ 331 103a 4C254E00 		.string	"L%N"
+ 332 103e 4C2C4F00 		.string	"L,O"
+ 333 1042 4D344F00 		.string	"M4O"
+ 334 1046 4D3B4F00 		.string	"M;O"
+ 335 104a 4D435000 		.string	"MCP"
+ 336 104e 4D4A5000 		.string	"MJP"
+ 337 1052 4E525000 		.string	"NRP"
+ 338 1056 4E595100 		.string	"NYQ"
+ 339 105a 4E615100 		.string	"NaQ"
+ 340 105e 4F685100 		.string	"OhQ"
+ 341 1062 4F705100 		.string	"OpQ"
+ 342 1066 4F775200 		.string	"OwR"
+ 343 106a 507F5200 		.string	"P\177R"
+ 344 106e 50865201 		.ascii	"P\206R\001P\215S\001P\225S\001Q\234S\001Q\244T\001Q\253T\001"
+ 344      508D5301 
+ 344      50955301 
+ 344      519C5301 
+ 344      51A45401 
+ 345 1086 52B35401 		.ascii	"R\263T\001R\272U\001R\302U\001S\311U\001S\321V\001S\330V\001"
+ 345      52BA5501 
+ 345      52C25501 
+ 345      53C95501 
+ 345      53D15601 
+ 346 109e 53E05601 		.ascii	"S\340V\001T\347W\001T\357W\001T\366W\002U\376W\002U\377X\002"
+ 346      54E75701 
+ 346      54EF5701 
+ 346      54F65702 
+ 346      55FE5702 
+ 347 10b6 55FF5802 		.ascii	"U\377X\002V\377X\002V\377Y\002V\377Y\002V\377Y\002W\377Z\002"
+ 347      56FF5802 
+ 347      56FF5902 
+ 347      56FF5902 
+ 347      56FF5902 
+ 348 10ce 57FF5A02 		.ascii	"W\377Z\002W\377Z\002X\377[\002X\377[\002X\377[\003Y\377\\\003"
+ 348      57FF5A02 
+ 348      58FF5B02 
+ 348      58FF5B02 
+ 348      58FF5B03 
+ 349 10e6 59FF5C03 		.ascii	"Y\377\\\003Y\377\\\003Y\377]\003Z\377]\003Z\377]\003Z\377^\003"
+GAS LISTING /tmp/cceXHuAj.s 			page 22
+
+
+ 349      59FF5C03 
+ 349      59FF5D03 
+ 349      5AFF5D03 
+ 349      5AFF5D03 
+ 350 10fe 5BFF5E03 		.ascii	"[\377^\003[\377^\003[\377_\003\\\377_\004\\\377_\004\\\377_\004"
+ 350      5BFF5E03 
+ 350      5BFF5F03 
+ 350      5CFF5F04 
+ 350      5CFF5F04 
+ 351 1116 5CFF6004 		.ascii	"\\\377`\004]\377`\004]\377`\004]\377k\007h\377l\007h\377l\007"
+ 351      5DFF6004 
+ 351      5DFF6004 
+ 351      5DFF6B07 
+ 351      68FF6C07 
+ 352 112e 68FF6C07 		.ascii	"h\377l\007h\377m\007i\377m\bi\377m\bi\377m\bj\377n\bj\377n\b"
+ 352      68FF6D07 
+ 352      69FF6D08 
+ 352      69FF6D08 
+ 352      69FF6D08 
+ 353 114a 6AFF6E08 		.ascii	"j\377n\bk\377o\bk\377o\bk\377o\bl\377p\bl\377p\tl\377p\tl\377"
+ 353      6BFF6F08 
+ 353      6BFF6F08 
+ 353      6BFF6F08 
+ 353      6CFF7008 
+ 354 1168 71096DFF 		.ascii	"q\tm\377q\tm\377q\tm\377r\tn\377r\tn\377r\tn\377s\no\377s\no"
+ 354      71096DFF 
+ 354      71096DFF 
+ 354      72096EFF 
+ 354      72096EFF 
+ 355 1187 FF730A6F 		.ascii	"\377s\no\377t\np\377t\np\377t\np\377u\np\377u\nq\377u\nq\377"
+ 355      FF740A70 
+ 355      FF740A70 
+ 355      FF740A70 
+ 355      FF750A70 
+ 356 11a4 760B71FF 		.ascii	"v\013q\377v\013r\377v\013r\377w\013r\377w\013s\377w\013s\377"
+ 356      760B72FF 
+ 356      760B72FF 
+ 356      770B72FF 
+ 356      770B73FF 
+ 357 11bc 780B73FF 		.ascii	"x\013s\377x\013t\377x\ft\377y\ft\377y\fu\377y\fu\377z\fu\377"
+ 357      780B74FF 
+ 357      780C74FF 
+ 357      790C74FF 
+ 357      790C75FF 
+ 358 11d8 7A0C75FF 		.ascii	"z\fu\377z\fv\377{\fv\377{\rv\377{\rw\377|\rw\377|\rw\377|\rx"
+ 358      7A0C76FF 
+ 358      7B0C76FF 
+ 358      7B0D76FF 
+ 358      7B0D77FF 
+ 359 11f7 FF7D0D78 		.ascii	"\377}\rx\377}\rx\377}\ry\377~\016y\377~\016y\377~\016z\377\177"
+ 359      FF7D0D78 
+ 359      FF7D0D79 
+ 359      FF7E0E79 
+ 359      FF7E0E79 
+ 360 1211 0E7AFF7F 		.ascii	"\016z\377\177\016z\377\177\016{\377\200\016{\377\200\016{\377"
+ 360      0E7AFF7F 
+ 360      0E7BFF80 
+GAS LISTING /tmp/cceXHuAj.s 			page 23
+
+
+ 360      0E7BFF80 
+ 360      0E7BFF
+ 361 1224 800F7CFF 		.ascii	"\200\017|\377\201\017|\377\201\020|\377\201\020|\377\201\021"
+ 361      810F7CFF 
+ 361      81107CFF 
+ 361      81107CFF 
+ 361      8111
+ 362 1236 7CFF8111 		.ascii	"|\377\201\021}\377\201\022}\377\201\022}\377\201\023}\377\201"
+ 362      7DFF8112 
+ 362      7DFF8112 
+ 362      7DFF8113 
+ 362      7DFF81
+ 363 1249 137DFF81 		.ascii	"\023}\377\201\024~\377\201\024~\377\201\024~\377\201\025~\377"
+ 363      147EFF81 
+ 363      147EFF81 
+ 363      147EFF81 
+ 363      157EFF
+ 364 125c 81157EFF 		.ascii	"\201\025~\377\201\026\177\377\201\026\177\377\201\027\177\377"
+ 364      81167FFF 
+ 364      81167FFF 
+ 364      81177FFF 
+ 365 126c 81177FFF 		.ascii	"\201\027\177\377\201\027\200\377\201\030\200\377\202\030\200"
+ 365      811780FF 
+ 365      811880FF 
+ 365      821880
+ 366 127b FF821880 		.ascii	"\377\202\030\200\377\202\031\200\377\202\031\201\377\202\032"
+ 366      FF821980 
+ 366      FF821981 
+ 366      FF821A
+ 367 128a 81FF821A 		.ascii	"\201\377\202\032\201\377\202\032\201\377\202\033\201\377\202"
+ 367      81FF821A 
+ 367      81FF821B 
+ 367      81FF82
+ 368 1299 1B82FF82 		.ascii	"\033\202\377\202\033\202\377\202\034\202\377\202\034\202\377"
+ 368      1B82FF82 
+ 368      1C82FF82 
+ 368      1C82FF
+ 369 12a8 821C83FF 		.ascii	"\202\034\203\377\202\035\203\377\202\035\203\377\202\035\203"
+ 369      821D83FF 
+ 369      821D83FF 
+ 369      821D83
+ 370 12b7 FF821E83 		.ascii	"\377\202\036\203\377\202\036\204\377\202\036\204\377\202\037"
+ 370      FF821E84 
+ 370      FF821E84 
+ 370      FF821F
+ 371 12c6 84FF821F 		.ascii	"\204\377\202\037\204\377\203\037\204\377\203 \205\377\203 \205"
+ 371      84FF831F 
+ 371      84FF8320 
+ 371      85FF8320 
+ 371      85
+ 372 12d7 FF832085 		.ascii	"\377\203 \205\377\203!\205\377\203!\205\377\203!\206\377\203"
+ 372      FF832185 
+ 372      FF832185 
+ 372      FF832186 
+ 372      FF83
+ 373 12e9 2286FF83 		.ascii	"\"\206\377\203\"\206\377\203\"\206\377\203#\206\377\203#\207"
+ 373      2286FF83 
+GAS LISTING /tmp/cceXHuAj.s 			page 24
+
+
+ 373      2286FF83 
+ 373      2386FF83 
+ 373      2387
+ 374 12fb FF832387 		.ascii	"\377\203#\207\377\203#\207\377\203$\207\377\203$\210\377\203"
+ 374      FF832387 
+ 374      FF832487 
+ 374      FF832488 
+ 374      FF83
+ 375 130d 2488FF83 		.ascii	"$\210\377\203%\210\377\203%\210\377\203%\210\377\203%\211\377"
+ 375      2588FF83 
+ 375      2588FF83 
+ 375      2588FF83 
+ 375      2589FF
+ 376 1320 832689FF 		.ascii	"\203&\211\377\2050\220\377\2050\220\377\2051\220\377\2051\220"
+ 376      853090FF 
+ 376      853090FF 
+ 376      853190FF 
+ 376      853190
+ 377 1333 FF853190 		.ascii	"\377\2051\220\377\2051\221\377\2052\221\377\2052\221\377\205"
+ 377      FF853191 
+ 377      FF853291 
+ 377      FF853291 
+ 377      FF85
+ 378 1345 3291FF85 		.ascii	"2\221\377\2053\221\377\2053\222\377\2053\222\377\2053\222\377"
+ 378      3391FF85 
+ 378      3392FF85 
+ 378      3392FF85 
+ 378      3392FF
+ 379 1358 853492FF 		.ascii	"\2054\222\377\2064\222\377\2064\223\377\2064\223\377\2065\223"
+ 379      863492FF 
+ 379      863493FF 
+ 379      863493FF 
+ 379      863593
+ 380 136b FF863593 		.ascii	"\377\2065\223\377\2065\223\377\2066\224\377\2066\224\377\206"
+ 380      FF863593 
+ 380      FF863694 
+ 380      FF863694 
+ 380      FF86
+ 381 137d 3694FF86 		.ascii	"6\224\377\2066\224\377\2067\225\377\2067\225\377\2067\225\377"
+ 381      3694FF86 
+ 381      3795FF86 
+ 381      3795FF86 
+ 381      3795FF
+ 382 1390 863795FF 		.ascii	"\2067\225\377\2068\225\377\2068\226\377\2068\226\377\2068\226"
+ 382      863895FF 
+ 382      863896FF 
+ 382      863896FF 
+ 382      863896
+ 383 13a3 FF863996 		.ascii	"\377\2069\226\377\2069\226\377\2069\227\377\2069\227\377\206"
+ 383      FF863996 
+ 383      FF863997 
+ 383      FF863997 
+ 383      FF86
+ 384 13b5 3A97FF86 		.ascii	":\227\377\206:\227\377\206:\227\377\207:\230\377\207;\230\377"
+ 384      3A97FF86 
+ 384      3A97FF87 
+ 384      3A98FF87 
+GAS LISTING /tmp/cceXHuAj.s 			page 25
+
+
+ 384      3B98FF
+ 385 13c8 873B98FF 		.ascii	"\207;\230\377\207;\230\377\207;\230\377\207<\231\377\207<\231"
+ 385      873B98FF 
+ 385      873B98FF 
+ 385      873C99FF 
+ 385      873C99
+ 386 13db FF873C99 		.ascii	"\377\207<\231\377\207<\231\377\207=\231\377\207=\232\377\207"
+ 386      FF873C99 
+ 386      FF873D99 
+ 386      FF873D9A 
+ 386      FF87
+ 387 13ed 3D9AFF87 		.ascii	"=\232\377\207=\232\377\207>\232\377\207>\232\377\207>\233\377"
+ 387      3D9AFF87 
+ 387      3E9AFF87 
+ 387      3E9AFF87 
+ 387      3E9BFF
+ 388 1400 873E9BFF 		.ascii	"\207>\233\377\207?\233\377\207?\233\377\207?\233\377\207?\234"
+ 388      873F9BFF 
+ 388      873F9BFF 
+ 388      873F9BFF 
+ 388      873F9C
+ 389 1413 FF87409C 		.ascii	"\377\207@\234\377\207@\234\377\207@\234\377\207@\234\377\207"
+ 389      FF87409C 
+ 389      FF87409C 
+ 389      FF87409C 
+ 389      FF87
+ 390 1425 419DFF88 		.ascii	"A\235\377\210A\235\377\210A\235\377\210A\235\377\210B\235\377"
+ 390      419DFF88 
+ 390      419DFF88 
+ 390      419DFF88 
+ 390      429DFF
+ 391 1438 88429DFF 		.ascii	"\210B\235\377\210B\235\377\210C\236\377\210C\236\377\210C\236"
+ 391      88429DFF 
+ 391      88439EFF 
+ 391      88439EFF 
+ 391      88439E
+ 392 144b FF88439E 		.ascii	"\377\210C\236\377\210D\236\377\210D\236\377\210D\236\377\210"
+ 392      FF88449E 
+ 392      FF88449E 
+ 392      FF88449E 
+ 392      FF88
+ 393 145d 459FFF88 		.ascii	"E\237\377\210E\237\377\210E\237\377\210F\237\377\210F\237\377"
+ 393      459FFF88 
+ 393      459FFF88 
+ 393      469FFF88 
+ 393      469FFF
+ 394 1470 88469FFF 		.ascii	"\210F\237\377\210F\237\377\210G\240\377\210G\240\377\210G\240"
+ 394      88469FFF 
+ 394      8847A0FF 
+ 394      8847A0FF 
+ 394      8847A0
+ 395 1483 FF8847A0 		.ascii	"\377\210G\240\377\210H\240\377\210H\240\377\210H\240\377\210"
+ 395      FF8848A0 
+ 395      FF8848A0 
+ 395      FF8848A0 
+ 395      FF88
+ 396 1495 49A1FF88 		.ascii	"I\241\377\210I\241\377\210I\241\377\210I\241\377\210J\241\377"
+GAS LISTING /tmp/cceXHuAj.s 			page 26
+
+
+ 396      49A1FF88 
+ 396      49A1FF88 
+ 396      49A1FF88 
+ 396      4AA1FF
+ 397 14a8 884AA1FF 		.ascii	"\210J\241\377\210J\241\377\210K\242\377\210K\242\377\210K\242"
+ 397      884AA1FF 
+ 397      884BA2FF 
+ 397      884BA2FF 
+ 397      884BA2
+ 398 14bb FF884BA2 		.ascii	"\377\210K\242\377\210L\242\377\210L\242\377\210L\242\377\210"
+ 398      FF884CA2 
+ 398      FF884CA2 
+ 398      FF884CA2 
+ 398      FF88
+ 399 14cd 4CA2FF88 		.ascii	"L\242\377\210M\243\377\210M\243\377\210M\243\377\210N\243\377"
+ 399      4DA3FF88 
+ 399      4DA3FF88 
+ 399      4DA3FF88 
+ 399      4EA3FF
+ 400 14e0 884EA3FF 		.ascii	"\210N\243\377\210N\243\377\210N\243\377\210O\244\377\210O\244"
+ 400      884EA3FF 
+ 400      884EA3FF 
+ 400      884FA4FF 
+ 400      884FA4
+ 401 14f3 FF884FA4 		.ascii	"\377\210O\244\377\210O\244\377\210P\244\377\210P\244\377\210"
+ 401      FF884FA4 
+ 401      FF8850A4 
+ 401      FF8850A4 
+ 401      FF88
+ 402 1505 50A4FF88 		.ascii	"P\244\377\210P\244\377\210Q\245\377\210Q\245\377\210Q\245\377"
+ 402      50A4FF88 
+ 402      51A5FF88 
+ 402      51A5FF88 
+ 402      51A5FF
+ 403 1518 8851A5FF 		.ascii	"\210Q\245\377\210R\245\377\210R\245\377\211[\251\377\211[\251"
+ 403      8852A5FF 
+ 403      8852A5FF 
+ 403      895BA9FF 
+ 403      895BA9
+ 404 152b FF895BAA 		.ascii	"\377\211[\252\377\211[\252\377\211\\\252\377\211\\\252\377\211"
+ 404      FF895BAA 
+ 404      FF895CAA 
+ 404      FF895CAA 
+ 404      FF89
+ 405 153d 5CAAFF89 		.ascii	"\\\252\377\211\\\252\377\211]\252\377\212]\252\377\212]\253\377"
+ 405      5CAAFF89 
+ 405      5DAAFF8A 
+ 405      5DAAFF8A 
+ 405      5DABFF
+ 406 1550 8A5DABFF 		.ascii	"\212]\253\377\212^\253\377\212^\253\377\212^\253\377\212_\253"
+ 406      8A5EABFF 
+ 406      8A5EABFF 
+ 406      8A5EABFF 
+ 406      8A5FAB
+ 407 1563 FF8A5FAB 		.ascii	"\377\212_\253\377\212_\253\377\212_\254\377\212`\254\377\212"
+ 407      FF8A5FAB 
+ 407      FF8A5FAC 
+GAS LISTING /tmp/cceXHuAj.s 			page 27
+
+
+ 407      FF8A60AC 
+ 407      FF8A
+ 408 1575 60ACFF8A 		.ascii	"`\254\377\212`\254\377\212`\254\377\212a\254\377\212a\254\377"
+ 408      60ACFF8A 
+ 408      60ACFF8A 
+ 408      61ACFF8A 
+ 408      61ACFF
+ 409 1588 8A61ACFF 		.ascii	"\212a\254\377\212a\254\377\212b\255\377\212b\255\377\212b\255"
+ 409      8A61ACFF 
+ 409      8A62ADFF 
+ 409      8A62ADFF 
+ 409      8A62AD
+ 410 159b FF8A62AD 		.ascii	"\377\212b\255\377\212c\255\377\212c\255\377\212c\255\377\212"
+ 410      FF8A63AD 
+ 410      FF8A63AD 
+ 410      FF8A63AD 
+ 410      FF8A
+ 411 15ad 63ADFF8A 		.ascii	"c\255\377\212c\255\377\212d\256\377\212d\256\377\212d\256\377"
+ 411      63ADFF8A 
+ 411      64AEFF8A 
+ 411      64AEFF8A 
+ 411      64AEFF
+ 412 15c0 8A64AEFF 		.ascii	"\212d\256\377\213e\256\377\213e\256\377\213e\256\377\213e\256"
+ 412      8B65AEFF 
+ 412      8B65AEFF 
+ 412      8B65AEFF 
+ 412      8B65AE
+ 413 15d3 FF8B66AE 		.ascii	"\377\213f\256\377\213f\257\377\213f\257\377\213f\257\377\213"
+ 413      FF8B66AF 
+ 413      FF8B66AF 
+ 413      FF8B66AF 
+ 413      FF8B
+ 414 15e5 67AFFF8B 		.ascii	"g\257\377\213g\257\377\213g\257\377\213g\257\377\213h\257\377"
+ 414      67AFFF8B 
+ 414      67AFFF8B 
+ 414      67AFFF8B 
+ 414      68AFFF
+ 415 15f8 8B68AFFF 		.ascii	"\213h\257\377\213h\257\377\213h\260\377\213i\260\377\213i\260"
+ 415      8B68AFFF 
+ 415      8B68B0FF 
+ 415      8B69B0FF 
+ 415      8B69B0
+ 416 160b FF8B69B0 		.ascii	"\377\213i\260\377\213i\260\377\213j\260\377\213j\260\377\213"
+ 416      FF8B69B0 
+ 416      FF8B6AB0 
+ 416      FF8B6AB0 
+ 416      FF8B
+ 417 161d 6AB0FF8B 		.ascii	"j\260\377\213j\260\377\213k\261\377\213k\261\377\213k\261\377"
+ 417      6AB0FF8B 
+ 417      6BB1FF8B 
+ 417      6BB1FF8B 
+ 417      6BB1FF
+ 418 1630 8B6BB1FF 		.ascii	"\213k\261\377\213l\261\377\213l\261\377\213l\262\377\213m\262"
+ 418      8B6CB1FF 
+ 418      8B6CB1FF 
+ 418      8B6CB2FF 
+ 418      8B6DB2
+GAS LISTING /tmp/cceXHuAj.s 			page 28
+
+
+ 419 1643 FF8B6DB2 		.ascii	"\377\213m\262\377\213m\262\377\213m\262\377\213n\263\377\213"
+ 419      FF8B6DB2 
+ 419      FF8B6DB2 
+ 419      FF8B6EB3 
+ 419      FF8B
+ 420 1655 6EB3FF8B 		.ascii	"n\263\377\213n\263\377\213o\263\377\213o\263\377\213o\263\377"
+ 420      6EB3FF8B 
+ 420      6FB3FF8B 
+ 420      6FB3FF8B 
+ 420      6FB3FF
+ 421 1668 8A6FB4FF 		.ascii	"\212o\264\377\212p\264\377\212p\264\377\212p\264\377\212q\264"
+ 421      8A70B4FF 
+ 421      8A70B4FF 
+ 421      8A70B4FF 
+ 421      8A71B4
+ 422 167b FF8A71B5 		.ascii	"\377\212q\265\377\212q\265\377\212q\265\377\212r\265\377\212"
+ 422      FF8A71B5 
+ 422      FF8A71B5 
+ 422      FF8A72B5 
+ 422      FF8A
+ 423 168d 72B5FF8A 		.ascii	"r\265\377\212r\265\377\212s\266\377\212s\266\377\212s\266\377"
+ 423      72B5FF8A 
+ 423      73B6FF8A 
+ 423      73B6FF8A 
+ 423      73B6FF
+ 424 16a0 8A73B6FF 		.ascii	"\212s\266\377\212t\266\377\212t\266\377\212t\267\377\212u\267"
+ 424      8A74B6FF 
+ 424      8A74B6FF 
+ 424      8A74B7FF 
+ 424      8A75B7
+ 425 16b3 FF8A75B7 		.ascii	"\377\212u\267\377\212u\267\377\212u\267\377\212v\267\377\211"
+ 425      FF8A75B7 
+ 425      FF8A75B7 
+ 425      FF8A76B7 
+ 425      FF89
+ 426 16c5 76B7FF89 		.ascii	"v\267\377\211v\270\377\211w\270\377\211w\270\377\211w\270\377"
+ 426      76B8FF89 
+ 426      77B8FF89 
+ 426      77B8FF89 
+ 426      77B8FF
+ 427 16d8 8977B8FF 		.ascii	"\211w\270\377\211x\270\377\211x\271\377\211x\271\377\211x\271"
+ 427      8978B8FF 
+ 427      8978B9FF 
+ 427      8978B9FF 
+ 427      8978B9
+ 428 16eb FF8979B9 		.ascii	"\377\211y\271\377\211y\271\377\211y\271\377\211z\271\377\211"
+ 428      FF8979B9 
+ 428      FF8979B9 
+ 428      FF897AB9 
+ 428      FF89
+ 429 16fd 7ABAFF89 		.ascii	"z\272\377\211z\272\377\211z\272\377\211{\272\377\211{\272\377"
+ 429      7ABAFF89 
+ 429      7ABAFF89 
+ 429      7BBAFF89 
+ 429      7BBAFF
+ 430 1710 897BBAFF 		.ascii	"\211{\272\377\211{\272\377\211|\272\377\211|\273\377\211|\273"
+ 430      897BBAFF 
+GAS LISTING /tmp/cceXHuAj.s 			page 29
+
+
+ 430      897CBAFF 
+ 430      897CBBFF 
+ 430      897CBB
+ 431 1723 FF8985BF 		.ascii	"\377\211\205\277\377\211\205\277\377\211\206\277\377\211\206"
+ 431      FF8985BF 
+ 431      FF8986BF 
+ 431      FF8986
+ 432 1732 BFFF8986 		.ascii	"\277\377\211\206\300\377\211\206\300\377\211\207\300\377\211"
+ 432      C0FF8986 
+ 432      C0FF8987 
+ 432      C0FF89
+ 433 1741 87C0FF89 		.ascii	"\207\300\377\211\207\300\377\211\210\300\377\211\210\300\377"
+ 433      87C0FF89 
+ 433      88C0FF89 
+ 433      88C0FF
+ 434 1750 8988C0FF 		.ascii	"\211\210\300\377\211\210\301\377\211\211\301\377\211\211\301"
+ 434      8988C1FF 
+ 434      8989C1FF 
+ 434      8989C1
+ 435 175f FF8989C1 		.ascii	"\377\211\211\301\377\211\211\301\377\211\212\301\377\211\212"
+ 435      FF8989C1 
+ 435      FF898AC1 
+ 435      FF898A
+ 436 176e C1FF898A 		.ascii	"\301\377\211\212\301\377\211\212\301\377\211\213\302\377\211"
+ 436      C1FF898A 
+ 436      C1FF898B 
+ 436      C2FF89
+ 437 177d 8BC2FF89 		.ascii	"\213\302\377\211\213\302\377\211\213\302\377\211\214\302\377"
+ 437      8BC2FF89 
+ 437      8BC2FF89 
+ 437      8CC2FF
+ 438 178c 898CC2FF 		.ascii	"\211\214\302\377\211\214\302\377\211\214\302\377\211\215\302"
+ 438      898CC2FF 
+ 438      898CC2FF 
+ 438      898DC2
+ 439 179b FF898DC3 		.ascii	"\377\211\215\303\377\211\215\303\377\212\216\303\377\212\216"
+ 439      FF898DC3 
+ 439      FF8A8EC3 
+ 439      FF8A8E
+ 440 17aa C3FF8A8E 		.ascii	"\303\377\212\216\303\377\212\216\303\377\212\217\303\377\212"
+ 440      C3FF8A8E 
+ 440      C3FF8A8F 
+ 440      C3FF8A
+ 441 17b9 8FC3FF8A 		.ascii	"\217\303\377\212\217\303\377\212\217\303\377\212\220\303\377"
+ 441      8FC3FF8A 
+ 441      8FC3FF8A 
+ 441      90C3FF
+ 442 17c8 8A90C4FF 		.ascii	"\212\220\304\377\212\220\304\377\212\220\304\377\212\221\304"
+ 442      8A90C4FF 
+ 442      8A90C4FF 
+ 442      8A91C4
+ 443 17d7 FF8A91C4 		.ascii	"\377\212\221\304\377\212\221\304\377\212\221\304\377\212\222"
+ 443      FF8A91C4 
+ 443      FF8A91C4 
+ 443      FF8A92
+ 444 17e6 C4FF8A92 		.ascii	"\304\377\212\222\304\377\212\222\304\377"
+ 444      C4FF8A92 
+GAS LISTING /tmp/cceXHuAj.s 			page 30
+
+
+ 444      C4FF
+ 445 17f0 8B92C4FF 		.ascii	"\213\222\304\377\213\223\305\377\213\223\305\377\213\223\305"
+ 445      8B93C5FF 
+ 445      8B93C5FF 
+ 445      8B93C5
+ 446 17ff FF8B93C5 		.ascii	"\377\213\223\305\377\213\224\305\377\213\224\305\377\213\224"
+ 446      FF8B94C5 
+ 446      FF8B94C5 
+ 446      FF8B94
+ 447 180e C5FF8B94 		.ascii	"\305\377\213\224\305\377\213\225\305\377\213\225\305\377\213"
+ 447      C5FF8B95 
+ 447      C5FF8B95 
+ 447      C5FF8B
+ 448 181d 95C5FF8B 		.ascii	"\225\305\377\213\225\305\377\213\226\306\377\214\226\306\377"
+ 448      95C5FF8B 
+ 448      96C6FF8C 
+ 448      96C6FF
+ 449 182c 8C96C6FF 		.ascii	"\214\226\306\377\214\226\306\377\214\226\306\377\214\227\306"
+ 449      8C96C6FF 
+ 449      8C96C6FF 
+ 449      8C97C6
+ 450 183b FF8C97C6 		.ascii	"\377\214\227\306\377\214\227\307\377\214\227\307\377\214\230"
+ 450      FF8C97C7 
+ 450      FF8C97C7 
+ 450      FF8C98
+ 451 184a C7FF8C98 		.ascii	"\307\377\214\230\307\377\214\230\307\377\214\230\307\377\214"
+ 451      C7FF8C98 
+ 451      C7FF8C98 
+ 451      C7FF8C
+ 452 1859 99C7FF8C 		.ascii	"\231\307\377\214\231\310\377\214\231\310\377\214\231\310\377"
+ 452      99C8FF8C 
+ 452      99C8FF8C 
+ 452      99C8FF
+ 453 1868 8C9AC8FF 		.ascii	"\214\232\310\377\214\232\310\377\215\232\310\377\215\232\311"
+ 453      8C9AC8FF 
+ 453      8D9AC8FF 
+ 453      8D9AC9
+ 454 1877 FF8D9BC9 		.ascii	"\377\215\233\311\377\215\233\311\377\215\233\311\377\215\233"
+ 454      FF8D9BC9 
+ 454      FF8D9BC9 
+ 454      FF8D9B
+ 455 1886 C9FF8D9C 		.ascii	"\311\377\215\234\311\377\215\234\311\377\215\234\312\377\215"
+ 455      C9FF8D9C 
+ 455      C9FF8D9C 
+ 455      CAFF8D
+ 456 1895 9CCAFF8D 		.ascii	"\234\312\377\215\235\312\377\215\235\312\377\215\235\312\377"
+ 456      9DCAFF8D 
+ 456      9DCAFF8D 
+ 456      9DCAFF
+ 457 18a4 8D9DCAFF 		.ascii	"\215\235\312\377\216\236\312\377\216\236\313\377\216\236\313"
+ 457      8E9ECAFF 
+ 457      8E9ECBFF 
+ 457      8E9ECB
+ 458 18b3 FF8E9ECB 		.ascii	"\377\216\236\313\377\216\237\313\377\216\237\313\377\216\237"
+ 458      FF8E9FCB 
+ 458      FF8E9FCB 
+ 458      FF8E9F
+GAS LISTING /tmp/cceXHuAj.s 			page 31
+
+
+ 459 18c2 CBFF8E9F 		.ascii	"\313\377\216\237\313\377\216\240\313\377\216\240\314\377\216"
+ 459      CBFF8EA0 
+ 459      CBFF8EA0 
+ 459      CCFF8E
+ 460 18d1 A0CCFF8E 		.ascii	"\240\314\377\216\240\314\377\217\241\314\377\217\241\314\377"
+ 460      A0CCFF8F 
+ 460      A1CCFF8F 
+ 460      A1CCFF
+ 461 18e0 8FA1CCFF 		.ascii	"\217\241\314\377\217\241\314\377\217\241\315\377\217\242\315"
+ 461      8FA1CCFF 
+ 461      8FA1CDFF 
+ 461      8FA2CD
+ 462 18ef FF8FA2CD 		.ascii	"\377\217\242\315\377\217\242\315\377\217\242\315\377\217\243"
+ 462      FF8FA2CD 
+ 462      FF8FA2CD 
+ 462      FF8FA3
+ 463 18fe CDFF8FA3 		.ascii	"\315\377\217\243\315\377\220\243\315\377\220\243\316\377\220"
+ 463      CDFF90A3 
+ 463      CDFF90A3 
+ 463      CEFF90
+ 464 190d A4CEFF90 		.ascii	"\244\316\377\220\244\316\377\220\244\316\377\220\244\316\377"
+ 464      A4CEFF90 
+ 464      A4CEFF90 
+ 464      A4CEFF
+ 465 191c 90A5CEFF 		.ascii	"\220\245\316\377\220\245\316\377\224\255\322\377\224\255\323"
+ 465      90A5CEFF 
+ 465      94ADD2FF 
+ 465      94ADD3
+ 466 192b FF94ADD3 		.ascii	"\377\224\255\323\377\224\255\323\377\224\256\323\377\225\256"
+ 466      FF94ADD3 
+ 466      FF94AED3 
+ 466      FF95AE
+ 467 193a D3FF95AE 		.ascii	"\323\377\225\256\323\377\225\256\323\377\225\257\323\377\225"
+ 467      D3FF95AE 
+ 467      D3FF95AF 
+ 467      D3FF95
+ 468 1949 AFD3FF95 		.ascii	"\257\323\377\225\257\324\377\225\257\324\377\225\257\324\377"
+ 468      AFD4FF95 
+ 468      AFD4FF95 
+ 468      AFD4FF
+ 469 1958 96B0D4FF 		.ascii	"\226\260\324\377\226\260\324\377\226\260\324\377\226\260\324"
+ 469      96B0D4FF 
+ 469      96B0D4FF 
+ 469      96B0D4
+ 470 1967 FF96B1D4 		.ascii	"\377\226\261\324\377\226\261\325\377\226\261\325\377\227\261"
+ 470      FF96B1D5 
+ 470      FF96B1D5 
+ 470      FF97B1
+ 471 1976 D5FF97B2 		.ascii	"\325\377\227\262\325\377\227\262\325\377\227\262\325\377\227"
+ 471      D5FF97B2 
+ 471      D5FF97B2 
+ 471      D5FF97
+ 472 1985 B2D5FF97 		.ascii	"\262\325\377\227\263\325\377\227\263\325\377\227\263\326\377"
+ 472      B3D5FF97 
+ 472      B3D5FF97 
+ 472      B3D6FF
+ 473 1994 98B3D6FF 		.ascii	"\230\263\326\377\230\263\326\377\230\264\326\377\230\264\326"
+GAS LISTING /tmp/cceXHuAj.s 			page 32
+
+
+ 473      98B3D6FF 
+ 473      98B4D6FF 
+ 473      98B4D6
+ 474 19a3 FF98B4D6 		.ascii	"\377\230\264\326\377\230\264\326\377\230\265\326\377\231\265"
+ 474      FF98B4D6 
+ 474      FF98B5D6 
+ 474      FF99B5
+ 475 19b2 D6FF99B5 		.ascii	"\326\377\231\265\327\377\231\265\327\377\231\266\327\377\231"
+ 475      D7FF99B5 
+ 475      D7FF99B6 
+ 475      D7FF99
+ 476 19c1 B6D7FF99 		.ascii	"\266\327\377\231\266\327\377\232\266\327\377\232\266\327\377"
+ 476      B6D7FF9A 
+ 476      B6D7FF9A 
+ 476      B6D7FF
+ 477 19d0 9AB7D7FF 		.ascii	"\232\267\327\377\232\267\327\377\232\267\330\377\232\267\330"
+ 477      9AB7D7FF 
+ 477      9AB7D8FF 
+ 477      9AB7D8
+ 478 19df FF9BB8D8 		.ascii	"\377\233\270\330\377\233\270\330\377\233\270\330\377\233\270"
+ 478      FF9BB8D8 
+ 478      FF9BB8D8 
+ 478      FF9BB8
+ 479 19ee D8FF9BB9 		.ascii	"\330\377\233\271\330\377\233\271\330\377\234\271\330\377\234"
+ 479      D8FF9BB9 
+ 479      D8FF9CB9 
+ 479      D8FF9C
+ 480 19fd B9D8FF9C 		.ascii	"\271\330\377\234\271\331\377\234\272\331\377\234\272\331\377"
+ 480      B9D9FF9C 
+ 480      BAD9FF9C 
+ 480      BAD9FF
+ 481 1a0c 9CBAD9FF 		.ascii	"\234\272\331\377\235\272\331\377\235\273\331\377\235\273\331"
+ 481      9DBAD9FF 
+ 481      9DBBD9FF 
+ 481      9DBBD9
+ 482 1a1b FF9DBBD9 		.ascii	"\377\235\273\331\377\235\273\331\377\235\274\331\377\236\274"
+ 482      FF9DBBD9 
+ 482      FF9DBCD9 
+ 482      FF9EBC
+ 483 1a2a DAFF9EBC 		.ascii	"\332\377\236\274\332\377\236\274\332\377\236\274\332\377\237"
+ 483      DAFF9EBC 
+ 483      DAFF9EBC 
+ 483      DAFF9F
+ 484 1a39 BCDAFF9F 		.ascii	"\274\332\377\237\274\332\377\237\275\332\377\237\275\332\377"
+ 484      BCDAFF9F 
+ 484      BDDAFF9F 
+ 484      BDDAFF
+ 485 1a48 9FBDDAFF 		.ascii	"\237\275\332\377\240\275\332\377\240\275\332\377\240\275\332"
+ 485      A0BDDAFF 
+ 485      A0BDDAFF 
+ 485      A0BDDA
+ 486 1a57 FFA0BDDA 		.ascii	"\377\240\275\332\377\240\276\333\377\241\276\333\377\241\276"
+ 486      FFA0BEDB 
+ 486      FFA1BEDB 
+ 486      FFA1BE
+ 487 1a66 DBFFA1BE 		.ascii	"\333\377\241\276\333\377\241\276\333\377\241\276\333\377\242"
+ 487      DBFFA1BE 
+GAS LISTING /tmp/cceXHuAj.s 			page 33
+
+
+ 487      DBFFA1BE 
+ 487      DBFFA2
+ 488 1a75 BEDBFFA2 		.ascii	"\276\333\377\242\277\333\377\242\277\333\377\242\277\333\377"
+ 488      BFDBFFA2 
+ 488      BFDBFFA2 
+ 488      BFDBFF
+ 489 1a84 A2BFDBFF 		.ascii	"\242\277\333\377\243\277\333\377\243\277\333\377\243\277\334"
+ 489      A3BFDBFF 
+ 489      A3BFDBFF 
+ 489      A3BFDC
+ 490 1a93 FFA3C0DC 		.ascii	"\377\243\300\334\377\243\300\334\377\244\300\334\377\244\300"
+ 490      FFA3C0DC 
+ 490      FFA4C0DC 
+ 490      FFA4C0
+ 491 1aa2 DCFFA4C0 		.ascii	"\334\377\244\300\334\377\244\300\334\377\244\300\334\377\245"
+ 491      DCFFA4C0 
+ 491      DCFFA4C0 
+ 491      DCFFA5
+ 492 1ab1 C1DCFFA5 		.ascii	"\301\334\377\245\301\334\377\245\301\334\377\245\301\334\377"
+ 492      C1DCFFA5 
+ 492      C1DCFFA5 
+ 492      C1DCFF
+ 493 1ac0 A5C1DCFF 		.ascii	"\245\301\334\377\246\301\334\377\246\301\335\377\246\302\335"
+ 493      A6C1DCFF 
+ 493      A6C1DDFF 
+ 493      A6C2DD
+ 494 1acf FFA6C2DD 		.ascii	"\377\246\302\335\377\247\302\335\377\247\302\335\377\247\302"
+ 494      FFA7C2DD 
+ 494      FFA7C2DD 
+ 494      FFA7C2
+ 495 1ade DDFFA7C2 		.ascii	"\335\377\247\302\335\377\247\302\335\377\250\303\335\377\250"
+ 495      DDFFA7C2 
+ 495      DDFFA8C3 
+ 495      DDFFA8
+ 496 1aed C3DDFFA8 		.ascii	"\303\335\377\250\303\335\377\250\303\335\377\250\303\335\377"
+ 496      C3DDFFA8 
+ 496      C3DDFFA8 
+ 496      C3DDFF
+ 497 1afc A9C3DEFF 		.ascii	"\251\303\336\377\251\303\336\377\251\304\336\377\251\304\336"
+ 497      A9C3DEFF 
+ 497      A9C4DEFF 
+ 497      A9C4DE
+ 498 1b0b FFA9C4DE 		.ascii	"\377\251\304\336\377\252\304\336\377\252\304\336\377\252\304"
+ 498      FFAAC4DE 
+ 498      FFAAC4DE 
+ 498      FFAAC4
+ 499 1b1a DEFFAAC4 		.ascii	"\336\377\252\304\336\377\252\305\336\377\261\311\341\377\261"
+ 499      DEFFAAC5 
+ 499      DEFFB1C9 
+ 499      E1FFB1
+ 500 1b29 C9E1FFB2 		.ascii	"\311\341\377\262\312\341\377\262\312\341\377\262\312\341\377"
+ 500      CAE1FFB2 
+ 500      CAE1FFB2 
+ 500      CAE1FF
+ 501 1b38 B2CAE1FF 		.ascii	"\262\312\341\377\262\312\341\377\263\312\341\377\263\312\341"
+ 501      B2CAE1FF 
+ 501      B3CAE1FF 
+GAS LISTING /tmp/cceXHuAj.s 			page 34
+
+
+ 501      B3CAE1
+ 502 1b47 FFB3CBE1 		.ascii	"\377\263\313\341\377\263\313\341\377\263\313\342\377\264\313"
+ 502      FFB3CBE1 
+ 502      FFB3CBE2 
+ 502      FFB4CB
+ 503 1b56 E2FFB4CB 		.ascii	"\342\377\264\313\342\377\264\313\342\377\264\313\342\377\265"
+ 503      E2FFB4CB 
+ 503      E2FFB4CB 
+ 503      E2FFB5
+ 504 1b65 CCE2FFB5 		.ascii	"\314\342\377\265\314\342\377\265\314\342\377\265\314\342\377"
+ 504      CCE2FFB5 
+ 504      CCE2FFB5 
+ 504      CCE2FF
+ 505 1b74 B5CCE2FF 		.ascii	"\265\314\342\377\266\314\342\377\266\314\342\377\266\315\342"
+ 505      B6CCE2FF 
+ 505      B6CCE2FF 
+ 505      B6CDE2
+ 506 1b83 FFB6CDE2 		.ascii	"\377\266\315\342\377\266\315\343\377\267\315\343\377\267\315"
+ 506      FFB6CDE3 
+ 506      FFB7CDE3 
+ 506      FFB7CD
+ 507 1b92 E3FFB7CD 		.ascii	"\343\377\267\315\343\377\267\315\343\377\267\316\343\377\270"
+ 507      E3FFB7CD 
+ 507      E3FFB7CE 
+ 507      E3FFB8
+ 508 1ba1 CEE3FFB8 		.ascii	"\316\343\377\270\316\343\377\270\316\343\377\270\316\343\377"
+ 508      CEE3FFB8 
+ 508      CEE3FFB8 
+ 508      CEE3FF
+ 509 1bb0 B8CEE3FF 		.ascii	"\270\316\343\377\271\316\343\377\271\317\343\377\271\317\344"
+ 509      B9CEE3FF 
+ 509      B9CFE3FF 
+ 509      B9CFE4
+ 510 1bbf FFB9CFE4 		.ascii	"\377\271\317\344\377\272\317\344\377\272\317\344\377\272\317"
+ 510      FFBACFE4 
+ 510      FFBACFE4 
+ 510      FFBACF
+ 511 1bce E4FFBACF 		.ascii	"\344\377\272\317\344\377\272\320\344\377\273\320\344\377\273"
+ 511      E4FFBAD0 
+ 511      E4FFBBD0 
+ 511      E4FFBB
+ 512 1bdd D0E4FFBB 		.ascii	"\320\344\377\273\320\344\377\273\320\344\377\273\320\344\377"
+ 512      D0E4FFBB 
+ 512      D0E4FFBB 
+ 512      D0E4FF
+ 513 1bec BCD0E4FF 		.ascii	"\274\320\344\377\274\321\345\377\274\321\345\377\274\321\345"
+ 513      BCD1E5FF 
+ 513      BCD1E5FF 
+ 513      BCD1E5
+ 514 1bfb FFBCD1E5 		.ascii	"\377\274\321\345\377\275\321\345\377\275\321\345\377\275\321"
+ 514      FFBDD1E5 
+ 514      FFBDD1E5 
+ 514      FFBDD1
+ 515 1c0a E5FFBDD2 		.ascii	"\345\377\275\322\345\377\275\322\345\377\276\322\345\377\276"
+ 515      E5FFBDD2 
+ 515      E5FFBED2 
+ 515      E5FFBE
+GAS LISTING /tmp/cceXHuAj.s 			page 35
+
+
+ 516 1c19 D2E5FFBE 		.ascii	"\322\345\377\276\322\345\377\276\322\345\377\276\323\345\377"
+ 516      D2E5FFBE 
+ 516      D2E5FFBE 
+ 516      D3E5FF
+ 517 1c28 BFD3E6FF 		.ascii	"\277\323\346\377\277\323\346\377\277\323\346\377\277\323\346"
+ 517      BFD3E6FF 
+ 517      BFD3E6FF 
+ 517      BFD3E6
+ 518 1c37 FFBFD3E6 		.ascii	"\377\277\323\346\377\300\323\346\377\300\324\346\377\300\324"
+ 518      FFC0D3E6 
+ 518      FFC0D4E6 
+ 518      FFC0D4
+ 519 1c46 E6FFC0D4 		.ascii	"\346\377\300\324\346\377\300\324\346\377\301\324\346\377\301"
+ 519      E6FFC0D4 
+ 519      E6FFC1D4 
+ 519      E6FFC1
+ 520 1c55 D4E7FFC1 		.ascii	"\324\347\377\301\325\347\377\301\325\347\377\301\325\347\377"
+ 520      D5E7FFC1 
+ 520      D5E7FFC1 
+ 520      D5E7FF
+ 521 1c64 C2D5E7FF 		.ascii	"\302\325\347\377\302\325\347\377\302\325\347\377\302\326\347"
+ 521      C2D5E7FF 
+ 521      C2D5E7FF 
+ 521      C2D6E7
+ 522 1c73 FFC2D6E7 		.ascii	"\377\302\326\347\377\303\326\347\377\303\326\347\377\303\326"
+ 522      FFC3D6E7 
+ 522      FFC3D6E7 
+ 522      FFC3D6
+ 523 1c82 E7FFC3D6 		.ascii	"\347\377\303\326\350\377\303\326\350\377\304\327\350\377\304"
+ 523      E8FFC3D6 
+ 523      E8FFC4D7 
+ 523      E8FFC4
+ 524 1c91 D7E8FFC4 		.ascii	"\327\350\377\304\327\350\377\304\327\350\377\304\327\350\377"
+ 524      D7E8FFC4 
+ 524      D7E8FFC4 
+ 524      D7E8FF
+ 525 1ca0 C5D7E8FF 		.ascii	"\305\327\350\377\305\330\350\377\305\330\350\377\305\330\350"
+ 525      C5D8E8FF 
+ 525      C5D8E8FF 
+ 525      C5D8E8
+ 526 1caf FFC5D8E8 		.ascii	"\377\305\330\350\377\306\330\351\377\306\330\351\377\306\331"
+ 526      FFC6D8E9 
+ 526      FFC6D8E9 
+ 526      FFC6D9
+ 527 1cbe E9FFC6D9 		.ascii	"\351\377\306\331\351\377\306\331\351\377\307\331\351\377\307"
+ 527      E9FFC6D9 
+ 527      E9FFC7D9 
+ 527      E9FFC7
+ 528 1ccd D9E9FFC7 		.ascii	"\331\351\377\307\331\351\377\307\331\351\377\307\332\351\377"
+ 528      D9E9FFC7 
+ 528      D9E9FFC7 
+ 528      DAE9FF
+ 529 1cdc C8DAE9FF 		.ascii	"\310\332\351\377\310\332\352\377\310\332\352\377\310\332\352"
+ 529      C8DAEAFF 
+ 529      C8DAEAFF 
+ 529      C8DAEA
+ 530 1ceb FFC8DAEA 		.ascii	"\377\310\332\352\377\311\333\352\377\311\333\352\377\311\333"
+GAS LISTING /tmp/cceXHuAj.s 			page 36
+
+
+ 530      FFC9DBEA 
+ 530      FFC9DBEA 
+ 530      FFC9DB
+ 531 1cfa EAFFC9DB 		.ascii	"\352\377\311\333\352\377\311\333\352\377\312\333\352\377\312"
+ 531      EAFFC9DB 
+ 531      EAFFCADB 
+ 531      EAFFCA
+ 532 1d09 DBEAFFCA 		.ascii	"\333\352\377\312\334\352\377\312\334\353\377\312\334\353\377"
+ 532      DCEAFFCA 
+ 532      DCEBFFCA 
+ 532      DCEBFF
+ 533 1d18 CBDCEBFF 		.ascii	"\313\334\353\377\313\334\353\377\313\334\353\377\322\342\356"
+ 533      CBDCEBFF 
+ 533      CBDCEBFF 
+ 533      D2E2EE
+ 534 1d27 FFD2E2EE 		.ascii	"\377\322\342\356\377\322\342\356\377\322\342\356\377\323\342"
+ 534      FFD2E2EE 
+ 534      FFD2E2EE 
+ 534      FFD3E2
+ 535 1d36 EEFFD3E2 		.ascii	"\356\377\323\342\356\377\323\343\356\377\323\343\356\377\323"
+ 535      EEFFD3E3 
+ 535      EEFFD3E3 
+ 535      EEFFD3
+ 536 1d45 E3EEFFD4 		.ascii	"\343\356\377\324\343\357\377\324\343\357\377\324\343\357\377"
+ 536      E3EFFFD4 
+ 536      E3EFFFD4 
+ 536      E3EFFF
+ 537 1d54 D4E3EFFF 		.ascii	"\324\343\357\377\325\344\357\377\325\344\357\377\325\344\357"
+ 537      D5E4EFFF 
+ 537      D5E4EFFF 
+ 537      D5E4EF
+ 538 1d63 FFD5E4EF 		.ascii	"\377\325\344\357\377\325\344\357\377\326\344\357\377\326\345"
+ 538      FFD5E4EF 
+ 538      FFD6E4EF 
+ 538      FFD6E5
+ 539 1d72 EFFFD6E5 		.ascii	"\357\377\326\345\360\377\326\345\360\377\326\345\360\377\327"
+ 539      F0FFD6E5 
+ 539      F0FFD6E5 
+ 539      F0FFD7
+ 540 1d81 E5F0FFD7 		.ascii	"\345\360\377\327\345\360\377\327\345\360\377\327\346\360\377"
+ 540      E5F0FFD7 
+ 540      E5F0FFD7 
+ 540      E6F0FF
+ 541 1d90 D7E6F0FF 		.ascii	"\327\346\360\377\330\346\360\377\330\346\360\377\330\346\360"
+ 541      D8E6F0FF 
+ 541      D8E6F0FF 
+ 541      D8E6F0
+ 542 1d9f FFD8E6F1 		.ascii	"\377\330\346\361\377\331\347\361\377\331\347\361\377\331\347"
+ 542      FFD9E7F1 
+ 542      FFD9E7F1 
+ 542      FFD9E7
+ 543 1dae F1FFD9E7 		.ascii	"\361\377\331\347\361\377\331\347\361\377\332\347\361\377\332"
+ 543      F1FFD9E7 
+ 543      F1FFDAE7 
+ 543      F1FFDA
+ 544 1dbd E7F1FFDA 		.ascii	"\347\361\377\332\350\361\377\332\350\361\377\332\350\361\377"
+ 544      E8F1FFDA 
+GAS LISTING /tmp/cceXHuAj.s 			page 37
+
+
+ 544      E8F1FFDA 
+ 544      E8F1FF
+ 545 1dcc DBE8F2FF 		.ascii	"\333\350\362\377\333\350\362\377\333\350\362\377\333\351\362"
+ 545      DBE8F2FF 
+ 545      DBE8F2FF 
+ 545      DBE9F2
+ 546 1ddb FFDCE9F2 		.ascii	"\377\334\351\362\377\334\351\362\377\334\351\362\377\334\351"
+ 546      FFDCE9F2 
+ 546      FFDCE9F2 
+ 546      FFDCE9
+ 547 1dea F2FFDCE9 		.ascii	"\362\377\334\351\362\377\335\351\362\377\335\352\362\377\335"
+ 547      F2FFDDE9 
+ 547      F2FFDDEA 
+ 547      F2FFDD
+ 548 1df9 EAF2FFDD 		.ascii	"\352\362\377\335\352\363\377\336\352\363\377\336\352\363\377"
+ 548      EAF3FFDE 
+ 548      EAF3FFDE 
+ 548      EAF3FF
+ 549 1e08 DEEAF3FF 		.ascii	"\336\352\363\377\336\353\363\377\336\353\363\377\337\353\363"
+ 549      DEEBF3FF 
+ 549      DEEBF3FF 
+ 549      DFEBF3
+ 550 1e17 FFDFEBF3 		.ascii	"\377\337\353\363\377\337\353\363\377\337\353\363\377\337\354"
+ 550      FFDFEBF3 
+ 550      FFDFEBF3 
+ 550      FFDFEC
+ 551 1e26 F3FFE0EC 		.ascii	"\363\377\340\354\364\377\340\354\364\377\340\354\364\377\340"
+ 551      F4FFE0EC 
+ 551      F4FFE0EC 
+ 551      F4FFE0
+ 552 1e35 ECF4FFE0 		.ascii	"\354\364\377\340\354\364\377\340\354\364\377\340\354\364\377"
+ 552      ECF4FFE0 
+ 552      ECF4FFE0 
+ 552      ECF4FF
+ 553 1e44 E0ECF4FF 		.ascii	"\340\354\364\377\341\354\364\377\341\355\364\377\341\355\364"
+ 553      E1ECF4FF 
+ 553      E1EDF4FF 
+ 553      E1EDF4
+ 554 1e53 FFE1EDF4 		.ascii	"\377\341\355\364\377\341\355\364\377\341\355\364\377\341\355"
+ 554      FFE1EDF4 
+ 554      FFE1EDF4 
+ 554      FFE1ED
+ 555 1e62 F4FFE2ED 		.ascii	"\364\377\342\355\364\377\342\355\364\377\342\355\364\377\342"
+ 555      F4FFE2ED 
+ 555      F4FFE2ED 
+ 555      F4FFE2
+ 556 1e71 EEF4FFE2 		.ascii	"\356\364\377\342\356\364\377\342\356\365\377\342\356\365\377"
+ 556      EEF4FFE2 
+ 556      EEF5FFE2 
+ 556      EEF5FF
+ 557 1e80 E2EEF5FF 		.ascii	"\342\356\365\377\343\356\365\377\343\356\365\377\343\356\365"
+ 557      E3EEF5FF 
+ 557      E3EEF5FF 
+ 557      E3EEF5
+ 558 1e8f FFE3EEF5 		.ascii	"\377\343\356\365\377\343\356\365\377\343\357\365\377\343\357"
+ 558      FFE3EEF5 
+ 558      FFE3EFF5 
+GAS LISTING /tmp/cceXHuAj.s 			page 38
+
+
+ 558      FFE3EF
+ 559 1e9e F5FFE3EF 		.ascii	"\365\377\343\357\365\377\344\357\365\377\344\357\365\377\344"
+ 559      F5FFE4EF 
+ 559      F5FFE4EF 
+ 559      F5FFE4
+ 560 1ead EFF5FFE4 		.ascii	"\357\365\377\344\357\365\377\344\357\365\377\344\357\365\377"
+ 560      EFF5FFE4 
+ 560      EFF5FFE4 
+ 560      EFF5FF
+ 561 1ebc E4EFF5FF 		.ascii	"\344\357\365\377\345\360\365\377\345\360\365\377\345\360\366"
+ 561      E5F0F5FF 
+ 561      E5F0F5FF 
+ 561      E5F0F6
+ 562 1ecb FFE5F0F6 		.ascii	"\377\345\360\366\377\345\360\366\377\345\360\366\377\345\360"
+ 562      FFE5F0F6 
+ 562      FFE5F0F6 
+ 562      FFE5F0
+ 563 1eda F6FFE6F0 		.ascii	"\366\377\346\360\366\377\346\360\366\377\346\360\366\377\346"
+ 563      F6FFE6F0 
+ 563      F6FFE6F0 
+ 563      F6FFE6
+ 564 1ee9 F1F6FFE6 		.ascii	"\361\366\377\346\361\366\377\346\361\366\377\346\361\366\377"
+ 564      F1F6FFE6 
+ 564      F1F6FFE6 
+ 564      F1F6FF
+ 565 1ef8 E7F1F6FF 		.ascii	"\347\361\366\377\347\361\366\377\347\361\366\377\347\361\366"
+ 565      E7F1F6FF 
+ 565      E7F1F6FF 
+ 565      E7F1F6
+ 566 1f07 FFE7F1F6 		.ascii	"\377\347\361\366\377\347\361\366\377\347\362\366\377\350\362"
+ 566      FFE7F1F6 
+ 566      FFE7F2F6 
+ 566      FFE8F2
+ 567 1f16 F7FFE8F2 		.ascii	"\367\377\350\362\367\377\350\362\367\377\350\362\367\377\355"
+ 567      F7FFE8F2 
+ 567      F7FFE8F2 
+ 567      F7FFED
+ 568 1f25 F5F9FFED 		.ascii	"\365\371\377\355\365\371\377\355\365\371\377\355\366\371\377"
+ 568      F5F9FFED 
+ 568      F5F9FFED 
+ 568      F6F9FF
+ 569 1f34 EDF6F9FF 		.ascii	"\355\366\371\377\355\366\371\377\356\366\371\377\356\366\371"
+ 569      EDF6F9FF 
+ 569      EEF6F9FF 
+ 569      EEF6F9
+ 570 1f43 FFEEF6F9 		.ascii	"\377\356\366\371\377\356\366\371\377\356\366\371\377\356\366"
+ 570      FFEEF6F9 
+ 570      FFEEF6F9 
+ 570      FFEEF6
+ 571 1f52 F9FFEEF6 		.ascii	"\371\377\356\366\371\377\357\367\371\377\357\367\371\377\357"
+ 571      F9FFEFF7 
+ 571      F9FFEFF7 
+ 571      F9FFEF
+ 572 1f61 F7F9FFEF 		.ascii	"\367\371\377\357\367\371\377\357\367\371\377\357\367\372\377"
+ 572      F7F9FFEF 
+ 572      F7F9FFEF 
+ 572      F7FAFF
+GAS LISTING /tmp/cceXHuAj.s 			page 39
+
+
+ 573 1f70 F0F7FAFF 		.ascii	"\360\367\372\377\360\367\372\377\360\367\372\377\360\367\372"
+ 573      F0F7FAFF 
+ 573      F0F7FAFF 
+ 573      F0F7FA
+ 574 1f7f FFF0F8FA 		.ascii	"\377\360\370\372\377\360\370\372\377\360\370\372\377\361\370"
+ 574      FFF0F8FA 
+ 574      FFF0F8FA 
+ 574      FFF1F8
+ 575 1f8e FAFFF1F8 		.ascii	"\372\377\361\370\372\377\361\370\372\377\361\370\372\377\361"
+ 575      FAFFF1F8 
+ 575      FAFFF1F8 
+ 575      FAFFF1
+ 576 1f9d F8FAFFF1 		.ascii	"\370\372\377\361\370\372\377\361\370\372\377\362\371\372\377"
+ 576      F8FAFFF1 
+ 576      F8FAFFF2 
+ 576      F9FAFF
+ 577 1fac F2F9FBFF 		.ascii	"\362\371\373\377\362\371\373\377\362\371\373\377\362\371\373"
+ 577      F2F9FBFF 
+ 577      F2F9FBFF 
+ 577      F2F9FB
+ 578 1fbb FFF2F9FB 		.ascii	"\377\362\371\373\377"
+ 578      FF
+ 579 1fc0 F3F9FBFF 		.ascii	"\363\371\373\377\363\371\373\377\363\371\373\377\363\371\373"
+ 579      F3F9FBFF 
+ 579      F3F9FBFF 
+ 579      F3F9FB
+ 580 1fcf FFF3F9FB 		.ascii	"\377\363\371\373\377\363\372\373\377\363\372\373\377\364\372"
+ 580      FFF3FAFB 
+ 580      FFF3FAFB 
+ 580      FFF4FA
+ 581 1fde FBFFF4FA 		.ascii	"\373\377\364\372\373\377\364\372\373\377\364\372\373\377\364"
+ 581      FBFFF4FA 
+ 581      FBFFF4FA 
+ 581      FBFFF4
+ 582 1fed FAFCFFF4 		.ascii	"\372\374\377\364\372\374\377\365\372\374\377\365\372\374\377"
+ 582      FAFCFFF5 
+ 582      FAFCFFF5 
+ 582      FAFCFF
+ 583 1ffc F5FBFCFF 		.ascii	"\365\373\374\377\365\373\374\377\365\373\374\377\365\373\374"
+ 583      F5FBFCFF 
+ 583      F5FBFCFF 
+ 583      F5FBFC
+ 584 200b FFF6FBFC 		.ascii	"\377\366\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 584      FFF6FBFC 
+ 584      FFF6FBFC 
+ 584      FFF6FB
+ 585 201a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377"
+ 585      FCFFF6FB 
+ 585      FCFF
+ 586              		.globl	heatmap_cs_BuPu_soft
+ 587              		.section	.data.rel.local
+ 588              		.align 8
+ 589              		.type	heatmap_cs_BuPu_soft, @object
+ 590              		.size	heatmap_cs_BuPu_soft, 8
+ 591              	heatmap_cs_BuPu_soft:
+ 592 0010 00000000 		.quad	soft
+ 592      00000000 
+GAS LISTING /tmp/cceXHuAj.s 			page 40
+
+
+ 593              		.section	.data.rel.ro.local
+ 594              		.align 16
+ 595              		.type	soft, @object
+ 596              		.size	soft, 16
+ 597              	soft:
+ 598 0020 00000000 		.quad	soft_data
+ 598      00000000 
+ 599 0028 01040000 		.quad	1025
+ 599      00000000 
+ 600              		.section	.rodata
+ 601 2024 00000000 		.align 32
+ 601      00000000 
+ 601      00000000 
+ 601      00000000 
+ 601      00000000 
+ 602              		.type	soft_data, @object
+ 603              		.size	soft_data, 4100
+ 604              	soft_data:
+ 605 2040 00       		.string	""
+ 606 2041 00       		.string	""
+ 607 2042 00       		.string	""
+ 608 2043 00       		.string	""
+ 609 2044 4C00     		.string	"L"
+ 610 2046 4B00     		.string	"K"
+ 611 2048 4D00     		.string	"M"
+ 612 204a 4B074D00 		.string	"K\007M"
+ 613 204e 4B0E4E00 		.string	"K\016N"
+ 614 2052 4C164E00 		.string	"L\026N"
+ 615 2056 4C1D4E00 		.string	"L\035N"
+ 616 205a 4C254F00 		.string	"L%O"
+ 617 205e 4D2C4F00 		.string	"M,O"
+ 618 2062 4D345000 		.string	"M4P"
+ 619 2066 4D3B5000 		.string	"M;P"
+ 620 206a 4E435000 		.string	"NCP"
+ 621 206e 4E4A5100 		.string	"NJQ"
+ 622 2072 4F525100 		.string	"ORQ"
+ 623 2076 4F595200 		.string	"OYR"
+ 624 207a 4F615200 		.string	"OaR"
+ 625 207e 50685200 		.string	"PhR"
+ 626 2082 50705301 		.ascii	"PpS\001PwS\001Q\177T\001Q\206T\001R\215T\001R\225U\001R\234U"
+ 626      50775301 
+ 626      517F5401 
+ 626      51865401 
+ 626      528D5401 
+ 627 209d 0153A455 		.ascii	"\001S\244U\001S\253V\001S\263V\001T\272W\001T\302W\001U\311W"
+ 627      0153AB56 
+ 627      0153B356 
+ 627      0154BA57 
+ 627      0154C257 
+ 628 20b5 0255D158 		.ascii	"\002U\321X\002U\330X\002V\340Y\002V\347Y\002V\357Y\002W\366Z"
+ 628      0255D858 
+ 628      0256E059 
+ 628      0256E759 
+ 628      0256EF59 
+ 629 20cd 0257FE5A 		.ascii	"\002W\376Z\002X\377[\002X\377[\002X\377[\002Y\377\\\003Y\377"
+ 629      0258FF5B 
+ 629      0258FF5B 
+GAS LISTING /tmp/cceXHuAj.s 			page 41
+
+
+ 629      0258FF5B 
+ 629      0259FF5C 
+ 630 20e4 5C0359FF 		.ascii	"\\\003Y\377]\003Z\377]\003Z\377]\003[\377^\003[\377^\003[\377"
+ 630      5D035AFF 
+ 630      5D035AFF 
+ 630      5D035BFF 
+ 630      5E035BFF 
+ 631 20fc 5F035CFF 		.ascii	"_\003\\\377_\003\\\377_\003\\\377`\004]\377`\004]\377a\004^\377"
+ 631      5F035CFF 
+ 631      5F035CFF 
+ 631      60045DFF 
+ 631      60045DFF 
+ 632 2114 61045EFF 		.ascii	"a\004^\377a\004^\377b\004_\377b\004_\377c\004_\377c\004`\377"
+ 632      61045EFF 
+ 632      62045FFF 
+ 632      62045FFF 
+ 632      63045FFF 
+ 633 212c 630560FF 		.ascii	"c\005`\377d\005a\377d\005a\377e\005a\377e\005b\377e\005b\377"
+ 633      640561FF 
+ 633      640561FF 
+ 633      650561FF 
+ 633      650562FF 
+ 634 2144 660563FF 		.ascii	"f\005c\377f\005c\377g\005c\377g\006d\377h\006d\377h\006d\377"
+ 634      660563FF 
+ 634      670563FF 
+ 634      670664FF 
+ 634      680664FF 
+ 635 215c 680665FF 		.ascii	"h\006e\377i\006e\377i\006f\377j\006f\377j\006f\377j\007g\377"
+ 635      690665FF 
+ 635      690666FF 
+ 635      6A0666FF 
+ 635      6A0666FF 
+ 636 2174 6B0767FF 		.ascii	"k\007g\377k\007h\377l\007h\377l\007h\377l\007i\377m\007i\377"
+ 636      6B0768FF 
+ 636      6C0768FF 
+ 636      6C0768FF 
+ 636      6C0769FF 
+ 637 218c 6D0869FF 		.ascii	"m\bi\377n\bj\377n\bj\377n\bk\377o\bk\377o\bk\377p\bl\377p\tl"
+ 637      6E086AFF 
+ 637      6E086AFF 
+ 637      6E086BFF 
+ 637      6F086BFF 
+ 638 21ab FF71096D 		.ascii	"\377q\tm\377q\tm\377q\tm\377r\tn\377r\tn\377s\to\377s\no\377"
+ 638      FF71096D 
+ 638      FF71096D 
+ 638      FF72096E 
+ 638      FF72096E 
+ 639 21c8 730A6FFF 		.ascii	"s\no\377t\np\377t\np\377u\np\377u\nq\377v\013q\377v\013r\377"
+ 639      740A70FF 
+ 639      740A70FF 
+ 639      750A70FF 
+ 639      750A71FF 
+ 640 21e4 760B72FF 		.ascii	"v\013r\377w\013r\377w\013s\377x\013s\377x\013t\377x\ft\377y\f"
+ 640      770B72FF 
+ 640      770B73FF 
+ 640      780B73FF 
+ 640      780B74FF 
+GAS LISTING /tmp/cceXHuAj.s 			page 42
+
+
+ 641 21fe 74FF790C 		.ascii	"t\377y\fu\377z\fu\377z\fv\377{\fv\377{\rv\377{\rw\377|\rw\377"
+ 641      75FF7A0C 
+ 641      75FF7A0C 
+ 641      76FF7B0C 
+ 641      76FF7B0D 
+ 642 221c 7C0D78FF 		.ascii	"|\rx\377}\rx\377}\rx\377~\ry\377~\016y\377~\016z\377\177\016"
+ 642      7D0D78FF 
+ 642      7D0D78FF 
+ 642      7E0D79FF 
+ 642      7E0E79FF 
+ 643 2236 7AFF7F0E 		.ascii	"z\377\177\016z\377\200\016{\377\200\016{\377\200\017|\377\201"
+ 643      7AFF800E 
+ 643      7BFF800E 
+ 643      7BFF800F 
+ 643      7CFF81
+ 644 2249 0F7CFF81 		.ascii	"\017|\377\201\020|\377\201\021|\377\201\021}\377\201\022}\377"
+ 644      107CFF81 
+ 644      117CFF81 
+ 644      117DFF81 
+ 644      127DFF
+ 645 225c 81127DFF 		.ascii	"\201\022}\377\201\023}\377\201\024~\377\201\024~\377\201\025"
+ 645      81137DFF 
+ 645      81147EFF 
+ 645      81147EFF 
+ 645      8115
+ 646 226e 7EFF8115 		.ascii	"~\377\201\025~\377\201\026\177\377\201\026\177\377\201\027\177"
+ 646      7EFF8116 
+ 646      7FFF8116 
+ 646      7FFF8117 
+ 646      7F
+ 647 227f FF811780 		.ascii	"\377\201\027\200\377\202\030\200\377\202\031\200\377\202\031"
+ 647      FF821880 
+ 647      FF821980 
+ 647      FF8219
+ 648 228e 80FF821A 		.ascii	"\200\377\202\032\201\377\202\032\201\377\202\033\201\377\202"
+ 648      81FF821A 
+ 648      81FF821B 
+ 648      81FF82
+ 649 229d 1B81FF82 		.ascii	"\033\201\377\202\033\202\377\202\034\202\377\202\034\202\377"
+ 649      1B82FF82 
+ 649      1C82FF82 
+ 649      1C82FF
+ 650 22ac 821D82FF 		.ascii	"\202\035\202\377\202\035\203\377\202\036\203\377\202\036\203"
+ 650      821D83FF 
+ 650      821E83FF 
+ 650      821E83
+ 651 22bb FF821F83 		.ascii	"\377\202\037\203\377\202\037\204\377\202 \204\377\203 \204\377"
+ 651      FF821F84 
+ 651      FF822084 
+ 651      FF832084 
+ 651      FF
+ 652 22cc 832085FF 		.ascii	"\203 \205\377\203!\205\377\203!\205\377\203\"\205\377\203\"\206"
+ 652      832185FF 
+ 652      832185FF 
+ 652      832285FF 
+ 652      832286
+ 653 22df FF832286 		.ascii	"\377\203\"\206\377\203#\206\377\203#\206\377\203$\207\377\203"
+GAS LISTING /tmp/cceXHuAj.s 			page 43
+
+
+ 653      FF832386 
+ 653      FF832386 
+ 653      FF832487 
+ 653      FF83
+ 654 22f1 2487FF83 		.ascii	"$\207\377\203$\207\377\203%\207\377\203%\210\377\203&\210\377"
+ 654      2487FF83 
+ 654      2587FF83 
+ 654      2588FF83 
+ 654      2688FF
+ 655 2304 832688FF 		.ascii	"\203&\210\377\203&\210\377\203'\211\377\204'\211\377\204(\211"
+ 655      832688FF 
+ 655      832789FF 
+ 655      842789FF 
+ 655      842889
+ 656 2317 FF84288A 		.ascii	"\377\204(\212\377\204(\212\377\204)\212\377\204)\212\377\204"
+ 656      FF84288A 
+ 656      FF84298A 
+ 656      FF84298A 
+ 656      FF84
+ 657 2329 298BFF84 		.ascii	")\213\377\204*\213\377\204*\213\377\204+\213\377\204+\214\377"
+ 657      2A8BFF84 
+ 657      2A8BFF84 
+ 657      2B8BFF84 
+ 657      2B8CFF
+ 658 233c 842B8CFF 		.ascii	"\204+\214\377\204,\214\377\204,\214\377\204,\215\377\204-\215"
+ 658      842C8CFF 
+ 658      842C8CFF 
+ 658      842C8DFF 
+ 658      842D8D
+ 659 234f FF842D8D 		.ascii	"\377\204-\215\377\204-\215\377\205.\216\377\205.\216\377\205"
+ 659      FF842D8D 
+ 659      FF852E8E 
+ 659      FF852E8E 
+ 659      FF85
+ 660 2361 2E8EFF85 		.ascii	".\216\377\205/\216\377\205/\217\377\205/\217\377\2050\217\377"
+ 660      2F8EFF85 
+ 660      2F8FFF85 
+ 660      2F8FFF85 
+ 660      308FFF
+ 661 2374 85308FFF 		.ascii	"\2050\217\377\2050\220\377\2051\220\377\2051\220\377\2051\220"
+ 661      853090FF 
+ 661      853190FF 
+ 661      853190FF 
+ 661      853190
+ 662 2387 FF853291 		.ascii	"\377\2052\221\377\2052\221\377\2052\221\377\2053\221\377\205"
+ 662      FF853291 
+ 662      FF853291 
+ 662      FF853391 
+ 662      FF85
+ 663 2399 3392FF85 		.ascii	"3\222\377\2053\222\377\2054\222\377\2064\223\377\2064\223\377"
+ 663      3392FF85 
+ 663      3492FF86 
+ 663      3493FF86 
+ 663      3493FF
+ 664 23ac 863593FF 		.ascii	"\2065\223\377\2065\223\377\2065\224\377\2066\224\377\2066\224"
+ 664      863593FF 
+ 664      863594FF 
+GAS LISTING /tmp/cceXHuAj.s 			page 44
+
+
+ 664      863694FF 
+ 664      863694
+ 665 23bf FF863694 		.ascii	"\377\2066\224\377\2067\225\377\2067\225\377\2067\225\377\206"
+ 665      FF863795 
+ 665      FF863795 
+ 665      FF863795 
+ 665      FF86
+ 666 23d1 3895FF86 		.ascii	"8\225\377\2068\226\377\2068\226\377\2069\226\377\2069\226\377"
+ 666      3896FF86 
+ 666      3896FF86 
+ 666      3996FF86 
+ 666      3996FF
+ 667 23e4 863997FF 		.ascii	"\2069\227\377\206:\227\377\206:\227\377\206:\227\377\207:\230"
+ 667      863A97FF 
+ 667      863A97FF 
+ 667      863A97FF 
+ 667      873A98
+ 668 23f7 FF873B98 		.ascii	"\377\207;\230\377\207;\230\377\207;\230\377\207<\231\377\207"
+ 668      FF873B98 
+ 668      FF873B98 
+ 668      FF873C99 
+ 668      FF87
+ 669 2409 3C99FF87 		.ascii	"<\231\377\207<\231\377\207=\231\377\207=\232\377\207=\232\377"
+ 669      3C99FF87 
+ 669      3D99FF87 
+ 669      3D9AFF87 
+ 669      3D9AFF
+ 670 241c 873D9AFF 		.ascii	"\207=\232\377\207>\232\377\207>\233\377\207>\233\377\207?\233"
+ 670      873E9AFF 
+ 670      873E9BFF 
+ 670      873E9BFF 
+ 670      873F9B
+ 671 242f FF873F9B 		.ascii	"\377\207?\233\377\207?\234\377\207@\234\377\207@\234\377\207"
+ 671      FF873F9C 
+ 671      FF87409C 
+ 671      FF87409C 
+ 671      FF87
+ 672 2441 409CFF87 		.ascii	"@\234\377\207A\235\377\210A\235\377\210A\235\377\210B\235\377"
+ 672      419DFF88 
+ 672      419DFF88 
+ 672      419DFF88 
+ 672      429DFF
+ 673 2454 88429DFF 		.ascii	"\210B\235\377\210B\235\377\210C\236\377\210C\236\377\210C\236"
+ 673      88429DFF 
+ 673      88439EFF 
+ 673      88439EFF 
+ 673      88439E
+ 674 2467 FF88449E 		.ascii	"\377\210D\236\377\210D\236\377\210E\237\377\210E\237\377\210"
+ 674      FF88449E 
+ 674      FF88459F 
+ 674      FF88459F 
+ 674      FF88
+ 675 2479 459FFF88 		.ascii	"E\237\377\210F\237\377\210F\237\377\210F\237\377\210G\240\377"
+ 675      469FFF88 
+ 675      469FFF88 
+ 675      469FFF88 
+ 675      47A0FF
+GAS LISTING /tmp/cceXHuAj.s 			page 45
+
+
+ 676 248c 8847A0FF 		.ascii	"\210G\240\377\210G\240\377\210H\240\377\210H\240\377\210I\241"
+ 676      8847A0FF 
+ 676      8848A0FF 
+ 676      8848A0FF 
+ 676      8849A1
+ 677 249f FF8849A1 		.ascii	"\377\210I\241\377\210I\241\377\210J\241\377\210J\241\377\210"
+ 677      FF8849A1 
+ 677      FF884AA1 
+ 677      FF884AA1 
+ 677      FF88
+ 678 24b1 4AA1FF88 		.ascii	"J\241\377\210K\242\377\210K\242\377\210K\242\377\210L\242\377"
+ 678      4BA2FF88 
+ 678      4BA2FF88 
+ 678      4BA2FF88 
+ 678      4CA2FF
+ 679 24c4 884CA2FF 		.ascii	"\210L\242\377\210L\242\377\210M\243\377\210M\243\377\210M\243"
+ 679      884CA2FF 
+ 679      884DA3FF 
+ 679      884DA3FF 
+ 679      884DA3
+ 680 24d7 FF884EA3 		.ascii	"\377\210N\243\377\210N\243\377\210N\243\377\210O\244\377\210"
+ 680      FF884EA3 
+ 680      FF884EA3 
+ 680      FF884FA4 
+ 680      FF88
+ 681 24e9 4FA4FF88 		.ascii	"O\244\377\210O\244\377\210P\244\377\210P\244\377\210P\244\377"
+ 681      4FA4FF88 
+ 681      50A4FF88 
+ 681      50A4FF88 
+ 681      50A4FF
+ 682 24fc 8851A5FF 		.ascii	"\210Q\245\377\210Q\245\377\210Q\245\377\210R\245\377\210R\245"
+ 682      8851A5FF 
+ 682      8851A5FF 
+ 682      8852A5FF 
+ 682      8852A5
+ 683 250f FF8852A5 		.ascii	"\377\210R\245\377\210S\246\377\210S\246\377\210S\246\377\210"
+ 683      FF8853A6 
+ 683      FF8853A6 
+ 683      FF8853A6 
+ 683      FF88
+ 684 2521 54A6FF89 		.ascii	"T\246\377\211T\246\377\211T\246\377\211U\247\377\211U\247\377"
+ 684      54A6FF89 
+ 684      54A6FF89 
+ 684      55A7FF89 
+ 684      55A7FF
+ 685 2534 8955A7FF 		.ascii	"\211U\247\377\211V\247\377\211V\247\377\211V\247\377\211W\250"
+ 685      8956A7FF 
+ 685      8956A7FF 
+ 685      8956A7FF 
+ 685      8957A8
+ 686 2547 FF8957A8 		.ascii	"\377\211W\250\377\211W\250\377\211X\250\377\211X\250\377\211"
+ 686      FF8957A8 
+ 686      FF8958A8 
+ 686      FF8958A8 
+ 686      FF89
+ 687 2559 58A8FF89 		.ascii	"X\250\377\211Y\250\377\211Y\251\377\211Y\251\377\211Z\251\377"
+ 687      59A8FF89 
+GAS LISTING /tmp/cceXHuAj.s 			page 46
+
+
+ 687      59A9FF89 
+ 687      59A9FF89 
+ 687      5AA9FF
+ 688 256c 895AA9FF 		.ascii	"\211Z\251\377\211Z\251\377\211[\251\377\211[\252\377\211[\252"
+ 688      895AA9FF 
+ 688      895BA9FF 
+ 688      895BAAFF 
+ 688      895BAA
+ 689 257f FF895CAA 		.ascii	"\377\211\\\252\377\211\\\252\377\211\\\252\377\211\\\252\377"
+ 689      FF895CAA 
+ 689      FF895CAA 
+ 689      FF895CAA 
+ 689      FF
+ 690 2590 895DAAFF 		.ascii	"\211]\252\377\211]\253\377\211]\253\377\211^\253\377\212^\253"
+ 690      895DABFF 
+ 690      895DABFF 
+ 690      895EABFF 
+ 690      8A5EAB
+ 691 25a3 FF8A5EAB 		.ascii	"\377\212^\253\377\212_\253\377\212_\253\377\212_\254\377\212"
+ 691      FF8A5FAB 
+ 691      FF8A5FAB 
+ 691      FF8A5FAC 
+ 691      FF8A
+ 692 25b5 60ACFF8A 		.ascii	"`\254\377\212`\254\377\212`\254\377\212a\254\377\212a\254\377"
+ 692      60ACFF8A 
+ 692      60ACFF8A 
+ 692      61ACFF8A 
+ 692      61ACFF
+ 693 25c8 8A61ACFF 		.ascii	"\212a\254\377\212a\255\377\212b\255\377\212b\255\377\212b\255"
+ 693      8A61ADFF 
+ 693      8A62ADFF 
+ 693      8A62ADFF 
+ 693      8A62AD
+ 694 25db FF8A63AD 		.ascii	"\377\212c\255\377\212c\255\377\212c\255\377\212d\256\377\212"
+ 694      FF8A63AD 
+ 694      FF8A63AD 
+ 694      FF8A64AE 
+ 694      FF8A
+ 695 25ed 64AEFF8A 		.ascii	"d\256\377\212d\256\377\212d\256\377\212e\256\377\213e\256\377"
+ 695      64AEFF8A 
+ 695      64AEFF8A 
+ 695      65AEFF8B 
+ 695      65AEFF
+ 696 2600 8B65AEFF 		.ascii	"\213e\256\377\213f\256\377\213f\257\377\213f\257\377\213g\257"
+ 696      8B66AEFF 
+ 696      8B66AFFF 
+ 696      8B66AFFF 
+ 696      8B67AF
+ 697 2613 FF8B67AF 		.ascii	"\377\213g\257\377\213g\257\377\213h\257\377\213h\257\377\213"
+ 697      FF8B67AF 
+ 697      FF8B68AF 
+ 697      FF8B68AF 
+ 697      FF8B
+ 698 2625 68AFFF8B 		.ascii	"h\257\377\213h\260\377\213i\260\377\213i\260\377\213i\260\377"
+ 698      68B0FF8B 
+ 698      69B0FF8B 
+ 698      69B0FF8B 
+GAS LISTING /tmp/cceXHuAj.s 			page 47
+
+
+ 698      69B0FF
+ 699 2638 8B6AB0FF 		.ascii	"\213j\260\377\213j\260\377\213j\260\377\213k\261\377\213k\261"
+ 699      8B6AB0FF 
+ 699      8B6AB0FF 
+ 699      8B6BB1FF 
+ 699      8B6BB1
+ 700 264b FF8B6BB1 		.ascii	"\377\213k\261\377\213l\261\377\213l\261\377\213l\262\377\213"
+ 700      FF8B6CB1 
+ 700      FF8B6CB1 
+ 700      FF8B6CB2 
+ 700      FF8B
+ 701 265d 6DB2FF8B 		.ascii	"m\262\377\213m\262\377\213m\262\377\213n\263\377\213n\263\377"
+ 701      6DB2FF8B 
+ 701      6DB2FF8B 
+ 701      6EB3FF8B 
+ 701      6EB3FF
+ 702 2670 8B6FB3FF 		.ascii	"\213o\263\377\213o\263\377\213o\264\377\212p\264\377\212p\264"
+ 702      8B6FB3FF 
+ 702      8B6FB4FF 
+ 702      8A70B4FF 
+ 702      8A70B4
+ 703 2683 FF8A70B4 		.ascii	"\377\212p\264\377\212q\264\377\212q\265\377\212q\265\377\212"
+ 703      FF8A71B4 
+ 703      FF8A71B5 
+ 703      FF8A71B5 
+ 703      FF8A
+ 704 2695 72B5FF8A 		.ascii	"r\265\377\212r\265\377\212s\266\377\212s\266\377\212s\266\377"
+ 704      72B5FF8A 
+ 704      73B6FF8A 
+ 704      73B6FF8A 
+ 704      73B6FF
+ 705 26a8 8A74B6FF 		.ascii	"\212t\266\377\212t\266\377\212t\267\377\212u\267\377\212u\267"
+ 705      8A74B6FF 
+ 705      8A74B7FF 
+ 705      8A75B7FF 
+ 705      8A75B7
+ 706 26bb FF8975B7 		.ascii	"\377\211u\267\377\211v\267\377\211v\270\377\211v\270\377\211"
+ 706      FF8976B7 
+ 706      FF8976B8 
+ 706      FF8976B8 
+ 706      FF89
+ 707 26cd 77B8FF89 		.ascii	"w\270\377\211w\270\377\211w\270\377\211x\271\377\211x\271\377"
+ 707      77B8FF89 
+ 707      77B8FF89 
+ 707      78B9FF89 
+ 707      78B9FF
+ 708 26e0 8979B9FF 		.ascii	"\211y\271\377\211y\271\377\211y\271\377\211z\272\377\211z\272"
+ 708      8979B9FF 
+ 708      8979B9FF 
+ 708      897ABAFF 
+ 708      897ABA
+ 709 26f3 FF897ABA 		.ascii	"\377\211z\272\377\211{\272\377\211{\272\377\211{\273\377\211"
+ 709      FF897BBA 
+ 709      FF897BBA 
+ 709      FF897BBB 
+ 709      FF89
+ 710 2705 7CBBFF89 		.ascii	"|\273\377\211|\273\377\211|\273\377\211}\273\377\211}\273\377"
+GAS LISTING /tmp/cceXHuAj.s 			page 48
+
+
+ 710      7CBBFF89 
+ 710      7CBBFF89 
+ 710      7DBBFF89 
+ 710      7DBBFF
+ 711 2718 897DBCFF 		.ascii	"\211}\274\377\211~\274\377\211~\274\377\210~\274\377\210\177"
+ 711      897EBCFF 
+ 711      897EBCFF 
+ 711      887EBCFF 
+ 711      887F
+ 712 272a BCFF887F 		.ascii	"\274\377\210\177\274\377\210\177\275\377\210\200\275\377\210"
+ 712      BCFF887F 
+ 712      BDFF8880 
+ 712      BDFF88
+ 713 2739 80BDFF88 		.ascii	"\200\275\377\210\200\275\377\210\201\275\377\210\201\275\377"
+ 713      80BDFF88 
+ 713      81BDFF88 
+ 713      81BDFF
+ 714 2748 8881BEFF 		.ascii	"\210\201\276\377\210\202\276\377\210\202\276\377\210\202\276"
+ 714      8882BEFF 
+ 714      8882BEFF 
+ 714      8882BE
+ 715 2757 FF8883BE 		.ascii	"\377\210\203\276\377\210\203\276\377\210\203\277\377\210\204"
+ 715      FF8883BE 
+ 715      FF8883BF 
+ 715      FF8884
+ 716 2766 BFFF8884 		.ascii	"\277\377\210\204\277\377\210\204\277\377\210\205\277\377\210"
+ 716      BFFF8884 
+ 716      BFFF8885 
+ 716      BFFF88
+ 717 2775 85BFFF88 		.ascii	"\205\277\377\210\205\277\377\210\206\300\377\210\206\300\377"
+ 717      85BFFF88 
+ 717      86C0FF88 
+ 717      86C0FF
+ 718 2784 8886C0FF 		.ascii	"\210\206\300\377\211\207\300\377\211\207\300\377\211\207\300"
+ 718      8987C0FF 
+ 718      8987C0FF 
+ 718      8987C0
+ 719 2793 FF8988C0 		.ascii	"\377\211\210\300\377\211\210\301\377\211\210\301\377\211\211"
+ 719      FF8988C1 
+ 719      FF8988C1 
+ 719      FF8989
+ 720 27a2 C1FF8989 		.ascii	"\301\377\211\211\301\377\211\211\301\377\211\212\301\377\211"
+ 720      C1FF8989 
+ 720      C1FF898A 
+ 720      C1FF89
+ 721 27b1 8AC1FF89 		.ascii	"\212\301\377\211\212\302\377\211\213\302\377\211\213\302\377"
+ 721      8AC2FF89 
+ 721      8BC2FF89 
+ 721      8BC2FF
+ 722 27c0 898BC2FF 		.ascii	"\211\213\302\377\211\214\302\377\211\214\302\377\211\214\302"
+ 722      898CC2FF 
+ 722      898CC2FF 
+ 722      898CC2
+ 723 27cf FF898CC2 		.ascii	"\377\211\214\302\377\211\215\303\377\211\215\303\377\211\215"
+ 723      FF898DC3 
+ 723      FF898DC3 
+ 723      FF898D
+GAS LISTING /tmp/cceXHuAj.s 			page 49
+
+
+ 724 27de C3FF898E 		.ascii	"\303\377\211\216\303\377\211\216\303\377\212\216\303\377\212"
+ 724      C3FF898E 
+ 724      C3FF8A8E 
+ 724      C3FF8A
+ 725 27ed 8FC3FF8A 		.ascii	"\217\303\377\212\217\303\377\212\217\303\377\212\220\304\377"
+ 725      8FC3FF8A 
+ 725      8FC3FF8A 
+ 725      90C4FF
+ 726 27fc 8A90C4FF 		.ascii	"\212\220\304\377\212\220\304\377\212\221\304\377\212\221\304"
+ 726      8A90C4FF 
+ 726      8A91C4FF 
+ 726      8A91C4
+ 727 280b FF8A91C4 		.ascii	"\377\212\221\304\377"
+ 727      FF
+ 728 2810 8A91C4FF 		.ascii	"\212\221\304\377\212\222\304\377\212\222\304\377\213\222\305"
+ 728      8A92C4FF 
+ 728      8A92C4FF 
+ 728      8B92C5
+ 729 281f FF8B93C5 		.ascii	"\377\213\223\305\377\213\223\305\377\213\223\305\377\213\224"
+ 729      FF8B93C5 
+ 729      FF8B93C5 
+ 729      FF8B94
+ 730 282e C5FF8B94 		.ascii	"\305\377\213\224\305\377\213\224\305\377\213\225\305\377\213"
+ 730      C5FF8B94 
+ 730      C5FF8B95 
+ 730      C5FF8B
+ 731 283d 95C5FF8B 		.ascii	"\225\305\377\213\225\305\377\213\226\306\377\214\226\306\377"
+ 731      95C5FF8B 
+ 731      96C6FF8C 
+ 731      96C6FF
+ 732 284c 8C96C6FF 		.ascii	"\214\226\306\377\214\226\306\377\214\227\306\377\214\227\306"
+ 732      8C96C6FF 
+ 732      8C97C6FF 
+ 732      8C97C6
+ 733 285b FF8C97C7 		.ascii	"\377\214\227\307\377\214\230\307\377\214\230\307\377\214\230"
+ 733      FF8C98C7 
+ 733      FF8C98C7 
+ 733      FF8C98
+ 734 286a C7FF8C99 		.ascii	"\307\377\214\231\307\377\214\231\310\377\214\231\310\377\214"
+ 734      C7FF8C99 
+ 734      C8FF8C99 
+ 734      C8FF8C
+ 735 2879 9AC8FF8C 		.ascii	"\232\310\377\214\232\310\377\214\232\310\377\215\232\311\377"
+ 735      9AC8FF8C 
+ 735      9AC8FF8D 
+ 735      9AC9FF
+ 736 2888 8D9BC9FF 		.ascii	"\215\233\311\377\215\233\311\377\215\233\311\377\215\234\311"
+ 736      8D9BC9FF 
+ 736      8D9BC9FF 
+ 736      8D9CC9
+ 737 2897 FF8D9CC9 		.ascii	"\377\215\234\311\377\215\234\312\377\215\235\312\377\215\235"
+ 737      FF8D9CCA 
+ 737      FF8D9DCA 
+ 737      FF8D9D
+ 738 28a6 CAFF8D9D 		.ascii	"\312\377\215\235\312\377\215\236\312\377\215\236\313\377\216"
+ 738      CAFF8D9E 
+ 738      CAFF8D9E 
+GAS LISTING /tmp/cceXHuAj.s 			page 50
+
+
+ 738      CBFF8E
+ 739 28b5 9ECBFF8E 		.ascii	"\236\313\377\216\236\313\377\216\237\313\377\216\237\313\377"
+ 739      9ECBFF8E 
+ 739      9FCBFF8E 
+ 739      9FCBFF
+ 740 28c4 8E9FCBFF 		.ascii	"\216\237\313\377\216\240\314\377\216\240\314\377\216\240\314"
+ 740      8EA0CCFF 
+ 740      8EA0CCFF 
+ 740      8EA0CC
+ 741 28d3 FF8EA1CC 		.ascii	"\377\216\241\314\377\216\241\314\377\217\241\314\377\217\241"
+ 741      FF8EA1CC 
+ 741      FF8FA1CC 
+ 741      FF8FA1
+ 742 28e2 CDFF8FA2 		.ascii	"\315\377\217\242\315\377\217\242\315\377\217\242\315\377\217"
+ 742      CDFF8FA2 
+ 742      CDFF8FA2 
+ 742      CDFF8F
+ 743 28f1 A3CDFF8F 		.ascii	"\243\315\377\217\243\315\377\217\243\316\377\217\244\316\377"
+ 743      A3CDFF8F 
+ 743      A3CEFF8F 
+ 743      A4CEFF
+ 744 2900 90A4CEFF 		.ascii	"\220\244\316\377\220\244\316\377\220\244\316\377\220\245\316"
+ 744      90A4CEFF 
+ 744      90A4CEFF 
+ 744      90A5CE
+ 745 290f FF90A5CF 		.ascii	"\377\220\245\317\377\220\245\317\377\220\246\317\377\220\246"
+ 745      FF90A5CF 
+ 745      FF90A6CF 
+ 745      FF90A6
+ 746 291e CFFF90A6 		.ascii	"\317\377\220\246\317\377\221\247\317\377\221\247\320\377\221"
+ 746      CFFF91A7 
+ 746      CFFF91A7 
+ 746      D0FF91
+ 747 292d A7D0FF91 		.ascii	"\247\320\377\221\247\320\377\221\250\320\377\221\250\320\377"
+ 747      A7D0FF91 
+ 747      A8D0FF91 
+ 747      A8D0FF
+ 748 293c 91A8D0FF 		.ascii	"\221\250\320\377\222\251\320\377\222\251\321\377\222\251\321"
+ 748      92A9D0FF 
+ 748      92A9D1FF 
+ 748      92A9D1
+ 749 294b FF92AAD1 		.ascii	"\377\222\252\321\377\222\252\321\377\222\252\321\377\222\252"
+ 749      FF92AAD1 
+ 749      FF92AAD1 
+ 749      FF92AA
+ 750 295a D1FF93AB 		.ascii	"\321\377\223\253\322\377\223\253\322\377\223\253\322\377\223"
+ 750      D2FF93AB 
+ 750      D2FF93AB 
+ 750      D2FF93
+ 751 2969 ACD2FF93 		.ascii	"\254\322\377\223\254\322\377\223\254\322\377\223\254\322\377"
+ 751      ACD2FF93 
+ 751      ACD2FF93 
+ 751      ACD2FF
+ 752 2978 94ADD3FF 		.ascii	"\224\255\323\377\224\255\323\377\224\255\323\377\224\256\323"
+ 752      94ADD3FF 
+ 752      94ADD3FF 
+ 752      94AED3
+GAS LISTING /tmp/cceXHuAj.s 			page 51
+
+
+ 753 2987 FF94AED3 		.ascii	"\377\224\256\323\377\224\256\323\377\225\257\323\377\225\257"
+ 753      FF94AED3 
+ 753      FF95AFD3 
+ 753      FF95AF
+ 754 2996 D4FF95AF 		.ascii	"\324\377\225\257\324\377\225\257\324\377\225\260\324\377\225"
+ 754      D4FF95AF 
+ 754      D4FF95B0 
+ 754      D4FF95
+ 755 29a5 B0D4FF96 		.ascii	"\260\324\377\226\260\324\377\226\261\324\377\226\261\325\377"
+ 755      B0D4FF96 
+ 755      B1D4FF96 
+ 755      B1D5FF
+ 756 29b4 96B1D5FF 		.ascii	"\226\261\325\377\226\261\325\377\227\262\325\377\227\262\325"
+ 756      96B1D5FF 
+ 756      97B2D5FF 
+ 756      97B2D5
+ 757 29c3 FF97B2D5 		.ascii	"\377\227\262\325\377\227\263\325\377\227\263\326\377\227\263"
+ 757      FF97B3D5 
+ 757      FF97B3D6 
+ 757      FF97B3
+ 758 29d2 D6FF98B3 		.ascii	"\326\377\230\263\326\377\230\264\326\377\230\264\326\377\230"
+ 758      D6FF98B4 
+ 758      D6FF98B4 
+ 758      D6FF98
+ 759 29e1 B4D6FF98 		.ascii	"\264\326\377\230\265\326\377\231\265\327\377\231\265\327\377"
+ 759      B5D6FF99 
+ 759      B5D7FF99 
+ 759      B5D7FF
+ 760 29f0 99B6D7FF 		.ascii	"\231\266\327\377\231\266\327\377\231\266\327\377\232\266\327"
+ 760      99B6D7FF 
+ 760      99B6D7FF 
+ 760      9AB6D7
+ 761 29ff FF9AB7D7 		.ascii	"\377\232\267\327\377\232\267\327\377\232\267\330\377\232\270"
+ 761      FF9AB7D7 
+ 761      FF9AB7D8 
+ 761      FF9AB8
+ 762 2a0e D8FF9BB8 		.ascii	"\330\377\233\270\330\377\233\270\330\377\233\270\330\377\233"
+ 762      D8FF9BB8 
+ 762      D8FF9BB8 
+ 762      D8FF9B
+ 763 2a1d B9D8FF9B 		.ascii	"\271\330\377\233\271\330\377\234\271\330\377\234\272\331\377"
+ 763      B9D8FF9C 
+ 763      B9D8FF9C 
+ 763      BAD9FF
+ 764 2a2c 9CBAD9FF 		.ascii	"\234\272\331\377\234\272\331\377\235\272\331\377\235\273\331"
+ 764      9CBAD9FF 
+ 764      9DBAD9FF 
+ 764      9DBBD9
+ 765 2a3b FF9DBBD9 		.ascii	"\377\235\273\331\377\235\273\331\377\235\274\331\377\236\274"
+ 765      FF9DBBD9 
+ 765      FF9DBCD9 
+ 765      FF9EBC
+ 766 2a4a DAFF9EBC 		.ascii	"\332\377\236\274\332\377\236\274\332\377\237\274\332\377\237"
+ 766      DAFF9EBC 
+ 766      DAFF9FBC 
+ 766      DAFF9F
+ 767 2a59 BCDAFF9F 		.ascii	"\274\332\377\237\275\332\377\237\275\332\377\240\275\332\377"
+GAS LISTING /tmp/cceXHuAj.s 			page 52
+
+
+ 767      BDDAFF9F 
+ 767      BDDAFFA0 
+ 767      BDDAFF
+ 768 2a68 A0BDDAFF 		.ascii	"\240\275\332\377\240\275\332\377\240\275\333\377\241\276\333"
+ 768      A0BDDAFF 
+ 768      A0BDDBFF 
+ 768      A1BEDB
+ 769 2a77 FFA1BEDB 		.ascii	"\377\241\276\333\377\241\276\333\377\241\276\333\377\242\276"
+ 769      FFA1BEDB 
+ 769      FFA1BEDB 
+ 769      FFA2BE
+ 770 2a86 DBFFA2BF 		.ascii	"\333\377\242\277\333\377\242\277\333\377\242\277\333\377\243"
+ 770      DBFFA2BF 
+ 770      DBFFA2BF 
+ 770      DBFFA3
+ 771 2a95 BFDBFFA3 		.ascii	"\277\333\377\243\277\333\377\243\277\334\377\243\300\334\377"
+ 771      BFDBFFA3 
+ 771      BFDCFFA3 
+ 771      C0DCFF
+ 772 2aa4 A4C0DCFF 		.ascii	"\244\300\334\377\244\300\334\377\244\300\334\377\244\300\334"
+ 772      A4C0DCFF 
+ 772      A4C0DCFF 
+ 772      A4C0DC
+ 773 2ab3 FFA5C1DC 		.ascii	"\377\245\301\334\377\245\301\334\377\245\301\334\377\245\301"
+ 773      FFA5C1DC 
+ 773      FFA5C1DC 
+ 773      FFA5C1
+ 774 2ac2 DCFFA6C1 		.ascii	"\334\377\246\301\334\377\246\301\335\377\246\302\335\377\246"
+ 774      DCFFA6C1 
+ 774      DDFFA6C2 
+ 774      DDFFA6
+ 775 2ad1 C2DDFFA7 		.ascii	"\302\335\377\247\302\335\377\247\302\335\377\247\302\335\377"
+ 775      C2DDFFA7 
+ 775      C2DDFFA7 
+ 775      C2DDFF
+ 776 2ae0 A7C2DDFF 		.ascii	"\247\302\335\377\250\303\335\377\250\303\335\377\250\303\335"
+ 776      A8C3DDFF 
+ 776      A8C3DDFF 
+ 776      A8C3DD
+ 777 2aef FFA9C3DE 		.ascii	"\377\251\303\336\377\251\303\336\377\251\304\336\377\251\304"
+ 777      FFA9C3DE 
+ 777      FFA9C4DE 
+ 777      FFA9C4
+ 778 2afe DEFFAAC4 		.ascii	"\336\377\252\304\336\377\252\304\336\377\252\304\336\377\252"
+ 778      DEFFAAC4 
+ 778      DEFFAAC4 
+ 778      DEFFAA
+ 779 2b0d C4DEFFAB 		.ascii	"\304\336\377\253\305\336\377\253\305\336\377\253\305\336\377"
+ 779      C5DEFFAB 
+ 779      C5DEFFAB 
+ 779      C5DEFF
+ 780 2b1c ABC5DFFF 		.ascii	"\253\305\337\377\254\305\337\377\254\306\337\377\254\306\337"
+ 780      ACC5DFFF 
+ 780      ACC6DFFF 
+ 780      ACC6DF
+ 781 2b2b FFACC6DF 		.ascii	"\377\254\306\337\377\255\306\337\377\255\306\337\377\255\306"
+ 781      FFADC6DF 
+GAS LISTING /tmp/cceXHuAj.s 			page 53
+
+
+ 781      FFADC6DF 
+ 781      FFADC6
+ 782 2b3a DFFFADC7 		.ascii	"\337\377\255\307\337\377\256\307\337\377\256\307\337\377\256"
+ 782      DFFFAEC7 
+ 782      DFFFAEC7 
+ 782      DFFFAE
+ 783 2b49 C7E0FFAE 		.ascii	"\307\340\377\256\307\340\377\257\310\340\377\257\310\340\377"
+ 783      C7E0FFAF 
+ 783      C8E0FFAF 
+ 783      C8E0FF
+ 784 2b58 AFC8E0FF 		.ascii	"\257\310\340\377\257\310\340\377\260\310\340\377\260\310\340"
+ 784      AFC8E0FF 
+ 784      B0C8E0FF 
+ 784      B0C8E0
+ 785 2b67 FFB0C9E0 		.ascii	"\377\260\311\340\377\260\311\340\377\261\311\341\377\261\311"
+ 785      FFB0C9E0 
+ 785      FFB1C9E1 
+ 785      FFB1C9
+ 786 2b76 E1FFB1C9 		.ascii	"\341\377\261\311\341\377\262\312\341\377\262\312\341\377\262"
+ 786      E1FFB2CA 
+ 786      E1FFB2CA 
+ 786      E1FFB2
+ 787 2b85 CAE1FFB2 		.ascii	"\312\341\377\262\312\341\377\263\312\341\377\263\312\341\377"
+ 787      CAE1FFB3 
+ 787      CAE1FFB3 
+ 787      CAE1FF
+ 788 2b94 B3CBE1FF 		.ascii	"\263\313\341\377\263\313\341\377\264\313\342\377\264\313\342"
+ 788      B3CBE1FF 
+ 788      B4CBE2FF 
+ 788      B4CBE2
+ 789 2ba3 FFB4CBE2 		.ascii	"\377\264\313\342\377\264\313\342\377\265\314\342\377\265\314"
+ 789      FFB4CBE2 
+ 789      FFB5CCE2 
+ 789      FFB5CC
+ 790 2bb2 E2FFB5CC 		.ascii	"\342\377\265\314\342\377\265\314\342\377\266\314\342\377\266"
+ 790      E2FFB5CC 
+ 790      E2FFB6CC 
+ 790      E2FFB6
+ 791 2bc1 CDE2FFB6 		.ascii	"\315\342\377\266\315\342\377\266\315\343\377\267\315\343\377"
+ 791      CDE2FFB6 
+ 791      CDE3FFB7 
+ 791      CDE3FF
+ 792 2bd0 B7CDE3FF 		.ascii	"\267\315\343\377\267\315\343\377\267\316\343\377\270\316\343"
+ 792      B7CDE3FF 
+ 792      B7CEE3FF 
+ 792      B8CEE3
+ 793 2bdf FFB8CEE3 		.ascii	"\377\270\316\343\377\270\316\343\377\271\316\343\377\271\317"
+ 793      FFB8CEE3 
+ 793      FFB9CEE3 
+ 793      FFB9CF
+ 794 2bee E3FFB9CF 		.ascii	"\343\377\271\317\344\377\271\317\344\377\272\317\344\377\272"
+ 794      E4FFB9CF 
+ 794      E4FFBACF 
+ 794      E4FFBA
+ 795 2bfd CFE4FFBA 		.ascii	"\317\344\377\272\317\344\377\272\320\344\377\273\320\344\377"
+ 795      CFE4FFBA 
+ 795      D0E4FFBB 
+GAS LISTING /tmp/cceXHuAj.s 			page 54
+
+
+ 795      D0E4FF
+ 796 2c0c BBD0E4FF 		.ascii	"\273\320\344\377\273\320\344\377\273\320\344\377\274\321\344"
+ 796      BBD0E4FF 
+ 796      BBD0E4FF 
+ 796      BCD1E4
+ 797 2c1b FFBCD1E5 		.ascii	"\377\274\321\345\377\274\321\345\377\274\321\345\377\275\321"
+ 797      FFBCD1E5 
+ 797      FFBCD1E5 
+ 797      FFBDD1
+ 798 2c2a E5FFBDD1 		.ascii	"\345\377\275\321\345\377\275\322\345\377\275\322\345\377\276"
+ 798      E5FFBDD2 
+ 798      E5FFBDD2 
+ 798      E5FFBE
+ 799 2c39 D2E5FFBE 		.ascii	"\322\345\377\276\322\345\377\276\322\345\377\276\323\345\377"
+ 799      D2E5FFBE 
+ 799      D2E5FFBE 
+ 799      D3E5FF
+ 800 2c48 BFD3E6FF 		.ascii	"\277\323\346\377\277\323\346\377\277\323\346\377\277\323\346"
+ 800      BFD3E6FF 
+ 800      BFD3E6FF 
+ 800      BFD3E6
+ 801 2c57 FFC0D3E6 		.ascii	"\377\300\323\346\377\300\324\346\377\300\324\346\377\300\324"
+ 801      FFC0D4E6 
+ 801      FFC0D4E6 
+ 801      FFC0D4
+ 802 2c66 E6FFC1D4 		.ascii	"\346\377\301\324\346\377\301\324\347\377\301\325\347\377\301"
+ 802      E6FFC1D4 
+ 802      E7FFC1D5 
+ 802      E7FFC1
+ 803 2c75 D5E7FFC2 		.ascii	"\325\347\377\302\325\347\377\302\325\347\377\302\325\347\377"
+ 803      D5E7FFC2 
+ 803      D5E7FFC2 
+ 803      D5E7FF
+ 804 2c84 C2D6E7FF 		.ascii	"\302\326\347\377\303\326\347\377\303\326\347\377\303\326\350"
+ 804      C3D6E7FF 
+ 804      C3D6E7FF 
+ 804      C3D6E8
+ 805 2c93 FFC3D6E8 		.ascii	"\377\303\326\350\377\304\327\350\377\304\327\350\377\304\327"
+ 805      FFC4D7E8 
+ 805      FFC4D7E8 
+ 805      FFC4D7
+ 806 2ca2 E8FFC4D7 		.ascii	"\350\377\304\327\350\377\305\327\350\377\305\330\350\377\305"
+ 806      E8FFC5D7 
+ 806      E8FFC5D8 
+ 806      E8FFC5
+ 807 2cb1 D8E8FFC5 		.ascii	"\330\350\377\305\330\350\377\306\330\351\377\306\330\351\377"
+ 807      D8E8FFC6 
+ 807      D8E9FFC6 
+ 807      D8E9FF
+ 808 2cc0 C6D9E9FF 		.ascii	"\306\331\351\377\306\331\351\377\307\331\351\377\307\331\351"
+ 808      C6D9E9FF 
+ 808      C7D9E9FF 
+ 808      C7D9E9
+ 809 2ccf FFC7D9E9 		.ascii	"\377\307\331\351\377\307\332\351\377\310\332\351\377\310\332"
+ 809      FFC7DAE9 
+ 809      FFC8DAE9 
+ 809      FFC8DA
+GAS LISTING /tmp/cceXHuAj.s 			page 55
+
+
+ 810 2cde EAFFC8DA 		.ascii	"\352\377\310\332\352\377\310\332\352\377\311\333\352\377\311"
+ 810      EAFFC8DA 
+ 810      EAFFC9DB 
+ 810      EAFFC9
+ 811 2ced DBEAFFC9 		.ascii	"\333\352\377\311\333\352\377\311\333\352\377\312\333\352\377"
+ 811      DBEAFFC9 
+ 811      DBEAFFCA 
+ 811      DBEAFF
+ 812 2cfc CADCEAFF 		.ascii	"\312\334\352\377\312\334\353\377\312\334\353\377\313\334\353"
+ 812      CADCEBFF 
+ 812      CADCEBFF 
+ 812      CBDCEB
+ 813 2d0b FFCBDCEB 		.ascii	"\377\313\334\353\377\313\335\353\377\313\335\353\377\314\335"
+ 813      FFCBDDEB 
+ 813      FFCBDDEB 
+ 813      FFCCDD
+ 814 2d1a EBFFCCDD 		.ascii	"\353\377\314\335\353\377\314\335\353\377\314\336\354\377\315"
+ 814      EBFFCCDD 
+ 814      EBFFCCDE 
+ 814      ECFFCD
+ 815 2d29 DEECFFCD 		.ascii	"\336\354\377\315\336\354\377\315\336\354\377\315\336\354\377"
+ 815      DEECFFCD 
+ 815      DEECFFCD 
+ 815      DEECFF
+ 816 2d38 CEDFECFF 		.ascii	"\316\337\354\377\316\337\354\377\316\337\354\377\316\337\354"
+ 816      CEDFECFF 
+ 816      CEDFECFF 
+ 816      CEDFEC
+ 817 2d47 FFCFDFEC 		.ascii	"\377\317\337\354\377\317\337\355\377\317\340\355\377\317\340"
+ 817      FFCFDFED 
+ 817      FFCFE0ED 
+ 817      FFCFE0
+ 818 2d56 EDFFD0E0 		.ascii	"\355\377\320\340\355\377\320\340\355\377\320\340\355\377\320"
+ 818      EDFFD0E0 
+ 818      EDFFD0E0 
+ 818      EDFFD0
+ 819 2d65 E1EDFFD1 		.ascii	"\341\355\377\321\341\355\377\321\341\355\377\321\341\356\377"
+ 819      E1EDFFD1 
+ 819      E1EDFFD1 
+ 819      E1EEFF
+ 820 2d74 D2E1EEFF 		.ascii	"\322\341\356\377\322\342\356\377\322\342\356\377\322\342\356"
+ 820      D2E2EEFF 
+ 820      D2E2EEFF 
+ 820      D2E2EE
+ 821 2d83 FFD3E2EE 		.ascii	"\377\323\342\356\377\323\342\356\377\323\343\356\377\323\343"
+ 821      FFD3E2EE 
+ 821      FFD3E3EE 
+ 821      FFD3E3
+ 822 2d92 EEFFD4E3 		.ascii	"\356\377\324\343\357\377\324\343\357\377\324\343\357\377\324"
+ 822      EFFFD4E3 
+ 822      EFFFD4E3 
+ 822      EFFFD4
+ 823 2da1 E4EFFFD5 		.ascii	"\344\357\377\325\344\357\377\325\344\357\377\325\344\357\377"
+ 823      E4EFFFD5 
+ 823      E4EFFFD5 
+ 823      E4EFFF
+ 824 2db0 D5E4EFFF 		.ascii	"\325\344\357\377\326\345\357\377\326\345\360\377\326\345\360"
+GAS LISTING /tmp/cceXHuAj.s 			page 56
+
+
+ 824      D6E5EFFF 
+ 824      D6E5F0FF 
+ 824      D6E5F0
+ 825 2dbf FFD7E5F0 		.ascii	"\377\327\345\360\377\327\345\360\377\327\346\360\377\327\346"
+ 825      FFD7E5F0 
+ 825      FFD7E6F0 
+ 825      FFD7E6
+ 826 2dce F0FFD8E6 		.ascii	"\360\377\330\346\360\377\330\346\360\377\330\346\360\377\330"
+ 826      F0FFD8E6 
+ 826      F0FFD8E6 
+ 826      F0FFD8
+ 827 2ddd E6F1FFD9 		.ascii	"\346\361\377\331\347\361\377\331\347\361\377\331\347\361\377"
+ 827      E7F1FFD9 
+ 827      E7F1FFD9 
+ 827      E7F1FF
+ 828 2dec DAE7F1FF 		.ascii	"\332\347\361\377\332\347\361\377\332\350\361\377\332\350\361"
+ 828      DAE7F1FF 
+ 828      DAE8F1FF 
+ 828      DAE8F1
+ 829 2dfb FFDBE8F1 		.ascii	"\377\333\350\361\377\333\350\362\377\333\350\362\377\333\351"
+ 829      FFDBE8F2 
+ 829      FFDBE8F2 
+ 829      FFDBE9
+ 830 2e0a F2FFDCE9 		.ascii	"\362\377\334\351\362\377\334\351\362\377\334\351\362\377\334"
+ 830      F2FFDCE9 
+ 830      F2FFDCE9 
+ 830      F2FFDC
+ 831 2e19 E9F2FFDD 		.ascii	"\351\362\377\335\352\362\377\335\352\362\377\335\352\363\377"
+ 831      EAF2FFDD 
+ 831      EAF2FFDD 
+ 831      EAF3FF
+ 832 2e28 DEEAF3FF 		.ascii	"\336\352\363\377\336\352\363\377\336\353\363\377\336\353\363"
+ 832      DEEAF3FF 
+ 832      DEEBF3FF 
+ 832      DEEBF3
+ 833 2e37 FFDFEBF3 		.ascii	"\377\337\353\363\377\337\353\363\377\337\353\363\377\337\354"
+ 833      FFDFEBF3 
+ 833      FFDFEBF3 
+ 833      FFDFEC
+ 834 2e46 F3FFE0EC 		.ascii	"\363\377\340\354\364\377\340\354\364\377\340\354\364\377\340"
+ 834      F4FFE0EC 
+ 834      F4FFE0EC 
+ 834      F4FFE0
+ 835 2e55 ECF4FFE0 		.ascii	"\354\364\377\340\354\364\377\340\354\364\377\341\354\364\377"
+ 835      ECF4FFE0 
+ 835      ECF4FFE1 
+ 835      ECF4FF
+ 836 2e64 E1EDF4FF 		.ascii	"\341\355\364\377\341\355\364\377\341\355\364\377\341\355\364"
+ 836      E1EDF4FF 
+ 836      E1EDF4FF 
+ 836      E1EDF4
+ 837 2e73 FFE1EDF4 		.ascii	"\377\341\355\364\377\342\355\364\377\342\355\364\377\342\355"
+ 837      FFE2EDF4 
+ 837      FFE2EDF4 
+ 837      FFE2ED
+ 838 2e82 F4FFE2EE 		.ascii	"\364\377\342\356\364\377\342\356\365\377\342\356\365\377\342"
+ 838      F4FFE2EE 
+GAS LISTING /tmp/cceXHuAj.s 			page 57
+
+
+ 838      F5FFE2EE 
+ 838      F5FFE2
+ 839 2e91 EEF5FFE3 		.ascii	"\356\365\377\343\356\365\377\343\356\365\377\343\356\365\377"
+ 839      EEF5FFE3 
+ 839      EEF5FFE3 
+ 839      EEF5FF
+ 840 2ea0 E3EFF5FF 		.ascii	"\343\357\365\377\343\357\365\377\343\357\365\377\344\357\365"
+ 840      E3EFF5FF 
+ 840      E3EFF5FF 
+ 840      E4EFF5
+ 841 2eaf FFE4EFF5 		.ascii	"\377\344\357\365\377\344\357\365\377\344\357\365\377\344\357"
+ 841      FFE4EFF5 
+ 841      FFE4EFF5 
+ 841      FFE4EF
+ 842 2ebe F5FFE4F0 		.ascii	"\365\377\344\360\365\377\345\360\365\377\345\360\366\377\345"
+ 842      F5FFE5F0 
+ 842      F5FFE5F0 
+ 842      F6FFE5
+ 843 2ecd F0F6FFE5 		.ascii	"\360\366\377\345\360\366\377\345\360\366\377\345\360\366\377"
+ 843      F0F6FFE5 
+ 843      F0F6FFE5 
+ 843      F0F6FF
+ 844 2edc E6F0F6FF 		.ascii	"\346\360\366\377\346\361\366\377\346\361\366\377\346\361\366"
+ 844      E6F1F6FF 
+ 844      E6F1F6FF 
+ 844      E6F1F6
+ 845 2eeb FFE6F1F6 		.ascii	"\377\346\361\366\377\347\361\366\377\347\361\366\377\347\361"
+ 845      FFE7F1F6 
+ 845      FFE7F1F6 
+ 845      FFE7F1
+ 846 2efa F6FFE7F1 		.ascii	"\366\377\347\361\366\377\347\362\366\377\347\362\366\377\350"
+ 846      F6FFE7F2 
+ 846      F6FFE7F2 
+ 846      F6FFE8
+ 847 2f09 F2F7FFE8 		.ascii	"\362\367\377\350\362\367\377\350\362\367\377\350\362\367\377"
+ 847      F2F7FFE8 
+ 847      F2F7FFE8 
+ 847      F2F7FF
+ 848 2f18 E8F2F7FF 		.ascii	"\350\362\367\377\350\362\367\377\351\363\367\377\351\363\367"
+ 848      E8F2F7FF 
+ 848      E9F3F7FF 
+ 848      E9F3F7
+ 849 2f27 FFE9F3F7 		.ascii	"\377\351\363\367\377\351\363\367\377\351\363\367\377\352\363"
+ 849      FFE9F3F7 
+ 849      FFE9F3F7 
+ 849      FFEAF3
+ 850 2f36 F7FFEAF3 		.ascii	"\367\377\352\363\367\377\352\363\367\377\352\364\367\377\352"
+ 850      F7FFEAF3 
+ 850      F7FFEAF4 
+ 850      F7FFEA
+ 851 2f45 F4F8FFEA 		.ascii	"\364\370\377\352\364\370\377\353\364\370\377\353\364\370\377"
+ 851      F4F8FFEB 
+ 851      F4F8FFEB 
+ 851      F4F8FF
+ 852 2f54 EBF4F8FF 		.ascii	"\353\364\370\377\353\364\370\377\353\364\370\377\354\365\370"
+ 852      EBF4F8FF 
+ 852      EBF4F8FF 
+GAS LISTING /tmp/cceXHuAj.s 			page 58
+
+
+ 852      ECF5F8
+ 853 2f63 FFECF5F8 		.ascii	"\377\354\365\370\377\354\365\370\377\354\365\370\377\354\365"
+ 853      FFECF5F8 
+ 853      FFECF5F8 
+ 853      FFECF5
+ 854 2f72 F8FFECF5 		.ascii	"\370\377\354\365\370\377\355\365\370\377\355\365\371\377\355"
+ 854      F8FFEDF5 
+ 854      F8FFEDF5 
+ 854      F9FFED
+ 855 2f81 F6F9FFED 		.ascii	"\366\371\377\355\366\371\377\355\366\371\377\356\366\371\377"
+ 855      F6F9FFED 
+ 855      F6F9FFEE 
+ 855      F6F9FF
+ 856 2f90 EEF6F9FF 		.ascii	"\356\366\371\377\356\366\371\377\356\366\371\377\356\366\371"
+ 856      EEF6F9FF 
+ 856      EEF6F9FF 
+ 856      EEF6F9
+ 857 2f9f FFEFF7F9 		.ascii	"\377\357\367\371\377\357\367\371\377\357\367\371\377\357\367"
+ 857      FFEFF7F9 
+ 857      FFEFF7F9 
+ 857      FFEFF7
+ 858 2fae F9FFEFF7 		.ascii	"\371\377\357\367\371\377\357\367\372\377\360\367\372\377\360"
+ 858      F9FFEFF7 
+ 858      FAFFF0F7 
+ 858      FAFFF0
+ 859 2fbd F7FAFFF0 		.ascii	"\367\372\377\360\370\372\377\360\370\372\377\360\370\372\377"
+ 859      F8FAFFF0 
+ 859      F8FAFFF0 
+ 859      F8FAFF
+ 860 2fcc F1F8FAFF 		.ascii	"\361\370\372\377\361\370\372\377\361\370\372\377\361\370\372"
+ 860      F1F8FAFF 
+ 860      F1F8FAFF 
+ 860      F1F8FA
+ 861 2fdb FFF1F8FA 		.ascii	"\377\361\370\372\377"
+ 861      FF
+ 862 2fe0 F2F9FAFF 		.ascii	"\362\371\372\377\362\371\372\377\362\371\373\377\362\371\373"
+ 862      F2F9FAFF 
+ 862      F2F9FBFF 
+ 862      F2F9FB
+ 863 2fef FFF2F9FB 		.ascii	"\377\362\371\373\377\363\371\373\377\363\371\373\377\363\371"
+ 863      FFF3F9FB 
+ 863      FFF3F9FB 
+ 863      FFF3F9
+ 864 2ffe FBFFF3F9 		.ascii	"\373\377\363\371\373\377\363\372\373\377\364\372\373\377\364"
+ 864      FBFFF3FA 
+ 864      FBFFF4FA 
+ 864      FBFFF4
+ 865 300d FAFBFFF4 		.ascii	"\372\373\377\364\372\373\377\364\372\373\377\364\372\374\377"
+ 865      FAFBFFF4 
+ 865      FAFBFFF4 
+ 865      FAFCFF
+ 866 301c F5FAFCFF 		.ascii	"\365\372\374\377\365\372\374\377\365\373\374\377\365\373\374"
+ 866      F5FAFCFF 
+ 866      F5FBFCFF 
+ 866      F5FBFC
+ 867 302b FFF5FBFC 		.ascii	"\377\365\373\374\377\366\373\374\377\366\373\374\377\366\373"
+ 867      FFF6FBFC 
+GAS LISTING /tmp/cceXHuAj.s 			page 59
+
+
+ 867      FFF6FBFC 
+ 867      FFF6FB
+ 868 303a FCFFF6FB 		.ascii	"\374\377\366\373\374\377\366\373\374\377"
+ 868      FCFFF6FB 
+ 868      FCFF
+ 869              		.globl	heatmap_cs_BuPu_discrete
+ 870              		.section	.data.rel.local
+ 871              		.align 8
+ 872              		.type	heatmap_cs_BuPu_discrete, @object
+ 873              		.size	heatmap_cs_BuPu_discrete, 8
+ 874              	heatmap_cs_BuPu_discrete:
+ 875 0018 00000000 		.quad	discrete
+ 875      00000000 
+ 876              		.section	.data.rel.ro.local
+ 877              		.align 16
+ 878              		.type	discrete, @object
+ 879              		.size	discrete, 16
+ 880              	discrete:
+ 881 0030 00000000 		.quad	discrete_data
+ 881      00000000 
+ 882 0038 0A000000 		.quad	10
+ 882      00000000 
+ 883              		.section	.rodata
+ 884 3044 00000000 		.align 32
+ 884      00000000 
+ 884      00000000 
+ 884      00000000 
+ 884      00000000 
+ 885              		.type	discrete_data, @object
+ 886              		.size	discrete_data, 40
+ 887              	discrete_data:
+ 888 3060 00       		.string	""
+ 889 3061 00       		.string	""
+ 890 3062 00       		.string	""
+ 891 3063 00       		.string	""
+ 892 3064 4D00     		.string	"M"
+ 893 3066 4BFF810F 		.ascii	"K\377\201\017|\377\210A\235\377\214k\261\377\214\226\306\377"
+ 893      7CFF8841 
+ 893      9DFF8C6B 
+ 893      B1FF8C96 
+ 893      C6FF
+ 894 3078 9EBCDAFF 		.ascii	"\236\274\332\377\277\323\346\377\340\354\364\377\367\374\375"
+ 894      BFD3E6FF 
+ 894      E0ECF4FF 
+ 894      F7FCFD
+ 895 3087 FF       		.ascii	"\377"
+ 896              		.text
+ 897              	.Letext0:
+ 898              		.file 1 "./heatmap.h"
+ 899              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 900              		.file 3 "./colorschemes/BuPu.h"
+ 901              		.file 4 "colorschemes/BuPu.c"
+ 902              		.section	.debug_info,"",@progbits
+ 903              	.Ldebug_info0:
+ 904 0000 E3010000 		.long	0x1e3
+ 905 0004 0500     		.value	0x5
+ 906 0006 01       		.byte	0x1
+GAS LISTING /tmp/cceXHuAj.s 			page 60
+
+
+ 907 0007 08       		.byte	0x8
+ 908 0008 00000000 		.long	.Ldebug_abbrev0
+ 909 000c 0A       		.uleb128 0xa
+ 910 000d 00000000 		.long	.LASF26
+ 911 0011 1D       		.byte	0x1d
+ 912 0012 00000000 		.long	.LASF0
+ 913 0016 00000000 		.long	.LASF1
+ 914 001a 00000000 		.long	.Ldebug_line0
+ 915 001e 01       		.uleb128 0x1
+ 916 001f 08       		.byte	0x8
+ 917 0020 05       		.byte	0x5
+ 918 0021 00000000 		.long	.LASF2
+ 919 0025 06       		.uleb128 0x6
+ 920 0026 00000000 		.long	.LASF12
+ 921 002a 02       		.byte	0x2
+ 922 002b D6       		.byte	0xd6
+ 923 002c 17       		.byte	0x17
+ 924 002d 31000000 		.long	0x31
+ 925 0031 01       		.uleb128 0x1
+ 926 0032 08       		.byte	0x8
+ 927 0033 07       		.byte	0x7
+ 928 0034 00000000 		.long	.LASF3
+ 929 0038 0B       		.uleb128 0xb
+ 930 0039 04       		.byte	0x4
+ 931 003a 05       		.byte	0x5
+ 932 003b 696E7400 		.string	"int"
+ 933 003f 01       		.uleb128 0x1
+ 934 0040 08       		.byte	0x8
+ 935 0041 05       		.byte	0x5
+ 936 0042 00000000 		.long	.LASF4
+ 937 0046 01       		.uleb128 0x1
+ 938 0047 10       		.byte	0x10
+ 939 0048 04       		.byte	0x4
+ 940 0049 00000000 		.long	.LASF5
+ 941 004d 01       		.uleb128 0x1
+ 942 004e 04       		.byte	0x4
+ 943 004f 04       		.byte	0x4
+ 944 0050 00000000 		.long	.LASF6
+ 945 0054 01       		.uleb128 0x1
+ 946 0055 04       		.byte	0x4
+ 947 0056 07       		.byte	0x7
+ 948 0057 00000000 		.long	.LASF7
+ 949 005b 01       		.uleb128 0x1
+ 950 005c 02       		.byte	0x2
+ 951 005d 07       		.byte	0x7
+ 952 005e 00000000 		.long	.LASF8
+ 953 0062 0C       		.uleb128 0xc
+ 954 0063 10       		.byte	0x10
+ 955 0064 01       		.byte	0x1
+ 956 0065 BB       		.byte	0xbb
+ 957 0066 09       		.byte	0x9
+ 958 0067 84000000 		.long	0x84
+ 959 006b 07       		.uleb128 0x7
+ 960 006c 00000000 		.long	.LASF9
+ 961 0070 BC       		.byte	0xbc
+ 962 0071 1A       		.byte	0x1a
+ 963 0072 84000000 		.long	0x84
+GAS LISTING /tmp/cceXHuAj.s 			page 61
+
+
+ 964 0076 00       		.byte	0
+ 965 0077 07       		.uleb128 0x7
+ 966 0078 00000000 		.long	.LASF10
+ 967 007c BD       		.byte	0xbd
+ 968 007d 0C       		.byte	0xc
+ 969 007e 25000000 		.long	0x25
+ 970 0082 08       		.byte	0x8
+ 971 0083 00       		.byte	0
+ 972 0084 08       		.uleb128 0x8
+ 973 0085 90000000 		.long	0x90
+ 974 0089 01       		.uleb128 0x1
+ 975 008a 01       		.byte	0x1
+ 976 008b 08       		.byte	0x8
+ 977 008c 00000000 		.long	.LASF11
+ 978 0090 03       		.uleb128 0x3
+ 979 0091 89000000 		.long	0x89
+ 980 0095 06       		.uleb128 0x6
+ 981 0096 00000000 		.long	.LASF13
+ 982 009a 01       		.byte	0x1
+ 983 009b BE       		.byte	0xbe
+ 984 009c 03       		.byte	0x3
+ 985 009d 62000000 		.long	0x62
+ 986 00a1 03       		.uleb128 0x3
+ 987 00a2 95000000 		.long	0x95
+ 988 00a6 08       		.uleb128 0x8
+ 989 00a7 A1000000 		.long	0xa1
+ 990 00ab 04       		.uleb128 0x4
+ 991 00ac 00000000 		.long	.LASF14
+ 992 00b0 21       		.byte	0x21
+ 993 00b1 A6000000 		.long	0xa6
+ 994 00b5 04       		.uleb128 0x4
+ 995 00b6 00000000 		.long	.LASF15
+ 996 00ba 23       		.byte	0x23
+ 997 00bb A6000000 		.long	0xa6
+ 998 00bf 04       		.uleb128 0x4
+ 999 00c0 00000000 		.long	.LASF16
+ 1000 00c4 25       		.byte	0x25
+ 1001 00c5 A6000000 		.long	0xa6
+ 1002 00c9 04       		.uleb128 0x4
+ 1003 00ca 00000000 		.long	.LASF17
+ 1004 00ce 28       		.byte	0x28
+ 1005 00cf A6000000 		.long	0xa6
+ 1006 00d3 09       		.uleb128 0x9
+ 1007 00d4 90000000 		.long	0x90
+ 1008 00d8 E3000000 		.long	0xe3
+ 1009 00dc 0D       		.uleb128 0xd
+ 1010 00dd 31000000 		.long	0x31
+ 1011 00e1 27       		.byte	0x27
+ 1012 00e2 00       		.byte	0
+ 1013 00e3 03       		.uleb128 0x3
+ 1014 00e4 D3000000 		.long	0xd3
+ 1015 00e8 02       		.uleb128 0x2
+ 1016 00e9 00000000 		.long	.LASF18
+ 1017 00ed 20       		.byte	0x20
+ 1018 00ee 1C       		.byte	0x1c
+ 1019 00ef E3000000 		.long	0xe3
+ 1020 00f3 09       		.uleb128 0x9
+GAS LISTING /tmp/cceXHuAj.s 			page 62
+
+
+ 1021 00f4 03       		.byte	0x3
+ 1022 00f5 00000000 		.quad	discrete_data
+ 1022      00000000 
+ 1023 00fd 02       		.uleb128 0x2
+ 1024 00fe 00000000 		.long	.LASF19
+ 1025 0102 23       		.byte	0x23
+ 1026 0103 24       		.byte	0x24
+ 1027 0104 A1000000 		.long	0xa1
+ 1028 0108 09       		.uleb128 0x9
+ 1029 0109 03       		.byte	0x3
+ 1030 010a 00000000 		.quad	discrete
+ 1030      00000000 
+ 1031 0112 05       		.uleb128 0x5
+ 1032 0113 AB000000 		.long	0xab
+ 1033 0117 24       		.byte	0x24
+ 1034 0118 09       		.uleb128 0x9
+ 1035 0119 03       		.byte	0x3
+ 1036 011a 00000000 		.quad	heatmap_cs_BuPu_discrete
+ 1036      00000000 
+ 1037 0122 09       		.uleb128 0x9
+ 1038 0123 90000000 		.long	0x90
+ 1039 0127 33010000 		.long	0x133
+ 1040 012b 0E       		.uleb128 0xe
+ 1041 012c 31000000 		.long	0x31
+ 1042 0130 0310     		.value	0x1003
+ 1043 0132 00       		.byte	0
+ 1044 0133 03       		.uleb128 0x3
+ 1045 0134 22010000 		.long	0x122
+ 1046 0138 02       		.uleb128 0x2
+ 1047 0139 00000000 		.long	.LASF20
+ 1048 013d 26       		.byte	0x26
+ 1049 013e 1C       		.byte	0x1c
+ 1050 013f 33010000 		.long	0x133
+ 1051 0143 09       		.uleb128 0x9
+ 1052 0144 03       		.byte	0x3
+ 1053 0145 00000000 		.quad	soft_data
+ 1053      00000000 
+ 1054 014d 02       		.uleb128 0x2
+ 1055 014e 00000000 		.long	.LASF21
+ 1056 0152 29       		.byte	0x29
+ 1057 0153 24       		.byte	0x24
+ 1058 0154 A1000000 		.long	0xa1
+ 1059 0158 09       		.uleb128 0x9
+ 1060 0159 03       		.byte	0x3
+ 1061 015a 00000000 		.quad	soft
+ 1061      00000000 
+ 1062 0162 05       		.uleb128 0x5
+ 1063 0163 B5000000 		.long	0xb5
+ 1064 0167 2A       		.byte	0x2a
+ 1065 0168 09       		.uleb128 0x9
+ 1066 0169 03       		.byte	0x3
+ 1067 016a 00000000 		.quad	heatmap_cs_BuPu_soft
+ 1067      00000000 
+ 1068 0172 02       		.uleb128 0x2
+ 1069 0173 00000000 		.long	.LASF22
+ 1070 0177 2C       		.byte	0x2c
+ 1071 0178 1C       		.byte	0x1c
+GAS LISTING /tmp/cceXHuAj.s 			page 63
+
+
+ 1072 0179 33010000 		.long	0x133
+ 1073 017d 09       		.uleb128 0x9
+ 1074 017e 03       		.byte	0x3
+ 1075 017f 00000000 		.quad	mixed_data
+ 1075      00000000 
+ 1076 0187 02       		.uleb128 0x2
+ 1077 0188 00000000 		.long	.LASF23
+ 1078 018c 2F       		.byte	0x2f
+ 1079 018d 24       		.byte	0x24
+ 1080 018e A1000000 		.long	0xa1
+ 1081 0192 09       		.uleb128 0x9
+ 1082 0193 03       		.byte	0x3
+ 1083 0194 00000000 		.quad	mixed
+ 1083      00000000 
+ 1084 019c 05       		.uleb128 0x5
+ 1085 019d BF000000 		.long	0xbf
+ 1086 01a1 30       		.byte	0x30
+ 1087 01a2 09       		.uleb128 0x9
+ 1088 01a3 03       		.byte	0x3
+ 1089 01a4 00000000 		.quad	heatmap_cs_BuPu_mixed
+ 1089      00000000 
+ 1090 01ac 02       		.uleb128 0x2
+ 1091 01ad 00000000 		.long	.LASF24
+ 1092 01b1 32       		.byte	0x32
+ 1093 01b2 1C       		.byte	0x1c
+ 1094 01b3 33010000 		.long	0x133
+ 1095 01b7 09       		.uleb128 0x9
+ 1096 01b8 03       		.byte	0x3
+ 1097 01b9 00000000 		.quad	mixed_exp_data
+ 1097      00000000 
+ 1098 01c1 02       		.uleb128 0x2
+ 1099 01c2 00000000 		.long	.LASF25
+ 1100 01c6 35       		.byte	0x35
+ 1101 01c7 24       		.byte	0x24
+ 1102 01c8 A1000000 		.long	0xa1
+ 1103 01cc 09       		.uleb128 0x9
+ 1104 01cd 03       		.byte	0x3
+ 1105 01ce 00000000 		.quad	mixed_exp
+ 1105      00000000 
+ 1106 01d6 05       		.uleb128 0x5
+ 1107 01d7 C9000000 		.long	0xc9
+ 1108 01db 36       		.byte	0x36
+ 1109 01dc 09       		.uleb128 0x9
+ 1110 01dd 03       		.byte	0x3
+ 1111 01de 00000000 		.quad	heatmap_cs_BuPu_mixed_exp
+ 1111      00000000 
+ 1112 01e6 00       		.byte	0
+ 1113              		.section	.debug_abbrev,"",@progbits
+ 1114              	.Ldebug_abbrev0:
+ 1115 0000 01       		.uleb128 0x1
+ 1116 0001 24       		.uleb128 0x24
+ 1117 0002 00       		.byte	0
+ 1118 0003 0B       		.uleb128 0xb
+ 1119 0004 0B       		.uleb128 0xb
+ 1120 0005 3E       		.uleb128 0x3e
+ 1121 0006 0B       		.uleb128 0xb
+ 1122 0007 03       		.uleb128 0x3
+GAS LISTING /tmp/cceXHuAj.s 			page 64
+
+
+ 1123 0008 0E       		.uleb128 0xe
+ 1124 0009 00       		.byte	0
+ 1125 000a 00       		.byte	0
+ 1126 000b 02       		.uleb128 0x2
+ 1127 000c 34       		.uleb128 0x34
+ 1128 000d 00       		.byte	0
+ 1129 000e 03       		.uleb128 0x3
+ 1130 000f 0E       		.uleb128 0xe
+ 1131 0010 3A       		.uleb128 0x3a
+ 1132 0011 21       		.uleb128 0x21
+ 1133 0012 04       		.sleb128 4
+ 1134 0013 3B       		.uleb128 0x3b
+ 1135 0014 0B       		.uleb128 0xb
+ 1136 0015 39       		.uleb128 0x39
+ 1137 0016 0B       		.uleb128 0xb
+ 1138 0017 49       		.uleb128 0x49
+ 1139 0018 13       		.uleb128 0x13
+ 1140 0019 02       		.uleb128 0x2
+ 1141 001a 18       		.uleb128 0x18
+ 1142 001b 00       		.byte	0
+ 1143 001c 00       		.byte	0
+ 1144 001d 03       		.uleb128 0x3
+ 1145 001e 26       		.uleb128 0x26
+ 1146 001f 00       		.byte	0
+ 1147 0020 49       		.uleb128 0x49
+ 1148 0021 13       		.uleb128 0x13
+ 1149 0022 00       		.byte	0
+ 1150 0023 00       		.byte	0
+ 1151 0024 04       		.uleb128 0x4
+ 1152 0025 34       		.uleb128 0x34
+ 1153 0026 00       		.byte	0
+ 1154 0027 03       		.uleb128 0x3
+ 1155 0028 0E       		.uleb128 0xe
+ 1156 0029 3A       		.uleb128 0x3a
+ 1157 002a 21       		.uleb128 0x21
+ 1158 002b 03       		.sleb128 3
+ 1159 002c 3B       		.uleb128 0x3b
+ 1160 002d 0B       		.uleb128 0xb
+ 1161 002e 39       		.uleb128 0x39
+ 1162 002f 21       		.uleb128 0x21
+ 1163 0030 25       		.sleb128 37
+ 1164 0031 49       		.uleb128 0x49
+ 1165 0032 13       		.uleb128 0x13
+ 1166 0033 3F       		.uleb128 0x3f
+ 1167 0034 19       		.uleb128 0x19
+ 1168 0035 3C       		.uleb128 0x3c
+ 1169 0036 19       		.uleb128 0x19
+ 1170 0037 00       		.byte	0
+ 1171 0038 00       		.byte	0
+ 1172 0039 05       		.uleb128 0x5
+ 1173 003a 34       		.uleb128 0x34
+ 1174 003b 00       		.byte	0
+ 1175 003c 47       		.uleb128 0x47
+ 1176 003d 13       		.uleb128 0x13
+ 1177 003e 3A       		.uleb128 0x3a
+ 1178 003f 21       		.uleb128 0x21
+ 1179 0040 04       		.sleb128 4
+GAS LISTING /tmp/cceXHuAj.s 			page 65
+
+
+ 1180 0041 3B       		.uleb128 0x3b
+ 1181 0042 0B       		.uleb128 0xb
+ 1182 0043 39       		.uleb128 0x39
+ 1183 0044 21       		.uleb128 0x21
+ 1184 0045 1E       		.sleb128 30
+ 1185 0046 02       		.uleb128 0x2
+ 1186 0047 18       		.uleb128 0x18
+ 1187 0048 00       		.byte	0
+ 1188 0049 00       		.byte	0
+ 1189 004a 06       		.uleb128 0x6
+ 1190 004b 16       		.uleb128 0x16
+ 1191 004c 00       		.byte	0
+ 1192 004d 03       		.uleb128 0x3
+ 1193 004e 0E       		.uleb128 0xe
+ 1194 004f 3A       		.uleb128 0x3a
+ 1195 0050 0B       		.uleb128 0xb
+ 1196 0051 3B       		.uleb128 0x3b
+ 1197 0052 0B       		.uleb128 0xb
+ 1198 0053 39       		.uleb128 0x39
+ 1199 0054 0B       		.uleb128 0xb
+ 1200 0055 49       		.uleb128 0x49
+ 1201 0056 13       		.uleb128 0x13
+ 1202 0057 00       		.byte	0
+ 1203 0058 00       		.byte	0
+ 1204 0059 07       		.uleb128 0x7
+ 1205 005a 0D       		.uleb128 0xd
+ 1206 005b 00       		.byte	0
+ 1207 005c 03       		.uleb128 0x3
+ 1208 005d 0E       		.uleb128 0xe
+ 1209 005e 3A       		.uleb128 0x3a
+ 1210 005f 21       		.uleb128 0x21
+ 1211 0060 01       		.sleb128 1
+ 1212 0061 3B       		.uleb128 0x3b
+ 1213 0062 0B       		.uleb128 0xb
+ 1214 0063 39       		.uleb128 0x39
+ 1215 0064 0B       		.uleb128 0xb
+ 1216 0065 49       		.uleb128 0x49
+ 1217 0066 13       		.uleb128 0x13
+ 1218 0067 38       		.uleb128 0x38
+ 1219 0068 0B       		.uleb128 0xb
+ 1220 0069 00       		.byte	0
+ 1221 006a 00       		.byte	0
+ 1222 006b 08       		.uleb128 0x8
+ 1223 006c 0F       		.uleb128 0xf
+ 1224 006d 00       		.byte	0
+ 1225 006e 0B       		.uleb128 0xb
+ 1226 006f 21       		.uleb128 0x21
+ 1227 0070 08       		.sleb128 8
+ 1228 0071 49       		.uleb128 0x49
+ 1229 0072 13       		.uleb128 0x13
+ 1230 0073 00       		.byte	0
+ 1231 0074 00       		.byte	0
+ 1232 0075 09       		.uleb128 0x9
+ 1233 0076 01       		.uleb128 0x1
+ 1234 0077 01       		.byte	0x1
+ 1235 0078 49       		.uleb128 0x49
+ 1236 0079 13       		.uleb128 0x13
+GAS LISTING /tmp/cceXHuAj.s 			page 66
+
+
+ 1237 007a 01       		.uleb128 0x1
+ 1238 007b 13       		.uleb128 0x13
+ 1239 007c 00       		.byte	0
+ 1240 007d 00       		.byte	0
+ 1241 007e 0A       		.uleb128 0xa
+ 1242 007f 11       		.uleb128 0x11
+ 1243 0080 01       		.byte	0x1
+ 1244 0081 25       		.uleb128 0x25
+ 1245 0082 0E       		.uleb128 0xe
+ 1246 0083 13       		.uleb128 0x13
+ 1247 0084 0B       		.uleb128 0xb
+ 1248 0085 03       		.uleb128 0x3
+ 1249 0086 1F       		.uleb128 0x1f
+ 1250 0087 1B       		.uleb128 0x1b
+ 1251 0088 1F       		.uleb128 0x1f
+ 1252 0089 10       		.uleb128 0x10
+ 1253 008a 17       		.uleb128 0x17
+ 1254 008b 00       		.byte	0
+ 1255 008c 00       		.byte	0
+ 1256 008d 0B       		.uleb128 0xb
+ 1257 008e 24       		.uleb128 0x24
+ 1258 008f 00       		.byte	0
+ 1259 0090 0B       		.uleb128 0xb
+ 1260 0091 0B       		.uleb128 0xb
+ 1261 0092 3E       		.uleb128 0x3e
+ 1262 0093 0B       		.uleb128 0xb
+ 1263 0094 03       		.uleb128 0x3
+ 1264 0095 08       		.uleb128 0x8
+ 1265 0096 00       		.byte	0
+ 1266 0097 00       		.byte	0
+ 1267 0098 0C       		.uleb128 0xc
+ 1268 0099 13       		.uleb128 0x13
+ 1269 009a 01       		.byte	0x1
+ 1270 009b 0B       		.uleb128 0xb
+ 1271 009c 0B       		.uleb128 0xb
+ 1272 009d 3A       		.uleb128 0x3a
+ 1273 009e 0B       		.uleb128 0xb
+ 1274 009f 3B       		.uleb128 0x3b
+ 1275 00a0 0B       		.uleb128 0xb
+ 1276 00a1 39       		.uleb128 0x39
+ 1277 00a2 0B       		.uleb128 0xb
+ 1278 00a3 01       		.uleb128 0x1
+ 1279 00a4 13       		.uleb128 0x13
+ 1280 00a5 00       		.byte	0
+ 1281 00a6 00       		.byte	0
+ 1282 00a7 0D       		.uleb128 0xd
+ 1283 00a8 21       		.uleb128 0x21
+ 1284 00a9 00       		.byte	0
+ 1285 00aa 49       		.uleb128 0x49
+ 1286 00ab 13       		.uleb128 0x13
+ 1287 00ac 2F       		.uleb128 0x2f
+ 1288 00ad 0B       		.uleb128 0xb
+ 1289 00ae 00       		.byte	0
+ 1290 00af 00       		.byte	0
+ 1291 00b0 0E       		.uleb128 0xe
+ 1292 00b1 21       		.uleb128 0x21
+ 1293 00b2 00       		.byte	0
+GAS LISTING /tmp/cceXHuAj.s 			page 67
+
+
+ 1294 00b3 49       		.uleb128 0x49
+ 1295 00b4 13       		.uleb128 0x13
+ 1296 00b5 2F       		.uleb128 0x2f
+ 1297 00b6 05       		.uleb128 0x5
+ 1298 00b7 00       		.byte	0
+ 1299 00b8 00       		.byte	0
+ 1300 00b9 00       		.byte	0
+ 1301              		.section	.debug_aranges,"",@progbits
+ 1302 0000 1C000000 		.long	0x1c
+ 1303 0004 0200     		.value	0x2
+ 1304 0006 00000000 		.long	.Ldebug_info0
+ 1305 000a 08       		.byte	0x8
+ 1306 000b 00       		.byte	0
+ 1307 000c 0000     		.value	0
+ 1308 000e 0000     		.value	0
+ 1309 0010 00000000 		.quad	0
+ 1309      00000000 
+ 1310 0018 00000000 		.quad	0
+ 1310      00000000 
+ 1311              		.section	.debug_line,"",@progbits
+ 1312              	.Ldebug_line0:
+ 1313 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1313      05000800 
+ 1313      49000000 
+ 1313      010101FB 
+ 1313      0E0D0001 
+ 1314              	.LASF20:
+ 1315 0000 736F6674 		.string	"soft_data"
+ 1315      5F646174 
+ 1315      6100
+ 1316              	.LASF12:
+ 1317 000a 73697A65 		.string	"size_t"
+ 1317      5F7400
+ 1318              	.LASF13:
+ 1319 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1319      6D61705F 
+ 1319      636F6C6F 
+ 1319      72736368 
+ 1319      656D655F 
+ 1320              	.LASF15:
+ 1321 0027 68656174 		.string	"heatmap_cs_BuPu_soft"
+ 1321      6D61705F 
+ 1321      63735F42 
+ 1321      7550755F 
+ 1321      736F6674 
+ 1322              	.LASF17:
+ 1323 003c 68656174 		.string	"heatmap_cs_BuPu_mixed_exp"
+ 1323      6D61705F 
+ 1323      63735F42 
+ 1323      7550755F 
+ 1323      6D697865 
+ 1324              	.LASF26:
+ 1325 0056 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1325      43313720 
+ 1325      31322E32 
+ 1325      2E30202D 
+ 1325      6D74756E 
+GAS LISTING /tmp/cceXHuAj.s 			page 68
+
+
+ 1326              	.LASF6:
+ 1327 00b5 666C6F61 		.string	"float"
+ 1327      7400
+ 1328              	.LASF16:
+ 1329 00bb 68656174 		.string	"heatmap_cs_BuPu_mixed"
+ 1329      6D61705F 
+ 1329      63735F42 
+ 1329      7550755F 
+ 1329      6D697865 
+ 1330              	.LASF11:
+ 1331 00d1 756E7369 		.string	"unsigned char"
+ 1331      676E6564 
+ 1331      20636861 
+ 1331      7200
+ 1332              	.LASF3:
+ 1333 00df 6C6F6E67 		.string	"long unsigned int"
+ 1333      20756E73 
+ 1333      69676E65 
+ 1333      6420696E 
+ 1333      7400
+ 1334              	.LASF8:
+ 1335 00f1 73686F72 		.string	"short unsigned int"
+ 1335      7420756E 
+ 1335      7369676E 
+ 1335      65642069 
+ 1335      6E7400
+ 1336              	.LASF25:
+ 1337 0104 6D697865 		.string	"mixed_exp"
+ 1337      645F6578 
+ 1337      7000
+ 1338              	.LASF23:
+ 1339 010e 6D697865 		.string	"mixed"
+ 1339      6400
+ 1340              	.LASF7:
+ 1341 0114 756E7369 		.string	"unsigned int"
+ 1341      676E6564 
+ 1341      20696E74 
+ 1341      00
+ 1342              	.LASF19:
+ 1343 0121 64697363 		.string	"discrete"
+ 1343      72657465 
+ 1343      00
+ 1344              	.LASF10:
+ 1345 012a 6E636F6C 		.string	"ncolors"
+ 1345      6F727300 
+ 1346              	.LASF4:
+ 1347 0132 6C6F6E67 		.string	"long long int"
+ 1347      206C6F6E 
+ 1347      6720696E 
+ 1347      7400
+ 1348              	.LASF24:
+ 1349 0140 6D697865 		.string	"mixed_exp_data"
+ 1349      645F6578 
+ 1349      705F6461 
+ 1349      746100
+ 1350              	.LASF14:
+ 1351 014f 68656174 		.string	"heatmap_cs_BuPu_discrete"
+GAS LISTING /tmp/cceXHuAj.s 			page 69
+
+
+ 1351      6D61705F 
+ 1351      63735F42 
+ 1351      7550755F 
+ 1351      64697363 
+ 1352              	.LASF2:
+ 1353 0168 6C6F6E67 		.string	"long int"
+ 1353      20696E74 
+ 1353      00
+ 1354              	.LASF5:
+ 1355 0171 6C6F6E67 		.string	"long double"
+ 1355      20646F75 
+ 1355      626C6500 
+ 1356              	.LASF22:
+ 1357 017d 6D697865 		.string	"mixed_data"
+ 1357      645F6461 
+ 1357      746100
+ 1358              	.LASF18:
+ 1359 0188 64697363 		.string	"discrete_data"
+ 1359      72657465 
+ 1359      5F646174 
+ 1359      6100
+ 1360              	.LASF21:
+ 1361 0196 736F6674 		.string	"soft"
+ 1361      00
+ 1362              	.LASF9:
+ 1363 019b 636F6C6F 		.string	"colors"
+ 1363      727300
+ 1364              		.section	.debug_line_str,"MS",@progbits,1
+ 1365              	.LASF1:
+ 1366 0000 2F726F6F 		.string	"/root/repo"
+ 1366      742F7265 
+ 1366      706F00
+ 1367              	.LASF0:
+ 1368 000b 636F6C6F 		.string	"colorschemes/BuPu.c"
+ 1368      72736368 
+ 1368      656D6573 
+ 1368      2F427550 
+ 1368      752E6300 
+ 1369              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1370 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1370      742F7265 
+ 1370      706F0063 
+ 1370      6F6C6F72 
+ 1370      73636865 
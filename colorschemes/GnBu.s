@@ -0,0 +1,4167 @@
+GAS LISTING /tmp/ccKdOQhn.s 			page 1
+
+
+   1              		.file	"GnBu.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/GnBu.c"
+   5              		.globl	heatmap_cs_GnBu_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_GnBu_mixed_exp, @object
+   9              		.size	heatmap_cs_GnBu_mixed_exp, 8
+  10              	heatmap_cs_GnBu_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 083F8100 		.string	"\b?\201"
+  29 0008 08428318 		.ascii	"\bB\203\030\007D\2061\007G\211J\007I\213c\007K\216|\007N\220"
+  29      07448631 
+  29      0747894A 
+  29      07498B63 
+  29      074B8E7C 
+  30 001f 9507589B 		.ascii	"\225\007X\233\256\007[\236\307\007]\240\340\007_\243\371\007"
+  30      AE075B9E 
+  30      C7075DA0 
+  30      E0075FA3 
+  30      F907
+  31 0031 62A5FF07 		.ascii	"b\245\377\007d\250\377\007f\252\377\007h\254\377\bj\255\377\b"
+  31      64A8FF07 
+  31      66AAFF07 
+  31      68ACFF08 
+  31      6AADFF08 
+  32 0045 6CAEFF0A 		.ascii	"l\256\377\nn\257\377\013p\260\377\rr\261\377\017t\262\377\021"
+  32      6EAFFF0B 
+  32      70B0FF0D 
+  32      72B1FF0F 
+  32      74B2FF11 
+  33 0059 76B3FF1A 		.ascii	"v\263\377\032\177\270\377\034\201\271\377\037\203\272\377!\204"
+  33      7FB8FF1C 
+  33      81B9FF1F 
+  33      83BAFF21 
+  33      84
+  34 006a BAFF2386 		.ascii	"\272\377#\206\273\377&\210\274\377(\212\275\377*\213\275\377"
+GAS LISTING /tmp/ccKdOQhn.s 			page 2
+
+
+  34      BBFF2688 
+  34      BCFF288A 
+  34      BDFF2A8B 
+  34      BDFF
+  35 007c 2C8DBFFF 		.ascii	",\215\277\377-\217\300\377.\221\301\377/\223\302\3771\225\303"
+  35      2D8FC0FF 
+  35      2E91C1FF 
+  35      2F93C2FF 
+  35      3195C3
+  36 008f FF3296C4 		.ascii	"\3772\226\304\3774\230\305\3775\232\306\377>\244\313\377@\245"
+  36      FF3498C5 
+  36      FF359AC6 
+  36      FF3EA4CB 
+  36      FF40A5
+  37 00a2 CCFF41A7 		.ascii	"\314\377A\247\315\377C\251\316\377E\252\316\377F\254\317\377"
+  37      CDFF43A9 
+  37      CEFF45AA 
+  37      CEFF46AC 
+  37      CFFF
+  38 00b4 48AED0FF 		.ascii	"H\256\320\377J\257\321\377L\261\322\377M\262\322\377N\264\322"
+  38      4AAFD1FF 
+  38      4CB1D2FF 
+  38      4DB2D2FF 
+  38      4EB4D2
+  39 00c7 FF4FB5D2 		.ascii	"\377O\265\322\377P\266\321\377Q\267\321\377R\270\320\377T\271"
+  39      FF50B6D1 
+  39      FF51B7D1 
+  39      FF52B8D0 
+  39      FF54B9
+  40 00da CFFF55BA 		.ascii	"\317\377U\272\317\377W\273\316\377Y\274\316\377Z\275\315\377"
+  40      CFFF57BB 
+  40      CEFF59BC 
+  40      CEFF5ABD 
+  40      CDFF
+  41 00ec 65C3CAFF 		.ascii	"e\303\312\377g\304\311\377i\305\310\377k\306\310\377m\306\307"
+  41      67C4C9FF 
+  41      69C5C8FF 
+  41      6BC6C8FF 
+  41      6DC6C7
+  42 00ff FF6FC7C7 		.ascii	"\377o\307\307\377q\310\306\377s\311\305\377u\312\305\377w\312"
+  42      FF71C8C6 
+  42      FF73C9C5 
+  42      FF75CAC5 
+  42      FF77CA
+  43 0112 C4FF79CB 		.ascii	"\304\377y\313\304\377{\314\303\377|\314\303\377}\315\302\377"
+  43      C4FF7BCC 
+  43      C3FF7CCC 
+  43      C3FF7DCD 
+  43      C2FF
+  44 0124 7ECEC2FF 		.ascii	"~\316\302\377\200\316\301\377\201\317\301\377\202\317\301\377"
+  44      80CEC1FF 
+  44      81CFC1FF 
+  44      82CFC1FF 
+  45 0134 84D0C0FF 		.ascii	"\204\320\300\377\205\321\300\377\206\321\277\377\207\322\277"
+  45      85D1C0FF 
+  45      86D1BFFF 
+  45      87D2BF
+GAS LISTING /tmp/ccKdOQhn.s 			page 3
+
+
+  46 0143 FF89D2BE 		.ascii	"\377\211\322\276\377\212\323\276\377\225\327\272\377\226\327"
+  46      FF8AD3BE 
+  46      FF95D7BA 
+  46      FF96D7
+  47 0152 BAFF97D8 		.ascii	"\272\377\227\330\271\377\231\330\271\377\232\331\270\377\233"
+  47      B9FF99D8 
+  47      B9FF9AD9 
+  47      B8FF9B
+  48 0161 D9B8FF9D 		.ascii	"\331\270\377\235\331\270\377\236\332\267\377\240\332\267\377"
+  48      D9B8FF9E 
+  48      DAB7FFA0 
+  48      DAB7FF
+  49 0170 A1DBB6FF 		.ascii	"\241\333\266\377\242\333\266\377\244\333\266\377\245\334\265"
+  49      A2DBB6FF 
+  49      A4DBB6FF 
+  49      A5DCB5
+  50 017f FFA7DCB5 		.ascii	"\377\247\334\265\377\250\335\265\377\251\335\265\377\252\335"
+  50      FFA8DDB5 
+  50      FFA9DDB5 
+  50      FFAADD
+  51 018e B5FFABDE 		.ascii	"\265\377\253\336\266\377\254\336\266\377\255\336\266\377\256"
+  51      B6FFACDE 
+  51      B6FFADDE 
+  51      B6FFAE
+  52 019d DFB7FFAE 		.ascii	"\337\267\377\256\337\267\377\257\337\267\377\260\340\270\377"
+  52      DFB7FFAF 
+  52      DFB7FFB0 
+  52      E0B8FF
+  53 01ac B1E0B8FF 		.ascii	"\261\340\270\377\262\340\270\377\263\341\271\377\264\341\271"
+  53      B2E0B8FF 
+  53      B3E1B9FF 
+  53      B4E1B9
+  54 01bb FFB4E1BA 		.ascii	"\377\264\341\272\377\265\342\272\377\266\342\272\377\276\345"
+  54      FFB5E2BA 
+  54      FFB6E2BA 
+  54      FFBEE5
+  55 01ca BEFFBFE5 		.ascii	"\276\377\277\345\276\377\300\346\276\377\300\346\277\377\301"
+  55      BEFFC0E6 
+  55      BEFFC0E6 
+  55      BFFFC1
+  56 01d9 E6BFFFC2 		.ascii	"\346\277\377\302\347\300\377\303\347\300\377\303\347\300\377"
+  56      E7C0FFC3 
+  56      E7C0FFC3 
+  56      E7C0FF
+  57 01e8 C4E7C1FF 		.ascii	"\304\347\301\377\305\350\301\377\305\350\301\377\306\350\302"
+  57      C5E8C1FF 
+  57      C5E8C1FF 
+  57      C6E8C2
+  58 01f7 FFC7E9C2 		.ascii	"\377\307\351\302\377\307\351\302\377\310\351\303\377\311\351"
+  58      FFC7E9C2 
+  58      FFC8E9C3 
+  58      FFC9E9
+  59 0206 C3FFC9EA 		.ascii	"\303\377\311\352\303\377\312\352\304\377\313\352\304\377\313"
+  59      C3FFCAEA 
+  59      C4FFCBEA 
+  59      C4FFCB
+  60 0215 EAC4FFCC 		.ascii	"\352\304\377\314\353\305\377\314\353\305\377\314\353\305\377"
+GAS LISTING /tmp/ccKdOQhn.s 			page 4
+
+
+  60      EBC5FFCC 
+  60      EBC5FFCC 
+  60      EBC5FF
+  61 0224 CDEBC6FF 		.ascii	"\315\353\306\377\315\353\306\377\315\353\307\377\316\353\307"
+  61      CDEBC6FF 
+  61      CDEBC7FF 
+  61      CEEBC7
+  62 0233 FFCEECC7 		.ascii	"\377\316\354\307\377\316\354\310\377\317\354\310\377\317\354"
+  62      FFCEECC8 
+  62      FFCFECC8 
+  62      FFCFEC
+  63 0242 C8FFCFEC 		.ascii	"\310\377\317\354\311\377\320\354\311\377\320\354\311\377\320"
+  63      C9FFD0EC 
+  63      C9FFD0EC 
+  63      C9FFD0
+  64 0251 ECCAFFD1 		.ascii	"\354\312\377\321\355\312\377\321\355\312\377\321\355\313\377"
+  64      EDCAFFD1 
+  64      EDCAFFD1 
+  64      EDCBFF
+  65 0260 D2EDCBFF 		.ascii	"\322\355\313\377\322\355\313\377\322\355\314\377\322\355\314"
+  65      D2EDCBFF 
+  65      D2EDCCFF 
+  65      D2EDCC
+  66 026f FFD3EDCC 		.ascii	"\377\323\355\314\377\323\356\315\377\323\356\315\377\330\357"
+  66      FFD3EECD 
+  66      FFD3EECD 
+  66      FFD8EF
+  67 027e D2FFD8EF 		.ascii	"\322\377\330\357\322\377\330\360\322\377\330\360\323\377\331"
+  67      D2FFD8F0 
+  67      D2FFD8F0 
+  67      D3FFD9
+  68 028d F0D3FFD9 		.ascii	"\360\323\377\331\360\323\377\331\360\323\377\331\360\324\377"
+  68      F0D3FFD9 
+  68      F0D3FFD9 
+  68      F0D4FF
+  69 029c DAF0D4FF 		.ascii	"\332\360\324\377\332\360\324\377\332\360\325\377\332\360\325"
+  69      DAF0D4FF 
+  69      DAF0D5FF 
+  69      DAF0D5
+  70 02ab FFDBF1D5 		.ascii	"\377\333\361\325\377\333\361\325\377\333\361\326\377\333\361"
+  70      FFDBF1D5 
+  70      FFDBF1D6 
+  70      FFDBF1
+  71 02ba D6FFDCF1 		.ascii	"\326\377\334\361\326\377\334\361\326\377\334\361\327\377\334"
+  71      D6FFDCF1 
+  71      D6FFDCF1 
+  71      D7FFDC
+  72 02c9 F1D7FFDD 		.ascii	"\361\327\377\335\361\327\377\335\361\327\377\335\361\330\377"
+  72      F1D7FFDD 
+  72      F1D7FFDD 
+  72      F1D8FF
+  73 02d8 DDF2D8FF 		.ascii	"\335\362\330\377\335\362\330\377\336\362\330\377\336\362\331"
+  73      DDF2D8FF 
+  73      DEF2D8FF 
+  73      DEF2D9
+  74 02e7 FFDEF2D9 		.ascii	"\377\336\362\331\377\336\362\331\377\336\362\331\377\337\362"
+  74      FFDEF2D9 
+GAS LISTING /tmp/ccKdOQhn.s 			page 5
+
+
+  74      FFDEF2D9 
+  74      FFDFF2
+  75 02f6 DAFFDFF2 		.ascii	"\332\377\337\362\332\377\337\362\332\377\337\362\332\377\337"
+  75      DAFFDFF2 
+  75      DAFFDFF2 
+  75      DAFFDF
+  76 0305 F2DAFFE0 		.ascii	"\362\332\377\340\363\333\377\340\363\333\377\340\363\333\377"
+  76      F3DBFFE0 
+  76      F3DBFFE0 
+  76      F3DBFF
+  77 0314 E0F3DBFF 		.ascii	"\340\363\333\377\341\363\333\377\341\363\333\377\341\363\334"
+  77      E1F3DBFF 
+  77      E1F3DBFF 
+  77      E1F3DC
+  78 0323 FFE1F3DC 		.ascii	"\377\341\363\334\377\342\363\334\377\342\363\334\377\342\363"
+  78      FFE2F3DC 
+  78      FFE2F3DC 
+  78      FFE2F3
+  79 0332 DCFFE2F3 		.ascii	"\334\377\342\363\334\377\342\363\335\377\343\364\335\377\343"
+  79      DCFFE2F3 
+  79      DDFFE3F4 
+  79      DDFFE3
+  80 0341 F4DDFFE3 		.ascii	"\364\335\377\343\364\335\377\343\364\335\377\343\364\335\377"
+  80      F4DDFFE3 
+  80      F4DDFFE3 
+  80      F4DDFF
+  81 0350 E4F4DEFF 		.ascii	"\344\364\336\377\344\364\336\377\344\364\336\377\344\364\336"
+  81      E4F4DEFF 
+  81      E4F4DEFF 
+  81      E4F4DE
+  82 035f FFE4F4DE 		.ascii	"\377\344\364\336\377\345\364\336\377\345\364\336\377\345\364"
+  82      FFE5F4DE 
+  82      FFE5F4DE 
+  82      FFE5F4
+  83 036e DFFFE5F4 		.ascii	"\337\377\345\364\337\377\345\364\337\377\346\365\337\377\346"
+  83      DFFFE5F4 
+  83      DFFFE6F5 
+  83      DFFFE6
+  84 037d F5DFFFE6 		.ascii	"\365\337\377\346\365\337\377\346\365\337\377\346\365\340\377"
+  84      F5DFFFE6 
+  84      F5DFFFE6 
+  84      F5E0FF
+  85 038c E6F5E0FF 		.ascii	"\346\365\340\377\347\365\340\377\347\365\340\377\347\365\340"
+  85      E7F5E0FF 
+  85      E7F5E0FF 
+  85      E7F5E0
+  86 039b FFE7F5E0 		.ascii	"\377\347\365\340\377\347\365\340\377\347\365\341\377\347\365"
+  86      FFE7F5E0 
+  86      FFE7F5E1 
+  86      FFE7F5
+  87 03aa E1FFE8F5 		.ascii	"\341\377\350\365\341\377\350\365\341\377\350\365\341\377\350"
+  87      E1FFE8F5 
+  87      E1FFE8F5 
+  87      E1FFE8
+  88 03b9 F5E1FFE8 		.ascii	"\365\341\377\350\365\341\377\350\366\341\377\350\366\341\377"
+  88      F5E1FFE8 
+  88      F6E1FFE8 
+GAS LISTING /tmp/ccKdOQhn.s 			page 6
+
+
+  88      F6E1FF
+  89 03c8 E9F6E2FF 		.ascii	"\351\366\342\377\351\366\342\377\351\366\342\377\351\366\342"
+  89      E9F6E2FF 
+  89      E9F6E2FF 
+  89      E9F6E2
+  90 03d7 FFE9F6E2 		.ascii	"\377\351\366\342\377\351\366\342\377\351\366\342\377\356\370"
+  90      FFE9F6E2 
+  90      FFE9F6E2 
+  90      FFEEF8
+  91 03e6 E7FFEEF8 		.ascii	"\347\377\356\370\347\377\356\370\347\377\356\370\347\377\356"
+  91      E7FFEEF8 
+  91      E7FFEEF8 
+  91      E7FFEE
+  92 03f5 F8E7FFEF 		.ascii	"\370\347\377\357\370\347\377\357\370\347\377\357\370\347\377"
+  92      F8E7FFEF 
+  92      F8E7FFEF 
+  92      F8E7FF
+  93 0404 EFF8E7FF 		.ascii	"\357\370\347\377\357\370\350\377\357\370\350\377\357\370\350"
+  93      EFF8E8FF 
+  93      EFF8E8FF 
+  93      EFF8E8
+  94 0413 FFEFF8E8 		.ascii	"\377\357\370\350\377\357\370\350\377\357\370\350\377\360\370"
+  94      FFEFF8E8 
+  94      FFEFF8E8 
+  94      FFF0F8
+  95 0422 E8FFF0F8 		.ascii	"\350\377\360\370\350\377\360\370\350\377\360\371\350\377\360"
+  95      E8FFF0F8 
+  95      E8FFF0F9 
+  95      E8FFF0
+  96 0431 F9E8FFF0 		.ascii	"\371\350\377\360\371\351\377\360\371\351\377\360\371\351\377"
+  96      F9E9FFF0 
+  96      F9E9FFF0 
+  96      F9E9FF
+  97 0440 F0F9E9FF 		.ascii	"\360\371\351\377\360\371\351\377\361\371\351\377\361\371\351"
+  97      F0F9E9FF 
+  97      F1F9E9FF 
+  97      F1F9E9
+  98 044f FFF1F9E9 		.ascii	"\377\361\371\351\377\361\371\351\377\361\371\351\377\361\371"
+  98      FFF1F9E9 
+  98      FFF1F9E9 
+  98      FFF1F9
+  99 045e E9FFF1F9 		.ascii	"\351\377\361\371\351\377\361\371\352\377\361\371\352\377\361"
+  99      E9FFF1F9 
+  99      EAFFF1F9 
+  99      EAFFF1
+ 100 046d F9EAFFF1 		.ascii	"\371\352\377\361\371\352\377\361\371\352\377\361\371\352\377"
+ 100      F9EAFFF1 
+ 100      F9EAFFF1 
+ 100      F9EAFF
+ 101 047c F2F9EAFF 		.ascii	"\362\371\352\377\362\371\352\377\362\371\352\377\362\371\352"
+ 101      F2F9EAFF 
+ 101      F2F9EAFF 
+ 101      F2F9EA
+ 102 048b FFF2F9EA 		.ascii	"\377\362\371\352\377\362\371\352\377\362\371\352\377\362\371"
+ 102      FFF2F9EA 
+ 102      FFF2F9EA 
+ 102      FFF2F9
+GAS LISTING /tmp/ccKdOQhn.s 			page 7
+
+
+ 103 049a EAFFF2F9 		.ascii	"\352\377\362\371\353\377\362\371\353\377\362\371\353\377\362"
+ 103      EBFFF2F9 
+ 103      EBFFF2F9 
+ 103      EBFFF2
+ 104 04a9 FAEBFFF2 		.ascii	"\372\353\377\362\372\353\377\362\372\353\377\362\372\353\377"
+ 104      FAEBFFF2 
+ 104      FAEBFFF2 
+ 104      FAEBFF
+ 105 04b8 F2FAEBFF 		.ascii	"\362\372\353\377\363\372\353\377\363\372\353\377\363\372\353"
+ 105      F3FAEBFF 
+ 105      F3FAEBFF 
+ 105      F3FAEB
+ 106 04c7 FFF3FAEB 		.ascii	"\377\363\372\353\377\363\372\353\377\363\372\353\377\363\372"
+ 106      FFF3FAEB 
+ 106      FFF3FAEB 
+ 106      FFF3FA
+ 107 04d6 EBFFF3FA 		.ascii	"\353\377\363\372\353\377\363\372\354\377\363\372\354\377\363"
+ 107      EBFFF3FA 
+ 107      ECFFF3FA 
+ 107      ECFFF3
+ 108 04e5 FAECFFF3 		.ascii	"\372\354\377\363\372\354\377\363\372\354\377\363\372\354\377"
+ 108      FAECFFF3 
+ 108      FAECFFF3 
+ 108      FAECFF
+ 109 04f4 F3FAECFF 		.ascii	"\363\372\354\377\363\372\354\377\363\372\354\377\363\372\354"
+ 109      F3FAECFF 
+ 109      F3FAECFF 
+ 109      F3FAEC
+ 110 0503 FFF3FAEC 		.ascii	"\377\363\372\354\377\363\372\354\377\364\372\354\377\364\372"
+ 110      FFF3FAEC 
+ 110      FFF4FAEC 
+ 110      FFF4FA
+ 111 0512 ECFFF4FA 		.ascii	"\354\377\364\372\354\377\364\372\354\377\364\372\354\377\364"
+ 111      ECFFF4FA 
+ 111      ECFFF4FA 
+ 111      ECFFF4
+ 112 0521 FAECFFF4 		.ascii	"\372\354\377\364\372\354\377\364\372\354\377\364\372\354\377"
+ 112      FAECFFF4 
+ 112      FAECFFF4 
+ 112      FAECFF
+ 113 0530 F4FAEDFF 		.ascii	"\364\372\355\377\364\372\355\377\364\372\355\377\364\372\355"
+ 113      F4FAEDFF 
+ 113      F4FAEDFF 
+ 113      F4FAED
+ 114 053f FFF4FAED 		.ascii	"\377\364\372\355\377\364\372\355\377\364\372\355\377\364\372"
+ 114      FFF4FAED 
+ 114      FFF4FAED 
+ 114      FFF4FA
+ 115 054e EDFFF4FA 		.ascii	"\355\377\364\372\355\377\364\372\355\377\364\372\355\377\364"
+ 115      EDFFF4FA 
+ 115      EDFFF4FA 
+ 115      EDFFF4
+ 116 055d FAEDFFF4 		.ascii	"\372\355\377\364\372\355\377\364\372\355\377\364\372\355\377"
+ 116      FAEDFFF4 
+ 116      FAEDFFF4 
+ 116      FAEDFF
+ 117 056c F4FBEDFF 		.ascii	"\364\373\355\377\364\373\355\377\364\373\355\377\365\373\355"
+GAS LISTING /tmp/ccKdOQhn.s 			page 8
+
+
+ 117      F4FBEDFF 
+ 117      F4FBEDFF 
+ 117      F5FBED
+ 118 057b FFF5FBED 		.ascii	"\377\365\373\355\377\365\373\355\377\365\373\355\377\365\373"
+ 118      FFF5FBED 
+ 118      FFF5FBED 
+ 118      FFF5FB
+ 119 058a EDFFF5FB 		.ascii	"\355\377\365\373\355\377\365\373\355\377\365\373\355\377\365"
+ 119      EDFFF5FB 
+ 119      EDFFF5FB 
+ 119      EDFFF5
+ 120 0599 FBEDFFF5 		.ascii	"\373\355\377\365\373\355\377\365\373\356\377\365\373\356\377"
+ 120      FBEDFFF5 
+ 120      FBEEFFF5 
+ 120      FBEEFF
+ 121 05a8 F5FBEEFF 		.ascii	"\365\373\356\377\365\373\356\377\365\373\356\377\365\373\356"
+ 121      F5FBEEFF 
+ 121      F5FBEEFF 
+ 121      F5FBEE
+ 122 05b7 FFF5FBEE 		.ascii	"\377\365\373\356\377\365\373\356\377\365\373\356\377\365\373"
+ 122      FFF5FBEE 
+ 122      FFF5FBEE 
+ 122      FFF5FB
+ 123 05c6 EEFFF5FB 		.ascii	"\356\377\365\373\356\377\365\373\356\377\365\373\356\377\365"
+ 123      EEFFF5FB 
+ 123      EEFFF5FB 
+ 123      EEFFF5
+ 124 05d5 FBEEFFF5 		.ascii	"\373\356\377\365\373\356\377\365\373\356\377\365\373\356\377"
+ 124      FBEEFFF5 
+ 124      FBEEFFF5 
+ 124      FBEEFF
+ 125 05e4 F5FBEEFF 		.ascii	"\365\373\356\377\365\373\356\377\365\373\356\377\365\373\356"
+ 125      F5FBEEFF 
+ 125      F5FBEEFF 
+ 125      F5FBEE
+ 126 05f3 FFF5FBEE 		.ascii	"\377\365\373\356\377\365\373\356\377\365\373\356\377\365\373"
+ 126      FFF5FBEE 
+ 126      FFF5FBEE 
+ 126      FFF5FB
+ 127 0602 EEFFF5FB 		.ascii	"\356\377\365\373\356\377\365\373\356\377\365\373\356\377\365"
+ 127      EEFFF5FB 
+ 127      EEFFF5FB 
+ 127      EEFFF5
+ 128 0611 FBEEFFF5 		.ascii	"\373\356\377\365\373\356\377\365\373\356\377\365\373\356\377"
+ 128      FBEEFFF5 
+ 128      FBEEFFF5 
+ 128      FBEEFF
+ 129 0620 F5FBEEFF 		.ascii	"\365\373\356\377\365\373\356\377\366\373\356\377\366\373\356"
+ 129      F5FBEEFF 
+ 129      F6FBEEFF 
+ 129      F6FBEE
+ 130 062f FFF6FBEE 		.ascii	"\377\366\373\356\377\366\373\356\377\366\373\356\377\366\373"
+ 130      FFF6FBEE 
+ 130      FFF6FBEE 
+ 130      FFF6FB
+ 131 063e EEFFF6FB 		.ascii	"\356\377\366\373\356\377\366\373\356\377\366\373\356\377\366"
+ 131      EEFFF6FB 
+GAS LISTING /tmp/ccKdOQhn.s 			page 9
+
+
+ 131      EEFFF6FB 
+ 131      EEFFF6
+ 132 064d FBEEFFF6 		.ascii	"\373\356\377\366\373\356\377\366\373\357\377\366\373\357\377"
+ 132      FBEEFFF6 
+ 132      FBEFFFF6 
+ 132      FBEFFF
+ 133 065c F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 133      F6FBEFFF 
+ 133      F6FBEFFF 
+ 133      F6FBEF
+ 134 066b FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 134      FFF6FBEF 
+ 134      FFF6FBEF 
+ 134      FFF6FB
+ 135 067a EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 135      EFFFF6FB 
+ 135      EFFFF6FB 
+ 135      EFFFF6
+ 136 0689 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 136      FBEFFFF6 
+ 136      FBEFFFF6 
+ 136      FBEFFF
+ 137 0698 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 137      F6FBEFFF 
+ 137      F6FBEFFF 
+ 137      F6FBEF
+ 138 06a7 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 138      FFF6FBEF 
+ 138      FFF6FBEF 
+ 138      FFF6FB
+ 139 06b6 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 139      EFFFF6FB 
+ 139      EFFFF6FB 
+ 139      EFFFF6
+ 140 06c5 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 140      FBEFFFF6 
+ 140      FBEFFFF6 
+ 140      FBEFFF
+ 141 06d4 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 141      F6FBEFFF 
+ 141      F6FBEFFF 
+ 141      F6FBEF
+ 142 06e3 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 142      FFF6FBEF 
+ 142      FFF6FBEF 
+ 142      FFF6FB
+ 143 06f2 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 143      EFFFF6FB 
+ 143      EFFFF6FB 
+ 143      EFFFF6
+ 144 0701 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 144      FBEFFFF6 
+ 144      FBEFFFF6 
+ 144      FBEFFF
+ 145 0710 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 145      F6FBEFFF 
+ 145      F6FBEFFF 
+GAS LISTING /tmp/ccKdOQhn.s 			page 10
+
+
+ 145      F6FBEF
+ 146 071f FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 146      FFF6FBEF 
+ 146      FFF6FBEF 
+ 146      FFF6FB
+ 147 072e EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 147      EFFFF6FB 
+ 147      EFFFF6FB 
+ 147      EFFFF6
+ 148 073d FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 148      FBEFFFF6 
+ 148      FBEFFFF6 
+ 148      FBEFFF
+ 149 074c F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 149      F6FBEFFF 
+ 149      F6FBEFFF 
+ 149      F6FBEF
+ 150 075b FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 150      FFF6FBEF 
+ 150      FFF6FBEF 
+ 150      FFF6FB
+ 151 076a EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 151      EFFFF6FB 
+ 151      EFFFF6FB 
+ 151      EFFFF6
+ 152 0779 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 152      FBEFFFF6 
+ 152      FBEFFFF6 
+ 152      FBEFFF
+ 153 0788 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 153      F6FBEFFF 
+ 153      F6FBEFFF 
+ 153      F6FBEF
+ 154 0797 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 154      FFF6FBEF 
+ 154      FFF6FBEF 
+ 154      FFF6FB
+ 155 07a6 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 155      EFFFF6FB 
+ 155      EFFFF6FB 
+ 155      EFFFF6
+ 156 07b5 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 156      FBEFFFF6 
+ 156      FBEFFFF6 
+ 156      FBEFFF
+ 157 07c4 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377"
+ 157      F6FBEFFF 
+ 157      F6FBEFFF 
+ 158 07d0 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 158      F6FBEFFF 
+ 158      F6FBEFFF 
+ 158      F6FBEF
+ 159 07df FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 159      FFF6FBEF 
+ 159      FFF6FBEF 
+ 159      FFF6FB
+ 160 07ee EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+GAS LISTING /tmp/ccKdOQhn.s 			page 11
+
+
+ 160      EFFFF6FB 
+ 160      EFFFF6FB 
+ 160      EFFFF6
+ 161 07fd FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 161      FBEFFFF6 
+ 161      FBEFFFF6 
+ 161      FBEFFF
+ 162 080c F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 162      F6FBEFFF 
+ 162      F6FBEFFF 
+ 162      F6FBEF
+ 163 081b FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 163      FFF6FBEF 
+ 163      FFF6FBEF 
+ 163      FFF6FB
+ 164 082a EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 164      EFFFF6FB 
+ 164      EFFFF6FB 
+ 164      EFFFF6
+ 165 0839 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 165      FBEFFFF6 
+ 165      FBEFFFF6 
+ 165      FBEFFF
+ 166 0848 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 166      F6FBEFFF 
+ 166      F6FBEFFF 
+ 166      F6FBEF
+ 167 0857 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 167      FFF6FBEF 
+ 167      FFF6FBEF 
+ 167      FFF6FB
+ 168 0866 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 168      EFFFF6FB 
+ 168      EFFFF6FB 
+ 168      EFFFF6
+ 169 0875 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 169      FBEFFFF6 
+ 169      FBEFFFF6 
+ 169      FBEFFF
+ 170 0884 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 170      F6FBEFFF 
+ 170      F6FBEFFF 
+ 170      F6FBEF
+ 171 0893 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 171      FFF6FBEF 
+ 171      FFF6FBEF 
+ 171      FFF6FB
+ 172 08a2 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 172      EFFFF6FB 
+ 172      EFFFF6FB 
+ 172      EFFFF6
+ 173 08b1 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 173      FBEFFFF6 
+ 173      FBEFFFF6 
+ 173      FBEFFF
+ 174 08c0 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 174      F6FBEFFF 
+GAS LISTING /tmp/ccKdOQhn.s 			page 12
+
+
+ 174      F6FBEFFF 
+ 174      F6FBEF
+ 175 08cf FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 175      FFF6FBEF 
+ 175      FFF6FBEF 
+ 175      FFF6FB
+ 176 08de EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 176      EFFFF6FB 
+ 176      EFFFF6FB 
+ 176      EFFFF6
+ 177 08ed FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 177      FBEFFFF6 
+ 177      FBEFFFF6 
+ 177      FBEFFF
+ 178 08fc F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 178      F6FBEFFF 
+ 178      F6FBEFFF 
+ 178      F6FBEF
+ 179 090b FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 179      FFF6FBEF 
+ 179      FFF6FBEF 
+ 179      FFF6FB
+ 180 091a EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 180      EFFFF6FB 
+ 180      EFFFF6FB 
+ 180      EFFFF6
+ 181 0929 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 181      FBEFFFF6 
+ 181      FBEFFFF6 
+ 181      FBEFFF
+ 182 0938 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 182      F6FBEFFF 
+ 182      F6FBEFFF 
+ 182      F6FBEF
+ 183 0947 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 183      FFF6FBEF 
+ 183      FFF6FBEF 
+ 183      FFF6FB
+ 184 0956 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 184      EFFFF6FB 
+ 184      EFFFF6FB 
+ 184      EFFFF6
+ 185 0965 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 185      FBEFFFF6 
+ 185      FBEFFFF6 
+ 185      FBEFFF
+ 186 0974 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 186      F6FBEFFF 
+ 186      F6FBEFFF 
+ 186      F6FBEF
+ 187 0983 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 187      FFF6FBEF 
+ 187      FFF6FBEF 
+ 187      FFF6FB
+ 188 0992 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 188      EFFFF6FB 
+ 188      EFFFF6FB 
+GAS LISTING /tmp/ccKdOQhn.s 			page 13
+
+
+ 188      EFFFF6
+ 189 09a1 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 189      FBEFFFF6 
+ 189      FBEFFFF6 
+ 189      FBEFFF
+ 190 09b0 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 190      F6FBEFFF 
+ 190      F6FBEFFF 
+ 190      F6FBEF
+ 191 09bf FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 191      FFF6FBEF 
+ 191      FFF6FBEF 
+ 191      FFF6FB
+ 192 09ce EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 192      EFFFF6FB 
+ 192      EFFFF6FB 
+ 192      EFFFF6
+ 193 09dd FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 193      FBEFFFF6 
+ 193      FBEFFFF6 
+ 193      FBEFFF
+ 194 09ec F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 194      F6FBEFFF 
+ 194      F6FBEFFF 
+ 194      F6FBEF
+ 195 09fb FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 195      FFF6FBEF 
+ 195      FFF6FBEF 
+ 195      FFF6FB
+ 196 0a0a EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 196      EFFFF6FB 
+ 196      EFFFF6FB 
+ 196      EFFFF6
+ 197 0a19 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 197      FBEFFFF6 
+ 197      FBEFFFF6 
+ 197      FBEFFF
+ 198 0a28 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 198      F6FBEFFF 
+ 198      F6FBEFFF 
+ 198      F6FBEF
+ 199 0a37 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 199      FFF6FBEF 
+ 199      FFF6FBEF 
+ 199      FFF6FB
+ 200 0a46 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 200      EFFFF6FB 
+ 200      EFFFF6FB 
+ 200      EFFFF6
+ 201 0a55 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 201      FBEFFFF6 
+ 201      FBEFFFF6 
+ 201      FBEFFF
+ 202 0a64 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 202      F6FBEFFF 
+ 202      F6FBEFFF 
+ 202      F6FBEF
+GAS LISTING /tmp/ccKdOQhn.s 			page 14
+
+
+ 203 0a73 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 203      FFF6FBEF 
+ 203      FFF6FBEF 
+ 203      FFF6FB
+ 204 0a82 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 204      EFFFF6FB 
+ 204      EFFFF6FB 
+ 204      EFFFF6
+ 205 0a91 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 205      FBEFFFF6 
+ 205      FBEFFFF6 
+ 205      FBEFFF
+ 206 0aa0 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 206      F6FBEFFF 
+ 206      F6FBEFFF 
+ 206      F6FBEF
+ 207 0aaf FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 207      FFF6FBEF 
+ 207      FFF6FBEF 
+ 207      FFF6FB
+ 208 0abe EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 208      EFFFF6FB 
+ 208      EFFFF6FB 
+ 208      EFFFF6
+ 209 0acd FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 209      FBEFFFF6 
+ 209      FBEFFFF6 
+ 209      FBEFFF
+ 210 0adc F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 210      F6FBEFFF 
+ 210      F6FBEFFF 
+ 210      F6FBEF
+ 211 0aeb FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 211      FFF6FBEF 
+ 211      FFF6FBEF 
+ 211      FFF6FB
+ 212 0afa EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 212      EFFFF6FB 
+ 212      EFFFF6FB 
+ 212      EFFFF6
+ 213 0b09 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 213      FBEFFFF6 
+ 213      FBEFFFF6 
+ 213      FBEFFF
+ 214 0b18 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 214      F6FBEFFF 
+ 214      F6FBEFFF 
+ 214      F6FBEF
+ 215 0b27 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 215      FFF6FBEF 
+ 215      FFF6FBEF 
+ 215      FFF6FB
+ 216 0b36 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 216      EFFFF6FB 
+ 216      EFFFF6FB 
+ 216      EFFFF6
+ 217 0b45 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+GAS LISTING /tmp/ccKdOQhn.s 			page 15
+
+
+ 217      FBEFFFF6 
+ 217      FBEFFFF6 
+ 217      FBEFFF
+ 218 0b54 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 218      F6FBEFFF 
+ 218      F6FBEFFF 
+ 218      F6FBEF
+ 219 0b63 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 219      FFF6FBEF 
+ 219      FFF6FBEF 
+ 219      FFF6FB
+ 220 0b72 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 220      EFFFF6FB 
+ 220      EFFFF6FB 
+ 220      EFFFF6
+ 221 0b81 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 221      FBEFFFF6 
+ 221      FBEFFFF6 
+ 221      FBEFFF
+ 222 0b90 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 222      F6FBEFFF 
+ 222      F6FBEFFF 
+ 222      F6FBEF
+ 223 0b9f FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 223      FFF6FBEF 
+ 223      FFF6FBEF 
+ 223      FFF6FB
+ 224 0bae EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 224      EFFFF6FB 
+ 224      EFFFF6FB 
+ 224      EFFFF6
+ 225 0bbd FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 225      FBEFFFF6 
+ 225      FBEFFFF6 
+ 225      FBEFFF
+ 226 0bcc F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 226      F6FBEFFF 
+ 226      F6FBEFFF 
+ 226      F6FBEF
+ 227 0bdb FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 227      FFF6FBEF 
+ 227      FFF6FBEF 
+ 227      FFF6FB
+ 228 0bea EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 228      EFFFF6FB 
+ 228      EFFFF6FB 
+ 228      EFFFF6
+ 229 0bf9 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 229      FBEFFFF6 
+ 229      FBEFFFF6 
+ 229      FBEFFF
+ 230 0c08 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 230      F6FBEFFF 
+ 230      F6FBEFFF 
+ 230      F6FBEF
+ 231 0c17 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 231      FFF6FBEF 
+GAS LISTING /tmp/ccKdOQhn.s 			page 16
+
+
+ 231      FFF6FBEF 
+ 231      FFF6FB
+ 232 0c26 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 232      EFFFF6FB 
+ 232      EFFFF6FB 
+ 232      EFFFF6
+ 233 0c35 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 233      FBEFFFF6 
+ 233      FBEFFFF6 
+ 233      FBEFFF
+ 234 0c44 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 234      F6FBEFFF 
+ 234      F6FBEFFF 
+ 234      F6FBEF
+ 235 0c53 FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 235      FFF6FBEF 
+ 235      FFF6FBEF 
+ 235      FFF6FB
+ 236 0c62 EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377\366\373\357\377\366"
+ 236      EFFFF6FB 
+ 236      EFFFF6FB 
+ 236      EFFFF6
+ 237 0c71 FBEFFFF6 		.ascii	"\373\357\377\366\373\357\377\366\373\357\377\366\373\357\377"
+ 237      FBEFFFF6 
+ 237      FBEFFFF6 
+ 237      FBEFFF
+ 238 0c80 F6FBEFFF 		.ascii	"\366\373\357\377\366\373\357\377\366\373\357\377\366\373\357"
+ 238      F6FBEFFF 
+ 238      F6FBEFFF 
+ 238      F6FBEF
+ 239 0c8f FFF6FBEF 		.ascii	"\377\366\373\357\377\366\374\357\377\366\374\357\377\366\374"
+ 239      FFF6FCEF 
+ 239      FFF6FCEF 
+ 239      FFF6FC
+ 240 0c9e EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 240      EFFFF6FC 
+ 240      EFFFF6FC 
+ 240      EFFFF6
+ 241 0cad FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 241      FCEFFFF6 
+ 241      FCEFFFF6 
+ 241      FCEFFF
+ 242 0cbc F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 242      F6FCEFFF 
+ 242      F6FCEFFF 
+ 242      F6FCEF
+ 243 0ccb FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 243      FFF6FCEF 
+ 243      FFF6FCEF 
+ 243      FFF6FC
+ 244 0cda EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 244      EFFFF6FC 
+ 244      EFFFF6FC 
+ 244      EFFFF6
+ 245 0ce9 FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 245      FCEFFFF6 
+ 245      FCEFFFF6 
+GAS LISTING /tmp/ccKdOQhn.s 			page 17
+
+
+ 245      FCEFFF
+ 246 0cf8 F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 246      F6FCEFFF 
+ 246      F6FCEFFF 
+ 246      F6FCEF
+ 247 0d07 FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 247      FFF6FCEF 
+ 247      FFF6FCEF 
+ 247      FFF6FC
+ 248 0d16 EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 248      EFFFF6FC 
+ 248      EFFFF6FC 
+ 248      EFFFF6
+ 249 0d25 FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 249      FCEFFFF6 
+ 249      FCEFFFF6 
+ 249      FCEFFF
+ 250 0d34 F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 250      F6FCEFFF 
+ 250      F6FCEFFF 
+ 250      F6FCEF
+ 251 0d43 FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 251      FFF6FCEF 
+ 251      FFF6FCEF 
+ 251      FFF6FC
+ 252 0d52 EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 252      EFFFF6FC 
+ 252      EFFFF6FC 
+ 252      EFFFF6
+ 253 0d61 FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 253      FCEFFFF6 
+ 253      FCEFFFF6 
+ 253      FCEFFF
+ 254 0d70 F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 254      F6FCEFFF 
+ 254      F6FCEFFF 
+ 254      F6FCEF
+ 255 0d7f FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 255      FFF6FCEF 
+ 255      FFF6FCEF 
+ 255      FFF6FC
+ 256 0d8e EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 256      EFFFF6FC 
+ 256      EFFFF6FC 
+ 256      EFFFF6
+ 257 0d9d FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 257      FCEFFFF6 
+ 257      FCEFFFF6 
+ 257      FCEFFF
+ 258 0dac F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 258      F6FCEFFF 
+ 258      F6FCEFFF 
+ 258      F6FCEF
+ 259 0dbb FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 259      FFF6FCEF 
+ 259      FFF6FCEF 
+ 259      FFF6FC
+GAS LISTING /tmp/ccKdOQhn.s 			page 18
+
+
+ 260 0dca EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 260      EFFFF6FC 
+ 260      EFFFF6FC 
+ 260      EFFFF6
+ 261 0dd9 FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 261      FCEFFFF6 
+ 261      FCEFFFF6 
+ 261      FCEFFF
+ 262 0de8 F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 262      F6FCEFFF 
+ 262      F6FCEFFF 
+ 262      F6FCEF
+ 263 0df7 FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 263      FFF6FCEF 
+ 263      FFF6FCEF 
+ 263      FFF6FC
+ 264 0e06 EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 264      EFFFF6FC 
+ 264      EFFFF6FC 
+ 264      EFFFF6
+ 265 0e15 FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 265      FCEFFFF6 
+ 265      FCEFFFF6 
+ 265      FCEFFF
+ 266 0e24 F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 266      F6FCEFFF 
+ 266      F6FCEFFF 
+ 266      F6FCEF
+ 267 0e33 FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 267      FFF6FCEF 
+ 267      FFF6FCEF 
+ 267      FFF6FC
+ 268 0e42 EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 268      EFFFF6FC 
+ 268      EFFFF6FC 
+ 268      EFFFF6
+ 269 0e51 FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 269      FCEFFFF6 
+ 269      FCEFFFF6 
+ 269      FCEFFF
+ 270 0e60 F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 270      F6FCEFFF 
+ 270      F6FCEFFF 
+ 270      F6FCEF
+ 271 0e6f FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 271      FFF6FCEF 
+ 271      FFF6FCEF 
+ 271      FFF6FC
+ 272 0e7e EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 272      EFFFF6FC 
+ 272      EFFFF6FC 
+ 272      EFFFF6
+ 273 0e8d FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 273      FCEFFFF6 
+ 273      FCEFFFF6 
+ 273      FCEFFF
+ 274 0e9c F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+GAS LISTING /tmp/ccKdOQhn.s 			page 19
+
+
+ 274      F6FCEFFF 
+ 274      F6FCEFFF 
+ 274      F6FCEF
+ 275 0eab FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 275      FFF6FCEF 
+ 275      FFF6FCEF 
+ 275      FFF6FC
+ 276 0eba EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 276      EFFFF6FC 
+ 276      EFFFF6FC 
+ 276      EFFFF6
+ 277 0ec9 FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 277      FCEFFFF6 
+ 277      FCEFFFF6 
+ 277      FCEFFF
+ 278 0ed8 F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 278      F6FCEFFF 
+ 278      F6FCEFFF 
+ 278      F6FCEF
+ 279 0ee7 FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 279      FFF6FCEF 
+ 279      FFF6FCEF 
+ 279      FFF6FC
+ 280 0ef6 EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 280      EFFFF6FC 
+ 280      EFFFF6FC 
+ 280      EFFFF6
+ 281 0f05 FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 281      FCEFFFF6 
+ 281      FCEFFFF6 
+ 281      FCEFFF
+ 282 0f14 F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 282      F6FCEFFF 
+ 282      F6FCEFFF 
+ 282      F6FCEF
+ 283 0f23 FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 283      FFF6FCEF 
+ 283      FFF6FCEF 
+ 283      FFF6FC
+ 284 0f32 EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 284      EFFFF6FC 
+ 284      EFFFF6FC 
+ 284      EFFFF6
+ 285 0f41 FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 285      FCEFFFF6 
+ 285      FCEFFFF6 
+ 285      FCEFFF
+ 286 0f50 F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 286      F6FCEFFF 
+ 286      F6FCEFFF 
+ 286      F6FCEF
+ 287 0f5f FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 287      FFF6FCEF 
+ 287      FFF6FCEF 
+ 287      FFF6FC
+ 288 0f6e EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 288      EFFFF6FC 
+GAS LISTING /tmp/ccKdOQhn.s 			page 20
+
+
+ 288      EFFFF6FC 
+ 288      EFFFF6
+ 289 0f7d FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 289      FCEFFFF6 
+ 289      FCEFFFF6 
+ 289      FCEFFF
+ 290 0f8c F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 290      F6FCEFFF 
+ 290      F6FCEFFF 
+ 290      F6FCEF
+ 291 0f9b FFF6FCEF 		.ascii	"\377\366\374\357\377"
+ 291      FF
+ 292 0fa0 F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 292      F6FCEFFF 
+ 292      F6FCEFFF 
+ 292      F6FCEF
+ 293 0faf FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 293      FFF6FCEF 
+ 293      FFF6FCEF 
+ 293      FFF6FC
+ 294 0fbe EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377\366\374\357\377\366"
+ 294      EFFFF6FC 
+ 294      EFFFF6FC 
+ 294      EFFFF6
+ 295 0fcd FCEFFFF6 		.ascii	"\374\357\377\366\374\357\377\366\374\357\377\366\374\357\377"
+ 295      FCEFFFF6 
+ 295      FCEFFFF6 
+ 295      FCEFFF
+ 296 0fdc F6FCEFFF 		.ascii	"\366\374\357\377\366\374\357\377\366\374\357\377\366\374\357"
+ 296      F6FCEFFF 
+ 296      F6FCEFFF 
+ 296      F6FCEF
+ 297 0feb FFF6FCEF 		.ascii	"\377\366\374\357\377\366\374\357\377\366\374\357\377\366\374"
+ 297      FFF6FCEF 
+ 297      FFF6FCEF 
+ 297      FFF6FC
+ 298 0ffa EFFFF6FC 		.ascii	"\357\377\366\374\357\377\366\374\357\377"
+ 298      EFFFF6FC 
+ 298      EFFF
+ 299              		.globl	heatmap_cs_GnBu_mixed
+ 300              		.section	.data.rel.local
+ 301              		.align 8
+ 302              		.type	heatmap_cs_GnBu_mixed, @object
+ 303              		.size	heatmap_cs_GnBu_mixed, 8
+ 304              	heatmap_cs_GnBu_mixed:
+ 305 0008 00000000 		.quad	mixed
+ 305      00000000 
+ 306              		.section	.data.rel.ro.local
+ 307              		.align 16
+ 308              		.type	mixed, @object
+ 309              		.size	mixed, 16
+ 310              	mixed:
+ 311 0010 00000000 		.quad	mixed_data
+ 311      00000000 
+ 312 0018 01040000 		.quad	1025
+ 312      00000000 
+ 313              		.section	.rodata
+GAS LISTING /tmp/ccKdOQhn.s 			page 21
+
+
+ 314 1004 00000000 		.align 32
+ 314      00000000 
+ 314      00000000 
+ 314      00000000 
+ 314      00000000 
+ 315              		.type	mixed_data, @object
+ 316              		.size	mixed_data, 4100
+ 317              	mixed_data:
+ 318 1020 00       		.string	""
+ 319 1021 00       		.string	""
+ 320 1022 00       		.string	""
+ 321 1023 00       		.string	""
+ 322 1024 083F8100 		.string	"\b?\201"
+ 323 1028 08408107 		.ascii	"\b@\201\007\b@\201\016\b@\201\026\b@\202\035\bA\202%\bA\202,"
+ 323      0840810E 
+ 323      08408116 
+ 323      0840821D 
+ 323      08418225 
+ 324 1040 08418234 		.ascii	"\bA\2024\bA\203;\bB\203C\bB\203J\bB\203R\bB\204Y\bC\204a\bC\204"
+ 324      0841833B 
+ 324      08428343 
+ 324      0842834A 
+ 324      08428352 
+ 325 105f 68084385 		.ascii	"h\bC\205p\bC\205w\bD\205\177\bD\205\206\bD\206\215\007D\206\225"
+ 325      70084385 
+ 325      77084485 
+ 325      7F084485 
+ 325      86084486 
+ 326 1078 0745869C 		.ascii	"\007E\206\234\007E\206\244\007E\207\253\007E\207\263\007F\207"
+ 326      074586A4 
+ 326      074587AB 
+ 326      074587B3 
+ 326      074687
+ 327 108b BA074688 		.ascii	"\272\007F\210\302\007F\210\311\007F\210\321\007G\210\330\007"
+ 327      C2074688 
+ 327      C9074688 
+ 327      D1074788 
+ 327      D807
+ 328 109d 4789E007 		.ascii	"G\211\340\007G\211\347\007G\211\357\007H\211\366\007H\212\376"
+ 328      4789E707 
+ 328      4789EF07 
+ 328      4889F607 
+ 328      488AFE
+ 329 10b0 07488AFF 		.ascii	"\007H\212\377\007H\212\377\007I\213\377\007I\213\377\007I\213"
+ 329      07488AFF 
+ 329      07498BFF 
+ 329      07498BFF 
+ 329      07498B
+ 330 10c3 FF07498B 		.ascii	"\377\007I\213\377\007J\214\377\007J\214\377\007J\214\377\007"
+ 330      FF074A8C 
+ 330      FF074A8C 
+ 330      FF074A8C 
+ 330      FF07
+ 331 10d5 4A8CFF07 		.ascii	"J\214\377\007J\215\377\007K\215\377\007K\215\377\007K\215\377"
+ 331      4A8DFF07 
+ 331      4B8DFF07 
+ 331      4B8DFF07 
+GAS LISTING /tmp/ccKdOQhn.s 			page 22
+
+
+ 331      4B8DFF
+ 332 10e8 074B8EFF 		.ascii	"\007K\216\377\007L\216\377\007L\216\377\007L\217\377\007L\217"
+ 332      074C8EFF 
+ 332      074C8EFF 
+ 332      074C8FFF 
+ 332      074C8F
+ 333 10fb FF074D8F 		.ascii	"\377\007M\217\377\007M\217\377\007M\220\377\007M\220\377\007"
+ 333      FF074D8F 
+ 333      FF074D90 
+ 333      FF074D90 
+ 333      FF07
+ 334 110d 4E90FF07 		.ascii	"N\220\377\007N\220\377\007N\221\377\007N\221\377\007O\221\377"
+ 334      4E90FF07 
+ 334      4E91FF07 
+ 334      4E91FF07 
+ 334      4F91FF
+ 335 1120 074F92FF 		.ascii	"\007O\222\377\007W\232\377\007W\233\377\007X\233\377\007X\233"
+ 335      07579AFF 
+ 335      07579BFF 
+ 335      07589BFF 
+ 335      07589B
+ 336 1133 FF07589B 		.ascii	"\377\007X\233\377\007X\234\377\007Y\234\377\007Y\234\377\007"
+ 336      FF07589C 
+ 336      FF07599C 
+ 336      FF07599C 
+ 336      FF07
+ 337 1145 599DFF07 		.ascii	"Y\235\377\007Y\235\377\007Z\235\377\007Z\235\377\007Z\236\377"
+ 337      599DFF07 
+ 337      5A9DFF07 
+ 337      5A9DFF07 
+ 337      5A9EFF
+ 338 1158 075A9EFF 		.ascii	"\007Z\236\377\007[\236\377\007[\236\377\007[\237\377\007[\237"
+ 338      075B9EFF 
+ 338      075B9EFF 
+ 338      075B9FFF 
+ 338      075B9F
+ 339 116b FF075C9F 		.ascii	"\377\007\\\237\377\007\\\237\377\007\\\240\377\007]\240\377\007"
+ 339      FF075C9F 
+ 339      FF075CA0 
+ 339      FF075DA0 
+ 339      FF07
+ 340 117d 5DA0FF07 		.ascii	"]\240\377\007]\241\377\007]\241\377\007^\241\377\007^\241\377"
+ 340      5DA1FF07 
+ 340      5DA1FF07 
+ 340      5EA1FF07 
+ 340      5EA1FF
+ 341 1190 075EA2FF 		.ascii	"\007^\242\377\007^\242\377\007_\242\377\007_\242\377\007_\243"
+ 341      075EA2FF 
+ 341      075FA2FF 
+ 341      075FA2FF 
+ 341      075FA3
+ 342 11a3 FF075FA3 		.ascii	"\377\007_\243\377\007`\243\377\007`\244\377\007`\244\377\007"
+ 342      FF0760A3 
+ 342      FF0760A4 
+ 342      FF0760A4 
+ 342      FF07
+ 343 11b5 60A4FF07 		.ascii	"`\244\377\007a\244\377\007a\245\377\007a\245\377\007a\245\377"
+GAS LISTING /tmp/ccKdOQhn.s 			page 23
+
+
+ 343      61A4FF07 
+ 343      61A5FF07 
+ 343      61A5FF07 
+ 343      61A5FF
+ 344 11c8 0762A5FF 		.ascii	"\007b\245\377\007b\246\377\007b\246\377\007b\246\377\007c\246"
+ 344      0762A6FF 
+ 344      0762A6FF 
+ 344      0762A6FF 
+ 344      0763A6
+ 345 11db FF0763A7 		.ascii	"\377\007c\247\377\007c\247\377\007c\247\377\007d\250\377\007"
+ 345      FF0763A7 
+ 345      FF0763A7 
+ 345      FF0764A8 
+ 345      FF07
+ 346 11ed 64A8FF07 		.ascii	"d\250\377\007d\250\377\007d\250\377\007e\251\377\007e\251\377"
+ 346      64A8FF07 
+ 346      64A8FF07 
+ 346      65A9FF07 
+ 346      65A9FF
+ 347 1200 0765A9FF 		.ascii	"\007e\251\377\007e\251\377\007f\252\377\007f\252\377\007f\252"
+ 347      0765A9FF 
+ 347      0766AAFF 
+ 347      0766AAFF 
+ 347      0766AA
+ 348 1213 FF0766AA 		.ascii	"\377\007f\252\377\007g\253\377\007g\253\377\007g\253\377\bg\254"
+ 348      FF0767AB 
+ 348      FF0767AB 
+ 348      FF0767AB 
+ 348      FF0867AC 
+ 349 1227 FF0768AC 		.ascii	"\377\007h\254\377\007h\254\377\007h\254\377\007h\254\377\007"
+ 349      FF0768AC 
+ 349      FF0768AC 
+ 349      FF0768AC 
+ 349      FF07
+ 350 1239 69ACFF07 		.ascii	"i\254\377\007i\254\377\bi\254\377\bi\255\377\bj\255\377\bj\255"
+ 350      69ACFF08 
+ 350      69ACFF08 
+ 350      69ADFF08 
+ 350      6AADFF08 
+ 351 124f FF086AAD 		.ascii	"\377\bj\255\377\bj\255\377\bj\255\377\bk\255\377\bk\255\377\b"
+ 351      FF086AAD 
+ 351      FF086AAD 
+ 351      FF086BAD 
+ 351      FF086BAD 
+ 352 1265 6BAEFF08 		.ascii	"k\256\377\bk\256\377\bl\256\377\bl\256\377\bl\256\377\bl\256"
+ 352      6BAEFF08 
+ 352      6CAEFF08 
+ 352      6CAEFF08 
+ 352      6CAEFF08 
+ 353 127b FF096DAE 		.ascii	"\377\tm\256\377\tm\256\377\tm\257\377\tm\257\377\tm\257\377\t"
+ 353      FF096DAE 
+ 353      FF096DAF 
+ 353      FF096DAF 
+ 353      FF096DAF 
+ 354 1291 6EAFFF09 		.ascii	"n\257\377\tn\257\377\tn\257\377\nn\257\377\no\257\377\no\260"
+ 354      6EAFFF09 
+ 354      6EAFFF0A 
+GAS LISTING /tmp/ccKdOQhn.s 			page 24
+
+
+ 354      6EAFFF0A 
+ 354      6FAFFF0A 
+ 355 12a7 FF0A6FB0 		.ascii	"\377\no\260\377\no\260\377\013o\260\377\013p\260\377\013p\260"
+ 355      FF0A6FB0 
+ 355      FF0B6FB0 
+ 355      FF0B70B0 
+ 355      FF0B70B0 
+ 356 12bb FF0B70B0 		.ascii	"\377\013p\260\377\013p\260\377\013q\261\377\fq\261\377\fq\261"
+ 356      FF0B70B0 
+ 356      FF0B71B1 
+ 356      FF0C71B1 
+ 356      FF0C71B1 
+ 357 12cf FF0C71B1 		.ascii	"\377\fq\261\377\fr\261\377\rr\261\377\rr\261\377\rr\261\377\r"
+ 357      FF0C72B1 
+ 357      FF0D72B1 
+ 357      FF0D72B1 
+ 357      FF0D72B1 
+ 358 12e5 72B2FF0D 		.ascii	"r\262\377\rs\262\377\016s\262\377\016s\262\377\016s\262\377\016"
+ 358      73B2FF0E 
+ 358      73B2FF0E 
+ 358      73B2FF0E 
+ 358      73B2FF0E 
+ 359 12f9 74B2FF0F 		.ascii	"t\262\377\017t\262\377\017t\262\377\017t\262\377\017t\263\377"
+ 359      74B2FF0F 
+ 359      74B2FF0F 
+ 359      74B2FF0F 
+ 359      74B3FF
+ 360 130c 1075B3FF 		.ascii	"\020u\263\377\020u\263\377\020u\263\377\020u\263\377\021v\263"
+ 360      1075B3FF 
+ 360      1075B3FF 
+ 360      1075B3FF 
+ 360      1176B3
+ 361 131f FF1176B3 		.ascii	"\377\021v\263\377\030}\267\377\030}\267\377\031~\267\377\031"
+ 361      FF187DB7 
+ 361      FF187DB7 
+ 361      FF197EB7 
+ 361      FF19
+ 362 1331 7EB7FF19 		.ascii	"~\267\377\031~\267\377\031~\267\377\032\177\270\377\032\177\270"
+ 362      7EB7FF19 
+ 362      7EB7FF1A 
+ 362      7FB8FF1A 
+ 362      7FB8
+ 363 1343 FF1A7FB8 		.ascii	"\377\032\177\270\377\033\177\270\377\033\177\270\377\033\200"
+ 363      FF1B7FB8 
+ 363      FF1B7FB8 
+ 363      FF1B80
+ 364 1352 B8FF1B80 		.ascii	"\270\377\033\200\270\377\034\200\270\377\034\200\270\377\034"
+ 364      B8FF1C80 
+ 364      B8FF1C80 
+ 364      B8FF1C
+ 365 1361 81B9FF1C 		.ascii	"\201\271\377\034\201\271\377\035\201\271\377\035\201\271\377"
+ 365      81B9FF1D 
+ 365      81B9FF1D 
+ 365      81B9FF
+ 366 1370 1D82B9FF 		.ascii	"\035\202\271\377\036\202\271\377\036\202\271\377\036\202\271"
+ 366      1E82B9FF 
+ 366      1E82B9FF 
+GAS LISTING /tmp/ccKdOQhn.s 			page 25
+
+
+ 366      1E82B9
+ 367 137f FF1E82B9 		.ascii	"\377\036\202\271\377\037\203\272\377\037\203\272\377\037\203"
+ 367      FF1F83BA 
+ 367      FF1F83BA 
+ 367      FF1F83
+ 368 138e BAFF2083 		.ascii	"\272\377 \203\272\377 \204\272\377 \204\272\377 \204\272\377"
+ 368      BAFF2084 
+ 368      BAFF2084 
+ 368      BAFF2084 
+ 368      BAFF
+ 369 13a0 2184BAFF 		.ascii	"!\204\272\377!\204\272\377!\205\272\377\"\205\273\377\"\205\273"
+ 369      2184BAFF 
+ 369      2185BAFF 
+ 369      2285BBFF 
+ 369      2285BB
+ 370 13b3 FF2285BB 		.ascii	"\377\"\205\273\377\"\206\273\377#\206\273\377#\206\273\377#\206"
+ 370      FF2286BB 
+ 370      FF2386BB 
+ 370      FF2386BB 
+ 370      FF2386
+ 371 13c6 BBFF2486 		.ascii	"\273\377$\206\273\377$\207\273\377$\207\273\377%\207\274\377"
+ 371      BBFF2487 
+ 371      BBFF2487 
+ 371      BBFF2587 
+ 371      BCFF
+ 372 13d8 2587BCFF 		.ascii	"%\207\274\377%\210\274\377%\210\274\377&\210\274\377&\210\274"
+ 372      2588BCFF 
+ 372      2588BCFF 
+ 372      2688BCFF 
+ 372      2688BC
+ 373 13eb FF2688BC 		.ascii	"\377&\210\274\377'\211\274\377'\211\274\377'\211\274\377'\211"
+ 373      FF2789BC 
+ 373      FF2789BC 
+ 373      FF2789BC 
+ 373      FF2789
+ 374 13fe BDFF288A 		.ascii	"\275\377(\212\275\377(\212\275\377(\212\275\377)\212\275\377"
+ 374      BDFF288A 
+ 374      BDFF288A 
+ 374      BDFF298A 
+ 374      BDFF
+ 375 1410 298ABDFF 		.ascii	")\212\275\377)\213\275\377*\213\275\377*\213\275\377*\213\275"
+ 375      298BBDFF 
+ 375      2A8BBDFF 
+ 375      2A8BBDFF 
+ 375      2A8BBD
+ 376 1423 FF2B8CBE 		.ascii	"\377+\214\276\377+\214\276\377+\214\276\377+\214\276\377+\214"
+ 376      FF2B8CBE 
+ 376      FF2B8CBE 
+ 376      FF2B8CBE 
+ 376      FF2B8C
+ 377 1436 BEFF2B8D 		.ascii	"\276\377+\215\276\377+\215\276\377+\215\277\377,\215\277\377"
+ 377      BEFF2B8D 
+ 377      BEFF2B8D 
+ 377      BFFF2C8D 
+ 377      BFFF
+ 378 1448 2C8EBFFF 		.ascii	",\216\277\377,\216\277\377,\216\277\377,\216\277\377,\217\277"
+ 378      2C8EBFFF 
+GAS LISTING /tmp/ccKdOQhn.s 			page 26
+
+
+ 378      2C8EBFFF 
+ 378      2C8EBFFF 
+ 378      2C8FBF
+ 379 145b FF2D8FC0 		.ascii	"\377-\217\300\377-\217\300\377-\217\300\377-\220\300\377-\220"
+ 379      FF2D8FC0 
+ 379      FF2D8FC0 
+ 379      FF2D90C0 
+ 379      FF2D90
+ 380 146e C0FF2D90 		.ascii	"\300\377-\220\300\377.\220\300\377.\221\301\377.\221\301\377"
+ 380      C0FF2E90 
+ 380      C0FF2E91 
+ 380      C1FF2E91 
+ 380      C1FF
+ 381 1480 2E91C1FF 		.ascii	".\221\301\377.\221\301\377.\222\301\377/\222\301\377/\222\301"
+ 381      2E91C1FF 
+ 381      2E92C1FF 
+ 381      2F92C1FF 
+ 381      2F92C1
+ 382 1493 FF2F92C2 		.ascii	"\377/\222\302\377/\223\302\377/\223\302\3770\223\302\3770\223"
+ 382      FF2F93C2 
+ 382      FF2F93C2 
+ 382      FF3093C2 
+ 382      FF3093
+ 383 14a6 C2FF3094 		.ascii	"\302\3770\224\302\3770\224\302\3770\224\302\3770\224\303\377"
+ 383      C2FF3094 
+ 383      C2FF3094 
+ 383      C2FF3094 
+ 383      C3FF
+ 384 14b8 3195C3FF 		.ascii	"1\225\303\3771\225\303\3771\225\303\3771\225\303\3771\226\303"
+ 384      3195C3FF 
+ 384      3195C3FF 
+ 384      3195C3FF 
+ 384      3196C3
+ 385 14cb FF3296C3 		.ascii	"\3772\226\303\3772\226\304\3772\226\304\3772\227\304\3772\227"
+ 385      FF3296C4 
+ 385      FF3296C4 
+ 385      FF3297C4 
+ 385      FF3297
+ 386 14de C4FF3397 		.ascii	"\304\3773\227\304\3773\227\304\3773\227\304\3773\230\305\377"
+ 386      C4FF3397 
+ 386      C4FF3397 
+ 386      C4FF3398 
+ 386      C5FF
+ 387 14f0 3398C5FF 		.ascii	"3\230\305\3774\230\305\3774\230\305\3774\231\305\3774\231\305"
+ 387      3498C5FF 
+ 387      3498C5FF 
+ 387      3499C5FF 
+ 387      3499C5
+ 388 1503 FF3599C5 		.ascii	"\3775\231\305\3775\231\305\3775\232\306\3775\232\306\3775\232"
+ 388      FF3599C5 
+ 388      FF359AC6 
+ 388      FF359AC6 
+ 388      FF359A
+ 389 1516 C6FF369A 		.ascii	"\306\3776\232\306\3776\233\306\3776\233\306\377=\243\313\377"
+ 389      C6FF369B 
+ 389      C6FF369B 
+ 389      C6FF3DA3 
+GAS LISTING /tmp/ccKdOQhn.s 			page 27
+
+
+ 389      CBFF
+ 390 1528 3EA3CBFF 		.ascii	">\243\313\377>\243\313\377>\244\313\377>\244\313\377>\244\313"
+ 390      3EA3CBFF 
+ 390      3EA4CBFF 
+ 390      3EA4CBFF 
+ 390      3EA4CB
+ 391 153b FF3FA4CB 		.ascii	"\377?\244\313\377?\245\313\377?\245\314\377?\245\314\377@\245"
+ 391      FF3FA5CB 
+ 391      FF3FA5CC 
+ 391      FF3FA5CC 
+ 391      FF40A5
+ 392 154e CCFF40A6 		.ascii	"\314\377@\246\314\377@\246\314\377@\246\314\377A\246\314\377"
+ 392      CCFF40A6 
+ 392      CCFF40A6 
+ 392      CCFF41A6 
+ 392      CCFF
+ 393 1560 41A7CDFF 		.ascii	"A\247\315\377A\247\315\377A\247\315\377B\247\315\377B\250\315"
+ 393      41A7CDFF 
+ 393      41A7CDFF 
+ 393      42A7CDFF 
+ 393      42A8CD
+ 394 1573 FF42A8CD 		.ascii	"\377B\250\315\377B\250\315\377C\250\315\377C\251\316\377C\251"
+ 394      FF42A8CD 
+ 394      FF43A8CD 
+ 394      FF43A9CE 
+ 394      FF43A9
+ 395 1586 CEFF43A9 		.ascii	"\316\377C\251\316\377D\251\316\377D\252\316\377D\252\316\377"
+ 395      CEFF44A9 
+ 395      CEFF44AA 
+ 395      CEFF44AA 
+ 395      CEFF
+ 396 1598 44AACEFF 		.ascii	"D\252\316\377E\252\316\377E\253\317\377E\253\317\377E\253\317"
+ 396      45AACEFF 
+ 396      45ABCFFF 
+ 396      45ABCFFF 
+ 396      45ABCF
+ 397 15ab FF46ABCF 		.ascii	"\377F\253\317\377F\253\317\377F\254\317\377F\254\317\377G\254"
+ 397      FF46ABCF 
+ 397      FF46ACCF 
+ 397      FF46ACCF 
+ 397      FF47AC
+ 398 15be CFFF47AC 		.ascii	"\317\377G\254\317\377G\255\320\377G\255\320\377H\255\320\377"
+ 398      CFFF47AD 
+ 398      D0FF47AD 
+ 398      D0FF48AD 
+ 398      D0FF
+ 399 15d0 48ADD0FF 		.ascii	"H\255\320\377H\256\320\377H\256\320\377I\256\320\377I\256\320"
+ 399      48AED0FF 
+ 399      48AED0FF 
+ 399      49AED0FF 
+ 399      49AED0
+ 400 15e3 FF49AFD1 		.ascii	"\377I\257\321\377I\257\321\377J\257\321\377J\257\321\377J\260"
+ 400      FF49AFD1 
+ 400      FF4AAFD1 
+ 400      FF4AAFD1 
+ 400      FF4AB0
+ 401 15f6 D1FF4BB0 		.ascii	"\321\377K\260\321\377K\260\321\377K\260\321\377K\261\322\377"
+GAS LISTING /tmp/ccKdOQhn.s 			page 28
+
+
+ 401      D1FF4BB0 
+ 401      D1FF4BB0 
+ 401      D1FF4BB1 
+ 401      D2FF
+ 402 1608 4CB1D2FF 		.ascii	"L\261\322\377L\261\322\377L\261\322\377L\262\322\377M\262\322"
+ 402      4CB1D2FF 
+ 402      4CB1D2FF 
+ 402      4CB2D2FF 
+ 402      4DB2D2
+ 403 161b FF4DB2D2 		.ascii	"\377M\262\322\377M\262\322\377N\263\323\377N\263\322\377N\263"
+ 403      FF4DB2D2 
+ 403      FF4EB3D3 
+ 403      FF4EB3D2 
+ 403      FF4EB3
+ 404 162e D2FF4EB3 		.ascii	"\322\377N\263\322\377N\263\322\377N\263\322\377N\264\322\377"
+ 404      D2FF4EB3 
+ 404      D2FF4EB3 
+ 404      D2FF4EB4 
+ 404      D2FF
+ 405 1640 4EB4D2FF 		.ascii	"N\264\322\377N\264\322\377N\264\322\377O\264\322\377O\264\322"
+ 405      4EB4D2FF 
+ 405      4EB4D2FF 
+ 405      4FB4D2FF 
+ 405      4FB4D2
+ 406 1653 FF4FB5D2 		.ascii	"\377O\265\322\377O\265\322\377O\265\322\377O\265\321\377O\265"
+ 406      FF4FB5D2 
+ 406      FF4FB5D2 
+ 406      FF4FB5D1 
+ 406      FF4FB5
+ 407 1666 D1FF50B6 		.ascii	"\321\377P\266\321\377P\266\321\377P\266\321\377P\266\321\377"
+ 407      D1FF50B6 
+ 407      D1FF50B6 
+ 407      D1FF50B6 
+ 407      D1FF
+ 408 1678 50B6D1FF 		.ascii	"P\266\321\377P\266\321\377Q\267\321\377Q\267\321\377Q\267\321"
+ 408      50B6D1FF 
+ 408      51B7D1FF 
+ 408      51B7D1FF 
+ 408      51B7D1
+ 409 168b FF51B7D1 		.ascii	"\377Q\267\321\377Q\267\320\377R\267\320\377R\270\320\377R\270"
+ 409      FF51B7D0 
+ 409      FF52B7D0 
+ 409      FF52B8D0 
+ 409      FF52B8
+ 410 169e D0FF52B8 		.ascii	"\320\377R\270\320\377R\270\320\377S\270\320\377S\270\320\377"
+ 410      D0FF52B8 
+ 410      D0FF53B8 
+ 410      D0FF53B8 
+ 410      D0FF
+ 411 16b0 53B9D0FF 		.ascii	"S\271\320\377S\271\320\377S\271\320\377T\271\317\377T\271\317"
+ 411      53B9D0FF 
+ 411      53B9D0FF 
+ 411      54B9CFFF 
+ 411      54B9CF
+ 412 16c3 FF54B9CF 		.ascii	"\377T\271\317\377T\272\317\377U\272\317\377U\272\317\377U\272"
+ 412      FF54BACF 
+ 412      FF55BACF 
+GAS LISTING /tmp/ccKdOQhn.s 			page 29
+
+
+ 412      FF55BACF 
+ 412      FF55BA
+ 413 16d6 CFFF55BA 		.ascii	"\317\377U\272\317\377V\272\317\377V\273\317\377V\273\317\377"
+ 413      CFFF56BA 
+ 413      CFFF56BB 
+ 413      CFFF56BB 
+ 413      CFFF
+ 414 16e8 56BBCEFF 		.ascii	"V\273\316\377W\273\316\377W\273\316\377W\273\316\377X\274\316"
+ 414      57BBCEFF 
+ 414      57BBCEFF 
+ 414      57BBCEFF 
+ 414      58BCCE
+ 415 16fb FF58BCCE 		.ascii	"\377X\274\316\377X\274\316\377X\274\316\377Y\274\316\377Y\274"
+ 415      FF58BCCE 
+ 415      FF58BCCE 
+ 415      FF59BCCE 
+ 415      FF59BC
+ 416 170e CEFF59BC 		.ascii	"\316\377Y\274\315\377Z\275\315\377Z\275\315\377Z\275\315\377"
+ 416      CDFF5ABD 
+ 416      CDFF5ABD 
+ 416      CDFF5ABD 
+ 416      CDFF
+ 417 1720 5ABDCDFF 		.ascii	"Z\275\315\377d\302\312\377d\302\312\377d\303\312\377e\303\312"
+ 417      64C2CAFF 
+ 417      64C2CAFF 
+ 417      64C3CAFF 
+ 417      65C3CA
+ 418 1733 FF65C3CA 		.ascii	"\377e\303\312\377e\303\311\377f\303\311\377f\303\311\377f\303"
+ 418      FF65C3C9 
+ 418      FF66C3C9 
+ 418      FF66C3C9 
+ 418      FF66C3
+ 419 1746 C9FF67C4 		.ascii	"\311\377g\304\311\377g\304\311\377g\304\311\377h\304\311\377"
+ 419      C9FF67C4 
+ 419      C9FF67C4 
+ 419      C9FF68C4 
+ 419      C9FF
+ 420 1758 68C4C9FF 		.ascii	"h\304\311\377h\304\311\377i\305\310\377i\305\310\377i\305\310"
+ 420      68C4C9FF 
+ 420      69C5C8FF 
+ 420      69C5C8FF 
+ 420      69C5C8
+ 421 176b FF6AC5C8 		.ascii	"\377j\305\310\377j\305\310\377j\305\310\377k\305\310\377k\306"
+ 421      FF6AC5C8 
+ 421      FF6AC5C8 
+ 421      FF6BC5C8 
+ 421      FF6BC6
+ 422 177e C8FF6BC6 		.ascii	"\310\377k\306\310\377l\306\307\377l\306\307\377l\306\307\377"
+ 422      C8FF6CC6 
+ 422      C7FF6CC6 
+ 422      C7FF6CC6 
+ 422      C7FF
+ 423 1790 6DC6C7FF 		.ascii	"m\306\307\377m\306\307\377m\307\307\377n\307\307\377n\307\307"
+ 423      6DC6C7FF 
+ 423      6DC7C7FF 
+ 423      6EC7C7FF 
+ 423      6EC7C7
+GAS LISTING /tmp/ccKdOQhn.s 			page 30
+
+
+ 424 17a3 FF6FC7C7 		.ascii	"\377o\307\307\377o\307\307\377o\307\306\377p\307\306\377p\310"
+ 424      FF6FC7C7 
+ 424      FF6FC7C6 
+ 424      FF70C7C6 
+ 424      FF70C8
+ 425 17b6 C6FF70C8 		.ascii	"\306\377p\310\306\377q\310\306\377q\310\306\377q\310\306\377"
+ 425      C6FF71C8 
+ 425      C6FF71C8 
+ 425      C6FF71C8 
+ 425      C6FF
+ 426 17c8 72C8C6FF 		.ascii	"r\310\306\377r\310\306\377s\311\306\377s\311\305\377s\311\305"
+ 426      72C8C6FF 
+ 426      73C9C6FF 
+ 426      73C9C5FF 
+ 426      73C9C5
+ 427 17db FF74C9C5 		.ascii	"\377t\311\305\377t\311\305\377t\311\305\377u\311\305\377u\312"
+ 427      FF74C9C5 
+ 427      FF74C9C5 
+ 427      FF75C9C5 
+ 427      FF75CA
+ 428 17ee C5FF     		.ascii	"\305\377"
+ 429 17f0 76CAC5FF 		.ascii	"v\312\305\377v\312\305\377v\312\305\377w\312\304\377w\312\304"
+ 429      76CAC5FF 
+ 429      76CAC5FF 
+ 429      77CAC4FF 
+ 429      77CAC4
+ 430 1803 FF77CAC4 		.ascii	"\377w\312\304\377x\313\304\377x\313\304\377y\313\304\377y\313"
+ 430      FF78CBC4 
+ 430      FF78CBC4 
+ 430      FF79CBC4 
+ 430      FF79CB
+ 431 1816 C4FF79CB 		.ascii	"\304\377y\313\304\377z\313\304\377z\313\304\377{\314\303\377"
+ 431      C4FF7ACB 
+ 431      C4FF7ACB 
+ 431      C4FF7BCC 
+ 431      C3FF
+ 432 1828 7BCCC3FF 		.ascii	"{\314\303\377{\314\303\377{\314\303\377{\314\303\377|\314\303"
+ 432      7BCCC3FF 
+ 432      7BCCC3FF 
+ 432      7BCCC3FF 
+ 432      7CCCC3
+ 433 183b FF7CCCC3 		.ascii	"\377|\314\303\377|\314\303\377|\314\303\377|\315\303\377}\315"
+ 433      FF7CCCC3 
+ 433      FF7CCCC3 
+ 433      FF7CCDC3 
+ 433      FF7DCD
+ 434 184e C3FF7DCD 		.ascii	"\303\377}\315\303\377}\315\302\377}\315\302\377~\315\302\377"
+ 434      C3FF7DCD 
+ 434      C2FF7DCD 
+ 434      C2FF7ECD 
+ 434      C2FF
+ 435 1860 7ECDC2FF 		.ascii	"~\315\302\377~\315\302\377~\316\302\377~\316\302\377\177\316"
+ 435      7ECDC2FF 
+ 435      7ECEC2FF 
+ 435      7ECEC2FF 
+ 435      7FCE
+ 436 1872 C2FF7FCE 		.ascii	"\302\377\177\316\302\377\177\316\302\377\177\316\302\377\200"
+GAS LISTING /tmp/ccKdOQhn.s 			page 31
+
+
+ 436      C2FF7FCE 
+ 436      C2FF7FCE 
+ 436      C2FF80
+ 437 1881 CEC1FF80 		.ascii	"\316\301\377\200\316\301\377\200\316\301\377\200\317\301\377"
+ 437      CEC1FF80 
+ 437      CEC1FF80 
+ 437      CFC1FF
+ 438 1890 81CFC1FF 		.ascii	"\201\317\301\377\201\317\301\377\201\317\301\377\201\317\301"
+ 438      81CFC1FF 
+ 438      81CFC1FF 
+ 438      81CFC1
+ 439 189f FF82CFC1 		.ascii	"\377\202\317\301\377\202\317\301\377\202\317\301\377\202\320"
+ 439      FF82CFC1 
+ 439      FF82CFC1 
+ 439      FF82D0
+ 440 18ae C0FF83D0 		.ascii	"\300\377\203\320\300\377\203\320\300\377\203\320\300\377\203"
+ 440      C0FF83D0 
+ 440      C0FF83D0 
+ 440      C0FF83
+ 441 18bd D0C0FF84 		.ascii	"\320\300\377\204\320\300\377\204\320\300\377\204\320\300\377"
+ 441      D0C0FF84 
+ 441      D0C0FF84 
+ 441      D0C0FF
+ 442 18cc 84D0C0FF 		.ascii	"\204\320\300\377\205\321\300\377\205\321\300\377\205\321\277"
+ 442      85D1C0FF 
+ 442      85D1C0FF 
+ 442      85D1BF
+ 443 18db FF85D1BF 		.ascii	"\377\205\321\277\377\206\321\277\377\206\321\277\377\206\321"
+ 443      FF86D1BF 
+ 443      FF86D1BF 
+ 443      FF86D1
+ 444 18ea BFFF87D1 		.ascii	"\277\377\207\321\277\377\207\321\277\377\207\322\277\377\207"
+ 444      BFFF87D1 
+ 444      BFFF87D2 
+ 444      BFFF87
+ 445 18f9 D2BFFF88 		.ascii	"\322\277\377\210\322\277\377\210\322\276\377\210\322\276\377"
+ 445      D2BFFF88 
+ 445      D2BEFF88 
+ 445      D2BEFF
+ 446 1908 89D2BEFF 		.ascii	"\211\322\276\377\211\322\276\377\211\322\276\377\211\322\276"
+ 446      89D2BEFF 
+ 446      89D2BEFF 
+ 446      89D2BE
+ 447 1917 FF8AD3BE 		.ascii	"\377\212\323\276\377\212\323\276\377\212\323\276\377\223\326"
+ 447      FF8AD3BE 
+ 447      FF8AD3BE 
+ 447      FF93D6
+ 448 1926 BBFF94D6 		.ascii	"\273\377\224\326\272\377\224\326\272\377\224\327\272\377\225"
+ 448      BAFF94D6 
+ 448      BAFF94D7 
+ 448      BAFF95
+ 449 1935 D7BAFF95 		.ascii	"\327\272\377\225\327\272\377\225\327\272\377\226\327\272\377"
+ 449      D7BAFF95 
+ 449      D7BAFF96 
+ 449      D7BAFF
+ 450 1944 96D7BAFF 		.ascii	"\226\327\272\377\226\327\272\377\226\327\272\377\227\327\271"
+ 450      96D7BAFF 
+GAS LISTING /tmp/ccKdOQhn.s 			page 32
+
+
+ 450      96D7BAFF 
+ 450      97D7B9
+ 451 1953 FF97D7B9 		.ascii	"\377\227\327\271\377\227\330\271\377\230\330\271\377\230\330"
+ 451      FF97D8B9 
+ 451      FF98D8B9 
+ 451      FF98D8
+ 452 1962 B9FF98D8 		.ascii	"\271\377\230\330\271\377\230\330\271\377\231\330\271\377\231"
+ 452      B9FF98D8 
+ 452      B9FF99D8 
+ 452      B9FF99
+ 453 1971 D8B9FF99 		.ascii	"\330\271\377\231\330\271\377\232\330\271\377\232\331\270\377"
+ 453      D8B9FF9A 
+ 453      D8B9FF9A 
+ 453      D9B8FF
+ 454 1980 9AD9B8FF 		.ascii	"\232\331\270\377\233\331\270\377\233\331\270\377\233\331\270"
+ 454      9BD9B8FF 
+ 454      9BD9B8FF 
+ 454      9BD9B8
+ 455 198f FF9CD9B8 		.ascii	"\377\234\331\270\377\234\331\270\377\234\331\270\377\234\331"
+ 455      FF9CD9B8 
+ 455      FF9CD9B8 
+ 455      FF9CD9
+ 456 199e B8FF9DD9 		.ascii	"\270\377\235\331\270\377\235\332\267\377\235\332\267\377\236"
+ 456      B8FF9DDA 
+ 456      B7FF9DDA 
+ 456      B7FF9E
+ 457 19ad DAB7FF9E 		.ascii	"\332\267\377\236\332\267\377\236\332\267\377\237\332\267\377"
+ 457      DAB7FF9E 
+ 457      DAB7FF9F 
+ 457      DAB7FF
+ 458 19bc 9FDAB7FF 		.ascii	"\237\332\267\377\237\332\267\377\240\332\267\377\240\332\267"
+ 458      9FDAB7FF 
+ 458      A0DAB7FF 
+ 458      A0DAB7
+ 459 19cb FFA0DAB7 		.ascii	"\377\240\332\267\377\241\333\266\377\241\333\266\377\241\333"
+ 459      FFA1DBB6 
+ 459      FFA1DBB6 
+ 459      FFA1DB
+ 460 19da B6FFA2DB 		.ascii	"\266\377\242\333\266\377\242\333\266\377\242\333\266\377\243"
+ 460      B6FFA2DB 
+ 460      B6FFA2DB 
+ 460      B6FFA3
+ 461 19e9 DBB6FFA3 		.ascii	"\333\266\377\243\333\266\377\243\333\266\377\244\333\266\377"
+ 461      DBB6FFA3 
+ 461      DBB6FFA4 
+ 461      DBB6FF
+ 462 19f8 A4DCB5FF 		.ascii	"\244\334\265\377\244\334\265\377\245\334\265\377\245\334\265"
+ 462      A4DCB5FF 
+ 462      A5DCB5FF 
+ 462      A5DCB5
+ 463 1a07 FFA5DCB5 		.ascii	"\377\245\334\265\377\245\334\265\377\246\334\265\377\246\334"
+ 463      FFA5DCB5 
+ 463      FFA6DCB5 
+ 463      FFA6DC
+ 464 1a16 B5FFA6DC 		.ascii	"\265\377\246\334\265\377\247\334\265\377\247\334\265\377\247"
+ 464      B5FFA7DC 
+ 464      B5FFA7DC 
+GAS LISTING /tmp/ccKdOQhn.s 			page 33
+
+
+ 464      B5FFA7
+ 465 1a25 DDB4FFA8 		.ascii	"\335\264\377\250\335\265\377\250\335\265\377\250\335\265\377"
+ 465      DDB5FFA8 
+ 465      DDB5FFA8 
+ 465      DDB5FF
+ 466 1a34 A8DDB5FF 		.ascii	"\250\335\265\377\251\335\265\377\251\335\265\377\251\335\265"
+ 466      A9DDB5FF 
+ 466      A9DDB5FF 
+ 466      A9DDB5
+ 467 1a43 FFA9DDB5 		.ascii	"\377\251\335\265\377\252\335\265\377\252\335\265\377\252\335"
+ 467      FFAADDB5 
+ 467      FFAADDB5 
+ 467      FFAADD
+ 468 1a52 B5FFAADE 		.ascii	"\265\377\252\336\266\377\253\336\266\377\253\336\266\377\253"
+ 468      B6FFABDE 
+ 468      B6FFABDE 
+ 468      B6FFAB
+ 469 1a61 DEB6FFAB 		.ascii	"\336\266\377\253\336\266\377\254\336\266\377\254\336\266\377"
+ 469      DEB6FFAC 
+ 469      DEB6FFAC 
+ 469      DEB6FF
+ 470 1a70 ACDEB6FF 		.ascii	"\254\336\266\377\254\336\266\377\254\336\266\377\255\336\266"
+ 470      ACDEB6FF 
+ 470      ACDEB6FF 
+ 470      ADDEB6
+ 471 1a7f FFADDFB6 		.ascii	"\377\255\337\266\377\255\337\267\377\255\337\267\377\256\337"
+ 471      FFADDFB7 
+ 471      FFADDFB7 
+ 471      FFAEDF
+ 472 1a8e B7FFAEDF 		.ascii	"\267\377\256\337\267\377\256\337\267\377\256\337\267\377\257"
+ 472      B7FFAEDF 
+ 472      B7FFAEDF 
+ 472      B7FFAF
+ 473 1a9d DFB7FFAF 		.ascii	"\337\267\377\257\337\267\377\257\337\267\377\257\337\267\377"
+ 473      DFB7FFAF 
+ 473      DFB7FFAF 
+ 473      DFB7FF
+ 474 1aac B0DFB7FF 		.ascii	"\260\337\267\377\260\340\270\377\260\340\270\377\260\340\270"
+ 474      B0E0B8FF 
+ 474      B0E0B8FF 
+ 474      B0E0B8
+ 475 1abb FFB0E0B8 		.ascii	"\377\260\340\270\377\261\340\270\377\261\340\270\377\261\340"
+ 475      FFB1E0B8 
+ 475      FFB1E0B8 
+ 475      FFB1E0
+ 476 1aca B8FFB1E0 		.ascii	"\270\377\261\340\270\377\262\340\270\377\262\340\270\377\262"
+ 476      B8FFB2E0 
+ 476      B8FFB2E0 
+ 476      B8FFB2
+ 477 1ad9 E0B9FFB2 		.ascii	"\340\271\377\262\341\271\377\263\341\271\377\263\341\271\377"
+ 477      E1B9FFB3 
+ 477      E1B9FFB3 
+ 477      E1B9FF
+ 478 1ae8 B3E1B9FF 		.ascii	"\263\341\271\377\263\341\271\377\263\341\271\377\264\341\271"
+ 478      B3E1B9FF 
+ 478      B3E1B9FF 
+ 478      B4E1B9
+GAS LISTING /tmp/ccKdOQhn.s 			page 34
+
+
+ 479 1af7 FFB4E1B9 		.ascii	"\377\264\341\271\377\264\341\271\377\264\341\271\377\265\341"
+ 479      FFB4E1B9 
+ 479      FFB4E1B9 
+ 479      FFB5E1
+ 480 1b06 BAFFB5E1 		.ascii	"\272\377\265\341\272\377\265\342\272\377\265\342\272\377\265"
+ 480      BAFFB5E2 
+ 480      BAFFB5E2 
+ 480      BAFFB5
+ 481 1b15 E2BAFFB6 		.ascii	"\342\272\377\266\342\272\377\266\342\272\377\266\342\272\377"
+ 481      E2BAFFB6 
+ 481      E2BAFFB6 
+ 481      E2BAFF
+ 482 1b24 BEE5BEFF 		.ascii	"\276\345\276\377\276\345\276\377\276\345\276\377\276\345\276"
+ 482      BEE5BEFF 
+ 482      BEE5BEFF 
+ 482      BEE5BE
+ 483 1b33 FFBEE5BE 		.ascii	"\377\276\345\276\377\277\345\276\377\277\345\276\377\277\345"
+ 483      FFBFE5BE 
+ 483      FFBFE5BE 
+ 483      FFBFE5
+ 484 1b42 BEFFBFE6 		.ascii	"\276\377\277\346\276\377\300\346\276\377\300\346\277\377\300"
+ 484      BEFFC0E6 
+ 484      BEFFC0E6 
+ 484      BFFFC0
+ 485 1b51 E6BFFFC0 		.ascii	"\346\277\377\300\346\277\377\300\346\277\377\301\346\277\377"
+ 485      E6BFFFC0 
+ 485      E6BFFFC1 
+ 485      E6BFFF
+ 486 1b60 C1E6BFFF 		.ascii	"\301\346\277\377\301\346\277\377\301\346\277\377\302\346\277"
+ 486      C1E6BFFF 
+ 486      C1E6BFFF 
+ 486      C2E6BF
+ 487 1b6f FFC2E7C0 		.ascii	"\377\302\347\300\377\302\347\300\377\302\347\300\377\302\347"
+ 487      FFC2E7C0 
+ 487      FFC2E7C0 
+ 487      FFC2E7
+ 488 1b7e C0FFC3E7 		.ascii	"\300\377\303\347\300\377\303\347\300\377\303\347\300\377\303"
+ 488      C0FFC3E7 
+ 488      C0FFC3E7 
+ 488      C0FFC3
+ 489 1b8d E7C0FFC4 		.ascii	"\347\300\377\304\347\300\377\304\347\300\377\304\347\301\377"
+ 489      E7C0FFC4 
+ 489      E7C0FFC4 
+ 489      E7C1FF
+ 490 1b9c C4E8C1FF 		.ascii	"\304\350\301\377\304\350\301\377\305\350\301\377\305\350\301"
+ 490      C4E8C1FF 
+ 490      C5E8C1FF 
+ 490      C5E8C1
+ 491 1bab FFC5E8C1 		.ascii	"\377\305\350\301\377\305\350\301\377\306\350\301\377\306\350"
+ 491      FFC5E8C1 
+ 491      FFC6E8C1 
+ 491      FFC6E8
+ 492 1bba C1FFC6E8 		.ascii	"\301\377\306\350\302\377\306\350\302\377\306\350\302\377\307"
+ 492      C2FFC6E8 
+ 492      C2FFC6E8 
+ 492      C2FFC7
+ 493 1bc9 E8C2FFC7 		.ascii	"\350\302\377\307\351\302\377\307\351\302\377\307\351\302\377"
+GAS LISTING /tmp/ccKdOQhn.s 			page 35
+
+
+ 493      E9C2FFC7 
+ 493      E9C2FFC7 
+ 493      E9C2FF
+ 494 1bd8 C7E9C2FF 		.ascii	"\307\351\302\377\310\351\302\377\310\351\303\377\310\351\303"
+ 494      C8E9C2FF 
+ 494      C8E9C3FF 
+ 494      C8E9C3
+ 495 1be7 FFC8E9C3 		.ascii	"\377\310\351\303\377\311\351\303\377\311\351\303\377\311\351"
+ 495      FFC9E9C3 
+ 495      FFC9E9C3 
+ 495      FFC9E9
+ 496 1bf6 C3FFC9EA 		.ascii	"\303\377\311\352\303\377\311\352\303\377\312\352\303\377\312"
+ 496      C3FFC9EA 
+ 496      C3FFCAEA 
+ 496      C3FFCA
+ 497 1c05 EAC4FFCA 		.ascii	"\352\304\377\312\352\304\377\312\352\304\377\312\352\304\377"
+ 497      EAC4FFCA 
+ 497      EAC4FFCA 
+ 497      EAC4FF
+ 498 1c14 CBEAC4FF 		.ascii	"\313\352\304\377\313\352\304\377\313\352\304\377\313\352\304"
+ 498      CBEAC4FF 
+ 498      CBEAC4FF 
+ 498      CBEAC4
+ 499 1c23 FFCBEBC4 		.ascii	"\377\313\353\304\377\314\353\305\377\314\353\305\377\314\353"
+ 499      FFCCEBC5 
+ 499      FFCCEBC5 
+ 499      FFCCEB
+ 500 1c32 C5FFCCEB 		.ascii	"\305\377\314\353\305\377\314\353\305\377\314\353\305\377\314"
+ 500      C5FFCCEB 
+ 500      C5FFCCEB 
+ 500      C5FFCC
+ 501 1c41 EBC5FFCD 		.ascii	"\353\305\377\315\353\306\377\315\353\306\377\315\353\306\377"
+ 501      EBC6FFCD 
+ 501      EBC6FFCD 
+ 501      EBC6FF
+ 502 1c50 CDEBC6FF 		.ascii	"\315\353\306\377\315\353\306\377\315\353\306\377\315\353\306"
+ 502      CDEBC6FF 
+ 502      CDEBC6FF 
+ 502      CDEBC6
+ 503 1c5f FFCDEBC7 		.ascii	"\377\315\353\307\377\316\353\307\377\316\353\307\377\316\353"
+ 503      FFCEEBC7 
+ 503      FFCEEBC7 
+ 503      FFCEEB
+ 504 1c6e C7FFCEEB 		.ascii	"\307\377\316\353\307\377\316\354\307\377\316\354\307\377\316"
+ 504      C7FFCEEC 
+ 504      C7FFCEEC 
+ 504      C7FFCE
+ 505 1c7d ECC8FFCE 		.ascii	"\354\310\377\316\354\310\377\317\354\310\377\317\354\310\377"
+ 505      ECC8FFCF 
+ 505      ECC8FFCF 
+ 505      ECC8FF
+ 506 1c8c CFECC8FF 		.ascii	"\317\354\310\377\317\354\310\377\317\354\310\377\317\354\310"
+ 506      CFECC8FF 
+ 506      CFECC8FF 
+ 506      CFECC8
+ 507 1c9b FFCFECC9 		.ascii	"\377\317\354\311\377\317\354\311\377\320\354\311\377\320\354"
+ 507      FFCFECC9 
+GAS LISTING /tmp/ccKdOQhn.s 			page 36
+
+
+ 507      FFD0ECC9 
+ 507      FFD0EC
+ 508 1caa C9FFD0EC 		.ascii	"\311\377\320\354\311\377\320\354\311\377\320\354\311\377\320"
+ 508      C9FFD0EC 
+ 508      C9FFD0EC 
+ 508      C9FFD0
+ 509 1cb9 ECCAFFD0 		.ascii	"\354\312\377\320\354\312\377\320\354\312\377\321\355\312\377"
+ 509      ECCAFFD0 
+ 509      ECCAFFD1 
+ 509      EDCAFF
+ 510 1cc8 D1EDCAFF 		.ascii	"\321\355\312\377\321\355\312\377\321\355\312\377\321\355\313"
+ 510      D1EDCAFF 
+ 510      D1EDCAFF 
+ 510      D1EDCB
+ 511 1cd7 FFD1EDCB 		.ascii	"\377\321\355\313\377\321\355\313\377\321\355\313\377\322\355"
+ 511      FFD1EDCB 
+ 511      FFD1EDCB 
+ 511      FFD2ED
+ 512 1ce6 CBFFD2ED 		.ascii	"\313\377\322\355\313\377\322\355\313\377\322\355\313\377\322"
+ 512      CBFFD2ED 
+ 512      CBFFD2ED 
+ 512      CBFFD2
+ 513 1cf5 EDCCFFD2 		.ascii	"\355\314\377\322\355\314\377\322\355\314\377\322\355\314\377"
+ 513      EDCCFFD2 
+ 513      EDCCFFD2 
+ 513      EDCCFF
+ 514 1d04 D3EDCCFF 		.ascii	"\323\355\314\377\323\355\314\377\323\355\314\377\323\355\315"
+ 514      D3EDCCFF 
+ 514      D3EDCCFF 
+ 514      D3EDCD
+ 515 1d13 FFD3EECD 		.ascii	"\377\323\356\315\377\323\356\315\377\323\356\315\377\323\356"
+ 515      FFD3EECD 
+ 515      FFD3EECD 
+ 515      FFD3EE
+ 516 1d22 CDFFD8EF 		.ascii	"\315\377\330\357\322\377\330\357\322\377\330\357\322\377\330"
+ 516      D2FFD8EF 
+ 516      D2FFD8EF 
+ 516      D2FFD8
+ 517 1d31 EFD2FFD8 		.ascii	"\357\322\377\330\360\322\377\330\360\322\377\330\360\322\377"
+ 517      F0D2FFD8 
+ 517      F0D2FFD8 
+ 517      F0D2FF
+ 518 1d40 D8F0D3FF 		.ascii	"\330\360\323\377\331\360\323\377\331\360\323\377\331\360\323"
+ 518      D9F0D3FF 
+ 518      D9F0D3FF 
+ 518      D9F0D3
+ 519 1d4f FFD9F0D3 		.ascii	"\377\331\360\323\377\331\360\323\377\331\360\323\377\331\360"
+ 519      FFD9F0D3 
+ 519      FFD9F0D3 
+ 519      FFD9F0
+ 520 1d5e D4FFD9F0 		.ascii	"\324\377\331\360\324\377\332\360\324\377\332\360\324\377\332"
+ 520      D4FFDAF0 
+ 520      D4FFDAF0 
+ 520      D4FFDA
+ 521 1d6d F0D4FFDA 		.ascii	"\360\324\377\332\360\324\377\332\360\324\377\332\360\325\377"
+ 521      F0D4FFDA 
+ 521      F0D4FFDA 
+GAS LISTING /tmp/ccKdOQhn.s 			page 37
+
+
+ 521      F0D5FF
+ 522 1d7c DAF0D5FF 		.ascii	"\332\360\325\377\332\360\325\377\333\361\325\377\333\361\325"
+ 522      DAF0D5FF 
+ 522      DBF1D5FF 
+ 522      DBF1D5
+ 523 1d8b FFDBF1D5 		.ascii	"\377\333\361\325\377\333\361\325\377\333\361\326\377\333\361"
+ 523      FFDBF1D5 
+ 523      FFDBF1D6 
+ 523      FFDBF1
+ 524 1d9a D6FFDBF1 		.ascii	"\326\377\333\361\326\377\333\361\326\377\334\361\326\377\334"
+ 524      D6FFDBF1 
+ 524      D6FFDCF1 
+ 524      D6FFDC
+ 525 1da9 F1D6FFDC 		.ascii	"\361\326\377\334\361\326\377\334\361\326\377\334\361\327\377"
+ 525      F1D6FFDC 
+ 525      F1D6FFDC 
+ 525      F1D7FF
+ 526 1db8 DCF1D7FF 		.ascii	"\334\361\327\377\334\361\327\377\334\361\327\377\335\361\327"
+ 526      DCF1D7FF 
+ 526      DCF1D7FF 
+ 526      DDF1D7
+ 527 1dc7 FFDDF1D7 		.ascii	"\377\335\361\327\377\335\361\327\377\335\361\330\377\335\362"
+ 527      FFDDF1D7 
+ 527      FFDDF1D8 
+ 527      FFDDF2
+ 528 1dd6 D8FFDDF2 		.ascii	"\330\377\335\362\330\377\335\362\330\377\335\362\330\377\336"
+ 528      D8FFDDF2 
+ 528      D8FFDDF2 
+ 528      D8FFDE
+ 529 1de5 F2D8FFDE 		.ascii	"\362\330\377\336\362\330\377\336\362\331\377\336\362\331\377"
+ 529      F2D8FFDE 
+ 529      F2D9FFDE 
+ 529      F2D9FF
+ 530 1df4 DEF2D9FF 		.ascii	"\336\362\331\377\336\362\331\377\336\362\331\377\336\362\331"
+ 530      DEF2D9FF 
+ 530      DEF2D9FF 
+ 530      DEF2D9
+ 531 1e03 FFDFF2D9 		.ascii	"\377\337\362\331\377\337\362\332\377\337\362\332\377\337\362"
+ 531      FFDFF2DA 
+ 531      FFDFF2DA 
+ 531      FFDFF2
+ 532 1e12 DAFFDFF2 		.ascii	"\332\377\337\362\332\377\337\362\332\377\337\362\332\377\337"
+ 532      DAFFDFF2 
+ 532      DAFFDFF2 
+ 532      DAFFDF
+ 533 1e21 F2DAFFDF 		.ascii	"\362\332\377\337\363\332\377\340\363\333\377\340\363\333\377"
+ 533      F3DAFFE0 
+ 533      F3DBFFE0 
+ 533      F3DBFF
+ 534 1e30 E0F3DBFF 		.ascii	"\340\363\333\377\340\363\333\377\340\363\333\377\340\363\333"
+ 534      E0F3DBFF 
+ 534      E0F3DBFF 
+ 534      E0F3DB
+ 535 1e3f FFE1F3DB 		.ascii	"\377\341\363\333\377\341\363\333\377\341\363\334\377\341\363"
+ 535      FFE1F3DB 
+ 535      FFE1F3DC 
+ 535      FFE1F3
+GAS LISTING /tmp/ccKdOQhn.s 			page 38
+
+
+ 536 1e4e DCFFE1F3 		.ascii	"\334\377\341\363\334\377\341\363\334\377\342\363\334\377\342"
+ 536      DCFFE1F3 
+ 536      DCFFE2F3 
+ 536      DCFFE2
+ 537 1e5d F3DCFFE2 		.ascii	"\363\334\377\342\363\334\377\342\363\334\377\342\363\334\377"
+ 537      F3DCFFE2 
+ 537      F3DCFFE2 
+ 537      F3DCFF
+ 538 1e6c E2F3DDFF 		.ascii	"\342\363\335\377\343\364\335\377\343\364\335\377\343\364\335"
+ 538      E3F4DDFF 
+ 538      E3F4DDFF 
+ 538      E3F4DD
+ 539 1e7b FFE3F4DD 		.ascii	"\377\343\364\335\377\343\364\335\377\343\364\335\377\344\364"
+ 539      FFE3F4DD 
+ 539      FFE3F4DD 
+ 539      FFE4F4
+ 540 1e8a DDFFE4F4 		.ascii	"\335\377\344\364\336\377\344\364\336\377\344\364\336\377\344"
+ 540      DEFFE4F4 
+ 540      DEFFE4F4 
+ 540      DEFFE4
+ 541 1e99 F4DEFFE4 		.ascii	"\364\336\377\344\364\336\377\344\364\336\377\345\364\336\377"
+ 541      F4DEFFE4 
+ 541      F4DEFFE5 
+ 541      F4DEFF
+ 542 1ea8 E5F4DEFF 		.ascii	"\345\364\336\377\345\364\337\377\345\364\337\377\345\364\337"
+ 542      E5F4DFFF 
+ 542      E5F4DFFF 
+ 542      E5F4DF
+ 543 1eb7 FFE5F4DF 		.ascii	"\377\345\364\337\377\346\365\337\377\346\365\337\377\346\365"
+ 543      FFE6F5DF 
+ 543      FFE6F5DF 
+ 543      FFE6F5
+ 544 1ec6 DFFFE6F5 		.ascii	"\337\377\346\365\337\377\346\365\340\377\346\365\340\377\346"
+ 544      DFFFE6F5 
+ 544      E0FFE6F5 
+ 544      E0FFE6
+ 545 1ed5 F5E0FFE7 		.ascii	"\365\340\377\347\365\340\377\347\365\340\377\347\365\340\377"
+ 545      F5E0FFE7 
+ 545      F5E0FFE7 
+ 545      F5E0FF
+ 546 1ee4 E7F5E0FF 		.ascii	"\347\365\340\377\347\365\340\377\347\365\341\377\347\365\341"
+ 546      E7F5E0FF 
+ 546      E7F5E1FF 
+ 546      E7F5E1
+ 547 1ef3 FFE8F5E1 		.ascii	"\377\350\365\341\377\350\365\341\377\350\365\341\377\350\365"
+ 547      FFE8F5E1 
+ 547      FFE8F5E1 
+ 547      FFE8F5
+ 548 1f02 E1FFE8F6 		.ascii	"\341\377\350\366\341\377\350\366\341\377\351\366\342\377\351"
+ 548      E1FFE8F6 
+ 548      E1FFE9F6 
+ 548      E2FFE9
+ 549 1f11 F6E2FFE9 		.ascii	"\366\342\377\351\366\342\377\351\366\342\377\351\366\342\377"
+ 549      F6E2FFE9 
+ 549      F6E2FFE9 
+ 549      F6E2FF
+ 550 1f20 E9F6E2FF 		.ascii	"\351\366\342\377\356\370\347\377\356\370\347\377\356\370\347"
+GAS LISTING /tmp/ccKdOQhn.s 			page 39
+
+
+ 550      EEF8E7FF 
+ 550      EEF8E7FF 
+ 550      EEF8E7
+ 551 1f2f FFEEF8E7 		.ascii	"\377\356\370\347\377\357\370\347\377\357\370\347\377\357\370"
+ 551      FFEFF8E7 
+ 551      FFEFF8E7 
+ 551      FFEFF8
+ 552 1f3e E7FFEFF8 		.ascii	"\347\377\357\370\350\377\357\370\350\377\357\370\350\377\357"
+ 552      E8FFEFF8 
+ 552      E8FFEFF8 
+ 552      E8FFEF
+ 553 1f4d F8E8FFF0 		.ascii	"\370\350\377\360\370\350\377\360\370\350\377\360\371\350\377"
+ 553      F8E8FFF0 
+ 553      F8E8FFF0 
+ 553      F9E8FF
+ 554 1f5c F0F9E8FF 		.ascii	"\360\371\350\377\360\371\351\377\360\371\351\377\360\371\351"
+ 554      F0F9E9FF 
+ 554      F0F9E9FF 
+ 554      F0F9E9
+ 555 1f6b FFF1F9E9 		.ascii	"\377\361\371\351\377\361\371\351\377\361\371\351\377\361\371"
+ 555      FFF1F9E9 
+ 555      FFF1F9E9 
+ 555      FFF1F9
+ 556 1f7a E9FFF1F9 		.ascii	"\351\377\361\371\352\377\361\371\352\377\361\371\352\377\361"
+ 556      EAFFF1F9 
+ 556      EAFFF1F9 
+ 556      EAFFF1
+ 557 1f89 F9EAFFF2 		.ascii	"\371\352\377\362\371\352\377\362\371\352\377\362\371\352\377"
+ 557      F9EAFFF2 
+ 557      F9EAFFF2 
+ 557      F9EAFF
+ 558 1f98 F2F9EBFF 		.ascii	"\362\371\353\377\362\371\353\377\362\372\353\377\362\372\353"
+ 558      F2F9EBFF 
+ 558      F2FAEBFF 
+ 558      F2FAEB
+ 559 1fa7 FFF3FAEB 		.ascii	"\377\363\372\353\377\363\372\353\377\363\372\353\377\363\372"
+ 559      FFF3FAEB 
+ 559      FFF3FAEB 
+ 559      FFF3FA
+ 560 1fb6 EBFFF3FA 		.ascii	"\353\377\363\372\354\377\363\372\354\377"
+ 560      ECFFF3FA 
+ 560      ECFF
+ 561 1fc0 F3FAECFF 		.ascii	"\363\372\354\377\363\372\354\377\364\372\354\377\364\372\354"
+ 561      F3FAECFF 
+ 561      F4FAECFF 
+ 561      F4FAEC
+ 562 1fcf FFF4FAEC 		.ascii	"\377\364\372\354\377\364\372\355\377\364\372\355\377\364\372"
+ 562      FFF4FAED 
+ 562      FFF4FAED 
+ 562      FFF4FA
+ 563 1fde EDFFF4FA 		.ascii	"\355\377\364\372\355\377\365\373\355\377\365\373\355\377\365"
+ 563      EDFFF5FB 
+ 563      EDFFF5FB 
+ 563      EDFFF5
+ 564 1fed FBEDFFF5 		.ascii	"\373\355\377\365\373\356\377\365\373\356\377\365\373\356\377"
+ 564      FBEEFFF5 
+ 564      FBEEFFF5 
+GAS LISTING /tmp/ccKdOQhn.s 			page 40
+
+
+ 564      FBEEFF
+ 565 1ffc F5FBEEFF 		.ascii	"\365\373\356\377\365\373\356\377\366\373\356\377\366\373\356"
+ 565      F5FBEEFF 
+ 565      F6FBEEFF 
+ 565      F6FBEE
+ 566 200b FFF6FBEF 		.ascii	"\377\366\373\357\377\366\373\357\377\366\373\357\377\366\373"
+ 566      FFF6FBEF 
+ 566      FFF6FBEF 
+ 566      FFF6FB
+ 567 201a EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377"
+ 567      EFFFF6FB 
+ 567      EFFF
+ 568              		.globl	heatmap_cs_GnBu_soft
+ 569              		.section	.data.rel.local
+ 570              		.align 8
+ 571              		.type	heatmap_cs_GnBu_soft, @object
+ 572              		.size	heatmap_cs_GnBu_soft, 8
+ 573              	heatmap_cs_GnBu_soft:
+ 574 0010 00000000 		.quad	soft
+ 574      00000000 
+ 575              		.section	.data.rel.ro.local
+ 576              		.align 16
+ 577              		.type	soft, @object
+ 578              		.size	soft, 16
+ 579              	soft:
+ 580 0020 00000000 		.quad	soft_data
+ 580      00000000 
+ 581 0028 01040000 		.quad	1025
+ 581      00000000 
+ 582              		.section	.rodata
+ 583 2024 00000000 		.align 32
+ 583      00000000 
+ 583      00000000 
+ 583      00000000 
+ 583      00000000 
+ 584              		.type	soft_data, @object
+ 585              		.size	soft_data, 4100
+ 586              	soft_data:
+ 587 2040 00       		.string	""
+ 588 2041 00       		.string	""
+ 589 2042 00       		.string	""
+ 590 2043 00       		.string	""
+ 591 2044 083F8100 		.string	"\b?\201"
+ 592 2048 08408107 		.ascii	"\b@\201\007\b@\201\016\b@\202\026\bA\202\035\bA\202%\bA\203,"
+ 592      0840810E 
+ 592      08408216 
+ 592      0841821D 
+ 592      08418225 
+ 593 2060 08428334 		.ascii	"\bB\2034\bB\203;\bB\204C\bC\204J\bC\204R\bC\205Y\bC\205a\bD\205"
+ 593      0842833B 
+ 593      08428443 
+ 593      0843844A 
+ 593      08438452 
+ 594 207f 68084486 		.ascii	"h\bD\206p\bD\206w\bE\206\177\bE\207\206\bE\207\215\007F\207\225"
+ 594      70084486 
+ 594      77084586 
+ 594      7F084587 
+GAS LISTING /tmp/ccKdOQhn.s 			page 41
+
+
+ 594      86084587 
+ 595 2098 0746889C 		.ascii	"\007F\210\234\007F\210\244\007F\210\253\007G\211\263\007G\211"
+ 595      074688A4 
+ 595      074688AB 
+ 595      074789B3 
+ 595      074789
+ 596 20ab BA074789 		.ascii	"\272\007G\211\302\007H\212\311\007H\212\321\007H\212\330\007"
+ 596      C207488A 
+ 596      C907488A 
+ 596      D107488A 
+ 596      D807
+ 597 20bd 498BE007 		.ascii	"I\213\340\007I\213\347\007I\213\357\007J\214\366\007J\214\376"
+ 597      498BE707 
+ 597      498BEF07 
+ 597      4A8CF607 
+ 597      4A8CFE
+ 598 20d0 074A8CFF 		.ascii	"\007J\214\377\007J\215\377\007K\215\377\007K\215\377\007K\216"
+ 598      074A8DFF 
+ 598      074B8DFF 
+ 598      074B8DFF 
+ 598      074B8E
+ 599 20e3 FF074C8E 		.ascii	"\377\007L\216\377\007L\216\377\007L\217\377\007M\217\377\007"
+ 599      FF074C8E 
+ 599      FF074C8F 
+ 599      FF074D8F 
+ 599      FF07
+ 600 20f5 4D8FFF07 		.ascii	"M\217\377\007M\220\377\007N\220\377\007N\220\377\007N\221\377"
+ 600      4D90FF07 
+ 600      4E90FF07 
+ 600      4E90FF07 
+ 600      4E91FF
+ 601 2108 074E91FF 		.ascii	"\007N\221\377\007O\221\377\007O\222\377\007O\222\377\007P\222"
+ 601      074F91FF 
+ 601      074F92FF 
+ 601      074F92FF 
+ 601      075092
+ 602 211b FF075093 		.ascii	"\377\007P\223\377\007P\223\377\007Q\223\377\007Q\224\377\007"
+ 602      FF075093 
+ 602      FF075193 
+ 602      FF075194 
+ 602      FF07
+ 603 212d 5194FF07 		.ascii	"Q\224\377\007R\224\377\007R\225\377\007R\225\377\007S\225\377"
+ 603      5294FF07 
+ 603      5295FF07 
+ 603      5295FF07 
+ 603      5395FF
+ 604 2140 075396FF 		.ascii	"\007S\226\377\007S\226\377\007S\226\377\007T\227\377\007T\227"
+ 604      075396FF 
+ 604      075396FF 
+ 604      075497FF 
+ 604      075497
+ 605 2153 FF075497 		.ascii	"\377\007T\227\377\007U\230\377\007U\230\377\007U\230\377\007"
+ 605      FF075598 
+ 605      FF075598 
+ 605      FF075598 
+ 605      FF07
+ 606 2165 5699FF07 		.ascii	"V\231\377\007V\231\377\007V\231\377\007W\232\377\007W\232\377"
+GAS LISTING /tmp/ccKdOQhn.s 			page 42
+
+
+ 606      5699FF07 
+ 606      5699FF07 
+ 606      579AFF07 
+ 606      579AFF
+ 607 2178 07579AFF 		.ascii	"\007W\232\377\007X\233\377\007X\233\377\007X\233\377\007X\234"
+ 607      07589BFF 
+ 607      07589BFF 
+ 607      07589BFF 
+ 607      07589C
+ 608 218b FF07599C 		.ascii	"\377\007Y\234\377\007Y\234\377\007Y\235\377\007Z\235\377\007"
+ 608      FF07599C 
+ 608      FF07599D 
+ 608      FF075A9D 
+ 608      FF07
+ 609 219d 5A9DFF07 		.ascii	"Z\235\377\007Z\236\377\007[\236\377\007[\236\377\007[\237\377"
+ 609      5A9EFF07 
+ 609      5B9EFF07 
+ 609      5B9EFF07 
+ 609      5B9FFF
+ 610 21b0 075C9FFF 		.ascii	"\007\\\237\377\007\\\237\377\007\\\240\377\007]\240\377\007]"
+ 610      075C9FFF 
+ 610      075CA0FF 
+ 610      075DA0FF 
+ 610      075D
+ 611 21c2 A1FF075D 		.ascii	"\241\377\007]\241\377\007^\241\377\007^\242\377\007^\242\377"
+ 611      A1FF075E 
+ 611      A1FF075E 
+ 611      A2FF075E 
+ 611      A2FF
+ 612 21d4 075FA2FF 		.ascii	"\007_\242\377\007_\243\377\007_\243\377\007_\243\377\007`\244"
+ 612      075FA3FF 
+ 612      075FA3FF 
+ 612      075FA3FF 
+ 612      0760A4
+ 613 21e7 FF0760A4 		.ascii	"\377\007`\244\377\007`\244\377\007a\245\377\007a\245\377\007"
+ 613      FF0760A4 
+ 613      FF0761A5 
+ 613      FF0761A5 
+ 613      FF07
+ 614 21f9 61A5FF07 		.ascii	"a\245\377\007b\246\377\007b\246\377\007b\246\377\007c\247\377"
+ 614      62A6FF07 
+ 614      62A6FF07 
+ 614      62A6FF07 
+ 614      63A7FF
+ 615 220c 0763A7FF 		.ascii	"\007c\247\377\007c\247\377\007d\250\377\007d\250\377\007d\250"
+ 615      0763A7FF 
+ 615      0764A8FF 
+ 615      0764A8FF 
+ 615      0764A8
+ 616 221f FF0765A9 		.ascii	"\377\007e\251\377\007e\251\377\007e\251\377\007f\252\377\007"
+ 616      FF0765A9 
+ 616      FF0765A9 
+ 616      FF0766AA 
+ 616      FF07
+ 617 2231 66AAFF07 		.ascii	"f\252\377\007f\252\377\007g\253\377\007g\253\377\007g\253\377"
+ 617      66AAFF07 
+ 617      67ABFF07 
+GAS LISTING /tmp/ccKdOQhn.s 			page 43
+
+
+ 617      67ABFF07 
+ 617      67ABFF
+ 618 2244 0867ACFF 		.ascii	"\bg\254\377\007h\254\377\007h\254\377\007h\254\377\007i\254\377"
+ 618      0768ACFF 
+ 618      0768ACFF 
+ 618      0768ACFF 
+ 618      0769ACFF 
+ 619 2258 0769ACFF 		.ascii	"\007i\254\377\007i\254\377\bj\255\377\bj\255\377\bj\255\377\b"
+ 619      0769ACFF 
+ 619      086AADFF 
+ 619      086AADFF 
+ 619      086AADFF 
+ 620 226d 6AADFF08 		.ascii	"j\255\377\bk\255\377\bk\255\377\bk\256\377\bl\256\377\bl\256"
+ 620      6BADFF08 
+ 620      6BADFF08 
+ 620      6BAEFF08 
+ 620      6CAEFF08 
+ 621 2283 FF086CAE 		.ascii	"\377\bl\256\377\bl\256\377\bm\256\377\bm\257\377\tm\257\377\t"
+ 621      FF086CAE 
+ 621      FF086DAE 
+ 621      FF086DAF 
+ 621      FF096DAF 
+ 622 2299 6EAFFF09 		.ascii	"n\257\377\tn\257\377\tn\257\377\tn\257\377\to\260\377\to\260"
+ 622      6EAFFF09 
+ 622      6EAFFF09 
+ 622      6EAFFF09 
+ 622      6FB0FF09 
+ 623 22af FF0A6FB0 		.ascii	"\377\no\260\377\no\260\377\np\260\377\np\260\377\np\260\377\013"
+ 623      FF0A6FB0 
+ 623      FF0A70B0 
+ 623      FF0A70B0 
+ 623      FF0A70B0 
+ 624 22c5 71B1FF0B 		.ascii	"q\261\377\013q\261\377\013q\261\377\013q\261\377\fr\261\377\f"
+ 624      71B1FF0B 
+ 624      71B1FF0B 
+ 624      71B1FF0C 
+ 624      72B1FF0C 
+ 625 22d9 72B1FF0C 		.ascii	"r\261\377\fr\262\377\fs\262\377\fs\262\377\rs\262\377\rs\262"
+ 625      72B2FF0C 
+ 625      73B2FF0C 
+ 625      73B2FF0D 
+ 625      73B2FF0D 
+ 626 22ef FF0D74B2 		.ascii	"\377\rt\262\377\016t\262\377\016t\263\377\016u\263\377\016u\263"
+ 626      FF0E74B2 
+ 626      FF0E74B3 
+ 626      FF0E75B3 
+ 626      FF0E75B3 
+ 627 2303 FF0F75B3 		.ascii	"\377\017u\263\377\017u\263\377\017v\263\377\020v\263\377\020"
+ 627      FF0F75B3 
+ 627      FF0F76B3 
+ 627      FF1076B3 
+ 627      FF10
+ 628 2315 76B4FF10 		.ascii	"v\264\377\020w\264\377\020w\264\377\021w\264\377\021w\264\377"
+ 628      77B4FF10 
+ 628      77B4FF11 
+ 628      77B4FF11 
+ 628      77B4FF
+GAS LISTING /tmp/ccKdOQhn.s 			page 44
+
+
+ 629 2328 1178B4FF 		.ascii	"\021x\264\377\022x\264\377\022x\265\377\022y\265\377\023y\265"
+ 629      1278B4FF 
+ 629      1278B5FF 
+ 629      1279B5FF 
+ 629      1379B5
+ 630 233b FF1379B5 		.ascii	"\377\023y\265\377\023y\265\377\024z\265\377\024z\265\377\024"
+ 630      FF1379B5 
+ 630      FF147AB5 
+ 630      FF147AB5 
+ 630      FF14
+ 631 234d 7AB6FF15 		.ascii	"z\266\377\025{\266\377\025{\266\377\025{\266\377\026{\266\377"
+ 631      7BB6FF15 
+ 631      7BB6FF15 
+ 631      7BB6FF16 
+ 631      7BB6FF
+ 632 2360 167CB6FF 		.ascii	"\026|\266\377\026|\266\377\027|\267\377\027|\267\377\027}\267"
+ 632      167CB6FF 
+ 632      177CB7FF 
+ 632      177CB7FF 
+ 632      177DB7
+ 633 2373 FF187DB7 		.ascii	"\377\030}\267\377\030}\267\377\030~\267\377\031~\267\377\031"
+ 633      FF187DB7 
+ 633      FF187EB7 
+ 633      FF197EB7 
+ 633      FF19
+ 634 2385 7EB7FF19 		.ascii	"~\267\377\031~\270\377\032\177\270\377\032\177\270\377\032\177"
+ 634      7EB8FF1A 
+ 634      7FB8FF1A 
+ 634      7FB8FF1A 
+ 634      7F
+ 635 2396 B8FF1B80 		.ascii	"\270\377\033\200\270\377\033\200\270\377\033\200\270\377\034"
+ 635      B8FF1B80 
+ 635      B8FF1B80 
+ 635      B8FF1C
+ 636 23a5 80B9FF1C 		.ascii	"\200\271\377\034\201\271\377\034\201\271\377\035\201\271\377"
+ 636      81B9FF1C 
+ 636      81B9FF1D 
+ 636      81B9FF
+ 637 23b4 1D82B9FF 		.ascii	"\035\202\271\377\036\202\271\377\036\202\271\377\036\202\271"
+ 637      1E82B9FF 
+ 637      1E82B9FF 
+ 637      1E82B9
+ 638 23c3 FF1F83BA 		.ascii	"\377\037\203\272\377\037\203\272\377\037\203\272\377 \203\272"
+ 638      FF1F83BA 
+ 638      FF1F83BA 
+ 638      FF2083BA 
+ 639 23d3 FF2084BA 		.ascii	"\377 \204\272\377 \204\272\377!\204\272\377!\205\272\377\"\205"
+ 639      FF2084BA 
+ 639      FF2184BA 
+ 639      FF2185BA 
+ 639      FF2285
+ 640 23e6 BBFF2285 		.ascii	"\273\377\"\205\273\377\"\205\273\377#\206\273\377#\206\273\377"
+ 640      BBFF2285 
+ 640      BBFF2386 
+ 640      BBFF2386 
+ 640      BBFF
+ 641 23f8 2386BBFF 		.ascii	"#\206\273\377$\207\273\377$\207\273\377%\207\274\377%\207\274"
+GAS LISTING /tmp/ccKdOQhn.s 			page 45
+
+
+ 641      2487BBFF 
+ 641      2487BBFF 
+ 641      2587BCFF 
+ 641      2587BC
+ 642 240b FF2588BC 		.ascii	"\377%\210\274\377&\210\274\377&\210\274\377&\210\274\377'\211"
+ 642      FF2688BC 
+ 642      FF2688BC 
+ 642      FF2688BC 
+ 642      FF2789
+ 643 241e BCFF2789 		.ascii	"\274\377'\211\274\377'\211\275\377(\212\275\377(\212\275\377"
+ 643      BCFF2789 
+ 643      BDFF288A 
+ 643      BDFF288A 
+ 643      BDFF
+ 644 2430 298ABDFF 		.ascii	")\212\275\377)\212\275\377)\213\275\377*\213\275\377*\213\275"
+ 644      298ABDFF 
+ 644      298BBDFF 
+ 644      2A8BBDFF 
+ 644      2A8BBD
+ 645 2443 FF2B8CBE 		.ascii	"\377+\214\276\377+\214\276\377+\214\276\377+\214\276\377+\215"
+ 645      FF2B8CBE 
+ 645      FF2B8CBE 
+ 645      FF2B8CBE 
+ 645      FF2B8D
+ 646 2456 BEFF2B8D 		.ascii	"\276\377+\215\276\377,\215\277\377,\216\277\377,\216\277\377"
+ 646      BEFF2C8D 
+ 646      BFFF2C8E 
+ 646      BFFF2C8E 
+ 646      BFFF
+ 647 2468 2C8EBFFF 		.ascii	",\216\277\377,\217\277\377-\217\300\377-\217\300\377-\217\300"
+ 647      2C8FBFFF 
+ 647      2D8FC0FF 
+ 647      2D8FC0FF 
+ 647      2D8FC0
+ 648 247b FF2D90C0 		.ascii	"\377-\220\300\377-\220\300\377.\220\300\377.\221\301\377.\221"
+ 648      FF2D90C0 
+ 648      FF2E90C0 
+ 648      FF2E91C1 
+ 648      FF2E91
+ 649 248e C1FF2E91 		.ascii	"\301\377.\221\301\377.\222\301\377/\222\301\377/\222\301\377"
+ 649      C1FF2E92 
+ 649      C1FF2F92 
+ 649      C1FF2F92 
+ 649      C1FF
+ 650 24a0 2F93C2FF 		.ascii	"/\223\302\377/\223\302\377/\223\302\3770\223\302\3770\224\302"
+ 650      2F93C2FF 
+ 650      2F93C2FF 
+ 650      3093C2FF 
+ 650      3094C2
+ 651 24b3 FF3094C3 		.ascii	"\3770\224\303\3770\224\303\3771\225\303\3771\225\303\3771\225"
+ 651      FF3094C3 
+ 651      FF3195C3 
+ 651      FF3195C3 
+ 651      FF3195
+ 652 24c6 C3FF3196 		.ascii	"\303\3771\226\303\3771\226\304\3772\226\304\3772\227\304\377"
+ 652      C3FF3196 
+ 652      C4FF3296 
+GAS LISTING /tmp/ccKdOQhn.s 			page 46
+
+
+ 652      C4FF3297 
+ 652      C4FF
+ 653 24d8 3297C4FF 		.ascii	"2\227\304\3772\227\304\3773\227\304\3773\230\305\3773\230\305"
+ 653      3297C4FF 
+ 653      3397C4FF 
+ 653      3398C5FF 
+ 653      3398C5
+ 654 24eb FF3398C5 		.ascii	"\3773\230\305\3774\231\305\3774\231\305\3774\231\305\3774\232"
+ 654      FF3499C5 
+ 654      FF3499C5 
+ 654      FF3499C5 
+ 654      FF349A
+ 655 24fe C6FF359A 		.ascii	"\306\3775\232\306\3775\232\306\3775\232\306\3775\233\306\377"
+ 655      C6FF359A 
+ 655      C6FF359A 
+ 655      C6FF359B 
+ 655      C6FF
+ 656 2510 369BC6FF 		.ascii	"6\233\306\3776\233\307\3776\234\307\3777\234\307\3777\234\307"
+ 656      369BC7FF 
+ 656      369CC7FF 
+ 656      379CC7FF 
+ 656      379CC7
+ 657 2523 FF379DC7 		.ascii	"\3777\235\307\3777\235\307\3778\235\310\3778\236\310\3778\236"
+ 657      FF379DC7 
+ 657      FF389DC8 
+ 657      FF389EC8 
+ 657      FF389E
+ 658 2536 C8FF389E 		.ascii	"\310\3778\236\310\3779\236\310\3779\237\310\3779\237\311\377"
+ 658      C8FF399E 
+ 658      C8FF399F 
+ 658      C8FF399F 
+ 658      C9FF
+ 659 2548 3A9FC9FF 		.ascii	":\237\311\377:\240\311\377:\240\311\377:\240\311\377;\241\311"
+ 659      3AA0C9FF 
+ 659      3AA0C9FF 
+ 659      3AA0C9FF 
+ 659      3BA1C9
+ 660 255b FF3BA1CA 		.ascii	"\377;\241\312\377;\241\312\377<\242\312\377<\242\312\377<\242"
+ 660      FF3BA1CA 
+ 660      FF3CA2CA 
+ 660      FF3CA2CA 
+ 660      FF3CA2
+ 661 256e CAFF3CA2 		.ascii	"\312\377<\242\312\377=\243\313\377=\243\313\377=\243\313\377"
+ 661      CAFF3DA3 
+ 661      CBFF3DA3 
+ 661      CBFF3DA3 
+ 661      CBFF
+ 662 2580 3EA4CBFF 		.ascii	">\244\313\377>\244\313\377>\244\313\377?\245\313\377?\245\314"
+ 662      3EA4CBFF 
+ 662      3EA4CBFF 
+ 662      3FA5CBFF 
+ 662      3FA5CC
+ 663 2593 FF3FA5CC 		.ascii	"\377?\245\314\377?\245\314\377@\246\314\377@\246\314\377@\246"
+ 663      FF3FA5CC 
+ 663      FF40A6CC 
+ 663      FF40A6CC 
+ 663      FF40A6
+GAS LISTING /tmp/ccKdOQhn.s 			page 47
+
+
+ 664 25a6 CCFF41A7 		.ascii	"\314\377A\247\315\377A\247\315\377A\247\315\377B\250\315\377"
+ 664      CDFF41A7 
+ 664      CDFF41A7 
+ 664      CDFF42A8 
+ 664      CDFF
+ 665 25b8 42A8CDFF 		.ascii	"B\250\315\377B\250\315\377C\251\316\377C\251\316\377C\251\316"
+ 665      42A8CDFF 
+ 665      43A9CEFF 
+ 665      43A9CEFF 
+ 665      43A9CE
+ 666 25cb FF44A9CE 		.ascii	"\377D\251\316\377D\252\316\377D\252\316\377D\252\316\377E\253"
+ 666      FF44AACE 
+ 666      FF44AACE 
+ 666      FF44AACE 
+ 666      FF45AB
+ 667 25de CFFF45AB 		.ascii	"\317\377E\253\317\377E\253\317\377F\254\317\377F\254\317\377"
+ 667      CFFF45AB 
+ 667      CFFF46AC 
+ 667      CFFF46AC 
+ 667      CFFF
+ 668 25f0 46ACCFFF 		.ascii	"F\254\317\377G\254\320\377G\255\320\377G\255\320\377H\255\320"
+ 668      47ACD0FF 
+ 668      47ADD0FF 
+ 668      47ADD0FF 
+ 668      48ADD0
+ 669 2603 FF48AED0 		.ascii	"\377H\256\320\377H\256\320\377I\256\320\377I\257\321\377I\257"
+ 669      FF48AED0 
+ 669      FF49AED0 
+ 669      FF49AFD1 
+ 669      FF49AF
+ 670 2616 D1FF4AAF 		.ascii	"\321\377J\257\321\377J\257\321\377J\260\321\377K\260\321\377"
+ 670      D1FF4AAF 
+ 670      D1FF4AB0 
+ 670      D1FF4BB0 
+ 670      D1FF
+ 671 2628 4BB0D1FF 		.ascii	"K\260\321\377K\261\322\377L\261\322\377L\261\322\377L\262\322"
+ 671      4BB1D2FF 
+ 671      4CB1D2FF 
+ 671      4CB1D2FF 
+ 671      4CB2D2
+ 672 263b FF4DB2D2 		.ascii	"\377M\262\322\377M\262\322\377N\263\323\377N\263\322\377N\263"
+ 672      FF4DB2D2 
+ 672      FF4EB3D3 
+ 672      FF4EB3D2 
+ 672      FF4EB3
+ 673 264e D2FF4EB3 		.ascii	"\322\377N\263\322\377N\263\322\377N\264\322\377N\264\322\377"
+ 673      D2FF4EB3 
+ 673      D2FF4EB4 
+ 673      D2FF4EB4 
+ 673      D2FF
+ 674 2660 4EB4D2FF 		.ascii	"N\264\322\377O\264\322\377O\265\322\377O\265\322\377O\265\322"
+ 674      4FB4D2FF 
+ 674      4FB5D2FF 
+ 674      4FB5D2FF 
+ 674      4FB5D2
+ 675 2673 FF4FB5D1 		.ascii	"\377O\265\321\377O\265\321\377P\266\321\377P\266\321\377P\266"
+ 675      FF4FB5D1 
+GAS LISTING /tmp/ccKdOQhn.s 			page 48
+
+
+ 675      FF50B6D1 
+ 675      FF50B6D1 
+ 675      FF50B6
+ 676 2686 D1FF50B6 		.ascii	"\321\377P\266\321\377P\266\321\377P\267\321\377Q\267\321\377"
+ 676      D1FF50B6 
+ 676      D1FF50B7 
+ 676      D1FF51B7 
+ 676      D1FF
+ 677 2698 51B7D1FF 		.ascii	"Q\267\321\377Q\267\320\377Q\270\320\377R\270\320\377R\270\320"
+ 677      51B7D0FF 
+ 677      51B8D0FF 
+ 677      52B8D0FF 
+ 677      52B8D0
+ 678 26ab FF52B8D0 		.ascii	"\377R\270\320\377R\270\320\377S\271\320\377S\271\320\377S\271"
+ 678      FF52B8D0 
+ 678      FF53B9D0 
+ 678      FF53B9D0 
+ 678      FF53B9
+ 679 26be D0FF53B9 		.ascii	"\320\377S\271\320\377T\271\317\377T\272\317\377T\272\317\377"
+ 679      D0FF54B9 
+ 679      CFFF54BA 
+ 679      CFFF54BA 
+ 679      CFFF
+ 680 26d0 54BACFFF 		.ascii	"T\272\317\377U\272\317\377U\273\317\377U\273\317\377V\273\317"
+ 680      55BACFFF 
+ 680      55BBCFFF 
+ 680      55BBCFFF 
+ 680      56BBCF
+ 681 26e3 FF56BBCE 		.ascii	"\377V\273\316\377V\273\316\377V\274\316\377W\274\316\377W\274"
+ 681      FF56BBCE 
+ 681      FF56BCCE 
+ 681      FF57BCCE 
+ 681      FF57BC
+ 682 26f6 CEFF57BC 		.ascii	"\316\377W\274\316\377X\274\316\377X\275\316\377X\275\316\377"
+ 682      CEFF58BC 
+ 682      CEFF58BD 
+ 682      CEFF58BD 
+ 682      CEFF
+ 683 2708 59BDCDFF 		.ascii	"Y\275\315\377Y\275\315\377Y\275\315\377Z\276\315\377Z\276\315"
+ 683      59BDCDFF 
+ 683      59BDCDFF 
+ 683      5ABECDFF 
+ 683      5ABECD
+ 684 271b FF5ABECD 		.ascii	"\377Z\276\315\377[\276\315\377[\276\315\377\\\277\314\377\\\277"
+ 684      FF5BBECD 
+ 684      FF5BBECD 
+ 684      FF5CBFCC 
+ 684      FF5CBF
+ 685 272e CCFF5CBF 		.ascii	"\314\377\\\277\314\377]\277\314\377]\277\314\377]\300\314\377"
+ 685      CCFF5DBF 
+ 685      CCFF5DBF 
+ 685      CCFF5DC0 
+ 685      CCFF
+ 686 2740 5EC0CCFF 		.ascii	"^\300\314\377^\300\314\377_\300\313\377_\300\313\377_\301\313"
+ 686      5EC0CCFF 
+ 686      5FC0CBFF 
+ 686      5FC0CBFF 
+GAS LISTING /tmp/ccKdOQhn.s 			page 49
+
+
+ 686      5FC1CB
+ 687 2753 FF60C1CB 		.ascii	"\377`\301\313\377`\301\313\377`\301\313\377a\301\313\377a\301"
+ 687      FF60C1CB 
+ 687      FF60C1CB 
+ 687      FF61C1CB 
+ 687      FF61C1
+ 688 2766 CBFF62C2 		.ascii	"\313\377b\302\312\377b\302\312\377b\302\312\377c\302\312\377"
+ 688      CAFF62C2 
+ 688      CAFF62C2 
+ 688      CAFF63C2 
+ 688      CAFF
+ 689 2778 63C2CAFF 		.ascii	"c\302\312\377d\303\312\377d\303\312\377e\303\312\377e\303\311"
+ 689      64C3CAFF 
+ 689      64C3CAFF 
+ 689      65C3CAFF 
+ 689      65C3C9
+ 690 278b FF65C3C9 		.ascii	"\377e\303\311\377f\304\311\377f\304\311\377g\304\311\377g\304"
+ 690      FF66C4C9 
+ 690      FF66C4C9 
+ 690      FF67C4C9 
+ 690      FF67C4
+ 691 279e C9FF68C4 		.ascii	"\311\377h\304\311\377h\304\310\377h\305\310\377i\305\310\377"
+ 691      C9FF68C4 
+ 691      C8FF68C5 
+ 691      C8FF69C5 
+ 691      C8FF
+ 692 27b0 69C5C8FF 		.ascii	"i\305\310\377j\305\310\377j\305\310\377k\306\310\377k\306\310"
+ 692      6AC5C8FF 
+ 692      6AC5C8FF 
+ 692      6BC6C8FF 
+ 692      6BC6C8
+ 693 27c3 FF6CC6C7 		.ascii	"\377l\306\307\377l\306\307\377l\306\307\377m\306\307\377m\307"
+ 693      FF6CC6C7 
+ 693      FF6CC6C7 
+ 693      FF6DC6C7 
+ 693      FF6DC7
+ 694 27d6 C7FF6EC7 		.ascii	"\307\377n\307\307\377n\307\307\377o\307\307\377o\307\306\377"
+ 694      C7FF6EC7 
+ 694      C7FF6FC7 
+ 694      C7FF6FC7 
+ 694      C6FF
+ 695 27e8 70C8C6FF 		.ascii	"p\310\306\377p\310\306\377q\310\306\377q\310\306\377q\310\306"
+ 695      70C8C6FF 
+ 695      71C8C6FF 
+ 695      71C8C6FF 
+ 695      71C8C6
+ 696 27fb FF72C8C6 		.ascii	"\377r\310\306\377r\311\306\377s\311\305\377s\311\305\377t\311"
+ 696      FF72C9C6 
+ 696      FF73C9C5 
+ 696      FF73C9C5 
+ 696      FF74C9
+ 697 280e C5FF     		.ascii	"\305\377"
+ 698 2810 74C9C5FF 		.ascii	"t\311\305\377u\311\305\377u\312\305\377v\312\305\377v\312\305"
+ 698      75C9C5FF 
+ 698      75CAC5FF 
+ 698      76CAC5FF 
+ 698      76CAC5
+GAS LISTING /tmp/ccKdOQhn.s 			page 50
+
+
+ 699 2823 FF77CAC4 		.ascii	"\377w\312\304\377w\312\304\377x\312\304\377x\313\304\377y\313"
+ 699      FF77CAC4 
+ 699      FF78CAC4 
+ 699      FF78CBC4 
+ 699      FF79CB
+ 700 2836 C4FF79CB 		.ascii	"\304\377y\313\304\377z\313\304\377z\313\304\377{\314\303\377"
+ 700      C4FF7ACB 
+ 700      C4FF7ACB 
+ 700      C4FF7BCC 
+ 700      C3FF
+ 701 2848 7BCCC3FF 		.ascii	"{\314\303\377{\314\303\377{\314\303\377|\314\303\377|\314\303"
+ 701      7BCCC3FF 
+ 701      7BCCC3FF 
+ 701      7CCCC3FF 
+ 701      7CCCC3
+ 702 285b FF7CCCC3 		.ascii	"\377|\314\303\377|\315\303\377}\315\303\377}\315\303\377}\315"
+ 702      FF7CCDC3 
+ 702      FF7DCDC3 
+ 702      FF7DCDC3 
+ 702      FF7DCD
+ 703 286e C2FF7DCD 		.ascii	"\302\377}\315\302\377~\315\302\377~\315\302\377~\316\302\377"
+ 703      C2FF7ECD 
+ 703      C2FF7ECD 
+ 703      C2FF7ECE 
+ 703      C2FF
+ 704 2880 7FCEC2FF 		.ascii	"\177\316\302\377\177\316\302\377\177\316\302\377\177\316\302"
+ 704      7FCEC2FF 
+ 704      7FCEC2FF 
+ 704      7FCEC2
+ 705 288f FF80CEC1 		.ascii	"\377\200\316\301\377\200\317\301\377\200\317\301\377\201\317"
+ 705      FF80CFC1 
+ 705      FF80CFC1 
+ 705      FF81CF
+ 706 289e C1FF81CF 		.ascii	"\301\377\201\317\301\377\201\317\301\377\202\317\301\377\202"
+ 706      C1FF81CF 
+ 706      C1FF82CF 
+ 706      C1FF82
+ 707 28ad CFC1FF82 		.ascii	"\317\301\377\202\320\301\377\202\320\300\377\203\320\300\377"
+ 707      D0C1FF82 
+ 707      D0C0FF83 
+ 707      D0C0FF
+ 708 28bc 83D0C0FF 		.ascii	"\203\320\300\377\203\320\300\377\204\320\300\377\204\320\300"
+ 708      83D0C0FF 
+ 708      84D0C0FF 
+ 708      84D0C0
+ 709 28cb FF84D1C0 		.ascii	"\377\204\321\300\377\205\321\300\377\205\321\277\377\205\321"
+ 709      FF85D1C0 
+ 709      FF85D1BF 
+ 709      FF85D1
+ 710 28da BFFF86D1 		.ascii	"\277\377\206\321\277\377\206\321\277\377\206\321\277\377\207"
+ 710      BFFF86D1 
+ 710      BFFF86D1 
+ 710      BFFF87
+ 711 28e9 D2BFFF87 		.ascii	"\322\277\377\207\322\277\377\207\322\277\377\210\322\277\377"
+ 711      D2BFFF87 
+ 711      D2BFFF88 
+ 711      D2BFFF
+GAS LISTING /tmp/ccKdOQhn.s 			page 51
+
+
+ 712 28f8 88D2BEFF 		.ascii	"\210\322\276\377\210\322\276\377\211\322\276\377\211\323\276"
+ 712      88D2BEFF 
+ 712      89D2BEFF 
+ 712      89D3BE
+ 713 2907 FF89D3BE 		.ascii	"\377\211\323\276\377\212\323\276\377\212\323\276\377\212\323"
+ 713      FF8AD3BE 
+ 713      FF8AD3BE 
+ 713      FF8AD3
+ 714 2916 BEFF8BD3 		.ascii	"\276\377\213\323\275\377\213\323\275\377\213\323\275\377\214"
+ 714      BDFF8BD3 
+ 714      BDFF8BD3 
+ 714      BDFF8C
+ 715 2925 D4BDFF8C 		.ascii	"\324\275\377\214\324\275\377\214\324\275\377\215\324\275\377"
+ 715      D4BDFF8C 
+ 715      D4BDFF8D 
+ 715      D4BDFF
+ 716 2934 8DD4BDFF 		.ascii	"\215\324\275\377\215\324\274\377\216\324\274\377\216\325\274"
+ 716      8DD4BCFF 
+ 716      8ED4BCFF 
+ 716      8ED5BC
+ 717 2943 FF8ED5BC 		.ascii	"\377\216\325\274\377\217\325\274\377\217\325\274\377\220\325"
+ 717      FF8FD5BC 
+ 717      FF8FD5BC 
+ 717      FF90D5
+ 718 2952 BCFF90D5 		.ascii	"\274\377\220\325\274\377\220\325\273\377\221\325\273\377\221"
+ 718      BCFF90D5 
+ 718      BBFF91D5 
+ 718      BBFF91
+ 719 2961 D6BBFF91 		.ascii	"\326\273\377\221\326\273\377\222\326\273\377\222\326\273\377"
+ 719      D6BBFF92 
+ 719      D6BBFF92 
+ 719      D6BBFF
+ 720 2970 92D6BBFF 		.ascii	"\222\326\273\377\223\326\273\377\223\326\272\377\224\327\272"
+ 720      93D6BBFF 
+ 720      93D6BAFF 
+ 720      94D7BA
+ 721 297f FF94D7BA 		.ascii	"\377\224\327\272\377\224\327\272\377\225\327\272\377\225\327"
+ 721      FF94D7BA 
+ 721      FF95D7BA 
+ 721      FF95D7
+ 722 298e BAFF95D7 		.ascii	"\272\377\225\327\272\377\226\327\272\377\226\327\272\377\227"
+ 722      BAFF96D7 
+ 722      BAFF96D7 
+ 722      BAFF97
+ 723 299d D8B9FF97 		.ascii	"\330\271\377\227\330\271\377\227\330\271\377\230\330\271\377"
+ 723      D8B9FF97 
+ 723      D8B9FF98 
+ 723      D8B9FF
+ 724 29ac 98D8B9FF 		.ascii	"\230\330\271\377\231\330\271\377\231\330\271\377\231\330\271"
+ 724      99D8B9FF 
+ 724      99D8B9FF 
+ 724      99D8B9
+ 725 29bb FF9AD9B8 		.ascii	"\377\232\331\270\377\232\331\270\377\232\331\270\377\233\331"
+ 725      FF9AD9B8 
+ 725      FF9AD9B8 
+ 725      FF9BD9
+ 726 29ca B8FF9BD9 		.ascii	"\270\377\233\331\270\377\234\331\270\377\234\331\270\377\234"
+GAS LISTING /tmp/ccKdOQhn.s 			page 52
+
+
+ 726      B8FF9CD9 
+ 726      B8FF9CD9 
+ 726      B8FF9C
+ 727 29d9 D9B8FF9D 		.ascii	"\331\270\377\235\331\267\377\235\332\267\377\236\332\267\377"
+ 727      D9B7FF9D 
+ 727      DAB7FF9E 
+ 727      DAB7FF
+ 728 29e8 9EDAB7FF 		.ascii	"\236\332\267\377\236\332\267\377\237\332\267\377\237\332\267"
+ 728      9EDAB7FF 
+ 728      9FDAB7FF 
+ 728      9FDAB7
+ 729 29f7 FFA0DAB7 		.ascii	"\377\240\332\267\377\240\332\267\377\240\333\266\377\241\333"
+ 729      FFA0DAB7 
+ 729      FFA0DBB6 
+ 729      FFA1DB
+ 730 2a06 B6FFA1DB 		.ascii	"\266\377\241\333\266\377\242\333\266\377\242\333\266\377\243"
+ 730      B6FFA2DB 
+ 730      B6FFA2DB 
+ 730      B6FFA3
+ 731 2a15 DBB6FFA3 		.ascii	"\333\266\377\243\333\266\377\243\333\266\377\244\333\266\377"
+ 731      DBB6FFA3 
+ 731      DBB6FFA4 
+ 731      DBB6FF
+ 732 2a24 A4DCB5FF 		.ascii	"\244\334\265\377\245\334\265\377\245\334\265\377\245\334\265"
+ 732      A5DCB5FF 
+ 732      A5DCB5FF 
+ 732      A5DCB5
+ 733 2a33 FFA6DCB5 		.ascii	"\377\246\334\265\377\246\334\265\377\247\334\265\377\247\334"
+ 733      FFA6DCB5 
+ 733      FFA7DCB5 
+ 733      FFA7DC
+ 734 2a42 B5FFA7DD 		.ascii	"\265\377\247\335\264\377\250\335\265\377\250\335\265\377\250"
+ 734      B4FFA8DD 
+ 734      B5FFA8DD 
+ 734      B5FFA8
+ 735 2a51 DDB5FFA9 		.ascii	"\335\265\377\251\335\265\377\251\335\265\377\251\335\265\377"
+ 735      DDB5FFA9 
+ 735      DDB5FFA9 
+ 735      DDB5FF
+ 736 2a60 AADDB5FF 		.ascii	"\252\335\265\377\252\335\265\377\252\335\265\377\252\336\266"
+ 736      AADDB5FF 
+ 736      AADDB5FF 
+ 736      AADEB6
+ 737 2a6f FFABDEB6 		.ascii	"\377\253\336\266\377\253\336\266\377\253\336\266\377\254\336"
+ 737      FFABDEB6 
+ 737      FFABDEB6 
+ 737      FFACDE
+ 738 2a7e B6FFACDE 		.ascii	"\266\377\254\336\266\377\254\336\266\377\255\336\266\377\255"
+ 738      B6FFACDE 
+ 738      B6FFADDE 
+ 738      B6FFAD
+ 739 2a8d DEB6FFAD 		.ascii	"\336\266\377\255\337\267\377\255\337\267\377\256\337\267\377"
+ 739      DFB7FFAD 
+ 739      DFB7FFAE 
+ 739      DFB7FF
+ 740 2a9c AEDFB7FF 		.ascii	"\256\337\267\377\256\337\267\377\257\337\267\377\257\337\267"
+ 740      AEDFB7FF 
+GAS LISTING /tmp/ccKdOQhn.s 			page 53
+
+
+ 740      AFDFB7FF 
+ 740      AFDFB7
+ 741 2aab FFAFDFB7 		.ascii	"\377\257\337\267\377\257\337\267\377\260\340\270\377\260\340"
+ 741      FFAFDFB7 
+ 741      FFB0E0B8 
+ 741      FFB0E0
+ 742 2aba B8FFB0E0 		.ascii	"\270\377\260\340\270\377\261\340\270\377\261\340\270\377\261"
+ 742      B8FFB1E0 
+ 742      B8FFB1E0 
+ 742      B8FFB1
+ 743 2ac9 E0B8FFB2 		.ascii	"\340\270\377\262\340\270\377\262\340\270\377\262\340\270\377"
+ 743      E0B8FFB2 
+ 743      E0B8FFB2 
+ 743      E0B8FF
+ 744 2ad8 B2E1B9FF 		.ascii	"\262\341\271\377\263\341\271\377\263\341\271\377\263\341\271"
+ 744      B3E1B9FF 
+ 744      B3E1B9FF 
+ 744      B3E1B9
+ 745 2ae7 FFB4E1B9 		.ascii	"\377\264\341\271\377\264\341\271\377\264\341\271\377\264\341"
+ 745      FFB4E1B9 
+ 745      FFB4E1B9 
+ 745      FFB4E1
+ 746 2af6 B9FFB5E1 		.ascii	"\271\377\265\341\272\377\265\342\272\377\265\342\272\377\266"
+ 746      BAFFB5E2 
+ 746      BAFFB5E2 
+ 746      BAFFB6
+ 747 2b05 E2BAFFB6 		.ascii	"\342\272\377\266\342\272\377\266\342\272\377\266\342\272\377"
+ 747      E2BAFFB6 
+ 747      E2BAFFB6 
+ 747      E2BAFF
+ 748 2b14 B7E2BAFF 		.ascii	"\267\342\272\377\267\342\272\377\267\342\273\377\270\342\273"
+ 748      B7E2BAFF 
+ 748      B7E2BBFF 
+ 748      B8E2BB
+ 749 2b23 FFB8E3BB 		.ascii	"\377\270\343\273\377\270\343\273\377\270\343\273\377\271\343"
+ 749      FFB8E3BB 
+ 749      FFB8E3BB 
+ 749      FFB9E3
+ 750 2b32 BBFFB9E3 		.ascii	"\273\377\271\343\273\377\271\343\273\377\272\343\274\377\272"
+ 750      BBFFB9E3 
+ 750      BBFFBAE3 
+ 750      BCFFBA
+ 751 2b41 E3BCFFBA 		.ascii	"\343\274\377\272\343\274\377\272\344\274\377\273\344\274\377"
+ 751      E3BCFFBA 
+ 751      E4BCFFBB 
+ 751      E4BCFF
+ 752 2b50 BBE4BCFF 		.ascii	"\273\344\274\377\273\344\274\377\273\344\274\377\274\344\275"
+ 752      BBE4BCFF 
+ 752      BBE4BCFF 
+ 752      BCE4BD
+ 753 2b5f FFBCE4BD 		.ascii	"\377\274\344\275\377\274\344\275\377\275\344\275\377\275\345"
+ 753      FFBCE4BD 
+ 753      FFBDE4BD 
+ 753      FFBDE5
+ 754 2b6e BDFFBDE5 		.ascii	"\275\377\275\345\275\377\275\345\275\377\276\345\275\377\276"
+ 754      BDFFBDE5 
+ 754      BDFFBEE5 
+GAS LISTING /tmp/ccKdOQhn.s 			page 54
+
+
+ 754      BDFFBE
+ 755 2b7d E5BEFFBE 		.ascii	"\345\276\377\276\345\276\377\277\345\276\377\277\345\276\377"
+ 755      E5BEFFBF 
+ 755      E5BEFFBF 
+ 755      E5BEFF
+ 756 2b8c BFE5BEFF 		.ascii	"\277\345\276\377\277\346\276\377\300\346\276\377\300\346\277"
+ 756      BFE6BEFF 
+ 756      C0E6BEFF 
+ 756      C0E6BF
+ 757 2b9b FFC0E6BF 		.ascii	"\377\300\346\277\377\300\346\277\377\301\346\277\377\301\346"
+ 757      FFC0E6BF 
+ 757      FFC1E6BF 
+ 757      FFC1E6
+ 758 2baa BFFFC1E6 		.ascii	"\277\377\301\346\277\377\302\346\277\377\302\347\277\377\302"
+ 758      BFFFC2E6 
+ 758      BFFFC2E7 
+ 758      BFFFC2
+ 759 2bb9 E7C0FFC2 		.ascii	"\347\300\377\302\347\300\377\303\347\300\377\303\347\300\377"
+ 759      E7C0FFC3 
+ 759      E7C0FFC3 
+ 759      E7C0FF
+ 760 2bc8 C3E7C0FF 		.ascii	"\303\347\300\377\303\347\300\377\304\347\300\377\304\347\301"
+ 760      C3E7C0FF 
+ 760      C4E7C0FF 
+ 760      C4E7C1
+ 761 2bd7 FFC4E8C1 		.ascii	"\377\304\350\301\377\305\350\301\377\305\350\301\377\305\350"
+ 761      FFC5E8C1 
+ 761      FFC5E8C1 
+ 761      FFC5E8
+ 762 2be6 C1FFC5E8 		.ascii	"\301\377\305\350\301\377\306\350\301\377\306\350\302\377\306"
+ 762      C1FFC6E8 
+ 762      C1FFC6E8 
+ 762      C2FFC6
+ 763 2bf5 E8C2FFC6 		.ascii	"\350\302\377\306\350\302\377\307\351\302\377\307\351\302\377"
+ 763      E8C2FFC7 
+ 763      E9C2FFC7 
+ 763      E9C2FF
+ 764 2c04 C7E9C2FF 		.ascii	"\307\351\302\377\310\351\302\377\310\351\302\377\310\351\303"
+ 764      C8E9C2FF 
+ 764      C8E9C2FF 
+ 764      C8E9C3
+ 765 2c13 FFC8E9C3 		.ascii	"\377\310\351\303\377\311\351\303\377\311\351\303\377\311\352"
+ 765      FFC9E9C3 
+ 765      FFC9E9C3 
+ 765      FFC9EA
+ 766 2c22 C3FFC9EA 		.ascii	"\303\377\311\352\303\377\312\352\303\377\312\352\304\377\312"
+ 766      C3FFCAEA 
+ 766      C3FFCAEA 
+ 766      C4FFCA
+ 767 2c31 EAC4FFCA 		.ascii	"\352\304\377\312\352\304\377\313\352\304\377\313\352\304\377"
+ 767      EAC4FFCB 
+ 767      EAC4FFCB 
+ 767      EAC4FF
+ 768 2c40 CBEAC4FF 		.ascii	"\313\352\304\377\313\353\304\377\314\353\305\377\314\353\305"
+ 768      CBEBC4FF 
+ 768      CCEBC5FF 
+ 768      CCEBC5
+GAS LISTING /tmp/ccKdOQhn.s 			page 55
+
+
+ 769 2c4f FFCCEBC5 		.ascii	"\377\314\353\305\377\314\353\305\377\314\353\305\377\314\353"
+ 769      FFCCEBC5 
+ 769      FFCCEBC5 
+ 769      FFCCEB
+ 770 2c5e C6FFCDEB 		.ascii	"\306\377\315\353\306\377\315\353\306\377\315\353\306\377\315"
+ 770      C6FFCDEB 
+ 770      C6FFCDEB 
+ 770      C6FFCD
+ 771 2c6d EBC6FFCD 		.ascii	"\353\306\377\315\353\306\377\315\353\307\377\316\353\307\377"
+ 771      EBC6FFCD 
+ 771      EBC7FFCE 
+ 771      EBC7FF
+ 772 2c7c CEEBC7FF 		.ascii	"\316\353\307\377\316\353\307\377\316\354\307\377\316\354\307"
+ 772      CEEBC7FF 
+ 772      CEECC7FF 
+ 772      CEECC7
+ 773 2c8b FFCEECC8 		.ascii	"\377\316\354\310\377\316\354\310\377\317\354\310\377\317\354"
+ 773      FFCEECC8 
+ 773      FFCFECC8 
+ 773      FFCFEC
+ 774 2c9a C8FFCFEC 		.ascii	"\310\377\317\354\310\377\317\354\310\377\317\354\311\377\317"
+ 774      C8FFCFEC 
+ 774      C8FFCFEC 
+ 774      C9FFCF
+ 775 2ca9 ECC9FFD0 		.ascii	"\354\311\377\320\354\311\377\320\354\311\377\320\354\311\377"
+ 775      ECC9FFD0 
+ 775      ECC9FFD0 
+ 775      ECC9FF
+ 776 2cb8 D0ECC9FF 		.ascii	"\320\354\311\377\320\354\312\377\320\354\312\377\321\355\312"
+ 776      D0ECCAFF 
+ 776      D0ECCAFF 
+ 776      D1EDCA
+ 777 2cc7 FFD1EDCA 		.ascii	"\377\321\355\312\377\321\355\312\377\321\355\312\377\321\355"
+ 777      FFD1EDCA 
+ 777      FFD1EDCA 
+ 777      FFD1ED
+ 778 2cd6 CBFFD1ED 		.ascii	"\313\377\321\355\313\377\321\355\313\377\322\355\313\377\322"
+ 778      CBFFD1ED 
+ 778      CBFFD2ED 
+ 778      CBFFD2
+ 779 2ce5 EDCBFFD2 		.ascii	"\355\313\377\322\355\314\377\322\355\314\377\322\355\314\377"
+ 779      EDCCFFD2 
+ 779      EDCCFFD2 
+ 779      EDCCFF
+ 780 2cf4 D2EDCCFF 		.ascii	"\322\355\314\377\323\355\314\377\323\355\314\377\323\355\315"
+ 780      D3EDCCFF 
+ 780      D3EDCCFF 
+ 780      D3EDCD
+ 781 2d03 FFD3EECD 		.ascii	"\377\323\356\315\377\323\356\315\377\323\356\315\377\324\356"
+ 781      FFD3EECD 
+ 781      FFD3EECD 
+ 781      FFD4EE
+ 782 2d12 CDFFD4EE 		.ascii	"\315\377\324\356\315\377\324\356\316\377\324\356\316\377\324"
+ 782      CDFFD4EE 
+ 782      CEFFD4EE 
+ 782      CEFFD4
+ 783 2d21 EECEFFD4 		.ascii	"\356\316\377\324\356\316\377\324\356\316\377\325\356\316\377"
+GAS LISTING /tmp/ccKdOQhn.s 			page 56
+
+
+ 783      EECEFFD4 
+ 783      EECEFFD5 
+ 783      EECEFF
+ 784 2d30 D5EECFFF 		.ascii	"\325\356\317\377\325\356\317\377\325\356\317\377\325\356\317"
+ 784      D5EECFFF 
+ 784      D5EECFFF 
+ 784      D5EECF
+ 785 2d3f FFD5EECF 		.ascii	"\377\325\356\317\377\326\357\317\377\326\357\320\377\326\357"
+ 785      FFD6EFCF 
+ 785      FFD6EFD0 
+ 785      FFD6EF
+ 786 2d4e D0FFD6EF 		.ascii	"\320\377\326\357\320\377\326\357\320\377\326\357\320\377\326"
+ 786      D0FFD6EF 
+ 786      D0FFD6EF 
+ 786      D0FFD6
+ 787 2d5d EFD0FFD7 		.ascii	"\357\320\377\327\357\321\377\327\357\321\377\327\357\321\377"
+ 787      EFD1FFD7 
+ 787      EFD1FFD7 
+ 787      EFD1FF
+ 788 2d6c D7EFD1FF 		.ascii	"\327\357\321\377\327\357\321\377\327\357\322\377\330\357\322"
+ 788      D7EFD1FF 
+ 788      D7EFD2FF 
+ 788      D8EFD2
+ 789 2d7b FFD8EFD2 		.ascii	"\377\330\357\322\377\330\357\322\377\330\360\322\377\330\360"
+ 789      FFD8EFD2 
+ 789      FFD8F0D2 
+ 789      FFD8F0
+ 790 2d8a D2FFD8F0 		.ascii	"\322\377\330\360\323\377\331\360\323\377\331\360\323\377\331"
+ 790      D3FFD9F0 
+ 790      D3FFD9F0 
+ 790      D3FFD9
+ 791 2d99 F0D3FFD9 		.ascii	"\360\323\377\331\360\323\377\331\360\323\377\331\360\324\377"
+ 791      F0D3FFD9 
+ 791      F0D3FFD9 
+ 791      F0D4FF
+ 792 2da8 D9F0D4FF 		.ascii	"\331\360\324\377\332\360\324\377\332\360\324\377\332\360\324"
+ 792      DAF0D4FF 
+ 792      DAF0D4FF 
+ 792      DAF0D4
+ 793 2db7 FFDAF0D4 		.ascii	"\377\332\360\324\377\332\360\325\377\332\360\325\377\333\361"
+ 793      FFDAF0D5 
+ 793      FFDAF0D5 
+ 793      FFDBF1
+ 794 2dc6 D5FFDBF1 		.ascii	"\325\377\333\361\325\377\333\361\325\377\333\361\325\377\333"
+ 794      D5FFDBF1 
+ 794      D5FFDBF1 
+ 794      D5FFDB
+ 795 2dd5 F1D6FFDB 		.ascii	"\361\326\377\333\361\326\377\333\361\326\377\334\361\326\377"
+ 795      F1D6FFDB 
+ 795      F1D6FFDC 
+ 795      F1D6FF
+ 796 2de4 DCF1D6FF 		.ascii	"\334\361\326\377\334\361\327\377\334\361\327\377\334\361\327"
+ 796      DCF1D7FF 
+ 796      DCF1D7FF 
+ 796      DCF1D7
+ 797 2df3 FFDCF1D7 		.ascii	"\377\334\361\327\377\335\361\327\377\335\361\327\377\335\361"
+ 797      FFDDF1D7 
+GAS LISTING /tmp/ccKdOQhn.s 			page 57
+
+
+ 797      FFDDF1D7 
+ 797      FFDDF1
+ 798 2e02 D8FFDDF2 		.ascii	"\330\377\335\362\330\377\335\362\330\377\335\362\330\377\335"
+ 798      D8FFDDF2 
+ 798      D8FFDDF2 
+ 798      D8FFDD
+ 799 2e11 F2D8FFDE 		.ascii	"\362\330\377\336\362\330\377\336\362\331\377\336\362\331\377"
+ 799      F2D8FFDE 
+ 799      F2D9FFDE 
+ 799      F2D9FF
+ 800 2e20 DEF2D9FF 		.ascii	"\336\362\331\377\336\362\331\377\336\362\331\377\337\362\331"
+ 800      DEF2D9FF 
+ 800      DEF2D9FF 
+ 800      DFF2D9
+ 801 2e2f FFDFF2DA 		.ascii	"\377\337\362\332\377\337\362\332\377\337\362\332\377\337\362"
+ 801      FFDFF2DA 
+ 801      FFDFF2DA 
+ 801      FFDFF2
+ 802 2e3e DAFFDFF2 		.ascii	"\332\377\337\362\332\377\337\363\332\377\340\363\333\377\340"
+ 802      DAFFDFF3 
+ 802      DAFFE0F3 
+ 802      DBFFE0
+ 803 2e4d F3DBFFE0 		.ascii	"\363\333\377\340\363\333\377\340\363\333\377\341\363\333\377"
+ 803      F3DBFFE0 
+ 803      F3DBFFE1 
+ 803      F3DBFF
+ 804 2e5c E1F3DBFF 		.ascii	"\341\363\333\377\341\363\334\377\341\363\334\377\341\363\334"
+ 804      E1F3DCFF 
+ 804      E1F3DCFF 
+ 804      E1F3DC
+ 805 2e6b FFE2F3DC 		.ascii	"\377\342\363\334\377\342\363\334\377\342\363\334\377\342\363"
+ 805      FFE2F3DC 
+ 805      FFE2F3DC 
+ 805      FFE2F3
+ 806 2e7a DCFFE2F3 		.ascii	"\334\377\342\363\335\377\343\363\335\377\343\364\335\377\343"
+ 806      DDFFE3F3 
+ 806      DDFFE3F4 
+ 806      DDFFE3
+ 807 2e89 F4DDFFE3 		.ascii	"\364\335\377\343\364\335\377\343\364\335\377\344\364\335\377"
+ 807      F4DDFFE3 
+ 807      F4DDFFE4 
+ 807      F4DDFF
+ 808 2e98 E4F4DEFF 		.ascii	"\344\364\336\377\344\364\336\377\344\364\336\377\344\364\336"
+ 808      E4F4DEFF 
+ 808      E4F4DEFF 
+ 808      E4F4DE
+ 809 2ea7 FFE5F4DE 		.ascii	"\377\345\364\336\377\345\364\336\377\345\364\336\377\345\364"
+ 809      FFE5F4DE 
+ 809      FFE5F4DE 
+ 809      FFE5F4
+ 810 2eb6 DFFFE5F4 		.ascii	"\337\377\345\364\337\377\345\364\337\377\346\365\337\377\346"
+ 810      DFFFE5F4 
+ 810      DFFFE6F5 
+ 810      DFFFE6
+ 811 2ec5 F5DFFFE6 		.ascii	"\365\337\377\346\365\337\377\346\365\340\377\346\365\340\377"
+ 811      F5DFFFE6 
+ 811      F5E0FFE6 
+GAS LISTING /tmp/ccKdOQhn.s 			page 58
+
+
+ 811      F5E0FF
+ 812 2ed4 E7F5E0FF 		.ascii	"\347\365\340\377\347\365\340\377\347\365\340\377\347\365\340"
+ 812      E7F5E0FF 
+ 812      E7F5E0FF 
+ 812      E7F5E0
+ 813 2ee3 FFE7F5E1 		.ascii	"\377\347\365\341\377\350\365\341\377\350\365\341\377\350\365"
+ 813      FFE8F5E1 
+ 813      FFE8F5E1 
+ 813      FFE8F5
+ 814 2ef2 E1FFE8F5 		.ascii	"\341\377\350\365\341\377\350\366\341\377\351\366\341\377\351"
+ 814      E1FFE8F6 
+ 814      E1FFE9F6 
+ 814      E1FFE9
+ 815 2f01 F6E2FFE9 		.ascii	"\366\342\377\351\366\342\377\351\366\342\377\351\366\342\377"
+ 815      F6E2FFE9 
+ 815      F6E2FFE9 
+ 815      F6E2FF
+ 816 2f10 E9F6E2FF 		.ascii	"\351\366\342\377\352\366\342\377\352\366\343\377\352\366\343"
+ 816      EAF6E2FF 
+ 816      EAF6E3FF 
+ 816      EAF6E3
+ 817 2f1f FFEAF6E3 		.ascii	"\377\352\366\343\377\352\366\343\377\353\366\343\377\353\366"
+ 817      FFEAF6E3 
+ 817      FFEBF6E3 
+ 817      FFEBF6
+ 818 2f2e E3FFEBF6 		.ascii	"\343\377\353\366\344\377\353\367\344\377\353\367\344\377\353"
+ 818      E4FFEBF7 
+ 818      E4FFEBF7 
+ 818      E4FFEB
+ 819 2f3d F7E4FFEC 		.ascii	"\367\344\377\354\367\344\377\354\367\344\377\354\367\345\377"
+ 819      F7E4FFEC 
+ 819      F7E4FFEC 
+ 819      F7E5FF
+ 820 2f4c ECF7E5FF 		.ascii	"\354\367\345\377\354\367\345\377\355\367\345\377\355\367\345"
+ 820      ECF7E5FF 
+ 820      EDF7E5FF 
+ 820      EDF7E5
+ 821 2f5b FFEDF7E5 		.ascii	"\377\355\367\345\377\355\367\346\377\355\367\346\377\355\367"
+ 821      FFEDF7E6 
+ 821      FFEDF7E6 
+ 821      FFEDF7
+ 822 2f6a E6FFEEF8 		.ascii	"\346\377\356\370\346\377\356\370\346\377\356\370\346\377\356"
+ 822      E6FFEEF8 
+ 822      E6FFEEF8 
+ 822      E6FFEE
+ 823 2f79 F8E7FFEE 		.ascii	"\370\347\377\356\370\347\377\357\370\347\377\357\370\347\377"
+ 823      F8E7FFEF 
+ 823      F8E7FFEF 
+ 823      F8E7FF
+ 824 2f88 EFF8E7FF 		.ascii	"\357\370\347\377\357\370\347\377\357\370\350\377\357\370\350"
+ 824      EFF8E7FF 
+ 824      EFF8E8FF 
+ 824      EFF8E8
+ 825 2f97 FFF0F8E8 		.ascii	"\377\360\370\350\377\360\370\350\377\360\370\350\377\360\371"
+ 825      FFF0F8E8 
+ 825      FFF0F8E8 
+ 825      FFF0F9
+GAS LISTING /tmp/ccKdOQhn.s 			page 59
+
+
+ 826 2fa6 E8FFF0F9 		.ascii	"\350\377\360\371\351\377\360\371\351\377\361\371\351\377\361"
+ 826      E9FFF0F9 
+ 826      E9FFF1F9 
+ 826      E9FFF1
+ 827 2fb5 F9E9FFF1 		.ascii	"\371\351\377\361\371\351\377\361\371\351\377\361\371\352\377"
+ 827      F9E9FFF1 
+ 827      F9E9FFF1 
+ 827      F9EAFF
+ 828 2fc4 F1F9EAFF 		.ascii	"\361\371\352\377\362\371\352\377\362\371\352\377\362\371\352"
+ 828      F2F9EAFF 
+ 828      F2F9EAFF 
+ 828      F2F9EA
+ 829 2fd3 FFF2F9EA 		.ascii	"\377\362\371\352\377\362\371\353\377\362\372\353\377"
+ 829      FFF2F9EB 
+ 829      FFF2FAEB 
+ 829      FF
+ 830 2fe0 F3FAEBFF 		.ascii	"\363\372\353\377\363\372\353\377\363\372\353\377\363\372\354"
+ 830      F3FAEBFF 
+ 830      F3FAEBFF 
+ 830      F3FAEC
+ 831 2fef FFF3FAEC 		.ascii	"\377\363\372\354\377\363\372\354\377\364\372\354\377\364\372"
+ 831      FFF3FAEC 
+ 831      FFF4FAEC 
+ 831      FFF4FA
+ 832 2ffe ECFFF4FA 		.ascii	"\354\377\364\372\354\377\364\372\355\377\364\372\355\377\364"
+ 832      ECFFF4FA 
+ 832      EDFFF4FA 
+ 832      EDFFF4
+ 833 300d FAEDFFF4 		.ascii	"\372\355\377\364\373\355\377\365\373\355\377\365\373\356\377"
+ 833      FBEDFFF5 
+ 833      FBEDFFF5 
+ 833      FBEEFF
+ 834 301c F5FBEEFF 		.ascii	"\365\373\356\377\365\373\356\377\365\373\356\377\365\373\356"
+ 834      F5FBEEFF 
+ 834      F5FBEEFF 
+ 834      F5FBEE
+ 835 302b FFF6FBEE 		.ascii	"\377\366\373\356\377\366\373\357\377\366\373\357\377\366\373"
+ 835      FFF6FBEF 
+ 835      FFF6FBEF 
+ 835      FFF6FB
+ 836 303a EFFFF6FB 		.ascii	"\357\377\366\373\357\377\366\373\357\377"
+ 836      EFFFF6FB 
+ 836      EFFF
+ 837              		.globl	heatmap_cs_GnBu_discrete
+ 838              		.section	.data.rel.local
+ 839              		.align 8
+ 840              		.type	heatmap_cs_GnBu_discrete, @object
+ 841              		.size	heatmap_cs_GnBu_discrete, 8
+ 842              	heatmap_cs_GnBu_discrete:
+ 843 0018 00000000 		.quad	discrete
+ 843      00000000 
+ 844              		.section	.data.rel.ro.local
+ 845              		.align 16
+ 846              		.type	discrete, @object
+ 847              		.size	discrete, 16
+ 848              	discrete:
+ 849 0030 00000000 		.quad	discrete_data
+GAS LISTING /tmp/ccKdOQhn.s 			page 60
+
+
+ 849      00000000 
+ 850 0038 0A000000 		.quad	10
+ 850      00000000 
+ 851              		.section	.rodata
+ 852 3044 00000000 		.align 32
+ 852      00000000 
+ 852      00000000 
+ 852      00000000 
+ 852      00000000 
+ 853              		.type	discrete_data, @object
+ 854              		.size	discrete_data, 40
+ 855              	discrete_data:
+ 856 3060 00       		.string	""
+ 857 3061 00       		.string	""
+ 858 3062 00       		.string	""
+ 859 3063 00       		.string	""
+ 860 3064 084081FF 		.ascii	"\b@\201\377\bh\254\377+\214\276\377N\263\323\377{\314\304\377"
+ 860      0868ACFF 
+ 860      2B8CBEFF 
+ 860      4EB3D3FF 
+ 860      7BCCC4FF 
+ 861 3078 A8DDB5FF 		.ascii	"\250\335\265\377\314\353\305\377\340\363\333\377\367\374\360"
+ 861      CCEBC5FF 
+ 861      E0F3DBFF 
+ 861      F7FCF0
+ 862 3087 FF       		.ascii	"\377"
+ 863              		.text
+ 864              	.Letext0:
+ 865              		.file 1 "./heatmap.h"
+ 866              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 867              		.file 3 "./colorschemes/GnBu.h"
+ 868              		.file 4 "colorschemes/GnBu.c"
+ 869              		.section	.debug_info,"",@progbits
+ 870              	.Ldebug_info0:
+ 871 0000 E3010000 		.long	0x1e3
+ 872 0004 0500     		.value	0x5
+ 873 0006 01       		.byte	0x1
+ 874 0007 08       		.byte	0x8
+ 875 0008 00000000 		.long	.Ldebug_abbrev0
+ 876 000c 0A       		.uleb128 0xa
+ 877 000d 00000000 		.long	.LASF26
+ 878 0011 1D       		.byte	0x1d
+ 879 0012 00000000 		.long	.LASF0
+ 880 0016 00000000 		.long	.LASF1
+ 881 001a 00000000 		.long	.Ldebug_line0
+ 882 001e 01       		.uleb128 0x1
+ 883 001f 08       		.byte	0x8
+ 884 0020 05       		.byte	0x5
+ 885 0021 00000000 		.long	.LASF2
+ 886 0025 06       		.uleb128 0x6
+ 887 0026 00000000 		.long	.LASF12
+ 888 002a 02       		.byte	0x2
+ 889 002b D6       		.byte	0xd6
+ 890 002c 17       		.byte	0x17
+ 891 002d 31000000 		.long	0x31
+ 892 0031 01       		.uleb128 0x1
+ 893 0032 08       		.byte	0x8
+GAS LISTING /tmp/ccKdOQhn.s 			page 61
+
+
+ 894 0033 07       		.byte	0x7
+ 895 0034 00000000 		.long	.LASF3
+ 896 0038 0B       		.uleb128 0xb
+ 897 0039 04       		.byte	0x4
+ 898 003a 05       		.byte	0x5
+ 899 003b 696E7400 		.string	"int"
+ 900 003f 01       		.uleb128 0x1
+ 901 0040 08       		.byte	0x8
+ 902 0041 05       		.byte	0x5
+ 903 0042 00000000 		.long	.LASF4
+ 904 0046 01       		.uleb128 0x1
+ 905 0047 10       		.byte	0x10
+ 906 0048 04       		.byte	0x4
+ 907 0049 00000000 		.long	.LASF5
+ 908 004d 01       		.uleb128 0x1
+ 909 004e 04       		.byte	0x4
+ 910 004f 04       		.byte	0x4
+ 911 0050 00000000 		.long	.LASF6
+ 912 0054 01       		.uleb128 0x1
+ 913 0055 04       		.byte	0x4
+ 914 0056 07       		.byte	0x7
+ 915 0057 00000000 		.long	.LASF7
+ 916 005b 01       		.uleb128 0x1
+ 917 005c 02       		.byte	0x2
+ 918 005d 07       		.byte	0x7
+ 919 005e 00000000 		.long	.LASF8
+ 920 0062 0C       		.uleb128 0xc
+ 921 0063 10       		.byte	0x10
+ 922 0064 01       		.byte	0x1
+ 923 0065 BB       		.byte	0xbb
+ 924 0066 09       		.byte	0x9
+ 925 0067 84000000 		.long	0x84
+ 926 006b 07       		.uleb128 0x7
+ 927 006c 00000000 		.long	.LASF9
+ 928 0070 BC       		.byte	0xbc
+ 929 0071 1A       		.byte	0x1a
+ 930 0072 84000000 		.long	0x84
+ 931 0076 00       		.byte	0
+ 932 0077 07       		.uleb128 0x7
+ 933 0078 00000000 		.long	.LASF10
+ 934 007c BD       		.byte	0xbd
+ 935 007d 0C       		.byte	0xc
+ 936 007e 25000000 		.long	0x25
+ 937 0082 08       		.byte	0x8
+ 938 0083 00       		.byte	0
+ 939 0084 08       		.uleb128 0x8
+ 940 0085 90000000 		.long	0x90
+ 941 0089 01       		.uleb128 0x1
+ 942 008a 01       		.byte	0x1
+ 943 008b 08       		.byte	0x8
+ 944 008c 00000000 		.long	.LASF11
+ 945 0090 03       		.uleb128 0x3
+ 946 0091 89000000 		.long	0x89
+ 947 0095 06       		.uleb128 0x6
+ 948 0096 00000000 		.long	.LASF13
+ 949 009a 01       		.byte	0x1
+ 950 009b BE       		.byte	0xbe
+GAS LISTING /tmp/ccKdOQhn.s 			page 62
+
+
+ 951 009c 03       		.byte	0x3
+ 952 009d 62000000 		.long	0x62
+ 953 00a1 03       		.uleb128 0x3
+ 954 00a2 95000000 		.long	0x95
+ 955 00a6 08       		.uleb128 0x8
+ 956 00a7 A1000000 		.long	0xa1
+ 957 00ab 04       		.uleb128 0x4
+ 958 00ac 00000000 		.long	.LASF14
+ 959 00b0 21       		.byte	0x21
+ 960 00b1 A6000000 		.long	0xa6
+ 961 00b5 04       		.uleb128 0x4
+ 962 00b6 00000000 		.long	.LASF15
+ 963 00ba 23       		.byte	0x23
+ 964 00bb A6000000 		.long	0xa6
+ 965 00bf 04       		.uleb128 0x4
+ 966 00c0 00000000 		.long	.LASF16
+ 967 00c4 25       		.byte	0x25
+ 968 00c5 A6000000 		.long	0xa6
+ 969 00c9 04       		.uleb128 0x4
+ 970 00ca 00000000 		.long	.LASF17
+ 971 00ce 28       		.byte	0x28
+ 972 00cf A6000000 		.long	0xa6
+ 973 00d3 09       		.uleb128 0x9
+ 974 00d4 90000000 		.long	0x90
+ 975 00d8 E3000000 		.long	0xe3
+ 976 00dc 0D       		.uleb128 0xd
+ 977 00dd 31000000 		.long	0x31
+ 978 00e1 27       		.byte	0x27
+ 979 00e2 00       		.byte	0
+ 980 00e3 03       		.uleb128 0x3
+ 981 00e4 D3000000 		.long	0xd3
+ 982 00e8 02       		.uleb128 0x2
+ 983 00e9 00000000 		.long	.LASF18
+ 984 00ed 20       		.byte	0x20
+ 985 00ee 1C       		.byte	0x1c
+ 986 00ef E3000000 		.long	0xe3
+ 987 00f3 09       		.uleb128 0x9
+ 988 00f4 03       		.byte	0x3
+ 989 00f5 00000000 		.quad	discrete_data
+ 989      00000000 
+ 990 00fd 02       		.uleb128 0x2
+ 991 00fe 00000000 		.long	.LASF19
+ 992 0102 23       		.byte	0x23
+ 993 0103 24       		.byte	0x24
+ 994 0104 A1000000 		.long	0xa1
+ 995 0108 09       		.uleb128 0x9
+ 996 0109 03       		.byte	0x3
+ 997 010a 00000000 		.quad	discrete
+ 997      00000000 
+ 998 0112 05       		.uleb128 0x5
+ 999 0113 AB000000 		.long	0xab
+ 1000 0117 24       		.byte	0x24
+ 1001 0118 09       		.uleb128 0x9
+ 1002 0119 03       		.byte	0x3
+ 1003 011a 00000000 		.quad	heatmap_cs_GnBu_discrete
+ 1003      00000000 
+ 1004 0122 09       		.uleb128 0x9
+GAS LISTING /tmp/ccKdOQhn.s 			page 63
+
+
+ 1005 0123 90000000 		.long	0x90
+ 1006 0127 33010000 		.long	0x133
+ 1007 012b 0E       		.uleb128 0xe
+ 1008 012c 31000000 		.long	0x31
+ 1009 0130 0310     		.value	0x1003
+ 1010 0132 00       		.byte	0
+ 1011 0133 03       		.uleb128 0x3
+ 1012 0134 22010000 		.long	0x122
+ 1013 0138 02       		.uleb128 0x2
+ 1014 0139 00000000 		.long	.LASF20
+ 1015 013d 26       		.byte	0x26
+ 1016 013e 1C       		.byte	0x1c
+ 1017 013f 33010000 		.long	0x133
+ 1018 0143 09       		.uleb128 0x9
+ 1019 0144 03       		.byte	0x3
+ 1020 0145 00000000 		.quad	soft_data
+ 1020      00000000 
+ 1021 014d 02       		.uleb128 0x2
+ 1022 014e 00000000 		.long	.LASF21
+ 1023 0152 29       		.byte	0x29
+ 1024 0153 24       		.byte	0x24
+ 1025 0154 A1000000 		.long	0xa1
+ 1026 0158 09       		.uleb128 0x9
+ 1027 0159 03       		.byte	0x3
+ 1028 015a 00000000 		.quad	soft
+ 1028      00000000 
+ 1029 0162 05       		.uleb128 0x5
+ 1030 0163 B5000000 		.long	0xb5
+ 1031 0167 2A       		.byte	0x2a
+ 1032 0168 09       		.uleb128 0x9
+ 1033 0169 03       		.byte	0x3
+ 1034 016a 00000000 		.quad	heatmap_cs_GnBu_soft
+ 1034      00000000 
+ 1035 0172 02       		.uleb128 0x2
+ 1036 0173 00000000 		.long	.LASF22
+ 1037 0177 2C       		.byte	0x2c
+ 1038 0178 1C       		.byte	0x1c
+ 1039 0179 33010000 		.long	0x133
+ 1040 017d 09       		.uleb128 0x9
+ 1041 017e 03       		.byte	0x3
+ 1042 017f 00000000 		.quad	mixed_data
+ 1042      00000000 
+ 1043 0187 02       		.uleb128 0x2
+ 1044 0188 00000000 		.long	.LASF23
+ 1045 018c 2F       		.byte	0x2f
+ 1046 018d 24       		.byte	0x24
+ 1047 018e A1000000 		.long	0xa1
+ 1048 0192 09       		.uleb128 0x9
+ 1049 0193 03       		.byte	0x3
+ 1050 0194 00000000 		.quad	mixed
+ 1050      00000000 
+ 1051 019c 05       		.uleb128 0x5
+ 1052 019d BF000000 		.long	0xbf
+ 1053 01a1 30       		.byte	0x30
+ 1054 01a2 09       		.uleb128 0x9
+ 1055 01a3 03       		.byte	0x3
+ 1056 01a4 00000000 		.quad	heatmap_cs_GnBu_mixed
+GAS LISTING /tmp/ccKdOQhn.s 			page 64
+
+
+ 1056      00000000 
+ 1057 01ac 02       		.uleb128 0x2
+ 1058 01ad 00000000 		.long	.LASF24
+ 1059 01b1 32       		.byte	0x32
+ 1060 01b2 1C       		.byte	0x1c
+ 1061 01b3 33010000 		.long	0x133
+ 1062 01b7 09       		.uleb128 0x9
+ 1063 01b8 03       		.byte	0x3
+ 1064 01b9 00000000 		.quad	mixed_exp_data
+ 1064      00000000 
+ 1065 01c1 02       		.uleb128 0x2
+ 1066 01c2 00000000 		.long	.LASF25
+ 1067 01c6 35       		.byte	0x35
+ 1068 01c7 24       		.byte	0x24
+ 1069 01c8 A1000000 		.long	0xa1
+ 1070 01cc 09       		.uleb128 0x9
+ 1071 01cd 03       		.byte	0x3
+ 1072 01ce 00000000 		.quad	mixed_exp
+ 1072      00000000 
+ 1073 01d6 05       		.uleb128 0x5
+ 1074 01d7 C9000000 		.long	0xc9
+ 1075 01db 36       		.byte	0x36
+ 1076 01dc 09       		.uleb128 0x9
+ 1077 01dd 03       		.byte	0x3
+ 1078 01de 00000000 		.quad	heatmap_cs_GnBu_mixed_exp
+ 1078      00000000 
+ 1079 01e6 00       		.byte	0
+ 1080              		.section	.debug_abbrev,"",@progbits
+ 1081              	.Ldebug_abbrev0:
+ 1082 0000 01       		.uleb128 0x1
+ 1083 0001 24       		.uleb128 0x24
+ 1084 0002 00       		.byte	0
+ 1085 0003 0B       		.uleb128 0xb
+ 1086 0004 0B       		.uleb128 0xb
+ 1087 0005 3E       		.uleb128 0x3e
+ 1088 0006 0B       		.uleb128 0xb
+ 1089 0007 03       		.uleb128 0x3
+ 1090 0008 0E       		.uleb128 0xe
+ 1091 0009 00       		.byte	0
+ 1092 000a 00       		.byte	0
+ 1093 000b 02       		.uleb128 0x2
+ 1094 000c 34       		.uleb128 0x34
+ 1095 000d 00       		.byte	0
+ 1096 000e 03       		.uleb128 0x3
+ 1097 000f 0E       		.uleb128 0xe
+ 1098 0010 3A       		.uleb128 0x3a
+ 1099 0011 21       		.uleb128 0x21
+ 1100 0012 04       		.sleb128 4
+ 1101 0013 3B       		.uleb128 0x3b
+ 1102 0014 0B       		.uleb128 0xb
+ 1103 0015 39       		.uleb128 0x39
+ 1104 0016 0B       		.uleb128 0xb
+ 1105 0017 49       		.uleb128 0x49
+ 1106 0018 13       		.uleb128 0x13
+ 1107 0019 02       		.uleb128 0x2
+ 1108 001a 18       		.uleb128 0x18
+ 1109 001b 00       		.byte	0
+GAS LISTING /tmp/ccKdOQhn.s 			page 65
+
+
+ 1110 001c 00       		.byte	0
+ 1111 001d 03       		.uleb128 0x3
+ 1112 001e 26       		.uleb128 0x26
+ 1113 001f 00       		.byte	0
+ 1114 0020 49       		.uleb128 0x49
+ 1115 0021 13       		.uleb128 0x13
+ 1116 0022 00       		.byte	0
+ 1117 0023 00       		.byte	0
+ 1118 0024 04       		.uleb128 0x4
+ 1119 0025 34       		.uleb128 0x34
+ 1120 0026 00       		.byte	0
+ 1121 0027 03       		.uleb128 0x3
+ 1122 0028 0E       		.uleb128 0xe
+ 1123 0029 3A       		.uleb128 0x3a
+ 1124 002a 21       		.uleb128 0x21
+ 1125 002b 03       		.sleb128 3
+ 1126 002c 3B       		.uleb128 0x3b
+ 1127 002d 0B       		.uleb128 0xb
+ 1128 002e 39       		.uleb128 0x39
+ 1129 002f 21       		.uleb128 0x21
+ 1130 0030 25       		.sleb128 37
+ 1131 0031 49       		.uleb128 0x49
+ 1132 0032 13       		.uleb128 0x13
+ 1133 0033 3F       		.uleb128 0x3f
+ 1134 0034 19       		.uleb128 0x19
+ 1135 0035 3C       		.uleb128 0x3c
+ 1136 0036 19       		.uleb128 0x19
+ 1137 0037 00       		.byte	0
+ 1138 0038 00       		.byte	0
+ 1139 0039 05       		.uleb128 0x5
+ 1140 003a 34       		.uleb128 0x34
+ 1141 003b 00       		.byte	0
+ 1142 003c 47       		.uleb128 0x47
+ 1143 003d 13       		.uleb128 0x13
+ 1144 003e 3A       		.uleb128 0x3a
+ 1145 003f 21       		.uleb128 0x21
+ 1146 0040 04       		.sleb128 4
+ 1147 0041 3B       		.uleb128 0x3b
+ 1148 0042 0B       		.uleb128 0xb
+ 1149 0043 39       		.uleb128 0x39
+ 1150 0044 21       		.uleb128 0x21
+ 1151 0045 1E       		.sleb128 30
+ 1152 0046 02       		.uleb128 0x2
+ 1153 0047 18       		.uleb128 0x18
+ 1154 0048 00       		.byte	0
+ 1155 0049 00       		.byte	0
+ 1156 004a 06       		.uleb128 0x6
+ 1157 004b 16       		.uleb128 0x16
+ 1158 004c 00       		.byte	0
+ 1159 004d 03       		.uleb128 0x3
+ 1160 004e 0E       		.uleb128 0xe
+ 1161 004f 3A       		.uleb128 0x3a
+ 1162 0050 0B       		.uleb128 0xb
+ 1163 0051 3B       		.uleb128 0x3b
+ 1164 0052 0B       		.uleb128 0xb
+ 1165 0053 39       		.uleb128 0x39
+ 1166 0054 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccKdOQhn.s 			page 66
+
+
+ 1167 0055 49       		.uleb128 0x49
+ 1168 0056 13       		.uleb128 0x13
+ 1169 0057 00       		.byte	0
+ 1170 0058 00       		.byte	0
+ 1171 0059 07       		.uleb128 0x7
+ 1172 005a 0D       		.uleb128 0xd
+ 1173 005b 00       		.byte	0
+ 1174 005c 03       		.uleb128 0x3
+ 1175 005d 0E       		.uleb128 0xe
+ 1176 005e 3A       		.uleb128 0x3a
+ 1177 005f 21       		.uleb128 0x21
+ 1178 0060 01       		.sleb128 1
+ 1179 0061 3B       		.uleb128 0x3b
+ 1180 0062 0B       		.uleb128 0xb
+ 1181 0063 39       		.uleb128 0x39
+ 1182 0064 0B       		.uleb128 0xb
+ 1183 0065 49       		.uleb128 0x49
+ 1184 0066 13       		.uleb128 0x13
+ 1185 0067 38       		.uleb128 0x38
+ 1186 0068 0B       		.uleb128 0xb
+ 1187 0069 00       		.byte	0
+ 1188 006a 00       		.byte	0
+ 1189 006b 08       		.uleb128 0x8
+ 1190 006c 0F       		.uleb128 0xf
+ 1191 006d 00       		.byte	0
+ 1192 006e 0B       		.uleb128 0xb
+ 1193 006f 21       		.uleb128 0x21
+ 1194 0070 08       		.sleb128 8
+ 1195 0071 49       		.uleb128 0x49
+ 1196 0072 13       		.uleb128 0x13
+ 1197 0073 00       		.byte	0
+ 1198 0074 00       		.byte	0
+ 1199 0075 09       		.uleb128 0x9
+ 1200 0076 01       		.uleb128 0x1
+ 1201 0077 01       		.byte	0x1
+ 1202 0078 49       		.uleb128 0x49
+ 1203 0079 13       		.uleb128 0x13
+ 1204 007a 01       		.uleb128 0x1
+ 1205 007b 13       		.uleb128 0x13
+ 1206 007c 00       		.byte	0
+ 1207 007d 00       		.byte	0
+ 1208 007e 0A       		.uleb128 0xa
+ 1209 007f 11       		.uleb128 0x11
+ 1210 0080 01       		.byte	0x1
+ 1211 0081 25       		.uleb128 0x25
+ 1212 0082 0E       		.uleb128 0xe
+ 1213 0083 13       		.uleb128 0x13
+ 1214 0084 0B       		.uleb128 0xb
+ 1215 0085 03       		.uleb128 0x3
+ 1216 0086 1F       		.uleb128 0x1f
+ 1217 0087 1B       		.uleb128 0x1b
+ 1218 0088 1F       		.uleb128 0x1f
+ 1219 0089 10       		.uleb128 0x10
+ 1220 008a 17       		.uleb128 0x17
+ 1221 008b 00       		.byte	0
+ 1222 008c 00       		.byte	0
+ 1223 008d 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccKdOQhn.s 			page 67
+
+
+ 1224 008e 24       		.uleb128 0x24
+ 1225 008f 00       		.byte	0
+ 1226 0090 0B       		.uleb128 0xb
+ 1227 0091 0B       		.uleb128 0xb
+ 1228 0092 3E       		.uleb128 0x3e
+ 1229 0093 0B       		.uleb128 0xb
+ 1230 0094 03       		.uleb128 0x3
+ 1231 0095 08       		.uleb128 0x8
+ 1232 0096 00       		.byte	0
+ 1233 0097 00       		.byte	0
+ 1234 0098 0C       		.uleb128 0xc
+ 1235 0099 13       		.uleb128 0x13
+ 1236 009a 01       		.byte	0x1
+ 1237 009b 0B       		.uleb128 0xb
+ 1238 009c 0B       		.uleb128 0xb
+ 1239 009d 3A       		.uleb128 0x3a
+ 1240 009e 0B       		.uleb128 0xb
+ 1241 009f 3B       		.uleb128 0x3b
+ 1242 00a0 0B       		.uleb128 0xb
+ 1243 00a1 39       		.uleb128 0x39
+ 1244 00a2 0B       		.uleb128 0xb
+ 1245 00a3 01       		.uleb128 0x1
+ 1246 00a4 13       		.uleb128 0x13
+ 1247 00a5 00       		.byte	0
+ 1248 00a6 00       		.byte	0
+ 1249 00a7 0D       		.uleb128 0xd
+ 1250 00a8 21       		.uleb128 0x21
+ 1251 00a9 00       		.byte	0
+ 1252 00aa 49       		.uleb128 0x49
+ 1253 00ab 13       		.uleb128 0x13
+ 1254 00ac 2F       		.uleb128 0x2f
+ 1255 00ad 0B       		.uleb128 0xb
+ 1256 00ae 00       		.byte	0
+ 1257 00af 00       		.byte	0
+ 1258 00b0 0E       		.uleb128 0xe
+ 1259 00b1 21       		.uleb128 0x21
+ 1260 00b2 00       		.byte	0
+ 1261 00b3 49       		.uleb128 0x49
+ 1262 00b4 13       		.uleb128 0x13
+ 1263 00b5 2F       		.uleb128 0x2f
+ 1264 00b6 05       		.uleb128 0x5
+ 1265 00b7 00       		.byte	0
+ 1266 00b8 00       		.byte	0
+ 1267 00b9 00       		.byte	0
+ 1268              		.section	.debug_aranges,"",@progbits
+ 1269 0000 1C000000 		.long	0x1c
+ 1270 0004 0200     		.value	0x2
+ 1271 0006 00000000 		.long	.Ldebug_info0
+ 1272 000a 08       		.byte	0x8
+ 1273 000b 00       		.byte	0
+ 1274 000c 0000     		.value	0
+ 1275 000e 0000     		.value	0
+ 1276 0010 00000000 		.quad	0
+ 1276      00000000 
+ 1277 0018 00000000 		.quad	0
+ 1277      00000000 
+ 1278              		.section	.debug_line,"",@progbits
+GAS LISTING /tmp/ccKdOQhn.s 			page 68
+
+
+ 1279              	.Ldebug_line0:
+ 1280 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1280      05000800 
+ 1280      49000000 
+ 1280      010101FB 
+ 1280      0E0D0001 
+ 1281              	.LASF20:
+ 1282 0000 736F6674 		.string	"soft_data"
+ 1282      5F646174 
+ 1282      6100
+ 1283              	.LASF12:
+ 1284 000a 73697A65 		.string	"size_t"
+ 1284      5F7400
+ 1285              	.LASF13:
+ 1286 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1286      6D61705F 
+ 1286      636F6C6F 
+ 1286      72736368 
+ 1286      656D655F 
+ 1287              	.LASF15:
+ 1288 0027 68656174 		.string	"heatmap_cs_GnBu_soft"
+ 1288      6D61705F 
+ 1288      63735F47 
+ 1288      6E42755F 
+ 1288      736F6674 
+ 1289              	.LASF26:
+ 1290 003c 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1290      43313720 
+ 1290      31322E32 
+ 1290      2E30202D 
+ 1290      6D74756E 
+ 1291              	.LASF6:
+ 1292 009b 666C6F61 		.string	"float"
+ 1292      7400
+ 1293              	.LASF11:
+ 1294 00a1 756E7369 		.string	"unsigned char"
+ 1294      676E6564 
+ 1294      20636861 
+ 1294      7200
+ 1295              	.LASF3:
+ 1296 00af 6C6F6E67 		.string	"long unsigned int"
+ 1296      20756E73 
+ 1296      69676E65 
+ 1296      6420696E 
+ 1296      7400
+ 1297              	.LASF8:
+ 1298 00c1 73686F72 		.string	"short unsigned int"
+ 1298      7420756E 
+ 1298      7369676E 
+ 1298      65642069 
+ 1298      6E7400
+ 1299              	.LASF14:
+ 1300 00d4 68656174 		.string	"heatmap_cs_GnBu_discrete"
+ 1300      6D61705F 
+ 1300      63735F47 
+ 1300      6E42755F 
+ 1300      64697363 
+GAS LISTING /tmp/ccKdOQhn.s 			page 69
+
+
+ 1301              	.LASF25:
+ 1302 00ed 6D697865 		.string	"mixed_exp"
+ 1302      645F6578 
+ 1302      7000
+ 1303              	.LASF23:
+ 1304 00f7 6D697865 		.string	"mixed"
+ 1304      6400
+ 1305              	.LASF16:
+ 1306 00fd 68656174 		.string	"heatmap_cs_GnBu_mixed"
+ 1306      6D61705F 
+ 1306      63735F47 
+ 1306      6E42755F 
+ 1306      6D697865 
+ 1307              	.LASF7:
+ 1308 0113 756E7369 		.string	"unsigned int"
+ 1308      676E6564 
+ 1308      20696E74 
+ 1308      00
+ 1309              	.LASF19:
+ 1310 0120 64697363 		.string	"discrete"
+ 1310      72657465 
+ 1310      00
+ 1311              	.LASF10:
+ 1312 0129 6E636F6C 		.string	"ncolors"
+ 1312      6F727300 
+ 1313              	.LASF4:
+ 1314 0131 6C6F6E67 		.string	"long long int"
+ 1314      206C6F6E 
+ 1314      6720696E 
+ 1314      7400
+ 1315              	.LASF24:
+ 1316 013f 6D697865 		.string	"mixed_exp_data"
+ 1316      645F6578 
+ 1316      705F6461 
+ 1316      746100
+ 1317              	.LASF22:
+ 1318 014e 6D697865 		.string	"mixed_data"
+ 1318      645F6461 
+ 1318      746100
+ 1319              	.LASF2:
+ 1320 0159 6C6F6E67 		.string	"long int"
+ 1320      20696E74 
+ 1320      00
+ 1321              	.LASF5:
+ 1322 0162 6C6F6E67 		.string	"long double"
+ 1322      20646F75 
+ 1322      626C6500 
+ 1323              	.LASF18:
+ 1324 016e 64697363 		.string	"discrete_data"
+ 1324      72657465 
+ 1324      5F646174 
+ 1324      6100
+ 1325              	.LASF21:
+ 1326 017c 736F6674 		.string	"soft"
+ 1326      00
+ 1327              	.LASF9:
+ 1328 0181 636F6C6F 		.string	"colors"
+GAS LISTING /tmp/ccKdOQhn.s 			page 70
+
+
+ 1328      727300
+ 1329              	.LASF17:
+ 1330 0188 68656174 		.string	"heatmap_cs_GnBu_mixed_exp"
+ 1330      6D61705F 
+ 1330      63735F47 
+ 1330      6E42755F 
+ 1330      6D697865 
+ 1331              		.section	.debug_line_str,"MS",@progbits,1
+ 1332              	.LASF1:
+ 1333 0000 2F726F6F 		.string	"/root/repo"
+ 1333      742F7265 
+ 1333      706F00
+ 1334              	.LASF0:
+ 1335 000b 636F6C6F 		.string	"colorschemes/GnBu.c"
+ 1335      72736368 
+ 1335      656D6573 
+ 1335      2F476E42 
+ 1335      752E6300 
+ 1336              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1337 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1337      742F7265 
+ 1337      706F0063 
+ 1337      6F6C6F72 
+ 1337      73636865 
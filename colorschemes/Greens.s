@@ -0,0 +1,3975 @@
+GAS LISTING /tmp/ccTsod4R.s 			page 1
+
+
+   1              		.file	"Greens.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/Greens.c"
+   5              		.globl	heatmap_cs_Greens_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_Greens_mixed_exp, @object
+   9              		.size	heatmap_cs_Greens_mixed_exp, 8
+  10              	heatmap_cs_Greens_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 00       		.string	""
+  29 0005 441A00   		.string	"D\032"
+  30 0008 00       		.string	""
+  31 0009 461C1800 		.string	"F\034\030"
+  32 000d 481D3100 		.string	"H\0351"
+  33 0011 4B1E4A00 		.string	"K\036J"
+  34 0015 4D1F6300 		.string	"M\037c"
+  35 0019 50207C00 		.string	"P |"
+  36 001d 52219500 		.string	"R!\225"
+  37 0021 5D25AE00 		.string	"]%\256"
+  38 0025 5F26C700 		.string	"_&\307"
+  39 0029 6227E000 		.string	"b'\340"
+  40 002d 6428F900 		.string	"d(\371"
+  41 0031 6629FF00 		.string	"f)\377"
+  42 0035 692AFF00 		.string	"i*\377"
+  43 0039 6B2BFF00 		.string	"k+\377"
+  44 003d 6D2CFF03 		.ascii	"m,\377\003o-\377\005p/\377\007r0\377\nt1\377\fu3\377\016w4\377"
+  44      6F2DFF05 
+  44      702FFF07 
+  44      7230FF0A 
+  44      7431FF0C 
+  45 0058 107835FF 		.ascii	"\020x5\377\030\200<\377\032\201=\377\033\203>\377\035\204?\377"
+  45      18803CFF 
+  45      1A813DFF 
+  45      1B833EFF 
+  45      1D843FFF 
+  46 006c 1E8641FF 		.ascii	"\036\206A\377 \207B\377!\211C\377\"\212D\377$\214F\377&\215G"
+GAS LISTING /tmp/ccTsod4R.s 			page 2
+
+
+  46      208742FF 
+  46      218943FF 
+  46      228A44FF 
+  46      248C46FF 
+  47 0083 FF278F48 		.ascii	"\377'\217H\377(\220I\377*\222J\377+\223K\377-\225L\377.\226M"
+  47      FF289049 
+  47      FF2A924A 
+  47      FF2B934B 
+  47      FF2D954C 
+  48 009b FF359E53 		.ascii	"\3775\236S\3777\237T\3778\241U\3779\242V\377:\244W\377<\245X"
+  48      FF379F54 
+  48      FF38A155 
+  48      FF39A256 
+  48      FF3AA457 
+  49 00b3 FF3DA659 		.ascii	"\377=\246Y\377>\250Z\377?\251[\377@\252\\\377C\253]\377E\255"
+  49      FF3EA85A 
+  49      FF3FA95B 
+  49      FF40AA5C 
+  49      FF43AB5D 
+  50 00ca 5EFF47AE 		.ascii	"^\377G\256_\377J\256`\377L\257a\377N\260b\377P\261c\377R\262"
+  50      5FFF4AAE 
+  50      60FF4CAF 
+  50      61FF4EB0 
+  50      62FF50B1 
+  51 00e2 64FF54B3 		.ascii	"d\377T\263e\377V\264f\377b\272l\377d\273m\377e\274n\377g\275"
+  51      65FF56B4 
+  51      66FF62BA 
+  51      6CFF64BB 
+  51      6DFF65BC 
+  52 00fa 6FFF69BE 		.ascii	"o\377i\276p\377k\277q\377l\300q\377n\300r\377o\301s\377q\302"
+  52      70FF6BBF 
+  52      71FF6CC0 
+  52      71FF6EC0 
+  52      72FF6FC1 
+  53 0112 74FF73C3 		.ascii	"t\377s\303u\377t\304v\377v\304w\377w\305x\377y\306z\377z\307"
+  53      75FF74C4 
+  53      76FF76C4 
+  53      77FF77C5 
+  53      78FF79C6 
+  54 012a 7BFF7CC7 		.ascii	"{\377|\307|\377}\310}\377\177\311~\377\200\311\177\377\202\312"
+  54      7CFF7DC8 
+  54      7DFF7FC9 
+  54      7EFF80C9 
+  54      7FFF82CA 
+  55 013e 80FF83CA 		.ascii	"\200\377\203\312\202\377\204\313\203\377\206\314\204\377\220"
+  55      82FF84CB 
+  55      83FF86CC 
+  55      84FF90
+  56 014d D18CFF91 		.ascii	"\321\214\377\221\321\215\377\223\322\216\377\224\322\220\377"
+  56      D18DFF93 
+  56      D28EFF94 
+  56      D290FF
+  57 015c 95D391FF 		.ascii	"\225\323\221\377\226\324\222\377\230\324\223\377\231\325\224"
+  57      96D492FF 
+  57      98D493FF 
+  57      99D594
+  58 016b FF9AD595 		.ascii	"\377\232\325\225\377\233\326\226\377\234\326\227\377\235\327"
+GAS LISTING /tmp/ccTsod4R.s 			page 3
+
+
+  58      FF9BD696 
+  58      FF9CD697 
+  58      FF9DD7
+  59 017a 98FF9FD8 		.ascii	"\230\377\237\330\231\377\240\330\232\377\241\331\233\377\242"
+  59      99FFA0D8 
+  59      9AFFA1D9 
+  59      9BFFA2
+  60 0189 D99CFFA3 		.ascii	"\331\234\377\243\331\235\377\244\332\236\377\245\332\236\377"
+  60      D99DFFA4 
+  60      DA9EFFA5 
+  60      DA9EFF
+  61 0198 A6DB9FFF 		.ascii	"\246\333\237\377\247\333\240\377\250\333\241\377\251\334\242"
+  61      A7DBA0FF 
+  61      A8DBA1FF 
+  61      A9DCA2
+  62 01a7 FFA9DCA3 		.ascii	"\377\251\334\243\377\252\335\244\377\253\335\245\377\254\335"
+  62      FFAADDA4 
+  62      FFABDDA5 
+  62      FFACDD
+  63 01b6 A5FFADDE 		.ascii	"\245\377\255\336\246\377\256\336\247\377\257\336\250\377\260"
+  63      A6FFAEDE 
+  63      A7FFAFDE 
+  63      A8FFB0
+  64 01c5 DFA9FFB8 		.ascii	"\337\251\377\270\342\261\377\271\343\262\377\272\343\263\377"
+  64      E2B1FFB9 
+  64      E3B2FFBA 
+  64      E3B3FF
+  65 01d4 BAE3B3FF 		.ascii	"\272\343\263\377\273\344\264\377\274\344\265\377\275\344\266"
+  65      BBE4B4FF 
+  65      BCE4B5FF 
+  65      BDE4B6
+  66 01e3 FFBEE5B6 		.ascii	"\377\276\345\266\377\276\345\267\377\277\345\270\377\300\346"
+  66      FFBEE5B7 
+  66      FFBFE5B8 
+  66      FFC0E6
+  67 01f2 B9FFC1E6 		.ascii	"\271\377\301\346\271\377\301\346\272\377\302\347\273\377\303"
+  67      B9FFC1E6 
+  67      BAFFC2E7 
+  67      BBFFC3
+  68 0201 E7BCFFC3 		.ascii	"\347\274\377\303\347\274\377\304\347\275\377\305\350\276\377"
+  68      E7BCFFC4 
+  68      E7BDFFC5 
+  68      E8BEFF
+  69 0210 C5E8BEFF 		.ascii	"\305\350\276\377\306\350\277\377\307\351\300\377\307\351\300"
+  69      C6E8BFFF 
+  69      C7E9C0FF 
+  69      C7E9C0
+  70 021f FFC8E9C1 		.ascii	"\377\310\351\301\377\310\351\301\377\311\351\302\377\311\352"
+  70      FFC8E9C1 
+  70      FFC9E9C2 
+  70      FFC9EA
+  71 022e C2FFCAEA 		.ascii	"\302\377\312\352\303\377\312\352\304\377\313\352\304\377\313"
+  71      C3FFCAEA 
+  71      C4FFCBEA 
+  71      C4FFCB
+  72 023d EAC5FFCC 		.ascii	"\352\305\377\314\353\305\377\314\353\306\377\315\353\306\377"
+  72      EBC5FFCC 
+GAS LISTING /tmp/ccTsod4R.s 			page 4
+
+
+  72      EBC6FFCD 
+  72      EBC6FF
+  73 024c CDEBC7FF 		.ascii	"\315\353\307\377\316\353\307\377\316\354\310\377\317\354\310"
+  73      CEEBC7FF 
+  73      CEECC8FF 
+  73      CFECC8
+  74 025b FFCFECC9 		.ascii	"\377\317\354\311\377\320\354\311\377\320\354\311\377\321\354"
+  74      FFD0ECC9 
+  74      FFD0ECC9 
+  74      FFD1EC
+  75 026a CAFFD1ED 		.ascii	"\312\377\321\355\312\377\321\355\313\377\322\355\313\377\322"
+  75      CAFFD1ED 
+  75      CBFFD2ED 
+  75      CBFFD2
+  76 0279 EDCCFFD9 		.ascii	"\355\314\377\331\360\323\377\331\360\323\377\332\360\324\377"
+  76      F0D3FFD9 
+  76      F0D3FFDA 
+  76      F0D4FF
+  77 0288 DAF0D4FF 		.ascii	"\332\360\324\377\332\360\324\377\333\361\325\377\333\361\325"
+  77      DAF0D4FF 
+  77      DBF1D5FF 
+  77      DBF1D5
+  78 0297 FFDCF1D6 		.ascii	"\377\334\361\326\377\334\361\326\377\334\361\326\377\335\361"
+  78      FFDCF1D6 
+  78      FFDCF1D6 
+  78      FFDDF1
+  79 02a6 D7FFDDF1 		.ascii	"\327\377\335\361\327\377\335\362\330\377\336\362\330\377\336"
+  79      D7FFDDF2 
+  79      D8FFDEF2 
+  79      D8FFDE
+  80 02b5 F2D8FFDE 		.ascii	"\362\330\377\336\362\331\377\337\362\331\377\337\362\332\377"
+  80      F2D9FFDF 
+  80      F2D9FFDF 
+  80      F2DAFF
+  81 02c4 DFF2DAFF 		.ascii	"\337\362\332\377\340\363\332\377\340\363\333\377\340\363\333"
+  81      E0F3DAFF 
+  81      E0F3DBFF 
+  81      E0F3DB
+  82 02d3 FFE1F3DB 		.ascii	"\377\341\363\333\377\341\363\334\377\341\363\334\377\342\363"
+  82      FFE1F3DC 
+  82      FFE1F3DC 
+  82      FFE2F3
+  83 02e2 DCFFE2F4 		.ascii	"\334\377\342\364\335\377\342\364\335\377\343\364\335\377\343"
+  83      DDFFE2F4 
+  83      DDFFE3F4 
+  83      DDFFE3
+  84 02f1 F4DEFFE3 		.ascii	"\364\336\377\343\364\336\377\344\364\336\377\344\364\337\377"
+  84      F4DEFFE4 
+  84      F4DEFFE4 
+  84      F4DFFF
+  85 0300 E4F4DFFF 		.ascii	"\344\364\337\377\344\364\337\377\345\365\340\377\345\365\340"
+  85      E4F4DFFF 
+  85      E5F5E0FF 
+  85      E5F5E0
+  86 030f FFE5F5E0 		.ascii	"\377\345\365\340\377\345\365\340\377\345\365\340\377\345\365"
+  86      FFE5F5E0 
+  86      FFE5F5E0 
+GAS LISTING /tmp/ccTsod4R.s 			page 5
+
+
+  86      FFE5F5
+  87 031e E1FFE6F5 		.ascii	"\341\377\346\365\341\377\346\365\341\377\346\365\341\377\346"
+  87      E1FFE6F5 
+  87      E1FFE6F5 
+  87      E1FFE6
+  88 032d F5E1FFE6 		.ascii	"\365\341\377\346\365\342\377\346\365\342\377\347\365\342\377"
+  88      F5E2FFE6 
+  88      F5E2FFE7 
+  88      F5E2FF
+  89 033c E7F5E2FF 		.ascii	"\347\365\342\377\347\365\342\377\347\365\342\377\347\366\343"
+  89      E7F5E2FF 
+  89      E7F5E2FF 
+  89      E7F6E3
+  90 034b FFE7F6E3 		.ascii	"\377\347\366\343\377\347\366\343\377\350\366\343\377\350\366"
+  90      FFE7F6E3 
+  90      FFE8F6E3 
+  90      FFE8F6
+  91 035a E3FFE8F6 		.ascii	"\343\377\350\366\343\377\350\366\344\377\350\366\344\377\350"
+  91      E3FFE8F6 
+  91      E4FFE8F6 
+  91      E4FFE8
+  92 0369 F6E4FFE8 		.ascii	"\366\344\377\350\366\344\377\351\366\344\377\351\366\344\377"
+  92      F6E4FFE9 
+  92      F6E4FFE9 
+  92      F6E4FF
+  93 0378 E9F6E4FF 		.ascii	"\351\366\344\377\351\366\345\377\351\366\345\377\351\366\345"
+  93      E9F6E5FF 
+  93      E9F6E5FF 
+  93      E9F6E5
+  94 0387 FFE9F6E5 		.ascii	"\377\351\366\345\377\351\366\345\377\352\366\345\377\352\366"
+  94      FFE9F6E5 
+  94      FFEAF6E5 
+  94      FFEAF6
+  95 0396 E5FFEAF7 		.ascii	"\345\377\352\367\346\377\352\367\346\377\352\367\346\377\352"
+  95      E6FFEAF7 
+  95      E6FFEAF7 
+  95      E6FFEA
+  96 03a5 F7E6FFEA 		.ascii	"\367\346\377\352\367\346\377\352\367\346\377\352\367\346\377"
+  96      F7E6FFEA 
+  96      F7E6FFEA 
+  96      F7E6FF
+  97 03b4 EBF7E6FF 		.ascii	"\353\367\346\377\353\367\347\377\353\367\347\377\353\367\347"
+  97      EBF7E7FF 
+  97      EBF7E7FF 
+  97      EBF7E7
+  98 03c3 FFEBF7E7 		.ascii	"\377\353\367\347\377\353\367\347\377\353\367\347\377\353\367"
+  98      FFEBF7E7 
+  98      FFEBF7E7 
+  98      FFEBF7
+  99 03d2 E7FFEBF7 		.ascii	"\347\377\353\367\347\377\354\367\350\377\354\367\350\377\354"
+  99      E7FFECF7 
+  99      E8FFECF7 
+  99      E8FFEC
+ 100 03e1 F7E8FFEF 		.ascii	"\367\350\377\357\371\354\377\357\371\354\377\360\371\354\377"
+ 100      F9ECFFEF 
+ 100      F9ECFFF0 
+ 100      F9ECFF
+GAS LISTING /tmp/ccTsod4R.s 			page 6
+
+
+ 101 03f0 F0F9ECFF 		.ascii	"\360\371\354\377\360\371\354\377\360\371\355\377\360\371\355"
+ 101      F0F9ECFF 
+ 101      F0F9EDFF 
+ 101      F0F9ED
+ 102 03ff FFF0F9ED 		.ascii	"\377\360\371\355\377\360\371\355\377\360\371\355\377\360\371"
+ 102      FFF0F9ED 
+ 102      FFF0F9ED 
+ 102      FFF0F9
+ 103 040e EDFFF0F9 		.ascii	"\355\377\360\371\355\377\360\371\355\377\361\371\355\377\361"
+ 103      EDFFF0F9 
+ 103      EDFFF1F9 
+ 103      EDFFF1
+ 104 041d F9EDFFF1 		.ascii	"\371\355\377\361\371\356\377\361\371\356\377\361\371\356\377"
+ 104      F9EEFFF1 
+ 104      F9EEFFF1 
+ 104      F9EEFF
+ 105 042c F1F9EEFF 		.ascii	"\361\371\356\377\361\371\356\377\361\371\356\377\361\371\356"
+ 105      F1F9EEFF 
+ 105      F1F9EEFF 
+ 105      F1F9EE
+ 106 043b FFF1F9EE 		.ascii	"\377\361\371\356\377\361\371\356\377\361\371\356\377\361\371"
+ 106      FFF1F9EE 
+ 106      FFF1F9EE 
+ 106      FFF1F9
+ 107 044a EEFFF1FA 		.ascii	"\356\377\361\372\356\377\362\372\357\377\362\372\357\377\362"
+ 107      EEFFF2FA 
+ 107      EFFFF2FA 
+ 107      EFFFF2
+ 108 0459 FAEFFFF2 		.ascii	"\372\357\377\362\372\357\377\362\372\357\377\362\372\357\377"
+ 108      FAEFFFF2 
+ 108      FAEFFFF2 
+ 108      FAEFFF
+ 109 0468 F2FAEFFF 		.ascii	"\362\372\357\377\362\372\357\377\362\372\357\377\362\372\357"
+ 109      F2FAEFFF 
+ 109      F2FAEFFF 
+ 109      F2FAEF
+ 110 0477 FFF2FAEF 		.ascii	"\377\362\372\357\377\362\372\357\377\362\372\357\377\362\372"
+ 110      FFF2FAEF 
+ 110      FFF2FAEF 
+ 110      FFF2FA
+ 111 0486 EFFFF2FA 		.ascii	"\357\377\362\372\360\377\362\372\360\377\362\372\360\377\363"
+ 111      F0FFF2FA 
+ 111      F0FFF2FA 
+ 111      F0FFF3
+ 112 0495 FAF0FFF3 		.ascii	"\372\360\377\363\372\360\377\363\372\360\377\363\372\360\377"
+ 112      FAF0FFF3 
+ 112      FAF0FFF3 
+ 112      FAF0FF
+ 113 04a4 F3FAF0FF 		.ascii	"\363\372\360\377\363\372\360\377\363\372\360\377\363\372\360"
+ 113      F3FAF0FF 
+ 113      F3FAF0FF 
+ 113      F3FAF0
+ 114 04b3 FFF3FAF0 		.ascii	"\377\363\372\360\377\363\372\360\377\363\372\360\377\363\372"
+ 114      FFF3FAF0 
+ 114      FFF3FAF0 
+ 114      FFF3FA
+ 115 04c2 F0FFF3FA 		.ascii	"\360\377\363\372\360\377\363\372\361\377\363\372\361\377\363"
+GAS LISTING /tmp/ccTsod4R.s 			page 7
+
+
+ 115      F0FFF3FA 
+ 115      F1FFF3FA 
+ 115      F1FFF3
+ 116 04d1 FAF1FFF3 		.ascii	"\372\361\377\363\372\361\377\363\372\361\377\363\372\361\377"
+ 116      FAF1FFF3 
+ 116      FAF1FFF3 
+ 116      FAF1FF
+ 117 04e0 F3FAF1FF 		.ascii	"\363\372\361\377\364\372\361\377\364\372\361\377\364\372\361"
+ 117      F4FAF1FF 
+ 117      F4FAF1FF 
+ 117      F4FAF1
+ 118 04ef FFF4FAF1 		.ascii	"\377\364\372\361\377\364\372\361\377\364\372\361\377\364\372"
+ 118      FFF4FAF1 
+ 118      FFF4FAF1 
+ 118      FFF4FA
+ 119 04fe F1FFF4FA 		.ascii	"\361\377\364\372\361\377\364\372\361\377\364\372\361\377\364"
+ 119      F1FFF4FA 
+ 119      F1FFF4FA 
+ 119      F1FFF4
+ 120 050d FAF1FFF4 		.ascii	"\372\361\377\364\372\361\377\364\372\361\377\364\373\362\377"
+ 120      FAF1FFF4 
+ 120      FAF1FFF4 
+ 120      FBF2FF
+ 121 051c F4FBF2FF 		.ascii	"\364\373\362\377\364\373\362\377\364\373\362\377\364\373\362"
+ 121      F4FBF2FF 
+ 121      F4FBF2FF 
+ 121      F4FBF2
+ 122 052b FFF4FBF2 		.ascii	"\377\364\373\362\377\364\373\362\377\364\373\362\377\364\373"
+ 122      FFF4FBF2 
+ 122      FFF4FBF2 
+ 122      FFF4FB
+ 123 053a F2FFF4FB 		.ascii	"\362\377\364\373\362\377\364\373\362\377\364\373\362\377\364"
+ 123      F2FFF4FB 
+ 123      F2FFF4FB 
+ 123      F2FFF4
+ 124 0549 FBF2FFF4 		.ascii	"\373\362\377\364\373\362\377\364\373\362\377\365\373\362\377"
+ 124      FBF2FFF4 
+ 124      FBF2FFF5 
+ 124      FBF2FF
+ 125 0558 F5FBF2FF 		.ascii	"\365\373\362\377\365\373\362\377\365\373\362\377\365\373\362"
+ 125      F5FBF2FF 
+ 125      F5FBF2FF 
+ 125      F5FBF2
+ 126 0567 FFF5FBF2 		.ascii	"\377\365\373\362\377\365\373\362\377\365\373\362\377\365\373"
+ 126      FFF5FBF2 
+ 126      FFF5FBF2 
+ 126      FFF5FB
+ 127 0576 F2FFF5FB 		.ascii	"\362\377\365\373\362\377\365\373\362\377\365\373\362\377\365"
+ 127      F2FFF5FB 
+ 127      F2FFF5FB 
+ 127      F2FFF5
+ 128 0585 FBF2FFF5 		.ascii	"\373\362\377\365\373\363\377\365\373\363\377\365\373\363\377"
+ 128      FBF3FFF5 
+ 128      FBF3FFF5 
+ 128      FBF3FF
+ 129 0594 F5FBF3FF 		.ascii	"\365\373\363\377\365\373\363\377\365\373\363\377\365\373\363"
+ 129      F5FBF3FF 
+GAS LISTING /tmp/ccTsod4R.s 			page 8
+
+
+ 129      F5FBF3FF 
+ 129      F5FBF3
+ 130 05a3 FFF5FBF3 		.ascii	"\377\365\373\363\377\365\373\363\377\365\373\363\377\365\373"
+ 130      FFF5FBF3 
+ 130      FFF5FBF3 
+ 130      FFF5FB
+ 131 05b2 F3FFF5FB 		.ascii	"\363\377\365\373\363\377\365\373\363\377\365\373\363\377\365"
+ 131      F3FFF5FB 
+ 131      F3FFF5FB 
+ 131      F3FFF5
+ 132 05c1 FBF3FFF5 		.ascii	"\373\363\377\365\373\363\377\365\373\363\377\365\373\363\377"
+ 132      FBF3FFF5 
+ 132      FBF3FFF5 
+ 132      FBF3FF
+ 133 05d0 F5FBF3FF 		.ascii	"\365\373\363\377\365\373\363\377\365\373\363\377\365\373\363"
+ 133      F5FBF3FF 
+ 133      F5FBF3FF 
+ 133      F5FBF3
+ 134 05df FFF5FBF3 		.ascii	"\377\365\373\363\377\365\373\363\377\365\373\363\377\365\373"
+ 134      FFF5FBF3 
+ 134      FFF5FBF3 
+ 134      FFF5FB
+ 135 05ee F3FFF5FB 		.ascii	"\363\377\365\373\363\377\365\373\363\377\365\373\363\377\365"
+ 135      F3FFF5FB 
+ 135      F3FFF5FB 
+ 135      F3FFF5
+ 136 05fd FBF3FFF5 		.ascii	"\373\363\377\365\373\363\377\365\373\363\377\365\373\363\377"
+ 136      FBF3FFF5 
+ 136      FBF3FFF5 
+ 136      FBF3FF
+ 137 060c F6FBF3FF 		.ascii	"\366\373\363\377\366\373\363\377\366\373\363\377\366\373\363"
+ 137      F6FBF3FF 
+ 137      F6FBF3FF 
+ 137      F6FBF3
+ 138 061b FFF6FBF3 		.ascii	"\377\366\373\363\377\366\373\363\377\366\373\363\377\366\373"
+ 138      FFF6FBF3 
+ 138      FFF6FBF3 
+ 138      FFF6FB
+ 139 062a F3FFF6FB 		.ascii	"\363\377\366\373\363\377\366\373\363\377\366\373\363\377\366"
+ 139      F3FFF6FB 
+ 139      F3FFF6FB 
+ 139      F3FFF6
+ 140 0639 FBF3FFF6 		.ascii	"\373\363\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 140      FBF4FFF6 
+ 140      FBF4FFF6 
+ 140      FBF4FF
+ 141 0648 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 141      F6FBF4FF 
+ 141      F6FBF4FF 
+ 141      F6FBF4
+ 142 0657 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 142      FFF6FBF4 
+ 142      FFF6FBF4 
+ 142      FFF6FB
+ 143 0666 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 143      F4FFF6FB 
+ 143      F4FFF6FB 
+GAS LISTING /tmp/ccTsod4R.s 			page 9
+
+
+ 143      F4FFF6
+ 144 0675 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 144      FBF4FFF6 
+ 144      FBF4FFF6 
+ 144      FBF4FF
+ 145 0684 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 145      F6FBF4FF 
+ 145      F6FBF4FF 
+ 145      F6FBF4
+ 146 0693 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 146      FFF6FBF4 
+ 146      FFF6FBF4 
+ 146      FFF6FB
+ 147 06a2 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 147      F4FFF6FB 
+ 147      F4FFF6FB 
+ 147      F4FFF6
+ 148 06b1 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 148      FBF4FFF6 
+ 148      FBF4FFF6 
+ 148      FBF4FF
+ 149 06c0 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 149      F6FBF4FF 
+ 149      F6FBF4FF 
+ 149      F6FBF4
+ 150 06cf FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 150      FFF6FBF4 
+ 150      FFF6FBF4 
+ 150      FFF6FB
+ 151 06de F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 151      F4FFF6FB 
+ 151      F4FFF6FB 
+ 151      F4FFF6
+ 152 06ed FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 152      FBF4FFF6 
+ 152      FBF4FFF6 
+ 152      FBF4FF
+ 153 06fc F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 153      F6FBF4FF 
+ 153      F6FBF4FF 
+ 153      F6FBF4
+ 154 070b FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 154      FFF6FBF4 
+ 154      FFF6FBF4 
+ 154      FFF6FB
+ 155 071a F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 155      F4FFF6FB 
+ 155      F4FFF6FB 
+ 155      F4FFF6
+ 156 0729 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 156      FBF4FFF6 
+ 156      FBF4FFF6 
+ 156      FBF4FF
+ 157 0738 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 157      F6FBF4FF 
+ 157      F6FBF4FF 
+ 157      F6FBF4
+GAS LISTING /tmp/ccTsod4R.s 			page 10
+
+
+ 158 0747 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 158      FFF6FBF4 
+ 158      FFF6FBF4 
+ 158      FFF6FB
+ 159 0756 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 159      F4FFF6FB 
+ 159      F4FFF6FB 
+ 159      F4FFF6
+ 160 0765 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 160      FBF4FFF6 
+ 160      FBF4FFF6 
+ 160      FBF4FF
+ 161 0774 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 161      F6FBF4FF 
+ 161      F6FBF4FF 
+ 161      F6FBF4
+ 162 0783 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 162      FFF6FBF4 
+ 162      FFF6FBF4 
+ 162      FFF6FB
+ 163 0792 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 163      F4FFF6FB 
+ 163      F4FFF6FB 
+ 163      F4FFF6
+ 164 07a1 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 164      FBF4FFF6 
+ 164      FBF4FFF6 
+ 164      FBF4FF
+ 165 07b0 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 165      F6FBF4FF 
+ 165      F6FBF4FF 
+ 165      F6FBF4
+ 166 07bf FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 166      FFF6FBF4 
+ 166      FFF6FBF4 
+ 166      FFF6FB
+ 167 07ce F4FF     		.ascii	"\364\377"
+ 168 07d0 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 168      F6FBF4FF 
+ 168      F6FBF4FF 
+ 168      F6FBF4
+ 169 07df FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 169      FFF6FBF4 
+ 169      FFF6FBF4 
+ 169      FFF6FB
+ 170 07ee F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 170      F4FFF6FB 
+ 170      F4FFF6FB 
+ 170      F4FFF6
+ 171 07fd FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 171      FBF4FFF6 
+ 171      FBF4FFF6 
+ 171      FBF4FF
+ 172 080c F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 172      F6FBF4FF 
+ 172      F6FBF4FF 
+ 172      F6FBF4
+GAS LISTING /tmp/ccTsod4R.s 			page 11
+
+
+ 173 081b FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 173      FFF6FBF4 
+ 173      FFF6FBF4 
+ 173      FFF6FB
+ 174 082a F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 174      F4FFF6FB 
+ 174      F4FFF6FB 
+ 174      F4FFF6
+ 175 0839 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 175      FBF4FFF6 
+ 175      FBF4FFF6 
+ 175      FBF4FF
+ 176 0848 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 176      F6FBF4FF 
+ 176      F6FBF4FF 
+ 176      F6FBF4
+ 177 0857 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 177      FFF6FBF4 
+ 177      FFF6FBF4 
+ 177      FFF6FB
+ 178 0866 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 178      F4FFF6FB 
+ 178      F4FFF6FB 
+ 178      F4FFF6
+ 179 0875 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 179      FBF4FFF6 
+ 179      FBF4FFF6 
+ 179      FBF4FF
+ 180 0884 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 180      F6FBF4FF 
+ 180      F6FBF4FF 
+ 180      F6FBF4
+ 181 0893 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 181      FFF6FBF4 
+ 181      FFF6FBF4 
+ 181      FFF6FB
+ 182 08a2 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 182      F4FFF6FB 
+ 182      F4FFF6FB 
+ 182      F4FFF6
+ 183 08b1 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 183      FBF4FFF6 
+ 183      FBF4FFF6 
+ 183      FBF4FF
+ 184 08c0 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 184      F6FBF4FF 
+ 184      F6FBF4FF 
+ 184      F6FBF4
+ 185 08cf FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 185      FFF6FBF4 
+ 185      FFF6FBF4 
+ 185      FFF6FB
+ 186 08de F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 186      F4FFF6FB 
+ 186      F4FFF6FB 
+ 186      F4FFF6
+ 187 08ed FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+GAS LISTING /tmp/ccTsod4R.s 			page 12
+
+
+ 187      FBF4FFF6 
+ 187      FBF4FFF6 
+ 187      FBF4FF
+ 188 08fc F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 188      F6FBF4FF 
+ 188      F6FBF4FF 
+ 188      F6FBF4
+ 189 090b FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 189      FFF6FBF4 
+ 189      FFF6FBF4 
+ 189      FFF6FB
+ 190 091a F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 190      F4FFF6FB 
+ 190      F4FFF6FB 
+ 190      F4FFF6
+ 191 0929 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 191      FBF4FFF6 
+ 191      FBF4FFF6 
+ 191      FBF4FF
+ 192 0938 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 192      F6FBF4FF 
+ 192      F6FBF4FF 
+ 192      F6FBF4
+ 193 0947 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 193      FFF6FBF4 
+ 193      FFF6FBF4 
+ 193      FFF6FB
+ 194 0956 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 194      F4FFF6FB 
+ 194      F4FFF6FB 
+ 194      F4FFF6
+ 195 0965 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 195      FBF4FFF6 
+ 195      FBF4FFF6 
+ 195      FBF4FF
+ 196 0974 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 196      F6FBF4FF 
+ 196      F6FBF4FF 
+ 196      F6FBF4
+ 197 0983 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 197      FFF6FBF4 
+ 197      FFF6FBF4 
+ 197      FFF6FB
+ 198 0992 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 198      F4FFF6FB 
+ 198      F4FFF6FB 
+ 198      F4FFF6
+ 199 09a1 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 199      FBF4FFF6 
+ 199      FBF4FFF6 
+ 199      FBF4FF
+ 200 09b0 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 200      F6FBF4FF 
+ 200      F6FBF4FF 
+ 200      F6FBF4
+ 201 09bf FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 201      FFF6FBF4 
+GAS LISTING /tmp/ccTsod4R.s 			page 13
+
+
+ 201      FFF6FBF4 
+ 201      FFF6FB
+ 202 09ce F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 202      F4FFF6FB 
+ 202      F4FFF6FB 
+ 202      F4FFF6
+ 203 09dd FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 203      FBF4FFF6 
+ 203      FBF4FFF6 
+ 203      FBF4FF
+ 204 09ec F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 204      F6FBF4FF 
+ 204      F6FBF4FF 
+ 204      F6FBF4
+ 205 09fb FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 205      FFF6FBF4 
+ 205      FFF6FBF4 
+ 205      FFF6FB
+ 206 0a0a F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 206      F4FFF6FB 
+ 206      F4FFF6FB 
+ 206      F4FFF6
+ 207 0a19 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 207      FBF4FFF6 
+ 207      FBF4FFF6 
+ 207      FBF4FF
+ 208 0a28 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 208      F6FBF4FF 
+ 208      F6FBF4FF 
+ 208      F6FBF4
+ 209 0a37 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 209      FFF6FBF4 
+ 209      FFF6FBF4 
+ 209      FFF6FB
+ 210 0a46 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 210      F4FFF6FB 
+ 210      F4FFF6FB 
+ 210      F4FFF6
+ 211 0a55 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 211      FBF4FFF6 
+ 211      FBF4FFF6 
+ 211      FBF4FF
+ 212 0a64 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 212      F6FBF4FF 
+ 212      F6FBF4FF 
+ 212      F6FBF4
+ 213 0a73 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 213      FFF6FBF4 
+ 213      FFF6FBF4 
+ 213      FFF6FB
+ 214 0a82 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 214      F4FFF6FB 
+ 214      F4FFF6FB 
+ 214      F4FFF6
+ 215 0a91 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 215      FBF4FFF6 
+ 215      FBF4FFF6 
+GAS LISTING /tmp/ccTsod4R.s 			page 14
+
+
+ 215      FBF4FF
+ 216 0aa0 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 216      F6FBF4FF 
+ 216      F6FBF4FF 
+ 216      F6FBF4
+ 217 0aaf FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 217      FFF6FBF4 
+ 217      FFF6FBF4 
+ 217      FFF6FB
+ 218 0abe F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 218      F4FFF6FB 
+ 218      F4FFF6FB 
+ 218      F4FFF6
+ 219 0acd FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 219      FBF4FFF6 
+ 219      FBF4FFF6 
+ 219      FBF4FF
+ 220 0adc F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 220      F6FBF4FF 
+ 220      F6FBF4FF 
+ 220      F6FBF4
+ 221 0aeb FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 221      FFF6FBF4 
+ 221      FFF6FBF4 
+ 221      FFF6FB
+ 222 0afa F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 222      F4FFF6FB 
+ 222      F4FFF6FB 
+ 222      F4FFF6
+ 223 0b09 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 223      FBF4FFF6 
+ 223      FBF4FFF6 
+ 223      FBF4FF
+ 224 0b18 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 224      F6FBF4FF 
+ 224      F6FBF4FF 
+ 224      F6FBF4
+ 225 0b27 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 225      FFF6FBF4 
+ 225      FFF6FBF4 
+ 225      FFF6FB
+ 226 0b36 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 226      F4FFF6FB 
+ 226      F4FFF6FB 
+ 226      F4FFF6
+ 227 0b45 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 227      FBF4FFF6 
+ 227      FBF4FFF6 
+ 227      FBF4FF
+ 228 0b54 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 228      F6FBF4FF 
+ 228      F6FBF4FF 
+ 228      F6FBF4
+ 229 0b63 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 229      FFF6FBF4 
+ 229      FFF6FBF4 
+ 229      FFF6FB
+GAS LISTING /tmp/ccTsod4R.s 			page 15
+
+
+ 230 0b72 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 230      F4FFF6FB 
+ 230      F4FFF6FB 
+ 230      F4FFF6
+ 231 0b81 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 231      FBF4FFF6 
+ 231      FBF4FFF6 
+ 231      FBF4FF
+ 232 0b90 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 232      F6FBF4FF 
+ 232      F6FBF4FF 
+ 232      F6FBF4
+ 233 0b9f FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 233      FFF6FBF4 
+ 233      FFF6FBF4 
+ 233      FFF6FB
+ 234 0bae F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 234      F4FFF6FB 
+ 234      F4FFF6FB 
+ 234      F4FFF6
+ 235 0bbd FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 235      FBF4FFF6 
+ 235      FBF4FFF6 
+ 235      FBF4FF
+ 236 0bcc F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 236      F6FBF4FF 
+ 236      F6FBF4FF 
+ 236      F6FBF4
+ 237 0bdb FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 237      FFF6FBF4 
+ 237      FFF6FBF4 
+ 237      FFF6FB
+ 238 0bea F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 238      F4FFF6FB 
+ 238      F4FFF6FB 
+ 238      F4FFF6
+ 239 0bf9 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 239      FBF4FFF6 
+ 239      FBF4FFF6 
+ 239      FBF4FF
+ 240 0c08 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+ 240      F6FBF4FF 
+ 240      F6FBF4FF 
+ 240      F6FBF4
+ 241 0c17 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 241      FFF6FBF4 
+ 241      FFF6FBF4 
+ 241      FFF6FB
+ 242 0c26 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 242      F4FFF6FB 
+ 242      F4FFF6FB 
+ 242      F4FFF6
+ 243 0c35 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\373\364\377\366\373\364\377"
+ 243      FBF4FFF6 
+ 243      FBF4FFF6 
+ 243      FBF4FF
+ 244 0c44 F6FBF4FF 		.ascii	"\366\373\364\377\366\373\364\377\366\373\364\377\366\373\364"
+GAS LISTING /tmp/ccTsod4R.s 			page 16
+
+
+ 244      F6FBF4FF 
+ 244      F6FBF4FF 
+ 244      F6FBF4
+ 245 0c53 FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 245      FFF6FBF4 
+ 245      FFF6FBF4 
+ 245      FFF6FB
+ 246 0c62 F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377\366\373\364\377\366"
+ 246      F4FFF6FB 
+ 246      F4FFF6FB 
+ 246      F4FFF6
+ 247 0c71 FBF4FFF6 		.ascii	"\373\364\377\366\373\364\377\366\374\364\377\366\374\364\377"
+ 247      FBF4FFF6 
+ 247      FCF4FFF6 
+ 247      FCF4FF
+ 248 0c80 F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 248      F6FCF4FF 
+ 248      F6FCF4FF 
+ 248      F6FCF4
+ 249 0c8f FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 249      FFF6FCF4 
+ 249      FFF6FCF4 
+ 249      FFF6FC
+ 250 0c9e F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 250      F4FFF6FC 
+ 250      F4FFF6FC 
+ 250      F4FFF6
+ 251 0cad FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 251      FCF4FFF6 
+ 251      FCF4FFF6 
+ 251      FCF4FF
+ 252 0cbc F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 252      F6FCF4FF 
+ 252      F6FCF4FF 
+ 252      F6FCF4
+ 253 0ccb FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 253      FFF6FCF4 
+ 253      FFF6FCF4 
+ 253      FFF6FC
+ 254 0cda F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 254      F4FFF6FC 
+ 254      F4FFF6FC 
+ 254      F4FFF6
+ 255 0ce9 FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 255      FCF4FFF6 
+ 255      FCF4FFF6 
+ 255      FCF4FF
+ 256 0cf8 F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 256      F6FCF4FF 
+ 256      F6FCF4FF 
+ 256      F6FCF4
+ 257 0d07 FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 257      FFF6FCF4 
+ 257      FFF6FCF4 
+ 257      FFF6FC
+ 258 0d16 F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 258      F4FFF6FC 
+GAS LISTING /tmp/ccTsod4R.s 			page 17
+
+
+ 258      F4FFF6FC 
+ 258      F4FFF6
+ 259 0d25 FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 259      FCF4FFF6 
+ 259      FCF4FFF6 
+ 259      FCF4FF
+ 260 0d34 F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 260      F6FCF4FF 
+ 260      F6FCF4FF 
+ 260      F6FCF4
+ 261 0d43 FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 261      FFF6FCF4 
+ 261      FFF6FCF4 
+ 261      FFF6FC
+ 262 0d52 F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 262      F4FFF6FC 
+ 262      F4FFF6FC 
+ 262      F4FFF6
+ 263 0d61 FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 263      FCF4FFF6 
+ 263      FCF4FFF6 
+ 263      FCF4FF
+ 264 0d70 F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 264      F6FCF4FF 
+ 264      F6FCF4FF 
+ 264      F6FCF4
+ 265 0d7f FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 265      FFF6FCF4 
+ 265      FFF6FCF4 
+ 265      FFF6FC
+ 266 0d8e F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 266      F4FFF6FC 
+ 266      F4FFF6FC 
+ 266      F4FFF6
+ 267 0d9d FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 267      FCF4FFF6 
+ 267      FCF4FFF6 
+ 267      FCF4FF
+ 268 0dac F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 268      F6FCF4FF 
+ 268      F6FCF4FF 
+ 268      F6FCF4
+ 269 0dbb FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 269      FFF6FCF4 
+ 269      FFF6FCF4 
+ 269      FFF6FC
+ 270 0dca F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 270      F4FFF6FC 
+ 270      F4FFF6FC 
+ 270      F4FFF6
+ 271 0dd9 FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 271      FCF4FFF6 
+ 271      FCF4FFF6 
+ 271      FCF4FF
+ 272 0de8 F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 272      F6FCF4FF 
+ 272      F6FCF4FF 
+GAS LISTING /tmp/ccTsod4R.s 			page 18
+
+
+ 272      F6FCF4
+ 273 0df7 FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 273      FFF6FCF4 
+ 273      FFF6FCF4 
+ 273      FFF6FC
+ 274 0e06 F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 274      F4FFF6FC 
+ 274      F4FFF6FC 
+ 274      F4FFF6
+ 275 0e15 FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 275      FCF4FFF6 
+ 275      FCF4FFF6 
+ 275      FCF4FF
+ 276 0e24 F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 276      F6FCF4FF 
+ 276      F6FCF4FF 
+ 276      F6FCF4
+ 277 0e33 FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 277      FFF6FCF4 
+ 277      FFF6FCF4 
+ 277      FFF6FC
+ 278 0e42 F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 278      F4FFF6FC 
+ 278      F4FFF6FC 
+ 278      F4FFF6
+ 279 0e51 FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 279      FCF4FFF6 
+ 279      FCF4FFF6 
+ 279      FCF4FF
+ 280 0e60 F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 280      F6FCF4FF 
+ 280      F6FCF4FF 
+ 280      F6FCF4
+ 281 0e6f FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 281      FFF6FCF4 
+ 281      FFF6FCF4 
+ 281      FFF6FC
+ 282 0e7e F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 282      F4FFF6FC 
+ 282      F4FFF6FC 
+ 282      F4FFF6
+ 283 0e8d FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 283      FCF4FFF6 
+ 283      FCF4FFF6 
+ 283      FCF4FF
+ 284 0e9c F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 284      F6FCF4FF 
+ 284      F6FCF4FF 
+ 284      F6FCF4
+ 285 0eab FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 285      FFF6FCF4 
+ 285      FFF6FCF4 
+ 285      FFF6FC
+ 286 0eba F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 286      F4FFF6FC 
+ 286      F4FFF6FC 
+ 286      F4FFF6
+GAS LISTING /tmp/ccTsod4R.s 			page 19
+
+
+ 287 0ec9 FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 287      FCF4FFF6 
+ 287      FCF4FFF6 
+ 287      FCF4FF
+ 288 0ed8 F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 288      F6FCF4FF 
+ 288      F6FCF4FF 
+ 288      F6FCF4
+ 289 0ee7 FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 289      FFF6FCF4 
+ 289      FFF6FCF4 
+ 289      FFF6FC
+ 290 0ef6 F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 290      F4FFF6FC 
+ 290      F4FFF6FC 
+ 290      F4FFF6
+ 291 0f05 FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 291      FCF4FFF6 
+ 291      FCF4FFF6 
+ 291      FCF4FF
+ 292 0f14 F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 292      F6FCF4FF 
+ 292      F6FCF4FF 
+ 292      F6FCF4
+ 293 0f23 FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 293      FFF6FCF4 
+ 293      FFF6FCF4 
+ 293      FFF6FC
+ 294 0f32 F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 294      F4FFF6FC 
+ 294      F4FFF6FC 
+ 294      F4FFF6
+ 295 0f41 FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 295      FCF4FFF6 
+ 295      FCF4FFF6 
+ 295      FCF4FF
+ 296 0f50 F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 296      F6FCF4FF 
+ 296      F6FCF4FF 
+ 296      F6FCF4
+ 297 0f5f FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 297      FFF6FCF4 
+ 297      FFF6FCF4 
+ 297      FFF6FC
+ 298 0f6e F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 298      F4FFF6FC 
+ 298      F4FFF6FC 
+ 298      F4FFF6
+ 299 0f7d FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 299      FCF4FFF6 
+ 299      FCF4FFF6 
+ 299      FCF4FF
+ 300 0f8c F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 300      F6FCF4FF 
+ 300      F6FCF4FF 
+ 300      F6FCF4
+ 301 0f9b FFF6FCF4 		.ascii	"\377\366\374\364\377"
+GAS LISTING /tmp/ccTsod4R.s 			page 20
+
+
+ 301      FF
+ 302 0fa0 F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 302      F6FCF4FF 
+ 302      F6FCF4FF 
+ 302      F6FCF4
+ 303 0faf FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 303      FFF6FCF4 
+ 303      FFF6FCF4 
+ 303      FFF6FC
+ 304 0fbe F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377\366\374\364\377\366"
+ 304      F4FFF6FC 
+ 304      F4FFF6FC 
+ 304      F4FFF6
+ 305 0fcd FCF4FFF6 		.ascii	"\374\364\377\366\374\364\377\366\374\364\377\366\374\364\377"
+ 305      FCF4FFF6 
+ 305      FCF4FFF6 
+ 305      FCF4FF
+ 306 0fdc F6FCF4FF 		.ascii	"\366\374\364\377\366\374\364\377\366\374\364\377\366\374\364"
+ 306      F6FCF4FF 
+ 306      F6FCF4FF 
+ 306      F6FCF4
+ 307 0feb FFF6FCF4 		.ascii	"\377\366\374\364\377\366\374\364\377\366\374\364\377\366\374"
+ 307      FFF6FCF4 
+ 307      FFF6FCF4 
+ 307      FFF6FC
+ 308 0ffa F4FFF6FC 		.ascii	"\364\377\366\374\364\377\366\374\364\377"
+ 308      F4FFF6FC 
+ 308      F4FF
+ 309              		.globl	heatmap_cs_Greens_mixed
+ 310              		.section	.data.rel.local
+ 311              		.align 8
+ 312              		.type	heatmap_cs_Greens_mixed, @object
+ 313              		.size	heatmap_cs_Greens_mixed, 8
+ 314              	heatmap_cs_Greens_mixed:
+ 315 0008 00000000 		.quad	mixed
+ 315      00000000 
+ 316              		.section	.data.rel.ro.local
+ 317              		.align 16
+ 318              		.type	mixed, @object
+ 319              		.size	mixed, 16
+ 320              	mixed:
+ 321 0010 00000000 		.quad	mixed_data
+ 321      00000000 
+ 322 0018 01040000 		.quad	1025
+ 322      00000000 
+ 323              		.section	.rodata
+ 324 1004 00000000 		.align 32
+ 324      00000000 
+ 324      00000000 
+ 324      00000000 
+ 324      00000000 
+ 325              		.type	mixed_data, @object
+ 326              		.size	mixed_data, 4100
+ 327              	mixed_data:
+ 328 1020 00       		.string	""
+ 329 1021 00       		.string	""
+ 330 1022 00       		.string	""
+GAS LISTING /tmp/ccTsod4R.s 			page 21
+
+
+ 331 1023 00       		.string	""
+ 332 1024 00       		.string	""
+ 333 1025 441A00   		.string	"D\032"
+ 334 1028 00       		.string	""
+ 335 1029 441B0700 		.string	"D\033\007"
+ 336 102d 441B0E00 		.string	"D\033\016"
+ 337 1031 441B1600 		.string	"D\033\026"
+ 338 1035 441B1D00 		.string	"D\033\035"
+ 339 1039 451B2500 		.string	"E\033%"
+ 340 103d 451B2C00 		.string	"E\033,"
+ 341 1041 451B3400 		.string	"E\0334"
+ 342 1045 451B3B00 		.string	"E\033;"
+ 343 1049 461B4300 		.string	"F\033C"
+ 344 104d 461C4A00 		.string	"F\034J"
+ 345 1051 461C5200 		.string	"F\034R"
+ 346 1055 461C5900 		.string	"F\034Y"
+ 347 1059 471C6100 		.string	"G\034a"
+ 348 105d 471C6800 		.string	"G\034h"
+ 349 1061 471C7000 		.string	"G\034p"
+ 350 1065 471C7700 		.string	"G\034w"
+ 351 1069 481C7F00 		.string	"H\034\177"
+ 352 106d 481C8600 		.string	"H\034\206"
+ 353 1071 481D8D00 		.string	"H\035\215"
+ 354 1075 481D9500 		.string	"H\035\225"
+ 355 1079 491D9C00 		.string	"I\035\234"
+ 356 107d 491DA400 		.string	"I\035\244"
+ 357 1081 491DAB00 		.string	"I\035\253"
+ 358 1085 491DB300 		.string	"I\035\263"
+ 359 1089 4A1DBA00 		.string	"J\035\272"
+ 360 108d 4A1DC200 		.string	"J\035\302"
+ 361 1091 4A1DC900 		.string	"J\035\311"
+ 362 1095 4A1DD100 		.string	"J\035\321"
+ 363 1099 4B1ED800 		.string	"K\036\330"
+ 364 109d 4B1EE000 		.string	"K\036\340"
+ 365 10a1 4B1EE700 		.string	"K\036\347"
+ 366 10a5 4B1EEF00 		.string	"K\036\357"
+ 367 10a9 4C1EF600 		.string	"L\036\366"
+ 368 10ad 4C1EFE00 		.string	"L\036\376"
+ 369 10b1 4C1EFF00 		.string	"L\036\377"
+ 370 10b5 4C1EFF00 		.string	"L\036\377"
+ 371 10b9 4D1EFF00 		.string	"M\036\377"
+ 372 10bd 4D1FFF00 		.string	"M\037\377"
+ 373 10c1 4D1FFF00 		.string	"M\037\377"
+ 374 10c5 4D1FFF00 		.string	"M\037\377"
+ 375 10c9 4E1FFF00 		.string	"N\037\377"
+ 376 10cd 4E1FFF00 		.string	"N\037\377"
+ 377 10d1 4E1FFF00 		.string	"N\037\377"
+ 378 10d5 4E1FFF00 		.string	"N\037\377"
+ 379 10d9 4F1FFF00 		.string	"O\037\377"
+ 380 10dd 4F1FFF00 		.string	"O\037\377"
+ 381 10e1 4F1FFF00 		.string	"O\037\377"
+ 382 10e5 4F20FF00 		.string	"O \377"
+ 383 10e9 5020FF00 		.string	"P \377"
+ 384 10ed 5020FF00 		.string	"P \377"
+ 385 10f1 5020FF00 		.string	"P \377"
+ 386 10f5 5120FF00 		.string	"Q \377"
+ 387 10f9 5120FF00 		.string	"Q \377"
+GAS LISTING /tmp/ccTsod4R.s 			page 22
+
+
+ 388 10fd 5120FF00 		.string	"Q \377"
+ 389 1101 5120FF00 		.string	"Q \377"
+ 390 1105 5220FF00 		.string	"R \377"
+ 391 1109 5221FF00 		.string	"R!\377"
+ 392 110d 5221FF00 		.string	"R!\377"
+ 393 1111 5221FF00 		.string	"R!\377"
+ 394 1115 5321FF00 		.string	"S!\377"
+ 395 1119 5321FF00 		.string	"S!\377"
+ 396 111d 5321FF00 		.string	"S!\377"
+ 397 1121 5321FF00 		.string	"S!\377"
+ 398 1125 5C25FF00 		.string	"\\%\377"
+ 399 1129 5C25FF00 		.string	"\\%\377"
+ 400 112d 5C25FF00 		.string	"\\%\377"
+ 401 1131 5D25FF00 		.string	"]%\377"
+ 402 1135 5D25FF00 		.string	"]%\377"
+ 403 1139 5D25FF00 		.string	"]%\377"
+ 404 113d 5D25FF00 		.string	"]%\377"
+ 405 1141 5E25FF00 		.string	"^%\377"
+ 406 1145 5E26FF00 		.string	"^&\377"
+ 407 1149 5E26FF00 		.string	"^&\377"
+ 408 114d 5E26FF00 		.string	"^&\377"
+ 409 1151 5F26FF00 		.string	"_&\377"
+ 410 1155 5F26FF00 		.string	"_&\377"
+ 411 1159 5F26FF00 		.string	"_&\377"
+ 412 115d 5F26FF00 		.string	"_&\377"
+ 413 1161 6026FF00 		.string	"`&\377"
+ 414 1165 6026FF00 		.string	"`&\377"
+ 415 1169 6027FF00 		.string	"`'\377"
+ 416 116d 6027FF00 		.string	"`'\377"
+ 417 1171 6127FF00 		.string	"a'\377"
+ 418 1175 6127FF00 		.string	"a'\377"
+ 419 1179 6127FF00 		.string	"a'\377"
+ 420 117d 6127FF00 		.string	"a'\377"
+ 421 1181 6227FF00 		.string	"b'\377"
+ 422 1185 6227FF00 		.string	"b'\377"
+ 423 1189 6227FF00 		.string	"b'\377"
+ 424 118d 6327FF00 		.string	"c'\377"
+ 425 1191 6328FF00 		.string	"c(\377"
+ 426 1195 6328FF00 		.string	"c(\377"
+ 427 1199 6328FF00 		.string	"c(\377"
+ 428 119d 6428FF00 		.string	"d(\377"
+ 429 11a1 6428FF00 		.string	"d(\377"
+ 430 11a5 6428FF00 		.string	"d(\377"
+ 431 11a9 6428FF00 		.string	"d(\377"
+ 432 11ad 6528FF00 		.string	"e(\377"
+ 433 11b1 6528FF00 		.string	"e(\377"
+ 434 11b5 6529FF00 		.string	"e)\377"
+ 435 11b9 6529FF00 		.string	"e)\377"
+ 436 11bd 6629FF00 		.string	"f)\377"
+ 437 11c1 6629FF00 		.string	"f)\377"
+ 438 11c5 6629FF00 		.string	"f)\377"
+ 439 11c9 6629FF00 		.string	"f)\377"
+ 440 11cd 6729FF00 		.string	"g)\377"
+ 441 11d1 6729FF00 		.string	"g)\377"
+ 442 11d5 6729FF00 		.string	"g)\377"
+ 443 11d9 6729FF00 		.string	"g)\377"
+ 444 11dd 682AFF00 		.string	"h*\377"
+GAS LISTING /tmp/ccTsod4R.s 			page 23
+
+
+ 445 11e1 682AFF00 		.string	"h*\377"
+ 446 11e5 682AFF00 		.string	"h*\377"
+ 447 11e9 692AFF00 		.string	"i*\377"
+ 448 11ed 692AFF00 		.string	"i*\377"
+ 449 11f1 692AFF00 		.string	"i*\377"
+ 450 11f5 692AFF00 		.string	"i*\377"
+ 451 11f9 6A2AFF00 		.string	"j*\377"
+ 452 11fd 6A2AFF00 		.string	"j*\377"
+ 453 1201 6A2BFF00 		.string	"j+\377"
+ 454 1205 6A2BFF00 		.string	"j+\377"
+ 455 1209 6B2BFF00 		.string	"k+\377"
+ 456 120d 6B2BFF00 		.string	"k+\377"
+ 457 1211 6B2BFF00 		.string	"k+\377"
+ 458 1215 6B2BFF00 		.string	"k+\377"
+ 459 1219 6C2BFF00 		.string	"l+\377"
+ 460 121d 6C2BFF00 		.string	"l+\377"
+ 461 1221 6C2BFF00 		.string	"l+\377"
+ 462 1225 6D2BFF00 		.string	"m+\377"
+ 463 1229 6D2CFF00 		.string	"m,\377"
+ 464 122d 6D2CFF00 		.string	"m,\377"
+ 465 1231 6D2CFF00 		.string	"m,\377"
+ 466 1235 6D2CFF01 		.ascii	"m,\377\001m,\377\001n,\377\001n-\377\001n-\377\002n-\377\002"
+ 466      6D2CFF01 
+ 466      6E2CFF01 
+ 466      6E2DFF01 
+ 466      6E2DFF02 
+ 467 124d 6E2DFF02 		.ascii	"n-\377\002o-\377\002o-\377\003o-\377\003o.\377\003o.\377\004"
+ 467      6F2DFF02 
+ 467      6F2DFF03 
+ 467      6F2DFF03 
+ 467      6F2EFF03 
+ 468 1265 6F2EFF04 		.ascii	"o.\377\004p.\377\004p.\377\004p.\377\005p/\377\005p/\377\005"
+ 468      702EFF04 
+ 468      702EFF04 
+ 468      702EFF05 
+ 468      702FFF05 
+ 469 127d 712FFF05 		.ascii	"q/\377\005q/\377\006q/\377\006q/\377\006q/\377\007q0\377\007"
+ 469      712FFF06 
+ 469      712FFF06 
+ 469      712FFF06 
+ 469      712FFF07 
+ 470 1295 7230FF07 		.ascii	"r0\377\007r0\377\007r0\377\br0\377\br0\377\bs1\377\ts1\377\t"
+ 470      7230FF07 
+ 470      7230FF08 
+ 470      7230FF08 
+ 470      7230FF08 
+ 471 12b1 7331FF09 		.ascii	"s1\377\ts1\377\ts1\377\nt1\377\nt1\377\nt2\377\nt2\377\013t2"
+ 471      7331FF09 
+ 471      7331FF0A 
+ 471      7431FF0A 
+ 471      7431FF0A 
+ 472 12cf FF0B7432 		.ascii	"\377\013t2\377\013u2\377\013u2\377\fu3\377\fu3\377\fu3\377\f"
+ 472      FF0B7532 
+ 472      FF0B7532 
+ 472      FF0C7533 
+ 472      FF0C7533 
+ 473 12e9 7633FF0D 		.ascii	"v3\377\rv3\377\rv3\377\rv4\377\rv4\377\rw4\377\016w4\377\016"
+GAS LISTING /tmp/ccTsod4R.s 			page 24
+
+
+ 473      7633FF0D 
+ 473      7633FF0D 
+ 473      7634FF0D 
+ 473      7634FF0D 
+ 474 1305 7734FF0E 		.ascii	"w4\377\016w4\377\016w4\377\017w5\377\017x5\377\017x5\377\017"
+ 474      7734FF0E 
+ 474      7734FF0F 
+ 474      7735FF0F 
+ 474      7835FF0F 
+ 475 131d 7835FF0F 		.ascii	"x5\377\017x5\377\027~:\377\027\177;\377\027\177;\377\027\177"
+ 475      7835FF17 
+ 475      7E3AFF17 
+ 475      7F3BFF17 
+ 475      7F3BFF17 
+ 476 1332 3BFF177F 		.ascii	";\377\027\177;\377\030\177;\377\030\200;\377\030\200;\377\030"
+ 476      3BFF187F 
+ 476      3BFF1880 
+ 476      3BFF1880 
+ 476      3BFF18
+ 477 1345 803CFF18 		.ascii	"\200<\377\030\200<\377\031\200<\377\031\200<\377\031\201<\377"
+ 477      803CFF19 
+ 477      803CFF19 
+ 477      803CFF19 
+ 477      813CFF
+ 478 1358 19813CFF 		.ascii	"\031\201<\377\031\201=\377\032\201=\377\032\201=\377\032\202"
+ 478      19813DFF 
+ 478      1A813DFF 
+ 478      1A813DFF 
+ 478      1A82
+ 479 136a 3DFF1A82 		.ascii	"=\377\032\202=\377\032\202=\377\033\202>\377\033\202>\377\033"
+ 479      3DFF1A82 
+ 479      3DFF1B82 
+ 479      3EFF1B82 
+ 479      3EFF1B
+ 480 137d 833EFF1B 		.ascii	"\203>\377\033\203>\377\033\203>\377\034\203>\377\034\203>\377"
+ 480      833EFF1B 
+ 480      833EFF1C 
+ 480      833EFF1C 
+ 480      833EFF
+ 481 1390 1C833FFF 		.ascii	"\034\203?\377\034\204?\377\034\204?\377\034\204?\377\035\204"
+ 481      1C843FFF 
+ 481      1C843FFF 
+ 481      1C843FFF 
+ 481      1D84
+ 482 13a2 3FFF1D84 		.ascii	"?\377\035\204?\377\035\205@\377\035\205@\377\035\205@\377\036"
+ 482      3FFF1D85 
+ 482      40FF1D85 
+ 482      40FF1D85 
+ 482      40FF1E
+ 483 13b5 8540FF1E 		.ascii	"\205@\377\036\205@\377\036\206@\377\036\206A\377\036\206A\377"
+ 483      8540FF1E 
+ 483      8640FF1E 
+ 483      8641FF1E 
+ 483      8641FF
+ 484 13c8 1E8641FF 		.ascii	"\036\206A\377\037\206A\377\037\206A\377\037\207A\377\037\207"
+ 484      1F8641FF 
+ 484      1F8641FF 
+GAS LISTING /tmp/ccTsod4R.s 			page 25
+
+
+ 484      1F8741FF 
+ 484      1F87
+ 485 13da 41FF1F87 		.ascii	"A\377\037\207B\377 \207B\377 \207B\377 \210B\377 \210B\377 \210"
+ 485      42FF2087 
+ 485      42FF2087 
+ 485      42FF2088 
+ 485      42FF2088 
+ 486 13f2 42FF2088 		.ascii	"B\377 \210C\377!\210C\377!\211C\377!\211C\377!\211C\377!\211"
+ 486      43FF2188 
+ 486      43FF2189 
+ 486      43FF2189 
+ 486      43FF2189 
+ 487 140a 43FF2189 		.ascii	"C\377!\211D\377\"\212D\377\"\212D\377\"\212D\377\"\212D\377\""
+ 487      44FF228A 
+ 487      44FF228A 
+ 487      44FF228A 
+ 487      44FF228A 
+ 488 1421 8A44FF23 		.ascii	"\212D\377#\213D\377#\213E\377#\213E\377#\213E\377#\213E\377$"
+ 488      8B44FF23 
+ 488      8B45FF23 
+ 488      8B45FF23 
+ 488      8B45FF23 
+ 489 1439 8B45FF24 		.ascii	"\213E\377$\214E\377$\214F\377$\214F\377$\214F\377%\214F\377%"
+ 489      8C45FF24 
+ 489      8C46FF24 
+ 489      8C46FF24 
+ 489      8C46FF25 
+ 490 1451 8D46FF25 		.ascii	"\215F\377%\215F\377%\215F\377%\215G\377&\215G\377&\216G\377&"
+ 490      8D46FF25 
+ 490      8D46FF25 
+ 490      8D47FF26 
+ 490      8D47FF26 
+ 491 1469 8E47FF26 		.ascii	"\216G\377&\216G\377&\216G\377'\216G\377'\217H\377'\217H\377'"
+ 491      8E47FF26 
+ 491      8E47FF27 
+ 491      8E47FF27 
+ 491      8F48FF27 
+ 492 1481 8F48FF27 		.ascii	"\217H\377'\217H\377'\217H\377(\220H\377(\220H\377(\220I\377("
+ 492      8F48FF27 
+ 492      8F48FF28 
+ 492      9048FF28 
+ 492      9048FF28 
+ 493 1499 9049FF28 		.ascii	"\220I\377(\220I\377)\221I\377)\221I\377)\221I\377)\221J\377)"
+ 493      9049FF29 
+ 493      9149FF29 
+ 493      9149FF29 
+ 493      9149FF29 
+ 494 14b1 914AFF2A 		.ascii	"\221J\377*\222J\377*\222J\377*\222J\377*\222J\377*\222J\377+"
+ 494      924AFF2A 
+ 494      924AFF2A 
+ 494      924AFF2A 
+ 494      924AFF2A 
+ 495 14c9 934BFF2B 		.ascii	"\223K\377+\223K\377+\223K\377+\223K\377+\223K\377,\224K\377,"
+ 495      934BFF2B 
+ 495      934BFF2B 
+ 495      934BFF2B 
+ 495      934BFF2C 
+GAS LISTING /tmp/ccTsod4R.s 			page 26
+
+
+ 496 14e1 944BFF2C 		.ascii	"\224K\377,\224L\377,\224L\377,\224L\377,\225L\377-\225L\377-"
+ 496      944CFF2C 
+ 496      944CFF2C 
+ 496      944CFF2C 
+ 496      954CFF2D 
+ 497 14f9 954CFF2D 		.ascii	"\225L\377-\225M\377-\225M\377-\226M\377.\226M\377.\226M\377."
+ 497      954DFF2D 
+ 497      954DFF2D 
+ 497      964DFF2E 
+ 497      964DFF2E 
+ 498 1511 964DFF2E 		.ascii	"\226M\377.\226M\377.\227N\377/\227N\377/\227N\3775\236S\3775"
+ 498      964DFF2E 
+ 498      974EFF2F 
+ 498      974EFF2F 
+ 498      974EFF35 
+ 499 1529 9E53FF35 		.ascii	"\236S\3775\236S\3775\236S\3776\236S\3776\237T\3776\237T\3776"
+ 499      9E53FF35 
+ 499      9E53FF36 
+ 499      9E53FF36 
+ 499      9F54FF36 
+ 500 1541 9F54FF36 		.ascii	"\237T\3776\237T\3777\237T\3777\240T\3777\240T\3777\240U\3777"
+ 500      9F54FF37 
+ 500      9F54FF37 
+ 500      A054FF37 
+ 500      A054FF37 
+ 501 1559 A055FF37 		.ascii	"\240U\3777\240U\3778\241U\3778\241U\3778\241U\3778\241V\3778"
+ 501      A055FF38 
+ 501      A155FF38 
+ 501      A155FF38 
+ 501      A155FF38 
+ 502 1571 A156FF39 		.ascii	"\241V\3779\242V\3779\242V\3779\242V\3779\242V\3779\242V\3779"
+ 502      A256FF39 
+ 502      A256FF39 
+ 502      A256FF39 
+ 502      A256FF39 
+ 503 1589 A357FF3A 		.ascii	"\243W\377:\243W\377:\243W\377:\243W\377:\243W\377:\244W\377;"
+ 503      A357FF3A 
+ 503      A357FF3A 
+ 503      A357FF3A 
+ 503      A357FF3A 
+ 504 15a1 A457FF3B 		.ascii	"\244W\377;\244X\377;\244X\377;\244X\377;\245X\377;\245X\377<"
+ 504      A458FF3B 
+ 504      A458FF3B 
+ 504      A458FF3B 
+ 504      A558FF3B 
+ 505 15b9 A558FF3C 		.ascii	"\245X\377<\245Y\377<\245Y\377<\246Y\377<\246Y\377=\246Y\377="
+ 505      A559FF3C 
+ 505      A559FF3C 
+ 505      A659FF3C 
+ 505      A659FF3D 
+ 506 15d1 A659FF3D 		.ascii	"\246Y\377=\246Y\377=\247Z\377=\247Z\377=\247Z\377>\247Z\377>"
+ 506      A659FF3D 
+ 506      A75AFF3D 
+ 506      A75AFF3D 
+ 506      A75AFF3E 
+ 507 15e9 A75AFF3E 		.ascii	"\247Z\377>\250Z\377>\250[\377>\250[\377?\250[\377?\250[\377?"
+ 507      A85AFF3E 
+GAS LISTING /tmp/ccTsod4R.s 			page 27
+
+
+ 507      A85BFF3E 
+ 507      A85BFF3F 
+ 507      A85BFF3F 
+ 508 1601 A95BFF3F 		.ascii	"\251[\377?\251[\377?\251[\377?\251\\\377@\251\\\377@\252\\\377"
+ 508      A95BFF3F 
+ 508      A95BFF3F 
+ 508      A95CFF40 
+ 508      A95CFF40 
+ 509 1618 40AA5CFF 		.ascii	"@\252\\\377@\252\\\377@\252\\\377A\253\\\377A\253]\377A\253]"
+ 509      40AA5CFF 
+ 509      40AA5CFF 
+ 509      41AB5CFF 
+ 509      41AB5DFF 
+ 510 162f FF42AB5D 		.ascii	"\377B\253]\377B\253]\377B\253]\377C\253]\377C\254^\377C\254^"
+ 510      FF42AB5D 
+ 510      FF42AB5D 
+ 510      FF43AB5D 
+ 510      FF43AC5E 
+ 511 1647 FF44AC5E 		.ascii	"\377D\254^\377D\254^\377E\254^\377E\254^\377E\255^\377F\255_"
+ 511      FF44AC5E 
+ 511      FF45AC5E 
+ 511      FF45AC5E 
+ 511      FF45AD5E 
+ 512 165f FF46AD5F 		.ascii	"\377F\255_\377F\255_\377G\255_\377G\255_\377G\255_\377H\256_"
+ 512      FF46AD5F 
+ 512      FF47AD5F 
+ 512      FF47AD5F 
+ 512      FF47AD5F 
+ 513 1677 FF48AE60 		.ascii	"\377H\256`\377H\256`\377I\256`\377I\256`\377I\256`\377J\257`"
+ 513      FF48AE60 
+ 513      FF49AE60 
+ 513      FF49AE60 
+ 513      FF49AE60 
+ 514 168f FF4AAF61 		.ascii	"\377J\257a\377J\257a\377K\257a\377K\257a\377L\257a\377L\257a"
+ 514      FF4AAF61 
+ 514      FF4BAF61 
+ 514      FF4BAF61 
+ 514      FF4CAF61 
+ 515 16a7 FF4CB061 		.ascii	"\377L\260a\377M\260b\377M\260b\377M\260b\377N\260b\377N\260b"
+ 515      FF4DB062 
+ 515      FF4DB062 
+ 515      FF4DB062 
+ 515      FF4EB062 
+ 516 16bf FF4EB162 		.ascii	"\377N\261b\377O\261c\377O\261c\377O\261c\377O\261c\377P\261c"
+ 516      FF4FB163 
+ 516      FF4FB163 
+ 516      FF4FB163 
+ 516      FF4FB163 
+ 517 16d7 FF50B263 		.ascii	"\377P\262c\377P\262c\377Q\262d\377Q\262d\377Q\262d\377R\262d"
+ 517      FF50B263 
+ 517      FF51B264 
+ 517      FF51B264 
+ 517      FF51B264 
+ 518 16ef FF52B264 		.ascii	"\377R\262d\377R\263d\377S\263e\377S\263e\377S\263e\377T\263e"
+ 518      FF52B364 
+ 518      FF53B365 
+ 518      FF53B365 
+GAS LISTING /tmp/ccTsod4R.s 			page 28
+
+
+ 518      FF53B365 
+ 519 1707 FF54B365 		.ascii	"\377T\263e\377T\264e\377U\264e\377U\264f\377U\264f\377V\264f"
+ 519      FF54B465 
+ 519      FF55B465 
+ 519      FF55B466 
+ 519      FF55B466 
+ 520 171f FF56B466 		.ascii	"\377V\264f\377`\271k\377a\272k\377a\272l\377a\272l\377b\272l"
+ 520      FF60B96B 
+ 520      FF61BA6B 
+ 520      FF61BA6C 
+ 520      FF61BA6C 
+ 521 1737 FF62BA6C 		.ascii	"\377b\272l\377b\272l\377c\273l\377c\273l\377c\273m\377d\273m"
+ 521      FF62BA6C 
+ 521      FF63BB6C 
+ 521      FF63BB6C 
+ 521      FF63BB6D 
+ 522 174f FF64BB6D 		.ascii	"\377d\273m\377d\273m\377d\274m\377e\274m\377e\274n\377e\274n"
+ 522      FF64BB6D 
+ 522      FF64BC6D 
+ 522      FF65BC6D 
+ 522      FF65BC6E 
+ 523 1767 FF66BC6E 		.ascii	"\377f\274n\377f\274n\377f\274n\377g\275n\377g\275o\377g\275o"
+ 523      FF66BC6E 
+ 523      FF66BC6E 
+ 523      FF67BD6E 
+ 523      FF67BD6F 
+ 524 177f FF67BD6F 		.ascii	"\377g\275o\377h\275o\377h\275o\377h\276o\377i\276p\377i\276p"
+ 524      FF68BD6F 
+ 524      FF68BD6F 
+ 524      FF68BE6F 
+ 524      FF69BE70 
+ 525 1797 FF69BE70 		.ascii	"\377i\276p\377j\276p\377j\276p\377j\276p\377j\277p\377k\277q"
+ 525      FF6ABE70 
+ 525      FF6ABE70 
+ 525      FF6ABE70 
+ 525      FF6ABF70 
+ 526 17af FF6BBF71 		.ascii	"\377k\277q\377k\277q\377l\277q\377l\277q\377l\300q\377m\300r"
+ 526      FF6BBF71 
+ 526      FF6CBF71 
+ 526      FF6CBF71 
+ 526      FF6CC071 
+ 527 17c7 FF6DC072 		.ascii	"\377m\300r\377m\300r\377m\300r\377n\300r\377n\301r\377n\301s"
+ 527      FF6DC072 
+ 527      FF6DC072 
+ 527      FF6EC072 
+ 527      FF6EC172 
+ 528 17df FF6FC173 		.ascii	"\377o\301s\377o\301s\377o\301s\377o\301s\377"
+ 528      FF6FC173 
+ 528      FF6FC173 
+ 528      FF6FC173 
+ 528      FF
+ 529 17f0 70C173FF 		.ascii	"p\301s\377p\302t\377p\302t\377q\302t\377q\302t\377q\302t\377"
+ 529      70C274FF 
+ 529      70C274FF 
+ 529      71C274FF 
+ 529      71C274FF 
+ 530 1808 71C274FF 		.ascii	"q\302t\377r\303u\377r\303u\377r\303u\377s\303u\377s\303u\377"
+GAS LISTING /tmp/ccTsod4R.s 			page 29
+
+
+ 530      72C375FF 
+ 530      72C375FF 
+ 530      72C375FF 
+ 530      73C375FF 
+ 531 1820 73C375FF 		.ascii	"s\303u\377s\304u\377t\304v\377t\304v\377t\304v\377u\304v\377"
+ 531      73C475FF 
+ 531      74C476FF 
+ 531      74C476FF 
+ 531      74C476FF 
+ 532 1838 75C477FF 		.ascii	"u\304w\377u\304w\377v\304w\377v\305w\377v\305x\377v\305x\377"
+ 532      75C477FF 
+ 532      76C477FF 
+ 532      76C577FF 
+ 532      76C578FF 
+ 533 1850 77C578FF 		.ascii	"w\305x\377w\305x\377w\305x\377x\305y\377x\305y\377x\306y\377"
+ 533      77C578FF 
+ 533      77C578FF 
+ 533      78C579FF 
+ 533      78C579FF 
+ 534 1868 79C679FF 		.ascii	"y\306y\377y\306z\377y\306z\377y\306z\377z\306z\377z\306z\377"
+ 534      79C67AFF 
+ 534      79C67AFF 
+ 534      79C67AFF 
+ 534      7AC67AFF 
+ 535 1880 7AC77BFF 		.ascii	"z\307{\377{\307{\377{\307{\377{\307{\377{\307|\377|\307|\377"
+ 535      7BC77BFF 
+ 535      7BC77BFF 
+ 535      7BC77BFF 
+ 535      7BC77CFF 
+ 536 1898 7CC77CFF 		.ascii	"|\307|\377|\307|\377}\310}\377}\310}\377}\310}\377}\310}\377"
+ 536      7CC77CFF 
+ 536      7DC87DFF 
+ 536      7DC87DFF 
+ 536      7DC87DFF 
+ 537 18b0 7EC87DFF 		.ascii	"~\310}\377~\310~\377~\310~\377\177\310~\377\177\311~\377\177"
+ 537      7EC87EFF 
+ 537      7EC87EFF 
+ 537      7FC87EFF 
+ 537      7FC97EFF 
+ 538 18c5 C97FFF7F 		.ascii	"\311\177\377\177\311\177\377\200\311\177\377\200\311\177\377"
+ 538      C97FFF80 
+ 538      C97FFF80 
+ 538      C97FFF
+ 539 18d4 80C97FFF 		.ascii	"\200\311\177\377\201\311\200\377\201\312\200\377\201\312\200"
+ 539      81C980FF 
+ 539      81CA80FF 
+ 539      81CA80
+ 540 18e3 FF81CA80 		.ascii	"\377\201\312\200\377\202\312\201\377\202\312\201\377\202\312"
+ 540      FF82CA81 
+ 540      FF82CA81 
+ 540      FF82CA
+ 541 18f2 81FF83CA 		.ascii	"\201\377\203\312\201\377\203\312\202\377\203\313\202\377\203"
+ 541      81FF83CA 
+ 541      82FF83CB 
+ 541      82FF83
+ 542 1901 CB82FF84 		.ascii	"\313\202\377\204\313\202\377\204\313\202\377\204\313\203\377"
+ 542      CB82FF84 
+GAS LISTING /tmp/ccTsod4R.s 			page 30
+
+
+ 542      CB82FF84 
+ 542      CB83FF
+ 543 1910 85CB83FF 		.ascii	"\205\313\203\377\205\313\203\377\205\314\203\377\205\314\204"
+ 543      85CB83FF 
+ 543      85CC83FF 
+ 543      85CC84
+ 544 191f FF86CC84 		.ascii	"\377\206\314\204\377\217\320\213\377\217\320\214\377\220\320"
+ 544      FF8FD08B 
+ 544      FF8FD08C 
+ 544      FF90D0
+ 545 192e 8CFF90D0 		.ascii	"\214\377\220\320\214\377\220\321\214\377\220\321\215\377\221"
+ 545      8CFF90D1 
+ 545      8CFF90D1 
+ 545      8DFF91
+ 546 193d D18DFF91 		.ascii	"\321\215\377\221\321\215\377\221\321\215\377\222\321\216\377"
+ 546      D18DFF91 
+ 546      D18DFF92 
+ 546      D18EFF
+ 547 194c 92D18EFF 		.ascii	"\222\321\216\377\222\322\216\377\222\322\216\377\223\322\217"
+ 547      92D28EFF 
+ 547      92D28EFF 
+ 547      93D28F
+ 548 195b FF93D28F 		.ascii	"\377\223\322\217\377\223\322\217\377\223\322\217\377\224\322"
+ 548      FF93D28F 
+ 548      FF93D28F 
+ 548      FF94D2
+ 549 196a 8FFF94D2 		.ascii	"\217\377\224\322\220\377\224\323\220\377\225\323\220\377\225"
+ 549      90FF94D3 
+ 549      90FF95D3 
+ 549      90FF95
+ 550 1979 D390FF95 		.ascii	"\323\220\377\225\323\221\377\225\323\221\377\226\323\221\377"
+ 550      D391FF95 
+ 550      D391FF96 
+ 550      D391FF
+ 551 1988 96D391FF 		.ascii	"\226\323\221\377\226\324\222\377\226\324\222\377\227\324\222"
+ 551      96D492FF 
+ 551      96D492FF 
+ 551      97D492
+ 552 1997 FF97D492 		.ascii	"\377\227\324\222\377\227\324\222\377\230\324\223\377\230\324"
+ 552      FF97D492 
+ 552      FF98D493 
+ 552      FF98D4
+ 553 19a6 93FF98D4 		.ascii	"\223\377\230\324\223\377\230\325\223\377\231\325\224\377\231"
+ 553      93FF98D5 
+ 553      93FF99D5 
+ 553      94FF99
+ 554 19b5 D594FF99 		.ascii	"\325\224\377\231\325\224\377\231\325\224\377\232\325\225\377"
+ 554      D594FF99 
+ 554      D594FF9A 
+ 554      D595FF
+ 555 19c4 9AD595FF 		.ascii	"\232\325\225\377\232\325\225\377\233\326\225\377\233\326\226"
+ 555      9AD595FF 
+ 555      9BD695FF 
+ 555      9BD696
+ 556 19d3 FF9BD696 		.ascii	"\377\233\326\226\377\233\326\226\377\234\326\226\377\234\326"
+ 556      FF9BD696 
+ 556      FF9CD696 
+GAS LISTING /tmp/ccTsod4R.s 			page 31
+
+
+ 556      FF9CD6
+ 557 19e2 96FF9CD6 		.ascii	"\226\377\234\326\227\377\234\327\227\377\235\327\227\377\235"
+ 557      97FF9CD7 
+ 557      97FF9DD7 
+ 557      97FF9D
+ 558 19f1 D797FF9D 		.ascii	"\327\227\377\235\327\230\377\236\327\230\377\236\327\230\377"
+ 558      D798FF9E 
+ 558      D798FF9E 
+ 558      D798FF
+ 559 1a00 9ED798FF 		.ascii	"\236\327\230\377\236\327\231\377\237\330\231\377\237\330\231"
+ 559      9ED799FF 
+ 559      9FD899FF 
+ 559      9FD899
+ 560 1a0f FF9FD899 		.ascii	"\377\237\330\231\377\237\330\232\377\240\330\232\377\240\330"
+ 560      FF9FD89A 
+ 560      FFA0D89A 
+ 560      FFA0D8
+ 561 1a1e 9AFFA0D8 		.ascii	"\232\377\240\330\232\377\240\331\232\377\241\331\233\377\241"
+ 561      9AFFA0D9 
+ 561      9AFFA1D9 
+ 561      9BFFA1
+ 562 1a2d D99BFFA1 		.ascii	"\331\233\377\241\331\233\377\241\331\233\377\242\331\234\377"
+ 562      D99BFFA1 
+ 562      D99BFFA2 
+ 562      D99CFF
+ 563 1a3c A2D99CFF 		.ascii	"\242\331\234\377\242\331\234\377\242\331\234\377\243\331\235"
+ 563      A2D99CFF 
+ 563      A2D99CFF 
+ 563      A3D99D
+ 564 1a4b FFA3DA9D 		.ascii	"\377\243\332\235\377\243\332\235\377\243\332\235\377\244\332"
+ 564      FFA3DA9D 
+ 564      FFA3DA9D 
+ 564      FFA4DA
+ 565 1a5a 9DFFA4DA 		.ascii	"\235\377\244\332\236\377\244\332\236\377\244\332\236\377\245"
+ 565      9EFFA4DA 
+ 565      9EFFA4DA 
+ 565      9EFFA5
+ 566 1a69 DA9EFFA5 		.ascii	"\332\236\377\245\332\237\377\245\332\237\377\245\333\237\377"
+ 566      DA9FFFA5 
+ 566      DA9FFFA5 
+ 566      DB9FFF
+ 567 1a78 A6DB9FFF 		.ascii	"\246\333\237\377\246\333\237\377\246\333\240\377\246\333\240"
+ 567      A6DB9FFF 
+ 567      A6DBA0FF 
+ 567      A6DBA0
+ 568 1a87 FFA7DBA0 		.ascii	"\377\247\333\240\377\247\333\240\377\247\333\241\377\247\333"
+ 568      FFA7DBA0 
+ 568      FFA7DBA1 
+ 568      FFA7DB
+ 569 1a96 A1FFA8DB 		.ascii	"\241\377\250\333\241\377\250\334\241\377\250\334\242\377\250"
+ 569      A1FFA8DC 
+ 569      A1FFA8DC 
+ 569      A2FFA8
+ 570 1aa5 DCA2FFA9 		.ascii	"\334\242\377\251\334\242\377\251\334\242\377\251\334\242\377"
+ 570      DCA2FFA9 
+ 570      DCA2FFA9 
+ 570      DCA2FF
+GAS LISTING /tmp/ccTsod4R.s 			page 32
+
+
+ 571 1ab4 A9DCA3FF 		.ascii	"\251\334\243\377\252\334\243\377\252\334\243\377\252\334\243"
+ 571      AADCA3FF 
+ 571      AADCA3FF 
+ 571      AADCA3
+ 572 1ac3 FFAADDA4 		.ascii	"\377\252\335\244\377\252\335\244\377\253\335\244\377\253\335"
+ 572      FFAADDA4 
+ 572      FFABDDA4 
+ 572      FFABDD
+ 573 1ad2 A4FFABDD 		.ascii	"\244\377\253\335\245\377\253\335\245\377\254\335\245\377\254"
+ 573      A5FFABDD 
+ 573      A5FFACDD 
+ 573      A5FFAC
+ 574 1ae1 DDA5FFAC 		.ascii	"\335\245\377\254\335\245\377\254\335\246\377\255\336\246\377"
+ 574      DDA5FFAC 
+ 574      DDA6FFAD 
+ 574      DEA6FF
+ 575 1af0 ADDEA6FF 		.ascii	"\255\336\246\377\255\336\246\377\255\336\247\377\256\336\247"
+ 575      ADDEA6FF 
+ 575      ADDEA7FF 
+ 575      AEDEA7
+ 576 1aff FFAEDEA7 		.ascii	"\377\256\336\247\377\256\336\247\377\256\336\250\377\257\336"
+ 576      FFAEDEA7 
+ 576      FFAEDEA8 
+ 576      FFAFDE
+ 577 1b0e A8FFAFDE 		.ascii	"\250\377\257\336\250\377\257\337\250\377\257\337\250\377\257"
+ 577      A8FFAFDF 
+ 577      A8FFAFDF 
+ 577      A8FFAF
+ 578 1b1d DFA9FFB0 		.ascii	"\337\251\377\260\337\251\377\270\342\261\377\270\342\261\377"
+ 578      DFA9FFB8 
+ 578      E2B1FFB8 
+ 578      E2B1FF
+ 579 1b2c B8E2B1FF 		.ascii	"\270\342\261\377\270\342\261\377\271\343\261\377\271\343\262"
+ 579      B8E2B1FF 
+ 579      B9E3B1FF 
+ 579      B9E3B2
+ 580 1b3b FFB9E3B2 		.ascii	"\377\271\343\262\377\271\343\262\377\271\343\262\377\272\343"
+ 580      FFB9E3B2 
+ 580      FFB9E3B2 
+ 580      FFBAE3
+ 581 1b4a B3FFBAE3 		.ascii	"\263\377\272\343\263\377\272\343\263\377\272\343\263\377\273"
+ 581      B3FFBAE3 
+ 581      B3FFBAE3 
+ 581      B3FFBB
+ 582 1b59 E3B4FFBB 		.ascii	"\343\264\377\273\344\264\377\273\344\264\377\273\344\264\377"
+ 582      E4B4FFBB 
+ 582      E4B4FFBB 
+ 582      E4B4FF
+ 583 1b68 BCE4B4FF 		.ascii	"\274\344\264\377\274\344\265\377\274\344\265\377\274\344\265"
+ 583      BCE4B5FF 
+ 583      BCE4B5FF 
+ 583      BCE4B5
+ 584 1b77 FFBDE4B5 		.ascii	"\377\275\344\265\377\275\344\266\377\275\344\266\377\275\345"
+ 584      FFBDE4B6 
+ 584      FFBDE4B6 
+ 584      FFBDE5
+ 585 1b86 B6FFBDE5 		.ascii	"\266\377\275\345\266\377\276\345\267\377\276\345\267\377\276"
+GAS LISTING /tmp/ccTsod4R.s 			page 33
+
+
+ 585      B6FFBEE5 
+ 585      B7FFBEE5 
+ 585      B7FFBE
+ 586 1b95 E5B7FFBE 		.ascii	"\345\267\377\276\345\267\377\277\345\270\377\277\345\270\377"
+ 586      E5B7FFBF 
+ 586      E5B8FFBF 
+ 586      E5B8FF
+ 587 1ba4 BFE5B8FF 		.ascii	"\277\345\270\377\277\345\270\377\300\346\270\377\300\346\271"
+ 587      BFE5B8FF 
+ 587      C0E6B8FF 
+ 587      C0E6B9
+ 588 1bb3 FFC0E6B9 		.ascii	"\377\300\346\271\377\300\346\271\377\300\346\271\377\301\346"
+ 588      FFC0E6B9 
+ 588      FFC0E6B9 
+ 588      FFC1E6
+ 589 1bc2 BAFFC1E6 		.ascii	"\272\377\301\346\272\377\301\346\272\377\301\346\272\377\302"
+ 589      BAFFC1E6 
+ 589      BAFFC1E6 
+ 589      BAFFC2
+ 590 1bd1 E6BBFFC2 		.ascii	"\346\273\377\302\347\273\377\302\347\273\377\302\347\273\377"
+ 590      E7BBFFC2 
+ 590      E7BBFFC2 
+ 590      E7BBFF
+ 591 1be0 C3E7BBFF 		.ascii	"\303\347\273\377\303\347\274\377\303\347\274\377\303\347\274"
+ 591      C3E7BCFF 
+ 591      C3E7BCFF 
+ 591      C3E7BC
+ 592 1bef FFC3E7BC 		.ascii	"\377\303\347\274\377\304\347\275\377\304\347\275\377\304\350"
+ 592      FFC4E7BD 
+ 592      FFC4E7BD 
+ 592      FFC4E8
+ 593 1bfe BDFFC4E8 		.ascii	"\275\377\304\350\275\377\305\350\276\377\305\350\276\377\305"
+ 593      BDFFC5E8 
+ 593      BEFFC5E8 
+ 593      BEFFC5
+ 594 1c0d E8BEFFC5 		.ascii	"\350\276\377\305\350\276\377\306\350\277\377\306\350\277\377"
+ 594      E8BEFFC6 
+ 594      E8BFFFC6 
+ 594      E8BFFF
+ 595 1c1c C6E8BFFF 		.ascii	"\306\350\277\377\306\350\277\377\306\351\277\377\307\351\300"
+ 595      C6E8BFFF 
+ 595      C6E9BFFF 
+ 595      C7E9C0
+ 596 1c2b FFC7E9C0 		.ascii	"\377\307\351\300\377\307\351\300\377\307\351\300\377\307\351"
+ 596      FFC7E9C0 
+ 596      FFC7E9C0 
+ 596      FFC7E9
+ 597 1c3a C0FFC8E9 		.ascii	"\300\377\310\351\301\377\310\351\301\377\310\351\301\377\310"
+ 597      C1FFC8E9 
+ 597      C1FFC8E9 
+ 597      C1FFC8
+ 598 1c49 E9C1FFC8 		.ascii	"\351\301\377\310\351\301\377\311\351\302\377\311\351\302\377"
+ 598      E9C1FFC9 
+ 598      E9C2FFC9 
+ 598      E9C2FF
+ 599 1c58 C9E9C2FF 		.ascii	"\311\351\302\377\311\352\302\377\311\352\302\377\312\352\303"
+ 599      C9EAC2FF 
+GAS LISTING /tmp/ccTsod4R.s 			page 34
+
+
+ 599      C9EAC2FF 
+ 599      CAEAC3
+ 600 1c67 FFCAEAC3 		.ascii	"\377\312\352\303\377\312\352\303\377\312\352\303\377\312\352"
+ 600      FFCAEAC3 
+ 600      FFCAEAC3 
+ 600      FFCAEA
+ 601 1c76 C3FFCBEA 		.ascii	"\303\377\313\352\304\377\313\352\304\377\313\352\304\377\313"
+ 601      C4FFCBEA 
+ 601      C4FFCBEA 
+ 601      C4FFCB
+ 602 1c85 EAC4FFCB 		.ascii	"\352\304\377\313\352\304\377\313\352\305\377\314\353\305\377"
+ 602      EAC4FFCB 
+ 602      EAC5FFCC 
+ 602      EBC5FF
+ 603 1c94 CCEBC5FF 		.ascii	"\314\353\305\377\314\353\305\377\314\353\305\377\314\353\306"
+ 603      CCEBC5FF 
+ 603      CCEBC5FF 
+ 603      CCEBC6
+ 604 1ca3 FFCDEBC6 		.ascii	"\377\315\353\306\377\315\353\306\377\315\353\306\377\315\353"
+ 604      FFCDEBC6 
+ 604      FFCDEBC6 
+ 604      FFCDEB
+ 605 1cb2 C6FFCDEB 		.ascii	"\306\377\315\353\307\377\316\353\307\377\316\353\307\377\316"
+ 605      C7FFCEEB 
+ 605      C7FFCEEB 
+ 605      C7FFCE
+ 606 1cc1 EBC7FFCE 		.ascii	"\353\307\377\316\353\307\377\316\354\310\377\317\354\310\377"
+ 606      EBC7FFCE 
+ 606      ECC8FFCF 
+ 606      ECC8FF
+ 607 1cd0 CFECC8FF 		.ascii	"\317\354\310\377\317\354\310\377\317\354\310\377\317\354\311"
+ 607      CFECC8FF 
+ 607      CFECC8FF 
+ 607      CFECC9
+ 608 1cdf FFCFECC9 		.ascii	"\377\317\354\311\377\320\354\311\377\320\354\311\377\320\354"
+ 608      FFD0ECC9 
+ 608      FFD0ECC9 
+ 608      FFD0EC
+ 609 1cee C9FFD0EC 		.ascii	"\311\377\320\354\312\377\320\354\312\377\321\354\312\377\321"
+ 609      CAFFD0EC 
+ 609      CAFFD1EC 
+ 609      CAFFD1
+ 610 1cfd EDCAFFD1 		.ascii	"\355\312\377\321\355\312\377\321\355\313\377\321\355\313\377"
+ 610      EDCAFFD1 
+ 610      EDCBFFD1 
+ 610      EDCBFF
+ 611 1d0c D2EDCBFF 		.ascii	"\322\355\313\377\322\355\313\377\322\355\313\377\322\355\314"
+ 611      D2EDCBFF 
+ 611      D2EDCBFF 
+ 611      D2EDCC
+ 612 1d1b FFD2EDCC 		.ascii	"\377\322\355\314\377\322\355\314\377\331\360\323\377\331\360"
+ 612      FFD2EDCC 
+ 612      FFD9F0D3 
+ 612      FFD9F0
+ 613 1d2a D3FFD9F0 		.ascii	"\323\377\331\360\323\377\331\360\323\377\331\360\323\377\332"
+ 613      D3FFD9F0 
+ 613      D3FFD9F0 
+GAS LISTING /tmp/ccTsod4R.s 			page 35
+
+
+ 613      D3FFDA
+ 614 1d39 F0D4FFDA 		.ascii	"\360\324\377\332\360\324\377\332\360\324\377\332\360\324\377"
+ 614      F0D4FFDA 
+ 614      F0D4FFDA 
+ 614      F0D4FF
+ 615 1d48 DAF0D4FF 		.ascii	"\332\360\324\377\333\360\325\377\333\361\325\377\333\361\325"
+ 615      DBF0D5FF 
+ 615      DBF1D5FF 
+ 615      DBF1D5
+ 616 1d57 FFDBF1D5 		.ascii	"\377\333\361\325\377\333\361\325\377\333\361\326\377\334\361"
+ 616      FFDBF1D5 
+ 616      FFDBF1D6 
+ 616      FFDCF1
+ 617 1d66 D6FFDCF1 		.ascii	"\326\377\334\361\326\377\334\361\326\377\334\361\326\377\334"
+ 617      D6FFDCF1 
+ 617      D6FFDCF1 
+ 617      D6FFDC
+ 618 1d75 F1D7FFDD 		.ascii	"\361\327\377\335\361\327\377\335\361\327\377\335\361\327\377"
+ 618      F1D7FFDD 
+ 618      F1D7FFDD 
+ 618      F1D7FF
+ 619 1d84 DDF1D7FF 		.ascii	"\335\361\327\377\335\362\330\377\336\362\330\377\336\362\330"
+ 619      DDF2D8FF 
+ 619      DEF2D8FF 
+ 619      DEF2D8
+ 620 1d93 FFDEF2D8 		.ascii	"\377\336\362\330\377\336\362\330\377\336\362\331\377\336\362"
+ 620      FFDEF2D8 
+ 620      FFDEF2D9 
+ 620      FFDEF2
+ 621 1da2 D9FFDFF2 		.ascii	"\331\377\337\362\331\377\337\362\331\377\337\362\331\377\337"
+ 621      D9FFDFF2 
+ 621      D9FFDFF2 
+ 621      D9FFDF
+ 622 1db1 F2DAFFDF 		.ascii	"\362\332\377\337\362\332\377\340\362\332\377\340\363\332\377"
+ 622      F2DAFFE0 
+ 622      F2DAFFE0 
+ 622      F3DAFF
+ 623 1dc0 E0F3DAFF 		.ascii	"\340\363\332\377\340\363\333\377\340\363\333\377\340\363\333"
+ 623      E0F3DBFF 
+ 623      E0F3DBFF 
+ 623      E0F3DB
+ 624 1dcf FFE1F3DB 		.ascii	"\377\341\363\333\377\341\363\333\377\341\363\334\377\341\363"
+ 624      FFE1F3DB 
+ 624      FFE1F3DC 
+ 624      FFE1F3
+ 625 1dde DCFFE1F3 		.ascii	"\334\377\341\363\334\377\342\363\334\377\342\363\334\377\342"
+ 625      DCFFE2F3 
+ 625      DCFFE2F3 
+ 625      DCFFE2
+ 626 1ded F3DDFFE2 		.ascii	"\363\335\377\342\364\335\377\342\364\335\377\342\364\335\377"
+ 626      F4DDFFE2 
+ 626      F4DDFFE2 
+ 626      F4DDFF
+ 627 1dfc E3F4DDFF 		.ascii	"\343\364\335\377\343\364\336\377\343\364\336\377\343\364\336"
+ 627      E3F4DEFF 
+ 627      E3F4DEFF 
+ 627      E3F4DE
+GAS LISTING /tmp/ccTsod4R.s 			page 36
+
+
+ 628 1e0b FFE3F4DE 		.ascii	"\377\343\364\336\377\344\364\336\377\344\364\337\377\344\364"
+ 628      FFE4F4DE 
+ 628      FFE4F4DF 
+ 628      FFE4F4
+ 629 1e1a DFFFE4F4 		.ascii	"\337\377\344\364\337\377\344\364\337\377\344\365\337\377\345"
+ 629      DFFFE4F4 
+ 629      DFFFE4F5 
+ 629      DFFFE5
+ 630 1e29 F5E0FFE5 		.ascii	"\365\340\377\345\365\340\377\345\365\340\377\345\365\340\377"
+ 630      F5E0FFE5 
+ 630      F5E0FFE5 
+ 630      F5E0FF
+ 631 1e38 E5F5E0FF 		.ascii	"\345\365\340\377\345\365\340\377\345\365\340\377\345\365\341"
+ 631      E5F5E0FF 
+ 631      E5F5E0FF 
+ 631      E5F5E1
+ 632 1e47 FFE6F5E1 		.ascii	"\377\346\365\341\377\346\365\341\377\346\365\341\377\346\365"
+ 632      FFE6F5E1 
+ 632      FFE6F5E1 
+ 632      FFE6F5
+ 633 1e56 E1FFE6F5 		.ascii	"\341\377\346\365\341\377\346\365\341\377\346\365\341\377\346"
+ 633      E1FFE6F5 
+ 633      E1FFE6F5 
+ 633      E1FFE6
+ 634 1e65 F5E2FFE6 		.ascii	"\365\342\377\346\365\342\377\347\365\342\377\347\365\342\377"
+ 634      F5E2FFE7 
+ 634      F5E2FFE7 
+ 634      F5E2FF
+ 635 1e74 E7F5E2FF 		.ascii	"\347\365\342\377\347\365\342\377\347\365\342\377\347\366\342"
+ 635      E7F5E2FF 
+ 635      E7F5E2FF 
+ 635      E7F6E2
+ 636 1e83 FFE7F6E3 		.ascii	"\377\347\366\343\377\347\366\343\377\347\366\343\377\350\366"
+ 636      FFE7F6E3 
+ 636      FFE7F6E3 
+ 636      FFE8F6
+ 637 1e92 E3FFE8F6 		.ascii	"\343\377\350\366\343\377\350\366\343\377\350\366\343\377\350"
+ 637      E3FFE8F6 
+ 637      E3FFE8F6 
+ 637      E3FFE8
+ 638 1ea1 F6E4FFE8 		.ascii	"\366\344\377\350\366\344\377\350\366\344\377\350\366\344\377"
+ 638      F6E4FFE8 
+ 638      F6E4FFE8 
+ 638      F6E4FF
+ 639 1eb0 E9F6E4FF 		.ascii	"\351\366\344\377\351\366\344\377\351\366\344\377\351\366\344"
+ 639      E9F6E4FF 
+ 639      E9F6E4FF 
+ 639      E9F6E4
+ 640 1ebf FFE9F6E5 		.ascii	"\377\351\366\345\377\351\366\345\377\351\366\345\377\351\366"
+ 640      FFE9F6E5 
+ 640      FFE9F6E5 
+ 640      FFE9F6
+ 641 1ece E5FFE9F6 		.ascii	"\345\377\351\366\345\377\352\366\345\377\352\366\345\377\352"
+ 641      E5FFEAF6 
+ 641      E5FFEAF6 
+ 641      E5FFEA
+ 642 1edd F7E5FFEA 		.ascii	"\367\345\377\352\367\346\377\352\367\346\377\352\367\346\377"
+GAS LISTING /tmp/ccTsod4R.s 			page 37
+
+
+ 642      F7E6FFEA 
+ 642      F7E6FFEA 
+ 642      F7E6FF
+ 643 1eec EAF7E6FF 		.ascii	"\352\367\346\377\352\367\346\377\352\367\346\377\353\367\346"
+ 643      EAF7E6FF 
+ 643      EAF7E6FF 
+ 643      EBF7E6
+ 644 1efb FFEBF7E7 		.ascii	"\377\353\367\347\377\353\367\347\377\353\367\347\377\353\367"
+ 644      FFEBF7E7 
+ 644      FFEBF7E7 
+ 644      FFEBF7
+ 645 1f0a E7FFEBF7 		.ascii	"\347\377\353\367\347\377\353\367\347\377\353\367\347\377\353"
+ 645      E7FFEBF7 
+ 645      E7FFEBF7 
+ 645      E7FFEB
+ 646 1f19 F7E7FFEC 		.ascii	"\367\347\377\354\367\350\377\354\367\350\377\357\371\354\377"
+ 646      F7E8FFEC 
+ 646      F7E8FFEF 
+ 646      F9ECFF
+ 647 1f28 EFF9ECFF 		.ascii	"\357\371\354\377\360\371\354\377\360\371\354\377\360\371\355"
+ 647      F0F9ECFF 
+ 647      F0F9ECFF 
+ 647      F0F9ED
+ 648 1f37 FFF0F9ED 		.ascii	"\377\360\371\355\377\360\371\355\377\360\371\355\377\360\371"
+ 648      FFF0F9ED 
+ 648      FFF0F9ED 
+ 648      FFF0F9
+ 649 1f46 EDFFF0F9 		.ascii	"\355\377\360\371\355\377\361\371\355\377\361\371\355\377\361"
+ 649      EDFFF1F9 
+ 649      EDFFF1F9 
+ 649      EDFFF1
+ 650 1f55 F9EEFFF1 		.ascii	"\371\356\377\361\371\356\377\361\371\356\377\361\371\356\377"
+ 650      F9EEFFF1 
+ 650      F9EEFFF1 
+ 650      F9EEFF
+ 651 1f64 F1F9EEFF 		.ascii	"\361\371\356\377\361\371\356\377\361\371\356\377\362\372\357"
+ 651      F1F9EEFF 
+ 651      F1F9EEFF 
+ 651      F2FAEF
+ 652 1f73 FFF2FAEF 		.ascii	"\377\362\372\357\377\362\372\357\377\362\372\357\377\362\372"
+ 652      FFF2FAEF 
+ 652      FFF2FAEF 
+ 652      FFF2FA
+ 653 1f82 EFFFF2FA 		.ascii	"\357\377\362\372\357\377\362\372\357\377\362\372\357\377\362"
+ 653      EFFFF2FA 
+ 653      EFFFF2FA 
+ 653      EFFFF2
+ 654 1f91 FAF0FFF3 		.ascii	"\372\360\377\363\372\360\377\363\372\360\377\363\372\360\377"
+ 654      FAF0FFF3 
+ 654      FAF0FFF3 
+ 654      FAF0FF
+ 655 1fa0 F3FAF0FF 		.ascii	"\363\372\360\377\363\372\360\377\363\372\360\377\363\372\361"
+ 655      F3FAF0FF 
+ 655      F3FAF0FF 
+ 655      F3FAF1
+ 656 1faf FFF3FAF1 		.ascii	"\377\363\372\361\377\363\372\361\377\364\372\361\377\364\372"
+ 656      FFF3FAF1 
+GAS LISTING /tmp/ccTsod4R.s 			page 38
+
+
+ 656      FFF4FAF1 
+ 656      FFF4FA
+ 657 1fbe F1FF     		.ascii	"\361\377"
+ 658 1fc0 F4FAF1FF 		.ascii	"\364\372\361\377\364\372\361\377\364\372\361\377\364\373\362"
+ 658      F4FAF1FF 
+ 658      F4FAF1FF 
+ 658      F4FBF2
+ 659 1fcf FFF4FBF2 		.ascii	"\377\364\373\362\377\364\373\362\377\364\373\362\377\365\373"
+ 659      FFF4FBF2 
+ 659      FFF4FBF2 
+ 659      FFF5FB
+ 660 1fde F2FFF5FB 		.ascii	"\362\377\365\373\362\377\365\373\362\377\365\373\363\377\365"
+ 660      F2FFF5FB 
+ 660      F2FFF5FB 
+ 660      F3FFF5
+ 661 1fed FBF3FFF5 		.ascii	"\373\363\377\365\373\363\377\365\373\363\377\365\373\363\377"
+ 661      FBF3FFF5 
+ 661      FBF3FFF5 
+ 661      FBF3FF
+ 662 1ffc F5FBF3FF 		.ascii	"\365\373\363\377\366\373\363\377\366\373\363\377\366\373\364"
+ 662      F6FBF3FF 
+ 662      F6FBF3FF 
+ 662      F6FBF4
+ 663 200b FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 663      FFF6FBF4 
+ 663      FFF6FBF4 
+ 663      FFF6FB
+ 664 201a F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377"
+ 664      F4FFF6FB 
+ 664      F4FF
+ 665              		.globl	heatmap_cs_Greens_soft
+ 666              		.section	.data.rel.local
+ 667              		.align 8
+ 668              		.type	heatmap_cs_Greens_soft, @object
+ 669              		.size	heatmap_cs_Greens_soft, 8
+ 670              	heatmap_cs_Greens_soft:
+ 671 0010 00000000 		.quad	soft
+ 671      00000000 
+ 672              		.section	.data.rel.ro.local
+ 673              		.align 16
+ 674              		.type	soft, @object
+ 675              		.size	soft, 16
+ 676              	soft:
+ 677 0020 00000000 		.quad	soft_data
+ 677      00000000 
+ 678 0028 01040000 		.quad	1025
+ 678      00000000 
+ 679              		.section	.rodata
+ 680 2024 00000000 		.align 32
+ 680      00000000 
+ 680      00000000 
+ 680      00000000 
+ 680      00000000 
+ 681              		.type	soft_data, @object
+ 682              		.size	soft_data, 4100
+ 683              	soft_data:
+ 684 2040 00       		.string	""
+GAS LISTING /tmp/ccTsod4R.s 			page 39
+
+
+ 685 2041 00       		.string	""
+ 686 2042 00       		.string	""
+ 687 2043 00       		.string	""
+ 688 2044 00       		.string	""
+ 689 2045 441A00   		.string	"D\032"
+ 690 2048 00       		.string	""
+ 691 2049 441B0700 		.string	"D\033\007"
+ 692 204d 441B0E00 		.string	"D\033\016"
+ 693 2051 441B1600 		.string	"D\033\026"
+ 694 2055 451B1D00 		.string	"E\033\035"
+ 695 2059 451B2500 		.string	"E\033%"
+ 696 205d 451B2C00 		.string	"E\033,"
+ 697 2061 461B3400 		.string	"F\0334"
+ 698 2065 461C3B00 		.string	"F\034;"
+ 699 2069 461C4300 		.string	"F\034C"
+ 700 206d 471C4A00 		.string	"G\034J"
+ 701 2071 471C5200 		.string	"G\034R"
+ 702 2075 471C5900 		.string	"G\034Y"
+ 703 2079 481C6100 		.string	"H\034a"
+ 704 207d 481C6800 		.string	"H\034h"
+ 705 2081 481C7000 		.string	"H\034p"
+ 706 2085 481D7700 		.string	"H\035w"
+ 707 2089 491D7F00 		.string	"I\035\177"
+ 708 208d 491D8600 		.string	"I\035\206"
+ 709 2091 491D8D00 		.string	"I\035\215"
+ 710 2095 4A1D9500 		.string	"J\035\225"
+ 711 2099 4A1D9C00 		.string	"J\035\234"
+ 712 209d 4A1DA400 		.string	"J\035\244"
+ 713 20a1 4B1EAB00 		.string	"K\036\253"
+ 714 20a5 4B1EB300 		.string	"K\036\263"
+ 715 20a9 4B1EBA00 		.string	"K\036\272"
+ 716 20ad 4C1EC200 		.string	"L\036\302"
+ 717 20b1 4C1EC900 		.string	"L\036\311"
+ 718 20b5 4C1ED100 		.string	"L\036\321"
+ 719 20b9 4D1ED800 		.string	"M\036\330"
+ 720 20bd 4D1EE000 		.string	"M\036\340"
+ 721 20c1 4D1FE700 		.string	"M\037\347"
+ 722 20c5 4D1FEF00 		.string	"M\037\357"
+ 723 20c9 4E1FF600 		.string	"N\037\366"
+ 724 20cd 4E1FFE00 		.string	"N\037\376"
+ 725 20d1 4E1FFF00 		.string	"N\037\377"
+ 726 20d5 4F1FFF00 		.string	"O\037\377"
+ 727 20d9 4F1FFF00 		.string	"O\037\377"
+ 728 20dd 4F20FF00 		.string	"O \377"
+ 729 20e1 5020FF00 		.string	"P \377"
+ 730 20e5 5020FF00 		.string	"P \377"
+ 731 20e9 5020FF00 		.string	"P \377"
+ 732 20ed 5120FF00 		.string	"Q \377"
+ 733 20f1 5120FF00 		.string	"Q \377"
+ 734 20f5 5120FF00 		.string	"Q \377"
+ 735 20f9 5220FF00 		.string	"R \377"
+ 736 20fd 5221FF00 		.string	"R!\377"
+ 737 2101 5221FF00 		.string	"R!\377"
+ 738 2105 5221FF00 		.string	"R!\377"
+ 739 2109 5321FF00 		.string	"S!\377"
+ 740 210d 5321FF00 		.string	"S!\377"
+ 741 2111 5321FF00 		.string	"S!\377"
+GAS LISTING /tmp/ccTsod4R.s 			page 40
+
+
+ 742 2115 5421FF00 		.string	"T!\377"
+ 743 2119 5422FF00 		.string	"T\"\377"
+ 744 211d 5422FF00 		.string	"T\"\377"
+ 745 2121 5522FF00 		.string	"U\"\377"
+ 746 2125 5522FF00 		.string	"U\"\377"
+ 747 2129 5522FF00 		.string	"U\"\377"
+ 748 212d 5622FF00 		.string	"V\"\377"
+ 749 2131 5622FF00 		.string	"V\"\377"
+ 750 2135 5622FF00 		.string	"V\"\377"
+ 751 2139 5723FF00 		.string	"W#\377"
+ 752 213d 5723FF00 		.string	"W#\377"
+ 753 2141 5723FF00 		.string	"W#\377"
+ 754 2145 5823FF00 		.string	"X#\377"
+ 755 2149 5823FF00 		.string	"X#\377"
+ 756 214d 5823FF00 		.string	"X#\377"
+ 757 2151 5923FF00 		.string	"Y#\377"
+ 758 2155 5924FF00 		.string	"Y$\377"
+ 759 2159 5924FF00 		.string	"Y$\377"
+ 760 215d 5A24FF00 		.string	"Z$\377"
+ 761 2161 5A24FF00 		.string	"Z$\377"
+ 762 2165 5A24FF00 		.string	"Z$\377"
+ 763 2169 5A24FF00 		.string	"Z$\377"
+ 764 216d 5B24FF00 		.string	"[$\377"
+ 765 2171 5B24FF00 		.string	"[$\377"
+ 766 2175 5B25FF00 		.string	"[%\377"
+ 767 2179 5C25FF00 		.string	"\\%\377"
+ 768 217d 5C25FF00 		.string	"\\%\377"
+ 769 2181 5C25FF00 		.string	"\\%\377"
+ 770 2185 5D25FF00 		.string	"]%\377"
+ 771 2189 5D25FF00 		.string	"]%\377"
+ 772 218d 5D25FF00 		.string	"]%\377"
+ 773 2191 5E26FF00 		.string	"^&\377"
+ 774 2195 5E26FF00 		.string	"^&\377"
+ 775 2199 5E26FF00 		.string	"^&\377"
+ 776 219d 5F26FF00 		.string	"_&\377"
+ 777 21a1 5F26FF00 		.string	"_&\377"
+ 778 21a5 5F26FF00 		.string	"_&\377"
+ 779 21a9 6026FF00 		.string	"`&\377"
+ 780 21ad 6026FF00 		.string	"`&\377"
+ 781 21b1 6027FF00 		.string	"`'\377"
+ 782 21b5 6127FF00 		.string	"a'\377"
+ 783 21b9 6127FF00 		.string	"a'\377"
+ 784 21bd 6127FF00 		.string	"a'\377"
+ 785 21c1 6227FF00 		.string	"b'\377"
+ 786 21c5 6227FF00 		.string	"b'\377"
+ 787 21c9 6227FF00 		.string	"b'\377"
+ 788 21cd 6328FF00 		.string	"c(\377"
+ 789 21d1 6328FF00 		.string	"c(\377"
+ 790 21d5 6328FF00 		.string	"c(\377"
+ 791 21d9 6428FF00 		.string	"d(\377"
+ 792 21dd 6428FF00 		.string	"d(\377"
+ 793 21e1 6428FF00 		.string	"d(\377"
+ 794 21e5 6528FF00 		.string	"e(\377"
+ 795 21e9 6528FF00 		.string	"e(\377"
+ 796 21ed 6529FF00 		.string	"e)\377"
+ 797 21f1 6629FF00 		.string	"f)\377"
+ 798 21f5 6629FF00 		.string	"f)\377"
+GAS LISTING /tmp/ccTsod4R.s 			page 41
+
+
+ 799 21f9 6629FF00 		.string	"f)\377"
+ 800 21fd 6729FF00 		.string	"g)\377"
+ 801 2201 6729FF00 		.string	"g)\377"
+ 802 2205 6729FF00 		.string	"g)\377"
+ 803 2209 682AFF00 		.string	"h*\377"
+ 804 220d 682AFF00 		.string	"h*\377"
+ 805 2211 682AFF00 		.string	"h*\377"
+ 806 2215 692AFF00 		.string	"i*\377"
+ 807 2219 692AFF00 		.string	"i*\377"
+ 808 221d 692AFF00 		.string	"i*\377"
+ 809 2221 6A2AFF00 		.string	"j*\377"
+ 810 2225 6A2AFF00 		.string	"j*\377"
+ 811 2229 6A2BFF00 		.string	"j+\377"
+ 812 222d 6B2BFF00 		.string	"k+\377"
+ 813 2231 6B2BFF00 		.string	"k+\377"
+ 814 2235 6B2BFF00 		.string	"k+\377"
+ 815 2239 6C2BFF00 		.string	"l+\377"
+ 816 223d 6C2BFF00 		.string	"l+\377"
+ 817 2241 6C2BFF00 		.string	"l+\377"
+ 818 2245 6D2BFF00 		.string	"m+\377"
+ 819 2249 6D2CFF00 		.string	"m,\377"
+ 820 224d 6D2CFF00 		.string	"m,\377"
+ 821 2251 6D2CFF01 		.ascii	"m,\377\001m,\377\001n,\377\001n-\377\002n-\377\002n-\377\002"
+ 821      6D2CFF01 
+ 821      6E2CFF01 
+ 821      6E2DFF02 
+ 821      6E2DFF02 
+ 822 2269 6F2DFF03 		.ascii	"o-\377\003o-\377\003o.\377\003o.\377\004o.\377\004p.\377\004"
+ 822      6F2DFF03 
+ 822      6F2EFF03 
+ 822      6F2EFF04 
+ 822      6F2EFF04 
+ 823 2281 702EFF05 		.ascii	"p.\377\005p/\377\005p/\377\005q/\377\006q/\377\006q/\377\006"
+ 823      702FFF05 
+ 823      702FFF05 
+ 823      712FFF06 
+ 823      712FFF06 
+ 824 2299 7130FF07 		.ascii	"q0\377\007r0\377\007r0\377\007r0\377\br0\377\br0\377\bs1\377"
+ 824      7230FF07 
+ 824      7230FF07 
+ 824      7230FF08 
+ 824      7230FF08 
+ 825 22b4 097331FF 		.ascii	"\ts1\377\ts1\377\ts1\377\nt1\377\nt2\377\nt2\377\013t2\377\013"
+ 825      097331FF 
+ 825      097331FF 
+ 825      0A7431FF 
+ 825      0A7432FF 
+ 826 22d1 7532FF0B 		.ascii	"u2\377\013u2\377\fu3\377\fu3\377\fv3\377\rv3\377\rv3\377\rv4"
+ 826      7532FF0C 
+ 826      7533FF0C 
+ 826      7533FF0C 
+ 826      7633FF0D 
+ 827 22ef FF0E7634 		.ascii	"\377\016v4\377\016w4\377\016w4\377\017w4\377\017w5\377\017x5"
+ 827      FF0E7734 
+ 827      FF0E7734 
+ 827      FF0F7734 
+ 827      FF0F7735 
+GAS LISTING /tmp/ccTsod4R.s 			page 42
+
+
+ 828 2307 FF107835 		.ascii	"\377\020x5\377\020x5\377\020x5\377\020y6\377\021y6\377\021y6"
+ 828      FF107835 
+ 828      FF107835 
+ 828      FF107936 
+ 828      FF117936 
+ 829 231f FF117936 		.ascii	"\377\021y6\377\021y6\377\022z6\377\022z7\377\022z7\377\023z7"
+ 829      FF117936 
+ 829      FF127A36 
+ 829      FF127A37 
+ 829      FF127A37 
+ 830 2337 FF137B37 		.ascii	"\377\023{7\377\023{7\377\023{8\377\024{8\377\024|8\377\024|8"
+ 830      FF137B37 
+ 830      FF137B38 
+ 830      FF147B38 
+ 830      FF147C38 
+ 831 234f FF147C38 		.ascii	"\377\024|8\377\025|9\377\025}9\377\025}9\377\025}9\377\026}9"
+ 831      FF157C39 
+ 831      FF157D39 
+ 831      FF157D39 
+ 831      FF157D39 
+ 832 2367 FF167D3A 		.ascii	"\377\026}:\377\026~:\377\026~:\377\027~:\377\027~:\377\027\177"
+ 832      FF167E3A 
+ 832      FF167E3A 
+ 832      FF177E3A 
+ 832      FF177E3A 
+ 833 237e 3BFF177F 		.ascii	";\377\027\177;\377\030\177;\377\030\177;\377\030\200;\377\030"
+ 833      3BFF187F 
+ 833      3BFF187F 
+ 833      3BFF1880 
+ 833      3BFF18
+ 834 2391 803CFF19 		.ascii	"\200<\377\031\200<\377\031\200<\377\031\201<\377\031\201<\377"
+ 834      803CFF19 
+ 834      803CFF19 
+ 834      813CFF19 
+ 834      813CFF
+ 835 23a4 1A813DFF 		.ascii	"\032\201=\377\032\201=\377\032\201=\377\032\202=\377\033\202"
+ 835      1A813DFF 
+ 835      1A813DFF 
+ 835      1A823DFF 
+ 835      1B82
+ 836 23b6 3DFF1B82 		.ascii	"=\377\033\202>\377\033\202>\377\033\203>\377\033\203>\377\034"
+ 836      3EFF1B82 
+ 836      3EFF1B83 
+ 836      3EFF1B83 
+ 836      3EFF1C
+ 837 23c9 833EFF1C 		.ascii	"\203>\377\034\203?\377\034\204?\377\034\204?\377\035\204?\377"
+ 837      833FFF1C 
+ 837      843FFF1C 
+ 837      843FFF1D 
+ 837      843FFF
+ 838 23dc 1D843FFF 		.ascii	"\035\204?\377\035\205@\377\035\205@\377\035\205@\377\036\205"
+ 838      1D8540FF 
+ 838      1D8540FF 
+ 838      1D8540FF 
+ 838      1E85
+ 839 23ee 40FF1E85 		.ascii	"@\377\036\205@\377\036\206A\377\036\206A\377\037\206A\377\037"
+ 839      40FF1E86 
+GAS LISTING /tmp/ccTsod4R.s 			page 43
+
+
+ 839      41FF1E86 
+ 839      41FF1F86 
+ 839      41FF1F
+ 840 2401 8641FF1F 		.ascii	"\206A\377\037\207A\377\037\207B\377\037\207B\377 \207B\377 \210"
+ 840      8741FF1F 
+ 840      8742FF1F 
+ 840      8742FF20 
+ 840      8742FF20 
+ 841 2416 42FF2088 		.ascii	"B\377 \210B\377 \210C\377!\210C\377!\211C\377!\211C\377!\211"
+ 841      42FF2088 
+ 841      43FF2188 
+ 841      43FF2189 
+ 841      43FF2189 
+ 842 242e 43FF2189 		.ascii	"C\377!\211D\377\"\212D\377\"\212D\377\"\212D\377\"\212D\377#"
+ 842      44FF228A 
+ 842      44FF228A 
+ 842      44FF228A 
+ 842      44FF228A 
+ 843 2445 8B44FF23 		.ascii	"\213D\377#\213E\377#\213E\377#\213E\377$\213E\377$\214E\377$"
+ 843      8B45FF23 
+ 843      8B45FF23 
+ 843      8B45FF24 
+ 843      8B45FF24 
+ 844 245d 8C46FF24 		.ascii	"\214F\377$\214F\377%\214F\377%\215F\377%\215F\377%\215G\377&"
+ 844      8C46FF25 
+ 844      8C46FF25 
+ 844      8D46FF25 
+ 844      8D46FF25 
+ 845 2475 8D47FF26 		.ascii	"\215G\377&\216G\377&\216G\377&\216G\377'\216G\377'\217H\377'"
+ 845      8E47FF26 
+ 845      8E47FF26 
+ 845      8E47FF27 
+ 845      8E47FF27 
+ 846 248d 8F48FF27 		.ascii	"\217H\377'\217H\377(\217H\377(\220H\377(\220I\377(\220I\377)"
+ 846      8F48FF28 
+ 846      8F48FF28 
+ 846      9048FF28 
+ 846      9049FF28 
+ 847 24a5 9049FF29 		.ascii	"\220I\377)\221I\377)\221I\377)\221I\377)\221J\377*\222J\377*"
+ 847      9149FF29 
+ 847      9149FF29 
+ 847      9149FF29 
+ 847      914AFF2A 
+ 848 24bd 924AFF2A 		.ascii	"\222J\377*\222J\377*\222J\377+\223K\377+\223K\377+\223K\377+"
+ 848      924AFF2A 
+ 848      924AFF2B 
+ 848      934BFF2B 
+ 848      934BFF2B 
+ 849 24d5 934BFF2C 		.ascii	"\223K\377,\224K\377,\224L\377,\224L\377,\224L\377-\225L\377-"
+ 849      944BFF2C 
+ 849      944CFF2C 
+ 849      944CFF2C 
+ 849      944CFF2D 
+ 850 24ed 954CFF2D 		.ascii	"\225L\377-\225L\377-\225M\377.\226M\377.\226M\377.\226M\377."
+ 850      954CFF2D 
+ 850      954DFF2E 
+ 850      964DFF2E 
+GAS LISTING /tmp/ccTsod4R.s 			page 44
+
+
+ 850      964DFF2E 
+ 851 2505 964DFF2E 		.ascii	"\226M\377.\227N\377/\227N\377/\227N\377/\227N\377/\230N\3770"
+ 851      974EFF2F 
+ 851      974EFF2F 
+ 851      974EFF2F 
+ 851      974EFF2F 
+ 852 251d 984FFF30 		.ascii	"\230O\3770\230O\3770\230O\3770\231O\3771\231O\3771\231O\3771"
+ 852      984FFF30 
+ 852      984FFF30 
+ 852      994FFF31 
+ 852      994FFF31 
+ 853 2535 9950FF31 		.ascii	"\231P\3771\232P\3772\232P\3772\232P\3772\232P\3772\233Q\3772"
+ 853      9A50FF32 
+ 853      9A50FF32 
+ 853      9A50FF32 
+ 853      9A50FF32 
+ 854 254d 9B51FF33 		.ascii	"\233Q\3773\233Q\3773\233Q\3773\234Q\3773\234R\3774\234R\3774"
+ 854      9B51FF33 
+ 854      9B51FF33 
+ 854      9C51FF33 
+ 854      9C52FF34 
+ 855 2565 9C52FF34 		.ascii	"\234R\3774\235R\3774\235R\3775\235R\3775\235S\3775\236S\3775"
+ 855      9D52FF34 
+ 855      9D52FF35 
+ 855      9D52FF35 
+ 855      9D53FF35 
+ 856 257d 9E53FF35 		.ascii	"\236S\3775\236S\3776\236S\3776\237T\3776\237T\3776\237T\3777"
+ 856      9E53FF36 
+ 856      9E53FF36 
+ 856      9F54FF36 
+ 856      9F54FF36 
+ 857 2595 9F54FF37 		.ascii	"\237T\3777\240T\3777\240U\3777\240U\3778\240U\3778\241U\3778"
+ 857      A054FF37 
+ 857      A055FF37 
+ 857      A055FF38 
+ 857      A055FF38 
+ 858 25ad A155FF38 		.ascii	"\241U\3778\241U\3778\241V\3779\242V\3779\242V\3779\242V\3779"
+ 858      A155FF38 
+ 858      A156FF39 
+ 858      A256FF39 
+ 858      A256FF39 
+ 859 25c5 A256FF3A 		.ascii	"\242V\377:\243W\377:\243W\377:\243W\377:\243W\377:\244W\377;"
+ 859      A357FF3A 
+ 859      A357FF3A 
+ 859      A357FF3A 
+ 859      A357FF3A 
+ 860 25dd A458FF3B 		.ascii	"\244X\377;\244X\377;\244X\377;\245X\377<\245X\377<\245X\377<"
+ 860      A458FF3B 
+ 860      A458FF3B 
+ 860      A558FF3C 
+ 860      A558FF3C 
+ 861 25f5 A559FF3C 		.ascii	"\245Y\377<\246Y\377<\246Y\377=\246Y\377=\246Y\377=\247Z\377="
+ 861      A659FF3C 
+ 861      A659FF3D 
+ 861      A659FF3D 
+ 861      A659FF3D 
+ 862 260d A75AFF3E 		.ascii	"\247Z\377>\247Z\377>\247Z\377>\250Z\377>\250[\377>\250[\377?"
+GAS LISTING /tmp/ccTsod4R.s 			page 45
+
+
+ 862      A75AFF3E 
+ 862      A75AFF3E 
+ 862      A85AFF3E 
+ 862      A85BFF3E 
+ 863 2625 A85BFF3F 		.ascii	"\250[\377?\251[\377?\251[\377?\251\\\377@\251\\\377@\252\\\377"
+ 863      A95BFF3F 
+ 863      A95BFF3F 
+ 863      A95CFF40 
+ 863      A95CFF40 
+ 864 263c 40AA5CFF 		.ascii	"@\252\\\377@\252\\\377A\253\\\377A\253]\377A\253]\377B\253]\377"
+ 864      40AA5CFF 
+ 864      41AB5CFF 
+ 864      41AB5DFF 
+ 864      41AB5DFF 
+ 865 2654 42AB5DFF 		.ascii	"B\253]\377C\253]\377C\254^\377D\254^\377D\254^\377E\254^\377"
+ 865      43AB5DFF 
+ 865      43AC5EFF 
+ 865      44AC5EFF 
+ 865      44AC5EFF 
+ 866 266c 45AC5EFF 		.ascii	"E\254^\377F\255_\377F\255_\377F\255_\377G\255_\377G\255_\377"
+ 866      46AD5FFF 
+ 866      46AD5FFF 
+ 866      46AD5FFF 
+ 866      47AD5FFF 
+ 867 2684 48AE5FFF 		.ascii	"H\256_\377H\256`\377I\256`\377I\256`\377J\256`\377J\257`\377"
+ 867      48AE60FF 
+ 867      49AE60FF 
+ 867      49AE60FF 
+ 867      4AAE60FF 
+ 868 269c 4AAF61FF 		.ascii	"J\257a\377K\257a\377K\257a\377L\257a\377L\260a\377M\260b\377"
+ 868      4BAF61FF 
+ 868      4BAF61FF 
+ 868      4CAF61FF 
+ 868      4CB061FF 
+ 869 26b4 4DB062FF 		.ascii	"M\260b\377M\260b\377N\260b\377N\261b\377O\261c\377O\261c\377"
+ 869      4DB062FF 
+ 869      4EB062FF 
+ 869      4EB162FF 
+ 869      4FB163FF 
+ 870 26cc 50B163FF 		.ascii	"P\261c\377P\261c\377P\262c\377Q\262c\377Q\262d\377R\262d\377"
+ 870      50B163FF 
+ 870      50B263FF 
+ 870      51B263FF 
+ 870      51B264FF 
+ 871 26e4 52B264FF 		.ascii	"R\262d\377R\262d\377S\263d\377S\263e\377T\263e\377T\263e\377"
+ 871      52B264FF 
+ 871      53B364FF 
+ 871      53B365FF 
+ 871      54B365FF 
+ 872 26fc 54B365FF 		.ascii	"T\263e\377U\264e\377U\264f\377V\264f\377V\264f\377V\264f\377"
+ 872      55B465FF 
+ 872      55B466FF 
+ 872      56B466FF 
+ 872      56B466FF 
+ 873 2714 57B566FF 		.ascii	"W\265f\377W\265g\377X\265g\377X\265g\377X\265g\377Y\266g\377"
+ 873      57B567FF 
+ 873      58B567FF 
+GAS LISTING /tmp/ccTsod4R.s 			page 46
+
+
+ 873      58B567FF 
+ 873      58B567FF 
+ 874 272c 59B668FF 		.ascii	"Y\266h\377Z\266h\377Z\266h\377Z\266h\377[\267h\377[\267h\377"
+ 874      5AB668FF 
+ 874      5AB668FF 
+ 874      5AB668FF 
+ 874      5BB768FF 
+ 875 2744 5CB769FF 		.ascii	"\\\267i\377\\\267i\377\\\267i\377]\270i\377]\270i\377^\270j\377"
+ 875      5CB769FF 
+ 875      5CB769FF 
+ 875      5DB869FF 
+ 875      5DB869FF 
+ 876 275c 5EB86AFF 		.ascii	"^\270j\377^\270j\377_\271j\377_\271j\377`\271k\377`\271k\377"
+ 876      5EB86AFF 
+ 876      5FB96AFF 
+ 876      5FB96AFF 
+ 876      60B96BFF 
+ 877 2774 60B96BFF 		.ascii	"`\271k\377a\272k\377a\272k\377a\272l\377b\272l\377b\272l\377"
+ 877      61BA6BFF 
+ 877      61BA6BFF 
+ 877      61BA6CFF 
+ 877      62BA6CFF 
+ 878 278c 63BA6CFF 		.ascii	"c\272l\377c\273l\377c\273m\377d\273m\377d\273m\377d\273m\377"
+ 878      63BB6CFF 
+ 878      63BB6DFF 
+ 878      64BB6DFF 
+ 878      64BB6DFF 
+ 879 27a4 65BC6DFF 		.ascii	"e\274m\377e\274n\377f\274n\377f\274n\377f\274n\377g\275n\377"
+ 879      65BC6EFF 
+ 879      66BC6EFF 
+ 879      66BC6EFF 
+ 879      66BC6EFF 
+ 880 27bc 67BD6FFF 		.ascii	"g\275o\377g\275o\377h\275o\377h\275o\377i\276o\377i\276p\377"
+ 880      67BD6FFF 
+ 880      68BD6FFF 
+ 880      68BD6FFF 
+ 880      69BE6FFF 
+ 881 27d4 69BE70FF 		.ascii	"i\276p\377j\276p\377j\276p\377j\277p\377k\277q\377k\277q\377"
+ 881      6ABE70FF 
+ 881      6ABE70FF 
+ 881      6ABF70FF 
+ 881      6BBF71FF 
+ 882 27ec 6CBF71FF 		.ascii	"l\277q\377l\277q\377l\300q\377m\300r\377m\300r\377m\300r\377"
+ 882      6CBF71FF 
+ 882      6CC071FF 
+ 882      6DC072FF 
+ 882      6DC072FF 
+ 883 2804 6EC072FF 		.ascii	"n\300r\377n\301r\377n\301s\377"
+ 883      6EC172FF 
+ 883      6EC173FF 
+ 884 2810 6FC173FF 		.ascii	"o\301s\377o\301s\377p\301s\377p\302s\377p\302t\377q\302t\377"
+ 884      6FC173FF 
+ 884      70C173FF 
+ 884      70C273FF 
+ 884      70C274FF 
+ 885 2828 71C274FF 		.ascii	"q\302t\377q\302t\377r\303t\377r\303u\377r\303u\377s\303u\377"
+ 885      71C274FF 
+GAS LISTING /tmp/ccTsod4R.s 			page 47
+
+
+ 885      72C374FF 
+ 885      72C375FF 
+ 885      72C375FF 
+ 886 2840 73C375FF 		.ascii	"s\303u\377s\304u\377t\304v\377t\304v\377u\304v\377u\304w\377"
+ 886      73C475FF 
+ 886      74C476FF 
+ 886      74C476FF 
+ 886      75C476FF 
+ 887 2858 75C477FF 		.ascii	"u\304w\377v\304w\377v\305w\377v\305x\377w\305x\377w\305x\377"
+ 887      76C477FF 
+ 887      76C577FF 
+ 887      76C578FF 
+ 887      77C578FF 
+ 888 2870 78C579FF 		.ascii	"x\305y\377x\305y\377x\306y\377y\306y\377y\306z\377y\306z\377"
+ 888      78C579FF 
+ 888      78C679FF 
+ 888      79C679FF 
+ 888      79C67AFF 
+ 889 2888 7AC67AFF 		.ascii	"z\306z\377z\306{\377{\307{\377{\307{\377{\307{\377|\307|\377"
+ 889      7AC67BFF 
+ 889      7BC77BFF 
+ 889      7BC77BFF 
+ 889      7BC77BFF 
+ 890 28a0 7CC77CFF 		.ascii	"|\307|\377|\307|\377}\310}\377}\310}\377}\310}\377~\310}\377"
+ 890      7CC77CFF 
+ 890      7DC87DFF 
+ 890      7DC87DFF 
+ 890      7DC87DFF 
+ 891 28b8 7EC87EFF 		.ascii	"~\310~\377\177\310~\377\177\311~\377\177\311\177\377\200\311"
+ 891      7FC87EFF 
+ 891      7FC97EFF 
+ 891      7FC97FFF 
+ 891      80C9
+ 892 28ca 7FFF80C9 		.ascii	"\177\377\200\311\177\377\200\311\177\377\201\311\200\377\201"
+ 892      7FFF80C9 
+ 892      7FFF81C9 
+ 892      80FF81
+ 893 28d9 CA80FF81 		.ascii	"\312\200\377\201\312\200\377\202\312\201\377\202\312\201\377"
+ 893      CA80FF82 
+ 893      CA81FF82 
+ 893      CA81FF
+ 894 28e8 82CA81FF 		.ascii	"\202\312\201\377\203\312\201\377\203\313\202\377\204\313\202"
+ 894      83CA81FF 
+ 894      83CB82FF 
+ 894      84CB82
+ 895 28f7 FF84CB82 		.ascii	"\377\204\313\202\377\204\313\203\377\205\313\203\377\205\313"
+ 895      FF84CB83 
+ 895      FF85CB83 
+ 895      FF85CB
+ 896 2906 83FF85CC 		.ascii	"\203\377\205\314\203\377\206\314\204\377\206\314\204\377\206"
+ 896      83FF86CC 
+ 896      84FF86CC 
+ 896      84FF86
+ 897 2915 CC84FF87 		.ascii	"\314\204\377\207\314\205\377\207\314\205\377\207\315\205\377"
+ 897      CC85FF87 
+ 897      CC85FF87 
+ 897      CD85FF
+GAS LISTING /tmp/ccTsod4R.s 			page 48
+
+
+ 898 2924 88CD85FF 		.ascii	"\210\315\205\377\210\315\206\377\211\315\206\377\211\315\206"
+ 898      88CD86FF 
+ 898      89CD86FF 
+ 898      89CD86
+ 899 2933 FF89CD87 		.ascii	"\377\211\315\207\377\212\316\207\377\212\316\207\377\212\316"
+ 899      FF8ACE87 
+ 899      FF8ACE87 
+ 899      FF8ACE
+ 900 2942 87FF8BCE 		.ascii	"\207\377\213\316\210\377\213\316\210\377\213\316\210\377\214"
+ 900      88FF8BCE 
+ 900      88FF8BCE 
+ 900      88FF8C
+ 901 2951 CE89FF8C 		.ascii	"\316\211\377\214\317\211\377\214\317\211\377\215\317\211\377"
+ 901      CF89FF8C 
+ 901      CF89FF8D 
+ 901      CF89FF
+ 902 2960 8DCF8AFF 		.ascii	"\215\317\212\377\215\317\212\377\216\317\212\377\216\320\213"
+ 902      8DCF8AFF 
+ 902      8ECF8AFF 
+ 902      8ED08B
+ 903 296f FF8ED08B 		.ascii	"\377\216\320\213\377\217\320\213\377\217\320\214\377\217\320"
+ 903      FF8FD08B 
+ 903      FF8FD08C 
+ 903      FF8FD0
+ 904 297e 8CFF90D0 		.ascii	"\214\377\220\320\214\377\220\321\214\377\221\321\215\377\221"
+ 904      8CFF90D1 
+ 904      8CFF91D1 
+ 904      8DFF91
+ 905 298d D18DFF91 		.ascii	"\321\215\377\221\321\215\377\222\321\216\377\222\321\216\377"
+ 905      D18DFF92 
+ 905      D18EFF92 
+ 905      D18EFF
+ 906 299c 92D28EFF 		.ascii	"\222\322\216\377\223\322\216\377\223\322\217\377\223\322\217"
+ 906      93D28EFF 
+ 906      93D28FFF 
+ 906      93D28F
+ 907 29ab FF94D28F 		.ascii	"\377\224\322\217\377\224\322\220\377\224\323\220\377\225\323"
+ 907      FF94D290 
+ 907      FF94D390 
+ 907      FF95D3
+ 908 29ba 90FF95D3 		.ascii	"\220\377\225\323\220\377\225\323\221\377\226\323\221\377\226"
+ 908      90FF95D3 
+ 908      91FF96D3 
+ 908      91FF96
+ 909 29c9 D391FF96 		.ascii	"\323\221\377\226\324\222\377\227\324\222\377\227\324\222\377"
+ 909      D492FF97 
+ 909      D492FF97 
+ 909      D492FF
+ 910 29d8 97D493FF 		.ascii	"\227\324\223\377\230\324\223\377\230\324\223\377\230\325\223"
+ 910      98D493FF 
+ 910      98D493FF 
+ 910      98D593
+ 911 29e7 FF99D594 		.ascii	"\377\231\325\224\377\231\325\224\377\231\325\224\377\232\325"
+ 911      FF99D594 
+ 911      FF99D594 
+ 911      FF9AD5
+ 912 29f6 95FF9AD5 		.ascii	"\225\377\232\325\225\377\232\326\225\377\233\326\225\377\233"
+GAS LISTING /tmp/ccTsod4R.s 			page 49
+
+
+ 912      95FF9AD6 
+ 912      95FF9BD6 
+ 912      95FF9B
+ 913 2a05 D696FF9B 		.ascii	"\326\226\377\233\326\226\377\234\326\226\377\234\326\227\377"
+ 913      D696FF9C 
+ 913      D696FF9C 
+ 913      D697FF
+ 914 2a14 9CD797FF 		.ascii	"\234\327\227\377\235\327\227\377\235\327\230\377\235\327\230"
+ 914      9DD797FF 
+ 914      9DD798FF 
+ 914      9DD798
+ 915 2a23 FF9ED798 		.ascii	"\377\236\327\230\377\236\327\230\377\236\330\231\377\237\330"
+ 915      FF9ED798 
+ 915      FF9ED899 
+ 915      FF9FD8
+ 916 2a32 99FF9FD8 		.ascii	"\231\377\237\330\231\377\237\330\232\377\240\330\232\377\240"
+ 916      99FF9FD8 
+ 916      9AFFA0D8 
+ 916      9AFFA0
+ 917 2a41 D89AFFA0 		.ascii	"\330\232\377\240\331\232\377\241\331\233\377\241\331\233\377"
+ 917      D99AFFA1 
+ 917      D99BFFA1 
+ 917      D99BFF
+ 918 2a50 A1D99BFF 		.ascii	"\241\331\233\377\242\331\234\377\242\331\234\377\242\331\234"
+ 918      A2D99CFF 
+ 918      A2D99CFF 
+ 918      A2D99C
+ 919 2a5f FFA3D99C 		.ascii	"\377\243\331\234\377\243\332\235\377\243\332\235\377\244\332"
+ 919      FFA3DA9D 
+ 919      FFA3DA9D 
+ 919      FFA4DA
+ 920 2a6e 9DFFA4DA 		.ascii	"\235\377\244\332\236\377\244\332\236\377\244\332\236\377\245"
+ 920      9EFFA4DA 
+ 920      9EFFA4DA 
+ 920      9EFFA5
+ 921 2a7d DA9EFFA5 		.ascii	"\332\236\377\245\332\237\377\245\333\237\377\246\333\237\377"
+ 921      DA9FFFA5 
+ 921      DB9FFFA6 
+ 921      DB9FFF
+ 922 2a8c A6DBA0FF 		.ascii	"\246\333\240\377\246\333\240\377\247\333\240\377\247\333\240"
+ 922      A6DBA0FF 
+ 922      A7DBA0FF 
+ 922      A7DBA0
+ 923 2a9b FFA7DBA1 		.ascii	"\377\247\333\241\377\250\333\241\377\250\334\241\377\250\334"
+ 923      FFA8DBA1 
+ 923      FFA8DCA1 
+ 923      FFA8DC
+ 924 2aaa A2FFA8DC 		.ascii	"\242\377\250\334\242\377\251\334\242\377\251\334\242\377\251"
+ 924      A2FFA9DC 
+ 924      A2FFA9DC 
+ 924      A2FFA9
+ 925 2ab9 DCA3FFAA 		.ascii	"\334\243\377\252\334\243\377\252\334\243\377\252\335\244\377"
+ 925      DCA3FFAA 
+ 925      DCA3FFAA 
+ 925      DDA4FF
+ 926 2ac8 ABDDA4FF 		.ascii	"\253\335\244\377\253\335\244\377\253\335\244\377\253\335\245"
+ 926      ABDDA4FF 
+GAS LISTING /tmp/ccTsod4R.s 			page 50
+
+
+ 926      ABDDA4FF 
+ 926      ABDDA5
+ 927 2ad7 FFACDDA5 		.ascii	"\377\254\335\245\377\254\335\245\377\254\335\246\377\255\336"
+ 927      FFACDDA5 
+ 927      FFACDDA6 
+ 927      FFADDE
+ 928 2ae6 A6FFADDE 		.ascii	"\246\377\255\336\246\377\255\336\246\377\256\336\247\377\256"
+ 928      A6FFADDE 
+ 928      A6FFAEDE 
+ 928      A7FFAE
+ 929 2af5 DEA7FFAE 		.ascii	"\336\247\377\256\336\247\377\256\336\250\377\257\336\250\377"
+ 929      DEA7FFAE 
+ 929      DEA8FFAF 
+ 929      DEA8FF
+ 930 2b04 AFDFA8FF 		.ascii	"\257\337\250\377\257\337\250\377\260\337\251\377\260\337\251"
+ 930      AFDFA8FF 
+ 930      B0DFA9FF 
+ 930      B0DFA9
+ 931 2b13 FFB0DFA9 		.ascii	"\377\260\337\251\377\261\337\252\377\261\337\252\377\261\337"
+ 931      FFB1DFAA 
+ 931      FFB1DFAA 
+ 931      FFB1DF
+ 932 2b22 AAFFB1E0 		.ascii	"\252\377\261\340\252\377\262\340\253\377\262\340\253\377\262"
+ 932      AAFFB2E0 
+ 932      ABFFB2E0 
+ 932      ABFFB2
+ 933 2b31 E0ABFFB3 		.ascii	"\340\253\377\263\340\254\377\263\340\254\377\263\340\254\377"
+ 933      E0ACFFB3 
+ 933      E0ACFFB3 
+ 933      E0ACFF
+ 934 2b40 B4E0ADFF 		.ascii	"\264\340\255\377\264\341\255\377\264\341\255\377\264\341\255"
+ 934      B4E1ADFF 
+ 934      B4E1ADFF 
+ 934      B4E1AD
+ 935 2b4f FFB5E1AE 		.ascii	"\377\265\341\256\377\265\341\256\377\265\341\256\377\266\341"
+ 935      FFB5E1AE 
+ 935      FFB5E1AE 
+ 935      FFB6E1
+ 936 2b5e AFFFB6E1 		.ascii	"\257\377\266\341\257\377\266\342\257\377\266\342\257\377\267"
+ 936      AFFFB6E2 
+ 936      AFFFB6E2 
+ 936      AFFFB7
+ 937 2b6d E2B0FFB7 		.ascii	"\342\260\377\267\342\260\377\267\342\260\377\270\342\261\377"
+ 937      E2B0FFB7 
+ 937      E2B0FFB8 
+ 937      E2B1FF
+ 938 2b7c B8E2B1FF 		.ascii	"\270\342\261\377\270\342\261\377\271\343\261\377\271\343\262"
+ 938      B8E2B1FF 
+ 938      B9E3B1FF 
+ 938      B9E3B2
+ 939 2b8b FFB9E3B2 		.ascii	"\377\271\343\262\377\271\343\262\377\272\343\263\377\272\343"
+ 939      FFB9E3B2 
+ 939      FFBAE3B3 
+ 939      FFBAE3
+ 940 2b9a B3FFBAE3 		.ascii	"\263\377\272\343\263\377\273\343\263\377\273\344\264\377\273"
+ 940      B3FFBBE3 
+ 940      B3FFBBE4 
+GAS LISTING /tmp/ccTsod4R.s 			page 51
+
+
+ 940      B4FFBB
+ 941 2ba9 E4B4FFBB 		.ascii	"\344\264\377\273\344\264\377\274\344\265\377\274\344\265\377"
+ 941      E4B4FFBC 
+ 941      E4B5FFBC 
+ 941      E4B5FF
+ 942 2bb8 BCE4B5FF 		.ascii	"\274\344\265\377\275\344\266\377\275\344\266\377\275\345\266"
+ 942      BDE4B6FF 
+ 942      BDE4B6FF 
+ 942      BDE5B6
+ 943 2bc7 FFBEE5B6 		.ascii	"\377\276\345\266\377\276\345\267\377\276\345\267\377\276\345"
+ 943      FFBEE5B7 
+ 943      FFBEE5B7 
+ 943      FFBEE5
+ 944 2bd6 B7FFBFE5 		.ascii	"\267\377\277\345\270\377\277\345\270\377\277\345\270\377\300"
+ 944      B8FFBFE5 
+ 944      B8FFBFE5 
+ 944      B8FFC0
+ 945 2be5 E6B8FFC0 		.ascii	"\346\270\377\300\346\271\377\300\346\271\377\300\346\271\377"
+ 945      E6B9FFC0 
+ 945      E6B9FFC0 
+ 945      E6B9FF
+ 946 2bf4 C1E6BAFF 		.ascii	"\301\346\272\377\301\346\272\377\301\346\272\377\302\346\272"
+ 946      C1E6BAFF 
+ 946      C1E6BAFF 
+ 946      C2E6BA
+ 947 2c03 FFC2E7BB 		.ascii	"\377\302\347\273\377\302\347\273\377\302\347\273\377\303\347"
+ 947      FFC2E7BB 
+ 947      FFC2E7BB 
+ 947      FFC3E7
+ 948 2c12 BCFFC3E7 		.ascii	"\274\377\303\347\274\377\303\347\274\377\304\347\275\377\304"
+ 948      BCFFC3E7 
+ 948      BCFFC4E7 
+ 948      BDFFC4
+ 949 2c21 E7BDFFC4 		.ascii	"\347\275\377\304\350\275\377\304\350\275\377\305\350\276\377"
+ 949      E8BDFFC4 
+ 949      E8BDFFC5 
+ 949      E8BEFF
+ 950 2c30 C5E8BEFF 		.ascii	"\305\350\276\377\305\350\276\377\306\350\277\377\306\350\277"
+ 950      C5E8BEFF 
+ 950      C6E8BFFF 
+ 950      C6E8BF
+ 951 2c3f FFC6E8BF 		.ascii	"\377\306\350\277\377\306\351\277\377\307\351\300\377\307\351"
+ 951      FFC6E9BF 
+ 951      FFC7E9C0 
+ 951      FFC7E9
+ 952 2c4e C0FFC7E9 		.ascii	"\300\377\307\351\300\377\307\351\300\377\310\351\301\377\310"
+ 952      C0FFC7E9 
+ 952      C0FFC8E9 
+ 952      C1FFC8
+ 953 2c5d E9C1FFC8 		.ascii	"\351\301\377\310\351\301\377\310\351\301\377\311\351\302\377"
+ 953      E9C1FFC8 
+ 953      E9C1FFC9 
+ 953      E9C2FF
+ 954 2c6c C9E9C2FF 		.ascii	"\311\351\302\377\311\352\302\377\311\352\302\377\312\352\303"
+ 954      C9EAC2FF 
+ 954      C9EAC2FF 
+ 954      CAEAC3
+GAS LISTING /tmp/ccTsod4R.s 			page 52
+
+
+ 955 2c7b FFCAEAC3 		.ascii	"\377\312\352\303\377\312\352\303\377\312\352\303\377\313\352"
+ 955      FFCAEAC3 
+ 955      FFCAEAC3 
+ 955      FFCBEA
+ 956 2c8a C4FFCBEA 		.ascii	"\304\377\313\352\304\377\313\352\304\377\313\352\304\377\314"
+ 956      C4FFCBEA 
+ 956      C4FFCBEA 
+ 956      C4FFCC
+ 957 2c99 EAC5FFCC 		.ascii	"\352\305\377\314\353\305\377\314\353\305\377\314\353\305\377"
+ 957      EBC5FFCC 
+ 957      EBC5FFCC 
+ 957      EBC5FF
+ 958 2ca8 CDEBC6FF 		.ascii	"\315\353\306\377\315\353\306\377\315\353\306\377\315\353\306"
+ 958      CDEBC6FF 
+ 958      CDEBC6FF 
+ 958      CDEBC6
+ 959 2cb7 FFCDEBC7 		.ascii	"\377\315\353\307\377\316\353\307\377\316\353\307\377\316\354"
+ 959      FFCEEBC7 
+ 959      FFCEEBC7 
+ 959      FFCEEC
+ 960 2cc6 C7FFCEEC 		.ascii	"\307\377\316\354\310\377\317\354\310\377\317\354\310\377\317"
+ 960      C8FFCFEC 
+ 960      C8FFCFEC 
+ 960      C8FFCF
+ 961 2cd5 ECC8FFCF 		.ascii	"\354\310\377\317\354\311\377\320\354\311\377\320\354\311\377"
+ 961      ECC9FFD0 
+ 961      ECC9FFD0 
+ 961      ECC9FF
+ 962 2ce4 D0ECC9FF 		.ascii	"\320\354\311\377\320\354\312\377\321\354\312\377\321\355\312"
+ 962      D0ECCAFF 
+ 962      D1ECCAFF 
+ 962      D1EDCA
+ 963 2cf3 FFD1EDCA 		.ascii	"\377\321\355\312\377\321\355\313\377\321\355\313\377\322\355"
+ 963      FFD1EDCB 
+ 963      FFD1EDCB 
+ 963      FFD2ED
+ 964 2d02 CBFFD2ED 		.ascii	"\313\377\322\355\313\377\322\355\314\377\322\355\314\377\323"
+ 964      CBFFD2ED 
+ 964      CCFFD2ED 
+ 964      CCFFD3
+ 965 2d11 EDCCFFD3 		.ascii	"\355\314\377\323\355\314\377\323\355\315\377\323\356\315\377"
+ 965      EDCCFFD3 
+ 965      EDCDFFD3 
+ 965      EECDFF
+ 966 2d20 D4EECDFF 		.ascii	"\324\356\315\377\324\356\315\377\324\356\316\377\324\356\316"
+ 966      D4EECDFF 
+ 966      D4EECEFF 
+ 966      D4EECE
+ 967 2d2f FFD5EECE 		.ascii	"\377\325\356\316\377\325\356\316\377\325\356\317\377\325\356"
+ 967      FFD5EECE 
+ 967      FFD5EECF 
+ 967      FFD5EE
+ 968 2d3e CFFFD5EE 		.ascii	"\317\377\325\356\317\377\326\356\317\377\326\357\320\377\326"
+ 968      CFFFD6EE 
+ 968      CFFFD6EF 
+ 968      D0FFD6
+ 969 2d4d EFD0FFD6 		.ascii	"\357\320\377\326\357\320\377\327\357\320\377\327\357\321\377"
+GAS LISTING /tmp/ccTsod4R.s 			page 53
+
+
+ 969      EFD0FFD7 
+ 969      EFD0FFD7 
+ 969      EFD1FF
+ 970 2d5c D7EFD1FF 		.ascii	"\327\357\321\377\327\357\321\377\330\357\321\377\330\357\322"
+ 970      D7EFD1FF 
+ 970      D8EFD1FF 
+ 970      D8EFD2
+ 971 2d6b FFD8EFD2 		.ascii	"\377\330\357\322\377\330\360\322\377\331\360\322\377\331\360"
+ 971      FFD8F0D2 
+ 971      FFD9F0D2 
+ 971      FFD9F0
+ 972 2d7a D3FFD9F0 		.ascii	"\323\377\331\360\323\377\331\360\323\377\331\360\323\377\332"
+ 972      D3FFD9F0 
+ 972      D3FFD9F0 
+ 972      D3FFDA
+ 973 2d89 F0D4FFDA 		.ascii	"\360\324\377\332\360\324\377\332\360\324\377\332\360\324\377"
+ 973      F0D4FFDA 
+ 973      F0D4FFDA 
+ 973      F0D4FF
+ 974 2d98 DBF0D5FF 		.ascii	"\333\360\325\377\333\361\325\377\333\361\325\377\333\361\325"
+ 974      DBF1D5FF 
+ 974      DBF1D5FF 
+ 974      DBF1D5
+ 975 2da7 FFDCF1D6 		.ascii	"\377\334\361\326\377\334\361\326\377\334\361\326\377\334\361"
+ 975      FFDCF1D6 
+ 975      FFDCF1D6 
+ 975      FFDCF1
+ 976 2db6 D6FFDCF1 		.ascii	"\326\377\334\361\327\377\335\361\327\377\335\361\327\377\335"
+ 976      D7FFDDF1 
+ 976      D7FFDDF1 
+ 976      D7FFDD
+ 977 2dc5 F1D7FFDD 		.ascii	"\361\327\377\335\362\330\377\336\362\330\377\336\362\330\377"
+ 977      F2D8FFDE 
+ 977      F2D8FFDE 
+ 977      F2D8FF
+ 978 2dd4 DEF2D8FF 		.ascii	"\336\362\330\377\336\362\331\377\337\362\331\377\337\362\331"
+ 978      DEF2D9FF 
+ 978      DFF2D9FF 
+ 978      DFF2D9
+ 979 2de3 FFDFF2D9 		.ascii	"\377\337\362\331\377\337\362\332\377\337\362\332\377\340\363"
+ 979      FFDFF2DA 
+ 979      FFDFF2DA 
+ 979      FFE0F3
+ 980 2df2 DAFFE0F3 		.ascii	"\332\377\340\363\332\377\340\363\333\377\340\363\333\377\341"
+ 980      DAFFE0F3 
+ 980      DBFFE0F3 
+ 980      DBFFE1
+ 981 2e01 F3DBFFE1 		.ascii	"\363\333\377\341\363\333\377\341\363\334\377\341\363\334\377"
+ 981      F3DBFFE1 
+ 981      F3DCFFE1 
+ 981      F3DCFF
+ 982 2e10 E2F3DCFF 		.ascii	"\342\363\334\377\342\363\334\377\342\363\335\377\342\364\335"
+ 982      E2F3DCFF 
+ 982      E2F3DDFF 
+ 982      E2F4DD
+ 983 2e1f FFE2F4DD 		.ascii	"\377\342\364\335\377\343\364\335\377\343\364\336\377\343\364"
+ 983      FFE3F4DD 
+GAS LISTING /tmp/ccTsod4R.s 			page 54
+
+
+ 983      FFE3F4DE 
+ 983      FFE3F4
+ 984 2e2e DEFFE3F4 		.ascii	"\336\377\343\364\336\377\344\364\336\377\344\364\337\377\344"
+ 984      DEFFE4F4 
+ 984      DEFFE4F4 
+ 984      DFFFE4
+ 985 2e3d F4DFFFE4 		.ascii	"\364\337\377\344\364\337\377\344\365\337\377\345\365\340\377"
+ 985      F4DFFFE4 
+ 985      F5DFFFE5 
+ 985      F5E0FF
+ 986 2e4c E5F5E0FF 		.ascii	"\345\365\340\377\345\365\340\377\345\365\340\377\345\365\340"
+ 986      E5F5E0FF 
+ 986      E5F5E0FF 
+ 986      E5F5E0
+ 987 2e5b FFE5F5E0 		.ascii	"\377\345\365\340\377\346\365\341\377\346\365\341\377\346\365"
+ 987      FFE6F5E1 
+ 987      FFE6F5E1 
+ 987      FFE6F5
+ 988 2e6a E1FFE6F5 		.ascii	"\341\377\346\365\341\377\346\365\341\377\346\365\341\377\346"
+ 988      E1FFE6F5 
+ 988      E1FFE6F5 
+ 988      E1FFE6
+ 989 2e79 F5E2FFE7 		.ascii	"\365\342\377\347\365\342\377\347\365\342\377\347\365\342\377"
+ 989      F5E2FFE7 
+ 989      F5E2FFE7 
+ 989      F5E2FF
+ 990 2e88 E7F5E2FF 		.ascii	"\347\365\342\377\347\365\342\377\347\366\343\377\347\366\343"
+ 990      E7F5E2FF 
+ 990      E7F6E3FF 
+ 990      E7F6E3
+ 991 2e97 FFE8F6E3 		.ascii	"\377\350\366\343\377\350\366\343\377\350\366\343\377\350\366"
+ 991      FFE8F6E3 
+ 991      FFE8F6E3 
+ 991      FFE8F6
+ 992 2ea6 E3FFE8F6 		.ascii	"\343\377\350\366\344\377\350\366\344\377\350\366\344\377\351"
+ 992      E4FFE8F6 
+ 992      E4FFE8F6 
+ 992      E4FFE9
+ 993 2eb5 F6E4FFE9 		.ascii	"\366\344\377\351\366\344\377\351\366\344\377\351\366\345\377"
+ 993      F6E4FFE9 
+ 993      F6E4FFE9 
+ 993      F6E5FF
+ 994 2ec4 E9F6E5FF 		.ascii	"\351\366\345\377\351\366\345\377\351\366\345\377\352\366\345"
+ 994      E9F6E5FF 
+ 994      E9F6E5FF 
+ 994      EAF6E5
+ 995 2ed3 FFEAF6E5 		.ascii	"\377\352\366\345\377\352\367\345\377\352\367\346\377\352\367"
+ 995      FFEAF7E5 
+ 995      FFEAF7E6 
+ 995      FFEAF7
+ 996 2ee2 E6FFEAF7 		.ascii	"\346\377\352\367\346\377\352\367\346\377\352\367\346\377\353"
+ 996      E6FFEAF7 
+ 996      E6FFEAF7 
+ 996      E6FFEB
+ 997 2ef1 F7E6FFEB 		.ascii	"\367\346\377\353\367\347\377\353\367\347\377\353\367\347\377"
+ 997      F7E7FFEB 
+ 997      F7E7FFEB 
+GAS LISTING /tmp/ccTsod4R.s 			page 55
+
+
+ 997      F7E7FF
+ 998 2f00 EBF7E7FF 		.ascii	"\353\367\347\377\353\367\347\377\353\367\347\377\354\367\350"
+ 998      EBF7E7FF 
+ 998      EBF7E7FF 
+ 998      ECF7E8
+ 999 2f0f FFECF7E8 		.ascii	"\377\354\367\350\377\354\367\350\377\354\367\350\377\354\367"
+ 999      FFECF7E8 
+ 999      FFECF7E8 
+ 999      FFECF7
+ 1000 2f1e E8FFECF8 		.ascii	"\350\377\354\370\350\377\354\370\351\377\355\370\351\377\355"
+ 1000      E8FFECF8 
+ 1000      E9FFEDF8 
+ 1000      E9FFED
+ 1001 2f2d F8E9FFED 		.ascii	"\370\351\377\355\370\351\377\355\370\351\377\355\370\351\377"
+ 1001      F8E9FFED 
+ 1001      F8E9FFED 
+ 1001      F8E9FF
+ 1002 2f3c EDF8EAFF 		.ascii	"\355\370\352\377\355\370\352\377\356\370\352\377\356\370\352"
+ 1002      EDF8EAFF 
+ 1002      EEF8EAFF 
+ 1002      EEF8EA
+ 1003 2f4b FFEEF8EA 		.ascii	"\377\356\370\352\377\356\370\352\377\356\370\353\377\356\370"
+ 1003      FFEEF8EA 
+ 1003      FFEEF8EB 
+ 1003      FFEEF8
+ 1004 2f5a EBFFEEF8 		.ascii	"\353\377\356\370\353\377\357\370\353\377\357\370\353\377\357"
+ 1004      EBFFEFF8 
+ 1004      EBFFEFF8 
+ 1004      EBFFEF
+ 1005 2f69 F8EBFFEF 		.ascii	"\370\353\377\357\371\354\377\357\371\354\377\357\371\354\377"
+ 1005      F9ECFFEF 
+ 1005      F9ECFFEF 
+ 1005      F9ECFF
+ 1006 2f78 EFF9ECFF 		.ascii	"\357\371\354\377\360\371\354\377\360\371\354\377\360\371\355"
+ 1006      F0F9ECFF 
+ 1006      F0F9ECFF 
+ 1006      F0F9ED
+ 1007 2f87 FFF0F9ED 		.ascii	"\377\360\371\355\377\360\371\355\377\360\371\355\377\360\371"
+ 1007      FFF0F9ED 
+ 1007      FFF0F9ED 
+ 1007      FFF0F9
+ 1008 2f96 EDFFF1F9 		.ascii	"\355\377\361\371\355\377\361\371\356\377\361\371\356\377\361"
+ 1008      EDFFF1F9 
+ 1008      EEFFF1F9 
+ 1008      EEFFF1
+ 1009 2fa5 F9EEFFF1 		.ascii	"\371\356\377\361\371\356\377\361\371\356\377\361\371\356\377"
+ 1009      F9EEFFF1 
+ 1009      F9EEFFF1 
+ 1009      F9EEFF
+ 1010 2fb4 F2FAEFFF 		.ascii	"\362\372\357\377\362\372\357\377\362\372\357\377\362\372\357"
+ 1010      F2FAEFFF 
+ 1010      F2FAEFFF 
+ 1010      F2FAEF
+ 1011 2fc3 FFF2FAEF 		.ascii	"\377\362\372\357\377\362\372\357\377\362\372\360\377\362\372"
+ 1011      FFF2FAEF 
+ 1011      FFF2FAF0 
+ 1011      FFF2FA
+GAS LISTING /tmp/ccTsod4R.s 			page 56
+
+
+ 1012 2fd2 F0FFF3FA 		.ascii	"\360\377\363\372\360\377\363\372\360\377\363\372\360\377"
+ 1012      F0FFF3FA 
+ 1012      F0FFF3FA 
+ 1012      F0FF
+ 1013 2fe0 F3FAF0FF 		.ascii	"\363\372\360\377\363\372\361\377\363\372\361\377\363\372\361"
+ 1013      F3FAF1FF 
+ 1013      F3FAF1FF 
+ 1013      F3FAF1
+ 1014 2fef FFF4FAF1 		.ascii	"\377\364\372\361\377\364\372\361\377\364\372\361\377\364\373"
+ 1014      FFF4FAF1 
+ 1014      FFF4FAF1 
+ 1014      FFF4FB
+ 1015 2ffe F2FFF4FB 		.ascii	"\362\377\364\373\362\377\364\373\362\377\364\373\362\377\365"
+ 1015      F2FFF4FB 
+ 1015      F2FFF4FB 
+ 1015      F2FFF5
+ 1016 300d FBF2FFF5 		.ascii	"\373\362\377\365\373\362\377\365\373\363\377\365\373\363\377"
+ 1016      FBF2FFF5 
+ 1016      FBF3FFF5 
+ 1016      FBF3FF
+ 1017 301c F5FBF3FF 		.ascii	"\365\373\363\377\365\373\363\377\365\373\363\377\366\373\363"
+ 1017      F5FBF3FF 
+ 1017      F5FBF3FF 
+ 1017      F6FBF3
+ 1018 302b FFF6FBF4 		.ascii	"\377\366\373\364\377\366\373\364\377\366\373\364\377\366\373"
+ 1018      FFF6FBF4 
+ 1018      FFF6FBF4 
+ 1018      FFF6FB
+ 1019 303a F4FFF6FB 		.ascii	"\364\377\366\373\364\377\366\373\364\377"
+ 1019      F4FFF6FB 
+ 1019      F4FF
+ 1020              		.globl	heatmap_cs_Greens_discrete
+ 1021              		.section	.data.rel.local
+ 1022              		.align 8
+ 1023              		.type	heatmap_cs_Greens_discrete, @object
+ 1024              		.size	heatmap_cs_Greens_discrete, 8
+ 1025              	heatmap_cs_Greens_discrete:
+ 1026 0018 00000000 		.quad	discrete
+ 1026      00000000 
+ 1027              		.section	.data.rel.ro.local
+ 1028              		.align 16
+ 1029              		.type	discrete, @object
+ 1030              		.size	discrete, 16
+ 1031              	discrete:
+ 1032 0030 00000000 		.quad	discrete_data
+ 1032      00000000 
+ 1033 0038 0A000000 		.quad	10
+ 1033      00000000 
+ 1034              		.section	.rodata
+ 1035 3044 00000000 		.align 32
+ 1035      00000000 
+ 1035      00000000 
+ 1035      00000000 
+ 1035      00000000 
+ 1036              		.type	discrete_data, @object
+ 1037              		.size	discrete_data, 40
+ 1038              	discrete_data:
+GAS LISTING /tmp/ccTsod4R.s 			page 57
+
+
+ 1039 3060 00       		.string	""
+ 1040 3061 00       		.string	""
+ 1041 3062 00       		.string	""
+ 1042 3063 00       		.string	""
+ 1043 3064 00       		.string	""
+ 1044 3065 441BFF00 		.string	"D\033\377"
+ 1045 3069 6D2CFF23 		.ascii	"m,\377#\213E\377A\253]\377t\304v\377\241\331\233\377\307\351"
+ 1045      8B45FF41 
+ 1045      AB5DFF74 
+ 1045      C476FFA1 
+ 1045      D99BFFC7 
+ 1046 307e C0FFE5F5 		.ascii	"\300\377\345\365\340\377\367\374\365\377"
+ 1046      E0FFF7FC 
+ 1046      F5FF
+ 1047              		.text
+ 1048              	.Letext0:
+ 1049              		.file 1 "./heatmap.h"
+ 1050              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1051              		.file 3 "./colorschemes/Greens.h"
+ 1052              		.file 4 "colorschemes/Greens.c"
+ 1053              		.section	.debug_info,"",@progbits
+ 1054              	.Ldebug_info0:
+ 1055 0000 E3010000 		.long	0x1e3
+ 1056 0004 0500     		.value	0x5
+ 1057 0006 01       		.byte	0x1
+ 1058 0007 08       		.byte	0x8
+ 1059 0008 00000000 		.long	.Ldebug_abbrev0
+ 1060 000c 0A       		.uleb128 0xa
+ 1061 000d 00000000 		.long	.LASF26
+ 1062 0011 1D       		.byte	0x1d
+ 1063 0012 00000000 		.long	.LASF0
+ 1064 0016 00000000 		.long	.LASF1
+ 1065 001a 00000000 		.long	.Ldebug_line0
+ 1066 001e 01       		.uleb128 0x1
+ 1067 001f 08       		.byte	0x8
+ 1068 0020 05       		.byte	0x5
+ 1069 0021 00000000 		.long	.LASF2
+ 1070 0025 06       		.uleb128 0x6
+ 1071 0026 00000000 		.long	.LASF12
+ 1072 002a 02       		.byte	0x2
+ 1073 002b D6       		.byte	0xd6
+ 1074 002c 17       		.byte	0x17
+ 1075 002d 31000000 		.long	0x31
+ 1076 0031 01       		.uleb128 0x1
+ 1077 0032 08       		.byte	0x8
+ 1078 0033 07       		.byte	0x7
+ 1079 0034 00000000 		.long	.LASF3
+ 1080 0038 0B       		.uleb128 0xb
+ 1081 0039 04       		.byte	0x4
+ 1082 003a 05       		.byte	0x5
+ 1083 003b 696E7400 		.string	"int"
+ 1084 003f 01       		.uleb128 0x1
+ 1085 0040 08       		.byte	0x8
+ 1086 0041 05       		.byte	0x5
+ 1087 0042 00000000 		.long	.LASF4
+ 1088 0046 01       		.uleb128 0x1
+ 1089 0047 10       		.byte	0x10
+GAS LISTING /tmp/ccTsod4R.s 			page 58
+
+
+ 1090 0048 04       		.byte	0x4
+ 1091 0049 00000000 		.long	.LASF5
+ 1092 004d 01       		.uleb128 0x1
+ 1093 004e 04       		.byte	0x4
+ 1094 004f 04       		.byte	0x4
+ 1095 0050 00000000 		.long	.LASF6
+ 1096 0054 01       		.uleb128 0x1
+ 1097 0055 04       		.byte	0x4
+ 1098 0056 07       		.byte	0x7
+ 1099 0057 00000000 		.long	.LASF7
+ 1100 005b 01       		.uleb128 0x1
+ 1101 005c 02       		.byte	0x2
+ 1102 005d 07       		.byte	0x7
+ 1103 005e 00000000 		.long	.LASF8
+ 1104 0062 0C       		.uleb128 0xc
+ 1105 0063 10       		.byte	0x10
+ 1106 0064 01       		.byte	0x1
+ 1107 0065 BB       		.byte	0xbb
+ 1108 0066 09       		.byte	0x9
+ 1109 0067 84000000 		.long	0x84
+ 1110 006b 07       		.uleb128 0x7
+ 1111 006c 00000000 		.long	.LASF9
+ 1112 0070 BC       		.byte	0xbc
+ 1113 0071 1A       		.byte	0x1a
+ 1114 0072 84000000 		.long	0x84
+ 1115 0076 00       		.byte	0
+ 1116 0077 07       		.uleb128 0x7
+ 1117 0078 00000000 		.long	.LASF10
+ 1118 007c BD       		.byte	0xbd
+ 1119 007d 0C       		.byte	0xc
+ 1120 007e 25000000 		.long	0x25
+ 1121 0082 08       		.byte	0x8
+ 1122 0083 00       		.byte	0
+ 1123 0084 08       		.uleb128 0x8
+ 1124 0085 90000000 		.long	0x90
+ 1125 0089 01       		.uleb128 0x1
+ 1126 008a 01       		.byte	0x1
+ 1127 008b 08       		.byte	0x8
+ 1128 008c 00000000 		.long	.LASF11
+ 1129 0090 03       		.uleb128 0x3
+ 1130 0091 89000000 		.long	0x89
+ 1131 0095 06       		.uleb128 0x6
+ 1132 0096 00000000 		.long	.LASF13
+ 1133 009a 01       		.byte	0x1
+ 1134 009b BE       		.byte	0xbe
+ 1135 009c 03       		.byte	0x3
+ 1136 009d 62000000 		.long	0x62
+ 1137 00a1 03       		.uleb128 0x3
+ 1138 00a2 95000000 		.long	0x95
+ 1139 00a6 08       		.uleb128 0x8
+ 1140 00a7 A1000000 		.long	0xa1
+ 1141 00ab 04       		.uleb128 0x4
+ 1142 00ac 00000000 		.long	.LASF14
+ 1143 00b0 21       		.byte	0x21
+ 1144 00b1 A6000000 		.long	0xa6
+ 1145 00b5 04       		.uleb128 0x4
+ 1146 00b6 00000000 		.long	.LASF15
+GAS LISTING /tmp/ccTsod4R.s 			page 59
+
+
+ 1147 00ba 23       		.byte	0x23
+ 1148 00bb A6000000 		.long	0xa6
+ 1149 00bf 04       		.uleb128 0x4
+ 1150 00c0 00000000 		.long	.LASF16
+ 1151 00c4 25       		.byte	0x25
+ 1152 00c5 A6000000 		.long	0xa6
+ 1153 00c9 04       		.uleb128 0x4
+ 1154 00ca 00000000 		.long	.LASF17
+ 1155 00ce 28       		.byte	0x28
+ 1156 00cf A6000000 		.long	0xa6
+ 1157 00d3 09       		.uleb128 0x9
+ 1158 00d4 90000000 		.long	0x90
+ 1159 00d8 E3000000 		.long	0xe3
+ 1160 00dc 0D       		.uleb128 0xd
+ 1161 00dd 31000000 		.long	0x31
+ 1162 00e1 27       		.byte	0x27
+ 1163 00e2 00       		.byte	0
+ 1164 00e3 03       		.uleb128 0x3
+ 1165 00e4 D3000000 		.long	0xd3
+ 1166 00e8 02       		.uleb128 0x2
+ 1167 00e9 00000000 		.long	.LASF18
+ 1168 00ed 20       		.byte	0x20
+ 1169 00ee 1C       		.byte	0x1c
+ 1170 00ef E3000000 		.long	0xe3
+ 1171 00f3 09       		.uleb128 0x9
+ 1172 00f4 03       		.byte	0x3
+ 1173 00f5 00000000 		.quad	discrete_data
+ 1173      00000000 
+ 1174 00fd 02       		.uleb128 0x2
+ 1175 00fe 00000000 		.long	.LASF19
+ 1176 0102 23       		.byte	0x23
+ 1177 0103 24       		.byte	0x24
+ 1178 0104 A1000000 		.long	0xa1
+ 1179 0108 09       		.uleb128 0x9
+ 1180 0109 03       		.byte	0x3
+ 1181 010a 00000000 		.quad	discrete
+ 1181      00000000 
+ 1182 0112 05       		.uleb128 0x5
+ 1183 0113 AB000000 		.long	0xab
+ 1184 0117 24       		.byte	0x24
+ 1185 0118 09       		.uleb128 0x9
+ 1186 0119 03       		.byte	0x3
+ 1187 011a 00000000 		.quad	heatmap_cs_Greens_discrete
+ 1187      00000000 
+ 1188 0122 09       		.uleb128 0x9
+ 1189 0123 90000000 		.long	0x90
+ 1190 0127 33010000 		.long	0x133
+ 1191 012b 0E       		.uleb128 0xe
+ 1192 012c 31000000 		.long	0x31
+ 1193 0130 0310     		.value	0x1003
+ 1194 0132 00       		.byte	0
+ 1195 0133 03       		.uleb128 0x3
+ 1196 0134 22010000 		.long	0x122
+ 1197 0138 02       		.uleb128 0x2
+ 1198 0139 00000000 		.long	.LASF20
+ 1199 013d 26       		.byte	0x26
+ 1200 013e 1C       		.byte	0x1c
+GAS LISTING /tmp/ccTsod4R.s 			page 60
+
+
+ 1201 013f 33010000 		.long	0x133
+ 1202 0143 09       		.uleb128 0x9
+ 1203 0144 03       		.byte	0x3
+ 1204 0145 00000000 		.quad	soft_data
+ 1204      00000000 
+ 1205 014d 02       		.uleb128 0x2
+ 1206 014e 00000000 		.long	.LASF21
+ 1207 0152 29       		.byte	0x29
+ 1208 0153 24       		.byte	0x24
+ 1209 0154 A1000000 		.long	0xa1
+ 1210 0158 09       		.uleb128 0x9
+ 1211 0159 03       		.byte	0x3
+ 1212 015a 00000000 		.quad	soft
+ 1212      00000000 
+ 1213 0162 05       		.uleb128 0x5
+ 1214 0163 B5000000 		.long	0xb5
+ 1215 0167 2A       		.byte	0x2a
+ 1216 0168 09       		.uleb128 0x9
+ 1217 0169 03       		.byte	0x3
+ 1218 016a 00000000 		.quad	heatmap_cs_Greens_soft
+ 1218      00000000 
+ 1219 0172 02       		.uleb128 0x2
+ 1220 0173 00000000 		.long	.LASF22
+ 1221 0177 2C       		.byte	0x2c
+ 1222 0178 1C       		.byte	0x1c
+ 1223 0179 33010000 		.long	0x133
+ 1224 017d 09       		.uleb128 0x9
+ 1225 017e 03       		.byte	0x3
+ 1226 017f 00000000 		.quad	mixed_data
+ 1226      00000000 
+ 1227 0187 02       		.uleb128 0x2
+ 1228 0188 00000000 		.long	.LASF23
+ 1229 018c 2F       		.byte	0x2f
+ 1230 018d 24       		.byte	0x24
+ 1231 018e A1000000 		.long	0xa1
+ 1232 0192 09       		.uleb128 0x9
+ 1233 0193 03       		.byte	0x3
+ 1234 0194 00000000 		.quad	mixed
+ 1234      00000000 
+ 1235 019c 05       		.uleb128 0x5
+ 1236 019d BF000000 		.long	0xbf
+ 1237 01a1 30       		.byte	0x30
+ 1238 01a2 09       		.uleb128 0x9
+ 1239 01a3 03       		.byte	0x3
+ 1240 01a4 00000000 		.quad	heatmap_cs_Greens_mixed
+ 1240      00000000 
+ 1241 01ac 02       		.uleb128 0x2
+ 1242 01ad 00000000 		.long	.LASF24
+ 1243 01b1 32       		.byte	0x32
+ 1244 01b2 1C       		.byte	0x1c
+ 1245 01b3 33010000 		.long	0x133
+ 1246 01b7 09       		.uleb128 0x9
+ 1247 01b8 03       		.byte	0x3
+ 1248 01b9 00000000 		.quad	mixed_exp_data
+ 1248      00000000 
+ 1249 01c1 02       		.uleb128 0x2
+ 1250 01c2 00000000 		.long	.LASF25
+GAS LISTING /tmp/ccTsod4R.s 			page 61
+
+
+ 1251 01c6 35       		.byte	0x35
+ 1252 01c7 24       		.byte	0x24
+ 1253 01c8 A1000000 		.long	0xa1
+ 1254 01cc 09       		.uleb128 0x9
+ 1255 01cd 03       		.byte	0x3
+ 1256 01ce 00000000 		.quad	mixed_exp
+ 1256      00000000 
+ 1257 01d6 05       		.uleb128 0x5
+ 1258 01d7 C9000000 		.long	0xc9
+ 1259 01db 36       		.byte	0x36
+ 1260 01dc 09       		.uleb128 0x9
+ 1261 01dd 03       		.byte	0x3
+ 1262 01de 00000000 		.quad	heatmap_cs_Greens_mixed_exp
+ 1262      00000000 
+ 1263 01e6 00       		.byte	0
+ 1264              		.section	.debug_abbrev,"",@progbits
+ 1265              	.Ldebug_abbrev0:
+ 1266 0000 01       		.uleb128 0x1
+ 1267 0001 24       		.uleb128 0x24
+ 1268 0002 00       		.byte	0
+ 1269 0003 0B       		.uleb128 0xb
+ 1270 0004 0B       		.uleb128 0xb
+ 1271 0005 3E       		.uleb128 0x3e
+ 1272 0006 0B       		.uleb128 0xb
+ 1273 0007 03       		.uleb128 0x3
+ 1274 0008 0E       		.uleb128 0xe
+ 1275 0009 00       		.byte	0
+ 1276 000a 00       		.byte	0
+ 1277 000b 02       		.uleb128 0x2
+ 1278 000c 34       		.uleb128 0x34
+ 1279 000d 00       		.byte	0
+ 1280 000e 03       		.uleb128 0x3
+ 1281 000f 0E       		.uleb128 0xe
+ 1282 0010 3A       		.uleb128 0x3a
+ 1283 0011 21       		.uleb128 0x21
+ 1284 0012 04       		.sleb128 4
+ 1285 0013 3B       		.uleb128 0x3b
+ 1286 0014 0B       		.uleb128 0xb
+ 1287 0015 39       		.uleb128 0x39
+ 1288 0016 0B       		.uleb128 0xb
+ 1289 0017 49       		.uleb128 0x49
+ 1290 0018 13       		.uleb128 0x13
+ 1291 0019 02       		.uleb128 0x2
+ 1292 001a 18       		.uleb128 0x18
+ 1293 001b 00       		.byte	0
+ 1294 001c 00       		.byte	0
+ 1295 001d 03       		.uleb128 0x3
+ 1296 001e 26       		.uleb128 0x26
+ 1297 001f 00       		.byte	0
+ 1298 0020 49       		.uleb128 0x49
+ 1299 0021 13       		.uleb128 0x13
+ 1300 0022 00       		.byte	0
+ 1301 0023 00       		.byte	0
+ 1302 0024 04       		.uleb128 0x4
+ 1303 0025 34       		.uleb128 0x34
+ 1304 0026 00       		.byte	0
+ 1305 0027 03       		.uleb128 0x3
+GAS LISTING /tmp/ccTsod4R.s 			page 62
+
+
+ 1306 0028 0E       		.uleb128 0xe
+ 1307 0029 3A       		.uleb128 0x3a
+ 1308 002a 21       		.uleb128 0x21
+ 1309 002b 03       		.sleb128 3
+ 1310 002c 3B       		.uleb128 0x3b
+ 1311 002d 0B       		.uleb128 0xb
+ 1312 002e 39       		.uleb128 0x39
+ 1313 002f 21       		.uleb128 0x21
+ 1314 0030 25       		.sleb128 37
+ 1315 0031 49       		.uleb128 0x49
+ 1316 0032 13       		.uleb128 0x13
+ 1317 0033 3F       		.uleb128 0x3f
+ 1318 0034 19       		.uleb128 0x19
+ 1319 0035 3C       		.uleb128 0x3c
+ 1320 0036 19       		.uleb128 0x19
+ 1321 0037 00       		.byte	0
+ 1322 0038 00       		.byte	0
+ 1323 0039 05       		.uleb128 0x5
+ 1324 003a 34       		.uleb128 0x34
+ 1325 003b 00       		.byte	0
+ 1326 003c 47       		.uleb128 0x47
+ 1327 003d 13       		.uleb128 0x13
+ 1328 003e 3A       		.uleb128 0x3a
+ 1329 003f 21       		.uleb128 0x21
+ 1330 0040 04       		.sleb128 4
+ 1331 0041 3B       		.uleb128 0x3b
+ 1332 0042 0B       		.uleb128 0xb
+ 1333 0043 39       		.uleb128 0x39
+ 1334 0044 21       		.uleb128 0x21
+ 1335 0045 1E       		.sleb128 30
+ 1336 0046 02       		.uleb128 0x2
+ 1337 0047 18       		.uleb128 0x18
+ 1338 0048 00       		.byte	0
+ 1339 0049 00       		.byte	0
+ 1340 004a 06       		.uleb128 0x6
+ 1341 004b 16       		.uleb128 0x16
+ 1342 004c 00       		.byte	0
+ 1343 004d 03       		.uleb128 0x3
+ 1344 004e 0E       		.uleb128 0xe
+ 1345 004f 3A       		.uleb128 0x3a
+ 1346 0050 0B       		.uleb128 0xb
+ 1347 0051 3B       		.uleb128 0x3b
+ 1348 0052 0B       		.uleb128 0xb
+ 1349 0053 39       		.uleb128 0x39
+ 1350 0054 0B       		.uleb128 0xb
+ 1351 0055 49       		.uleb128 0x49
+ 1352 0056 13       		.uleb128 0x13
+ 1353 0057 00       		.byte	0
+ 1354 0058 00       		.byte	0
+ 1355 0059 07       		.uleb128 0x7
+ 1356 005a 0D       		.uleb128 0xd
+ 1357 005b 00       		.byte	0
+ 1358 005c 03       		.uleb128 0x3
+ 1359 005d 0E       		.uleb128 0xe
+ 1360 005e 3A       		.uleb128 0x3a
+ 1361 005f 21       		.uleb128 0x21
+ 1362 0060 01       		.sleb128 1
+GAS LISTING /tmp/ccTsod4R.s 			page 63
+
+
+ 1363 0061 3B       		.uleb128 0x3b
+ 1364 0062 0B       		.uleb128 0xb
+ 1365 0063 39       		.uleb128 0x39
+ 1366 0064 0B       		.uleb128 0xb
+ 1367 0065 49       		.uleb128 0x49
+ 1368 0066 13       		.uleb128 0x13
+ 1369 0067 38       		.uleb128 0x38
+ 1370 0068 0B       		.uleb128 0xb
+ 1371 0069 00       		.byte	0
+ 1372 006a 00       		.byte	0
+ 1373 006b 08       		.uleb128 0x8
+ 1374 006c 0F       		.uleb128 0xf
+ 1375 006d 00       		.byte	0
+ 1376 006e 0B       		.uleb128 0xb
+ 1377 006f 21       		.uleb128 0x21
+ 1378 0070 08       		.sleb128 8
+ 1379 0071 49       		.uleb128 0x49
+ 1380 0072 13       		.uleb128 0x13
+ 1381 0073 00       		.byte	0
+ 1382 0074 00       		.byte	0
+ 1383 0075 09       		.uleb128 0x9
+ 1384 0076 01       		.uleb128 0x1
+ 1385 0077 01       		.byte	0x1
+ 1386 0078 49       		.uleb128 0x49
+ 1387 0079 13       		.uleb128 0x13
+ 1388 007a 01       		.uleb128 0x1
+ 1389 007b 13       		.uleb128 0x13
+ 1390 007c 00       		.byte	0
+ 1391 007d 00       		.byte	0
+ 1392 007e 0A       		.uleb128 0xa
+ 1393 007f 11       		.uleb128 0x11
+ 1394 0080 01       		.byte	0x1
+ 1395 0081 25       		.uleb128 0x25
+ 1396 0082 0E       		.uleb128 0xe
+ 1397 0083 13       		.uleb128 0x13
+ 1398 0084 0B       		.uleb128 0xb
+ 1399 0085 03       		.uleb128 0x3
+ 1400 0086 1F       		.uleb128 0x1f
+ 1401 0087 1B       		.uleb128 0x1b
+ 1402 0088 1F       		.uleb128 0x1f
+ 1403 0089 10       		.uleb128 0x10
+ 1404 008a 17       		.uleb128 0x17
+ 1405 008b 00       		.byte	0
+ 1406 008c 00       		.byte	0
+ 1407 008d 0B       		.uleb128 0xb
+ 1408 008e 24       		.uleb128 0x24
+ 1409 008f 00       		.byte	0
+ 1410 0090 0B       		.uleb128 0xb
+ 1411 0091 0B       		.uleb128 0xb
+ 1412 0092 3E       		.uleb128 0x3e
+ 1413 0093 0B       		.uleb128 0xb
+ 1414 0094 03       		.uleb128 0x3
+ 1415 0095 08       		.uleb128 0x8
+ 1416 0096 00       		.byte	0
+ 1417 0097 00       		.byte	0
+ 1418 0098 0C       		.uleb128 0xc
+ 1419 0099 13       		.uleb128 0x13
+GAS LISTING /tmp/ccTsod4R.s 			page 64
+
+
+ 1420 009a 01       		.byte	0x1
+ 1421 009b 0B       		.uleb128 0xb
+ 1422 009c 0B       		.uleb128 0xb
+ 1423 009d 3A       		.uleb128 0x3a
+ 1424 009e 0B       		.uleb128 0xb
+ 1425 009f 3B       		.uleb128 0x3b
+ 1426 00a0 0B       		.uleb128 0xb
+ 1427 00a1 39       		.uleb128 0x39
+ 1428 00a2 0B       		.uleb128 0xb
+ 1429 00a3 01       		.uleb128 0x1
+ 1430 00a4 13       		.uleb128 0x13
+ 1431 00a5 00       		.byte	0
+ 1432 00a6 00       		.byte	0
+ 1433 00a7 0D       		.uleb128 0xd
+ 1434 00a8 21       		.uleb128 0x21
+ 1435 00a9 00       		.byte	0
+ 1436 00aa 49       		.uleb128 0x49
+ 1437 00ab 13       		.uleb128 0x13
+ 1438 00ac 2F       		.uleb128 0x2f
+ 1439 00ad 0B       		.uleb128 0xb
+ 1440 00ae 00       		.byte	0
+ 1441 00af 00       		.byte	0
+ 1442 00b0 0E       		.uleb128 0xe
+ 1443 00b1 21       		.uleb128 0x21
+ 1444 00b2 00       		.byte	0
+ 1445 00b3 49       		.uleb128 0x49
+ 1446 00b4 13       		.uleb128 0x13
+ 1447 00b5 2F       		.uleb128 0x2f
+ 1448 00b6 05       		.uleb128 0x5
+ 1449 00b7 00       		.byte	0
+ 1450 00b8 00       		.byte	0
+ 1451 00b9 00       		.byte	0
+ 1452              		.section	.debug_aranges,"",@progbits
+ 1453 0000 1C000000 		.long	0x1c
+ 1454 0004 0200     		.value	0x2
+ 1455 0006 00000000 		.long	.Ldebug_info0
+ 1456 000a 08       		.byte	0x8
+ 1457 000b 00       		.byte	0
+ 1458 000c 0000     		.value	0
+ 1459 000e 0000     		.value	0
+ 1460 0010 00000000 		.quad	0
+ 1460      00000000 
+ 1461 0018 00000000 		.quad	0
+ 1461      00000000 
+ 1462              		.section	.debug_line,"",@progbits
+ 1463              	.Ldebug_line0:
+ 1464 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1464      05000800 
+ 1464      49000000 
+ 1464      010101FB 
+ 1464      0E0D0001 
+ 1465              	.LASF20:
+ 1466 0000 736F6674 		.string	"soft_data"
+ 1466      5F646174 
+ 1466      6100
+ 1467              	.LASF12:
+ 1468 000a 73697A65 		.string	"size_t"
+GAS LISTING /tmp/ccTsod4R.s 			page 65
+
+
+ 1468      5F7400
+ 1469              	.LASF13:
+ 1470 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1470      6D61705F 
+ 1470      636F6C6F 
+ 1470      72736368 
+ 1470      656D655F 
+ 1471              	.LASF24:
+ 1472 0027 6D697865 		.string	"mixed_exp_data"
+ 1472      645F6578 
+ 1472      705F6461 
+ 1472      746100
+ 1473              	.LASF26:
+ 1474 0036 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1474      43313720 
+ 1474      31322E32 
+ 1474      2E30202D 
+ 1474      6D74756E 
+ 1475              	.LASF6:
+ 1476 0095 666C6F61 		.string	"float"
+ 1476      7400
+ 1477              	.LASF16:
+ 1478 009b 68656174 		.string	"heatmap_cs_Greens_mixed"
+ 1478      6D61705F 
+ 1478      63735F47 
+ 1478      7265656E 
+ 1478      735F6D69 
+ 1479              	.LASF11:
+ 1480 00b3 756E7369 		.string	"unsigned char"
+ 1480      676E6564 
+ 1480      20636861 
+ 1480      7200
+ 1481              	.LASF3:
+ 1482 00c1 6C6F6E67 		.string	"long unsigned int"
+ 1482      20756E73 
+ 1482      69676E65 
+ 1482      6420696E 
+ 1482      7400
+ 1483              	.LASF8:
+ 1484 00d3 73686F72 		.string	"short unsigned int"
+ 1484      7420756E 
+ 1484      7369676E 
+ 1484      65642069 
+ 1484      6E7400
+ 1485              	.LASF14:
+ 1486 00e6 68656174 		.string	"heatmap_cs_Greens_discrete"
+ 1486      6D61705F 
+ 1486      63735F47 
+ 1486      7265656E 
+ 1486      735F6469 
+ 1487              	.LASF25:
+ 1488 0101 6D697865 		.string	"mixed_exp"
+ 1488      645F6578 
+ 1488      7000
+ 1489              	.LASF23:
+ 1490 010b 6D697865 		.string	"mixed"
+ 1490      6400
+GAS LISTING /tmp/ccTsod4R.s 			page 66
+
+
+ 1491              	.LASF7:
+ 1492 0111 756E7369 		.string	"unsigned int"
+ 1492      676E6564 
+ 1492      20696E74 
+ 1492      00
+ 1493              	.LASF19:
+ 1494 011e 64697363 		.string	"discrete"
+ 1494      72657465 
+ 1494      00
+ 1495              	.LASF10:
+ 1496 0127 6E636F6C 		.string	"ncolors"
+ 1496      6F727300 
+ 1497              	.LASF4:
+ 1498 012f 6C6F6E67 		.string	"long long int"
+ 1498      206C6F6E 
+ 1498      6720696E 
+ 1498      7400
+ 1499              	.LASF17:
+ 1500 013d 68656174 		.string	"heatmap_cs_Greens_mixed_exp"
+ 1500      6D61705F 
+ 1500      63735F47 
+ 1500      7265656E 
+ 1500      735F6D69 
+ 1501              	.LASF22:
+ 1502 0159 6D697865 		.string	"mixed_data"
+ 1502      645F6461 
+ 1502      746100
+ 1503              	.LASF2:
+ 1504 0164 6C6F6E67 		.string	"long int"
+ 1504      20696E74 
+ 1504      00
+ 1505              	.LASF5:
+ 1506 016d 6C6F6E67 		.string	"long double"
+ 1506      20646F75 
+ 1506      626C6500 
+ 1507              	.LASF18:
+ 1508 0179 64697363 		.string	"discrete_data"
+ 1508      72657465 
+ 1508      5F646174 
+ 1508      6100
+ 1509              	.LASF21:
+ 1510 0187 736F6674 		.string	"soft"
+ 1510      00
+ 1511              	.LASF9:
+ 1512 018c 636F6C6F 		.string	"colors"
+ 1512      727300
+ 1513              	.LASF15:
+ 1514 0193 68656174 		.string	"heatmap_cs_Greens_soft"
+ 1514      6D61705F 
+ 1514      63735F47 
+ 1514      7265656E 
+ 1514      735F736F 
+ 1515              		.section	.debug_line_str,"MS",@progbits,1
+ 1516              	.LASF1:
+ 1517 0000 2F726F6F 		.string	"/root/repo"
+ 1517      742F7265 
+ 1517      706F00
+GAS LISTING /tmp/ccTsod4R.s 			page 67
+
+
+ 1518              	.LASF0:
+ 1519 000b 636F6C6F 		.string	"colorschemes/Greens.c"
+ 1519      72736368 
+ 1519      656D6573 
+ 1519      2F477265 
+ 1519      656E732E 
+ 1520              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1521 0021 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1521      742F7265 
+ 1521      706F0063 
+ 1521      6F6C6F72 
+ 1521      73636865 
@@ -0,0 +1,3831 @@
+GAS LISTING /tmp/cc9MX8t6.s 			page 1
+
+
+   1              		.file	"Greys.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/Greys.c"
+   5              		.globl	heatmap_cs_Greys_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_Greys_mixed_exp, @object
+   9              		.size	heatmap_cs_Greys_mixed_exp, 8
+  10              	heatmap_cs_Greys_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 00       		.string	""
+  29 0005 00       		.string	""
+  30 0006 00       		.string	""
+  31 0007 00       		.string	""
+  32 0008 03030318 		.ascii	"\003\003\003\030\006\006\0061\t\t\tJ\f\f\fc\016\016\016|\020"
+  32      06060631 
+  32      0909094A 
+  32      0C0C0C63 
+  32      0E0E0E7C 
+  33 001d 10109519 		.ascii	"\020\020\225\031\031\031\256\033\033\033\307\035\035\035\340"
+  33      1919AE1B 
+  33      1B1BC71D 
+  33      1D1DE0
+  34 002c 1E1E1EF9 		.ascii	"\036\036\036\371   \377\"\"\"\377$$$\377%%%\377(((\377***\377"
+  34      202020FF 
+  34      222222FF 
+  34      242424FF 
+  34      252525FF 
+  35 0048 2C2C2CFF 		.ascii	",,,\377///\377111\377333\377666\377AAA\377DDD\377FFF\377HHH\377"
+  35      2F2F2FFF 
+  35      313131FF 
+  35      333333FF 
+  35      363636FF 
+  36 006c 4A4A4AFF 		.ascii	"JJJ\377MMM\377OOO\377QQQ\377SSS\377UUU\377VVV\377XXX\377YYY\377"
+  36      4D4D4DFF 
+  36      4F4F4FFF 
+  36      515151FF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 2
+
+
+  36      535353FF 
+  37 0090 5B5B5BFF 		.ascii	"[[[\377\\\\\\\377^^^\377fff\377ggg\377iii\377jjj\377kkk\377m"
+  37      5C5C5CFF 
+  37      5E5E5EFF 
+  37      666666FF 
+  37      676767FF 
+  38 00b1 6D6DFF6E 		.ascii	"mm\377nnn\377ppp\377qqq\377rrr\377ttt\377uuu\377www\377xxx\377"
+  38      6E6EFF70 
+  38      7070FF71 
+  38      7171FF72 
+  38      7272FF74 
+  39 00d4 797979FF 		.ascii	"yyy\377{{{\377|||\377}}}\377\177\177\177\377\200\200\200\377"
+  39      7B7B7BFF 
+  39      7C7C7CFF 
+  39      7D7D7DFF 
+  39      7F7F7FFF 
+  40 00ec 888888FF 		.ascii	"\210\210\210\377\212\212\212\377\213\213\213\377\214\214\214"
+  40      8A8A8AFF 
+  40      8B8B8BFF 
+  40      8C8C8C
+  41 00fb FF8D8D8D 		.ascii	"\377\215\215\215\377\217\217\217\377\220\220\220\377\221\221"
+  41      FF8F8F8F 
+  41      FF909090 
+  41      FF9191
+  42 010a 91FF9292 		.ascii	"\221\377\222\222\222\377\224\224\224\377\225\225\225\377\226"
+  42      92FF9494 
+  42      94FF9595 
+  42      95FF96
+  43 0119 9696FF97 		.ascii	"\226\226\377\227\227\227\377\231\231\231\377\232\232\232\377"
+  43      9797FF99 
+  43      9999FF9A 
+  43      9A9AFF
+  44 0128 9B9B9BFF 		.ascii	"\233\233\233\377\234\234\234\377\236\236\236\377\237\237\237"
+  44      9C9C9CFF 
+  44      9E9E9EFF 
+  44      9F9F9F
+  45 0137 FFA0A0A0 		.ascii	"\377\240\240\240\377\241\241\241\377\242\242\242\377\243\243"
+  45      FFA1A1A1 
+  45      FFA2A2A2 
+  45      FFA3A3
+  46 0146 A3FFA5A5 		.ascii	"\243\377\245\245\245\377\256\256\256\377\257\257\257\377\260"
+  46      A5FFAEAE 
+  46      AEFFAFAF 
+  46      AFFFB0
+  47 0155 B0B0FFB1 		.ascii	"\260\260\377\261\261\261\377\262\262\262\377\263\263\263\377"
+  47      B1B1FFB2 
+  47      B2B2FFB3 
+  47      B3B3FF
+  48 0164 B4B4B4FF 		.ascii	"\264\264\264\377\265\265\265\377\267\267\267\377\270\270\270"
+  48      B5B5B5FF 
+  48      B7B7B7FF 
+  48      B8B8B8
+  49 0173 FFB9B9B9 		.ascii	"\377\271\271\271\377\272\272\272\377\273\273\273\377\274\274"
+  49      FFBABABA 
+  49      FFBBBBBB 
+  49      FFBCBC
+  50 0182 BCFFBDBD 		.ascii	"\274\377\275\275\275\377\275\275\275\377\276\276\276\377\277"
+GAS LISTING /tmp/cc9MX8t6.s 			page 3
+
+
+  50      BDFFBDBD 
+  50      BDFFBEBE 
+  50      BEFFBF
+  51 0191 BFBFFFC0 		.ascii	"\277\277\377\300\300\300\377\300\300\300\377\301\301\301\377"
+  51      C0C0FFC0 
+  51      C0C0FFC1 
+  51      C1C1FF
+  52 01a0 C2C2C2FF 		.ascii	"\302\302\302\377\302\302\302\377\303\303\303\377\304\304\304"
+  52      C2C2C2FF 
+  52      C3C3C3FF 
+  52      C4C4C4
+  53 01af FFC4C4C4 		.ascii	"\377\304\304\304\377\305\305\305\377\305\305\305\377\306\306"
+  53      FFC5C5C5 
+  53      FFC5C5C5 
+  53      FFC6C6
+  54 01be C6FFC7C7 		.ascii	"\306\377\307\307\307\377\307\307\307\377\316\316\316\377\316"
+  54      C7FFC7C7 
+  54      C7FFCECE 
+  54      CEFFCE
+  55 01cd CECEFFCF 		.ascii	"\316\316\377\317\317\317\377\317\317\317\377\320\320\320\377"
+  55      CFCFFFCF 
+  55      CFCFFFD0 
+  55      D0D0FF
+  56 01dc D1D1D1FF 		.ascii	"\321\321\321\377\321\321\321\377\322\322\322\377\322\322\322"
+  56      D1D1D1FF 
+  56      D2D2D2FF 
+  56      D2D2D2
+  57 01eb FFD3D3D3 		.ascii	"\377\323\323\323\377\323\323\323\377\324\324\324\377\325\325"
+  57      FFD3D3D3 
+  57      FFD4D4D4 
+  57      FFD5D5
+  58 01fa D5FFD5D5 		.ascii	"\325\377\325\325\325\377\326\326\326\377\326\326\326\377\327"
+  58      D5FFD6D6 
+  58      D6FFD6D6 
+  58      D6FFD7
+  59 0209 D7D7FFD7 		.ascii	"\327\327\377\327\327\327\377\330\330\330\377\330\330\330\377"
+  59      D7D7FFD8 
+  59      D8D8FFD8 
+  59      D8D8FF
+  60 0218 D9D9D9FF 		.ascii	"\331\331\331\377\331\331\331\377\331\331\331\377\332\332\332"
+  60      D9D9D9FF 
+  60      D9D9D9FF 
+  60      DADADA
+  61 0227 FFDADADA 		.ascii	"\377\332\332\332\377\333\333\333\377\333\333\333\377\333\333"
+  61      FFDBDBDB 
+  61      FFDBDBDB 
+  61      FFDBDB
+  62 0236 DBFFDCDC 		.ascii	"\333\377\334\334\334\377\334\334\334\377\335\335\335\377\335"
+  62      DCFFDCDC 
+  62      DCFFDDDD 
+  62      DDFFDD
+  63 0245 DDDDFFDD 		.ascii	"\335\335\377\335\335\335\377\336\336\336\377\336\336\336\377"
+  63      DDDDFFDE 
+  63      DEDEFFDE 
+  63      DEDEFF
+  64 0254 DEDEDEFF 		.ascii	"\336\336\336\377\337\337\337\377\337\337\337\377\337\337\337"
+  64      DFDFDFFF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 4
+
+
+  64      DFDFDFFF 
+  64      DFDFDF
+  65 0263 FFE0E0E0 		.ascii	"\377\340\340\340\377\340\340\340\377\340\340\340\377\341\341"
+  65      FFE0E0E0 
+  65      FFE0E0E0 
+  65      FFE1E1
+  66 0272 E1FFE1E1 		.ascii	"\341\377\341\341\341\377\341\341\341\377\346\346\346\377\347"
+  66      E1FFE1E1 
+  66      E1FFE6E6 
+  66      E6FFE7
+  67 0281 E7E7FFE7 		.ascii	"\347\347\377\347\347\347\377\347\347\347\377\350\350\350\377"
+  67      E7E7FFE7 
+  67      E7E7FFE8 
+  67      E8E8FF
+  68 0290 E8E8E8FF 		.ascii	"\350\350\350\377\350\350\350\377\350\350\350\377\351\351\351"
+  68      E8E8E8FF 
+  68      E8E8E8FF 
+  68      E9E9E9
+  69 029f FFE9E9E9 		.ascii	"\377\351\351\351\377\351\351\351\377\352\352\352\377\352\352"
+  69      FFE9E9E9 
+  69      FFEAEAEA 
+  69      FFEAEA
+  70 02ae EAFFEAEA 		.ascii	"\352\377\352\352\352\377\352\352\352\377\353\353\353\377\353"
+  70      EAFFEAEA 
+  70      EAFFEBEB 
+  70      EBFFEB
+  71 02bd EBEBFFEB 		.ascii	"\353\353\377\353\353\353\377\354\354\354\377\354\354\354\377"
+  71      EBEBFFEC 
+  71      ECECFFEC 
+  71      ECECFF
+  72 02cc ECECECFF 		.ascii	"\354\354\354\377\354\354\354\377\355\355\355\377\355\355\355"
+  72      ECECECFF 
+  72      EDEDEDFF 
+  72      EDEDED
+  73 02db FFEDEDED 		.ascii	"\377\355\355\355\377\355\355\355\377\356\356\356\377\356\356"
+  73      FFEDEDED 
+  73      FFEEEEEE 
+  73      FFEEEE
+  74 02ea EEFFEEEE 		.ascii	"\356\377\356\356\356\377\356\356\356\377\357\357\357\377\357"
+  74      EEFFEEEE 
+  74      EEFFEFEF 
+  74      EFFFEF
+  75 02f9 EFEFFFEF 		.ascii	"\357\357\377\357\357\357\377\357\357\357\377\357\357\357\377"
+  75      EFEFFFEF 
+  75      EFEFFFEF 
+  75      EFEFFF
+  76 0308 F0F0F0FF 		.ascii	"\360\360\360\377\360\360\360\377\360\360\360\377\360\360\360"
+  76      F0F0F0FF 
+  76      F0F0F0FF 
+  76      F0F0F0
+  77 0317 FFF0F0F0 		.ascii	"\377\360\360\360\377\360\360\360\377\360\360\360\377\361\361"
+  77      FFF0F0F0 
+  77      FFF0F0F0 
+  77      FFF1F1
+  78 0326 F1FFF1F1 		.ascii	"\361\377\361\361\361\377\361\361\361\377\361\361\361\377\361"
+  78      F1FFF1F1 
+  78      F1FFF1F1 
+GAS LISTING /tmp/cc9MX8t6.s 			page 5
+
+
+  78      F1FFF1
+  79 0335 F1F1FFF1 		.ascii	"\361\361\377\361\361\361\377\361\361\361\377\361\361\361\377"
+  79      F1F1FFF1 
+  79      F1F1FFF1 
+  79      F1F1FF
+  80 0344 F2F2F2FF 		.ascii	"\362\362\362\377\362\362\362\377\362\362\362\377\362\362\362"
+  80      F2F2F2FF 
+  80      F2F2F2FF 
+  80      F2F2F2
+  81 0353 FFF2F2F2 		.ascii	"\377\362\362\362\377\362\362\362\377\362\362\362\377\362\362"
+  81      FFF2F2F2 
+  81      FFF2F2F2 
+  81      FFF2F2
+  82 0362 F2FFF3F3 		.ascii	"\362\377\363\363\363\377\363\363\363\377\363\363\363\377\363"
+  82      F3FFF3F3 
+  82      F3FFF3F3 
+  82      F3FFF3
+  83 0371 F3F3FFF3 		.ascii	"\363\363\377\363\363\363\377\363\363\363\377\363\363\363\377"
+  83      F3F3FFF3 
+  83      F3F3FFF3 
+  83      F3F3FF
+  84 0380 F3F3F3FF 		.ascii	"\363\363\363\377\363\363\363\377\363\363\363\377\364\364\364"
+  84      F3F3F3FF 
+  84      F3F3F3FF 
+  84      F4F4F4
+  85 038f FFF4F4F4 		.ascii	"\377\364\364\364\377\364\364\364\377\364\364\364\377\364\364"
+  85      FFF4F4F4 
+  85      FFF4F4F4 
+  85      FFF4F4
+  86 039e F4FFF4F4 		.ascii	"\364\377\364\364\364\377\364\364\364\377\364\364\364\377\364"
+  86      F4FFF4F4 
+  86      F4FFF4F4 
+  86      F4FFF4
+  87 03ad F4F4FFF4 		.ascii	"\364\364\377\364\364\364\377\364\364\364\377\365\365\365\377"
+  87      F4F4FFF4 
+  87      F4F4FFF5 
+  87      F5F5FF
+  88 03bc F5F5F5FF 		.ascii	"\365\365\365\377\365\365\365\377\365\365\365\377\365\365\365"
+  88      F5F5F5FF 
+  88      F5F5F5FF 
+  88      F5F5F5
+  89 03cb FFF5F5F5 		.ascii	"\377\365\365\365\377\365\365\365\377\365\365\365\377\365\365"
+  89      FFF5F5F5 
+  89      FFF5F5F5 
+  89      FFF5F5
+  90 03da F5FFF5F5 		.ascii	"\365\377\365\365\365\377\365\365\365\377\370\370\370\377\371"
+  90      F5FFF5F5 
+  90      F5FFF8F8 
+  90      F8FFF9
+  91 03e9 F9F9FFF9 		.ascii	"\371\371\377\371\371\371\377\371\371\371\377\371\371\371\377"
+  91      F9F9FFF9 
+  91      F9F9FFF9 
+  91      F9F9FF
+  92 03f8 F9F9F9FF 		.ascii	"\371\371\371\377\371\371\371\377\371\371\371\377\371\371\371"
+  92      F9F9F9FF 
+  92      F9F9F9FF 
+  92      F9F9F9
+GAS LISTING /tmp/cc9MX8t6.s 			page 6
+
+
+  93 0407 FFF9F9F9 		.ascii	"\377\371\371\371\377\371\371\371\377\371\371\371\377\371\371"
+  93      FFF9F9F9 
+  93      FFF9F9F9 
+  93      FFF9F9
+  94 0416 F9FFF9F9 		.ascii	"\371\377\371\371\371\377\371\371\371\377\372\372\372\377\372"
+  94      F9FFF9F9 
+  94      F9FFFAFA 
+  94      FAFFFA
+  95 0425 FAFAFFFA 		.ascii	"\372\372\377\372\372\372\377\372\372\372\377\372\372\372\377"
+  95      FAFAFFFA 
+  95      FAFAFFFA 
+  95      FAFAFF
+  96 0434 FAFAFAFF 		.ascii	"\372\372\372\377\372\372\372\377\372\372\372\377\372\372\372"
+  96      FAFAFAFF 
+  96      FAFAFAFF 
+  96      FAFAFA
+  97 0443 FFFAFAFA 		.ascii	"\377\372\372\372\377\372\372\372\377\372\372\372\377\372\372"
+  97      FFFAFAFA 
+  97      FFFAFAFA 
+  97      FFFAFA
+  98 0452 FAFFFAFA 		.ascii	"\372\377\372\372\372\377\372\372\372\377\372\372\372\377\372"
+  98      FAFFFAFA 
+  98      FAFFFAFA 
+  98      FAFFFA
+  99 0461 FAFAFFFB 		.ascii	"\372\372\377\373\373\373\377\373\373\373\377\373\373\373\377"
+  99      FBFBFFFB 
+  99      FBFBFFFB 
+  99      FBFBFF
+ 100 0470 FBFBFBFF 		.ascii	"\373\373\373\377\373\373\373\377\373\373\373\377\373\373\373"
+ 100      FBFBFBFF 
+ 100      FBFBFBFF 
+ 100      FBFBFB
+ 101 047f FFFBFBFB 		.ascii	"\377\373\373\373\377\373\373\373\377\373\373\373\377\373\373"
+ 101      FFFBFBFB 
+ 101      FFFBFBFB 
+ 101      FFFBFB
+ 102 048e FBFFFBFB 		.ascii	"\373\377\373\373\373\377\373\373\373\377\373\373\373\377\373"
+ 102      FBFFFBFB 
+ 102      FBFFFBFB 
+ 102      FBFFFB
+ 103 049d FBFBFFFB 		.ascii	"\373\373\377\373\373\373\377\373\373\373\377\373\373\373\377"
+ 103      FBFBFFFB 
+ 103      FBFBFFFB 
+ 103      FBFBFF
+ 104 04ac FBFBFBFF 		.ascii	"\373\373\373\377\373\373\373\377\373\373\373\377\374\374\374"
+ 104      FBFBFBFF 
+ 104      FBFBFBFF 
+ 104      FCFCFC
+ 105 04bb FFFCFCFC 		.ascii	"\377\374\374\374\377\374\374\374\377\374\374\374\377\374\374"
+ 105      FFFCFCFC 
+ 105      FFFCFCFC 
+ 105      FFFCFC
+ 106 04ca FCFFFCFC 		.ascii	"\374\377\374\374\374\377\374\374\374\377\374\374\374\377\374"
+ 106      FCFFFCFC 
+ 106      FCFFFCFC 
+ 106      FCFFFC
+ 107 04d9 FCFCFFFC 		.ascii	"\374\374\377\374\374\374\377\374\374\374\377\374\374\374\377"
+GAS LISTING /tmp/cc9MX8t6.s 			page 7
+
+
+ 107      FCFCFFFC 
+ 107      FCFCFFFC 
+ 107      FCFCFF
+ 108 04e8 FCFCFCFF 		.ascii	"\374\374\374\377\374\374\374\377\374\374\374\377\374\374\374"
+ 108      FCFCFCFF 
+ 108      FCFCFCFF 
+ 108      FCFCFC
+ 109 04f7 FFFCFCFC 		.ascii	"\377\374\374\374\377\374\374\374\377\374\374\374\377\374\374"
+ 109      FFFCFCFC 
+ 109      FFFCFCFC 
+ 109      FFFCFC
+ 110 0506 FCFFFCFC 		.ascii	"\374\377\374\374\374\377\374\374\374\377\374\374\374\377\374"
+ 110      FCFFFCFC 
+ 110      FCFFFCFC 
+ 110      FCFFFC
+ 111 0515 FCFCFFFC 		.ascii	"\374\374\377\374\374\374\377\374\374\374\377\374\374\374\377"
+ 111      FCFCFFFC 
+ 111      FCFCFFFC 
+ 111      FCFCFF
+ 112 0524 FCFCFCFF 		.ascii	"\374\374\374\377\374\374\374\377\375\375\375\377\375\375\375"
+ 112      FCFCFCFF 
+ 112      FDFDFDFF 
+ 112      FDFDFD
+ 113 0533 FFFDFDFD 		.ascii	"\377\375\375\375\377\375\375\375\377\375\375\375\377\375\375"
+ 113      FFFDFDFD 
+ 113      FFFDFDFD 
+ 113      FFFDFD
+ 114 0542 FDFFFDFD 		.ascii	"\375\377\375\375\375\377\375\375\375\377\375\375\375\377\375"
+ 114      FDFFFDFD 
+ 114      FDFFFDFD 
+ 114      FDFFFD
+ 115 0551 FDFDFFFD 		.ascii	"\375\375\377\375\375\375\377\375\375\375\377\375\375\375\377"
+ 115      FDFDFFFD 
+ 115      FDFDFFFD 
+ 115      FDFDFF
+ 116 0560 FDFDFDFF 		.ascii	"\375\375\375\377\375\375\375\377\375\375\375\377\375\375\375"
+ 116      FDFDFDFF 
+ 116      FDFDFDFF 
+ 116      FDFDFD
+ 117 056f FFFDFDFD 		.ascii	"\377\375\375\375\377\375\375\375\377\375\375\375\377\375\375"
+ 117      FFFDFDFD 
+ 117      FFFDFDFD 
+ 117      FFFDFD
+ 118 057e FDFFFDFD 		.ascii	"\375\377\375\375\375\377\375\375\375\377\375\375\375\377\375"
+ 118      FDFFFDFD 
+ 118      FDFFFDFD 
+ 118      FDFFFD
+ 119 058d FDFDFFFD 		.ascii	"\375\375\377\375\375\375\377\375\375\375\377\375\375\375\377"
+ 119      FDFDFFFD 
+ 119      FDFDFFFD 
+ 119      FDFDFF
+ 120 059c FDFDFDFF 		.ascii	"\375\375\375\377\375\375\375\377\375\375\375\377\375\375\375"
+ 120      FDFDFDFF 
+ 120      FDFDFDFF 
+ 120      FDFDFD
+ 121 05ab FFFDFDFD 		.ascii	"\377\375\375\375\377\375\375\375\377\375\375\375\377\375\375"
+ 121      FFFDFDFD 
+GAS LISTING /tmp/cc9MX8t6.s 			page 8
+
+
+ 121      FFFDFDFD 
+ 121      FFFDFD
+ 122 05ba FDFFFDFD 		.ascii	"\375\377\375\375\375\377\375\375\375\377\375\375\375\377\375"
+ 122      FDFFFDFD 
+ 122      FDFFFDFD 
+ 122      FDFFFD
+ 123 05c9 FDFDFFFD 		.ascii	"\375\375\377\375\375\375\377\375\375\375\377\375\375\375\377"
+ 123      FDFDFFFD 
+ 123      FDFDFFFD 
+ 123      FDFDFF
+ 124 05d8 FDFDFDFF 		.ascii	"\375\375\375\377\375\375\375\377\375\375\375\377\376\376\376"
+ 124      FDFDFDFF 
+ 124      FDFDFDFF 
+ 124      FEFEFE
+ 125 05e7 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 125      FFFEFEFE 
+ 125      FFFEFEFE 
+ 125      FFFEFE
+ 126 05f6 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 126      FEFFFEFE 
+ 126      FEFFFEFE 
+ 126      FEFFFE
+ 127 0605 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 127      FEFEFFFE 
+ 127      FEFEFFFE 
+ 127      FEFEFF
+ 128 0614 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 128      FEFEFEFF 
+ 128      FEFEFEFF 
+ 128      FEFEFE
+ 129 0623 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 129      FFFEFEFE 
+ 129      FFFEFEFE 
+ 129      FFFEFE
+ 130 0632 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 130      FEFFFEFE 
+ 130      FEFFFEFE 
+ 130      FEFFFE
+ 131 0641 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 131      FEFEFFFE 
+ 131      FEFEFFFE 
+ 131      FEFEFF
+ 132 0650 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 132      FEFEFEFF 
+ 132      FEFEFEFF 
+ 132      FEFEFE
+ 133 065f FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 133      FFFEFEFE 
+ 133      FFFEFEFE 
+ 133      FFFEFE
+ 134 066e FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 134      FEFFFEFE 
+ 134      FEFFFEFE 
+ 134      FEFFFE
+ 135 067d FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 135      FEFEFFFE 
+ 135      FEFEFFFE 
+GAS LISTING /tmp/cc9MX8t6.s 			page 9
+
+
+ 135      FEFEFF
+ 136 068c FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 136      FEFEFEFF 
+ 136      FEFEFEFF 
+ 136      FEFEFE
+ 137 069b FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 137      FFFEFEFE 
+ 137      FFFEFEFE 
+ 137      FFFEFE
+ 138 06aa FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 138      FEFFFEFE 
+ 138      FEFFFEFE 
+ 138      FEFFFE
+ 139 06b9 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 139      FEFEFFFE 
+ 139      FEFEFFFE 
+ 139      FEFEFF
+ 140 06c8 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 140      FEFEFEFF 
+ 140      FEFEFEFF 
+ 140      FEFEFE
+ 141 06d7 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 141      FFFEFEFE 
+ 141      FFFEFEFE 
+ 141      FFFEFE
+ 142 06e6 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 142      FEFFFEFE 
+ 142      FEFFFEFE 
+ 142      FEFFFE
+ 143 06f5 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 143      FEFEFFFE 
+ 143      FEFEFFFE 
+ 143      FEFEFF
+ 144 0704 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 144      FEFEFEFF 
+ 144      FEFEFEFF 
+ 144      FEFEFE
+ 145 0713 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 145      FFFEFEFE 
+ 145      FFFEFEFE 
+ 145      FFFEFE
+ 146 0722 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 146      FEFFFEFE 
+ 146      FEFFFEFE 
+ 146      FEFFFE
+ 147 0731 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 147      FEFEFFFE 
+ 147      FEFEFFFE 
+ 147      FEFEFF
+ 148 0740 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 148      FEFEFEFF 
+ 148      FEFEFEFF 
+ 148      FEFEFE
+ 149 074f FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 149      FFFEFEFE 
+ 149      FFFEFEFE 
+ 149      FFFEFE
+GAS LISTING /tmp/cc9MX8t6.s 			page 10
+
+
+ 150 075e FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 150      FEFFFEFE 
+ 150      FEFFFEFE 
+ 150      FEFFFE
+ 151 076d FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 151      FEFEFFFE 
+ 151      FEFEFFFE 
+ 151      FEFEFF
+ 152 077c FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 152      FEFEFEFF 
+ 152      FEFEFEFF 
+ 152      FEFEFE
+ 153 078b FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 153      FFFEFEFE 
+ 153      FFFEFEFE 
+ 153      FFFEFE
+ 154 079a FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 154      FEFFFEFE 
+ 154      FEFFFEFE 
+ 154      FEFFFE
+ 155 07a9 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 155      FEFEFFFE 
+ 155      FEFEFFFE 
+ 155      FEFEFF
+ 156 07b8 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 156      FEFEFEFF 
+ 156      FEFEFEFF 
+ 156      FEFEFE
+ 157 07c7 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377"
+ 157      FFFEFEFE 
+ 157      FF
+ 158 07d0 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 158      FEFEFEFF 
+ 158      FEFEFEFF 
+ 158      FEFEFE
+ 159 07df FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 159      FFFEFEFE 
+ 159      FFFEFEFE 
+ 159      FFFEFE
+ 160 07ee FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 160      FEFFFEFE 
+ 160      FEFFFEFE 
+ 160      FEFFFE
+ 161 07fd FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 161      FEFEFFFE 
+ 161      FEFEFFFE 
+ 161      FEFEFF
+ 162 080c FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 162      FEFEFEFF 
+ 162      FEFEFEFF 
+ 162      FEFEFE
+ 163 081b FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 163      FFFEFEFE 
+ 163      FFFEFEFE 
+ 163      FFFEFE
+ 164 082a FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 164      FEFFFEFE 
+GAS LISTING /tmp/cc9MX8t6.s 			page 11
+
+
+ 164      FEFFFEFE 
+ 164      FEFFFE
+ 165 0839 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 165      FEFEFFFE 
+ 165      FEFEFFFE 
+ 165      FEFEFF
+ 166 0848 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 166      FEFEFEFF 
+ 166      FEFEFEFF 
+ 166      FEFEFE
+ 167 0857 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 167      FFFEFEFE 
+ 167      FFFEFEFE 
+ 167      FFFEFE
+ 168 0866 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 168      FEFFFEFE 
+ 168      FEFFFEFE 
+ 168      FEFFFE
+ 169 0875 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 169      FEFEFFFE 
+ 169      FEFEFFFE 
+ 169      FEFEFF
+ 170 0884 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 170      FEFEFEFF 
+ 170      FEFEFEFF 
+ 170      FEFEFE
+ 171 0893 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 171      FFFEFEFE 
+ 171      FFFEFEFE 
+ 171      FFFEFE
+ 172 08a2 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 172      FEFFFEFE 
+ 172      FEFFFEFE 
+ 172      FEFFFE
+ 173 08b1 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 173      FEFEFFFE 
+ 173      FEFEFFFE 
+ 173      FEFEFF
+ 174 08c0 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 174      FEFEFEFF 
+ 174      FEFEFEFF 
+ 174      FEFEFE
+ 175 08cf FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 175      FFFEFEFE 
+ 175      FFFEFEFE 
+ 175      FFFEFE
+ 176 08de FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 176      FEFFFEFE 
+ 176      FEFFFEFE 
+ 176      FEFFFE
+ 177 08ed FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 177      FEFEFFFE 
+ 177      FEFEFFFE 
+ 177      FEFEFF
+ 178 08fc FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 178      FEFEFEFF 
+ 178      FEFEFEFF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 12
+
+
+ 178      FEFEFE
+ 179 090b FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 179      FFFEFEFE 
+ 179      FFFEFEFE 
+ 179      FFFEFE
+ 180 091a FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 180      FEFFFEFE 
+ 180      FEFFFEFE 
+ 180      FEFFFE
+ 181 0929 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 181      FEFEFFFE 
+ 181      FEFEFFFE 
+ 181      FEFEFF
+ 182 0938 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 182      FEFEFEFF 
+ 182      FEFEFEFF 
+ 182      FEFEFE
+ 183 0947 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 183      FFFEFEFE 
+ 183      FFFEFEFE 
+ 183      FFFEFE
+ 184 0956 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 184      FEFFFEFE 
+ 184      FEFFFEFE 
+ 184      FEFFFE
+ 185 0965 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 185      FEFEFFFE 
+ 185      FEFEFFFE 
+ 185      FEFEFF
+ 186 0974 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 186      FEFEFEFF 
+ 186      FEFEFEFF 
+ 186      FEFEFE
+ 187 0983 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 187      FFFEFEFE 
+ 187      FFFEFEFE 
+ 187      FFFEFE
+ 188 0992 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 188      FEFFFEFE 
+ 188      FEFFFEFE 
+ 188      FEFFFE
+ 189 09a1 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 189      FEFEFFFE 
+ 189      FEFEFFFE 
+ 189      FEFEFF
+ 190 09b0 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 190      FEFEFEFF 
+ 190      FEFEFEFF 
+ 190      FEFEFE
+ 191 09bf FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 191      FFFEFEFE 
+ 191      FFFEFEFE 
+ 191      FFFEFE
+ 192 09ce FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 192      FEFFFEFE 
+ 192      FEFFFEFE 
+ 192      FEFFFE
+GAS LISTING /tmp/cc9MX8t6.s 			page 13
+
+
+ 193 09dd FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 193      FEFEFFFE 
+ 193      FEFEFFFE 
+ 193      FEFEFF
+ 194 09ec FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 194      FEFEFEFF 
+ 194      FEFEFEFF 
+ 194      FEFEFE
+ 195 09fb FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 195      FFFEFEFE 
+ 195      FFFEFEFE 
+ 195      FFFEFE
+ 196 0a0a FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 196      FEFFFEFE 
+ 196      FEFFFEFE 
+ 196      FEFFFE
+ 197 0a19 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 197      FEFEFFFE 
+ 197      FEFEFFFE 
+ 197      FEFEFF
+ 198 0a28 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 198      FEFEFEFF 
+ 198      FEFEFEFF 
+ 198      FEFEFE
+ 199 0a37 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 199      FFFEFEFE 
+ 199      FFFEFEFE 
+ 199      FFFEFE
+ 200 0a46 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 200      FEFFFEFE 
+ 200      FEFFFEFE 
+ 200      FEFFFE
+ 201 0a55 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 201      FEFEFFFE 
+ 201      FEFEFFFE 
+ 201      FEFEFF
+ 202 0a64 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 202      FEFEFEFF 
+ 202      FEFEFEFF 
+ 202      FEFEFE
+ 203 0a73 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 203      FFFEFEFE 
+ 203      FFFEFEFE 
+ 203      FFFEFE
+ 204 0a82 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 204      FEFFFEFE 
+ 204      FEFFFEFE 
+ 204      FEFFFE
+ 205 0a91 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 205      FEFEFFFE 
+ 205      FEFEFFFE 
+ 205      FEFEFF
+ 206 0aa0 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 206      FEFEFEFF 
+ 206      FEFEFEFF 
+ 206      FEFEFE
+ 207 0aaf FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+GAS LISTING /tmp/cc9MX8t6.s 			page 14
+
+
+ 207      FFFEFEFE 
+ 207      FFFEFEFE 
+ 207      FFFEFE
+ 208 0abe FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 208      FEFFFEFE 
+ 208      FEFFFEFE 
+ 208      FEFFFE
+ 209 0acd FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 209      FEFEFFFE 
+ 209      FEFEFFFE 
+ 209      FEFEFF
+ 210 0adc FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 210      FEFEFEFF 
+ 210      FEFEFEFF 
+ 210      FEFEFE
+ 211 0aeb FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 211      FFFEFEFE 
+ 211      FFFEFEFE 
+ 211      FFFEFE
+ 212 0afa FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 212      FEFFFEFE 
+ 212      FEFFFEFE 
+ 212      FEFFFE
+ 213 0b09 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 213      FEFEFFFE 
+ 213      FEFEFFFE 
+ 213      FEFEFF
+ 214 0b18 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 214      FEFEFEFF 
+ 214      FEFEFEFF 
+ 214      FEFEFE
+ 215 0b27 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 215      FFFEFEFE 
+ 215      FFFEFEFE 
+ 215      FFFEFE
+ 216 0b36 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 216      FEFFFEFE 
+ 216      FEFFFEFE 
+ 216      FEFFFE
+ 217 0b45 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 217      FEFEFFFE 
+ 217      FEFEFFFE 
+ 217      FEFEFF
+ 218 0b54 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 218      FEFEFEFF 
+ 218      FEFEFEFF 
+ 218      FEFEFE
+ 219 0b63 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 219      FFFEFEFE 
+ 219      FFFEFEFE 
+ 219      FFFEFE
+ 220 0b72 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 220      FEFFFEFE 
+ 220      FEFFFEFE 
+ 220      FEFFFE
+ 221 0b81 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 221      FEFEFFFE 
+GAS LISTING /tmp/cc9MX8t6.s 			page 15
+
+
+ 221      FEFEFFFE 
+ 221      FEFEFF
+ 222 0b90 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 222      FEFEFEFF 
+ 222      FEFEFEFF 
+ 222      FEFEFE
+ 223 0b9f FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 223      FFFEFEFE 
+ 223      FFFEFEFE 
+ 223      FFFEFE
+ 224 0bae FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 224      FEFFFEFE 
+ 224      FEFFFEFE 
+ 224      FEFFFE
+ 225 0bbd FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 225      FEFEFFFE 
+ 225      FEFEFFFE 
+ 225      FEFEFF
+ 226 0bcc FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 226      FEFEFEFF 
+ 226      FEFEFEFF 
+ 226      FEFEFE
+ 227 0bdb FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 227      FFFEFEFE 
+ 227      FFFEFEFE 
+ 227      FFFEFE
+ 228 0bea FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 228      FEFFFEFE 
+ 228      FEFFFEFE 
+ 228      FEFFFE
+ 229 0bf9 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 229      FEFEFFFE 
+ 229      FEFEFFFE 
+ 229      FEFEFF
+ 230 0c08 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 230      FEFEFEFF 
+ 230      FEFEFEFF 
+ 230      FEFEFE
+ 231 0c17 FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 231      FFFEFEFE 
+ 231      FFFEFEFE 
+ 231      FFFEFE
+ 232 0c26 FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377\376\376\376\377\376"
+ 232      FEFFFEFE 
+ 232      FEFFFEFE 
+ 232      FEFFFE
+ 233 0c35 FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\376\376\376\377\376\376\376\377"
+ 233      FEFEFFFE 
+ 233      FEFEFFFE 
+ 233      FEFEFF
+ 234 0c44 FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\377\376\376"
+ 234      FEFEFEFF 
+ 234      FEFEFEFF 
+ 234      FFFEFE
+ 235 0c53 FFFFFEFE 		.ascii	"\377\377\376\376\377\377\376\376\377\377\376\376\377\377\376"
+ 235      FFFFFEFE 
+ 235      FFFFFEFE 
+GAS LISTING /tmp/cc9MX8t6.s 			page 16
+
+
+ 235      FFFFFE
+ 236 0c62 FEFFFFFE 		.ascii	"\376\377\377\376\376\377\377\376\376\377\377\376\376\377\377"
+ 236      FEFFFFFE 
+ 236      FEFFFFFE 
+ 236      FEFFFF
+ 237 0c71 FEFEFFFF 		.ascii	"\376\376\377\377\376\376\377\377\376\376\377\377\376\376\377"
+ 237      FEFEFFFF 
+ 237      FEFEFFFF 
+ 237      FEFEFF
+ 238 0c80 FFFEFEFF 		.ascii	"\377\376\376\377\377\376\376\377\377\376\376\377\377\376\376"
+ 238      FFFEFEFF 
+ 238      FFFEFEFF 
+ 238      FFFEFE
+ 239 0c8f FFFFFEFE 		.ascii	"\377\377\376\376\377\377\376\376\377\377\376\376\377\377\376"
+ 239      FFFFFEFE 
+ 239      FFFFFEFE 
+ 239      FFFFFE
+ 240 0c9e FEFFFFFE 		.ascii	"\376\377\377\376\376\377\377\376\376\377\377\376\376\377\377"
+ 240      FEFFFFFE 
+ 240      FEFFFFFE 
+ 240      FEFFFF
+ 241 0cad FEFEFFFF 		.ascii	"\376\376\377\377\376\376\377\377\376\376\377\377\376\376\377"
+ 241      FEFEFFFF 
+ 241      FEFEFFFF 
+ 241      FEFEFF
+ 242 0cbc FFFEFEFF 		.ascii	"\377\376\376\377\377\376\376\377\377\376\376\377\377\376\376"
+ 242      FFFEFEFF 
+ 242      FFFEFEFF 
+ 242      FFFEFE
+ 243 0ccb FFFFFEFE 		.ascii	"\377\377\376\376\377\377\376\376\377\377\376\376\377\377\376"
+ 243      FFFFFEFE 
+ 243      FFFFFEFE 
+ 243      FFFFFE
+ 244 0cda FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+ 244      FFFFFFFE 
+ 244      FFFFFFFE 
+ 244      FFFFFF
+ 245 0ce9 FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 245      FEFFFFFF 
+ 245      FEFFFFFF 
+ 245      FEFFFF
+ 246 0cf8 FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 246      FFFEFFFF 
+ 246      FFFEFFFF 
+ 246      FFFEFF
+ 247 0d07 FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+ 247      FFFFFEFF 
+ 247      FFFFFEFF 
+ 247      FFFFFE
+ 248 0d16 FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+ 248      FFFFFFFE 
+ 248      FFFFFFFE 
+ 248      FFFFFF
+ 249 0d25 FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 249      FEFFFFFF 
+ 249      FEFFFFFF 
+ 249      FEFFFF
+GAS LISTING /tmp/cc9MX8t6.s 			page 17
+
+
+ 250 0d34 FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 250      FFFEFFFF 
+ 250      FFFEFFFF 
+ 250      FFFEFF
+ 251 0d43 FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+ 251      FFFFFEFF 
+ 251      FFFFFEFF 
+ 251      FFFFFE
+ 252 0d52 FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+ 252      FFFFFFFE 
+ 252      FFFFFFFE 
+ 252      FFFFFF
+ 253 0d61 FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 253      FEFFFFFF 
+ 253      FEFFFFFF 
+ 253      FEFFFF
+ 254 0d70 FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 254      FFFEFFFF 
+ 254      FFFEFFFF 
+ 254      FFFEFF
+ 255 0d7f FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+ 255      FFFFFEFF 
+ 255      FFFFFEFF 
+ 255      FFFFFE
+ 256 0d8e FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+ 256      FFFFFFFE 
+ 256      FFFFFFFE 
+ 256      FFFFFF
+ 257 0d9d FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 257      FEFFFFFF 
+ 257      FEFFFFFF 
+ 257      FEFFFF
+ 258 0dac FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 258      FFFEFFFF 
+ 258      FFFEFFFF 
+ 258      FFFEFF
+ 259 0dbb FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+ 259      FFFFFEFF 
+ 259      FFFFFEFF 
+ 259      FFFFFE
+ 260 0dca FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+ 260      FFFFFFFE 
+ 260      FFFFFFFE 
+ 260      FFFFFF
+ 261 0dd9 FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 261      FEFFFFFF 
+ 261      FEFFFFFF 
+ 261      FEFFFF
+ 262 0de8 FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 262      FFFEFFFF 
+ 262      FFFEFFFF 
+ 262      FFFEFF
+ 263 0df7 FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+ 263      FFFFFEFF 
+ 263      FFFFFEFF 
+ 263      FFFFFE
+ 264 0e06 FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+GAS LISTING /tmp/cc9MX8t6.s 			page 18
+
+
+ 264      FFFFFFFE 
+ 264      FFFFFFFE 
+ 264      FFFFFF
+ 265 0e15 FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 265      FEFFFFFF 
+ 265      FEFFFFFF 
+ 265      FEFFFF
+ 266 0e24 FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 266      FFFEFFFF 
+ 266      FFFEFFFF 
+ 266      FFFEFF
+ 267 0e33 FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+ 267      FFFFFEFF 
+ 267      FFFFFEFF 
+ 267      FFFFFE
+ 268 0e42 FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+ 268      FFFFFFFE 
+ 268      FFFFFFFE 
+ 268      FFFFFF
+ 269 0e51 FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 269      FEFFFFFF 
+ 269      FEFFFFFF 
+ 269      FEFFFF
+ 270 0e60 FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 270      FFFEFFFF 
+ 270      FFFEFFFF 
+ 270      FFFEFF
+ 271 0e6f FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+ 271      FFFFFEFF 
+ 271      FFFFFEFF 
+ 271      FFFFFE
+ 272 0e7e FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+ 272      FFFFFFFE 
+ 272      FFFFFFFE 
+ 272      FFFFFF
+ 273 0e8d FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 273      FEFFFFFF 
+ 273      FEFFFFFF 
+ 273      FEFFFF
+ 274 0e9c FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 274      FFFEFFFF 
+ 274      FFFEFFFF 
+ 274      FFFEFF
+ 275 0eab FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+ 275      FFFFFEFF 
+ 275      FFFFFEFF 
+ 275      FFFFFE
+ 276 0eba FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+ 276      FFFFFFFE 
+ 276      FFFFFFFE 
+ 276      FFFFFF
+ 277 0ec9 FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 277      FEFFFFFF 
+ 277      FEFFFFFF 
+ 277      FEFFFF
+ 278 0ed8 FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 278      FFFEFFFF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 19
+
+
+ 278      FFFEFFFF 
+ 278      FFFEFF
+ 279 0ee7 FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+ 279      FFFFFEFF 
+ 279      FFFFFEFF 
+ 279      FFFFFE
+ 280 0ef6 FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+ 280      FFFFFFFE 
+ 280      FFFFFFFE 
+ 280      FFFFFF
+ 281 0f05 FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 281      FEFFFFFF 
+ 281      FEFFFFFF 
+ 281      FEFFFF
+ 282 0f14 FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 282      FFFEFFFF 
+ 282      FFFEFFFF 
+ 282      FFFEFF
+ 283 0f23 FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+ 283      FFFFFEFF 
+ 283      FFFFFEFF 
+ 283      FFFFFE
+ 284 0f32 FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+ 284      FFFFFFFE 
+ 284      FFFFFFFE 
+ 284      FFFFFF
+ 285 0f41 FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 285      FEFFFFFF 
+ 285      FEFFFFFF 
+ 285      FEFFFF
+ 286 0f50 FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 286      FFFEFFFF 
+ 286      FFFEFFFF 
+ 286      FFFEFF
+ 287 0f5f FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+ 287      FFFFFEFF 
+ 287      FFFFFEFF 
+ 287      FFFFFE
+ 288 0f6e FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+ 288      FFFFFFFE 
+ 288      FFFFFFFE 
+ 288      FFFFFF
+ 289 0f7d FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 289      FEFFFFFF 
+ 289      FEFFFFFF 
+ 289      FEFFFF
+ 290 0f8c FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 290      FFFEFFFF 
+ 290      FFFEFFFF 
+ 290      FFFEFF
+ 291 0f9b FFFFFEFF 		.ascii	"\377\377\376\377\377"
+ 291      FF
+ 292 0fa0 FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 292      FFFEFFFF 
+ 292      FFFEFFFF 
+ 292      FFFEFF
+ 293 0faf FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+GAS LISTING /tmp/cc9MX8t6.s 			page 20
+
+
+ 293      FFFFFEFF 
+ 293      FFFFFEFF 
+ 293      FFFFFE
+ 294 0fbe FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377\377\376\377\377\377"
+ 294      FFFFFFFE 
+ 294      FFFFFFFE 
+ 294      FFFFFF
+ 295 0fcd FEFFFFFF 		.ascii	"\376\377\377\377\376\377\377\377\376\377\377\377\376\377\377"
+ 295      FEFFFFFF 
+ 295      FEFFFFFF 
+ 295      FEFFFF
+ 296 0fdc FFFEFFFF 		.ascii	"\377\376\377\377\377\376\377\377\377\376\377\377\377\376\377"
+ 296      FFFEFFFF 
+ 296      FFFEFFFF 
+ 296      FFFEFF
+ 297 0feb FFFFFEFF 		.ascii	"\377\377\376\377\377\377\376\377\377\377\376\377\377\377\376"
+ 297      FFFFFEFF 
+ 297      FFFFFEFF 
+ 297      FFFFFE
+ 298 0ffa FFFFFFFE 		.ascii	"\377\377\377\376\377\377\377\376\377\377"
+ 298      FFFFFFFE 
+ 298      FFFF
+ 299              		.globl	heatmap_cs_Greys_mixed
+ 300              		.section	.data.rel.local
+ 301              		.align 8
+ 302              		.type	heatmap_cs_Greys_mixed, @object
+ 303              		.size	heatmap_cs_Greys_mixed, 8
+ 304              	heatmap_cs_Greys_mixed:
+ 305 0008 00000000 		.quad	mixed
+ 305      00000000 
+ 306              		.section	.data.rel.ro.local
+ 307              		.align 16
+ 308              		.type	mixed, @object
+ 309              		.size	mixed, 16
+ 310              	mixed:
+ 311 0010 00000000 		.quad	mixed_data
+ 311      00000000 
+ 312 0018 01040000 		.quad	1025
+ 312      00000000 
+ 313              		.section	.rodata
+ 314 1004 00000000 		.align 32
+ 314      00000000 
+ 314      00000000 
+ 314      00000000 
+ 314      00000000 
+ 315              		.type	mixed_data, @object
+ 316              		.size	mixed_data, 4100
+ 317              	mixed_data:
+ 318 1020 00       		.string	""
+ 319 1021 00       		.string	""
+ 320 1022 00       		.string	""
+ 321 1023 00       		.string	""
+ 322 1024 00       		.string	""
+ 323 1025 00       		.string	""
+ 324 1026 00       		.string	""
+ 325 1027 00       		.string	""
+ 326 1028 00       		.string	""
+GAS LISTING /tmp/cc9MX8t6.s 			page 21
+
+
+ 327 1029 00       		.string	""
+ 328 102a 00       		.string	""
+ 329 102b 0700     		.string	"\007"
+ 330 102d 00       		.string	""
+ 331 102e 00       		.string	""
+ 332 102f 0E010101 		.ascii	"\016\001\001\001\026\001\001\001\035\001\001\001%\002\002\002"
+ 332      16010101 
+ 332      1D010101 
+ 332      25020202 
+ 333 103f 2C020202 		.ascii	",\002\002\0024\002\002\002;\003\003\003C\003\003\003J\003\003"
+ 333      34020202 
+ 333      3B030303 
+ 333      43030303 
+ 333      4A0303
+ 334 1052 03520404 		.ascii	"\003R\004\004\004Y\004\004\004a\004\004\004h\005\005\005p\005"
+ 334      04590404 
+ 334      04610404 
+ 334      04680505 
+ 334      057005
+ 335 1065 05057705 		.ascii	"\005\005w\005\005\005\177\006\006\006\206\006\006\006\215\006"
+ 335      05057F06 
+ 335      06068606 
+ 335      06068D06 
+ 336 1075 06069507 		.ascii	"\006\006\225\007\007\007\234\007\007\007\244\007\007\007\253"
+ 336      07079C07 
+ 336      0707A407 
+ 336      0707AB
+ 337 1084 080808B3 		.ascii	"\b\b\b\263\b\b\b\272\b\b\b\302\t\t\t\311\t\t\t\321\t\t\t\330"
+ 337      080808BA 
+ 337      080808C2 
+ 337      090909C9 
+ 337      090909D1 
+ 338 109c 090909E0 		.ascii	"\t\t\t\340\n\n\n\347\n\n\n\357\n\n\n\366\013\013\013\376\013"
+ 338      0A0A0AE7 
+ 338      0A0A0AEF 
+ 338      0A0A0AF6 
+ 338      0B0B0BFE 
+ 339 10b1 0B0BFF0B 		.ascii	"\013\013\377\013\013\013\377\013\013\013\377\f\f\f\377\f\f\f"
+ 339      0B0BFF0B 
+ 339      0B0BFF0C 
+ 339      0C0CFF0C 
+ 339      0C0C
+ 340 10c3 FF0C0C0C 		.ascii	"\377\f\f\f\377\f\f\f\377\r\r\r\377\r\r\r\377\r\r\r\377\r\r\r"
+ 340      FF0C0C0C 
+ 340      FF0D0D0D 
+ 340      FF0D0D0D 
+ 340      FF0D0D0D 
+ 341 10db FF0E0E0E 		.ascii	"\377\016\016\016\377\016\016\016\377\016\016\016\377\016\016"
+ 341      FF0E0E0E 
+ 341      FF0E0E0E 
+ 341      FF0E0E
+ 342 10ea 0EFF0E0E 		.ascii	"\016\377\016\016\016\377\017\017\017\377\017\017\017\377\017"
+ 342      0EFF0F0F 
+ 342      0FFF0F0F 
+ 342      0FFF0F
+ 343 10f9 0F0FFF0F 		.ascii	"\017\017\377\017\017\017\377\017\017\017\377\020\020\020\377"
+ 343      0F0FFF0F 
+GAS LISTING /tmp/cc9MX8t6.s 			page 22
+
+
+ 343      0F0FFF10 
+ 343      1010FF
+ 344 1108 101010FF 		.ascii	"\020\020\020\377\020\020\020\377\020\020\020\377\020\020\020"
+ 344      101010FF 
+ 344      101010FF 
+ 344      101010
+ 345 1117 FF111111 		.ascii	"\377\021\021\021\377\021\021\021\377\021\021\021\377\031\031"
+ 345      FF111111 
+ 345      FF111111 
+ 345      FF1919
+ 346 1126 19FF1919 		.ascii	"\031\377\031\031\031\377\031\031\031\377\031\031\031\377\031"
+ 346      19FF1919 
+ 346      19FF1919 
+ 346      19FF19
+ 347 1135 1919FF1A 		.ascii	"\031\031\377\032\032\032\377\032\032\032\377\032\032\032\377"
+ 347      1A1AFF1A 
+ 347      1A1AFF1A 
+ 347      1A1AFF
+ 348 1144 1A1A1AFF 		.ascii	"\032\032\032\377\032\032\032\377\032\032\032\377\033\033\033"
+ 348      1A1A1AFF 
+ 348      1A1A1AFF 
+ 348      1B1B1B
+ 349 1153 FF1B1B1B 		.ascii	"\377\033\033\033\377\033\033\033\377\033\033\033\377\033\033"
+ 349      FF1B1B1B 
+ 349      FF1B1B1B 
+ 349      FF1B1B
+ 350 1162 1BFF1C1C 		.ascii	"\033\377\034\034\034\377\034\034\034\377\034\034\034\377\034"
+ 350      1CFF1C1C 
+ 350      1CFF1C1C 
+ 350      1CFF1C
+ 351 1171 1C1CFF1C 		.ascii	"\034\034\377\034\034\034\377\034\034\034\377\035\035\035\377"
+ 351      1C1CFF1C 
+ 351      1C1CFF1D 
+ 351      1D1DFF
+ 352 1180 1D1D1DFF 		.ascii	"\035\035\035\377\035\035\035\377\035\035\035\377\035\035\035"
+ 352      1D1D1DFF 
+ 352      1D1D1DFF 
+ 352      1D1D1D
+ 353 118f FF1E1E1E 		.ascii	"\377\036\036\036\377\036\036\036\377\036\036\036\377\036\036"
+ 353      FF1E1E1E 
+ 353      FF1E1E1E 
+ 353      FF1E1E
+ 354 119e 1EFF1E1E 		.ascii	"\036\377\036\036\036\377\036\036\036\377\037\037\037\377\037"
+ 354      1EFF1E1E 
+ 354      1EFF1F1F 
+ 354      1FFF1F
+ 355 11ad 1F1FFF1F 		.ascii	"\037\037\377\037\037\037\377\037\037\037\377\037\037\037\377"
+ 355      1F1FFF1F 
+ 355      1F1FFF1F 
+ 355      1F1FFF
+ 356 11bc 202020FF 		.ascii	"   \377   \377   \377   \377   \377!!!\377!!!\377!!!\377!!!\377"
+ 356      202020FF 
+ 356      202020FF 
+ 356      202020FF 
+ 356      202020FF 
+ 357 11e0 212121FF 		.ascii	"!!!\377!!!\377\"\"\"\377\"\"\"\377\"\"\"\377\"\"\"\377\"\"\""
+ 357      212121FF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 23
+
+
+ 357      222222FF 
+ 357      222222FF 
+ 357      222222FF 
+ 358 11fb FF232323 		.ascii	"\377###\377###\377###\377###\377###\377$$$\377$$$\377$$$\377"
+ 358      FF232323 
+ 358      FF232323 
+ 358      FF232323 
+ 358      FF232323 
+ 359 121c 242424FF 		.ascii	"$$$\377$$$\377%$%\377%%%\377%%%\377%%%\377&&&\377&&&\377&&&\377"
+ 359      242424FF 
+ 359      252425FF 
+ 359      252525FF 
+ 359      252525FF 
+ 360 1240 262626FF 		.ascii	"&&&\377'''\377'''\377'''\377'''\377(((\377(((\377(((\377(((\377"
+ 360      272727FF 
+ 360      272727FF 
+ 360      272727FF 
+ 360      272727FF 
+ 361 1264 292929FF 		.ascii	")))\377)))\377)))\377***\377***\377***\377***\377+++\377+++\377"
+ 361      292929FF 
+ 361      292929FF 
+ 361      2A2A2AFF 
+ 361      2A2A2AFF 
+ 362 1288 2B2B2BFF 		.ascii	"+++\377+++\377,,,\377,,,\377,,,\377---\377---\377---\377---\377"
+ 362      2B2B2BFF 
+ 362      2C2C2CFF 
+ 362      2C2C2CFF 
+ 362      2C2C2CFF 
+ 363 12ac 2E2E2EFF 		.ascii	"...\377...\377...\377...\377///\377///\377///\377000\377000\377"
+ 363      2E2E2EFF 
+ 363      2E2E2EFF 
+ 363      2E2E2EFF 
+ 363      2F2F2FFF 
+ 364 12d0 303030FF 		.ascii	"000\377000\377111\377111\377111\377111\377222\377222\377222\377"
+ 364      303030FF 
+ 364      313131FF 
+ 364      313131FF 
+ 364      313131FF 
+ 365 12f4 333333FF 		.ascii	"333\377333\377333\377333\377444\377444\377444\377555\377555\377"
+ 365      333333FF 
+ 365      333333FF 
+ 365      333333FF 
+ 365      343434FF 
+ 366 1318 353535FF 		.ascii	"555\377555\377666\377???\377???\377@@@\377@@@\377@@@\377@@@\377"
+ 366      353535FF 
+ 366      363636FF 
+ 366      3F3F3FFF 
+ 366      3F3F3FFF 
+ 367 133c 414141FF 		.ascii	"AAA\377AAA\377AAA\377AAA\377BBB\377BBB\377BBB\377CCC\377CCC\377"
+ 367      414141FF 
+ 367      414141FF 
+ 367      414141FF 
+ 367      424242FF 
+ 368 1360 434343FF 		.ascii	"CCC\377CCC\377DDD\377DDD\377DDD\377EEE\377EEE\377EEE\377EEE\377"
+ 368      434343FF 
+ 368      444444FF 
+ 368      444444FF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 24
+
+
+ 368      444444FF 
+ 369 1384 464646FF 		.ascii	"FFF\377FFF\377FFF\377GGG\377GGG\377GGG\377HHH\377HHH\377HHH\377"
+ 369      464646FF 
+ 369      464646FF 
+ 369      474747FF 
+ 369      474747FF 
+ 370 13a8 484848FF 		.ascii	"HHH\377III\377III\377III\377JJJ\377JJJ\377JJJ\377JJJ\377KKK\377"
+ 370      494949FF 
+ 370      494949FF 
+ 370      494949FF 
+ 370      4A4A4AFF 
+ 371 13cc 4B4B4BFF 		.ascii	"KKK\377KKK\377LLL\377LLL\377LLL\377LLL\377MMM\377MMM\377MMM\377"
+ 371      4B4B4BFF 
+ 371      4C4C4CFF 
+ 371      4C4C4CFF 
+ 371      4C4C4CFF 
+ 372 13f0 4E4E4EFF 		.ascii	"NNN\377NNN\377NNN\377OOO\377OOO\377OOO\377OOO\377PPP\377PPP\377"
+ 372      4E4E4EFF 
+ 372      4E4E4EFF 
+ 372      4F4F4FFF 
+ 372      4F4F4FFF 
+ 373 1414 505050FF 		.ascii	"PPP\377QQQ\377QQQ\377QQQ\377RQR\377RRR\377RRR\377RRR\377RRR\377"
+ 373      515151FF 
+ 373      515151FF 
+ 373      515151FF 
+ 373      525152FF 
+ 374 1438 535353FF 		.ascii	"SSS\377SSS\377SSS\377SSS\377SSS\377TTT\377TTT\377TTT\377TTT\377"
+ 374      535353FF 
+ 374      535353FF 
+ 374      535353FF 
+ 374      535353FF 
+ 375 145c 545454FF 		.ascii	"TTT\377UUU\377UUU\377UUU\377UUU\377UUU\377VVV\377VVV\377VVV\377"
+ 375      555555FF 
+ 375      555555FF 
+ 375      555555FF 
+ 375      555555FF 
+ 376 1480 565656FF 		.ascii	"VVV\377VVV\377WWW\377WWW\377WWW\377WWW\377WWW\377XXX\377XXX\377"
+ 376      565656FF 
+ 376      575757FF 
+ 376      575757FF 
+ 376      575757FF 
+ 377 14a4 585858FF 		.ascii	"XXX\377XXX\377XXX\377YYY\377YYY\377YYY\377YYY\377YYY\377ZZZ\377"
+ 377      585858FF 
+ 377      585858FF 
+ 377      595959FF 
+ 377      595959FF 
+ 378 14c8 5A5A5AFF 		.ascii	"ZZZ\377ZZZ\377ZZZ\377ZZZ\377[[[\377[[[\377[[[\377[[[\377[[[\377"
+ 378      5A5A5AFF 
+ 378      5A5A5AFF 
+ 378      5A5A5AFF 
+ 378      5B5B5BFF 
+ 379 14ec 5C5C5CFF 		.ascii	"\\\\\\\377\\\\\\\377\\\\\\\377\\\\\\\377\\\\\\\377]]]\377]]]"
+ 379      5C5C5CFF 
+ 379      5C5C5CFF 
+ 379      5C5C5CFF 
+ 379      5C5C5CFF 
+ 380 1507 FF5D5D5D 		.ascii	"\377]]]\377]]]\377]]]\377^^^\377^^^\377^^^\377^^^\377eee\377"
+GAS LISTING /tmp/cc9MX8t6.s 			page 25
+
+
+ 380      FF5D5D5D 
+ 380      FF5D5D5D 
+ 380      FF5E5E5E 
+ 380      FF5E5E5E 
+ 381 1528 656565FF 		.ascii	"eee\377fff\377fff\377fff\377fff\377fff\377ggg\377ggg\377ggg\377"
+ 381      666666FF 
+ 381      666666FF 
+ 381      666666FF 
+ 381      666666FF 
+ 382 154c 676767FF 		.ascii	"ggg\377ggg\377hhh\377hhh\377hhh\377hhh\377hhh\377iii\377iii\377"
+ 382      676767FF 
+ 382      686868FF 
+ 382      686868FF 
+ 382      686868FF 
+ 383 1570 696969FF 		.ascii	"iii\377iii\377iii\377jjj\377jjj\377jjj\377jjj\377kkk\377kkk\377"
+ 383      696969FF 
+ 383      696969FF 
+ 383      6A6A6AFF 
+ 383      6A6A6AFF 
+ 384 1594 6B6B6BFF 		.ascii	"kkk\377kkk\377kkk\377lll\377lll\377lll\377lll\377lll\377mmm\377"
+ 384      6B6B6BFF 
+ 384      6B6B6BFF 
+ 384      6C6C6CFF 
+ 384      6C6C6CFF 
+ 385 15b8 6D6D6DFF 		.ascii	"mmm\377mmm\377mmm\377mmm\377nnn\377nnn\377nnn\377nnn\377nnn\377"
+ 385      6D6D6DFF 
+ 385      6D6D6DFF 
+ 385      6D6D6DFF 
+ 385      6E6E6EFF 
+ 386 15dc 6F6F6FFF 		.ascii	"ooo\377ooo\377ooo\377ooo\377ppp\377ppp\377ppp\377ppp\377ppp\377"
+ 386      6F6F6FFF 
+ 386      6F6F6FFF 
+ 386      6F6F6FFF 
+ 386      707070FF 
+ 387 1600 717171FF 		.ascii	"qqq\377qqq\377qqq\377qqq\377qqq\377rrr\377rrr\377rrr\377rrr\377"
+ 387      717171FF 
+ 387      717171FF 
+ 387      717171FF 
+ 387      717171FF 
+ 388 1624 737273FF 		.ascii	"srs\377sss\377sss\377sss\377sss\377ttt\377ttt\377ttt\377ttt\377"
+ 388      737373FF 
+ 388      737373FF 
+ 388      737373FF 
+ 388      737373FF 
+ 389 1648 747474FF 		.ascii	"ttt\377uuu\377uuu\377uuu\377uuu\377uuu\377vvv\377vvv\377vvv\377"
+ 389      757575FF 
+ 389      757575FF 
+ 389      757575FF 
+ 389      757575FF 
+ 390 166c 767676FF 		.ascii	"vvv\377www\377www\377www\377www\377www\377xxx\377xxx\377xxx\377"
+ 390      777777FF 
+ 390      777777FF 
+ 390      777777FF 
+ 390      777777FF 
+ 391 1690 787878FF 		.ascii	"xxx\377yyy\377yyy\377yyy\377yyy\377yyy\377zzz\377zzz\377zzz\377"
+ 391      797979FF 
+ 391      797979FF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 26
+
+
+ 391      797979FF 
+ 391      797979FF 
+ 392 16b4 7A7A7AFF 		.ascii	"zzz\377zzz\377{{{\377{{{\377{{{\377{{{\377|||\377|||\377|||\377"
+ 392      7A7A7AFF 
+ 392      7B7B7BFF 
+ 392      7B7B7BFF 
+ 392      7B7B7BFF 
+ 393 16d8 7C7C7CFF 		.ascii	"|||\377|||\377}}}\377}}}\377}}}\377}}}\377}}}\377~~~\377~~~\377"
+ 393      7C7C7CFF 
+ 393      7D7D7DFF 
+ 393      7D7D7DFF 
+ 393      7D7D7DFF 
+ 394 16fc 7E7E7EFF 		.ascii	"~~~\377~~~\377\177\177\177\377\177\177\177\377\177\177\177\377"
+ 394      7E7E7EFF 
+ 394      7F7F7FFF 
+ 394      7F7F7FFF 
+ 394      7F7F7FFF 
+ 395 1710 7F7F7FFF 		.ascii	"\177\177\177\377\177\177\177\377\200\200\200\377\200\200\200"
+ 395      7F7F7FFF 
+ 395      808080FF 
+ 395      808080
+ 396 171f FF808080 		.ascii	"\377\200\200\200\377\207\207\207\377\210\210\210\377\210\210"
+ 396      FF878787 
+ 396      FF888888 
+ 396      FF8888
+ 397 172e 88FF8888 		.ascii	"\210\377\210\210\210\377\210\210\210\377\210\210\210\377\211"
+ 397      88FF8888 
+ 397      88FF8888 
+ 397      88FF89
+ 398 173d 8989FF89 		.ascii	"\211\211\377\211\211\211\377\211\211\211\377\211\211\211\377"
+ 398      8989FF89 
+ 398      8989FF89 
+ 398      8989FF
+ 399 174c 8A8A8AFF 		.ascii	"\212\212\212\377\212\212\212\377\212\212\212\377\212\212\212"
+ 399      8A8A8AFF 
+ 399      8A8A8AFF 
+ 399      8A8A8A
+ 400 175b FF8A8A8A 		.ascii	"\377\212\212\212\377\213\213\213\377\213\213\213\377\213\213"
+ 400      FF8B8B8B 
+ 400      FF8B8B8B 
+ 400      FF8B8B
+ 401 176a 8BFF8B8B 		.ascii	"\213\377\213\213\213\377\214\214\214\377\214\214\214\377\214"
+ 401      8BFF8C8C 
+ 401      8CFF8C8C 
+ 401      8CFF8C
+ 402 1779 8C8CFF8C 		.ascii	"\214\214\377\214\214\214\377\214\214\214\377\215\215\215\377"
+ 402      8C8CFF8C 
+ 402      8C8CFF8D 
+ 402      8D8DFF
+ 403 1788 8D8D8DFF 		.ascii	"\215\215\215\377\215\215\215\377\215\215\215\377\215\215\215"
+ 403      8D8D8DFF 
+ 403      8D8D8DFF 
+ 403      8D8D8D
+ 404 1797 FF8E8E8E 		.ascii	"\377\216\216\216\377\216\216\216\377\216\216\216\377\216\216"
+ 404      FF8E8E8E 
+ 404      FF8E8E8E 
+ 404      FF8E8E
+GAS LISTING /tmp/cc9MX8t6.s 			page 27
+
+
+ 405 17a6 8EFF8F8F 		.ascii	"\216\377\217\217\217\377\217\217\217\377\217\217\217\377\217"
+ 405      8FFF8F8F 
+ 405      8FFF8F8F 
+ 405      8FFF8F
+ 406 17b5 8F8FFF8F 		.ascii	"\217\217\377\217\217\217\377\220\220\220\377\220\220\220\377"
+ 406      8F8FFF90 
+ 406      9090FF90 
+ 406      9090FF
+ 407 17c4 909090FF 		.ascii	"\220\220\220\377\220\220\220\377\221\221\221\377\221\221\221"
+ 407      909090FF 
+ 407      919191FF 
+ 407      919191
+ 408 17d3 FF919191 		.ascii	"\377\221\221\221\377\221\221\221\377\221\221\221\377\222\222"
+ 408      FF919191 
+ 408      FF919191 
+ 408      FF9292
+ 409 17e2 92FF9292 		.ascii	"\222\377\222\222\222\377\222\222\222\377\222\222\222\377"
+ 409      92FF9292 
+ 409      92FF9292 
+ 409      92FF
+ 410 17f0 939393FF 		.ascii	"\223\223\223\377\223\223\223\377\223\223\223\377\223\223\223"
+ 410      939393FF 
+ 410      939393FF 
+ 410      939393
+ 411 17ff FF939393 		.ascii	"\377\223\223\223\377\224\224\224\377\224\224\224\377\224\224"
+ 411      FF949494 
+ 411      FF949494 
+ 411      FF9494
+ 412 180e 94FF9494 		.ascii	"\224\377\224\224\224\377\225\225\225\377\225\225\225\377\225"
+ 412      94FF9595 
+ 412      95FF9595 
+ 412      95FF95
+ 413 181d 9595FF95 		.ascii	"\225\225\377\225\225\225\377\226\225\226\377\226\226\226\377"
+ 413      9595FF96 
+ 413      9596FF96 
+ 413      9696FF
+ 414 182c 969696FF 		.ascii	"\226\226\226\377\226\226\226\377\226\226\226\377\227\227\227"
+ 414      969696FF 
+ 414      969696FF 
+ 414      979797
+ 415 183b FF979797 		.ascii	"\377\227\227\227\377\227\227\227\377\227\227\227\377\230\230"
+ 415      FF979797 
+ 415      FF979797 
+ 415      FF9898
+ 416 184a 98FF9898 		.ascii	"\230\377\230\230\230\377\230\230\230\377\230\230\230\377\231"
+ 416      98FF9898 
+ 416      98FF9898 
+ 416      98FF99
+ 417 1859 9999FF99 		.ascii	"\231\231\377\231\231\231\377\231\231\231\377\231\231\231\377"
+ 417      9999FF99 
+ 417      9999FF99 
+ 417      9999FF
+ 418 1868 9A9A9AFF 		.ascii	"\232\232\232\377\232\232\232\377\232\232\232\377\232\232\232"
+ 418      9A9A9AFF 
+ 418      9A9A9AFF 
+ 418      9A9A9A
+ 419 1877 FF9B9B9B 		.ascii	"\377\233\233\233\377\233\233\233\377\233\233\233\377\233\233"
+GAS LISTING /tmp/cc9MX8t6.s 			page 28
+
+
+ 419      FF9B9B9B 
+ 419      FF9B9B9B 
+ 419      FF9B9B
+ 420 1886 9BFF9B9B 		.ascii	"\233\377\233\233\233\377\234\234\234\377\234\234\234\377\234"
+ 420      9BFF9C9C 
+ 420      9CFF9C9C 
+ 420      9CFF9C
+ 421 1895 9C9CFF9C 		.ascii	"\234\234\377\234\234\234\377\235\235\235\377\235\235\235\377"
+ 421      9C9CFF9D 
+ 421      9D9DFF9D 
+ 421      9D9DFF
+ 422 18a4 9D9D9DFF 		.ascii	"\235\235\235\377\235\235\235\377\236\236\236\377\236\236\236"
+ 422      9D9D9DFF 
+ 422      9E9E9EFF 
+ 422      9E9E9E
+ 423 18b3 FF9E9E9E 		.ascii	"\377\236\236\236\377\236\236\236\377\237\237\237\377\237\237"
+ 423      FF9E9E9E 
+ 423      FF9F9F9F 
+ 423      FF9F9F
+ 424 18c2 9FFF9F9F 		.ascii	"\237\377\237\237\237\377\237\237\237\377\240\240\240\377\240"
+ 424      9FFF9F9F 
+ 424      9FFFA0A0 
+ 424      A0FFA0
+ 425 18d1 A0A0FFA0 		.ascii	"\240\240\377\240\240\240\377\240\240\240\377\241\241\241\377"
+ 425      A0A0FFA0 
+ 425      A0A0FFA1 
+ 425      A1A1FF
+ 426 18e0 A1A1A1FF 		.ascii	"\241\241\241\377\241\241\241\377\241\241\241\377\242\242\242"
+ 426      A1A1A1FF 
+ 426      A1A1A1FF 
+ 426      A2A2A2
+ 427 18ef FFA2A2A2 		.ascii	"\377\242\242\242\377\242\242\242\377\242\242\242\377\242\242"
+ 427      FFA2A2A2 
+ 427      FFA2A2A2 
+ 427      FFA2A2
+ 428 18fe A2FFA3A3 		.ascii	"\242\377\243\243\243\377\243\243\243\377\243\243\243\377\243"
+ 428      A3FFA3A3 
+ 428      A3FFA3A3 
+ 428      A3FFA3
+ 429 190d A3A3FFA4 		.ascii	"\243\243\377\244\244\244\377\244\244\244\377\244\244\244\377"
+ 429      A4A4FFA4 
+ 429      A4A4FFA4 
+ 429      A4A4FF
+ 430 191c A4A4A4FF 		.ascii	"\244\244\244\377\245\245\245\377\255\255\255\377\255\255\255"
+ 430      A5A5A5FF 
+ 430      ADADADFF 
+ 430      ADADAD
+ 431 192b FFADADAD 		.ascii	"\377\255\255\255\377\255\255\255\377\256\256\256\377\256\256"
+ 431      FFADADAD 
+ 431      FFAEAEAE 
+ 431      FFAEAE
+ 432 193a AEFFAEAE 		.ascii	"\256\377\256\256\256\377\256\256\256\377\257\257\257\377\257"
+ 432      AEFFAEAE 
+ 432      AEFFAFAF 
+ 432      AFFFAF
+ 433 1949 AFAFFFAF 		.ascii	"\257\257\377\257\257\257\377\257\257\257\377\260\260\260\377"
+ 433      AFAFFFAF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 29
+
+
+ 433      AFAFFFB0 
+ 433      B0B0FF
+ 434 1958 B0B0B0FF 		.ascii	"\260\260\260\377\260\260\260\377\260\260\260\377\261\261\261"
+ 434      B0B0B0FF 
+ 434      B0B0B0FF 
+ 434      B1B1B1
+ 435 1967 FFB1B1B1 		.ascii	"\377\261\261\261\377\261\261\261\377\261\261\261\377\262\262"
+ 435      FFB1B1B1 
+ 435      FFB1B1B1 
+ 435      FFB2B2
+ 436 1976 B2FFB2B2 		.ascii	"\262\377\262\262\262\377\262\262\262\377\262\262\262\377\263"
+ 436      B2FFB2B2 
+ 436      B2FFB2B2 
+ 436      B2FFB3
+ 437 1985 B3B3FFB3 		.ascii	"\263\263\377\263\263\263\377\263\263\263\377\263\263\263\377"
+ 437      B3B3FFB3 
+ 437      B3B3FFB3 
+ 437      B3B3FF
+ 438 1994 B4B4B4FF 		.ascii	"\264\264\264\377\264\264\264\377\264\264\264\377\264\264\264"
+ 438      B4B4B4FF 
+ 438      B4B4B4FF 
+ 438      B4B4B4
+ 439 19a3 FFB5B5B5 		.ascii	"\377\265\265\265\377\265\265\265\377\265\265\265\377\265\265"
+ 439      FFB5B5B5 
+ 439      FFB5B5B5 
+ 439      FFB5B5
+ 440 19b2 B5FFB6B6 		.ascii	"\265\377\266\266\266\377\266\266\266\377\266\266\266\377\266"
+ 440      B6FFB6B6 
+ 440      B6FFB6B6 
+ 440      B6FFB6
+ 441 19c1 B6B6FFB7 		.ascii	"\266\266\377\267\267\267\377\267\267\267\377\267\267\267\377"
+ 441      B7B7FFB7 
+ 441      B7B7FFB7 
+ 441      B7B7FF
+ 442 19d0 B7B7B7FF 		.ascii	"\267\267\267\377\270\270\270\377\270\270\270\377\270\270\270"
+ 442      B8B8B8FF 
+ 442      B8B8B8FF 
+ 442      B8B8B8
+ 443 19df FFB8B8B8 		.ascii	"\377\270\270\270\377\271\271\271\377\271\271\271\377\271\271"
+ 443      FFB9B9B9 
+ 443      FFB9B9B9 
+ 443      FFB9B9
+ 444 19ee B9FFB9B9 		.ascii	"\271\377\271\271\271\377\272\272\272\377\272\272\272\377\272"
+ 444      B9FFBABA 
+ 444      BAFFBABA 
+ 444      BAFFBA
+ 445 19fd BABAFFBA 		.ascii	"\272\272\377\272\272\272\377\273\273\273\377\273\273\273\377"
+ 445      BABAFFBB 
+ 445      BBBBFFBB 
+ 445      BBBBFF
+ 446 1a0c BBBBBBFF 		.ascii	"\273\273\273\377\273\273\273\377\274\274\274\377\274\274\274"
+ 446      BBBBBBFF 
+ 446      BCBCBCFF 
+ 446      BCBCBC
+ 447 1a1b FFBCBCBC 		.ascii	"\377\274\274\274\377\274\274\274\377\275\274\275\377\275\275"
+ 447      FFBCBCBC 
+ 447      FFBDBCBD 
+GAS LISTING /tmp/cc9MX8t6.s 			page 30
+
+
+ 447      FFBDBD
+ 448 1a2a BDFFBDBD 		.ascii	"\275\377\275\275\275\377\275\275\275\377\275\275\275\377\275"
+ 448      BDFFBDBD 
+ 448      BDFFBDBD 
+ 448      BDFFBD
+ 449 1a39 BDBDFFBE 		.ascii	"\275\275\377\276\276\276\377\276\276\276\377\276\276\276\377"
+ 449      BEBEFFBE 
+ 449      BEBEFFBE 
+ 449      BEBEFF
+ 450 1a48 BEBEBEFF 		.ascii	"\276\276\276\377\276\276\276\377\276\276\276\377\277\277\277"
+ 450      BEBEBEFF 
+ 450      BEBEBEFF 
+ 450      BFBFBF
+ 451 1a57 FFBFBFBF 		.ascii	"\377\277\277\277\377\277\277\277\377\277\277\277\377\277\277"
+ 451      FFBFBFBF 
+ 451      FFBFBFBF 
+ 451      FFBFBF
+ 452 1a66 BFFFBFBF 		.ascii	"\277\377\277\277\277\377\300\300\300\377\300\300\300\377\300"
+ 452      BFFFC0C0 
+ 452      C0FFC0C0 
+ 452      C0FFC0
+ 453 1a75 C0C0FFC0 		.ascii	"\300\300\377\300\300\300\377\300\300\300\377\300\300\300\377"
+ 453      C0C0FFC0 
+ 453      C0C0FFC0 
+ 453      C0C0FF
+ 454 1a84 C1C1C1FF 		.ascii	"\301\301\301\377\301\301\301\377\301\301\301\377\301\301\301"
+ 454      C1C1C1FF 
+ 454      C1C1C1FF 
+ 454      C1C1C1
+ 455 1a93 FFC1C1C1 		.ascii	"\377\301\301\301\377\302\302\302\377\302\302\302\377\302\302"
+ 455      FFC2C2C2 
+ 455      FFC2C2C2 
+ 455      FFC2C2
+ 456 1aa2 C2FFC2C2 		.ascii	"\302\377\302\302\302\377\302\302\302\377\302\302\302\377\303"
+ 456      C2FFC2C2 
+ 456      C2FFC2C2 
+ 456      C2FFC3
+ 457 1ab1 C3C3FFC3 		.ascii	"\303\303\377\303\303\303\377\303\303\303\377\303\303\303\377"
+ 457      C3C3FFC3 
+ 457      C3C3FFC3 
+ 457      C3C3FF
+ 458 1ac0 C3C3C3FF 		.ascii	"\303\303\303\377\303\303\303\377\304\304\304\377\304\304\304"
+ 458      C3C3C3FF 
+ 458      C4C4C4FF 
+ 458      C4C4C4
+ 459 1acf FFC4C4C4 		.ascii	"\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304"
+ 459      FFC4C4C4 
+ 459      FFC4C4C4 
+ 459      FFC4C4
+ 460 1ade C4FFC5C5 		.ascii	"\304\377\305\305\305\377\305\305\305\377\305\305\305\377\305"
+ 460      C5FFC5C5 
+ 460      C5FFC5C5 
+ 460      C5FFC5
+ 461 1aed C5C5FFC5 		.ascii	"\305\305\377\305\305\305\377\306\306\306\377\306\306\306\377"
+ 461      C5C5FFC6 
+ 461      C6C6FFC6 
+ 461      C6C6FF
+GAS LISTING /tmp/cc9MX8t6.s 			page 31
+
+
+ 462 1afc C6C6C6FF 		.ascii	"\306\306\306\377\306\306\306\377\306\306\306\377\306\306\306"
+ 462      C6C6C6FF 
+ 462      C6C6C6FF 
+ 462      C6C6C6
+ 463 1b0b FFC7C7C7 		.ascii	"\377\307\307\307\377\307\307\307\377\307\307\307\377\307\307"
+ 463      FFC7C7C7 
+ 463      FFC7C7C7 
+ 463      FFC7C7
+ 464 1b1a C7FFC7C7 		.ascii	"\307\377\307\307\307\377\307\307\307\377\315\315\315\377\315"
+ 464      C7FFC7C7 
+ 464      C7FFCDCD 
+ 464      CDFFCD
+ 465 1b29 CDCDFFCE 		.ascii	"\315\315\377\316\316\316\377\316\316\316\377\316\316\316\377"
+ 465      CECEFFCE 
+ 465      CECEFFCE 
+ 465      CECEFF
+ 466 1b38 CECECEFF 		.ascii	"\316\316\316\377\316\316\316\377\316\316\316\377\317\317\317"
+ 466      CECECEFF 
+ 466      CECECEFF 
+ 466      CFCFCF
+ 467 1b47 FFCFCFCF 		.ascii	"\377\317\317\317\377\317\317\317\377\317\317\317\377\317\317"
+ 467      FFCFCFCF 
+ 467      FFCFCFCF 
+ 467      FFCFCF
+ 468 1b56 CFFFD0D0 		.ascii	"\317\377\320\320\320\377\320\320\320\377\320\320\320\377\320"
+ 468      D0FFD0D0 
+ 468      D0FFD0D0 
+ 468      D0FFD0
+ 469 1b65 D0D0FFD0 		.ascii	"\320\320\377\320\320\320\377\320\320\320\377\321\321\321\377"
+ 469      D0D0FFD0 
+ 469      D0D0FFD1 
+ 469      D1D1FF
+ 470 1b74 D1D1D1FF 		.ascii	"\321\321\321\377\321\321\321\377\321\321\321\377\321\321\321"
+ 470      D1D1D1FF 
+ 470      D1D1D1FF 
+ 470      D1D1D1
+ 471 1b83 FFD1D1D1 		.ascii	"\377\321\321\321\377\322\322\322\377\322\322\322\377\322\322"
+ 471      FFD2D2D2 
+ 471      FFD2D2D2 
+ 471      FFD2D2
+ 472 1b92 D2FFD2D2 		.ascii	"\322\377\322\322\322\377\322\322\322\377\322\322\322\377\323"
+ 472      D2FFD2D2 
+ 472      D2FFD2D2 
+ 472      D2FFD3
+ 473 1ba1 D3D3FFD3 		.ascii	"\323\323\377\323\323\323\377\323\323\323\377\323\323\323\377"
+ 473      D3D3FFD3 
+ 473      D3D3FFD3 
+ 473      D3D3FF
+ 474 1bb0 D3D3D3FF 		.ascii	"\323\323\323\377\324\324\324\377\324\324\324\377\324\324\324"
+ 474      D4D4D4FF 
+ 474      D4D4D4FF 
+ 474      D4D4D4
+ 475 1bbf FFD4D4D4 		.ascii	"\377\324\324\324\377\324\324\324\377\324\324\324\377\325\325"
+ 475      FFD4D4D4 
+ 475      FFD4D4D4 
+ 475      FFD5D5
+ 476 1bce D5FFD5D5 		.ascii	"\325\377\325\325\325\377\325\325\325\377\325\325\325\377\325"
+GAS LISTING /tmp/cc9MX8t6.s 			page 32
+
+
+ 476      D5FFD5D5 
+ 476      D5FFD5D5 
+ 476      D5FFD5
+ 477 1bdd D5D5FFD5 		.ascii	"\325\325\377\325\325\325\377\326\326\326\377\326\326\326\377"
+ 477      D5D5FFD6 
+ 477      D6D6FFD6 
+ 477      D6D6FF
+ 478 1bec D6D6D6FF 		.ascii	"\326\326\326\377\326\326\326\377\326\326\326\377\327\327\327"
+ 478      D6D6D6FF 
+ 478      D6D6D6FF 
+ 478      D7D7D7
+ 479 1bfb FFD7D7D7 		.ascii	"\377\327\327\327\377\327\327\327\377\327\327\327\377\327\327"
+ 479      FFD7D7D7 
+ 479      FFD7D7D7 
+ 479      FFD7D7
+ 480 1c0a D7FFD7D7 		.ascii	"\327\377\327\327\327\377\330\330\330\377\330\330\330\377\330"
+ 480      D7FFD8D8 
+ 480      D8FFD8D8 
+ 480      D8FFD8
+ 481 1c19 D8D8FFD8 		.ascii	"\330\330\377\330\330\330\377\330\330\330\377\331\330\331\377"
+ 481      D8D8FFD8 
+ 481      D8D8FFD9 
+ 481      D8D9FF
+ 482 1c28 D9D9D9FF 		.ascii	"\331\331\331\377\331\331\331\377\331\331\331\377\331\331\331"
+ 482      D9D9D9FF 
+ 482      D9D9D9FF 
+ 482      D9D9D9
+ 483 1c37 FFD9D9D9 		.ascii	"\377\331\331\331\377\331\331\331\377\331\331\331\377\332\332"
+ 483      FFD9D9D9 
+ 483      FFD9D9D9 
+ 483      FFDADA
+ 484 1c46 DAFFDADA 		.ascii	"\332\377\332\332\332\377\332\332\332\377\332\332\332\377\332"
+ 484      DAFFDADA 
+ 484      DAFFDADA 
+ 484      DAFFDA
+ 485 1c55 DADAFFDA 		.ascii	"\332\332\377\332\332\332\377\332\332\332\377\333\333\333\377"
+ 485      DADAFFDA 
+ 485      DADAFFDB 
+ 485      DBDBFF
+ 486 1c64 DBDBDBFF 		.ascii	"\333\333\333\377\333\333\333\377\333\333\333\377\333\333\333"
+ 486      DBDBDBFF 
+ 486      DBDBDBFF 
+ 486      DBDBDB
+ 487 1c73 FFDBDBDB 		.ascii	"\377\333\333\333\377\333\333\333\377\334\334\334\377\334\334"
+ 487      FFDBDBDB 
+ 487      FFDCDCDC 
+ 487      FFDCDC
+ 488 1c82 DCFFDCDC 		.ascii	"\334\377\334\334\334\377\334\334\334\377\334\334\334\377\334"
+ 488      DCFFDCDC 
+ 488      DCFFDCDC 
+ 488      DCFFDC
+ 489 1c91 DCDCFFDC 		.ascii	"\334\334\377\334\334\334\377\335\335\335\377\335\335\335\377"
+ 489      DCDCFFDD 
+ 489      DDDDFFDD 
+ 489      DDDDFF
+ 490 1ca0 DDDDDDFF 		.ascii	"\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
+ 490      DDDDDDFF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 33
+
+
+ 490      DDDDDDFF 
+ 490      DDDDDD
+ 491 1caf FFDDDDDD 		.ascii	"\377\335\335\335\377\336\336\336\377\336\336\336\377\336\336"
+ 491      FFDEDEDE 
+ 491      FFDEDEDE 
+ 491      FFDEDE
+ 492 1cbe DEFFDEDE 		.ascii	"\336\377\336\336\336\377\336\336\336\377\336\336\336\377\336"
+ 492      DEFFDEDE 
+ 492      DEFFDEDE 
+ 492      DEFFDE
+ 493 1ccd DEDEFFDF 		.ascii	"\336\336\377\337\337\337\377\337\337\337\377\337\337\337\377"
+ 493      DFDFFFDF 
+ 493      DFDFFFDF 
+ 493      DFDFFF
+ 494 1cdc DFDFDFFF 		.ascii	"\337\337\337\377\337\337\337\377\337\337\337\377\340\340\340"
+ 494      DFDFDFFF 
+ 494      DFDFDFFF 
+ 494      E0E0E0
+ 495 1ceb FFE0E0E0 		.ascii	"\377\340\340\340\377\340\340\340\377\340\340\340\377\340\340"
+ 495      FFE0E0E0 
+ 495      FFE0E0E0 
+ 495      FFE0E0
+ 496 1cfa E0FFE0E0 		.ascii	"\340\377\340\340\340\377\340\340\340\377\341\341\341\377\341"
+ 496      E0FFE0E0 
+ 496      E0FFE1E1 
+ 496      E1FFE1
+ 497 1d09 E1E1FFE1 		.ascii	"\341\341\377\341\341\341\377\341\341\341\377\341\341\341\377"
+ 497      E1E1FFE1 
+ 497      E1E1FFE1 
+ 497      E1E1FF
+ 498 1d18 E1E1E1FF 		.ascii	"\341\341\341\377\341\341\341\377\342\342\342\377\346\346\346"
+ 498      E1E1E1FF 
+ 498      E2E2E2FF 
+ 498      E6E6E6
+ 499 1d27 FFE6E6E6 		.ascii	"\377\346\346\346\377\347\347\347\377\347\347\347\377\347\347"
+ 499      FFE7E7E7 
+ 499      FFE7E7E7 
+ 499      FFE7E7
+ 500 1d36 E7FFE7E7 		.ascii	"\347\377\347\347\347\377\347\347\347\377\347\347\347\377\347"
+ 500      E7FFE7E7 
+ 500      E7FFE7E7 
+ 500      E7FFE7
+ 501 1d45 E7E7FFE8 		.ascii	"\347\347\377\350\350\350\377\350\350\350\377\350\350\350\377"
+ 501      E8E8FFE8 
+ 501      E8E8FFE8 
+ 501      E8E8FF
+ 502 1d54 E8E8E8FF 		.ascii	"\350\350\350\377\350\350\350\377\350\350\350\377\350\350\350"
+ 502      E8E8E8FF 
+ 502      E8E8E8FF 
+ 502      E8E8E8
+ 503 1d63 FFE9E9E9 		.ascii	"\377\351\351\351\377\351\351\351\377\351\351\351\377\351\351"
+ 503      FFE9E9E9 
+ 503      FFE9E9E9 
+ 503      FFE9E9
+ 504 1d72 E9FFE9E9 		.ascii	"\351\377\351\351\351\377\351\351\351\377\351\351\351\377\352"
+ 504      E9FFE9E9 
+ 504      E9FFE9E9 
+GAS LISTING /tmp/cc9MX8t6.s 			page 34
+
+
+ 504      E9FFEA
+ 505 1d81 EAEAFFEA 		.ascii	"\352\352\377\352\352\352\377\352\352\352\377\352\352\352\377"
+ 505      EAEAFFEA 
+ 505      EAEAFFEA 
+ 505      EAEAFF
+ 506 1d90 EAEAEAFF 		.ascii	"\352\352\352\377\352\352\352\377\352\352\352\377\353\353\353"
+ 506      EAEAEAFF 
+ 506      EAEAEAFF 
+ 506      EBEBEB
+ 507 1d9f FFEBEBEB 		.ascii	"\377\353\353\353\377\353\353\353\377\353\353\353\377\353\353"
+ 507      FFEBEBEB 
+ 507      FFEBEBEB 
+ 507      FFEBEB
+ 508 1dae EBFFEBEB 		.ascii	"\353\377\353\353\353\377\353\353\353\377\354\354\354\377\354"
+ 508      EBFFEBEB 
+ 508      EBFFECEC 
+ 508      ECFFEC
+ 509 1dbd ECECFFEC 		.ascii	"\354\354\377\354\354\354\377\354\354\354\377\354\354\354\377"
+ 509      ECECFFEC 
+ 509      ECECFFEC 
+ 509      ECECFF
+ 510 1dcc ECECECFF 		.ascii	"\354\354\354\377\354\354\354\377\355\355\355\377\355\355\355"
+ 510      ECECECFF 
+ 510      EDEDEDFF 
+ 510      EDEDED
+ 511 1ddb FFEDEDED 		.ascii	"\377\355\355\355\377\355\355\355\377\355\355\355\377\355\355"
+ 511      FFEDEDED 
+ 511      FFEDEDED 
+ 511      FFEDED
+ 512 1dea EDFFEDED 		.ascii	"\355\377\355\355\355\377\356\356\356\377\356\356\356\377\356"
+ 512      EDFFEEEE 
+ 512      EEFFEEEE 
+ 512      EEFFEE
+ 513 1df9 EEEEFFEE 		.ascii	"\356\356\377\356\356\356\377\356\356\356\377\356\356\356\377"
+ 513      EEEEFFEE 
+ 513      EEEEFFEE 
+ 513      EEEEFF
+ 514 1e08 EEEEEEFF 		.ascii	"\356\356\356\377\357\357\357\377\357\357\357\377\357\357\357"
+ 514      EFEFEFFF 
+ 514      EFEFEFFF 
+ 514      EFEFEF
+ 515 1e17 FFEFEFEF 		.ascii	"\377\357\357\357\377\357\357\357\377\357\357\357\377\360\357"
+ 515      FFEFEFEF 
+ 515      FFEFEFEF 
+ 515      FFF0EF
+ 516 1e26 F0FFF0F0 		.ascii	"\360\377\360\360\360\377\360\360\360\377\360\360\360\377\360"
+ 516      F0FFF0F0 
+ 516      F0FFF0F0 
+ 516      F0FFF0
+ 517 1e35 F0F0FFF0 		.ascii	"\360\360\377\360\360\360\377\360\360\360\377\360\360\360\377"
+ 517      F0F0FFF0 
+ 517      F0F0FFF0 
+ 517      F0F0FF
+ 518 1e44 F0F0F0FF 		.ascii	"\360\360\360\377\360\360\360\377\360\360\360\377\361\361\361"
+ 518      F0F0F0FF 
+ 518      F0F0F0FF 
+ 518      F1F1F1
+GAS LISTING /tmp/cc9MX8t6.s 			page 35
+
+
+ 519 1e53 FFF1F1F1 		.ascii	"\377\361\361\361\377\361\361\361\377\361\361\361\377\361\361"
+ 519      FFF1F1F1 
+ 519      FFF1F1F1 
+ 519      FFF1F1
+ 520 1e62 F1FFF1F1 		.ascii	"\361\377\361\361\361\377\361\361\361\377\361\361\361\377\361"
+ 520      F1FFF1F1 
+ 520      F1FFF1F1 
+ 520      F1FFF1
+ 521 1e71 F1F1FFF1 		.ascii	"\361\361\377\361\361\361\377\361\361\361\377\362\362\362\377"
+ 521      F1F1FFF1 
+ 521      F1F1FFF2 
+ 521      F2F2FF
+ 522 1e80 F2F2F2FF 		.ascii	"\362\362\362\377\362\362\362\377\362\362\362\377\362\362\362"
+ 522      F2F2F2FF 
+ 522      F2F2F2FF 
+ 522      F2F2F2
+ 523 1e8f FFF2F2F2 		.ascii	"\377\362\362\362\377\362\362\362\377\362\362\362\377\362\362"
+ 523      FFF2F2F2 
+ 523      FFF2F2F2 
+ 523      FFF2F2
+ 524 1e9e F2FFF2F2 		.ascii	"\362\377\362\362\362\377\362\362\362\377\363\363\363\377\363"
+ 524      F2FFF2F2 
+ 524      F2FFF3F3 
+ 524      F3FFF3
+ 525 1ead F3F3FFF3 		.ascii	"\363\363\377\363\363\363\377\363\363\363\377\363\363\363\377"
+ 525      F3F3FFF3 
+ 525      F3F3FFF3 
+ 525      F3F3FF
+ 526 1ebc F3F3F3FF 		.ascii	"\363\363\363\377\363\363\363\377\363\363\363\377\363\363\363"
+ 526      F3F3F3FF 
+ 526      F3F3F3FF 
+ 526      F3F3F3
+ 527 1ecb FFF3F3F3 		.ascii	"\377\363\363\363\377\364\364\364\377\364\364\364\377\364\364"
+ 527      FFF4F4F4 
+ 527      FFF4F4F4 
+ 527      FFF4F4
+ 528 1eda F4FFF4F4 		.ascii	"\364\377\364\364\364\377\364\364\364\377\364\364\364\377\364"
+ 528      F4FFF4F4 
+ 528      F4FFF4F4 
+ 528      F4FFF4
+ 529 1ee9 F4F4FFF4 		.ascii	"\364\364\377\364\364\364\377\364\364\364\377\364\364\364\377"
+ 529      F4F4FFF4 
+ 529      F4F4FFF4 
+ 529      F4F4FF
+ 530 1ef8 F4F4F4FF 		.ascii	"\364\364\364\377\365\365\365\377\365\365\365\377\365\365\365"
+ 530      F5F5F5FF 
+ 530      F5F5F5FF 
+ 530      F5F5F5
+ 531 1f07 FFF5F5F5 		.ascii	"\377\365\365\365\377\365\365\365\377\365\365\365\377\365\365"
+ 531      FFF5F5F5 
+ 531      FFF5F5F5 
+ 531      FFF5F5
+ 532 1f16 F5FFF5F5 		.ascii	"\365\377\365\365\365\377\365\365\365\377\365\365\365\377\370"
+ 532      F5FFF5F5 
+ 532      F5FFF5F5 
+ 532      F5FFF8
+ 533 1f25 F8F8FFF9 		.ascii	"\370\370\377\371\371\371\377\371\371\371\377\371\371\371\377"
+GAS LISTING /tmp/cc9MX8t6.s 			page 36
+
+
+ 533      F9F9FFF9 
+ 533      F9F9FFF9 
+ 533      F9F9FF
+ 534 1f34 F9F9F9FF 		.ascii	"\371\371\371\377\371\371\371\377\371\371\371\377\371\371\371"
+ 534      F9F9F9FF 
+ 534      F9F9F9FF 
+ 534      F9F9F9
+ 535 1f43 FFF9F9F9 		.ascii	"\377\371\371\371\377\371\371\371\377\371\371\371\377\372\372"
+ 535      FFF9F9F9 
+ 535      FFF9F9F9 
+ 535      FFFAFA
+ 536 1f52 FAFFFAFA 		.ascii	"\372\377\372\372\372\377\372\372\372\377\372\372\372\377\372"
+ 536      FAFFFAFA 
+ 536      FAFFFAFA 
+ 536      FAFFFA
+ 537 1f61 FAFAFFFA 		.ascii	"\372\372\377\372\372\372\377\372\372\372\377\372\372\372\377"
+ 537      FAFAFFFA 
+ 537      FAFAFFFA 
+ 537      FAFAFF
+ 538 1f70 FAFAFAFF 		.ascii	"\372\372\372\377\372\372\372\377\372\372\372\377\373\373\373"
+ 538      FAFAFAFF 
+ 538      FAFAFAFF 
+ 538      FBFBFB
+ 539 1f7f FFFBFBFB 		.ascii	"\377\373\373\373\377\373\373\373\377\373\373\373\377\373\373"
+ 539      FFFBFBFB 
+ 539      FFFBFBFB 
+ 539      FFFBFB
+ 540 1f8e FBFFFBFB 		.ascii	"\373\377\373\373\373\377\373\373\373\377\373\373\373\377\373"
+ 540      FBFFFBFB 
+ 540      FBFFFBFB 
+ 540      FBFFFB
+ 541 1f9d FBFBFFFB 		.ascii	"\373\373\377\373\373\373\377\373\373\373\377\374\374\374\377"
+ 541      FBFBFFFB 
+ 541      FBFBFFFC 
+ 541      FCFCFF
+ 542 1fac FCFCFCFF 		.ascii	"\374\374\374\377\374\374\374\377\374\374\374\377\374\374\374"
+ 542      FCFCFCFF 
+ 542      FCFCFCFF 
+ 542      FCFCFC
+ 543 1fbb FFFCFCFC 		.ascii	"\377\374\374\374\377"
+ 543      FF
+ 544 1fc0 FCFCFCFF 		.ascii	"\374\374\374\377\374\374\374\377\374\374\374\377\374\374\374"
+ 544      FCFCFCFF 
+ 544      FCFCFCFF 
+ 544      FCFCFC
+ 545 1fcf FFFDFDFD 		.ascii	"\377\375\375\375\377\375\375\375\377\375\375\375\377\375\375"
+ 545      FFFDFDFD 
+ 545      FFFDFDFD 
+ 545      FFFDFD
+ 546 1fde FDFFFDFD 		.ascii	"\375\377\375\375\375\377\375\375\375\377\375\375\375\377\375"
+ 546      FDFFFDFD 
+ 546      FDFFFDFD 
+ 546      FDFFFD
+ 547 1fed FDFDFFFD 		.ascii	"\375\375\377\375\375\375\377\375\375\375\377\375\375\375\377"
+ 547      FDFDFFFD 
+ 547      FDFDFFFD 
+ 547      FDFDFF
+GAS LISTING /tmp/cc9MX8t6.s 			page 37
+
+
+ 548 1ffc FEFEFEFF 		.ascii	"\376\376\376\377\376\376\376\377\376\376\376\377\376\376\376"
+ 548      FEFEFEFF 
+ 548      FEFEFEFF 
+ 548      FEFEFE
+ 549 200b FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 549      FFFEFEFE 
+ 549      FFFEFEFE 
+ 549      FFFEFE
+ 550 201a FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377"
+ 550      FEFFFEFE 
+ 550      FEFF
+ 551              		.globl	heatmap_cs_Greys_soft
+ 552              		.section	.data.rel.local
+ 553              		.align 8
+ 554              		.type	heatmap_cs_Greys_soft, @object
+ 555              		.size	heatmap_cs_Greys_soft, 8
+ 556              	heatmap_cs_Greys_soft:
+ 557 0010 00000000 		.quad	soft
+ 557      00000000 
+ 558              		.section	.data.rel.ro.local
+ 559              		.align 16
+ 560              		.type	soft, @object
+ 561              		.size	soft, 16
+ 562              	soft:
+ 563 0020 00000000 		.quad	soft_data
+ 563      00000000 
+ 564 0028 01040000 		.quad	1025
+ 564      00000000 
+ 565              		.section	.rodata
+ 566 2024 00000000 		.align 32
+ 566      00000000 
+ 566      00000000 
+ 566      00000000 
+ 566      00000000 
+ 567              		.type	soft_data, @object
+ 568              		.size	soft_data, 4100
+ 569              	soft_data:
+ 570 2040 00       		.string	""
+ 571 2041 00       		.string	""
+ 572 2042 00       		.string	""
+ 573 2043 00       		.string	""
+ 574 2044 00       		.string	""
+ 575 2045 00       		.string	""
+ 576 2046 00       		.string	""
+ 577 2047 00       		.string	""
+ 578 2048 00       		.string	""
+ 579 2049 00       		.string	""
+ 580 204a 00       		.string	""
+ 581 204b 0700     		.string	"\007"
+ 582 204d 00       		.string	""
+ 583 204e 00       		.string	""
+ 584 204f 0E010101 		.ascii	"\016\001\001\001\026\001\001\001\035\002\002\002%\002\002\002"
+ 584      16010101 
+ 584      1D020202 
+ 584      25020202 
+ 585 205f 2C020202 		.ascii	",\002\002\0024\003\003\003;\003\003\003C\004\004\004J\004\004"
+ 585      34030303 
+GAS LISTING /tmp/cc9MX8t6.s 			page 38
+
+
+ 585      3B030303 
+ 585      43040404 
+ 585      4A0404
+ 586 2072 04520505 		.ascii	"\004R\005\005\005Y\005\005\005a\005\005\005h\006\006\006p\006"
+ 586      05590505 
+ 586      05610505 
+ 586      05680606 
+ 586      067006
+ 587 2085 06067707 		.ascii	"\006\006w\007\007\007\177\007\007\007\206\007\007\007\215\b\b"
+ 587      07077F07 
+ 587      07078607 
+ 587      07078D08 
+ 587      08
+ 588 2096 08950808 		.ascii	"\b\225\b\b\b\234\t\t\t\244\t\t\t\253\n\n\n\263\n\n\n\272\n\n"
+ 588      089C0909 
+ 588      09A40909 
+ 588      09AB0A0A 
+ 588      0AB30A0A 
+ 589 20ae 0AC20B0B 		.ascii	"\n\302\013\013\013\311\013\013\013\321\f\f\f\330\f\f\f\340\f"
+ 589      0BC90B0B 
+ 589      0BD10C0C 
+ 589      0CD80C0C 
+ 589      0CE00C
+ 590 20c1 0C0CE70D 		.ascii	"\f\f\347\r\r\r\357\r\r\r\366\r\r\r\376\016\016\016\377\016\016"
+ 590      0D0DEF0D 
+ 590      0D0DF60D 
+ 590      0D0DFE0E 
+ 590      0E0EFF0E 
+ 591 20d6 0EFF0E0E 		.ascii	"\016\377\016\016\016\377\017\017\017\377\017\017\017\377\017"
+ 591      0EFF0F0F 
+ 591      0FFF0F0F 
+ 591      0FFF0F
+ 592 20e5 0F0FFF10 		.ascii	"\017\017\377\020\020\020\377\020\020\020\377\020\020\020\377"
+ 592      1010FF10 
+ 592      1010FF10 
+ 592      1010FF
+ 593 20f4 101010FF 		.ascii	"\020\020\020\377\021\021\021\377\021\021\021\377\021\021\021"
+ 593      111111FF 
+ 593      111111FF 
+ 593      111111
+ 594 2103 FF121212 		.ascii	"\377\022\022\022\377\022\022\022\377\022\022\022\377\022\022"
+ 594      FF121212 
+ 594      FF121212 
+ 594      FF1212
+ 595 2112 12FF1313 		.ascii	"\022\377\023\023\023\377\023\023\023\377\023\023\023\377\023"
+ 595      13FF1313 
+ 595      13FF1313 
+ 595      13FF13
+ 596 2121 1313FF14 		.ascii	"\023\023\377\024\024\024\377\024\024\024\377\024\024\024\377"
+ 596      1414FF14 
+ 596      1414FF14 
+ 596      1414FF
+ 597 2130 141414FF 		.ascii	"\024\024\024\377\025\025\025\377\025\025\025\377\025\025\025"
+ 597      151515FF 
+ 597      151515FF 
+ 597      151515
+ 598 213f FF151515 		.ascii	"\377\025\025\025\377\026\026\026\377\026\026\026\377\026\026"
+GAS LISTING /tmp/cc9MX8t6.s 			page 39
+
+
+ 598      FF161616 
+ 598      FF161616 
+ 598      FF1616
+ 599 214e 16FF1616 		.ascii	"\026\377\026\026\026\377\027\027\027\377\027\027\027\377\027"
+ 599      16FF1717 
+ 599      17FF1717 
+ 599      17FF17
+ 600 215d 1717FF17 		.ascii	"\027\027\377\027\027\027\377\030\030\030\377\030\030\030\377"
+ 600      1717FF18 
+ 600      1818FF18 
+ 600      1818FF
+ 601 216c 181818FF 		.ascii	"\030\030\030\377\030\030\030\377\030\030\030\377\031\031\031"
+ 601      181818FF 
+ 601      181818FF 
+ 601      191919
+ 602 217b FF191919 		.ascii	"\377\031\031\031\377\031\031\031\377\031\031\031\377\032\032"
+ 602      FF191919 
+ 602      FF191919 
+ 602      FF1A1A
+ 603 218a 1AFF1A1A 		.ascii	"\032\377\032\032\032\377\032\032\032\377\032\032\032\377\032"
+ 603      1AFF1A1A 
+ 603      1AFF1A1A 
+ 603      1AFF1A
+ 604 2199 1A1AFF1B 		.ascii	"\032\032\377\033\033\033\377\033\033\033\377\033\033\033\377"
+ 604      1B1BFF1B 
+ 604      1B1BFF1B 
+ 604      1B1BFF
+ 605 21a8 1B1B1BFF 		.ascii	"\033\033\033\377\034\034\034\377\034\034\034\377\034\034\034"
+ 605      1C1C1CFF 
+ 605      1C1C1CFF 
+ 605      1C1C1C
+ 606 21b7 FF1C1C1C 		.ascii	"\377\034\034\034\377\035\035\035\377\035\035\035\377\035\035"
+ 606      FF1D1D1D 
+ 606      FF1D1D1D 
+ 606      FF1D1D
+ 607 21c6 1DFF1D1D 		.ascii	"\035\377\035\035\035\377\035\035\035\377\036\036\036\377\036"
+ 607      1DFF1D1D 
+ 607      1DFF1E1E 
+ 607      1EFF1E
+ 608 21d5 1E1EFF1E 		.ascii	"\036\036\377\036\036\036\377\036\036\036\377\037\037\037\377"
+ 608      1E1EFF1E 
+ 608      1E1EFF1F 
+ 608      1F1FFF
+ 609 21e4 1F1F1FFF 		.ascii	"\037\037\037\377\037\037\037\377\037\037\037\377   \377   \377"
+ 609      1F1F1FFF 
+ 609      1F1F1FFF 
+ 609      202020FF 
+ 609      202020FF 
+ 610 21f8 202020FF 		.ascii	"   \377   \377   \377!!!\377!!!\377!!!\377!!!\377\"\"\"\377\""
+ 610      202020FF 
+ 610      202020FF 
+ 610      212121FF 
+ 610      212121FF 
+ 611 2219 2222FF22 		.ascii	"\"\"\377\"\"\"\377\"\"\"\377###\377###\377###\377###\377$$$\377"
+ 611      2222FF22 
+ 611      2222FF23 
+ 611      2323FF23 
+GAS LISTING /tmp/cc9MX8t6.s 			page 40
+
+
+ 611      2323FF23 
+ 612 2238 242424FF 		.ascii	"$$$\377$$$\377$$$\377%$%\377%%%\377%%%\377%%%\377&&&\377&&&\377"
+ 612      242424FF 
+ 612      242424FF 
+ 612      252425FF 
+ 612      252525FF 
+ 613 225c 262626FF 		.ascii	"&&&\377'''\377'''\377'''\377(((\377(((\377(((\377)))\377)))\377"
+ 613      272727FF 
+ 613      272727FF 
+ 613      272727FF 
+ 613      282828FF 
+ 614 2280 292929FF 		.ascii	")))\377***\377***\377***\377+++\377+++\377+++\377,,,\377,,,\377"
+ 614      2A2A2AFF 
+ 614      2A2A2AFF 
+ 614      2A2A2AFF 
+ 614      2B2B2BFF 
+ 615 22a4 2C2C2CFF 		.ascii	",,,\377---\377---\377...\377...\377...\377///\377///\377///\377"
+ 615      2D2D2DFF 
+ 615      2D2D2DFF 
+ 615      2E2E2EFF 
+ 615      2E2E2EFF 
+ 616 22c8 303030FF 		.ascii	"000\377000\377000\377111\377111\377111\377222\377222\377222\377"
+ 616      303030FF 
+ 616      303030FF 
+ 616      313131FF 
+ 616      313131FF 
+ 617 22ec 333333FF 		.ascii	"333\377333\377333\377444\377444\377444\377555\377555\377555\377"
+ 617      333333FF 
+ 617      333333FF 
+ 617      343434FF 
+ 617      343434FF 
+ 618 2310 363636FF 		.ascii	"666\377666\377666\377777\377777\377777\377888\377888\377999\377"
+ 618      363636FF 
+ 618      363636FF 
+ 618      373737FF 
+ 618      373737FF 
+ 619 2334 393939FF 		.ascii	"999\377999\377:::\377:::\377:::\377;;;\377;;;\377;;;\377<<<\377"
+ 619      393939FF 
+ 619      3A3A3AFF 
+ 619      3A3A3AFF 
+ 619      3A3A3AFF 
+ 620 2358 3C3C3CFF 		.ascii	"<<<\377<<<\377===\377===\377===\377>>>\377>>>\377???\377???\377"
+ 620      3C3C3CFF 
+ 620      3D3D3DFF 
+ 620      3D3D3DFF 
+ 620      3D3D3DFF 
+ 621 237c 3F3F3FFF 		.ascii	"???\377@@@\377@@@\377@@@\377AAA\377AAA\377AAA\377BBB\377BBB\377"
+ 621      404040FF 
+ 621      404040FF 
+ 621      404040FF 
+ 621      414141FF 
+ 622 23a0 424242FF 		.ascii	"BBB\377CCC\377CCC\377DDD\377DDD\377DDD\377EEE\377EEE\377EEE\377"
+ 622      434343FF 
+ 622      434343FF 
+ 622      444444FF 
+ 622      444444FF 
+ 623 23c4 464646FF 		.ascii	"FFF\377FFF\377FFF\377GGG\377GGG\377HHH\377HHH\377HHH\377III\377"
+GAS LISTING /tmp/cc9MX8t6.s 			page 41
+
+
+ 623      464646FF 
+ 623      464646FF 
+ 623      474747FF 
+ 623      474747FF 
+ 624 23e8 494949FF 		.ascii	"III\377III\377JJJ\377JJJ\377JJJ\377KKK\377KKK\377LLL\377LLL\377"
+ 624      494949FF 
+ 624      4A4A4AFF 
+ 624      4A4A4AFF 
+ 624      4A4A4AFF 
+ 625 240c 4C4C4CFF 		.ascii	"LLL\377MMM\377MMM\377MMM\377NNN\377NNN\377OOO\377OOO\377OOO\377"
+ 625      4D4D4DFF 
+ 625      4D4D4DFF 
+ 625      4D4D4DFF 
+ 625      4E4E4EFF 
+ 626 2430 505050FF 		.ascii	"PPP\377PPP\377PPP\377QQQ\377QQQ\377RQR\377RRR\377RRR\377RRR\377"
+ 626      505050FF 
+ 626      505050FF 
+ 626      515151FF 
+ 626      515151FF 
+ 627 2454 535353FF 		.ascii	"SSS\377SSS\377SSS\377SSS\377TTT\377TTT\377TTT\377TTT\377UUU\377"
+ 627      535353FF 
+ 627      535353FF 
+ 627      535353FF 
+ 627      545454FF 
+ 628 2478 555555FF 		.ascii	"UUU\377UUU\377UUU\377VVV\377VVV\377VVV\377VVV\377WWW\377WWW\377"
+ 628      555555FF 
+ 628      555555FF 
+ 628      565656FF 
+ 628      565656FF 
+ 629 249c 575757FF 		.ascii	"WWW\377WWW\377XXX\377XXX\377XXX\377XXX\377YYY\377YYY\377YYY\377"
+ 629      575757FF 
+ 629      585858FF 
+ 629      585858FF 
+ 629      585858FF 
+ 630 24c0 595959FF 		.ascii	"YYY\377ZZZ\377ZZZ\377ZZZ\377ZZZ\377[[[\377[[[\377[[[\377[[[\377"
+ 630      5A5A5AFF 
+ 630      5A5A5AFF 
+ 630      5A5A5AFF 
+ 630      5A5A5AFF 
+ 631 24e4 5C5C5CFF 		.ascii	"\\\\\\\377\\\\\\\377\\\\\\\377\\\\\\\377]]]\377]]]\377]]]\377"
+ 631      5C5C5CFF 
+ 631      5C5C5CFF 
+ 631      5C5C5CFF 
+ 631      5D5D5DFF 
+ 632 2500 5D5D5DFF 		.ascii	"]]]\377^^^\377^^^\377^^^\377^^^\377___\377___\377___\377___\377"
+ 632      5E5E5EFF 
+ 632      5E5E5EFF 
+ 632      5E5E5EFF 
+ 632      5E5E5EFF 
+ 633 2524 606060FF 		.ascii	"```\377```\377```\377```\377aaa\377aaa\377aaa\377aaa\377bbb\377"
+ 633      606060FF 
+ 633      606060FF 
+ 633      606060FF 
+ 633      616161FF 
+ 634 2548 626262FF 		.ascii	"bbb\377bbb\377ccc\377ccc\377ccc\377ccc\377ddd\377ddd\377ddd\377"
+ 634      626262FF 
+ 634      636363FF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 42
+
+
+ 634      636363FF 
+ 634      636363FF 
+ 635 256c 646464FF 		.ascii	"ddd\377eee\377eee\377eee\377eee\377fff\377fff\377fff\377fff\377"
+ 635      656565FF 
+ 635      656565FF 
+ 635      656565FF 
+ 635      656565FF 
+ 636 2590 676767FF 		.ascii	"ggg\377ggg\377ggg\377ggg\377hhh\377hhh\377hhh\377iii\377iii\377"
+ 636      676767FF 
+ 636      676767FF 
+ 636      676767FF 
+ 636      686868FF 
+ 637 25b4 696969FF 		.ascii	"iii\377iii\377jjj\377jjj\377jjj\377jjj\377kkk\377kkk\377kkk\377"
+ 637      696969FF 
+ 637      6A6A6AFF 
+ 637      6A6A6AFF 
+ 637      6A6A6AFF 
+ 638 25d8 6B6B6BFF 		.ascii	"kkk\377lll\377lll\377lll\377lll\377mmm\377mmm\377mmm\377mmm\377"
+ 638      6C6C6CFF 
+ 638      6C6C6CFF 
+ 638      6C6C6CFF 
+ 638      6C6C6CFF 
+ 639 25fc 6E6E6EFF 		.ascii	"nnn\377nnn\377nnn\377ooo\377ooo\377ooo\377ooo\377ppp\377ppp\377"
+ 639      6E6E6EFF 
+ 639      6E6E6EFF 
+ 639      6F6F6FFF 
+ 639      6F6F6FFF 
+ 640 2620 707070FF 		.ascii	"ppp\377ppp\377qqq\377qqq\377qqq\377qqq\377rrr\377rrr\377rrr\377"
+ 640      707070FF 
+ 640      717171FF 
+ 640      717171FF 
+ 640      717171FF 
+ 641 2644 737273FF 		.ascii	"srs\377sss\377sss\377sss\377ttt\377ttt\377ttt\377ttt\377uuu\377"
+ 641      737373FF 
+ 641      737373FF 
+ 641      737373FF 
+ 641      747474FF 
+ 642 2668 757575FF 		.ascii	"uuu\377uuu\377uuu\377vvv\377vvv\377vvv\377www\377www\377www\377"
+ 642      757575FF 
+ 642      757575FF 
+ 642      767676FF 
+ 642      767676FF 
+ 643 268c 777777FF 		.ascii	"www\377xxx\377xxx\377xxx\377xxx\377yyy\377yyy\377yyy\377yyy\377"
+ 643      787878FF 
+ 643      787878FF 
+ 643      787878FF 
+ 643      787878FF 
+ 644 26b0 7A7A7AFF 		.ascii	"zzz\377zzz\377zzz\377{{{\377{{{\377{{{\377{{{\377|||\377|||\377"
+ 644      7A7A7AFF 
+ 644      7A7A7AFF 
+ 644      7B7B7BFF 
+ 644      7B7B7BFF 
+ 645 26d4 7C7C7CFF 		.ascii	"|||\377|||\377}}}\377}}}\377}}}\377~~~\377~~~\377~~~\377~~~\377"
+ 645      7C7C7CFF 
+ 645      7D7D7DFF 
+ 645      7D7D7DFF 
+ 645      7D7D7DFF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 43
+
+
+ 646 26f8 7F7F7FFF 		.ascii	"\177\177\177\377\177\177\177\377\177\177\177\377\177\177\177"
+ 646      7F7F7FFF 
+ 646      7F7F7FFF 
+ 646      7F7F7F
+ 647 2707 FF808080 		.ascii	"\377\200\200\200\377\200\200\200\377\200\200\200\377\201\201"
+ 647      FF808080 
+ 647      FF808080 
+ 647      FF8181
+ 648 2716 81FF8181 		.ascii	"\201\377\201\201\201\377\201\201\201\377\201\201\201\377\202"
+ 648      81FF8181 
+ 648      81FF8181 
+ 648      81FF82
+ 649 2725 8282FF82 		.ascii	"\202\202\377\202\202\202\377\202\202\202\377\202\202\202\377"
+ 649      8282FF82 
+ 649      8282FF82 
+ 649      8282FF
+ 650 2734 838383FF 		.ascii	"\203\203\203\377\203\203\203\377\203\203\203\377\204\204\204"
+ 650      838383FF 
+ 650      838383FF 
+ 650      848484
+ 651 2743 FF848484 		.ascii	"\377\204\204\204\377\204\204\204\377\204\204\204\377\205\205"
+ 651      FF848484 
+ 651      FF848484 
+ 651      FF8585
+ 652 2752 85FF8585 		.ascii	"\205\377\205\205\205\377\205\205\205\377\205\205\205\377\206"
+ 652      85FF8585 
+ 652      85FF8585 
+ 652      85FF86
+ 653 2761 8686FF86 		.ascii	"\206\206\377\206\206\206\377\206\206\206\377\207\207\207\377"
+ 653      8686FF86 
+ 653      8686FF87 
+ 653      8787FF
+ 654 2770 878787FF 		.ascii	"\207\207\207\377\207\207\207\377\207\207\207\377\210\210\210"
+ 654      878787FF 
+ 654      878787FF 
+ 654      888888
+ 655 277f FF888888 		.ascii	"\377\210\210\210\377\210\210\210\377\210\210\210\377\211\211"
+ 655      FF888888 
+ 655      FF888888 
+ 655      FF8989
+ 656 278e 89FF8989 		.ascii	"\211\377\211\211\211\377\211\211\211\377\212\212\212\377\212"
+ 656      89FF8989 
+ 656      89FF8A8A 
+ 656      8AFF8A
+ 657 279d 8A8AFF8A 		.ascii	"\212\212\377\212\212\212\377\212\212\212\377\213\213\213\377"
+ 657      8A8AFF8A 
+ 657      8A8AFF8B 
+ 657      8B8BFF
+ 658 27ac 8B8B8BFF 		.ascii	"\213\213\213\377\213\213\213\377\213\213\213\377\214\214\214"
+ 658      8B8B8BFF 
+ 658      8B8B8BFF 
+ 658      8C8C8C
+ 659 27bb FF8C8C8C 		.ascii	"\377\214\214\214\377\214\214\214\377\215\215\215\377\215\215"
+ 659      FF8C8C8C 
+ 659      FF8D8D8D 
+ 659      FF8D8D
+ 660 27ca 8DFF8D8D 		.ascii	"\215\377\215\215\215\377\215\215\215\377\216\216\216\377\216"
+GAS LISTING /tmp/cc9MX8t6.s 			page 44
+
+
+ 660      8DFF8D8D 
+ 660      8DFF8E8E 
+ 660      8EFF8E
+ 661 27d9 8E8EFF8E 		.ascii	"\216\216\377\216\216\216\377\217\217\217\377\217\217\217\377"
+ 661      8E8EFF8F 
+ 661      8F8FFF8F 
+ 661      8F8FFF
+ 662 27e8 8F8F8FFF 		.ascii	"\217\217\217\377\217\217\217\377\220\220\220\377\220\220\220"
+ 662      8F8F8FFF 
+ 662      909090FF 
+ 662      909090
+ 663 27f7 FF909090 		.ascii	"\377\220\220\220\377\220\220\220\377\221\221\221\377\221\221"
+ 663      FF909090 
+ 663      FF919191 
+ 663      FF9191
+ 664 2806 91FF9191 		.ascii	"\221\377\221\221\221\377\222\222\222\377"
+ 664      91FF9292 
+ 664      92FF
+ 665 2810 929292FF 		.ascii	"\222\222\222\377\222\222\222\377\222\222\222\377\223\223\223"
+ 665      929292FF 
+ 665      929292FF 
+ 665      939393
+ 666 281f FF939393 		.ascii	"\377\223\223\223\377\223\223\223\377\224\224\224\377\224\224"
+ 666      FF939393 
+ 666      FF949494 
+ 666      FF9494
+ 667 282e 94FF9494 		.ascii	"\224\377\224\224\224\377\224\224\224\377\225\225\225\377\225"
+ 667      94FF9494 
+ 667      94FF9595 
+ 667      95FF95
+ 668 283d 9595FF95 		.ascii	"\225\225\377\225\225\225\377\226\225\226\377\226\226\226\377"
+ 668      9595FF96 
+ 668      9596FF96 
+ 668      9696FF
+ 669 284c 969696FF 		.ascii	"\226\226\226\377\226\226\226\377\227\227\227\377\227\227\227"
+ 669      969696FF 
+ 669      979797FF 
+ 669      979797
+ 670 285b FF979797 		.ascii	"\377\227\227\227\377\230\230\230\377\230\230\230\377\230\230"
+ 670      FF989898 
+ 670      FF989898 
+ 670      FF9898
+ 671 286a 98FF9898 		.ascii	"\230\377\230\230\230\377\231\231\231\377\231\231\231\377\231"
+ 671      98FF9999 
+ 671      99FF9999 
+ 671      99FF99
+ 672 2879 9999FF9A 		.ascii	"\231\231\377\232\232\232\377\232\232\232\377\232\232\232\377"
+ 672      9A9AFF9A 
+ 672      9A9AFF9A 
+ 672      9A9AFF
+ 673 2888 9B9B9BFF 		.ascii	"\233\233\233\377\233\233\233\377\233\233\233\377\233\233\233"
+ 673      9B9B9BFF 
+ 673      9B9B9BFF 
+ 673      9B9B9B
+ 674 2897 FF9C9C9C 		.ascii	"\377\234\234\234\377\234\234\234\377\234\234\234\377\235\235"
+ 674      FF9C9C9C 
+ 674      FF9C9C9C 
+GAS LISTING /tmp/cc9MX8t6.s 			page 45
+
+
+ 674      FF9D9D
+ 675 28a6 9DFF9D9D 		.ascii	"\235\377\235\235\235\377\235\235\235\377\236\236\236\377\236"
+ 675      9DFF9D9D 
+ 675      9DFF9E9E 
+ 675      9EFF9E
+ 676 28b5 9E9EFF9E 		.ascii	"\236\236\377\236\236\236\377\236\236\236\377\237\237\237\377"
+ 676      9E9EFF9E 
+ 676      9E9EFF9F 
+ 676      9F9FFF
+ 677 28c4 9F9F9FFF 		.ascii	"\237\237\237\377\237\237\237\377\240\240\240\377\240\240\240"
+ 677      9F9F9FFF 
+ 677      A0A0A0FF 
+ 677      A0A0A0
+ 678 28d3 FFA0A0A0 		.ascii	"\377\240\240\240\377\241\241\241\377\241\241\241\377\241\241"
+ 678      FFA1A1A1 
+ 678      FFA1A1A1 
+ 678      FFA1A1
+ 679 28e2 A1FFA2A2 		.ascii	"\241\377\242\242\242\377\242\242\242\377\242\242\242\377\242"
+ 679      A2FFA2A2 
+ 679      A2FFA2A2 
+ 679      A2FFA2
+ 680 28f1 A2A2FFA3 		.ascii	"\242\242\377\243\243\243\377\243\243\243\377\243\243\243\377"
+ 680      A3A3FFA3 
+ 680      A3A3FFA3 
+ 680      A3A3FF
+ 681 2900 A4A4A4FF 		.ascii	"\244\244\244\377\244\244\244\377\244\244\244\377\245\245\245"
+ 681      A4A4A4FF 
+ 681      A4A4A4FF 
+ 681      A5A5A5
+ 682 290f FFA5A5A5 		.ascii	"\377\245\245\245\377\245\245\245\377\245\245\245\377\246\246"
+ 682      FFA5A5A5 
+ 682      FFA5A5A5 
+ 682      FFA6A6
+ 683 291e A6FFA6A6 		.ascii	"\246\377\246\246\246\377\246\246\246\377\247\247\247\377\247"
+ 683      A6FFA6A6 
+ 683      A6FFA7A7 
+ 683      A7FFA7
+ 684 292d A7A7FFA7 		.ascii	"\247\247\377\247\247\247\377\250\250\250\377\250\250\250\377"
+ 684      A7A7FFA8 
+ 684      A8A8FFA8 
+ 684      A8A8FF
+ 685 293c A8A8A8FF 		.ascii	"\250\250\250\377\250\250\250\377\251\251\251\377\251\251\251"
+ 685      A8A8A8FF 
+ 685      A9A9A9FF 
+ 685      A9A9A9
+ 686 294b FFA9A9A9 		.ascii	"\377\251\251\251\377\252\252\252\377\252\252\252\377\252\252"
+ 686      FFAAAAAA 
+ 686      FFAAAAAA 
+ 686      FFAAAA
+ 687 295a AAFFABAB 		.ascii	"\252\377\253\253\253\377\253\253\253\377\253\253\253\377\254"
+ 687      ABFFABAB 
+ 687      ABFFABAB 
+ 687      ABFFAC
+ 688 2969 ACACFFAC 		.ascii	"\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377"
+ 688      ACACFFAC 
+ 688      ACACFFAC 
+ 688      ACACFF
+GAS LISTING /tmp/cc9MX8t6.s 			page 46
+
+
+ 689 2978 ADADADFF 		.ascii	"\255\255\255\377\255\255\255\377\255\255\255\377\256\256\256"
+ 689      ADADADFF 
+ 689      ADADADFF 
+ 689      AEAEAE
+ 690 2987 FFAEAEAE 		.ascii	"\377\256\256\256\377\256\256\256\377\257\257\257\377\257\257"
+ 690      FFAEAEAE 
+ 690      FFAFAFAF 
+ 690      FFAFAF
+ 691 2996 AFFFAFAF 		.ascii	"\257\377\257\257\257\377\260\260\260\377\260\260\260\377\260"
+ 691      AFFFB0B0 
+ 691      B0FFB0B0 
+ 691      B0FFB0
+ 692 29a5 B0B0FFB0 		.ascii	"\260\260\377\260\260\260\377\261\261\261\377\261\261\261\377"
+ 692      B0B0FFB1 
+ 692      B1B1FFB1 
+ 692      B1B1FF
+ 693 29b4 B1B1B1FF 		.ascii	"\261\261\261\377\262\262\262\377\262\262\262\377\262\262\262"
+ 693      B2B2B2FF 
+ 693      B2B2B2FF 
+ 693      B2B2B2
+ 694 29c3 FFB3B3B3 		.ascii	"\377\263\263\263\377\263\263\263\377\263\263\263\377\264\264"
+ 694      FFB3B3B3 
+ 694      FFB3B3B3 
+ 694      FFB4B4
+ 695 29d2 B4FFB4B4 		.ascii	"\264\377\264\264\264\377\264\264\264\377\264\264\264\377\265"
+ 695      B4FFB4B4 
+ 695      B4FFB4B4 
+ 695      B4FFB5
+ 696 29e1 B5B5FFB5 		.ascii	"\265\265\377\265\265\265\377\265\265\265\377\266\266\266\377"
+ 696      B5B5FFB5 
+ 696      B5B5FFB6 
+ 696      B6B6FF
+ 697 29f0 B6B6B6FF 		.ascii	"\266\266\266\377\266\266\266\377\267\267\267\377\267\267\267"
+ 697      B6B6B6FF 
+ 697      B7B7B7FF 
+ 697      B7B7B7
+ 698 29ff FFB7B7B7 		.ascii	"\377\267\267\267\377\270\270\270\377\270\270\270\377\270\270"
+ 698      FFB8B8B8 
+ 698      FFB8B8B8 
+ 698      FFB8B8
+ 699 2a0e B8FFB8B8 		.ascii	"\270\377\270\270\270\377\271\271\271\377\271\271\271\377\271"
+ 699      B8FFB9B9 
+ 699      B9FFB9B9 
+ 699      B9FFB9
+ 700 2a1d B9B9FFBA 		.ascii	"\271\271\377\272\272\272\377\272\272\272\377\272\272\272\377"
+ 700      BABAFFBA 
+ 700      BABAFFBA 
+ 700      BABAFF
+ 701 2a2c BBBBBBFF 		.ascii	"\273\273\273\377\273\273\273\377\273\273\273\377\274\274\274"
+ 701      BBBBBBFF 
+ 701      BBBBBBFF 
+ 701      BCBCBC
+ 702 2a3b FFBCBCBC 		.ascii	"\377\274\274\274\377\274\274\274\377\275\274\275\377\275\275"
+ 702      FFBCBCBC 
+ 702      FFBDBCBD 
+ 702      FFBDBD
+ 703 2a4a BDFFBDBD 		.ascii	"\275\377\275\275\275\377\275\275\275\377\275\275\275\377\276"
+GAS LISTING /tmp/cc9MX8t6.s 			page 47
+
+
+ 703      BDFFBDBD 
+ 703      BDFFBDBD 
+ 703      BDFFBE
+ 704 2a59 BEBEFFBE 		.ascii	"\276\276\377\276\276\276\377\276\276\276\377\276\276\276\377"
+ 704      BEBEFFBE 
+ 704      BEBEFFBE 
+ 704      BEBEFF
+ 705 2a68 BEBEBEFF 		.ascii	"\276\276\276\377\277\277\277\377\277\277\277\377\277\277\277"
+ 705      BFBFBFFF 
+ 705      BFBFBFFF 
+ 705      BFBFBF
+ 706 2a77 FFBFBFBF 		.ascii	"\377\277\277\277\377\300\300\300\377\300\300\300\377\300\300"
+ 706      FFC0C0C0 
+ 706      FFC0C0C0 
+ 706      FFC0C0
+ 707 2a86 C0FFC0C0 		.ascii	"\300\377\300\300\300\377\300\300\300\377\301\301\301\377\301"
+ 707      C0FFC0C0 
+ 707      C0FFC1C1 
+ 707      C1FFC1
+ 708 2a95 C1C1FFC1 		.ascii	"\301\301\377\301\301\301\377\301\301\301\377\301\301\301\377"
+ 708      C1C1FFC1 
+ 708      C1C1FFC1 
+ 708      C1C1FF
+ 709 2aa4 C2C2C2FF 		.ascii	"\302\302\302\377\302\302\302\377\302\302\302\377\302\302\302"
+ 709      C2C2C2FF 
+ 709      C2C2C2FF 
+ 709      C2C2C2
+ 710 2ab3 FFC3C3C3 		.ascii	"\377\303\303\303\377\303\303\303\377\303\303\303\377\303\303"
+ 710      FFC3C3C3 
+ 710      FFC3C3C3 
+ 710      FFC3C3
+ 711 2ac2 C3FFC3C3 		.ascii	"\303\377\303\303\303\377\304\304\304\377\304\304\304\377\304"
+ 711      C3FFC4C4 
+ 711      C4FFC4C4 
+ 711      C4FFC4
+ 712 2ad1 C4C4FFC4 		.ascii	"\304\304\377\304\304\304\377\305\305\305\377\305\305\305\377"
+ 712      C4C4FFC5 
+ 712      C5C5FFC5 
+ 712      C5C5FF
+ 713 2ae0 C5C5C5FF 		.ascii	"\305\305\305\377\305\305\305\377\305\305\305\377\306\306\306"
+ 713      C5C5C5FF 
+ 713      C5C5C5FF 
+ 713      C6C6C6
+ 714 2aef FFC6C6C6 		.ascii	"\377\306\306\306\377\306\306\306\377\306\306\306\377\306\306"
+ 714      FFC6C6C6 
+ 714      FFC6C6C6 
+ 714      FFC6C6
+ 715 2afe C6FFC7C7 		.ascii	"\306\377\307\307\307\377\307\307\307\377\307\307\307\377\307"
+ 715      C7FFC7C7 
+ 715      C7FFC7C7 
+ 715      C7FFC7
+ 716 2b0d C7C7FFC8 		.ascii	"\307\307\377\310\310\310\377\310\310\310\377\310\310\310\377"
+ 716      C8C8FFC8 
+ 716      C8C8FFC8 
+ 716      C8C8FF
+ 717 2b1c C8C8C8FF 		.ascii	"\310\310\310\377\310\310\310\377\311\311\311\377\311\311\311"
+ 717      C8C8C8FF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 48
+
+
+ 717      C9C9C9FF 
+ 717      C9C9C9
+ 718 2b2b FFC9C9C9 		.ascii	"\377\311\311\311\377\311\311\311\377\312\312\312\377\312\312"
+ 718      FFC9C9C9 
+ 718      FFCACACA 
+ 718      FFCACA
+ 719 2b3a CAFFCACA 		.ascii	"\312\377\312\312\312\377\312\312\312\377\312\312\312\377\313"
+ 719      CAFFCACA 
+ 719      CAFFCACA 
+ 719      CAFFCB
+ 720 2b49 CBCBFFCB 		.ascii	"\313\313\377\313\313\313\377\313\313\313\377\313\313\313\377"
+ 720      CBCBFFCB 
+ 720      CBCBFFCB 
+ 720      CBCBFF
+ 721 2b58 CCCCCCFF 		.ascii	"\314\314\314\377\314\314\314\377\314\314\314\377\314\314\314"
+ 721      CCCCCCFF 
+ 721      CCCCCCFF 
+ 721      CCCCCC
+ 722 2b67 FFCCCCCC 		.ascii	"\377\314\314\314\377\315\315\315\377\315\315\315\377\315\315"
+ 722      FFCDCDCD 
+ 722      FFCDCDCD 
+ 722      FFCDCD
+ 723 2b76 CDFFCDCD 		.ascii	"\315\377\315\315\315\377\315\315\315\377\316\316\316\377\316"
+ 723      CDFFCDCD 
+ 723      CDFFCECE 
+ 723      CEFFCE
+ 724 2b85 CECEFFCE 		.ascii	"\316\316\377\316\316\316\377\316\316\316\377\317\317\317\377"
+ 724      CECEFFCE 
+ 724      CECEFFCF 
+ 724      CFCFFF
+ 725 2b94 CFCFCFFF 		.ascii	"\317\317\317\377\317\317\317\377\317\317\317\377\317\317\317"
+ 725      CFCFCFFF 
+ 725      CFCFCFFF 
+ 725      CFCFCF
+ 726 2ba3 FFD0D0D0 		.ascii	"\377\320\320\320\377\320\320\320\377\320\320\320\377\320\320"
+ 726      FFD0D0D0 
+ 726      FFD0D0D0 
+ 726      FFD0D0
+ 727 2bb2 D0FFD1D1 		.ascii	"\320\377\321\321\321\377\321\321\321\377\321\321\321\377\321"
+ 727      D1FFD1D1 
+ 727      D1FFD1D1 
+ 727      D1FFD1
+ 728 2bc1 D1D1FFD1 		.ascii	"\321\321\377\321\321\321\377\322\322\322\377\322\322\322\377"
+ 728      D1D1FFD2 
+ 728      D2D2FFD2 
+ 728      D2D2FF
+ 729 2bd0 D2D2D2FF 		.ascii	"\322\322\322\377\322\322\322\377\323\323\323\377\323\323\323"
+ 729      D2D2D2FF 
+ 729      D3D3D3FF 
+ 729      D3D3D3
+ 730 2bdf FFD3D3D3 		.ascii	"\377\323\323\323\377\323\323\323\377\323\323\323\377\324\324"
+ 730      FFD3D3D3 
+ 730      FFD3D3D3 
+ 730      FFD4D4
+ 731 2bee D4FFD4D4 		.ascii	"\324\377\324\324\324\377\324\324\324\377\324\324\324\377\325"
+ 731      D4FFD4D4 
+ 731      D4FFD4D4 
+GAS LISTING /tmp/cc9MX8t6.s 			page 49
+
+
+ 731      D4FFD5
+ 732 2bfd D5D5FFD5 		.ascii	"\325\325\377\325\325\325\377\325\325\325\377\325\325\325\377"
+ 732      D5D5FFD5 
+ 732      D5D5FFD5 
+ 732      D5D5FF
+ 733 2c0c D5D5D5FF 		.ascii	"\325\325\325\377\326\326\326\377\326\326\326\377\326\326\326"
+ 733      D6D6D6FF 
+ 733      D6D6D6FF 
+ 733      D6D6D6
+ 734 2c1b FFD6D6D6 		.ascii	"\377\326\326\326\377\327\327\327\377\327\327\327\377\327\327"
+ 734      FFD7D7D7 
+ 734      FFD7D7D7 
+ 734      FFD7D7
+ 735 2c2a D7FFD7D7 		.ascii	"\327\377\327\327\327\377\327\327\327\377\330\330\330\377\330"
+ 735      D7FFD7D7 
+ 735      D7FFD8D8 
+ 735      D8FFD8
+ 736 2c39 D8D8FFD8 		.ascii	"\330\330\377\330\330\330\377\330\330\330\377\331\330\331\377"
+ 736      D8D8FFD8 
+ 736      D8D8FFD9 
+ 736      D8D9FF
+ 737 2c48 D9D9D9FF 		.ascii	"\331\331\331\377\331\331\331\377\331\331\331\377\331\331\331"
+ 737      D9D9D9FF 
+ 737      D9D9D9FF 
+ 737      D9D9D9
+ 738 2c57 FFD9D9D9 		.ascii	"\377\331\331\331\377\332\332\332\377\332\332\332\377\332\332"
+ 738      FFDADADA 
+ 738      FFDADADA 
+ 738      FFDADA
+ 739 2c66 DAFFDADA 		.ascii	"\332\377\332\332\332\377\332\332\332\377\332\332\332\377\333"
+ 739      DAFFDADA 
+ 739      DAFFDADA 
+ 739      DAFFDB
+ 740 2c75 DBDBFFDB 		.ascii	"\333\333\377\333\333\333\377\333\333\333\377\333\333\333\377"
+ 740      DBDBFFDB 
+ 740      DBDBFFDB 
+ 740      DBDBFF
+ 741 2c84 DBDBDBFF 		.ascii	"\333\333\333\377\334\334\334\377\334\334\334\377\334\334\334"
+ 741      DCDCDCFF 
+ 741      DCDCDCFF 
+ 741      DCDCDC
+ 742 2c93 FFDCDCDC 		.ascii	"\377\334\334\334\377\334\334\334\377\334\334\334\377\335\335"
+ 742      FFDCDCDC 
+ 742      FFDCDCDC 
+ 742      FFDDDD
+ 743 2ca2 DDFFDDDD 		.ascii	"\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
+ 743      DDFFDDDD 
+ 743      DDFFDDDD 
+ 743      DDFFDD
+ 744 2cb1 DDDDFFDD 		.ascii	"\335\335\377\335\335\335\377\336\336\336\377\336\336\336\377"
+ 744      DDDDFFDE 
+ 744      DEDEFFDE 
+ 744      DEDEFF
+ 745 2cc0 DEDEDEFF 		.ascii	"\336\336\336\377\336\336\336\377\336\336\336\377\337\337\337"
+ 745      DEDEDEFF 
+ 745      DEDEDEFF 
+ 745      DFDFDF
+GAS LISTING /tmp/cc9MX8t6.s 			page 50
+
+
+ 746 2ccf FFDFDFDF 		.ascii	"\377\337\337\337\377\337\337\337\377\337\337\337\377\337\337"
+ 746      FFDFDFDF 
+ 746      FFDFDFDF 
+ 746      FFDFDF
+ 747 2cde DFFFDFDF 		.ascii	"\337\377\337\337\337\377\340\340\340\377\340\340\340\377\340"
+ 747      DFFFE0E0 
+ 747      E0FFE0E0 
+ 747      E0FFE0
+ 748 2ced E0E0FFE0 		.ascii	"\340\340\377\340\340\340\377\340\340\340\377\341\341\341\377"
+ 748      E0E0FFE0 
+ 748      E0E0FFE1 
+ 748      E1E1FF
+ 749 2cfc E1E1E1FF 		.ascii	"\341\341\341\377\341\341\341\377\341\341\341\377\341\341\341"
+ 749      E1E1E1FF 
+ 749      E1E1E1FF 
+ 749      E1E1E1
+ 750 2d0b FFE1E1E1 		.ascii	"\377\341\341\341\377\342\342\342\377\342\342\342\377\342\342"
+ 750      FFE2E2E2 
+ 750      FFE2E2E2 
+ 750      FFE2E2
+ 751 2d1a E2FFE2E2 		.ascii	"\342\377\342\342\342\377\342\342\342\377\343\343\343\377\343"
+ 751      E2FFE2E2 
+ 751      E2FFE3E3 
+ 751      E3FFE3
+ 752 2d29 E3E3FFE3 		.ascii	"\343\343\377\343\343\343\377\343\343\343\377\343\343\343\377"
+ 752      E3E3FFE3 
+ 752      E3E3FFE3 
+ 752      E3E3FF
+ 753 2d38 E3E3E3FF 		.ascii	"\343\343\343\377\344\344\344\377\344\344\344\377\344\344\344"
+ 753      E4E4E4FF 
+ 753      E4E4E4FF 
+ 753      E4E4E4
+ 754 2d47 FFE4E4E4 		.ascii	"\377\344\344\344\377\344\344\344\377\344\344\344\377\345\345"
+ 754      FFE4E4E4 
+ 754      FFE4E4E4 
+ 754      FFE5E5
+ 755 2d56 E5FFE5E5 		.ascii	"\345\377\345\345\345\377\345\345\345\377\345\345\345\377\345"
+ 755      E5FFE5E5 
+ 755      E5FFE5E5 
+ 755      E5FFE5
+ 756 2d65 E5E5FFE6 		.ascii	"\345\345\377\346\346\346\377\346\346\346\377\346\346\346\377"
+ 756      E6E6FFE6 
+ 756      E6E6FFE6 
+ 756      E6E6FF
+ 757 2d74 E6E6E6FF 		.ascii	"\346\346\346\377\346\346\346\377\346\346\346\377\347\347\347"
+ 757      E6E6E6FF 
+ 757      E6E6E6FF 
+ 757      E7E7E7
+ 758 2d83 FFE7E7E7 		.ascii	"\377\347\347\347\377\347\347\347\377\347\347\347\377\347\347"
+ 758      FFE7E7E7 
+ 758      FFE7E7E7 
+ 758      FFE7E7
+ 759 2d92 E7FFE8E8 		.ascii	"\347\377\350\350\350\377\350\350\350\377\350\350\350\377\350"
+ 759      E8FFE8E8 
+ 759      E8FFE8E8 
+ 759      E8FFE8
+ 760 2da1 E8E8FFE8 		.ascii	"\350\350\377\350\350\350\377\350\350\350\377\351\351\351\377"
+GAS LISTING /tmp/cc9MX8t6.s 			page 51
+
+
+ 760      E8E8FFE8 
+ 760      E8E8FFE9 
+ 760      E9E9FF
+ 761 2db0 E9E9E9FF 		.ascii	"\351\351\351\377\351\351\351\377\351\351\351\377\351\351\351"
+ 761      E9E9E9FF 
+ 761      E9E9E9FF 
+ 761      E9E9E9
+ 762 2dbf FFEAEAEA 		.ascii	"\377\352\352\352\377\352\352\352\377\352\352\352\377\352\352"
+ 762      FFEAEAEA 
+ 762      FFEAEAEA 
+ 762      FFEAEA
+ 763 2dce EAFFEAEA 		.ascii	"\352\377\352\352\352\377\352\352\352\377\353\353\353\377\353"
+ 763      EAFFEAEA 
+ 763      EAFFEBEB 
+ 763      EBFFEB
+ 764 2ddd EBEBFFEB 		.ascii	"\353\353\377\353\353\353\377\353\353\353\377\353\353\353\377"
+ 764      EBEBFFEB 
+ 764      EBEBFFEB 
+ 764      EBEBFF
+ 765 2dec ECECECFF 		.ascii	"\354\354\354\377\354\354\354\377\354\354\354\377\354\354\354"
+ 765      ECECECFF 
+ 765      ECECECFF 
+ 765      ECECEC
+ 766 2dfb FFECECEC 		.ascii	"\377\354\354\354\377\354\354\354\377\355\355\355\377\355\355"
+ 766      FFECECEC 
+ 766      FFEDEDED 
+ 766      FFEDED
+ 767 2e0a EDFFEDED 		.ascii	"\355\377\355\355\355\377\355\355\355\377\355\355\355\377\356"
+ 767      EDFFEDED 
+ 767      EDFFEDED 
+ 767      EDFFEE
+ 768 2e19 EEEEFFEE 		.ascii	"\356\356\377\356\356\356\377\356\356\356\377\356\356\356\377"
+ 768      EEEEFFEE 
+ 768      EEEEFFEE 
+ 768      EEEEFF
+ 769 2e28 EEEEEEFF 		.ascii	"\356\356\356\377\356\356\356\377\357\357\357\377\357\357\357"
+ 769      EEEEEEFF 
+ 769      EFEFEFFF 
+ 769      EFEFEF
+ 770 2e37 FFEFEFEF 		.ascii	"\377\357\357\357\377\357\357\357\377\357\357\357\377\360\357"
+ 770      FFEFEFEF 
+ 770      FFEFEFEF 
+ 770      FFF0EF
+ 771 2e46 F0FFF0F0 		.ascii	"\360\377\360\360\360\377\360\360\360\377\360\360\360\377\360"
+ 771      F0FFF0F0 
+ 771      F0FFF0F0 
+ 771      F0FFF0
+ 772 2e55 F0F0FFF0 		.ascii	"\360\360\377\360\360\360\377\360\360\360\377\360\360\360\377"
+ 772      F0F0FFF0 
+ 772      F0F0FFF0 
+ 772      F0F0FF
+ 773 2e64 F0F0F0FF 		.ascii	"\360\360\360\377\361\361\361\377\361\361\361\377\361\361\361"
+ 773      F1F1F1FF 
+ 773      F1F1F1FF 
+ 773      F1F1F1
+ 774 2e73 FFF1F1F1 		.ascii	"\377\361\361\361\377\361\361\361\377\361\361\361\377\361\361"
+ 774      FFF1F1F1 
+GAS LISTING /tmp/cc9MX8t6.s 			page 52
+
+
+ 774      FFF1F1F1 
+ 774      FFF1F1
+ 775 2e82 F1FFF1F1 		.ascii	"\361\377\361\361\361\377\361\361\361\377\362\362\362\377\362"
+ 775      F1FFF1F1 
+ 775      F1FFF2F2 
+ 775      F2FFF2
+ 776 2e91 F2F2FFF2 		.ascii	"\362\362\377\362\362\362\377\362\362\362\377\362\362\362\377"
+ 776      F2F2FFF2 
+ 776      F2F2FFF2 
+ 776      F2F2FF
+ 777 2ea0 F2F2F2FF 		.ascii	"\362\362\362\377\362\362\362\377\362\362\362\377\363\363\363"
+ 777      F2F2F2FF 
+ 777      F2F2F2FF 
+ 777      F3F3F3
+ 778 2eaf FFF3F3F3 		.ascii	"\377\363\363\363\377\363\363\363\377\363\363\363\377\363\363"
+ 778      FFF3F3F3 
+ 778      FFF3F3F3 
+ 778      FFF3F3
+ 779 2ebe F3FFF3F3 		.ascii	"\363\377\363\363\363\377\363\363\363\377\363\363\363\377\363"
+ 779      F3FFF3F3 
+ 779      F3FFF3F3 
+ 779      F3FFF3
+ 780 2ecd F3F3FFF4 		.ascii	"\363\363\377\364\364\364\377\364\364\364\377\364\364\364\377"
+ 780      F4F4FFF4 
+ 780      F4F4FFF4 
+ 780      F4F4FF
+ 781 2edc F4F4F4FF 		.ascii	"\364\364\364\377\364\364\364\377\364\364\364\377\364\364\364"
+ 781      F4F4F4FF 
+ 781      F4F4F4FF 
+ 781      F4F4F4
+ 782 2eeb FFF4F4F4 		.ascii	"\377\364\364\364\377\365\365\365\377\365\365\365\377\365\365"
+ 782      FFF5F5F5 
+ 782      FFF5F5F5 
+ 782      FFF5F5
+ 783 2efa F5FFF5F5 		.ascii	"\365\377\365\365\365\377\365\365\365\377\365\365\365\377\365"
+ 783      F5FFF5F5 
+ 783      F5FFF5F5 
+ 783      F5FFF5
+ 784 2f09 F5F5FFF5 		.ascii	"\365\365\377\365\365\365\377\365\365\365\377\366\366\366\377"
+ 784      F5F5FFF5 
+ 784      F5F5FFF6 
+ 784      F6F6FF
+ 785 2f18 F6F6F6FF 		.ascii	"\366\366\366\377\366\366\366\377\366\366\366\377\366\366\366"
+ 785      F6F6F6FF 
+ 785      F6F6F6FF 
+ 785      F6F6F6
+ 786 2f27 FFF6F6F6 		.ascii	"\377\366\366\366\377\366\366\366\377\366\366\366\377\367\367"
+ 786      FFF6F6F6 
+ 786      FFF6F6F6 
+ 786      FFF7F7
+ 787 2f36 F7FFF7F7 		.ascii	"\367\377\367\367\367\377\367\367\367\377\367\367\367\377\367"
+ 787      F7FFF7F7 
+ 787      F7FFF7F7 
+ 787      F7FFF7
+ 788 2f45 F7F7FFF7 		.ascii	"\367\367\377\367\367\367\377\367\367\367\377\367\367\367\377"
+ 788      F7F7FFF7 
+ 788      F7F7FFF7 
+GAS LISTING /tmp/cc9MX8t6.s 			page 53
+
+
+ 788      F7F7FF
+ 789 2f54 F7F7F7FF 		.ascii	"\367\367\367\377\370\370\370\377\370\370\370\377\370\370\370"
+ 789      F8F8F8FF 
+ 789      F8F8F8FF 
+ 789      F8F8F8
+ 790 2f63 FFF8F8F8 		.ascii	"\377\370\370\370\377\370\370\370\377\370\370\370\377\370\370"
+ 790      FFF8F8F8 
+ 790      FFF8F8F8 
+ 790      FFF8F8
+ 791 2f72 F8FFF8F8 		.ascii	"\370\377\370\370\370\377\371\371\371\377\371\371\371\377\371"
+ 791      F8FFF9F9 
+ 791      F9FFF9F9 
+ 791      F9FFF9
+ 792 2f81 F9F9FFF9 		.ascii	"\371\371\377\371\371\371\377\371\371\371\377\371\371\371\377"
+ 792      F9F9FFF9 
+ 792      F9F9FFF9 
+ 792      F9F9FF
+ 793 2f90 F9F9F9FF 		.ascii	"\371\371\371\377\371\371\371\377\371\371\371\377\372\372\372"
+ 793      F9F9F9FF 
+ 793      F9F9F9FF 
+ 793      FAFAFA
+ 794 2f9f FFFAFAFA 		.ascii	"\377\372\372\372\377\372\372\372\377\372\372\372\377\372\372"
+ 794      FFFAFAFA 
+ 794      FFFAFAFA 
+ 794      FFFAFA
+ 795 2fae FAFFFAFA 		.ascii	"\372\377\372\372\372\377\372\372\372\377\372\372\372\377\372"
+ 795      FAFFFAFA 
+ 795      FAFFFAFA 
+ 795      FAFFFA
+ 796 2fbd FAFAFFFB 		.ascii	"\372\372\377\373\373\373\377\373\373\373\377\373\373\373\377"
+ 796      FBFBFFFB 
+ 796      FBFBFFFB 
+ 796      FBFBFF
+ 797 2fcc FBFBFBFF 		.ascii	"\373\373\373\377\373\373\373\377\373\373\373\377\373\373\373"
+ 797      FBFBFBFF 
+ 797      FBFBFBFF 
+ 797      FBFBFB
+ 798 2fdb FFFBFBFB 		.ascii	"\377\373\373\373\377"
+ 798      FF
+ 799 2fe0 FCFCFCFF 		.ascii	"\374\374\374\377\374\374\374\377\374\374\374\377\374\374\374"
+ 799      FCFCFCFF 
+ 799      FCFCFCFF 
+ 799      FCFCFC
+ 800 2fef FFFCFCFC 		.ascii	"\377\374\374\374\377\374\374\374\377\374\374\374\377\374\374"
+ 800      FFFCFCFC 
+ 800      FFFCFCFC 
+ 800      FFFCFC
+ 801 2ffe FCFFFCFC 		.ascii	"\374\377\374\374\374\377\375\375\375\377\375\375\375\377\375"
+ 801      FCFFFDFD 
+ 801      FDFFFDFD 
+ 801      FDFFFD
+ 802 300d FDFDFFFD 		.ascii	"\375\375\377\375\375\375\377\375\375\375\377\375\375\375\377"
+ 802      FDFDFFFD 
+ 802      FDFDFFFD 
+ 802      FDFDFF
+ 803 301c FDFDFDFF 		.ascii	"\375\375\375\377\375\375\375\377\376\376\376\377\376\376\376"
+ 803      FDFDFDFF 
+GAS LISTING /tmp/cc9MX8t6.s 			page 54
+
+
+ 803      FEFEFEFF 
+ 803      FEFEFE
+ 804 302b FFFEFEFE 		.ascii	"\377\376\376\376\377\376\376\376\377\376\376\376\377\376\376"
+ 804      FFFEFEFE 
+ 804      FFFEFEFE 
+ 804      FFFEFE
+ 805 303a FEFFFEFE 		.ascii	"\376\377\376\376\376\377\376\376\376\377"
+ 805      FEFFFEFE 
+ 805      FEFF
+ 806              		.globl	heatmap_cs_Greys_discrete
+ 807              		.section	.data.rel.local
+ 808              		.align 8
+ 809              		.type	heatmap_cs_Greys_discrete, @object
+ 810              		.size	heatmap_cs_Greys_discrete, 8
+ 811              	heatmap_cs_Greys_discrete:
+ 812 0018 00000000 		.quad	discrete
+ 812      00000000 
+ 813              		.section	.data.rel.ro.local
+ 814              		.align 16
+ 815              		.type	discrete, @object
+ 816              		.size	discrete, 16
+ 817              	discrete:
+ 818 0030 00000000 		.quad	discrete_data
+ 818      00000000 
+ 819 0038 0A000000 		.quad	10
+ 819      00000000 
+ 820              		.section	.rodata
+ 821 3044 00000000 		.align 32
+ 821      00000000 
+ 821      00000000 
+ 821      00000000 
+ 821      00000000 
+ 822              		.type	discrete_data, @object
+ 823              		.size	discrete_data, 40
+ 824              	discrete_data:
+ 825 3060 00       		.string	""
+ 826 3061 00       		.string	""
+ 827 3062 00       		.string	""
+ 828 3063 00       		.string	""
+ 829 3064 00       		.string	""
+ 830 3065 00       		.string	""
+ 831 3066 00       		.string	""
+ 832 3067 FF252525 		.ascii	"\377%%%\377RRR\377sss\377\226\226\226\377\275\275\275\377\331"
+ 832      FF525252 
+ 832      FF737373 
+ 832      FF969696 
+ 832      FFBDBDBD 
+ 833 307d D9D9FFF0 		.ascii	"\331\331\377\360\360\360\377\377\377\377\377"
+ 833      F0F0FFFF 
+ 833      FFFFFF
+ 834              		.text
+ 835              	.Letext0:
+ 836              		.file 1 "./heatmap.h"
+ 837              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 838              		.file 3 "./colorschemes/Greys.h"
+ 839              		.file 4 "colorschemes/Greys.c"
+ 840              		.section	.debug_info,"",@progbits
+GAS LISTING /tmp/cc9MX8t6.s 			page 55
+
+
+ 841              	.Ldebug_info0:
+ 842 0000 E3010000 		.long	0x1e3
+ 843 0004 0500     		.value	0x5
+ 844 0006 01       		.byte	0x1
+ 845 0007 08       		.byte	0x8
+ 846 0008 00000000 		.long	.Ldebug_abbrev0
+ 847 000c 0A       		.uleb128 0xa
+ 848 000d 00000000 		.long	.LASF26
+ 849 0011 1D       		.byte	0x1d
+ 850 0012 00000000 		.long	.LASF0
+ 851 0016 00000000 		.long	.LASF1
+ 852 001a 00000000 		.long	.Ldebug_line0
+ 853 001e 01       		.uleb128 0x1
+ 854 001f 08       		.byte	0x8
+ 855 0020 05       		.byte	0x5
+ 856 0021 00000000 		.long	.LASF2
+ 857 0025 06       		.uleb128 0x6
+ 858 0026 00000000 		.long	.LASF12
+ 859 002a 02       		.byte	0x2
+ 860 002b D6       		.byte	0xd6
+ 861 002c 17       		.byte	0x17
+ 862 002d 31000000 		.long	0x31
+ 863 0031 01       		.uleb128 0x1
+ 864 0032 08       		.byte	0x8
+ 865 0033 07       		.byte	0x7
+ 866 0034 00000000 		.long	.LASF3
+ 867 0038 0B       		.uleb128 0xb
+ 868 0039 04       		.byte	0x4
+ 869 003a 05       		.byte	0x5
+ 870 003b 696E7400 		.string	"int"
+ 871 003f 01       		.uleb128 0x1
+ 872 0040 08       		.byte	0x8
+ 873 0041 05       		.byte	0x5
+ 874 0042 00000000 		.long	.LASF4
+ 875 0046 01       		.uleb128 0x1
+ 876 0047 10       		.byte	0x10
+ 877 0048 04       		.byte	0x4
+ 878 0049 00000000 		.long	.LASF5
+ 879 004d 01       		.uleb128 0x1
+ 880 004e 04       		.byte	0x4
+ 881 004f 04       		.byte	0x4
+ 882 0050 00000000 		.long	.LASF6
+ 883 0054 01       		.uleb128 0x1
+ 884 0055 04       		.byte	0x4
+ 885 0056 07       		.byte	0x7
+ 886 0057 00000000 		.long	.LASF7
+ 887 005b 01       		.uleb128 0x1
+ 888 005c 02       		.byte	0x2
+ 889 005d 07       		.byte	0x7
+ 890 005e 00000000 		.long	.LASF8
+ 891 0062 0C       		.uleb128 0xc
+ 892 0063 10       		.byte	0x10
+ 893 0064 01       		.byte	0x1
+ 894 0065 BB       		.byte	0xbb
+ 895 0066 09       		.byte	0x9
+ 896 0067 84000000 		.long	0x84
+ 897 006b 07       		.uleb128 0x7
+GAS LISTING /tmp/cc9MX8t6.s 			page 56
+
+
+ 898 006c 00000000 		.long	.LASF9
+ 899 0070 BC       		.byte	0xbc
+ 900 0071 1A       		.byte	0x1a
+ 901 0072 84000000 		.long	0x84
+ 902 0076 00       		.byte	0
+ 903 0077 07       		.uleb128 0x7
+ 904 0078 00000000 		.long	.LASF10
+ 905 007c BD       		.byte	0xbd
+ 906 007d 0C       		.byte	0xc
+ 907 007e 25000000 		.long	0x25
+ 908 0082 08       		.byte	0x8
+ 909 0083 00       		.byte	0
+ 910 0084 08       		.uleb128 0x8
+ 911 0085 90000000 		.long	0x90
+ 912 0089 01       		.uleb128 0x1
+ 913 008a 01       		.byte	0x1
+ 914 008b 08       		.byte	0x8
+ 915 008c 00000000 		.long	.LASF11
+ 916 0090 03       		.uleb128 0x3
+ 917 0091 89000000 		.long	0x89
+ 918 0095 06       		.uleb128 0x6
+ 919 0096 00000000 		.long	.LASF13
+ 920 009a 01       		.byte	0x1
+ 921 009b BE       		.byte	0xbe
+ 922 009c 03       		.byte	0x3
+ 923 009d 62000000 		.long	0x62
+ 924 00a1 03       		.uleb128 0x3
+ 925 00a2 95000000 		.long	0x95
+ 926 00a6 08       		.uleb128 0x8
+ 927 00a7 A1000000 		.long	0xa1
+ 928 00ab 04       		.uleb128 0x4
+ 929 00ac 00000000 		.long	.LASF14
+ 930 00b0 21       		.byte	0x21
+ 931 00b1 A6000000 		.long	0xa6
+ 932 00b5 04       		.uleb128 0x4
+ 933 00b6 00000000 		.long	.LASF15
+ 934 00ba 23       		.byte	0x23
+ 935 00bb A6000000 		.long	0xa6
+ 936 00bf 04       		.uleb128 0x4
+ 937 00c0 00000000 		.long	.LASF16
+ 938 00c4 25       		.byte	0x25
+ 939 00c5 A6000000 		.long	0xa6
+ 940 00c9 04       		.uleb128 0x4
+ 941 00ca 00000000 		.long	.LASF17
+ 942 00ce 28       		.byte	0x28
+ 943 00cf A6000000 		.long	0xa6
+ 944 00d3 09       		.uleb128 0x9
+ 945 00d4 90000000 		.long	0x90
+ 946 00d8 E3000000 		.long	0xe3
+ 947 00dc 0D       		.uleb128 0xd
+ 948 00dd 31000000 		.long	0x31
+ 949 00e1 27       		.byte	0x27
+ 950 00e2 00       		.byte	0
+ 951 00e3 03       		.uleb128 0x3
+ 952 00e4 D3000000 		.long	0xd3
+ 953 00e8 02       		.uleb128 0x2
+ 954 00e9 00000000 		.long	.LASF18
+GAS LISTING /tmp/cc9MX8t6.s 			page 57
+
+
+ 955 00ed 20       		.byte	0x20
+ 956 00ee 1C       		.byte	0x1c
+ 957 00ef E3000000 		.long	0xe3
+ 958 00f3 09       		.uleb128 0x9
+ 959 00f4 03       		.byte	0x3
+ 960 00f5 00000000 		.quad	discrete_data
+ 960      00000000 
+ 961 00fd 02       		.uleb128 0x2
+ 962 00fe 00000000 		.long	.LASF19
+ 963 0102 23       		.byte	0x23
+ 964 0103 24       		.byte	0x24
+ 965 0104 A1000000 		.long	0xa1
+ 966 0108 09       		.uleb128 0x9
+ 967 0109 03       		.byte	0x3
+ 968 010a 00000000 		.quad	discrete
+ 968      00000000 
+ 969 0112 05       		.uleb128 0x5
+ 970 0113 AB000000 		.long	0xab
+ 971 0117 24       		.byte	0x24
+ 972 0118 09       		.uleb128 0x9
+ 973 0119 03       		.byte	0x3
+ 974 011a 00000000 		.quad	heatmap_cs_Greys_discrete
+ 974      00000000 
+ 975 0122 09       		.uleb128 0x9
+ 976 0123 90000000 		.long	0x90
+ 977 0127 33010000 		.long	0x133
+ 978 012b 0E       		.uleb128 0xe
+ 979 012c 31000000 		.long	0x31
+ 980 0130 0310     		.value	0x1003
+ 981 0132 00       		.byte	0
+ 982 0133 03       		.uleb128 0x3
+ 983 0134 22010000 		.long	0x122
+ 984 0138 02       		.uleb128 0x2
+ 985 0139 00000000 		.long	.LASF20
+ 986 013d 26       		.byte	0x26
+ 987 013e 1C       		.byte	0x1c
+ 988 013f 33010000 		.long	0x133
+ 989 0143 09       		.uleb128 0x9
+ 990 0144 03       		.byte	0x3
+ 991 0145 00000000 		.quad	soft_data
+ 991      00000000 
+ 992 014d 02       		.uleb128 0x2
+ 993 014e 00000000 		.long	.LASF21
+ 994 0152 29       		.byte	0x29
+ 995 0153 24       		.byte	0x24
+ 996 0154 A1000000 		.long	0xa1
+ 997 0158 09       		.uleb128 0x9
+ 998 0159 03       		.byte	0x3
+ 999 015a 00000000 		.quad	soft
+ 999      00000000 
+ 1000 0162 05       		.uleb128 0x5
+ 1001 0163 B5000000 		.long	0xb5
+ 1002 0167 2A       		.byte	0x2a
+ 1003 0168 09       		.uleb128 0x9
+ 1004 0169 03       		.byte	0x3
+ 1005 016a 00000000 		.quad	heatmap_cs_Greys_soft
+ 1005      00000000 
+GAS LISTING /tmp/cc9MX8t6.s 			page 58
+
+
+ 1006 0172 02       		.uleb128 0x2
+ 1007 0173 00000000 		.long	.LASF22
+ 1008 0177 2C       		.byte	0x2c
+ 1009 0178 1C       		.byte	0x1c
+ 1010 0179 33010000 		.long	0x133
+ 1011 017d 09       		.uleb128 0x9
+ 1012 017e 03       		.byte	0x3
+ 1013 017f 00000000 		.quad	mixed_data
+ 1013      00000000 
+ 1014 0187 02       		.uleb128 0x2
+ 1015 0188 00000000 		.long	.LASF23
+ 1016 018c 2F       		.byte	0x2f
+ 1017 018d 24       		.byte	0x24
+ 1018 018e A1000000 		.long	0xa1
+ 1019 0192 09       		.uleb128 0x9
+ 1020 0193 03       		.byte	0x3
+ 1021 0194 00000000 		.quad	mixed
+ 1021      00000000 
+ 1022 019c 05       		.uleb128 0x5
+ 1023 019d BF000000 		.long	0xbf
+ 1024 01a1 30       		.byte	0x30
+ 1025 01a2 09       		.uleb128 0x9
+ 1026 01a3 03       		.byte	0x3
+ 1027 01a4 00000000 		.quad	heatmap_cs_Greys_mixed
+ 1027      00000000 
+ 1028 01ac 02       		.uleb128 0x2
+ 1029 01ad 00000000 		.long	.LASF24
+ 1030 01b1 32       		.byte	0x32
+ 1031 01b2 1C       		.byte	0x1c
+ 1032 01b3 33010000 		.long	0x133
+ 1033 01b7 09       		.uleb128 0x9
+ 1034 01b8 03       		.byte	0x3
+ 1035 01b9 00000000 		.quad	mixed_exp_data
+ 1035      00000000 
+ 1036 01c1 02       		.uleb128 0x2
+ 1037 01c2 00000000 		.long	.LASF25
+ 1038 01c6 35       		.byte	0x35
+ 1039 01c7 24       		.byte	0x24
+ 1040 01c8 A1000000 		.long	0xa1
+ 1041 01cc 09       		.uleb128 0x9
+ 1042 01cd 03       		.byte	0x3
+ 1043 01ce 00000000 		.quad	mixed_exp
+ 1043      00000000 
+ 1044 01d6 05       		.uleb128 0x5
+ 1045 01d7 C9000000 		.long	0xc9
+ 1046 01db 36       		.byte	0x36
+ 1047 01dc 09       		.uleb128 0x9
+ 1048 01dd 03       		.byte	0x3
+ 1049 01de 00000000 		.quad	heatmap_cs_Greys_mixed_exp
+ 1049      00000000 
+ 1050 01e6 00       		.byte	0
+ 1051              		.section	.debug_abbrev,"",@progbits
+ 1052              	.Ldebug_abbrev0:
+ 1053 0000 01       		.uleb128 0x1
+ 1054 0001 24       		.uleb128 0x24
+ 1055 0002 00       		.byte	0
+ 1056 0003 0B       		.uleb128 0xb
+GAS LISTING /tmp/cc9MX8t6.s 			page 59
+
+
+ 1057 0004 0B       		.uleb128 0xb
+ 1058 0005 3E       		.uleb128 0x3e
+ 1059 0006 0B       		.uleb128 0xb
+ 1060 0007 03       		.uleb128 0x3
+ 1061 0008 0E       		.uleb128 0xe
+ 1062 0009 00       		.byte	0
+ 1063 000a 00       		.byte	0
+ 1064 000b 02       		.uleb128 0x2
+ 1065 000c 34       		.uleb128 0x34
+ 1066 000d 00       		.byte	0
+ 1067 000e 03       		.uleb128 0x3
+ 1068 000f 0E       		.uleb128 0xe
+ 1069 0010 3A       		.uleb128 0x3a
+ 1070 0011 21       		.uleb128 0x21
+ 1071 0012 04       		.sleb128 4
+ 1072 0013 3B       		.uleb128 0x3b
+ 1073 0014 0B       		.uleb128 0xb
+ 1074 0015 39       		.uleb128 0x39
+ 1075 0016 0B       		.uleb128 0xb
+ 1076 0017 49       		.uleb128 0x49
+ 1077 0018 13       		.uleb128 0x13
+ 1078 0019 02       		.uleb128 0x2
+ 1079 001a 18       		.uleb128 0x18
+ 1080 001b 00       		.byte	0
+ 1081 001c 00       		.byte	0
+ 1082 001d 03       		.uleb128 0x3
+ 1083 001e 26       		.uleb128 0x26
+ 1084 001f 00       		.byte	0
+ 1085 0020 49       		.uleb128 0x49
+ 1086 0021 13       		.uleb128 0x13
+ 1087 0022 00       		.byte	0
+ 1088 0023 00       		.byte	0
+ 1089 0024 04       		.uleb128 0x4
+ 1090 0025 34       		.uleb128 0x34
+ 1091 0026 00       		.byte	0
+ 1092 0027 03       		.uleb128 0x3
+ 1093 0028 0E       		.uleb128 0xe
+ 1094 0029 3A       		.uleb128 0x3a
+ 1095 002a 21       		.uleb128 0x21
+ 1096 002b 03       		.sleb128 3
+ 1097 002c 3B       		.uleb128 0x3b
+ 1098 002d 0B       		.uleb128 0xb
+ 1099 002e 39       		.uleb128 0x39
+ 1100 002f 21       		.uleb128 0x21
+ 1101 0030 25       		.sleb128 37
+ 1102 0031 49       		.uleb128 0x49
+ 1103 0032 13       		.uleb128 0x13
+ 1104 0033 3F       		.uleb128 0x3f
+ 1105 0034 19       		.uleb128 0x19
+ 1106 0035 3C       		.uleb128 0x3c
+ 1107 0036 19       		.uleb128 0x19
+ 1108 0037 00       		.byte	0
+ 1109 0038 00       		.byte	0
+ 1110 0039 05       		.uleb128 0x5
+ 1111 003a 34       		.uleb128 0x34
+ 1112 003b 00       		.byte	0
+ 1113 003c 47       		.uleb128 0x47
+GAS LISTING /tmp/cc9MX8t6.s 			page 60
+
+
+ 1114 003d 13       		.uleb128 0x13
+ 1115 003e 3A       		.uleb128 0x3a
+ 1116 003f 21       		.uleb128 0x21
+ 1117 0040 04       		.sleb128 4
+ 1118 0041 3B       		.uleb128 0x3b
+ 1119 0042 0B       		.uleb128 0xb
+ 1120 0043 39       		.uleb128 0x39
+ 1121 0044 21       		.uleb128 0x21
+ 1122 0045 1E       		.sleb128 30
+ 1123 0046 02       		.uleb128 0x2
+ 1124 0047 18       		.uleb128 0x18
+ 1125 0048 00       		.byte	0
+ 1126 0049 00       		.byte	0
+ 1127 004a 06       		.uleb128 0x6
+ 1128 004b 16       		.uleb128 0x16
+ 1129 004c 00       		.byte	0
+ 1130 004d 03       		.uleb128 0x3
+ 1131 004e 0E       		.uleb128 0xe
+ 1132 004f 3A       		.uleb128 0x3a
+ 1133 0050 0B       		.uleb128 0xb
+ 1134 0051 3B       		.uleb128 0x3b
+ 1135 0052 0B       		.uleb128 0xb
+ 1136 0053 39       		.uleb128 0x39
+ 1137 0054 0B       		.uleb128 0xb
+ 1138 0055 49       		.uleb128 0x49
+ 1139 0056 13       		.uleb128 0x13
+ 1140 0057 00       		.byte	0
+ 1141 0058 00       		.byte	0
+ 1142 0059 07       		.uleb128 0x7
+ 1143 005a 0D       		.uleb128 0xd
+ 1144 005b 00       		.byte	0
+ 1145 005c 03       		.uleb128 0x3
+ 1146 005d 0E       		.uleb128 0xe
+ 1147 005e 3A       		.uleb128 0x3a
+ 1148 005f 21       		.uleb128 0x21
+ 1149 0060 01       		.sleb128 1
+ 1150 0061 3B       		.uleb128 0x3b
+ 1151 0062 0B       		.uleb128 0xb
+ 1152 0063 39       		.uleb128 0x39
+ 1153 0064 0B       		.uleb128 0xb
+ 1154 0065 49       		.uleb128 0x49
+ 1155 0066 13       		.uleb128 0x13
+ 1156 0067 38       		.uleb128 0x38
+ 1157 0068 0B       		.uleb128 0xb
+ 1158 0069 00       		.byte	0
+ 1159 006a 00       		.byte	0
+ 1160 006b 08       		.uleb128 0x8
+ 1161 006c 0F       		.uleb128 0xf
+ 1162 006d 00       		.byte	0
+ 1163 006e 0B       		.uleb128 0xb
+ 1164 006f 21       		.uleb128 0x21
+ 1165 0070 08       		.sleb128 8
+ 1166 0071 49       		.uleb128 0x49
+ 1167 0072 13       		.uleb128 0x13
+ 1168 0073 00       		.byte	0
+ 1169 0074 00       		.byte	0
+ 1170 0075 09       		.uleb128 0x9
+GAS LISTING /tmp/cc9MX8t6.s 			page 61
+
+
+ 1171 0076 01       		.uleb128 0x1
+ 1172 0077 01       		.byte	0x1
+ 1173 0078 49       		.uleb128 0x49
+ 1174 0079 13       		.uleb128 0x13
+ 1175 007a 01       		.uleb128 0x1
+ 1176 007b 13       		.uleb128 0x13
+ 1177 007c 00       		.byte	0
+ 1178 007d 00       		.byte	0
+ 1179 007e 0A       		.uleb128 0xa
+ 1180 007f 11       		.uleb128 0x11
+ 1181 0080 01       		.byte	0x1
+ 1182 0081 25       		.uleb128 0x25
+ 1183 0082 0E       		.uleb128 0xe
+ 1184 0083 13       		.uleb128 0x13
+ 1185 0084 0B       		.uleb128 0xb
+ 1186 0085 03       		.uleb128 0x3
+ 1187 0086 1F       		.uleb128 0x1f
+ 1188 0087 1B       		.uleb128 0x1b
+ 1189 0088 1F       		.uleb128 0x1f
+ 1190 0089 10       		.uleb128 0x10
+ 1191 008a 17       		.uleb128 0x17
+ 1192 008b 00       		.byte	0
+ 1193 008c 00       		.byte	0
+ 1194 008d 0B       		.uleb128 0xb
+ 1195 008e 24       		.uleb128 0x24
+ 1196 008f 00       		.byte	0
+ 1197 0090 0B       		.uleb128 0xb
+ 1198 0091 0B       		.uleb128 0xb
+ 1199 0092 3E       		.uleb128 0x3e
+ 1200 0093 0B       		.uleb128 0xb
+ 1201 0094 03       		.uleb128 0x3
+ 1202 0095 08       		.uleb128 0x8
+ 1203 0096 00       		.byte	0
+ 1204 0097 00       		.byte	0
+ 1205 0098 0C       		.uleb128 0xc
+ 1206 0099 13       		.uleb128 0x13
+ 1207 009a 01       		.byte	0x1
+ 1208 009b 0B       		.uleb128 0xb
+ 1209 009c 0B       		.uleb128 0xb
+ 1210 009d 3A       		.uleb128 0x3a
+ 1211 009e 0B       		.uleb128 0xb
+ 1212 009f 3B       		.uleb128 0x3b
+ 1213 00a0 0B       		.uleb128 0xb
+ 1214 00a1 39       		.uleb128 0x39
+ 1215 00a2 0B       		.uleb128 0xb
+ 1216 00a3 01       		.uleb128 0x1
+ 1217 00a4 13       		.uleb128 0x13
+ 1218 00a5 00       		.byte	0
+ 1219 00a6 00       		.byte	0
+ 1220 00a7 0D       		.uleb128 0xd
+ 1221 00a8 21       		.uleb128 0x21
+ 1222 00a9 00       		.byte	0
+ 1223 00aa 49       		.uleb128 0x49
+ 1224 00ab 13       		.uleb128 0x13
+ 1225 00ac 2F       		.uleb128 0x2f
+ 1226 00ad 0B       		.uleb128 0xb
+ 1227 00ae 00       		.byte	0
+GAS LISTING /tmp/cc9MX8t6.s 			page 62
+
+
+ 1228 00af 00       		.byte	0
+ 1229 00b0 0E       		.uleb128 0xe
+ 1230 00b1 21       		.uleb128 0x21
+ 1231 00b2 00       		.byte	0
+ 1232 00b3 49       		.uleb128 0x49
+ 1233 00b4 13       		.uleb128 0x13
+ 1234 00b5 2F       		.uleb128 0x2f
+ 1235 00b6 05       		.uleb128 0x5
+ 1236 00b7 00       		.byte	0
+ 1237 00b8 00       		.byte	0
+ 1238 00b9 00       		.byte	0
+ 1239              		.section	.debug_aranges,"",@progbits
+ 1240 0000 1C000000 		.long	0x1c
+ 1241 0004 0200     		.value	0x2
+ 1242 0006 00000000 		.long	.Ldebug_info0
+ 1243 000a 08       		.byte	0x8
+ 1244 000b 00       		.byte	0
+ 1245 000c 0000     		.value	0
+ 1246 000e 0000     		.value	0
+ 1247 0010 00000000 		.quad	0
+ 1247      00000000 
+ 1248 0018 00000000 		.quad	0
+ 1248      00000000 
+ 1249              		.section	.debug_line,"",@progbits
+ 1250              	.Ldebug_line0:
+ 1251 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1251      05000800 
+ 1251      49000000 
+ 1251      010101FB 
+ 1251      0E0D0001 
+ 1252              	.LASF20:
+ 1253 0000 736F6674 		.string	"soft_data"
+ 1253      5F646174 
+ 1253      6100
+ 1254              	.LASF12:
+ 1255 000a 73697A65 		.string	"size_t"
+ 1255      5F7400
+ 1256              	.LASF13:
+ 1257 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1257      6D61705F 
+ 1257      636F6C6F 
+ 1257      72736368 
+ 1257      656D655F 
+ 1258              	.LASF16:
+ 1259 0027 68656174 		.string	"heatmap_cs_Greys_mixed"
+ 1259      6D61705F 
+ 1259      63735F47 
+ 1259      72657973 
+ 1259      5F6D6978 
+ 1260              	.LASF15:
+ 1261 003e 68656174 		.string	"heatmap_cs_Greys_soft"
+ 1261      6D61705F 
+ 1261      63735F47 
+ 1261      72657973 
+ 1261      5F736F66 
+ 1262              	.LASF26:
+ 1263 0054 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+GAS LISTING /tmp/cc9MX8t6.s 			page 63
+
+
+ 1263      43313720 
+ 1263      31322E32 
+ 1263      2E30202D 
+ 1263      6D74756E 
+ 1264              	.LASF6:
+ 1265 00b3 666C6F61 		.string	"float"
+ 1265      7400
+ 1266              	.LASF17:
+ 1267 00b9 68656174 		.string	"heatmap_cs_Greys_mixed_exp"
+ 1267      6D61705F 
+ 1267      63735F47 
+ 1267      72657973 
+ 1267      5F6D6978 
+ 1268              	.LASF11:
+ 1269 00d4 756E7369 		.string	"unsigned char"
+ 1269      676E6564 
+ 1269      20636861 
+ 1269      7200
+ 1270              	.LASF3:
+ 1271 00e2 6C6F6E67 		.string	"long unsigned int"
+ 1271      20756E73 
+ 1271      69676E65 
+ 1271      6420696E 
+ 1271      7400
+ 1272              	.LASF8:
+ 1273 00f4 73686F72 		.string	"short unsigned int"
+ 1273      7420756E 
+ 1273      7369676E 
+ 1273      65642069 
+ 1273      6E7400
+ 1274              	.LASF14:
+ 1275 0107 68656174 		.string	"heatmap_cs_Greys_discrete"
+ 1275      6D61705F 
+ 1275      63735F47 
+ 1275      72657973 
+ 1275      5F646973 
+ 1276              	.LASF23:
+ 1277 0121 6D697865 		.string	"mixed"
+ 1277      6400
+ 1278              	.LASF7:
+ 1279 0127 756E7369 		.string	"unsigned int"
+ 1279      676E6564 
+ 1279      20696E74 
+ 1279      00
+ 1280              	.LASF19:
+ 1281 0134 64697363 		.string	"discrete"
+ 1281      72657465 
+ 1281      00
+ 1282              	.LASF10:
+ 1283 013d 6E636F6C 		.string	"ncolors"
+ 1283      6F727300 
+ 1284              	.LASF4:
+ 1285 0145 6C6F6E67 		.string	"long long int"
+ 1285      206C6F6E 
+ 1285      6720696E 
+ 1285      7400
+ 1286              	.LASF25:
+GAS LISTING /tmp/cc9MX8t6.s 			page 64
+
+
+ 1287 0153 6D697865 		.string	"mixed_exp"
+ 1287      645F6578 
+ 1287      7000
+ 1288              	.LASF24:
+ 1289 015d 6D697865 		.string	"mixed_exp_data"
+ 1289      645F6578 
+ 1289      705F6461 
+ 1289      746100
+ 1290              	.LASF22:
+ 1291 016c 6D697865 		.string	"mixed_data"
+ 1291      645F6461 
+ 1291      746100
+ 1292              	.LASF2:
+ 1293 0177 6C6F6E67 		.string	"long int"
+ 1293      20696E74 
+ 1293      00
+ 1294              	.LASF5:
+ 1295 0180 6C6F6E67 		.string	"long double"
+ 1295      20646F75 
+ 1295      626C6500 
+ 1296              	.LASF18:
+ 1297 018c 64697363 		.string	"discrete_data"
+ 1297      72657465 
+ 1297      5F646174 
+ 1297      6100
+ 1298              	.LASF21:
+ 1299 019a 736F6674 		.string	"soft"
+ 1299      00
+ 1300              	.LASF9:
+ 1301 019f 636F6C6F 		.string	"colors"
+ 1301      727300
+ 1302              		.section	.debug_line_str,"MS",@progbits,1
+ 1303              	.LASF1:
+ 1304 0000 2F726F6F 		.string	"/root/repo"
+ 1304      742F7265 
+ 1304      706F00
+ 1305              	.LASF0:
+ 1306 000b 636F6C6F 		.string	"colorschemes/Greys.c"
+ 1306      72736368 
+ 1306      656D6573 
+ 1306      2F477265 
+ 1306      79732E63 
+ 1307              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1308 0020 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1308      742F7265 
+ 1308      706F0063 
+ 1308      6F6C6F72 
+ 1308      73636865 
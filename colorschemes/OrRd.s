@@ -0,0 +1,4283 @@
+GAS LISTING /tmp/ccL1hvVp.s 			page 1
+
+
+   1              		.file	"OrRd.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/OrRd.c"
+   5              		.globl	heatmap_cs_OrRd_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_OrRd_mixed_exp, @object
+   9              		.size	heatmap_cs_OrRd_mixed_exp, 8
+  10              	heatmap_cs_OrRd_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 7E00     		.string	"~"
+  29 0006 00       		.string	""
+  30 0007 00       		.string	""
+  31 0008 8200     		.string	"\202"
+  32 000a 00       		.string	""
+  33 000b 188500   		.string	"\030\205"
+  34 000e 00       		.string	""
+  35 000f 318800   		.string	"1\210"
+  36 0012 00       		.string	""
+  37 0013 4A8B00   		.string	"J\213"
+  38 0016 00       		.string	""
+  39 0017 638E00   		.string	"c\216"
+  40 001a 00       		.string	""
+  41 001b 7C9100   		.string	"|\221"
+  42 001e 01959F00 		.string	"\001\225\237"
+  43 0022 01AEA200 		.string	"\001\256\242"
+  44 0026 00       		.string	""
+  45 0027 C7A500   		.string	"\307\245"
+  46 002a 00       		.string	""
+  47 002b E0A800   		.string	"\340\250"
+  48 002e 00       		.string	""
+  49 002f F9AB00   		.string	"\371\253"
+  50 0032 00       		.string	""
+  51 0033 FFAE00   		.string	"\377\256"
+  52 0036 00       		.string	""
+  53 0037 FFB100   		.string	"\377\261"
+  54 003a 00       		.string	""
+GAS LISTING /tmp/ccL1hvVp.s 			page 2
+
+
+  55 003b FFB30100 		.string	"\377\263\001"
+  56 003f FFB50502 		.ascii	"\377\265\005\002\377\267\t\003\377\271\r\005\377\273\020\007"
+  56      FFB70903 
+  56      FFB90D05 
+  56      FFBB1007 
+  57 004f FFBD1209 		.ascii	"\377\275\022\t\377\277\025\n\377\301\027\f\377\312#\024\377\314"
+  57      FFBF150A 
+  57      FFC1170C 
+  57      FFCA2314 
+  57      FFCC
+  58 0061 2516FFCE 		.ascii	"%\026\377\316'\027\377\317(\031\377\321*\032\377\323,\034\377"
+  58      2717FFCF 
+  58      2819FFD1 
+  58      2A1AFFD3 
+  58      2C1CFF
+  59 0074 D52E1DFF 		.ascii	"\325.\035\377\326/\036\377\3303 \377\3316\"\377\3328$\377\333"
+  59      D62F1EFF 
+  59      D83320FF 
+  59      D93622FF 
+  59      DA3824FF 
+  60 0089 3B26FFDC 		.ascii	";&\377\334>(\377\335@*\377\337C,\377\340E.\377\346R8\377\347"
+  60      3E28FFDD 
+  60      402AFFDF 
+  60      432CFFE0 
+  60      452EFFE6 
+  61 00a1 5439FFE8 		.ascii	"T9\377\350V;\377\351X=\377\352[?\377\353]A\377\354_B\377\355"
+  61      563BFFE9 
+  61      583DFFEA 
+  61      5B3FFFEB 
+  61      5D41FFEC 
+  62 00b9 6144FFEE 		.ascii	"aD\377\356cF\377\356dG\377\357fH\377\360hI\377\360jI\377\361"
+  62      6346FFEE 
+  62      6447FFEF 
+  62      6648FFF0 
+  62      6849FFF0 
+  63 00d1 6B4AFFF1 		.ascii	"kJ\377\361mJ\377\362nK\377\362pL\377\363rL\377\363sM\377\364"
+  63      6D4AFFF2 
+  63      6E4BFFF2 
+  63      704CFFF3 
+  63      724CFFF3 
+  64 00e9 754DFFF7 		.ascii	"uM\377\367~Q\377\367\177R\377\370\201S\377\370\202S\377\371\204"
+  64      7E51FFF7 
+  64      7F52FFF8 
+  64      8153FFF8 
+  64      8253FFF9 
+  65 00fe 54FFF985 		.ascii	"T\377\371\205U\377\372\206U\377\372\210V\377\372\211W\377\373"
+  65      55FFFA86 
+  65      55FFFA88 
+  65      56FFFA89 
+  65      57FFFB
+  66 0111 8A57FFFB 		.ascii	"\212W\377\373\214X\377\374\215Y\377\374\217Z\377\374\220[\377"
+  66      8C58FFFC 
+  66      8D59FFFC 
+  66      8F5AFFFC 
+  66      905BFF
+  67 0124 FC925DFF 		.ascii	"\374\222]\377\374\224^\377\374\225_\377\374\227`\377\374\230"
+  67      FC945EFF 
+GAS LISTING /tmp/ccL1hvVp.s 			page 3
+
+
+  67      FC955FFF 
+  67      FC9760FF 
+  67      FC98
+  68 0136 61FFFC9A 		.ascii	"a\377\374\232c\377\374\233d\377\374\235e\377\374\236f\377\374"
+  68      63FFFC9B 
+  68      64FFFC9D 
+  68      65FFFC9E 
+  68      66FFFC
+  69 0149 9F68FFFC 		.ascii	"\237h\377\374\252r\377\374\253s\377\374\254t\377\374\256u\377"
+  69      AA72FFFC 
+  69      AB73FFFC 
+  69      AC74FFFC 
+  69      AE75FF
+  70 015c FCAF77FF 		.ascii	"\374\257w\377\374\260x\377\374\262y\377\374\263{\377\374\264"
+  70      FCB078FF 
+  70      FCB279FF 
+  70      FCB37BFF 
+  70      FCB4
+  71 016e 7CFFFCB5 		.ascii	"|\377\374\265}\377\374\266\177\377\374\267\200\377\374\271\201"
+  71      7DFFFCB6 
+  71      7FFFFCB7 
+  71      80FFFCB9 
+  71      81
+  72 017f FFFCBA83 		.ascii	"\377\374\272\203\377\374\273\204\377\374\273\204\377\374\274"
+  72      FFFCBB84 
+  72      FFFCBB84 
+  72      FFFCBC
+  73 018e 85FFFCBD 		.ascii	"\205\377\374\275\205\377\374\275\206\377\374\276\207\377\374"
+  73      85FFFCBD 
+  73      86FFFCBE 
+  73      87FFFC
+  74 019d BF87FFFC 		.ascii	"\277\207\377\374\277\210\377\374\300\210\377\374\300\211\377"
+  74      BF88FFFC 
+  74      C088FFFC 
+  74      C089FF
+  75 01ac FCC18AFF 		.ascii	"\374\301\212\377\374\302\212\377\374\302\213\377\374\303\213"
+  75      FCC28AFF 
+  75      FCC28BFF 
+  75      FCC38B
+  76 01bb FFFCC38C 		.ascii	"\377\374\303\214\377\374\304\214\377\374\304\215\377\374\312"
+  76      FFFCC48C 
+  76      FFFCC48D 
+  76      FFFCCA
+  77 01ca 93FFFCCB 		.ascii	"\223\377\374\313\223\377\374\313\224\377\374\314\224\377\374"
+  77      93FFFCCB 
+  77      94FFFCCC 
+  77      94FFFC
+  78 01d9 CC95FFFC 		.ascii	"\314\225\377\374\315\226\377\374\315\226\377\374\316\227\377"
+  78      CD96FFFC 
+  78      CD96FFFC 
+  78      CE97FF
+  79 01e8 FCCE97FF 		.ascii	"\374\316\227\377\374\317\230\377\374\317\230\377\374\320\231"
+  79      FCCF98FF 
+  79      FCCF98FF 
+  79      FCD099
+  80 01f7 FFFCD099 		.ascii	"\377\374\320\231\377\374\321\232\377\374\321\233\377\374\321"
+  80      FFFCD19A 
+GAS LISTING /tmp/ccL1hvVp.s 			page 4
+
+
+  80      FFFCD19B 
+  80      FFFCD1
+  81 0206 9BFFFCD2 		.ascii	"\233\377\374\322\234\377\374\322\234\377\374\323\235\377\374"
+  81      9CFFFCD2 
+  81      9CFFFCD3 
+  81      9DFFFC
+  82 0215 D39DFFFD 		.ascii	"\323\235\377\375\324\236\377\375\324\237\377\375\324\237\377"
+  82      D49EFFFD 
+  82      D49FFFFD 
+  82      D49FFF
+  83 0224 FDD5A0FF 		.ascii	"\375\325\240\377\375\325\241\377\375\325\241\377\375\326\242"
+  83      FDD5A1FF 
+  83      FDD5A1FF 
+  83      FDD6A2
+  84 0233 FFFDD6A3 		.ascii	"\377\375\326\243\377\375\326\243\377\375\327\244\377\375\327"
+  84      FFFDD6A3 
+  84      FFFDD7A4 
+  84      FFFDD7
+  85 0242 A5FFFDD7 		.ascii	"\245\377\375\327\246\377\375\330\246\377\375\330\247\377\375"
+  85      A6FFFDD8 
+  85      A6FFFDD8 
+  85      A7FFFD
+  86 0251 D8A7FFFD 		.ascii	"\330\247\377\375\331\250\377\375\331\251\377\375\331\251\377"
+  86      D9A8FFFD 
+  86      D9A9FFFD 
+  86      D9A9FF
+  87 0260 FDDAAAFF 		.ascii	"\375\332\252\377\375\332\253\377\375\332\253\377\375\333\254"
+  87      FDDAABFF 
+  87      FDDAABFF 
+  87      FDDBAC
+  88 026f FFFDDBAC 		.ascii	"\377\375\333\254\377\375\333\255\377\375\333\256\377\375\340"
+  88      FFFDDBAD 
+  88      FFFDDBAE 
+  88      FFFDE0
+  89 027e B7FFFDE0 		.ascii	"\267\377\375\340\267\377\375\340\270\377\375\340\270\377\375"
+  89      B7FFFDE0 
+  89      B8FFFDE0 
+  89      B8FFFD
+  90 028d E1B9FFFD 		.ascii	"\341\271\377\375\341\271\377\375\341\272\377\375\342\273\377"
+  90      E1B9FFFD 
+  90      E1BAFFFD 
+  90      E2BBFF
+  91 029c FDE2BBFF 		.ascii	"\375\342\273\377\375\342\274\377\375\342\274\377\375\343\275"
+  91      FDE2BCFF 
+  91      FDE2BCFF 
+  91      FDE3BD
+  92 02ab FFFDE3BD 		.ascii	"\377\375\343\275\377\375\343\276\377\375\343\276\377\375\343"
+  92      FFFDE3BE 
+  92      FFFDE3BE 
+  92      FFFDE3
+  93 02ba BFFFFDE4 		.ascii	"\277\377\375\344\277\377\375\344\300\377\375\344\300\377\375"
+  93      BFFFFDE4 
+  93      C0FFFDE4 
+  93      C0FFFD
+  94 02c9 E4C1FFFD 		.ascii	"\344\301\377\375\345\301\377\375\345\302\377\375\345\302\377"
+  94      E5C1FFFD 
+  94      E5C2FFFD 
+GAS LISTING /tmp/ccL1hvVp.s 			page 5
+
+
+  94      E5C2FF
+  95 02d8 FDE5C3FF 		.ascii	"\375\345\303\377\375\345\303\377\375\346\303\377\375\346\304"
+  95      FDE5C3FF 
+  95      FDE6C3FF 
+  95      FDE6C4
+  96 02e7 FFFDE6C4 		.ascii	"\377\375\346\304\377\375\346\305\377\375\346\305\377\375\347"
+  96      FFFDE6C5 
+  96      FFFDE6C5 
+  96      FFFDE7
+  97 02f6 C6FFFDE7 		.ascii	"\306\377\375\347\306\377\375\347\307\377\375\347\307\377\375"
+  97      C6FFFDE7 
+  97      C7FFFDE7 
+  97      C7FFFD
+  98 0305 E7C7FFFE 		.ascii	"\347\307\377\376\350\310\377\376\350\310\377\376\350\310\377"
+  98      E8C8FFFE 
+  98      E8C8FFFE 
+  98      E8C8FF
+  99 0314 FEE8C9FF 		.ascii	"\376\350\311\377\376\350\311\377\376\350\311\377\376\350\312"
+  99      FEE8C9FF 
+  99      FEE8C9FF 
+  99      FEE8CA
+ 100 0323 FFFEE9CA 		.ascii	"\377\376\351\312\377\376\351\312\377\376\351\313\377\376\351"
+ 100      FFFEE9CA 
+ 100      FFFEE9CB 
+ 100      FFFEE9
+ 101 0332 CBFFFEE9 		.ascii	"\313\377\376\351\313\377\376\351\314\377\376\351\314\377\376"
+ 101      CBFFFEE9 
+ 101      CCFFFEE9 
+ 101      CCFFFE
+ 102 0341 E9CCFFFE 		.ascii	"\351\314\377\376\352\314\377\376\352\315\377\376\352\315\377"
+ 102      EACCFFFE 
+ 102      EACDFFFE 
+ 102      EACDFF
+ 103 0350 FEEACDFF 		.ascii	"\376\352\315\377\376\352\316\377\376\352\316\377\376\352\316"
+ 103      FEEACEFF 
+ 103      FEEACEFF 
+ 103      FEEACE
+ 104 035f FFFEEACE 		.ascii	"\377\376\352\316\377\376\353\317\377\376\353\317\377\376\353"
+ 104      FFFEEBCF 
+ 104      FFFEEBCF 
+ 104      FFFEEB
+ 105 036e CFFFFEEB 		.ascii	"\317\377\376\353\317\377\376\353\320\377\376\353\320\377\376"
+ 105      CFFFFEEB 
+ 105      D0FFFEEB 
+ 105      D0FFFE
+ 106 037d EBD0FFFE 		.ascii	"\353\320\377\376\353\320\377\376\353\321\377\376\353\321\377"
+ 106      EBD0FFFE 
+ 106      EBD1FFFE 
+ 106      EBD1FF
+ 107 038c FEECD1FF 		.ascii	"\376\354\321\377\376\354\321\377\376\354\322\377\376\354\322"
+ 107      FEECD1FF 
+ 107      FEECD2FF 
+ 107      FEECD2
+ 108 039b FFFEECD2 		.ascii	"\377\376\354\322\377\376\354\322\377\376\354\323\377\376\354"
+ 108      FFFEECD2 
+ 108      FFFEECD3 
+ 108      FFFEEC
+GAS LISTING /tmp/ccL1hvVp.s 			page 6
+
+
+ 109 03aa D3FFFEEC 		.ascii	"\323\377\376\354\323\377\376\354\323\377\376\354\323\377\376"
+ 109      D3FFFEEC 
+ 109      D3FFFEEC 
+ 109      D3FFFE
+ 110 03b9 EDD4FFFE 		.ascii	"\355\324\377\376\355\324\377\376\355\324\377\376\355\324\377"
+ 110      EDD4FFFE 
+ 110      EDD4FFFE 
+ 110      EDD4FF
+ 111 03c8 FEEDD5FF 		.ascii	"\376\355\325\377\376\355\325\377\376\355\325\377\376\355\325"
+ 111      FEEDD5FF 
+ 111      FEEDD5FF 
+ 111      FEEDD5
+ 112 03d7 FFFEEDD5 		.ascii	"\377\376\355\325\377\376\355\325\377\376\355\326\377\376\360"
+ 112      FFFEEDD5 
+ 112      FFFEEDD6 
+ 112      FFFEF0
+ 113 03e6 DDFFFEF1 		.ascii	"\335\377\376\361\335\377\376\361\335\377\376\361\336\377\376"
+ 113      DDFFFEF1 
+ 113      DDFFFEF1 
+ 113      DEFFFE
+ 114 03f5 F1DEFFFE 		.ascii	"\361\336\377\376\361\336\377\376\361\336\377\376\361\336\377"
+ 114      F1DEFFFE 
+ 114      F1DEFFFE 
+ 114      F1DEFF
+ 115 0404 FEF1DEFF 		.ascii	"\376\361\336\377\376\361\337\377\376\361\337\377\376\361\337"
+ 115      FEF1DFFF 
+ 115      FEF1DFFF 
+ 115      FEF1DF
+ 116 0413 FFFEF1DF 		.ascii	"\377\376\361\337\377\376\361\337\377\376\361\337\377\376\362"
+ 116      FFFEF1DF 
+ 116      FFFEF1DF 
+ 116      FFFEF2
+ 117 0422 E0FFFEF2 		.ascii	"\340\377\376\362\340\377\376\362\340\377\376\362\340\377\376"
+ 117      E0FFFEF2 
+ 117      E0FFFEF2 
+ 117      E0FFFE
+ 118 0431 F2E0FFFE 		.ascii	"\362\340\377\376\362\340\377\376\362\341\377\376\362\341\377"
+ 118      F2E0FFFE 
+ 118      F2E1FFFE 
+ 118      F2E1FF
+ 119 0440 FEF2E1FF 		.ascii	"\376\362\341\377\376\362\341\377\376\362\341\377\376\362\341"
+ 119      FEF2E1FF 
+ 119      FEF2E1FF 
+ 119      FEF2E1
+ 120 044f FFFEF2E1 		.ascii	"\377\376\362\341\377\376\362\341\377\376\362\342\377\376\362"
+ 120      FFFEF2E1 
+ 120      FFFEF2E2 
+ 120      FFFEF2
+ 121 045e E2FFFEF3 		.ascii	"\342\377\376\363\342\377\376\363\342\377\376\363\342\377\376"
+ 121      E2FFFEF3 
+ 121      E2FFFEF3 
+ 121      E2FFFE
+ 122 046d F3E2FFFE 		.ascii	"\363\342\377\376\363\342\377\376\363\343\377\376\363\343\377"
+ 122      F3E2FFFE 
+ 122      F3E3FFFE 
+ 122      F3E3FF
+ 123 047c FEF3E3FF 		.ascii	"\376\363\343\377\376\363\343\377\376\363\343\377\376\363\343"
+GAS LISTING /tmp/ccL1hvVp.s 			page 7
+
+
+ 123      FEF3E3FF 
+ 123      FEF3E3FF 
+ 123      FEF3E3
+ 124 048b FFFEF3E3 		.ascii	"\377\376\363\343\377\376\363\343\377\376\363\343\377\376\363"
+ 124      FFFEF3E3 
+ 124      FFFEF3E3 
+ 124      FFFEF3
+ 125 049a E4FFFEF3 		.ascii	"\344\377\376\363\344\377\376\363\344\377\376\363\344\377\376"
+ 125      E4FFFEF3 
+ 125      E4FFFEF3 
+ 125      E4FFFE
+ 126 04a9 F3E4FFFE 		.ascii	"\363\344\377\376\363\344\377\376\363\344\377\376\363\344\377"
+ 126      F3E4FFFE 
+ 126      F3E4FFFE 
+ 126      F3E4FF
+ 127 04b8 FEF4E4FF 		.ascii	"\376\364\344\377\376\364\344\377\376\364\345\377\376\364\345"
+ 127      FEF4E4FF 
+ 127      FEF4E5FF 
+ 127      FEF4E5
+ 128 04c7 FFFEF4E5 		.ascii	"\377\376\364\345\377\376\364\345\377\376\364\345\377\376\364"
+ 128      FFFEF4E5 
+ 128      FFFEF4E5 
+ 128      FFFEF4
+ 129 04d6 E5FFFEF4 		.ascii	"\345\377\376\364\345\377\376\364\345\377\376\364\345\377\376"
+ 129      E5FFFEF4 
+ 129      E5FFFEF4 
+ 129      E5FFFE
+ 130 04e5 F4E5FFFE 		.ascii	"\364\345\377\376\364\345\377\376\364\346\377\376\364\346\377"
+ 130      F4E5FFFE 
+ 130      F4E6FFFE 
+ 130      F4E6FF
+ 131 04f4 FEF4E6FF 		.ascii	"\376\364\346\377\376\364\346\377\376\364\346\377\376\364\346"
+ 131      FEF4E6FF 
+ 131      FEF4E6FF 
+ 131      FEF4E6
+ 132 0503 FFFEF4E6 		.ascii	"\377\376\364\346\377\376\364\346\377\376\364\346\377\376\364"
+ 132      FFFEF4E6 
+ 132      FFFEF4E6 
+ 132      FFFEF4
+ 133 0512 E6FFFEF4 		.ascii	"\346\377\376\364\346\377\376\364\346\377\376\364\346\377\376"
+ 133      E6FFFEF4 
+ 133      E6FFFEF4 
+ 133      E6FFFE
+ 134 0521 F4E7FFFE 		.ascii	"\364\347\377\376\364\347\377\376\365\347\377\376\365\347\377"
+ 134      F4E7FFFE 
+ 134      F5E7FFFE 
+ 134      F5E7FF
+ 135 0530 FEF5E7FF 		.ascii	"\376\365\347\377\376\365\347\377\376\365\347\377\376\365\347"
+ 135      FEF5E7FF 
+ 135      FEF5E7FF 
+ 135      FEF5E7
+ 136 053f FFFEF5E7 		.ascii	"\377\376\365\347\377\376\365\347\377\376\365\347\377\376\365"
+ 136      FFFEF5E7 
+ 136      FFFEF5E7 
+ 136      FFFEF5
+ 137 054e E7FFFEF5 		.ascii	"\347\377\376\365\347\377\376\365\347\377\376\365\347\377\376"
+ 137      E7FFFEF5 
+GAS LISTING /tmp/ccL1hvVp.s 			page 8
+
+
+ 137      E7FFFEF5 
+ 137      E7FFFE
+ 138 055d F5E8FFFE 		.ascii	"\365\350\377\376\365\350\377\376\365\350\377\376\365\350\377"
+ 138      F5E8FFFE 
+ 138      F5E8FFFE 
+ 138      F5E8FF
+ 139 056c FEF5E8FF 		.ascii	"\376\365\350\377\376\365\350\377\376\365\350\377\376\365\350"
+ 139      FEF5E8FF 
+ 139      FEF5E8FF 
+ 139      FEF5E8
+ 140 057b FFFEF5E8 		.ascii	"\377\376\365\350\377\376\365\350\377\376\365\350\377\376\365"
+ 140      FFFEF5E8 
+ 140      FFFEF5E8 
+ 140      FFFEF5
+ 141 058a E8FFFEF5 		.ascii	"\350\377\376\365\350\377\376\365\350\377\376\365\350\377\376"
+ 141      E8FFFEF5 
+ 141      E8FFFEF5 
+ 141      E8FFFE
+ 142 0599 F5E8FFFE 		.ascii	"\365\350\377\376\365\350\377\376\365\350\377\376\365\350\377"
+ 142      F5E8FFFE 
+ 142      F5E8FFFE 
+ 142      F5E8FF
+ 143 05a8 FEF5E8FF 		.ascii	"\376\365\350\377\376\365\351\377\376\365\351\377\376\365\351"
+ 143      FEF5E9FF 
+ 143      FEF5E9FF 
+ 143      FEF5E9
+ 144 05b7 FFFEF5E9 		.ascii	"\377\376\365\351\377\376\365\351\377\376\365\351\377\376\365"
+ 144      FFFEF5E9 
+ 144      FFFEF5E9 
+ 144      FFFEF5
+ 145 05c6 E9FFFEF5 		.ascii	"\351\377\376\365\351\377\376\365\351\377\376\365\351\377\376"
+ 145      E9FFFEF5 
+ 145      E9FFFEF5 
+ 145      E9FFFE
+ 146 05d5 F5E9FFFE 		.ascii	"\365\351\377\376\365\351\377\376\365\351\377\376\365\351\377"
+ 146      F5E9FFFE 
+ 146      F5E9FFFE 
+ 146      F5E9FF
+ 147 05e4 FEF6E9FF 		.ascii	"\376\366\351\377\376\366\351\377\376\366\351\377\376\366\351"
+ 147      FEF6E9FF 
+ 147      FEF6E9FF 
+ 147      FEF6E9
+ 148 05f3 FFFEF6E9 		.ascii	"\377\376\366\351\377\376\366\351\377\376\366\351\377\376\366"
+ 148      FFFEF6E9 
+ 148      FFFEF6E9 
+ 148      FFFEF6
+ 149 0602 E9FFFEF6 		.ascii	"\351\377\376\366\351\377\376\366\351\377\376\366\351\377\376"
+ 149      E9FFFEF6 
+ 149      E9FFFEF6 
+ 149      E9FFFE
+ 150 0611 F6E9FFFE 		.ascii	"\366\351\377\376\366\352\377\376\366\352\377\376\366\352\377"
+ 150      F6EAFFFE 
+ 150      F6EAFFFE 
+ 150      F6EAFF
+ 151 0620 FEF6EAFF 		.ascii	"\376\366\352\377\376\366\352\377\376\366\352\377\376\366\352"
+ 151      FEF6EAFF 
+ 151      FEF6EAFF 
+GAS LISTING /tmp/ccL1hvVp.s 			page 9
+
+
+ 151      FEF6EA
+ 152 062f FFFEF6EA 		.ascii	"\377\376\366\352\377\376\366\352\377\376\366\352\377\376\366"
+ 152      FFFEF6EA 
+ 152      FFFEF6EA 
+ 152      FFFEF6
+ 153 063e EAFFFEF6 		.ascii	"\352\377\376\366\352\377\376\366\352\377\376\366\352\377\376"
+ 153      EAFFFEF6 
+ 153      EAFFFEF6 
+ 153      EAFFFE
+ 154 064d F6EAFFFE 		.ascii	"\366\352\377\376\366\352\377\376\366\352\377\376\366\352\377"
+ 154      F6EAFFFE 
+ 154      F6EAFFFE 
+ 154      F6EAFF
+ 155 065c FEF6EAFF 		.ascii	"\376\366\352\377\376\366\352\377\376\366\352\377\376\366\352"
+ 155      FEF6EAFF 
+ 155      FEF6EAFF 
+ 155      FEF6EA
+ 156 066b FFFEF6EA 		.ascii	"\377\376\366\352\377\376\366\352\377\376\366\352\377\376\366"
+ 156      FFFEF6EA 
+ 156      FFFEF6EA 
+ 156      FFFEF6
+ 157 067a EAFFFEF6 		.ascii	"\352\377\376\366\352\377\376\366\352\377\376\366\352\377\376"
+ 157      EAFFFEF6 
+ 157      EAFFFEF6 
+ 157      EAFFFE
+ 158 0689 F6EAFFFE 		.ascii	"\366\352\377\376\366\352\377\376\366\352\377\376\366\352\377"
+ 158      F6EAFFFE 
+ 158      F6EAFFFE 
+ 158      F6EAFF
+ 159 0698 FEF6EAFF 		.ascii	"\376\366\352\377\376\366\352\377\376\366\352\377\376\366\352"
+ 159      FEF6EAFF 
+ 159      FEF6EAFF 
+ 159      FEF6EA
+ 160 06a7 FFFEF6EA 		.ascii	"\377\376\366\352\377\376\366\352\377\376\366\352\377\376\366"
+ 160      FFFEF6EA 
+ 160      FFFEF6EA 
+ 160      FFFEF6
+ 161 06b6 EAFFFEF6 		.ascii	"\352\377\376\366\352\377\376\366\352\377\376\366\353\377\376"
+ 161      EAFFFEF6 
+ 161      EAFFFEF6 
+ 161      EBFFFE
+ 162 06c5 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 162      F6EBFFFE 
+ 162      F6EBFFFE 
+ 162      F6EBFF
+ 163 06d4 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 163      FEF6EBFF 
+ 163      FEF6EBFF 
+ 163      FEF6EB
+ 164 06e3 FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 164      FFFEF6EB 
+ 164      FFFEF6EB 
+ 164      FFFEF6
+ 165 06f2 EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 165      EBFFFEF6 
+ 165      EBFFFEF6 
+ 165      EBFFFE
+GAS LISTING /tmp/ccL1hvVp.s 			page 10
+
+
+ 166 0701 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 166      F6EBFFFE 
+ 166      F6EBFFFE 
+ 166      F6EBFF
+ 167 0710 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 167      FEF6EBFF 
+ 167      FEF6EBFF 
+ 167      FEF6EB
+ 168 071f FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 168      FFFEF6EB 
+ 168      FFFEF6EB 
+ 168      FFFEF6
+ 169 072e EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 169      EBFFFEF6 
+ 169      EBFFFEF6 
+ 169      EBFFFE
+ 170 073d F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 170      F6EBFFFE 
+ 170      F6EBFFFE 
+ 170      F6EBFF
+ 171 074c FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 171      FEF6EBFF 
+ 171      FEF6EBFF 
+ 171      FEF6EB
+ 172 075b FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 172      FFFEF6EB 
+ 172      FFFEF6EB 
+ 172      FFFEF6
+ 173 076a EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 173      EBFFFEF6 
+ 173      EBFFFEF6 
+ 173      EBFFFE
+ 174 0779 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 174      F6EBFFFE 
+ 174      F6EBFFFE 
+ 174      F6EBFF
+ 175 0788 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 175      FEF6EBFF 
+ 175      FEF6EBFF 
+ 175      FEF6EB
+ 176 0797 FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 176      FFFEF6EB 
+ 176      FFFEF6EB 
+ 176      FFFEF6
+ 177 07a6 EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 177      EBFFFEF6 
+ 177      EBFFFEF6 
+ 177      EBFFFE
+ 178 07b5 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 178      F6EBFFFE 
+ 178      F6EBFFFE 
+ 178      F6EBFF
+ 179 07c4 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377"
+ 179      FEF6EBFF 
+ 179      FEF6EBFF 
+ 180 07d0 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 180      FEF6EBFF 
+GAS LISTING /tmp/ccL1hvVp.s 			page 11
+
+
+ 180      FEF6EBFF 
+ 180      FEF6EB
+ 181 07df FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 181      FFFEF6EB 
+ 181      FFFEF6EB 
+ 181      FFFEF6
+ 182 07ee EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 182      EBFFFEF6 
+ 182      EBFFFEF6 
+ 182      EBFFFE
+ 183 07fd F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 183      F6EBFFFE 
+ 183      F6EBFFFE 
+ 183      F6EBFF
+ 184 080c FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 184      FEF6EBFF 
+ 184      FEF6EBFF 
+ 184      FEF6EB
+ 185 081b FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 185      FFFEF6EB 
+ 185      FFFEF6EB 
+ 185      FFFEF6
+ 186 082a EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 186      EBFFFEF6 
+ 186      EBFFFEF6 
+ 186      EBFFFE
+ 187 0839 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 187      F6EBFFFE 
+ 187      F6EBFFFE 
+ 187      F6EBFF
+ 188 0848 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 188      FEF6EBFF 
+ 188      FEF6EBFF 
+ 188      FEF6EB
+ 189 0857 FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 189      FFFEF6EB 
+ 189      FFFEF6EB 
+ 189      FFFEF6
+ 190 0866 EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 190      EBFFFEF6 
+ 190      EBFFFEF6 
+ 190      EBFFFE
+ 191 0875 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 191      F6EBFFFE 
+ 191      F6EBFFFE 
+ 191      F6EBFF
+ 192 0884 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 192      FEF6EBFF 
+ 192      FEF6EBFF 
+ 192      FEF6EB
+ 193 0893 FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 193      FFFEF6EB 
+ 193      FFFEF6EB 
+ 193      FFFEF6
+ 194 08a2 EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 194      EBFFFEF6 
+ 194      EBFFFEF6 
+GAS LISTING /tmp/ccL1hvVp.s 			page 12
+
+
+ 194      EBFFFE
+ 195 08b1 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 195      F6EBFFFE 
+ 195      F6EBFFFE 
+ 195      F6EBFF
+ 196 08c0 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 196      FEF6EBFF 
+ 196      FEF6EBFF 
+ 196      FEF6EB
+ 197 08cf FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 197      FFFEF6EB 
+ 197      FFFEF6EB 
+ 197      FFFEF6
+ 198 08de EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 198      EBFFFEF6 
+ 198      EBFFFEF6 
+ 198      EBFFFE
+ 199 08ed F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 199      F6EBFFFE 
+ 199      F6EBFFFE 
+ 199      F6EBFF
+ 200 08fc FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 200      FEF6EBFF 
+ 200      FEF6EBFF 
+ 200      FEF6EB
+ 201 090b FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 201      FFFEF6EB 
+ 201      FFFEF6EB 
+ 201      FFFEF6
+ 202 091a EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 202      EBFFFEF6 
+ 202      EBFFFEF6 
+ 202      EBFFFE
+ 203 0929 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 203      F6EBFFFE 
+ 203      F6EBFFFE 
+ 203      F6EBFF
+ 204 0938 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 204      FEF6EBFF 
+ 204      FEF6EBFF 
+ 204      FEF6EB
+ 205 0947 FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 205      FFFEF6EB 
+ 205      FFFEF6EB 
+ 205      FFFEF6
+ 206 0956 EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 206      EBFFFEF6 
+ 206      EBFFFEF6 
+ 206      EBFFFE
+ 207 0965 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 207      F6EBFFFE 
+ 207      F6EBFFFE 
+ 207      F6EBFF
+ 208 0974 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 208      FEF6EBFF 
+ 208      FEF6EBFF 
+ 208      FEF6EB
+GAS LISTING /tmp/ccL1hvVp.s 			page 13
+
+
+ 209 0983 FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 209      FFFEF6EB 
+ 209      FFFEF6EB 
+ 209      FFFEF6
+ 210 0992 EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 210      EBFFFEF6 
+ 210      EBFFFEF6 
+ 210      EBFFFE
+ 211 09a1 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 211      F6EBFFFE 
+ 211      F6EBFFFE 
+ 211      F6EBFF
+ 212 09b0 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 212      FEF6EBFF 
+ 212      FEF6EBFF 
+ 212      FEF6EB
+ 213 09bf FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 213      FFFEF6EB 
+ 213      FFFEF6EB 
+ 213      FFFEF6
+ 214 09ce EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 214      EBFFFEF6 
+ 214      EBFFFEF6 
+ 214      EBFFFE
+ 215 09dd F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 215      F6EBFFFE 
+ 215      F6EBFFFE 
+ 215      F6EBFF
+ 216 09ec FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 216      FEF6EBFF 
+ 216      FEF6EBFF 
+ 216      FEF6EB
+ 217 09fb FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 217      FFFEF6EB 
+ 217      FFFEF6EB 
+ 217      FFFEF6
+ 218 0a0a EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 218      EBFFFEF6 
+ 218      EBFFFEF6 
+ 218      EBFFFE
+ 219 0a19 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 219      F6EBFFFE 
+ 219      F6EBFFFE 
+ 219      F6EBFF
+ 220 0a28 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 220      FEF6EBFF 
+ 220      FEF6EBFF 
+ 220      FEF6EB
+ 221 0a37 FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 221      FFFEF6EB 
+ 221      FFFEF6EB 
+ 221      FFFEF6
+ 222 0a46 EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 222      EBFFFEF6 
+ 222      EBFFFEF6 
+ 222      EBFFFE
+ 223 0a55 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+GAS LISTING /tmp/ccL1hvVp.s 			page 14
+
+
+ 223      F6EBFFFE 
+ 223      F6EBFFFE 
+ 223      F6EBFF
+ 224 0a64 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 224      FEF6EBFF 
+ 224      FEF6EBFF 
+ 224      FEF6EB
+ 225 0a73 FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 225      FFFEF6EB 
+ 225      FFFEF6EB 
+ 225      FFFEF6
+ 226 0a82 EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 226      EBFFFEF6 
+ 226      EBFFFEF6 
+ 226      EBFFFE
+ 227 0a91 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 227      F6EBFFFE 
+ 227      F6EBFFFE 
+ 227      F6EBFF
+ 228 0aa0 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 228      FEF6EBFF 
+ 228      FEF6EBFF 
+ 228      FEF6EB
+ 229 0aaf FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 229      FFFEF6EB 
+ 229      FFFEF6EB 
+ 229      FFFEF6
+ 230 0abe EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 230      EBFFFEF6 
+ 230      EBFFFEF6 
+ 230      EBFFFE
+ 231 0acd F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 231      F6EBFFFE 
+ 231      F6EBFFFE 
+ 231      F6EBFF
+ 232 0adc FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 232      FEF6EBFF 
+ 232      FEF6EBFF 
+ 232      FEF6EB
+ 233 0aeb FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 233      FFFEF6EB 
+ 233      FFFEF6EB 
+ 233      FFFEF6
+ 234 0afa EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 234      EBFFFEF6 
+ 234      EBFFFEF6 
+ 234      EBFFFE
+ 235 0b09 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 235      F6EBFFFE 
+ 235      F6EBFFFE 
+ 235      F6EBFF
+ 236 0b18 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 236      FEF6EBFF 
+ 236      FEF6EBFF 
+ 236      FEF6EB
+ 237 0b27 FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 237      FFFEF6EB 
+GAS LISTING /tmp/ccL1hvVp.s 			page 15
+
+
+ 237      FFFEF6EB 
+ 237      FFFEF6
+ 238 0b36 EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 238      EBFFFEF6 
+ 238      EBFFFEF6 
+ 238      EBFFFE
+ 239 0b45 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 239      F6EBFFFE 
+ 239      F6EBFFFE 
+ 239      F6EBFF
+ 240 0b54 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 240      FEF6EBFF 
+ 240      FEF6EBFF 
+ 240      FEF6EB
+ 241 0b63 FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 241      FFFEF6EB 
+ 241      FFFEF6EB 
+ 241      FFFEF6
+ 242 0b72 EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 242      EBFFFEF6 
+ 242      EBFFFEF6 
+ 242      EBFFFE
+ 243 0b81 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 243      F6EBFFFE 
+ 243      F6EBFFFE 
+ 243      F6EBFF
+ 244 0b90 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 244      FEF6EBFF 
+ 244      FEF6EBFF 
+ 244      FEF6EB
+ 245 0b9f FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 245      FFFEF6EB 
+ 245      FFFEF6EB 
+ 245      FFFEF6
+ 246 0bae EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 246      EBFFFEF6 
+ 246      EBFFFEF6 
+ 246      EBFFFE
+ 247 0bbd F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 247      F6EBFFFE 
+ 247      F6EBFFFE 
+ 247      F6EBFF
+ 248 0bcc FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 248      FEF6EBFF 
+ 248      FEF6EBFF 
+ 248      FEF6EB
+ 249 0bdb FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 249      FFFEF6EB 
+ 249      FFFEF6EB 
+ 249      FFFEF6
+ 250 0bea EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 250      EBFFFEF6 
+ 250      EBFFFEF6 
+ 250      EBFFFE
+ 251 0bf9 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 251      F6EBFFFE 
+ 251      F6EBFFFE 
+GAS LISTING /tmp/ccL1hvVp.s 			page 16
+
+
+ 251      F6EBFF
+ 252 0c08 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 252      FEF6EBFF 
+ 252      FEF6EBFF 
+ 252      FEF6EB
+ 253 0c17 FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 253      FFFEF6EB 
+ 253      FFFEF6EB 
+ 253      FFFEF6
+ 254 0c26 EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 254      EBFFFEF6 
+ 254      EBFFFEF6 
+ 254      EBFFFE
+ 255 0c35 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 255      F6EBFFFE 
+ 255      F6EBFFFE 
+ 255      F6EBFF
+ 256 0c44 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 256      FEF6EBFF 
+ 256      FEF6EBFF 
+ 256      FEF6EB
+ 257 0c53 FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 257      FFFEF6EB 
+ 257      FFFEF6EB 
+ 257      FFFEF6
+ 258 0c62 EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 258      EBFFFEF6 
+ 258      EBFFFEF6 
+ 258      EBFFFE
+ 259 0c71 F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\366\353\377\376\366\353\377"
+ 259      F6EBFFFE 
+ 259      F6EBFFFE 
+ 259      F6EBFF
+ 260 0c80 FEF6EBFF 		.ascii	"\376\366\353\377\376\366\353\377\376\366\353\377\376\366\353"
+ 260      FEF6EBFF 
+ 260      FEF6EBFF 
+ 260      FEF6EB
+ 261 0c8f FFFEF6EB 		.ascii	"\377\376\366\353\377\376\366\353\377\376\366\353\377\376\366"
+ 261      FFFEF6EB 
+ 261      FFFEF6EB 
+ 261      FFFEF6
+ 262 0c9e EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377\376\366\353\377\376"
+ 262      EBFFFEF6 
+ 262      EBFFFEF6 
+ 262      EBFFFE
+ 263 0cad F6EBFFFE 		.ascii	"\366\353\377\376\366\353\377\376\367\353\377\376\367\353\377"
+ 263      F6EBFFFE 
+ 263      F7EBFFFE 
+ 263      F7EBFF
+ 264 0cbc FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 264      FEF7EBFF 
+ 264      FEF7EBFF 
+ 264      FEF7EB
+ 265 0ccb FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 265      FFFEF7EB 
+ 265      FFFEF7EB 
+ 265      FFFEF7
+GAS LISTING /tmp/ccL1hvVp.s 			page 17
+
+
+ 266 0cda EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 266      EBFFFEF7 
+ 266      EBFFFEF7 
+ 266      EBFFFE
+ 267 0ce9 F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 267      F7EBFFFE 
+ 267      F7EBFFFE 
+ 267      F7EBFF
+ 268 0cf8 FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 268      FEF7EBFF 
+ 268      FEF7EBFF 
+ 268      FEF7EB
+ 269 0d07 FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 269      FFFEF7EB 
+ 269      FFFEF7EB 
+ 269      FFFEF7
+ 270 0d16 EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 270      EBFFFEF7 
+ 270      EBFFFEF7 
+ 270      EBFFFE
+ 271 0d25 F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 271      F7EBFFFE 
+ 271      F7EBFFFE 
+ 271      F7EBFF
+ 272 0d34 FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 272      FEF7EBFF 
+ 272      FEF7EBFF 
+ 272      FEF7EB
+ 273 0d43 FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 273      FFFEF7EB 
+ 273      FFFEF7EB 
+ 273      FFFEF7
+ 274 0d52 EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 274      EBFFFEF7 
+ 274      EBFFFEF7 
+ 274      EBFFFE
+ 275 0d61 F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 275      F7EBFFFE 
+ 275      F7EBFFFE 
+ 275      F7EBFF
+ 276 0d70 FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 276      FEF7EBFF 
+ 276      FEF7EBFF 
+ 276      FEF7EB
+ 277 0d7f FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 277      FFFEF7EB 
+ 277      FFFEF7EB 
+ 277      FFFEF7
+ 278 0d8e EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 278      EBFFFEF7 
+ 278      EBFFFEF7 
+ 278      EBFFFE
+ 279 0d9d F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 279      F7EBFFFE 
+ 279      F7EBFFFE 
+ 279      F7EBFF
+ 280 0dac FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+GAS LISTING /tmp/ccL1hvVp.s 			page 18
+
+
+ 280      FEF7EBFF 
+ 280      FEF7EBFF 
+ 280      FEF7EB
+ 281 0dbb FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 281      FFFEF7EB 
+ 281      FFFEF7EB 
+ 281      FFFEF7
+ 282 0dca EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 282      EBFFFEF7 
+ 282      EBFFFEF7 
+ 282      EBFFFE
+ 283 0dd9 F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 283      F7EBFFFE 
+ 283      F7EBFFFE 
+ 283      F7EBFF
+ 284 0de8 FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 284      FEF7EBFF 
+ 284      FEF7EBFF 
+ 284      FEF7EB
+ 285 0df7 FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 285      FFFEF7EB 
+ 285      FFFEF7EB 
+ 285      FFFEF7
+ 286 0e06 EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 286      EBFFFEF7 
+ 286      EBFFFEF7 
+ 286      EBFFFE
+ 287 0e15 F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 287      F7EBFFFE 
+ 287      F7EBFFFE 
+ 287      F7EBFF
+ 288 0e24 FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 288      FEF7EBFF 
+ 288      FEF7EBFF 
+ 288      FEF7EB
+ 289 0e33 FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 289      FFFEF7EB 
+ 289      FFFEF7EB 
+ 289      FFFEF7
+ 290 0e42 EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 290      EBFFFEF7 
+ 290      EBFFFEF7 
+ 290      EBFFFE
+ 291 0e51 F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 291      F7EBFFFE 
+ 291      F7EBFFFE 
+ 291      F7EBFF
+ 292 0e60 FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 292      FEF7EBFF 
+ 292      FEF7EBFF 
+ 292      FEF7EB
+ 293 0e6f FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 293      FFFEF7EB 
+ 293      FFFEF7EB 
+ 293      FFFEF7
+ 294 0e7e EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 294      EBFFFEF7 
+GAS LISTING /tmp/ccL1hvVp.s 			page 19
+
+
+ 294      EBFFFEF7 
+ 294      EBFFFE
+ 295 0e8d F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 295      F7EBFFFE 
+ 295      F7EBFFFE 
+ 295      F7EBFF
+ 296 0e9c FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 296      FEF7EBFF 
+ 296      FEF7EBFF 
+ 296      FEF7EB
+ 297 0eab FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 297      FFFEF7EB 
+ 297      FFFEF7EB 
+ 297      FFFEF7
+ 298 0eba EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 298      EBFFFEF7 
+ 298      EBFFFEF7 
+ 298      EBFFFE
+ 299 0ec9 F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 299      F7EBFFFE 
+ 299      F7EBFFFE 
+ 299      F7EBFF
+ 300 0ed8 FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 300      FEF7EBFF 
+ 300      FEF7EBFF 
+ 300      FEF7EB
+ 301 0ee7 FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 301      FFFEF7EB 
+ 301      FFFEF7EB 
+ 301      FFFEF7
+ 302 0ef6 EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 302      EBFFFEF7 
+ 302      EBFFFEF7 
+ 302      EBFFFE
+ 303 0f05 F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 303      F7EBFFFE 
+ 303      F7EBFFFE 
+ 303      F7EBFF
+ 304 0f14 FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 304      FEF7EBFF 
+ 304      FEF7EBFF 
+ 304      FEF7EB
+ 305 0f23 FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 305      FFFEF7EB 
+ 305      FFFEF7EB 
+ 305      FFFEF7
+ 306 0f32 EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 306      EBFFFEF7 
+ 306      EBFFFEF7 
+ 306      EBFFFE
+ 307 0f41 F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 307      F7EBFFFE 
+ 307      F7EBFFFE 
+ 307      F7EBFF
+ 308 0f50 FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 308      FEF7EBFF 
+ 308      FEF7EBFF 
+GAS LISTING /tmp/ccL1hvVp.s 			page 20
+
+
+ 308      FEF7EB
+ 309 0f5f FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 309      FFFEF7EB 
+ 309      FFFEF7EB 
+ 309      FFFEF7
+ 310 0f6e EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 310      EBFFFEF7 
+ 310      EBFFFEF7 
+ 310      EBFFFE
+ 311 0f7d F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 311      F7EBFFFE 
+ 311      F7EBFFFE 
+ 311      F7EBFF
+ 312 0f8c FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 312      FEF7EBFF 
+ 312      FEF7EBFF 
+ 312      FEF7EB
+ 313 0f9b FFFEF7EB 		.ascii	"\377\376\367\353\377"
+ 313      FF
+ 314 0fa0 FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 314      FEF7EBFF 
+ 314      FEF7EBFF 
+ 314      FEF7EB
+ 315 0faf FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 315      FFFEF7EB 
+ 315      FFFEF7EB 
+ 315      FFFEF7
+ 316 0fbe EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377\376\367\353\377\376"
+ 316      EBFFFEF7 
+ 316      EBFFFEF7 
+ 316      EBFFFE
+ 317 0fcd F7EBFFFE 		.ascii	"\367\353\377\376\367\353\377\376\367\353\377\376\367\353\377"
+ 317      F7EBFFFE 
+ 317      F7EBFFFE 
+ 317      F7EBFF
+ 318 0fdc FEF7EBFF 		.ascii	"\376\367\353\377\376\367\353\377\376\367\353\377\376\367\353"
+ 318      FEF7EBFF 
+ 318      FEF7EBFF 
+ 318      FEF7EB
+ 319 0feb FFFEF7EB 		.ascii	"\377\376\367\353\377\376\367\353\377\376\367\353\377\376\367"
+ 319      FFFEF7EB 
+ 319      FFFEF7EB 
+ 319      FFFEF7
+ 320 0ffa EBFFFEF7 		.ascii	"\353\377\376\367\353\377\376\367\353\377"
+ 320      EBFFFEF7 
+ 320      EBFF
+ 321              		.globl	heatmap_cs_OrRd_mixed
+ 322              		.section	.data.rel.local
+ 323              		.align 8
+ 324              		.type	heatmap_cs_OrRd_mixed, @object
+ 325              		.size	heatmap_cs_OrRd_mixed, 8
+ 326              	heatmap_cs_OrRd_mixed:
+ 327 0008 00000000 		.quad	mixed
+ 327      00000000 
+ 328              		.section	.data.rel.ro.local
+ 329              		.align 16
+ 330              		.type	mixed, @object
+GAS LISTING /tmp/ccL1hvVp.s 			page 21
+
+
+ 331              		.size	mixed, 16
+ 332              	mixed:
+ 333 0010 00000000 		.quad	mixed_data
+ 333      00000000 
+ 334 0018 01040000 		.quad	1025
+ 334      00000000 
+ 335              		.section	.rodata
+ 336 1004 00000000 		.align 32
+ 336      00000000 
+ 336      00000000 
+ 336      00000000 
+ 336      00000000 
+ 337              		.type	mixed_data, @object
+ 338              		.size	mixed_data, 4100
+ 339              	mixed_data:
+ 340 1020 00       		.string	""
+ 341 1021 00       		.string	""
+ 342 1022 00       		.string	""
+ 343 1023 00       		.string	""
+ 344 1024 7E00     		.string	"~"
+ 345 1026 00       		.string	""
+ 346 1027 00       		.string	""
+ 347 1028 7F00     		.string	"\177"
+ 348 102a 00       		.string	""
+ 349 102b 077F00   		.string	"\007\177"
+ 350 102e 00       		.string	""
+ 351 102f 0E7F00   		.string	"\016\177"
+ 352 1032 00       		.string	""
+ 353 1033 168000   		.string	"\026\200"
+ 354 1036 00       		.string	""
+ 355 1037 1D8000   		.string	"\035\200"
+ 356 103a 00       		.string	""
+ 357 103b 258000   		.string	"%\200"
+ 358 103e 00       		.string	""
+ 359 103f 2C8100   		.string	",\201"
+ 360 1042 00       		.string	""
+ 361 1043 348100   		.string	"4\201"
+ 362 1046 00       		.string	""
+ 363 1047 3B8100   		.string	";\201"
+ 364 104a 00       		.string	""
+ 365 104b 438200   		.string	"C\202"
+ 366 104e 00       		.string	""
+ 367 104f 4A8200   		.string	"J\202"
+ 368 1052 00       		.string	""
+ 369 1053 528200   		.string	"R\202"
+ 370 1056 00       		.string	""
+ 371 1057 598300   		.string	"Y\203"
+ 372 105a 00       		.string	""
+ 373 105b 618300   		.string	"a\203"
+ 374 105e 00       		.string	""
+ 375 105f 688300   		.string	"h\203"
+ 376 1062 00       		.string	""
+ 377 1063 708400   		.string	"p\204"
+ 378 1066 00       		.string	""
+ 379 1067 778400   		.string	"w\204"
+ 380 106a 00       		.string	""
+ 381 106b 7F8400   		.string	"\177\204"
+GAS LISTING /tmp/ccL1hvVp.s 			page 22
+
+
+ 382 106e 00       		.string	""
+ 383 106f 868500   		.string	"\206\205"
+ 384 1072 00       		.string	""
+ 385 1073 8D8500   		.string	"\215\205"
+ 386 1076 00       		.string	""
+ 387 1077 958500   		.string	"\225\205"
+ 388 107a 00       		.string	""
+ 389 107b 9C8500   		.string	"\234\205"
+ 390 107e 00       		.string	""
+ 391 107f A48600   		.string	"\244\206"
+ 392 1082 00       		.string	""
+ 393 1083 AB8600   		.string	"\253\206"
+ 394 1086 00       		.string	""
+ 395 1087 B38600   		.string	"\263\206"
+ 396 108a 00       		.string	""
+ 397 108b BA8700   		.string	"\272\207"
+ 398 108e 00       		.string	""
+ 399 108f C28700   		.string	"\302\207"
+ 400 1092 00       		.string	""
+ 401 1093 C98700   		.string	"\311\207"
+ 402 1096 00       		.string	""
+ 403 1097 D18800   		.string	"\321\210"
+ 404 109a 00       		.string	""
+ 405 109b D88800   		.string	"\330\210"
+ 406 109e 00       		.string	""
+ 407 109f E08800   		.string	"\340\210"
+ 408 10a2 00       		.string	""
+ 409 10a3 E78900   		.string	"\347\211"
+ 410 10a6 00       		.string	""
+ 411 10a7 EF8900   		.string	"\357\211"
+ 412 10aa 00       		.string	""
+ 413 10ab F68900   		.string	"\366\211"
+ 414 10ae 00       		.string	""
+ 415 10af FE8A00   		.string	"\376\212"
+ 416 10b2 00       		.string	""
+ 417 10b3 FF8A00   		.string	"\377\212"
+ 418 10b6 00       		.string	""
+ 419 10b7 FF8A00   		.string	"\377\212"
+ 420 10ba 00       		.string	""
+ 421 10bb FF8B00   		.string	"\377\213"
+ 422 10be 00       		.string	""
+ 423 10bf FF8B00   		.string	"\377\213"
+ 424 10c2 00       		.string	""
+ 425 10c3 FF8B00   		.string	"\377\213"
+ 426 10c6 00       		.string	""
+ 427 10c7 FF8C00   		.string	"\377\214"
+ 428 10ca 00       		.string	""
+ 429 10cb FF8C00   		.string	"\377\214"
+ 430 10ce 00       		.string	""
+ 431 10cf FF8C00   		.string	"\377\214"
+ 432 10d2 00       		.string	""
+ 433 10d3 FF8D00   		.string	"\377\215"
+ 434 10d6 00       		.string	""
+ 435 10d7 FF8D00   		.string	"\377\215"
+ 436 10da 00       		.string	""
+ 437 10db FF8D00   		.string	"\377\215"
+ 438 10de 00       		.string	""
+GAS LISTING /tmp/ccL1hvVp.s 			page 23
+
+
+ 439 10df FF8E00   		.string	"\377\216"
+ 440 10e2 00       		.string	""
+ 441 10e3 FF8E00   		.string	"\377\216"
+ 442 10e6 00       		.string	""
+ 443 10e7 FF8E00   		.string	"\377\216"
+ 444 10ea 00       		.string	""
+ 445 10eb FF8E00   		.string	"\377\216"
+ 446 10ee 00       		.string	""
+ 447 10ef FF8F00   		.string	"\377\217"
+ 448 10f2 00       		.string	""
+ 449 10f3 FF8F00   		.string	"\377\217"
+ 450 10f6 00       		.string	""
+ 451 10f7 FF8F00   		.string	"\377\217"
+ 452 10fa 00       		.string	""
+ 453 10fb FF9000   		.string	"\377\220"
+ 454 10fe 00       		.string	""
+ 455 10ff FF9000   		.string	"\377\220"
+ 456 1102 00       		.string	""
+ 457 1103 FF9000   		.string	"\377\220"
+ 458 1106 00       		.string	""
+ 459 1107 FF9100   		.string	"\377\221"
+ 460 110a 01FF9100 		.string	"\001\377\221"
+ 461 110e 01FF9100 		.string	"\001\377\221"
+ 462 1112 01FF9200 		.string	"\001\377\222"
+ 463 1116 01FF9200 		.string	"\001\377\222"
+ 464 111a 01FF9200 		.string	"\001\377\222"
+ 465 111e 01FF9300 		.string	"\001\377\223"
+ 466 1122 01FF9D00 		.string	"\001\377\235"
+ 467 1126 01FF9E00 		.string	"\001\377\236"
+ 468 112a 01FF9E00 		.string	"\001\377\236"
+ 469 112e 01FF9E00 		.string	"\001\377\236"
+ 470 1132 01FF9F00 		.string	"\001\377\237"
+ 471 1136 01FF9F00 		.string	"\001\377\237"
+ 472 113a 01FF9F00 		.string	"\001\377\237"
+ 473 113e 01FFA000 		.string	"\001\377\240"
+ 474 1142 01FFA000 		.string	"\001\377\240"
+ 475 1146 01FFA000 		.string	"\001\377\240"
+ 476 114a 01FFA100 		.string	"\001\377\241"
+ 477 114e 01FFA100 		.string	"\001\377\241"
+ 478 1152 00       		.string	""
+ 479 1153 FFA100   		.string	"\377\241"
+ 480 1156 00       		.string	""
+ 481 1157 FFA200   		.string	"\377\242"
+ 482 115a 00       		.string	""
+ 483 115b FFA200   		.string	"\377\242"
+ 484 115e 00       		.string	""
+ 485 115f FFA200   		.string	"\377\242"
+ 486 1162 00       		.string	""
+ 487 1163 FFA300   		.string	"\377\243"
+ 488 1166 00       		.string	""
+ 489 1167 FFA300   		.string	"\377\243"
+ 490 116a 00       		.string	""
+ 491 116b FFA300   		.string	"\377\243"
+ 492 116e 00       		.string	""
+ 493 116f FFA400   		.string	"\377\244"
+ 494 1172 00       		.string	""
+ 495 1173 FFA400   		.string	"\377\244"
+GAS LISTING /tmp/ccL1hvVp.s 			page 24
+
+
+ 496 1176 00       		.string	""
+ 497 1177 FFA400   		.string	"\377\244"
+ 498 117a 00       		.string	""
+ 499 117b FFA500   		.string	"\377\245"
+ 500 117e 00       		.string	""
+ 501 117f FFA500   		.string	"\377\245"
+ 502 1182 00       		.string	""
+ 503 1183 FFA500   		.string	"\377\245"
+ 504 1186 00       		.string	""
+ 505 1187 FFA600   		.string	"\377\246"
+ 506 118a 00       		.string	""
+ 507 118b FFA600   		.string	"\377\246"
+ 508 118e 00       		.string	""
+ 509 118f FFA600   		.string	"\377\246"
+ 510 1192 00       		.string	""
+ 511 1193 FFA700   		.string	"\377\247"
+ 512 1196 00       		.string	""
+ 513 1197 FFA700   		.string	"\377\247"
+ 514 119a 00       		.string	""
+ 515 119b FFA700   		.string	"\377\247"
+ 516 119e 00       		.string	""
+ 517 119f FFA800   		.string	"\377\250"
+ 518 11a2 00       		.string	""
+ 519 11a3 FFA800   		.string	"\377\250"
+ 520 11a6 00       		.string	""
+ 521 11a7 FFA800   		.string	"\377\250"
+ 522 11aa 00       		.string	""
+ 523 11ab FFA900   		.string	"\377\251"
+ 524 11ae 00       		.string	""
+ 525 11af FFA900   		.string	"\377\251"
+ 526 11b2 00       		.string	""
+ 527 11b3 FFA900   		.string	"\377\251"
+ 528 11b6 00       		.string	""
+ 529 11b7 FFAA00   		.string	"\377\252"
+ 530 11ba 00       		.string	""
+ 531 11bb FFAA00   		.string	"\377\252"
+ 532 11be 00       		.string	""
+ 533 11bf FFAA00   		.string	"\377\252"
+ 534 11c2 00       		.string	""
+ 535 11c3 FFAB00   		.string	"\377\253"
+ 536 11c6 00       		.string	""
+ 537 11c7 FFAB00   		.string	"\377\253"
+ 538 11ca 00       		.string	""
+ 539 11cb FFAB00   		.string	"\377\253"
+ 540 11ce 00       		.string	""
+ 541 11cf FFAC00   		.string	"\377\254"
+ 542 11d2 00       		.string	""
+ 543 11d3 FFAC00   		.string	"\377\254"
+ 544 11d6 00       		.string	""
+ 545 11d7 FFAC00   		.string	"\377\254"
+ 546 11da 00       		.string	""
+ 547 11db FFAD00   		.string	"\377\255"
+ 548 11de 00       		.string	""
+ 549 11df FFAD00   		.string	"\377\255"
+ 550 11e2 00       		.string	""
+ 551 11e3 FFAD00   		.string	"\377\255"
+ 552 11e6 00       		.string	""
+GAS LISTING /tmp/ccL1hvVp.s 			page 25
+
+
+ 553 11e7 FFAE00   		.string	"\377\256"
+ 554 11ea 00       		.string	""
+ 555 11eb FFAE00   		.string	"\377\256"
+ 556 11ee 00       		.string	""
+ 557 11ef FFAE00   		.string	"\377\256"
+ 558 11f2 00       		.string	""
+ 559 11f3 FFAF00   		.string	"\377\257"
+ 560 11f6 00       		.string	""
+ 561 11f7 FFAF00   		.string	"\377\257"
+ 562 11fa 00       		.string	""
+ 563 11fb FFAF00   		.string	"\377\257"
+ 564 11fe 00       		.string	""
+ 565 11ff FFB000   		.string	"\377\260"
+ 566 1202 00       		.string	""
+ 567 1203 FFB000   		.string	"\377\260"
+ 568 1206 00       		.string	""
+ 569 1207 FFB000   		.string	"\377\260"
+ 570 120a 00       		.string	""
+ 571 120b FFB100   		.string	"\377\261"
+ 572 120e 00       		.string	""
+ 573 120f FFB100   		.string	"\377\261"
+ 574 1212 00       		.string	""
+ 575 1213 FFB100   		.string	"\377\261"
+ 576 1216 00       		.string	""
+ 577 1217 FFB200   		.string	"\377\262"
+ 578 121a 00       		.string	""
+ 579 121b FFB200   		.string	"\377\262"
+ 580 121e 00       		.string	""
+ 581 121f FFB200   		.string	"\377\262"
+ 582 1222 00       		.string	""
+ 583 1223 FFB200   		.string	"\377\262"
+ 584 1226 00       		.string	""
+ 585 1227 FFB300   		.string	"\377\263"
+ 586 122a 00       		.string	""
+ 587 122b FFB300   		.string	"\377\263"
+ 588 122e 00       		.string	""
+ 589 122f FFB30100 		.string	"\377\263\001"
+ 590 1233 FFB30100 		.string	"\377\263\001"
+ 591 1237 FFB40200 		.string	"\377\264\002"
+ 592 123b FFB40200 		.string	"\377\264\002"
+ 593 123f FFB40301 		.ascii	"\377\264\003\001\377\264\003\001\377\265\003\001\377\265\004"
+ 593      FFB40301 
+ 593      FFB50301 
+ 593      FFB504
+ 594 124e 01FFB504 		.ascii	"\001\377\265\004\001\377\265\005\001\377\265\005\002\377\266"
+ 594      01FFB505 
+ 594      01FFB505 
+ 594      02FFB6
+ 595 125d 0602FFB6 		.ascii	"\006\002\377\266\006\002\377\266\007\002\377\266\007\002\377"
+ 595      0602FFB6 
+ 595      0702FFB6 
+ 595      0702FF
+ 596 126c B70803FF 		.ascii	"\267\b\003\377\267\b\003\377\267\t\003\377\267\t\003\377\267"
+ 596      B70803FF 
+ 596      B70903FF 
+ 596      B70903FF 
+ 596      B7
+GAS LISTING /tmp/ccL1hvVp.s 			page 26
+
+
+ 597 127d 0903FFB8 		.ascii	"\t\003\377\270\n\003\377\270\n\004\377\270\013\004\377\270\013"
+ 597      0A03FFB8 
+ 597      0A04FFB8 
+ 597      0B04FFB8 
+ 597      0B
+ 598 128e 04FFB90C 		.ascii	"\004\377\271\f\004\377\271\f\004\377\271\f\005\377\271\r\005"
+ 598      04FFB90C 
+ 598      04FFB90C 
+ 598      05FFB90D 
+ 598      05
+ 599 129f FFB90D05 		.ascii	"\377\271\r\005\377\272\r\005\377\272\016\005\377\272\016\006"
+ 599      FFBA0D05 
+ 599      FFBA0E05 
+ 599      FFBA0E06 
+ 600 12af FFBA0E06 		.ascii	"\377\272\016\006\377\273\017\006\377\273\017\006\377\273\017"
+ 600      FFBB0F06 
+ 600      FFBB0F06 
+ 600      FFBB0F
+ 601 12be 07FFBB10 		.ascii	"\007\377\273\020\007\377\273\020\007\377\274\020\007\377\274"
+ 601      07FFBB10 
+ 601      07FFBC10 
+ 601      07FFBC
+ 602 12cd 1107FFBC 		.ascii	"\021\007\377\274\021\b\377\274\021\b\377\275\022\b\377\275\022"
+ 602      1108FFBC 
+ 602      1108FFBD 
+ 602      1208FFBD 
+ 602      12
+ 603 12de 08FFBD12 		.ascii	"\b\377\275\022\t\377\275\023\t\377\275\023\t\377\276\023\t\377"
+ 603      09FFBD13 
+ 603      09FFBD13 
+ 603      09FFBE13 
+ 603      09FF
+ 604 12f0 BE1309FF 		.ascii	"\276\023\t\377\276\024\n\377\276\024\n\377\277\024\n\377\277"
+ 604      BE140AFF 
+ 604      BE140AFF 
+ 604      BF140AFF 
+ 604      BF
+ 605 1301 150AFFBF 		.ascii	"\025\n\377\277\025\n\377\277\025\013\377\300\025\013\377\300"
+ 605      150AFFBF 
+ 605      150BFFC0 
+ 605      150BFFC0 
+ 606 1311 160BFFC0 		.ascii	"\026\013\377\300\026\013\377\300\026\f\377\300\026\f\377\301"
+ 606      160BFFC0 
+ 606      160CFFC0 
+ 606      160CFFC1 
+ 607 1321 170CFFC8 		.ascii	"\027\f\377\310!\022\377\310!\023\377\311!\023\377\311!\023\377"
+ 607      2112FFC8 
+ 607      2113FFC9 
+ 607      2113FFC9 
+ 607      2113FF
+ 608 1334 C92213FF 		.ascii	"\311\"\023\377\311\"\023\377\311\"\024\377\312\"\024\377\312"
+ 608      C92213FF 
+ 608      C92214FF 
+ 608      CA2214FF 
+ 608      CA
+ 609 1345 2314FFCA 		.ascii	"#\024\377\312#\024\377\312#\024\377\313#\025\377\313$\025\377"
+ 609      2314FFCA 
+GAS LISTING /tmp/ccL1hvVp.s 			page 27
+
+
+ 609      2314FFCB 
+ 609      2315FFCB 
+ 609      2415FF
+ 610 1358 CB2415FF 		.ascii	"\313$\025\377\313$\025\377\313$\025\377\314%\026\377\314%\026"
+ 610      CB2415FF 
+ 610      CB2415FF 
+ 610      CC2516FF 
+ 610      CC2516
+ 611 136b FFCC2516 		.ascii	"\377\314%\026\377\314%\026\377\315&\026\377\315&\026\377\315"
+ 611      FFCC2516 
+ 611      FFCD2616 
+ 611      FFCD2616 
+ 611      FFCD
+ 612 137d 2617FFCD 		.ascii	"&\027\377\315&\027\377\315'\027\377\316'\027\377\316'\027\377"
+ 612      2617FFCD 
+ 612      2717FFCE 
+ 612      2717FFCE 
+ 612      2717FF
+ 613 1390 CE2718FF 		.ascii	"\316'\030\377\316(\030\377\317(\030\377\317(\030\377\317(\030"
+ 613      CE2818FF 
+ 613      CF2818FF 
+ 613      CF2818FF 
+ 613      CF2818
+ 614 13a3 FFCF2819 		.ascii	"\377\317(\031\377\317)\031\377\320)\031\377\320)\031\377\320"
+ 614      FFCF2919 
+ 614      FFD02919 
+ 614      FFD02919 
+ 614      FFD0
+ 615 13b5 2919FFD0 		.ascii	")\031\377\320*\032\377\321*\032\377\321*\032\377\321*\032\377"
+ 615      2A1AFFD1 
+ 615      2A1AFFD1 
+ 615      2A1AFFD1 
+ 615      2A1AFF
+ 616 13c8 D12A1AFF 		.ascii	"\321*\032\377\322+\032\377\322+\033\377\322+\033\377\322+\033"
+ 616      D22B1AFF 
+ 616      D22B1BFF 
+ 616      D22B1BFF 
+ 616      D22B1B
+ 617 13db FFD22C1B 		.ascii	"\377\322,\033\377\323,\033\377\323,\034\377\323,\034\377\323"
+ 617      FFD32C1B 
+ 617      FFD32C1C 
+ 617      FFD32C1C 
+ 617      FFD3
+ 618 13ed 2C1CFFD4 		.ascii	",\034\377\324-\034\377\324-\034\377\324-\034\377\324-\035\377"
+ 618      2D1CFFD4 
+ 618      2D1CFFD4 
+ 618      2D1CFFD4 
+ 618      2D1DFF
+ 619 1400 D42E1DFF 		.ascii	"\324.\035\377\325.\035\377\325.\035\377\325.\035\377\325.\036"
+ 619      D52E1DFF 
+ 619      D52E1DFF 
+ 619      D52E1DFF 
+ 619      D52E1E
+ 620 1413 FFD62F1E 		.ascii	"\377\326/\036\377\326/\036\377\326/\036\377\326/\036\377\326"
+ 620      FFD62F1E 
+ 620      FFD62F1E 
+ 620      FFD62F1E 
+GAS LISTING /tmp/ccL1hvVp.s 			page 28
+
+
+ 620      FFD6
+ 621 1425 301EFFD7 		.ascii	"0\036\377\3270\037\377\3270\037\377\3271\037\377\3271 \377\327"
+ 621      301FFFD7 
+ 621      301FFFD7 
+ 621      311FFFD7 
+ 621      3120FFD7 
+ 622 1439 3220FFD7 		.ascii	"2 \377\3272 \377\3302 \377\3303!\377\3303!\377\3304!\377\330"
+ 622      3220FFD8 
+ 622      3220FFD8 
+ 622      3321FFD8 
+ 622      3321FFD8 
+ 623 1451 3421FFD8 		.ascii	"4!\377\3304\"\377\3315\"\377\3315\"\377\3316\"\377\3316#\377"
+ 623      3422FFD9 
+ 623      3522FFD9 
+ 623      3522FFD9 
+ 623      3622FFD9 
+ 624 1468 D93623FF 		.ascii	"\3316#\377\3317#\377\3317#\377\3327$\377\3328$\377\3328$\377"
+ 624      D93723FF 
+ 624      D93723FF 
+ 624      DA3724FF 
+ 624      DA3824FF 
+ 625 1480 DA3924FF 		.ascii	"\3329$\377\3329%\377\3329%\377\333:%\377\333:%\377\333:&\377"
+ 625      DA3925FF 
+ 625      DA3925FF 
+ 625      DB3A25FF 
+ 625      DB3A25FF 
+ 626 1498 DB3B26FF 		.ascii	"\333;&\377\333;&\377\333;&\377\333<'\377\334<'\377\334<'\377"
+ 626      DB3B26FF 
+ 626      DB3B26FF 
+ 626      DB3C27FF 
+ 626      DC3C27FF 
+ 627 14b0 DC3D27FF 		.ascii	"\334='\377\334=(\377\334>(\377\334>(\377\335>(\377\335?)\377"
+ 627      DC3D28FF 
+ 627      DC3E28FF 
+ 627      DC3E28FF 
+ 627      DD3E28FF 
+ 628 14c8 DD3F29FF 		.ascii	"\335?)\377\335?)\377\335@)\377\335@*\377\335@*\377\336A*\377"
+ 628      DD3F29FF 
+ 628      DD4029FF 
+ 628      DD402AFF 
+ 628      DD402AFF 
+ 629 14e0 DE412AFF 		.ascii	"\336A*\377\336A+\377\336B+\377\336B+\377\336B,\377\337C,\377"
+ 629      DE412BFF 
+ 629      DE422BFF 
+ 629      DE422BFF 
+ 629      DE422CFF 
+ 630 14f8 DF432CFF 		.ascii	"\337C,\377\337C,\377\337D-\377\337D-\377\337D-\377\337E-\377"
+ 630      DF432CFF 
+ 630      DF442DFF 
+ 630      DF442DFF 
+ 630      DF442DFF 
+ 631 1510 E0452EFF 		.ascii	"\340E.\377\340E.\377\340F.\377\340F.\377\340F/\377\345Q7\377"
+ 631      E0452EFF 
+ 631      E0462EFF 
+ 631      E0462EFF 
+ 631      E0462FFF 
+ 632 1528 E55137FF 		.ascii	"\345Q7\377\345R8\377\346R8\377\346R8\377\346S8\377\346S9\377"
+GAS LISTING /tmp/ccL1hvVp.s 			page 29
+
+
+ 632      E55238FF 
+ 632      E65238FF 
+ 632      E65238FF 
+ 632      E65338FF 
+ 633 1540 E65339FF 		.ascii	"\346S9\377\346T9\377\346T9\377\347T:\377\347U:\377\347U:\377"
+ 633      E65439FF 
+ 633      E65439FF 
+ 633      E7543AFF 
+ 633      E7553AFF 
+ 634 1558 E7553AFF 		.ascii	"\347U:\377\347V;\377\347V;\377\350V;\377\350V;\377\350W<\377"
+ 634      E7563BFF 
+ 634      E7563BFF 
+ 634      E8563BFF 
+ 634      E8563BFF 
+ 635 1570 E8573CFF 		.ascii	"\350W<\377\350W<\377\350X<\377\350X=\377\351X=\377\351Y=\377"
+ 635      E8573CFF 
+ 635      E8583CFF 
+ 635      E8583DFF 
+ 635      E9583DFF 
+ 636 1588 E9593DFF 		.ascii	"\351Y=\377\351Y>\377\351Z>\377\351Z>\377\351Z>\377\352Z?\377"
+ 636      E9593EFF 
+ 636      E95A3EFF 
+ 636      E95A3EFF 
+ 636      E95A3EFF 
+ 637 15a0 EA5B3FFF 		.ascii	"\352[?\377\352[?\377\352[?\377\352\\@\377\352\\@\377\352\\@\377"
+ 637      EA5B3FFF 
+ 637      EA5B3FFF 
+ 637      EA5C40FF 
+ 637      EA5C40FF 
+ 638 15b8 EB5D40FF 		.ascii	"\353]@\377\353]A\377\353]A\377\353]A\377\353^B\377\353^B\377"
+ 638      EB5D41FF 
+ 638      EB5D41FF 
+ 638      EB5D41FF 
+ 638      EB5E42FF 
+ 639 15d0 EB5E42FF 		.ascii	"\353^B\377\354_B\377\354_C\377\354_C\377\354`C\377\354`C\377"
+ 639      EC5F42FF 
+ 639      EC5F43FF 
+ 639      EC5F43FF 
+ 639      EC6043FF 
+ 640 15e8 EC6044FF 		.ascii	"\354`D\377\354`D\377\355aD\377\355aD\377\355aE\377\355bE\377"
+ 640      EC6044FF 
+ 640      ED6144FF 
+ 640      ED6144FF 
+ 640      ED6145FF 
+ 641 1600 ED6245FF 		.ascii	"\355bE\377\355bE\377\355bF\377\356cF\377\356cF\377\356cF\377"
+ 641      ED6245FF 
+ 641      ED6246FF 
+ 641      EE6346FF 
+ 641      EE6346FF 
+ 642 1618 EE6447FF 		.ascii	"\356dG\377\356dG\377\356dG\377\356eG\377\357eH\377\357eH\377"
+ 642      EE6447FF 
+ 642      EE6447FF 
+ 642      EE6547FF 
+ 642      EF6548FF 
+ 643 1630 EF6548FF 		.ascii	"\357eH\377\357fH\377\357fH\377\357fH\377\357fH\377\357gH\377"
+ 643      EF6648FF 
+ 643      EF6648FF 
+GAS LISTING /tmp/ccL1hvVp.s 			page 30
+
+
+ 643      EF6648FF 
+ 643      EF6648FF 
+ 644 1648 EF6748FF 		.ascii	"\357gH\377\357gH\377\357gH\377\360hI\377\360hI\377\360hI\377"
+ 644      EF6748FF 
+ 644      EF6748FF 
+ 644      F06849FF 
+ 644      F06849FF 
+ 645 1660 F06849FF 		.ascii	"\360hI\377\360iI\377\360iI\377\360iI\377\360iI\377\360jI\377"
+ 645      F06949FF 
+ 645      F06949FF 
+ 645      F06949FF 
+ 645      F06949FF 
+ 646 1678 F06A49FF 		.ascii	"\360jI\377\360jI\377\360kI\377\361kJ\377\361kJ\377\361kJ\377"
+ 646      F06A49FF 
+ 646      F06B49FF 
+ 646      F16B4AFF 
+ 646      F16B4AFF 
+ 647 1690 F16C4AFF 		.ascii	"\361lJ\377\361lJ\377\361lJ\377\361lJ\377\361mJ\377\361mJ\377"
+ 647      F16C4AFF 
+ 647      F16C4AFF 
+ 647      F16C4AFF 
+ 647      F16D4AFF 
+ 648 16a8 F16D4AFF 		.ascii	"\361mJ\377\361mK\377\361nK\377\362nK\377\362nK\377\362nK\377"
+ 648      F16D4BFF 
+ 648      F16E4BFF 
+ 648      F26E4BFF 
+ 648      F26E4BFF 
+ 649 16c0 F26F4BFF 		.ascii	"\362oK\377\362oK\377\362oK\377\362oK\377\362pK\377\362pK\377"
+ 649      F26F4BFF 
+ 649      F26F4BFF 
+ 649      F26F4BFF 
+ 649      F2704BFF 
+ 650 16d8 F2704CFF 		.ascii	"\362pL\377\362pL\377\362qL\377\363qL\377\363qL\377\363qL\377"
+ 650      F2704CFF 
+ 650      F2714CFF 
+ 650      F3714CFF 
+ 650      F3714CFF 
+ 651 16f0 F3724CFF 		.ascii	"\363rL\377\363rL\377\363rL\377\363rL\377\363sM\377\363sM\377"
+ 651      F3724CFF 
+ 651      F3724CFF 
+ 651      F3724CFF 
+ 651      F3734DFF 
+ 652 1708 F3734DFF 		.ascii	"\363sM\377\363sM\377\363tM\377\364tM\377\364tM\377\364tM\377"
+ 652      F3734DFF 
+ 652      F3744DFF 
+ 652      F4744DFF 
+ 652      F4744DFF 
+ 653 1720 F4754DFF 		.ascii	"\364uM\377\366}Q\377\367}Q\377\367}Q\377\367~Q\377\367~Q\377"
+ 653      F67D51FF 
+ 653      F77D51FF 
+ 653      F77D51FF 
+ 653      F77E51FF 
+ 654 1738 F77E51FF 		.ascii	"\367~Q\377\367~R\377\367\177R\377\367\177R\377\367\177R\377\367"
+ 654      F77E52FF 
+ 654      F77F52FF 
+ 654      F77F52FF 
+ 654      F77F52FF 
+GAS LISTING /tmp/ccL1hvVp.s 			page 31
+
+
+ 655 174d 7F52FFF7 		.ascii	"\177R\377\367\200R\377\367\200R\377\370\200R\377\370\200R\377"
+ 655      8052FFF7 
+ 655      8052FFF8 
+ 655      8052FFF8 
+ 655      8052FF
+ 656 1760 F88153FF 		.ascii	"\370\201S\377\370\201S\377\370\201S\377\370\201S\377\370\202"
+ 656      F88153FF 
+ 656      F88153FF 
+ 656      F88153FF 
+ 656      F882
+ 657 1772 53FFF882 		.ascii	"S\377\370\202S\377\370\202S\377\370\202S\377\370\203S\377\370"
+ 657      53FFF882 
+ 657      53FFF882 
+ 657      53FFF883 
+ 657      53FFF8
+ 658 1785 8354FFF8 		.ascii	"\203T\377\370\203T\377\371\203T\377\371\204T\377\371\204T\377"
+ 658      8354FFF9 
+ 658      8354FFF9 
+ 658      8454FFF9 
+ 658      8454FF
+ 659 1798 F98454FF 		.ascii	"\371\204T\377\371\204T\377\371\205T\377\371\205U\377\371\205"
+ 659      F98454FF 
+ 659      F98554FF 
+ 659      F98555FF 
+ 659      F985
+ 660 17aa 55FFF985 		.ascii	"U\377\371\205U\377\371\206U\377\371\206U\377\371\206U\377\371"
+ 660      55FFF986 
+ 660      55FFF986 
+ 660      55FFF986 
+ 660      55FFF9
+ 661 17bd 8655FFFA 		.ascii	"\206U\377\372\206U\377\372\207U\377\372\207V\377\372\207V\377"
+ 661      8655FFFA 
+ 661      8755FFFA 
+ 661      8756FFFA 
+ 661      8756FF
+ 662 17d0 FA8756FF 		.ascii	"\372\207V\377\372\210V\377\372\210V\377\372\210V\377\372\210"
+ 662      FA8856FF 
+ 662      FA8856FF 
+ 662      FA8856FF 
+ 662      FA88
+ 663 17e2 56FFFA89 		.ascii	"V\377\372\211V\377\372\211W\377\372\211W\377"
+ 663      56FFFA89 
+ 663      57FFFA89 
+ 663      57FF
+ 664 17f0 FB8957FF 		.ascii	"\373\211W\377\373\212W\377\373\212W\377\373\212W\377\373\212"
+ 664      FB8A57FF 
+ 664      FB8A57FF 
+ 664      FB8A57FF 
+ 664      FB8A
+ 665 1802 57FFFB8B 		.ascii	"W\377\373\213W\377\373\213X\377\373\213X\377\373\213X\377\373"
+ 665      57FFFB8B 
+ 665      58FFFB8B 
+ 665      58FFFB8B 
+ 665      58FFFB
+ 666 1815 8C58FFFB 		.ascii	"\214X\377\373\214X\377\373\214X\377\373\214X\377\373\215X\377"
+ 666      8C58FFFB 
+ 666      8C58FFFB 
+GAS LISTING /tmp/ccL1hvVp.s 			page 32
+
+
+ 666      8C58FFFB 
+ 666      8D58FF
+ 667 1828 FC8D59FF 		.ascii	"\374\215Y\377\374\215Y\377\374\215Y\377\374\216Y\377\374\216"
+ 667      FC8D59FF 
+ 667      FC8D59FF 
+ 667      FC8E59FF 
+ 667      FC8E
+ 668 183a 5AFFFC8E 		.ascii	"Z\377\374\216Z\377\374\217Z\377\374\217Z\377\374\217Z\377\374"
+ 668      5AFFFC8F 
+ 668      5AFFFC8F 
+ 668      5AFFFC8F 
+ 668      5AFFFC
+ 669 184d 905BFFFC 		.ascii	"\220[\377\374\220[\377\374\220[\377\374\221[\377\374\221\\\377"
+ 669      905BFFFC 
+ 669      905BFFFC 
+ 669      915BFFFC 
+ 669      915CFF
+ 670 1860 FC915CFF 		.ascii	"\374\221\\\377\374\221\\\377\374\222\\\377\374\222]\377\374\222"
+ 670      FC915CFF 
+ 670      FC925CFF 
+ 670      FC925DFF 
+ 670      FC92
+ 671 1872 5DFFFC93 		.ascii	"]\377\374\223]\377\374\223]\377\374\223]\377\374\224^\377\374"
+ 671      5DFFFC93 
+ 671      5DFFFC93 
+ 671      5DFFFC94 
+ 671      5EFFFC
+ 672 1885 945EFFFC 		.ascii	"\224^\377\374\224^\377\374\224^\377\374\225_\377\374\225_\377"
+ 672      945EFFFC 
+ 672      945EFFFC 
+ 672      955FFFFC 
+ 672      955FFF
+ 673 1898 FC955FFF 		.ascii	"\374\225_\377\374\226_\377\374\226`\377\374\226`\377\374\227"
+ 673      FC965FFF 
+ 673      FC9660FF 
+ 673      FC9660FF 
+ 673      FC97
+ 674 18aa 60FFFC97 		.ascii	"`\377\374\227`\377\374\227a\377\374\227a\377\374\230a\377\374"
+ 674      60FFFC97 
+ 674      61FFFC97 
+ 674      61FFFC98 
+ 674      61FFFC
+ 675 18bd 9861FFFC 		.ascii	"\230a\377\374\230b\377\374\231b\377\374\231b\377\374\231b\377"
+ 675      9862FFFC 
+ 675      9962FFFC 
+ 675      9962FFFC 
+ 675      9962FF
+ 676 18d0 FC9A63FF 		.ascii	"\374\232c\377\374\232c\377\374\232c\377\374\232c\377\374\233"
+ 676      FC9A63FF 
+ 676      FC9A63FF 
+ 676      FC9A63FF 
+ 676      FC9B
+ 677 18e2 64FFFC9B 		.ascii	"d\377\374\233d\377\374\233d\377\374\234d\377\374\234e\377\374"
+ 677      64FFFC9B 
+ 677      64FFFC9C 
+ 677      64FFFC9C 
+ 677      65FFFC
+GAS LISTING /tmp/ccL1hvVp.s 			page 33
+
+
+ 678 18f5 9C65FFFC 		.ascii	"\234e\377\374\234e\377\374\235e\377\374\235f\377\374\235f\377"
+ 678      9C65FFFC 
+ 678      9D65FFFC 
+ 678      9D66FFFC 
+ 678      9D66FF
+ 679 1908 FC9E66FF 		.ascii	"\374\236f\377\374\236f\377\374\236g\377\374\236g\377\374\237"
+ 679      FC9E66FF 
+ 679      FC9E67FF 
+ 679      FC9E67FF 
+ 679      FC9F
+ 680 191a 67FFFC9F 		.ascii	"g\377\374\237h\377\374\237h\377\374\251q\377\374\251q\377\374"
+ 680      68FFFC9F 
+ 680      68FFFCA9 
+ 680      71FFFCA9 
+ 680      71FFFC
+ 681 192d A971FFFC 		.ascii	"\251q\377\374\252q\377\374\252r\377\374\252r\377\374\253r\377"
+ 681      AA71FFFC 
+ 681      AA72FFFC 
+ 681      AA72FFFC 
+ 681      AB72FF
+ 682 1940 FCAB73FF 		.ascii	"\374\253s\377\374\253s\377\374\253s\377\374\254s\377\374\254"
+ 682      FCAB73FF 
+ 682      FCAB73FF 
+ 682      FCAC73FF 
+ 682      FCAC
+ 683 1952 74FFFCAC 		.ascii	"t\377\374\254t\377\374\255t\377\374\255u\377\374\255u\377\374"
+ 683      74FFFCAD 
+ 683      74FFFCAD 
+ 683      75FFFCAD 
+ 683      75FFFC
+ 684 1965 AD75FFFC 		.ascii	"\255u\377\374\256u\377\374\256v\377\374\256v\377\374\256v\377"
+ 684      AE75FFFC 
+ 684      AE76FFFC 
+ 684      AE76FFFC 
+ 684      AE76FF
+ 685 1978 FCAF76FF 		.ascii	"\374\257v\377\374\257w\377\374\257w\377\374\260w\377\374\260"
+ 685      FCAF77FF 
+ 685      FCAF77FF 
+ 685      FCB077FF 
+ 685      FCB0
+ 686 198a 78FFFCB0 		.ascii	"x\377\374\260x\377\374\260x\377\374\261y\377\374\261y\377\374"
+ 686      78FFFCB0 
+ 686      78FFFCB1 
+ 686      79FFFCB1 
+ 686      79FFFC
+ 687 199d B179FFFC 		.ascii	"\261y\377\374\262y\377\374\262z\377\374\262z\377\374\262z\377"
+ 687      B279FFFC 
+ 687      B27AFFFC 
+ 687      B27AFFFC 
+ 687      B27AFF
+ 688 19b0 FCB37BFF 		.ascii	"\374\263{\377\374\263{\377\374\263{\377\374\263{\377\374\264"
+ 688      FCB37BFF 
+ 688      FCB37BFF 
+ 688      FCB37BFF 
+ 688      FCB4
+ 689 19c2 7CFFFCB4 		.ascii	"|\377\374\264|\377\374\264|\377\374\265}\377\374\265}\377\374"
+ 689      7CFFFCB4 
+GAS LISTING /tmp/ccL1hvVp.s 			page 34
+
+
+ 689      7CFFFCB5 
+ 689      7DFFFCB5 
+ 689      7DFFFC
+ 690 19d5 B57DFFFC 		.ascii	"\265}\377\374\265~\377\374\266~\377\374\266~\377\374\266\177"
+ 690      B57EFFFC 
+ 690      B67EFFFC 
+ 690      B67EFFFC 
+ 690      B67F
+ 691 19e7 FFFCB67F 		.ascii	"\377\374\266\177\377\374\267\177\377\374\267\177\377\374\267"
+ 691      FFFCB77F 
+ 691      FFFCB77F 
+ 691      FFFCB7
+ 692 19f6 80FFFCB8 		.ascii	"\200\377\374\270\200\377\374\270\200\377\374\270\201\377\374"
+ 692      80FFFCB8 
+ 692      80FFFCB8 
+ 692      81FFFC
+ 693 1a05 B881FFFC 		.ascii	"\270\201\377\374\271\201\377\374\271\202\377\374\271\202\377"
+ 693      B981FFFC 
+ 693      B982FFFC 
+ 693      B982FF
+ 694 1a14 FCB982FF 		.ascii	"\374\271\202\377\374\272\203\377\374\272\203\377\374\272\203"
+ 694      FCBA83FF 
+ 694      FCBA83FF 
+ 694      FCBA83
+ 695 1a23 FFFCBB83 		.ascii	"\377\374\273\203\377\374\273\204\377\374\273\204\377\374\273"
+ 695      FFFCBB84 
+ 695      FFFCBB84 
+ 695      FFFCBB
+ 696 1a32 84FFFCBB 		.ascii	"\204\377\374\273\204\377\374\273\204\377\374\273\204\377\374"
+ 696      84FFFCBB 
+ 696      84FFFCBB 
+ 696      84FFFC
+ 697 1a41 BC85FFFC 		.ascii	"\274\205\377\374\274\205\377\374\274\205\377\374\274\205\377"
+ 697      BC85FFFC 
+ 697      BC85FFFC 
+ 697      BC85FF
+ 698 1a50 FCBC85FF 		.ascii	"\374\274\205\377\374\274\205\377\374\275\205\377\374\275\206"
+ 698      FCBC85FF 
+ 698      FCBD85FF 
+ 698      FCBD86
+ 699 1a5f FFFCBD86 		.ascii	"\377\374\275\206\377\374\275\206\377\374\275\206\377\374\275"
+ 699      FFFCBD86 
+ 699      FFFCBD86 
+ 699      FFFCBD
+ 700 1a6e 86FFFCBE 		.ascii	"\206\377\374\276\206\377\374\276\206\377\374\276\207\377\374"
+ 700      86FFFCBE 
+ 700      86FFFCBE 
+ 700      87FFFC
+ 701 1a7d BE87FFFC 		.ascii	"\276\207\377\374\276\207\377\374\276\207\377\374\277\207\377"
+ 701      BE87FFFC 
+ 701      BE87FFFC 
+ 701      BF87FF
+ 702 1a8c FCBF87FF 		.ascii	"\374\277\207\377\374\277\207\377\374\277\210\377\374\277\210"
+ 702      FCBF87FF 
+ 702      FCBF88FF 
+ 702      FCBF88
+ 703 1a9b FFFCBF88 		.ascii	"\377\374\277\210\377\374\277\210\377\374\300\210\377\374\300"
+GAS LISTING /tmp/ccL1hvVp.s 			page 35
+
+
+ 703      FFFCBF88 
+ 703      FFFCC088 
+ 703      FFFCC0
+ 704 1aaa 88FFFCC0 		.ascii	"\210\377\374\300\211\377\374\300\211\377\374\300\211\377\374"
+ 704      89FFFCC0 
+ 704      89FFFCC0 
+ 704      89FFFC
+ 705 1ab9 C089FFFC 		.ascii	"\300\211\377\374\301\211\377\374\301\211\377\374\301\211\377"
+ 705      C189FFFC 
+ 705      C189FFFC 
+ 705      C189FF
+ 706 1ac8 FCC18AFF 		.ascii	"\374\301\212\377\374\301\212\377\374\301\212\377\374\302\212"
+ 706      FCC18AFF 
+ 706      FCC18AFF 
+ 706      FCC28A
+ 707 1ad7 FFFCC28A 		.ascii	"\377\374\302\212\377\374\302\212\377\374\302\213\377\374\302"
+ 707      FFFCC28A 
+ 707      FFFCC28B 
+ 707      FFFCC2
+ 708 1ae6 8BFFFCC2 		.ascii	"\213\377\374\302\213\377\374\303\213\377\374\303\213\377\374"
+ 708      8BFFFCC3 
+ 708      8BFFFCC3 
+ 708      8BFFFC
+ 709 1af5 C38BFFFC 		.ascii	"\303\213\377\374\303\213\377\374\303\214\377\374\303\214\377"
+ 709      C38BFFFC 
+ 709      C38CFFFC 
+ 709      C38CFF
+ 710 1b04 FCC38CFF 		.ascii	"\374\303\214\377\374\304\214\377\374\304\214\377\374\304\214"
+ 710      FCC48CFF 
+ 710      FCC48CFF 
+ 710      FCC48C
+ 711 1b13 FFFCC48D 		.ascii	"\377\374\304\215\377\374\304\215\377\374\304\215\377\374\305"
+ 711      FFFCC48D 
+ 711      FFFCC48D 
+ 711      FFFCC5
+ 712 1b22 8DFFFCCA 		.ascii	"\215\377\374\312\222\377\374\312\223\377\374\312\223\377\374"
+ 712      92FFFCCA 
+ 712      93FFFCCA 
+ 712      93FFFC
+ 713 1b31 CA93FFFC 		.ascii	"\312\223\377\374\312\223\377\374\312\223\377\374\313\223\377"
+ 713      CA93FFFC 
+ 713      CA93FFFC 
+ 713      CB93FF
+ 714 1b40 FCCB94FF 		.ascii	"\374\313\224\377\374\313\224\377\374\313\224\377\374\313\224"
+ 714      FCCB94FF 
+ 714      FCCB94FF 
+ 714      FCCB94
+ 715 1b4f FFFCCB94 		.ascii	"\377\374\313\224\377\374\314\224\377\374\314\225\377\374\314"
+ 715      FFFCCC94 
+ 715      FFFCCC95 
+ 715      FFFCCC
+ 716 1b5e 95FFFCCC 		.ascii	"\225\377\374\314\225\377\374\314\225\377\374\314\225\377\374"
+ 716      95FFFCCC 
+ 716      95FFFCCC 
+ 716      95FFFC
+ 717 1b6d CC95FFFC 		.ascii	"\314\225\377\374\315\226\377\374\315\226\377\374\315\226\377"
+ 717      CD96FFFC 
+GAS LISTING /tmp/ccL1hvVp.s 			page 36
+
+
+ 717      CD96FFFC 
+ 717      CD96FF
+ 718 1b7c FCCD96FF 		.ascii	"\374\315\226\377\374\315\226\377\374\315\226\377\374\316\227"
+ 718      FCCD96FF 
+ 718      FCCD96FF 
+ 718      FCCE97
+ 719 1b8b FFFCCE97 		.ascii	"\377\374\316\227\377\374\316\227\377\374\316\227\377\374\316"
+ 719      FFFCCE97 
+ 719      FFFCCE97 
+ 719      FFFCCE
+ 720 1b9a 97FFFCCE 		.ascii	"\227\377\374\316\227\377\374\316\230\377\374\317\230\377\374"
+ 720      97FFFCCE 
+ 720      98FFFCCF 
+ 720      98FFFC
+ 721 1ba9 CF98FFFC 		.ascii	"\317\230\377\374\317\230\377\374\317\230\377\374\317\231\377"
+ 721      CF98FFFC 
+ 721      CF98FFFC 
+ 721      CF99FF
+ 722 1bb8 FCCF99FF 		.ascii	"\374\317\231\377\374\320\231\377\374\320\231\377\374\320\231"
+ 722      FCD099FF 
+ 722      FCD099FF 
+ 722      FCD099
+ 723 1bc7 FFFCD099 		.ascii	"\377\374\320\231\377\374\320\232\377\374\320\232\377\374\320"
+ 723      FFFCD09A 
+ 723      FFFCD09A 
+ 723      FFFCD0
+ 724 1bd6 9AFFFCD1 		.ascii	"\232\377\374\321\232\377\374\321\232\377\374\321\232\377\374"
+ 724      9AFFFCD1 
+ 724      9AFFFCD1 
+ 724      9AFFFC
+ 725 1be5 D19BFFFC 		.ascii	"\321\233\377\374\321\233\377\374\321\233\377\374\322\233\377"
+ 725      D19BFFFC 
+ 725      D19BFFFC 
+ 725      D29BFF
+ 726 1bf4 FCD29BFF 		.ascii	"\374\322\233\377\374\322\234\377\374\322\234\377\374\322\234"
+ 726      FCD29CFF 
+ 726      FCD29CFF 
+ 726      FCD29C
+ 727 1c03 FFFCD29C 		.ascii	"\377\374\322\234\377\374\322\234\377\374\323\234\377\374\323"
+ 727      FFFCD29C 
+ 727      FFFCD39C 
+ 727      FFFCD3
+ 728 1c12 9DFFFCD3 		.ascii	"\235\377\374\323\235\377\374\323\235\377\374\323\235\377\374"
+ 728      9DFFFCD3 
+ 728      9DFFFCD3 
+ 728      9DFFFC
+ 729 1c21 D39DFFFC 		.ascii	"\323\235\377\374\324\235\377\375\324\236\377\375\324\236\377"
+ 729      D49DFFFD 
+ 729      D49EFFFD 
+ 729      D49EFF
+ 730 1c30 FDD49EFF 		.ascii	"\375\324\236\377\375\324\237\377\375\324\237\377\375\324\237"
+ 730      FDD49FFF 
+ 730      FDD49FFF 
+ 730      FDD49F
+ 731 1c3f FFFDD49F 		.ascii	"\377\375\324\237\377\375\325\240\377\375\325\240\377\375\325"
+ 731      FFFDD5A0 
+ 731      FFFDD5A0 
+GAS LISTING /tmp/ccL1hvVp.s 			page 37
+
+
+ 731      FFFDD5
+ 732 1c4e A0FFFDD5 		.ascii	"\240\377\375\325\240\377\375\325\241\377\375\325\241\377\375"
+ 732      A0FFFDD5 
+ 732      A1FFFDD5 
+ 732      A1FFFD
+ 733 1c5d D5A1FFFD 		.ascii	"\325\241\377\375\325\241\377\375\326\242\377\375\326\242\377"
+ 733      D5A1FFFD 
+ 733      D6A2FFFD 
+ 733      D6A2FF
+ 734 1c6c FDD6A2FF 		.ascii	"\375\326\242\377\375\326\242\377\375\326\243\377\375\326\243"
+ 734      FDD6A2FF 
+ 734      FDD6A3FF 
+ 734      FDD6A3
+ 735 1c7b FFFDD6A3 		.ascii	"\377\375\326\243\377\375\326\243\377\375\327\244\377\375\327"
+ 735      FFFDD6A3 
+ 735      FFFDD7A4 
+ 735      FFFDD7
+ 736 1c8a A4FFFDD7 		.ascii	"\244\377\375\327\244\377\375\327\244\377\375\327\245\377\375"
+ 736      A4FFFDD7 
+ 736      A4FFFDD7 
+ 736      A5FFFD
+ 737 1c99 D7A5FFFD 		.ascii	"\327\245\377\375\327\245\377\375\327\246\377\375\330\246\377"
+ 737      D7A5FFFD 
+ 737      D7A6FFFD 
+ 737      D8A6FF
+ 738 1ca8 FDD8A6FF 		.ascii	"\375\330\246\377\375\330\246\377\375\330\247\377\375\330\247"
+ 738      FDD8A6FF 
+ 738      FDD8A7FF 
+ 738      FDD8A7
+ 739 1cb7 FFFDD8A7 		.ascii	"\377\375\330\247\377\375\330\247\377\375\330\250\377\375\331"
+ 739      FFFDD8A7 
+ 739      FFFDD8A8 
+ 739      FFFDD9
+ 740 1cc6 A8FFFDD9 		.ascii	"\250\377\375\331\250\377\375\331\250\377\375\331\251\377\375"
+ 740      A8FFFDD9 
+ 740      A8FFFDD9 
+ 740      A9FFFD
+ 741 1cd5 D9A9FFFD 		.ascii	"\331\251\377\375\331\251\377\375\331\251\377\375\331\252\377"
+ 741      D9A9FFFD 
+ 741      D9A9FFFD 
+ 741      D9AAFF
+ 742 1ce4 FDDAAAFF 		.ascii	"\375\332\252\377\375\332\252\377\375\332\252\377\375\332\253"
+ 742      FDDAAAFF 
+ 742      FDDAAAFF 
+ 742      FDDAAB
+ 743 1cf3 FFFDDAAB 		.ascii	"\377\375\332\253\377\375\332\253\377\375\332\254\377\375\332"
+ 743      FFFDDAAB 
+ 743      FFFDDAAC 
+ 743      FFFDDA
+ 744 1d02 ACFFFDDB 		.ascii	"\254\377\375\333\254\377\375\333\254\377\375\333\255\377\375"
+ 744      ACFFFDDB 
+ 744      ACFFFDDB 
+ 744      ADFFFD
+ 745 1d11 DBADFFFD 		.ascii	"\333\255\377\375\333\255\377\375\333\255\377\375\333\256\377"
+ 745      DBADFFFD 
+ 745      DBADFFFD 
+ 745      DBAEFF
+GAS LISTING /tmp/ccL1hvVp.s 			page 38
+
+
+ 746 1d20 FDDBAEFF 		.ascii	"\375\333\256\377\375\340\267\377\375\340\267\377\375\340\267"
+ 746      FDE0B7FF 
+ 746      FDE0B7FF 
+ 746      FDE0B7
+ 747 1d2f FFFDE0B7 		.ascii	"\377\375\340\267\377\375\340\270\377\375\340\270\377\375\340"
+ 747      FFFDE0B8 
+ 747      FFFDE0B8 
+ 747      FFFDE0
+ 748 1d3e B8FFFDE0 		.ascii	"\270\377\375\340\270\377\375\341\271\377\375\341\271\377\375"
+ 748      B8FFFDE1 
+ 748      B9FFFDE1 
+ 748      B9FFFD
+ 749 1d4d E1B9FFFD 		.ascii	"\341\271\377\375\341\271\377\375\341\272\377\375\341\272\377"
+ 749      E1B9FFFD 
+ 749      E1BAFFFD 
+ 749      E1BAFF
+ 750 1d5c FDE1BAFF 		.ascii	"\375\341\272\377\375\341\272\377\375\342\273\377\375\342\273"
+ 750      FDE1BAFF 
+ 750      FDE2BBFF 
+ 750      FDE2BB
+ 751 1d6b FFFDE2BB 		.ascii	"\377\375\342\273\377\375\342\274\377\375\342\274\377\375\342"
+ 751      FFFDE2BC 
+ 751      FFFDE2BC 
+ 751      FFFDE2
+ 752 1d7a BCFFFDE2 		.ascii	"\274\377\375\342\274\377\375\342\275\377\375\343\275\377\375"
+ 752      BCFFFDE2 
+ 752      BDFFFDE3 
+ 752      BDFFFD
+ 753 1d89 E3BDFFFD 		.ascii	"\343\275\377\375\343\275\377\375\343\276\377\375\343\276\377"
+ 753      E3BDFFFD 
+ 753      E3BEFFFD 
+ 753      E3BEFF
+ 754 1d98 FDE3BEFF 		.ascii	"\375\343\276\377\375\343\276\377\375\343\277\377\375\344\277"
+ 754      FDE3BEFF 
+ 754      FDE3BFFF 
+ 754      FDE4BF
+ 755 1da7 FFFDE4BF 		.ascii	"\377\375\344\277\377\375\344\300\377\375\344\300\377\375\344"
+ 755      FFFDE4C0 
+ 755      FFFDE4C0 
+ 755      FFFDE4
+ 756 1db6 C0FFFDE4 		.ascii	"\300\377\375\344\300\377\375\344\301\377\375\344\301\377\375"
+ 756      C0FFFDE4 
+ 756      C1FFFDE4 
+ 756      C1FFFD
+ 757 1dc5 E5C1FFFD 		.ascii	"\345\301\377\375\345\301\377\375\345\302\377\375\345\302\377"
+ 757      E5C1FFFD 
+ 757      E5C2FFFD 
+ 757      E5C2FF
+ 758 1dd4 FDE5C2FF 		.ascii	"\375\345\302\377\375\345\302\377\375\345\303\377\375\345\303"
+ 758      FDE5C2FF 
+ 758      FDE5C3FF 
+ 758      FDE5C3
+ 759 1de3 FFFDE6C3 		.ascii	"\377\375\346\303\377\375\346\303\377\375\346\304\377\375\346"
+ 759      FFFDE6C3 
+ 759      FFFDE6C4 
+ 759      FFFDE6
+ 760 1df2 C4FFFDE6 		.ascii	"\304\377\375\346\304\377\375\346\305\377\375\346\305\377\375"
+GAS LISTING /tmp/ccL1hvVp.s 			page 39
+
+
+ 760      C4FFFDE6 
+ 760      C5FFFDE6 
+ 760      C5FFFD
+ 761 1e01 E6C5FFFD 		.ascii	"\346\305\377\375\347\305\377\375\347\306\377\375\347\306\377"
+ 761      E7C5FFFD 
+ 761      E7C6FFFD 
+ 761      E7C6FF
+ 762 1e10 FDE7C6FF 		.ascii	"\375\347\306\377\375\347\306\377\375\347\307\377\375\347\307"
+ 762      FDE7C6FF 
+ 762      FDE7C7FF 
+ 762      FDE7C7
+ 763 1e1f FFFDE7C7 		.ascii	"\377\375\347\307\377\375\350\307\377\376\350\310\377\376\350"
+ 763      FFFDE8C7 
+ 763      FFFEE8C8 
+ 763      FFFEE8
+ 764 1e2e C8FFFEE8 		.ascii	"\310\377\376\350\310\377\376\350\310\377\376\350\311\377\376"
+ 764      C8FFFEE8 
+ 764      C8FFFEE8 
+ 764      C9FFFE
+ 765 1e3d E8C9FFFE 		.ascii	"\350\311\377\376\350\311\377\376\350\311\377\376\350\312\377"
+ 765      E8C9FFFE 
+ 765      E8C9FFFE 
+ 765      E8CAFF
+ 766 1e4c FEE8CAFF 		.ascii	"\376\350\312\377\376\351\312\377\376\351\312\377\376\351\312"
+ 766      FEE9CAFF 
+ 766      FEE9CAFF 
+ 766      FEE9CA
+ 767 1e5b FFFEE9CB 		.ascii	"\377\376\351\313\377\376\351\313\377\376\351\313\377\376\351"
+ 767      FFFEE9CB 
+ 767      FFFEE9CB 
+ 767      FFFEE9
+ 768 1e6a CBFFFEE9 		.ascii	"\313\377\376\351\314\377\376\351\314\377\376\351\314\377\376"
+ 768      CCFFFEE9 
+ 768      CCFFFEE9 
+ 768      CCFFFE
+ 769 1e79 E9CCFFFE 		.ascii	"\351\314\377\376\352\314\377\376\352\315\377\376\352\315\377"
+ 769      EACCFFFE 
+ 769      EACDFFFE 
+ 769      EACDFF
+ 770 1e88 FEEACDFF 		.ascii	"\376\352\315\377\376\352\315\377\376\352\316\377\376\352\316"
+ 770      FEEACDFF 
+ 770      FEEACEFF 
+ 770      FEEACE
+ 771 1e97 FFFEEACE 		.ascii	"\377\376\352\316\377\376\352\316\377\376\352\316\377\376\352"
+ 771      FFFEEACE 
+ 771      FFFEEACE 
+ 771      FFFEEA
+ 772 1ea6 CFFFFEEB 		.ascii	"\317\377\376\353\317\377\376\353\317\377\376\353\317\377\376"
+ 772      CFFFFEEB 
+ 772      CFFFFEEB 
+ 772      CFFFFE
+ 773 1eb5 EBD0FFFE 		.ascii	"\353\320\377\376\353\320\377\376\353\320\377\376\353\320\377"
+ 773      EBD0FFFE 
+ 773      EBD0FFFE 
+ 773      EBD0FF
+ 774 1ec4 FEEBD0FF 		.ascii	"\376\353\320\377\376\353\321\377\376\353\321\377\376\354\321"
+ 774      FEEBD1FF 
+GAS LISTING /tmp/ccL1hvVp.s 			page 40
+
+
+ 774      FEEBD1FF 
+ 774      FEECD1
+ 775 1ed3 FFFEECD1 		.ascii	"\377\376\354\321\377\376\354\322\377\376\354\322\377\376\354"
+ 775      FFFEECD2 
+ 775      FFFEECD2 
+ 775      FFFEEC
+ 776 1ee2 D2FFFEEC 		.ascii	"\322\377\376\354\322\377\376\354\322\377\376\354\323\377\376"
+ 776      D2FFFEEC 
+ 776      D2FFFEEC 
+ 776      D3FFFE
+ 777 1ef1 ECD3FFFE 		.ascii	"\354\323\377\376\354\323\377\376\354\323\377\376\355\324\377"
+ 777      ECD3FFFE 
+ 777      ECD3FFFE 
+ 777      EDD4FF
+ 778 1f00 FEEDD4FF 		.ascii	"\376\355\324\377\376\355\324\377\376\355\324\377\376\355\324"
+ 778      FEEDD4FF 
+ 778      FEEDD4FF 
+ 778      FEEDD4
+ 779 1f0f FFFEEDD5 		.ascii	"\377\376\355\325\377\376\355\325\377\376\355\325\377\376\355"
+ 779      FFFEEDD5 
+ 779      FFFEEDD5 
+ 779      FFFEED
+ 780 1f1e D5FFFEED 		.ascii	"\325\377\376\355\326\377\376\360\335\377\376\361\335\377\376"
+ 780      D6FFFEF0 
+ 780      DDFFFEF1 
+ 780      DDFFFE
+ 781 1f2d F1DDFFFE 		.ascii	"\361\335\377\376\361\336\377\376\361\336\377\376\361\336\377"
+ 781      F1DEFFFE 
+ 781      F1DEFFFE 
+ 781      F1DEFF
+ 782 1f3c FEF1DEFF 		.ascii	"\376\361\336\377\376\361\337\377\376\361\337\377\376\361\337"
+ 782      FEF1DFFF 
+ 782      FEF1DFFF 
+ 782      FEF1DF
+ 783 1f4b FFFEF1DF 		.ascii	"\377\376\361\337\377\376\362\340\377\376\362\340\377\376\362"
+ 783      FFFEF2E0 
+ 783      FFFEF2E0 
+ 783      FFFEF2
+ 784 1f5a E0FFFEF2 		.ascii	"\340\377\376\362\340\377\376\362\340\377\376\362\341\377\376"
+ 784      E0FFFEF2 
+ 784      E0FFFEF2 
+ 784      E1FFFE
+ 785 1f69 F2E1FFFE 		.ascii	"\362\341\377\376\362\341\377\376\362\341\377\376\362\342\377"
+ 785      F2E1FFFE 
+ 785      F2E1FFFE 
+ 785      F2E2FF
+ 786 1f78 FEF2E2FF 		.ascii	"\376\362\342\377\376\363\342\377\376\363\342\377\376\363\342"
+ 786      FEF3E2FF 
+ 786      FEF3E2FF 
+ 786      FEF3E2
+ 787 1f87 FFFEF3E3 		.ascii	"\377\376\363\343\377\376\363\343\377\376\363\343\377\376\363"
+ 787      FFFEF3E3 
+ 787      FFFEF3E3 
+ 787      FFFEF3
+ 788 1f96 E3FFFEF3 		.ascii	"\343\377\376\363\344\377\376\363\344\377\376\363\344\377\376"
+ 788      E4FFFEF3 
+ 788      E4FFFEF3 
+GAS LISTING /tmp/ccL1hvVp.s 			page 41
+
+
+ 788      E4FFFE
+ 789 1fa5 F3E4FFFE 		.ascii	"\363\344\377\376\364\344\377\376\364\345\377\376\364\345\377"
+ 789      F4E4FFFE 
+ 789      F4E5FFFE 
+ 789      F4E5FF
+ 790 1fb4 FEF4E5FF 		.ascii	"\376\364\345\377\376\364\345\377\376\364\346\377"
+ 790      FEF4E5FF 
+ 790      FEF4E6FF 
+ 791 1fc0 FEF4E6FF 		.ascii	"\376\364\346\377\376\364\346\377\376\364\346\377\376\364\347"
+ 791      FEF4E6FF 
+ 791      FEF4E6FF 
+ 791      FEF4E7
+ 792 1fcf FFFEF5E7 		.ascii	"\377\376\365\347\377\376\365\347\377\376\365\347\377\376\365"
+ 792      FFFEF5E7 
+ 792      FFFEF5E7 
+ 792      FFFEF5
+ 793 1fde E7FFFEF5 		.ascii	"\347\377\376\365\350\377\376\365\350\377\376\365\350\377\376"
+ 793      E8FFFEF5 
+ 793      E8FFFEF5 
+ 793      E8FFFE
+ 794 1fed F5E8FFFE 		.ascii	"\365\350\377\376\365\351\377\376\365\351\377\376\365\351\377"
+ 794      F5E9FFFE 
+ 794      F5E9FFFE 
+ 794      F5E9FF
+ 795 1ffc FEF6E9FF 		.ascii	"\376\366\351\377\376\366\351\377\376\366\352\377\376\366\352"
+ 795      FEF6E9FF 
+ 795      FEF6EAFF 
+ 795      FEF6EA
+ 796 200b FFFEF6EA 		.ascii	"\377\376\366\352\377\376\366\352\377\376\366\353\377\376\366"
+ 796      FFFEF6EA 
+ 796      FFFEF6EB 
+ 796      FFFEF6
+ 797 201a EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377"
+ 797      EBFFFEF6 
+ 797      EBFF
+ 798              		.globl	heatmap_cs_OrRd_soft
+ 799              		.section	.data.rel.local
+ 800              		.align 8
+ 801              		.type	heatmap_cs_OrRd_soft, @object
+ 802              		.size	heatmap_cs_OrRd_soft, 8
+ 803              	heatmap_cs_OrRd_soft:
+ 804 0010 00000000 		.quad	soft
+ 804      00000000 
+ 805              		.section	.data.rel.ro.local
+ 806              		.align 16
+ 807              		.type	soft, @object
+ 808              		.size	soft, 16
+ 809              	soft:
+ 810 0020 00000000 		.quad	soft_data
+ 810      00000000 
+ 811 0028 01040000 		.quad	1025
+ 811      00000000 
+ 812              		.section	.rodata
+ 813 2024 00000000 		.align 32
+ 813      00000000 
+ 813      00000000 
+ 813      00000000 
+GAS LISTING /tmp/ccL1hvVp.s 			page 42
+
+
+ 813      00000000 
+ 814              		.type	soft_data, @object
+ 815              		.size	soft_data, 4100
+ 816              	soft_data:
+ 817 2040 00       		.string	""
+ 818 2041 00       		.string	""
+ 819 2042 00       		.string	""
+ 820 2043 00       		.string	""
+ 821 2044 7E00     		.string	"~"
+ 822 2046 00       		.string	""
+ 823 2047 00       		.string	""
+ 824 2048 7F00     		.string	"\177"
+ 825 204a 00       		.string	""
+ 826 204b 077F00   		.string	"\007\177"
+ 827 204e 00       		.string	""
+ 828 204f 0E8000   		.string	"\016\200"
+ 829 2052 00       		.string	""
+ 830 2053 168000   		.string	"\026\200"
+ 831 2056 00       		.string	""
+ 832 2057 1D8000   		.string	"\035\200"
+ 833 205a 00       		.string	""
+ 834 205b 258100   		.string	"%\201"
+ 835 205e 00       		.string	""
+ 836 205f 2C8100   		.string	",\201"
+ 837 2062 00       		.string	""
+ 838 2063 348200   		.string	"4\202"
+ 839 2066 00       		.string	""
+ 840 2067 3B8200   		.string	";\202"
+ 841 206a 00       		.string	""
+ 842 206b 438200   		.string	"C\202"
+ 843 206e 00       		.string	""
+ 844 206f 4A8300   		.string	"J\203"
+ 845 2072 00       		.string	""
+ 846 2073 528300   		.string	"R\203"
+ 847 2076 00       		.string	""
+ 848 2077 598400   		.string	"Y\204"
+ 849 207a 00       		.string	""
+ 850 207b 618400   		.string	"a\204"
+ 851 207e 00       		.string	""
+ 852 207f 688400   		.string	"h\204"
+ 853 2082 00       		.string	""
+ 854 2083 708500   		.string	"p\205"
+ 855 2086 00       		.string	""
+ 856 2087 778500   		.string	"w\205"
+ 857 208a 00       		.string	""
+ 858 208b 7F8600   		.string	"\177\206"
+ 859 208e 00       		.string	""
+ 860 208f 868600   		.string	"\206\206"
+ 861 2092 00       		.string	""
+ 862 2093 8D8600   		.string	"\215\206"
+ 863 2096 00       		.string	""
+ 864 2097 958700   		.string	"\225\207"
+ 865 209a 00       		.string	""
+ 866 209b 9C8700   		.string	"\234\207"
+ 867 209e 00       		.string	""
+ 868 209f A48800   		.string	"\244\210"
+ 869 20a2 00       		.string	""
+GAS LISTING /tmp/ccL1hvVp.s 			page 43
+
+
+ 870 20a3 AB8800   		.string	"\253\210"
+ 871 20a6 00       		.string	""
+ 872 20a7 B38800   		.string	"\263\210"
+ 873 20aa 00       		.string	""
+ 874 20ab BA8900   		.string	"\272\211"
+ 875 20ae 00       		.string	""
+ 876 20af C28900   		.string	"\302\211"
+ 877 20b2 00       		.string	""
+ 878 20b3 C98A00   		.string	"\311\212"
+ 879 20b6 00       		.string	""
+ 880 20b7 D18A00   		.string	"\321\212"
+ 881 20ba 00       		.string	""
+ 882 20bb D88A00   		.string	"\330\212"
+ 883 20be 00       		.string	""
+ 884 20bf E08B00   		.string	"\340\213"
+ 885 20c2 00       		.string	""
+ 886 20c3 E78B00   		.string	"\347\213"
+ 887 20c6 00       		.string	""
+ 888 20c7 EF8C00   		.string	"\357\214"
+ 889 20ca 00       		.string	""
+ 890 20cb F68C00   		.string	"\366\214"
+ 891 20ce 00       		.string	""
+ 892 20cf FE8C00   		.string	"\376\214"
+ 893 20d2 00       		.string	""
+ 894 20d3 FF8D00   		.string	"\377\215"
+ 895 20d6 01FF8D00 		.string	"\001\377\215"
+ 896 20da 01FF8E00 		.string	"\001\377\216"
+ 897 20de 01FF8E00 		.string	"\001\377\216"
+ 898 20e2 01FF8E00 		.string	"\001\377\216"
+ 899 20e6 01FF8F00 		.string	"\001\377\217"
+ 900 20ea 01FF8F00 		.string	"\001\377\217"
+ 901 20ee 01FF9000 		.string	"\001\377\220"
+ 902 20f2 01FF9000 		.string	"\001\377\220"
+ 903 20f6 01FF9000 		.string	"\001\377\220"
+ 904 20fa 01FF9100 		.string	"\001\377\221"
+ 905 20fe 01FF9100 		.string	"\001\377\221"
+ 906 2102 01FF9200 		.string	"\001\377\222"
+ 907 2106 01FF9200 		.string	"\001\377\222"
+ 908 210a 01FF9200 		.string	"\001\377\222"
+ 909 210e 01FF9300 		.string	"\001\377\223"
+ 910 2112 01FF9300 		.string	"\001\377\223"
+ 911 2116 01FF9400 		.string	"\001\377\224"
+ 912 211a 01FF9400 		.string	"\001\377\224"
+ 913 211e 01FF9500 		.string	"\001\377\225"
+ 914 2122 01FF9500 		.string	"\001\377\225"
+ 915 2126 01FF9500 		.string	"\001\377\225"
+ 916 212a 01FF9600 		.string	"\001\377\226"
+ 917 212e 01FF9600 		.string	"\001\377\226"
+ 918 2132 01FF9700 		.string	"\001\377\227"
+ 919 2136 01FF9700 		.string	"\001\377\227"
+ 920 213a 01FF9700 		.string	"\001\377\227"
+ 921 213e 01FF9800 		.string	"\001\377\230"
+ 922 2142 01FF9800 		.string	"\001\377\230"
+ 923 2146 01FF9900 		.string	"\001\377\231"
+ 924 214a 01FF9900 		.string	"\001\377\231"
+ 925 214e 01FF9900 		.string	"\001\377\231"
+ 926 2152 01FF9A00 		.string	"\001\377\232"
+GAS LISTING /tmp/ccL1hvVp.s 			page 44
+
+
+ 927 2156 01FF9A00 		.string	"\001\377\232"
+ 928 215a 01FF9B00 		.string	"\001\377\233"
+ 929 215e 01FF9B00 		.string	"\001\377\233"
+ 930 2162 01FF9B00 		.string	"\001\377\233"
+ 931 2166 01FF9C00 		.string	"\001\377\234"
+ 932 216a 01FF9C00 		.string	"\001\377\234"
+ 933 216e 01FF9D00 		.string	"\001\377\235"
+ 934 2172 01FF9D00 		.string	"\001\377\235"
+ 935 2176 01FF9D00 		.string	"\001\377\235"
+ 936 217a 01FF9E00 		.string	"\001\377\236"
+ 937 217e 01FF9E00 		.string	"\001\377\236"
+ 938 2182 01FF9F00 		.string	"\001\377\237"
+ 939 2186 01FF9F00 		.string	"\001\377\237"
+ 940 218a 01FFA000 		.string	"\001\377\240"
+ 941 218e 01FFA000 		.string	"\001\377\240"
+ 942 2192 01FFA000 		.string	"\001\377\240"
+ 943 2196 01FFA100 		.string	"\001\377\241"
+ 944 219a 01FFA100 		.string	"\001\377\241"
+ 945 219e 01FFA200 		.string	"\001\377\242"
+ 946 21a2 01FFA200 		.string	"\001\377\242"
+ 947 21a6 01FFA200 		.string	"\001\377\242"
+ 948 21aa 01FFA300 		.string	"\001\377\243"
+ 949 21ae 01FFA300 		.string	"\001\377\243"
+ 950 21b2 01FFA400 		.string	"\001\377\244"
+ 951 21b6 01FFA400 		.string	"\001\377\244"
+ 952 21ba 01FFA400 		.string	"\001\377\244"
+ 953 21be 01FFA500 		.string	"\001\377\245"
+ 954 21c2 00       		.string	""
+ 955 21c3 FFA500   		.string	"\377\245"
+ 956 21c6 00       		.string	""
+ 957 21c7 FFA600   		.string	"\377\246"
+ 958 21ca 00       		.string	""
+ 959 21cb FFA600   		.string	"\377\246"
+ 960 21ce 00       		.string	""
+ 961 21cf FFA600   		.string	"\377\246"
+ 962 21d2 00       		.string	""
+ 963 21d3 FFA700   		.string	"\377\247"
+ 964 21d6 00       		.string	""
+ 965 21d7 FFA700   		.string	"\377\247"
+ 966 21da 00       		.string	""
+ 967 21db FFA800   		.string	"\377\250"
+ 968 21de 00       		.string	""
+ 969 21df FFA800   		.string	"\377\250"
+ 970 21e2 00       		.string	""
+ 971 21e3 FFA900   		.string	"\377\251"
+ 972 21e6 00       		.string	""
+ 973 21e7 FFA900   		.string	"\377\251"
+ 974 21ea 00       		.string	""
+ 975 21eb FFA900   		.string	"\377\251"
+ 976 21ee 00       		.string	""
+ 977 21ef FFAA00   		.string	"\377\252"
+ 978 21f2 00       		.string	""
+ 979 21f3 FFAA00   		.string	"\377\252"
+ 980 21f6 00       		.string	""
+ 981 21f7 FFAB00   		.string	"\377\253"
+ 982 21fa 00       		.string	""
+ 983 21fb FFAB00   		.string	"\377\253"
+GAS LISTING /tmp/ccL1hvVp.s 			page 45
+
+
+ 984 21fe 00       		.string	""
+ 985 21ff FFAB00   		.string	"\377\253"
+ 986 2202 00       		.string	""
+ 987 2203 FFAC00   		.string	"\377\254"
+ 988 2206 00       		.string	""
+ 989 2207 FFAC00   		.string	"\377\254"
+ 990 220a 00       		.string	""
+ 991 220b FFAD00   		.string	"\377\255"
+ 992 220e 00       		.string	""
+ 993 220f FFAD00   		.string	"\377\255"
+ 994 2212 00       		.string	""
+ 995 2213 FFAE00   		.string	"\377\256"
+ 996 2216 00       		.string	""
+ 997 2217 FFAE00   		.string	"\377\256"
+ 998 221a 00       		.string	""
+ 999 221b FFAE00   		.string	"\377\256"
+ 1000 221e 00       		.string	""
+ 1001 221f FFAF00   		.string	"\377\257"
+ 1002 2222 00       		.string	""
+ 1003 2223 FFAF00   		.string	"\377\257"
+ 1004 2226 00       		.string	""
+ 1005 2227 FFB000   		.string	"\377\260"
+ 1006 222a 00       		.string	""
+ 1007 222b FFB000   		.string	"\377\260"
+ 1008 222e 00       		.string	""
+ 1009 222f FFB000   		.string	"\377\260"
+ 1010 2232 00       		.string	""
+ 1011 2233 FFB100   		.string	"\377\261"
+ 1012 2236 00       		.string	""
+ 1013 2237 FFB100   		.string	"\377\261"
+ 1014 223a 00       		.string	""
+ 1015 223b FFB200   		.string	"\377\262"
+ 1016 223e 00       		.string	""
+ 1017 223f FFB200   		.string	"\377\262"
+ 1018 2242 00       		.string	""
+ 1019 2243 FFB200   		.string	"\377\262"
+ 1020 2246 00       		.string	""
+ 1021 2247 FFB300   		.string	"\377\263"
+ 1022 224a 00       		.string	""
+ 1023 224b FFB30100 		.string	"\377\263\001"
+ 1024 224f FFB30100 		.string	"\377\263\001"
+ 1025 2253 FFB40200 		.string	"\377\264\002"
+ 1026 2257 FFB40201 		.ascii	"\377\264\002\001\377\264\003\001\377\264\003\001\377\265\004"
+ 1026      FFB40301 
+ 1026      FFB40301 
+ 1026      FFB504
+ 1027 2266 01FFB504 		.ascii	"\001\377\265\004\001\377\265\005\002\377\266\006\002\377\266"
+ 1027      01FFB505 
+ 1027      02FFB606 
+ 1027      02FFB6
+ 1028 2275 0602FFB6 		.ascii	"\006\002\377\266\007\002\377\266\007\002\377\267\b\003\377\267"
+ 1028      0702FFB6 
+ 1028      0702FFB7 
+ 1028      0803FFB7 
+ 1029 2285 0903FFB7 		.ascii	"\t\003\377\267\t\003\377\270\n\003\377\270\n\004\377\270\013"
+ 1029      0903FFB8 
+ 1029      0A03FFB8 
+GAS LISTING /tmp/ccL1hvVp.s 			page 46
+
+
+ 1029      0A04FFB8 
+ 1029      0B
+ 1030 2296 04FFB80B 		.ascii	"\004\377\270\013\004\377\271\f\004\377\271\r\004\377\271\r\005"
+ 1030      04FFB90C 
+ 1030      04FFB90D 
+ 1030      04FFB90D 
+ 1030      05
+ 1031 22a7 FFBA0E05 		.ascii	"\377\272\016\005\377\272\016\005\377\272\017\005\377\272\017"
+ 1031      FFBA0E05 
+ 1031      FFBA0F05 
+ 1031      FFBA0F
+ 1032 22b6 06FFBB0F 		.ascii	"\006\377\273\017\006\377\273\020\006\377\273\020\006\377\273"
+ 1032      06FFBB10 
+ 1032      06FFBB10 
+ 1032      06FFBB
+ 1033 22c5 1107FFBC 		.ascii	"\021\007\377\274\021\007\377\274\022\007\377\274\022\007\377"
+ 1033      1107FFBC 
+ 1033      1207FFBC 
+ 1033      1207FF
+ 1034 22d4 BD1308FF 		.ascii	"\275\023\b\377\275\023\b\377\275\023\b\377\275\024\t\377\276"
+ 1034      BD1308FF 
+ 1034      BD1308FF 
+ 1034      BD1409FF 
+ 1034      BE
+ 1035 22e5 1409FFBE 		.ascii	"\024\t\377\276\025\t\377\276\025\t\377\277\025\n\377\277\026"
+ 1035      1509FFBE 
+ 1035      1509FFBF 
+ 1035      150AFFBF 
+ 1035      16
+ 1036 22f6 0AFFBF16 		.ascii	"\n\377\277\026\n\377\277\027\013\377\300\027\013\377\300\027"
+ 1036      0AFFBF17 
+ 1036      0BFFC017 
+ 1036      0BFFC017 
+ 1037 2306 0BFFC018 		.ascii	"\013\377\300\030\013\377\301\030\f\377\301\030\f\377\301\031"
+ 1037      0BFFC118 
+ 1037      0CFFC118 
+ 1037      0CFFC119 
+ 1038 2316 0CFFC119 		.ascii	"\f\377\301\031\f\377\302\031\r\377\302\032\r\377\302\032\r\377"
+ 1038      0CFFC219 
+ 1038      0DFFC21A 
+ 1038      0DFFC21A 
+ 1038      0DFF
+ 1039 2328 C21A0EFF 		.ascii	"\302\032\016\377\303\033\016\377\303\033\016\377\303\034\016"
+ 1039      C31B0EFF 
+ 1039      C31B0EFF 
+ 1039      C31C0E
+ 1040 2337 FFC41C0F 		.ascii	"\377\304\034\017\377\304\034\017\377\304\035\017\377\304\035"
+ 1040      FFC41C0F 
+ 1040      FFC41D0F 
+ 1040      FFC41D
+ 1041 2346 0FFFC51D 		.ascii	"\017\377\305\035\020\377\305\036\020\377\305\036\020\377\306"
+ 1041      10FFC51E 
+ 1041      10FFC51E 
+ 1041      10FFC6
+ 1042 2355 1E10FFC6 		.ascii	"\036\020\377\306\036\021\377\306\037\021\377\306\037\021\377"
+ 1042      1E11FFC6 
+ 1042      1F11FFC6 
+GAS LISTING /tmp/ccL1hvVp.s 			page 47
+
+
+ 1042      1F11FF
+ 1043 2364 C71F11FF 		.ascii	"\307\037\021\377\307 \022\377\307 \022\377\310 \022\377\310!"
+ 1043      C72012FF 
+ 1043      C72012FF 
+ 1043      C82012FF 
+ 1043      C821
+ 1044 2376 12FFC821 		.ascii	"\022\377\310!\023\377\310!\023\377\311\"\023\377\311\"\023\377"
+ 1044      13FFC821 
+ 1044      13FFC922 
+ 1044      13FFC922 
+ 1044      13FF
+ 1045 2388 C92214FF 		.ascii	"\311\"\024\377\312#\024\377\312#\024\377\312#\024\377\312#\024"
+ 1045      CA2314FF 
+ 1045      CA2314FF 
+ 1045      CA2314FF 
+ 1045      CA2314
+ 1046 239b FFCB2415 		.ascii	"\377\313$\025\377\313$\025\377\313$\025\377\313%\025\377\314"
+ 1046      FFCB2415 
+ 1046      FFCB2415 
+ 1046      FFCB2515 
+ 1046      FFCC
+ 1047 23ad 2516FFCC 		.ascii	"%\026\377\314%\026\377\314&\026\377\315&\026\377\315&\027\377"
+ 1047      2516FFCC 
+ 1047      2616FFCD 
+ 1047      2616FFCD 
+ 1047      2617FF
+ 1048 23c0 CD2617FF 		.ascii	"\315&\027\377\315'\027\377\316'\027\377\316'\030\377\316(\030"
+ 1048      CD2717FF 
+ 1048      CE2717FF 
+ 1048      CE2718FF 
+ 1048      CE2818
+ 1049 23d3 FFCF2818 		.ascii	"\377\317(\030\377\317(\030\377\317(\031\377\317)\031\377\320"
+ 1049      FFCF2818 
+ 1049      FFCF2819 
+ 1049      FFCF2919 
+ 1049      FFD0
+ 1050 23e5 2919FFD0 		.ascii	")\031\377\320)\031\377\320*\031\377\321*\032\377\321*\032\377"
+ 1050      2919FFD0 
+ 1050      2A19FFD1 
+ 1050      2A1AFFD1 
+ 1050      2A1AFF
+ 1051 23f8 D12A1AFF 		.ascii	"\321*\032\377\321+\032\377\322+\033\377\322+\033\377\322+\033"
+ 1051      D12B1AFF 
+ 1051      D22B1BFF 
+ 1051      D22B1BFF 
+ 1051      D22B1B
+ 1052 240b FFD32C1B 		.ascii	"\377\323,\033\377\323,\034\377\323,\034\377\323-\034\377\324"
+ 1052      FFD32C1C 
+ 1052      FFD32C1C 
+ 1052      FFD32D1C 
+ 1052      FFD4
+ 1053 241d 2D1CFFD4 		.ascii	"-\034\377\324-\034\377\324-\035\377\325.\035\377\325.\035\377"
+ 1053      2D1CFFD4 
+ 1053      2D1DFFD5 
+ 1053      2E1DFFD5 
+ 1053      2E1DFF
+ 1054 2430 D52E1DFF 		.ascii	"\325.\035\377\325.\036\377\326/\036\377\326/\036\377\326/\036"
+GAS LISTING /tmp/ccL1hvVp.s 			page 48
+
+
+ 1054      D52E1EFF 
+ 1054      D62F1EFF 
+ 1054      D62F1EFF 
+ 1054      D62F1E
+ 1055 2443 FFD6301E 		.ascii	"\377\3260\036\377\3270\037\377\3271\037\377\3271\037\377\327"
+ 1055      FFD7301F 
+ 1055      FFD7311F 
+ 1055      FFD7311F 
+ 1055      FFD7
+ 1056 2455 3220FFD7 		.ascii	"2 \377\3272 \377\3303 \377\3303!\377\3304!\377\3304!\377\330"
+ 1056      3220FFD8 
+ 1056      3320FFD8 
+ 1056      3321FFD8 
+ 1056      3421FFD8 
+ 1057 246d 3522FFD9 		.ascii	"5\"\377\3315\"\377\3316\"\377\3316#\377\3317#\377\3317#\377\332"
+ 1057      3522FFD9 
+ 1057      3622FFD9 
+ 1057      3623FFD9 
+ 1057      3723FFD9 
+ 1058 2485 3724FFDA 		.ascii	"7$\377\3328$\377\3328$\377\3329%\377\3329%\377\333:%\377\333"
+ 1058      3824FFDA 
+ 1058      3824FFDA 
+ 1058      3925FFDA 
+ 1058      3925FFDB 
+ 1059 249d 3A26FFDB 		.ascii	":&\377\333;&\377\333;&\377\333<&\377\334<'\377\334='\377\334"
+ 1059      3B26FFDB 
+ 1059      3B26FFDB 
+ 1059      3C26FFDC 
+ 1059      3C27FFDC 
+ 1060 24b5 3D27FFDC 		.ascii	"='\377\334=(\377\334>(\377\335>(\377\335?)\377\335?)\377\335"
+ 1060      3D28FFDC 
+ 1060      3E28FFDD 
+ 1060      3E28FFDD 
+ 1060      3F29FFDD 
+ 1061 24cd 4029FFDD 		.ascii	"@)\377\335@*\377\335A*\377\336A*\377\336A+\377\336B+\377\336"
+ 1061      402AFFDD 
+ 1061      412AFFDE 
+ 1061      412AFFDE 
+ 1061      412BFFDE 
+ 1062 24e5 422BFFDE 		.ascii	"B+\377\336C,\377\337C,\377\337D,\377\337D-\377\337D-\377\337"
+ 1062      432CFFDF 
+ 1062      432CFFDF 
+ 1062      442CFFDF 
+ 1062      442DFFDF 
+ 1063 24fd 452DFFE0 		.ascii	"E-\377\340E-\377\340F.\377\340F.\377\340G.\377\340G/\377\341"
+ 1063      452DFFE0 
+ 1063      462EFFE0 
+ 1063      462EFFE0 
+ 1063      472EFFE0 
+ 1064 2515 472FFFE1 		.ascii	"G/\377\341H/\377\341H0\377\341I0\377\341I0\377\341I1\377\342"
+ 1064      482FFFE1 
+ 1064      4830FFE1 
+ 1064      4930FFE1 
+ 1064      4930FFE1 
+ 1065 252d 4A31FFE2 		.ascii	"J1\377\342J1\377\342K2\377\342K2\377\342K2\377\343L3\377\343"
+ 1065      4A31FFE2 
+ 1065      4B32FFE2 
+GAS LISTING /tmp/ccL1hvVp.s 			page 49
+
+
+ 1065      4B32FFE2 
+ 1065      4B32FFE3 
+ 1066 2545 4C33FFE3 		.ascii	"L3\377\343M3\377\343M4\377\343M4\377\344N4\377\344N4\377\344"
+ 1066      4D33FFE3 
+ 1066      4D34FFE3 
+ 1066      4D34FFE4 
+ 1066      4E34FFE4 
+ 1067 255d 4F35FFE4 		.ascii	"O5\377\344O5\377\344O5\377\344P6\377\345P6\377\345Q6\377\345"
+ 1067      4F35FFE4 
+ 1067      4F35FFE4 
+ 1067      5036FFE5 
+ 1067      5036FFE5 
+ 1068 2575 5137FFE5 		.ascii	"Q7\377\345Q7\377\345R7\377\346R8\377\346S8\377\346S8\377\346"
+ 1068      5137FFE5 
+ 1068      5237FFE6 
+ 1068      5238FFE6 
+ 1068      5338FFE6 
+ 1069 258d 5339FFE6 		.ascii	"S9\377\346T9\377\347T9\377\347T:\377\347U:\377\347U:\377\347"
+ 1069      5439FFE7 
+ 1069      5439FFE7 
+ 1069      543AFFE7 
+ 1069      553AFFE7 
+ 1070 25a5 563BFFE7 		.ascii	"V;\377\347V;\377\350V;\377\350W<\377\350W<\377\350X<\377\350"
+ 1070      563BFFE8 
+ 1070      563BFFE8 
+ 1070      573CFFE8 
+ 1070      573CFFE8 
+ 1071 25bd 583CFFE9 		.ascii	"X<\377\351X=\377\351Y=\377\351Y=\377\351Y>\377\351Z>\377\351"
+ 1071      583DFFE9 
+ 1071      593DFFE9 
+ 1071      593DFFE9 
+ 1071      593EFFE9 
+ 1072 25d5 5A3EFFEA 		.ascii	"Z>\377\352[?\377\352[?\377\352[?\377\352\\@\377\352\\@\377\353"
+ 1072      5B3FFFEA 
+ 1072      5B3FFFEA 
+ 1072      5B3FFFEA 
+ 1072      5C40FFEA 
+ 1073 25ed 5C40FFEB 		.ascii	"\\@\377\353]A\377\353]A\377\353^A\377\353^B\377\353^B\377\354"
+ 1073      5D41FFEB 
+ 1073      5D41FFEB 
+ 1073      5E41FFEB 
+ 1073      5E42FFEB 
+ 1074 2605 5F42FFEC 		.ascii	"_B\377\354_C\377\354_C\377\354`C\377\354`D\377\355`D\377\355"
+ 1074      5F43FFEC 
+ 1074      5F43FFEC 
+ 1074      6043FFEC 
+ 1074      6044FFED 
+ 1075 261d 6144FFED 		.ascii	"aD\377\355aE\377\355bE\377\355bE\377\355bF\377\356cF\377\356"
+ 1075      6145FFED 
+ 1075      6245FFED 
+ 1075      6245FFED 
+ 1075      6246FFEE 
+ 1076 2635 6346FFEE 		.ascii	"cF\377\356cG\377\356dG\377\356dG\377\356eG\377\357eH\377\357"
+ 1076      6347FFEE 
+ 1076      6447FFEE 
+ 1076      6447FFEE 
+ 1076      6547FFEF 
+GAS LISTING /tmp/ccL1hvVp.s 			page 50
+
+
+ 1077 264d 6548FFEF 		.ascii	"eH\377\357eH\377\357fH\377\357fH\377\357fH\377\357gH\377\357"
+ 1077      6548FFEF 
+ 1077      6648FFEF 
+ 1077      6648FFEF 
+ 1077      6648FFEF 
+ 1078 2665 6748FFEF 		.ascii	"gH\377\357gH\377\360hI\377\360hI\377\360hI\377\360iI\377\360"
+ 1078      6748FFF0 
+ 1078      6849FFF0 
+ 1078      6849FFF0 
+ 1078      6849FFF0 
+ 1079 267d 6949FFF0 		.ascii	"iI\377\360iI\377\360jI\377\360jI\377\360jI\377\361kJ\377\361"
+ 1079      6949FFF0 
+ 1079      6A49FFF0 
+ 1079      6A49FFF0 
+ 1079      6A49FFF1 
+ 1080 2695 6B4AFFF1 		.ascii	"kJ\377\361kJ\377\361lJ\377\361lJ\377\361lJ\377\361mJ\377\361"
+ 1080      6B4AFFF1 
+ 1080      6C4AFFF1 
+ 1080      6C4AFFF1 
+ 1080      6C4AFFF1 
+ 1081 26ad 6D4AFFF1 		.ascii	"mJ\377\361mJ\377\362nK\377\362nK\377\362nK\377\362oK\377\362"
+ 1081      6D4AFFF2 
+ 1081      6E4BFFF2 
+ 1081      6E4BFFF2 
+ 1081      6E4BFFF2 
+ 1082 26c5 6F4BFFF2 		.ascii	"oK\377\362oK\377\362pK\377\362pK\377\362pK\377\362qL\377\363"
+ 1082      6F4BFFF2 
+ 1082      704BFFF2 
+ 1082      704BFFF2 
+ 1082      704BFFF2 
+ 1083 26dd 714CFFF3 		.ascii	"qL\377\363qL\377\363qL\377\363rL\377\363rL\377\363rL\377\363"
+ 1083      714CFFF3 
+ 1083      714CFFF3 
+ 1083      724CFFF3 
+ 1083      724CFFF3 
+ 1084 26f5 734CFFF3 		.ascii	"sL\377\363sM\377\363sM\377\363tM\377\364tM\377\364tM\377\364"
+ 1084      734DFFF3 
+ 1084      734DFFF3 
+ 1084      744DFFF4 
+ 1084      744DFFF4 
+ 1085 270d 754DFFF4 		.ascii	"uM\377\364uM\377\364uM\377\364vN\377\364vN\377\364vN\377\364"
+ 1085      754DFFF4 
+ 1085      754DFFF4 
+ 1085      764EFFF4 
+ 1085      764EFFF4 
+ 1086 2725 774EFFF5 		.ascii	"wN\377\365wN\377\365wN\377\365wN\377\365xN\377\365xO\377\365"
+ 1086      774EFFF5 
+ 1086      774EFFF5 
+ 1086      774EFFF5 
+ 1086      784EFFF5 
+ 1087 273d 784FFFF5 		.ascii	"xO\377\365yO\377\365yO\377\365yO\377\365zO\377\366zO\377\366"
+ 1087      794FFFF5 
+ 1087      794FFFF5 
+ 1087      794FFFF5 
+ 1087      7A4FFFF6 
+ 1088 2755 7A50FFF6 		.ascii	"zP\377\366{P\377\366{P\377\366{P\377\366|P\377\366|P\377\366"
+ 1088      7B50FFF6 
+GAS LISTING /tmp/ccL1hvVp.s 			page 51
+
+
+ 1088      7B50FFF6 
+ 1088      7B50FFF6 
+ 1088      7C50FFF6 
+ 1089 276d 7C50FFF6 		.ascii	"|P\377\366|Q\377\366}Q\377\367}Q\377\367}Q\377\367~Q\377\367"
+ 1089      7C51FFF6 
+ 1089      7D51FFF7 
+ 1089      7D51FFF7 
+ 1089      7D51FFF7 
+ 1090 2785 7E51FFF7 		.ascii	"~Q\377\367~Q\377\367\177Q\377\367\177R\377\367\177R\377\367\200"
+ 1090      7E51FFF7 
+ 1090      7F51FFF7 
+ 1090      7F52FFF7 
+ 1090      7F52FFF7 
+ 1091 279a 52FFF780 		.ascii	"R\377\367\200R\377\370\200R\377\370\200R\377\370\201R\377\370"
+ 1091      52FFF880 
+ 1091      52FFF880 
+ 1091      52FFF881 
+ 1091      52FFF8
+ 1092 27ad 8153FFF8 		.ascii	"\201S\377\370\201S\377\370\202S\377\370\202S\377\370\202S\377"
+ 1092      8153FFF8 
+ 1092      8253FFF8 
+ 1092      8253FFF8 
+ 1092      8253FF
+ 1093 27c0 F88353FF 		.ascii	"\370\203S\377\370\203T\377\371\203T\377\371\203T\377\371\204"
+ 1093      F88354FF 
+ 1093      F98354FF 
+ 1093      F98354FF 
+ 1093      F984
+ 1094 27d2 54FFF984 		.ascii	"T\377\371\204T\377\371\204T\377\371\205T\377\371\205U\377\371"
+ 1094      54FFF984 
+ 1094      54FFF985 
+ 1094      54FFF985 
+ 1094      55FFF9
+ 1095 27e5 8555FFF9 		.ascii	"\205U\377\371\206U\377\371\206U\377\371\206U\377\372\207U\377"
+ 1095      8655FFF9 
+ 1095      8655FFF9 
+ 1095      8655FFFA 
+ 1095      8755FF
+ 1096 27f8 FA8755FF 		.ascii	"\372\207U\377\372\207V\377\372\207V\377\372\210V\377\372\210"
+ 1096      FA8756FF 
+ 1096      FA8756FF 
+ 1096      FA8856FF 
+ 1096      FA88
+ 1097 280a 56FFFA88 		.ascii	"V\377\372\210V\377"
+ 1097      56FF
+ 1098 2810 FA8956FF 		.ascii	"\372\211V\377\372\211W\377\372\211W\377\373\212W\377\373\212"
+ 1098      FA8957FF 
+ 1098      FA8957FF 
+ 1098      FB8A57FF 
+ 1098      FB8A
+ 1099 2822 57FFFB8A 		.ascii	"W\377\373\212W\377\373\212W\377\373\213X\377\373\213X\377\373"
+ 1099      57FFFB8A 
+ 1099      57FFFB8B 
+ 1099      58FFFB8B 
+ 1099      58FFFB
+ 1100 2835 8B58FFFB 		.ascii	"\213X\377\373\214X\377\373\214X\377\373\214X\377\373\215X\377"
+ 1100      8C58FFFB 
+GAS LISTING /tmp/ccL1hvVp.s 			page 52
+
+
+ 1100      8C58FFFB 
+ 1100      8C58FFFB 
+ 1100      8D58FF
+ 1101 2848 FC8D59FF 		.ascii	"\374\215Y\377\374\215Y\377\374\216Y\377\374\216Z\377\374\216"
+ 1101      FC8D59FF 
+ 1101      FC8E59FF 
+ 1101      FC8E5AFF 
+ 1101      FC8E
+ 1102 285a 5AFFFC8F 		.ascii	"Z\377\374\217Z\377\374\217Z\377\374\220[\377\374\220[\377\374"
+ 1102      5AFFFC8F 
+ 1102      5AFFFC90 
+ 1102      5BFFFC90 
+ 1102      5BFFFC
+ 1103 286d 905BFFFC 		.ascii	"\220[\377\374\221\\\377\374\221\\\377\374\222\\\377\374\222\\"
+ 1103      915CFFFC 
+ 1103      915CFFFC 
+ 1103      925CFFFC 
+ 1103      925C
+ 1104 287f FFFC925D 		.ascii	"\377\374\222]\377\374\223]\377\374\223]\377\374\223^\377\374"
+ 1104      FFFC935D 
+ 1104      FFFC935D 
+ 1104      FFFC935E 
+ 1104      FFFC
+ 1105 2891 945EFFFC 		.ascii	"\224^\377\374\224^\377\374\225^\377\374\225_\377\374\225_\377"
+ 1105      945EFFFC 
+ 1105      955EFFFC 
+ 1105      955FFFFC 
+ 1105      955FFF
+ 1106 28a4 FC965FFF 		.ascii	"\374\226_\377\374\226`\377\374\226`\377\374\227`\377\374\227"
+ 1106      FC9660FF 
+ 1106      FC9660FF 
+ 1106      FC9760FF 
+ 1106      FC97
+ 1107 28b6 60FFFC98 		.ascii	"`\377\374\230a\377\374\230a\377\374\230a\377\374\231b\377\374"
+ 1107      61FFFC98 
+ 1107      61FFFC98 
+ 1107      61FFFC99 
+ 1107      62FFFC
+ 1108 28c9 9962FFFC 		.ascii	"\231b\377\374\231b\377\374\232c\377\374\232c\377\374\233c\377"
+ 1108      9962FFFC 
+ 1108      9A63FFFC 
+ 1108      9A63FFFC 
+ 1108      9B63FF
+ 1109 28dc FC9B64FF 		.ascii	"\374\233d\377\374\233d\377\374\234d\377\374\234d\377\374\234"
+ 1109      FC9B64FF 
+ 1109      FC9C64FF 
+ 1109      FC9C64FF 
+ 1109      FC9C
+ 1110 28ee 65FFFC9D 		.ascii	"e\377\374\235e\377\374\235e\377\374\236f\377\374\236f\377\374"
+ 1110      65FFFC9D 
+ 1110      65FFFC9E 
+ 1110      66FFFC9E 
+ 1110      66FFFC
+ 1111 2901 9E66FFFC 		.ascii	"\236f\377\374\237g\377\374\237g\377\374\237g\377\374\240h\377"
+ 1111      9F67FFFC 
+ 1111      9F67FFFC 
+ 1111      9F67FFFC 
+GAS LISTING /tmp/ccL1hvVp.s 			page 53
+
+
+ 1111      A068FF
+ 1112 2914 FCA068FF 		.ascii	"\374\240h\377\374\240h\377\374\241i\377\374\241i\377\374\242"
+ 1112      FCA068FF 
+ 1112      FCA169FF 
+ 1112      FCA169FF 
+ 1112      FCA2
+ 1113 2926 69FFFCA2 		.ascii	"i\377\374\242j\377\374\242j\377\374\243j\377\374\243k\377\374"
+ 1113      6AFFFCA2 
+ 1113      6AFFFCA3 
+ 1113      6AFFFCA3 
+ 1113      6BFFFC
+ 1114 2939 A36BFFFC 		.ascii	"\243k\377\374\244k\377\374\244l\377\374\244l\377\374\245l\377"
+ 1114      A46BFFFC 
+ 1114      A46CFFFC 
+ 1114      A46CFFFC 
+ 1114      A56CFF
+ 1115 294c FCA56DFF 		.ascii	"\374\245m\377\374\245m\377\374\246m\377\374\246n\377\374\247"
+ 1115      FCA56DFF 
+ 1115      FCA66DFF 
+ 1115      FCA66EFF 
+ 1115      FCA7
+ 1116 295e 6EFFFCA7 		.ascii	"n\377\374\247n\377\374\247o\377\374\250o\377\374\250o\377\374"
+ 1116      6EFFFCA7 
+ 1116      6FFFFCA8 
+ 1116      6FFFFCA8 
+ 1116      6FFFFC
+ 1117 2971 A870FFFC 		.ascii	"\250p\377\374\251p\377\374\251p\377\374\251q\377\374\252q\377"
+ 1117      A970FFFC 
+ 1117      A970FFFC 
+ 1117      A971FFFC 
+ 1117      AA71FF
+ 1118 2984 FCAA71FF 		.ascii	"\374\252q\377\374\252r\377\374\253r\377\374\253s\377\374\253"
+ 1118      FCAA72FF 
+ 1118      FCAB72FF 
+ 1118      FCAB73FF 
+ 1118      FCAB
+ 1119 2996 73FFFCAC 		.ascii	"s\377\374\254s\377\374\254t\377\374\255t\377\374\255t\377\374"
+ 1119      73FFFCAC 
+ 1119      74FFFCAD 
+ 1119      74FFFCAD 
+ 1119      74FFFC
+ 1120 29a9 AD75FFFC 		.ascii	"\255u\377\374\256u\377\374\256u\377\374\256v\377\374\257v\377"
+ 1120      AE75FFFC 
+ 1120      AE75FFFC 
+ 1120      AE76FFFC 
+ 1120      AF76FF
+ 1121 29bc FCAF77FF 		.ascii	"\374\257w\377\374\257w\377\374\260w\377\374\260x\377\374\260"
+ 1121      FCAF77FF 
+ 1121      FCB077FF 
+ 1121      FCB078FF 
+ 1121      FCB0
+ 1122 29ce 78FFFCB1 		.ascii	"x\377\374\261x\377\374\261y\377\374\261y\377\374\262y\377\374"
+ 1122      78FFFCB1 
+ 1122      79FFFCB1 
+ 1122      79FFFCB2 
+ 1122      79FFFC
+ 1123 29e1 B27AFFFC 		.ascii	"\262z\377\374\262z\377\374\263{\377\374\263{\377\374\263{\377"
+GAS LISTING /tmp/ccL1hvVp.s 			page 54
+
+
+ 1123      B27AFFFC 
+ 1123      B37BFFFC 
+ 1123      B37BFFFC 
+ 1123      B37BFF
+ 1124 29f4 FCB47CFF 		.ascii	"\374\264|\377\374\264|\377\374\264|\377\374\265}\377\374\265"
+ 1124      FCB47CFF 
+ 1124      FCB47CFF 
+ 1124      FCB57DFF 
+ 1124      FCB5
+ 1125 2a06 7DFFFCB5 		.ascii	"}\377\374\265~\377\374\266~\377\374\266~\377\374\266\177\377"
+ 1125      7EFFFCB6 
+ 1125      7EFFFCB6 
+ 1125      7EFFFCB6 
+ 1125      7FFF
+ 1126 2a18 FCB77FFF 		.ascii	"\374\267\177\377\374\267\200\377\374\267\200\377\374\270\200"
+ 1126      FCB780FF 
+ 1126      FCB780FF 
+ 1126      FCB880
+ 1127 2a27 FFFCB881 		.ascii	"\377\374\270\201\377\374\270\201\377\374\271\202\377\374\271"
+ 1127      FFFCB881 
+ 1127      FFFCB982 
+ 1127      FFFCB9
+ 1128 2a36 82FFFCB9 		.ascii	"\202\377\374\271\202\377\374\272\203\377\374\272\203\377\374"
+ 1128      82FFFCBA 
+ 1128      83FFFCBA 
+ 1128      83FFFC
+ 1129 2a45 BB83FFFC 		.ascii	"\273\203\377\374\273\204\377\374\273\204\377\374\273\204\377"
+ 1129      BB84FFFC 
+ 1129      BB84FFFC 
+ 1129      BB84FF
+ 1130 2a54 FCBB84FF 		.ascii	"\374\273\204\377\374\274\204\377\374\274\205\377\374\274\205"
+ 1130      FCBC84FF 
+ 1130      FCBC85FF 
+ 1130      FCBC85
+ 1131 2a63 FFFCBC85 		.ascii	"\377\374\274\205\377\374\274\205\377\374\275\205\377\374\275"
+ 1131      FFFCBC85 
+ 1131      FFFCBD85 
+ 1131      FFFCBD
+ 1132 2a72 85FFFCBD 		.ascii	"\205\377\374\275\206\377\374\275\206\377\374\275\206\377\374"
+ 1132      86FFFCBD 
+ 1132      86FFFCBD 
+ 1132      86FFFC
+ 1133 2a81 BE86FFFC 		.ascii	"\276\206\377\374\276\206\377\374\276\207\377\374\276\207\377"
+ 1133      BE86FFFC 
+ 1133      BE87FFFC 
+ 1133      BE87FF
+ 1134 2a90 FCBE87FF 		.ascii	"\374\276\207\377\374\277\207\377\374\277\207\377\374\277\210"
+ 1134      FCBF87FF 
+ 1134      FCBF87FF 
+ 1134      FCBF88
+ 1135 2a9f FFFCBF88 		.ascii	"\377\374\277\210\377\374\277\210\377\374\300\210\377\374\300"
+ 1135      FFFCBF88 
+ 1135      FFFCC088 
+ 1135      FFFCC0
+ 1136 2aae 88FFFCC0 		.ascii	"\210\377\374\300\210\377\374\300\211\377\374\300\211\377\374"
+ 1136      88FFFCC0 
+ 1136      89FFFCC0 
+GAS LISTING /tmp/ccL1hvVp.s 			page 55
+
+
+ 1136      89FFFC
+ 1137 2abd C189FFFC 		.ascii	"\301\211\377\374\301\211\377\374\301\211\377\374\301\212\377"
+ 1137      C189FFFC 
+ 1137      C189FFFC 
+ 1137      C18AFF
+ 1138 2acc FCC18AFF 		.ascii	"\374\301\212\377\374\302\212\377\374\302\212\377\374\302\212"
+ 1138      FCC28AFF 
+ 1138      FCC28AFF 
+ 1138      FCC28A
+ 1139 2adb FFFCC28B 		.ascii	"\377\374\302\213\377\374\302\213\377\374\303\213\377\374\303"
+ 1139      FFFCC28B 
+ 1139      FFFCC38B 
+ 1139      FFFCC3
+ 1140 2aea 8BFFFCC3 		.ascii	"\213\377\374\303\213\377\374\303\214\377\374\303\214\377\374"
+ 1140      8BFFFCC3 
+ 1140      8CFFFCC3 
+ 1140      8CFFFC
+ 1141 2af9 C48CFFFC 		.ascii	"\304\214\377\374\304\214\377\374\304\214\377\374\304\215\377"
+ 1141      C48CFFFC 
+ 1141      C48CFFFC 
+ 1141      C48DFF
+ 1142 2b08 FCC48DFF 		.ascii	"\374\304\215\377\374\305\215\377\374\305\215\377\374\305\215"
+ 1142      FCC58DFF 
+ 1142      FCC58DFF 
+ 1142      FCC58D
+ 1143 2b17 FFFCC58D 		.ascii	"\377\374\305\215\377\374\305\216\377\374\305\216\377\374\306"
+ 1143      FFFCC58E 
+ 1143      FFFCC58E 
+ 1143      FFFCC6
+ 1144 2b26 8EFFFCC6 		.ascii	"\216\377\374\306\216\377\374\306\217\377\374\306\217\377\374"
+ 1144      8EFFFCC6 
+ 1144      8FFFFCC6 
+ 1144      8FFFFC
+ 1145 2b35 C68FFFFC 		.ascii	"\306\217\377\374\307\217\377\374\307\217\377\374\307\220\377"
+ 1145      C78FFFFC 
+ 1145      C78FFFFC 
+ 1145      C790FF
+ 1146 2b44 FCC790FF 		.ascii	"\374\307\220\377\374\307\220\377\374\310\220\377\374\310\220"
+ 1146      FCC790FF 
+ 1146      FCC890FF 
+ 1146      FCC890
+ 1147 2b53 FFFCC891 		.ascii	"\377\374\310\221\377\374\310\221\377\374\310\221\377\374\311"
+ 1147      FFFCC891 
+ 1147      FFFCC891 
+ 1147      FFFCC9
+ 1148 2b62 91FFFCC9 		.ascii	"\221\377\374\311\221\377\374\311\222\377\374\311\222\377\374"
+ 1148      91FFFCC9 
+ 1148      92FFFCC9 
+ 1148      92FFFC
+ 1149 2b71 C992FFFC 		.ascii	"\311\222\377\374\312\222\377\374\312\222\377\374\312\223\377"
+ 1149      CA92FFFC 
+ 1149      CA92FFFC 
+ 1149      CA93FF
+ 1150 2b80 FCCA93FF 		.ascii	"\374\312\223\377\374\312\223\377\374\313\223\377\374\313\223"
+ 1150      FCCA93FF 
+ 1150      FCCB93FF 
+ 1150      FCCB93
+GAS LISTING /tmp/ccL1hvVp.s 			page 56
+
+
+ 1151 2b8f FFFCCB94 		.ascii	"\377\374\313\224\377\374\313\224\377\374\313\224\377\374\314"
+ 1151      FFFCCB94 
+ 1151      FFFCCB94 
+ 1151      FFFCCC
+ 1152 2b9e 94FFFCCC 		.ascii	"\224\377\374\314\225\377\374\314\225\377\374\314\225\377\374"
+ 1152      95FFFCCC 
+ 1152      95FFFCCC 
+ 1152      95FFFC
+ 1153 2bad CC95FFFC 		.ascii	"\314\225\377\374\314\225\377\374\315\226\377\374\315\226\377"
+ 1153      CC95FFFC 
+ 1153      CD96FFFC 
+ 1153      CD96FF
+ 1154 2bbc FCCD96FF 		.ascii	"\374\315\226\377\374\315\226\377\374\315\226\377\374\316\227"
+ 1154      FCCD96FF 
+ 1154      FCCD96FF 
+ 1154      FCCE97
+ 1155 2bcb FFFCCE97 		.ascii	"\377\374\316\227\377\374\316\227\377\374\316\227\377\374\316"
+ 1155      FFFCCE97 
+ 1155      FFFCCE97 
+ 1155      FFFCCE
+ 1156 2bda 98FFFCCF 		.ascii	"\230\377\374\317\230\377\374\317\230\377\374\317\230\377\374"
+ 1156      98FFFCCF 
+ 1156      98FFFCCF 
+ 1156      98FFFC
+ 1157 2be9 CF98FFFC 		.ascii	"\317\230\377\374\317\231\377\374\320\231\377\374\320\231\377"
+ 1157      CF99FFFC 
+ 1157      D099FFFC 
+ 1157      D099FF
+ 1158 2bf8 FCD099FF 		.ascii	"\374\320\231\377\374\320\231\377\374\320\232\377\374\320\232"
+ 1158      FCD099FF 
+ 1158      FCD09AFF 
+ 1158      FCD09A
+ 1159 2c07 FFFCD19A 		.ascii	"\377\374\321\232\377\374\321\232\377\374\321\233\377\374\321"
+ 1159      FFFCD19A 
+ 1159      FFFCD19B 
+ 1159      FFFCD1
+ 1160 2c16 9BFFFCD1 		.ascii	"\233\377\374\321\233\377\374\322\233\377\374\322\233\377\374"
+ 1160      9BFFFCD2 
+ 1160      9BFFFCD2 
+ 1160      9BFFFC
+ 1161 2c25 D29CFFFC 		.ascii	"\322\234\377\374\322\234\377\374\322\234\377\374\323\234\377"
+ 1161      D29CFFFC 
+ 1161      D29CFFFC 
+ 1161      D39CFF
+ 1162 2c34 FCD39DFF 		.ascii	"\374\323\235\377\374\323\235\377\374\323\235\377\374\323\235"
+ 1162      FCD39DFF 
+ 1162      FCD39DFF 
+ 1162      FCD39D
+ 1163 2c43 FFFCD49D 		.ascii	"\377\374\324\235\377\375\324\236\377\375\324\236\377\375\324"
+ 1163      FFFDD49E 
+ 1163      FFFDD49E 
+ 1163      FFFDD4
+ 1164 2c52 9EFFFDD4 		.ascii	"\236\377\375\324\237\377\375\324\237\377\375\324\237\377\375"
+ 1164      9FFFFDD4 
+ 1164      9FFFFDD4 
+ 1164      9FFFFD
+ 1165 2c61 D5A0FFFD 		.ascii	"\325\240\377\375\325\240\377\375\325\240\377\375\325\241\377"
+GAS LISTING /tmp/ccL1hvVp.s 			page 57
+
+
+ 1165      D5A0FFFD 
+ 1165      D5A0FFFD 
+ 1165      D5A1FF
+ 1166 2c70 FDD5A1FF 		.ascii	"\375\325\241\377\375\325\241\377\375\326\242\377\375\326\242"
+ 1166      FDD5A1FF 
+ 1166      FDD6A2FF 
+ 1166      FDD6A2
+ 1167 2c7f FFFDD6A2 		.ascii	"\377\375\326\242\377\375\326\243\377\375\326\243\377\375\326"
+ 1167      FFFDD6A3 
+ 1167      FFFDD6A3 
+ 1167      FFFDD6
+ 1168 2c8e A3FFFDD7 		.ascii	"\243\377\375\327\244\377\375\327\244\377\375\327\244\377\375"
+ 1168      A4FFFDD7 
+ 1168      A4FFFDD7 
+ 1168      A4FFFD
+ 1169 2c9d D7A5FFFD 		.ascii	"\327\245\377\375\327\245\377\375\327\245\377\375\327\246\377"
+ 1169      D7A5FFFD 
+ 1169      D7A5FFFD 
+ 1169      D7A6FF
+ 1170 2cac FDD8A6FF 		.ascii	"\375\330\246\377\375\330\246\377\375\330\247\377\375\330\247"
+ 1170      FDD8A6FF 
+ 1170      FDD8A7FF 
+ 1170      FDD8A7
+ 1171 2cbb FFFDD8A7 		.ascii	"\377\375\330\247\377\375\330\250\377\375\331\250\377\375\331"
+ 1171      FFFDD8A8 
+ 1171      FFFDD9A8 
+ 1171      FFFDD9
+ 1172 2cca A8FFFDD9 		.ascii	"\250\377\375\331\250\377\375\331\251\377\375\331\251\377\375"
+ 1172      A8FFFDD9 
+ 1172      A9FFFDD9 
+ 1172      A9FFFD
+ 1173 2cd9 D9A9FFFD 		.ascii	"\331\251\377\375\332\252\377\375\332\252\377\375\332\252\377"
+ 1173      DAAAFFFD 
+ 1173      DAAAFFFD 
+ 1173      DAAAFF
+ 1174 2ce8 FDDAABFF 		.ascii	"\375\332\253\377\375\332\253\377\375\332\253\377\375\332\254"
+ 1174      FDDAABFF 
+ 1174      FDDAABFF 
+ 1174      FDDAAC
+ 1175 2cf7 FFFDDBAC 		.ascii	"\377\375\333\254\377\375\333\254\377\375\333\255\377\375\333"
+ 1175      FFFDDBAC 
+ 1175      FFFDDBAD 
+ 1175      FFFDDB
+ 1176 2d06 ADFFFDDB 		.ascii	"\255\377\375\333\255\377\375\333\256\377\375\334\256\377\375"
+ 1176      ADFFFDDB 
+ 1176      AEFFFDDC 
+ 1176      AEFFFD
+ 1177 2d15 DCAEFFFD 		.ascii	"\334\256\377\375\334\257\377\375\334\257\377\375\334\257\377"
+ 1177      DCAFFFFD 
+ 1177      DCAFFFFD 
+ 1177      DCAFFF
+ 1178 2d24 FDDCB0FF 		.ascii	"\375\334\260\377\375\335\260\377\375\335\260\377\375\335\261"
+ 1178      FDDDB0FF 
+ 1178      FDDDB0FF 
+ 1178      FDDDB1
+ 1179 2d33 FFFDDDB1 		.ascii	"\377\375\335\261\377\375\335\261\377\375\335\262\377\375\335"
+ 1179      FFFDDDB1 
+GAS LISTING /tmp/ccL1hvVp.s 			page 58
+
+
+ 1179      FFFDDDB2 
+ 1179      FFFDDD
+ 1180 2d42 B2FFFDDE 		.ascii	"\262\377\375\336\262\377\375\336\263\377\375\336\263\377\375"
+ 1180      B2FFFDDE 
+ 1180      B3FFFDDE 
+ 1180      B3FFFD
+ 1181 2d51 DEB3FFFD 		.ascii	"\336\263\377\375\336\264\377\375\336\264\377\375\337\264\377"
+ 1181      DEB4FFFD 
+ 1181      DEB4FFFD 
+ 1181      DFB4FF
+ 1182 2d60 FDDFB5FF 		.ascii	"\375\337\265\377\375\337\265\377\375\337\265\377\375\337\266"
+ 1182      FDDFB5FF 
+ 1182      FDDFB5FF 
+ 1182      FDDFB6
+ 1183 2d6f FFFDDFB6 		.ascii	"\377\375\337\266\377\375\337\266\377\375\340\267\377\375\340"
+ 1183      FFFDDFB6 
+ 1183      FFFDE0B7 
+ 1183      FFFDE0
+ 1184 2d7e B7FFFDE0 		.ascii	"\267\377\375\340\267\377\375\340\270\377\375\340\270\377\375"
+ 1184      B7FFFDE0 
+ 1184      B8FFFDE0 
+ 1184      B8FFFD
+ 1185 2d8d E0B8FFFD 		.ascii	"\340\270\377\375\341\271\377\375\341\271\377\375\341\271\377"
+ 1185      E1B9FFFD 
+ 1185      E1B9FFFD 
+ 1185      E1B9FF
+ 1186 2d9c FDE1BAFF 		.ascii	"\375\341\272\377\375\341\272\377\375\341\272\377\375\342\273"
+ 1186      FDE1BAFF 
+ 1186      FDE1BAFF 
+ 1186      FDE2BB
+ 1187 2dab FFFDE2BB 		.ascii	"\377\375\342\273\377\375\342\273\377\375\342\274\377\375\342"
+ 1187      FFFDE2BB 
+ 1187      FFFDE2BC 
+ 1187      FFFDE2
+ 1188 2dba BCFFFDE2 		.ascii	"\274\377\375\342\274\377\375\342\275\377\375\343\275\377\375"
+ 1188      BCFFFDE2 
+ 1188      BDFFFDE3 
+ 1188      BDFFFD
+ 1189 2dc9 E3BDFFFD 		.ascii	"\343\275\377\375\343\276\377\375\343\276\377\375\343\276\377"
+ 1189      E3BEFFFD 
+ 1189      E3BEFFFD 
+ 1189      E3BEFF
+ 1190 2dd8 FDE3BFFF 		.ascii	"\375\343\277\377\375\344\277\377\375\344\277\377\375\344\277"
+ 1190      FDE4BFFF 
+ 1190      FDE4BFFF 
+ 1190      FDE4BF
+ 1191 2de7 FFFDE4C0 		.ascii	"\377\375\344\300\377\375\344\300\377\375\344\300\377\375\344"
+ 1191      FFFDE4C0 
+ 1191      FFFDE4C0 
+ 1191      FFFDE4
+ 1192 2df6 C1FFFDE5 		.ascii	"\301\377\375\345\301\377\375\345\301\377\375\345\302\377\375"
+ 1192      C1FFFDE5 
+ 1192      C1FFFDE5 
+ 1192      C2FFFD
+ 1193 2e05 E5C2FFFD 		.ascii	"\345\302\377\375\345\302\377\375\345\303\377\375\346\303\377"
+ 1193      E5C2FFFD 
+ 1193      E5C3FFFD 
+GAS LISTING /tmp/ccL1hvVp.s 			page 59
+
+
+ 1193      E6C3FF
+ 1194 2e14 FDE6C3FF 		.ascii	"\375\346\303\377\375\346\304\377\375\346\304\377\375\346\304"
+ 1194      FDE6C4FF 
+ 1194      FDE6C4FF 
+ 1194      FDE6C4
+ 1195 2e23 FFFDE6C5 		.ascii	"\377\375\346\305\377\375\346\305\377\375\347\305\377\375\347"
+ 1195      FFFDE6C5 
+ 1195      FFFDE7C5 
+ 1195      FFFDE7
+ 1196 2e32 C6FFFDE7 		.ascii	"\306\377\375\347\306\377\375\347\306\377\375\347\307\377\375"
+ 1196      C6FFFDE7 
+ 1196      C6FFFDE7 
+ 1196      C7FFFD
+ 1197 2e41 E7C7FFFD 		.ascii	"\347\307\377\375\350\307\377\376\350\310\377\376\350\310\377"
+ 1197      E8C7FFFE 
+ 1197      E8C8FFFE 
+ 1197      E8C8FF
+ 1198 2e50 FEE8C8FF 		.ascii	"\376\350\310\377\376\350\311\377\376\350\311\377\376\350\311"
+ 1198      FEE8C9FF 
+ 1198      FEE8C9FF 
+ 1198      FEE8C9
+ 1199 2e5f FFFEE8C9 		.ascii	"\377\376\350\311\377\376\350\312\377\376\351\312\377\376\351"
+ 1199      FFFEE8CA 
+ 1199      FFFEE9CA 
+ 1199      FFFEE9
+ 1200 2e6e CAFFFEE9 		.ascii	"\312\377\376\351\313\377\376\351\313\377\376\351\313\377\376"
+ 1200      CBFFFEE9 
+ 1200      CBFFFEE9 
+ 1200      CBFFFE
+ 1201 2e7d E9CBFFFE 		.ascii	"\351\313\377\376\351\314\377\376\351\314\377\376\351\314\377"
+ 1201      E9CCFFFE 
+ 1201      E9CCFFFE 
+ 1201      E9CCFF
+ 1202 2e8c FEEACDFF 		.ascii	"\376\352\315\377\376\352\315\377\376\352\315\377\376\352\315"
+ 1202      FEEACDFF 
+ 1202      FEEACDFF 
+ 1202      FEEACD
+ 1203 2e9b FFFEEACE 		.ascii	"\377\376\352\316\377\376\352\316\377\376\352\316\377\376\352"
+ 1203      FFFEEACE 
+ 1203      FFFEEACE 
+ 1203      FFFEEA
+ 1204 2eaa CEFFFEEB 		.ascii	"\316\377\376\353\317\377\376\353\317\377\376\353\317\377\376"
+ 1204      CFFFFEEB 
+ 1204      CFFFFEEB 
+ 1204      CFFFFE
+ 1205 2eb9 EBD0FFFE 		.ascii	"\353\320\377\376\353\320\377\376\353\320\377\376\353\320\377"
+ 1205      EBD0FFFE 
+ 1205      EBD0FFFE 
+ 1205      EBD0FF
+ 1206 2ec8 FEEBD1FF 		.ascii	"\376\353\321\377\376\353\321\377\376\354\321\377\376\354\322"
+ 1206      FEEBD1FF 
+ 1206      FEECD1FF 
+ 1206      FEECD2
+ 1207 2ed7 FFFEECD2 		.ascii	"\377\376\354\322\377\376\354\322\377\376\354\322\377\376\354"
+ 1207      FFFEECD2 
+ 1207      FFFEECD2 
+ 1207      FFFEEC
+GAS LISTING /tmp/ccL1hvVp.s 			page 60
+
+
+ 1208 2ee6 D3FFFEEC 		.ascii	"\323\377\376\354\323\377\376\354\323\377\376\355\324\377\376"
+ 1208      D3FFFEEC 
+ 1208      D3FFFEED 
+ 1208      D4FFFE
+ 1209 2ef5 EDD4FFFE 		.ascii	"\355\324\377\376\355\324\377\376\355\324\377\376\355\325\377"
+ 1209      EDD4FFFE 
+ 1209      EDD4FFFE 
+ 1209      EDD5FF
+ 1210 2f04 FEEDD5FF 		.ascii	"\376\355\325\377\376\355\325\377\376\355\325\377\376\355\326"
+ 1210      FEEDD5FF 
+ 1210      FEEDD5FF 
+ 1210      FEEDD6
+ 1211 2f13 FFFEEED6 		.ascii	"\377\376\356\326\377\376\356\326\377\376\356\327\377\376\356"
+ 1211      FFFEEED6 
+ 1211      FFFEEED7 
+ 1211      FFFEEE
+ 1212 2f22 D7FFFEEE 		.ascii	"\327\377\376\356\327\377\376\356\327\377\376\356\330\377\376"
+ 1212      D7FFFEEE 
+ 1212      D7FFFEEE 
+ 1212      D8FFFE
+ 1213 2f31 EED8FFFE 		.ascii	"\356\330\377\376\357\330\377\376\357\331\377\376\357\331\377"
+ 1213      EFD8FFFE 
+ 1213      EFD9FFFE 
+ 1213      EFD9FF
+ 1214 2f40 FEEFD9FF 		.ascii	"\376\357\331\377\376\357\331\377\376\357\332\377\376\357\332"
+ 1214      FEEFD9FF 
+ 1214      FEEFDAFF 
+ 1214      FEEFDA
+ 1215 2f4f FFFEEFDA 		.ascii	"\377\376\357\332\377\376\357\333\377\376\360\333\377\376\360"
+ 1215      FFFEEFDB 
+ 1215      FFFEF0DB 
+ 1215      FFFEF0
+ 1216 2f5e DBFFFEF0 		.ascii	"\333\377\376\360\333\377\376\360\334\377\376\360\334\377\376"
+ 1216      DBFFFEF0 
+ 1216      DCFFFEF0 
+ 1216      DCFFFE
+ 1217 2f6d F0DCFFFE 		.ascii	"\360\334\377\376\360\335\377\376\360\335\377\376\361\335\377"
+ 1217      F0DDFFFE 
+ 1217      F0DDFFFE 
+ 1217      F1DDFF
+ 1218 2f7c FEF1DDFF 		.ascii	"\376\361\335\377\376\361\336\377\376\361\336\377\376\361\336"
+ 1218      FEF1DEFF 
+ 1218      FEF1DEFF 
+ 1218      FEF1DE
+ 1219 2f8b FFFEF1DE 		.ascii	"\377\376\361\336\377\376\361\337\377\376\361\337\377\376\361"
+ 1219      FFFEF1DF 
+ 1219      FFFEF1DF 
+ 1219      FFFEF1
+ 1220 2f9a DFFFFEF2 		.ascii	"\337\377\376\362\340\377\376\362\340\377\376\362\340\377\376"
+ 1220      E0FFFEF2 
+ 1220      E0FFFEF2 
+ 1220      E0FFFE
+ 1221 2fa9 F2E0FFFE 		.ascii	"\362\340\377\376\362\341\377\376\362\341\377\376\362\341\377"
+ 1221      F2E1FFFE 
+ 1221      F2E1FFFE 
+ 1221      F2E1FF
+ 1222 2fb8 FEF2E2FF 		.ascii	"\376\362\342\377\376\363\342\377\376\363\342\377\376\363\342"
+GAS LISTING /tmp/ccL1hvVp.s 			page 61
+
+
+ 1222      FEF3E2FF 
+ 1222      FEF3E2FF 
+ 1222      FEF3E2
+ 1223 2fc7 FFFEF3E3 		.ascii	"\377\376\363\343\377\376\363\343\377\376\363\343\377\376\363"
+ 1223      FFFEF3E3 
+ 1223      FFFEF3E3 
+ 1223      FFFEF3
+ 1224 2fd6 E4FFFEF3 		.ascii	"\344\377\376\363\344\377\376\363\344\377"
+ 1224      E4FFFEF3 
+ 1224      E4FF
+ 1225 2fe0 FEF4E4FF 		.ascii	"\376\364\344\377\376\364\345\377\376\364\345\377\376\364\345"
+ 1225      FEF4E5FF 
+ 1225      FEF4E5FF 
+ 1225      FEF4E5
+ 1226 2fef FFFEF4E6 		.ascii	"\377\376\364\346\377\376\364\346\377\376\364\346\377\376\364"
+ 1226      FFFEF4E6 
+ 1226      FFFEF4E6 
+ 1226      FFFEF4
+ 1227 2ffe E6FFFEF5 		.ascii	"\346\377\376\365\347\377\376\365\347\377\376\365\347\377\376"
+ 1227      E7FFFEF5 
+ 1227      E7FFFEF5 
+ 1227      E7FFFE
+ 1228 300d F5E8FFFE 		.ascii	"\365\350\377\376\365\350\377\376\365\350\377\376\365\350\377"
+ 1228      F5E8FFFE 
+ 1228      F5E8FFFE 
+ 1228      F5E8FF
+ 1229 301c FEF5E9FF 		.ascii	"\376\365\351\377\376\365\351\377\376\366\351\377\376\366\352"
+ 1229      FEF5E9FF 
+ 1229      FEF6E9FF 
+ 1229      FEF6EA
+ 1230 302b FFFEF6EA 		.ascii	"\377\376\366\352\377\376\366\352\377\376\366\352\377\376\366"
+ 1230      FFFEF6EA 
+ 1230      FFFEF6EA 
+ 1230      FFFEF6
+ 1231 303a EBFFFEF6 		.ascii	"\353\377\376\366\353\377\376\366\353\377"
+ 1231      EBFFFEF6 
+ 1231      EBFF
+ 1232              		.globl	heatmap_cs_OrRd_discrete
+ 1233              		.section	.data.rel.local
+ 1234              		.align 8
+ 1235              		.type	heatmap_cs_OrRd_discrete, @object
+ 1236              		.size	heatmap_cs_OrRd_discrete, 8
+ 1237              	heatmap_cs_OrRd_discrete:
+ 1238 0018 00000000 		.quad	discrete
+ 1238      00000000 
+ 1239              		.section	.data.rel.ro.local
+ 1240              		.align 16
+ 1241              		.type	discrete, @object
+ 1242              		.size	discrete, 16
+ 1243              	discrete:
+ 1244 0030 00000000 		.quad	discrete_data
+ 1244      00000000 
+ 1245 0038 0A000000 		.quad	10
+ 1245      00000000 
+ 1246              		.section	.rodata
+ 1247 3044 00000000 		.align 32
+ 1247      00000000 
+GAS LISTING /tmp/ccL1hvVp.s 			page 62
+
+
+ 1247      00000000 
+ 1247      00000000 
+ 1247      00000000 
+ 1248              		.type	discrete_data, @object
+ 1249              		.size	discrete_data, 40
+ 1250              	discrete_data:
+ 1251 3060 00       		.string	""
+ 1252 3061 00       		.string	""
+ 1253 3062 00       		.string	""
+ 1254 3063 00       		.string	""
+ 1255 3064 7F00     		.string	"\177"
+ 1256 3066 00       		.string	""
+ 1257 3067 FFB300   		.string	"\377\263"
+ 1258 306a 00       		.string	""
+ 1259 306b FFD7301F 		.ascii	"\377\3270\037\377\357eH\377\374\215Y\377\375\273\204\377\375"
+ 1259      FFEF6548 
+ 1259      FFFC8D59 
+ 1259      FFFDBB84 
+ 1259      FFFD
+ 1260 307d D49EFFFE 		.ascii	"\324\236\377\376\350\310\377\377\367\354\377"
+ 1260      E8C8FFFF 
+ 1260      F7ECFF
+ 1261              		.text
+ 1262              	.Letext0:
+ 1263              		.file 1 "./heatmap.h"
+ 1264              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1265              		.file 3 "./colorschemes/OrRd.h"
+ 1266              		.file 4 "colorschemes/OrRd.c"
+ 1267              		.section	.debug_info,"",@progbits
+ 1268              	.Ldebug_info0:
+ 1269 0000 E3010000 		.long	0x1e3
+ 1270 0004 0500     		.value	0x5
+ 1271 0006 01       		.byte	0x1
+ 1272 0007 08       		.byte	0x8
+ 1273 0008 00000000 		.long	.Ldebug_abbrev0
+ 1274 000c 0A       		.uleb128 0xa
+ 1275 000d 00000000 		.long	.LASF26
+ 1276 0011 1D       		.byte	0x1d
+ 1277 0012 00000000 		.long	.LASF0
+ 1278 0016 00000000 		.long	.LASF1
+ 1279 001a 00000000 		.long	.Ldebug_line0
+ 1280 001e 01       		.uleb128 0x1
+ 1281 001f 08       		.byte	0x8
+ 1282 0020 05       		.byte	0x5
+ 1283 0021 00000000 		.long	.LASF2
+ 1284 0025 06       		.uleb128 0x6
+ 1285 0026 00000000 		.long	.LASF12
+ 1286 002a 02       		.byte	0x2
+ 1287 002b D6       		.byte	0xd6
+ 1288 002c 17       		.byte	0x17
+ 1289 002d 31000000 		.long	0x31
+ 1290 0031 01       		.uleb128 0x1
+ 1291 0032 08       		.byte	0x8
+ 1292 0033 07       		.byte	0x7
+ 1293 0034 00000000 		.long	.LASF3
+ 1294 0038 0B       		.uleb128 0xb
+ 1295 0039 04       		.byte	0x4
+GAS LISTING /tmp/ccL1hvVp.s 			page 63
+
+
+ 1296 003a 05       		.byte	0x5
+ 1297 003b 696E7400 		.string	"int"
+ 1298 003f 01       		.uleb128 0x1
+ 1299 0040 08       		.byte	0x8
+ 1300 0041 05       		.byte	0x5
+ 1301 0042 00000000 		.long	.LASF4
+ 1302 0046 01       		.uleb128 0x1
+ 1303 0047 10       		.byte	0x10
+ 1304 0048 04       		.byte	0x4
+ 1305 0049 00000000 		.long	.LASF5
+ 1306 004d 01       		.uleb128 0x1
+ 1307 004e 04       		.byte	0x4
+ 1308 004f 04       		.byte	0x4
+ 1309 0050 00000000 		.long	.LASF6
+ 1310 0054 01       		.uleb128 0x1
+ 1311 0055 04       		.byte	0x4
+ 1312 0056 07       		.byte	0x7
+ 1313 0057 00000000 		.long	.LASF7
+ 1314 005b 01       		.uleb128 0x1
+ 1315 005c 02       		.byte	0x2
+ 1316 005d 07       		.byte	0x7
+ 1317 005e 00000000 		.long	.LASF8
+ 1318 0062 0C       		.uleb128 0xc
+ 1319 0063 10       		.byte	0x10
+ 1320 0064 01       		.byte	0x1
+ 1321 0065 BB       		.byte	0xbb
+ 1322 0066 09       		.byte	0x9
+ 1323 0067 84000000 		.long	0x84
+ 1324 006b 07       		.uleb128 0x7
+ 1325 006c 00000000 		.long	.LASF9
+ 1326 0070 BC       		.byte	0xbc
+ 1327 0071 1A       		.byte	0x1a
+ 1328 0072 84000000 		.long	0x84
+ 1329 0076 00       		.byte	0
+ 1330 0077 07       		.uleb128 0x7
+ 1331 0078 00000000 		.long	.LASF10
+ 1332 007c BD       		.byte	0xbd
+ 1333 007d 0C       		.byte	0xc
+ 1334 007e 25000000 		.long	0x25
+ 1335 0082 08       		.byte	0x8
+ 1336 0083 00       		.byte	0
+ 1337 0084 08       		.uleb128 0x8
+ 1338 0085 90000000 		.long	0x90
+ 1339 0089 01       		.uleb128 0x1
+ 1340 008a 01       		.byte	0x1
+ 1341 008b 08       		.byte	0x8
+ 1342 008c 00000000 		.long	.LASF11
+ 1343 0090 03       		.uleb128 0x3
+ 1344 0091 89000000 		.long	0x89
+ 1345 0095 06       		.uleb128 0x6
+ 1346 0096 00000000 		.long	.LASF13
+ 1347 009a 01       		.byte	0x1
+ 1348 009b BE       		.byte	0xbe
+ 1349 009c 03       		.byte	0x3
+ 1350 009d 62000000 		.long	0x62
+ 1351 00a1 03       		.uleb128 0x3
+ 1352 00a2 95000000 		.long	0x95
+GAS LISTING /tmp/ccL1hvVp.s 			page 64
+
+
+ 1353 00a6 08       		.uleb128 0x8
+ 1354 00a7 A1000000 		.long	0xa1
+ 1355 00ab 04       		.uleb128 0x4
+ 1356 00ac 00000000 		.long	.LASF14
+ 1357 00b0 21       		.byte	0x21
+ 1358 00b1 A6000000 		.long	0xa6
+ 1359 00b5 04       		.uleb128 0x4
+ 1360 00b6 00000000 		.long	.LASF15
+ 1361 00ba 23       		.byte	0x23
+ 1362 00bb A6000000 		.long	0xa6
+ 1363 00bf 04       		.uleb128 0x4
+ 1364 00c0 00000000 		.long	.LASF16
+ 1365 00c4 25       		.byte	0x25
+ 1366 00c5 A6000000 		.long	0xa6
+ 1367 00c9 04       		.uleb128 0x4
+ 1368 00ca 00000000 		.long	.LASF17
+ 1369 00ce 28       		.byte	0x28
+ 1370 00cf A6000000 		.long	0xa6
+ 1371 00d3 09       		.uleb128 0x9
+ 1372 00d4 90000000 		.long	0x90
+ 1373 00d8 E3000000 		.long	0xe3
+ 1374 00dc 0D       		.uleb128 0xd
+ 1375 00dd 31000000 		.long	0x31
+ 1376 00e1 27       		.byte	0x27
+ 1377 00e2 00       		.byte	0
+ 1378 00e3 03       		.uleb128 0x3
+ 1379 00e4 D3000000 		.long	0xd3
+ 1380 00e8 02       		.uleb128 0x2
+ 1381 00e9 00000000 		.long	.LASF18
+ 1382 00ed 20       		.byte	0x20
+ 1383 00ee 1C       		.byte	0x1c
+ 1384 00ef E3000000 		.long	0xe3
+ 1385 00f3 09       		.uleb128 0x9
+ 1386 00f4 03       		.byte	0x3
+ 1387 00f5 00000000 		.quad	discrete_data
+ 1387      00000000 
+ 1388 00fd 02       		.uleb128 0x2
+ 1389 00fe 00000000 		.long	.LASF19
+ 1390 0102 23       		.byte	0x23
+ 1391 0103 24       		.byte	0x24
+ 1392 0104 A1000000 		.long	0xa1
+ 1393 0108 09       		.uleb128 0x9
+ 1394 0109 03       		.byte	0x3
+ 1395 010a 00000000 		.quad	discrete
+ 1395      00000000 
+ 1396 0112 05       		.uleb128 0x5
+ 1397 0113 AB000000 		.long	0xab
+ 1398 0117 24       		.byte	0x24
+ 1399 0118 09       		.uleb128 0x9
+ 1400 0119 03       		.byte	0x3
+ 1401 011a 00000000 		.quad	heatmap_cs_OrRd_discrete
+ 1401      00000000 
+ 1402 0122 09       		.uleb128 0x9
+ 1403 0123 90000000 		.long	0x90
+ 1404 0127 33010000 		.long	0x133
+ 1405 012b 0E       		.uleb128 0xe
+ 1406 012c 31000000 		.long	0x31
+GAS LISTING /tmp/ccL1hvVp.s 			page 65
+
+
+ 1407 0130 0310     		.value	0x1003
+ 1408 0132 00       		.byte	0
+ 1409 0133 03       		.uleb128 0x3
+ 1410 0134 22010000 		.long	0x122
+ 1411 0138 02       		.uleb128 0x2
+ 1412 0139 00000000 		.long	.LASF20
+ 1413 013d 26       		.byte	0x26
+ 1414 013e 1C       		.byte	0x1c
+ 1415 013f 33010000 		.long	0x133
+ 1416 0143 09       		.uleb128 0x9
+ 1417 0144 03       		.byte	0x3
+ 1418 0145 00000000 		.quad	soft_data
+ 1418      00000000 
+ 1419 014d 02       		.uleb128 0x2
+ 1420 014e 00000000 		.long	.LASF21
+ 1421 0152 29       		.byte	0x29
+ 1422 0153 24       		.byte	0x24
+ 1423 0154 A1000000 		.long	0xa1
+ 1424 0158 09       		.uleb128 0x9
+ 1425 0159 03       		.byte	0x3
+ 1426 015a 00000000 		.quad	soft
+ 1426      00000000 
+ 1427 0162 05       		.uleb128 0x5
+ 1428 0163 B5000000 		.long	0xb5
+ 1429 0167 2A       		.byte	0x2a
+ 1430 0168 09       		.uleb128 0x9
+ 1431 0169 03       		.byte	0x3
+ 1432 016a 00000000 		.quad	heatmap_cs_OrRd_soft
+ 1432      00000000 
+ 1433 0172 02       		.uleb128 0x2
+ 1434 0173 00000000 		.long	.LASF22
+ 1435 0177 2C       		.byte	0x2c
+ 1436 0178 1C       		.byte	0x1c
+ 1437 0179 33010000 		.long	0x133
+ 1438 017d 09       		.uleb128 0x9
+ 1439 017e 03       		.byte	0x3
+ 1440 017f 00000000 		.quad	mixed_data
+ 1440      00000000 
+ 1441 0187 02       		.uleb128 0x2
+ 1442 0188 00000000 		.long	.LASF23
+ 1443 018c 2F       		.byte	0x2f
+ 1444 018d 24       		.byte	0x24
+ 1445 018e A1000000 		.long	0xa1
+ 1446 0192 09       		.uleb128 0x9
+ 1447 0193 03       		.byte	0x3
+ 1448 0194 00000000 		.quad	mixed
+ 1448      00000000 
+ 1449 019c 05       		.uleb128 0x5
+ 1450 019d BF000000 		.long	0xbf
+ 1451 01a1 30       		.byte	0x30
+ 1452 01a2 09       		.uleb128 0x9
+ 1453 01a3 03       		.byte	0x3
+ 1454 01a4 00000000 		.quad	heatmap_cs_OrRd_mixed
+ 1454      00000000 
+ 1455 01ac 02       		.uleb128 0x2
+ 1456 01ad 00000000 		.long	.LASF24
+ 1457 01b1 32       		.byte	0x32
+GAS LISTING /tmp/ccL1hvVp.s 			page 66
+
+
+ 1458 01b2 1C       		.byte	0x1c
+ 1459 01b3 33010000 		.long	0x133
+ 1460 01b7 09       		.uleb128 0x9
+ 1461 01b8 03       		.byte	0x3
+ 1462 01b9 00000000 		.quad	mixed_exp_data
+ 1462      00000000 
+ 1463 01c1 02       		.uleb128 0x2
+ 1464 01c2 00000000 		.long	.LASF25
+ 1465 01c6 35       		.byte	0x35
+ 1466 01c7 24       		.byte	0x24
+ 1467 01c8 A1000000 		.long	0xa1
+ 1468 01cc 09       		.uleb128 0x9
+ 1469 01cd 03       		.byte	0x3
+ 1470 01ce 00000000 		.quad	mixed_exp
+ 1470      00000000 
+ 1471 01d6 05       		.uleb128 0x5
+ 1472 01d7 C9000000 		.long	0xc9
+ 1473 01db 36       		.byte	0x36
+ 1474 01dc 09       		.uleb128 0x9
+ 1475 01dd 03       		.byte	0x3
+ 1476 01de 00000000 		.quad	heatmap_cs_OrRd_mixed_exp
+ 1476      00000000 
+ 1477 01e6 00       		.byte	0
+ 1478              		.section	.debug_abbrev,"",@progbits
+ 1479              	.Ldebug_abbrev0:
+ 1480 0000 01       		.uleb128 0x1
+ 1481 0001 24       		.uleb128 0x24
+ 1482 0002 00       		.byte	0
+ 1483 0003 0B       		.uleb128 0xb
+ 1484 0004 0B       		.uleb128 0xb
+ 1485 0005 3E       		.uleb128 0x3e
+ 1486 0006 0B       		.uleb128 0xb
+ 1487 0007 03       		.uleb128 0x3
+ 1488 0008 0E       		.uleb128 0xe
+ 1489 0009 00       		.byte	0
+ 1490 000a 00       		.byte	0
+ 1491 000b 02       		.uleb128 0x2
+ 1492 000c 34       		.uleb128 0x34
+ 1493 000d 00       		.byte	0
+ 1494 000e 03       		.uleb128 0x3
+ 1495 000f 0E       		.uleb128 0xe
+ 1496 0010 3A       		.uleb128 0x3a
+ 1497 0011 21       		.uleb128 0x21
+ 1498 0012 04       		.sleb128 4
+ 1499 0013 3B       		.uleb128 0x3b
+ 1500 0014 0B       		.uleb128 0xb
+ 1501 0015 39       		.uleb128 0x39
+ 1502 0016 0B       		.uleb128 0xb
+ 1503 0017 49       		.uleb128 0x49
+ 1504 0018 13       		.uleb128 0x13
+ 1505 0019 02       		.uleb128 0x2
+ 1506 001a 18       		.uleb128 0x18
+ 1507 001b 00       		.byte	0
+ 1508 001c 00       		.byte	0
+ 1509 001d 03       		.uleb128 0x3
+ 1510 001e 26       		.uleb128 0x26
+ 1511 001f 00       		.byte	0
+GAS LISTING /tmp/ccL1hvVp.s 			page 67
+
+
+ 1512 0020 49       		.uleb128 0x49
+ 1513 0021 13       		.uleb128 0x13
+ 1514 0022 00       		.byte	0
+ 1515 0023 00       		.byte	0
+ 1516 0024 04       		.uleb128 0x4
+ 1517 0025 34       		.uleb128 0x34
+ 1518 0026 00       		.byte	0
+ 1519 0027 03       		.uleb128 0x3
+ 1520 0028 0E       		.uleb128 0xe
+ 1521 0029 3A       		.uleb128 0x3a
+ 1522 002a 21       		.uleb128 0x21
+ 1523 002b 03       		.sleb128 3
+ 1524 002c 3B       		.uleb128 0x3b
+ 1525 002d 0B       		.uleb128 0xb
+ 1526 002e 39       		.uleb128 0x39
+ 1527 002f 21       		.uleb128 0x21
+ 1528 0030 25       		.sleb128 37
+ 1529 0031 49       		.uleb128 0x49
+ 1530 0032 13       		.uleb128 0x13
+ 1531 0033 3F       		.uleb128 0x3f
+ 1532 0034 19       		.uleb128 0x19
+ 1533 0035 3C       		.uleb128 0x3c
+ 1534 0036 19       		.uleb128 0x19
+ 1535 0037 00       		.byte	0
+ 1536 0038 00       		.byte	0
+ 1537 0039 05       		.uleb128 0x5
+ 1538 003a 34       		.uleb128 0x34
+ 1539 003b 00       		.byte	0
+ 1540 003c 47       		.uleb128 0x47
+ 1541 003d 13       		.uleb128 0x13
+ 1542 003e 3A       		.uleb128 0x3a
+ 1543 003f 21       		.uleb128 0x21
+ 1544 0040 04       		.sleb128 4
+ 1545 0041 3B       		.uleb128 0x3b
+ 1546 0042 0B       		.uleb128 0xb
+ 1547 0043 39       		.uleb128 0x39
+ 1548 0044 21       		.uleb128 0x21
+ 1549 0045 1E       		.sleb128 30
+ 1550 0046 02       		.uleb128 0x2
+ 1551 0047 18       		.uleb128 0x18
+ 1552 0048 00       		.byte	0
+ 1553 0049 00       		.byte	0
+ 1554 004a 06       		.uleb128 0x6
+ 1555 004b 16       		.uleb128 0x16
+ 1556 004c 00       		.byte	0
+ 1557 004d 03       		.uleb128 0x3
+ 1558 004e 0E       		.uleb128 0xe
+ 1559 004f 3A       		.uleb128 0x3a
+ 1560 0050 0B       		.uleb128 0xb
+ 1561 0051 3B       		.uleb128 0x3b
+ 1562 0052 0B       		.uleb128 0xb
+ 1563 0053 39       		.uleb128 0x39
+ 1564 0054 0B       		.uleb128 0xb
+ 1565 0055 49       		.uleb128 0x49
+ 1566 0056 13       		.uleb128 0x13
+ 1567 0057 00       		.byte	0
+ 1568 0058 00       		.byte	0
+GAS LISTING /tmp/ccL1hvVp.s 			page 68
+
+
+ 1569 0059 07       		.uleb128 0x7
+ 1570 005a 0D       		.uleb128 0xd
+ 1571 005b 00       		.byte	0
+ 1572 005c 03       		.uleb128 0x3
+ 1573 005d 0E       		.uleb128 0xe
+ 1574 005e 3A       		.uleb128 0x3a
+ 1575 005f 21       		.uleb128 0x21
+ 1576 0060 01       		.sleb128 1
+ 1577 0061 3B       		.uleb128 0x3b
+ 1578 0062 0B       		.uleb128 0xb
+ 1579 0063 39       		.uleb128 0x39
+ 1580 0064 0B       		.uleb128 0xb
+ 1581 0065 49       		.uleb128 0x49
+ 1582 0066 13       		.uleb128 0x13
+ 1583 0067 38       		.uleb128 0x38
+ 1584 0068 0B       		.uleb128 0xb
+ 1585 0069 00       		.byte	0
+ 1586 006a 00       		.byte	0
+ 1587 006b 08       		.uleb128 0x8
+ 1588 006c 0F       		.uleb128 0xf
+ 1589 006d 00       		.byte	0
+ 1590 006e 0B       		.uleb128 0xb
+ 1591 006f 21       		.uleb128 0x21
+ 1592 0070 08       		.sleb128 8
+ 1593 0071 49       		.uleb128 0x49
+ 1594 0072 13       		.uleb128 0x13
+ 1595 0073 00       		.byte	0
+ 1596 0074 00       		.byte	0
+ 1597 0075 09       		.uleb128 0x9
+ 1598 0076 01       		.uleb128 0x1
+ 1599 0077 01       		.byte	0x1
+ 1600 0078 49       		.uleb128 0x49
+ 1601 0079 13       		.uleb128 0x13
+ 1602 007a 01       		.uleb128 0x1
+ 1603 007b 13       		.uleb128 0x13
+ 1604 007c 00       		.byte	0
+ 1605 007d 00       		.byte	0
+ 1606 007e 0A       		.uleb128 0xa
+ 1607 007f 11       		.uleb128 0x11
+ 1608 0080 01       		.byte	0x1
+ 1609 0081 25       		.uleb128 0x25
+ 1610 0082 0E       		.uleb128 0xe
+ 1611 0083 13       		.uleb128 0x13
+ 1612 0084 0B       		.uleb128 0xb
+ 1613 0085 03       		.uleb128 0x3
+ 1614 0086 1F       		.uleb128 0x1f
+ 1615 0087 1B       		.uleb128 0x1b
+ 1616 0088 1F       		.uleb128 0x1f
+ 1617 0089 10       		.uleb128 0x10
+ 1618 008a 17       		.uleb128 0x17
+ 1619 008b 00       		.byte	0
+ 1620 008c 00       		.byte	0
+ 1621 008d 0B       		.uleb128 0xb
+ 1622 008e 24       		.uleb128 0x24
+ 1623 008f 00       		.byte	0
+ 1624 0090 0B       		.uleb128 0xb
+ 1625 0091 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccL1hvVp.s 			page 69
+
+
+ 1626 0092 3E       		.uleb128 0x3e
+ 1627 0093 0B       		.uleb128 0xb
+ 1628 0094 03       		.uleb128 0x3
+ 1629 0095 08       		.uleb128 0x8
+ 1630 0096 00       		.byte	0
+ 1631 0097 00       		.byte	0
+ 1632 0098 0C       		.uleb128 0xc
+ 1633 0099 13       		.uleb128 0x13
+ 1634 009a 01       		.byte	0x1
+ 1635 009b 0B       		.uleb128 0xb
+ 1636 009c 0B       		.uleb128 0xb
+ 1637 009d 3A       		.uleb128 0x3a
+ 1638 009e 0B       		.uleb128 0xb
+ 1639 009f 3B       		.uleb128 0x3b
+ 1640 00a0 0B       		.uleb128 0xb
+ 1641 00a1 39       		.uleb128 0x39
+ 1642 00a2 0B       		.uleb128 0xb
+ 1643 00a3 01       		.uleb128 0x1
+ 1644 00a4 13       		.uleb128 0x13
+ 1645 00a5 00       		.byte	0
+ 1646 00a6 00       		.byte	0
+ 1647 00a7 0D       		.uleb128 0xd
+ 1648 00a8 21       		.uleb128 0x21
+ 1649 00a9 00       		.byte	0
+ 1650 00aa 49       		.uleb128 0x49
+ 1651 00ab 13       		.uleb128 0x13
+ 1652 00ac 2F       		.uleb128 0x2f
+ 1653 00ad 0B       		.uleb128 0xb
+ 1654 00ae 00       		.byte	0
+ 1655 00af 00       		.byte	0
+ 1656 00b0 0E       		.uleb128 0xe
+ 1657 00b1 21       		.uleb128 0x21
+ 1658 00b2 00       		.byte	0
+ 1659 00b3 49       		.uleb128 0x49
+ 1660 00b4 13       		.uleb128 0x13
+ 1661 00b5 2F       		.uleb128 0x2f
+ 1662 00b6 05       		.uleb128 0x5
+ 1663 00b7 00       		.byte	0
+ 1664 00b8 00       		.byte	0
+ 1665 00b9 00       		.byte	0
+ 1666              		.section	.debug_aranges,"",@progbits
+ 1667 0000 1C000000 		.long	0x1c
+ 1668 0004 0200     		.value	0x2
+ 1669 0006 00000000 		.long	.Ldebug_info0
+ 1670 000a 08       		.byte	0x8
+ 1671 000b 00       		.byte	0
+ 1672 000c 0000     		.value	0
+ 1673 000e 0000     		.value	0
+ 1674 0010 00000000 		.quad	0
+ 1674      00000000 
+ 1675 0018 00000000 		.quad	0
+ 1675      00000000 
+ 1676              		.section	.debug_line,"",@progbits
+ 1677              	.Ldebug_line0:
+ 1678 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1678      05000800 
+ 1678      49000000 
+GAS LISTING /tmp/ccL1hvVp.s 			page 70
+
+
+ 1678      010101FB 
+ 1678      0E0D0001 
+ 1679              	.LASF20:
+ 1680 0000 736F6674 		.string	"soft_data"
+ 1680      5F646174 
+ 1680      6100
+ 1681              	.LASF12:
+ 1682 000a 73697A65 		.string	"size_t"
+ 1682      5F7400
+ 1683              	.LASF13:
+ 1684 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1684      6D61705F 
+ 1684      636F6C6F 
+ 1684      72736368 
+ 1684      656D655F 
+ 1685              	.LASF17:
+ 1686 0027 68656174 		.string	"heatmap_cs_OrRd_mixed_exp"
+ 1686      6D61705F 
+ 1686      63735F4F 
+ 1686      7252645F 
+ 1686      6D697865 
+ 1687              	.LASF26:
+ 1688 0041 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1688      43313720 
+ 1688      31322E32 
+ 1688      2E30202D 
+ 1688      6D74756E 
+ 1689              	.LASF6:
+ 1690 00a0 666C6F61 		.string	"float"
+ 1690      7400
+ 1691              	.LASF11:
+ 1692 00a6 756E7369 		.string	"unsigned char"
+ 1692      676E6564 
+ 1692      20636861 
+ 1692      7200
+ 1693              	.LASF3:
+ 1694 00b4 6C6F6E67 		.string	"long unsigned int"
+ 1694      20756E73 
+ 1694      69676E65 
+ 1694      6420696E 
+ 1694      7400
+ 1695              	.LASF8:
+ 1696 00c6 73686F72 		.string	"short unsigned int"
+ 1696      7420756E 
+ 1696      7369676E 
+ 1696      65642069 
+ 1696      6E7400
+ 1697              	.LASF25:
+ 1698 00d9 6D697865 		.string	"mixed_exp"
+ 1698      645F6578 
+ 1698      7000
+ 1699              	.LASF23:
+ 1700 00e3 6D697865 		.string	"mixed"
+ 1700      6400
+ 1701              	.LASF16:
+ 1702 00e9 68656174 		.string	"heatmap_cs_OrRd_mixed"
+ 1702      6D61705F 
+GAS LISTING /tmp/ccL1hvVp.s 			page 71
+
+
+ 1702      63735F4F 
+ 1702      7252645F 
+ 1702      6D697865 
+ 1703              	.LASF15:
+ 1704 00ff 68656174 		.string	"heatmap_cs_OrRd_soft"
+ 1704      6D61705F 
+ 1704      63735F4F 
+ 1704      7252645F 
+ 1704      736F6674 
+ 1705              	.LASF7:
+ 1706 0114 756E7369 		.string	"unsigned int"
+ 1706      676E6564 
+ 1706      20696E74 
+ 1706      00
+ 1707              	.LASF19:
+ 1708 0121 64697363 		.string	"discrete"
+ 1708      72657465 
+ 1708      00
+ 1709              	.LASF10:
+ 1710 012a 6E636F6C 		.string	"ncolors"
+ 1710      6F727300 
+ 1711              	.LASF4:
+ 1712 0132 6C6F6E67 		.string	"long long int"
+ 1712      206C6F6E 
+ 1712      6720696E 
+ 1712      7400
+ 1713              	.LASF24:
+ 1714 0140 6D697865 		.string	"mixed_exp_data"
+ 1714      645F6578 
+ 1714      705F6461 
+ 1714      746100
+ 1715              	.LASF22:
+ 1716 014f 6D697865 		.string	"mixed_data"
+ 1716      645F6461 
+ 1716      746100
+ 1717              	.LASF2:
+ 1718 015a 6C6F6E67 		.string	"long int"
+ 1718      20696E74 
+ 1718      00
+ 1719              	.LASF5:
+ 1720 0163 6C6F6E67 		.string	"long double"
+ 1720      20646F75 
+ 1720      626C6500 
+ 1721              	.LASF18:
+ 1722 016f 64697363 		.string	"discrete_data"
+ 1722      72657465 
+ 1722      5F646174 
+ 1722      6100
+ 1723              	.LASF21:
+ 1724 017d 736F6674 		.string	"soft"
+ 1724      00
+ 1725              	.LASF9:
+ 1726 0182 636F6C6F 		.string	"colors"
+ 1726      727300
+ 1727              	.LASF14:
+ 1728 0189 68656174 		.string	"heatmap_cs_OrRd_discrete"
+ 1728      6D61705F 
+GAS LISTING /tmp/ccL1hvVp.s 			page 72
+
+
+ 1728      63735F4F 
+ 1728      7252645F 
+ 1728      64697363 
+ 1729              		.section	.debug_line_str,"MS",@progbits,1
+ 1730              	.LASF1:
+ 1731 0000 2F726F6F 		.string	"/root/repo"
+ 1731      742F7265 
+ 1731      706F00
+ 1732              	.LASF0:
+ 1733 000b 636F6C6F 		.string	"colorschemes/OrRd.c"
+ 1733      72736368 
+ 1733      656D6573 
+ 1733      2F4F7252 
+ 1733      642E6300 
+ 1734              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1735 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1735      742F7265 
+ 1735      706F0063 
+ 1735      6F6C6F72 
+ 1735      73636865 
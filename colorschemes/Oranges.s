@@ -0,0 +1,4033 @@
+GAS LISTING /tmp/ccb9bXR3.s 			page 1
+
+
+   1              		.file	"Oranges.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/Oranges.c"
+   5              		.globl	heatmap_cs_Oranges_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_Oranges_mixed_exp, @object
+   9              		.size	heatmap_cs_Oranges_mixed_exp, 8
+  10              	heatmap_cs_Oranges_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 7E270300 		.string	"~'\003"
+  29 0008 81270418 		.ascii	"\201'\004\030\203(\0041\206)\004J\210*\004c\212+\004|\215,\004"
+  29      83280431 
+  29      8629044A 
+  29      882A0463 
+  29      8A2B047C 
+  30 001f 95973003 		.ascii	"\225\2270\003\256\2311\003\307\2332\003\340\2362\003\371\240"
+  30      AE993103 
+  30      C79B3203 
+  30      E09E3203 
+  30      F9A0
+  31 0031 3303FFA2 		.ascii	"3\003\377\2424\003\377\2445\003\377\2476\002\377\2517\002\377"
+  31      3403FFA4 
+  31      3503FFA7 
+  31      3602FFA9 
+  31      3702FF
+  32 0044 AC3802FF 		.ascii	"\2548\002\377\2579\002\377\262:\002\377\264;\002\377\267<\002"
+  32      AF3902FF 
+  32      B23A02FF 
+  32      B43B02FF 
+  32      B73C02
+  33 0057 FFBA3D02 		.ascii	"\377\272=\002\377\306A\001\377\311B\001\377\314C\001\377\316"
+  33      FFC64101 
+  33      FFC94201 
+  33      FFCC4301 
+  33      FFCE
+  34 0069 4401FFD1 		.ascii	"D\001\377\321E\001\377\323F\001\377\326G\001\377\330G\001\377"
+GAS LISTING /tmp/ccb9bXR3.s 			page 2
+
+
+  34      4501FFD3 
+  34      4601FFD6 
+  34      4701FFD8 
+  34      4701FF
+  35 007c DA4901FF 		.ascii	"\332I\001\377\333K\002\377\334L\002\377\335N\003\377\336O\004"
+  35      DB4B02FF 
+  35      DC4C02FF 
+  35      DD4E03FF 
+  35      DE4F04
+  36 008f FFDF5105 		.ascii	"\377\337Q\005\377\340S\006\377\341T\006\377\347\\\013\377\350"
+  36      FFE05306 
+  36      FFE15406 
+  36      FFE75C0B 
+  36      FFE8
+  37 00a1 5E0CFFE9 		.ascii	"^\f\377\351_\r\377\352`\016\377\354b\016\377\355c\017\377\356"
+  37      5F0DFFEA 
+  37      600EFFEC 
+  37      620EFFED 
+  37      630FFFEE 
+  38 00b5 6410FFEF 		.ascii	"d\020\377\357f\021\377\360g\022\377\360h\022\377\361j\024\377"
+  38      6611FFF0 
+  38      6712FFF0 
+  38      6812FFF1 
+  38      6A14FF
+  39 00c8 F16C16FF 		.ascii	"\361l\026\377\362m\030\377\362o\032\377\363p\034\377\363q\035"
+  39      F26D18FF 
+  39      F26F1AFF 
+  39      F3701CFF 
+  39      F3711D
+  40 00db FFF4731F 		.ascii	"\377\364s\037\377\364t \377\365v\"\377\365w#\377\370\177-\377"
+  40      FFF47420 
+  40      FFF57622 
+  40      FFF57723 
+  40      FFF87F2D 
+  41 00f0 F9812FFF 		.ascii	"\371\201/\377\371\2020\377\371\2031\377\372\2053\377\372\206"
+  41      F98230FF 
+  41      F98331FF 
+  41      FA8533FF 
+  41      FA86
+  42 0102 34FFFB87 		.ascii	"4\377\373\2076\377\373\2107\377\373\2118\377\374\2139\377\374"
+  42      36FFFB88 
+  42      37FFFB89 
+  42      38FFFC8B 
+  42      39FFFC
+  43 0115 8C3BFFFD 		.ascii	"\214;\377\375\215<\377\375\216>\377\375\217?\377\375\220A\377"
+  43      8D3CFFFD 
+  43      8E3EFFFD 
+  43      8F3FFFFD 
+  43      9041FF
+  44 0128 FD9242FF 		.ascii	"\375\222B\377\375\223D\377\375\224E\377\375\225G\377\375\226"
+  44      FD9344FF 
+  44      FD9445FF 
+  44      FD9547FF 
+  44      FD96
+  45 013a 48FFFD97 		.ascii	"H\377\375\227J\377\375\230K\377\375\231L\377\375\232N\377\375"
+  45      4AFFFD98 
+  45      4BFFFD99 
+GAS LISTING /tmp/ccb9bXR3.s 			page 3
+
+
+  45      4CFFFD9A 
+  45      4EFFFD
+  46 014d A159FFFD 		.ascii	"\241Y\377\375\242Z\377\375\243[\377\375\244]\377\375\245^\377"
+  46      A25AFFFD 
+  46      A35BFFFD 
+  46      A45DFFFD 
+  46      A55EFF
+  47 0160 FDA65FFF 		.ascii	"\375\246_\377\375\247a\377\375\250b\377\375\251c\377\375\252"
+  47      FDA761FF 
+  47      FDA862FF 
+  47      FDA963FF 
+  47      FDAA
+  48 0172 65FFFDAA 		.ascii	"e\377\375\252f\377\375\253g\377\375\254h\377\375\255j\377\375"
+  48      66FFFDAB 
+  48      67FFFDAC 
+  48      68FFFDAD 
+  48      6AFFFD
+  49 0185 AE6BFFFD 		.ascii	"\256k\377\375\257l\377\375\260n\377\375\261o\377\375\261p\377"
+  49      AF6CFFFD 
+  49      B06EFFFD 
+  49      B16FFFFD 
+  49      B170FF
+  50 0198 FDB272FF 		.ascii	"\375\262r\377\375\263s\377\375\264t\377\375\265u\377\375\266"
+  50      FDB373FF 
+  50      FDB474FF 
+  50      FDB575FF 
+  50      FDB6
+  51 01aa 77FFFDB6 		.ascii	"w\377\375\266x\377\375\267y\377\375\270z\377\375\271|\377\375"
+  51      78FFFDB7 
+  51      79FFFDB8 
+  51      7AFFFDB9 
+  51      7CFFFD
+  52 01bd BA7DFFFD 		.ascii	"\272}\377\375\272~\377\375\273\177\377\375\303\214\377\375\303"
+  52      BA7EFFFD 
+  52      BB7FFFFD 
+  52      C38CFFFD 
+  52      C3
+  53 01ce 8DFFFDC4 		.ascii	"\215\377\375\304\216\377\375\305\217\377\375\306\220\377\375"
+  53      8EFFFDC5 
+  53      8FFFFDC6 
+  53      90FFFD
+  54 01dd C692FFFD 		.ascii	"\306\222\377\375\307\223\377\375\310\224\377\375\310\225\377"
+  54      C793FFFD 
+  54      C894FFFD 
+  54      C895FF
+  55 01ec FDC996FF 		.ascii	"\375\311\226\377\375\312\227\377\375\312\230\377\375\313\231"
+  55      FDCA97FF 
+  55      FDCA98FF 
+  55      FDCB99
+  56 01fb FFFDCC9B 		.ascii	"\377\375\314\233\377\375\314\234\377\375\315\235\377\375\315"
+  56      FFFDCC9C 
+  56      FFFDCD9D 
+  56      FFFDCD
+  57 020a 9EFFFDCE 		.ascii	"\236\377\375\316\237\377\375\317\240\377\375\317\241\377\375"
+  57      9FFFFDCF 
+  57      A0FFFDCF 
+  57      A1FFFD
+GAS LISTING /tmp/ccb9bXR3.s 			page 4
+
+
+  58 0219 D0A2FFFD 		.ascii	"\320\242\377\375\320\243\377\375\320\243\377\375\321\244\377"
+  58      D0A3FFFD 
+  58      D0A3FFFD 
+  58      D1A4FF
+  59 0228 FDD1A5FF 		.ascii	"\375\321\245\377\375\322\246\377\375\322\246\377\375\322\247"
+  59      FDD2A6FF 
+  59      FDD2A6FF 
+  59      FDD2A7
+  60 0237 FFFDD3A8 		.ascii	"\377\375\323\250\377\375\323\251\377\375\323\251\377\375\324"
+  60      FFFDD3A9 
+  60      FFFDD3A9 
+  60      FFFDD4
+  61 0246 AAFFFDD4 		.ascii	"\252\377\375\324\253\377\375\324\253\377\375\325\254\377\375"
+  61      ABFFFDD4 
+  61      ABFFFDD5 
+  61      ACFFFD
+  62 0255 D5ADFFFD 		.ascii	"\325\255\377\375\325\255\377\375\326\256\377\375\326\257\377"
+  62      D5ADFFFD 
+  62      D6AEFFFD 
+  62      D6AFFF
+  63 0264 FDD6AFFF 		.ascii	"\375\326\257\377\375\327\260\377\375\327\261\377\375\327\261"
+  63      FDD7B0FF 
+  63      FDD7B1FF 
+  63      FDD7B1
+  64 0273 FFFDD8B2 		.ascii	"\377\375\330\262\377\375\330\262\377\375\335\274\377\375\335"
+  64      FFFDD8B2 
+  64      FFFDDDBC 
+  64      FFFDDD
+  65 0282 BCFFFDDD 		.ascii	"\274\377\375\335\275\377\375\336\276\377\375\336\276\377\375"
+  65      BDFFFDDE 
+  65      BEFFFDDE 
+  65      BEFFFD
+  66 0291 DEBFFFFD 		.ascii	"\336\277\377\375\337\277\377\375\337\300\377\375\337\301\377"
+  66      DFBFFFFD 
+  66      DFC0FFFD 
+  66      DFC1FF
+  67 02a0 FDDFC1FF 		.ascii	"\375\337\301\377\375\340\302\377\375\340\302\377\375\340\303"
+  67      FDE0C2FF 
+  67      FDE0C2FF 
+  67      FDE0C3
+  68 02af FFFDE0C3 		.ascii	"\377\375\340\303\377\375\341\304\377\375\341\304\377\375\341"
+  68      FFFDE1C4 
+  68      FFFDE1C4 
+  68      FFFDE1
+  69 02be C5FFFDE1 		.ascii	"\305\377\375\341\305\377\375\342\306\377\375\342\306\377\376"
+  69      C5FFFDE2 
+  69      C6FFFDE2 
+  69      C6FFFE
+  70 02cd E2C7FFFE 		.ascii	"\342\307\377\376\342\307\377\376\343\310\377\376\343\310\377"
+  70      E2C7FFFE 
+  70      E3C8FFFE 
+  70      E3C8FF
+  71 02dc FEE3C9FF 		.ascii	"\376\343\311\377\376\343\311\377\376\344\312\377\376\344\312"
+  71      FEE3C9FF 
+  71      FEE4CAFF 
+  71      FEE4CA
+  72 02eb FFFEE4CB 		.ascii	"\377\376\344\313\377\376\344\313\377\376\345\314\377\376\345"
+GAS LISTING /tmp/ccb9bXR3.s 			page 5
+
+
+  72      FFFEE4CB 
+  72      FFFEE5CC 
+  72      FFFEE5
+  73 02fa CCFFFEE5 		.ascii	"\314\377\376\345\315\377\376\345\315\377\376\345\315\377\376"
+  73      CDFFFEE5 
+  73      CDFFFEE5 
+  73      CDFFFE
+  74 0309 E6CEFFFE 		.ascii	"\346\316\377\376\346\316\377\376\346\316\377\376\346\317\377"
+  74      E6CEFFFE 
+  74      E6CEFFFE 
+  74      E6CFFF
+  75 0318 FEE6CFFF 		.ascii	"\376\346\317\377\376\346\317\377\376\346\317\377\376\347\320"
+  75      FEE6CFFF 
+  75      FEE6CFFF 
+  75      FEE7D0
+  76 0327 FFFEE7D0 		.ascii	"\377\376\347\320\377\376\347\320\377\376\347\320\377\376\347"
+  76      FFFEE7D0 
+  76      FFFEE7D0 
+  76      FFFEE7
+  77 0336 D1FFFEE7 		.ascii	"\321\377\376\347\321\377\376\347\321\377\376\347\321\377\376"
+  77      D1FFFEE7 
+  77      D1FFFEE7 
+  77      D1FFFE
+  78 0345 E8D1FFFE 		.ascii	"\350\321\377\376\350\322\377\376\350\322\377\376\350\322\377"
+  78      E8D2FFFE 
+  78      E8D2FFFE 
+  78      E8D2FF
+  79 0354 FEE8D2FF 		.ascii	"\376\350\322\377\376\350\323\377\376\350\323\377\376\350\323"
+  79      FEE8D3FF 
+  79      FEE8D3FF 
+  79      FEE8D3
+  80 0363 FFFEE9D3 		.ascii	"\377\376\351\323\377\376\351\323\377\376\351\324\377\376\351"
+  80      FFFEE9D3 
+  80      FFFEE9D4 
+  80      FFFEE9
+  81 0372 D4FFFEE9 		.ascii	"\324\377\376\351\324\377\376\351\324\377\376\351\325\377\376"
+  81      D4FFFEE9 
+  81      D4FFFEE9 
+  81      D5FFFE
+  82 0381 E9D5FFFE 		.ascii	"\351\325\377\376\351\325\377\376\351\325\377\376\352\325\377"
+  82      E9D5FFFE 
+  82      E9D5FFFE 
+  82      EAD5FF
+  83 0390 FEEAD5FF 		.ascii	"\376\352\325\377\376\352\326\377\376\352\326\377\376\352\326"
+  83      FEEAD6FF 
+  83      FEEAD6FF 
+  83      FEEAD6
+  84 039f FFFEEAD6 		.ascii	"\377\376\352\326\377\376\352\326\377\376\352\327\377\376\352"
+  84      FFFEEAD6 
+  84      FFFEEAD7 
+  84      FFFEEA
+  85 03ae D7FFFEEA 		.ascii	"\327\377\376\352\327\377\376\353\327\377\376\353\327\377\376"
+  85      D7FFFEEB 
+  85      D7FFFEEB 
+  85      D7FFFE
+  86 03bd EBD7FFFE 		.ascii	"\353\327\377\376\353\330\377\376\353\330\377\376\353\330\377"
+  86      EBD8FFFE 
+GAS LISTING /tmp/ccb9bXR3.s 			page 6
+
+
+  86      EBD8FFFE 
+  86      EBD8FF
+  87 03cc FEEBD8FF 		.ascii	"\376\353\330\377\376\353\330\377\376\353\330\377\376\353\331"
+  87      FEEBD8FF 
+  87      FEEBD8FF 
+  87      FEEBD9
+  88 03db FFFEEBD9 		.ascii	"\377\376\353\331\377\376\353\331\377\376\357\337\377\376\357"
+  88      FFFEEBD9 
+  88      FFFEEFDF 
+  88      FFFEEF
+  89 03ea DFFFFEEF 		.ascii	"\337\377\376\357\337\377\376\357\337\377\376\357\337\377\376"
+  89      DFFFFEEF 
+  89      DFFFFEEF 
+  89      DFFFFE
+  90 03f9 EFE0FFFE 		.ascii	"\357\340\377\376\357\340\377\376\357\340\377\376\357\340\377"
+  90      EFE0FFFE 
+  90      EFE0FFFE 
+  90      EFE0FF
+  91 0408 FEEFE0FF 		.ascii	"\376\357\340\377\376\357\340\377\376\357\340\377\376\357\341"
+  91      FEEFE0FF 
+  91      FEEFE0FF 
+  91      FEEFE1
+  92 0417 FFFEEFE1 		.ascii	"\377\376\357\341\377\376\360\341\377\376\360\341\377\376\360"
+  92      FFFEF0E1 
+  92      FFFEF0E1 
+  92      FFFEF0
+  93 0426 E1FFFEF0 		.ascii	"\341\377\376\360\341\377\376\360\341\377\376\360\341\377\376"
+  93      E1FFFEF0 
+  93      E1FFFEF0 
+  93      E1FFFE
+  94 0435 F0E2FFFE 		.ascii	"\360\342\377\376\360\342\377\376\360\342\377\376\360\342\377"
+  94      F0E2FFFE 
+  94      F0E2FFFE 
+  94      F0E2FF
+  95 0444 FEF0E2FF 		.ascii	"\376\360\342\377\376\360\342\377\376\360\342\377\376\360\342"
+  95      FEF0E2FF 
+  95      FEF0E2FF 
+  95      FEF0E2
+  96 0453 FFFEF0E2 		.ascii	"\377\376\360\342\377\376\360\343\377\376\360\343\377\376\361"
+  96      FFFEF0E3 
+  96      FFFEF0E3 
+  96      FFFEF1
+  97 0462 E3FFFEF1 		.ascii	"\343\377\376\361\343\377\376\361\343\377\376\361\343\377\376"
+  97      E3FFFEF1 
+  97      E3FFFEF1 
+  97      E3FFFE
+  98 0471 F1E3FFFE 		.ascii	"\361\343\377\376\361\343\377\376\361\343\377\376\361\343\377"
+  98      F1E3FFFE 
+  98      F1E3FFFE 
+  98      F1E3FF
+  99 0480 FEF1E4FF 		.ascii	"\376\361\344\377\376\361\344\377\376\361\344\377\376\361\344"
+  99      FEF1E4FF 
+  99      FEF1E4FF 
+  99      FEF1E4
+ 100 048f FFFEF1E4 		.ascii	"\377\376\361\344\377\376\361\344\377\376\361\344\377\376\361"
+ 100      FFFEF1E4 
+ 100      FFFEF1E4 
+GAS LISTING /tmp/ccb9bXR3.s 			page 7
+
+
+ 100      FFFEF1
+ 101 049e E4FFFEF1 		.ascii	"\344\377\376\361\344\377\376\361\344\377\376\361\344\377\376"
+ 101      E4FFFEF1 
+ 101      E4FFFEF1 
+ 101      E4FFFE
+ 102 04ad F1E4FFFE 		.ascii	"\361\344\377\376\361\345\377\376\362\345\377\376\362\345\377"
+ 102      F1E5FFFE 
+ 102      F2E5FFFE 
+ 102      F2E5FF
+ 103 04bc FEF2E5FF 		.ascii	"\376\362\345\377\376\362\345\377\376\362\345\377\376\362\345"
+ 103      FEF2E5FF 
+ 103      FEF2E5FF 
+ 103      FEF2E5
+ 104 04cb FFFEF2E5 		.ascii	"\377\376\362\345\377\376\362\345\377\376\362\345\377\376\362"
+ 104      FFFEF2E5 
+ 104      FFFEF2E5 
+ 104      FFFEF2
+ 105 04da E5FFFEF2 		.ascii	"\345\377\376\362\345\377\376\362\345\377\376\362\346\377\376"
+ 105      E5FFFEF2 
+ 105      E5FFFEF2 
+ 105      E6FFFE
+ 106 04e9 F2E6FFFE 		.ascii	"\362\346\377\376\362\346\377\376\362\346\377\376\362\346\377"
+ 106      F2E6FFFE 
+ 106      F2E6FFFE 
+ 106      F2E6FF
+ 107 04f8 FEF2E6FF 		.ascii	"\376\362\346\377\376\362\346\377\376\362\346\377\376\362\346"
+ 107      FEF2E6FF 
+ 107      FEF2E6FF 
+ 107      FEF2E6
+ 108 0507 FFFEF2E6 		.ascii	"\377\376\362\346\377\376\362\346\377\376\362\346\377\376\362"
+ 108      FFFEF2E6 
+ 108      FFFEF2E6 
+ 108      FFFEF2
+ 109 0516 E6FFFEF2 		.ascii	"\346\377\376\362\346\377\376\362\346\377\376\362\346\377\376"
+ 109      E6FFFEF2 
+ 109      E6FFFEF2 
+ 109      E6FFFE
+ 110 0525 F2E7FFFE 		.ascii	"\362\347\377\376\363\347\377\376\363\347\377\376\363\347\377"
+ 110      F3E7FFFE 
+ 110      F3E7FFFE 
+ 110      F3E7FF
+ 111 0534 FEF3E7FF 		.ascii	"\376\363\347\377\376\363\347\377\376\363\347\377\376\363\347"
+ 111      FEF3E7FF 
+ 111      FEF3E7FF 
+ 111      FEF3E7
+ 112 0543 FFFEF3E7 		.ascii	"\377\376\363\347\377\376\363\347\377\376\363\347\377\376\363"
+ 112      FFFEF3E7 
+ 112      FFFEF3E7 
+ 112      FFFEF3
+ 113 0552 E7FFFEF3 		.ascii	"\347\377\376\363\347\377\376\363\347\377\376\363\347\377\376"
+ 113      E7FFFEF3 
+ 113      E7FFFEF3 
+ 113      E7FFFE
+ 114 0561 F3E7FFFE 		.ascii	"\363\347\377\376\363\347\377\376\363\347\377\376\363\347\377"
+ 114      F3E7FFFE 
+ 114      F3E7FFFE 
+ 114      F3E7FF
+GAS LISTING /tmp/ccb9bXR3.s 			page 8
+
+
+ 115 0570 FEF3E8FF 		.ascii	"\376\363\350\377\376\363\350\377\376\363\350\377\376\363\350"
+ 115      FEF3E8FF 
+ 115      FEF3E8FF 
+ 115      FEF3E8
+ 116 057f FFFEF3E8 		.ascii	"\377\376\363\350\377\376\363\350\377\376\363\350\377\376\363"
+ 116      FFFEF3E8 
+ 116      FFFEF3E8 
+ 116      FFFEF3
+ 117 058e E8FFFEF3 		.ascii	"\350\377\376\363\350\377\376\363\350\377\376\363\350\377\376"
+ 117      E8FFFEF3 
+ 117      E8FFFEF3 
+ 117      E8FFFE
+ 118 059d F3E8FFFE 		.ascii	"\363\350\377\376\363\350\377\376\363\350\377\376\363\350\377"
+ 118      F3E8FFFE 
+ 118      F3E8FFFE 
+ 118      F3E8FF
+ 119 05ac FEF3E8FF 		.ascii	"\376\363\350\377\376\363\350\377\376\363\350\377\376\363\350"
+ 119      FEF3E8FF 
+ 119      FEF3E8FF 
+ 119      FEF3E8
+ 120 05bb FFFEF3E8 		.ascii	"\377\376\363\350\377\376\363\350\377\376\363\350\377\376\363"
+ 120      FFFEF3E8 
+ 120      FFFEF3E8 
+ 120      FFFEF3
+ 121 05ca E8FFFEF3 		.ascii	"\350\377\376\363\350\377\376\363\350\377\376\363\350\377\376"
+ 121      E8FFFEF3 
+ 121      E8FFFEF3 
+ 121      E8FFFE
+ 122 05d9 F3E8FFFE 		.ascii	"\363\350\377\376\363\351\377\376\363\351\377\376\364\351\377"
+ 122      F3E9FFFE 
+ 122      F3E9FFFE 
+ 122      F4E9FF
+ 123 05e8 FEF4E9FF 		.ascii	"\376\364\351\377\376\364\351\377\376\364\351\377\376\364\351"
+ 123      FEF4E9FF 
+ 123      FEF4E9FF 
+ 123      FEF4E9
+ 124 05f7 FFFEF4E9 		.ascii	"\377\376\364\351\377\376\364\351\377\376\364\351\377\376\364"
+ 124      FFFEF4E9 
+ 124      FFFEF4E9 
+ 124      FFFEF4
+ 125 0606 E9FFFEF4 		.ascii	"\351\377\376\364\351\377\376\364\351\377\376\364\351\377\376"
+ 125      E9FFFEF4 
+ 125      E9FFFEF4 
+ 125      E9FFFE
+ 126 0615 F4E9FFFE 		.ascii	"\364\351\377\376\364\351\377\376\364\351\377\376\364\351\377"
+ 126      F4E9FFFE 
+ 126      F4E9FFFE 
+ 126      F4E9FF
+ 127 0624 FEF4E9FF 		.ascii	"\376\364\351\377\376\364\351\377\376\364\351\377\376\364\351"
+ 127      FEF4E9FF 
+ 127      FEF4E9FF 
+ 127      FEF4E9
+ 128 0633 FFFEF4E9 		.ascii	"\377\376\364\351\377\376\364\351\377\376\364\351\377\376\364"
+ 128      FFFEF4E9 
+ 128      FFFEF4E9 
+ 128      FFFEF4
+ 129 0642 E9FFFEF4 		.ascii	"\351\377\376\364\351\377\376\364\351\377\376\364\351\377\376"
+GAS LISTING /tmp/ccb9bXR3.s 			page 9
+
+
+ 129      E9FFFEF4 
+ 129      E9FFFEF4 
+ 129      E9FFFE
+ 130 0651 F4E9FFFE 		.ascii	"\364\351\377\376\364\351\377\376\364\351\377\376\364\351\377"
+ 130      F4E9FFFE 
+ 130      F4E9FFFE 
+ 130      F4E9FF
+ 131 0660 FEF4E9FF 		.ascii	"\376\364\351\377\376\364\351\377\376\364\351\377\376\364\351"
+ 131      FEF4E9FF 
+ 131      FEF4E9FF 
+ 131      FEF4E9
+ 132 066f FFFEF4E9 		.ascii	"\377\376\364\351\377\376\364\351\377\376\364\351\377\376\364"
+ 132      FFFEF4E9 
+ 132      FFFEF4E9 
+ 132      FFFEF4
+ 133 067e E9FFFEF4 		.ascii	"\351\377\376\364\351\377\376\364\351\377\376\364\351\377\376"
+ 133      E9FFFEF4 
+ 133      E9FFFEF4 
+ 133      E9FFFE
+ 134 068d F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 134      F4EAFFFE 
+ 134      F4EAFFFE 
+ 134      F4EAFF
+ 135 069c FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 135      FEF4EAFF 
+ 135      FEF4EAFF 
+ 135      FEF4EA
+ 136 06ab FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 136      FFFEF4EA 
+ 136      FFFEF4EA 
+ 136      FFFEF4
+ 137 06ba EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 137      EAFFFEF4 
+ 137      EAFFFEF4 
+ 137      EAFFFE
+ 138 06c9 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 138      F4EAFFFE 
+ 138      F4EAFFFE 
+ 138      F4EAFF
+ 139 06d8 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 139      FEF4EAFF 
+ 139      FEF4EAFF 
+ 139      FEF4EA
+ 140 06e7 FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 140      FFFEF4EA 
+ 140      FFFEF4EA 
+ 140      FFFEF4
+ 141 06f6 EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 141      EAFFFEF4 
+ 141      EAFFFEF4 
+ 141      EAFFFE
+ 142 0705 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 142      F4EAFFFE 
+ 142      F4EAFFFE 
+ 142      F4EAFF
+ 143 0714 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 143      FEF4EAFF 
+GAS LISTING /tmp/ccb9bXR3.s 			page 10
+
+
+ 143      FEF4EAFF 
+ 143      FEF4EA
+ 144 0723 FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 144      FFFEF4EA 
+ 144      FFFEF4EA 
+ 144      FFFEF4
+ 145 0732 EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 145      EAFFFEF4 
+ 145      EAFFFEF4 
+ 145      EAFFFE
+ 146 0741 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 146      F4EAFFFE 
+ 146      F4EAFFFE 
+ 146      F4EAFF
+ 147 0750 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 147      FEF4EAFF 
+ 147      FEF4EAFF 
+ 147      FEF4EA
+ 148 075f FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 148      FFFEF4EA 
+ 148      FFFEF4EA 
+ 148      FFFEF4
+ 149 076e EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 149      EAFFFEF4 
+ 149      EAFFFEF4 
+ 149      EAFFFE
+ 150 077d F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 150      F4EAFFFE 
+ 150      F4EAFFFE 
+ 150      F4EAFF
+ 151 078c FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 151      FEF4EAFF 
+ 151      FEF4EAFF 
+ 151      FEF4EA
+ 152 079b FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 152      FFFEF4EA 
+ 152      FFFEF4EA 
+ 152      FFFEF4
+ 153 07aa EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 153      EAFFFEF4 
+ 153      EAFFFEF4 
+ 153      EAFFFE
+ 154 07b9 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 154      F4EAFFFE 
+ 154      F4EAFFFE 
+ 154      F4EAFF
+ 155 07c8 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377"
+ 155      FEF4EAFF 
+ 156 07d0 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 156      FEF4EAFF 
+ 156      FEF4EAFF 
+ 156      FEF4EA
+ 157 07df FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 157      FFFEF4EA 
+ 157      FFFEF4EA 
+ 157      FFFEF4
+ 158 07ee EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+GAS LISTING /tmp/ccb9bXR3.s 			page 11
+
+
+ 158      EAFFFEF4 
+ 158      EAFFFEF4 
+ 158      EAFFFE
+ 159 07fd F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 159      F4EAFFFE 
+ 159      F4EAFFFE 
+ 159      F4EAFF
+ 160 080c FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 160      FEF4EAFF 
+ 160      FEF4EAFF 
+ 160      FEF4EA
+ 161 081b FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 161      FFFEF4EA 
+ 161      FFFEF4EA 
+ 161      FFFEF4
+ 162 082a EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 162      EAFFFEF4 
+ 162      EAFFFEF4 
+ 162      EAFFFE
+ 163 0839 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 163      F4EAFFFE 
+ 163      F4EAFFFE 
+ 163      F4EAFF
+ 164 0848 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 164      FEF4EAFF 
+ 164      FEF4EAFF 
+ 164      FEF4EA
+ 165 0857 FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 165      FFFEF4EA 
+ 165      FFFEF4EA 
+ 165      FFFEF4
+ 166 0866 EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 166      EAFFFEF4 
+ 166      EAFFFEF4 
+ 166      EAFFFE
+ 167 0875 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 167      F4EAFFFE 
+ 167      F4EAFFFE 
+ 167      F4EAFF
+ 168 0884 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 168      FEF4EAFF 
+ 168      FEF4EAFF 
+ 168      FEF4EA
+ 169 0893 FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 169      FFFEF4EA 
+ 169      FFFEF4EA 
+ 169      FFFEF4
+ 170 08a2 EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 170      EAFFFEF4 
+ 170      EAFFFEF4 
+ 170      EAFFFE
+ 171 08b1 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 171      F4EAFFFE 
+ 171      F4EAFFFE 
+ 171      F4EAFF
+ 172 08c0 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 172      FEF4EAFF 
+GAS LISTING /tmp/ccb9bXR3.s 			page 12
+
+
+ 172      FEF4EAFF 
+ 172      FEF4EA
+ 173 08cf FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 173      FFFEF4EA 
+ 173      FFFEF4EA 
+ 173      FFFEF4
+ 174 08de EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 174      EAFFFEF4 
+ 174      EAFFFEF4 
+ 174      EAFFFE
+ 175 08ed F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 175      F4EAFFFE 
+ 175      F4EAFFFE 
+ 175      F4EAFF
+ 176 08fc FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 176      FEF4EAFF 
+ 176      FEF4EAFF 
+ 176      FEF4EA
+ 177 090b FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 177      FFFEF4EA 
+ 177      FFFEF4EA 
+ 177      FFFEF4
+ 178 091a EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 178      EAFFFEF4 
+ 178      EAFFFEF4 
+ 178      EAFFFE
+ 179 0929 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 179      F4EAFFFE 
+ 179      F4EAFFFE 
+ 179      F4EAFF
+ 180 0938 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 180      FEF4EAFF 
+ 180      FEF4EAFF 
+ 180      FEF4EA
+ 181 0947 FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 181      FFFEF4EA 
+ 181      FFFEF4EA 
+ 181      FFFEF4
+ 182 0956 EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 182      EAFFFEF4 
+ 182      EAFFFEF4 
+ 182      EAFFFE
+ 183 0965 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 183      F4EAFFFE 
+ 183      F4EAFFFE 
+ 183      F4EAFF
+ 184 0974 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 184      FEF4EAFF 
+ 184      FEF4EAFF 
+ 184      FEF4EA
+ 185 0983 FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 185      FFFEF4EA 
+ 185      FFFEF4EA 
+ 185      FFFEF4
+ 186 0992 EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 186      EAFFFEF4 
+ 186      EAFFFEF4 
+GAS LISTING /tmp/ccb9bXR3.s 			page 13
+
+
+ 186      EAFFFE
+ 187 09a1 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 187      F4EAFFFE 
+ 187      F4EAFFFE 
+ 187      F4EAFF
+ 188 09b0 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 188      FEF4EAFF 
+ 188      FEF4EAFF 
+ 188      FEF4EA
+ 189 09bf FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 189      FFFEF4EA 
+ 189      FFFEF4EA 
+ 189      FFFEF4
+ 190 09ce EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 190      EAFFFEF4 
+ 190      EAFFFEF4 
+ 190      EAFFFE
+ 191 09dd F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 191      F4EAFFFE 
+ 191      F4EAFFFE 
+ 191      F4EAFF
+ 192 09ec FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 192      FEF4EAFF 
+ 192      FEF4EAFF 
+ 192      FEF4EA
+ 193 09fb FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 193      FFFEF4EA 
+ 193      FFFEF4EA 
+ 193      FFFEF4
+ 194 0a0a EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 194      EAFFFEF4 
+ 194      EAFFFEF4 
+ 194      EAFFFE
+ 195 0a19 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 195      F4EAFFFE 
+ 195      F4EAFFFE 
+ 195      F4EAFF
+ 196 0a28 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 196      FEF4EAFF 
+ 196      FEF4EAFF 
+ 196      FEF4EA
+ 197 0a37 FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 197      FFFEF4EA 
+ 197      FFFEF4EA 
+ 197      FFFEF4
+ 198 0a46 EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 198      EAFFFEF4 
+ 198      EAFFFEF4 
+ 198      EAFFFE
+ 199 0a55 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 199      F4EAFFFE 
+ 199      F4EAFFFE 
+ 199      F4EAFF
+ 200 0a64 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 200      FEF4EAFF 
+ 200      FEF4EAFF 
+ 200      FEF4EA
+GAS LISTING /tmp/ccb9bXR3.s 			page 14
+
+
+ 201 0a73 FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 201      FFFEF4EA 
+ 201      FFFEF4EA 
+ 201      FFFEF4
+ 202 0a82 EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 202      EAFFFEF4 
+ 202      EAFFFEF4 
+ 202      EAFFFE
+ 203 0a91 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 203      F4EAFFFE 
+ 203      F4EAFFFE 
+ 203      F4EAFF
+ 204 0aa0 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 204      FEF4EAFF 
+ 204      FEF4EAFF 
+ 204      FEF4EA
+ 205 0aaf FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 205      FFFEF4EA 
+ 205      FFFEF4EA 
+ 205      FFFEF4
+ 206 0abe EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 206      EAFFFEF4 
+ 206      EAFFFEF4 
+ 206      EAFFFE
+ 207 0acd F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 207      F4EAFFFE 
+ 207      F4EAFFFE 
+ 207      F4EAFF
+ 208 0adc FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 208      FEF4EAFF 
+ 208      FEF4EAFF 
+ 208      FEF4EA
+ 209 0aeb FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 209      FFFEF4EA 
+ 209      FFFEF4EA 
+ 209      FFFEF4
+ 210 0afa EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 210      EAFFFEF4 
+ 210      EAFFFEF4 
+ 210      EAFFFE
+ 211 0b09 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 211      F4EAFFFE 
+ 211      F4EAFFFE 
+ 211      F4EAFF
+ 212 0b18 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 212      FEF4EAFF 
+ 212      FEF4EAFF 
+ 212      FEF4EA
+ 213 0b27 FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 213      FFFEF4EA 
+ 213      FFFEF4EA 
+ 213      FFFEF4
+ 214 0b36 EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 214      EAFFFEF4 
+ 214      EAFFFEF4 
+ 214      EAFFFE
+ 215 0b45 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+GAS LISTING /tmp/ccb9bXR3.s 			page 15
+
+
+ 215      F4EAFFFE 
+ 215      F4EAFFFE 
+ 215      F4EAFF
+ 216 0b54 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 216      FEF4EAFF 
+ 216      FEF4EAFF 
+ 216      FEF4EA
+ 217 0b63 FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 217      FFFEF4EA 
+ 217      FFFEF4EA 
+ 217      FFFEF4
+ 218 0b72 EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 218      EAFFFEF4 
+ 218      EAFFFEF4 
+ 218      EAFFFE
+ 219 0b81 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 219      F4EAFFFE 
+ 219      F4EAFFFE 
+ 219      F4EAFF
+ 220 0b90 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 220      FEF4EAFF 
+ 220      FEF4EAFF 
+ 220      FEF4EA
+ 221 0b9f FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 221      FFFEF4EA 
+ 221      FFFEF4EA 
+ 221      FFFEF4
+ 222 0bae EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 222      EAFFFEF4 
+ 222      EAFFFEF4 
+ 222      EAFFFE
+ 223 0bbd F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 223      F4EAFFFE 
+ 223      F4EAFFFE 
+ 223      F4EAFF
+ 224 0bcc FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 224      FEF4EAFF 
+ 224      FEF4EAFF 
+ 224      FEF4EA
+ 225 0bdb FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 225      FFFEF4EA 
+ 225      FFFEF4EA 
+ 225      FFFEF4
+ 226 0bea EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 226      EAFFFEF4 
+ 226      EAFFFEF4 
+ 226      EAFFFE
+ 227 0bf9 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 227      F4EAFFFE 
+ 227      F4EAFFFE 
+ 227      F4EAFF
+ 228 0c08 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 228      FEF4EAFF 
+ 228      FEF4EAFF 
+ 228      FEF4EA
+ 229 0c17 FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 229      FFFEF4EA 
+GAS LISTING /tmp/ccb9bXR3.s 			page 16
+
+
+ 229      FFFEF4EA 
+ 229      FFFEF4
+ 230 0c26 EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 230      EAFFFEF4 
+ 230      EAFFFEF4 
+ 230      EAFFFE
+ 231 0c35 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 231      F4EAFFFE 
+ 231      F4EAFFFE 
+ 231      F4EAFF
+ 232 0c44 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 232      FEF4EAFF 
+ 232      FEF4EAFF 
+ 232      FEF4EA
+ 233 0c53 FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 233      FFFEF4EA 
+ 233      FFFEF4EA 
+ 233      FFFEF4
+ 234 0c62 EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 234      EAFFFEF4 
+ 234      EAFFFEF4 
+ 234      EAFFFE
+ 235 0c71 F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\364\352\377\376\364\352\377"
+ 235      F4EAFFFE 
+ 235      F4EAFFFE 
+ 235      F4EAFF
+ 236 0c80 FEF4EAFF 		.ascii	"\376\364\352\377\376\364\352\377\376\364\352\377\376\364\352"
+ 236      FEF4EAFF 
+ 236      FEF4EAFF 
+ 236      FEF4EA
+ 237 0c8f FFFEF4EA 		.ascii	"\377\376\364\352\377\376\364\352\377\376\364\352\377\376\364"
+ 237      FFFEF4EA 
+ 237      FFFEF4EA 
+ 237      FFFEF4
+ 238 0c9e EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377\376\364\352\377\376"
+ 238      EAFFFEF4 
+ 238      EAFFFEF4 
+ 238      EAFFFE
+ 239 0cad F4EAFFFE 		.ascii	"\364\352\377\376\364\352\377\376\365\352\377\376\365\352\377"
+ 239      F4EAFFFE 
+ 239      F5EAFFFE 
+ 239      F5EAFF
+ 240 0cbc FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 240      FEF5EAFF 
+ 240      FEF5EAFF 
+ 240      FEF5EA
+ 241 0ccb FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 241      FFFEF5EA 
+ 241      FFFEF5EA 
+ 241      FFFEF5
+ 242 0cda EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 242      EAFFFEF5 
+ 242      EAFFFEF5 
+ 242      EAFFFE
+ 243 0ce9 F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 243      F5EAFFFE 
+ 243      F5EAFFFE 
+GAS LISTING /tmp/ccb9bXR3.s 			page 17
+
+
+ 243      F5EAFF
+ 244 0cf8 FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 244      FEF5EAFF 
+ 244      FEF5EAFF 
+ 244      FEF5EA
+ 245 0d07 FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 245      FFFEF5EA 
+ 245      FFFEF5EA 
+ 245      FFFEF5
+ 246 0d16 EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 246      EAFFFEF5 
+ 246      EAFFFEF5 
+ 246      EAFFFE
+ 247 0d25 F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 247      F5EAFFFE 
+ 247      F5EAFFFE 
+ 247      F5EAFF
+ 248 0d34 FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 248      FEF5EAFF 
+ 248      FEF5EAFF 
+ 248      FEF5EA
+ 249 0d43 FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 249      FFFEF5EA 
+ 249      FFFEF5EA 
+ 249      FFFEF5
+ 250 0d52 EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 250      EAFFFEF5 
+ 250      EAFFFEF5 
+ 250      EAFFFE
+ 251 0d61 F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 251      F5EAFFFE 
+ 251      F5EAFFFE 
+ 251      F5EAFF
+ 252 0d70 FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 252      FEF5EAFF 
+ 252      FEF5EAFF 
+ 252      FEF5EA
+ 253 0d7f FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 253      FFFEF5EA 
+ 253      FFFEF5EA 
+ 253      FFFEF5
+ 254 0d8e EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 254      EAFFFEF5 
+ 254      EAFFFEF5 
+ 254      EAFFFE
+ 255 0d9d F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 255      F5EAFFFE 
+ 255      F5EAFFFE 
+ 255      F5EAFF
+ 256 0dac FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 256      FEF5EAFF 
+ 256      FEF5EAFF 
+ 256      FEF5EA
+ 257 0dbb FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 257      FFFEF5EA 
+ 257      FFFEF5EA 
+ 257      FFFEF5
+GAS LISTING /tmp/ccb9bXR3.s 			page 18
+
+
+ 258 0dca EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 258      EAFFFEF5 
+ 258      EAFFFEF5 
+ 258      EAFFFE
+ 259 0dd9 F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 259      F5EAFFFE 
+ 259      F5EAFFFE 
+ 259      F5EAFF
+ 260 0de8 FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 260      FEF5EAFF 
+ 260      FEF5EAFF 
+ 260      FEF5EA
+ 261 0df7 FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 261      FFFEF5EA 
+ 261      FFFEF5EA 
+ 261      FFFEF5
+ 262 0e06 EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 262      EAFFFEF5 
+ 262      EAFFFEF5 
+ 262      EAFFFE
+ 263 0e15 F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 263      F5EAFFFE 
+ 263      F5EAFFFE 
+ 263      F5EAFF
+ 264 0e24 FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 264      FEF5EAFF 
+ 264      FEF5EAFF 
+ 264      FEF5EA
+ 265 0e33 FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 265      FFFEF5EA 
+ 265      FFFEF5EA 
+ 265      FFFEF5
+ 266 0e42 EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 266      EAFFFEF5 
+ 266      EAFFFEF5 
+ 266      EAFFFE
+ 267 0e51 F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 267      F5EAFFFE 
+ 267      F5EAFFFE 
+ 267      F5EAFF
+ 268 0e60 FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 268      FEF5EAFF 
+ 268      FEF5EAFF 
+ 268      FEF5EA
+ 269 0e6f FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 269      FFFEF5EA 
+ 269      FFFEF5EA 
+ 269      FFFEF5
+ 270 0e7e EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 270      EAFFFEF5 
+ 270      EAFFFEF5 
+ 270      EAFFFE
+ 271 0e8d F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 271      F5EAFFFE 
+ 271      F5EAFFFE 
+ 271      F5EAFF
+ 272 0e9c FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+GAS LISTING /tmp/ccb9bXR3.s 			page 19
+
+
+ 272      FEF5EAFF 
+ 272      FEF5EAFF 
+ 272      FEF5EA
+ 273 0eab FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 273      FFFEF5EA 
+ 273      FFFEF5EA 
+ 273      FFFEF5
+ 274 0eba EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 274      EAFFFEF5 
+ 274      EAFFFEF5 
+ 274      EAFFFE
+ 275 0ec9 F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 275      F5EAFFFE 
+ 275      F5EAFFFE 
+ 275      F5EAFF
+ 276 0ed8 FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 276      FEF5EAFF 
+ 276      FEF5EAFF 
+ 276      FEF5EA
+ 277 0ee7 FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 277      FFFEF5EA 
+ 277      FFFEF5EA 
+ 277      FFFEF5
+ 278 0ef6 EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 278      EAFFFEF5 
+ 278      EAFFFEF5 
+ 278      EAFFFE
+ 279 0f05 F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 279      F5EAFFFE 
+ 279      F5EAFFFE 
+ 279      F5EAFF
+ 280 0f14 FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 280      FEF5EAFF 
+ 280      FEF5EAFF 
+ 280      FEF5EA
+ 281 0f23 FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 281      FFFEF5EA 
+ 281      FFFEF5EA 
+ 281      FFFEF5
+ 282 0f32 EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 282      EAFFFEF5 
+ 282      EAFFFEF5 
+ 282      EAFFFE
+ 283 0f41 F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 283      F5EAFFFE 
+ 283      F5EAFFFE 
+ 283      F5EAFF
+ 284 0f50 FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 284      FEF5EAFF 
+ 284      FEF5EAFF 
+ 284      FEF5EA
+ 285 0f5f FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 285      FFFEF5EA 
+ 285      FFFEF5EA 
+ 285      FFFEF5
+ 286 0f6e EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 286      EAFFFEF5 
+GAS LISTING /tmp/ccb9bXR3.s 			page 20
+
+
+ 286      EAFFFEF5 
+ 286      EAFFFE
+ 287 0f7d F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 287      F5EAFFFE 
+ 287      F5EAFFFE 
+ 287      F5EAFF
+ 288 0f8c FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 288      FEF5EAFF 
+ 288      FEF5EAFF 
+ 288      FEF5EA
+ 289 0f9b FFFEF5EA 		.ascii	"\377\376\365\352\377"
+ 289      FF
+ 290 0fa0 FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 290      FEF5EAFF 
+ 290      FEF5EAFF 
+ 290      FEF5EA
+ 291 0faf FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 291      FFFEF5EA 
+ 291      FFFEF5EA 
+ 291      FFFEF5
+ 292 0fbe EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377\376\365\352\377\376"
+ 292      EAFFFEF5 
+ 292      EAFFFEF5 
+ 292      EAFFFE
+ 293 0fcd F5EAFFFE 		.ascii	"\365\352\377\376\365\352\377\376\365\352\377\376\365\352\377"
+ 293      F5EAFFFE 
+ 293      F5EAFFFE 
+ 293      F5EAFF
+ 294 0fdc FEF5EAFF 		.ascii	"\376\365\352\377\376\365\352\377\376\365\352\377\376\365\352"
+ 294      FEF5EAFF 
+ 294      FEF5EAFF 
+ 294      FEF5EA
+ 295 0feb FFFEF5EA 		.ascii	"\377\376\365\352\377\376\365\352\377\376\365\352\377\376\365"
+ 295      FFFEF5EA 
+ 295      FFFEF5EA 
+ 295      FFFEF5
+ 296 0ffa EAFFFEF5 		.ascii	"\352\377\376\365\352\377\376\365\352\377"
+ 296      EAFFFEF5 
+ 296      EAFF
+ 297              		.globl	heatmap_cs_Oranges_mixed
+ 298              		.section	.data.rel.local
+ 299              		.align 8
+ 300              		.type	heatmap_cs_Oranges_mixed, @object
+ 301              		.size	heatmap_cs_Oranges_mixed, 8
+ 302              	heatmap_cs_Oranges_mixed:
+ 303 0008 00000000 		.quad	mixed
+ 303      00000000 
+ 304              		.section	.data.rel.ro.local
+ 305              		.align 16
+ 306              		.type	mixed, @object
+ 307              		.size	mixed, 16
+ 308              	mixed:
+ 309 0010 00000000 		.quad	mixed_data
+ 309      00000000 
+ 310 0018 01040000 		.quad	1025
+ 310      00000000 
+ 311              		.section	.rodata
+GAS LISTING /tmp/ccb9bXR3.s 			page 21
+
+
+ 312 1004 00000000 		.align 32
+ 312      00000000 
+ 312      00000000 
+ 312      00000000 
+ 312      00000000 
+ 313              		.type	mixed_data, @object
+ 314              		.size	mixed_data, 4100
+ 315              	mixed_data:
+ 316 1020 00       		.string	""
+ 317 1021 00       		.string	""
+ 318 1022 00       		.string	""
+ 319 1023 00       		.string	""
+ 320 1024 7E270300 		.string	"~'\003"
+ 321 1028 7F270407 		.ascii	"\177'\004\007\177'\004\016\177'\004\026\177'\004\035\200'\004"
+ 321      7F27040E 
+ 321      7F270416 
+ 321      7F27041D 
+ 321      802704
+ 322 103b 25802704 		.ascii	"%\200'\004,\200'\0044\200'\004;\201'\004C\201'\004J\201'\004"
+ 322      2C802704 
+ 322      34802704 
+ 322      3B812704 
+ 322      43812704 
+ 323 1053 52812804 		.ascii	"R\201(\004Y\202(\004a\202(\004h\202(\004p\202(\004w\203(\004"
+ 323      59822804 
+ 323      61822804 
+ 323      68822804 
+ 323      70822804 
+ 324 106b 7F832804 		.ascii	"\177\203(\004\206\203(\004\215\203(\004\225\204(\004\234\204"
+ 324      86832804 
+ 324      8D832804 
+ 324      95842804 
+ 324      9C84
+ 325 107d 2804A484 		.ascii	"(\004\244\204)\004\253\204)\004\263\204)\004\272\205)\004\302"
+ 325      2904AB84 
+ 325      2904B384 
+ 325      2904BA85 
+ 325      2904C2
+ 326 1090 852904C9 		.ascii	"\205)\004\311\205)\004\321\205)\004\330\206)\004\340\206)\004"
+ 326      852904D1 
+ 326      852904D8 
+ 326      862904E0 
+ 326      862904
+ 327 10a3 E7862904 		.ascii	"\347\206)\004\357\206*\004\366\207*\004\376\207*\004\377\207"
+ 327      EF862A04 
+ 327      F6872A04 
+ 327      FE872A04 
+ 327      FF87
+ 328 10b5 2A04FF87 		.ascii	"*\004\377\207*\004\377\210*\004\377\210*\004\377\210*\004\377"
+ 328      2A04FF88 
+ 328      2A04FF88 
+ 328      2A04FF88 
+ 328      2A04FF
+ 329 10c8 882A04FF 		.ascii	"\210*\004\377\211*\004\377\211*\004\377\211+\004\377\211+\004"
+ 329      892A04FF 
+ 329      892A04FF 
+ 329      892B04FF 
+GAS LISTING /tmp/ccb9bXR3.s 			page 22
+
+
+ 329      892B04
+ 330 10db FF8A2B04 		.ascii	"\377\212+\004\377\212+\004\377\212+\004\377\212+\004\377\213"
+ 330      FF8A2B04 
+ 330      FF8A2B04 
+ 330      FF8A2B04 
+ 330      FF8B
+ 331 10ed 2B04FF8B 		.ascii	"+\004\377\213+\004\377\213+\004\377\213+\004\377\214+\004\377"
+ 331      2B04FF8B 
+ 331      2B04FF8B 
+ 331      2B04FF8C 
+ 331      2B04FF
+ 332 1100 8C2C04FF 		.ascii	"\214,\004\377\214,\004\377\214,\004\377\214,\004\377\215,\004"
+ 332      8C2C04FF 
+ 332      8C2C04FF 
+ 332      8C2C04FF 
+ 332      8D2C04
+ 333 1113 FF8D2C04 		.ascii	"\377\215,\004\377\215,\004\377\215,\004\377\216,\004\377\226"
+ 333      FF8D2C04 
+ 333      FF8D2C04 
+ 333      FF8E2C04 
+ 333      FF96
+ 334 1125 2F03FF96 		.ascii	"/\003\377\226/\003\377\2260\003\377\2260\003\377\2270\003\377"
+ 334      2F03FF96 
+ 334      3003FF96 
+ 334      3003FF97 
+ 334      3003FF
+ 335 1138 973003FF 		.ascii	"\2270\003\377\2270\003\377\2270\003\377\2300\003\377\2300\003"
+ 335      973003FF 
+ 335      973003FF 
+ 335      983003FF 
+ 335      983003
+ 336 114b FF983003 		.ascii	"\377\2300\003\377\2300\003\377\2311\003\377\2311\003\377\231"
+ 336      FF983003 
+ 336      FF993103 
+ 336      FF993103 
+ 336      FF99
+ 337 115d 3103FF99 		.ascii	"1\003\377\2311\003\377\2321\003\377\2321\003\377\2321\003\377"
+ 337      3103FF9A 
+ 337      3103FF9A 
+ 337      3103FF9A 
+ 337      3103FF
+ 338 1170 9A3103FF 		.ascii	"\2321\003\377\2331\003\377\2331\003\377\2331\003\377\2332\003"
+ 338      9B3103FF 
+ 338      9B3103FF 
+ 338      9B3103FF 
+ 338      9B3203
+ 339 1183 FF9C3203 		.ascii	"\377\2342\003\377\2342\003\377\2342\003\377\2342\003\377\235"
+ 339      FF9C3203 
+ 339      FF9C3203 
+ 339      FF9C3203 
+ 339      FF9D
+ 340 1195 3203FF9D 		.ascii	"2\003\377\2352\003\377\2352\003\377\2352\003\377\2362\003\377"
+ 340      3203FF9D 
+ 340      3203FF9D 
+ 340      3203FF9E 
+ 340      3203FF
+ 341 11a8 9E3303FF 		.ascii	"\2363\003\377\2363\003\377\2363\003\377\2373\003\377\2373\003"
+GAS LISTING /tmp/ccb9bXR3.s 			page 23
+
+
+ 341      9E3303FF 
+ 341      9E3303FF 
+ 341      9F3303FF 
+ 341      9F3303
+ 342 11bb FF9F3303 		.ascii	"\377\2373\003\377\2373\003\377\2403\003\377\2403\003\377\240"
+ 342      FF9F3303 
+ 342      FFA03303 
+ 342      FFA03303 
+ 342      FFA0
+ 343 11cd 3303FFA0 		.ascii	"3\003\377\2403\003\377\2414\003\377\2414\003\377\2414\003\377"
+ 343      3303FFA1 
+ 343      3403FFA1 
+ 343      3403FFA1 
+ 343      3403FF
+ 344 11e0 A13403FF 		.ascii	"\2414\003\377\2424\003\377\2424\003\377\2424\003\377\2424\003"
+ 344      A23403FF 
+ 344      A23403FF 
+ 344      A23403FF 
+ 344      A23403
+ 345 11f3 FFA33403 		.ascii	"\377\2434\003\377\2434\003\377\2435\003\377\2435\003\377\244"
+ 345      FFA33403 
+ 345      FFA33503 
+ 345      FFA33503 
+ 345      FFA4
+ 346 1205 3503FFA4 		.ascii	"5\003\377\2445\003\377\2445\003\377\2445\003\377\2455\003\377"
+ 346      3503FFA4 
+ 346      3503FFA4 
+ 346      3503FFA5 
+ 346      3503FF
+ 347 1218 A53503FF 		.ascii	"\2455\003\377\2455\003\377\2455\003\377\2456\002\377\2466\002"
+ 347      A53503FF 
+ 347      A53503FF 
+ 347      A53602FF 
+ 347      A63602
+ 348 122b FFA63602 		.ascii	"\377\2466\002\377\2466\002\377\2476\002\377\2476\002\377\247"
+ 348      FFA63602 
+ 348      FFA73602 
+ 348      FFA73602 
+ 348      FFA7
+ 349 123d 3602FFA8 		.ascii	"6\002\377\2506\002\377\2506\002\377\2506\002\377\2517\002\377"
+ 349      3602FFA8 
+ 349      3602FFA8 
+ 349      3602FFA9 
+ 349      3702FF
+ 350 1250 A93702FF 		.ascii	"\2517\002\377\2517\002\377\2527\002\377\2527\002\377\2527\002"
+ 350      A93702FF 
+ 350      AA3702FF 
+ 350      AA3702FF 
+ 350      AA3702
+ 351 1263 FFAA3702 		.ascii	"\377\2527\002\377\2537\002\377\2537\002\377\2538\002\377\254"
+ 351      FFAB3702 
+ 351      FFAB3702 
+ 351      FFAB3802 
+ 351      FFAC
+ 352 1275 3802FFAC 		.ascii	"8\002\377\2548\002\377\2548\002\377\2558\002\377\2558\002\377"
+ 352      3802FFAC 
+ 352      3802FFAD 
+GAS LISTING /tmp/ccb9bXR3.s 			page 24
+
+
+ 352      3802FFAD 
+ 352      3802FF
+ 353 1288 AD3802FF 		.ascii	"\2558\002\377\2568\002\377\2568\002\377\2569\002\377\2579\002"
+ 353      AE3802FF 
+ 353      AE3802FF 
+ 353      AE3902FF 
+ 353      AF3902
+ 354 129b FFAF3902 		.ascii	"\377\2579\002\377\2579\002\377\2609\002\377\2609\002\377\260"
+ 354      FFAF3902 
+ 354      FFB03902 
+ 354      FFB03902 
+ 354      FFB0
+ 355 12ad 3902FFB0 		.ascii	"9\002\377\2609\002\377\2619\002\377\261:\002\377\261:\002\377"
+ 355      3902FFB1 
+ 355      3902FFB1 
+ 355      3A02FFB1 
+ 355      3A02FF
+ 356 12c0 B23A02FF 		.ascii	"\262:\002\377\262:\002\377\262:\002\377\263:\002\377\263:\002"
+ 356      B23A02FF 
+ 356      B23A02FF 
+ 356      B33A02FF 
+ 356      B33A02
+ 357 12d3 FFB33A02 		.ascii	"\377\263:\002\377\264:\002\377\264;\002\377\264;\002\377\265"
+ 357      FFB43A02 
+ 357      FFB43B02 
+ 357      FFB43B02 
+ 357      FFB5
+ 358 12e5 3B02FFB5 		.ascii	";\002\377\265;\002\377\265;\002\377\266;\002\377\266;\002\377"
+ 358      3B02FFB5 
+ 358      3B02FFB6 
+ 358      3B02FFB6 
+ 358      3B02FF
+ 359 12f8 B63B02FF 		.ascii	"\266;\002\377\266;\002\377\267<\002\377\267<\002\377\267<\002"
+ 359      B63B02FF 
+ 359      B73C02FF 
+ 359      B73C02FF 
+ 359      B73C02
+ 360 130b FFB83C02 		.ascii	"\377\270<\002\377\270<\002\377\270<\002\377\271<\002\377\271"
+ 360      FFB83C02 
+ 360      FFB83C02 
+ 360      FFB93C02 
+ 360      FFB9
+ 361 131d 3C02FFB9 		.ascii	"<\002\377\271<\002\377\304@"
+ 361      3C02FFC4 
+ 361      40
+ 362 1326 02FFC440 		.string	"\002\377\304@\002\377\304@\001\377\305A\001\377\305A\001\377\305A\001\377\306A\001\377\30
+ 362      02FFC440 
+ 362      01FFC541 
+ 362      01FFC541 
+ 362      01FFC541 
+ 363 1427 FFD94801 		.ascii	"\377\331H\001\377\331H\001\377\331H\001\377\331H\001\377\331"
+ 363      FFD94801 
+ 363      FFD94801 
+ 363      FFD94801 
+ 363      FFD9
+ 364 1439 4901FFD9 		.ascii	"I\001\377\331I\001\377\332I\001\377\332I\001\377\332I\001\377"
+ 364      4901FFDA 
+GAS LISTING /tmp/ccb9bXR3.s 			page 25
+
+
+ 364      4901FFDA 
+ 364      4901FFDA 
+ 364      4901FF
+ 365 144c DA4A01FF 		.ascii	"\332J\001\377\332J\001\377\332J\002\377\332J\002\377\333K\002"
+ 365      DA4A01FF 
+ 365      DA4A02FF 
+ 365      DA4A02FF 
+ 365      DB4B02
+ 366 145f FFDB4B02 		.ascii	"\377\333K\002\377\333K\002\377\333K\002\377\333K\002\377\333"
+ 366      FFDB4B02 
+ 366      FFDB4B02 
+ 366      FFDB4B02 
+ 366      FFDB
+ 367 1471 4C02FFDC 		.ascii	"L\002\377\334L\002\377\334L\002\377\334L\002\377\334L\003\377"
+ 367      4C02FFDC 
+ 367      4C02FFDC 
+ 367      4C02FFDC 
+ 367      4C03FF
+ 368 1484 DC4D03FF 		.ascii	"\334M\003\377\334M\003\377\334M\003\377\335M\003\377\335M\003"
+ 368      DC4D03FF 
+ 368      DC4D03FF 
+ 368      DD4D03FF 
+ 368      DD4D03
+ 369 1497 FFDD4E03 		.ascii	"\377\335N\003\377\335N\003\377\335N\003\377\335N\003\377\335"
+ 369      FFDD4E03 
+ 369      FFDD4E03 
+ 369      FFDD4E03 
+ 369      FFDD
+ 370 14a9 4F04FFDE 		.ascii	"O\004\377\336O\004\377\336O\004\377\336O\004\377\336O\004\377"
+ 370      4F04FFDE 
+ 370      4F04FFDE 
+ 370      4F04FFDE 
+ 370      4F04FF
+ 371 14bc DE5004FF 		.ascii	"\336P\004\377\336P\004\377\337P\004\377\337P\004\377\337P\004"
+ 371      DE5004FF 
+ 371      DF5004FF 
+ 371      DF5004FF 
+ 371      DF5004
+ 372 14cf FFDF5105 		.ascii	"\377\337Q\005\377\337Q\005\377\337Q\005\377\337Q\005\377\340"
+ 372      FFDF5105 
+ 372      FFDF5105 
+ 372      FFDF5105 
+ 372      FFE0
+ 373 14e1 5105FFE0 		.ascii	"Q\005\377\340R\005\377\340R\005\377\340R\005\377\340R\005\377"
+ 373      5205FFE0 
+ 373      5205FFE0 
+ 373      5205FFE0 
+ 373      5205FF
+ 374 14f4 E05206FF 		.ascii	"\340R\006\377\341S\006\377\341S\006\377\341S\006\377\341S\006"
+ 374      E15306FF 
+ 374      E15306FF 
+ 374      E15306FF 
+ 374      E15306
+ 375 1507 FFE15406 		.ascii	"\377\341T\006\377\341T\006\377\341T\006\377\342T\007\377\342"
+ 375      FFE15406 
+ 375      FFE15406 
+ 375      FFE25407 
+GAS LISTING /tmp/ccb9bXR3.s 			page 26
+
+
+ 375      FFE2
+ 376 1519 5407FFE2 		.ascii	"T\007\377\342U\007\377\342U\007\377\347\\\013\377\347\\\013\377"
+ 376      5507FFE2 
+ 376      5507FFE7 
+ 376      5C0BFFE7 
+ 376      5C0BFF
+ 377 152c E75C0BFF 		.ascii	"\347\\\013\377\347\\\013\377\350\\\013\377\350]\013\377\350]"
+ 377      E75C0BFF 
+ 377      E85C0BFF 
+ 377      E85D0BFF 
+ 377      E85D
+ 378 153e 0BFFE85D 		.ascii	"\013\377\350]\f\377\350]\f\377\350]\f\377\350^\f\377\351^\f\377"
+ 378      0CFFE85D 
+ 378      0CFFE85D 
+ 378      0CFFE85E 
+ 378      0CFFE95E 
+ 379 1554 E95E0CFF 		.ascii	"\351^\f\377\351^\f\377\351^\f\377\351_\r\377\351_\r\377\352_"
+ 379      E95E0CFF 
+ 379      E95E0CFF 
+ 379      E95F0DFF 
+ 379      E95F0DFF 
+ 380 156a 0DFFEA5F 		.ascii	"\r\377\352_\r\377\352_\r\377\352`\r\377\352`\r\377\352`\r\377"
+ 380      0DFFEA5F 
+ 380      0DFFEA60 
+ 380      0DFFEA60 
+ 380      0DFFEA60 
+ 381 1580 EA600EFF 		.ascii	"\352`\016\377\353`\016\377\353a\016\377\353a\016\377\353a\016"
+ 381      EB600EFF 
+ 381      EB610EFF 
+ 381      EB610EFF 
+ 381      EB610E
+ 382 1593 FFEB610E 		.ascii	"\377\353a\016\377\353a\016\377\353b\016\377\354b\017\377\354"
+ 382      FFEB610E 
+ 382      FFEB620E 
+ 382      FFEC620F 
+ 382      FFEC
+ 383 15a5 620FFFEC 		.ascii	"b\017\377\354b\017\377\354b\017\377\354c\017\377\354c\017\377"
+ 383      620FFFEC 
+ 383      620FFFEC 
+ 383      630FFFEC 
+ 383      630FFF
+ 384 15b8 EC630FFF 		.ascii	"\354c\017\377\355c\017\377\355c\020\377\355d\020\377\355d\020"
+ 384      ED630FFF 
+ 384      ED6310FF 
+ 384      ED6410FF 
+ 384      ED6410
+ 385 15cb FFED6410 		.ascii	"\377\355d\020\377\355d\020\377\356d\020\377\356e\020\377\356"
+ 385      FFED6410 
+ 385      FFEE6410 
+ 385      FFEE6510 
+ 385      FFEE
+ 386 15dd 6510FFEE 		.ascii	"e\020\377\356e\020\377\356e\021\377\356e\021\377\356f\021\377"
+ 386      6510FFEE 
+ 386      6511FFEE 
+ 386      6511FFEE 
+ 386      6611FF
+ 387 15f0 EF6611FF 		.ascii	"\357f\021\377\357f\021\377\357f\021\377\357g\021\377\357g\021"
+GAS LISTING /tmp/ccb9bXR3.s 			page 27
+
+
+ 387      EF6611FF 
+ 387      EF6611FF 
+ 387      EF6711FF 
+ 387      EF6711
+ 388 1603 FFEF6712 		.ascii	"\377\357g\022\377\357g\022\377\360g\022\377\360h\022\377\360"
+ 388      FFEF6712 
+ 388      FFF06712 
+ 388      FFF06812 
+ 388      FFF0
+ 389 1615 6812FFF0 		.ascii	"h\022\377\360h\022\377\360h\022\377\360h\022\377\360i\022\377"
+ 389      6812FFF0 
+ 389      6812FFF0 
+ 389      6812FFF0 
+ 389      6912FF
+ 390 1628 F16913FF 		.ascii	"\361i\023\377\361i\023\377\361i\023\377\361i\024\377\361j\024"
+ 390      F16913FF 
+ 390      F16913FF 
+ 390      F16914FF 
+ 390      F16A14
+ 391 163b FFF16A14 		.ascii	"\377\361j\024\377\361j\025\377\361j\025\377\361k\025\377\361"
+ 391      FFF16A15 
+ 391      FFF16A15 
+ 391      FFF16B15 
+ 391      FFF1
+ 392 164d 6B16FFF1 		.ascii	"k\026\377\361k\026\377\361k\026\377\361l\026\377\362l\027\377"
+ 392      6B16FFF1 
+ 392      6B16FFF1 
+ 392      6C16FFF2 
+ 392      6C17FF
+ 393 1660 F26C17FF 		.ascii	"\362l\027\377\362l\027\377\362m\030\377\362m\030\377\362m\030"
+ 393      F26C17FF 
+ 393      F26D18FF 
+ 393      F26D18FF 
+ 393      F26D18
+ 394 1673 FFF26D18 		.ascii	"\377\362m\030\377\362m\031\377\362n\031\377\362n\031\377\362"
+ 394      FFF26D19 
+ 394      FFF26E19 
+ 394      FFF26E19 
+ 394      FFF2
+ 395 1685 6E1AFFF2 		.ascii	"n\032\377\362n\032\377\362o\032\377\363o\032\377\363o\033\377"
+ 395      6E1AFFF2 
+ 395      6F1AFFF3 
+ 395      6F1AFFF3 
+ 395      6F1BFF
+ 396 1698 F36F1BFF 		.ascii	"\363o\033\377\363p\033\377\363p\033\377\363p\034\377\363p\034"
+ 396      F3701BFF 
+ 396      F3701BFF 
+ 396      F3701CFF 
+ 396      F3701C
+ 397 16ab FFF3701C 		.ascii	"\377\363p\034\377\363q\034\377\363q\035\377\363q\035\377\363"
+ 397      FFF3711C 
+ 397      FFF3711D 
+ 397      FFF3711D 
+ 397      FFF3
+ 398 16bd 711DFFF3 		.ascii	"q\035\377\363r\036\377\364r\036\377\364r\036\377\364r\036\377"
+ 398      721EFFF4 
+ 398      721EFFF4 
+GAS LISTING /tmp/ccb9bXR3.s 			page 28
+
+
+ 398      721EFFF4 
+ 398      721EFF
+ 399 16d0 F4731FFF 		.ascii	"\364s\037\377\364s\037\377\364s\037\377\364s\037\377\364s \377"
+ 399      F4731FFF 
+ 399      F4731FFF 
+ 399      F4731FFF 
+ 399      F47320FF 
+ 400 16e4 F47420FF 		.ascii	"\364t \377\364t \377\364t \377\364t!\377\364u!\377\365u!\377"
+ 400      F47420FF 
+ 400      F47420FF 
+ 400      F47421FF 
+ 400      F47521FF 
+ 401 16fc F57521FF 		.ascii	"\365u!\377\365u\"\377\365v\"\377\365v\"\377\365v\"\377\365v#"
+ 401      F57522FF 
+ 401      F57622FF 
+ 401      F57622FF 
+ 401      F57622FF 
+ 402 1713 FFF57623 		.ascii	"\377\365v#\377\365w#\377\365w#\377\365w$\377\370\177,\377\370"
+ 402      FFF57723 
+ 402      FFF57723 
+ 402      FFF57724 
+ 402      FFF87F2C 
+ 403 1729 7F2CFFF8 		.ascii	"\177,\377\370\177-\377\370\177-\377\370\177-\377\370\200-\377"
+ 403      7F2DFFF8 
+ 403      7F2DFFF8 
+ 403      7F2DFFF8 
+ 403      802DFF
+ 404 173c F8802EFF 		.ascii	"\370\200.\377\370\200.\377\370\200.\377\370\201.\377\371\201"
+ 404      F8802EFF 
+ 404      F8802EFF 
+ 404      F8812EFF 
+ 404      F981
+ 405 174e 2FFFF981 		.ascii	"/\377\371\201/\377\371\201/\377\371\201/\377\371\2020\377\371"
+ 405      2FFFF981 
+ 405      2FFFF981 
+ 405      2FFFF982 
+ 405      30FFF9
+ 406 1761 8230FFF9 		.ascii	"\2020\377\371\2020\377\371\2020\377\371\2030\377\371\2031\377"
+ 406      8230FFF9 
+ 406      8230FFF9 
+ 406      8330FFF9 
+ 406      8331FF
+ 407 1774 F98331FF 		.ascii	"\371\2031\377\371\2031\377\371\2031\377\371\2042\377\372\204"
+ 407      F98331FF 
+ 407      F98331FF 
+ 407      F98432FF 
+ 407      FA84
+ 408 1786 32FFFA84 		.ascii	"2\377\372\2042\377\372\2042\377\372\2043\377\372\2053\377\372"
+ 408      32FFFA84 
+ 408      32FFFA84 
+ 408      33FFFA85 
+ 408      33FFFA
+ 409 1799 8533FFFA 		.ascii	"\2053\377\372\2053\377\372\2054\377\372\2064\377\372\2064\377"
+ 409      8533FFFA 
+ 409      8534FFFA 
+ 409      8634FFFA 
+ 409      8634FF
+GAS LISTING /tmp/ccb9bXR3.s 			page 29
+
+
+ 410 17ac FA8634FF 		.ascii	"\372\2064\377\372\2065\377\372\2065\377\373\2075\377\373\207"
+ 410      FA8635FF 
+ 410      FA8635FF 
+ 410      FB8735FF 
+ 410      FB87
+ 411 17be 35FFFB87 		.ascii	"5\377\373\2076\377\373\2076\377\373\2106\377\373\2106\377\373"
+ 411      36FFFB87 
+ 411      36FFFB88 
+ 411      36FFFB88 
+ 411      36FFFB
+ 412 17d1 8836FFFB 		.ascii	"\2106\377\373\2107\377\373\2107\377\373\2117\377\373\2117\377"
+ 412      8837FFFB 
+ 412      8837FFFB 
+ 412      8937FFFB 
+ 412      8937FF
+ 413 17e4 FB8938FF 		.ascii	"\373\2118\377\373\2118\377\373\2118\377"
+ 413      FB8938FF 
+ 413      FB8938FF 
+ 414 17f0 FC8A38FF 		.ascii	"\374\2128\377\374\2129\377\374\2129\377\374\2129\377\374\213"
+ 414      FC8A39FF 
+ 414      FC8A39FF 
+ 414      FC8A39FF 
+ 414      FC8B
+ 415 1802 39FFFC8B 		.ascii	"9\377\374\213:\377\374\213:\377\374\213:\377\374\213:\377\374"
+ 415      3AFFFC8B 
+ 415      3AFFFC8B 
+ 415      3AFFFC8B 
+ 415      3AFFFC
+ 416 1815 8C3BFFFC 		.ascii	"\214;\377\374\214;\377\374\214;\377\374\214;\377\374\215;\377"
+ 416      8C3BFFFC 
+ 416      8C3BFFFC 
+ 416      8C3BFFFC 
+ 416      8D3BFF
+ 417 1828 FD8D3CFF 		.ascii	"\375\215<\377\375\215<\377\375\215<\377\375\215=\377\375\216"
+ 417      FD8D3CFF 
+ 417      FD8D3CFF 
+ 417      FD8D3DFF 
+ 417      FD8E
+ 418 183a 3DFFFD8E 		.ascii	"=\377\375\216=\377\375\216>\377\375\216>\377\375\216>\377\375"
+ 418      3DFFFD8E 
+ 418      3EFFFD8E 
+ 418      3EFFFD8E 
+ 418      3EFFFD
+ 419 184d 8F3EFFFD 		.ascii	"\217>\377\375\217?\377\375\217?\377\375\217?\377\375\220@\377"
+ 419      8F3FFFFD 
+ 419      8F3FFFFD 
+ 419      8F3FFFFD 
+ 419      9040FF
+ 420 1860 FD9040FF 		.ascii	"\375\220@\377\375\220@\377\375\220@\377\375\220A\377\375\221"
+ 420      FD9040FF 
+ 420      FD9040FF 
+ 420      FD9041FF 
+ 420      FD91
+ 421 1872 41FFFD91 		.ascii	"A\377\375\221A\377\375\221B\377\375\221B\377\375\221B\377\375"
+ 421      41FFFD91 
+ 421      42FFFD91 
+ 421      42FFFD91 
+GAS LISTING /tmp/ccb9bXR3.s 			page 30
+
+
+ 421      42FFFD
+ 422 1885 9242FFFD 		.ascii	"\222B\377\375\222C\377\375\222C\377\375\222C\377\375\223D\377"
+ 422      9243FFFD 
+ 422      9243FFFD 
+ 422      9243FFFD 
+ 422      9344FF
+ 423 1898 FD9344FF 		.ascii	"\375\223D\377\375\223D\377\375\223E\377\375\223E\377\375\224"
+ 423      FD9344FF 
+ 423      FD9345FF 
+ 423      FD9345FF 
+ 423      FD94
+ 424 18aa 45FFFD94 		.ascii	"E\377\375\224E\377\375\224F\377\375\224F\377\375\224F\377\375"
+ 424      45FFFD94 
+ 424      46FFFD94 
+ 424      46FFFD94 
+ 424      46FFFD
+ 425 18bd 9547FFFD 		.ascii	"\225G\377\375\225G\377\375\225G\377\375\225G\377\375\226H\377"
+ 425      9547FFFD 
+ 425      9547FFFD 
+ 425      9547FFFD 
+ 425      9648FF
+ 426 18d0 FD9648FF 		.ascii	"\375\226H\377\375\226H\377\375\226I\377\375\226I\377\375\227"
+ 426      FD9648FF 
+ 426      FD9649FF 
+ 426      FD9649FF 
+ 426      FD97
+ 427 18e2 49FFFD97 		.ascii	"I\377\375\227I\377\375\227J\377\375\227J\377\375\227J\377\375"
+ 427      49FFFD97 
+ 427      4AFFFD97 
+ 427      4AFFFD97 
+ 427      4AFFFD
+ 428 18f5 984BFFFD 		.ascii	"\230K\377\375\230K\377\375\230K\377\375\230K\377\375\230L\377"
+ 428      984BFFFD 
+ 428      984BFFFD 
+ 428      984BFFFD 
+ 428      984CFF
+ 429 1908 FD994CFF 		.ascii	"\375\231L\377\375\231L\377\375\231M\377\375\231M\377\375\231"
+ 429      FD994CFF 
+ 429      FD994DFF 
+ 429      FD994DFF 
+ 429      FD99
+ 430 191a 4DFFFD9A 		.ascii	"M\377\375\232N\377\375\232N\377\375\241X\377\375\241X\377\375"
+ 430      4EFFFD9A 
+ 430      4EFFFDA1 
+ 430      58FFFDA1 
+ 430      58FFFD
+ 431 192d A158FFFD 		.ascii	"\241X\377\375\241X\377\375\242Y\377\375\242Y\377\375\242Y\377"
+ 431      A158FFFD 
+ 431      A259FFFD 
+ 431      A259FFFD 
+ 431      A259FF
+ 432 1940 FDA25AFF 		.ascii	"\375\242Z\377\375\242Z\377\375\243Z\377\375\243Z\377\375\243"
+ 432      FDA25AFF 
+ 432      FDA35AFF 
+ 432      FDA35AFF 
+ 432      FDA3
+ 433 1952 5BFFFDA3 		.ascii	"[\377\375\243[\377\375\243[\377\375\244\\\377\375\244\\\377\375"
+GAS LISTING /tmp/ccb9bXR3.s 			page 31
+
+
+ 433      5BFFFDA3 
+ 433      5BFFFDA4 
+ 433      5CFFFDA4 
+ 433      5CFFFD
+ 434 1965 A45CFFFD 		.ascii	"\244\\\377\375\244]\377\375\244]\377\375\245]\377\375\245]\377"
+ 434      A45DFFFD 
+ 434      A45DFFFD 
+ 434      A55DFFFD 
+ 434      A55DFF
+ 435 1978 FDA55EFF 		.ascii	"\375\245^\377\375\245^\377\375\245^\377\375\246_\377\375\246"
+ 435      FDA55EFF 
+ 435      FDA55EFF 
+ 435      FDA65FFF 
+ 435      FDA6
+ 436 198a 5FFFFDA6 		.ascii	"_\377\375\246_\377\375\246_\377\375\246`\377\375\247`\377\375"
+ 436      5FFFFDA6 
+ 436      5FFFFDA6 
+ 436      60FFFDA7 
+ 436      60FFFD
+ 437 199d A760FFFD 		.ascii	"\247`\377\375\247a\377\375\247a\377\375\247a\377\375\250b\377"
+ 437      A761FFFD 
+ 437      A761FFFD 
+ 437      A761FFFD 
+ 437      A862FF
+ 438 19b0 FDA862FF 		.ascii	"\375\250b\377\375\250b\377\375\250b\377\375\250c\377\375\251"
+ 438      FDA862FF 
+ 438      FDA862FF 
+ 438      FDA863FF 
+ 438      FDA9
+ 439 19c2 63FFFDA9 		.ascii	"c\377\375\251c\377\375\251d\377\375\251d\377\375\251d\377\375"
+ 439      63FFFDA9 
+ 439      64FFFDA9 
+ 439      64FFFDA9 
+ 439      64FFFD
+ 440 19d5 AA65FFFD 		.ascii	"\252e\377\375\252e\377\375\252e\377\375\252e\377\375\252f\377"
+ 440      AA65FFFD 
+ 440      AA65FFFD 
+ 440      AA65FFFD 
+ 440      AA66FF
+ 441 19e8 FDAB66FF 		.ascii	"\375\253f\377\375\253f\377\375\253g\377\375\253g\377\375\253"
+ 441      FDAB66FF 
+ 441      FDAB67FF 
+ 441      FDAB67FF 
+ 441      FDAB
+ 442 19fa 67FFFDAC 		.ascii	"g\377\375\254g\377\375\254h\377\375\254h\377\375\254h\377\375"
+ 442      67FFFDAC 
+ 442      68FFFDAC 
+ 442      68FFFDAC 
+ 442      68FFFD
+ 443 1a0d AC69FFFD 		.ascii	"\254i\377\375\255i\377\375\255i\377\375\255j\377\375\255j\377"
+ 443      AD69FFFD 
+ 443      AD69FFFD 
+ 443      AD6AFFFD 
+ 443      AD6AFF
+ 444 1a20 FDAD6AFF 		.ascii	"\375\255j\377\374\256j\377\375\256k\377\375\256k\377\375\256"
+ 444      FCAE6AFF 
+ 444      FDAE6BFF 
+GAS LISTING /tmp/ccb9bXR3.s 			page 32
+
+
+ 444      FDAE6BFF 
+ 444      FDAE
+ 445 1a32 6BFFFDAE 		.ascii	"k\377\375\256l\377\375\257l\377\375\257l\377\375\257m\377\375"
+ 445      6CFFFDAF 
+ 445      6CFFFDAF 
+ 445      6CFFFDAF 
+ 445      6DFFFD
+ 446 1a45 AF6DFFFD 		.ascii	"\257m\377\375\260m\377\375\260n\377\375\260n\377\375\260n\377"
+ 446      B06DFFFD 
+ 446      B06EFFFD 
+ 446      B06EFFFD 
+ 446      B06EFF
+ 447 1a58 FDB06FFF 		.ascii	"\375\260o\377\375\261o\377\375\261o\377\375\261p\377\375\261"
+ 447      FDB16FFF 
+ 447      FDB16FFF 
+ 447      FDB170FF 
+ 447      FDB1
+ 448 1a6a 70FFFDB1 		.ascii	"p\377\375\261p\377\375\262q\377\375\262q\377\375\262q\377\375"
+ 448      70FFFDB2 
+ 448      71FFFDB2 
+ 448      71FFFDB2 
+ 448      71FFFD
+ 449 1a7d B272FFFD 		.ascii	"\262r\377\375\263r\377\375\263r\377\375\263s\377\375\263s\377"
+ 449      B372FFFD 
+ 449      B372FFFD 
+ 449      B373FFFD 
+ 449      B373FF
+ 450 1a90 FDB373FF 		.ascii	"\375\263s\377\375\264t\377\375\264t\377\375\264t\377\375\264"
+ 450      FDB474FF 
+ 450      FDB474FF 
+ 450      FDB474FF 
+ 450      FDB4
+ 451 1aa2 75FFFDB5 		.ascii	"u\377\375\265u\377\375\265u\377\375\265v\377\375\265v\377\375"
+ 451      75FFFDB5 
+ 451      75FFFDB5 
+ 451      76FFFDB5 
+ 451      76FFFD
+ 452 1ab5 B576FFFD 		.ascii	"\265v\377\375\266w\377\375\266w\377\375\266w\377\375\266x\377"
+ 452      B677FFFD 
+ 452      B677FFFD 
+ 452      B677FFFD 
+ 452      B678FF
+ 453 1ac8 FDB678FF 		.ascii	"\375\266x\377\375\267x\377\375\267y\377\375\267y\377\375\267"
+ 453      FDB778FF 
+ 453      FDB779FF 
+ 453      FDB779FF 
+ 453      FDB7
+ 454 1ada 79FFFDB8 		.ascii	"y\377\375\270z\377\375\270z\377\375\270z\377\375\270{\377\375"
+ 454      7AFFFDB8 
+ 454      7AFFFDB8 
+ 454      7AFFFDB8 
+ 454      7BFFFD
+ 455 1aed B87BFFFD 		.ascii	"\270{\377\375\271{\377\375\271|\377\375\271|\377\375\271}\377"
+ 455      B97BFFFD 
+ 455      B97CFFFD 
+ 455      B97CFFFD 
+ 455      B97DFF
+GAS LISTING /tmp/ccb9bXR3.s 			page 33
+
+
+ 456 1b00 FDBA7DFF 		.ascii	"\375\272}\377\375\272}\377\375\272~\377\375\272~\377\375\272"
+ 456      FDBA7DFF 
+ 456      FDBA7EFF 
+ 456      FDBA7EFF 
+ 456      FDBA
+ 457 1b12 7EFFFDBB 		.ascii	"~\377\375\273\177\377\375\273\177\377\375\273\177\377\375\273"
+ 457      7FFFFDBB 
+ 457      7FFFFDBB 
+ 457      7FFFFDBB 
+ 458 1b22 80FFFDC2 		.ascii	"\200\377\375\302\213\377\375\302\213\377\375\303\214\377\375"
+ 458      8BFFFDC2 
+ 458      8BFFFDC3 
+ 458      8CFFFD
+ 459 1b31 C38CFFFD 		.ascii	"\303\214\377\375\303\214\377\375\303\215\377\375\303\215\377"
+ 459      C38CFFFD 
+ 459      C38DFFFD 
+ 459      C38DFF
+ 460 1b40 FDC48DFF 		.ascii	"\375\304\215\377\375\304\216\377\375\304\216\377\375\304\216"
+ 460      FDC48EFF 
+ 460      FDC48EFF 
+ 460      FDC48E
+ 461 1b4f FFFDC58F 		.ascii	"\377\375\305\217\377\375\305\217\377\375\305\217\377\375\305"
+ 461      FFFDC58F 
+ 461      FFFDC58F 
+ 461      FFFDC5
+ 462 1b5e 90FFFDC5 		.ascii	"\220\377\375\305\220\377\375\306\220\377\375\306\221\377\375"
+ 462      90FFFDC6 
+ 462      90FFFDC6 
+ 462      91FFFD
+ 463 1b6d C691FFFD 		.ascii	"\306\221\377\375\306\222\377\375\306\222\377\375\307\222\377"
+ 463      C692FFFD 
+ 463      C692FFFD 
+ 463      C792FF
+ 464 1b7c FDC793FF 		.ascii	"\375\307\223\377\375\307\223\377\375\307\223\377\375\307\224"
+ 464      FDC793FF 
+ 464      FDC793FF 
+ 464      FDC794
+ 465 1b8b FFFDC894 		.ascii	"\377\375\310\224\377\375\310\224\377\375\310\225\377\375\310"
+ 465      FFFDC894 
+ 465      FFFDC895 
+ 465      FFFDC8
+ 466 1b9a 95FFFDC9 		.ascii	"\225\377\375\311\225\377\375\311\226\377\375\311\226\377\375"
+ 466      95FFFDC9 
+ 466      96FFFDC9 
+ 466      96FFFD
+ 467 1ba9 C996FFFD 		.ascii	"\311\226\377\375\311\227\377\375\312\227\377\375\312\227\377"
+ 467      C997FFFD 
+ 467      CA97FFFD 
+ 467      CA97FF
+ 468 1bb8 FDCA98FF 		.ascii	"\375\312\230\377\375\312\230\377\375\312\231\377\375\313\231"
+ 468      FDCA98FF 
+ 468      FDCA99FF 
+ 468      FDCB99
+ 469 1bc7 FFFDCB99 		.ascii	"\377\375\313\231\377\375\313\232\377\375\313\232\377\375\313"
+ 469      FFFDCB9A 
+ 469      FFFDCB9A 
+ 469      FFFDCB
+GAS LISTING /tmp/ccb9bXR3.s 			page 34
+
+
+ 470 1bd6 9AFFFDCC 		.ascii	"\232\377\375\314\233\377\375\314\233\377\375\314\233\377\375"
+ 470      9BFFFDCC 
+ 470      9BFFFDCC 
+ 470      9BFFFD
+ 471 1be5 CC9CFFFD 		.ascii	"\314\234\377\375\314\234\377\375\315\234\377\375\315\235\377"
+ 471      CC9CFFFD 
+ 471      CD9CFFFD 
+ 471      CD9DFF
+ 472 1bf4 FDCD9DFF 		.ascii	"\375\315\235\377\375\315\236\377\375\315\236\377\375\316\236"
+ 472      FDCD9EFF 
+ 472      FDCD9EFF 
+ 472      FDCE9E
+ 473 1c03 FFFDCE9F 		.ascii	"\377\375\316\237\377\375\316\237\377\375\316\237\377\375\316"
+ 473      FFFDCE9F 
+ 473      FFFDCE9F 
+ 473      FFFDCE
+ 474 1c12 A0FFFDCF 		.ascii	"\240\377\375\317\240\377\375\317\240\377\375\317\241\377\375"
+ 474      A0FFFDCF 
+ 474      A0FFFDCF 
+ 474      A1FFFD
+ 475 1c21 CFA1FFFC 		.ascii	"\317\241\377\374\320\241\377\375\320\242\377\375\320\242\377"
+ 475      D0A1FFFD 
+ 475      D0A2FFFD 
+ 475      D0A2FF
+ 476 1c30 FDD0A2FF 		.ascii	"\375\320\242\377\375\320\243\377\375\320\243\377\375\320\243"
+ 476      FDD0A3FF 
+ 476      FDD0A3FF 
+ 476      FDD0A3
+ 477 1c3f FFFDD0A3 		.ascii	"\377\375\320\243\377\375\321\244\377\375\321\244\377\375\321"
+ 477      FFFDD1A4 
+ 477      FFFDD1A4 
+ 477      FFFDD1
+ 478 1c4e A4FFFDD1 		.ascii	"\244\377\375\321\244\377\375\321\245\377\375\321\245\377\375"
+ 478      A4FFFDD1 
+ 478      A5FFFDD1 
+ 478      A5FFFD
+ 479 1c5d D1A5FFFD 		.ascii	"\321\245\377\375\322\246\377\375\322\246\377\375\322\246\377"
+ 479      D2A6FFFD 
+ 479      D2A6FFFD 
+ 479      D2A6FF
+ 480 1c6c FDD2A6FF 		.ascii	"\375\322\246\377\375\322\247\377\375\322\247\377\375\322\247"
+ 480      FDD2A7FF 
+ 480      FDD2A7FF 
+ 480      FDD2A7
+ 481 1c7b FFFDD3A7 		.ascii	"\377\375\323\247\377\375\323\250\377\375\323\250\377\375\323"
+ 481      FFFDD3A8 
+ 481      FFFDD3A8 
+ 481      FFFDD3
+ 482 1c8a A8FFFDD3 		.ascii	"\250\377\375\323\251\377\375\323\251\377\375\323\251\377\375"
+ 482      A9FFFDD3 
+ 482      A9FFFDD3 
+ 482      A9FFFD
+ 483 1c99 D3A9FFFD 		.ascii	"\323\251\377\375\324\252\377\375\324\252\377\375\324\252\377"
+ 483      D4AAFFFD 
+ 483      D4AAFFFD 
+ 483      D4AAFF
+ 484 1ca8 FDD4AAFF 		.ascii	"\375\324\252\377\375\324\253\377\375\324\253\377\375\324\253"
+GAS LISTING /tmp/ccb9bXR3.s 			page 35
+
+
+ 484      FDD4ABFF 
+ 484      FDD4ABFF 
+ 484      FDD4AB
+ 485 1cb7 FFFDD5AC 		.ascii	"\377\375\325\254\377\375\325\254\377\375\325\254\377\375\325"
+ 485      FFFDD5AC 
+ 485      FFFDD5AC 
+ 485      FFFDD5
+ 486 1cc6 ACFFFDD5 		.ascii	"\254\377\375\325\255\377\375\325\255\377\375\325\255\377\375"
+ 486      ADFFFDD5 
+ 486      ADFFFDD5 
+ 486      ADFFFD
+ 487 1cd5 D6ADFFFD 		.ascii	"\326\255\377\375\326\256\377\375\326\256\377\375\326\256\377"
+ 487      D6AEFFFD 
+ 487      D6AEFFFD 
+ 487      D6AEFF
+ 488 1ce4 FDD6AFFF 		.ascii	"\375\326\257\377\375\326\257\377\375\326\257\377\375\327\257"
+ 488      FDD6AFFF 
+ 488      FDD6AFFF 
+ 488      FDD7AF
+ 489 1cf3 FFFDD7B0 		.ascii	"\377\375\327\260\377\375\327\260\377\375\327\260\377\375\327"
+ 489      FFFDD7B0 
+ 489      FFFDD7B0 
+ 489      FFFDD7
+ 490 1d02 B0FFFDD7 		.ascii	"\260\377\375\327\261\377\375\327\261\377\375\327\261\377\375"
+ 490      B1FFFDD7 
+ 490      B1FFFDD7 
+ 490      B1FFFD
+ 491 1d11 D8B2FFFD 		.ascii	"\330\262\377\375\330\262\377\375\330\262\377\375\330\262\377"
+ 491      D8B2FFFD 
+ 491      D8B2FFFD 
+ 491      D8B2FF
+ 492 1d20 FDD8B3FF 		.ascii	"\375\330\263\377\375\335\274\377\375\335\274\377\375\335\274"
+ 492      FDDDBCFF 
+ 492      FDDDBCFF 
+ 492      FDDDBC
+ 493 1d2f FFFDDDBD 		.ascii	"\377\375\335\275\377\375\335\275\377\375\335\275\377\375\336"
+ 493      FFFDDDBD 
+ 493      FFFDDDBD 
+ 493      FFFDDE
+ 494 1d3e BDFFFDDE 		.ascii	"\275\377\375\336\276\377\375\336\276\377\375\336\276\377\375"
+ 494      BEFFFDDE 
+ 494      BEFFFDDE 
+ 494      BEFFFD
+ 495 1d4d DEBFFFFD 		.ascii	"\336\277\377\375\336\277\377\375\336\277\377\375\337\277\377"
+ 495      DEBFFFFD 
+ 495      DEBFFFFD 
+ 495      DFBFFF
+ 496 1d5c FDDFC0FF 		.ascii	"\375\337\300\377\375\337\300\377\375\337\300\377\375\337\300"
+ 496      FDDFC0FF 
+ 496      FDDFC0FF 
+ 496      FDDFC0
+ 497 1d6b FFFDDFC1 		.ascii	"\377\375\337\301\377\375\337\301\377\375\337\301\377\375\340"
+ 497      FFFDDFC1 
+ 497      FFFDDFC1 
+ 497      FFFDE0
+ 498 1d7a C2FFFDE0 		.ascii	"\302\377\375\340\302\377\375\340\302\377\375\340\302\377\375"
+ 498      C2FFFDE0 
+GAS LISTING /tmp/ccb9bXR3.s 			page 36
+
+
+ 498      C2FFFDE0 
+ 498      C2FFFD
+ 499 1d89 E0C3FFFD 		.ascii	"\340\303\377\375\340\303\377\375\340\303\377\375\341\303\377"
+ 499      E0C3FFFD 
+ 499      E0C3FFFD 
+ 499      E1C3FF
+ 500 1d98 FDE1C4FF 		.ascii	"\375\341\304\377\375\341\304\377\375\341\304\377\375\341\305"
+ 500      FDE1C4FF 
+ 500      FDE1C4FF 
+ 500      FDE1C5
+ 501 1da7 FFFDE1C5 		.ascii	"\377\375\341\305\377\375\341\305\377\375\342\305\377\375\342"
+ 501      FFFDE1C5 
+ 501      FFFDE2C5 
+ 501      FFFDE2
+ 502 1db6 C6FFFDE2 		.ascii	"\306\377\375\342\306\377\375\342\306\377\375\342\307\377\375"
+ 502      C6FFFDE2 
+ 502      C6FFFDE2 
+ 502      C7FFFD
+ 503 1dc5 E2C7FFFE 		.ascii	"\342\307\377\376\342\307\377\376\342\307\377\376\343\310\377"
+ 503      E2C7FFFE 
+ 503      E2C7FFFE 
+ 503      E3C8FF
+ 504 1dd4 FEE3C8FF 		.ascii	"\376\343\310\377\376\343\310\377\376\343\310\377\376\343\311"
+ 504      FEE3C8FF 
+ 504      FEE3C8FF 
+ 504      FEE3C9
+ 505 1de3 FFFEE3C9 		.ascii	"\377\376\343\311\377\376\343\311\377\376\344\312\377\376\344"
+ 505      FFFEE3C9 
+ 505      FFFEE4CA 
+ 505      FFFEE4
+ 506 1df2 CAFFFEE4 		.ascii	"\312\377\376\344\312\377\376\344\312\377\376\344\313\377\376"
+ 506      CAFFFEE4 
+ 506      CAFFFEE4 
+ 506      CBFFFE
+ 507 1e01 E4CBFFFE 		.ascii	"\344\313\377\376\344\313\377\376\345\314\377\376\345\314\377"
+ 507      E4CBFFFE 
+ 507      E5CCFFFE 
+ 507      E5CCFF
+ 508 1e10 FEE5CCFF 		.ascii	"\376\345\314\377\376\345\314\377\376\345\315\377\376\345\315"
+ 508      FEE5CCFF 
+ 508      FEE5CDFF 
+ 508      FEE5CD
+ 509 1e1f FFFEE5CD 		.ascii	"\377\376\345\315\377\375\346\315\377\376\346\316\377\376\346"
+ 509      FFFDE6CD 
+ 509      FFFEE6CE 
+ 509      FFFEE6
+ 510 1e2e CEFFFEE6 		.ascii	"\316\377\376\346\316\377\376\346\316\377\376\346\316\377\376"
+ 510      CEFFFEE6 
+ 510      CEFFFEE6 
+ 510      CEFFFE
+ 511 1e3d E6CFFFFE 		.ascii	"\346\317\377\376\346\317\377\376\346\317\377\376\346\317\377"
+ 511      E6CFFFFE 
+ 511      E6CFFFFE 
+ 511      E6CFFF
+ 512 1e4c FEE6CFFF 		.ascii	"\376\346\317\377\376\347\317\377\376\347\320\377\376\347\320"
+ 512      FEE7CFFF 
+ 512      FEE7D0FF 
+GAS LISTING /tmp/ccb9bXR3.s 			page 37
+
+
+ 512      FEE7D0
+ 513 1e5b FFFEE7D0 		.ascii	"\377\376\347\320\377\376\347\320\377\376\347\320\377\376\347"
+ 513      FFFEE7D0 
+ 513      FFFEE7D0 
+ 513      FFFEE7
+ 514 1e6a D1FFFEE7 		.ascii	"\321\377\376\347\321\377\376\347\321\377\376\347\321\377\376"
+ 514      D1FFFEE7 
+ 514      D1FFFEE7 
+ 514      D1FFFE
+ 515 1e79 E7D1FFFE 		.ascii	"\347\321\377\376\350\321\377\376\350\322\377\376\350\322\377"
+ 515      E8D1FFFE 
+ 515      E8D2FFFE 
+ 515      E8D2FF
+ 516 1e88 FEE8D2FF 		.ascii	"\376\350\322\377\376\350\322\377\376\350\322\377\376\350\323"
+ 516      FEE8D2FF 
+ 516      FEE8D2FF 
+ 516      FEE8D3
+ 517 1e97 FFFEE8D3 		.ascii	"\377\376\350\323\377\376\350\323\377\376\350\323\377\376\351"
+ 517      FFFEE8D3 
+ 517      FFFEE8D3 
+ 517      FFFEE9
+ 518 1ea6 D3FFFEE9 		.ascii	"\323\377\376\351\323\377\376\351\324\377\376\351\324\377\376"
+ 518      D3FFFEE9 
+ 518      D4FFFEE9 
+ 518      D4FFFE
+ 519 1eb5 E9D4FFFE 		.ascii	"\351\324\377\376\351\324\377\376\351\324\377\376\351\325\377"
+ 519      E9D4FFFE 
+ 519      E9D4FFFE 
+ 519      E9D5FF
+ 520 1ec4 FEE9D5FF 		.ascii	"\376\351\325\377\376\351\325\377\376\351\325\377\376\352\325"
+ 520      FEE9D5FF 
+ 520      FEE9D5FF 
+ 520      FEEAD5
+ 521 1ed3 FFFEEAD5 		.ascii	"\377\376\352\325\377\376\352\326\377\376\352\326\377\376\352"
+ 521      FFFEEAD6 
+ 521      FFFEEAD6 
+ 521      FFFEEA
+ 522 1ee2 D6FFFEEA 		.ascii	"\326\377\376\352\326\377\376\352\326\377\376\352\326\377\376"
+ 522      D6FFFEEA 
+ 522      D6FFFEEA 
+ 522      D6FFFE
+ 523 1ef1 EAD7FFFE 		.ascii	"\352\327\377\376\352\327\377\376\352\327\377\376\353\327\377"
+ 523      EAD7FFFE 
+ 523      EAD7FFFE 
+ 523      EBD7FF
+ 524 1f00 FEEBD7FF 		.ascii	"\376\353\327\377\376\353\330\377\376\353\330\377\376\353\330"
+ 524      FEEBD8FF 
+ 524      FEEBD8FF 
+ 524      FEEBD8
+ 525 1f0f FFFEEBD8 		.ascii	"\377\376\353\330\377\376\353\330\377\376\353\330\377\376\353"
+ 525      FFFEEBD8 
+ 525      FFFEEBD8 
+ 525      FFFEEB
+ 526 1f1e D9FFFEEB 		.ascii	"\331\377\376\353\331\377\376\357\337\377\376\357\337\377\376"
+ 526      D9FFFEEF 
+ 526      DFFFFEEF 
+ 526      DFFFFE
+GAS LISTING /tmp/ccb9bXR3.s 			page 38
+
+
+ 527 1f2d EFDFFFFE 		.ascii	"\357\337\377\376\357\337\377\376\357\340\377\376\357\340\377"
+ 527      EFDFFFFE 
+ 527      EFE0FFFE 
+ 527      EFE0FF
+ 528 1f3c FEEFE0FF 		.ascii	"\376\357\340\377\376\357\340\377\376\357\340\377\376\357\340"
+ 528      FEEFE0FF 
+ 528      FEEFE0FF 
+ 528      FEEFE0
+ 529 1f4b FFFEEFE1 		.ascii	"\377\376\357\341\377\376\360\341\377\376\360\341\377\376\360"
+ 529      FFFEF0E1 
+ 529      FFFEF0E1 
+ 529      FFFEF0
+ 530 1f5a E1FFFEF0 		.ascii	"\341\377\376\360\341\377\376\360\342\377\376\360\342\377\376"
+ 530      E1FFFEF0 
+ 530      E2FFFEF0 
+ 530      E2FFFE
+ 531 1f69 F0E2FFFE 		.ascii	"\360\342\377\376\360\342\377\376\360\342\377\376\360\342\377"
+ 531      F0E2FFFE 
+ 531      F0E2FFFE 
+ 531      F0E2FF
+ 532 1f78 FEF0E3FF 		.ascii	"\376\360\343\377\376\361\343\377\376\361\343\377\376\361\343"
+ 532      FEF1E3FF 
+ 532      FEF1E3FF 
+ 532      FEF1E3
+ 533 1f87 FFFEF1E3 		.ascii	"\377\376\361\343\377\376\361\344\377\376\361\344\377\376\361"
+ 533      FFFEF1E4 
+ 533      FFFEF1E4 
+ 533      FFFEF1
+ 534 1f96 E4FFFEF1 		.ascii	"\344\377\376\361\344\377\376\361\344\377\376\361\344\377\376"
+ 534      E4FFFEF1 
+ 534      E4FFFEF1 
+ 534      E4FFFE
+ 535 1fa5 F2E5FFFE 		.ascii	"\362\345\377\376\362\345\377\376\362\345\377\376\362\345\377"
+ 535      F2E5FFFE 
+ 535      F2E5FFFE 
+ 535      F2E5FF
+ 536 1fb4 FEF2E5FF 		.ascii	"\376\362\345\377\376\362\346\377\376\362\346\377"
+ 536      FEF2E6FF 
+ 536      FEF2E6FF 
+ 537 1fc0 FEF2E6FF 		.ascii	"\376\362\346\377\376\362\346\377\376\362\346\377\376\362\346"
+ 537      FEF2E6FF 
+ 537      FEF2E6FF 
+ 537      FEF2E6
+ 538 1fcf FFFEF3E7 		.ascii	"\377\376\363\347\377\376\363\347\377\376\363\347\377\376\363"
+ 538      FFFEF3E7 
+ 538      FFFEF3E7 
+ 538      FFFEF3
+ 539 1fde E7FFFEF3 		.ascii	"\347\377\376\363\347\377\376\363\350\377\376\363\350\377\376"
+ 539      E7FFFEF3 
+ 539      E8FFFEF3 
+ 539      E8FFFE
+ 540 1fed F3E8FFFE 		.ascii	"\363\350\377\376\363\350\377\376\363\350\377\376\363\350\377"
+ 540      F3E8FFFE 
+ 540      F3E8FFFE 
+ 540      F3E8FF
+ 541 1ffc FEF4E9FF 		.ascii	"\376\364\351\377\376\364\351\377\376\364\351\377\376\364\351"
+ 541      FEF4E9FF 
+GAS LISTING /tmp/ccb9bXR3.s 			page 39
+
+
+ 541      FEF4E9FF 
+ 541      FEF4E9
+ 542 200b FFFEF4E9 		.ascii	"\377\376\364\351\377\376\364\352\377\376\364\352\377\376\364"
+ 542      FFFEF4EA 
+ 542      FFFEF4EA 
+ 542      FFFEF4
+ 543 201a EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377"
+ 543      EAFFFEF4 
+ 543      EAFF
+ 544              		.globl	heatmap_cs_Oranges_soft
+ 545              		.section	.data.rel.local
+ 546              		.align 8
+ 547              		.type	heatmap_cs_Oranges_soft, @object
+ 548              		.size	heatmap_cs_Oranges_soft, 8
+ 549              	heatmap_cs_Oranges_soft:
+ 550 0010 00000000 		.quad	soft
+ 550      00000000 
+ 551              		.section	.data.rel.ro.local
+ 552              		.align 16
+ 553              		.type	soft, @object
+ 554              		.size	soft, 16
+ 555              	soft:
+ 556 0020 00000000 		.quad	soft_data
+ 556      00000000 
+ 557 0028 01040000 		.quad	1025
+ 557      00000000 
+ 558              		.section	.rodata
+ 559 2024 00000000 		.align 32
+ 559      00000000 
+ 559      00000000 
+ 559      00000000 
+ 559      00000000 
+ 560              		.type	soft_data, @object
+ 561              		.size	soft_data, 4100
+ 562              	soft_data:
+ 563 2040 00       		.string	""
+ 564 2041 00       		.string	""
+ 565 2042 00       		.string	""
+ 566 2043 00       		.string	""
+ 567 2044 7E270300 		.string	"~'\003"
+ 568 2048 7F270407 		.ascii	"\177'\004\007\177'\004\016\177'\004\026\200'\004\035\200'\004"
+ 568      7F27040E 
+ 568      7F270416 
+ 568      8027041D 
+ 568      802704
+ 569 205b 25802704 		.ascii	"%\200'\004,\201'\0044\201'\004;\201(\004C\201(\004J\202(\004"
+ 569      2C812704 
+ 569      34812704 
+ 569      3B812804 
+ 569      43812804 
+ 570 2073 52822804 		.ascii	"R\202(\004Y\202(\004a\203(\004h\203(\004p\203(\004w\204(\004"
+ 570      59822804 
+ 570      61832804 
+ 570      68832804 
+ 570      70832804 
+ 571 208b 7F842904 		.ascii	"\177\204)\004\206\204)\004\215\204)\004\225\205)\004\234\205"
+ 571      86842904 
+GAS LISTING /tmp/ccb9bXR3.s 			page 40
+
+
+ 571      8D842904 
+ 571      95852904 
+ 571      9C85
+ 572 209d 2904A485 		.ascii	")\004\244\205)\004\253\206)\004\263\206)\004\272\206)\004\302"
+ 572      2904AB86 
+ 572      2904B386 
+ 572      2904BA86 
+ 572      2904C2
+ 573 20b0 872A04C9 		.ascii	"\207*\004\311\207*\004\321\207*\004\330\207*\004\340\210*\004"
+ 573      872A04D1 
+ 573      872A04D8 
+ 573      872A04E0 
+ 573      882A04
+ 574 20c3 E7882A04 		.ascii	"\347\210*\004\357\210*\004\366\211*\004\376\211*\004\377\211"
+ 574      EF882A04 
+ 574      F6892A04 
+ 574      FE892A04 
+ 574      FF89
+ 575 20d5 2B04FF8A 		.ascii	"+\004\377\212+\004\377\212+\004\377\212+\004\377\213+\004\377"
+ 575      2B04FF8A 
+ 575      2B04FF8A 
+ 575      2B04FF8B 
+ 575      2B04FF
+ 576 20e8 8B2B04FF 		.ascii	"\213+\004\377\213+\004\377\213+\004\377\214,\004\377\214,\004"
+ 576      8B2B04FF 
+ 576      8B2B04FF 
+ 576      8C2C04FF 
+ 576      8C2C04
+ 577 20fb FF8C2C04 		.ascii	"\377\214,\004\377\215,\004\377\215,\004\377\215,\004\377\216"
+ 577      FF8D2C04 
+ 577      FF8D2C04 
+ 577      FF8D2C04 
+ 577      FF8E
+ 578 210d 2C04FF8E 		.ascii	",\004\377\216,\004\377\216,\004\377\216-\004\377\217-\004\377"
+ 578      2C04FF8E 
+ 578      2C04FF8E 
+ 578      2D04FF8F 
+ 578      2D04FF
+ 579 2120 8F2D04FF 		.ascii	"\217-\004\377\217-\004\377\220-\004\377\220-\004\377\220-\004"
+ 579      8F2D04FF 
+ 579      902D04FF 
+ 579      902D04FF 
+ 579      902D04
+ 580 2133 FF912D04 		.ascii	"\377\221-\004\377\221-\004\377\221.\004\377\221.\004\377\222"
+ 580      FF912D04 
+ 580      FF912E04 
+ 580      FF912E04 
+ 580      FF92
+ 581 2145 2E04FF92 		.ascii	".\004\377\222.\004\377\222.\004\377\223.\004\377\223.\004\377"
+ 581      2E04FF92 
+ 581      2E04FF93 
+ 581      2E04FF93 
+ 581      2E04FF
+ 582 2158 932E04FF 		.ascii	"\223.\004\377\224/\003\377\224/\003\377\224/\003\377\225/\003"
+ 582      942F03FF 
+ 582      942F03FF 
+ 582      942F03FF 
+GAS LISTING /tmp/ccb9bXR3.s 			page 41
+
+
+ 582      952F03
+ 583 216b FF952F03 		.ascii	"\377\225/\003\377\225/\003\377\225/\003\377\226/\003\377\226"
+ 583      FF952F03 
+ 583      FF952F03 
+ 583      FF962F03 
+ 583      FF96
+ 584 217d 2F03FF96 		.ascii	"/\003\377\2260\003\377\2270\003\377\2270\003\377\2270\003\377"
+ 584      3003FF97 
+ 584      3003FF97 
+ 584      3003FF97 
+ 584      3003FF
+ 585 2190 983003FF 		.ascii	"\2300\003\377\2300\003\377\2300\003\377\2310\003\377\2311\003"
+ 585      983003FF 
+ 585      983003FF 
+ 585      993003FF 
+ 585      993103
+ 586 21a3 FF993103 		.ascii	"\377\2311\003\377\2311\003\377\2321\003\377\2321\003\377\232"
+ 586      FF993103 
+ 586      FF9A3103 
+ 586      FF9A3103 
+ 586      FF9A
+ 587 21b5 3103FF9B 		.ascii	"1\003\377\2331\003\377\2331\003\377\2332\003\377\2342\003\377"
+ 587      3103FF9B 
+ 587      3103FF9B 
+ 587      3203FF9C 
+ 587      3203FF
+ 588 21c8 9C3203FF 		.ascii	"\2342\003\377\2342\003\377\2352\003\377\2352\003\377\2352\003"
+ 588      9C3203FF 
+ 588      9D3203FF 
+ 588      9D3203FF 
+ 588      9D3203
+ 589 21db FF9D3203 		.ascii	"\377\2352\003\377\2362\003\377\2363\003\377\2363\003\377\237"
+ 589      FF9E3203 
+ 589      FF9E3303 
+ 589      FF9E3303 
+ 589      FF9F
+ 590 21ed 3303FF9F 		.ascii	"3\003\377\2373\003\377\2373\003\377\2403\003\377\2403\003\377"
+ 590      3303FF9F 
+ 590      3303FFA0 
+ 590      3303FFA0 
+ 590      3303FF
+ 591 2200 A03303FF 		.ascii	"\2403\003\377\2414\003\377\2414\003\377\2414\003\377\2414\003"
+ 591      A13403FF 
+ 591      A13403FF 
+ 591      A13403FF 
+ 591      A13403
+ 592 2213 FFA23403 		.ascii	"\377\2424\003\377\2424\003\377\2424\003\377\2434\003\377\243"
+ 592      FFA23403 
+ 592      FFA23403 
+ 592      FFA33403 
+ 592      FFA3
+ 593 2225 3503FFA3 		.ascii	"5\003\377\2435\003\377\2445\003\377\2445\003\377\2445\003\377"
+ 593      3503FFA4 
+ 593      3503FFA4 
+ 593      3503FFA4 
+ 593      3503FF
+ 594 2238 A53503FF 		.ascii	"\2455\003\377\2455\003\377\2455\003\377\2456\002\377\2466\002"
+GAS LISTING /tmp/ccb9bXR3.s 			page 42
+
+
+ 594      A53503FF 
+ 594      A53503FF 
+ 594      A53602FF 
+ 594      A63602
+ 595 224b FFA63602 		.ascii	"\377\2466\002\377\2476\002\377\2476\002\377\2476\002\377\250"
+ 595      FFA73602 
+ 595      FFA73602 
+ 595      FFA73602 
+ 595      FFA8
+ 596 225d 3602FFA8 		.ascii	"6\002\377\2506\002\377\2517\002\377\2517\002\377\2517\002\377"
+ 596      3602FFA9 
+ 596      3702FFA9 
+ 596      3702FFA9 
+ 596      3702FF
+ 597 2270 AA3702FF 		.ascii	"\2527\002\377\2527\002\377\2537\002\377\2537\002\377\2538\002"
+ 597      AA3702FF 
+ 597      AB3702FF 
+ 597      AB3702FF 
+ 597      AB3802
+ 598 2283 FFAC3802 		.ascii	"\377\2548\002\377\2548\002\377\2558\002\377\2558\002\377\255"
+ 598      FFAC3802 
+ 598      FFAD3802 
+ 598      FFAD3802 
+ 598      FFAD
+ 599 2295 3802FFAE 		.ascii	"8\002\377\2568\002\377\2569\002\377\2569\002\377\2579\002\377"
+ 599      3802FFAE 
+ 599      3902FFAE 
+ 599      3902FFAF 
+ 599      3902FF
+ 600 22a8 AF3902FF 		.ascii	"\2579\002\377\2609\002\377\2609\002\377\2609\002\377\2619\002"
+ 600      B03902FF 
+ 600      B03902FF 
+ 600      B03902FF 
+ 600      B13902
+ 601 22bb FFB13A02 		.ascii	"\377\261:\002\377\262:\002\377\262:\002\377\262:\002\377\263"
+ 601      FFB23A02 
+ 601      FFB23A02 
+ 601      FFB23A02 
+ 601      FFB3
+ 602 22cd 3A02FFB3 		.ascii	":\002\377\263:\002\377\264:\002\377\264;\002\377\264;\002\377"
+ 602      3A02FFB4 
+ 602      3A02FFB4 
+ 602      3B02FFB4 
+ 602      3B02FF
+ 603 22e0 B53B02FF 		.ascii	"\265;\002\377\265;\002\377\266;\002\377\266;\002\377\266;\002"
+ 603      B53B02FF 
+ 603      B63B02FF 
+ 603      B63B02FF 
+ 603      B63B02
+ 604 22f3 FFB73C02 		.ascii	"\377\267<\002\377\267<\002\377\270<\002\377\270<\002\377\270"
+ 604      FFB73C02 
+ 604      FFB83C02 
+ 604      FFB83C02 
+ 604      FFB8
+ 605 2305 3C02FFB9 		.ascii	"<\002\377\271<\002\377\271<\002\377\272=\002\377\272=\002\377"
+ 605      3C02FFB9 
+ 605      3C02FFBA 
+GAS LISTING /tmp/ccb9bXR3.s 			page 43
+
+
+ 605      3D02FFBA 
+ 605      3D02FF
+ 606 2318 BA3D02FF 		.ascii	"\272=\002\377\273=\002\377\273=\002\377\274=\002\377\274=\002"
+ 606      BB3D02FF 
+ 606      BB3D02FF 
+ 606      BC3D02FF 
+ 606      BC3D02
+ 607 232b FFBC3E02 		.ascii	"\377\274>\002\377\275>\002\377\275>\002\377\275>\002\377\276"
+ 607      FFBD3E02 
+ 607      FFBD3E02 
+ 607      FFBD3E02 
+ 607      FFBE
+ 608 233d 3E02FFBE 		.ascii	">\002\377\276>\002\377\277>"
+ 608      3E02FFBF 
+ 608      3E
+ 609 2346 02FFBF3F 		.string	"\002\377\277?\002\377\277?\002\377\300?\002\377\300?\002\377\301?\002\377\301?\002\377\30
+ 609      02FFBF3F 
+ 609      02FFC03F 
+ 609      02FFC03F 
+ 609      02FFC13F 
+ 610 2447 FFD94801 		.ascii	"\377\331H\001\377\331H\001\377\331H\001\377\331I\001\377\331"
+ 610      FFD94801 
+ 610      FFD94801 
+ 610      FFD94901 
+ 610      FFD9
+ 611 2459 4901FFDA 		.ascii	"I\001\377\332I\001\377\332I\001\377\332J\001\377\332J\001\377"
+ 611      4901FFDA 
+ 611      4901FFDA 
+ 611      4A01FFDA 
+ 611      4A01FF
+ 612 246c DA4A02FF 		.ascii	"\332J\002\377\333J\002\377\333K\002\377\333K\002\377\333K\002"
+ 612      DB4A02FF 
+ 612      DB4B02FF 
+ 612      DB4B02FF 
+ 612      DB4B02
+ 613 247f FFDB4C02 		.ascii	"\377\333L\002\377\334L\002\377\334L\002\377\334L\002\377\334"
+ 613      FFDC4C02 
+ 613      FFDC4C02 
+ 613      FFDC4C02 
+ 613      FFDC
+ 614 2491 4D03FFDC 		.ascii	"M\003\377\334M\003\377\334M\003\377\335M\003\377\335N\003\377"
+ 614      4D03FFDC 
+ 614      4D03FFDD 
+ 614      4D03FFDD 
+ 614      4E03FF
+ 615 24a4 DD4E03FF 		.ascii	"\335N\003\377\335N\003\377\335N\003\377\336O\004\377\336O\004"
+ 615      DD4E03FF 
+ 615      DD4E03FF 
+ 615      DE4F04FF 
+ 615      DE4F04
+ 616 24b7 FFDE4F04 		.ascii	"\377\336O\004\377\336P\004\377\336P\004\377\337P\004\377\337"
+ 616      FFDE5004 
+ 616      FFDE5004 
+ 616      FFDF5004 
+ 616      FFDF
+ 617 24c9 5004FFDF 		.ascii	"P\004\377\337Q\004\377\337Q\005\377\337Q\005\377\340Q\005\377"
+ 617      5104FFDF 
+GAS LISTING /tmp/ccb9bXR3.s 			page 44
+
+
+ 617      5105FFDF 
+ 617      5105FFE0 
+ 617      5105FF
+ 618 24dc E05205FF 		.ascii	"\340R\005\377\340R\005\377\340R\005\377\340R\005\377\340S\005"
+ 618      E05205FF 
+ 618      E05205FF 
+ 618      E05205FF 
+ 618      E05305
+ 619 24ef FFE15306 		.ascii	"\377\341S\006\377\341S\006\377\341S\006\377\341T\006\377\341"
+ 619      FFE15306 
+ 619      FFE15306 
+ 619      FFE15406 
+ 619      FFE1
+ 620 2501 5406FFE2 		.ascii	"T\006\377\342T\006\377\342T\006\377\342U\007\377\342U\007\377"
+ 620      5406FFE2 
+ 620      5406FFE2 
+ 620      5507FFE2 
+ 620      5507FF
+ 621 2514 E25507FF 		.ascii	"\342U\007\377\343U\007\377\343V\007\377\343V\007\377\343V\007"
+ 621      E35507FF 
+ 621      E35607FF 
+ 621      E35607FF 
+ 621      E35607
+ 622 2527 FFE35708 		.ascii	"\377\343W\b\377\343W\b\377\344W\b\377\344W\b\377\344X\b\377\344"
+ 622      FFE35708 
+ 622      FFE45708 
+ 622      FFE45708 
+ 622      FFE45808 
+ 623 253d 5808FFE4 		.ascii	"X\b\377\344X\t\377\345X\t\377\345Y\t\377\345Y\t\377\345Y\t\377"
+ 623      5809FFE5 
+ 623      5809FFE5 
+ 623      5909FFE5 
+ 623      5909FFE5 
+ 624 2554 E55909FF 		.ascii	"\345Y\t\377\346Z\t\377\346Z\n\377\346Z\n\377\346Z\n\377\346["
+ 624      E65A09FF 
+ 624      E65A0AFF 
+ 624      E65A0AFF 
+ 624      E65A0AFF 
+ 625 256a 0AFFE65B 		.ascii	"\n\377\346[\n\377\347[\n\377\347[\013\377\347\\\013\377\347\\"
+ 625      0AFFE75B 
+ 625      0AFFE75B 
+ 625      0BFFE75C 
+ 625      0BFFE75C 
+ 626 257e 0BFFE75C 		.ascii	"\013\377\347\\\013\377\350\\\013\377\350]\013\377\350]\f\377"
+ 626      0BFFE85C 
+ 626      0BFFE85D 
+ 626      0BFFE85D 
+ 626      0CFF
+ 627 2590 E85D0CFF 		.ascii	"\350]\f\377\350]\f\377\351^\f\377\351^\f\377\351^\f\377\351^"
+ 627      E85D0CFF 
+ 627      E95E0CFF 
+ 627      E95E0CFF 
+ 627      E95E0CFF 
+ 628 25a6 0DFFE95F 		.ascii	"\r\377\351_\r\377\351_\r\377\352_\r\377\352_\r\377\352`\r\377"
+ 628      0DFFE95F 
+ 628      0DFFEA5F 
+ 628      0DFFEA5F 
+GAS LISTING /tmp/ccb9bXR3.s 			page 45
+
+
+ 628      0DFFEA60 
+ 629 25bc EA600DFF 		.ascii	"\352`\r\377\352`\016\377\353`\016\377\353a\016\377\353a\016\377"
+ 629      EA600EFF 
+ 629      EB600EFF 
+ 629      EB610EFF 
+ 629      EB610EFF 
+ 630 25d0 EB610EFF 		.ascii	"\353a\016\377\353a\016\377\353b\016\377\354b\017\377\354b\017"
+ 630      EB610EFF 
+ 630      EB620EFF 
+ 630      EC620FFF 
+ 630      EC620F
+ 631 25e3 FFEC620F 		.ascii	"\377\354b\017\377\354c\017\377\354c\017\377\355c\017\377\355"
+ 631      FFEC630F 
+ 631      FFEC630F 
+ 631      FFED630F 
+ 631      FFED
+ 632 25f5 6310FFED 		.ascii	"c\020\377\355d\020\377\355d\020\377\355d\020\377\356d\020\377"
+ 632      6410FFED 
+ 632      6410FFED 
+ 632      6410FFEE 
+ 632      6410FF
+ 633 2608 EE6510FF 		.ascii	"\356e\020\377\356e\020\377\356e\021\377\356e\021\377\356f\021"
+ 633      EE6510FF 
+ 633      EE6511FF 
+ 633      EE6511FF 
+ 633      EE6611
+ 634 261b FFEF6611 		.ascii	"\377\357f\021\377\357f\021\377\357g\021\377\357g\021\377\357"
+ 634      FFEF6611 
+ 634      FFEF6711 
+ 634      FFEF6711 
+ 634      FFEF
+ 635 262d 6712FFF0 		.ascii	"g\022\377\360g\022\377\360h\022\377\360h\022\377\360h\022\377"
+ 635      6712FFF0 
+ 635      6812FFF0 
+ 635      6812FFF0 
+ 635      6812FF
+ 636 2640 F06812FF 		.ascii	"\360h\022\377\360i\022\377\361i\023\377\361i\023\377\361i\024"
+ 636      F06912FF 
+ 636      F16913FF 
+ 636      F16913FF 
+ 636      F16914
+ 637 2653 FFF16A14 		.ascii	"\377\361j\024\377\361j\024\377\361j\025\377\361k\025\377\361"
+ 637      FFF16A14 
+ 637      FFF16A15 
+ 637      FFF16B15 
+ 637      FFF1
+ 638 2665 6B16FFF1 		.ascii	"k\026\377\361k\026\377\361k\026\377\362l\027\377\362l\027\377"
+ 638      6B16FFF1 
+ 638      6B16FFF2 
+ 638      6C17FFF2 
+ 638      6C17FF
+ 639 2678 F26C17FF 		.ascii	"\362l\027\377\362m\030\377\362m\030\377\362m\030\377\362n\031"
+ 639      F26D18FF 
+ 639      F26D18FF 
+ 639      F26D18FF 
+ 639      F26E19
+ 640 268b FFF26E19 		.ascii	"\377\362n\031\377\362n\032\377\362n\032\377\363o\032\377\363"
+GAS LISTING /tmp/ccb9bXR3.s 			page 46
+
+
+ 640      FFF26E1A 
+ 640      FFF26E1A 
+ 640      FFF36F1A 
+ 640      FFF3
+ 641 269d 6F1BFFF3 		.ascii	"o\033\377\363o\033\377\363p\033\377\363p\034\377\363p\034\377"
+ 641      6F1BFFF3 
+ 641      701BFFF3 
+ 641      701CFFF3 
+ 641      701CFF
+ 642 26b0 F3701CFF 		.ascii	"\363p\034\377\363q\035\377\363q\035\377\363q\035\377\363r\036"
+ 642      F3711DFF 
+ 642      F3711DFF 
+ 642      F3711DFF 
+ 642      F3721E
+ 643 26c3 FFF4721E 		.ascii	"\377\364r\036\377\364r\036\377\364r\037\377\364s\037\377\364"
+ 643      FFF4721E 
+ 643      FFF4721F 
+ 643      FFF4731F 
+ 643      FFF4
+ 644 26d5 731FFFF4 		.ascii	"s\037\377\364s \377\364t \377\364t \377\364t!\377\364u!\377\365"
+ 644      7320FFF4 
+ 644      7420FFF4 
+ 644      7420FFF4 
+ 644      7421FFF4 
+ 645 26ed 7521FFF5 		.ascii	"u!\377\365u\"\377\365u\"\377\365v\"\377\365v#\377\365v#\377\365"
+ 645      7522FFF5 
+ 645      7522FFF5 
+ 645      7622FFF5 
+ 645      7623FFF5 
+ 646 2705 7623FFF5 		.ascii	"v#\377\365w$\377\365w$\377\365w$\377\365x$\377\366x%\377\366"
+ 646      7724FFF5 
+ 646      7724FFF5 
+ 646      7724FFF5 
+ 646      7824FFF6 
+ 647 271d 7825FFF6 		.ascii	"x%\377\366x%\377\366y&\377\366y&\377\366y&\377\366z'\377\366"
+ 647      7825FFF6 
+ 647      7926FFF6 
+ 647      7926FFF6 
+ 647      7926FFF6 
+ 648 2735 7A27FFF6 		.ascii	"z'\377\366z'\377\366z(\377\366{(\377\367{(\377\367{)\377\367"
+ 648      7A27FFF6 
+ 648      7A28FFF6 
+ 648      7B28FFF7 
+ 648      7B28FFF7 
+ 649 274d 7C29FFF7 		.ascii	"|)\377\367|)\377\367|)\377\367|*\377\367}*\377\367}*\377\367"
+ 649      7C29FFF7 
+ 649      7C29FFF7 
+ 649      7C2AFFF7 
+ 649      7D2AFFF7 
+ 650 2765 7D2BFFF7 		.ascii	"}+\377\367~+\377\370~+\377\370~,\377\370~,\377\370\177,\377\370"
+ 650      7E2BFFF8 
+ 650      7E2BFFF8 
+ 650      7E2CFFF8 
+ 650      7E2CFFF8 
+ 651 277d 7F2DFFF8 		.ascii	"\177-\377\370\177-\377\370\177-\377\370\200-\377\370\200.\377"
+ 651      7F2DFFF8 
+ 651      7F2DFFF8 
+GAS LISTING /tmp/ccb9bXR3.s 			page 47
+
+
+ 651      802DFFF8 
+ 651      802EFF
+ 652 2790 F8802EFF 		.ascii	"\370\200.\377\370\201.\377\371\201/\377\371\201/\377\371\201"
+ 652      F8812EFF 
+ 652      F9812FFF 
+ 652      F9812FFF 
+ 652      F981
+ 653 27a2 2FFFF982 		.ascii	"/\377\371\2020\377\371\2020\377\371\2020\377\371\2020\377\371"
+ 653      30FFF982 
+ 653      30FFF982 
+ 653      30FFF982 
+ 653      30FFF9
+ 654 27b5 8331FFF9 		.ascii	"\2031\377\371\2031\377\371\2031\377\371\2042\377\372\2042\377"
+ 654      8331FFF9 
+ 654      8331FFF9 
+ 654      8432FFFA 
+ 654      8432FF
+ 655 27c8 FA8432FF 		.ascii	"\372\2042\377\372\2043\377\372\2053\377\372\2053\377\372\205"
+ 655      FA8433FF 
+ 655      FA8533FF 
+ 655      FA8533FF 
+ 655      FA85
+ 656 27da 33FFFA85 		.ascii	"3\377\372\2054\377\372\2064\377\372\2064\377\372\2065\377\372"
+ 656      34FFFA86 
+ 656      34FFFA86 
+ 656      34FFFA86 
+ 656      35FFFA
+ 657 27ed 8735FFFB 		.ascii	"\2075\377\373\2075\377\373\2076\377\373\2076\377\373\2106\377"
+ 657      8735FFFB 
+ 657      8736FFFB 
+ 657      8736FFFB 
+ 657      8836FF
+ 658 2800 FB8836FF 		.ascii	"\373\2106\377\373\2107\377\373\2107\377\373\2117\377"
+ 658      FB8837FF 
+ 658      FB8837FF 
+ 658      FB8937FF 
+ 659 2810 FB8938FF 		.ascii	"\373\2118\377\373\2118\377\373\2128\377\374\2129\377\374\212"
+ 659      FB8938FF 
+ 659      FB8A38FF 
+ 659      FC8A39FF 
+ 659      FC8A
+ 660 2822 39FFFC8A 		.ascii	"9\377\374\2129\377\374\2139\377\374\213:\377\374\213:\377\374"
+ 660      39FFFC8B 
+ 660      39FFFC8B 
+ 660      3AFFFC8B 
+ 660      3AFFFC
+ 661 2835 8B3AFFFC 		.ascii	"\213:\377\374\214;\377\374\214;\377\374\214;\377\374\215;\377"
+ 661      8C3BFFFC 
+ 661      8C3BFFFC 
+ 661      8C3BFFFC 
+ 661      8D3BFF
+ 662 2848 FD8D3CFF 		.ascii	"\375\215<\377\375\215<\377\375\215=\377\375\216=\377\375\216"
+ 662      FD8D3CFF 
+ 662      FD8D3DFF 
+ 662      FD8E3DFF 
+ 662      FD8E
+ 663 285a 3DFFFD8E 		.ascii	"=\377\375\216>\377\375\216>\377\375\217>\377\375\217?\377\375"
+GAS LISTING /tmp/ccb9bXR3.s 			page 48
+
+
+ 663      3EFFFD8E 
+ 663      3EFFFD8F 
+ 663      3EFFFD8F 
+ 663      3FFFFD
+ 664 286d 8F3FFFFD 		.ascii	"\217?\377\375\220@\377\375\220@\377\375\220@\377\375\220A\377"
+ 664      9040FFFD 
+ 664      9040FFFD 
+ 664      9040FFFD 
+ 664      9041FF
+ 665 2880 FD9141FF 		.ascii	"\375\221A\377\375\221A\377\375\221B\377\375\221B\377\375\222"
+ 665      FD9141FF 
+ 665      FD9142FF 
+ 665      FD9142FF 
+ 665      FD92
+ 666 2892 42FFFD92 		.ascii	"B\377\375\222C\377\375\222C\377\375\222C\377\375\223D\377\375"
+ 666      43FFFD92 
+ 666      43FFFD92 
+ 666      43FFFD93 
+ 666      44FFFD
+ 667 28a5 9344FFFD 		.ascii	"\223D\377\375\223E\377\375\224E\377\375\224E\377\375\224F\377"
+ 667      9345FFFD 
+ 667      9445FFFD 
+ 667      9445FFFD 
+ 667      9446FF
+ 668 28b8 FD9446FF 		.ascii	"\375\224F\377\375\225F\377\375\225G\377\375\225G\377\375\225"
+ 668      FD9546FF 
+ 668      FD9547FF 
+ 668      FD9547FF 
+ 668      FD95
+ 669 28ca 47FFFD96 		.ascii	"G\377\375\226H\377\375\226H\377\375\226I\377\375\226I\377\375"
+ 669      48FFFD96 
+ 669      48FFFD96 
+ 669      49FFFD96 
+ 669      49FFFD
+ 670 28dd 9749FFFD 		.ascii	"\227I\377\375\227J\377\375\227J\377\375\230J\377\375\230K\377"
+ 670      974AFFFD 
+ 670      974AFFFD 
+ 670      984AFFFD 
+ 670      984BFF
+ 671 28f0 FD984BFF 		.ascii	"\375\230K\377\375\230K\377\375\231L\377\375\231L\377\375\231"
+ 671      FD984BFF 
+ 671      FD994CFF 
+ 671      FD994CFF 
+ 671      FD99
+ 672 2902 4DFFFD99 		.ascii	"M\377\375\231M\377\375\232M\377\375\232N\377\375\232N\377\375"
+ 672      4DFFFD9A 
+ 672      4DFFFD9A 
+ 672      4EFFFD9A 
+ 672      4EFFFD
+ 673 2915 9A4EFFFD 		.ascii	"\232N\377\375\233O\377\375\233O\377\375\233O\377\375\233P\377"
+ 673      9B4FFFFD 
+ 673      9B4FFFFD 
+ 673      9B4FFFFD 
+ 673      9B50FF
+ 674 2928 FD9C50FF 		.ascii	"\375\234P\377\375\234Q\377\375\234Q\377\375\234Q\377\375\235"
+ 674      FD9C51FF 
+ 674      FD9C51FF 
+GAS LISTING /tmp/ccb9bXR3.s 			page 49
+
+
+ 674      FD9C51FF 
+ 674      FD9D
+ 675 293a 52FFFD9D 		.ascii	"R\377\375\235R\377\375\235R\377\375\235S\377\375\236S\377\375"
+ 675      52FFFD9D 
+ 675      52FFFD9D 
+ 675      53FFFD9E 
+ 675      53FFFD
+ 676 294d 9E54FFFD 		.ascii	"\236T\377\375\236T\377\375\237T\377\375\237U\377\375\237U\377"
+ 676      9E54FFFD 
+ 676      9F54FFFD 
+ 676      9F55FFFD 
+ 676      9F55FF
+ 677 2960 FD9F55FF 		.ascii	"\375\237U\377\375\240V\377\375\240V\377\375\240V\377\375\240"
+ 677      FDA056FF 
+ 677      FDA056FF 
+ 677      FDA056FF 
+ 677      FDA0
+ 678 2972 57FFFDA1 		.ascii	"W\377\375\241W\377\375\241X\377\375\241X\377\375\241X\377\375"
+ 678      57FFFDA1 
+ 678      58FFFDA1 
+ 678      58FFFDA1 
+ 678      58FFFD
+ 679 2985 A259FFFD 		.ascii	"\242Y\377\375\242Y\377\375\242Y\377\375\242Z\377\375\243Z\377"
+ 679      A259FFFD 
+ 679      A259FFFD 
+ 679      A25AFFFD 
+ 679      A35AFF
+ 680 2998 FDA35AFF 		.ascii	"\375\243Z\377\375\243[\377\375\243[\377\375\244\\\377\375\244"
+ 680      FDA35BFF 
+ 680      FDA35BFF 
+ 680      FDA45CFF 
+ 680      FDA4
+ 681 29aa 5CFFFDA4 		.ascii	"\\\377\375\244\\\377\375\244]\377\375\245]\377\375\245]\377\375"
+ 681      5CFFFDA4 
+ 681      5DFFFDA5 
+ 681      5DFFFDA5 
+ 681      5DFFFD
+ 682 29bd A55EFFFD 		.ascii	"\245^\377\375\245^\377\375\246_\377\375\246_\377\375\246_\377"
+ 682      A55EFFFD 
+ 682      A65FFFFD 
+ 682      A65FFFFD 
+ 682      A65FFF
+ 683 29d0 FDA660FF 		.ascii	"\375\246`\377\375\247`\377\375\247`\377\375\247a\377\375\247"
+ 683      FDA760FF 
+ 683      FDA760FF 
+ 683      FDA761FF 
+ 683      FDA7
+ 684 29e2 61FFFDA8 		.ascii	"a\377\375\250b\377\375\250b\377\375\250b\377\375\250c\377\375"
+ 684      62FFFDA8 
+ 684      62FFFDA8 
+ 684      62FFFDA8 
+ 684      63FFFD
+ 685 29f5 A963FFFD 		.ascii	"\251c\377\375\251c\377\375\251d\377\375\251d\377\375\252d\377"
+ 685      A963FFFD 
+ 685      A964FFFD 
+ 685      A964FFFD 
+ 685      AA64FF
+GAS LISTING /tmp/ccb9bXR3.s 			page 50
+
+
+ 686 2a08 FDAA65FF 		.ascii	"\375\252e\377\375\252e\377\375\252f\377\375\253f\377\375\253"
+ 686      FDAA65FF 
+ 686      FDAA66FF 
+ 686      FDAB66FF 
+ 686      FDAB
+ 687 2a1a 66FFFDAB 		.ascii	"f\377\375\253g\377\375\253g\377\375\254g\377\375\254h\377\375"
+ 687      67FFFDAB 
+ 687      67FFFDAC 
+ 687      67FFFDAC 
+ 687      68FFFD
+ 688 2a2d AC68FFFD 		.ascii	"\254h\377\375\254i\377\375\255i\377\375\255i\377\375\255j\377"
+ 688      AC69FFFD 
+ 688      AD69FFFD 
+ 688      AD69FFFD 
+ 688      AD6AFF
+ 689 2a40 FDAD6AFF 		.ascii	"\375\255j\377\374\256j\377\375\256k\377\375\256k\377\375\256"
+ 689      FCAE6AFF 
+ 689      FDAE6BFF 
+ 689      FDAE6BFF 
+ 689      FDAE
+ 690 2a52 6CFFFDAF 		.ascii	"l\377\375\257l\377\375\257m\377\375\257m\377\375\257m\377\375"
+ 690      6CFFFDAF 
+ 690      6DFFFDAF 
+ 690      6DFFFDAF 
+ 690      6DFFFD
+ 691 2a65 B06EFFFD 		.ascii	"\260n\377\375\260n\377\375\260o\377\375\261o\377\375\261o\377"
+ 691      B06EFFFD 
+ 691      B06FFFFD 
+ 691      B16FFFFD 
+ 691      B16FFF
+ 692 2a78 FDB170FF 		.ascii	"\375\261p\377\375\261p\377\375\262q\377\375\262q\377\375\262"
+ 692      FDB170FF 
+ 692      FDB271FF 
+ 692      FDB271FF 
+ 692      FDB2
+ 693 2a8a 71FFFDB2 		.ascii	"q\377\375\262r\377\375\263r\377\375\263s\377\375\263s\377\375"
+ 693      72FFFDB3 
+ 693      72FFFDB3 
+ 693      73FFFDB3 
+ 693      73FFFD
+ 694 2a9d B474FFFD 		.ascii	"\264t\377\375\264t\377\375\264t\377\375\264u\377\375\265u\377"
+ 694      B474FFFD 
+ 694      B474FFFD 
+ 694      B475FFFD 
+ 694      B575FF
+ 695 2ab0 FDB576FF 		.ascii	"\375\265v\377\375\265v\377\375\265v\377\375\266w\377\375\266"
+ 695      FDB576FF 
+ 695      FDB576FF 
+ 695      FDB677FF 
+ 695      FDB6
+ 696 2ac2 77FFFDB6 		.ascii	"w\377\375\266x\377\375\267x\377\375\267y\377\375\267y\377\375"
+ 696      78FFFDB7 
+ 696      78FFFDB7 
+ 696      79FFFDB7 
+ 696      79FFFD
+ 697 2ad5 B779FFFD 		.ascii	"\267y\377\375\270z\377\375\270z\377\375\270{\377\375\270{\377"
+ 697      B87AFFFD 
+GAS LISTING /tmp/ccb9bXR3.s 			page 51
+
+
+ 697      B87AFFFD 
+ 697      B87BFFFD 
+ 697      B87BFF
+ 698 2ae8 FDB97BFF 		.ascii	"\375\271{\377\375\271|\377\375\271|\377\375\272}\377\375\272"
+ 698      FDB97CFF 
+ 698      FDB97CFF 
+ 698      FDBA7DFF 
+ 698      FDBA
+ 699 2afa 7DFFFDBA 		.ascii	"}\377\375\272~\377\375\272~\377\375\273~\377\375\273\177\377"
+ 699      7EFFFDBA 
+ 699      7EFFFDBB 
+ 699      7EFFFDBB 
+ 699      7FFF
+ 700 2b0c FDBB7FFF 		.ascii	"\375\273\177\377\375\273\200\377\375\274\200\377\375\274\201"
+ 700      FDBB80FF 
+ 700      FDBC80FF 
+ 700      FDBC81
+ 701 2b1b FFFDBC81 		.ascii	"\377\375\274\201\377\375\275\201\377\375\275\202\377\375\275"
+ 701      FFFDBD81 
+ 701      FFFDBD82 
+ 701      FFFDBD
+ 702 2b2a 82FFFDBD 		.ascii	"\202\377\375\275\203\377\375\276\203\377\375\276\204\377\375"
+ 702      83FFFDBE 
+ 702      83FFFDBE 
+ 702      84FFFD
+ 703 2b39 BE84FFFD 		.ascii	"\276\204\377\375\276\204\377\375\277\205\377\375\277\205\377"
+ 703      BE84FFFD 
+ 703      BF85FFFD 
+ 703      BF85FF
+ 704 2b48 FDBF86FF 		.ascii	"\375\277\206\377\375\277\206\377\375\300\207\377\375\300\207"
+ 704      FDBF86FF 
+ 704      FDC087FF 
+ 704      FDC087
+ 705 2b57 FFFDC087 		.ascii	"\377\375\300\207\377\375\300\210\377\375\301\210\377\375\301"
+ 705      FFFDC088 
+ 705      FFFDC188 
+ 705      FFFDC1
+ 706 2b66 89FFFDC1 		.ascii	"\211\377\375\301\211\377\375\302\212\377\375\302\212\377\375"
+ 706      89FFFDC2 
+ 706      8AFFFDC2 
+ 706      8AFFFD
+ 707 2b75 C28AFFFD 		.ascii	"\302\212\377\375\302\213\377\375\303\213\377\375\303\214\377"
+ 707      C28BFFFD 
+ 707      C38BFFFD 
+ 707      C38CFF
+ 708 2b84 FDC38CFF 		.ascii	"\375\303\214\377\375\303\215\377\375\304\215\377\375\304\216"
+ 708      FDC38DFF 
+ 708      FDC48DFF 
+ 708      FDC48E
+ 709 2b93 FFFDC48E 		.ascii	"\377\375\304\216\377\375\304\216\377\375\305\217\377\375\305"
+ 709      FFFDC48E 
+ 709      FFFDC58F 
+ 709      FFFDC5
+ 710 2ba2 8FFFFDC5 		.ascii	"\217\377\375\305\220\377\375\305\220\377\375\306\221\377\375"
+ 710      90FFFDC5 
+ 710      90FFFDC6 
+ 710      91FFFD
+GAS LISTING /tmp/ccb9bXR3.s 			page 52
+
+
+ 711 2bb1 C691FFFD 		.ascii	"\306\221\377\375\306\221\377\375\307\222\377\375\307\222\377"
+ 711      C691FFFD 
+ 711      C792FFFD 
+ 711      C792FF
+ 712 2bc0 FDC793FF 		.ascii	"\375\307\223\377\375\307\223\377\375\310\224\377\375\310\224"
+ 712      FDC793FF 
+ 712      FDC894FF 
+ 712      FDC894
+ 713 2bcf FFFDC895 		.ascii	"\377\375\310\225\377\375\310\225\377\375\311\225\377\375\311"
+ 713      FFFDC895 
+ 713      FFFDC995 
+ 713      FFFDC9
+ 714 2bde 96FFFDC9 		.ascii	"\226\377\375\311\226\377\375\311\227\377\375\312\227\377\375"
+ 714      96FFFDC9 
+ 714      97FFFDCA 
+ 714      97FFFD
+ 715 2bed CA98FFFD 		.ascii	"\312\230\377\375\312\230\377\375\312\231\377\375\313\231\377"
+ 715      CA98FFFD 
+ 715      CA99FFFD 
+ 715      CB99FF
+ 716 2bfc FDCB99FF 		.ascii	"\375\313\231\377\375\313\232\377\375\313\232\377\375\314\233"
+ 716      FDCB9AFF 
+ 716      FDCB9AFF 
+ 716      FDCC9B
+ 717 2c0b FFFDCC9B 		.ascii	"\377\375\314\233\377\375\314\234\377\375\314\234\377\375\315"
+ 717      FFFDCC9C 
+ 717      FFFDCC9C 
+ 717      FFFDCD
+ 718 2c1a 9DFFFDCD 		.ascii	"\235\377\375\315\235\377\375\315\235\377\375\315\236\377\375"
+ 718      9DFFFDCD 
+ 718      9DFFFDCD 
+ 718      9EFFFD
+ 719 2c29 CE9EFFFD 		.ascii	"\316\236\377\375\316\237\377\375\316\237\377\375\316\240\377"
+ 719      CE9FFFFD 
+ 719      CE9FFFFD 
+ 719      CEA0FF
+ 720 2c38 FDCFA0FF 		.ascii	"\375\317\240\377\375\317\241\377\375\317\241\377\374\320\241"
+ 720      FDCFA1FF 
+ 720      FDCFA1FF 
+ 720      FCD0A1
+ 721 2c47 FFFDD0A2 		.ascii	"\377\375\320\242\377\375\320\242\377\375\320\243\377\375\320"
+ 721      FFFDD0A2 
+ 721      FFFDD0A3 
+ 721      FFFDD0
+ 722 2c56 A3FFFDD0 		.ascii	"\243\377\375\320\243\377\375\321\244\377\375\321\244\377\375"
+ 722      A3FFFDD1 
+ 722      A4FFFDD1 
+ 722      A4FFFD
+ 723 2c65 D1A4FFFD 		.ascii	"\321\244\377\375\321\245\377\375\321\245\377\375\321\245\377"
+ 723      D1A5FFFD 
+ 723      D1A5FFFD 
+ 723      D1A5FF
+ 724 2c74 FDD2A6FF 		.ascii	"\375\322\246\377\375\322\246\377\375\322\246\377\375\322\247"
+ 724      FDD2A6FF 
+ 724      FDD2A6FF 
+ 724      FDD2A7
+ 725 2c83 FFFDD2A7 		.ascii	"\377\375\322\247\377\375\322\247\377\375\323\250\377\375\323"
+GAS LISTING /tmp/ccb9bXR3.s 			page 53
+
+
+ 725      FFFDD2A7 
+ 725      FFFDD3A8 
+ 725      FFFDD3
+ 726 2c92 A8FFFDD3 		.ascii	"\250\377\375\323\250\377\375\323\251\377\375\323\251\377\375"
+ 726      A8FFFDD3 
+ 726      A9FFFDD3 
+ 726      A9FFFD
+ 727 2ca1 D3A9FFFD 		.ascii	"\323\251\377\375\324\252\377\375\324\252\377\375\324\252\377"
+ 727      D4AAFFFD 
+ 727      D4AAFFFD 
+ 727      D4AAFF
+ 728 2cb0 FDD4ABFF 		.ascii	"\375\324\253\377\375\324\253\377\375\324\253\377\375\325\254"
+ 728      FDD4ABFF 
+ 728      FDD4ABFF 
+ 728      FDD5AC
+ 729 2cbf FFFDD5AC 		.ascii	"\377\375\325\254\377\375\325\254\377\375\325\255\377\375\325"
+ 729      FFFDD5AC 
+ 729      FFFDD5AD 
+ 729      FFFDD5
+ 730 2cce ADFFFDD6 		.ascii	"\255\377\375\326\255\377\375\326\256\377\375\326\256\377\375"
+ 730      ADFFFDD6 
+ 730      AEFFFDD6 
+ 730      AEFFFD
+ 731 2cdd D6AEFFFD 		.ascii	"\326\256\377\375\326\257\377\375\326\257\377\375\327\257\377"
+ 731      D6AFFFFD 
+ 731      D6AFFFFD 
+ 731      D7AFFF
+ 732 2cec FDD7B0FF 		.ascii	"\375\327\260\377\375\327\260\377\375\327\260\377\375\327\261"
+ 732      FDD7B0FF 
+ 732      FDD7B0FF 
+ 732      FDD7B1
+ 733 2cfb FFFDD7B1 		.ascii	"\377\375\327\261\377\375\330\262\377\375\330\262\377\375\330"
+ 733      FFFDD8B2 
+ 733      FFFDD8B2 
+ 733      FFFDD8
+ 734 2d0a B2FFFDD8 		.ascii	"\262\377\375\330\263\377\375\330\263\377\375\330\263\377\375"
+ 734      B3FFFDD8 
+ 734      B3FFFDD8 
+ 734      B3FFFD
+ 735 2d19 D9B4FFFD 		.ascii	"\331\264\377\375\331\264\377\375\331\264\377\375\331\265\377"
+ 735      D9B4FFFD 
+ 735      D9B4FFFD 
+ 735      D9B5FF
+ 736 2d28 FDD9B5FF 		.ascii	"\375\331\265\377\375\331\265\377\375\332\266\377\375\332\266"
+ 736      FDD9B5FF 
+ 736      FDDAB6FF 
+ 736      FDDAB6
+ 737 2d37 FFFDDAB6 		.ascii	"\377\375\332\266\377\375\332\267\377\375\332\267\377\375\333"
+ 737      FFFDDAB7 
+ 737      FFFDDAB7 
+ 737      FFFDDB
+ 738 2d46 B7FFFDDB 		.ascii	"\267\377\375\333\270\377\375\333\270\377\375\333\270\377\375"
+ 738      B8FFFDDB 
+ 738      B8FFFDDB 
+ 738      B8FFFD
+ 739 2d55 DBB9FFFD 		.ascii	"\333\271\377\375\333\271\377\375\334\271\377\375\334\272\377"
+ 739      DBB9FFFD 
+GAS LISTING /tmp/ccb9bXR3.s 			page 54
+
+
+ 739      DCB9FFFD 
+ 739      DCBAFF
+ 740 2d64 FDDCBAFF 		.ascii	"\375\334\272\377\375\334\272\377\375\334\273\377\375\334\273"
+ 740      FDDCBAFF 
+ 740      FDDCBBFF 
+ 740      FDDCBB
+ 741 2d73 FFFDDDBB 		.ascii	"\377\375\335\273\377\375\335\274\377\375\335\274\377\375\335"
+ 741      FFFDDDBC 
+ 741      FFFDDDBC 
+ 741      FFFDDD
+ 742 2d82 BCFFFDDD 		.ascii	"\274\377\375\335\275\377\375\335\275\377\375\336\276\377\375"
+ 742      BDFFFDDD 
+ 742      BDFFFDDE 
+ 742      BEFFFD
+ 743 2d91 DEBEFFFD 		.ascii	"\336\276\377\375\336\276\377\375\336\277\377\375\336\277\377"
+ 743      DEBEFFFD 
+ 743      DEBFFFFD 
+ 743      DEBFFF
+ 744 2da0 FDDEBFFF 		.ascii	"\375\336\277\377\375\337\300\377\375\337\300\377\375\337\300"
+ 744      FDDFC0FF 
+ 744      FDDFC0FF 
+ 744      FDDFC0
+ 745 2daf FFFDDFC1 		.ascii	"\377\375\337\301\377\375\337\301\377\375\337\301\377\375\340"
+ 745      FFFDDFC1 
+ 745      FFFDDFC1 
+ 745      FFFDE0
+ 746 2dbe C2FFFDE0 		.ascii	"\302\377\375\340\302\377\375\340\302\377\375\340\303\377\375"
+ 746      C2FFFDE0 
+ 746      C2FFFDE0 
+ 746      C3FFFD
+ 747 2dcd E0C3FFFD 		.ascii	"\340\303\377\375\341\303\377\375\341\304\377\375\341\304\377"
+ 747      E1C3FFFD 
+ 747      E1C4FFFD 
+ 747      E1C4FF
+ 748 2ddc FDE1C4FF 		.ascii	"\375\341\304\377\375\341\305\377\375\341\305\377\376\342\305"
+ 748      FDE1C5FF 
+ 748      FDE1C5FF 
+ 748      FEE2C5
+ 749 2deb FFFEE2C6 		.ascii	"\377\376\342\306\377\376\342\306\377\376\342\307\377\376\342"
+ 749      FFFEE2C6 
+ 749      FFFEE2C7 
+ 749      FFFEE2
+ 750 2dfa C7FFFEE2 		.ascii	"\307\377\376\342\307\377\376\343\310\377\376\343\310\377\376"
+ 750      C7FFFEE3 
+ 750      C8FFFEE3 
+ 750      C8FFFE
+ 751 2e09 E3C8FFFE 		.ascii	"\343\310\377\376\343\311\377\376\343\311\377\376\343\311\377"
+ 751      E3C9FFFE 
+ 751      E3C9FFFE 
+ 751      E3C9FF
+ 752 2e18 FEE4CAFF 		.ascii	"\376\344\312\377\376\344\312\377\376\344\312\377\376\344\313"
+ 752      FEE4CAFF 
+ 752      FEE4CAFF 
+ 752      FEE4CB
+ 753 2e27 FFFEE4CB 		.ascii	"\377\376\344\313\377\376\344\313\377\376\345\314\377\376\345"
+ 753      FFFEE4CB 
+ 753      FFFEE5CC 
+GAS LISTING /tmp/ccb9bXR3.s 			page 55
+
+
+ 753      FFFEE5
+ 754 2e36 CCFFFEE5 		.ascii	"\314\377\376\345\314\377\376\345\315\377\376\345\315\377\375"
+ 754      CCFFFEE5 
+ 754      CDFFFEE5 
+ 754      CDFFFD
+ 755 2e45 E6CDFFFE 		.ascii	"\346\315\377\376\346\316\377\376\346\316\377\376\346\316\377"
+ 755      E6CEFFFE 
+ 755      E6CEFFFE 
+ 755      E6CEFF
+ 756 2e54 FEE6CEFF 		.ascii	"\376\346\316\377\376\346\317\377\376\346\317\377\376\346\317"
+ 756      FEE6CFFF 
+ 756      FEE6CFFF 
+ 756      FEE6CF
+ 757 2e63 FFFEE6CF 		.ascii	"\377\376\346\317\377\376\347\320\377\376\347\320\377\376\347"
+ 757      FFFEE7D0 
+ 757      FFFEE7D0 
+ 757      FFFEE7
+ 758 2e72 D0FFFEE7 		.ascii	"\320\377\376\347\320\377\376\347\320\377\376\347\321\377\376"
+ 758      D0FFFEE7 
+ 758      D0FFFEE7 
+ 758      D1FFFE
+ 759 2e81 E7D1FFFE 		.ascii	"\347\321\377\376\347\321\377\376\347\321\377\376\350\322\377"
+ 759      E7D1FFFE 
+ 759      E7D1FFFE 
+ 759      E8D2FF
+ 760 2e90 FEE8D2FF 		.ascii	"\376\350\322\377\376\350\322\377\376\350\322\377\376\350\322"
+ 760      FEE8D2FF 
+ 760      FEE8D2FF 
+ 760      FEE8D2
+ 761 2e9f FFFEE8D3 		.ascii	"\377\376\350\323\377\376\350\323\377\376\350\323\377\376\351"
+ 761      FFFEE8D3 
+ 761      FFFEE8D3 
+ 761      FFFEE9
+ 762 2eae D3FFFEE9 		.ascii	"\323\377\376\351\324\377\376\351\324\377\376\351\324\377\376"
+ 762      D4FFFEE9 
+ 762      D4FFFEE9 
+ 762      D4FFFE
+ 763 2ebd E9D4FFFE 		.ascii	"\351\324\377\376\351\324\377\376\351\325\377\376\351\325\377"
+ 763      E9D4FFFE 
+ 763      E9D5FFFE 
+ 763      E9D5FF
+ 764 2ecc FEE9D5FF 		.ascii	"\376\351\325\377\376\352\325\377\376\352\326\377\376\352\326"
+ 764      FEEAD5FF 
+ 764      FEEAD6FF 
+ 764      FEEAD6
+ 765 2edb FFFEEAD6 		.ascii	"\377\376\352\326\377\376\352\326\377\376\352\326\377\376\352"
+ 765      FFFEEAD6 
+ 765      FFFEEAD6 
+ 765      FFFEEA
+ 766 2eea D7FFFEEA 		.ascii	"\327\377\376\352\327\377\376\353\327\377\376\353\327\377\376"
+ 766      D7FFFEEB 
+ 766      D7FFFEEB 
+ 766      D7FFFE
+ 767 2ef9 EBD8FFFE 		.ascii	"\353\330\377\376\353\330\377\376\353\330\377\376\353\330\377"
+ 767      EBD8FFFE 
+ 767      EBD8FFFE 
+ 767      EBD8FF
+GAS LISTING /tmp/ccb9bXR3.s 			page 56
+
+
+ 768 2f08 FEEBD9FF 		.ascii	"\376\353\331\377\376\353\331\377\376\353\331\377\376\354\331"
+ 768      FEEBD9FF 
+ 768      FEEBD9FF 
+ 768      FEECD9
+ 769 2f17 FFFEECD9 		.ascii	"\377\376\354\331\377\376\354\332\377\376\354\332\377\376\354"
+ 769      FFFEECDA 
+ 769      FFFEECDA 
+ 769      FFFEEC
+ 770 2f26 DAFFFEEC 		.ascii	"\332\377\376\354\332\377\376\354\333\377\376\354\333\377\376"
+ 770      DAFFFEEC 
+ 770      DBFFFEEC 
+ 770      DBFFFE
+ 771 2f35 EDDBFFFE 		.ascii	"\355\333\377\376\355\333\377\376\355\333\377\376\355\334\377"
+ 771      EDDBFFFE 
+ 771      EDDBFFFE 
+ 771      EDDCFF
+ 772 2f44 FEEDDCFF 		.ascii	"\376\355\334\377\376\355\334\377\376\355\334\377\376\355\335"
+ 772      FEEDDCFF 
+ 772      FEEDDCFF 
+ 772      FEEDDD
+ 773 2f53 FFFEEDDD 		.ascii	"\377\376\355\335\377\376\356\335\377\376\356\335\377\376\356"
+ 773      FFFEEEDD 
+ 773      FFFEEEDD 
+ 773      FFFEEE
+ 774 2f62 DEFFFEEE 		.ascii	"\336\377\376\356\336\377\376\356\336\377\376\356\336\377\376"
+ 774      DEFFFEEE 
+ 774      DEFFFEEE 
+ 774      DEFFFE
+ 775 2f71 EEDEFFFE 		.ascii	"\356\336\377\376\356\337\377\376\357\337\377\376\357\337\377"
+ 775      EEDFFFFE 
+ 775      EFDFFFFE 
+ 775      EFDFFF
+ 776 2f80 FEEFDFFF 		.ascii	"\376\357\337\377\376\357\340\377\376\357\340\377\376\357\340"
+ 776      FEEFE0FF 
+ 776      FEEFE0FF 
+ 776      FEEFE0
+ 777 2f8f FFFEEFE0 		.ascii	"\377\376\357\340\377\376\357\340\377\376\357\341\377\376\360"
+ 777      FFFEEFE0 
+ 777      FFFEEFE1 
+ 777      FFFEF0
+ 778 2f9e E1FFFEF0 		.ascii	"\341\377\376\360\341\377\376\360\341\377\376\360\342\377\376"
+ 778      E1FFFEF0 
+ 778      E1FFFEF0 
+ 778      E2FFFE
+ 779 2fad F0E2FFFE 		.ascii	"\360\342\377\376\360\342\377\376\360\342\377\376\360\343\377"
+ 779      F0E2FFFE 
+ 779      F0E2FFFE 
+ 779      F0E3FF
+ 780 2fbc FEF1E3FF 		.ascii	"\376\361\343\377\376\361\343\377\376\361\343\377\376\361\343"
+ 780      FEF1E3FF 
+ 780      FEF1E3FF 
+ 780      FEF1E3
+ 781 2fcb FFFEF1E4 		.ascii	"\377\376\361\344\377\376\361\344\377\376\361\344\377\376\361"
+ 781      FFFEF1E4 
+ 781      FFFEF1E4 
+ 781      FFFEF1
+ 782 2fda E4FFFEF1 		.ascii	"\344\377\376\361\345\377"
+GAS LISTING /tmp/ccb9bXR3.s 			page 57
+
+
+ 782      E5FF
+ 783 2fe0 FEF2E5FF 		.ascii	"\376\362\345\377\376\362\345\377\376\362\345\377\376\362\345"
+ 783      FEF2E5FF 
+ 783      FEF2E5FF 
+ 783      FEF2E5
+ 784 2fef FFFEF2E6 		.ascii	"\377\376\362\346\377\376\362\346\377\376\362\346\377\376\362"
+ 784      FFFEF2E6 
+ 784      FFFEF2E6 
+ 784      FFFEF2
+ 785 2ffe E6FFFEF3 		.ascii	"\346\377\376\363\347\377\376\363\347\377\376\363\347\377\376"
+ 785      E7FFFEF3 
+ 785      E7FFFEF3 
+ 785      E7FFFE
+ 786 300d F3E7FFFE 		.ascii	"\363\347\377\376\363\350\377\376\363\350\377\376\363\350\377"
+ 786      F3E8FFFE 
+ 786      F3E8FFFE 
+ 786      F3E8FF
+ 787 301c FEF3E8FF 		.ascii	"\376\363\350\377\376\363\350\377\376\364\351\377\376\364\351"
+ 787      FEF3E8FF 
+ 787      FEF4E9FF 
+ 787      FEF4E9
+ 788 302b FFFEF4E9 		.ascii	"\377\376\364\351\377\376\364\351\377\376\364\352\377\376\364"
+ 788      FFFEF4E9 
+ 788      FFFEF4EA 
+ 788      FFFEF4
+ 789 303a EAFFFEF4 		.ascii	"\352\377\376\364\352\377\376\364\352\377"
+ 789      EAFFFEF4 
+ 789      EAFF
+ 790              		.globl	heatmap_cs_Oranges_discrete
+ 791              		.section	.data.rel.local
+ 792              		.align 8
+ 793              		.type	heatmap_cs_Oranges_discrete, @object
+ 794              		.size	heatmap_cs_Oranges_discrete, 8
+ 795              	heatmap_cs_Oranges_discrete:
+ 796 0018 00000000 		.quad	discrete
+ 796      00000000 
+ 797              		.section	.data.rel.ro.local
+ 798              		.align 16
+ 799              		.type	discrete, @object
+ 800              		.size	discrete, 16
+ 801              	discrete:
+ 802 0030 00000000 		.quad	discrete_data
+ 802      00000000 
+ 803 0038 0A000000 		.quad	10
+ 803      00000000 
+ 804              		.section	.rodata
+ 805 3044 00000000 		.align 32
+ 805      00000000 
+ 805      00000000 
+ 805      00000000 
+ 805      00000000 
+ 806              		.type	discrete_data, @object
+ 807              		.size	discrete_data, 40
+ 808              	discrete_data:
+ 809 3060 00       		.string	""
+ 810 3061 00       		.string	""
+ 811 3062 00       		.string	""
+GAS LISTING /tmp/ccb9bXR3.s 			page 58
+
+
+ 812 3063 00       		.string	""
+ 813 3064 7F2704FF 		.ascii	"\177'\004\377\2466\003\377\331H\001\377\361i\023\377\375\215"
+ 813      A63603FF 
+ 813      D94801FF 
+ 813      F16913FF 
+ 813      FD8D
+ 814 3076 3CFFFDAE 		.ascii	"<\377\375\256k\377\375\320\242\377\376\346\316\377\377\365\353"
+ 814      6BFFFDD0 
+ 814      A2FFFEE6 
+ 814      CEFFFFF5 
+ 814      EB
+ 815 3087 FF       		.ascii	"\377"
+ 816              		.text
+ 817              	.Letext0:
+ 818              		.file 1 "./heatmap.h"
+ 819              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 820              		.file 3 "./colorschemes/Oranges.h"
+ 821              		.file 4 "colorschemes/Oranges.c"
+ 822              		.section	.debug_info,"",@progbits
+ 823              	.Ldebug_info0:
+ 824 0000 E3010000 		.long	0x1e3
+ 825 0004 0500     		.value	0x5
+ 826 0006 01       		.byte	0x1
+ 827 0007 08       		.byte	0x8
+ 828 0008 00000000 		.long	.Ldebug_abbrev0
+ 829 000c 0A       		.uleb128 0xa
+ 830 000d 00000000 		.long	.LASF26
+ 831 0011 1D       		.byte	0x1d
+ 832 0012 00000000 		.long	.LASF0
+ 833 0016 00000000 		.long	.LASF1
+ 834 001a 00000000 		.long	.Ldebug_line0
+ 835 001e 01       		.uleb128 0x1
+ 836 001f 08       		.byte	0x8
+ 837 0020 05       		.byte	0x5
+ 838 0021 00000000 		.long	.LASF2
+ 839 0025 06       		.uleb128 0x6
+ 840 0026 00000000 		.long	.LASF12
+ 841 002a 02       		.byte	0x2
+ 842 002b D6       		.byte	0xd6
+ 843 002c 17       		.byte	0x17
+ 844 002d 31000000 		.long	0x31
+ 845 0031 01       		.uleb128 0x1
+ 846 0032 08       		.byte	0x8
+ 847 0033 07       		.byte	0x7
+ 848 0034 00000000 		.long	.LASF3
+ 849 0038 0B       		.uleb128 0xb
+ 850 0039 04       		.byte	0x4
+ 851 003a 05       		.byte	0x5
+ 852 003b 696E7400 		.string	"int"
+ 853 003f 01       		.uleb128 0x1
+ 854 0040 08       		.byte	0x8
+ 855 0041 05       		.byte	0x5
+ 856 0042 00000000 		.long	.LASF4
+ 857 0046 01       		.uleb128 0x1
+ 858 0047 10       		.byte	0x10
+ 859 0048 04       		.byte	0x4
+ 860 0049 00000000 		.long	.LASF5
+GAS LISTING /tmp/ccb9bXR3.s 			page 59
+
+
+ 861 004d 01       		.uleb128 0x1
+ 862 004e 04       		.byte	0x4
+ 863 004f 04       		.byte	0x4
+ 864 0050 00000000 		.long	.LASF6
+ 865 0054 01       		.uleb128 0x1
+ 866 0055 04       		.byte	0x4
+ 867 0056 07       		.byte	0x7
+ 868 0057 00000000 		.long	.LASF7
+ 869 005b 01       		.uleb128 0x1
+ 870 005c 02       		.byte	0x2
+ 871 005d 07       		.byte	0x7
+ 872 005e 00000000 		.long	.LASF8
+ 873 0062 0C       		.uleb128 0xc
+ 874 0063 10       		.byte	0x10
+ 875 0064 01       		.byte	0x1
+ 876 0065 BB       		.byte	0xbb
+ 877 0066 09       		.byte	0x9
+ 878 0067 84000000 		.long	0x84
+ 879 006b 07       		.uleb128 0x7
+ 880 006c 00000000 		.long	.LASF9
+ 881 0070 BC       		.byte	0xbc
+ 882 0071 1A       		.byte	0x1a
+ 883 0072 84000000 		.long	0x84
+ 884 0076 00       		.byte	0
+ 885 0077 07       		.uleb128 0x7
+ 886 0078 00000000 		.long	.LASF10
+ 887 007c BD       		.byte	0xbd
+ 888 007d 0C       		.byte	0xc
+ 889 007e 25000000 		.long	0x25
+ 890 0082 08       		.byte	0x8
+ 891 0083 00       		.byte	0
+ 892 0084 08       		.uleb128 0x8
+ 893 0085 90000000 		.long	0x90
+ 894 0089 01       		.uleb128 0x1
+ 895 008a 01       		.byte	0x1
+ 896 008b 08       		.byte	0x8
+ 897 008c 00000000 		.long	.LASF11
+ 898 0090 03       		.uleb128 0x3
+ 899 0091 89000000 		.long	0x89
+ 900 0095 06       		.uleb128 0x6
+ 901 0096 00000000 		.long	.LASF13
+ 902 009a 01       		.byte	0x1
+ 903 009b BE       		.byte	0xbe
+ 904 009c 03       		.byte	0x3
+ 905 009d 62000000 		.long	0x62
+ 906 00a1 03       		.uleb128 0x3
+ 907 00a2 95000000 		.long	0x95
+ 908 00a6 08       		.uleb128 0x8
+ 909 00a7 A1000000 		.long	0xa1
+ 910 00ab 04       		.uleb128 0x4
+ 911 00ac 00000000 		.long	.LASF14
+ 912 00b0 21       		.byte	0x21
+ 913 00b1 A6000000 		.long	0xa6
+ 914 00b5 04       		.uleb128 0x4
+ 915 00b6 00000000 		.long	.LASF15
+ 916 00ba 23       		.byte	0x23
+ 917 00bb A6000000 		.long	0xa6
+GAS LISTING /tmp/ccb9bXR3.s 			page 60
+
+
+ 918 00bf 04       		.uleb128 0x4
+ 919 00c0 00000000 		.long	.LASF16
+ 920 00c4 25       		.byte	0x25
+ 921 00c5 A6000000 		.long	0xa6
+ 922 00c9 04       		.uleb128 0x4
+ 923 00ca 00000000 		.long	.LASF17
+ 924 00ce 28       		.byte	0x28
+ 925 00cf A6000000 		.long	0xa6
+ 926 00d3 09       		.uleb128 0x9
+ 927 00d4 90000000 		.long	0x90
+ 928 00d8 E3000000 		.long	0xe3
+ 929 00dc 0D       		.uleb128 0xd
+ 930 00dd 31000000 		.long	0x31
+ 931 00e1 27       		.byte	0x27
+ 932 00e2 00       		.byte	0
+ 933 00e3 03       		.uleb128 0x3
+ 934 00e4 D3000000 		.long	0xd3
+ 935 00e8 02       		.uleb128 0x2
+ 936 00e9 00000000 		.long	.LASF18
+ 937 00ed 20       		.byte	0x20
+ 938 00ee 1C       		.byte	0x1c
+ 939 00ef E3000000 		.long	0xe3
+ 940 00f3 09       		.uleb128 0x9
+ 941 00f4 03       		.byte	0x3
+ 942 00f5 00000000 		.quad	discrete_data
+ 942      00000000 
+ 943 00fd 02       		.uleb128 0x2
+ 944 00fe 00000000 		.long	.LASF19
+ 945 0102 23       		.byte	0x23
+ 946 0103 24       		.byte	0x24
+ 947 0104 A1000000 		.long	0xa1
+ 948 0108 09       		.uleb128 0x9
+ 949 0109 03       		.byte	0x3
+ 950 010a 00000000 		.quad	discrete
+ 950      00000000 
+ 951 0112 05       		.uleb128 0x5
+ 952 0113 AB000000 		.long	0xab
+ 953 0117 24       		.byte	0x24
+ 954 0118 09       		.uleb128 0x9
+ 955 0119 03       		.byte	0x3
+ 956 011a 00000000 		.quad	heatmap_cs_Oranges_discrete
+ 956      00000000 
+ 957 0122 09       		.uleb128 0x9
+ 958 0123 90000000 		.long	0x90
+ 959 0127 33010000 		.long	0x133
+ 960 012b 0E       		.uleb128 0xe
+ 961 012c 31000000 		.long	0x31
+ 962 0130 0310     		.value	0x1003
+ 963 0132 00       		.byte	0
+ 964 0133 03       		.uleb128 0x3
+ 965 0134 22010000 		.long	0x122
+ 966 0138 02       		.uleb128 0x2
+ 967 0139 00000000 		.long	.LASF20
+ 968 013d 26       		.byte	0x26
+ 969 013e 1C       		.byte	0x1c
+ 970 013f 33010000 		.long	0x133
+ 971 0143 09       		.uleb128 0x9
+GAS LISTING /tmp/ccb9bXR3.s 			page 61
+
+
+ 972 0144 03       		.byte	0x3
+ 973 0145 00000000 		.quad	soft_data
+ 973      00000000 
+ 974 014d 02       		.uleb128 0x2
+ 975 014e 00000000 		.long	.LASF21
+ 976 0152 29       		.byte	0x29
+ 977 0153 24       		.byte	0x24
+ 978 0154 A1000000 		.long	0xa1
+ 979 0158 09       		.uleb128 0x9
+ 980 0159 03       		.byte	0x3
+ 981 015a 00000000 		.quad	soft
+ 981      00000000 
+ 982 0162 05       		.uleb128 0x5
+ 983 0163 B5000000 		.long	0xb5
+ 984 0167 2A       		.byte	0x2a
+ 985 0168 09       		.uleb128 0x9
+ 986 0169 03       		.byte	0x3
+ 987 016a 00000000 		.quad	heatmap_cs_Oranges_soft
+ 987      00000000 
+ 988 0172 02       		.uleb128 0x2
+ 989 0173 00000000 		.long	.LASF22
+ 990 0177 2C       		.byte	0x2c
+ 991 0178 1C       		.byte	0x1c
+ 992 0179 33010000 		.long	0x133
+ 993 017d 09       		.uleb128 0x9
+ 994 017e 03       		.byte	0x3
+ 995 017f 00000000 		.quad	mixed_data
+ 995      00000000 
+ 996 0187 02       		.uleb128 0x2
+ 997 0188 00000000 		.long	.LASF23
+ 998 018c 2F       		.byte	0x2f
+ 999 018d 24       		.byte	0x24
+ 1000 018e A1000000 		.long	0xa1
+ 1001 0192 09       		.uleb128 0x9
+ 1002 0193 03       		.byte	0x3
+ 1003 0194 00000000 		.quad	mixed
+ 1003      00000000 
+ 1004 019c 05       		.uleb128 0x5
+ 1005 019d BF000000 		.long	0xbf
+ 1006 01a1 30       		.byte	0x30
+ 1007 01a2 09       		.uleb128 0x9
+ 1008 01a3 03       		.byte	0x3
+ 1009 01a4 00000000 		.quad	heatmap_cs_Oranges_mixed
+ 1009      00000000 
+ 1010 01ac 02       		.uleb128 0x2
+ 1011 01ad 00000000 		.long	.LASF24
+ 1012 01b1 32       		.byte	0x32
+ 1013 01b2 1C       		.byte	0x1c
+ 1014 01b3 33010000 		.long	0x133
+ 1015 01b7 09       		.uleb128 0x9
+ 1016 01b8 03       		.byte	0x3
+ 1017 01b9 00000000 		.quad	mixed_exp_data
+ 1017      00000000 
+ 1018 01c1 02       		.uleb128 0x2
+ 1019 01c2 00000000 		.long	.LASF25
+ 1020 01c6 35       		.byte	0x35
+ 1021 01c7 24       		.byte	0x24
+GAS LISTING /tmp/ccb9bXR3.s 			page 62
+
+
+ 1022 01c8 A1000000 		.long	0xa1
+ 1023 01cc 09       		.uleb128 0x9
+ 1024 01cd 03       		.byte	0x3
+ 1025 01ce 00000000 		.quad	mixed_exp
+ 1025      00000000 
+ 1026 01d6 05       		.uleb128 0x5
+ 1027 01d7 C9000000 		.long	0xc9
+ 1028 01db 36       		.byte	0x36
+ 1029 01dc 09       		.uleb128 0x9
+ 1030 01dd 03       		.byte	0x3
+ 1031 01de 00000000 		.quad	heatmap_cs_Oranges_mixed_exp
+ 1031      00000000 
+ 1032 01e6 00       		.byte	0
+ 1033              		.section	.debug_abbrev,"",@progbits
+ 1034              	.Ldebug_abbrev0:
+ 1035 0000 01       		.uleb128 0x1
+ 1036 0001 24       		.uleb128 0x24
+ 1037 0002 00       		.byte	0
+ 1038 0003 0B       		.uleb128 0xb
+ 1039 0004 0B       		.uleb128 0xb
+ 1040 0005 3E       		.uleb128 0x3e
+ 1041 0006 0B       		.uleb128 0xb
+ 1042 0007 03       		.uleb128 0x3
+ 1043 0008 0E       		.uleb128 0xe
+ 1044 0009 00       		.byte	0
+ 1045 000a 00       		.byte	0
+ 1046 000b 02       		.uleb128 0x2
+ 1047 000c 34       		.uleb128 0x34
+ 1048 000d 00       		.byte	0
+ 1049 000e 03       		.uleb128 0x3
+ 1050 000f 0E       		.uleb128 0xe
+ 1051 0010 3A       		.uleb128 0x3a
+ 1052 0011 21       		.uleb128 0x21
+ 1053 0012 04       		.sleb128 4
+ 1054 0013 3B       		.uleb128 0x3b
+ 1055 0014 0B       		.uleb128 0xb
+ 1056 0015 39       		.uleb128 0x39
+ 1057 0016 0B       		.uleb128 0xb
+ 1058 0017 49       		.uleb128 0x49
+ 1059 0018 13       		.uleb128 0x13
+ 1060 0019 02       		.uleb128 0x2
+ 1061 001a 18       		.uleb128 0x18
+ 1062 001b 00       		.byte	0
+ 1063 001c 00       		.byte	0
+ 1064 001d 03       		.uleb128 0x3
+ 1065 001e 26       		.uleb128 0x26
+ 1066 001f 00       		.byte	0
+ 1067 0020 49       		.uleb128 0x49
+ 1068 0021 13       		.uleb128 0x13
+ 1069 0022 00       		.byte	0
+ 1070 0023 00       		.byte	0
+ 1071 0024 04       		.uleb128 0x4
+ 1072 0025 34       		.uleb128 0x34
+ 1073 0026 00       		.byte	0
+ 1074 0027 03       		.uleb128 0x3
+ 1075 0028 0E       		.uleb128 0xe
+ 1076 0029 3A       		.uleb128 0x3a
+GAS LISTING /tmp/ccb9bXR3.s 			page 63
+
+
+ 1077 002a 21       		.uleb128 0x21
+ 1078 002b 03       		.sleb128 3
+ 1079 002c 3B       		.uleb128 0x3b
+ 1080 002d 0B       		.uleb128 0xb
+ 1081 002e 39       		.uleb128 0x39
+ 1082 002f 21       		.uleb128 0x21
+ 1083 0030 25       		.sleb128 37
+ 1084 0031 49       		.uleb128 0x49
+ 1085 0032 13       		.uleb128 0x13
+ 1086 0033 3F       		.uleb128 0x3f
+ 1087 0034 19       		.uleb128 0x19
+ 1088 0035 3C       		.uleb128 0x3c
+ 1089 0036 19       		.uleb128 0x19
+ 1090 0037 00       		.byte	0
+ 1091 0038 00       		.byte	0
+ 1092 0039 05       		.uleb128 0x5
+ 1093 003a 34       		.uleb128 0x34
+ 1094 003b 00       		.byte	0
+ 1095 003c 47       		.uleb128 0x47
+ 1096 003d 13       		.uleb128 0x13
+ 1097 003e 3A       		.uleb128 0x3a
+ 1098 003f 21       		.uleb128 0x21
+ 1099 0040 04       		.sleb128 4
+ 1100 0041 3B       		.uleb128 0x3b
+ 1101 0042 0B       		.uleb128 0xb
+ 1102 0043 39       		.uleb128 0x39
+ 1103 0044 21       		.uleb128 0x21
+ 1104 0045 1E       		.sleb128 30
+ 1105 0046 02       		.uleb128 0x2
+ 1106 0047 18       		.uleb128 0x18
+ 1107 0048 00       		.byte	0
+ 1108 0049 00       		.byte	0
+ 1109 004a 06       		.uleb128 0x6
+ 1110 004b 16       		.uleb128 0x16
+ 1111 004c 00       		.byte	0
+ 1112 004d 03       		.uleb128 0x3
+ 1113 004e 0E       		.uleb128 0xe
+ 1114 004f 3A       		.uleb128 0x3a
+ 1115 0050 0B       		.uleb128 0xb
+ 1116 0051 3B       		.uleb128 0x3b
+ 1117 0052 0B       		.uleb128 0xb
+ 1118 0053 39       		.uleb128 0x39
+ 1119 0054 0B       		.uleb128 0xb
+ 1120 0055 49       		.uleb128 0x49
+ 1121 0056 13       		.uleb128 0x13
+ 1122 0057 00       		.byte	0
+ 1123 0058 00       		.byte	0
+ 1124 0059 07       		.uleb128 0x7
+ 1125 005a 0D       		.uleb128 0xd
+ 1126 005b 00       		.byte	0
+ 1127 005c 03       		.uleb128 0x3
+ 1128 005d 0E       		.uleb128 0xe
+ 1129 005e 3A       		.uleb128 0x3a
+ 1130 005f 21       		.uleb128 0x21
+ 1131 0060 01       		.sleb128 1
+ 1132 0061 3B       		.uleb128 0x3b
+ 1133 0062 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccb9bXR3.s 			page 64
+
+
+ 1134 0063 39       		.uleb128 0x39
+ 1135 0064 0B       		.uleb128 0xb
+ 1136 0065 49       		.uleb128 0x49
+ 1137 0066 13       		.uleb128 0x13
+ 1138 0067 38       		.uleb128 0x38
+ 1139 0068 0B       		.uleb128 0xb
+ 1140 0069 00       		.byte	0
+ 1141 006a 00       		.byte	0
+ 1142 006b 08       		.uleb128 0x8
+ 1143 006c 0F       		.uleb128 0xf
+ 1144 006d 00       		.byte	0
+ 1145 006e 0B       		.uleb128 0xb
+ 1146 006f 21       		.uleb128 0x21
+ 1147 0070 08       		.sleb128 8
+ 1148 0071 49       		.uleb128 0x49
+ 1149 0072 13       		.uleb128 0x13
+ 1150 0073 00       		.byte	0
+ 1151 0074 00       		.byte	0
+ 1152 0075 09       		.uleb128 0x9
+ 1153 0076 01       		.uleb128 0x1
+ 1154 0077 01       		.byte	0x1
+ 1155 0078 49       		.uleb128 0x49
+ 1156 0079 13       		.uleb128 0x13
+ 1157 007a 01       		.uleb128 0x1
+ 1158 007b 13       		.uleb128 0x13
+ 1159 007c 00       		.byte	0
+ 1160 007d 00       		.byte	0
+ 1161 007e 0A       		.uleb128 0xa
+ 1162 007f 11       		.uleb128 0x11
+ 1163 0080 01       		.byte	0x1
+ 1164 0081 25       		.uleb128 0x25
+ 1165 0082 0E       		.uleb128 0xe
+ 1166 0083 13       		.uleb128 0x13
+ 1167 0084 0B       		.uleb128 0xb
+ 1168 0085 03       		.uleb128 0x3
+ 1169 0086 1F       		.uleb128 0x1f
+ 1170 0087 1B       		.uleb128 0x1b
+ 1171 0088 1F       		.uleb128 0x1f
+ 1172 0089 10       		.uleb128 0x10
+ 1173 008a 17       		.uleb128 0x17
+ 1174 008b 00       		.byte	0
+ 1175 008c 00       		.byte	0
+ 1176 008d 0B       		.uleb128 0xb
+ 1177 008e 24       		.uleb128 0x24
+ 1178 008f 00       		.byte	0
+ 1179 0090 0B       		.uleb128 0xb
+ 1180 0091 0B       		.uleb128 0xb
+ 1181 0092 3E       		.uleb128 0x3e
+ 1182 0093 0B       		.uleb128 0xb
+ 1183 0094 03       		.uleb128 0x3
+ 1184 0095 08       		.uleb128 0x8
+ 1185 0096 00       		.byte	0
+ 1186 0097 00       		.byte	0
+ 1187 0098 0C       		.uleb128 0xc
+ 1188 0099 13       		.uleb128 0x13
+ 1189 009a 01       		.byte	0x1
+ 1190 009b 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccb9bXR3.s 			page 65
+
+
+ 1191 009c 0B       		.uleb128 0xb
+ 1192 009d 3A       		.uleb128 0x3a
+ 1193 009e 0B       		.uleb128 0xb
+ 1194 009f 3B       		.uleb128 0x3b
+ 1195 00a0 0B       		.uleb128 0xb
+ 1196 00a1 39       		.uleb128 0x39
+ 1197 00a2 0B       		.uleb128 0xb
+ 1198 00a3 01       		.uleb128 0x1
+ 1199 00a4 13       		.uleb128 0x13
+ 1200 00a5 00       		.byte	0
+ 1201 00a6 00       		.byte	0
+ 1202 00a7 0D       		.uleb128 0xd
+ 1203 00a8 21       		.uleb128 0x21
+ 1204 00a9 00       		.byte	0
+ 1205 00aa 49       		.uleb128 0x49
+ 1206 00ab 13       		.uleb128 0x13
+ 1207 00ac 2F       		.uleb128 0x2f
+ 1208 00ad 0B       		.uleb128 0xb
+ 1209 00ae 00       		.byte	0
+ 1210 00af 00       		.byte	0
+ 1211 00b0 0E       		.uleb128 0xe
+ 1212 00b1 21       		.uleb128 0x21
+ 1213 00b2 00       		.byte	0
+ 1214 00b3 49       		.uleb128 0x49
+ 1215 00b4 13       		.uleb128 0x13
+ 1216 00b5 2F       		.uleb128 0x2f
+ 1217 00b6 05       		.uleb128 0x5
+ 1218 00b7 00       		.byte	0
+ 1219 00b8 00       		.byte	0
+ 1220 00b9 00       		.byte	0
+ 1221              		.section	.debug_aranges,"",@progbits
+ 1222 0000 1C000000 		.long	0x1c
+ 1223 0004 0200     		.value	0x2
+ 1224 0006 00000000 		.long	.Ldebug_info0
+ 1225 000a 08       		.byte	0x8
+ 1226 000b 00       		.byte	0
+ 1227 000c 0000     		.value	0
+ 1228 000e 0000     		.value	0
+ 1229 0010 00000000 		.quad	0
+ 1229      00000000 
+ 1230 0018 00000000 		.quad	0
+ 1230      00000000 
+ 1231              		.section	.debug_line,"",@progbits
+ 1232              	.Ldebug_line0:
+ 1233 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1233      05000800 
+ 1233      49000000 
+ 1233      010101FB 
+ 1233      0E0D0001 
+ 1234              	.LASF20:
+ 1235 0000 736F6674 		.string	"soft_data"
+ 1235      5F646174 
+ 1235      6100
+ 1236              	.LASF12:
+ 1237 000a 73697A65 		.string	"size_t"
+ 1237      5F7400
+ 1238              	.LASF13:
+GAS LISTING /tmp/ccb9bXR3.s 			page 66
+
+
+ 1239 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1239      6D61705F 
+ 1239      636F6C6F 
+ 1239      72736368 
+ 1239      656D655F 
+ 1240              	.LASF14:
+ 1241 0027 68656174 		.string	"heatmap_cs_Oranges_discrete"
+ 1241      6D61705F 
+ 1241      63735F4F 
+ 1241      72616E67 
+ 1241      65735F64 
+ 1242              	.LASF26:
+ 1243 0043 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1243      43313720 
+ 1243      31322E32 
+ 1243      2E30202D 
+ 1243      6D74756E 
+ 1244              	.LASF6:
+ 1245 00a2 666C6F61 		.string	"float"
+ 1245      7400
+ 1246              	.LASF11:
+ 1247 00a8 756E7369 		.string	"unsigned char"
+ 1247      676E6564 
+ 1247      20636861 
+ 1247      7200
+ 1248              	.LASF3:
+ 1249 00b6 6C6F6E67 		.string	"long unsigned int"
+ 1249      20756E73 
+ 1249      69676E65 
+ 1249      6420696E 
+ 1249      7400
+ 1250              	.LASF8:
+ 1251 00c8 73686F72 		.string	"short unsigned int"
+ 1251      7420756E 
+ 1251      7369676E 
+ 1251      65642069 
+ 1251      6E7400
+ 1252              	.LASF25:
+ 1253 00db 6D697865 		.string	"mixed_exp"
+ 1253      645F6578 
+ 1253      7000
+ 1254              	.LASF23:
+ 1255 00e5 6D697865 		.string	"mixed"
+ 1255      6400
+ 1256              	.LASF16:
+ 1257 00eb 68656174 		.string	"heatmap_cs_Oranges_mixed"
+ 1257      6D61705F 
+ 1257      63735F4F 
+ 1257      72616E67 
+ 1257      65735F6D 
+ 1258              	.LASF7:
+ 1259 0104 756E7369 		.string	"unsigned int"
+ 1259      676E6564 
+ 1259      20696E74 
+ 1259      00
+ 1260              	.LASF19:
+ 1261 0111 64697363 		.string	"discrete"
+GAS LISTING /tmp/ccb9bXR3.s 			page 67
+
+
+ 1261      72657465 
+ 1261      00
+ 1262              	.LASF10:
+ 1263 011a 6E636F6C 		.string	"ncolors"
+ 1263      6F727300 
+ 1264              	.LASF4:
+ 1265 0122 6C6F6E67 		.string	"long long int"
+ 1265      206C6F6E 
+ 1265      6720696E 
+ 1265      7400
+ 1266              	.LASF24:
+ 1267 0130 6D697865 		.string	"mixed_exp_data"
+ 1267      645F6578 
+ 1267      705F6461 
+ 1267      746100
+ 1268              	.LASF15:
+ 1269 013f 68656174 		.string	"heatmap_cs_Oranges_soft"
+ 1269      6D61705F 
+ 1269      63735F4F 
+ 1269      72616E67 
+ 1269      65735F73 
+ 1270              	.LASF22:
+ 1271 0157 6D697865 		.string	"mixed_data"
+ 1271      645F6461 
+ 1271      746100
+ 1272              	.LASF2:
+ 1273 0162 6C6F6E67 		.string	"long int"
+ 1273      20696E74 
+ 1273      00
+ 1274              	.LASF5:
+ 1275 016b 6C6F6E67 		.string	"long double"
+ 1275      20646F75 
+ 1275      626C6500 
+ 1276              	.LASF18:
+ 1277 0177 64697363 		.string	"discrete_data"
+ 1277      72657465 
+ 1277      5F646174 
+ 1277      6100
+ 1278              	.LASF21:
+ 1279 0185 736F6674 		.string	"soft"
+ 1279      00
+ 1280              	.LASF9:
+ 1281 018a 636F6C6F 		.string	"colors"
+ 1281      727300
+ 1282              	.LASF17:
+ 1283 0191 68656174 		.string	"heatmap_cs_Oranges_mixed_exp"
+ 1283      6D61705F 
+ 1283      63735F4F 
+ 1283      72616E67 
+ 1283      65735F6D 
+ 1284              		.section	.debug_line_str,"MS",@progbits,1
+ 1285              	.LASF1:
+ 1286 0000 2F726F6F 		.string	"/root/repo"
+ 1286      742F7265 
+ 1286      706F00
+ 1287              	.LASF0:
+ 1288 000b 636F6C6F 		.string	"colorschemes/Oranges.c"
+GAS LISTING /tmp/ccb9bXR3.s 			page 68
+
+
+ 1288      72736368 
+ 1288      656D6573 
+ 1288      2F4F7261 
+ 1288      6E676573 
+ 1289              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1290 0022 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1290      742F7265 
+ 1290      706F0063 
+ 1290      6F6C6F72 
+ 1290      73636865 
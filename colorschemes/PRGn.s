@@ -0,0 +1,3789 @@
+GAS LISTING /tmp/cciiIuFx.s 			page 1
+
+
+   1              		.file	"PRGn.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/PRGn.c"
+   5              		.globl	heatmap_cs_PRGn_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_PRGn_mixed_exp, @object
+   9              		.size	heatmap_cs_PRGn_mixed_exp, 8
+  10              	heatmap_cs_PRGn_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 00       		.string	""
+  29 0005 441A00   		.string	"D\032"
+  30 0008 01471D18 		.ascii	"\001G\035\030\002K\0371\004O!J\006S#c\bW%|\020e-\225\022i/\256"
+  30      024B1F31 
+  30      044F214A 
+  30      06532363 
+  30      0857257C 
+  31 0024 156D31C7 		.ascii	"\025m1\307\027q3\340\031u5\371\034x7\377!|:\377&\200=\377+\204"
+  31      177133E0 
+  31      197535F9 
+  31      1C7837FF 
+  31      217C3AFF 
+  32 003e 40FF2F87 		.ascii	"@\377/\207C\3773\213F\377D\231Q\377H\235T\377L\241V\377P\244"
+  32      43FF338B 
+  32      46FF4499 
+  32      51FF489D 
+  32      54FF4CA1 
+  33 0056 59FF53A8 		.ascii	"Y\377S\250\\\377W\253_\377\\\257b\377a\261f\377f\264j\377k\267"
+  33      5CFF57AB 
+  33      5FFF5CAF 
+  33      62FF61B1 
+  33      66FF66B4 
+  34 006e 6EFF6FBA 		.ascii	"n\377o\272q\377t\275u\377y\277y\377\214\313\211\377\221\316\215"
+  34      71FF74BD 
+  34      75FF79BF 
+  34      79FF8CCB 
+  34      89FF91CE 
+GAS LISTING /tmp/cciiIuFx.s 			page 2
+
+
+  35 0083 FF95D091 		.ascii	"\377\225\320\221\377\231\323\225\377\236\326\230\377\242\330"
+  35      FF99D395 
+  35      FF9ED698 
+  35      FFA2D8
+  36 0092 9CFFA6DB 		.ascii	"\234\377\246\333\240\377\251\334\243\377\254\335\245\377\257"
+  36      A0FFA9DC 
+  36      A3FFACDD 
+  36      A5FFAF
+  37 00a1 DEA8FFB2 		.ascii	"\336\250\377\262\337\253\377\264\340\256\377\267\342\260\377"
+  37      DFABFFB4 
+  37      E0AEFFB7 
+  37      E2B0FF
+  38 00b0 BAE3B3FF 		.ascii	"\272\343\263\377\307\350\300\377\311\351\303\377\314\352\305"
+  38      C7E8C0FF 
+  38      C9E9C3FF 
+  38      CCEAC5
+  39 00bf FFCFEBC8 		.ascii	"\377\317\353\310\377\321\354\313\377\324\355\315\377\326\356"
+  39      FFD1ECCB 
+  39      FFD4EDCD 
+  39      FFD6EE
+  40 00ce D0FFD9EF 		.ascii	"\320\377\331\357\322\377\336\357\322\377\343\357\322\377\347"
+  40      D2FFDEEF 
+  40      D2FFE3EF 
+  40      D2FFE7
+  41 00dd EED2FFEB 		.ascii	"\356\322\377\353\356\324\377\357\355\325\377\361\355\330\377"
+  41      EED4FFEF 
+  41      EDD5FFF1 
+  41      EDD8FF
+  42 00ec F3EDDAFF 		.ascii	"\363\355\332\377\365\356\335\377\374\357\346\377\374\360\351"
+  42      F5EEDDFF 
+  42      FCEFE6FF 
+  42      FCF0E9
+  43 00fb FFFCF0EC 		.ascii	"\377\374\360\354\377\374\361\356\377\373\362\360\377\372\363"
+  43      FFFCF1EE 
+  43      FFFBF2F0 
+  43      FFFAF3
+  44 010a F2FFF9F4 		.ascii	"\362\377\371\364\364\377\370\365\365\377\367\366\366\377\366"
+  44      F4FFF8F5 
+  44      F5FFF7F6 
+  44      F6FFF6
+  45 0119 F6F6FFF6 		.ascii	"\366\366\377\366\364\365\377\366\363\364\377\366\361\363\377"
+  45      F4F5FFF6 
+  45      F3F4FFF6 
+  45      F1F3FF
+  46 0128 F5F0F2FF 		.ascii	"\365\360\362\377\365\356\361\377\365\355\360\377\364\353\357"
+  46      F5EEF1FF 
+  46      F5EDF0FF 
+  46      F4EBEF
+  47 0137 FFF4EAEF 		.ascii	"\377\364\352\357\377\363\351\356\377\357\340\353\377\357\337"
+  47      FFF3E9EE 
+  47      FFEFE0EB 
+  47      FFEFDF
+  48 0146 EAFFEEDE 		.ascii	"\352\377\356\336\352\377\355\334\351\377\355\333\351\377\354"
+  48      EAFFEDDC 
+  48      E9FFEDDB 
+  48      E9FFEC
+  49 0155 DAE9FFEB 		.ascii	"\332\351\377\353\331\350\377\352\330\350\377\351\326\350\377"
+GAS LISTING /tmp/cciiIuFx.s 			page 3
+
+
+  49      D9E8FFEA 
+  49      D8E8FFE9 
+  49      D6E8FF
+  50 0164 E8D5E8FF 		.ascii	"\350\325\350\377\347\324\350\377\346\323\347\377\345\321\346"
+  50      E7D4E8FF 
+  50      E6D3E7FF 
+  50      E5D1E6
+  51 0173 FFE4D0E5 		.ascii	"\377\344\320\345\377\343\316\344\377\341\314\344\377\340\313"
+  51      FFE3CEE4 
+  51      FFE1CCE4 
+  51      FFE0CB
+  52 0182 E3FFDFC9 		.ascii	"\343\377\337\311\342\377\336\310\341\377\335\306\340\377\334"
+  52      E2FFDEC8 
+  52      E1FFDDC6 
+  52      E0FFDC
+  53 0191 C5DFFFDB 		.ascii	"\305\337\377\333\303\337\377\332\302\336\377\330\300\335\377"
+  53      C3DFFFDA 
+  53      C2DEFFD8 
+  53      C0DDFF
+  54 01a0 D0B6D7FF 		.ascii	"\320\266\327\377\317\264\327\377\316\263\326\377\315\261\325"
+  54      CFB4D7FF 
+  54      CEB3D6FF 
+  54      CDB1D5
+  55 01af FFCBB0D4 		.ascii	"\377\313\260\324\377\312\257\324\377\311\255\323\377\310\254"
+  55      FFCAAFD4 
+  55      FFC9ADD3 
+  55      FFC8AC
+  56 01be D2FFC7AB 		.ascii	"\322\377\307\253\322\377\306\252\321\377\305\250\320\377\304"
+  56      D2FFC6AA 
+  56      D1FFC5A8 
+  56      D0FFC4
+  57 01cd A7D0FFC3 		.ascii	"\247\320\377\303\246\317\377\302\245\317\377\301\243\316\377"
+  57      A6CFFFC2 
+  57      A5CFFFC1 
+  57      A3CEFF
+  58 01dc BFA2CDFF 		.ascii	"\277\242\315\377\276\240\314\377\275\237\313\377\274\236\312"
+  58      BEA0CCFF 
+  58      BD9FCBFF 
+  58      BC9ECA
+  59 01eb FFBB9CC9 		.ascii	"\377\273\234\311\377\272\233\310\377\271\232\307\377\270\230"
+  59      FFBA9BC8 
+  59      FFB99AC7 
+  59      FFB898
+  60 01fa C6FFB797 		.ascii	"\306\377\267\227\306\377\266\226\305\377\265\225\304\377\264"
+  60      C6FFB696 
+  60      C5FFB595 
+  60      C4FFB4
+  61 0209 93C3FFB3 		.ascii	"\223\303\377\263\222\302\377\262\221\301\377\262\220\301\377"
+  61      92C2FFB2 
+  61      91C1FFB2 
+  61      90C1FF
+  62 0218 A884B8FF 		.ascii	"\250\204\270\377\247\203\270\377\247\202\267\377\246\200\266"
+  62      A783B8FF 
+  62      A782B7FF 
+  62      A680B6
+  63 0227 FFA57FB5 		.ascii	"\377\245\177\265\377\244~\265\377\243}\264\377\242|\263\377\241"
+  63      FFA47EB5 
+GAS LISTING /tmp/cciiIuFx.s 			page 4
+
+
+  63      FFA37DB4 
+  63      FFA27CB3 
+  63      FFA1
+  64 0239 7BB2FFA1 		.ascii	"{\262\377\241z\262\377\240y\261\377\237x\260\377\236w\257\377"
+  64      7AB2FFA0 
+  64      79B1FF9F 
+  64      78B0FF9E 
+  64      77AFFF
+  65 024c 9D76AFFF 		.ascii	"\235v\257\377\235u\256\377\234t\255\377\233s\255\377\232r\254"
+  65      9D75AEFF 
+  65      9C74ADFF 
+  65      9B73ADFF 
+  65      9A72AC
+  66 025f FF9971AB 		.ascii	"\377\231q\253\377\231p\253\377\230o\252\377\227m\251\377\227"
+  66      FF9970AB 
+  66      FF986FAA 
+  66      FF976DA9 
+  66      FF97
+  67 0271 6CA9FF96 		.ascii	"l\251\377\226k\250\377\225j\247\377\225i\247\377\224h\246\377"
+  67      6BA8FF95 
+  67      6AA7FF95 
+  67      69A7FF94 
+  67      68A6FF
+  68 0284 9466A5FF 		.ascii	"\224f\245\377\223e\245\377\222d\244\377\222c\243\377\221b\243"
+  68      9365A5FF 
+  68      9264A4FF 
+  68      9263A3FF 
+  68      9162A3
+  69 0297 FF9161A2 		.ascii	"\377\221a\242\377\220`\241\377\217_\241\377\217^\240\377\216"
+  69      FF9060A1 
+  69      FF8F5FA1 
+  69      FF8F5EA0 
+  69      FF8E
+  70 02a9 5DA0FF8E 		.ascii	"]\240\377\216\\\237\377\215[\236\377\215Z\236\377\214Y\235\377"
+  70      5C9FFF8D 
+  70      5B9EFF8D 
+  70      5A9EFF8C 
+  70      599DFF
+  71 02bc 8C589DFF 		.ascii	"\214X\235\377\213W\234\377\213V\234\377\203G\223\377\203F\222"
+  71      8B579CFF 
+  71      8B569CFF 
+  71      834793FF 
+  71      834692
+  72 02cf FF824592 		.ascii	"\377\202E\222\377\202D\221\377\201C\221\377\201B\220\377\200"
+  72      FF824491 
+  72      FF814391 
+  72      FF814290 
+  72      FF80
+  73 02e1 4190FF80 		.ascii	"A\220\377\200@\217\377\177?\217\377\177>\216\377\177=\216\377"
+  73      408FFF7F 
+  73      3F8FFF7F 
+  73      3E8EFF7F 
+  73      3D8EFF
+  74 02f4 7E3D8DFF 		.ascii	"~=\215\377~<\214\377};\214\377}:\213\377|9\213\377|8\212\377"
+  74      7E3C8CFF 
+  74      7D3B8CFF 
+  74      7D3A8BFF 
+GAS LISTING /tmp/cciiIuFx.s 			page 5
+
+
+  74      7C398BFF 
+  75 030c 7C378AFF 		.ascii	"|7\212\377{6\212\377{6\211\377z5\211\377z4\210\377z3\210\377"
+  75      7B368AFF 
+  75      7B3689FF 
+  75      7A3589FF 
+  75      7A3488FF 
+  76 0324 793287FF 		.ascii	"y2\207\377y1\207\377y1\206\377x0\206\377x/\205\377w.\205\377"
+  76      793187FF 
+  76      793186FF 
+  76      783086FF 
+  76      782F85FF 
+  77 033c 772D84FF 		.ascii	"w-\204\377w,\204\377v,\204\377v+\203\377v*\203\377u)\202\377"
+  77      772C84FF 
+  77      762C84FF 
+  77      762B83FF 
+  77      762A83FF 
+  78 0354 752982FF 		.ascii	"u)\202\377t)\201\377t(\201\377s(\200\377s'\177\377r'\177\377"
+  78      742981FF 
+  78      742881FF 
+  78      732880FF 
+  78      73277FFF 
+  79 036c 72277EFF 		.ascii	"r'~\377q&~\377q&}\377p&}\377p%|\377o%|\377o${\377n${\377n$z\377"
+  79      71267EFF 
+  79      71267DFF 
+  79      70267DFF 
+  79      70257CFF 
+  80 0390 6D237AFF 		.ascii	"m#z\377m#y\377l#y\377l\"y\377k\"x\377k\"x\377k\"w\377j!w\377"
+  80      6D2379FF 
+  80      6C2379FF 
+  80      6C2279FF 
+  80      6B2278FF 
+  81 03b0 6A2176FF 		.ascii	"j!v\377i!v\377i u\377i u\377h u\377h\037t\377g\037t\377g\037"
+  81      692176FF 
+  81      692075FF 
+  81      692075FF 
+  81      682075FF 
+  82 03ce 73FF671F 		.ascii	"s\377g\037s\377f\036s\377f\036r\377f\036r\377e\035r\377e\035"
+  82      73FF661E 
+  82      73FF661E 
+  82      72FF661E 
+  82      72FF651D 
+  83 03e6 71FF641D 		.ascii	"q\377d\035q\377d\035p\377d\034p\377c\034p\377c\034o\377c\034"
+  83      71FF641D 
+  83      70FF641C 
+  83      70FF631C 
+  83      70FF631C 
+  84 03fe 6FFF621B 		.ascii	"o\377b\033o\377b\033n\377b\033n\377b\033n\377a\032m\377a\032"
+  84      6FFF621B 
+  84      6EFF621B 
+  84      6EFF621B 
+  84      6EFF611A 
+  85 0416 6DFF611A 		.ascii	"m\377a\032m\377`\032l\377`\031l\377`\031l\377_\031l\377T\020"
+  85      6DFF601A 
+  85      6CFF6019 
+  85      6CFF6019 
+  85      6CFF5F19 
+  86 042e 60FF5410 		.ascii	"`\377T\020`\377T\020`\377T\020_\377S\017_\377S\017_\377S\017"
+GAS LISTING /tmp/cciiIuFx.s 			page 6
+
+
+  86      60FF5410 
+  86      60FF5410 
+  86      5FFF530F 
+  86      5FFF530F 
+  87 0446 5EFF520F 		.ascii	"^\377R\017^\377R\017^\377R\016^\377R\016]\377Q\016]\377Q\016"
+  87      5EFF520F 
+  87      5EFF520E 
+  87      5EFF520E 
+  87      5DFF510E 
+  88 045e 5DFF510E 		.ascii	"]\377Q\016]\377Q\r\\\377Q\r\\\377P\r\\\377P\r\\\377P\r[\377P"
+  88      5DFF510D 
+  88      5CFF510D 
+  88      5CFF500D 
+  88      5CFF500D 
+  89 0479 0C5BFF4F 		.ascii	"\f[\377O\f[\377O\f[\377O\fZ\377O\fZ\377O\fZ\377N\013Z\377N\013"
+  89      0C5BFF4F 
+  89      0C5BFF4F 
+  89      0C5AFF4F 
+  89      0C5AFF4F 
+  90 0496 5AFF4E0B 		.ascii	"Z\377N\013Y\377N\013Y\377N\013Y\377M\nY\377M\nY\377M\nX\377M"
+  90      59FF4E0B 
+  90      59FF4E0B 
+  90      59FF4D0A 
+  90      59FF4D0A 
+  91 04b1 0A58FF4D 		.ascii	"\nX\377M\nX\377L\nX\377L\tX\377L\tW\377L\tW\377L\tW\377L\tW\377"
+  91      0A58FF4C 
+  91      0A58FF4C 
+  91      0958FF4C 
+  91      0957FF4C 
+  92 04d0 4B0957FF 		.ascii	"K\tW\377K\tW\377K\bV\377K\bV\377K\bV\377K\bV\377J\bV\377J\bV"
+  92      4B0957FF 
+  92      4B0856FF 
+  92      4B0856FF 
+  92      4B0856FF 
+  93 04ef FF4A0855 		.ascii	"\377J\bU\377J\007U\377J\007U\377J\007U\377I\007U\377I\007U\377"
+  93      FF4A0755 
+  93      FF4A0755 
+  93      FF4A0755 
+  93      FF490755 
+  94 0508 490755FF 		.ascii	"I\007U\377I\007T\377I\006T\377I\006T\377I\006T\377I\006T\377"
+  94      490754FF 
+  94      490654FF 
+  94      490654FF 
+  94      490654FF 
+  95 0520 480654FF 		.ascii	"H\006T\377H\006T\377H\006S\377H\006S\377H\006S\377H\005S\377"
+  95      480654FF 
+  95      480653FF 
+  95      480653FF 
+  95      480653FF 
+  96 0538 480553FF 		.ascii	"H\005S\377H\005S\377G\005S\377G\005S\377G\005R\377G\005R\377"
+  96      480553FF 
+  96      470553FF 
+  96      470553FF 
+  96      470552FF 
+  97 0550 470552FF 		.ascii	"G\005R\377G\005R\377G\005R\377G\004R\377G\004R\377F\004R\377"
+  97      470552FF 
+  97      470552FF 
+GAS LISTING /tmp/cciiIuFx.s 			page 7
+
+
+  97      470452FF 
+  97      470452FF 
+  98 0568 460452FF 		.ascii	"F\004R\377F\004Q\377F\004Q\377F\004Q\377F\004Q\377F\004Q\377"
+  98      460451FF 
+  98      460451FF 
+  98      460451FF 
+  98      460451FF 
+  99 0580 460451FF 		.ascii	"F\004Q\377F\004Q\377F\004Q\377E\004Q\377E\003Q\377E\003P\377"
+  99      460451FF 
+  99      460451FF 
+  99      450451FF 
+  99      450351FF 
+ 100 0598 450350FF 		.ascii	"E\003P\377E\003P\377E\003P\377E\003P\377E\003P\377E\003P\377"
+ 100      450350FF 
+ 100      450350FF 
+ 100      450350FF 
+ 100      450350FF 
+ 101 05b0 450350FF 		.ascii	"E\003P\377E\003P\377E\003P\377D\003P\377D\003P\377D\003O\377"
+ 101      450350FF 
+ 101      450350FF 
+ 101      440350FF 
+ 101      440350FF 
+ 102 05c8 44034FFF 		.ascii	"D\003O\377D\003O\377D"
+ 102      44034FFF 
+ 102      44
+ 103 05d1 034FFF44 		.string	"\003O\377D\002O\377D\002O\377D\002O\377D\002O\377D\002O\377D\002O\377D\002O\377D\002O\377
+ 103      024FFF44 
+ 103      024FFF44 
+ 103      024FFF44 
+ 103      024FFF44 
+ 104 06d2 4CFF4100 		.string	"L\377A"
+ 105 06d6 4CFF4100 		.string	"L\377A"
+ 106 06da 4CFF4100 		.string	"L\377A"
+ 107 06de 4CFF4100 		.string	"L\377A"
+ 108 06e2 4CFF4100 		.string	"L\377A"
+ 109 06e6 4CFF4100 		.string	"L\377A"
+ 110 06ea 4CFF4100 		.string	"L\377A"
+ 111 06ee 4CFF4100 		.string	"L\377A"
+ 112 06f2 4CFF4100 		.string	"L\377A"
+ 113 06f6 4CFF4100 		.string	"L\377A"
+ 114 06fa 4CFF4100 		.string	"L\377A"
+ 115 06fe 4CFF4100 		.string	"L\377A"
+ 116 0702 4CFF4100 		.string	"L\377A"
+ 117 0706 4CFF4100 		.string	"L\377A"
+ 118 070a 4CFF4100 		.string	"L\377A"
+ 119 070e 4CFF4100 		.string	"L\377A"
+ 120 0712 4CFF4100 		.string	"L\377A"
+ 121 0716 4CFF4100 		.string	"L\377A"
+ 122 071a 4CFF4100 		.string	"L\377A"
+ 123 071e 4CFF4100 		.string	"L\377A"
+ 124 0722 4CFF4100 		.string	"L\377A"
+ 125 0726 4CFF4100 		.string	"L\377A"
+ 126 072a 4CFF4100 		.string	"L\377A"
+ 127 072e 4CFF4100 		.string	"L\377A"
+ 128 0732 4CFF4100 		.string	"L\377A"
+ 129 0736 4CFF4100 		.string	"L\377A"
+ 130 073a 4CFF4100 		.string	"L\377A"
+GAS LISTING /tmp/cciiIuFx.s 			page 8
+
+
+ 131 073e 4CFF4100 		.string	"L\377A"
+ 132 0742 4CFF4000 		.string	"L\377@"
+ 133 0746 4CFF4000 		.string	"L\377@"
+ 134 074a 4CFF4000 		.string	"L\377@"
+ 135 074e 4BFF4000 		.string	"K\377@"
+ 136 0752 4BFF4000 		.string	"K\377@"
+ 137 0756 4BFF4000 		.string	"K\377@"
+ 138 075a 4BFF4000 		.string	"K\377@"
+ 139 075e 4BFF4000 		.string	"K\377@"
+ 140 0762 4BFF4000 		.string	"K\377@"
+ 141 0766 4BFF4000 		.string	"K\377@"
+ 142 076a 4BFF4000 		.string	"K\377@"
+ 143 076e 4BFF4000 		.string	"K\377@"
+ 144 0772 4BFF4000 		.string	"K\377@"
+ 145 0776 4BFF4000 		.string	"K\377@"
+ 146 077a 4BFF4000 		.string	"K\377@"
+ 147 077e 4BFF4000 		.string	"K\377@"
+ 148 0782 4BFF4000 		.string	"K\377@"
+ 149 0786 4BFF4000 		.string	"K\377@"
+ 150 078a 4BFF4000 		.string	"K\377@"
+ 151 078e 4BFF4000 		.string	"K\377@"
+ 152 0792 4BFF4000 		.string	"K\377@"
+ 153 0796 4BFF4000 		.string	"K\377@"
+ 154 079a 4BFF4000 		.string	"K\377@"
+ 155 079e 4BFF4000 		.string	"K\377@"
+ 156 07a2 4BFF4000 		.string	"K\377@"
+ 157 07a6 4BFF4000 		.string	"K\377@"
+ 158 07aa 4BFF4000 		.string	"K\377@"
+ 159 07ae 4BFF4000 		.string	"K\377@"
+ 160 07b2 4BFF4000 		.string	"K\377@"
+ 161 07b6 4BFF4000 		.string	"K\377@"
+ 162 07ba 4BFF4000 		.string	"K\377@"
+ 163 07be 4BFF4000 		.string	"K\377@"
+ 164 07c2 4BFF4000 		.string	"K\377@"
+ 165 07c6 4BFF4000 		.string	"K\377@"
+ 166 07ca 4BFF4000 		.string	"K\377@"
+ 167 07ce 4BFF     		.ascii	"K\377"
+ 168 07d0 4000     		.string	"@"
+ 169 07d2 4BFF4000 		.string	"K\377@"
+ 170 07d6 4BFF4000 		.string	"K\377@"
+ 171 07da 4BFF4000 		.string	"K\377@"
+ 172 07de 4BFF4000 		.string	"K\377@"
+ 173 07e2 4BFF4000 		.string	"K\377@"
+ 174 07e6 4BFF4000 		.string	"K\377@"
+ 175 07ea 4BFF4000 		.string	"K\377@"
+ 176 07ee 4BFF4000 		.string	"K\377@"
+ 177 07f2 4BFF4000 		.string	"K\377@"
+ 178 07f6 4BFF4000 		.string	"K\377@"
+ 179 07fa 4BFF4000 		.string	"K\377@"
+ 180 07fe 4BFF4000 		.string	"K\377@"
+ 181 0802 4BFF4000 		.string	"K\377@"
+ 182 0806 4BFF4000 		.string	"K\377@"
+ 183 080a 4BFF4000 		.string	"K\377@"
+ 184 080e 4BFF4000 		.string	"K\377@"
+ 185 0812 4BFF4000 		.string	"K\377@"
+ 186 0816 4BFF4000 		.string	"K\377@"
+ 187 081a 4BFF4000 		.string	"K\377@"
+GAS LISTING /tmp/cciiIuFx.s 			page 9
+
+
+ 188 081e 4BFF4000 		.string	"K\377@"
+ 189 0822 4BFF4000 		.string	"K\377@"
+ 190 0826 4BFF4000 		.string	"K\377@"
+ 191 082a 4BFF4000 		.string	"K\377@"
+ 192 082e 4BFF4000 		.string	"K\377@"
+ 193 0832 4BFF4000 		.string	"K\377@"
+ 194 0836 4BFF4000 		.string	"K\377@"
+ 195 083a 4BFF4000 		.string	"K\377@"
+ 196 083e 4BFF4000 		.string	"K\377@"
+ 197 0842 4BFF4000 		.string	"K\377@"
+ 198 0846 4BFF4000 		.string	"K\377@"
+ 199 084a 4BFF4000 		.string	"K\377@"
+ 200 084e 4BFF4000 		.string	"K\377@"
+ 201 0852 4BFF4000 		.string	"K\377@"
+ 202 0856 4BFF4000 		.string	"K\377@"
+ 203 085a 4BFF4000 		.string	"K\377@"
+ 204 085e 4BFF4000 		.string	"K\377@"
+ 205 0862 4BFF4000 		.string	"K\377@"
+ 206 0866 4BFF4000 		.string	"K\377@"
+ 207 086a 4BFF4000 		.string	"K\377@"
+ 208 086e 4BFF4000 		.string	"K\377@"
+ 209 0872 4BFF4000 		.string	"K\377@"
+ 210 0876 4BFF4000 		.string	"K\377@"
+ 211 087a 4BFF4000 		.string	"K\377@"
+ 212 087e 4BFF4000 		.string	"K\377@"
+ 213 0882 4BFF4000 		.string	"K\377@"
+ 214 0886 4BFF4000 		.string	"K\377@"
+ 215 088a 4BFF4000 		.string	"K\377@"
+ 216 088e 4BFF4000 		.string	"K\377@"
+ 217 0892 4BFF4000 		.string	"K\377@"
+ 218 0896 4BFF4000 		.string	"K\377@"
+ 219 089a 4BFF4000 		.string	"K\377@"
+ 220 089e 4BFF4000 		.string	"K\377@"
+ 221 08a2 4BFF4000 		.string	"K\377@"
+ 222 08a6 4BFF4000 		.string	"K\377@"
+ 223 08aa 4BFF4000 		.string	"K\377@"
+ 224 08ae 4BFF4000 		.string	"K\377@"
+ 225 08b2 4BFF4000 		.string	"K\377@"
+ 226 08b6 4BFF4000 		.string	"K\377@"
+ 227 08ba 4BFF4000 		.string	"K\377@"
+ 228 08be 4BFF4000 		.string	"K\377@"
+ 229 08c2 4BFF4000 		.string	"K\377@"
+ 230 08c6 4BFF4000 		.string	"K\377@"
+ 231 08ca 4BFF4000 		.string	"K\377@"
+ 232 08ce 4BFF4000 		.string	"K\377@"
+ 233 08d2 4BFF4000 		.string	"K\377@"
+ 234 08d6 4BFF4000 		.string	"K\377@"
+ 235 08da 4BFF4000 		.string	"K\377@"
+ 236 08de 4BFF4000 		.string	"K\377@"
+ 237 08e2 4BFF4000 		.string	"K\377@"
+ 238 08e6 4BFF4000 		.string	"K\377@"
+ 239 08ea 4BFF4000 		.string	"K\377@"
+ 240 08ee 4BFF4000 		.string	"K\377@"
+ 241 08f2 4BFF4000 		.string	"K\377@"
+ 242 08f6 4BFF4000 		.string	"K\377@"
+ 243 08fa 4BFF4000 		.string	"K\377@"
+ 244 08fe 4BFF4000 		.string	"K\377@"
+GAS LISTING /tmp/cciiIuFx.s 			page 10
+
+
+ 245 0902 4BFF4000 		.string	"K\377@"
+ 246 0906 4BFF4000 		.string	"K\377@"
+ 247 090a 4BFF4000 		.string	"K\377@"
+ 248 090e 4BFF4000 		.string	"K\377@"
+ 249 0912 4BFF4000 		.string	"K\377@"
+ 250 0916 4BFF4000 		.string	"K\377@"
+ 251 091a 4BFF4000 		.string	"K\377@"
+ 252 091e 4BFF4000 		.string	"K\377@"
+ 253 0922 4BFF4000 		.string	"K\377@"
+ 254 0926 4BFF4000 		.string	"K\377@"
+ 255 092a 4BFF4000 		.string	"K\377@"
+ 256 092e 4BFF4000 		.string	"K\377@"
+ 257 0932 4BFF4000 		.string	"K\377@"
+ 258 0936 4BFF4000 		.string	"K\377@"
+ 259 093a 4BFF4000 		.string	"K\377@"
+ 260 093e 4BFF4000 		.string	"K\377@"
+ 261 0942 4BFF4000 		.string	"K\377@"
+ 262 0946 4BFF4000 		.string	"K\377@"
+ 263 094a 4BFF4000 		.string	"K\377@"
+ 264 094e 4BFF4000 		.string	"K\377@"
+ 265 0952 4BFF4000 		.string	"K\377@"
+ 266 0956 4BFF4000 		.string	"K\377@"
+ 267 095a 4BFF4000 		.string	"K\377@"
+ 268 095e 4BFF4000 		.string	"K\377@"
+ 269 0962 4BFF4000 		.string	"K\377@"
+ 270 0966 4BFF4000 		.string	"K\377@"
+ 271 096a 4BFF4000 		.string	"K\377@"
+ 272 096e 4BFF4000 		.string	"K\377@"
+ 273 0972 4BFF4000 		.string	"K\377@"
+ 274 0976 4BFF4000 		.string	"K\377@"
+ 275 097a 4BFF4000 		.string	"K\377@"
+ 276 097e 4BFF4000 		.string	"K\377@"
+ 277 0982 4BFF4000 		.string	"K\377@"
+ 278 0986 4BFF4000 		.string	"K\377@"
+ 279 098a 4BFF4000 		.string	"K\377@"
+ 280 098e 4BFF4000 		.string	"K\377@"
+ 281 0992 4BFF4000 		.string	"K\377@"
+ 282 0996 4BFF4000 		.string	"K\377@"
+ 283 099a 4BFF4000 		.string	"K\377@"
+ 284 099e 4BFF4000 		.string	"K\377@"
+ 285 09a2 4BFF4000 		.string	"K\377@"
+ 286 09a6 4BFF4000 		.string	"K\377@"
+ 287 09aa 4BFF4000 		.string	"K\377@"
+ 288 09ae 4BFF4000 		.string	"K\377@"
+ 289 09b2 4BFF4000 		.string	"K\377@"
+ 290 09b6 4BFF4000 		.string	"K\377@"
+ 291 09ba 4BFF4000 		.string	"K\377@"
+ 292 09be 4BFF4000 		.string	"K\377@"
+ 293 09c2 4BFF4000 		.string	"K\377@"
+ 294 09c6 4BFF4000 		.string	"K\377@"
+ 295 09ca 4BFF4000 		.string	"K\377@"
+ 296 09ce 4BFF4000 		.string	"K\377@"
+ 297 09d2 4BFF4000 		.string	"K\377@"
+ 298 09d6 4BFF4000 		.string	"K\377@"
+ 299 09da 4BFF4000 		.string	"K\377@"
+ 300 09de 4BFF4000 		.string	"K\377@"
+ 301 09e2 4BFF4000 		.string	"K\377@"
+GAS LISTING /tmp/cciiIuFx.s 			page 11
+
+
+ 302 09e6 4BFF4000 		.string	"K\377@"
+ 303 09ea 4BFF4000 		.string	"K\377@"
+ 304 09ee 4BFF4000 		.string	"K\377@"
+ 305 09f2 4BFF4000 		.string	"K\377@"
+ 306 09f6 4BFF4000 		.string	"K\377@"
+ 307 09fa 4BFF4000 		.string	"K\377@"
+ 308 09fe 4BFF4000 		.string	"K\377@"
+ 309 0a02 4BFF4000 		.string	"K\377@"
+ 310 0a06 4BFF4000 		.string	"K\377@"
+ 311 0a0a 4BFF4000 		.string	"K\377@"
+ 312 0a0e 4BFF4000 		.string	"K\377@"
+ 313 0a12 4BFF4000 		.string	"K\377@"
+ 314 0a16 4BFF4000 		.string	"K\377@"
+ 315 0a1a 4BFF4000 		.string	"K\377@"
+ 316 0a1e 4BFF4000 		.string	"K\377@"
+ 317 0a22 4BFF4000 		.string	"K\377@"
+ 318 0a26 4BFF4000 		.string	"K\377@"
+ 319 0a2a 4BFF4000 		.string	"K\377@"
+ 320 0a2e 4BFF4000 		.string	"K\377@"
+ 321 0a32 4BFF4000 		.string	"K\377@"
+ 322 0a36 4BFF4000 		.string	"K\377@"
+ 323 0a3a 4BFF4000 		.string	"K\377@"
+ 324 0a3e 4BFF4000 		.string	"K\377@"
+ 325 0a42 4BFF4000 		.string	"K\377@"
+ 326 0a46 4BFF4000 		.string	"K\377@"
+ 327 0a4a 4BFF4000 		.string	"K\377@"
+ 328 0a4e 4BFF4000 		.string	"K\377@"
+ 329 0a52 4BFF4000 		.string	"K\377@"
+ 330 0a56 4BFF4000 		.string	"K\377@"
+ 331 0a5a 4BFF4000 		.string	"K\377@"
+ 332 0a5e 4BFF4000 		.string	"K\377@"
+ 333 0a62 4BFF4000 		.string	"K\377@"
+ 334 0a66 4BFF4000 		.string	"K\377@"
+ 335 0a6a 4BFF4000 		.string	"K\377@"
+ 336 0a6e 4BFF4000 		.string	"K\377@"
+ 337 0a72 4BFF4000 		.string	"K\377@"
+ 338 0a76 4BFF4000 		.string	"K\377@"
+ 339 0a7a 4BFF4000 		.string	"K\377@"
+ 340 0a7e 4BFF4000 		.string	"K\377@"
+ 341 0a82 4BFF4000 		.string	"K\377@"
+ 342 0a86 4BFF4000 		.string	"K\377@"
+ 343 0a8a 4BFF4000 		.string	"K\377@"
+ 344 0a8e 4BFF4000 		.string	"K\377@"
+ 345 0a92 4BFF4000 		.string	"K\377@"
+ 346 0a96 4BFF4000 		.string	"K\377@"
+ 347 0a9a 4BFF4000 		.string	"K\377@"
+ 348 0a9e 4BFF4000 		.string	"K\377@"
+ 349 0aa2 4BFF4000 		.string	"K\377@"
+ 350 0aa6 4BFF4000 		.string	"K\377@"
+ 351 0aaa 4BFF4000 		.string	"K\377@"
+ 352 0aae 4BFF4000 		.string	"K\377@"
+ 353 0ab2 4BFF4000 		.string	"K\377@"
+ 354 0ab6 4BFF4000 		.string	"K\377@"
+ 355 0aba 4BFF4000 		.string	"K\377@"
+ 356 0abe 4BFF4000 		.string	"K\377@"
+ 357 0ac2 4BFF4000 		.string	"K\377@"
+ 358 0ac6 4BFF4000 		.string	"K\377@"
+GAS LISTING /tmp/cciiIuFx.s 			page 12
+
+
+ 359 0aca 4BFF4000 		.string	"K\377@"
+ 360 0ace 4BFF4000 		.string	"K\377@"
+ 361 0ad2 4BFF4000 		.string	"K\377@"
+ 362 0ad6 4BFF4000 		.string	"K\377@"
+ 363 0ada 4BFF4000 		.string	"K\377@"
+ 364 0ade 4BFF4000 		.string	"K\377@"
+ 365 0ae2 4BFF4000 		.string	"K\377@"
+ 366 0ae6 4BFF4000 		.string	"K\377@"
+ 367 0aea 4BFF4000 		.string	"K\377@"
+ 368 0aee 4BFF4000 		.string	"K\377@"
+ 369 0af2 4BFF4000 		.string	"K\377@"
+ 370 0af6 4BFF4000 		.string	"K\377@"
+ 371 0afa 4BFF4000 		.string	"K\377@"
+ 372 0afe 4BFF4000 		.string	"K\377@"
+ 373 0b02 4BFF4000 		.string	"K\377@"
+ 374 0b06 4BFF4000 		.string	"K\377@"
+ 375 0b0a 4BFF4000 		.string	"K\377@"
+ 376 0b0e 4BFF4000 		.string	"K\377@"
+ 377 0b12 4BFF4000 		.string	"K\377@"
+ 378 0b16 4BFF4000 		.string	"K\377@"
+ 379 0b1a 4BFF4000 		.string	"K\377@"
+ 380 0b1e 4BFF4000 		.string	"K\377@"
+ 381 0b22 4BFF4000 		.string	"K\377@"
+ 382 0b26 4BFF4000 		.string	"K\377@"
+ 383 0b2a 4BFF4000 		.string	"K\377@"
+ 384 0b2e 4BFF4000 		.string	"K\377@"
+ 385 0b32 4BFF4000 		.string	"K\377@"
+ 386 0b36 4BFF4000 		.string	"K\377@"
+ 387 0b3a 4BFF4000 		.string	"K\377@"
+ 388 0b3e 4BFF4000 		.string	"K\377@"
+ 389 0b42 4BFF4000 		.string	"K\377@"
+ 390 0b46 4BFF4000 		.string	"K\377@"
+ 391 0b4a 4BFF4000 		.string	"K\377@"
+ 392 0b4e 4BFF4000 		.string	"K\377@"
+ 393 0b52 4BFF4000 		.string	"K\377@"
+ 394 0b56 4BFF4000 		.string	"K\377@"
+ 395 0b5a 4BFF4000 		.string	"K\377@"
+ 396 0b5e 4BFF4000 		.string	"K\377@"
+ 397 0b62 4BFF4000 		.string	"K\377@"
+ 398 0b66 4BFF4000 		.string	"K\377@"
+ 399 0b6a 4BFF4000 		.string	"K\377@"
+ 400 0b6e 4BFF4000 		.string	"K\377@"
+ 401 0b72 4BFF4000 		.string	"K\377@"
+ 402 0b76 4BFF4000 		.string	"K\377@"
+ 403 0b7a 4BFF4000 		.string	"K\377@"
+ 404 0b7e 4BFF4000 		.string	"K\377@"
+ 405 0b82 4BFF4000 		.string	"K\377@"
+ 406 0b86 4BFF4000 		.string	"K\377@"
+ 407 0b8a 4BFF4000 		.string	"K\377@"
+ 408 0b8e 4BFF4000 		.string	"K\377@"
+ 409 0b92 4BFF4000 		.string	"K\377@"
+ 410 0b96 4BFF4000 		.string	"K\377@"
+ 411 0b9a 4BFF4000 		.string	"K\377@"
+ 412 0b9e 4BFF4000 		.string	"K\377@"
+ 413 0ba2 4BFF4000 		.string	"K\377@"
+ 414 0ba6 4BFF4000 		.string	"K\377@"
+ 415 0baa 4BFF4000 		.string	"K\377@"
+GAS LISTING /tmp/cciiIuFx.s 			page 13
+
+
+ 416 0bae 4BFF4000 		.string	"K\377@"
+ 417 0bb2 4BFF4000 		.string	"K\377@"
+ 418 0bb6 4BFF4000 		.string	"K\377@"
+ 419 0bba 4BFF4000 		.string	"K\377@"
+ 420 0bbe 4BFF4000 		.string	"K\377@"
+ 421 0bc2 4BFF4000 		.string	"K\377@"
+ 422 0bc6 4BFF4000 		.string	"K\377@"
+ 423 0bca 4BFF4000 		.string	"K\377@"
+ 424 0bce 4BFF4000 		.string	"K\377@"
+ 425 0bd2 4BFF4000 		.string	"K\377@"
+ 426 0bd6 4BFF4000 		.string	"K\377@"
+ 427 0bda 4BFF4000 		.string	"K\377@"
+ 428 0bde 4BFF4000 		.string	"K\377@"
+ 429 0be2 4BFF4000 		.string	"K\377@"
+ 430 0be6 4BFF4000 		.string	"K\377@"
+ 431 0bea 4BFF4000 		.string	"K\377@"
+ 432 0bee 4BFF4000 		.string	"K\377@"
+ 433 0bf2 4BFF4000 		.string	"K\377@"
+ 434 0bf6 4BFF4000 		.string	"K\377@"
+ 435 0bfa 4BFF4000 		.string	"K\377@"
+ 436 0bfe 4BFF4000 		.string	"K\377@"
+ 437 0c02 4BFF4000 		.string	"K\377@"
+ 438 0c06 4BFF4000 		.string	"K\377@"
+ 439 0c0a 4BFF4000 		.string	"K\377@"
+ 440 0c0e 4BFF4000 		.string	"K\377@"
+ 441 0c12 4BFF4000 		.string	"K\377@"
+ 442 0c16 4BFF4000 		.string	"K\377@"
+ 443 0c1a 4BFF4000 		.string	"K\377@"
+ 444 0c1e 4BFF4000 		.string	"K\377@"
+ 445 0c22 4BFF4000 		.string	"K\377@"
+ 446 0c26 4BFF4000 		.string	"K\377@"
+ 447 0c2a 4BFF4000 		.string	"K\377@"
+ 448 0c2e 4BFF4000 		.string	"K\377@"
+ 449 0c32 4BFF4000 		.string	"K\377@"
+ 450 0c36 4BFF4000 		.string	"K\377@"
+ 451 0c3a 4BFF4000 		.string	"K\377@"
+ 452 0c3e 4BFF4000 		.string	"K\377@"
+ 453 0c42 4BFF4000 		.string	"K\377@"
+ 454 0c46 4BFF4000 		.string	"K\377@"
+ 455 0c4a 4BFF4000 		.string	"K\377@"
+ 456 0c4e 4BFF4000 		.string	"K\377@"
+ 457 0c52 4BFF4000 		.string	"K\377@"
+ 458 0c56 4BFF4000 		.string	"K\377@"
+ 459 0c5a 4BFF4000 		.string	"K\377@"
+ 460 0c5e 4BFF4000 		.string	"K\377@"
+ 461 0c62 4BFF4000 		.string	"K\377@"
+ 462 0c66 4BFF4000 		.string	"K\377@"
+ 463 0c6a 4BFF4000 		.string	"K\377@"
+ 464 0c6e 4BFF4000 		.string	"K\377@"
+ 465 0c72 4BFF4000 		.string	"K\377@"
+ 466 0c76 4BFF4000 		.string	"K\377@"
+ 467 0c7a 4BFF4000 		.string	"K\377@"
+ 468 0c7e 4BFF4000 		.string	"K\377@"
+ 469 0c82 4BFF4000 		.string	"K\377@"
+ 470 0c86 4BFF4000 		.string	"K\377@"
+ 471 0c8a 4BFF4000 		.string	"K\377@"
+ 472 0c8e 4BFF4000 		.string	"K\377@"
+GAS LISTING /tmp/cciiIuFx.s 			page 14
+
+
+ 473 0c92 4BFF4000 		.string	"K\377@"
+ 474 0c96 4BFF4000 		.string	"K\377@"
+ 475 0c9a 4BFF4000 		.string	"K\377@"
+ 476 0c9e 4BFF4000 		.string	"K\377@"
+ 477 0ca2 4BFF4000 		.string	"K\377@"
+ 478 0ca6 4BFF4000 		.string	"K\377@"
+ 479 0caa 4BFF4000 		.string	"K\377@"
+ 480 0cae 4BFF4000 		.string	"K\377@"
+ 481 0cb2 4BFF4000 		.string	"K\377@"
+ 482 0cb6 4BFF4000 		.string	"K\377@"
+ 483 0cba 4BFF4000 		.string	"K\377@"
+ 484 0cbe 4BFF4000 		.string	"K\377@"
+ 485 0cc2 4BFF4000 		.string	"K\377@"
+ 486 0cc6 4BFF4000 		.string	"K\377@"
+ 487 0cca 4BFF4000 		.string	"K\377@"
+ 488 0cce 4BFF4000 		.string	"K\377@"
+ 489 0cd2 4BFF4000 		.string	"K\377@"
+ 490 0cd6 4BFF4000 		.string	"K\377@"
+ 491 0cda 4BFF4000 		.string	"K\377@"
+ 492 0cde 4BFF4000 		.string	"K\377@"
+ 493 0ce2 4BFF4000 		.string	"K\377@"
+ 494 0ce6 4BFF4000 		.string	"K\377@"
+ 495 0cea 4BFF4000 		.string	"K\377@"
+ 496 0cee 4BFF4000 		.string	"K\377@"
+ 497 0cf2 4BFF4000 		.string	"K\377@"
+ 498 0cf6 4BFF4000 		.string	"K\377@"
+ 499 0cfa 4BFF4000 		.string	"K\377@"
+ 500 0cfe 4BFF4000 		.string	"K\377@"
+ 501 0d02 4BFF4000 		.string	"K\377@"
+ 502 0d06 4BFF4000 		.string	"K\377@"
+ 503 0d0a 4BFF4000 		.string	"K\377@"
+ 504 0d0e 4BFF4000 		.string	"K\377@"
+ 505 0d12 4BFF4000 		.string	"K\377@"
+ 506 0d16 4BFF4000 		.string	"K\377@"
+ 507 0d1a 4BFF4000 		.string	"K\377@"
+ 508 0d1e 4BFF4000 		.string	"K\377@"
+ 509 0d22 4BFF4000 		.string	"K\377@"
+ 510 0d26 4BFF4000 		.string	"K\377@"
+ 511 0d2a 4BFF4000 		.string	"K\377@"
+ 512 0d2e 4BFF4000 		.string	"K\377@"
+ 513 0d32 4BFF4000 		.string	"K\377@"
+ 514 0d36 4BFF4000 		.string	"K\377@"
+ 515 0d3a 4BFF4000 		.string	"K\377@"
+ 516 0d3e 4BFF4000 		.string	"K\377@"
+ 517 0d42 4BFF4000 		.string	"K\377@"
+ 518 0d46 4BFF4000 		.string	"K\377@"
+ 519 0d4a 4BFF4000 		.string	"K\377@"
+ 520 0d4e 4BFF4000 		.string	"K\377@"
+ 521 0d52 4BFF4000 		.string	"K\377@"
+ 522 0d56 4BFF4000 		.string	"K\377@"
+ 523 0d5a 4BFF4000 		.string	"K\377@"
+ 524 0d5e 4BFF4000 		.string	"K\377@"
+ 525 0d62 4BFF4000 		.string	"K\377@"
+ 526 0d66 4BFF4000 		.string	"K\377@"
+ 527 0d6a 4BFF4000 		.string	"K\377@"
+ 528 0d6e 4BFF4000 		.string	"K\377@"
+ 529 0d72 4BFF4000 		.string	"K\377@"
+GAS LISTING /tmp/cciiIuFx.s 			page 15
+
+
+ 530 0d76 4BFF4000 		.string	"K\377@"
+ 531 0d7a 4BFF4000 		.string	"K\377@"
+ 532 0d7e 4BFF4000 		.string	"K\377@"
+ 533 0d82 4BFF4000 		.string	"K\377@"
+ 534 0d86 4BFF4000 		.string	"K\377@"
+ 535 0d8a 4BFF4000 		.string	"K\377@"
+ 536 0d8e 4BFF3F00 		.string	"K\377?"
+ 537 0d92 4BFF3F00 		.string	"K\377?"
+ 538 0d96 4BFF3F00 		.string	"K\377?"
+ 539 0d9a 4BFF3F00 		.string	"K\377?"
+ 540 0d9e 4BFF3F00 		.string	"K\377?"
+ 541 0da2 4BFF3F00 		.string	"K\377?"
+ 542 0da6 4BFF3F00 		.string	"K\377?"
+ 543 0daa 4BFF3F00 		.string	"K\377?"
+ 544 0dae 4BFF3F00 		.string	"K\377?"
+ 545 0db2 4BFF3F00 		.string	"K\377?"
+ 546 0db6 4BFF3F00 		.string	"K\377?"
+ 547 0dba 4BFF3F00 		.string	"K\377?"
+ 548 0dbe 4BFF3F00 		.string	"K\377?"
+ 549 0dc2 4BFF3F00 		.string	"K\377?"
+ 550 0dc6 4BFF3F00 		.string	"K\377?"
+ 551 0dca 4BFF3F00 		.string	"K\377?"
+ 552 0dce 4BFF3F00 		.string	"K\377?"
+ 553 0dd2 4BFF3F00 		.string	"K\377?"
+ 554 0dd6 4BFF3F00 		.string	"K\377?"
+ 555 0dda 4BFF3F00 		.string	"K\377?"
+ 556 0dde 4BFF3F00 		.string	"K\377?"
+ 557 0de2 4BFF3F00 		.string	"K\377?"
+ 558 0de6 4BFF3F00 		.string	"K\377?"
+ 559 0dea 4BFF3F00 		.string	"K\377?"
+ 560 0dee 4BFF3F00 		.string	"K\377?"
+ 561 0df2 4BFF3F00 		.string	"K\377?"
+ 562 0df6 4BFF3F00 		.string	"K\377?"
+ 563 0dfa 4BFF3F00 		.string	"K\377?"
+ 564 0dfe 4BFF3F00 		.string	"K\377?"
+ 565 0e02 4BFF3F00 		.string	"K\377?"
+ 566 0e06 4BFF3F00 		.string	"K\377?"
+ 567 0e0a 4BFF3F00 		.string	"K\377?"
+ 568 0e0e 4BFF3F00 		.string	"K\377?"
+ 569 0e12 4BFF3F00 		.string	"K\377?"
+ 570 0e16 4BFF3F00 		.string	"K\377?"
+ 571 0e1a 4BFF3F00 		.string	"K\377?"
+ 572 0e1e 4BFF3F00 		.string	"K\377?"
+ 573 0e22 4BFF3F00 		.string	"K\377?"
+ 574 0e26 4BFF3F00 		.string	"K\377?"
+ 575 0e2a 4BFF3F00 		.string	"K\377?"
+ 576 0e2e 4BFF3F00 		.string	"K\377?"
+ 577 0e32 4BFF3F00 		.string	"K\377?"
+ 578 0e36 4BFF3F00 		.string	"K\377?"
+ 579 0e3a 4BFF3F00 		.string	"K\377?"
+ 580 0e3e 4BFF3F00 		.string	"K\377?"
+ 581 0e42 4BFF3F00 		.string	"K\377?"
+ 582 0e46 4BFF3F00 		.string	"K\377?"
+ 583 0e4a 4BFF3F00 		.string	"K\377?"
+ 584 0e4e 4BFF3F00 		.string	"K\377?"
+ 585 0e52 4BFF3F00 		.string	"K\377?"
+ 586 0e56 4BFF3F00 		.string	"K\377?"
+GAS LISTING /tmp/cciiIuFx.s 			page 16
+
+
+ 587 0e5a 4BFF3F00 		.string	"K\377?"
+ 588 0e5e 4BFF3F00 		.string	"K\377?"
+ 589 0e62 4BFF3F00 		.string	"K\377?"
+ 590 0e66 4BFF3F00 		.string	"K\377?"
+ 591 0e6a 4BFF3F00 		.string	"K\377?"
+ 592 0e6e 4BFF3F00 		.string	"K\377?"
+ 593 0e72 4BFF3F00 		.string	"K\377?"
+ 594 0e76 4BFF3F00 		.string	"K\377?"
+ 595 0e7a 4BFF3F00 		.string	"K\377?"
+ 596 0e7e 4BFF3F00 		.string	"K\377?"
+ 597 0e82 4BFF3F00 		.string	"K\377?"
+ 598 0e86 4BFF3F00 		.string	"K\377?"
+ 599 0e8a 4BFF3F00 		.string	"K\377?"
+ 600 0e8e 4BFF3F00 		.string	"K\377?"
+ 601 0e92 4BFF3F00 		.string	"K\377?"
+ 602 0e96 4BFF3F00 		.string	"K\377?"
+ 603 0e9a 4BFF3F00 		.string	"K\377?"
+ 604 0e9e 4BFF3F00 		.string	"K\377?"
+ 605 0ea2 4BFF3F00 		.string	"K\377?"
+ 606 0ea6 4BFF3F00 		.string	"K\377?"
+ 607 0eaa 4BFF3F00 		.string	"K\377?"
+ 608 0eae 4BFF3F00 		.string	"K\377?"
+ 609 0eb2 4BFF3F00 		.string	"K\377?"
+ 610 0eb6 4BFF3F00 		.string	"K\377?"
+ 611 0eba 4BFF3F00 		.string	"K\377?"
+ 612 0ebe 4BFF3F00 		.string	"K\377?"
+ 613 0ec2 4BFF3F00 		.string	"K\377?"
+ 614 0ec6 4BFF3F00 		.string	"K\377?"
+ 615 0eca 4BFF3F00 		.string	"K\377?"
+ 616 0ece 4BFF3F00 		.string	"K\377?"
+ 617 0ed2 4BFF3F00 		.string	"K\377?"
+ 618 0ed6 4BFF3F00 		.string	"K\377?"
+ 619 0eda 4BFF3F00 		.string	"K\377?"
+ 620 0ede 4BFF3F00 		.string	"K\377?"
+ 621 0ee2 4BFF3F00 		.string	"K\377?"
+ 622 0ee6 4BFF3F00 		.string	"K\377?"
+ 623 0eea 4BFF3F00 		.string	"K\377?"
+ 624 0eee 4BFF3F00 		.string	"K\377?"
+ 625 0ef2 4BFF3F00 		.string	"K\377?"
+ 626 0ef6 4BFF3F00 		.string	"K\377?"
+ 627 0efa 4BFF3F00 		.string	"K\377?"
+ 628 0efe 4BFF3F00 		.string	"K\377?"
+ 629 0f02 4BFF3F00 		.string	"K\377?"
+ 630 0f06 4BFF3F00 		.string	"K\377?"
+ 631 0f0a 4BFF3F00 		.string	"K\377?"
+ 632 0f0e 4BFF3F00 		.string	"K\377?"
+ 633 0f12 4BFF3F00 		.string	"K\377?"
+ 634 0f16 4BFF3F00 		.string	"K\377?"
+ 635 0f1a 4BFF3F00 		.string	"K\377?"
+ 636 0f1e 4BFF3F00 		.string	"K\377?"
+ 637 0f22 4BFF3F00 		.string	"K\377?"
+ 638 0f26 4BFF3F00 		.string	"K\377?"
+ 639 0f2a 4BFF3F00 		.string	"K\377?"
+ 640 0f2e 4BFF3F00 		.string	"K\377?"
+ 641 0f32 4BFF3F00 		.string	"K\377?"
+ 642 0f36 4BFF3F00 		.string	"K\377?"
+ 643 0f3a 4BFF3F00 		.string	"K\377?"
+GAS LISTING /tmp/cciiIuFx.s 			page 17
+
+
+ 644 0f3e 4BFF3F00 		.string	"K\377?"
+ 645 0f42 4BFF3F00 		.string	"K\377?"
+ 646 0f46 4BFF3F00 		.string	"K\377?"
+ 647 0f4a 4BFF3F00 		.string	"K\377?"
+ 648 0f4e 4BFF3F00 		.string	"K\377?"
+ 649 0f52 4BFF3F00 		.string	"K\377?"
+ 650 0f56 4BFF3F00 		.string	"K\377?"
+ 651 0f5a 4BFF3F00 		.string	"K\377?"
+ 652 0f5e 4BFF3F00 		.string	"K\377?"
+ 653 0f62 4BFF3F00 		.string	"K\377?"
+ 654 0f66 4BFF3F00 		.string	"K\377?"
+ 655 0f6a 4BFF3F00 		.string	"K\377?"
+ 656 0f6e 4BFF3F00 		.string	"K\377?"
+ 657 0f72 4BFF3F00 		.string	"K\377?"
+ 658 0f76 4BFF3F00 		.string	"K\377?"
+ 659 0f7a 4BFF3F00 		.string	"K\377?"
+ 660 0f7e 4BFF3F00 		.string	"K\377?"
+ 661 0f82 4BFF3F00 		.string	"K\377?"
+ 662 0f86 4BFF3F00 		.string	"K\377?"
+ 663 0f8a 4BFF3F00 		.string	"K\377?"
+ 664 0f8e 4BFF3F00 		.string	"K\377?"
+ 665 0f92 4BFF3F00 		.string	"K\377?"
+ 666 0f96 4BFF3F00 		.string	"K\377?"
+ 667 0f9a 4BFF3F00 		.string	"K\377?"
+ 668 0f9e 4BFF     		.ascii	"K\377"
+ 669 0fa0 3F00     		.string	"?"
+ 670 0fa2 4BFF3F00 		.string	"K\377?"
+ 671 0fa6 4BFF3F00 		.string	"K\377?"
+ 672 0faa 4BFF3F00 		.string	"K\377?"
+ 673 0fae 4BFF3F00 		.string	"K\377?"
+ 674 0fb2 4BFF3F00 		.string	"K\377?"
+ 675 0fb6 4BFF3F00 		.string	"K\377?"
+ 676 0fba 4BFF3F00 		.string	"K\377?"
+ 677 0fbe 4BFF3F00 		.string	"K\377?"
+ 678 0fc2 4BFF3F00 		.string	"K\377?"
+ 679 0fc6 4BFF3F00 		.string	"K\377?"
+ 680 0fca 4BFF3F00 		.string	"K\377?"
+ 681 0fce 4BFF3F00 		.string	"K\377?"
+ 682 0fd2 4BFF3F00 		.string	"K\377?"
+ 683 0fd6 4BFF3F00 		.string	"K\377?"
+ 684 0fda 4BFF3F00 		.string	"K\377?"
+ 685 0fde 4BFF3F00 		.string	"K\377?"
+ 686 0fe2 4BFF3F00 		.string	"K\377?"
+ 687 0fe6 4BFF3F00 		.string	"K\377?"
+ 688 0fea 4BFF3F00 		.string	"K\377?"
+ 689 0fee 4BFF3F00 		.string	"K\377?"
+ 690 0ff2 4BFF3F00 		.string	"K\377?"
+ 691 0ff6 4BFF3F00 		.string	"K\377?"
+ 692 0ffa 4BFF3F00 		.string	"K\377?"
+ 693 0ffe 4BFF3F00 		.string	"K\377?"
+ 694 1002 4BFF     		.ascii	"K\377"
+ 695              		.globl	heatmap_cs_PRGn_mixed
+ 696              		.section	.data.rel.local
+ 697              		.align 8
+ 698              		.type	heatmap_cs_PRGn_mixed, @object
+ 699              		.size	heatmap_cs_PRGn_mixed, 8
+ 700              	heatmap_cs_PRGn_mixed:
+GAS LISTING /tmp/cciiIuFx.s 			page 18
+
+
+ 701 0008 00000000 		.quad	mixed
+ 701      00000000 
+ 702              		.section	.data.rel.ro.local
+ 703              		.align 16
+ 704              		.type	mixed, @object
+ 705              		.size	mixed, 16
+ 706              	mixed:
+ 707 0010 00000000 		.quad	mixed_data
+ 707      00000000 
+ 708 0018 01040000 		.quad	1025
+ 708      00000000 
+ 709              		.section	.rodata
+ 710 1004 00000000 		.align 32
+ 710      00000000 
+ 710      00000000 
+ 710      00000000 
+ 710      00000000 
+ 711              		.type	mixed_data, @object
+ 712              		.size	mixed_data, 4100
+ 713              	mixed_data:
+ 714 1020 00       		.string	""
+ 715 1021 00       		.string	""
+ 716 1022 00       		.string	""
+ 717 1023 00       		.string	""
+ 718 1024 00       		.string	""
+ 719 1025 441A00   		.string	"D\032"
+ 720 1028 00       		.string	""
+ 721 1029 441B0700 		.string	"D\033\007"
+ 722 102d 441B0E00 		.string	"D\033\016"
+ 723 1031 451B1600 		.string	"E\033\026"
+ 724 1035 451B1D00 		.string	"E\033\035"
+ 725 1039 451C2500 		.string	"E\034%"
+ 726 103d 461C2C00 		.string	"F\034,"
+ 727 1041 461C3400 		.string	"F\0344"
+ 728 1045 471C3B01 		.ascii	"G\034;\001G\034C\001G\035J\001H\035R\001H\035Y\001I\035a\001"
+ 728      471C4301 
+ 728      471D4A01 
+ 728      481D5201 
+ 728      481D5901 
+ 729 105d 491D6801 		.ascii	"I\035h\001I\036p\002J\036w\002J\036\177\002K\036\206\002K\037"
+ 729      491E7002 
+ 729      4A1E7702 
+ 729      4A1E7F02 
+ 729      4B1E8602 
+ 730 1073 8D024B1F 		.ascii	"\215\002K\037\225\002L\037\234\003L\037\244\003L\037\253\003"
+ 730      95024C1F 
+ 730      9C034C1F 
+ 730      A4034C1F 
+ 730      AB03
+ 731 1085 4D20B303 		.ascii	"M \263\003M \272\003N \302\004N \311\004N \321\004O!\330\004"
+ 731      4D20BA03 
+ 731      4E20C204 
+ 731      4E20C904 
+ 731      4E20D104 
+ 732 109d 4F21E004 		.ascii	"O!\340\004P!\347\004P!\357\005P\"\366\005Q\"\376\005Q\"\377\005"
+ 732      5021E704 
+ 732      5021EF05 
+GAS LISTING /tmp/cciiIuFx.s 			page 19
+
+
+ 732      5022F605 
+ 732      5122FE05 
+ 733 10b5 5222FF06 		.ascii	"R\"\377\006R\"\377\006R#\377\006S#\377\006S#\377\006T#\377\007"
+ 733      5222FF06 
+ 733      5223FF06 
+ 733      5323FF06 
+ 733      5323FF06 
+ 734 10cd 5424FF07 		.ascii	"T$\377\007T$\377\007U$\377\007U$\377\bV$\377\bV%\377\bW%\377"
+ 734      5424FF07 
+ 734      5524FF07 
+ 734      5524FF08 
+ 734      5624FF08 
+ 735 10e8 085725FF 		.ascii	"\bW%\377\tW%\377\tX%\377\017c+\377\017c,\377\017c,\377\017d,"
+ 735      095725FF 
+ 735      095825FF 
+ 735      0F632BFF 
+ 735      0F632CFF 
+ 736 1103 FF10642C 		.ascii	"\377\020d,\377\020e,\377\020e-\377\020e-\377\020f-\377\021f-"
+ 736      FF10652C 
+ 736      FF10652D 
+ 736      FF10652D 
+ 736      FF10662D 
+ 737 111b FF11672D 		.ascii	"\377\021g-\377\021g.\377\021g.\377\022h.\377\022h.\377\022i/"
+ 737      FF11672E 
+ 737      FF11672E 
+ 737      FF12682E 
+ 737      FF12682E 
+ 738 1133 FF12692F 		.ascii	"\377\022i/\377\023j/\377\023j/\377\023j/\377\023k0\377\024k0"
+ 738      FF136A2F 
+ 738      FF136A2F 
+ 738      FF136A2F 
+ 738      FF136B30 
+ 739 114b FF146C30 		.ascii	"\377\024l0\377\024l0\377\024l1\377\025m1\377\025m1\377\025n1"
+ 739      FF146C30 
+ 739      FF146C31 
+ 739      FF156D31 
+ 739      FF156D31 
+ 740 1163 FF156E31 		.ascii	"\377\025n1\377\025n2\377\026o2\377\026o2\377\026p2\377\026p3"
+ 740      FF156E32 
+ 740      FF166F32 
+ 740      FF166F32 
+ 740      FF167032 
+ 741 117b FF177133 		.ascii	"\377\027q3\377\027q3\377\027q3\377\027r3\377\030r4\377\030s4"
+ 741      FF177133 
+ 741      FF177133 
+ 741      FF177233 
+ 741      FF187234 
+ 742 1193 FF187334 		.ascii	"\377\030s4\377\030t4\377\031t5\377\031t5\377\031u5\377\031u5"
+ 742      FF187434 
+ 742      FF197435 
+ 742      FF197435 
+ 742      FF197535 
+ 743 11ab FF197636 		.ascii	"\377\031v6\377\032v6\377\032v6\377\032w6\377\032w6\377\033x7"
+ 743      FF1A7636 
+ 743      FF1A7636 
+ 743      FF1A7736 
+ 743      FF1A7736 
+GAS LISTING /tmp/cciiIuFx.s 			page 20
+
+
+ 744 11c3 FF1B7837 		.ascii	"\377\033x7\377\034y7\377\035y8\377\035y8\377\036z8\377\036z9"
+ 744      FF1C7937 
+ 744      FF1D7938 
+ 744      FF1D7938 
+ 744      FF1E7A38 
+ 745 11db FF1F7B39 		.ascii	"\377\037{9\377 {9\377 {:\377!|:\377!|:\377\"};\377\"};\377#~"
+ 745      FF207B39 
+ 745      FF207B3A 
+ 745      FF217C3A 
+ 745      FF217C3A 
+ 746 11fa 3BFF237E 		.ascii	";\377#~;\377$~<\377%\177<\377%\177<\377&\200=\377&\200=\377'"
+ 746      3BFF247E 
+ 746      3CFF257F 
+ 746      3CFF257F 
+ 746      3CFF2680 
+ 747 1215 803DFF27 		.ascii	"\200=\377'\201>\377(\201>\377(\202>\377)\202?\377)\202?\377*"
+ 747      813EFF28 
+ 747      813EFF28 
+ 747      823EFF29 
+ 747      823FFF29 
+ 748 122d 833FFF2A 		.ascii	"\203?\377*\203@\377+\204@\377+\204@\377,\205A\377,\205A\377-"
+ 748      8340FF2B 
+ 748      8440FF2B 
+ 748      8440FF2C 
+ 748      8541FF2C 
+ 749 1245 8541FF2D 		.ascii	"\205A\377-\206B\377.\206B\377.\207B\377/\207C\377/\207C\3770"
+ 749      8642FF2E 
+ 749      8642FF2E 
+ 749      8742FF2F 
+ 749      8743FF2F 
+ 750 125d 8843FF30 		.ascii	"\210C\3770\210D\3771\211D\3771\211D\3772\212E\3772\212E\3773"
+ 750      8844FF31 
+ 750      8944FF31 
+ 750      8944FF32 
+ 750      8A45FF32 
+ 751 1275 8A45FF33 		.ascii	"\212E\3773\213E\3774\213F\3774\214F\3774\214F\3775\215G\377B"
+ 751      8B45FF34 
+ 751      8B46FF34 
+ 751      8C46FF34 
+ 751      8C46FF35 
+ 752 128d 9850FF42 		.ascii	"\230P\377B\230P\377C\231P\377C\231Q\377D\231Q\377D\232Q\377E"
+ 752      9850FF43 
+ 752      9950FF43 
+ 752      9951FF44 
+ 752      9951FF44 
+ 753 12a5 9A52FF45 		.ascii	"\232R\377E\233R\377F\233R\377F\234R\377G\234S\377G\234S\377H"
+ 753      9B52FF46 
+ 753      9B52FF46 
+ 753      9C52FF47 
+ 753      9C53FF47 
+ 754 12bd 9D53FF48 		.ascii	"\235S\377H\235T\377I\236T\377I\236T\377J\237U\377J\237U\377J"
+ 754      9D54FF49 
+ 754      9E54FF49 
+ 754      9E54FF4A 
+ 754      9F55FF4A 
+ 755 12d5 9F55FF4B 		.ascii	"\237U\377K\240V\377K\240V\377L\241V\377L\241W\377M\242W\377M"
+ 755      A056FF4B 
+GAS LISTING /tmp/cciiIuFx.s 			page 21
+
+
+ 755      A056FF4C 
+ 755      A156FF4C 
+ 755      A157FF4D 
+ 756 12ed A257FF4E 		.ascii	"\242W\377N\242X\377N\243X\377O\243X\377O\244Y\377P\244Y\377P"
+ 756      A258FF4E 
+ 756      A358FF4F 
+ 756      A358FF4F 
+ 756      A459FF50 
+ 757 1305 A559FF50 		.ascii	"\245Y\377P\245Z\377Q\245Z\377Q\246Z\377R\246[\377R\247[\377S"
+ 757      A55AFF51 
+ 757      A55AFF51 
+ 757      A65AFF52 
+ 757      A65BFF52 
+ 758 131d A75BFF53 		.ascii	"\247[\377S\250\\\377T\250\\\377T\250]\377U\251]\377U\251]\377"
+ 758      A85CFF54 
+ 758      A85CFF54 
+ 758      A85DFF55 
+ 758      A95DFF55 
+ 759 1334 55AA5EFF 		.ascii	"U\252^\377V\252^\377V\253^\377W\253_\377W\253_\377X\254_\377"
+ 759      56AA5EFF 
+ 759      56AB5EFF 
+ 759      57AB5FFF 
+ 759      57AB5FFF 
+ 760 134c 58AC60FF 		.ascii	"X\254`\377Y\255`\377Y\255`\377Z\256a\377Z\256a\377[\256b\377"
+ 760      59AD60FF 
+ 760      59AD60FF 
+ 760      5AAE61FF 
+ 760      5AAE61FF 
+ 761 1364 5CAF62FF 		.ascii	"\\\257b\377\\\257b\377]\257c\377]\260c\377^\260d\377_\260d\377"
+ 761      5CAF62FF 
+ 761      5DAF63FF 
+ 761      5DB063FF 
+ 761      5EB064FF 
+ 762 137c 5FB165FF 		.ascii	"_\261e\377`\261e\377a\261f\377a\262f\377b\262g\377c\262g\377"
+ 762      60B165FF 
+ 762      61B166FF 
+ 762      61B266FF 
+ 762      62B267FF 
+ 763 1394 63B368FF 		.ascii	"c\263h\377d\263h\377d\264i\377e\264i\377f\264j\377f\265j\377"
+ 763      64B368FF 
+ 763      64B469FF 
+ 763      65B469FF 
+ 763      66B46AFF 
+ 764 13ac 67B56BFF 		.ascii	"g\265k\377h\265k\377h\266l\377i\266l\377i\266m\377j\267m\377"
+ 764      68B56BFF 
+ 764      68B66CFF 
+ 764      69B66CFF 
+ 764      69B66DFF 
+ 765 13c4 6BB76DFF 		.ascii	"k\267m\377k\267n\377l\270n\377l\270o\377m\270o\377n\271p\377"
+ 765      6BB76EFF 
+ 765      6CB86EFF 
+ 765      6CB86FFF 
+ 765      6DB86FFF 
+ 766 13dc 6EB970FF 		.ascii	"n\271p\377o\271q\377o\272q\377p\272r\377q\272r\377q\273s\377"
+ 766      6FB971FF 
+ 766      6FBA71FF 
+ 766      70BA72FF 
+GAS LISTING /tmp/cciiIuFx.s 			page 22
+
+
+ 766      71BA72FF 
+ 767 13f4 72BB73FF 		.ascii	"r\273s\377r\274t\377s\274t\377t\274u\377t\275u\377u\275v\377"
+ 767      72BC74FF 
+ 767      73BC74FF 
+ 767      74BC75FF 
+ 767      74BD75FF 
+ 768 140c 75BD76FF 		.ascii	"u\275v\377v\276w\377w\276w\377w\276x\377x\277x\377x\277y\377"
+ 768      76BE77FF 
+ 768      77BE77FF 
+ 768      77BE78FF 
+ 768      78BF78FF 
+ 769 1424 88C886FF 		.ascii	"\210\310\206\377\211\311\206\377\211\311\207\377\212\311\207"
+ 769      89C986FF 
+ 769      89C987FF 
+ 769      8AC987
+ 770 1433 FF8ACA88 		.ascii	"\377\212\312\210\377\213\312\210\377\214\313\211\377\214\313"
+ 770      FF8BCA88 
+ 770      FF8CCB89 
+ 770      FF8CCB
+ 771 1442 89FF8DCB 		.ascii	"\211\377\215\313\212\377\215\314\212\377\216\314\213\377\217"
+ 771      8AFF8DCC 
+ 771      8AFF8ECC 
+ 771      8BFF8F
+ 772 1451 CC8BFF8F 		.ascii	"\314\213\377\217\315\214\377\220\315\214\377\220\315\215\377"
+ 772      CD8CFF90 
+ 772      CD8CFF90 
+ 772      CD8DFF
+ 773 1460 91CE8DFF 		.ascii	"\221\316\215\377\221\316\216\377\222\316\216\377\223\317\217"
+ 773      91CE8EFF 
+ 773      92CE8EFF 
+ 773      93CF8F
+ 774 146f FF93CF8F 		.ascii	"\377\223\317\217\377\224\317\220\377\224\320\220\377\225\320"
+ 774      FF94CF90 
+ 774      FF94D090 
+ 774      FF95D0
+ 775 147e 91FF95D1 		.ascii	"\221\377\225\321\221\377\226\321\222\377\227\321\222\377\227"
+ 775      91FF96D1 
+ 775      92FF97D1 
+ 775      92FF97
+ 776 148d D293FF98 		.ascii	"\322\223\377\230\322\223\377\230\322\224\377\231\323\224\377"
+ 776      D293FF98 
+ 776      D294FF99 
+ 776      D394FF
+ 777 149c 99D395FF 		.ascii	"\231\323\225\377\232\323\225\377\233\324\226\377\233\324\226"
+ 777      9AD395FF 
+ 777      9BD496FF 
+ 777      9BD496
+ 778 14ab FF9CD497 		.ascii	"\377\234\324\227\377\234\325\227\377\235\325\230\377\235\325"
+ 778      FF9CD597 
+ 778      FF9DD598 
+ 778      FF9DD5
+ 779 14ba 98FF9ED6 		.ascii	"\230\377\236\326\231\377\237\326\231\377\237\327\232\377\240"
+ 779      99FF9FD6 
+ 779      99FF9FD7 
+ 779      9AFFA0
+ 780 14c9 D79AFFA0 		.ascii	"\327\232\377\240\327\233\377\241\330\233\377\241\330\234\377"
+ 780      D79BFFA1 
+GAS LISTING /tmp/cciiIuFx.s 			page 23
+
+
+ 780      D89BFFA1 
+ 780      D89CFF
+ 781 14d8 A2D89CFF 		.ascii	"\242\330\234\377\243\331\235\377\243\331\235\377\244\331\236"
+ 781      A3D99DFF 
+ 781      A3D99DFF 
+ 781      A4D99E
+ 782 14e7 FFA4DA9E 		.ascii	"\377\244\332\236\377\245\332\237\377\245\332\237\377\246\333"
+ 782      FFA5DA9F 
+ 782      FFA5DA9F 
+ 782      FFA6DB
+ 783 14f6 A0FFA6DB 		.ascii	"\240\377\246\333\240\377\247\333\241\377\247\333\241\377\250"
+ 783      A0FFA7DB 
+ 783      A1FFA7DB 
+ 783      A1FFA8
+ 784 1505 DBA1FFA8 		.ascii	"\333\241\377\250\333\242\377\250\334\242\377\251\334\243\377"
+ 784      DBA2FFA8 
+ 784      DCA2FFA9 
+ 784      DCA3FF
+ 785 1514 A9DCA3FF 		.ascii	"\251\334\243\377\252\334\243\377\252\334\244\377\252\334\244"
+ 785      AADCA3FF 
+ 785      AADCA4FF 
+ 785      AADCA4
+ 786 1523 FFABDDA4 		.ascii	"\377\253\335\244\377\253\335\245\377\254\335\245\377\254\335"
+ 786      FFABDDA5 
+ 786      FFACDDA5 
+ 786      FFACDD
+ 787 1532 A6FFACDD 		.ascii	"\246\377\254\335\246\377\255\335\246\377\255\336\247\377\256"
+ 787      A6FFADDD 
+ 787      A6FFADDE 
+ 787      A7FFAE
+ 788 1541 DEA7FFAE 		.ascii	"\336\247\377\256\336\250\377\257\336\250\377\257\336\250\377"
+ 788      DEA8FFAF 
+ 788      DEA8FFAF 
+ 788      DEA8FF
+ 789 1550 AFDEA9FF 		.ascii	"\257\336\251\377\260\337\251\377\260\337\252\377\261\337\252"
+ 789      B0DFA9FF 
+ 789      B0DFAAFF 
+ 789      B1DFAA
+ 790 155f FFB1DFAA 		.ascii	"\377\261\337\252\377\261\337\253\377\262\337\253\377\262\340"
+ 790      FFB1DFAB 
+ 790      FFB2DFAB 
+ 790      FFB2E0
+ 791 156e ABFFB3E0 		.ascii	"\253\377\263\340\254\377\263\340\254\377\263\340\255\377\264"
+ 791      ACFFB3E0 
+ 791      ACFFB3E0 
+ 791      ADFFB4
+ 792 157d E0ADFFB4 		.ascii	"\340\255\377\264\340\255\377\265\341\256\377\265\341\256\377"
+ 792      E0ADFFB5 
+ 792      E1AEFFB5 
+ 792      E1AEFF
+ 793 158c B5E1AFFF 		.ascii	"\265\341\257\377\266\341\257\377\266\341\257\377\267\341\260"
+ 793      B6E1AFFF 
+ 793      B6E1AFFF 
+ 793      B7E1B0
+ 794 159b FFB7E2B0 		.ascii	"\377\267\342\260\377\267\342\261\377\270\342\261\377\270\342"
+ 794      FFB7E2B1 
+ 794      FFB8E2B1 
+GAS LISTING /tmp/cciiIuFx.s 			page 24
+
+
+ 794      FFB8E2
+ 795 15aa B1FFB9E2 		.ascii	"\261\377\271\342\262\377\271\342\262\377\271\343\263\377\272"
+ 795      B2FFB9E2 
+ 795      B2FFB9E3 
+ 795      B3FFBA
+ 796 15b9 E3B3FFBA 		.ascii	"\343\263\377\272\343\263\377\305\347\276\377\305\347\276\377"
+ 796      E3B3FFC5 
+ 796      E7BEFFC5 
+ 796      E7BEFF
+ 797 15c8 C6E8BFFF 		.ascii	"\306\350\277\377\306\350\277\377\306\350\300\377\307\350\300"
+ 797      C6E8BFFF 
+ 797      C6E8C0FF 
+ 797      C7E8C0
+ 798 15d7 FFC7E8C0 		.ascii	"\377\307\350\300\377\310\350\301\377\310\351\301\377\310\351"
+ 798      FFC8E8C1 
+ 798      FFC8E9C1 
+ 798      FFC8E9
+ 799 15e6 C2FFC9E9 		.ascii	"\302\377\311\351\302\377\311\351\302\377\312\351\303\377\312"
+ 799      C2FFC9E9 
+ 799      C2FFCAE9 
+ 799      C3FFCA
+ 800 15f5 E9C3FFCA 		.ascii	"\351\303\377\312\352\304\377\313\352\304\377\313\352\304\377"
+ 800      EAC4FFCB 
+ 800      EAC4FFCB 
+ 800      EAC4FF
+ 801 1604 CCEAC5FF 		.ascii	"\314\352\305\377\314\352\305\377\314\352\306\377\315\352\306"
+ 801      CCEAC5FF 
+ 801      CCEAC6FF 
+ 801      CDEAC6
+ 802 1613 FFCDEBC6 		.ascii	"\377\315\353\306\377\315\353\307\377\316\353\307\377\316\353"
+ 802      FFCDEBC7 
+ 802      FFCEEBC7 
+ 802      FFCEEB
+ 803 1622 C8FFCFEB 		.ascii	"\310\377\317\353\310\377\317\353\310\377\317\354\311\377\320"
+ 803      C8FFCFEB 
+ 803      C8FFCFEC 
+ 803      C9FFD0
+ 804 1631 ECC9FFD0 		.ascii	"\354\311\377\320\354\312\377\321\354\312\377\321\354\312\377"
+ 804      ECCAFFD1 
+ 804      ECCAFFD1 
+ 804      ECCAFF
+ 805 1640 D1ECCBFF 		.ascii	"\321\354\313\377\322\355\313\377\322\355\314\377\323\355\314"
+ 805      D2EDCBFF 
+ 805      D2EDCCFF 
+ 805      D3EDCC
+ 806 164f FFD3EDCD 		.ascii	"\377\323\355\315\377\323\355\315\377\324\355\315\377\324\356"
+ 806      FFD3EDCD 
+ 806      FFD4EDCD 
+ 806      FFD4EE
+ 807 165e CEFFD4EE 		.ascii	"\316\377\324\356\316\377\325\356\317\377\325\356\317\377\326"
+ 807      CEFFD5EE 
+ 807      CFFFD5EE 
+ 807      CFFFD6
+ 808 166d EECFFFD6 		.ascii	"\356\317\377\326\356\320\377\326\357\320\377\327\357\321\377"
+ 808      EED0FFD6 
+ 808      EFD0FFD7 
+ 808      EFD1FF
+GAS LISTING /tmp/cciiIuFx.s 			page 25
+
+
+ 809 167c D7EFD1FF 		.ascii	"\327\357\321\377\330\357\321\377\330\357\322\377\330\357\322"
+ 809      D8EFD1FF 
+ 809      D8EFD2FF 
+ 809      D8EFD2
+ 810 168b FFD9EFD2 		.ascii	"\377\331\357\322\377\332\357\322\377\333\357\322\377\334\357"
+ 810      FFDAEFD2 
+ 810      FFDBEFD2 
+ 810      FFDCEF
+ 811 169a D2FFDCEF 		.ascii	"\322\377\334\357\322\377\335\357\322\377\336\357\322\377\337"
+ 811      D2FFDDEF 
+ 811      D2FFDEEF 
+ 811      D2FFDF
+ 812 16a9 EFD2FFE0 		.ascii	"\357\322\377\340\357\322\377\341\357\322\377\341\357\322\377"
+ 812      EFD2FFE1 
+ 812      EFD2FFE1 
+ 812      EFD2FF
+ 813 16b8 E2EFD2FF 		.ascii	"\342\357\322\377\343\357\322\377\344\356\322\377\344\356\322"
+ 813      E3EFD2FF 
+ 813      E4EED2FF 
+ 813      E4EED2
+ 814 16c7 FFE5EED2 		.ascii	"\377\345\356\322\377\346\356\322\377\347\356\322\377\347\356"
+ 814      FFE6EED2 
+ 814      FFE7EED2 
+ 814      FFE7EE
+ 815 16d6 D2FFE8EE 		.ascii	"\322\377\350\356\323\377\351\356\323\377\351\356\323\377\352"
+ 815      D3FFE9EE 
+ 815      D3FFE9EE 
+ 815      D3FFEA
+ 816 16e5 EED3FFEB 		.ascii	"\356\323\377\353\356\323\377\353\356\324\377\354\356\324\377"
+ 816      EED3FFEB 
+ 816      EED4FFEC 
+ 816      EED4FF
+ 817 16f4 ECEED4FF 		.ascii	"\354\356\324\377\355\356\324\377\355\356\325\377\356\356\325"
+ 817      EDEED4FF 
+ 817      EDEED5FF 
+ 817      EEEED5
+ 818 1703 FFEEEDD5 		.ascii	"\377\356\355\325\377\357\355\326\377\357\355\326\377\360\355"
+ 818      FFEFEDD6 
+ 818      FFEFEDD6 
+ 818      FFF0ED
+ 819 1712 D6FFF0ED 		.ascii	"\326\377\360\355\327\377\361\355\327\377\361\355\327\377\361"
+ 819      D7FFF1ED 
+ 819      D7FFF1ED 
+ 819      D7FFF1
+ 820 1721 EDD8FFF2 		.ascii	"\355\330\377\362\355\330\377\362\355\331\377\363\355\331\377"
+ 820      EDD8FFF2 
+ 820      EDD9FFF3 
+ 820      EDD9FF
+ 821 1730 F3EDD9FF 		.ascii	"\363\355\331\377\363\355\332\377\364\355\332\377\364\355\333"
+ 821      F3EDDAFF 
+ 821      F4EDDAFF 
+ 821      F4EDDB
+ 822 173f FFF4EDDB 		.ascii	"\377\364\355\333\377\364\355\333\377\365\355\334\377\365\356"
+ 822      FFF4EDDB 
+ 822      FFF5EDDC 
+ 822      FFF5EE
+ 823 174e DCFFF5EE 		.ascii	"\334\377\365\356\335\377\365\356\335\377\373\357\345\377\373"
+GAS LISTING /tmp/cciiIuFx.s 			page 26
+
+
+ 823      DDFFF5EE 
+ 823      DDFFFBEF 
+ 823      E5FFFB
+ 824 175d EFE5FFFC 		.ascii	"\357\345\377\374\357\346\377\374\357\346\377\374\357\347\377"
+ 824      EFE6FFFC 
+ 824      EFE6FFFC 
+ 824      EFE7FF
+ 825 176c FCEFE7FF 		.ascii	"\374\357\347\377\374\357\350\377\374\360\350\377\374\360\351"
+ 825      FCEFE8FF 
+ 825      FCF0E8FF 
+ 825      FCF0E9
+ 826 177b FFFCF0E9 		.ascii	"\377\374\360\351\377\374\360\352\377\374\360\352\377\374\360"
+ 826      FFFCF0EA 
+ 826      FFFCF0EA 
+ 826      FFFCF0
+ 827 178a EAFFFCF0 		.ascii	"\352\377\374\360\353\377\374\360\353\377\374\360\354\377\374"
+ 827      EBFFFCF0 
+ 827      EBFFFCF0 
+ 827      ECFFFC
+ 828 1799 F1ECFFFC 		.ascii	"\361\354\377\374\361\355\377\374\361\355\377\374\361\356\377"
+ 828      F1EDFFFC 
+ 828      F1EDFFFC 
+ 828      F1EEFF
+ 829 17a8 FCF1EEFF 		.ascii	"\374\361\356\377\374\361\356\377\374\361\357\377\373\361\357"
+ 829      FCF1EEFF 
+ 829      FCF1EFFF 
+ 829      FBF1EF
+ 830 17b7 FFFBF2F0 		.ascii	"\377\373\362\360\377\373\362\360\377\373\362\360\377\373\362"
+ 830      FFFBF2F0 
+ 830      FFFBF2F0 
+ 830      FFFBF2
+ 831 17c6 F1FFFBF2 		.ascii	"\361\377\373\362\361\377\373\362\361\377\372\363\362\377\372"
+ 831      F1FFFBF2 
+ 831      F1FFFAF3 
+ 831      F2FFFA
+ 832 17d5 F3F2FFFA 		.ascii	"\363\362\377\372\363\362\377\372\363\363\377\372\363\363\377"
+ 832      F3F2FFFA 
+ 832      F3F3FFFA 
+ 832      F3F3FF
+ 833 17e4 FAF3F3FF 		.ascii	"\372\363\363\377\371\364\364\377\371\364\364\377"
+ 833      F9F4F4FF 
+ 833      F9F4F4FF 
+ 834 17f0 F9F4F4FF 		.ascii	"\371\364\364\377\371\364\364\377\371\364\365\377\370\365\365"
+ 834      F9F4F4FF 
+ 834      F9F4F5FF 
+ 834      F8F5F5
+ 835 17ff FFF8F5F5 		.ascii	"\377\370\365\365\377\370\365\365\377\370\365\365\377\370\365"
+ 835      FFF8F5F5 
+ 835      FFF8F5F5 
+ 835      FFF8F5
+ 836 180e F6FFF7F6 		.ascii	"\366\377\367\366\366\377\367\366\366\377\367\366\366\377\367"
+ 836      F6FFF7F6 
+ 836      F6FFF7F6 
+ 836      F6FFF7
+ 837 181d F6F6FFF7 		.ascii	"\366\366\377\367\366\366\377\367\366\367\377\366\366\366\377"
+ 837      F6F6FFF7 
+ 837      F6F7FFF6 
+GAS LISTING /tmp/cciiIuFx.s 			page 27
+
+
+ 837      F6F6FF
+ 838 182c F6F6F6FF 		.ascii	"\366\366\366\377\366\366\366\377\366\365\366\377\366\365\365"
+ 838      F6F6F6FF 
+ 838      F6F5F6FF 
+ 838      F6F5F5
+ 839 183b FFF6F5F5 		.ascii	"\377\366\365\365\377\366\364\365\377\366\364\365\377\366\364"
+ 839      FFF6F4F5 
+ 839      FFF6F4F5 
+ 839      FFF6F4
+ 840 184a F5FFF6F4 		.ascii	"\365\377\366\364\364\377\366\363\364\377\366\363\364\377\366"
+ 840      F4FFF6F3 
+ 840      F4FFF6F3 
+ 840      F4FFF6
+ 841 1859 F3F4FFF6 		.ascii	"\363\364\377\366\362\364\377\366\362\363\377\366\362\363\377"
+ 841      F2F4FFF6 
+ 841      F2F3FFF6 
+ 841      F2F3FF
+ 842 1868 F6F2F3FF 		.ascii	"\366\362\363\377\366\361\363\377\366\361\363\377\366\361\362"
+ 842      F6F1F3FF 
+ 842      F6F1F3FF 
+ 842      F6F1F2
+ 843 1877 FFF6F0F2 		.ascii	"\377\366\360\362\377\365\360\362\377\365\360\362\377\365\360"
+ 843      FFF5F0F2 
+ 843      FFF5F0F2 
+ 843      FFF5F0
+ 844 1886 F2FFF5EF 		.ascii	"\362\377\365\357\362\377\365\357\361\377\365\357\361\377\365"
+ 844      F2FFF5EF 
+ 844      F1FFF5EF 
+ 844      F1FFF5
+ 845 1895 EEF1FFF5 		.ascii	"\356\361\377\365\356\361\377\365\356\361\377\365\356\361\377"
+ 845      EEF1FFF5 
+ 845      EEF1FFF5 
+ 845      EEF1FF
+ 846 18a4 F5EDF0FF 		.ascii	"\365\355\360\377\365\355\360\377\365\355\360\377\365\354\360"
+ 846      F5EDF0FF 
+ 846      F5EDF0FF 
+ 846      F5ECF0
+ 847 18b3 FFF4ECF0 		.ascii	"\377\364\354\360\377\364\354\360\377\364\354\360\377\364\353"
+ 847      FFF4ECF0 
+ 847      FFF4ECF0 
+ 847      FFF4EB
+ 848 18c2 EFFFF4EB 		.ascii	"\357\377\364\353\357\377\364\353\357\377\364\352\357\377\364"
+ 848      EFFFF4EB 
+ 848      EFFFF4EA 
+ 848      EFFFF4
+ 849 18d1 EAEFFFF4 		.ascii	"\352\357\377\364\352\357\377\364\352\357\377\363\351\356\377"
+ 849      EAEFFFF4 
+ 849      EAEFFFF3 
+ 849      E9EEFF
+ 850 18e0 F3E9EEFF 		.ascii	"\363\351\356\377\363\351\356\377\363\350\356\377\363\350\356"
+ 850      F3E9EEFF 
+ 850      F3E8EEFF 
+ 850      F3E8EE
+ 851 18ef FFF3E8EE 		.ascii	"\377\363\350\356\377\360\341\353\377\357\340\353\377\357\340"
+ 851      FFF0E1EB 
+ 851      FFEFE0EB 
+ 851      FFEFE0
+GAS LISTING /tmp/cciiIuFx.s 			page 28
+
+
+ 852 18fe EBFFEFE0 		.ascii	"\353\377\357\340\352\377\357\340\352\377\357\337\352\377\357"
+ 852      EAFFEFE0 
+ 852      EAFFEFDF 
+ 852      EAFFEF
+ 853 190d DFEAFFEF 		.ascii	"\337\352\377\357\337\352\377\357\336\352\377\356\336\352\377"
+ 853      DFEAFFEF 
+ 853      DEEAFFEE 
+ 853      DEEAFF
+ 854 191c EEDEEAFF 		.ascii	"\356\336\352\377\356\336\352\377\356\335\352\377\356\335\351"
+ 854      EEDEEAFF 
+ 854      EEDDEAFF 
+ 854      EEDDE9
+ 855 192b FFEEDDE9 		.ascii	"\377\356\335\351\377\356\335\351\377\355\334\351\377\355\334"
+ 855      FFEEDDE9 
+ 855      FFEDDCE9 
+ 855      FFEDDC
+ 856 193a E9FFEDDC 		.ascii	"\351\377\355\334\351\377\355\334\351\377\355\333\351\377\355"
+ 856      E9FFEDDC 
+ 856      E9FFEDDB 
+ 856      E9FFED
+ 857 1949 DBE9FFEC 		.ascii	"\333\351\377\354\333\351\377\354\332\351\377\354\332\351\377"
+ 857      DBE9FFEC 
+ 857      DAE9FFEC 
+ 857      DAE9FF
+ 858 1958 ECDAE9FF 		.ascii	"\354\332\351\377\354\332\351\377\353\331\350\377\353\331\350"
+ 858      ECDAE9FF 
+ 858      EBD9E8FF 
+ 858      EBD9E8
+ 859 1967 FFEBD9E8 		.ascii	"\377\353\331\350\377\353\331\350\377\353\330\350\377\353\330"
+ 859      FFEBD9E8 
+ 859      FFEBD8E8 
+ 859      FFEBD8
+ 860 1976 E8FFEAD8 		.ascii	"\350\377\352\330\350\377\352\330\350\377\352\327\350\377\352"
+ 860      E8FFEAD8 
+ 860      E8FFEAD7 
+ 860      E8FFEA
+ 861 1985 D7E8FFEA 		.ascii	"\327\350\377\352\327\350\377\351\327\350\377\351\326\350\377"
+ 861      D7E8FFE9 
+ 861      D7E8FFE9 
+ 861      D6E8FF
+ 862 1994 E9D6E8FF 		.ascii	"\351\326\350\377\351\326\350\377\350\326\350\377\350\325\350"
+ 862      E9D6E8FF 
+ 862      E8D6E8FF 
+ 862      E8D5E8
+ 863 19a3 FFE8D5E8 		.ascii	"\377\350\325\350\377\350\325\350\377\350\325\350\377\347\324"
+ 863      FFE8D5E8 
+ 863      FFE8D5E8 
+ 863      FFE7D4
+ 864 19b2 E8FFE7D4 		.ascii	"\350\377\347\324\350\377\347\324\350\377\347\324\350\377\346"
+ 864      E8FFE7D4 
+ 864      E8FFE7D4 
+ 864      E8FFE6
+ 865 19c1 D3E7FFE6 		.ascii	"\323\347\377\346\323\347\377\346\323\347\377\346\322\347\377"
+ 865      D3E7FFE6 
+ 865      D3E7FFE6 
+ 865      D2E7FF
+ 866 19d0 E5D2E7FF 		.ascii	"\345\322\347\377\345\321\346\377\345\321\346\377\344\321\346"
+GAS LISTING /tmp/cciiIuFx.s 			page 29
+
+
+ 866      E5D1E6FF 
+ 866      E5D1E6FF 
+ 866      E4D1E6
+ 867 19df FFE4D0E6 		.ascii	"\377\344\320\346\377\344\320\345\377\344\317\345\377\343\317"
+ 867      FFE4D0E5 
+ 867      FFE4CFE5 
+ 867      FFE3CF
+ 868 19ee E5FFE3CF 		.ascii	"\345\377\343\317\345\377\343\316\345\377\343\316\344\377\342"
+ 868      E5FFE3CE 
+ 868      E5FFE3CE 
+ 868      E4FFE2
+ 869 19fd CEE4FFE2 		.ascii	"\316\344\377\342\315\344\377\342\315\344\377\341\314\344\377"
+ 869      CDE4FFE2 
+ 869      CDE4FFE1 
+ 869      CCE4FF
+ 870 1a0c E1CCE3FF 		.ascii	"\341\314\343\377\341\314\343\377\341\313\343\377\340\313\343"
+ 870      E1CCE3FF 
+ 870      E1CBE3FF 
+ 870      E0CBE3
+ 871 1a1b FFE0CBE3 		.ascii	"\377\340\313\343\377\340\312\342\377\340\312\342\377\337\311"
+ 871      FFE0CAE2 
+ 871      FFE0CAE2 
+ 871      FFDFC9
+ 872 1a2a E2FFDFC9 		.ascii	"\342\377\337\311\342\377\337\311\342\377\336\310\341\377\336"
+ 872      E2FFDFC9 
+ 872      E2FFDEC8 
+ 872      E1FFDE
+ 873 1a39 C8E1FFDE 		.ascii	"\310\341\377\336\310\341\377\336\307\341\377\335\307\341\377"
+ 873      C8E1FFDE 
+ 873      C7E1FFDD 
+ 873      C7E1FF
+ 874 1a48 DDC6E0FF 		.ascii	"\335\306\340\377\335\306\340\377\334\306\340\377\334\305\340"
+ 874      DDC6E0FF 
+ 874      DCC6E0FF 
+ 874      DCC5E0
+ 875 1a57 FFDCC5E0 		.ascii	"\377\334\305\340\377\334\305\337\377\333\304\337\377\333\304"
+ 875      FFDCC5DF 
+ 875      FFDBC4DF 
+ 875      FFDBC4
+ 876 1a66 DFFFDBC4 		.ascii	"\337\377\333\304\337\377\333\303\337\377\332\303\336\377\332"
+ 876      DFFFDBC3 
+ 876      DFFFDAC3 
+ 876      DEFFDA
+ 877 1a75 C2DEFFDA 		.ascii	"\302\336\377\332\302\336\377\331\302\336\377\331\301\336\377"
+ 877      C2DEFFD9 
+ 877      C2DEFFD9 
+ 877      C1DEFF
+ 878 1a84 D9C1DDFF 		.ascii	"\331\301\335\377\331\301\335\377\321\267\330\377\321\266\330"
+ 878      D9C1DDFF 
+ 878      D1B7D8FF 
+ 878      D1B6D8
+ 879 1a93 FFD0B6D8 		.ascii	"\377\320\266\330\377\320\266\327\377\320\265\327\377\317\265"
+ 879      FFD0B6D7 
+ 879      FFD0B5D7 
+ 879      FFCFB5
+ 880 1aa2 D7FFCFB5 		.ascii	"\327\377\317\265\327\377\317\264\327\377\316\264\326\377\316"
+ 880      D7FFCFB4 
+GAS LISTING /tmp/cciiIuFx.s 			page 30
+
+
+ 880      D7FFCEB4 
+ 880      D6FFCE
+ 881 1ab1 B4D6FFCE 		.ascii	"\264\326\377\316\263\326\377\316\263\326\377\315\262\326\377"
+ 881      B3D6FFCE 
+ 881      B3D6FFCD 
+ 881      B2D6FF
+ 882 1ac0 CDB2D5FF 		.ascii	"\315\262\325\377\315\262\325\377\314\261\325\377\314\261\325"
+ 882      CDB2D5FF 
+ 882      CCB1D5FF 
+ 882      CCB1D5
+ 883 1acf FFCCB1D5 		.ascii	"\377\314\261\325\377\314\260\325\377\313\260\324\377\313\260"
+ 883      FFCCB0D5 
+ 883      FFCBB0D4 
+ 883      FFCBB0
+ 884 1ade D4FFCBAF 		.ascii	"\324\377\313\257\324\377\312\257\324\377\312\256\324\377\312"
+ 884      D4FFCAAF 
+ 884      D4FFCAAE 
+ 884      D4FFCA
+ 885 1aed AED3FFC9 		.ascii	"\256\323\377\311\256\323\377\311\255\323\377\311\255\323\377"
+ 885      AED3FFC9 
+ 885      ADD3FFC9 
+ 885      ADD3FF
+ 886 1afc C9ADD3FF 		.ascii	"\311\255\323\377\310\254\322\377\310\254\322\377\310\254\322"
+ 886      C8ACD2FF 
+ 886      C8ACD2FF 
+ 886      C8ACD2
+ 887 1b0b FFC7ABD2 		.ascii	"\377\307\253\322\377\307\253\322\377\307\252\322\377\306\252"
+ 887      FFC7ABD2 
+ 887      FFC7AAD2 
+ 887      FFC6AA
+ 888 1b1a D1FFC6AA 		.ascii	"\321\377\306\252\321\377\306\251\321\377\305\251\321\377\305"
+ 888      D1FFC6A9 
+ 888      D1FFC5A9 
+ 888      D1FFC5
+ 889 1b29 A9D1FFC5 		.ascii	"\251\321\377\305\250\320\377\305\250\320\377\304\250\320\377"
+ 889      A8D0FFC5 
+ 889      A8D0FFC4 
+ 889      A8D0FF
+ 890 1b38 C4A7D0FF 		.ascii	"\304\247\320\377\304\247\320\377\303\247\320\377\303\246\317"
+ 890      C4A7D0FF 
+ 890      C3A7D0FF 
+ 890      C3A6CF
+ 891 1b47 FFC3A6CF 		.ascii	"\377\303\246\317\377\302\245\317\377\302\245\317\377\302\245"
+ 891      FFC2A5CF 
+ 891      FFC2A5CF 
+ 891      FFC2A5
+ 892 1b56 CFFFC1A4 		.ascii	"\317\377\301\244\316\377\301\244\316\377\301\244\316\377\300"
+ 892      CEFFC1A4 
+ 892      CEFFC1A4 
+ 892      CEFFC0
+ 893 1b65 A3CEFFC0 		.ascii	"\243\316\377\300\243\315\377\300\242\315\377\277\242\315\377"
+ 893      A3CDFFC0 
+ 893      A2CDFFBF 
+ 893      A2CDFF
+ 894 1b74 BFA1CCFF 		.ascii	"\277\241\314\377\277\241\314\377\277\241\314\377\276\240\314"
+ 894      BFA1CCFF 
+ 894      BFA1CCFF 
+GAS LISTING /tmp/cciiIuFx.s 			page 31
+
+
+ 894      BEA0CC
+ 895 1b83 FFBEA0CB 		.ascii	"\377\276\240\313\377\276\237\313\377\275\237\313\377\275\237"
+ 895      FFBE9FCB 
+ 895      FFBD9FCB 
+ 895      FFBD9F
+ 896 1b92 CAFFBD9E 		.ascii	"\312\377\275\236\312\377\274\236\312\377\274\235\312\377\274"
+ 896      CAFFBC9E 
+ 896      CAFFBC9D 
+ 896      CAFFBC
+ 897 1ba1 9DC9FFBB 		.ascii	"\235\311\377\273\234\311\377\273\234\311\377\273\234\311\377"
+ 897      9CC9FFBB 
+ 897      9CC9FFBB 
+ 897      9CC9FF
+ 898 1bb0 BA9BC8FF 		.ascii	"\272\233\310\377\272\233\310\377\272\232\310\377\271\232\307"
+ 898      BA9BC8FF 
+ 898      BA9AC8FF 
+ 898      B99AC7
+ 899 1bbf FFB999C7 		.ascii	"\377\271\231\307\377\271\231\307\377\270\231\307\377\270\230"
+ 899      FFB999C7 
+ 899      FFB899C7 
+ 899      FFB898
+ 900 1bce C6FFB898 		.ascii	"\306\377\270\230\306\377\267\227\306\377\267\227\305\377\267"
+ 900      C6FFB797 
+ 900      C6FFB797 
+ 900      C5FFB7
+ 901 1bdd 97C5FFB6 		.ascii	"\227\305\377\266\226\305\377\266\226\305\377\266\225\304\377"
+ 901      96C5FFB6 
+ 901      96C5FFB6 
+ 901      95C4FF
+ 902 1bec B695C4FF 		.ascii	"\266\225\304\377\265\224\304\377\265\224\303\377\265\224\303"
+ 902      B594C4FF 
+ 902      B594C3FF 
+ 902      B594C3
+ 903 1bfb FFB493C3 		.ascii	"\377\264\223\303\377\264\223\303\377\264\222\302\377\263\222"
+ 903      FFB493C3 
+ 903      FFB492C2 
+ 903      FFB392
+ 904 1c0a C2FFB392 		.ascii	"\302\377\263\222\302\377\263\221\301\377\262\221\301\377\262"
+ 904      C2FFB391 
+ 904      C1FFB291 
+ 904      C1FFB2
+ 905 1c19 90C1FFB2 		.ascii	"\220\301\377\262\220\301\377\261\220\300\377\251\204\271\377"
+ 905      90C1FFB1 
+ 905      90C0FFA9 
+ 905      84B9FF
+ 906 1c28 A884B9FF 		.ascii	"\250\204\271\377\250\204\270\377\250\203\270\377\250\203\270"
+ 906      A884B8FF 
+ 906      A883B8FF 
+ 906      A883B8
+ 907 1c37 FFA782B7 		.ascii	"\377\247\202\267\377\247\202\267\377\247\202\267\377\246\201"
+ 907      FFA782B7 
+ 907      FFA782B7 
+ 907      FFA681
+ 908 1c46 B7FFA681 		.ascii	"\267\377\246\201\266\377\246\200\266\377\245\200\266\377\245"
+ 908      B6FFA680 
+ 908      B6FFA580 
+ 908      B6FFA5
+GAS LISTING /tmp/cciiIuFx.s 			page 32
+
+
+ 909 1c55 80B5FFA5 		.ascii	"\200\265\377\245\177\265\377\244\177\265\377\244~\265\377\244"
+ 909      7FB5FFA4 
+ 909      7FB5FFA4 
+ 909      7EB5FFA4 
+ 910 1c65 7EB4FFA3 		.ascii	"~\264\377\243}\264\377\243}\264\377\243}\264\377\242|\263\377"
+ 910      7DB4FFA3 
+ 910      7DB4FFA3 
+ 910      7DB4FFA2 
+ 910      7CB3FF
+ 911 1c78 A27CB3FF 		.ascii	"\242|\263\377\242{\263\377\241{\262\377\241{\262\377\241z\262"
+ 911      A27BB3FF 
+ 911      A17BB2FF 
+ 911      A17BB2FF 
+ 911      A17AB2
+ 912 1c8b FFA17AB2 		.ascii	"\377\241z\262\377\240y\261\377\240y\261\377\240y\261\377\237"
+ 912      FFA079B1 
+ 912      FFA079B1 
+ 912      FFA079B1 
+ 912      FF9F
+ 913 1c9d 78B0FF9F 		.ascii	"x\260\377\237x\260\377\237w\260\377\236w\260\377\236w\257\377"
+ 913      78B0FF9F 
+ 913      77B0FF9E 
+ 913      77B0FF9E 
+ 913      77AFFF
+ 914 1cb0 9E76AFFF 		.ascii	"\236v\257\377\235v\257\377\235u\256\377\235u\256\377\234t\256"
+ 914      9D76AFFF 
+ 914      9D75AEFF 
+ 914      9D75AEFF 
+ 914      9C74AE
+ 915 1cc3 FF9C74AE 		.ascii	"\377\234t\256\377\234t\255\377\233s\255\377\233s\255\377\233"
+ 915      FF9C74AD 
+ 915      FF9B73AD 
+ 915      FF9B73AD 
+ 915      FF9B
+ 916 1cd5 72ADFF9A 		.ascii	"r\255\377\232r\254\377\232r\254\377\232q\254\377\232q\253\377"
+ 916      72ACFF9A 
+ 916      72ACFF9A 
+ 916      71ACFF9A 
+ 916      71ABFF
+ 917 1ce8 9970ABFF 		.ascii	"\231p\253\377\231p\253\377\231p\253\377\230o\252\377\230o\252"
+ 917      9970ABFF 
+ 917      9970ABFF 
+ 917      986FAAFF 
+ 917      986FAA
+ 918 1cfb FF986EAA 		.ascii	"\377\230n\252\377\227n\251\377\227m\251\377\227m\251\377\227"
+ 918      FF976EA9 
+ 918      FF976DA9 
+ 918      FF976DA9 
+ 918      FF97
+ 919 1d0d 6CA8FF96 		.ascii	"l\250\377\226k\250\377\226k\250\377\226j\250\377\225j\247\377"
+ 919      6BA8FF96 
+ 919      6BA8FF96 
+ 919      6AA8FF95 
+ 919      6AA7FF
+ 920 1d20 9569A7FF 		.ascii	"\225i\247\377\225i\247\377\225h\246\377\224h\246\377\224g\246"
+ 920      9569A7FF 
+ 920      9568A6FF 
+GAS LISTING /tmp/cciiIuFx.s 			page 33
+
+
+ 920      9468A6FF 
+ 920      9467A6
+ 921 1d33 FF9467A6 		.ascii	"\377\224g\246\377\223f\245\377\223f\245\377\223e\245\377\223"
+ 921      FF9366A5 
+ 921      FF9366A5 
+ 921      FF9365A5 
+ 921      FF93
+ 922 1d45 65A4FF92 		.ascii	"e\244\377\222d\244\377\222d\244\377\222c\243\377\221c\243\377"
+ 922      64A4FF92 
+ 922      64A4FF92 
+ 922      63A3FF91 
+ 922      63A3FF
+ 923 1d58 9162A3FF 		.ascii	"\221b\243\377\221b\243\377\221a\242\377\220a\242\377\220`\242"
+ 923      9162A3FF 
+ 923      9161A2FF 
+ 923      9061A2FF 
+ 923      9060A2
+ 924 1d6b FF9060A1 		.ascii	"\377\220`\241\377\220_\241\377\217_\241\377\217^\240\377\217"
+ 924      FF905FA1 
+ 924      FF8F5FA1 
+ 924      FF8F5EA0 
+ 924      FF8F
+ 925 1d7d 5EA0FF8E 		.ascii	"^\240\377\216]\240\377\216\\\237\377\216\\\237\377\216[\237\377"
+ 925      5DA0FF8E 
+ 925      5C9FFF8E 
+ 925      5C9FFF8E 
+ 925      5B9FFF
+ 926 1d90 8D5B9FFF 		.ascii	"\215[\237\377\215Z\236\377\215Z\236\377\214Y\236\377\214Y\235"
+ 926      8D5A9EFF 
+ 926      8D5A9EFF 
+ 926      8C599EFF 
+ 926      8C599D
+ 927 1da3 FF8C589D 		.ascii	"\377\214X\235\377\214X\235\377\213W\234\377\213W\234\377\213"
+ 927      FF8C589D 
+ 927      FF8B579C 
+ 927      FF8B579C 
+ 927      FF8B
+ 928 1db5 569CFF8B 		.ascii	"V\234\377\213V\233\377\212U\233\377\203G\223\377\203F\222\377"
+ 928      569BFF8A 
+ 928      559BFF83 
+ 928      4793FF83 
+ 928      4692FF
+ 929 1dc8 824592FF 		.ascii	"\202E\222\377\202E\222\377\202D\222\377\202D\221\377\201C\221"
+ 929      824592FF 
+ 929      824492FF 
+ 929      824491FF 
+ 929      814391
+ 930 1ddb FF814391 		.ascii	"\377\201C\221\377\201B\220\377\201B\220\377\200A\220\377\200"
+ 930      FF814290 
+ 930      FF814290 
+ 930      FF804190 
+ 930      FF80
+ 931 1ded 418FFF80 		.ascii	"A\217\377\200@\217\377\200@\217\377\177?\216\377\177>\216\377"
+ 931      408FFF80 
+ 931      408FFF7F 
+ 931      3F8EFF7F 
+ 931      3E8EFF
+GAS LISTING /tmp/cciiIuFx.s 			page 34
+
+
+ 932 1e00 7F3E8EFF 		.ascii	"\177>\216\377~=\215\377~=\215\377~<\215\377~<\214\377};\214\377"
+ 932      7E3D8DFF 
+ 932      7E3D8DFF 
+ 932      7E3C8DFF 
+ 932      7E3C8CFF 
+ 933 1e18 7D3B8CFF 		.ascii	"};\214\377}:\214\377}9\213\377|9\213\377|8\213\377|8\212\377"
+ 933      7D3A8CFF 
+ 933      7D398BFF 
+ 933      7C398BFF 
+ 933      7C388BFF 
+ 934 1e30 7C378AFF 		.ascii	"|7\212\377{7\212\377{6\211\377{5\211\377z5\211\377z4\210\377"
+ 934      7B378AFF 
+ 934      7B3689FF 
+ 934      7B3589FF 
+ 934      7A3589FF 
+ 935 1e48 7A3488FF 		.ascii	"z4\210\377z3\210\377y3\207\377y2\207\377y1\207\377y1\206\377"
+ 935      7A3388FF 
+ 935      793387FF 
+ 935      793287FF 
+ 935      793187FF 
+ 936 1e60 783086FF 		.ascii	"x0\206\377x0\206\377x/\205\377x.\205\377w.\205\377w-\204\377"
+ 936      783086FF 
+ 936      782F85FF 
+ 936      782E85FF 
+ 936      772E85FF 
+ 937 1e78 772C84FF 		.ascii	"w,\204\377v,\204\377v+\203\377v+\203\377v*\203\377u)\202\377"
+ 937      762C84FF 
+ 937      762B83FF 
+ 937      762B83FF 
+ 937      762A83FF 
+ 938 1e90 752982FF 		.ascii	"u)\202\377t)\201\377t(\201\377t(\200\377s(\200\377s'\200\377"
+ 938      742981FF 
+ 938      742881FF 
+ 938      742880FF 
+ 938      732880FF 
+ 939 1ea8 72277FFF 		.ascii	"r'\177\377r'\177\377q&~\377q&~\377q&}\377p&}\377p%|\377o%|\377"
+ 939      72277FFF 
+ 939      71267EFF 
+ 939      71267EFF 
+ 939      71267DFF 
+ 940 1ec8 6F257BFF 		.ascii	"o%{\377n${\377n${\377m$z\377m#z\377m#y\377l#y\377l\"x\377k\""
+ 940      6E247BFF 
+ 940      6E247BFF 
+ 940      6D247AFF 
+ 940      6D237AFF 
+ 941 1eea 78FF6B22 		.ascii	"x\377k\"w\377j!w\377j!w\377j!v\377i v\377i u\377h u\377h\037"
+ 941      77FF6A21 
+ 941      77FF6A21 
+ 941      77FF6A21 
+ 941      76FF6920 
+ 942 1f0a 74FF671F 		.ascii	"t\377g\037t\377g\037s\377g\036s\377f\036s\377f\036r\377e\035"
+ 942      74FF671F 
+ 942      73FF671E 
+ 942      73FF661E 
+ 942      73FF661E 
+ 943 1f22 72FF651D 		.ascii	"r\377e\035q\377d\035q\377d\035p\377d\034p\377c\034o\377c\034"
+ 943      71FF641D 
+GAS LISTING /tmp/cciiIuFx.s 			page 35
+
+
+ 943      71FF641D 
+ 943      70FF641C 
+ 943      70FF631C 
+ 944 1f3a 6FFF621B 		.ascii	"o\377b\033o\377b\033n\377a\033n\377a\032m\377a\032m\377`\032"
+ 944      6FFF621B 
+ 944      6EFF611B 
+ 944      6EFF611A 
+ 944      6DFF611A 
+ 945 1f52 6CFF6019 		.ascii	"l\377`\031l\377U\020`\377T\020`\377T\020_\377S\017_\377S\017"
+ 945      6CFF5510 
+ 945      60FF5410 
+ 945      60FF5410 
+ 945      5FFF530F 
+ 946 1f6a 5FFF520F 		.ascii	"_\377R\017^\377R\016^\377R\016]\377Q\016]\377Q\r\\\377P\r\\\377"
+ 946      5EFF520E 
+ 946      5EFF520E 
+ 946      5DFF510E 
+ 946      5DFF510D 
+ 947 1f84 500D5BFF 		.ascii	"P\r[\377P\f[\377O\f[\377O\fZ\377N\013Z\377N\013Y\377M\013Y\377"
+ 947      500C5BFF 
+ 947      4F0C5BFF 
+ 947      4F0C5AFF 
+ 947      4E0B5AFF 
+ 948 1fa0 4D0A58FF 		.ascii	"M\nX\377M\nX\377L\tX\377L\tW\377K\tW\377K\bV\377K\bV\377J\bU"
+ 948      4D0A58FF 
+ 948      4C0958FF 
+ 948      4C0957FF 
+ 948      4B0957FF 
+ 949 1fbf FF       		.ascii	"\377"
+ 950 1fc0 4A0755FF 		.string	"J\007U\377I\007U\377I\006T\377H\006T\377H\006S\377H\005S\377G\005R\377G\005R\377F\004R\37
+ 950      490755FF 
+ 950      490654FF 
+ 950      480654FF 
+ 950      480653FF 
+ 951 2016 4CFF4100 		.string	"L\377A"
+ 952 201a 4CFF4000 		.string	"L\377@"
+ 953 201e 4BFF4000 		.string	"K\377@"
+ 954 2022 4BFF     		.ascii	"K\377"
+ 955              		.globl	heatmap_cs_PRGn_soft
+ 956              		.section	.data.rel.local
+ 957              		.align 8
+ 958              		.type	heatmap_cs_PRGn_soft, @object
+ 959              		.size	heatmap_cs_PRGn_soft, 8
+ 960              	heatmap_cs_PRGn_soft:
+ 961 0010 00000000 		.quad	soft
+ 961      00000000 
+ 962              		.section	.data.rel.ro.local
+ 963              		.align 16
+ 964              		.type	soft, @object
+ 965              		.size	soft, 16
+ 966              	soft:
+ 967 0020 00000000 		.quad	soft_data
+ 967      00000000 
+ 968 0028 01040000 		.quad	1025
+ 968      00000000 
+ 969              		.section	.rodata
+ 970 2024 00000000 		.align 32
+GAS LISTING /tmp/cciiIuFx.s 			page 36
+
+
+ 970      00000000 
+ 970      00000000 
+ 970      00000000 
+ 970      00000000 
+ 971              		.type	soft_data, @object
+ 972              		.size	soft_data, 4100
+ 973              	soft_data:
+ 974 2040 00       		.string	""
+ 975 2041 00       		.string	""
+ 976 2042 00       		.string	""
+ 977 2043 00       		.string	""
+ 978 2044 00       		.string	""
+ 979 2045 441A00   		.string	"D\032"
+ 980 2048 00       		.string	""
+ 981 2049 441B0700 		.string	"D\033\007"
+ 982 204d 441B0E00 		.string	"D\033\016"
+ 983 2051 451B1600 		.string	"E\033\026"
+ 984 2055 451C1D00 		.string	"E\034\035"
+ 985 2059 461C2500 		.string	"F\034%"
+ 986 205d 461C2C01 		.ascii	"F\034,\001G\0344\001G\035;\001H\035C\001H\035J\001I\035R\001"
+ 986      471C3401 
+ 986      471D3B01 
+ 986      481D4301 
+ 986      481D4A01 
+ 987 2075 491E5902 		.ascii	"I\036Y\002J\036a\002J\036h\002K\036p\002K\037w\002L\037\177\003"
+ 987      4A1E6102 
+ 987      4A1E6802 
+ 987      4B1E7002 
+ 987      4B1F7702 
+ 988 208d 4C1F8603 		.ascii	"L\037\206\003M \215\003M \225\003N \234\003N \244\004O!\253\004"
+ 988      4D208D03 
+ 988      4D209503 
+ 988      4E209C03 
+ 988      4E20A404 
+ 989 20a5 4F21B304 		.ascii	"O!\263\004P!\272\004P!\302\005Q\"\311\005Q\"\321\005R\"\330\005"
+ 989      5021BA04 
+ 989      5021C205 
+ 989      5122C905 
+ 989      5122D105 
+ 990 20bd 5223E005 		.ascii	"R#\340\005S#\347\006S#\357\006T#\366\006T$\376\007U$\377\007"
+ 990      5323E706 
+ 990      5323EF06 
+ 990      5423F606 
+ 990      5424FE07 
+ 991 20d5 5524FF07 		.ascii	"U$\377\007V$\377\007V%\377\bW%\377\bW%\377\bX%\377\tX&\377\t"
+ 991      5624FF07 
+ 991      5625FF08 
+ 991      5725FF08 
+ 991      5725FF08 
+ 992 20f1 5926FF09 		.ascii	"Y&\377\tY&\377\tZ'\377\nZ'\377\n['\377\n['\377\013\\(\377\013"
+ 992      5926FF09 
+ 992      5A27FF0A 
+ 992      5A27FF0A 
+ 992      5B27FF0A 
+ 993 210d 5C28FF0B 		.ascii	"\\(\377\013](\377\f](\377\f^)\377\f^)\377\f_)\377\r_*\377\r`"
+ 993      5D28FF0C 
+ 993      5D28FF0C 
+GAS LISTING /tmp/cciiIuFx.s 			page 37
+
+
+ 993      5E29FF0C 
+ 993      5E29FF0C 
+ 994 212a 2AFF0D60 		.ascii	"*\377\r`*\377\016a*\377\016a+\377\016b+\377\017b+\377\017c,\377"
+ 994      2AFF0E61 
+ 994      2AFF0E61 
+ 994      2BFF0E62 
+ 994      2BFF0F62 
+ 995 2144 0F632CFF 		.ascii	"\017c,\377\017d,\377\020d,\377\020e-\377\020e-\377\021f-\377"
+ 995      0F642CFF 
+ 995      10642CFF 
+ 995      10652DFF 
+ 995      10652DFF 
+ 996 215c 11672DFF 		.ascii	"\021g-\377\021g.\377\022h.\377\022h.\377\022i/\377\022i/\377"
+ 996      11672EFF 
+ 996      12682EFF 
+ 996      12682EFF 
+ 996      12692FFF 
+ 997 2174 136A2FFF 		.ascii	"\023j/\377\023j/\377\023k0\377\024k0\377\024l0\377\024l1\377"
+ 997      136A2FFF 
+ 997      136B30FF 
+ 997      146B30FF 
+ 997      146C30FF 
+ 998 218c 146D31FF 		.ascii	"\024m1\377\025m1\377\025n1\377\025n2\377\026o2\377\026o2\377"
+ 998      156D31FF 
+ 998      156E31FF 
+ 998      156E32FF 
+ 998      166F32FF 
+ 999 21a4 167032FF 		.ascii	"\026p2\377\027p3\377\027q3\377\027q3\377\027r4\377\030s4\377"
+ 999      177033FF 
+ 999      177133FF 
+ 999      177133FF 
+ 999      177234FF 
+ 1000 21bc 187334FF 		.ascii	"\030s4\377\030t4\377\031t5\377\031u5\377\031u5\377\031v6\377"
+ 1000      187434FF 
+ 1000      197435FF 
+ 1000      197535FF 
+ 1000      197535FF 
+ 1001 21d4 1A7636FF 		.ascii	"\032v6\377\032w6\377\032w6\377\033x7\377\034x7\377\034y8\377"
+ 1001      1A7736FF 
+ 1001      1A7736FF 
+ 1001      1B7837FF 
+ 1001      1C7837FF 
+ 1002 21ec 1D7938FF 		.ascii	"\035y8\377\036z8\377\037z9\377\037{9\377 {:\377!|:\377\"|:\377"
+ 1002      1E7A38FF 
+ 1002      1F7A39FF 
+ 1002      1F7B39FF 
+ 1002      207B3AFF 
+ 1003 2208 227D3BFF 		.ascii	"\"};\377#};\377$~<\377$~<\377%\177<\377&\200=\377&\200=\377'"
+ 1003      237D3BFF 
+ 1003      247E3CFF 
+ 1003      247E3CFF 
+ 1003      257F3CFF 
+ 1004 2225 813DFF28 		.ascii	"\201=\377(\201>\377(\202>\377)\202?\377*\203?\377*\203@\377+"
+ 1004      813EFF28 
+ 1004      823EFF29 
+ 1004      823FFF2A 
+ 1004      833FFF2A 
+GAS LISTING /tmp/cciiIuFx.s 			page 38
+
+
+ 1005 223d 8440FF2C 		.ascii	"\204@\377,\204@\377,\205A\377-\205A\377.\206B\377.\206B\377/"
+ 1005      8440FF2C 
+ 1005      8541FF2D 
+ 1005      8541FF2E 
+ 1005      8642FF2E 
+ 1006 2255 8742FF2F 		.ascii	"\207B\377/\207C\3770\210C\3771\210D\3771\211D\3772\211D\3772"
+ 1006      8743FF30 
+ 1006      8843FF31 
+ 1006      8844FF31 
+ 1006      8944FF32 
+ 1007 226d 8A45FF33 		.ascii	"\212E\3773\212E\3774\213F\3774\213F\3775\214F\3776\215G\3776"
+ 1007      8A45FF34 
+ 1007      8B46FF34 
+ 1007      8B46FF35 
+ 1007      8C46FF36 
+ 1008 2285 8D47FF37 		.ascii	"\215G\3777\216H\3777\216H\3778\217H\3779\217I\3779\220I\377:"
+ 1008      8E48FF37 
+ 1008      8E48FF38 
+ 1008      8F48FF39 
+ 1008      8F49FF39 
+ 1009 229d 904AFF3A 		.ascii	"\220J\377:\221J\377;\221J\377<\222K\377<\222K\377=\223L\377="
+ 1009      914AFF3B 
+ 1009      914AFF3C 
+ 1009      924BFF3C 
+ 1009      924BFF3D 
+ 1010 22b5 934CFF3E 		.ascii	"\223L\377>\224M\377?\224M\377?\225M\377@\226N\377@\226N\377A"
+ 1010      944DFF3F 
+ 1010      944DFF3F 
+ 1010      954DFF40 
+ 1010      964EFF40 
+ 1011 22cd 974FFF41 		.ascii	"\227O\377A\227O\377B\230O\377C\230P\377C\231P\377D\231Q\377D"
+ 1011      974FFF42 
+ 1011      984FFF43 
+ 1011      9850FF43 
+ 1011      9950FF44 
+ 1012 22e5 9A51FF45 		.ascii	"\232Q\377E\232Q\377F\233R\377F\233R\377G\234S\377G\234S\377H"
+ 1012      9A51FF46 
+ 1012      9B52FF46 
+ 1012      9B52FF47 
+ 1012      9C53FF47 
+ 1013 22fd 9D54FF48 		.ascii	"\235T\377H\235T\377I\236T\377J\237U\377J\237U\377K\240V\377K"
+ 1013      9D54FF49 
+ 1013      9E54FF4A 
+ 1013      9F55FF4A 
+ 1013      9F55FF4B 
+ 1014 2315 A056FF4C 		.ascii	"\240V\377L\241V\377L\241W\377M\242W\377N\242X\377N\243X\377O"
+ 1014      A156FF4C 
+ 1014      A157FF4D 
+ 1014      A257FF4E 
+ 1014      A258FF4E 
+ 1015 232d A359FF4F 		.ascii	"\243Y\377O\244Y\377P\244Y\377P\245Z\377Q\246Z\377R\246[\377R"
+ 1015      A459FF50 
+ 1015      A459FF50 
+ 1015      A55AFF51 
+ 1015      A65AFF52 
+ 1016 2345 A75BFF53 		.ascii	"\247[\377S\247\\\377S\250\\\377T\250\\\377T\251]\377U\251]\377"
+ 1016      A75CFF53 
+GAS LISTING /tmp/cciiIuFx.s 			page 39
+
+
+ 1016      A85CFF54 
+ 1016      A85CFF54 
+ 1016      A95DFF55 
+ 1017 235c 56AA5EFF 		.ascii	"V\252^\377V\252^\377W\253^\377W\253_\377X\254_\377X\255`\377"
+ 1017      56AA5EFF 
+ 1017      57AB5EFF 
+ 1017      57AB5FFF 
+ 1017      58AC5FFF 
+ 1018 2374 59AD60FF 		.ascii	"Y\255`\377Z\256a\377Z\256a\377[\256b\377\\\257b\377]\257c\377"
+ 1018      5AAE61FF 
+ 1018      5AAE61FF 
+ 1018      5BAE62FF 
+ 1018      5CAF62FF 
+ 1019 238c 5EB064FF 		.ascii	"^\260d\377^\260d\377_\261e\377`\261e\377a\262f\377b\262g\377"
+ 1019      5EB064FF 
+ 1019      5FB165FF 
+ 1019      60B165FF 
+ 1019      61B266FF 
+ 1020 23a4 62B267FF 		.ascii	"b\262g\377c\263h\377d\263h\377e\264i\377f\264j\377f\265j\377"
+ 1020      63B368FF 
+ 1020      64B368FF 
+ 1020      65B469FF 
+ 1020      66B46AFF 
+ 1021 23bc 67B56BFF 		.ascii	"g\265k\377h\265k\377i\266l\377i\266m\377j\267m\377k\267n\377"
+ 1021      68B56BFF 
+ 1021      69B66CFF 
+ 1021      69B66DFF 
+ 1021      6AB76DFF 
+ 1022 23d4 6CB86EFF 		.ascii	"l\270n\377m\270o\377m\270p\377n\271p\377o\271q\377p\272q\377"
+ 1022      6DB86FFF 
+ 1022      6DB870FF 
+ 1022      6EB970FF 
+ 1022      6FB971FF 
+ 1023 23ec 70BA72FF 		.ascii	"p\272r\377q\273s\377r\273s\377s\274t\377s\274t\377t\274u\377"
+ 1023      71BB73FF 
+ 1023      72BB73FF 
+ 1023      73BC74FF 
+ 1023      73BC74FF 
+ 1024 2404 75BD76FF 		.ascii	"u\275v\377v\275v\377v\276w\377w\276w\377x\277x\377y\277y\377"
+ 1024      76BD76FF 
+ 1024      76BE77FF 
+ 1024      77BE77FF 
+ 1024      78BF78FF 
+ 1025 241c 79C079FF 		.ascii	"y\300y\377z\300z\377{\300z\377|\301{\377|\301|\377}\302|\377"
+ 1025      7AC07AFF 
+ 1025      7BC07AFF 
+ 1025      7CC17BFF 
+ 1025      7CC17CFF 
+ 1026 2434 7EC27DFF 		.ascii	"~\302}\377\177\303}\377\177\303~\377\200\303\177\377\201\304"
+ 1026      7FC37DFF 
+ 1026      7FC37EFF 
+ 1026      80C37FFF 
+ 1026      81C4
+ 1027 2446 7FFF81C4 		.ascii	"\177\377\201\304\200\377\202\305\201\377\203\305\201\377\204"
+ 1027      80FF82C5 
+ 1027      81FF83C5 
+ 1027      81FF84
+GAS LISTING /tmp/cciiIuFx.s 			page 40
+
+
+ 1028 2455 C682FF84 		.ascii	"\306\202\377\204\306\202\377\205\307\203\377\206\307\204\377"
+ 1028      C682FF85 
+ 1028      C783FF86 
+ 1028      C784FF
+ 1029 2464 87C784FF 		.ascii	"\207\307\204\377\207\310\205\377\210\310\205\377\211\311\206"
+ 1029      87C885FF 
+ 1029      88C885FF 
+ 1029      89C986
+ 1030 2473 FF89C987 		.ascii	"\377\211\311\207\377\212\312\207\377\213\312\210\377\214\312"
+ 1030      FF8ACA87 
+ 1030      FF8BCA88 
+ 1030      FF8CCA
+ 1031 2482 89FF8CCB 		.ascii	"\211\377\214\313\211\377\215\313\212\377\216\314\212\377\217"
+ 1031      89FF8DCB 
+ 1031      8AFF8ECC 
+ 1031      8AFF8F
+ 1032 2491 CC8BFF8F 		.ascii	"\314\213\377\217\315\214\377\220\315\214\377\221\316\215\377"
+ 1032      CD8CFF90 
+ 1032      CD8CFF91 
+ 1032      CE8DFF
+ 1033 24a0 91CE8EFF 		.ascii	"\221\316\216\377\222\316\216\377\223\317\217\377\224\317\217"
+ 1033      92CE8EFF 
+ 1033      93CF8FFF 
+ 1033      94CF8F
+ 1034 24af FF94D090 		.ascii	"\377\224\320\220\377\225\320\221\377\226\321\221\377\226\321"
+ 1034      FF95D091 
+ 1034      FF96D191 
+ 1034      FF96D1
+ 1035 24be 92FF97D2 		.ascii	"\222\377\227\322\223\377\230\322\223\377\231\322\224\377\231"
+ 1035      93FF98D2 
+ 1035      93FF99D2 
+ 1035      94FF99
+ 1036 24cd D395FF9A 		.ascii	"\323\225\377\232\323\225\377\233\324\226\377\233\324\226\377"
+ 1036      D395FF9B 
+ 1036      D496FF9B 
+ 1036      D496FF
+ 1037 24dc 9CD597FF 		.ascii	"\234\325\227\377\235\325\230\377\236\326\230\377\236\326\231"
+ 1037      9DD598FF 
+ 1037      9ED698FF 
+ 1037      9ED699
+ 1038 24eb FF9FD69A 		.ascii	"\377\237\326\232\377\240\327\232\377\240\327\233\377\241\330"
+ 1038      FFA0D79A 
+ 1038      FFA0D79B 
+ 1038      FFA1D8
+ 1039 24fa 9CFFA2D8 		.ascii	"\234\377\242\330\234\377\243\331\235\377\243\331\235\377\244"
+ 1039      9CFFA3D9 
+ 1039      9DFFA3D9 
+ 1039      9DFFA4
+ 1040 2509 DA9EFFA5 		.ascii	"\332\236\377\245\332\237\377\245\332\237\377\246\333\240\377"
+ 1040      DA9FFFA5 
+ 1040      DA9FFFA6 
+ 1040      DBA0FF
+ 1041 2518 A6DBA0FF 		.ascii	"\246\333\240\377\247\333\241\377\247\333\241\377\250\333\242"
+ 1041      A7DBA1FF 
+ 1041      A7DBA1FF 
+ 1041      A8DBA2
+ 1042 2527 FFA9DCA2 		.ascii	"\377\251\334\242\377\251\334\243\377\252\334\243\377\252\334"
+GAS LISTING /tmp/cciiIuFx.s 			page 41
+
+
+ 1042      FFA9DCA3 
+ 1042      FFAADCA3 
+ 1042      FFAADC
+ 1043 2536 A4FFABDD 		.ascii	"\244\377\253\335\244\377\253\335\245\377\254\335\245\377\254"
+ 1043      A4FFABDD 
+ 1043      A5FFACDD 
+ 1043      A5FFAC
+ 1044 2545 DDA6FFAD 		.ascii	"\335\246\377\255\335\246\377\255\336\247\377\256\336\247\377"
+ 1044      DDA6FFAD 
+ 1044      DEA7FFAE 
+ 1044      DEA7FF
+ 1045 2554 AEDEA8FF 		.ascii	"\256\336\250\377\257\336\250\377\257\336\251\377\260\337\251"
+ 1045      AFDEA8FF 
+ 1045      AFDEA9FF 
+ 1045      B0DFA9
+ 1046 2563 FFB0DFAA 		.ascii	"\377\260\337\252\377\261\337\252\377\261\337\253\377\262\337"
+ 1046      FFB1DFAA 
+ 1046      FFB1DFAB 
+ 1046      FFB2DF
+ 1047 2572 ABFFB2E0 		.ascii	"\253\377\262\340\254\377\263\340\254\377\263\340\255\377\264"
+ 1047      ACFFB3E0 
+ 1047      ACFFB3E0 
+ 1047      ADFFB4
+ 1048 2581 E0ADFFB4 		.ascii	"\340\255\377\264\340\256\377\265\341\256\377\265\341\256\377"
+ 1048      E0AEFFB5 
+ 1048      E1AEFFB5 
+ 1048      E1AEFF
+ 1049 2590 B6E1AFFF 		.ascii	"\266\341\257\377\266\341\257\377\267\341\260\377\267\342\260"
+ 1049      B6E1AFFF 
+ 1049      B7E1B0FF 
+ 1049      B7E2B0
+ 1050 259f FFB8E2B1 		.ascii	"\377\270\342\261\377\270\342\261\377\271\342\262\377\271\342"
+ 1050      FFB8E2B1 
+ 1050      FFB9E2B2 
+ 1050      FFB9E2
+ 1051 25ae B2FFBAE3 		.ascii	"\262\377\272\343\263\377\272\343\263\377\273\343\264\377\273"
+ 1051      B3FFBAE3 
+ 1051      B3FFBBE3 
+ 1051      B4FFBB
+ 1052 25bd E3B4FFBC 		.ascii	"\343\264\377\274\344\265\377\274\344\265\377\275\344\266\377"
+ 1052      E4B5FFBC 
+ 1052      E4B5FFBD 
+ 1052      E4B6FF
+ 1053 25cc BDE4B6FF 		.ascii	"\275\344\266\377\276\344\267\377\276\345\267\377\277\345\270"
+ 1053      BEE4B7FF 
+ 1053      BEE5B7FF 
+ 1053      BFE5B8
+ 1054 25db FFBFE5B8 		.ascii	"\377\277\345\270\377\300\345\271\377\300\345\271\377\301\346"
+ 1054      FFC0E5B9 
+ 1054      FFC0E5B9 
+ 1054      FFC1E6
+ 1055 25ea BAFFC1E6 		.ascii	"\272\377\301\346\272\377\302\346\273\377\302\346\273\377\303"
+ 1055      BAFFC2E6 
+ 1055      BBFFC2E6 
+ 1055      BBFFC3
+ 1056 25f9 E6BCFFC3 		.ascii	"\346\274\377\303\347\274\377\304\347\275\377\304\347\275\377"
+ 1056      E7BCFFC4 
+GAS LISTING /tmp/cciiIuFx.s 			page 42
+
+
+ 1056      E7BDFFC4 
+ 1056      E7BDFF
+ 1057 2608 C5E7BEFF 		.ascii	"\305\347\276\377\305\347\276\377\306\350\277\377\306\350\277"
+ 1057      C5E7BEFF 
+ 1057      C6E8BFFF 
+ 1057      C6E8BF
+ 1058 2617 FFC7E8C0 		.ascii	"\377\307\350\300\377\307\350\300\377\310\350\301\377\310\351"
+ 1058      FFC7E8C0 
+ 1058      FFC8E8C1 
+ 1058      FFC8E9
+ 1059 2626 C1FFC9E9 		.ascii	"\301\377\311\351\302\377\311\351\302\377\312\351\303\377\312"
+ 1059      C2FFC9E9 
+ 1059      C2FFCAE9 
+ 1059      C3FFCA
+ 1060 2635 E9C3FFCB 		.ascii	"\351\303\377\313\352\304\377\313\352\304\377\314\352\305\377"
+ 1060      EAC4FFCB 
+ 1060      EAC4FFCC 
+ 1060      EAC5FF
+ 1061 2644 CCEAC5FF 		.ascii	"\314\352\305\377\315\352\306\377\315\353\306\377\316\353\307"
+ 1061      CDEAC6FF 
+ 1061      CDEBC6FF 
+ 1061      CEEBC7
+ 1062 2653 FFCEEBC7 		.ascii	"\377\316\353\307\377\317\353\310\377\317\353\310\377\320\354"
+ 1062      FFCFEBC8 
+ 1062      FFCFEBC8 
+ 1062      FFD0EC
+ 1063 2662 C9FFD0EC 		.ascii	"\311\377\320\354\311\377\321\354\312\377\321\354\313\377\321"
+ 1063      C9FFD1EC 
+ 1063      CAFFD1EC 
+ 1063      CBFFD1
+ 1064 2671 EDCBFFD2 		.ascii	"\355\313\377\322\355\314\377\322\355\314\377\323\355\315\377"
+ 1064      EDCCFFD2 
+ 1064      EDCCFFD3 
+ 1064      EDCDFF
+ 1065 2680 D3EDCDFF 		.ascii	"\323\355\315\377\324\356\316\377\324\356\316\377\325\356\317"
+ 1065      D4EECEFF 
+ 1065      D4EECEFF 
+ 1065      D5EECF
+ 1066 268f FFD5EECF 		.ascii	"\377\325\356\317\377\326\356\320\377\326\357\320\377\327\357"
+ 1066      FFD6EED0 
+ 1066      FFD6EFD0 
+ 1066      FFD7EF
+ 1067 269e D1FFD7EF 		.ascii	"\321\377\327\357\321\377\330\357\322\377\330\357\322\377\331"
+ 1067      D1FFD8EF 
+ 1067      D2FFD8EF 
+ 1067      D2FFD9
+ 1068 26ad EFD2FFDA 		.ascii	"\357\322\377\332\357\322\377\333\357\322\377\334\357\322\377"
+ 1068      EFD2FFDB 
+ 1068      EFD2FFDC 
+ 1068      EFD2FF
+ 1069 26bc DDEFD2FF 		.ascii	"\335\357\322\377\336\357\322\377\337\357\322\377\341\357\322"
+ 1069      DEEFD2FF 
+ 1069      DFEFD2FF 
+ 1069      E1EFD2
+ 1070 26cb FFE2EFD2 		.ascii	"\377\342\357\322\377\343\357\321\377\344\356\322\377\345\356"
+ 1070      FFE3EFD1 
+ 1070      FFE4EED2 
+GAS LISTING /tmp/cciiIuFx.s 			page 43
+
+
+ 1070      FFE5EE
+ 1071 26da D2FFE6EE 		.ascii	"\322\377\346\356\322\377\346\356\322\377\347\356\322\377\350"
+ 1071      D2FFE6EE 
+ 1071      D2FFE7EE 
+ 1071      D2FFE8
+ 1072 26e9 EED2FFE9 		.ascii	"\356\322\377\351\356\322\377\352\356\322\377\353\356\322\377"
+ 1072      EED2FFEA 
+ 1072      EED2FFEB 
+ 1072      EED2FF
+ 1073 26f8 ECEED3FF 		.ascii	"\354\356\323\377\355\356\323\377\355\355\323\377\356\355\323"
+ 1073      EDEED3FF 
+ 1073      EDEDD3FF 
+ 1073      EEEDD3
+ 1074 2707 FFEFEDD4 		.ascii	"\377\357\355\324\377\360\355\324\377\360\355\324\377\361\355"
+ 1074      FFF0EDD4 
+ 1074      FFF0EDD4 
+ 1074      FFF1ED
+ 1075 2716 D4FFF2ED 		.ascii	"\324\377\362\355\325\377\363\355\325\377\363\355\326\377\364"
+ 1075      D5FFF3ED 
+ 1075      D5FFF3ED 
+ 1075      D6FFF4
+ 1076 2725 EDD6FFF4 		.ascii	"\355\326\377\364\355\326\377\365\355\327\377\366\355\327\377"
+ 1076      EDD6FFF5 
+ 1076      EDD7FFF6 
+ 1076      EDD7FF
+ 1077 2734 F6EDD8FF 		.ascii	"\366\355\330\377\367\355\330\377\367\355\331\377\370\355\331"
+ 1077      F7EDD8FF 
+ 1077      F7EDD9FF 
+ 1077      F8EDD9
+ 1078 2743 FFF8EDDA 		.ascii	"\377\370\355\332\377\371\355\332\377\371\355\333\377\372\355"
+ 1078      FFF9EDDA 
+ 1078      FFF9EDDB 
+ 1078      FFFAED
+ 1079 2752 DBFFFAED 		.ascii	"\333\377\372\355\334\377\372\355\334\377\373\355\335\377\373"
+ 1079      DCFFFAED 
+ 1079      DCFFFBED 
+ 1079      DDFFFB
+ 1080 2761 EDDDFFFB 		.ascii	"\355\335\377\373\355\336\377\374\355\336\377\374\355\337\377"
+ 1080      EDDEFFFC 
+ 1080      EDDEFFFC 
+ 1080      EDDFFF
+ 1081 2770 FCEDDFFF 		.ascii	"\374\355\337\377\374\355\340\377\375\355\341\377\375\355\341"
+ 1081      FCEDE0FF 
+ 1081      FDEDE1FF 
+ 1081      FDEDE1
+ 1082 277f FFFDEDE2 		.ascii	"\377\375\355\342\377\375\355\342\377\375\356\343\377\375\356"
+ 1082      FFFDEDE2 
+ 1082      FFFDEEE3 
+ 1082      FFFDEE
+ 1083 278e E3FFFDEE 		.ascii	"\343\377\375\356\344\377\375\356\345\377\376\356\345\377\376"
+ 1083      E4FFFDEE 
+ 1083      E5FFFEEE 
+ 1083      E5FFFE
+ 1084 279d EEE6FFFE 		.ascii	"\356\346\377\376\356\346\377\376\356\347\377\376\356\347\377"
+ 1084      EEE6FFFE 
+ 1084      EEE7FFFE 
+ 1084      EEE7FF
+GAS LISTING /tmp/cciiIuFx.s 			page 44
+
+
+ 1085 27ac FEEFE8FF 		.ascii	"\376\357\350\377\376\357\351\377\376\357\351\377\376\357\352"
+ 1085      FEEFE9FF 
+ 1085      FEEFE9FF 
+ 1085      FEEFEA
+ 1086 27bb FFFDEFEA 		.ascii	"\377\375\357\352\377\375\357\353\377\375\360\353\377\375\360"
+ 1086      FFFDEFEB 
+ 1086      FFFDF0EB 
+ 1086      FFFDF0
+ 1087 27ca ECFFFDF0 		.ascii	"\354\377\375\360\354\377\375\360\355\377\375\360\355\377\375"
+ 1087      ECFFFDF0 
+ 1087      EDFFFDF0 
+ 1087      EDFFFD
+ 1088 27d9 F0EEFFFC 		.ascii	"\360\356\377\374\361\356\377\374\361\357\377\374\361\357\377"
+ 1088      F1EEFFFC 
+ 1088      F1EFFFFC 
+ 1088      F1EFFF
+ 1089 27e8 FCF1F0FF 		.ascii	"\374\361\360\377\374\361\360\377\373\362\361\377\373\362\361"
+ 1089      FCF1F0FF 
+ 1089      FBF2F1FF 
+ 1089      FBF2F1
+ 1090 27f7 FFFBF2F1 		.ascii	"\377\373\362\361\377\373\362\362\377\373\363\362\377\372\363"
+ 1090      FFFBF2F2 
+ 1090      FFFBF3F2 
+ 1090      FFFAF3
+ 1091 2806 F3FFFAF3 		.ascii	"\363\377\372\363\363\377\372\363\363\377"
+ 1091      F3FFFAF3 
+ 1091      F3FF
+ 1092 2810 FAF3F4FF 		.ascii	"\372\363\364\377\371\364\364\377\371\364\364\377\371\364\364"
+ 1092      F9F4F4FF 
+ 1092      F9F4F4FF 
+ 1092      F9F4F4
+ 1093 281f FFF9F4F5 		.ascii	"\377\371\364\365\377\370\365\365\377\370\365\365\377\370\365"
+ 1093      FFF8F5F5 
+ 1093      FFF8F5F5 
+ 1093      FFF8F5
+ 1094 282e F5FFF8F5 		.ascii	"\365\377\370\365\366\377\367\366\366\377\367\366\366\377\367"
+ 1094      F6FFF7F6 
+ 1094      F6FFF7F6 
+ 1094      F6FFF7
+ 1095 283d F6F6FFF7 		.ascii	"\366\366\377\367\366\366\377\367\366\367\377\366\366\366\377"
+ 1095      F6F6FFF7 
+ 1095      F6F7FFF6 
+ 1095      F6F6FF
+ 1096 284c F6F6F6FF 		.ascii	"\366\366\366\377\366\365\366\377\366\365\365\377\366\365\365"
+ 1096      F6F5F6FF 
+ 1096      F6F5F5FF 
+ 1096      F6F5F5
+ 1097 285b FFF6F4F5 		.ascii	"\377\366\364\365\377\366\364\365\377\366\364\364\377\366\363"
+ 1097      FFF6F4F5 
+ 1097      FFF6F4F4 
+ 1097      FFF6F3
+ 1098 286a F4FFF6F3 		.ascii	"\364\377\366\363\364\377\366\363\364\377\366\362\363\377\366"
+ 1098      F4FFF6F3 
+ 1098      F4FFF6F2 
+ 1098      F3FFF6
+ 1099 2879 F2F3FFF6 		.ascii	"\362\363\377\366\361\363\377\366\361\363\377\366\361\362\377"
+ 1099      F1F3FFF6 
+GAS LISTING /tmp/cciiIuFx.s 			page 45
+
+
+ 1099      F1F3FFF6 
+ 1099      F1F2FF
+ 1100 2888 F6F0F2FF 		.ascii	"\366\360\362\377\366\360\362\377\365\360\362\377\365\357\361"
+ 1100      F6F0F2FF 
+ 1100      F5F0F2FF 
+ 1100      F5EFF1
+ 1101 2897 FFF5EFF1 		.ascii	"\377\365\357\361\377\365\357\361\377\365\356\361\377\365\356"
+ 1101      FFF5EFF1 
+ 1101      FFF5EEF1 
+ 1101      FFF5EE
+ 1102 28a6 F1FFF5ED 		.ascii	"\361\377\365\355\360\377\365\355\360\377\365\355\360\377\365"
+ 1102      F0FFF5ED 
+ 1102      F0FFF5ED 
+ 1102      F0FFF5
+ 1103 28b5 ECF0FFF5 		.ascii	"\354\360\377\365\354\357\377\365\354\357\377\364\353\357\377"
+ 1103      ECEFFFF5 
+ 1103      ECEFFFF4 
+ 1103      EBEFFF
+ 1104 28c4 F4EBEFFF 		.ascii	"\364\353\357\377\364\353\357\377\364\352\357\377\364\352\356"
+ 1104      F4EBEFFF 
+ 1104      F4EAEFFF 
+ 1104      F4EAEE
+ 1105 28d3 FFF4EAEE 		.ascii	"\377\364\352\356\377\364\351\356\377\364\351\356\377\364\350"
+ 1105      FFF4E9EE 
+ 1105      FFF4E9EE 
+ 1105      FFF4E8
+ 1106 28e2 EEFFF3E8 		.ascii	"\356\377\363\350\355\377\363\350\355\377\363\347\355\377\363"
+ 1106      EDFFF3E8 
+ 1106      EDFFF3E7 
+ 1106      EDFFF3
+ 1107 28f1 E7EDFFF3 		.ascii	"\347\355\377\363\347\355\377\363\346\355\377\363\346\354\377"
+ 1107      E7EDFFF3 
+ 1107      E6EDFFF3 
+ 1107      E6ECFF
+ 1108 2900 F3E6ECFF 		.ascii	"\363\346\354\377\362\345\354\377\362\345\354\377\362\345\354"
+ 1108      F2E5ECFF 
+ 1108      F2E5ECFF 
+ 1108      F2E5EC
+ 1109 290f FFF2E4EC 		.ascii	"\377\362\344\354\377\362\344\354\377\362\344\353\377\362\343"
+ 1109      FFF2E4EC 
+ 1109      FFF2E4EB 
+ 1109      FFF2E3
+ 1110 291e EBFFF1E3 		.ascii	"\353\377\361\343\353\377\361\343\353\377\361\342\353\377\361"
+ 1110      EBFFF1E3 
+ 1110      EBFFF1E2 
+ 1110      EBFFF1
+ 1111 292d E2EBFFF1 		.ascii	"\342\353\377\361\342\353\377\361\341\353\377\360\341\352\377"
+ 1111      E2EBFFF1 
+ 1111      E1EBFFF0 
+ 1111      E1EAFF
+ 1112 293c F0E1EAFF 		.ascii	"\360\341\352\377\360\340\352\377\360\340\352\377\360\340\352"
+ 1112      F0E0EAFF 
+ 1112      F0E0EAFF 
+ 1112      F0E0EA
+ 1113 294b FFEFDFEA 		.ascii	"\377\357\337\352\377\357\337\352\377\357\337\352\377\357\336"
+ 1113      FFEFDFEA 
+ 1113      FFEFDFEA 
+GAS LISTING /tmp/cciiIuFx.s 			page 46
+
+
+ 1113      FFEFDE
+ 1114 295a EAFFEFDE 		.ascii	"\352\377\357\336\351\377\356\336\351\377\356\335\351\377\356"
+ 1114      E9FFEEDE 
+ 1114      E9FFEEDD 
+ 1114      E9FFEE
+ 1115 2969 DDE9FFEE 		.ascii	"\335\351\377\356\335\351\377\356\334\351\377\355\334\351\377"
+ 1115      DDE9FFEE 
+ 1115      DCE9FFED 
+ 1115      DCE9FF
+ 1116 2978 EDDCE9FF 		.ascii	"\355\334\351\377\355\333\351\377\355\333\351\377\354\333\351"
+ 1116      EDDBE9FF 
+ 1116      EDDBE9FF 
+ 1116      ECDBE9
+ 1117 2987 FFECDAE9 		.ascii	"\377\354\332\351\377\354\332\351\377\354\332\350\377\354\331"
+ 1117      FFECDAE9 
+ 1117      FFECDAE8 
+ 1117      FFECD9
+ 1118 2996 E8FFEBD9 		.ascii	"\350\377\353\331\350\377\353\331\350\377\353\330\350\377\353"
+ 1118      E8FFEBD9 
+ 1118      E8FFEBD8 
+ 1118      E8FFEB
+ 1119 29a5 D8E8FFEA 		.ascii	"\330\350\377\352\330\350\377\352\327\350\377\352\327\350\377"
+ 1119      D8E8FFEA 
+ 1119      D7E8FFEA 
+ 1119      D7E8FF
+ 1120 29b4 E9D7E8FF 		.ascii	"\351\327\350\377\351\326\350\377\351\326\350\377\351\326\350"
+ 1120      E9D6E8FF 
+ 1120      E9D6E8FF 
+ 1120      E9D6E8
+ 1121 29c3 FFE8D5E8 		.ascii	"\377\350\325\350\377\350\325\350\377\350\325\350\377\350\325"
+ 1121      FFE8D5E8 
+ 1121      FFE8D5E8 
+ 1121      FFE8D5
+ 1122 29d2 E8FFE7D4 		.ascii	"\350\377\347\324\350\377\347\324\350\377\347\324\350\377\346"
+ 1122      E8FFE7D4 
+ 1122      E8FFE7D4 
+ 1122      E8FFE6
+ 1123 29e1 D3E7FFE6 		.ascii	"\323\347\377\346\323\347\377\346\322\347\377\345\322\347\377"
+ 1123      D3E7FFE6 
+ 1123      D2E7FFE5 
+ 1123      D2E7FF
+ 1124 29f0 E5D1E6FF 		.ascii	"\345\321\346\377\345\321\346\377\344\320\346\377\344\320\345"
+ 1124      E5D1E6FF 
+ 1124      E4D0E6FF 
+ 1124      E4D0E5
+ 1125 29ff FFE4CFE5 		.ascii	"\377\344\317\345\377\343\317\345\377\343\316\345\377\343\316"
+ 1125      FFE3CFE5 
+ 1125      FFE3CEE5 
+ 1125      FFE3CE
+ 1126 2a0e E4FFE2CE 		.ascii	"\344\377\342\316\344\377\342\315\344\377\342\315\344\377\341"
+ 1126      E4FFE2CD 
+ 1126      E4FFE2CD 
+ 1126      E4FFE1
+ 1127 2a1d CCE3FFE1 		.ascii	"\314\343\377\341\314\343\377\341\313\343\377\340\313\343\377"
+ 1127      CCE3FFE1 
+ 1127      CBE3FFE0 
+ 1127      CBE3FF
+GAS LISTING /tmp/cciiIuFx.s 			page 47
+
+
+ 1128 2a2c E0CAE2FF 		.ascii	"\340\312\342\377\340\312\342\377\337\311\342\377\337\311\342"
+ 1128      E0CAE2FF 
+ 1128      DFC9E2FF 
+ 1128      DFC9E2
+ 1129 2a3b FFDFC8E1 		.ascii	"\377\337\310\341\377\336\310\341\377\336\307\341\377\335\307"
+ 1129      FFDEC8E1 
+ 1129      FFDEC7E1 
+ 1129      FFDDC7
+ 1130 2a4a E1FFDDC6 		.ascii	"\341\377\335\306\340\377\335\306\340\377\334\306\340\377\334"
+ 1130      E0FFDDC6 
+ 1130      E0FFDCC6 
+ 1130      E0FFDC
+ 1131 2a59 C5E0FFDC 		.ascii	"\305\340\377\334\305\337\377\333\304\337\377\333\304\337\377"
+ 1131      C5DFFFDB 
+ 1131      C4DFFFDB 
+ 1131      C4DFFF
+ 1132 2a68 DBC3DFFF 		.ascii	"\333\303\337\377\332\303\336\377\332\302\336\377\332\302\336"
+ 1132      DAC3DEFF 
+ 1132      DAC2DEFF 
+ 1132      DAC2DE
+ 1133 2a77 FFD9C1DE 		.ascii	"\377\331\301\336\377\331\301\335\377\331\300\335\377\330\300"
+ 1133      FFD9C1DD 
+ 1133      FFD9C0DD 
+ 1133      FFD8C0
+ 1134 2a86 DDFFD8C0 		.ascii	"\335\377\330\300\335\377\330\277\334\377\327\277\334\377\327"
+ 1134      DDFFD8BF 
+ 1134      DCFFD7BF 
+ 1134      DCFFD7
+ 1135 2a95 BEDCFFD6 		.ascii	"\276\334\377\326\276\334\377\326\275\333\377\326\275\333\377"
+ 1135      BEDCFFD6 
+ 1135      BDDBFFD6 
+ 1135      BDDBFF
+ 1136 2aa4 D5BCDBFF 		.ascii	"\325\274\333\377\325\274\333\377\325\273\332\377\324\273\332"
+ 1136      D5BCDBFF 
+ 1136      D5BBDAFF 
+ 1136      D4BBDA
+ 1137 2ab3 FFD4BADA 		.ascii	"\377\324\272\332\377\324\272\332\377\323\272\331\377\323\271"
+ 1137      FFD4BADA 
+ 1137      FFD3BAD9 
+ 1137      FFD3B9
+ 1138 2ac2 D9FFD2B9 		.ascii	"\331\377\322\271\331\377\322\270\331\377\322\270\330\377\321"
+ 1138      D9FFD2B8 
+ 1138      D9FFD2B8 
+ 1138      D8FFD1
+ 1139 2ad1 B7D8FFD1 		.ascii	"\267\330\377\321\267\330\377\321\266\330\377\320\266\327\377"
+ 1139      B7D8FFD1 
+ 1139      B6D8FFD0 
+ 1139      B6D7FF
+ 1140 2ae0 D0B5D7FF 		.ascii	"\320\265\327\377\320\265\327\377\317\265\327\377\317\264\327"
+ 1140      D0B5D7FF 
+ 1140      CFB5D7FF 
+ 1140      CFB4D7
+ 1141 2aef FFCEB4D6 		.ascii	"\377\316\264\326\377\316\263\326\377\316\263\326\377\315\262"
+ 1141      FFCEB3D6 
+ 1141      FFCEB3D6 
+ 1141      FFCDB2
+ 1142 2afe D6FFCDB2 		.ascii	"\326\377\315\262\325\377\315\261\325\377\314\261\325\377\314"
+GAS LISTING /tmp/cciiIuFx.s 			page 48
+
+
+ 1142      D5FFCDB1 
+ 1142      D5FFCCB1 
+ 1142      D5FFCC
+ 1143 2b0d B0D5FFCB 		.ascii	"\260\325\377\313\260\324\377\313\260\324\377\313\257\324\377"
+ 1143      B0D4FFCB 
+ 1143      B0D4FFCB 
+ 1143      AFD4FF
+ 1144 2b1c CAAFD4FF 		.ascii	"\312\257\324\377\312\256\323\377\312\256\323\377\311\255\323"
+ 1144      CAAED3FF 
+ 1144      CAAED3FF 
+ 1144      C9ADD3
+ 1145 2b2b FFC9ADD3 		.ascii	"\377\311\255\323\377\310\254\323\377\310\254\322\377\310\254"
+ 1145      FFC8ACD3 
+ 1145      FFC8ACD2 
+ 1145      FFC8AC
+ 1146 2b3a D2FFC7AB 		.ascii	"\322\377\307\253\322\377\307\253\322\377\306\252\321\377\306"
+ 1146      D2FFC7AB 
+ 1146      D2FFC6AA 
+ 1146      D1FFC6
+ 1147 2b49 AAD1FFC6 		.ascii	"\252\321\377\306\251\321\377\305\251\321\377\305\250\320\377"
+ 1147      A9D1FFC5 
+ 1147      A9D1FFC5 
+ 1147      A8D0FF
+ 1148 2b58 C5A8D0FF 		.ascii	"\305\250\320\377\304\250\320\377\304\247\320\377\303\247\320"
+ 1148      C4A8D0FF 
+ 1148      C4A7D0FF 
+ 1148      C3A7D0
+ 1149 2b67 FFC3A6CF 		.ascii	"\377\303\246\317\377\303\246\317\377\302\245\317\377\302\245"
+ 1149      FFC3A6CF 
+ 1149      FFC2A5CF 
+ 1149      FFC2A5
+ 1150 2b76 CFFFC1A4 		.ascii	"\317\377\301\244\316\377\301\244\316\377\301\243\316\377\300"
+ 1150      CEFFC1A4 
+ 1150      CEFFC1A3 
+ 1150      CEFFC0
+ 1151 2b85 A3CDFFC0 		.ascii	"\243\315\377\300\242\315\377\277\242\315\377\277\241\314\377"
+ 1151      A2CDFFBF 
+ 1151      A2CDFFBF 
+ 1151      A1CCFF
+ 1152 2b94 BFA1CCFF 		.ascii	"\277\241\314\377\276\240\314\377\276\240\313\377\275\237\313"
+ 1152      BEA0CCFF 
+ 1152      BEA0CBFF 
+ 1152      BD9FCB
+ 1153 2ba3 FFBD9FCB 		.ascii	"\377\275\237\313\377\275\236\312\377\274\236\312\377\274\235"
+ 1153      FFBD9ECA 
+ 1153      FFBC9ECA 
+ 1153      FFBC9D
+ 1154 2bb2 C9FFBB9C 		.ascii	"\311\377\273\234\311\377\273\234\311\377\273\233\310\377\272"
+ 1154      C9FFBB9C 
+ 1154      C9FFBB9B 
+ 1154      C8FFBA
+ 1155 2bc1 9BC8FFBA 		.ascii	"\233\310\377\272\232\310\377\271\232\307\377\271\231\307\377"
+ 1155      9AC8FFB9 
+ 1155      9AC7FFB9 
+ 1155      99C7FF
+ 1156 2bd0 B999C7FF 		.ascii	"\271\231\307\377\270\230\306\377\270\230\306\377\267\227\306"
+ 1156      B898C6FF 
+GAS LISTING /tmp/cciiIuFx.s 			page 49
+
+
+ 1156      B898C6FF 
+ 1156      B797C6
+ 1157 2bdf FFB797C5 		.ascii	"\377\267\227\305\377\267\226\305\377\266\226\305\377\266\225"
+ 1157      FFB796C5 
+ 1157      FFB696C5 
+ 1157      FFB695
+ 1158 2bee C4FFB595 		.ascii	"\304\377\265\225\304\377\265\224\303\377\265\224\303\377\264"
+ 1158      C4FFB594 
+ 1158      C3FFB594 
+ 1158      C3FFB4
+ 1159 2bfd 93C3FFB4 		.ascii	"\223\303\377\264\223\302\377\263\222\302\377\263\222\302\377"
+ 1159      93C2FFB3 
+ 1159      92C2FFB3 
+ 1159      92C2FF
+ 1160 2c0c B391C1FF 		.ascii	"\263\221\301\377\262\220\301\377\262\220\301\377\261\217\300"
+ 1160      B290C1FF 
+ 1160      B290C1FF 
+ 1160      B18FC0
+ 1161 2c1b FFB18FC0 		.ascii	"\377\261\217\300\377\260\216\300\377\260\216\277\377\260\215"
+ 1161      FFB08EC0 
+ 1161      FFB08EBF 
+ 1161      FFB08D
+ 1162 2c2a BFFFAF8D 		.ascii	"\277\377\257\215\277\377\257\214\276\377\256\214\276\377\256"
+ 1162      BFFFAF8C 
+ 1162      BEFFAE8C 
+ 1162      BEFFAE
+ 1163 2c39 8BBDFFAE 		.ascii	"\213\275\377\256\213\275\377\255\212\275\377\255\212\274\377"
+ 1163      8BBDFFAD 
+ 1163      8ABDFFAD 
+ 1163      8ABCFF
+ 1164 2c48 AC89BCFF 		.ascii	"\254\211\274\377\254\211\274\377\254\210\273\377\253\210\273"
+ 1164      AC89BCFF 
+ 1164      AC88BBFF 
+ 1164      AB88BB
+ 1165 2c57 FFAB87BB 		.ascii	"\377\253\207\273\377\252\207\272\377\252\206\272\377\252\206"
+ 1165      FFAA87BA 
+ 1165      FFAA86BA 
+ 1165      FFAA86
+ 1166 2c66 BAFFA985 		.ascii	"\272\377\251\205\271\377\251\205\271\377\250\204\271\377\250"
+ 1166      B9FFA985 
+ 1166      B9FFA884 
+ 1166      B9FFA8
+ 1167 2c75 84B8FFA8 		.ascii	"\204\270\377\250\203\270\377\247\203\270\377\247\202\267\377"
+ 1167      83B8FFA7 
+ 1167      83B8FFA7 
+ 1167      82B7FF
+ 1168 2c84 A681B7FF 		.ascii	"\246\201\267\377\246\201\266\377\246\200\266\377\245\200\266"
+ 1168      A681B6FF 
+ 1168      A680B6FF 
+ 1168      A580B6
+ 1169 2c93 FFA57FB5 		.ascii	"\377\245\177\265\377\245\177\265\377\244~\265\377\244~\264\377"
+ 1169      FFA57FB5 
+ 1169      FFA47EB5 
+ 1169      FFA47EB4 
+ 1169      FF
+ 1170 2ca4 A37DB4FF 		.ascii	"\243}\264\377\243}\264\377\243|\263\377\242|\263\377\242{\263"
+ 1170      A37DB4FF 
+GAS LISTING /tmp/cciiIuFx.s 			page 50
+
+
+ 1170      A37CB3FF 
+ 1170      A27CB3FF 
+ 1170      A27BB3
+ 1171 2cb7 FFA17BB2 		.ascii	"\377\241{\262\377\241z\262\377\241z\262\377\240y\261\377\240"
+ 1171      FFA17AB2 
+ 1171      FFA17AB2 
+ 1171      FFA079B1 
+ 1171      FFA0
+ 1172 2cc9 79B1FF9F 		.ascii	"y\261\377\237x\261\377\237x\260\377\237w\260\377\236w\257\377"
+ 1172      78B1FF9F 
+ 1172      78B0FF9F 
+ 1172      77B0FF9E 
+ 1172      77AFFF
+ 1173 2cdc 9E76AFFF 		.ascii	"\236v\257\377\235v\257\377\235u\256\377\235u\256\377\234t\256"
+ 1173      9D76AFFF 
+ 1173      9D75AEFF 
+ 1173      9D75AEFF 
+ 1173      9C74AE
+ 1174 2cef FF9C74AD 		.ascii	"\377\234t\255\377\233s\255\377\233s\255\377\233r\254\377\232"
+ 1174      FF9B73AD 
+ 1174      FF9B73AD 
+ 1174      FF9B72AC 
+ 1174      FF9A
+ 1175 2d01 72ACFF9A 		.ascii	"r\254\377\232q\254\377\231q\253\377\231p\253\377\231p\253\377"
+ 1175      71ACFF99 
+ 1175      71ABFF99 
+ 1175      70ABFF99 
+ 1175      70ABFF
+ 1176 2d14 986FAAFF 		.ascii	"\230o\252\377\230n\252\377\227n\251\377\227m\251\377\227l\251"
+ 1176      986EAAFF 
+ 1176      976EA9FF 
+ 1176      976DA9FF 
+ 1176      976CA9
+ 1177 2d27 FF966CA8 		.ascii	"\377\226l\250\377\226k\250\377\226j\250\377\225j\247\377\225"
+ 1177      FF966BA8 
+ 1177      FF966AA8 
+ 1177      FF956AA7 
+ 1177      FF95
+ 1178 2d39 69A7FF95 		.ascii	"i\247\377\225i\247\377\224h\246\377\224g\246\377\224g\245\377"
+ 1178      69A7FF94 
+ 1178      68A6FF94 
+ 1178      67A6FF94 
+ 1178      67A5FF
+ 1179 2d4c 9366A5FF 		.ascii	"\223f\245\377\223e\245\377\223e\244\377\222d\244\377\222c\244"
+ 1179      9365A5FF 
+ 1179      9365A4FF 
+ 1179      9264A4FF 
+ 1179      9263A4
+ 1180 2d5f FF9163A3 		.ascii	"\377\221c\243\377\221b\243\377\221a\242\377\220a\242\377\220"
+ 1180      FF9162A3 
+ 1180      FF9161A2 
+ 1180      FF9061A2 
+ 1180      FF90
+ 1181 2d71 60A2FF90 		.ascii	"`\242\377\220`\241\377\217_\241\377\217^\241\377\217^\240\377"
+ 1181      60A1FF8F 
+ 1181      5FA1FF8F 
+ 1181      5EA1FF8F 
+GAS LISTING /tmp/cciiIuFx.s 			page 51
+
+
+ 1181      5EA0FF
+ 1182 2d84 8E5DA0FF 		.ascii	"\216]\240\377\216\\\237\377\216\\\237\377\215[\237\377\215Z\236"
+ 1182      8E5C9FFF 
+ 1182      8E5C9FFF 
+ 1182      8D5B9FFF 
+ 1182      8D5A9E
+ 1183 2d97 FF8D5A9E 		.ascii	"\377\215Z\236\377\214Y\235\377\214X\235\377\214X\235\377\213"
+ 1183      FF8C599D 
+ 1183      FF8C589D 
+ 1183      FF8C589D 
+ 1183      FF8B
+ 1184 2da9 579CFF8B 		.ascii	"W\234\377\213V\234\377\213V\234\377\212U\233\377\212T\233\377"
+ 1184      569CFF8B 
+ 1184      569CFF8A 
+ 1184      559BFF8A 
+ 1184      549BFF
+ 1185 2dbc 89549AFF 		.ascii	"\211T\232\377\211S\232\377\211R\232\377\210R\231\377\210Q\231"
+ 1185      89539AFF 
+ 1185      89529AFF 
+ 1185      885299FF 
+ 1185      885199
+ 1186 2dcf FF885098 		.ascii	"\377\210P\230\377\207P\230\377\207O\230\377\207N\227\377\206"
+ 1186      FF875098 
+ 1186      FF874F98 
+ 1186      FF874E97 
+ 1186      FF86
+ 1187 2de1 4E97FF86 		.ascii	"N\227\377\206M\226\377\206L\226\377\205L\226\377\205K\225\377"
+ 1187      4D96FF86 
+ 1187      4C96FF85 
+ 1187      4C96FF85 
+ 1187      4B95FF
+ 1188 2df4 854A95FF 		.ascii	"\205J\225\377\204J\225\377\204I\224\377\204H\224\377\203H\223"
+ 1188      844A95FF 
+ 1188      844994FF 
+ 1188      844894FF 
+ 1188      834893
+ 1189 2e07 FF834793 		.ascii	"\377\203G\223\377\203F\223\377\202F\222\377\202E\222\377\202"
+ 1189      FF834693 
+ 1189      FF824692 
+ 1189      FF824592 
+ 1189      FF82
+ 1190 2e19 4491FF81 		.ascii	"D\221\377\201D\221\377\201C\221\377\201B\220\377\200B\220\377"
+ 1190      4491FF81 
+ 1190      4391FF81 
+ 1190      4290FF80 
+ 1190      4290FF
+ 1191 2e2c 80418FFF 		.ascii	"\200A\217\377\200@\217\377\177?\217\377\177?\216\377\177>\216"
+ 1191      80408FFF 
+ 1191      7F3F8FFF 
+ 1191      7F3F8EFF 
+ 1191      7F3E8E
+ 1192 2e3f FF7E3D8D 		.ascii	"\377~=\215\377~=\215\377~<\215\377};\214\377};\214\377}:\213"
+ 1192      FF7E3D8D 
+ 1192      FF7E3C8D 
+ 1192      FF7D3B8C 
+ 1192      FF7D3B8C 
+ 1193 2e57 FF7C398B 		.ascii	"\377|9\213\377|8\213\377|8\212\377{7\212\377{6\211\377{5\211"
+GAS LISTING /tmp/cciiIuFx.s 			page 52
+
+
+ 1193      FF7C388B 
+ 1193      FF7C388A 
+ 1193      FF7B378A 
+ 1193      FF7B3689 
+ 1194 2e6f FF7A3588 		.ascii	"\377z5\210\377z4\210\377z3\210\377y3\207\377y2\207\377y1\206"
+ 1194      FF7A3488 
+ 1194      FF7A3388 
+ 1194      FF793387 
+ 1194      FF793287 
+ 1195 2e87 FF783086 		.ascii	"\377x0\206\377x/\206\377x/\205\377w.\205\377w-\204\377w,\204"
+ 1195      FF782F86 
+ 1195      FF782F85 
+ 1195      FF772E85 
+ 1195      FF772D84 
+ 1196 2e9f FF762C84 		.ascii	"\377v,\204\377v+\203\377v*\203\377u)\202\377u)\202\377t)\201"
+ 1196      FF762B83 
+ 1196      FF762A83 
+ 1196      FF752982 
+ 1196      FF752982 
+ 1197 2eb7 FF742881 		.ascii	"\377t(\201\377s(\200\377s'\177\377r'\177\377q'~\377q&~\377p&"
+ 1197      FF732880 
+ 1197      FF73277F 
+ 1197      FF72277F 
+ 1197      FF71277E 
+ 1198 2ed2 7DFF7025 		.ascii	"}\377p%}\377o%|\377o%{\377n${\377n$z\377m#z\377m#y\377l#y\377"
+ 1198      7DFF6F25 
+ 1198      7CFF6F25 
+ 1198      7BFF6E24 
+ 1198      7BFF6E24 
+ 1199 2ef4 6B2278FF 		.ascii	"k\"x\377k\"w\377j!w\377j!v\377i!v\377i u\377h u\377h\037t\377"
+ 1199      6B2277FF 
+ 1199      6A2177FF 
+ 1199      6A2176FF 
+ 1199      692176FF 
+ 1200 2f14 671F74FF 		.ascii	"g\037t\377g\037s\377f\036r\377f\036r\377e\035q\377d\035q\377"
+ 1200      671F73FF 
+ 1200      661E72FF 
+ 1200      661E72FF 
+ 1200      651D71FF 
+ 1201 2f2c 641D70FF 		.ascii	"d\035p\377c\034p\377c\034o\377b\033o\377b\033n\377a\032m\377"
+ 1201      631C70FF 
+ 1201      631C6FFF 
+ 1201      621B6FFF 
+ 1201      621B6EFF 
+ 1202 2f44 611A6DFF 		.ascii	"a\032m\377`\032l\377`\031l\377_\031k\377_\030k\377^\030j\377"
+ 1202      601A6CFF 
+ 1202      60196CFF 
+ 1202      5F196BFF 
+ 1202      5F186BFF 
+ 1203 2f5c 5E186AFF 		.ascii	"^\030j\377]\027i\377\\\027h\377\\\026h\377[\026g\377[\026g\377"
+ 1203      5D1769FF 
+ 1203      5C1768FF 
+ 1203      5C1668FF 
+ 1203      5B1667FF 
+ 1204 2f74 5A1566FF 		.ascii	"Z\025f\377Z\025f\377Y\024e\377Y\024e\377X\023d\377X\023d\377"
+ 1204      5A1566FF 
+ 1204      591465FF 
+GAS LISTING /tmp/cciiIuFx.s 			page 53
+
+
+ 1204      591465FF 
+ 1204      581364FF 
+ 1205 2f8c 571363FF 		.ascii	"W\023c\377W\022b\377V\022b\377V\021a\377U\021a\377U\020`\377"
+ 1205      571262FF 
+ 1205      561262FF 
+ 1205      561161FF 
+ 1205      551161FF 
+ 1206 2fa4 541060FF 		.ascii	"T\020`\377T\020_\377S\017_\377R\017^\377R\016^\377Q\016]\377"
+ 1206      54105FFF 
+ 1206      530F5FFF 
+ 1206      520F5EFF 
+ 1206      520E5EFF 
+ 1207 2fbc 510D5CFF 		.ascii	"Q\r\\\377P\r\\\377P\f[\377O\f[\377O\013Z\377N\013Z\377N\013Y"
+ 1207      500D5CFF 
+ 1207      500C5BFF 
+ 1207      4F0C5BFF 
+ 1207      4F0B5AFF 
+ 1208 2fd7 FF4D0A59 		.ascii	"\377M\nY\377M\nX\377"
+ 1208      FF4D0A58 
+ 1208      FF
+ 1209 2fe0 4C0958FF 		.string	"L\tX\377L\tW\377K\bW\377K\bV\377J\007V\377J\007U\377I\006T\377I\006T\377H\005S\377H\005S\
+ 1209      4C0957FF 
+ 1209      4B0857FF 
+ 1209      4B0856FF 
+ 1209      4A0756FF 
+ 1210 303a 4CFF4100 		.string	"L\377A"
+ 1211 303e 4CFF4000 		.string	"L\377@"
+ 1212 3042 4BFF     		.ascii	"K\377"
+ 1213              		.globl	heatmap_cs_PRGn_discrete
+ 1214              		.section	.data.rel.local
+ 1215              		.align 8
+ 1216              		.type	heatmap_cs_PRGn_discrete, @object
+ 1217              		.size	heatmap_cs_PRGn_discrete, 8
+ 1218              	heatmap_cs_PRGn_discrete:
+ 1219 0018 00000000 		.quad	discrete
+ 1219      00000000 
+ 1220              		.section	.data.rel.ro.local
+ 1221              		.align 16
+ 1222              		.type	discrete, @object
+ 1223              		.size	discrete, 16
+ 1224              	discrete:
+ 1225 0030 00000000 		.quad	discrete_data
+ 1225      00000000 
+ 1226 0038 0C000000 		.quad	12
+ 1226      00000000 
+ 1227              		.section	.rodata
+ 1228 3044 00000000 		.align 32
+ 1228      00000000 
+ 1228      00000000 
+ 1228      00000000 
+ 1228      00000000 
+ 1229              		.type	discrete_data, @object
+ 1230              		.size	discrete_data, 48
+ 1231              	discrete_data:
+ 1232 3060 00       		.string	""
+ 1233 3061 00       		.string	""
+ 1234 3062 00       		.string	""
+GAS LISTING /tmp/cciiIuFx.s 			page 54
+
+
+ 1235 3063 00       		.string	""
+ 1236 3064 00       		.string	""
+ 1237 3065 441BFF1B 		.string	"D\033\377\033x7\377Z\256a\377\246\333\240\377\331\360\323\377\367\367\367\377\347\324\350
+ 1237      7837FF5A 
+ 1237      AE61FFA6 
+ 1237      DBA0FFD9 
+ 1237      F0D3FFF7 
+ 1238 308e 4BFF     		.ascii	"K\377"
+ 1239              		.text
+ 1240              	.Letext0:
+ 1241              		.file 1 "./heatmap.h"
+ 1242              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1243              		.file 3 "./colorschemes/PRGn.h"
+ 1244              		.file 4 "colorschemes/PRGn.c"
+ 1245              		.section	.debug_info,"",@progbits
+ 1246              	.Ldebug_info0:
+ 1247 0000 E3010000 		.long	0x1e3
+ 1248 0004 0500     		.value	0x5
+ 1249 0006 01       		.byte	0x1
+ 1250 0007 08       		.byte	0x8
+ 1251 0008 00000000 		.long	.Ldebug_abbrev0
+ 1252 000c 0A       		.uleb128 0xa
+ 1253 000d 00000000 		.long	.LASF26
+ 1254 0011 1D       		.byte	0x1d
+ 1255 0012 00000000 		.long	.LASF0
+ 1256 0016 00000000 		.long	.LASF1
+ 1257 001a 00000000 		.long	.Ldebug_line0
+ 1258 001e 01       		.uleb128 0x1
+ 1259 001f 08       		.byte	0x8
+ 1260 0020 05       		.byte	0x5
+ 1261 0021 00000000 		.long	.LASF2
+ 1262 0025 06       		.uleb128 0x6
+ 1263 0026 00000000 		.long	.LASF12
+ 1264 002a 02       		.byte	0x2
+ 1265 002b D6       		.byte	0xd6
+ 1266 002c 17       		.byte	0x17
+ 1267 002d 31000000 		.long	0x31
+ 1268 0031 01       		.uleb128 0x1
+ 1269 0032 08       		.byte	0x8
+ 1270 0033 07       		.byte	0x7
+ 1271 0034 00000000 		.long	.LASF3
+ 1272 0038 0B       		.uleb128 0xb
+ 1273 0039 04       		.byte	0x4
+ 1274 003a 05       		.byte	0x5
+ 1275 003b 696E7400 		.string	"int"
+ 1276 003f 01       		.uleb128 0x1
+ 1277 0040 08       		.byte	0x8
+ 1278 0041 05       		.byte	0x5
+ 1279 0042 00000000 		.long	.LASF4
+ 1280 0046 01       		.uleb128 0x1
+ 1281 0047 10       		.byte	0x10
+ 1282 0048 04       		.byte	0x4
+ 1283 0049 00000000 		.long	.LASF5
+ 1284 004d 01       		.uleb128 0x1
+ 1285 004e 04       		.byte	0x4
+ 1286 004f 04       		.byte	0x4
+ 1287 0050 00000000 		.long	.LASF6
+GAS LISTING /tmp/cciiIuFx.s 			page 55
+
+
+ 1288 0054 01       		.uleb128 0x1
+ 1289 0055 04       		.byte	0x4
+ 1290 0056 07       		.byte	0x7
+ 1291 0057 00000000 		.long	.LASF7
+ 1292 005b 01       		.uleb128 0x1
+ 1293 005c 02       		.byte	0x2
+ 1294 005d 07       		.byte	0x7
+ 1295 005e 00000000 		.long	.LASF8
+ 1296 0062 0C       		.uleb128 0xc
+ 1297 0063 10       		.byte	0x10
+ 1298 0064 01       		.byte	0x1
+ 1299 0065 BB       		.byte	0xbb
+ 1300 0066 09       		.byte	0x9
+ 1301 0067 84000000 		.long	0x84
+ 1302 006b 07       		.uleb128 0x7
+ 1303 006c 00000000 		.long	.LASF9
+ 1304 0070 BC       		.byte	0xbc
+ 1305 0071 1A       		.byte	0x1a
+ 1306 0072 84000000 		.long	0x84
+ 1307 0076 00       		.byte	0
+ 1308 0077 07       		.uleb128 0x7
+ 1309 0078 00000000 		.long	.LASF10
+ 1310 007c BD       		.byte	0xbd
+ 1311 007d 0C       		.byte	0xc
+ 1312 007e 25000000 		.long	0x25
+ 1313 0082 08       		.byte	0x8
+ 1314 0083 00       		.byte	0
+ 1315 0084 08       		.uleb128 0x8
+ 1316 0085 90000000 		.long	0x90
+ 1317 0089 01       		.uleb128 0x1
+ 1318 008a 01       		.byte	0x1
+ 1319 008b 08       		.byte	0x8
+ 1320 008c 00000000 		.long	.LASF11
+ 1321 0090 03       		.uleb128 0x3
+ 1322 0091 89000000 		.long	0x89
+ 1323 0095 06       		.uleb128 0x6
+ 1324 0096 00000000 		.long	.LASF13
+ 1325 009a 01       		.byte	0x1
+ 1326 009b BE       		.byte	0xbe
+ 1327 009c 03       		.byte	0x3
+ 1328 009d 62000000 		.long	0x62
+ 1329 00a1 03       		.uleb128 0x3
+ 1330 00a2 95000000 		.long	0x95
+ 1331 00a6 08       		.uleb128 0x8
+ 1332 00a7 A1000000 		.long	0xa1
+ 1333 00ab 04       		.uleb128 0x4
+ 1334 00ac 00000000 		.long	.LASF14
+ 1335 00b0 21       		.byte	0x21
+ 1336 00b1 A6000000 		.long	0xa6
+ 1337 00b5 04       		.uleb128 0x4
+ 1338 00b6 00000000 		.long	.LASF15
+ 1339 00ba 23       		.byte	0x23
+ 1340 00bb A6000000 		.long	0xa6
+ 1341 00bf 04       		.uleb128 0x4
+ 1342 00c0 00000000 		.long	.LASF16
+ 1343 00c4 25       		.byte	0x25
+ 1344 00c5 A6000000 		.long	0xa6
+GAS LISTING /tmp/cciiIuFx.s 			page 56
+
+
+ 1345 00c9 04       		.uleb128 0x4
+ 1346 00ca 00000000 		.long	.LASF17
+ 1347 00ce 28       		.byte	0x28
+ 1348 00cf A6000000 		.long	0xa6
+ 1349 00d3 09       		.uleb128 0x9
+ 1350 00d4 90000000 		.long	0x90
+ 1351 00d8 E3000000 		.long	0xe3
+ 1352 00dc 0D       		.uleb128 0xd
+ 1353 00dd 31000000 		.long	0x31
+ 1354 00e1 2F       		.byte	0x2f
+ 1355 00e2 00       		.byte	0
+ 1356 00e3 03       		.uleb128 0x3
+ 1357 00e4 D3000000 		.long	0xd3
+ 1358 00e8 02       		.uleb128 0x2
+ 1359 00e9 00000000 		.long	.LASF18
+ 1360 00ed 20       		.byte	0x20
+ 1361 00ee 1C       		.byte	0x1c
+ 1362 00ef E3000000 		.long	0xe3
+ 1363 00f3 09       		.uleb128 0x9
+ 1364 00f4 03       		.byte	0x3
+ 1365 00f5 00000000 		.quad	discrete_data
+ 1365      00000000 
+ 1366 00fd 02       		.uleb128 0x2
+ 1367 00fe 00000000 		.long	.LASF19
+ 1368 0102 23       		.byte	0x23
+ 1369 0103 24       		.byte	0x24
+ 1370 0104 A1000000 		.long	0xa1
+ 1371 0108 09       		.uleb128 0x9
+ 1372 0109 03       		.byte	0x3
+ 1373 010a 00000000 		.quad	discrete
+ 1373      00000000 
+ 1374 0112 05       		.uleb128 0x5
+ 1375 0113 AB000000 		.long	0xab
+ 1376 0117 24       		.byte	0x24
+ 1377 0118 09       		.uleb128 0x9
+ 1378 0119 03       		.byte	0x3
+ 1379 011a 00000000 		.quad	heatmap_cs_PRGn_discrete
+ 1379      00000000 
+ 1380 0122 09       		.uleb128 0x9
+ 1381 0123 90000000 		.long	0x90
+ 1382 0127 33010000 		.long	0x133
+ 1383 012b 0E       		.uleb128 0xe
+ 1384 012c 31000000 		.long	0x31
+ 1385 0130 0310     		.value	0x1003
+ 1386 0132 00       		.byte	0
+ 1387 0133 03       		.uleb128 0x3
+ 1388 0134 22010000 		.long	0x122
+ 1389 0138 02       		.uleb128 0x2
+ 1390 0139 00000000 		.long	.LASF20
+ 1391 013d 26       		.byte	0x26
+ 1392 013e 1C       		.byte	0x1c
+ 1393 013f 33010000 		.long	0x133
+ 1394 0143 09       		.uleb128 0x9
+ 1395 0144 03       		.byte	0x3
+ 1396 0145 00000000 		.quad	soft_data
+ 1396      00000000 
+ 1397 014d 02       		.uleb128 0x2
+GAS LISTING /tmp/cciiIuFx.s 			page 57
+
+
+ 1398 014e 00000000 		.long	.LASF21
+ 1399 0152 29       		.byte	0x29
+ 1400 0153 24       		.byte	0x24
+ 1401 0154 A1000000 		.long	0xa1
+ 1402 0158 09       		.uleb128 0x9
+ 1403 0159 03       		.byte	0x3
+ 1404 015a 00000000 		.quad	soft
+ 1404      00000000 
+ 1405 0162 05       		.uleb128 0x5
+ 1406 0163 B5000000 		.long	0xb5
+ 1407 0167 2A       		.byte	0x2a
+ 1408 0168 09       		.uleb128 0x9
+ 1409 0169 03       		.byte	0x3
+ 1410 016a 00000000 		.quad	heatmap_cs_PRGn_soft
+ 1410      00000000 
+ 1411 0172 02       		.uleb128 0x2
+ 1412 0173 00000000 		.long	.LASF22
+ 1413 0177 2C       		.byte	0x2c
+ 1414 0178 1C       		.byte	0x1c
+ 1415 0179 33010000 		.long	0x133
+ 1416 017d 09       		.uleb128 0x9
+ 1417 017e 03       		.byte	0x3
+ 1418 017f 00000000 		.quad	mixed_data
+ 1418      00000000 
+ 1419 0187 02       		.uleb128 0x2
+ 1420 0188 00000000 		.long	.LASF23
+ 1421 018c 2F       		.byte	0x2f
+ 1422 018d 24       		.byte	0x24
+ 1423 018e A1000000 		.long	0xa1
+ 1424 0192 09       		.uleb128 0x9
+ 1425 0193 03       		.byte	0x3
+ 1426 0194 00000000 		.quad	mixed
+ 1426      00000000 
+ 1427 019c 05       		.uleb128 0x5
+ 1428 019d BF000000 		.long	0xbf
+ 1429 01a1 30       		.byte	0x30
+ 1430 01a2 09       		.uleb128 0x9
+ 1431 01a3 03       		.byte	0x3
+ 1432 01a4 00000000 		.quad	heatmap_cs_PRGn_mixed
+ 1432      00000000 
+ 1433 01ac 02       		.uleb128 0x2
+ 1434 01ad 00000000 		.long	.LASF24
+ 1435 01b1 32       		.byte	0x32
+ 1436 01b2 1C       		.byte	0x1c
+ 1437 01b3 33010000 		.long	0x133
+ 1438 01b7 09       		.uleb128 0x9
+ 1439 01b8 03       		.byte	0x3
+ 1440 01b9 00000000 		.quad	mixed_exp_data
+ 1440      00000000 
+ 1441 01c1 02       		.uleb128 0x2
+ 1442 01c2 00000000 		.long	.LASF25
+ 1443 01c6 35       		.byte	0x35
+ 1444 01c7 24       		.byte	0x24
+ 1445 01c8 A1000000 		.long	0xa1
+ 1446 01cc 09       		.uleb128 0x9
+ 1447 01cd 03       		.byte	0x3
+ 1448 01ce 00000000 		.quad	mixed_exp
+GAS LISTING /tmp/cciiIuFx.s 			page 58
+
+
+ 1448      00000000 
+ 1449 01d6 05       		.uleb128 0x5
+ 1450 01d7 C9000000 		.long	0xc9
+ 1451 01db 36       		.byte	0x36
+ 1452 01dc 09       		.uleb128 0x9
+ 1453 01dd 03       		.byte	0x3
+ 1454 01de 00000000 		.quad	heatmap_cs_PRGn_mixed_exp
+ 1454      00000000 
+ 1455 01e6 00       		.byte	0
+ 1456              		.section	.debug_abbrev,"",@progbits
+ 1457              	.Ldebug_abbrev0:
+ 1458 0000 01       		.uleb128 0x1
+ 1459 0001 24       		.uleb128 0x24
+ 1460 0002 00       		.byte	0
+ 1461 0003 0B       		.uleb128 0xb
+ 1462 0004 0B       		.uleb128 0xb
+ 1463 0005 3E       		.uleb128 0x3e
+ 1464 0006 0B       		.uleb128 0xb
+ 1465 0007 03       		.uleb128 0x3
+ 1466 0008 0E       		.uleb128 0xe
+ 1467 0009 00       		.byte	0
+ 1468 000a 00       		.byte	0
+ 1469 000b 02       		.uleb128 0x2
+ 1470 000c 34       		.uleb128 0x34
+ 1471 000d 00       		.byte	0
+ 1472 000e 03       		.uleb128 0x3
+ 1473 000f 0E       		.uleb128 0xe
+ 1474 0010 3A       		.uleb128 0x3a
+ 1475 0011 21       		.uleb128 0x21
+ 1476 0012 04       		.sleb128 4
+ 1477 0013 3B       		.uleb128 0x3b
+ 1478 0014 0B       		.uleb128 0xb
+ 1479 0015 39       		.uleb128 0x39
+ 1480 0016 0B       		.uleb128 0xb
+ 1481 0017 49       		.uleb128 0x49
+ 1482 0018 13       		.uleb128 0x13
+ 1483 0019 02       		.uleb128 0x2
+ 1484 001a 18       		.uleb128 0x18
+ 1485 001b 00       		.byte	0
+ 1486 001c 00       		.byte	0
+ 1487 001d 03       		.uleb128 0x3
+ 1488 001e 26       		.uleb128 0x26
+ 1489 001f 00       		.byte	0
+ 1490 0020 49       		.uleb128 0x49
+ 1491 0021 13       		.uleb128 0x13
+ 1492 0022 00       		.byte	0
+ 1493 0023 00       		.byte	0
+ 1494 0024 04       		.uleb128 0x4
+ 1495 0025 34       		.uleb128 0x34
+ 1496 0026 00       		.byte	0
+ 1497 0027 03       		.uleb128 0x3
+ 1498 0028 0E       		.uleb128 0xe
+ 1499 0029 3A       		.uleb128 0x3a
+ 1500 002a 21       		.uleb128 0x21
+ 1501 002b 03       		.sleb128 3
+ 1502 002c 3B       		.uleb128 0x3b
+ 1503 002d 0B       		.uleb128 0xb
+GAS LISTING /tmp/cciiIuFx.s 			page 59
+
+
+ 1504 002e 39       		.uleb128 0x39
+ 1505 002f 21       		.uleb128 0x21
+ 1506 0030 25       		.sleb128 37
+ 1507 0031 49       		.uleb128 0x49
+ 1508 0032 13       		.uleb128 0x13
+ 1509 0033 3F       		.uleb128 0x3f
+ 1510 0034 19       		.uleb128 0x19
+ 1511 0035 3C       		.uleb128 0x3c
+ 1512 0036 19       		.uleb128 0x19
+ 1513 0037 00       		.byte	0
+ 1514 0038 00       		.byte	0
+ 1515 0039 05       		.uleb128 0x5
+ 1516 003a 34       		.uleb128 0x34
+ 1517 003b 00       		.byte	0
+ 1518 003c 47       		.uleb128 0x47
+ 1519 003d 13       		.uleb128 0x13
+ 1520 003e 3A       		.uleb128 0x3a
+ 1521 003f 21       		.uleb128 0x21
+ 1522 0040 04       		.sleb128 4
+ 1523 0041 3B       		.uleb128 0x3b
+ 1524 0042 0B       		.uleb128 0xb
+ 1525 0043 39       		.uleb128 0x39
+ 1526 0044 21       		.uleb128 0x21
+ 1527 0045 1E       		.sleb128 30
+ 1528 0046 02       		.uleb128 0x2
+ 1529 0047 18       		.uleb128 0x18
+ 1530 0048 00       		.byte	0
+ 1531 0049 00       		.byte	0
+ 1532 004a 06       		.uleb128 0x6
+ 1533 004b 16       		.uleb128 0x16
+ 1534 004c 00       		.byte	0
+ 1535 004d 03       		.uleb128 0x3
+ 1536 004e 0E       		.uleb128 0xe
+ 1537 004f 3A       		.uleb128 0x3a
+ 1538 0050 0B       		.uleb128 0xb
+ 1539 0051 3B       		.uleb128 0x3b
+ 1540 0052 0B       		.uleb128 0xb
+ 1541 0053 39       		.uleb128 0x39
+ 1542 0054 0B       		.uleb128 0xb
+ 1543 0055 49       		.uleb128 0x49
+ 1544 0056 13       		.uleb128 0x13
+ 1545 0057 00       		.byte	0
+ 1546 0058 00       		.byte	0
+ 1547 0059 07       		.uleb128 0x7
+ 1548 005a 0D       		.uleb128 0xd
+ 1549 005b 00       		.byte	0
+ 1550 005c 03       		.uleb128 0x3
+ 1551 005d 0E       		.uleb128 0xe
+ 1552 005e 3A       		.uleb128 0x3a
+ 1553 005f 21       		.uleb128 0x21
+ 1554 0060 01       		.sleb128 1
+ 1555 0061 3B       		.uleb128 0x3b
+ 1556 0062 0B       		.uleb128 0xb
+ 1557 0063 39       		.uleb128 0x39
+ 1558 0064 0B       		.uleb128 0xb
+ 1559 0065 49       		.uleb128 0x49
+ 1560 0066 13       		.uleb128 0x13
+GAS LISTING /tmp/cciiIuFx.s 			page 60
+
+
+ 1561 0067 38       		.uleb128 0x38
+ 1562 0068 0B       		.uleb128 0xb
+ 1563 0069 00       		.byte	0
+ 1564 006a 00       		.byte	0
+ 1565 006b 08       		.uleb128 0x8
+ 1566 006c 0F       		.uleb128 0xf
+ 1567 006d 00       		.byte	0
+ 1568 006e 0B       		.uleb128 0xb
+ 1569 006f 21       		.uleb128 0x21
+ 1570 0070 08       		.sleb128 8
+ 1571 0071 49       		.uleb128 0x49
+ 1572 0072 13       		.uleb128 0x13
+ 1573 0073 00       		.byte	0
+ 1574 0074 00       		.byte	0
+ 1575 0075 09       		.uleb128 0x9
+ 1576 0076 01       		.uleb128 0x1
+ 1577 0077 01       		.byte	0x1
+ 1578 0078 49       		.uleb128 0x49
+ 1579 0079 13       		.uleb128 0x13
+ 1580 007a 01       		.uleb128 0x1
+ 1581 007b 13       		.uleb128 0x13
+ 1582 007c 00       		.byte	0
+ 1583 007d 00       		.byte	0
+ 1584 007e 0A       		.uleb128 0xa
+ 1585 007f 11       		.uleb128 0x11
+ 1586 0080 01       		.byte	0x1
+ 1587 0081 25       		.uleb128 0x25
+ 1588 0082 0E       		.uleb128 0xe
+ 1589 0083 13       		.uleb128 0x13
+ 1590 0084 0B       		.uleb128 0xb
+ 1591 0085 03       		.uleb128 0x3
+ 1592 0086 1F       		.uleb128 0x1f
+ 1593 0087 1B       		.uleb128 0x1b
+ 1594 0088 1F       		.uleb128 0x1f
+ 1595 0089 10       		.uleb128 0x10
+ 1596 008a 17       		.uleb128 0x17
+ 1597 008b 00       		.byte	0
+ 1598 008c 00       		.byte	0
+ 1599 008d 0B       		.uleb128 0xb
+ 1600 008e 24       		.uleb128 0x24
+ 1601 008f 00       		.byte	0
+ 1602 0090 0B       		.uleb128 0xb
+ 1603 0091 0B       		.uleb128 0xb
+ 1604 0092 3E       		.uleb128 0x3e
+ 1605 0093 0B       		.uleb128 0xb
+ 1606 0094 03       		.uleb128 0x3
+ 1607 0095 08       		.uleb128 0x8
+ 1608 0096 00       		.byte	0
+ 1609 0097 00       		.byte	0
+ 1610 0098 0C       		.uleb128 0xc
+ 1611 0099 13       		.uleb128 0x13
+ 1612 009a 01       		.byte	0x1
+ 1613 009b 0B       		.uleb128 0xb
+ 1614 009c 0B       		.uleb128 0xb
+ 1615 009d 3A       		.uleb128 0x3a
+ 1616 009e 0B       		.uleb128 0xb
+ 1617 009f 3B       		.uleb128 0x3b
+GAS LISTING /tmp/cciiIuFx.s 			page 61
+
+
+ 1618 00a0 0B       		.uleb128 0xb
+ 1619 00a1 39       		.uleb128 0x39
+ 1620 00a2 0B       		.uleb128 0xb
+ 1621 00a3 01       		.uleb128 0x1
+ 1622 00a4 13       		.uleb128 0x13
+ 1623 00a5 00       		.byte	0
+ 1624 00a6 00       		.byte	0
+ 1625 00a7 0D       		.uleb128 0xd
+ 1626 00a8 21       		.uleb128 0x21
+ 1627 00a9 00       		.byte	0
+ 1628 00aa 49       		.uleb128 0x49
+ 1629 00ab 13       		.uleb128 0x13
+ 1630 00ac 2F       		.uleb128 0x2f
+ 1631 00ad 0B       		.uleb128 0xb
+ 1632 00ae 00       		.byte	0
+ 1633 00af 00       		.byte	0
+ 1634 00b0 0E       		.uleb128 0xe
+ 1635 00b1 21       		.uleb128 0x21
+ 1636 00b2 00       		.byte	0
+ 1637 00b3 49       		.uleb128 0x49
+ 1638 00b4 13       		.uleb128 0x13
+ 1639 00b5 2F       		.uleb128 0x2f
+ 1640 00b6 05       		.uleb128 0x5
+ 1641 00b7 00       		.byte	0
+ 1642 00b8 00       		.byte	0
+ 1643 00b9 00       		.byte	0
+ 1644              		.section	.debug_aranges,"",@progbits
+ 1645 0000 1C000000 		.long	0x1c
+ 1646 0004 0200     		.value	0x2
+ 1647 0006 00000000 		.long	.Ldebug_info0
+ 1648 000a 08       		.byte	0x8
+ 1649 000b 00       		.byte	0
+ 1650 000c 0000     		.value	0
+ 1651 000e 0000     		.value	0
+ 1652 0010 00000000 		.quad	0
+ 1652      00000000 
+ 1653 0018 00000000 		.quad	0
+ 1653      00000000 
+ 1654              		.section	.debug_line,"",@progbits
+ 1655              	.Ldebug_line0:
+ 1656 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1656      05000800 
+ 1656      49000000 
+ 1656      010101FB 
+ 1656      0E0D0001 
+ 1657              	.LASF20:
+ 1658 0000 736F6674 		.string	"soft_data"
+ 1658      5F646174 
+ 1658      6100
+ 1659              	.LASF12:
+ 1660 000a 73697A65 		.string	"size_t"
+ 1660      5F7400
+ 1661              	.LASF13:
+ 1662 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1662      6D61705F 
+ 1662      636F6C6F 
+ 1662      72736368 
+GAS LISTING /tmp/cciiIuFx.s 			page 62
+
+
+ 1662      656D655F 
+ 1663              	.LASF15:
+ 1664 0027 68656174 		.string	"heatmap_cs_PRGn_soft"
+ 1664      6D61705F 
+ 1664      63735F50 
+ 1664      52476E5F 
+ 1664      736F6674 
+ 1665              	.LASF17:
+ 1666 003c 68656174 		.string	"heatmap_cs_PRGn_mixed_exp"
+ 1666      6D61705F 
+ 1666      63735F50 
+ 1666      52476E5F 
+ 1666      6D697865 
+ 1667              	.LASF26:
+ 1668 0056 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1668      43313720 
+ 1668      31322E32 
+ 1668      2E30202D 
+ 1668      6D74756E 
+ 1669              	.LASF6:
+ 1670 00b5 666C6F61 		.string	"float"
+ 1670      7400
+ 1671              	.LASF11:
+ 1672 00bb 756E7369 		.string	"unsigned char"
+ 1672      676E6564 
+ 1672      20636861 
+ 1672      7200
+ 1673              	.LASF3:
+ 1674 00c9 6C6F6E67 		.string	"long unsigned int"
+ 1674      20756E73 
+ 1674      69676E65 
+ 1674      6420696E 
+ 1674      7400
+ 1675              	.LASF8:
+ 1676 00db 73686F72 		.string	"short unsigned int"
+ 1676      7420756E 
+ 1676      7369676E 
+ 1676      65642069 
+ 1676      6E7400
+ 1677              	.LASF25:
+ 1678 00ee 6D697865 		.string	"mixed_exp"
+ 1678      645F6578 
+ 1678      7000
+ 1679              	.LASF23:
+ 1680 00f8 6D697865 		.string	"mixed"
+ 1680      6400
+ 1681              	.LASF21:
+ 1682 00fe 736F6674 		.string	"soft"
+ 1682      00
+ 1683              	.LASF14:
+ 1684 0103 68656174 		.string	"heatmap_cs_PRGn_discrete"
+ 1684      6D61705F 
+ 1684      63735F50 
+ 1684      52476E5F 
+ 1684      64697363 
+ 1685              	.LASF7:
+ 1686 011c 756E7369 		.string	"unsigned int"
+GAS LISTING /tmp/cciiIuFx.s 			page 63
+
+
+ 1686      676E6564 
+ 1686      20696E74 
+ 1686      00
+ 1687              	.LASF19:
+ 1688 0129 64697363 		.string	"discrete"
+ 1688      72657465 
+ 1688      00
+ 1689              	.LASF10:
+ 1690 0132 6E636F6C 		.string	"ncolors"
+ 1690      6F727300 
+ 1691              	.LASF4:
+ 1692 013a 6C6F6E67 		.string	"long long int"
+ 1692      206C6F6E 
+ 1692      6720696E 
+ 1692      7400
+ 1693              	.LASF24:
+ 1694 0148 6D697865 		.string	"mixed_exp_data"
+ 1694      645F6578 
+ 1694      705F6461 
+ 1694      746100
+ 1695              	.LASF22:
+ 1696 0157 6D697865 		.string	"mixed_data"
+ 1696      645F6461 
+ 1696      746100
+ 1697              	.LASF2:
+ 1698 0162 6C6F6E67 		.string	"long int"
+ 1698      20696E74 
+ 1698      00
+ 1699              	.LASF5:
+ 1700 016b 6C6F6E67 		.string	"long double"
+ 1700      20646F75 
+ 1700      626C6500 
+ 1701              	.LASF18:
+ 1702 0177 64697363 		.string	"discrete_data"
+ 1702      72657465 
+ 1702      5F646174 
+ 1702      6100
+ 1703              	.LASF16:
+ 1704 0185 68656174 		.string	"heatmap_cs_PRGn_mixed"
+ 1704      6D61705F 
+ 1704      63735F50 
+ 1704      52476E5F 
+ 1704      6D697865 
+ 1705              	.LASF9:
+ 1706 019b 636F6C6F 		.string	"colors"
+ 1706      727300
+ 1707              		.section	.debug_line_str,"MS",@progbits,1
+ 1708              	.LASF0:
+ 1709 0000 636F6C6F 		.string	"colorschemes/PRGn.c"
+ 1709      72736368 
+ 1709      656D6573 
+ 1709      2F505247 
+ 1709      6E2E6300 
+ 1710              	.LASF1:
+ 1711 0014 2F726F6F 		.string	"/root/repo"
+ 1711      742F7265 
+ 1711      706F00
+GAS LISTING /tmp/cciiIuFx.s 			page 64
+
+
+ 1712              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1713 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1713      742F7265 
+ 1713      706F0063 
+ 1713      6F6C6F72 
+ 1713      73636865 
@@ -0,0 +1,4088 @@
+GAS LISTING /tmp/ccw8Qa8b.s 			page 1
+
+
+   1              		.file	"PiYG.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/PiYG.c"
+   5              		.globl	heatmap_cs_PiYG_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_PiYG_mixed_exp, @object
+   9              		.size	heatmap_cs_PiYG_mixed_exp, 8
+  10              	heatmap_cs_PiYG_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 27641800 		.string	"'d\030"
+  29 0008 29671918 		.ascii	")g\031\030,j\0321/n\033J1q\033c4u\034|?\201\036\225B\205\037"
+  29      2C6A1A31 
+  29      2F6E1B4A 
+  29      31711B63 
+  29      34751C7C 
+  30 0023 AE44881F 		.ascii	"\256D\210\037\307G\214 \340J\217 \371M\222!\377Q\225#\377T\230"
+  30      C7478C20 
+  30      E04A8F20 
+  30      F94D9221 
+  30      FF519523 
+  31 003a 26FF589B 		.ascii	"&\377X\233(\377[\236*\377_\241,\377l\2545\377o\2577\377s\262"
+  31      28FF5B9E 
+  31      2AFF5FA1 
+  31      2CFF6CAC 
+  31      35FF6FAF 
+  32 0052 39FF76B4 		.ascii	"9\377v\264;\377y\267=\377}\272?\377\200\274B\377\204\277G\377"
+  32      3BFF79B7 
+  32      3DFF7DBA 
+  32      3FFF80BC 
+  32      42FF84BF 
+  33 0068 87C14BFF 		.ascii	"\207\301K\377\213\303P\377\217\306T\377\222\310X\377\226\312"
+  33      8BC350FF 
+  33      8FC654FF 
+  33      92C858FF 
+  33      96CA
+  34 007a 5CFFA4D4 		.ascii	"\\\377\244\324n\377\250\326r\377\253\330v\377\256\332z\377\262"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 2
+
+
+  34      6EFFA8D6 
+  34      72FFABD8 
+  34      76FFAEDA 
+  34      7AFFB2
+  35 008d DC7EFFB5 		.ascii	"\334~\377\265\337\202\377\270\341\206\377\273\342\212\377\275"
+  35      DF82FFB8 
+  35      E186FFBB 
+  35      E28AFFBD 
+  36 009d E38EFFC0 		.ascii	"\343\216\377\300\344\222\377\302\345\226\377\305\346\232\377"
+  36      E492FFC2 
+  36      E596FFC5 
+  36      E69AFF
+  37 00ac C8E79EFF 		.ascii	"\310\347\236\377\312\350\242\377\326\355\265\377\330\356\271"
+  37      CAE8A2FF 
+  37      D6EDB5FF 
+  37      D8EEB9
+  38 00bb FFDAEFBD 		.ascii	"\377\332\357\275\377\335\361\301\377\337\362\304\377\341\363"
+  38      FFDDF1C1 
+  38      FFDFF2C4 
+  38      FFE1F3
+  39 00ca C8FFE3F4 		.ascii	"\310\377\343\364\314\377\346\364\317\377\353\364\320\377\357"
+  39      CCFFE6F4 
+  39      CFFFEBF4 
+  39      D0FFEF
+  40 00d9 F3D0FFF3 		.ascii	"\363\320\377\363\362\321\377\366\361\323\377\371\361\325\377"
+  40      F2D1FFF6 
+  40      F1D3FFF9 
+  40      F1D5FF
+  41 00e8 FAF0D8FF 		.ascii	"\372\360\330\377\372\360\332\377\372\360\335\377\375\361\350"
+  41      FAF0DAFF 
+  41      FAF0DDFF 
+  41      FDF1E8
+  42 00f7 FFFDF1EA 		.ascii	"\377\375\361\352\377\375\362\355\377\375\362\357\377\375\363"
+  42      FFFDF2ED 
+  42      FFFDF2EF 
+  42      FFFDF3
+  43 0106 F1FFFCF4 		.ascii	"\361\377\374\364\363\377\372\364\365\377\371\365\366\377\367"
+  43      F3FFFAF4 
+  43      F5FFF9F5 
+  43      F6FFF7
+  44 0115 F6F6FFF7 		.ascii	"\366\366\377\367\366\366\377\367\365\366\377\370\364\365\377"
+  44      F6F6FFF7 
+  44      F5F6FFF8 
+  44      F4F5FF
+  45 0124 F8F3F5FF 		.ascii	"\370\363\365\377\370\362\364\377\371\361\364\377\371\360\363"
+  45      F8F2F4FF 
+  45      F9F1F4FF 
+  45      F9F0F3
+  46 0133 FFF9EFF3 		.ascii	"\377\371\357\363\377\372\357\362\377\372\356\362\377\373\350"
+  46      FFFAEFF2 
+  46      FFFAEEF2 
+  46      FFFBE8
+  47 0142 F0FFFCE7 		.ascii	"\360\377\374\347\360\377\374\346\360\377\374\346\357\377\374"
+  47      F0FFFCE6 
+  47      F0FFFCE6 
+  47      EFFFFC
+  48 0151 E5EFFFFC 		.ascii	"\345\357\377\374\344\357\377\374\343\357\377\374\342\357\377"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 3
+
+
+  48      E4EFFFFC 
+  48      E3EFFFFC 
+  48      E2EFFF
+  49 0160 FCE2EFFF 		.ascii	"\374\342\357\377\374\341\357\377\374\340\357\377\374\337\356"
+  49      FCE1EFFF 
+  49      FCE0EFFF 
+  49      FCDFEE
+  50 016f FFFCDEED 		.ascii	"\377\374\336\355\377\374\334\355\377\373\333\354\377\373\331"
+  50      FFFCDCED 
+  50      FFFBDBEC 
+  50      FFFBD9
+  51 017e EBFFFBD8 		.ascii	"\353\377\373\330\353\377\372\327\352\377\372\325\351\377\372"
+  51      EBFFFAD7 
+  51      EAFFFAD5 
+  51      E9FFFA
+  52 018d D4E8FFF9 		.ascii	"\324\350\377\371\323\350\377\371\321\347\377\371\320\346\377"
+  52      D3E8FFF9 
+  52      D1E7FFF9 
+  52      D0E6FF
+  53 019c F8CFE6FF 		.ascii	"\370\317\346\377\365\305\341\377\365\304\340\377\365\303\340"
+  53      F5C5E1FF 
+  53      F5C4E0FF 
+  53      F5C3E0
+  54 01ab FFF4C1DF 		.ascii	"\377\364\301\337\377\364\300\337\377\364\277\336\377\363\276"
+  54      FFF4C0DF 
+  54      FFF4BFDE 
+  54      FFF3BE
+  55 01ba DDFFF3BD 		.ascii	"\335\377\363\275\335\377\362\273\334\377\362\272\334\377\362"
+  55      DDFFF2BB 
+  55      DCFFF2BA 
+  55      DCFFF2
+  56 01c9 B9DBFFF1 		.ascii	"\271\333\377\361\270\333\377\361\267\332\377\361\266\332\377"
+  56      B8DBFFF1 
+  56      B7DAFFF1 
+  56      B6DAFF
+  57 01d8 F0B4D9FF 		.ascii	"\360\264\331\377\360\263\330\377\357\261\326\377\357\257\325"
+  57      F0B3D8FF 
+  57      EFB1D6FF 
+  57      EFAFD5
+  58 01e7 FFEEAED4 		.ascii	"\377\356\256\324\377\356\254\323\377\355\253\322\377\355\251"
+  58      FFEEACD3 
+  58      FFEDABD2 
+  58      FFEDA9
+  59 01f6 D1FFECA8 		.ascii	"\321\377\354\250\320\377\354\246\317\377\353\245\316\377\353"
+  59      D0FFECA6 
+  59      CFFFEBA5 
+  59      CEFFEB
+  60 0205 A3CDFFEB 		.ascii	"\243\315\377\353\242\314\377\352\240\313\377\352\237\312\377"
+  60      A2CCFFEA 
+  60      A0CBFFEA 
+  60      9FCAFF
+  61 0214 E99EC9FF 		.ascii	"\351\236\311\377\345\220\277\377\345\216\276\377\344\215\275"
+  61      E590BFFF 
+  61      E58EBEFF 
+  61      E48DBD
+  62 0223 FFE48BBC 		.ascii	"\377\344\213\274\377\343\212\273\377\343\211\272\377\343\207"
+  62      FFE38ABB 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 4
+
+
+  62      FFE389BA 
+  62      FFE387
+  63 0232 B9FFE286 		.ascii	"\271\377\342\206\270\377\342\205\270\377\341\203\267\377\341"
+  63      B8FFE285 
+  63      B8FFE183 
+  63      B7FFE1
+  64 0241 82B6FFE1 		.ascii	"\202\266\377\341\201\265\377\340\177\264\377\340~\263\377\337"
+  64      81B5FFE0 
+  64      7FB4FFE0 
+  64      7EB3FFDF 
+  65 0251 7DB2FFDF 		.ascii	"}\262\377\337|\261\377\337z\260\377\336y\257\377\336x\257\377"
+  65      7CB1FFDF 
+  65      7AB0FFDE 
+  65      79AFFFDE 
+  65      78AFFF
+  66 0264 DE77AEFF 		.ascii	"\336w\256\377\335u\255\377\335t\254\377\334s\253\377\334r\252"
+  66      DD75ADFF 
+  66      DD74ACFF 
+  66      DC73ABFF 
+  66      DC72AA
+  67 0277 FFDC70A9 		.ascii	"\377\334p\251\377\333o\251\377\333n\250\377\332m\247\377\332"
+  67      FFDB6FA9 
+  67      FFDB6EA8 
+  67      FFDA6DA7 
+  67      FFDA
+  68 0289 6BA6FFDA 		.ascii	"k\246\377\332j\245\377\331i\245\377\331h\244\377\330f\243\377"
+  68      6AA5FFD9 
+  68      69A5FFD9 
+  68      68A4FFD8 
+  68      66A3FF
+  69 029c D865A2FF 		.ascii	"\330e\242\377\330d\241\377\327c\241\377\327a\240\377\326`\237"
+  69      D864A1FF 
+  69      D763A1FF 
+  69      D761A0FF 
+  69      D6609F
+  70 02af FFD65F9E 		.ascii	"\377\326_\236\377\326^\236\377\325]\235\377\325\\\234\377\325"
+  70      FFD65E9E 
+  70      FFD55D9D 
+  70      FFD55C9C 
+  70      FFD5
+  71 02c1 5A9CFFD4 		.ascii	"Z\234\377\324Y\233\377\317F\220\377\317D\220\377\316C\217\377"
+  71      599BFFCF 
+  71      4690FFCF 
+  71      4490FFCE 
+  71      438FFF
+  72 02d4 CE428EFF 		.ascii	"\316B\216\377\316A\216\377\315@\215\377\315?\214\377\315=\214"
+  72      CE418EFF 
+  72      CD408DFF 
+  72      CD3F8CFF 
+  72      CD3D8C
+  73 02e7 FFCC3C8B 		.ascii	"\377\314<\213\377\314;\212\377\314:\212\377\3139\211\377\313"
+  73      FFCC3B8A 
+  73      FFCC3A8A 
+  73      FFCB3989 
+  73      FFCB
+  74 02f9 3888FFCB 		.ascii	"8\210\377\3136\210\377\3125\207\377\3124\207\377\3123\206\377"
+  74      3688FFCA 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 5
+
+
+  74      3587FFCA 
+  74      3487FFCA 
+  74      3386FF
+  75 030c C93285FF 		.ascii	"\3112\205\377\3110\205\377\311/\204\377\310.\204\377\310-\203"
+  75      C93085FF 
+  75      C92F84FF 
+  75      C82E84FF 
+  75      C82D83
+  76 031f FFC82B83 		.ascii	"\377\310+\203\377\307*\202\377\307)\201\377\307'\201\377\307"
+  76      FFC72A82 
+  76      FFC72981 
+  76      FFC72781 
+  76      FFC7
+  77 0331 2680FFC6 		.ascii	"&\200\377\306%\200\377\306#\177\377\306\"\177\377\305 ~\377\305"
+  77      2580FFC6 
+  77      237FFFC6 
+  77      227FFFC5 
+  77      207EFFC5 
+  78 0345 1F7EFFC5 		.ascii	"\037~\377\305\035}\377\305\034}\377\304\032|\377\304\032|\377"
+  78      1D7DFFC5 
+  78      1C7DFFC4 
+  78      1A7CFFC4 
+  78      1A7CFF
+  79 0358 C31A7BFF 		.ascii	"\303\032{\377\303\032{\377\302\031{\377\302\031z\377\301\031"
+  79      C31A7BFF 
+  79      C2197BFF 
+  79      C2197AFF 
+  79      C119
+  80 036a 7AFFC119 		.ascii	"z\377\301\031y\377\300\031y\377\300\030y\377\277\030x\377\277"
+  80      79FFC019 
+  80      79FFC018 
+  80      79FFBF18 
+  80      78FFBF
+  81 037d 1878FFBE 		.ascii	"\030x\377\276\030w\377\276\027w\377\275\027w\377\275\027v\377"
+  81      1877FFBE 
+  81      1777FFBD 
+  81      1777FFBD 
+  81      1776FF
+  82 0390 BC1776FF 		.ascii	"\274\027v\377\274\027u\377\273\026u\377\273\026u\377\272\026"
+  82      BC1775FF 
+  82      BB1675FF 
+  82      BB1675FF 
+  82      BA16
+  83 03a2 74FFBA16 		.ascii	"t\377\272\026t\377\272\026t\377\271\025s\377\271\025s\377\270"
+  83      74FFBA16 
+  83      74FFB915 
+  83      73FFB915 
+  83      73FFB8
+  84 03b5 1573FFB8 		.ascii	"\025s\377\270\025r\377\270\025r\377\267\024r\377\267\024q\377"
+  84      1572FFB8 
+  84      1572FFB7 
+  84      1472FFB7 
+  84      1471FF
+  85 03c8 B61471FF 		.ascii	"\266\024q\377\266\024q\377\266\024q\377\265\023p\377\265\023"
+  85      B61471FF 
+  85      B61471FF 
+  85      B51370FF 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 6
+
+
+  85      B513
+  86 03da 70FFB513 		.ascii	"p\377\265\023p\377\264\023o\377\264\023o\377\263\023o\377\263"
+  86      70FFB413 
+  86      6FFFB413 
+  86      6FFFB313 
+  86      6FFFB3
+  87 03ed 126FFFB3 		.ascii	"\022o\377\263\022n\377\262\022n\377\262\022n\377\262\022m\377"
+  87      126EFFB2 
+  87      126EFFB2 
+  87      126EFFB2 
+  87      126DFF
+  88 0400 B1126DFF 		.ascii	"\261\022m\377\261\021m\377\261\021m\377\260\021l\377\260\021"
+  88      B1116DFF 
+  88      B1116DFF 
+  88      B0116CFF 
+  88      B011
+  89 0412 6CFFB011 		.ascii	"l\377\260\021l\377\260\021l\377\257\021k\377\257\020k\377\257"
+  89      6CFFB011 
+  89      6CFFAF11 
+  89      6BFFAF10 
+  89      6BFFAF
+  90 0425 106BFFAE 		.ascii	"\020k\377\256\020k\377\243\013b\377\243\013b\377\242\nb\377\242"
+  90      106BFFA3 
+  90      0B62FFA3 
+  90      0B62FFA2 
+  90      0A62FFA2 
+  91 0439 0A61FFA2 		.ascii	"\na\377\242\na\377\242\na\377\241\na\377\241\n`\377\241\n`\377"
+  91      0A61FFA2 
+  91      0A61FFA1 
+  91      0A61FFA1 
+  91      0A60FFA1 
+  92 0450 A10960FF 		.ascii	"\241\t`\377\240\t`\377\240\t`\377\240\t_\377\240\t_\377\237\t"
+  92      A00960FF 
+  92      A00960FF 
+  92      A0095FFF 
+  92      A0095FFF 
+  93 0466 5FFF9F09 		.ascii	"_\377\237\t_\377\237\t_\377\237\b_\377\236\b^\377\236\b^\377"
+  93      5FFF9F09 
+  93      5FFF9F08 
+  93      5FFF9E08 
+  93      5EFF9E08 
+  94 047c 9E085EFF 		.ascii	"\236\b^\377\236\b^\377\235\b^\377\235\b]\377\235\b]\377\235\007"
+  94      9E085EFF 
+  94      9D085EFF 
+  94      9D085DFF 
+  94      9D085DFF 
+  95 0492 5DFF9D07 		.ascii	"]\377\235\007]\377\234\007]\377\234\007]\377\234\007]\377\234"
+  95      5DFF9C07 
+  95      5DFF9C07 
+  95      5DFF9C07 
+  95      5DFF9C
+  96 04a5 075CFF9C 		.ascii	"\007\\\377\234\007\\\377\233\007\\\377\233\007\\\377\233\007"
+  96      075CFF9B 
+  96      075CFF9B 
+  96      075CFF9B 
+  96      07
+  97 04b6 5CFF9B06 		.ascii	"\\\377\233\006\\\377\233\006[\377\232\006[\377\232\006[\377\232"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 7
+
+
+  97      5CFF9B06 
+  97      5BFF9A06 
+  97      5BFF9A06 
+  97      5BFF9A
+  98 04c9 065BFF9A 		.ascii	"\006[\377\232\006[\377\232\006[\377\232\006[\377\231\006[\377"
+  98      065BFF9A 
+  98      065BFF9A 
+  98      065BFF99 
+  98      065BFF
+  99 04dc 99065AFF 		.ascii	"\231\006Z\377\231\006Z\377\231\005Z\377\231\005Z\377\231\005"
+  99      99065AFF 
+  99      99055AFF 
+  99      99055AFF 
+  99      9905
+ 100 04ee 5AFF9805 		.ascii	"Z\377\230\005Z\377\230\005Z\377\230\005Z\377\230\005Y\377\230"
+ 100      5AFF9805 
+ 100      5AFF9805 
+ 100      5AFF9805 
+ 100      59FF98
+ 101 0501 0559FF98 		.ascii	"\005Y\377\230\005Y\377\230\005Y\377\227\005Y\377\227\005Y\377"
+ 101      0559FF98 
+ 101      0559FF97 
+ 101      0559FF97 
+ 101      0559FF
+ 102 0514 970559FF 		.ascii	"\227\005Y\377\227\005Y\377\227\004Y\377\227\004X\377\227\004"
+ 102      970559FF 
+ 102      970459FF 
+ 102      970458FF 
+ 102      9704
+ 103 0526 58FF9604 		.ascii	"X\377\226\004X\377\226\004X\377\226\004X\377\226\004X\377\226"
+ 103      58FF9604 
+ 103      58FF9604 
+ 103      58FF9604 
+ 103      58FF96
+ 104 0539 0458FF96 		.ascii	"\004X\377\226\004X\377\226\004X\377\226\004X\377\225\004X\377"
+ 104      0458FF96 
+ 104      0458FF96 
+ 104      0458FF95 
+ 104      0458FF
+ 105 054c 950457FF 		.ascii	"\225\004W\377\225\004W\377\225\004W\377\225\004W\377\225\004"
+ 105      950457FF 
+ 105      950457FF 
+ 105      950457FF 
+ 105      9504
+ 106 055e 57FF9503 		.ascii	"W\377\225\003W\377\225\003W\377\225\003W\377\225\003W\377\224"
+ 106      57FF9503 
+ 106      57FF9503 
+ 106      57FF9503 
+ 106      57FF94
+ 107 0571 0357FF94 		.ascii	"\003W\377\224\003W\377\224\003W\377\224\003V\377\224\003V\377"
+ 107      0357FF94 
+ 107      0357FF94 
+ 107      0356FF94 
+ 107      0356FF
+ 108 0584 940356FF 		.ascii	"\224\003V\377\224\003V\377\224\003V\377\224\003V\377\224\003"
+ 108      940356FF 
+ 108      940356FF 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 8
+
+
+ 108      940356FF 
+ 108      9403
+ 109 0596 56FF9303 		.ascii	"V\377\223\003V\377\223\003V\377\223\003V\377\223\003V\377\223"
+ 109      56FF9303 
+ 109      56FF9303 
+ 109      56FF9303 
+ 109      56FF93
+ 110 05a9 0356FF93 		.ascii	"\003V\377\223\003V\377\223\003V\377\223\003V\377\223\003U\377"
+ 110      0356FF93 
+ 110      0356FF93 
+ 110      0356FF93 
+ 110      0355FF
+ 111 05bc 930355FF 		.ascii	"\223\003U\377\223\003U\377\223\002U\377\222\002U\377\222\002"
+ 111      930355FF 
+ 111      930255FF 
+ 111      920255FF 
+ 111      9202
+ 112 05ce 55FF9202 		.ascii	"U\377\222\002U\377\222\002U\377\222\002U\377\222\002U\377\222"
+ 112      55FF9202 
+ 112      55FF9202 
+ 112      55FF9202 
+ 112      55FF92
+ 113 05e1 0255FF92 		.ascii	"\002U\377\222\002U\377\222\002U\377\222\002U\377\222\002U\377"
+ 113      0255FF92 
+ 113      0255FF92 
+ 113      0255FF92 
+ 113      0255FF
+ 114 05f4 920255FF 		.ascii	"\222\002U\377\222\002U\377\222\002U\377\221\002T\377\221\002"
+ 114      920255FF 
+ 114      920255FF 
+ 114      910254FF 
+ 114      9102
+ 115 0606 54FF9102 		.ascii	"T\377\221\002T\377\221\002T\377\221\002T\377\221\002T\377\221"
+ 115      54FF9102 
+ 115      54FF9102 
+ 115      54FF9102 
+ 115      54FF91
+ 116 0619 0254FF91 		.ascii	"\002T\377\221\002T\377\221\002T\377\221\002T\377\221\002T\377"
+ 116      0254FF91 
+ 116      0254FF91 
+ 116      0254FF91 
+ 116      0254FF
+ 117 062c 910254FF 		.ascii	"\221\002T\377\221\002T\377\221\002T\377\221\002T\377\221\002"
+ 117      910254FF 
+ 117      910254FF 
+ 117      910254FF 
+ 117      9102
+ 118 063e 54FF9102 		.ascii	"T\377\221\002T\377\221\002T\377\220\002T\377\220\002T\377\220"
+ 118      54FF9102 
+ 118      54FF9002 
+ 118      54FF9002 
+ 118      54FF90
+ 119 0651 0254FF90 		.ascii	"\002T\377\220\002T\377\220\002T\377\220\002T\377\220\002T\377"
+ 119      0254FF90 
+ 119      0254FF90 
+ 119      0254FF90 
+ 119      0254FF
+GAS LISTING /tmp/ccw8Qa8b.s 			page 9
+
+
+ 120 0664 900254FF 		.ascii	"\220\002T\377\220\002S\377\220\001S\377\220\001S\377\220\001"
+ 120      900253FF 
+ 120      900153FF 
+ 120      900153FF 
+ 120      9001
+ 121 0676 53FF9001 		.ascii	"S\377\220\001S\377\220\001S\377\220\001S\377\220\001S\377\220"
+ 121      53FF9001 
+ 121      53FF9001 
+ 121      53FF9001 
+ 121      53FF90
+ 122 0689 0153FF90 		.ascii	"\001S\377\220\001S\377\220\001S\377\220\001S\377\220\001S\377"
+ 122      0153FF90 
+ 122      0153FF90 
+ 122      0153FF90 
+ 122      0153FF
+ 123 069c 900153FF 		.ascii	"\220\001S\377\220\001S\377\220\001S\377\220\001S\377\217\001"
+ 123      900153FF 
+ 123      900153FF 
+ 123      900153FF 
+ 123      8F01
+ 124 06ae 53FF8F01 		.ascii	"S\377\217\001S\377\217\001S\377\217\001S\377\217\001S\377\217"
+ 124      53FF8F01 
+ 124      53FF8F01 
+ 124      53FF8F01 
+ 124      53FF8F
+ 125 06c1 0153FF8F 		.ascii	"\001S\377\217\001S\377\217\001S\377\217\001S\377\217\001S\377"
+ 125      0153FF8F 
+ 125      0153FF8F 
+ 125      0153FF8F 
+ 125      0153FF
+ 126 06d4 8F0153FF 		.ascii	"\217\001S\377\217\001S\377\217\001S\377\217\001S\377\217\001"
+ 126      8F0153FF 
+ 126      8F0153FF 
+ 126      8F0153FF 
+ 126      8F01
+ 127 06e6 53FF8F01 		.ascii	"S\377\217\001S\377\217\001S\377\217\001S\377\217\001S\377\217"
+ 127      53FF8F01 
+ 127      53FF8F01 
+ 127      53FF8F01 
+ 127      53FF8F
+ 128 06f9 0153FF8F 		.ascii	"\001S\377\217\001S\377\217\001S\377\217\001S\377\217\001S\377"
+ 128      0153FF8F 
+ 128      0153FF8F 
+ 128      0153FF8F 
+ 128      0153FF
+ 129 070c 8F0152FF 		.ascii	"\217\001R\377\217\001R\377\217\001R\377\217\001R\377\217\001"
+ 129      8F0152FF 
+ 129      8F0152FF 
+ 129      8F0152FF 
+ 129      8F01
+ 130 071e 52FF8F01 		.ascii	"R\377\217\001R\377\217\001R\377\217\001R\377\217\001R\377\217"
+ 130      52FF8F01 
+ 130      52FF8F01 
+ 130      52FF8F01 
+ 130      52FF8F
+ 131 0731 0152FF8F 		.ascii	"\001R\377\217\001R\377\217\001R\377\217\001R\377\217\001R\377"
+ 131      0152FF8F 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 10
+
+
+ 131      0152FF8F 
+ 131      0152FF8F 
+ 131      0152FF
+ 132 0744 8F0152FF 		.ascii	"\217\001R\377\217\001R\377\216\001R\377\216\001R\377\216\001"
+ 132      8F0152FF 
+ 132      8E0152FF 
+ 132      8E0152FF 
+ 132      8E01
+ 133 0756 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 133      52FF8E01 
+ 133      52FF8E01 
+ 133      52FF8E01 
+ 133      52FF8E
+ 134 0769 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 134      0152FF8E 
+ 134      0152FF8E 
+ 134      0152FF8E 
+ 134      0152FF
+ 135 077c 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 135      8E0152FF 
+ 135      8E0152FF 
+ 135      8E0152FF 
+ 135      8E01
+ 136 078e 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 136      52FF8E01 
+ 136      52FF8E01 
+ 136      52FF8E01 
+ 136      52FF8E
+ 137 07a1 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 137      0152FF8E 
+ 137      0152FF8E 
+ 137      0152FF8E 
+ 137      0152FF
+ 138 07b4 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 138      8E0152FF 
+ 138      8E0152FF 
+ 138      8E0152FF 
+ 138      8E01
+ 139 07c6 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377"
+ 139      52FF8E01 
+ 139      52FF
+ 140 07d0 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 140      8E0152FF 
+ 140      8E0152FF 
+ 140      8E0152FF 
+ 140      8E01
+ 141 07e2 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 141      52FF8E01 
+ 141      52FF8E01 
+ 141      52FF8E01 
+ 141      52FF8E
+ 142 07f5 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 142      0152FF8E 
+ 142      0152FF8E 
+ 142      0152FF8E 
+ 142      0152FF
+ 143 0808 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 11
+
+
+ 143      8E0152FF 
+ 143      8E0152FF 
+ 143      8E0152FF 
+ 143      8E01
+ 144 081a 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 144      52FF8E01 
+ 144      52FF8E01 
+ 144      52FF8E01 
+ 144      52FF8E
+ 145 082d 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 145      0152FF8E 
+ 145      0152FF8E 
+ 145      0152FF8E 
+ 145      0152FF
+ 146 0840 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 146      8E0152FF 
+ 146      8E0152FF 
+ 146      8E0152FF 
+ 146      8E01
+ 147 0852 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 147      52FF8E01 
+ 147      52FF8E01 
+ 147      52FF8E01 
+ 147      52FF8E
+ 148 0865 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 148      0152FF8E 
+ 148      0152FF8E 
+ 148      0152FF8E 
+ 148      0152FF
+ 149 0878 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 149      8E0152FF 
+ 149      8E0152FF 
+ 149      8E0152FF 
+ 149      8E01
+ 150 088a 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 150      52FF8E01 
+ 150      52FF8E01 
+ 150      52FF8E01 
+ 150      52FF8E
+ 151 089d 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 151      0152FF8E 
+ 151      0152FF8E 
+ 151      0152FF8E 
+ 151      0152FF
+ 152 08b0 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 152      8E0152FF 
+ 152      8E0152FF 
+ 152      8E0152FF 
+ 152      8E01
+ 153 08c2 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 153      52FF8E01 
+ 153      52FF8E01 
+ 153      52FF8E01 
+ 153      52FF8E
+ 154 08d5 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 154      0152FF8E 
+ 154      0152FF8E 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 12
+
+
+ 154      0152FF8E 
+ 154      0152FF
+ 155 08e8 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 155      8E0152FF 
+ 155      8E0152FF 
+ 155      8E0152FF 
+ 155      8E01
+ 156 08fa 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 156      52FF8E01 
+ 156      52FF8E01 
+ 156      52FF8E01 
+ 156      52FF8E
+ 157 090d 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 157      0152FF8E 
+ 157      0152FF8E 
+ 157      0152FF8E 
+ 157      0152FF
+ 158 0920 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 158      8E0152FF 
+ 158      8E0152FF 
+ 158      8E0152FF 
+ 158      8E01
+ 159 0932 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 159      52FF8E01 
+ 159      52FF8E01 
+ 159      52FF8E01 
+ 159      52FF8E
+ 160 0945 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 160      0152FF8E 
+ 160      0152FF8E 
+ 160      0152FF8E 
+ 160      0152FF
+ 161 0958 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 161      8E0152FF 
+ 161      8E0152FF 
+ 161      8E0152FF 
+ 161      8E01
+ 162 096a 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 162      52FF8E01 
+ 162      52FF8E01 
+ 162      52FF8E01 
+ 162      52FF8E
+ 163 097d 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 163      0152FF8E 
+ 163      0152FF8E 
+ 163      0152FF8E 
+ 163      0152FF
+ 164 0990 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 164      8E0152FF 
+ 164      8E0152FF 
+ 164      8E0152FF 
+ 164      8E01
+ 165 09a2 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 165      52FF8E01 
+ 165      52FF8E01 
+ 165      52FF8E01 
+ 165      52FF8E
+GAS LISTING /tmp/ccw8Qa8b.s 			page 13
+
+
+ 166 09b5 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 166      0152FF8E 
+ 166      0152FF8E 
+ 166      0152FF8E 
+ 166      0152FF
+ 167 09c8 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 167      8E0152FF 
+ 167      8E0152FF 
+ 167      8E0152FF 
+ 167      8E01
+ 168 09da 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 168      52FF8E01 
+ 168      52FF8E01 
+ 168      52FF8E01 
+ 168      52FF8E
+ 169 09ed 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 169      0152FF8E 
+ 169      0152FF8E 
+ 169      0152FF8E 
+ 169      0152FF
+ 170 0a00 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 170      8E0152FF 
+ 170      8E0152FF 
+ 170      8E0152FF 
+ 170      8E01
+ 171 0a12 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 171      52FF8E01 
+ 171      52FF8E01 
+ 171      52FF8E01 
+ 171      52FF8E
+ 172 0a25 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 172      0152FF8E 
+ 172      0152FF8E 
+ 172      0152FF8E 
+ 172      0152FF
+ 173 0a38 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 173      8E0152FF 
+ 173      8E0152FF 
+ 173      8E0152FF 
+ 173      8E01
+ 174 0a4a 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 174      52FF8E01 
+ 174      52FF8E01 
+ 174      52FF8E01 
+ 174      52FF8E
+ 175 0a5d 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 175      0152FF8E 
+ 175      0152FF8E 
+ 175      0152FF8E 
+ 175      0152FF
+ 176 0a70 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 176      8E0152FF 
+ 176      8E0152FF 
+ 176      8E0152FF 
+ 176      8E01
+ 177 0a82 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 177      52FF8E01 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 14
+
+
+ 177      52FF8E01 
+ 177      52FF8E01 
+ 177      52FF8E
+ 178 0a95 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 178      0152FF8E 
+ 178      0152FF8E 
+ 178      0152FF8E 
+ 178      0152FF
+ 179 0aa8 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 179      8E0152FF 
+ 179      8E0152FF 
+ 179      8E0152FF 
+ 179      8E01
+ 180 0aba 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 180      52FF8E01 
+ 180      52FF8E01 
+ 180      52FF8E01 
+ 180      52FF8E
+ 181 0acd 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 181      0152FF8E 
+ 181      0152FF8E 
+ 181      0152FF8E 
+ 181      0152FF
+ 182 0ae0 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 182      8E0152FF 
+ 182      8E0152FF 
+ 182      8E0152FF 
+ 182      8E01
+ 183 0af2 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 183      52FF8E01 
+ 183      52FF8E01 
+ 183      52FF8E01 
+ 183      52FF8E
+ 184 0b05 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 184      0152FF8E 
+ 184      0152FF8E 
+ 184      0152FF8E 
+ 184      0152FF
+ 185 0b18 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 185      8E0152FF 
+ 185      8E0152FF 
+ 185      8E0152FF 
+ 185      8E01
+ 186 0b2a 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 186      52FF8E01 
+ 186      52FF8E01 
+ 186      52FF8E01 
+ 186      52FF8E
+ 187 0b3d 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 187      0152FF8E 
+ 187      0152FF8E 
+ 187      0152FF8E 
+ 187      0152FF
+ 188 0b50 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 188      8E0152FF 
+ 188      8E0152FF 
+ 188      8E0152FF 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 15
+
+
+ 188      8E01
+ 189 0b62 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 189      52FF8E01 
+ 189      52FF8E01 
+ 189      52FF8E01 
+ 189      52FF8E
+ 190 0b75 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 190      0152FF8E 
+ 190      0152FF8E 
+ 190      0152FF8E 
+ 190      0152FF
+ 191 0b88 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 191      8E0152FF 
+ 191      8E0152FF 
+ 191      8E0152FF 
+ 191      8E01
+ 192 0b9a 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 192      52FF8E01 
+ 192      52FF8E01 
+ 192      52FF8E01 
+ 192      52FF8E
+ 193 0bad 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 193      0152FF8E 
+ 193      0152FF8E 
+ 193      0152FF8E 
+ 193      0152FF
+ 194 0bc0 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 194      8E0152FF 
+ 194      8E0152FF 
+ 194      8E0152FF 
+ 194      8E01
+ 195 0bd2 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 195      52FF8E01 
+ 195      52FF8E01 
+ 195      52FF8E01 
+ 195      52FF8E
+ 196 0be5 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 196      0152FF8E 
+ 196      0152FF8E 
+ 196      0152FF8E 
+ 196      0152FF
+ 197 0bf8 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 197      8E0152FF 
+ 197      8E0152FF 
+ 197      8E0152FF 
+ 197      8E01
+ 198 0c0a 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 198      52FF8E01 
+ 198      52FF8E01 
+ 198      52FF8E01 
+ 198      52FF8E
+ 199 0c1d 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 199      0152FF8E 
+ 199      0152FF8E 
+ 199      0152FF8E 
+ 199      0152FF
+ 200 0c30 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 16
+
+
+ 200      8E0152FF 
+ 200      8E0152FF 
+ 200      8E0152FF 
+ 200      8E01
+ 201 0c42 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 201      52FF8E01 
+ 201      52FF8E01 
+ 201      52FF8E01 
+ 201      52FF8E
+ 202 0c55 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 202      0152FF8E 
+ 202      0152FF8E 
+ 202      0152FF8E 
+ 202      0152FF
+ 203 0c68 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 203      8E0152FF 
+ 203      8E0152FF 
+ 203      8E0152FF 
+ 203      8E01
+ 204 0c7a 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 204      52FF8E01 
+ 204      52FF8E01 
+ 204      52FF8E01 
+ 204      52FF8E
+ 205 0c8d 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 205      0152FF8E 
+ 205      0152FF8E 
+ 205      0152FF8E 
+ 205      0152FF
+ 206 0ca0 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 206      8E0152FF 
+ 206      8E0152FF 
+ 206      8E0152FF 
+ 206      8E01
+ 207 0cb2 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 207      52FF8E01 
+ 207      52FF8E01 
+ 207      52FF8E01 
+ 207      52FF8E
+ 208 0cc5 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 208      0152FF8E 
+ 208      0152FF8E 
+ 208      0152FF8E 
+ 208      0152FF
+ 209 0cd8 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 209      8E0152FF 
+ 209      8E0152FF 
+ 209      8E0152FF 
+ 209      8E01
+ 210 0cea 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 210      52FF8E01 
+ 210      52FF8E01 
+ 210      52FF8E01 
+ 210      52FF8E
+ 211 0cfd 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 211      0152FF8E 
+ 211      0152FF8E 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 17
+
+
+ 211      0152FF8E 
+ 211      0152FF
+ 212 0d10 8E0152FF 		.ascii	"\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001"
+ 212      8E0152FF 
+ 212      8E0152FF 
+ 212      8E0152FF 
+ 212      8E01
+ 213 0d22 52FF8E01 		.ascii	"R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377\216"
+ 213      52FF8E01 
+ 213      52FF8E01 
+ 213      52FF8E01 
+ 213      52FF8E
+ 214 0d35 0152FF8E 		.ascii	"\001R\377\216\001R\377\216\001R\377\216\001R\377\216\001R\377"
+ 214      0152FF8E 
+ 214      0152FF8E 
+ 214      0152FF8E 
+ 214      0152FF
+ 215 0d48 8E0152FF 		.ascii	"\216\001R\377\215\001R\377\215\001R\377\215\001R\377\215\001"
+ 215      8D0152FF 
+ 215      8D0152FF 
+ 215      8D0152FF 
+ 215      8D01
+ 216 0d5a 52FF8D01 		.ascii	"R\377\215\001R\377\215\001R\377\215\001R\377\215\001R\377\215"
+ 216      52FF8D01 
+ 216      52FF8D01 
+ 216      52FF8D01 
+ 216      52FF8D
+ 217 0d6d 0152FF8D 		.ascii	"\001R\377\215\001R\377\215\001R\377\215\001R\377\215\001R\377"
+ 217      0152FF8D 
+ 217      0152FF8D 
+ 217      0152FF8D 
+ 217      0152FF
+ 218 0d80 8D0152FF 		.ascii	"\215\001R\377\215\001R\377\215\001R\377\215\001R\377\215\001"
+ 218      8D0152FF 
+ 218      8D0152FF 
+ 218      8D0152FF 
+ 218      8D01
+ 219 0d92 52FF8D01 		.ascii	"R\377\215\001R\377\215\001R\377\215\001R\377\215\001R\377\215"
+ 219      52FF8D01 
+ 219      52FF8D01 
+ 219      52FF8D01 
+ 219      52FF8D
+ 220 0da5 0152FF8D 		.ascii	"\001R\377\215\001R\377\215\001R\377\215\001R\377\215\001R\377"
+ 220      0152FF8D 
+ 220      0152FF8D 
+ 220      0152FF8D 
+ 220      0152FF
+ 221 0db8 8D0152FF 		.ascii	"\215\001R\377\215\001R\377\215\001R\377\215\001R\377\215\001"
+ 221      8D0152FF 
+ 221      8D0152FF 
+ 221      8D0152FF 
+ 221      8D01
+ 222 0dca 52FF8D01 		.ascii	"R\377\215\001R\377\215\001Q\377\215\001Q\377\215\001Q\377\215"
+ 222      52FF8D01 
+ 222      51FF8D01 
+ 222      51FF8D01 
+ 222      51FF8D
+GAS LISTING /tmp/ccw8Qa8b.s 			page 18
+
+
+ 223 0ddd 0151FF8D 		.ascii	"\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377"
+ 223      0151FF8D 
+ 223      0151FF8D 
+ 223      0151FF8D 
+ 223      0151FF
+ 224 0df0 8D0151FF 		.ascii	"\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001"
+ 224      8D0151FF 
+ 224      8D0151FF 
+ 224      8D0151FF 
+ 224      8D01
+ 225 0e02 51FF8D01 		.ascii	"Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215"
+ 225      51FF8D01 
+ 225      51FF8D01 
+ 225      51FF8D01 
+ 225      51FF8D
+ 226 0e15 0151FF8D 		.ascii	"\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377"
+ 226      0151FF8D 
+ 226      0151FF8D 
+ 226      0151FF8D 
+ 226      0151FF
+ 227 0e28 8D0151FF 		.ascii	"\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001"
+ 227      8D0151FF 
+ 227      8D0151FF 
+ 227      8D0151FF 
+ 227      8D01
+ 228 0e3a 51FF8D01 		.ascii	"Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215"
+ 228      51FF8D01 
+ 228      51FF8D01 
+ 228      51FF8D01 
+ 228      51FF8D
+ 229 0e4d 0151FF8D 		.ascii	"\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377"
+ 229      0151FF8D 
+ 229      0151FF8D 
+ 229      0151FF8D 
+ 229      0151FF
+ 230 0e60 8D0151FF 		.ascii	"\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001"
+ 230      8D0151FF 
+ 230      8D0151FF 
+ 230      8D0151FF 
+ 230      8D01
+ 231 0e72 51FF8D01 		.ascii	"Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215"
+ 231      51FF8D01 
+ 231      51FF8D01 
+ 231      51FF8D01 
+ 231      51FF8D
+ 232 0e85 0151FF8D 		.ascii	"\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377"
+ 232      0151FF8D 
+ 232      0151FF8D 
+ 232      0151FF8D 
+ 232      0151FF
+ 233 0e98 8D0151FF 		.ascii	"\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001"
+ 233      8D0151FF 
+ 233      8D0151FF 
+ 233      8D0151FF 
+ 233      8D01
+ 234 0eaa 51FF8D01 		.ascii	"Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215"
+ 234      51FF8D01 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 19
+
+
+ 234      51FF8D01 
+ 234      51FF8D01 
+ 234      51FF8D
+ 235 0ebd 0151FF8D 		.ascii	"\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377"
+ 235      0151FF8D 
+ 235      0151FF8D 
+ 235      0151FF8D 
+ 235      0151FF
+ 236 0ed0 8D0151FF 		.ascii	"\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001"
+ 236      8D0151FF 
+ 236      8D0151FF 
+ 236      8D0151FF 
+ 236      8D01
+ 237 0ee2 51FF8D01 		.ascii	"Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215"
+ 237      51FF8D01 
+ 237      51FF8D01 
+ 237      51FF8D01 
+ 237      51FF8D
+ 238 0ef5 0151FF8D 		.ascii	"\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377"
+ 238      0151FF8D 
+ 238      0151FF8D 
+ 238      0151FF8D 
+ 238      0151FF
+ 239 0f08 8D0151FF 		.ascii	"\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001"
+ 239      8D0151FF 
+ 239      8D0151FF 
+ 239      8D0151FF 
+ 239      8D01
+ 240 0f1a 51FF8D01 		.ascii	"Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215"
+ 240      51FF8D01 
+ 240      51FF8D01 
+ 240      51FF8D01 
+ 240      51FF8D
+ 241 0f2d 0151FF8D 		.ascii	"\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377"
+ 241      0151FF8D 
+ 241      0151FF8D 
+ 241      0151FF8D 
+ 241      0151FF
+ 242 0f40 8D0151FF 		.ascii	"\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001"
+ 242      8D0151FF 
+ 242      8D0151FF 
+ 242      8D0151FF 
+ 242      8D01
+ 243 0f52 51FF8D01 		.ascii	"Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215"
+ 243      51FF8D01 
+ 243      51FF8D01 
+ 243      51FF8D01 
+ 243      51FF8D
+ 244 0f65 0151FF8D 		.ascii	"\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377"
+ 244      0151FF8D 
+ 244      0151FF8D 
+ 244      0151FF8D 
+ 244      0151FF
+ 245 0f78 8D0151FF 		.ascii	"\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001"
+ 245      8D0151FF 
+ 245      8D0151FF 
+ 245      8D0151FF 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 20
+
+
+ 245      8D01
+ 246 0f8a 51FF8D01 		.ascii	"Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215"
+ 246      51FF8D01 
+ 246      51FF8D01 
+ 246      51FF8D01 
+ 246      51FF8D
+ 247 0f9d 0151FF   		.ascii	"\001Q\377"
+ 248 0fa0 8D0151FF 		.ascii	"\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001"
+ 248      8D0151FF 
+ 248      8D0151FF 
+ 248      8D0151FF 
+ 248      8D01
+ 249 0fb2 51FF8D01 		.ascii	"Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215"
+ 249      51FF8D01 
+ 249      51FF8D01 
+ 249      51FF8D01 
+ 249      51FF8D
+ 250 0fc5 0151FF8D 		.ascii	"\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377"
+ 250      0151FF8D 
+ 250      0151FF8D 
+ 250      0151FF8D 
+ 250      0151FF
+ 251 0fd8 8D0151FF 		.ascii	"\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001"
+ 251      8D0151FF 
+ 251      8D0151FF 
+ 251      8D0151FF 
+ 251      8D01
+ 252 0fea 51FF8D01 		.ascii	"Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215\001Q\377\215"
+ 252      51FF8D01 
+ 252      51FF8D01 
+ 252      51FF8D01 
+ 252      51FF8D
+ 253 0ffd 0151FF8D 		.ascii	"\001Q\377\215\001Q\377"
+ 253      0151FF
+ 254              		.globl	heatmap_cs_PiYG_mixed
+ 255              		.section	.data.rel.local
+ 256              		.align 8
+ 257              		.type	heatmap_cs_PiYG_mixed, @object
+ 258              		.size	heatmap_cs_PiYG_mixed, 8
+ 259              	heatmap_cs_PiYG_mixed:
+ 260 0008 00000000 		.quad	mixed
+ 260      00000000 
+ 261              		.section	.data.rel.ro.local
+ 262              		.align 16
+ 263              		.type	mixed, @object
+ 264              		.size	mixed, 16
+ 265              	mixed:
+ 266 0010 00000000 		.quad	mixed_data
+ 266      00000000 
+ 267 0018 01040000 		.quad	1025
+ 267      00000000 
+ 268              		.section	.rodata
+ 269 1004 00000000 		.align 32
+ 269      00000000 
+ 269      00000000 
+ 269      00000000 
+ 269      00000000 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 21
+
+
+ 270              		.type	mixed_data, @object
+ 271              		.size	mixed_data, 4100
+ 272              	mixed_data:
+ 273 1020 00       		.string	""
+ 274 1021 00       		.string	""
+ 275 1022 00       		.string	""
+ 276 1023 00       		.string	""
+ 277 1024 27641800 		.string	"'d\030"
+ 278 1028 27641907 		.ascii	"'d\031\007'd\031\016'e\031\026(e\031\035(e\031%(f\031,(f\031"
+ 278      2764190E 
+ 278      27651916 
+ 278      2865191D 
+ 278      28651925 
+ 279 1043 34296619 		.ascii	"4)f\031;)g\031C)g\031J)g\031R*h\031Y*h\032a*h\032h+i\032p+i\032"
+ 279      3B296719 
+ 279      43296719 
+ 279      4A296719 
+ 279      522A6819 
+ 280 1067 772B691A 		.ascii	"w+i\032\177+j\032\206,j\032\215,k\032\225,k\032\234-k\032\244"
+ 280      7F2B6A1A 
+ 280      862C6A1A 
+ 280      8D2C6B1A 
+ 280      952C6B1A 
+ 281 1080 2D6C1AAB 		.ascii	"-l\032\253-l\032\263-l\032\272.m\032\302.m\033\311.m\033\321"
+ 281      2D6C1AB3 
+ 281      2D6C1ABA 
+ 281      2E6D1AC2 
+ 281      2E6D1BC9 
+ 282 1098 2E6E1BD8 		.ascii	".n\033\330/n\033\340/n\033\347/o\033\3570o\033\3660p\033\376"
+ 282      2F6E1BE0 
+ 282      2F6E1BE7 
+ 282      2F6F1BEF 
+ 282      306F1BF6 
+ 283 10b0 30701BFF 		.ascii	"0p\033\3770p\033\3771q\033\3771q\033\3771q\033\3772r\033\377"
+ 283      30701BFF 
+ 283      31711BFF 
+ 283      31711BFF 
+ 283      31711BFF 
+ 284 10c8 32721BFF 		.ascii	"2r\033\3772r\034\3773s\034\3773s\034\3773s\034\3773t\034\377"
+ 284      32721CFF 
+ 284      33731CFF 
+ 284      33731CFF 
+ 284      33731CFF 
+ 285 10e0 34741CFF 		.ascii	"4t\034\3774u\034\3774u\034\3775u\034\3775v\034\377=\177\036\377"
+ 285      34751CFF 
+ 285      34751CFF 
+ 285      35751CFF 
+ 285      35761CFF 
+ 286 10f8 3D801EFF 		.ascii	"=\200\036\377=\200\036\377>\200\036\377>\201\036\377>\201\036"
+ 286      3D801EFF 
+ 286      3E801EFF 
+ 286      3E811EFF 
+ 286      3E811E
+ 287 110b FF3F811E 		.ascii	"\377?\201\036\377?\202\036\377?\202\036\377?\202\036\377@\203"
+ 287      FF3F821E 
+ 287      FF3F821E 
+ 287      FF3F821E 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 22
+
+
+ 287      FF4083
+ 288 111e 1EFF4083 		.ascii	"\036\377@\203\036\377@\203\037\377A\204\037\377A\204\037\377"
+ 288      1EFF4083 
+ 288      1FFF4184 
+ 288      1FFF4184 
+ 288      1FFF
+ 289 1130 41851FFF 		.ascii	"A\205\037\377B\205\037\377B\205\037\377B\206\037\377C\206\037"
+ 289      42851FFF 
+ 289      42851FFF 
+ 289      42861FFF 
+ 289      43861F
+ 290 1143 FF43861F 		.ascii	"\377C\206\037\377C\207\037\377C\207\037\377D\207\037\377D\210"
+ 290      FF43871F 
+ 290      FF43871F 
+ 290      FF44871F 
+ 290      FF4488
+ 291 1156 1FFF4488 		.ascii	"\037\377D\210\037\377E\211\037\377E\211\037\377E\211\037\377"
+ 291      1FFF4589 
+ 291      1FFF4589 
+ 291      1FFF4589 
+ 291      1FFF
+ 292 1168 468A1FFF 		.ascii	"F\212\037\377F\212 \377F\212 \377G\213 \377G\213 \377G\213 \377"
+ 292      468A20FF 
+ 292      468A20FF 
+ 292      478B20FF 
+ 292      478B20FF 
+ 293 1180 488C20FF 		.ascii	"H\214 \377H\214 \377H\215 \377H\215 \377I\215 \377I\216 \377"
+ 293      488C20FF 
+ 293      488D20FF 
+ 293      488D20FF 
+ 293      498D20FF 
+ 294 1198 498E20FF 		.ascii	"I\216 \377J\216 \377J\217 \377J\217 \377K\220 \377K\220 \377"
+ 294      4A8E20FF 
+ 294      4A8F20FF 
+ 294      4A8F20FF 
+ 294      4B9020FF 
+ 295 11b0 4B9020FF 		.ascii	"K\220 \377L\221 \377L\221 \377L\221 \377M\222!\377M\222!\377"
+ 295      4C9120FF 
+ 295      4C9120FF 
+ 295      4C9120FF 
+ 295      4D9221FF 
+ 296 11c8 4E9221FF 		.ascii	"N\222!\377N\223!\377N\223\"\377O\223\"\377O\224\"\377O\224\""
+ 296      4E9321FF 
+ 296      4E9322FF 
+ 296      4F9322FF 
+ 296      4F9422FF 
+ 297 11df FF509423 		.ascii	"\377P\224#\377P\225#\377Q\225#\377Q\225#\377Q\226$\377R\226$"
+ 297      FF509523 
+ 297      FF519523 
+ 297      FF519523 
+ 297      FF519624 
+ 298 11f7 FF529624 		.ascii	"\377R\226$\377S\227$\377S\227%\377S\227%\377T\230%\377T\230&"
+ 298      FF539724 
+ 298      FF539725 
+ 298      FF539725 
+ 298      FF549825 
+ 299 120f FF559826 		.ascii	"\377U\230&\377U\230&\377U\231&\377V\231'\377V\231'\377V\232'"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 23
+
+
+ 299      FF559826 
+ 299      FF559926 
+ 299      FF569927 
+ 299      FF569927 
+ 300 1227 FF579A27 		.ascii	"\377W\232'\377W\232(\377X\233(\377X\233(\377X\233(\377Y\234)"
+ 300      FF579A28 
+ 300      FF589B28 
+ 300      FF589B28 
+ 300      FF589B28 
+ 301 123f FF599C29 		.ascii	"\377Y\234)\377Z\234)\377Z\235)\377Z\235*\377[\235*\377[\236*"
+ 301      FF5A9C29 
+ 301      FF5A9D29 
+ 301      FF5A9D2A 
+ 301      FF5B9D2A 
+ 302 1257 FF5C9E2A 		.ascii	"\377\\\236*\377\\\236+\377\\\237+\377]\237+\377]\237+\377]\240"
+ 302      FF5C9E2B 
+ 302      FF5C9F2B 
+ 302      FF5D9F2B 
+ 302      FF5D9F2B 
+ 303 126e 2CFF5EA0 		.ascii	",\377^\240,\377^\240,\377_\241,\377_\241-\377_\241-\377`\242"
+ 303      2CFF5EA0 
+ 303      2CFF5FA1 
+ 303      2CFF5FA1 
+ 303      2DFF5FA1 
+ 304 1286 2DFF60A2 		.ascii	"-\377`\242-\377k\2534\377k\2534\377k\2534\377l\2545\377l\254"
+ 304      2DFF6BAB 
+ 304      34FF6BAB 
+ 304      34FF6BAB 
+ 304      34FF6CAC 
+ 305 129e 35FF6DAC 		.ascii	"5\377m\2545\377m\2555\377m\2556\377n\2556\377n\2566\377o\256"
+ 305      35FF6DAD 
+ 305      35FF6DAD 
+ 305      36FF6EAD 
+ 305      36FF6EAE 
+ 306 12b6 36FF6FAE 		.ascii	"6\377o\2567\377o\2577\377p\2577\377p\2577\377p\2608\377q\260"
+ 306      37FF6FAF 
+ 306      37FF70AF 
+ 306      37FF70AF 
+ 306      37FF70B0 
+ 307 12ce 38FF71B0 		.ascii	"8\377q\2608\377r\2618\377r\2619\377r\2619\377s\2629\377s\262"
+ 307      38FF72B1 
+ 307      38FF72B1 
+ 307      39FF72B1 
+ 307      39FF73B2 
+ 308 12e6 39FF74B2 		.ascii	"9\377t\262:\377t\263:\377t\263:\377u\263:\377u\264;\377v\264"
+ 308      3AFF74B3 
+ 308      3AFF74B3 
+ 308      3AFF75B3 
+ 308      3AFF75B4 
+ 309 12fe 3BFF76B4 		.ascii	";\377v\264;\377v\265;\377w\265<\377w\265<\377x\266<\377x\266"
+ 309      3BFF76B5 
+ 309      3BFF77B5 
+ 309      3CFF77B5 
+ 309      3CFF78B6 
+ 310 1316 3CFF78B6 		.ascii	"<\377x\266=\377y\267=\377y\267=\377y\267=\377z\270>\377z\270"
+ 310      3DFF79B7 
+ 310      3DFF79B7 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 24
+
+
+ 310      3DFF79B7 
+ 310      3DFF7AB8 
+ 311 132e 3EFF7BB8 		.ascii	">\377{\270>\377{\271>\377{\271?\377|\271?\377|\272?\377}\272"
+ 311      3EFF7BB9 
+ 311      3EFF7BB9 
+ 311      3FFF7CB9 
+ 311      3FFF7CBA 
+ 312 1346 3FFF7DBA 		.ascii	"?\377}\272@\377}\273@\377~\273@\377~\273@\377\177\274A\377\177"
+ 312      40FF7DBB 
+ 312      40FF7EBB 
+ 312      40FF7EBB 
+ 312      40FF7FBC 
+ 313 135d BC41FF80 		.ascii	"\274A\377\200\274B\377\200\274B\377\200\275C\377\201\275C\377"
+ 313      BC42FF80 
+ 313      BC42FF80 
+ 313      BD43FF81 
+ 313      BD43FF
+ 314 1370 81BD44FF 		.ascii	"\201\275D\377\202\276E\377\202\276E\377\203\276F\377\203\276"
+ 314      82BE45FF 
+ 314      82BE45FF 
+ 314      83BE46FF 
+ 314      83BE
+ 315 1382 46FF84BF 		.ascii	"F\377\204\277G\377\204\277G\377\205\277H\377\205\300I\377\205"
+ 315      47FF84BF 
+ 315      47FF85BF 
+ 315      48FF85C0 
+ 315      49FF85
+ 316 1395 C049FF86 		.ascii	"\300I\377\206\300J\377\206\300J\377\207\301K\377\207\301K\377"
+ 316      C04AFF86 
+ 316      C04AFF87 
+ 316      C14BFF87 
+ 316      C14BFF
+ 317 13a8 88C14CFF 		.ascii	"\210\301L\377\210\302L\377\211\302M\377\211\302M\377\212\302"
+ 317      88C24CFF 
+ 317      89C24DFF 
+ 317      89C24DFF 
+ 317      8AC2
+ 318 13ba 4EFF8AC3 		.ascii	"N\377\212\303O\377\212\303O\377\213\303P\377\213\304P\377\214"
+ 318      4FFF8AC3 
+ 318      4FFF8BC3 
+ 318      50FF8BC4 
+ 318      50FF8C
+ 319 13cd C451FF8C 		.ascii	"\304Q\377\214\304Q\377\215\304R\377\215\305R\377\216\305S\377"
+ 319      C451FF8D 
+ 319      C452FF8D 
+ 319      C552FF8E 
+ 319      C553FF
+ 320 13e0 8EC553FF 		.ascii	"\216\305S\377\217\306T\377\217\306U\377\217\306U\377\220\306"
+ 320      8FC654FF 
+ 320      8FC655FF 
+ 320      8FC655FF 
+ 320      90C6
+ 321 13f2 56FF90C7 		.ascii	"V\377\220\307V\377\221\307W\377\221\307W\377\222\310X\377\222"
+ 321      56FF91C7 
+ 321      57FF91C7 
+ 321      57FF92C8 
+ 321      58FF92
+GAS LISTING /tmp/ccw8Qa8b.s 			page 25
+
+
+ 322 1405 C858FF93 		.ascii	"\310X\377\223\310Y\377\223\310Y\377\223\311Z\377\224\311Z\377"
+ 322      C859FF93 
+ 322      C859FF93 
+ 322      C95AFF94 
+ 322      C95AFF
+ 323 1418 94C95BFF 		.ascii	"\224\311[\377\225\312\\\377\225\312\\\377\241\322j\377\242\322"
+ 323      95CA5CFF 
+ 323      95CA5CFF 
+ 323      A1D26AFF 
+ 323      A2D2
+ 324 142a 6BFFA2D2 		.ascii	"k\377\242\322k\377\242\322l\377\243\323l\377\243\323m\377\244"
+ 324      6BFFA2D2 
+ 324      6CFFA3D3 
+ 324      6CFFA3D3 
+ 324      6DFFA4
+ 325 143d D36EFFA4 		.ascii	"\323n\377\244\324n\377\245\324o\377\245\324o\377\246\325p\377"
+ 325      D46EFFA5 
+ 325      D46FFFA5 
+ 325      D46FFFA6 
+ 325      D570FF
+ 326 1450 A6D570FF 		.ascii	"\246\325p\377\246\325q\377\247\325q\377\247\326r\377\250\326"
+ 326      A6D571FF 
+ 326      A7D571FF 
+ 326      A7D672FF 
+ 326      A8D6
+ 327 1462 72FFA8D6 		.ascii	"r\377\250\326s\377\251\327s\377\251\327t\377\251\327t\377\252"
+ 327      73FFA9D7 
+ 327      73FFA9D7 
+ 327      74FFA9D7 
+ 327      74FFAA
+ 328 1475 D775FFAA 		.ascii	"\327u\377\252\330v\377\253\330v\377\253\330w\377\254\331w\377"
+ 328      D876FFAB 
+ 328      D876FFAB 
+ 328      D877FFAC 
+ 328      D977FF
+ 329 1488 ACD978FF 		.ascii	"\254\331x\377\255\331x\377\255\331y\377\255\332y\377\256\332"
+ 329      ADD978FF 
+ 329      ADD979FF 
+ 329      ADDA79FF 
+ 329      AEDA
+ 330 149a 7AFFAEDA 		.ascii	"z\377\256\332z\377\257\333{\377\257\333{\377\260\333|\377\260"
+ 330      7AFFAFDB 
+ 330      7BFFAFDB 
+ 330      7BFFB0DB 
+ 330      7CFFB0
+ 331 14ad DB7CFFB0 		.ascii	"\333|\377\260\334}\377\261\334}\377\261\334~\377\262\335\177"
+ 331      DC7DFFB1 
+ 331      DC7DFFB1 
+ 331      DC7EFFB2 
+ 331      DD7F
+ 332 14bf FFB2DD7F 		.ascii	"\377\262\335\177\377\263\335\200\377\263\336\200\377\264\336"
+ 332      FFB3DD80 
+ 332      FFB3DE80 
+ 332      FFB4DE
+ 333 14ce 81FFB4DE 		.ascii	"\201\377\264\336\201\377\264\336\202\377\265\337\202\377\265"
+ 333      81FFB4DE 
+ 333      82FFB5DF 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 26
+
+
+ 333      82FFB5
+ 334 14dd DF83FFB6 		.ascii	"\337\203\377\266\337\203\377\266\340\204\377\267\340\204\377"
+ 334      DF83FFB6 
+ 334      E084FFB7 
+ 334      E084FF
+ 335 14ec B7E085FF 		.ascii	"\267\340\205\377\267\340\205\377\270\341\206\377\270\341\207"
+ 335      B7E085FF 
+ 335      B8E186FF 
+ 335      B8E187
+ 336 14fb FFB9E187 		.ascii	"\377\271\341\207\377\271\341\210\377\271\341\210\377\272\341"
+ 336      FFB9E188 
+ 336      FFB9E188 
+ 336      FFBAE1
+ 337 150a 89FFBAE2 		.ascii	"\211\377\272\342\211\377\272\342\212\377\273\342\213\377\273"
+ 337      89FFBAE2 
+ 337      8AFFBBE2 
+ 337      8BFFBB
+ 338 1519 E28BFFBC 		.ascii	"\342\213\377\274\342\214\377\274\342\214\377\274\343\215\377"
+ 338      E28CFFBC 
+ 338      E28CFFBC 
+ 338      E38DFF
+ 339 1528 BDE38EFF 		.ascii	"\275\343\216\377\275\343\216\377\275\343\217\377\276\343\217"
+ 339      BDE38EFF 
+ 339      BDE38FFF 
+ 339      BEE38F
+ 340 1537 FFBEE390 		.ascii	"\377\276\343\220\377\277\343\220\377\277\344\221\377\277\344"
+ 340      FFBFE390 
+ 340      FFBFE491 
+ 340      FFBFE4
+ 341 1546 92FFC0E4 		.ascii	"\222\377\300\344\222\377\300\344\223\377\300\344\223\377\301"
+ 341      92FFC0E4 
+ 341      93FFC0E4 
+ 341      93FFC1
+ 342 1555 E494FFC1 		.ascii	"\344\224\377\301\345\224\377\302\345\225\377\302\345\226\377"
+ 342      E594FFC2 
+ 342      E595FFC2 
+ 342      E596FF
+ 343 1564 C2E596FF 		.ascii	"\302\345\226\377\303\345\227\377\303\345\227\377\303\346\230"
+ 343      C3E597FF 
+ 343      C3E597FF 
+ 343      C3E698
+ 344 1573 FFC4E698 		.ascii	"\377\304\346\230\377\304\346\231\377\304\346\232\377\305\346"
+ 344      FFC4E699 
+ 344      FFC4E69A 
+ 344      FFC5E6
+ 345 1582 9AFFC5E6 		.ascii	"\232\377\305\346\233\377\306\346\233\377\306\347\234\377\306"
+ 345      9BFFC6E6 
+ 345      9BFFC6E7 
+ 345      9CFFC6
+ 346 1591 E79DFFC7 		.ascii	"\347\235\377\307\347\235\377\307\347\236\377\307\347\236\377"
+ 346      E79DFFC7 
+ 346      E79EFFC7 
+ 346      E79EFF
+ 347 15a0 C8E79FFF 		.ascii	"\310\347\237\377\310\350\237\377\310\350\240\377\311\350\241"
+ 347      C8E89FFF 
+ 347      C8E8A0FF 
+ 347      C9E8A1
+GAS LISTING /tmp/ccw8Qa8b.s 			page 27
+
+
+ 348 15af FFC9E8A1 		.ascii	"\377\311\350\241\377\312\350\242\377\312\350\242\377\312\350"
+ 348      FFCAE8A2 
+ 348      FFCAE8A2 
+ 348      FFCAE8
+ 349 15be A3FFD4ED 		.ascii	"\243\377\324\355\262\377\324\355\263\377\325\355\263\377\325"
+ 349      B2FFD4ED 
+ 349      B3FFD5ED 
+ 349      B3FFD5
+ 350 15cd EDB4FFD5 		.ascii	"\355\264\377\325\355\265\377\326\355\265\377\326\356\266\377"
+ 350      EDB5FFD6 
+ 350      EDB5FFD6 
+ 350      EEB6FF
+ 351 15dc D6EEB6FF 		.ascii	"\326\356\266\377\327\356\267\377\327\356\267\377\327\356\270"
+ 351      D7EEB7FF 
+ 351      D7EEB7FF 
+ 351      D7EEB8
+ 352 15eb FFD8EEB9 		.ascii	"\377\330\356\271\377\330\357\271\377\330\357\272\377\331\357"
+ 352      FFD8EFB9 
+ 352      FFD8EFBA 
+ 352      FFD9EF
+ 353 15fa BAFFD9EF 		.ascii	"\272\377\331\357\273\377\332\357\273\377\332\357\274\377\332"
+ 353      BBFFDAEF 
+ 353      BBFFDAEF 
+ 353      BCFFDA
+ 354 1609 EFBDFFDB 		.ascii	"\357\275\377\333\360\275\377\333\360\276\377\333\360\276\377"
+ 354      F0BDFFDB 
+ 354      F0BEFFDB 
+ 354      F0BEFF
+ 355 1618 DCF0BFFF 		.ascii	"\334\360\277\377\334\360\277\377\334\360\300\377\335\361\301"
+ 355      DCF0BFFF 
+ 355      DCF0C0FF 
+ 355      DDF1C1
+ 356 1627 FFDDF1C1 		.ascii	"\377\335\361\301\377\335\361\302\377\336\361\302\377\336\361"
+ 356      FFDDF1C2 
+ 356      FFDEF1C2 
+ 356      FFDEF1
+ 357 1636 C3FFDEF1 		.ascii	"\303\377\336\361\304\377\337\361\304\377\337\362\305\377\337"
+ 357      C4FFDFF1 
+ 357      C4FFDFF2 
+ 357      C5FFDF
+ 358 1645 F2C5FFE0 		.ascii	"\362\305\377\340\362\306\377\340\362\306\377\340\362\307\377"
+ 358      F2C6FFE0 
+ 358      F2C6FFE0 
+ 358      F2C7FF
+ 359 1654 E1F2C8FF 		.ascii	"\341\362\310\377\341\363\310\377\342\363\311\377\342\363\311"
+ 359      E1F3C8FF 
+ 359      E2F3C9FF 
+ 359      E2F3C9
+ 360 1663 FFE2F3CA 		.ascii	"\377\342\363\312\377\343\363\313\377\343\363\313\377\343\363"
+ 360      FFE3F3CB 
+ 360      FFE3F3CB 
+ 360      FFE3F3
+ 361 1672 CCFFE4F4 		.ascii	"\314\377\344\364\314\377\344\364\315\377\344\364\315\377\345"
+ 361      CCFFE4F4 
+ 361      CDFFE4F4 
+ 361      CDFFE5
+ 362 1681 F4CEFFE5 		.ascii	"\364\316\377\345\364\317\377\345\364\317\377\346\364\317\377"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 28
+
+
+ 362      F4CFFFE5 
+ 362      F4CFFFE6 
+ 362      F4CFFF
+ 363 1690 E7F4CFFF 		.ascii	"\347\364\317\377\350\364\317\377\350\364\317\377\351\364\317"
+ 363      E8F4CFFF 
+ 363      E8F4CFFF 
+ 363      E9F4CF
+ 364 169f FFEAF4CF 		.ascii	"\377\352\364\317\377\353\364\320\377\353\363\320\377\354\363"
+ 364      FFEBF4D0 
+ 364      FFEBF3D0 
+ 364      FFECF3
+ 365 16ae D0FFEDF3 		.ascii	"\320\377\355\363\320\377\356\363\320\377\356\363\320\377\357"
+ 365      D0FFEEF3 
+ 365      D0FFEEF3 
+ 365      D0FFEF
+ 366 16bd F3D0FFF0 		.ascii	"\363\320\377\360\363\320\377\360\362\321\377\361\362\321\377"
+ 366      F3D0FFF0 
+ 366      F2D1FFF1 
+ 366      F2D1FF
+ 367 16cc F2F2D1FF 		.ascii	"\362\362\321\377\362\362\321\377\363\362\321\377\363\362\322"
+ 367      F2F2D1FF 
+ 367      F3F2D1FF 
+ 367      F3F2D2
+ 368 16db FFF4F2D2 		.ascii	"\377\364\362\322\377\365\362\322\377\365\362\322\377\366\361"
+ 368      FFF5F2D2 
+ 368      FFF5F2D2 
+ 368      FFF6F1
+ 369 16ea D3FFF6F1 		.ascii	"\323\377\366\361\323\377\367\361\323\377\367\361\324\377\367"
+ 369      D3FFF7F1 
+ 369      D3FFF7F1 
+ 369      D4FFF7
+ 370 16f9 F1D4FFF8 		.ascii	"\361\324\377\370\361\324\377\370\361\325\377\371\361\325\377"
+ 370      F1D4FFF8 
+ 370      F1D5FFF9 
+ 370      F1D5FF
+ 371 1708 F9F1D6FF 		.ascii	"\371\361\326\377\371\361\326\377\372\361\326\377\372\361\327"
+ 371      F9F1D6FF 
+ 371      FAF1D6FF 
+ 371      FAF1D7
+ 372 1717 FFFAF1D7 		.ascii	"\377\372\361\327\377\372\360\330\377\372\360\330\377\372\360"
+ 372      FFFAF0D8 
+ 372      FFFAF0D8 
+ 372      FFFAF0
+ 373 1726 D8FFFAF0 		.ascii	"\330\377\372\360\331\377\372\360\331\377\372\360\332\377\372"
+ 373      D9FFFAF0 
+ 373      D9FFFAF0 
+ 373      DAFFFA
+ 374 1735 F0DAFFFA 		.ascii	"\360\332\377\372\360\333\377\372\360\333\377\372\360\334\377"
+ 374      F0DBFFFA 
+ 374      F0DBFFFA 
+ 374      F0DCFF
+ 375 1744 FAF0DCFF 		.ascii	"\372\360\334\377\372\360\335\377\372\360\335\377\372\360\336"
+ 375      FAF0DDFF 
+ 375      FAF0DDFF 
+ 375      FAF0DE
+ 376 1753 FFFAF0DE 		.ascii	"\377\372\360\336\377\375\361\346\377\375\361\347\377\375\361"
+ 376      FFFDF1E6 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 29
+
+
+ 376      FFFDF1E7 
+ 376      FFFDF1
+ 377 1762 E7FFFDF1 		.ascii	"\347\377\375\361\350\377\375\361\350\377\375\361\351\377\375"
+ 377      E8FFFDF1 
+ 377      E8FFFDF1 
+ 377      E9FFFD
+ 378 1771 F1E9FFFD 		.ascii	"\361\351\377\375\361\352\377\375\361\352\377\375\361\352\377"
+ 378      F1EAFFFD 
+ 378      F1EAFFFD 
+ 378      F1EAFF
+ 379 1780 FDF1EBFF 		.ascii	"\375\361\353\377\375\361\353\377\375\361\354\377\375\361\354"
+ 379      FDF1EBFF 
+ 379      FDF1ECFF 
+ 379      FDF1EC
+ 380 178f FFFDF1ED 		.ascii	"\377\375\361\355\377\375\362\355\377\375\362\356\377\375\362"
+ 380      FFFDF2ED 
+ 380      FFFDF2EE 
+ 380      FFFDF2
+ 381 179e EEFFFDF2 		.ascii	"\356\377\375\362\356\377\375\362\357\377\375\362\357\377\375"
+ 381      EEFFFDF2 
+ 381      EFFFFDF2 
+ 381      EFFFFD
+ 382 17ad F2F0FFFD 		.ascii	"\362\360\377\375\362\360\377\375\362\360\377\375\363\361\377"
+ 382      F2F0FFFD 
+ 382      F2F0FFFD 
+ 382      F3F1FF
+ 383 17bc FDF3F1FF 		.ascii	"\375\363\361\377\375\363\361\377\375\363\362\377\375\363\362"
+ 383      FDF3F1FF 
+ 383      FDF3F2FF 
+ 383      FDF3F2
+ 384 17cb FFFDF3F2 		.ascii	"\377\375\363\362\377\374\363\363\377\374\363\363\377\374\364"
+ 384      FFFCF3F3 
+ 384      FFFCF3F3 
+ 384      FFFCF4
+ 385 17da F3FFFCF4 		.ascii	"\363\377\374\364\364\377\373\364\364\377\373\364\364\377\373"
+ 385      F4FFFBF4 
+ 385      F4FFFBF4 
+ 385      F4FFFB
+ 386 17e9 F4F4FFFA 		.ascii	"\364\364\377\372\364\365\377"
+ 386      F4F5FF
+ 387 17f0 FAF4F5FF 		.ascii	"\372\364\365\377\372\365\365\377\372\365\365\377\371\365\365"
+ 387      FAF5F5FF 
+ 387      FAF5F5FF 
+ 387      F9F5F5
+ 388 17ff FFF9F5F6 		.ascii	"\377\371\365\366\377\371\365\366\377\370\365\366\377\370\366"
+ 388      FFF9F5F6 
+ 388      FFF8F5F6 
+ 388      FFF8F6
+ 389 180e F6FFF8F6 		.ascii	"\366\377\370\366\366\377\370\366\366\377\367\366\366\377\367"
+ 389      F6FFF8F6 
+ 389      F6FFF7F6 
+ 389      F6FFF7
+ 390 181d F6F6FFF7 		.ascii	"\366\366\377\367\366\366\377\367\366\367\377\367\366\366\377"
+ 390      F6F6FFF7 
+ 390      F6F7FFF7 
+ 390      F6F6FF
+ 391 182c F7F6F6FF 		.ascii	"\367\366\366\377\367\366\366\377\367\366\366\377\367\366\366"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 30
+
+
+ 391      F7F6F6FF 
+ 391      F7F6F6FF 
+ 391      F7F6F6
+ 392 183b FFF7F5F6 		.ascii	"\377\367\365\366\377\367\365\366\377\367\365\366\377\367\365"
+ 392      FFF7F5F6 
+ 392      FFF7F5F6 
+ 392      FFF7F5
+ 393 184a F5FFF7F5 		.ascii	"\365\377\367\365\365\377\367\364\365\377\370\364\365\377\370"
+ 393      F5FFF7F4 
+ 393      F5FFF8F4 
+ 393      F5FFF8
+ 394 1859 F4F5FFF8 		.ascii	"\364\365\377\370\364\365\377\370\364\365\377\370\364\365\377"
+ 394      F4F5FFF8 
+ 394      F4F5FFF8 
+ 394      F4F5FF
+ 395 1868 F8F3F5FF 		.ascii	"\370\363\365\377\370\363\365\377\370\363\364\377\370\363\364"
+ 395      F8F3F5FF 
+ 395      F8F3F4FF 
+ 395      F8F3F4
+ 396 1877 FFF8F3F4 		.ascii	"\377\370\363\364\377\370\362\364\377\370\362\364\377\370\362"
+ 396      FFF8F2F4 
+ 396      FFF8F2F4 
+ 396      FFF8F2
+ 397 1886 F4FFF8F2 		.ascii	"\364\377\370\362\364\377\371\362\364\377\371\362\364\377\371"
+ 397      F4FFF9F2 
+ 397      F4FFF9F2 
+ 397      F4FFF9
+ 398 1895 F1F4FFF9 		.ascii	"\361\364\377\371\361\364\377\371\361\363\377\371\361\363\377"
+ 398      F1F4FFF9 
+ 398      F1F3FFF9 
+ 398      F1F3FF
+ 399 18a4 F9F1F3FF 		.ascii	"\371\361\363\377\371\360\363\377\371\360\363\377\371\360\363"
+ 399      F9F0F3FF 
+ 399      F9F0F3FF 
+ 399      F9F0F3
+ 400 18b3 FFF9F0F3 		.ascii	"\377\371\360\363\377\371\360\363\377\371\360\363\377\371\357"
+ 400      FFF9F0F3 
+ 400      FFF9F0F3 
+ 400      FFF9EF
+ 401 18c2 F3FFF9EF 		.ascii	"\363\377\371\357\363\377\371\357\363\377\372\357\363\377\372"
+ 401      F3FFF9EF 
+ 401      F3FFFAEF 
+ 401      F3FFFA
+ 402 18d1 EFF2FFFA 		.ascii	"\357\362\377\372\356\362\377\372\356\362\377\372\356\362\377"
+ 402      EEF2FFFA 
+ 402      EEF2FFFA 
+ 402      EEF2FF
+ 403 18e0 FAEEF2FF 		.ascii	"\372\356\362\377\372\356\362\377\372\356\362\377\372\355\362"
+ 403      FAEEF2FF 
+ 403      FAEEF2FF 
+ 403      FAEDF2
+ 404 18ef FFFAEDF2 		.ascii	"\377\372\355\362\377\373\350\360\377\373\350\360\377\373\350"
+ 404      FFFBE8F0 
+ 404      FFFBE8F0 
+ 404      FFFBE8
+ 405 18fe F0FFFBE8 		.ascii	"\360\377\373\350\360\377\373\350\360\377\373\350\360\377\374"
+ 405      F0FFFBE8 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 31
+
+
+ 405      F0FFFBE8 
+ 405      F0FFFC
+ 406 190d E7F0FFFC 		.ascii	"\347\360\377\374\347\360\377\374\347\360\377\374\347\360\377"
+ 406      E7F0FFFC 
+ 406      E7F0FFFC 
+ 406      E7F0FF
+ 407 191c FCE7F0FF 		.ascii	"\374\347\360\377\374\346\360\377\374\346\360\377\374\346\360"
+ 407      FCE6F0FF 
+ 407      FCE6F0FF 
+ 407      FCE6F0
+ 408 192b FFFCE6F0 		.ascii	"\377\374\346\360\377\374\346\357\377\374\346\357\377\374\345"
+ 408      FFFCE6EF 
+ 408      FFFCE6EF 
+ 408      FFFCE5
+ 409 193a EFFFFCE5 		.ascii	"\357\377\374\345\357\377\374\345\357\377\374\345\357\377\374"
+ 409      EFFFFCE5 
+ 409      EFFFFCE5 
+ 409      EFFFFC
+ 410 1949 E5EFFFFC 		.ascii	"\345\357\377\374\344\357\377\374\344\357\377\374\344\357\377"
+ 410      E4EFFFFC 
+ 410      E4EFFFFC 
+ 410      E4EFFF
+ 411 1958 FCE4EFFF 		.ascii	"\374\344\357\377\374\344\357\377\374\344\357\377\374\343\357"
+ 411      FCE4EFFF 
+ 411      FCE4EFFF 
+ 411      FCE3EF
+ 412 1967 FFFCE3EF 		.ascii	"\377\374\343\357\377\374\343\357\377\374\343\357\377\374\343"
+ 412      FFFCE3EF 
+ 412      FFFCE3EF 
+ 412      FFFCE3
+ 413 1976 EFFFFCE3 		.ascii	"\357\377\374\343\357\377\374\342\357\377\374\342\357\377\374"
+ 413      EFFFFCE2 
+ 413      EFFFFCE2 
+ 413      EFFFFC
+ 414 1985 E2EFFFFC 		.ascii	"\342\357\377\374\342\357\377\374\342\357\377\374\341\357\377"
+ 414      E2EFFFFC 
+ 414      E2EFFFFC 
+ 414      E1EFFF
+ 415 1994 FCE1EFFF 		.ascii	"\374\341\357\377\374\341\357\377\374\341\357\377\374\341\357"
+ 415      FCE1EFFF 
+ 415      FCE1EFFF 
+ 415      FCE1EF
+ 416 19a3 FFFCE1EF 		.ascii	"\377\374\341\357\377\374\340\357\377\374\340\357\377\374\340"
+ 416      FFFCE0EF 
+ 416      FFFCE0EF 
+ 416      FFFCE0
+ 417 19b2 EFFFFCE0 		.ascii	"\357\377\374\340\357\377\374\340\357\377\374\340\357\377\374"
+ 417      EFFFFCE0 
+ 417      EFFFFCE0 
+ 417      EFFFFC
+ 418 19c1 DFEEFFFC 		.ascii	"\337\356\377\374\337\356\377\374\337\356\377\374\336\356\377"
+ 418      DFEEFFFC 
+ 418      DFEEFFFC 
+ 418      DEEEFF
+ 419 19d0 FCDEEEFF 		.ascii	"\374\336\356\377\374\336\356\377\374\335\355\377\374\335\355"
+ 419      FCDEEEFF 
+ 419      FCDDEDFF 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 32
+
+
+ 419      FCDDED
+ 420 19df FFFCDDED 		.ascii	"\377\374\335\355\377\374\334\355\377\374\334\355\377\374\334"
+ 420      FFFCDCED 
+ 420      FFFCDCED 
+ 420      FFFCDC
+ 421 19ee ECFFFCDB 		.ascii	"\354\377\374\333\354\377\373\333\354\377\373\333\354\377\373"
+ 421      ECFFFBDB 
+ 421      ECFFFBDB 
+ 421      ECFFFB
+ 422 19fd DAECFFFB 		.ascii	"\332\354\377\373\332\354\377\373\332\353\377\373\331\353\377"
+ 422      DAECFFFB 
+ 422      DAEBFFFB 
+ 422      D9EBFF
+ 423 1a0c FBD9EBFF 		.ascii	"\373\331\353\377\373\331\353\377\373\330\353\377\373\330\353"
+ 423      FBD9EBFF 
+ 423      FBD8EBFF 
+ 423      FBD8EB
+ 424 1a1b FFFBD8EA 		.ascii	"\377\373\330\352\377\373\327\352\377\372\327\352\377\372\327"
+ 424      FFFBD7EA 
+ 424      FFFAD7EA 
+ 424      FFFAD7
+ 425 1a2a EAFFFAD6 		.ascii	"\352\377\372\326\352\377\372\326\352\377\372\326\351\377\372"
+ 425      EAFFFAD6 
+ 425      EAFFFAD6 
+ 425      E9FFFA
+ 426 1a39 D5E9FFFA 		.ascii	"\325\351\377\372\325\351\377\372\325\351\377\372\324\351\377"
+ 426      D5E9FFFA 
+ 426      D5E9FFFA 
+ 426      D4E9FF
+ 427 1a48 FAD4E9FF 		.ascii	"\372\324\351\377\372\324\350\377\371\323\350\377\371\323\350"
+ 427      FAD4E8FF 
+ 427      F9D3E8FF 
+ 427      F9D3E8
+ 428 1a57 FFF9D3E8 		.ascii	"\377\371\323\350\377\371\322\350\377\371\322\347\377\371\322"
+ 428      FFF9D2E8 
+ 428      FFF9D2E7 
+ 428      FFF9D2
+ 429 1a66 E7FFF9D1 		.ascii	"\347\377\371\321\347\377\371\321\347\377\371\321\347\377\371"
+ 429      E7FFF9D1 
+ 429      E7FFF9D1 
+ 429      E7FFF9
+ 430 1a75 D0E7FFF9 		.ascii	"\320\347\377\371\320\346\377\370\320\346\377\370\320\346\377"
+ 430      D0E6FFF8 
+ 430      D0E6FFF8 
+ 430      D0E6FF
+ 431 1a84 F8CFE6FF 		.ascii	"\370\317\346\377\370\317\346\377\366\306\341\377\366\306\341"
+ 431      F8CFE6FF 
+ 431      F6C6E1FF 
+ 431      F6C6E1
+ 432 1a93 FFF6C5E1 		.ascii	"\377\366\305\341\377\365\305\341\377\365\305\341\377\365\304"
+ 432      FFF5C5E1 
+ 432      FFF5C5E1 
+ 432      FFF5C4
+ 433 1aa2 E1FFF5C4 		.ascii	"\341\377\365\304\340\377\365\304\340\377\365\303\340\377\365"
+ 433      E0FFF5C4 
+ 433      E0FFF5C3 
+ 433      E0FFF5
+GAS LISTING /tmp/ccw8Qa8b.s 			page 33
+
+
+ 434 1ab1 C3E0FFF5 		.ascii	"\303\340\377\365\303\340\377\365\303\340\377\365\302\340\377"
+ 434      C3E0FFF5 
+ 434      C3E0FFF5 
+ 434      C2E0FF
+ 435 1ac0 F4C2DFFF 		.ascii	"\364\302\337\377\364\302\337\377\364\301\337\377\364\301\337"
+ 435      F4C2DFFF 
+ 435      F4C1DFFF 
+ 435      F4C1DF
+ 436 1acf FFF4C1DF 		.ascii	"\377\364\301\337\377\364\300\337\377\364\300\336\377\364\300"
+ 436      FFF4C0DF 
+ 436      FFF4C0DE 
+ 436      FFF4C0
+ 437 1ade DEFFF4BF 		.ascii	"\336\377\364\277\336\377\364\277\336\377\363\277\336\377\363"
+ 437      DEFFF4BF 
+ 437      DEFFF3BF 
+ 437      DEFFF3
+ 438 1aed BEDEFFF3 		.ascii	"\276\336\377\363\276\335\377\363\276\335\377\363\275\335\377"
+ 438      BEDDFFF3 
+ 438      BEDDFFF3 
+ 438      BDDDFF
+ 439 1afc F3BDDDFF 		.ascii	"\363\275\335\377\363\275\335\377\363\274\335\377\363\274\335"
+ 439      F3BDDDFF 
+ 439      F3BCDDFF 
+ 439      F3BCDD
+ 440 1b0b FFF3BCDC 		.ascii	"\377\363\274\334\377\362\273\334\377\362\273\334\377\362\273"
+ 440      FFF2BBDC 
+ 440      FFF2BBDC 
+ 440      FFF2BB
+ 441 1b1a DCFFF2BA 		.ascii	"\334\377\362\272\334\377\362\272\334\377\362\272\333\377\362"
+ 441      DCFFF2BA 
+ 441      DCFFF2BA 
+ 441      DBFFF2
+ 442 1b29 B9DBFFF2 		.ascii	"\271\333\377\362\271\333\377\362\271\333\377\361\270\333\377"
+ 442      B9DBFFF2 
+ 442      B9DBFFF1 
+ 442      B8DBFF
+ 443 1b38 F1B8DBFF 		.ascii	"\361\270\333\377\361\270\333\377\361\267\332\377\361\267\332"
+ 443      F1B8DBFF 
+ 443      F1B7DAFF 
+ 443      F1B7DA
+ 444 1b47 FFF1B7DA 		.ascii	"\377\361\267\332\377\361\266\332\377\361\266\332\377\361\266"
+ 444      FFF1B6DA 
+ 444      FFF1B6DA 
+ 444      FFF1B6
+ 445 1b56 DAFFF0B5 		.ascii	"\332\377\360\265\331\377\360\265\331\377\360\264\331\377\360"
+ 445      D9FFF0B5 
+ 445      D9FFF0B4 
+ 445      D9FFF0
+ 446 1b65 B4D8FFF0 		.ascii	"\264\330\377\360\263\330\377\360\263\330\377\360\263\330\377"
+ 446      B3D8FFF0 
+ 446      B3D8FFF0 
+ 446      B3D8FF
+ 447 1b74 EFB2D7FF 		.ascii	"\357\262\327\377\357\262\327\377\357\261\327\377\357\261\326"
+ 447      EFB2D7FF 
+ 447      EFB1D7FF 
+ 447      EFB1D6
+ 448 1b83 FFEFB0D6 		.ascii	"\377\357\260\326\377\357\260\326\377\357\257\325\377\356\257"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 34
+
+
+ 448      FFEFB0D6 
+ 448      FFEFAFD5 
+ 448      FFEEAF
+ 449 1b92 D5FFEEAE 		.ascii	"\325\377\356\256\325\377\356\256\324\377\356\255\324\377\356"
+ 449      D5FFEEAE 
+ 449      D4FFEEAD 
+ 449      D4FFEE
+ 450 1ba1 ADD4FFEE 		.ascii	"\255\324\377\356\254\323\377\356\254\323\377\355\253\323\377"
+ 450      ACD3FFEE 
+ 450      ACD3FFED 
+ 450      ABD3FF
+ 451 1bb0 EDABD2FF 		.ascii	"\355\253\322\377\355\252\322\377\355\252\322\377\355\251\321"
+ 451      EDAAD2FF 
+ 451      EDAAD2FF 
+ 451      EDA9D1
+ 452 1bbf FFEDA9D1 		.ascii	"\377\355\251\321\377\355\250\321\377\354\250\320\377\354\247"
+ 452      FFEDA8D1 
+ 452      FFECA8D0 
+ 452      FFECA7
+ 453 1bce D0FFECA7 		.ascii	"\320\377\354\247\320\377\354\246\317\377\354\246\317\377\354"
+ 453      D0FFECA6 
+ 453      CFFFECA6 
+ 453      CFFFEC
+ 454 1bdd A6CFFFEB 		.ascii	"\246\317\377\353\245\316\377\353\245\316\377\353\244\316\377"
+ 454      A5CEFFEB 
+ 454      A5CEFFEB 
+ 454      A4CEFF
+ 455 1bec EBA4CDFF 		.ascii	"\353\244\315\377\353\243\315\377\353\243\315\377\353\242\314"
+ 455      EBA3CDFF 
+ 455      EBA3CDFF 
+ 455      EBA2CC
+ 456 1bfb FFEAA2CC 		.ascii	"\377\352\242\314\377\352\241\314\377\352\241\313\377\352\240"
+ 456      FFEAA1CC 
+ 456      FFEAA1CB 
+ 456      FFEAA0
+ 457 1c0a CBFFEAA0 		.ascii	"\313\377\352\240\313\377\352\237\312\377\352\237\312\377\351"
+ 457      CBFFEA9F 
+ 457      CAFFEA9F 
+ 457      CAFFE9
+ 458 1c19 9ECAFFE9 		.ascii	"\236\312\377\351\236\311\377\351\235\311\377\345\220\300\377"
+ 458      9EC9FFE9 
+ 458      9DC9FFE5 
+ 458      90C0FF
+ 459 1c28 E590BFFF 		.ascii	"\345\220\277\377\345\217\277\377\345\217\277\377\345\216\276"
+ 459      E58FBFFF 
+ 459      E58FBFFF 
+ 459      E58EBE
+ 460 1c37 FFE48EBE 		.ascii	"\377\344\216\276\377\344\215\276\377\344\215\275\377\344\214"
+ 460      FFE48DBE 
+ 460      FFE48DBD 
+ 460      FFE48C
+ 461 1c46 BDFFE48C 		.ascii	"\275\377\344\214\275\377\344\213\274\377\344\213\274\377\343"
+ 461      BDFFE48B 
+ 461      BCFFE48B 
+ 461      BCFFE3
+ 462 1c55 8ABCFFE3 		.ascii	"\212\274\377\343\212\273\377\343\211\273\377\343\211\272\377"
+ 462      8ABBFFE3 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 35
+
+
+ 462      89BBFFE3 
+ 462      89BAFF
+ 463 1c64 E388BAFF 		.ascii	"\343\210\272\377\343\210\272\377\343\207\271\377\342\207\271"
+ 463      E388BAFF 
+ 463      E387B9FF 
+ 463      E287B9
+ 464 1c73 FFE286B9 		.ascii	"\377\342\206\271\377\342\206\270\377\342\205\270\377\342\205"
+ 464      FFE286B8 
+ 464      FFE285B8 
+ 464      FFE285
+ 465 1c82 B8FFE284 		.ascii	"\270\377\342\204\267\377\341\204\267\377\341\203\267\377\341"
+ 465      B7FFE184 
+ 465      B7FFE183 
+ 465      B7FFE1
+ 466 1c91 83B6FFE1 		.ascii	"\203\266\377\341\202\266\377\341\202\266\377\341\201\265\377"
+ 466      82B6FFE1 
+ 466      82B6FFE1 
+ 466      81B5FF
+ 467 1ca0 E181B5FF 		.ascii	"\341\201\265\377\340\200\264\377\340\200\264\377\340\177\264"
+ 467      E080B4FF 
+ 467      E080B4FF 
+ 467      E07FB4
+ 468 1caf FFE07FB3 		.ascii	"\377\340\177\263\377\340~\263\377\340~\263\377\340}\262\377\337"
+ 468      FFE07EB3 
+ 468      FFE07EB3 
+ 468      FFE07DB2 
+ 468      FFDF
+ 469 1cc1 7DB2FFDF 		.ascii	"}\262\377\337|\262\377\337|\261\377\337{\261\377\337{\260\377"
+ 469      7CB2FFDF 
+ 469      7CB1FFDF 
+ 469      7BB1FFDF 
+ 469      7BB0FF
+ 470 1cd4 DF7AB0FF 		.ascii	"\337z\260\377\336z\260\377\336y\257\377\336y\257\377\336x\257"
+ 470      DE7AB0FF 
+ 470      DE79AFFF 
+ 470      DE79AFFF 
+ 470      DE78AF
+ 471 1ce7 FFDE78AE 		.ascii	"\377\336x\256\377\336w\256\377\336w\256\377\335v\255\377\335"
+ 471      FFDE77AE 
+ 471      FFDE77AE 
+ 471      FFDD76AD 
+ 471      FFDD
+ 472 1cf9 75ADFFDD 		.ascii	"u\255\377\335u\254\377\335t\254\377\335t\254\377\334s\253\377"
+ 472      75ACFFDD 
+ 472      74ACFFDD 
+ 472      74ACFFDC 
+ 472      73ABFF
+ 473 1d0c DC73ABFF 		.ascii	"\334s\253\377\334r\253\377\334r\252\377\334q\252\377\334p\251"
+ 473      DC72ABFF 
+ 473      DC72AAFF 
+ 473      DC71AAFF 
+ 473      DC70A9
+ 474 1d1f FFDB70A9 		.ascii	"\377\333p\251\377\333o\251\377\333o\250\377\333n\250\377\333"
+ 474      FFDB6FA9 
+ 474      FFDB6FA8 
+ 474      FFDB6EA8 
+ 474      FFDB
+GAS LISTING /tmp/ccw8Qa8b.s 			page 36
+
+
+ 475 1d31 6EA8FFDA 		.ascii	"n\250\377\332m\247\377\332l\247\377\332l\246\377\332k\246\377"
+ 475      6DA7FFDA 
+ 475      6CA7FFDA 
+ 475      6CA6FFDA 
+ 475      6BA6FF
+ 476 1d44 DA6BA6FF 		.ascii	"\332k\246\377\332j\245\377\331i\245\377\331i\245\377\331h\244"
+ 476      DA6AA5FF 
+ 476      D969A5FF 
+ 476      D969A5FF 
+ 476      D968A4
+ 477 1d57 FFD968A4 		.ascii	"\377\331h\244\377\331g\243\377\330f\243\377\330f\243\377\330"
+ 477      FFD967A3 
+ 477      FFD866A3 
+ 477      FFD866A3 
+ 477      FFD8
+ 478 1d69 65A2FFD8 		.ascii	"e\242\377\330e\242\377\330d\242\377\327c\241\377\327c\241\377"
+ 478      65A2FFD8 
+ 478      64A2FFD7 
+ 478      63A1FFD7 
+ 478      63A1FF
+ 479 1d7c D762A0FF 		.ascii	"\327b\240\377\327b\240\377\327a\240\377\327`\237\377\326`\237"
+ 479      D762A0FF 
+ 479      D761A0FF 
+ 479      D7609FFF 
+ 479      D6609F
+ 480 1d8f FFD65F9F 		.ascii	"\377\326_\237\377\326_\236\377\326^\236\377\326]\235\377\325"
+ 480      FFD65F9E 
+ 480      FFD65E9E 
+ 480      FFD65D9D 
+ 480      FFD5
+ 481 1da1 5D9DFFD5 		.ascii	"]\235\377\325\\\235\377\325[\234\377\325[\234\377\325Z\233\377"
+ 481      5C9DFFD5 
+ 481      5B9CFFD5 
+ 481      5B9CFFD5 
+ 481      5A9BFF
+ 482 1db4 D45A9BFF 		.ascii	"\324Z\233\377\324Y\233\377\324X\232\377\317E\220\377\317E\220"
+ 482      D4599BFF 
+ 482      D4589AFF 
+ 482      CF4590FF 
+ 482      CF4590
+ 483 1dc7 FFCE448F 		.ascii	"\377\316D\217\377\316C\217\377\316C\217\377\316B\216\377\316"
+ 483      FFCE438F 
+ 483      FFCE438F 
+ 483      FFCE428E 
+ 483      FFCE
+ 484 1dd9 418EFFCD 		.ascii	"A\216\377\315A\215\377\315@\215\377\315?\215\377\315?\214\377"
+ 484      418DFFCD 
+ 484      408DFFCD 
+ 484      3F8DFFCD 
+ 484      3F8CFF
+ 485 1dec CD3E8CFF 		.ascii	"\315>\214\377\314=\214\377\314<\213\377\314<\213\377\314;\212"
+ 485      CC3D8CFF 
+ 485      CC3C8BFF 
+ 485      CC3C8BFF 
+ 485      CC3B8A
+ 486 1dff FFCC3A8A 		.ascii	"\377\314:\212\377\313:\212\377\3139\211\377\3138\211\377\313"
+ 486      FFCB3A8A 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 37
+
+
+ 486      FFCB3989 
+ 486      FFCB3889 
+ 486      FFCB
+ 487 1e11 3788FFCB 		.ascii	"7\210\377\3137\210\377\3126\210\377\3125\207\377\3124\207\377"
+ 487      3788FFCA 
+ 487      3688FFCA 
+ 487      3587FFCA 
+ 487      3487FF
+ 488 1e24 CA3486FF 		.ascii	"\3124\206\377\3123\206\377\3112\206\377\3111\205\377\3110\205"
+ 488      CA3386FF 
+ 488      C93286FF 
+ 488      C93185FF 
+ 488      C93085
+ 489 1e37 FFC93085 		.ascii	"\377\3110\205\377\311/\204\377\310.\204\377\310-\203\377\310"
+ 489      FFC92F84 
+ 489      FFC82E84 
+ 489      FFC82D83 
+ 489      FFC8
+ 490 1e49 2C83FFC8 		.ascii	",\203\377\310+\203\377\310*\202\377\307*\202\377\307)\201\377"
+ 490      2B83FFC8 
+ 490      2A82FFC7 
+ 490      2A82FFC7 
+ 490      2981FF
+ 491 1e5c C72881FF 		.ascii	"\307(\201\377\307'\201\377\307&\200\377\306%\200\377\306$\177"
+ 491      C72781FF 
+ 491      C72680FF 
+ 491      C62580FF 
+ 491      C6247F
+ 492 1e6f FFC6237F 		.ascii	"\377\306#\177\377\306!\177\377\305 ~\377\305\037~\377\305\036"
+ 492      FFC6217F 
+ 492      FFC5207E 
+ 492      FFC51F7E 
+ 492      FFC51E
+ 493 1e82 7EFFC51D 		.ascii	"~\377\305\035}\377\305\033}\377\304\032|\377\304\032|\377\303"
+ 493      7DFFC51B 
+ 493      7DFFC41A 
+ 493      7CFFC41A 
+ 493      7CFFC3
+ 494 1e95 1A7CFFC3 		.ascii	"\032|\377\303\032{\377\303\032{\377\302\031{\377\302\031z\377"
+ 494      1A7BFFC3 
+ 494      1A7BFFC2 
+ 494      197BFFC2 
+ 494      197AFF
+ 495 1ea8 C1197AFF 		.ascii	"\301\031z\377\301\031z\377\300\031y\377\300\030y\377\300\030"
+ 495      C1197AFF 
+ 495      C01979FF 
+ 495      C01879FF 
+ 495      C018
+ 496 1eba 78FFBF18 		.ascii	"x\377\277\030x\377\277\030x\377\276\030w\377\276\027w\377\275"
+ 496      78FFBF18 
+ 496      78FFBE18 
+ 496      77FFBE17 
+ 496      77FFBD
+ 497 1ecd 1777FFBD 		.ascii	"\027w\377\275\027v\377\274\027v\377\274\027v\377\274\026u\377"
+ 497      1776FFBC 
+ 497      1776FFBC 
+ 497      1776FFBC 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 38
+
+
+ 497      1675FF
+ 498 1ee0 BB1675FF 		.ascii	"\273\026u\377\273\026u\377\272\026t\377\272\026t\377\271\025"
+ 498      BB1675FF 
+ 498      BA1674FF 
+ 498      BA1674FF 
+ 498      B915
+ 499 1ef2 74FFB915 		.ascii	"t\377\271\025s\377\271\025s\377\270\025s\377\270\025r\377\267"
+ 499      73FFB915 
+ 499      73FFB815 
+ 499      73FFB815 
+ 499      72FFB7
+ 500 1f05 1472FFB7 		.ascii	"\024r\377\267\024q\377\266\024q\377\266\024q\377\266\024p\377"
+ 500      1471FFB6 
+ 500      1471FFB6 
+ 500      1471FFB6 
+ 500      1470FF
+ 501 1f18 B51370FF 		.ascii	"\265\023p\377\265\023p\377\264\023o\377\264\023o\377\263\023"
+ 501      B51370FF 
+ 501      B4136FFF 
+ 501      B4136FFF 
+ 501      B313
+ 502 1f2a 6FFFB312 		.ascii	"o\377\263\022n\377\263\022n\377\262\022n\377\262\022m\377\261"
+ 502      6EFFB312 
+ 502      6EFFB212 
+ 502      6EFFB212 
+ 502      6DFFB1
+ 503 1f3d 126DFFB1 		.ascii	"\022m\377\261\021m\377\260\021l\377\260\021l\377\257\021l\377"
+ 503      116DFFB0 
+ 503      116CFFB0 
+ 503      116CFFAF 
+ 503      116CFF
+ 504 1f50 AF106BFF 		.ascii	"\257\020k\377\257\020k\377\243\013b\377\243\013b\377\242\na\377"
+ 504      AF106BFF 
+ 504      A30B62FF 
+ 504      A30B62FF 
+ 504      A20A61FF 
+ 505 1f64 A20A61FF 		.ascii	"\242\na\377\241\na\377\241\n`\377\241\n`\377\240\t`\377\240\t"
+ 505      A10A61FF 
+ 505      A10A60FF 
+ 505      A10A60FF 
+ 505      A00960FF 
+ 506 1f7a 5FFF9F09 		.ascii	"_\377\237\t_\377\237\t_\377\236\b^\377\236\b^\377\236\b^\377"
+ 506      5FFF9F09 
+ 506      5FFF9E08 
+ 506      5EFF9E08 
+ 506      5EFF9E08 
+ 507 1f90 9D085DFF 		.ascii	"\235\b]\377\235\007]\377\234\007]\377\234\007\\\377\233\007\\"
+ 507      9D075DFF 
+ 507      9C075DFF 
+ 507      9C075CFF 
+ 507      9B075C
+ 508 1fa3 FF9B075C 		.ascii	"\377\233\007\\\377\233\006[\377\232\006[\377\232\006[\377\231"
+ 508      FF9B065B 
+ 508      FF9A065B 
+ 508      FF9A065B 
+ 508      FF99
+ 509 1fb5 065AFF99 		.ascii	"\006Z\377\231\005Z\377\231\005Z\377"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 39
+
+
+ 509      055AFF99 
+ 509      055AFF
+ 510 1fc0 980559FF 		.ascii	"\230\005Y\377\230\005Y\377\227\005Y\377\227\004Y\377\226\004"
+ 510      980559FF 
+ 510      970559FF 
+ 510      970459FF 
+ 510      9604
+ 511 1fd2 58FF9604 		.ascii	"X\377\226\004X\377\226\004X\377\225\004W\377\225\003W\377\224"
+ 511      58FF9604 
+ 511      58FF9504 
+ 511      57FF9503 
+ 511      57FF94
+ 512 1fe5 0357FF94 		.ascii	"\003W\377\224\003V\377\223\003V\377\223\003V\377\223\003U\377"
+ 512      0356FF93 
+ 512      0356FF93 
+ 512      0356FF93 
+ 512      0355FF
+ 513 1ff8 920255FF 		.ascii	"\222\002U\377\222\002U\377\221\002T\377\221\002T\377\220\002"
+ 513      920255FF 
+ 513      910254FF 
+ 513      910254FF 
+ 513      9002
+ 514 200a 54FF9001 		.ascii	"T\377\220\001S\377\220\001S\377\217\001S\377\217\001R\377\216"
+ 514      53FF9001 
+ 514      53FF8F01 
+ 514      53FF8F01 
+ 514      52FF8E
+ 515 201d 0152FF8E 		.ascii	"\001R\377\216\001R\377"
+ 515      0152FF
+ 516              		.globl	heatmap_cs_PiYG_soft
+ 517              		.section	.data.rel.local
+ 518              		.align 8
+ 519              		.type	heatmap_cs_PiYG_soft, @object
+ 520              		.size	heatmap_cs_PiYG_soft, 8
+ 521              	heatmap_cs_PiYG_soft:
+ 522 0010 00000000 		.quad	soft
+ 522      00000000 
+ 523              		.section	.data.rel.ro.local
+ 524              		.align 16
+ 525              		.type	soft, @object
+ 526              		.size	soft, 16
+ 527              	soft:
+ 528 0020 00000000 		.quad	soft_data
+ 528      00000000 
+ 529 0028 01040000 		.quad	1025
+ 529      00000000 
+ 530              		.section	.rodata
+ 531 2024 00000000 		.align 32
+ 531      00000000 
+ 531      00000000 
+ 531      00000000 
+ 531      00000000 
+ 532              		.type	soft_data, @object
+ 533              		.size	soft_data, 4100
+ 534              	soft_data:
+ 535 2040 00       		.string	""
+ 536 2041 00       		.string	""
+GAS LISTING /tmp/ccw8Qa8b.s 			page 40
+
+
+ 537 2042 00       		.string	""
+ 538 2043 00       		.string	""
+ 539 2044 27641800 		.string	"'d\030"
+ 540 2048 27641907 		.ascii	"'d\031\007'd\031\016(e\031\026(e\031\035(f\031%)f\031,)g\031"
+ 540      2764190E 
+ 540      28651916 
+ 540      2865191D 
+ 540      28661925 
+ 541 2063 34296719 		.ascii	"4)g\031;*g\031C*h\031J*h\032R+i\032Y+i\032a+j\032h,j\032p,k\032"
+ 541      3B2A6719 
+ 541      432A6819 
+ 541      4A2A681A 
+ 541      522B691A 
+ 542 2087 772C6B1A 		.ascii	"w,k\032\177-k\032\206-l\032\215-l\032\225.m\032\234.m\033\244"
+ 542      7F2D6B1A 
+ 542      862D6C1A 
+ 542      8D2D6C1A 
+ 542      952E6D1A 
+ 543 20a0 2E6E1BAB 		.ascii	".n\033\253/n\033\263/o\033\272/o\033\3020o\033\3110p\033\321"
+ 543      2F6E1BB3 
+ 543      2F6F1BBA 
+ 543      2F6F1BC2 
+ 543      306F1BC9 
+ 544 20b8 30701BD8 		.ascii	"0p\033\3301q\033\3401q\033\3472r\033\3572r\034\3662s\034\376"
+ 544      31711BE0 
+ 544      31711BE7 
+ 544      32721BEF 
+ 544      32721CF6 
+ 545 20d0 33731CFF 		.ascii	"3s\034\3773s\034\3773t\034\3774t\034\3774u\034\3774u\034\377"
+ 545      33731CFF 
+ 545      33741CFF 
+ 545      34741CFF 
+ 545      34751CFF 
+ 546 20e8 35761CFF 		.ascii	"5v\034\3775v\034\3776w\034\3776w\034\3776w\035\3777x\035\377"
+ 546      35761CFF 
+ 546      36771CFF 
+ 546      36771CFF 
+ 546      36771DFF 
+ 547 2100 37781DFF 		.ascii	"7x\035\3777y\035\3778y\035\3778z\035\3778z\035\3779{\035\377"
+ 547      37791DFF 
+ 547      38791DFF 
+ 547      387A1DFF 
+ 547      387A1DFF 
+ 548 2118 397B1DFF 		.ascii	"9{\035\377:{\035\377:|\035\377:|\035\377;}\036\377;}\036\377"
+ 548      3A7B1DFF 
+ 548      3A7C1DFF 
+ 548      3A7C1DFF 
+ 548      3B7D1EFF 
+ 549 2130 3B7E1EFF 		.ascii	";~\036\377<~\036\377<\177\036\377=\177\036\377=\200\036\377="
+ 549      3C7E1EFF 
+ 549      3C7F1EFF 
+ 549      3D7F1EFF 
+ 549      3D801EFF 
+ 550 2145 801EFF3E 		.ascii	"\200\036\377>\200\036\377>\201\036\377?\201\036\377?\202\036"
+ 550      801EFF3E 
+ 550      811EFF3F 
+ 550      811EFF3F 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 41
+
+
+ 550      821E
+ 551 2157 FF3F821E 		.ascii	"\377?\202\036\377@\203\036\377@\203\037\377@\204\037\377A\204"
+ 551      FF40831E 
+ 551      FF40831F 
+ 551      FF40841F 
+ 551      FF4184
+ 552 216a 1FFF4185 		.ascii	"\037\377A\205\037\377B\205\037\377B\205\037\377B\206\037\377"
+ 552      1FFF4285 
+ 552      1FFF4285 
+ 552      1FFF4286 
+ 552      1FFF
+ 553 217c 43861FFF 		.ascii	"C\206\037\377C\207\037\377D\207\037\377D\210\037\377D\210\037"
+ 553      43871FFF 
+ 553      44871FFF 
+ 553      44881FFF 
+ 553      44881F
+ 554 218f FF45891F 		.ascii	"\377E\211\037\377E\211\037\377F\212\037\377F\212 \377F\212 \377"
+ 554      FF45891F 
+ 554      FF468A1F 
+ 554      FF468A20 
+ 554      FF468A20 
+ 555 21a4 478B20FF 		.ascii	"G\213 \377G\213 \377G\214 \377H\214 \377H\215 \377I\215 \377"
+ 555      478B20FF 
+ 555      478C20FF 
+ 555      488C20FF 
+ 555      488D20FF 
+ 556 21bc 498E20FF 		.ascii	"I\216 \377J\216 \377J\217 \377J\217 \377K\217 \377K\220 \377"
+ 556      4A8E20FF 
+ 556      4A8F20FF 
+ 556      4A8F20FF 
+ 556      4B8F20FF 
+ 557 21d4 4C9020FF 		.ascii	"L\220 \377L\221 \377L\221 \377M\222!\377M\222!\377N\223!\377"
+ 557      4C9120FF 
+ 557      4C9120FF 
+ 557      4D9221FF 
+ 557      4D9221FF 
+ 558 21ec 4E9322FF 		.ascii	"N\223\"\377O\223\"\377O\224\"\377P\224#\377P\225#\377Q\225#\377"
+ 558      4F9322FF 
+ 558      4F9422FF 
+ 558      509423FF 
+ 558      509523FF 
+ 559 2204 519524FF 		.ascii	"Q\225$\377R\226$\377R\226$\377S\227%\377S\227%\377T\227%\377"
+ 559      529624FF 
+ 559      529624FF 
+ 559      539725FF 
+ 559      539725FF 
+ 560 221c 549825FF 		.ascii	"T\230%\377U\230&\377U\231&\377V\231&\377V\231'\377W\232'\377"
+ 560      559826FF 
+ 560      559926FF 
+ 560      569926FF 
+ 560      569927FF 
+ 561 2234 579A27FF 		.ascii	"W\232'\377X\233(\377X\233(\377Y\233(\377Y\234)\377Y\234)\377"
+ 561      589B28FF 
+ 561      589B28FF 
+ 561      599B28FF 
+ 561      599C29FF 
+ 562 224c 5A9D29FF 		.ascii	"Z\235)\377Z\235*\377[\235*\377[\236*\377\\\236+\377\\\237+\377"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 42
+
+
+ 562      5A9D2AFF 
+ 562      5B9D2AFF 
+ 562      5B9E2AFF 
+ 562      5C9E2BFF 
+ 563 2264 5D9F2BFF 		.ascii	"]\237+\377]\240+\377^\240,\377^\240,\377_\241,\377_\241-\377"
+ 563      5DA02BFF 
+ 563      5EA02CFF 
+ 563      5EA02CFF 
+ 563      5FA12CFF 
+ 564 227c 60A22DFF 		.ascii	"`\242-\377`\242-\377a\242.\377a\243.\377b\243.\377b\244/\377"
+ 564      60A22DFF 
+ 564      61A22EFF 
+ 564      61A32EFF 
+ 564      62A32EFF 
+ 565 2294 63A42FFF 		.ascii	"c\244/\377c\244/\377d\2450\377d\2450\377e\2460\377e\2460\377"
+ 565      63A42FFF 
+ 565      64A530FF 
+ 565      64A530FF 
+ 565      65A630FF 
+ 566 22ac 66A631FF 		.ascii	"f\2461\377f\2471\377g\2471\377g\2502\377h\2502\377h\2512\377"
+ 566      66A731FF 
+ 566      67A731FF 
+ 566      67A832FF 
+ 566      68A832FF 
+ 567 22c4 69A933FF 		.ascii	"i\2513\377i\2513\377j\2523\377j\2524\377k\2534\377k\2534\377"
+ 567      69A933FF 
+ 567      6AAA33FF 
+ 567      6AAA34FF 
+ 567      6BAB34FF 
+ 568 22dc 6BAB34FF 		.ascii	"k\2534\377l\2545\377l\2545\377m\2555\377m\2556\377n\2556\377"
+ 568      6CAC35FF 
+ 568      6CAC35FF 
+ 568      6DAD35FF 
+ 568      6DAD36FF 
+ 569 22f4 6EAE36FF 		.ascii	"n\2566\377o\2567\377o\2577\377p\2577\377p\2608\377q\2608\377"
+ 569      6FAE37FF 
+ 569      6FAF37FF 
+ 569      70AF37FF 
+ 569      70B038FF 
+ 570 230c 71B038FF 		.ascii	"q\2608\377r\2619\377r\2619\377s\2629\377s\2629\377t\262:\377"
+ 570      72B139FF 
+ 570      72B139FF 
+ 570      73B239FF 
+ 570      73B239FF 
+ 571 2324 74B33AFF 		.ascii	"t\263:\377u\263:\377u\264;\377v\264;\377v\265;\377w\265<\377"
+ 571      75B33AFF 
+ 571      75B43BFF 
+ 571      76B43BFF 
+ 571      76B53BFF 
+ 572 233c 77B53CFF 		.ascii	"w\265<\377x\266<\377x\266=\377y\267=\377y\267=\377z\267=\377"
+ 572      78B63CFF 
+ 572      78B63DFF 
+ 572      79B73DFF 
+ 572      79B73DFF 
+ 573 2354 7AB83EFF 		.ascii	"z\270>\377{\270>\377{\271>\377|\271?\377|\271?\377}\272?\377"
+ 573      7BB83EFF 
+ 573      7BB93EFF 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 43
+
+
+ 573      7CB93FFF 
+ 573      7CB93FFF 
+ 574 236c 7DBA40FF 		.ascii	"}\272@\377~\273@\377~\273@\377\177\274A\377\177\274A\377\200"
+ 574      7EBB40FF 
+ 574      7EBB40FF 
+ 574      7FBC41FF 
+ 574      7FBC41FF 
+ 575 2381 BC42FF80 		.ascii	"\274B\377\200\275C\377\201\275D\377\202\275D\377\202\276E\377"
+ 575      BD43FF81 
+ 575      BD44FF82 
+ 575      BD44FF82 
+ 575      BE45FF
+ 576 2394 83BE46FF 		.ascii	"\203\276F\377\203\276F\377\204\277G\377\204\277H\377\205\300"
+ 576      83BE46FF 
+ 576      84BF47FF 
+ 576      84BF48FF 
+ 576      85C0
+ 577 23a6 48FF86C0 		.ascii	"H\377\206\300I\377\206\300J\377\207\301K\377\207\301K\377\210"
+ 577      49FF86C0 
+ 577      4AFF87C1 
+ 577      4BFF87C1 
+ 577      4BFF88
+ 578 23b9 C14CFF88 		.ascii	"\301L\377\210\302M\377\211\302M\377\212\302N\377\212\303O\377"
+ 578      C24DFF89 
+ 578      C24DFF8A 
+ 578      C24EFF8A 
+ 578      C34FFF
+ 579 23cc 8BC34FFF 		.ascii	"\213\303O\377\213\303P\377\214\304Q\377\214\304Q\377\215\305"
+ 579      8BC350FF 
+ 579      8CC451FF 
+ 579      8CC451FF 
+ 579      8DC5
+ 580 23de 52FF8DC5 		.ascii	"R\377\215\305S\377\216\305S\377\217\306T\377\217\306U\377\220"
+ 580      53FF8EC5 
+ 580      53FF8FC6 
+ 580      54FF8FC6 
+ 580      55FF90
+ 581 23f1 C655FF90 		.ascii	"\306U\377\220\307V\377\221\307W\377\221\307X\377\222\310X\377"
+ 581      C756FF91 
+ 581      C757FF91 
+ 581      C758FF92 
+ 581      C858FF
+ 582 2404 93C859FF 		.ascii	"\223\310Y\377\223\310Z\377\224\311Z\377\224\311[\377\225\312"
+ 582      93C85AFF 
+ 582      94C95AFF 
+ 582      94C95BFF 
+ 582      95CA
+ 583 2416 5CFF95CA 		.ascii	"\\\377\225\312\\\377\226\312]\377\226\313^\377\227\313^\377\230"
+ 583      5CFF96CA 
+ 583      5DFF96CB 
+ 583      5EFF97CB 
+ 583      5EFF98
+ 584 2429 CB5FFF98 		.ascii	"\313_\377\230\314`\377\231\314`\377\231\314a\377\232\315b\377"
+ 584      CC60FF99 
+ 584      CC60FF99 
+ 584      CC61FF9A 
+ 584      CD62FF
+GAS LISTING /tmp/ccw8Qa8b.s 			page 44
+
+
+ 585 243c 9ACD62FF 		.ascii	"\232\315b\377\233\316c\377\233\316d\377\234\316d\377\235\317"
+ 585      9BCE63FF 
+ 585      9BCE64FF 
+ 585      9CCE64FF 
+ 585      9DCF
+ 586 244e 65FF9DCF 		.ascii	"e\377\235\317f\377\236\317f\377\236\320g\377\237\320h\377\237"
+ 586      66FF9ECF 
+ 586      66FF9ED0 
+ 586      67FF9FD0 
+ 586      68FF9F
+ 587 2461 D068FFA0 		.ascii	"\320h\377\240\321i\377\240\321j\377\241\322j\377\242\322k\377"
+ 587      D169FFA0 
+ 587      D16AFFA1 
+ 587      D26AFFA2 
+ 587      D26BFF
+ 588 2474 A2D26CFF 		.ascii	"\242\322l\377\243\323l\377\243\323m\377\244\323n\377\244\324"
+ 588      A3D36CFF 
+ 588      A3D36DFF 
+ 588      A4D36EFF 
+ 588      A4D4
+ 589 2486 6EFFA5D4 		.ascii	"n\377\245\324o\377\245\324p\377\246\325p\377\247\325q\377\247"
+ 589      6FFFA5D4 
+ 589      70FFA6D5 
+ 589      70FFA7D5 
+ 589      71FFA7
+ 590 2499 D672FFA8 		.ascii	"\326r\377\250\326r\377\250\326s\377\251\327t\377\251\327t\377"
+ 590      D672FFA8 
+ 590      D673FFA9 
+ 590      D774FFA9 
+ 590      D774FF
+ 591 24ac AAD775FF 		.ascii	"\252\327u\377\252\330u\377\253\330v\377\253\330w\377\254\331"
+ 591      AAD875FF 
+ 591      ABD876FF 
+ 591      ABD877FF 
+ 591      ACD9
+ 592 24be 77FFADD9 		.ascii	"w\377\255\331x\377\255\332y\377\256\332y\377\256\332z\377\257"
+ 592      78FFADDA 
+ 592      79FFAEDA 
+ 592      79FFAEDA 
+ 592      7AFFAF
+ 593 24d1 DB7BFFAF 		.ascii	"\333{\377\257\333{\377\260\333|\377\260\334}\377\261\334}\377"
+ 593      DB7BFFB0 
+ 593      DB7CFFB0 
+ 593      DC7DFFB1 
+ 593      DC7DFF
+ 594 24e4 B1DC7EFF 		.ascii	"\261\334~\377\262\335\177\377\263\335\177\377\263\336\200\377"
+ 594      B2DD7FFF 
+ 594      B3DD7FFF 
+ 594      B3DE80FF 
+ 595 24f4 B4DE81FF 		.ascii	"\264\336\201\377\264\336\201\377\265\337\202\377\265\337\203"
+ 595      B4DE81FF 
+ 595      B5DF82FF 
+ 595      B5DF83
+ 596 2503 FFB6DF83 		.ascii	"\377\266\337\203\377\266\340\204\377\267\340\205\377\267\340"
+ 596      FFB6E084 
+ 596      FFB7E085 
+ 596      FFB7E0
+GAS LISTING /tmp/ccw8Qa8b.s 			page 45
+
+
+ 597 2512 85FFB8E1 		.ascii	"\205\377\270\341\206\377\270\341\207\377\271\341\210\377\271"
+ 597      86FFB8E1 
+ 597      87FFB9E1 
+ 597      88FFB9
+ 598 2521 E188FFBA 		.ascii	"\341\210\377\272\341\211\377\272\342\212\377\273\342\212\377"
+ 598      E189FFBA 
+ 598      E28AFFBB 
+ 598      E28AFF
+ 599 2530 BBE28BFF 		.ascii	"\273\342\213\377\274\342\214\377\274\342\215\377\275\343\215"
+ 599      BCE28CFF 
+ 599      BCE28DFF 
+ 599      BDE38D
+ 600 253f FFBDE38E 		.ascii	"\377\275\343\216\377\276\343\217\377\276\343\220\377\276\343"
+ 600      FFBEE38F 
+ 600      FFBEE390 
+ 600      FFBEE3
+ 601 254e 90FFBFE4 		.ascii	"\220\377\277\344\221\377\277\344\222\377\300\344\222\377\300"
+ 601      91FFBFE4 
+ 601      92FFC0E4 
+ 601      92FFC0
+ 602 255d E493FFC1 		.ascii	"\344\223\377\301\344\224\377\301\345\225\377\302\345\225\377"
+ 602      E494FFC1 
+ 602      E595FFC2 
+ 602      E595FF
+ 603 256c C2E596FF 		.ascii	"\302\345\226\377\303\345\227\377\303\345\227\377\304\346\230"
+ 603      C3E597FF 
+ 603      C3E597FF 
+ 603      C4E698
+ 604 257b FFC4E699 		.ascii	"\377\304\346\231\377\305\346\232\377\305\346\232\377\305\346"
+ 604      FFC5E69A 
+ 604      FFC5E69A 
+ 604      FFC5E6
+ 605 258a 9BFFC6E7 		.ascii	"\233\377\306\347\234\377\306\347\234\377\307\347\235\377\307"
+ 605      9CFFC6E7 
+ 605      9CFFC7E7 
+ 605      9DFFC7
+ 606 2599 E79EFFC8 		.ascii	"\347\236\377\310\347\237\377\310\350\237\377\311\350\240\377"
+ 606      E79FFFC8 
+ 606      E89FFFC9 
+ 606      E8A0FF
+ 607 25a8 C9E8A1FF 		.ascii	"\311\350\241\377\312\350\242\377\312\350\242\377\312\351\243"
+ 607      CAE8A2FF 
+ 607      CAE8A2FF 
+ 607      CAE9A3
+ 608 25b7 FFCBE9A4 		.ascii	"\377\313\351\244\377\313\351\244\377\314\351\245\377\314\351"
+ 608      FFCBE9A4 
+ 608      FFCCE9A5 
+ 608      FFCCE9
+ 609 25c6 A6FFCDE9 		.ascii	"\246\377\315\351\247\377\315\352\247\377\316\352\250\377\316"
+ 609      A7FFCDEA 
+ 609      A7FFCEEA 
+ 609      A8FFCE
+ 610 25d5 EAA9FFCF 		.ascii	"\352\251\377\317\352\251\377\317\352\252\377\317\353\253\377"
+ 610      EAA9FFCF 
+ 610      EAAAFFCF 
+ 610      EBABFF
+ 611 25e4 D0EBACFF 		.ascii	"\320\353\254\377\320\353\254\377\321\353\255\377\321\353\256"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 46
+
+
+ 611      D0EBACFF 
+ 611      D1EBADFF 
+ 611      D1EBAE
+ 612 25f3 FFD2ECAF 		.ascii	"\377\322\354\257\377\322\354\257\377\323\354\260\377\323\354"
+ 612      FFD2ECAF 
+ 612      FFD3ECB0 
+ 612      FFD3EC
+ 613 2602 B1FFD3EC 		.ascii	"\261\377\323\354\261\377\324\355\262\377\324\355\263\377\325"
+ 613      B1FFD4ED 
+ 613      B2FFD4ED 
+ 613      B3FFD5
+ 614 2611 EDB4FFD5 		.ascii	"\355\264\377\325\355\264\377\326\355\265\377\326\356\266\377"
+ 614      EDB4FFD6 
+ 614      EDB5FFD6 
+ 614      EEB6FF
+ 615 2620 D7EEB6FF 		.ascii	"\327\356\266\377\327\356\267\377\327\356\270\377\330\356\271"
+ 615      D7EEB7FF 
+ 615      D7EEB8FF 
+ 615      D8EEB9
+ 616 262f FFD8EFB9 		.ascii	"\377\330\357\271\377\331\357\272\377\331\357\273\377\332\357"
+ 616      FFD9EFBA 
+ 616      FFD9EFBB 
+ 616      FFDAEF
+ 617 263e BBFFDAEF 		.ascii	"\273\377\332\357\274\377\332\360\275\377\333\360\276\377\333"
+ 617      BCFFDAF0 
+ 617      BDFFDBF0 
+ 617      BEFFDB
+ 618 264d F0BEFFDC 		.ascii	"\360\276\377\334\360\277\377\334\360\300\377\335\361\301\377"
+ 618      F0BFFFDC 
+ 618      F0C0FFDD 
+ 618      F1C1FF
+ 619 265c DDF1C1FF 		.ascii	"\335\361\301\377\336\361\302\377\336\361\303\377\336\361\303"
+ 619      DEF1C2FF 
+ 619      DEF1C3FF 
+ 619      DEF1C3
+ 620 266b FFDFF1C4 		.ascii	"\377\337\361\304\377\337\362\305\377\340\362\306\377\340\362"
+ 620      FFDFF2C5 
+ 620      FFE0F2C6 
+ 620      FFE0F2
+ 621 267a C6FFE1F2 		.ascii	"\306\377\341\362\307\377\341\362\310\377\341\363\311\377\342"
+ 621      C7FFE1F2 
+ 621      C8FFE1F3 
+ 621      C9FFE2
+ 622 2689 F3C9FFE2 		.ascii	"\363\311\377\342\363\312\377\343\363\313\377\343\363\313\377"
+ 622      F3CAFFE3 
+ 622      F3CBFFE3 
+ 622      F3CBFF
+ 623 2698 E4F4CCFF 		.ascii	"\344\364\314\377\344\364\315\377\344\364\316\377\345\364\316"
+ 623      E4F4CDFF 
+ 623      E4F4CEFF 
+ 623      E5F4CE
+ 624 26a7 FFE5F4CF 		.ascii	"\377\345\364\317\377\346\364\317\377\347\364\317\377\350\364"
+ 624      FFE6F4CF 
+ 624      FFE7F4CF 
+ 624      FFE8F4
+ 625 26b6 CFFFE9F4 		.ascii	"\317\377\351\364\317\377\352\364\317\377\353\363\317\377\354"
+ 625      CFFFEAF4 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 47
+
+
+ 625      CFFFEBF3 
+ 625      CFFFEC
+ 626 26c5 F3D0FFED 		.ascii	"\363\320\377\355\363\320\377\356\363\320\377\357\363\320\377"
+ 626      F3D0FFEE 
+ 626      F3D0FFEF 
+ 626      F3D0FF
+ 627 26d4 F0F3D0FF 		.ascii	"\360\363\320\377\361\362\320\377\361\362\320\377\362\362\321"
+ 627      F1F2D0FF 
+ 627      F1F2D0FF 
+ 627      F2F2D1
+ 628 26e3 FFF3F2D1 		.ascii	"\377\363\362\321\377\364\362\321\377\365\362\321\377\365\361"
+ 628      FFF4F2D1 
+ 628      FFF5F2D1 
+ 628      FFF5F1
+ 629 26f2 D2FFF6F1 		.ascii	"\322\377\366\361\322\377\367\361\322\377\370\361\323\377\370"
+ 629      D2FFF7F1 
+ 629      D2FFF8F1 
+ 629      D3FFF8
+ 630 2701 F1D3FFF9 		.ascii	"\361\323\377\371\361\323\377\372\361\324\377\372\361\324\377"
+ 630      F1D3FFFA 
+ 630      F1D4FFFA 
+ 630      F1D4FF
+ 631 2710 FBF0D4FF 		.ascii	"\373\360\324\377\373\360\325\377\374\360\325\377\374\360\326"
+ 631      FBF0D5FF 
+ 631      FCF0D5FF 
+ 631      FCF0D6
+ 632 271f FFFDF0D6 		.ascii	"\377\375\360\326\377\375\360\327\377\376\360\327\377\376\360"
+ 632      FFFDF0D7 
+ 632      FFFEF0D7 
+ 632      FFFEF0
+ 633 272e D8FFFFF0 		.ascii	"\330\377\377\360\330\377\377\360\331\377\377\360\331\377\377"
+ 633      D8FFFFF0 
+ 633      D9FFFFF0 
+ 633      D9FFFF
+ 634 273d EFDAFFFF 		.ascii	"\357\332\377\377\357\332\377\377\357\333\377\377\357\333\377"
+ 634      EFDAFFFF 
+ 634      EFDBFFFF 
+ 634      EFDBFF
+ 635 274c FFEFDCFF 		.ascii	"\377\357\334\377\377\357\334\377\377\357\335\377\377\357\336"
+ 635      FFEFDCFF 
+ 635      FFEFDDFF 
+ 635      FFEFDE
+ 636 275b FFFFEFDE 		.ascii	"\377\377\357\336\377\377\357\337\377\377\357\337\377\377\357"
+ 636      FFFFEFDF 
+ 636      FFFFEFDF 
+ 636      FFFFEF
+ 637 276a E0FFFFEF 		.ascii	"\340\377\377\357\340\377\377\357\341\377\377\357\342\377\377"
+ 637      E0FFFFEF 
+ 637      E1FFFFEF 
+ 637      E2FFFF
+ 638 2779 EFE2FFFF 		.ascii	"\357\342\377\377\357\343\377\377\357\343\377\377\357\344\377"
+ 638      EFE3FFFF 
+ 638      EFE3FFFF 
+ 638      EFE4FF
+ 639 2788 FFEFE5FF 		.ascii	"\377\357\345\377\377\357\345\377\377\360\346\377\377\360\346"
+ 639      FFEFE5FF 
+ 639      FFF0E6FF 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 48
+
+
+ 639      FFF0E6
+ 640 2797 FFFFF0E7 		.ascii	"\377\377\360\347\377\377\360\347\377\377\360\350\377\377\360"
+ 640      FFFFF0E7 
+ 640      FFFFF0E8 
+ 640      FFFFF0
+ 641 27a6 E9FFFFF0 		.ascii	"\351\377\377\360\351\377\377\360\352\377\377\360\352\377\377"
+ 641      E9FFFFF0 
+ 641      EAFFFFF0 
+ 641      EAFFFF
+ 642 27b5 F0EBFFFF 		.ascii	"\360\353\377\377\360\353\377\377\361\354\377\377\361\354\377"
+ 642      F0EBFFFF 
+ 642      F1ECFFFF 
+ 642      F1ECFF
+ 643 27c4 FFF1EDFF 		.ascii	"\377\361\355\377\377\361\355\377\377\361\356\377\377\361\356"
+ 643      FFF1EDFF 
+ 643      FFF1EEFF 
+ 643      FFF1EE
+ 644 27d3 FFFFF1EF 		.ascii	"\377\377\361\357\377\377\362\357\377\377\362\360\377\377\362"
+ 644      FFFFF2EF 
+ 644      FFFFF2F0 
+ 644      FFFFF2
+ 645 27e2 F0FFFFF2 		.ascii	"\360\377\377\362\361\377\377\362\361\377\376\362\361\377\376"
+ 645      F1FFFFF2 
+ 645      F1FFFEF2 
+ 645      F1FFFE
+ 646 27f1 F3F2FFFE 		.ascii	"\363\362\377\376\363\362\377\375\363\362\377\375\363\363\377"
+ 646      F3F2FFFD 
+ 646      F3F2FFFD 
+ 646      F3F3FF
+ 647 2800 FCF3F3FF 		.ascii	"\374\363\363\377\374\363\363\377\374\364\364\377\373\364\364"
+ 647      FCF3F3FF 
+ 647      FCF4F4FF 
+ 647      FBF4F4
+ 648 280f FF       		.ascii	"\377"
+ 649 2810 FBF4F4FF 		.ascii	"\373\364\364\377\373\364\365\377\372\364\365\377\372\365\365"
+ 649      FBF4F5FF 
+ 649      FAF4F5FF 
+ 649      FAF5F5
+ 650 281f FFFAF5F5 		.ascii	"\377\372\365\365\377\371\365\365\377\371\365\366\377\371\365"
+ 650      FFF9F5F5 
+ 650      FFF9F5F6 
+ 650      FFF9F5
+ 651 282e F6FFF8F6 		.ascii	"\366\377\370\366\366\377\370\366\366\377\367\366\366\377\367"
+ 651      F6FFF8F6 
+ 651      F6FFF7F6 
+ 651      F6FFF7
+ 652 283d F6F6FFF7 		.ascii	"\366\366\377\367\366\366\377\367\366\367\377\367\366\366\377"
+ 652      F6F6FFF7 
+ 652      F6F7FFF7 
+ 652      F6F6FF
+ 653 284c F7F6F6FF 		.ascii	"\367\366\366\377\367\366\366\377\367\366\366\377\367\365\366"
+ 653      F7F6F6FF 
+ 653      F7F6F6FF 
+ 653      F7F5F6
+ 654 285b FFF7F5F6 		.ascii	"\377\367\365\366\377\367\365\366\377\367\365\365\377\367\364"
+ 654      FFF7F5F6 
+ 654      FFF7F5F5 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 49
+
+
+ 654      FFF7F4
+ 655 286a F5FFF8F4 		.ascii	"\365\377\370\364\365\377\370\364\365\377\370\364\365\377\370"
+ 655      F5FFF8F4 
+ 655      F5FFF8F4 
+ 655      F5FFF8
+ 656 2879 F4F5FFF8 		.ascii	"\364\365\377\370\363\365\377\370\363\364\377\370\363\364\377"
+ 656      F3F5FFF8 
+ 656      F3F4FFF8 
+ 656      F3F4FF
+ 657 2888 F8F3F4FF 		.ascii	"\370\363\364\377\370\362\364\377\370\362\364\377\371\362\364"
+ 657      F8F2F4FF 
+ 657      F8F2F4FF 
+ 657      F9F2F4
+ 658 2897 FFF9F2F4 		.ascii	"\377\371\362\364\377\371\361\364\377\371\361\363\377\371\361"
+ 658      FFF9F1F4 
+ 658      FFF9F1F3 
+ 658      FFF9F1
+ 659 28a6 F3FFF9F1 		.ascii	"\363\377\371\361\363\377\371\361\363\377\371\360\363\377\371"
+ 659      F3FFF9F1 
+ 659      F3FFF9F0 
+ 659      F3FFF9
+ 660 28b5 F0F3FFF9 		.ascii	"\360\363\377\371\360\363\377\371\360\363\377\371\357\363\377"
+ 660      F0F3FFF9 
+ 660      F0F3FFF9 
+ 660      EFF3FF
+ 661 28c4 FAEFF3FF 		.ascii	"\372\357\363\377\372\357\362\377\372\357\362\377\372\357\362"
+ 661      FAEFF2FF 
+ 661      FAEFF2FF 
+ 661      FAEFF2
+ 662 28d3 FFFAEEF2 		.ascii	"\377\372\356\362\377\372\356\362\377\372\356\362\377\372\356"
+ 662      FFFAEEF2 
+ 662      FFFAEEF2 
+ 662      FFFAEE
+ 663 28e2 F2FFFAED 		.ascii	"\362\377\372\355\362\377\372\355\362\377\372\355\362\377\372"
+ 663      F2FFFAED 
+ 663      F2FFFAED 
+ 663      F2FFFA
+ 664 28f1 EDF1FFFA 		.ascii	"\355\361\377\372\354\361\377\372\354\361\377\373\354\361\377"
+ 664      ECF1FFFA 
+ 664      ECF1FFFB 
+ 664      ECF1FF
+ 665 2900 FBECF1FF 		.ascii	"\373\354\361\377\373\354\361\377\373\353\361\377\373\353\361"
+ 665      FBECF1FF 
+ 665      FBEBF1FF 
+ 665      FBEBF1
+ 666 290f FFFBEBF1 		.ascii	"\377\373\353\361\377\373\353\361\377\373\352\361\377\373\352"
+ 666      FFFBEBF1 
+ 666      FFFBEAF1 
+ 666      FFFBEA
+ 667 291e F1FFFBEA 		.ascii	"\361\377\373\352\361\377\373\352\360\377\373\352\360\377\373"
+ 667      F1FFFBEA 
+ 667      F0FFFBEA 
+ 667      F0FFFB
+ 668 292d E9F0FFFB 		.ascii	"\351\360\377\373\351\360\377\373\351\360\377\373\351\360\377"
+ 668      E9F0FFFB 
+ 668      E9F0FFFB 
+ 668      E9F0FF
+GAS LISTING /tmp/ccw8Qa8b.s 			page 50
+
+
+ 669 293c FBE8F0FF 		.ascii	"\373\350\360\377\374\350\360\377\374\350\360\377\374\350\360"
+ 669      FCE8F0FF 
+ 669      FCE8F0FF 
+ 669      FCE8F0
+ 670 294b FFFCE8F0 		.ascii	"\377\374\350\360\377\374\347\360\377\374\347\360\377\374\347"
+ 670      FFFCE7F0 
+ 670      FFFCE7F0 
+ 670      FFFCE7
+ 671 295a F0FFFCE7 		.ascii	"\360\377\374\347\360\377\374\346\360\377\374\346\357\377\374"
+ 671      F0FFFCE6 
+ 671      F0FFFCE6 
+ 671      EFFFFC
+ 672 2969 E6EFFFFC 		.ascii	"\346\357\377\374\346\357\377\374\346\357\377\374\345\357\377"
+ 672      E6EFFFFC 
+ 672      E6EFFFFC 
+ 672      E5EFFF
+ 673 2978 FCE5EFFF 		.ascii	"\374\345\357\377\374\345\357\377\374\345\357\377\374\344\357"
+ 673      FCE5EFFF 
+ 673      FCE5EFFF 
+ 673      FCE4EF
+ 674 2987 FFFCE4EF 		.ascii	"\377\374\344\357\377\374\344\357\377\374\344\357\377\374\344"
+ 674      FFFCE4EF 
+ 674      FFFCE4EF 
+ 674      FFFCE4
+ 675 2996 EFFFFCE3 		.ascii	"\357\377\374\343\357\377\374\343\357\377\374\343\357\377\374"
+ 675      EFFFFCE3 
+ 675      EFFFFCE3 
+ 675      EFFFFC
+ 676 29a5 E3EFFFFC 		.ascii	"\343\357\377\374\342\357\377\374\342\357\377\374\342\357\377"
+ 676      E2EFFFFC 
+ 676      E2EFFFFC 
+ 676      E2EFFF
+ 677 29b4 FCE2EFFF 		.ascii	"\374\342\357\377\374\342\357\377\374\341\357\377\374\341\357"
+ 677      FCE2EFFF 
+ 677      FCE1EFFF 
+ 677      FCE1EF
+ 678 29c3 FFFCE1EF 		.ascii	"\377\374\341\357\377\374\341\357\377\374\340\357\377\374\340"
+ 678      FFFCE1EF 
+ 678      FFFCE0EF 
+ 678      FFFCE0
+ 679 29d2 EFFFFCE0 		.ascii	"\357\377\374\340\357\377\374\340\357\377\374\340\357\377\374"
+ 679      EFFFFCE0 
+ 679      EFFFFCE0 
+ 679      EFFFFC
+ 680 29e1 DFEEFFFC 		.ascii	"\337\356\377\374\337\356\377\374\336\356\377\374\336\356\377"
+ 680      DFEEFFFC 
+ 680      DEEEFFFC 
+ 680      DEEEFF
+ 681 29f0 FCDEEDFF 		.ascii	"\374\336\355\377\374\335\355\377\374\335\355\377\374\334\355"
+ 681      FCDDEDFF 
+ 681      FCDDEDFF 
+ 681      FCDCED
+ 682 29ff FFFCDCED 		.ascii	"\377\374\334\355\377\374\334\354\377\373\333\354\377\373\333"
+ 682      FFFCDCEC 
+ 682      FFFBDBEC 
+ 682      FFFBDB
+ 683 2a0e ECFFFBDA 		.ascii	"\354\377\373\332\354\377\373\332\354\377\373\331\353\377\373"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 51
+
+
+ 683      ECFFFBDA 
+ 683      ECFFFBD9 
+ 683      EBFFFB
+ 684 2a1d D9EBFFFB 		.ascii	"\331\353\377\373\331\353\377\373\330\353\377\373\330\352\377"
+ 684      D9EBFFFB 
+ 684      D8EBFFFB 
+ 684      D8EAFF
+ 685 2a2c FBD7EAFF 		.ascii	"\373\327\352\377\372\327\352\377\372\327\352\377\372\326\352"
+ 685      FAD7EAFF 
+ 685      FAD7EAFF 
+ 685      FAD6EA
+ 686 2a3b FFFAD6E9 		.ascii	"\377\372\326\351\377\372\325\351\377\372\325\351\377\372\325"
+ 686      FFFAD5E9 
+ 686      FFFAD5E9 
+ 686      FFFAD5
+ 687 2a4a E9FFFAD4 		.ascii	"\351\377\372\324\350\377\372\324\350\377\372\323\350\377\371"
+ 687      E8FFFAD4 
+ 687      E8FFFAD3 
+ 687      E8FFF9
+ 688 2a59 D3E8FFF9 		.ascii	"\323\350\377\371\322\350\377\371\322\347\377\371\322\347\377"
+ 688      D2E8FFF9 
+ 688      D2E7FFF9 
+ 688      D2E7FF
+ 689 2a68 F9D1E7FF 		.ascii	"\371\321\347\377\371\321\347\377\371\320\347\377\371\320\346"
+ 689      F9D1E7FF 
+ 689      F9D0E7FF 
+ 689      F9D0E6
+ 690 2a77 FFF9D0E6 		.ascii	"\377\371\320\346\377\370\317\346\377\370\317\346\377\370\316"
+ 690      FFF8CFE6 
+ 690      FFF8CFE6 
+ 690      FFF8CE
+ 691 2a86 E6FFF8CE 		.ascii	"\346\377\370\316\345\377\370\316\345\377\370\315\345\377\370"
+ 691      E5FFF8CE 
+ 691      E5FFF8CD 
+ 691      E5FFF8
+ 692 2a95 CDE5FFF8 		.ascii	"\315\345\377\370\314\344\377\367\314\344\377\367\314\344\377"
+ 692      CCE4FFF7 
+ 692      CCE4FFF7 
+ 692      CCE4FF
+ 693 2aa4 F7CBE4FF 		.ascii	"\367\313\344\377\367\313\344\377\367\312\343\377\367\312\343"
+ 693      F7CBE4FF 
+ 693      F7CAE3FF 
+ 693      F7CAE3
+ 694 2ab3 FFF7C9E3 		.ascii	"\377\367\311\343\377\367\311\343\377\367\311\343\377\366\310"
+ 694      FFF7C9E3 
+ 694      FFF7C9E3 
+ 694      FFF6C8
+ 695 2ac2 E2FFF6C8 		.ascii	"\342\377\366\310\342\377\366\307\342\377\366\307\342\377\366"
+ 695      E2FFF6C7 
+ 695      E2FFF6C7 
+ 695      E2FFF6
+ 696 2ad1 C7E2FFF6 		.ascii	"\307\342\377\366\306\341\377\366\306\341\377\366\305\341\377"
+ 696      C6E1FFF6 
+ 696      C6E1FFF6 
+ 696      C5E1FF
+ 697 2ae0 F5C5E1FF 		.ascii	"\365\305\341\377\365\305\341\377\365\304\340\377\365\304\340"
+ 697      F5C5E1FF 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 52
+
+
+ 697      F5C4E0FF 
+ 697      F5C4E0
+ 698 2aef FFF5C3E0 		.ascii	"\377\365\303\340\377\365\303\340\377\365\302\340\377\365\302"
+ 698      FFF5C3E0 
+ 698      FFF5C2E0 
+ 698      FFF5C2
+ 699 2afe DFFFF4C2 		.ascii	"\337\377\364\302\337\377\364\301\337\377\364\301\337\377\364"
+ 699      DFFFF4C1 
+ 699      DFFFF4C1 
+ 699      DFFFF4
+ 700 2b0d C0DFFFF4 		.ascii	"\300\337\377\364\300\336\377\364\300\336\377\364\277\336\377"
+ 700      C0DEFFF4 
+ 700      C0DEFFF4 
+ 700      BFDEFF
+ 701 2b1c F4BFDEFF 		.ascii	"\364\277\336\377\363\276\336\377\363\276\335\377\363\276\335"
+ 701      F3BEDEFF 
+ 701      F3BEDDFF 
+ 701      F3BEDD
+ 702 2b2b FFF3BDDD 		.ascii	"\377\363\275\335\377\363\275\335\377\363\274\335\377\363\274"
+ 702      FFF3BDDD 
+ 702      FFF3BCDD 
+ 702      FFF3BC
+ 703 2b3a DDFFF3BC 		.ascii	"\335\377\363\274\334\377\362\273\334\377\362\273\334\377\362"
+ 703      DCFFF2BB 
+ 703      DCFFF2BB 
+ 703      DCFFF2
+ 704 2b49 BADCFFF2 		.ascii	"\272\334\377\362\272\334\377\362\271\333\377\362\271\333\377"
+ 704      BADCFFF2 
+ 704      B9DBFFF2 
+ 704      B9DBFF
+ 705 2b58 F2B9DBFF 		.ascii	"\362\271\333\377\361\270\333\377\361\270\333\377\361\267\332"
+ 705      F1B8DBFF 
+ 705      F1B8DBFF 
+ 705      F1B7DA
+ 706 2b67 FFF1B7DA 		.ascii	"\377\361\267\332\377\361\267\332\377\361\266\332\377\361\266"
+ 706      FFF1B7DA 
+ 706      FFF1B6DA 
+ 706      FFF1B6
+ 707 2b76 DAFFF0B5 		.ascii	"\332\377\360\265\331\377\360\265\331\377\360\264\331\377\360"
+ 707      D9FFF0B5 
+ 707      D9FFF0B4 
+ 707      D9FFF0
+ 708 2b85 B4D8FFF0 		.ascii	"\264\330\377\360\263\330\377\360\262\327\377\357\262\327\377"
+ 708      B3D8FFF0 
+ 708      B2D7FFEF 
+ 708      B2D7FF
+ 709 2b94 EFB1D7FF 		.ascii	"\357\261\327\377\357\261\326\377\357\260\326\377\357\257\325"
+ 709      EFB1D6FF 
+ 709      EFB0D6FF 
+ 709      EFAFD5
+ 710 2ba3 FFEEAFD5 		.ascii	"\377\356\257\325\377\356\256\325\377\356\256\324\377\356\255"
+ 710      FFEEAED5 
+ 710      FFEEAED4 
+ 710      FFEEAD
+ 711 2bb2 D4FFEEAC 		.ascii	"\324\377\356\254\323\377\356\254\323\377\355\253\323\377\355"
+ 711      D3FFEEAC 
+ 711      D3FFEDAB 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 53
+
+
+ 711      D3FFED
+ 712 2bc1 ABD2FFED 		.ascii	"\253\322\377\355\252\322\377\355\251\321\377\355\251\321\377"
+ 712      AAD2FFED 
+ 712      A9D1FFED 
+ 712      A9D1FF
+ 713 2bd0 ECA8D0FF 		.ascii	"\354\250\320\377\354\250\320\377\354\247\320\377\354\246\317"
+ 713      ECA8D0FF 
+ 713      ECA7D0FF 
+ 713      ECA6CF
+ 714 2bdf FFECA6CF 		.ascii	"\377\354\246\317\377\354\245\316\377\353\245\316\377\353\244"
+ 714      FFECA5CE 
+ 714      FFEBA5CE 
+ 714      FFEBA4
+ 715 2bee CEFFEBA3 		.ascii	"\316\377\353\243\315\377\353\243\315\377\353\242\314\377\352"
+ 715      CDFFEBA3 
+ 715      CDFFEBA2 
+ 715      CCFFEA
+ 716 2bfd A2CCFFEA 		.ascii	"\242\314\377\352\241\313\377\352\240\313\377\352\240\313\377"
+ 716      A1CBFFEA 
+ 716      A0CBFFEA 
+ 716      A0CBFF
+ 717 2c0c EA9FCAFF 		.ascii	"\352\237\312\377\352\236\312\377\351\236\311\377\351\235\311"
+ 717      EA9ECAFF 
+ 717      E99EC9FF 
+ 717      E99DC9
+ 718 2c1b FFE99DC8 		.ascii	"\377\351\235\310\377\351\234\310\377\351\233\310\377\350\233"
+ 718      FFE99CC8 
+ 718      FFE99BC8 
+ 718      FFE89B
+ 719 2c2a C7FFE89A 		.ascii	"\307\377\350\232\307\377\350\232\306\377\350\231\306\377\350"
+ 719      C7FFE89A 
+ 719      C6FFE899 
+ 719      C6FFE8
+ 720 2c39 98C6FFE7 		.ascii	"\230\306\377\347\230\305\377\347\227\305\377\347\227\304\377"
+ 720      98C5FFE7 
+ 720      97C5FFE7 
+ 720      97C4FF
+ 721 2c48 E796C4FF 		.ascii	"\347\226\304\377\347\225\303\377\347\225\303\377\346\224\302"
+ 721      E795C3FF 
+ 721      E795C3FF 
+ 721      E694C2
+ 722 2c57 FFE693C2 		.ascii	"\377\346\223\302\377\346\223\302\377\346\222\301\377\346\222"
+ 722      FFE693C2 
+ 722      FFE692C1 
+ 722      FFE692
+ 723 2c66 C1FFE591 		.ascii	"\301\377\345\221\300\377\345\220\300\377\345\220\277\377\345"
+ 723      C0FFE590 
+ 723      C0FFE590 
+ 723      BFFFE5
+ 724 2c75 8FBFFFE5 		.ascii	"\217\277\377\345\217\277\377\345\216\276\377\344\215\276\377"
+ 724      8FBFFFE5 
+ 724      8EBEFFE4 
+ 724      8DBEFF
+ 725 2c84 E48DBDFF 		.ascii	"\344\215\275\377\344\214\275\377\344\213\274\377\344\213\274"
+ 725      E48CBDFF 
+ 725      E48BBCFF 
+ 725      E48BBC
+GAS LISTING /tmp/ccw8Qa8b.s 			page 54
+
+
+ 726 2c93 FFE38ABC 		.ascii	"\377\343\212\274\377\343\212\273\377\343\211\273\377\343\210"
+ 726      FFE38ABB 
+ 726      FFE389BB 
+ 726      FFE388
+ 727 2ca2 BAFFE388 		.ascii	"\272\377\343\210\272\377\342\207\271\377\342\206\271\377\342"
+ 727      BAFFE287 
+ 727      B9FFE286 
+ 727      B9FFE2
+ 728 2cb1 86B8FFE2 		.ascii	"\206\270\377\342\205\270\377\342\205\270\377\342\204\267\377"
+ 728      85B8FFE2 
+ 728      85B8FFE2 
+ 728      84B7FF
+ 729 2cc0 E183B7FF 		.ascii	"\341\203\267\377\341\203\266\377\341\202\266\377\341\201\265"
+ 729      E183B6FF 
+ 729      E182B6FF 
+ 729      E181B5
+ 730 2ccf FFE181B5 		.ascii	"\377\341\201\265\377\340\200\264\377\340\200\264\377\340\177"
+ 730      FFE080B4 
+ 730      FFE080B4 
+ 730      FFE07F
+ 731 2cde B3FFE07E 		.ascii	"\263\377\340~\263\377\340~\263\377\337}\262\377\337|\262\377"
+ 731      B3FFE07E 
+ 731      B3FFDF7D 
+ 731      B2FFDF7C 
+ 731      B2FF
+ 732 2cf0 DF7CB1FF 		.ascii	"\337|\261\377\337{\261\377\337z\260\377\337z\260\377\336y\257"
+ 732      DF7BB1FF 
+ 732      DF7AB0FF 
+ 732      DF7AB0FF 
+ 732      DE79AF
+ 733 2d03 FFDE79AF 		.ascii	"\377\336y\257\377\336x\257\377\336w\256\377\336w\256\377\335"
+ 733      FFDE78AF 
+ 733      FFDE77AE 
+ 733      FFDE77AE 
+ 733      FFDD
+ 734 2d15 76ADFFDD 		.ascii	"v\255\377\335u\255\377\335u\254\377\335t\254\377\334s\253\377"
+ 734      75ADFFDD 
+ 734      75ACFFDD 
+ 734      74ACFFDC 
+ 734      73ABFF
+ 735 2d28 DC72ABFF 		.ascii	"\334r\253\377\334r\252\377\334q\252\377\334p\251\377\333p\251"
+ 735      DC72AAFF 
+ 735      DC71AAFF 
+ 735      DC70A9FF 
+ 735      DB70A9
+ 736 2d3b FFDB6FA8 		.ascii	"\377\333o\250\377\333n\250\377\333m\250\377\332m\247\377\332"
+ 736      FFDB6EA8 
+ 736      FFDB6DA8 
+ 736      FFDA6DA7 
+ 736      FFDA
+ 737 2d4d 6CA7FFDA 		.ascii	"l\247\377\332k\246\377\332k\246\377\331j\245\377\331i\245\377"
+ 737      6BA6FFDA 
+ 737      6BA6FFD9 
+ 737      6AA5FFD9 
+ 737      69A5FF
+ 738 2d60 D968A4FF 		.ascii	"\331h\244\377\331h\244\377\331g\243\377\330f\243\377\330e\242"
+ 738      D968A4FF 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 55
+
+
+ 738      D967A3FF 
+ 738      D866A3FF 
+ 738      D865A2
+ 739 2d73 FFD865A2 		.ascii	"\377\330e\242\377\330d\241\377\327c\241\377\327b\240\377\327"
+ 739      FFD864A1 
+ 739      FFD763A1 
+ 739      FFD762A0 
+ 739      FFD7
+ 740 2d85 62A0FFD7 		.ascii	"b\240\377\327a\240\377\326`\237\377\326`\237\377\326_\236\377"
+ 740      61A0FFD6 
+ 740      609FFFD6 
+ 740      609FFFD6 
+ 740      5F9EFF
+ 741 2d98 D65E9EFF 		.ascii	"\326^\236\377\326]\235\377\325\\\235\377\325\\\234\377\325[\234"
+ 741      D65D9DFF 
+ 741      D55C9DFF 
+ 741      D55C9CFF 
+ 741      D55B9C
+ 742 2dab FFD55A9B 		.ascii	"\377\325Z\233\377\324Y\233\377\324Y\232\377\324X\232\377\324"
+ 742      FFD4599B 
+ 742      FFD4599A 
+ 742      FFD4589A 
+ 742      FFD4
+ 743 2dbd 5799FFD3 		.ascii	"W\231\377\323V\231\377\323V\230\377\323U\230\377\323T\227\377"
+ 743      5699FFD3 
+ 743      5698FFD3 
+ 743      5598FFD3 
+ 743      5497FF
+ 744 2dd0 D25397FF 		.ascii	"\322S\227\377\322R\226\377\322R\226\377\322Q\226\377\321P\225"
+ 744      D25296FF 
+ 744      D25296FF 
+ 744      D25196FF 
+ 744      D15095
+ 745 2de3 FFD14F95 		.ascii	"\377\321O\225\377\321N\224\377\321M\224\377\320M\223\377\320"
+ 745      FFD14E94 
+ 745      FFD14D94 
+ 745      FFD04D93 
+ 745      FFD0
+ 746 2df5 4C93FFD0 		.ascii	"L\223\377\320K\222\377\320J\222\377\317I\221\377\317H\221\377"
+ 746      4B92FFD0 
+ 746      4A92FFCF 
+ 746      4991FFCF 
+ 746      4891FF
+ 747 2e08 CF4890FF 		.ascii	"\317H\220\377\317G\220\377\316F\217\377\316E\217\377\316D\216"
+ 747      CF4790FF 
+ 747      CE468FFF 
+ 747      CE458FFF 
+ 747      CE448E
+ 748 2e1b FFCE438E 		.ascii	"\377\316C\216\377\315B\215\377\315A\215\377\315A\214\377\315"
+ 748      FFCD428D 
+ 748      FFCD418D 
+ 748      FFCD418C 
+ 748      FFCD
+ 749 2e2d 408CFFCC 		.ascii	"@\214\377\314?\213\377\314>\213\377\314=\212\377\314<\212\377"
+ 749      3F8BFFCC 
+ 749      3E8BFFCC 
+ 749      3D8AFFCC 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 56
+
+
+ 749      3C8AFF
+ 750 2e40 CB3B89FF 		.ascii	"\313;\211\377\313:\211\377\3139\211\377\3138\210\377\3127\210"
+ 750      CB3A89FF 
+ 750      CB3989FF 
+ 750      CB3888FF 
+ 750      CA3788
+ 751 2e53 FFCA3687 		.ascii	"\377\3126\207\377\3125\207\377\3124\206\377\3113\206\377\311"
+ 751      FFCA3587 
+ 751      FFCA3486 
+ 751      FFC93386 
+ 751      FFC9
+ 752 2e65 3285FFC9 		.ascii	"2\205\377\3111\205\377\3110\204\377\310.\204\377\310-\203\377"
+ 752      3185FFC9 
+ 752      3084FFC8 
+ 752      2E84FFC8 
+ 752      2D83FF
+ 753 2e78 C82C83FF 		.ascii	"\310,\203\377\310+\202\377\307*\202\377\307(\201\377\307'\201"
+ 753      C82B82FF 
+ 753      C72A82FF 
+ 753      C72881FF 
+ 753      C72781
+ 754 2e8b FFC72680 		.ascii	"\377\307&\200\377\306%\200\377\306#\177\377\306\"\177\377\305"
+ 754      FFC62580 
+ 754      FFC6237F 
+ 754      FFC6227F 
+ 754      FFC5
+ 755 2e9d 207EFFC5 		.ascii	" ~\377\305\037~\377\305\035}\377\305\034}\377\304\032|\377\304"
+ 755      1F7EFFC5 
+ 755      1D7DFFC5 
+ 755      1C7DFFC4 
+ 755      1A7CFFC4 
+ 756 2eb1 1A7CFFC3 		.ascii	"\032|\377\303\032{\377\303\032{\377\302\031{\377\302\031z\377"
+ 756      1A7BFFC3 
+ 756      1A7BFFC2 
+ 756      197BFFC2 
+ 756      197AFF
+ 757 2ec4 C1197AFF 		.ascii	"\301\031z\377\300\031y\377\300\030y\377\277\030x\377\277\030"
+ 757      C01979FF 
+ 757      C01879FF 
+ 757      BF1878FF 
+ 757      BF18
+ 758 2ed6 78FFBE18 		.ascii	"x\377\276\030w\377\276\027w\377\275\027w\377\275\027v\377\274"
+ 758      77FFBE17 
+ 758      77FFBD17 
+ 758      77FFBD17 
+ 758      76FFBC
+ 759 2ee9 1776FFBC 		.ascii	"\027v\377\274\026u\377\273\026u\377\272\026t\377\272\026t\377"
+ 759      1675FFBB 
+ 759      1675FFBA 
+ 759      1674FFBA 
+ 759      1674FF
+ 760 2efc B91574FF 		.ascii	"\271\025t\377\271\025s\377\270\025s\377\270\025r\377\267\024"
+ 760      B91573FF 
+ 760      B81573FF 
+ 760      B81572FF 
+ 760      B714
+ 761 2f0e 72FFB714 		.ascii	"r\377\267\024q\377\266\024q\377\266\024p\377\265\023p\377\265"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 57
+
+
+ 761      71FFB614 
+ 761      71FFB614 
+ 761      70FFB513 
+ 761      70FFB5
+ 762 2f21 1370FFB4 		.ascii	"\023p\377\264\023o\377\263\023o\377\263\022n\377\262\022n\377"
+ 762      136FFFB3 
+ 762      136FFFB3 
+ 762      126EFFB2 
+ 762      126EFF
+ 763 2f34 B2126DFF 		.ascii	"\262\022m\377\261\022m\377\261\021m\377\260\021l\377\260\021"
+ 763      B1126DFF 
+ 763      B1116DFF 
+ 763      B0116CFF 
+ 763      B011
+ 764 2f46 6CFFAF11 		.ascii	"l\377\257\021k\377\257\020k\377\256\020j\377\255\020j\377\255"
+ 764      6BFFAF10 
+ 764      6BFFAE10 
+ 764      6AFFAD10 
+ 764      6AFFAD
+ 765 2f59 106AFFAC 		.ascii	"\020j\377\254\017i\377\254\017i\377\253\017h\377\253\016h\377"
+ 765      0F69FFAC 
+ 765      0F69FFAB 
+ 765      0F68FFAB 
+ 765      0E68FF
+ 766 2f6c AA0E68FF 		.ascii	"\252\016h\377\252\016g\377\251\016g\377\251\rf\377\250\rf\377"
+ 766      AA0E67FF 
+ 766      A90E67FF 
+ 766      A90D66FF 
+ 766      A80D66FF 
+ 767 2f80 A80D65FF 		.ascii	"\250\re\377\247\re\377\246\fe\377\246\fd\377\245\fd\377\245\013"
+ 767      A70D65FF 
+ 767      A60C65FF 
+ 767      A60C64FF 
+ 767      A50C64FF 
+ 768 2f96 63FFA40B 		.ascii	"c\377\244\013c\377\244\013b\377\243\013b\377\243\nb\377\242\n"
+ 768      63FFA40B 
+ 768      62FFA30B 
+ 768      62FFA30A 
+ 768      62FFA20A 
+ 769 2faa 61FFA20A 		.ascii	"a\377\242\na\377\241\t`\377\241\t`\377\240\t`\377\240\t_\377"
+ 769      61FFA109 
+ 769      60FFA109 
+ 769      60FFA009 
+ 769      60FFA009 
+ 770 2fc0 9F085FFF 		.ascii	"\237\b_\377\236\b^\377\236\b^\377\235\007^\377\235\007]\377\234"
+ 770      9E085EFF 
+ 770      9E085EFF 
+ 770      9D075EFF 
+ 770      9D075DFF 
+ 771 2fd5 075DFF9C 		.ascii	"\007]\377\234\007\\\377\233\006\\\377"
+ 771      075CFF9B 
+ 771      065CFF
+ 772 2fe0 9B065BFF 		.ascii	"\233\006[\377\232\006[\377\232\006[\377\231\005Z\377\231\005"
+ 772      9A065BFF 
+ 772      9A065BFF 
+ 772      99055AFF 
+ 772      9905
+GAS LISTING /tmp/ccw8Qa8b.s 			page 58
+
+
+ 773 2ff2 5AFF9805 		.ascii	"Z\377\230\005Y\377\230\005Y\377\227\004Y\377\226\004X\377\226"
+ 773      59FF9805 
+ 773      59FF9704 
+ 773      59FF9604 
+ 773      58FF96
+ 774 3005 0458FF95 		.ascii	"\004X\377\225\004W\377\225\003W\377\224\003W\377\224\003V\377"
+ 774      0457FF95 
+ 774      0357FF94 
+ 774      0357FF94 
+ 774      0356FF
+ 775 3018 930356FF 		.ascii	"\223\003V\377\223\003U\377\222\002U\377\222\002U\377\221\002"
+ 775      930355FF 
+ 775      920255FF 
+ 775      920255FF 
+ 775      9102
+ 776 302a 54FF9102 		.ascii	"T\377\221\002T\377\220\002S\377\220\001S\377\217\001S\377\217"
+ 776      54FF9002 
+ 776      53FF9001 
+ 776      53FF8F01 
+ 776      53FF8F
+ 777 303d 0152FF8E 		.ascii	"\001R\377\216\001R\377"
+ 777      0152FF
+ 778              		.globl	heatmap_cs_PiYG_discrete
+ 779              		.section	.data.rel.local
+ 780              		.align 8
+ 781              		.type	heatmap_cs_PiYG_discrete, @object
+ 782              		.size	heatmap_cs_PiYG_discrete, 8
+ 783              	heatmap_cs_PiYG_discrete:
+ 784 0018 00000000 		.quad	discrete
+ 784      00000000 
+ 785              		.section	.data.rel.ro.local
+ 786              		.align 16
+ 787              		.type	discrete, @object
+ 788              		.size	discrete, 16
+ 789              	discrete:
+ 790 0030 00000000 		.quad	discrete_data
+ 790      00000000 
+ 791 0038 0C000000 		.quad	12
+ 791      00000000 
+ 792              		.section	.rodata
+ 793 3044 00000000 		.align 32
+ 793      00000000 
+ 793      00000000 
+ 793      00000000 
+ 793      00000000 
+ 794              		.type	discrete_data, @object
+ 795              		.size	discrete_data, 48
+ 796              	discrete_data:
+ 797 3060 00       		.string	""
+ 798 3061 00       		.string	""
+ 799 3062 00       		.string	""
+ 800 3063 00       		.string	""
+ 801 3064 276419FF 		.ascii	"'d\031\377M\222!\377\177\274A\377\270\341\206\377\346\365\320"
+ 801      4D9221FF 
+ 801      7FBC41FF 
+ 801      B8E186FF 
+ 801      E6F5D0
+GAS LISTING /tmp/ccw8Qa8b.s 			page 59
+
+
+ 802 3077 FFF7F7F7 		.ascii	"\377\367\367\367\377\375\340\357\377\361\266\332\377\336w\256"
+ 802      FFFDE0EF 
+ 802      FFF1B6DA 
+ 802      FFDE77AE 
+ 803 3087 FFC51B7D 		.ascii	"\377\305\033}\377\216\001R\377"
+ 803      FF8E0152 
+ 803      FF
+ 804              		.text
+ 805              	.Letext0:
+ 806              		.file 1 "./heatmap.h"
+ 807              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 808              		.file 3 "./colorschemes/PiYG.h"
+ 809              		.file 4 "colorschemes/PiYG.c"
+ 810              		.section	.debug_info,"",@progbits
+ 811              	.Ldebug_info0:
+ 812 0000 E3010000 		.long	0x1e3
+ 813 0004 0500     		.value	0x5
+ 814 0006 01       		.byte	0x1
+ 815 0007 08       		.byte	0x8
+ 816 0008 00000000 		.long	.Ldebug_abbrev0
+ 817 000c 0A       		.uleb128 0xa
+ 818 000d 00000000 		.long	.LASF26
+ 819 0011 1D       		.byte	0x1d
+ 820 0012 00000000 		.long	.LASF0
+ 821 0016 00000000 		.long	.LASF1
+ 822 001a 00000000 		.long	.Ldebug_line0
+ 823 001e 01       		.uleb128 0x1
+ 824 001f 08       		.byte	0x8
+ 825 0020 05       		.byte	0x5
+ 826 0021 00000000 		.long	.LASF2
+ 827 0025 06       		.uleb128 0x6
+ 828 0026 00000000 		.long	.LASF12
+ 829 002a 02       		.byte	0x2
+ 830 002b D6       		.byte	0xd6
+ 831 002c 17       		.byte	0x17
+ 832 002d 31000000 		.long	0x31
+ 833 0031 01       		.uleb128 0x1
+ 834 0032 08       		.byte	0x8
+ 835 0033 07       		.byte	0x7
+ 836 0034 00000000 		.long	.LASF3
+ 837 0038 0B       		.uleb128 0xb
+ 838 0039 04       		.byte	0x4
+ 839 003a 05       		.byte	0x5
+ 840 003b 696E7400 		.string	"int"
+ 841 003f 01       		.uleb128 0x1
+ 842 0040 08       		.byte	0x8
+ 843 0041 05       		.byte	0x5
+ 844 0042 00000000 		.long	.LASF4
+ 845 0046 01       		.uleb128 0x1
+ 846 0047 10       		.byte	0x10
+ 847 0048 04       		.byte	0x4
+ 848 0049 00000000 		.long	.LASF5
+ 849 004d 01       		.uleb128 0x1
+ 850 004e 04       		.byte	0x4
+ 851 004f 04       		.byte	0x4
+ 852 0050 00000000 		.long	.LASF6
+ 853 0054 01       		.uleb128 0x1
+GAS LISTING /tmp/ccw8Qa8b.s 			page 60
+
+
+ 854 0055 04       		.byte	0x4
+ 855 0056 07       		.byte	0x7
+ 856 0057 00000000 		.long	.LASF7
+ 857 005b 01       		.uleb128 0x1
+ 858 005c 02       		.byte	0x2
+ 859 005d 07       		.byte	0x7
+ 860 005e 00000000 		.long	.LASF8
+ 861 0062 0C       		.uleb128 0xc
+ 862 0063 10       		.byte	0x10
+ 863 0064 01       		.byte	0x1
+ 864 0065 BB       		.byte	0xbb
+ 865 0066 09       		.byte	0x9
+ 866 0067 84000000 		.long	0x84
+ 867 006b 07       		.uleb128 0x7
+ 868 006c 00000000 		.long	.LASF9
+ 869 0070 BC       		.byte	0xbc
+ 870 0071 1A       		.byte	0x1a
+ 871 0072 84000000 		.long	0x84
+ 872 0076 00       		.byte	0
+ 873 0077 07       		.uleb128 0x7
+ 874 0078 00000000 		.long	.LASF10
+ 875 007c BD       		.byte	0xbd
+ 876 007d 0C       		.byte	0xc
+ 877 007e 25000000 		.long	0x25
+ 878 0082 08       		.byte	0x8
+ 879 0083 00       		.byte	0
+ 880 0084 08       		.uleb128 0x8
+ 881 0085 90000000 		.long	0x90
+ 882 0089 01       		.uleb128 0x1
+ 883 008a 01       		.byte	0x1
+ 884 008b 08       		.byte	0x8
+ 885 008c 00000000 		.long	.LASF11
+ 886 0090 03       		.uleb128 0x3
+ 887 0091 89000000 		.long	0x89
+ 888 0095 06       		.uleb128 0x6
+ 889 0096 00000000 		.long	.LASF13
+ 890 009a 01       		.byte	0x1
+ 891 009b BE       		.byte	0xbe
+ 892 009c 03       		.byte	0x3
+ 893 009d 62000000 		.long	0x62
+ 894 00a1 03       		.uleb128 0x3
+ 895 00a2 95000000 		.long	0x95
+ 896 00a6 08       		.uleb128 0x8
+ 897 00a7 A1000000 		.long	0xa1
+ 898 00ab 04       		.uleb128 0x4
+ 899 00ac 00000000 		.long	.LASF14
+ 900 00b0 21       		.byte	0x21
+ 901 00b1 A6000000 		.long	0xa6
+ 902 00b5 04       		.uleb128 0x4
+ 903 00b6 00000000 		.long	.LASF15
+ 904 00ba 23       		.byte	0x23
+ 905 00bb A6000000 		.long	0xa6
+ 906 00bf 04       		.uleb128 0x4
+ 907 00c0 00000000 		.long	.LASF16
+ 908 00c4 25       		.byte	0x25
+ 909 00c5 A6000000 		.long	0xa6
+ 910 00c9 04       		.uleb128 0x4
+GAS LISTING /tmp/ccw8Qa8b.s 			page 61
+
+
+ 911 00ca 00000000 		.long	.LASF17
+ 912 00ce 28       		.byte	0x28
+ 913 00cf A6000000 		.long	0xa6
+ 914 00d3 09       		.uleb128 0x9
+ 915 00d4 90000000 		.long	0x90
+ 916 00d8 E3000000 		.long	0xe3
+ 917 00dc 0D       		.uleb128 0xd
+ 918 00dd 31000000 		.long	0x31
+ 919 00e1 2F       		.byte	0x2f
+ 920 00e2 00       		.byte	0
+ 921 00e3 03       		.uleb128 0x3
+ 922 00e4 D3000000 		.long	0xd3
+ 923 00e8 02       		.uleb128 0x2
+ 924 00e9 00000000 		.long	.LASF18
+ 925 00ed 20       		.byte	0x20
+ 926 00ee 1C       		.byte	0x1c
+ 927 00ef E3000000 		.long	0xe3
+ 928 00f3 09       		.uleb128 0x9
+ 929 00f4 03       		.byte	0x3
+ 930 00f5 00000000 		.quad	discrete_data
+ 930      00000000 
+ 931 00fd 02       		.uleb128 0x2
+ 932 00fe 00000000 		.long	.LASF19
+ 933 0102 23       		.byte	0x23
+ 934 0103 24       		.byte	0x24
+ 935 0104 A1000000 		.long	0xa1
+ 936 0108 09       		.uleb128 0x9
+ 937 0109 03       		.byte	0x3
+ 938 010a 00000000 		.quad	discrete
+ 938      00000000 
+ 939 0112 05       		.uleb128 0x5
+ 940 0113 AB000000 		.long	0xab
+ 941 0117 24       		.byte	0x24
+ 942 0118 09       		.uleb128 0x9
+ 943 0119 03       		.byte	0x3
+ 944 011a 00000000 		.quad	heatmap_cs_PiYG_discrete
+ 944      00000000 
+ 945 0122 09       		.uleb128 0x9
+ 946 0123 90000000 		.long	0x90
+ 947 0127 33010000 		.long	0x133
+ 948 012b 0E       		.uleb128 0xe
+ 949 012c 31000000 		.long	0x31
+ 950 0130 0310     		.value	0x1003
+ 951 0132 00       		.byte	0
+ 952 0133 03       		.uleb128 0x3
+ 953 0134 22010000 		.long	0x122
+ 954 0138 02       		.uleb128 0x2
+ 955 0139 00000000 		.long	.LASF20
+ 956 013d 26       		.byte	0x26
+ 957 013e 1C       		.byte	0x1c
+ 958 013f 33010000 		.long	0x133
+ 959 0143 09       		.uleb128 0x9
+ 960 0144 03       		.byte	0x3
+ 961 0145 00000000 		.quad	soft_data
+ 961      00000000 
+ 962 014d 02       		.uleb128 0x2
+ 963 014e 00000000 		.long	.LASF21
+GAS LISTING /tmp/ccw8Qa8b.s 			page 62
+
+
+ 964 0152 29       		.byte	0x29
+ 965 0153 24       		.byte	0x24
+ 966 0154 A1000000 		.long	0xa1
+ 967 0158 09       		.uleb128 0x9
+ 968 0159 03       		.byte	0x3
+ 969 015a 00000000 		.quad	soft
+ 969      00000000 
+ 970 0162 05       		.uleb128 0x5
+ 971 0163 B5000000 		.long	0xb5
+ 972 0167 2A       		.byte	0x2a
+ 973 0168 09       		.uleb128 0x9
+ 974 0169 03       		.byte	0x3
+ 975 016a 00000000 		.quad	heatmap_cs_PiYG_soft
+ 975      00000000 
+ 976 0172 02       		.uleb128 0x2
+ 977 0173 00000000 		.long	.LASF22
+ 978 0177 2C       		.byte	0x2c
+ 979 0178 1C       		.byte	0x1c
+ 980 0179 33010000 		.long	0x133
+ 981 017d 09       		.uleb128 0x9
+ 982 017e 03       		.byte	0x3
+ 983 017f 00000000 		.quad	mixed_data
+ 983      00000000 
+ 984 0187 02       		.uleb128 0x2
+ 985 0188 00000000 		.long	.LASF23
+ 986 018c 2F       		.byte	0x2f
+ 987 018d 24       		.byte	0x24
+ 988 018e A1000000 		.long	0xa1
+ 989 0192 09       		.uleb128 0x9
+ 990 0193 03       		.byte	0x3
+ 991 0194 00000000 		.quad	mixed
+ 991      00000000 
+ 992 019c 05       		.uleb128 0x5
+ 993 019d BF000000 		.long	0xbf
+ 994 01a1 30       		.byte	0x30
+ 995 01a2 09       		.uleb128 0x9
+ 996 01a3 03       		.byte	0x3
+ 997 01a4 00000000 		.quad	heatmap_cs_PiYG_mixed
+ 997      00000000 
+ 998 01ac 02       		.uleb128 0x2
+ 999 01ad 00000000 		.long	.LASF24
+ 1000 01b1 32       		.byte	0x32
+ 1001 01b2 1C       		.byte	0x1c
+ 1002 01b3 33010000 		.long	0x133
+ 1003 01b7 09       		.uleb128 0x9
+ 1004 01b8 03       		.byte	0x3
+ 1005 01b9 00000000 		.quad	mixed_exp_data
+ 1005      00000000 
+ 1006 01c1 02       		.uleb128 0x2
+ 1007 01c2 00000000 		.long	.LASF25
+ 1008 01c6 35       		.byte	0x35
+ 1009 01c7 24       		.byte	0x24
+ 1010 01c8 A1000000 		.long	0xa1
+ 1011 01cc 09       		.uleb128 0x9
+ 1012 01cd 03       		.byte	0x3
+ 1013 01ce 00000000 		.quad	mixed_exp
+ 1013      00000000 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 63
+
+
+ 1014 01d6 05       		.uleb128 0x5
+ 1015 01d7 C9000000 		.long	0xc9
+ 1016 01db 36       		.byte	0x36
+ 1017 01dc 09       		.uleb128 0x9
+ 1018 01dd 03       		.byte	0x3
+ 1019 01de 00000000 		.quad	heatmap_cs_PiYG_mixed_exp
+ 1019      00000000 
+ 1020 01e6 00       		.byte	0
+ 1021              		.section	.debug_abbrev,"",@progbits
+ 1022              	.Ldebug_abbrev0:
+ 1023 0000 01       		.uleb128 0x1
+ 1024 0001 24       		.uleb128 0x24
+ 1025 0002 00       		.byte	0
+ 1026 0003 0B       		.uleb128 0xb
+ 1027 0004 0B       		.uleb128 0xb
+ 1028 0005 3E       		.uleb128 0x3e
+ 1029 0006 0B       		.uleb128 0xb
+ 1030 0007 03       		.uleb128 0x3
+ 1031 0008 0E       		.uleb128 0xe
+ 1032 0009 00       		.byte	0
+ 1033 000a 00       		.byte	0
+ 1034 000b 02       		.uleb128 0x2
+ 1035 000c 34       		.uleb128 0x34
+ 1036 000d 00       		.byte	0
+ 1037 000e 03       		.uleb128 0x3
+ 1038 000f 0E       		.uleb128 0xe
+ 1039 0010 3A       		.uleb128 0x3a
+ 1040 0011 21       		.uleb128 0x21
+ 1041 0012 04       		.sleb128 4
+ 1042 0013 3B       		.uleb128 0x3b
+ 1043 0014 0B       		.uleb128 0xb
+ 1044 0015 39       		.uleb128 0x39
+ 1045 0016 0B       		.uleb128 0xb
+ 1046 0017 49       		.uleb128 0x49
+ 1047 0018 13       		.uleb128 0x13
+ 1048 0019 02       		.uleb128 0x2
+ 1049 001a 18       		.uleb128 0x18
+ 1050 001b 00       		.byte	0
+ 1051 001c 00       		.byte	0
+ 1052 001d 03       		.uleb128 0x3
+ 1053 001e 26       		.uleb128 0x26
+ 1054 001f 00       		.byte	0
+ 1055 0020 49       		.uleb128 0x49
+ 1056 0021 13       		.uleb128 0x13
+ 1057 0022 00       		.byte	0
+ 1058 0023 00       		.byte	0
+ 1059 0024 04       		.uleb128 0x4
+ 1060 0025 34       		.uleb128 0x34
+ 1061 0026 00       		.byte	0
+ 1062 0027 03       		.uleb128 0x3
+ 1063 0028 0E       		.uleb128 0xe
+ 1064 0029 3A       		.uleb128 0x3a
+ 1065 002a 21       		.uleb128 0x21
+ 1066 002b 03       		.sleb128 3
+ 1067 002c 3B       		.uleb128 0x3b
+ 1068 002d 0B       		.uleb128 0xb
+ 1069 002e 39       		.uleb128 0x39
+GAS LISTING /tmp/ccw8Qa8b.s 			page 64
+
+
+ 1070 002f 21       		.uleb128 0x21
+ 1071 0030 25       		.sleb128 37
+ 1072 0031 49       		.uleb128 0x49
+ 1073 0032 13       		.uleb128 0x13
+ 1074 0033 3F       		.uleb128 0x3f
+ 1075 0034 19       		.uleb128 0x19
+ 1076 0035 3C       		.uleb128 0x3c
+ 1077 0036 19       		.uleb128 0x19
+ 1078 0037 00       		.byte	0
+ 1079 0038 00       		.byte	0
+ 1080 0039 05       		.uleb128 0x5
+ 1081 003a 34       		.uleb128 0x34
+ 1082 003b 00       		.byte	0
+ 1083 003c 47       		.uleb128 0x47
+ 1084 003d 13       		.uleb128 0x13
+ 1085 003e 3A       		.uleb128 0x3a
+ 1086 003f 21       		.uleb128 0x21
+ 1087 0040 04       		.sleb128 4
+ 1088 0041 3B       		.uleb128 0x3b
+ 1089 0042 0B       		.uleb128 0xb
+ 1090 0043 39       		.uleb128 0x39
+ 1091 0044 21       		.uleb128 0x21
+ 1092 0045 1E       		.sleb128 30
+ 1093 0046 02       		.uleb128 0x2
+ 1094 0047 18       		.uleb128 0x18
+ 1095 0048 00       		.byte	0
+ 1096 0049 00       		.byte	0
+ 1097 004a 06       		.uleb128 0x6
+ 1098 004b 16       		.uleb128 0x16
+ 1099 004c 00       		.byte	0
+ 1100 004d 03       		.uleb128 0x3
+ 1101 004e 0E       		.uleb128 0xe
+ 1102 004f 3A       		.uleb128 0x3a
+ 1103 0050 0B       		.uleb128 0xb
+ 1104 0051 3B       		.uleb128 0x3b
+ 1105 0052 0B       		.uleb128 0xb
+ 1106 0053 39       		.uleb128 0x39
+ 1107 0054 0B       		.uleb128 0xb
+ 1108 0055 49       		.uleb128 0x49
+ 1109 0056 13       		.uleb128 0x13
+ 1110 0057 00       		.byte	0
+ 1111 0058 00       		.byte	0
+ 1112 0059 07       		.uleb128 0x7
+ 1113 005a 0D       		.uleb128 0xd
+ 1114 005b 00       		.byte	0
+ 1115 005c 03       		.uleb128 0x3
+ 1116 005d 0E       		.uleb128 0xe
+ 1117 005e 3A       		.uleb128 0x3a
+ 1118 005f 21       		.uleb128 0x21
+ 1119 0060 01       		.sleb128 1
+ 1120 0061 3B       		.uleb128 0x3b
+ 1121 0062 0B       		.uleb128 0xb
+ 1122 0063 39       		.uleb128 0x39
+ 1123 0064 0B       		.uleb128 0xb
+ 1124 0065 49       		.uleb128 0x49
+ 1125 0066 13       		.uleb128 0x13
+ 1126 0067 38       		.uleb128 0x38
+GAS LISTING /tmp/ccw8Qa8b.s 			page 65
+
+
+ 1127 0068 0B       		.uleb128 0xb
+ 1128 0069 00       		.byte	0
+ 1129 006a 00       		.byte	0
+ 1130 006b 08       		.uleb128 0x8
+ 1131 006c 0F       		.uleb128 0xf
+ 1132 006d 00       		.byte	0
+ 1133 006e 0B       		.uleb128 0xb
+ 1134 006f 21       		.uleb128 0x21
+ 1135 0070 08       		.sleb128 8
+ 1136 0071 49       		.uleb128 0x49
+ 1137 0072 13       		.uleb128 0x13
+ 1138 0073 00       		.byte	0
+ 1139 0074 00       		.byte	0
+ 1140 0075 09       		.uleb128 0x9
+ 1141 0076 01       		.uleb128 0x1
+ 1142 0077 01       		.byte	0x1
+ 1143 0078 49       		.uleb128 0x49
+ 1144 0079 13       		.uleb128 0x13
+ 1145 007a 01       		.uleb128 0x1
+ 1146 007b 13       		.uleb128 0x13
+ 1147 007c 00       		.byte	0
+ 1148 007d 00       		.byte	0
+ 1149 007e 0A       		.uleb128 0xa
+ 1150 007f 11       		.uleb128 0x11
+ 1151 0080 01       		.byte	0x1
+ 1152 0081 25       		.uleb128 0x25
+ 1153 0082 0E       		.uleb128 0xe
+ 1154 0083 13       		.uleb128 0x13
+ 1155 0084 0B       		.uleb128 0xb
+ 1156 0085 03       		.uleb128 0x3
+ 1157 0086 1F       		.uleb128 0x1f
+ 1158 0087 1B       		.uleb128 0x1b
+ 1159 0088 1F       		.uleb128 0x1f
+ 1160 0089 10       		.uleb128 0x10
+ 1161 008a 17       		.uleb128 0x17
+ 1162 008b 00       		.byte	0
+ 1163 008c 00       		.byte	0
+ 1164 008d 0B       		.uleb128 0xb
+ 1165 008e 24       		.uleb128 0x24
+ 1166 008f 00       		.byte	0
+ 1167 0090 0B       		.uleb128 0xb
+ 1168 0091 0B       		.uleb128 0xb
+ 1169 0092 3E       		.uleb128 0x3e
+ 1170 0093 0B       		.uleb128 0xb
+ 1171 0094 03       		.uleb128 0x3
+ 1172 0095 08       		.uleb128 0x8
+ 1173 0096 00       		.byte	0
+ 1174 0097 00       		.byte	0
+ 1175 0098 0C       		.uleb128 0xc
+ 1176 0099 13       		.uleb128 0x13
+ 1177 009a 01       		.byte	0x1
+ 1178 009b 0B       		.uleb128 0xb
+ 1179 009c 0B       		.uleb128 0xb
+ 1180 009d 3A       		.uleb128 0x3a
+ 1181 009e 0B       		.uleb128 0xb
+ 1182 009f 3B       		.uleb128 0x3b
+ 1183 00a0 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccw8Qa8b.s 			page 66
+
+
+ 1184 00a1 39       		.uleb128 0x39
+ 1185 00a2 0B       		.uleb128 0xb
+ 1186 00a3 01       		.uleb128 0x1
+ 1187 00a4 13       		.uleb128 0x13
+ 1188 00a5 00       		.byte	0
+ 1189 00a6 00       		.byte	0
+ 1190 00a7 0D       		.uleb128 0xd
+ 1191 00a8 21       		.uleb128 0x21
+ 1192 00a9 00       		.byte	0
+ 1193 00aa 49       		.uleb128 0x49
+ 1194 00ab 13       		.uleb128 0x13
+ 1195 00ac 2F       		.uleb128 0x2f
+ 1196 00ad 0B       		.uleb128 0xb
+ 1197 00ae 00       		.byte	0
+ 1198 00af 00       		.byte	0
+ 1199 00b0 0E       		.uleb128 0xe
+ 1200 00b1 21       		.uleb128 0x21
+ 1201 00b2 00       		.byte	0
+ 1202 00b3 49       		.uleb128 0x49
+ 1203 00b4 13       		.uleb128 0x13
+ 1204 00b5 2F       		.uleb128 0x2f
+ 1205 00b6 05       		.uleb128 0x5
+ 1206 00b7 00       		.byte	0
+ 1207 00b8 00       		.byte	0
+ 1208 00b9 00       		.byte	0
+ 1209              		.section	.debug_aranges,"",@progbits
+ 1210 0000 1C000000 		.long	0x1c
+ 1211 0004 0200     		.value	0x2
+ 1212 0006 00000000 		.long	.Ldebug_info0
+ 1213 000a 08       		.byte	0x8
+ 1214 000b 00       		.byte	0
+ 1215 000c 0000     		.value	0
+ 1216 000e 0000     		.value	0
+ 1217 0010 00000000 		.quad	0
+ 1217      00000000 
+ 1218 0018 00000000 		.quad	0
+ 1218      00000000 
+ 1219              		.section	.debug_line,"",@progbits
+ 1220              	.Ldebug_line0:
+ 1221 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1221      05000800 
+ 1221      49000000 
+ 1221      010101FB 
+ 1221      0E0D0001 
+ 1222              	.LASF16:
+ 1223 0000 68656174 		.string	"heatmap_cs_PiYG_mixed"
+ 1223      6D61705F 
+ 1223      63735F50 
+ 1223      6959475F 
+ 1223      6D697865 
+ 1224              	.LASF12:
+ 1225 0016 73697A65 		.string	"size_t"
+ 1225      5F7400
+ 1226              	.LASF13:
+ 1227 001d 68656174 		.string	"heatmap_colorscheme_t"
+ 1227      6D61705F 
+ 1227      636F6C6F 
+GAS LISTING /tmp/ccw8Qa8b.s 			page 67
+
+
+ 1227      72736368 
+ 1227      656D655F 
+ 1228              	.LASF15:
+ 1229 0033 68656174 		.string	"heatmap_cs_PiYG_soft"
+ 1229      6D61705F 
+ 1229      63735F50 
+ 1229      6959475F 
+ 1229      736F6674 
+ 1230              	.LASF26:
+ 1231 0048 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1231      43313720 
+ 1231      31322E32 
+ 1231      2E30202D 
+ 1231      6D74756E 
+ 1232              	.LASF6:
+ 1233 00a7 666C6F61 		.string	"float"
+ 1233      7400
+ 1234              	.LASF11:
+ 1235 00ad 756E7369 		.string	"unsigned char"
+ 1235      676E6564 
+ 1235      20636861 
+ 1235      7200
+ 1236              	.LASF3:
+ 1237 00bb 6C6F6E67 		.string	"long unsigned int"
+ 1237      20756E73 
+ 1237      69676E65 
+ 1237      6420696E 
+ 1237      7400
+ 1238              	.LASF8:
+ 1239 00cd 73686F72 		.string	"short unsigned int"
+ 1239      7420756E 
+ 1239      7369676E 
+ 1239      65642069 
+ 1239      6E7400
+ 1240              	.LASF25:
+ 1241 00e0 6D697865 		.string	"mixed_exp"
+ 1241      645F6578 
+ 1241      7000
+ 1242              	.LASF23:
+ 1243 00ea 6D697865 		.string	"mixed"
+ 1243      6400
+ 1244              	.LASF7:
+ 1245 00f0 756E7369 		.string	"unsigned int"
+ 1245      676E6564 
+ 1245      20696E74 
+ 1245      00
+ 1246              	.LASF19:
+ 1247 00fd 64697363 		.string	"discrete"
+ 1247      72657465 
+ 1247      00
+ 1248              	.LASF17:
+ 1249 0106 68656174 		.string	"heatmap_cs_PiYG_mixed_exp"
+ 1249      6D61705F 
+ 1249      63735F50 
+ 1249      6959475F 
+ 1249      6D697865 
+ 1250              	.LASF14:
+GAS LISTING /tmp/ccw8Qa8b.s 			page 68
+
+
+ 1251 0120 68656174 		.string	"heatmap_cs_PiYG_discrete"
+ 1251      6D61705F 
+ 1251      63735F50 
+ 1251      6959475F 
+ 1251      64697363 
+ 1252              	.LASF20:
+ 1253 0139 736F6674 		.string	"soft_data"
+ 1253      5F646174 
+ 1253      6100
+ 1254              	.LASF10:
+ 1255 0143 6E636F6C 		.string	"ncolors"
+ 1255      6F727300 
+ 1256              	.LASF4:
+ 1257 014b 6C6F6E67 		.string	"long long int"
+ 1257      206C6F6E 
+ 1257      6720696E 
+ 1257      7400
+ 1258              	.LASF24:
+ 1259 0159 6D697865 		.string	"mixed_exp_data"
+ 1259      645F6578 
+ 1259      705F6461 
+ 1259      746100
+ 1260              	.LASF22:
+ 1261 0168 6D697865 		.string	"mixed_data"
+ 1261      645F6461 
+ 1261      746100
+ 1262              	.LASF2:
+ 1263 0173 6C6F6E67 		.string	"long int"
+ 1263      20696E74 
+ 1263      00
+ 1264              	.LASF5:
+ 1265 017c 6C6F6E67 		.string	"long double"
+ 1265      20646F75 
+ 1265      626C6500 
+ 1266              	.LASF18:
+ 1267 0188 64697363 		.string	"discrete_data"
+ 1267      72657465 
+ 1267      5F646174 
+ 1267      6100
+ 1268              	.LASF21:
+ 1269 0196 736F6674 		.string	"soft"
+ 1269      00
+ 1270              	.LASF9:
+ 1271 019b 636F6C6F 		.string	"colors"
+ 1271      727300
+ 1272              		.section	.debug_line_str,"MS",@progbits,1
+ 1273              	.LASF1:
+ 1274 0000 2F726F6F 		.string	"/root/repo"
+ 1274      742F7265 
+ 1274      706F00
+ 1275              	.LASF0:
+ 1276 000b 636F6C6F 		.string	"colorschemes/PiYG.c"
+ 1276      72736368 
+ 1276      656D6573 
+ 1276      2F506959 
+ 1276      472E6300 
+ 1277              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+GAS LISTING /tmp/ccw8Qa8b.s 			page 69
+
+
+ 1278 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1278      742F7265 
+ 1278      706F0063 
+ 1278      6F6C6F72 
+ 1278      73636865 
@@ -0,0 +1,4132 @@
+GAS LISTING /tmp/cct9A39C.s 			page 1
+
+
+   1              		.file	"PuBu.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/PuBu.c"
+   5              		.globl	heatmap_cs_PuBu_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_PuBu_mixed_exp, @object
+   9              		.size	heatmap_cs_PuBu_mixed_exp, 8
+  10              	heatmap_cs_PuBu_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 02375800 		.string	"\0027X"
+  29 0008 013A5B18 		.ascii	"\001:[\030\001<^1\001>aJ\001@dc\001Bg|\001Dj\225\002Mx\256\002"
+  29      013C5E31 
+  29      013E614A 
+  29      01406463 
+  29      0142677C 
+  30 0025 4F7BC702 		.ascii	"O{\307\002P~\340\002R\201\371\003T\205\377\003V\210\377\003X"
+  30      507EE002 
+  30      5281F903 
+  30      5485FF03 
+  30      5688FF03 
+  31 003a 8BFF035A 		.ascii	"\213\377\003Z\215\377\003[\217\377\003\\\221\377\003^\223\377"
+  31      8DFF035B 
+  31      8FFF035C 
+  31      91FF035E 
+  31      93FF
+  32 004c 035F95FF 		.ascii	"\003_\225\377\003`\227\377\003a\230\377\003b\232\377\004h\243"
+  32      036097FF 
+  32      036198FF 
+  32      03629AFF 
+  32      0468A3
+  33 005f FF0469A5 		.ascii	"\377\004i\245\377\004j\247\377\004k\250\377\004l\252\377\004"
+  33      FF046AA7 
+  33      FF046BA8 
+  33      FF046CAA 
+  33      FF04
+  34 0071 6DACFF04 		.ascii	"m\254\377\004n\256\377\004o\257\377\007q\260\377\ns\261\377\r"
+GAS LISTING /tmp/cct9A39C.s 			page 2
+
+
+  34      6EAEFF04 
+  34      6FAFFF07 
+  34      71B0FF0A 
+  34      73B1FF0D 
+  35 0085 74B2FF0F 		.ascii	"t\262\377\017v\263\377\021w\264\377\024y\264\377\026z\265\377"
+  35      76B3FF11 
+  35      77B4FF14 
+  35      79B4FF16 
+  35      7AB5FF
+  36 0098 187BB6FF 		.ascii	"\030{\266\377$\203\272\377&\205\272\377(\206\273\377*\207\274"
+  36      2483BAFF 
+  36      2685BAFF 
+  36      2886BBFF 
+  36      2A87BC
+  37 00ab FF2C89BC 		.ascii	"\377,\211\274\377.\212\275\3770\214\276\3772\215\276\3774\216"
+  37      FF2E8ABD 
+  37      FF308CBE 
+  37      FF328DBE 
+  37      FF348E
+  38 00be BFFF358F 		.ascii	"\277\3775\217\277\3779\220\300\377<\221\301\377?\222\301\377"
+  38      BFFF3990 
+  38      C0FF3C91 
+  38      C1FF3F92 
+  38      C1FF
+  39 00d0 4293C2FF 		.ascii	"B\223\302\377E\224\303\377G\225\303\377J\226\304\377L\227\304"
+  39      4594C3FF 
+  39      4795C3FF 
+  39      4A96C4FF 
+  39      4C97C4
+  40 00e3 FF4E98C5 		.ascii	"\377N\230\305\377Q\231\305\377_\237\311\377a\240\311\377d\241"
+  40      FF5199C5 
+  40      FF5F9FC9 
+  40      FF61A0C9 
+  40      FF64A1
+  41 00f6 CAFF66A2 		.ascii	"\312\377f\242\313\377h\243\313\377i\244\314\377k\245\314\377"
+  41      CBFF68A3 
+  41      CBFF69A4 
+  41      CCFF6BA5 
+  41      CCFF
+  42 0108 6DA5CDFF 		.ascii	"m\245\315\377o\246\315\377q\247\316\377s\250\316\377t\251\317"
+  42      6FA6CDFF 
+  42      71A7CEFF 
+  42      73A8CEFF 
+  42      74A9CF
+  43 011b FF76A9CF 		.ascii	"\377v\251\317\377x\252\320\377z\253\320\377|\253\320\377}\254"
+  43      FF78AAD0 
+  43      FF7AABD0 
+  43      FF7CABD0 
+  43      FF7DAC
+  44 012e D1FF7FAD 		.ascii	"\321\377\177\255\321\377\201\255\322\377\202\256\322\377\204"
+  44      D1FF81AD 
+  44      D2FF82AE 
+  44      D2FF84
+  45 013d AED2FF85 		.ascii	"\256\322\377\205\257\323\377\207\260\323\377\210\260\324\377"
+  45      AFD3FF87 
+  45      B0D3FF88 
+  45      B0D4FF
+GAS LISTING /tmp/cct9A39C.s 			page 3
+
+
+  46 014c 94B5D6FF 		.ascii	"\224\265\326\377\225\265\327\377\227\266\327\377\230\267\327"
+  46      95B5D7FF 
+  46      97B6D7FF 
+  46      98B7D7
+  47 015b FF9AB7D8 		.ascii	"\377\232\267\330\377\233\270\330\377\234\270\330\377\235\271"
+  47      FF9BB8D8 
+  47      FF9CB8D8 
+  47      FF9DB9
+  48 016a D9FF9FB9 		.ascii	"\331\377\237\271\331\377\240\272\331\377\241\272\331\377\242"
+  48      D9FFA0BA 
+  48      D9FFA1BA 
+  48      D9FFA2
+  49 0179 BBDAFFA4 		.ascii	"\273\332\377\244\274\332\377\245\274\332\377\246\275\333\377"
+  49      BCDAFFA5 
+  49      BCDAFFA6 
+  49      BDDBFF
+  50 0188 A7BDDBFF 		.ascii	"\247\275\333\377\250\276\333\377\252\276\334\377\253\277\334"
+  50      A8BEDBFF 
+  50      AABEDCFF 
+  50      ABBFDC
+  51 0197 FFACBFDC 		.ascii	"\377\254\277\334\377\255\277\334\377\256\300\335\377\257\300"
+  51      FFADBFDC 
+  51      FFAEC0DD 
+  51      FFAFC0
+  52 01a6 DDFFB0C1 		.ascii	"\335\377\260\301\335\377\261\301\336\377\262\302\336\377\263"
+  52      DDFFB1C1 
+  52      DEFFB2C2 
+  52      DEFFB3
+  53 01b5 C2DEFFB4 		.ascii	"\302\336\377\264\303\336\377\265\303\337\377\266\304\337\377"
+  53      C3DEFFB5 
+  53      C3DFFFB6 
+  53      C4DFFF
+  54 01c4 B7C4DFFF 		.ascii	"\267\304\337\377\300\310\342\377\301\311\342\377\302\311\342"
+  54      C0C8E2FF 
+  54      C1C9E2FF 
+  54      C2C9E2
+  55 01d3 FFC3CAE2 		.ascii	"\377\303\312\342\377\304\312\342\377\305\313\343\377\306\313"
+  55      FFC4CAE2 
+  55      FFC5CBE3 
+  55      FFC6CB
+  56 01e2 E3FFC6CB 		.ascii	"\343\377\306\313\343\377\307\314\343\377\310\314\344\377\311"
+  56      E3FFC7CC 
+  56      E3FFC8CC 
+  56      E4FFC9
+  57 01f1 CDE4FFCA 		.ascii	"\315\344\377\312\315\344\377\312\315\344\377\313\316\344\377"
+  57      CDE4FFCA 
+  57      CDE4FFCB 
+  57      CEE4FF
+  58 0200 CCCEE4FF 		.ascii	"\314\316\344\377\314\317\345\377\315\317\345\377\316\317\345"
+  58      CCCFE5FF 
+  58      CDCFE5FF 
+  58      CECFE5
+  59 020f FFCED0E5 		.ascii	"\377\316\320\345\377\317\320\345\377\320\321\346\377\320\321"
+  59      FFCFD0E5 
+  59      FFD0D1E6 
+  59      FFD0D1
+  60 021e E6FFD1D1 		.ascii	"\346\377\321\321\346\377\321\322\346\377\322\322\346\377\322"
+GAS LISTING /tmp/cct9A39C.s 			page 4
+
+
+  60      E6FFD1D2 
+  60      E6FFD2D2 
+  60      E6FFD2
+  61 022d D2E7FFD3 		.ascii	"\322\347\377\323\323\347\377\324\323\347\377\324\324\347\377"
+  61      D3E7FFD4 
+  61      D3E7FFD4 
+  61      D4E7FF
+  62 023c D5D4E7FF 		.ascii	"\325\324\347\377\325\324\350\377\325\325\350\377\326\325\350"
+  62      D5D4E8FF 
+  62      D5D5E8FF 
+  62      D6D5E8
+  63 024b FFD6D5E8 		.ascii	"\377\326\325\350\377\327\326\350\377\327\326\350\377\330\326"
+  63      FFD7D6E8 
+  63      FFD7D6E8 
+  63      FFD8D6
+  64 025a E9FFD8D7 		.ascii	"\351\377\330\327\351\377\331\327\351\377\331\327\351\377\331"
+  64      E9FFD9D7 
+  64      E9FFD9D7 
+  64      E9FFD9
+  65 0269 D8E9FFDA 		.ascii	"\330\351\377\332\330\352\377\332\330\352\377\333\330\352\377"
+  65      D8EAFFDA 
+  65      D8EAFFDB 
+  65      D8EAFF
+  66 0278 DBD9EAFF 		.ascii	"\333\331\352\377\341\335\355\377\341\336\355\377\342\336\355"
+  66      E1DDEDFF 
+  66      E1DEEDFF 
+  66      E2DEED
+  67 0287 FFE2DEED 		.ascii	"\377\342\336\355\377\343\337\355\377\343\337\355\377\343\337"
+  67      FFE3DFED 
+  67      FFE3DFED 
+  67      FFE3DF
+  68 0296 EEFFE4E0 		.ascii	"\356\377\344\340\356\377\344\340\356\377\344\340\356\377\345"
+  68      EEFFE4E0 
+  68      EEFFE4E0 
+  68      EEFFE5
+  69 02a5 E0EEFFE5 		.ascii	"\340\356\377\345\341\356\377\345\341\356\377\346\341\357\377"
+  69      E1EEFFE5 
+  69      E1EEFFE6 
+  69      E1EFFF
+  70 02b4 E6E2EFFF 		.ascii	"\346\342\357\377\346\342\357\377\347\342\357\377\347\342\357"
+  70      E6E2EFFF 
+  70      E7E2EFFF 
+  70      E7E2EF
+  71 02c3 FFE7E3EF 		.ascii	"\377\347\343\357\377\350\343\357\377\350\343\360\377\350\343"
+  71      FFE8E3EF 
+  71      FFE8E3F0 
+  71      FFE8E3
+  72 02d2 F0FFE8E4 		.ascii	"\360\377\350\344\360\377\351\344\360\377\351\344\360\377\351"
+  72      F0FFE9E4 
+  72      F0FFE9E4 
+  72      F0FFE9
+  73 02e1 E4F0FFE9 		.ascii	"\344\360\377\351\345\360\377\352\345\361\377\352\345\361\377"
+  73      E5F0FFEA 
+  73      E5F1FFEA 
+  73      E5F1FF
+  74 02f0 EAE5F1FF 		.ascii	"\352\345\361\377\352\346\361\377\353\346\361\377\353\346\361"
+  74      EAE6F1FF 
+GAS LISTING /tmp/cct9A39C.s 			page 5
+
+
+  74      EBE6F1FF 
+  74      EBE6F1
+  75 02ff FFEBE6F1 		.ascii	"\377\353\346\361\377\353\346\361\377\354\347\362\377\354\347"
+  75      FFEBE6F1 
+  75      FFECE7F2 
+  75      FFECE7
+  76 030e F2FFECE7 		.ascii	"\362\377\354\347\362\377\354\347\362\377\355\347\362\377\355"
+  76      F2FFECE7 
+  76      F2FFEDE7 
+  76      F2FFED
+  77 031d E7F2FFED 		.ascii	"\347\362\377\355\347\362\377\355\350\362\377\355\350\362\377"
+  77      E7F2FFED 
+  77      E8F2FFED 
+  77      E8F2FF
+  78 032c EEE8F2FF 		.ascii	"\356\350\362\377\356\350\362\377\356\350\362\377\356\350\362"
+  78      EEE8F2FF 
+  78      EEE8F2FF 
+  78      EEE8F2
+  79 033b FFEEE8F2 		.ascii	"\377\356\350\362\377\356\350\363\377\357\351\363\377\357\351"
+  79      FFEEE8F3 
+  79      FFEFE9F3 
+  79      FFEFE9
+  80 034a F3FFEFE9 		.ascii	"\363\377\357\351\363\377\357\351\363\377\357\351\363\377\357"
+  80      F3FFEFE9 
+  80      F3FFEFE9 
+  80      F3FFEF
+  81 0359 E9F3FFF0 		.ascii	"\351\363\377\360\351\363\377\360\351\363\377\360\352\363\377"
+  81      E9F3FFF0 
+  81      E9F3FFF0 
+  81      EAF3FF
+  82 0368 F0EAF3FF 		.ascii	"\360\352\363\377\360\352\363\377\360\352\363\377\361\352\363"
+  82      F0EAF3FF 
+  82      F0EAF3FF 
+  82      F1EAF3
+  83 0377 FFF1EAF3 		.ascii	"\377\361\352\363\377\361\352\363\377\361\352\364\377\361\352"
+  83      FFF1EAF3 
+  83      FFF1EAF4 
+  83      FFF1EA
+  84 0386 F4FFF1EB 		.ascii	"\364\377\361\353\364\377\361\353\364\377\362\353\364\377\362"
+  84      F4FFF1EB 
+  84      F4FFF2EB 
+  84      F4FFF2
+  85 0395 EBF4FFF2 		.ascii	"\353\364\377\362\353\364\377\362\353\364\377\362\353\364\377"
+  85      EBF4FFF2 
+  85      EBF4FFF2 
+  85      EBF4FF
+  86 03a4 F2EBF4FF 		.ascii	"\362\353\364\377\362\353\364\377\362\353\364\377\363\354\364"
+  86      F2EBF4FF 
+  86      F2EBF4FF 
+  86      F3ECF4
+  87 03b3 FFF3ECF4 		.ascii	"\377\363\354\364\377\363\354\364\377\363\354\364\377\363\354"
+  87      FFF3ECF4 
+  87      FFF3ECF4 
+  87      FFF3EC
+  88 03c2 F4FFF3EC 		.ascii	"\364\377\363\354\364\377\363\354\364\377\363\354\365\377\363"
+  88      F4FFF3EC 
+  88      F4FFF3EC 
+GAS LISTING /tmp/cct9A39C.s 			page 6
+
+
+  88      F5FFF3
+  89 03d1 ECF5FFF3 		.ascii	"\354\365\377\363\354\365\377\364\354\365\377\364\354\365\377"
+  89      ECF5FFF4 
+  89      ECF5FFF4 
+  89      ECF5FF
+  90 03e0 F4EDF5FF 		.ascii	"\364\355\365\377\370\360\367\377\370\360\367\377\370\360\367"
+  90      F8F0F7FF 
+  90      F8F0F7FF 
+  90      F8F0F7
+  91 03ef FFF8F0F7 		.ascii	"\377\370\360\367\377\370\360\367\377\370\360\367\377\370\360"
+  91      FFF8F0F7 
+  91      FFF8F0F7 
+  91      FFF8F0
+  92 03fe F7FFF8F0 		.ascii	"\367\377\370\360\367\377\370\360\367\377\371\361\367\377\371"
+  92      F7FFF8F0 
+  92      F7FFF9F1 
+  92      F7FFF9
+  93 040d F1F7FFF9 		.ascii	"\361\367\377\371\361\367\377\371\361\367\377\371\361\367\377"
+  93      F1F7FFF9 
+  93      F1F7FFF9 
+  93      F1F7FF
+  94 041c F9F1F7FF 		.ascii	"\371\361\367\377\371\361\367\377\371\361\367\377\371\361\367"
+  94      F9F1F7FF 
+  94      F9F1F7FF 
+  94      F9F1F7
+  95 042b FFF9F1F7 		.ascii	"\377\371\361\367\377\371\361\367\377\371\361\367\377\371\361"
+  95      FFF9F1F7 
+  95      FFF9F1F7 
+  95      FFF9F1
+  96 043a F7FFFAF1 		.ascii	"\367\377\372\361\370\377\372\362\370\377\372\362\370\377\372"
+  96      F8FFFAF2 
+  96      F8FFFAF2 
+  96      F8FFFA
+  97 0449 F2F8FFFA 		.ascii	"\362\370\377\372\362\370\377\372\362\370\377\372\362\370\377"
+  97      F2F8FFFA 
+  97      F2F8FFFA 
+  97      F2F8FF
+  98 0458 FAF2F8FF 		.ascii	"\372\362\370\377\372\362\370\377\372\362\370\377\372\362\370"
+  98      FAF2F8FF 
+  98      FAF2F8FF 
+  98      FAF2F8
+  99 0467 FFFAF2F8 		.ascii	"\377\372\362\370\377\372\362\370\377\372\362\370\377\372\362"
+  99      FFFAF2F8 
+  99      FFFAF2F8 
+  99      FFFAF2
+ 100 0476 F8FFFBF2 		.ascii	"\370\377\373\362\370\377\373\362\370\377\373\362\370\377\373"
+ 100      F8FFFBF2 
+ 100      F8FFFBF2 
+ 100      F8FFFB
+ 101 0485 F3F8FFFB 		.ascii	"\363\370\377\373\363\370\377\373\363\370\377\373\363\370\377"
+ 101      F3F8FFFB 
+ 101      F3F8FFFB 
+ 101      F3F8FF
+ 102 0494 FBF3F8FF 		.ascii	"\373\363\370\377\373\363\370\377\373\363\370\377\373\363\370"
+ 102      FBF3F8FF 
+ 102      FBF3F8FF 
+ 102      FBF3F8
+GAS LISTING /tmp/cct9A39C.s 			page 7
+
+
+ 103 04a3 FFFBF3F8 		.ascii	"\377\373\363\370\377\373\363\370\377\373\363\370\377\373\363"
+ 103      FFFBF3F8 
+ 103      FFFBF3F8 
+ 103      FFFBF3
+ 104 04b2 F8FFFBF3 		.ascii	"\370\377\373\363\370\377\373\363\370\377\373\363\371\377\373"
+ 104      F8FFFBF3 
+ 104      F8FFFBF3 
+ 104      F9FFFB
+ 105 04c1 F3F9FFFB 		.ascii	"\363\371\377\373\363\371\377\374\363\371\377\374\363\371\377"
+ 105      F3F9FFFC 
+ 105      F3F9FFFC 
+ 105      F3F9FF
+ 106 04d0 FCF3F9FF 		.ascii	"\374\363\371\377\374\363\371\377\374\364\371\377\374\364\371"
+ 106      FCF3F9FF 
+ 106      FCF4F9FF 
+ 106      FCF4F9
+ 107 04df FFFCF4F9 		.ascii	"\377\374\364\371\377\374\364\371\377\374\364\371\377\374\364"
+ 107      FFFCF4F9 
+ 107      FFFCF4F9 
+ 107      FFFCF4
+ 108 04ee F9FFFCF4 		.ascii	"\371\377\374\364\371\377\374\364\371\377\374\364\371\377\374"
+ 108      F9FFFCF4 
+ 108      F9FFFCF4 
+ 108      F9FFFC
+ 109 04fd F4F9FFFC 		.ascii	"\364\371\377\374\364\371\377\374\364\371\377\374\364\371\377"
+ 109      F4F9FFFC 
+ 109      F4F9FFFC 
+ 109      F4F9FF
+ 110 050c FCF4F9FF 		.ascii	"\374\364\371\377\374\364\371\377\374\364\371\377\374\364\371"
+ 110      FCF4F9FF 
+ 110      FCF4F9FF 
+ 110      FCF4F9
+ 111 051b FFFCF4F9 		.ascii	"\377\374\364\371\377\374\364\371\377\374\364\371\377\374\364"
+ 111      FFFCF4F9 
+ 111      FFFCF4F9 
+ 111      FFFCF4
+ 112 052a F9FFFCF4 		.ascii	"\371\377\374\364\371\377\374\364\371\377\374\364\371\377\375"
+ 112      F9FFFCF4 
+ 112      F9FFFCF4 
+ 112      F9FFFD
+ 113 0539 F4F9FFFD 		.ascii	"\364\371\377\375\364\371\377\375\364\371\377\375\364\371\377"
+ 113      F4F9FFFD 
+ 113      F4F9FFFD 
+ 113      F4F9FF
+ 114 0548 FDF4F9FF 		.ascii	"\375\364\371\377\375\365\371\377\375\365\371\377\375\365\371"
+ 114      FDF5F9FF 
+ 114      FDF5F9FF 
+ 114      FDF5F9
+ 115 0557 FFFDF5F9 		.ascii	"\377\375\365\371\377\375\365\371\377\375\365\371\377\375\365"
+ 115      FFFDF5F9 
+ 115      FFFDF5F9 
+ 115      FFFDF5
+ 116 0566 F9FFFDF5 		.ascii	"\371\377\375\365\371\377\375\365\371\377\375\365\371\377\375"
+ 116      F9FFFDF5 
+ 116      F9FFFDF5 
+ 116      F9FFFD
+ 117 0575 F5F9FFFD 		.ascii	"\365\371\377\375\365\371\377\375\365\371\377\375\365\371\377"
+GAS LISTING /tmp/cct9A39C.s 			page 8
+
+
+ 117      F5F9FFFD 
+ 117      F5F9FFFD 
+ 117      F5F9FF
+ 118 0584 FDF5FAFF 		.ascii	"\375\365\372\377\375\365\372\377\375\365\372\377\375\365\372"
+ 118      FDF5FAFF 
+ 118      FDF5FAFF 
+ 118      FDF5FA
+ 119 0593 FFFDF5FA 		.ascii	"\377\375\365\372\377\375\365\372\377\375\365\372\377\375\365"
+ 119      FFFDF5FA 
+ 119      FFFDF5FA 
+ 119      FFFDF5
+ 120 05a2 FAFFFDF5 		.ascii	"\372\377\375\365\372\377\375\365\372\377\375\365\372\377\375"
+ 120      FAFFFDF5 
+ 120      FAFFFDF5 
+ 120      FAFFFD
+ 121 05b1 F5FAFFFD 		.ascii	"\365\372\377\375\365\372\377\375\365\372\377\375\365\372\377"
+ 121      F5FAFFFD 
+ 121      F5FAFFFD 
+ 121      F5FAFF
+ 122 05c0 FDF5FAFF 		.ascii	"\375\365\372\377\375\365\372\377\375\365\372\377\375\365\372"
+ 122      FDF5FAFF 
+ 122      FDF5FAFF 
+ 122      FDF5FA
+ 123 05cf FFFDF5FA 		.ascii	"\377\375\365\372\377\375\365\372\377\375\365\372\377\375\365"
+ 123      FFFDF5FA 
+ 123      FFFDF5FA 
+ 123      FFFDF5
+ 124 05de FAFFFDF5 		.ascii	"\372\377\375\365\372\377\375\365\372\377\375\365\372\377\376"
+ 124      FAFFFDF5 
+ 124      FAFFFDF5 
+ 124      FAFFFE
+ 125 05ed F5FAFFFE 		.ascii	"\365\372\377\376\365\372\377\376\365\372\377\376\365\372\377"
+ 125      F5FAFFFE 
+ 125      F5FAFFFE 
+ 125      F5FAFF
+ 126 05fc FEF5FAFF 		.ascii	"\376\365\372\377\376\365\372\377\376\366\372\377\376\366\372"
+ 126      FEF5FAFF 
+ 126      FEF6FAFF 
+ 126      FEF6FA
+ 127 060b FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 127      FFFEF6FA 
+ 127      FFFEF6FA 
+ 127      FFFEF6
+ 128 061a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 128      FAFFFEF6 
+ 128      FAFFFEF6 
+ 128      FAFFFE
+ 129 0629 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 129      F6FAFFFE 
+ 129      F6FAFFFE 
+ 129      F6FAFF
+ 130 0638 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 130      FEF6FAFF 
+ 130      FEF6FAFF 
+ 130      FEF6FA
+ 131 0647 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 131      FFFEF6FA 
+GAS LISTING /tmp/cct9A39C.s 			page 9
+
+
+ 131      FFFEF6FA 
+ 131      FFFEF6
+ 132 0656 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 132      FAFFFEF6 
+ 132      FAFFFEF6 
+ 132      FAFFFE
+ 133 0665 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 133      F6FAFFFE 
+ 133      F6FAFFFE 
+ 133      F6FAFF
+ 134 0674 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 134      FEF6FAFF 
+ 134      FEF6FAFF 
+ 134      FEF6FA
+ 135 0683 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 135      FFFEF6FA 
+ 135      FFFEF6FA 
+ 135      FFFEF6
+ 136 0692 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 136      FAFFFEF6 
+ 136      FAFFFEF6 
+ 136      FAFFFE
+ 137 06a1 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 137      F6FAFFFE 
+ 137      F6FAFFFE 
+ 137      F6FAFF
+ 138 06b0 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 138      FEF6FAFF 
+ 138      FEF6FAFF 
+ 138      FEF6FA
+ 139 06bf FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 139      FFFEF6FA 
+ 139      FFFEF6FA 
+ 139      FFFEF6
+ 140 06ce FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 140      FAFFFEF6 
+ 140      FAFFFEF6 
+ 140      FAFFFE
+ 141 06dd F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 141      F6FAFFFE 
+ 141      F6FAFFFE 
+ 141      F6FAFF
+ 142 06ec FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 142      FEF6FAFF 
+ 142      FEF6FAFF 
+ 142      FEF6FA
+ 143 06fb FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 143      FFFEF6FA 
+ 143      FFFEF6FA 
+ 143      FFFEF6
+ 144 070a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 144      FAFFFEF6 
+ 144      FAFFFEF6 
+ 144      FAFFFE
+ 145 0719 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 145      F6FAFFFE 
+ 145      F6FAFFFE 
+GAS LISTING /tmp/cct9A39C.s 			page 10
+
+
+ 145      F6FAFF
+ 146 0728 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 146      FEF6FAFF 
+ 146      FEF6FAFF 
+ 146      FEF6FA
+ 147 0737 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 147      FFFEF6FA 
+ 147      FFFEF6FA 
+ 147      FFFEF6
+ 148 0746 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 148      FAFFFEF6 
+ 148      FAFFFEF6 
+ 148      FAFFFE
+ 149 0755 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 149      F6FAFFFE 
+ 149      F6FAFFFE 
+ 149      F6FAFF
+ 150 0764 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 150      FEF6FAFF 
+ 150      FEF6FAFF 
+ 150      FEF6FA
+ 151 0773 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 151      FFFEF6FA 
+ 151      FFFEF6FA 
+ 151      FFFEF6
+ 152 0782 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 152      FAFFFEF6 
+ 152      FAFFFEF6 
+ 152      FAFFFE
+ 153 0791 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 153      F6FAFFFE 
+ 153      F6FAFFFE 
+ 153      F6FAFF
+ 154 07a0 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 154      FEF6FAFF 
+ 154      FEF6FAFF 
+ 154      FEF6FA
+ 155 07af FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 155      FFFEF6FA 
+ 155      FFFEF6FA 
+ 155      FFFEF6
+ 156 07be FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 156      FAFFFEF6 
+ 156      FAFFFEF6 
+ 156      FAFFFE
+ 157 07cd F6FAFF   		.ascii	"\366\372\377"
+ 158 07d0 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 158      FEF6FAFF 
+ 158      FEF6FAFF 
+ 158      FEF6FA
+ 159 07df FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 159      FFFEF6FA 
+ 159      FFFEF6FA 
+ 159      FFFEF6
+ 160 07ee FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 160      FAFFFEF6 
+ 160      FAFFFEF6 
+GAS LISTING /tmp/cct9A39C.s 			page 11
+
+
+ 160      FAFFFE
+ 161 07fd F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 161      F6FAFFFE 
+ 161      F6FAFFFE 
+ 161      F6FAFF
+ 162 080c FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 162      FEF6FAFF 
+ 162      FEF6FAFF 
+ 162      FEF6FA
+ 163 081b FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 163      FFFEF6FA 
+ 163      FFFEF6FA 
+ 163      FFFEF6
+ 164 082a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 164      FAFFFEF6 
+ 164      FAFFFEF6 
+ 164      FAFFFE
+ 165 0839 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 165      F6FAFFFE 
+ 165      F6FAFFFE 
+ 165      F6FAFF
+ 166 0848 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 166      FEF6FAFF 
+ 166      FEF6FAFF 
+ 166      FEF6FA
+ 167 0857 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 167      FFFEF6FA 
+ 167      FFFEF6FA 
+ 167      FFFEF6
+ 168 0866 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 168      FAFFFEF6 
+ 168      FAFFFEF6 
+ 168      FAFFFE
+ 169 0875 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 169      F6FAFFFE 
+ 169      F6FAFFFE 
+ 169      F6FAFF
+ 170 0884 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 170      FEF6FAFF 
+ 170      FEF6FAFF 
+ 170      FEF6FA
+ 171 0893 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 171      FFFEF6FA 
+ 171      FFFEF6FA 
+ 171      FFFEF6
+ 172 08a2 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 172      FAFFFEF6 
+ 172      FAFFFEF6 
+ 172      FAFFFE
+ 173 08b1 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 173      F6FAFFFE 
+ 173      F6FAFFFE 
+ 173      F6FAFF
+ 174 08c0 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 174      FEF6FAFF 
+ 174      FEF6FAFF 
+ 174      FEF6FA
+GAS LISTING /tmp/cct9A39C.s 			page 12
+
+
+ 175 08cf FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 175      FFFEF6FA 
+ 175      FFFEF6FA 
+ 175      FFFEF6
+ 176 08de FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 176      FAFFFEF6 
+ 176      FAFFFEF6 
+ 176      FAFFFE
+ 177 08ed F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 177      F6FAFFFE 
+ 177      F6FAFFFE 
+ 177      F6FAFF
+ 178 08fc FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 178      FEF6FAFF 
+ 178      FEF6FAFF 
+ 178      FEF6FA
+ 179 090b FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 179      FFFEF6FA 
+ 179      FFFEF6FA 
+ 179      FFFEF6
+ 180 091a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 180      FAFFFEF6 
+ 180      FAFFFEF6 
+ 180      FAFFFE
+ 181 0929 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 181      F6FAFFFE 
+ 181      F6FAFFFE 
+ 181      F6FAFF
+ 182 0938 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 182      FEF6FAFF 
+ 182      FEF6FAFF 
+ 182      FEF6FA
+ 183 0947 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 183      FFFEF6FA 
+ 183      FFFEF6FA 
+ 183      FFFEF6
+ 184 0956 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 184      FAFFFEF6 
+ 184      FAFFFEF6 
+ 184      FAFFFE
+ 185 0965 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 185      F6FAFFFE 
+ 185      F6FAFFFE 
+ 185      F6FAFF
+ 186 0974 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 186      FEF6FAFF 
+ 186      FEF6FAFF 
+ 186      FEF6FA
+ 187 0983 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 187      FFFEF6FA 
+ 187      FFFEF6FA 
+ 187      FFFEF6
+ 188 0992 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 188      FAFFFEF6 
+ 188      FAFFFEF6 
+ 188      FAFFFE
+ 189 09a1 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+GAS LISTING /tmp/cct9A39C.s 			page 13
+
+
+ 189      F6FAFFFE 
+ 189      F6FAFFFE 
+ 189      F6FAFF
+ 190 09b0 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 190      FEF6FAFF 
+ 190      FEF6FAFF 
+ 190      FEF6FA
+ 191 09bf FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 191      FFFEF6FA 
+ 191      FFFEF6FA 
+ 191      FFFEF6
+ 192 09ce FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 192      FAFFFEF6 
+ 192      FAFFFEF6 
+ 192      FAFFFE
+ 193 09dd F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 193      F6FAFFFE 
+ 193      F6FAFFFE 
+ 193      F6FAFF
+ 194 09ec FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 194      FEF6FAFF 
+ 194      FEF6FAFF 
+ 194      FEF6FA
+ 195 09fb FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 195      FFFEF6FA 
+ 195      FFFEF6FA 
+ 195      FFFEF6
+ 196 0a0a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 196      FAFFFEF6 
+ 196      FAFFFEF6 
+ 196      FAFFFE
+ 197 0a19 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 197      F6FAFFFE 
+ 197      F6FAFFFE 
+ 197      F6FAFF
+ 198 0a28 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 198      FEF6FAFF 
+ 198      FEF6FAFF 
+ 198      FEF6FA
+ 199 0a37 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 199      FFFEF6FA 
+ 199      FFFEF6FA 
+ 199      FFFEF6
+ 200 0a46 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 200      FAFFFEF6 
+ 200      FAFFFEF6 
+ 200      FAFFFE
+ 201 0a55 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 201      F6FAFFFE 
+ 201      F6FAFFFE 
+ 201      F6FAFF
+ 202 0a64 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 202      FEF6FAFF 
+ 202      FEF6FAFF 
+ 202      FEF6FA
+ 203 0a73 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 203      FFFEF6FA 
+GAS LISTING /tmp/cct9A39C.s 			page 14
+
+
+ 203      FFFEF6FA 
+ 203      FFFEF6
+ 204 0a82 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 204      FAFFFEF6 
+ 204      FAFFFEF6 
+ 204      FAFFFE
+ 205 0a91 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 205      F6FAFFFE 
+ 205      F6FAFFFE 
+ 205      F6FAFF
+ 206 0aa0 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 206      FEF6FAFF 
+ 206      FEF6FAFF 
+ 206      FEF6FA
+ 207 0aaf FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 207      FFFEF6FA 
+ 207      FFFEF6FA 
+ 207      FFFEF6
+ 208 0abe FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 208      FAFFFEF6 
+ 208      FAFFFEF6 
+ 208      FAFFFE
+ 209 0acd F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 209      F6FAFFFE 
+ 209      F6FAFFFE 
+ 209      F6FAFF
+ 210 0adc FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 210      FEF6FAFF 
+ 210      FEF6FAFF 
+ 210      FEF6FA
+ 211 0aeb FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 211      FFFEF6FA 
+ 211      FFFEF6FA 
+ 211      FFFEF6
+ 212 0afa FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 212      FAFFFEF6 
+ 212      FAFFFEF6 
+ 212      FAFFFE
+ 213 0b09 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 213      F6FAFFFE 
+ 213      F6FAFFFE 
+ 213      F6FAFF
+ 214 0b18 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 214      FEF6FAFF 
+ 214      FEF6FAFF 
+ 214      FEF6FA
+ 215 0b27 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 215      FFFEF6FA 
+ 215      FFFEF6FA 
+ 215      FFFEF6
+ 216 0b36 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 216      FAFFFEF6 
+ 216      FAFFFEF6 
+ 216      FAFFFE
+ 217 0b45 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 217      F6FAFFFE 
+ 217      F6FAFFFE 
+GAS LISTING /tmp/cct9A39C.s 			page 15
+
+
+ 217      F6FAFF
+ 218 0b54 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 218      FEF6FAFF 
+ 218      FEF6FAFF 
+ 218      FEF6FA
+ 219 0b63 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 219      FFFEF6FA 
+ 219      FFFEF6FA 
+ 219      FFFEF6
+ 220 0b72 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 220      FAFFFEF6 
+ 220      FAFFFEF6 
+ 220      FAFFFE
+ 221 0b81 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 221      F6FAFFFE 
+ 221      F6FAFFFE 
+ 221      F6FAFF
+ 222 0b90 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 222      FEF6FAFF 
+ 222      FEF6FAFF 
+ 222      FEF6FA
+ 223 0b9f FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 223      FFFEF6FA 
+ 223      FFFEF6FA 
+ 223      FFFEF6
+ 224 0bae FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 224      FAFFFEF6 
+ 224      FAFFFEF6 
+ 224      FAFFFE
+ 225 0bbd F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 225      F6FAFFFE 
+ 225      F6FAFFFE 
+ 225      F6FAFF
+ 226 0bcc FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 226      FEF6FAFF 
+ 226      FEF6FAFF 
+ 226      FEF6FA
+ 227 0bdb FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 227      FFFEF6FA 
+ 227      FFFEF6FA 
+ 227      FFFEF6
+ 228 0bea FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 228      FAFFFEF6 
+ 228      FAFFFEF6 
+ 228      FAFFFE
+ 229 0bf9 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 229      F6FAFFFE 
+ 229      F6FAFFFE 
+ 229      F6FAFF
+ 230 0c08 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 230      FEF6FAFF 
+ 230      FEF6FAFF 
+ 230      FEF6FA
+ 231 0c17 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 231      FFFEF6FA 
+ 231      FFFEF6FA 
+ 231      FFFEF6
+GAS LISTING /tmp/cct9A39C.s 			page 16
+
+
+ 232 0c26 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 232      FAFFFEF6 
+ 232      FAFFFEF6 
+ 232      FAFFFE
+ 233 0c35 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 233      F6FAFFFE 
+ 233      F6FAFFFE 
+ 233      F6FAFF
+ 234 0c44 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 234      FEF6FAFF 
+ 234      FEF6FAFF 
+ 234      FEF6FA
+ 235 0c53 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 235      FFFEF6FA 
+ 235      FFFEF6FA 
+ 235      FFFEF6
+ 236 0c62 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 236      FAFFFEF6 
+ 236      FAFFFEF6 
+ 236      FAFFFE
+ 237 0c71 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 237      F6FAFFFE 
+ 237      F6FAFFFE 
+ 237      F6FAFF
+ 238 0c80 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 238      FEF6FAFF 
+ 238      FEF6FAFF 
+ 238      FEF6FA
+ 239 0c8f FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 239      FFFEF6FA 
+ 239      FFFEF6FA 
+ 239      FFFEF6
+ 240 0c9e FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 240      FAFFFEF6 
+ 240      FAFFFEF6 
+ 240      FAFFFE
+ 241 0cad F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 241      F6FAFFFE 
+ 241      F6FAFFFE 
+ 241      F6FAFF
+ 242 0cbc FEF6FAFF 		.ascii	"\376\366\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 242      FEF7FAFF 
+ 242      FEF7FAFF 
+ 242      FEF7FA
+ 243 0ccb FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 243      FFFEF7FA 
+ 243      FFFEF7FA 
+ 243      FFFEF7
+ 244 0cda FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 244      FAFFFEF7 
+ 244      FAFFFEF7 
+ 244      FAFFFE
+ 245 0ce9 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 245      F7FAFFFE 
+ 245      F7FAFFFE 
+ 245      F7FAFF
+ 246 0cf8 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+GAS LISTING /tmp/cct9A39C.s 			page 17
+
+
+ 246      FEF7FAFF 
+ 246      FEF7FAFF 
+ 246      FEF7FA
+ 247 0d07 FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 247      FFFEF7FA 
+ 247      FFFEF7FA 
+ 247      FFFEF7
+ 248 0d16 FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 248      FAFFFEF7 
+ 248      FAFFFEF7 
+ 248      FAFFFE
+ 249 0d25 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 249      F7FAFFFE 
+ 249      F7FAFFFE 
+ 249      F7FAFF
+ 250 0d34 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 250      FEF7FAFF 
+ 250      FEF7FAFF 
+ 250      FEF7FA
+ 251 0d43 FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 251      FFFEF7FA 
+ 251      FFFEF7FA 
+ 251      FFFEF7
+ 252 0d52 FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 252      FAFFFEF7 
+ 252      FAFFFEF7 
+ 252      FAFFFE
+ 253 0d61 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 253      F7FAFFFE 
+ 253      F7FAFFFE 
+ 253      F7FAFF
+ 254 0d70 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 254      FEF7FAFF 
+ 254      FEF7FAFF 
+ 254      FEF7FA
+ 255 0d7f FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 255      FFFEF7FA 
+ 255      FFFEF7FA 
+ 255      FFFEF7
+ 256 0d8e FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 256      FAFFFEF7 
+ 256      FAFFFEF7 
+ 256      FAFFFE
+ 257 0d9d F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 257      F7FAFFFE 
+ 257      F7FAFFFE 
+ 257      F7FAFF
+ 258 0dac FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 258      FEF7FAFF 
+ 258      FEF7FAFF 
+ 258      FEF7FA
+ 259 0dbb FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 259      FFFEF7FA 
+ 259      FFFEF7FA 
+ 259      FFFEF7
+ 260 0dca FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 260      FAFFFEF7 
+GAS LISTING /tmp/cct9A39C.s 			page 18
+
+
+ 260      FAFFFEF7 
+ 260      FAFFFE
+ 261 0dd9 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 261      F7FAFFFE 
+ 261      F7FAFFFE 
+ 261      F7FAFF
+ 262 0de8 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 262      FEF7FAFF 
+ 262      FEF7FAFF 
+ 262      FEF7FA
+ 263 0df7 FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 263      FFFEF7FA 
+ 263      FFFEF7FA 
+ 263      FFFEF7
+ 264 0e06 FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 264      FAFFFEF7 
+ 264      FAFFFEF7 
+ 264      FAFFFE
+ 265 0e15 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 265      F7FAFFFE 
+ 265      F7FAFFFE 
+ 265      F7FAFF
+ 266 0e24 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 266      FEF7FAFF 
+ 266      FEF7FAFF 
+ 266      FEF7FA
+ 267 0e33 FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 267      FFFEF7FA 
+ 267      FFFEF7FA 
+ 267      FFFEF7
+ 268 0e42 FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 268      FAFFFEF7 
+ 268      FAFFFEF7 
+ 268      FAFFFE
+ 269 0e51 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 269      F7FAFFFE 
+ 269      F7FAFFFE 
+ 269      F7FAFF
+ 270 0e60 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 270      FEF7FAFF 
+ 270      FEF7FAFF 
+ 270      FEF7FA
+ 271 0e6f FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 271      FFFEF7FA 
+ 271      FFFEF7FA 
+ 271      FFFEF7
+ 272 0e7e FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 272      FAFFFEF7 
+ 272      FAFFFEF7 
+ 272      FAFFFE
+ 273 0e8d F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 273      F7FAFFFE 
+ 273      F7FAFFFE 
+ 273      F7FAFF
+ 274 0e9c FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 274      FEF7FAFF 
+ 274      FEF7FAFF 
+GAS LISTING /tmp/cct9A39C.s 			page 19
+
+
+ 274      FEF7FA
+ 275 0eab FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 275      FFFEF7FA 
+ 275      FFFEF7FA 
+ 275      FFFEF7
+ 276 0eba FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 276      FAFFFEF7 
+ 276      FAFFFEF7 
+ 276      FAFFFE
+ 277 0ec9 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 277      F7FAFFFE 
+ 277      F7FAFFFE 
+ 277      F7FAFF
+ 278 0ed8 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 278      FEF7FAFF 
+ 278      FEF7FAFF 
+ 278      FEF7FA
+ 279 0ee7 FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 279      FFFEF7FA 
+ 279      FFFEF7FA 
+ 279      FFFEF7
+ 280 0ef6 FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 280      FAFFFEF7 
+ 280      FAFFFEF7 
+ 280      FAFFFE
+ 281 0f05 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 281      F7FAFFFE 
+ 281      F7FAFFFE 
+ 281      F7FAFF
+ 282 0f14 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 282      FEF7FAFF 
+ 282      FEF7FAFF 
+ 282      FEF7FA
+ 283 0f23 FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 283      FFFEF7FA 
+ 283      FFFEF7FA 
+ 283      FFFEF7
+ 284 0f32 FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 284      FAFFFEF7 
+ 284      FAFFFEF7 
+ 284      FAFFFE
+ 285 0f41 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 285      F7FAFFFE 
+ 285      F7FAFFFE 
+ 285      F7FAFF
+ 286 0f50 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 286      FEF7FAFF 
+ 286      FEF7FAFF 
+ 286      FEF7FA
+ 287 0f5f FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 287      FFFEF7FA 
+ 287      FFFEF7FA 
+ 287      FFFEF7
+ 288 0f6e FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 288      FAFFFEF7 
+ 288      FAFFFEF7 
+ 288      FAFFFE
+GAS LISTING /tmp/cct9A39C.s 			page 20
+
+
+ 289 0f7d F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 289      F7FAFFFE 
+ 289      F7FAFFFE 
+ 289      F7FAFF
+ 290 0f8c FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 290      FEF7FAFF 
+ 290      FEF7FAFF 
+ 290      FEF7FA
+ 291 0f9b FFFEF7FA 		.ascii	"\377\376\367\372\377"
+ 291      FF
+ 292 0fa0 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 292      FEF7FAFF 
+ 292      FEF7FAFF 
+ 292      FEF7FA
+ 293 0faf FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 293      FFFEF7FA 
+ 293      FFFEF7FA 
+ 293      FFFEF7
+ 294 0fbe FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 294      FAFFFEF7 
+ 294      FAFFFEF7 
+ 294      FAFFFE
+ 295 0fcd F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 295      F7FAFFFE 
+ 295      F7FAFFFE 
+ 295      F7FAFF
+ 296 0fdc FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 296      FEF7FAFF 
+ 296      FEF7FAFF 
+ 296      FEF7FA
+ 297 0feb FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 297      FFFEF7FA 
+ 297      FFFEF7FA 
+ 297      FFFEF7
+ 298 0ffa FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377"
+ 298      FAFFFEF7 
+ 298      FAFF
+ 299              		.globl	heatmap_cs_PuBu_mixed
+ 300              		.section	.data.rel.local
+ 301              		.align 8
+ 302              		.type	heatmap_cs_PuBu_mixed, @object
+ 303              		.size	heatmap_cs_PuBu_mixed, 8
+ 304              	heatmap_cs_PuBu_mixed:
+ 305 0008 00000000 		.quad	mixed
+ 305      00000000 
+ 306              		.section	.data.rel.ro.local
+ 307              		.align 16
+ 308              		.type	mixed, @object
+ 309              		.size	mixed, 16
+ 310              	mixed:
+ 311 0010 00000000 		.quad	mixed_data
+ 311      00000000 
+ 312 0018 01040000 		.quad	1025
+ 312      00000000 
+ 313              		.section	.rodata
+ 314 1004 00000000 		.align 32
+ 314      00000000 
+GAS LISTING /tmp/cct9A39C.s 			page 21
+
+
+ 314      00000000 
+ 314      00000000 
+ 314      00000000 
+ 315              		.type	mixed_data, @object
+ 316              		.size	mixed_data, 4100
+ 317              	mixed_data:
+ 318 1020 00       		.string	""
+ 319 1021 00       		.string	""
+ 320 1022 00       		.string	""
+ 321 1023 00       		.string	""
+ 322 1024 02375800 		.string	"\0027X"
+ 323 1028 01385807 		.ascii	"\0018X\007\0018X\016\0018X\026\0018Y\035\0019Y%\0019Y,\0019Z"
+ 323      0138580E 
+ 323      01385816 
+ 323      0138591D 
+ 323      01395925 
+ 324 1043 3401395A 		.ascii	"4\0019Z;\0019ZC\001:[J\001:[R\001:[Y\001:\\a\001:\\h\001;\\p"
+ 324      3B01395A 
+ 324      43013A5B 
+ 324      4A013A5B 
+ 324      52013A5B 
+ 325 1064 013B5D77 		.ascii	"\001;]w\001;]\177\001;]\206\001;^\215\001<^\225\001<^\234\001"
+ 325      013B5D7F 
+ 325      013B5D86 
+ 325      013B5E8D 
+ 325      013C5E95 
+ 326 107d 3C5FA401 		.ascii	"<_\244\001<_\253\001<_\263\001=_\272\001=`\302\001=`\311\001"
+ 326      3C5FAB01 
+ 326      3C5FB301 
+ 326      3D5FBA01 
+ 326      3D60C201 
+ 327 1095 3D60D101 		.ascii	"=`\321\001=a\330\001>a\340\001>a\347\001>b\357\001>b\366\001"
+ 327      3D61D801 
+ 327      3E61E001 
+ 327      3E61E701 
+ 327      3E62EF01 
+ 328 10ad 3F62FE01 		.ascii	"?b\376\001?c\377\001?c\377\001?c\377\001?d\377\001@d\377\001"
+ 328      3F63FF01 
+ 328      3F63FF01 
+ 328      3F63FF01 
+ 328      3F64FF01 
+ 329 10c5 4064FF01 		.ascii	"@d\377\001@e\377\001@e\377\001@e\377\001Af\377\001Af\377\001"
+ 329      4065FF01 
+ 329      4065FF01 
+ 329      4065FF01 
+ 329      4166FF01 
+ 330 10dd 4166FF01 		.ascii	"Af\377\001Ag\377\001Ag\377\001Bg\377\001Bh\377\001Bh\377\001"
+ 330      4167FF01 
+ 330      4167FF01 
+ 330      4267FF01 
+ 330      4268FF01 
+ 331 10f5 4268FF01 		.ascii	"Bh\377\001Ci\377\001Ci\377\001Ci\377\001Cj\377\001Cj\377\001"
+ 331      4369FF01 
+ 331      4369FF01 
+ 331      4369FF01 
+ 331      436AFF01 
+ 332 110d 446AFF01 		.ascii	"Dj\377\001Dk\377\001Dk\377\001Dk\377\001Dl\377\001El\377\002"
+GAS LISTING /tmp/cct9A39C.s 			page 22
+
+
+ 332      446BFF01 
+ 332      446BFF01 
+ 332      446BFF01 
+ 332      446CFF01 
+ 333 1125 4C77FF02 		.ascii	"Lw\377\002Lw\377\002Lx\377\002Lx\377\002Mx\377\002My\377\002"
+ 333      4C77FF02 
+ 333      4C78FF02 
+ 333      4C78FF02 
+ 333      4D78FF02 
+ 334 113d 4D79FF02 		.ascii	"My\377\002My\377\002Mz\377\002Nz\377\002Nz\377\002N{\377\002"
+ 334      4D79FF02 
+ 334      4D7AFF02 
+ 334      4E7AFF02 
+ 334      4E7AFF02 
+ 335 1155 4E7BFF02 		.ascii	"N{\377\002N{\377\002O|\377\002O|\377\002O|\377\002O}\377\002"
+ 335      4E7BFF02 
+ 335      4F7CFF02 
+ 335      4F7CFF02 
+ 335      4F7CFF02 
+ 336 116d 507DFF02 		.ascii	"P}\377\002P}\377\002P~\377\002P~\377\002P~\377\002Q\177\377\002"
+ 336      507DFF02 
+ 336      507EFF02 
+ 336      507EFF02 
+ 336      507EFF02 
+ 337 1185 517FFF02 		.ascii	"Q\177\377\002Q\177\377\002Q\200\377\002Q\200\377\002R\200\377"
+ 337      517FFF02 
+ 337      5180FF02 
+ 337      5180FF02 
+ 337      5280FF
+ 338 1198 025281FF 		.ascii	"\002R\201\377\002R\201\377\002R\201\377\002S\202\377\002S\202"
+ 338      025281FF 
+ 338      025281FF 
+ 338      025382FF 
+ 338      025382
+ 339 11ab FF025382 		.ascii	"\377\002S\202\377\002S\203\377\002S\203\377\002T\203\377\002"
+ 339      FF025383 
+ 339      FF025383 
+ 339      FF025483 
+ 339      FF02
+ 340 11bd 5484FF03 		.ascii	"T\204\377\003T\204\377\003T\204\377\003T\205\377\003U\205\377"
+ 340      5484FF03 
+ 340      5484FF03 
+ 340      5485FF03 
+ 340      5585FF
+ 341 11d0 035585FF 		.ascii	"\003U\205\377\003U\206\377\003U\206\377\003V\206\377\003V\207"
+ 341      035586FF 
+ 341      035586FF 
+ 341      035686FF 
+ 341      035687
+ 342 11e3 FF035687 		.ascii	"\377\003V\207\377\003V\207\377\003V\210\377\003W\210\377\003"
+ 342      FF035687 
+ 342      FF035688 
+ 342      FF035788 
+ 342      FF03
+ 343 11f5 5788FF03 		.ascii	"W\210\377\003W\211\377\003W\211\377\003X\211\377\003X\212\377"
+ 343      5789FF03 
+ 343      5789FF03 
+GAS LISTING /tmp/cct9A39C.s 			page 23
+
+
+ 343      5889FF03 
+ 343      588AFF
+ 344 1208 03588AFF 		.ascii	"\003X\212\377\003X\212\377\003X\213\377\003Y\213\377\003Y\213"
+ 344      03588AFF 
+ 344      03588BFF 
+ 344      03598BFF 
+ 344      03598B
+ 345 121b FF03598C 		.ascii	"\377\003Y\214\377\003Y\214\377\004Y\215\377\003Z\215\377\003"
+ 345      FF03598C 
+ 345      FF04598D 
+ 345      FF035A8D 
+ 345      FF03
+ 346 122d 5A8DFF03 		.ascii	"Z\215\377\003Z\215\377\003Z\215\377\003Z\216\377\003Z\216\377"
+ 346      5A8DFF03 
+ 346      5A8DFF03 
+ 346      5A8EFF03 
+ 346      5A8EFF
+ 347 1240 035A8EFF 		.ascii	"\003Z\216\377\003[\216\377\003[\216\377\003[\217\377\003[\217"
+ 347      035B8EFF 
+ 347      035B8EFF 
+ 347      035B8FFF 
+ 347      035B8F
+ 348 1253 FF035B8F 		.ascii	"\377\003[\217\377\003[\217\377\003[\220\377\003\\\220\377\003"
+ 348      FF035B8F 
+ 348      FF035B90 
+ 348      FF035C90 
+ 348      FF03
+ 349 1265 5C90FF03 		.ascii	"\\\220\377\003\\\220\377\003\\\220\377\003\\\221\377\003\\\221"
+ 349      5C90FF03 
+ 349      5C90FF03 
+ 349      5C91FF03 
+ 349      5C91
+ 350 1277 FF035C91 		.ascii	"\377\003\\\221\377\003\\\221\377\003]\221\377\003]\222\377\003"
+ 350      FF035C91 
+ 350      FF035D91 
+ 350      FF035D92 
+ 350      FF03
+ 351 1289 5D92FF03 		.ascii	"]\222\377\003]\222\377\003]\222\377\003]\223\377\003]\223\377"
+ 351      5D92FF03 
+ 351      5D92FF03 
+ 351      5D93FF03 
+ 351      5D93FF
+ 352 129c 035E93FF 		.ascii	"\003^\223\377\003^\223\377\003^\223\377\003^\224\377\003^\224"
+ 352      035E93FF 
+ 352      035E93FF 
+ 352      035E94FF 
+ 352      035E94
+ 353 12af FF035E94 		.ascii	"\377\003^\224\377\003^\224\377\003_\224\377\003_\225\377\003"
+ 353      FF035E94 
+ 353      FF035F94 
+ 353      FF035F95 
+ 353      FF03
+ 354 12c1 5F95FF03 		.ascii	"_\225\377\003_\225\377\003_\225\377\003_\226\377\003_\226\377"
+ 354      5F95FF03 
+ 354      5F95FF03 
+ 354      5F96FF03 
+ 354      5F96FF
+GAS LISTING /tmp/cct9A39C.s 			page 24
+
+
+ 355 12d4 035F96FF 		.ascii	"\003_\226\377\003`\226\377\003`\226\377\003`\227\377\003`\227"
+ 355      036096FF 
+ 355      036096FF 
+ 355      036097FF 
+ 355      036097
+ 356 12e7 FF036097 		.ascii	"\377\003`\227\377\003`\227\377\003`\230\377\003a\230\377\003"
+ 356      FF036097 
+ 356      FF036098 
+ 356      FF036198 
+ 356      FF03
+ 357 12f9 6198FF03 		.ascii	"a\230\377\003a\230\377\003a\230\377\003a\231\377\003a\231\377"
+ 357      6198FF03 
+ 357      6198FF03 
+ 357      6199FF03 
+ 357      6199FF
+ 358 130c 036199FF 		.ascii	"\003a\231\377\003b\231\377\003b\231\377\003b\232\377\003b\232"
+ 358      036299FF 
+ 358      036299FF 
+ 358      03629AFF 
+ 358      03629A
+ 359 131f FF03629A 		.ascii	"\377\003b\232\377\004g\241\377\004g\242\377\004g\242\377\004"
+ 359      FF0467A1 
+ 359      FF0467A2 
+ 359      FF0467A2 
+ 359      FF04
+ 360 1331 67A2FF04 		.ascii	"g\242\377\004g\242\377\004g\242\377\004g\243\377\004h\243\377"
+ 360      67A2FF04 
+ 360      67A2FF04 
+ 360      67A3FF04 
+ 360      68A3FF
+ 361 1344 0468A3FF 		.ascii	"\004h\243\377\004h\243\377\004h\244\377\004h\244\377\004h\244"
+ 361      0468A3FF 
+ 361      0468A4FF 
+ 361      0468A4FF 
+ 361      0468A4
+ 362 1357 FF0468A4 		.ascii	"\377\004h\244\377\004i\244\377\004i\245\377\004i\245\377\004"
+ 362      FF0469A4 
+ 362      FF0469A5 
+ 362      FF0469A5 
+ 362      FF04
+ 363 1369 69A5FF04 		.ascii	"i\245\377\004i\245\377\004i\246\377\004i\246\377\004j\246\377"
+ 363      69A5FF04 
+ 363      69A6FF04 
+ 363      69A6FF04 
+ 363      6AA6FF
+ 364 137c 046AA6FF 		.ascii	"\004j\246\377\004j\246\377\004j\247\377\004j\247\377\004j\247"
+ 364      046AA6FF 
+ 364      046AA7FF 
+ 364      046AA7FF 
+ 364      046AA7
+ 365 138f FF046AA7 		.ascii	"\377\004j\247\377\004j\250\377\004k\250\377\004k\250\377\004"
+ 365      FF046AA8 
+ 365      FF046BA8 
+ 365      FF046BA8 
+ 365      FF04
+ 366 13a1 6BA8FF04 		.ascii	"k\250\377\004k\250\377\004k\251\377\004k\251\377\004k\251\377"
+ 366      6BA8FF04 
+GAS LISTING /tmp/cct9A39C.s 			page 25
+
+
+ 366      6BA9FF04 
+ 366      6BA9FF04 
+ 366      6BA9FF
+ 367 13b4 046CA9FF 		.ascii	"\004l\251\377\004l\251\377\004l\252\377\004l\252\377\004l\252"
+ 367      046CA9FF 
+ 367      046CAAFF 
+ 367      046CAAFF 
+ 367      046CAA
+ 368 13c7 FF046CAA 		.ascii	"\377\004l\252\377\004l\253\377\004m\253\377\004m\253\377\004"
+ 368      FF046CAB 
+ 368      FF046DAB 
+ 368      FF046DAB 
+ 368      FF04
+ 369 13d9 6DABFF04 		.ascii	"m\253\377\004m\253\377\004m\254\377\004m\254\377\004m\254\377"
+ 369      6DABFF04 
+ 369      6DACFF04 
+ 369      6DACFF04 
+ 369      6DACFF
+ 370 13ec 046EACFF 		.ascii	"\004n\254\377\004n\255\377\004n\255\377\004n\255\377\004n\255"
+ 370      046EADFF 
+ 370      046EADFF 
+ 370      046EADFF 
+ 370      046EAD
+ 371 13ff FF046EAD 		.ascii	"\377\004n\255\377\004n\256\377\004o\256\377\004o\256\377\004"
+ 371      FF046EAE 
+ 371      FF046FAE 
+ 371      FF046FAE 
+ 371      FF04
+ 372 1411 6FAEFF04 		.ascii	"o\256\377\004o\257\377\004o\257\377\004o\257\377\004o\257\377"
+ 372      6FAFFF04 
+ 372      6FAFFF04 
+ 372      6FAFFF04 
+ 372      6FAFFF
+ 373 1424 056FB0FF 		.ascii	"\005o\260\377\005p\260\377\005p\260\377\005p\260\377\006p\260"
+ 373      0570B0FF 
+ 373      0570B0FF 
+ 373      0570B0FF 
+ 373      0670B0
+ 374 1437 FF0671B0 		.ascii	"\377\006q\260\377\007q\260\377\007q\260\377\007q\260\377\bq\260"
+ 374      FF0771B0 
+ 374      FF0771B0 
+ 374      FF0771B0 
+ 374      FF0871B0 
+ 375 144b FF0872B1 		.ascii	"\377\br\261\377\br\261\377\tr\261\377\tr\261\377\tr\261\377\n"
+ 375      FF0872B1 
+ 375      FF0972B1 
+ 375      FF0972B1 
+ 375      FF0972B1 
+ 376 1461 73B1FF0A 		.ascii	"s\261\377\ns\261\377\013s\261\377\013s\261\377\013s\262\377\f"
+ 376      73B1FF0B 
+ 376      73B1FF0B 
+ 376      73B1FF0B 
+ 376      73B2FF0C 
+ 377 1475 74B2FF0C 		.ascii	"t\262\377\ft\262\377\ft\262\377\rt\262\377\rt\262\377\ru\262"
+ 377      74B2FF0C 
+ 377      74B2FF0D 
+ 377      74B2FF0D 
+GAS LISTING /tmp/cct9A39C.s 			page 26
+
+
+ 377      74B2FF0D 
+ 378 148b FF0E75B2 		.ascii	"\377\016u\262\377\016u\262\377\016u\263\377\017u\263\377\017"
+ 378      FF0E75B2 
+ 378      FF0E75B3 
+ 378      FF0F75B3 
+ 378      FF0F
+ 379 149d 76B3FF0F 		.ascii	"v\263\377\017v\263\377\020v\263\377\020v\263\377\020v\263\377"
+ 379      76B3FF10 
+ 379      76B3FF10 
+ 379      76B3FF10 
+ 379      76B3FF
+ 380 14b0 1177B3FF 		.ascii	"\021w\263\377\021w\263\377\021w\263\377\022w\264\377\022w\264"
+ 380      1177B3FF 
+ 380      1177B3FF 
+ 380      1277B4FF 
+ 380      1277B4
+ 381 14c3 FF1278B4 		.ascii	"\377\022x\264\377\023x\264\377\023x\264\377\023x\264\377\023"
+ 381      FF1378B4 
+ 381      FF1378B4 
+ 381      FF1378B4 
+ 381      FF13
+ 382 14d5 78B4FF14 		.ascii	"x\264\377\024y\264\377\024y\264\377\024y\265\377\025y\265\377"
+ 382      79B4FF14 
+ 382      79B4FF14 
+ 382      79B5FF15 
+ 382      79B5FF
+ 383 14e8 1579B5FF 		.ascii	"\025y\265\377\025z\265\377\026z\265\377\026z\265\377\026z\265"
+ 383      157AB5FF 
+ 383      167AB5FF 
+ 383      167AB5FF 
+ 383      167AB5
+ 384 14fb FF167AB5 		.ascii	"\377\026z\265\377\027{\265\377\027{\265\377\027{\266\377\030"
+ 384      FF177BB5 
+ 384      FF177BB5 
+ 384      FF177BB6 
+ 384      FF18
+ 385 150d 7BB6FF18 		.ascii	"{\266\377\030{\266\377\030|\266\377\031|\266\377\031|\266\377"
+ 385      7BB6FF18 
+ 385      7CB6FF19 
+ 385      7CB6FF19 
+ 385      7CB6FF
+ 386 1520 197CB6FF 		.ascii	"\031|\266\377#\203\271\377$\203\272\377$\203\272\377$\203\272"
+ 386      2383B9FF 
+ 386      2483BAFF 
+ 386      2483BAFF 
+ 386      2483BA
+ 387 1533 FF2484BA 		.ascii	"\377$\204\272\377%\204\272\377%\204\272\377%\204\272\377&\204"
+ 387      FF2584BA 
+ 387      FF2584BA 
+ 387      FF2584BA 
+ 387      FF2684
+ 388 1546 BAFF2685 		.ascii	"\272\377&\205\272\377&\205\272\377&\205\273\377'\205\273\377"
+ 388      BAFF2685 
+ 388      BAFF2685 
+ 388      BBFF2785 
+ 388      BBFF
+ 389 1558 2785BBFF 		.ascii	"'\205\273\377'\206\273\377(\206\273\377(\206\273\377(\206\273"
+GAS LISTING /tmp/cct9A39C.s 			page 27
+
+
+ 389      2786BBFF 
+ 389      2886BBFF 
+ 389      2886BBFF 
+ 389      2886BB
+ 390 156b FF2886BB 		.ascii	"\377(\206\273\377)\207\273\377)\207\273\377)\207\273\377*\207"
+ 390      FF2987BB 
+ 390      FF2987BB 
+ 390      FF2987BB 
+ 390      FF2A87
+ 391 157e BCFF2A87 		.ascii	"\274\377*\207\274\377*\210\274\377*\210\274\377+\210\274\377"
+ 391      BCFF2A88 
+ 391      BCFF2A88 
+ 391      BCFF2B88 
+ 391      BCFF
+ 392 1590 2B88BCFF 		.ascii	"+\210\274\377+\210\274\377,\211\274\377,\211\274\377,\211\274"
+ 392      2B88BCFF 
+ 392      2C89BCFF 
+ 392      2C89BCFF 
+ 392      2C89BC
+ 393 15a3 FF2C89BD 		.ascii	"\377,\211\275\377-\211\275\377-\212\275\377-\212\275\377.\212"
+ 393      FF2D89BD 
+ 393      FF2D8ABD 
+ 393      FF2D8ABD 
+ 393      FF2E8A
+ 394 15b6 BDFF2E8A 		.ascii	"\275\377.\212\275\377.\212\275\377.\213\275\377/\213\275\377"
+ 394      BDFF2E8A 
+ 394      BDFF2E8B 
+ 394      BDFF2F8B 
+ 394      BDFF
+ 395 15c8 2F8BBDFF 		.ascii	"/\213\275\377/\213\275\3770\213\276\3770\214\276\3770\214\276"
+ 395      2F8BBDFF 
+ 395      308BBEFF 
+ 395      308CBEFF 
+ 395      308CBE
+ 396 15db FF308CBE 		.ascii	"\3770\214\276\3771\214\276\3771\214\276\3771\215\276\3772\215"
+ 396      FF318CBE 
+ 396      FF318CBE 
+ 396      FF318DBE 
+ 396      FF328D
+ 397 15ee BEFF328D 		.ascii	"\276\3772\215\276\3772\215\276\3772\215\276\3773\216\277\377"
+ 397      BEFF328D 
+ 397      BEFF328D 
+ 397      BEFF338E 
+ 397      BFFF
+ 398 1600 338EBFFF 		.ascii	"3\216\277\3773\216\277\3774\216\277\3774\216\277\3774\217\277"
+ 398      338EBFFF 
+ 398      348EBFFF 
+ 398      348EBFFF 
+ 398      348FBF
+ 399 1613 FF348FBF 		.ascii	"\3774\217\277\3775\217\277\3775\217\277\3775\217\277\3776\220"
+ 399      FF358FBF 
+ 399      FF358FBF 
+ 399      FF358FBF 
+ 399      FF3690
+ 400 1626 C0FF3690 		.ascii	"\300\3776\220\300\3777\220\300\3777\220\300\3778\220\300\377"
+ 400      C0FF3790 
+ 400      C0FF3790 
+GAS LISTING /tmp/cct9A39C.s 			page 28
+
+
+ 400      C0FF3890 
+ 400      C0FF
+ 401 1638 3890C0FF 		.ascii	"8\220\300\3779\220\300\3779\221\300\377:\221\300\377:\221\300"
+ 401      3990C0FF 
+ 401      3991C0FF 
+ 401      3A91C0FF 
+ 401      3A91C0
+ 402 164b FF3B91C0 		.ascii	"\377;\221\300\377;\221\301\377<\221\301\377<\221\301\377=\222"
+ 402      FF3B91C1 
+ 402      FF3C91C1 
+ 402      FF3C91C1 
+ 402      FF3D92
+ 403 165e C1FF3D92 		.ascii	"\301\377=\222\301\377>\222\301\377>\222\301\377>\222\301\377"
+ 403      C1FF3E92 
+ 403      C1FF3E92 
+ 403      C1FF3E92 
+ 403      C1FF
+ 404 1670 3F92C1FF 		.ascii	"?\222\301\377?\223\301\377@\223\301\377@\223\302\377A\223\302"
+ 404      3F93C1FF 
+ 404      4093C1FF 
+ 404      4093C2FF 
+ 404      4193C2
+ 405 1683 FF4193C2 		.ascii	"\377A\223\302\377B\223\302\377B\224\302\377B\224\302\377C\224"
+ 405      FF4293C2 
+ 405      FF4294C2 
+ 405      FF4294C2 
+ 405      FF4394
+ 406 1696 C2FF4394 		.ascii	"\302\377C\224\302\377D\224\302\377D\224\302\377E\224\303\377"
+ 406      C2FF4494 
+ 406      C2FF4494 
+ 406      C2FF4594 
+ 406      C3FF
+ 407 16a8 4595C3FF 		.ascii	"E\225\303\377E\225\303\377F\225\303\377F\225\303\377G\225\303"
+ 407      4595C3FF 
+ 407      4695C3FF 
+ 407      4695C3FF 
+ 407      4795C3
+ 408 16bb FF4795C3 		.ascii	"\377G\225\303\377H\226\303\377H\226\303\377H\226\303\377I\226"
+ 408      FF4896C3 
+ 408      FF4896C3 
+ 408      FF4896C3 
+ 408      FF4996
+ 409 16ce C3FF4996 		.ascii	"\303\377I\226\304\377J\226\304\377J\226\304\377J\227\304\377"
+ 409      C4FF4A96 
+ 409      C4FF4A96 
+ 409      C4FF4A97 
+ 409      C4FF
+ 410 16e0 4B97C4FF 		.ascii	"K\227\304\377K\227\304\377L\227\304\377L\227\304\377L\227\304"
+ 410      4B97C4FF 
+ 410      4C97C4FF 
+ 410      4C97C4FF 
+ 410      4C97C4
+ 411 16f3 FF4D98C4 		.ascii	"\377M\230\304\377M\230\304\377N\230\305\377N\230\305\377N\230"
+ 411      FF4D98C4 
+ 411      FF4E98C5 
+ 411      FF4E98C5 
+ 411      FF4E98
+GAS LISTING /tmp/cct9A39C.s 			page 29
+
+
+ 412 1706 C5FF4F98 		.ascii	"\305\377O\230\305\377O\230\305\377O\231\305\377P\231\305\377"
+ 412      C5FF4F98 
+ 412      C5FF4F99 
+ 412      C5FF5099 
+ 412      C5FF
+ 413 1718 5099C5FF 		.ascii	"P\231\305\377Q\231\305\377Q\231\305\377^\236\311\377^\237\311"
+ 413      5199C5FF 
+ 413      5199C5FF 
+ 413      5E9EC9FF 
+ 413      5E9FC9
+ 414 172b FF5E9FC9 		.ascii	"\377^\237\311\377_\237\311\377_\237\311\377`\237\311\377`\237"
+ 414      FF5F9FC9 
+ 414      FF5F9FC9 
+ 414      FF609FC9 
+ 414      FF609F
+ 415 173e C9FF60A0 		.ascii	"\311\377`\240\311\377a\240\311\377a\240\311\377a\240\311\377"
+ 415      C9FF61A0 
+ 415      C9FF61A0 
+ 415      C9FF61A0 
+ 415      C9FF
+ 416 1750 62A0CAFF 		.ascii	"b\240\312\377b\240\312\377b\240\312\377c\241\312\377c\241\312"
+ 416      62A0CAFF 
+ 416      62A0CAFF 
+ 416      63A1CAFF 
+ 416      63A1CA
+ 417 1763 FF63A1CA 		.ascii	"\377c\241\312\377d\241\312\377d\241\312\377e\241\312\377e\242"
+ 417      FF64A1CA 
+ 417      FF64A1CA 
+ 417      FF65A1CA 
+ 417      FF65A2
+ 418 1776 CAFF65A2 		.ascii	"\312\377e\242\312\377f\242\313\377f\242\313\377f\242\313\377"
+ 418      CAFF66A2 
+ 418      CBFF66A2 
+ 418      CBFF66A2 
+ 418      CBFF
+ 419 1788 67A2CBFF 		.ascii	"g\242\313\377g\242\313\377g\243\313\377h\243\313\377h\243\313"
+ 419      67A2CBFF 
+ 419      67A3CBFF 
+ 419      68A3CBFF 
+ 419      68A3CB
+ 420 179b FF68A3CB 		.ascii	"\377h\243\313\377i\243\313\377i\243\314\377i\244\314\377j\244"
+ 420      FF69A3CB 
+ 420      FF69A3CC 
+ 420      FF69A4CC 
+ 420      FF6AA4
+ 421 17ae CCFF6AA4 		.ascii	"\314\377j\244\314\377j\244\314\377k\244\314\377k\244\314\377"
+ 421      CCFF6AA4 
+ 421      CCFF6BA4 
+ 421      CCFF6BA4 
+ 421      CCFF
+ 422 17c0 6BA5CCFF 		.ascii	"k\245\314\377l\245\314\377l\245\314\377l\245\314\377m\245\315"
+ 422      6CA5CCFF 
+ 422      6CA5CCFF 
+ 422      6CA5CCFF 
+ 422      6DA5CD
+ 423 17d3 FF6DA5CD 		.ascii	"\377m\245\315\377m\245\315\377n\246\315\377n\246\315\377n\246"
+ 423      FF6DA5CD 
+GAS LISTING /tmp/cct9A39C.s 			page 30
+
+
+ 423      FF6EA6CD 
+ 423      FF6EA6CD 
+ 423      FF6EA6
+ 424 17e6 CDFF6FA6 		.ascii	"\315\377o\246\315\377o\246\315\377"
+ 424      CDFF6FA6 
+ 424      CDFF
+ 425 17f0 6FA6CDFF 		.ascii	"o\246\315\377p\247\315\377p\247\315\377p\247\316\377q\247\316"
+ 425      70A7CDFF 
+ 425      70A7CDFF 
+ 425      70A7CEFF 
+ 425      71A7CE
+ 426 1803 FF71A7CE 		.ascii	"\377q\247\316\377q\247\316\377r\250\316\377r\250\316\377r\250"
+ 426      FF71A7CE 
+ 426      FF72A8CE 
+ 426      FF72A8CE 
+ 426      FF72A8
+ 427 1816 CEFF73A8 		.ascii	"\316\377s\250\316\377s\250\316\377s\250\316\377t\251\317\377"
+ 427      CEFF73A8 
+ 427      CEFF73A8 
+ 427      CEFF74A9 
+ 427      CFFF
+ 428 1828 74A9CFFF 		.ascii	"t\251\317\377t\251\317\377u\251\317\377u\251\317\377u\251\317"
+ 428      74A9CFFF 
+ 428      75A9CFFF 
+ 428      75A9CFFF 
+ 428      75A9CF
+ 429 183b FF76A9CF 		.ascii	"\377v\251\317\377v\251\317\377v\251\317\377w\252\317\377w\252"
+ 429      FF76A9CF 
+ 429      FF76A9CF 
+ 429      FF77AACF 
+ 429      FF77AA
+ 430 184e CFFF77AA 		.ascii	"\317\377w\252\317\377x\252\320\377x\252\320\377x\252\320\377"
+ 430      CFFF78AA 
+ 430      D0FF78AA 
+ 430      D0FF78AA 
+ 430      D0FF
+ 431 1860 79AAD0FF 		.ascii	"y\252\320\377y\252\320\377y\253\320\377z\253\320\377z\253\320"
+ 431      79AAD0FF 
+ 431      79ABD0FF 
+ 431      7AABD0FF 
+ 431      7AABD0
+ 432 1873 FF7AABD0 		.ascii	"\377z\253\320\377{\253\320\377{\253\320\377|\253\320\377|\253"
+ 432      FF7BABD0 
+ 432      FF7BABD0 
+ 432      FF7CABD0 
+ 432      FF7CAB
+ 433 1886 D1FF7CAC 		.ascii	"\321\377|\254\321\377}\254\321\377}\254\321\377}\254\321\377"
+ 433      D1FF7DAC 
+ 433      D1FF7DAC 
+ 433      D1FF7DAC 
+ 433      D1FF
+ 434 1898 7EACD1FF 		.ascii	"~\254\321\377~\254\321\377~\254\321\377\177\254\321\377\177\254"
+ 434      7EACD1FF 
+ 434      7EACD1FF 
+ 434      7FACD1FF 
+ 434      7FAC
+ 435 18aa D1FF7FAD 		.ascii	"\321\377\177\255\321\377\200\255\321\377\200\255\321\377\200"
+GAS LISTING /tmp/cct9A39C.s 			page 31
+
+
+ 435      D1FF80AD 
+ 435      D1FF80AD 
+ 435      D1FF80
+ 436 18b9 ADD2FF81 		.ascii	"\255\322\377\201\255\322\377\201\255\322\377\201\255\322\377"
+ 436      ADD2FF81 
+ 436      ADD2FF81 
+ 436      ADD2FF
+ 437 18c8 81ADD2FF 		.ascii	"\201\255\322\377\202\256\322\377\202\256\322\377\202\256\322"
+ 437      82AED2FF 
+ 437      82AED2FF 
+ 437      82AED2
+ 438 18d7 FF83AED2 		.ascii	"\377\203\256\322\377\203\256\322\377\203\256\322\377\204\256"
+ 438      FF83AED2 
+ 438      FF83AED2 
+ 438      FF84AE
+ 439 18e6 D2FF84AE 		.ascii	"\322\377\204\256\322\377\204\257\323\377\205\257\323\377\205"
+ 439      D2FF84AF 
+ 439      D3FF85AF 
+ 439      D3FF85
+ 440 18f5 AFD3FF85 		.ascii	"\257\323\377\205\257\323\377\206\257\323\377\206\257\323\377"
+ 440      AFD3FF86 
+ 440      AFD3FF86 
+ 440      AFD3FF
+ 441 1904 86AFD3FF 		.ascii	"\206\257\323\377\207\257\323\377\207\260\323\377\207\260\323"
+ 441      87AFD3FF 
+ 441      87B0D3FF 
+ 441      87B0D3
+ 442 1913 FF88B0D3 		.ascii	"\377\210\260\323\377\210\260\323\377\210\260\323\377\210\260"
+ 442      FF88B0D3 
+ 442      FF88B0D3 
+ 442      FF88B0
+ 443 1922 D4FF93B4 		.ascii	"\324\377\223\264\326\377\223\264\326\377\223\265\326\377\224"
+ 443      D6FF93B4 
+ 443      D6FF93B5 
+ 443      D6FF94
+ 444 1931 B5D6FF94 		.ascii	"\265\326\377\224\265\326\377\224\265\326\377\225\265\326\377"
+ 444      B5D6FF94 
+ 444      B5D6FF95 
+ 444      B5D6FF
+ 445 1940 95B5D7FF 		.ascii	"\225\265\327\377\225\265\327\377\226\265\327\377\226\266\327"
+ 445      95B5D7FF 
+ 445      96B5D7FF 
+ 445      96B6D7
+ 446 194f FF96B6D7 		.ascii	"\377\226\266\327\377\226\266\327\377\227\266\327\377\227\266"
+ 446      FF96B6D7 
+ 446      FF97B6D7 
+ 446      FF97B6
+ 447 195e D7FF97B6 		.ascii	"\327\377\227\266\327\377\230\266\327\377\230\266\327\377\230"
+ 447      D7FF98B6 
+ 447      D7FF98B6 
+ 447      D7FF98
+ 448 196d B7D7FF99 		.ascii	"\267\327\377\231\267\327\377\231\267\327\377\231\267\330\377"
+ 448      B7D7FF99 
+ 448      B7D7FF99 
+ 448      B7D8FF
+ 449 197c 99B7D8FF 		.ascii	"\231\267\330\377\232\267\330\377\232\267\330\377\232\267\330"
+ 449      9AB7D8FF 
+GAS LISTING /tmp/cct9A39C.s 			page 32
+
+
+ 449      9AB7D8FF 
+ 449      9AB7D8
+ 450 198b FF9BB8D8 		.ascii	"\377\233\270\330\377\233\270\330\377\233\270\330\377\234\270"
+ 450      FF9BB8D8 
+ 450      FF9BB8D8 
+ 450      FF9CB8
+ 451 199a D8FF9CB8 		.ascii	"\330\377\234\270\330\377\234\270\330\377\234\270\330\377\235"
+ 451      D8FF9CB8 
+ 451      D8FF9CB8 
+ 451      D8FF9D
+ 452 19a9 B8D8FF9D 		.ascii	"\270\330\377\235\271\330\377\235\271\331\377\236\271\331\377"
+ 452      B9D8FF9D 
+ 452      B9D9FF9E 
+ 452      B9D9FF
+ 453 19b8 9EB9D9FF 		.ascii	"\236\271\331\377\236\271\331\377\236\271\331\377\237\271\331"
+ 453      9EB9D9FF 
+ 453      9EB9D9FF 
+ 453      9FB9D9
+ 454 19c7 FF9FBAD9 		.ascii	"\377\237\272\331\377\237\272\331\377\240\272\331\377\240\272"
+ 454      FF9FBAD9 
+ 454      FFA0BAD9 
+ 454      FFA0BA
+ 455 19d6 D9FFA0BA 		.ascii	"\331\377\240\272\331\377\240\272\331\377\241\272\331\377\241"
+ 455      D9FFA0BA 
+ 455      D9FFA1BA 
+ 455      D9FFA1
+ 456 19e5 BAD9FFA1 		.ascii	"\272\331\377\241\273\331\377\242\273\332\377\242\273\332\377"
+ 456      BBD9FFA2 
+ 456      BBDAFFA2 
+ 456      BBDAFF
+ 457 19f4 A2BBDAFF 		.ascii	"\242\273\332\377\242\273\332\377\243\273\332\377\243\273\332"
+ 457      A2BBDAFF 
+ 457      A3BBDAFF 
+ 457      A3BBDA
+ 458 1a03 FFA3BBDA 		.ascii	"\377\243\273\332\377\244\274\332\377\244\274\332\377\244\274"
+ 458      FFA4BCDA 
+ 458      FFA4BCDA 
+ 458      FFA4BC
+ 459 1a12 DAFFA4BC 		.ascii	"\332\377\244\274\332\377\245\274\332\377\245\274\332\377\245"
+ 459      DAFFA5BC 
+ 459      DAFFA5BC 
+ 459      DAFFA5
+ 460 1a21 BCDAFFA5 		.ascii	"\274\332\377\245\275\332\377\246\275\333\377\246\275\333\377"
+ 460      BDDAFFA6 
+ 460      BDDBFFA6 
+ 460      BDDBFF
+ 461 1a30 A6BDDBFF 		.ascii	"\246\275\333\377\247\275\333\377\247\275\333\377\247\275\333"
+ 461      A7BDDBFF 
+ 461      A7BDDBFF 
+ 461      A7BDDB
+ 462 1a3f FFA8BDDB 		.ascii	"\377\250\275\333\377\250\275\333\377\250\276\333\377\250\276"
+ 462      FFA8BDDB 
+ 462      FFA8BEDB 
+ 462      FFA8BE
+ 463 1a4e DBFFA9BE 		.ascii	"\333\377\251\276\333\377\251\276\333\377\251\276\334\377\252"
+ 463      DBFFA9BE 
+ 463      DBFFA9BE 
+GAS LISTING /tmp/cct9A39C.s 			page 33
+
+
+ 463      DCFFAA
+ 464 1a5d BEDCFFAA 		.ascii	"\276\334\377\252\276\334\377\252\276\334\377\253\276\334\377"
+ 464      BEDCFFAA 
+ 464      BEDCFFAB 
+ 464      BEDCFF
+ 465 1a6c ABBFDCFF 		.ascii	"\253\277\334\377\253\277\334\377\253\277\334\377\254\277\334"
+ 465      ABBFDCFF 
+ 465      ABBFDCFF 
+ 465      ACBFDC
+ 466 1a7b FFACBFDC 		.ascii	"\377\254\277\334\377\254\277\334\377\255\277\334\377\255\277"
+ 466      FFACBFDC 
+ 466      FFADBFDC 
+ 466      FFADBF
+ 467 1a8a DCFFADC0 		.ascii	"\334\377\255\300\335\377\255\300\335\377\256\300\335\377\256"
+ 467      DDFFADC0 
+ 467      DDFFAEC0 
+ 467      DDFFAE
+ 468 1a99 C0DDFFAE 		.ascii	"\300\335\377\256\300\335\377\257\300\335\377\257\300\335\377"
+ 468      C0DDFFAF 
+ 468      C0DDFFAF 
+ 468      C0DDFF
+ 469 1aa8 AFC0DDFF 		.ascii	"\257\300\335\377\257\300\335\377\260\301\335\377\260\301\335"
+ 469      AFC0DDFF 
+ 469      B0C1DDFF 
+ 469      B0C1DD
+ 470 1ab7 FFB0C1DD 		.ascii	"\377\260\301\335\377\260\301\335\377\261\301\335\377\261\301"
+ 470      FFB0C1DD 
+ 470      FFB1C1DD 
+ 470      FFB1C1
+ 471 1ac6 DEFFB1C1 		.ascii	"\336\377\261\301\336\377\262\301\336\377\262\302\336\377\262"
+ 471      DEFFB2C1 
+ 471      DEFFB2C2 
+ 471      DEFFB2
+ 472 1ad5 C2DEFFB2 		.ascii	"\302\336\377\262\302\336\377\263\302\336\377\263\302\336\377"
+ 472      C2DEFFB3 
+ 472      C2DEFFB3 
+ 472      C2DEFF
+ 473 1ae4 B3C2DEFF 		.ascii	"\263\302\336\377\264\302\336\377\264\302\336\377\264\303\336"
+ 473      B4C2DEFF 
+ 473      B4C2DEFF 
+ 473      B4C3DE
+ 474 1af3 FFB4C3DE 		.ascii	"\377\264\303\336\377\265\303\336\377\265\303\337\377\265\303"
+ 474      FFB5C3DE 
+ 474      FFB5C3DF 
+ 474      FFB5C3
+ 475 1b02 DFFFB5C3 		.ascii	"\337\377\265\303\337\377\266\303\337\377\266\303\337\377\266"
+ 475      DFFFB6C3 
+ 475      DFFFB6C3 
+ 475      DFFFB6
+ 476 1b11 C4DFFFB6 		.ascii	"\304\337\377\266\304\337\377\267\304\337\377\267\304\337\377"
+ 476      C4DFFFB7 
+ 476      C4DFFFB7 
+ 476      C4DFFF
+ 477 1b20 B7C4DFFF 		.ascii	"\267\304\337\377\300\310\341\377\300\310\341\377\300\310\342"
+ 477      C0C8E1FF 
+ 477      C0C8E1FF 
+ 477      C0C8E2
+GAS LISTING /tmp/cct9A39C.s 			page 34
+
+
+ 478 1b2f FFC1C9E2 		.ascii	"\377\301\311\342\377\301\311\342\377\301\311\342\377\301\311"
+ 478      FFC1C9E2 
+ 478      FFC1C9E2 
+ 478      FFC1C9
+ 479 1b3e E2FFC2C9 		.ascii	"\342\377\302\311\342\377\302\311\342\377\302\311\342\377\303"
+ 479      E2FFC2C9 
+ 479      E2FFC2C9 
+ 479      E2FFC3
+ 480 1b4d C9E2FFC3 		.ascii	"\311\342\377\303\312\342\377\303\312\342\377\303\312\342\377"
+ 480      CAE2FFC3 
+ 480      CAE2FFC3 
+ 480      CAE2FF
+ 481 1b5c C4CAE2FF 		.ascii	"\304\312\342\377\304\312\342\377\304\312\342\377\304\312\343"
+ 481      C4CAE2FF 
+ 481      C4CAE2FF 
+ 481      C4CAE3
+ 482 1b6b FFC5CAE3 		.ascii	"\377\305\312\343\377\305\313\343\377\305\313\343\377\305\313"
+ 482      FFC5CBE3 
+ 482      FFC5CBE3 
+ 482      FFC5CB
+ 483 1b7a E3FFC6CB 		.ascii	"\343\377\306\313\343\377\306\313\343\377\306\313\343\377\306"
+ 483      E3FFC6CB 
+ 483      E3FFC6CB 
+ 483      E3FFC6
+ 484 1b89 CBE3FFC7 		.ascii	"\313\343\377\307\313\343\377\307\314\343\377\307\314\343\377"
+ 484      CBE3FFC7 
+ 484      CCE3FFC7 
+ 484      CCE3FF
+ 485 1b98 C7CCE3FF 		.ascii	"\307\314\343\377\310\314\343\377\310\314\343\377\310\314\344"
+ 485      C8CCE3FF 
+ 485      C8CCE3FF 
+ 485      C8CCE4
+ 486 1ba7 FFC8CCE4 		.ascii	"\377\310\314\344\377\311\314\344\377\311\315\344\377\311\315"
+ 486      FFC9CCE4 
+ 486      FFC9CDE4 
+ 486      FFC9CD
+ 487 1bb6 E4FFC9CD 		.ascii	"\344\377\311\315\344\377\311\315\344\377\312\315\344\377\312"
+ 487      E4FFC9CD 
+ 487      E4FFCACD 
+ 487      E4FFCA
+ 488 1bc5 CDE4FFCA 		.ascii	"\315\344\377\312\315\344\377\312\316\344\377\313\316\344\377"
+ 488      CDE4FFCA 
+ 488      CEE4FFCB 
+ 488      CEE4FF
+ 489 1bd4 CBCEE4FF 		.ascii	"\313\316\344\377\313\316\344\377\313\316\344\377\314\316\344"
+ 489      CBCEE4FF 
+ 489      CBCEE4FF 
+ 489      CCCEE4
+ 490 1be3 FFCCCEE5 		.ascii	"\377\314\316\345\377\314\316\345\377\314\317\345\377\315\317"
+ 490      FFCCCEE5 
+ 490      FFCCCFE5 
+ 490      FFCDCF
+ 491 1bf2 E5FFCDCF 		.ascii	"\345\377\315\317\345\377\315\317\345\377\315\317\345\377\315"
+ 491      E5FFCDCF 
+ 491      E5FFCDCF 
+ 491      E5FFCD
+ 492 1c01 CFE5FFCE 		.ascii	"\317\345\377\316\317\345\377\316\320\345\377\316\320\345\377"
+GAS LISTING /tmp/cct9A39C.s 			page 35
+
+
+ 492      CFE5FFCE 
+ 492      D0E5FFCE 
+ 492      D0E5FF
+ 493 1c10 CED0E5FF 		.ascii	"\316\320\345\377\317\320\345\377\317\320\345\377\317\320\345"
+ 493      CFD0E5FF 
+ 493      CFD0E5FF 
+ 493      CFD0E5
+ 494 1c1f FFCFD0E5 		.ascii	"\377\317\320\345\377\317\321\345\377\320\321\346\377\320\321"
+ 494      FFCFD1E5 
+ 494      FFD0D1E6 
+ 494      FFD0D1
+ 495 1c2e E6FFD0D1 		.ascii	"\346\377\320\321\346\377\320\321\346\377\320\321\346\377\321"
+ 495      E6FFD0D1 
+ 495      E6FFD0D1 
+ 495      E6FFD1
+ 496 1c3d D1E6FFD1 		.ascii	"\321\346\377\321\321\346\377\321\322\346\377\321\322\346\377"
+ 496      D1E6FFD1 
+ 496      D2E6FFD1 
+ 496      D2E6FF
+ 497 1c4c D1D2E6FF 		.ascii	"\321\322\346\377\322\322\346\377\322\322\346\377\322\322\346"
+ 497      D2D2E6FF 
+ 497      D2D2E6FF 
+ 497      D2D2E6
+ 498 1c5b FFD2D2E7 		.ascii	"\377\322\322\347\377\322\322\347\377\323\323\347\377\323\323"
+ 498      FFD2D2E7 
+ 498      FFD3D3E7 
+ 498      FFD3D3
+ 499 1c6a E7FFD3D3 		.ascii	"\347\377\323\323\347\377\323\323\347\377\323\323\347\377\324"
+ 499      E7FFD3D3 
+ 499      E7FFD3D3 
+ 499      E7FFD4
+ 500 1c79 D3E7FFD4 		.ascii	"\323\347\377\324\323\347\377\324\324\347\377\324\324\347\377"
+ 500      D3E7FFD4 
+ 500      D4E7FFD4 
+ 500      D4E7FF
+ 501 1c88 D4D4E7FF 		.ascii	"\324\324\347\377\325\324\347\377\325\324\347\377\325\324\350"
+ 501      D5D4E7FF 
+ 501      D5D4E7FF 
+ 501      D5D4E8
+ 502 1c97 FFD5D4E8 		.ascii	"\377\325\324\350\377\325\324\350\377\325\325\350\377\326\325"
+ 502      FFD5D4E8 
+ 502      FFD5D5E8 
+ 502      FFD6D5
+ 503 1ca6 E8FFD6D5 		.ascii	"\350\377\326\325\350\377\326\325\350\377\326\325\350\377\326"
+ 503      E8FFD6D5 
+ 503      E8FFD6D5 
+ 503      E8FFD6
+ 504 1cb5 D5E8FFD7 		.ascii	"\325\350\377\327\325\350\377\327\326\350\377\327\326\350\377"
+ 504      D5E8FFD7 
+ 504      D6E8FFD7 
+ 504      D6E8FF
+ 505 1cc4 D7D6E8FF 		.ascii	"\327\326\350\377\327\326\350\377\330\326\351\377\330\326\351"
+ 505      D7D6E8FF 
+ 505      D8D6E9FF 
+ 505      D8D6E9
+ 506 1cd3 FFD8D6E9 		.ascii	"\377\330\326\351\377\330\326\351\377\330\327\351\377\330\327"
+ 506      FFD8D6E9 
+GAS LISTING /tmp/cct9A39C.s 			page 36
+
+
+ 506      FFD8D7E9 
+ 506      FFD8D7
+ 507 1ce2 E9FFD9D7 		.ascii	"\351\377\331\327\351\377\331\327\351\377\331\327\351\377\331"
+ 507      E9FFD9D7 
+ 507      E9FFD9D7 
+ 507      E9FFD9
+ 508 1cf1 D7E9FFD9 		.ascii	"\327\351\377\331\327\351\377\331\330\351\377\332\330\351\377"
+ 508      D7E9FFD9 
+ 508      D8E9FFDA 
+ 508      D8E9FF
+ 509 1d00 DAD8E9FF 		.ascii	"\332\330\351\377\332\330\352\377\332\330\352\377\332\330\352"
+ 509      DAD8EAFF 
+ 509      DAD8EAFF 
+ 509      DAD8EA
+ 510 1d0f FFDBD8EA 		.ascii	"\377\333\330\352\377\333\330\352\377\333\331\352\377\333\331"
+ 510      FFDBD8EA 
+ 510      FFDBD9EA 
+ 510      FFDBD9
+ 511 1d1e EAFFDBD9 		.ascii	"\352\377\333\331\352\377\341\335\355\377\341\336\355\377\341"
+ 511      EAFFE1DD 
+ 511      EDFFE1DE 
+ 511      EDFFE1
+ 512 1d2d DEEDFFE2 		.ascii	"\336\355\377\342\336\355\377\342\336\355\377\342\336\355\377"
+ 512      DEEDFFE2 
+ 512      DEEDFFE2 
+ 512      DEEDFF
+ 513 1d3c E2DEEDFF 		.ascii	"\342\336\355\377\342\336\355\377\342\337\355\377\343\337\355"
+ 513      E2DEEDFF 
+ 513      E2DFEDFF 
+ 513      E3DFED
+ 514 1d4b FFE3DFED 		.ascii	"\377\343\337\355\377\343\337\355\377\343\337\355\377\343\337"
+ 514      FFE3DFED 
+ 514      FFE3DFED 
+ 514      FFE3DF
+ 515 1d5a EEFFE3DF 		.ascii	"\356\377\343\337\356\377\344\340\356\377\344\340\356\377\344"
+ 515      EEFFE4E0 
+ 515      EEFFE4E0 
+ 515      EEFFE4
+ 516 1d69 E0EEFFE4 		.ascii	"\340\356\377\344\340\356\377\344\340\356\377\344\340\356\377"
+ 516      E0EEFFE4 
+ 516      E0EEFFE4 
+ 516      E0EEFF
+ 517 1d78 E5E0EEFF 		.ascii	"\345\340\356\377\345\341\356\377\345\341\356\377\345\341\356"
+ 517      E5E1EEFF 
+ 517      E5E1EEFF 
+ 517      E5E1EE
+ 518 1d87 FFE5E1EE 		.ascii	"\377\345\341\356\377\345\341\357\377\346\341\357\377\346\341"
+ 518      FFE5E1EF 
+ 518      FFE6E1EF 
+ 518      FFE6E1
+ 519 1d96 EFFFE6E1 		.ascii	"\357\377\346\341\357\377\346\342\357\377\346\342\357\377\346"
+ 519      EFFFE6E2 
+ 519      EFFFE6E2 
+ 519      EFFFE6
+ 520 1da5 E2EFFFE7 		.ascii	"\342\357\377\347\342\357\377\347\342\357\377\347\342\357\377"
+ 520      E2EFFFE7 
+ 520      E2EFFFE7 
+GAS LISTING /tmp/cct9A39C.s 			page 37
+
+
+ 520      E2EFFF
+ 521 1db4 E7E2EFFF 		.ascii	"\347\342\357\377\347\343\357\377\347\343\357\377\350\343\360"
+ 521      E7E3EFFF 
+ 521      E7E3EFFF 
+ 521      E8E3F0
+ 522 1dc3 FFE8E3F0 		.ascii	"\377\350\343\360\377\350\343\360\377\350\343\360\377\350\343"
+ 522      FFE8E3F0 
+ 522      FFE8E3F0 
+ 522      FFE8E3
+ 523 1dd2 F0FFE8E4 		.ascii	"\360\377\350\344\360\377\351\344\360\377\351\344\360\377\351"
+ 523      F0FFE9E4 
+ 523      F0FFE9E4 
+ 523      F0FFE9
+ 524 1de1 E4F0FFE9 		.ascii	"\344\360\377\351\344\360\377\351\344\360\377\351\344\360\377"
+ 524      E4F0FFE9 
+ 524      E4F0FFE9 
+ 524      E4F0FF
+ 525 1df0 E9E5F0FF 		.ascii	"\351\345\360\377\352\345\361\377\352\345\361\377\352\345\361"
+ 525      EAE5F1FF 
+ 525      EAE5F1FF 
+ 525      EAE5F1
+ 526 1dff FFEAE5F1 		.ascii	"\377\352\345\361\377\352\345\361\377\352\345\361\377\353\346"
+ 526      FFEAE5F1 
+ 526      FFEAE5F1 
+ 526      FFEBE6
+ 527 1e0e F1FFEBE6 		.ascii	"\361\377\353\346\361\377\353\346\361\377\353\346\361\377\353"
+ 527      F1FFEBE6 
+ 527      F1FFEBE6 
+ 527      F1FFEB
+ 528 1e1d E6F1FFEB 		.ascii	"\346\361\377\353\346\361\377\353\347\361\377\354\347\362\377"
+ 528      E6F1FFEB 
+ 528      E7F1FFEC 
+ 528      E7F2FF
+ 529 1e2c ECE7F2FF 		.ascii	"\354\347\362\377\354\347\362\377\354\347\362\377\354\347\362"
+ 529      ECE7F2FF 
+ 529      ECE7F2FF 
+ 529      ECE7F2
+ 530 1e3b FFECE7F2 		.ascii	"\377\354\347\362\377\354\347\362\377\355\347\362\377\355\347"
+ 530      FFECE7F2 
+ 530      FFEDE7F2 
+ 530      FFEDE7
+ 531 1e4a F2FFEDE7 		.ascii	"\362\377\355\347\362\377\355\350\362\377\355\350\362\377\355"
+ 531      F2FFEDE8 
+ 531      F2FFEDE8 
+ 531      F2FFED
+ 532 1e59 E8F2FFED 		.ascii	"\350\362\377\355\350\362\377\356\350\362\377\356\350\362\377"
+ 532      E8F2FFEE 
+ 532      E8F2FFEE 
+ 532      E8F2FF
+ 533 1e68 EEE8F2FF 		.ascii	"\356\350\362\377\356\350\362\377\356\350\362\377\356\350\363"
+ 533      EEE8F2FF 
+ 533      EEE8F2FF 
+ 533      EEE8F3
+ 534 1e77 FFEEE8F3 		.ascii	"\377\356\350\363\377\357\351\363\377\357\351\363\377\357\351"
+ 534      FFEFE9F3 
+ 534      FFEFE9F3 
+ 534      FFEFE9
+GAS LISTING /tmp/cct9A39C.s 			page 38
+
+
+ 535 1e86 F3FFEFE9 		.ascii	"\363\377\357\351\363\377\357\351\363\377\357\351\363\377\357"
+ 535      F3FFEFE9 
+ 535      F3FFEFE9 
+ 535      F3FFEF
+ 536 1e95 E9F3FFF0 		.ascii	"\351\363\377\360\351\363\377\360\351\363\377\360\351\363\377"
+ 536      E9F3FFF0 
+ 536      E9F3FFF0 
+ 536      E9F3FF
+ 537 1ea4 F0EAF3FF 		.ascii	"\360\352\363\377\360\352\363\377\360\352\363\377\360\352\363"
+ 537      F0EAF3FF 
+ 537      F0EAF3FF 
+ 537      F0EAF3
+ 538 1eb3 FFF0EAF3 		.ascii	"\377\360\352\363\377\361\352\363\377\361\352\363\377\361\352"
+ 538      FFF1EAF3 
+ 538      FFF1EAF3 
+ 538      FFF1EA
+ 539 1ec2 F3FFF1EA 		.ascii	"\363\377\361\352\364\377\361\352\364\377\361\352\364\377\361"
+ 539      F4FFF1EA 
+ 539      F4FFF1EA 
+ 539      F4FFF1
+ 540 1ed1 EBF4FFF1 		.ascii	"\353\364\377\361\353\364\377\362\353\364\377\362\353\364\377"
+ 540      EBF4FFF2 
+ 540      EBF4FFF2 
+ 540      EBF4FF
+ 541 1ee0 F2EBF4FF 		.ascii	"\362\353\364\377\362\353\364\377\362\353\364\377\362\353\364"
+ 541      F2EBF4FF 
+ 541      F2EBF4FF 
+ 541      F2EBF4
+ 542 1eef FFF2EBF4 		.ascii	"\377\362\353\364\377\362\353\364\377\363\354\364\377\363\354"
+ 542      FFF2EBF4 
+ 542      FFF3ECF4 
+ 542      FFF3EC
+ 543 1efe F4FFF3EC 		.ascii	"\364\377\363\354\364\377\363\354\364\377\363\354\364\377\363"
+ 543      F4FFF3EC 
+ 543      F4FFF3EC 
+ 543      F4FFF3
+ 544 1f0d ECF4FFF3 		.ascii	"\354\364\377\363\354\365\377\363\354\365\377\364\354\365\377"
+ 544      ECF5FFF3 
+ 544      ECF5FFF4 
+ 544      ECF5FF
+ 545 1f1c F4ECF5FF 		.ascii	"\364\354\365\377\364\355\365\377\370\360\367\377\370\360\367"
+ 545      F4EDF5FF 
+ 545      F8F0F7FF 
+ 545      F8F0F7
+ 546 1f2b FFF8F0F7 		.ascii	"\377\370\360\367\377\370\360\367\377\370\360\367\377\370\360"
+ 546      FFF8F0F7 
+ 546      FFF8F0F7 
+ 546      FFF8F0
+ 547 1f3a F7FFF8F0 		.ascii	"\367\377\370\360\367\377\371\361\367\377\371\361\367\377\371"
+ 547      F7FFF9F1 
+ 547      F7FFF9F1 
+ 547      F7FFF9
+ 548 1f49 F1F7FFF9 		.ascii	"\361\367\377\371\361\367\377\371\361\367\377\371\361\367\377"
+ 548      F1F7FFF9 
+ 548      F1F7FFF9 
+ 548      F1F7FF
+ 549 1f58 F9F1F7FF 		.ascii	"\371\361\367\377\371\361\367\377\371\361\367\377\372\361\370"
+GAS LISTING /tmp/cct9A39C.s 			page 39
+
+
+ 549      F9F1F7FF 
+ 549      F9F1F7FF 
+ 549      FAF1F8
+ 550 1f67 FFFAF2F8 		.ascii	"\377\372\362\370\377\372\362\370\377\372\362\370\377\372\362"
+ 550      FFFAF2F8 
+ 550      FFFAF2F8 
+ 550      FFFAF2
+ 551 1f76 F8FFFAF2 		.ascii	"\370\377\372\362\370\377\372\362\370\377\372\362\370\377\372"
+ 551      F8FFFAF2 
+ 551      F8FFFAF2 
+ 551      F8FFFA
+ 552 1f85 F2F8FFFB 		.ascii	"\362\370\377\373\362\370\377\373\363\370\377\373\363\370\377"
+ 552      F2F8FFFB 
+ 552      F3F8FFFB 
+ 552      F3F8FF
+ 553 1f94 FBF3F8FF 		.ascii	"\373\363\370\377\373\363\370\377\373\363\370\377\373\363\370"
+ 553      FBF3F8FF 
+ 553      FBF3F8FF 
+ 553      FBF3F8
+ 554 1fa3 FFFBF3F8 		.ascii	"\377\373\363\370\377\373\363\371\377\373\363\371\377\374\363"
+ 554      FFFBF3F9 
+ 554      FFFBF3F9 
+ 554      FFFCF3
+ 555 1fb2 F9FFFCF4 		.ascii	"\371\377\374\364\371\377\374\364\371\377\374\364\371\377"
+ 555      F9FFFCF4 
+ 555      F9FFFCF4 
+ 555      F9FF
+ 556 1fc0 FCF4F9FF 		.ascii	"\374\364\371\377\374\364\371\377\374\364\371\377\374\364\371"
+ 556      FCF4F9FF 
+ 556      FCF4F9FF 
+ 556      FCF4F9
+ 557 1fcf FFFCF4F9 		.ascii	"\377\374\364\371\377\375\364\371\377\375\364\371\377\375\365"
+ 557      FFFDF4F9 
+ 557      FFFDF4F9 
+ 557      FFFDF5
+ 558 1fde F9FFFDF5 		.ascii	"\371\377\375\365\371\377\375\365\371\377\375\365\372\377\375"
+ 558      F9FFFDF5 
+ 558      F9FFFDF5 
+ 558      FAFFFD
+ 559 1fed F5FAFFFD 		.ascii	"\365\372\377\375\365\372\377\375\365\372\377\375\365\372\377"
+ 559      F5FAFFFD 
+ 559      F5FAFFFD 
+ 559      F5FAFF
+ 560 1ffc FEF5FAFF 		.ascii	"\376\365\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 560      FEF6FAFF 
+ 560      FEF6FAFF 
+ 560      FEF6FA
+ 561 200b FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 561      FFFEF6FA 
+ 561      FFFEF6FA 
+ 561      FFFEF6
+ 562 201a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377"
+ 562      FAFFFEF6 
+ 562      FAFF
+ 563              		.globl	heatmap_cs_PuBu_soft
+ 564              		.section	.data.rel.local
+ 565              		.align 8
+GAS LISTING /tmp/cct9A39C.s 			page 40
+
+
+ 566              		.type	heatmap_cs_PuBu_soft, @object
+ 567              		.size	heatmap_cs_PuBu_soft, 8
+ 568              	heatmap_cs_PuBu_soft:
+ 569 0010 00000000 		.quad	soft
+ 569      00000000 
+ 570              		.section	.data.rel.ro.local
+ 571              		.align 16
+ 572              		.type	soft, @object
+ 573              		.size	soft, 16
+ 574              	soft:
+ 575 0020 00000000 		.quad	soft_data
+ 575      00000000 
+ 576 0028 01040000 		.quad	1025
+ 576      00000000 
+ 577              		.section	.rodata
+ 578 2024 00000000 		.align 32
+ 578      00000000 
+ 578      00000000 
+ 578      00000000 
+ 578      00000000 
+ 579              		.type	soft_data, @object
+ 580              		.size	soft_data, 4100
+ 581              	soft_data:
+ 582 2040 00       		.string	""
+ 583 2041 00       		.string	""
+ 584 2042 00       		.string	""
+ 585 2043 00       		.string	""
+ 586 2044 02375800 		.string	"\0027X"
+ 587 2048 01385807 		.ascii	"\0018X\007\0018X\016\0018Y\026\0019Y\035\0019Y%\0019Z,\0019Z"
+ 587      0138580E 
+ 587      01385916 
+ 587      0139591D 
+ 587      01395925 
+ 588 2063 34013A5B 		.ascii	"4\001:[;\001:[C\001:[J\001:\\R\001;\\Y\001;]a\001;]h\001;]p\001"
+ 588      3B013A5B 
+ 588      43013A5B 
+ 588      4A013A5C 
+ 588      52013B5C 
+ 589 2085 3C5E7701 		.ascii	"<^w\001<^\177\001<_\206\001<_\215\001=_\225\001=`\234\001=`\244"
+ 589      3C5E7F01 
+ 589      3C5F8601 
+ 589      3C5F8D01 
+ 589      3D5F9501 
+ 590 20a0 013D61AB 		.ascii	"\001=a\253\001>a\263\001>a\272\001>b\302\001>b\311\001?c\321"
+ 590      013E61B3 
+ 590      013E61BA 
+ 590      013E62C2 
+ 590      013E62C9 
+ 591 20b8 013F63D8 		.ascii	"\001?c\330\001?d\340\001@d\347\001@d\357\001@e\366\001@e\376"
+ 591      013F64E0 
+ 591      014064E7 
+ 591      014064EF 
+ 591      014065F6 
+ 592 20d0 014166FF 		.ascii	"\001Af\377\001Af\377\001Af\377\001Ag\377\001Bg\377\001Bh\377"
+ 592      014166FF 
+ 592      014166FF 
+ 592      014167FF 
+GAS LISTING /tmp/cct9A39C.s 			page 41
+
+
+ 592      014267FF 
+ 593 20e8 014268FF 		.ascii	"\001Bh\377\001Bh\377\001Ci\377\001Ci\377\001Cj\377\001Cj\377"
+ 593      014268FF 
+ 593      014369FF 
+ 593      014369FF 
+ 593      01436AFF 
+ 594 2100 01446AFF 		.ascii	"\001Dj\377\001Dk\377\001Dk\377\001El\377\001El\377\001El\377"
+ 594      01446BFF 
+ 594      01446BFF 
+ 594      01456CFF 
+ 594      01456CFF 
+ 595 2118 01456DFF 		.ascii	"\001Em\377\001Fm\377\001Fn\377\001Fn\377\001Fo\377\001Go\377"
+ 595      01466DFF 
+ 595      01466EFF 
+ 595      01466EFF 
+ 595      01466FFF 
+ 596 2130 01476FFF 		.ascii	"\001Go\377\001Gp\377\001Gp\377\001Hq\377\001Hq\377\001Hq\377"
+ 596      014770FF 
+ 596      014770FF 
+ 596      014871FF 
+ 596      014871FF 
+ 597 2148 014872FF 		.ascii	"\001Hr\377\001Ir\377\001Is\377\001Is\377\001Jt\377\001Jt\377"
+ 597      014972FF 
+ 597      014973FF 
+ 597      014973FF 
+ 597      014A74FF 
+ 598 2160 014A74FF 		.ascii	"\001Jt\377\001Ju\377\001Ku\377\002Kv\377\002Kv\377\002Kv\377"
+ 598      014A75FF 
+ 598      014B75FF 
+ 598      024B76FF 
+ 598      024B76FF 
+ 599 2178 024C77FF 		.ascii	"\002Lw\377\002Lw\377\002Lx\377\002Lx\377\002My\377\002My\377"
+ 599      024C77FF 
+ 599      024C78FF 
+ 599      024C78FF 
+ 599      024D79FF 
+ 600 2190 024D79FF 		.ascii	"\002My\377\002Nz\377\002Nz\377\002N{\377\002N{\377\002O{\377"
+ 600      024E7AFF 
+ 600      024E7AFF 
+ 600      024E7BFF 
+ 600      024E7BFF 
+ 601 21a8 024F7CFF 		.ascii	"\002O|\377\002O|\377\002O}\377\002P}\377\002P~\377\002P~\377"
+ 601      024F7CFF 
+ 601      024F7DFF 
+ 601      02507DFF 
+ 601      02507EFF 
+ 602 21c0 02517EFF 		.ascii	"\002Q~\377\002Q\177\377\002Q\177\377\002Q\200\377\002R\200\377"
+ 602      02517FFF 
+ 602      02517FFF 
+ 602      025180FF 
+ 602      025280FF 
+ 603 21d4 025281FF 		.ascii	"\002R\201\377\002R\201\377\002R\201\377\002S\202\377\002S\202"
+ 603      025281FF 
+ 603      025281FF 
+ 603      025382FF 
+ 603      025382
+ 604 21e7 FF025383 		.ascii	"\377\002S\203\377\002T\203\377\002T\204\377\002T\204\377\003"
+GAS LISTING /tmp/cct9A39C.s 			page 42
+
+
+ 604      FF025483 
+ 604      FF025484 
+ 604      FF025484 
+ 604      FF03
+ 605 21f9 5484FF03 		.ascii	"T\204\377\003U\205\377\003U\205\377\003U\206\377\003U\206\377"
+ 605      5585FF03 
+ 605      5585FF03 
+ 605      5586FF03 
+ 605      5586FF
+ 606 220c 035686FF 		.ascii	"\003V\206\377\003V\207\377\003V\207\377\003V\210\377\003W\210"
+ 606      035687FF 
+ 606      035687FF 
+ 606      035688FF 
+ 606      035788
+ 607 221f FF035789 		.ascii	"\377\003W\211\377\003W\211\377\003X\211\377\003X\212\377\003"
+ 607      FF035789 
+ 607      FF035889 
+ 607      FF03588A 
+ 607      FF03
+ 608 2231 588AFF03 		.ascii	"X\212\377\003X\213\377\003Y\213\377\003Y\214\377\003Y\214\377"
+ 608      588BFF03 
+ 608      598BFF03 
+ 608      598CFF03 
+ 608      598CFF
+ 609 2244 04598DFF 		.ascii	"\004Y\215\377\003Z\215\377\003Z\215\377\003Z\215\377\003Z\216"
+ 609      035A8DFF 
+ 609      035A8DFF 
+ 609      035A8DFF 
+ 609      035A8E
+ 610 2257 FF035A8E 		.ascii	"\377\003Z\216\377\003[\216\377\003[\216\377\003[\217\377\003"
+ 610      FF035B8E 
+ 610      FF035B8E 
+ 610      FF035B8F 
+ 610      FF03
+ 611 2269 5B8FFF03 		.ascii	"[\217\377\003[\217\377\003[\217\377\003\\\220\377\003\\\220\377"
+ 611      5B8FFF03 
+ 611      5B8FFF03 
+ 611      5C90FF03 
+ 611      5C90FF
+ 612 227c 035C90FF 		.ascii	"\003\\\220\377\003\\\221\377\003\\\221\377\003\\\221\377\003"
+ 612      035C91FF 
+ 612      035C91FF 
+ 612      035C91FF 
+ 612      03
+ 613 228d 5D91FF03 		.ascii	"]\221\377\003]\222\377\003]\222\377\003]\222\377\003]\222\377"
+ 613      5D92FF03 
+ 613      5D92FF03 
+ 613      5D92FF03 
+ 613      5D92FF
+ 614 22a0 035D93FF 		.ascii	"\003]\223\377\003^\223\377\003^\223\377\003^\223\377\003^\224"
+ 614      035E93FF 
+ 614      035E93FF 
+ 614      035E93FF 
+ 614      035E94
+ 615 22b3 FF035E94 		.ascii	"\377\003^\224\377\003^\224\377\003_\225\377\003_\225\377\003"
+ 615      FF035E94 
+ 615      FF035F95 
+GAS LISTING /tmp/cct9A39C.s 			page 43
+
+
+ 615      FF035F95 
+ 615      FF03
+ 616 22c5 5F95FF03 		.ascii	"_\225\377\003_\225\377\003_\226\377\003_\226\377\003`\226\377"
+ 616      5F95FF03 
+ 616      5F96FF03 
+ 616      5F96FF03 
+ 616      6096FF
+ 617 22d8 036096FF 		.ascii	"\003`\226\377\003`\227\377\003`\227\377\003`\227\377\003`\230"
+ 617      036097FF 
+ 617      036097FF 
+ 617      036097FF 
+ 617      036098
+ 618 22eb FF036198 		.ascii	"\377\003a\230\377\003a\230\377\003a\230\377\003a\231\377\003"
+ 618      FF036198 
+ 618      FF036198 
+ 618      FF036199 
+ 618      FF03
+ 619 22fd 6199FF03 		.ascii	"a\231\377\003a\231\377\003b\231\377\003b\232\377\003b\232\377"
+ 619      6199FF03 
+ 619      6299FF03 
+ 619      629AFF03 
+ 619      629AFF
+ 620 2310 03629AFF 		.ascii	"\003b\232\377\003b\233\377\003c\233\377\003c\233\377\003c\233"
+ 620      03629BFF 
+ 620      03639BFF 
+ 620      03639BFF 
+ 620      03639B
+ 621 2323 FF03639C 		.ascii	"\377\003c\234\377\003c\234\377\003c\234\377\003d\234\377\003"
+ 621      FF03639C 
+ 621      FF03639C 
+ 621      FF03649C 
+ 621      FF03
+ 622 2335 649DFF03 		.ascii	"d\235\377\003d\235\377\003d\235\377\003d\236\377\003d\236\377"
+ 622      649DFF03 
+ 622      649DFF03 
+ 622      649EFF03 
+ 622      649EFF
+ 623 2348 03659EFF 		.ascii	"\003e\236\377\003e\236\377\004e\237\377\004e\237\377\004e\237"
+ 623      03659EFF 
+ 623      04659FFF 
+ 623      04659FFF 
+ 623      04659F
+ 624 235b FF04659F 		.ascii	"\377\004e\237\377\004f\240\377\004f\240\377\004f\240\377\004"
+ 624      FF0466A0 
+ 624      FF0466A0 
+ 624      FF0466A0 
+ 624      FF04
+ 625 236d 66A1FF04 		.ascii	"f\241\377\004f\241\377\004f\241\377\004g\241\377\004g\242\377"
+ 625      66A1FF04 
+ 625      66A1FF04 
+ 625      67A1FF04 
+ 625      67A2FF
+ 626 2380 0467A2FF 		.ascii	"\004g\242\377\004g\242\377\004g\242\377\004h\243\377\004h\243"
+ 626      0467A2FF 
+ 626      0467A2FF 
+ 626      0468A3FF 
+ 626      0468A3
+GAS LISTING /tmp/cct9A39C.s 			page 44
+
+
+ 627 2393 FF0468A3 		.ascii	"\377\004h\243\377\004h\244\377\004h\244\377\004h\244\377\004"
+ 627      FF0468A4 
+ 627      FF0468A4 
+ 627      FF0468A4 
+ 627      FF04
+ 628 23a5 69A4FF04 		.ascii	"i\244\377\004i\245\377\004i\245\377\004i\245\377\004i\246\377"
+ 628      69A5FF04 
+ 628      69A5FF04 
+ 628      69A5FF04 
+ 628      69A6FF
+ 629 23b8 0469A6FF 		.ascii	"\004i\246\377\004j\246\377\004j\246\377\004j\247\377\004j\247"
+ 629      046AA6FF 
+ 629      046AA6FF 
+ 629      046AA7FF 
+ 629      046AA7
+ 630 23cb FF046AA7 		.ascii	"\377\004j\247\377\004j\247\377\004k\250\377\004k\250\377\004"
+ 630      FF046AA7 
+ 630      FF046BA8 
+ 630      FF046BA8 
+ 630      FF04
+ 631 23dd 6BA8FF04 		.ascii	"k\250\377\004k\251\377\004k\251\377\004k\251\377\004l\251\377"
+ 631      6BA9FF04 
+ 631      6BA9FF04 
+ 631      6BA9FF04 
+ 631      6CA9FF
+ 632 23f0 046CAAFF 		.ascii	"\004l\252\377\004l\252\377\004l\252\377\004l\252\377\004m\253"
+ 632      046CAAFF 
+ 632      046CAAFF 
+ 632      046CAAFF 
+ 632      046DAB
+ 633 2403 FF046DAB 		.ascii	"\377\004m\253\377\004m\253\377\004m\254\377\004m\254\377\004"
+ 633      FF046DAB 
+ 633      FF046DAC 
+ 633      FF046DAC 
+ 633      FF04
+ 634 2415 6DACFF04 		.ascii	"m\254\377\004n\254\377\004n\255\377\004n\255\377\004n\255\377"
+ 634      6EACFF04 
+ 634      6EADFF04 
+ 634      6EADFF04 
+ 634      6EADFF
+ 635 2428 046EAEFF 		.ascii	"\004n\256\377\004n\256\377\004o\256\377\004o\256\377\004o\257"
+ 635      046EAEFF 
+ 635      046FAEFF 
+ 635      046FAEFF 
+ 635      046FAF
+ 636 243b FF046FAF 		.ascii	"\377\004o\257\377\004o\257\377\005o\260\377\005p\260\377\005"
+ 636      FF046FAF 
+ 636      FF056FB0 
+ 636      FF0570B0 
+ 636      FF05
+ 637 244d 70B0FF06 		.ascii	"p\260\377\006p\260\377\006q\260\377\007q\260\377\007q\260\377"
+ 637      70B0FF06 
+ 637      71B0FF07 
+ 637      71B0FF07 
+ 637      71B0FF
+ 638 2460 0771B0FF 		.ascii	"\007q\260\377\br\261\377\br\261\377\tr\261\377\tr\261\377\ns"
+ 638      0872B1FF 
+GAS LISTING /tmp/cct9A39C.s 			page 45
+
+
+ 638      0872B1FF 
+ 638      0972B1FF 
+ 638      0972B1FF 
+ 639 2476 B1FF0A73 		.ascii	"\261\377\ns\261\377\013s\261\377\013s\262\377\ft\262\377\ft\262"
+ 639      B1FF0B73 
+ 639      B1FF0B73 
+ 639      B2FF0C74 
+ 639      B2FF0C74 
+ 640 248b FF0D74B2 		.ascii	"\377\rt\262\377\rt\262\377\ru\262\377\016u\262\377\016u\263\377"
+ 640      FF0D74B2 
+ 640      FF0D75B2 
+ 640      FF0E75B2 
+ 640      FF0E75B3 
+ 641 24a0 0F75B3FF 		.ascii	"\017u\263\377\017v\263\377\020v\263\377\020v\263\377\020v\263"
+ 641      0F76B3FF 
+ 641      1076B3FF 
+ 641      1076B3FF 
+ 641      1076B3
+ 642 24b3 FF1177B3 		.ascii	"\377\021w\263\377\021w\263\377\022w\264\377\022w\264\377\022"
+ 642      FF1177B3 
+ 642      FF1277B4 
+ 642      FF1277B4 
+ 642      FF12
+ 643 24c5 78B4FF13 		.ascii	"x\264\377\023x\264\377\023x\264\377\024x\264\377\024y\264\377"
+ 643      78B4FF13 
+ 643      78B4FF14 
+ 643      78B4FF14 
+ 643      79B4FF
+ 644 24d8 1479B4FF 		.ascii	"\024y\264\377\025y\265\377\025y\265\377\026z\265\377\026z\265"
+ 644      1579B5FF 
+ 644      1579B5FF 
+ 644      167AB5FF 
+ 644      167AB5
+ 645 24eb FF167AB5 		.ascii	"\377\026z\265\377\027z\265\377\027{\265\377\030{\266\377\030"
+ 645      FF177AB5 
+ 645      FF177BB5 
+ 645      FF187BB6 
+ 645      FF18
+ 646 24fd 7BB6FF18 		.ascii	"{\266\377\030{\266\377\031|\266\377\031|\266\377\031|\266\377"
+ 646      7BB6FF19 
+ 646      7CB6FF19 
+ 646      7CB6FF19 
+ 646      7CB6FF
+ 647 2510 1A7CB6FF 		.ascii	"\032|\266\377\032}\266\377\033}\267\377\033}\267\377\033}\267"
+ 647      1A7DB6FF 
+ 647      1B7DB7FF 
+ 647      1B7DB7FF 
+ 647      1B7DB7
+ 648 2523 FF1C7EB7 		.ascii	"\377\034~\267\377\034~\267\377\034~\267\377\035~\267\377\035"
+ 648      FF1C7EB7 
+ 648      FF1C7EB7 
+ 648      FF1D7EB7 
+ 648      FF1D
+ 649 2535 7FB7FF1E 		.ascii	"\177\267\377\036\177\270\377\036\177\270\377\036\177\270\377"
+ 649      7FB8FF1E 
+ 649      7FB8FF1E 
+ 649      7FB8FF
+GAS LISTING /tmp/cct9A39C.s 			page 46
+
+
+ 650 2544 1F80B8FF 		.ascii	"\037\200\270\377\037\200\270\377\037\200\270\377 \200\270\377"
+ 650      1F80B8FF 
+ 650      1F80B8FF 
+ 650      2080B8FF 
+ 651 2554 2081B8FF 		.ascii	" \201\270\377 \201\271\377!\201\271\377!\201\271\377\"\202\271"
+ 651      2081B9FF 
+ 651      2181B9FF 
+ 651      2181B9FF 
+ 651      2282B9
+ 652 2567 FF2282B9 		.ascii	"\377\"\202\271\377\"\202\271\377#\202\271\377#\203\271\377#\203"
+ 652      FF2282B9 
+ 652      FF2382B9 
+ 652      FF2383B9 
+ 652      FF2383
+ 653 257a BAFF2483 		.ascii	"\272\377$\203\272\377$\203\272\377$\204\272\377%\204\272\377"
+ 653      BAFF2483 
+ 653      BAFF2484 
+ 653      BAFF2584 
+ 653      BAFF
+ 654 258c 2584BAFF 		.ascii	"%\204\272\377&\204\272\377&\205\272\377&\205\272\377'\205\273"
+ 654      2684BAFF 
+ 654      2685BAFF 
+ 654      2685BAFF 
+ 654      2785BB
+ 655 259f FF2785BB 		.ascii	"\377'\205\273\377'\206\273\377(\206\273\377(\206\273\377(\206"
+ 655      FF2786BB 
+ 655      FF2886BB 
+ 655      FF2886BB 
+ 655      FF2886
+ 656 25b2 BBFF2987 		.ascii	"\273\377)\207\273\377)\207\273\377)\207\274\377*\207\274\377"
+ 656      BBFF2987 
+ 656      BBFF2987 
+ 656      BCFF2A87 
+ 656      BCFF
+ 657 25c4 2A88BCFF 		.ascii	"*\210\274\377+\210\274\377+\210\274\377+\210\274\377,\211\274"
+ 657      2B88BCFF 
+ 657      2B88BCFF 
+ 657      2B88BCFF 
+ 657      2C89BC
+ 658 25d7 FF2C89BC 		.ascii	"\377,\211\274\377,\211\275\377-\211\275\377-\212\275\377-\212"
+ 658      FF2C89BD 
+ 658      FF2D89BD 
+ 658      FF2D8ABD 
+ 658      FF2D8A
+ 659 25ea BDFF2E8A 		.ascii	"\275\377.\212\275\377.\212\275\377.\213\275\377/\213\275\377"
+ 659      BDFF2E8A 
+ 659      BDFF2E8B 
+ 659      BDFF2F8B 
+ 659      BDFF
+ 660 25fc 2F8BBDFF 		.ascii	"/\213\275\3770\213\276\3770\214\276\3770\214\276\3771\214\276"
+ 660      308BBEFF 
+ 660      308CBEFF 
+ 660      308CBEFF 
+ 660      318CBE
+ 661 260f FF318CBE 		.ascii	"\3771\214\276\3771\215\276\3772\215\276\3772\215\276\3772\215"
+ 661      FF318DBE 
+ 661      FF328DBE 
+GAS LISTING /tmp/cct9A39C.s 			page 47
+
+
+ 661      FF328DBE 
+ 661      FF328D
+ 662 2622 BEFF338E 		.ascii	"\276\3773\216\277\3773\216\277\3773\216\277\3774\216\277\377"
+ 662      BFFF338E 
+ 662      BFFF338E 
+ 662      BFFF348E 
+ 662      BFFF
+ 663 2634 348FBFFF 		.ascii	"4\217\277\3774\217\277\3775\217\277\3775\217\277\3776\220\300"
+ 663      348FBFFF 
+ 663      358FBFFF 
+ 663      358FBFFF 
+ 663      3690C0
+ 664 2647 FF3690C0 		.ascii	"\3776\220\300\3777\220\300\3777\220\300\3778\220\300\3779\220"
+ 664      FF3790C0 
+ 664      FF3790C0 
+ 664      FF3890C0 
+ 664      FF3990
+ 665 265a C0FF3991 		.ascii	"\300\3779\221\300\377:\221\300\377;\221\300\377;\221\301\377"
+ 665      C0FF3A91 
+ 665      C0FF3B91 
+ 665      C0FF3B91 
+ 665      C1FF
+ 666 266c 3C91C1FF 		.ascii	"<\221\301\377=\222\301\377=\222\301\377>\222\301\377>\222\301"
+ 666      3D92C1FF 
+ 666      3D92C1FF 
+ 666      3E92C1FF 
+ 666      3E92C1
+ 667 267f FF3F92C1 		.ascii	"\377?\222\301\377@\223\301\377@\223\302\377A\223\302\377A\223"
+ 667      FF4093C1 
+ 667      FF4093C2 
+ 667      FF4193C2 
+ 667      FF4193
+ 668 2692 C2FF4293 		.ascii	"\302\377B\223\302\377B\224\302\377C\224\302\377D\224\302\377"
+ 668      C2FF4294 
+ 668      C2FF4394 
+ 668      C2FF4494 
+ 668      C2FF
+ 669 26a4 4494C2FF 		.ascii	"D\224\302\377E\224\302\377E\225\303\377F\225\303\377F\225\303"
+ 669      4594C2FF 
+ 669      4595C3FF 
+ 669      4695C3FF 
+ 669      4695C3
+ 670 26b7 FF4795C3 		.ascii	"\377G\225\303\377G\225\303\377H\225\303\377H\226\303\377I\226"
+ 670      FF4795C3 
+ 670      FF4895C3 
+ 670      FF4896C3 
+ 670      FF4996
+ 671 26ca C3FF4996 		.ascii	"\303\377I\226\304\377J\226\304\377K\226\304\377K\227\304\377"
+ 671      C4FF4A96 
+ 671      C4FF4B96 
+ 671      C4FF4B97 
+ 671      C4FF
+ 672 26dc 4C97C4FF 		.ascii	"L\227\304\377L\227\304\377M\227\304\377M\227\304\377N\230\304"
+ 672      4C97C4FF 
+ 672      4D97C4FF 
+ 672      4D97C4FF 
+ 672      4E98C4
+GAS LISTING /tmp/cct9A39C.s 			page 48
+
+
+ 673 26ef FF4E98C5 		.ascii	"\377N\230\305\377O\230\305\377O\230\305\377P\230\305\377P\231"
+ 673      FF4F98C5 
+ 673      FF4F98C5 
+ 673      FF5098C5 
+ 673      FF5099
+ 674 2702 C5FF5199 		.ascii	"\305\377Q\231\305\377Q\231\305\377R\231\305\377R\231\306\377"
+ 674      C5FF5199 
+ 674      C5FF5299 
+ 674      C5FF5299 
+ 674      C6FF
+ 675 2714 539AC6FF 		.ascii	"S\232\306\377S\232\306\377T\232\306\377T\232\306\377T\232\306"
+ 675      539AC6FF 
+ 675      549AC6FF 
+ 675      549AC6FF 
+ 675      549AC6
+ 676 2727 FF559BC6 		.ascii	"\377U\233\306\377U\233\306\377V\233\306\377V\233\307\377W\233"
+ 676      FF559BC6 
+ 676      FF569BC6 
+ 676      FF569BC7 
+ 676      FF579B
+ 677 273a C7FF579B 		.ascii	"\307\377W\233\307\377X\234\307\377X\234\307\377Y\234\307\377"
+ 677      C7FF589C 
+ 677      C7FF589C 
+ 677      C7FF599C 
+ 677      C7FF
+ 678 274c 599CC7FF 		.ascii	"Y\234\307\377Z\234\307\377Z\235\310\377[\235\310\377[\235\310"
+ 678      5A9CC7FF 
+ 678      5A9DC8FF 
+ 678      5B9DC8FF 
+ 678      5B9DC8
+ 679 275f FF5B9DC8 		.ascii	"\377[\235\310\377\\\235\310\377\\\236\310\377]\236\310\377]\236"
+ 679      FF5C9DC8 
+ 679      FF5C9EC8 
+ 679      FF5D9EC8 
+ 679      FF5D9E
+ 680 2772 C8FF5E9E 		.ascii	"\310\377^\236\310\377^\236\311\377_\237\311\377_\237\311\377"
+ 680      C8FF5E9E 
+ 680      C9FF5F9F 
+ 680      C9FF5F9F 
+ 680      C9FF
+ 681 2784 5F9FC9FF 		.ascii	"_\237\311\377`\237\311\377`\237\311\377a\240\311\377a\240\311"
+ 681      609FC9FF 
+ 681      609FC9FF 
+ 681      61A0C9FF 
+ 681      61A0C9
+ 682 2797 FF62A0C9 		.ascii	"\377b\240\311\377b\240\312\377c\240\312\377c\241\312\377c\241"
+ 682      FF62A0CA 
+ 682      FF63A0CA 
+ 682      FF63A1CA 
+ 682      FF63A1
+ 683 27aa CAFF64A1 		.ascii	"\312\377d\241\312\377d\241\312\377e\241\312\377e\242\312\377"
+ 683      CAFF64A1 
+ 683      CAFF65A1 
+ 683      CAFF65A2 
+ 683      CAFF
+ 684 27bc 66A2CBFF 		.ascii	"f\242\313\377f\242\313\377f\242\313\377g\242\313\377g\243\313"
+ 684      66A2CBFF 
+GAS LISTING /tmp/cct9A39C.s 			page 49
+
+
+ 684      66A2CBFF 
+ 684      67A2CBFF 
+ 684      67A3CB
+ 685 27cf FF68A3CB 		.ascii	"\377h\243\313\377h\243\313\377h\243\313\377i\243\313\377i\244"
+ 685      FF68A3CB 
+ 685      FF68A3CB 
+ 685      FF69A3CB 
+ 685      FF69A4
+ 686 27e2 CCFF6AA4 		.ascii	"\314\377j\244\314\377j\244\314\377k\244\314\377k\244\314\377"
+ 686      CCFF6AA4 
+ 686      CCFF6BA4 
+ 686      CCFF6BA4 
+ 686      CCFF
+ 687 27f4 6BA5CCFF 		.ascii	"k\245\314\377l\245\314\377l\245\314\377m\245\315\377m\245\315"
+ 687      6CA5CCFF 
+ 687      6CA5CCFF 
+ 687      6DA5CDFF 
+ 687      6DA5CD
+ 688 2807 FF6DA6CD 		.ascii	"\377m\246\315\377n\246\315\377"
+ 688      FF6EA6CD 
+ 688      FF
+ 689 2810 6EA6CDFF 		.ascii	"n\246\315\377o\246\315\377o\246\315\377o\247\315\377p\247\315"
+ 689      6FA6CDFF 
+ 689      6FA6CDFF 
+ 689      6FA7CDFF 
+ 689      70A7CD
+ 690 2823 FF70A7CE 		.ascii	"\377p\247\316\377q\247\316\377q\247\316\377q\250\316\377r\250"
+ 690      FF71A7CE 
+ 690      FF71A7CE 
+ 690      FF71A8CE 
+ 690      FF72A8
+ 691 2836 CEFF72A8 		.ascii	"\316\377r\250\316\377s\250\316\377s\250\316\377t\251\317\377"
+ 691      CEFF73A8 
+ 691      CEFF73A8 
+ 691      CEFF74A9 
+ 691      CFFF
+ 692 2848 74A9CFFF 		.ascii	"t\251\317\377t\251\317\377u\251\317\377u\251\317\377v\251\317"
+ 692      74A9CFFF 
+ 692      75A9CFFF 
+ 692      75A9CFFF 
+ 692      76A9CF
+ 693 285b FF76A9CF 		.ascii	"\377v\251\317\377w\252\317\377w\252\317\377w\252\317\377x\252"
+ 693      FF77AACF 
+ 693      FF77AACF 
+ 693      FF77AACF 
+ 693      FF78AA
+ 694 286e D0FF78AA 		.ascii	"\320\377x\252\320\377y\252\320\377y\252\320\377z\253\320\377"
+ 694      D0FF79AA 
+ 694      D0FF79AA 
+ 694      D0FF7AAB 
+ 694      D0FF
+ 695 2880 7AABD0FF 		.ascii	"z\253\320\377{\253\320\377{\253\320\377{\253\320\377|\253\320"
+ 695      7BABD0FF 
+ 695      7BABD0FF 
+ 695      7BABD0FF 
+ 695      7CABD0
+ 696 2893 FF7CACD1 		.ascii	"\377|\254\321\377}\254\321\377}\254\321\377~\254\321\377~\254"
+GAS LISTING /tmp/cct9A39C.s 			page 50
+
+
+ 696      FF7DACD1 
+ 696      FF7DACD1 
+ 696      FF7EACD1 
+ 696      FF7EAC
+ 697 28a6 D1FF7EAC 		.ascii	"\321\377~\254\321\377\177\254\321\377\177\255\321\377\200\255"
+ 697      D1FF7FAC 
+ 697      D1FF7FAD 
+ 697      D1FF80AD 
+ 698 28b6 D1FF80AD 		.ascii	"\321\377\200\255\322\377\200\255\322\377\201\255\322\377\201"
+ 698      D2FF80AD 
+ 698      D2FF81AD 
+ 698      D2FF81
+ 699 28c5 ADD2FF82 		.ascii	"\255\322\377\202\255\322\377\202\256\322\377\203\256\322\377"
+ 699      ADD2FF82 
+ 699      AED2FF83 
+ 699      AED2FF
+ 700 28d4 83AED2FF 		.ascii	"\203\256\322\377\203\256\322\377\204\256\322\377\204\256\323"
+ 700      83AED2FF 
+ 700      84AED2FF 
+ 700      84AED3
+ 701 28e3 FF85AFD3 		.ascii	"\377\205\257\323\377\205\257\323\377\205\257\323\377\206\257"
+ 701      FF85AFD3 
+ 701      FF85AFD3 
+ 701      FF86AF
+ 702 28f2 D3FF86AF 		.ascii	"\323\377\206\257\323\377\207\257\323\377\207\257\323\377\207"
+ 702      D3FF87AF 
+ 702      D3FF87AF 
+ 702      D3FF87
+ 703 2901 B0D3FF88 		.ascii	"\260\323\377\210\260\323\377\210\260\323\377\211\260\324\377"
+ 703      B0D3FF88 
+ 703      B0D3FF89 
+ 703      B0D4FF
+ 704 2910 89B0D4FF 		.ascii	"\211\260\324\377\211\260\324\377\212\261\324\377\212\261\324"
+ 704      89B0D4FF 
+ 704      8AB1D4FF 
+ 704      8AB1D4
+ 705 291f FF8BB1D4 		.ascii	"\377\213\261\324\377\213\261\324\377\213\261\324\377\214\261"
+ 705      FF8BB1D4 
+ 705      FF8BB1D4 
+ 705      FF8CB1
+ 706 292e D4FF8CB1 		.ascii	"\324\377\214\261\324\377\215\262\325\377\215\262\325\377\215"
+ 706      D4FF8DB2 
+ 706      D5FF8DB2 
+ 706      D5FF8D
+ 707 293d B2D5FF8E 		.ascii	"\262\325\377\216\262\325\377\216\262\325\377\217\262\325\377"
+ 707      B2D5FF8E 
+ 707      B2D5FF8F 
+ 707      B2D5FF
+ 708 294c 8FB3D5FF 		.ascii	"\217\263\325\377\217\263\325\377\220\263\325\377\220\263\325"
+ 708      8FB3D5FF 
+ 708      90B3D5FF 
+ 708      90B3D5
+ 709 295b FF90B3D5 		.ascii	"\377\220\263\325\377\221\263\326\377\221\264\326\377\222\264"
+ 709      FF91B3D6 
+ 709      FF91B4D6 
+ 709      FF92B4
+ 710 296a D6FF92B4 		.ascii	"\326\377\222\264\326\377\222\264\326\377\223\264\326\377\223"
+GAS LISTING /tmp/cct9A39C.s 			page 51
+
+
+ 710      D6FF92B4 
+ 710      D6FF93B4 
+ 710      D6FF93
+ 711 2979 B4D6FF93 		.ascii	"\264\326\377\223\264\326\377\224\265\326\377\224\265\326\377"
+ 711      B4D6FF94 
+ 711      B5D6FF94 
+ 711      B5D6FF
+ 712 2988 95B5D6FF 		.ascii	"\225\265\326\377\225\265\327\377\225\265\327\377\226\265\327"
+ 712      95B5D7FF 
+ 712      95B5D7FF 
+ 712      96B5D7
+ 713 2997 FF96B6D7 		.ascii	"\377\226\266\327\377\226\266\327\377\227\266\327\377\227\266"
+ 713      FF96B6D7 
+ 713      FF97B6D7 
+ 713      FF97B6
+ 714 29a6 D7FF98B6 		.ascii	"\327\377\230\266\327\377\230\266\327\377\230\267\327\377\231"
+ 714      D7FF98B6 
+ 714      D7FF98B7 
+ 714      D7FF99
+ 715 29b5 B7D7FF99 		.ascii	"\267\327\377\231\267\330\377\231\267\330\377\232\267\330\377"
+ 715      B7D8FF99 
+ 715      B7D8FF9A 
+ 715      B7D8FF
+ 716 29c4 9AB7D8FF 		.ascii	"\232\267\330\377\233\267\330\377\233\270\330\377\233\270\330"
+ 716      9BB7D8FF 
+ 716      9BB8D8FF 
+ 716      9BB8D8
+ 717 29d3 FF9CB8D8 		.ascii	"\377\234\270\330\377\234\270\330\377\234\270\330\377\235\270"
+ 717      FF9CB8D8 
+ 717      FF9CB8D8 
+ 717      FF9DB8
+ 718 29e2 D8FF9DB9 		.ascii	"\330\377\235\271\330\377\235\271\331\377\236\271\331\377\236"
+ 718      D8FF9DB9 
+ 718      D9FF9EB9 
+ 718      D9FF9E
+ 719 29f1 B9D9FF9E 		.ascii	"\271\331\377\236\271\331\377\237\271\331\377\237\272\331\377"
+ 719      B9D9FF9F 
+ 719      B9D9FF9F 
+ 719      BAD9FF
+ 720 2a00 A0BAD9FF 		.ascii	"\240\272\331\377\240\272\331\377\240\272\331\377\241\272\331"
+ 720      A0BAD9FF 
+ 720      A0BAD9FF 
+ 720      A1BAD9
+ 721 2a0f FFA1BAD9 		.ascii	"\377\241\272\331\377\241\273\331\377\242\273\332\377\242\273"
+ 721      FFA1BBD9 
+ 721      FFA2BBDA 
+ 721      FFA2BB
+ 722 2a1e DAFFA2BB 		.ascii	"\332\377\242\273\332\377\243\273\332\377\243\273\332\377\243"
+ 722      DAFFA3BB 
+ 722      DAFFA3BB 
+ 722      DAFFA3
+ 723 2a2d BCDAFFA4 		.ascii	"\274\332\377\244\274\332\377\244\274\332\377\244\274\332\377"
+ 723      BCDAFFA4 
+ 723      BCDAFFA4 
+ 723      BCDAFF
+ 724 2a3c A5BCDAFF 		.ascii	"\245\274\332\377\245\274\332\377\245\275\332\377\246\275\333"
+ 724      A5BCDAFF 
+GAS LISTING /tmp/cct9A39C.s 			page 52
+
+
+ 724      A5BDDAFF 
+ 724      A6BDDB
+ 725 2a4b FFA6BDDB 		.ascii	"\377\246\275\333\377\247\275\333\377\247\275\333\377\247\275"
+ 725      FFA7BDDB 
+ 725      FFA7BDDB 
+ 725      FFA7BD
+ 726 2a5a DBFFA8BD 		.ascii	"\333\377\250\275\333\377\250\276\333\377\250\276\333\377\251"
+ 726      DBFFA8BE 
+ 726      DBFFA8BE 
+ 726      DBFFA9
+ 727 2a69 BEDBFFA9 		.ascii	"\276\333\377\251\276\334\377\252\276\334\377\252\276\334\377"
+ 727      BEDCFFAA 
+ 727      BEDCFFAA 
+ 727      BEDCFF
+ 728 2a78 AABEDCFF 		.ascii	"\252\276\334\377\253\277\334\377\253\277\334\377\253\277\334"
+ 728      ABBFDCFF 
+ 728      ABBFDCFF 
+ 728      ABBFDC
+ 729 2a87 FFACBFDC 		.ascii	"\377\254\277\334\377\254\277\334\377\254\277\334\377\255\277"
+ 729      FFACBFDC 
+ 729      FFACBFDC 
+ 729      FFADBF
+ 730 2a96 DCFFADC0 		.ascii	"\334\377\255\300\335\377\256\300\335\377\256\300\335\377\256"
+ 730      DDFFAEC0 
+ 730      DDFFAEC0 
+ 730      DDFFAE
+ 731 2aa5 C0DDFFAF 		.ascii	"\300\335\377\257\300\335\377\257\300\335\377\257\300\335\377"
+ 731      C0DDFFAF 
+ 731      C0DDFFAF 
+ 731      C0DDFF
+ 732 2ab4 B0C1DDFF 		.ascii	"\260\301\335\377\260\301\335\377\260\301\335\377\261\301\336"
+ 732      B0C1DDFF 
+ 732      B0C1DDFF 
+ 732      B1C1DE
+ 733 2ac3 FFB1C1DE 		.ascii	"\377\261\301\336\377\261\301\336\377\262\301\336\377\262\302"
+ 733      FFB1C1DE 
+ 733      FFB2C1DE 
+ 733      FFB2C2
+ 734 2ad2 DEFFB3C2 		.ascii	"\336\377\263\302\336\377\263\302\336\377\263\302\336\377\264"
+ 734      DEFFB3C2 
+ 734      DEFFB3C2 
+ 734      DEFFB4
+ 735 2ae1 C2DEFFB4 		.ascii	"\302\336\377\264\302\336\377\264\303\336\377\265\303\337\377"
+ 735      C2DEFFB4 
+ 735      C3DEFFB5 
+ 735      C3DFFF
+ 736 2af0 B5C3DFFF 		.ascii	"\265\303\337\377\265\303\337\377\266\303\337\377\266\303\337"
+ 736      B5C3DFFF 
+ 736      B6C3DFFF 
+ 736      B6C3DF
+ 737 2aff FFB6C3DF 		.ascii	"\377\266\303\337\377\267\304\337\377\267\304\337\377\267\304"
+ 737      FFB7C4DF 
+ 737      FFB7C4DF 
+ 737      FFB7C4
+ 738 2b0e DFFFB8C4 		.ascii	"\337\377\270\304\337\377\270\304\337\377\270\304\337\377\271"
+ 738      DFFFB8C4 
+ 738      DFFFB8C4 
+GAS LISTING /tmp/cct9A39C.s 			page 53
+
+
+ 738      DFFFB9
+ 739 2b1d C5E0FFB9 		.ascii	"\305\340\377\271\305\340\377\271\305\340\377\272\305\340\377"
+ 739      C5E0FFB9 
+ 739      C5E0FFBA 
+ 739      C5E0FF
+ 740 2b2c BAC5E0FF 		.ascii	"\272\305\340\377\272\305\340\377\273\305\340\377\273\306\340"
+ 740      BAC5E0FF 
+ 740      BBC5E0FF 
+ 740      BBC6E0
+ 741 2b3b FFBBC6E0 		.ascii	"\377\273\306\340\377\274\306\340\377\274\306\340\377\274\306"
+ 741      FFBCC6E0 
+ 741      FFBCC6E0 
+ 741      FFBCC6
+ 742 2b4a E0FFBDC6 		.ascii	"\340\377\275\306\341\377\275\307\341\377\275\307\341\377\276"
+ 742      E1FFBDC7 
+ 742      E1FFBDC7 
+ 742      E1FFBE
+ 743 2b59 C7E1FFBE 		.ascii	"\307\341\377\276\307\341\377\276\307\341\377\277\307\341\377"
+ 743      C7E1FFBE 
+ 743      C7E1FFBF 
+ 743      C7E1FF
+ 744 2b68 BFC7E1FF 		.ascii	"\277\307\341\377\277\310\341\377\300\310\341\377\300\310\341"
+ 744      BFC8E1FF 
+ 744      C0C8E1FF 
+ 744      C0C8E1
+ 745 2b77 FFC0C8E1 		.ascii	"\377\300\310\341\377\301\310\342\377\301\310\342\377\301\311"
+ 745      FFC1C8E2 
+ 745      FFC1C8E2 
+ 745      FFC1C9
+ 746 2b86 E2FFC1C9 		.ascii	"\342\377\301\311\342\377\302\311\342\377\302\311\342\377\302"
+ 746      E2FFC2C9 
+ 746      E2FFC2C9 
+ 746      E2FFC2
+ 747 2b95 C9E2FFC3 		.ascii	"\311\342\377\303\311\342\377\303\312\342\377\303\312\342\377"
+ 747      C9E2FFC3 
+ 747      CAE2FFC3 
+ 747      CAE2FF
+ 748 2ba4 C4CAE2FF 		.ascii	"\304\312\342\377\304\312\342\377\304\312\343\377\305\312\343"
+ 748      C4CAE2FF 
+ 748      C4CAE3FF 
+ 748      C5CAE3
+ 749 2bb3 FFC5CBE3 		.ascii	"\377\305\313\343\377\305\313\343\377\306\313\343\377\306\313"
+ 749      FFC5CBE3 
+ 749      FFC6CBE3 
+ 749      FFC6CB
+ 750 2bc2 E3FFC6CB 		.ascii	"\343\377\306\313\343\377\306\313\343\377\307\313\343\377\307"
+ 750      E3FFC6CB 
+ 750      E3FFC7CB 
+ 750      E3FFC7
+ 751 2bd1 CCE3FFC7 		.ascii	"\314\343\377\307\314\343\377\310\314\343\377\310\314\343\377"
+ 751      CCE3FFC8 
+ 751      CCE3FFC8 
+ 751      CCE3FF
+ 752 2be0 C8CCE4FF 		.ascii	"\310\314\344\377\311\314\344\377\311\315\344\377\311\315\344"
+ 752      C9CCE4FF 
+ 752      C9CDE4FF 
+ 752      C9CDE4
+GAS LISTING /tmp/cct9A39C.s 			page 54
+
+
+ 753 2bef FFC9CDE4 		.ascii	"\377\311\315\344\377\312\315\344\377\312\315\344\377\312\315"
+ 753      FFCACDE4 
+ 753      FFCACDE4 
+ 753      FFCACD
+ 754 2bfe E4FFCBCE 		.ascii	"\344\377\313\316\344\377\313\316\344\377\313\316\344\377\314"
+ 754      E4FFCBCE 
+ 754      E4FFCBCE 
+ 754      E4FFCC
+ 755 2c0d CEE4FFCC 		.ascii	"\316\344\377\314\316\344\377\314\316\345\377\314\317\345\377"
+ 755      CEE4FFCC 
+ 755      CEE5FFCC 
+ 755      CFE5FF
+ 756 2c1c CDCFE5FF 		.ascii	"\315\317\345\377\315\317\345\377\315\317\345\377\316\317\345"
+ 756      CDCFE5FF 
+ 756      CDCFE5FF 
+ 756      CECFE5
+ 757 2c2b FFCECFE5 		.ascii	"\377\316\317\345\377\316\320\345\377\316\320\345\377\317\320"
+ 757      FFCED0E5 
+ 757      FFCED0E5 
+ 757      FFCFD0
+ 758 2c3a E5FFCFD0 		.ascii	"\345\377\317\320\345\377\317\320\345\377\317\321\345\377\320"
+ 758      E5FFCFD0 
+ 758      E5FFCFD1 
+ 758      E5FFD0
+ 759 2c49 D1E6FFD0 		.ascii	"\321\346\377\320\321\346\377\320\321\346\377\320\321\346\377"
+ 759      D1E6FFD0 
+ 759      D1E6FFD0 
+ 759      D1E6FF
+ 760 2c58 D1D1E6FF 		.ascii	"\321\321\346\377\321\321\346\377\321\322\346\377\321\322\346"
+ 760      D1D1E6FF 
+ 760      D1D2E6FF 
+ 760      D1D2E6
+ 761 2c67 FFD2D2E6 		.ascii	"\377\322\322\346\377\322\322\346\377\322\322\346\377\322\322"
+ 761      FFD2D2E6 
+ 761      FFD2D2E6 
+ 761      FFD2D2
+ 762 2c76 E7FFD3D3 		.ascii	"\347\377\323\323\347\377\323\323\347\377\323\323\347\377\323"
+ 762      E7FFD3D3 
+ 762      E7FFD3D3 
+ 762      E7FFD3
+ 763 2c85 D3E7FFD4 		.ascii	"\323\347\377\324\323\347\377\324\323\347\377\324\324\347\377"
+ 763      D3E7FFD4 
+ 763      D3E7FFD4 
+ 763      D4E7FF
+ 764 2c94 D4D4E7FF 		.ascii	"\324\324\347\377\325\324\347\377\325\324\347\377\325\324\350"
+ 764      D5D4E7FF 
+ 764      D5D4E7FF 
+ 764      D5D4E8
+ 765 2ca3 FFD5D4E8 		.ascii	"\377\325\324\350\377\326\325\350\377\326\325\350\377\326\325"
+ 765      FFD6D5E8 
+ 765      FFD6D5E8 
+ 765      FFD6D5
+ 766 2cb2 E8FFD6D5 		.ascii	"\350\377\326\325\350\377\326\325\350\377\327\325\350\377\327"
+ 766      E8FFD6D5 
+ 766      E8FFD7D5 
+ 766      E8FFD7
+ 767 2cc1 D6E8FFD7 		.ascii	"\326\350\377\327\326\350\377\327\326\350\377\330\326\351\377"
+GAS LISTING /tmp/cct9A39C.s 			page 55
+
+
+ 767      D6E8FFD7 
+ 767      D6E8FFD8 
+ 767      D6E9FF
+ 768 2cd0 D8D6E9FF 		.ascii	"\330\326\351\377\330\326\351\377\330\327\351\377\331\327\351"
+ 768      D8D6E9FF 
+ 768      D8D7E9FF 
+ 768      D9D7E9
+ 769 2cdf FFD9D7E9 		.ascii	"\377\331\327\351\377\331\327\351\377\331\327\351\377\332\327"
+ 769      FFD9D7E9 
+ 769      FFD9D7E9 
+ 769      FFDAD7
+ 770 2cee E9FFDAD8 		.ascii	"\351\377\332\330\351\377\332\330\351\377\332\330\352\377\332"
+ 770      E9FFDAD8 
+ 770      E9FFDAD8 
+ 770      EAFFDA
+ 771 2cfd D8EAFFDB 		.ascii	"\330\352\377\333\330\352\377\333\330\352\377\333\331\352\377"
+ 771      D8EAFFDB 
+ 771      D8EAFFDB 
+ 771      D9EAFF
+ 772 2d0c DBD9EAFF 		.ascii	"\333\331\352\377\334\331\352\377\334\331\352\377\334\331\352"
+ 772      DCD9EAFF 
+ 772      DCD9EAFF 
+ 772      DCD9EA
+ 773 2d1b FFDCD9EA 		.ascii	"\377\334\331\352\377\334\332\352\377\335\332\353\377\335\332"
+ 773      FFDCDAEA 
+ 773      FFDDDAEB 
+ 773      FFDDDA
+ 774 2d2a EBFFDDDA 		.ascii	"\353\377\335\332\353\377\335\332\353\377\336\332\353\377\336"
+ 774      EBFFDDDA 
+ 774      EBFFDEDA 
+ 774      EBFFDE
+ 775 2d39 DBEBFFDE 		.ascii	"\333\353\377\336\333\353\377\336\333\353\377\336\333\353\377"
+ 775      DBEBFFDE 
+ 775      DBEBFFDE 
+ 775      DBEBFF
+ 776 2d48 DFDBEBFF 		.ascii	"\337\333\353\377\337\334\354\377\337\334\354\377\337\334\354"
+ 776      DFDCECFF 
+ 776      DFDCECFF 
+ 776      DFDCEC
+ 777 2d57 FFE0DCEC 		.ascii	"\377\340\334\354\377\340\334\354\377\340\334\354\377\340\335"
+ 777      FFE0DCEC 
+ 777      FFE0DCEC 
+ 777      FFE0DD
+ 778 2d66 ECFFE0DD 		.ascii	"\354\377\340\335\354\377\341\335\354\377\341\335\354\377\341"
+ 778      ECFFE1DD 
+ 778      ECFFE1DD 
+ 778      ECFFE1
+ 779 2d75 DDECFFE1 		.ascii	"\335\354\377\341\335\355\377\341\336\355\377\342\336\355\377"
+ 779      DDEDFFE1 
+ 779      DEEDFFE2 
+ 779      DEEDFF
+ 780 2d84 E2DEEDFF 		.ascii	"\342\336\355\377\342\336\355\377\342\336\355\377\342\336\355"
+ 780      E2DEEDFF 
+ 780      E2DEEDFF 
+ 780      E2DEED
+ 781 2d93 FFE3DFED 		.ascii	"\377\343\337\355\377\343\337\355\377\343\337\355\377\343\337"
+ 781      FFE3DFED 
+GAS LISTING /tmp/cct9A39C.s 			page 56
+
+
+ 781      FFE3DFED 
+ 781      FFE3DF
+ 782 2da2 EDFFE4DF 		.ascii	"\355\377\344\337\356\377\344\340\356\377\344\340\356\377\344"
+ 782      EEFFE4E0 
+ 782      EEFFE4E0 
+ 782      EEFFE4
+ 783 2db1 E0EEFFE4 		.ascii	"\340\356\377\344\340\356\377\345\340\356\377\345\340\356\377"
+ 783      E0EEFFE5 
+ 783      E0EEFFE5 
+ 783      E0EEFF
+ 784 2dc0 E5E1EEFF 		.ascii	"\345\341\356\377\345\341\356\377\345\341\356\377\346\341\357"
+ 784      E5E1EEFF 
+ 784      E5E1EEFF 
+ 784      E6E1EF
+ 785 2dcf FFE6E1EF 		.ascii	"\377\346\341\357\377\346\341\357\377\346\342\357\377\346\342"
+ 785      FFE6E1EF 
+ 785      FFE6E2EF 
+ 785      FFE6E2
+ 786 2dde EFFFE7E2 		.ascii	"\357\377\347\342\357\377\347\342\357\377\347\342\357\377\347"
+ 786      EFFFE7E2 
+ 786      EFFFE7E2 
+ 786      EFFFE7
+ 787 2ded E3EFFFE7 		.ascii	"\343\357\377\347\343\357\377\350\343\360\377\350\343\360\377"
+ 787      E3EFFFE8 
+ 787      E3F0FFE8 
+ 787      E3F0FF
+ 788 2dfc E8E3F0FF 		.ascii	"\350\343\360\377\350\343\360\377\350\344\360\377\351\344\360"
+ 788      E8E3F0FF 
+ 788      E8E4F0FF 
+ 788      E9E4F0
+ 789 2e0b FFE9E4F0 		.ascii	"\377\351\344\360\377\351\344\360\377\351\344\360\377\351\345"
+ 789      FFE9E4F0 
+ 789      FFE9E4F0 
+ 789      FFE9E5
+ 790 2e1a F0FFEAE5 		.ascii	"\360\377\352\345\360\377\352\345\361\377\352\345\361\377\352"
+ 790      F0FFEAE5 
+ 790      F1FFEAE5 
+ 790      F1FFEA
+ 791 2e29 E5F1FFEA 		.ascii	"\345\361\377\352\345\361\377\353\346\361\377\353\346\361\377"
+ 791      E5F1FFEB 
+ 791      E6F1FFEB 
+ 791      E6F1FF
+ 792 2e38 EBE6F1FF 		.ascii	"\353\346\361\377\353\346\361\377\353\346\361\377\353\347\361"
+ 792      EBE6F1FF 
+ 792      EBE6F1FF 
+ 792      EBE7F1
+ 793 2e47 FFECE7F2 		.ascii	"\377\354\347\362\377\354\347\362\377\354\347\362\377\354\347"
+ 793      FFECE7F2 
+ 793      FFECE7F2 
+ 793      FFECE7
+ 794 2e56 F2FFECE7 		.ascii	"\362\377\354\347\362\377\355\347\362\377\355\347\362\377\355"
+ 794      F2FFEDE7 
+ 794      F2FFEDE7 
+ 794      F2FFED
+ 795 2e65 E7F2FFED 		.ascii	"\347\362\377\355\350\362\377\355\350\362\377\355\350\362\377"
+ 795      E8F2FFED 
+ 795      E8F2FFED 
+GAS LISTING /tmp/cct9A39C.s 			page 57
+
+
+ 795      E8F2FF
+ 796 2e74 EEE8F2FF 		.ascii	"\356\350\362\377\356\350\362\377\356\350\362\377\356\350\362"
+ 796      EEE8F2FF 
+ 796      EEE8F2FF 
+ 796      EEE8F2
+ 797 2e83 FFEEE8F3 		.ascii	"\377\356\350\363\377\356\350\363\377\357\351\363\377\357\351"
+ 797      FFEEE8F3 
+ 797      FFEFE9F3 
+ 797      FFEFE9
+ 798 2e92 F3FFEFE9 		.ascii	"\363\377\357\351\363\377\357\351\363\377\357\351\363\377\360"
+ 798      F3FFEFE9 
+ 798      F3FFEFE9 
+ 798      F3FFF0
+ 799 2ea1 E9F3FFF0 		.ascii	"\351\363\377\360\351\363\377\360\351\363\377\360\352\363\377"
+ 799      E9F3FFF0 
+ 799      E9F3FFF0 
+ 799      EAF3FF
+ 800 2eb0 F0EAF3FF 		.ascii	"\360\352\363\377\360\352\363\377\361\352\363\377\361\352\363"
+ 800      F0EAF3FF 
+ 800      F1EAF3FF 
+ 800      F1EAF3
+ 801 2ebf FFF1EAF3 		.ascii	"\377\361\352\363\377\361\352\364\377\361\352\364\377\361\353"
+ 801      FFF1EAF4 
+ 801      FFF1EAF4 
+ 801      FFF1EB
+ 802 2ece F4FFF1EB 		.ascii	"\364\377\361\353\364\377\362\353\364\377\362\353\364\377\362"
+ 802      F4FFF2EB 
+ 802      F4FFF2EB 
+ 802      F4FFF2
+ 803 2edd EBF4FFF2 		.ascii	"\353\364\377\362\353\364\377\362\353\364\377\362\353\364\377"
+ 803      EBF4FFF2 
+ 803      EBF4FFF2 
+ 803      EBF4FF
+ 804 2eec F3EBF4FF 		.ascii	"\363\353\364\377\363\354\364\377\363\354\364\377\363\354\364"
+ 804      F3ECF4FF 
+ 804      F3ECF4FF 
+ 804      F3ECF4
+ 805 2efb FFF3ECF4 		.ascii	"\377\363\354\364\377\363\354\365\377\364\354\365\377\364\354"
+ 805      FFF3ECF5 
+ 805      FFF4ECF5 
+ 805      FFF4EC
+ 806 2f0a F5FFF4EC 		.ascii	"\365\377\364\354\365\377\364\355\365\377\364\355\365\377\364"
+ 806      F5FFF4ED 
+ 806      F5FFF4ED 
+ 806      F5FFF4
+ 807 2f19 EDF5FFF4 		.ascii	"\355\365\377\364\355\365\377\365\355\365\377\365\355\365\377"
+ 807      EDF5FFF5 
+ 807      EDF5FFF5 
+ 807      EDF5FF
+ 808 2f28 F5EDF5FF 		.ascii	"\365\355\365\377\365\355\365\377\365\356\365\377\365\356\365"
+ 808      F5EDF5FF 
+ 808      F5EEF5FF 
+ 808      F5EEF5
+ 809 2f37 FFF6EEF5 		.ascii	"\377\366\356\365\377\366\356\366\377\366\356\366\377\366\356"
+ 809      FFF6EEF6 
+ 809      FFF6EEF6 
+ 809      FFF6EE
+GAS LISTING /tmp/cct9A39C.s 			page 58
+
+
+ 810 2f46 F6FFF6EE 		.ascii	"\366\377\366\356\366\377\366\356\366\377\366\357\366\377\367"
+ 810      F6FFF6EE 
+ 810      F6FFF6EF 
+ 810      F6FFF7
+ 811 2f55 EFF6FFF7 		.ascii	"\357\366\377\367\357\366\377\367\357\366\377\367\357\366\377"
+ 811      EFF6FFF7 
+ 811      EFF6FFF7 
+ 811      EFF6FF
+ 812 2f64 F7EFF6FF 		.ascii	"\367\357\366\377\367\357\366\377\367\357\366\377\370\360\366"
+ 812      F7EFF6FF 
+ 812      F7EFF6FF 
+ 812      F8F0F6
+ 813 2f73 FFF8F0F6 		.ascii	"\377\370\360\366\377\370\360\367\377\370\360\367\377\370\360"
+ 813      FFF8F0F7 
+ 813      FFF8F0F7 
+ 813      FFF8F0
+ 814 2f82 F7FFF8F0 		.ascii	"\367\377\370\360\367\377\370\360\367\377\371\360\367\377\371"
+ 814      F7FFF8F0 
+ 814      F7FFF9F0 
+ 814      F7FFF9
+ 815 2f91 F1F7FFF9 		.ascii	"\361\367\377\371\361\367\377\371\361\367\377\371\361\367\377"
+ 815      F1F7FFF9 
+ 815      F1F7FFF9 
+ 815      F1F7FF
+ 816 2fa0 F9F1F7FF 		.ascii	"\371\361\367\377\371\361\367\377\372\361\367\377\372\362\370"
+ 816      F9F1F7FF 
+ 816      FAF1F7FF 
+ 816      FAF2F8
+ 817 2faf FFFAF2F8 		.ascii	"\377\372\362\370\377\372\362\370\377\372\362\370\377\372\362"
+ 817      FFFAF2F8 
+ 817      FFFAF2F8 
+ 817      FFFAF2
+ 818 2fbe F8FFFAF2 		.ascii	"\370\377\372\362\370\377\372\362\370\377\373\362\370\377\373"
+ 818      F8FFFAF2 
+ 818      F8FFFBF2 
+ 818      F8FFFB
+ 819 2fcd F3F8FFFB 		.ascii	"\363\370\377\373\363\370\377\373\363\370\377\373\363\370\377"
+ 819      F3F8FFFB 
+ 819      F3F8FFFB 
+ 819      F3F8FF
+ 820 2fdc FBF3F8FF 		.ascii	"\373\363\370\377"
+ 821 2fe0 FBF3F8FF 		.ascii	"\373\363\370\377\374\363\371\377\374\363\371\377\374\364\371"
+ 821      FCF3F9FF 
+ 821      FCF3F9FF 
+ 821      FCF4F9
+ 822 2fef FFFCF4F9 		.ascii	"\377\374\364\371\377\374\364\371\377\374\364\371\377\374\364"
+ 822      FFFCF4F9 
+ 822      FFFCF4F9 
+ 822      FFFCF4
+ 823 2ffe F9FFFCF4 		.ascii	"\371\377\374\364\371\377\375\364\371\377\375\365\371\377\375"
+ 823      F9FFFDF4 
+ 823      F9FFFDF5 
+ 823      F9FFFD
+ 824 300d F5F9FFFD 		.ascii	"\365\371\377\375\365\371\377\375\365\372\377\375\365\372\377"
+ 824      F5F9FFFD 
+ 824      F5FAFFFD 
+ 824      F5FAFF
+GAS LISTING /tmp/cct9A39C.s 			page 59
+
+
+ 825 301c FDF5FAFF 		.ascii	"\375\365\372\377\375\365\372\377\376\365\372\377\376\366\372"
+ 825      FDF5FAFF 
+ 825      FEF5FAFF 
+ 825      FEF6FA
+ 826 302b FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 826      FFFEF6FA 
+ 826      FFFEF6FA 
+ 826      FFFEF6
+ 827 303a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377"
+ 827      FAFFFEF6 
+ 827      FAFF
+ 828              		.globl	heatmap_cs_PuBu_discrete
+ 829              		.section	.data.rel.local
+ 830              		.align 8
+ 831              		.type	heatmap_cs_PuBu_discrete, @object
+ 832              		.size	heatmap_cs_PuBu_discrete, 8
+ 833              	heatmap_cs_PuBu_discrete:
+ 834 0018 00000000 		.quad	discrete
+ 834      00000000 
+ 835              		.section	.data.rel.ro.local
+ 836              		.align 16
+ 837              		.type	discrete, @object
+ 838              		.size	discrete, 16
+ 839              	discrete:
+ 840 0030 00000000 		.quad	discrete_data
+ 840      00000000 
+ 841 0038 0A000000 		.quad	10
+ 841      00000000 
+ 842              		.section	.rodata
+ 843 3044 00000000 		.align 32
+ 843      00000000 
+ 843      00000000 
+ 843      00000000 
+ 843      00000000 
+ 844              		.type	discrete_data, @object
+ 845              		.size	discrete_data, 40
+ 846              	discrete_data:
+ 847 3060 00       		.string	""
+ 848 3061 00       		.string	""
+ 849 3062 00       		.string	""
+ 850 3063 00       		.string	""
+ 851 3064 023858FF 		.ascii	"\0028X\377\004Z\215\377\005p\260\3776\220\300\377t\251\317\377"
+ 851      045A8DFF 
+ 851      0570B0FF 
+ 851      3690C0FF 
+ 851      74A9CFFF 
+ 852 3078 A6BDDBFF 		.ascii	"\246\275\333\377\320\321\346\377\354\347\362\377\377\367\373"
+ 852      D0D1E6FF 
+ 852      ECE7F2FF 
+ 852      FFF7FB
+ 853 3087 FF       		.ascii	"\377"
+ 854              		.text
+ 855              	.Letext0:
+ 856              		.file 1 "./heatmap.h"
+ 857              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 858              		.file 3 "./colorschemes/PuBu.h"
+ 859              		.file 4 "colorschemes/PuBu.c"
+GAS LISTING /tmp/cct9A39C.s 			page 60
+
+
+ 860              		.section	.debug_info,"",@progbits
+ 861              	.Ldebug_info0:
+ 862 0000 E3010000 		.long	0x1e3
+ 863 0004 0500     		.value	0x5
+ 864 0006 01       		.byte	0x1
+ 865 0007 08       		.byte	0x8
+ 866 0008 00000000 		.long	.Ldebug_abbrev0
+ 867 000c 0A       		.uleb128 0xa
+ 868 000d 00000000 		.long	.LASF26
+ 869 0011 1D       		.byte	0x1d
+ 870 0012 00000000 		.long	.LASF0
+ 871 0016 00000000 		.long	.LASF1
+ 872 001a 00000000 		.long	.Ldebug_line0
+ 873 001e 01       		.uleb128 0x1
+ 874 001f 08       		.byte	0x8
+ 875 0020 05       		.byte	0x5
+ 876 0021 00000000 		.long	.LASF2
+ 877 0025 06       		.uleb128 0x6
+ 878 0026 00000000 		.long	.LASF12
+ 879 002a 02       		.byte	0x2
+ 880 002b D6       		.byte	0xd6
+ 881 002c 17       		.byte	0x17
+ 882 002d 31000000 		.long	0x31
+ 883 0031 01       		.uleb128 0x1
+ 884 0032 08       		.byte	0x8
+ 885 0033 07       		.byte	0x7
+ 886 0034 00000000 		.long	.LASF3
+ 887 0038 0B       		.uleb128 0xb
+ 888 0039 04       		.byte	0x4
+ 889 003a 05       		.byte	0x5
+ 890 003b 696E7400 		.string	"int"
+ 891 003f 01       		.uleb128 0x1
+ 892 0040 08       		.byte	0x8
+ 893 0041 05       		.byte	0x5
+ 894 0042 00000000 		.long	.LASF4
+ 895 0046 01       		.uleb128 0x1
+ 896 0047 10       		.byte	0x10
+ 897 0048 04       		.byte	0x4
+ 898 0049 00000000 		.long	.LASF5
+ 899 004d 01       		.uleb128 0x1
+ 900 004e 04       		.byte	0x4
+ 901 004f 04       		.byte	0x4
+ 902 0050 00000000 		.long	.LASF6
+ 903 0054 01       		.uleb128 0x1
+ 904 0055 04       		.byte	0x4
+ 905 0056 07       		.byte	0x7
+ 906 0057 00000000 		.long	.LASF7
+ 907 005b 01       		.uleb128 0x1
+ 908 005c 02       		.byte	0x2
+ 909 005d 07       		.byte	0x7
+ 910 005e 00000000 		.long	.LASF8
+ 911 0062 0C       		.uleb128 0xc
+ 912 0063 10       		.byte	0x10
+ 913 0064 01       		.byte	0x1
+ 914 0065 BB       		.byte	0xbb
+ 915 0066 09       		.byte	0x9
+ 916 0067 84000000 		.long	0x84
+GAS LISTING /tmp/cct9A39C.s 			page 61
+
+
+ 917 006b 07       		.uleb128 0x7
+ 918 006c 00000000 		.long	.LASF9
+ 919 0070 BC       		.byte	0xbc
+ 920 0071 1A       		.byte	0x1a
+ 921 0072 84000000 		.long	0x84
+ 922 0076 00       		.byte	0
+ 923 0077 07       		.uleb128 0x7
+ 924 0078 00000000 		.long	.LASF10
+ 925 007c BD       		.byte	0xbd
+ 926 007d 0C       		.byte	0xc
+ 927 007e 25000000 		.long	0x25
+ 928 0082 08       		.byte	0x8
+ 929 0083 00       		.byte	0
+ 930 0084 08       		.uleb128 0x8
+ 931 0085 90000000 		.long	0x90
+ 932 0089 01       		.uleb128 0x1
+ 933 008a 01       		.byte	0x1
+ 934 008b 08       		.byte	0x8
+ 935 008c 00000000 		.long	.LASF11
+ 936 0090 03       		.uleb128 0x3
+ 937 0091 89000000 		.long	0x89
+ 938 0095 06       		.uleb128 0x6
+ 939 0096 00000000 		.long	.LASF13
+ 940 009a 01       		.byte	0x1
+ 941 009b BE       		.byte	0xbe
+ 942 009c 03       		.byte	0x3
+ 943 009d 62000000 		.long	0x62
+ 944 00a1 03       		.uleb128 0x3
+ 945 00a2 95000000 		.long	0x95
+ 946 00a6 08       		.uleb128 0x8
+ 947 00a7 A1000000 		.long	0xa1
+ 948 00ab 04       		.uleb128 0x4
+ 949 00ac 00000000 		.long	.LASF14
+ 950 00b0 21       		.byte	0x21
+ 951 00b1 A6000000 		.long	0xa6
+ 952 00b5 04       		.uleb128 0x4
+ 953 00b6 00000000 		.long	.LASF15
+ 954 00ba 23       		.byte	0x23
+ 955 00bb A6000000 		.long	0xa6
+ 956 00bf 04       		.uleb128 0x4
+ 957 00c0 00000000 		.long	.LASF16
+ 958 00c4 25       		.byte	0x25
+ 959 00c5 A6000000 		.long	0xa6
+ 960 00c9 04       		.uleb128 0x4
+ 961 00ca 00000000 		.long	.LASF17
+ 962 00ce 28       		.byte	0x28
+ 963 00cf A6000000 		.long	0xa6
+ 964 00d3 09       		.uleb128 0x9
+ 965 00d4 90000000 		.long	0x90
+ 966 00d8 E3000000 		.long	0xe3
+ 967 00dc 0D       		.uleb128 0xd
+ 968 00dd 31000000 		.long	0x31
+ 969 00e1 27       		.byte	0x27
+ 970 00e2 00       		.byte	0
+ 971 00e3 03       		.uleb128 0x3
+ 972 00e4 D3000000 		.long	0xd3
+ 973 00e8 02       		.uleb128 0x2
+GAS LISTING /tmp/cct9A39C.s 			page 62
+
+
+ 974 00e9 00000000 		.long	.LASF18
+ 975 00ed 20       		.byte	0x20
+ 976 00ee 1C       		.byte	0x1c
+ 977 00ef E3000000 		.long	0xe3
+ 978 00f3 09       		.uleb128 0x9
+ 979 00f4 03       		.byte	0x3
+ 980 00f5 00000000 		.quad	discrete_data
+ 980      00000000 
+ 981 00fd 02       		.uleb128 0x2
+ 982 00fe 00000000 		.long	.LASF19
+ 983 0102 23       		.byte	0x23
+ 984 0103 24       		.byte	0x24
+ 985 0104 A1000000 		.long	0xa1
+ 986 0108 09       		.uleb128 0x9
+ 987 0109 03       		.byte	0x3
+ 988 010a 00000000 		.quad	discrete
+ 988      00000000 
+ 989 0112 05       		.uleb128 0x5
+ 990 0113 AB000000 		.long	0xab
+ 991 0117 24       		.byte	0x24
+ 992 0118 09       		.uleb128 0x9
+ 993 0119 03       		.byte	0x3
+ 994 011a 00000000 		.quad	heatmap_cs_PuBu_discrete
+ 994      00000000 
+ 995 0122 09       		.uleb128 0x9
+ 996 0123 90000000 		.long	0x90
+ 997 0127 33010000 		.long	0x133
+ 998 012b 0E       		.uleb128 0xe
+ 999 012c 31000000 		.long	0x31
+ 1000 0130 0310     		.value	0x1003
+ 1001 0132 00       		.byte	0
+ 1002 0133 03       		.uleb128 0x3
+ 1003 0134 22010000 		.long	0x122
+ 1004 0138 02       		.uleb128 0x2
+ 1005 0139 00000000 		.long	.LASF20
+ 1006 013d 26       		.byte	0x26
+ 1007 013e 1C       		.byte	0x1c
+ 1008 013f 33010000 		.long	0x133
+ 1009 0143 09       		.uleb128 0x9
+ 1010 0144 03       		.byte	0x3
+ 1011 0145 00000000 		.quad	soft_data
+ 1011      00000000 
+ 1012 014d 02       		.uleb128 0x2
+ 1013 014e 00000000 		.long	.LASF21
+ 1014 0152 29       		.byte	0x29
+ 1015 0153 24       		.byte	0x24
+ 1016 0154 A1000000 		.long	0xa1
+ 1017 0158 09       		.uleb128 0x9
+ 1018 0159 03       		.byte	0x3
+ 1019 015a 00000000 		.quad	soft
+ 1019      00000000 
+ 1020 0162 05       		.uleb128 0x5
+ 1021 0163 B5000000 		.long	0xb5
+ 1022 0167 2A       		.byte	0x2a
+ 1023 0168 09       		.uleb128 0x9
+ 1024 0169 03       		.byte	0x3
+ 1025 016a 00000000 		.quad	heatmap_cs_PuBu_soft
+GAS LISTING /tmp/cct9A39C.s 			page 63
+
+
+ 1025      00000000 
+ 1026 0172 02       		.uleb128 0x2
+ 1027 0173 00000000 		.long	.LASF22
+ 1028 0177 2C       		.byte	0x2c
+ 1029 0178 1C       		.byte	0x1c
+ 1030 0179 33010000 		.long	0x133
+ 1031 017d 09       		.uleb128 0x9
+ 1032 017e 03       		.byte	0x3
+ 1033 017f 00000000 		.quad	mixed_data
+ 1033      00000000 
+ 1034 0187 02       		.uleb128 0x2
+ 1035 0188 00000000 		.long	.LASF23
+ 1036 018c 2F       		.byte	0x2f
+ 1037 018d 24       		.byte	0x24
+ 1038 018e A1000000 		.long	0xa1
+ 1039 0192 09       		.uleb128 0x9
+ 1040 0193 03       		.byte	0x3
+ 1041 0194 00000000 		.quad	mixed
+ 1041      00000000 
+ 1042 019c 05       		.uleb128 0x5
+ 1043 019d BF000000 		.long	0xbf
+ 1044 01a1 30       		.byte	0x30
+ 1045 01a2 09       		.uleb128 0x9
+ 1046 01a3 03       		.byte	0x3
+ 1047 01a4 00000000 		.quad	heatmap_cs_PuBu_mixed
+ 1047      00000000 
+ 1048 01ac 02       		.uleb128 0x2
+ 1049 01ad 00000000 		.long	.LASF24
+ 1050 01b1 32       		.byte	0x32
+ 1051 01b2 1C       		.byte	0x1c
+ 1052 01b3 33010000 		.long	0x133
+ 1053 01b7 09       		.uleb128 0x9
+ 1054 01b8 03       		.byte	0x3
+ 1055 01b9 00000000 		.quad	mixed_exp_data
+ 1055      00000000 
+ 1056 01c1 02       		.uleb128 0x2
+ 1057 01c2 00000000 		.long	.LASF25
+ 1058 01c6 35       		.byte	0x35
+ 1059 01c7 24       		.byte	0x24
+ 1060 01c8 A1000000 		.long	0xa1
+ 1061 01cc 09       		.uleb128 0x9
+ 1062 01cd 03       		.byte	0x3
+ 1063 01ce 00000000 		.quad	mixed_exp
+ 1063      00000000 
+ 1064 01d6 05       		.uleb128 0x5
+ 1065 01d7 C9000000 		.long	0xc9
+ 1066 01db 36       		.byte	0x36
+ 1067 01dc 09       		.uleb128 0x9
+ 1068 01dd 03       		.byte	0x3
+ 1069 01de 00000000 		.quad	heatmap_cs_PuBu_mixed_exp
+ 1069      00000000 
+ 1070 01e6 00       		.byte	0
+ 1071              		.section	.debug_abbrev,"",@progbits
+ 1072              	.Ldebug_abbrev0:
+ 1073 0000 01       		.uleb128 0x1
+ 1074 0001 24       		.uleb128 0x24
+ 1075 0002 00       		.byte	0
+GAS LISTING /tmp/cct9A39C.s 			page 64
+
+
+ 1076 0003 0B       		.uleb128 0xb
+ 1077 0004 0B       		.uleb128 0xb
+ 1078 0005 3E       		.uleb128 0x3e
+ 1079 0006 0B       		.uleb128 0xb
+ 1080 0007 03       		.uleb128 0x3
+ 1081 0008 0E       		.uleb128 0xe
+ 1082 0009 00       		.byte	0
+ 1083 000a 00       		.byte	0
+ 1084 000b 02       		.uleb128 0x2
+ 1085 000c 34       		.uleb128 0x34
+ 1086 000d 00       		.byte	0
+ 1087 000e 03       		.uleb128 0x3
+ 1088 000f 0E       		.uleb128 0xe
+ 1089 0010 3A       		.uleb128 0x3a
+ 1090 0011 21       		.uleb128 0x21
+ 1091 0012 04       		.sleb128 4
+ 1092 0013 3B       		.uleb128 0x3b
+ 1093 0014 0B       		.uleb128 0xb
+ 1094 0015 39       		.uleb128 0x39
+ 1095 0016 0B       		.uleb128 0xb
+ 1096 0017 49       		.uleb128 0x49
+ 1097 0018 13       		.uleb128 0x13
+ 1098 0019 02       		.uleb128 0x2
+ 1099 001a 18       		.uleb128 0x18
+ 1100 001b 00       		.byte	0
+ 1101 001c 00       		.byte	0
+ 1102 001d 03       		.uleb128 0x3
+ 1103 001e 26       		.uleb128 0x26
+ 1104 001f 00       		.byte	0
+ 1105 0020 49       		.uleb128 0x49
+ 1106 0021 13       		.uleb128 0x13
+ 1107 0022 00       		.byte	0
+ 1108 0023 00       		.byte	0
+ 1109 0024 04       		.uleb128 0x4
+ 1110 0025 34       		.uleb128 0x34
+ 1111 0026 00       		.byte	0
+ 1112 0027 03       		.uleb128 0x3
+ 1113 0028 0E       		.uleb128 0xe
+ 1114 0029 3A       		.uleb128 0x3a
+ 1115 002a 21       		.uleb128 0x21
+ 1116 002b 03       		.sleb128 3
+ 1117 002c 3B       		.uleb128 0x3b
+ 1118 002d 0B       		.uleb128 0xb
+ 1119 002e 39       		.uleb128 0x39
+ 1120 002f 21       		.uleb128 0x21
+ 1121 0030 25       		.sleb128 37
+ 1122 0031 49       		.uleb128 0x49
+ 1123 0032 13       		.uleb128 0x13
+ 1124 0033 3F       		.uleb128 0x3f
+ 1125 0034 19       		.uleb128 0x19
+ 1126 0035 3C       		.uleb128 0x3c
+ 1127 0036 19       		.uleb128 0x19
+ 1128 0037 00       		.byte	0
+ 1129 0038 00       		.byte	0
+ 1130 0039 05       		.uleb128 0x5
+ 1131 003a 34       		.uleb128 0x34
+ 1132 003b 00       		.byte	0
+GAS LISTING /tmp/cct9A39C.s 			page 65
+
+
+ 1133 003c 47       		.uleb128 0x47
+ 1134 003d 13       		.uleb128 0x13
+ 1135 003e 3A       		.uleb128 0x3a
+ 1136 003f 21       		.uleb128 0x21
+ 1137 0040 04       		.sleb128 4
+ 1138 0041 3B       		.uleb128 0x3b
+ 1139 0042 0B       		.uleb128 0xb
+ 1140 0043 39       		.uleb128 0x39
+ 1141 0044 21       		.uleb128 0x21
+ 1142 0045 1E       		.sleb128 30
+ 1143 0046 02       		.uleb128 0x2
+ 1144 0047 18       		.uleb128 0x18
+ 1145 0048 00       		.byte	0
+ 1146 0049 00       		.byte	0
+ 1147 004a 06       		.uleb128 0x6
+ 1148 004b 16       		.uleb128 0x16
+ 1149 004c 00       		.byte	0
+ 1150 004d 03       		.uleb128 0x3
+ 1151 004e 0E       		.uleb128 0xe
+ 1152 004f 3A       		.uleb128 0x3a
+ 1153 0050 0B       		.uleb128 0xb
+ 1154 0051 3B       		.uleb128 0x3b
+ 1155 0052 0B       		.uleb128 0xb
+ 1156 0053 39       		.uleb128 0x39
+ 1157 0054 0B       		.uleb128 0xb
+ 1158 0055 49       		.uleb128 0x49
+ 1159 0056 13       		.uleb128 0x13
+ 1160 0057 00       		.byte	0
+ 1161 0058 00       		.byte	0
+ 1162 0059 07       		.uleb128 0x7
+ 1163 005a 0D       		.uleb128 0xd
+ 1164 005b 00       		.byte	0
+ 1165 005c 03       		.uleb128 0x3
+ 1166 005d 0E       		.uleb128 0xe
+ 1167 005e 3A       		.uleb128 0x3a
+ 1168 005f 21       		.uleb128 0x21
+ 1169 0060 01       		.sleb128 1
+ 1170 0061 3B       		.uleb128 0x3b
+ 1171 0062 0B       		.uleb128 0xb
+ 1172 0063 39       		.uleb128 0x39
+ 1173 0064 0B       		.uleb128 0xb
+ 1174 0065 49       		.uleb128 0x49
+ 1175 0066 13       		.uleb128 0x13
+ 1176 0067 38       		.uleb128 0x38
+ 1177 0068 0B       		.uleb128 0xb
+ 1178 0069 00       		.byte	0
+ 1179 006a 00       		.byte	0
+ 1180 006b 08       		.uleb128 0x8
+ 1181 006c 0F       		.uleb128 0xf
+ 1182 006d 00       		.byte	0
+ 1183 006e 0B       		.uleb128 0xb
+ 1184 006f 21       		.uleb128 0x21
+ 1185 0070 08       		.sleb128 8
+ 1186 0071 49       		.uleb128 0x49
+ 1187 0072 13       		.uleb128 0x13
+ 1188 0073 00       		.byte	0
+ 1189 0074 00       		.byte	0
+GAS LISTING /tmp/cct9A39C.s 			page 66
+
+
+ 1190 0075 09       		.uleb128 0x9
+ 1191 0076 01       		.uleb128 0x1
+ 1192 0077 01       		.byte	0x1
+ 1193 0078 49       		.uleb128 0x49
+ 1194 0079 13       		.uleb128 0x13
+ 1195 007a 01       		.uleb128 0x1
+ 1196 007b 13       		.uleb128 0x13
+ 1197 007c 00       		.byte	0
+ 1198 007d 00       		.byte	0
+ 1199 007e 0A       		.uleb128 0xa
+ 1200 007f 11       		.uleb128 0x11
+ 1201 0080 01       		.byte	0x1
+ 1202 0081 25       		.uleb128 0x25
+ 1203 0082 0E       		.uleb128 0xe
+ 1204 0083 13       		.uleb128 0x13
+ 1205 0084 0B       		.uleb128 0xb
+ 1206 0085 03       		.uleb128 0x3
+ 1207 0086 1F       		.uleb128 0x1f
+ 1208 0087 1B       		.uleb128 0x1b
+ 1209 0088 1F       		.uleb128 0x1f
+ 1210 0089 10       		.uleb128 0x10
+ 1211 008a 17       		.uleb128 0x17
+ 1212 008b 00       		.byte	0
+ 1213 008c 00       		.byte	0
+ 1214 008d 0B       		.uleb128 0xb
+ 1215 008e 24       		.uleb128 0x24
+ 1216 008f 00       		.byte	0
+ 1217 0090 0B       		.uleb128 0xb
+ 1218 0091 0B       		.uleb128 0xb
+ 1219 0092 3E       		.uleb128 0x3e
+ 1220 0093 0B       		.uleb128 0xb
+ 1221 0094 03       		.uleb128 0x3
+ 1222 0095 08       		.uleb128 0x8
+ 1223 0096 00       		.byte	0
+ 1224 0097 00       		.byte	0
+ 1225 0098 0C       		.uleb128 0xc
+ 1226 0099 13       		.uleb128 0x13
+ 1227 009a 01       		.byte	0x1
+ 1228 009b 0B       		.uleb128 0xb
+ 1229 009c 0B       		.uleb128 0xb
+ 1230 009d 3A       		.uleb128 0x3a
+ 1231 009e 0B       		.uleb128 0xb
+ 1232 009f 3B       		.uleb128 0x3b
+ 1233 00a0 0B       		.uleb128 0xb
+ 1234 00a1 39       		.uleb128 0x39
+ 1235 00a2 0B       		.uleb128 0xb
+ 1236 00a3 01       		.uleb128 0x1
+ 1237 00a4 13       		.uleb128 0x13
+ 1238 00a5 00       		.byte	0
+ 1239 00a6 00       		.byte	0
+ 1240 00a7 0D       		.uleb128 0xd
+ 1241 00a8 21       		.uleb128 0x21
+ 1242 00a9 00       		.byte	0
+ 1243 00aa 49       		.uleb128 0x49
+ 1244 00ab 13       		.uleb128 0x13
+ 1245 00ac 2F       		.uleb128 0x2f
+ 1246 00ad 0B       		.uleb128 0xb
+GAS LISTING /tmp/cct9A39C.s 			page 67
+
+
+ 1247 00ae 00       		.byte	0
+ 1248 00af 00       		.byte	0
+ 1249 00b0 0E       		.uleb128 0xe
+ 1250 00b1 21       		.uleb128 0x21
+ 1251 00b2 00       		.byte	0
+ 1252 00b3 49       		.uleb128 0x49
+ 1253 00b4 13       		.uleb128 0x13
+ 1254 00b5 2F       		.uleb128 0x2f
+ 1255 00b6 05       		.uleb128 0x5
+ 1256 00b7 00       		.byte	0
+ 1257 00b8 00       		.byte	0
+ 1258 00b9 00       		.byte	0
+ 1259              		.section	.debug_aranges,"",@progbits
+ 1260 0000 1C000000 		.long	0x1c
+ 1261 0004 0200     		.value	0x2
+ 1262 0006 00000000 		.long	.Ldebug_info0
+ 1263 000a 08       		.byte	0x8
+ 1264 000b 00       		.byte	0
+ 1265 000c 0000     		.value	0
+ 1266 000e 0000     		.value	0
+ 1267 0010 00000000 		.quad	0
+ 1267      00000000 
+ 1268 0018 00000000 		.quad	0
+ 1268      00000000 
+ 1269              		.section	.debug_line,"",@progbits
+ 1270              	.Ldebug_line0:
+ 1271 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1271      05000800 
+ 1271      49000000 
+ 1271      010101FB 
+ 1271      0E0D0001 
+ 1272              	.LASF19:
+ 1273 0000 64697363 		.string	"discrete"
+ 1273      72657465 
+ 1273      00
+ 1274              	.LASF20:
+ 1275 0009 736F6674 		.string	"soft_data"
+ 1275      5F646174 
+ 1275      6100
+ 1276              	.LASF12:
+ 1277 0013 73697A65 		.string	"size_t"
+ 1277      5F7400
+ 1278              	.LASF13:
+ 1279 001a 68656174 		.string	"heatmap_colorscheme_t"
+ 1279      6D61705F 
+ 1279      636F6C6F 
+ 1279      72736368 
+ 1279      656D655F 
+ 1280              	.LASF26:
+ 1281 0030 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1281      43313720 
+ 1281      31322E32 
+ 1281      2E30202D 
+ 1281      6D74756E 
+ 1282              	.LASF6:
+ 1283 008f 666C6F61 		.string	"float"
+ 1283      7400
+GAS LISTING /tmp/cct9A39C.s 			page 68
+
+
+ 1284              	.LASF15:
+ 1285 0095 68656174 		.string	"heatmap_cs_PuBu_soft"
+ 1285      6D61705F 
+ 1285      63735F50 
+ 1285      7542755F 
+ 1285      736F6674 
+ 1286              	.LASF11:
+ 1287 00aa 756E7369 		.string	"unsigned char"
+ 1287      676E6564 
+ 1287      20636861 
+ 1287      7200
+ 1288              	.LASF3:
+ 1289 00b8 6C6F6E67 		.string	"long unsigned int"
+ 1289      20756E73 
+ 1289      69676E65 
+ 1289      6420696E 
+ 1289      7400
+ 1290              	.LASF8:
+ 1291 00ca 73686F72 		.string	"short unsigned int"
+ 1291      7420756E 
+ 1291      7369676E 
+ 1291      65642069 
+ 1291      6E7400
+ 1292              	.LASF25:
+ 1293 00dd 6D697865 		.string	"mixed_exp"
+ 1293      645F6578 
+ 1293      7000
+ 1294              	.LASF23:
+ 1295 00e7 6D697865 		.string	"mixed"
+ 1295      6400
+ 1296              	.LASF17:
+ 1297 00ed 68656174 		.string	"heatmap_cs_PuBu_mixed_exp"
+ 1297      6D61705F 
+ 1297      63735F50 
+ 1297      7542755F 
+ 1297      6D697865 
+ 1298              	.LASF7:
+ 1299 0107 756E7369 		.string	"unsigned int"
+ 1299      676E6564 
+ 1299      20696E74 
+ 1299      00
+ 1300              	.LASF14:
+ 1301 0114 68656174 		.string	"heatmap_cs_PuBu_discrete"
+ 1301      6D61705F 
+ 1301      63735F50 
+ 1301      7542755F 
+ 1301      64697363 
+ 1302              	.LASF10:
+ 1303 012d 6E636F6C 		.string	"ncolors"
+ 1303      6F727300 
+ 1304              	.LASF4:
+ 1305 0135 6C6F6E67 		.string	"long long int"
+ 1305      206C6F6E 
+ 1305      6720696E 
+ 1305      7400
+ 1306              	.LASF24:
+ 1307 0143 6D697865 		.string	"mixed_exp_data"
+GAS LISTING /tmp/cct9A39C.s 			page 69
+
+
+ 1307      645F6578 
+ 1307      705F6461 
+ 1307      746100
+ 1308              	.LASF22:
+ 1309 0152 6D697865 		.string	"mixed_data"
+ 1309      645F6461 
+ 1309      746100
+ 1310              	.LASF2:
+ 1311 015d 6C6F6E67 		.string	"long int"
+ 1311      20696E74 
+ 1311      00
+ 1312              	.LASF5:
+ 1313 0166 6C6F6E67 		.string	"long double"
+ 1313      20646F75 
+ 1313      626C6500 
+ 1314              	.LASF18:
+ 1315 0172 64697363 		.string	"discrete_data"
+ 1315      72657465 
+ 1315      5F646174 
+ 1315      6100
+ 1316              	.LASF21:
+ 1317 0180 736F6674 		.string	"soft"
+ 1317      00
+ 1318              	.LASF9:
+ 1319 0185 636F6C6F 		.string	"colors"
+ 1319      727300
+ 1320              	.LASF16:
+ 1321 018c 68656174 		.string	"heatmap_cs_PuBu_mixed"
+ 1321      6D61705F 
+ 1321      63735F50 
+ 1321      7542755F 
+ 1321      6D697865 
+ 1322              		.section	.debug_line_str,"MS",@progbits,1
+ 1323              	.LASF1:
+ 1324 0000 2F726F6F 		.string	"/root/repo"
+ 1324      742F7265 
+ 1324      706F00
+ 1325              	.LASF0:
+ 1326 000b 636F6C6F 		.string	"colorschemes/PuBu.c"
+ 1326      72736368 
+ 1326      656D6573 
+ 1326      2F507542 
+ 1326      752E6300 
+ 1327              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1328 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1328      742F7265 
+ 1328      706F0063 
+ 1328      6F6C6F72 
+ 1328      73636865 
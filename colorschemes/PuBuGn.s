@@ -0,0 +1,3983 @@
+GAS LISTING /tmp/ccMVh1cW.s 			page 1
+
+
+   1              		.file	"PuBuGn.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/PuBuGn.c"
+   5              		.globl	heatmap_cs_PuBuGn_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_PuBuGn_mixed_exp, @object
+   9              		.size	heatmap_cs_PuBuGn_mixed_exp, 8
+  10              	heatmap_cs_PuBuGn_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 01463500 		.string	"\001F5"
+  29 0008 01483818 		.string	"\001H8\030\001J:1\001L<J\001O>c\001Q@|\001SB\225\001]K\256\001_M\307\001aO\340\001dQ\371\
+  29      014A3A31 
+  29      014C3C4A 
+  29      014F3E63 
+  29      0151407C 
+  30 003d 6C5AFF00 		.string	"lZ\377"
+  31 0041 6D5CFF00 		.string	"m\\\377"
+  32 0045 6E5FFF00 		.string	"n_\377"
+  33 0049 7062FF00 		.string	"pb\377"
+  34 004d 7165FF00 		.string	"qe\377"
+  35 0051 7267FF00 		.string	"rg\377"
+  36 0055 736AFF00 		.string	"sj\377"
+  37 0059 746CFF00 		.string	"tl\377"
+  38 005d 7979FF00 		.string	"yy\377"
+  39 0061 7B7BFF00 		.string	"{{\377"
+  40 0065 7C7EFF00 		.string	"|~\377"
+  41 0069 7D80FF00 		.string	"}\200\377"
+  42 006d 7E83FF00 		.string	"~\203\377"
+  43 0071 7F85FF00 		.string	"\177\205\377"
+  44 0075 8087FF01 		.string	"\200\207\377\001\200\211\377"
+  44      8089FF00 
+  45 007d 818CFF00 		.string	"\201\214\377"
+  46 0081 828FFF00 		.string	"\202\217\377"
+  47 0085 8392FF00 		.string	"\203\222\377"
+  48 0089 8494FF00 		.string	"\204\224\377"
+  49 008d 8597FF00 		.string	"\205\227\377"
+GAS LISTING /tmp/ccMVh1cW.s 			page 2
+
+
+  50 0091 869AFF00 		.string	"\206\232\377"
+  51 0095 869CFF00 		.string	"\206\234\377"
+  52 0099 879FFF0B 		.ascii	"\207\237\377\013\213\254\377\020\213\256\377\026\214\261\377"
+  52      8BACFF10 
+  52      8BAEFF16 
+  52      8CB1FF
+  53 00a8 1B8DB3FF 		.ascii	"\033\215\263\377 \215\265\377$\216\270\377)\216\272\377-\217"
+  53      208DB5FF 
+  53      248EB8FF 
+  53      298EBAFF 
+  53      2D8F
+  54 00ba BCFF318F 		.ascii	"\274\3771\217\276\3775\217\277\3778\220\300\377:\221\301\377"
+  54      BEFF358F 
+  54      BFFF3890 
+  54      C0FF3A91 
+  54      C1FF
+  55 00cc 3C92C1FF 		.ascii	"<\222\301\377?\223\302\377A\224\302\377C\225\303\377E\226\304"
+  55      3F93C2FF 
+  55      4194C2FF 
+  55      4395C3FF 
+  55      4596C4
+  56 00df FF4797C4 		.ascii	"\377G\227\304\377H\230\305\377J\231\305\377V\237\311\377X\240"
+  56      FF4898C5 
+  56      FF4A99C5 
+  56      FF569FC9 
+  56      FF58A0
+  57 00f2 C9FF59A1 		.ascii	"\311\377Y\241\312\377[\242\313\377\\\243\313\377^\244\314\377"
+  57      CAFF5BA2 
+  57      CBFF5CA3 
+  57      CBFF5EA4 
+  57      CCFF
+  58 0104 60A5CCFF 		.ascii	"`\245\314\377a\245\315\377c\246\315\377d\247\316\377f\250\316"
+  58      61A5CDFF 
+  58      63A6CDFF 
+  58      64A7CEFF 
+  58      66A8CE
+  59 0117 FF68A9CF 		.ascii	"\377h\251\317\377j\251\317\377m\252\320\377o\253\320\377q\253"
+  59      FF6AA9CF 
+  59      FF6DAAD0 
+  59      FF6FABD0 
+  59      FF71AB
+  60 012a D1FF73AC 		.ascii	"\321\377s\254\321\377v\254\322\377x\255\322\377z\256\322\377"
+  60      D1FF76AC 
+  60      D2FF78AD 
+  60      D2FF7AAE 
+  60      D2FF
+  61 013c 7CAED3FF 		.ascii	"|\256\323\377~\257\323\377\200\257\324\377\202\260\324\377\220"
+  61      7EAFD3FF 
+  61      80AFD4FF 
+  61      82B0D4FF 
+  61      90
+  62 014d B5D7FF92 		.ascii	"\265\327\377\222\265\327\377\224\266\327\377\225\266\330\377"
+  62      B5D7FF94 
+  62      B6D7FF95 
+  62      B6D8FF
+  63 015c 97B7D8FF 		.ascii	"\227\267\330\377\231\270\330\377\232\270\331\377\234\271\331"
+  63      99B8D8FF 
+GAS LISTING /tmp/ccMVh1cW.s 			page 3
+
+
+  63      9AB8D9FF 
+  63      9CB9D9
+  64 016b FF9DB9D9 		.ascii	"\377\235\271\331\377\237\272\331\377\240\272\332\377\242\273"
+  64      FF9FBAD9 
+  64      FFA0BADA 
+  64      FFA2BB
+  65 017a DAFFA3BC 		.ascii	"\332\377\243\274\332\377\245\274\332\377\246\275\333\377\247"
+  65      DAFFA5BC 
+  65      DAFFA6BD 
+  65      DBFFA7
+  66 0189 BDDBFFA8 		.ascii	"\275\333\377\250\276\333\377\252\276\334\377\253\277\334\377"
+  66      BEDBFFAA 
+  66      BEDCFFAB 
+  66      BFDCFF
+  67 0198 ACBFDCFF 		.ascii	"\254\277\334\377\255\277\334\377\256\300\335\377\257\300\335"
+  67      ADBFDCFF 
+  67      AEC0DDFF 
+  67      AFC0DD
+  68 01a7 FFB0C1DD 		.ascii	"\377\260\301\335\377\261\301\336\377\262\302\336\377\263\302"
+  68      FFB1C1DE 
+  68      FFB2C2DE 
+  68      FFB3C2
+  69 01b6 DEFFB4C3 		.ascii	"\336\377\264\303\336\377\265\303\337\377\266\304\337\377\267"
+  69      DEFFB5C3 
+  69      DFFFB6C4 
+  69      DFFFB7
+  70 01c5 C4DFFFC0 		.ascii	"\304\337\377\300\310\342\377\301\311\342\377\302\311\342\377"
+  70      C8E2FFC1 
+  70      C9E2FFC2 
+  70      C9E2FF
+  71 01d4 C3CAE2FF 		.ascii	"\303\312\342\377\304\312\342\377\305\313\343\377\306\313\343"
+  71      C4CAE2FF 
+  71      C5CBE3FF 
+  71      C6CBE3
+  72 01e3 FFC6CBE3 		.ascii	"\377\306\313\343\377\307\314\343\377\310\314\344\377\311\315"
+  72      FFC7CCE3 
+  72      FFC8CCE4 
+  72      FFC9CD
+  73 01f2 E4FFCACD 		.ascii	"\344\377\312\315\344\377\312\315\344\377\313\316\344\377\314"
+  73      E4FFCACD 
+  73      E4FFCBCE 
+  73      E4FFCC
+  74 0201 CEE4FFCC 		.ascii	"\316\344\377\314\317\345\377\315\317\345\377\316\317\345\377"
+  74      CFE5FFCD 
+  74      CFE5FFCE 
+  74      CFE5FF
+  75 0210 CED0E5FF 		.ascii	"\316\320\345\377\317\320\345\377\320\321\346\377\320\321\346"
+  75      CFD0E5FF 
+  75      D0D1E6FF 
+  75      D0D1E6
+  76 021f FFD1D1E6 		.ascii	"\377\321\321\346\377\321\321\346\377\322\322\346\377\322\322"
+  76      FFD1D1E6 
+  76      FFD2D2E6 
+  76      FFD2D2
+  77 022e E6FFD3D2 		.ascii	"\346\377\323\322\347\377\323\323\347\377\324\323\347\377\324"
+  77      E7FFD3D3 
+  77      E7FFD4D3 
+GAS LISTING /tmp/ccMVh1cW.s 			page 4
+
+
+  77      E7FFD4
+  78 023d D3E7FFD5 		.ascii	"\323\347\377\325\323\347\377\325\324\350\377\326\324\350\377"
+  78      D3E7FFD5 
+  78      D4E8FFD6 
+  78      D4E8FF
+  79 024c D6D4E8FF 		.ascii	"\326\324\350\377\327\324\350\377\327\325\350\377\330\325\350"
+  79      D7D4E8FF 
+  79      D7D5E8FF 
+  79      D8D5E8
+  80 025b FFD8D5E8 		.ascii	"\377\330\325\350\377\331\325\351\377\331\326\351\377\331\326"
+  80      FFD9D5E9 
+  80      FFD9D6E9 
+  80      FFD9D6
+  81 026a E9FFDAD6 		.ascii	"\351\377\332\326\351\377\332\326\351\377\333\327\351\377\333"
+  81      E9FFDAD6 
+  81      E9FFDBD7 
+  81      E9FFDB
+  82 0279 D7E9FFE1 		.ascii	"\327\351\377\341\332\354\377\341\333\354\377\342\333\354\377"
+  82      DAECFFE1 
+  82      DBECFFE2 
+  82      DBECFF
+  83 0288 E2DBECFF 		.ascii	"\342\333\354\377\343\333\354\377\343\334\354\377\343\334\354"
+  83      E3DBECFF 
+  83      E3DCECFF 
+  83      E3DCEC
+  84 0297 FFE4DCED 		.ascii	"\377\344\334\355\377\344\334\355\377\344\335\355\377\345\335"
+  84      FFE4DCED 
+  84      FFE4DDED 
+  84      FFE5DD
+  85 02a6 EDFFE5DD 		.ascii	"\355\377\345\335\355\377\345\335\355\377\346\335\355\377\346"
+  85      EDFFE5DD 
+  85      EDFFE6DD 
+  85      EDFFE6
+  86 02b5 DEEDFFE6 		.ascii	"\336\355\377\346\336\355\377\347\336\356\377\347\336\356\377"
+  86      DEEDFFE7 
+  86      DEEEFFE7 
+  86      DEEEFF
+  87 02c4 E7DEEEFF 		.ascii	"\347\336\356\377\347\337\356\377\350\337\356\377\350\337\356"
+  87      E7DFEEFF 
+  87      E8DFEEFF 
+  87      E8DFEE
+  88 02d3 FFE8DFEE 		.ascii	"\377\350\337\356\377\351\337\356\377\351\340\356\377\351\340"
+  88      FFE9DFEE 
+  88      FFE9E0EE 
+  88      FFE9E0
+  89 02e2 EFFFE9E0 		.ascii	"\357\377\351\340\357\377\352\340\357\377\352\340\357\377\352"
+  89      EFFFEAE0 
+  89      EFFFEAE0 
+  89      EFFFEA
+  90 02f1 E1EFFFEA 		.ascii	"\341\357\377\352\341\357\377\353\341\357\377\353\341\357\377"
+  90      E1EFFFEB 
+  90      E1EFFFEB 
+  90      E1EFFF
+  91 0300 EBE1EFFF 		.ascii	"\353\341\357\377\353\341\357\377\354\342\360\377\354\342\360"
+  91      EBE1EFFF 
+  91      ECE2F0FF 
+  91      ECE2F0
+GAS LISTING /tmp/ccMVh1cW.s 			page 5
+
+
+  92 030f FFECE2F0 		.ascii	"\377\354\342\360\377\354\342\360\377\355\342\360\377\355\343"
+  92      FFECE2F0 
+  92      FFEDE2F0 
+  92      FFEDE3
+  93 031e F0FFEDE3 		.ascii	"\360\377\355\343\360\377\355\343\360\377\355\343\360\377\356"
+  93      F0FFEDE3 
+  93      F0FFEDE3 
+  93      F0FFEE
+  94 032d E3F0FFEE 		.ascii	"\343\360\377\356\343\360\377\356\344\360\377\356\344\360\377"
+  94      E3F0FFEE 
+  94      E4F0FFEE 
+  94      E4F0FF
+  95 033c EEE4F1FF 		.ascii	"\356\344\361\377\357\344\361\377\357\344\361\377\357\344\361"
+  95      EFE4F1FF 
+  95      EFE4F1FF 
+  95      EFE4F1
+  96 034b FFEFE5F1 		.ascii	"\377\357\345\361\377\357\345\361\377\357\345\361\377\360\345"
+  96      FFEFE5F1 
+  96      FFEFE5F1 
+  96      FFF0E5
+  97 035a F1FFF0E5 		.ascii	"\361\377\360\345\361\377\360\345\361\377\360\346\361\377\360"
+  97      F1FFF0E5 
+  97      F1FFF0E6 
+  97      F1FFF0
+  98 0369 E6F1FFF0 		.ascii	"\346\361\377\360\346\361\377\361\346\362\377\361\346\362\377"
+  98      E6F1FFF1 
+  98      E6F2FFF1 
+  98      E6F2FF
+  99 0378 F1E6F2FF 		.ascii	"\361\346\362\377\361\346\362\377\361\347\362\377\361\347\362"
+  99      F1E6F2FF 
+  99      F1E7F2FF 
+  99      F1E7F2
+ 100 0387 FFF1E7F2 		.ascii	"\377\361\347\362\377\362\347\362\377\362\347\362\377\362\347"
+ 100      FFF2E7F2 
+ 100      FFF2E7F2 
+ 100      FFF2E7
+ 101 0396 F2FFF2E7 		.ascii	"\362\377\362\347\362\377\362\347\362\377\362\350\362\377\362"
+ 101      F2FFF2E7 
+ 101      F2FFF2E8 
+ 101      F2FFF2
+ 102 03a5 E8F2FFF2 		.ascii	"\350\362\377\362\350\362\377\363\350\362\377\363\350\363\377"
+ 102      E8F2FFF3 
+ 102      E8F2FFF3 
+ 102      E8F3FF
+ 103 03b4 F3E8F3FF 		.ascii	"\363\350\363\377\363\350\363\377\363\350\363\377\363\351\363"
+ 103      F3E8F3FF 
+ 103      F3E8F3FF 
+ 103      F3E9F3
+ 104 03c3 FFF3E9F3 		.ascii	"\377\363\351\363\377\363\351\363\377\363\351\363\377\364\351"
+ 104      FFF3E9F3 
+ 104      FFF3E9F3 
+ 104      FFF4E9
+ 105 03d2 F3FFF4E9 		.ascii	"\363\377\364\351\363\377\364\351\363\377\364\351\363\377\364"
+ 105      F3FFF4E9 
+ 105      F3FFF4E9 
+ 105      F3FFF4
+ 106 03e1 EAF3FFF8 		.ascii	"\352\363\377\370\356\366\377\370\356\366\377\370\356\366\377"
+GAS LISTING /tmp/ccMVh1cW.s 			page 6
+
+
+ 106      EEF6FFF8 
+ 106      EEF6FFF8 
+ 106      EEF6FF
+ 107 03f0 F8EEF6FF 		.ascii	"\370\356\366\377\370\356\366\377\370\356\366\377\370\356\366"
+ 107      F8EEF6FF 
+ 107      F8EEF6FF 
+ 107      F8EEF6
+ 108 03ff FFF8EFF6 		.ascii	"\377\370\357\366\377\371\357\366\377\371\357\366\377\371\357"
+ 108      FFF9EFF6 
+ 108      FFF9EFF6 
+ 108      FFF9EF
+ 109 040e F6FFF9EF 		.ascii	"\366\377\371\357\366\377\371\357\366\377\371\357\366\377\371"
+ 109      F6FFF9EF 
+ 109      F6FFF9EF 
+ 109      F6FFF9
+ 110 041d EFF6FFF9 		.ascii	"\357\366\377\371\357\366\377\371\357\366\377\371\360\366\377"
+ 110      EFF6FFF9 
+ 110      EFF6FFF9 
+ 110      F0F6FF
+ 111 042c F9F0F6FF 		.ascii	"\371\360\366\377\371\360\366\377\372\360\367\377\372\360\367"
+ 111      F9F0F6FF 
+ 111      FAF0F7FF 
+ 111      FAF0F7
+ 112 043b FFFAF0F7 		.ascii	"\377\372\360\367\377\372\360\367\377\372\360\367\377\372\360"
+ 112      FFFAF0F7 
+ 112      FFFAF0F7 
+ 112      FFFAF0
+ 113 044a F7FFFAF0 		.ascii	"\367\377\372\360\367\377\372\360\367\377\372\360\367\377\372"
+ 113      F7FFFAF0 
+ 113      F7FFFAF0 
+ 113      F7FFFA
+ 114 0459 F1F7FFFA 		.ascii	"\361\367\377\372\361\367\377\372\361\367\377\372\361\367\377"
+ 114      F1F7FFFA 
+ 114      F1F7FFFA 
+ 114      F1F7FF
+ 115 0468 FAF1F7FF 		.ascii	"\372\361\367\377\372\361\367\377\373\361\367\377\373\361\367"
+ 115      FAF1F7FF 
+ 115      FBF1F7FF 
+ 115      FBF1F7
+ 116 0477 FFFBF1F7 		.ascii	"\377\373\361\367\377\373\361\367\377\373\361\367\377\373\361"
+ 116      FFFBF1F7 
+ 116      FFFBF1F7 
+ 116      FFFBF1
+ 117 0486 F7FFFBF1 		.ascii	"\367\377\373\361\367\377\373\361\367\377\373\362\370\377\373"
+ 117      F7FFFBF1 
+ 117      F7FFFBF2 
+ 117      F8FFFB
+ 118 0495 F2F8FFFB 		.ascii	"\362\370\377\373\362\370\377\373\362\370\377\373\362\370\377"
+ 118      F2F8FFFB 
+ 118      F2F8FFFB 
+ 118      F2F8FF
+ 119 04a4 FBF2F8FF 		.ascii	"\373\362\370\377\373\362\370\377\373\362\370\377\373\362\370"
+ 119      FBF2F8FF 
+ 119      FBF2F8FF 
+ 119      FBF2F8
+ 120 04b3 FFFBF2F8 		.ascii	"\377\373\362\370\377\373\362\370\377\373\362\370\377\374\362"
+ 120      FFFBF2F8 
+GAS LISTING /tmp/ccMVh1cW.s 			page 7
+
+
+ 120      FFFBF2F8 
+ 120      FFFCF2
+ 121 04c2 F8FFFCF2 		.ascii	"\370\377\374\362\370\377\374\362\370\377\374\362\370\377\374"
+ 121      F8FFFCF2 
+ 121      F8FFFCF2 
+ 121      F8FFFC
+ 122 04d1 F3F8FFFC 		.ascii	"\363\370\377\374\363\370\377\374\363\370\377\374\363\370\377"
+ 122      F3F8FFFC 
+ 122      F3F8FFFC 
+ 122      F3F8FF
+ 123 04e0 FCF3F8FF 		.ascii	"\374\363\370\377\374\363\370\377\374\363\370\377\374\363\370"
+ 123      FCF3F8FF 
+ 123      FCF3F8FF 
+ 123      FCF3F8
+ 124 04ef FFFCF3F8 		.ascii	"\377\374\363\370\377\374\363\370\377\374\363\370\377\374\363"
+ 124      FFFCF3F8 
+ 124      FFFCF3F8 
+ 124      FFFCF3
+ 125 04fe F8FFFCF3 		.ascii	"\370\377\374\363\370\377\374\363\370\377\374\363\370\377\374"
+ 125      F8FFFCF3 
+ 125      F8FFFCF3 
+ 125      F8FFFC
+ 126 050d F3F9FFFC 		.ascii	"\363\371\377\374\363\371\377\374\363\371\377\374\363\371\377"
+ 126      F3F9FFFC 
+ 126      F3F9FFFC 
+ 126      F3F9FF
+ 127 051c FCF3F9FF 		.ascii	"\374\363\371\377\374\363\371\377\374\364\371\377\374\364\371"
+ 127      FCF3F9FF 
+ 127      FCF4F9FF 
+ 127      FCF4F9
+ 128 052b FFFDF4F9 		.ascii	"\377\375\364\371\377\375\364\371\377\375\364\371\377\375\364"
+ 128      FFFDF4F9 
+ 128      FFFDF4F9 
+ 128      FFFDF4
+ 129 053a F9FFFDF4 		.ascii	"\371\377\375\364\371\377\375\364\371\377\375\364\371\377\375"
+ 129      F9FFFDF4 
+ 129      F9FFFDF4 
+ 129      F9FFFD
+ 130 0549 F4F9FFFD 		.ascii	"\364\371\377\375\364\371\377\375\364\371\377\375\364\371\377"
+ 130      F4F9FFFD 
+ 130      F4F9FFFD 
+ 130      F4F9FF
+ 131 0558 FDF4F9FF 		.ascii	"\375\364\371\377\375\364\371\377\375\364\371\377\375\364\371"
+ 131      FDF4F9FF 
+ 131      FDF4F9FF 
+ 131      FDF4F9
+ 132 0567 FFFDF4F9 		.ascii	"\377\375\364\371\377\375\364\371\377\375\364\371\377\375\364"
+ 132      FFFDF4F9 
+ 132      FFFDF4F9 
+ 132      FFFDF4
+ 133 0576 F9FFFDF4 		.ascii	"\371\377\375\364\371\377\375\364\371\377\375\364\371\377\375"
+ 133      F9FFFDF4 
+ 133      F9FFFDF4 
+ 133      F9FFFD
+ 134 0585 F4F9FFFD 		.ascii	"\364\371\377\375\364\371\377\375\364\371\377\375\364\371\377"
+ 134      F4F9FFFD 
+ 134      F4F9FFFD 
+GAS LISTING /tmp/ccMVh1cW.s 			page 8
+
+
+ 134      F4F9FF
+ 135 0594 FDF5F9FF 		.ascii	"\375\365\371\377\375\365\371\377\375\365\371\377\375\365\371"
+ 135      FDF5F9FF 
+ 135      FDF5F9FF 
+ 135      FDF5F9
+ 136 05a3 FFFDF5F9 		.ascii	"\377\375\365\371\377\375\365\371\377\375\365\371\377\375\365"
+ 136      FFFDF5F9 
+ 136      FFFDF5F9 
+ 136      FFFDF5
+ 137 05b2 F9FFFDF5 		.ascii	"\371\377\375\365\371\377\375\365\371\377\375\365\371\377\375"
+ 137      F9FFFDF5 
+ 137      F9FFFDF5 
+ 137      F9FFFD
+ 138 05c1 F5F9FFFD 		.ascii	"\365\371\377\375\365\371\377\375\365\371\377\375\365\371\377"
+ 138      F5F9FFFD 
+ 138      F5F9FFFD 
+ 138      F5F9FF
+ 139 05d0 FDF5FAFF 		.ascii	"\375\365\372\377\375\365\372\377\375\365\372\377\375\365\372"
+ 139      FDF5FAFF 
+ 139      FDF5FAFF 
+ 139      FDF5FA
+ 140 05df FFFEF5FA 		.ascii	"\377\376\365\372\377\376\365\372\377\376\365\372\377\376\365"
+ 140      FFFEF5FA 
+ 140      FFFEF5FA 
+ 140      FFFEF5
+ 141 05ee FAFFFEF5 		.ascii	"\372\377\376\365\372\377\376\365\372\377\376\365\372\377\376"
+ 141      FAFFFEF5 
+ 141      FAFFFEF5 
+ 141      FAFFFE
+ 142 05fd F5FAFFFE 		.ascii	"\365\372\377\376\365\372\377\376\365\372\377\376\365\372\377"
+ 142      F5FAFFFE 
+ 142      F5FAFFFE 
+ 142      F5FAFF
+ 143 060c FEF5FAFF 		.ascii	"\376\365\372\377\376\365\372\377\376\365\372\377\376\365\372"
+ 143      FEF5FAFF 
+ 143      FEF5FAFF 
+ 143      FEF5FA
+ 144 061b FFFEF5FA 		.ascii	"\377\376\365\372\377\376\365\372\377\376\365\372\377\376\365"
+ 144      FFFEF5FA 
+ 144      FFFEF5FA 
+ 144      FFFEF5
+ 145 062a FAFFFEF5 		.ascii	"\372\377\376\365\372\377\376\365\372\377\376\365\372\377\376"
+ 145      FAFFFEF5 
+ 145      FAFFFEF5 
+ 145      FAFFFE
+ 146 0639 F5FAFFFE 		.ascii	"\365\372\377\376\365\372\377\376\365\372\377\376\365\372\377"
+ 146      F5FAFFFE 
+ 146      F5FAFFFE 
+ 146      F5FAFF
+ 147 0648 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 147      FEF6FAFF 
+ 147      FEF6FAFF 
+ 147      FEF6FA
+ 148 0657 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 148      FFFEF6FA 
+ 148      FFFEF6FA 
+ 148      FFFEF6
+GAS LISTING /tmp/ccMVh1cW.s 			page 9
+
+
+ 149 0666 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 149      FAFFFEF6 
+ 149      FAFFFEF6 
+ 149      FAFFFE
+ 150 0675 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 150      F6FAFFFE 
+ 150      F6FAFFFE 
+ 150      F6FAFF
+ 151 0684 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 151      FEF6FAFF 
+ 151      FEF6FAFF 
+ 151      FEF6FA
+ 152 0693 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 152      FFFEF6FA 
+ 152      FFFEF6FA 
+ 152      FFFEF6
+ 153 06a2 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 153      FAFFFEF6 
+ 153      FAFFFEF6 
+ 153      FAFFFE
+ 154 06b1 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 154      F6FAFFFE 
+ 154      F6FAFFFE 
+ 154      F6FAFF
+ 155 06c0 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 155      FEF6FAFF 
+ 155      FEF6FAFF 
+ 155      FEF6FA
+ 156 06cf FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 156      FFFEF6FA 
+ 156      FFFEF6FA 
+ 156      FFFEF6
+ 157 06de FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 157      FAFFFEF6 
+ 157      FAFFFEF6 
+ 157      FAFFFE
+ 158 06ed F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 158      F6FAFFFE 
+ 158      F6FAFFFE 
+ 158      F6FAFF
+ 159 06fc FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 159      FEF6FAFF 
+ 159      FEF6FAFF 
+ 159      FEF6FA
+ 160 070b FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 160      FFFEF6FA 
+ 160      FFFEF6FA 
+ 160      FFFEF6
+ 161 071a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 161      FAFFFEF6 
+ 161      FAFFFEF6 
+ 161      FAFFFE
+ 162 0729 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 162      F6FAFFFE 
+ 162      F6FAFFFE 
+ 162      F6FAFF
+ 163 0738 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+GAS LISTING /tmp/ccMVh1cW.s 			page 10
+
+
+ 163      FEF6FAFF 
+ 163      FEF6FAFF 
+ 163      FEF6FA
+ 164 0747 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 164      FFFEF6FA 
+ 164      FFFEF6FA 
+ 164      FFFEF6
+ 165 0756 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 165      FAFFFEF6 
+ 165      FAFFFEF6 
+ 165      FAFFFE
+ 166 0765 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 166      F6FAFFFE 
+ 166      F6FAFFFE 
+ 166      F6FAFF
+ 167 0774 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 167      FEF6FAFF 
+ 167      FEF6FAFF 
+ 167      FEF6FA
+ 168 0783 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 168      FFFEF6FA 
+ 168      FFFEF6FA 
+ 168      FFFEF6
+ 169 0792 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 169      FAFFFEF6 
+ 169      FAFFFEF6 
+ 169      FAFFFE
+ 170 07a1 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 170      F6FAFFFE 
+ 170      F6FAFFFE 
+ 170      F6FAFF
+ 171 07b0 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 171      FEF6FAFF 
+ 171      FEF6FAFF 
+ 171      FEF6FA
+ 172 07bf FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 172      FFFEF6FA 
+ 172      FFFEF6FA 
+ 172      FFFEF6
+ 173 07ce FAFF     		.ascii	"\372\377"
+ 174 07d0 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 174      FEF6FAFF 
+ 174      FEF6FAFF 
+ 174      FEF6FA
+ 175 07df FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 175      FFFEF6FA 
+ 175      FFFEF6FA 
+ 175      FFFEF6
+ 176 07ee FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 176      FAFFFEF6 
+ 176      FAFFFEF6 
+ 176      FAFFFE
+ 177 07fd F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 177      F6FAFFFE 
+ 177      F6FAFFFE 
+ 177      F6FAFF
+ 178 080c FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+GAS LISTING /tmp/ccMVh1cW.s 			page 11
+
+
+ 178      FEF6FAFF 
+ 178      FEF6FAFF 
+ 178      FEF6FA
+ 179 081b FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 179      FFFEF6FA 
+ 179      FFFEF6FA 
+ 179      FFFEF6
+ 180 082a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 180      FAFFFEF6 
+ 180      FAFFFEF6 
+ 180      FAFFFE
+ 181 0839 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 181      F6FAFFFE 
+ 181      F6FAFFFE 
+ 181      F6FAFF
+ 182 0848 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 182      FEF6FAFF 
+ 182      FEF6FAFF 
+ 182      FEF6FA
+ 183 0857 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 183      FFFEF6FA 
+ 183      FFFEF6FA 
+ 183      FFFEF6
+ 184 0866 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 184      FAFFFEF6 
+ 184      FAFFFEF6 
+ 184      FAFFFE
+ 185 0875 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 185      F6FAFFFE 
+ 185      F6FAFFFE 
+ 185      F6FAFF
+ 186 0884 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 186      FEF6FAFF 
+ 186      FEF6FAFF 
+ 186      FEF6FA
+ 187 0893 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 187      FFFEF6FA 
+ 187      FFFEF6FA 
+ 187      FFFEF6
+ 188 08a2 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 188      FAFFFEF6 
+ 188      FAFFFEF6 
+ 188      FAFFFE
+ 189 08b1 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 189      F6FAFFFE 
+ 189      F6FAFFFE 
+ 189      F6FAFF
+ 190 08c0 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 190      FEF6FAFF 
+ 190      FEF6FAFF 
+ 190      FEF6FA
+ 191 08cf FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 191      FFFEF6FA 
+ 191      FFFEF6FA 
+ 191      FFFEF6
+ 192 08de FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 192      FAFFFEF6 
+GAS LISTING /tmp/ccMVh1cW.s 			page 12
+
+
+ 192      FAFFFEF6 
+ 192      FAFFFE
+ 193 08ed F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 193      F6FAFFFE 
+ 193      F6FAFFFE 
+ 193      F6FAFF
+ 194 08fc FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 194      FEF6FAFF 
+ 194      FEF6FAFF 
+ 194      FEF6FA
+ 195 090b FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 195      FFFEF6FA 
+ 195      FFFEF6FA 
+ 195      FFFEF6
+ 196 091a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 196      FAFFFEF6 
+ 196      FAFFFEF6 
+ 196      FAFFFE
+ 197 0929 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 197      F6FAFFFE 
+ 197      F6FAFFFE 
+ 197      F6FAFF
+ 198 0938 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 198      FEF6FAFF 
+ 198      FEF6FAFF 
+ 198      FEF6FA
+ 199 0947 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 199      FFFEF6FA 
+ 199      FFFEF6FA 
+ 199      FFFEF6
+ 200 0956 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 200      FAFFFEF6 
+ 200      FAFFFEF6 
+ 200      FAFFFE
+ 201 0965 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 201      F6FAFFFE 
+ 201      F6FAFFFE 
+ 201      F6FAFF
+ 202 0974 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 202      FEF6FAFF 
+ 202      FEF6FAFF 
+ 202      FEF6FA
+ 203 0983 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 203      FFFEF6FA 
+ 203      FFFEF6FA 
+ 203      FFFEF6
+ 204 0992 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 204      FAFFFEF6 
+ 204      FAFFFEF6 
+ 204      FAFFFE
+ 205 09a1 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 205      F6FAFFFE 
+ 205      F6FAFFFE 
+ 205      F6FAFF
+ 206 09b0 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 206      FEF6FAFF 
+ 206      FEF6FAFF 
+GAS LISTING /tmp/ccMVh1cW.s 			page 13
+
+
+ 206      FEF6FA
+ 207 09bf FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 207      FFFEF6FA 
+ 207      FFFEF6FA 
+ 207      FFFEF6
+ 208 09ce FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 208      FAFFFEF6 
+ 208      FAFFFEF6 
+ 208      FAFFFE
+ 209 09dd F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 209      F6FAFFFE 
+ 209      F6FAFFFE 
+ 209      F6FAFF
+ 210 09ec FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 210      FEF6FAFF 
+ 210      FEF6FAFF 
+ 210      FEF6FA
+ 211 09fb FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 211      FFFEF6FA 
+ 211      FFFEF6FA 
+ 211      FFFEF6
+ 212 0a0a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 212      FAFFFEF6 
+ 212      FAFFFEF6 
+ 212      FAFFFE
+ 213 0a19 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 213      F6FAFFFE 
+ 213      F6FAFFFE 
+ 213      F6FAFF
+ 214 0a28 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 214      FEF6FAFF 
+ 214      FEF6FAFF 
+ 214      FEF6FA
+ 215 0a37 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 215      FFFEF6FA 
+ 215      FFFEF6FA 
+ 215      FFFEF6
+ 216 0a46 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 216      FAFFFEF6 
+ 216      FAFFFEF6 
+ 216      FAFFFE
+ 217 0a55 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 217      F6FAFFFE 
+ 217      F6FAFFFE 
+ 217      F6FAFF
+ 218 0a64 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 218      FEF6FAFF 
+ 218      FEF6FAFF 
+ 218      FEF6FA
+ 219 0a73 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 219      FFFEF6FA 
+ 219      FFFEF6FA 
+ 219      FFFEF6
+ 220 0a82 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 220      FAFFFEF6 
+ 220      FAFFFEF6 
+ 220      FAFFFE
+GAS LISTING /tmp/ccMVh1cW.s 			page 14
+
+
+ 221 0a91 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 221      F6FAFFFE 
+ 221      F6FAFFFE 
+ 221      F6FAFF
+ 222 0aa0 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 222      FEF6FAFF 
+ 222      FEF6FAFF 
+ 222      FEF6FA
+ 223 0aaf FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 223      FFFEF6FA 
+ 223      FFFEF6FA 
+ 223      FFFEF6
+ 224 0abe FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 224      FAFFFEF6 
+ 224      FAFFFEF6 
+ 224      FAFFFE
+ 225 0acd F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 225      F6FAFFFE 
+ 225      F6FAFFFE 
+ 225      F6FAFF
+ 226 0adc FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 226      FEF6FAFF 
+ 226      FEF6FAFF 
+ 226      FEF6FA
+ 227 0aeb FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 227      FFFEF6FA 
+ 227      FFFEF6FA 
+ 227      FFFEF6
+ 228 0afa FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 228      FAFFFEF6 
+ 228      FAFFFEF6 
+ 228      FAFFFE
+ 229 0b09 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 229      F6FAFFFE 
+ 229      F6FAFFFE 
+ 229      F6FAFF
+ 230 0b18 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 230      FEF6FAFF 
+ 230      FEF6FAFF 
+ 230      FEF6FA
+ 231 0b27 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 231      FFFEF6FA 
+ 231      FFFEF6FA 
+ 231      FFFEF6
+ 232 0b36 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 232      FAFFFEF6 
+ 232      FAFFFEF6 
+ 232      FAFFFE
+ 233 0b45 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 233      F6FAFFFE 
+ 233      F6FAFFFE 
+ 233      F6FAFF
+ 234 0b54 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 234      FEF6FAFF 
+ 234      FEF6FAFF 
+ 234      FEF6FA
+ 235 0b63 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+GAS LISTING /tmp/ccMVh1cW.s 			page 15
+
+
+ 235      FFFEF6FA 
+ 235      FFFEF6FA 
+ 235      FFFEF6
+ 236 0b72 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 236      FAFFFEF6 
+ 236      FAFFFEF6 
+ 236      FAFFFE
+ 237 0b81 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 237      F6FAFFFE 
+ 237      F6FAFFFE 
+ 237      F6FAFF
+ 238 0b90 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 238      FEF6FAFF 
+ 238      FEF6FAFF 
+ 238      FEF6FA
+ 239 0b9f FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 239      FFFEF6FA 
+ 239      FFFEF6FA 
+ 239      FFFEF6
+ 240 0bae FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 240      FAFFFEF6 
+ 240      FAFFFEF6 
+ 240      FAFFFE
+ 241 0bbd F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 241      F6FAFFFE 
+ 241      F6FAFFFE 
+ 241      F6FAFF
+ 242 0bcc FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 242      FEF6FAFF 
+ 242      FEF6FAFF 
+ 242      FEF6FA
+ 243 0bdb FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 243      FFFEF6FA 
+ 243      FFFEF6FA 
+ 243      FFFEF6
+ 244 0bea FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 244      FAFFFEF6 
+ 244      FAFFFEF6 
+ 244      FAFFFE
+ 245 0bf9 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 245      F6FAFFFE 
+ 245      F6FAFFFE 
+ 245      F6FAFF
+ 246 0c08 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 246      FEF6FAFF 
+ 246      FEF6FAFF 
+ 246      FEF6FA
+ 247 0c17 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 247      FFFEF6FA 
+ 247      FFFEF6FA 
+ 247      FFFEF6
+ 248 0c26 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 248      FAFFFEF6 
+ 248      FAFFFEF6 
+ 248      FAFFFE
+ 249 0c35 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 249      F6FAFFFE 
+GAS LISTING /tmp/ccMVh1cW.s 			page 16
+
+
+ 249      F6FAFFFE 
+ 249      F6FAFF
+ 250 0c44 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 250      FEF6FAFF 
+ 250      FEF6FAFF 
+ 250      FEF6FA
+ 251 0c53 FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 251      FFFEF6FA 
+ 251      FFFEF6FA 
+ 251      FFFEF6
+ 252 0c62 FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 252      FAFFFEF6 
+ 252      FAFFFEF6 
+ 252      FAFFFE
+ 253 0c71 F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 253      F6FAFFFE 
+ 253      F6FAFFFE 
+ 253      F6FAFF
+ 254 0c80 FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 254      FEF6FAFF 
+ 254      FEF6FAFF 
+ 254      FEF6FA
+ 255 0c8f FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 255      FFFEF6FA 
+ 255      FFFEF6FA 
+ 255      FFFEF6
+ 256 0c9e FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377\376\366\372\377\376"
+ 256      FAFFFEF6 
+ 256      FAFFFEF6 
+ 256      FAFFFE
+ 257 0cad F6FAFFFE 		.ascii	"\366\372\377\376\366\372\377\376\366\372\377\376\366\372\377"
+ 257      F6FAFFFE 
+ 257      F6FAFFFE 
+ 257      F6FAFF
+ 258 0cbc FEF6FAFF 		.ascii	"\376\366\372\377\376\366\372\377\376\366\372\377\376\366\372"
+ 258      FEF6FAFF 
+ 258      FEF6FAFF 
+ 258      FEF6FA
+ 259 0ccb FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\367\372\377\376\367"
+ 259      FFFEF6FA 
+ 259      FFFEF7FA 
+ 259      FFFEF7
+ 260 0cda FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 260      FAFFFEF7 
+ 260      FAFFFEF7 
+ 260      FAFFFE
+ 261 0ce9 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 261      F7FAFFFE 
+ 261      F7FAFFFE 
+ 261      F7FAFF
+ 262 0cf8 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 262      FEF7FAFF 
+ 262      FEF7FAFF 
+ 262      FEF7FA
+ 263 0d07 FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 263      FFFEF7FA 
+ 263      FFFEF7FA 
+GAS LISTING /tmp/ccMVh1cW.s 			page 17
+
+
+ 263      FFFEF7
+ 264 0d16 FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 264      FAFFFEF7 
+ 264      FAFFFEF7 
+ 264      FAFFFE
+ 265 0d25 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 265      F7FAFFFE 
+ 265      F7FAFFFE 
+ 265      F7FAFF
+ 266 0d34 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 266      FEF7FAFF 
+ 266      FEF7FAFF 
+ 266      FEF7FA
+ 267 0d43 FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 267      FFFEF7FA 
+ 267      FFFEF7FA 
+ 267      FFFEF7
+ 268 0d52 FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 268      FAFFFEF7 
+ 268      FAFFFEF7 
+ 268      FAFFFE
+ 269 0d61 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 269      F7FAFFFE 
+ 269      F7FAFFFE 
+ 269      F7FAFF
+ 270 0d70 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 270      FEF7FAFF 
+ 270      FEF7FAFF 
+ 270      FEF7FA
+ 271 0d7f FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 271      FFFEF7FA 
+ 271      FFFEF7FA 
+ 271      FFFEF7
+ 272 0d8e FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 272      FAFFFEF7 
+ 272      FAFFFEF7 
+ 272      FAFFFE
+ 273 0d9d F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 273      F7FAFFFE 
+ 273      F7FAFFFE 
+ 273      F7FAFF
+ 274 0dac FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 274      FEF7FAFF 
+ 274      FEF7FAFF 
+ 274      FEF7FA
+ 275 0dbb FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 275      FFFEF7FA 
+ 275      FFFEF7FA 
+ 275      FFFEF7
+ 276 0dca FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 276      FAFFFEF7 
+ 276      FAFFFEF7 
+ 276      FAFFFE
+ 277 0dd9 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 277      F7FAFFFE 
+ 277      F7FAFFFE 
+ 277      F7FAFF
+GAS LISTING /tmp/ccMVh1cW.s 			page 18
+
+
+ 278 0de8 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 278      FEF7FAFF 
+ 278      FEF7FAFF 
+ 278      FEF7FA
+ 279 0df7 FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 279      FFFEF7FA 
+ 279      FFFEF7FA 
+ 279      FFFEF7
+ 280 0e06 FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 280      FAFFFEF7 
+ 280      FAFFFEF7 
+ 280      FAFFFE
+ 281 0e15 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 281      F7FAFFFE 
+ 281      F7FAFFFE 
+ 281      F7FAFF
+ 282 0e24 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 282      FEF7FAFF 
+ 282      FEF7FAFF 
+ 282      FEF7FA
+ 283 0e33 FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 283      FFFEF7FA 
+ 283      FFFEF7FA 
+ 283      FFFEF7
+ 284 0e42 FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 284      FAFFFEF7 
+ 284      FAFFFEF7 
+ 284      FAFFFE
+ 285 0e51 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 285      F7FAFFFE 
+ 285      F7FAFFFE 
+ 285      F7FAFF
+ 286 0e60 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 286      FEF7FAFF 
+ 286      FEF7FAFF 
+ 286      FEF7FA
+ 287 0e6f FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 287      FFFEF7FA 
+ 287      FFFEF7FA 
+ 287      FFFEF7
+ 288 0e7e FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 288      FAFFFEF7 
+ 288      FAFFFEF7 
+ 288      FAFFFE
+ 289 0e8d F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 289      F7FAFFFE 
+ 289      F7FAFFFE 
+ 289      F7FAFF
+ 290 0e9c FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 290      FEF7FAFF 
+ 290      FEF7FAFF 
+ 290      FEF7FA
+ 291 0eab FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 291      FFFEF7FA 
+ 291      FFFEF7FA 
+ 291      FFFEF7
+ 292 0eba FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+GAS LISTING /tmp/ccMVh1cW.s 			page 19
+
+
+ 292      FAFFFEF7 
+ 292      FAFFFEF7 
+ 292      FAFFFE
+ 293 0ec9 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 293      F7FAFFFE 
+ 293      F7FAFFFE 
+ 293      F7FAFF
+ 294 0ed8 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 294      FEF7FAFF 
+ 294      FEF7FAFF 
+ 294      FEF7FA
+ 295 0ee7 FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 295      FFFEF7FA 
+ 295      FFFEF7FA 
+ 295      FFFEF7
+ 296 0ef6 FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 296      FAFFFEF7 
+ 296      FAFFFEF7 
+ 296      FAFFFE
+ 297 0f05 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 297      F7FAFFFE 
+ 297      F7FAFFFE 
+ 297      F7FAFF
+ 298 0f14 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 298      FEF7FAFF 
+ 298      FEF7FAFF 
+ 298      FEF7FA
+ 299 0f23 FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 299      FFFEF7FA 
+ 299      FFFEF7FA 
+ 299      FFFEF7
+ 300 0f32 FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 300      FAFFFEF7 
+ 300      FAFFFEF7 
+ 300      FAFFFE
+ 301 0f41 F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 301      F7FAFFFE 
+ 301      F7FAFFFE 
+ 301      F7FAFF
+ 302 0f50 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 302      FEF7FAFF 
+ 302      FEF7FAFF 
+ 302      FEF7FA
+ 303 0f5f FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 303      FFFEF7FA 
+ 303      FFFEF7FA 
+ 303      FFFEF7
+ 304 0f6e FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 304      FAFFFEF7 
+ 304      FAFFFEF7 
+ 304      FAFFFE
+ 305 0f7d F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 305      F7FAFFFE 
+ 305      F7FAFFFE 
+ 305      F7FAFF
+ 306 0f8c FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 306      FEF7FAFF 
+GAS LISTING /tmp/ccMVh1cW.s 			page 20
+
+
+ 306      FEF7FAFF 
+ 306      FEF7FA
+ 307 0f9b FFFEF7FA 		.ascii	"\377\376\367\372\377"
+ 307      FF
+ 308 0fa0 FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 308      FEF7FAFF 
+ 308      FEF7FAFF 
+ 308      FEF7FA
+ 309 0faf FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 309      FFFEF7FA 
+ 309      FFFEF7FA 
+ 309      FFFEF7
+ 310 0fbe FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377\376\367\372\377\376"
+ 310      FAFFFEF7 
+ 310      FAFFFEF7 
+ 310      FAFFFE
+ 311 0fcd F7FAFFFE 		.ascii	"\367\372\377\376\367\372\377\376\367\372\377\376\367\372\377"
+ 311      F7FAFFFE 
+ 311      F7FAFFFE 
+ 311      F7FAFF
+ 312 0fdc FEF7FAFF 		.ascii	"\376\367\372\377\376\367\372\377\376\367\372\377\376\367\372"
+ 312      FEF7FAFF 
+ 312      FEF7FAFF 
+ 312      FEF7FA
+ 313 0feb FFFEF7FA 		.ascii	"\377\376\367\372\377\376\367\372\377\376\367\372\377\376\367"
+ 313      FFFEF7FA 
+ 313      FFFEF7FA 
+ 313      FFFEF7
+ 314 0ffa FAFFFEF7 		.ascii	"\372\377\376\367\372\377\376\367\372\377"
+ 314      FAFFFEF7 
+ 314      FAFF
+ 315              		.globl	heatmap_cs_PuBuGn_mixed
+ 316              		.section	.data.rel.local
+ 317              		.align 8
+ 318              		.type	heatmap_cs_PuBuGn_mixed, @object
+ 319              		.size	heatmap_cs_PuBuGn_mixed, 8
+ 320              	heatmap_cs_PuBuGn_mixed:
+ 321 0008 00000000 		.quad	mixed
+ 321      00000000 
+ 322              		.section	.data.rel.ro.local
+ 323              		.align 16
+ 324              		.type	mixed, @object
+ 325              		.size	mixed, 16
+ 326              	mixed:
+ 327 0010 00000000 		.quad	mixed_data
+ 327      00000000 
+ 328 0018 01040000 		.quad	1025
+ 328      00000000 
+ 329              		.section	.rodata
+ 330 1004 00000000 		.align 32
+ 330      00000000 
+ 330      00000000 
+ 330      00000000 
+ 330      00000000 
+ 331              		.type	mixed_data, @object
+ 332              		.size	mixed_data, 4100
+ 333              	mixed_data:
+GAS LISTING /tmp/ccMVh1cW.s 			page 21
+
+
+ 334 1020 00       		.string	""
+ 335 1021 00       		.string	""
+ 336 1022 00       		.string	""
+ 337 1023 00       		.string	""
+ 338 1024 01463500 		.string	"\001F5"
+ 339 1028 01463607 		.ascii	"\001F6\007\001F6\016\001F6\026\001F6\035\001G7%\001G7,\001G7"
+ 339      0146360E 
+ 339      01463616 
+ 339      0146361D 
+ 339      01473725 
+ 340 1043 34014737 		.ascii	"4\001G7;\001H7C\001H8J\001H8R\001H8Y\001H8a\001I8h\001I9p\001"
+ 340      3B014837 
+ 340      43014838 
+ 340      4A014838 
+ 340      52014838 
+ 341 1065 49397701 		.ascii	"I9w\001I9\177\001J9\206\001J9\215\001J:\225\001J:\234\001K:\244"
+ 341      49397F01 
+ 341      4A398601 
+ 341      4A398D01 
+ 341      4A3A9501 
+ 342 1080 014B3AAB 		.ascii	"\001K:\253\001K:\263\001K;\272\001K;\302\001L;\311\001L;\321"
+ 342      014B3AB3 
+ 342      014B3BBA 
+ 342      014B3BC2 
+ 342      014C3BC9 
+ 343 1098 014C3CD8 		.ascii	"\001L<\330\001L<\340\001M<\347\001M<\357\001M<\366\001M=\376"
+ 343      014C3CE0 
+ 343      014D3CE7 
+ 343      014D3CEF 
+ 343      014D3CF6 
+ 344 10b0 014E3DFF 		.ascii	"\001N=\377\001N=\377\001N=\377\001N=\377\001O>\377\001O>\377"
+ 344      014E3DFF 
+ 344      014E3DFF 
+ 344      014E3DFF 
+ 344      014F3EFF 
+ 345 10c8 014F3EFF 		.ascii	"\001O>\377\001O>\377\001O?\377\001P?\377\001P?\377\001P?\377"
+ 345      014F3EFF 
+ 345      014F3FFF 
+ 345      01503FFF 
+ 345      01503FFF 
+ 346 10e0 01503FFF 		.ascii	"\001P?\377\001Q@\377\001Q@\377\001Q@\377\001Q@\377\001R@\377"
+ 346      015140FF 
+ 346      015140FF 
+ 346      015140FF 
+ 346      015140FF 
+ 347 10f8 015241FF 		.ascii	"\001RA\377\001RA\377\001RA\377\001SA\377\001SB\377\001SB\377"
+ 347      015241FF 
+ 347      015241FF 
+ 347      015341FF 
+ 347      015342FF 
+ 348 1110 015342FF 		.ascii	"\001SB\377\001SB\377\001TB\377\001TC\377\001TC\377\001\\J\377"
+ 348      015342FF 
+ 348      015442FF 
+ 348      015443FF 
+ 348      015443FF 
+ 349 1128 015C4AFF 		.string	"\001\\J\377\001\\J\377\001]K\377\001]K\377\001]K\377\001]K\377\001^L\377\001^L\377\001^L\
+ 349      015C4AFF 
+GAS LISTING /tmp/ccMVh1cW.s 			page 22
+
+
+ 349      015D4BFF 
+ 349      015D4BFF 
+ 349      015D4BFF 
+ 350 1229 6C59FF00 		.string	"lY\377"
+ 351 122d 6C59FF00 		.string	"lY\377"
+ 352 1231 6C59FF00 		.string	"lY\377"
+ 353 1235 6C5AFF00 		.string	"lZ\377"
+ 354 1239 6C5AFF00 		.string	"lZ\377"
+ 355 123d 6C5AFF00 		.string	"lZ\377"
+ 356 1241 6C5BFF00 		.string	"l[\377"
+ 357 1245 6D5BFF00 		.string	"m[\377"
+ 358 1249 6D5BFF00 		.string	"m[\377"
+ 359 124d 6D5CFF00 		.string	"m\\\377"
+ 360 1251 6D5CFF00 		.string	"m\\\377"
+ 361 1255 6D5CFF00 		.string	"m\\\377"
+ 362 1259 6D5DFF00 		.string	"m]\377"
+ 363 125d 6D5DFF00 		.string	"m]\377"
+ 364 1261 6E5DFF00 		.string	"n]\377"
+ 365 1265 6E5EFF00 		.string	"n^\377"
+ 366 1269 6E5EFF00 		.string	"n^\377"
+ 367 126d 6E5EFF00 		.string	"n^\377"
+ 368 1271 6E5FFF00 		.string	"n_\377"
+ 369 1275 6E5FFF00 		.string	"n_\377"
+ 370 1279 6E5FFF00 		.string	"n_\377"
+ 371 127d 6F5FFF00 		.string	"o_\377"
+ 372 1281 6F60FF00 		.string	"o`\377"
+ 373 1285 6F60FF00 		.string	"o`\377"
+ 374 1289 6F60FF00 		.string	"o`\377"
+ 375 128d 6F61FF00 		.string	"oa\377"
+ 376 1291 6F61FF00 		.string	"oa\377"
+ 377 1295 6F61FF00 		.string	"oa\377"
+ 378 1299 7062FF00 		.string	"pb\377"
+ 379 129d 7062FF00 		.string	"pb\377"
+ 380 12a1 7062FF00 		.string	"pb\377"
+ 381 12a5 7063FF00 		.string	"pc\377"
+ 382 12a9 7063FF00 		.string	"pc\377"
+ 383 12ad 7063FF00 		.string	"pc\377"
+ 384 12b1 7064FF00 		.string	"pd\377"
+ 385 12b5 7064FF00 		.string	"pd\377"
+ 386 12b9 7164FF00 		.string	"qd\377"
+ 387 12bd 7164FF00 		.string	"qd\377"
+ 388 12c1 7165FF00 		.string	"qe\377"
+ 389 12c5 7165FF00 		.string	"qe\377"
+ 390 12c9 7165FF00 		.string	"qe\377"
+ 391 12cd 7166FF00 		.string	"qf\377"
+ 392 12d1 7166FF00 		.string	"qf\377"
+ 393 12d5 7266FF00 		.string	"rf\377"
+ 394 12d9 7267FF00 		.string	"rg\377"
+ 395 12dd 7267FF00 		.string	"rg\377"
+ 396 12e1 7267FF00 		.string	"rg\377"
+ 397 12e5 7268FF00 		.string	"rh\377"
+ 398 12e9 7268FF00 		.string	"rh\377"
+ 399 12ed 7268FF00 		.string	"rh\377"
+ 400 12f1 7269FF00 		.string	"ri\377"
+ 401 12f5 7369FF00 		.string	"si\377"
+ 402 12f9 7369FF00 		.string	"si\377"
+ 403 12fd 7369FF00 		.string	"si\377"
+GAS LISTING /tmp/ccMVh1cW.s 			page 23
+
+
+ 404 1301 736AFF00 		.string	"sj\377"
+ 405 1305 736AFF00 		.string	"sj\377"
+ 406 1309 736AFF00 		.string	"sj\377"
+ 407 130d 736BFF00 		.string	"sk\377"
+ 408 1311 746BFF00 		.string	"tk\377"
+ 409 1315 746BFF00 		.string	"tk\377"
+ 410 1319 746CFF00 		.string	"tl\377"
+ 411 131d 746CFF00 		.string	"tl\377"
+ 412 1321 746CFF00 		.string	"tl\377"
+ 413 1325 7876FF00 		.string	"xv\377"
+ 414 1329 7977FF00 		.string	"yw\377"
+ 415 132d 7977FF00 		.string	"yw\377"
+ 416 1331 7977FF00 		.string	"yw\377"
+ 417 1335 7978FF00 		.string	"yx\377"
+ 418 1339 7978FF00 		.string	"yx\377"
+ 419 133d 7978FF00 		.string	"yx\377"
+ 420 1341 7979FF00 		.string	"yy\377"
+ 421 1345 7979FF00 		.string	"yy\377"
+ 422 1349 7A79FF00 		.string	"zy\377"
+ 423 134d 7A79FF00 		.string	"zy\377"
+ 424 1351 7A7AFF00 		.string	"zz\377"
+ 425 1355 7A7AFF00 		.string	"zz\377"
+ 426 1359 7A7AFF00 		.string	"zz\377"
+ 427 135d 7A7BFF00 		.string	"z{\377"
+ 428 1361 7A7BFF00 		.string	"z{\377"
+ 429 1365 7A7BFF00 		.string	"z{\377"
+ 430 1369 7B7CFF00 		.string	"{|\377"
+ 431 136d 7B7CFF00 		.string	"{|\377"
+ 432 1371 7B7CFF00 		.string	"{|\377"
+ 433 1375 7B7DFF00 		.string	"{}\377"
+ 434 1379 7B7DFF00 		.string	"{}\377"
+ 435 137d 7B7DFF00 		.string	"{}\377"
+ 436 1381 7B7DFF00 		.string	"{}\377"
+ 437 1385 7C7EFF00 		.string	"|~\377"
+ 438 1389 7C7EFF00 		.string	"|~\377"
+ 439 138d 7C7EFF00 		.string	"|~\377"
+ 440 1391 7C7FFF00 		.string	"|\177\377"
+ 441 1395 7C7FFF00 		.string	"|\177\377"
+ 442 1399 7C7FFF00 		.string	"|\177\377"
+ 443 139d 7C80FF00 		.string	"|\200\377"
+ 444 13a1 7C80FF00 		.string	"|\200\377"
+ 445 13a5 7D80FF00 		.string	"}\200\377"
+ 446 13a9 7D80FF00 		.string	"}\200\377"
+ 447 13ad 7D81FF00 		.string	"}\201\377"
+ 448 13b1 7D81FF00 		.string	"}\201\377"
+ 449 13b5 7D81FF00 		.string	"}\201\377"
+ 450 13b9 7D82FF00 		.string	"}\202\377"
+ 451 13bd 7D82FF00 		.string	"}\202\377"
+ 452 13c1 7D82FF00 		.string	"}\202\377"
+ 453 13c5 7E83FF00 		.string	"~\203\377"
+ 454 13c9 7E83FF00 		.string	"~\203\377"
+ 455 13cd 7E83FF00 		.string	"~\203\377"
+ 456 13d1 7E83FF00 		.string	"~\203\377"
+ 457 13d5 7E84FF00 		.string	"~\204\377"
+ 458 13d9 7E84FF00 		.string	"~\204\377"
+ 459 13dd 7E84FF00 		.string	"~\204\377"
+ 460 13e1 7E85FF00 		.string	"~\205\377"
+GAS LISTING /tmp/ccMVh1cW.s 			page 24
+
+
+ 461 13e5 7F85FF00 		.string	"\177\205\377"
+ 462 13e9 7F85FF00 		.string	"\177\205\377"
+ 463 13ed 7F85FF00 		.string	"\177\205\377"
+ 464 13f1 7F86FF00 		.string	"\177\206\377"
+ 465 13f5 7F86FF00 		.string	"\177\206\377"
+ 466 13f9 7F86FF00 		.string	"\177\206\377"
+ 467 13fd 7F87FF00 		.string	"\177\207\377"
+ 468 1401 7F87FF00 		.string	"\177\207\377"
+ 469 1405 8087FF00 		.string	"\200\207\377"
+ 470 1409 8087FF00 		.string	"\200\207\377"
+ 471 140d 8088FF00 		.string	"\200\210\377"
+ 472 1411 8088FF00 		.string	"\200\210\377"
+ 473 1415 8088FF00 		.string	"\200\210\377"
+ 474 1419 8089FF00 		.string	"\200\211\377"
+ 475 141d 8089FF01 		.string	"\200\211\377\001\200\211\377\002\201\211\377\001\201\212\377\001\201\212\377"
+ 475      8089FF02 
+ 475      8189FF01 
+ 475      818AFF01 
+ 475      818AFF00 
+ 476 1431 818BFF00 		.string	"\201\213\377"
+ 477 1435 818BFF00 		.string	"\201\213\377"
+ 478 1439 818BFF00 		.string	"\201\213\377"
+ 479 143d 818CFF00 		.string	"\201\214\377"
+ 480 1441 818CFF00 		.string	"\201\214\377"
+ 481 1445 818CFF00 		.string	"\201\214\377"
+ 482 1449 828DFF00 		.string	"\202\215\377"
+ 483 144d 828DFF00 		.string	"\202\215\377"
+ 484 1451 828DFF00 		.string	"\202\215\377"
+ 485 1455 828EFF00 		.string	"\202\216\377"
+ 486 1459 828EFF00 		.string	"\202\216\377"
+ 487 145d 828FFF00 		.string	"\202\217\377"
+ 488 1461 828FFF00 		.string	"\202\217\377"
+ 489 1465 828FFF00 		.string	"\202\217\377"
+ 490 1469 8290FF00 		.string	"\202\220\377"
+ 491 146d 8390FF00 		.string	"\203\220\377"
+ 492 1471 8390FF00 		.string	"\203\220\377"
+ 493 1475 8391FF00 		.string	"\203\221\377"
+ 494 1479 8391FF00 		.string	"\203\221\377"
+ 495 147d 8391FF00 		.string	"\203\221\377"
+ 496 1481 8392FF00 		.string	"\203\222\377"
+ 497 1485 8392FF00 		.string	"\203\222\377"
+ 498 1489 8393FF00 		.string	"\203\223\377"
+ 499 148d 8493FF00 		.string	"\204\223\377"
+ 500 1491 8493FF00 		.string	"\204\223\377"
+ 501 1495 8494FF00 		.string	"\204\224\377"
+ 502 1499 8494FF00 		.string	"\204\224\377"
+ 503 149d 8494FF00 		.string	"\204\224\377"
+ 504 14a1 8495FF00 		.string	"\204\225\377"
+ 505 14a5 8495FF00 		.string	"\204\225\377"
+ 506 14a9 8495FF00 		.string	"\204\225\377"
+ 507 14ad 8496FF00 		.string	"\204\226\377"
+ 508 14b1 8496FF00 		.string	"\204\226\377"
+ 509 14b5 8597FF00 		.string	"\205\227\377"
+ 510 14b9 8597FF00 		.string	"\205\227\377"
+ 511 14bd 8597FF00 		.string	"\205\227\377"
+ 512 14c1 8598FF00 		.string	"\205\230\377"
+ 513 14c5 8598FF00 		.string	"\205\230\377"
+GAS LISTING /tmp/ccMVh1cW.s 			page 25
+
+
+ 514 14c9 8598FF00 		.string	"\205\230\377"
+ 515 14cd 8599FF00 		.string	"\205\231\377"
+ 516 14d1 8599FF00 		.string	"\205\231\377"
+ 517 14d5 8599FF00 		.string	"\205\231\377"
+ 518 14d9 869AFF00 		.string	"\206\232\377"
+ 519 14dd 869AFF00 		.string	"\206\232\377"
+ 520 14e1 869AFF00 		.string	"\206\232\377"
+ 521 14e5 869BFF00 		.string	"\206\233\377"
+ 522 14e9 869BFF00 		.string	"\206\233\377"
+ 523 14ed 869CFF00 		.string	"\206\234\377"
+ 524 14f1 869CFF00 		.string	"\206\234\377"
+ 525 14f5 869CFF00 		.string	"\206\234\377"
+ 526 14f9 869DFF00 		.string	"\206\235\377"
+ 527 14fd 869DFF00 		.string	"\206\235\377"
+ 528 1501 879DFF00 		.string	"\207\235\377"
+ 529 1505 879EFF00 		.string	"\207\236\377"
+ 530 1509 879EFF00 		.string	"\207\236\377"
+ 531 150d 879EFF00 		.string	"\207\236\377"
+ 532 1511 879FFF00 		.string	"\207\237\377"
+ 533 1515 879FFF00 		.string	"\207\237\377"
+ 534 1519 879FFF00 		.string	"\207\237\377"
+ 535 151d 87A0FF00 		.string	"\207\240\377"
+ 536 1521 87A0FF0A 		.ascii	"\207\240\377\n\212\253\377\n\213\254\377\n\213\254\377\013\213"
+ 536      8AABFF0A 
+ 536      8BACFF0A 
+ 536      8BACFF0B 
+ 536      8B
+ 537 1532 ACFF0C8B 		.ascii	"\254\377\f\213\255\377\f\213\255\377\r\213\255\377\016\213\256"
+ 537      ADFF0C8B 
+ 537      ADFF0D8B 
+ 537      ADFF0E8B 
+ 537      AE
+ 538 1543 FF0F8BAE 		.ascii	"\377\017\213\256\377\017\213\256\377\020\213\257\377\021\213"
+ 538      FF0F8BAE 
+ 538      FF108BAF 
+ 538      FF118B
+ 539 1552 AFFF128C 		.ascii	"\257\377\022\214\257\377\023\214\260\377\024\214\260\377\025"
+ 539      AFFF138C 
+ 539      B0FF148C 
+ 539      B0FF15
+ 540 1561 8CB0FF15 		.ascii	"\214\260\377\025\214\261\377\026\214\261\377\027\214\261\377"
+ 540      8CB1FF16 
+ 540      8CB1FF17 
+ 540      8CB1FF
+ 541 1570 188CB2FF 		.ascii	"\030\214\262\377\031\214\262\377\031\214\262\377\032\214\263"
+ 541      198CB2FF 
+ 541      198CB2FF 
+ 541      1A8CB3
+ 542 157f FF1B8CB3 		.ascii	"\377\033\214\263\377\033\215\263\377\034\215\264\377\035\215"
+ 542      FF1B8DB3 
+ 542      FF1C8DB4 
+ 542      FF1D8D
+ 543 158e B4FF1E8D 		.ascii	"\264\377\036\215\264\377\036\215\265\377\037\215\265\377 \215"
+ 543      B4FF1E8D 
+ 543      B5FF1F8D 
+ 543      B5FF208D 
+ 544 159e B5FF208D 		.ascii	"\265\377 \215\266\377!\215\266\377\"\215\266\377\"\215\267\377"
+GAS LISTING /tmp/ccMVh1cW.s 			page 26
+
+
+ 544      B6FF218D 
+ 544      B6FF228D 
+ 544      B6FF228D 
+ 544      B7FF
+ 545 15b0 238DB7FF 		.ascii	"#\215\267\377$\216\267\377$\216\267\377%\216\270\377&\216\270"
+ 545      248EB7FF 
+ 545      248EB7FF 
+ 545      258EB8FF 
+ 545      268EB8
+ 546 15c3 FF268EB8 		.ascii	"\377&\216\270\377'\216\271\377(\216\271\377(\216\271\377)\216"
+ 546      FF278EB9 
+ 546      FF288EB9 
+ 546      FF288EB9 
+ 546      FF298E
+ 547 15d6 BAFF2A8E 		.ascii	"\272\377*\216\272\377*\216\272\377+\216\273\377+\216\273\377"
+ 547      BAFF2A8E 
+ 547      BAFF2B8E 
+ 547      BBFF2B8E 
+ 547      BBFF
+ 548 15e8 2C8FBBFF 		.ascii	",\217\273\377-\217\273\377-\217\274\377.\217\274\377/\217\274"
+ 548      2D8FBBFF 
+ 548      2D8FBCFF 
+ 548      2E8FBCFF 
+ 548      2F8FBC
+ 549 15fb FF2F8FBD 		.ascii	"\377/\217\275\3770\217\275\3770\217\275\3771\217\276\3772\217"
+ 549      FF308FBD 
+ 549      FF308FBD 
+ 549      FF318FBE 
+ 549      FF328F
+ 550 160e BEFF328F 		.ascii	"\276\3772\217\276\3773\217\276\3774\217\277\3774\217\277\377"
+ 550      BEFF338F 
+ 550      BEFF348F 
+ 550      BFFF348F 
+ 550      BFFF
+ 551 1620 358FBFFF 		.ascii	"5\217\277\3776\220\300\3776\220\300\3776\220\300\3777\220\300"
+ 551      3690C0FF 
+ 551      3690C0FF 
+ 551      3690C0FF 
+ 551      3790C0
+ 552 1633 FF3790C0 		.ascii	"\3777\220\300\3777\220\300\3778\220\300\3778\221\300\3778\221"
+ 552      FF3790C0 
+ 552      FF3890C0 
+ 552      FF3891C0 
+ 552      FF3891
+ 553 1646 C0FF3991 		.ascii	"\300\3779\221\300\3779\221\300\377:\221\301\377:\221\301\377"
+ 553      C0FF3991 
+ 553      C0FF3A91 
+ 553      C1FF3A91 
+ 553      C1FF
+ 554 1658 3A92C1FF 		.ascii	":\222\301\377;\222\301\377;\222\301\377;\222\301\377<\222\301"
+ 554      3B92C1FF 
+ 554      3B92C1FF 
+ 554      3B92C1FF 
+ 554      3C92C1
+ 555 166b FF3C92C1 		.ascii	"\377<\222\301\377<\222\301\377=\223\301\377=\223\301\377=\223"
+ 555      FF3C92C1 
+ 555      FF3D93C1 
+GAS LISTING /tmp/ccMVh1cW.s 			page 27
+
+
+ 555      FF3D93C1 
+ 555      FF3D93
+ 556 167e C2FF3E93 		.ascii	"\302\377>\223\302\377>\223\302\377>\223\302\377?\224\302\377"
+ 556      C2FF3E93 
+ 556      C2FF3E93 
+ 556      C2FF3F94 
+ 556      C2FF
+ 557 1690 3F94C2FF 		.ascii	"?\224\302\377?\224\302\377@\224\302\377@\224\302\377@\224\302"
+ 557      3F94C2FF 
+ 557      4094C2FF 
+ 557      4094C2FF 
+ 557      4094C2
+ 558 16a3 FF4194C2 		.ascii	"\377A\224\302\377A\225\303\377A\225\303\377B\225\303\377B\225"
+ 558      FF4195C3 
+ 558      FF4195C3 
+ 558      FF4295C3 
+ 558      FF4295
+ 559 16b6 C3FF4295 		.ascii	"\303\377B\225\303\377C\225\303\377C\226\303\377C\226\303\377"
+ 559      C3FF4395 
+ 559      C3FF4396 
+ 559      C3FF4396 
+ 559      C3FF
+ 560 16c8 4496C3FF 		.ascii	"D\226\303\377D\226\303\377D\226\304\377E\226\304\377E\226\304"
+ 560      4496C3FF 
+ 560      4496C4FF 
+ 560      4596C4FF 
+ 560      4596C4
+ 561 16db FF4597C4 		.ascii	"\377E\227\304\377E\227\304\377F\227\304\377F\227\304\377F\227"
+ 561      FF4597C4 
+ 561      FF4697C4 
+ 561      FF4697C4 
+ 561      FF4697
+ 562 16ee C4FF4797 		.ascii	"\304\377G\227\304\377G\230\304\377G\230\304\377H\230\305\377"
+ 562      C4FF4798 
+ 562      C4FF4798 
+ 562      C4FF4898 
+ 562      C5FF
+ 563 1700 4898C5FF 		.ascii	"H\230\305\377H\230\305\377I\230\305\377I\231\305\377I\231\305"
+ 563      4898C5FF 
+ 563      4998C5FF 
+ 563      4999C5FF 
+ 563      4999C5
+ 564 1713 FF4999C5 		.ascii	"\377I\231\305\377J\231\305\377J\231\305\377J\231\305\377T\236"
+ 564      FF4A99C5 
+ 564      FF4A99C5 
+ 564      FF4A99C5 
+ 564      FF549E
+ 565 1726 C8FF559F 		.ascii	"\310\377U\237\311\377U\237\311\377U\237\311\377V\237\311\377"
+ 565      C9FF559F 
+ 565      C9FF559F 
+ 565      C9FF569F 
+ 565      C9FF
+ 566 1738 569FC9FF 		.ascii	"V\237\311\377V\237\311\377W\240\311\377W\240\311\377W\240\311"
+ 566      569FC9FF 
+ 566      57A0C9FF 
+ 566      57A0C9FF 
+ 566      57A0C9
+GAS LISTING /tmp/ccMVh1cW.s 			page 28
+
+
+ 567 174b FF57A0C9 		.ascii	"\377W\240\311\377X\240\311\377X\240\312\377X\240\312\377Y\241"
+ 567      FF58A0C9 
+ 567      FF58A0CA 
+ 567      FF58A0CA 
+ 567      FF59A1
+ 568 175e CAFF59A1 		.ascii	"\312\377Y\241\312\377Y\241\312\377Y\241\312\377Z\241\312\377"
+ 568      CAFF59A1 
+ 568      CAFF59A1 
+ 568      CAFF5AA1 
+ 568      CAFF
+ 569 1770 5AA1CAFF 		.ascii	"Z\241\312\377Z\242\312\377[\242\312\377[\242\313\377[\242\313"
+ 569      5AA2CAFF 
+ 569      5BA2CAFF 
+ 569      5BA2CBFF 
+ 569      5BA2CB
+ 570 1783 FF5BA2CB 		.ascii	"\377[\242\313\377\\\242\313\377\\\243\313\377\\\243\313\377]"
+ 570      FF5CA2CB 
+ 570      FF5CA3CB 
+ 570      FF5CA3CB 
+ 570      FF5D
+ 571 1795 A3CBFF5D 		.ascii	"\243\313\377]\243\313\377]\243\313\377]\243\313\377^\243\313"
+ 571      A3CBFF5D 
+ 571      A3CBFF5D 
+ 571      A3CBFF5E 
+ 571      A3CB
+ 572 17a7 FF5EA4CC 		.ascii	"\377^\244\314\377^\244\314\377_\244\314\377_\244\314\377_\244"
+ 572      FF5EA4CC 
+ 572      FF5FA4CC 
+ 572      FF5FA4CC 
+ 572      FF5FA4
+ 573 17ba CCFF5FA4 		.ascii	"\314\377_\244\314\377`\245\314\377`\245\314\377`\245\314\377"
+ 573      CCFF60A5 
+ 573      CCFF60A5 
+ 573      CCFF60A5 
+ 573      CCFF
+ 574 17cc 60A5CCFF 		.ascii	"`\245\314\377a\245\315\377a\245\315\377a\246\315\377b\246\315"
+ 574      61A5CDFF 
+ 574      61A5CDFF 
+ 574      61A6CDFF 
+ 574      62A6CD
+ 575 17df FF62A6CD 		.ascii	"\377b\246\315\377b\246\315\377b\246\315\377c\246\315\377"
+ 575      FF62A6CD 
+ 575      FF62A6CD 
+ 575      FF63A6CD 
+ 575      FF
+ 576 17f0 63A6CDFF 		.ascii	"c\246\315\377c\247\315\377d\247\315\377d\247\316\377d\247\316"
+ 576      63A7CDFF 
+ 576      64A7CDFF 
+ 576      64A7CEFF 
+ 576      64A7CE
+ 577 1803 FF64A7CE 		.ascii	"\377d\247\316\377e\247\316\377e\250\316\377e\250\316\377e\250"
+ 577      FF65A7CE 
+ 577      FF65A8CE 
+ 577      FF65A8CE 
+ 577      FF65A8
+ 578 1816 CEFF66A8 		.ascii	"\316\377f\250\316\377f\250\316\377f\250\316\377g\251\317\377"
+ 578      CEFF66A8 
+GAS LISTING /tmp/ccMVh1cW.s 			page 29
+
+
+ 578      CEFF66A8 
+ 578      CEFF67A9 
+ 578      CFFF
+ 579 1828 67A9CFFF 		.ascii	"g\251\317\377g\251\317\377h\251\317\377h\251\317\377i\251\317"
+ 579      67A9CFFF 
+ 579      68A9CFFF 
+ 579      68A9CFFF 
+ 579      69A9CF
+ 580 183b FF69A9CF 		.ascii	"\377i\251\317\377j\251\317\377j\251\317\377k\252\317\377k\252"
+ 580      FF6AA9CF 
+ 580      FF6AA9CF 
+ 580      FF6BAACF 
+ 580      FF6BAA
+ 581 184e CFFF6CAA 		.ascii	"\317\377l\252\320\377l\252\320\377m\252\320\377m\252\320\377"
+ 581      D0FF6CAA 
+ 581      D0FF6DAA 
+ 581      D0FF6DAA 
+ 581      D0FF
+ 582 1860 6EAAD0FF 		.ascii	"n\252\320\377n\252\320\377n\253\320\377o\253\320\377o\253\320"
+ 582      6EAAD0FF 
+ 582      6EABD0FF 
+ 582      6FABD0FF 
+ 582      6FABD0
+ 583 1873 FF70ABD0 		.ascii	"\377p\253\320\377p\253\320\377q\253\321\377q\253\321\377r\253"
+ 583      FF70ABD0 
+ 583      FF71ABD1 
+ 583      FF71ABD1 
+ 583      FF72AB
+ 584 1886 D1FF72AB 		.ascii	"\321\377r\253\321\377r\254\321\377s\254\321\377s\254\321\377"
+ 584      D1FF72AC 
+ 584      D1FF73AC 
+ 584      D1FF73AC 
+ 584      D1FF
+ 585 1898 74ACD1FF 		.ascii	"t\254\321\377t\254\321\377u\254\321\377u\254\321\377u\254\322"
+ 585      74ACD1FF 
+ 585      75ACD1FF 
+ 585      75ACD1FF 
+ 585      75ACD2
+ 586 18ab FF76ADD2 		.ascii	"\377v\255\322\377v\255\322\377w\255\322\377w\255\322\377x\255"
+ 586      FF76ADD2 
+ 586      FF77ADD2 
+ 586      FF77ADD2 
+ 586      FF78AD
+ 587 18be D2FF78AD 		.ascii	"\322\377x\255\322\377x\255\322\377y\255\322\377y\256\322\377"
+ 587      D2FF78AD 
+ 587      D2FF79AD 
+ 587      D2FF79AE 
+ 587      D2FF
+ 588 18d0 7AAED2FF 		.ascii	"z\256\322\377z\256\322\377{\256\323\377{\256\323\377{\256\323"
+ 588      7AAED2FF 
+ 588      7BAED3FF 
+ 588      7BAED3FF 
+ 588      7BAED3
+ 589 18e3 FF7CAED3 		.ascii	"\377|\256\323\377|\256\323\377}\257\323\377}\257\323\377}\257"
+ 589      FF7CAED3 
+ 589      FF7DAFD3 
+ 589      FF7DAFD3 
+GAS LISTING /tmp/ccMVh1cW.s 			page 30
+
+
+ 589      FF7DAF
+ 590 18f6 D3FF7EAF 		.ascii	"\323\377~\257\323\377~\257\323\377\177\257\323\377\177\257\323"
+ 590      D3FF7EAF 
+ 590      D3FF7FAF 
+ 590      D3FF7FAF 
+ 590      D3
+ 591 1907 FF7FAFD3 		.ascii	"\377\177\257\323\377\200\257\324\377\200\260\324\377\201\260"
+ 591      FF80AFD4 
+ 591      FF80B0D4 
+ 591      FF81B0
+ 592 1916 D4FF81B0 		.ascii	"\324\377\201\260\324\377\201\260\324\377\202\260\324\377\217"
+ 592      D4FF81B0 
+ 592      D4FF82B0 
+ 592      D4FF8F
+ 593 1925 B4D6FF8F 		.ascii	"\264\326\377\217\264\326\377\217\264\327\377\220\265\327\377"
+ 593      B4D6FF8F 
+ 593      B4D7FF90 
+ 593      B5D7FF
+ 594 1934 90B5D7FF 		.ascii	"\220\265\327\377\221\265\327\377\221\265\327\377\221\265\327"
+ 594      91B5D7FF 
+ 594      91B5D7FF 
+ 594      91B5D7
+ 595 1943 FF92B5D7 		.ascii	"\377\222\265\327\377\222\265\327\377\223\265\327\377\223\266"
+ 595      FF92B5D7 
+ 595      FF93B5D7 
+ 595      FF93B6
+ 596 1952 D7FF93B6 		.ascii	"\327\377\223\266\327\377\224\266\327\377\224\266\327\377\224"
+ 596      D7FF94B6 
+ 596      D7FF94B6 
+ 596      D7FF94
+ 597 1961 B6D7FF95 		.ascii	"\266\327\377\225\266\330\377\225\266\330\377\226\266\330\377"
+ 597      B6D8FF95 
+ 597      B6D8FF96 
+ 597      B6D8FF
+ 598 1970 96B7D8FF 		.ascii	"\226\267\330\377\226\267\330\377\227\267\330\377\227\267\330"
+ 598      96B7D8FF 
+ 598      97B7D8FF 
+ 598      97B7D8
+ 599 197f FF97B7D8 		.ascii	"\377\227\267\330\377\230\267\330\377\230\267\330\377\230\270"
+ 599      FF98B7D8 
+ 599      FF98B7D8 
+ 599      FF98B8
+ 600 198e D8FF99B8 		.ascii	"\330\377\231\270\330\377\231\270\330\377\232\270\330\377\232"
+ 600      D8FF99B8 
+ 600      D8FF9AB8 
+ 600      D8FF9A
+ 601 199d B8D8FF9A 		.ascii	"\270\330\377\232\270\331\377\233\270\331\377\233\270\331\377"
+ 601      B8D9FF9B 
+ 601      B8D9FF9B 
+ 601      B8D9FF
+ 602 19ac 9BB9D9FF 		.ascii	"\233\271\331\377\234\271\331\377\234\271\331\377\234\271\331"
+ 602      9CB9D9FF 
+ 602      9CB9D9FF 
+ 602      9CB9D9
+ 603 19bb FF9DB9D9 		.ascii	"\377\235\271\331\377\235\271\331\377\235\271\331\377\236\271"
+ 603      FF9DB9D9 
+ 603      FF9DB9D9 
+GAS LISTING /tmp/ccMVh1cW.s 			page 31
+
+
+ 603      FF9EB9
+ 604 19ca D9FF9EBA 		.ascii	"\331\377\236\272\331\377\236\272\331\377\237\272\331\377\237"
+ 604      D9FF9EBA 
+ 604      D9FF9FBA 
+ 604      D9FF9F
+ 605 19d9 BAD9FF9F 		.ascii	"\272\331\377\237\272\331\377\240\272\332\377\240\272\332\377"
+ 605      BAD9FFA0 
+ 605      BADAFFA0 
+ 605      BADAFF
+ 606 19e8 A0BBDAFF 		.ascii	"\240\273\332\377\241\273\332\377\241\273\332\377\242\273\332"
+ 606      A1BBDAFF 
+ 606      A1BBDAFF 
+ 606      A2BBDA
+ 607 19f7 FFA2BBDA 		.ascii	"\377\242\273\332\377\242\273\332\377\243\273\332\377\243\273"
+ 607      FFA2BBDA 
+ 607      FFA3BBDA 
+ 607      FFA3BB
+ 608 1a06 DAFFA3BC 		.ascii	"\332\377\243\274\332\377\244\274\332\377\244\274\332\377\244"
+ 608      DAFFA4BC 
+ 608      DAFFA4BC 
+ 608      DAFFA4
+ 609 1a15 BCDAFFA5 		.ascii	"\274\332\377\245\274\332\377\245\274\332\377\245\274\332\377"
+ 609      BCDAFFA5 
+ 609      BCDAFFA5 
+ 609      BCDAFF
+ 610 1a24 A5BDDAFF 		.ascii	"\245\275\332\377\246\275\333\377\246\275\333\377\246\275\333"
+ 610      A6BDDBFF 
+ 610      A6BDDBFF 
+ 610      A6BDDB
+ 611 1a33 FFA7BDDB 		.ascii	"\377\247\275\333\377\247\275\333\377\247\275\333\377\250\275"
+ 611      FFA7BDDB 
+ 611      FFA7BDDB 
+ 611      FFA8BD
+ 612 1a42 DBFFA8BD 		.ascii	"\333\377\250\275\333\377\250\276\333\377\250\276\333\377\251"
+ 612      DBFFA8BE 
+ 612      DBFFA8BE 
+ 612      DBFFA9
+ 613 1a51 BEDBFFA9 		.ascii	"\276\333\377\251\276\333\377\251\276\334\377\252\276\334\377"
+ 613      BEDBFFA9 
+ 613      BEDCFFAA 
+ 613      BEDCFF
+ 614 1a60 AABEDCFF 		.ascii	"\252\276\334\377\252\276\334\377\253\276\334\377\253\277\334"
+ 614      AABEDCFF 
+ 614      ABBEDCFF 
+ 614      ABBFDC
+ 615 1a6f FFABBFDC 		.ascii	"\377\253\277\334\377\253\277\334\377\254\277\334\377\254\277"
+ 615      FFABBFDC 
+ 615      FFACBFDC 
+ 615      FFACBF
+ 616 1a7e DCFFACBF 		.ascii	"\334\377\254\277\334\377\255\277\334\377\255\277\334\377\255"
+ 616      DCFFADBF 
+ 616      DCFFADBF 
+ 616      DCFFAD
+ 617 1a8d C0DDFFAD 		.ascii	"\300\335\377\255\300\335\377\256\300\335\377\256\300\335\377"
+ 617      C0DDFFAE 
+ 617      C0DDFFAE 
+ 617      C0DDFF
+GAS LISTING /tmp/ccMVh1cW.s 			page 32
+
+
+ 618 1a9c AEC0DDFF 		.ascii	"\256\300\335\377\257\300\335\377\257\300\335\377\257\300\335"
+ 618      AFC0DDFF 
+ 618      AFC0DDFF 
+ 618      AFC0DD
+ 619 1aab FFAFC0DD 		.ascii	"\377\257\300\335\377\260\301\335\377\260\301\335\377\260\301"
+ 619      FFB0C1DD 
+ 619      FFB0C1DD 
+ 619      FFB0C1
+ 620 1aba DDFFB0C1 		.ascii	"\335\377\260\301\335\377\261\301\335\377\261\301\336\377\261"
+ 620      DDFFB1C1 
+ 620      DDFFB1C1 
+ 620      DEFFB1
+ 621 1ac9 C1DEFFB2 		.ascii	"\301\336\377\262\301\336\377\262\302\336\377\262\302\336\377"
+ 621      C1DEFFB2 
+ 621      C2DEFFB2 
+ 621      C2DEFF
+ 622 1ad8 B2C2DEFF 		.ascii	"\262\302\336\377\263\302\336\377\263\302\336\377\263\302\336"
+ 622      B3C2DEFF 
+ 622      B3C2DEFF 
+ 622      B3C2DE
+ 623 1ae7 FFB4C2DE 		.ascii	"\377\264\302\336\377\264\302\336\377\264\303\336\377\264\303"
+ 623      FFB4C2DE 
+ 623      FFB4C3DE 
+ 623      FFB4C3
+ 624 1af6 DEFFB5C3 		.ascii	"\336\377\265\303\336\377\265\303\337\377\265\303\337\377\265"
+ 624      DEFFB5C3 
+ 624      DFFFB5C3 
+ 624      DFFFB5
+ 625 1b05 C3DFFFB6 		.ascii	"\303\337\377\266\303\337\377\266\303\337\377\266\304\337\377"
+ 625      C3DFFFB6 
+ 625      C3DFFFB6 
+ 625      C4DFFF
+ 626 1b14 B6C4DFFF 		.ascii	"\266\304\337\377\267\304\337\377\267\304\337\377\267\304\337"
+ 626      B7C4DFFF 
+ 626      B7C4DFFF 
+ 626      B7C4DF
+ 627 1b23 FFC0C8E1 		.ascii	"\377\300\310\341\377\300\310\341\377\300\310\342\377\301\311"
+ 627      FFC0C8E1 
+ 627      FFC0C8E2 
+ 627      FFC1C9
+ 628 1b32 E2FFC1C9 		.ascii	"\342\377\301\311\342\377\301\311\342\377\301\311\342\377\302"
+ 628      E2FFC1C9 
+ 628      E2FFC1C9 
+ 628      E2FFC2
+ 629 1b41 C9E2FFC2 		.ascii	"\311\342\377\302\311\342\377\302\311\342\377\303\311\342\377"
+ 629      C9E2FFC2 
+ 629      C9E2FFC3 
+ 629      C9E2FF
+ 630 1b50 C3CAE2FF 		.ascii	"\303\312\342\377\303\312\342\377\303\312\342\377\304\312\342"
+ 630      C3CAE2FF 
+ 630      C3CAE2FF 
+ 630      C4CAE2
+ 631 1b5f FFC4CAE2 		.ascii	"\377\304\312\342\377\304\312\342\377\304\312\343\377\305\312"
+ 631      FFC4CAE2 
+ 631      FFC4CAE3 
+ 631      FFC5CA
+ 632 1b6e E3FFC5CB 		.ascii	"\343\377\305\313\343\377\305\313\343\377\305\313\343\377\306"
+GAS LISTING /tmp/ccMVh1cW.s 			page 33
+
+
+ 632      E3FFC5CB 
+ 632      E3FFC5CB 
+ 632      E3FFC6
+ 633 1b7d CBE3FFC6 		.ascii	"\313\343\377\306\313\343\377\306\313\343\377\306\313\343\377"
+ 633      CBE3FFC6 
+ 633      CBE3FFC6 
+ 633      CBE3FF
+ 634 1b8c C7CBE3FF 		.ascii	"\307\313\343\377\307\314\343\377\307\314\343\377\307\314\343"
+ 634      C7CCE3FF 
+ 634      C7CCE3FF 
+ 634      C7CCE3
+ 635 1b9b FFC8CCE3 		.ascii	"\377\310\314\343\377\310\314\343\377\310\314\344\377\310\314"
+ 635      FFC8CCE3 
+ 635      FFC8CCE4 
+ 635      FFC8CC
+ 636 1baa E4FFC9CC 		.ascii	"\344\377\311\314\344\377\311\315\344\377\311\315\344\377\311"
+ 636      E4FFC9CD 
+ 636      E4FFC9CD 
+ 636      E4FFC9
+ 637 1bb9 CDE4FFC9 		.ascii	"\315\344\377\311\315\344\377\312\315\344\377\312\315\344\377"
+ 637      CDE4FFCA 
+ 637      CDE4FFCA 
+ 637      CDE4FF
+ 638 1bc8 CACDE4FF 		.ascii	"\312\315\344\377\312\316\344\377\313\316\344\377\313\316\344"
+ 638      CACEE4FF 
+ 638      CBCEE4FF 
+ 638      CBCEE4
+ 639 1bd7 FFCBCEE4 		.ascii	"\377\313\316\344\377\313\316\344\377\314\316\344\377\314\316"
+ 639      FFCBCEE4 
+ 639      FFCCCEE4 
+ 639      FFCCCE
+ 640 1be6 E5FFCCCE 		.ascii	"\345\377\314\316\345\377\314\317\345\377\315\317\345\377\315"
+ 640      E5FFCCCF 
+ 640      E5FFCDCF 
+ 640      E5FFCD
+ 641 1bf5 CFE5FFCD 		.ascii	"\317\345\377\315\317\345\377\315\317\345\377\315\317\345\377"
+ 641      CFE5FFCD 
+ 641      CFE5FFCD 
+ 641      CFE5FF
+ 642 1c04 CECFE5FF 		.ascii	"\316\317\345\377\316\320\345\377\316\320\345\377\316\320\345"
+ 642      CED0E5FF 
+ 642      CED0E5FF 
+ 642      CED0E5
+ 643 1c13 FFCFD0E5 		.ascii	"\377\317\320\345\377\317\320\345\377\317\320\345\377\317\320"
+ 643      FFCFD0E5 
+ 643      FFCFD0E5 
+ 643      FFCFD0
+ 644 1c22 E5FFCFD1 		.ascii	"\345\377\317\321\345\377\320\321\346\377\320\321\346\377\320"
+ 644      E5FFD0D1 
+ 644      E6FFD0D1 
+ 644      E6FFD0
+ 645 1c31 D1E6FFD0 		.ascii	"\321\346\377\320\321\346\377\320\321\346\377\321\321\346\377"
+ 645      D1E6FFD0 
+ 645      D1E6FFD1 
+ 645      D1E6FF
+ 646 1c40 D1D1E6FF 		.ascii	"\321\321\346\377\321\321\346\377\321\321\346\377\321\321\346"
+ 646      D1D1E6FF 
+GAS LISTING /tmp/ccMVh1cW.s 			page 34
+
+
+ 646      D1D1E6FF 
+ 646      D1D1E6
+ 647 1c4f FFD2D2E6 		.ascii	"\377\322\322\346\377\322\322\346\377\322\322\346\377\322\322"
+ 647      FFD2D2E6 
+ 647      FFD2D2E6 
+ 647      FFD2D2
+ 648 1c5e E6FFD2D2 		.ascii	"\346\377\322\322\346\377\323\322\347\377\323\322\347\377\323"
+ 648      E6FFD3D2 
+ 648      E7FFD3D2 
+ 648      E7FFD3
+ 649 1c6d D2E7FFD3 		.ascii	"\322\347\377\323\322\347\377\323\323\347\377\324\323\347\377"
+ 649      D2E7FFD3 
+ 649      D3E7FFD4 
+ 649      D3E7FF
+ 650 1c7c D4D3E7FF 		.ascii	"\324\323\347\377\324\323\347\377\324\323\347\377\324\323\347"
+ 650      D4D3E7FF 
+ 650      D4D3E7FF 
+ 650      D4D3E7
+ 651 1c8b FFD4D3E7 		.ascii	"\377\324\323\347\377\325\323\347\377\325\323\347\377\325\323"
+ 651      FFD5D3E7 
+ 651      FFD5D3E7 
+ 651      FFD5D3
+ 652 1c9a E7FFD5D4 		.ascii	"\347\377\325\324\347\377\325\324\350\377\326\324\350\377\326"
+ 652      E7FFD5D4 
+ 652      E8FFD6D4 
+ 652      E8FFD6
+ 653 1ca9 D4E8FFD6 		.ascii	"\324\350\377\326\324\350\377\326\324\350\377\326\324\350\377"
+ 653      D4E8FFD6 
+ 653      D4E8FFD6 
+ 653      D4E8FF
+ 654 1cb8 D7D4E8FF 		.ascii	"\327\324\350\377\327\324\350\377\327\324\350\377\327\325\350"
+ 654      D7D4E8FF 
+ 654      D7D4E8FF 
+ 654      D7D5E8
+ 655 1cc7 FFD7D5E8 		.ascii	"\377\327\325\350\377\327\325\350\377\330\325\350\377\330\325"
+ 655      FFD7D5E8 
+ 655      FFD8D5E8 
+ 655      FFD8D5
+ 656 1cd6 E8FFD8D5 		.ascii	"\350\377\330\325\350\377\330\325\350\377\330\325\351\377\331"
+ 656      E8FFD8D5 
+ 656      E8FFD8D5 
+ 656      E9FFD9
+ 657 1ce5 D5E9FFD9 		.ascii	"\325\351\377\331\325\351\377\331\326\351\377\331\326\351\377"
+ 657      D5E9FFD9 
+ 657      D6E9FFD9 
+ 657      D6E9FF
+ 658 1cf4 D9D6E9FF 		.ascii	"\331\326\351\377\331\326\351\377\332\326\351\377\332\326\351"
+ 658      D9D6E9FF 
+ 658      DAD6E9FF 
+ 658      DAD6E9
+ 659 1d03 FFDAD6E9 		.ascii	"\377\332\326\351\377\332\326\351\377\332\326\351\377\333\327"
+ 659      FFDAD6E9 
+ 659      FFDAD6E9 
+ 659      FFDBD7
+ 660 1d12 E9FFDBD7 		.ascii	"\351\377\333\327\351\377\333\327\351\377\333\327\351\377\333"
+ 660      E9FFDBD7 
+ 660      E9FFDBD7 
+GAS LISTING /tmp/ccMVh1cW.s 			page 35
+
+
+ 660      E9FFDB
+ 661 1d21 D7EAFFE1 		.ascii	"\327\352\377\341\332\354\377\341\333\354\377\341\333\354\377"
+ 661      DAECFFE1 
+ 661      DBECFFE1 
+ 661      DBECFF
+ 662 1d30 E2DBECFF 		.ascii	"\342\333\354\377\342\333\354\377\342\333\354\377\342\333\354"
+ 662      E2DBECFF 
+ 662      E2DBECFF 
+ 662      E2DBEC
+ 663 1d3f FFE2DBEC 		.ascii	"\377\342\333\354\377\342\333\354\377\343\333\354\377\343\334"
+ 663      FFE2DBEC 
+ 663      FFE3DBEC 
+ 663      FFE3DC
+ 664 1d4e ECFFE3DC 		.ascii	"\354\377\343\334\354\377\343\334\354\377\343\334\354\377\343"
+ 664      ECFFE3DC 
+ 664      ECFFE3DC 
+ 664      ECFFE3
+ 665 1d5d DCECFFE4 		.ascii	"\334\354\377\344\334\354\377\344\334\355\377\344\334\355\377"
+ 665      DCECFFE4 
+ 665      DCEDFFE4 
+ 665      DCEDFF
+ 666 1d6c E4DCEDFF 		.ascii	"\344\334\355\377\344\334\355\377\344\335\355\377\345\335\355"
+ 666      E4DCEDFF 
+ 666      E4DDEDFF 
+ 666      E5DDED
+ 667 1d7b FFE5DDED 		.ascii	"\377\345\335\355\377\345\335\355\377\345\335\355\377\345\335"
+ 667      FFE5DDED 
+ 667      FFE5DDED 
+ 667      FFE5DD
+ 668 1d8a EDFFE5DD 		.ascii	"\355\377\345\335\355\377\346\335\355\377\346\335\355\377\346"
+ 668      EDFFE6DD 
+ 668      EDFFE6DD 
+ 668      EDFFE6
+ 669 1d99 DEEDFFE6 		.ascii	"\336\355\377\346\336\355\377\346\336\355\377\346\336\356\377"
+ 669      DEEDFFE6 
+ 669      DEEDFFE6 
+ 669      DEEEFF
+ 670 1da8 E7DEEEFF 		.ascii	"\347\336\356\377\347\336\356\377\347\336\356\377\347\336\356"
+ 670      E7DEEEFF 
+ 670      E7DEEEFF 
+ 670      E7DEEE
+ 671 1db7 FFE7DEEE 		.ascii	"\377\347\336\356\377\347\337\356\377\350\337\356\377\350\337"
+ 671      FFE7DFEE 
+ 671      FFE8DFEE 
+ 671      FFE8DF
+ 672 1dc6 EEFFE8DF 		.ascii	"\356\377\350\337\356\377\350\337\356\377\350\337\356\377\350"
+ 672      EEFFE8DF 
+ 672      EEFFE8DF 
+ 672      EEFFE8
+ 673 1dd5 DFEEFFE9 		.ascii	"\337\356\377\351\337\356\377\351\337\356\377\351\340\356\377"
+ 673      DFEEFFE9 
+ 673      DFEEFFE9 
+ 673      E0EEFF
+ 674 1de4 E9E0EFFF 		.ascii	"\351\340\357\377\351\340\357\377\351\340\357\377\351\340\357"
+ 674      E9E0EFFF 
+ 674      E9E0EFFF 
+ 674      E9E0EF
+GAS LISTING /tmp/ccMVh1cW.s 			page 36
+
+
+ 675 1df3 FFEAE0EF 		.ascii	"\377\352\340\357\377\352\340\357\377\352\340\357\377\352\340"
+ 675      FFEAE0EF 
+ 675      FFEAE0EF 
+ 675      FFEAE0
+ 676 1e02 EFFFEAE1 		.ascii	"\357\377\352\341\357\377\352\341\357\377\353\341\357\377\353"
+ 676      EFFFEAE1 
+ 676      EFFFEBE1 
+ 676      EFFFEB
+ 677 1e11 E1EFFFEB 		.ascii	"\341\357\377\353\341\357\377\353\341\357\377\353\341\357\377"
+ 677      E1EFFFEB 
+ 677      E1EFFFEB 
+ 677      E1EFFF
+ 678 1e20 EBE1EFFF 		.ascii	"\353\341\357\377\353\342\357\377\354\342\360\377\354\342\360"
+ 678      EBE2EFFF 
+ 678      ECE2F0FF 
+ 678      ECE2F0
+ 679 1e2f FFECE2F0 		.ascii	"\377\354\342\360\377\354\342\360\377\354\342\360\377\354\342"
+ 679      FFECE2F0 
+ 679      FFECE2F0 
+ 679      FFECE2
+ 680 1e3e F0FFEDE2 		.ascii	"\360\377\355\342\360\377\355\342\360\377\355\343\360\377\355"
+ 680      F0FFEDE2 
+ 680      F0FFEDE3 
+ 680      F0FFED
+ 681 1e4d E3F0FFED 		.ascii	"\343\360\377\355\343\360\377\355\343\360\377\355\343\360\377"
+ 681      E3F0FFED 
+ 681      E3F0FFED 
+ 681      E3F0FF
+ 682 1e5c EEE3F0FF 		.ascii	"\356\343\360\377\356\343\360\377\356\343\360\377\356\344\360"
+ 682      EEE3F0FF 
+ 682      EEE3F0FF 
+ 682      EEE4F0
+ 683 1e6b FFEEE4F0 		.ascii	"\377\356\344\360\377\356\344\361\377\356\344\361\377\357\344"
+ 683      FFEEE4F1 
+ 683      FFEEE4F1 
+ 683      FFEFE4
+ 684 1e7a F1FFEFE4 		.ascii	"\361\377\357\344\361\377\357\344\361\377\357\344\361\377\357"
+ 684      F1FFEFE4 
+ 684      F1FFEFE4 
+ 684      F1FFEF
+ 685 1e89 E5F1FFEF 		.ascii	"\345\361\377\357\345\361\377\357\345\361\377\357\345\361\377"
+ 685      E5F1FFEF 
+ 685      E5F1FFEF 
+ 685      E5F1FF
+ 686 1e98 F0E5F1FF 		.ascii	"\360\345\361\377\360\345\361\377\360\345\361\377\360\345\361"
+ 686      F0E5F1FF 
+ 686      F0E5F1FF 
+ 686      F0E5F1
+ 687 1ea7 FFF0E6F1 		.ascii	"\377\360\346\361\377\360\346\361\377\360\346\361\377\361\346"
+ 687      FFF0E6F1 
+ 687      FFF0E6F1 
+ 687      FFF1E6
+ 688 1eb6 F2FFF1E6 		.ascii	"\362\377\361\346\362\377\361\346\362\377\361\346\362\377\361"
+ 688      F2FFF1E6 
+ 688      F2FFF1E6 
+ 688      F2FFF1
+ 689 1ec5 E7F2FFF1 		.ascii	"\347\362\377\361\347\362\377\361\347\362\377\361\347\362\377"
+GAS LISTING /tmp/ccMVh1cW.s 			page 37
+
+
+ 689      E7F2FFF1 
+ 689      E7F2FFF1 
+ 689      E7F2FF
+ 690 1ed4 F2E7F2FF 		.ascii	"\362\347\362\377\362\347\362\377\362\347\362\377\362\347\362"
+ 690      F2E7F2FF 
+ 690      F2E7F2FF 
+ 690      F2E7F2
+ 691 1ee3 FFF2E8F2 		.ascii	"\377\362\350\362\377\362\350\362\377\362\350\362\377\362\350"
+ 691      FFF2E8F2 
+ 691      FFF2E8F2 
+ 691      FFF2E8
+ 692 1ef2 F2FFF3E8 		.ascii	"\362\377\363\350\363\377\363\350\363\377\363\350\363\377\363"
+ 692      F3FFF3E8 
+ 692      F3FFF3E8 
+ 692      F3FFF3
+ 693 1f01 E8F3FFF3 		.ascii	"\350\363\377\363\351\363\377\363\351\363\377\363\351\363\377"
+ 693      E9F3FFF3 
+ 693      E9F3FFF3 
+ 693      E9F3FF
+ 694 1f10 F3E9F3FF 		.ascii	"\363\351\363\377\364\351\363\377\364\351\363\377\364\351\363"
+ 694      F4E9F3FF 
+ 694      F4E9F3FF 
+ 694      F4E9F3
+ 695 1f1f FFF4E9F3 		.ascii	"\377\364\351\363\377\370\356\366\377\370\356\366\377\370\356"
+ 695      FFF8EEF6 
+ 695      FFF8EEF6 
+ 695      FFF8EE
+ 696 1f2e F6FFF8EE 		.ascii	"\366\377\370\356\366\377\370\356\366\377\370\356\366\377\371"
+ 696      F6FFF8EE 
+ 696      F6FFF8EE 
+ 696      F6FFF9
+ 697 1f3d EFF6FFF9 		.ascii	"\357\366\377\371\357\366\377\371\357\366\377\371\357\366\377"
+ 697      EFF6FFF9 
+ 697      EFF6FFF9 
+ 697      EFF6FF
+ 698 1f4c F9EFF6FF 		.ascii	"\371\357\366\377\371\357\366\377\371\357\366\377\371\360\366"
+ 698      F9EFF6FF 
+ 698      F9EFF6FF 
+ 698      F9F0F6
+ 699 1f5b FFF9F0F6 		.ascii	"\377\371\360\366\377\372\360\367\377\372\360\367\377\372\360"
+ 699      FFFAF0F7 
+ 699      FFFAF0F7 
+ 699      FFFAF0
+ 700 1f6a F7FFFAF0 		.ascii	"\367\377\372\360\367\377\372\360\367\377\372\360\367\377\372"
+ 700      F7FFFAF0 
+ 700      F7FFFAF0 
+ 700      F7FFFA
+ 701 1f79 F1F7FFFA 		.ascii	"\361\367\377\372\361\367\377\372\361\367\377\373\361\367\377"
+ 701      F1F7FFFA 
+ 701      F1F7FFFB 
+ 701      F1F7FF
+ 702 1f88 FBF1F7FF 		.ascii	"\373\361\367\377\373\361\367\377\373\361\367\377\373\362\370"
+ 702      FBF1F7FF 
+ 702      FBF1F7FF 
+ 702      FBF2F8
+ 703 1f97 FFFBF2F8 		.ascii	"\377\373\362\370\377\373\362\370\377\373\362\370\377\373\362"
+ 703      FFFBF2F8 
+GAS LISTING /tmp/ccMVh1cW.s 			page 38
+
+
+ 703      FFFBF2F8 
+ 703      FFFBF2
+ 704 1fa6 F8FFFBF2 		.ascii	"\370\377\373\362\370\377\374\362\370\377\374\363\370\377\374"
+ 704      F8FFFCF2 
+ 704      F8FFFCF3 
+ 704      F8FFFC
+ 705 1fb5 F3F8FFFC 		.ascii	"\363\370\377\374\363\370\377\374\363\370\377"
+ 705      F3F8FFFC 
+ 705      F3F8FF
+ 706 1fc0 FCF3F8FF 		.ascii	"\374\363\370\377\374\363\370\377\374\363\371\377\374\363\371"
+ 706      FCF3F8FF 
+ 706      FCF3F9FF 
+ 706      FCF3F9
+ 707 1fcf FFFDF4F9 		.ascii	"\377\375\364\371\377\375\364\371\377\375\364\371\377\375\364"
+ 707      FFFDF4F9 
+ 707      FFFDF4F9 
+ 707      FFFDF4
+ 708 1fde F9FFFDF4 		.ascii	"\371\377\375\364\371\377\375\364\371\377\375\364\371\377\375"
+ 708      F9FFFDF4 
+ 708      F9FFFDF4 
+ 708      F9FFFD
+ 709 1fed F5F9FFFD 		.ascii	"\365\371\377\375\365\371\377\375\365\371\377\375\365\372\377"
+ 709      F5F9FFFD 
+ 709      F5F9FFFD 
+ 709      F5FAFF
+ 710 1ffc FEF5FAFF 		.ascii	"\376\365\372\377\376\365\372\377\376\365\372\377\376\366\372"
+ 710      FEF5FAFF 
+ 710      FEF5FAFF 
+ 710      FEF6FA
+ 711 200b FFFEF6FA 		.ascii	"\377\376\366\372\377\376\366\372\377\376\366\372\377\376\366"
+ 711      FFFEF6FA 
+ 711      FFFEF6FA 
+ 711      FFFEF6
+ 712 201a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377"
+ 712      FAFFFEF6 
+ 712      FAFF
+ 713              		.globl	heatmap_cs_PuBuGn_soft
+ 714              		.section	.data.rel.local
+ 715              		.align 8
+ 716              		.type	heatmap_cs_PuBuGn_soft, @object
+ 717              		.size	heatmap_cs_PuBuGn_soft, 8
+ 718              	heatmap_cs_PuBuGn_soft:
+ 719 0010 00000000 		.quad	soft
+ 719      00000000 
+ 720              		.section	.data.rel.ro.local
+ 721              		.align 16
+ 722              		.type	soft, @object
+ 723              		.size	soft, 16
+ 724              	soft:
+ 725 0020 00000000 		.quad	soft_data
+ 725      00000000 
+ 726 0028 01040000 		.quad	1025
+ 726      00000000 
+ 727              		.section	.rodata
+ 728 2024 00000000 		.align 32
+ 728      00000000 
+ 728      00000000 
+GAS LISTING /tmp/ccMVh1cW.s 			page 39
+
+
+ 728      00000000 
+ 728      00000000 
+ 729              		.type	soft_data, @object
+ 730              		.size	soft_data, 4100
+ 731              	soft_data:
+ 732 2040 00       		.string	""
+ 733 2041 00       		.string	""
+ 734 2042 00       		.string	""
+ 735 2043 00       		.string	""
+ 736 2044 01463500 		.string	"\001F5"
+ 737 2048 01463607 		.ascii	"\001F6\007\001F6\016\001F6\026\001G7\035\001G7%\001G7,\001H7"
+ 737      0146360E 
+ 737      01463616 
+ 737      0147371D 
+ 737      01473725 
+ 738 2063 34014838 		.ascii	"4\001H8;\001H8C\001H8J\001I8R\001I9Y\001I9a\001J9h\001J9p\001"
+ 738      3B014838 
+ 738      43014838 
+ 738      4A014938 
+ 738      52014939 
+ 739 2085 4A3A7701 		.ascii	"J:w\001J:\177\001K:\206\001K:\215\001K;\225\001L;\234\001L;\244"
+ 739      4A3A7F01 
+ 739      4B3A8601 
+ 739      4B3A8D01 
+ 739      4B3B9501 
+ 740 20a0 014C3BAB 		.ascii	"\001L;\253\001L<\263\001M<\272\001M<\302\001M=\311\001N=\321"
+ 740      014C3CB3 
+ 740      014D3CBA 
+ 740      014D3CC2 
+ 740      014D3DC9 
+ 741 20b8 014E3DD8 		.ascii	"\001N=\330\001N=\340\001N>\347\001O>\357\001O>\366\001O>\376"
+ 741      014E3DE0 
+ 741      014E3EE7 
+ 741      014F3EEF 
+ 741      014F3EF6 
+ 742 20d0 01503FFF 		.ascii	"\001P?\377\001P?\377\001P?\377\001P?\377\001Q@\377\001Q@\377"
+ 742      01503FFF 
+ 742      01503FFF 
+ 742      01503FFF 
+ 742      015140FF 
+ 743 20e8 015140FF 		.ascii	"\001Q@\377\001R@\377\001RA\377\001RA\377\001SA\377\001SB\377"
+ 743      015240FF 
+ 743      015241FF 
+ 743      015241FF 
+ 743      015341FF 
+ 744 2100 015342FF 		.ascii	"\001SB\377\001SB\377\001TB\377\001TC\377\001TC\377\001UC\377"
+ 744      015342FF 
+ 744      015442FF 
+ 744      015443FF 
+ 744      015443FF 
+ 745 2118 015543FF 		.ascii	"\001UC\377\001UD\377\001UD\377\001VD\377\001VE\377\001VE\377"
+ 745      015544FF 
+ 745      015544FF 
+ 745      015644FF 
+ 745      015645FF 
+ 746 2130 015745FF 		.ascii	"\001WE\377\001WE\377\001WF\377\001XF\377\001XF\377\001XF\377"
+ 746      015745FF 
+GAS LISTING /tmp/ccMVh1cW.s 			page 40
+
+
+ 746      015746FF 
+ 746      015846FF 
+ 746      015846FF 
+ 747 2148 015847FF 		.string	"\001XG\377\001YG\377\001YG\377\001YH\377\001ZH\377\001ZH\377\001ZH\377\001[I\377\001[I\37
+ 747      015947FF 
+ 747      015947FF 
+ 747      015948FF 
+ 747      015A48FF 
+ 748 2249 6C59FF00 		.string	"lY\377"
+ 749 224d 6C59FF00 		.string	"lY\377"
+ 750 2251 6C5AFF00 		.string	"lZ\377"
+ 751 2255 6C5AFF00 		.string	"lZ\377"
+ 752 2259 6C5AFF00 		.string	"lZ\377"
+ 753 225d 6D5BFF00 		.string	"m[\377"
+ 754 2261 6D5BFF00 		.string	"m[\377"
+ 755 2265 6D5CFF00 		.string	"m\\\377"
+ 756 2269 6D5CFF00 		.string	"m\\\377"
+ 757 226d 6D5CFF00 		.string	"m\\\377"
+ 758 2271 6D5DFF00 		.string	"m]\377"
+ 759 2275 6E5DFF00 		.string	"n]\377"
+ 760 2279 6E5EFF00 		.string	"n^\377"
+ 761 227d 6E5EFF00 		.string	"n^\377"
+ 762 2281 6E5EFF00 		.string	"n^\377"
+ 763 2285 6E5FFF00 		.string	"n_\377"
+ 764 2289 6E5FFF00 		.string	"n_\377"
+ 765 228d 6F60FF00 		.string	"o`\377"
+ 766 2291 6F60FF00 		.string	"o`\377"
+ 767 2295 6F60FF00 		.string	"o`\377"
+ 768 2299 6F61FF00 		.string	"oa\377"
+ 769 229d 6F61FF00 		.string	"oa\377"
+ 770 22a1 6F62FF00 		.string	"ob\377"
+ 771 22a5 7062FF00 		.string	"pb\377"
+ 772 22a9 7062FF00 		.string	"pb\377"
+ 773 22ad 7063FF00 		.string	"pc\377"
+ 774 22b1 7063FF00 		.string	"pc\377"
+ 775 22b5 7064FF00 		.string	"pd\377"
+ 776 22b9 7164FF00 		.string	"qd\377"
+ 777 22bd 7164FF00 		.string	"qd\377"
+ 778 22c1 7165FF00 		.string	"qe\377"
+ 779 22c5 7165FF00 		.string	"qe\377"
+ 780 22c9 7166FF00 		.string	"qf\377"
+ 781 22cd 7166FF00 		.string	"qf\377"
+ 782 22d1 7266FF00 		.string	"rf\377"
+ 783 22d5 7267FF00 		.string	"rg\377"
+ 784 22d9 7267FF00 		.string	"rg\377"
+ 785 22dd 7267FF00 		.string	"rg\377"
+ 786 22e1 7268FF00 		.string	"rh\377"
+ 787 22e5 7268FF00 		.string	"rh\377"
+ 788 22e9 7369FF00 		.string	"si\377"
+ 789 22ed 7369FF00 		.string	"si\377"
+ 790 22f1 7369FF00 		.string	"si\377"
+ 791 22f5 736AFF00 		.string	"sj\377"
+ 792 22f9 736AFF00 		.string	"sj\377"
+ 793 22fd 736BFF00 		.string	"sk\377"
+ 794 2301 746BFF00 		.string	"tk\377"
+ 795 2305 746BFF00 		.string	"tk\377"
+ 796 2309 746CFF00 		.string	"tl\377"
+GAS LISTING /tmp/ccMVh1cW.s 			page 41
+
+
+ 797 230d 746CFF00 		.string	"tl\377"
+ 798 2311 746DFF00 		.string	"tm\377"
+ 799 2315 746DFF00 		.string	"tm\377"
+ 800 2319 756DFF00 		.string	"um\377"
+ 801 231d 756EFF00 		.string	"un\377"
+ 802 2321 756EFF00 		.string	"un\377"
+ 803 2325 756FFF00 		.string	"uo\377"
+ 804 2329 756FFF00 		.string	"uo\377"
+ 805 232d 756FFF00 		.string	"uo\377"
+ 806 2331 7670FF00 		.string	"vp\377"
+ 807 2335 7670FF00 		.string	"vp\377"
+ 808 2339 7670FF00 		.string	"vp\377"
+ 809 233d 7671FF00 		.string	"vq\377"
+ 810 2341 7671FF00 		.string	"vq\377"
+ 811 2345 7672FF00 		.string	"vr\377"
+ 812 2349 7772FF00 		.string	"wr\377"
+ 813 234d 7772FF00 		.string	"wr\377"
+ 814 2351 7773FF00 		.string	"ws\377"
+ 815 2355 7773FF00 		.string	"ws\377"
+ 816 2359 7774FF00 		.string	"wt\377"
+ 817 235d 7774FF00 		.string	"wt\377"
+ 818 2361 7874FF00 		.string	"xt\377"
+ 819 2365 7875FF00 		.string	"xu\377"
+ 820 2369 7875FF00 		.string	"xu\377"
+ 821 236d 7875FF00 		.string	"xu\377"
+ 822 2371 7876FF00 		.string	"xv\377"
+ 823 2375 7876FF00 		.string	"xv\377"
+ 824 2379 7977FF00 		.string	"yw\377"
+ 825 237d 7977FF00 		.string	"yw\377"
+ 826 2381 7977FF00 		.string	"yw\377"
+ 827 2385 7978FF00 		.string	"yx\377"
+ 828 2389 7978FF00 		.string	"yx\377"
+ 829 238d 7979FF00 		.string	"yy\377"
+ 830 2391 7979FF00 		.string	"yy\377"
+ 831 2395 7A79FF00 		.string	"zy\377"
+ 832 2399 7A7AFF00 		.string	"zz\377"
+ 833 239d 7A7AFF00 		.string	"zz\377"
+ 834 23a1 7A7AFF00 		.string	"zz\377"
+ 835 23a5 7A7BFF00 		.string	"z{\377"
+ 836 23a9 7A7BFF00 		.string	"z{\377"
+ 837 23ad 7B7CFF00 		.string	"{|\377"
+ 838 23b1 7B7CFF00 		.string	"{|\377"
+ 839 23b5 7B7CFF00 		.string	"{|\377"
+ 840 23b9 7B7DFF00 		.string	"{}\377"
+ 841 23bd 7B7DFF00 		.string	"{}\377"
+ 842 23c1 7B7DFF00 		.string	"{}\377"
+ 843 23c5 7C7EFF00 		.string	"|~\377"
+ 844 23c9 7C7EFF00 		.string	"|~\377"
+ 845 23cd 7C7FFF00 		.string	"|\177\377"
+ 846 23d1 7C7FFF00 		.string	"|\177\377"
+ 847 23d5 7C7FFF00 		.string	"|\177\377"
+ 848 23d9 7C80FF00 		.string	"|\200\377"
+ 849 23dd 7C80FF00 		.string	"|\200\377"
+ 850 23e1 7D80FF00 		.string	"}\200\377"
+ 851 23e5 7D81FF00 		.string	"}\201\377"
+ 852 23e9 7D81FF00 		.string	"}\201\377"
+ 853 23ed 7D82FF00 		.string	"}\202\377"
+GAS LISTING /tmp/ccMVh1cW.s 			page 42
+
+
+ 854 23f1 7D82FF00 		.string	"}\202\377"
+ 855 23f5 7D82FF00 		.string	"}\202\377"
+ 856 23f9 7E83FF00 		.string	"~\203\377"
+ 857 23fd 7E83FF00 		.string	"~\203\377"
+ 858 2401 7E83FF00 		.string	"~\203\377"
+ 859 2405 7E84FF00 		.string	"~\204\377"
+ 860 2409 7E84FF00 		.string	"~\204\377"
+ 861 240d 7E84FF00 		.string	"~\204\377"
+ 862 2411 7F85FF00 		.string	"\177\205\377"
+ 863 2415 7F85FF00 		.string	"\177\205\377"
+ 864 2419 7F86FF00 		.string	"\177\206\377"
+ 865 241d 7F86FF00 		.string	"\177\206\377"
+ 866 2421 7F86FF00 		.string	"\177\206\377"
+ 867 2425 7F87FF00 		.string	"\177\207\377"
+ 868 2429 7F87FF00 		.string	"\177\207\377"
+ 869 242d 8087FF00 		.string	"\200\207\377"
+ 870 2431 8088FF00 		.string	"\200\210\377"
+ 871 2435 8088FF00 		.string	"\200\210\377"
+ 872 2439 8088FF00 		.string	"\200\210\377"
+ 873 243d 8089FF01 		.string	"\200\211\377\001\200\211\377\002\201\211\377\001\201\212\377"
+ 873      8089FF02 
+ 873      8189FF01 
+ 873      818AFF00 
+ 874 244d 818AFF00 		.string	"\201\212\377"
+ 875 2451 818BFF00 		.string	"\201\213\377"
+ 876 2455 818BFF00 		.string	"\201\213\377"
+ 877 2459 818CFF00 		.string	"\201\214\377"
+ 878 245d 818CFF00 		.string	"\201\214\377"
+ 879 2461 828DFF00 		.string	"\202\215\377"
+ 880 2465 828DFF00 		.string	"\202\215\377"
+ 881 2469 828EFF00 		.string	"\202\216\377"
+ 882 246d 828EFF00 		.string	"\202\216\377"
+ 883 2471 828EFF00 		.string	"\202\216\377"
+ 884 2475 828FFF00 		.string	"\202\217\377"
+ 885 2479 828FFF00 		.string	"\202\217\377"
+ 886 247d 8390FF00 		.string	"\203\220\377"
+ 887 2481 8390FF00 		.string	"\203\220\377"
+ 888 2485 8391FF00 		.string	"\203\221\377"
+ 889 2489 8391FF00 		.string	"\203\221\377"
+ 890 248d 8392FF00 		.string	"\203\222\377"
+ 891 2491 8392FF00 		.string	"\203\222\377"
+ 892 2495 8393FF00 		.string	"\203\223\377"
+ 893 2499 8493FF00 		.string	"\204\223\377"
+ 894 249d 8493FF00 		.string	"\204\223\377"
+ 895 24a1 8494FF00 		.string	"\204\224\377"
+ 896 24a5 8494FF00 		.string	"\204\224\377"
+ 897 24a9 8495FF00 		.string	"\204\225\377"
+ 898 24ad 8495FF00 		.string	"\204\225\377"
+ 899 24b1 8496FF00 		.string	"\204\226\377"
+ 900 24b5 8596FF00 		.string	"\205\226\377"
+ 901 24b9 8597FF00 		.string	"\205\227\377"
+ 902 24bd 8597FF00 		.string	"\205\227\377"
+ 903 24c1 8598FF00 		.string	"\205\230\377"
+ 904 24c5 8598FF00 		.string	"\205\230\377"
+ 905 24c9 8598FF00 		.string	"\205\230\377"
+ 906 24cd 8599FF00 		.string	"\205\231\377"
+ 907 24d1 8599FF00 		.string	"\205\231\377"
+GAS LISTING /tmp/ccMVh1cW.s 			page 43
+
+
+ 908 24d5 869AFF00 		.string	"\206\232\377"
+ 909 24d9 869AFF00 		.string	"\206\232\377"
+ 910 24dd 869BFF00 		.string	"\206\233\377"
+ 911 24e1 869BFF00 		.string	"\206\233\377"
+ 912 24e5 869CFF00 		.string	"\206\234\377"
+ 913 24e9 869CFF00 		.string	"\206\234\377"
+ 914 24ed 869CFF00 		.string	"\206\234\377"
+ 915 24f1 879DFF00 		.string	"\207\235\377"
+ 916 24f5 879DFF00 		.string	"\207\235\377"
+ 917 24f9 879EFF00 		.string	"\207\236\377"
+ 918 24fd 879EFF00 		.string	"\207\236\377"
+ 919 2501 879FFF00 		.string	"\207\237\377"
+ 920 2505 879FFF00 		.string	"\207\237\377"
+ 921 2509 87A0FF00 		.string	"\207\240\377"
+ 922 250d 87A0FF00 		.string	"\207\240\377"
+ 923 2511 88A0FF00 		.string	"\210\240\377"
+ 924 2515 88A1FF00 		.string	"\210\241\377"
+ 925 2519 88A1FF00 		.string	"\210\241\377"
+ 926 251d 88A2FF00 		.string	"\210\242\377"
+ 927 2521 88A2FF00 		.string	"\210\242\377"
+ 928 2525 88A3FF00 		.string	"\210\243\377"
+ 929 2529 88A3FF00 		.string	"\210\243\377"
+ 930 252d 88A4FF00 		.string	"\210\244\377"
+ 931 2531 89A4FF00 		.string	"\211\244\377"
+ 932 2535 89A4FF00 		.string	"\211\244\377"
+ 933 2539 89A5FF00 		.string	"\211\245\377"
+ 934 253d 89A5FF00 		.string	"\211\245\377"
+ 935 2541 89A6FF00 		.string	"\211\246\377"
+ 936 2545 89A6FF00 		.string	"\211\246\377"
+ 937 2549 89A7FF00 		.string	"\211\247\377"
+ 938 254d 89A7FF00 		.string	"\211\247\377"
+ 939 2551 8AA7FF01 		.ascii	"\212\247\377\001\212\250\377\002\212\250\377\003\212\251\377"
+ 939      8AA8FF02 
+ 939      8AA8FF03 
+ 939      8AA9FF
+ 940 2560 048AA9FF 		.ascii	"\004\212\251\377\005\212\252\377\006\212\252\377\007\212\252"
+ 940      058AAAFF 
+ 940      068AAAFF 
+ 940      078AAA
+ 941 256f FF088AAB 		.ascii	"\377\b\212\253\377\t\213\253\377\n\213\254\377\013\213\254\377"
+ 941      FF098BAB 
+ 941      FF0A8BAC 
+ 941      FF0B8BAC 
+ 941      FF
+ 942 2580 0C8BADFF 		.ascii	"\f\213\255\377\r\213\255\377\016\213\255\377\017\213\256\377"
+ 942      0D8BADFF 
+ 942      0E8BADFF 
+ 942      0F8BAEFF 
+ 943 2590 108BAEFF 		.ascii	"\020\213\256\377\021\213\257\377\022\214\257\377\023\214\257"
+ 943      118BAFFF 
+ 943      128CAFFF 
+ 943      138CAF
+ 944 259f FF148CB0 		.ascii	"\377\024\214\260\377\025\214\260\377\026\214\261\377\027\214"
+ 944      FF158CB0 
+ 944      FF168CB1 
+ 944      FF178C
+ 945 25ae B1FF188C 		.ascii	"\261\377\030\214\261\377\030\214\262\377\031\214\262\377\032"
+GAS LISTING /tmp/ccMVh1cW.s 			page 44
+
+
+ 945      B1FF188C 
+ 945      B2FF198C 
+ 945      B2FF1A
+ 946 25bd 8CB3FF1B 		.ascii	"\214\263\377\033\215\263\377\034\215\263\377\035\215\264\377"
+ 946      8DB3FF1C 
+ 946      8DB3FF1D 
+ 946      8DB4FF
+ 947 25cc 1E8DB4FF 		.ascii	"\036\215\264\377\036\215\265\377\037\215\265\377 \215\265\377"
+ 947      1E8DB5FF 
+ 947      1F8DB5FF 
+ 947      208DB5FF 
+ 948 25dc 218DB6FF 		.ascii	"!\215\266\377\"\215\266\377\"\215\267\377#\216\267\377$\216\267"
+ 948      228DB6FF 
+ 948      228DB7FF 
+ 948      238EB7FF 
+ 948      248EB7
+ 949 25ef FF258EB8 		.ascii	"\377%\216\270\377&\216\270\377'\216\271\377'\216\271\377(\216"
+ 949      FF268EB8 
+ 949      FF278EB9 
+ 949      FF278EB9 
+ 949      FF288E
+ 950 2602 B9FF298E 		.ascii	"\271\377)\216\272\377*\216\272\377*\216\272\377+\216\273\377"
+ 950      BAFF2A8E 
+ 950      BAFF2A8E 
+ 950      BAFF2B8E 
+ 950      BBFF
+ 951 2614 2C8FBBFF 		.ascii	",\217\273\377-\217\274\377.\217\274\377.\217\274\377/\217\275"
+ 951      2D8FBCFF 
+ 951      2E8FBCFF 
+ 951      2E8FBCFF 
+ 951      2F8FBD
+ 952 2627 FF308FBD 		.ascii	"\3770\217\275\3771\217\275\3772\217\276\3772\217\276\3773\217"
+ 952      FF318FBD 
+ 952      FF328FBE 
+ 952      FF328FBE 
+ 952      FF338F
+ 953 263a BEFF348F 		.ascii	"\276\3774\217\277\3775\217\277\3776\220\300\3776\220\300\377"
+ 953      BFFF358F 
+ 953      BFFF3690 
+ 953      C0FF3690 
+ 953      C0FF
+ 954 264c 3690C0FF 		.ascii	"6\220\300\3777\220\300\3777\220\300\3778\220\300\3778\221\300"
+ 954      3790C0FF 
+ 954      3790C0FF 
+ 954      3890C0FF 
+ 954      3891C0
+ 955 265f FF3991C0 		.ascii	"\3779\221\300\3779\221\300\377:\221\301\377:\221\301\377;\222"
+ 955      FF3991C0 
+ 955      FF3A91C1 
+ 955      FF3A91C1 
+ 955      FF3B92
+ 956 2672 C1FF3B92 		.ascii	"\301\377;\222\301\377;\222\301\377<\222\301\377<\222\301\377"
+ 956      C1FF3B92 
+ 956      C1FF3C92 
+ 956      C1FF3C92 
+ 956      C1FF
+ 957 2684 3D93C1FF 		.ascii	"=\223\301\377=\223\301\377>\223\302\377>\223\302\377>\223\302"
+GAS LISTING /tmp/ccMVh1cW.s 			page 45
+
+
+ 957      3D93C1FF 
+ 957      3E93C2FF 
+ 957      3E93C2FF 
+ 957      3E93C2
+ 958 2697 FF3F94C2 		.ascii	"\377?\224\302\377?\224\302\377@\224\302\377@\224\302\377A\224"
+ 958      FF3F94C2 
+ 958      FF4094C2 
+ 958      FF4094C2 
+ 958      FF4194
+ 959 26aa C2FF4195 		.ascii	"\302\377A\225\303\377A\225\303\377B\225\303\377B\225\303\377"
+ 959      C3FF4195 
+ 959      C3FF4295 
+ 959      C3FF4295 
+ 959      C3FF
+ 960 26bc 4395C3FF 		.ascii	"C\225\303\377C\226\303\377D\226\303\377D\226\303\377D\226\303"
+ 960      4396C3FF 
+ 960      4496C3FF 
+ 960      4496C3FF 
+ 960      4496C3
+ 961 26cf FF4596C4 		.ascii	"\377E\226\304\377E\226\304\377F\227\304\377F\227\304\377F\227"
+ 961      FF4596C4 
+ 961      FF4697C4 
+ 961      FF4697C4 
+ 961      FF4697
+ 962 26e2 C4FF4797 		.ascii	"\304\377G\227\304\377G\227\304\377H\230\304\377H\230\305\377"
+ 962      C4FF4797 
+ 962      C4FF4898 
+ 962      C4FF4898 
+ 962      C5FF
+ 963 26f4 4898C5FF 		.ascii	"H\230\305\377I\230\305\377I\230\305\377I\231\305\377J\231\305"
+ 963      4998C5FF 
+ 963      4998C5FF 
+ 963      4999C5FF 
+ 963      4A99C5
+ 964 2707 FF4A99C5 		.ascii	"\377J\231\305\377K\231\305\377K\231\305\377K\232\306\377L\232"
+ 964      FF4B99C5 
+ 964      FF4B99C5 
+ 964      FF4B9AC6 
+ 964      FF4C9A
+ 965 271a C6FF4C9A 		.ascii	"\306\377L\232\306\377M\232\306\377M\232\306\377M\233\306\377"
+ 965      C6FF4D9A 
+ 965      C6FF4D9A 
+ 965      C6FF4D9B 
+ 965      C6FF
+ 966 272c 4E9BC6FF 		.ascii	"N\233\306\377N\233\306\377N\233\306\377O\233\307\377O\234\307"
+ 966      4E9BC6FF 
+ 966      4E9BC6FF 
+ 966      4F9BC7FF 
+ 966      4F9CC7
+ 967 273f FF509CC7 		.ascii	"\377P\234\307\377P\234\307\377P\234\307\377Q\234\307\377Q\235"
+ 967      FF509CC7 
+ 967      FF509CC7 
+ 967      FF519CC7 
+ 967      FF519D
+ 968 2752 C7FF519D 		.ascii	"\307\377Q\235\307\377R\235\310\377R\235\310\377S\235\310\377"
+ 968      C7FF529D 
+ 968      C8FF529D 
+GAS LISTING /tmp/ccMVh1cW.s 			page 46
+
+
+ 968      C8FF539D 
+ 968      C8FF
+ 969 2764 539EC8FF 		.ascii	"S\236\310\377S\236\310\377T\236\310\377T\236\310\377T\236\310"
+ 969      539EC8FF 
+ 969      549EC8FF 
+ 969      549EC8FF 
+ 969      549EC8
+ 970 2777 FF559EC8 		.ascii	"\377U\236\310\377U\237\311\377U\237\311\377V\237\311\377V\237"
+ 970      FF559FC9 
+ 970      FF559FC9 
+ 970      FF569FC9 
+ 970      FF569F
+ 971 278a C9FF579F 		.ascii	"\311\377W\237\311\377W\240\311\377W\240\311\377X\240\311\377"
+ 971      C9FF57A0 
+ 971      C9FF57A0 
+ 971      C9FF58A0 
+ 971      C9FF
+ 972 279c 58A0CAFF 		.ascii	"X\240\312\377X\240\312\377Y\241\312\377Y\241\312\377Y\241\312"
+ 972      58A0CAFF 
+ 972      59A1CAFF 
+ 972      59A1CAFF 
+ 972      59A1CA
+ 973 27af FF5AA1CA 		.ascii	"\377Z\241\312\377Z\241\312\377Z\242\312\377[\242\312\377[\242"
+ 973      FF5AA1CA 
+ 973      FF5AA2CA 
+ 973      FF5BA2CA 
+ 973      FF5BA2
+ 974 27c2 CBFF5CA2 		.ascii	"\313\377\\\242\313\377\\\242\313\377\\\243\313\377]\243\313\377"
+ 974      CBFF5CA2 
+ 974      CBFF5CA3 
+ 974      CBFF5DA3 
+ 974      CBFF
+ 975 27d4 5DA3CBFF 		.ascii	"]\243\313\377]\243\313\377^\243\313\377^\244\314\377^\244\314"
+ 975      5DA3CBFF 
+ 975      5EA3CBFF 
+ 975      5EA4CCFF 
+ 975      5EA4CC
+ 976 27e7 FF5FA4CC 		.ascii	"\377_\244\314\377_\244\314\377_\244\314\377`\245\314\377`\245"
+ 976      FF5FA4CC 
+ 976      FF5FA4CC 
+ 976      FF60A5CC 
+ 976      FF60A5
+ 977 27fa CCFF60A5 		.ascii	"\314\377`\245\314\377a\245\314\377a\245\315\377a\246\315\377"
+ 977      CCFF61A5 
+ 977      CCFF61A5 
+ 977      CDFF61A6 
+ 977      CDFF
+ 978 280c 62A6CDFF 		.ascii	"b\246\315\377"
+ 979 2810 62A6CDFF 		.ascii	"b\246\315\377b\246\315\377c\246\315\377c\247\315\377c\247\315"
+ 979      62A6CDFF 
+ 979      63A6CDFF 
+ 979      63A7CDFF 
+ 979      63A7CD
+ 980 2823 FF64A7CE 		.ascii	"\377d\247\316\377d\247\316\377d\247\316\377e\250\316\377e\250"
+ 980      FF64A7CE 
+ 980      FF64A7CE 
+ 980      FF65A8CE 
+GAS LISTING /tmp/ccMVh1cW.s 			page 47
+
+
+ 980      FF65A8
+ 981 2836 CEFF65A8 		.ascii	"\316\377e\250\316\377f\250\316\377f\250\316\377g\251\317\377"
+ 981      CEFF66A8 
+ 981      CEFF66A8 
+ 981      CEFF67A9 
+ 981      CFFF
+ 982 2848 67A9CFFF 		.ascii	"g\251\317\377h\251\317\377h\251\317\377i\251\317\377i\251\317"
+ 982      68A9CFFF 
+ 982      68A9CFFF 
+ 982      69A9CFFF 
+ 982      69A9CF
+ 983 285b FF6AA9CF 		.ascii	"\377j\251\317\377k\252\317\377k\252\317\377l\252\320\377l\252"
+ 983      FF6BAACF 
+ 983      FF6BAACF 
+ 983      FF6CAAD0 
+ 983      FF6CAA
+ 984 286e D0FF6DAA 		.ascii	"\320\377m\252\320\377n\252\320\377n\252\320\377o\253\320\377"
+ 984      D0FF6EAA 
+ 984      D0FF6EAA 
+ 984      D0FF6FAB 
+ 984      D0FF
+ 985 2880 6FABD0FF 		.ascii	"o\253\320\377p\253\320\377p\253\321\377q\253\321\377r\253\321"
+ 985      70ABD0FF 
+ 985      70ABD1FF 
+ 985      71ABD1FF 
+ 985      72ABD1
+ 986 2893 FF72ABD1 		.ascii	"\377r\253\321\377s\254\321\377s\254\321\377t\254\321\377t\254"
+ 986      FF73ACD1 
+ 986      FF73ACD1 
+ 986      FF74ACD1 
+ 986      FF74AC
+ 987 28a6 D1FF75AC 		.ascii	"\321\377u\254\321\377u\254\322\377v\255\322\377w\255\322\377"
+ 987      D1FF75AC 
+ 987      D2FF76AD 
+ 987      D2FF77AD 
+ 987      D2FF
+ 988 28b8 77ADD2FF 		.ascii	"w\255\322\377x\255\322\377x\255\322\377y\255\322\377y\255\322"
+ 988      78ADD2FF 
+ 988      78ADD2FF 
+ 988      79ADD2FF 
+ 988      79ADD2
+ 989 28cb FF7AAED2 		.ascii	"\377z\256\322\377z\256\322\377{\256\323\377{\256\323\377|\256"
+ 989      FF7AAED2 
+ 989      FF7BAED3 
+ 989      FF7BAED3 
+ 989      FF7CAE
+ 990 28de D3FF7CAE 		.ascii	"\323\377|\256\323\377}\256\323\377}\257\323\377~\257\323\377"
+ 990      D3FF7DAE 
+ 990      D3FF7DAF 
+ 990      D3FF7EAF 
+ 990      D3FF
+ 991 28f0 7EAFD3FF 		.ascii	"~\257\323\377\177\257\323\377\200\257\324\377\200\257\324\377"
+ 991      7FAFD3FF 
+ 991      80AFD4FF 
+ 991      80AFD4FF 
+ 992 2900 81B0D4FF 		.ascii	"\201\260\324\377\201\260\324\377\202\260\324\377\202\260\324"
+ 992      81B0D4FF 
+GAS LISTING /tmp/ccMVh1cW.s 			page 48
+
+
+ 992      82B0D4FF 
+ 992      82B0D4
+ 993 290f FF83B0D4 		.ascii	"\377\203\260\324\377\203\260\324\377\204\260\324\377\204\261"
+ 993      FF83B0D4 
+ 993      FF84B0D4 
+ 993      FF84B1
+ 994 291e D4FF85B1 		.ascii	"\324\377\205\261\325\377\205\261\325\377\206\261\325\377\206"
+ 994      D5FF85B1 
+ 994      D5FF86B1 
+ 994      D5FF86
+ 995 292d B1D5FF87 		.ascii	"\261\325\377\207\261\325\377\207\262\325\377\210\262\325\377"
+ 995      B1D5FF87 
+ 995      B2D5FF88 
+ 995      B2D5FF
+ 996 293c 88B2D5FF 		.ascii	"\210\262\325\377\211\262\325\377\211\262\325\377\211\262\325"
+ 996      89B2D5FF 
+ 996      89B2D5FF 
+ 996      89B2D5
+ 997 294b FF8AB2D6 		.ascii	"\377\212\262\326\377\212\263\326\377\213\263\326\377\213\263"
+ 997      FF8AB3D6 
+ 997      FF8BB3D6 
+ 997      FF8BB3
+ 998 295a D6FF8CB3 		.ascii	"\326\377\214\263\326\377\214\263\326\377\215\263\326\377\215"
+ 998      D6FF8CB3 
+ 998      D6FF8DB3 
+ 998      D6FF8D
+ 999 2969 B4D6FF8E 		.ascii	"\264\326\377\216\264\326\377\216\264\326\377\217\264\326\377"
+ 999      B4D6FF8E 
+ 999      B4D6FF8F 
+ 999      B4D6FF
+ 1000 2978 8FB4D7FF 		.ascii	"\217\264\327\377\220\264\327\377\220\265\327\377\221\265\327"
+ 1000      90B4D7FF 
+ 1000      90B5D7FF 
+ 1000      91B5D7
+ 1001 2987 FF91B5D7 		.ascii	"\377\221\265\327\377\222\265\327\377\222\265\327\377\222\265"
+ 1001      FF92B5D7 
+ 1001      FF92B5D7 
+ 1001      FF92B5
+ 1002 2996 D7FF93B5 		.ascii	"\327\377\223\265\327\377\223\266\327\377\224\266\327\377\224"
+ 1002      D7FF93B6 
+ 1002      D7FF94B6 
+ 1002      D7FF94
+ 1003 29a5 B6D7FF95 		.ascii	"\266\327\377\225\266\330\377\225\266\330\377\226\266\330\377"
+ 1003      B6D8FF95 
+ 1003      B6D8FF96 
+ 1003      B6D8FF
+ 1004 29b4 96B7D8FF 		.ascii	"\226\267\330\377\227\267\330\377\227\267\330\377\227\267\330"
+ 1004      97B7D8FF 
+ 1004      97B7D8FF 
+ 1004      97B7D8
+ 1005 29c3 FF98B7D8 		.ascii	"\377\230\267\330\377\230\267\330\377\231\270\330\377\231\270"
+ 1005      FF98B7D8 
+ 1005      FF99B8D8 
+ 1005      FF99B8
+ 1006 29d2 D8FF9AB8 		.ascii	"\330\377\232\270\330\377\232\270\331\377\233\270\331\377\233"
+ 1006      D8FF9AB8 
+ 1006      D9FF9BB8 
+GAS LISTING /tmp/ccMVh1cW.s 			page 49
+
+
+ 1006      D9FF9B
+ 1007 29e1 B8D9FF9B 		.ascii	"\270\331\377\233\271\331\377\234\271\331\377\234\271\331\377"
+ 1007      B9D9FF9C 
+ 1007      B9D9FF9C 
+ 1007      B9D9FF
+ 1008 29f0 9DB9D9FF 		.ascii	"\235\271\331\377\235\271\331\377\236\271\331\377\236\272\331"
+ 1008      9DB9D9FF 
+ 1008      9EB9D9FF 
+ 1008      9EBAD9
+ 1009 29ff FF9EBAD9 		.ascii	"\377\236\272\331\377\237\272\331\377\237\272\331\377\240\272"
+ 1009      FF9FBAD9 
+ 1009      FF9FBAD9 
+ 1009      FFA0BA
+ 1010 2a0e D9FFA0BA 		.ascii	"\331\377\240\272\332\377\241\272\332\377\241\273\332\377\241"
+ 1010      DAFFA1BA 
+ 1010      DAFFA1BB 
+ 1010      DAFFA1
+ 1011 2a1d BBDAFFA2 		.ascii	"\273\332\377\242\273\332\377\242\273\332\377\243\273\332\377"
+ 1011      BBDAFFA2 
+ 1011      BBDAFFA3 
+ 1011      BBDAFF
+ 1012 2a2c A3BBDAFF 		.ascii	"\243\273\332\377\243\274\332\377\244\274\332\377\244\274\332"
+ 1012      A3BCDAFF 
+ 1012      A4BCDAFF 
+ 1012      A4BCDA
+ 1013 2a3b FFA5BCDA 		.ascii	"\377\245\274\332\377\245\274\332\377\245\275\332\377\246\275"
+ 1013      FFA5BCDA 
+ 1013      FFA5BDDA 
+ 1013      FFA6BD
+ 1014 2a4a DBFFA6BD 		.ascii	"\333\377\246\275\333\377\247\275\333\377\247\275\333\377\247"
+ 1014      DBFFA7BD 
+ 1014      DBFFA7BD 
+ 1014      DBFFA7
+ 1015 2a59 BDDBFFA8 		.ascii	"\275\333\377\250\275\333\377\250\276\333\377\250\276\333\377"
+ 1015      BDDBFFA8 
+ 1015      BEDBFFA8 
+ 1015      BEDBFF
+ 1016 2a68 A9BEDBFF 		.ascii	"\251\276\333\377\251\276\334\377\252\276\334\377\252\276\334"
+ 1016      A9BEDCFF 
+ 1016      AABEDCFF 
+ 1016      AABEDC
+ 1017 2a77 FFAABEDC 		.ascii	"\377\252\276\334\377\253\277\334\377\253\277\334\377\253\277"
+ 1017      FFABBFDC 
+ 1017      FFABBFDC 
+ 1017      FFABBF
+ 1018 2a86 DCFFACBF 		.ascii	"\334\377\254\277\334\377\254\277\334\377\254\277\334\377\255"
+ 1018      DCFFACBF 
+ 1018      DCFFACBF 
+ 1018      DCFFAD
+ 1019 2a95 BFDCFFAD 		.ascii	"\277\334\377\255\300\335\377\256\300\335\377\256\300\335\377"
+ 1019      C0DDFFAE 
+ 1019      C0DDFFAE 
+ 1019      C0DDFF
+ 1020 2aa4 AEC0DDFF 		.ascii	"\256\300\335\377\257\300\335\377\257\300\335\377\257\300\335"
+ 1020      AFC0DDFF 
+ 1020      AFC0DDFF 
+ 1020      AFC0DD
+GAS LISTING /tmp/ccMVh1cW.s 			page 50
+
+
+ 1021 2ab3 FFB0C1DD 		.ascii	"\377\260\301\335\377\260\301\335\377\260\301\335\377\261\301"
+ 1021      FFB0C1DD 
+ 1021      FFB0C1DD 
+ 1021      FFB1C1
+ 1022 2ac2 DEFFB1C1 		.ascii	"\336\377\261\301\336\377\261\301\336\377\262\301\336\377\262"
+ 1022      DEFFB1C1 
+ 1022      DEFFB2C1 
+ 1022      DEFFB2
+ 1023 2ad1 C2DEFFB3 		.ascii	"\302\336\377\263\302\336\377\263\302\336\377\263\302\336\377"
+ 1023      C2DEFFB3 
+ 1023      C2DEFFB3 
+ 1023      C2DEFF
+ 1024 2ae0 B4C2DEFF 		.ascii	"\264\302\336\377\264\302\336\377\264\303\336\377\265\303\337"
+ 1024      B4C2DEFF 
+ 1024      B4C3DEFF 
+ 1024      B5C3DF
+ 1025 2aef FFB5C3DF 		.ascii	"\377\265\303\337\377\265\303\337\377\266\303\337\377\266\303"
+ 1025      FFB5C3DF 
+ 1025      FFB6C3DF 
+ 1025      FFB6C3
+ 1026 2afe DFFFB6C3 		.ascii	"\337\377\266\303\337\377\267\304\337\377\267\304\337\377\267"
+ 1026      DFFFB7C4 
+ 1026      DFFFB7C4 
+ 1026      DFFFB7
+ 1027 2b0d C4DFFFB8 		.ascii	"\304\337\377\270\304\337\377\270\304\337\377\270\304\337\377"
+ 1027      C4DFFFB8 
+ 1027      C4DFFFB8 
+ 1027      C4DFFF
+ 1028 2b1c B9C5E0FF 		.ascii	"\271\305\340\377\271\305\340\377\271\305\340\377\272\305\340"
+ 1028      B9C5E0FF 
+ 1028      B9C5E0FF 
+ 1028      BAC5E0
+ 1029 2b2b FFBAC5E0 		.ascii	"\377\272\305\340\377\272\305\340\377\273\305\340\377\273\306"
+ 1029      FFBAC5E0 
+ 1029      FFBBC5E0 
+ 1029      FFBBC6
+ 1030 2b3a E0FFBBC6 		.ascii	"\340\377\273\306\340\377\274\306\340\377\274\306\340\377\274"
+ 1030      E0FFBCC6 
+ 1030      E0FFBCC6 
+ 1030      E0FFBC
+ 1031 2b49 C6E0FFBD 		.ascii	"\306\340\377\275\306\341\377\275\307\341\377\275\307\341\377"
+ 1031      C6E1FFBD 
+ 1031      C7E1FFBD 
+ 1031      C7E1FF
+ 1032 2b58 BEC7E1FF 		.ascii	"\276\307\341\377\276\307\341\377\276\307\341\377\277\307\341"
+ 1032      BEC7E1FF 
+ 1032      BEC7E1FF 
+ 1032      BFC7E1
+ 1033 2b67 FFBFC7E1 		.ascii	"\377\277\307\341\377\277\310\341\377\300\310\341\377\300\310"
+ 1033      FFBFC8E1 
+ 1033      FFC0C8E1 
+ 1033      FFC0C8
+ 1034 2b76 E1FFC0C8 		.ascii	"\341\377\300\310\341\377\301\310\342\377\301\310\342\377\301"
+ 1034      E1FFC1C8 
+ 1034      E2FFC1C8 
+ 1034      E2FFC1
+ 1035 2b85 C9E2FFC1 		.ascii	"\311\342\377\301\311\342\377\302\311\342\377\302\311\342\377"
+GAS LISTING /tmp/ccMVh1cW.s 			page 51
+
+
+ 1035      C9E2FFC2 
+ 1035      C9E2FFC2 
+ 1035      C9E2FF
+ 1036 2b94 C2C9E2FF 		.ascii	"\302\311\342\377\303\311\342\377\303\312\342\377\303\312\342"
+ 1036      C3C9E2FF 
+ 1036      C3CAE2FF 
+ 1036      C3CAE2
+ 1037 2ba3 FFC4CAE2 		.ascii	"\377\304\312\342\377\304\312\342\377\304\312\343\377\305\312"
+ 1037      FFC4CAE2 
+ 1037      FFC4CAE3 
+ 1037      FFC5CA
+ 1038 2bb2 E3FFC5CB 		.ascii	"\343\377\305\313\343\377\305\313\343\377\306\313\343\377\306"
+ 1038      E3FFC5CB 
+ 1038      E3FFC6CB 
+ 1038      E3FFC6
+ 1039 2bc1 CBE3FFC6 		.ascii	"\313\343\377\306\313\343\377\306\313\343\377\307\313\343\377"
+ 1039      CBE3FFC6 
+ 1039      CBE3FFC7 
+ 1039      CBE3FF
+ 1040 2bd0 C7CCE3FF 		.ascii	"\307\314\343\377\307\314\343\377\310\314\343\377\310\314\343"
+ 1040      C7CCE3FF 
+ 1040      C8CCE3FF 
+ 1040      C8CCE3
+ 1041 2bdf FFC8CCE4 		.ascii	"\377\310\314\344\377\311\314\344\377\311\315\344\377\311\315"
+ 1041      FFC9CCE4 
+ 1041      FFC9CDE4 
+ 1041      FFC9CD
+ 1042 2bee E4FFC9CD 		.ascii	"\344\377\311\315\344\377\312\315\344\377\312\315\344\377\312"
+ 1042      E4FFCACD 
+ 1042      E4FFCACD 
+ 1042      E4FFCA
+ 1043 2bfd CDE4FFCB 		.ascii	"\315\344\377\313\316\344\377\313\316\344\377\313\316\344\377"
+ 1043      CEE4FFCB 
+ 1043      CEE4FFCB 
+ 1043      CEE4FF
+ 1044 2c0c CCCEE4FF 		.ascii	"\314\316\344\377\314\316\344\377\314\316\345\377\314\317\345"
+ 1044      CCCEE4FF 
+ 1044      CCCEE5FF 
+ 1044      CCCFE5
+ 1045 2c1b FFCDCFE5 		.ascii	"\377\315\317\345\377\315\317\345\377\315\317\345\377\316\317"
+ 1045      FFCDCFE5 
+ 1045      FFCDCFE5 
+ 1045      FFCECF
+ 1046 2c2a E5FFCECF 		.ascii	"\345\377\316\317\345\377\316\320\345\377\316\320\345\377\317"
+ 1046      E5FFCED0 
+ 1046      E5FFCED0 
+ 1046      E5FFCF
+ 1047 2c39 D0E5FFCF 		.ascii	"\320\345\377\317\320\345\377\317\320\345\377\317\321\345\377"
+ 1047      D0E5FFCF 
+ 1047      D0E5FFCF 
+ 1047      D1E5FF
+ 1048 2c48 D0D1E6FF 		.ascii	"\320\321\346\377\320\321\346\377\320\321\346\377\320\321\346"
+ 1048      D0D1E6FF 
+ 1048      D0D1E6FF 
+ 1048      D0D1E6
+ 1049 2c57 FFD1D1E6 		.ascii	"\377\321\321\346\377\321\321\346\377\321\321\346\377\321\321"
+ 1049      FFD1D1E6 
+GAS LISTING /tmp/ccMVh1cW.s 			page 52
+
+
+ 1049      FFD1D1E6 
+ 1049      FFD1D1
+ 1050 2c66 E6FFD2D2 		.ascii	"\346\377\322\322\346\377\322\322\346\377\322\322\346\377\322"
+ 1050      E6FFD2D2 
+ 1050      E6FFD2D2 
+ 1050      E6FFD2
+ 1051 2c75 D2E6FFD3 		.ascii	"\322\346\377\323\322\347\377\323\322\347\377\323\322\347\377"
+ 1051      D2E7FFD3 
+ 1051      D2E7FFD3 
+ 1051      D2E7FF
+ 1052 2c84 D3D2E7FF 		.ascii	"\323\322\347\377\324\323\347\377\324\323\347\377\324\323\347"
+ 1052      D4D3E7FF 
+ 1052      D4D3E7FF 
+ 1052      D4D3E7
+ 1053 2c93 FFD4D3E7 		.ascii	"\377\324\323\347\377\325\323\347\377\325\323\347\377\325\323"
+ 1053      FFD5D3E7 
+ 1053      FFD5D3E7 
+ 1053      FFD5D3
+ 1054 2ca2 E7FFD5D4 		.ascii	"\347\377\325\324\347\377\326\324\350\377\326\324\350\377\326"
+ 1054      E7FFD6D4 
+ 1054      E8FFD6D4 
+ 1054      E8FFD6
+ 1055 2cb1 D4E8FFD6 		.ascii	"\324\350\377\326\324\350\377\326\324\350\377\327\324\350\377"
+ 1055      D4E8FFD6 
+ 1055      D4E8FFD7 
+ 1055      D4E8FF
+ 1056 2cc0 D7D4E8FF 		.ascii	"\327\324\350\377\327\325\350\377\327\325\350\377\330\325\350"
+ 1056      D7D5E8FF 
+ 1056      D7D5E8FF 
+ 1056      D8D5E8
+ 1057 2ccf FFD8D5E8 		.ascii	"\377\330\325\350\377\330\325\350\377\330\325\350\377\331\325"
+ 1057      FFD8D5E8 
+ 1057      FFD8D5E8 
+ 1057      FFD9D5
+ 1058 2cde E9FFD9D5 		.ascii	"\351\377\331\325\351\377\331\326\351\377\331\326\351\377\331"
+ 1058      E9FFD9D6 
+ 1058      E9FFD9D6 
+ 1058      E9FFD9
+ 1059 2ced D6E9FFDA 		.ascii	"\326\351\377\332\326\351\377\332\326\351\377\332\326\351\377"
+ 1059      D6E9FFDA 
+ 1059      D6E9FFDA 
+ 1059      D6E9FF
+ 1060 2cfc DAD6E9FF 		.ascii	"\332\326\351\377\333\326\351\377\333\327\351\377\333\327\351"
+ 1060      DBD6E9FF 
+ 1060      DBD7E9FF 
+ 1060      DBD7E9
+ 1061 2d0b FFDBD7EA 		.ascii	"\377\333\327\352\377\333\327\352\377\334\327\352\377\334\327"
+ 1061      FFDBD7EA 
+ 1061      FFDCD7EA 
+ 1061      FFDCD7
+ 1062 2d1a EAFFDCD7 		.ascii	"\352\377\334\327\352\377\334\330\352\377\335\330\352\377\335"
+ 1062      EAFFDCD8 
+ 1062      EAFFDDD8 
+ 1062      EAFFDD
+ 1063 2d29 D8EAFFDD 		.ascii	"\330\352\377\335\330\352\377\335\330\352\377\335\330\352\377"
+ 1063      D8EAFFDD 
+ 1063      D8EAFFDD 
+GAS LISTING /tmp/ccMVh1cW.s 			page 53
+
+
+ 1063      D8EAFF
+ 1064 2d38 DED8EAFF 		.ascii	"\336\330\352\377\336\330\352\377\336\331\353\377\336\331\353"
+ 1064      DED8EAFF 
+ 1064      DED9EBFF 
+ 1064      DED9EB
+ 1065 2d47 FFDFD9EB 		.ascii	"\377\337\331\353\377\337\331\353\377\337\331\353\377\337\331"
+ 1065      FFDFD9EB 
+ 1065      FFDFD9EB 
+ 1065      FFDFD9
+ 1066 2d56 EBFFDFD9 		.ascii	"\353\377\337\331\353\377\340\331\353\377\340\332\353\377\340"
+ 1066      EBFFE0D9 
+ 1066      EBFFE0DA 
+ 1066      EBFFE0
+ 1067 2d65 DAEBFFE0 		.ascii	"\332\353\377\340\332\353\377\341\332\353\377\341\332\353\377"
+ 1067      DAEBFFE1 
+ 1067      DAEBFFE1 
+ 1067      DAEBFF
+ 1068 2d74 E1DAEBFF 		.ascii	"\341\332\353\377\341\332\354\377\341\333\354\377\342\333\354"
+ 1068      E1DAECFF 
+ 1068      E1DBECFF 
+ 1068      E2DBEC
+ 1069 2d83 FFE2DBEC 		.ascii	"\377\342\333\354\377\342\333\354\377\342\333\354\377\342\333"
+ 1069      FFE2DBEC 
+ 1069      FFE2DBEC 
+ 1069      FFE2DB
+ 1070 2d92 ECFFE3DB 		.ascii	"\354\377\343\333\354\377\343\334\354\377\343\334\354\377\343"
+ 1070      ECFFE3DC 
+ 1070      ECFFE3DC 
+ 1070      ECFFE3
+ 1071 2da1 DCECFFE4 		.ascii	"\334\354\377\344\334\354\377\344\334\354\377\344\334\355\377"
+ 1071      DCECFFE4 
+ 1071      DCECFFE4 
+ 1071      DCEDFF
+ 1072 2db0 E4DCEDFF 		.ascii	"\344\334\355\377\344\334\355\377\345\335\355\377\345\335\355"
+ 1072      E4DCEDFF 
+ 1072      E5DDEDFF 
+ 1072      E5DDED
+ 1073 2dbf FFE5DDED 		.ascii	"\377\345\335\355\377\345\335\355\377\345\335\355\377\346\335"
+ 1073      FFE5DDED 
+ 1073      FFE5DDED 
+ 1073      FFE6DD
+ 1074 2dce EDFFE6DD 		.ascii	"\355\377\346\335\355\377\346\336\355\377\346\336\355\377\346"
+ 1074      EDFFE6DE 
+ 1074      EDFFE6DE 
+ 1074      EDFFE6
+ 1075 2ddd DEEDFFE7 		.ascii	"\336\355\377\347\336\356\377\347\336\356\377\347\336\356\377"
+ 1075      DEEEFFE7 
+ 1075      DEEEFFE7 
+ 1075      DEEEFF
+ 1076 2dec E7DEEEFF 		.ascii	"\347\336\356\377\347\337\356\377\350\337\356\377\350\337\356"
+ 1076      E7DFEEFF 
+ 1076      E8DFEEFF 
+ 1076      E8DFEE
+ 1077 2dfb FFE8DFEE 		.ascii	"\377\350\337\356\377\350\337\356\377\350\337\356\377\351\337"
+ 1077      FFE8DFEE 
+ 1077      FFE8DFEE 
+ 1077      FFE9DF
+GAS LISTING /tmp/ccMVh1cW.s 			page 54
+
+
+ 1078 2e0a EEFFE9E0 		.ascii	"\356\377\351\340\356\377\351\340\356\377\351\340\357\377\351"
+ 1078      EEFFE9E0 
+ 1078      EEFFE9E0 
+ 1078      EFFFE9
+ 1079 2e19 E0EFFFEA 		.ascii	"\340\357\377\352\340\357\377\352\340\357\377\352\340\357\377"
+ 1079      E0EFFFEA 
+ 1079      E0EFFFEA 
+ 1079      E0EFFF
+ 1080 2e28 EAE1EFFF 		.ascii	"\352\341\357\377\352\341\357\377\353\341\357\377\353\341\357"
+ 1080      EAE1EFFF 
+ 1080      EBE1EFFF 
+ 1080      EBE1EF
+ 1081 2e37 FFEBE1EF 		.ascii	"\377\353\341\357\377\353\341\357\377\353\341\357\377\353\342"
+ 1081      FFEBE1EF 
+ 1081      FFEBE1EF 
+ 1081      FFEBE2
+ 1082 2e46 EFFFECE2 		.ascii	"\357\377\354\342\360\377\354\342\360\377\354\342\360\377\354"
+ 1082      F0FFECE2 
+ 1082      F0FFECE2 
+ 1082      F0FFEC
+ 1083 2e55 E2F0FFEC 		.ascii	"\342\360\377\354\342\360\377\355\342\360\377\355\343\360\377"
+ 1083      E2F0FFED 
+ 1083      E2F0FFED 
+ 1083      E3F0FF
+ 1084 2e64 EDE3F0FF 		.ascii	"\355\343\360\377\355\343\360\377\355\343\360\377\356\343\360"
+ 1084      EDE3F0FF 
+ 1084      EDE3F0FF 
+ 1084      EEE3F0
+ 1085 2e73 FFEEE3F0 		.ascii	"\377\356\343\360\377\356\344\360\377\356\344\360\377\356\344"
+ 1085      FFEEE4F0 
+ 1085      FFEEE4F0 
+ 1085      FFEEE4
+ 1086 2e82 F1FFEEE4 		.ascii	"\361\377\356\344\361\377\357\344\361\377\357\344\361\377\357"
+ 1086      F1FFEFE4 
+ 1086      F1FFEFE4 
+ 1086      F1FFEF
+ 1087 2e91 E4F1FFEF 		.ascii	"\344\361\377\357\345\361\377\357\345\361\377\357\345\361\377"
+ 1087      E5F1FFEF 
+ 1087      E5F1FFEF 
+ 1087      E5F1FF
+ 1088 2ea0 F0E5F1FF 		.ascii	"\360\345\361\377\360\345\361\377\360\345\361\377\360\346\361"
+ 1088      F0E5F1FF 
+ 1088      F0E5F1FF 
+ 1088      F0E6F1
+ 1089 2eaf FFF0E6F1 		.ascii	"\377\360\346\361\377\360\346\361\377\361\346\362\377\361\346"
+ 1089      FFF0E6F1 
+ 1089      FFF1E6F2 
+ 1089      FFF1E6
+ 1090 2ebe F2FFF1E6 		.ascii	"\362\377\361\346\362\377\361\346\362\377\361\347\362\377\361"
+ 1090      F2FFF1E6 
+ 1090      F2FFF1E7 
+ 1090      F2FFF1
+ 1091 2ecd E7F2FFF2 		.ascii	"\347\362\377\362\347\362\377\362\347\362\377\362\347\362\377"
+ 1091      E7F2FFF2 
+ 1091      E7F2FFF2 
+ 1091      E7F2FF
+ 1092 2edc F2E7F2FF 		.ascii	"\362\347\362\377\362\350\362\377\362\350\362\377\363\350\362"
+GAS LISTING /tmp/ccMVh1cW.s 			page 55
+
+
+ 1092      F2E8F2FF 
+ 1092      F2E8F2FF 
+ 1092      F3E8F2
+ 1093 2eeb FFF3E8F2 		.ascii	"\377\363\350\362\377\363\350\363\377\363\350\363\377\363\351"
+ 1093      FFF3E8F3 
+ 1093      FFF3E8F3 
+ 1093      FFF3E9
+ 1094 2efa F3FFF3E9 		.ascii	"\363\377\363\351\363\377\364\351\363\377\364\351\363\377\364"
+ 1094      F3FFF4E9 
+ 1094      F3FFF4E9 
+ 1094      F3FFF4
+ 1095 2f09 E9F3FFF4 		.ascii	"\351\363\377\364\351\363\377\364\352\363\377\364\352\363\377"
+ 1095      E9F3FFF4 
+ 1095      EAF3FFF4 
+ 1095      EAF3FF
+ 1096 2f18 F5EAF3FF 		.ascii	"\365\352\363\377\365\352\363\377\365\352\364\377\365\352\364"
+ 1096      F5EAF3FF 
+ 1096      F5EAF4FF 
+ 1096      F5EAF4
+ 1097 2f27 FFF5EBF4 		.ascii	"\377\365\353\364\377\365\353\364\377\365\353\364\377\366\353"
+ 1097      FFF5EBF4 
+ 1097      FFF5EBF4 
+ 1097      FFF6EB
+ 1098 2f36 F4FFF6EB 		.ascii	"\364\377\366\353\364\377\366\353\364\377\366\353\364\377\366"
+ 1098      F4FFF6EB 
+ 1098      F4FFF6EB 
+ 1098      F4FFF6
+ 1099 2f45 ECF4FFF6 		.ascii	"\354\364\377\366\354\364\377\366\354\364\377\367\354\365\377"
+ 1099      ECF4FFF6 
+ 1099      ECF4FFF7 
+ 1099      ECF5FF
+ 1100 2f54 F7ECF5FF 		.ascii	"\367\354\365\377\367\354\365\377\367\355\365\377\367\355\365"
+ 1100      F7ECF5FF 
+ 1100      F7EDF5FF 
+ 1100      F7EDF5
+ 1101 2f63 FFF7EDF5 		.ascii	"\377\367\355\365\377\367\355\365\377\370\355\365\377\370\355"
+ 1101      FFF7EDF5 
+ 1101      FFF8EDF5 
+ 1101      FFF8ED
+ 1102 2f72 F5FFF8EE 		.ascii	"\365\377\370\356\365\377\370\356\365\377\370\356\365\377\370"
+ 1102      F5FFF8EE 
+ 1102      F5FFF8EE 
+ 1102      F5FFF8
+ 1103 2f81 EEF6FFF8 		.ascii	"\356\366\377\370\356\366\377\371\356\366\377\371\357\366\377"
+ 1103      EEF6FFF9 
+ 1103      EEF6FFF9 
+ 1103      EFF6FF
+ 1104 2f90 F9EFF6FF 		.ascii	"\371\357\366\377\371\357\366\377\371\357\366\377\371\357\366"
+ 1104      F9EFF6FF 
+ 1104      F9EFF6FF 
+ 1104      F9EFF6
+ 1105 2f9f FFF9EFF6 		.ascii	"\377\371\357\366\377\372\360\366\377\372\360\366\377\372\360"
+ 1105      FFFAF0F6 
+ 1105      FFFAF0F6 
+ 1105      FFFAF0
+ 1106 2fae F7FFFAF0 		.ascii	"\367\377\372\360\367\377\372\360\367\377\372\361\367\377\372"
+ 1106      F7FFFAF0 
+GAS LISTING /tmp/ccMVh1cW.s 			page 56
+
+
+ 1106      F7FFFAF1 
+ 1106      F7FFFA
+ 1107 2fbd F1F7FFFA 		.ascii	"\361\367\377\372\361\367\377\373\361\367\377\373\361\367\377"
+ 1107      F1F7FFFB 
+ 1107      F1F7FFFB 
+ 1107      F1F7FF
+ 1108 2fcc FBF1F7FF 		.ascii	"\373\361\367\377\373\362\367\377\373\362\370\377\373\362\370"
+ 1108      FBF2F7FF 
+ 1108      FBF2F8FF 
+ 1108      FBF2F8
+ 1109 2fdb FFFBF2F8 		.ascii	"\377\373\362\370\377"
+ 1109      FF
+ 1110 2fe0 FCF2F8FF 		.ascii	"\374\362\370\377\374\362\370\377\374\363\370\377\374\363\370"
+ 1110      FCF2F8FF 
+ 1110      FCF3F8FF 
+ 1110      FCF3F8
+ 1111 2fef FFFCF3F8 		.ascii	"\377\374\363\370\377\374\363\370\377\374\363\370\377\374\363"
+ 1111      FFFCF3F8 
+ 1111      FFFCF3F8 
+ 1111      FFFCF3
+ 1112 2ffe F9FFFCF4 		.ascii	"\371\377\374\364\371\377\375\364\371\377\375\364\371\377\375"
+ 1112      F9FFFDF4 
+ 1112      F9FFFDF4 
+ 1112      F9FFFD
+ 1113 300d F4F9FFFD 		.ascii	"\364\371\377\375\364\371\377\375\364\371\377\375\365\371\377"
+ 1113      F4F9FFFD 
+ 1113      F4F9FFFD 
+ 1113      F5F9FF
+ 1114 301c FDF5F9FF 		.ascii	"\375\365\371\377\375\365\372\377\376\365\372\377\376\365\372"
+ 1114      FDF5FAFF 
+ 1114      FEF5FAFF 
+ 1114      FEF5FA
+ 1115 302b FFFEF5FA 		.ascii	"\377\376\365\372\377\376\366\372\377\376\366\372\377\376\366"
+ 1115      FFFEF6FA 
+ 1115      FFFEF6FA 
+ 1115      FFFEF6
+ 1116 303a FAFFFEF6 		.ascii	"\372\377\376\366\372\377\376\366\372\377"
+ 1116      FAFFFEF6 
+ 1116      FAFF
+ 1117              		.globl	heatmap_cs_PuBuGn_discrete
+ 1118              		.section	.data.rel.local
+ 1119              		.align 8
+ 1120              		.type	heatmap_cs_PuBuGn_discrete, @object
+ 1121              		.size	heatmap_cs_PuBuGn_discrete, 8
+ 1122              	heatmap_cs_PuBuGn_discrete:
+ 1123 0018 00000000 		.quad	discrete
+ 1123      00000000 
+ 1124              		.section	.data.rel.ro.local
+ 1125              		.align 16
+ 1126              		.type	discrete, @object
+ 1127              		.size	discrete, 16
+ 1128              	discrete:
+ 1129 0030 00000000 		.quad	discrete_data
+ 1129      00000000 
+ 1130 0038 0A000000 		.quad	10
+ 1130      00000000 
+ 1131              		.section	.rodata
+GAS LISTING /tmp/ccMVh1cW.s 			page 57
+
+
+ 1132 3044 00000000 		.align 32
+ 1132      00000000 
+ 1132      00000000 
+ 1132      00000000 
+ 1132      00000000 
+ 1133              		.type	discrete_data, @object
+ 1134              		.size	discrete_data, 40
+ 1135              	discrete_data:
+ 1136 3060 00       		.string	""
+ 1137 3061 00       		.string	""
+ 1138 3062 00       		.string	""
+ 1139 3063 00       		.string	""
+ 1140 3064 014636FF 		.ascii	"\001F6\377\001lY\377\002\201\212\3776\220\300\377g\251\317\377"
+ 1140      016C59FF 
+ 1140      02818AFF 
+ 1140      3690C0FF 
+ 1140      67A9CFFF 
+ 1141 3078 A6BDDBFF 		.ascii	"\246\275\333\377\320\321\346\377\354\342\360\377\377\367\373"
+ 1141      D0D1E6FF 
+ 1141      ECE2F0FF 
+ 1141      FFF7FB
+ 1142 3087 FF       		.ascii	"\377"
+ 1143              		.text
+ 1144              	.Letext0:
+ 1145              		.file 1 "./heatmap.h"
+ 1146              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1147              		.file 3 "./colorschemes/PuBuGn.h"
+ 1148              		.file 4 "colorschemes/PuBuGn.c"
+ 1149              		.section	.debug_info,"",@progbits
+ 1150              	.Ldebug_info0:
+ 1151 0000 E3010000 		.long	0x1e3
+ 1152 0004 0500     		.value	0x5
+ 1153 0006 01       		.byte	0x1
+ 1154 0007 08       		.byte	0x8
+ 1155 0008 00000000 		.long	.Ldebug_abbrev0
+ 1156 000c 0A       		.uleb128 0xa
+ 1157 000d 00000000 		.long	.LASF26
+ 1158 0011 1D       		.byte	0x1d
+ 1159 0012 00000000 		.long	.LASF0
+ 1160 0016 00000000 		.long	.LASF1
+ 1161 001a 00000000 		.long	.Ldebug_line0
+ 1162 001e 01       		.uleb128 0x1
+ 1163 001f 08       		.byte	0x8
+ 1164 0020 05       		.byte	0x5
+ 1165 0021 00000000 		.long	.LASF2
+ 1166 0025 06       		.uleb128 0x6
+ 1167 0026 00000000 		.long	.LASF12
+ 1168 002a 02       		.byte	0x2
+ 1169 002b D6       		.byte	0xd6
+ 1170 002c 17       		.byte	0x17
+ 1171 002d 31000000 		.long	0x31
+ 1172 0031 01       		.uleb128 0x1
+ 1173 0032 08       		.byte	0x8
+ 1174 0033 07       		.byte	0x7
+ 1175 0034 00000000 		.long	.LASF3
+ 1176 0038 0B       		.uleb128 0xb
+ 1177 0039 04       		.byte	0x4
+GAS LISTING /tmp/ccMVh1cW.s 			page 58
+
+
+ 1178 003a 05       		.byte	0x5
+ 1179 003b 696E7400 		.string	"int"
+ 1180 003f 01       		.uleb128 0x1
+ 1181 0040 08       		.byte	0x8
+ 1182 0041 05       		.byte	0x5
+ 1183 0042 00000000 		.long	.LASF4
+ 1184 0046 01       		.uleb128 0x1
+ 1185 0047 10       		.byte	0x10
+ 1186 0048 04       		.byte	0x4
+ 1187 0049 00000000 		.long	.LASF5
+ 1188 004d 01       		.uleb128 0x1
+ 1189 004e 04       		.byte	0x4
+ 1190 004f 04       		.byte	0x4
+ 1191 0050 00000000 		.long	.LASF6
+ 1192 0054 01       		.uleb128 0x1
+ 1193 0055 04       		.byte	0x4
+ 1194 0056 07       		.byte	0x7
+ 1195 0057 00000000 		.long	.LASF7
+ 1196 005b 01       		.uleb128 0x1
+ 1197 005c 02       		.byte	0x2
+ 1198 005d 07       		.byte	0x7
+ 1199 005e 00000000 		.long	.LASF8
+ 1200 0062 0C       		.uleb128 0xc
+ 1201 0063 10       		.byte	0x10
+ 1202 0064 01       		.byte	0x1
+ 1203 0065 BB       		.byte	0xbb
+ 1204 0066 09       		.byte	0x9
+ 1205 0067 84000000 		.long	0x84
+ 1206 006b 07       		.uleb128 0x7
+ 1207 006c 00000000 		.long	.LASF9
+ 1208 0070 BC       		.byte	0xbc
+ 1209 0071 1A       		.byte	0x1a
+ 1210 0072 84000000 		.long	0x84
+ 1211 0076 00       		.byte	0
+ 1212 0077 07       		.uleb128 0x7
+ 1213 0078 00000000 		.long	.LASF10
+ 1214 007c BD       		.byte	0xbd
+ 1215 007d 0C       		.byte	0xc
+ 1216 007e 25000000 		.long	0x25
+ 1217 0082 08       		.byte	0x8
+ 1218 0083 00       		.byte	0
+ 1219 0084 08       		.uleb128 0x8
+ 1220 0085 90000000 		.long	0x90
+ 1221 0089 01       		.uleb128 0x1
+ 1222 008a 01       		.byte	0x1
+ 1223 008b 08       		.byte	0x8
+ 1224 008c 00000000 		.long	.LASF11
+ 1225 0090 03       		.uleb128 0x3
+ 1226 0091 89000000 		.long	0x89
+ 1227 0095 06       		.uleb128 0x6
+ 1228 0096 00000000 		.long	.LASF13
+ 1229 009a 01       		.byte	0x1
+ 1230 009b BE       		.byte	0xbe
+ 1231 009c 03       		.byte	0x3
+ 1232 009d 62000000 		.long	0x62
+ 1233 00a1 03       		.uleb128 0x3
+ 1234 00a2 95000000 		.long	0x95
+GAS LISTING /tmp/ccMVh1cW.s 			page 59
+
+
+ 1235 00a6 08       		.uleb128 0x8
+ 1236 00a7 A1000000 		.long	0xa1
+ 1237 00ab 04       		.uleb128 0x4
+ 1238 00ac 00000000 		.long	.LASF14
+ 1239 00b0 21       		.byte	0x21
+ 1240 00b1 A6000000 		.long	0xa6
+ 1241 00b5 04       		.uleb128 0x4
+ 1242 00b6 00000000 		.long	.LASF15
+ 1243 00ba 23       		.byte	0x23
+ 1244 00bb A6000000 		.long	0xa6
+ 1245 00bf 04       		.uleb128 0x4
+ 1246 00c0 00000000 		.long	.LASF16
+ 1247 00c4 25       		.byte	0x25
+ 1248 00c5 A6000000 		.long	0xa6
+ 1249 00c9 04       		.uleb128 0x4
+ 1250 00ca 00000000 		.long	.LASF17
+ 1251 00ce 28       		.byte	0x28
+ 1252 00cf A6000000 		.long	0xa6
+ 1253 00d3 09       		.uleb128 0x9
+ 1254 00d4 90000000 		.long	0x90
+ 1255 00d8 E3000000 		.long	0xe3
+ 1256 00dc 0D       		.uleb128 0xd
+ 1257 00dd 31000000 		.long	0x31
+ 1258 00e1 27       		.byte	0x27
+ 1259 00e2 00       		.byte	0
+ 1260 00e3 03       		.uleb128 0x3
+ 1261 00e4 D3000000 		.long	0xd3
+ 1262 00e8 02       		.uleb128 0x2
+ 1263 00e9 00000000 		.long	.LASF18
+ 1264 00ed 20       		.byte	0x20
+ 1265 00ee 1C       		.byte	0x1c
+ 1266 00ef E3000000 		.long	0xe3
+ 1267 00f3 09       		.uleb128 0x9
+ 1268 00f4 03       		.byte	0x3
+ 1269 00f5 00000000 		.quad	discrete_data
+ 1269      00000000 
+ 1270 00fd 02       		.uleb128 0x2
+ 1271 00fe 00000000 		.long	.LASF19
+ 1272 0102 23       		.byte	0x23
+ 1273 0103 24       		.byte	0x24
+ 1274 0104 A1000000 		.long	0xa1
+ 1275 0108 09       		.uleb128 0x9
+ 1276 0109 03       		.byte	0x3
+ 1277 010a 00000000 		.quad	discrete
+ 1277      00000000 
+ 1278 0112 05       		.uleb128 0x5
+ 1279 0113 AB000000 		.long	0xab
+ 1280 0117 24       		.byte	0x24
+ 1281 0118 09       		.uleb128 0x9
+ 1282 0119 03       		.byte	0x3
+ 1283 011a 00000000 		.quad	heatmap_cs_PuBuGn_discrete
+ 1283      00000000 
+ 1284 0122 09       		.uleb128 0x9
+ 1285 0123 90000000 		.long	0x90
+ 1286 0127 33010000 		.long	0x133
+ 1287 012b 0E       		.uleb128 0xe
+ 1288 012c 31000000 		.long	0x31
+GAS LISTING /tmp/ccMVh1cW.s 			page 60
+
+
+ 1289 0130 0310     		.value	0x1003
+ 1290 0132 00       		.byte	0
+ 1291 0133 03       		.uleb128 0x3
+ 1292 0134 22010000 		.long	0x122
+ 1293 0138 02       		.uleb128 0x2
+ 1294 0139 00000000 		.long	.LASF20
+ 1295 013d 26       		.byte	0x26
+ 1296 013e 1C       		.byte	0x1c
+ 1297 013f 33010000 		.long	0x133
+ 1298 0143 09       		.uleb128 0x9
+ 1299 0144 03       		.byte	0x3
+ 1300 0145 00000000 		.quad	soft_data
+ 1300      00000000 
+ 1301 014d 02       		.uleb128 0x2
+ 1302 014e 00000000 		.long	.LASF21
+ 1303 0152 29       		.byte	0x29
+ 1304 0153 24       		.byte	0x24
+ 1305 0154 A1000000 		.long	0xa1
+ 1306 0158 09       		.uleb128 0x9
+ 1307 0159 03       		.byte	0x3
+ 1308 015a 00000000 		.quad	soft
+ 1308      00000000 
+ 1309 0162 05       		.uleb128 0x5
+ 1310 0163 B5000000 		.long	0xb5
+ 1311 0167 2A       		.byte	0x2a
+ 1312 0168 09       		.uleb128 0x9
+ 1313 0169 03       		.byte	0x3
+ 1314 016a 00000000 		.quad	heatmap_cs_PuBuGn_soft
+ 1314      00000000 
+ 1315 0172 02       		.uleb128 0x2
+ 1316 0173 00000000 		.long	.LASF22
+ 1317 0177 2C       		.byte	0x2c
+ 1318 0178 1C       		.byte	0x1c
+ 1319 0179 33010000 		.long	0x133
+ 1320 017d 09       		.uleb128 0x9
+ 1321 017e 03       		.byte	0x3
+ 1322 017f 00000000 		.quad	mixed_data
+ 1322      00000000 
+ 1323 0187 02       		.uleb128 0x2
+ 1324 0188 00000000 		.long	.LASF23
+ 1325 018c 2F       		.byte	0x2f
+ 1326 018d 24       		.byte	0x24
+ 1327 018e A1000000 		.long	0xa1
+ 1328 0192 09       		.uleb128 0x9
+ 1329 0193 03       		.byte	0x3
+ 1330 0194 00000000 		.quad	mixed
+ 1330      00000000 
+ 1331 019c 05       		.uleb128 0x5
+ 1332 019d BF000000 		.long	0xbf
+ 1333 01a1 30       		.byte	0x30
+ 1334 01a2 09       		.uleb128 0x9
+ 1335 01a3 03       		.byte	0x3
+ 1336 01a4 00000000 		.quad	heatmap_cs_PuBuGn_mixed
+ 1336      00000000 
+ 1337 01ac 02       		.uleb128 0x2
+ 1338 01ad 00000000 		.long	.LASF24
+ 1339 01b1 32       		.byte	0x32
+GAS LISTING /tmp/ccMVh1cW.s 			page 61
+
+
+ 1340 01b2 1C       		.byte	0x1c
+ 1341 01b3 33010000 		.long	0x133
+ 1342 01b7 09       		.uleb128 0x9
+ 1343 01b8 03       		.byte	0x3
+ 1344 01b9 00000000 		.quad	mixed_exp_data
+ 1344      00000000 
+ 1345 01c1 02       		.uleb128 0x2
+ 1346 01c2 00000000 		.long	.LASF25
+ 1347 01c6 35       		.byte	0x35
+ 1348 01c7 24       		.byte	0x24
+ 1349 01c8 A1000000 		.long	0xa1
+ 1350 01cc 09       		.uleb128 0x9
+ 1351 01cd 03       		.byte	0x3
+ 1352 01ce 00000000 		.quad	mixed_exp
+ 1352      00000000 
+ 1353 01d6 05       		.uleb128 0x5
+ 1354 01d7 C9000000 		.long	0xc9
+ 1355 01db 36       		.byte	0x36
+ 1356 01dc 09       		.uleb128 0x9
+ 1357 01dd 03       		.byte	0x3
+ 1358 01de 00000000 		.quad	heatmap_cs_PuBuGn_mixed_exp
+ 1358      00000000 
+ 1359 01e6 00       		.byte	0
+ 1360              		.section	.debug_abbrev,"",@progbits
+ 1361              	.Ldebug_abbrev0:
+ 1362 0000 01       		.uleb128 0x1
+ 1363 0001 24       		.uleb128 0x24
+ 1364 0002 00       		.byte	0
+ 1365 0003 0B       		.uleb128 0xb
+ 1366 0004 0B       		.uleb128 0xb
+ 1367 0005 3E       		.uleb128 0x3e
+ 1368 0006 0B       		.uleb128 0xb
+ 1369 0007 03       		.uleb128 0x3
+ 1370 0008 0E       		.uleb128 0xe
+ 1371 0009 00       		.byte	0
+ 1372 000a 00       		.byte	0
+ 1373 000b 02       		.uleb128 0x2
+ 1374 000c 34       		.uleb128 0x34
+ 1375 000d 00       		.byte	0
+ 1376 000e 03       		.uleb128 0x3
+ 1377 000f 0E       		.uleb128 0xe
+ 1378 0010 3A       		.uleb128 0x3a
+ 1379 0011 21       		.uleb128 0x21
+ 1380 0012 04       		.sleb128 4
+ 1381 0013 3B       		.uleb128 0x3b
+ 1382 0014 0B       		.uleb128 0xb
+ 1383 0015 39       		.uleb128 0x39
+ 1384 0016 0B       		.uleb128 0xb
+ 1385 0017 49       		.uleb128 0x49
+ 1386 0018 13       		.uleb128 0x13
+ 1387 0019 02       		.uleb128 0x2
+ 1388 001a 18       		.uleb128 0x18
+ 1389 001b 00       		.byte	0
+ 1390 001c 00       		.byte	0
+ 1391 001d 03       		.uleb128 0x3
+ 1392 001e 26       		.uleb128 0x26
+ 1393 001f 00       		.byte	0
+GAS LISTING /tmp/ccMVh1cW.s 			page 62
+
+
+ 1394 0020 49       		.uleb128 0x49
+ 1395 0021 13       		.uleb128 0x13
+ 1396 0022 00       		.byte	0
+ 1397 0023 00       		.byte	0
+ 1398 0024 04       		.uleb128 0x4
+ 1399 0025 34       		.uleb128 0x34
+ 1400 0026 00       		.byte	0
+ 1401 0027 03       		.uleb128 0x3
+ 1402 0028 0E       		.uleb128 0xe
+ 1403 0029 3A       		.uleb128 0x3a
+ 1404 002a 21       		.uleb128 0x21
+ 1405 002b 03       		.sleb128 3
+ 1406 002c 3B       		.uleb128 0x3b
+ 1407 002d 0B       		.uleb128 0xb
+ 1408 002e 39       		.uleb128 0x39
+ 1409 002f 21       		.uleb128 0x21
+ 1410 0030 25       		.sleb128 37
+ 1411 0031 49       		.uleb128 0x49
+ 1412 0032 13       		.uleb128 0x13
+ 1413 0033 3F       		.uleb128 0x3f
+ 1414 0034 19       		.uleb128 0x19
+ 1415 0035 3C       		.uleb128 0x3c
+ 1416 0036 19       		.uleb128 0x19
+ 1417 0037 00       		.byte	0
+ 1418 0038 00       		.byte	0
+ 1419 0039 05       		.uleb128 0x5
+ 1420 003a 34       		.uleb128 0x34
+ 1421 003b 00       		.byte	0
+ 1422 003c 47       		.uleb128 0x47
+ 1423 003d 13       		.uleb128 0x13
+ 1424 003e 3A       		.uleb128 0x3a
+ 1425 003f 21       		.uleb128 0x21
+ 1426 0040 04       		.sleb128 4
+ 1427 0041 3B       		.uleb128 0x3b
+ 1428 0042 0B       		.uleb128 0xb
+ 1429 0043 39       		.uleb128 0x39
+ 1430 0044 21       		.uleb128 0x21
+ 1431 0045 1E       		.sleb128 30
+ 1432 0046 02       		.uleb128 0x2
+ 1433 0047 18       		.uleb128 0x18
+ 1434 0048 00       		.byte	0
+ 1435 0049 00       		.byte	0
+ 1436 004a 06       		.uleb128 0x6
+ 1437 004b 16       		.uleb128 0x16
+ 1438 004c 00       		.byte	0
+ 1439 004d 03       		.uleb128 0x3
+ 1440 004e 0E       		.uleb128 0xe
+ 1441 004f 3A       		.uleb128 0x3a
+ 1442 0050 0B       		.uleb128 0xb
+ 1443 0051 3B       		.uleb128 0x3b
+ 1444 0052 0B       		.uleb128 0xb
+ 1445 0053 39       		.uleb128 0x39
+ 1446 0054 0B       		.uleb128 0xb
+ 1447 0055 49       		.uleb128 0x49
+ 1448 0056 13       		.uleb128 0x13
+ 1449 0057 00       		.byte	0
+ 1450 0058 00       		.byte	0
+GAS LISTING /tmp/ccMVh1cW.s 			page 63
+
+
+ 1451 0059 07       		.uleb128 0x7
+ 1452 005a 0D       		.uleb128 0xd
+ 1453 005b 00       		.byte	0
+ 1454 005c 03       		.uleb128 0x3
+ 1455 005d 0E       		.uleb128 0xe
+ 1456 005e 3A       		.uleb128 0x3a
+ 1457 005f 21       		.uleb128 0x21
+ 1458 0060 01       		.sleb128 1
+ 1459 0061 3B       		.uleb128 0x3b
+ 1460 0062 0B       		.uleb128 0xb
+ 1461 0063 39       		.uleb128 0x39
+ 1462 0064 0B       		.uleb128 0xb
+ 1463 0065 49       		.uleb128 0x49
+ 1464 0066 13       		.uleb128 0x13
+ 1465 0067 38       		.uleb128 0x38
+ 1466 0068 0B       		.uleb128 0xb
+ 1467 0069 00       		.byte	0
+ 1468 006a 00       		.byte	0
+ 1469 006b 08       		.uleb128 0x8
+ 1470 006c 0F       		.uleb128 0xf
+ 1471 006d 00       		.byte	0
+ 1472 006e 0B       		.uleb128 0xb
+ 1473 006f 21       		.uleb128 0x21
+ 1474 0070 08       		.sleb128 8
+ 1475 0071 49       		.uleb128 0x49
+ 1476 0072 13       		.uleb128 0x13
+ 1477 0073 00       		.byte	0
+ 1478 0074 00       		.byte	0
+ 1479 0075 09       		.uleb128 0x9
+ 1480 0076 01       		.uleb128 0x1
+ 1481 0077 01       		.byte	0x1
+ 1482 0078 49       		.uleb128 0x49
+ 1483 0079 13       		.uleb128 0x13
+ 1484 007a 01       		.uleb128 0x1
+ 1485 007b 13       		.uleb128 0x13
+ 1486 007c 00       		.byte	0
+ 1487 007d 00       		.byte	0
+ 1488 007e 0A       		.uleb128 0xa
+ 1489 007f 11       		.uleb128 0x11
+ 1490 0080 01       		.byte	0x1
+ 1491 0081 25       		.uleb128 0x25
+ 1492 0082 0E       		.uleb128 0xe
+ 1493 0083 13       		.uleb128 0x13
+ 1494 0084 0B       		.uleb128 0xb
+ 1495 0085 03       		.uleb128 0x3
+ 1496 0086 1F       		.uleb128 0x1f
+ 1497 0087 1B       		.uleb128 0x1b
+ 1498 0088 1F       		.uleb128 0x1f
+ 1499 0089 10       		.uleb128 0x10
+ 1500 008a 17       		.uleb128 0x17
+ 1501 008b 00       		.byte	0
+ 1502 008c 00       		.byte	0
+ 1503 008d 0B       		.uleb128 0xb
+ 1504 008e 24       		.uleb128 0x24
+ 1505 008f 00       		.byte	0
+ 1506 0090 0B       		.uleb128 0xb
+ 1507 0091 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccMVh1cW.s 			page 64
+
+
+ 1508 0092 3E       		.uleb128 0x3e
+ 1509 0093 0B       		.uleb128 0xb
+ 1510 0094 03       		.uleb128 0x3
+ 1511 0095 08       		.uleb128 0x8
+ 1512 0096 00       		.byte	0
+ 1513 0097 00       		.byte	0
+ 1514 0098 0C       		.uleb128 0xc
+ 1515 0099 13       		.uleb128 0x13
+ 1516 009a 01       		.byte	0x1
+ 1517 009b 0B       		.uleb128 0xb
+ 1518 009c 0B       		.uleb128 0xb
+ 1519 009d 3A       		.uleb128 0x3a
+ 1520 009e 0B       		.uleb128 0xb
+ 1521 009f 3B       		.uleb128 0x3b
+ 1522 00a0 0B       		.uleb128 0xb
+ 1523 00a1 39       		.uleb128 0x39
+ 1524 00a2 0B       		.uleb128 0xb
+ 1525 00a3 01       		.uleb128 0x1
+ 1526 00a4 13       		.uleb128 0x13
+ 1527 00a5 00       		.byte	0
+ 1528 00a6 00       		.byte	0
+ 1529 00a7 0D       		.uleb128 0xd
+ 1530 00a8 21       		.uleb128 0x21
+ 1531 00a9 00       		.byte	0
+ 1532 00aa 49       		.uleb128 0x49
+ 1533 00ab 13       		.uleb128 0x13
+ 1534 00ac 2F       		.uleb128 0x2f
+ 1535 00ad 0B       		.uleb128 0xb
+ 1536 00ae 00       		.byte	0
+ 1537 00af 00       		.byte	0
+ 1538 00b0 0E       		.uleb128 0xe
+ 1539 00b1 21       		.uleb128 0x21
+ 1540 00b2 00       		.byte	0
+ 1541 00b3 49       		.uleb128 0x49
+ 1542 00b4 13       		.uleb128 0x13
+ 1543 00b5 2F       		.uleb128 0x2f
+ 1544 00b6 05       		.uleb128 0x5
+ 1545 00b7 00       		.byte	0
+ 1546 00b8 00       		.byte	0
+ 1547 00b9 00       		.byte	0
+ 1548              		.section	.debug_aranges,"",@progbits
+ 1549 0000 1C000000 		.long	0x1c
+ 1550 0004 0200     		.value	0x2
+ 1551 0006 00000000 		.long	.Ldebug_info0
+ 1552 000a 08       		.byte	0x8
+ 1553 000b 00       		.byte	0
+ 1554 000c 0000     		.value	0
+ 1555 000e 0000     		.value	0
+ 1556 0010 00000000 		.quad	0
+ 1556      00000000 
+ 1557 0018 00000000 		.quad	0
+ 1557      00000000 
+ 1558              		.section	.debug_line,"",@progbits
+ 1559              	.Ldebug_line0:
+ 1560 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1560      05000800 
+ 1560      49000000 
+GAS LISTING /tmp/ccMVh1cW.s 			page 65
+
+
+ 1560      010101FB 
+ 1560      0E0D0001 
+ 1561              	.LASF19:
+ 1562 0000 64697363 		.string	"discrete"
+ 1562      72657465 
+ 1562      00
+ 1563              	.LASF20:
+ 1564 0009 736F6674 		.string	"soft_data"
+ 1564      5F646174 
+ 1564      6100
+ 1565              	.LASF12:
+ 1566 0013 73697A65 		.string	"size_t"
+ 1566      5F7400
+ 1567              	.LASF13:
+ 1568 001a 68656174 		.string	"heatmap_colorscheme_t"
+ 1568      6D61705F 
+ 1568      636F6C6F 
+ 1568      72736368 
+ 1568      656D655F 
+ 1569              	.LASF17:
+ 1570 0030 68656174 		.string	"heatmap_cs_PuBuGn_mixed_exp"
+ 1570      6D61705F 
+ 1570      63735F50 
+ 1570      75427547 
+ 1570      6E5F6D69 
+ 1571              	.LASF26:
+ 1572 004c 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1572      43313720 
+ 1572      31322E32 
+ 1572      2E30202D 
+ 1572      6D74756E 
+ 1573              	.LASF6:
+ 1574 00ab 666C6F61 		.string	"float"
+ 1574      7400
+ 1575              	.LASF11:
+ 1576 00b1 756E7369 		.string	"unsigned char"
+ 1576      676E6564 
+ 1576      20636861 
+ 1576      7200
+ 1577              	.LASF3:
+ 1578 00bf 6C6F6E67 		.string	"long unsigned int"
+ 1578      20756E73 
+ 1578      69676E65 
+ 1578      6420696E 
+ 1578      7400
+ 1579              	.LASF8:
+ 1580 00d1 73686F72 		.string	"short unsigned int"
+ 1580      7420756E 
+ 1580      7369676E 
+ 1580      65642069 
+ 1580      6E7400
+ 1581              	.LASF15:
+ 1582 00e4 68656174 		.string	"heatmap_cs_PuBuGn_soft"
+ 1582      6D61705F 
+ 1582      63735F50 
+ 1582      75427547 
+ 1582      6E5F736F 
+GAS LISTING /tmp/ccMVh1cW.s 			page 66
+
+
+ 1583              	.LASF25:
+ 1584 00fb 6D697865 		.string	"mixed_exp"
+ 1584      645F6578 
+ 1584      7000
+ 1585              	.LASF23:
+ 1586 0105 6D697865 		.string	"mixed"
+ 1586      6400
+ 1587              	.LASF7:
+ 1588 010b 756E7369 		.string	"unsigned int"
+ 1588      676E6564 
+ 1588      20696E74 
+ 1588      00
+ 1589              	.LASF16:
+ 1590 0118 68656174 		.string	"heatmap_cs_PuBuGn_mixed"
+ 1590      6D61705F 
+ 1590      63735F50 
+ 1590      75427547 
+ 1590      6E5F6D69 
+ 1591              	.LASF10:
+ 1592 0130 6E636F6C 		.string	"ncolors"
+ 1592      6F727300 
+ 1593              	.LASF4:
+ 1594 0138 6C6F6E67 		.string	"long long int"
+ 1594      206C6F6E 
+ 1594      6720696E 
+ 1594      7400
+ 1595              	.LASF24:
+ 1596 0146 6D697865 		.string	"mixed_exp_data"
+ 1596      645F6578 
+ 1596      705F6461 
+ 1596      746100
+ 1597              	.LASF22:
+ 1598 0155 6D697865 		.string	"mixed_data"
+ 1598      645F6461 
+ 1598      746100
+ 1599              	.LASF2:
+ 1600 0160 6C6F6E67 		.string	"long int"
+ 1600      20696E74 
+ 1600      00
+ 1601              	.LASF14:
+ 1602 0169 68656174 		.string	"heatmap_cs_PuBuGn_discrete"
+ 1602      6D61705F 
+ 1602      63735F50 
+ 1602      75427547 
+ 1602      6E5F6469 
+ 1603              	.LASF5:
+ 1604 0184 6C6F6E67 		.string	"long double"
+ 1604      20646F75 
+ 1604      626C6500 
+ 1605              	.LASF18:
+ 1606 0190 64697363 		.string	"discrete_data"
+ 1606      72657465 
+ 1606      5F646174 
+ 1606      6100
+ 1607              	.LASF21:
+ 1608 019e 736F6674 		.string	"soft"
+ 1608      00
+GAS LISTING /tmp/ccMVh1cW.s 			page 67
+
+
+ 1609              	.LASF9:
+ 1610 01a3 636F6C6F 		.string	"colors"
+ 1610      727300
+ 1611              		.section	.debug_line_str,"MS",@progbits,1
+ 1612              	.LASF1:
+ 1613 0000 2F726F6F 		.string	"/root/repo"
+ 1613      742F7265 
+ 1613      706F00
+ 1614              	.LASF0:
+ 1615 000b 636F6C6F 		.string	"colorschemes/PuBuGn.c"
+ 1615      72736368 
+ 1615      656D6573 
+ 1615      2F507542 
+ 1615      75476E2E 
+ 1616              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1617 0021 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1617      742F7265 
+ 1617      706F0063 
+ 1617      6F6C6F72 
+ 1617      73636865 
@@ -0,0 +1,3932 @@
+GAS LISTING /tmp/ccRe9WAw.s 			page 1
+
+
+   1              		.file	"PuOr.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/PuOr.c"
+   5              		.globl	heatmap_cs_PuOr_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_PuOr_mixed_exp, @object
+   9              		.size	heatmap_cs_PuOr_mixed_exp, 8
+  10              	heatmap_cs_PuOr_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 2C00     		.string	","
+  29 0006 4B00     		.string	"K"
+  30 0008 30024F18 		.ascii	"0\002O\0303\004S16\007XJ9\013]c;\016a|F\031r\225I\034v\256L\037"
+  30      33045331 
+  30      3607584A 
+  30      390B5D63 
+  30      3B0E617C 
+  31 0026 7BC74F22 		.ascii	"{\307O\"\200\340Q$\204\371T(\210\377W.\213\377Z4\216\377]9\221"
+  31      80E05124 
+  31      84F95428 
+  31      88FF572E 
+  31      8BFF5A34 
+  32 003f FF5F3E93 		.ascii	"\377_>\223\377bD\226\377nX\237\377q]\242\377tb\244\377wf\246"
+  32      FF624496 
+  32      FF6E589F 
+  32      FF715DA2 
+  32      FF7462A4 
+  33 0057 FF7A6BA8 		.ascii	"\377zk\250\377~p\252\377\201t\254\377\204w\257\377\207{\261\377"
+  33      FF7E70AA 
+  33      FF8174AC 
+  33      FF8477AF 
+  33      FF877BB1 
+  34 006c 8A7EB4FF 		.ascii	"\212~\264\377\215\202\266\377\220\205\270\377\223\210\273\377"
+  34      8D82B6FF 
+  34      9085B8FF 
+  34      9388BBFF 
+  35 007c A097C5FF 		.ascii	"\240\227\305\377\243\232\307\377\246\236\311\377\251\241\313"
+GAS LISTING /tmp/ccRe9WAw.s 			page 2
+
+
+  35      A39AC7FF 
+  35      A69EC9FF 
+  35      A9A1CB
+  36 008b FFACA4CD 		.ascii	"\377\254\244\315\377\257\250\320\377\262\253\322\377\264\256"
+  36      FFAFA8D0 
+  36      FFB2ABD2 
+  36      FFB4AE
+  37 009a D3FFB5B0 		.ascii	"\323\377\265\260\325\377\267\263\326\377\271\265\330\377\273"
+  37      D5FFB7B3 
+  37      D6FFB9B5 
+  37      D8FFBB
+  38 00a9 B8D9FFBD 		.ascii	"\270\331\377\275\272\332\377\277\275\334\377\311\311\342\377"
+  38      BADAFFBF 
+  38      BDDCFFC9 
+  38      C9E2FF
+  39 00b8 CBCBE3FF 		.ascii	"\313\313\343\377\315\316\345\377\317\320\346\377\321\323\347"
+  39      CDCEE5FF 
+  39      CFD0E6FF 
+  39      D1D3E7
+  40 00c7 FFD3D5E8 		.ascii	"\377\323\325\350\377\325\327\351\377\350\326\336\377\350\327"
+  40      FFD5D7E9 
+  40      FFE8D6DE 
+  40      FFE8D7
+  41 00d6 E0FFE8D9 		.ascii	"\340\377\350\331\342\377\350\333\344\377\350\335\346\377\350"
+  41      E2FFE8DB 
+  41      E4FFE8DD 
+  41      E6FFE8
+  42 00e5 DEE8FFE8 		.ascii	"\336\350\377\350\340\352\377\350\342\353\377\351\343\354\377"
+  42      E0EAFFE8 
+  42      E2EBFFE9 
+  42      E3ECFF
+  43 00f4 EFEAF0FF 		.ascii	"\357\352\360\377\360\354\361\377\360\356\362\377\361\357\363"
+  43      F0ECF1FF 
+  43      F0EEF2FF 
+  43      F1EFF3
+  44 0103 FFF2F0F4 		.ascii	"\377\362\360\364\377\363\362\364\377\363\363\365\377\365\365"
+  44      FFF3F2F4 
+  44      FFF3F3F5 
+  44      FFF5F5
+  45 0112 F6FFF6F6 		.ascii	"\366\377\366\366\366\377\367\366\366\377\370\364\365\377\372"
+  45      F6FFF7F6 
+  45      F6FFF8F4 
+  45      F5FFFA
+  46 0121 F3F4FFFB 		.ascii	"\363\364\377\373\362\362\377\375\360\361\377\375\357\357\377"
+  46      F2F2FFFD 
+  46      F0F1FFFD 
+  46      EFEFFF
+  47 0130 FDEEECFF 		.ascii	"\375\356\354\377\375\354\352\377\375\353\347\377\375\352\345"
+  47      FDECEAFF 
+  47      FDEBE7FF 
+  47      FDEAE5
+  48 013f FFFEE5D5 		.ascii	"\377\376\345\325\377\376\344\322\377\376\343\317\377\376\342"
+  48      FFFEE4D2 
+  48      FFFEE3CF 
+  48      FFFEE2
+  49 014e CCFFFEE2 		.ascii	"\314\377\376\342\311\377\376\341\306\377\376\341\303\377\376"
+  49      C9FFFEE1 
+GAS LISTING /tmp/ccRe9WAw.s 			page 3
+
+
+  49      C6FFFEE1 
+  49      C3FFFE
+  50 015d E0C0FFFE 		.ascii	"\340\300\377\376\340\275\377\376\340\272\377\376\340\267\377"
+  50      E0BDFFFE 
+  50      E0BAFFFE 
+  50      E0B7FF
+  51 016c FDDFB5FF 		.ascii	"\375\337\265\377\375\336\262\377\375\334\257\377\375\333\254"
+  51      FDDEB2FF 
+  51      FDDCAFFF 
+  51      FDDBAC
+  52 017b FFFDDAA9 		.ascii	"\377\375\332\251\377\375\331\246\377\375\327\244\377\375\326"
+  52      FFFDD9A6 
+  52      FFFDD7A4 
+  52      FFFDD6
+  53 018a A1FFFDD5 		.ascii	"\241\377\375\325\236\377\375\324\234\377\375\322\231\377\375"
+  53      9EFFFDD4 
+  53      9CFFFDD2 
+  53      99FFFD
+  54 0199 D197FFFD 		.ascii	"\321\227\377\375\320\224\377\375\307\201\377\375\306~\377\375"
+  54      D094FFFD 
+  54      C781FFFD 
+  54      C67EFFFD 
+  55 01a9 C47CFFFD 		.ascii	"\304|\377\375\303z\377\375\302w\377\375\301u\377\375\300s\377"
+  55      C37AFFFD 
+  55      C277FFFD 
+  55      C175FFFD 
+  55      C073FF
+  56 01bc FDBE70FF 		.ascii	"\375\276p\377\375\275n\377\375\274l\377\375\273i\377\375\272"
+  56      FDBD6EFF 
+  56      FDBC6CFF 
+  56      FDBB69FF 
+  56      FDBA
+  57 01ce 67FFFDB9 		.ascii	"g\377\375\271e\377\375\270c\377\374\266a\377\373\265_\377\372"
+  57      65FFFDB8 
+  57      63FFFCB6 
+  57      61FFFBB5 
+  57      5FFFFA
+  58 01e1 B45DFFFA 		.ascii	"\264]\377\372\262[\377\371\261Y\377\370\257X\377\370\256V\377"
+  58      B25BFFF9 
+  58      B159FFF8 
+  58      AF58FFF8 
+  58      AE56FF
+  59 01f4 F7AD54FF 		.ascii	"\367\255T\377\366\254R\377\365\252Q\377\365\251O\377\364\250"
+  59      F6AC52FF 
+  59      F5AA51FF 
+  59      F5A94FFF 
+  59      F4A8
+  60 0206 4DFFF3A6 		.ascii	"M\377\363\246K\377\363\245J\377\362\244H\377\361\243F\377\353"
+  60      4BFFF3A5 
+  60      4AFFF2A4 
+  60      48FFF1A3 
+  60      46FFEB
+  61 0219 9735FFEA 		.ascii	"\2275\377\352\2263\377\352\2242\377\351\2230\377\350\222.\377"
+  61      9633FFEA 
+  61      9432FFE9 
+  61      9330FFE8 
+  61      922EFF
+GAS LISTING /tmp/ccRe9WAw.s 			page 4
+
+
+  62 022c E8912DFF 		.ascii	"\350\221-\377\347\220+\377\347\217)\377\346\215(\377\345\214"
+  62      E7902BFF 
+  62      E78F29FF 
+  62      E68D28FF 
+  62      E58C
+  63 023e 26FFE58B 		.ascii	"&\377\345\213$\377\344\212#\377\344\211!\377\343\210\037\377"
+  63      24FFE48A 
+  63      23FFE489 
+  63      21FFE388 
+  63      1FFF
+  64 0250 E2871DFF 		.ascii	"\342\207\035\377\342\206\034\377\341\205\032\377\341\204\030"
+  64      E2861CFF 
+  64      E1851AFF 
+  64      E18418
+  65 025f FFE08316 		.ascii	"\377\340\203\026\377\340\202\024\377\337\201\023\377\336\200"
+  65      FFE08214 
+  65      FFDF8113 
+  65      FFDE80
+  66 026e 13FFDD7F 		.ascii	"\023\377\335\177\023\377\334\177\023\377\334~\022\377\333}\022"
+  66      13FFDC7F 
+  66      13FFDC7E 
+  66      12FFDB7D 
+  66      12
+  67 027f FFDA7C12 		.ascii	"\377\332|\022\377\331|\022\377\331{\021\377\330z\021\377\327"
+  67      FFD97C12 
+  67      FFD97B11 
+  67      FFD87A11 
+  67      FFD7
+  68 0291 7911FFD6 		.ascii	"y\021\377\326y\021\377\326x\020\377\325w\020\377\324w\020\377"
+  68      7911FFD6 
+  68      7810FFD5 
+  68      7710FFD4 
+  68      7710FF
+  69 02a4 D47610FF 		.ascii	"\324v\020\377\323u\020\377\322u\017\377\322t\017\377\321s\017"
+  69      D37510FF 
+  69      D2750FFF 
+  69      D2740FFF 
+  69      D1730F
+  70 02b7 FFD0730F 		.ascii	"\377\320s\017\377\320r\016\377\317r\016\377\316q\016\377\305"
+  70      FFD0720E 
+  70      FFCF720E 
+  70      FFCE710E 
+  70      FFC5
+  71 02c9 680BFFC4 		.ascii	"h\013\377\304g\013\377\303g\013\377\303f\n\377\302f\n\377\301"
+  71      670BFFC3 
+  71      670BFFC3 
+  71      660AFFC2 
+  71      660AFFC1 
+  72 02dd 650AFFC1 		.ascii	"e\n\377\301e\n\377\300d\n\377\300c\t\377\277c\t\377\277b\t\377"
+  72      650AFFC0 
+  72      640AFFC0 
+  72      6309FFBF 
+  72      6309FFBF 
+  73 02f4 BE6209FF 		.ascii	"\276b\t\377\275a\t\377\275a\t\377\274`\b\377\274`\b\377\273_"
+  73      BD6109FF 
+  73      BD6109FF 
+  73      BC6008FF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 5
+
+
+  73      BC6008FF 
+  74 030a 08FFBB5F 		.ascii	"\b\377\273_\b\377\272^\b\377\272^\007\377\271]\007\377\271]\007"
+  74      08FFBA5E 
+  74      08FFBA5E 
+  74      07FFB95D 
+  74      07FFB95D 
+  75 031f FFB85C07 		.ascii	"\377\270\\\007\377\270\\\007\377\267\\\007\377\267[\007\377\266"
+  75      FFB85C07 
+  75      FFB75C07 
+  75      FFB75B07 
+  75      FFB6
+  76 0331 5B06FFB6 		.ascii	"[\006\377\266Z\006\377\265Z\006\377\265Y\006\377\264Y\006\377"
+  76      5A06FFB5 
+  76      5A06FFB5 
+  76      5906FFB4 
+  76      5906FF
+  77 0344 B45906FF 		.ascii	"\264Y\006\377\263X\006\377\263X\006\377\262W\006\377\262W\006"
+  77      B35806FF 
+  77      B35806FF 
+  77      B25706FF 
+  77      B25706
+  78 0357 FFB15706 		.ascii	"\377\261W\006\377\261W\006\377\260V\006\377\260V\006\377\257"
+  78      FFB15706 
+  78      FFB05606 
+  78      FFB05606 
+  78      FFAF
+  79 0369 5606FFAF 		.ascii	"V\006\377\257U\006\377\256U\006\377\256U\006\377\255U\006\377"
+  79      5506FFAE 
+  79      5506FFAE 
+  79      5506FFAD 
+  79      5506FF
+  80 037c AD5406FF 		.ascii	"\255T\006\377\254T\006\377\254T\006\377\254T\006\377\253S\006"
+  80      AC5406FF 
+  80      AC5406FF 
+  80      AC5406FF 
+  80      AB5306
+  81 038f FFAB5306 		.ascii	"\377\253S\006\377\252S\006\377\252S\006\377\251R\006\377\251"
+  81      FFAA5306 
+  81      FFAA5306 
+  81      FFA95206 
+  81      FFA9
+  82 03a1 5206FFA9 		.ascii	"R\006\377\251R\006\377\250R\006\377\250Q\006\377\247Q\006\377"
+  82      5206FFA8 
+  82      5206FFA8 
+  82      5106FFA7 
+  82      5106FF
+  83 03b4 A75106FF 		.ascii	"\247Q\006\377\247Q\007\377\246Q\007\377\246P\007\377\246P\007"
+  83      A75107FF 
+  83      A65107FF 
+  83      A65007FF 
+  83      A65007
+  84 03c7 FFA55007 		.ascii	"\377\245P\007\377\245P\007\377\244O\007\377\244O\007\377\244"
+  84      FFA55007 
+  84      FFA44F07 
+  84      FFA44F07 
+  84      FFA4
+  85 03d9 4F07FFA3 		.ascii	"O\007\377\243O\007\377\243O\007\377\243O\007\377\242N\007\377"
+GAS LISTING /tmp/ccRe9WAw.s 			page 6
+
+
+  85      4F07FFA3 
+  85      4F07FFA3 
+  85      4F07FFA2 
+  85      4E07FF
+  86 03ec A24E07FF 		.ascii	"\242N\007\377\242N\007\377\241N\007\377\241N\007\377\241M\007"
+  86      A24E07FF 
+  86      A14E07FF 
+  86      A14E07FF 
+  86      A14D07
+  87 03ff FFA04D07 		.ascii	"\377\240M\007\377\240M\007\377\240M\007\377\240M\007\377\237"
+  87      FFA04D07 
+  87      FFA04D07 
+  87      FFA04D07 
+  87      FF9F
+  88 0411 4D07FF9F 		.ascii	"M\007\377\237L\007\377\237L\007\377\236L\007\377\236L\007\377"
+  88      4C07FF9F 
+  88      4C07FF9E 
+  88      4C07FF9E 
+  88      4C07FF
+  89 0424 9E4C07FF 		.ascii	"\236L\007\377\236L\007\377\223F\007\377\223F\007\377\222E\007"
+  89      9E4C07FF 
+  89      934607FF 
+  89      934607FF 
+  89      924507
+  90 0437 FF924507 		.ascii	"\377\222E\007\377\222E\007\377\222E\007\377\221E\007\377\221"
+  90      FF924507 
+  90      FF924507 
+  90      FF914507 
+  90      FF91
+  91 0449 4507FF91 		.ascii	"E\007\377\221E\007\377\221D\007\377\220D\007\377\220D\007\377"
+  91      4507FF91 
+  91      4407FF90 
+  91      4407FF90 
+  91      4407FF
+  92 045c 904407FF 		.ascii	"\220D\007\377\220D\007\377\217D\007\377\217D\007\377\217C\007"
+  92      904407FF 
+  92      8F4407FF 
+  92      8F4407FF 
+  92      8F4307
+  93 046f FF8F4307 		.ascii	"\377\217C\007\377\216C\007\377\216C\007\377\216C\b\377\216C\b"
+  93      FF8E4307 
+  93      FF8E4307 
+  93      FF8E4308 
+  93      FF8E4308 
+  94 0483 FF8E4308 		.ascii	"\377\216C\b\377\215C\b\377\215C\b\377\215B\b\377\215B\b\377\215"
+  94      FF8D4308 
+  94      FF8D4308 
+  94      FF8D4208 
+  94      FF8D4208 
+  95 0499 4208FF8C 		.ascii	"B\b\377\214B\b\377\214B\b\377\214B\b\377\214B\b\377\214B\b\377"
+  95      4208FF8C 
+  95      4208FF8C 
+  95      4208FF8C 
+  95      4208FF8C 
+  96 04b0 8B4208FF 		.ascii	"\213B\b\377\213A\b\377\213A\b\377\213A\b\377\213A\b\377\213A"
+  96      8B4108FF 
+  96      8B4108FF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 7
+
+
+  96      8B4108FF 
+  96      8B4108FF 
+  97 04c6 08FF8A41 		.ascii	"\b\377\212A\b\377\212A\b\377\212A\b\377\212A\b\377\212A\b\377"
+  97      08FF8A41 
+  97      08FF8A41 
+  97      08FF8A41 
+  97      08FF8A41 
+  98 04dc 8A4108FF 		.ascii	"\212A\b\377\211@\b\377\211@\b\377\211@\b\377\211@\b\377\211@"
+  98      894008FF 
+  98      894008FF 
+  98      894008FF 
+  98      894008FF 
+  99 04f2 08FF8940 		.ascii	"\b\377\211@\b\377\211@\b\377\210@\b\377\210@\b\377\210@\b\377"
+  99      08FF8940 
+  99      08FF8840 
+  99      08FF8840 
+  99      08FF8840 
+ 100 0508 884008FF 		.ascii	"\210@\b\377\210@\b\377\210@\b\377\210?\b\377\207?\b\377\207?"
+ 100      884008FF 
+ 100      884008FF 
+ 100      883F08FF 
+ 100      873F08FF 
+ 101 051e 08FF873F 		.ascii	"\b\377\207?\b\377\207?\b\377\207?\b\377\207?\b\377\207?\b\377"
+ 101      08FF873F 
+ 101      08FF873F 
+ 101      08FF873F 
+ 101      08FF873F 
+ 102 0534 873F08FF 		.ascii	"\207?\b\377\207?\b\377\206?\b\377\206?\b\377\206?\b\377\206?"
+ 102      873F08FF 
+ 102      863F08FF 
+ 102      863F08FF 
+ 102      863F08FF 
+ 103 054a 08FF863F 		.ascii	"\b\377\206?\b\377\206>\b\377\206>\b\377\206>\b\377\206>\b\377"
+ 103      08FF863E 
+ 103      08FF863E 
+ 103      08FF863E 
+ 103      08FF863E 
+ 104 0560 853E08FF 		.ascii	"\205>\b\377\205>\b\377\205>\b\377\205>\b\377\205>\b\377\205>"
+ 104      853E08FF 
+ 104      853E08FF 
+ 104      853E08FF 
+ 104      853E08FF 
+ 105 0576 08FF853E 		.ascii	"\b\377\205>\b\377\205>\b\377\205>\b\377\205>\b\377\204>\b\377"
+ 105      08FF853E 
+ 105      08FF853E 
+ 105      08FF853E 
+ 105      08FF843E 
+ 106 058c 843E08FF 		.ascii	"\204>\b\377\204>\b\377\204>\b\377\204>\b\377\204>\b\377\204="
+ 106      843E08FF 
+ 106      843E08FF 
+ 106      843E08FF 
+ 106      843E08FF 
+ 107 05a2 08FF843D 		.ascii	"\b\377\204=\b\377\204=\b\377\204=\b\377\204=\b\377\204=\b\377"
+ 107      08FF843D 
+ 107      08FF843D 
+ 107      08FF843D 
+ 107      08FF843D 
+GAS LISTING /tmp/ccRe9WAw.s 			page 8
+
+
+ 108 05b8 833D08FF 		.ascii	"\203=\b\377\203=\b\377\203=\b\377\203=\b\377\203=\b\377\203="
+ 108      833D08FF 
+ 108      833D08FF 
+ 108      833D08FF 
+ 108      833D08FF 
+ 109 05ce 08FF833D 		.ascii	"\b\377\203=\b\377\203=\b\377\203=\b\377\203=\b\377\203=\b\377"
+ 109      08FF833D 
+ 109      08FF833D 
+ 109      08FF833D 
+ 109      08FF833D 
+ 110 05e4 833D08FF 		.ascii	"\203=\b\377\203=\b\377\203=\b\377\203=\b\377\202=\b\377\202="
+ 110      833D08FF 
+ 110      833D08FF 
+ 110      833D08FF 
+ 110      823D08FF 
+ 111 05fa 08FF823D 		.ascii	"\b\377\202=\b\377\202=\b\377\202=\b\377\202<\b\377\202<\b\377"
+ 111      08FF823D 
+ 111      08FF823D 
+ 111      08FF823C 
+ 111      08FF823C 
+ 112 0610 823C08FF 		.ascii	"\202<\b\377\202<\b\377\202<\b\377\202<\b\377\202<\b\377\202<"
+ 112      823C08FF 
+ 112      823C08FF 
+ 112      823C08FF 
+ 112      823C08FF 
+ 113 0626 08FF823C 		.ascii	"\b\377\202<\b\377\202<\b\377\202<\b\377\202<\b\377\202<\b\377"
+ 113      08FF823C 
+ 113      08FF823C 
+ 113      08FF823C 
+ 113      08FF823C 
+ 114 063c 813C08FF 		.ascii	"\201<\b\377\201<\b\377\201<\b\377\201<\b\377\201<\b\377\201<"
+ 114      813C08FF 
+ 114      813C08FF 
+ 114      813C08FF 
+ 114      813C08FF 
+ 115 0652 08FF813C 		.ascii	"\b\377\201<\b\377\201<\b\377\201<\b\377\201<\b\377\201<\b\377"
+ 115      08FF813C 
+ 115      08FF813C 
+ 115      08FF813C 
+ 115      08FF813C 
+ 116 0668 813C08FF 		.ascii	"\201<\b\377\201<\b\377\201<\b\377\201<\b\377\201<\b\377\201<"
+ 116      813C08FF 
+ 116      813C08FF 
+ 116      813C08FF 
+ 116      813C08FF 
+ 117 067e 08FF813C 		.ascii	"\b\377\201<\b\377\201<\b\377\201<\b\377\201<\b\377\201<\b\377"
+ 117      08FF813C 
+ 117      08FF813C 
+ 117      08FF813C 
+ 117      08FF813C 
+ 118 0694 813C08FF 		.ascii	"\201<\b\377\201<\b\377\201<\b\377\200<\b\377\200<\b\377\200<"
+ 118      813C08FF 
+ 118      813C08FF 
+ 118      803C08FF 
+ 118      803C08FF 
+ 119 06aa 08FF803C 		.ascii	"\b\377\200<\b\377\200<\b\377\200;\b\377\200;\b\377\200;\b\377"
+ 119      08FF803C 
+GAS LISTING /tmp/ccRe9WAw.s 			page 9
+
+
+ 119      08FF803B 
+ 119      08FF803B 
+ 119      08FF803B 
+ 120 06c0 803B08FF 		.ascii	"\200;\b\377\200;\b\377\200;\b\377\200;\b\377\200;\b\377\200;"
+ 120      803B08FF 
+ 120      803B08FF 
+ 120      803B08FF 
+ 120      803B08FF 
+ 121 06d6 08FF803B 		.ascii	"\b\377\200;\b\377\200;\b\377\200;\b\377\200;\b\377\200;\b\377"
+ 121      08FF803B 
+ 121      08FF803B 
+ 121      08FF803B 
+ 121      08FF803B 
+ 122 06ec 803B08FF 		.ascii	"\200;\b\377\200;\b\377\200;\b\377\200;\b\377\200;\b\377\200;"
+ 122      803B08FF 
+ 122      803B08FF 
+ 122      803B08FF 
+ 122      803B08FF 
+ 123 0702 08FF803B 		.ascii	"\b\377\200;\b\377\200;\b\377\200;\b\377\200;\b\377\200;\b\377"
+ 123      08FF803B 
+ 123      08FF803B 
+ 123      08FF803B 
+ 123      08FF803B 
+ 124 0718 803B08FF 		.ascii	"\200;\b\377\200;\b\377\200;\b\377\200;\b\377\200;\b\377\200;"
+ 124      803B08FF 
+ 124      803B08FF 
+ 124      803B08FF 
+ 124      803B08FF 
+ 125 072e 08FF803B 		.ascii	"\b\377\200;\b\377\200;\b\377\200;\b\377\200;\b\377\177;\b\377"
+ 125      08FF803B 
+ 125      08FF803B 
+ 125      08FF803B 
+ 125      08FF7F3B 
+ 126 0744 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 126      7F3B08FF 
+ 126      7F3B08FF 
+ 126      7F3B08FF 
+ 126      7F3B08FF 
+ 127 075a 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 127      08FF7F3B 
+ 127      08FF7F3B 
+ 127      08FF7F3B 
+ 127      08FF7F3B 
+ 128 0770 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 128      7F3B08FF 
+ 128      7F3B08FF 
+ 128      7F3B08FF 
+ 128      7F3B08FF 
+ 129 0786 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 129      08FF7F3B 
+ 129      08FF7F3B 
+ 129      08FF7F3B 
+ 129      08FF7F3B 
+ 130 079c 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 130      7F3B08FF 
+ 130      7F3B08FF 
+ 130      7F3B08FF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 10
+
+
+ 130      7F3B08FF 
+ 131 07b2 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 131      08FF7F3B 
+ 131      08FF7F3B 
+ 131      08FF7F3B 
+ 131      08FF7F3B 
+ 132 07c8 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377"
+ 132      7F3B08FF 
+ 133 07d0 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 133      7F3B08FF 
+ 133      7F3B08FF 
+ 133      7F3B08FF 
+ 133      7F3B08FF 
+ 134 07e6 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 134      08FF7F3B 
+ 134      08FF7F3B 
+ 134      08FF7F3B 
+ 134      08FF7F3B 
+ 135 07fc 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 135      7F3B08FF 
+ 135      7F3B08FF 
+ 135      7F3B08FF 
+ 135      7F3B08FF 
+ 136 0812 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 136      08FF7F3B 
+ 136      08FF7F3B 
+ 136      08FF7F3B 
+ 136      08FF7F3B 
+ 137 0828 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 137      7F3B08FF 
+ 137      7F3B08FF 
+ 137      7F3B08FF 
+ 137      7F3B08FF 
+ 138 083e 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 138      08FF7F3B 
+ 138      08FF7F3B 
+ 138      08FF7F3B 
+ 138      08FF7F3B 
+ 139 0854 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 139      7F3B08FF 
+ 139      7F3B08FF 
+ 139      7F3B08FF 
+ 139      7F3B08FF 
+ 140 086a 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 140      08FF7F3B 
+ 140      08FF7F3B 
+ 140      08FF7F3B 
+ 140      08FF7F3B 
+ 141 0880 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 141      7F3B08FF 
+ 141      7F3B08FF 
+ 141      7F3B08FF 
+ 141      7F3B08FF 
+ 142 0896 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 142      08FF7F3B 
+ 142      08FF7F3B 
+ 142      08FF7F3B 
+GAS LISTING /tmp/ccRe9WAw.s 			page 11
+
+
+ 142      08FF7F3B 
+ 143 08ac 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 143      7F3B08FF 
+ 143      7F3B08FF 
+ 143      7F3B08FF 
+ 143      7F3B08FF 
+ 144 08c2 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 144      08FF7F3B 
+ 144      08FF7F3B 
+ 144      08FF7F3B 
+ 144      08FF7F3B 
+ 145 08d8 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 145      7F3B08FF 
+ 145      7F3B08FF 
+ 145      7F3B08FF 
+ 145      7F3B08FF 
+ 146 08ee 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 146      08FF7F3B 
+ 146      08FF7F3B 
+ 146      08FF7F3B 
+ 146      08FF7F3B 
+ 147 0904 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 147      7F3B08FF 
+ 147      7F3B08FF 
+ 147      7F3B08FF 
+ 147      7F3B08FF 
+ 148 091a 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 148      08FF7F3B 
+ 148      08FF7F3B 
+ 148      08FF7F3B 
+ 148      08FF7F3B 
+ 149 0930 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 149      7F3B08FF 
+ 149      7F3B08FF 
+ 149      7F3B08FF 
+ 149      7F3B08FF 
+ 150 0946 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 150      08FF7F3B 
+ 150      08FF7F3B 
+ 150      08FF7F3B 
+ 150      08FF7F3B 
+ 151 095c 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 151      7F3B08FF 
+ 151      7F3B08FF 
+ 151      7F3B08FF 
+ 151      7F3B08FF 
+ 152 0972 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 152      08FF7F3B 
+ 152      08FF7F3B 
+ 152      08FF7F3B 
+ 152      08FF7F3B 
+ 153 0988 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 153      7F3B08FF 
+ 153      7F3B08FF 
+ 153      7F3B08FF 
+ 153      7F3B08FF 
+ 154 099e 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+GAS LISTING /tmp/ccRe9WAw.s 			page 12
+
+
+ 154      08FF7F3B 
+ 154      08FF7F3B 
+ 154      08FF7F3B 
+ 154      08FF7F3B 
+ 155 09b4 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 155      7F3B08FF 
+ 155      7F3B08FF 
+ 155      7F3B08FF 
+ 155      7F3B08FF 
+ 156 09ca 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 156      08FF7F3B 
+ 156      08FF7F3B 
+ 156      08FF7F3B 
+ 156      08FF7F3B 
+ 157 09e0 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 157      7F3B08FF 
+ 157      7F3B08FF 
+ 157      7F3B08FF 
+ 157      7F3B08FF 
+ 158 09f6 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 158      08FF7F3B 
+ 158      08FF7F3B 
+ 158      08FF7F3B 
+ 158      08FF7F3B 
+ 159 0a0c 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 159      7F3B08FF 
+ 159      7F3B08FF 
+ 159      7F3B08FF 
+ 159      7F3B08FF 
+ 160 0a22 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 160      08FF7F3B 
+ 160      08FF7F3B 
+ 160      08FF7F3B 
+ 160      08FF7F3B 
+ 161 0a38 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 161      7F3B08FF 
+ 161      7F3B08FF 
+ 161      7F3B08FF 
+ 161      7F3B08FF 
+ 162 0a4e 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 162      08FF7F3B 
+ 162      08FF7F3B 
+ 162      08FF7F3B 
+ 162      08FF7F3B 
+ 163 0a64 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 163      7F3B08FF 
+ 163      7F3B08FF 
+ 163      7F3B08FF 
+ 163      7F3B08FF 
+ 164 0a7a 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 164      08FF7F3B 
+ 164      08FF7F3B 
+ 164      08FF7F3B 
+ 164      08FF7F3B 
+ 165 0a90 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 165      7F3B08FF 
+ 165      7F3B08FF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 13
+
+
+ 165      7F3B08FF 
+ 165      7F3B08FF 
+ 166 0aa6 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 166      08FF7F3B 
+ 166      08FF7F3B 
+ 166      08FF7F3B 
+ 166      08FF7F3B 
+ 167 0abc 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 167      7F3B08FF 
+ 167      7F3B08FF 
+ 167      7F3B08FF 
+ 167      7F3B08FF 
+ 168 0ad2 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 168      08FF7F3B 
+ 168      08FF7F3B 
+ 168      08FF7F3B 
+ 168      08FF7F3B 
+ 169 0ae8 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 169      7F3B08FF 
+ 169      7F3B08FF 
+ 169      7F3B08FF 
+ 169      7F3B08FF 
+ 170 0afe 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 170      08FF7F3B 
+ 170      08FF7F3B 
+ 170      08FF7F3B 
+ 170      08FF7F3B 
+ 171 0b14 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 171      7F3B08FF 
+ 171      7F3B08FF 
+ 171      7F3B08FF 
+ 171      7F3B08FF 
+ 172 0b2a 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 172      08FF7F3B 
+ 172      08FF7F3B 
+ 172      08FF7F3B 
+ 172      08FF7F3B 
+ 173 0b40 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 173      7F3B08FF 
+ 173      7F3B08FF 
+ 173      7F3B08FF 
+ 173      7F3B08FF 
+ 174 0b56 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 174      08FF7F3B 
+ 174      08FF7F3B 
+ 174      08FF7F3B 
+ 174      08FF7F3B 
+ 175 0b6c 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 175      7F3B08FF 
+ 175      7F3B08FF 
+ 175      7F3B08FF 
+ 175      7F3B08FF 
+ 176 0b82 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 176      08FF7F3B 
+ 176      08FF7F3B 
+ 176      08FF7F3B 
+ 176      08FF7F3B 
+GAS LISTING /tmp/ccRe9WAw.s 			page 14
+
+
+ 177 0b98 7F3B08FF 		.ascii	"\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;"
+ 177      7F3B08FF 
+ 177      7F3B08FF 
+ 177      7F3B08FF 
+ 177      7F3B08FF 
+ 178 0bae 08FF7F3B 		.ascii	"\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377\177;\b\377"
+ 178      08FF7F3B 
+ 178      08FF7F3B 
+ 178      08FF7F3B 
+ 178      08FF7F3B 
+ 179 0bc4 7F3B07FF 		.ascii	"\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007"
+ 179      7F3B07FF 
+ 179      7F3B07FF 
+ 179      7F3B07FF 
+ 179      7F3B07
+ 180 0bd7 FF7F3B07 		.ascii	"\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177"
+ 180      FF7F3B07 
+ 180      FF7F3B07 
+ 180      FF7F3B07 
+ 180      FF7F
+ 181 0be9 3B07FF7F 		.ascii	";\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377"
+ 181      3B07FF7F 
+ 181      3B07FF7F 
+ 181      3B07FF7F 
+ 181      3B07FF
+ 182 0bfc 7F3B07FF 		.ascii	"\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007"
+ 182      7F3B07FF 
+ 182      7F3B07FF 
+ 182      7F3B07FF 
+ 182      7F3B07
+ 183 0c0f FF7F3B07 		.ascii	"\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177"
+ 183      FF7F3B07 
+ 183      FF7F3B07 
+ 183      FF7F3B07 
+ 183      FF7F
+ 184 0c21 3B07FF7F 		.ascii	";\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377"
+ 184      3B07FF7F 
+ 184      3B07FF7F 
+ 184      3B07FF7F 
+ 184      3B07FF
+ 185 0c34 7F3B07FF 		.ascii	"\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007"
+ 185      7F3B07FF 
+ 185      7F3B07FF 
+ 185      7F3B07FF 
+ 185      7F3B07
+ 186 0c47 FF7F3B07 		.ascii	"\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177"
+ 186      FF7F3B07 
+ 186      FF7F3B07 
+ 186      FF7F3B07 
+ 186      FF7F
+ 187 0c59 3B07FF7F 		.ascii	";\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377"
+ 187      3B07FF7F 
+ 187      3B07FF7F 
+ 187      3B07FF7F 
+ 187      3B07FF
+ 188 0c6c 7F3B07FF 		.ascii	"\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007"
+ 188      7F3B07FF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 15
+
+
+ 188      7F3B07FF 
+ 188      7F3B07FF 
+ 188      7F3B07
+ 189 0c7f FF7F3B07 		.ascii	"\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177"
+ 189      FF7F3B07 
+ 189      FF7F3B07 
+ 189      FF7F3B07 
+ 189      FF7F
+ 190 0c91 3B07FF7F 		.ascii	";\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377"
+ 190      3B07FF7F 
+ 190      3B07FF7F 
+ 190      3B07FF7F 
+ 190      3B07FF
+ 191 0ca4 7F3B07FF 		.ascii	"\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007"
+ 191      7F3B07FF 
+ 191      7F3B07FF 
+ 191      7F3B07FF 
+ 191      7F3B07
+ 192 0cb7 FF7F3B07 		.ascii	"\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177"
+ 192      FF7F3B07 
+ 192      FF7F3B07 
+ 192      FF7F3B07 
+ 192      FF7F
+ 193 0cc9 3B07FF7F 		.ascii	";\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377"
+ 193      3B07FF7F 
+ 193      3B07FF7F 
+ 193      3B07FF7F 
+ 193      3B07FF
+ 194 0cdc 7F3B07FF 		.ascii	"\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007"
+ 194      7F3B07FF 
+ 194      7F3B07FF 
+ 194      7F3B07FF 
+ 194      7F3B07
+ 195 0cef FF7F3B07 		.ascii	"\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177"
+ 195      FF7F3B07 
+ 195      FF7F3B07 
+ 195      FF7F3B07 
+ 195      FF7F
+ 196 0d01 3B07FF7F 		.ascii	";\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377"
+ 196      3B07FF7F 
+ 196      3B07FF7F 
+ 196      3B07FF7F 
+ 196      3B07FF
+ 197 0d14 7F3B07FF 		.ascii	"\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007"
+ 197      7F3B07FF 
+ 197      7F3B07FF 
+ 197      7F3B07FF 
+ 197      7F3B07
+ 198 0d27 FF7F3B07 		.ascii	"\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377\177"
+ 198      FF7F3B07 
+ 198      FF7F3B07 
+ 198      FF7F3B07 
+ 198      FF7F
+ 199 0d39 3B07FF7F 		.ascii	";\007\377\177;\007\377\177;\007\377\177;\007\377\177;\007\377"
+ 199      3B07FF7F 
+ 199      3B07FF7F 
+ 199      3B07FF7F 
+GAS LISTING /tmp/ccRe9WAw.s 			page 16
+
+
+ 199      3B07FF
+ 200 0d4c 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 200      7E3B07FF 
+ 200      7E3B07FF 
+ 200      7E3B07FF 
+ 200      7E3B07FF 
+ 201 0d64 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 201      7E3B07FF 
+ 201      7E3B07FF 
+ 201      7E3B07FF 
+ 201      7E3B07FF 
+ 202 0d7c 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 202      7E3B07FF 
+ 202      7E3B07FF 
+ 202      7E3B07FF 
+ 202      7E3B07FF 
+ 203 0d94 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 203      7E3B07FF 
+ 203      7E3B07FF 
+ 203      7E3B07FF 
+ 203      7E3B07FF 
+ 204 0dac 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 204      7E3B07FF 
+ 204      7E3B07FF 
+ 204      7E3B07FF 
+ 204      7E3B07FF 
+ 205 0dc4 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 205      7E3B07FF 
+ 205      7E3B07FF 
+ 205      7E3B07FF 
+ 205      7E3B07FF 
+ 206 0ddc 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 206      7E3B07FF 
+ 206      7E3B07FF 
+ 206      7E3B07FF 
+ 206      7E3B07FF 
+ 207 0df4 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 207      7E3B07FF 
+ 207      7E3B07FF 
+ 207      7E3B07FF 
+ 207      7E3B07FF 
+ 208 0e0c 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 208      7E3B07FF 
+ 208      7E3B07FF 
+ 208      7E3B07FF 
+ 208      7E3B07FF 
+ 209 0e24 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 209      7E3B07FF 
+ 209      7E3B07FF 
+ 209      7E3B07FF 
+ 209      7E3B07FF 
+ 210 0e3c 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 210      7E3B07FF 
+ 210      7E3B07FF 
+ 210      7E3B07FF 
+ 210      7E3B07FF 
+ 211 0e54 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+GAS LISTING /tmp/ccRe9WAw.s 			page 17
+
+
+ 211      7E3B07FF 
+ 211      7E3B07FF 
+ 211      7E3B07FF 
+ 211      7E3B07FF 
+ 212 0e6c 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 212      7E3B07FF 
+ 212      7E3B07FF 
+ 212      7E3B07FF 
+ 212      7E3B07FF 
+ 213 0e84 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 213      7E3B07FF 
+ 213      7E3B07FF 
+ 213      7E3B07FF 
+ 213      7E3B07FF 
+ 214 0e9c 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 214      7E3B07FF 
+ 214      7E3B07FF 
+ 214      7E3B07FF 
+ 214      7E3B07FF 
+ 215 0eb4 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 215      7E3B07FF 
+ 215      7E3B07FF 
+ 215      7E3B07FF 
+ 215      7E3B07FF 
+ 216 0ecc 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 216      7E3B07FF 
+ 216      7E3B07FF 
+ 216      7E3B07FF 
+ 216      7E3B07FF 
+ 217 0ee4 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 217      7E3B07FF 
+ 217      7E3B07FF 
+ 217      7E3B07FF 
+ 217      7E3B07FF 
+ 218 0efc 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 218      7E3B07FF 
+ 218      7E3B07FF 
+ 218      7E3B07FF 
+ 218      7E3B07FF 
+ 219 0f14 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 219      7E3B07FF 
+ 219      7E3B07FF 
+ 219      7E3B07FF 
+ 219      7E3B07FF 
+ 220 0f2c 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 220      7E3B07FF 
+ 220      7E3B07FF 
+ 220      7E3B07FF 
+ 220      7E3B07FF 
+ 221 0f44 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 221      7E3B07FF 
+ 221      7E3B07FF 
+ 221      7E3B07FF 
+ 221      7E3B07FF 
+ 222 0f5c 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 222      7E3B07FF 
+ 222      7E3B07FF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 18
+
+
+ 222      7E3B07FF 
+ 222      7E3B07FF 
+ 223 0f74 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 223      7E3B07FF 
+ 223      7E3B07FF 
+ 223      7E3B07FF 
+ 223      7E3B07FF 
+ 224 0f8c 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 224      7E3B07FF 
+ 224      7E3B07FF 
+ 224      7E3B07FF 
+ 224      7E3B07FF 
+ 225 0fa0 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 225      7E3B07FF 
+ 225      7E3B07FF 
+ 225      7E3B07FF 
+ 225      7E3B07FF 
+ 226 0fb8 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 226      7E3B07FF 
+ 226      7E3B07FF 
+ 226      7E3B07FF 
+ 226      7E3B07FF 
+ 227 0fd0 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 227      7E3B07FF 
+ 227      7E3B07FF 
+ 227      7E3B07FF 
+ 227      7E3B07FF 
+ 228 0fe8 7E3B07FF 		.ascii	"~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377~;\007\377"
+ 228      7E3B07FF 
+ 228      7E3B07FF 
+ 228      7E3B07FF 
+ 228      7E3B07FF 
+ 229 1000 7E3B07FF 		.ascii	"~;\007\377"
+ 230              		.globl	heatmap_cs_PuOr_mixed
+ 231              		.section	.data.rel.local
+ 232              		.align 8
+ 233              		.type	heatmap_cs_PuOr_mixed, @object
+ 234              		.size	heatmap_cs_PuOr_mixed, 8
+ 235              	heatmap_cs_PuOr_mixed:
+ 236 0008 00000000 		.quad	mixed
+ 236      00000000 
+ 237              		.section	.data.rel.ro.local
+ 238              		.align 16
+ 239              		.type	mixed, @object
+ 240              		.size	mixed, 16
+ 241              	mixed:
+ 242 0010 00000000 		.quad	mixed_data
+ 242      00000000 
+ 243 0018 01040000 		.quad	1025
+ 243      00000000 
+ 244              		.section	.rodata
+ 245 1004 00000000 		.align 32
+ 245      00000000 
+ 245      00000000 
+ 245      00000000 
+ 245      00000000 
+ 246              		.type	mixed_data, @object
+GAS LISTING /tmp/ccRe9WAw.s 			page 19
+
+
+ 247              		.size	mixed_data, 4100
+ 248              	mixed_data:
+ 249 1020 00       		.string	""
+ 250 1021 00       		.string	""
+ 251 1022 00       		.string	""
+ 252 1023 00       		.string	""
+ 253 1024 2C00     		.string	","
+ 254 1026 4B00     		.string	"K"
+ 255 1028 2D00     		.string	"-"
+ 256 102a 4B072D00 		.string	"K\007-"
+ 257 102e 4B0E2D00 		.string	"K\016-"
+ 258 1032 4C162E00 		.string	"L\026."
+ 259 1036 4C1D2E01 		.ascii	"L\035.\001M%.\001M,/\001N4/\001N;/\001OC0\002OJ0\002OR0\002P"
+ 259      4D252E01 
+ 259      4D2C2F01 
+ 259      4E342F01 
+ 259      4E3B2F01 
+ 260 1057 59300250 		.ascii	"Y0\002Pa1\003Qh1\003Qp1\003Rw2\003R\1772\004S\2062\004S\2153"
+ 260      61310351 
+ 260      68310351 
+ 260      70310352 
+ 260      77320352 
+ 261 1075 04549533 		.ascii	"\004T\2253\005T\2343\005T\2444\005U\2534\006U\2634\006V\2724"
+ 261      05549C33 
+ 261      0554A434 
+ 261      0555AB34 
+ 261      0655B334 
+ 262 108d 0656C235 		.ascii	"\006V\3025\007W\3115\007W\3215\007X\3306\bX\3406\bY\3476\bY\357"
+ 262      0757C935 
+ 262      0757D135 
+ 262      0758D836 
+ 262      0858E036 
+ 263 10a8 37095AF6 		.ascii	"7\tZ\3667\tZ\3767\tZ\3778\n[\3778\n[\3778\n\\\3778\013\\\377"
+ 263      37095AFE 
+ 263      37095AFF 
+ 263      380A5BFF 
+ 263      380A5BFF 
+ 264 10c4 390B5DFF 		.ascii	"9\013]\3779\013]\3779\f^\377:\f^\377:\f_\377:\r_\377;\r`\377"
+ 264      390B5DFF 
+ 264      390C5EFF 
+ 264      3A0C5EFF 
+ 264      3A0C5FFF 
+ 265 10e0 3B0D60FF 		.ascii	";\r`\377;\016a\377<\016a\377<\016b\377<\017b\377D\027o\377E\027"
+ 265      3B0E61FF 
+ 265      3C0E61FF 
+ 265      3C0E62FF 
+ 265      3C0F62FF 
+ 266 10fa 6FFF4517 		.ascii	"o\377E\027p\377E\030p\377E\030q\377F\030q\377F\031r\377F\031"
+ 266      70FF4518 
+ 266      70FF4518 
+ 266      71FF4618 
+ 266      71FF4619 
+ 267 1112 72FF4719 		.ascii	"r\377G\031s\377G\032s\377G\032t\377H\032t\377H\032t\377H\033"
+ 267      73FF471A 
+ 267      73FF471A 
+ 267      74FF481A 
+ 267      74FF481A 
+GAS LISTING /tmp/ccRe9WAw.s 			page 20
+
+
+ 268 112a 75FF481B 		.ascii	"u\377H\033u\377I\033v\377I\034v\377I\034w\377J\034w\377J\035"
+ 268      75FF491B 
+ 268      76FF491C 
+ 268      76FF491C 
+ 268      77FF4A1C 
+ 269 1142 78FF4A1D 		.ascii	"x\377J\035x\377K\035y\377K\036y\377K\036z\377L\036z\377L\037"
+ 269      78FF4B1D 
+ 269      79FF4B1E 
+ 269      79FF4B1E 
+ 269      7AFF4C1E 
+ 270 115a 7BFF4C1F 		.ascii	"{\377L\037{\377L\037|\377M |\377M }\377M }\377N ~\377N!~\377"
+ 270      7BFF4C1F 
+ 270      7CFF4D20 
+ 270      7CFF4D20 
+ 270      7DFF4D20 
+ 271 1178 4E217FFF 		.ascii	"N!\177\377O!\177\377O\"\200\377O\"\200\377O\"\201\377P#\201\377"
+ 271      4F217FFF 
+ 271      4F2280FF 
+ 271      4F2280FF 
+ 271      4F2281FF 
+ 272 1190 502382FF 		.ascii	"P#\202\377P#\202\377Q$\203\377Q$\203\377Q$\204\377R$\204\377"
+ 272      502382FF 
+ 272      512483FF 
+ 272      512483FF 
+ 272      512484FF 
+ 273 11a8 522585FF 		.ascii	"R%\205\377R%\205\377R%\206\377S&\206\377S&\207\377S&\207\377"
+ 273      522585FF 
+ 273      522586FF 
+ 273      532686FF 
+ 273      532687FF 
+ 274 11c0 542788FF 		.ascii	"T'\210\377T(\210\377T(\210\377U)\211\377U*\211\377U*\211\377"
+ 274      542888FF 
+ 274      542888FF 
+ 274      552989FF 
+ 274      552A89FF 
+ 275 11d8 552B8AFF 		.ascii	"U+\212\377V,\212\377V,\212\377V-\213\377W.\213\377W.\213\377"
+ 275      562C8AFF 
+ 275      562C8AFF 
+ 275      562D8BFF 
+ 275      572E8BFF 
+ 276 11f0 572F8CFF 		.ascii	"W/\214\377X/\214\377X0\214\377X1\214\377Y1\215\377Y2\215\377"
+ 276      582F8CFF 
+ 276      58308CFF 
+ 276      58318CFF 
+ 276      59318DFF 
+ 277 1208 59338DFF 		.ascii	"Y3\215\377Y3\216\377Z4\216\377Z4\216\377Z5\217\377[6\217\377"
+ 277      59338EFF 
+ 277      5A348EFF 
+ 277      5A348EFF 
+ 277      5A358FFF 
+ 278 1220 5B368FFF 		.ascii	"[6\217\377[7\220\377\\8\220\377\\8\220\377\\9\220\377]9\221\377"
+ 278      5B3790FF 
+ 278      5C3890FF 
+ 278      5C3890FF 
+ 278      5C3990FF 
+ 279 1238 5D3A91FF 		.ascii	"]:\221\377];\221\377^;\222\377^<\222\377^<\222\377_=\223\377"
+ 279      5D3B91FF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 21
+
+
+ 279      5E3B92FF 
+ 279      5E3C92FF 
+ 279      5E3C92FF 
+ 280 1250 5F3E93FF 		.ascii	"_>\223\377_>\223\377`?\223\377`?\224\377`@\224\377a@\224\377"
+ 280      5F3E93FF 
+ 280      603F93FF 
+ 280      603F94FF 
+ 280      604094FF 
+ 281 1268 614195FF 		.ascii	"aA\225\377aB\225\377bB\225\377bC\225\377bC\226\377cD\226\377"
+ 281      614295FF 
+ 281      624295FF 
+ 281      624395FF 
+ 281      624396FF 
+ 282 1280 634596FF 		.ascii	"cE\226\377cE\227\377dF\227\377mV\236\377mV\237\377mW\237\377"
+ 282      634597FF 
+ 282      644697FF 
+ 282      6D569EFF 
+ 282      6D569FFF 
+ 283 1298 6E579FFF 		.ascii	"nW\237\377nX\237\377nX\240\377oY\240\377oZ\240\377pZ\241\377"
+ 283      6E589FFF 
+ 283      6E58A0FF 
+ 283      6F59A0FF 
+ 283      6F5AA0FF 
+ 284 12b0 705BA1FF 		.ascii	"p[\241\377p[\241\377q\\\241\377q\\\242\377q]\242\377r^\242\377"
+ 284      705BA1FF 
+ 284      715CA1FF 
+ 284      715CA2FF 
+ 284      715DA2FF 
+ 285 12c8 725EA2FF 		.ascii	"r^\242\377r_\243\377s_\243\377s`\243\377s`\244\377ta\244\377"
+ 285      725FA3FF 
+ 285      735FA3FF 
+ 285      7360A3FF 
+ 285      7360A4FF 
+ 286 12e0 7462A4FF 		.ascii	"tb\244\377ub\244\377uc\245\377uc\245\377vd\245\377vd\245\377"
+ 286      7562A4FF 
+ 286      7563A5FF 
+ 286      7563A5FF 
+ 286      7664A5FF 
+ 287 12f8 7665A6FF 		.ascii	"ve\246\377wf\246\377wf\246\377wg\246\377xg\247\377xh\247\377"
+ 287      7766A6FF 
+ 287      7766A6FF 
+ 287      7767A6FF 
+ 287      7867A7FF 
+ 288 1310 7968A7FF 		.ascii	"yh\247\377yi\247\377yj\250\377zj\250\377zk\250\377{k\250\377"
+ 288      7969A7FF 
+ 288      796AA8FF 
+ 288      7A6AA8FF 
+ 288      7A6BA8FF 
+ 289 1328 7B6CA9FF 		.ascii	"{l\251\377{l\251\377|m\251\377|n\251\377|n\252\377}o\252\377"
+ 289      7B6CA9FF 
+ 289      7C6DA9FF 
+ 289      7C6EA9FF 
+ 289      7C6EAAFF 
+ 290 1340 7D6FAAFF 		.ascii	"}o\252\377~p\252\377~p\253\377~q\253\377\177q\253\377\177r\253"
+ 290      7E70AAFF 
+ 290      7E70ABFF 
+ 290      7E71ABFF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 22
+
+
+ 290      7F71ABFF 
+ 291 1357 FF8073AC 		.ascii	"\377\200s\254\377\200s\254\377\200s\254\377\201t\254\377\201"
+ 291      FF8073AC 
+ 291      FF8073AC 
+ 291      FF8174AC 
+ 291      FF81
+ 292 1369 74ADFF81 		.ascii	"t\255\377\201u\255\377\202u\255\377\202v\256\377\203v\256\377"
+ 292      75ADFF82 
+ 292      75ADFF82 
+ 292      76AEFF83 
+ 292      76AEFF
+ 293 137c 8376AEFF 		.ascii	"\203v\256\377\203w\257\377\204w\257\377\204x\257\377\205x\257"
+ 293      8377AFFF 
+ 293      8477AFFF 
+ 293      8478AFFF 
+ 293      8578AF
+ 294 138f FF8579B0 		.ascii	"\377\205y\260\377\205y\260\377\206y\260\377\206z\261\377\206"
+ 294      FF8579B0 
+ 294      FF8679B0 
+ 294      FF867AB1 
+ 294      FF86
+ 295 13a1 7AB1FF87 		.ascii	"z\261\377\207{\261\377\207{\262\377\210|\262\377\210|\262\377"
+ 295      7BB1FF87 
+ 295      7BB2FF88 
+ 295      7CB2FF88 
+ 295      7CB2FF
+ 296 13b4 887CB2FF 		.ascii	"\210|\262\377\211}\263\377\211}\263\377\211~\263\377\212~\264"
+ 296      897DB3FF 
+ 296      897DB3FF 
+ 296      897EB3FF 
+ 296      8A7EB4
+ 297 13c7 FF8A7FB4 		.ascii	"\377\212\177\264\377\213\177\264\377\213\177\264\377\213\200"
+ 297      FF8B7FB4 
+ 297      FF8B7FB4 
+ 297      FF8B80
+ 298 13d6 B5FF8C80 		.ascii	"\265\377\214\200\265\377\214\201\265\377\215\201\266\377\215"
+ 298      B5FF8C81 
+ 298      B5FF8D81 
+ 298      B6FF8D
+ 299 13e5 82B6FF8D 		.ascii	"\202\266\377\215\202\266\377\216\203\267\377\216\203\267\377"
+ 299      82B6FF8E 
+ 299      83B7FF8E 
+ 299      83B7FF
+ 300 13f4 8E83B7FF 		.ascii	"\216\203\267\377\217\204\267\377\217\204\270\377\220\205\270"
+ 300      8F84B7FF 
+ 300      8F84B8FF 
+ 300      9085B8
+ 301 1403 FF9085B8 		.ascii	"\377\220\205\270\377\220\206\271\377\221\206\271\377\221\206"
+ 301      FF9086B9 
+ 301      FF9186B9 
+ 301      FF9186
+ 302 1412 B9FF9287 		.ascii	"\271\377\222\207\272\377\222\207\272\377\222\210\272\377\223"
+ 302      BAFF9287 
+ 302      BAFF9288 
+ 302      BAFF93
+ 303 1421 88BAFF9D 		.ascii	"\210\272\377\235\224\302\377\236\224\303\377\236\225\303\377"
+ 303      94C2FF9E 
+GAS LISTING /tmp/ccRe9WAw.s 			page 23
+
+
+ 303      94C3FF9E 
+ 303      95C3FF
+ 304 1430 9E95C3FF 		.ascii	"\236\225\303\377\237\226\304\377\237\226\304\377\237\226\304"
+ 304      9F96C4FF 
+ 304      9F96C4FF 
+ 304      9F96C4
+ 305 143f FFA097C4 		.ascii	"\377\240\227\304\377\240\227\305\377\241\230\305\377\241\230"
+ 305      FFA097C5 
+ 305      FFA198C5 
+ 305      FFA198
+ 306 144e C5FFA199 		.ascii	"\305\377\241\231\306\377\242\231\306\377\242\232\306\377\243"
+ 306      C6FFA299 
+ 306      C6FFA29A 
+ 306      C6FFA3
+ 307 145d 9AC6FFA3 		.ascii	"\232\306\377\243\232\307\377\243\233\307\377\244\233\307\377"
+ 307      9AC7FFA3 
+ 307      9BC7FFA4 
+ 307      9BC7FF
+ 308 146c A49CC8FF 		.ascii	"\244\234\310\377\245\234\310\377\245\235\310\377\245\235\311"
+ 308      A59CC8FF 
+ 308      A59DC8FF 
+ 308      A59DC9
+ 309 147b FFA69DC9 		.ascii	"\377\246\235\311\377\246\236\311\377\247\236\311\377\247\237"
+ 309      FFA69EC9 
+ 309      FFA79EC9 
+ 309      FFA79F
+ 310 148a CAFFA79F 		.ascii	"\312\377\247\237\312\377\250\240\312\377\250\240\313\377\251"
+ 310      CAFFA8A0 
+ 310      CAFFA8A0 
+ 310      CBFFA9
+ 311 1499 A1CBFFA9 		.ascii	"\241\313\377\251\241\313\377\251\241\314\377\252\242\314\377"
+ 311      A1CBFFA9 
+ 311      A1CCFFAA 
+ 311      A2CCFF
+ 312 14a8 AAA2CCFF 		.ascii	"\252\242\314\377\253\243\314\377\253\243\315\377\253\244\315"
+ 312      ABA3CCFF 
+ 312      ABA3CDFF 
+ 312      ABA4CD
+ 313 14b7 FFACA4CD 		.ascii	"\377\254\244\315\377\254\245\316\377\255\245\316\377\255\245"
+ 313      FFACA5CE 
+ 313      FFADA5CE 
+ 313      FFADA5
+ 314 14c6 CEFFADA6 		.ascii	"\316\377\255\246\316\377\256\246\317\377\256\247\317\377\257"
+ 314      CEFFAEA6 
+ 314      CFFFAEA7 
+ 314      CFFFAF
+ 315 14d5 A7CFFFAF 		.ascii	"\247\317\377\257\250\320\377\257\250\320\377\260\251\320\377"
+ 315      A8D0FFAF 
+ 315      A8D0FFB0 
+ 315      A9D0FF
+ 316 14e4 B0A9D1FF 		.ascii	"\260\251\321\377\261\252\321\377\261\252\321\377\261\252\321"
+ 316      B1AAD1FF 
+ 316      B1AAD1FF 
+ 316      B1AAD1
+ 317 14f3 FFB2ABD2 		.ascii	"\377\262\253\322\377\262\253\322\377\262\254\322\377\262\254"
+ 317      FFB2ABD2 
+ 317      FFB2ACD2 
+GAS LISTING /tmp/ccRe9WAw.s 			page 24
+
+
+ 317      FFB2AC
+ 318 1502 D2FFB3AC 		.ascii	"\322\377\263\254\323\377\263\255\323\377\263\255\323\377\263"
+ 318      D3FFB3AD 
+ 318      D3FFB3AD 
+ 318      D3FFB3
+ 319 1511 ADD3FFB4 		.ascii	"\255\323\377\264\256\323\377\264\256\324\377\264\257\324\377"
+ 319      AED3FFB4 
+ 319      AED4FFB4 
+ 319      AFD4FF
+ 320 1520 B5AFD4FF 		.ascii	"\265\257\324\377\265\257\324\377\265\260\324\377\265\260\325"
+ 320      B5AFD4FF 
+ 320      B5B0D4FF 
+ 320      B5B0D5
+ 321 152f FFB6B0D5 		.ascii	"\377\266\260\325\377\266\261\325\377\266\261\325\377\266\261"
+ 321      FFB6B1D5 
+ 321      FFB6B1D5 
+ 321      FFB6B1
+ 322 153e D5FFB7B2 		.ascii	"\325\377\267\262\326\377\267\262\326\377\267\263\326\377\267"
+ 322      D6FFB7B2 
+ 322      D6FFB7B3 
+ 322      D6FFB7
+ 323 154d B3D6FFB8 		.ascii	"\263\326\377\270\263\327\377\270\264\327\377\270\264\327\377"
+ 323      B3D7FFB8 
+ 323      B4D7FFB8 
+ 323      B4D7FF
+ 324 155c B8B4D7FF 		.ascii	"\270\264\327\377\271\265\327\377\271\265\330\377\271\266\330"
+ 324      B9B5D7FF 
+ 324      B9B5D8FF 
+ 324      B9B6D8
+ 325 156b FFBAB6D8 		.ascii	"\377\272\266\330\377\272\266\330\377\272\267\330\377\272\267"
+ 325      FFBAB6D8 
+ 325      FFBAB7D8 
+ 325      FFBAB7
+ 326 157a D9FFBBB7 		.ascii	"\331\377\273\267\331\377\273\270\331\377\273\270\331\377\274"
+ 326      D9FFBBB8 
+ 326      D9FFBBB8 
+ 326      D9FFBC
+ 327 1589 B8D9FFBC 		.ascii	"\270\331\377\274\271\332\377\274\271\332\377\274\272\332\377"
+ 327      B9DAFFBC 
+ 327      B9DAFFBC 
+ 327      BADAFF
+ 328 1598 BDBADAFF 		.ascii	"\275\272\332\377\275\272\332\377\275\273\333\377\276\273\333"
+ 328      BDBADAFF 
+ 328      BDBBDBFF 
+ 328      BEBBDB
+ 329 15a7 FFBEBBDB 		.ascii	"\377\276\273\333\377\276\274\333\377\276\274\333\377\277\275"
+ 329      FFBEBCDB 
+ 329      FFBEBCDB 
+ 329      FFBFBD
+ 330 15b6 DCFFBFBD 		.ascii	"\334\377\277\275\334\377\277\275\334\377\307\307\341\377\310"
+ 330      DCFFBFBD 
+ 330      DCFFC7C7 
+ 330      E1FFC8
+ 331 15c5 C7E1FFC8 		.ascii	"\307\341\377\310\310\341\377\310\310\342\377\310\311\342\377"
+ 331      C8E1FFC8 
+ 331      C8E2FFC8 
+ 331      C9E2FF
+GAS LISTING /tmp/ccRe9WAw.s 			page 25
+
+
+ 332 15d4 C9C9E2FF 		.ascii	"\311\311\342\377\311\311\342\377\311\312\342\377\312\312\343"
+ 332      C9C9E2FF 
+ 332      C9CAE2FF 
+ 332      CACAE3
+ 333 15e3 FFCACAE3 		.ascii	"\377\312\312\343\377\312\313\343\377\313\313\343\377\313\313"
+ 333      FFCACBE3 
+ 333      FFCBCBE3 
+ 333      FFCBCB
+ 334 15f2 E3FFCBCC 		.ascii	"\343\377\313\314\344\377\313\314\344\377\314\315\344\377\314"
+ 334      E4FFCBCC 
+ 334      E4FFCCCD 
+ 334      E4FFCC
+ 335 1601 CDE4FFCC 		.ascii	"\315\344\377\314\315\344\377\315\316\345\377\315\316\345\377"
+ 335      CDE4FFCD 
+ 335      CEE5FFCD 
+ 335      CEE5FF
+ 336 1610 CDCEE5FF 		.ascii	"\315\316\345\377\316\317\345\377\316\317\345\377\316\317\345"
+ 336      CECFE5FF 
+ 336      CECFE5FF 
+ 336      CECFE5
+ 337 161f FFCFD0E6 		.ascii	"\377\317\320\346\377\317\320\346\377\317\321\346\377\320\321"
+ 337      FFCFD0E6 
+ 337      FFCFD1E6 
+ 337      FFD0D1
+ 338 162e E6FFD0D1 		.ascii	"\346\377\320\321\346\377\320\322\347\377\321\322\347\377\321"
+ 338      E6FFD0D2 
+ 338      E7FFD1D2 
+ 338      E7FFD1
+ 339 163d D2E7FFD1 		.ascii	"\322\347\377\321\323\347\377\322\323\347\377\322\323\350\377"
+ 339      D3E7FFD2 
+ 339      D3E7FFD2 
+ 339      D3E8FF
+ 340 164c D2D4E8FF 		.ascii	"\322\324\350\377\323\324\350\377\323\325\350\377\323\325\350"
+ 340      D3D4E8FF 
+ 340      D3D5E8FF 
+ 340      D3D5E8
+ 341 165b FFD4D5E8 		.ascii	"\377\324\325\350\377\324\326\351\377\324\326\351\377\325\326"
+ 341      FFD4D6E9 
+ 341      FFD4D6E9 
+ 341      FFD5D6
+ 342 166a E9FFD5D7 		.ascii	"\351\377\325\327\351\377\325\327\351\377\326\327\351\377\326"
+ 342      E9FFD5D7 
+ 342      E9FFD6D7 
+ 342      E9FFD6
+ 343 1679 D8EAFFD6 		.ascii	"\330\352\377\326\330\352\377\327\331\352\377\327\331\352\377"
+ 343      D8EAFFD7 
+ 343      D9EAFFD7 
+ 343      D9EAFF
+ 344 1688 D7D9EAFF 		.ascii	"\327\331\352\377\350\326\336\377\350\326\336\377\350\326\337"
+ 344      E8D6DEFF 
+ 344      E8D6DEFF 
+ 344      E8D6DF
+ 345 1697 FFE8D7DF 		.ascii	"\377\350\327\337\377\350\327\337\377\350\327\340\377\350\327"
+ 345      FFE8D7DF 
+ 345      FFE8D7E0 
+ 345      FFE8D7
+ 346 16a6 E0FFE8D8 		.ascii	"\340\377\350\330\341\377\350\330\341\377\350\330\341\377\350"
+GAS LISTING /tmp/ccRe9WAw.s 			page 26
+
+
+ 346      E1FFE8D8 
+ 346      E1FFE8D8 
+ 346      E1FFE8
+ 347 16b5 D9E2FFE8 		.ascii	"\331\342\377\350\331\342\377\350\331\342\377\350\331\343\377"
+ 347      D9E2FFE8 
+ 347      D9E2FFE8 
+ 347      D9E3FF
+ 348 16c4 E8DAE3FF 		.ascii	"\350\332\343\377\350\332\343\377\350\332\344\377\350\332\344"
+ 348      E8DAE3FF 
+ 348      E8DAE4FF 
+ 348      E8DAE4
+ 349 16d3 FFE8DBE4 		.ascii	"\377\350\333\344\377\350\333\345\377\350\333\345\377\350\334"
+ 349      FFE8DBE5 
+ 349      FFE8DBE5 
+ 349      FFE8DC
+ 350 16e2 E5FFE8DC 		.ascii	"\345\377\350\334\346\377\350\334\346\377\350\334\346\377\350"
+ 350      E6FFE8DC 
+ 350      E6FFE8DC 
+ 350      E6FFE8
+ 351 16f1 DDE6FFE8 		.ascii	"\335\346\377\350\335\347\377\350\335\347\377\350\336\347\377"
+ 351      DDE7FFE8 
+ 351      DDE7FFE8 
+ 351      DEE7FF
+ 352 1700 E8DEE8FF 		.ascii	"\350\336\350\377\350\336\350\377\350\336\350\377\350\337\350"
+ 352      E8DEE8FF 
+ 352      E8DEE8FF 
+ 352      E8DFE8
+ 353 170f FFE8DFE9 		.ascii	"\377\350\337\351\377\350\337\351\377\350\337\351\377\350\340"
+ 353      FFE8DFE9 
+ 353      FFE8DFE9 
+ 353      FFE8E0
+ 354 171e EAFFE8E0 		.ascii	"\352\377\350\340\352\377\350\340\352\377\350\341\352\377\350"
+ 354      EAFFE8E0 
+ 354      EAFFE8E1 
+ 354      EAFFE8
+ 355 172d E1EBFFE8 		.ascii	"\341\353\377\350\341\353\377\350\341\353\377\350\342\353\377"
+ 355      E1EBFFE8 
+ 355      E1EBFFE8 
+ 355      E2EBFF
+ 356 173c E8E2EBFF 		.ascii	"\350\342\353\377\351\342\354\377\351\342\354\377\351\343\354"
+ 356      E9E2ECFF 
+ 356      E9E2ECFF 
+ 356      E9E3EC
+ 357 174b FFE9E3EC 		.ascii	"\377\351\343\354\377\351\343\355\377\351\344\355\377\357\352"
+ 357      FFE9E3ED 
+ 357      FFE9E4ED 
+ 357      FFEFEA
+ 358 175a EFFFEFEA 		.ascii	"\357\377\357\352\360\377\357\352\360\377\357\352\360\377\357"
+ 358      F0FFEFEA 
+ 358      F0FFEFEA 
+ 358      F0FFEF
+ 359 1769 EBF0FFEF 		.ascii	"\353\360\377\357\353\360\377\357\353\361\377\360\354\361\377"
+ 359      EBF0FFEF 
+ 359      EBF1FFF0 
+ 359      ECF1FF
+ 360 1778 F0ECF1FF 		.ascii	"\360\354\361\377\360\354\361\377\360\354\361\377\360\355\361"
+ 360      F0ECF1FF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 27
+
+
+ 360      F0ECF1FF 
+ 360      F0EDF1
+ 361 1787 FFF0EDF2 		.ascii	"\377\360\355\362\377\360\355\362\377\360\355\362\377\360\356"
+ 361      FFF0EDF2 
+ 361      FFF0EDF2 
+ 361      FFF0EE
+ 362 1796 F2FFF0EE 		.ascii	"\362\377\360\356\362\377\361\356\362\377\361\356\363\377\361"
+ 362      F2FFF1EE 
+ 362      F2FFF1EE 
+ 362      F3FFF1
+ 363 17a5 EFF3FFF1 		.ascii	"\357\363\377\361\357\363\377\361\357\363\377\361\357\363\377"
+ 363      EFF3FFF1 
+ 363      EFF3FFF1 
+ 363      EFF3FF
+ 364 17b4 F1F0F3FF 		.ascii	"\361\360\363\377\361\360\363\377\362\360\364\377\362\360\364"
+ 364      F1F0F3FF 
+ 364      F2F0F4FF 
+ 364      F2F0F4
+ 365 17c3 FFF2F1F4 		.ascii	"\377\362\361\364\377\362\361\364\377\362\361\364\377\362\361"
+ 365      FFF2F1F4 
+ 365      FFF2F1F4 
+ 365      FFF2F1
+ 366 17d2 F4FFF2F2 		.ascii	"\364\377\362\362\364\377\363\362\364\377\363\362\365\377\363"
+ 366      F4FFF3F2 
+ 366      F4FFF3F2 
+ 366      F5FFF3
+ 367 17e1 F2F5FFF3 		.ascii	"\362\365\377\363\363\365\377\363\363\365\377\363\363\365\377"
+ 367      F3F5FFF3 
+ 367      F3F5FFF3 
+ 367      F3F5FF
+ 368 17f0 F4F3F5FF 		.ascii	"\364\363\365\377\364\364\365\377\364\364\365\377\364\364\366"
+ 368      F4F4F5FF 
+ 368      F4F4F5FF 
+ 368      F4F4F6
+ 369 17ff FFF4F4F6 		.ascii	"\377\364\364\366\377\365\365\366\377\365\365\366\377\365\365"
+ 369      FFF5F5F6 
+ 369      FFF5F5F6 
+ 369      FFF5F5
+ 370 180e F6FFF5F5 		.ascii	"\366\377\365\365\366\377\366\366\366\377\366\366\366\377\366"
+ 370      F6FFF6F6 
+ 370      F6FFF6F6 
+ 370      F6FFF6
+ 371 181d F6F6FFF6 		.ascii	"\366\366\377\366\366\366\377\367\367\367\377\367\366\366\377"
+ 371      F6F6FFF7 
+ 371      F7F7FFF7 
+ 371      F6F6FF
+ 372 182c F7F6F6FF 		.ascii	"\367\366\366\377\367\366\366\377\370\365\366\377\370\365\366"
+ 372      F7F6F6FF 
+ 372      F8F5F6FF 
+ 372      F8F5F6
+ 373 183b FFF8F5F5 		.ascii	"\377\370\365\365\377\370\365\365\377\371\364\365\377\371\364"
+ 373      FFF8F5F5 
+ 373      FFF9F4F5 
+ 373      FFF9F4
+ 374 184a F5FFF9F4 		.ascii	"\365\377\371\364\365\377\371\364\364\377\372\363\364\377\372"
+ 374      F5FFF9F4 
+ 374      F4FFFAF3 
+GAS LISTING /tmp/ccRe9WAw.s 			page 28
+
+
+ 374      F4FFFA
+ 375 1859 F3F4FFFA 		.ascii	"\363\364\377\372\363\364\377\373\362\363\377\373\362\363\377"
+ 375      F3F4FFFB 
+ 375      F2F3FFFB 
+ 375      F2F3FF
+ 376 1868 FBF2F3FF 		.ascii	"\373\362\363\377\373\362\362\377\374\361\362\377\374\361\362"
+ 376      FBF2F2FF 
+ 376      FCF1F2FF 
+ 376      FCF1F2
+ 377 1877 FFFCF1F1 		.ascii	"\377\374\361\361\377\375\361\361\377\375\360\361\377\375\360"
+ 377      FFFDF1F1 
+ 377      FFFDF0F1 
+ 377      FFFDF0
+ 378 1886 F0FFFDF0 		.ascii	"\360\377\375\360\360\377\375\360\357\377\375\357\357\377\375"
+ 378      F0FFFDF0 
+ 378      EFFFFDEF 
+ 378      EFFFFD
+ 379 1895 EFEFFFFD 		.ascii	"\357\357\377\375\357\356\377\375\357\356\377\375\356\355\377"
+ 379      EFEEFFFD 
+ 379      EFEEFFFD 
+ 379      EEEDFF
+ 380 18a4 FDEEEDFF 		.ascii	"\375\356\355\377\375\356\355\377\375\356\354\377\375\355\354"
+ 380      FDEEEDFF 
+ 380      FDEEECFF 
+ 380      FDEDEC
+ 381 18b3 FFFDEDEB 		.ascii	"\377\375\355\353\377\375\355\353\377\375\355\352\377\375\354"
+ 381      FFFDEDEB 
+ 381      FFFDEDEA 
+ 381      FFFDEC
+ 382 18c2 EAFFFDEC 		.ascii	"\352\377\375\354\351\377\375\354\351\377\375\354\350\377\375"
+ 382      E9FFFDEC 
+ 382      E9FFFDEC 
+ 382      E8FFFD
+ 383 18d1 EBE8FFFD 		.ascii	"\353\350\377\375\353\347\377\375\353\347\377\375\353\346\377"
+ 383      EBE7FFFD 
+ 383      EBE7FFFD 
+ 383      EBE6FF
+ 384 18e0 FDEBE5FF 		.ascii	"\375\353\345\377\375\352\345\377\375\352\344\377\375\352\344"
+ 384      FDEAE5FF 
+ 384      FDEAE4FF 
+ 384      FDEAE4
+ 385 18ef FFFDEAE3 		.ascii	"\377\375\352\343\377\376\345\326\377\376\345\325\377\376\345"
+ 385      FFFEE5D6 
+ 385      FFFEE5D5 
+ 385      FFFEE5
+ 386 18fe D4FFFEE4 		.ascii	"\324\377\376\344\324\377\376\344\323\377\376\344\323\377\376"
+ 386      D4FFFEE4 
+ 386      D3FFFEE4 
+ 386      D3FFFE
+ 387 190d E4D2FFFE 		.ascii	"\344\322\377\376\344\321\377\376\343\321\377\376\343\320\377"
+ 387      E4D1FFFE 
+ 387      E3D1FFFE 
+ 387      E3D0FF
+ 388 191c FEE3D0FF 		.ascii	"\376\343\320\377\376\343\317\377\376\343\316\377\376\343\316"
+ 388      FEE3CFFF 
+ 388      FEE3CEFF 
+ 388      FEE3CE
+GAS LISTING /tmp/ccRe9WAw.s 			page 29
+
+
+ 389 192b FFFEE2CD 		.ascii	"\377\376\342\315\377\376\342\314\377\376\342\314\377\376\342"
+ 389      FFFEE2CC 
+ 389      FFFEE2CC 
+ 389      FFFEE2
+ 390 193a CBFFFEE2 		.ascii	"\313\377\376\342\312\377\376\342\312\377\376\342\311\377\376"
+ 390      CAFFFEE2 
+ 390      CAFFFEE2 
+ 390      C9FFFE
+ 391 1949 E1C8FFFE 		.ascii	"\341\310\377\376\341\310\377\376\341\307\377\376\341\307\377"
+ 391      E1C8FFFE 
+ 391      E1C7FFFE 
+ 391      E1C7FF
+ 392 1958 FEE1C6FF 		.ascii	"\376\341\306\377\376\341\305\377\376\341\305\377\376\341\304"
+ 392      FEE1C5FF 
+ 392      FEE1C5FF 
+ 392      FEE1C4
+ 393 1967 FFFEE1C3 		.ascii	"\377\376\341\303\377\376\341\303\377\376\340\302\377\376\340"
+ 393      FFFEE1C3 
+ 393      FFFEE0C2 
+ 393      FFFEE0
+ 394 1976 C1FFFEE0 		.ascii	"\301\377\376\340\301\377\376\340\300\377\376\340\277\377\376"
+ 394      C1FFFEE0 
+ 394      C0FFFEE0 
+ 394      BFFFFE
+ 395 1985 E0BFFFFE 		.ascii	"\340\277\377\376\340\276\377\376\340\275\377\376\340\275\377"
+ 395      E0BEFFFE 
+ 395      E0BDFFFE 
+ 395      E0BDFF
+ 396 1994 FEE0BCFF 		.ascii	"\376\340\274\377\376\340\273\377\376\340\273\377\376\340\272"
+ 396      FEE0BBFF 
+ 396      FEE0BBFF 
+ 396      FEE0BA
+ 397 19a3 FFFEE0B9 		.ascii	"\377\376\340\271\377\376\340\271\377\376\340\270\377\376\340"
+ 397      FFFEE0B9 
+ 397      FFFEE0B8 
+ 397      FFFEE0
+ 398 19b2 B8FFFEE0 		.ascii	"\270\377\376\340\267\377\376\340\266\377\376\340\266\377\375"
+ 398      B7FFFEE0 
+ 398      B6FFFEE0 
+ 398      B6FFFD
+ 399 19c1 DFB5FFFD 		.ascii	"\337\265\377\375\337\264\377\375\337\264\377\375\336\263\377"
+ 399      DFB4FFFD 
+ 399      DFB4FFFD 
+ 399      DEB3FF
+ 400 19d0 FDDEB2FF 		.ascii	"\375\336\262\377\375\336\262\377\375\336\261\377\375\335\260"
+ 400      FDDEB2FF 
+ 400      FDDEB1FF 
+ 400      FDDDB0
+ 401 19df FFFDDDB0 		.ascii	"\377\375\335\260\377\375\335\257\377\375\334\256\377\375\334"
+ 401      FFFDDDAF 
+ 401      FFFDDCAE 
+ 401      FFFDDC
+ 402 19ee AEFFFDDC 		.ascii	"\256\377\375\334\255\377\375\333\254\377\375\333\254\377\375"
+ 402      ADFFFDDB 
+ 402      ACFFFDDB 
+ 402      ACFFFD
+ 403 19fd DBABFFFD 		.ascii	"\333\253\377\375\333\252\377\375\332\252\377\375\332\251\377"
+GAS LISTING /tmp/ccRe9WAw.s 			page 30
+
+
+ 403      DBAAFFFD 
+ 403      DAAAFFFD 
+ 403      DAA9FF
+ 404 1a0c FDDAA9FF 		.ascii	"\375\332\251\377\375\331\250\377\375\331\247\377\375\331\247"
+ 404      FDD9A8FF 
+ 404      FDD9A7FF 
+ 404      FDD9A7
+ 405 1a1b FFFDD8A6 		.ascii	"\377\375\330\246\377\375\330\245\377\375\330\245\377\375\327"
+ 405      FFFDD8A5 
+ 405      FFFDD8A5 
+ 405      FFFDD7
+ 406 1a2a A4FFFDD7 		.ascii	"\244\377\375\327\243\377\375\327\243\377\375\327\242\377\375"
+ 406      A3FFFDD7 
+ 406      A3FFFDD7 
+ 406      A2FFFD
+ 407 1a39 D6A1FFFD 		.ascii	"\326\241\377\375\326\241\377\375\326\240\377\375\325\237\377"
+ 407      D6A1FFFD 
+ 407      D6A0FFFD 
+ 407      D59FFF
+ 408 1a48 FDD59FFF 		.ascii	"\375\325\237\377\375\325\236\377\375\324\235\377\375\324\235"
+ 408      FDD59EFF 
+ 408      FDD49DFF 
+ 408      FDD49D
+ 409 1a57 FFFDD49C 		.ascii	"\377\375\324\234\377\375\323\233\377\375\323\233\377\375\323"
+ 409      FFFDD39B 
+ 409      FFFDD39B 
+ 409      FFFDD3
+ 410 1a66 9AFFFDD3 		.ascii	"\232\377\375\323\231\377\375\322\231\377\375\322\230\377\375"
+ 410      99FFFDD2 
+ 410      99FFFDD2 
+ 410      98FFFD
+ 411 1a75 D298FFFD 		.ascii	"\322\230\377\375\321\227\377\375\321\226\377\375\321\226\377"
+ 411      D197FFFD 
+ 411      D196FFFD 
+ 411      D196FF
+ 412 1a84 FDD095FF 		.ascii	"\375\320\225\377\375\320\224\377\375\310\203\377\375\307\202"
+ 412      FDD094FF 
+ 412      FDC883FF 
+ 412      FDC782
+ 413 1a93 FFFDC782 		.ascii	"\377\375\307\202\377\375\307\201\377\375\307\200\377\375\306"
+ 413      FFFDC781 
+ 413      FFFDC780 
+ 413      FFFDC6
+ 414 1aa2 80FFFDC6 		.ascii	"\200\377\375\306\177\377\375\306\177\377\375\305~\377\375\305"
+ 414      7FFFFDC6 
+ 414      7FFFFDC5 
+ 414      7EFFFDC5 
+ 415 1ab2 7DFFFDC5 		.ascii	"}\377\375\305}\377\375\304|\377\375\304{\377\375\304{\377\375"
+ 415      7DFFFDC4 
+ 415      7CFFFDC4 
+ 415      7BFFFDC4 
+ 415      7BFFFD
+ 416 1ac5 C37AFFFD 		.ascii	"\303z\377\375\303y\377\375\303y\377\375\302x\377\375\302w\377"
+ 416      C379FFFD 
+ 416      C379FFFD 
+ 416      C278FFFD 
+ 416      C277FF
+GAS LISTING /tmp/ccRe9WAw.s 			page 31
+
+
+ 417 1ad8 FDC277FF 		.ascii	"\375\302w\377\375\301v\377\375\301v\377\375\301u\377\375\301"
+ 417      FDC176FF 
+ 417      FDC176FF 
+ 417      FDC175FF 
+ 417      FDC1
+ 418 1aea 74FFFDC0 		.ascii	"t\377\375\300t\377\375\300s\377\375\300r\377\375\277r\377\375"
+ 418      74FFFDC0 
+ 418      73FFFDC0 
+ 418      72FFFDBF 
+ 418      72FFFD
+ 419 1afd BF71FFFD 		.ascii	"\277q\377\375\277p\377\375\276p\377\375\276o\377\375\276o\377"
+ 419      BF70FFFD 
+ 419      BE70FFFD 
+ 419      BE6FFFFD 
+ 419      BE6FFF
+ 420 1b10 FDBD6EFF 		.ascii	"\375\275n\377\375\275m\377\375\275m\377\375\274l\377\375\274"
+ 420      FDBD6DFF 
+ 420      FDBD6DFF 
+ 420      FDBC6CFF 
+ 420      FDBC
+ 421 1b22 6BFFFDBC 		.ascii	"k\377\375\274k\377\375\273j\377\375\273i\377\375\273i\377\375"
+ 421      6BFFFDBB 
+ 421      6AFFFDBB 
+ 421      69FFFDBB 
+ 421      69FFFD
+ 422 1b35 BA68FFFD 		.ascii	"\272h\377\375\272g\377\375\272g\377\375\271f\377\375\271f\377"
+ 422      BA67FFFD 
+ 422      BA67FFFD 
+ 422      B966FFFD 
+ 422      B966FF
+ 423 1b48 FDB965FF 		.ascii	"\375\271e\377\375\270d\377\375\270d\377\375\270c\377\374\267"
+ 423      FDB864FF 
+ 423      FDB864FF 
+ 423      FDB863FF 
+ 423      FCB7
+ 424 1b5a 62FFFCB7 		.ascii	"b\377\374\267b\377\374\267a\377\374\266a\377\374\266`\377\373"
+ 424      62FFFCB7 
+ 424      61FFFCB6 
+ 424      61FFFCB6 
+ 424      60FFFB
+ 425 1b6d B560FFFB 		.ascii	"\265`\377\373\265_\377\373\265^\377\373\264^\377\372\264]\377"
+ 425      B55FFFFB 
+ 425      B55EFFFB 
+ 425      B45EFFFA 
+ 425      B45DFF
+ 426 1b80 FAB35DFF 		.ascii	"\372\263]\377\372\263\\\377\372\262\\\377\372\262[\377\371\262"
+ 426      FAB35CFF 
+ 426      FAB25CFF 
+ 426      FAB25BFF 
+ 426      F9B2
+ 427 1b92 5AFFF9B1 		.ascii	"Z\377\371\261Z\377\371\261Y\377\371\260Y\377\370\260X\377\370"
+ 427      5AFFF9B1 
+ 427      59FFF9B0 
+ 427      59FFF8B0 
+ 427      58FFF8
+ 428 1ba5 AF58FFF8 		.ascii	"\257X\377\370\257W\377\370\257W\377\370\256V\377\367\256U\377"
+ 428      AF57FFF8 
+GAS LISTING /tmp/ccRe9WAw.s 			page 32
+
+
+ 428      AF57FFF8 
+ 428      AE56FFF7 
+ 428      AE55FF
+ 429 1bb8 F7AD55FF 		.ascii	"\367\255U\377\367\255T\377\367\255T\377\366\254S\377\366\254"
+ 429      F7AD54FF 
+ 429      F7AD54FF 
+ 429      F6AC53FF 
+ 429      F6AC
+ 430 1bca 53FFF6AB 		.ascii	"S\377\366\253R\377\366\253Q\377\366\252Q\377\365\252P\377\365"
+ 430      52FFF6AB 
+ 430      51FFF6AA 
+ 430      51FFF5AA 
+ 430      50FFF5
+ 431 1bdd AA50FFF5 		.ascii	"\252P\377\365\251O\377\365\251O\377\364\250N\377\364\250M\377"
+ 431      A94FFFF5 
+ 431      A94FFFF4 
+ 431      A84EFFF4 
+ 431      A84DFF
+ 432 1bf0 F4A84DFF 		.ascii	"\364\250M\377\364\247L\377\364\247L\377\363\246K\377\363\246"
+ 432      F4A74CFF 
+ 432      F4A74CFF 
+ 432      F3A64BFF 
+ 432      F3A6
+ 433 1c02 4BFFF3A5 		.ascii	"K\377\363\245J\377\363\245I\377\362\245I\377\362\244H\377\362"
+ 433      4AFFF3A5 
+ 433      49FFF2A5 
+ 433      49FFF2A4 
+ 433      48FFF2
+ 434 1c15 A448FFF2 		.ascii	"\244H\377\362\243G\377\361\243G\377\361\242F\377\353\2276\377"
+ 434      A347FFF1 
+ 434      A347FFF1 
+ 434      A246FFEB 
+ 434      9736FF
+ 435 1c28 EB9735FF 		.ascii	"\353\2275\377\353\2264\377\353\2264\377\352\2263\377\352\225"
+ 435      EB9634FF 
+ 435      EB9634FF 
+ 435      EA9633FF 
+ 435      EA95
+ 436 1c3a 33FFEA95 		.ascii	"3\377\352\2252\377\352\2241\377\351\2241\377\351\2230\377\351"
+ 436      32FFEA94 
+ 436      31FFE994 
+ 436      31FFE993 
+ 436      30FFE9
+ 437 1c4d 9330FFE9 		.ascii	"\2230\377\351\223/\377\350\222/\377\350\222.\377\350\221-\377"
+ 437      932FFFE8 
+ 437      922FFFE8 
+ 437      922EFFE8 
+ 437      912DFF
+ 438 1c60 E8912DFF 		.ascii	"\350\221-\377\350\221,\377\347\220+\377\347\220+\377\347\217"
+ 438      E8912CFF 
+ 438      E7902BFF 
+ 438      E7902BFF 
+ 438      E78F
+ 439 1c72 2AFFE78F 		.ascii	"*\377\347\217*\377\346\216)\377\346\216(\377\346\216(\377\346"
+ 439      2AFFE68E 
+ 439      29FFE68E 
+ 439      28FFE68E 
+GAS LISTING /tmp/ccRe9WAw.s 			page 33
+
+
+ 439      28FFE6
+ 440 1c85 8D27FFE6 		.ascii	"\215'\377\346\215'\377\345\214&\377\345\214%\377\345\213%\377"
+ 440      8D27FFE5 
+ 440      8C26FFE5 
+ 440      8C25FFE5 
+ 440      8B25FF
+ 441 1c98 E58B24FF 		.ascii	"\345\213$\377\344\213#\377\344\212#\377\344\212\"\377\344\211"
+ 441      E48B23FF 
+ 441      E48A23FF 
+ 441      E48A22FF 
+ 441      E489
+ 442 1caa 21FFE389 		.ascii	"!\377\343\211!\377\343\210 \377\343\210\037\377\343\210\037\377"
+ 442      21FFE388 
+ 442      20FFE388 
+ 442      1FFFE388 
+ 442      1FFF
+ 443 1cbc E3871EFF 		.ascii	"\343\207\036\377\342\207\035\377\342\206\034\377\342\206\034"
+ 443      E2871DFF 
+ 443      E2861CFF 
+ 443      E2861C
+ 444 1ccb FFE2851B 		.ascii	"\377\342\205\033\377\341\205\032\377\341\205\031\377\341\204"
+ 444      FFE1851A 
+ 444      FFE18519 
+ 444      FFE184
+ 445 1cda 19FFE184 		.ascii	"\031\377\341\204\030\377\340\203\027\377\340\203\026\377\340"
+ 445      18FFE083 
+ 445      17FFE083 
+ 445      16FFE0
+ 446 1ce9 8215FFE0 		.ascii	"\202\025\377\340\202\025\377\340\202\024\377\337\201\023\377"
+ 446      8215FFE0 
+ 446      8214FFDF 
+ 446      8113FF
+ 447 1cf8 DF8113FF 		.ascii	"\337\201\023\377\337\201\023\377\336\200\023\377\336\200\023"
+ 447      DF8113FF 
+ 447      DE8013FF 
+ 447      DE8013
+ 448 1d07 FFDD8013 		.ascii	"\377\335\200\023\377\335\177\023\377\335\177\023\377\334\177"
+ 448      FFDD7F13 
+ 448      FFDD7F13 
+ 448      FFDC7F
+ 449 1d16 13FFDC7E 		.ascii	"\023\377\334~\022\377\334~\022\377\333~\022\377\333}\022\377"
+ 449      12FFDC7E 
+ 449      12FFDB7E 
+ 449      12FFDB7D 
+ 449      12FF
+ 450 1d28 DB7D12FF 		.ascii	"\333}\022\377\332|\022\377\332|\022\377\332|\022\377\331{\022"
+ 450      DA7C12FF 
+ 450      DA7C12FF 
+ 450      DA7C12FF 
+ 450      D97B12
+ 451 1d3b FFD97B11 		.ascii	"\377\331{\021\377\331{\021\377\330z\021\377\330z\021\377\330"
+ 451      FFD97B11 
+ 451      FFD87A11 
+ 451      FFD87A11 
+ 451      FFD8
+ 452 1d4d 7A11FFD7 		.ascii	"z\021\377\327y\021\377\327y\021\377\327y\021\377\326x\021\377"
+ 452      7911FFD7 
+GAS LISTING /tmp/ccRe9WAw.s 			page 34
+
+
+ 452      7911FFD7 
+ 452      7911FFD6 
+ 452      7811FF
+ 453 1d60 D67810FF 		.ascii	"\326x\020\377\325x\020\377\325w\020\377\325w\020\377\324w\020"
+ 453      D57810FF 
+ 453      D57710FF 
+ 453      D57710FF 
+ 453      D47710
+ 454 1d73 FFD47610 		.ascii	"\377\324v\020\377\324v\020\377\323v\020\377\323u\020\377\323"
+ 454      FFD47610 
+ 454      FFD37610 
+ 454      FFD37510 
+ 454      FFD3
+ 455 1d85 750FFFD2 		.ascii	"u\017\377\322u\017\377\322t\017\377\322t\017\377\321t\017\377"
+ 455      750FFFD2 
+ 455      740FFFD2 
+ 455      740FFFD1 
+ 455      740FFF
+ 456 1d98 D1730FFF 		.ascii	"\321s\017\377\321s\017\377\320s\017\377\320r\017\377\320r\016"
+ 456      D1730FFF 
+ 456      D0730FFF 
+ 456      D0720FFF 
+ 456      D0720E
+ 457 1dab FFCF720E 		.ascii	"\377\317r\016\377\317r\016\377\316q\016\377\316q\016\377\316"
+ 457      FFCF720E 
+ 457      FFCE710E 
+ 457      FFCE710E 
+ 457      FFCE
+ 458 1dbd 710EFFC4 		.ascii	"q\016\377\304h\013\377\304g\013\377\304g\013\377\303g\013\377"
+ 458      680BFFC4 
+ 458      670BFFC4 
+ 458      670BFFC3 
+ 458      670BFF
+ 459 1dd0 C3660BFF 		.ascii	"\303f\013\377\303f\n\377\302f\n\377\302e\n\377\302e\n\377\301"
+ 459      C3660AFF 
+ 459      C2660AFF 
+ 459      C2650AFF 
+ 459      C2650AFF 
+ 460 1de5 650AFFC1 		.ascii	"e\n\377\301e\n\377\301d\n\377\300d\n\377\300d\t\377\277c\t\377"
+ 460      650AFFC1 
+ 460      640AFFC0 
+ 460      640AFFC0 
+ 460      6409FFBF 
+ 461 1dfc BF6309FF 		.ascii	"\277c\t\377\277c\t\377\276b\t\377\276b\t\377\276b\t\377\275a"
+ 461      BF6309FF 
+ 461      BE6209FF 
+ 461      BE6209FF 
+ 461      BE6209FF 
+ 462 1e12 09FFBD61 		.ascii	"\t\377\275a\t\377\275a\b\377\274`\b\377\274`\b\377\274`\b\377"
+ 462      09FFBD61 
+ 462      08FFBC60 
+ 462      08FFBC60 
+ 462      08FFBC60 
+ 463 1e28 BB5F08FF 		.ascii	"\273_\b\377\273_\b\377\273_\b\377\272^\b\377\272^\b\377\271^"
+ 463      BB5F08FF 
+ 463      BB5F08FF 
+ 463      BA5E08FF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 35
+
+
+ 463      BA5E08FF 
+ 464 1e3e 07FFB95D 		.ascii	"\007\377\271]\007\377\271]\007\377\270]\007\377\270\\\007\377"
+ 464      07FFB95D 
+ 464      07FFB85D 
+ 464      07FFB85C 
+ 464      07FF
+ 465 1e50 B85C07FF 		.ascii	"\270\\\007\377\267\\\007\377\267[\007\377\267[\007\377\266[\007"
+ 465      B75C07FF 
+ 465      B75B07FF 
+ 465      B75B07FF 
+ 465      B65B07
+ 466 1e63 FFB65B06 		.ascii	"\377\266[\006\377\266Z\006\377\265Z\006\377\265Z\006\377\264"
+ 466      FFB65A06 
+ 466      FFB55A06 
+ 466      FFB55A06 
+ 466      FFB4
+ 467 1e75 5906FFB4 		.ascii	"Y\006\377\264Y\006\377\264Y\006\377\263X\006\377\263X\006\377"
+ 467      5906FFB4 
+ 467      5906FFB3 
+ 467      5806FFB3 
+ 467      5806FF
+ 468 1e88 B35806FF 		.ascii	"\263X\006\377\262W\006\377\262W\006\377\262W\006\377\261W\006"
+ 468      B25706FF 
+ 468      B25706FF 
+ 468      B25706FF 
+ 468      B15706
+ 469 1e9b FFB15606 		.ascii	"\377\261V\006\377\260V\006\377\260V\006\377\257V\006\377\257"
+ 469      FFB05606 
+ 469      FFB05606 
+ 469      FFAF5606 
+ 469      FFAF
+ 470 1ead 5606FFAF 		.ascii	"V\006\377\257U\006\377\256U\006\377\256U\006\377\255U\006\377"
+ 470      5506FFAE 
+ 470      5506FFAE 
+ 470      5506FFAD 
+ 470      5506FF
+ 471 1ec0 AD5406FF 		.ascii	"\255T\006\377\255T\006\377\254T\006\377\254T\006\377\253S\006"
+ 471      AD5406FF 
+ 471      AC5406FF 
+ 471      AC5406FF 
+ 471      AB5306
+ 472 1ed3 FFAB5306 		.ascii	"\377\253S\006\377\253S\006\377\252S\006\377\252R\006\377\251"
+ 472      FFAB5306 
+ 472      FFAA5306 
+ 472      FFAA5206 
+ 472      FFA9
+ 473 1ee5 5206FFA9 		.ascii	"R\006\377\251R\006\377\250R\006\377\250R\006\377\250Q\006\377"
+ 473      5206FFA8 
+ 473      5206FFA8 
+ 473      5206FFA8 
+ 473      5106FF
+ 474 1ef8 A75106FF 		.ascii	"\247Q\006\377\247Q\007\377\246Q\007\377\246P\007\377\246P\007"
+ 474      A75107FF 
+ 474      A65107FF 
+ 474      A65007FF 
+ 474      A65007
+ 475 1f0b FFA55007 		.ascii	"\377\245P\007\377\245P\007\377\244O\007\377\244O\007\377\244"
+GAS LISTING /tmp/ccRe9WAw.s 			page 36
+
+
+ 475      FFA55007 
+ 475      FFA44F07 
+ 475      FFA44F07 
+ 475      FFA4
+ 476 1f1d 4F07FFA3 		.ascii	"O\007\377\243O\007\377\243O\007\377\242N\007\377\242N\007\377"
+ 476      4F07FFA3 
+ 476      4F07FFA2 
+ 476      4E07FFA2 
+ 476      4E07FF
+ 477 1f30 A14E07FF 		.ascii	"\241N\007\377\241N\007\377\241M\007\377\240M\007\377\240M\007"
+ 477      A14E07FF 
+ 477      A14D07FF 
+ 477      A04D07FF 
+ 477      A04D07
+ 478 1f43 FF9F4D07 		.ascii	"\377\237M\007\377\237L\007\377\237L\007\377\236L\007\377\236"
+ 478      FF9F4C07 
+ 478      FF9F4C07 
+ 478      FF9E4C07 
+ 478      FF9E
+ 479 1f55 4C07FF93 		.ascii	"L\007\377\223F\007\377\223F\007\377\222E\007\377\222E\007\377"
+ 479      4607FF93 
+ 479      4607FF92 
+ 479      4507FF92 
+ 479      4507FF
+ 480 1f68 914507FF 		.ascii	"\221E\007\377\221E\007\377\221D\007\377\220D\007\377\220D\007"
+ 480      914507FF 
+ 480      914407FF 
+ 480      904407FF 
+ 480      904407
+ 481 1f7b FF8F4407 		.ascii	"\377\217D\007\377\217D\007\377\217C\007\377\216C\007\377\216"
+ 481      FF8F4407 
+ 481      FF8F4307 
+ 481      FF8E4307 
+ 481      FF8E
+ 482 1f8d 4308FF8D 		.ascii	"C\b\377\215C\b\377\215B\b\377\215B\b\377\214B\b\377\214B\b\377"
+ 482      4308FF8D 
+ 482      4208FF8D 
+ 482      4208FF8C 
+ 482      4208FF8C 
+ 483 1fa4 8B4208FF 		.ascii	"\213B\b\377\213A\b\377\213A\b\377\212A\b\377\212A\b\377\211@"
+ 483      8B4108FF 
+ 483      8B4108FF 
+ 483      8A4108FF 
+ 483      8A4108FF 
+ 484 1fba 08FF8940 		.ascii	"\b\377\211@\b\377"
+ 484      08FF
+ 485 1fc0 894008FF 		.ascii	"\211@\b\377\210@\b\377\210@\b\377\207?\b\377\207?\b\377\206?"
+ 485      884008FF 
+ 485      884008FF 
+ 485      873F08FF 
+ 485      873F08FF 
+ 486 1fd6 08FF863F 		.ascii	"\b\377\206?\b\377\206>\b\377\205>\b\377\205>\b\377\204>\b\377"
+ 486      08FF863E 
+ 486      08FF853E 
+ 486      08FF853E 
+ 486      08FF843E 
+ 487 1fec 843E08FF 		.ascii	"\204>\b\377\204=\b\377\203=\b\377\203=\b\377\202=\b\377\202<"
+GAS LISTING /tmp/ccRe9WAw.s 			page 37
+
+
+ 487      843D08FF 
+ 487      833D08FF 
+ 487      833D08FF 
+ 487      823D08FF 
+ 488 2002 08FF823C 		.ascii	"\b\377\202<\b\377\201<\b\377\201<\b\377\200<\b\377\200;\b\377"
+ 488      08FF813C 
+ 488      08FF813C 
+ 488      08FF803C 
+ 488      08FF803B 
+ 489 2018 803B08FF 		.ascii	"\200;\b\377\177;\b\377\177;\b\377"
+ 489      7F3B08FF 
+ 489      7F3B08FF 
+ 490              		.globl	heatmap_cs_PuOr_soft
+ 491              		.section	.data.rel.local
+ 492              		.align 8
+ 493              		.type	heatmap_cs_PuOr_soft, @object
+ 494              		.size	heatmap_cs_PuOr_soft, 8
+ 495              	heatmap_cs_PuOr_soft:
+ 496 0010 00000000 		.quad	soft
+ 496      00000000 
+ 497              		.section	.data.rel.ro.local
+ 498              		.align 16
+ 499              		.type	soft, @object
+ 500              		.size	soft, 16
+ 501              	soft:
+ 502 0020 00000000 		.quad	soft_data
+ 502      00000000 
+ 503 0028 01040000 		.quad	1025
+ 503      00000000 
+ 504              		.section	.rodata
+ 505 2024 00000000 		.align 32
+ 505      00000000 
+ 505      00000000 
+ 505      00000000 
+ 505      00000000 
+ 506              		.type	soft_data, @object
+ 507              		.size	soft_data, 4100
+ 508              	soft_data:
+ 509 2040 00       		.string	""
+ 510 2041 00       		.string	""
+ 511 2042 00       		.string	""
+ 512 2043 00       		.string	""
+ 513 2044 2C00     		.string	","
+ 514 2046 4B00     		.string	"K"
+ 515 2048 2D00     		.string	"-"
+ 516 204a 4B072D00 		.string	"K\007-"
+ 517 204e 4C0E2E00 		.string	"L\016."
+ 518 2052 4C162E00 		.string	"L\026."
+ 519 2056 4D1D2E01 		.ascii	"M\035.\001M%/\001N,/\001N40\002O;0\002PC0\002PJ1\002QR1\003Q"
+ 519      4D252F01 
+ 519      4E2C2F01 
+ 519      4E343002 
+ 519      4F3B3002 
+ 520 2077 59310352 		.ascii	"Y1\003Ra2\003Rh2\004Sp3\004Tw3\004T\1773\005U\2064\005U\2154"
+ 520      61320352 
+ 520      68320453 
+ 520      70330454 
+GAS LISTING /tmp/ccRe9WAw.s 			page 38
+
+
+ 520      77330454 
+ 521 2095 05569535 		.ascii	"\005V\2255\006V\2345\006W\2445\007X\2536\007X\2636\007Y\2726"
+ 521      06569C35 
+ 521      0657A435 
+ 521      0758AB36 
+ 521      0758B336 
+ 522 20ad 0859C237 		.ascii	"\bY\3027\bZ\3117\tZ\3218\t[\3308\n\\\3408\n\\\3479\n]\3579\013"
+ 522      085AC937 
+ 522      095AD138 
+ 522      095BD838 
+ 522      0A5CE038 
+ 523 20ca 5DF63A0B 		.ascii	"]\366:\013^\376:\f^\377:\f_\377;\r`\377;\r`\377;\ra\377<\016"
+ 523      5EFE3A0C 
+ 523      5EFF3A0C 
+ 523      5FFF3B0D 
+ 523      60FF3B0D 
+ 524 20e6 61FF3C0E 		.ascii	"a\377<\016b\377=\017c\377=\017c\377=\017d\377>\020d\377>\020"
+ 524      62FF3D0F 
+ 524      63FF3D0F 
+ 524      63FF3D0F 
+ 524      64FF3E10 
+ 525 20fe 65FF3E11 		.ascii	"e\377>\021f\377?\021f\377?\022g\377@\022g\377@\022h\377@\023"
+ 525      66FF3F11 
+ 525      66FF3F12 
+ 525      67FF4012 
+ 525      67FF4012 
+ 526 2116 69FF4113 		.ascii	"i\377A\023i\377A\024j\377B\024j\377B\024k\377B\025l\377C\025"
+ 526      69FF4114 
+ 526      6AFF4214 
+ 526      6AFF4214 
+ 526      6BFF4215 
+ 527 212e 6CFF4316 		.ascii	"l\377C\026m\377C\026m\377D\026n\377D\027o\377E\027o\377E\027"
+ 527      6DFF4316 
+ 527      6DFF4416 
+ 527      6EFF4417 
+ 527      6FFF4517 
+ 528 2146 70FF4518 		.ascii	"p\377E\030p\377F\030q\377F\031r\377F\031r\377G\031s\377G\032"
+ 528      70FF4618 
+ 528      71FF4619 
+ 528      72FF4619 
+ 528      72FF4719 
+ 529 215e 73FF481A 		.ascii	"s\377H\032t\377H\033u\377H\033u\377I\033v\377I\034v\377J\034"
+ 529      74FF481B 
+ 529      75FF481B 
+ 529      75FF491B 
+ 529      76FF491C 
+ 530 2176 77FF4A1D 		.ascii	"w\377J\035x\377J\035x\377K\035y\377K\036z\377K\036z\377L\037"
+ 530      78FF4A1D 
+ 530      78FF4B1D 
+ 530      79FF4B1E 
+ 530      7AFF4B1E 
+ 531 218e 7BFF4C1F 		.ascii	"{\377L\037{\377M\037|\377M }\377M }\377N ~\377N!~\377N!\177\377"
+ 531      7BFF4D1F 
+ 531      7CFF4D20 
+ 531      7DFF4D20 
+ 531      7DFF4E20 
+ 532 21ac 4F2280FF 		.ascii	"O\"\200\377O\"\200\377P\"\201\377P#\202\377P#\202\377Q$\203\377"
+GAS LISTING /tmp/ccRe9WAw.s 			page 39
+
+
+ 532      4F2280FF 
+ 532      502281FF 
+ 532      502382FF 
+ 532      502382FF 
+ 533 21c4 512483FF 		.ascii	"Q$\203\377Q$\204\377R%\205\377R%\205\377S&\206\377S&\207\377"
+ 533      512484FF 
+ 533      522585FF 
+ 533      522585FF 
+ 533      532686FF 
+ 534 21dc 532687FF 		.ascii	"S&\207\377T'\210\377T(\210\377T)\211\377U*\211\377U*\211\377"
+ 534      542788FF 
+ 534      542888FF 
+ 534      542989FF 
+ 534      552A89FF 
+ 535 21f4 562B8AFF 		.ascii	"V+\212\377V,\212\377V-\213\377W.\213\377W/\213\377X/\214\377"
+ 535      562C8AFF 
+ 535      562D8BFF 
+ 535      572E8BFF 
+ 535      572F8BFF 
+ 536 220c 58308CFF 		.ascii	"X0\214\377X1\215\377Y2\215\377Y3\215\377Y3\216\377Z4\216\377"
+ 536      58318DFF 
+ 536      59328DFF 
+ 536      59338DFF 
+ 536      59338EFF 
+ 537 2224 5A358FFF 		.ascii	"Z5\217\377[6\217\377[6\217\377[7\220\377\\8\220\377\\9\220\377"
+ 537      5B368FFF 
+ 537      5B368FFF 
+ 537      5B3790FF 
+ 537      5C3890FF 
+ 538 223c 5D3991FF 		.ascii	"]9\221\377]:\221\377];\222\377^<\222\377^=\222\377_=\223\377"
+ 538      5D3A91FF 
+ 538      5D3B92FF 
+ 538      5E3C92FF 
+ 538      5E3D92FF 
+ 539 2254 5F3E93FF 		.ascii	"_>\223\377_?\223\377`@\224\377`@\224\377aA\225\377aB\225\377"
+ 539      5F3F93FF 
+ 539      604094FF 
+ 539      604094FF 
+ 539      614195FF 
+ 540 226c 614395FF 		.ascii	"aC\225\377bC\226\377bD\226\377cE\226\377cE\227\377cF\227\377"
+ 540      624396FF 
+ 540      624496FF 
+ 540      634596FF 
+ 540      634597FF 
+ 541 2284 644798FF 		.ascii	"dG\230\377dH\230\377eH\230\377eI\231\377fJ\231\377fK\231\377"
+ 541      644898FF 
+ 541      654898FF 
+ 541      654999FF 
+ 541      664A99FF 
+ 542 229c 664B9AFF 		.ascii	"fK\232\377gL\232\377gM\232\377hN\233\377hN\233\377iO\233\377"
+ 542      674C9AFF 
+ 542      674D9AFF 
+ 542      684E9BFF 
+ 542      684E9BFF 
+ 543 22b4 69509CFF 		.ascii	"iP\234\377iP\234\377jQ\234\377jR\235\377kS\235\377kS\235\377"
+ 543      69509CFF 
+ 543      6A519CFF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 40
+
+
+ 543      6A529DFF 
+ 543      6B539DFF 
+ 544 22cc 6C549EFF 		.ascii	"lT\236\377lU\236\377lU\237\377mV\237\377mW\237\377nX\240\377"
+ 544      6C559EFF 
+ 544      6C559FFF 
+ 544      6D569FFF 
+ 544      6D579FFF 
+ 545 22e4 6E58A0FF 		.ascii	"nX\240\377oY\240\377oZ\241\377pZ\241\377p[\241\377p\\\242\377"
+ 545      6F59A0FF 
+ 545      6F5AA1FF 
+ 545      705AA1FF 
+ 545      705BA1FF 
+ 546 22fc 715DA2FF 		.ascii	"q]\242\377q]\242\377r^\243\377r_\243\377s_\243\377s`\243\377"
+ 546      715DA2FF 
+ 546      725EA3FF 
+ 546      725FA3FF 
+ 546      735FA3FF 
+ 547 2314 7461A4FF 		.ascii	"ta\244\377tb\244\377ub\244\377uc\245\377ud\245\377vd\245\377"
+ 547      7462A4FF 
+ 547      7562A4FF 
+ 547      7563A5FF 
+ 547      7564A5FF 
+ 548 232c 7665A6FF 		.ascii	"ve\246\377wf\246\377wg\246\377xg\247\377xh\247\377yi\247\377"
+ 548      7766A6FF 
+ 548      7767A6FF 
+ 548      7867A7FF 
+ 548      7868A7FF 
+ 549 2344 7969A8FF 		.ascii	"yi\250\377zj\250\377zk\250\377{l\251\377{l\251\377|m\251\377"
+ 549      7A6AA8FF 
+ 549      7A6BA8FF 
+ 549      7B6CA9FF 
+ 549      7B6CA9FF 
+ 550 235c 7C6EA9FF 		.ascii	"|n\251\377}n\252\377}o\252\377~p\252\377~q\253\377\177q\253\377"
+ 550      7D6EAAFF 
+ 550      7D6FAAFF 
+ 550      7E70AAFF 
+ 550      7E71ABFF 
+ 551 2374 7F72ABFF 		.ascii	"\177r\253\377\200s\254\377\200s\254\377\201t\254\377\201t\255"
+ 551      8073ACFF 
+ 551      8073ACFF 
+ 551      8174ACFF 
+ 551      8174AD
+ 552 2387 FF8175AD 		.ascii	"\377\201u\255\377\202u\255\377\202v\256\377\203v\256\377\203"
+ 552      FF8275AD 
+ 552      FF8276AE 
+ 552      FF8376AE 
+ 552      FF83
+ 553 2399 77AFFF84 		.ascii	"w\257\377\204w\257\377\204x\257\377\205x\260\377\205y\260\377"
+ 553      77AFFF84 
+ 553      78AFFF85 
+ 553      78B0FF85 
+ 553      79B0FF
+ 554 23ac 867AB0FF 		.ascii	"\206z\260\377\206z\261\377\207{\261\377\207{\262\377\210|\262"
+ 554      867AB1FF 
+ 554      877BB1FF 
+ 554      877BB2FF 
+ 554      887CB2
+GAS LISTING /tmp/ccRe9WAw.s 			page 41
+
+
+ 555 23bf FF887CB2 		.ascii	"\377\210|\262\377\211}\263\377\211}\263\377\212~\263\377\212"
+ 555      FF897DB3 
+ 555      FF897DB3 
+ 555      FF8A7EB3 
+ 555      FF8A
+ 556 23d1 7EB4FF8B 		.ascii	"~\264\377\213\177\264\377\213\177\265\377\213\200\265\377\214"
+ 556      7FB4FF8B 
+ 556      7FB5FF8B 
+ 556      80B5FF8C 
+ 557 23e1 81B5FF8C 		.ascii	"\201\265\377\214\201\266\377\215\202\266\377\215\202\266\377"
+ 557      81B6FF8D 
+ 557      82B6FF8D 
+ 557      82B6FF
+ 558 23f0 8E83B7FF 		.ascii	"\216\203\267\377\216\203\267\377\217\204\267\377\217\204\270"
+ 558      8E83B7FF 
+ 558      8F84B7FF 
+ 558      8F84B8
+ 559 23ff FF9085B8 		.ascii	"\377\220\205\270\377\220\205\271\377\221\206\271\377\221\207"
+ 559      FF9085B9 
+ 559      FF9186B9 
+ 559      FF9187
+ 560 240e B9FF9287 		.ascii	"\271\377\222\207\272\377\222\210\272\377\223\210\272\377\223"
+ 560      BAFF9288 
+ 560      BAFF9388 
+ 560      BAFF93
+ 561 241d 89BBFF94 		.ascii	"\211\273\377\224\211\273\377\224\212\274\377\225\212\274\377"
+ 561      89BBFF94 
+ 561      8ABCFF95 
+ 561      8ABCFF
+ 562 242c 958BBCFF 		.ascii	"\225\213\274\377\226\213\275\377\226\214\275\377\227\215\275"
+ 562      968BBDFF 
+ 562      968CBDFF 
+ 562      978DBD
+ 563 243b FF978DBE 		.ascii	"\377\227\215\276\377\230\216\276\377\230\216\277\377\231\217"
+ 563      FF988EBE 
+ 563      FF988EBF 
+ 563      FF998F
+ 564 244a BFFF998F 		.ascii	"\277\377\231\217\277\377\232\220\300\377\232\220\300\377\233"
+ 564      BFFF9A90 
+ 564      C0FF9A90 
+ 564      C0FF9B
+ 565 2459 91C0FF9B 		.ascii	"\221\300\377\233\221\301\377\233\222\301\377\234\223\302\377"
+ 565      91C1FF9B 
+ 565      92C1FF9C 
+ 565      93C2FF
+ 566 2468 9C93C2FF 		.ascii	"\234\223\302\377\235\224\302\377\235\224\303\377\236\225\303"
+ 566      9D94C2FF 
+ 566      9D94C3FF 
+ 566      9E95C3
+ 567 2477 FF9E95C3 		.ascii	"\377\236\225\303\377\237\226\304\377\237\226\304\377\240\227"
+ 567      FF9F96C4 
+ 567      FF9F96C4 
+ 567      FFA097
+ 568 2486 C4FFA097 		.ascii	"\304\377\240\227\305\377\241\230\305\377\241\231\306\377\242"
+ 568      C5FFA198 
+ 568      C5FFA199 
+ 568      C6FFA2
+GAS LISTING /tmp/ccRe9WAw.s 			page 42
+
+
+ 569 2495 99C6FFA2 		.ascii	"\231\306\377\242\232\306\377\243\232\307\377\243\233\307\377"
+ 569      9AC6FFA3 
+ 569      9AC7FFA3 
+ 569      9BC7FF
+ 570 24a4 A49BC7FF 		.ascii	"\244\233\307\377\244\234\310\377\245\234\310\377\245\235\311"
+ 570      A49CC8FF 
+ 570      A59CC8FF 
+ 570      A59DC9
+ 571 24b3 FFA69EC9 		.ascii	"\377\246\236\311\377\246\236\311\377\247\237\312\377\247\237"
+ 571      FFA69EC9 
+ 571      FFA79FCA 
+ 571      FFA79F
+ 572 24c2 CAFFA8A0 		.ascii	"\312\377\250\240\312\377\250\240\313\377\251\241\313\377\251"
+ 572      CAFFA8A0 
+ 572      CBFFA9A1 
+ 572      CBFFA9
+ 573 24d1 A1CCFFAA 		.ascii	"\241\314\377\252\242\314\377\252\243\314\377\253\243\315\377"
+ 573      A2CCFFAA 
+ 573      A3CCFFAB 
+ 573      A3CDFF
+ 574 24e0 ABA4CDFF 		.ascii	"\253\244\315\377\254\244\315\377\254\245\316\377\255\245\316"
+ 574      ACA4CDFF 
+ 574      ACA5CEFF 
+ 574      ADA5CE
+ 575 24ef FFADA6CE 		.ascii	"\377\255\246\316\377\256\246\317\377\256\247\317\377\257\250"
+ 575      FFAEA6CF 
+ 575      FFAEA7CF 
+ 575      FFAFA8
+ 576 24fe D0FFAFA8 		.ascii	"\320\377\257\250\320\377\260\251\320\377\260\251\321\377\261"
+ 576      D0FFB0A9 
+ 576      D0FFB0A9 
+ 576      D1FFB1
+ 577 250d AAD1FFB1 		.ascii	"\252\321\377\261\252\321\377\262\253\322\377\262\253\322\377"
+ 577      AAD1FFB2 
+ 577      ABD2FFB2 
+ 577      ABD2FF
+ 578 251c B2ACD2FF 		.ascii	"\262\254\322\377\263\254\323\377\263\255\323\377\263\255\323"
+ 578      B3ACD3FF 
+ 578      B3ADD3FF 
+ 578      B3ADD3
+ 579 252b FFB4AED3 		.ascii	"\377\264\256\323\377\264\256\324\377\264\257\324\377\265\257"
+ 579      FFB4AED4 
+ 579      FFB4AFD4 
+ 579      FFB5AF
+ 580 253a D4FFB5B0 		.ascii	"\324\377\265\260\324\377\265\260\325\377\266\260\325\377\266"
+ 580      D4FFB5B0 
+ 580      D5FFB6B0 
+ 580      D5FFB6
+ 581 2549 B1D5FFB6 		.ascii	"\261\325\377\266\261\325\377\267\262\326\377\267\262\326\377"
+ 581      B1D5FFB7 
+ 581      B2D6FFB7 
+ 581      B2D6FF
+ 582 2558 B7B3D6FF 		.ascii	"\267\263\326\377\270\263\326\377\270\264\327\377\270\264\327"
+ 582      B8B3D6FF 
+ 582      B8B4D7FF 
+ 582      B8B4D7
+ 583 2567 FFB9B5D7 		.ascii	"\377\271\265\327\377\271\265\327\377\271\266\330\377\272\266"
+GAS LISTING /tmp/ccRe9WAw.s 			page 43
+
+
+ 583      FFB9B5D7 
+ 583      FFB9B6D8 
+ 583      FFBAB6
+ 584 2576 D8FFBAB6 		.ascii	"\330\377\272\266\330\377\272\267\331\377\273\267\331\377\273"
+ 584      D8FFBAB7 
+ 584      D9FFBBB7 
+ 584      D9FFBB
+ 585 2585 B8D9FFBB 		.ascii	"\270\331\377\273\270\331\377\274\271\332\377\274\271\332\377"
+ 585      B8D9FFBC 
+ 585      B9DAFFBC 
+ 585      B9DAFF
+ 586 2594 BCBADAFF 		.ascii	"\274\272\332\377\275\272\332\377\275\273\333\377\275\273\333"
+ 586      BDBADAFF 
+ 586      BDBBDBFF 
+ 586      BDBBDB
+ 587 25a3 FFBEBCDB 		.ascii	"\377\276\274\333\377\276\274\333\377\276\274\334\377\277\275"
+ 587      FFBEBCDB 
+ 587      FFBEBCDC 
+ 587      FFBFBD
+ 588 25b2 DCFFBFBD 		.ascii	"\334\377\277\275\334\377\300\276\334\377\300\276\335\377\300"
+ 588      DCFFC0BE 
+ 588      DCFFC0BE 
+ 588      DDFFC0
+ 589 25c1 BFDDFFC1 		.ascii	"\277\335\377\301\277\335\377\301\300\335\377\301\300\336\377"
+ 589      BFDDFFC1 
+ 589      C0DDFFC1 
+ 589      C0DEFF
+ 590 25d0 C2C1DEFF 		.ascii	"\302\301\336\377\302\301\336\377\302\302\336\377\303\302\336"
+ 590      C2C1DEFF 
+ 590      C2C2DEFF 
+ 590      C3C2DE
+ 591 25df FFC3C2DF 		.ascii	"\377\303\302\337\377\304\303\337\377\304\303\337\377\304\304"
+ 591      FFC4C3DF 
+ 591      FFC4C3DF 
+ 591      FFC4C4
+ 592 25ee DFFFC5C4 		.ascii	"\337\377\305\304\340\377\305\305\340\377\305\305\340\377\306"
+ 592      E0FFC5C5 
+ 592      E0FFC5C5 
+ 592      E0FFC6
+ 593 25fd C6E0FFC6 		.ascii	"\306\340\377\306\306\341\377\307\307\341\377\307\307\341\377"
+ 593      C6E1FFC7 
+ 593      C7E1FFC7 
+ 593      C7E1FF
+ 594 260c C7C7E1FF 		.ascii	"\307\307\341\377\310\310\342\377\310\310\342\377\310\311\342"
+ 594      C8C8E2FF 
+ 594      C8C8E2FF 
+ 594      C8C9E2
+ 595 261b FFC9C9E2 		.ascii	"\377\311\311\342\377\311\312\343\377\312\312\343\377\312\313"
+ 595      FFC9CAE3 
+ 595      FFCACAE3 
+ 595      FFCACB
+ 596 262a E3FFCACB 		.ascii	"\343\377\312\313\343\377\313\314\344\377\313\314\344\377\314"
+ 596      E3FFCBCC 
+ 596      E4FFCBCC 
+ 596      E4FFCC
+ 597 2639 CCE4FFCC 		.ascii	"\314\344\377\314\315\344\377\314\315\344\377\315\316\345\377"
+ 597      CDE4FFCC 
+GAS LISTING /tmp/ccRe9WAw.s 			page 44
+
+
+ 597      CDE4FFCD 
+ 597      CEE5FF
+ 598 2648 CDCEE5FF 		.ascii	"\315\316\345\377\316\317\345\377\316\317\345\377\316\320\346"
+ 598      CECFE5FF 
+ 598      CECFE5FF 
+ 598      CED0E6
+ 599 2657 FFCFD0E6 		.ascii	"\377\317\320\346\377\317\321\346\377\320\321\346\377\320\322"
+ 599      FFCFD1E6 
+ 599      FFD0D1E6 
+ 599      FFD0D2
+ 600 2666 E7FFD0D2 		.ascii	"\347\377\320\322\347\377\321\322\347\377\321\323\347\377\322"
+ 600      E7FFD1D2 
+ 600      E7FFD1D3 
+ 600      E7FFD2
+ 601 2675 D3E7FFD2 		.ascii	"\323\347\377\322\324\350\377\323\324\350\377\323\325\350\377"
+ 601      D4E8FFD3 
+ 601      D4E8FFD3 
+ 601      D5E8FF
+ 602 2684 D3D5E8FF 		.ascii	"\323\325\350\377\324\326\351\377\324\326\351\377\325\327\351"
+ 602      D4D6E9FF 
+ 602      D4D6E9FF 
+ 602      D5D7E9
+ 603 2693 FFD5D7E9 		.ascii	"\377\325\327\351\377\326\327\351\377\326\330\352\377\326\330"
+ 603      FFD6D7E9 
+ 603      FFD6D8EA 
+ 603      FFD6D8
+ 604 26a2 EAFFD7D9 		.ascii	"\352\377\327\331\352\377\327\331\352\377\354\325\333\377\354"
+ 604      EAFFD7D9 
+ 604      EAFFECD5 
+ 604      DBFFEC
+ 605 26b1 D5DBFFEC 		.ascii	"\325\333\377\354\326\334\377\354\326\334\377\354\326\335\377"
+ 605      D6DCFFEC 
+ 605      D6DCFFEC 
+ 605      D6DDFF
+ 606 26c0 ECD7DDFF 		.ascii	"\354\327\335\377\354\327\336\377\354\327\336\377\354\330\337"
+ 606      ECD7DEFF 
+ 606      ECD7DEFF 
+ 606      ECD8DF
+ 607 26cf FFECD8DF 		.ascii	"\377\354\330\337\377\354\330\337\377\354\331\340\377\354\331"
+ 607      FFECD8DF 
+ 607      FFECD9E0 
+ 607      FFECD9
+ 608 26de E0FFECD9 		.ascii	"\340\377\354\331\341\377\354\332\341\377\354\332\342\377\354"
+ 608      E1FFECDA 
+ 608      E1FFECDA 
+ 608      E2FFEC
+ 609 26ed DAE2FFEC 		.ascii	"\332\342\377\354\333\342\377\354\333\343\377\354\333\343\377"
+ 609      DBE2FFEC 
+ 609      DBE3FFEC 
+ 609      DBE3FF
+ 610 26fc ECDCE4FF 		.ascii	"\354\334\344\377\354\334\344\377\354\334\344\377\354\335\345"
+ 610      ECDCE4FF 
+ 610      ECDCE4FF 
+ 610      ECDDE5
+ 611 270b FFECDDE5 		.ascii	"\377\354\335\345\377\354\335\345\377\354\336\346\377\354\336"
+ 611      FFECDDE5 
+ 611      FFECDEE6 
+GAS LISTING /tmp/ccRe9WAw.s 			page 45
+
+
+ 611      FFECDE
+ 612 271a E6FFECDF 		.ascii	"\346\377\354\337\347\377\354\337\347\377\354\337\347\377\354"
+ 612      E7FFECDF 
+ 612      E7FFECDF 
+ 612      E7FFEC
+ 613 2729 E0E8FFEC 		.ascii	"\340\350\377\354\340\350\377\354\340\350\377\354\341\351\377"
+ 613      E0E8FFEC 
+ 613      E0E8FFEC 
+ 613      E1E9FF
+ 614 2738 ECE1E9FF 		.ascii	"\354\341\351\377\354\341\351\377\354\342\352\377\354\342\352"
+ 614      ECE1E9FF 
+ 614      ECE2EAFF 
+ 614      ECE2EA
+ 615 2747 FFECE2EA 		.ascii	"\377\354\342\352\377\355\343\353\377\355\343\353\377\355\343"
+ 615      FFEDE3EB 
+ 615      FFEDE3EB 
+ 615      FFEDE3
+ 616 2756 EBFFEDE4 		.ascii	"\353\377\355\344\353\377\355\344\354\377\355\344\354\377\355"
+ 616      EBFFEDE4 
+ 616      ECFFEDE4 
+ 616      ECFFED
+ 617 2765 E5ECFFED 		.ascii	"\345\354\377\355\345\355\377\355\345\355\377\355\346\355\377"
+ 617      E5EDFFED 
+ 617      E5EDFFED 
+ 617      E6EDFF
+ 618 2774 EDE6EDFF 		.ascii	"\355\346\355\377\355\346\356\377\355\347\356\377\355\347\356"
+ 618      EDE6EEFF 
+ 618      EDE7EEFF 
+ 618      EDE7EE
+ 619 2783 FFEDE7EE 		.ascii	"\377\355\347\356\377\356\350\357\377\356\350\357\377\356\350"
+ 619      FFEEE8EF 
+ 619      FFEEE8EF 
+ 619      FFEEE8
+ 620 2792 EFFFEEE9 		.ascii	"\357\377\356\351\357\377\356\351\360\377\356\351\360\377\356"
+ 620      EFFFEEE9 
+ 620      F0FFEEE9 
+ 620      F0FFEE
+ 621 27a1 EAF0FFEE 		.ascii	"\352\360\377\356\352\360\377\356\352\360\377\356\353\361\377"
+ 621      EAF0FFEE 
+ 621      EAF0FFEE 
+ 621      EBF1FF
+ 622 27b0 EFEBF1FF 		.ascii	"\357\353\361\377\357\353\361\377\357\354\361\377\357\354\361"
+ 622      EFEBF1FF 
+ 622      EFECF1FF 
+ 622      EFECF1
+ 623 27bf FFEFECF2 		.ascii	"\377\357\354\362\377\357\355\362\377\357\355\362\377\360\355"
+ 623      FFEFEDF2 
+ 623      FFEFEDF2 
+ 623      FFF0ED
+ 624 27ce F2FFF0EE 		.ascii	"\362\377\360\356\362\377\360\356\363\377\360\356\363\377\360"
+ 624      F2FFF0EE 
+ 624      F3FFF0EE 
+ 624      F3FFF0
+ 625 27dd EFF3FFF0 		.ascii	"\357\363\377\360\357\363\377\361\357\363\377\361\360\363\377"
+ 625      EFF3FFF1 
+ 625      EFF3FFF1 
+ 625      F0F3FF
+GAS LISTING /tmp/ccRe9WAw.s 			page 46
+
+
+ 626 27ec F1F0F4FF 		.ascii	"\361\360\364\377\361\360\364\377\361\361\364\377\362\361\364"
+ 626      F1F0F4FF 
+ 626      F1F1F4FF 
+ 626      F2F1F4
+ 627 27fb FFF2F1F4 		.ascii	"\377\362\361\364\377\362\361\364\377\362\362\364\377\363\362"
+ 627      FFF2F1F4 
+ 627      FFF2F2F4 
+ 627      FFF3F2
+ 628 280a F5FFF3F2 		.ascii	"\365\377\363\362\365\377"
+ 628      F5FF
+ 629 2810 F3F3F5FF 		.ascii	"\363\363\365\377\363\363\365\377\363\363\365\377\364\364\365"
+ 629      F3F3F5FF 
+ 629      F3F3F5FF 
+ 629      F4F4F5
+ 630 281f FFF4F4F5 		.ascii	"\377\364\364\365\377\364\364\366\377\365\364\366\377\365\365"
+ 630      FFF4F4F6 
+ 630      FFF5F4F6 
+ 630      FFF5F5
+ 631 282e F6FFF5F5 		.ascii	"\366\377\365\365\366\377\365\365\366\377\366\366\366\377\366"
+ 631      F6FFF5F5 
+ 631      F6FFF6F6 
+ 631      F6FFF6
+ 632 283d F6F6FFF6 		.ascii	"\366\366\377\366\366\366\377\367\367\367\377\367\366\366\377"
+ 632      F6F6FFF7 
+ 632      F7F7FFF7 
+ 632      F6F6FF
+ 633 284c F7F6F6FF 		.ascii	"\367\366\366\377\367\365\366\377\370\365\366\377\370\365\365"
+ 633      F7F5F6FF 
+ 633      F8F5F6FF 
+ 633      F8F5F5
+ 634 285b FFF8F4F5 		.ascii	"\377\370\364\365\377\371\364\365\377\371\364\365\377\371\363"
+ 634      FFF9F4F5 
+ 634      FFF9F4F5 
+ 634      FFF9F3
+ 635 286a F4FFFAF3 		.ascii	"\364\377\372\363\364\377\372\363\364\377\373\362\363\377\373"
+ 635      F4FFFAF3 
+ 635      F4FFFBF2 
+ 635      F3FFFB
+ 636 2879 F2F3FFFB 		.ascii	"\362\363\377\373\362\363\377\374\361\362\377\374\361\362\377"
+ 636      F2F3FFFC 
+ 636      F1F2FFFC 
+ 636      F1F2FF
+ 637 2888 FCF1F2FF 		.ascii	"\374\361\362\377\375\360\361\377\375\360\361\377\375\360\360"
+ 637      FDF0F1FF 
+ 637      FDF0F1FF 
+ 637      FDF0F0
+ 638 2897 FFFEEFF0 		.ascii	"\377\376\357\360\377\376\357\360\377\376\357\357\377\377\356"
+ 638      FFFEEFF0 
+ 638      FFFEEFEF 
+ 638      FFFFEE
+ 639 28a6 EFFFFFEE 		.ascii	"\357\377\377\356\356\377\377\356\356\377\377\356\355\377\377"
+ 639      EEFFFFEE 
+ 639      EEFFFFEE 
+ 639      EDFFFF
+ 640 28b5 EDEDFFFF 		.ascii	"\355\355\377\377\355\354\377\377\355\354\377\377\354\353\377"
+ 640      EDECFFFF 
+ 640      EDECFFFF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 47
+
+
+ 640      ECEBFF
+ 641 28c4 FFECEBFF 		.ascii	"\377\354\353\377\377\354\352\377\377\353\351\377\377\353\351"
+ 641      FFECEAFF 
+ 641      FFEBE9FF 
+ 641      FFEBE9
+ 642 28d3 FFFFEBE8 		.ascii	"\377\377\353\350\377\377\352\350\377\377\352\347\377\377\352"
+ 642      FFFFEAE8 
+ 642      FFFFEAE7 
+ 642      FFFFEA
+ 643 28e2 E6FFFFEA 		.ascii	"\346\377\377\352\346\377\377\351\345\377\377\351\345\377\377"
+ 643      E6FFFFE9 
+ 643      E5FFFFE9 
+ 643      E5FFFF
+ 644 28f1 E9E4FFFF 		.ascii	"\351\344\377\377\350\343\377\377\350\343\377\377\350\342\377"
+ 644      E8E3FFFF 
+ 644      E8E3FFFF 
+ 644      E8E2FF
+ 645 2900 FFE8E1FF 		.ascii	"\377\350\341\377\377\347\340\377\377\347\340\377\377\347\337"
+ 645      FFE7E0FF 
+ 645      FFE7E0FF 
+ 645      FFE7DF
+ 646 290f FFFFE7DE 		.ascii	"\377\377\347\336\377\377\346\336\377\377\346\335\377\377\346"
+ 646      FFFFE6DE 
+ 646      FFFFE6DD 
+ 646      FFFFE6
+ 647 291e DCFFFFE6 		.ascii	"\334\377\377\346\333\377\377\345\333\377\377\345\332\377\377"
+ 647      DBFFFFE5 
+ 647      DBFFFFE5 
+ 647      DAFFFF
+ 648 292d E5D9FFFF 		.ascii	"\345\331\377\377\345\330\377\377\344\330\377\377\344\327\377"
+ 648      E5D8FFFF 
+ 648      E4D8FFFF 
+ 648      E4D7FF
+ 649 293c FFE4D6FF 		.ascii	"\377\344\326\377\377\344\325\377\377\344\324\377\377\343\324"
+ 649      FFE4D5FF 
+ 649      FFE4D4FF 
+ 649      FFE3D4
+ 650 294b FFFFE3D3 		.ascii	"\377\377\343\323\377\377\343\322\377\377\343\321\377\377\343"
+ 650      FFFFE3D2 
+ 650      FFFFE3D1 
+ 650      FFFFE3
+ 651 295a D0FFFFE2 		.ascii	"\320\377\377\342\320\377\377\342\317\377\377\342\316\377\377"
+ 651      D0FFFFE2 
+ 651      CFFFFFE2 
+ 651      CEFFFF
+ 652 2969 E2CDFFFF 		.ascii	"\342\315\377\377\342\314\377\377\342\314\377\377\342\313\377"
+ 652      E2CCFFFF 
+ 652      E2CCFFFF 
+ 652      E2CBFF
+ 653 2978 FFE1CAFF 		.ascii	"\377\341\312\377\377\341\311\377\377\341\310\377\377\341\307"
+ 653      FFE1C9FF 
+ 653      FFE1C8FF 
+ 653      FFE1C7
+ 654 2987 FFFFE1C7 		.ascii	"\377\377\341\307\377\377\341\306\377\377\341\305\377\377\341"
+ 654      FFFFE1C6 
+ 654      FFFFE1C5 
+ 654      FFFFE1
+GAS LISTING /tmp/ccRe9WAw.s 			page 48
+
+
+ 655 2996 C4FFFFE0 		.ascii	"\304\377\377\340\303\377\377\340\303\377\377\340\302\377\377"
+ 655      C3FFFFE0 
+ 655      C3FFFFE0 
+ 655      C2FFFF
+ 656 29a5 E0C1FFFF 		.ascii	"\340\301\377\377\340\300\377\377\340\277\377\377\340\276\377"
+ 656      E0C0FFFF 
+ 656      E0BFFFFF 
+ 656      E0BEFF
+ 657 29b4 FFE0BEFF 		.ascii	"\377\340\276\377\377\340\275\377\377\340\274\377\377\340\273"
+ 657      FFE0BDFF 
+ 657      FFE0BCFF 
+ 657      FFE0BB
+ 658 29c3 FFFFE0BA 		.ascii	"\377\377\340\272\377\377\340\272\377\377\340\271\377\377\340"
+ 658      FFFFE0BA 
+ 658      FFFFE0B9 
+ 658      FFFFE0
+ 659 29d2 B8FFFFE0 		.ascii	"\270\377\377\340\267\377\376\340\267\377\376\340\266\377\375"
+ 659      B7FFFEE0 
+ 659      B7FFFEE0 
+ 659      B6FFFD
+ 660 29e1 DFB5FFFD 		.ascii	"\337\265\377\375\337\264\377\375\337\263\377\375\336\263\377"
+ 660      DFB4FFFD 
+ 660      DFB3FFFD 
+ 660      DEB3FF
+ 661 29f0 FDDEB2FF 		.ascii	"\375\336\262\377\375\335\261\377\375\335\260\377\375\335\257"
+ 661      FDDDB1FF 
+ 661      FDDDB0FF 
+ 661      FDDDAF
+ 662 29ff FFFDDCAE 		.ascii	"\377\375\334\256\377\375\334\256\377\375\334\255\377\375\333"
+ 662      FFFDDCAE 
+ 662      FFFDDCAD 
+ 662      FFFDDB
+ 663 2a0e ACFFFDDB 		.ascii	"\254\377\375\333\253\377\375\332\252\377\375\332\251\377\375"
+ 663      ABFFFDDA 
+ 663      AAFFFDDA 
+ 663      A9FFFD
+ 664 2a1d DAA9FFFD 		.ascii	"\332\251\377\375\331\250\377\375\331\247\377\375\331\246\377"
+ 664      D9A8FFFD 
+ 664      D9A7FFFD 
+ 664      D9A6FF
+ 665 2a2c FDD8A5FF 		.ascii	"\375\330\245\377\375\330\244\377\375\327\244\377\375\327\243"
+ 665      FDD8A4FF 
+ 665      FDD7A4FF 
+ 665      FDD7A3
+ 666 2a3b FFFDD7A2 		.ascii	"\377\375\327\242\377\375\326\241\377\375\326\240\377\375\325"
+ 666      FFFDD6A1 
+ 666      FFFDD6A0 
+ 666      FFFDD5
+ 667 2a4a A0FFFDD5 		.ascii	"\240\377\375\325\237\377\375\325\236\377\375\324\235\377\375"
+ 667      9FFFFDD5 
+ 667      9EFFFDD4 
+ 667      9DFFFD
+ 668 2a59 D49CFFFD 		.ascii	"\324\234\377\375\324\233\377\375\323\233\377\375\323\232\377"
+ 668      D49BFFFD 
+ 668      D39BFFFD 
+ 668      D39AFF
+ 669 2a68 FDD299FF 		.ascii	"\375\322\231\377\375\322\230\377\375\322\227\377\375\321\227"
+GAS LISTING /tmp/ccRe9WAw.s 			page 49
+
+
+ 669      FDD298FF 
+ 669      FDD297FF 
+ 669      FDD197
+ 670 2a77 FFFDD196 		.ascii	"\377\375\321\226\377\375\320\225\377\375\320\224\377\375\320"
+ 670      FFFDD095 
+ 670      FFFDD094 
+ 670      FFFDD0
+ 671 2a86 93FFFDCF 		.ascii	"\223\377\375\317\222\377\375\317\222\377\375\317\221\377\375"
+ 671      92FFFDCF 
+ 671      92FFFDCF 
+ 671      91FFFD
+ 672 2a95 CE90FFFD 		.ascii	"\316\220\377\375\316\217\377\375\315\216\377\375\315\216\377"
+ 672      CE8FFFFD 
+ 672      CD8EFFFD 
+ 672      CD8EFF
+ 673 2aa4 FDCD8DFF 		.ascii	"\375\315\215\377\375\314\214\377\375\314\213\377\375\313\212"
+ 673      FDCC8CFF 
+ 673      FDCC8BFF 
+ 673      FDCB8A
+ 674 2ab3 FFFDCB8A 		.ascii	"\377\375\313\212\377\375\313\211\377\375\312\210\377\375\312"
+ 674      FFFDCB89 
+ 674      FFFDCA88 
+ 674      FFFDCA
+ 675 2ac2 87FFFDC9 		.ascii	"\207\377\375\311\206\377\375\311\206\377\375\311\205\377\375"
+ 675      86FFFDC9 
+ 675      86FFFDC9 
+ 675      85FFFD
+ 676 2ad1 C884FFFD 		.ascii	"\310\204\377\375\310\203\377\375\310\202\377\375\307\202\377"
+ 676      C883FFFD 
+ 676      C882FFFD 
+ 676      C782FF
+ 677 2ae0 FDC781FF 		.ascii	"\375\307\201\377\375\306\200\377\375\306\177\377\375\306~\377"
+ 677      FDC680FF 
+ 677      FDC67FFF 
+ 677      FDC67EFF 
+ 678 2af0 FDC57EFF 		.ascii	"\375\305~\377\375\305}\377\375\304|\377\375\304{\377\375\304"
+ 678      FDC57DFF 
+ 678      FDC47CFF 
+ 678      FDC47BFF 
+ 678      FDC4
+ 679 2b02 7AFFFDC3 		.ascii	"z\377\375\303z\377\375\303y\377\375\302x\377\375\302w\377\375"
+ 679      7AFFFDC3 
+ 679      79FFFDC2 
+ 679      78FFFDC2 
+ 679      77FFFD
+ 680 2b15 C276FFFD 		.ascii	"\302v\377\375\301v\377\375\301u\377\375\300t\377\375\300s\377"
+ 680      C176FFFD 
+ 680      C175FFFD 
+ 680      C074FFFD 
+ 680      C073FF
+ 681 2b28 FDC072FF 		.ascii	"\375\300r\377\375\277r\377\375\277q\377\375\276p\377\375\276"
+ 681      FDBF72FF 
+ 681      FDBF71FF 
+ 681      FDBE70FF 
+ 681      FDBE
+ 682 2b3a 6FFFFDBE 		.ascii	"o\377\375\276n\377\375\275n\377\375\275m\377\375\274l\377\375"
+ 682      6EFFFDBD 
+GAS LISTING /tmp/ccRe9WAw.s 			page 50
+
+
+ 682      6EFFFDBD 
+ 682      6DFFFDBC 
+ 682      6CFFFD
+ 683 2b4d BC6BFFFD 		.ascii	"\274k\377\375\274j\377\375\273j\377\375\273i\377\375\272h\377"
+ 683      BC6AFFFD 
+ 683      BB6AFFFD 
+ 683      BB69FFFD 
+ 683      BA68FF
+ 684 2b60 FDBA67FF 		.ascii	"\375\272g\377\375\271f\377\375\271f\377\375\271e\377\375\270"
+ 684      FDB966FF 
+ 684      FDB966FF 
+ 684      FDB965FF 
+ 684      FDB8
+ 685 2b72 64FFFDB8 		.ascii	"d\377\375\270c\377\374\267b\377\374\267b\377\374\266a\377\374"
+ 685      63FFFCB7 
+ 685      62FFFCB7 
+ 685      62FFFCB6 
+ 685      61FFFC
+ 686 2b85 B660FFFB 		.ascii	"\266`\377\373\265`\377\373\265_\377\373\264^\377\372\264]\377"
+ 686      B560FFFB 
+ 686      B55FFFFB 
+ 686      B45EFFFA 
+ 686      B45DFF
+ 687 2b98 FAB35DFF 		.ascii	"\372\263]\377\372\263\\\377\372\262[\377\371\262[\377\371\261"
+ 687      FAB35CFF 
+ 687      FAB25BFF 
+ 687      F9B25BFF 
+ 687      F9B1
+ 688 2baa 5AFFF9B1 		.ascii	"Z\377\371\261Y\377\371\260X\377\370\260X\377\370\257W\377\370"
+ 688      59FFF9B0 
+ 688      58FFF8B0 
+ 688      58FFF8AF 
+ 688      57FFF8
+ 689 2bbd AF56FFF7 		.ascii	"\257V\377\367\256V\377\367\255U\377\367\255T\377\367\254T\377"
+ 689      AE56FFF7 
+ 689      AD55FFF7 
+ 689      AD54FFF7 
+ 689      AC54FF
+ 690 2bd0 F6AC53FF 		.ascii	"\366\254S\377\366\253R\377\366\253Q\377\365\252Q\377\365\252"
+ 690      F6AB52FF 
+ 690      F6AB51FF 
+ 690      F5AA51FF 
+ 690      F5AA
+ 691 2be2 50FFF5A9 		.ascii	"P\377\365\251O\377\365\251O\377\364\250N\377\364\250M\377\364"
+ 691      4FFFF5A9 
+ 691      4FFFF4A8 
+ 691      4EFFF4A8 
+ 691      4DFFF4
+ 692 2bf5 A74CFFF4 		.ascii	"\247L\377\364\247L\377\363\246K\377\363\246J\377\363\245J\377"
+ 692      A74CFFF3 
+ 692      A64BFFF3 
+ 692      A64AFFF3 
+ 692      A54AFF
+ 693 2c08 F2A549FF 		.ascii	"\362\245I\377\362\244H\377\362\244G\377\362\243G\377\361\242"
+ 693      F2A448FF 
+ 693      F2A447FF 
+ 693      F2A347FF 
+GAS LISTING /tmp/ccRe9WAw.s 			page 51
+
+
+ 693      F1A2
+ 694 2c1a 46FFF1A2 		.ascii	"F\377\361\242E\377\361\241E\377\360\241D\377\360\240C\377\360"
+ 694      45FFF1A1 
+ 694      45FFF0A1 
+ 694      44FFF0A0 
+ 694      43FFF0
+ 695 2c2d A042FFF0 		.ascii	"\240B\377\360\237B\377\357\237A\377\357\236@\377\357\236@\377"
+ 695      9F42FFEF 
+ 695      9F41FFEF 
+ 695      9E40FFEF 
+ 695      9E40FF
+ 696 2c40 EE9D3FFF 		.ascii	"\356\235?\377\356\235>\377\356\234=\377\356\234=\377\355\233"
+ 696      EE9D3EFF 
+ 696      EE9C3DFF 
+ 696      EE9C3DFF 
+ 696      ED9B
+ 697 2c52 3CFFED9B 		.ascii	"<\377\355\233;\377\355\232:\377\354\232:\377\354\2319\377\354"
+ 697      3BFFED9A 
+ 697      3AFFEC9A 
+ 697      3AFFEC99 
+ 697      39FFEC
+ 698 2c65 9938FFEC 		.ascii	"\2318\377\354\2307\377\353\2277\377\353\2276\377\353\2265\377"
+ 698      9837FFEB 
+ 698      9737FFEB 
+ 698      9736FFEB 
+ 698      9635FF
+ 699 2c78 EA9635FF 		.ascii	"\352\2265\377\352\2254\377\352\2253\377\352\2242\377\351\224"
+ 699      EA9534FF 
+ 699      EA9533FF 
+ 699      EA9432FF 
+ 699      E994
+ 700 2c8a 31FFE993 		.ascii	"1\377\351\2231\377\351\2230\377\350\222/\377\350\222.\377\350"
+ 700      31FFE993 
+ 700      30FFE892 
+ 700      2FFFE892 
+ 700      2EFFE8
+ 701 2c9d 912EFFE8 		.ascii	"\221.\377\350\221-\377\347\220,\377\347\220+\377\347\217*\377"
+ 701      912DFFE7 
+ 701      902CFFE7 
+ 701      902BFFE7 
+ 701      8F2AFF
+ 702 2cb0 E68E2AFF 		.ascii	"\346\216*\377\346\216)\377\346\215(\377\346\215'\377\345\214"
+ 702      E68E29FF 
+ 702      E68D28FF 
+ 702      E68D27FF 
+ 702      E58C
+ 703 2cc2 26FFE58C 		.ascii	"&\377\345\214&\377\345\213%\377\344\213$\377\344\212#\377\344"
+ 703      26FFE58B 
+ 703      25FFE48B 
+ 703      24FFE48A 
+ 703      23FFE4
+ 704 2cd5 8A22FFE4 		.ascii	"\212\"\377\344\211!\377\343\211 \377\343\210 \377\343\210\037"
+ 704      8921FFE3 
+ 704      8920FFE3 
+ 704      8820FFE3 
+ 704      881F
+ 705 2ce7 FFE2871E 		.ascii	"\377\342\207\036\377\342\206\035\377\342\206\034\377\342\205"
+GAS LISTING /tmp/ccRe9WAw.s 			page 52
+
+
+ 705      FFE2861D 
+ 705      FFE2861C 
+ 705      FFE285
+ 706 2cf6 1BFFE185 		.ascii	"\033\377\341\205\032\377\341\204\031\377\341\204\030\377\340"
+ 706      1AFFE184 
+ 706      19FFE184 
+ 706      18FFE0
+ 707 2d05 8317FFE0 		.ascii	"\203\027\377\340\203\026\377\340\202\025\377\340\202\024\377"
+ 707      8316FFE0 
+ 707      8215FFE0 
+ 707      8214FF
+ 708 2d14 DF8113FF 		.ascii	"\337\201\023\377\337\201\023\377\336\200\023\377\336\200\023"
+ 708      DF8113FF 
+ 708      DE8013FF 
+ 708      DE8013
+ 709 2d23 FFDD7F13 		.ascii	"\377\335\177\023\377\335\177\023\377\335\177\023\377\334~\022"
+ 709      FFDD7F13 
+ 709      FFDD7F13 
+ 709      FFDC7E12 
+ 710 2d33 FFDC7E12 		.ascii	"\377\334~\022\377\333}\022\377\333}\022\377\332}\022\377\332"
+ 710      FFDB7D12 
+ 710      FFDB7D12 
+ 710      FFDA7D12 
+ 710      FFDA
+ 711 2d45 7C12FFDA 		.ascii	"|\022\377\332|\022\377\331{\021\377\331{\021\377\330z\021\377"
+ 711      7C12FFD9 
+ 711      7B11FFD9 
+ 711      7B11FFD8 
+ 711      7A11FF
+ 712 2d58 D87A11FF 		.ascii	"\330z\021\377\327z\021\377\327y\021\377\326y\021\377\326x\020"
+ 712      D77A11FF 
+ 712      D77911FF 
+ 712      D67911FF 
+ 712      D67810
+ 713 2d6b FFD67810 		.ascii	"\377\326x\020\377\325w\020\377\325w\020\377\324w\020\377\324"
+ 713      FFD57710 
+ 713      FFD57710 
+ 713      FFD47710 
+ 713      FFD4
+ 714 2d7d 7610FFD3 		.ascii	"v\020\377\323v\020\377\323u\020\377\323u\017\377\322u\017\377"
+ 714      7610FFD3 
+ 714      7510FFD3 
+ 714      750FFFD2 
+ 714      750FFF
+ 715 2d90 D2740FFF 		.ascii	"\322t\017\377\321t\017\377\321s\017\377\320s\017\377\320r\017"
+ 715      D1740FFF 
+ 715      D1730FFF 
+ 715      D0730FFF 
+ 715      D0720F
+ 716 2da3 FFCF720E 		.ascii	"\377\317r\016\377\317r\016\377\317q\016\377\316q\016\377\316"
+ 716      FFCF720E 
+ 716      FFCF710E 
+ 716      FFCE710E 
+ 716      FFCE
+ 717 2db5 700EFFCD 		.ascii	"p\016\377\315p\016\377\315p\016\377\314o\r\377\314o\r\377\314"
+ 717      700EFFCD 
+ 717      700EFFCC 
+GAS LISTING /tmp/ccRe9WAw.s 			page 53
+
+
+ 717      6F0DFFCC 
+ 717      6F0DFFCC 
+ 718 2dc9 6E0DFFCB 		.ascii	"n\r\377\313n\r\377\313n\r\377\312m\r\377\312m\r\377\311l\f\377"
+ 718      6E0DFFCB 
+ 718      6E0DFFCA 
+ 718      6D0DFFCA 
+ 718      6D0DFFC9 
+ 719 2de0 C96C0CFF 		.ascii	"\311l\f\377\310k\f\377\310k\f\377\310k\f\377\307j\f\377\307j"
+ 719      C86B0CFF 
+ 719      C86B0CFF 
+ 719      C86B0CFF 
+ 719      C76A0CFF 
+ 720 2df6 0CFFC669 		.ascii	"\f\377\306i\013\377\306i\013\377\305i\013\377\305h\013\377\305"
+ 720      0BFFC669 
+ 720      0BFFC569 
+ 720      0BFFC568 
+ 720      0BFFC5
+ 721 2e09 680BFFC4 		.ascii	"h\013\377\304g\013\377\304g\013\377\303g\n\377\303f\n\377\302"
+ 721      670BFFC4 
+ 721      670BFFC3 
+ 721      670AFFC3 
+ 721      660AFFC2 
+ 722 2e1d 660AFFC2 		.ascii	"f\n\377\302e\n\377\301e\n\377\301e\n\377\301d\n\377\300d\t\377"
+ 722      650AFFC1 
+ 722      650AFFC1 
+ 722      650AFFC1 
+ 722      640AFFC0 
+ 723 2e34 C06309FF 		.ascii	"\300c\t\377\277c\t\377\277c\t\377\276b\t\377\276b\t\377\275a"
+ 723      BF6309FF 
+ 723      BF6309FF 
+ 723      BE6209FF 
+ 723      BE6209FF 
+ 724 2e4a 09FFBD61 		.ascii	"\t\377\275a\b\377\275a\b\377\274`\b\377\274`\b\377\273_\b\377"
+ 724      08FFBD61 
+ 724      08FFBC60 
+ 724      08FFBC60 
+ 724      08FFBB5F 
+ 725 2e60 BB5F08FF 		.ascii	"\273_\b\377\272^\b\377\272^\b\377\271^\007\377\271]\007\377\271"
+ 725      BA5E08FF 
+ 725      BA5E08FF 
+ 725      B95E07FF 
+ 725      B95D07FF 
+ 726 2e75 5D07FFB8 		.ascii	"]\007\377\270\\\007\377\270\\\007\377\267\\\007\377\267[\007"
+ 726      5C07FFB8 
+ 726      5C07FFB7 
+ 726      5C07FFB7 
+ 726      5B07
+ 727 2e87 FFB65B07 		.ascii	"\377\266[\007\377\266[\006\377\265Z\006\377\265Z\006\377\265"
+ 727      FFB65B06 
+ 727      FFB55A06 
+ 727      FFB55A06 
+ 727      FFB5
+ 728 2e99 5906FFB4 		.ascii	"Y\006\377\264Y\006\377\264Y\006\377\263X\006\377\263X\006\377"
+ 728      5906FFB4 
+ 728      5906FFB3 
+ 728      5806FFB3 
+ 728      5806FF
+GAS LISTING /tmp/ccRe9WAw.s 			page 54
+
+
+ 729 2eac B25706FF 		.ascii	"\262W\006\377\262W\006\377\261W\006\377\261V\006\377\260V\006"
+ 729      B25706FF 
+ 729      B15706FF 
+ 729      B15606FF 
+ 729      B05606
+ 730 2ebf FFB05606 		.ascii	"\377\260V\006\377\257V\006\377\257U\006\377\256U\006\377\256"
+ 730      FFAF5606 
+ 730      FFAF5506 
+ 730      FFAE5506 
+ 730      FFAE
+ 731 2ed1 5506FFAD 		.ascii	"U\006\377\255T\006\377\255T\006\377\254T\006\377\254T\006\377"
+ 731      5406FFAD 
+ 731      5406FFAC 
+ 731      5406FFAC 
+ 731      5406FF
+ 732 2ee4 AB5306FF 		.ascii	"\253S\006\377\253S\006\377\252S\006\377\252R\006\377\251R\006"
+ 732      AB5306FF 
+ 732      AA5306FF 
+ 732      AA5206FF 
+ 732      A95206
+ 733 2ef7 FFA95206 		.ascii	"\377\251R\006\377\250Q\006\377\247Q\007\377\247Q\007\377\246"
+ 733      FFA85106 
+ 733      FFA75107 
+ 733      FFA75107 
+ 733      FFA6
+ 734 2f09 5107FFA6 		.ascii	"Q\007\377\246P\007\377\245P\007\377\245P\007\377\244O\007\377"
+ 734      5007FFA5 
+ 734      5007FFA5 
+ 734      5007FFA4 
+ 734      4F07FF
+ 735 2f1c A44F07FF 		.ascii	"\244O\007\377\243O\007\377\243O\007\377\242N\007\377\242N\007"
+ 735      A34F07FF 
+ 735      A34F07FF 
+ 735      A24E07FF 
+ 735      A24E07
+ 736 2f2f FFA14E07 		.ascii	"\377\241N\007\377\241M\007\377\240M\007\377\240M\007\377\237"
+ 736      FFA14D07 
+ 736      FFA04D07 
+ 736      FFA04D07 
+ 736      FF9F
+ 737 2f41 4D07FF9F 		.ascii	"M\007\377\237L\007\377\236L\007\377\236L\007\377\235K\007\377"
+ 737      4C07FF9E 
+ 737      4C07FF9E 
+ 737      4C07FF9D 
+ 737      4B07FF
+ 738 2f54 9D4B07FF 		.ascii	"\235K\007\377\234K\007\377\234K\007\377\233J\007\377\233J\007"
+ 738      9C4B07FF 
+ 738      9C4B07FF 
+ 738      9B4A07FF 
+ 738      9B4A07
+ 739 2f67 FF9A4A07 		.ascii	"\377\232J\007\377\232I\007\377\231I\007\377\231I\007\377\230"
+ 739      FF9A4907 
+ 739      FF994907 
+ 739      FF994907 
+ 739      FF98
+ 740 2f79 4907FF98 		.ascii	"I\007\377\230H\007\377\227H\007\377\227H\007\377\226G\007\377"
+ 740      4807FF97 
+GAS LISTING /tmp/ccRe9WAw.s 			page 55
+
+
+ 740      4807FF97 
+ 740      4807FF96 
+ 740      4707FF
+ 741 2f8c 964707FF 		.ascii	"\226G\007\377\225G\007\377\225G\007\377\224F\007\377\224F\007"
+ 741      954707FF 
+ 741      954707FF 
+ 741      944607FF 
+ 741      944607
+ 742 2f9f FF934607 		.ascii	"\377\223F\007\377\223E\007\377\222E\007\377\222E\b\377\221E\b"
+ 742      FF934507 
+ 742      FF924507 
+ 742      FF924508 
+ 742      FF914508 
+ 743 2fb3 FF914408 		.ascii	"\377\221D\b\377\220D\b\377\220D\b\377\217D\b\377\217C\b\377\216"
+ 743      FF904408 
+ 743      FF904408 
+ 743      FF8F4408 
+ 743      FF8F4308 
+ 744 2fc9 4308FF8E 		.ascii	"C\b\377\216C\b\377\215B\b\377\215B\b\377\214B\b\377\214B\b\377"
+ 744      4308FF8D 
+ 744      4208FF8D 
+ 744      4208FF8C 
+ 744      4208FF8C 
+ 745 2fe0 8B4108FF 		.ascii	"\213A\b\377\213A\b\377\212A\b\377\211@\b\377\211@\b\377\210@"
+ 745      8B4108FF 
+ 745      8A4108FF 
+ 745      894008FF 
+ 745      894008FF 
+ 746 2ff6 08FF8840 		.ascii	"\b\377\210@\b\377\207?\b\377\207?\b\377\206?\b\377\206?\b\377"
+ 746      08FF873F 
+ 746      08FF873F 
+ 746      08FF863F 
+ 746      08FF863F 
+ 747 300c 853E08FF 		.ascii	"\205>\b\377\205>\b\377\204>\b\377\204=\b\377\203=\b\377\203="
+ 747      853E08FF 
+ 747      843E08FF 
+ 747      843D08FF 
+ 747      833D08FF 
+ 748 3022 08FF823D 		.ascii	"\b\377\202=\b\377\202<\b\377\201<\b\377\201<\b\377\200<\b\377"
+ 748      08FF823C 
+ 748      08FF813C 
+ 748      08FF813C 
+ 748      08FF803C 
+ 749 3038 803B08FF 		.ascii	"\200;\b\377\177;\b\377\177;\b\377"
+ 749      7F3B08FF 
+ 749      7F3B08FF 
+ 750              		.globl	heatmap_cs_PuOr_discrete
+ 751              		.section	.data.rel.local
+ 752              		.align 8
+ 753              		.type	heatmap_cs_PuOr_discrete, @object
+ 754              		.size	heatmap_cs_PuOr_discrete, 8
+ 755              	heatmap_cs_PuOr_discrete:
+ 756 0018 00000000 		.quad	discrete
+ 756      00000000 
+ 757              		.section	.data.rel.ro.local
+ 758              		.align 16
+ 759              		.type	discrete, @object
+GAS LISTING /tmp/ccRe9WAw.s 			page 56
+
+
+ 760              		.size	discrete, 16
+ 761              	discrete:
+ 762 0030 00000000 		.quad	discrete_data
+ 762      00000000 
+ 763 0038 0C000000 		.quad	12
+ 763      00000000 
+ 764              		.section	.rodata
+ 765 3044 00000000 		.align 32
+ 765      00000000 
+ 765      00000000 
+ 765      00000000 
+ 765      00000000 
+ 766              		.type	discrete_data, @object
+ 767              		.size	discrete_data, 48
+ 768              	discrete_data:
+ 769 3060 00       		.string	""
+ 770 3061 00       		.string	""
+ 771 3062 00       		.string	""
+ 772 3063 00       		.string	""
+ 773 3064 2D00     		.string	"-"
+ 774 3066 4BFF5427 		.ascii	"K\377T'\210\377\200s\254\377\262\253\322\377\330\332\353\377"
+ 774      88FF8073 
+ 774      ACFFB2AB 
+ 774      D2FFD8DA 
+ 774      EBFF
+ 775 3078 F7F7F7FF 		.ascii	"\367\367\367\377\376\340\266\377\375\270c\377\340\202\024\377"
+ 775      FEE0B6FF 
+ 775      FDB863FF 
+ 775      E08214FF 
+ 776 3088 B35806FF 		.ascii	"\263X\006\377\177;\b\377"
+ 776      7F3B08FF 
+ 777              		.text
+ 778              	.Letext0:
+ 779              		.file 1 "./heatmap.h"
+ 780              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 781              		.file 3 "./colorschemes/PuOr.h"
+ 782              		.file 4 "colorschemes/PuOr.c"
+ 783              		.section	.debug_info,"",@progbits
+ 784              	.Ldebug_info0:
+ 785 0000 E3010000 		.long	0x1e3
+ 786 0004 0500     		.value	0x5
+ 787 0006 01       		.byte	0x1
+ 788 0007 08       		.byte	0x8
+ 789 0008 00000000 		.long	.Ldebug_abbrev0
+ 790 000c 0A       		.uleb128 0xa
+ 791 000d 00000000 		.long	.LASF26
+ 792 0011 1D       		.byte	0x1d
+ 793 0012 00000000 		.long	.LASF0
+ 794 0016 00000000 		.long	.LASF1
+ 795 001a 00000000 		.long	.Ldebug_line0
+ 796 001e 01       		.uleb128 0x1
+ 797 001f 08       		.byte	0x8
+ 798 0020 05       		.byte	0x5
+ 799 0021 00000000 		.long	.LASF2
+ 800 0025 06       		.uleb128 0x6
+ 801 0026 00000000 		.long	.LASF12
+ 802 002a 02       		.byte	0x2
+GAS LISTING /tmp/ccRe9WAw.s 			page 57
+
+
+ 803 002b D6       		.byte	0xd6
+ 804 002c 17       		.byte	0x17
+ 805 002d 31000000 		.long	0x31
+ 806 0031 01       		.uleb128 0x1
+ 807 0032 08       		.byte	0x8
+ 808 0033 07       		.byte	0x7
+ 809 0034 00000000 		.long	.LASF3
+ 810 0038 0B       		.uleb128 0xb
+ 811 0039 04       		.byte	0x4
+ 812 003a 05       		.byte	0x5
+ 813 003b 696E7400 		.string	"int"
+ 814 003f 01       		.uleb128 0x1
+ 815 0040 08       		.byte	0x8
+ 816 0041 05       		.byte	0x5
+ 817 0042 00000000 		.long	.LASF4
+ 818 0046 01       		.uleb128 0x1
+ 819 0047 10       		.byte	0x10
+ 820 0048 04       		.byte	0x4
+ 821 0049 00000000 		.long	.LASF5
+ 822 004d 01       		.uleb128 0x1
+ 823 004e 04       		.byte	0x4
+ 824 004f 04       		.byte	0x4
+ 825 0050 00000000 		.long	.LASF6
+ 826 0054 01       		.uleb128 0x1
+ 827 0055 04       		.byte	0x4
+ 828 0056 07       		.byte	0x7
+ 829 0057 00000000 		.long	.LASF7
+ 830 005b 01       		.uleb128 0x1
+ 831 005c 02       		.byte	0x2
+ 832 005d 07       		.byte	0x7
+ 833 005e 00000000 		.long	.LASF8
+ 834 0062 0C       		.uleb128 0xc
+ 835 0063 10       		.byte	0x10
+ 836 0064 01       		.byte	0x1
+ 837 0065 BB       		.byte	0xbb
+ 838 0066 09       		.byte	0x9
+ 839 0067 84000000 		.long	0x84
+ 840 006b 07       		.uleb128 0x7
+ 841 006c 00000000 		.long	.LASF9
+ 842 0070 BC       		.byte	0xbc
+ 843 0071 1A       		.byte	0x1a
+ 844 0072 84000000 		.long	0x84
+ 845 0076 00       		.byte	0
+ 846 0077 07       		.uleb128 0x7
+ 847 0078 00000000 		.long	.LASF10
+ 848 007c BD       		.byte	0xbd
+ 849 007d 0C       		.byte	0xc
+ 850 007e 25000000 		.long	0x25
+ 851 0082 08       		.byte	0x8
+ 852 0083 00       		.byte	0
+ 853 0084 08       		.uleb128 0x8
+ 854 0085 90000000 		.long	0x90
+ 855 0089 01       		.uleb128 0x1
+ 856 008a 01       		.byte	0x1
+ 857 008b 08       		.byte	0x8
+ 858 008c 00000000 		.long	.LASF11
+ 859 0090 03       		.uleb128 0x3
+GAS LISTING /tmp/ccRe9WAw.s 			page 58
+
+
+ 860 0091 89000000 		.long	0x89
+ 861 0095 06       		.uleb128 0x6
+ 862 0096 00000000 		.long	.LASF13
+ 863 009a 01       		.byte	0x1
+ 864 009b BE       		.byte	0xbe
+ 865 009c 03       		.byte	0x3
+ 866 009d 62000000 		.long	0x62
+ 867 00a1 03       		.uleb128 0x3
+ 868 00a2 95000000 		.long	0x95
+ 869 00a6 08       		.uleb128 0x8
+ 870 00a7 A1000000 		.long	0xa1
+ 871 00ab 04       		.uleb128 0x4
+ 872 00ac 00000000 		.long	.LASF14
+ 873 00b0 21       		.byte	0x21
+ 874 00b1 A6000000 		.long	0xa6
+ 875 00b5 04       		.uleb128 0x4
+ 876 00b6 00000000 		.long	.LASF15
+ 877 00ba 23       		.byte	0x23
+ 878 00bb A6000000 		.long	0xa6
+ 879 00bf 04       		.uleb128 0x4
+ 880 00c0 00000000 		.long	.LASF16
+ 881 00c4 25       		.byte	0x25
+ 882 00c5 A6000000 		.long	0xa6
+ 883 00c9 04       		.uleb128 0x4
+ 884 00ca 00000000 		.long	.LASF17
+ 885 00ce 28       		.byte	0x28
+ 886 00cf A6000000 		.long	0xa6
+ 887 00d3 09       		.uleb128 0x9
+ 888 00d4 90000000 		.long	0x90
+ 889 00d8 E3000000 		.long	0xe3
+ 890 00dc 0D       		.uleb128 0xd
+ 891 00dd 31000000 		.long	0x31
+ 892 00e1 2F       		.byte	0x2f
+ 893 00e2 00       		.byte	0
+ 894 00e3 03       		.uleb128 0x3
+ 895 00e4 D3000000 		.long	0xd3
+ 896 00e8 02       		.uleb128 0x2
+ 897 00e9 00000000 		.long	.LASF18
+ 898 00ed 20       		.byte	0x20
+ 899 00ee 1C       		.byte	0x1c
+ 900 00ef E3000000 		.long	0xe3
+ 901 00f3 09       		.uleb128 0x9
+ 902 00f4 03       		.byte	0x3
+ 903 00f5 00000000 		.quad	discrete_data
+ 903      00000000 
+ 904 00fd 02       		.uleb128 0x2
+ 905 00fe 00000000 		.long	.LASF19
+ 906 0102 23       		.byte	0x23
+ 907 0103 24       		.byte	0x24
+ 908 0104 A1000000 		.long	0xa1
+ 909 0108 09       		.uleb128 0x9
+ 910 0109 03       		.byte	0x3
+ 911 010a 00000000 		.quad	discrete
+ 911      00000000 
+ 912 0112 05       		.uleb128 0x5
+ 913 0113 AB000000 		.long	0xab
+ 914 0117 24       		.byte	0x24
+GAS LISTING /tmp/ccRe9WAw.s 			page 59
+
+
+ 915 0118 09       		.uleb128 0x9
+ 916 0119 03       		.byte	0x3
+ 917 011a 00000000 		.quad	heatmap_cs_PuOr_discrete
+ 917      00000000 
+ 918 0122 09       		.uleb128 0x9
+ 919 0123 90000000 		.long	0x90
+ 920 0127 33010000 		.long	0x133
+ 921 012b 0E       		.uleb128 0xe
+ 922 012c 31000000 		.long	0x31
+ 923 0130 0310     		.value	0x1003
+ 924 0132 00       		.byte	0
+ 925 0133 03       		.uleb128 0x3
+ 926 0134 22010000 		.long	0x122
+ 927 0138 02       		.uleb128 0x2
+ 928 0139 00000000 		.long	.LASF20
+ 929 013d 26       		.byte	0x26
+ 930 013e 1C       		.byte	0x1c
+ 931 013f 33010000 		.long	0x133
+ 932 0143 09       		.uleb128 0x9
+ 933 0144 03       		.byte	0x3
+ 934 0145 00000000 		.quad	soft_data
+ 934      00000000 
+ 935 014d 02       		.uleb128 0x2
+ 936 014e 00000000 		.long	.LASF21
+ 937 0152 29       		.byte	0x29
+ 938 0153 24       		.byte	0x24
+ 939 0154 A1000000 		.long	0xa1
+ 940 0158 09       		.uleb128 0x9
+ 941 0159 03       		.byte	0x3
+ 942 015a 00000000 		.quad	soft
+ 942      00000000 
+ 943 0162 05       		.uleb128 0x5
+ 944 0163 B5000000 		.long	0xb5
+ 945 0167 2A       		.byte	0x2a
+ 946 0168 09       		.uleb128 0x9
+ 947 0169 03       		.byte	0x3
+ 948 016a 00000000 		.quad	heatmap_cs_PuOr_soft
+ 948      00000000 
+ 949 0172 02       		.uleb128 0x2
+ 950 0173 00000000 		.long	.LASF22
+ 951 0177 2C       		.byte	0x2c
+ 952 0178 1C       		.byte	0x1c
+ 953 0179 33010000 		.long	0x133
+ 954 017d 09       		.uleb128 0x9
+ 955 017e 03       		.byte	0x3
+ 956 017f 00000000 		.quad	mixed_data
+ 956      00000000 
+ 957 0187 02       		.uleb128 0x2
+ 958 0188 00000000 		.long	.LASF23
+ 959 018c 2F       		.byte	0x2f
+ 960 018d 24       		.byte	0x24
+ 961 018e A1000000 		.long	0xa1
+ 962 0192 09       		.uleb128 0x9
+ 963 0193 03       		.byte	0x3
+ 964 0194 00000000 		.quad	mixed
+ 964      00000000 
+ 965 019c 05       		.uleb128 0x5
+GAS LISTING /tmp/ccRe9WAw.s 			page 60
+
+
+ 966 019d BF000000 		.long	0xbf
+ 967 01a1 30       		.byte	0x30
+ 968 01a2 09       		.uleb128 0x9
+ 969 01a3 03       		.byte	0x3
+ 970 01a4 00000000 		.quad	heatmap_cs_PuOr_mixed
+ 970      00000000 
+ 971 01ac 02       		.uleb128 0x2
+ 972 01ad 00000000 		.long	.LASF24
+ 973 01b1 32       		.byte	0x32
+ 974 01b2 1C       		.byte	0x1c
+ 975 01b3 33010000 		.long	0x133
+ 976 01b7 09       		.uleb128 0x9
+ 977 01b8 03       		.byte	0x3
+ 978 01b9 00000000 		.quad	mixed_exp_data
+ 978      00000000 
+ 979 01c1 02       		.uleb128 0x2
+ 980 01c2 00000000 		.long	.LASF25
+ 981 01c6 35       		.byte	0x35
+ 982 01c7 24       		.byte	0x24
+ 983 01c8 A1000000 		.long	0xa1
+ 984 01cc 09       		.uleb128 0x9
+ 985 01cd 03       		.byte	0x3
+ 986 01ce 00000000 		.quad	mixed_exp
+ 986      00000000 
+ 987 01d6 05       		.uleb128 0x5
+ 988 01d7 C9000000 		.long	0xc9
+ 989 01db 36       		.byte	0x36
+ 990 01dc 09       		.uleb128 0x9
+ 991 01dd 03       		.byte	0x3
+ 992 01de 00000000 		.quad	heatmap_cs_PuOr_mixed_exp
+ 992      00000000 
+ 993 01e6 00       		.byte	0
+ 994              		.section	.debug_abbrev,"",@progbits
+ 995              	.Ldebug_abbrev0:
+ 996 0000 01       		.uleb128 0x1
+ 997 0001 24       		.uleb128 0x24
+ 998 0002 00       		.byte	0
+ 999 0003 0B       		.uleb128 0xb
+ 1000 0004 0B       		.uleb128 0xb
+ 1001 0005 3E       		.uleb128 0x3e
+ 1002 0006 0B       		.uleb128 0xb
+ 1003 0007 03       		.uleb128 0x3
+ 1004 0008 0E       		.uleb128 0xe
+ 1005 0009 00       		.byte	0
+ 1006 000a 00       		.byte	0
+ 1007 000b 02       		.uleb128 0x2
+ 1008 000c 34       		.uleb128 0x34
+ 1009 000d 00       		.byte	0
+ 1010 000e 03       		.uleb128 0x3
+ 1011 000f 0E       		.uleb128 0xe
+ 1012 0010 3A       		.uleb128 0x3a
+ 1013 0011 21       		.uleb128 0x21
+ 1014 0012 04       		.sleb128 4
+ 1015 0013 3B       		.uleb128 0x3b
+ 1016 0014 0B       		.uleb128 0xb
+ 1017 0015 39       		.uleb128 0x39
+ 1018 0016 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccRe9WAw.s 			page 61
+
+
+ 1019 0017 49       		.uleb128 0x49
+ 1020 0018 13       		.uleb128 0x13
+ 1021 0019 02       		.uleb128 0x2
+ 1022 001a 18       		.uleb128 0x18
+ 1023 001b 00       		.byte	0
+ 1024 001c 00       		.byte	0
+ 1025 001d 03       		.uleb128 0x3
+ 1026 001e 26       		.uleb128 0x26
+ 1027 001f 00       		.byte	0
+ 1028 0020 49       		.uleb128 0x49
+ 1029 0021 13       		.uleb128 0x13
+ 1030 0022 00       		.byte	0
+ 1031 0023 00       		.byte	0
+ 1032 0024 04       		.uleb128 0x4
+ 1033 0025 34       		.uleb128 0x34
+ 1034 0026 00       		.byte	0
+ 1035 0027 03       		.uleb128 0x3
+ 1036 0028 0E       		.uleb128 0xe
+ 1037 0029 3A       		.uleb128 0x3a
+ 1038 002a 21       		.uleb128 0x21
+ 1039 002b 03       		.sleb128 3
+ 1040 002c 3B       		.uleb128 0x3b
+ 1041 002d 0B       		.uleb128 0xb
+ 1042 002e 39       		.uleb128 0x39
+ 1043 002f 21       		.uleb128 0x21
+ 1044 0030 25       		.sleb128 37
+ 1045 0031 49       		.uleb128 0x49
+ 1046 0032 13       		.uleb128 0x13
+ 1047 0033 3F       		.uleb128 0x3f
+ 1048 0034 19       		.uleb128 0x19
+ 1049 0035 3C       		.uleb128 0x3c
+ 1050 0036 19       		.uleb128 0x19
+ 1051 0037 00       		.byte	0
+ 1052 0038 00       		.byte	0
+ 1053 0039 05       		.uleb128 0x5
+ 1054 003a 34       		.uleb128 0x34
+ 1055 003b 00       		.byte	0
+ 1056 003c 47       		.uleb128 0x47
+ 1057 003d 13       		.uleb128 0x13
+ 1058 003e 3A       		.uleb128 0x3a
+ 1059 003f 21       		.uleb128 0x21
+ 1060 0040 04       		.sleb128 4
+ 1061 0041 3B       		.uleb128 0x3b
+ 1062 0042 0B       		.uleb128 0xb
+ 1063 0043 39       		.uleb128 0x39
+ 1064 0044 21       		.uleb128 0x21
+ 1065 0045 1E       		.sleb128 30
+ 1066 0046 02       		.uleb128 0x2
+ 1067 0047 18       		.uleb128 0x18
+ 1068 0048 00       		.byte	0
+ 1069 0049 00       		.byte	0
+ 1070 004a 06       		.uleb128 0x6
+ 1071 004b 16       		.uleb128 0x16
+ 1072 004c 00       		.byte	0
+ 1073 004d 03       		.uleb128 0x3
+ 1074 004e 0E       		.uleb128 0xe
+ 1075 004f 3A       		.uleb128 0x3a
+GAS LISTING /tmp/ccRe9WAw.s 			page 62
+
+
+ 1076 0050 0B       		.uleb128 0xb
+ 1077 0051 3B       		.uleb128 0x3b
+ 1078 0052 0B       		.uleb128 0xb
+ 1079 0053 39       		.uleb128 0x39
+ 1080 0054 0B       		.uleb128 0xb
+ 1081 0055 49       		.uleb128 0x49
+ 1082 0056 13       		.uleb128 0x13
+ 1083 0057 00       		.byte	0
+ 1084 0058 00       		.byte	0
+ 1085 0059 07       		.uleb128 0x7
+ 1086 005a 0D       		.uleb128 0xd
+ 1087 005b 00       		.byte	0
+ 1088 005c 03       		.uleb128 0x3
+ 1089 005d 0E       		.uleb128 0xe
+ 1090 005e 3A       		.uleb128 0x3a
+ 1091 005f 21       		.uleb128 0x21
+ 1092 0060 01       		.sleb128 1
+ 1093 0061 3B       		.uleb128 0x3b
+ 1094 0062 0B       		.uleb128 0xb
+ 1095 0063 39       		.uleb128 0x39
+ 1096 0064 0B       		.uleb128 0xb
+ 1097 0065 49       		.uleb128 0x49
+ 1098 0066 13       		.uleb128 0x13
+ 1099 0067 38       		.uleb128 0x38
+ 1100 0068 0B       		.uleb128 0xb
+ 1101 0069 00       		.byte	0
+ 1102 006a 00       		.byte	0
+ 1103 006b 08       		.uleb128 0x8
+ 1104 006c 0F       		.uleb128 0xf
+ 1105 006d 00       		.byte	0
+ 1106 006e 0B       		.uleb128 0xb
+ 1107 006f 21       		.uleb128 0x21
+ 1108 0070 08       		.sleb128 8
+ 1109 0071 49       		.uleb128 0x49
+ 1110 0072 13       		.uleb128 0x13
+ 1111 0073 00       		.byte	0
+ 1112 0074 00       		.byte	0
+ 1113 0075 09       		.uleb128 0x9
+ 1114 0076 01       		.uleb128 0x1
+ 1115 0077 01       		.byte	0x1
+ 1116 0078 49       		.uleb128 0x49
+ 1117 0079 13       		.uleb128 0x13
+ 1118 007a 01       		.uleb128 0x1
+ 1119 007b 13       		.uleb128 0x13
+ 1120 007c 00       		.byte	0
+ 1121 007d 00       		.byte	0
+ 1122 007e 0A       		.uleb128 0xa
+ 1123 007f 11       		.uleb128 0x11
+ 1124 0080 01       		.byte	0x1
+ 1125 0081 25       		.uleb128 0x25
+ 1126 0082 0E       		.uleb128 0xe
+ 1127 0083 13       		.uleb128 0x13
+ 1128 0084 0B       		.uleb128 0xb
+ 1129 0085 03       		.uleb128 0x3
+ 1130 0086 1F       		.uleb128 0x1f
+ 1131 0087 1B       		.uleb128 0x1b
+ 1132 0088 1F       		.uleb128 0x1f
+GAS LISTING /tmp/ccRe9WAw.s 			page 63
+
+
+ 1133 0089 10       		.uleb128 0x10
+ 1134 008a 17       		.uleb128 0x17
+ 1135 008b 00       		.byte	0
+ 1136 008c 00       		.byte	0
+ 1137 008d 0B       		.uleb128 0xb
+ 1138 008e 24       		.uleb128 0x24
+ 1139 008f 00       		.byte	0
+ 1140 0090 0B       		.uleb128 0xb
+ 1141 0091 0B       		.uleb128 0xb
+ 1142 0092 3E       		.uleb128 0x3e
+ 1143 0093 0B       		.uleb128 0xb
+ 1144 0094 03       		.uleb128 0x3
+ 1145 0095 08       		.uleb128 0x8
+ 1146 0096 00       		.byte	0
+ 1147 0097 00       		.byte	0
+ 1148 0098 0C       		.uleb128 0xc
+ 1149 0099 13       		.uleb128 0x13
+ 1150 009a 01       		.byte	0x1
+ 1151 009b 0B       		.uleb128 0xb
+ 1152 009c 0B       		.uleb128 0xb
+ 1153 009d 3A       		.uleb128 0x3a
+ 1154 009e 0B       		.uleb128 0xb
+ 1155 009f 3B       		.uleb128 0x3b
+ 1156 00a0 0B       		.uleb128 0xb
+ 1157 00a1 39       		.uleb128 0x39
+ 1158 00a2 0B       		.uleb128 0xb
+ 1159 00a3 01       		.uleb128 0x1
+ 1160 00a4 13       		.uleb128 0x13
+ 1161 00a5 00       		.byte	0
+ 1162 00a6 00       		.byte	0
+ 1163 00a7 0D       		.uleb128 0xd
+ 1164 00a8 21       		.uleb128 0x21
+ 1165 00a9 00       		.byte	0
+ 1166 00aa 49       		.uleb128 0x49
+ 1167 00ab 13       		.uleb128 0x13
+ 1168 00ac 2F       		.uleb128 0x2f
+ 1169 00ad 0B       		.uleb128 0xb
+ 1170 00ae 00       		.byte	0
+ 1171 00af 00       		.byte	0
+ 1172 00b0 0E       		.uleb128 0xe
+ 1173 00b1 21       		.uleb128 0x21
+ 1174 00b2 00       		.byte	0
+ 1175 00b3 49       		.uleb128 0x49
+ 1176 00b4 13       		.uleb128 0x13
+ 1177 00b5 2F       		.uleb128 0x2f
+ 1178 00b6 05       		.uleb128 0x5
+ 1179 00b7 00       		.byte	0
+ 1180 00b8 00       		.byte	0
+ 1181 00b9 00       		.byte	0
+ 1182              		.section	.debug_aranges,"",@progbits
+ 1183 0000 1C000000 		.long	0x1c
+ 1184 0004 0200     		.value	0x2
+ 1185 0006 00000000 		.long	.Ldebug_info0
+ 1186 000a 08       		.byte	0x8
+ 1187 000b 00       		.byte	0
+ 1188 000c 0000     		.value	0
+ 1189 000e 0000     		.value	0
+GAS LISTING /tmp/ccRe9WAw.s 			page 64
+
+
+ 1190 0010 00000000 		.quad	0
+ 1190      00000000 
+ 1191 0018 00000000 		.quad	0
+ 1191      00000000 
+ 1192              		.section	.debug_line,"",@progbits
+ 1193              	.Ldebug_line0:
+ 1194 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1194      05000800 
+ 1194      49000000 
+ 1194      010101FB 
+ 1194      0E0D0001 
+ 1195              	.LASF20:
+ 1196 0000 736F6674 		.string	"soft_data"
+ 1196      5F646174 
+ 1196      6100
+ 1197              	.LASF12:
+ 1198 000a 73697A65 		.string	"size_t"
+ 1198      5F7400
+ 1199              	.LASF14:
+ 1200 0011 68656174 		.string	"heatmap_cs_PuOr_discrete"
+ 1200      6D61705F 
+ 1200      63735F50 
+ 1200      754F725F 
+ 1200      64697363 
+ 1201              	.LASF13:
+ 1202 002a 68656174 		.string	"heatmap_colorscheme_t"
+ 1202      6D61705F 
+ 1202      636F6C6F 
+ 1202      72736368 
+ 1202      656D655F 
+ 1203              	.LASF16:
+ 1204 0040 68656174 		.string	"heatmap_cs_PuOr_mixed"
+ 1204      6D61705F 
+ 1204      63735F50 
+ 1204      754F725F 
+ 1204      6D697865 
+ 1205              	.LASF26:
+ 1206 0056 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1206      43313720 
+ 1206      31322E32 
+ 1206      2E30202D 
+ 1206      6D74756E 
+ 1207              	.LASF6:
+ 1208 00b5 666C6F61 		.string	"float"
+ 1208      7400
+ 1209              	.LASF17:
+ 1210 00bb 68656174 		.string	"heatmap_cs_PuOr_mixed_exp"
+ 1210      6D61705F 
+ 1210      63735F50 
+ 1210      754F725F 
+ 1210      6D697865 
+ 1211              	.LASF11:
+ 1212 00d5 756E7369 		.string	"unsigned char"
+ 1212      676E6564 
+ 1212      20636861 
+ 1212      7200
+ 1213              	.LASF3:
+GAS LISTING /tmp/ccRe9WAw.s 			page 65
+
+
+ 1214 00e3 6C6F6E67 		.string	"long unsigned int"
+ 1214      20756E73 
+ 1214      69676E65 
+ 1214      6420696E 
+ 1214      7400
+ 1215              	.LASF8:
+ 1216 00f5 73686F72 		.string	"short unsigned int"
+ 1216      7420756E 
+ 1216      7369676E 
+ 1216      65642069 
+ 1216      6E7400
+ 1217              	.LASF25:
+ 1218 0108 6D697865 		.string	"mixed_exp"
+ 1218      645F6578 
+ 1218      7000
+ 1219              	.LASF23:
+ 1220 0112 6D697865 		.string	"mixed"
+ 1220      6400
+ 1221              	.LASF15:
+ 1222 0118 68656174 		.string	"heatmap_cs_PuOr_soft"
+ 1222      6D61705F 
+ 1222      63735F50 
+ 1222      754F725F 
+ 1222      736F6674 
+ 1223              	.LASF7:
+ 1224 012d 756E7369 		.string	"unsigned int"
+ 1224      676E6564 
+ 1224      20696E74 
+ 1224      00
+ 1225              	.LASF19:
+ 1226 013a 64697363 		.string	"discrete"
+ 1226      72657465 
+ 1226      00
+ 1227              	.LASF10:
+ 1228 0143 6E636F6C 		.string	"ncolors"
+ 1228      6F727300 
+ 1229              	.LASF4:
+ 1230 014b 6C6F6E67 		.string	"long long int"
+ 1230      206C6F6E 
+ 1230      6720696E 
+ 1230      7400
+ 1231              	.LASF24:
+ 1232 0159 6D697865 		.string	"mixed_exp_data"
+ 1232      645F6578 
+ 1232      705F6461 
+ 1232      746100
+ 1233              	.LASF22:
+ 1234 0168 6D697865 		.string	"mixed_data"
+ 1234      645F6461 
+ 1234      746100
+ 1235              	.LASF2:
+ 1236 0173 6C6F6E67 		.string	"long int"
+ 1236      20696E74 
+ 1236      00
+ 1237              	.LASF5:
+ 1238 017c 6C6F6E67 		.string	"long double"
+ 1238      20646F75 
+GAS LISTING /tmp/ccRe9WAw.s 			page 66
+
+
+ 1238      626C6500 
+ 1239              	.LASF18:
+ 1240 0188 64697363 		.string	"discrete_data"
+ 1240      72657465 
+ 1240      5F646174 
+ 1240      6100
+ 1241              	.LASF21:
+ 1242 0196 736F6674 		.string	"soft"
+ 1242      00
+ 1243              	.LASF9:
+ 1244 019b 636F6C6F 		.string	"colors"
+ 1244      727300
+ 1245              		.section	.debug_line_str,"MS",@progbits,1
+ 1246              	.LASF1:
+ 1247 0000 2F726F6F 		.string	"/root/repo"
+ 1247      742F7265 
+ 1247      706F00
+ 1248              	.LASF0:
+ 1249 000b 636F6C6F 		.string	"colorschemes/PuOr.c"
+ 1249      72736368 
+ 1249      656D6573 
+ 1249      2F50754F 
+ 1249      722E6300 
+ 1250              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1251 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1251      742F7265 
+ 1251      706F0063 
+ 1251      6F6C6F72 
+ 1251      73636865 
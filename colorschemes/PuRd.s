@@ -0,0 +1,4157 @@
+GAS LISTING /tmp/ccvPZOGL.s 			page 1
+
+
+   1              		.file	"PuRd.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/PuRd.c"
+   5              		.globl	heatmap_cs_PuRd_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_PuRd_mixed_exp, @object
+   9              		.size	heatmap_cs_PuRd_mixed_exp, 8
+  10              	heatmap_cs_PuRd_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 6600     		.string	"f"
+  29 0006 1E00     		.string	"\036"
+  30 0008 6A00     		.string	"j"
+  31 000a 20186D00 		.string	" \030m"
+  32 000e 22316F00 		.string	"\"1o"
+  33 0012 244A7200 		.string	"$Jr"
+  34 0016 26637500 		.string	"&cu"
+  35 001a 287C7800 		.string	"(|x"
+  36 001e 2B958500 		.string	"+\225\205"
+  37 0022 34AE8800 		.string	"4\256\210"
+  38 0026 36C78B00 		.string	"6\307\213"
+  39 002a 38E08E00 		.string	"8\340\216"
+  40 002e 3AF99000 		.string	":\371\220"
+  41 0032 3DFF9300 		.string	"=\377\223"
+  42 0036 3FFF9600 		.string	"?\377\226"
+  43 003a 41FF9900 		.string	"A\377\231"
+  44 003e 43FF9C00 		.string	"C\377\234"
+  45 0042 44FF9F01 		.ascii	"D\377\237\001E\377\241\002F\377\244\003G\377\247\004H\377\252"
+  45      45FFA102 
+  45      46FFA403 
+  45      47FFA704 
+  45      48FFAA
+  46 0055 0549FFAD 		.ascii	"\005I\377\255\005J\377\272\nO\377\275\013P\377\300\fQ\377\303"
+  46      054AFFBA 
+  46      0A4FFFBD 
+  46      0B50FFC0 
+  46      0C51FFC3 
+GAS LISTING /tmp/ccvPZOGL.s 			page 2
+
+
+  47 0069 0D52FFC5 		.ascii	"\rR\377\305\016S\377\310\017T\377\313\020U\377\315\021U\377\317"
+  47      0E53FFC8 
+  47      0F54FFCB 
+  47      1055FFCD 
+  47      1155FFCF 
+  48 007d 1258FFD0 		.ascii	"\022X\377\320\023Z\377\322\024\\\377\323\024_\377\324\025a\377"
+  48      135AFFD2 
+  48      145CFFD3 
+  48      145FFFD4 
+  48      1561FF
+  49 0090 D51663FF 		.ascii	"\325\026c\377\327\027f\377\330\030h\377\336\036u\377\337\037"
+  49      D71766FF 
+  49      D81868FF 
+  49      DE1E75FF 
+  49      DF1F
+  50 00a2 77FFE020 		.ascii	"w\377\340 y\377\341!|\377\342\"~\377\343$\200\377\344%\203\377"
+  50      79FFE121 
+  50      7CFFE222 
+  50      7EFFE324 
+  50      80FFE425 
+  51 00b8 E52685FF 		.ascii	"\345&\205\377\346'\207\377\346(\211\377\346,\213\377\346/\215"
+  51      E62787FF 
+  51      E62889FF 
+  51      E62C8BFF 
+  51      E62F8D
+  52 00cb FFE6338F 		.ascii	"\377\3463\217\377\3465\220\377\3458\222\377\345;\223\377\345"
+  52      FFE63590 
+  52      FFE53892 
+  52      FFE53B93 
+  52      FFE5
+  53 00dd 3D95FFE4 		.ascii	"=\225\377\344?\227\377\344B\230\377\344D\231\377\342R\242\377"
+  53      3F97FFE4 
+  53      4298FFE4 
+  53      4499FFE2 
+  53      52A2FF
+  54 00f0 E254A4FF 		.ascii	"\342T\244\377\341V\245\377\341X\246\377\341Z\250\377\340[\251"
+  54      E156A5FF 
+  54      E158A6FF 
+  54      E15AA8FF 
+  54      E05BA9
+  55 0103 FFE05DAA 		.ascii	"\377\340]\252\377\340_\253\377\337`\255\377\337b\256\377\337"
+  55      FFE05FAB 
+  55      FFDF60AD 
+  55      FFDF62AE 
+  55      FFDF
+  56 0115 64AFFFDE 		.ascii	"d\257\377\336e\260\377\335g\261\377\335i\262\377\334k\263\377"
+  56      65B0FFDD 
+  56      67B1FFDD 
+  56      69B2FFDC 
+  56      6BB3FF
+  57 0128 DB6CB4FF 		.ascii	"\333l\264\377\332n\265\377\332p\266\377\331q\267\377\330s\270"
+  57      DA6EB5FF 
+  57      DA70B6FF 
+  57      D971B7FF 
+  57      D873B8
+  58 013b FFD774B9 		.ascii	"\377\327t\271\377\327v\271\377\326w\272\377\325y\273\377\320"
+  58      FFD776B9 
+GAS LISTING /tmp/ccvPZOGL.s 			page 3
+
+
+  58      FFD677BA 
+  58      FFD579BB 
+  58      FFD0
+  59 014d 83C0FFD0 		.ascii	"\203\300\377\320\205\301\377\317\206\301\377\316\207\302\377"
+  59      85C1FFCF 
+  59      86C1FFCE 
+  59      87C2FF
+  60 015c CE89C3FF 		.ascii	"\316\211\303\377\315\212\303\377\315\213\304\377\314\214\304"
+  60      CD8AC3FF 
+  60      CD8BC4FF 
+  60      CC8CC4
+  61 016b FFCB8DC4 		.ascii	"\377\313\215\304\377\313\216\305\377\312\220\305\377\312\221"
+  61      FFCB8EC5 
+  61      FFCA90C5 
+  61      FFCA91
+  62 017a C6FFC992 		.ascii	"\306\377\311\222\306\377\311\223\306\377\311\224\307\377\311"
+  62      C6FFC993 
+  62      C6FFC994 
+  62      C7FFC9
+  63 0189 95C7FFC9 		.ascii	"\225\307\377\311\226\310\377\311\227\310\377\312\230\311\377"
+  63      96C8FFC9 
+  63      97C8FFCA 
+  63      98C9FF
+  64 0198 CA99C9FF 		.ascii	"\312\231\311\377\312\231\312\377\312\232\312\377\312\233\313"
+  64      CA99CAFF 
+  64      CA9ACAFF 
+  64      CA9BCB
+  65 01a7 FFCB9CCB 		.ascii	"\377\313\234\313\377\313\235\314\377\313\236\314\377\313\237"
+  65      FFCB9DCC 
+  65      FFCB9ECC 
+  65      FFCB9F
+  66 01b6 CDFFCCA0 		.ascii	"\315\377\314\240\315\377\314\240\316\377\314\241\316\377\314"
+  66      CDFFCCA0 
+  66      CEFFCCA1 
+  66      CEFFCC
+  67 01c5 A2CEFFCF 		.ascii	"\242\316\377\317\252\323\377\317\253\323\377\317\254\323\377"
+  67      AAD3FFCF 
+  67      ABD3FFCF 
+  67      ACD3FF
+  68 01d4 D0ADD4FF 		.ascii	"\320\255\324\377\320\255\324\377\320\256\325\377\320\257\325"
+  68      D0ADD4FF 
+  68      D0AED5FF 
+  68      D0AFD5
+  69 01e3 FFD1B0D5 		.ascii	"\377\321\260\325\377\321\260\326\377\321\261\326\377\321\262"
+  69      FFD1B0D6 
+  69      FFD1B1D6 
+  69      FFD1B2
+  70 01f2 D6FFD1B3 		.ascii	"\326\377\321\263\327\377\322\263\327\377\322\264\327\377\322"
+  70      D7FFD2B3 
+  70      D7FFD2B4 
+  70      D7FFD2
+  71 0201 B5D8FFD2 		.ascii	"\265\330\377\322\265\330\377\323\266\330\377\323\267\331\377"
+  71      B5D8FFD3 
+  71      B6D8FFD3 
+  71      B7D9FF
+  72 0210 D3B7D9FF 		.ascii	"\323\267\331\377\323\270\331\377\324\271\332\377\324\272\332"
+  72      D3B8D9FF 
+GAS LISTING /tmp/ccvPZOGL.s 			page 4
+
+
+  72      D4B9DAFF 
+  72      D4BADA
+  73 021f FFD4BADB 		.ascii	"\377\324\272\333\377\324\273\333\377\325\274\333\377\325\274"
+  73      FFD4BBDB 
+  73      FFD5BCDB 
+  73      FFD5BC
+  74 022e DCFFD5BD 		.ascii	"\334\377\325\275\334\377\325\276\335\377\326\276\335\377\326"
+  74      DCFFD5BE 
+  74      DDFFD6BE 
+  74      DDFFD6
+  75 023d BFDDFFD6 		.ascii	"\277\335\377\326\300\336\377\326\300\336\377\327\301\337\377"
+  75      C0DEFFD6 
+  75      C0DEFFD7 
+  75      C1DFFF
+  76 024c D7C2DFFF 		.ascii	"\327\302\337\377\327\302\337\377\327\303\340\377\330\304\340"
+  76      D7C2DFFF 
+  76      D7C3E0FF 
+  76      D8C4E0
+  77 025b FFD8C4E0 		.ascii	"\377\330\304\340\377\330\305\341\377\331\305\341\377\331\306"
+  77      FFD8C5E1 
+  77      FFD9C5E1 
+  77      FFD9C6
+  78 026a E1FFD9C7 		.ascii	"\341\377\331\307\342\377\331\307\342\377\332\310\342\377\332"
+  78      E2FFD9C7 
+  78      E2FFDAC8 
+  78      E2FFDA
+  79 0279 C8E2FFDE 		.ascii	"\310\342\377\336\321\347\377\336\321\347\377\336\322\350\377"
+  79      D1E7FFDE 
+  79      D1E7FFDE 
+  79      D2E8FF
+  80 0288 DFD2E8FF 		.ascii	"\337\322\350\377\337\323\350\377\337\323\350\377\337\324\351"
+  80      DFD3E8FF 
+  80      DFD3E8FF 
+  80      DFD4E9
+  81 0297 FFE0D5E9 		.ascii	"\377\340\325\351\377\340\325\351\377\340\326\351\377\340\326"
+  81      FFE0D5E9 
+  81      FFE0D6E9 
+  81      FFE0D6
+  82 02a6 EAFFE1D7 		.ascii	"\352\377\341\327\352\377\341\327\352\377\341\327\352\377\342"
+  82      EAFFE1D7 
+  82      EAFFE1D7 
+  82      EAFFE2
+  83 02b5 D8EBFFE2 		.ascii	"\330\353\377\342\330\353\377\342\331\353\377\342\331\353\377"
+  83      D8EBFFE2 
+  83      D9EBFFE2 
+  83      D9EBFF
+  84 02c4 E3DAEBFF 		.ascii	"\343\332\353\377\343\332\354\377\343\333\354\377\343\333\354"
+  84      E3DAECFF 
+  84      E3DBECFF 
+  84      E3DBEC
+  85 02d3 FFE4DCEC 		.ascii	"\377\344\334\354\377\344\334\354\377\344\334\355\377\344\335"
+  85      FFE4DCEC 
+  85      FFE4DCED 
+  85      FFE4DD
+  86 02e2 EDFFE5DD 		.ascii	"\355\377\345\335\355\377\345\336\355\377\345\336\355\377\345"
+  86      EDFFE5DE 
+  86      EDFFE5DE 
+GAS LISTING /tmp/ccvPZOGL.s 			page 5
+
+
+  86      EDFFE5
+  87 02f1 DEEEFFE5 		.ascii	"\336\356\377\345\337\356\377\346\337\356\377\346\340\356\377"
+  87      DFEEFFE6 
+  87      DFEEFFE6 
+  87      E0EEFF
+  88 0300 E6E0EEFF 		.ascii	"\346\340\356\377\346\340\356\377\347\341\357\377\347\341\357"
+  88      E6E0EEFF 
+  88      E7E1EFFF 
+  88      E7E1EF
+  89 030f FFE7E1EF 		.ascii	"\377\347\341\357\377\347\341\357\377\347\341\357\377\347\341"
+  89      FFE7E1EF 
+  89      FFE7E1EF 
+  89      FFE7E1
+  90 031e EFFFE8E2 		.ascii	"\357\377\350\342\357\377\350\342\357\377\350\342\357\377\350"
+  90      EFFFE8E2 
+  90      EFFFE8E2 
+  90      EFFFE8
+  91 032d E2EFFFE8 		.ascii	"\342\357\377\350\342\357\377\350\342\360\377\350\343\360\377"
+  91      E2EFFFE8 
+  91      E2F0FFE8 
+  91      E3F0FF
+  92 033c E9E3F0FF 		.ascii	"\351\343\360\377\351\343\360\377\351\343\360\377\351\343\360"
+  92      E9E3F0FF 
+  92      E9E3F0FF 
+  92      E9E3F0
+  93 034b FFE9E3F0 		.ascii	"\377\351\343\360\377\351\344\360\377\351\344\360\377\351\344"
+  93      FFE9E4F0 
+  93      FFE9E4F0 
+  93      FFE9E4
+  94 035a F0FFEAE4 		.ascii	"\360\377\352\344\360\377\352\344\360\377\352\344\360\377\352"
+  94      F0FFEAE4 
+  94      F0FFEAE4 
+  94      F0FFEA
+  95 0369 E4F1FFEA 		.ascii	"\344\361\377\352\345\361\377\352\345\361\377\352\345\361\377"
+  95      E5F1FFEA 
+  95      E5F1FFEA 
+  95      E5F1FF
+  96 0378 EAE5F1FF 		.ascii	"\352\345\361\377\353\345\361\377\353\345\361\377\353\345\361"
+  96      EBE5F1FF 
+  96      EBE5F1FF 
+  96      EBE5F1
+  97 0387 FFEBE5F1 		.ascii	"\377\353\345\361\377\353\346\361\377\353\346\361\377\353\346"
+  97      FFEBE6F1 
+  97      FFEBE6F1 
+  97      FFEBE6
+  98 0396 F1FFEBE6 		.ascii	"\361\377\353\346\361\377\353\346\361\377\354\346\361\377\354"
+  98      F1FFEBE6 
+  98      F1FFECE6 
+  98      F1FFEC
+  99 03a5 E6F1FFEC 		.ascii	"\346\361\377\354\346\362\377\354\347\362\377\354\347\362\377"
+  99      E6F2FFEC 
+  99      E7F2FFEC 
+  99      E7F2FF
+ 100 03b4 ECE7F2FF 		.ascii	"\354\347\362\377\354\347\362\377\354\347\362\377\354\347\362"
+ 100      ECE7F2FF 
+ 100      ECE7F2FF 
+ 100      ECE7F2
+GAS LISTING /tmp/ccvPZOGL.s 			page 6
+
+
+ 101 03c3 FFECE7F2 		.ascii	"\377\354\347\362\377\355\347\362\377\355\347\362\377\355\350"
+ 101      FFEDE7F2 
+ 101      FFEDE7F2 
+ 101      FFEDE8
+ 102 03d2 F2FFEDE8 		.ascii	"\362\377\355\350\362\377\355\350\362\377\355\350\362\377\355"
+ 102      F2FFEDE8 
+ 102      F2FFEDE8 
+ 102      F2FFED
+ 103 03e1 E8F2FFF0 		.ascii	"\350\362\377\360\354\364\377\360\354\364\377\360\354\364\377"
+ 103      ECF4FFF0 
+ 103      ECF4FFF0 
+ 103      ECF4FF
+ 104 03f0 F1ECF5FF 		.ascii	"\361\354\365\377\361\354\365\377\361\354\365\377\361\354\365"
+ 104      F1ECF5FF 
+ 104      F1ECF5FF 
+ 104      F1ECF5
+ 105 03ff FFF1ECF5 		.ascii	"\377\361\354\365\377\361\355\365\377\361\355\365\377\361\355"
+ 105      FFF1EDF5 
+ 105      FFF1EDF5 
+ 105      FFF1ED
+ 106 040e F5FFF1ED 		.ascii	"\365\377\361\355\365\377\361\355\365\377\361\355\365\377\361"
+ 106      F5FFF1ED 
+ 106      F5FFF1ED 
+ 106      F5FFF1
+ 107 041d EDF5FFF1 		.ascii	"\355\365\377\361\355\365\377\362\355\365\377\362\355\365\377"
+ 107      EDF5FFF2 
+ 107      EDF5FFF2 
+ 107      EDF5FF
+ 108 042c F2EDF5FF 		.ascii	"\362\355\365\377\362\355\365\377\362\356\365\377\362\356\365"
+ 108      F2EDF5FF 
+ 108      F2EEF5FF 
+ 108      F2EEF5
+ 109 043b FFF2EEF5 		.ascii	"\377\362\356\365\377\362\356\365\377\362\356\365\377\362\356"
+ 109      FFF2EEF5 
+ 109      FFF2EEF5 
+ 109      FFF2EE
+ 110 044a F6FFF2EE 		.ascii	"\366\377\362\356\366\377\362\356\366\377\362\356\366\377\362"
+ 110      F6FFF2EE 
+ 110      F6FFF2EE 
+ 110      F6FFF2
+ 111 0459 EEF6FFF2 		.ascii	"\356\366\377\362\356\366\377\362\356\366\377\362\356\366\377"
+ 111      EEF6FFF2 
+ 111      EEF6FFF2 
+ 111      EEF6FF
+ 112 0468 F3EFF6FF 		.ascii	"\363\357\366\377\363\357\366\377\363\357\366\377\363\357\366"
+ 112      F3EFF6FF 
+ 112      F3EFF6FF 
+ 112      F3EFF6
+ 113 0477 FFF3EFF6 		.ascii	"\377\363\357\366\377\363\357\366\377\363\357\366\377\363\357"
+ 113      FFF3EFF6 
+ 113      FFF3EFF6 
+ 113      FFF3EF
+ 114 0486 F6FFF3EF 		.ascii	"\366\377\363\357\366\377\363\357\366\377\363\357\366\377\363"
+ 114      F6FFF3EF 
+ 114      F6FFF3EF 
+ 114      F6FFF3
+ 115 0495 EFF6FFF3 		.ascii	"\357\366\377\363\357\366\377\363\357\366\377\363\357\366\377"
+GAS LISTING /tmp/ccvPZOGL.s 			page 7
+
+
+ 115      EFF6FFF3 
+ 115      EFF6FFF3 
+ 115      EFF6FF
+ 116 04a4 F3EFF6FF 		.ascii	"\363\357\366\377\363\357\366\377\363\360\366\377\363\360\366"
+ 116      F3EFF6FF 
+ 116      F3F0F6FF 
+ 116      F3F0F6
+ 117 04b3 FFF3F0F6 		.ascii	"\377\363\360\366\377\363\360\366\377\364\360\366\377\364\360"
+ 117      FFF3F0F6 
+ 117      FFF4F0F6 
+ 117      FFF4F0
+ 118 04c2 F7FFF4F0 		.ascii	"\367\377\364\360\367\377\364\360\367\377\364\360\367\377\364"
+ 118      F7FFF4F0 
+ 118      F7FFF4F0 
+ 118      F7FFF4
+ 119 04d1 F0F7FFF4 		.ascii	"\360\367\377\364\360\367\377\364\360\367\377\364\360\367\377"
+ 119      F0F7FFF4 
+ 119      F0F7FFF4 
+ 119      F0F7FF
+ 120 04e0 F4F0F7FF 		.ascii	"\364\360\367\377\364\360\367\377\364\360\367\377\364\360\367"
+ 120      F4F0F7FF 
+ 120      F4F0F7FF 
+ 120      F4F0F7
+ 121 04ef FFF4F0F7 		.ascii	"\377\364\360\367\377\364\360\367\377\364\360\367\377\364\360"
+ 121      FFF4F0F7 
+ 121      FFF4F0F7 
+ 121      FFF4F0
+ 122 04fe F7FFF4F1 		.ascii	"\367\377\364\361\367\377\364\361\367\377\364\361\367\377\364"
+ 122      F7FFF4F1 
+ 122      F7FFF4F1 
+ 122      F7FFF4
+ 123 050d F1F7FFF4 		.ascii	"\361\367\377\364\361\367\377\364\361\367\377\364\361\367\377"
+ 123      F1F7FFF4 
+ 123      F1F7FFF4 
+ 123      F1F7FF
+ 124 051c F4F1F7FF 		.ascii	"\364\361\367\377\364\361\367\377\364\361\367\377\364\361\367"
+ 124      F4F1F7FF 
+ 124      F4F1F7FF 
+ 124      F4F1F7
+ 125 052b FFF5F1F7 		.ascii	"\377\365\361\367\377\365\361\367\377\365\361\367\377\365\361"
+ 125      FFF5F1F7 
+ 125      FFF5F1F7 
+ 125      FFF5F1
+ 126 053a F7FFF5F1 		.ascii	"\367\377\365\361\367\377\365\361\367\377\365\361\367\377\365"
+ 126      F7FFF5F1 
+ 126      F7FFF5F1 
+ 126      F7FFF5
+ 127 0549 F1F7FFF5 		.ascii	"\361\367\377\365\361\367\377\365\361\367\377\365\361\367\377"
+ 127      F1F7FFF5 
+ 127      F1F7FFF5 
+ 127      F1F7FF
+ 128 0558 F5F1F7FF 		.ascii	"\365\361\367\377\365\361\367\377\365\361\367\377\365\361\367"
+ 128      F5F1F7FF 
+ 128      F5F1F7FF 
+ 128      F5F1F7
+ 129 0567 FFF5F1F7 		.ascii	"\377\365\361\367\377\365\361\367\377\365\362\367\377\365\362"
+ 129      FFF5F1F7 
+GAS LISTING /tmp/ccvPZOGL.s 			page 8
+
+
+ 129      FFF5F2F7 
+ 129      FFF5F2
+ 130 0576 F7FFF5F2 		.ascii	"\367\377\365\362\367\377\365\362\367\377\365\362\367\377\365"
+ 130      F7FFF5F2 
+ 130      F7FFF5F2 
+ 130      F7FFF5
+ 131 0585 F2F8FFF5 		.ascii	"\362\370\377\365\362\370\377\365\362\370\377\365\362\370\377"
+ 131      F2F8FFF5 
+ 131      F2F8FFF5 
+ 131      F2F8FF
+ 132 0594 F5F2F8FF 		.ascii	"\365\362\370\377\365\362\370\377\365\362\370\377\365\362\370"
+ 132      F5F2F8FF 
+ 132      F5F2F8FF 
+ 132      F5F2F8
+ 133 05a3 FFF5F2F8 		.ascii	"\377\365\362\370\377\365\362\370\377\365\362\370\377\365\362"
+ 133      FFF5F2F8 
+ 133      FFF5F2F8 
+ 133      FFF5F2
+ 134 05b2 F8FFF5F2 		.ascii	"\370\377\365\362\370\377\365\362\370\377\365\362\370\377\365"
+ 134      F8FFF5F2 
+ 134      F8FFF5F2 
+ 134      F8FFF5
+ 135 05c1 F2F8FFF5 		.ascii	"\362\370\377\365\362\370\377\365\362\370\377\365\362\370\377"
+ 135      F2F8FFF5 
+ 135      F2F8FFF5 
+ 135      F2F8FF
+ 136 05d0 F5F2F8FF 		.ascii	"\365\362\370\377\365\362\370\377\365\362\370\377\365\362\370"
+ 136      F5F2F8FF 
+ 136      F5F2F8FF 
+ 136      F5F2F8
+ 137 05df FFF5F2F8 		.ascii	"\377\365\362\370\377\366\362\370\377\366\362\370\377\366\362"
+ 137      FFF6F2F8 
+ 137      FFF6F2F8 
+ 137      FFF6F2
+ 138 05ee F8FFF6F2 		.ascii	"\370\377\366\362\370\377\366\362\370\377\366\362\370\377\366"
+ 138      F8FFF6F2 
+ 138      F8FFF6F2 
+ 138      F8FFF6
+ 139 05fd F2F8FFF6 		.ascii	"\362\370\377\366\362\370\377\366\362\370\377\366\362\370\377"
+ 139      F2F8FFF6 
+ 139      F2F8FFF6 
+ 139      F2F8FF
+ 140 060c F6F2F8FF 		.ascii	"\366\362\370\377\366\362\370\377\366\362\370\377\366\362\370"
+ 140      F6F2F8FF 
+ 140      F6F2F8FF 
+ 140      F6F2F8
+ 141 061b FFF6F2F8 		.ascii	"\377\366\362\370\377\366\362\370\377\366\363\370\377\366\363"
+ 141      FFF6F2F8 
+ 141      FFF6F3F8 
+ 141      FFF6F3
+ 142 062a F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 142      F8FFF6F3 
+ 142      F8FFF6F3 
+ 142      F8FFF6
+ 143 0639 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 143      F3F8FFF6 
+ 143      F3F8FFF6 
+GAS LISTING /tmp/ccvPZOGL.s 			page 9
+
+
+ 143      F3F8FF
+ 144 0648 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 144      F6F3F8FF 
+ 144      F6F3F8FF 
+ 144      F6F3F8
+ 145 0657 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 145      FFF6F3F8 
+ 145      FFF6F3F8 
+ 145      FFF6F3
+ 146 0666 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 146      F8FFF6F3 
+ 146      F8FFF6F3 
+ 146      F8FFF6
+ 147 0675 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 147      F3F8FFF6 
+ 147      F3F8FFF6 
+ 147      F3F8FF
+ 148 0684 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 148      F6F3F8FF 
+ 148      F6F3F8FF 
+ 148      F6F3F8
+ 149 0693 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 149      FFF6F3F8 
+ 149      FFF6F3F8 
+ 149      FFF6F3
+ 150 06a2 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 150      F8FFF6F3 
+ 150      F8FFF6F3 
+ 150      F8FFF6
+ 151 06b1 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 151      F3F8FFF6 
+ 151      F3F8FFF6 
+ 151      F3F8FF
+ 152 06c0 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 152      F6F3F8FF 
+ 152      F6F3F8FF 
+ 152      F6F3F8
+ 153 06cf FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 153      FFF6F3F8 
+ 153      FFF6F3F8 
+ 153      FFF6F3
+ 154 06de F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 154      F8FFF6F3 
+ 154      F8FFF6F3 
+ 154      F8FFF6
+ 155 06ed F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 155      F3F8FFF6 
+ 155      F3F8FFF6 
+ 155      F3F8FF
+ 156 06fc F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 156      F6F3F8FF 
+ 156      F6F3F8FF 
+ 156      F6F3F8
+ 157 070b FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 157      FFF6F3F8 
+ 157      FFF6F3F8 
+ 157      FFF6F3
+GAS LISTING /tmp/ccvPZOGL.s 			page 10
+
+
+ 158 071a F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 158      F8FFF6F3 
+ 158      F8FFF6F3 
+ 158      F8FFF6
+ 159 0729 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 159      F3F8FFF6 
+ 159      F3F8FFF6 
+ 159      F3F8FF
+ 160 0738 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 160      F6F3F8FF 
+ 160      F6F3F8FF 
+ 160      F6F3F8
+ 161 0747 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 161      FFF6F3F8 
+ 161      FFF6F3F8 
+ 161      FFF6F3
+ 162 0756 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 162      F8FFF6F3 
+ 162      F8FFF6F3 
+ 162      F8FFF6
+ 163 0765 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 163      F3F8FFF6 
+ 163      F3F8FFF6 
+ 163      F3F8FF
+ 164 0774 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 164      F6F3F8FF 
+ 164      F6F3F8FF 
+ 164      F6F3F8
+ 165 0783 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 165      FFF6F3F8 
+ 165      FFF6F3F8 
+ 165      FFF6F3
+ 166 0792 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 166      F8FFF6F3 
+ 166      F8FFF6F3 
+ 166      F8FFF6
+ 167 07a1 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 167      F3F8FFF6 
+ 167      F3F8FFF6 
+ 167      F3F8FF
+ 168 07b0 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 168      F6F3F8FF 
+ 168      F6F3F8FF 
+ 168      F6F3F8
+ 169 07bf FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 169      FFF6F3F8 
+ 169      FFF6F3F8 
+ 169      FFF6F3
+ 170 07ce F8FF     		.ascii	"\370\377"
+ 171 07d0 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 171      F6F3F8FF 
+ 171      F6F3F8FF 
+ 171      F6F3F8
+ 172 07df FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 172      FFF6F3F8 
+ 172      FFF6F3F8 
+ 172      FFF6F3
+GAS LISTING /tmp/ccvPZOGL.s 			page 11
+
+
+ 173 07ee F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 173      F8FFF6F3 
+ 173      F8FFF6F3 
+ 173      F8FFF6
+ 174 07fd F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 174      F3F8FFF6 
+ 174      F3F8FFF6 
+ 174      F3F8FF
+ 175 080c F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 175      F6F3F8FF 
+ 175      F6F3F8FF 
+ 175      F6F3F8
+ 176 081b FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 176      FFF6F3F8 
+ 176      FFF6F3F8 
+ 176      FFF6F3
+ 177 082a F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 177      F8FFF6F3 
+ 177      F8FFF6F3 
+ 177      F8FFF6
+ 178 0839 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 178      F3F8FFF6 
+ 178      F3F8FFF6 
+ 178      F3F8FF
+ 179 0848 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 179      F6F3F8FF 
+ 179      F6F3F8FF 
+ 179      F6F3F8
+ 180 0857 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 180      FFF6F3F8 
+ 180      FFF6F3F8 
+ 180      FFF6F3
+ 181 0866 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 181      F8FFF6F3 
+ 181      F8FFF6F3 
+ 181      F8FFF6
+ 182 0875 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 182      F3F8FFF6 
+ 182      F3F8FFF6 
+ 182      F3F8FF
+ 183 0884 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 183      F6F3F8FF 
+ 183      F6F3F8FF 
+ 183      F6F3F8
+ 184 0893 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 184      FFF6F3F8 
+ 184      FFF6F3F8 
+ 184      FFF6F3
+ 185 08a2 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 185      F8FFF6F3 
+ 185      F8FFF6F3 
+ 185      F8FFF6
+ 186 08b1 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 186      F3F8FFF6 
+ 186      F3F8FFF6 
+ 186      F3F8FF
+ 187 08c0 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+GAS LISTING /tmp/ccvPZOGL.s 			page 12
+
+
+ 187      F6F3F8FF 
+ 187      F6F3F8FF 
+ 187      F6F3F8
+ 188 08cf FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 188      FFF6F3F8 
+ 188      FFF6F3F8 
+ 188      FFF6F3
+ 189 08de F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 189      F8FFF6F3 
+ 189      F8FFF6F3 
+ 189      F8FFF6
+ 190 08ed F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 190      F3F8FFF6 
+ 190      F3F8FFF6 
+ 190      F3F8FF
+ 191 08fc F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 191      F6F3F8FF 
+ 191      F6F3F8FF 
+ 191      F6F3F8
+ 192 090b FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 192      FFF6F3F8 
+ 192      FFF6F3F8 
+ 192      FFF6F3
+ 193 091a F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 193      F8FFF6F3 
+ 193      F8FFF6F3 
+ 193      F8FFF6
+ 194 0929 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 194      F3F8FFF6 
+ 194      F3F8FFF6 
+ 194      F3F8FF
+ 195 0938 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 195      F6F3F8FF 
+ 195      F6F3F8FF 
+ 195      F6F3F8
+ 196 0947 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 196      FFF6F3F8 
+ 196      FFF6F3F8 
+ 196      FFF6F3
+ 197 0956 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 197      F8FFF6F3 
+ 197      F8FFF6F3 
+ 197      F8FFF6
+ 198 0965 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 198      F3F8FFF6 
+ 198      F3F8FFF6 
+ 198      F3F8FF
+ 199 0974 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 199      F6F3F8FF 
+ 199      F6F3F8FF 
+ 199      F6F3F8
+ 200 0983 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 200      FFF6F3F8 
+ 200      FFF6F3F8 
+ 200      FFF6F3
+ 201 0992 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 201      F8FFF6F3 
+GAS LISTING /tmp/ccvPZOGL.s 			page 13
+
+
+ 201      F8FFF6F3 
+ 201      F8FFF6
+ 202 09a1 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 202      F3F8FFF6 
+ 202      F3F8FFF6 
+ 202      F3F8FF
+ 203 09b0 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 203      F6F3F8FF 
+ 203      F6F3F8FF 
+ 203      F6F3F8
+ 204 09bf FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 204      FFF6F3F8 
+ 204      FFF6F3F8 
+ 204      FFF6F3
+ 205 09ce F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 205      F8FFF6F3 
+ 205      F8FFF6F3 
+ 205      F8FFF6
+ 206 09dd F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 206      F3F8FFF6 
+ 206      F3F8FFF6 
+ 206      F3F8FF
+ 207 09ec F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 207      F6F3F8FF 
+ 207      F6F3F8FF 
+ 207      F6F3F8
+ 208 09fb FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 208      FFF6F3F8 
+ 208      FFF6F3F8 
+ 208      FFF6F3
+ 209 0a0a F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 209      F8FFF6F3 
+ 209      F8FFF6F3 
+ 209      F8FFF6
+ 210 0a19 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 210      F3F8FFF6 
+ 210      F3F8FFF6 
+ 210      F3F8FF
+ 211 0a28 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 211      F6F3F8FF 
+ 211      F6F3F8FF 
+ 211      F6F3F8
+ 212 0a37 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 212      FFF6F3F8 
+ 212      FFF6F3F8 
+ 212      FFF6F3
+ 213 0a46 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 213      F8FFF6F3 
+ 213      F8FFF6F3 
+ 213      F8FFF6
+ 214 0a55 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 214      F3F8FFF6 
+ 214      F3F8FFF6 
+ 214      F3F8FF
+ 215 0a64 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 215      F6F3F8FF 
+ 215      F6F3F8FF 
+GAS LISTING /tmp/ccvPZOGL.s 			page 14
+
+
+ 215      F6F3F8
+ 216 0a73 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 216      FFF6F3F8 
+ 216      FFF6F3F8 
+ 216      FFF6F3
+ 217 0a82 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 217      F8FFF6F3 
+ 217      F8FFF6F3 
+ 217      F8FFF6
+ 218 0a91 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 218      F3F8FFF6 
+ 218      F3F8FFF6 
+ 218      F3F8FF
+ 219 0aa0 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 219      F6F3F8FF 
+ 219      F6F3F8FF 
+ 219      F6F3F8
+ 220 0aaf FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 220      FFF6F3F8 
+ 220      FFF6F3F8 
+ 220      FFF6F3
+ 221 0abe F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 221      F8FFF6F3 
+ 221      F8FFF6F3 
+ 221      F8FFF6
+ 222 0acd F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 222      F3F8FFF6 
+ 222      F3F8FFF6 
+ 222      F3F8FF
+ 223 0adc F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 223      F6F3F8FF 
+ 223      F6F3F8FF 
+ 223      F6F3F8
+ 224 0aeb FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 224      FFF6F3F8 
+ 224      FFF6F3F8 
+ 224      FFF6F3
+ 225 0afa F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 225      F8FFF6F3 
+ 225      F8FFF6F3 
+ 225      F8FFF6
+ 226 0b09 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 226      F3F8FFF6 
+ 226      F3F8FFF6 
+ 226      F3F8FF
+ 227 0b18 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 227      F6F3F8FF 
+ 227      F6F3F8FF 
+ 227      F6F3F8
+ 228 0b27 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 228      FFF6F3F8 
+ 228      FFF6F3F8 
+ 228      FFF6F3
+ 229 0b36 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 229      F8FFF6F3 
+ 229      F8FFF6F3 
+ 229      F8FFF6
+GAS LISTING /tmp/ccvPZOGL.s 			page 15
+
+
+ 230 0b45 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 230      F3F8FFF6 
+ 230      F3F8FFF6 
+ 230      F3F8FF
+ 231 0b54 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 231      F6F3F8FF 
+ 231      F6F3F8FF 
+ 231      F6F3F8
+ 232 0b63 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 232      FFF6F3F8 
+ 232      FFF6F3F8 
+ 232      FFF6F3
+ 233 0b72 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 233      F8FFF6F3 
+ 233      F8FFF6F3 
+ 233      F8FFF6
+ 234 0b81 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 234      F3F8FFF6 
+ 234      F3F8FFF6 
+ 234      F3F8FF
+ 235 0b90 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 235      F6F3F8FF 
+ 235      F6F3F8FF 
+ 235      F6F3F8
+ 236 0b9f FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 236      FFF6F3F8 
+ 236      FFF6F3F8 
+ 236      FFF6F3
+ 237 0bae F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 237      F8FFF6F3 
+ 237      F8FFF6F3 
+ 237      F8FFF6
+ 238 0bbd F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 238      F3F8FFF6 
+ 238      F3F8FFF6 
+ 238      F3F8FF
+ 239 0bcc F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 239      F6F3F8FF 
+ 239      F6F3F8FF 
+ 239      F6F3F8
+ 240 0bdb FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 240      FFF6F3F8 
+ 240      FFF6F3F8 
+ 240      FFF6F3
+ 241 0bea F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 241      F8FFF6F3 
+ 241      F8FFF6F3 
+ 241      F8FFF6
+ 242 0bf9 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 242      F3F8FFF6 
+ 242      F3F8FFF6 
+ 242      F3F8FF
+ 243 0c08 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 243      F6F3F8FF 
+ 243      F6F3F8FF 
+ 243      F6F3F8
+ 244 0c17 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+GAS LISTING /tmp/ccvPZOGL.s 			page 16
+
+
+ 244      FFF6F3F8 
+ 244      FFF6F3F8 
+ 244      FFF6F3
+ 245 0c26 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 245      F8FFF6F3 
+ 245      F8FFF6F3 
+ 245      F8FFF6
+ 246 0c35 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 246      F3F8FFF6 
+ 246      F3F8FFF6 
+ 246      F3F8FF
+ 247 0c44 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 247      F6F3F8FF 
+ 247      F6F3F8FF 
+ 247      F6F3F8
+ 248 0c53 FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 248      FFF6F3F8 
+ 248      FFF6F3F8 
+ 248      FFF6F3
+ 249 0c62 F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 249      F8FFF6F3 
+ 249      F8FFF6F3 
+ 249      F8FFF6
+ 250 0c71 F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 250      F3F8FFF6 
+ 250      F3F8FFF6 
+ 250      F3F8FF
+ 251 0c80 F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 251      F6F3F8FF 
+ 251      F6F3F8FF 
+ 251      F6F3F8
+ 252 0c8f FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 252      FFF6F3F8 
+ 252      FFF6F3F8 
+ 252      FFF6F3
+ 253 0c9e F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377\366\363\370\377\366"
+ 253      F8FFF6F3 
+ 253      F8FFF6F3 
+ 253      F8FFF6
+ 254 0cad F3F8FFF6 		.ascii	"\363\370\377\366\363\370\377\366\363\370\377\366\363\370\377"
+ 254      F3F8FFF6 
+ 254      F3F8FFF6 
+ 254      F3F8FF
+ 255 0cbc F6F3F8FF 		.ascii	"\366\363\370\377\366\363\370\377\366\363\370\377\366\363\370"
+ 255      F6F3F8FF 
+ 255      F6F3F8FF 
+ 255      F6F3F8
+ 256 0ccb FFF6F3F8 		.ascii	"\377\366\363\370\377\366\364\370\377\366\364\370\377\366\364"
+ 256      FFF6F4F8 
+ 256      FFF6F4F8 
+ 256      FFF6F4
+ 257 0cda F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+ 257      F8FFF6F4 
+ 257      F8FFF6F4 
+ 257      F8FFF6
+ 258 0ce9 F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 258      F4F8FFF6 
+GAS LISTING /tmp/ccvPZOGL.s 			page 17
+
+
+ 258      F4F8FFF6 
+ 258      F4F8FF
+ 259 0cf8 F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 259      F6F4F8FF 
+ 259      F6F4F8FF 
+ 259      F6F4F8
+ 260 0d07 FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 260      FFF6F4F8 
+ 260      FFF6F4F8 
+ 260      FFF6F4
+ 261 0d16 F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+ 261      F8FFF6F4 
+ 261      F8FFF6F4 
+ 261      F8FFF6
+ 262 0d25 F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 262      F4F8FFF6 
+ 262      F4F8FFF6 
+ 262      F4F8FF
+ 263 0d34 F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 263      F6F4F8FF 
+ 263      F6F4F8FF 
+ 263      F6F4F8
+ 264 0d43 FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 264      FFF6F4F8 
+ 264      FFF6F4F8 
+ 264      FFF6F4
+ 265 0d52 F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+ 265      F8FFF6F4 
+ 265      F8FFF6F4 
+ 265      F8FFF6
+ 266 0d61 F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 266      F4F8FFF6 
+ 266      F4F8FFF6 
+ 266      F4F8FF
+ 267 0d70 F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 267      F6F4F8FF 
+ 267      F6F4F8FF 
+ 267      F6F4F8
+ 268 0d7f FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 268      FFF6F4F8 
+ 268      FFF6F4F8 
+ 268      FFF6F4
+ 269 0d8e F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+ 269      F8FFF6F4 
+ 269      F8FFF6F4 
+ 269      F8FFF6
+ 270 0d9d F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 270      F4F8FFF6 
+ 270      F4F8FFF6 
+ 270      F4F8FF
+ 271 0dac F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 271      F6F4F8FF 
+ 271      F6F4F8FF 
+ 271      F6F4F8
+ 272 0dbb FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 272      FFF6F4F8 
+ 272      FFF6F4F8 
+GAS LISTING /tmp/ccvPZOGL.s 			page 18
+
+
+ 272      FFF6F4
+ 273 0dca F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+ 273      F8FFF6F4 
+ 273      F8FFF6F4 
+ 273      F8FFF6
+ 274 0dd9 F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 274      F4F8FFF6 
+ 274      F4F8FFF6 
+ 274      F4F8FF
+ 275 0de8 F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 275      F6F4F8FF 
+ 275      F6F4F8FF 
+ 275      F6F4F8
+ 276 0df7 FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 276      FFF6F4F8 
+ 276      FFF6F4F8 
+ 276      FFF6F4
+ 277 0e06 F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+ 277      F8FFF6F4 
+ 277      F8FFF6F4 
+ 277      F8FFF6
+ 278 0e15 F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 278      F4F8FFF6 
+ 278      F4F8FFF6 
+ 278      F4F8FF
+ 279 0e24 F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 279      F6F4F8FF 
+ 279      F6F4F8FF 
+ 279      F6F4F8
+ 280 0e33 FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 280      FFF6F4F8 
+ 280      FFF6F4F8 
+ 280      FFF6F4
+ 281 0e42 F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+ 281      F8FFF6F4 
+ 281      F8FFF6F4 
+ 281      F8FFF6
+ 282 0e51 F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 282      F4F8FFF6 
+ 282      F4F8FFF6 
+ 282      F4F8FF
+ 283 0e60 F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 283      F6F4F8FF 
+ 283      F6F4F8FF 
+ 283      F6F4F8
+ 284 0e6f FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 284      FFF6F4F8 
+ 284      FFF6F4F8 
+ 284      FFF6F4
+ 285 0e7e F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+ 285      F8FFF6F4 
+ 285      F8FFF6F4 
+ 285      F8FFF6
+ 286 0e8d F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 286      F4F8FFF6 
+ 286      F4F8FFF6 
+ 286      F4F8FF
+GAS LISTING /tmp/ccvPZOGL.s 			page 19
+
+
+ 287 0e9c F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 287      F6F4F8FF 
+ 287      F6F4F8FF 
+ 287      F6F4F8
+ 288 0eab FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 288      FFF6F4F8 
+ 288      FFF6F4F8 
+ 288      FFF6F4
+ 289 0eba F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+ 289      F8FFF6F4 
+ 289      F8FFF6F4 
+ 289      F8FFF6
+ 290 0ec9 F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 290      F4F8FFF6 
+ 290      F4F8FFF6 
+ 290      F4F8FF
+ 291 0ed8 F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 291      F6F4F8FF 
+ 291      F6F4F8FF 
+ 291      F6F4F8
+ 292 0ee7 FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 292      FFF6F4F8 
+ 292      FFF6F4F8 
+ 292      FFF6F4
+ 293 0ef6 F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+ 293      F8FFF6F4 
+ 293      F8FFF6F4 
+ 293      F8FFF6
+ 294 0f05 F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 294      F4F8FFF6 
+ 294      F4F8FFF6 
+ 294      F4F8FF
+ 295 0f14 F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 295      F6F4F8FF 
+ 295      F6F4F8FF 
+ 295      F6F4F8
+ 296 0f23 FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 296      FFF6F4F8 
+ 296      FFF6F4F8 
+ 296      FFF6F4
+ 297 0f32 F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+ 297      F8FFF6F4 
+ 297      F8FFF6F4 
+ 297      F8FFF6
+ 298 0f41 F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 298      F4F8FFF6 
+ 298      F4F8FFF6 
+ 298      F4F8FF
+ 299 0f50 F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 299      F6F4F8FF 
+ 299      F6F4F8FF 
+ 299      F6F4F8
+ 300 0f5f FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 300      FFF6F4F8 
+ 300      FFF6F4F8 
+ 300      FFF6F4
+ 301 0f6e F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+GAS LISTING /tmp/ccvPZOGL.s 			page 20
+
+
+ 301      F8FFF6F4 
+ 301      F8FFF6F4 
+ 301      F8FFF6
+ 302 0f7d F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 302      F4F8FFF6 
+ 302      F4F8FFF6 
+ 302      F4F8FF
+ 303 0f8c F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 303      F6F4F8FF 
+ 303      F6F4F8FF 
+ 303      F6F4F8
+ 304 0f9b FFF6F4F8 		.ascii	"\377\366\364\370\377"
+ 304      FF
+ 305 0fa0 F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 305      F6F4F8FF 
+ 305      F6F4F8FF 
+ 305      F6F4F8
+ 306 0faf FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 306      FFF6F4F8 
+ 306      FFF6F4F8 
+ 306      FFF6F4
+ 307 0fbe F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377\366\364\370\377\366"
+ 307      F8FFF6F4 
+ 307      F8FFF6F4 
+ 307      F8FFF6
+ 308 0fcd F4F8FFF6 		.ascii	"\364\370\377\366\364\370\377\366\364\370\377\366\364\370\377"
+ 308      F4F8FFF6 
+ 308      F4F8FFF6 
+ 308      F4F8FF
+ 309 0fdc F6F4F8FF 		.ascii	"\366\364\370\377\366\364\370\377\366\364\370\377\366\364\370"
+ 309      F6F4F8FF 
+ 309      F6F4F8FF 
+ 309      F6F4F8
+ 310 0feb FFF6F4F8 		.ascii	"\377\366\364\370\377\366\364\370\377\366\364\370\377\366\364"
+ 310      FFF6F4F8 
+ 310      FFF6F4F8 
+ 310      FFF6F4
+ 311 0ffa F8FFF6F4 		.ascii	"\370\377\366\364\370\377\366\364\370\377"
+ 311      F8FFF6F4 
+ 311      F8FF
+ 312              		.globl	heatmap_cs_PuRd_mixed
+ 313              		.section	.data.rel.local
+ 314              		.align 8
+ 315              		.type	heatmap_cs_PuRd_mixed, @object
+ 316              		.size	heatmap_cs_PuRd_mixed, 8
+ 317              	heatmap_cs_PuRd_mixed:
+ 318 0008 00000000 		.quad	mixed
+ 318      00000000 
+ 319              		.section	.data.rel.ro.local
+ 320              		.align 16
+ 321              		.type	mixed, @object
+ 322              		.size	mixed, 16
+ 323              	mixed:
+ 324 0010 00000000 		.quad	mixed_data
+ 324      00000000 
+ 325 0018 01040000 		.quad	1025
+ 325      00000000 
+GAS LISTING /tmp/ccvPZOGL.s 			page 21
+
+
+ 326              		.section	.rodata
+ 327 1004 00000000 		.align 32
+ 327      00000000 
+ 327      00000000 
+ 327      00000000 
+ 327      00000000 
+ 328              		.type	mixed_data, @object
+ 329              		.size	mixed_data, 4100
+ 330              	mixed_data:
+ 331 1020 00       		.string	""
+ 332 1021 00       		.string	""
+ 333 1022 00       		.string	""
+ 334 1023 00       		.string	""
+ 335 1024 6600     		.string	"f"
+ 336 1026 1E00     		.string	"\036"
+ 337 1028 6700     		.string	"g"
+ 338 102a 1F076700 		.string	"\037\007g"
+ 339 102e 1F0E6700 		.string	"\037\016g"
+ 340 1032 1F166800 		.string	"\037\026h"
+ 341 1036 1F1D6800 		.string	"\037\035h"
+ 342 103a 1F256800 		.string	"\037%h"
+ 343 103e 202C6900 		.string	" ,i"
+ 344 1042 20346900 		.string	" 4i"
+ 345 1046 203B6900 		.string	" ;i"
+ 346 104a 20436A00 		.string	" Cj"
+ 347 104e 204A6A00 		.string	" Jj"
+ 348 1052 21526A00 		.string	"!Rj"
+ 349 1056 21596A00 		.string	"!Yj"
+ 350 105a 21616B00 		.string	"!ak"
+ 351 105e 21686B00 		.string	"!hk"
+ 352 1062 21706B00 		.string	"!pk"
+ 353 1066 22776C00 		.string	"\"wl"
+ 354 106a 227F6C00 		.string	"\"\177l"
+ 355 106e 22866C00 		.string	"\"\206l"
+ 356 1072 228D6D00 		.string	"\"\215m"
+ 357 1076 22956D00 		.string	"\"\225m"
+ 358 107a 239C6D00 		.string	"#\234m"
+ 359 107e 23A46D00 		.string	"#\244m"
+ 360 1082 23AB6E00 		.string	"#\253n"
+ 361 1086 23B36E00 		.string	"#\263n"
+ 362 108a 23BA6E00 		.string	"#\272n"
+ 363 108e 24C26F00 		.string	"$\302o"
+ 364 1092 24C96F00 		.string	"$\311o"
+ 365 1096 24D16F00 		.string	"$\321o"
+ 366 109a 24D87000 		.string	"$\330p"
+ 367 109e 24E07000 		.string	"$\340p"
+ 368 10a2 25E77000 		.string	"%\347p"
+ 369 10a6 25EF7100 		.string	"%\357q"
+ 370 10aa 25F67100 		.string	"%\366q"
+ 371 10ae 25FE7100 		.string	"%\376q"
+ 372 10b2 26FF7100 		.string	"&\377q"
+ 373 10b6 26FF7200 		.string	"&\377r"
+ 374 10ba 26FF7200 		.string	"&\377r"
+ 375 10be 26FF7200 		.string	"&\377r"
+ 376 10c2 26FF7300 		.string	"&\377s"
+ 377 10c6 27FF7300 		.string	"'\377s"
+ 378 10ca 27FF7300 		.string	"'\377s"
+GAS LISTING /tmp/ccvPZOGL.s 			page 22
+
+
+ 379 10ce 27FF7400 		.string	"'\377t"
+ 380 10d2 27FF7400 		.string	"'\377t"
+ 381 10d6 27FF7400 		.string	"'\377t"
+ 382 10da 28FF7400 		.string	"(\377t"
+ 383 10de 28FF7500 		.string	"(\377u"
+ 384 10e2 28FF7500 		.string	"(\377u"
+ 385 10e6 28FF7500 		.string	"(\377u"
+ 386 10ea 28FF7600 		.string	"(\377v"
+ 387 10ee 29FF7600 		.string	")\377v"
+ 388 10f2 29FF7600 		.string	")\377v"
+ 389 10f6 29FF7700 		.string	")\377w"
+ 390 10fa 29FF7700 		.string	")\377w"
+ 391 10fe 2AFF7700 		.string	"*\377w"
+ 392 1102 2AFF7800 		.string	"*\377x"
+ 393 1106 2AFF7800 		.string	"*\377x"
+ 394 110a 2AFF7800 		.string	"*\377x"
+ 395 110e 2AFF7800 		.string	"*\377x"
+ 396 1112 2BFF7900 		.string	"+\377y"
+ 397 1116 2BFF7900 		.string	"+\377y"
+ 398 111a 2BFF7900 		.string	"+\377y"
+ 399 111e 2BFF7A00 		.string	"+\377z"
+ 400 1122 2CFF8400 		.string	",\377\204"
+ 401 1126 33FF8400 		.string	"3\377\204"
+ 402 112a 33FF8400 		.string	"3\377\204"
+ 403 112e 33FF8500 		.string	"3\377\205"
+ 404 1132 34FF8500 		.string	"4\377\205"
+ 405 1136 34FF8500 		.string	"4\377\205"
+ 406 113a 34FF8600 		.string	"4\377\206"
+ 407 113e 34FF8600 		.string	"4\377\206"
+ 408 1142 35FF8600 		.string	"5\377\206"
+ 409 1146 35FF8700 		.string	"5\377\207"
+ 410 114a 35FF8700 		.string	"5\377\207"
+ 411 114e 35FF8700 		.string	"5\377\207"
+ 412 1152 36FF8700 		.string	"6\377\207"
+ 413 1156 36FF8800 		.string	"6\377\210"
+ 414 115a 36FF8800 		.string	"6\377\210"
+ 415 115e 36FF8800 		.string	"6\377\210"
+ 416 1162 36FF8900 		.string	"6\377\211"
+ 417 1166 37FF8900 		.string	"7\377\211"
+ 418 116a 37FF8900 		.string	"7\377\211"
+ 419 116e 37FF8A00 		.string	"7\377\212"
+ 420 1172 37FF8A00 		.string	"7\377\212"
+ 421 1176 38FF8A00 		.string	"8\377\212"
+ 422 117a 38FF8B00 		.string	"8\377\213"
+ 423 117e 38FF8B00 		.string	"8\377\213"
+ 424 1182 38FF8B00 		.string	"8\377\213"
+ 425 1186 39FF8B00 		.string	"9\377\213"
+ 426 118a 39FF8C00 		.string	"9\377\214"
+ 427 118e 39FF8C00 		.string	"9\377\214"
+ 428 1192 39FF8C00 		.string	"9\377\214"
+ 429 1196 3AFF8D00 		.string	":\377\215"
+ 430 119a 3AFF8D00 		.string	":\377\215"
+ 431 119e 3AFF8D00 		.string	":\377\215"
+ 432 11a2 3AFF8E00 		.string	":\377\216"
+ 433 11a6 3AFF8E00 		.string	":\377\216"
+ 434 11aa 3BFF8E00 		.string	";\377\216"
+ 435 11ae 3BFF8F00 		.string	";\377\217"
+GAS LISTING /tmp/ccvPZOGL.s 			page 23
+
+
+ 436 11b2 3BFF8F00 		.string	";\377\217"
+ 437 11b6 3BFF8F00 		.string	";\377\217"
+ 438 11ba 3CFF9000 		.string	"<\377\220"
+ 439 11be 3CFF9000 		.string	"<\377\220"
+ 440 11c2 3CFF9000 		.string	"<\377\220"
+ 441 11c6 3CFF9000 		.string	"<\377\220"
+ 442 11ca 3DFF9100 		.string	"=\377\221"
+ 443 11ce 3DFF9100 		.string	"=\377\221"
+ 444 11d2 3DFF9100 		.string	"=\377\221"
+ 445 11d6 3DFF9200 		.string	"=\377\222"
+ 446 11da 3EFF9200 		.string	">\377\222"
+ 447 11de 3EFF9200 		.string	">\377\222"
+ 448 11e2 3EFF9300 		.string	">\377\223"
+ 449 11e6 3EFF9300 		.string	">\377\223"
+ 450 11ea 3FFF9300 		.string	"?\377\223"
+ 451 11ee 3FFF9400 		.string	"?\377\224"
+ 452 11f2 3FFF9400 		.string	"?\377\224"
+ 453 11f6 3FFF9400 		.string	"?\377\224"
+ 454 11fa 40FF9400 		.string	"@\377\224"
+ 455 11fe 40FF9500 		.string	"@\377\225"
+ 456 1202 40FF9500 		.string	"@\377\225"
+ 457 1206 40FF9500 		.string	"@\377\225"
+ 458 120a 41FF9600 		.string	"A\377\226"
+ 459 120e 41FF9600 		.string	"A\377\226"
+ 460 1212 41FF9600 		.string	"A\377\226"
+ 461 1216 41FF9700 		.string	"A\377\227"
+ 462 121a 42FF9700 		.string	"B\377\227"
+ 463 121e 42FF9700 		.string	"B\377\227"
+ 464 1222 42FF9700 		.string	"B\377\227"
+ 465 1226 42FF9800 		.string	"B\377\230"
+ 466 122a 43FF9800 		.string	"C\377\230"
+ 467 122e 43FF9800 		.string	"C\377\230"
+ 468 1232 43FF9900 		.string	"C\377\231"
+ 469 1236 43FF9900 		.string	"C\377\231"
+ 470 123a 43FF9900 		.string	"C\377\231"
+ 471 123e 43FF9A00 		.string	"C\377\232"
+ 472 1242 43FF9A00 		.string	"C\377\232"
+ 473 1246 44FF9A00 		.string	"D\377\232"
+ 474 124a 44FF9B00 		.string	"D\377\233"
+ 475 124e 44FF9B00 		.string	"D\377\233"
+ 476 1252 44FF9B00 		.string	"D\377\233"
+ 477 1256 44FF9C00 		.string	"D\377\234"
+ 478 125a 44FF9C01 		.ascii	"D\377\234\001D\377\234\001D\377\235\001E\377\235\001E\377\235"
+ 478      44FF9C01 
+ 478      44FF9D01 
+ 478      45FF9D01 
+ 478      45FF9D
+ 479 126d 0145FF9E 		.ascii	"\001E\377\236\001E\377\236\001E\377\236\001E\377\237\001E\377"
+ 479      0145FF9E 
+ 479      0145FF9E 
+ 479      0145FF9F 
+ 479      0145FF
+ 480 1280 9F0145FF 		.ascii	"\237\001E\377\237\001E\377\240\001F\377\240\002F\377\240\002"
+ 480      9F0145FF 
+ 480      A00146FF 
+ 480      A00246FF 
+ 480      A002
+GAS LISTING /tmp/ccvPZOGL.s 			page 24
+
+
+ 481 1292 46FFA102 		.ascii	"F\377\241\002F\377\241\002F\377\241\002F\377\242\002F\377\242"
+ 481      46FFA102 
+ 481      46FFA102 
+ 481      46FFA202 
+ 481      46FFA2
+ 482 12a5 0246FFA2 		.ascii	"\002F\377\242\002G\377\243\002G\377\243\002G\377\243\002G\377"
+ 482      0247FFA3 
+ 482      0247FFA3 
+ 482      0247FFA3 
+ 482      0247FF
+ 483 12b8 A40347FF 		.ascii	"\244\003G\377\244\003G\377\244\003G\377\245\003G\377\245\003"
+ 483      A40347FF 
+ 483      A40347FF 
+ 483      A50347FF 
+ 483      A503
+ 484 12ca 48FFA503 		.ascii	"H\377\245\003H\377\246\003H\377\246\003H\377\246\003H\377\247"
+ 484      48FFA603 
+ 484      48FFA603 
+ 484      48FFA603 
+ 484      48FFA7
+ 485 12dd 0348FFA7 		.ascii	"\003H\377\247\004H\377\247\004H\377\250\004I\377\250\004I\377"
+ 485      0448FFA7 
+ 485      0448FFA8 
+ 485      0449FFA8 
+ 485      0449FF
+ 486 12f0 A80449FF 		.ascii	"\250\004I\377\251\004I\377\251\004I\377\251\004I\377\252\004"
+ 486      A90449FF 
+ 486      A90449FF 
+ 486      A90449FF 
+ 486      AA04
+ 487 1302 49FFAA05 		.ascii	"I\377\252\005I\377\252\005J\377\253\005J\377\253\005J\377\253"
+ 487      49FFAA05 
+ 487      4AFFAB05 
+ 487      4AFFAB05 
+ 487      4AFFAB
+ 488 1315 054AFFAC 		.ascii	"\005J\377\254\005J\377\254\005J\377\255\005J\377\270\tN\377\270"
+ 488      054AFFAC 
+ 488      054AFFAD 
+ 488      054AFFB8 
+ 488      094EFFB8 
+ 489 1329 094EFFB8 		.ascii	"\tN\377\270\tN\377\271\nN\377\271\nO\377\271\nO\377\272\nO\377"
+ 489      094EFFB9 
+ 489      0A4EFFB9 
+ 489      0A4FFFB9 
+ 489      0A4FFFBA 
+ 490 1340 BA0A4FFF 		.ascii	"\272\nO\377\272\nO\377\273\nO\377\273\nO\377\273\013O\377\274"
+ 490      BA0A4FFF 
+ 490      BB0A4FFF 
+ 490      BB0A4FFF 
+ 490      BB0B4FFF 
+ 491 1355 0B50FFBC 		.ascii	"\013P\377\274\013P\377\274\013P\377\275\013P\377\275\013P\377"
+ 491      0B50FFBC 
+ 491      0B50FFBD 
+ 491      0B50FFBD 
+ 491      0B50FF
+ 492 1368 BD0B50FF 		.ascii	"\275\013P\377\276\013P\377\276\fP\377\276\fP\377\277\fQ\377\277"
+ 492      BE0B50FF 
+GAS LISTING /tmp/ccvPZOGL.s 			page 25
+
+
+ 492      BE0C50FF 
+ 492      BE0C50FF 
+ 492      BF0C51FF 
+ 493 137d 0C51FFBF 		.ascii	"\fQ\377\277\fQ\377\300\fQ\377\300\fQ\377\300\rQ\377\301\rQ\377"
+ 493      0C51FFC0 
+ 493      0C51FFC0 
+ 493      0C51FFC0 
+ 493      0D51FFC1 
+ 494 1394 C10D51FF 		.ascii	"\301\rQ\377\301\rR\377\302\rR\377\302\rR\377\303\rR\377\303\r"
+ 494      C10D52FF 
+ 494      C20D52FF 
+ 494      C20D52FF 
+ 494      C30D52FF 
+ 495 13aa 52FFC30E 		.ascii	"R\377\303\016R\377\304\016R\377\304\016R\377\304\016R\377\305"
+ 495      52FFC40E 
+ 495      52FFC40E 
+ 495      52FFC40E 
+ 495      52FFC5
+ 496 13bd 0E53FFC5 		.ascii	"\016S\377\305\016S\377\305\016S\377\306\017S\377\306\017S\377"
+ 496      0E53FFC5 
+ 496      0E53FFC6 
+ 496      0F53FFC6 
+ 496      0F53FF
+ 497 13d0 C60F53FF 		.ascii	"\306\017S\377\307\017S\377\307\017S\377\307\017S\377\310\017"
+ 497      C70F53FF 
+ 497      C70F53FF 
+ 497      C70F53FF 
+ 497      C80F
+ 498 13e2 54FFC80F 		.ascii	"T\377\310\017T\377\310\020T\377\311\020T\377\311\020T\377\311"
+ 498      54FFC810 
+ 498      54FFC910 
+ 498      54FFC910 
+ 498      54FFC9
+ 499 13f5 1054FFCA 		.ascii	"\020T\377\312\020T\377\312\020T\377\312\020T\377\313\020U\377"
+ 499      1054FFCA 
+ 499      1054FFCA 
+ 499      1054FFCB 
+ 499      1055FF
+ 500 1408 CB1155FF 		.ascii	"\313\021U\377\313\021U\377\314\021U\377\314\021U\377\314\021"
+ 500      CB1155FF 
+ 500      CC1155FF 
+ 500      CC1155FF 
+ 500      CC11
+ 501 141a 55FFCD11 		.ascii	"U\377\315\021U\377\315\021U\377\315\022U\377\316\022V\377\316"
+ 501      55FFCD11 
+ 501      55FFCD12 
+ 501      55FFCE12 
+ 501      56FFCE
+ 502 142d 1256FFCE 		.ascii	"\022V\377\316\022V\377\316\022W\377\316\022W\377\317\022W\377"
+ 502      1256FFCE 
+ 502      1257FFCE 
+ 502      1257FFCF 
+ 502      1257FF
+ 503 1440 CF1258FF 		.ascii	"\317\022X\377\317\022X\377\317\022X\377\317\022Y\377\320\022"
+ 503      CF1258FF 
+ 503      CF1258FF 
+ 503      CF1259FF 
+GAS LISTING /tmp/ccvPZOGL.s 			page 26
+
+
+ 503      D012
+ 504 1452 59FFD013 		.ascii	"Y\377\320\023Y\377\320\023Y\377\320\023Z\377\320\023Z\377\320"
+ 504      59FFD013 
+ 504      59FFD013 
+ 504      5AFFD013 
+ 504      5AFFD0
+ 505 1465 135AFFD1 		.ascii	"\023Z\377\321\023[\377\321\023[\377\321\023[\377\321\023\\\377"
+ 505      135BFFD1 
+ 505      135BFFD1 
+ 505      135BFFD1 
+ 505      135CFF
+ 506 1478 D1135CFF 		.ascii	"\321\023\\\377\322\024\\\377\322\024]\377\322\024]\377\322\024"
+ 506      D2145CFF 
+ 506      D2145DFF 
+ 506      D2145DFF 
+ 506      D214
+ 507 148a 5DFFD214 		.ascii	"]\377\322\024]\377\322\024^\377\323\024^\377\323\024^\377\323"
+ 507      5DFFD214 
+ 507      5EFFD314 
+ 507      5EFFD314 
+ 507      5EFFD3
+ 508 149d 145FFFD3 		.ascii	"\024_\377\323\025_\377\323\025_\377\323\025`\377\324\025`\377"
+ 508      155FFFD3 
+ 508      155FFFD3 
+ 508      1560FFD4 
+ 508      1560FF
+ 509 14b0 D41560FF 		.ascii	"\324\025`\377\324\025a\377\324\025a\377\324\025a\377\324\025"
+ 509      D41561FF 
+ 509      D41561FF 
+ 509      D41561FF 
+ 509      D415
+ 510 14c2 62FFD516 		.ascii	"b\377\325\026b\377\325\026b\377\325\026b\377\325\026c\377\325"
+ 510      62FFD516 
+ 510      62FFD516 
+ 510      62FFD516 
+ 510      63FFD5
+ 511 14d5 1663FFD5 		.ascii	"\026c\377\325\026c\377\326\026d\377\326\027d\377\326\027d\377"
+ 511      1663FFD6 
+ 511      1664FFD6 
+ 511      1764FFD6 
+ 511      1764FF
+ 512 14e8 D61765FF 		.ascii	"\326\027e\377\326\027e\377\326\027e\377\327\027f\377\327\027"
+ 512      D61765FF 
+ 512      D61765FF 
+ 512      D71766FF 
+ 512      D717
+ 513 14fa 66FFD717 		.ascii	"f\377\327\027f\377\327\030g\377\327\030g\377\327\030g\377\330"
+ 513      66FFD718 
+ 513      67FFD718 
+ 513      67FFD718 
+ 513      67FFD8
+ 514 150d 1868FFD8 		.ascii	"\030h\377\330\030h\377\330\030h\377\330\030i\377\330\031i\377"
+ 514      1868FFD8 
+ 514      1868FFD8 
+ 514      1869FFD8 
+ 514      1969FF
+ 515 1520 D81969FF 		.ascii	"\330\031i\377\336\036t\377\336\036t\377\336\036u\377\336\036"
+GAS LISTING /tmp/ccvPZOGL.s 			page 27
+
+
+ 515      DE1E74FF 
+ 515      DE1E74FF 
+ 515      DE1E75FF 
+ 515      DE1E
+ 516 1532 75FFDE1E 		.ascii	"u\377\336\036u\377\336\036v\377\336\036v\377\337\037v\377\337"
+ 516      75FFDE1E 
+ 516      76FFDE1E 
+ 516      76FFDF1F 
+ 516      76FFDF
+ 517 1545 1F77FFDF 		.ascii	"\037w\377\337\037w\377\337\037w\377\337\037x\377\337\037x\377"
+ 517      1F77FFDF 
+ 517      1F77FFDF 
+ 517      1F78FFDF 
+ 517      1F78FF
+ 518 1558 E02078FF 		.ascii	"\340 x\377\340 y\377\340 y\377\340 y\377\340 z\377\340 z\377"
+ 518      E02079FF 
+ 518      E02079FF 
+ 518      E02079FF 
+ 518      E0207AFF 
+ 519 1570 E0217AFF 		.ascii	"\340!z\377\341!{\377\341!{\377\341!{\377\341!|\377\341!|\377"
+ 519      E1217BFF 
+ 519      E1217BFF 
+ 519      E1217BFF 
+ 519      E1217CFF 
+ 520 1588 E1227CFF 		.ascii	"\341\"|\377\341\"}\377\342\"}\377\342\"}\377\342\"~\377\342\""
+ 520      E1227DFF 
+ 520      E2227DFF 
+ 520      E2227DFF 
+ 520      E2227EFF 
+ 521 159e 7EFFE223 		.ascii	"~\377\342#~\377\342#\177\377\342#\177\377\343#\177\377\343#\200"
+ 521      7EFFE223 
+ 521      7FFFE223 
+ 521      7FFFE323 
+ 521      7FFFE323 
+ 522 15b3 FFE32380 		.ascii	"\377\343#\200\377\343$\200\377\343$\201\377\343$\201\377\343"
+ 522      FFE32480 
+ 522      FFE32481 
+ 522      FFE32481 
+ 522      FFE3
+ 523 15c5 2481FFE4 		.ascii	"$\201\377\344$\202\377\344$\202\377\344%\202\377\344%\203\377"
+ 523      2482FFE4 
+ 523      2482FFE4 
+ 523      2582FFE4 
+ 523      2583FF
+ 524 15d8 E42583FF 		.ascii	"\344%\203\377\344%\203\377\344%\204\377\344&\204\377\345&\204"
+ 524      E42583FF 
+ 524      E42584FF 
+ 524      E42684FF 
+ 524      E52684
+ 525 15eb FFE52685 		.ascii	"\377\345&\205\377\345&\205\377\345&\205\377\345&\206\377\345"
+ 525      FFE52685 
+ 525      FFE52685 
+ 525      FFE52686 
+ 525      FFE5
+ 526 15fd 2786FFE5 		.ascii	"'\206\377\345'\206\377\346'\207\377\346'\207\377\346'\207\377"
+ 526      2786FFE6 
+ 526      2787FFE6 
+GAS LISTING /tmp/ccvPZOGL.s 			page 28
+
+
+ 526      2787FFE6 
+ 526      2787FF
+ 527 1610 E62888FF 		.ascii	"\346(\210\377\346(\210\377\346(\210\377\346(\211\377\346(\211"
+ 527      E62888FF 
+ 527      E62888FF 
+ 527      E62889FF 
+ 527      E62889
+ 528 1623 FFE62989 		.ascii	"\377\346)\211\377\346)\212\377\346*\212\377\346*\212\377\346"
+ 528      FFE6298A 
+ 528      FFE62A8A 
+ 528      FFE62A8A 
+ 528      FFE6
+ 529 1635 2B8BFFE6 		.ascii	"+\213\377\346+\213\377\346,\213\377\346,\213\377\346-\214\377"
+ 529      2B8BFFE6 
+ 529      2C8BFFE6 
+ 529      2C8BFFE6 
+ 529      2D8CFF
+ 530 1648 E62D8CFF 		.ascii	"\346-\214\377\346.\214\377\346.\214\377\346/\215\377\3460\215"
+ 530      E62E8CFF 
+ 530      E62E8CFF 
+ 530      E62F8DFF 
+ 530      E6308D
+ 531 165b FFE6308D 		.ascii	"\377\3460\215\377\3460\216\377\3461\216\377\3461\216\377\346"
+ 531      FFE6308E 
+ 531      FFE6318E 
+ 531      FFE6318E 
+ 531      FFE6
+ 532 166d 328EFFE6 		.ascii	"2\216\377\3462\217\377\3463\217\377\3463\217\377\3464\217\377"
+ 532      328FFFE6 
+ 532      338FFFE6 
+ 532      338FFFE6 
+ 532      348FFF
+ 533 1680 E63490FF 		.ascii	"\3464\220\377\3465\220\377\3465\220\377\3466\220\377\3466\221"
+ 533      E63590FF 
+ 533      E63590FF 
+ 533      E63690FF 
+ 533      E63691
+ 534 1693 FFE53691 		.ascii	"\377\3456\221\377\3457\221\377\3457\221\377\3458\222\377\345"
+ 534      FFE53791 
+ 534      FFE53791 
+ 534      FFE53892 
+ 534      FFE5
+ 535 16a5 3892FFE5 		.ascii	"8\222\377\3459\222\377\3459\222\377\3459\223\377\345:\223\377"
+ 535      3992FFE5 
+ 535      3992FFE5 
+ 535      3993FFE5 
+ 535      3A93FF
+ 536 16b8 E53A93FF 		.ascii	"\345:\223\377\345;\223\377\345;\224\377\345;\224\377\345<\224"
+ 536      E53B93FF 
+ 536      E53B94FF 
+ 536      E53B94FF 
+ 536      E53C94
+ 537 16cb FFE53C94 		.ascii	"\377\345<\224\377\345=\225\377\345=\225\377\345=\225\377\345"
+ 537      FFE53D95 
+ 537      FFE53D95 
+ 537      FFE53D95 
+ 537      FFE5
+GAS LISTING /tmp/ccvPZOGL.s 			page 29
+
+
+ 538 16dd 3E95FFE5 		.ascii	">\225\377\345>\226\377\345?\226\377\345?\226\377\344?\226\377"
+ 538      3E96FFE5 
+ 538      3F96FFE5 
+ 538      3F96FFE4 
+ 538      3F96FF
+ 539 16f0 E44097FF 		.ascii	"\344@\227\377\344@\227\377\344@\227\377\344A\227\377\344A\230"
+ 539      E44097FF 
+ 539      E44097FF 
+ 539      E44197FF 
+ 539      E44198
+ 540 1703 FFE44298 		.ascii	"\377\344B\230\377\344B\230\377\344B\230\377\344C\231\377\344"
+ 540      FFE44298 
+ 540      FFE44298 
+ 540      FFE44399 
+ 540      FFE4
+ 541 1715 4399FFE4 		.ascii	"C\231\377\344C\231\377\344D\231\377\344D\232\377\342P\241\377"
+ 541      4399FFE4 
+ 541      4499FFE4 
+ 541      449AFFE2 
+ 541      50A1FF
+ 542 1728 E251A2FF 		.ascii	"\342Q\242\377\342Q\242\377\342Q\242\377\342R\242\377\342R\243"
+ 542      E251A2FF 
+ 542      E251A2FF 
+ 542      E252A2FF 
+ 542      E252A3
+ 543 173b FFE252A3 		.ascii	"\377\342R\243\377\342S\243\377\342S\243\377\342T\244\377\342"
+ 543      FFE253A3 
+ 543      FFE253A3 
+ 543      FFE254A4 
+ 543      FFE2
+ 544 174d 54A4FFE2 		.ascii	"T\244\377\342T\244\377\342U\244\377\342U\244\377\341U\245\377"
+ 544      54A4FFE2 
+ 544      55A4FFE2 
+ 544      55A4FFE1 
+ 544      55A5FF
+ 545 1760 E156A5FF 		.ascii	"\341V\245\377\341V\245\377\341V\245\377\341V\246\377\341W\246"
+ 545      E156A5FF 
+ 545      E156A5FF 
+ 545      E156A6FF 
+ 545      E157A6
+ 546 1773 FFE157A6 		.ascii	"\377\341W\246\377\341W\246\377\341X\246\377\341X\247\377\341"
+ 546      FFE157A6 
+ 546      FFE158A6 
+ 546      FFE158A7 
+ 546      FFE1
+ 547 1785 58A7FFE1 		.ascii	"X\247\377\341Y\247\377\341Y\247\377\341Y\250\377\341Z\250\377"
+ 547      59A7FFE1 
+ 547      59A7FFE1 
+ 547      59A8FFE1 
+ 547      5AA8FF
+ 548 1798 E15AA8FF 		.ascii	"\341Z\250\377\341Z\250\377\340[\251\377\340[\251\377\340[\251"
+ 548      E15AA8FF 
+ 548      E05BA9FF 
+ 548      E05BA9FF 
+ 548      E05BA9
+ 549 17ab FFE05CA9 		.ascii	"\377\340\\\251\377\340\\\251\377\340\\\252\377\340]\252\377\340"
+ 549      FFE05CA9 
+GAS LISTING /tmp/ccvPZOGL.s 			page 30
+
+
+ 549      FFE05CAA 
+ 549      FFE05DAA 
+ 549      FFE0
+ 550 17bd 5DAAFFE0 		.ascii	"]\252\377\340]\252\377\340]\252\377\340^\253\377\340^\253\377"
+ 550      5DAAFFE0 
+ 550      5DAAFFE0 
+ 550      5EABFFE0 
+ 550      5EABFF
+ 551 17d0 E05EABFF 		.ascii	"\340^\253\377\340_\253\377\340_\254\377\340_\254\377\340`\254"
+ 551      E05FABFF 
+ 551      E05FACFF 
+ 551      E05FACFF 
+ 551      E060AC
+ 552 17e3 FFDF60AC 		.ascii	"\377\337`\254\377\337`\254\377\337`\255\377"
+ 552      FFDF60AC 
+ 552      FFDF60AD 
+ 552      FF
+ 553 17f0 DF61ADFF 		.ascii	"\337a\255\377\337a\255\377\337a\255\377\337b\255\377\337b\256"
+ 553      DF61ADFF 
+ 553      DF61ADFF 
+ 553      DF62ADFF 
+ 553      DF62AE
+ 554 1803 FFDF62AE 		.ascii	"\377\337b\256\377\337b\256\377\337c\256\377\337c\256\377\337"
+ 554      FFDF62AE 
+ 554      FFDF63AE 
+ 554      FFDF63AE 
+ 554      FFDF
+ 555 1815 63AFFFDF 		.ascii	"c\257\377\337d\257\377\337d\257\377\337d\257\377\336e\257\377"
+ 555      64AFFFDF 
+ 555      64AFFFDF 
+ 555      64AFFFDE 
+ 555      65AFFF
+ 556 1828 DE65B0FF 		.ascii	"\336e\260\377\336e\260\377\336f\260\377\336f\260\377\336f\261"
+ 556      DE65B0FF 
+ 556      DE66B0FF 
+ 556      DE66B0FF 
+ 556      DE66B1
+ 557 183b FFDE67B1 		.ascii	"\377\336g\261\377\335g\261\377\335g\261\377\335h\261\377\335"
+ 557      FFDD67B1 
+ 557      FFDD67B1 
+ 557      FFDD68B1 
+ 557      FFDD
+ 558 184d 68B2FFDD 		.ascii	"h\262\377\335h\262\377\335i\262\377\335i\262\377\334i\262\377"
+ 558      68B2FFDD 
+ 558      69B2FFDD 
+ 558      69B2FFDC 
+ 558      69B2FF
+ 559 1860 DC6AB3FF 		.ascii	"\334j\263\377\334j\263\377\334j\263\377\334k\263\377\334k\263"
+ 559      DC6AB3FF 
+ 559      DC6AB3FF 
+ 559      DC6BB3FF 
+ 559      DC6BB3
+ 560 1873 FFDC6BB4 		.ascii	"\377\334k\264\377\333l\264\377\333l\264\377\333l\264\377\333"
+ 560      FFDB6CB4 
+ 560      FFDB6CB4 
+ 560      FFDB6CB4 
+ 560      FFDB
+GAS LISTING /tmp/ccvPZOGL.s 			page 31
+
+
+ 561 1885 6DB4FFDB 		.ascii	"m\264\377\333m\265\377\333m\265\377\333n\265\377\332n\265\377"
+ 561      6DB5FFDB 
+ 561      6DB5FFDB 
+ 561      6EB5FFDA 
+ 561      6EB5FF
+ 562 1898 DA6EB5FF 		.ascii	"\332n\265\377\332o\266\377\332o\266\377\332o\266\377\332p\266"
+ 562      DA6FB6FF 
+ 562      DA6FB6FF 
+ 562      DA6FB6FF 
+ 562      DA70B6
+ 563 18ab FFDA70B6 		.ascii	"\377\332p\266\377\331p\266\377\331p\267\377\331q\267\377\331"
+ 563      FFD970B6 
+ 563      FFD970B7 
+ 563      FFD971B7 
+ 563      FFD9
+ 564 18bd 71B7FFD9 		.ascii	"q\267\377\331q\267\377\331r\267\377\330r\267\377\330r\270\377"
+ 564      71B7FFD9 
+ 564      72B7FFD8 
+ 564      72B7FFD8 
+ 564      72B8FF
+ 565 18d0 D873B8FF 		.ascii	"\330s\270\377\330s\270\377\330s\270\377\330t\270\377\330t\270"
+ 565      D873B8FF 
+ 565      D873B8FF 
+ 565      D874B8FF 
+ 565      D874B8
+ 566 18e3 FFD774B9 		.ascii	"\377\327t\271\377\327t\271\377\327u\271\377\327u\271\377\327"
+ 566      FFD774B9 
+ 566      FFD775B9 
+ 566      FFD775B9 
+ 566      FFD7
+ 567 18f5 75B9FFD7 		.ascii	"u\271\377\327v\271\377\327v\272\377\326v\272\377\326w\272\377"
+ 567      76B9FFD7 
+ 567      76BAFFD6 
+ 567      76BAFFD6 
+ 567      77BAFF
+ 568 1908 D677BAFF 		.ascii	"\326w\272\377\326w\272\377\326w\272\377\326x\273\377\326x\273"
+ 568      D677BAFF 
+ 568      D677BAFF 
+ 568      D678BBFF 
+ 568      D678BB
+ 569 191b FFD578BB 		.ascii	"\377\325x\273\377\325y\273\377\321\202\300\377\321\203\300\377"
+ 569      FFD579BB 
+ 569      FFD182C0 
+ 569      FFD183C0 
+ 569      FF
+ 570 192c D083C0FF 		.ascii	"\320\203\300\377\320\203\300\377\320\203\300\377\320\204\300"
+ 570      D083C0FF 
+ 570      D083C0FF 
+ 570      D084C0
+ 571 193b FFD084C1 		.ascii	"\377\320\204\301\377\320\204\301\377\320\205\301\377\320\205"
+ 571      FFD084C1 
+ 571      FFD085C1 
+ 571      FFD085
+ 572 194a C1FFCF85 		.ascii	"\301\377\317\205\301\377\317\205\301\377\317\206\301\377\317"
+ 572      C1FFCF85 
+ 572      C1FFCF86 
+ 572      C1FFCF
+GAS LISTING /tmp/ccvPZOGL.s 			page 32
+
+
+ 573 1959 86C1FFCF 		.ascii	"\206\301\377\317\206\302\377\317\207\302\377\317\207\302\377"
+ 573      86C2FFCF 
+ 573      87C2FFCF 
+ 573      87C2FF
+ 574 1968 CE87C2FF 		.ascii	"\316\207\302\377\316\207\302\377\316\210\302\377\316\210\302"
+ 574      CE87C2FF 
+ 574      CE88C2FF 
+ 574      CE88C2
+ 575 1977 FFCE88C2 		.ascii	"\377\316\210\302\377\316\211\303\377\316\211\303\377\315\211"
+ 575      FFCE89C3 
+ 575      FFCE89C3 
+ 575      FFCD89
+ 576 1986 C3FFCD89 		.ascii	"\303\377\315\211\303\377\315\212\303\377\315\212\303\377\315"
+ 576      C3FFCD8A 
+ 576      C3FFCD8A 
+ 576      C3FFCD
+ 577 1995 8AC3FFCD 		.ascii	"\212\303\377\315\212\303\377\315\213\303\377\315\213\304\377"
+ 577      8AC3FFCD 
+ 577      8BC3FFCD 
+ 577      8BC4FF
+ 578 19a4 CC8BC4FF 		.ascii	"\314\213\304\377\314\213\304\377\314\214\304\377\314\214\304"
+ 578      CC8BC4FF 
+ 578      CC8CC4FF 
+ 578      CC8CC4
+ 579 19b3 FFCC8CC4 		.ascii	"\377\314\214\304\377\314\215\304\377\314\215\304\377\314\215"
+ 579      FFCC8DC4 
+ 579      FFCC8DC4 
+ 579      FFCC8D
+ 580 19c2 C4FFCB8D 		.ascii	"\304\377\313\215\305\377\313\216\305\377\313\216\305\377\313"
+ 580      C5FFCB8E 
+ 580      C5FFCB8E 
+ 580      C5FFCB
+ 581 19d1 8EC5FFCB 		.ascii	"\216\305\377\313\216\305\377\313\217\305\377\313\217\305\377"
+ 581      8EC5FFCB 
+ 581      8FC5FFCB 
+ 581      8FC5FF
+ 582 19e0 CB8FC5FF 		.ascii	"\313\217\305\377\312\217\305\377\312\220\305\377\312\220\305"
+ 582      CA8FC5FF 
+ 582      CA90C5FF 
+ 582      CA90C5
+ 583 19ef FFCA90C6 		.ascii	"\377\312\220\306\377\312\220\306\377\312\221\306\377\312\221"
+ 583      FFCA90C6 
+ 583      FFCA91C6 
+ 583      FFCA91
+ 584 19fe C6FFCA91 		.ascii	"\306\377\312\221\306\377\311\221\306\377\311\222\306\377\311"
+ 584      C6FFC991 
+ 584      C6FFC992 
+ 584      C6FFC9
+ 585 1a0d 92C6FFC9 		.ascii	"\222\306\377\311\222\306\377\311\222\306\377\311\223\306\377"
+ 585      92C6FFC9 
+ 585      92C6FFC9 
+ 585      93C6FF
+ 586 1a1c C993C6FF 		.ascii	"\311\223\306\377\311\223\306\377\310\224\306\377\311\224\307"
+ 586      C993C6FF 
+ 586      C894C6FF 
+ 586      C994C7
+ 587 1a2b FFC994C7 		.ascii	"\377\311\224\307\377\311\224\307\377\311\224\307\377\311\225"
+GAS LISTING /tmp/ccvPZOGL.s 			page 33
+
+
+ 587      FFC994C7 
+ 587      FFC994C7 
+ 587      FFC995
+ 588 1a3a C7FFC995 		.ascii	"\307\377\311\225\307\377\311\225\307\377\311\225\310\377\311"
+ 588      C7FFC995 
+ 588      C7FFC995 
+ 588      C8FFC9
+ 589 1a49 96C8FFC9 		.ascii	"\226\310\377\311\226\310\377\311\226\310\377\311\226\310\377"
+ 589      96C8FFC9 
+ 589      96C8FFC9 
+ 589      96C8FF
+ 590 1a58 C997C8FF 		.ascii	"\311\227\310\377\311\227\310\377\311\227\310\377\311\227\311"
+ 590      C997C8FF 
+ 590      C997C8FF 
+ 590      C997C9
+ 591 1a67 FFCA98C9 		.ascii	"\377\312\230\311\377\312\230\311\377\312\230\311\377\312\230"
+ 591      FFCA98C9 
+ 591      FFCA98C9 
+ 591      FFCA98
+ 592 1a76 C9FFCA98 		.ascii	"\311\377\312\230\311\377\312\231\311\377\312\231\312\377\312"
+ 592      C9FFCA99 
+ 592      C9FFCA99 
+ 592      CAFFCA
+ 593 1a85 99CAFFCA 		.ascii	"\231\312\377\312\231\312\377\312\232\312\377\312\232\312\377"
+ 593      99CAFFCA 
+ 593      9ACAFFCA 
+ 593      9ACAFF
+ 594 1a94 CA9ACAFF 		.ascii	"\312\232\312\377\312\232\312\377\312\233\312\377\312\233\313"
+ 594      CA9ACAFF 
+ 594      CA9BCAFF 
+ 594      CA9BCB
+ 595 1aa3 FFCA9BCB 		.ascii	"\377\312\233\313\377\312\233\313\377\313\233\313\377\313\234"
+ 595      FFCA9BCB 
+ 595      FFCB9BCB 
+ 595      FFCB9C
+ 596 1ab2 CBFFCB9C 		.ascii	"\313\377\313\234\313\377\313\234\313\377\313\234\313\377\313"
+ 596      CBFFCB9C 
+ 596      CBFFCB9C 
+ 596      CBFFCB
+ 597 1ac1 9DCCFFCB 		.ascii	"\235\314\377\313\235\314\377\313\235\314\377\313\235\314\377"
+ 597      9DCCFFCB 
+ 597      9DCCFFCB 
+ 597      9DCCFF
+ 598 1ad0 CB9ECCFF 		.ascii	"\313\236\314\377\313\236\314\377\313\236\314\377\313\236\314"
+ 598      CB9ECCFF 
+ 598      CB9ECCFF 
+ 598      CB9ECC
+ 599 1adf FFCB9FCD 		.ascii	"\377\313\237\315\377\313\237\315\377\314\237\315\377\314\237"
+ 599      FFCB9FCD 
+ 599      FFCC9FCD 
+ 599      FFCC9F
+ 600 1aee CDFFCC9F 		.ascii	"\315\377\314\237\315\377\314\240\315\377\314\240\315\377\314"
+ 600      CDFFCCA0 
+ 600      CDFFCCA0 
+ 600      CDFFCC
+ 601 1afd A0CDFFCC 		.ascii	"\240\315\377\314\240\316\377\314\241\316\377\314\241\316\377"
+ 601      A0CEFFCC 
+GAS LISTING /tmp/ccvPZOGL.s 			page 34
+
+
+ 601      A1CEFFCC 
+ 601      A1CEFF
+ 602 1b0c CCA1CEFF 		.ascii	"\314\241\316\377\314\241\316\377\314\242\316\377\314\242\316"
+ 602      CCA1CEFF 
+ 602      CCA2CEFF 
+ 602      CCA2CE
+ 603 1b1b FFCCA2CE 		.ascii	"\377\314\242\316\377\314\242\316\377\317\252\322\377\317\252"
+ 603      FFCCA2CE 
+ 603      FFCFAAD2 
+ 603      FFCFAA
+ 604 1b2a D3FFCFAA 		.ascii	"\323\377\317\252\323\377\317\253\323\377\317\253\323\377\317"
+ 604      D3FFCFAB 
+ 604      D3FFCFAB 
+ 604      D3FFCF
+ 605 1b39 ABD3FFCF 		.ascii	"\253\323\377\317\253\323\377\317\253\323\377\317\254\323\377"
+ 605      ABD3FFCF 
+ 605      ABD3FFCF 
+ 605      ACD3FF
+ 606 1b48 CFACD3FF 		.ascii	"\317\254\323\377\317\254\324\377\317\254\324\377\320\255\324"
+ 606      CFACD4FF 
+ 606      CFACD4FF 
+ 606      D0ADD4
+ 607 1b57 FFD0ADD4 		.ascii	"\377\320\255\324\377\320\255\324\377\320\255\324\377\320\256"
+ 607      FFD0ADD4 
+ 607      FFD0ADD4 
+ 607      FFD0AE
+ 608 1b66 D4FFD0AE 		.ascii	"\324\377\320\256\324\377\320\256\324\377\320\256\325\377\320"
+ 608      D4FFD0AE 
+ 608      D4FFD0AE 
+ 608      D5FFD0
+ 609 1b75 AED5FFD0 		.ascii	"\256\325\377\320\257\325\377\320\257\325\377\320\257\325\377"
+ 609      AFD5FFD0 
+ 609      AFD5FFD0 
+ 609      AFD5FF
+ 610 1b84 D0AFD5FF 		.ascii	"\320\257\325\377\320\260\325\377\321\260\325\377\321\260\326"
+ 610      D0B0D5FF 
+ 610      D1B0D5FF 
+ 610      D1B0D6
+ 611 1b93 FFD1B0D6 		.ascii	"\377\321\260\326\377\321\261\326\377\321\261\326\377\321\261"
+ 611      FFD1B1D6 
+ 611      FFD1B1D6 
+ 611      FFD1B1
+ 612 1ba2 D6FFD1B1 		.ascii	"\326\377\321\261\326\377\321\261\326\377\321\262\326\377\321"
+ 612      D6FFD1B1 
+ 612      D6FFD1B2 
+ 612      D6FFD1
+ 613 1bb1 B2D6FFD1 		.ascii	"\262\326\377\321\262\327\377\321\262\327\377\321\263\327\377"
+ 613      B2D7FFD1 
+ 613      B2D7FFD1 
+ 613      B3D7FF
+ 614 1bc0 D2B3D7FF 		.ascii	"\322\263\327\377\322\263\327\377\322\263\327\377\322\264\327"
+ 614      D2B3D7FF 
+ 614      D2B3D7FF 
+ 614      D2B4D7
+ 615 1bcf FFD2B4D7 		.ascii	"\377\322\264\327\377\322\264\327\377\322\264\327\377\322\264"
+ 615      FFD2B4D7 
+ 615      FFD2B4D7 
+GAS LISTING /tmp/ccvPZOGL.s 			page 35
+
+
+ 615      FFD2B4
+ 616 1bde D8FFD2B5 		.ascii	"\330\377\322\265\330\377\322\265\330\377\322\265\330\377\322"
+ 616      D8FFD2B5 
+ 616      D8FFD2B5 
+ 616      D8FFD2
+ 617 1bed B5D8FFD2 		.ascii	"\265\330\377\322\266\330\377\323\266\330\377\323\266\330\377"
+ 617      B6D8FFD3 
+ 617      B6D8FFD3 
+ 617      B6D8FF
+ 618 1bfc D3B6D8FF 		.ascii	"\323\266\330\377\323\266\331\377\323\267\331\377\323\267\331"
+ 618      D3B6D9FF 
+ 618      D3B7D9FF 
+ 618      D3B7D9
+ 619 1c0b FFD3B7D9 		.ascii	"\377\323\267\331\377\323\267\331\377\323\270\331\377\323\270"
+ 619      FFD3B7D9 
+ 619      FFD3B8D9 
+ 619      FFD3B8
+ 620 1c1a D9FFD3B8 		.ascii	"\331\377\323\270\331\377\323\270\331\377\323\271\331\377\324"
+ 620      D9FFD3B8 
+ 620      D9FFD3B9 
+ 620      D9FFD4
+ 621 1c29 B9DAFFD4 		.ascii	"\271\332\377\324\271\332\377\324\271\332\377\324\272\332\377"
+ 621      B9DAFFD4 
+ 621      B9DAFFD4 
+ 621      BADAFF
+ 622 1c38 D4BADAFF 		.ascii	"\324\272\332\377\324\272\332\377\324\272\333\377\324\273\333"
+ 622      D4BADAFF 
+ 622      D4BADBFF 
+ 622      D4BBDB
+ 623 1c47 FFD4BBDB 		.ascii	"\377\324\273\333\377\324\273\333\377\324\273\333\377\325\274"
+ 623      FFD4BBDB 
+ 623      FFD4BBDB 
+ 623      FFD5BC
+ 624 1c56 DBFFD5BC 		.ascii	"\333\377\325\274\334\377\325\274\334\377\325\274\334\377\325"
+ 624      DCFFD5BC 
+ 624      DCFFD5BC 
+ 624      DCFFD5
+ 625 1c65 BDDCFFD5 		.ascii	"\275\334\377\325\275\334\377\325\275\334\377\325\275\334\377"
+ 625      BDDCFFD5 
+ 625      BDDCFFD5 
+ 625      BDDCFF
+ 626 1c74 D5BEDDFF 		.ascii	"\325\276\335\377\325\276\335\377\326\276\335\377\326\276\335"
+ 626      D5BEDDFF 
+ 626      D6BEDDFF 
+ 626      D6BEDD
+ 627 1c83 FFD6BFDD 		.ascii	"\377\326\277\335\377\326\277\335\377\326\277\335\377\326\277"
+ 627      FFD6BFDD 
+ 627      FFD6BFDD 
+ 627      FFD6BF
+ 628 1c92 DEFFD6C0 		.ascii	"\336\377\326\300\336\377\326\300\336\377\326\300\336\377\326"
+ 628      DEFFD6C0 
+ 628      DEFFD6C0 
+ 628      DEFFD6
+ 629 1ca1 C0DEFFD7 		.ascii	"\300\336\377\327\301\336\377\327\301\336\377\327\301\337\377"
+ 629      C1DEFFD7 
+ 629      C1DEFFD7 
+ 629      C1DFFF
+GAS LISTING /tmp/ccvPZOGL.s 			page 36
+
+
+ 630 1cb0 D7C1DFFF 		.ascii	"\327\301\337\377\327\302\337\377\327\302\337\377\327\302\337"
+ 630      D7C2DFFF 
+ 630      D7C2DFFF 
+ 630      D7C2DF
+ 631 1cbf FFD7C2DF 		.ascii	"\377\327\302\337\377\327\303\337\377\327\303\340\377\330\303"
+ 631      FFD7C3DF 
+ 631      FFD7C3E0 
+ 631      FFD8C3
+ 632 1cce E0FFD8C3 		.ascii	"\340\377\330\303\340\377\330\304\340\377\330\304\340\377\330"
+ 632      E0FFD8C4 
+ 632      E0FFD8C4 
+ 632      E0FFD8
+ 633 1cdd C4E0FFD8 		.ascii	"\304\340\377\330\304\340\377\330\305\341\377\330\305\341\377"
+ 633      C4E0FFD8 
+ 633      C5E1FFD8 
+ 633      C5E1FF
+ 634 1cec D8C5E1FF 		.ascii	"\330\305\341\377\331\305\341\377\331\306\341\377\331\306\341"
+ 634      D9C5E1FF 
+ 634      D9C6E1FF 
+ 634      D9C6E1
+ 635 1cfb FFD9C6E1 		.ascii	"\377\331\306\341\377\331\306\342\377\331\307\342\377\331\307"
+ 635      FFD9C6E2 
+ 635      FFD9C7E2 
+ 635      FFD9C7
+ 636 1d0a E2FFD9C7 		.ascii	"\342\377\331\307\342\377\331\307\342\377\332\310\342\377\332"
+ 636      E2FFD9C7 
+ 636      E2FFDAC8 
+ 636      E2FFDA
+ 637 1d19 C8E2FFDA 		.ascii	"\310\342\377\332\310\342\377\332\310\343\377\336\321\347\377"
+ 637      C8E2FFDA 
+ 637      C8E3FFDE 
+ 637      D1E7FF
+ 638 1d28 DED1E7FF 		.ascii	"\336\321\347\377\336\321\347\377\336\321\347\377\336\322\347"
+ 638      DED1E7FF 
+ 638      DED1E7FF 
+ 638      DED2E7
+ 639 1d37 FFDED2E8 		.ascii	"\377\336\322\350\377\337\322\350\377\337\322\350\377\337\323"
+ 639      FFDFD2E8 
+ 639      FFDFD2E8 
+ 639      FFDFD3
+ 640 1d46 E8FFDFD3 		.ascii	"\350\377\337\323\350\377\337\323\350\377\337\323\350\377\337"
+ 640      E8FFDFD3 
+ 640      E8FFDFD3 
+ 640      E8FFDF
+ 641 1d55 D4E8FFDF 		.ascii	"\324\350\377\337\324\351\377\340\324\351\377\340\324\351\377"
+ 641      D4E9FFE0 
+ 641      D4E9FFE0 
+ 641      D4E9FF
+ 642 1d64 E0D5E9FF 		.ascii	"\340\325\351\377\340\325\351\377\340\325\351\377\340\325\351"
+ 642      E0D5E9FF 
+ 642      E0D5E9FF 
+ 642      E0D5E9
+ 643 1d73 FFE0D6E9 		.ascii	"\377\340\326\351\377\340\326\352\377\341\326\352\377\341\326"
+ 643      FFE0D6EA 
+ 643      FFE1D6EA 
+ 643      FFE1D6
+ 644 1d82 EAFFE1D7 		.ascii	"\352\377\341\327\352\377\341\327\352\377\341\327\352\377\341"
+GAS LISTING /tmp/ccvPZOGL.s 			page 37
+
+
+ 644      EAFFE1D7 
+ 644      EAFFE1D7 
+ 644      EAFFE1
+ 645 1d91 D7EAFFE1 		.ascii	"\327\352\377\341\330\352\377\341\330\353\377\342\330\353\377"
+ 645      D8EAFFE1 
+ 645      D8EBFFE2 
+ 645      D8EBFF
+ 646 1da0 E2D8EBFF 		.ascii	"\342\330\353\377\342\331\353\377\342\331\353\377\342\331\353"
+ 646      E2D9EBFF 
+ 646      E2D9EBFF 
+ 646      E2D9EB
+ 647 1daf FFE2D9EB 		.ascii	"\377\342\331\353\377\342\332\353\377\343\332\353\377\343\332"
+ 647      FFE2DAEB 
+ 647      FFE3DAEB 
+ 647      FFE3DA
+ 648 1dbe ECFFE3DA 		.ascii	"\354\377\343\332\354\377\343\333\354\377\343\333\354\377\343"
+ 648      ECFFE3DB 
+ 648      ECFFE3DB 
+ 648      ECFFE3
+ 649 1dcd DBECFFE3 		.ascii	"\333\354\377\343\333\354\377\344\334\354\377\344\334\354\377"
+ 649      DBECFFE4 
+ 649      DCECFFE4 
+ 649      DCECFF
+ 650 1ddc E4DCEDFF 		.ascii	"\344\334\355\377\344\334\355\377\344\335\355\377\344\335\355"
+ 650      E4DCEDFF 
+ 650      E4DDEDFF 
+ 650      E4DDED
+ 651 1deb FFE4DDED 		.ascii	"\377\344\335\355\377\345\335\355\377\345\336\355\377\345\336"
+ 651      FFE5DDED 
+ 651      FFE5DEED 
+ 651      FFE5DE
+ 652 1dfa EDFFE5DE 		.ascii	"\355\377\345\336\355\377\345\336\356\377\345\337\356\377\345"
+ 652      EDFFE5DE 
+ 652      EEFFE5DF 
+ 652      EEFFE5
+ 653 1e09 DFEEFFE6 		.ascii	"\337\356\377\346\337\356\377\346\337\356\377\346\340\356\377"
+ 653      DFEEFFE6 
+ 653      DFEEFFE6 
+ 653      E0EEFF
+ 654 1e18 E6E0EEFF 		.ascii	"\346\340\356\377\346\340\356\377\346\340\356\377\346\341\356"
+ 654      E6E0EEFF 
+ 654      E6E0EEFF 
+ 654      E6E1EE
+ 655 1e27 FFE7E1EF 		.ascii	"\377\347\341\357\377\347\341\357\377\347\341\357\377\347\341"
+ 655      FFE7E1EF 
+ 655      FFE7E1EF 
+ 655      FFE7E1
+ 656 1e36 EFFFE7E1 		.ascii	"\357\377\347\341\357\377\347\341\357\377\347\341\357\377\347"
+ 656      EFFFE7E1 
+ 656      EFFFE7E1 
+ 656      EFFFE7
+ 657 1e45 E1EFFFE7 		.ascii	"\341\357\377\347\342\357\377\350\342\357\377\350\342\357\377"
+ 657      E2EFFFE8 
+ 657      E2EFFFE8 
+ 657      E2EFFF
+ 658 1e54 E8E2EFFF 		.ascii	"\350\342\357\377\350\342\357\377\350\342\357\377\350\342\357"
+ 658      E8E2EFFF 
+GAS LISTING /tmp/ccvPZOGL.s 			page 38
+
+
+ 658      E8E2EFFF 
+ 658      E8E2EF
+ 659 1e63 FFE8E2EF 		.ascii	"\377\350\342\357\377\350\342\360\377\350\343\360\377\351\343"
+ 659      FFE8E2F0 
+ 659      FFE8E3F0 
+ 659      FFE9E3
+ 660 1e72 F0FFE9E3 		.ascii	"\360\377\351\343\360\377\351\343\360\377\351\343\360\377\351"
+ 660      F0FFE9E3 
+ 660      F0FFE9E3 
+ 660      F0FFE9
+ 661 1e81 E3F0FFE9 		.ascii	"\343\360\377\351\343\360\377\351\343\360\377\351\344\360\377"
+ 661      E3F0FFE9 
+ 661      E3F0FFE9 
+ 661      E4F0FF
+ 662 1e90 E9E4F0FF 		.ascii	"\351\344\360\377\351\344\360\377\352\344\360\377\352\344\360"
+ 662      E9E4F0FF 
+ 662      EAE4F0FF 
+ 662      EAE4F0
+ 663 1e9f FFEAE4F0 		.ascii	"\377\352\344\360\377\352\344\360\377\352\344\360\377\352\344"
+ 663      FFEAE4F0 
+ 663      FFEAE4F0 
+ 663      FFEAE4
+ 664 1eae F1FFEAE5 		.ascii	"\361\377\352\345\361\377\352\345\361\377\352\345\361\377\352"
+ 664      F1FFEAE5 
+ 664      F1FFEAE5 
+ 664      F1FFEA
+ 665 1ebd E5F1FFEB 		.ascii	"\345\361\377\353\345\361\377\353\345\361\377\353\345\361\377"
+ 665      E5F1FFEB 
+ 665      E5F1FFEB 
+ 665      E5F1FF
+ 666 1ecc EBE5F1FF 		.ascii	"\353\345\361\377\353\346\361\377\353\346\361\377\353\346\361"
+ 666      EBE6F1FF 
+ 666      EBE6F1FF 
+ 666      EBE6F1
+ 667 1edb FFEBE6F1 		.ascii	"\377\353\346\361\377\353\346\361\377\353\346\361\377\354\346"
+ 667      FFEBE6F1 
+ 667      FFEBE6F1 
+ 667      FFECE6
+ 668 1eea F1FFECE6 		.ascii	"\361\377\354\346\362\377\354\346\362\377\354\347\362\377\354"
+ 668      F2FFECE6 
+ 668      F2FFECE7 
+ 668      F2FFEC
+ 669 1ef9 E7F2FFEC 		.ascii	"\347\362\377\354\347\362\377\354\347\362\377\354\347\362\377"
+ 669      E7F2FFEC 
+ 669      E7F2FFEC 
+ 669      E7F2FF
+ 670 1f08 ECE7F2FF 		.ascii	"\354\347\362\377\355\347\362\377\355\347\362\377\355\350\362"
+ 670      EDE7F2FF 
+ 670      EDE7F2FF 
+ 670      EDE8F2
+ 671 1f17 FFEDE8F2 		.ascii	"\377\355\350\362\377\355\350\362\377\355\350\362\377\360\354"
+ 671      FFEDE8F2 
+ 671      FFEDE8F2 
+ 671      FFF0EC
+ 672 1f26 F4FFF0EC 		.ascii	"\364\377\360\354\364\377\361\354\365\377\361\354\365\377\361"
+ 672      F4FFF1EC 
+ 672      F5FFF1EC 
+GAS LISTING /tmp/ccvPZOGL.s 			page 39
+
+
+ 672      F5FFF1
+ 673 1f35 ECF5FFF1 		.ascii	"\354\365\377\361\354\365\377\361\355\365\377\361\355\365\377"
+ 673      ECF5FFF1 
+ 673      EDF5FFF1 
+ 673      EDF5FF
+ 674 1f44 F1EDF5FF 		.ascii	"\361\355\365\377\361\355\365\377\361\355\365\377\361\355\365"
+ 674      F1EDF5FF 
+ 674      F1EDF5FF 
+ 674      F1EDF5
+ 675 1f53 FFF1EDF5 		.ascii	"\377\361\355\365\377\362\355\365\377\362\355\365\377\362\356"
+ 675      FFF2EDF5 
+ 675      FFF2EDF5 
+ 675      FFF2EE
+ 676 1f62 F5FFF2EE 		.ascii	"\365\377\362\356\365\377\362\356\365\377\362\356\366\377\362"
+ 676      F5FFF2EE 
+ 676      F5FFF2EE 
+ 676      F6FFF2
+ 677 1f71 EEF6FFF2 		.ascii	"\356\366\377\362\356\366\377\362\356\366\377\362\356\366\377"
+ 677      EEF6FFF2 
+ 677      EEF6FFF2 
+ 677      EEF6FF
+ 678 1f80 F3EFF6FF 		.ascii	"\363\357\366\377\363\357\366\377\363\357\366\377\363\357\366"
+ 678      F3EFF6FF 
+ 678      F3EFF6FF 
+ 678      F3EFF6
+ 679 1f8f FFF3EFF6 		.ascii	"\377\363\357\366\377\363\357\366\377\363\357\366\377\363\357"
+ 679      FFF3EFF6 
+ 679      FFF3EFF6 
+ 679      FFF3EF
+ 680 1f9e F6FFF3F0 		.ascii	"\366\377\363\360\366\377\363\360\366\377\364\360\366\377\364"
+ 680      F6FFF3F0 
+ 680      F6FFF4F0 
+ 680      F6FFF4
+ 681 1fad F0F7FFF4 		.ascii	"\360\367\377\364\360\367\377\364\360\367\377\364\360\367\377"
+ 681      F0F7FFF4 
+ 681      F0F7FFF4 
+ 681      F0F7FF
+ 682 1fbc F4F0F7FF 		.ascii	"\364\360\367\377"
+ 683 1fc0 F4F0F7FF 		.ascii	"\364\360\367\377\364\361\367\377\364\361\367\377\364\361\367"
+ 683      F4F1F7FF 
+ 683      F4F1F7FF 
+ 683      F4F1F7
+ 684 1fcf FFF5F1F7 		.ascii	"\377\365\361\367\377\365\361\367\377\365\361\367\377\365\361"
+ 684      FFF5F1F7 
+ 684      FFF5F1F7 
+ 684      FFF5F1
+ 685 1fde F7FFF5F1 		.ascii	"\367\377\365\361\367\377\365\362\367\377\365\362\370\377\365"
+ 685      F7FFF5F2 
+ 685      F7FFF5F2 
+ 685      F8FFF5
+ 686 1fed F2F8FFF5 		.ascii	"\362\370\377\365\362\370\377\365\362\370\377\365\362\370\377"
+ 686      F2F8FFF5 
+ 686      F2F8FFF5 
+ 686      F2F8FF
+ 687 1ffc F6F2F8FF 		.ascii	"\366\362\370\377\366\362\370\377\366\363\370\377\366\363\370"
+ 687      F6F2F8FF 
+ 687      F6F3F8FF 
+GAS LISTING /tmp/ccvPZOGL.s 			page 40
+
+
+ 687      F6F3F8
+ 688 200b FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 688      FFF6F3F8 
+ 688      FFF6F3F8 
+ 688      FFF6F3
+ 689 201a F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377"
+ 689      F8FFF6F3 
+ 689      F8FF
+ 690              		.globl	heatmap_cs_PuRd_soft
+ 691              		.section	.data.rel.local
+ 692              		.align 8
+ 693              		.type	heatmap_cs_PuRd_soft, @object
+ 694              		.size	heatmap_cs_PuRd_soft, 8
+ 695              	heatmap_cs_PuRd_soft:
+ 696 0010 00000000 		.quad	soft
+ 696      00000000 
+ 697              		.section	.data.rel.ro.local
+ 698              		.align 16
+ 699              		.type	soft, @object
+ 700              		.size	soft, 16
+ 701              	soft:
+ 702 0020 00000000 		.quad	soft_data
+ 702      00000000 
+ 703 0028 01040000 		.quad	1025
+ 703      00000000 
+ 704              		.section	.rodata
+ 705 2024 00000000 		.align 32
+ 705      00000000 
+ 705      00000000 
+ 705      00000000 
+ 705      00000000 
+ 706              		.type	soft_data, @object
+ 707              		.size	soft_data, 4100
+ 708              	soft_data:
+ 709 2040 00       		.string	""
+ 710 2041 00       		.string	""
+ 711 2042 00       		.string	""
+ 712 2043 00       		.string	""
+ 713 2044 6600     		.string	"f"
+ 714 2046 1E00     		.string	"\036"
+ 715 2048 6700     		.string	"g"
+ 716 204a 1F076700 		.string	"\037\007g"
+ 717 204e 1F0E6800 		.string	"\037\016h"
+ 718 2052 1F166800 		.string	"\037\026h"
+ 719 2056 1F1D6800 		.string	"\037\035h"
+ 720 205a 20256900 		.string	" %i"
+ 721 205e 202C6900 		.string	" ,i"
+ 722 2062 20346A00 		.string	" 4j"
+ 723 2066 203B6A00 		.string	" ;j"
+ 724 206a 21436A00 		.string	"!Cj"
+ 725 206e 214A6B00 		.string	"!Jk"
+ 726 2072 21526B00 		.string	"!Rk"
+ 727 2076 21596B00 		.string	"!Yk"
+ 728 207a 22616C00 		.string	"\"al"
+ 729 207e 22686C00 		.string	"\"hl"
+ 730 2082 22706D00 		.string	"\"pm"
+ 731 2086 22776D00 		.string	"\"wm"
+GAS LISTING /tmp/ccvPZOGL.s 			page 41
+
+
+ 732 208a 237F6D00 		.string	"#\177m"
+ 733 208e 23866E00 		.string	"#\206n"
+ 734 2092 238D6E00 		.string	"#\215n"
+ 735 2096 23956E00 		.string	"#\225n"
+ 736 209a 249C6F00 		.string	"$\234o"
+ 737 209e 24A46F00 		.string	"$\244o"
+ 738 20a2 24AB7000 		.string	"$\253p"
+ 739 20a6 24B37000 		.string	"$\263p"
+ 740 20aa 25BA7000 		.string	"%\272p"
+ 741 20ae 25C27100 		.string	"%\302q"
+ 742 20b2 25C97100 		.string	"%\311q"
+ 743 20b6 25D17100 		.string	"%\321q"
+ 744 20ba 26D87200 		.string	"&\330r"
+ 745 20be 26E07200 		.string	"&\340r"
+ 746 20c2 26E77300 		.string	"&\347s"
+ 747 20c6 26EF7300 		.string	"&\357s"
+ 748 20ca 27F67300 		.string	"'\366s"
+ 749 20ce 27FE7400 		.string	"'\376t"
+ 750 20d2 27FF7400 		.string	"'\377t"
+ 751 20d6 28FF7500 		.string	"(\377u"
+ 752 20da 28FF7500 		.string	"(\377u"
+ 753 20de 28FF7500 		.string	"(\377u"
+ 754 20e2 28FF7600 		.string	"(\377v"
+ 755 20e6 29FF7600 		.string	")\377v"
+ 756 20ea 29FF7600 		.string	")\377v"
+ 757 20ee 29FF7700 		.string	")\377w"
+ 758 20f2 29FF7700 		.string	")\377w"
+ 759 20f6 2AFF7800 		.string	"*\377x"
+ 760 20fa 2AFF7800 		.string	"*\377x"
+ 761 20fe 2AFF7800 		.string	"*\377x"
+ 762 2102 2AFF7900 		.string	"*\377y"
+ 763 2106 2BFF7900 		.string	"+\377y"
+ 764 210a 2BFF7A00 		.string	"+\377z"
+ 765 210e 2BFF7A00 		.string	"+\377z"
+ 766 2112 2CFF7A00 		.string	",\377z"
+ 767 2116 2CFF7B00 		.string	",\377{"
+ 768 211a 2CFF7B00 		.string	",\377{"
+ 769 211e 2CFF7B00 		.string	",\377{"
+ 770 2122 2DFF7C00 		.string	"-\377|"
+ 771 2126 2DFF7C00 		.string	"-\377|"
+ 772 212a 2DFF7D00 		.string	"-\377}"
+ 773 212e 2DFF7D00 		.string	"-\377}"
+ 774 2132 2EFF7D00 		.string	".\377}"
+ 775 2136 2EFF7E00 		.string	".\377~"
+ 776 213a 2EFF7E00 		.string	".\377~"
+ 777 213e 2FFF7F00 		.string	"/\377\177"
+ 778 2142 2FFF7F00 		.string	"/\377\177"
+ 779 2146 2FFF7F00 		.string	"/\377\177"
+ 780 214a 2FFF8000 		.string	"/\377\200"
+ 781 214e 30FF8000 		.string	"0\377\200"
+ 782 2152 30FF8000 		.string	"0\377\200"
+ 783 2156 30FF8100 		.string	"0\377\201"
+ 784 215a 31FF8100 		.string	"1\377\201"
+ 785 215e 31FF8200 		.string	"1\377\202"
+ 786 2162 31FF8200 		.string	"1\377\202"
+ 787 2166 31FF8200 		.string	"1\377\202"
+ 788 216a 32FF8300 		.string	"2\377\203"
+GAS LISTING /tmp/ccvPZOGL.s 			page 42
+
+
+ 789 216e 32FF8300 		.string	"2\377\203"
+ 790 2172 32FF8300 		.string	"2\377\203"
+ 791 2176 33FF8400 		.string	"3\377\204"
+ 792 217a 33FF8400 		.string	"3\377\204"
+ 793 217e 33FF8500 		.string	"3\377\205"
+ 794 2182 33FF8500 		.string	"3\377\205"
+ 795 2186 34FF8500 		.string	"4\377\205"
+ 796 218a 34FF8600 		.string	"4\377\206"
+ 797 218e 34FF8600 		.string	"4\377\206"
+ 798 2192 35FF8700 		.string	"5\377\207"
+ 799 2196 35FF8700 		.string	"5\377\207"
+ 800 219a 35FF8700 		.string	"5\377\207"
+ 801 219e 35FF8800 		.string	"5\377\210"
+ 802 21a2 36FF8800 		.string	"6\377\210"
+ 803 21a6 36FF8800 		.string	"6\377\210"
+ 804 21aa 36FF8900 		.string	"6\377\211"
+ 805 21ae 37FF8900 		.string	"7\377\211"
+ 806 21b2 37FF8A00 		.string	"7\377\212"
+ 807 21b6 37FF8A00 		.string	"7\377\212"
+ 808 21ba 38FF8A00 		.string	"8\377\212"
+ 809 21be 38FF8B00 		.string	"8\377\213"
+ 810 21c2 38FF8B00 		.string	"8\377\213"
+ 811 21c6 38FF8C00 		.string	"8\377\214"
+ 812 21ca 39FF8C00 		.string	"9\377\214"
+ 813 21ce 39FF8C00 		.string	"9\377\214"
+ 814 21d2 39FF8D00 		.string	"9\377\215"
+ 815 21d6 3AFF8D00 		.string	":\377\215"
+ 816 21da 3AFF8E00 		.string	":\377\216"
+ 817 21de 3AFF8E00 		.string	":\377\216"
+ 818 21e2 3BFF8E00 		.string	";\377\216"
+ 819 21e6 3BFF8F00 		.string	";\377\217"
+ 820 21ea 3BFF8F00 		.string	";\377\217"
+ 821 21ee 3CFF8F00 		.string	"<\377\217"
+ 822 21f2 3CFF9000 		.string	"<\377\220"
+ 823 21f6 3CFF9000 		.string	"<\377\220"
+ 824 21fa 3CFF9100 		.string	"<\377\221"
+ 825 21fe 3DFF9100 		.string	"=\377\221"
+ 826 2202 3DFF9100 		.string	"=\377\221"
+ 827 2206 3DFF9200 		.string	"=\377\222"
+ 828 220a 3EFF9200 		.string	">\377\222"
+ 829 220e 3EFF9300 		.string	">\377\223"
+ 830 2212 3EFF9300 		.string	">\377\223"
+ 831 2216 3FFF9300 		.string	"?\377\223"
+ 832 221a 3FFF9400 		.string	"?\377\224"
+ 833 221e 3FFF9400 		.string	"?\377\224"
+ 834 2222 40FF9400 		.string	"@\377\224"
+ 835 2226 40FF9500 		.string	"@\377\225"
+ 836 222a 40FF9500 		.string	"@\377\225"
+ 837 222e 41FF9600 		.string	"A\377\226"
+ 838 2232 41FF9600 		.string	"A\377\226"
+ 839 2236 41FF9600 		.string	"A\377\226"
+ 840 223a 42FF9700 		.string	"B\377\227"
+ 841 223e 42FF9700 		.string	"B\377\227"
+ 842 2242 42FF9700 		.string	"B\377\227"
+ 843 2246 42FF9800 		.string	"B\377\230"
+ 844 224a 43FF9800 		.string	"C\377\230"
+ 845 224e 43FF9900 		.string	"C\377\231"
+GAS LISTING /tmp/ccvPZOGL.s 			page 43
+
+
+ 846 2252 43FF9900 		.string	"C\377\231"
+ 847 2256 43FF9A00 		.string	"C\377\232"
+ 848 225a 43FF9A00 		.string	"C\377\232"
+ 849 225e 43FF9A00 		.string	"C\377\232"
+ 850 2262 44FF9B00 		.string	"D\377\233"
+ 851 2266 44FF9B00 		.string	"D\377\233"
+ 852 226a 44FF9C00 		.string	"D\377\234"
+ 853 226e 44FF9C01 		.ascii	"D\377\234\001D\377\234\001D\377\235\001E\377\235\001E\377\236"
+ 853      44FF9C01 
+ 853      44FF9D01 
+ 853      45FF9D01 
+ 853      45FF9E
+ 854 2281 0145FF9E 		.ascii	"\001E\377\236\001E\377\237\001E\377\237\001E\377\237\001E\377"
+ 854      0145FF9F 
+ 854      0145FF9F 
+ 854      0145FF9F 
+ 854      0145FF
+ 855 2294 A00146FF 		.ascii	"\240\001F\377\240\002F\377\241\002F\377\241\002F\377\241\002"
+ 855      A00246FF 
+ 855      A10246FF 
+ 855      A10246FF 
+ 855      A102
+ 856 22a6 46FFA202 		.ascii	"F\377\242\002F\377\242\002G\377\243\002G\377\243\002G\377\243"
+ 856      46FFA202 
+ 856      47FFA302 
+ 856      47FFA302 
+ 856      47FFA3
+ 857 22b9 0247FFA4 		.ascii	"\002G\377\244\003G\377\244\003G\377\245\003G\377\245\003H\377"
+ 857      0347FFA4 
+ 857      0347FFA5 
+ 857      0347FFA5 
+ 857      0348FF
+ 858 22cc A60348FF 		.ascii	"\246\003H\377\246\003H\377\246\003H\377\247\003H\377\247\003"
+ 858      A60348FF 
+ 858      A60348FF 
+ 858      A70348FF 
+ 858      A703
+ 859 22de 48FFA804 		.ascii	"H\377\250\004I\377\250\004I\377\251\004I\377\251\004I\377\251"
+ 859      49FFA804 
+ 859      49FFA904 
+ 859      49FFA904 
+ 859      49FFA9
+ 860 22f1 0449FFAA 		.ascii	"\004I\377\252\004I\377\252\004I\377\253\004J\377\253\005J\377"
+ 860      0449FFAA 
+ 860      0449FFAB 
+ 860      044AFFAB 
+ 860      054AFF
+ 861 2304 AB054AFF 		.ascii	"\253\005J\377\254\005J\377\254\005J\377\255\005J\377\255\005"
+ 861      AC054AFF 
+ 861      AC054AFF 
+ 861      AD054AFF 
+ 861      AD05
+ 862 2316 4BFFAE05 		.ascii	"K\377\256\005K\377\256\006K\377\256\006K\377\257\006K\377\257"
+ 862      4BFFAE06 
+ 862      4BFFAE06 
+ 862      4BFFAF06 
+ 862      4BFFAF
+GAS LISTING /tmp/ccvPZOGL.s 			page 44
+
+
+ 863 2329 064BFFB0 		.ascii	"\006K\377\260\006K\377\260\006L\377\260\006L\377\261\007L\377"
+ 863      064BFFB0 
+ 863      064CFFB0 
+ 863      064CFFB1 
+ 863      074CFF
+ 864 233c B1074CFF 		.ascii	"\261\007L\377\262\007L\377\262\007L\377\263\007L\377\263\007"
+ 864      B2074CFF 
+ 864      B2074CFF 
+ 864      B3074CFF 
+ 864      B307
+ 865 234e 4DFFB308 		.ascii	"M\377\263\bM\377\264\bM\377\264\bM\377\265\bM\377\265\bM\377"
+ 865      4DFFB408 
+ 865      4DFFB408 
+ 865      4DFFB508 
+ 865      4DFFB508 
+ 866 2364 B6084DFF 		.ascii	"\266\bM\377\266\bN\377\266\tN\377\267\tN\377\267\tN\377\270\t"
+ 866      B6084EFF 
+ 866      B6094EFF 
+ 866      B7094EFF 
+ 866      B7094EFF 
+ 867 237a 4EFFB809 		.ascii	"N\377\270\tN\377\271\tO\377\271\nO\377\271\nO\377\272\nO\377"
+ 867      4EFFB909 
+ 867      4FFFB90A 
+ 867      4FFFB90A 
+ 867      4FFFBA0A 
+ 868 2390 BA0A4FFF 		.ascii	"\272\nO\377\273\nO\377\273\nO\377\274\013P\377\274\013P\377\274"
+ 868      BB0A4FFF 
+ 868      BB0A4FFF 
+ 868      BC0B50FF 
+ 868      BC0B50FF 
+ 869 23a5 0B50FFBD 		.ascii	"\013P\377\275\013P\377\275\013P\377\276\013P\377\276\fP\377\276"
+ 869      0B50FFBD 
+ 869      0B50FFBE 
+ 869      0B50FFBE 
+ 869      0C50FFBE 
+ 870 23b9 0C51FFBF 		.ascii	"\fQ\377\277\fQ\377\277\fQ\377\300\fQ\377\300\fQ\377\301\rQ\377"
+ 870      0C51FFBF 
+ 870      0C51FFC0 
+ 870      0C51FFC0 
+ 870      0C51FFC1 
+ 871 23d0 C10D51FF 		.ascii	"\301\rQ\377\301\rR\377\302\rR\377\302\rR\377\303\rR\377\303\016"
+ 871      C10D52FF 
+ 871      C20D52FF 
+ 871      C20D52FF 
+ 871      C30D52FF 
+ 872 23e6 52FFC40E 		.ascii	"R\377\304\016R\377\304\016R\377\304\016S\377\305\016S\377\305"
+ 872      52FFC40E 
+ 872      52FFC40E 
+ 872      53FFC50E 
+ 872      53FFC5
+ 873 23f9 0E53FFC6 		.ascii	"\016S\377\306\017S\377\306\017S\377\307\017S\377\307\017S\377"
+ 873      0F53FFC6 
+ 873      0F53FFC7 
+ 873      0F53FFC7 
+ 873      0F53FF
+ 874 240c C70F54FF 		.ascii	"\307\017T\377\310\017T\377\310\020T\377\311\020T\377\311\020"
+ 874      C80F54FF 
+GAS LISTING /tmp/ccvPZOGL.s 			page 45
+
+
+ 874      C81054FF 
+ 874      C91054FF 
+ 874      C910
+ 875 241e 54FFCA10 		.ascii	"T\377\312\020T\377\312\020T\377\312\020U\377\313\021U\377\313"
+ 875      54FFCA10 
+ 875      54FFCA10 
+ 875      55FFCB11 
+ 875      55FFCB
+ 876 2431 1155FFCC 		.ascii	"\021U\377\314\021U\377\314\021U\377\315\021U\377\315\021U\377"
+ 876      1155FFCC 
+ 876      1155FFCD 
+ 876      1155FFCD 
+ 876      1155FF
+ 877 2444 CD1255FF 		.ascii	"\315\022U\377\316\022V\377\316\022V\377\316\022W\377\316\022"
+ 877      CE1256FF 
+ 877      CE1256FF 
+ 877      CE1257FF 
+ 877      CE12
+ 878 2456 57FFCF12 		.ascii	"W\377\317\022W\377\317\022X\377\317\022X\377\317\022Y\377\320"
+ 878      57FFCF12 
+ 878      58FFCF12 
+ 878      58FFCF12 
+ 878      59FFD0
+ 879 2469 1259FFD0 		.ascii	"\022Y\377\320\023Y\377\320\023Z\377\320\023Z\377\320\023Z\377"
+ 879      1359FFD0 
+ 879      135AFFD0 
+ 879      135AFFD0 
+ 879      135AFF
+ 880 247c D1135BFF 		.ascii	"\321\023[\377\321\023[\377\321\023\\\377\321\023\\\377\322\024"
+ 880      D1135BFF 
+ 880      D1135CFF 
+ 880      D1135CFF 
+ 880      D214
+ 881 248e 5CFFD214 		.ascii	"\\\377\322\024]\377\322\024]\377\322\024]\377\323\024^\377\323"
+ 881      5DFFD214 
+ 881      5DFFD214 
+ 881      5DFFD314 
+ 881      5EFFD3
+ 882 24a1 145EFFD3 		.ascii	"\024^\377\323\024_\377\323\024_\377\323\025_\377\324\025`\377"
+ 882      145FFFD3 
+ 882      145FFFD3 
+ 882      155FFFD4 
+ 882      1560FF
+ 883 24b4 D41560FF 		.ascii	"\324\025`\377\324\025a\377\324\025a\377\324\025a\377\325\025"
+ 883      D41561FF 
+ 883      D41561FF 
+ 883      D41561FF 
+ 883      D515
+ 884 24c6 62FFD516 		.ascii	"b\377\325\026b\377\325\026c\377\325\026c\377\326\026c\377\326"
+ 884      62FFD516 
+ 884      63FFD516 
+ 884      63FFD616 
+ 884      63FFD6
+ 885 24d9 1664FFD6 		.ascii	"\026d\377\326\026d\377\326\026e\377\326\027e\377\327\027e\377"
+ 885      1664FFD6 
+ 885      1665FFD6 
+ 885      1765FFD7 
+GAS LISTING /tmp/ccvPZOGL.s 			page 46
+
+
+ 885      1765FF
+ 886 24ec D71766FF 		.ascii	"\327\027f\377\327\027f\377\327\027f\377\327\027g\377\330\030"
+ 886      D71766FF 
+ 886      D71766FF 
+ 886      D71767FF 
+ 886      D818
+ 887 24fe 67FFD818 		.ascii	"g\377\330\030h\377\330\030h\377\330\030h\377\330\030i\377\331"
+ 887      68FFD818 
+ 887      68FFD818 
+ 887      68FFD818 
+ 887      69FFD9
+ 888 2511 1869FFD9 		.ascii	"\030i\377\331\031j\377\331\031j\377\331\031j\377\332\031k\377"
+ 888      196AFFD9 
+ 888      196AFFD9 
+ 888      196AFFDA 
+ 888      196BFF
+ 889 2524 DA196BFF 		.ascii	"\332\031k\377\332\032l\377\332\032l\377\332\032m\377\333\032"
+ 889      DA1A6CFF 
+ 889      DA1A6CFF 
+ 889      DA1A6DFF 
+ 889      DB1A
+ 890 2536 6DFFDB1A 		.ascii	"m\377\333\032m\377\333\032n\377\333\033n\377\333\033o\377\334"
+ 890      6DFFDB1A 
+ 890      6EFFDB1B 
+ 890      6EFFDB1B 
+ 890      6FFFDC
+ 891 2549 1B6FFFDC 		.ascii	"\033o\377\334\033o\377\334\033p\377\334\034p\377\334\034q\377"
+ 891      1B6FFFDC 
+ 891      1B70FFDC 
+ 891      1C70FFDC 
+ 891      1C71FF
+ 892 255c DC1C71FF 		.ascii	"\334\034q\377\335\034q\377\335\034r\377\335\035r\377\335\035"
+ 892      DD1C71FF 
+ 892      DD1C72FF 
+ 892      DD1D72FF 
+ 892      DD1D
+ 893 256e 73FFDD1D 		.ascii	"s\377\335\035s\377\336\035s\377\336\035t\377\336\035t\377\336"
+ 893      73FFDE1D 
+ 893      73FFDE1D 
+ 893      74FFDE1D 
+ 893      74FFDE
+ 894 2581 1E75FFDE 		.ascii	"\036u\377\336\036u\377\337\036v\377\337\036v\377\337\037v\377"
+ 894      1E75FFDF 
+ 894      1E76FFDF 
+ 894      1E76FFDF 
+ 894      1F76FF
+ 895 2594 DF1F77FF 		.ascii	"\337\037w\377\337\037w\377\337\037x\377\340\037x\377\340 x\377"
+ 895      DF1F77FF 
+ 895      DF1F78FF 
+ 895      E01F78FF 
+ 895      E02078FF 
+ 896 25a8 E02079FF 		.ascii	"\340 y\377\340 y\377\340 z\377\341 z\377\341!{\377\341!{\377"
+ 896      E02079FF 
+ 896      E0207AFF 
+ 896      E1207AFF 
+ 896      E1217BFF 
+ 897 25c0 E1217BFF 		.ascii	"\341!{\377\341!|\377\341!|\377\342\"}\377\342\"}\377\342\"}\377"
+GAS LISTING /tmp/ccvPZOGL.s 			page 47
+
+
+ 897      E1217CFF 
+ 897      E1217CFF 
+ 897      E2227DFF 
+ 897      E2227DFF 
+ 898 25d8 E2227EFF 		.ascii	"\342\"~\377\342#~\377\342#\177\377\343#\177\377\343#\200\377"
+ 898      E2237EFF 
+ 898      E2237FFF 
+ 898      E3237FFF 
+ 898      E32380FF 
+ 899 25ec E32380FF 		.ascii	"\343#\200\377\343$\200\377\343$\201\377\343$\201\377\344$\202"
+ 899      E32480FF 
+ 899      E32481FF 
+ 899      E32481FF 
+ 899      E42482
+ 900 25ff FFE42582 		.ascii	"\377\344%\202\377\344%\203\377\344%\203\377\344%\203\377\344"
+ 900      FFE42583 
+ 900      FFE42583 
+ 900      FFE42583 
+ 900      FFE4
+ 901 2611 2584FFE5 		.ascii	"%\204\377\345&\204\377\345&\205\377\345&\205\377\345&\206\377"
+ 901      2684FFE5 
+ 901      2685FFE5 
+ 901      2685FFE5 
+ 901      2686FF
+ 902 2624 E52786FF 		.ascii	"\345'\206\377\345'\206\377\346'\207\377\346'\207\377\346(\210"
+ 902      E52786FF 
+ 902      E62787FF 
+ 902      E62787FF 
+ 902      E62888
+ 903 2637 FFE62888 		.ascii	"\377\346(\210\377\346(\211\377\346(\211\377\346)\211\377\346"
+ 903      FFE62889 
+ 903      FFE62889 
+ 903      FFE62989 
+ 903      FFE6
+ 904 2649 298AFFE6 		.ascii	")\212\377\346*\212\377\346+\213\377\346+\213\377\346,\213\377"
+ 904      2A8AFFE6 
+ 904      2B8BFFE6 
+ 904      2B8BFFE6 
+ 904      2C8BFF
+ 905 265c E62D8CFF 		.ascii	"\346-\214\377\346-\214\377\346.\214\377\346/\215\377\346/\215"
+ 905      E62D8CFF 
+ 905      E62E8CFF 
+ 905      E62F8DFF 
+ 905      E62F8D
+ 906 266f FFE6308D 		.ascii	"\377\3460\215\377\3461\216\377\3461\216\377\3462\216\377\346"
+ 906      FFE6318E 
+ 906      FFE6318E 
+ 906      FFE6328E 
+ 906      FFE6
+ 907 2681 328FFFE6 		.ascii	"2\217\377\3463\217\377\3464\217\377\3464\217\377\3465\220\377"
+ 907      338FFFE6 
+ 907      348FFFE6 
+ 907      348FFFE6 
+ 907      3590FF
+ 908 2694 E63590FF 		.ascii	"\3465\220\377\3466\220\377\3467\221\377\3457\221\377\3458\221"
+ 908      E63690FF 
+ 908      E63791FF 
+GAS LISTING /tmp/ccvPZOGL.s 			page 48
+
+
+ 908      E53791FF 
+ 908      E53891
+ 909 26a7 FFE53892 		.ascii	"\377\3458\222\377\3459\222\377\3459\222\377\345:\223\377\345"
+ 909      FFE53992 
+ 909      FFE53992 
+ 909      FFE53A93 
+ 909      FFE5
+ 910 26b9 3A93FFE5 		.ascii	":\223\377\345;\223\377\345<\224\377\345<\224\377\345=\224\377"
+ 910      3B93FFE5 
+ 910      3C94FFE5 
+ 910      3C94FFE5 
+ 910      3D94FF
+ 911 26cc E53D95FF 		.ascii	"\345=\225\377\345>\225\377\345>\225\377\345?\226\377\345?\226"
+ 911      E53E95FF 
+ 911      E53E95FF 
+ 911      E53F96FF 
+ 911      E53F96
+ 912 26df FFE54096 		.ascii	"\377\345@\226\377\345@\227\377\345A\227\377\344A\227\377\344"
+ 912      FFE54097 
+ 912      FFE54197 
+ 912      FFE44197 
+ 912      FFE4
+ 913 26f1 4297FFE4 		.ascii	"B\227\377\344B\230\377\344C\230\377\344C\230\377\344D\231\377"
+ 913      4298FFE4 
+ 913      4398FFE4 
+ 913      4398FFE4 
+ 913      4499FF
+ 914 2704 E44499FF 		.ascii	"\344D\231\377\344E\231\377\344E\232\377\344E\232\377\344F\232"
+ 914      E44599FF 
+ 914      E4459AFF 
+ 914      E4459AFF 
+ 914      E4469A
+ 915 2717 FFE4469B 		.ascii	"\377\344F\233\377\344G\233\377\344G\233\377\344H\233\377\344"
+ 915      FFE4479B 
+ 915      FFE4479B 
+ 915      FFE4489B 
+ 915      FFE4
+ 916 2729 489CFFE3 		.ascii	"H\234\377\343I\234\377\343I\234\377\343J\235\377\343J\235\377"
+ 916      499CFFE3 
+ 916      499CFFE3 
+ 916      4A9DFFE3 
+ 916      4A9DFF
+ 917 273c E34A9DFF 		.ascii	"\343J\235\377\343K\236\377\343K\236\377\343L\236\377\343L\236"
+ 917      E34B9EFF 
+ 917      E34B9EFF 
+ 917      E34C9EFF 
+ 917      E34C9E
+ 918 274f FFE34D9F 		.ascii	"\377\343M\237\377\343M\237\377\343N\237\377\343N\240\377\343"
+ 918      FFE34D9F 
+ 918      FFE34E9F 
+ 918      FFE34EA0 
+ 918      FFE3
+ 919 2761 4EA0FFE3 		.ascii	"N\240\377\343O\240\377\343O\241\377\342P\241\377\342P\241\377"
+ 919      4FA0FFE3 
+ 919      4FA1FFE2 
+ 919      50A1FFE2 
+ 919      50A1FF
+GAS LISTING /tmp/ccvPZOGL.s 			page 49
+
+
+ 920 2774 E251A1FF 		.ascii	"\342Q\241\377\342Q\242\377\342Q\242\377\342R\242\377\342R\243"
+ 920      E251A2FF 
+ 920      E251A2FF 
+ 920      E252A2FF 
+ 920      E252A3
+ 921 2787 FFE253A3 		.ascii	"\377\342S\243\377\342S\243\377\342S\243\377\342T\244\377\342"
+ 921      FFE253A3 
+ 921      FFE253A3 
+ 921      FFE254A4 
+ 921      FFE2
+ 922 2799 54A4FFE2 		.ascii	"T\244\377\342U\244\377\342U\245\377\341U\245\377\341V\245\377"
+ 922      55A4FFE2 
+ 922      55A5FFE1 
+ 922      55A5FFE1 
+ 922      56A5FF
+ 923 27ac E156A5FF 		.ascii	"\341V\245\377\341W\246\377\341W\246\377\341W\246\377\341X\246"
+ 923      E157A6FF 
+ 923      E157A6FF 
+ 923      E157A6FF 
+ 923      E158A6
+ 924 27bf FFE158A7 		.ascii	"\377\341X\247\377\341Y\247\377\341Y\247\377\341Y\250\377\341"
+ 924      FFE159A7 
+ 924      FFE159A7 
+ 924      FFE159A8 
+ 924      FFE1
+ 925 27d1 5AA8FFE1 		.ascii	"Z\250\377\341Z\250\377\341[\250\377\340[\251\377\340[\251\377"
+ 925      5AA8FFE1 
+ 925      5BA8FFE0 
+ 925      5BA9FFE0 
+ 925      5BA9FF
+ 926 27e4 E05CA9FF 		.ascii	"\340\\\251\377\340\\\251\377\340\\\252\377\340]\252\377\340]"
+ 926      E05CA9FF 
+ 926      E05CAAFF 
+ 926      E05DAAFF 
+ 926      E05D
+ 927 27f6 AAFFE05E 		.ascii	"\252\377\340^\253\377\340^\253\377\340^\253\377\340_\253\377"
+ 927      ABFFE05E 
+ 927      ABFFE05E 
+ 927      ABFFE05F 
+ 927      ABFF
+ 928 2808 E05FACFF 		.ascii	"\340_\254\377\340_\254\377"
+ 928      E05FACFF 
+ 929 2810 E060ACFF 		.ascii	"\340`\254\377\337`\254\377\337a\255\377\337a\255\377\337a\255"
+ 929      DF60ACFF 
+ 929      DF61ADFF 
+ 929      DF61ADFF 
+ 929      DF61AD
+ 930 2823 FFDF62AD 		.ascii	"\377\337b\255\377\337b\256\377\337b\256\377\337c\256\377\337"
+ 930      FFDF62AE 
+ 930      FFDF62AE 
+ 930      FFDF63AE 
+ 930      FFDF
+ 931 2835 63AEFFDF 		.ascii	"c\256\377\337c\257\377\337d\257\377\337d\257\377\336e\257\377"
+ 931      63AFFFDF 
+ 931      64AFFFDF 
+ 931      64AFFFDE 
+ 931      65AFFF
+GAS LISTING /tmp/ccvPZOGL.s 			page 50
+
+
+ 932 2848 DE65B0FF 		.ascii	"\336e\260\377\336e\260\377\336f\260\377\336f\261\377\336g\261"
+ 932      DE65B0FF 
+ 932      DE66B0FF 
+ 932      DE66B1FF 
+ 932      DE67B1
+ 933 285b FFDD67B1 		.ascii	"\377\335g\261\377\335h\261\377\335h\262\377\335h\262\377\335"
+ 933      FFDD68B1 
+ 933      FFDD68B2 
+ 933      FFDD68B2 
+ 933      FFDD
+ 934 286d 69B2FFDC 		.ascii	"i\262\377\334i\262\377\334j\263\377\334j\263\377\334k\263\377"
+ 934      69B2FFDC 
+ 934      6AB3FFDC 
+ 934      6AB3FFDC 
+ 934      6BB3FF
+ 935 2880 DC6BB3FF 		.ascii	"\334k\263\377\334k\264\377\333l\264\377\333l\264\377\333m\264"
+ 935      DC6BB4FF 
+ 935      DB6CB4FF 
+ 935      DB6CB4FF 
+ 935      DB6DB4
+ 936 2893 FFDB6DB5 		.ascii	"\377\333m\265\377\333m\265\377\332n\265\377\332n\265\377\332"
+ 936      FFDB6DB5 
+ 936      FFDA6EB5 
+ 936      FFDA6EB5 
+ 936      FFDA
+ 937 28a5 6FB6FFDA 		.ascii	"o\266\377\332o\266\377\332o\266\377\332p\266\377\331p\267\377"
+ 937      6FB6FFDA 
+ 937      6FB6FFDA 
+ 937      70B6FFD9 
+ 937      70B7FF
+ 938 28b8 D971B7FF 		.ascii	"\331q\267\377\331q\267\377\331q\267\377\331r\267\377\330r\270"
+ 938      D971B7FF 
+ 938      D971B7FF 
+ 938      D972B7FF 
+ 938      D872B8
+ 939 28cb FFD873B8 		.ascii	"\377\330s\270\377\330s\270\377\330s\270\377\330t\271\377\330"
+ 939      FFD873B8 
+ 939      FFD873B8 
+ 939      FFD874B9 
+ 939      FFD8
+ 940 28dd 74B9FFD7 		.ascii	"t\271\377\327u\271\377\327u\271\377\327u\271\377\327v\272\377"
+ 940      75B9FFD7 
+ 940      75B9FFD7 
+ 940      75B9FFD7 
+ 940      76BAFF
+ 941 28f0 D776BAFF 		.ascii	"\327v\272\377\326w\272\377\326w\272\377\326w\273\377\326x\273"
+ 941      D677BAFF 
+ 941      D677BAFF 
+ 941      D677BBFF 
+ 941      D678BB
+ 942 2903 FFD678BB 		.ascii	"\377\326x\273\377\326x\273\377\325y\273\377\325y\274\377\325"
+ 942      FFD678BB 
+ 942      FFD579BB 
+ 942      FFD579BC 
+ 942      FFD5
+ 943 2915 7ABCFFD5 		.ascii	"z\274\377\325z\274\377\325z\274\377\324{\274\377\324{\275\377"
+ 943      7ABCFFD5 
+GAS LISTING /tmp/ccvPZOGL.s 			page 51
+
+
+ 943      7ABCFFD4 
+ 943      7BBCFFD4 
+ 943      7BBDFF
+ 944 2928 D47BBDFF 		.ascii	"\324{\275\377\324|\275\377\324|\275\377\324}\275\377\323}\275"
+ 944      D47CBDFF 
+ 944      D47CBDFF 
+ 944      D47DBDFF 
+ 944      D37DBD
+ 945 293b FFD37DBE 		.ascii	"\377\323}\276\377\323~\276\377\323~\276\377\323~\276\377\322"
+ 945      FFD37EBE 
+ 945      FFD37EBE 
+ 945      FFD37EBE 
+ 945      FFD2
+ 946 294d 7FBEFFD2 		.ascii	"\177\276\377\322\177\277\377\322\177\277\377\322\200\277\377"
+ 946      7FBFFFD2 
+ 946      7FBFFFD2 
+ 946      80BFFF
+ 947 295c D280BFFF 		.ascii	"\322\200\277\377\322\201\277\377\321\201\277\377\321\201\300"
+ 947      D281BFFF 
+ 947      D181BFFF 
+ 947      D181C0
+ 948 296b FFD182C0 		.ascii	"\377\321\202\300\377\321\202\300\377\321\202\300\377\321\203"
+ 948      FFD182C0 
+ 948      FFD182C0 
+ 948      FFD183
+ 949 297a C0FFD083 		.ascii	"\300\377\320\203\300\377\320\203\301\377\320\204\301\377\320"
+ 949      C0FFD083 
+ 949      C1FFD084 
+ 949      C1FFD0
+ 950 2989 84C1FFD0 		.ascii	"\204\301\377\320\204\301\377\320\205\301\377\317\205\301\377"
+ 950      84C1FFD0 
+ 950      85C1FFCF 
+ 950      85C1FF
+ 951 2998 CF85C1FF 		.ascii	"\317\205\301\377\317\206\302\377\317\206\302\377\317\206\302"
+ 951      CF86C2FF 
+ 951      CF86C2FF 
+ 951      CF86C2
+ 952 29a7 FFCF87C2 		.ascii	"\377\317\207\302\377\316\207\302\377\316\207\302\377\316\210"
+ 952      FFCE87C2 
+ 952      FFCE87C2 
+ 952      FFCE88
+ 953 29b6 C2FFCE88 		.ascii	"\302\377\316\210\303\377\316\210\303\377\316\211\303\377\315"
+ 953      C3FFCE88 
+ 953      C3FFCE89 
+ 953      C3FFCD
+ 954 29c5 89C3FFCD 		.ascii	"\211\303\377\315\211\303\377\315\212\303\377\315\212\303\377"
+ 954      89C3FFCD 
+ 954      8AC3FFCD 
+ 954      8AC3FF
+ 955 29d4 CD8AC4FF 		.ascii	"\315\212\304\377\315\213\304\377\314\213\304\377\314\213\304"
+ 955      CD8BC4FF 
+ 955      CC8BC4FF 
+ 955      CC8BC4
+ 956 29e3 FFCC8CC4 		.ascii	"\377\314\214\304\377\314\214\304\377\314\214\304\377\314\215"
+ 956      FFCC8CC4 
+ 956      FFCC8CC4 
+ 956      FFCC8D
+GAS LISTING /tmp/ccvPZOGL.s 			page 52
+
+
+ 957 29f2 C4FFCB8D 		.ascii	"\304\377\313\215\304\377\313\215\305\377\313\216\305\377\313"
+ 957      C4FFCB8D 
+ 957      C5FFCB8E 
+ 957      C5FFCB
+ 958 2a01 8EC5FFCB 		.ascii	"\216\305\377\313\216\305\377\313\217\305\377\313\217\305\377"
+ 958      8EC5FFCB 
+ 958      8FC5FFCB 
+ 958      8FC5FF
+ 959 2a10 CA8FC5FF 		.ascii	"\312\217\305\377\312\220\305\377\312\220\305\377\312\220\306"
+ 959      CA90C5FF 
+ 959      CA90C5FF 
+ 959      CA90C6
+ 960 2a1f FFCA91C6 		.ascii	"\377\312\221\306\377\312\221\306\377\312\221\306\377\311\222"
+ 960      FFCA91C6 
+ 960      FFCA91C6 
+ 960      FFC992
+ 961 2a2e C6FFC992 		.ascii	"\306\377\311\222\306\377\311\222\306\377\311\223\306\377\311"
+ 961      C6FFC992 
+ 961      C6FFC993 
+ 961      C6FFC9
+ 962 2a3d 93C6FFC9 		.ascii	"\223\306\377\311\223\306\377\310\224\306\377\311\224\307\377"
+ 962      93C6FFC8 
+ 962      94C6FFC9 
+ 962      94C7FF
+ 963 2a4c C994C7FF 		.ascii	"\311\224\307\377\311\224\307\377\311\225\307\377\311\225\307"
+ 963      C994C7FF 
+ 963      C995C7FF 
+ 963      C995C7
+ 964 2a5b FFC995C8 		.ascii	"\377\311\225\310\377\311\226\310\377\311\226\310\377\311\226"
+ 964      FFC996C8 
+ 964      FFC996C8 
+ 964      FFC996
+ 965 2a6a C8FFC996 		.ascii	"\310\377\311\226\310\377\311\227\310\377\311\227\310\377\311"
+ 965      C8FFC997 
+ 965      C8FFC997 
+ 965      C8FFC9
+ 966 2a79 97C9FFCA 		.ascii	"\227\311\377\312\230\311\377\312\230\311\377\312\230\311\377"
+ 966      98C9FFCA 
+ 966      98C9FFCA 
+ 966      98C9FF
+ 967 2a88 CA99C9FF 		.ascii	"\312\231\311\377\312\231\311\377\312\231\312\377\312\231\312"
+ 967      CA99C9FF 
+ 967      CA99CAFF 
+ 967      CA99CA
+ 968 2a97 FFCA9ACA 		.ascii	"\377\312\232\312\377\312\232\312\377\312\232\312\377\312\233"
+ 968      FFCA9ACA 
+ 968      FFCA9ACA 
+ 968      FFCA9B
+ 969 2aa6 CAFFCA9B 		.ascii	"\312\377\312\233\313\377\312\233\313\377\313\233\313\377\313"
+ 969      CBFFCA9B 
+ 969      CBFFCB9B 
+ 969      CBFFCB
+ 970 2ab5 9CCBFFCB 		.ascii	"\234\313\377\313\234\313\377\313\234\313\377\313\235\314\377"
+ 970      9CCBFFCB 
+ 970      9CCBFFCB 
+ 970      9DCCFF
+ 971 2ac4 CB9DCCFF 		.ascii	"\313\235\314\377\313\235\314\377\313\235\314\377\313\236\314"
+GAS LISTING /tmp/ccvPZOGL.s 			page 53
+
+
+ 971      CB9DCCFF 
+ 971      CB9DCCFF 
+ 971      CB9ECC
+ 972 2ad3 FFCB9ECC 		.ascii	"\377\313\236\314\377\313\236\315\377\313\237\315\377\313\237"
+ 972      FFCB9ECD 
+ 972      FFCB9FCD 
+ 972      FFCB9F
+ 973 2ae2 CDFFCC9F 		.ascii	"\315\377\314\237\315\377\314\240\315\377\314\240\315\377\314"
+ 973      CDFFCCA0 
+ 973      CDFFCCA0 
+ 973      CDFFCC
+ 974 2af1 A0CDFFCC 		.ascii	"\240\315\377\314\240\316\377\314\241\316\377\314\241\316\377"
+ 974      A0CEFFCC 
+ 974      A1CEFFCC 
+ 974      A1CEFF
+ 975 2b00 CCA1CEFF 		.ascii	"\314\241\316\377\314\242\316\377\314\242\316\377\314\242\317"
+ 975      CCA2CEFF 
+ 975      CCA2CEFF 
+ 975      CCA2CF
+ 976 2b0f FFCCA2CF 		.ascii	"\377\314\242\317\377\315\243\317\377\315\243\317\377\315\243"
+ 976      FFCDA3CF 
+ 976      FFCDA3CF 
+ 976      FFCDA3
+ 977 2b1e CFFFCDA4 		.ascii	"\317\377\315\244\317\377\315\244\317\377\315\244\320\377\315"
+ 977      CFFFCDA4 
+ 977      CFFFCDA4 
+ 977      D0FFCD
+ 978 2b2d A4D0FFCD 		.ascii	"\244\320\377\315\245\320\377\315\245\320\377\315\245\320\377"
+ 978      A5D0FFCD 
+ 978      A5D0FFCD 
+ 978      A5D0FF
+ 979 2b3c CDA6D0FF 		.ascii	"\315\246\320\377\315\246\320\377\316\246\321\377\316\246\321"
+ 979      CDA6D0FF 
+ 979      CEA6D1FF 
+ 979      CEA6D1
+ 980 2b4b FFCEA7D1 		.ascii	"\377\316\247\321\377\316\247\321\377\316\247\321\377\316\250"
+ 980      FFCEA7D1 
+ 980      FFCEA7D1 
+ 980      FFCEA8
+ 981 2b5a D1FFCEA8 		.ascii	"\321\377\316\250\322\377\316\250\322\377\316\251\322\377\316"
+ 981      D2FFCEA8 
+ 981      D2FFCEA9 
+ 981      D2FFCE
+ 982 2b69 A9D2FFCE 		.ascii	"\251\322\377\316\251\322\377\316\251\322\377\317\252\322\377"
+ 982      A9D2FFCE 
+ 982      A9D2FFCF 
+ 982      AAD2FF
+ 983 2b78 CFAAD3FF 		.ascii	"\317\252\323\377\317\252\323\377\317\253\323\377\317\253\323"
+ 983      CFAAD3FF 
+ 983      CFABD3FF 
+ 983      CFABD3
+ 984 2b87 FFCFABD3 		.ascii	"\377\317\253\323\377\317\253\323\377\317\254\323\377\317\254"
+ 984      FFCFABD3 
+ 984      FFCFACD3 
+ 984      FFCFAC
+ 985 2b96 D4FFCFAC 		.ascii	"\324\377\317\254\324\377\317\255\324\377\320\255\324\377\320"
+ 985      D4FFCFAD 
+GAS LISTING /tmp/ccvPZOGL.s 			page 54
+
+
+ 985      D4FFD0AD 
+ 985      D4FFD0
+ 986 2ba5 ADD4FFD0 		.ascii	"\255\324\377\320\255\324\377\320\256\324\377\320\256\325\377"
+ 986      ADD4FFD0 
+ 986      AED4FFD0 
+ 986      AED5FF
+ 987 2bb4 D0AED5FF 		.ascii	"\320\256\325\377\320\257\325\377\320\257\325\377\320\257\325"
+ 987      D0AFD5FF 
+ 987      D0AFD5FF 
+ 987      D0AFD5
+ 988 2bc3 FFD0AFD5 		.ascii	"\377\320\257\325\377\320\260\325\377\321\260\325\377\321\260"
+ 988      FFD0B0D5 
+ 988      FFD1B0D5 
+ 988      FFD1B0
+ 989 2bd2 D6FFD1B1 		.ascii	"\326\377\321\261\326\377\321\261\326\377\321\261\326\377\321"
+ 989      D6FFD1B1 
+ 989      D6FFD1B1 
+ 989      D6FFD1
+ 990 2be1 B1D6FFD1 		.ascii	"\261\326\377\321\262\326\377\321\262\326\377\321\262\327\377"
+ 990      B2D6FFD1 
+ 990      B2D6FFD1 
+ 990      B2D7FF
+ 991 2bf0 D1B3D7FF 		.ascii	"\321\263\327\377\322\263\327\377\322\263\327\377\322\263\327"
+ 991      D2B3D7FF 
+ 991      D2B3D7FF 
+ 991      D2B3D7
+ 992 2bff FFD2B4D7 		.ascii	"\377\322\264\327\377\322\264\327\377\322\264\330\377\322\265"
+ 992      FFD2B4D7 
+ 992      FFD2B4D8 
+ 992      FFD2B5
+ 993 2c0e D8FFD2B5 		.ascii	"\330\377\322\265\330\377\322\265\330\377\322\265\330\377\322"
+ 993      D8FFD2B5 
+ 993      D8FFD2B5 
+ 993      D8FFD2
+ 994 2c1d B6D8FFD3 		.ascii	"\266\330\377\323\266\330\377\323\266\330\377\323\267\331\377"
+ 994      B6D8FFD3 
+ 994      B6D8FFD3 
+ 994      B7D9FF
+ 995 2c2c D3B7D9FF 		.ascii	"\323\267\331\377\323\267\331\377\323\267\331\377\323\270\331"
+ 995      D3B7D9FF 
+ 995      D3B7D9FF 
+ 995      D3B8D9
+ 996 2c3b FFD3B8D9 		.ascii	"\377\323\270\331\377\323\270\331\377\323\271\331\377\324\271"
+ 996      FFD3B8D9 
+ 996      FFD3B9D9 
+ 996      FFD4B9
+ 997 2c4a DAFFD4B9 		.ascii	"\332\377\324\271\332\377\324\271\332\377\324\272\332\377\324"
+ 997      DAFFD4B9 
+ 997      DAFFD4BA 
+ 997      DAFFD4
+ 998 2c59 BADAFFD4 		.ascii	"\272\332\377\324\272\333\377\324\273\333\377\324\273\333\377"
+ 998      BADBFFD4 
+ 998      BBDBFFD4 
+ 998      BBDBFF
+ 999 2c68 D5BBDBFF 		.ascii	"\325\273\333\377\325\274\333\377\325\274\334\377\325\274\334"
+ 999      D5BCDBFF 
+ 999      D5BCDCFF 
+GAS LISTING /tmp/ccvPZOGL.s 			page 55
+
+
+ 999      D5BCDC
+ 1000 2c77 FFD5BDDC 		.ascii	"\377\325\275\334\377\325\275\334\377\325\275\334\377\325\276"
+ 1000      FFD5BDDC 
+ 1000      FFD5BDDC 
+ 1000      FFD5BE
+ 1001 2c86 DDFFD5BE 		.ascii	"\335\377\325\276\335\377\326\276\335\377\326\277\335\377\326"
+ 1001      DDFFD6BE 
+ 1001      DDFFD6BF 
+ 1001      DDFFD6
+ 1002 2c95 BFDDFFD6 		.ascii	"\277\335\377\326\277\336\377\326\300\336\377\326\300\336\377"
+ 1002      BFDEFFD6 
+ 1002      C0DEFFD6 
+ 1002      C0DEFF
+ 1003 2ca4 D6C0DEFF 		.ascii	"\326\300\336\377\326\300\336\377\327\301\336\377\327\301\337"
+ 1003      D6C0DEFF 
+ 1003      D7C1DEFF 
+ 1003      D7C1DF
+ 1004 2cb3 FFD7C1DF 		.ascii	"\377\327\301\337\377\327\302\337\377\327\302\337\377\327\302"
+ 1004      FFD7C2DF 
+ 1004      FFD7C2DF 
+ 1004      FFD7C2
+ 1005 2cc2 DFFFD7C3 		.ascii	"\337\377\327\303\340\377\327\303\340\377\330\303\340\377\330"
+ 1005      E0FFD7C3 
+ 1005      E0FFD8C3 
+ 1005      E0FFD8
+ 1006 2cd1 C4E0FFD8 		.ascii	"\304\340\377\330\304\340\377\330\304\340\377\330\305\341\377"
+ 1006      C4E0FFD8 
+ 1006      C4E0FFD8 
+ 1006      C5E1FF
+ 1007 2ce0 D8C5E1FF 		.ascii	"\330\305\341\377\330\305\341\377\330\306\341\377\331\306\341"
+ 1007      D8C5E1FF 
+ 1007      D8C6E1FF 
+ 1007      D9C6E1
+ 1008 2cef FFD9C6E1 		.ascii	"\377\331\306\341\377\331\306\342\377\331\307\342\377\331\307"
+ 1008      FFD9C6E2 
+ 1008      FFD9C7E2 
+ 1008      FFD9C7
+ 1009 2cfe E2FFD9C7 		.ascii	"\342\377\331\307\342\377\331\310\342\377\332\310\343\377\332"
+ 1009      E2FFD9C8 
+ 1009      E2FFDAC8 
+ 1009      E3FFDA
+ 1010 2d0d C8E3FFDA 		.ascii	"\310\343\377\332\311\343\377\332\311\343\377\332\311\343\377"
+ 1010      C9E3FFDA 
+ 1010      C9E3FFDA 
+ 1010      C9E3FF
+ 1011 2d1c DACAE3FF 		.ascii	"\332\312\343\377\332\312\344\377\333\312\344\377\333\313\344"
+ 1011      DACAE4FF 
+ 1011      DBCAE4FF 
+ 1011      DBCBE4
+ 1012 2d2b FFDBCBE4 		.ascii	"\377\333\313\344\377\333\313\344\377\333\314\344\377\333\314"
+ 1012      FFDBCBE4 
+ 1012      FFDBCCE4 
+ 1012      FFDBCC
+ 1013 2d3a E5FFDBCC 		.ascii	"\345\377\333\314\345\377\334\314\345\377\334\315\345\377\334"
+ 1013      E5FFDCCC 
+ 1013      E5FFDCCD 
+ 1013      E5FFDC
+GAS LISTING /tmp/ccvPZOGL.s 			page 56
+
+
+ 1014 2d49 CDE5FFDC 		.ascii	"\315\345\377\334\315\345\377\334\316\346\377\334\316\346\377"
+ 1014      CDE5FFDC 
+ 1014      CEE6FFDC 
+ 1014      CEE6FF
+ 1015 2d58 DCCEE6FF 		.ascii	"\334\316\346\377\335\317\346\377\335\317\346\377\335\317\346"
+ 1015      DDCFE6FF 
+ 1015      DDCFE6FF 
+ 1015      DDCFE6
+ 1016 2d67 FFDDD0E6 		.ascii	"\377\335\320\346\377\335\320\347\377\335\320\347\377\335\320"
+ 1016      FFDDD0E7 
+ 1016      FFDDD0E7 
+ 1016      FFDDD0
+ 1017 2d76 E7FFDED1 		.ascii	"\347\377\336\321\347\377\336\321\347\377\336\321\347\377\336"
+ 1017      E7FFDED1 
+ 1017      E7FFDED1 
+ 1017      E7FFDE
+ 1018 2d85 D2E8FFDE 		.ascii	"\322\350\377\336\322\350\377\336\322\350\377\337\323\350\377"
+ 1018      D2E8FFDE 
+ 1018      D2E8FFDF 
+ 1018      D3E8FF
+ 1019 2d94 DFD3E8FF 		.ascii	"\337\323\350\377\337\323\350\377\337\324\350\377\337\324\351"
+ 1019      DFD3E8FF 
+ 1019      DFD4E8FF 
+ 1019      DFD4E9
+ 1020 2da3 FFDFD4E9 		.ascii	"\377\337\324\351\377\340\325\351\377\340\325\351\377\340\325"
+ 1020      FFE0D5E9 
+ 1020      FFE0D5E9 
+ 1020      FFE0D5
+ 1021 2db2 E9FFE0D5 		.ascii	"\351\377\340\325\351\377\340\326\352\377\340\326\352\377\341"
+ 1021      E9FFE0D6 
+ 1021      EAFFE0D6 
+ 1021      EAFFE1
+ 1022 2dc1 D6EAFFE1 		.ascii	"\326\352\377\341\327\352\377\341\327\352\377\341\327\352\377"
+ 1022      D7EAFFE1 
+ 1022      D7EAFFE1 
+ 1022      D7EAFF
+ 1023 2dd0 E1D8EAFF 		.ascii	"\341\330\352\377\341\330\353\377\342\330\353\377\342\331\353"
+ 1023      E1D8EBFF 
+ 1023      E2D8EBFF 
+ 1023      E2D9EB
+ 1024 2ddf FFE2D9EB 		.ascii	"\377\342\331\353\377\342\331\353\377\342\331\353\377\342\332"
+ 1024      FFE2D9EB 
+ 1024      FFE2D9EB 
+ 1024      FFE2DA
+ 1025 2dee EBFFE3DA 		.ascii	"\353\377\343\332\354\377\343\332\354\377\343\333\354\377\343"
+ 1025      ECFFE3DA 
+ 1025      ECFFE3DB 
+ 1025      ECFFE3
+ 1026 2dfd DBECFFE3 		.ascii	"\333\354\377\343\333\354\377\344\334\354\377\344\334\354\377"
+ 1026      DBECFFE4 
+ 1026      DCECFFE4 
+ 1026      DCECFF
+ 1027 2e0c E4DCEDFF 		.ascii	"\344\334\355\377\344\335\355\377\344\335\355\377\344\335\355"
+ 1027      E4DDEDFF 
+ 1027      E4DDEDFF 
+ 1027      E4DDED
+ 1028 2e1b FFE5DDED 		.ascii	"\377\345\335\355\377\345\336\355\377\345\336\355\377\345\336"
+GAS LISTING /tmp/ccvPZOGL.s 			page 57
+
+
+ 1028      FFE5DEED 
+ 1028      FFE5DEED 
+ 1028      FFE5DE
+ 1029 2e2a EEFFE5DF 		.ascii	"\356\377\345\337\356\377\346\337\356\377\346\337\356\377\346"
+ 1029      EEFFE6DF 
+ 1029      EEFFE6DF 
+ 1029      EEFFE6
+ 1030 2e39 E0EEFFE6 		.ascii	"\340\356\377\346\340\356\377\346\340\356\377\346\341\356\377"
+ 1030      E0EEFFE6 
+ 1030      E0EEFFE6 
+ 1030      E1EEFF
+ 1031 2e48 E7E1EFFF 		.ascii	"\347\341\357\377\347\341\357\377\347\341\357\377\347\341\357"
+ 1031      E7E1EFFF 
+ 1031      E7E1EFFF 
+ 1031      E7E1EF
+ 1032 2e57 FFE7E1EF 		.ascii	"\377\347\341\357\377\347\341\357\377\347\342\357\377\350\342"
+ 1032      FFE7E1EF 
+ 1032      FFE7E2EF 
+ 1032      FFE8E2
+ 1033 2e66 EFFFE8E2 		.ascii	"\357\377\350\342\357\377\350\342\357\377\350\342\357\377\350"
+ 1033      EFFFE8E2 
+ 1033      EFFFE8E2 
+ 1033      EFFFE8
+ 1034 2e75 E2EFFFE8 		.ascii	"\342\357\377\350\342\357\377\350\343\360\377\350\343\360\377"
+ 1034      E2EFFFE8 
+ 1034      E3F0FFE8 
+ 1034      E3F0FF
+ 1035 2e84 E9E3F0FF 		.ascii	"\351\343\360\377\351\343\360\377\351\343\360\377\351\343\360"
+ 1035      E9E3F0FF 
+ 1035      E9E3F0FF 
+ 1035      E9E3F0
+ 1036 2e93 FFE9E3F0 		.ascii	"\377\351\343\360\377\351\344\360\377\351\344\360\377\352\344"
+ 1036      FFE9E4F0 
+ 1036      FFE9E4F0 
+ 1036      FFEAE4
+ 1037 2ea2 F0FFEAE4 		.ascii	"\360\377\352\344\360\377\352\344\360\377\352\344\360\377\352"
+ 1037      F0FFEAE4 
+ 1037      F0FFEAE4 
+ 1037      F0FFEA
+ 1038 2eb1 E4F1FFEA 		.ascii	"\344\361\377\352\345\361\377\352\345\361\377\352\345\361\377"
+ 1038      E5F1FFEA 
+ 1038      E5F1FFEA 
+ 1038      E5F1FF
+ 1039 2ec0 EBE5F1FF 		.ascii	"\353\345\361\377\353\345\361\377\353\345\361\377\353\345\361"
+ 1039      EBE5F1FF 
+ 1039      EBE5F1FF 
+ 1039      EBE5F1
+ 1040 2ecf FFEBE6F1 		.ascii	"\377\353\346\361\377\353\346\361\377\353\346\361\377\353\346"
+ 1040      FFEBE6F1 
+ 1040      FFEBE6F1 
+ 1040      FFEBE6
+ 1041 2ede F1FFECE6 		.ascii	"\361\377\354\346\361\377\354\346\362\377\354\346\362\377\354"
+ 1041      F1FFECE6 
+ 1041      F2FFECE6 
+ 1041      F2FFEC
+ 1042 2eed E7F2FFEC 		.ascii	"\347\362\377\354\347\362\377\354\347\362\377\354\347\362\377"
+ 1042      E7F2FFEC 
+GAS LISTING /tmp/ccvPZOGL.s 			page 58
+
+
+ 1042      E7F2FFEC 
+ 1042      E7F2FF
+ 1043 2efc ECE7F2FF 		.ascii	"\354\347\362\377\355\347\362\377\355\350\362\377\355\350\362"
+ 1043      EDE7F2FF 
+ 1043      EDE8F2FF 
+ 1043      EDE8F2
+ 1044 2f0b FFEDE8F2 		.ascii	"\377\355\350\362\377\355\350\362\377\355\350\362\377\355\350"
+ 1044      FFEDE8F2 
+ 1044      FFEDE8F2 
+ 1044      FFEDE8
+ 1045 2f1a F3FFEDE8 		.ascii	"\363\377\355\350\363\377\356\351\363\377\356\351\363\377\356"
+ 1045      F3FFEEE9 
+ 1045      F3FFEEE9 
+ 1045      F3FFEE
+ 1046 2f29 E9F3FFEE 		.ascii	"\351\363\377\356\351\363\377\356\351\363\377\356\351\363\377"
+ 1046      E9F3FFEE 
+ 1046      E9F3FFEE 
+ 1046      E9F3FF
+ 1047 2f38 EEE9F3FF 		.ascii	"\356\351\363\377\357\352\363\377\357\352\363\377\357\352\363"
+ 1047      EFEAF3FF 
+ 1047      EFEAF3FF 
+ 1047      EFEAF3
+ 1048 2f47 FFEFEAF3 		.ascii	"\377\357\352\363\377\357\352\364\377\357\352\364\377\357\352"
+ 1048      FFEFEAF4 
+ 1048      FFEFEAF4 
+ 1048      FFEFEA
+ 1049 2f56 F4FFEFEB 		.ascii	"\364\377\357\353\364\377\360\353\364\377\360\353\364\377\360"
+ 1049      F4FFF0EB 
+ 1049      F4FFF0EB 
+ 1049      F4FFF0
+ 1050 2f65 EBF4FFF0 		.ascii	"\353\364\377\360\353\364\377\360\353\364\377\360\354\364\377"
+ 1050      EBF4FFF0 
+ 1050      EBF4FFF0 
+ 1050      ECF4FF
+ 1051 2f74 F0ECF4FF 		.ascii	"\360\354\364\377\360\354\364\377\360\354\364\377\361\354\365"
+ 1051      F0ECF4FF 
+ 1051      F0ECF4FF 
+ 1051      F1ECF5
+ 1052 2f83 FFF1ECF5 		.ascii	"\377\361\354\365\377\361\354\365\377\361\355\365\377\361\355"
+ 1052      FFF1ECF5 
+ 1052      FFF1EDF5 
+ 1052      FFF1ED
+ 1053 2f92 F5FFF1ED 		.ascii	"\365\377\361\355\365\377\361\355\365\377\361\355\365\377\362"
+ 1053      F5FFF1ED 
+ 1053      F5FFF1ED 
+ 1053      F5FFF2
+ 1054 2fa1 EDF5FFF2 		.ascii	"\355\365\377\362\355\365\377\362\356\365\377\362\356\365\377"
+ 1054      EDF5FFF2 
+ 1054      EEF5FFF2 
+ 1054      EEF5FF
+ 1055 2fb0 F2EEF5FF 		.ascii	"\362\356\365\377\362\356\366\377\362\356\366\377\362\356\366"
+ 1055      F2EEF6FF 
+ 1055      F2EEF6FF 
+ 1055      F2EEF6
+ 1056 2fbf FFF3EFF6 		.ascii	"\377\363\357\366\377\363\357\366\377\363\357\366\377\363\357"
+ 1056      FFF3EFF6 
+ 1056      FFF3EFF6 
+GAS LISTING /tmp/ccvPZOGL.s 			page 59
+
+
+ 1056      FFF3EF
+ 1057 2fce F6FFF3EF 		.ascii	"\366\377\363\357\366\377\363\357\366\377\363\357\366\377\363"
+ 1057      F6FFF3EF 
+ 1057      F6FFF3EF 
+ 1057      F6FFF3
+ 1058 2fdd F0F6FF   		.ascii	"\360\366\377"
+ 1059 2fe0 F4F0F6FF 		.ascii	"\364\360\366\377\364\360\367\377\364\360\367\377\364\360\367"
+ 1059      F4F0F7FF 
+ 1059      F4F0F7FF 
+ 1059      F4F0F7
+ 1060 2fef FFF4F0F7 		.ascii	"\377\364\360\367\377\364\360\367\377\364\361\367\377\364\361"
+ 1060      FFF4F0F7 
+ 1060      FFF4F1F7 
+ 1060      FFF4F1
+ 1061 2ffe F7FFF4F1 		.ascii	"\367\377\364\361\367\377\365\361\367\377\365\361\367\377\365"
+ 1061      F7FFF5F1 
+ 1061      F7FFF5F1 
+ 1061      F7FFF5
+ 1062 300d F1F7FFF5 		.ascii	"\361\367\377\365\362\367\377\365\362\370\377\365\362\370\377"
+ 1062      F2F7FFF5 
+ 1062      F2F8FFF5 
+ 1062      F2F8FF
+ 1063 301c F5F2F8FF 		.ascii	"\365\362\370\377\365\362\370\377\366\362\370\377\366\362\370"
+ 1063      F5F2F8FF 
+ 1063      F6F2F8FF 
+ 1063      F6F2F8
+ 1064 302b FFF6F3F8 		.ascii	"\377\366\363\370\377\366\363\370\377\366\363\370\377\366\363"
+ 1064      FFF6F3F8 
+ 1064      FFF6F3F8 
+ 1064      FFF6F3
+ 1065 303a F8FFF6F3 		.ascii	"\370\377\366\363\370\377\366\363\370\377"
+ 1065      F8FFF6F3 
+ 1065      F8FF
+ 1066              		.globl	heatmap_cs_PuRd_discrete
+ 1067              		.section	.data.rel.local
+ 1068              		.align 8
+ 1069              		.type	heatmap_cs_PuRd_discrete, @object
+ 1070              		.size	heatmap_cs_PuRd_discrete, 8
+ 1071              	heatmap_cs_PuRd_discrete:
+ 1072 0018 00000000 		.quad	discrete
+ 1072      00000000 
+ 1073              		.section	.data.rel.ro.local
+ 1074              		.align 16
+ 1075              		.type	discrete, @object
+ 1076              		.size	discrete, 16
+ 1077              	discrete:
+ 1078 0030 00000000 		.quad	discrete_data
+ 1078      00000000 
+ 1079 0038 0A000000 		.quad	10
+ 1079      00000000 
+ 1080              		.section	.rodata
+ 1081 3044 00000000 		.align 32
+ 1081      00000000 
+ 1081      00000000 
+ 1081      00000000 
+ 1081      00000000 
+ 1082              		.type	discrete_data, @object
+GAS LISTING /tmp/ccvPZOGL.s 			page 60
+
+
+ 1083              		.size	discrete_data, 40
+ 1084              	discrete_data:
+ 1085 3060 00       		.string	""
+ 1086 3061 00       		.string	""
+ 1087 3062 00       		.string	""
+ 1088 3063 00       		.string	""
+ 1089 3064 6700     		.string	"g"
+ 1090 3066 1FFF9800 		.string	"\037\377\230"
+ 1091 306a 43FFCE12 		.ascii	"C\377\316\022V\377\347)\212\377\337e\260\377\311\224\307\377"
+ 1091      56FFE729 
+ 1091      8AFFDF65 
+ 1091      B0FFC994 
+ 1091      C7FF
+ 1092 307c D4B9DAFF 		.ascii	"\324\271\332\377\347\341\357\377\367\364\371\377"
+ 1092      E7E1EFFF 
+ 1092      F7F4F9FF 
+ 1093              		.text
+ 1094              	.Letext0:
+ 1095              		.file 1 "./heatmap.h"
+ 1096              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1097              		.file 3 "./colorschemes/PuRd.h"
+ 1098              		.file 4 "colorschemes/PuRd.c"
+ 1099              		.section	.debug_info,"",@progbits
+ 1100              	.Ldebug_info0:
+ 1101 0000 E3010000 		.long	0x1e3
+ 1102 0004 0500     		.value	0x5
+ 1103 0006 01       		.byte	0x1
+ 1104 0007 08       		.byte	0x8
+ 1105 0008 00000000 		.long	.Ldebug_abbrev0
+ 1106 000c 0A       		.uleb128 0xa
+ 1107 000d 00000000 		.long	.LASF26
+ 1108 0011 1D       		.byte	0x1d
+ 1109 0012 00000000 		.long	.LASF0
+ 1110 0016 00000000 		.long	.LASF1
+ 1111 001a 00000000 		.long	.Ldebug_line0
+ 1112 001e 01       		.uleb128 0x1
+ 1113 001f 08       		.byte	0x8
+ 1114 0020 05       		.byte	0x5
+ 1115 0021 00000000 		.long	.LASF2
+ 1116 0025 06       		.uleb128 0x6
+ 1117 0026 00000000 		.long	.LASF12
+ 1118 002a 02       		.byte	0x2
+ 1119 002b D6       		.byte	0xd6
+ 1120 002c 17       		.byte	0x17
+ 1121 002d 31000000 		.long	0x31
+ 1122 0031 01       		.uleb128 0x1
+ 1123 0032 08       		.byte	0x8
+ 1124 0033 07       		.byte	0x7
+ 1125 0034 00000000 		.long	.LASF3
+ 1126 0038 0B       		.uleb128 0xb
+ 1127 0039 04       		.byte	0x4
+ 1128 003a 05       		.byte	0x5
+ 1129 003b 696E7400 		.string	"int"
+ 1130 003f 01       		.uleb128 0x1
+ 1131 0040 08       		.byte	0x8
+ 1132 0041 05       		.byte	0x5
+ 1133 0042 00000000 		.long	.LASF4
+GAS LISTING /tmp/ccvPZOGL.s 			page 61
+
+
+ 1134 0046 01       		.uleb128 0x1
+ 1135 0047 10       		.byte	0x10
+ 1136 0048 04       		.byte	0x4
+ 1137 0049 00000000 		.long	.LASF5
+ 1138 004d 01       		.uleb128 0x1
+ 1139 004e 04       		.byte	0x4
+ 1140 004f 04       		.byte	0x4
+ 1141 0050 00000000 		.long	.LASF6
+ 1142 0054 01       		.uleb128 0x1
+ 1143 0055 04       		.byte	0x4
+ 1144 0056 07       		.byte	0x7
+ 1145 0057 00000000 		.long	.LASF7
+ 1146 005b 01       		.uleb128 0x1
+ 1147 005c 02       		.byte	0x2
+ 1148 005d 07       		.byte	0x7
+ 1149 005e 00000000 		.long	.LASF8
+ 1150 0062 0C       		.uleb128 0xc
+ 1151 0063 10       		.byte	0x10
+ 1152 0064 01       		.byte	0x1
+ 1153 0065 BB       		.byte	0xbb
+ 1154 0066 09       		.byte	0x9
+ 1155 0067 84000000 		.long	0x84
+ 1156 006b 07       		.uleb128 0x7
+ 1157 006c 00000000 		.long	.LASF9
+ 1158 0070 BC       		.byte	0xbc
+ 1159 0071 1A       		.byte	0x1a
+ 1160 0072 84000000 		.long	0x84
+ 1161 0076 00       		.byte	0
+ 1162 0077 07       		.uleb128 0x7
+ 1163 0078 00000000 		.long	.LASF10
+ 1164 007c BD       		.byte	0xbd
+ 1165 007d 0C       		.byte	0xc
+ 1166 007e 25000000 		.long	0x25
+ 1167 0082 08       		.byte	0x8
+ 1168 0083 00       		.byte	0
+ 1169 0084 08       		.uleb128 0x8
+ 1170 0085 90000000 		.long	0x90
+ 1171 0089 01       		.uleb128 0x1
+ 1172 008a 01       		.byte	0x1
+ 1173 008b 08       		.byte	0x8
+ 1174 008c 00000000 		.long	.LASF11
+ 1175 0090 03       		.uleb128 0x3
+ 1176 0091 89000000 		.long	0x89
+ 1177 0095 06       		.uleb128 0x6
+ 1178 0096 00000000 		.long	.LASF13
+ 1179 009a 01       		.byte	0x1
+ 1180 009b BE       		.byte	0xbe
+ 1181 009c 03       		.byte	0x3
+ 1182 009d 62000000 		.long	0x62
+ 1183 00a1 03       		.uleb128 0x3
+ 1184 00a2 95000000 		.long	0x95
+ 1185 00a6 08       		.uleb128 0x8
+ 1186 00a7 A1000000 		.long	0xa1
+ 1187 00ab 04       		.uleb128 0x4
+ 1188 00ac 00000000 		.long	.LASF14
+ 1189 00b0 21       		.byte	0x21
+ 1190 00b1 A6000000 		.long	0xa6
+GAS LISTING /tmp/ccvPZOGL.s 			page 62
+
+
+ 1191 00b5 04       		.uleb128 0x4
+ 1192 00b6 00000000 		.long	.LASF15
+ 1193 00ba 23       		.byte	0x23
+ 1194 00bb A6000000 		.long	0xa6
+ 1195 00bf 04       		.uleb128 0x4
+ 1196 00c0 00000000 		.long	.LASF16
+ 1197 00c4 25       		.byte	0x25
+ 1198 00c5 A6000000 		.long	0xa6
+ 1199 00c9 04       		.uleb128 0x4
+ 1200 00ca 00000000 		.long	.LASF17
+ 1201 00ce 28       		.byte	0x28
+ 1202 00cf A6000000 		.long	0xa6
+ 1203 00d3 09       		.uleb128 0x9
+ 1204 00d4 90000000 		.long	0x90
+ 1205 00d8 E3000000 		.long	0xe3
+ 1206 00dc 0D       		.uleb128 0xd
+ 1207 00dd 31000000 		.long	0x31
+ 1208 00e1 27       		.byte	0x27
+ 1209 00e2 00       		.byte	0
+ 1210 00e3 03       		.uleb128 0x3
+ 1211 00e4 D3000000 		.long	0xd3
+ 1212 00e8 02       		.uleb128 0x2
+ 1213 00e9 00000000 		.long	.LASF18
+ 1214 00ed 20       		.byte	0x20
+ 1215 00ee 1C       		.byte	0x1c
+ 1216 00ef E3000000 		.long	0xe3
+ 1217 00f3 09       		.uleb128 0x9
+ 1218 00f4 03       		.byte	0x3
+ 1219 00f5 00000000 		.quad	discrete_data
+ 1219      00000000 
+ 1220 00fd 02       		.uleb128 0x2
+ 1221 00fe 00000000 		.long	.LASF19
+ 1222 0102 23       		.byte	0x23
+ 1223 0103 24       		.byte	0x24
+ 1224 0104 A1000000 		.long	0xa1
+ 1225 0108 09       		.uleb128 0x9
+ 1226 0109 03       		.byte	0x3
+ 1227 010a 00000000 		.quad	discrete
+ 1227      00000000 
+ 1228 0112 05       		.uleb128 0x5
+ 1229 0113 AB000000 		.long	0xab
+ 1230 0117 24       		.byte	0x24
+ 1231 0118 09       		.uleb128 0x9
+ 1232 0119 03       		.byte	0x3
+ 1233 011a 00000000 		.quad	heatmap_cs_PuRd_discrete
+ 1233      00000000 
+ 1234 0122 09       		.uleb128 0x9
+ 1235 0123 90000000 		.long	0x90
+ 1236 0127 33010000 		.long	0x133
+ 1237 012b 0E       		.uleb128 0xe
+ 1238 012c 31000000 		.long	0x31
+ 1239 0130 0310     		.value	0x1003
+ 1240 0132 00       		.byte	0
+ 1241 0133 03       		.uleb128 0x3
+ 1242 0134 22010000 		.long	0x122
+ 1243 0138 02       		.uleb128 0x2
+ 1244 0139 00000000 		.long	.LASF20
+GAS LISTING /tmp/ccvPZOGL.s 			page 63
+
+
+ 1245 013d 26       		.byte	0x26
+ 1246 013e 1C       		.byte	0x1c
+ 1247 013f 33010000 		.long	0x133
+ 1248 0143 09       		.uleb128 0x9
+ 1249 0144 03       		.byte	0x3
+ 1250 0145 00000000 		.quad	soft_data
+ 1250      00000000 
+ 1251 014d 02       		.uleb128 0x2
+ 1252 014e 00000000 		.long	.LASF21
+ 1253 0152 29       		.byte	0x29
+ 1254 0153 24       		.byte	0x24
+ 1255 0154 A1000000 		.long	0xa1
+ 1256 0158 09       		.uleb128 0x9
+ 1257 0159 03       		.byte	0x3
+ 1258 015a 00000000 		.quad	soft
+ 1258      00000000 
+ 1259 0162 05       		.uleb128 0x5
+ 1260 0163 B5000000 		.long	0xb5
+ 1261 0167 2A       		.byte	0x2a
+ 1262 0168 09       		.uleb128 0x9
+ 1263 0169 03       		.byte	0x3
+ 1264 016a 00000000 		.quad	heatmap_cs_PuRd_soft
+ 1264      00000000 
+ 1265 0172 02       		.uleb128 0x2
+ 1266 0173 00000000 		.long	.LASF22
+ 1267 0177 2C       		.byte	0x2c
+ 1268 0178 1C       		.byte	0x1c
+ 1269 0179 33010000 		.long	0x133
+ 1270 017d 09       		.uleb128 0x9
+ 1271 017e 03       		.byte	0x3
+ 1272 017f 00000000 		.quad	mixed_data
+ 1272      00000000 
+ 1273 0187 02       		.uleb128 0x2
+ 1274 0188 00000000 		.long	.LASF23
+ 1275 018c 2F       		.byte	0x2f
+ 1276 018d 24       		.byte	0x24
+ 1277 018e A1000000 		.long	0xa1
+ 1278 0192 09       		.uleb128 0x9
+ 1279 0193 03       		.byte	0x3
+ 1280 0194 00000000 		.quad	mixed
+ 1280      00000000 
+ 1281 019c 05       		.uleb128 0x5
+ 1282 019d BF000000 		.long	0xbf
+ 1283 01a1 30       		.byte	0x30
+ 1284 01a2 09       		.uleb128 0x9
+ 1285 01a3 03       		.byte	0x3
+ 1286 01a4 00000000 		.quad	heatmap_cs_PuRd_mixed
+ 1286      00000000 
+ 1287 01ac 02       		.uleb128 0x2
+ 1288 01ad 00000000 		.long	.LASF24
+ 1289 01b1 32       		.byte	0x32
+ 1290 01b2 1C       		.byte	0x1c
+ 1291 01b3 33010000 		.long	0x133
+ 1292 01b7 09       		.uleb128 0x9
+ 1293 01b8 03       		.byte	0x3
+ 1294 01b9 00000000 		.quad	mixed_exp_data
+ 1294      00000000 
+GAS LISTING /tmp/ccvPZOGL.s 			page 64
+
+
+ 1295 01c1 02       		.uleb128 0x2
+ 1296 01c2 00000000 		.long	.LASF25
+ 1297 01c6 35       		.byte	0x35
+ 1298 01c7 24       		.byte	0x24
+ 1299 01c8 A1000000 		.long	0xa1
+ 1300 01cc 09       		.uleb128 0x9
+ 1301 01cd 03       		.byte	0x3
+ 1302 01ce 00000000 		.quad	mixed_exp
+ 1302      00000000 
+ 1303 01d6 05       		.uleb128 0x5
+ 1304 01d7 C9000000 		.long	0xc9
+ 1305 01db 36       		.byte	0x36
+ 1306 01dc 09       		.uleb128 0x9
+ 1307 01dd 03       		.byte	0x3
+ 1308 01de 00000000 		.quad	heatmap_cs_PuRd_mixed_exp
+ 1308      00000000 
+ 1309 01e6 00       		.byte	0
+ 1310              		.section	.debug_abbrev,"",@progbits
+ 1311              	.Ldebug_abbrev0:
+ 1312 0000 01       		.uleb128 0x1
+ 1313 0001 24       		.uleb128 0x24
+ 1314 0002 00       		.byte	0
+ 1315 0003 0B       		.uleb128 0xb
+ 1316 0004 0B       		.uleb128 0xb
+ 1317 0005 3E       		.uleb128 0x3e
+ 1318 0006 0B       		.uleb128 0xb
+ 1319 0007 03       		.uleb128 0x3
+ 1320 0008 0E       		.uleb128 0xe
+ 1321 0009 00       		.byte	0
+ 1322 000a 00       		.byte	0
+ 1323 000b 02       		.uleb128 0x2
+ 1324 000c 34       		.uleb128 0x34
+ 1325 000d 00       		.byte	0
+ 1326 000e 03       		.uleb128 0x3
+ 1327 000f 0E       		.uleb128 0xe
+ 1328 0010 3A       		.uleb128 0x3a
+ 1329 0011 21       		.uleb128 0x21
+ 1330 0012 04       		.sleb128 4
+ 1331 0013 3B       		.uleb128 0x3b
+ 1332 0014 0B       		.uleb128 0xb
+ 1333 0015 39       		.uleb128 0x39
+ 1334 0016 0B       		.uleb128 0xb
+ 1335 0017 49       		.uleb128 0x49
+ 1336 0018 13       		.uleb128 0x13
+ 1337 0019 02       		.uleb128 0x2
+ 1338 001a 18       		.uleb128 0x18
+ 1339 001b 00       		.byte	0
+ 1340 001c 00       		.byte	0
+ 1341 001d 03       		.uleb128 0x3
+ 1342 001e 26       		.uleb128 0x26
+ 1343 001f 00       		.byte	0
+ 1344 0020 49       		.uleb128 0x49
+ 1345 0021 13       		.uleb128 0x13
+ 1346 0022 00       		.byte	0
+ 1347 0023 00       		.byte	0
+ 1348 0024 04       		.uleb128 0x4
+ 1349 0025 34       		.uleb128 0x34
+GAS LISTING /tmp/ccvPZOGL.s 			page 65
+
+
+ 1350 0026 00       		.byte	0
+ 1351 0027 03       		.uleb128 0x3
+ 1352 0028 0E       		.uleb128 0xe
+ 1353 0029 3A       		.uleb128 0x3a
+ 1354 002a 21       		.uleb128 0x21
+ 1355 002b 03       		.sleb128 3
+ 1356 002c 3B       		.uleb128 0x3b
+ 1357 002d 0B       		.uleb128 0xb
+ 1358 002e 39       		.uleb128 0x39
+ 1359 002f 21       		.uleb128 0x21
+ 1360 0030 25       		.sleb128 37
+ 1361 0031 49       		.uleb128 0x49
+ 1362 0032 13       		.uleb128 0x13
+ 1363 0033 3F       		.uleb128 0x3f
+ 1364 0034 19       		.uleb128 0x19
+ 1365 0035 3C       		.uleb128 0x3c
+ 1366 0036 19       		.uleb128 0x19
+ 1367 0037 00       		.byte	0
+ 1368 0038 00       		.byte	0
+ 1369 0039 05       		.uleb128 0x5
+ 1370 003a 34       		.uleb128 0x34
+ 1371 003b 00       		.byte	0
+ 1372 003c 47       		.uleb128 0x47
+ 1373 003d 13       		.uleb128 0x13
+ 1374 003e 3A       		.uleb128 0x3a
+ 1375 003f 21       		.uleb128 0x21
+ 1376 0040 04       		.sleb128 4
+ 1377 0041 3B       		.uleb128 0x3b
+ 1378 0042 0B       		.uleb128 0xb
+ 1379 0043 39       		.uleb128 0x39
+ 1380 0044 21       		.uleb128 0x21
+ 1381 0045 1E       		.sleb128 30
+ 1382 0046 02       		.uleb128 0x2
+ 1383 0047 18       		.uleb128 0x18
+ 1384 0048 00       		.byte	0
+ 1385 0049 00       		.byte	0
+ 1386 004a 06       		.uleb128 0x6
+ 1387 004b 16       		.uleb128 0x16
+ 1388 004c 00       		.byte	0
+ 1389 004d 03       		.uleb128 0x3
+ 1390 004e 0E       		.uleb128 0xe
+ 1391 004f 3A       		.uleb128 0x3a
+ 1392 0050 0B       		.uleb128 0xb
+ 1393 0051 3B       		.uleb128 0x3b
+ 1394 0052 0B       		.uleb128 0xb
+ 1395 0053 39       		.uleb128 0x39
+ 1396 0054 0B       		.uleb128 0xb
+ 1397 0055 49       		.uleb128 0x49
+ 1398 0056 13       		.uleb128 0x13
+ 1399 0057 00       		.byte	0
+ 1400 0058 00       		.byte	0
+ 1401 0059 07       		.uleb128 0x7
+ 1402 005a 0D       		.uleb128 0xd
+ 1403 005b 00       		.byte	0
+ 1404 005c 03       		.uleb128 0x3
+ 1405 005d 0E       		.uleb128 0xe
+ 1406 005e 3A       		.uleb128 0x3a
+GAS LISTING /tmp/ccvPZOGL.s 			page 66
+
+
+ 1407 005f 21       		.uleb128 0x21
+ 1408 0060 01       		.sleb128 1
+ 1409 0061 3B       		.uleb128 0x3b
+ 1410 0062 0B       		.uleb128 0xb
+ 1411 0063 39       		.uleb128 0x39
+ 1412 0064 0B       		.uleb128 0xb
+ 1413 0065 49       		.uleb128 0x49
+ 1414 0066 13       		.uleb128 0x13
+ 1415 0067 38       		.uleb128 0x38
+ 1416 0068 0B       		.uleb128 0xb
+ 1417 0069 00       		.byte	0
+ 1418 006a 00       		.byte	0
+ 1419 006b 08       		.uleb128 0x8
+ 1420 006c 0F       		.uleb128 0xf
+ 1421 006d 00       		.byte	0
+ 1422 006e 0B       		.uleb128 0xb
+ 1423 006f 21       		.uleb128 0x21
+ 1424 0070 08       		.sleb128 8
+ 1425 0071 49       		.uleb128 0x49
+ 1426 0072 13       		.uleb128 0x13
+ 1427 0073 00       		.byte	0
+ 1428 0074 00       		.byte	0
+ 1429 0075 09       		.uleb128 0x9
+ 1430 0076 01       		.uleb128 0x1
+ 1431 0077 01       		.byte	0x1
+ 1432 0078 49       		.uleb128 0x49
+ 1433 0079 13       		.uleb128 0x13
+ 1434 007a 01       		.uleb128 0x1
+ 1435 007b 13       		.uleb128 0x13
+ 1436 007c 00       		.byte	0
+ 1437 007d 00       		.byte	0
+ 1438 007e 0A       		.uleb128 0xa
+ 1439 007f 11       		.uleb128 0x11
+ 1440 0080 01       		.byte	0x1
+ 1441 0081 25       		.uleb128 0x25
+ 1442 0082 0E       		.uleb128 0xe
+ 1443 0083 13       		.uleb128 0x13
+ 1444 0084 0B       		.uleb128 0xb
+ 1445 0085 03       		.uleb128 0x3
+ 1446 0086 1F       		.uleb128 0x1f
+ 1447 0087 1B       		.uleb128 0x1b
+ 1448 0088 1F       		.uleb128 0x1f
+ 1449 0089 10       		.uleb128 0x10
+ 1450 008a 17       		.uleb128 0x17
+ 1451 008b 00       		.byte	0
+ 1452 008c 00       		.byte	0
+ 1453 008d 0B       		.uleb128 0xb
+ 1454 008e 24       		.uleb128 0x24
+ 1455 008f 00       		.byte	0
+ 1456 0090 0B       		.uleb128 0xb
+ 1457 0091 0B       		.uleb128 0xb
+ 1458 0092 3E       		.uleb128 0x3e
+ 1459 0093 0B       		.uleb128 0xb
+ 1460 0094 03       		.uleb128 0x3
+ 1461 0095 08       		.uleb128 0x8
+ 1462 0096 00       		.byte	0
+ 1463 0097 00       		.byte	0
+GAS LISTING /tmp/ccvPZOGL.s 			page 67
+
+
+ 1464 0098 0C       		.uleb128 0xc
+ 1465 0099 13       		.uleb128 0x13
+ 1466 009a 01       		.byte	0x1
+ 1467 009b 0B       		.uleb128 0xb
+ 1468 009c 0B       		.uleb128 0xb
+ 1469 009d 3A       		.uleb128 0x3a
+ 1470 009e 0B       		.uleb128 0xb
+ 1471 009f 3B       		.uleb128 0x3b
+ 1472 00a0 0B       		.uleb128 0xb
+ 1473 00a1 39       		.uleb128 0x39
+ 1474 00a2 0B       		.uleb128 0xb
+ 1475 00a3 01       		.uleb128 0x1
+ 1476 00a4 13       		.uleb128 0x13
+ 1477 00a5 00       		.byte	0
+ 1478 00a6 00       		.byte	0
+ 1479 00a7 0D       		.uleb128 0xd
+ 1480 00a8 21       		.uleb128 0x21
+ 1481 00a9 00       		.byte	0
+ 1482 00aa 49       		.uleb128 0x49
+ 1483 00ab 13       		.uleb128 0x13
+ 1484 00ac 2F       		.uleb128 0x2f
+ 1485 00ad 0B       		.uleb128 0xb
+ 1486 00ae 00       		.byte	0
+ 1487 00af 00       		.byte	0
+ 1488 00b0 0E       		.uleb128 0xe
+ 1489 00b1 21       		.uleb128 0x21
+ 1490 00b2 00       		.byte	0
+ 1491 00b3 49       		.uleb128 0x49
+ 1492 00b4 13       		.uleb128 0x13
+ 1493 00b5 2F       		.uleb128 0x2f
+ 1494 00b6 05       		.uleb128 0x5
+ 1495 00b7 00       		.byte	0
+ 1496 00b8 00       		.byte	0
+ 1497 00b9 00       		.byte	0
+ 1498              		.section	.debug_aranges,"",@progbits
+ 1499 0000 1C000000 		.long	0x1c
+ 1500 0004 0200     		.value	0x2
+ 1501 0006 00000000 		.long	.Ldebug_info0
+ 1502 000a 08       		.byte	0x8
+ 1503 000b 00       		.byte	0
+ 1504 000c 0000     		.value	0
+ 1505 000e 0000     		.value	0
+ 1506 0010 00000000 		.quad	0
+ 1506      00000000 
+ 1507 0018 00000000 		.quad	0
+ 1507      00000000 
+ 1508              		.section	.debug_line,"",@progbits
+ 1509              	.Ldebug_line0:
+ 1510 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1510      05000800 
+ 1510      49000000 
+ 1510      010101FB 
+ 1510      0E0D0001 
+ 1511              	.LASF20:
+ 1512 0000 736F6674 		.string	"soft_data"
+ 1512      5F646174 
+ 1512      6100
+GAS LISTING /tmp/ccvPZOGL.s 			page 68
+
+
+ 1513              	.LASF12:
+ 1514 000a 73697A65 		.string	"size_t"
+ 1514      5F7400
+ 1515              	.LASF13:
+ 1516 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1516      6D61705F 
+ 1516      636F6C6F 
+ 1516      72736368 
+ 1516      656D655F 
+ 1517              	.LASF17:
+ 1518 0027 68656174 		.string	"heatmap_cs_PuRd_mixed_exp"
+ 1518      6D61705F 
+ 1518      63735F50 
+ 1518      7552645F 
+ 1518      6D697865 
+ 1519              	.LASF14:
+ 1520 0041 68656174 		.string	"heatmap_cs_PuRd_discrete"
+ 1520      6D61705F 
+ 1520      63735F50 
+ 1520      7552645F 
+ 1520      64697363 
+ 1521              	.LASF26:
+ 1522 005a 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1522      43313720 
+ 1522      31322E32 
+ 1522      2E30202D 
+ 1522      6D74756E 
+ 1523              	.LASF6:
+ 1524 00b9 666C6F61 		.string	"float"
+ 1524      7400
+ 1525              	.LASF11:
+ 1526 00bf 756E7369 		.string	"unsigned char"
+ 1526      676E6564 
+ 1526      20636861 
+ 1526      7200
+ 1527              	.LASF3:
+ 1528 00cd 6C6F6E67 		.string	"long unsigned int"
+ 1528      20756E73 
+ 1528      69676E65 
+ 1528      6420696E 
+ 1528      7400
+ 1529              	.LASF8:
+ 1530 00df 73686F72 		.string	"short unsigned int"
+ 1530      7420756E 
+ 1530      7369676E 
+ 1530      65642069 
+ 1530      6E7400
+ 1531              	.LASF15:
+ 1532 00f2 68656174 		.string	"heatmap_cs_PuRd_soft"
+ 1532      6D61705F 
+ 1532      63735F50 
+ 1532      7552645F 
+ 1532      736F6674 
+ 1533              	.LASF23:
+ 1534 0107 6D697865 		.string	"mixed"
+ 1534      6400
+ 1535              	.LASF16:
+GAS LISTING /tmp/ccvPZOGL.s 			page 69
+
+
+ 1536 010d 68656174 		.string	"heatmap_cs_PuRd_mixed"
+ 1536      6D61705F 
+ 1536      63735F50 
+ 1536      7552645F 
+ 1536      6D697865 
+ 1537              	.LASF7:
+ 1538 0123 756E7369 		.string	"unsigned int"
+ 1538      676E6564 
+ 1538      20696E74 
+ 1538      00
+ 1539              	.LASF19:
+ 1540 0130 64697363 		.string	"discrete"
+ 1540      72657465 
+ 1540      00
+ 1541              	.LASF10:
+ 1542 0139 6E636F6C 		.string	"ncolors"
+ 1542      6F727300 
+ 1543              	.LASF4:
+ 1544 0141 6C6F6E67 		.string	"long long int"
+ 1544      206C6F6E 
+ 1544      6720696E 
+ 1544      7400
+ 1545              	.LASF25:
+ 1546 014f 6D697865 		.string	"mixed_exp"
+ 1546      645F6578 
+ 1546      7000
+ 1547              	.LASF24:
+ 1548 0159 6D697865 		.string	"mixed_exp_data"
+ 1548      645F6578 
+ 1548      705F6461 
+ 1548      746100
+ 1549              	.LASF22:
+ 1550 0168 6D697865 		.string	"mixed_data"
+ 1550      645F6461 
+ 1550      746100
+ 1551              	.LASF2:
+ 1552 0173 6C6F6E67 		.string	"long int"
+ 1552      20696E74 
+ 1552      00
+ 1553              	.LASF5:
+ 1554 017c 6C6F6E67 		.string	"long double"
+ 1554      20646F75 
+ 1554      626C6500 
+ 1555              	.LASF18:
+ 1556 0188 64697363 		.string	"discrete_data"
+ 1556      72657465 
+ 1556      5F646174 
+ 1556      6100
+ 1557              	.LASF21:
+ 1558 0196 736F6674 		.string	"soft"
+ 1558      00
+ 1559              	.LASF9:
+ 1560 019b 636F6C6F 		.string	"colors"
+ 1560      727300
+ 1561              		.section	.debug_line_str,"MS",@progbits,1
+ 1562              	.LASF1:
+ 1563 0000 2F726F6F 		.string	"/root/repo"
+GAS LISTING /tmp/ccvPZOGL.s 			page 70
+
+
+ 1563      742F7265 
+ 1563      706F00
+ 1564              	.LASF0:
+ 1565 000b 636F6C6F 		.string	"colorschemes/PuRd.c"
+ 1565      72736368 
+ 1565      656D6573 
+ 1565      2F507552 
+ 1565      642E6300 
+ 1566              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1567 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1567      742F7265 
+ 1567      706F0063 
+ 1567      6F6C6F72 
+ 1567      73636865 
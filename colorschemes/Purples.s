@@ -0,0 +1,4028 @@
+GAS LISTING /tmp/cc4tpqxY.s 			page 1
+
+
+   1              		.file	"Purples.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/Purples.c"
+   5              		.globl	heatmap_cs_Purples_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_Purples_mixed_exp, @object
+   9              		.size	heatmap_cs_Purples_mixed_exp, 8
+  10              	heatmap_cs_Purples_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 3F00     		.string	"?"
+  29 0006 7D00     		.string	"}"
+  30 0008 40027E18 		.ascii	"@\002~\030A\005\1771B\t\200JD\013\201cE\016\202|F\020\203\225"
+  30      41057F31 
+  30      4209804A 
+  30      440B8163 
+  30      450E827C 
+  31 0020 4C1A88AE 		.ascii	"L\032\210\256M\034\211\307N\036\212\340O \213\371P\"\214\377"
+  31      4D1C89C7 
+  31      4E1E8AE0 
+  31      4F208BF9 
+  31      50228CFF 
+  32 0034 52248DFF 		.ascii	"R$\215\377S&\216\377T(\217\377U*\220\377V-\221\377W/\222\377"
+  32      53268EFF 
+  32      54288FFF 
+  32      552A90FF 
+  32      562D91FF 
+  33 004c 593194FF 		.ascii	"Y1\224\377Z4\225\377[6\226\377\\8\227\377aB\234\377cE\235\377"
+  33      5A3495FF 
+  33      5B3696FF 
+  33      5C3897FF 
+  33      61429CFF 
+  34 0064 64479EFF 		.ascii	"dG\236\377eI\237\377fK\240\377gM\241\377hO\242\377iP\242\377"
+  34      65499FFF 
+  34      664BA0FF 
+  34      674DA1FF 
+  34      684FA2FF 
+GAS LISTING /tmp/cc4tpqxY.s 			page 2
+
+
+  35 007c 6A53A4FF 		.ascii	"jS\244\377kU\245\377lW\246\377mY\247\377n[\250\377o]\252\377"
+  35      6B55A5FF 
+  35      6C57A6FF 
+  35      6D59A7FF 
+  35      6E5BA8FF 
+  36 0094 705FABFF 		.ascii	"p_\253\377qa\254\377vl\261\377wn\262\377xp\263\377yr\264\377"
+  36      7161ACFF 
+  36      766CB1FF 
+  36      776EB2FF 
+  36      7870B3FF 
+  37 00ac 7A73B5FF 		.ascii	"zs\265\377{u\266\377|w\267\377}y\270\377~{\271\377\177|\271\377"
+  37      7B75B6FF 
+  37      7C77B7FF 
+  37      7D79B8FF 
+  37      7E7BB9FF 
+  38 00c4 817EBAFF 		.ascii	"\201~\272\377\202\177\273\377\203\200\273\377\204\201\274\377"
+  38      827FBBFF 
+  38      8380BBFF 
+  38      8481BCFF 
+  39 00d4 8682BCFF 		.ascii	"\206\202\274\377\207\203\275\377\210\204\275\377\211\206\276"
+  39      8783BDFF 
+  39      8884BDFF 
+  39      8986BE
+  40 00e3 FF8A87BE 		.ascii	"\377\212\207\276\377\213\210\277\377\222\217\302\377\224\220"
+  40      FF8B88BF 
+  40      FF928FC2 
+  40      FF9490
+  41 00f2 C3FF9591 		.ascii	"\303\377\225\221\303\377\226\222\304\377\227\223\304\377\230"
+  41      C3FF9692 
+  41      C4FF9793 
+  41      C4FF98
+  42 0101 94C5FF99 		.ascii	"\224\305\377\231\225\305\377\232\226\306\377\233\227\306\377"
+  42      95C5FF9A 
+  42      96C6FF9B 
+  42      97C6FF
+  43 0110 9C98C7FF 		.ascii	"\234\230\307\377\235\231\307\377\236\232\310\377\237\233\310"
+  43      9D99C7FF 
+  43      9E9AC8FF 
+  43      9F9BC8
+  44 011f FFA09CC9 		.ascii	"\377\240\234\311\377\241\235\312\377\242\237\312\377\243\240"
+  44      FFA19DCA 
+  44      FFA29FCA 
+  44      FFA3A0
+  45 012e CBFFA3A1 		.ascii	"\313\377\243\241\314\377\244\242\314\377\245\243\315\377\246"
+  45      CCFFA4A2 
+  45      CCFFA5A3 
+  45      CDFFA6
+  46 013d A4CEFFA7 		.ascii	"\244\316\377\247\245\316\377\250\246\317\377\251\247\317\377"
+  46      A5CEFFA8 
+  46      A6CFFFA9 
+  46      A7CFFF
+  47 014c B0AFD4FF 		.ascii	"\260\257\324\377\261\260\325\377\262\261\325\377\262\262\326"
+  47      B1B0D5FF 
+  47      B2B1D5FF 
+  47      B2B2D6
+  48 015b FFB3B3D6 		.ascii	"\377\263\263\326\377\264\264\327\377\265\265\327\377\266\266"
+  48      FFB4B4D7 
+GAS LISTING /tmp/cc4tpqxY.s 			page 3
+
+
+  48      FFB5B5D7 
+  48      FFB6B6
+  49 016a D8FFB7B7 		.ascii	"\330\377\267\267\331\377\270\270\331\377\270\271\332\377\271"
+  49      D9FFB8B8 
+  49      D9FFB8B9 
+  49      DAFFB9
+  50 0179 BADAFFBA 		.ascii	"\272\332\377\272\273\333\377\273\274\333\377\274\275\334\377"
+  50      BBDBFFBB 
+  50      BCDBFFBC 
+  50      BDDCFF
+  51 0188 BDBDDCFF 		.ascii	"\275\275\334\377\275\276\334\377\276\277\335\377\277\300\335"
+  51      BDBEDCFF 
+  51      BEBFDDFF 
+  51      BFC0DD
+  52 0197 FFC0C0DE 		.ascii	"\377\300\300\336\377\300\301\336\377\301\302\336\377\302\302"
+  52      FFC0C1DE 
+  52      FFC1C2DE 
+  52      FFC2C2
+  53 01a6 DFFFC2C3 		.ascii	"\337\377\302\303\337\377\303\304\337\377\304\304\340\377\305"
+  53      DFFFC3C4 
+  53      DFFFC4C4 
+  53      E0FFC5
+  54 01b5 C5E0FFC5 		.ascii	"\305\340\377\305\306\340\377\306\306\341\377\307\307\341\377"
+  54      C6E0FFC6 
+  54      C6E1FFC7 
+  54      C7E1FF
+  55 01c4 C7C8E1FF 		.ascii	"\307\310\341\377\316\316\345\377\317\317\345\377\317\317\345"
+  55      CECEE5FF 
+  55      CFCFE5FF 
+  55      CFCFE5
+  56 01d3 FFD0D0E6 		.ascii	"\377\320\320\346\377\320\321\346\377\321\321\346\377\322\322"
+  56      FFD0D1E6 
+  56      FFD1D1E6 
+  56      FFD2D2
+  57 01e2 E7FFD2D2 		.ascii	"\347\377\322\322\347\377\323\323\347\377\324\324\347\377\324"
+  57      E7FFD3D3 
+  57      E7FFD4D4 
+  57      E7FFD4
+  58 01f1 D4E8FFD5 		.ascii	"\324\350\377\325\325\350\377\325\325\350\377\326\326\351\377"
+  58      D5E8FFD5 
+  58      D5E8FFD6 
+  58      D6E9FF
+  59 0200 D6D6E9FF 		.ascii	"\326\326\351\377\327\327\351\377\330\330\352\377\330\330\352"
+  59      D7D7E9FF 
+  59      D8D8EAFF 
+  59      D8D8EA
+  60 020f FFD9D9EA 		.ascii	"\377\331\331\352\377\331\331\352\377\332\332\353\377\332\332"
+  60      FFD9D9EA 
+  60      FFDADAEB 
+  60      FFDADA
+  61 021e EBFFDADA 		.ascii	"\353\377\332\332\353\377\333\333\353\377\333\333\353\377\334"
+  61      EBFFDBDB 
+  61      EBFFDBDB 
+  61      EBFFDC
+  62 022d DBEBFFDC 		.ascii	"\333\353\377\334\334\354\377\334\334\354\377\335\334\354\377"
+  62      DCECFFDC 
+  62      DCECFFDD 
+GAS LISTING /tmp/cc4tpqxY.s 			page 4
+
+
+  62      DCECFF
+  63 023c DDDCECFF 		.ascii	"\335\334\354\377\335\335\354\377\336\335\354\377\336\335\355"
+  63      DDDDECFF 
+  63      DEDDECFF 
+  63      DEDDED
+  64 024b FFDFDEED 		.ascii	"\377\337\336\355\377\337\336\355\377\337\336\355\377\340\337"
+  64      FFDFDEED 
+  64      FFDFDEED 
+  64      FFE0DF
+  65 025a EDFFE0DF 		.ascii	"\355\377\340\337\355\377\340\337\355\377\340\337\356\377\341"
+  65      EDFFE0DF 
+  65      EDFFE0DF 
+  65      EEFFE1
+  66 0269 E0EEFFE1 		.ascii	"\340\356\377\341\340\356\377\341\340\356\377\342\340\356\377"
+  66      E0EEFFE1 
+  66      E0EEFFE2 
+  66      E0EEFF
+  67 0278 E2E1EEFF 		.ascii	"\342\341\356\377\346\345\360\377\347\345\361\377\347\345\361"
+  67      E6E5F0FF 
+  67      E7E5F1FF 
+  67      E7E5F1
+  68 0287 FFE7E6F1 		.ascii	"\377\347\346\361\377\350\346\361\377\350\346\361\377\350\346"
+  68      FFE8E6F1 
+  68      FFE8E6F1 
+  68      FFE8E6
+  69 0296 F1FFE8E7 		.ascii	"\361\377\350\347\361\377\351\347\361\377\351\347\362\377\351"
+  69      F1FFE9E7 
+  69      F1FFE9E7 
+  69      F2FFE9
+  70 02a5 E7F2FFE9 		.ascii	"\347\362\377\351\350\362\377\352\350\362\377\352\350\362\377"
+  70      E8F2FFEA 
+  70      E8F2FFEA 
+  70      E8F2FF
+  71 02b4 EAE8F2FF 		.ascii	"\352\350\362\377\352\350\362\377\353\351\362\377\353\351\363"
+  71      EAE8F2FF 
+  71      EBE9F2FF 
+  71      EBE9F3
+  72 02c3 FFEBE9F3 		.ascii	"\377\353\351\363\377\353\351\363\377\354\352\363\377\354\352"
+  72      FFEBE9F3 
+  72      FFECEAF3 
+  72      FFECEA
+  73 02d2 F3FFECEA 		.ascii	"\363\377\354\352\363\377\354\352\363\377\354\352\363\377\355"
+  73      F3FFECEA 
+  73      F3FFECEA 
+  73      F3FFED
+  74 02e1 EBF4FFED 		.ascii	"\353\364\377\355\353\364\377\355\353\364\377\355\353\364\377"
+  74      EBF4FFED 
+  74      EBF4FFED 
+  74      EBF4FF
+  75 02f0 EDEBF4FF 		.ascii	"\355\353\364\377\356\354\364\377\356\354\364\377\356\354\364"
+  75      EEECF4FF 
+  75      EEECF4FF 
+  75      EEECF4
+  76 02ff FFEEECF4 		.ascii	"\377\356\354\364\377\356\354\364\377\357\355\365\377\357\355"
+  76      FFEEECF4 
+  76      FFEFEDF5 
+  76      FFEFED
+GAS LISTING /tmp/cc4tpqxY.s 			page 5
+
+
+  77 030e F5FFEFED 		.ascii	"\365\377\357\355\365\377\357\355\365\377\357\355\365\377\357"
+  77      F5FFEFED 
+  77      F5FFEFED 
+  77      F5FFEF
+  78 031d EDF5FFEF 		.ascii	"\355\365\377\357\355\365\377\357\355\365\377\360\356\365\377"
+  78      EDF5FFEF 
+  78      EDF5FFF0 
+  78      EEF5FF
+  79 032c F0EEF5FF 		.ascii	"\360\356\365\377\360\356\365\377\360\356\365\377\360\356\365"
+  79      F0EEF5FF 
+  79      F0EEF5FF 
+  79      F0EEF5
+  80 033b FFF0EEF5 		.ascii	"\377\360\356\365\377\360\356\365\377\360\356\366\377\361\357"
+  80      FFF0EEF5 
+  80      FFF0EEF6 
+  80      FFF1EF
+  81 034a F6FFF1EF 		.ascii	"\366\377\361\357\366\377\361\357\366\377\361\357\366\377\361"
+  81      F6FFF1EF 
+  81      F6FFF1EF 
+  81      F6FFF1
+  82 0359 EFF6FFF1 		.ascii	"\357\366\377\361\357\366\377\361\357\366\377\361\357\366\377"
+  82      EFF6FFF1 
+  82      EFF6FFF1 
+  82      EFF6FF
+  83 0368 F1EFF6FF 		.ascii	"\361\357\366\377\361\357\366\377\362\360\366\377\362\360\366"
+  83      F1EFF6FF 
+  83      F2F0F6FF 
+  83      F2F0F6
+  84 0377 FFF2F0F6 		.ascii	"\377\362\360\366\377\362\360\366\377\362\360\366\377\362\360"
+  84      FFF2F0F6 
+  84      FFF2F0F6 
+  84      FFF2F0
+  85 0386 F6FFF2F0 		.ascii	"\366\377\362\360\367\377\362\360\367\377\362\360\367\377\362"
+  85      F7FFF2F0 
+  85      F7FFF2F0 
+  85      F7FFF2
+  86 0395 F0F7FFF2 		.ascii	"\360\367\377\362\361\367\377\363\361\367\377\363\361\367\377"
+  86      F1F7FFF3 
+  86      F1F7FFF3 
+  86      F1F7FF
+  87 03a4 F3F1F7FF 		.ascii	"\363\361\367\377\363\361\367\377\363\361\367\377\363\361\367"
+  87      F3F1F7FF 
+  87      F3F1F7FF 
+  87      F3F1F7
+  88 03b3 FFF3F1F7 		.ascii	"\377\363\361\367\377\363\361\367\377\363\361\367\377\363\361"
+  88      FFF3F1F7 
+  88      FFF3F1F7 
+  88      FFF3F1
+  89 03c2 F7FFF3F1 		.ascii	"\367\377\363\361\367\377\363\362\367\377\363\362\367\377\364"
+  89      F7FFF3F2 
+  89      F7FFF3F2 
+  89      F7FFF4
+  90 03d1 F2F7FFF4 		.ascii	"\362\367\377\364\362\367\377\364\362\367\377\364\362\370\377"
+  90      F2F7FFF4 
+  90      F2F7FFF4 
+  90      F2F8FF
+  91 03e0 F4F2F8FF 		.ascii	"\364\362\370\377\367\365\371\377\367\365\371\377\367\365\371"
+GAS LISTING /tmp/cc4tpqxY.s 			page 6
+
+
+  91      F7F5F9FF 
+  91      F7F5F9FF 
+  91      F7F5F9
+  92 03ef FFF7F5F9 		.ascii	"\377\367\365\371\377\367\365\371\377\367\365\371\377\367\365"
+  92      FFF7F5F9 
+  92      FFF7F5F9 
+  92      FFF7F5
+  93 03fe F9FFF7F5 		.ascii	"\371\377\367\365\371\377\367\365\372\377\367\365\372\377\367"
+  93      F9FFF7F5 
+  93      FAFFF7F5 
+  93      FAFFF7
+  94 040d F6FAFFF7 		.ascii	"\366\372\377\367\366\372\377\367\366\372\377\367\366\372\377"
+  94      F6FAFFF7 
+  94      F6FAFFF7 
+  94      F6FAFF
+  95 041c F7F6FAFF 		.ascii	"\367\366\372\377\367\366\372\377\367\366\372\377\370\366\372"
+  95      F7F6FAFF 
+  95      F7F6FAFF 
+  95      F8F6FA
+  96 042b FFF8F6FA 		.ascii	"\377\370\366\372\377\370\366\372\377\370\366\372\377\370\366"
+  96      FFF8F6FA 
+  96      FFF8F6FA 
+  96      FFF8F6
+  97 043a FAFFF8F6 		.ascii	"\372\377\370\366\372\377\370\366\372\377\370\366\372\377\370"
+  97      FAFFF8F6 
+  97      FAFFF8F6 
+  97      FAFFF8
+  98 0449 F6FAFFF8 		.ascii	"\366\372\377\370\366\372\377\370\367\372\377\370\367\372\377"
+  98      F6FAFFF8 
+  98      F7FAFFF8 
+  98      F7FAFF
+  99 0458 F8F7FAFF 		.ascii	"\370\367\372\377\370\367\372\377\370\367\372\377\370\367\372"
+  99      F8F7FAFF 
+  99      F8F7FAFF 
+  99      F8F7FA
+ 100 0467 FFF8F7FA 		.ascii	"\377\370\367\372\377\370\367\372\377\370\367\372\377\370\367"
+ 100      FFF8F7FA 
+ 100      FFF8F7FA 
+ 100      FFF8F7
+ 101 0476 FAFFF8F7 		.ascii	"\372\377\370\367\372\377\371\367\372\377\371\367\373\377\371"
+ 101      FAFFF9F7 
+ 101      FAFFF9F7 
+ 101      FBFFF9
+ 102 0485 F7FBFFF9 		.ascii	"\367\373\377\371\367\373\377\371\367\373\377\371\367\373\377"
+ 102      F7FBFFF9 
+ 102      F7FBFFF9 
+ 102      F7FBFF
+ 103 0494 F9F7FBFF 		.ascii	"\371\367\373\377\371\367\373\377\371\367\373\377\371\367\373"
+ 103      F9F7FBFF 
+ 103      F9F7FBFF 
+ 103      F9F7FB
+ 104 04a3 FFF9F7FB 		.ascii	"\377\371\367\373\377\371\370\373\377\371\370\373\377\371\370"
+ 104      FFF9F8FB 
+ 104      FFF9F8FB 
+ 104      FFF9F8
+ 105 04b2 FBFFF9F8 		.ascii	"\373\377\371\370\373\377\371\370\373\377\371\370\373\377\371"
+ 105      FBFFF9F8 
+GAS LISTING /tmp/cc4tpqxY.s 			page 7
+
+
+ 105      FBFFF9F8 
+ 105      FBFFF9
+ 106 04c1 F8FBFFF9 		.ascii	"\370\373\377\371\370\373\377\371\370\373\377\371\370\373\377"
+ 106      F8FBFFF9 
+ 106      F8FBFFF9 
+ 106      F8FBFF
+ 107 04d0 F9F8FBFF 		.ascii	"\371\370\373\377\371\370\373\377\371\370\373\377\371\370\373"
+ 107      F9F8FBFF 
+ 107      F9F8FBFF 
+ 107      F9F8FB
+ 108 04df FFF9F8FB 		.ascii	"\377\371\370\373\377\371\370\373\377\371\370\373\377\372\370"
+ 108      FFF9F8FB 
+ 108      FFF9F8FB 
+ 108      FFFAF8
+ 109 04ee FBFFFAF8 		.ascii	"\373\377\372\370\373\377\372\370\373\377\372\370\373\377\372"
+ 109      FBFFFAF8 
+ 109      FBFFFAF8 
+ 109      FBFFFA
+ 110 04fd F8FBFFFA 		.ascii	"\370\373\377\372\370\373\377\372\370\373\377\372\370\373\377"
+ 110      F8FBFFFA 
+ 110      F8FBFFFA 
+ 110      F8FBFF
+ 111 050c FAF8FBFF 		.ascii	"\372\370\373\377\372\370\373\377\372\370\373\377\372\370\373"
+ 111      FAF8FBFF 
+ 111      FAF8FBFF 
+ 111      FAF8FB
+ 112 051b FFFAF9FB 		.ascii	"\377\372\371\373\377\372\371\373\377\372\371\373\377\372\371"
+ 112      FFFAF9FB 
+ 112      FFFAF9FB 
+ 112      FFFAF9
+ 113 052a FBFFFAF9 		.ascii	"\373\377\372\371\373\377\372\371\373\377\372\371\373\377\372"
+ 113      FBFFFAF9 
+ 113      FBFFFAF9 
+ 113      FBFFFA
+ 114 0539 F9FBFFFA 		.ascii	"\371\373\377\372\371\373\377\372\371\373\377\372\371\373\377"
+ 114      F9FBFFFA 
+ 114      F9FBFFFA 
+ 114      F9FBFF
+ 115 0548 FAF9FCFF 		.ascii	"\372\371\374\377\372\371\374\377\372\371\374\377\372\371\374"
+ 115      FAF9FCFF 
+ 115      FAF9FCFF 
+ 115      FAF9FC
+ 116 0557 FFFAF9FC 		.ascii	"\377\372\371\374\377\372\371\374\377\372\371\374\377\372\371"
+ 116      FFFAF9FC 
+ 116      FFFAF9FC 
+ 116      FFFAF9
+ 117 0566 FCFFFAF9 		.ascii	"\374\377\372\371\374\377\372\371\374\377\372\371\374\377\372"
+ 117      FCFFFAF9 
+ 117      FCFFFAF9 
+ 117      FCFFFA
+ 118 0575 F9FCFFFA 		.ascii	"\371\374\377\372\371\374\377\372\371\374\377\372\371\374\377"
+ 118      F9FCFFFA 
+ 118      F9FCFFFA 
+ 118      F9FCFF
+ 119 0584 FAF9FCFF 		.ascii	"\372\371\374\377\372\371\374\377\372\371\374\377\372\371\374"
+ 119      FAF9FCFF 
+ 119      FAF9FCFF 
+GAS LISTING /tmp/cc4tpqxY.s 			page 8
+
+
+ 119      FAF9FC
+ 120 0593 FFFAF9FC 		.ascii	"\377\372\371\374\377\372\371\374\377\372\371\374\377\372\371"
+ 120      FFFAF9FC 
+ 120      FFFAF9FC 
+ 120      FFFAF9
+ 121 05a2 FCFFFAF9 		.ascii	"\374\377\372\371\374\377\373\371\374\377\373\371\374\377\373"
+ 121      FCFFFBF9 
+ 121      FCFFFBF9 
+ 121      FCFFFB
+ 122 05b1 F9FCFFFB 		.ascii	"\371\374\377\373\371\374\377\373\371\374\377\373\371\374\377"
+ 122      F9FCFFFB 
+ 122      F9FCFFFB 
+ 122      F9FCFF
+ 123 05c0 FBF9FCFF 		.ascii	"\373\371\374\377\373\371\374\377\373\371\374\377\373\371\374"
+ 123      FBF9FCFF 
+ 123      FBF9FCFF 
+ 123      FBF9FC
+ 124 05cf FFFBF9FC 		.ascii	"\377\373\371\374\377\373\371\374\377\373\372\374\377\373\372"
+ 124      FFFBF9FC 
+ 124      FFFBFAFC 
+ 124      FFFBFA
+ 125 05de FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 125      FCFFFBFA 
+ 125      FCFFFBFA 
+ 125      FCFFFB
+ 126 05ed FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 126      FAFCFFFB 
+ 126      FAFCFFFB 
+ 126      FAFCFF
+ 127 05fc FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 127      FBFAFCFF 
+ 127      FBFAFCFF 
+ 127      FBFAFC
+ 128 060b FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 128      FFFBFAFC 
+ 128      FFFBFAFC 
+ 128      FFFBFA
+ 129 061a FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 129      FCFFFBFA 
+ 129      FCFFFBFA 
+ 129      FCFFFB
+ 130 0629 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 130      FAFCFFFB 
+ 130      FAFCFFFB 
+ 130      FAFCFF
+ 131 0638 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 131      FBFAFCFF 
+ 131      FBFAFCFF 
+ 131      FBFAFC
+ 132 0647 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 132      FFFBFAFC 
+ 132      FFFBFAFC 
+ 132      FFFBFA
+ 133 0656 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 133      FCFFFBFA 
+ 133      FCFFFBFA 
+ 133      FCFFFB
+GAS LISTING /tmp/cc4tpqxY.s 			page 9
+
+
+ 134 0665 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 134      FAFCFFFB 
+ 134      FAFCFFFB 
+ 134      FAFCFF
+ 135 0674 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 135      FBFAFCFF 
+ 135      FBFAFCFF 
+ 135      FBFAFC
+ 136 0683 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 136      FFFBFAFC 
+ 136      FFFBFAFC 
+ 136      FFFBFA
+ 137 0692 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 137      FCFFFBFA 
+ 137      FCFFFBFA 
+ 137      FCFFFB
+ 138 06a1 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 138      FAFCFFFB 
+ 138      FAFCFFFB 
+ 138      FAFCFF
+ 139 06b0 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 139      FBFAFCFF 
+ 139      FBFAFCFF 
+ 139      FBFAFC
+ 140 06bf FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 140      FFFBFAFC 
+ 140      FFFBFAFC 
+ 140      FFFBFA
+ 141 06ce FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 141      FCFFFBFA 
+ 141      FCFFFBFA 
+ 141      FCFFFB
+ 142 06dd FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 142      FAFCFFFB 
+ 142      FAFCFFFB 
+ 142      FAFCFF
+ 143 06ec FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 143      FBFAFCFF 
+ 143      FBFAFCFF 
+ 143      FBFAFC
+ 144 06fb FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 144      FFFBFAFC 
+ 144      FFFBFAFC 
+ 144      FFFBFA
+ 145 070a FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 145      FCFFFBFA 
+ 145      FCFFFBFA 
+ 145      FCFFFB
+ 146 0719 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 146      FAFCFFFB 
+ 146      FAFCFFFB 
+ 146      FAFCFF
+ 147 0728 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 147      FBFAFCFF 
+ 147      FBFAFCFF 
+ 147      FBFAFC
+ 148 0737 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+GAS LISTING /tmp/cc4tpqxY.s 			page 10
+
+
+ 148      FFFBFAFC 
+ 148      FFFBFAFC 
+ 148      FFFBFA
+ 149 0746 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 149      FCFFFBFA 
+ 149      FCFFFBFA 
+ 149      FCFFFB
+ 150 0755 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 150      FAFCFFFB 
+ 150      FAFCFFFB 
+ 150      FAFCFF
+ 151 0764 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 151      FBFAFCFF 
+ 151      FBFAFCFF 
+ 151      FBFAFC
+ 152 0773 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 152      FFFBFAFC 
+ 152      FFFBFAFC 
+ 152      FFFBFA
+ 153 0782 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 153      FCFFFBFA 
+ 153      FCFFFBFA 
+ 153      FCFFFB
+ 154 0791 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 154      FAFCFFFB 
+ 154      FAFCFFFB 
+ 154      FAFCFF
+ 155 07a0 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 155      FBFAFCFF 
+ 155      FBFAFCFF 
+ 155      FBFAFC
+ 156 07af FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 156      FFFBFAFC 
+ 156      FFFBFAFC 
+ 156      FFFBFA
+ 157 07be FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 157      FCFFFBFA 
+ 157      FCFFFBFA 
+ 157      FCFFFB
+ 158 07cd FAFCFF   		.ascii	"\372\374\377"
+ 159 07d0 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 159      FBFAFCFF 
+ 159      FBFAFCFF 
+ 159      FBFAFC
+ 160 07df FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 160      FFFBFAFC 
+ 160      FFFBFAFC 
+ 160      FFFBFA
+ 161 07ee FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 161      FCFFFBFA 
+ 161      FCFFFBFA 
+ 161      FCFFFB
+ 162 07fd FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 162      FAFCFFFB 
+ 162      FAFCFFFB 
+ 162      FAFCFF
+ 163 080c FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+GAS LISTING /tmp/cc4tpqxY.s 			page 11
+
+
+ 163      FBFAFCFF 
+ 163      FBFAFCFF 
+ 163      FBFAFC
+ 164 081b FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 164      FFFBFAFC 
+ 164      FFFBFAFC 
+ 164      FFFBFA
+ 165 082a FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 165      FCFFFBFA 
+ 165      FCFFFBFA 
+ 165      FCFFFB
+ 166 0839 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 166      FAFCFFFB 
+ 166      FAFCFFFB 
+ 166      FAFCFF
+ 167 0848 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 167      FBFAFCFF 
+ 167      FBFAFCFF 
+ 167      FBFAFC
+ 168 0857 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 168      FFFBFAFC 
+ 168      FFFBFAFC 
+ 168      FFFBFA
+ 169 0866 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 169      FCFFFBFA 
+ 169      FCFFFBFA 
+ 169      FCFFFB
+ 170 0875 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 170      FAFCFFFB 
+ 170      FAFCFFFB 
+ 170      FAFCFF
+ 171 0884 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 171      FBFAFCFF 
+ 171      FBFAFCFF 
+ 171      FBFAFC
+ 172 0893 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 172      FFFBFAFC 
+ 172      FFFBFAFC 
+ 172      FFFBFA
+ 173 08a2 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 173      FCFFFBFA 
+ 173      FCFFFBFA 
+ 173      FCFFFB
+ 174 08b1 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 174      FAFCFFFB 
+ 174      FAFCFFFB 
+ 174      FAFCFF
+ 175 08c0 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 175      FBFAFCFF 
+ 175      FBFAFCFF 
+ 175      FBFAFC
+ 176 08cf FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 176      FFFBFAFC 
+ 176      FFFBFAFC 
+ 176      FFFBFA
+ 177 08de FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 177      FCFFFBFA 
+GAS LISTING /tmp/cc4tpqxY.s 			page 12
+
+
+ 177      FCFFFBFA 
+ 177      FCFFFB
+ 178 08ed FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 178      FAFCFFFB 
+ 178      FAFCFFFB 
+ 178      FAFCFF
+ 179 08fc FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 179      FBFAFCFF 
+ 179      FBFAFCFF 
+ 179      FBFAFC
+ 180 090b FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 180      FFFBFAFC 
+ 180      FFFBFAFC 
+ 180      FFFBFA
+ 181 091a FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 181      FCFFFBFA 
+ 181      FCFFFBFA 
+ 181      FCFFFB
+ 182 0929 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 182      FAFCFFFB 
+ 182      FAFCFFFB 
+ 182      FAFCFF
+ 183 0938 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 183      FBFAFCFF 
+ 183      FBFAFCFF 
+ 183      FBFAFC
+ 184 0947 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 184      FFFBFAFC 
+ 184      FFFBFAFC 
+ 184      FFFBFA
+ 185 0956 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 185      FCFFFBFA 
+ 185      FCFFFBFA 
+ 185      FCFFFB
+ 186 0965 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 186      FAFCFFFB 
+ 186      FAFCFFFB 
+ 186      FAFCFF
+ 187 0974 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 187      FBFAFCFF 
+ 187      FBFAFCFF 
+ 187      FBFAFC
+ 188 0983 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 188      FFFBFAFC 
+ 188      FFFBFAFC 
+ 188      FFFBFA
+ 189 0992 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 189      FCFFFBFA 
+ 189      FCFFFBFA 
+ 189      FCFFFB
+ 190 09a1 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 190      FAFCFFFB 
+ 190      FAFCFFFB 
+ 190      FAFCFF
+ 191 09b0 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 191      FBFAFCFF 
+ 191      FBFAFCFF 
+GAS LISTING /tmp/cc4tpqxY.s 			page 13
+
+
+ 191      FBFAFC
+ 192 09bf FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 192      FFFBFAFC 
+ 192      FFFBFAFC 
+ 192      FFFBFA
+ 193 09ce FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 193      FCFFFBFA 
+ 193      FCFFFBFA 
+ 193      FCFFFB
+ 194 09dd FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 194      FAFCFFFB 
+ 194      FAFCFFFB 
+ 194      FAFCFF
+ 195 09ec FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 195      FBFAFCFF 
+ 195      FBFAFCFF 
+ 195      FBFAFC
+ 196 09fb FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 196      FFFBFAFC 
+ 196      FFFBFAFC 
+ 196      FFFBFA
+ 197 0a0a FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 197      FCFFFBFA 
+ 197      FCFFFBFA 
+ 197      FCFFFB
+ 198 0a19 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 198      FAFCFFFB 
+ 198      FAFCFFFB 
+ 198      FAFCFF
+ 199 0a28 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 199      FBFAFCFF 
+ 199      FBFAFCFF 
+ 199      FBFAFC
+ 200 0a37 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 200      FFFBFAFC 
+ 200      FFFBFAFC 
+ 200      FFFBFA
+ 201 0a46 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 201      FCFFFBFA 
+ 201      FCFFFBFA 
+ 201      FCFFFB
+ 202 0a55 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 202      FAFCFFFB 
+ 202      FAFCFFFB 
+ 202      FAFCFF
+ 203 0a64 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 203      FBFAFCFF 
+ 203      FBFAFCFF 
+ 203      FBFAFC
+ 204 0a73 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 204      FFFBFAFC 
+ 204      FFFBFAFC 
+ 204      FFFBFA
+ 205 0a82 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 205      FCFFFBFA 
+ 205      FCFFFBFA 
+ 205      FCFFFB
+GAS LISTING /tmp/cc4tpqxY.s 			page 14
+
+
+ 206 0a91 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 206      FAFCFFFB 
+ 206      FAFCFFFB 
+ 206      FAFCFF
+ 207 0aa0 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 207      FBFAFCFF 
+ 207      FBFAFCFF 
+ 207      FBFAFC
+ 208 0aaf FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 208      FFFBFAFC 
+ 208      FFFBFAFC 
+ 208      FFFBFA
+ 209 0abe FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 209      FCFFFBFA 
+ 209      FCFFFBFA 
+ 209      FCFFFB
+ 210 0acd FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 210      FAFCFFFB 
+ 210      FAFCFFFB 
+ 210      FAFCFF
+ 211 0adc FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 211      FBFAFCFF 
+ 211      FBFAFCFF 
+ 211      FBFAFC
+ 212 0aeb FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 212      FFFBFAFC 
+ 212      FFFBFAFC 
+ 212      FFFBFA
+ 213 0afa FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 213      FCFFFBFA 
+ 213      FCFFFBFA 
+ 213      FCFFFB
+ 214 0b09 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 214      FAFCFFFB 
+ 214      FAFCFFFB 
+ 214      FAFCFF
+ 215 0b18 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 215      FBFAFCFF 
+ 215      FBFAFCFF 
+ 215      FBFAFC
+ 216 0b27 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 216      FFFBFAFC 
+ 216      FFFBFAFC 
+ 216      FFFBFA
+ 217 0b36 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 217      FCFFFBFA 
+ 217      FCFFFBFA 
+ 217      FCFFFB
+ 218 0b45 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 218      FAFCFFFB 
+ 218      FAFCFFFB 
+ 218      FAFCFF
+ 219 0b54 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 219      FBFAFCFF 
+ 219      FBFAFCFF 
+ 219      FBFAFC
+ 220 0b63 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+GAS LISTING /tmp/cc4tpqxY.s 			page 15
+
+
+ 220      FFFBFAFC 
+ 220      FFFBFAFC 
+ 220      FFFBFA
+ 221 0b72 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 221      FCFFFBFA 
+ 221      FCFFFBFA 
+ 221      FCFFFB
+ 222 0b81 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 222      FAFCFFFB 
+ 222      FAFCFFFB 
+ 222      FAFCFF
+ 223 0b90 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 223      FBFAFCFF 
+ 223      FBFAFCFF 
+ 223      FBFAFC
+ 224 0b9f FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 224      FFFBFAFC 
+ 224      FFFBFAFC 
+ 224      FFFBFA
+ 225 0bae FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 225      FCFFFBFA 
+ 225      FCFFFBFA 
+ 225      FCFFFB
+ 226 0bbd FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 226      FAFCFFFB 
+ 226      FAFCFFFB 
+ 226      FAFCFF
+ 227 0bcc FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 227      FBFAFCFF 
+ 227      FBFAFCFF 
+ 227      FBFAFC
+ 228 0bdb FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 228      FFFBFAFC 
+ 228      FFFBFAFC 
+ 228      FFFBFA
+ 229 0bea FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 229      FCFFFBFA 
+ 229      FCFFFBFA 
+ 229      FCFFFB
+ 230 0bf9 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 230      FAFCFFFB 
+ 230      FAFCFFFB 
+ 230      FAFCFF
+ 231 0c08 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 231      FBFAFCFF 
+ 231      FBFAFCFF 
+ 231      FBFAFC
+ 232 0c17 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 232      FFFBFAFC 
+ 232      FFFBFAFC 
+ 232      FFFBFA
+ 233 0c26 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 233      FCFFFBFA 
+ 233      FCFFFBFA 
+ 233      FCFFFB
+ 234 0c35 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 234      FAFCFFFB 
+GAS LISTING /tmp/cc4tpqxY.s 			page 16
+
+
+ 234      FAFCFFFB 
+ 234      FAFCFF
+ 235 0c44 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 235      FBFAFCFF 
+ 235      FBFAFCFF 
+ 235      FBFAFC
+ 236 0c53 FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 236      FFFBFAFC 
+ 236      FFFBFAFC 
+ 236      FFFBFA
+ 237 0c62 FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 237      FCFFFBFA 
+ 237      FCFFFBFA 
+ 237      FCFFFB
+ 238 0c71 FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\372\374\377\373\372\374\377"
+ 238      FAFCFFFB 
+ 238      FAFCFFFB 
+ 238      FAFCFF
+ 239 0c80 FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 239      FBFAFCFF 
+ 239      FBFAFCFF 
+ 239      FBFAFC
+ 240 0c8f FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 240      FFFBFAFC 
+ 240      FFFBFAFC 
+ 240      FFFBFA
+ 241 0c9e FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377\373\372\374\377\373"
+ 241      FCFFFBFA 
+ 241      FCFFFBFA 
+ 241      FCFFFB
+ 242 0cad FAFCFFFB 		.ascii	"\372\374\377\373\372\374\377\373\373\374\377\373\373\374\377"
+ 242      FAFCFFFB 
+ 242      FBFCFFFB 
+ 242      FBFCFF
+ 243 0cbc FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 243      FBFBFCFF 
+ 243      FBFBFCFF 
+ 243      FBFBFC
+ 244 0ccb FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 244      FFFBFBFC 
+ 244      FFFBFBFC 
+ 244      FFFBFB
+ 245 0cda FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+ 245      FCFFFBFB 
+ 245      FCFFFBFB 
+ 245      FCFFFB
+ 246 0ce9 FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 246      FBFCFFFB 
+ 246      FBFCFFFB 
+ 246      FBFCFF
+ 247 0cf8 FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 247      FBFBFCFF 
+ 247      FBFBFCFF 
+ 247      FBFBFC
+ 248 0d07 FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 248      FFFBFBFC 
+ 248      FFFBFBFC 
+GAS LISTING /tmp/cc4tpqxY.s 			page 17
+
+
+ 248      FFFBFB
+ 249 0d16 FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+ 249      FCFFFBFB 
+ 249      FCFFFBFB 
+ 249      FCFFFB
+ 250 0d25 FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 250      FBFCFFFB 
+ 250      FBFCFFFB 
+ 250      FBFCFF
+ 251 0d34 FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 251      FBFBFCFF 
+ 251      FBFBFCFF 
+ 251      FBFBFC
+ 252 0d43 FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 252      FFFBFBFC 
+ 252      FFFBFBFC 
+ 252      FFFBFB
+ 253 0d52 FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+ 253      FCFFFBFB 
+ 253      FCFFFBFB 
+ 253      FCFFFB
+ 254 0d61 FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 254      FBFCFFFB 
+ 254      FBFCFFFB 
+ 254      FBFCFF
+ 255 0d70 FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 255      FBFBFCFF 
+ 255      FBFBFCFF 
+ 255      FBFBFC
+ 256 0d7f FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 256      FFFBFBFC 
+ 256      FFFBFBFC 
+ 256      FFFBFB
+ 257 0d8e FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+ 257      FCFFFBFB 
+ 257      FCFFFBFB 
+ 257      FCFFFB
+ 258 0d9d FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 258      FBFCFFFB 
+ 258      FBFCFFFB 
+ 258      FBFCFF
+ 259 0dac FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 259      FBFBFCFF 
+ 259      FBFBFCFF 
+ 259      FBFBFC
+ 260 0dbb FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 260      FFFBFBFC 
+ 260      FFFBFBFC 
+ 260      FFFBFB
+ 261 0dca FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+ 261      FCFFFBFB 
+ 261      FCFFFBFB 
+ 261      FCFFFB
+ 262 0dd9 FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 262      FBFCFFFB 
+ 262      FBFCFFFB 
+ 262      FBFCFF
+GAS LISTING /tmp/cc4tpqxY.s 			page 18
+
+
+ 263 0de8 FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 263      FBFBFCFF 
+ 263      FBFBFCFF 
+ 263      FBFBFC
+ 264 0df7 FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 264      FFFBFBFC 
+ 264      FFFBFBFC 
+ 264      FFFBFB
+ 265 0e06 FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+ 265      FCFFFBFB 
+ 265      FCFFFBFB 
+ 265      FCFFFB
+ 266 0e15 FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 266      FBFCFFFB 
+ 266      FBFCFFFB 
+ 266      FBFCFF
+ 267 0e24 FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 267      FBFBFCFF 
+ 267      FBFBFCFF 
+ 267      FBFBFC
+ 268 0e33 FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 268      FFFBFBFC 
+ 268      FFFBFBFC 
+ 268      FFFBFB
+ 269 0e42 FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+ 269      FCFFFBFB 
+ 269      FCFFFBFB 
+ 269      FCFFFB
+ 270 0e51 FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 270      FBFCFFFB 
+ 270      FBFCFFFB 
+ 270      FBFCFF
+ 271 0e60 FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 271      FBFBFCFF 
+ 271      FBFBFCFF 
+ 271      FBFBFC
+ 272 0e6f FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 272      FFFBFBFC 
+ 272      FFFBFBFC 
+ 272      FFFBFB
+ 273 0e7e FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+ 273      FCFFFBFB 
+ 273      FCFFFBFB 
+ 273      FCFFFB
+ 274 0e8d FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 274      FBFCFFFB 
+ 274      FBFCFFFB 
+ 274      FBFCFF
+ 275 0e9c FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 275      FBFBFCFF 
+ 275      FBFBFCFF 
+ 275      FBFBFC
+ 276 0eab FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 276      FFFBFBFC 
+ 276      FFFBFBFC 
+ 276      FFFBFB
+ 277 0eba FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+GAS LISTING /tmp/cc4tpqxY.s 			page 19
+
+
+ 277      FCFFFBFB 
+ 277      FCFFFBFB 
+ 277      FCFFFB
+ 278 0ec9 FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 278      FBFCFFFB 
+ 278      FBFCFFFB 
+ 278      FBFCFF
+ 279 0ed8 FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 279      FBFBFCFF 
+ 279      FBFBFCFF 
+ 279      FBFBFC
+ 280 0ee7 FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 280      FFFBFBFC 
+ 280      FFFBFBFC 
+ 280      FFFBFB
+ 281 0ef6 FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+ 281      FCFFFBFB 
+ 281      FCFFFBFB 
+ 281      FCFFFB
+ 282 0f05 FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 282      FBFCFFFB 
+ 282      FBFCFFFB 
+ 282      FBFCFF
+ 283 0f14 FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 283      FBFBFCFF 
+ 283      FBFBFCFF 
+ 283      FBFBFC
+ 284 0f23 FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 284      FFFBFBFC 
+ 284      FFFBFBFC 
+ 284      FFFBFB
+ 285 0f32 FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+ 285      FCFFFBFB 
+ 285      FCFFFBFB 
+ 285      FCFFFB
+ 286 0f41 FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 286      FBFCFFFB 
+ 286      FBFCFFFB 
+ 286      FBFCFF
+ 287 0f50 FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 287      FBFBFCFF 
+ 287      FBFBFCFF 
+ 287      FBFBFC
+ 288 0f5f FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 288      FFFBFBFC 
+ 288      FFFBFBFC 
+ 288      FFFBFB
+ 289 0f6e FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+ 289      FCFFFBFB 
+ 289      FCFFFBFB 
+ 289      FCFFFB
+ 290 0f7d FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 290      FBFCFFFB 
+ 290      FBFCFFFB 
+ 290      FBFCFF
+ 291 0f8c FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 291      FBFBFCFF 
+GAS LISTING /tmp/cc4tpqxY.s 			page 20
+
+
+ 291      FBFBFCFF 
+ 291      FBFBFC
+ 292 0f9b FFFBFBFC 		.ascii	"\377\373\373\374\377"
+ 292      FF
+ 293 0fa0 FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 293      FBFBFCFF 
+ 293      FBFBFCFF 
+ 293      FBFBFC
+ 294 0faf FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 294      FFFBFBFC 
+ 294      FFFBFBFC 
+ 294      FFFBFB
+ 295 0fbe FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377\373\373\374\377\373"
+ 295      FCFFFBFB 
+ 295      FCFFFBFB 
+ 295      FCFFFB
+ 296 0fcd FBFCFFFB 		.ascii	"\373\374\377\373\373\374\377\373\373\374\377\373\373\374\377"
+ 296      FBFCFFFB 
+ 296      FBFCFFFB 
+ 296      FBFCFF
+ 297 0fdc FBFBFCFF 		.ascii	"\373\373\374\377\373\373\374\377\373\373\374\377\373\373\374"
+ 297      FBFBFCFF 
+ 297      FBFBFCFF 
+ 297      FBFBFC
+ 298 0feb FFFBFBFC 		.ascii	"\377\373\373\374\377\373\373\374\377\373\373\374\377\373\373"
+ 298      FFFBFBFC 
+ 298      FFFBFBFC 
+ 298      FFFBFB
+ 299 0ffa FCFFFBFB 		.ascii	"\374\377\373\373\374\377\373\373\374\377"
+ 299      FCFFFBFB 
+ 299      FCFF
+ 300              		.globl	heatmap_cs_Purples_mixed
+ 301              		.section	.data.rel.local
+ 302              		.align 8
+ 303              		.type	heatmap_cs_Purples_mixed, @object
+ 304              		.size	heatmap_cs_Purples_mixed, 8
+ 305              	heatmap_cs_Purples_mixed:
+ 306 0008 00000000 		.quad	mixed
+ 306      00000000 
+ 307              		.section	.data.rel.ro.local
+ 308              		.align 16
+ 309              		.type	mixed, @object
+ 310              		.size	mixed, 16
+ 311              	mixed:
+ 312 0010 00000000 		.quad	mixed_data
+ 312      00000000 
+ 313 0018 01040000 		.quad	1025
+ 313      00000000 
+ 314              		.section	.rodata
+ 315 1004 00000000 		.align 32
+ 315      00000000 
+ 315      00000000 
+ 315      00000000 
+ 315      00000000 
+ 316              		.type	mixed_data, @object
+ 317              		.size	mixed_data, 4100
+ 318              	mixed_data:
+GAS LISTING /tmp/cc4tpqxY.s 			page 21
+
+
+ 319 1020 00       		.string	""
+ 320 1021 00       		.string	""
+ 321 1022 00       		.string	""
+ 322 1023 00       		.string	""
+ 323 1024 3F00     		.string	"?"
+ 324 1026 7D00     		.string	"}"
+ 325 1028 3F00     		.string	"?"
+ 326 102a 7D073F00 		.string	"}\007?"
+ 327 102e 7D0E3F00 		.string	"}\016?"
+ 328 1032 7D163F01 		.ascii	"}\026?\001}\035?\001}%?\001},?\001}4@\002};@\002~C@\002~J@\003"
+ 328      7D1D3F01 
+ 328      7D253F01 
+ 328      7D2C3F01 
+ 328      7D344002 
+ 329 1052 7E524003 		.ascii	"~R@\003~Y@\003~a@\004~hA\004~pA\004~wA\004~\177A\005\177\206"
+ 329      7E594003 
+ 329      7E614004 
+ 329      7E684104 
+ 329      7E704104 
+ 330 1070 41057F8D 		.ascii	"A\005\177\215A\005\177\225A\006\177\234A\006\177\244B\006\177"
+ 330      41057F95 
+ 330      41067F9C 
+ 330      41067FA4 
+ 330      42067F
+ 331 1083 AB42077F 		.ascii	"\253B\007\177\263B\007\177\272B\007\177\302B\b\200\311B\b\200"
+ 331      B342077F 
+ 331      BA42077F 
+ 331      C2420880 
+ 331      C9420880 
+ 332 1097 D1420880 		.ascii	"\321B\b\200\330C\t\200\340C\t\200\347C\t\200\357C\n\200\366C"
+ 332      D8430980 
+ 332      E0430980 
+ 332      E7430980 
+ 332      EF430A80 
+ 333 10ad 0A80FE43 		.ascii	"\n\200\376C\n\200\377C\n\201\377C\013\201\377D\013\201\377D\013"
+ 333      0A80FF43 
+ 333      0A81FF43 
+ 333      0B81FF44 
+ 333      0B81FF44 
+ 334 10c2 81FF440C 		.ascii	"\201\377D\f\201\377D\f\201\377D\f\201\377D\f\201\377D\r\201\377"
+ 334      81FF440C 
+ 334      81FF440C 
+ 334      81FF440C 
+ 334      81FF440D 
+ 335 10d8 440D82FF 		.ascii	"D\r\202\377E\r\202\377E\r\202\377E\016\202\377E\016\202\377E"
+ 335      450D82FF 
+ 335      450D82FF 
+ 335      450E82FF 
+ 335      450E82FF 
+ 336 10ed 0E82FF45 		.ascii	"\016\202\377E\016\202\377E\017\202\377F\017\202\377F\017\203"
+ 336      0E82FF45 
+ 336      0F82FF46 
+ 336      0F82FF46 
+ 336      0F83
+ 337 10ff FF460F83 		.ascii	"\377F\017\203\377F\020\203\377F\020\203\377F\020\203\377F\020"
+ 337      FF461083 
+ 337      FF461083 
+GAS LISTING /tmp/cc4tpqxY.s 			page 22
+
+
+ 337      FF461083 
+ 337      FF4610
+ 338 1112 83FF4611 		.ascii	"\203\377F\021\203\377G\021\203\377G\021\204\377G\021\204\377"
+ 338      83FF4711 
+ 338      83FF4711 
+ 338      84FF4711 
+ 338      84FF
+ 339 1124 4B1987FF 		.ascii	"K\031\207\377K\032\207\377K\032\210\377L\032\210\377L\032\210"
+ 339      4B1A87FF 
+ 339      4B1A88FF 
+ 339      4C1A88FF 
+ 339      4C1A88
+ 340 1137 FF4C1A88 		.ascii	"\377L\032\210\377L\033\210\377L\033\210\377L\033\210\377L\033"
+ 340      FF4C1B88 
+ 340      FF4C1B88 
+ 340      FF4C1B88 
+ 340      FF4C1B
+ 341 114a 88FF4C1C 		.ascii	"\210\377L\034\210\377M\034\211\377M\034\211\377M\034\211\377"
+ 341      88FF4D1C 
+ 341      89FF4D1C 
+ 341      89FF4D1C 
+ 341      89FF
+ 342 115c 4D1C89FF 		.ascii	"M\034\211\377M\035\211\377M\035\211\377M\035\211\377N\035\211"
+ 342      4D1D89FF 
+ 342      4D1D89FF 
+ 342      4D1D89FF 
+ 342      4E1D89
+ 343 116f FF4E1E89 		.ascii	"\377N\036\211\377N\036\212\377N\036\212\377N\036\212\377N\036"
+ 343      FF4E1E8A 
+ 343      FF4E1E8A 
+ 343      FF4E1E8A 
+ 343      FF4E1E
+ 344 1182 8AFF4E1F 		.ascii	"\212\377N\037\212\377N\037\212\377O\037\212\377O\037\212\377"
+ 344      8AFF4E1F 
+ 344      8AFF4F1F 
+ 344      8AFF4F1F 
+ 344      8AFF
+ 345 1194 4F1F8AFF 		.ascii	"O\037\212\377O \213\377O \213\377O \213\377O \213\377O \213\377"
+ 345      4F208BFF 
+ 345      4F208BFF 
+ 345      4F208BFF 
+ 345      4F208BFF 
+ 346 11ac 50218BFF 		.ascii	"P!\213\377P!\213\377P!\213\377P!\213\377P!\214\377P\"\214\377"
+ 346      50218BFF 
+ 346      50218BFF 
+ 346      50218BFF 
+ 346      50218CFF 
+ 347 11c4 50228CFF 		.ascii	"P\"\214\377Q\"\214\377Q\"\214\377Q\"\214\377Q#\214\377Q#\214"
+ 347      51228CFF 
+ 347      51228CFF 
+ 347      51228CFF 
+ 347      51238CFF 
+ 348 11db FF51238C 		.ascii	"\377Q#\214\377Q#\215\377Q#\215\377R$\215\377R$\215\377R$\215"
+ 348      FF51238D 
+ 348      FF51238D 
+ 348      FF52248D 
+ 348      FF52248D 
+GAS LISTING /tmp/cc4tpqxY.s 			page 23
+
+
+ 349 11f3 FF52248D 		.ascii	"\377R$\215\377R$\215\377R%\215\377R%\215\377R%\216\377S%\216"
+ 349      FF52248D 
+ 349      FF52258D 
+ 349      FF52258D 
+ 349      FF52258E 
+ 350 120b FF53258E 		.ascii	"\377S%\216\377S&\216\377S&\216\377S&\216\377S&\216\377S&\216"
+ 350      FF53268E 
+ 350      FF53268E 
+ 350      FF53268E 
+ 350      FF53268E 
+ 351 1223 FF53278F 		.ascii	"\377S'\217\377T'\217\377T'\217\377T'\217\377T(\217\377T(\217"
+ 351      FF54278F 
+ 351      FF54278F 
+ 351      FF54278F 
+ 351      FF54288F 
+ 352 123b FF54288F 		.ascii	"\377T(\217\377T)\217\377U)\220\377U)\220\377U)\220\377U*\220"
+ 352      FF54298F 
+ 352      FF552990 
+ 352      FF552990 
+ 352      FF552990 
+ 353 1253 FF552A90 		.ascii	"\377U*\220\377U*\220\377U+\220\377U+\221\377V+\221\377V+\221"
+ 353      FF552A90 
+ 353      FF552B90 
+ 353      FF552B91 
+ 353      FF562B91 
+ 354 126b FF562C91 		.ascii	"\377V,\221\377V,\221\377V,\221\377V-\221\377V-\221\377V-\222"
+ 354      FF562C91 
+ 354      FF562C91 
+ 354      FF562D91 
+ 354      FF562D91 
+ 355 1283 FF572D92 		.ascii	"\377W-\222\377W.\222\377W.\222\377W.\222\377W.\222\377W/\222"
+ 355      FF572E92 
+ 355      FF572E92 
+ 355      FF572E92 
+ 355      FF572E92 
+ 356 129b FF572F92 		.ascii	"\377W/\222\377X/\223\377X0\223\377X0\223\377X0\223\377X0\223"
+ 356      FF582F93 
+ 356      FF583093 
+ 356      FF583093 
+ 356      FF583093 
+ 357 12b3 FF583193 		.ascii	"\377X1\223\377X1\223\377X1\224\377Y1\224\377Y2\224\377Y2\224"
+ 357      FF583193 
+ 357      FF583194 
+ 357      FF593194 
+ 357      FF593294 
+ 358 12cb FF593294 		.ascii	"\377Y2\224\377Y3\224\377Y3\224\377Y3\224\377Z3\225\377Z4\225"
+ 358      FF593394 
+ 358      FF593394 
+ 358      FF593394 
+ 358      FF5A3395 
+ 359 12e3 FF5A3495 		.ascii	"\377Z4\225\377Z4\225\377Z4\225\377Z5\225\377Z5\225\377Z5\225"
+ 359      FF5A3495 
+ 359      FF5A3495 
+ 359      FF5A3595 
+ 359      FF5A3595 
+ 360 12fb FF5B3596 		.ascii	"\377[5\226\377[6\226\377[6\226\377[6\226\377[6\226\377[7\226"
+ 360      FF5B3696 
+GAS LISTING /tmp/cc4tpqxY.s 			page 24
+
+
+ 360      FF5B3696 
+ 360      FF5B3696 
+ 360      FF5B3696 
+ 361 1313 FF5B3796 		.ascii	"\377[7\226\377\\7\226\377\\8\227\377\\8\227\377`@\233\377aA\233"
+ 361      FF5C3796 
+ 361      FF5C3897 
+ 361      FF5C3897 
+ 361      FF60409B 
+ 362 132b FF61419B 		.ascii	"\377aA\233\377aA\233\377aA\233\377aB\233\377aB\234\377aB\234"
+ 362      FF61419B 
+ 362      FF61419B 
+ 362      FF61429B 
+ 362      FF61429C 
+ 363 1343 FF62429C 		.ascii	"\377bB\234\377bC\234\377bC\234\377bC\234\377bD\234\377bD\234"
+ 363      FF62439C 
+ 363      FF62439C 
+ 363      FF62439C 
+ 363      FF62449C 
+ 364 135b FF62449D 		.ascii	"\377bD\235\377bD\235\377cE\235\377cE\235\377cE\235\377cE\235"
+ 364      FF62449D 
+ 364      FF63459D 
+ 364      FF63459D 
+ 364      FF63459D 
+ 365 1373 FF63469D 		.ascii	"\377cF\235\377cF\235\377cF\236\377dF\236\377dG\236\377dG\236"
+ 365      FF63469D 
+ 365      FF63469E 
+ 365      FF64469E 
+ 365      FF64479E 
+ 366 138b FF64479E 		.ascii	"\377dG\236\377dG\236\377dH\236\377dH\236\377eH\237\377eH\237"
+ 366      FF64479E 
+ 366      FF64489E 
+ 366      FF64489E 
+ 366      FF65489F 
+ 367 13a3 FF65499F 		.ascii	"\377eI\237\377eI\237\377eI\237\377eI\237\377eJ\237\377fJ\237"
+ 367      FF65499F 
+ 367      FF65499F 
+ 367      FF65499F 
+ 367      FF654A9F 
+ 368 13bb FF664A9F 		.ascii	"\377fJ\237\377fJ\240\377fK\240\377fK\240\377fK\240\377fK\240"
+ 368      FF664AA0 
+ 368      FF664BA0 
+ 368      FF664BA0 
+ 368      FF664BA0 
+ 369 13d3 FF674CA0 		.ascii	"\377gL\240\377gL\240\377gL\240\377gL\241\377gM\241\377gM\241"
+ 369      FF674CA0 
+ 369      FF674CA0 
+ 369      FF674CA1 
+ 369      FF674DA1 
+ 370 13eb FF674DA1 		.ascii	"\377gM\241\377hM\241\377hN\241\377hN\241\377hN\241\377hN\241"
+ 370      FF684DA1 
+ 370      FF684EA1 
+ 370      FF684EA1 
+ 370      FF684EA1 
+ 371 1403 FF684FA2 		.ascii	"\377hO\242\377hO\242\377iO\242\377iO\242\377iP\242\377iP\242"
+ 371      FF684FA2 
+ 371      FF694FA2 
+ 371      FF694FA2 
+GAS LISTING /tmp/cc4tpqxY.s 			page 25
+
+
+ 371      FF6950A2 
+ 372 141b FF6950A2 		.ascii	"\377iP\242\377iP\242\377iQ\243\377jQ\243\377jQ\243\377jQ\243"
+ 372      FF6950A2 
+ 372      FF6951A3 
+ 372      FF6A51A3 
+ 372      FF6A51A3 
+ 373 1433 FF6A52A3 		.ascii	"\377jR\243\377jR\243\377jR\243\377jR\244\377jS\244\377jS\244"
+ 373      FF6A52A3 
+ 373      FF6A52A3 
+ 373      FF6A52A4 
+ 373      FF6A53A4 
+ 374 144b FF6B53A4 		.ascii	"\377kS\244\377kT\244\377kT\244\377kT\245\377kT\245\377kU\245"
+ 374      FF6B54A4 
+ 374      FF6B54A4 
+ 374      FF6B54A5 
+ 374      FF6B54A5 
+ 375 1463 FF6B55A5 		.ascii	"\377kU\245\377kU\245\377lV\245\377lV\246\377lV\246\377lV\246"
+ 375      FF6B55A5 
+ 375      FF6C56A5 
+ 375      FF6C56A6 
+ 375      FF6C56A6 
+ 376 147b FF6C57A6 		.ascii	"\377lW\246\377lW\246\377lW\246\377lX\246\377lX\247\377mX\247"
+ 376      FF6C57A6 
+ 376      FF6C57A6 
+ 376      FF6C58A6 
+ 376      FF6C58A7 
+ 377 1493 FF6D58A7 		.ascii	"\377mX\247\377mY\247\377mY\247\377mY\247\377mZ\250\377mZ\250"
+ 377      FF6D59A7 
+ 377      FF6D59A7 
+ 377      FF6D59A7 
+ 377      FF6D5AA8 
+ 378 14ab FF6D5AA8 		.ascii	"\377mZ\250\377nZ\250\377n[\250\377n[\250\377n[\250\377n[\251"
+ 378      FF6E5AA8 
+ 378      FF6E5BA8 
+ 378      FF6E5BA8 
+ 378      FF6E5BA8 
+ 379 14c3 FF6E5CA9 		.ascii	"\377n\\\251\377n\\\251\377n\\\251\377o]\251\377o]\251\377o]\252"
+ 379      FF6E5CA9 
+ 379      FF6E5CA9 
+ 379      FF6F5DA9 
+ 379      FF6F5DA9 
+ 380 14db FF6F5DAA 		.ascii	"\377o]\252\377o^\252\377o^\252\377o^\252\377o_\252\377p_\252"
+ 380      FF6F5EAA 
+ 380      FF6F5EAA 
+ 380      FF6F5EAA 
+ 380      FF6F5FAA 
+ 381 14f3 FF705FAB 		.ascii	"\377p_\253\377p_\253\377p`\253\377p`\253\377p`\253\377p`\253"
+ 381      FF705FAB 
+ 381      FF7060AB 
+ 381      FF7060AB 
+ 381      FF7060AB 
+ 382 150b FF7061AB 		.ascii	"\377pa\253\377qa\254\377qa\254\377qb\254\377qb\254\377qb\254"
+ 382      FF7161AC 
+ 382      FF7161AC 
+ 382      FF7162AC 
+ 382      FF7162AC 
+ 383 1523 FF766BB1 		.ascii	"\377vk\261\377vk\261\377vl\261\377vl\261\377vl\261\377vm\262"
+GAS LISTING /tmp/cc4tpqxY.s 			page 26
+
+
+ 383      FF766BB1 
+ 383      FF766CB1 
+ 383      FF766CB1 
+ 383      FF766CB1 
+ 384 153b FF776DB2 		.ascii	"\377wm\262\377wm\262\377wm\262\377wn\262\377wn\262\377wn\262"
+ 384      FF776DB2 
+ 384      FF776DB2 
+ 384      FF776EB2 
+ 384      FF776EB2 
+ 385 1553 FF776EB3 		.ascii	"\377wn\263\377xo\263\377xo\263\377xo\263\377xp\263\377xp\263"
+ 385      FF786FB3 
+ 385      FF786FB3 
+ 385      FF786FB3 
+ 385      FF7870B3 
+ 386 156b FF7870B3 		.ascii	"\377xp\263\377xp\264\377yq\264\377yq\264\377yq\264\377yq\264"
+ 386      FF7870B4 
+ 386      FF7971B4 
+ 386      FF7971B4 
+ 386      FF7971B4 
+ 387 1583 FF7972B4 		.ascii	"\377yr\264\377yr\264\377yr\265\377zs\265\377zs\265\377zs\265"
+ 387      FF7972B4 
+ 387      FF7972B5 
+ 387      FF7A73B5 
+ 387      FF7A73B5 
+ 388 159b FF7A73B5 		.ascii	"\377zs\265\377zt\265\377zt\265\377zt\265\377{t\266\377{u\266"
+ 388      FF7A74B5 
+ 388      FF7A74B5 
+ 388      FF7A74B5 
+ 388      FF7B74B6 
+ 389 15b3 FF7B75B6 		.ascii	"\377{u\266\377{u\266\377{v\266\377{v\266\377|v\266\377|v\267"
+ 389      FF7B75B6 
+ 389      FF7B76B6 
+ 389      FF7B76B6 
+ 389      FF7C76B6 
+ 390 15cb FF7C77B7 		.ascii	"\377|w\267\377|w\267\377|w\267\377|w\267\377}x\267\377}x\267"
+ 390      FF7C77B7 
+ 390      FF7C77B7 
+ 390      FF7C77B7 
+ 390      FF7D78B7 
+ 391 15e3 FF7D78B7 		.ascii	"\377}x\267\377}x\270\377}y\270\377}y\270\377}y\270\377~z\270"
+ 391      FF7D78B8 
+ 391      FF7D79B8 
+ 391      FF7D79B8 
+ 391      FF7D79B8 
+ 392 15fb FF7E7AB8 		.ascii	"\377~z\270\377~z\270\377~z\270\377~{\271\377~{\271\377\177{\271"
+ 392      FF7E7AB8 
+ 392      FF7E7AB8 
+ 392      FF7E7BB9 
+ 392      FF7E7BB9 
+ 393 1613 FF7F7BB9 		.ascii	"\377\177{\271\377\177|\271\377\177|\271\377\177|\271\377\177"
+ 393      FF7F7CB9 
+ 393      FF7F7CB9 
+ 393      FF7F7CB9 
+ 393      FF7F
+ 394 1625 7DBAFF80 		.ascii	"}\272\377\200}\272\377\200}\272\377\200}\272\377\200}\272\377"
+ 394      7DBAFF80 
+ 394      7DBAFF80 
+GAS LISTING /tmp/cc4tpqxY.s 			page 27
+
+
+ 394      7DBAFF80 
+ 394      7DBAFF
+ 395 1638 807DBAFF 		.ascii	"\200}\272\377\201~\272\377\201~\272\377\201~\272\377\201~\272"
+ 395      817EBAFF 
+ 395      817EBAFF 
+ 395      817EBAFF 
+ 395      817EBA
+ 396 164b FF817EBA 		.ascii	"\377\201~\272\377\202~\272\377\202\177\273\377\202\177\273\377"
+ 396      FF827EBA 
+ 396      FF827FBB 
+ 396      FF827FBB 
+ 396      FF
+ 397 165c 827FBBFF 		.ascii	"\202\177\273\377\202\177\273\377\203\177\273\377\203\200\273"
+ 397      827FBBFF 
+ 397      837FBBFF 
+ 397      8380BB
+ 398 166b FF8380BB 		.ascii	"\377\203\200\273\377\203\200\273\377\203\200\273\377\203\200"
+ 398      FF8380BB 
+ 398      FF8380BB 
+ 398      FF8380
+ 399 167a BBFF8480 		.ascii	"\273\377\204\200\273\377\204\201\274\377\204\201\274\377\204"
+ 399      BBFF8481 
+ 399      BCFF8481 
+ 399      BCFF84
+ 400 1689 81BCFF84 		.ascii	"\201\274\377\204\201\274\377\205\201\274\377\205\201\274\377"
+ 400      81BCFF85 
+ 400      81BCFF85 
+ 400      81BCFF
+ 401 1698 8582BCFF 		.ascii	"\205\202\274\377\205\202\274\377\205\202\274\377\206\202\274"
+ 401      8582BCFF 
+ 401      8582BCFF 
+ 401      8682BC
+ 402 16a7 FF8682BC 		.ascii	"\377\206\202\274\377\206\203\274\377\206\203\275\377\206\203"
+ 402      FF8683BC 
+ 402      FF8683BD 
+ 402      FF8683
+ 403 16b6 BDFF8783 		.ascii	"\275\377\207\203\275\377\207\203\275\377\207\203\275\377\207"
+ 403      BDFF8783 
+ 403      BDFF8783 
+ 403      BDFF87
+ 404 16c5 84BDFF87 		.ascii	"\204\275\377\207\204\275\377\207\204\275\377\210\204\275\377"
+ 404      84BDFF87 
+ 404      84BDFF88 
+ 404      84BDFF
+ 405 16d4 8884BDFF 		.ascii	"\210\204\275\377\210\205\275\377\210\205\276\377\210\205\276"
+ 405      8885BDFF 
+ 405      8885BEFF 
+ 405      8885BE
+ 406 16e3 FF8985BE 		.ascii	"\377\211\205\276\377\211\205\276\377\211\205\276\377\211\206"
+ 406      FF8985BE 
+ 406      FF8985BE 
+ 406      FF8986
+ 407 16f2 BEFF8986 		.ascii	"\276\377\211\206\276\377\212\206\276\377\212\206\276\377\212"
+ 407      BEFF8A86 
+ 407      BEFF8A86 
+ 407      BEFF8A
+ 408 1701 86BEFF8A 		.ascii	"\206\276\377\212\207\276\377\212\207\276\377\212\207\277\377"
+GAS LISTING /tmp/cc4tpqxY.s 			page 28
+
+
+ 408      87BEFF8A 
+ 408      87BEFF8A 
+ 408      87BFFF
+ 409 1710 8B87BFFF 		.ascii	"\213\207\277\377\213\207\277\377\213\207\277\377\213\210\277"
+ 409      8B87BFFF 
+ 409      8B87BFFF 
+ 409      8B88BF
+ 410 171f FF8B88BF 		.ascii	"\377\213\210\277\377\222\216\302\377\222\216\302\377\222\216"
+ 410      FF928EC2 
+ 410      FF928EC2 
+ 410      FF928E
+ 411 172e C2FF928E 		.ascii	"\302\377\222\216\302\377\222\217\302\377\223\217\302\377\223"
+ 411      C2FF928F 
+ 411      C2FF938F 
+ 411      C2FF93
+ 412 173d 8FC2FF93 		.ascii	"\217\302\377\223\217\303\377\223\217\303\377\223\217\303\377"
+ 412      8FC3FF93 
+ 412      8FC3FF93 
+ 412      8FC3FF
+ 413 174c 9390C3FF 		.ascii	"\223\220\303\377\224\220\303\377\224\220\303\377\224\220\303"
+ 413      9490C3FF 
+ 413      9490C3FF 
+ 413      9490C3
+ 414 175b FF9490C3 		.ascii	"\377\224\220\303\377\224\221\303\377\225\221\303\377\225\221"
+ 414      FF9491C3 
+ 414      FF9591C3 
+ 414      FF9591
+ 415 176a C3FF9591 		.ascii	"\303\377\225\221\303\377\225\221\304\377\225\221\304\377\226"
+ 415      C3FF9591 
+ 415      C4FF9591 
+ 415      C4FF96
+ 416 1779 92C4FF96 		.ascii	"\222\304\377\226\222\304\377\226\222\304\377\226\222\304\377"
+ 416      92C4FF96 
+ 416      92C4FF96 
+ 416      92C4FF
+ 417 1788 9692C4FF 		.ascii	"\226\222\304\377\226\223\304\377\227\223\304\377\227\223\304"
+ 417      9693C4FF 
+ 417      9793C4FF 
+ 417      9793C4
+ 418 1797 FF9793C4 		.ascii	"\377\227\223\304\377\227\223\305\377\227\223\305\377\230\224"
+ 418      FF9793C5 
+ 418      FF9793C5 
+ 418      FF9894
+ 419 17a6 C5FF9894 		.ascii	"\305\377\230\224\305\377\230\224\305\377\230\224\305\377\230"
+ 419      C5FF9894 
+ 419      C5FF9894 
+ 419      C5FF98
+ 420 17b5 94C5FF98 		.ascii	"\224\305\377\230\225\305\377\231\225\305\377\231\225\305\377"
+ 420      95C5FF99 
+ 420      95C5FF99 
+ 420      95C5FF
+ 421 17c4 9995C5FF 		.ascii	"\231\225\305\377\231\225\305\377\231\225\306\377\232\226\306"
+ 421      9995C5FF 
+ 421      9995C6FF 
+ 421      9A96C6
+ 422 17d3 FF9A96C6 		.ascii	"\377\232\226\306\377\232\226\306\377\232\226\306\377\232\226"
+ 422      FF9A96C6 
+GAS LISTING /tmp/cc4tpqxY.s 			page 29
+
+
+ 422      FF9A96C6 
+ 422      FF9A96
+ 423 17e2 C6FF9B97 		.ascii	"\306\377\233\227\306\377\233\227\306\377\233\227\306\377"
+ 423      C6FF9B97 
+ 423      C6FF9B97 
+ 423      C6FF
+ 424 17f0 9B97C6FF 		.ascii	"\233\227\306\377\233\227\306\377\233\227\307\377\234\230\307"
+ 424      9B97C6FF 
+ 424      9B97C7FF 
+ 424      9C98C7
+ 425 17ff FF9C98C7 		.ascii	"\377\234\230\307\377\234\230\307\377\234\230\307\377\234\230"
+ 425      FF9C98C7 
+ 425      FF9C98C7 
+ 425      FF9C98
+ 426 180e C7FF9D99 		.ascii	"\307\377\235\231\307\377\235\231\307\377\235\231\307\377\235"
+ 426      C7FF9D99 
+ 426      C7FF9D99 
+ 426      C7FF9D
+ 427 181d 99C7FF9D 		.ascii	"\231\307\377\235\231\307\377\235\232\307\377\236\232\310\377"
+ 427      99C7FF9D 
+ 427      9AC7FF9E 
+ 427      9AC8FF
+ 428 182c 9E9AC8FF 		.ascii	"\236\232\310\377\236\232\310\377\236\232\310\377\236\233\310"
+ 428      9E9AC8FF 
+ 428      9E9AC8FF 
+ 428      9E9BC8
+ 429 183b FF9F9BC8 		.ascii	"\377\237\233\310\377\237\233\310\377\237\233\311\377\237\233"
+ 429      FF9F9BC8 
+ 429      FF9F9BC9 
+ 429      FF9F9B
+ 430 184a C9FF9F9C 		.ascii	"\311\377\237\234\311\377\237\234\311\377\240\234\311\377\240"
+ 430      C9FF9F9C 
+ 430      C9FFA09C 
+ 430      C9FFA0
+ 431 1859 9CC9FFA0 		.ascii	"\234\311\377\240\235\311\377\240\235\311\377\240\235\312\377"
+ 431      9DC9FFA0 
+ 431      9DC9FFA0 
+ 431      9DCAFF
+ 432 1868 A19DCAFF 		.ascii	"\241\235\312\377\241\235\312\377\241\236\312\377\241\236\312"
+ 432      A19DCAFF 
+ 432      A19ECAFF 
+ 432      A19ECA
+ 433 1877 FFA19ECA 		.ascii	"\377\241\236\312\377\241\236\312\377\242\237\312\377\242\237"
+ 433      FFA19ECA 
+ 433      FFA29FCA 
+ 433      FFA29F
+ 434 1886 CBFFA29F 		.ascii	"\313\377\242\237\313\377\242\237\313\377\242\237\313\377\242"
+ 434      CBFFA29F 
+ 434      CBFFA29F 
+ 434      CBFFA2
+ 435 1895 A0CBFFA3 		.ascii	"\240\313\377\243\240\313\377\243\240\313\377\243\240\313\377"
+ 435      A0CBFFA3 
+ 435      A0CBFFA3 
+ 435      A0CBFF
+ 436 18a4 A3A0CCFF 		.ascii	"\243\240\314\377\243\241\314\377\244\241\314\377\244\241\314"
+ 436      A3A1CCFF 
+ 436      A4A1CCFF 
+GAS LISTING /tmp/cc4tpqxY.s 			page 30
+
+
+ 436      A4A1CC
+ 437 18b3 FFA4A1CC 		.ascii	"\377\244\241\314\377\244\242\314\377\244\242\314\377\244\242"
+ 437      FFA4A2CC 
+ 437      FFA4A2CC 
+ 437      FFA4A2
+ 438 18c2 CCFFA5A2 		.ascii	"\314\377\245\242\315\377\245\242\315\377\245\243\315\377\245"
+ 438      CDFFA5A2 
+ 438      CDFFA5A3 
+ 438      CDFFA5
+ 439 18d1 A3CDFFA5 		.ascii	"\243\315\377\245\243\315\377\246\243\315\377\246\244\315\377"
+ 439      A3CDFFA6 
+ 439      A3CDFFA6 
+ 439      A4CDFF
+ 440 18e0 A6A4CEFF 		.ascii	"\246\244\316\377\246\244\316\377\246\244\316\377\246\244\316"
+ 440      A6A4CEFF 
+ 440      A6A4CEFF 
+ 440      A6A4CE
+ 441 18ef FFA7A5CE 		.ascii	"\377\247\245\316\377\247\245\316\377\247\245\316\377\247\245"
+ 441      FFA7A5CE 
+ 441      FFA7A5CE 
+ 441      FFA7A5
+ 442 18fe CEFFA7A6 		.ascii	"\316\377\247\246\317\377\250\246\317\377\250\246\317\377\250"
+ 442      CFFFA8A6 
+ 442      CFFFA8A6 
+ 442      CFFFA8
+ 443 190d A6CFFFA8 		.ascii	"\246\317\377\250\246\317\377\250\247\317\377\251\247\317\377"
+ 443      A6CFFFA8 
+ 443      A7CFFFA9 
+ 443      A7CFFF
+ 444 191c A9A7CFFF 		.ascii	"\251\247\317\377\251\247\320\377\257\256\324\377\257\257\324"
+ 444      A9A7D0FF 
+ 444      AFAED4FF 
+ 444      AFAFD4
+ 445 192b FFAFAFD4 		.ascii	"\377\257\257\324\377\260\257\324\377\260\257\324\377\260\260"
+ 445      FFB0AFD4 
+ 445      FFB0AFD4 
+ 445      FFB0B0
+ 446 193a D4FFB0B0 		.ascii	"\324\377\260\260\324\377\260\260\325\377\261\260\325\377\261"
+ 446      D4FFB0B0 
+ 446      D5FFB1B0 
+ 446      D5FFB1
+ 447 1949 B0D5FFB1 		.ascii	"\260\325\377\261\261\325\377\261\261\325\377\261\261\325\377"
+ 447      B1D5FFB1 
+ 447      B1D5FFB1 
+ 447      B1D5FF
+ 448 1958 B2B1D5FF 		.ascii	"\262\261\325\377\262\262\325\377\262\262\326\377\262\262\326"
+ 448      B2B2D5FF 
+ 448      B2B2D6FF 
+ 448      B2B2D6
+ 449 1967 FFB2B2D6 		.ascii	"\377\262\262\326\377\263\262\326\377\263\263\326\377\263\263"
+ 449      FFB3B2D6 
+ 449      FFB3B3D6 
+ 449      FFB3B3
+ 450 1976 D6FFB3B3 		.ascii	"\326\377\263\263\326\377\263\263\326\377\263\264\326\377\264"
+ 450      D6FFB3B3 
+ 450      D6FFB3B4 
+ 450      D6FFB4
+GAS LISTING /tmp/cc4tpqxY.s 			page 31
+
+
+ 451 1985 B4D7FFB4 		.ascii	"\264\327\377\264\264\327\377\264\264\327\377\264\264\327\377"
+ 451      B4D7FFB4 
+ 451      B4D7FFB4 
+ 451      B4D7FF
+ 452 1994 B4B5D7FF 		.ascii	"\264\265\327\377\265\265\327\377\265\265\327\377\265\265\327"
+ 452      B5B5D7FF 
+ 452      B5B5D7FF 
+ 452      B5B5D7
+ 453 19a3 FFB5B5D8 		.ascii	"\377\265\265\330\377\265\266\330\377\266\266\330\377\266\266"
+ 453      FFB5B6D8 
+ 453      FFB6B6D8 
+ 453      FFB6B6
+ 454 19b2 D8FFB6B6 		.ascii	"\330\377\266\266\330\377\266\267\330\377\266\267\330\377\267"
+ 454      D8FFB6B7 
+ 454      D8FFB6B7 
+ 454      D8FFB7
+ 455 19c1 B7D8FFB7 		.ascii	"\267\330\377\267\267\331\377\267\267\331\377\267\270\331\377"
+ 455      B7D9FFB7 
+ 455      B7D9FFB7 
+ 455      B8D9FF
+ 456 19d0 B7B8D9FF 		.ascii	"\267\270\331\377\270\270\331\377\270\270\331\377\270\271\331"
+ 456      B8B8D9FF 
+ 456      B8B8D9FF 
+ 456      B8B9D9
+ 457 19df FFB8B9D9 		.ascii	"\377\270\271\331\377\270\271\332\377\271\271\332\377\271\271"
+ 457      FFB8B9DA 
+ 457      FFB9B9DA 
+ 457      FFB9B9
+ 458 19ee DAFFB9BA 		.ascii	"\332\377\271\272\332\377\271\272\332\377\271\272\332\377\272"
+ 458      DAFFB9BA 
+ 458      DAFFB9BA 
+ 458      DAFFBA
+ 459 19fd BADAFFBA 		.ascii	"\272\332\377\272\273\332\377\272\273\333\377\272\273\333\377"
+ 459      BBDAFFBA 
+ 459      BBDBFFBA 
+ 459      BBDBFF
+ 460 1a0c BABBDBFF 		.ascii	"\272\273\333\377\273\273\333\377\273\274\333\377\273\274\333"
+ 460      BBBBDBFF 
+ 460      BBBCDBFF 
+ 460      BBBCDB
+ 461 1a1b FFBBBCDB 		.ascii	"\377\273\274\333\377\273\274\333\377\273\275\333\377\274\275"
+ 461      FFBBBCDB 
+ 461      FFBBBDDB 
+ 461      FFBCBD
+ 462 1a2a DCFFBCBD 		.ascii	"\334\377\274\275\334\377\274\275\334\377\274\275\334\377\274"
+ 462      DCFFBCBD 
+ 462      DCFFBCBD 
+ 462      DCFFBC
+ 463 1a39 BDDCFFBD 		.ascii	"\275\334\377\275\276\334\377\275\276\334\377\275\276\334\377"
+ 463      BEDCFFBD 
+ 463      BEDCFFBD 
+ 463      BEDCFF
+ 464 1a48 BDBEDCFF 		.ascii	"\275\276\334\377\275\276\334\377\276\276\335\377\276\277\335"
+ 464      BDBEDCFF 
+ 464      BEBEDDFF 
+ 464      BEBFDD
+ 465 1a57 FFBEBFDD 		.ascii	"\377\276\277\335\377\276\277\335\377\276\277\335\377\277\277"
+GAS LISTING /tmp/cc4tpqxY.s 			page 32
+
+
+ 465      FFBEBFDD 
+ 465      FFBEBFDD 
+ 465      FFBFBF
+ 466 1a66 DDFFBFC0 		.ascii	"\335\377\277\300\335\377\277\300\335\377\277\300\335\377\277"
+ 466      DDFFBFC0 
+ 466      DDFFBFC0 
+ 466      DDFFBF
+ 467 1a75 C0DDFFBF 		.ascii	"\300\335\377\277\300\335\377\300\300\336\377\300\301\336\377"
+ 467      C0DDFFC0 
+ 467      C0DEFFC0 
+ 467      C1DEFF
+ 468 1a84 C0C1DEFF 		.ascii	"\300\301\336\377\300\301\336\377\300\301\336\377\301\301\336"
+ 468      C0C1DEFF 
+ 468      C0C1DEFF 
+ 468      C1C1DE
+ 469 1a93 FFC1C2DE 		.ascii	"\377\301\302\336\377\301\302\336\377\301\302\336\377\301\302"
+ 469      FFC1C2DE 
+ 469      FFC1C2DE 
+ 469      FFC1C2
+ 470 1aa2 DEFFC2C2 		.ascii	"\336\377\302\302\336\377\302\302\337\377\302\303\337\377\302"
+ 470      DEFFC2C2 
+ 470      DFFFC2C3 
+ 470      DFFFC2
+ 471 1ab1 C3DFFFC2 		.ascii	"\303\337\377\302\303\337\377\302\303\337\377\303\303\337\377"
+ 471      C3DFFFC2 
+ 471      C3DFFFC3 
+ 471      C3DFFF
+ 472 1ac0 C3C3DFFF 		.ascii	"\303\303\337\377\303\304\337\377\303\304\337\377\303\304\337"
+ 472      C3C4DFFF 
+ 472      C3C4DFFF 
+ 472      C3C4DF
+ 473 1acf FFC4C4E0 		.ascii	"\377\304\304\340\377\304\304\340\377\304\305\340\377\304\305"
+ 473      FFC4C4E0 
+ 473      FFC4C5E0 
+ 473      FFC4C5
+ 474 1ade E0FFC4C5 		.ascii	"\340\377\304\305\340\377\305\305\340\377\305\305\340\377\305"
+ 474      E0FFC5C5 
+ 474      E0FFC5C5 
+ 474      E0FFC5
+ 475 1aed C5E0FFC5 		.ascii	"\305\340\377\305\306\340\377\305\306\340\377\305\306\340\377"
+ 475      C6E0FFC5 
+ 475      C6E0FFC5 
+ 475      C6E0FF
+ 476 1afc C6C6E1FF 		.ascii	"\306\306\341\377\306\306\341\377\306\307\341\377\306\307\341"
+ 476      C6C6E1FF 
+ 476      C6C7E1FF 
+ 476      C6C7E1
+ 477 1b0b FFC6C7E1 		.ascii	"\377\306\307\341\377\307\307\341\377\307\307\341\377\307\307"
+ 477      FFC7C7E1 
+ 477      FFC7C7E1 
+ 477      FFC7C7
+ 478 1b1a E1FFC7C8 		.ascii	"\341\377\307\310\341\377\307\310\341\377\316\316\344\377\316"
+ 478      E1FFC7C8 
+ 478      E1FFCECE 
+ 478      E4FFCE
+ 479 1b29 CEE5FFCE 		.ascii	"\316\345\377\316\316\345\377\316\316\345\377\316\317\345\377"
+ 479      CEE5FFCE 
+GAS LISTING /tmp/cc4tpqxY.s 			page 33
+
+
+ 479      CEE5FFCE 
+ 479      CFE5FF
+ 480 1b38 CECFE5FF 		.ascii	"\316\317\345\377\317\317\345\377\317\317\345\377\317\317\345"
+ 480      CFCFE5FF 
+ 480      CFCFE5FF 
+ 480      CFCFE5
+ 481 1b47 FFCFCFE5 		.ascii	"\377\317\317\345\377\317\320\345\377\320\320\346\377\320\320"
+ 481      FFCFD0E5 
+ 481      FFD0D0E6 
+ 481      FFD0D0
+ 482 1b56 E6FFD0D0 		.ascii	"\346\377\320\320\346\377\320\320\346\377\320\321\346\377\321"
+ 482      E6FFD0D0 
+ 482      E6FFD0D1 
+ 482      E6FFD1
+ 483 1b65 D1E6FFD1 		.ascii	"\321\346\377\321\321\346\377\321\321\346\377\321\321\346\377"
+ 483      D1E6FFD1 
+ 483      D1E6FFD1 
+ 483      D1E6FF
+ 484 1b74 D1D1E6FF 		.ascii	"\321\321\346\377\321\322\346\377\322\322\347\377\322\322\347"
+ 484      D1D2E6FF 
+ 484      D2D2E7FF 
+ 484      D2D2E7
+ 485 1b83 FFD2D2E7 		.ascii	"\377\322\322\347\377\322\322\347\377\322\323\347\377\323\323"
+ 485      FFD2D2E7 
+ 485      FFD2D3E7 
+ 485      FFD3D3
+ 486 1b92 E7FFD3D3 		.ascii	"\347\377\323\323\347\377\323\323\347\377\323\323\347\377\323"
+ 486      E7FFD3D3 
+ 486      E7FFD3D3 
+ 486      E7FFD3
+ 487 1ba1 D3E7FFD4 		.ascii	"\323\347\377\324\324\347\377\324\324\350\377\324\324\350\377"
+ 487      D4E7FFD4 
+ 487      D4E8FFD4 
+ 487      D4E8FF
+ 488 1bb0 D4D4E8FF 		.ascii	"\324\324\350\377\324\324\350\377\324\325\350\377\325\325\350"
+ 488      D4D4E8FF 
+ 488      D4D5E8FF 
+ 488      D5D5E8
+ 489 1bbf FFD5D5E8 		.ascii	"\377\325\325\350\377\325\325\350\377\325\325\350\377\325\325"
+ 489      FFD5D5E8 
+ 489      FFD5D5E8 
+ 489      FFD5D5
+ 490 1bce E8FFD6D6 		.ascii	"\350\377\326\326\351\377\326\326\351\377\326\326\351\377\326"
+ 490      E9FFD6D6 
+ 490      E9FFD6D6 
+ 490      E9FFD6
+ 491 1bdd D6E9FFD6 		.ascii	"\326\351\377\326\326\351\377\327\327\351\377\327\327\351\377"
+ 491      D6E9FFD7 
+ 491      D7E9FFD7 
+ 491      D7E9FF
+ 492 1bec D7D7E9FF 		.ascii	"\327\327\351\377\327\327\351\377\327\327\351\377\327\327\351"
+ 492      D7D7E9FF 
+ 492      D7D7E9FF 
+ 492      D7D7E9
+ 493 1bfb FFD8D8EA 		.ascii	"\377\330\330\352\377\330\330\352\377\330\330\352\377\330\330"
+ 493      FFD8D8EA 
+ 493      FFD8D8EA 
+GAS LISTING /tmp/cc4tpqxY.s 			page 34
+
+
+ 493      FFD8D8
+ 494 1c0a EAFFD8D8 		.ascii	"\352\377\330\330\352\377\331\331\352\377\331\331\352\377\331"
+ 494      EAFFD9D9 
+ 494      EAFFD9D9 
+ 494      EAFFD9
+ 495 1c19 D9EAFFD9 		.ascii	"\331\352\377\331\331\352\377\331\331\352\377\331\332\352\377"
+ 495      D9EAFFD9 
+ 495      D9EAFFD9 
+ 495      DAEAFF
+ 496 1c28 DADAEBFF 		.ascii	"\332\332\353\377\332\332\353\377\332\332\353\377\332\332\353"
+ 496      DADAEBFF 
+ 496      DADAEBFF 
+ 496      DADAEB
+ 497 1c37 FFDADAEB 		.ascii	"\377\332\332\353\377\332\332\353\377\332\332\353\377\333\332"
+ 497      FFDADAEB 
+ 497      FFDADAEB 
+ 497      FFDBDA
+ 498 1c46 EBFFDBDB 		.ascii	"\353\377\333\333\353\377\333\333\353\377\333\333\353\377\333"
+ 498      EBFFDBDB 
+ 498      EBFFDBDB 
+ 498      EBFFDB
+ 499 1c55 DBEBFFDB 		.ascii	"\333\353\377\333\333\353\377\333\333\353\377\334\333\353\377"
+ 499      DBEBFFDB 
+ 499      DBEBFFDC 
+ 499      DBEBFF
+ 500 1c64 DCDBEBFF 		.ascii	"\334\333\353\377\334\333\354\377\334\334\354\377\334\334\354"
+ 500      DCDBECFF 
+ 500      DCDCECFF 
+ 500      DCDCEC
+ 501 1c73 FFDCDCEC 		.ascii	"\377\334\334\354\377\334\334\354\377\335\334\354\377\335\334"
+ 501      FFDCDCEC 
+ 501      FFDDDCEC 
+ 501      FFDDDC
+ 502 1c82 ECFFDDDC 		.ascii	"\354\377\335\334\354\377\335\334\354\377\335\335\354\377\335"
+ 502      ECFFDDDC 
+ 502      ECFFDDDD 
+ 502      ECFFDD
+ 503 1c91 DDECFFDD 		.ascii	"\335\354\377\335\335\354\377\336\335\354\377\336\335\354\377"
+ 503      DDECFFDE 
+ 503      DDECFFDE 
+ 503      DDECFF
+ 504 1ca0 DEDDECFF 		.ascii	"\336\335\354\377\336\335\354\377\336\335\354\377\336\335\355"
+ 504      DEDDECFF 
+ 504      DEDDECFF 
+ 504      DEDDED
+ 505 1caf FFDEDEED 		.ascii	"\377\336\336\355\377\336\336\355\377\337\336\355\377\337\336"
+ 505      FFDEDEED 
+ 505      FFDFDEED 
+ 505      FFDFDE
+ 506 1cbe EDFFDFDE 		.ascii	"\355\377\337\336\355\377\337\336\355\377\337\336\355\377\337"
+ 506      EDFFDFDE 
+ 506      EDFFDFDE 
+ 506      EDFFDF
+ 507 1ccd DEEDFFDF 		.ascii	"\336\355\377\337\336\355\377\340\337\355\377\340\337\355\377"
+ 507      DEEDFFE0 
+ 507      DFEDFFE0 
+ 507      DFEDFF
+GAS LISTING /tmp/cc4tpqxY.s 			page 35
+
+
+ 508 1cdc E0DFEDFF 		.ascii	"\340\337\355\377\340\337\355\377\340\337\355\377\340\337\355"
+ 508      E0DFEDFF 
+ 508      E0DFEDFF 
+ 508      E0DFED
+ 509 1ceb FFE0DFEE 		.ascii	"\377\340\337\356\377\341\337\356\377\341\340\356\377\341\340"
+ 509      FFE1DFEE 
+ 509      FFE1E0EE 
+ 509      FFE1E0
+ 510 1cfa EEFFE1E0 		.ascii	"\356\377\341\340\356\377\341\340\356\377\341\340\356\377\341"
+ 510      EEFFE1E0 
+ 510      EEFFE1E0 
+ 510      EEFFE1
+ 511 1d09 E0EEFFE1 		.ascii	"\340\356\377\341\340\356\377\342\340\356\377\342\341\356\377"
+ 511      E0EEFFE2 
+ 511      E0EEFFE2 
+ 511      E1EEFF
+ 512 1d18 E2E1EEFF 		.ascii	"\342\341\356\377\342\341\356\377\342\341\356\377\346\345\360"
+ 512      E2E1EEFF 
+ 512      E2E1EEFF 
+ 512      E6E5F0
+ 513 1d27 FFE7E5F0 		.ascii	"\377\347\345\360\377\347\345\361\377\347\345\361\377\347\345"
+ 513      FFE7E5F1 
+ 513      FFE7E5F1 
+ 513      FFE7E5
+ 514 1d36 F1FFE7E5 		.ascii	"\361\377\347\345\361\377\347\345\361\377\347\346\361\377\347"
+ 514      F1FFE7E5 
+ 514      F1FFE7E6 
+ 514      F1FFE7
+ 515 1d45 E6F1FFE8 		.ascii	"\346\361\377\350\346\361\377\350\346\361\377\350\346\361\377"
+ 515      E6F1FFE8 
+ 515      E6F1FFE8 
+ 515      E6F1FF
+ 516 1d54 E8E6F1FF 		.ascii	"\350\346\361\377\350\346\361\377\350\346\361\377\350\347\361"
+ 516      E8E6F1FF 
+ 516      E8E6F1FF 
+ 516      E8E7F1
+ 517 1d63 FFE9E7F1 		.ascii	"\377\351\347\361\377\351\347\361\377\351\347\362\377\351\347"
+ 517      FFE9E7F1 
+ 517      FFE9E7F2 
+ 517      FFE9E7
+ 518 1d72 F2FFE9E7 		.ascii	"\362\377\351\347\362\377\351\347\362\377\351\347\362\377\351"
+ 518      F2FFE9E7 
+ 518      F2FFE9E7 
+ 518      F2FFE9
+ 519 1d81 E8F2FFEA 		.ascii	"\350\362\377\352\350\362\377\352\350\362\377\352\350\362\377"
+ 519      E8F2FFEA 
+ 519      E8F2FFEA 
+ 519      E8F2FF
+ 520 1d90 EAE8F2FF 		.ascii	"\352\350\362\377\352\350\362\377\352\350\362\377\352\350\362"
+ 520      EAE8F2FF 
+ 520      EAE8F2FF 
+ 520      EAE8F2
+ 521 1d9f FFEAE8F2 		.ascii	"\377\352\350\362\377\353\351\362\377\353\351\362\377\353\351"
+ 521      FFEBE9F2 
+ 521      FFEBE9F2 
+ 521      FFEBE9
+ 522 1dae F3FFEBE9 		.ascii	"\363\377\353\351\363\377\353\351\363\377\353\351\363\377\353"
+GAS LISTING /tmp/cc4tpqxY.s 			page 36
+
+
+ 522      F3FFEBE9 
+ 522      F3FFEBE9 
+ 522      F3FFEB
+ 523 1dbd E9F3FFEB 		.ascii	"\351\363\377\353\351\363\377\354\352\363\377\354\352\363\377"
+ 523      E9F3FFEC 
+ 523      EAF3FFEC 
+ 523      EAF3FF
+ 524 1dcc ECEAF3FF 		.ascii	"\354\352\363\377\354\352\363\377\354\352\363\377\354\352\363"
+ 524      ECEAF3FF 
+ 524      ECEAF3FF 
+ 524      ECEAF3
+ 525 1ddb FFECEAF3 		.ascii	"\377\354\352\363\377\354\352\363\377\355\353\363\377\355\353"
+ 525      FFECEAF3 
+ 525      FFEDEBF3 
+ 525      FFEDEB
+ 526 1dea F4FFEDEB 		.ascii	"\364\377\355\353\364\377\355\353\364\377\355\353\364\377\355"
+ 526      F4FFEDEB 
+ 526      F4FFEDEB 
+ 526      F4FFED
+ 527 1df9 EBF4FFED 		.ascii	"\353\364\377\355\353\364\377\355\353\364\377\356\354\364\377"
+ 527      EBF4FFED 
+ 527      EBF4FFEE 
+ 527      ECF4FF
+ 528 1e08 EEECF4FF 		.ascii	"\356\354\364\377\356\354\364\377\356\354\364\377\356\354\364"
+ 528      EEECF4FF 
+ 528      EEECF4FF 
+ 528      EEECF4
+ 529 1e17 FFEEECF4 		.ascii	"\377\356\354\364\377\356\354\364\377\356\354\364\377\356\355"
+ 529      FFEEECF4 
+ 529      FFEEECF4 
+ 529      FFEEED
+ 530 1e26 F4FFEFED 		.ascii	"\364\377\357\355\365\377\357\355\365\377\357\355\365\377\357"
+ 530      F5FFEFED 
+ 530      F5FFEFED 
+ 530      F5FFEF
+ 531 1e35 EDF5FFEF 		.ascii	"\355\365\377\357\355\365\377\357\355\365\377\357\355\365\377"
+ 531      EDF5FFEF 
+ 531      EDF5FFEF 
+ 531      EDF5FF
+ 532 1e44 EFEDF5FF 		.ascii	"\357\355\365\377\357\355\365\377\357\355\365\377\357\355\365"
+ 532      EFEDF5FF 
+ 532      EFEDF5FF 
+ 532      EFEDF5
+ 533 1e53 FFF0EEF5 		.ascii	"\377\360\356\365\377\360\356\365\377\360\356\365\377\360\356"
+ 533      FFF0EEF5 
+ 533      FFF0EEF5 
+ 533      FFF0EE
+ 534 1e62 F5FFF0EE 		.ascii	"\365\377\360\356\365\377\360\356\365\377\360\356\365\377\360"
+ 534      F5FFF0EE 
+ 534      F5FFF0EE 
+ 534      F5FFF0
+ 535 1e71 EEF5FFF0 		.ascii	"\356\365\377\360\356\365\377\360\356\366\377\360\356\366\377"
+ 535      EEF5FFF0 
+ 535      EEF6FFF0 
+ 535      EEF6FF
+ 536 1e80 F0EEF6FF 		.ascii	"\360\356\366\377\361\357\366\377\361\357\366\377\361\357\366"
+ 536      F1EFF6FF 
+GAS LISTING /tmp/cc4tpqxY.s 			page 37
+
+
+ 536      F1EFF6FF 
+ 536      F1EFF6
+ 537 1e8f FFF1EFF6 		.ascii	"\377\361\357\366\377\361\357\366\377\361\357\366\377\361\357"
+ 537      FFF1EFF6 
+ 537      FFF1EFF6 
+ 537      FFF1EF
+ 538 1e9e F6FFF1EF 		.ascii	"\366\377\361\357\366\377\361\357\366\377\361\357\366\377\361"
+ 538      F6FFF1EF 
+ 538      F6FFF1EF 
+ 538      F6FFF1
+ 539 1ead EFF6FFF2 		.ascii	"\357\366\377\362\360\366\377\362\360\366\377\362\360\366\377"
+ 539      F0F6FFF2 
+ 539      F0F6FFF2 
+ 539      F0F6FF
+ 540 1ebc F2F0F6FF 		.ascii	"\362\360\366\377\362\360\366\377\362\360\366\377\362\360\366"
+ 540      F2F0F6FF 
+ 540      F2F0F6FF 
+ 540      F2F0F6
+ 541 1ecb FFF2F0F7 		.ascii	"\377\362\360\367\377\362\360\367\377\362\360\367\377\362\360"
+ 541      FFF2F0F7 
+ 541      FFF2F0F7 
+ 541      FFF2F0
+ 542 1eda F7FFF2F0 		.ascii	"\367\377\362\360\367\377\363\361\367\377\363\361\367\377\363"
+ 542      F7FFF3F1 
+ 542      F7FFF3F1 
+ 542      F7FFF3
+ 543 1ee9 F1F7FFF3 		.ascii	"\361\367\377\363\361\367\377\363\361\367\377\363\361\367\377"
+ 543      F1F7FFF3 
+ 543      F1F7FFF3 
+ 543      F1F7FF
+ 544 1ef8 F3F1F7FF 		.ascii	"\363\361\367\377\363\361\367\377\363\361\367\377\363\361\367"
+ 544      F3F1F7FF 
+ 544      F3F1F7FF 
+ 544      F3F1F7
+ 545 1f07 FFF3F1F7 		.ascii	"\377\363\361\367\377\363\362\367\377\364\362\367\377\364\362"
+ 545      FFF3F2F7 
+ 545      FFF4F2F7 
+ 545      FFF4F2
+ 546 1f16 F7FFF4F2 		.ascii	"\367\377\364\362\367\377\364\362\370\377\364\362\370\377\367"
+ 546      F7FFF4F2 
+ 546      F8FFF4F2 
+ 546      F8FFF7
+ 547 1f25 F5F9FFF7 		.ascii	"\365\371\377\367\365\371\377\367\365\371\377\367\365\371\377"
+ 547      F5F9FFF7 
+ 547      F5F9FFF7 
+ 547      F5F9FF
+ 548 1f34 F7F5F9FF 		.ascii	"\367\365\371\377\367\365\371\377\367\365\372\377\367\365\372"
+ 548      F7F5F9FF 
+ 548      F7F5FAFF 
+ 548      F7F5FA
+ 549 1f43 FFF7F6FA 		.ascii	"\377\367\366\372\377\367\366\372\377\367\366\372\377\367\366"
+ 549      FFF7F6FA 
+ 549      FFF7F6FA 
+ 549      FFF7F6
+ 550 1f52 FAFFF7F6 		.ascii	"\372\377\367\366\372\377\370\366\372\377\370\366\372\377\370"
+ 550      FAFFF8F6 
+ 550      FAFFF8F6 
+GAS LISTING /tmp/cc4tpqxY.s 			page 38
+
+
+ 550      FAFFF8
+ 551 1f61 F6FAFFF8 		.ascii	"\366\372\377\370\366\372\377\370\366\372\377\370\366\372\377"
+ 551      F6FAFFF8 
+ 551      F6FAFFF8 
+ 551      F6FAFF
+ 552 1f70 F8F6FAFF 		.ascii	"\370\366\372\377\370\367\372\377\370\367\372\377\370\367\372"
+ 552      F8F7FAFF 
+ 552      F8F7FAFF 
+ 552      F8F7FA
+ 553 1f7f FFF8F7FA 		.ascii	"\377\370\367\372\377\370\367\372\377\371\367\372\377\371\367"
+ 553      FFF8F7FA 
+ 553      FFF9F7FA 
+ 553      FFF9F7
+ 554 1f8e FBFFF9F7 		.ascii	"\373\377\371\367\373\377\371\367\373\377\371\367\373\377\371"
+ 554      FBFFF9F7 
+ 554      FBFFF9F7 
+ 554      FBFFF9
+ 555 1f9d F7FBFFF9 		.ascii	"\367\373\377\371\370\373\377\371\370\373\377\371\370\373\377"
+ 555      F8FBFFF9 
+ 555      F8FBFFF9 
+ 555      F8FBFF
+ 556 1fac F9F8FBFF 		.ascii	"\371\370\373\377\371\370\373\377\371\370\373\377\371\370\373"
+ 556      F9F8FBFF 
+ 556      F9F8FBFF 
+ 556      F9F8FB
+ 557 1fbb FFFAF8FB 		.ascii	"\377\372\370\373\377"
+ 557      FF
+ 558 1fc0 FAF8FBFF 		.ascii	"\372\370\373\377\372\370\373\377\372\370\373\377\372\371\373"
+ 558      FAF8FBFF 
+ 558      FAF8FBFF 
+ 558      FAF9FB
+ 559 1fcf FFFAF9FB 		.ascii	"\377\372\371\373\377\372\371\373\377\372\371\373\377\372\371"
+ 559      FFFAF9FB 
+ 559      FFFAF9FB 
+ 559      FFFAF9
+ 560 1fde FCFFFAF9 		.ascii	"\374\377\372\371\374\377\372\371\374\377\372\371\374\377\372"
+ 560      FCFFFAF9 
+ 560      FCFFFAF9 
+ 560      FCFFFA
+ 561 1fed F9FCFFFB 		.ascii	"\371\374\377\373\371\374\377\373\371\374\377\373\372\374\377"
+ 561      F9FCFFFB 
+ 561      F9FCFFFB 
+ 561      FAFCFF
+ 562 1ffc FBFAFCFF 		.ascii	"\373\372\374\377\373\372\374\377\373\372\374\377\373\372\374"
+ 562      FBFAFCFF 
+ 562      FBFAFCFF 
+ 562      FBFAFC
+ 563 200b FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 563      FFFBFAFC 
+ 563      FFFBFAFC 
+ 563      FFFBFA
+ 564 201a FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377"
+ 564      FCFFFBFA 
+ 564      FCFF
+ 565              		.globl	heatmap_cs_Purples_soft
+ 566              		.section	.data.rel.local
+ 567              		.align 8
+GAS LISTING /tmp/cc4tpqxY.s 			page 39
+
+
+ 568              		.type	heatmap_cs_Purples_soft, @object
+ 569              		.size	heatmap_cs_Purples_soft, 8
+ 570              	heatmap_cs_Purples_soft:
+ 571 0010 00000000 		.quad	soft
+ 571      00000000 
+ 572              		.section	.data.rel.ro.local
+ 573              		.align 16
+ 574              		.type	soft, @object
+ 575              		.size	soft, 16
+ 576              	soft:
+ 577 0020 00000000 		.quad	soft_data
+ 577      00000000 
+ 578 0028 01040000 		.quad	1025
+ 578      00000000 
+ 579              		.section	.rodata
+ 580 2024 00000000 		.align 32
+ 580      00000000 
+ 580      00000000 
+ 580      00000000 
+ 580      00000000 
+ 581              		.type	soft_data, @object
+ 582              		.size	soft_data, 4100
+ 583              	soft_data:
+ 584 2040 00       		.string	""
+ 585 2041 00       		.string	""
+ 586 2042 00       		.string	""
+ 587 2043 00       		.string	""
+ 588 2044 3F00     		.string	"?"
+ 589 2046 7D00     		.string	"}"
+ 590 2048 3F00     		.string	"?"
+ 591 204a 7D073F00 		.string	"}\007?"
+ 592 204e 7D0E3F01 		.ascii	"}\016?\001}\026?\001}\035?\001}%@\002},@\002}4@\002~;@\003~C"
+ 592      7D163F01 
+ 592      7D1D3F01 
+ 592      7D254002 
+ 592      7D2C4002 
+ 593 206c 40037E4A 		.ascii	"@\003~J@\003~RA\004~YA\004~aA\005~hA\005\177pA\005\177wA\006"
+ 593      40037E52 
+ 593      41047E59 
+ 593      41047E61 
+ 593      41057E68 
+ 594 208a 7F7F4206 		.ascii	"\177\177B\006\177\206B\007\177\215B\007\177\225B\007\177\234"
+ 594      7F864207 
+ 594      7F8D4207 
+ 594      7F954207 
+ 594      7F9C
+ 595 209c 420880A4 		.ascii	"B\b\200\244B\b\200\253C\t\200\263C\t\200\272C\t\200\302C\n\200"
+ 595      420880AB 
+ 595      430980B3 
+ 595      430980BA 
+ 595      430980C2 
+ 596 20b3 C9430A80 		.ascii	"\311C\n\200\321C\013\201\330D\013\201\340D\013\201\347D\f\201"
+ 596      D1430B81 
+ 596      D8440B81 
+ 596      E0440B81 
+ 596      E7440C81 
+ 597 20c7 EF440C81 		.ascii	"\357D\f\201\366D\f\201\376D\r\201\377D\r\202\377E\016\202\377"
+GAS LISTING /tmp/cc4tpqxY.s 			page 40
+
+
+ 597      F6440C81 
+ 597      FE440D81 
+ 597      FF440D82 
+ 597      FF450E82 
+ 598 20dc 450E82FF 		.ascii	"E\016\202\377E\016\202\377E\017\202\377E\017\202\377E\017\202"
+ 598      450E82FF 
+ 598      450F82FF 
+ 598      450F82FF 
+ 598      450F82
+ 599 20ef FF461083 		.ascii	"\377F\020\203\377F\020\203\377F\020\203\377F\021\203\377F\021"
+ 599      FF461083 
+ 599      FF461083 
+ 599      FF461183 
+ 599      FF4611
+ 600 2102 83FF4611 		.ascii	"\203\377F\021\203\377G\022\203\377G\022\204\377G\022\204\377"
+ 600      83FF4712 
+ 600      83FF4712 
+ 600      84FF4712 
+ 600      84FF
+ 601 2114 471284FF 		.ascii	"G\022\204\377G\023\204\377G\023\204\377H\023\204\377H\024\204"
+ 601      471384FF 
+ 601      471384FF 
+ 601      481384FF 
+ 601      481484
+ 602 2127 FF481485 		.ascii	"\377H\024\205\377H\024\205\377H\025\205\377H\025\205\377I\025"
+ 602      FF481485 
+ 602      FF481585 
+ 602      FF481585 
+ 602      FF4915
+ 603 213a 85FF4915 		.ascii	"\205\377I\025\205\377I\026\205\377I\026\206\377I\026\206\377"
+ 603      85FF4916 
+ 603      85FF4916 
+ 603      86FF4916 
+ 603      86FF
+ 604 214c 491786FF 		.ascii	"I\027\206\377J\027\206\377J\027\206\377J\027\206\377J\030\206"
+ 604      4A1786FF 
+ 604      4A1786FF 
+ 604      4A1786FF 
+ 604      4A1886
+ 605 215f FF4A1887 		.ascii	"\377J\030\207\377J\030\207\377K\031\207\377K\031\207\377K\031"
+ 605      FF4A1887 
+ 605      FF4B1987 
+ 605      FF4B1987 
+ 605      FF4B19
+ 606 2172 87FF4B19 		.ascii	"\207\377K\031\207\377K\032\207\377K\032\210\377L\032\210\377"
+ 606      87FF4B1A 
+ 606      87FF4B1A 
+ 606      88FF4C1A 
+ 606      88FF
+ 607 2184 4C1B88FF 		.ascii	"L\033\210\377L\033\210\377L\033\210\377L\033\210\377L\034\210"
+ 607      4C1B88FF 
+ 607      4C1B88FF 
+ 607      4C1B88FF 
+ 607      4C1C88
+ 608 2197 FF4D1C88 		.ascii	"\377M\034\210\377M\034\211\377M\034\211\377M\035\211\377M\035"
+ 608      FF4D1C89 
+ 608      FF4D1C89 
+GAS LISTING /tmp/cc4tpqxY.s 			page 41
+
+
+ 608      FF4D1D89 
+ 608      FF4D1D
+ 609 21aa 89FF4D1D 		.ascii	"\211\377M\035\211\377N\035\211\377N\036\211\377N\036\212\377"
+ 609      89FF4E1D 
+ 609      89FF4E1E 
+ 609      89FF4E1E 
+ 609      8AFF
+ 610 21bc 4E1E8AFF 		.ascii	"N\036\212\377N\036\212\377N\037\212\377N\037\212\377O\037\212"
+ 610      4E1E8AFF 
+ 610      4E1F8AFF 
+ 610      4E1F8AFF 
+ 610      4F1F8A
+ 611 21cf FF4F1F8A 		.ascii	"\377O\037\212\377O \213\377O \213\377O \213\377O \213\377P!\213"
+ 611      FF4F208B 
+ 611      FF4F208B 
+ 611      FF4F208B 
+ 611      FF4F208B 
+ 612 21e7 FF50218B 		.ascii	"\377P!\213\377P!\213\377P!\214\377P\"\214\377P\"\214\377Q\"\214"
+ 612      FF50218B 
+ 612      FF50218C 
+ 612      FF50228C 
+ 612      FF50228C 
+ 613 21ff FF51228C 		.ascii	"\377Q\"\214\377Q#\214\377Q#\214\377Q#\215\377Q#\215\377R$\215"
+ 613      FF51238C 
+ 613      FF51238C 
+ 613      FF51238D 
+ 613      FF51238D 
+ 614 2217 FF52248D 		.ascii	"\377R$\215\377R$\215\377R$\215\377R%\215\377R%\216\377S%\216"
+ 614      FF52248D 
+ 614      FF52248D 
+ 614      FF52258D 
+ 614      FF52258E 
+ 615 222f FF53258E 		.ascii	"\377S%\216\377S&\216\377S&\216\377S&\216\377S&\216\377S'\217"
+ 615      FF53268E 
+ 615      FF53268E 
+ 615      FF53268E 
+ 615      FF53268E 
+ 616 2247 FF54278F 		.ascii	"\377T'\217\377T'\217\377T(\217\377T(\217\377T(\217\377T)\220"
+ 616      FF54278F 
+ 616      FF54288F 
+ 616      FF54288F 
+ 616      FF54288F 
+ 617 225f FF552990 		.ascii	"\377U)\220\377U)\220\377U*\220\377U*\220\377U+\220\377U+\221"
+ 617      FF552990 
+ 617      FF552A90 
+ 617      FF552A90 
+ 617      FF552B90 
+ 618 2277 FF562B91 		.ascii	"\377V+\221\377V,\221\377V,\221\377V,\221\377V-\221\377V-\222"
+ 618      FF562C91 
+ 618      FF562C91 
+ 618      FF562C91 
+ 618      FF562D91 
+ 619 228f FF572D92 		.ascii	"\377W-\222\377W.\222\377W.\222\377W.\222\377W/\222\377W/\222"
+ 619      FF572E92 
+ 619      FF572E92 
+ 619      FF572E92 
+ 619      FF572F92 
+GAS LISTING /tmp/cc4tpqxY.s 			page 42
+
+
+ 620 22a7 FF582F93 		.ascii	"\377X/\223\377X0\223\377X0\223\377X0\223\377X1\223\377X1\223"
+ 620      FF583093 
+ 620      FF583093 
+ 620      FF583093 
+ 620      FF583193 
+ 621 22bf FF593194 		.ascii	"\377Y1\224\377Y2\224\377Y2\224\377Y3\224\377Y3\224\377Y3\224"
+ 621      FF593294 
+ 621      FF593294 
+ 621      FF593394 
+ 621      FF593394 
+ 622 22d7 FF5A3495 		.ascii	"\377Z4\225\377Z4\225\377Z4\225\377Z5\225\377Z5\225\377Z5\225"
+ 622      FF5A3495 
+ 622      FF5A3495 
+ 622      FF5A3595 
+ 622      FF5A3595 
+ 623 22ef FF5B3696 		.ascii	"\377[6\226\377[6\226\377[6\226\377[7\226\377[7\226\377[7\226"
+ 623      FF5B3696 
+ 623      FF5B3696 
+ 623      FF5B3796 
+ 623      FF5B3796 
+ 624 2307 FF5C3897 		.ascii	"\377\\8\227\377\\8\227\377\\8\227\377\\8\227\377\\9\227\377\\"
+ 624      FF5C3897 
+ 624      FF5C3897 
+ 624      FF5C3897 
+ 624      FF5C3997 
+ 625 231d 3997FF5D 		.ascii	"9\227\377]9\227\377]:\230\377]:\230\377]:\230\377];\230\377]"
+ 625      3997FF5D 
+ 625      3A98FF5D 
+ 625      3A98FF5D 
+ 625      3A98FF5D 
+ 626 2335 3B98FF5E 		.ascii	";\230\377^;\230\377^<\231\377^<\231\377^<\231\377^=\231\377^"
+ 626      3B98FF5E 
+ 626      3C99FF5E 
+ 626      3C99FF5E 
+ 626      3C99FF5E 
+ 627 234d 3D99FF5F 		.ascii	"=\231\377_=\231\377_>\232\377_>\232\377_>\232\377_?\232\377`"
+ 627      3D99FF5F 
+ 627      3E9AFF5F 
+ 627      3E9AFF5F 
+ 627      3E9AFF5F 
+ 628 2365 3F9AFF60 		.ascii	"?\232\377`?\232\377`@\232\377`@\233\377`@\233\377`A\233\377a"
+ 628      3F9AFF60 
+ 628      409AFF60 
+ 628      409BFF60 
+ 628      409BFF60 
+ 629 237d 419BFF61 		.ascii	"A\233\377aA\233\377aB\233\377aB\234\377aB\234\377aB\234\377b"
+ 629      419BFF61 
+ 629      429BFF61 
+ 629      429CFF61 
+ 629      429CFF61 
+ 630 2395 439CFF62 		.ascii	"C\234\377bC\234\377bC\234\377bD\234\377bD\235\377bD\235\377c"
+ 630      439CFF62 
+ 630      439CFF62 
+ 630      449CFF62 
+ 630      449DFF62 
+ 631 23ad 459DFF63 		.ascii	"E\235\377cE\235\377cE\235\377cF\235\377cF\236\377dF\236\377d"
+ 631      459DFF63 
+GAS LISTING /tmp/cc4tpqxY.s 			page 43
+
+
+ 631      459DFF63 
+ 631      469DFF63 
+ 631      469EFF64 
+ 632 23c5 479EFF64 		.ascii	"G\236\377dG\236\377dG\236\377dH\236\377dH\236\377eH\237\377e"
+ 632      479EFF64 
+ 632      479EFF64 
+ 632      489EFF64 
+ 632      489EFF65 
+ 633 23dd 489FFF65 		.ascii	"H\237\377eI\237\377eI\237\377eI\237\377eJ\237\377fJ\237\377f"
+ 633      499FFF65 
+ 633      499FFF65 
+ 633      499FFF65 
+ 633      4A9FFF66 
+ 634 23f5 4AA0FF66 		.ascii	"J\240\377fK\240\377fK\240\377fK\240\377gL\240\377gL\240\377g"
+ 634      4BA0FF66 
+ 634      4BA0FF66 
+ 634      4BA0FF67 
+ 634      4CA0FF67 
+ 635 240d 4CA0FF67 		.ascii	"L\240\377gL\241\377gM\241\377gM\241\377hM\241\377hN\241\377h"
+ 635      4CA1FF67 
+ 635      4DA1FF67 
+ 635      4DA1FF68 
+ 635      4DA1FF68 
+ 636 2425 4EA1FF68 		.ascii	"N\241\377hN\241\377hO\242\377iO\242\377iO\242\377iP\242\377i"
+ 636      4EA1FF68 
+ 636      4FA2FF69 
+ 636      4FA2FF69 
+ 636      4FA2FF69 
+ 637 243d 50A2FF69 		.ascii	"P\242\377iP\242\377iQ\243\377jQ\243\377jQ\243\377jR\243\377j"
+ 637      50A2FF69 
+ 637      51A3FF6A 
+ 637      51A3FF6A 
+ 637      51A3FF6A 
+ 638 2455 52A3FF6A 		.ascii	"R\243\377jR\244\377jS\244\377jS\244\377kS\244\377kT\244\377k"
+ 638      52A4FF6A 
+ 638      53A4FF6A 
+ 638      53A4FF6B 
+ 638      53A4FF6B 
+ 639 246d 54A5FF6B 		.ascii	"T\245\377kT\245\377kU\245\377kU\245\377kU\245\377lV\246\377l"
+ 639      54A5FF6B 
+ 639      55A5FF6B 
+ 639      55A5FF6B 
+ 639      55A5FF6C 
+ 640 2485 56A6FF6C 		.ascii	"V\246\377lW\246\377lW\246\377lW\246\377lX\247\377lX\247\377m"
+ 640      57A6FF6C 
+ 640      57A6FF6C 
+ 640      57A6FF6C 
+ 640      58A7FF6C 
+ 641 249d 58A7FF6D 		.ascii	"X\247\377mY\247\377mY\247\377mY\247\377mZ\250\377mZ\250\377m"
+ 641      59A7FF6D 
+ 641      59A7FF6D 
+ 641      59A7FF6D 
+ 641      5AA8FF6D 
+ 642 24b5 5AA8FF6E 		.ascii	"Z\250\377n[\250\377n[\250\377n[\251\377n\\\251\377n\\\251\377"
+ 642      5BA8FF6E 
+ 642      5BA8FF6E 
+ 642      5BA9FF6E 
+GAS LISTING /tmp/cc4tpqxY.s 			page 44
+
+
+ 642      5CA9FF6E 
+ 643 24cc 6E5CA9FF 		.ascii	"n\\\251\377o]\251\377o]\252\377o^\252\377o^\252\377o^\252\377"
+ 643      6F5DA9FF 
+ 643      6F5DAAFF 
+ 643      6F5EAAFF 
+ 643      6F5EAAFF 
+ 644 24e4 6F5FAAFF 		.ascii	"o_\252\377o_\253\377p_\253\377p`\253\377p`\253\377p`\253\377"
+ 644      6F5FABFF 
+ 644      705FABFF 
+ 644      7060ABFF 
+ 644      7060ABFF 
+ 645 24fc 7061ABFF 		.ascii	"pa\253\377pa\254\377qa\254\377qb\254\377qb\254\377qb\254\377"
+ 645      7061ACFF 
+ 645      7161ACFF 
+ 645      7162ACFF 
+ 645      7162ACFF 
+ 646 2514 7163ADFF 		.ascii	"qc\255\377qc\255\377rc\255\377rd\255\377rd\255\377rd\256\377"
+ 646      7163ADFF 
+ 646      7263ADFF 
+ 646      7264ADFF 
+ 646      7264ADFF 
+ 647 252c 7265AEFF 		.ascii	"re\256\377re\256\377se\256\377sf\256\377sf\256\377sg\257\377"
+ 647      7265AEFF 
+ 647      7365AEFF 
+ 647      7366AEFF 
+ 647      7366AEFF 
+ 648 2544 7367AFFF 		.ascii	"sg\257\377sg\257\377th\257\377th\257\377th\257\377ti\260\377"
+ 648      7367AFFF 
+ 648      7468AFFF 
+ 648      7468AFFF 
+ 648      7468AFFF 
+ 649 255c 7469B0FF 		.ascii	"ti\260\377ti\260\377uj\260\377uj\260\377uj\261\377uk\261\377"
+ 649      7469B0FF 
+ 649      756AB0FF 
+ 649      756AB0FF 
+ 649      756AB1FF 
+ 650 2574 756BB1FF 		.ascii	"uk\261\377vk\261\377vl\261\377vl\261\377vl\262\377vm\262\377"
+ 650      766BB1FF 
+ 650      766CB1FF 
+ 650      766CB1FF 
+ 650      766CB2FF 
+ 651 258c 766DB2FF 		.ascii	"vm\262\377wm\262\377wn\262\377wn\262\377wn\263\377wo\263\377"
+ 651      776DB2FF 
+ 651      776EB2FF 
+ 651      776EB2FF 
+ 651      776EB3FF 
+ 652 25a4 786FB3FF 		.ascii	"xo\263\377xo\263\377xp\263\377xp\263\377xp\264\377xq\264\377"
+ 652      786FB3FF 
+ 652      7870B3FF 
+ 652      7870B3FF 
+ 652      7870B4FF 
+ 653 25bc 7971B4FF 		.ascii	"yq\264\377yq\264\377yr\264\377yr\264\377yr\265\377zs\265\377"
+ 653      7971B4FF 
+ 653      7972B4FF 
+ 653      7972B4FF 
+ 653      7972B5FF 
+ 654 25d4 7A73B5FF 		.ascii	"zs\265\377zs\265\377zt\265\377zt\265\377{t\266\377{u\266\377"
+GAS LISTING /tmp/cc4tpqxY.s 			page 45
+
+
+ 654      7A73B5FF 
+ 654      7A74B5FF 
+ 654      7A74B5FF 
+ 654      7B74B6FF 
+ 655 25ec 7B75B6FF 		.ascii	"{u\266\377{u\266\377{v\266\377|v\266\377|v\267\377|w\267\377"
+ 655      7B75B6FF 
+ 655      7B76B6FF 
+ 655      7C76B6FF 
+ 655      7C76B7FF 
+ 656 2604 7C77B7FF 		.ascii	"|w\267\377|w\267\377}x\267\377}x\267\377}x\270\377}y\270\377"
+ 656      7C77B7FF 
+ 656      7D78B7FF 
+ 656      7D78B7FF 
+ 656      7D78B8FF 
+ 657 261c 7D79B8FF 		.ascii	"}y\270\377~y\270\377~z\270\377~z\270\377~z\271\377~{\271\377"
+ 657      7E79B8FF 
+ 657      7E7AB8FF 
+ 657      7E7AB8FF 
+ 657      7E7AB9FF 
+ 658 2634 7F7BB9FF 		.ascii	"\177{\271\377\177{\271\377\177|\271\377\177|\271\377\177}\272"
+ 658      7F7BB9FF 
+ 658      7F7CB9FF 
+ 658      7F7CB9FF 
+ 658      7F7DBA
+ 659 2647 FF807DBA 		.ascii	"\377\200}\272\377\200}\272\377\200}\272\377\200}\272\377\201"
+ 659      FF807DBA 
+ 659      FF807DBA 
+ 659      FF807DBA 
+ 659      FF81
+ 660 2659 7EBAFF81 		.ascii	"~\272\377\201~\272\377\201~\272\377\201~\272\377\202\177\272"
+ 660      7EBAFF81 
+ 660      7EBAFF81 
+ 660      7EBAFF82 
+ 660      7FBA
+ 661 266b FF827FBB 		.ascii	"\377\202\177\273\377\202\177\273\377\202\177\273\377\203\177"
+ 661      FF827FBB 
+ 661      FF827FBB 
+ 661      FF837F
+ 662 267a BBFF8380 		.ascii	"\273\377\203\200\273\377\203\200\273\377\203\200\273\377\204"
+ 662      BBFF8380 
+ 662      BBFF8380 
+ 662      BBFF84
+ 663 2689 80BBFF84 		.ascii	"\200\273\377\204\201\273\377\204\201\274\377\204\201\274\377"
+ 663      81BBFF84 
+ 663      81BCFF84 
+ 663      81BCFF
+ 664 2698 8481BCFF 		.ascii	"\204\201\274\377\205\201\274\377\205\202\274\377\205\202\274"
+ 664      8581BCFF 
+ 664      8582BCFF 
+ 664      8582BC
+ 665 26a7 FF8582BC 		.ascii	"\377\205\202\274\377\206\202\274\377\206\203\274\377\206\203"
+ 665      FF8682BC 
+ 665      FF8683BC 
+ 665      FF8683
+ 666 26b6 BDFF8683 		.ascii	"\275\377\206\203\275\377\207\203\275\377\207\203\275\377\207"
+ 666      BDFF8783 
+ 666      BDFF8783 
+GAS LISTING /tmp/cc4tpqxY.s 			page 46
+
+
+ 666      BDFF87
+ 667 26c5 84BDFF87 		.ascii	"\204\275\377\207\204\275\377\210\204\275\377\210\204\275\377"
+ 667      84BDFF88 
+ 667      84BDFF88 
+ 667      84BDFF
+ 668 26d4 8885BDFF 		.ascii	"\210\205\275\377\210\205\276\377\211\205\276\377\211\205\276"
+ 668      8885BEFF 
+ 668      8985BEFF 
+ 668      8985BE
+ 669 26e3 FF8985BE 		.ascii	"\377\211\205\276\377\211\206\276\377\211\206\276\377\212\206"
+ 669      FF8986BE 
+ 669      FF8986BE 
+ 669      FF8A86
+ 670 26f2 BEFF8A86 		.ascii	"\276\377\212\206\276\377\212\207\276\377\212\207\277\377\213"
+ 670      BEFF8A87 
+ 670      BEFF8A87 
+ 670      BFFF8B
+ 671 2701 87BFFF8B 		.ascii	"\207\277\377\213\207\277\377\213\207\277\377\213\210\277\377"
+ 671      87BFFF8B 
+ 671      87BFFF8B 
+ 671      88BFFF
+ 672 2710 8C88BFFF 		.ascii	"\214\210\277\377\214\210\277\377\214\210\277\377\214\211\277"
+ 672      8C88BFFF 
+ 672      8C88BFFF 
+ 672      8C89BF
+ 673 271f FF8C89C0 		.ascii	"\377\214\211\300\377\215\211\300\377\215\211\300\377\215\212"
+ 673      FF8D89C0 
+ 673      FF8D89C0 
+ 673      FF8D8A
+ 674 272e C0FF8D8A 		.ascii	"\300\377\215\212\300\377\216\212\300\377\216\212\300\377\216"
+ 674      C0FF8E8A 
+ 674      C0FF8E8A 
+ 674      C0FF8E
+ 675 273d 8AC0FF8E 		.ascii	"\212\300\377\216\213\300\377\217\213\301\377\217\213\301\377"
+ 675      8BC0FF8F 
+ 675      8BC1FF8F 
+ 675      8BC1FF
+ 676 274c 8F8BC1FF 		.ascii	"\217\213\301\377\217\214\301\377\220\214\301\377\220\214\301"
+ 676      8F8CC1FF 
+ 676      908CC1FF 
+ 676      908CC1
+ 677 275b FF908CC1 		.ascii	"\377\220\214\301\377\220\214\301\377\220\215\301\377\221\215"
+ 677      FF908CC1 
+ 677      FF908DC1 
+ 677      FF918D
+ 678 276a C1FF918D 		.ascii	"\301\377\221\215\302\377\221\215\302\377\221\216\302\377\222"
+ 678      C2FF918D 
+ 678      C2FF918E 
+ 678      C2FF92
+ 679 2779 8EC2FF92 		.ascii	"\216\302\377\222\216\302\377\222\216\302\377\222\216\302\377"
+ 679      8EC2FF92 
+ 679      8EC2FF92 
+ 679      8EC2FF
+ 680 2788 938FC2FF 		.ascii	"\223\217\302\377\223\217\302\377\223\217\303\377\223\217\303"
+ 680      938FC2FF 
+ 680      938FC3FF 
+ 680      938FC3
+GAS LISTING /tmp/cc4tpqxY.s 			page 47
+
+
+ 681 2797 FF9490C3 		.ascii	"\377\224\220\303\377\224\220\303\377\224\220\303\377\224\220"
+ 681      FF9490C3 
+ 681      FF9490C3 
+ 681      FF9490
+ 682 27a6 C3FF9491 		.ascii	"\303\377\224\221\303\377\225\221\303\377\225\221\303\377\225"
+ 682      C3FF9591 
+ 682      C3FF9591 
+ 682      C3FF95
+ 683 27b5 91C4FF95 		.ascii	"\221\304\377\225\221\304\377\226\222\304\377\226\222\304\377"
+ 683      91C4FF96 
+ 683      92C4FF96 
+ 683      92C4FF
+ 684 27c4 9692C4FF 		.ascii	"\226\222\304\377\226\222\304\377\227\223\304\377\227\223\304"
+ 684      9692C4FF 
+ 684      9793C4FF 
+ 684      9793C4
+ 685 27d3 FF9793C4 		.ascii	"\377\227\223\304\377\227\223\305\377\227\224\305\377\230\224"
+ 685      FF9793C5 
+ 685      FF9794C5 
+ 685      FF9894
+ 686 27e2 C5FF9894 		.ascii	"\305\377\230\224\305\377\230\224\305\377\230\224\305\377\231"
+ 686      C5FF9894 
+ 686      C5FF9894 
+ 686      C5FF99
+ 687 27f1 95C5FF99 		.ascii	"\225\305\377\231\225\305\377\231\225\305\377\231\225\306\377"
+ 687      95C5FF99 
+ 687      95C5FF99 
+ 687      95C6FF
+ 688 2800 9A96C6FF 		.ascii	"\232\226\306\377\232\226\306\377\232\226\306\377\232\226\306"
+ 688      9A96C6FF 
+ 688      9A96C6FF 
+ 688      9A96C6
+ 689 280f FF       		.ascii	"\377"
+ 690 2810 9A97C6FF 		.ascii	"\232\227\306\377\233\227\306\377\233\227\306\377\233\227\306"
+ 690      9B97C6FF 
+ 690      9B97C6FF 
+ 690      9B97C6
+ 691 281f FF9B97C7 		.ascii	"\377\233\227\307\377\234\230\307\377\234\230\307\377\234\230"
+ 691      FF9C98C7 
+ 691      FF9C98C7 
+ 691      FF9C98
+ 692 282e C7FF9C98 		.ascii	"\307\377\234\230\307\377\235\231\307\377\235\231\307\377\235"
+ 692      C7FF9D99 
+ 692      C7FF9D99 
+ 692      C7FF9D
+ 693 283d 99C7FF9D 		.ascii	"\231\307\377\235\231\307\377\235\232\307\377\236\232\310\377"
+ 693      99C7FF9D 
+ 693      9AC7FF9E 
+ 693      9AC8FF
+ 694 284c 9E9AC8FF 		.ascii	"\236\232\310\377\236\232\310\377\236\233\310\377\237\233\310"
+ 694      9E9AC8FF 
+ 694      9E9BC8FF 
+ 694      9F9BC8
+ 695 285b FF9F9BC8 		.ascii	"\377\237\233\310\377\237\233\311\377\237\234\311\377\237\234"
+ 695      FF9F9BC9 
+ 695      FF9F9CC9 
+ 695      FF9F9C
+GAS LISTING /tmp/cc4tpqxY.s 			page 48
+
+
+ 696 286a C9FFA09C 		.ascii	"\311\377\240\234\311\377\240\234\311\377\240\235\311\377\240"
+ 696      C9FFA09C 
+ 696      C9FFA09D 
+ 696      C9FFA0
+ 697 2879 9DCAFFA1 		.ascii	"\235\312\377\241\235\312\377\241\236\312\377\241\236\312\377"
+ 697      9DCAFFA1 
+ 697      9ECAFFA1 
+ 697      9ECAFF
+ 698 2888 A19ECAFF 		.ascii	"\241\236\312\377\241\236\312\377\242\237\313\377\242\237\313"
+ 698      A19ECAFF 
+ 698      A29FCBFF 
+ 698      A29FCB
+ 699 2897 FFA29FCB 		.ascii	"\377\242\237\313\377\242\237\313\377\243\240\313\377\243\240"
+ 699      FFA29FCB 
+ 699      FFA3A0CB 
+ 699      FFA3A0
+ 700 28a6 CBFFA3A0 		.ascii	"\313\377\243\240\314\377\243\241\314\377\243\241\314\377\244"
+ 700      CCFFA3A1 
+ 700      CCFFA3A1 
+ 700      CCFFA4
+ 701 28b5 A1CCFFA4 		.ascii	"\241\314\377\244\241\314\377\244\242\314\377\244\242\314\377"
+ 701      A1CCFFA4 
+ 701      A2CCFFA4 
+ 701      A2CCFF
+ 702 28c4 A5A2CDFF 		.ascii	"\245\242\315\377\245\243\315\377\245\243\315\377\245\243\315"
+ 702      A5A3CDFF 
+ 702      A5A3CDFF 
+ 702      A5A3CD
+ 703 28d3 FFA6A3CD 		.ascii	"\377\246\243\315\377\246\244\315\377\246\244\316\377\246\244"
+ 703      FFA6A4CD 
+ 703      FFA6A4CE 
+ 703      FFA6A4
+ 704 28e2 CEFFA6A4 		.ascii	"\316\377\246\244\316\377\247\245\316\377\247\245\316\377\247"
+ 704      CEFFA7A5 
+ 704      CEFFA7A5 
+ 704      CEFFA7
+ 705 28f1 A5CEFFA7 		.ascii	"\245\316\377\247\246\317\377\250\246\317\377\250\246\317\377"
+ 705      A6CFFFA8 
+ 705      A6CFFFA8 
+ 705      A6CFFF
+ 706 2900 A8A6CFFF 		.ascii	"\250\246\317\377\250\247\317\377\251\247\317\377\251\247\317"
+ 706      A8A7CFFF 
+ 706      A9A7CFFF 
+ 706      A9A7CF
+ 707 290f FFA9A7D0 		.ascii	"\377\251\247\320\377\251\250\320\377\251\250\320\377\252\250"
+ 707      FFA9A8D0 
+ 707      FFA9A8D0 
+ 707      FFAAA8
+ 708 291e D0FFAAA9 		.ascii	"\320\377\252\251\320\377\252\251\320\377\252\251\321\377\253"
+ 708      D0FFAAA9 
+ 708      D0FFAAA9 
+ 708      D1FFAB
+ 709 292d A9D1FFAB 		.ascii	"\251\321\377\253\252\321\377\253\252\321\377\253\252\321\377"
+ 709      AAD1FFAB 
+ 709      AAD1FFAB 
+ 709      AAD1FF
+ 710 293c ACAAD1FF 		.ascii	"\254\252\321\377\254\253\322\377\254\253\322\377\254\253\322"
+GAS LISTING /tmp/cc4tpqxY.s 			page 49
+
+
+ 710      ACABD2FF 
+ 710      ACABD2FF 
+ 710      ACABD2
+ 711 294b FFACACD2 		.ascii	"\377\254\254\322\377\255\254\322\377\255\254\322\377\255\254"
+ 711      FFADACD2 
+ 711      FFADACD2 
+ 711      FFADAC
+ 712 295a D2FFADAD 		.ascii	"\322\377\255\255\323\377\256\255\323\377\256\255\323\377\256"
+ 712      D3FFAEAD 
+ 712      D3FFAEAD 
+ 712      D3FFAE
+ 713 2969 ADD3FFAE 		.ascii	"\255\323\377\256\256\323\377\257\256\323\377\257\256\324\377"
+ 713      AED3FFAF 
+ 713      AED3FFAF 
+ 713      AED4FF
+ 714 2978 AFAFD4FF 		.ascii	"\257\257\324\377\257\257\324\377\260\257\324\377\260\257\324"
+ 714      AFAFD4FF 
+ 714      B0AFD4FF 
+ 714      B0AFD4
+ 715 2987 FFB0B0D4 		.ascii	"\377\260\260\324\377\260\260\324\377\261\260\325\377\261\260"
+ 715      FFB0B0D4 
+ 715      FFB1B0D5 
+ 715      FFB1B0
+ 716 2996 D5FFB1B1 		.ascii	"\325\377\261\261\325\377\261\261\325\377\261\261\325\377\262"
+ 716      D5FFB1B1 
+ 716      D5FFB1B1 
+ 716      D5FFB2
+ 717 29a5 B2D5FFB2 		.ascii	"\262\325\377\262\262\326\377\262\262\326\377\262\262\326\377"
+ 717      B2D6FFB2 
+ 717      B2D6FFB2 
+ 717      B2D6FF
+ 718 29b4 B3B3D6FF 		.ascii	"\263\263\326\377\263\263\326\377\263\263\326\377\263\263\326"
+ 718      B3B3D6FF 
+ 718      B3B3D6FF 
+ 718      B3B3D6
+ 719 29c3 FFB4B4D7 		.ascii	"\377\264\264\327\377\264\264\327\377\264\264\327\377\264\265"
+ 719      FFB4B4D7 
+ 719      FFB4B4D7 
+ 719      FFB4B5
+ 720 29d2 D7FFB5B5 		.ascii	"\327\377\265\265\327\377\265\265\327\377\265\265\330\377\265"
+ 720      D7FFB5B5 
+ 720      D7FFB5B5 
+ 720      D8FFB5
+ 721 29e1 B6D8FFB6 		.ascii	"\266\330\377\266\266\330\377\266\266\330\377\266\266\330\377"
+ 721      B6D8FFB6 
+ 721      B6D8FFB6 
+ 721      B6D8FF
+ 722 29f0 B6B7D8FF 		.ascii	"\266\267\330\377\267\267\330\377\267\267\331\377\267\270\331"
+ 722      B7B7D8FF 
+ 722      B7B7D9FF 
+ 722      B7B8D9
+ 723 29ff FFB7B8D9 		.ascii	"\377\267\270\331\377\270\270\331\377\270\270\331\377\270\271"
+ 723      FFB8B8D9 
+ 723      FFB8B8D9 
+ 723      FFB8B9
+ 724 2a0e D9FFB8B9 		.ascii	"\331\377\270\271\332\377\271\271\332\377\271\271\332\377\271"
+ 724      DAFFB9B9 
+GAS LISTING /tmp/cc4tpqxY.s 			page 50
+
+
+ 724      DAFFB9B9 
+ 724      DAFFB9
+ 725 2a1d BADAFFB9 		.ascii	"\272\332\377\271\272\332\377\272\272\332\377\272\273\332\377"
+ 725      BADAFFBA 
+ 725      BADAFFBA 
+ 725      BBDAFF
+ 726 2a2c BABBDBFF 		.ascii	"\272\273\333\377\272\273\333\377\273\273\333\377\273\274\333"
+ 726      BABBDBFF 
+ 726      BBBBDBFF 
+ 726      BBBCDB
+ 727 2a3b FFBBBCDB 		.ascii	"\377\273\274\333\377\273\274\333\377\273\275\333\377\274\275"
+ 727      FFBBBCDB 
+ 727      FFBBBDDB 
+ 727      FFBCBD
+ 728 2a4a DCFFBCBD 		.ascii	"\334\377\274\275\334\377\274\275\334\377\274\275\334\377\275"
+ 728      DCFFBCBD 
+ 728      DCFFBCBD 
+ 728      DCFFBD
+ 729 2a59 BEDCFFBD 		.ascii	"\276\334\377\275\276\334\377\275\276\334\377\275\276\334\377"
+ 729      BEDCFFBD 
+ 729      BEDCFFBD 
+ 729      BEDCFF
+ 730 2a68 BEBFDDFF 		.ascii	"\276\277\335\377\276\277\335\377\276\277\335\377\276\277\335"
+ 730      BEBFDDFF 
+ 730      BEBFDDFF 
+ 730      BEBFDD
+ 731 2a77 FFBFBFDD 		.ascii	"\377\277\277\335\377\277\300\335\377\277\300\335\377\277\300"
+ 731      FFBFC0DD 
+ 731      FFBFC0DD 
+ 731      FFBFC0
+ 732 2a86 DDFFBFC0 		.ascii	"\335\377\277\300\335\377\300\301\336\377\300\301\336\377\300"
+ 732      DDFFC0C1 
+ 732      DEFFC0C1 
+ 732      DEFFC0
+ 733 2a95 C1DEFFC0 		.ascii	"\301\336\377\300\301\336\377\301\301\336\377\301\302\336\377"
+ 733      C1DEFFC1 
+ 733      C1DEFFC1 
+ 733      C2DEFF
+ 734 2aa4 C1C2DEFF 		.ascii	"\301\302\336\377\301\302\336\377\302\302\337\377\302\303\337"
+ 734      C1C2DEFF 
+ 734      C2C2DFFF 
+ 734      C2C3DF
+ 735 2ab3 FFC2C3DF 		.ascii	"\377\302\303\337\377\302\303\337\377\303\303\337\377\303\303"
+ 735      FFC2C3DF 
+ 735      FFC3C3DF 
+ 735      FFC3C3
+ 736 2ac2 DFFFC3C4 		.ascii	"\337\377\303\304\337\377\303\304\337\377\303\304\337\377\304"
+ 736      DFFFC3C4 
+ 736      DFFFC3C4 
+ 736      DFFFC4
+ 737 2ad1 C4E0FFC4 		.ascii	"\304\340\377\304\305\340\377\304\305\340\377\304\305\340\377"
+ 737      C5E0FFC4 
+ 737      C5E0FFC4 
+ 737      C5E0FF
+ 738 2ae0 C5C5E0FF 		.ascii	"\305\305\340\377\305\305\340\377\305\306\340\377\305\306\340"
+ 738      C5C5E0FF 
+ 738      C5C6E0FF 
+GAS LISTING /tmp/cc4tpqxY.s 			page 51
+
+
+ 738      C5C6E0
+ 739 2aef FFC6C6E1 		.ascii	"\377\306\306\341\377\306\306\341\377\306\307\341\377\306\307"
+ 739      FFC6C6E1 
+ 739      FFC6C7E1 
+ 739      FFC6C7
+ 740 2afe E1FFC7C7 		.ascii	"\341\377\307\307\341\377\307\307\341\377\307\307\341\377\307"
+ 740      E1FFC7C7 
+ 740      E1FFC7C7 
+ 740      E1FFC7
+ 741 2b0d C8E1FFC7 		.ascii	"\310\341\377\307\310\341\377\310\310\342\377\310\310\342\377"
+ 741      C8E1FFC8 
+ 741      C8E2FFC8 
+ 741      C8E2FF
+ 742 2b1c C8C9E2FF 		.ascii	"\310\311\342\377\310\311\342\377\311\311\342\377\311\311\342"
+ 742      C8C9E2FF 
+ 742      C9C9E2FF 
+ 742      C9C9E2
+ 743 2b2b FFC9CAE2 		.ascii	"\377\311\312\342\377\311\312\342\377\312\312\343\377\312\312"
+ 743      FFC9CAE2 
+ 743      FFCACAE3 
+ 743      FFCACA
+ 744 2b3a E3FFCACA 		.ascii	"\343\377\312\312\343\377\312\313\343\377\313\313\343\377\313"
+ 744      E3FFCACB 
+ 744      E3FFCBCB 
+ 744      E3FFCB
+ 745 2b49 CBE3FFCB 		.ascii	"\313\343\377\313\313\343\377\313\314\343\377\313\314\343\377"
+ 745      CBE3FFCB 
+ 745      CCE3FFCB 
+ 745      CCE3FF
+ 746 2b58 CCCCE4FF 		.ascii	"\314\314\344\377\314\314\344\377\314\314\344\377\314\315\344"
+ 746      CCCCE4FF 
+ 746      CCCCE4FF 
+ 746      CCCDE4
+ 747 2b67 FFCDCDE4 		.ascii	"\377\315\315\344\377\315\315\344\377\315\315\344\377\315\316"
+ 747      FFCDCDE4 
+ 747      FFCDCDE4 
+ 747      FFCDCE
+ 748 2b76 E4FFCECE 		.ascii	"\344\377\316\316\345\377\316\316\345\377\316\316\345\377\316"
+ 748      E5FFCECE 
+ 748      E5FFCECE 
+ 748      E5FFCE
+ 749 2b85 CFE5FFCF 		.ascii	"\317\345\377\317\317\345\377\317\317\345\377\317\317\345\377"
+ 749      CFE5FFCF 
+ 749      CFE5FFCF 
+ 749      CFE5FF
+ 750 2b94 CFCFE5FF 		.ascii	"\317\317\345\377\317\320\345\377\320\320\346\377\320\320\346"
+ 750      CFD0E5FF 
+ 750      D0D0E6FF 
+ 750      D0D0E6
+ 751 2ba3 FFD0D0E6 		.ascii	"\377\320\320\346\377\320\321\346\377\321\321\346\377\321\321"
+ 751      FFD0D1E6 
+ 751      FFD1D1E6 
+ 751      FFD1D1
+ 752 2bb2 E6FFD1D1 		.ascii	"\346\377\321\321\346\377\321\321\346\377\322\322\347\377\322"
+ 752      E6FFD1D1 
+ 752      E6FFD2D2 
+ 752      E7FFD2
+GAS LISTING /tmp/cc4tpqxY.s 			page 52
+
+
+ 753 2bc1 D2E7FFD2 		.ascii	"\322\347\377\322\322\347\377\322\322\347\377\322\323\347\377"
+ 753      D2E7FFD2 
+ 753      D2E7FFD2 
+ 753      D3E7FF
+ 754 2bd0 D3D3E7FF 		.ascii	"\323\323\347\377\323\323\347\377\323\323\347\377\323\324\347"
+ 754      D3D3E7FF 
+ 754      D3D3E7FF 
+ 754      D3D4E7
+ 755 2bdf FFD4D4E8 		.ascii	"\377\324\324\350\377\324\324\350\377\324\324\350\377\324\324"
+ 755      FFD4D4E8 
+ 755      FFD4D4E8 
+ 755      FFD4D4
+ 756 2bee E8FFD5D5 		.ascii	"\350\377\325\325\350\377\325\325\350\377\325\325\350\377\325"
+ 756      E8FFD5D5 
+ 756      E8FFD5D5 
+ 756      E8FFD5
+ 757 2bfd D5E8FFD6 		.ascii	"\325\350\377\326\326\351\377\326\326\351\377\326\326\351\377"
+ 757      D6E9FFD6 
+ 757      D6E9FFD6 
+ 757      D6E9FF
+ 758 2c0c D6D6E9FF 		.ascii	"\326\326\351\377\326\327\351\377\327\327\351\377\327\327\351"
+ 758      D6D7E9FF 
+ 758      D7D7E9FF 
+ 758      D7D7E9
+ 759 2c1b FFD7D7E9 		.ascii	"\377\327\327\351\377\327\327\351\377\330\330\352\377\330\330"
+ 759      FFD7D7E9 
+ 759      FFD8D8EA 
+ 759      FFD8D8
+ 760 2c2a EAFFD8D8 		.ascii	"\352\377\330\330\352\377\330\330\352\377\331\331\352\377\331"
+ 760      EAFFD8D8 
+ 760      EAFFD9D9 
+ 760      EAFFD9
+ 761 2c39 D9EAFFD9 		.ascii	"\331\352\377\331\331\352\377\331\331\352\377\331\332\352\377"
+ 761      D9EAFFD9 
+ 761      D9EAFFD9 
+ 761      DAEAFF
+ 762 2c48 DADAEBFF 		.ascii	"\332\332\353\377\332\332\353\377\332\332\353\377\332\332\353"
+ 762      DADAEBFF 
+ 762      DADAEBFF 
+ 762      DADAEB
+ 763 2c57 FFDADAEB 		.ascii	"\377\332\332\353\377\333\332\353\377\333\333\353\377\333\333"
+ 763      FFDBDAEB 
+ 763      FFDBDBEB 
+ 763      FFDBDB
+ 764 2c66 EBFFDBDB 		.ascii	"\353\377\333\333\353\377\333\333\353\377\333\333\353\377\334"
+ 764      EBFFDBDB 
+ 764      EBFFDBDB 
+ 764      EBFFDC
+ 765 2c75 DBEBFFDC 		.ascii	"\333\353\377\334\333\353\377\334\334\354\377\334\334\354\377"
+ 765      DBEBFFDC 
+ 765      DCECFFDC 
+ 765      DCECFF
+ 766 2c84 DCDCECFF 		.ascii	"\334\334\354\377\334\334\354\377\335\334\354\377\335\334\354"
+ 766      DCDCECFF 
+ 766      DDDCECFF 
+ 766      DDDCEC
+ 767 2c93 FFDDDCEC 		.ascii	"\377\335\334\354\377\335\335\354\377\335\335\354\377\336\335"
+GAS LISTING /tmp/cc4tpqxY.s 			page 53
+
+
+ 767      FFDDDDEC 
+ 767      FFDDDDEC 
+ 767      FFDEDD
+ 768 2ca2 ECFFDEDD 		.ascii	"\354\377\336\335\354\377\336\335\354\377\336\335\354\377\336"
+ 768      ECFFDEDD 
+ 768      ECFFDEDD 
+ 768      ECFFDE
+ 769 2cb1 DDEDFFDE 		.ascii	"\335\355\377\336\336\355\377\337\336\355\377\337\336\355\377"
+ 769      DEEDFFDF 
+ 769      DEEDFFDF 
+ 769      DEEDFF
+ 770 2cc0 DFDEEDFF 		.ascii	"\337\336\355\377\337\336\355\377\337\336\355\377\337\336\355"
+ 770      DFDEEDFF 
+ 770      DFDEEDFF 
+ 770      DFDEED
+ 771 2ccf FFE0DFED 		.ascii	"\377\340\337\355\377\340\337\355\377\340\337\355\377\340\337"
+ 771      FFE0DFED 
+ 771      FFE0DFED 
+ 771      FFE0DF
+ 772 2cde EDFFE0DF 		.ascii	"\355\377\340\337\355\377\340\337\356\377\341\337\356\377\341"
+ 772      EDFFE0DF 
+ 772      EEFFE1DF 
+ 772      EEFFE1
+ 773 2ced E0EEFFE1 		.ascii	"\340\356\377\341\340\356\377\341\340\356\377\341\340\356\377"
+ 773      E0EEFFE1 
+ 773      E0EEFFE1 
+ 773      E0EEFF
+ 774 2cfc E1E0EEFF 		.ascii	"\341\340\356\377\342\340\356\377\342\340\356\377\342\341\356"
+ 774      E2E0EEFF 
+ 774      E2E0EEFF 
+ 774      E2E1EE
+ 775 2d0b FFE2E1EE 		.ascii	"\377\342\341\356\377\342\341\356\377\342\341\356\377\343\341"
+ 775      FFE2E1EE 
+ 775      FFE2E1EE 
+ 775      FFE3E1
+ 776 2d1a EFFFE3E1 		.ascii	"\357\377\343\341\357\377\343\342\357\377\343\342\357\377\343"
+ 776      EFFFE3E2 
+ 776      EFFFE3E2 
+ 776      EFFFE3
+ 777 2d29 E2EFFFE3 		.ascii	"\342\357\377\343\342\357\377\344\342\357\377\344\342\357\377"
+ 777      E2EFFFE4 
+ 777      E2EFFFE4 
+ 777      E2EFFF
+ 778 2d38 E4E2EFFF 		.ascii	"\344\342\357\377\344\343\357\377\344\343\357\377\344\343\357"
+ 778      E4E3EFFF 
+ 778      E4E3EFFF 
+ 778      E4E3EF
+ 779 2d47 FFE5E3EF 		.ascii	"\377\345\343\357\377\345\343\360\377\345\343\360\377\345\343"
+ 779      FFE5E3F0 
+ 779      FFE5E3F0 
+ 779      FFE5E3
+ 780 2d56 F0FFE5E4 		.ascii	"\360\377\345\344\360\377\345\344\360\377\346\344\360\377\346"
+ 780      F0FFE5E4 
+ 780      F0FFE6E4 
+ 780      F0FFE6
+ 781 2d65 E4F0FFE6 		.ascii	"\344\360\377\346\344\360\377\346\344\360\377\346\344\360\377"
+ 781      E4F0FFE6 
+GAS LISTING /tmp/cc4tpqxY.s 			page 54
+
+
+ 781      E4F0FFE6 
+ 781      E4F0FF
+ 782 2d74 E6E5F0FF 		.ascii	"\346\345\360\377\347\345\360\377\347\345\360\377\347\345\361"
+ 782      E7E5F0FF 
+ 782      E7E5F0FF 
+ 782      E7E5F1
+ 783 2d83 FFE7E5F1 		.ascii	"\377\347\345\361\377\347\345\361\377\347\346\361\377\347\346"
+ 783      FFE7E5F1 
+ 783      FFE7E6F1 
+ 783      FFE7E6
+ 784 2d92 F1FFE8E6 		.ascii	"\361\377\350\346\361\377\350\346\361\377\350\346\361\377\350"
+ 784      F1FFE8E6 
+ 784      F1FFE8E6 
+ 784      F1FFE8
+ 785 2da1 E6F1FFE8 		.ascii	"\346\361\377\350\346\361\377\350\347\361\377\351\347\361\377"
+ 785      E6F1FFE8 
+ 785      E7F1FFE9 
+ 785      E7F1FF
+ 786 2db0 E9E7F2FF 		.ascii	"\351\347\362\377\351\347\362\377\351\347\362\377\351\347\362"
+ 786      E9E7F2FF 
+ 786      E9E7F2FF 
+ 786      E9E7F2
+ 787 2dbf FFE9E7F2 		.ascii	"\377\351\347\362\377\352\350\362\377\352\350\362\377\352\350"
+ 787      FFEAE8F2 
+ 787      FFEAE8F2 
+ 787      FFEAE8
+ 788 2dce F2FFEAE8 		.ascii	"\362\377\352\350\362\377\352\350\362\377\352\350\362\377\353"
+ 788      F2FFEAE8 
+ 788      F2FFEAE8 
+ 788      F2FFEB
+ 789 2ddd E9F2FFEB 		.ascii	"\351\362\377\353\351\362\377\353\351\363\377\353\351\363\377"
+ 789      E9F2FFEB 
+ 789      E9F3FFEB 
+ 789      E9F3FF
+ 790 2dec EBE9F3FF 		.ascii	"\353\351\363\377\353\351\363\377\353\351\363\377\354\352\363"
+ 790      EBE9F3FF 
+ 790      EBE9F3FF 
+ 790      ECEAF3
+ 791 2dfb FFECEAF3 		.ascii	"\377\354\352\363\377\354\352\363\377\354\352\363\377\354\352"
+ 791      FFECEAF3 
+ 791      FFECEAF3 
+ 791      FFECEA
+ 792 2e0a F3FFECEA 		.ascii	"\363\377\354\352\363\377\355\353\363\377\355\353\364\377\355"
+ 792      F3FFEDEB 
+ 792      F3FFEDEB 
+ 792      F4FFED
+ 793 2e19 EBF4FFED 		.ascii	"\353\364\377\355\353\364\377\355\353\364\377\355\353\364\377"
+ 793      EBF4FFED 
+ 793      EBF4FFED 
+ 793      EBF4FF
+ 794 2e28 EDEBF4FF 		.ascii	"\355\353\364\377\356\354\364\377\356\354\364\377\356\354\364"
+ 794      EEECF4FF 
+ 794      EEECF4FF 
+ 794      EEECF4
+ 795 2e37 FFEEECF4 		.ascii	"\377\356\354\364\377\356\354\364\377\356\354\364\377\356\355"
+ 795      FFEEECF4 
+ 795      FFEEECF4 
+GAS LISTING /tmp/cc4tpqxY.s 			page 55
+
+
+ 795      FFEEED
+ 796 2e46 F4FFEFED 		.ascii	"\364\377\357\355\365\377\357\355\365\377\357\355\365\377\357"
+ 796      F5FFEFED 
+ 796      F5FFEFED 
+ 796      F5FFEF
+ 797 2e55 EDF5FFEF 		.ascii	"\355\365\377\357\355\365\377\357\355\365\377\357\355\365\377"
+ 797      EDF5FFEF 
+ 797      EDF5FFEF 
+ 797      EDF5FF
+ 798 2e64 EFEDF5FF 		.ascii	"\357\355\365\377\357\355\365\377\360\356\365\377\360\356\365"
+ 798      EFEDF5FF 
+ 798      F0EEF5FF 
+ 798      F0EEF5
+ 799 2e73 FFF0EEF5 		.ascii	"\377\360\356\365\377\360\356\365\377\360\356\365\377\360\356"
+ 799      FFF0EEF5 
+ 799      FFF0EEF5 
+ 799      FFF0EE
+ 800 2e82 F5FFF0EE 		.ascii	"\365\377\360\356\365\377\360\356\366\377\360\356\366\377\361"
+ 800      F5FFF0EE 
+ 800      F6FFF0EE 
+ 800      F6FFF1
+ 801 2e91 EFF6FFF1 		.ascii	"\357\366\377\361\357\366\377\361\357\366\377\361\357\366\377"
+ 801      EFF6FFF1 
+ 801      EFF6FFF1 
+ 801      EFF6FF
+ 802 2ea0 F1EFF6FF 		.ascii	"\361\357\366\377\361\357\366\377\361\357\366\377\361\357\366"
+ 802      F1EFF6FF 
+ 802      F1EFF6FF 
+ 802      F1EFF6
+ 803 2eaf FFF1EFF6 		.ascii	"\377\361\357\366\377\362\360\366\377\362\360\366\377\362\360"
+ 803      FFF2F0F6 
+ 803      FFF2F0F6 
+ 803      FFF2F0
+ 804 2ebe F6FFF2F0 		.ascii	"\366\377\362\360\366\377\362\360\366\377\362\360\366\377\362"
+ 804      F6FFF2F0 
+ 804      F6FFF2F0 
+ 804      F6FFF2
+ 805 2ecd F0F7FFF2 		.ascii	"\360\367\377\362\360\367\377\362\360\367\377\362\360\367\377"
+ 805      F0F7FFF2 
+ 805      F0F7FFF2 
+ 805      F0F7FF
+ 806 2edc F3F1F7FF 		.ascii	"\363\361\367\377\363\361\367\377\363\361\367\377\363\361\367"
+ 806      F3F1F7FF 
+ 806      F3F1F7FF 
+ 806      F3F1F7
+ 807 2eeb FFF3F1F7 		.ascii	"\377\363\361\367\377\363\361\367\377\363\361\367\377\363\361"
+ 807      FFF3F1F7 
+ 807      FFF3F1F7 
+ 807      FFF3F1
+ 808 2efa F7FFF3F1 		.ascii	"\367\377\363\361\367\377\364\362\367\377\364\362\367\377\364"
+ 808      F7FFF4F2 
+ 808      F7FFF4F2 
+ 808      F7FFF4
+ 809 2f09 F2F7FFF4 		.ascii	"\362\367\377\364\362\370\377\364\362\370\377\364\362\370\377"
+ 809      F2F8FFF4 
+ 809      F2F8FFF4 
+ 809      F2F8FF
+GAS LISTING /tmp/cc4tpqxY.s 			page 56
+
+
+ 810 2f18 F4F2F8FF 		.ascii	"\364\362\370\377\364\362\370\377\364\362\370\377\364\363\370"
+ 810      F4F2F8FF 
+ 810      F4F2F8FF 
+ 810      F4F3F8
+ 811 2f27 FFF5F3F8 		.ascii	"\377\365\363\370\377\365\363\370\377\365\363\370\377\365\363"
+ 811      FFF5F3F8 
+ 811      FFF5F3F8 
+ 811      FFF5F3
+ 812 2f36 F8FFF5F3 		.ascii	"\370\377\365\363\370\377\365\363\370\377\365\363\370\377\365"
+ 812      F8FFF5F3 
+ 812      F8FFF5F3 
+ 812      F8FFF5
+ 813 2f45 F3F8FFF5 		.ascii	"\363\370\377\365\364\370\377\365\364\371\377\366\364\371\377"
+ 813      F4F8FFF5 
+ 813      F4F9FFF6 
+ 813      F4F9FF
+ 814 2f54 F6F4F9FF 		.ascii	"\366\364\371\377\366\364\371\377\366\364\371\377\366\364\371"
+ 814      F6F4F9FF 
+ 814      F6F4F9FF 
+ 814      F6F4F9
+ 815 2f63 FFF6F4F9 		.ascii	"\377\366\364\371\377\366\364\371\377\366\365\371\377\366\365"
+ 815      FFF6F4F9 
+ 815      FFF6F5F9 
+ 815      FFF6F5
+ 816 2f72 F9FFF6F5 		.ascii	"\371\377\366\365\371\377\367\365\371\377\367\365\371\377\367"
+ 816      F9FFF7F5 
+ 816      F9FFF7F5 
+ 816      F9FFF7
+ 817 2f81 F5F9FFF7 		.ascii	"\365\371\377\367\365\371\377\367\365\371\377\367\365\372\377"
+ 817      F5F9FFF7 
+ 817      F5F9FFF7 
+ 817      F5FAFF
+ 818 2f90 F7F5FAFF 		.ascii	"\367\365\372\377\367\366\372\377\367\366\372\377\367\366\372"
+ 818      F7F6FAFF 
+ 818      F7F6FAFF 
+ 818      F7F6FA
+ 819 2f9f FFF8F6FA 		.ascii	"\377\370\366\372\377\370\366\372\377\370\366\372\377\370\366"
+ 819      FFF8F6FA 
+ 819      FFF8F6FA 
+ 819      FFF8F6
+ 820 2fae FAFFF8F6 		.ascii	"\372\377\370\366\372\377\370\366\372\377\370\367\372\377\370"
+ 820      FAFFF8F6 
+ 820      FAFFF8F7 
+ 820      FAFFF8
+ 821 2fbd F7FAFFF8 		.ascii	"\367\372\377\370\367\372\377\370\367\372\377\371\367\372\377"
+ 821      F7FAFFF8 
+ 821      F7FAFFF9 
+ 821      F7FAFF
+ 822 2fcc F9F7FBFF 		.ascii	"\371\367\373\377\371\367\373\377\371\367\373\377\371\367\373"
+ 822      F9F7FBFF 
+ 822      F9F7FBFF 
+ 822      F9F7FB
+ 823 2fdb FFF9F8FB 		.ascii	"\377\371\370\373\377"
+ 823      FF
+ 824 2fe0 F9F8FBFF 		.ascii	"\371\370\373\377\371\370\373\377\371\370\373\377\371\370\373"
+ 824      F9F8FBFF 
+ 824      F9F8FBFF 
+GAS LISTING /tmp/cc4tpqxY.s 			page 57
+
+
+ 824      F9F8FB
+ 825 2fef FFFAF8FB 		.ascii	"\377\372\370\373\377\372\370\373\377\372\370\373\377\372\370"
+ 825      FFFAF8FB 
+ 825      FFFAF8FB 
+ 825      FFFAF8
+ 826 2ffe FBFFFAF9 		.ascii	"\373\377\372\371\373\377\372\371\373\377\372\371\374\377\372"
+ 826      FBFFFAF9 
+ 826      FBFFFAF9 
+ 826      FCFFFA
+ 827 300d F9FCFFFA 		.ascii	"\371\374\377\372\371\374\377\372\371\374\377\372\371\374\377"
+ 827      F9FCFFFA 
+ 827      F9FCFFFA 
+ 827      F9FCFF
+ 828 301c FBF9FCFF 		.ascii	"\373\371\374\377\373\371\374\377\373\372\374\377\373\372\374"
+ 828      FBF9FCFF 
+ 828      FBFAFCFF 
+ 828      FBFAFC
+ 829 302b FFFBFAFC 		.ascii	"\377\373\372\374\377\373\372\374\377\373\372\374\377\373\372"
+ 829      FFFBFAFC 
+ 829      FFFBFAFC 
+ 829      FFFBFA
+ 830 303a FCFFFBFA 		.ascii	"\374\377\373\372\374\377\373\372\374\377"
+ 830      FCFFFBFA 
+ 830      FCFF
+ 831              		.globl	heatmap_cs_Purples_discrete
+ 832              		.section	.data.rel.local
+ 833              		.align 8
+ 834              		.type	heatmap_cs_Purples_discrete, @object
+ 835              		.size	heatmap_cs_Purples_discrete, 8
+ 836              	heatmap_cs_Purples_discrete:
+ 837 0018 00000000 		.quad	discrete
+ 837      00000000 
+ 838              		.section	.data.rel.ro.local
+ 839              		.align 16
+ 840              		.type	discrete, @object
+ 841              		.size	discrete, 16
+ 842              	discrete:
+ 843 0030 00000000 		.quad	discrete_data
+ 843      00000000 
+ 844 0038 0A000000 		.quad	10
+ 844      00000000 
+ 845              		.section	.rodata
+ 846 3044 00000000 		.align 32
+ 846      00000000 
+ 846      00000000 
+ 846      00000000 
+ 846      00000000 
+ 847              		.type	discrete_data, @object
+ 848              		.size	discrete_data, 40
+ 849              	discrete_data:
+ 850 3060 00       		.string	""
+ 851 3061 00       		.string	""
+ 852 3062 00       		.string	""
+ 853 3063 00       		.string	""
+ 854 3064 3F00     		.string	"?"
+ 855 3066 7DFF5427 		.ascii	"}\377T'\217\377jQ\243\377\200}\272\377\236\232\310\377\274\275"
+ 855      8FFF6A51 
+GAS LISTING /tmp/cc4tpqxY.s 			page 58
+
+
+ 855      A3FF807D 
+ 855      BAFF9E9A 
+ 855      C8FFBCBD 
+ 856 307a DCFFDADA 		.ascii	"\334\377\332\332\353\377\357\355\365\377\374\373\375\377"
+ 856      EBFFEFED 
+ 856      F5FFFCFB 
+ 856      FDFF
+ 857              		.text
+ 858              	.Letext0:
+ 859              		.file 1 "./heatmap.h"
+ 860              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 861              		.file 3 "./colorschemes/Purples.h"
+ 862              		.file 4 "colorschemes/Purples.c"
+ 863              		.section	.debug_info,"",@progbits
+ 864              	.Ldebug_info0:
+ 865 0000 E3010000 		.long	0x1e3
+ 866 0004 0500     		.value	0x5
+ 867 0006 01       		.byte	0x1
+ 868 0007 08       		.byte	0x8
+ 869 0008 00000000 		.long	.Ldebug_abbrev0
+ 870 000c 0A       		.uleb128 0xa
+ 871 000d 00000000 		.long	.LASF26
+ 872 0011 1D       		.byte	0x1d
+ 873 0012 00000000 		.long	.LASF0
+ 874 0016 00000000 		.long	.LASF1
+ 875 001a 00000000 		.long	.Ldebug_line0
+ 876 001e 01       		.uleb128 0x1
+ 877 001f 08       		.byte	0x8
+ 878 0020 05       		.byte	0x5
+ 879 0021 00000000 		.long	.LASF2
+ 880 0025 06       		.uleb128 0x6
+ 881 0026 00000000 		.long	.LASF12
+ 882 002a 02       		.byte	0x2
+ 883 002b D6       		.byte	0xd6
+ 884 002c 17       		.byte	0x17
+ 885 002d 31000000 		.long	0x31
+ 886 0031 01       		.uleb128 0x1
+ 887 0032 08       		.byte	0x8
+ 888 0033 07       		.byte	0x7
+ 889 0034 00000000 		.long	.LASF3
+ 890 0038 0B       		.uleb128 0xb
+ 891 0039 04       		.byte	0x4
+ 892 003a 05       		.byte	0x5
+ 893 003b 696E7400 		.string	"int"
+ 894 003f 01       		.uleb128 0x1
+ 895 0040 08       		.byte	0x8
+ 896 0041 05       		.byte	0x5
+ 897 0042 00000000 		.long	.LASF4
+ 898 0046 01       		.uleb128 0x1
+ 899 0047 10       		.byte	0x10
+ 900 0048 04       		.byte	0x4
+ 901 0049 00000000 		.long	.LASF5
+ 902 004d 01       		.uleb128 0x1
+ 903 004e 04       		.byte	0x4
+ 904 004f 04       		.byte	0x4
+ 905 0050 00000000 		.long	.LASF6
+ 906 0054 01       		.uleb128 0x1
+GAS LISTING /tmp/cc4tpqxY.s 			page 59
+
+
+ 907 0055 04       		.byte	0x4
+ 908 0056 07       		.byte	0x7
+ 909 0057 00000000 		.long	.LASF7
+ 910 005b 01       		.uleb128 0x1
+ 911 005c 02       		.byte	0x2
+ 912 005d 07       		.byte	0x7
+ 913 005e 00000000 		.long	.LASF8
+ 914 0062 0C       		.uleb128 0xc
+ 915 0063 10       		.byte	0x10
+ 916 0064 01       		.byte	0x1
+ 917 0065 BB       		.byte	0xbb
+ 918 0066 09       		.byte	0x9
+ 919 0067 84000000 		.long	0x84
+ 920 006b 07       		.uleb128 0x7
+ 921 006c 00000000 		.long	.LASF9
+ 922 0070 BC       		.byte	0xbc
+ 923 0071 1A       		.byte	0x1a
+ 924 0072 84000000 		.long	0x84
+ 925 0076 00       		.byte	0
+ 926 0077 07       		.uleb128 0x7
+ 927 0078 00000000 		.long	.LASF10
+ 928 007c BD       		.byte	0xbd
+ 929 007d 0C       		.byte	0xc
+ 930 007e 25000000 		.long	0x25
+ 931 0082 08       		.byte	0x8
+ 932 0083 00       		.byte	0
+ 933 0084 08       		.uleb128 0x8
+ 934 0085 90000000 		.long	0x90
+ 935 0089 01       		.uleb128 0x1
+ 936 008a 01       		.byte	0x1
+ 937 008b 08       		.byte	0x8
+ 938 008c 00000000 		.long	.LASF11
+ 939 0090 03       		.uleb128 0x3
+ 940 0091 89000000 		.long	0x89
+ 941 0095 06       		.uleb128 0x6
+ 942 0096 00000000 		.long	.LASF13
+ 943 009a 01       		.byte	0x1
+ 944 009b BE       		.byte	0xbe
+ 945 009c 03       		.byte	0x3
+ 946 009d 62000000 		.long	0x62
+ 947 00a1 03       		.uleb128 0x3
+ 948 00a2 95000000 		.long	0x95
+ 949 00a6 08       		.uleb128 0x8
+ 950 00a7 A1000000 		.long	0xa1
+ 951 00ab 04       		.uleb128 0x4
+ 952 00ac 00000000 		.long	.LASF14
+ 953 00b0 21       		.byte	0x21
+ 954 00b1 A6000000 		.long	0xa6
+ 955 00b5 04       		.uleb128 0x4
+ 956 00b6 00000000 		.long	.LASF15
+ 957 00ba 23       		.byte	0x23
+ 958 00bb A6000000 		.long	0xa6
+ 959 00bf 04       		.uleb128 0x4
+ 960 00c0 00000000 		.long	.LASF16
+ 961 00c4 25       		.byte	0x25
+ 962 00c5 A6000000 		.long	0xa6
+ 963 00c9 04       		.uleb128 0x4
+GAS LISTING /tmp/cc4tpqxY.s 			page 60
+
+
+ 964 00ca 00000000 		.long	.LASF17
+ 965 00ce 28       		.byte	0x28
+ 966 00cf A6000000 		.long	0xa6
+ 967 00d3 09       		.uleb128 0x9
+ 968 00d4 90000000 		.long	0x90
+ 969 00d8 E3000000 		.long	0xe3
+ 970 00dc 0D       		.uleb128 0xd
+ 971 00dd 31000000 		.long	0x31
+ 972 00e1 27       		.byte	0x27
+ 973 00e2 00       		.byte	0
+ 974 00e3 03       		.uleb128 0x3
+ 975 00e4 D3000000 		.long	0xd3
+ 976 00e8 02       		.uleb128 0x2
+ 977 00e9 00000000 		.long	.LASF18
+ 978 00ed 20       		.byte	0x20
+ 979 00ee 1C       		.byte	0x1c
+ 980 00ef E3000000 		.long	0xe3
+ 981 00f3 09       		.uleb128 0x9
+ 982 00f4 03       		.byte	0x3
+ 983 00f5 00000000 		.quad	discrete_data
+ 983      00000000 
+ 984 00fd 02       		.uleb128 0x2
+ 985 00fe 00000000 		.long	.LASF19
+ 986 0102 23       		.byte	0x23
+ 987 0103 24       		.byte	0x24
+ 988 0104 A1000000 		.long	0xa1
+ 989 0108 09       		.uleb128 0x9
+ 990 0109 03       		.byte	0x3
+ 991 010a 00000000 		.quad	discrete
+ 991      00000000 
+ 992 0112 05       		.uleb128 0x5
+ 993 0113 AB000000 		.long	0xab
+ 994 0117 24       		.byte	0x24
+ 995 0118 09       		.uleb128 0x9
+ 996 0119 03       		.byte	0x3
+ 997 011a 00000000 		.quad	heatmap_cs_Purples_discrete
+ 997      00000000 
+ 998 0122 09       		.uleb128 0x9
+ 999 0123 90000000 		.long	0x90
+ 1000 0127 33010000 		.long	0x133
+ 1001 012b 0E       		.uleb128 0xe
+ 1002 012c 31000000 		.long	0x31
+ 1003 0130 0310     		.value	0x1003
+ 1004 0132 00       		.byte	0
+ 1005 0133 03       		.uleb128 0x3
+ 1006 0134 22010000 		.long	0x122
+ 1007 0138 02       		.uleb128 0x2
+ 1008 0139 00000000 		.long	.LASF20
+ 1009 013d 26       		.byte	0x26
+ 1010 013e 1C       		.byte	0x1c
+ 1011 013f 33010000 		.long	0x133
+ 1012 0143 09       		.uleb128 0x9
+ 1013 0144 03       		.byte	0x3
+ 1014 0145 00000000 		.quad	soft_data
+ 1014      00000000 
+ 1015 014d 02       		.uleb128 0x2
+ 1016 014e 00000000 		.long	.LASF21
+GAS LISTING /tmp/cc4tpqxY.s 			page 61
+
+
+ 1017 0152 29       		.byte	0x29
+ 1018 0153 24       		.byte	0x24
+ 1019 0154 A1000000 		.long	0xa1
+ 1020 0158 09       		.uleb128 0x9
+ 1021 0159 03       		.byte	0x3
+ 1022 015a 00000000 		.quad	soft
+ 1022      00000000 
+ 1023 0162 05       		.uleb128 0x5
+ 1024 0163 B5000000 		.long	0xb5
+ 1025 0167 2A       		.byte	0x2a
+ 1026 0168 09       		.uleb128 0x9
+ 1027 0169 03       		.byte	0x3
+ 1028 016a 00000000 		.quad	heatmap_cs_Purples_soft
+ 1028      00000000 
+ 1029 0172 02       		.uleb128 0x2
+ 1030 0173 00000000 		.long	.LASF22
+ 1031 0177 2C       		.byte	0x2c
+ 1032 0178 1C       		.byte	0x1c
+ 1033 0179 33010000 		.long	0x133
+ 1034 017d 09       		.uleb128 0x9
+ 1035 017e 03       		.byte	0x3
+ 1036 017f 00000000 		.quad	mixed_data
+ 1036      00000000 
+ 1037 0187 02       		.uleb128 0x2
+ 1038 0188 00000000 		.long	.LASF23
+ 1039 018c 2F       		.byte	0x2f
+ 1040 018d 24       		.byte	0x24
+ 1041 018e A1000000 		.long	0xa1
+ 1042 0192 09       		.uleb128 0x9
+ 1043 0193 03       		.byte	0x3
+ 1044 0194 00000000 		.quad	mixed
+ 1044      00000000 
+ 1045 019c 05       		.uleb128 0x5
+ 1046 019d BF000000 		.long	0xbf
+ 1047 01a1 30       		.byte	0x30
+ 1048 01a2 09       		.uleb128 0x9
+ 1049 01a3 03       		.byte	0x3
+ 1050 01a4 00000000 		.quad	heatmap_cs_Purples_mixed
+ 1050      00000000 
+ 1051 01ac 02       		.uleb128 0x2
+ 1052 01ad 00000000 		.long	.LASF24
+ 1053 01b1 32       		.byte	0x32
+ 1054 01b2 1C       		.byte	0x1c
+ 1055 01b3 33010000 		.long	0x133
+ 1056 01b7 09       		.uleb128 0x9
+ 1057 01b8 03       		.byte	0x3
+ 1058 01b9 00000000 		.quad	mixed_exp_data
+ 1058      00000000 
+ 1059 01c1 02       		.uleb128 0x2
+ 1060 01c2 00000000 		.long	.LASF25
+ 1061 01c6 35       		.byte	0x35
+ 1062 01c7 24       		.byte	0x24
+ 1063 01c8 A1000000 		.long	0xa1
+ 1064 01cc 09       		.uleb128 0x9
+ 1065 01cd 03       		.byte	0x3
+ 1066 01ce 00000000 		.quad	mixed_exp
+ 1066      00000000 
+GAS LISTING /tmp/cc4tpqxY.s 			page 62
+
+
+ 1067 01d6 05       		.uleb128 0x5
+ 1068 01d7 C9000000 		.long	0xc9
+ 1069 01db 36       		.byte	0x36
+ 1070 01dc 09       		.uleb128 0x9
+ 1071 01dd 03       		.byte	0x3
+ 1072 01de 00000000 		.quad	heatmap_cs_Purples_mixed_exp
+ 1072      00000000 
+ 1073 01e6 00       		.byte	0
+ 1074              		.section	.debug_abbrev,"",@progbits
+ 1075              	.Ldebug_abbrev0:
+ 1076 0000 01       		.uleb128 0x1
+ 1077 0001 24       		.uleb128 0x24
+ 1078 0002 00       		.byte	0
+ 1079 0003 0B       		.uleb128 0xb
+ 1080 0004 0B       		.uleb128 0xb
+ 1081 0005 3E       		.uleb128 0x3e
+ 1082 0006 0B       		.uleb128 0xb
+ 1083 0007 03       		.uleb128 0x3
+ 1084 0008 0E       		.uleb128 0xe
+ 1085 0009 00       		.byte	0
+ 1086 000a 00       		.byte	0
+ 1087 000b 02       		.uleb128 0x2
+ 1088 000c 34       		.uleb128 0x34
+ 1089 000d 00       		.byte	0
+ 1090 000e 03       		.uleb128 0x3
+ 1091 000f 0E       		.uleb128 0xe
+ 1092 0010 3A       		.uleb128 0x3a
+ 1093 0011 21       		.uleb128 0x21
+ 1094 0012 04       		.sleb128 4
+ 1095 0013 3B       		.uleb128 0x3b
+ 1096 0014 0B       		.uleb128 0xb
+ 1097 0015 39       		.uleb128 0x39
+ 1098 0016 0B       		.uleb128 0xb
+ 1099 0017 49       		.uleb128 0x49
+ 1100 0018 13       		.uleb128 0x13
+ 1101 0019 02       		.uleb128 0x2
+ 1102 001a 18       		.uleb128 0x18
+ 1103 001b 00       		.byte	0
+ 1104 001c 00       		.byte	0
+ 1105 001d 03       		.uleb128 0x3
+ 1106 001e 26       		.uleb128 0x26
+ 1107 001f 00       		.byte	0
+ 1108 0020 49       		.uleb128 0x49
+ 1109 0021 13       		.uleb128 0x13
+ 1110 0022 00       		.byte	0
+ 1111 0023 00       		.byte	0
+ 1112 0024 04       		.uleb128 0x4
+ 1113 0025 34       		.uleb128 0x34
+ 1114 0026 00       		.byte	0
+ 1115 0027 03       		.uleb128 0x3
+ 1116 0028 0E       		.uleb128 0xe
+ 1117 0029 3A       		.uleb128 0x3a
+ 1118 002a 21       		.uleb128 0x21
+ 1119 002b 03       		.sleb128 3
+ 1120 002c 3B       		.uleb128 0x3b
+ 1121 002d 0B       		.uleb128 0xb
+ 1122 002e 39       		.uleb128 0x39
+GAS LISTING /tmp/cc4tpqxY.s 			page 63
+
+
+ 1123 002f 21       		.uleb128 0x21
+ 1124 0030 25       		.sleb128 37
+ 1125 0031 49       		.uleb128 0x49
+ 1126 0032 13       		.uleb128 0x13
+ 1127 0033 3F       		.uleb128 0x3f
+ 1128 0034 19       		.uleb128 0x19
+ 1129 0035 3C       		.uleb128 0x3c
+ 1130 0036 19       		.uleb128 0x19
+ 1131 0037 00       		.byte	0
+ 1132 0038 00       		.byte	0
+ 1133 0039 05       		.uleb128 0x5
+ 1134 003a 34       		.uleb128 0x34
+ 1135 003b 00       		.byte	0
+ 1136 003c 47       		.uleb128 0x47
+ 1137 003d 13       		.uleb128 0x13
+ 1138 003e 3A       		.uleb128 0x3a
+ 1139 003f 21       		.uleb128 0x21
+ 1140 0040 04       		.sleb128 4
+ 1141 0041 3B       		.uleb128 0x3b
+ 1142 0042 0B       		.uleb128 0xb
+ 1143 0043 39       		.uleb128 0x39
+ 1144 0044 21       		.uleb128 0x21
+ 1145 0045 1E       		.sleb128 30
+ 1146 0046 02       		.uleb128 0x2
+ 1147 0047 18       		.uleb128 0x18
+ 1148 0048 00       		.byte	0
+ 1149 0049 00       		.byte	0
+ 1150 004a 06       		.uleb128 0x6
+ 1151 004b 16       		.uleb128 0x16
+ 1152 004c 00       		.byte	0
+ 1153 004d 03       		.uleb128 0x3
+ 1154 004e 0E       		.uleb128 0xe
+ 1155 004f 3A       		.uleb128 0x3a
+ 1156 0050 0B       		.uleb128 0xb
+ 1157 0051 3B       		.uleb128 0x3b
+ 1158 0052 0B       		.uleb128 0xb
+ 1159 0053 39       		.uleb128 0x39
+ 1160 0054 0B       		.uleb128 0xb
+ 1161 0055 49       		.uleb128 0x49
+ 1162 0056 13       		.uleb128 0x13
+ 1163 0057 00       		.byte	0
+ 1164 0058 00       		.byte	0
+ 1165 0059 07       		.uleb128 0x7
+ 1166 005a 0D       		.uleb128 0xd
+ 1167 005b 00       		.byte	0
+ 1168 005c 03       		.uleb128 0x3
+ 1169 005d 0E       		.uleb128 0xe
+ 1170 005e 3A       		.uleb128 0x3a
+ 1171 005f 21       		.uleb128 0x21
+ 1172 0060 01       		.sleb128 1
+ 1173 0061 3B       		.uleb128 0x3b
+ 1174 0062 0B       		.uleb128 0xb
+ 1175 0063 39       		.uleb128 0x39
+ 1176 0064 0B       		.uleb128 0xb
+ 1177 0065 49       		.uleb128 0x49
+ 1178 0066 13       		.uleb128 0x13
+ 1179 0067 38       		.uleb128 0x38
+GAS LISTING /tmp/cc4tpqxY.s 			page 64
+
+
+ 1180 0068 0B       		.uleb128 0xb
+ 1181 0069 00       		.byte	0
+ 1182 006a 00       		.byte	0
+ 1183 006b 08       		.uleb128 0x8
+ 1184 006c 0F       		.uleb128 0xf
+ 1185 006d 00       		.byte	0
+ 1186 006e 0B       		.uleb128 0xb
+ 1187 006f 21       		.uleb128 0x21
+ 1188 0070 08       		.sleb128 8
+ 1189 0071 49       		.uleb128 0x49
+ 1190 0072 13       		.uleb128 0x13
+ 1191 0073 00       		.byte	0
+ 1192 0074 00       		.byte	0
+ 1193 0075 09       		.uleb128 0x9
+ 1194 0076 01       		.uleb128 0x1
+ 1195 0077 01       		.byte	0x1
+ 1196 0078 49       		.uleb128 0x49
+ 1197 0079 13       		.uleb128 0x13
+ 1198 007a 01       		.uleb128 0x1
+ 1199 007b 13       		.uleb128 0x13
+ 1200 007c 00       		.byte	0
+ 1201 007d 00       		.byte	0
+ 1202 007e 0A       		.uleb128 0xa
+ 1203 007f 11       		.uleb128 0x11
+ 1204 0080 01       		.byte	0x1
+ 1205 0081 25       		.uleb128 0x25
+ 1206 0082 0E       		.uleb128 0xe
+ 1207 0083 13       		.uleb128 0x13
+ 1208 0084 0B       		.uleb128 0xb
+ 1209 0085 03       		.uleb128 0x3
+ 1210 0086 1F       		.uleb128 0x1f
+ 1211 0087 1B       		.uleb128 0x1b
+ 1212 0088 1F       		.uleb128 0x1f
+ 1213 0089 10       		.uleb128 0x10
+ 1214 008a 17       		.uleb128 0x17
+ 1215 008b 00       		.byte	0
+ 1216 008c 00       		.byte	0
+ 1217 008d 0B       		.uleb128 0xb
+ 1218 008e 24       		.uleb128 0x24
+ 1219 008f 00       		.byte	0
+ 1220 0090 0B       		.uleb128 0xb
+ 1221 0091 0B       		.uleb128 0xb
+ 1222 0092 3E       		.uleb128 0x3e
+ 1223 0093 0B       		.uleb128 0xb
+ 1224 0094 03       		.uleb128 0x3
+ 1225 0095 08       		.uleb128 0x8
+ 1226 0096 00       		.byte	0
+ 1227 0097 00       		.byte	0
+ 1228 0098 0C       		.uleb128 0xc
+ 1229 0099 13       		.uleb128 0x13
+ 1230 009a 01       		.byte	0x1
+ 1231 009b 0B       		.uleb128 0xb
+ 1232 009c 0B       		.uleb128 0xb
+ 1233 009d 3A       		.uleb128 0x3a
+ 1234 009e 0B       		.uleb128 0xb
+ 1235 009f 3B       		.uleb128 0x3b
+ 1236 00a0 0B       		.uleb128 0xb
+GAS LISTING /tmp/cc4tpqxY.s 			page 65
+
+
+ 1237 00a1 39       		.uleb128 0x39
+ 1238 00a2 0B       		.uleb128 0xb
+ 1239 00a3 01       		.uleb128 0x1
+ 1240 00a4 13       		.uleb128 0x13
+ 1241 00a5 00       		.byte	0
+ 1242 00a6 00       		.byte	0
+ 1243 00a7 0D       		.uleb128 0xd
+ 1244 00a8 21       		.uleb128 0x21
+ 1245 00a9 00       		.byte	0
+ 1246 00aa 49       		.uleb128 0x49
+ 1247 00ab 13       		.uleb128 0x13
+ 1248 00ac 2F       		.uleb128 0x2f
+ 1249 00ad 0B       		.uleb128 0xb
+ 1250 00ae 00       		.byte	0
+ 1251 00af 00       		.byte	0
+ 1252 00b0 0E       		.uleb128 0xe
+ 1253 00b1 21       		.uleb128 0x21
+ 1254 00b2 00       		.byte	0
+ 1255 00b3 49       		.uleb128 0x49
+ 1256 00b4 13       		.uleb128 0x13
+ 1257 00b5 2F       		.uleb128 0x2f
+ 1258 00b6 05       		.uleb128 0x5
+ 1259 00b7 00       		.byte	0
+ 1260 00b8 00       		.byte	0
+ 1261 00b9 00       		.byte	0
+ 1262              		.section	.debug_aranges,"",@progbits
+ 1263 0000 1C000000 		.long	0x1c
+ 1264 0004 0200     		.value	0x2
+ 1265 0006 00000000 		.long	.Ldebug_info0
+ 1266 000a 08       		.byte	0x8
+ 1267 000b 00       		.byte	0
+ 1268 000c 0000     		.value	0
+ 1269 000e 0000     		.value	0
+ 1270 0010 00000000 		.quad	0
+ 1270      00000000 
+ 1271 0018 00000000 		.quad	0
+ 1271      00000000 
+ 1272              		.section	.debug_line,"",@progbits
+ 1273              	.Ldebug_line0:
+ 1274 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1274      05000800 
+ 1274      49000000 
+ 1274      010101FB 
+ 1274      0E0D0001 
+ 1275              	.LASF20:
+ 1276 0000 736F6674 		.string	"soft_data"
+ 1276      5F646174 
+ 1276      6100
+ 1277              	.LASF12:
+ 1278 000a 73697A65 		.string	"size_t"
+ 1278      5F7400
+ 1279              	.LASF13:
+ 1280 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1280      6D61705F 
+ 1280      636F6C6F 
+ 1280      72736368 
+ 1280      656D655F 
+GAS LISTING /tmp/cc4tpqxY.s 			page 66
+
+
+ 1281              	.LASF16:
+ 1282 0027 68656174 		.string	"heatmap_cs_Purples_mixed"
+ 1282      6D61705F 
+ 1282      63735F50 
+ 1282      7572706C 
+ 1282      65735F6D 
+ 1283              	.LASF17:
+ 1284 0040 68656174 		.string	"heatmap_cs_Purples_mixed_exp"
+ 1284      6D61705F 
+ 1284      63735F50 
+ 1284      7572706C 
+ 1284      65735F6D 
+ 1285              	.LASF14:
+ 1286 005d 68656174 		.string	"heatmap_cs_Purples_discrete"
+ 1286      6D61705F 
+ 1286      63735F50 
+ 1286      7572706C 
+ 1286      65735F64 
+ 1287              	.LASF26:
+ 1288 0079 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1288      43313720 
+ 1288      31322E32 
+ 1288      2E30202D 
+ 1288      6D74756E 
+ 1289              	.LASF6:
+ 1290 00d8 666C6F61 		.string	"float"
+ 1290      7400
+ 1291              	.LASF11:
+ 1292 00de 756E7369 		.string	"unsigned char"
+ 1292      676E6564 
+ 1292      20636861 
+ 1292      7200
+ 1293              	.LASF3:
+ 1294 00ec 6C6F6E67 		.string	"long unsigned int"
+ 1294      20756E73 
+ 1294      69676E65 
+ 1294      6420696E 
+ 1294      7400
+ 1295              	.LASF8:
+ 1296 00fe 73686F72 		.string	"short unsigned int"
+ 1296      7420756E 
+ 1296      7369676E 
+ 1296      65642069 
+ 1296      6E7400
+ 1297              	.LASF25:
+ 1298 0111 6D697865 		.string	"mixed_exp"
+ 1298      645F6578 
+ 1298      7000
+ 1299              	.LASF23:
+ 1300 011b 6D697865 		.string	"mixed"
+ 1300      6400
+ 1301              	.LASF7:
+ 1302 0121 756E7369 		.string	"unsigned int"
+ 1302      676E6564 
+ 1302      20696E74 
+ 1302      00
+ 1303              	.LASF19:
+GAS LISTING /tmp/cc4tpqxY.s 			page 67
+
+
+ 1304 012e 64697363 		.string	"discrete"
+ 1304      72657465 
+ 1304      00
+ 1305              	.LASF10:
+ 1306 0137 6E636F6C 		.string	"ncolors"
+ 1306      6F727300 
+ 1307              	.LASF4:
+ 1308 013f 6C6F6E67 		.string	"long long int"
+ 1308      206C6F6E 
+ 1308      6720696E 
+ 1308      7400
+ 1309              	.LASF24:
+ 1310 014d 6D697865 		.string	"mixed_exp_data"
+ 1310      645F6578 
+ 1310      705F6461 
+ 1310      746100
+ 1311              	.LASF15:
+ 1312 015c 68656174 		.string	"heatmap_cs_Purples_soft"
+ 1312      6D61705F 
+ 1312      63735F50 
+ 1312      7572706C 
+ 1312      65735F73 
+ 1313              	.LASF22:
+ 1314 0174 6D697865 		.string	"mixed_data"
+ 1314      645F6461 
+ 1314      746100
+ 1315              	.LASF2:
+ 1316 017f 6C6F6E67 		.string	"long int"
+ 1316      20696E74 
+ 1316      00
+ 1317              	.LASF5:
+ 1318 0188 6C6F6E67 		.string	"long double"
+ 1318      20646F75 
+ 1318      626C6500 
+ 1319              	.LASF18:
+ 1320 0194 64697363 		.string	"discrete_data"
+ 1320      72657465 
+ 1320      5F646174 
+ 1320      6100
+ 1321              	.LASF21:
+ 1322 01a2 736F6674 		.string	"soft"
+ 1322      00
+ 1323              	.LASF9:
+ 1324 01a7 636F6C6F 		.string	"colors"
+ 1324      727300
+ 1325              		.section	.debug_line_str,"MS",@progbits,1
+ 1326              	.LASF0:
+ 1327 0000 636F6C6F 		.string	"colorschemes/Purples.c"
+ 1327      72736368 
+ 1327      656D6573 
+ 1327      2F507572 
+ 1327      706C6573 
+ 1328              	.LASF1:
+ 1329 0017 2F726F6F 		.string	"/root/repo"
+ 1329      742F7265 
+ 1329      706F00
+ 1330              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+GAS LISTING /tmp/cc4tpqxY.s 			page 68
+
+
+ 1331 0022 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1331      742F7265 
+ 1331      706F0063 
+ 1331      6F6C6F72 
+ 1331      73636865 
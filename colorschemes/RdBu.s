@@ -0,0 +1,3885 @@
+GAS LISTING /tmp/ccoNxI3i.s 			page 1
+
+
+   1              		.file	"RdBu.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/RdBu.c"
+   5              		.globl	heatmap_cs_RdBu_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_RdBu_mixed_exp, @object
+   9              		.size	heatmap_cs_RdBu_mixed_exp, 8
+  10              	heatmap_cs_RdBu_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 052F6100 		.string	"\005/a"
+  29 0008 07336618 		.ascii	"\0073f\030\n7l1\f;qJ\016?wc\021C||\030R\221\225\032V\227\256"
+  29      0A376C31 
+  29      0C3B714A 
+  29      0E3F7763 
+  29      11437C7C 
+  30 0024 1C5A9CC7 		.ascii	"\034Z\234\307\036^\242\340\037b\247\371!f\254\377!j\256\377#"
+  30      1E5EA2E0 
+  30      1F62A7F9 
+  30      2166ACFF 
+  30      216AAEFF 
+  31 0039 6DB0FF24 		.ascii	"m\260\377$p\262\377&s\263\377(v\265\3772\202\273\3774\205\274"
+  31      70B2FF26 
+  31      73B3FF28 
+  31      76B5FF32 
+  31      82BBFF34 
+  32 004f FF3788BE 		.ascii	"\3777\210\276\377:\213\277\377=\216\300\377A\221\302\377E\224"
+  32      FF3A8BBF 
+  32      FF3D8EC0 
+  32      FF4191C2 
+  32      FF4594
+  33 0062 C3FF4A97 		.ascii	"\303\377J\227\305\377O\232\307\377T\235\310\377Y\240\312\377"
+  33      C5FF4F9A 
+  33      C7FF549D 
+  33      C8FF59A0 
+  33      CAFF
+  34 0074 5EA3CBFF 		.ascii	"^\243\313\377c\246\315\377w\263\324\377|\266\326\377\200\271"
+GAS LISTING /tmp/ccoNxI3i.s 			page 2
+
+
+  34      63A6CDFF 
+  34      77B3D4FF 
+  34      7CB6D6FF 
+  34      80B9
+  35 0086 D7FF85BC 		.ascii	"\327\377\205\274\331\377\211\277\332\377\216\302\334\377\222"
+  35      D9FF89BF 
+  35      DAFF8EC2 
+  35      DCFF92
+  36 0095 C5DEFF96 		.ascii	"\305\336\377\226\306\337\377\231\310\340\377\235\312\341\377"
+  36      C6DFFF99 
+  36      C8E0FF9D 
+  36      CAE1FF
+  37 00a4 A0CCE2FF 		.ascii	"\240\314\342\377\244\315\343\377\247\317\344\377\253\321\345"
+  37      A4CDE3FF 
+  37      A7CFE4FF 
+  37      ABD1E5
+  38 00b3 FFBBD9E9 		.ascii	"\377\273\331\351\377\276\333\352\377\301\334\353\377\304\336"
+  38      FFBEDBEA 
+  38      FFC1DCEB 
+  38      FFC4DE
+  39 00c2 ECFFC7E0 		.ascii	"\354\377\307\340\355\377\312\341\356\377\316\343\357\377\354"
+  39      EDFFCAE1 
+  39      EEFFCEE3 
+  39      EFFFEC
+  40 00d1 DEE4FFEB 		.ascii	"\336\344\377\353\337\347\377\352\340\351\377\352\342\353\377"
+  40      DFE7FFEA 
+  40      E0E9FFEA 
+  40      E2EBFF
+  41 00e0 E9E3EDFF 		.ascii	"\351\343\355\377\350\345\357\377\350\346\360\377\347\350\361"
+  41      E8E5EFFF 
+  41      E8E6F0FF 
+  41      E7E8F1
+  42 00ef FFE7E9F2 		.ascii	"\377\347\351\362\377\357\356\364\377\357\357\365\377\357\360"
+  42      FFEFEEF4 
+  42      FFEFEFF5 
+  42      FFEFF0
+  43 00fe F5FFF0F1 		.ascii	"\365\377\360\361\365\377\361\362\366\377\362\363\366\377\363"
+  43      F5FFF1F2 
+  43      F6FFF2F3 
+  43      F6FFF3
+  44 010d F4F6FFF4 		.ascii	"\364\366\377\364\365\366\377\366\366\366\377\367\366\366\377"
+  44      F5F6FFF6 
+  44      F6F6FFF7 
+  44      F6F6FF
+  45 011c F7F5F5FF 		.ascii	"\367\365\365\377\370\363\364\377\371\362\363\377\371\361\361"
+  45      F8F3F4FF 
+  45      F9F2F3FF 
+  45      F9F1F1
+  46 012b FFFAEFF0 		.ascii	"\377\372\357\360\377\372\356\356\377\373\355\355\377\373\354"
+  46      FFFAEEEE 
+  46      FFFBEDED 
+  46      FFFBEC
+  47 013a EBFFFCEB 		.ascii	"\353\377\374\353\351\377\375\344\335\377\376\343\333\377\376"
+  47      E9FFFDE4 
+  47      DDFFFEE3 
+  47      DBFFFE
+  48 0149 E2D9FFFE 		.ascii	"\342\331\377\376\341\327\377\376\340\325\377\376\337\323\377"
+GAS LISTING /tmp/ccoNxI3i.s 			page 3
+
+
+  48      E1D7FFFE 
+  48      E0D5FFFE 
+  48      DFD3FF
+  49 0158 FEDED1FF 		.ascii	"\376\336\321\377\376\335\317\377\376\334\314\377\375\334\312"
+  49      FEDDCFFF 
+  49      FEDCCCFF 
+  49      FDDCCA
+  50 0167 FFFDDBC8 		.ascii	"\377\375\333\310\377\374\332\306\377\374\330\303\377\374\326"
+  50      FFFCDAC6 
+  50      FFFCD8C3 
+  50      FFFCD6
+  51 0176 C1FFFCD5 		.ascii	"\301\377\374\325\276\377\373\323\274\377\373\321\271\377\373"
+  51      BEFFFBD3 
+  51      BCFFFBD1 
+  51      B9FFFB
+  52 0185 CFB7FFFB 		.ascii	"\317\267\377\373\316\265\377\372\314\262\377\372\312\260\377"
+  52      CEB5FFFA 
+  52      CCB2FFFA 
+  52      CAB0FF
+  53 0194 FAC9AEFF 		.ascii	"\372\311\256\377\372\307\254\377\371\305\252\377\367\271\232"
+  53      FAC7ACFF 
+  53      F9C5AAFF 
+  53      F7B99A
+  54 01a3 FFF7B798 		.ascii	"\377\367\267\230\377\367\266\226\377\366\264\224\377\366\262"
+  54      FFF7B696 
+  54      FFF6B494 
+  54      FFF6B2
+  55 01b2 92FFF6B1 		.ascii	"\222\377\366\261\220\377\366\257\216\377\365\256\214\377\365"
+  55      90FFF6AF 
+  55      8EFFF5AE 
+  55      8CFFF5
+  56 01c1 AC8AFFF5 		.ascii	"\254\212\377\365\253\211\377\364\251\207\377\364\250\205\377"
+  56      AB89FFF4 
+  56      A987FFF4 
+  56      A885FF
+  57 01d0 F4A683FF 		.ascii	"\364\246\203\377\364\245\202\377\363\243\200\377\362\241\177"
+  57      F4A582FF 
+  57      F3A380FF 
+  57      F2A17F
+  58 01df FFF1A07D 		.ascii	"\377\361\240}\377\361\236{\377\360\234z\377\357\233x\377\356"
+  58      FFF19E7B 
+  58      FFF09C7A 
+  58      FFEF9B78 
+  58      FFEE
+  59 01f1 9977FFEE 		.ascii	"\231w\377\356\227v\377\355\226t\377\354\224s\377\354\222q\377"
+  59      9776FFED 
+  59      9674FFEC 
+  59      9473FFEC 
+  59      9271FF
+  60 0204 EB9170FF 		.ascii	"\353\221p\377\352\217o\377\352\216n\377\351\214l\377\350\212"
+  60      EA8F6FFF 
+  60      EA8E6EFF 
+  60      E98C6CFF 
+  60      E88A
+  61 0216 6BFFE27B 		.ascii	"k\377\342{_\377\341z^\377\340x]\377\340w\\\377\337u[\377\336"
+  61      5FFFE17A 
+  61      5EFFE078 
+GAS LISTING /tmp/ccoNxI3i.s 			page 4
+
+
+  61      5DFFE077 
+  61      5CFFDF75 
+  62 022d 745AFFDE 		.ascii	"tZ\377\336rY\377\335qX\377\334oW\377\334nV\377\333lU\377\332"
+  62      7259FFDD 
+  62      7158FFDC 
+  62      6F57FFDC 
+  62      6E56FFDB 
+  63 0245 6B54FFDA 		.ascii	"kT\377\332jS\377\331hR\377\331gQ\377\330eP\377\327dO\377\327"
+  63      6A53FFD9 
+  63      6852FFD9 
+  63      6751FFD8 
+  63      6550FFD7 
+  64 025d 634EFFD6 		.ascii	"cN\377\326aM\377\326`M\377\325_L\377\324^K\377\324]K\377\323"
+  64      614DFFD6 
+  64      604DFFD5 
+  64      5F4CFFD4 
+  64      5E4BFFD4 
+  65 0275 5B4AFFD3 		.ascii	"[J\377\323ZI\377\322YI\377\321XH\377\321WG\377\320VG\377\320"
+  65      5A49FFD2 
+  65      5949FFD1 
+  65      5848FFD1 
+  65      5747FFD0 
+  66 028d 5546FFCF 		.ascii	"UF\377\317TE\377\316SE\377\316RD\377\315QD\377\315PC\377\314"
+  66      5445FFCE 
+  66      5345FFCE 
+  66      5244FFCD 
+  66      5144FFCD 
+  67 02a5 4F43FFCC 		.ascii	"OC\377\314NB\377\313MA\377\312LA\377\312K@\377\311K@\377\311"
+  67      4E42FFCB 
+  67      4D41FFCA 
+  67      4C41FFCA 
+  67      4B40FFC9 
+  68 02bd 4A3FFFC8 		.ascii	"J?\377\310I?\377\310H>\377\30087\377\30077\377\27766\377\277"
+  68      493FFFC8 
+  68      483EFFC0 
+  68      3837FFC0 
+  68      3737FFBF 
+  69 02d5 3636FFBE 		.ascii	"66\377\27655\377\27645\377\27534\377\27524\377\27414\377\274"
+  69      3535FFBE 
+  69      3435FFBD 
+  69      3334FFBD 
+  69      3234FFBC 
+  70 02ed 3033FFBB 		.ascii	"03\377\273/3\377\273.2\377\272-2\377\272,1\377\271+1\377\271"
+  70      2F33FFBB 
+  70      2E32FFBA 
+  70      2D32FFBA 
+  70      2C31FFB9 
+  71 0305 2A31FFB9 		.ascii	"*1\377\271)0\377\270(0\377\270(0\377\267'/\377\267&/\377\266"
+  71      2930FFB8 
+  71      2830FFB8 
+  71      2830FFB7 
+  71      272FFFB7 
+  72 031d 252EFFB6 		.ascii	"%.\377\266$.\377\266#.\377\265\"-\377\265!-\377\264 -\377\264"
+  72      242EFFB6 
+  72      232EFFB5 
+  72      222DFFB5 
+  72      212DFFB4 
+GAS LISTING /tmp/ccoNxI3i.s 			page 5
+
+
+  73 0335 1F2CFFB4 		.ascii	"\037,\377\264\036,\377\263\035,\377\263\034,\377\262\032+\377"
+  73      1E2CFFB3 
+  73      1D2CFFB3 
+  73      1C2CFFB2 
+  73      1A2BFF
+  74 0348 B2192BFF 		.ascii	"\262\031+\377\262\030+\377\261\027*\377\260\027*\377\260\027"
+  74      B2182BFF 
+  74      B1172AFF 
+  74      B0172AFF 
+  74      B017
+  75 035a 2AFFAF16 		.ascii	"*\377\257\026*\377\256\026*\377\256\026*\377\255\025*\377\254"
+  75      2AFFAE16 
+  75      2AFFAE16 
+  75      2AFFAD15 
+  75      2AFFAC
+  76 036d 152AFFAC 		.ascii	"\025*\377\254\025*\377\253\024*\377\252\024*\377\252\024*\377"
+  76      152AFFAB 
+  76      142AFFAA 
+  76      142AFFAA 
+  76      142AFF
+  77 0380 A9142AFF 		.ascii	"\251\024*\377\250\023*\377\250\023*\377\247\023*\377\246\022"
+  77      A8132AFF 
+  77      A8132AFF 
+  77      A7132AFF 
+  77      A612
+  78 0392 29FFA612 		.ascii	")\377\246\022)\377\245\022)\377\245\022)\377\244\021)\377\243"
+  78      29FFA512 
+  78      29FFA512 
+  78      29FFA411 
+  78      29FFA3
+  79 03a5 1129FFA3 		.ascii	"\021)\377\243\021)\377\242\021)\377\242\020)\377\241\020)\377"
+  79      1129FFA2 
+  79      1129FFA2 
+  79      1029FFA1 
+  79      1029FF
+  80 03b8 A01029FF 		.ascii	"\240\020)\377\240\020)\377\237\017)\377\237\017)\377\236\017"
+  80      A01029FF 
+  80      9F0F29FF 
+  80      9F0F29FF 
+  80      9E0F
+  81 03ca 29FF9E0F 		.ascii	")\377\236\017(\377\235\017(\377\235\016(\377\234\016(\377\234"
+  81      28FF9D0F 
+  81      28FF9D0E 
+  81      28FF9C0E 
+  81      28FF9C
+  82 03dd 0E28FF9B 		.ascii	"\016(\377\233\016(\377\233\016(\377\232\r(\377\232\r(\377\231"
+  82      0E28FF9B 
+  82      0E28FF9A 
+  82      0D28FF9A 
+  82      0D28FF99 
+  83 03f1 0D28FF99 		.ascii	"\r(\377\231\r(\377\230\r(\377\230\f(\377\227\f(\377\227\f'\377"
+  83      0D28FF98 
+  83      0D28FF98 
+  83      0C28FF97 
+  83      0C28FF97 
+  84 0408 970C27FF 		.ascii	"\227\f'\377\226\f'\377\226\013'\377\225\013'\377\225\013'\377"
+  84      960C27FF 
+GAS LISTING /tmp/ccoNxI3i.s 			page 6
+
+
+  84      960B27FF 
+  84      950B27FF 
+  84      950B27FF 
+  85 041c 940B27FF 		.ascii	"\224\013'\377\224\013'\377\224\013'\377\223\013'\377\204\006"
+  85      940B27FF 
+  85      940B27FF 
+  85      930B27FF 
+  85      8406
+  86 042e 24FF8305 		.ascii	"$\377\203\005$\377\203\005$\377\203\005$\377\202\005$\377\202"
+  86      24FF8305 
+  86      24FF8305 
+  86      24FF8205 
+  86      24FF82
+  87 0441 0524FF82 		.ascii	"\005$\377\202\005$\377\201\005$\377\201\005$\377\201\004$\377"
+  87      0524FF81 
+  87      0524FF81 
+  87      0524FF81 
+  87      0424FF
+  88 0454 800424FF 		.ascii	"\200\004$\377\200\004$\377\200\004$\377\177\004$\377\177\004"
+  88      800424FF 
+  88      800424FF 
+  88      7F0424FF 
+  88      7F04
+  89 0466 24FF7F04 		.ascii	"$\377\177\004$\377~\004#\377~\004#\377~\004#\377}\004#\377}\003"
+  89      24FF7E04 
+  89      23FF7E04 
+  89      23FF7E04 
+  89      23FF7D04 
+  90 047e 23FF7D03 		.ascii	"#\377}\003#\377|\003#\377|\003#\377|\003#\377{\003#\377{"
+  90      23FF7C03 
+  90      23FF7C03 
+  90      23FF7C03 
+  90      23FF7B03 
+  91 0495 0323FF7B 		.string	"\003#\377{\003#\377{\003#\377z\003#\377z\003#\377z\003#\377y\003#\377y\003#\377y\002#\377
+  91      0323FF7B 
+  91      0323FF7A 
+  91      0323FF7A 
+  91      0323FF7A 
+  92 0596 20FF6F00 		.string	" \377o"
+  93 059a 20FF6E00 		.string	" \377n"
+  94 059e 20FF6E00 		.string	" \377n"
+  95 05a2 20FF6E00 		.string	" \377n"
+  96 05a6 20FF6E00 		.string	" \377n"
+  97 05aa 20FF6E00 		.string	" \377n"
+  98 05ae 20FF6E00 		.string	" \377n"
+  99 05b2 20FF6E00 		.string	" \377n"
+ 100 05b6 20FF6E00 		.string	" \377n"
+ 101 05ba 20FF6E00 		.string	" \377n"
+ 102 05be 20FF6D00 		.string	" \377m"
+ 103 05c2 20FF6D00 		.string	" \377m"
+ 104 05c6 20FF6D00 		.string	" \377m"
+ 105 05ca 20FF6D00 		.string	" \377m"
+ 106 05ce 20FF6D00 		.string	" \377m"
+ 107 05d2 20FF6D00 		.string	" \377m"
+ 108 05d6 20FF6D00 		.string	" \377m"
+ 109 05da 20FF6D00 		.string	" \377m"
+ 110 05de 20FF6D00 		.string	" \377m"
+GAS LISTING /tmp/ccoNxI3i.s 			page 7
+
+
+ 111 05e2 20FF6D00 		.string	" \377m"
+ 112 05e6 20FF6C00 		.string	" \377l"
+ 113 05ea 20FF6C00 		.string	" \377l"
+ 114 05ee 20FF6C00 		.string	" \377l"
+ 115 05f2 20FF6C00 		.string	" \377l"
+ 116 05f6 20FF6C00 		.string	" \377l"
+ 117 05fa 20FF6C00 		.string	" \377l"
+ 118 05fe 20FF6C00 		.string	" \377l"
+ 119 0602 20FF6C00 		.string	" \377l"
+ 120 0606 20FF6C00 		.string	" \377l"
+ 121 060a 20FF6C00 		.string	" \377l"
+ 122 060e 20FF6C00 		.string	" \377l"
+ 123 0612 20FF6C00 		.string	" \377l"
+ 124 0616 20FF6B00 		.string	" \377k"
+ 125 061a 20FF6B00 		.string	" \377k"
+ 126 061e 20FF6B00 		.string	" \377k"
+ 127 0622 20FF6B00 		.string	" \377k"
+ 128 0626 20FF6B00 		.string	" \377k"
+ 129 062a 20FF6B00 		.string	" \377k"
+ 130 062e 20FF6B00 		.string	" \377k"
+ 131 0632 20FF6B00 		.string	" \377k"
+ 132 0636 20FF6B00 		.string	" \377k"
+ 133 063a 20FF6B00 		.string	" \377k"
+ 134 063e 20FF6B00 		.string	" \377k"
+ 135 0642 1FFF6B00 		.string	"\037\377k"
+ 136 0646 1FFF6B00 		.string	"\037\377k"
+ 137 064a 1FFF6B00 		.string	"\037\377k"
+ 138 064e 1FFF6A00 		.string	"\037\377j"
+ 139 0652 1FFF6A00 		.string	"\037\377j"
+ 140 0656 1FFF6A00 		.string	"\037\377j"
+ 141 065a 1FFF6A00 		.string	"\037\377j"
+ 142 065e 1FFF6A00 		.string	"\037\377j"
+ 143 0662 1FFF6A00 		.string	"\037\377j"
+ 144 0666 1FFF6A00 		.string	"\037\377j"
+ 145 066a 1FFF6A00 		.string	"\037\377j"
+ 146 066e 1FFF6A00 		.string	"\037\377j"
+ 147 0672 1FFF6A00 		.string	"\037\377j"
+ 148 0676 1FFF6A00 		.string	"\037\377j"
+ 149 067a 1FFF6A00 		.string	"\037\377j"
+ 150 067e 1FFF6A00 		.string	"\037\377j"
+ 151 0682 1FFF6A00 		.string	"\037\377j"
+ 152 0686 1FFF6A00 		.string	"\037\377j"
+ 153 068a 1FFF6A00 		.string	"\037\377j"
+ 154 068e 1FFF6A00 		.string	"\037\377j"
+ 155 0692 1FFF6900 		.string	"\037\377i"
+ 156 0696 1FFF6900 		.string	"\037\377i"
+ 157 069a 1FFF6900 		.string	"\037\377i"
+ 158 069e 1FFF6900 		.string	"\037\377i"
+ 159 06a2 1FFF6900 		.string	"\037\377i"
+ 160 06a6 1FFF6900 		.string	"\037\377i"
+ 161 06aa 1FFF6900 		.string	"\037\377i"
+ 162 06ae 1FFF6900 		.string	"\037\377i"
+ 163 06b2 1FFF6900 		.string	"\037\377i"
+ 164 06b6 1FFF6900 		.string	"\037\377i"
+ 165 06ba 1FFF6900 		.string	"\037\377i"
+ 166 06be 1FFF6900 		.string	"\037\377i"
+ 167 06c2 1FFF6900 		.string	"\037\377i"
+GAS LISTING /tmp/ccoNxI3i.s 			page 8
+
+
+ 168 06c6 1FFF6900 		.string	"\037\377i"
+ 169 06ca 1FFF6900 		.string	"\037\377i"
+ 170 06ce 1FFF6900 		.string	"\037\377i"
+ 171 06d2 1FFF6900 		.string	"\037\377i"
+ 172 06d6 1FFF6900 		.string	"\037\377i"
+ 173 06da 1FFF6900 		.string	"\037\377i"
+ 174 06de 1FFF6900 		.string	"\037\377i"
+ 175 06e2 1FFF6900 		.string	"\037\377i"
+ 176 06e6 1FFF6900 		.string	"\037\377i"
+ 177 06ea 1FFF6900 		.string	"\037\377i"
+ 178 06ee 1FFF6900 		.string	"\037\377i"
+ 179 06f2 1FFF6800 		.string	"\037\377h"
+ 180 06f6 1FFF6800 		.string	"\037\377h"
+ 181 06fa 1FFF6800 		.string	"\037\377h"
+ 182 06fe 1FFF6800 		.string	"\037\377h"
+ 183 0702 1FFF6800 		.string	"\037\377h"
+ 184 0706 1FFF6800 		.string	"\037\377h"
+ 185 070a 1FFF6800 		.string	"\037\377h"
+ 186 070e 1FFF6800 		.string	"\037\377h"
+ 187 0712 1FFF6800 		.string	"\037\377h"
+ 188 0716 1FFF6800 		.string	"\037\377h"
+ 189 071a 1FFF6800 		.string	"\037\377h"
+ 190 071e 1FFF6800 		.string	"\037\377h"
+ 191 0722 1FFF6800 		.string	"\037\377h"
+ 192 0726 1FFF6800 		.string	"\037\377h"
+ 193 072a 1FFF6800 		.string	"\037\377h"
+ 194 072e 1FFF6800 		.string	"\037\377h"
+ 195 0732 1FFF6800 		.string	"\037\377h"
+ 196 0736 1FFF6800 		.string	"\037\377h"
+ 197 073a 1FFF6800 		.string	"\037\377h"
+ 198 073e 1FFF6800 		.string	"\037\377h"
+ 199 0742 1FFF6800 		.string	"\037\377h"
+ 200 0746 1FFF6800 		.string	"\037\377h"
+ 201 074a 1FFF6800 		.string	"\037\377h"
+ 202 074e 1FFF6800 		.string	"\037\377h"
+ 203 0752 1FFF6800 		.string	"\037\377h"
+ 204 0756 1FFF6800 		.string	"\037\377h"
+ 205 075a 1FFF6800 		.string	"\037\377h"
+ 206 075e 1FFF6800 		.string	"\037\377h"
+ 207 0762 1FFF6800 		.string	"\037\377h"
+ 208 0766 1FFF6800 		.string	"\037\377h"
+ 209 076a 1FFF6800 		.string	"\037\377h"
+ 210 076e 1FFF6800 		.string	"\037\377h"
+ 211 0772 1FFF6800 		.string	"\037\377h"
+ 212 0776 1FFF6800 		.string	"\037\377h"
+ 213 077a 1FFF6800 		.string	"\037\377h"
+ 214 077e 1FFF6800 		.string	"\037\377h"
+ 215 0782 1FFF6800 		.string	"\037\377h"
+ 216 0786 1FFF6800 		.string	"\037\377h"
+ 217 078a 1FFF6800 		.string	"\037\377h"
+ 218 078e 1FFF6700 		.string	"\037\377g"
+ 219 0792 1FFF6700 		.string	"\037\377g"
+ 220 0796 1FFF6700 		.string	"\037\377g"
+ 221 079a 1FFF6700 		.string	"\037\377g"
+ 222 079e 1FFF6700 		.string	"\037\377g"
+ 223 07a2 1FFF6700 		.string	"\037\377g"
+ 224 07a6 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccoNxI3i.s 			page 9
+
+
+ 225 07aa 1FFF6700 		.string	"\037\377g"
+ 226 07ae 1FFF6700 		.string	"\037\377g"
+ 227 07b2 1FFF6700 		.string	"\037\377g"
+ 228 07b6 1FFF6700 		.string	"\037\377g"
+ 229 07ba 1FFF6700 		.string	"\037\377g"
+ 230 07be 1FFF6700 		.string	"\037\377g"
+ 231 07c2 1FFF6700 		.string	"\037\377g"
+ 232 07c6 1FFF6700 		.string	"\037\377g"
+ 233 07ca 1FFF6700 		.string	"\037\377g"
+ 234 07ce 1FFF     		.ascii	"\037\377"
+ 235 07d0 6700     		.string	"g"
+ 236 07d2 1FFF6700 		.string	"\037\377g"
+ 237 07d6 1FFF6700 		.string	"\037\377g"
+ 238 07da 1FFF6700 		.string	"\037\377g"
+ 239 07de 1FFF6700 		.string	"\037\377g"
+ 240 07e2 1FFF6700 		.string	"\037\377g"
+ 241 07e6 1FFF6700 		.string	"\037\377g"
+ 242 07ea 1FFF6700 		.string	"\037\377g"
+ 243 07ee 1FFF6700 		.string	"\037\377g"
+ 244 07f2 1FFF6700 		.string	"\037\377g"
+ 245 07f6 1FFF6700 		.string	"\037\377g"
+ 246 07fa 1FFF6700 		.string	"\037\377g"
+ 247 07fe 1FFF6700 		.string	"\037\377g"
+ 248 0802 1FFF6700 		.string	"\037\377g"
+ 249 0806 1FFF6700 		.string	"\037\377g"
+ 250 080a 1FFF6700 		.string	"\037\377g"
+ 251 080e 1FFF6700 		.string	"\037\377g"
+ 252 0812 1FFF6700 		.string	"\037\377g"
+ 253 0816 1FFF6700 		.string	"\037\377g"
+ 254 081a 1FFF6700 		.string	"\037\377g"
+ 255 081e 1FFF6700 		.string	"\037\377g"
+ 256 0822 1FFF6700 		.string	"\037\377g"
+ 257 0826 1FFF6700 		.string	"\037\377g"
+ 258 082a 1FFF6700 		.string	"\037\377g"
+ 259 082e 1FFF6700 		.string	"\037\377g"
+ 260 0832 1FFF6700 		.string	"\037\377g"
+ 261 0836 1FFF6700 		.string	"\037\377g"
+ 262 083a 1FFF6700 		.string	"\037\377g"
+ 263 083e 1FFF6700 		.string	"\037\377g"
+ 264 0842 1FFF6700 		.string	"\037\377g"
+ 265 0846 1FFF6700 		.string	"\037\377g"
+ 266 084a 1FFF6700 		.string	"\037\377g"
+ 267 084e 1FFF6700 		.string	"\037\377g"
+ 268 0852 1FFF6700 		.string	"\037\377g"
+ 269 0856 1FFF6700 		.string	"\037\377g"
+ 270 085a 1FFF6700 		.string	"\037\377g"
+ 271 085e 1FFF6700 		.string	"\037\377g"
+ 272 0862 1FFF6700 		.string	"\037\377g"
+ 273 0866 1FFF6700 		.string	"\037\377g"
+ 274 086a 1FFF6700 		.string	"\037\377g"
+ 275 086e 1FFF6700 		.string	"\037\377g"
+ 276 0872 1FFF6700 		.string	"\037\377g"
+ 277 0876 1FFF6700 		.string	"\037\377g"
+ 278 087a 1FFF6700 		.string	"\037\377g"
+ 279 087e 1FFF6700 		.string	"\037\377g"
+ 280 0882 1FFF6700 		.string	"\037\377g"
+ 281 0886 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccoNxI3i.s 			page 10
+
+
+ 282 088a 1FFF6700 		.string	"\037\377g"
+ 283 088e 1FFF6700 		.string	"\037\377g"
+ 284 0892 1FFF6700 		.string	"\037\377g"
+ 285 0896 1FFF6700 		.string	"\037\377g"
+ 286 089a 1FFF6700 		.string	"\037\377g"
+ 287 089e 1FFF6700 		.string	"\037\377g"
+ 288 08a2 1FFF6700 		.string	"\037\377g"
+ 289 08a6 1FFF6700 		.string	"\037\377g"
+ 290 08aa 1FFF6700 		.string	"\037\377g"
+ 291 08ae 1FFF6700 		.string	"\037\377g"
+ 292 08b2 1FFF6700 		.string	"\037\377g"
+ 293 08b6 1FFF6700 		.string	"\037\377g"
+ 294 08ba 1FFF6700 		.string	"\037\377g"
+ 295 08be 1FFF6700 		.string	"\037\377g"
+ 296 08c2 1FFF6700 		.string	"\037\377g"
+ 297 08c6 1FFF6700 		.string	"\037\377g"
+ 298 08ca 1FFF6700 		.string	"\037\377g"
+ 299 08ce 1FFF6700 		.string	"\037\377g"
+ 300 08d2 1FFF6700 		.string	"\037\377g"
+ 301 08d6 1FFF6700 		.string	"\037\377g"
+ 302 08da 1FFF6700 		.string	"\037\377g"
+ 303 08de 1FFF6700 		.string	"\037\377g"
+ 304 08e2 1FFF6700 		.string	"\037\377g"
+ 305 08e6 1FFF6700 		.string	"\037\377g"
+ 306 08ea 1FFF6700 		.string	"\037\377g"
+ 307 08ee 1FFF6700 		.string	"\037\377g"
+ 308 08f2 1FFF6700 		.string	"\037\377g"
+ 309 08f6 1FFF6700 		.string	"\037\377g"
+ 310 08fa 1FFF6700 		.string	"\037\377g"
+ 311 08fe 1FFF6700 		.string	"\037\377g"
+ 312 0902 1FFF6700 		.string	"\037\377g"
+ 313 0906 1FFF6700 		.string	"\037\377g"
+ 314 090a 1FFF6700 		.string	"\037\377g"
+ 315 090e 1FFF6700 		.string	"\037\377g"
+ 316 0912 1FFF6700 		.string	"\037\377g"
+ 317 0916 1FFF6700 		.string	"\037\377g"
+ 318 091a 1FFF6700 		.string	"\037\377g"
+ 319 091e 1FFF6700 		.string	"\037\377g"
+ 320 0922 1FFF6700 		.string	"\037\377g"
+ 321 0926 1FFF6700 		.string	"\037\377g"
+ 322 092a 1FFF6700 		.string	"\037\377g"
+ 323 092e 1FFF6700 		.string	"\037\377g"
+ 324 0932 1FFF6700 		.string	"\037\377g"
+ 325 0936 1FFF6700 		.string	"\037\377g"
+ 326 093a 1FFF6700 		.string	"\037\377g"
+ 327 093e 1FFF6700 		.string	"\037\377g"
+ 328 0942 1FFF6700 		.string	"\037\377g"
+ 329 0946 1FFF6700 		.string	"\037\377g"
+ 330 094a 1FFF6700 		.string	"\037\377g"
+ 331 094e 1FFF6700 		.string	"\037\377g"
+ 332 0952 1FFF6700 		.string	"\037\377g"
+ 333 0956 1FFF6700 		.string	"\037\377g"
+ 334 095a 1FFF6700 		.string	"\037\377g"
+ 335 095e 1FFF6700 		.string	"\037\377g"
+ 336 0962 1FFF6700 		.string	"\037\377g"
+ 337 0966 1FFF6700 		.string	"\037\377g"
+ 338 096a 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccoNxI3i.s 			page 11
+
+
+ 339 096e 1FFF6700 		.string	"\037\377g"
+ 340 0972 1FFF6700 		.string	"\037\377g"
+ 341 0976 1FFF6700 		.string	"\037\377g"
+ 342 097a 1FFF6700 		.string	"\037\377g"
+ 343 097e 1FFF6700 		.string	"\037\377g"
+ 344 0982 1FFF6700 		.string	"\037\377g"
+ 345 0986 1FFF6700 		.string	"\037\377g"
+ 346 098a 1FFF6700 		.string	"\037\377g"
+ 347 098e 1FFF6700 		.string	"\037\377g"
+ 348 0992 1FFF6700 		.string	"\037\377g"
+ 349 0996 1FFF6700 		.string	"\037\377g"
+ 350 099a 1FFF6700 		.string	"\037\377g"
+ 351 099e 1FFF6700 		.string	"\037\377g"
+ 352 09a2 1FFF6700 		.string	"\037\377g"
+ 353 09a6 1FFF6700 		.string	"\037\377g"
+ 354 09aa 1FFF6700 		.string	"\037\377g"
+ 355 09ae 1FFF6700 		.string	"\037\377g"
+ 356 09b2 1FFF6700 		.string	"\037\377g"
+ 357 09b6 1FFF6700 		.string	"\037\377g"
+ 358 09ba 1FFF6700 		.string	"\037\377g"
+ 359 09be 1FFF6700 		.string	"\037\377g"
+ 360 09c2 1FFF6700 		.string	"\037\377g"
+ 361 09c6 1FFF6700 		.string	"\037\377g"
+ 362 09ca 1FFF6700 		.string	"\037\377g"
+ 363 09ce 1FFF6700 		.string	"\037\377g"
+ 364 09d2 1FFF6700 		.string	"\037\377g"
+ 365 09d6 1FFF6700 		.string	"\037\377g"
+ 366 09da 1FFF6700 		.string	"\037\377g"
+ 367 09de 1FFF6700 		.string	"\037\377g"
+ 368 09e2 1FFF6700 		.string	"\037\377g"
+ 369 09e6 1FFF6700 		.string	"\037\377g"
+ 370 09ea 1FFF6700 		.string	"\037\377g"
+ 371 09ee 1FFF6700 		.string	"\037\377g"
+ 372 09f2 1FFF6700 		.string	"\037\377g"
+ 373 09f6 1FFF6700 		.string	"\037\377g"
+ 374 09fa 1FFF6700 		.string	"\037\377g"
+ 375 09fe 1FFF6700 		.string	"\037\377g"
+ 376 0a02 1FFF6700 		.string	"\037\377g"
+ 377 0a06 1FFF6700 		.string	"\037\377g"
+ 378 0a0a 1FFF6700 		.string	"\037\377g"
+ 379 0a0e 1FFF6700 		.string	"\037\377g"
+ 380 0a12 1FFF6700 		.string	"\037\377g"
+ 381 0a16 1FFF6700 		.string	"\037\377g"
+ 382 0a1a 1FFF6700 		.string	"\037\377g"
+ 383 0a1e 1FFF6700 		.string	"\037\377g"
+ 384 0a22 1FFF6700 		.string	"\037\377g"
+ 385 0a26 1FFF6700 		.string	"\037\377g"
+ 386 0a2a 1FFF6700 		.string	"\037\377g"
+ 387 0a2e 1FFF6700 		.string	"\037\377g"
+ 388 0a32 1FFF6700 		.string	"\037\377g"
+ 389 0a36 1FFF6700 		.string	"\037\377g"
+ 390 0a3a 1FFF6700 		.string	"\037\377g"
+ 391 0a3e 1FFF6700 		.string	"\037\377g"
+ 392 0a42 1FFF6700 		.string	"\037\377g"
+ 393 0a46 1FFF6700 		.string	"\037\377g"
+ 394 0a4a 1FFF6700 		.string	"\037\377g"
+ 395 0a4e 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccoNxI3i.s 			page 12
+
+
+ 396 0a52 1FFF6700 		.string	"\037\377g"
+ 397 0a56 1FFF6700 		.string	"\037\377g"
+ 398 0a5a 1FFF6700 		.string	"\037\377g"
+ 399 0a5e 1FFF6700 		.string	"\037\377g"
+ 400 0a62 1FFF6700 		.string	"\037\377g"
+ 401 0a66 1FFF6700 		.string	"\037\377g"
+ 402 0a6a 1FFF6700 		.string	"\037\377g"
+ 403 0a6e 1FFF6700 		.string	"\037\377g"
+ 404 0a72 1FFF6700 		.string	"\037\377g"
+ 405 0a76 1FFF6700 		.string	"\037\377g"
+ 406 0a7a 1FFF6700 		.string	"\037\377g"
+ 407 0a7e 1FFF6700 		.string	"\037\377g"
+ 408 0a82 1FFF6700 		.string	"\037\377g"
+ 409 0a86 1FFF6700 		.string	"\037\377g"
+ 410 0a8a 1FFF6700 		.string	"\037\377g"
+ 411 0a8e 1FFF6700 		.string	"\037\377g"
+ 412 0a92 1FFF6700 		.string	"\037\377g"
+ 413 0a96 1FFF6700 		.string	"\037\377g"
+ 414 0a9a 1FFF6700 		.string	"\037\377g"
+ 415 0a9e 1FFF6700 		.string	"\037\377g"
+ 416 0aa2 1FFF6700 		.string	"\037\377g"
+ 417 0aa6 1FFF6700 		.string	"\037\377g"
+ 418 0aaa 1FFF6700 		.string	"\037\377g"
+ 419 0aae 1FFF6700 		.string	"\037\377g"
+ 420 0ab2 1FFF6700 		.string	"\037\377g"
+ 421 0ab6 1FFF6700 		.string	"\037\377g"
+ 422 0aba 1FFF6700 		.string	"\037\377g"
+ 423 0abe 1FFF6700 		.string	"\037\377g"
+ 424 0ac2 1FFF6700 		.string	"\037\377g"
+ 425 0ac6 1FFF6700 		.string	"\037\377g"
+ 426 0aca 1FFF6700 		.string	"\037\377g"
+ 427 0ace 1FFF6700 		.string	"\037\377g"
+ 428 0ad2 1FFF6700 		.string	"\037\377g"
+ 429 0ad6 1FFF6700 		.string	"\037\377g"
+ 430 0ada 1FFF6700 		.string	"\037\377g"
+ 431 0ade 1FFF6700 		.string	"\037\377g"
+ 432 0ae2 1FFF6700 		.string	"\037\377g"
+ 433 0ae6 1FFF6700 		.string	"\037\377g"
+ 434 0aea 1FFF6700 		.string	"\037\377g"
+ 435 0aee 1FFF6700 		.string	"\037\377g"
+ 436 0af2 1FFF6700 		.string	"\037\377g"
+ 437 0af6 1FFF6700 		.string	"\037\377g"
+ 438 0afa 1FFF6700 		.string	"\037\377g"
+ 439 0afe 1FFF6700 		.string	"\037\377g"
+ 440 0b02 1FFF6700 		.string	"\037\377g"
+ 441 0b06 1FFF6700 		.string	"\037\377g"
+ 442 0b0a 1FFF6700 		.string	"\037\377g"
+ 443 0b0e 1FFF6700 		.string	"\037\377g"
+ 444 0b12 1FFF6700 		.string	"\037\377g"
+ 445 0b16 1FFF6700 		.string	"\037\377g"
+ 446 0b1a 1FFF6700 		.string	"\037\377g"
+ 447 0b1e 1FFF6700 		.string	"\037\377g"
+ 448 0b22 1FFF6700 		.string	"\037\377g"
+ 449 0b26 1FFF6700 		.string	"\037\377g"
+ 450 0b2a 1FFF6700 		.string	"\037\377g"
+ 451 0b2e 1FFF6700 		.string	"\037\377g"
+ 452 0b32 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccoNxI3i.s 			page 13
+
+
+ 453 0b36 1FFF6700 		.string	"\037\377g"
+ 454 0b3a 1FFF6700 		.string	"\037\377g"
+ 455 0b3e 1FFF6700 		.string	"\037\377g"
+ 456 0b42 1FFF6700 		.string	"\037\377g"
+ 457 0b46 1FFF6700 		.string	"\037\377g"
+ 458 0b4a 1FFF6700 		.string	"\037\377g"
+ 459 0b4e 1FFF6700 		.string	"\037\377g"
+ 460 0b52 1FFF6700 		.string	"\037\377g"
+ 461 0b56 1FFF6700 		.string	"\037\377g"
+ 462 0b5a 1FFF6700 		.string	"\037\377g"
+ 463 0b5e 1FFF6700 		.string	"\037\377g"
+ 464 0b62 1FFF6700 		.string	"\037\377g"
+ 465 0b66 1FFF6700 		.string	"\037\377g"
+ 466 0b6a 1FFF6700 		.string	"\037\377g"
+ 467 0b6e 1FFF6700 		.string	"\037\377g"
+ 468 0b72 1FFF6700 		.string	"\037\377g"
+ 469 0b76 1FFF6700 		.string	"\037\377g"
+ 470 0b7a 1FFF6700 		.string	"\037\377g"
+ 471 0b7e 1FFF6700 		.string	"\037\377g"
+ 472 0b82 1FFF6700 		.string	"\037\377g"
+ 473 0b86 1FFF6700 		.string	"\037\377g"
+ 474 0b8a 1FFF6700 		.string	"\037\377g"
+ 475 0b8e 1FFF6700 		.string	"\037\377g"
+ 476 0b92 1FFF6700 		.string	"\037\377g"
+ 477 0b96 1FFF6700 		.string	"\037\377g"
+ 478 0b9a 1FFF6700 		.string	"\037\377g"
+ 479 0b9e 1FFF6700 		.string	"\037\377g"
+ 480 0ba2 1FFF6700 		.string	"\037\377g"
+ 481 0ba6 1FFF6700 		.string	"\037\377g"
+ 482 0baa 1FFF6700 		.string	"\037\377g"
+ 483 0bae 1FFF6700 		.string	"\037\377g"
+ 484 0bb2 1FFF6700 		.string	"\037\377g"
+ 485 0bb6 1FFF6700 		.string	"\037\377g"
+ 486 0bba 1FFF6700 		.string	"\037\377g"
+ 487 0bbe 1FFF6700 		.string	"\037\377g"
+ 488 0bc2 1FFF6700 		.string	"\037\377g"
+ 489 0bc6 1FFF6700 		.string	"\037\377g"
+ 490 0bca 1FFF6700 		.string	"\037\377g"
+ 491 0bce 1FFF6700 		.string	"\037\377g"
+ 492 0bd2 1FFF6700 		.string	"\037\377g"
+ 493 0bd6 1FFF6700 		.string	"\037\377g"
+ 494 0bda 1FFF6700 		.string	"\037\377g"
+ 495 0bde 1FFF6700 		.string	"\037\377g"
+ 496 0be2 1FFF6700 		.string	"\037\377g"
+ 497 0be6 1FFF6700 		.string	"\037\377g"
+ 498 0bea 1FFF6700 		.string	"\037\377g"
+ 499 0bee 1FFF6700 		.string	"\037\377g"
+ 500 0bf2 1FFF6700 		.string	"\037\377g"
+ 501 0bf6 1FFF6700 		.string	"\037\377g"
+ 502 0bfa 1FFF6700 		.string	"\037\377g"
+ 503 0bfe 1FFF6700 		.string	"\037\377g"
+ 504 0c02 1FFF6700 		.string	"\037\377g"
+ 505 0c06 1FFF6700 		.string	"\037\377g"
+ 506 0c0a 1FFF6700 		.string	"\037\377g"
+ 507 0c0e 1FFF6700 		.string	"\037\377g"
+ 508 0c12 1FFF6700 		.string	"\037\377g"
+ 509 0c16 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccoNxI3i.s 			page 14
+
+
+ 510 0c1a 1FFF6700 		.string	"\037\377g"
+ 511 0c1e 1FFF6700 		.string	"\037\377g"
+ 512 0c22 1FFF6700 		.string	"\037\377g"
+ 513 0c26 1FFF6700 		.string	"\037\377g"
+ 514 0c2a 1FFF6700 		.string	"\037\377g"
+ 515 0c2e 1FFF6700 		.string	"\037\377g"
+ 516 0c32 1FFF6700 		.string	"\037\377g"
+ 517 0c36 1FFF6700 		.string	"\037\377g"
+ 518 0c3a 1FFF6700 		.string	"\037\377g"
+ 519 0c3e 1FFF6700 		.string	"\037\377g"
+ 520 0c42 1FFF6700 		.string	"\037\377g"
+ 521 0c46 1FFF6700 		.string	"\037\377g"
+ 522 0c4a 1FFF6700 		.string	"\037\377g"
+ 523 0c4e 1FFF6700 		.string	"\037\377g"
+ 524 0c52 1FFF6700 		.string	"\037\377g"
+ 525 0c56 1FFF6700 		.string	"\037\377g"
+ 526 0c5a 1FFF6700 		.string	"\037\377g"
+ 527 0c5e 1FFF6700 		.string	"\037\377g"
+ 528 0c62 1FFF6700 		.string	"\037\377g"
+ 529 0c66 1FFF6700 		.string	"\037\377g"
+ 530 0c6a 1FFF6700 		.string	"\037\377g"
+ 531 0c6e 1FFF6700 		.string	"\037\377g"
+ 532 0c72 1FFF6700 		.string	"\037\377g"
+ 533 0c76 1FFF6700 		.string	"\037\377g"
+ 534 0c7a 1FFF6700 		.string	"\037\377g"
+ 535 0c7e 1FFF6700 		.string	"\037\377g"
+ 536 0c82 1FFF6700 		.string	"\037\377g"
+ 537 0c86 1FFF6700 		.string	"\037\377g"
+ 538 0c8a 1FFF6700 		.string	"\037\377g"
+ 539 0c8e 1FFF6700 		.string	"\037\377g"
+ 540 0c92 1FFF6700 		.string	"\037\377g"
+ 541 0c96 1FFF6700 		.string	"\037\377g"
+ 542 0c9a 1FFF6700 		.string	"\037\377g"
+ 543 0c9e 1FFF6700 		.string	"\037\377g"
+ 544 0ca2 1FFF6700 		.string	"\037\377g"
+ 545 0ca6 1FFF6700 		.string	"\037\377g"
+ 546 0caa 1FFF6700 		.string	"\037\377g"
+ 547 0cae 1FFF6700 		.string	"\037\377g"
+ 548 0cb2 1FFF6700 		.string	"\037\377g"
+ 549 0cb6 1FFF6700 		.string	"\037\377g"
+ 550 0cba 1FFF6700 		.string	"\037\377g"
+ 551 0cbe 1FFF6700 		.string	"\037\377g"
+ 552 0cc2 1FFF6700 		.string	"\037\377g"
+ 553 0cc6 1FFF6700 		.string	"\037\377g"
+ 554 0cca 1FFF6700 		.string	"\037\377g"
+ 555 0cce 1FFF6700 		.string	"\037\377g"
+ 556 0cd2 1FFF6700 		.string	"\037\377g"
+ 557 0cd6 1FFF6700 		.string	"\037\377g"
+ 558 0cda 1FFF6700 		.string	"\037\377g"
+ 559 0cde 1FFF6700 		.string	"\037\377g"
+ 560 0ce2 1FFF6700 		.string	"\037\377g"
+ 561 0ce6 1FFF6700 		.string	"\037\377g"
+ 562 0cea 1FFF6700 		.string	"\037\377g"
+ 563 0cee 1FFF6700 		.string	"\037\377g"
+ 564 0cf2 1FFF6700 		.string	"\037\377g"
+ 565 0cf6 1FFF6700 		.string	"\037\377g"
+ 566 0cfa 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccoNxI3i.s 			page 15
+
+
+ 567 0cfe 1FFF6700 		.string	"\037\377g"
+ 568 0d02 1FFF6700 		.string	"\037\377g"
+ 569 0d06 1FFF6700 		.string	"\037\377g"
+ 570 0d0a 1FFF6700 		.string	"\037\377g"
+ 571 0d0e 1FFF6700 		.string	"\037\377g"
+ 572 0d12 1FFF6700 		.string	"\037\377g"
+ 573 0d16 1FFF6700 		.string	"\037\377g"
+ 574 0d1a 1FFF6700 		.string	"\037\377g"
+ 575 0d1e 1FFF6700 		.string	"\037\377g"
+ 576 0d22 1FFF6700 		.string	"\037\377g"
+ 577 0d26 1FFF6700 		.string	"\037\377g"
+ 578 0d2a 1FFF6700 		.string	"\037\377g"
+ 579 0d2e 1FFF6700 		.string	"\037\377g"
+ 580 0d32 1FFF6700 		.string	"\037\377g"
+ 581 0d36 1FFF6700 		.string	"\037\377g"
+ 582 0d3a 1FFF6700 		.string	"\037\377g"
+ 583 0d3e 1FFF6700 		.string	"\037\377g"
+ 584 0d42 1FFF6700 		.string	"\037\377g"
+ 585 0d46 1FFF6700 		.string	"\037\377g"
+ 586 0d4a 1FFF6700 		.string	"\037\377g"
+ 587 0d4e 1FFF6700 		.string	"\037\377g"
+ 588 0d52 1FFF6700 		.string	"\037\377g"
+ 589 0d56 1FFF6700 		.string	"\037\377g"
+ 590 0d5a 1FFF6700 		.string	"\037\377g"
+ 591 0d5e 1FFF6700 		.string	"\037\377g"
+ 592 0d62 1FFF6700 		.string	"\037\377g"
+ 593 0d66 1EFF6700 		.string	"\036\377g"
+ 594 0d6a 1EFF6700 		.string	"\036\377g"
+ 595 0d6e 1EFF6600 		.string	"\036\377f"
+ 596 0d72 1EFF6600 		.string	"\036\377f"
+ 597 0d76 1EFF6600 		.string	"\036\377f"
+ 598 0d7a 1EFF6600 		.string	"\036\377f"
+ 599 0d7e 1EFF6600 		.string	"\036\377f"
+ 600 0d82 1EFF6600 		.string	"\036\377f"
+ 601 0d86 1EFF6600 		.string	"\036\377f"
+ 602 0d8a 1EFF6600 		.string	"\036\377f"
+ 603 0d8e 1EFF6600 		.string	"\036\377f"
+ 604 0d92 1EFF6600 		.string	"\036\377f"
+ 605 0d96 1EFF6600 		.string	"\036\377f"
+ 606 0d9a 1EFF6600 		.string	"\036\377f"
+ 607 0d9e 1EFF6600 		.string	"\036\377f"
+ 608 0da2 1EFF6600 		.string	"\036\377f"
+ 609 0da6 1EFF6600 		.string	"\036\377f"
+ 610 0daa 1EFF6600 		.string	"\036\377f"
+ 611 0dae 1EFF6600 		.string	"\036\377f"
+ 612 0db2 1EFF6600 		.string	"\036\377f"
+ 613 0db6 1EFF6600 		.string	"\036\377f"
+ 614 0dba 1EFF6600 		.string	"\036\377f"
+ 615 0dbe 1EFF6600 		.string	"\036\377f"
+ 616 0dc2 1EFF6600 		.string	"\036\377f"
+ 617 0dc6 1EFF6600 		.string	"\036\377f"
+ 618 0dca 1EFF6600 		.string	"\036\377f"
+ 619 0dce 1EFF6600 		.string	"\036\377f"
+ 620 0dd2 1EFF6600 		.string	"\036\377f"
+ 621 0dd6 1EFF6600 		.string	"\036\377f"
+ 622 0dda 1EFF6600 		.string	"\036\377f"
+ 623 0dde 1EFF6600 		.string	"\036\377f"
+GAS LISTING /tmp/ccoNxI3i.s 			page 16
+
+
+ 624 0de2 1EFF6600 		.string	"\036\377f"
+ 625 0de6 1EFF6600 		.string	"\036\377f"
+ 626 0dea 1EFF6600 		.string	"\036\377f"
+ 627 0dee 1EFF6600 		.string	"\036\377f"
+ 628 0df2 1EFF6600 		.string	"\036\377f"
+ 629 0df6 1EFF6600 		.string	"\036\377f"
+ 630 0dfa 1EFF6600 		.string	"\036\377f"
+ 631 0dfe 1EFF6600 		.string	"\036\377f"
+ 632 0e02 1EFF6600 		.string	"\036\377f"
+ 633 0e06 1EFF6600 		.string	"\036\377f"
+ 634 0e0a 1EFF6600 		.string	"\036\377f"
+ 635 0e0e 1EFF6600 		.string	"\036\377f"
+ 636 0e12 1EFF6600 		.string	"\036\377f"
+ 637 0e16 1EFF6600 		.string	"\036\377f"
+ 638 0e1a 1EFF6600 		.string	"\036\377f"
+ 639 0e1e 1EFF6600 		.string	"\036\377f"
+ 640 0e22 1EFF6600 		.string	"\036\377f"
+ 641 0e26 1EFF6600 		.string	"\036\377f"
+ 642 0e2a 1EFF6600 		.string	"\036\377f"
+ 643 0e2e 1EFF6600 		.string	"\036\377f"
+ 644 0e32 1EFF6600 		.string	"\036\377f"
+ 645 0e36 1EFF6600 		.string	"\036\377f"
+ 646 0e3a 1EFF6600 		.string	"\036\377f"
+ 647 0e3e 1EFF6600 		.string	"\036\377f"
+ 648 0e42 1EFF6600 		.string	"\036\377f"
+ 649 0e46 1EFF6600 		.string	"\036\377f"
+ 650 0e4a 1EFF6600 		.string	"\036\377f"
+ 651 0e4e 1EFF6600 		.string	"\036\377f"
+ 652 0e52 1EFF6600 		.string	"\036\377f"
+ 653 0e56 1EFF6600 		.string	"\036\377f"
+ 654 0e5a 1EFF6600 		.string	"\036\377f"
+ 655 0e5e 1EFF6600 		.string	"\036\377f"
+ 656 0e62 1EFF6600 		.string	"\036\377f"
+ 657 0e66 1EFF6600 		.string	"\036\377f"
+ 658 0e6a 1EFF6600 		.string	"\036\377f"
+ 659 0e6e 1EFF6600 		.string	"\036\377f"
+ 660 0e72 1EFF6600 		.string	"\036\377f"
+ 661 0e76 1EFF6600 		.string	"\036\377f"
+ 662 0e7a 1EFF6600 		.string	"\036\377f"
+ 663 0e7e 1EFF6600 		.string	"\036\377f"
+ 664 0e82 1EFF6600 		.string	"\036\377f"
+ 665 0e86 1EFF6600 		.string	"\036\377f"
+ 666 0e8a 1EFF6600 		.string	"\036\377f"
+ 667 0e8e 1EFF6600 		.string	"\036\377f"
+ 668 0e92 1EFF6600 		.string	"\036\377f"
+ 669 0e96 1EFF6600 		.string	"\036\377f"
+ 670 0e9a 1EFF6600 		.string	"\036\377f"
+ 671 0e9e 1EFF6600 		.string	"\036\377f"
+ 672 0ea2 1EFF6600 		.string	"\036\377f"
+ 673 0ea6 1EFF6600 		.string	"\036\377f"
+ 674 0eaa 1EFF6600 		.string	"\036\377f"
+ 675 0eae 1EFF6600 		.string	"\036\377f"
+ 676 0eb2 1EFF6600 		.string	"\036\377f"
+ 677 0eb6 1EFF6600 		.string	"\036\377f"
+ 678 0eba 1EFF6600 		.string	"\036\377f"
+ 679 0ebe 1EFF6600 		.string	"\036\377f"
+ 680 0ec2 1EFF6600 		.string	"\036\377f"
+GAS LISTING /tmp/ccoNxI3i.s 			page 17
+
+
+ 681 0ec6 1EFF6600 		.string	"\036\377f"
+ 682 0eca 1EFF6600 		.string	"\036\377f"
+ 683 0ece 1EFF6600 		.string	"\036\377f"
+ 684 0ed2 1EFF6600 		.string	"\036\377f"
+ 685 0ed6 1EFF6600 		.string	"\036\377f"
+ 686 0eda 1EFF6600 		.string	"\036\377f"
+ 687 0ede 1EFF6600 		.string	"\036\377f"
+ 688 0ee2 1EFF6600 		.string	"\036\377f"
+ 689 0ee6 1EFF6600 		.string	"\036\377f"
+ 690 0eea 1EFF6600 		.string	"\036\377f"
+ 691 0eee 1EFF6600 		.string	"\036\377f"
+ 692 0ef2 1EFF6600 		.string	"\036\377f"
+ 693 0ef6 1EFF6600 		.string	"\036\377f"
+ 694 0efa 1EFF6600 		.string	"\036\377f"
+ 695 0efe 1EFF6600 		.string	"\036\377f"
+ 696 0f02 1EFF6600 		.string	"\036\377f"
+ 697 0f06 1EFF6600 		.string	"\036\377f"
+ 698 0f0a 1EFF6600 		.string	"\036\377f"
+ 699 0f0e 1EFF6600 		.string	"\036\377f"
+ 700 0f12 1EFF6600 		.string	"\036\377f"
+ 701 0f16 1EFF6600 		.string	"\036\377f"
+ 702 0f1a 1EFF6600 		.string	"\036\377f"
+ 703 0f1e 1EFF6600 		.string	"\036\377f"
+ 704 0f22 1EFF6600 		.string	"\036\377f"
+ 705 0f26 1EFF6600 		.string	"\036\377f"
+ 706 0f2a 1EFF6600 		.string	"\036\377f"
+ 707 0f2e 1EFF6600 		.string	"\036\377f"
+ 708 0f32 1EFF6600 		.string	"\036\377f"
+ 709 0f36 1EFF6600 		.string	"\036\377f"
+ 710 0f3a 1EFF6600 		.string	"\036\377f"
+ 711 0f3e 1EFF6600 		.string	"\036\377f"
+ 712 0f42 1EFF6600 		.string	"\036\377f"
+ 713 0f46 1EFF6600 		.string	"\036\377f"
+ 714 0f4a 1EFF6600 		.string	"\036\377f"
+ 715 0f4e 1EFF6600 		.string	"\036\377f"
+ 716 0f52 1EFF6600 		.string	"\036\377f"
+ 717 0f56 1EFF6600 		.string	"\036\377f"
+ 718 0f5a 1EFF6600 		.string	"\036\377f"
+ 719 0f5e 1EFF6600 		.string	"\036\377f"
+ 720 0f62 1EFF6600 		.string	"\036\377f"
+ 721 0f66 1EFF6600 		.string	"\036\377f"
+ 722 0f6a 1EFF6600 		.string	"\036\377f"
+ 723 0f6e 1EFF6600 		.string	"\036\377f"
+ 724 0f72 1EFF6600 		.string	"\036\377f"
+ 725 0f76 1EFF6600 		.string	"\036\377f"
+ 726 0f7a 1EFF6600 		.string	"\036\377f"
+ 727 0f7e 1EFF6600 		.string	"\036\377f"
+ 728 0f82 1EFF6600 		.string	"\036\377f"
+ 729 0f86 1EFF6600 		.string	"\036\377f"
+ 730 0f8a 1EFF6600 		.string	"\036\377f"
+ 731 0f8e 1EFF6600 		.string	"\036\377f"
+ 732 0f92 1EFF6600 		.string	"\036\377f"
+ 733 0f96 1EFF6600 		.string	"\036\377f"
+ 734 0f9a 1EFF6600 		.string	"\036\377f"
+ 735 0f9e 1EFF     		.ascii	"\036\377"
+ 736 0fa0 6600     		.string	"f"
+ 737 0fa2 1EFF6600 		.string	"\036\377f"
+GAS LISTING /tmp/ccoNxI3i.s 			page 18
+
+
+ 738 0fa6 1EFF6600 		.string	"\036\377f"
+ 739 0faa 1EFF6600 		.string	"\036\377f"
+ 740 0fae 1EFF6600 		.string	"\036\377f"
+ 741 0fb2 1EFF6600 		.string	"\036\377f"
+ 742 0fb6 1EFF6600 		.string	"\036\377f"
+ 743 0fba 1EFF6600 		.string	"\036\377f"
+ 744 0fbe 1EFF6600 		.string	"\036\377f"
+ 745 0fc2 1EFF6600 		.string	"\036\377f"
+ 746 0fc6 1EFF6600 		.string	"\036\377f"
+ 747 0fca 1EFF6600 		.string	"\036\377f"
+ 748 0fce 1EFF6600 		.string	"\036\377f"
+ 749 0fd2 1EFF6600 		.string	"\036\377f"
+ 750 0fd6 1EFF6600 		.string	"\036\377f"
+ 751 0fda 1EFF6600 		.string	"\036\377f"
+ 752 0fde 1EFF6600 		.string	"\036\377f"
+ 753 0fe2 1EFF6600 		.string	"\036\377f"
+ 754 0fe6 1EFF6600 		.string	"\036\377f"
+ 755 0fea 1EFF6600 		.string	"\036\377f"
+ 756 0fee 1EFF6600 		.string	"\036\377f"
+ 757 0ff2 1EFF6600 		.string	"\036\377f"
+ 758 0ff6 1EFF6600 		.string	"\036\377f"
+ 759 0ffa 1EFF6600 		.string	"\036\377f"
+ 760 0ffe 1EFF6600 		.string	"\036\377f"
+ 761 1002 1EFF     		.ascii	"\036\377"
+ 762              		.globl	heatmap_cs_RdBu_mixed
+ 763              		.section	.data.rel.local
+ 764              		.align 8
+ 765              		.type	heatmap_cs_RdBu_mixed, @object
+ 766              		.size	heatmap_cs_RdBu_mixed, 8
+ 767              	heatmap_cs_RdBu_mixed:
+ 768 0008 00000000 		.quad	mixed
+ 768      00000000 
+ 769              		.section	.data.rel.ro.local
+ 770              		.align 16
+ 771              		.type	mixed, @object
+ 772              		.size	mixed, 16
+ 773              	mixed:
+ 774 0010 00000000 		.quad	mixed_data
+ 774      00000000 
+ 775 0018 01040000 		.quad	1025
+ 775      00000000 
+ 776              		.section	.rodata
+ 777 1004 00000000 		.align 32
+ 777      00000000 
+ 777      00000000 
+ 777      00000000 
+ 777      00000000 
+ 778              		.type	mixed_data, @object
+ 779              		.size	mixed_data, 4100
+ 780              	mixed_data:
+ 781 1020 00       		.string	""
+ 782 1021 00       		.string	""
+ 783 1022 00       		.string	""
+ 784 1023 00       		.string	""
+ 785 1024 052F6100 		.string	"\005/a"
+ 786 1028 05306107 		.ascii	"\0050a\007\0050b\016\0051b\026\0051c\035\0061c%\0062d,\0062d"
+ 786      0530620E 
+GAS LISTING /tmp/ccoNxI3i.s 			page 19
+
+
+ 786      05316216 
+ 786      0531631D 
+ 786      06316325 
+ 787 1043 34063365 		.ascii	"4\0063e;\0073fC\0073fJ\0074gR\b4gY\b5ha\b5hh\b5ip\t6iw\t6j\177"
+ 787      3B073366 
+ 787      43073366 
+ 787      4A073467 
+ 787      52083467 
+ 788 106c 09376B86 		.ascii	"\t7k\206\t7k\215\n7l\225\n8l\234\n8m\244\0139m\253\0139n\263"
+ 788      09376B8D 
+ 788      0A376C95 
+ 788      0A386C9C 
+ 788      0A386DA4 
+ 789 1088 0B396FBA 		.ascii	"\0139o\272\013:o\302\f:p\311\f;p\321\f;q\330\f;q\340\r<r\347"
+ 789      0B3A6FC2 
+ 789      0C3A70C9 
+ 789      0C3B70D1 
+ 789      0C3B71D8 
+ 790 10a4 0D3C73EF 		.ascii	"\r<s\357\r=s\366\r=t\376\r>t\377\016>u\377\016>u\377\016?v\377"
+ 790      0D3D73F6 
+ 790      0D3D74FE 
+ 790      0D3E74FF 
+ 790      0E3E75FF 
+ 791 10c0 0E3F77FF 		.ascii	"\016?w\377\017@w\377\017@x\377\017@x\377\017Ay\377\020Az\377"
+ 791      0F4077FF 
+ 791      0F4078FF 
+ 791      0F4078FF 
+ 791      0F4179FF 
+ 792 10d8 10427AFF 		.ascii	"\020Bz\377\020B{\377\020C{\377\020C|\377\021C|\377\021D}\377"
+ 792      10427BFF 
+ 792      10437BFF 
+ 792      10437CFF 
+ 792      11437CFF 
+ 793 10f0 11447EFF 		.ascii	"\021D~\377\027O\215\377\027P\216\377\027P\216\377\030Q\217\377"
+ 793      174F8DFF 
+ 793      17508EFF 
+ 793      17508EFF 
+ 793      18518FFF 
+ 794 1104 185190FF 		.ascii	"\030Q\220\377\030R\220\377\030R\221\377\030R\221\377\031S\222"
+ 794      185290FF 
+ 794      185291FF 
+ 794      185291FF 
+ 794      195392
+ 795 1117 FF195393 		.ascii	"\377\031S\223\377\031T\223\377\031T\224\377\031U\224\377\032"
+ 795      FF195493 
+ 795      FF195494 
+ 795      FF195594 
+ 795      FF1A
+ 796 1129 5595FF1A 		.ascii	"U\225\377\032U\226\377\032V\226\377\032V\227\377\032W\227\377"
+ 796      5596FF1A 
+ 796      5696FF1A 
+ 796      5697FF1A 
+ 796      5797FF
+ 797 113c 1B5798FF 		.ascii	"\033W\230\377\033X\230\377\033X\231\377\033X\232\377\033Y\232"
+ 797      1B5898FF 
+ 797      1B5899FF 
+ 797      1B589AFF 
+GAS LISTING /tmp/ccoNxI3i.s 			page 20
+
+
+ 797      1B599A
+ 798 114f FF1C599B 		.ascii	"\377\034Y\233\377\034Z\233\377\034Z\234\377\034[\235\377\034"
+ 798      FF1C5A9B 
+ 798      FF1C5A9C 
+ 798      FF1C5B9D 
+ 798      FF1C
+ 799 1161 5B9DFF1D 		.ascii	"[\235\377\035\\\236\377\035\\\236\377\035\\\237\377\035]\240"
+ 799      5C9EFF1D 
+ 799      5C9EFF1D 
+ 799      5C9FFF1D 
+ 799      5DA0
+ 800 1173 FF1D5DA0 		.ascii	"\377\035]\240\377\035^\241\377\036^\242\377\036_\242\377\036"
+ 800      FF1D5EA1 
+ 800      FF1E5EA2 
+ 800      FF1E5FA2 
+ 800      FF1E
+ 801 1185 5FA3FF1E 		.ascii	"_\243\377\036`\243\377\036`\244\377\037`\245\377\037a\245\377"
+ 801      60A3FF1E 
+ 801      60A4FF1F 
+ 801      60A5FF1F 
+ 801      61A5FF
+ 802 1198 1F61A6FF 		.ascii	"\037a\246\377\037b\246\377\037b\247\377\037c\250\377 c\250\377"
+ 802      1F62A6FF 
+ 802      1F62A7FF 
+ 802      1F63A8FF 
+ 802      2063A8FF 
+ 803 11ac 2064A9FF 		.ascii	" d\251\377 d\251\377 d\252\377 e\253\377 e\253\377!f\254\377"
+ 803      2064A9FF 
+ 803      2064AAFF 
+ 803      2065ABFF 
+ 803      2065ABFF 
+ 804 11c4 2166ACFF 		.ascii	"!f\254\377!f\254\377!g\254\377!g\254\377!h\255\377!h\255\377"
+ 804      2166ACFF 
+ 804      2167ACFF 
+ 804      2167ACFF 
+ 804      2168ADFF 
+ 805 11dc 2168ADFF 		.ascii	"!h\255\377!i\255\377!i\256\377!i\256\377!j\256\377\"j\256\377"
+ 805      2169ADFF 
+ 805      2169AEFF 
+ 805      2169AEFF 
+ 805      216AAEFF 
+ 806 11f4 226AAEFF 		.ascii	"\"j\256\377\"k\257\377\"k\257\377\"k\257\377\"l\257\377\"l\257"
+ 806      226BAFFF 
+ 806      226BAFFF 
+ 806      226BAFFF 
+ 806      226CAFFF 
+ 807 120b FF226DB0 		.ascii	"\377\"m\260\377#m\260\377#m\260\377#n\260\377#n\260\377#n\261"
+ 807      FF236DB0 
+ 807      FF236DB0 
+ 807      FF236EB0 
+ 807      FF236EB0 
+ 808 1223 FF236FB1 		.ascii	"\377#o\261\377$o\261\377$o\261\377$p\261\377$p\262\377$p\262"
+ 808      FF246FB1 
+ 808      FF246FB1 
+ 808      FF2470B1 
+ 808      FF2470B2 
+ 809 123b FF2571B2 		.ascii	"\377%q\262\377%q\262\377%q\262\377%r\263\377%r\263\377&s\263"
+GAS LISTING /tmp/ccoNxI3i.s 			page 21
+
+
+ 809      FF2571B2 
+ 809      FF2571B2 
+ 809      FF2572B3 
+ 809      FF2572B3 
+ 810 1253 FF2673B3 		.ascii	"\377&s\263\377&s\263\377&t\263\377't\264\377't\264\377'u\264"
+ 810      FF2673B3 
+ 810      FF2674B3 
+ 810      FF2774B4 
+ 810      FF2774B4 
+ 811 126b FF2775B4 		.ascii	"\377'u\264\377(u\264\377(v\265\377(v\265\377(v\265\377)w\265"
+ 811      FF2875B4 
+ 811      FF2876B5 
+ 811      FF2876B5 
+ 811      FF2876B5 
+ 812 1283 FF2977B5 		.ascii	"\377)w\265\377)w\265\3770\201\272\3771\201\272\3771\202\273\377"
+ 812      FF2977B5 
+ 812      FF3081BA 
+ 812      FF3181BA 
+ 812      FF3182BB 
+ 813 1298 3182BBFF 		.ascii	"1\202\273\3772\202\273\3772\203\273\3772\203\273\3773\203\273"
+ 813      3282BBFF 
+ 813      3283BBFF 
+ 813      3283BBFF 
+ 813      3383BB
+ 814 12ab FF3384BC 		.ascii	"\3773\204\274\3773\204\274\3773\204\274\3774\205\274\3774\205"
+ 814      FF3384BC 
+ 814      FF3384BC 
+ 814      FF3485BC 
+ 814      FF3485
+ 815 12be BCFF3485 		.ascii	"\274\3774\205\274\3775\206\275\3775\206\275\3775\206\275\377"
+ 815      BCFF3586 
+ 815      BDFF3586 
+ 815      BDFF3586 
+ 815      BDFF
+ 816 12d0 3687BDFF 		.ascii	"6\207\275\3776\207\275\3776\207\275\3777\210\276\3777\210\276"
+ 816      3687BDFF 
+ 816      3687BDFF 
+ 816      3788BEFF 
+ 816      3788BE
+ 817 12e3 FF3789BE 		.ascii	"\3777\211\276\3778\211\276\3778\211\276\3779\212\276\3779\212"
+ 817      FF3889BE 
+ 817      FF3889BE 
+ 817      FF398ABE 
+ 817      FF398A
+ 818 12f6 BFFF398A 		.ascii	"\277\3779\212\277\377:\213\277\377:\213\277\377:\213\277\377"
+ 818      BFFF3A8B 
+ 818      BFFF3A8B 
+ 818      BFFF3A8B 
+ 818      BFFF
+ 819 1308 3B8CBFFF 		.ascii	";\214\277\377;\214\300\377<\214\300\377<\215\300\377<\215\300"
+ 819      3B8CC0FF 
+ 819      3C8CC0FF 
+ 819      3C8DC0FF 
+ 819      3C8DC0
+ 820 131b FF3D8DC0 		.ascii	"\377=\215\300\377=\216\300\377=\216\301\377>\216\301\377>\217"
+ 820      FF3D8EC0 
+ 820      FF3D8EC1 
+GAS LISTING /tmp/ccoNxI3i.s 			page 22
+
+
+ 820      FF3E8EC1 
+ 820      FF3E8F
+ 821 132e C1FF3F8F 		.ascii	"\301\377?\217\301\377?\217\301\377?\220\301\377@\220\301\377"
+ 821      C1FF3F8F 
+ 821      C1FF3F90 
+ 821      C1FF4090 
+ 821      C1FF
+ 822 1340 4091C2FF 		.ascii	"@\221\302\377A\221\302\377A\221\302\377A\222\302\377B\222\302"
+ 822      4191C2FF 
+ 822      4191C2FF 
+ 822      4192C2FF 
+ 822      4292C2
+ 823 1353 FF4292C2 		.ascii	"\377B\222\302\377C\223\303\377C\223\303\377D\223\303\377E\224"
+ 823      FF4393C3 
+ 823      FF4393C3 
+ 823      FF4493C3 
+ 823      FF4594
+ 824 1366 C3FF4594 		.ascii	"\303\377E\224\303\377F\225\304\377G\225\304\377G\225\304\377"
+ 824      C3FF4695 
+ 824      C4FF4795 
+ 824      C4FF4795 
+ 824      C4FF
+ 825 1378 4896C4FF 		.ascii	"H\226\304\377I\226\304\377I\226\305\377J\227\305\377K\227\305"
+ 825      4996C4FF 
+ 825      4996C5FF 
+ 825      4A97C5FF 
+ 825      4B97C5
+ 826 138b FF4B98C5 		.ascii	"\377K\230\305\377L\230\305\377M\230\306\377M\231\306\377N\231"
+ 826      FF4C98C5 
+ 826      FF4D98C6 
+ 826      FF4D99C6 
+ 826      FF4E99
+ 827 139e C6FF4E9A 		.ascii	"\306\377N\232\306\377O\232\306\377P\232\307\377P\233\307\377"
+ 827      C6FF4F9A 
+ 827      C6FF509A 
+ 827      C7FF509B 
+ 827      C7FF
+ 828 13b0 519BC7FF 		.ascii	"Q\233\307\377R\234\307\377R\234\310\377S\234\310\377T\235\310"
+ 828      529CC7FF 
+ 828      529CC8FF 
+ 828      539CC8FF 
+ 828      549DC8
+ 829 13c3 FF549DC8 		.ascii	"\377T\235\310\377U\236\310\377U\236\311\377V\236\311\377W\237"
+ 829      FF559EC8 
+ 829      FF559EC9 
+ 829      FF569EC9 
+ 829      FF579F
+ 830 13d6 C9FF579F 		.ascii	"\311\377W\237\311\377X\237\311\377Y\240\312\377Y\240\312\377"
+ 830      C9FF589F 
+ 830      C9FF59A0 
+ 830      CAFF59A0 
+ 830      CAFF
+ 831 13e8 5AA1CAFF 		.ascii	"Z\241\312\377Z\241\312\377[\241\312\377\\\242\313\377\\\242\313"
+ 831      5AA1CAFF 
+ 831      5BA1CAFF 
+ 831      5CA2CBFF 
+ 831      5CA2CB
+GAS LISTING /tmp/ccoNxI3i.s 			page 23
+
+
+ 832 13fb FF5DA3CB 		.ascii	"\377]\243\313\377]\243\313\377^\243\313\377_\244\314\377_\244"
+ 832      FF5DA3CB 
+ 832      FF5EA3CB 
+ 832      FF5FA4CC 
+ 832      FF5FA4
+ 833 140e CCFF60A5 		.ascii	"\314\377`\245\314\377`\245\314\377a\245\314\377b\246\315\377"
+ 833      CCFF60A5 
+ 833      CCFF61A5 
+ 833      CCFF62A6 
+ 833      CDFF
+ 834 1420 62A6CDFF 		.ascii	"b\246\315\377s\261\323\377s\261\323\377t\261\323\377u\262\323"
+ 834      73B1D3FF 
+ 834      73B1D3FF 
+ 834      74B1D3FF 
+ 834      75B2D3
+ 835 1433 FF75B2D3 		.ascii	"\377u\262\323\377v\262\324\377v\263\324\377w\263\324\377x\264"
+ 835      FF76B2D4 
+ 835      FF76B3D4 
+ 835      FF77B3D4 
+ 835      FF78B4
+ 836 1446 D4FF78B4 		.ascii	"\324\377x\264\324\377y\264\325\377y\265\325\377z\265\325\377"
+ 836      D4FF79B4 
+ 836      D5FF79B5 
+ 836      D5FF7AB5 
+ 836      D5FF
+ 837 1458 7BB6D5FF 		.ascii	"{\266\325\377{\266\325\377|\266\326\377|\267\326\377}\267\326"
+ 837      7BB6D5FF 
+ 837      7CB6D6FF 
+ 837      7CB7D6FF 
+ 837      7DB7D6
+ 838 146b FF7EB8D6 		.ascii	"\377~\270\326\377~\270\327\377\177\270\327\377\177\271\327\377"
+ 838      FF7EB8D7 
+ 838      FF7FB8D7 
+ 838      FF7FB9D7 
+ 838      FF
+ 839 147c 80B9D7FF 		.ascii	"\200\271\327\377\201\272\327\377\201\272\330\377\202\272\330"
+ 839      81BAD7FF 
+ 839      81BAD8FF 
+ 839      82BAD8
+ 840 148b FF82BBD8 		.ascii	"\377\202\273\330\377\203\273\330\377\204\273\330\377\204\274"
+ 840      FF83BBD8 
+ 840      FF84BBD8 
+ 840      FF84BC
+ 841 149a D9FF85BC 		.ascii	"\331\377\205\274\331\377\205\275\331\377\206\275\331\377\207"
+ 841      D9FF85BD 
+ 841      D9FF86BD 
+ 841      D9FF87
+ 842 14a9 BDDAFF87 		.ascii	"\275\332\377\207\276\332\377\210\276\332\377\210\277\332\377"
+ 842      BEDAFF88 
+ 842      BEDAFF88 
+ 842      BFDAFF
+ 843 14b8 89BFDAFF 		.ascii	"\211\277\332\377\212\277\333\377\212\300\333\377\213\300\333"
+ 843      8ABFDBFF 
+ 843      8AC0DBFF 
+ 843      8BC0DB
+ 844 14c7 FF8BC1DB 		.ascii	"\377\213\301\333\377\214\301\333\377\215\301\334\377\215\302"
+ 844      FF8CC1DB 
+GAS LISTING /tmp/ccoNxI3i.s 			page 24
+
+
+ 844      FF8DC1DC 
+ 844      FF8DC2
+ 845 14d6 DCFF8EC2 		.ascii	"\334\377\216\302\334\377\216\302\334\377\217\303\335\377\220"
+ 845      DCFF8EC2 
+ 845      DCFF8FC3 
+ 845      DDFF90
+ 846 14e5 C3DDFF90 		.ascii	"\303\335\377\220\304\335\377\221\304\335\377\221\304\335\377"
+ 846      C4DDFF91 
+ 846      C4DDFF91 
+ 846      C4DDFF
+ 847 14f4 92C5DEFF 		.ascii	"\222\305\336\377\222\305\336\377\223\305\336\377\223\305\336"
+ 847      92C5DEFF 
+ 847      93C5DEFF 
+ 847      93C5DE
+ 848 1503 FF94C6DE 		.ascii	"\377\224\306\336\377\225\306\336\377\225\306\336\377\226\306"
+ 848      FF95C6DE 
+ 848      FF95C6DE 
+ 848      FF96C6
+ 849 1512 DFFF96C7 		.ascii	"\337\377\226\307\337\377\227\307\337\377\227\307\337\377\230"
+ 849      DFFF97C7 
+ 849      DFFF97C7 
+ 849      DFFF98
+ 850 1521 C7DFFF98 		.ascii	"\307\337\377\230\310\337\377\231\310\337\377\231\310\340\377"
+ 850      C8DFFF99 
+ 850      C8DFFF99 
+ 850      C8E0FF
+ 851 1530 9AC8E0FF 		.ascii	"\232\310\340\377\232\311\340\377\233\311\340\377\233\311\340"
+ 851      9AC9E0FF 
+ 851      9BC9E0FF 
+ 851      9BC9E0
+ 852 153f FF9CC9E0 		.ascii	"\377\234\311\340\377\234\312\340\377\235\312\341\377\235\312"
+ 852      FF9CCAE0 
+ 852      FF9DCAE1 
+ 852      FF9DCA
+ 853 154e E1FF9ECA 		.ascii	"\341\377\236\312\341\377\236\313\341\377\237\313\341\377\237"
+ 853      E1FF9ECB 
+ 853      E1FF9FCB 
+ 853      E1FF9F
+ 854 155d CBE1FFA0 		.ascii	"\313\341\377\240\313\341\377\240\314\342\377\241\314\342\377"
+ 854      CBE1FFA0 
+ 854      CCE2FFA1 
+ 854      CCE2FF
+ 855 156c A1CCE2FF 		.ascii	"\241\314\342\377\242\314\342\377\242\315\342\377\243\315\342"
+ 855      A2CCE2FF 
+ 855      A2CDE2FF 
+ 855      A3CDE2
+ 856 157b FFA3CDE2 		.ascii	"\377\243\315\342\377\244\315\343\377\244\316\343\377\245\316"
+ 856      FFA4CDE3 
+ 856      FFA4CEE3 
+ 856      FFA5CE
+ 857 158a E3FFA5CE 		.ascii	"\343\377\245\316\343\377\246\316\343\377\246\317\343\377\247"
+ 857      E3FFA6CE 
+ 857      E3FFA6CF 
+ 857      E3FFA7
+ 858 1599 CFE3FFA7 		.ascii	"\317\343\377\247\317\344\377\250\317\344\377\250\320\344\377"
+ 858      CFE4FFA8 
+ 858      CFE4FFA8 
+GAS LISTING /tmp/ccoNxI3i.s 			page 25
+
+
+ 858      D0E4FF
+ 859 15a8 A9D0E4FF 		.ascii	"\251\320\344\377\251\320\344\377\252\320\344\377\252\321\344"
+ 859      A9D0E4FF 
+ 859      AAD0E4FF 
+ 859      AAD1E4
+ 860 15b7 FFABD1E5 		.ascii	"\377\253\321\345\377\253\321\345\377\270\330\350\377\271\330"
+ 860      FFABD1E5 
+ 860      FFB8D8E8 
+ 860      FFB9D8
+ 861 15c6 E9FFB9D8 		.ascii	"\351\377\271\330\351\377\272\331\351\377\272\331\351\377\273"
+ 861      E9FFBAD9 
+ 861      E9FFBAD9 
+ 861      E9FFBB
+ 862 15d5 D9E9FFBB 		.ascii	"\331\351\377\273\331\351\377\274\332\351\377\274\332\352\377"
+ 862      D9E9FFBC 
+ 862      DAE9FFBC 
+ 862      DAEAFF
+ 863 15e4 BDDAEAFF 		.ascii	"\275\332\352\377\275\332\352\377\276\333\352\377\276\333\352"
+ 863      BDDAEAFF 
+ 863      BEDBEAFF 
+ 863      BEDBEA
+ 864 15f3 FFBFDBEA 		.ascii	"\377\277\333\352\377\277\333\352\377\277\334\353\377\300\334"
+ 864      FFBFDBEA 
+ 864      FFBFDCEB 
+ 864      FFC0DC
+ 865 1602 EBFFC0DC 		.ascii	"\353\377\300\334\353\377\301\334\353\377\301\335\353\377\302"
+ 865      EBFFC1DC 
+ 865      EBFFC1DD 
+ 865      EBFFC2
+ 866 1611 DDEBFFC2 		.ascii	"\335\353\377\302\335\353\377\303\335\353\377\303\336\354\377"
+ 866      DDEBFFC3 
+ 866      DDEBFFC3 
+ 866      DEECFF
+ 867 1620 C4DEECFF 		.ascii	"\304\336\354\377\304\336\354\377\305\336\354\377\305\337\354"
+ 867      C4DEECFF 
+ 867      C5DEECFF 
+ 867      C5DFEC
+ 868 162f FFC6DFEC 		.ascii	"\377\306\337\354\377\306\337\354\377\307\337\355\377\307\340"
+ 868      FFC6DFEC 
+ 868      FFC7DFED 
+ 868      FFC7E0
+ 869 163e EDFFC8E0 		.ascii	"\355\377\310\340\355\377\310\340\355\377\311\340\355\377\311"
+ 869      EDFFC8E0 
+ 869      EDFFC9E0 
+ 869      EDFFC9
+ 870 164d E1EDFFCA 		.ascii	"\341\355\377\312\341\355\377\312\341\356\377\313\341\356\377"
+ 870      E1EDFFCA 
+ 870      E1EEFFCB 
+ 870      E1EEFF
+ 871 165c CBE2EEFF 		.ascii	"\313\342\356\377\313\342\356\377\314\342\356\377\314\342\356"
+ 871      CBE2EEFF 
+ 871      CCE2EEFF 
+ 871      CCE2EE
+ 872 166b FFCDE3EE 		.ascii	"\377\315\343\356\377\315\343\357\377\316\343\357\377\316\343"
+ 872      FFCDE3EF 
+ 872      FFCEE3EF 
+ 872      FFCEE3
+GAS LISTING /tmp/ccoNxI3i.s 			page 26
+
+
+ 873 167a EFFFCFE4 		.ascii	"\357\377\317\344\357\377\317\344\357\377\320\344\357\377\320"
+ 873      EFFFCFE4 
+ 873      EFFFD0E4 
+ 873      EFFFD0
+ 874 1689 E4EFFFEC 		.ascii	"\344\357\377\354\336\345\377\354\336\345\377\354\336\345\377"
+ 874      DEE5FFEC 
+ 874      DEE5FFEC 
+ 874      DEE5FF
+ 875 1698 EBDEE6FF 		.ascii	"\353\336\346\377\353\336\346\377\353\337\347\377\353\337\347"
+ 875      EBDEE6FF 
+ 875      EBDFE7FF 
+ 875      EBDFE7
+ 876 16a7 FFEBDFE7 		.ascii	"\377\353\337\347\377\353\337\350\377\353\340\350\377\353\340"
+ 876      FFEBDFE8 
+ 876      FFEBE0E8 
+ 876      FFEBE0
+ 877 16b6 E9FFEBE0 		.ascii	"\351\377\353\340\351\377\352\340\351\377\352\341\352\377\352"
+ 877      E9FFEAE0 
+ 877      E9FFEAE1 
+ 877      EAFFEA
+ 878 16c5 E1EAFFEA 		.ascii	"\341\352\377\352\341\352\377\352\341\353\377\352\342\353\377"
+ 878      E1EAFFEA 
+ 878      E1EBFFEA 
+ 878      E2EBFF
+ 879 16d4 EAE2EBFF 		.ascii	"\352\342\353\377\352\342\354\377\352\342\354\377\351\342\354"
+ 879      EAE2ECFF 
+ 879      EAE2ECFF 
+ 879      E9E2EC
+ 880 16e3 FFE9E3ED 		.ascii	"\377\351\343\355\377\351\343\355\377\351\343\355\377\351\343"
+ 880      FFE9E3ED 
+ 880      FFE9E3ED 
+ 880      FFE9E3
+ 881 16f2 EDFFE9E4 		.ascii	"\355\377\351\344\356\377\351\344\356\377\351\344\356\377\351"
+ 881      EEFFE9E4 
+ 881      EEFFE9E4 
+ 881      EEFFE9
+ 882 1701 E4EFFFE8 		.ascii	"\344\357\377\350\345\357\377\350\345\357\377\350\345\357\377"
+ 882      E5EFFFE8 
+ 882      E5EFFFE8 
+ 882      E5EFFF
+ 883 1710 E8E5EFFF 		.ascii	"\350\345\357\377\350\346\360\377\350\346\360\377\350\346\360"
+ 883      E8E6F0FF 
+ 883      E8E6F0FF 
+ 883      E8E6F0
+ 884 171f FFE8E6F0 		.ascii	"\377\350\346\360\377\350\347\360\377\350\347\361\377\350\347"
+ 884      FFE8E7F0 
+ 884      FFE8E7F1 
+ 884      FFE8E7
+ 885 172e F1FFE8E7 		.ascii	"\361\377\350\347\361\377\347\350\361\377\347\350\361\377\347"
+ 885      F1FFE7E8 
+ 885      F1FFE7E8 
+ 885      F1FFE7
+ 886 173d E8F2FFE7 		.ascii	"\350\362\377\347\350\362\377\347\350\362\377\347\351\362\377"
+ 886      E8F2FFE7 
+ 886      E8F2FFE7 
+ 886      E9F2FF
+ 887 174c E7E9F2FF 		.ascii	"\347\351\362\377\347\351\362\377\347\351\362\377\357\355\364"
+GAS LISTING /tmp/ccoNxI3i.s 			page 27
+
+
+ 887      E7E9F2FF 
+ 887      E7E9F2FF 
+ 887      EFEDF4
+ 888 175b FFEFEDF4 		.ascii	"\377\357\355\364\377\357\356\364\377\357\356\364\377\357\356"
+ 888      FFEFEEF4 
+ 888      FFEFEEF4 
+ 888      FFEFEE
+ 889 176a F4FFEFEE 		.ascii	"\364\377\357\356\364\377\357\356\364\377\357\357\365\377\357"
+ 889      F4FFEFEE 
+ 889      F4FFEFEF 
+ 889      F5FFEF
+ 890 1779 EFF5FFEF 		.ascii	"\357\365\377\357\357\365\377\357\357\365\377\357\360\365\377"
+ 890      EFF5FFEF 
+ 890      EFF5FFEF 
+ 890      F0F5FF
+ 891 1788 EFF0F5FF 		.ascii	"\357\360\365\377\357\360\365\377\357\360\365\377\357\360\365"
+ 891      EFF0F5FF 
+ 891      EFF0F5FF 
+ 891      EFF0F5
+ 892 1797 FFEFF1F5 		.ascii	"\377\357\361\365\377\360\361\365\377\360\361\365\377\360\361"
+ 892      FFF0F1F5 
+ 892      FFF0F1F5 
+ 892      FFF0F1
+ 893 17a6 F5FFF0F1 		.ascii	"\365\377\360\361\365\377\360\362\365\377\360\362\365\377\360"
+ 893      F5FFF0F2 
+ 893      F5FFF0F2 
+ 893      F5FFF0
+ 894 17b5 F2F6FFF0 		.ascii	"\362\366\377\360\362\366\377\361\362\366\377\361\362\366\377"
+ 894      F2F6FFF1 
+ 894      F2F6FFF1 
+ 894      F2F6FF
+ 895 17c4 F1F3F6FF 		.ascii	"\361\363\366\377\361\363\366\377\361\363\366\377\361\363\366"
+ 895      F1F3F6FF 
+ 895      F1F3F6FF 
+ 895      F1F3F6
+ 896 17d3 FFF2F3F6 		.ascii	"\377\362\363\366\377\362\364\366\377\362\364\366\377\362\364"
+ 896      FFF2F4F6 
+ 896      FFF2F4F6 
+ 896      FFF2F4
+ 897 17e2 F6FFF2F4 		.ascii	"\366\377\362\364\366\377\363\364\366\377\363\364\366\377"
+ 897      F6FFF3F4 
+ 897      F6FFF3F4 
+ 897      F6FF
+ 898 17f0 F3F5F6FF 		.ascii	"\363\365\366\377\363\365\366\377\364\365\366\377\364\365\366"
+ 898      F3F5F6FF 
+ 898      F4F5F6FF 
+ 898      F4F5F6
+ 899 17ff FFF4F5F6 		.ascii	"\377\364\365\366\377\364\365\366\377\365\365\366\377\365\366"
+ 899      FFF4F5F6 
+ 899      FFF5F5F6 
+ 899      FFF5F6
+ 900 180e F6FFF5F6 		.ascii	"\366\377\365\366\366\377\365\366\366\377\366\366\366\377\366"
+ 900      F6FFF5F6 
+ 900      F6FFF6F6 
+ 900      F6FFF6
+ 901 181d F6F6FFF6 		.ascii	"\366\366\377\366\366\366\377\366\367\367\377\367\366\366\377"
+ 901      F6F6FFF6 
+GAS LISTING /tmp/ccoNxI3i.s 			page 28
+
+
+ 901      F7F7FFF7 
+ 901      F6F6FF
+ 902 182c F7F6F6FF 		.ascii	"\367\366\366\377\367\366\366\377\367\365\366\377\367\365\366"
+ 902      F7F6F6FF 
+ 902      F7F5F6FF 
+ 902      F7F5F6
+ 903 183b FFF7F5F5 		.ascii	"\377\367\365\365\377\367\365\365\377\367\364\365\377\367\364"
+ 903      FFF7F5F5 
+ 903      FFF7F4F5 
+ 903      FFF7F4
+ 904 184a F5FFF8F4 		.ascii	"\365\377\370\364\365\377\370\364\364\377\370\363\364\377\370"
+ 904      F5FFF8F4 
+ 904      F4FFF8F3 
+ 904      F4FFF8
+ 905 1859 F3F4FFF8 		.ascii	"\363\364\377\370\363\364\377\370\363\363\377\370\362\363\377"
+ 905      F3F4FFF8 
+ 905      F3F3FFF8 
+ 905      F2F3FF
+ 906 1868 F8F2F3FF 		.ascii	"\370\362\363\377\371\362\363\377\371\362\362\377\371\361\362"
+ 906      F9F2F3FF 
+ 906      F9F2F2FF 
+ 906      F9F1F2
+ 907 1877 FFF9F1F2 		.ascii	"\377\371\361\362\377\371\361\362\377\371\361\361\377\371\360"
+ 907      FFF9F1F2 
+ 907      FFF9F1F1 
+ 907      FFF9F0
+ 908 1886 F1FFF9F0 		.ascii	"\361\377\371\360\361\377\371\360\361\377\372\360\360\377\372"
+ 908      F1FFF9F0 
+ 908      F1FFFAF0 
+ 908      F0FFFA
+ 909 1895 F0F0FFFA 		.ascii	"\360\360\377\372\357\360\377\372\357\357\377\372\357\357\377"
+ 909      EFF0FFFA 
+ 909      EFEFFFFA 
+ 909      EFEFFF
+ 910 18a4 FAEFEFFF 		.ascii	"\372\357\357\377\372\356\356\377\372\356\356\377\373\356\356"
+ 910      FAEEEEFF 
+ 910      FAEEEEFF 
+ 910      FBEEEE
+ 911 18b3 FFFBEEED 		.ascii	"\377\373\356\355\377\373\355\355\377\373\355\355\377\373\355"
+ 911      FFFBEDED 
+ 911      FFFBEDED 
+ 911      FFFBED
+ 912 18c2 ECFFFBED 		.ascii	"\354\377\373\355\354\377\373\354\354\377\373\354\353\377\373"
+ 912      ECFFFBEC 
+ 912      ECFFFBEC 
+ 912      EBFFFB
+ 913 18d1 ECEBFFFB 		.ascii	"\354\353\377\373\354\353\377\374\353\352\377\374\353\352\377"
+ 913      ECEBFFFC 
+ 913      EBEAFFFC 
+ 913      EBEAFF
+ 914 18e0 FCEBEAFF 		.ascii	"\374\353\352\377\374\353\351\377\374\352\351\377\374\352\350"
+ 914      FCEBE9FF 
+ 914      FCEAE9FF 
+ 914      FCEAE8
+ 915 18ef FFFCEAE8 		.ascii	"\377\374\352\350\377\375\344\336\377\375\344\336\377\375\344"
+ 915      FFFDE4DE 
+ 915      FFFDE4DE 
+GAS LISTING /tmp/ccoNxI3i.s 			page 29
+
+
+ 915      FFFDE4
+ 916 18fe DDFFFEE3 		.ascii	"\335\377\376\343\335\377\376\343\334\377\376\343\334\377\376"
+ 916      DDFFFEE3 
+ 916      DCFFFEE3 
+ 916      DCFFFE
+ 917 190d E3DCFFFE 		.ascii	"\343\334\377\376\343\333\377\376\342\333\377\376\342\332\377"
+ 917      E3DBFFFE 
+ 917      E2DBFFFE 
+ 917      E2DAFF
+ 918 191c FEE2DAFF 		.ascii	"\376\342\332\377\376\342\331\377\376\342\331\377\376\341\331"
+ 918      FEE2D9FF 
+ 918      FEE2D9FF 
+ 918      FEE1D9
+ 919 192b FFFEE1D8 		.ascii	"\377\376\341\330\377\376\341\330\377\376\341\327\377\376\340"
+ 919      FFFEE1D8 
+ 919      FFFEE1D7 
+ 919      FFFEE0
+ 920 193a D7FFFEE0 		.ascii	"\327\377\376\340\326\377\376\340\326\377\376\340\325\377\376"
+ 920      D6FFFEE0 
+ 920      D6FFFEE0 
+ 920      D5FFFE
+ 921 1949 E0D5FFFE 		.ascii	"\340\325\377\376\337\324\377\376\337\324\377\376\337\323\377"
+ 921      DFD4FFFE 
+ 921      DFD4FFFE 
+ 921      DFD3FF
+ 922 1958 FEDFD3FF 		.ascii	"\376\337\323\377\376\337\323\377\376\336\322\377\376\336\322"
+ 922      FEDFD3FF 
+ 922      FEDED2FF 
+ 922      FEDED2
+ 923 1967 FFFEDED1 		.ascii	"\377\376\336\321\377\376\336\321\377\376\336\320\377\376\336"
+ 923      FFFEDED1 
+ 923      FFFEDED0 
+ 923      FFFEDE
+ 924 1976 D0FFFEDD 		.ascii	"\320\377\376\335\317\377\376\335\317\377\376\335\316\377\376"
+ 924      CFFFFEDD 
+ 924      CFFFFEDD 
+ 924      CEFFFE
+ 925 1985 DDCEFFFE 		.ascii	"\335\316\377\376\335\315\377\376\334\315\377\376\334\314\377"
+ 925      DDCDFFFE 
+ 925      DCCDFFFE 
+ 925      DCCCFF
+ 926 1994 FEDCCCFF 		.ascii	"\376\334\314\377\376\334\313\377\375\334\313\377\375\334\312"
+ 926      FEDCCBFF 
+ 926      FDDCCBFF 
+ 926      FDDCCA
+ 927 19a3 FFFDDBCA 		.ascii	"\377\375\333\312\377\375\333\311\377\375\333\311\377\375\333"
+ 927      FFFDDBC9 
+ 927      FFFDDBC9 
+ 927      FFFDDB
+ 928 19b2 C8FFFDDB 		.ascii	"\310\377\375\333\310\377\375\333\307\377\375\333\307\377\374"
+ 928      C8FFFDDB 
+ 928      C7FFFDDB 
+ 928      C7FFFC
+ 929 19c1 DAC6FFFC 		.ascii	"\332\306\377\374\332\306\377\374\331\305\377\374\331\304\377"
+ 929      DAC6FFFC 
+ 929      D9C5FFFC 
+ 929      D9C4FF
+GAS LISTING /tmp/ccoNxI3i.s 			page 30
+
+
+ 930 19d0 FCD9C4FF 		.ascii	"\374\331\304\377\374\330\303\377\374\330\303\377\374\327\302"
+ 930      FCD8C3FF 
+ 930      FCD8C3FF 
+ 930      FCD7C2
+ 931 19df FFFCD7C1 		.ascii	"\377\374\327\301\377\374\327\301\377\374\326\300\377\374\326"
+ 931      FFFCD7C1 
+ 931      FFFCD6C0 
+ 931      FFFCD6
+ 932 19ee C0FFFCD5 		.ascii	"\300\377\374\325\277\377\374\325\277\377\374\324\276\377\374"
+ 932      BFFFFCD5 
+ 932      BFFFFCD4 
+ 932      BEFFFC
+ 933 19fd D4BDFFFC 		.ascii	"\324\275\377\374\324\275\377\373\323\274\377\373\323\274\377"
+ 933      D4BDFFFB 
+ 933      D3BCFFFB 
+ 933      D3BCFF
+ 934 1a0c FBD2BBFF 		.ascii	"\373\322\273\377\373\322\273\377\373\322\272\377\373\321\271"
+ 934      FBD2BBFF 
+ 934      FBD2BAFF 
+ 934      FBD1B9
+ 935 1a1b FFFBD1B9 		.ascii	"\377\373\321\271\377\373\320\270\377\373\320\270\377\373\317"
+ 935      FFFBD0B8 
+ 935      FFFBD0B8 
+ 935      FFFBCF
+ 936 1a2a B7FFFBCF 		.ascii	"\267\377\373\317\267\377\373\317\266\377\373\316\266\377\373"
+ 936      B7FFFBCF 
+ 936      B6FFFBCE 
+ 936      B6FFFB
+ 937 1a39 CEB5FFFB 		.ascii	"\316\265\377\373\315\264\377\373\315\264\377\372\315\263\377"
+ 937      CDB4FFFB 
+ 937      CDB4FFFA 
+ 937      CDB3FF
+ 938 1a48 FACCB3FF 		.ascii	"\372\314\263\377\372\314\262\377\372\313\262\377\372\313\261"
+ 938      FACCB2FF 
+ 938      FACBB2FF 
+ 938      FACBB1
+ 939 1a57 FFFACAB1 		.ascii	"\377\372\312\261\377\372\312\260\377\372\312\257\377\372\311"
+ 939      FFFACAB0 
+ 939      FFFACAAF 
+ 939      FFFAC9
+ 940 1a66 AFFFFAC9 		.ascii	"\257\377\372\311\256\377\372\310\256\377\372\310\255\377\372"
+ 940      AEFFFAC8 
+ 940      AEFFFAC8 
+ 940      ADFFFA
+ 941 1a75 C8ADFFFA 		.ascii	"\310\255\377\372\307\254\377\372\307\254\377\371\306\253\377"
+ 941      C7ACFFFA 
+ 941      C7ACFFF9 
+ 941      C6ABFF
+ 942 1a84 F9C6ABFF 		.ascii	"\371\306\253\377\371\305\252\377\367\272\234\377\367\272\233"
+ 942      F9C5AAFF 
+ 942      F7BA9CFF 
+ 942      F7BA9B
+ 943 1a93 FFF7B99B 		.ascii	"\377\367\271\233\377\367\271\232\377\367\271\232\377\367\270"
+ 943      FFF7B99A 
+ 943      FFF7B99A 
+ 943      FFF7B8
+ 944 1aa2 99FFF7B8 		.ascii	"\231\377\367\270\230\377\367\267\230\377\367\267\227\377\367"
+GAS LISTING /tmp/ccoNxI3i.s 			page 31
+
+
+ 944      98FFF7B7 
+ 944      98FFF7B7 
+ 944      97FFF7
+ 945 1ab1 B697FFF7 		.ascii	"\266\227\377\367\266\226\377\367\266\226\377\367\265\225\377"
+ 945      B696FFF7 
+ 945      B696FFF7 
+ 945      B595FF
+ 946 1ac0 F7B595FF 		.ascii	"\367\265\225\377\366\264\224\377\366\264\224\377\366\263\223"
+ 946      F6B494FF 
+ 946      F6B494FF 
+ 946      F6B393
+ 947 1acf FFF6B393 		.ascii	"\377\366\263\223\377\366\263\222\377\366\262\222\377\366\262"
+ 947      FFF6B392 
+ 947      FFF6B292 
+ 947      FFF6B2
+ 948 1ade 91FFF6B1 		.ascii	"\221\377\366\261\221\377\366\261\220\377\366\260\220\377\366"
+ 948      91FFF6B1 
+ 948      90FFF6B0 
+ 948      90FFF6
+ 949 1aed B08FFFF6 		.ascii	"\260\217\377\366\260\216\377\366\257\216\377\365\257\215\377"
+ 949      B08EFFF6 
+ 949      AF8EFFF5 
+ 949      AF8DFF
+ 950 1afc F5AE8DFF 		.ascii	"\365\256\215\377\365\256\214\377\365\255\214\377\365\255\213"
+ 950      F5AE8CFF 
+ 950      F5AD8CFF 
+ 950      F5AD8B
+ 951 1b0b FFF5AD8B 		.ascii	"\377\365\255\213\377\365\254\212\377\365\254\212\377\365\253"
+ 951      FFF5AC8A 
+ 951      FFF5AC8A 
+ 951      FFF5AB
+ 952 1b1a 89FFF5AB 		.ascii	"\211\377\365\253\211\377\365\252\210\377\365\252\210\377\364"
+ 952      89FFF5AA 
+ 952      88FFF5AA 
+ 952      88FFF4
+ 953 1b29 AA87FFF4 		.ascii	"\252\207\377\364\251\207\377\364\251\206\377\364\250\206\377"
+ 953      A987FFF4 
+ 953      A986FFF4 
+ 953      A886FF
+ 954 1b38 F4A885FF 		.ascii	"\364\250\205\377\364\247\205\377\364\247\204\377\364\247\204"
+ 954      F4A785FF 
+ 954      F4A784FF 
+ 954      F4A784
+ 955 1b47 FFF4A683 		.ascii	"\377\364\246\203\377\364\246\203\377\364\245\202\377\364\245"
+ 955      FFF4A683 
+ 955      FFF4A582 
+ 955      FFF4A5
+ 956 1b56 82FFF3A4 		.ascii	"\202\377\363\244\201\377\363\244\201\377\363\243\200\377\363"
+ 956      81FFF3A4 
+ 956      81FFF3A3 
+ 956      80FFF3
+ 957 1b65 A380FFF3 		.ascii	"\243\200\377\363\242\177\377\362\242\177\377\362\241\177\377"
+ 957      A27FFFF2 
+ 957      A27FFFF2 
+ 957      A17FFF
+ 958 1b74 F2A17EFF 		.ascii	"\362\241~\377\362\240~\377\361\240}\377\361\237}\377\361\237"
+ 958      F2A07EFF 
+GAS LISTING /tmp/ccoNxI3i.s 			page 32
+
+
+ 958      F1A07DFF 
+ 958      F19F7DFF 
+ 958      F19F
+ 959 1b86 7CFFF19E 		.ascii	"|\377\361\236|\377\361\236{\377\360\235{\377\360\235z\377\360"
+ 959      7CFFF19E 
+ 959      7BFFF09D 
+ 959      7BFFF09D 
+ 959      7AFFF0
+ 960 1b99 9C7AFFF0 		.ascii	"\234z\377\360\234y\377\357\233y\377\357\233x\377\357\232x\377"
+ 960      9C79FFEF 
+ 960      9B79FFEF 
+ 960      9B78FFEF 
+ 960      9A78FF
+ 961 1bac EF9978FF 		.ascii	"\357\231x\377\357\231w\377\356\230w\377\356\230v\377\356\227"
+ 961      EF9977FF 
+ 961      EE9877FF 
+ 961      EE9876FF 
+ 961      EE97
+ 962 1bbe 76FFEE97 		.ascii	"v\377\356\227u\377\355\226u\377\355\226t\377\355\225t\377\355"
+ 962      75FFED96 
+ 962      75FFED96 
+ 962      74FFED95 
+ 962      74FFED
+ 963 1bd1 9573FFEC 		.ascii	"\225s\377\354\224s\377\354\224s\377\354\223r\377\354\223r\377"
+ 963      9473FFEC 
+ 963      9473FFEC 
+ 963      9372FFEC 
+ 963      9372FF
+ 964 1be4 EC9271FF 		.ascii	"\354\222q\377\353\222q\377\353\221p\377\353\221p\377\353\220"
+ 964      EB9271FF 
+ 964      EB9170FF 
+ 964      EB9170FF 
+ 964      EB90
+ 965 1bf6 70FFEA8F 		.ascii	"p\377\352\217o\377\352\217o\377\352\216n\377\352\216n\377\351"
+ 965      6FFFEA8F 
+ 965      6FFFEA8E 
+ 965      6EFFEA8E 
+ 965      6EFFE9
+ 966 1c09 8D6DFFE9 		.ascii	"\215m\377\351\215m\377\351\214m\377\351\214l\377\351\213l\377"
+ 966      8D6DFFE9 
+ 966      8C6DFFE9 
+ 966      8C6CFFE9 
+ 966      8B6CFF
+ 967 1c1c E88B6BFF 		.ascii	"\350\213k\377\350\212k\377\342|`\377\342{_\377\341{_\377\341"
+ 967      E88A6BFF 
+ 967      E27C60FF 
+ 967      E27B5FFF 
+ 967      E17B5FFF 
+ 968 1c31 7A5FFFE1 		.ascii	"z_\377\341z^\377\341y^\377\340y]\377\340x]\377\340x]\377\340"
+ 968      7A5EFFE1 
+ 968      795EFFE0 
+ 968      795DFFE0 
+ 968      785DFFE0 
+ 969 1c49 775CFFE0 		.ascii	"w\\\377\340v\\\377\337v[\377\337u[\377\337u[\377\337tZ\377\336"
+ 969      765CFFDF 
+ 969      765BFFDF 
+ 969      755BFFDF 
+GAS LISTING /tmp/ccoNxI3i.s 			page 33
+
+
+ 969      755BFFDF 
+ 970 1c61 745AFFDE 		.ascii	"tZ\377\336sY\377\336sY\377\336rY\377\335rX\377\335qX\377\335"
+ 970      7359FFDE 
+ 970      7359FFDE 
+ 970      7259FFDD 
+ 970      7258FFDD 
+ 971 1c79 7057FFDD 		.ascii	"pW\377\335pW\377\334oW\377\334oV\377\334nV\377\334nV\377\333"
+ 971      7057FFDC 
+ 971      6F57FFDC 
+ 971      6F56FFDC 
+ 971      6E56FFDC 
+ 972 1c91 6D55FFDB 		.ascii	"mU\377\333mU\377\333lT\377\333kT\377\332kT\377\332jS\377\332"
+ 972      6D55FFDB 
+ 972      6C54FFDB 
+ 972      6B54FFDA 
+ 972      6B54FFDA 
+ 973 1ca9 6A53FFDA 		.ascii	"jS\377\332iS\377\332iR\377\331hR\377\331hQ\377\331gQ\377\331"
+ 973      6953FFDA 
+ 973      6952FFD9 
+ 973      6852FFD9 
+ 973      6851FFD9 
+ 974 1cc1 6651FFD8 		.ascii	"fQ\377\330fP\377\330eP\377\330eP\377\330dO\377\327dO\377\327"
+ 974      6650FFD8 
+ 974      6550FFD8 
+ 974      6550FFD8 
+ 974      644FFFD7 
+ 975 1cd9 634FFFD7 		.ascii	"cO\377\327bN\377\327bN\377\326aN\377\326aM\377\326`M\377\326"
+ 975      624EFFD7 
+ 975      624EFFD6 
+ 975      614EFFD6 
+ 975      614DFFD6 
+ 976 1cf1 604DFFD5 		.ascii	"`M\377\325_L\377\325_L\377\325^L\377\324^K\377\324]K\377\324"
+ 976      5F4CFFD5 
+ 976      5F4CFFD5 
+ 976      5E4CFFD4 
+ 976      5E4BFFD4 
+ 977 1d09 5D4BFFD4 		.ascii	"]K\377\324\\J\377\323\\J\377\323[J\377\323[J\377\323[I\377\322"
+ 977      5C4AFFD3 
+ 977      5C4AFFD3 
+ 977      5B4AFFD3 
+ 977      5B4AFFD3 
+ 978 1d21 5A49FFD2 		.ascii	"ZI\377\322ZI\377\322YH\377\321YH\377\321XH\377\321XH\377\321"
+ 978      5A49FFD2 
+ 978      5948FFD1 
+ 978      5948FFD1 
+ 978      5848FFD1 
+ 979 1d39 5747FFD0 		.ascii	"WG\377\320WG\377\320VG\377\320VF\377\320UF\377\317UF\377\317"
+ 979      5747FFD0 
+ 979      5647FFD0 
+ 979      5646FFD0 
+ 979      5546FFCF 
+ 980 1d51 5446FFCF 		.ascii	"TF\377\317TE\377\316SE\377\316SE\377\316RD\377\316RD\377\315"
+ 980      5445FFCE 
+ 980      5345FFCE 
+ 980      5345FFCE 
+ 980      5244FFCE 
+ 981 1d69 5144FFCD 		.ascii	"QD\377\315QD\377\315QC\377\314PC\377\314PC\377\314OB\377\314"
+GAS LISTING /tmp/ccoNxI3i.s 			page 34
+
+
+ 981      5144FFCD 
+ 981      5143FFCC 
+ 981      5043FFCC 
+ 981      5043FFCC 
+ 982 1d81 4F42FFCB 		.ascii	"OB\377\313NB\377\313NB\377\313MA\377\313MA\377\312LA\377\312"
+ 982      4E42FFCB 
+ 982      4E42FFCB 
+ 982      4D41FFCB 
+ 982      4D41FFCA 
+ 983 1d99 4C40FFCA 		.ascii	"L@\377\312K@\377\311K@\377\311J@\377\311J?\377\311I?\377\310"
+ 983      4B40FFC9 
+ 983      4B40FFC9 
+ 983      4A40FFC9 
+ 983      4A3FFFC9 
+ 984 1db1 493FFFC8 		.ascii	"I?\377\310H?\377\310H>\377\307G>\377\30087\377\30087\377\277"
+ 984      483FFFC8 
+ 984      483EFFC7 
+ 984      473EFFC0 
+ 984      3837FFC0 
+ 985 1dc9 3736FFBF 		.ascii	"76\377\27766\377\27766\377\27756\377\27655\377\27645\377\276"
+ 985      3636FFBF 
+ 985      3636FFBF 
+ 985      3536FFBE 
+ 985      3535FFBE 
+ 986 1de1 3435FFBD 		.ascii	"45\377\27535\377\27534\377\27524\377\27524\377\27414\377\274"
+ 986      3335FFBD 
+ 986      3334FFBD 
+ 986      3234FFBD 
+ 986      3234FFBC 
+ 987 1df9 3133FFBC 		.ascii	"13\377\27403\377\273/3\377\273/3\377\273.2\377\273.2\377\272"
+ 987      3033FFBB 
+ 987      2F33FFBB 
+ 987      2F33FFBB 
+ 987      2E32FFBB 
+ 988 1e11 2D32FFBA 		.ascii	"-2\377\272-2\377\272,1\377\271+1\377\271+1\377\271*1\377\271"
+ 988      2D32FFBA 
+ 988      2C31FFB9 
+ 988      2B31FFB9 
+ 988      2B31FFB9 
+ 989 1e29 2A30FFB8 		.ascii	"*0\377\270)0\377\270(0\377\270(0\377\267'/\377\267&/\377\267"
+ 989      2930FFB8 
+ 989      2830FFB8 
+ 989      2830FFB7 
+ 989      272FFFB7 
+ 990 1e41 262FFFB7 		.ascii	"&/\377\267%/\377\266$.\377\266$.\377\266#.\377\265\".\377\265"
+ 990      252FFFB6 
+ 990      242EFFB6 
+ 990      242EFFB6 
+ 990      232EFFB5 
+ 991 1e59 222DFFB5 		.ascii	"\"-\377\265!-\377\265 -\377\264\037-\377\264\037,\377\264\036"
+ 991      212DFFB5 
+ 991      202DFFB4 
+ 991      1F2DFFB4 
+ 991      1F2CFFB4 
+ 992 1e6e 2CFFB31D 		.ascii	",\377\263\035,\377\263\034,\377\263\034,\377\263\033+\377\262"
+ 992      2CFFB31C 
+ 992      2CFFB31C 
+GAS LISTING /tmp/ccoNxI3i.s 			page 35
+
+
+ 992      2CFFB31B 
+ 992      2BFFB2
+ 993 1e81 1A2BFFB2 		.ascii	"\032+\377\262\031+\377\262\030+\377\261\027*\377\261\027*\377"
+ 993      192BFFB2 
+ 993      182BFFB1 
+ 993      172AFFB1 
+ 993      172AFF
+ 994 1e94 B0172AFF 		.ascii	"\260\027*\377\257\027*\377\257\026*\377\256\026*\377\256\026"
+ 994      AF172AFF 
+ 994      AF162AFF 
+ 994      AE162AFF 
+ 994      AE16
+ 995 1ea6 2AFFAD15 		.ascii	"*\377\255\025*\377\255\025*\377\254\025*\377\253\025*\377\253"
+ 995      2AFFAD15 
+ 995      2AFFAC15 
+ 995      2AFFAB15 
+ 995      2AFFAB
+ 996 1eb9 142AFFAA 		.ascii	"\024*\377\252\024*\377\252\024*\377\251\024*\377\250\023*\377"
+ 996      142AFFAA 
+ 996      142AFFA9 
+ 996      142AFFA8 
+ 996      132AFF
+ 997 1ecc A8132AFF 		.ascii	"\250\023*\377\247\023*\377\247\023*\377\246\022)\377\245\022"
+ 997      A7132AFF 
+ 997      A7132AFF 
+ 997      A61229FF 
+ 997      A512
+ 998 1ede 29FFA512 		.ascii	")\377\245\022)\377\244\022)\377\244\021)\377\243\021)\377\242"
+ 998      29FFA412 
+ 998      29FFA411 
+ 998      29FFA311 
+ 998      29FFA2
+ 999 1ef1 1129FFA2 		.ascii	"\021)\377\242\021)\377\241\020)\377\241\020)\377\240\020)\377"
+ 999      1129FFA1 
+ 999      1029FFA1 
+ 999      1029FFA0 
+ 999      1029FF
+ 1000 1f04 A01029FF 		.ascii	"\240\020)\377\237\017)\377\236\017)\377\236\017(\377\235\017"
+ 1000      9F0F29FF 
+ 1000      9E0F29FF 
+ 1000      9E0F28FF 
+ 1000      9D0F
+ 1001 1f16 28FF9D0E 		.ascii	"(\377\235\016(\377\234\016(\377\233\016(\377\233\016(\377\232"
+ 1001      28FF9C0E 
+ 1001      28FF9B0E 
+ 1001      28FF9B0E 
+ 1001      28FF9A
+ 1002 1f29 0D28FF9A 		.ascii	"\r(\377\232\r(\377\231\r(\377\230\r(\377\230\f(\377\227\f(\377"
+ 1002      0D28FF99 
+ 1002      0D28FF98 
+ 1002      0D28FF98 
+ 1002      0C28FF97 
+ 1003 1f40 970C27FF 		.ascii	"\227\f'\377\226\f'\377\225\013'\377\225\013'\377\224\013'\377"
+ 1003      960C27FF 
+ 1003      950B27FF 
+ 1003      950B27FF 
+ 1003      940B27FF 
+GAS LISTING /tmp/ccoNxI3i.s 			page 36
+
+
+ 1004 1f54 940B27FF 		.ascii	"\224\013'\377\204\006$\377\204\005$\377\203\005$\377\202\005"
+ 1004      840624FF 
+ 1004      840524FF 
+ 1004      830524FF 
+ 1004      8205
+ 1005 1f66 24FF8205 		.ascii	"$\377\202\005$\377\201\005$\377\201\005$\377\200\004$\377\177"
+ 1005      24FF8105 
+ 1005      24FF8105 
+ 1005      24FF8004 
+ 1005      24FF7F
+ 1006 1f79 0424FF7F 		.ascii	"\004$\377\177\004$\377~\004#\377~\004#\377}\003#\377}\003#\377"
+ 1006      0424FF7E 
+ 1006      0423FF7E 
+ 1006      0423FF7D 
+ 1006      0323FF7D 
+ 1007 1f90 7C0323FF 		.ascii	"|\003#\377{\003#\377{\003#\377z\003#\377z\003#\377y\002#\377"
+ 1007      7B0323FF 
+ 1007      7B0323FF 
+ 1007      7A0323FF 
+ 1007      7A0323FF 
+ 1008 1fa8 780222FF 		.ascii	"x\002\"\377x\002\"\377w\002\"\377w\002\"\377v\002\"\377v\002"
+ 1008      780222FF 
+ 1008      770222FF 
+ 1008      770222FF 
+ 1008      760222FF 
+ 1009 1fbe 22FF     		.ascii	"\"\377"
+ 1010 1fc0 750222FF 		.string	"u\002\"\377t\001\"\377t\001!\377s\001!\377s\001!\377r\001!\377q\001!\377q\001!\377p\001!\
+ 1010      740122FF 
+ 1010      740121FF 
+ 1010      730121FF 
+ 1010      730121FF 
+ 1011 1fee 20FF6E00 		.string	" \377n"
+ 1012 1ff2 20FF6D00 		.string	" \377m"
+ 1013 1ff6 20FF6D00 		.string	" \377m"
+ 1014 1ffa 20FF6C00 		.string	" \377l"
+ 1015 1ffe 20FF6C00 		.string	" \377l"
+ 1016 2002 20FF6B00 		.string	" \377k"
+ 1017 2006 20FF6B00 		.string	" \377k"
+ 1018 200a 1FFF6A00 		.string	"\037\377j"
+ 1019 200e 1FFF6900 		.string	"\037\377i"
+ 1020 2012 1FFF6900 		.string	"\037\377i"
+ 1021 2016 1FFF6800 		.string	"\037\377h"
+ 1022 201a 1FFF6800 		.string	"\037\377h"
+ 1023 201e 1FFF6700 		.string	"\037\377g"
+ 1024 2022 1FFF     		.ascii	"\037\377"
+ 1025              		.globl	heatmap_cs_RdBu_soft
+ 1026              		.section	.data.rel.local
+ 1027              		.align 8
+ 1028              		.type	heatmap_cs_RdBu_soft, @object
+ 1029              		.size	heatmap_cs_RdBu_soft, 8
+ 1030              	heatmap_cs_RdBu_soft:
+ 1031 0010 00000000 		.quad	soft
+ 1031      00000000 
+ 1032              		.section	.data.rel.ro.local
+ 1033              		.align 16
+ 1034              		.type	soft, @object
+ 1035              		.size	soft, 16
+GAS LISTING /tmp/ccoNxI3i.s 			page 37
+
+
+ 1036              	soft:
+ 1037 0020 00000000 		.quad	soft_data
+ 1037      00000000 
+ 1038 0028 01040000 		.quad	1025
+ 1038      00000000 
+ 1039              		.section	.rodata
+ 1040 2024 00000000 		.align 32
+ 1040      00000000 
+ 1040      00000000 
+ 1040      00000000 
+ 1040      00000000 
+ 1041              		.type	soft_data, @object
+ 1042              		.size	soft_data, 4100
+ 1043              	soft_data:
+ 1044 2040 00       		.string	""
+ 1045 2041 00       		.string	""
+ 1046 2042 00       		.string	""
+ 1047 2043 00       		.string	""
+ 1048 2044 052F6100 		.string	"\005/a"
+ 1049 2048 05306107 		.ascii	"\0050a\007\0050b\016\0051c\026\0061c\035\0062d%\0062e,\0073e"
+ 1049      0530620E 
+ 1049      05316316 
+ 1049      0631631D 
+ 1049      06326425 
+ 1050 2063 34073366 		.ascii	"4\0073f;\0074gC\b4gJ\b5hR\b5iY\t6ja\t6jh\t7kp\n7lw\n8l\177\n"
+ 1050      3B073467 
+ 1050      43083467 
+ 1050      4A083568 
+ 1050      52083569 
+ 1051 208d 386D860B 		.ascii	"8m\206\0139n\215\0139o\225\013:o\234\f:p\244\f;q\253\f;q\263"
+ 1051      396E8D0B 
+ 1051      396F950B 
+ 1051      3A6F9C0C 
+ 1051      3A70A40C 
+ 1052 20a8 0D3C72BA 		.ascii	"\r<r\272\r<s\302\r=t\311\016=t\321\016>u\330\016>v\340\017?v"
+ 1052      0D3C73C2 
+ 1052      0D3D74C9 
+ 1052      0E3D74D1 
+ 1052      0E3E75D8 
+ 1053 20c3 E70F4077 		.ascii	"\347\017@w\357\017@x\366\017Ay\376\020Ay\377\020Bz\377\020B{"
+ 1053      EF0F4078 
+ 1053      F60F4179 
+ 1053      FE104179 
+ 1053      FF10427A 
+ 1054 20db FF11437B 		.ascii	"\377\021C{\377\021C|\377\021D}\377\021D~\377\022E~\377\022E\177"
+ 1054      FF11437C 
+ 1054      FF11447D 
+ 1054      FF11447E 
+ 1054      FF12457E 
+ 1055 20f3 FF124680 		.ascii	"\377\022F\200\377\023F\201\377\023G\201\377\023G\202\377\023"
+ 1055      FF134681 
+ 1055      FF134781 
+ 1055      FF134782 
+ 1055      FF13
+ 1056 2105 4883FF14 		.ascii	"H\203\377\024H\203\377\024I\204\377\024I\205\377\025J\206\377"
+ 1056      4883FF14 
+ 1056      4984FF14 
+GAS LISTING /tmp/ccoNxI3i.s 			page 38
+
+
+ 1056      4985FF15 
+ 1056      4A86FF
+ 1057 2118 154A86FF 		.ascii	"\025J\206\377\025K\207\377\025L\210\377\026L\211\377\026M\211"
+ 1057      154B87FF 
+ 1057      154C88FF 
+ 1057      164C89FF 
+ 1057      164D89
+ 1058 212b FF164D8A 		.ascii	"\377\026M\212\377\026N\213\377\027N\214\377\027O\214\377\027"
+ 1058      FF164E8B 
+ 1058      FF174E8C 
+ 1058      FF174F8C 
+ 1058      FF17
+ 1059 213d 4F8DFF17 		.ascii	"O\215\377\027P\216\377\030P\217\377\030Q\217\377\030Q\220\377"
+ 1059      508EFF18 
+ 1059      508FFF18 
+ 1059      518FFF18 
+ 1059      5190FF
+ 1060 2150 185291FF 		.ascii	"\030R\221\377\031S\222\377\031S\222\377\031T\223\377\031T\224"
+ 1060      195392FF 
+ 1060      195392FF 
+ 1060      195493FF 
+ 1060      195494
+ 1061 2163 FF1A5594 		.ascii	"\377\032U\224\377\032U\225\377\032V\226\377\032V\227\377\033"
+ 1061      FF1A5595 
+ 1061      FF1A5696 
+ 1061      FF1A5697 
+ 1061      FF1B
+ 1062 2175 5797FF1B 		.ascii	"W\227\377\033W\230\377\033X\231\377\033X\232\377\034Y\232\377"
+ 1062      5798FF1B 
+ 1062      5899FF1B 
+ 1062      589AFF1C 
+ 1062      599AFF
+ 1063 2188 1C5A9BFF 		.ascii	"\034Z\233\377\034Z\234\377\034[\235\377\034[\236\377\035\\\236"
+ 1063      1C5A9CFF 
+ 1063      1C5B9DFF 
+ 1063      1C5B9EFF 
+ 1063      1D5C9E
+ 1064 219b FF1D5C9F 		.ascii	"\377\035\\\237\377\035]\240\377\035]\241\377\036^\241\377\036"
+ 1064      FF1D5DA0 
+ 1064      FF1D5DA1 
+ 1064      FF1E5EA1 
+ 1064      FF1E
+ 1065 21ad 5FA2FF1E 		.ascii	"_\242\377\036_\243\377\036`\244\377\037`\244\377\037a\245\377"
+ 1065      5FA3FF1E 
+ 1065      60A4FF1F 
+ 1065      60A4FF1F 
+ 1065      61A5FF
+ 1066 21c0 1F61A6FF 		.ascii	"\037a\246\377\037b\247\377\037b\247\377 c\250\377 d\251\377 "
+ 1066      1F62A7FF 
+ 1066      1F62A7FF 
+ 1066      2063A8FF 
+ 1066      2064A9FF 
+ 1067 21d5 64AAFF20 		.ascii	"d\252\377 e\252\377 e\253\377!f\254\377!f\254\377!g\254\377!"
+ 1067      65AAFF20 
+ 1067      65ABFF21 
+ 1067      66ACFF21 
+ 1067      66ACFF21 
+GAS LISTING /tmp/ccoNxI3i.s 			page 39
+
+
+ 1068 21ed 67ACFF21 		.ascii	"g\254\377!h\255\377!h\255\377!h\255\377!i\256\377!i\256\377!"
+ 1068      68ADFF21 
+ 1068      68ADFF21 
+ 1068      68ADFF21 
+ 1068      69AEFF21 
+ 1069 2205 6AAEFF21 		.ascii	"j\256\377!j\256\377\"k\257\377\"k\257\377\"l\257\377\"l\257\377"
+ 1069      6AAEFF22 
+ 1069      6BAFFF22 
+ 1069      6BAFFF22 
+ 1069      6CAFFF22 
+ 1070 221c 226CB0FF 		.ascii	"\"l\260\377\"m\260\377#m\260\377#n\260\377#n\261\377#o\261\377"
+ 1070      226DB0FF 
+ 1070      236DB0FF 
+ 1070      236EB0FF 
+ 1070      236EB1FF 
+ 1071 2234 236FB1FF 		.ascii	"#o\261\377$p\261\377$p\262\377$q\262\377$q\262\377$q\262\377"
+ 1071      2470B1FF 
+ 1071      2470B2FF 
+ 1071      2471B2FF 
+ 1071      2471B2FF 
+ 1072 224c 2572B3FF 		.ascii	"%r\263\377%r\263\377%s\263\377%s\263\377&t\264\377&t\264\377"
+ 1072      2572B3FF 
+ 1072      2573B3FF 
+ 1072      2573B3FF 
+ 1072      2674B4FF 
+ 1073 2264 2674B4FF 		.ascii	"&t\264\377&u\264\377'u\265\377'v\265\377'v\265\377(w\265\377"
+ 1073      2675B4FF 
+ 1073      2775B5FF 
+ 1073      2776B5FF 
+ 1073      2776B5FF 
+ 1074 227c 2877B5FF 		.ascii	"(w\265\377(x\266\377(x\266\377)x\266\377)y\266\377)y\267\377"
+ 1074      2878B6FF 
+ 1074      2878B6FF 
+ 1074      2978B6FF 
+ 1074      2979B6FF 
+ 1075 2294 2A7AB7FF 		.ascii	"*z\267\377*z\267\377*{\267\377+{\267\377+|\270\377,|\270\377"
+ 1075      2A7AB7FF 
+ 1075      2A7BB7FF 
+ 1075      2B7BB7FF 
+ 1075      2B7CB8FF 
+ 1076 22ac 2C7CB8FF 		.ascii	",|\270\377,}\270\377-}\271\377-~\271\377-~\271\377.\177\271\377"
+ 1076      2C7DB8FF 
+ 1076      2D7DB9FF 
+ 1076      2D7EB9FF 
+ 1076      2D7EB9FF 
+ 1077 22c4 2E7FB9FF 		.ascii	".\177\271\377/\200\272\377/\200\272\377/\200\272\3770\201\272"
+ 1077      2F80BAFF 
+ 1077      2F80BAFF 
+ 1077      2F80BAFF 
+ 1077      3081BA
+ 1078 22d7 FF3081BB 		.ascii	"\3770\201\273\3770\202\273\3771\202\273\3771\203\273\3772\203"
+ 1078      FF3082BB 
+ 1078      FF3182BB 
+ 1078      FF3183BB 
+ 1078      FF3283
+ 1079 22ea BBFF3283 		.ascii	"\273\3772\203\274\3773\204\274\3773\204\274\3773\205\274\377"
+ 1079      BCFF3384 
+GAS LISTING /tmp/ccoNxI3i.s 			page 40
+
+
+ 1079      BCFF3384 
+ 1079      BCFF3385 
+ 1079      BCFF
+ 1080 22fc 3485BCFF 		.ascii	"4\205\274\3774\206\275\3775\206\275\3775\206\275\3776\207\275"
+ 1080      3486BDFF 
+ 1080      3586BDFF 
+ 1080      3586BDFF 
+ 1080      3687BD
+ 1081 230f FF3687BD 		.ascii	"\3776\207\275\3777\210\276\3777\210\276\3777\211\276\3778\211"
+ 1081      FF3788BE 
+ 1081      FF3788BE 
+ 1081      FF3789BE 
+ 1081      FF3889
+ 1082 2322 BEFF388A 		.ascii	"\276\3778\212\276\3779\212\277\3779\212\277\377:\213\277\377"
+ 1082      BEFF398A 
+ 1082      BFFF398A 
+ 1082      BFFF3A8B 
+ 1082      BFFF
+ 1083 2334 3A8BBFFF 		.ascii	":\213\277\377;\214\277\377;\214\300\377<\215\300\377<\215\300"
+ 1083      3B8CBFFF 
+ 1083      3B8CC0FF 
+ 1083      3C8DC0FF 
+ 1083      3C8DC0
+ 1084 2347 FF3D8DC0 		.ascii	"\377=\215\300\377=\216\300\377>\216\301\377>\217\301\377?\217"
+ 1084      FF3D8EC0 
+ 1084      FF3E8EC1 
+ 1084      FF3E8FC1 
+ 1084      FF3F8F
+ 1085 235a C1FF3F90 		.ascii	"\301\377?\220\301\377@\220\301\377@\220\302\377A\221\302\377"
+ 1085      C1FF4090 
+ 1085      C1FF4090 
+ 1085      C2FF4191 
+ 1085      C2FF
+ 1086 236c 4191C2FF 		.ascii	"A\221\302\377B\222\302\377B\222\302\377C\223\303\377D\223\303"
+ 1086      4292C2FF 
+ 1086      4292C2FF 
+ 1086      4393C3FF 
+ 1086      4493C3
+ 1087 237f FF4494C3 		.ascii	"\377D\224\303\377E\224\303\377F\225\304\377G\225\304\377H\226"
+ 1087      FF4594C3 
+ 1087      FF4695C4 
+ 1087      FF4795C4 
+ 1087      FF4896
+ 1088 2392 C4FF4996 		.ascii	"\304\377I\226\304\377I\227\305\377J\227\305\377K\227\305\377"
+ 1088      C4FF4997 
+ 1088      C5FF4A97 
+ 1088      C5FF4B97 
+ 1088      C5FF
+ 1089 23a4 4C98C5FF 		.ascii	"L\230\305\377M\230\306\377M\231\306\377N\231\306\377O\232\306"
+ 1089      4D98C6FF 
+ 1089      4D99C6FF 
+ 1089      4E99C6FF 
+ 1089      4F9AC6
+ 1090 23b7 FF509AC7 		.ascii	"\377P\232\307\377Q\233\307\377Q\233\307\377R\234\307\377S\234"
+ 1090      FF519BC7 
+ 1090      FF519BC7 
+ 1090      FF529CC7 
+GAS LISTING /tmp/ccoNxI3i.s 			page 41
+
+
+ 1090      FF539C
+ 1091 23ca C8FF549D 		.ascii	"\310\377T\235\310\377U\235\310\377U\236\310\377V\236\311\377"
+ 1091      C8FF559D 
+ 1091      C8FF559E 
+ 1091      C8FF569E 
+ 1091      C9FF
+ 1092 23dc 579FC9FF 		.ascii	"W\237\311\377X\237\311\377Y\240\312\377Y\240\312\377Z\241\312"
+ 1092      589FC9FF 
+ 1092      59A0CAFF 
+ 1092      59A0CAFF 
+ 1092      5AA1CA
+ 1093 23ef FF5BA1CA 		.ascii	"\377[\241\312\377\\\242\313\377\\\242\313\377]\243\313\377^\243"
+ 1093      FF5CA2CB 
+ 1093      FF5CA2CB 
+ 1093      FF5DA3CB 
+ 1093      FF5EA3
+ 1094 2402 CBFF5FA4 		.ascii	"\313\377_\244\314\377`\244\314\377`\245\314\377a\245\314\377"
+ 1094      CCFF60A4 
+ 1094      CCFF60A5 
+ 1094      CCFF61A5 
+ 1094      CCFF
+ 1095 2414 62A6CDFF 		.ascii	"b\246\315\377c\246\315\377c\247\315\377d\247\315\377e\250\316"
+ 1095      63A6CDFF 
+ 1095      63A7CDFF 
+ 1095      64A7CDFF 
+ 1095      65A8CE
+ 1096 2427 FF66A8CE 		.ascii	"\377f\250\316\377f\251\316\377g\251\316\377h\252\317\377i\252"
+ 1096      FF66A9CE 
+ 1096      FF67A9CE 
+ 1096      FF68AACF 
+ 1096      FF69AA
+ 1097 243a CFFF69AB 		.ascii	"\317\377i\253\317\377j\253\320\377k\254\320\377l\254\320\377"
+ 1097      CFFF6AAB 
+ 1097      D0FF6BAC 
+ 1097      D0FF6CAC 
+ 1097      D0FF
+ 1098 244c 6DACD0FF 		.ascii	"m\254\320\377m\255\321\377n\255\321\377o\256\321\377p\256\321"
+ 1098      6DADD1FF 
+ 1098      6EADD1FF 
+ 1098      6FAED1FF 
+ 1098      70AED1
+ 1099 245f FF70AFD2 		.ascii	"\377p\257\322\377q\257\322\377r\260\322\377s\260\322\377s\261"
+ 1099      FF71AFD2 
+ 1099      FF72B0D2 
+ 1099      FF73B0D2 
+ 1099      FF73B1
+ 1100 2472 D3FF74B1 		.ascii	"\323\377t\261\323\377u\262\323\377v\262\323\377v\263\324\377"
+ 1100      D3FF75B2 
+ 1100      D3FF76B2 
+ 1100      D3FF76B3 
+ 1100      D4FF
+ 1101 2484 77B3D4FF 		.ascii	"w\263\324\377x\264\324\377y\264\325\377y\265\325\377z\265\325"
+ 1101      78B4D4FF 
+ 1101      79B4D5FF 
+ 1101      79B5D5FF 
+ 1101      7AB5D5
+ 1102 2497 FF7BB6D5 		.ascii	"\377{\266\325\377|\266\326\377|\267\326\377}\267\326\377~\270"
+GAS LISTING /tmp/ccoNxI3i.s 			page 42
+
+
+ 1102      FF7CB6D6 
+ 1102      FF7CB7D6 
+ 1102      FF7DB7D6 
+ 1102      FF7EB8
+ 1103 24aa D6FF7FB8 		.ascii	"\326\377\177\270\327\377\177\271\327\377\200\271\327\377\201"
+ 1103      D7FF7FB9 
+ 1103      D7FF80B9 
+ 1103      D7FF81
+ 1104 24b9 BAD7FF82 		.ascii	"\272\327\377\202\272\330\377\202\273\330\377\203\273\330\377"
+ 1104      BAD8FF82 
+ 1104      BBD8FF83 
+ 1104      BBD8FF
+ 1105 24c8 84BCD9FF 		.ascii	"\204\274\331\377\205\274\331\377\205\275\331\377\206\275\331"
+ 1105      85BCD9FF 
+ 1105      85BDD9FF 
+ 1105      86BDD9
+ 1106 24d7 FF87BEDA 		.ascii	"\377\207\276\332\377\210\276\332\377\210\277\332\377\211\277"
+ 1106      FF88BEDA 
+ 1106      FF88BFDA 
+ 1106      FF89BF
+ 1107 24e6 DAFF8AC0 		.ascii	"\332\377\212\300\333\377\213\300\333\377\213\301\333\377\214"
+ 1107      DBFF8BC0 
+ 1107      DBFF8BC1 
+ 1107      DBFF8C
+ 1108 24f5 C1DCFF8D 		.ascii	"\301\334\377\215\301\334\377\216\302\334\377\216\302\334\377"
+ 1108      C1DCFF8E 
+ 1108      C2DCFF8E 
+ 1108      C2DCFF
+ 1109 2504 8FC3DDFF 		.ascii	"\217\303\335\377\220\303\335\377\221\304\335\377\221\304\335"
+ 1109      90C3DDFF 
+ 1109      91C4DDFF 
+ 1109      91C4DD
+ 1110 2513 FF92C5DE 		.ascii	"\377\222\305\336\377\223\305\336\377\223\305\336\377\224\306"
+ 1110      FF93C5DE 
+ 1110      FF93C5DE 
+ 1110      FF94C6
+ 1111 2522 DEFF95C6 		.ascii	"\336\377\225\306\336\377\225\306\337\377\226\307\337\377\227"
+ 1111      DEFF95C6 
+ 1111      DFFF96C7 
+ 1111      DFFF97
+ 1112 2531 C7DFFF97 		.ascii	"\307\337\377\227\307\337\377\230\310\337\377\230\310\337\377"
+ 1112      C7DFFF98 
+ 1112      C8DFFF98 
+ 1112      C8DFFF
+ 1113 2540 99C8E0FF 		.ascii	"\231\310\340\377\232\310\340\377\232\311\340\377\233\311\340"
+ 1113      9AC8E0FF 
+ 1113      9AC9E0FF 
+ 1113      9BC9E0
+ 1114 254f FF9CC9E0 		.ascii	"\377\234\311\340\377\234\312\340\377\235\312\341\377\236\312"
+ 1114      FF9CCAE0 
+ 1114      FF9DCAE1 
+ 1114      FF9ECA
+ 1115 255e E1FF9ECB 		.ascii	"\341\377\236\313\341\377\237\313\341\377\237\313\341\377\240"
+ 1115      E1FF9FCB 
+ 1115      E1FF9FCB 
+ 1115      E1FFA0
+ 1116 256d CCE2FFA1 		.ascii	"\314\342\377\241\314\342\377\241\314\342\377\242\314\342\377"
+GAS LISTING /tmp/ccoNxI3i.s 			page 43
+
+
+ 1116      CCE2FFA1 
+ 1116      CCE2FFA2 
+ 1116      CCE2FF
+ 1117 257c A3CDE2FF 		.ascii	"\243\315\342\377\243\315\342\377\244\315\343\377\245\316\343"
+ 1117      A3CDE2FF 
+ 1117      A4CDE3FF 
+ 1117      A5CEE3
+ 1118 258b FFA5CEE3 		.ascii	"\377\245\316\343\377\246\316\343\377\246\317\343\377\247\317"
+ 1118      FFA6CEE3 
+ 1118      FFA6CFE3 
+ 1118      FFA7CF
+ 1119 259a E3FFA8CF 		.ascii	"\343\377\250\317\344\377\250\320\344\377\251\320\344\377\251"
+ 1119      E4FFA8D0 
+ 1119      E4FFA9D0 
+ 1119      E4FFA9
+ 1120 25a9 D0E4FFAA 		.ascii	"\320\344\377\252\321\344\377\253\321\345\377\253\321\345\377"
+ 1120      D1E4FFAB 
+ 1120      D1E5FFAB 
+ 1120      D1E5FF
+ 1121 25b8 ACD1E5FF 		.ascii	"\254\321\345\377\255\322\345\377\255\322\345\377\256\322\345"
+ 1121      ADD2E5FF 
+ 1121      ADD2E5FF 
+ 1121      AED2E5
+ 1122 25c7 FFAED3E6 		.ascii	"\377\256\323\346\377\257\323\346\377\260\323\346\377\260\324"
+ 1122      FFAFD3E6 
+ 1122      FFB0D3E6 
+ 1122      FFB0D4
+ 1123 25d6 E6FFB1D4 		.ascii	"\346\377\261\324\346\377\261\324\346\377\262\325\347\377\263"
+ 1123      E6FFB1D4 
+ 1123      E6FFB2D5 
+ 1123      E7FFB3
+ 1124 25e5 D5E7FFB3 		.ascii	"\325\347\377\263\325\347\377\264\326\347\377\265\326\347\377"
+ 1124      D5E7FFB4 
+ 1124      D6E7FFB5 
+ 1124      D6E7FF
+ 1125 25f4 B5D6E8FF 		.ascii	"\265\326\350\377\266\326\350\377\266\327\350\377\267\327\350"
+ 1125      B6D6E8FF 
+ 1125      B6D7E8FF 
+ 1125      B7D7E8
+ 1126 2603 FFB8D7E8 		.ascii	"\377\270\327\350\377\270\330\350\377\271\330\351\377\271\330"
+ 1126      FFB8D8E8 
+ 1126      FFB9D8E9 
+ 1126      FFB9D8
+ 1127 2612 E9FFBAD9 		.ascii	"\351\377\272\331\351\377\273\331\351\377\273\331\351\377\274"
+ 1127      E9FFBBD9 
+ 1127      E9FFBBD9 
+ 1127      E9FFBC
+ 1128 2621 DAE9FFBC 		.ascii	"\332\351\377\274\332\352\377\275\332\352\377\276\333\352\377"
+ 1128      DAEAFFBD 
+ 1128      DAEAFFBE 
+ 1128      DBEAFF
+ 1129 2630 BEDBEAFF 		.ascii	"\276\333\352\377\277\333\352\377\277\333\352\377\300\334\353"
+ 1129      BFDBEAFF 
+ 1129      BFDBEAFF 
+ 1129      C0DCEB
+ 1130 263f FFC1DCEB 		.ascii	"\377\301\334\353\377\301\334\353\377\302\335\353\377\302\335"
+ 1130      FFC1DCEB 
+GAS LISTING /tmp/ccoNxI3i.s 			page 44
+
+
+ 1130      FFC2DDEB 
+ 1130      FFC2DD
+ 1131 264e EBFFC3DD 		.ascii	"\353\377\303\335\354\377\304\336\354\377\304\336\354\377\305"
+ 1131      ECFFC4DE 
+ 1131      ECFFC4DE 
+ 1131      ECFFC5
+ 1132 265d DEECFFC5 		.ascii	"\336\354\377\305\337\354\377\306\337\354\377\307\337\355\377"
+ 1132      DFECFFC6 
+ 1132      DFECFFC7 
+ 1132      DFEDFF
+ 1133 266c C7E0EDFF 		.ascii	"\307\340\355\377\310\340\355\377\310\340\355\377\311\341\355"
+ 1133      C8E0EDFF 
+ 1133      C8E0EDFF 
+ 1133      C9E1ED
+ 1134 267b FFCAE1ED 		.ascii	"\377\312\341\355\377\312\341\356\377\313\341\356\377\313\342"
+ 1134      FFCAE1EE 
+ 1134      FFCBE1EE 
+ 1134      FFCBE2
+ 1135 268a EEFFCCE2 		.ascii	"\356\377\314\342\356\377\315\342\356\377\315\343\357\377\316"
+ 1135      EEFFCDE2 
+ 1135      EEFFCDE3 
+ 1135      EFFFCE
+ 1136 2699 E3EFFFCE 		.ascii	"\343\357\377\316\343\357\377\317\344\357\377\320\344\357\377"
+ 1136      E3EFFFCF 
+ 1136      E4EFFFD0 
+ 1136      E4EFFF
+ 1137 26a8 D0E4EFFF 		.ascii	"\320\344\357\377\363\334\342\377\362\334\342\377\362\334\343"
+ 1137      F3DCE2FF 
+ 1137      F2DCE2FF 
+ 1137      F2DCE3
+ 1138 26b7 FFF2DDE3 		.ascii	"\377\362\335\343\377\362\335\344\377\362\335\344\377\362\336"
+ 1138      FFF2DDE4 
+ 1138      FFF2DDE4 
+ 1138      FFF2DE
+ 1139 26c6 E5FFF2DE 		.ascii	"\345\377\362\336\345\377\362\336\346\377\361\336\346\377\361"
+ 1139      E5FFF2DE 
+ 1139      E6FFF1DE 
+ 1139      E6FFF1
+ 1140 26d5 DFE7FFF1 		.ascii	"\337\347\377\361\337\347\377\361\337\350\377\361\340\350\377"
+ 1140      DFE7FFF1 
+ 1140      DFE8FFF1 
+ 1140      E0E8FF
+ 1141 26e4 F1E0E9FF 		.ascii	"\361\340\351\377\361\340\351\377\360\340\352\377\360\341\352"
+ 1141      F1E0E9FF 
+ 1141      F0E0EAFF 
+ 1141      F0E1EA
+ 1142 26f3 FFF0E1EA 		.ascii	"\377\360\341\352\377\360\341\353\377\360\342\353\377\360\342"
+ 1142      FFF0E1EB 
+ 1142      FFF0E2EB 
+ 1142      FFF0E2
+ 1143 2702 ECFFF0E2 		.ascii	"\354\377\360\342\354\377\357\343\354\377\357\343\355\377\357"
+ 1143      ECFFEFE3 
+ 1143      ECFFEFE3 
+ 1143      EDFFEF
+ 1144 2711 E3EDFFEF 		.ascii	"\343\355\377\357\343\355\377\357\344\356\377\357\344\356\377"
+ 1144      E3EDFFEF 
+ 1144      E4EEFFEF 
+GAS LISTING /tmp/ccoNxI3i.s 			page 45
+
+
+ 1144      E4EEFF
+ 1145 2720 EFE4EEFF 		.ascii	"\357\344\356\377\356\345\357\377\356\345\357\377\356\345\357"
+ 1145      EEE5EFFF 
+ 1145      EEE5EFFF 
+ 1145      EEE5EF
+ 1146 272f FFEEE6EF 		.ascii	"\377\356\346\357\377\356\346\360\377\356\346\360\377\356\347"
+ 1146      FFEEE6F0 
+ 1146      FFEEE6F0 
+ 1146      FFEEE7
+ 1147 273e F0FFEEE7 		.ascii	"\360\377\356\347\361\377\356\347\361\377\355\347\361\377\355"
+ 1147      F1FFEEE7 
+ 1147      F1FFEDE7 
+ 1147      F1FFED
+ 1148 274d E8F1FFED 		.ascii	"\350\361\377\355\350\361\377\355\350\362\377\355\351\362\377"
+ 1148      E8F1FFED 
+ 1148      E8F2FFED 
+ 1148      E9F2FF
+ 1149 275c EDE9F2FF 		.ascii	"\355\351\362\377\355\351\362\377\355\351\362\377\355\352\363"
+ 1149      EDE9F2FF 
+ 1149      EDE9F2FF 
+ 1149      EDEAF3
+ 1150 276b FFEDEAF3 		.ascii	"\377\355\352\363\377\355\352\363\377\355\353\363\377\355\353"
+ 1150      FFEDEAF3 
+ 1150      FFEDEBF3 
+ 1150      FFEDEB
+ 1151 277a F3FFEDEB 		.ascii	"\363\377\355\353\363\377\355\353\364\377\355\354\364\377\355"
+ 1151      F3FFEDEB 
+ 1151      F4FFEDEC 
+ 1151      F4FFED
+ 1152 2789 ECF4FFED 		.ascii	"\354\364\377\355\354\364\377\355\354\364\377\355\355\364\377"
+ 1152      ECF4FFED 
+ 1152      ECF4FFED 
+ 1152      EDF4FF
+ 1153 2798 EDEDF4FF 		.ascii	"\355\355\364\377\355\355\364\377\355\356\364\377\355\356\364"
+ 1153      EDEDF4FF 
+ 1153      EDEEF4FF 
+ 1153      EDEEF4
+ 1154 27a7 FFEDEEF5 		.ascii	"\377\355\356\365\377\355\356\365\377\355\357\365\377\356\357"
+ 1154      FFEDEEF5 
+ 1154      FFEDEFF5 
+ 1154      FFEEEF
+ 1155 27b6 F5FFEEEF 		.ascii	"\365\377\356\357\365\377\356\357\365\377\356\360\365\377\356"
+ 1155      F5FFEEEF 
+ 1155      F5FFEEF0 
+ 1155      F5FFEE
+ 1156 27c5 F0F5FFEE 		.ascii	"\360\365\377\356\360\365\377\356\360\365\377\357\361\365\377"
+ 1156      F0F5FFEE 
+ 1156      F0F5FFEF 
+ 1156      F1F5FF
+ 1157 27d4 EFF1F5FF 		.ascii	"\357\361\365\377\357\361\365\377\357\361\365\377\357\361\365"
+ 1157      EFF1F5FF 
+ 1157      EFF1F5FF 
+ 1157      EFF1F5
+ 1158 27e3 FFEFF2F5 		.ascii	"\377\357\362\365\377\360\362\365\377\360\362\366\377\360\362"
+ 1158      FFF0F2F5 
+ 1158      FFF0F2F6 
+ 1158      FFF0F2
+GAS LISTING /tmp/ccoNxI3i.s 			page 46
+
+
+ 1159 27f2 F6FFF0F3 		.ascii	"\366\377\360\363\366\377\361\363\366\377\361\363\366\377\361"
+ 1159      F6FFF1F3 
+ 1159      F6FFF1F3 
+ 1159      F6FFF1
+ 1160 2801 F3F6FFF1 		.ascii	"\363\366\377\361\363\366\377\362\364\366\377\362\364\366\377"
+ 1160      F3F6FFF2 
+ 1160      F4F6FFF2 
+ 1160      F4F6FF
+ 1161 2810 F2F4F6FF 		.ascii	"\362\364\366\377\362\364\366\377\363\364\366\377\363\365\366"
+ 1161      F2F4F6FF 
+ 1161      F3F4F6FF 
+ 1161      F3F5F6
+ 1162 281f FFF3F5F6 		.ascii	"\377\363\365\366\377\364\365\366\377\364\365\366\377\364\365"
+ 1162      FFF4F5F6 
+ 1162      FFF4F5F6 
+ 1162      FFF4F5
+ 1163 282e F6FFF5F6 		.ascii	"\366\377\365\366\366\377\365\366\366\377\365\366\366\377\366"
+ 1163      F6FFF5F6 
+ 1163      F6FFF5F6 
+ 1163      F6FFF6
+ 1164 283d F6F6FFF6 		.ascii	"\366\366\377\366\366\366\377\366\367\367\377\367\366\366\377"
+ 1164      F6F6FFF6 
+ 1164      F7F7FFF7 
+ 1164      F6F6FF
+ 1165 284c F7F6F6FF 		.ascii	"\367\366\366\377\367\366\366\377\367\365\366\377\367\365\365"
+ 1165      F7F6F6FF 
+ 1165      F7F5F6FF 
+ 1165      F7F5F5
+ 1166 285b FFF7F5F5 		.ascii	"\377\367\365\365\377\367\364\365\377\370\364\365\377\370\364"
+ 1166      FFF7F4F5 
+ 1166      FFF8F4F5 
+ 1166      FFF8F4
+ 1167 286a F4FFF8F3 		.ascii	"\364\377\370\363\364\377\370\363\364\377\370\363\364\377\370"
+ 1167      F4FFF8F3 
+ 1167      F4FFF8F3 
+ 1167      F4FFF8
+ 1168 2879 F2F3FFF8 		.ascii	"\362\363\377\370\362\363\377\371\362\363\377\371\361\362\377"
+ 1168      F2F3FFF9 
+ 1168      F2F3FFF9 
+ 1168      F1F2FF
+ 1169 2888 F9F1F2FF 		.ascii	"\371\361\362\377\371\361\362\377\371\361\361\377\371\360\361"
+ 1169      F9F1F2FF 
+ 1169      F9F1F1FF 
+ 1169      F9F0F1
+ 1170 2897 FFF9F0F1 		.ascii	"\377\371\360\361\377\372\360\360\377\372\357\360\377\372\357"
+ 1170      FFFAF0F0 
+ 1170      FFFAEFF0 
+ 1170      FFFAEF
+ 1171 28a6 F0FFFAEF 		.ascii	"\360\377\372\357\357\377\372\356\357\377\372\356\357\377\372"
+ 1171      EFFFFAEE 
+ 1171      EFFFFAEE 
+ 1171      EFFFFA
+ 1172 28b5 EEEEFFFB 		.ascii	"\356\356\377\373\355\356\377\373\355\356\377\373\355\355\377"
+ 1172      EDEEFFFB 
+ 1172      EDEEFFFB 
+ 1172      EDEDFF
+ 1173 28c4 FBEDEDFF 		.ascii	"\373\355\355\377\373\354\354\377\373\354\354\377\374\354\354"
+GAS LISTING /tmp/ccoNxI3i.s 			page 47
+
+
+ 1173      FBECECFF 
+ 1173      FBECECFF 
+ 1173      FCECEC
+ 1174 28d3 FFFCEBEB 		.ascii	"\377\374\353\353\377\374\353\353\377\374\353\352\377\374\352"
+ 1174      FFFCEBEB 
+ 1174      FFFCEBEA 
+ 1174      FFFCEA
+ 1175 28e2 EAFFFCEA 		.ascii	"\352\377\374\352\351\377\374\352\351\377\374\352\351\377\375"
+ 1175      E9FFFCEA 
+ 1175      E9FFFCEA 
+ 1175      E9FFFD
+ 1176 28f1 E9E8FFFD 		.ascii	"\351\350\377\375\351\350\377\375\351\347\377\375\350\347\377"
+ 1176      E9E8FFFD 
+ 1176      E9E7FFFD 
+ 1176      E8E7FF
+ 1177 2900 FDE8E6FF 		.ascii	"\375\350\346\377\375\350\346\377\375\347\345\377\375\347\345"
+ 1177      FDE8E6FF 
+ 1177      FDE7E5FF 
+ 1177      FDE7E5
+ 1178 290f FFFDE7E4 		.ascii	"\377\375\347\344\377\376\347\344\377\376\346\343\377\376\346"
+ 1178      FFFEE7E4 
+ 1178      FFFEE6E3 
+ 1178      FFFEE6
+ 1179 291e E3FFFEE6 		.ascii	"\343\377\376\346\342\377\376\345\342\377\376\345\341\377\376"
+ 1179      E2FFFEE5 
+ 1179      E2FFFEE5 
+ 1179      E1FFFE
+ 1180 292d E5E1FFFE 		.ascii	"\345\341\377\376\345\340\377\376\344\340\377\376\344\337\377"
+ 1180      E5E0FFFE 
+ 1180      E4E0FFFE 
+ 1180      E4DFFF
+ 1181 293c FEE4DFFF 		.ascii	"\376\344\337\377\376\344\336\377\376\343\336\377\377\343\335"
+ 1181      FEE4DEFF 
+ 1181      FEE3DEFF 
+ 1181      FFE3DD
+ 1182 294b FFFFE3DC 		.ascii	"\377\377\343\334\377\377\342\334\377\377\342\333\377\377\342"
+ 1182      FFFFE2DC 
+ 1182      FFFFE2DB 
+ 1182      FFFFE2
+ 1183 295a DBFFFFE2 		.ascii	"\333\377\377\342\332\377\377\341\332\377\377\341\331\377\377"
+ 1183      DAFFFFE1 
+ 1183      DAFFFFE1 
+ 1183      D9FFFF
+ 1184 2969 E1D8FFFF 		.ascii	"\341\330\377\377\341\330\377\377\340\327\377\377\340\327\377"
+ 1184      E1D8FFFF 
+ 1184      E0D7FFFF 
+ 1184      E0D7FF
+ 1185 2978 FFE0D6FF 		.ascii	"\377\340\326\377\377\340\326\377\377\337\325\377\377\337\324"
+ 1185      FFE0D6FF 
+ 1185      FFDFD5FF 
+ 1185      FFDFD4
+ 1186 2987 FFFFDFD4 		.ascii	"\377\377\337\324\377\377\337\323\377\377\337\323\377\376\336"
+ 1186      FFFFDFD3 
+ 1186      FFFFDFD3 
+ 1186      FFFEDE
+ 1187 2996 D2FFFEDE 		.ascii	"\322\377\376\336\321\377\376\336\321\377\376\336\320\377\376"
+ 1187      D1FFFEDE 
+GAS LISTING /tmp/ccoNxI3i.s 			page 48
+
+
+ 1187      D1FFFEDE 
+ 1187      D0FFFE
+ 1188 29a5 DDD0FFFE 		.ascii	"\335\320\377\376\335\317\377\376\335\316\377\376\335\316\377"
+ 1188      DDCFFFFE 
+ 1188      DDCEFFFE 
+ 1188      DDCEFF
+ 1189 29b4 FEDDCDFF 		.ascii	"\376\335\315\377\376\334\314\377\376\334\314\377\376\334\313"
+ 1189      FEDCCCFF 
+ 1189      FEDCCCFF 
+ 1189      FEDCCB
+ 1190 29c3 FFFDDCCB 		.ascii	"\377\375\334\313\377\375\334\312\377\375\333\311\377\375\333"
+ 1190      FFFDDCCA 
+ 1190      FFFDDBC9 
+ 1190      FFFDDB
+ 1191 29d2 C9FFFDDB 		.ascii	"\311\377\375\333\310\377\375\333\307\377\375\333\307\377\374"
+ 1191      C8FFFDDB 
+ 1191      C7FFFDDB 
+ 1191      C7FFFC
+ 1192 29e1 DAC6FFFC 		.ascii	"\332\306\377\374\332\305\377\374\331\305\377\374\331\304\377"
+ 1192      DAC5FFFC 
+ 1192      D9C5FFFC 
+ 1192      D9C4FF
+ 1193 29f0 FCD8C3FF 		.ascii	"\374\330\303\377\374\330\302\377\374\327\302\377\374\327\301"
+ 1193      FCD8C2FF 
+ 1193      FCD7C2FF 
+ 1193      FCD7C1
+ 1194 29ff FFFCD6C0 		.ascii	"\377\374\326\300\377\374\326\300\377\374\325\277\377\374\325"
+ 1194      FFFCD6C0 
+ 1194      FFFCD5BF 
+ 1194      FFFCD5
+ 1195 2a0e BEFFFCD4 		.ascii	"\276\377\374\324\275\377\374\323\275\377\373\323\274\377\373"
+ 1195      BDFFFCD3 
+ 1195      BDFFFBD3 
+ 1195      BCFFFB
+ 1196 2a1d D2BBFFFB 		.ascii	"\322\273\377\373\322\272\377\373\321\272\377\373\321\271\377"
+ 1196      D2BAFFFB 
+ 1196      D1BAFFFB 
+ 1196      D1B9FF
+ 1197 2a2c FBD0B8FF 		.ascii	"\373\320\270\377\373\320\270\377\373\317\267\377\373\317\266"
+ 1197      FBD0B8FF 
+ 1197      FBCFB7FF 
+ 1197      FBCFB6
+ 1198 2a3b FFFBCEB6 		.ascii	"\377\373\316\266\377\373\316\265\377\373\315\264\377\373\315"
+ 1198      FFFBCEB5 
+ 1198      FFFBCDB4 
+ 1198      FFFBCD
+ 1199 2a4a B3FFFACC 		.ascii	"\263\377\372\314\263\377\372\314\262\377\372\313\261\377\372"
+ 1199      B3FFFACC 
+ 1199      B2FFFACB 
+ 1199      B1FFFA
+ 1200 2a59 CBB1FFFA 		.ascii	"\313\261\377\372\312\260\377\372\312\257\377\372\311\257\377"
+ 1200      CAB0FFFA 
+ 1200      CAAFFFFA 
+ 1200      C9AFFF
+ 1201 2a68 FAC9AEFF 		.ascii	"\372\311\256\377\372\310\255\377\372\310\254\377\372\307\254"
+ 1201      FAC8ADFF 
+ 1201      FAC8ACFF 
+GAS LISTING /tmp/ccoNxI3i.s 			page 49
+
+
+ 1201      FAC7AC
+ 1202 2a77 FFFAC6AB 		.ascii	"\377\372\306\253\377\371\306\252\377\371\305\252\377\371\305"
+ 1202      FFF9C6AA 
+ 1202      FFF9C5AA 
+ 1202      FFF9C5
+ 1203 2a86 A9FFF9C4 		.ascii	"\251\377\371\304\250\377\371\304\250\377\371\303\247\377\371"
+ 1203      A8FFF9C4 
+ 1203      A8FFF9C3 
+ 1203      A7FFF9
+ 1204 2a95 C3A6FFF9 		.ascii	"\303\246\377\371\302\246\377\371\302\245\377\371\301\244\377"
+ 1204      C2A6FFF9 
+ 1204      C2A5FFF9 
+ 1204      C1A4FF
+ 1205 2aa4 F9C1A4FF 		.ascii	"\371\301\244\377\371\300\243\377\370\300\242\377\370\277\242"
+ 1205      F9C0A3FF 
+ 1205      F8C0A2FF 
+ 1205      F8BFA2
+ 1206 2ab3 FFF8BFA1 		.ascii	"\377\370\277\241\377\370\276\240\377\370\276\240\377\370\275"
+ 1206      FFF8BEA0 
+ 1206      FFF8BEA0 
+ 1206      FFF8BD
+ 1207 2ac2 9FFFF8BC 		.ascii	"\237\377\370\274\236\377\370\274\236\377\370\273\235\377\370"
+ 1207      9EFFF8BC 
+ 1207      9EFFF8BB 
+ 1207      9DFFF8
+ 1208 2ad1 BB9CFFF8 		.ascii	"\273\234\377\370\272\234\377\367\272\233\377\367\271\232\377"
+ 1208      BA9CFFF7 
+ 1208      BA9BFFF7 
+ 1208      B99AFF
+ 1209 2ae0 F7B99AFF 		.ascii	"\367\271\232\377\367\270\231\377\367\270\230\377\367\267\230"
+ 1209      F7B899FF 
+ 1209      F7B898FF 
+ 1209      F7B798
+ 1210 2aef FFF7B797 		.ascii	"\377\367\267\227\377\367\266\226\377\367\266\226\377\367\265"
+ 1210      FFF7B696 
+ 1210      FFF7B696 
+ 1210      FFF7B5
+ 1211 2afe 95FFF7B5 		.ascii	"\225\377\367\265\224\377\366\264\224\377\366\263\223\377\366"
+ 1211      94FFF6B4 
+ 1211      94FFF6B3 
+ 1211      93FFF6
+ 1212 2b0d B392FFF6 		.ascii	"\263\222\377\366\262\222\377\366\262\221\377\366\261\220\377"
+ 1212      B292FFF6 
+ 1212      B291FFF6 
+ 1212      B190FF
+ 1213 2b1c F6B190FF 		.ascii	"\366\261\220\377\366\260\217\377\366\260\217\377\366\257\216"
+ 1213      F6B08FFF 
+ 1213      F6B08FFF 
+ 1213      F6AF8E
+ 1214 2b2b FFF5AF8D 		.ascii	"\377\365\257\215\377\365\256\215\377\365\256\214\377\365\255"
+ 1214      FFF5AE8D 
+ 1214      FFF5AE8C 
+ 1214      FFF5AD
+ 1215 2b3a 8BFFF5AD 		.ascii	"\213\377\365\255\213\377\365\254\212\377\365\253\211\377\365"
+ 1215      8BFFF5AC 
+ 1215      8AFFF5AB 
+ 1215      89FFF5
+GAS LISTING /tmp/ccoNxI3i.s 			page 50
+
+
+ 1216 2b49 AB89FFF5 		.ascii	"\253\211\377\365\252\210\377\365\252\210\377\364\251\207\377"
+ 1216      AA88FFF5 
+ 1216      AA88FFF4 
+ 1216      A987FF
+ 1217 2b58 F4A986FF 		.ascii	"\364\251\206\377\364\250\206\377\364\250\205\377\364\247\204"
+ 1217      F4A886FF 
+ 1217      F4A885FF 
+ 1217      F4A784
+ 1218 2b67 FFF4A784 		.ascii	"\377\364\247\204\377\364\246\203\377\364\245\203\377\364\245"
+ 1218      FFF4A683 
+ 1218      FFF4A583 
+ 1218      FFF4A5
+ 1219 2b76 82FFF3A4 		.ascii	"\202\377\363\244\201\377\363\244\201\377\363\243\200\377\363"
+ 1219      81FFF3A4 
+ 1219      81FFF3A3 
+ 1219      80FFF3
+ 1220 2b85 A280FFF2 		.ascii	"\242\200\377\362\242\177\377\362\241~\377\362\240~\377\361\240"
+ 1220      A27FFFF2 
+ 1220      A17EFFF2 
+ 1220      A07EFFF1 
+ 1220      A0
+ 1221 2b96 7DFFF19F 		.ascii	"}\377\361\237}\377\361\237|\377\361\236{\377\360\235{\377\360"
+ 1221      7DFFF19F 
+ 1221      7CFFF19E 
+ 1221      7BFFF09D 
+ 1221      7BFFF0
+ 1222 2ba9 9D7AFFF0 		.ascii	"\235z\377\360\234z\377\360\233y\377\357\233x\377\357\232x\377"
+ 1222      9C7AFFF0 
+ 1222      9B79FFEF 
+ 1222      9B78FFEF 
+ 1222      9A78FF
+ 1223 2bbc EF9977FF 		.ascii	"\357\231w\377\356\231w\377\356\230v\377\356\227v\377\356\227"
+ 1223      EE9977FF 
+ 1223      EE9876FF 
+ 1223      EE9776FF 
+ 1223      EE97
+ 1224 2bce 75FFED96 		.ascii	"u\377\355\226t\377\355\225t\377\355\225s\377\354\224s\377\354"
+ 1224      74FFED95 
+ 1224      74FFED95 
+ 1224      73FFEC94 
+ 1224      73FFEC
+ 1225 2be1 9372FFEC 		.ascii	"\223r\377\354\223r\377\354\222q\377\353\221q\377\353\221p\377"
+ 1225      9372FFEC 
+ 1225      9271FFEB 
+ 1225      9171FFEB 
+ 1225      9170FF
+ 1226 2bf4 EB906FFF 		.ascii	"\353\220o\377\352\217o\377\352\217n\377\352\216n\377\352\216"
+ 1226      EA8F6FFF 
+ 1226      EA8F6EFF 
+ 1226      EA8E6EFF 
+ 1226      EA8E
+ 1227 2c06 6DFFE98D 		.ascii	"m\377\351\215m\377\351\214l\377\351\214l\377\350\213k\377\350"
+ 1227      6DFFE98C 
+ 1227      6CFFE98C 
+ 1227      6CFFE88B 
+ 1227      6BFFE8
+ 1228 2c19 8A6AFFE8 		.ascii	"\212j\377\350\212j\377\350\211i\377\347\210i\377\347\210h\377"
+GAS LISTING /tmp/ccoNxI3i.s 			page 51
+
+
+ 1228      8A6AFFE8 
+ 1228      8969FFE7 
+ 1228      8869FFE7 
+ 1228      8868FF
+ 1229 2c2c E78768FF 		.ascii	"\347\207h\377\346\206g\377\346\206g\377\346\205f\377\346\204"
+ 1229      E68667FF 
+ 1229      E68667FF 
+ 1229      E68566FF 
+ 1229      E684
+ 1230 2c3e 66FFE584 		.ascii	"f\377\345\204e\377\345\203e\377\345\202d\377\344\202d\377\344"
+ 1230      65FFE583 
+ 1230      65FFE582 
+ 1230      64FFE482 
+ 1230      64FFE4
+ 1231 2c51 8163FFE4 		.ascii	"\201c\377\344\200c\377\343\200b\377\343\177b\377\343~a\377\343"
+ 1231      8063FFE3 
+ 1231      8062FFE3 
+ 1231      7F62FFE3 
+ 1231      7E61FFE3 
+ 1232 2c65 7E61FFE2 		.ascii	"~a\377\342}`\377\342|`\377\342{_\377\341{_\377\341z^\377\341"
+ 1232      7D60FFE2 
+ 1232      7C60FFE2 
+ 1232      7B5FFFE1 
+ 1232      7B5FFFE1 
+ 1233 2c7d 795EFFE1 		.ascii	"y^\377\341y]\377\340x]\377\340w\\\377\340w\\\377\337v[\377\337"
+ 1233      795DFFE0 
+ 1233      785DFFE0 
+ 1233      775CFFE0 
+ 1233      775CFFDF 
+ 1234 2c95 755BFFDF 		.ascii	"u[\377\337uZ\377\336tZ\377\336sY\377\336sY\377\336rX\377\335"
+ 1234      755AFFDE 
+ 1234      745AFFDE 
+ 1234      7359FFDE 
+ 1234      7359FFDE 
+ 1235 2cad 7158FFDD 		.ascii	"qX\377\335qW\377\335pW\377\334oV\377\334nV\377\334nU\377\333"
+ 1235      7157FFDD 
+ 1235      7057FFDC 
+ 1235      6F56FFDC 
+ 1235      6E56FFDC 
+ 1236 2cc5 6D55FFDB 		.ascii	"mU\377\333lU\377\333lT\377\333kT\377\332jS\377\332jS\377\332"
+ 1236      6C55FFDB 
+ 1236      6C54FFDB 
+ 1236      6B54FFDA 
+ 1236      6A53FFDA 
+ 1237 2cdd 6952FFD9 		.ascii	"iR\377\331hR\377\331gQ\377\331gQ\377\330fP\377\330eP\377\330"
+ 1237      6852FFD9 
+ 1237      6751FFD9 
+ 1237      6751FFD8 
+ 1237      6650FFD8 
+ 1238 2cf5 6550FFD7 		.ascii	"eP\377\327dO\377\327cO\377\327cN\377\326bN\377\326aM\377\326"
+ 1238      644FFFD7 
+ 1238      634FFFD7 
+ 1238      634EFFD6 
+ 1238      624EFFD6 
+ 1239 2d0d 604DFFD6 		.ascii	"`M\377\326`M\377\325_L\377\325^L\377\325^K\377\324]K\377\324"
+ 1239      604DFFD5 
+ 1239      5F4CFFD5 
+GAS LISTING /tmp/ccoNxI3i.s 			page 52
+
+
+ 1239      5E4CFFD5 
+ 1239      5E4BFFD4 
+ 1240 2d25 5D4BFFD4 		.ascii	"]K\377\324\\J\377\323\\J\377\323[J\377\322ZI\377\322ZI\377\322"
+ 1240      5C4AFFD3 
+ 1240      5C4AFFD3 
+ 1240      5B4AFFD2 
+ 1240      5A49FFD2 
+ 1241 2d3d 5948FFD1 		.ascii	"YH\377\321YH\377\321XH\377\321WG\377\320WG\377\320VG\377\320"
+ 1241      5948FFD1 
+ 1241      5848FFD1 
+ 1241      5747FFD0 
+ 1241      5747FFD0 
+ 1242 2d55 5646FFCF 		.ascii	"VF\377\317UF\377\317UF\377\317TE\377\316SE\377\316SD\377\316"
+ 1242      5546FFCF 
+ 1242      5546FFCF 
+ 1242      5445FFCE 
+ 1242      5345FFCE 
+ 1243 2d6d 5244FFCD 		.ascii	"RD\377\315RD\377\315QC\377\315PC\377\314PC\377\314OB\377\314"
+ 1243      5244FFCD 
+ 1243      5143FFCD 
+ 1243      5043FFCC 
+ 1243      5043FFCC 
+ 1244 2d85 4F42FFCB 		.ascii	"OB\377\313NB\377\313MA\377\313MA\377\312LA\377\312L@\377\312"
+ 1244      4E42FFCB 
+ 1244      4D41FFCB 
+ 1244      4D41FFCA 
+ 1244      4C41FFCA 
+ 1245 2d9d 4B40FFC9 		.ascii	"K@\377\311J@\377\311J?\377\310I?\377\310H?\377\310H>\377\307"
+ 1245      4A40FFC9 
+ 1245      4A3FFFC8 
+ 1245      493FFFC8 
+ 1245      483FFFC8 
+ 1246 2db5 473EFFC7 		.ascii	"G>\377\307G=\377\307F=\377\306E=\377\306E<\377\306D<\377\305"
+ 1246      473DFFC7 
+ 1246      463DFFC6 
+ 1246      453DFFC6 
+ 1246      453CFFC6 
+ 1247 2dcd 433CFFC5 		.ascii	"C<\377\305C;\377\305B;\377\304B;\377\304A:\377\304@:\377\303"
+ 1247      433BFFC5 
+ 1247      423BFFC4 
+ 1247      423BFFC4 
+ 1247      413AFFC4 
+ 1248 2de5 403AFFC3 		.ascii	"@:\377\303?9\377\303>9\377\302>9\377\302=8\377\301<8\377\301"
+ 1248      3F39FFC3 
+ 1248      3E39FFC2 
+ 1248      3E39FFC2 
+ 1248      3D38FFC1 
+ 1249 2dfd 3C38FFC1 		.ascii	"<8\377\301;7\377\300:7\377\300:7\377\30097\377\27786\377\277"
+ 1249      3B37FFC0 
+ 1249      3A37FFC0 
+ 1249      3A37FFC0 
+ 1249      3937FFBF 
+ 1250 2e15 3736FFBF 		.ascii	"76\377\27776\377\27665\377\27655\377\27655\377\27544\377\275"
+ 1250      3736FFBE 
+ 1250      3635FFBE 
+ 1250      3535FFBE 
+ 1250      3535FFBD 
+GAS LISTING /tmp/ccoNxI3i.s 			page 53
+
+
+ 1251 2e2d 3334FFBD 		.ascii	"34\377\27534\377\27423\377\27413\377\27303\377\27302\377\273"
+ 1251      3334FFBC 
+ 1251      3233FFBC 
+ 1251      3133FFBB 
+ 1251      3033FFBB 
+ 1252 2e45 2F32FFBA 		.ascii	"/2\377\272.2\377\272-1\377\272,1\377\271,1\377\271+1\377\271"
+ 1252      2E32FFBA 
+ 1252      2D31FFBA 
+ 1252      2C31FFB9 
+ 1252      2C31FFB9 
+ 1253 2e5d 2A30FFB8 		.ascii	"*0\377\270)0\377\270(0\377\270(/\377\267'/\377\267&/\377\266"
+ 1253      2930FFB8 
+ 1253      2830FFB8 
+ 1253      282FFFB7 
+ 1253      272FFFB7 
+ 1254 2e75 252EFFB6 		.ascii	"%.\377\266$.\377\266#.\377\265\".\377\265!-\377\265!-\377\264"
+ 1254      242EFFB6 
+ 1254      232EFFB5 
+ 1254      222EFFB5 
+ 1254      212DFFB5 
+ 1255 2e8d 202DFFB4 		.ascii	" -\377\264\037,\377\264\036,\377\263\035,\377\263\034,\377\262"
+ 1255      1F2CFFB4 
+ 1255      1E2CFFB3 
+ 1255      1D2CFFB3 
+ 1255      1C2CFFB2 
+ 1256 2ea1 1A2BFFB2 		.ascii	"\032+\377\262\031+\377\262\030+\377\261\027*\377\260\027*\377"
+ 1256      192BFFB2 
+ 1256      182BFFB1 
+ 1256      172AFFB0 
+ 1256      172AFF
+ 1257 2eb4 B0172AFF 		.ascii	"\260\027*\377\257\026*\377\256\026*\377\256\026*\377\255\025"
+ 1257      AF162AFF 
+ 1257      AE162AFF 
+ 1257      AE162AFF 
+ 1257      AD15
+ 1258 2ec6 2AFFAC15 		.ascii	"*\377\254\025*\377\253\025*\377\253\024*\377\252\024*\377\251"
+ 1258      2AFFAB15 
+ 1258      2AFFAB14 
+ 1258      2AFFAA14 
+ 1258      2AFFA9
+ 1259 2ed9 142AFFA8 		.ascii	"\024*\377\250\023*\377\250\023*\377\247\023*\377\246\022)\377"
+ 1259      132AFFA8 
+ 1259      132AFFA7 
+ 1259      132AFFA6 
+ 1259      1229FF
+ 1260 2eec A51229FF 		.ascii	"\245\022)\377\245\022)\377\244\021)\377\243\021)\377\242\021"
+ 1260      A51229FF 
+ 1260      A41129FF 
+ 1260      A31129FF 
+ 1260      A211
+ 1261 2efe 29FFA210 		.ascii	")\377\242\020)\377\241\020)\377\240\020)\377\237\017)\377\237"
+ 1261      29FFA110 
+ 1261      29FFA010 
+ 1261      29FF9F0F 
+ 1261      29FF9F
+ 1262 2f11 0F29FF9E 		.ascii	"\017)\377\236\017)\377\235\016(\377\234\016(\377\234\016(\377"
+ 1262      0F29FF9D 
+GAS LISTING /tmp/ccoNxI3i.s 			page 54
+
+
+ 1262      0E28FF9C 
+ 1262      0E28FF9C 
+ 1262      0E28FF
+ 1263 2f24 9B0E28FF 		.ascii	"\233\016(\377\232\r(\377\232\r(\377\231\r(\377\230\f(\377\227"
+ 1263      9A0D28FF 
+ 1263      9A0D28FF 
+ 1263      990D28FF 
+ 1263      980C28FF 
+ 1264 2f39 0C28FF97 		.ascii	"\f(\377\227\f(\377\226\013(\377\225\013'\377\224\013'\377\224"
+ 1264      0C28FF96 
+ 1264      0B28FF95 
+ 1264      0B27FF94 
+ 1264      0B27FF94 
+ 1265 2f4d 0A27FF93 		.ascii	"\n'\377\223\n'\377\222\n'\377\221\n'\377\221\t'\377\220\t'\377"
+ 1265      0A27FF92 
+ 1265      0A27FF91 
+ 1265      0A27FF91 
+ 1265      0927FF90 
+ 1266 2f64 8F0927FF 		.ascii	"\217\t'\377\216\b&\377\216\b&\377\215\b&\377\214\b&\377\214\007"
+ 1266      8E0826FF 
+ 1266      8E0826FF 
+ 1266      8D0826FF 
+ 1266      8C0826FF 
+ 1267 2f7a 26FF8B07 		.ascii	"&\377\213\007&\377\212\007&\377\211\006&\377\211\006%\377\210"
+ 1267      26FF8A07 
+ 1267      26FF8906 
+ 1267      26FF8906 
+ 1267      25FF88
+ 1268 2f8d 0625FF87 		.ascii	"\006%\377\207\006%\377\206\006%\377\206\005%\377\205\005%\377"
+ 1268      0625FF86 
+ 1268      0625FF86 
+ 1268      0525FF85 
+ 1268      0525FF
+ 1269 2fa0 840525FF 		.ascii	"\204\005%\377\203\005%\377\203\004$\377\202\004$\377\201\004"
+ 1269      830525FF 
+ 1269      830424FF 
+ 1269      820424FF 
+ 1269      8104
+ 1270 2fb2 24FF8104 		.ascii	"$\377\201\004$\377\200\004$\377\177\004$\377~\003$\377~\003$"
+ 1270      24FF8004 
+ 1270      24FF7F04 
+ 1270      24FF7E03 
+ 1270      24FF7E03 
+ 1271 2fc7 FF7D0323 		.ascii	"\377}\003#\377|\003#\377{\003#\377{\003#\377z\002#\377y\002#"
+ 1271      FF7C0323 
+ 1271      FF7B0323 
+ 1271      FF7B0323 
+ 1271      FF7A0223 
+ 1272 2fdf FF       		.ascii	"\377"
+ 1273 2fe0 790223FF 		.string	"y\002#\377x\002\"\377w\002\"\377v\002\"\377v\002\"\377u\001\"\377t\001\"\377s\001!\377s\0
+ 1273      780222FF 
+ 1273      770222FF 
+ 1273      760222FF 
+ 1273      760222FF 
+ 1274 301a 20FF6E00 		.string	" \377n"
+ 1275 301e 20FF6D00 		.string	" \377m"
+ 1276 3022 20FF6C00 		.string	" \377l"
+GAS LISTING /tmp/ccoNxI3i.s 			page 55
+
+
+ 1277 3026 20FF6C00 		.string	" \377l"
+ 1278 302a 20FF6B00 		.string	" \377k"
+ 1279 302e 20FF6A00 		.string	" \377j"
+ 1280 3032 1FFF6900 		.string	"\037\377i"
+ 1281 3036 1FFF6900 		.string	"\037\377i"
+ 1282 303a 1FFF6800 		.string	"\037\377h"
+ 1283 303e 1FFF6700 		.string	"\037\377g"
+ 1284 3042 1FFF     		.ascii	"\037\377"
+ 1285              		.globl	heatmap_cs_RdBu_discrete
+ 1286              		.section	.data.rel.local
+ 1287              		.align 8
+ 1288              		.type	heatmap_cs_RdBu_discrete, @object
+ 1289              		.size	heatmap_cs_RdBu_discrete, 8
+ 1290              	heatmap_cs_RdBu_discrete:
+ 1291 0018 00000000 		.quad	discrete
+ 1291      00000000 
+ 1292              		.section	.data.rel.ro.local
+ 1293              		.align 16
+ 1294              		.type	discrete, @object
+ 1295              		.size	discrete, 16
+ 1296              	discrete:
+ 1297 0030 00000000 		.quad	discrete_data
+ 1297      00000000 
+ 1298 0038 0C000000 		.quad	12
+ 1298      00000000 
+ 1299              		.section	.rodata
+ 1300 3044 00000000 		.align 32
+ 1300      00000000 
+ 1300      00000000 
+ 1300      00000000 
+ 1300      00000000 
+ 1301              		.type	discrete_data, @object
+ 1302              		.size	discrete_data, 48
+ 1303              	discrete_data:
+ 1304 3060 00       		.string	""
+ 1305 3061 00       		.string	""
+ 1306 3062 00       		.string	""
+ 1307 3063 00       		.string	""
+ 1308 3064 053061FF 		.string	"\0050a\377!f\254\377C\223\303\377\222\305\336\377\321\345\360\377\367\367\367\377\375\333
+ 1308      2166ACFF 
+ 1308      4393C3FF 
+ 1308      92C5DEFF 
+ 1308      D1E5F0FF 
+ 1309 308e 1FFF     		.ascii	"\037\377"
+ 1310              		.text
+ 1311              	.Letext0:
+ 1312              		.file 1 "./heatmap.h"
+ 1313              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1314              		.file 3 "./colorschemes/RdBu.h"
+ 1315              		.file 4 "colorschemes/RdBu.c"
+ 1316              		.section	.debug_info,"",@progbits
+ 1317              	.Ldebug_info0:
+ 1318 0000 E3010000 		.long	0x1e3
+ 1319 0004 0500     		.value	0x5
+ 1320 0006 01       		.byte	0x1
+ 1321 0007 08       		.byte	0x8
+ 1322 0008 00000000 		.long	.Ldebug_abbrev0
+GAS LISTING /tmp/ccoNxI3i.s 			page 56
+
+
+ 1323 000c 0A       		.uleb128 0xa
+ 1324 000d 00000000 		.long	.LASF26
+ 1325 0011 1D       		.byte	0x1d
+ 1326 0012 00000000 		.long	.LASF0
+ 1327 0016 00000000 		.long	.LASF1
+ 1328 001a 00000000 		.long	.Ldebug_line0
+ 1329 001e 01       		.uleb128 0x1
+ 1330 001f 08       		.byte	0x8
+ 1331 0020 05       		.byte	0x5
+ 1332 0021 00000000 		.long	.LASF2
+ 1333 0025 06       		.uleb128 0x6
+ 1334 0026 00000000 		.long	.LASF12
+ 1335 002a 02       		.byte	0x2
+ 1336 002b D6       		.byte	0xd6
+ 1337 002c 17       		.byte	0x17
+ 1338 002d 31000000 		.long	0x31
+ 1339 0031 01       		.uleb128 0x1
+ 1340 0032 08       		.byte	0x8
+ 1341 0033 07       		.byte	0x7
+ 1342 0034 00000000 		.long	.LASF3
+ 1343 0038 0B       		.uleb128 0xb
+ 1344 0039 04       		.byte	0x4
+ 1345 003a 05       		.byte	0x5
+ 1346 003b 696E7400 		.string	"int"
+ 1347 003f 01       		.uleb128 0x1
+ 1348 0040 08       		.byte	0x8
+ 1349 0041 05       		.byte	0x5
+ 1350 0042 00000000 		.long	.LASF4
+ 1351 0046 01       		.uleb128 0x1
+ 1352 0047 10       		.byte	0x10
+ 1353 0048 04       		.byte	0x4
+ 1354 0049 00000000 		.long	.LASF5
+ 1355 004d 01       		.uleb128 0x1
+ 1356 004e 04       		.byte	0x4
+ 1357 004f 04       		.byte	0x4
+ 1358 0050 00000000 		.long	.LASF6
+ 1359 0054 01       		.uleb128 0x1
+ 1360 0055 04       		.byte	0x4
+ 1361 0056 07       		.byte	0x7
+ 1362 0057 00000000 		.long	.LASF7
+ 1363 005b 01       		.uleb128 0x1
+ 1364 005c 02       		.byte	0x2
+ 1365 005d 07       		.byte	0x7
+ 1366 005e 00000000 		.long	.LASF8
+ 1367 0062 0C       		.uleb128 0xc
+ 1368 0063 10       		.byte	0x10
+ 1369 0064 01       		.byte	0x1
+ 1370 0065 BB       		.byte	0xbb
+ 1371 0066 09       		.byte	0x9
+ 1372 0067 84000000 		.long	0x84
+ 1373 006b 07       		.uleb128 0x7
+ 1374 006c 00000000 		.long	.LASF9
+ 1375 0070 BC       		.byte	0xbc
+ 1376 0071 1A       		.byte	0x1a
+ 1377 0072 84000000 		.long	0x84
+ 1378 0076 00       		.byte	0
+ 1379 0077 07       		.uleb128 0x7
+GAS LISTING /tmp/ccoNxI3i.s 			page 57
+
+
+ 1380 0078 00000000 		.long	.LASF10
+ 1381 007c BD       		.byte	0xbd
+ 1382 007d 0C       		.byte	0xc
+ 1383 007e 25000000 		.long	0x25
+ 1384 0082 08       		.byte	0x8
+ 1385 0083 00       		.byte	0
+ 1386 0084 08       		.uleb128 0x8
+ 1387 0085 90000000 		.long	0x90
+ 1388 0089 01       		.uleb128 0x1
+ 1389 008a 01       		.byte	0x1
+ 1390 008b 08       		.byte	0x8
+ 1391 008c 00000000 		.long	.LASF11
+ 1392 0090 03       		.uleb128 0x3
+ 1393 0091 89000000 		.long	0x89
+ 1394 0095 06       		.uleb128 0x6
+ 1395 0096 00000000 		.long	.LASF13
+ 1396 009a 01       		.byte	0x1
+ 1397 009b BE       		.byte	0xbe
+ 1398 009c 03       		.byte	0x3
+ 1399 009d 62000000 		.long	0x62
+ 1400 00a1 03       		.uleb128 0x3
+ 1401 00a2 95000000 		.long	0x95
+ 1402 00a6 08       		.uleb128 0x8
+ 1403 00a7 A1000000 		.long	0xa1
+ 1404 00ab 04       		.uleb128 0x4
+ 1405 00ac 00000000 		.long	.LASF14
+ 1406 00b0 21       		.byte	0x21
+ 1407 00b1 A6000000 		.long	0xa6
+ 1408 00b5 04       		.uleb128 0x4
+ 1409 00b6 00000000 		.long	.LASF15
+ 1410 00ba 23       		.byte	0x23
+ 1411 00bb A6000000 		.long	0xa6
+ 1412 00bf 04       		.uleb128 0x4
+ 1413 00c0 00000000 		.long	.LASF16
+ 1414 00c4 25       		.byte	0x25
+ 1415 00c5 A6000000 		.long	0xa6
+ 1416 00c9 04       		.uleb128 0x4
+ 1417 00ca 00000000 		.long	.LASF17
+ 1418 00ce 28       		.byte	0x28
+ 1419 00cf A6000000 		.long	0xa6
+ 1420 00d3 09       		.uleb128 0x9
+ 1421 00d4 90000000 		.long	0x90
+ 1422 00d8 E3000000 		.long	0xe3
+ 1423 00dc 0D       		.uleb128 0xd
+ 1424 00dd 31000000 		.long	0x31
+ 1425 00e1 2F       		.byte	0x2f
+ 1426 00e2 00       		.byte	0
+ 1427 00e3 03       		.uleb128 0x3
+ 1428 00e4 D3000000 		.long	0xd3
+ 1429 00e8 02       		.uleb128 0x2
+ 1430 00e9 00000000 		.long	.LASF18
+ 1431 00ed 20       		.byte	0x20
+ 1432 00ee 1C       		.byte	0x1c
+ 1433 00ef E3000000 		.long	0xe3
+ 1434 00f3 09       		.uleb128 0x9
+ 1435 00f4 03       		.byte	0x3
+ 1436 00f5 00000000 		.quad	discrete_data
+GAS LISTING /tmp/ccoNxI3i.s 			page 58
+
+
+ 1436      00000000 
+ 1437 00fd 02       		.uleb128 0x2
+ 1438 00fe 00000000 		.long	.LASF19
+ 1439 0102 23       		.byte	0x23
+ 1440 0103 24       		.byte	0x24
+ 1441 0104 A1000000 		.long	0xa1
+ 1442 0108 09       		.uleb128 0x9
+ 1443 0109 03       		.byte	0x3
+ 1444 010a 00000000 		.quad	discrete
+ 1444      00000000 
+ 1445 0112 05       		.uleb128 0x5
+ 1446 0113 AB000000 		.long	0xab
+ 1447 0117 24       		.byte	0x24
+ 1448 0118 09       		.uleb128 0x9
+ 1449 0119 03       		.byte	0x3
+ 1450 011a 00000000 		.quad	heatmap_cs_RdBu_discrete
+ 1450      00000000 
+ 1451 0122 09       		.uleb128 0x9
+ 1452 0123 90000000 		.long	0x90
+ 1453 0127 33010000 		.long	0x133
+ 1454 012b 0E       		.uleb128 0xe
+ 1455 012c 31000000 		.long	0x31
+ 1456 0130 0310     		.value	0x1003
+ 1457 0132 00       		.byte	0
+ 1458 0133 03       		.uleb128 0x3
+ 1459 0134 22010000 		.long	0x122
+ 1460 0138 02       		.uleb128 0x2
+ 1461 0139 00000000 		.long	.LASF20
+ 1462 013d 26       		.byte	0x26
+ 1463 013e 1C       		.byte	0x1c
+ 1464 013f 33010000 		.long	0x133
+ 1465 0143 09       		.uleb128 0x9
+ 1466 0144 03       		.byte	0x3
+ 1467 0145 00000000 		.quad	soft_data
+ 1467      00000000 
+ 1468 014d 02       		.uleb128 0x2
+ 1469 014e 00000000 		.long	.LASF21
+ 1470 0152 29       		.byte	0x29
+ 1471 0153 24       		.byte	0x24
+ 1472 0154 A1000000 		.long	0xa1
+ 1473 0158 09       		.uleb128 0x9
+ 1474 0159 03       		.byte	0x3
+ 1475 015a 00000000 		.quad	soft
+ 1475      00000000 
+ 1476 0162 05       		.uleb128 0x5
+ 1477 0163 B5000000 		.long	0xb5
+ 1478 0167 2A       		.byte	0x2a
+ 1479 0168 09       		.uleb128 0x9
+ 1480 0169 03       		.byte	0x3
+ 1481 016a 00000000 		.quad	heatmap_cs_RdBu_soft
+ 1481      00000000 
+ 1482 0172 02       		.uleb128 0x2
+ 1483 0173 00000000 		.long	.LASF22
+ 1484 0177 2C       		.byte	0x2c
+ 1485 0178 1C       		.byte	0x1c
+ 1486 0179 33010000 		.long	0x133
+ 1487 017d 09       		.uleb128 0x9
+GAS LISTING /tmp/ccoNxI3i.s 			page 59
+
+
+ 1488 017e 03       		.byte	0x3
+ 1489 017f 00000000 		.quad	mixed_data
+ 1489      00000000 
+ 1490 0187 02       		.uleb128 0x2
+ 1491 0188 00000000 		.long	.LASF23
+ 1492 018c 2F       		.byte	0x2f
+ 1493 018d 24       		.byte	0x24
+ 1494 018e A1000000 		.long	0xa1
+ 1495 0192 09       		.uleb128 0x9
+ 1496 0193 03       		.byte	0x3
+ 1497 0194 00000000 		.quad	mixed
+ 1497      00000000 
+ 1498 019c 05       		.uleb128 0x5
+ 1499 019d BF000000 		.long	0xbf
+ 1500 01a1 30       		.byte	0x30
+ 1501 01a2 09       		.uleb128 0x9
+ 1502 01a3 03       		.byte	0x3
+ 1503 01a4 00000000 		.quad	heatmap_cs_RdBu_mixed
+ 1503      00000000 
+ 1504 01ac 02       		.uleb128 0x2
+ 1505 01ad 00000000 		.long	.LASF24
+ 1506 01b1 32       		.byte	0x32
+ 1507 01b2 1C       		.byte	0x1c
+ 1508 01b3 33010000 		.long	0x133
+ 1509 01b7 09       		.uleb128 0x9
+ 1510 01b8 03       		.byte	0x3
+ 1511 01b9 00000000 		.quad	mixed_exp_data
+ 1511      00000000 
+ 1512 01c1 02       		.uleb128 0x2
+ 1513 01c2 00000000 		.long	.LASF25
+ 1514 01c6 35       		.byte	0x35
+ 1515 01c7 24       		.byte	0x24
+ 1516 01c8 A1000000 		.long	0xa1
+ 1517 01cc 09       		.uleb128 0x9
+ 1518 01cd 03       		.byte	0x3
+ 1519 01ce 00000000 		.quad	mixed_exp
+ 1519      00000000 
+ 1520 01d6 05       		.uleb128 0x5
+ 1521 01d7 C9000000 		.long	0xc9
+ 1522 01db 36       		.byte	0x36
+ 1523 01dc 09       		.uleb128 0x9
+ 1524 01dd 03       		.byte	0x3
+ 1525 01de 00000000 		.quad	heatmap_cs_RdBu_mixed_exp
+ 1525      00000000 
+ 1526 01e6 00       		.byte	0
+ 1527              		.section	.debug_abbrev,"",@progbits
+ 1528              	.Ldebug_abbrev0:
+ 1529 0000 01       		.uleb128 0x1
+ 1530 0001 24       		.uleb128 0x24
+ 1531 0002 00       		.byte	0
+ 1532 0003 0B       		.uleb128 0xb
+ 1533 0004 0B       		.uleb128 0xb
+ 1534 0005 3E       		.uleb128 0x3e
+ 1535 0006 0B       		.uleb128 0xb
+ 1536 0007 03       		.uleb128 0x3
+ 1537 0008 0E       		.uleb128 0xe
+ 1538 0009 00       		.byte	0
+GAS LISTING /tmp/ccoNxI3i.s 			page 60
+
+
+ 1539 000a 00       		.byte	0
+ 1540 000b 02       		.uleb128 0x2
+ 1541 000c 34       		.uleb128 0x34
+ 1542 000d 00       		.byte	0
+ 1543 000e 03       		.uleb128 0x3
+ 1544 000f 0E       		.uleb128 0xe
+ 1545 0010 3A       		.uleb128 0x3a
+ 1546 0011 21       		.uleb128 0x21
+ 1547 0012 04       		.sleb128 4
+ 1548 0013 3B       		.uleb128 0x3b
+ 1549 0014 0B       		.uleb128 0xb
+ 1550 0015 39       		.uleb128 0x39
+ 1551 0016 0B       		.uleb128 0xb
+ 1552 0017 49       		.uleb128 0x49
+ 1553 0018 13       		.uleb128 0x13
+ 1554 0019 02       		.uleb128 0x2
+ 1555 001a 18       		.uleb128 0x18
+ 1556 001b 00       		.byte	0
+ 1557 001c 00       		.byte	0
+ 1558 001d 03       		.uleb128 0x3
+ 1559 001e 26       		.uleb128 0x26
+ 1560 001f 00       		.byte	0
+ 1561 0020 49       		.uleb128 0x49
+ 1562 0021 13       		.uleb128 0x13
+ 1563 0022 00       		.byte	0
+ 1564 0023 00       		.byte	0
+ 1565 0024 04       		.uleb128 0x4
+ 1566 0025 34       		.uleb128 0x34
+ 1567 0026 00       		.byte	0
+ 1568 0027 03       		.uleb128 0x3
+ 1569 0028 0E       		.uleb128 0xe
+ 1570 0029 3A       		.uleb128 0x3a
+ 1571 002a 21       		.uleb128 0x21
+ 1572 002b 03       		.sleb128 3
+ 1573 002c 3B       		.uleb128 0x3b
+ 1574 002d 0B       		.uleb128 0xb
+ 1575 002e 39       		.uleb128 0x39
+ 1576 002f 21       		.uleb128 0x21
+ 1577 0030 25       		.sleb128 37
+ 1578 0031 49       		.uleb128 0x49
+ 1579 0032 13       		.uleb128 0x13
+ 1580 0033 3F       		.uleb128 0x3f
+ 1581 0034 19       		.uleb128 0x19
+ 1582 0035 3C       		.uleb128 0x3c
+ 1583 0036 19       		.uleb128 0x19
+ 1584 0037 00       		.byte	0
+ 1585 0038 00       		.byte	0
+ 1586 0039 05       		.uleb128 0x5
+ 1587 003a 34       		.uleb128 0x34
+ 1588 003b 00       		.byte	0
+ 1589 003c 47       		.uleb128 0x47
+ 1590 003d 13       		.uleb128 0x13
+ 1591 003e 3A       		.uleb128 0x3a
+ 1592 003f 21       		.uleb128 0x21
+ 1593 0040 04       		.sleb128 4
+ 1594 0041 3B       		.uleb128 0x3b
+ 1595 0042 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccoNxI3i.s 			page 61
+
+
+ 1596 0043 39       		.uleb128 0x39
+ 1597 0044 21       		.uleb128 0x21
+ 1598 0045 1E       		.sleb128 30
+ 1599 0046 02       		.uleb128 0x2
+ 1600 0047 18       		.uleb128 0x18
+ 1601 0048 00       		.byte	0
+ 1602 0049 00       		.byte	0
+ 1603 004a 06       		.uleb128 0x6
+ 1604 004b 16       		.uleb128 0x16
+ 1605 004c 00       		.byte	0
+ 1606 004d 03       		.uleb128 0x3
+ 1607 004e 0E       		.uleb128 0xe
+ 1608 004f 3A       		.uleb128 0x3a
+ 1609 0050 0B       		.uleb128 0xb
+ 1610 0051 3B       		.uleb128 0x3b
+ 1611 0052 0B       		.uleb128 0xb
+ 1612 0053 39       		.uleb128 0x39
+ 1613 0054 0B       		.uleb128 0xb
+ 1614 0055 49       		.uleb128 0x49
+ 1615 0056 13       		.uleb128 0x13
+ 1616 0057 00       		.byte	0
+ 1617 0058 00       		.byte	0
+ 1618 0059 07       		.uleb128 0x7
+ 1619 005a 0D       		.uleb128 0xd
+ 1620 005b 00       		.byte	0
+ 1621 005c 03       		.uleb128 0x3
+ 1622 005d 0E       		.uleb128 0xe
+ 1623 005e 3A       		.uleb128 0x3a
+ 1624 005f 21       		.uleb128 0x21
+ 1625 0060 01       		.sleb128 1
+ 1626 0061 3B       		.uleb128 0x3b
+ 1627 0062 0B       		.uleb128 0xb
+ 1628 0063 39       		.uleb128 0x39
+ 1629 0064 0B       		.uleb128 0xb
+ 1630 0065 49       		.uleb128 0x49
+ 1631 0066 13       		.uleb128 0x13
+ 1632 0067 38       		.uleb128 0x38
+ 1633 0068 0B       		.uleb128 0xb
+ 1634 0069 00       		.byte	0
+ 1635 006a 00       		.byte	0
+ 1636 006b 08       		.uleb128 0x8
+ 1637 006c 0F       		.uleb128 0xf
+ 1638 006d 00       		.byte	0
+ 1639 006e 0B       		.uleb128 0xb
+ 1640 006f 21       		.uleb128 0x21
+ 1641 0070 08       		.sleb128 8
+ 1642 0071 49       		.uleb128 0x49
+ 1643 0072 13       		.uleb128 0x13
+ 1644 0073 00       		.byte	0
+ 1645 0074 00       		.byte	0
+ 1646 0075 09       		.uleb128 0x9
+ 1647 0076 01       		.uleb128 0x1
+ 1648 0077 01       		.byte	0x1
+ 1649 0078 49       		.uleb128 0x49
+ 1650 0079 13       		.uleb128 0x13
+ 1651 007a 01       		.uleb128 0x1
+ 1652 007b 13       		.uleb128 0x13
+GAS LISTING /tmp/ccoNxI3i.s 			page 62
+
+
+ 1653 007c 00       		.byte	0
+ 1654 007d 00       		.byte	0
+ 1655 007e 0A       		.uleb128 0xa
+ 1656 007f 11       		.uleb128 0x11
+ 1657 0080 01       		.byte	0x1
+ 1658 0081 25       		.uleb128 0x25
+ 1659 0082 0E       		.uleb128 0xe
+ 1660 0083 13       		.uleb128 0x13
+ 1661 0084 0B       		.uleb128 0xb
+ 1662 0085 03       		.uleb128 0x3
+ 1663 0086 1F       		.uleb128 0x1f
+ 1664 0087 1B       		.uleb128 0x1b
+ 1665 0088 1F       		.uleb128 0x1f
+ 1666 0089 10       		.uleb128 0x10
+ 1667 008a 17       		.uleb128 0x17
+ 1668 008b 00       		.byte	0
+ 1669 008c 00       		.byte	0
+ 1670 008d 0B       		.uleb128 0xb
+ 1671 008e 24       		.uleb128 0x24
+ 1672 008f 00       		.byte	0
+ 1673 0090 0B       		.uleb128 0xb
+ 1674 0091 0B       		.uleb128 0xb
+ 1675 0092 3E       		.uleb128 0x3e
+ 1676 0093 0B       		.uleb128 0xb
+ 1677 0094 03       		.uleb128 0x3
+ 1678 0095 08       		.uleb128 0x8
+ 1679 0096 00       		.byte	0
+ 1680 0097 00       		.byte	0
+ 1681 0098 0C       		.uleb128 0xc
+ 1682 0099 13       		.uleb128 0x13
+ 1683 009a 01       		.byte	0x1
+ 1684 009b 0B       		.uleb128 0xb
+ 1685 009c 0B       		.uleb128 0xb
+ 1686 009d 3A       		.uleb128 0x3a
+ 1687 009e 0B       		.uleb128 0xb
+ 1688 009f 3B       		.uleb128 0x3b
+ 1689 00a0 0B       		.uleb128 0xb
+ 1690 00a1 39       		.uleb128 0x39
+ 1691 00a2 0B       		.uleb128 0xb
+ 1692 00a3 01       		.uleb128 0x1
+ 1693 00a4 13       		.uleb128 0x13
+ 1694 00a5 00       		.byte	0
+ 1695 00a6 00       		.byte	0
+ 1696 00a7 0D       		.uleb128 0xd
+ 1697 00a8 21       		.uleb128 0x21
+ 1698 00a9 00       		.byte	0
+ 1699 00aa 49       		.uleb128 0x49
+ 1700 00ab 13       		.uleb128 0x13
+ 1701 00ac 2F       		.uleb128 0x2f
+ 1702 00ad 0B       		.uleb128 0xb
+ 1703 00ae 00       		.byte	0
+ 1704 00af 00       		.byte	0
+ 1705 00b0 0E       		.uleb128 0xe
+ 1706 00b1 21       		.uleb128 0x21
+ 1707 00b2 00       		.byte	0
+ 1708 00b3 49       		.uleb128 0x49
+ 1709 00b4 13       		.uleb128 0x13
+GAS LISTING /tmp/ccoNxI3i.s 			page 63
+
+
+ 1710 00b5 2F       		.uleb128 0x2f
+ 1711 00b6 05       		.uleb128 0x5
+ 1712 00b7 00       		.byte	0
+ 1713 00b8 00       		.byte	0
+ 1714 00b9 00       		.byte	0
+ 1715              		.section	.debug_aranges,"",@progbits
+ 1716 0000 1C000000 		.long	0x1c
+ 1717 0004 0200     		.value	0x2
+ 1718 0006 00000000 		.long	.Ldebug_info0
+ 1719 000a 08       		.byte	0x8
+ 1720 000b 00       		.byte	0
+ 1721 000c 0000     		.value	0
+ 1722 000e 0000     		.value	0
+ 1723 0010 00000000 		.quad	0
+ 1723      00000000 
+ 1724 0018 00000000 		.quad	0
+ 1724      00000000 
+ 1725              		.section	.debug_line,"",@progbits
+ 1726              	.Ldebug_line0:
+ 1727 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1727      05000800 
+ 1727      49000000 
+ 1727      010101FB 
+ 1727      0E0D0001 
+ 1728              	.LASF17:
+ 1729 0000 68656174 		.string	"heatmap_cs_RdBu_mixed_exp"
+ 1729      6D61705F 
+ 1729      63735F52 
+ 1729      6442755F 
+ 1729      6D697865 
+ 1730              	.LASF20:
+ 1731 001a 736F6674 		.string	"soft_data"
+ 1731      5F646174 
+ 1731      6100
+ 1732              	.LASF12:
+ 1733 0024 73697A65 		.string	"size_t"
+ 1733      5F7400
+ 1734              	.LASF13:
+ 1735 002b 68656174 		.string	"heatmap_colorscheme_t"
+ 1735      6D61705F 
+ 1735      636F6C6F 
+ 1735      72736368 
+ 1735      656D655F 
+ 1736              	.LASF16:
+ 1737 0041 68656174 		.string	"heatmap_cs_RdBu_mixed"
+ 1737      6D61705F 
+ 1737      63735F52 
+ 1737      6442755F 
+ 1737      6D697865 
+ 1738              	.LASF26:
+ 1739 0057 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1739      43313720 
+ 1739      31322E32 
+ 1739      2E30202D 
+ 1739      6D74756E 
+ 1740              	.LASF6:
+ 1741 00b6 666C6F61 		.string	"float"
+GAS LISTING /tmp/ccoNxI3i.s 			page 64
+
+
+ 1741      7400
+ 1742              	.LASF11:
+ 1743 00bc 756E7369 		.string	"unsigned char"
+ 1743      676E6564 
+ 1743      20636861 
+ 1743      7200
+ 1744              	.LASF3:
+ 1745 00ca 6C6F6E67 		.string	"long unsigned int"
+ 1745      20756E73 
+ 1745      69676E65 
+ 1745      6420696E 
+ 1745      7400
+ 1746              	.LASF8:
+ 1747 00dc 73686F72 		.string	"short unsigned int"
+ 1747      7420756E 
+ 1747      7369676E 
+ 1747      65642069 
+ 1747      6E7400
+ 1748              	.LASF25:
+ 1749 00ef 6D697865 		.string	"mixed_exp"
+ 1749      645F6578 
+ 1749      7000
+ 1750              	.LASF14:
+ 1751 00f9 68656174 		.string	"heatmap_cs_RdBu_discrete"
+ 1751      6D61705F 
+ 1751      63735F52 
+ 1751      6442755F 
+ 1751      64697363 
+ 1752              	.LASF23:
+ 1753 0112 6D697865 		.string	"mixed"
+ 1753      6400
+ 1754              	.LASF7:
+ 1755 0118 756E7369 		.string	"unsigned int"
+ 1755      676E6564 
+ 1755      20696E74 
+ 1755      00
+ 1756              	.LASF19:
+ 1757 0125 64697363 		.string	"discrete"
+ 1757      72657465 
+ 1757      00
+ 1758              	.LASF10:
+ 1759 012e 6E636F6C 		.string	"ncolors"
+ 1759      6F727300 
+ 1760              	.LASF4:
+ 1761 0136 6C6F6E67 		.string	"long long int"
+ 1761      206C6F6E 
+ 1761      6720696E 
+ 1761      7400
+ 1762              	.LASF24:
+ 1763 0144 6D697865 		.string	"mixed_exp_data"
+ 1763      645F6578 
+ 1763      705F6461 
+ 1763      746100
+ 1764              	.LASF22:
+ 1765 0153 6D697865 		.string	"mixed_data"
+ 1765      645F6461 
+ 1765      746100
+GAS LISTING /tmp/ccoNxI3i.s 			page 65
+
+
+ 1766              	.LASF2:
+ 1767 015e 6C6F6E67 		.string	"long int"
+ 1767      20696E74 
+ 1767      00
+ 1768              	.LASF5:
+ 1769 0167 6C6F6E67 		.string	"long double"
+ 1769      20646F75 
+ 1769      626C6500 
+ 1770              	.LASF15:
+ 1771 0173 68656174 		.string	"heatmap_cs_RdBu_soft"
+ 1771      6D61705F 
+ 1771      63735F52 
+ 1771      6442755F 
+ 1771      736F6674 
+ 1772              	.LASF18:
+ 1773 0188 64697363 		.string	"discrete_data"
+ 1773      72657465 
+ 1773      5F646174 
+ 1773      6100
+ 1774              	.LASF21:
+ 1775 0196 736F6674 		.string	"soft"
+ 1775      00
+ 1776              	.LASF9:
+ 1777 019b 636F6C6F 		.string	"colors"
+ 1777      727300
+ 1778              		.section	.debug_line_str,"MS",@progbits,1
+ 1779              	.LASF1:
+ 1780 0000 2F726F6F 		.string	"/root/repo"
+ 1780      742F7265 
+ 1780      706F00
+ 1781              	.LASF0:
+ 1782 000b 636F6C6F 		.string	"colorschemes/RdBu.c"
+ 1782      72736368 
+ 1782      656D6573 
+ 1782      2F526442 
+ 1782      752E6300 
+ 1783              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1784 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1784      742F7265 
+ 1784      706F0063 
+ 1784      6F6C6F72 
+ 1784      73636865 
@@ -0,0 +1,3758 @@
+GAS LISTING /tmp/ccNTHH7d.s 			page 1
+
+
+   1              		.file	"RdGy.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/RdGy.c"
+   5              		.globl	heatmap_cs_RdGy_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_RdGy_mixed_exp, @object
+   9              		.size	heatmap_cs_RdGy_mixed_exp, 8
+  10              	heatmap_cs_RdGy_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 1A191A00 		.string	"\032\031\032"
+  29 0008 1D1D1D18 		.ascii	"\035\035\035\030!!!1%%%J(((c,,,|:::\225>>>\256BBB\307FFF\340"
+  29      21212131 
+  29      2525254A 
+  29      28282863 
+  29      2C2C2C7C 
+  30 002c 4A4A4AF9 		.ascii	"JJJ\371NNN\377QQQ\377UUU\377YYY\377]]]\377aaa\377qqq\377uuu\377"
+  30      4E4E4EFF 
+  30      515151FF 
+  30      555555FF 
+  30      595959FF 
+  31 0050 787878FF 		.ascii	"xxx\377|||\377\200\200\200\377\204\204\204\377\210\210\210\377"
+  31      7C7C7CFF 
+  31      808080FF 
+  31      848484FF 
+  31      888888FF 
+  32 0064 8B8B8BFF 		.ascii	"\213\213\213\377\216\216\216\377\221\221\221\377\224\224\224"
+  32      8E8E8EFF 
+  32      919191FF 
+  32      949494
+  33 0073 FF979797 		.ascii	"\377\227\227\227\377\232\232\232\377\250\250\250\377\253\253"
+  33      FF9A9A9A 
+  33      FFA8A8A8 
+  33      FFABAB
+  34 0082 ABFFAEAE 		.ascii	"\253\377\256\256\256\377\261\261\261\377\264\264\264\377\267"
+  34      AEFFB1B1 
+  34      B1FFB4B4 
+GAS LISTING /tmp/ccNTHH7d.s 			page 2
+
+
+  34      B4FFB7
+  35 0091 B7B7FFBA 		.ascii	"\267\267\377\272\272\272\377\274\274\274\377\276\276\276\377"
+  35      BABAFFBC 
+  35      BCBCFFBE 
+  35      BEBEFF
+  36 00a0 C0C0C0FF 		.ascii	"\300\300\300\377\302\302\302\377\304\304\304\377\306\306\306"
+  36      C2C2C2FF 
+  36      C4C4C4FF 
+  36      C6C6C6
+  37 00af FFC8C8C8 		.ascii	"\377\310\310\310\377\322\322\322\377\324\324\324\377\326\326"
+  37      FFD2D2D2 
+  37      FFD4D4D4 
+  37      FFD6D6
+  38 00be D6FFD8D8 		.ascii	"\326\377\330\330\330\377\332\332\332\377\334\334\334\377\336"
+  38      D8FFDADA 
+  38      DAFFDCDC 
+  38      DCFFDE
+  39 00cd DEDEFFE0 		.ascii	"\336\336\377\340\340\340\377\341\341\341\377\343\343\343\377"
+  39      E0E0FFE1 
+  39      E1E1FFE3 
+  39      E3E3FF
+  40 00dc E4E4E4FF 		.ascii	"\344\344\344\377\345\345\345\377\347\347\347\377\350\350\350"
+  40      E5E5E5FF 
+  40      E7E7E7FF 
+  40      E8E8E8
+  41 00eb FFEAEAEA 		.ascii	"\377\352\352\352\377\353\353\353\377\363\363\363\377\364\364"
+  41      FFEBEBEB 
+  41      FFF3F3F3 
+  41      FFF4F4
+  42 00fa F4FFF6F6 		.ascii	"\364\377\366\366\366\377\367\367\367\377\370\370\370\377\372"
+  42      F6FFF7F7 
+  42      F7FFF8F8 
+  42      F8FFFA
+  43 0109 FAFAFFFB 		.ascii	"\372\372\377\373\373\373\377\374\374\374\377\376\376\376\377"
+  43      FBFBFFFC 
+  43      FCFCFFFE 
+  43      FEFEFF
+  44 0118 FFFEFEFF 		.ascii	"\377\376\376\377\377\374\375\377\377\372\373\377\377\371\372"
+  44      FFFCFDFF 
+  44      FFFAFBFF 
+  44      FFF9FA
+  45 0127 FFFFF7F8 		.ascii	"\377\377\367\370\377\377\366\366\377\377\364\364\377\377\363"
+  45      FFFFF6F6 
+  45      FFFFF4F4 
+  45      FFFFF3
+  46 0136 F2FFFFF1 		.ascii	"\362\377\377\361\360\377\377\360\356\377\376\347\341\377\376"
+  46      F0FFFFF0 
+  46      EEFFFEE7 
+  46      E1FFFE
+  47 0145 E6DEFFFE 		.ascii	"\346\336\377\376\344\334\377\376\343\331\377\376\342\327\377"
+  47      E4DCFFFE 
+  47      E3D9FFFE 
+  47      E2D7FF
+  48 0154 FEE0D5FF 		.ascii	"\376\340\325\377\376\337\322\377\376\336\320\377\376\335\315"
+  48      FEDFD2FF 
+  48      FEDED0FF 
+  48      FEDDCD
+GAS LISTING /tmp/ccNTHH7d.s 			page 3
+
+
+  49 0163 FFFEDCCB 		.ascii	"\377\376\334\313\377\375\333\310\377\374\332\306\377\374\330"
+  49      FFFDDBC8 
+  49      FFFCDAC6 
+  49      FFFCD8
+  50 0172 C3FFFCD6 		.ascii	"\303\377\374\326\301\377\374\325\276\377\373\323\274\377\373"
+  50      C1FFFCD5 
+  50      BEFFFBD3 
+  50      BCFFFB
+  51 0181 D1B9FFFB 		.ascii	"\321\271\377\373\317\267\377\373\316\265\377\372\314\262\377"
+  51      CFB7FFFB 
+  51      CEB5FFFA 
+  51      CCB2FF
+  52 0190 FACAB0FF 		.ascii	"\372\312\260\377\372\311\256\377\372\307\254\377\371\305\252"
+  52      FAC9AEFF 
+  52      FAC7ACFF 
+  52      F9C5AA
+  53 019f FFF7B99A 		.ascii	"\377\367\271\232\377\367\267\230\377\367\266\226\377\366\264"
+  53      FFF7B798 
+  53      FFF7B696 
+  53      FFF6B4
+  54 01ae 94FFF6B2 		.ascii	"\224\377\366\262\222\377\366\261\220\377\366\257\216\377\365"
+  54      92FFF6B1 
+  54      90FFF6AF 
+  54      8EFFF5
+  55 01bd AE8CFFF5 		.ascii	"\256\214\377\365\254\212\377\365\253\211\377\364\251\207\377"
+  55      AC8AFFF5 
+  55      AB89FFF4 
+  55      A987FF
+  56 01cc F4A885FF 		.ascii	"\364\250\205\377\364\246\203\377\364\245\202\377\363\243\200"
+  56      F4A683FF 
+  56      F4A582FF 
+  56      F3A380
+  57 01db FFF2A17F 		.ascii	"\377\362\241\177\377\361\240}\377\361\236{\377\360\234z\377\357"
+  57      FFF1A07D 
+  57      FFF19E7B 
+  57      FFF09C7A 
+  57      FFEF
+  58 01ed 9B78FFEE 		.ascii	"\233x\377\356\231w\377\356\227v\377\355\226t\377\354\224s\377"
+  58      9977FFEE 
+  58      9776FFED 
+  58      9674FFEC 
+  58      9473FF
+  59 0200 EC9271FF 		.ascii	"\354\222q\377\353\221p\377\352\217o\377\352\216n\377\351\214"
+  59      EB9170FF 
+  59      EA8F6FFF 
+  59      EA8E6EFF 
+  59      E98C
+  60 0212 6CFFE88A 		.ascii	"l\377\350\212k\377\342{_\377\341z^\377\340x]\377\340w\\\377\337"
+  60      6BFFE27B 
+  60      5FFFE17A 
+  60      5EFFE078 
+  60      5DFFE077 
+  61 0229 755BFFDE 		.ascii	"u[\377\336tZ\377\336rY\377\335qX\377\334oW\377\334nV\377\333"
+  61      745AFFDE 
+  61      7259FFDD 
+  61      7158FFDC 
+  61      6F57FFDC 
+GAS LISTING /tmp/ccNTHH7d.s 			page 4
+
+
+  62 0241 6C55FFDA 		.ascii	"lU\377\332kT\377\332jS\377\331hR\377\331gQ\377\330eP\377\327"
+  62      6B54FFDA 
+  62      6A53FFD9 
+  62      6852FFD9 
+  62      6751FFD8 
+  63 0259 644FFFD7 		.ascii	"dO\377\327cN\377\326aM\377\326`M\377\325_L\377\324^K\377\324"
+  63      634EFFD6 
+  63      614DFFD6 
+  63      604DFFD5 
+  63      5F4CFFD4 
+  64 0271 5D4BFFD3 		.ascii	"]K\377\323[J\377\323ZI\377\322YI\377\321XH\377\321WG\377\320"
+  64      5B4AFFD3 
+  64      5A49FFD2 
+  64      5949FFD1 
+  64      5848FFD1 
+  65 0289 5647FFD0 		.ascii	"VG\377\320UF\377\317TE\377\316SE\377\316RD\377\315QD\377\315"
+  65      5546FFCF 
+  65      5445FFCE 
+  65      5345FFCE 
+  65      5244FFCD 
+  66 02a1 5043FFCC 		.ascii	"PC\377\314OC\377\314NB\377\313MA\377\312LA\377\312K@\377\311"
+  66      4F43FFCC 
+  66      4E42FFCB 
+  66      4D41FFCA 
+  66      4C41FFCA 
+  67 02b9 4B40FFC9 		.ascii	"K@\377\311J?\377\310I?\377\310H>\377\30087\377\30077\377\277"
+  67      4A3FFFC8 
+  67      493FFFC8 
+  67      483EFFC0 
+  67      3837FFC0 
+  68 02d1 3636FFBF 		.ascii	"66\377\27766\377\27655\377\27645\377\27534\377\27524\377\274"
+  68      3636FFBE 
+  68      3535FFBE 
+  68      3435FFBD 
+  68      3334FFBD 
+  69 02e9 3134FFBC 		.ascii	"14\377\27403\377\273/3\377\273.2\377\272-2\377\272,1\377\271"
+  69      3033FFBB 
+  69      2F33FFBB 
+  69      2E32FFBA 
+  69      2D32FFBA 
+  70 0301 2B31FFB9 		.ascii	"+1\377\271*1\377\271)0\377\270(0\377\270(0\377\267'/\377\267"
+  70      2A31FFB9 
+  70      2930FFB8 
+  70      2830FFB8 
+  70      2830FFB7 
+  71 0319 262FFFB6 		.ascii	"&/\377\266%.\377\266$.\377\266#.\377\265\"-\377\265!-\377\264"
+  71      252EFFB6 
+  71      242EFFB6 
+  71      232EFFB5 
+  71      222DFFB5 
+  72 0331 202DFFB4 		.ascii	" -\377\264\037,\377\264\036,\377\263\035,\377\263\034,\377\262"
+  72      1F2CFFB4 
+  72      1E2CFFB3 
+  72      1D2CFFB3 
+  72      1C2CFFB2 
+  73 0345 1A2BFFB2 		.ascii	"\032+\377\262\031+\377\262\030+\377\261\027*\377\260\027*\377"
+  73      192BFFB2 
+GAS LISTING /tmp/ccNTHH7d.s 			page 5
+
+
+  73      182BFFB1 
+  73      172AFFB0 
+  73      172AFF
+  74 0358 B0172AFF 		.ascii	"\260\027*\377\257\026*\377\256\026*\377\256\026*\377\255\025"
+  74      AF162AFF 
+  74      AE162AFF 
+  74      AE162AFF 
+  74      AD15
+  75 036a 2AFFAC15 		.ascii	"*\377\254\025*\377\254\025*\377\253\024*\377\252\024*\377\252"
+  75      2AFFAC15 
+  75      2AFFAB14 
+  75      2AFFAA14 
+  75      2AFFAA
+  76 037d 142AFFA9 		.ascii	"\024*\377\251\024*\377\250\023*\377\250\023*\377\247\023*\377"
+  76      142AFFA8 
+  76      132AFFA8 
+  76      132AFFA7 
+  76      132AFF
+  77 0390 A61229FF 		.ascii	"\246\022)\377\246\022)\377\245\022)\377\245\022)\377\244\021"
+  77      A61229FF 
+  77      A51229FF 
+  77      A51229FF 
+  77      A411
+  78 03a2 29FFA311 		.ascii	")\377\243\021)\377\243\021)\377\242\021)\377\242\020)\377\241"
+  78      29FFA311 
+  78      29FFA211 
+  78      29FFA210 
+  78      29FFA1
+  79 03b5 1029FFA0 		.ascii	"\020)\377\240\020)\377\240\020)\377\237\017)\377\237\017)\377"
+  79      1029FFA0 
+  79      1029FF9F 
+  79      0F29FF9F 
+  79      0F29FF
+  80 03c8 9E0F29FF 		.ascii	"\236\017)\377\236\017(\377\235\017(\377\235\016(\377\234\016"
+  80      9E0F28FF 
+  80      9D0F28FF 
+  80      9D0E28FF 
+  80      9C0E
+  81 03da 28FF9C0E 		.ascii	"(\377\234\016(\377\233\016(\377\233\016(\377\232\r(\377\232\r"
+  81      28FF9B0E 
+  81      28FF9B0E 
+  81      28FF9A0D 
+  81      28FF9A0D 
+  82 03ee 28FF990D 		.ascii	"(\377\231\r(\377\231\r(\377\230\r(\377\230\f(\377\227\f(\377"
+  82      28FF990D 
+  82      28FF980D 
+  82      28FF980C 
+  82      28FF970C 
+  83 0404 970C27FF 		.ascii	"\227\f'\377\227\f'\377\226\f'\377\226\013'\377\225\013'\377\225"
+  83      970C27FF 
+  83      960C27FF 
+  83      960B27FF 
+  83      950B27FF 
+  84 0419 0B27FF94 		.ascii	"\013'\377\224\013'\377\224\013'\377\224\013'\377\223\013'\377"
+  84      0B27FF94 
+  84      0B27FF94 
+  84      0B27FF93 
+GAS LISTING /tmp/ccNTHH7d.s 			page 6
+
+
+  84      0B27FF
+  85 042c 840624FF 		.ascii	"\204\006$\377\203\005$\377\203\005$\377\203\005$\377\202\005"
+  85      830524FF 
+  85      830524FF 
+  85      830524FF 
+  85      8205
+  86 043e 24FF8205 		.ascii	"$\377\202\005$\377\202\005$\377\201\005$\377\201\005$\377\201"
+  86      24FF8205 
+  86      24FF8105 
+  86      24FF8105 
+  86      24FF81
+  87 0451 0424FF80 		.ascii	"\004$\377\200\004$\377\200\004$\377\200\004$\377\177\004$\377"
+  87      0424FF80 
+  87      0424FF80 
+  87      0424FF7F 
+  87      0424FF
+  88 0464 7F0424FF 		.ascii	"\177\004$\377\177\004$\377~\004#\377~\004#\377~\004#\377}\004"
+  88      7F0424FF 
+  88      7E0423FF 
+  88      7E0423FF 
+  88      7E0423FF 
+  89 047a 23FF7D03 		.ascii	"#\377}\003#\377}\003#\377|\003#\377|\003#\377|\003#\377{\003"
+  89      23FF7D03 
+  89      23FF7C03 
+  89      23FF7C03 
+  89      23FF7C03 
+  90 0492 23FF7B   		.ascii	"#\377{"
+  91 0495 0323FF7B 		.string	"\003#\377{\003#\377{\003#\377z\003#\377z\003#\377z\003#\377y\003#\377y\003#\377y\002#\377
+  91      0323FF7B 
+  91      0323FF7A 
+  91      0323FF7A 
+  91      0323FF7A 
+  92 0596 20FF6F00 		.string	" \377o"
+  93 059a 20FF6E00 		.string	" \377n"
+  94 059e 20FF6E00 		.string	" \377n"
+  95 05a2 20FF6E00 		.string	" \377n"
+  96 05a6 20FF6E00 		.string	" \377n"
+  97 05aa 20FF6E00 		.string	" \377n"
+  98 05ae 20FF6E00 		.string	" \377n"
+  99 05b2 20FF6E00 		.string	" \377n"
+ 100 05b6 20FF6E00 		.string	" \377n"
+ 101 05ba 20FF6E00 		.string	" \377n"
+ 102 05be 20FF6D00 		.string	" \377m"
+ 103 05c2 20FF6D00 		.string	" \377m"
+ 104 05c6 20FF6D00 		.string	" \377m"
+ 105 05ca 20FF6D00 		.string	" \377m"
+ 106 05ce 20FF6D00 		.string	" \377m"
+ 107 05d2 20FF6D00 		.string	" \377m"
+ 108 05d6 20FF6D00 		.string	" \377m"
+ 109 05da 20FF6D00 		.string	" \377m"
+ 110 05de 20FF6D00 		.string	" \377m"
+ 111 05e2 20FF6D00 		.string	" \377m"
+ 112 05e6 20FF6C00 		.string	" \377l"
+ 113 05ea 20FF6C00 		.string	" \377l"
+ 114 05ee 20FF6C00 		.string	" \377l"
+ 115 05f2 20FF6C00 		.string	" \377l"
+ 116 05f6 20FF6C00 		.string	" \377l"
+GAS LISTING /tmp/ccNTHH7d.s 			page 7
+
+
+ 117 05fa 20FF6C00 		.string	" \377l"
+ 118 05fe 20FF6C00 		.string	" \377l"
+ 119 0602 20FF6C00 		.string	" \377l"
+ 120 0606 20FF6C00 		.string	" \377l"
+ 121 060a 20FF6C00 		.string	" \377l"
+ 122 060e 20FF6C00 		.string	" \377l"
+ 123 0612 20FF6C00 		.string	" \377l"
+ 124 0616 20FF6B00 		.string	" \377k"
+ 125 061a 20FF6B00 		.string	" \377k"
+ 126 061e 20FF6B00 		.string	" \377k"
+ 127 0622 20FF6B00 		.string	" \377k"
+ 128 0626 20FF6B00 		.string	" \377k"
+ 129 062a 20FF6B00 		.string	" \377k"
+ 130 062e 20FF6B00 		.string	" \377k"
+ 131 0632 20FF6B00 		.string	" \377k"
+ 132 0636 20FF6B00 		.string	" \377k"
+ 133 063a 20FF6B00 		.string	" \377k"
+ 134 063e 20FF6B00 		.string	" \377k"
+ 135 0642 1FFF6B00 		.string	"\037\377k"
+ 136 0646 1FFF6B00 		.string	"\037\377k"
+ 137 064a 1FFF6B00 		.string	"\037\377k"
+ 138 064e 1FFF6A00 		.string	"\037\377j"
+ 139 0652 1FFF6A00 		.string	"\037\377j"
+ 140 0656 1FFF6A00 		.string	"\037\377j"
+ 141 065a 1FFF6A00 		.string	"\037\377j"
+ 142 065e 1FFF6A00 		.string	"\037\377j"
+ 143 0662 1FFF6A00 		.string	"\037\377j"
+ 144 0666 1FFF6A00 		.string	"\037\377j"
+ 145 066a 1FFF6A00 		.string	"\037\377j"
+ 146 066e 1FFF6A00 		.string	"\037\377j"
+ 147 0672 1FFF6A00 		.string	"\037\377j"
+ 148 0676 1FFF6A00 		.string	"\037\377j"
+ 149 067a 1FFF6A00 		.string	"\037\377j"
+ 150 067e 1FFF6A00 		.string	"\037\377j"
+ 151 0682 1FFF6A00 		.string	"\037\377j"
+ 152 0686 1FFF6A00 		.string	"\037\377j"
+ 153 068a 1FFF6A00 		.string	"\037\377j"
+ 154 068e 1FFF6A00 		.string	"\037\377j"
+ 155 0692 1FFF6900 		.string	"\037\377i"
+ 156 0696 1FFF6900 		.string	"\037\377i"
+ 157 069a 1FFF6900 		.string	"\037\377i"
+ 158 069e 1FFF6900 		.string	"\037\377i"
+ 159 06a2 1FFF6900 		.string	"\037\377i"
+ 160 06a6 1FFF6900 		.string	"\037\377i"
+ 161 06aa 1FFF6900 		.string	"\037\377i"
+ 162 06ae 1FFF6900 		.string	"\037\377i"
+ 163 06b2 1FFF6900 		.string	"\037\377i"
+ 164 06b6 1FFF6900 		.string	"\037\377i"
+ 165 06ba 1FFF6900 		.string	"\037\377i"
+ 166 06be 1FFF6900 		.string	"\037\377i"
+ 167 06c2 1FFF6900 		.string	"\037\377i"
+ 168 06c6 1FFF6900 		.string	"\037\377i"
+ 169 06ca 1FFF6900 		.string	"\037\377i"
+ 170 06ce 1FFF6900 		.string	"\037\377i"
+ 171 06d2 1FFF6900 		.string	"\037\377i"
+ 172 06d6 1FFF6900 		.string	"\037\377i"
+ 173 06da 1FFF6900 		.string	"\037\377i"
+GAS LISTING /tmp/ccNTHH7d.s 			page 8
+
+
+ 174 06de 1FFF6900 		.string	"\037\377i"
+ 175 06e2 1FFF6900 		.string	"\037\377i"
+ 176 06e6 1FFF6900 		.string	"\037\377i"
+ 177 06ea 1FFF6900 		.string	"\037\377i"
+ 178 06ee 1FFF6900 		.string	"\037\377i"
+ 179 06f2 1FFF6800 		.string	"\037\377h"
+ 180 06f6 1FFF6800 		.string	"\037\377h"
+ 181 06fa 1FFF6800 		.string	"\037\377h"
+ 182 06fe 1FFF6800 		.string	"\037\377h"
+ 183 0702 1FFF6800 		.string	"\037\377h"
+ 184 0706 1FFF6800 		.string	"\037\377h"
+ 185 070a 1FFF6800 		.string	"\037\377h"
+ 186 070e 1FFF6800 		.string	"\037\377h"
+ 187 0712 1FFF6800 		.string	"\037\377h"
+ 188 0716 1FFF6800 		.string	"\037\377h"
+ 189 071a 1FFF6800 		.string	"\037\377h"
+ 190 071e 1FFF6800 		.string	"\037\377h"
+ 191 0722 1FFF6800 		.string	"\037\377h"
+ 192 0726 1FFF6800 		.string	"\037\377h"
+ 193 072a 1FFF6800 		.string	"\037\377h"
+ 194 072e 1FFF6800 		.string	"\037\377h"
+ 195 0732 1FFF6800 		.string	"\037\377h"
+ 196 0736 1FFF6800 		.string	"\037\377h"
+ 197 073a 1FFF6800 		.string	"\037\377h"
+ 198 073e 1FFF6800 		.string	"\037\377h"
+ 199 0742 1FFF6800 		.string	"\037\377h"
+ 200 0746 1FFF6800 		.string	"\037\377h"
+ 201 074a 1FFF6800 		.string	"\037\377h"
+ 202 074e 1FFF6800 		.string	"\037\377h"
+ 203 0752 1FFF6800 		.string	"\037\377h"
+ 204 0756 1FFF6800 		.string	"\037\377h"
+ 205 075a 1FFF6800 		.string	"\037\377h"
+ 206 075e 1FFF6800 		.string	"\037\377h"
+ 207 0762 1FFF6800 		.string	"\037\377h"
+ 208 0766 1FFF6800 		.string	"\037\377h"
+ 209 076a 1FFF6800 		.string	"\037\377h"
+ 210 076e 1FFF6800 		.string	"\037\377h"
+ 211 0772 1FFF6800 		.string	"\037\377h"
+ 212 0776 1FFF6800 		.string	"\037\377h"
+ 213 077a 1FFF6800 		.string	"\037\377h"
+ 214 077e 1FFF6800 		.string	"\037\377h"
+ 215 0782 1FFF6800 		.string	"\037\377h"
+ 216 0786 1FFF6800 		.string	"\037\377h"
+ 217 078a 1FFF6800 		.string	"\037\377h"
+ 218 078e 1FFF6700 		.string	"\037\377g"
+ 219 0792 1FFF6700 		.string	"\037\377g"
+ 220 0796 1FFF6700 		.string	"\037\377g"
+ 221 079a 1FFF6700 		.string	"\037\377g"
+ 222 079e 1FFF6700 		.string	"\037\377g"
+ 223 07a2 1FFF6700 		.string	"\037\377g"
+ 224 07a6 1FFF6700 		.string	"\037\377g"
+ 225 07aa 1FFF6700 		.string	"\037\377g"
+ 226 07ae 1FFF6700 		.string	"\037\377g"
+ 227 07b2 1FFF6700 		.string	"\037\377g"
+ 228 07b6 1FFF6700 		.string	"\037\377g"
+ 229 07ba 1FFF6700 		.string	"\037\377g"
+ 230 07be 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccNTHH7d.s 			page 9
+
+
+ 231 07c2 1FFF6700 		.string	"\037\377g"
+ 232 07c6 1FFF6700 		.string	"\037\377g"
+ 233 07ca 1FFF6700 		.string	"\037\377g"
+ 234 07ce 1FFF     		.ascii	"\037\377"
+ 235 07d0 6700     		.string	"g"
+ 236 07d2 1FFF6700 		.string	"\037\377g"
+ 237 07d6 1FFF6700 		.string	"\037\377g"
+ 238 07da 1FFF6700 		.string	"\037\377g"
+ 239 07de 1FFF6700 		.string	"\037\377g"
+ 240 07e2 1FFF6700 		.string	"\037\377g"
+ 241 07e6 1FFF6700 		.string	"\037\377g"
+ 242 07ea 1FFF6700 		.string	"\037\377g"
+ 243 07ee 1FFF6700 		.string	"\037\377g"
+ 244 07f2 1FFF6700 		.string	"\037\377g"
+ 245 07f6 1FFF6700 		.string	"\037\377g"
+ 246 07fa 1FFF6700 		.string	"\037\377g"
+ 247 07fe 1FFF6700 		.string	"\037\377g"
+ 248 0802 1FFF6700 		.string	"\037\377g"
+ 249 0806 1FFF6700 		.string	"\037\377g"
+ 250 080a 1FFF6700 		.string	"\037\377g"
+ 251 080e 1FFF6700 		.string	"\037\377g"
+ 252 0812 1FFF6700 		.string	"\037\377g"
+ 253 0816 1FFF6700 		.string	"\037\377g"
+ 254 081a 1FFF6700 		.string	"\037\377g"
+ 255 081e 1FFF6700 		.string	"\037\377g"
+ 256 0822 1FFF6700 		.string	"\037\377g"
+ 257 0826 1FFF6700 		.string	"\037\377g"
+ 258 082a 1FFF6700 		.string	"\037\377g"
+ 259 082e 1FFF6700 		.string	"\037\377g"
+ 260 0832 1FFF6700 		.string	"\037\377g"
+ 261 0836 1FFF6700 		.string	"\037\377g"
+ 262 083a 1FFF6700 		.string	"\037\377g"
+ 263 083e 1FFF6700 		.string	"\037\377g"
+ 264 0842 1FFF6700 		.string	"\037\377g"
+ 265 0846 1FFF6700 		.string	"\037\377g"
+ 266 084a 1FFF6700 		.string	"\037\377g"
+ 267 084e 1FFF6700 		.string	"\037\377g"
+ 268 0852 1FFF6700 		.string	"\037\377g"
+ 269 0856 1FFF6700 		.string	"\037\377g"
+ 270 085a 1FFF6700 		.string	"\037\377g"
+ 271 085e 1FFF6700 		.string	"\037\377g"
+ 272 0862 1FFF6700 		.string	"\037\377g"
+ 273 0866 1FFF6700 		.string	"\037\377g"
+ 274 086a 1FFF6700 		.string	"\037\377g"
+ 275 086e 1FFF6700 		.string	"\037\377g"
+ 276 0872 1FFF6700 		.string	"\037\377g"
+ 277 0876 1FFF6700 		.string	"\037\377g"
+ 278 087a 1FFF6700 		.string	"\037\377g"
+ 279 087e 1FFF6700 		.string	"\037\377g"
+ 280 0882 1FFF6700 		.string	"\037\377g"
+ 281 0886 1FFF6700 		.string	"\037\377g"
+ 282 088a 1FFF6700 		.string	"\037\377g"
+ 283 088e 1FFF6700 		.string	"\037\377g"
+ 284 0892 1FFF6700 		.string	"\037\377g"
+ 285 0896 1FFF6700 		.string	"\037\377g"
+ 286 089a 1FFF6700 		.string	"\037\377g"
+ 287 089e 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccNTHH7d.s 			page 10
+
+
+ 288 08a2 1FFF6700 		.string	"\037\377g"
+ 289 08a6 1FFF6700 		.string	"\037\377g"
+ 290 08aa 1FFF6700 		.string	"\037\377g"
+ 291 08ae 1FFF6700 		.string	"\037\377g"
+ 292 08b2 1FFF6700 		.string	"\037\377g"
+ 293 08b6 1FFF6700 		.string	"\037\377g"
+ 294 08ba 1FFF6700 		.string	"\037\377g"
+ 295 08be 1FFF6700 		.string	"\037\377g"
+ 296 08c2 1FFF6700 		.string	"\037\377g"
+ 297 08c6 1FFF6700 		.string	"\037\377g"
+ 298 08ca 1FFF6700 		.string	"\037\377g"
+ 299 08ce 1FFF6700 		.string	"\037\377g"
+ 300 08d2 1FFF6700 		.string	"\037\377g"
+ 301 08d6 1FFF6700 		.string	"\037\377g"
+ 302 08da 1FFF6700 		.string	"\037\377g"
+ 303 08de 1FFF6700 		.string	"\037\377g"
+ 304 08e2 1FFF6700 		.string	"\037\377g"
+ 305 08e6 1FFF6700 		.string	"\037\377g"
+ 306 08ea 1FFF6700 		.string	"\037\377g"
+ 307 08ee 1FFF6700 		.string	"\037\377g"
+ 308 08f2 1FFF6700 		.string	"\037\377g"
+ 309 08f6 1FFF6700 		.string	"\037\377g"
+ 310 08fa 1FFF6700 		.string	"\037\377g"
+ 311 08fe 1FFF6700 		.string	"\037\377g"
+ 312 0902 1FFF6700 		.string	"\037\377g"
+ 313 0906 1FFF6700 		.string	"\037\377g"
+ 314 090a 1FFF6700 		.string	"\037\377g"
+ 315 090e 1FFF6700 		.string	"\037\377g"
+ 316 0912 1FFF6700 		.string	"\037\377g"
+ 317 0916 1FFF6700 		.string	"\037\377g"
+ 318 091a 1FFF6700 		.string	"\037\377g"
+ 319 091e 1FFF6700 		.string	"\037\377g"
+ 320 0922 1FFF6700 		.string	"\037\377g"
+ 321 0926 1FFF6700 		.string	"\037\377g"
+ 322 092a 1FFF6700 		.string	"\037\377g"
+ 323 092e 1FFF6700 		.string	"\037\377g"
+ 324 0932 1FFF6700 		.string	"\037\377g"
+ 325 0936 1FFF6700 		.string	"\037\377g"
+ 326 093a 1FFF6700 		.string	"\037\377g"
+ 327 093e 1FFF6700 		.string	"\037\377g"
+ 328 0942 1FFF6700 		.string	"\037\377g"
+ 329 0946 1FFF6700 		.string	"\037\377g"
+ 330 094a 1FFF6700 		.string	"\037\377g"
+ 331 094e 1FFF6700 		.string	"\037\377g"
+ 332 0952 1FFF6700 		.string	"\037\377g"
+ 333 0956 1FFF6700 		.string	"\037\377g"
+ 334 095a 1FFF6700 		.string	"\037\377g"
+ 335 095e 1FFF6700 		.string	"\037\377g"
+ 336 0962 1FFF6700 		.string	"\037\377g"
+ 337 0966 1FFF6700 		.string	"\037\377g"
+ 338 096a 1FFF6700 		.string	"\037\377g"
+ 339 096e 1FFF6700 		.string	"\037\377g"
+ 340 0972 1FFF6700 		.string	"\037\377g"
+ 341 0976 1FFF6700 		.string	"\037\377g"
+ 342 097a 1FFF6700 		.string	"\037\377g"
+ 343 097e 1FFF6700 		.string	"\037\377g"
+ 344 0982 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccNTHH7d.s 			page 11
+
+
+ 345 0986 1FFF6700 		.string	"\037\377g"
+ 346 098a 1FFF6700 		.string	"\037\377g"
+ 347 098e 1FFF6700 		.string	"\037\377g"
+ 348 0992 1FFF6700 		.string	"\037\377g"
+ 349 0996 1FFF6700 		.string	"\037\377g"
+ 350 099a 1FFF6700 		.string	"\037\377g"
+ 351 099e 1FFF6700 		.string	"\037\377g"
+ 352 09a2 1FFF6700 		.string	"\037\377g"
+ 353 09a6 1FFF6700 		.string	"\037\377g"
+ 354 09aa 1FFF6700 		.string	"\037\377g"
+ 355 09ae 1FFF6700 		.string	"\037\377g"
+ 356 09b2 1FFF6700 		.string	"\037\377g"
+ 357 09b6 1FFF6700 		.string	"\037\377g"
+ 358 09ba 1FFF6700 		.string	"\037\377g"
+ 359 09be 1FFF6700 		.string	"\037\377g"
+ 360 09c2 1FFF6700 		.string	"\037\377g"
+ 361 09c6 1FFF6700 		.string	"\037\377g"
+ 362 09ca 1FFF6700 		.string	"\037\377g"
+ 363 09ce 1FFF6700 		.string	"\037\377g"
+ 364 09d2 1FFF6700 		.string	"\037\377g"
+ 365 09d6 1FFF6700 		.string	"\037\377g"
+ 366 09da 1FFF6700 		.string	"\037\377g"
+ 367 09de 1FFF6700 		.string	"\037\377g"
+ 368 09e2 1FFF6700 		.string	"\037\377g"
+ 369 09e6 1FFF6700 		.string	"\037\377g"
+ 370 09ea 1FFF6700 		.string	"\037\377g"
+ 371 09ee 1FFF6700 		.string	"\037\377g"
+ 372 09f2 1FFF6700 		.string	"\037\377g"
+ 373 09f6 1FFF6700 		.string	"\037\377g"
+ 374 09fa 1FFF6700 		.string	"\037\377g"
+ 375 09fe 1FFF6700 		.string	"\037\377g"
+ 376 0a02 1FFF6700 		.string	"\037\377g"
+ 377 0a06 1FFF6700 		.string	"\037\377g"
+ 378 0a0a 1FFF6700 		.string	"\037\377g"
+ 379 0a0e 1FFF6700 		.string	"\037\377g"
+ 380 0a12 1FFF6700 		.string	"\037\377g"
+ 381 0a16 1FFF6700 		.string	"\037\377g"
+ 382 0a1a 1FFF6700 		.string	"\037\377g"
+ 383 0a1e 1FFF6700 		.string	"\037\377g"
+ 384 0a22 1FFF6700 		.string	"\037\377g"
+ 385 0a26 1FFF6700 		.string	"\037\377g"
+ 386 0a2a 1FFF6700 		.string	"\037\377g"
+ 387 0a2e 1FFF6700 		.string	"\037\377g"
+ 388 0a32 1FFF6700 		.string	"\037\377g"
+ 389 0a36 1FFF6700 		.string	"\037\377g"
+ 390 0a3a 1FFF6700 		.string	"\037\377g"
+ 391 0a3e 1FFF6700 		.string	"\037\377g"
+ 392 0a42 1FFF6700 		.string	"\037\377g"
+ 393 0a46 1FFF6700 		.string	"\037\377g"
+ 394 0a4a 1FFF6700 		.string	"\037\377g"
+ 395 0a4e 1FFF6700 		.string	"\037\377g"
+ 396 0a52 1FFF6700 		.string	"\037\377g"
+ 397 0a56 1FFF6700 		.string	"\037\377g"
+ 398 0a5a 1FFF6700 		.string	"\037\377g"
+ 399 0a5e 1FFF6700 		.string	"\037\377g"
+ 400 0a62 1FFF6700 		.string	"\037\377g"
+ 401 0a66 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccNTHH7d.s 			page 12
+
+
+ 402 0a6a 1FFF6700 		.string	"\037\377g"
+ 403 0a6e 1FFF6700 		.string	"\037\377g"
+ 404 0a72 1FFF6700 		.string	"\037\377g"
+ 405 0a76 1FFF6700 		.string	"\037\377g"
+ 406 0a7a 1FFF6700 		.string	"\037\377g"
+ 407 0a7e 1FFF6700 		.string	"\037\377g"
+ 408 0a82 1FFF6700 		.string	"\037\377g"
+ 409 0a86 1FFF6700 		.string	"\037\377g"
+ 410 0a8a 1FFF6700 		.string	"\037\377g"
+ 411 0a8e 1FFF6700 		.string	"\037\377g"
+ 412 0a92 1FFF6700 		.string	"\037\377g"
+ 413 0a96 1FFF6700 		.string	"\037\377g"
+ 414 0a9a 1FFF6700 		.string	"\037\377g"
+ 415 0a9e 1FFF6700 		.string	"\037\377g"
+ 416 0aa2 1FFF6700 		.string	"\037\377g"
+ 417 0aa6 1FFF6700 		.string	"\037\377g"
+ 418 0aaa 1FFF6700 		.string	"\037\377g"
+ 419 0aae 1FFF6700 		.string	"\037\377g"
+ 420 0ab2 1FFF6700 		.string	"\037\377g"
+ 421 0ab6 1FFF6700 		.string	"\037\377g"
+ 422 0aba 1FFF6700 		.string	"\037\377g"
+ 423 0abe 1FFF6700 		.string	"\037\377g"
+ 424 0ac2 1FFF6700 		.string	"\037\377g"
+ 425 0ac6 1FFF6700 		.string	"\037\377g"
+ 426 0aca 1FFF6700 		.string	"\037\377g"
+ 427 0ace 1FFF6700 		.string	"\037\377g"
+ 428 0ad2 1FFF6700 		.string	"\037\377g"
+ 429 0ad6 1FFF6700 		.string	"\037\377g"
+ 430 0ada 1FFF6700 		.string	"\037\377g"
+ 431 0ade 1FFF6700 		.string	"\037\377g"
+ 432 0ae2 1FFF6700 		.string	"\037\377g"
+ 433 0ae6 1FFF6700 		.string	"\037\377g"
+ 434 0aea 1FFF6700 		.string	"\037\377g"
+ 435 0aee 1FFF6700 		.string	"\037\377g"
+ 436 0af2 1FFF6700 		.string	"\037\377g"
+ 437 0af6 1FFF6700 		.string	"\037\377g"
+ 438 0afa 1FFF6700 		.string	"\037\377g"
+ 439 0afe 1FFF6700 		.string	"\037\377g"
+ 440 0b02 1FFF6700 		.string	"\037\377g"
+ 441 0b06 1FFF6700 		.string	"\037\377g"
+ 442 0b0a 1FFF6700 		.string	"\037\377g"
+ 443 0b0e 1FFF6700 		.string	"\037\377g"
+ 444 0b12 1FFF6700 		.string	"\037\377g"
+ 445 0b16 1FFF6700 		.string	"\037\377g"
+ 446 0b1a 1FFF6700 		.string	"\037\377g"
+ 447 0b1e 1FFF6700 		.string	"\037\377g"
+ 448 0b22 1FFF6700 		.string	"\037\377g"
+ 449 0b26 1FFF6700 		.string	"\037\377g"
+ 450 0b2a 1FFF6700 		.string	"\037\377g"
+ 451 0b2e 1FFF6700 		.string	"\037\377g"
+ 452 0b32 1FFF6700 		.string	"\037\377g"
+ 453 0b36 1FFF6700 		.string	"\037\377g"
+ 454 0b3a 1FFF6700 		.string	"\037\377g"
+ 455 0b3e 1FFF6700 		.string	"\037\377g"
+ 456 0b42 1FFF6700 		.string	"\037\377g"
+ 457 0b46 1FFF6700 		.string	"\037\377g"
+ 458 0b4a 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccNTHH7d.s 			page 13
+
+
+ 459 0b4e 1FFF6700 		.string	"\037\377g"
+ 460 0b52 1FFF6700 		.string	"\037\377g"
+ 461 0b56 1FFF6700 		.string	"\037\377g"
+ 462 0b5a 1FFF6700 		.string	"\037\377g"
+ 463 0b5e 1FFF6700 		.string	"\037\377g"
+ 464 0b62 1FFF6700 		.string	"\037\377g"
+ 465 0b66 1FFF6700 		.string	"\037\377g"
+ 466 0b6a 1FFF6700 		.string	"\037\377g"
+ 467 0b6e 1FFF6700 		.string	"\037\377g"
+ 468 0b72 1FFF6700 		.string	"\037\377g"
+ 469 0b76 1FFF6700 		.string	"\037\377g"
+ 470 0b7a 1FFF6700 		.string	"\037\377g"
+ 471 0b7e 1FFF6700 		.string	"\037\377g"
+ 472 0b82 1FFF6700 		.string	"\037\377g"
+ 473 0b86 1FFF6700 		.string	"\037\377g"
+ 474 0b8a 1FFF6700 		.string	"\037\377g"
+ 475 0b8e 1FFF6700 		.string	"\037\377g"
+ 476 0b92 1FFF6700 		.string	"\037\377g"
+ 477 0b96 1FFF6700 		.string	"\037\377g"
+ 478 0b9a 1FFF6700 		.string	"\037\377g"
+ 479 0b9e 1FFF6700 		.string	"\037\377g"
+ 480 0ba2 1FFF6700 		.string	"\037\377g"
+ 481 0ba6 1FFF6700 		.string	"\037\377g"
+ 482 0baa 1FFF6700 		.string	"\037\377g"
+ 483 0bae 1FFF6700 		.string	"\037\377g"
+ 484 0bb2 1FFF6700 		.string	"\037\377g"
+ 485 0bb6 1FFF6700 		.string	"\037\377g"
+ 486 0bba 1FFF6700 		.string	"\037\377g"
+ 487 0bbe 1FFF6700 		.string	"\037\377g"
+ 488 0bc2 1FFF6700 		.string	"\037\377g"
+ 489 0bc6 1FFF6700 		.string	"\037\377g"
+ 490 0bca 1FFF6700 		.string	"\037\377g"
+ 491 0bce 1FFF6700 		.string	"\037\377g"
+ 492 0bd2 1FFF6700 		.string	"\037\377g"
+ 493 0bd6 1FFF6700 		.string	"\037\377g"
+ 494 0bda 1FFF6700 		.string	"\037\377g"
+ 495 0bde 1FFF6700 		.string	"\037\377g"
+ 496 0be2 1FFF6700 		.string	"\037\377g"
+ 497 0be6 1FFF6700 		.string	"\037\377g"
+ 498 0bea 1FFF6700 		.string	"\037\377g"
+ 499 0bee 1FFF6700 		.string	"\037\377g"
+ 500 0bf2 1FFF6700 		.string	"\037\377g"
+ 501 0bf6 1FFF6700 		.string	"\037\377g"
+ 502 0bfa 1FFF6700 		.string	"\037\377g"
+ 503 0bfe 1FFF6700 		.string	"\037\377g"
+ 504 0c02 1FFF6700 		.string	"\037\377g"
+ 505 0c06 1FFF6700 		.string	"\037\377g"
+ 506 0c0a 1FFF6700 		.string	"\037\377g"
+ 507 0c0e 1FFF6700 		.string	"\037\377g"
+ 508 0c12 1FFF6700 		.string	"\037\377g"
+ 509 0c16 1FFF6700 		.string	"\037\377g"
+ 510 0c1a 1FFF6700 		.string	"\037\377g"
+ 511 0c1e 1FFF6700 		.string	"\037\377g"
+ 512 0c22 1FFF6700 		.string	"\037\377g"
+ 513 0c26 1FFF6700 		.string	"\037\377g"
+ 514 0c2a 1FFF6700 		.string	"\037\377g"
+ 515 0c2e 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccNTHH7d.s 			page 14
+
+
+ 516 0c32 1FFF6700 		.string	"\037\377g"
+ 517 0c36 1FFF6700 		.string	"\037\377g"
+ 518 0c3a 1FFF6700 		.string	"\037\377g"
+ 519 0c3e 1FFF6700 		.string	"\037\377g"
+ 520 0c42 1FFF6700 		.string	"\037\377g"
+ 521 0c46 1FFF6700 		.string	"\037\377g"
+ 522 0c4a 1FFF6700 		.string	"\037\377g"
+ 523 0c4e 1FFF6700 		.string	"\037\377g"
+ 524 0c52 1FFF6700 		.string	"\037\377g"
+ 525 0c56 1FFF6700 		.string	"\037\377g"
+ 526 0c5a 1FFF6700 		.string	"\037\377g"
+ 527 0c5e 1FFF6700 		.string	"\037\377g"
+ 528 0c62 1FFF6700 		.string	"\037\377g"
+ 529 0c66 1FFF6700 		.string	"\037\377g"
+ 530 0c6a 1FFF6700 		.string	"\037\377g"
+ 531 0c6e 1FFF6700 		.string	"\037\377g"
+ 532 0c72 1FFF6700 		.string	"\037\377g"
+ 533 0c76 1FFF6700 		.string	"\037\377g"
+ 534 0c7a 1FFF6700 		.string	"\037\377g"
+ 535 0c7e 1FFF6700 		.string	"\037\377g"
+ 536 0c82 1FFF6700 		.string	"\037\377g"
+ 537 0c86 1FFF6700 		.string	"\037\377g"
+ 538 0c8a 1FFF6700 		.string	"\037\377g"
+ 539 0c8e 1FFF6700 		.string	"\037\377g"
+ 540 0c92 1FFF6700 		.string	"\037\377g"
+ 541 0c96 1FFF6700 		.string	"\037\377g"
+ 542 0c9a 1FFF6700 		.string	"\037\377g"
+ 543 0c9e 1FFF6700 		.string	"\037\377g"
+ 544 0ca2 1FFF6700 		.string	"\037\377g"
+ 545 0ca6 1FFF6700 		.string	"\037\377g"
+ 546 0caa 1FFF6700 		.string	"\037\377g"
+ 547 0cae 1FFF6700 		.string	"\037\377g"
+ 548 0cb2 1FFF6700 		.string	"\037\377g"
+ 549 0cb6 1FFF6700 		.string	"\037\377g"
+ 550 0cba 1FFF6700 		.string	"\037\377g"
+ 551 0cbe 1FFF6700 		.string	"\037\377g"
+ 552 0cc2 1FFF6700 		.string	"\037\377g"
+ 553 0cc6 1FFF6700 		.string	"\037\377g"
+ 554 0cca 1FFF6700 		.string	"\037\377g"
+ 555 0cce 1FFF6700 		.string	"\037\377g"
+ 556 0cd2 1FFF6700 		.string	"\037\377g"
+ 557 0cd6 1FFF6700 		.string	"\037\377g"
+ 558 0cda 1FFF6700 		.string	"\037\377g"
+ 559 0cde 1FFF6700 		.string	"\037\377g"
+ 560 0ce2 1FFF6700 		.string	"\037\377g"
+ 561 0ce6 1FFF6700 		.string	"\037\377g"
+ 562 0cea 1FFF6700 		.string	"\037\377g"
+ 563 0cee 1FFF6700 		.string	"\037\377g"
+ 564 0cf2 1FFF6700 		.string	"\037\377g"
+ 565 0cf6 1FFF6700 		.string	"\037\377g"
+ 566 0cfa 1FFF6700 		.string	"\037\377g"
+ 567 0cfe 1FFF6700 		.string	"\037\377g"
+ 568 0d02 1FFF6700 		.string	"\037\377g"
+ 569 0d06 1FFF6700 		.string	"\037\377g"
+ 570 0d0a 1FFF6700 		.string	"\037\377g"
+ 571 0d0e 1FFF6700 		.string	"\037\377g"
+ 572 0d12 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccNTHH7d.s 			page 15
+
+
+ 573 0d16 1FFF6700 		.string	"\037\377g"
+ 574 0d1a 1FFF6700 		.string	"\037\377g"
+ 575 0d1e 1FFF6700 		.string	"\037\377g"
+ 576 0d22 1FFF6700 		.string	"\037\377g"
+ 577 0d26 1FFF6700 		.string	"\037\377g"
+ 578 0d2a 1FFF6700 		.string	"\037\377g"
+ 579 0d2e 1FFF6700 		.string	"\037\377g"
+ 580 0d32 1FFF6700 		.string	"\037\377g"
+ 581 0d36 1FFF6700 		.string	"\037\377g"
+ 582 0d3a 1FFF6700 		.string	"\037\377g"
+ 583 0d3e 1FFF6700 		.string	"\037\377g"
+ 584 0d42 1FFF6700 		.string	"\037\377g"
+ 585 0d46 1FFF6700 		.string	"\037\377g"
+ 586 0d4a 1FFF6700 		.string	"\037\377g"
+ 587 0d4e 1FFF6700 		.string	"\037\377g"
+ 588 0d52 1FFF6700 		.string	"\037\377g"
+ 589 0d56 1FFF6700 		.string	"\037\377g"
+ 590 0d5a 1FFF6700 		.string	"\037\377g"
+ 591 0d5e 1FFF6700 		.string	"\037\377g"
+ 592 0d62 1FFF6700 		.string	"\037\377g"
+ 593 0d66 1EFF6700 		.string	"\036\377g"
+ 594 0d6a 1EFF6700 		.string	"\036\377g"
+ 595 0d6e 1EFF6600 		.string	"\036\377f"
+ 596 0d72 1EFF6600 		.string	"\036\377f"
+ 597 0d76 1EFF6600 		.string	"\036\377f"
+ 598 0d7a 1EFF6600 		.string	"\036\377f"
+ 599 0d7e 1EFF6600 		.string	"\036\377f"
+ 600 0d82 1EFF6600 		.string	"\036\377f"
+ 601 0d86 1EFF6600 		.string	"\036\377f"
+ 602 0d8a 1EFF6600 		.string	"\036\377f"
+ 603 0d8e 1EFF6600 		.string	"\036\377f"
+ 604 0d92 1EFF6600 		.string	"\036\377f"
+ 605 0d96 1EFF6600 		.string	"\036\377f"
+ 606 0d9a 1EFF6600 		.string	"\036\377f"
+ 607 0d9e 1EFF6600 		.string	"\036\377f"
+ 608 0da2 1EFF6600 		.string	"\036\377f"
+ 609 0da6 1EFF6600 		.string	"\036\377f"
+ 610 0daa 1EFF6600 		.string	"\036\377f"
+ 611 0dae 1EFF6600 		.string	"\036\377f"
+ 612 0db2 1EFF6600 		.string	"\036\377f"
+ 613 0db6 1EFF6600 		.string	"\036\377f"
+ 614 0dba 1EFF6600 		.string	"\036\377f"
+ 615 0dbe 1EFF6600 		.string	"\036\377f"
+ 616 0dc2 1EFF6600 		.string	"\036\377f"
+ 617 0dc6 1EFF6600 		.string	"\036\377f"
+ 618 0dca 1EFF6600 		.string	"\036\377f"
+ 619 0dce 1EFF6600 		.string	"\036\377f"
+ 620 0dd2 1EFF6600 		.string	"\036\377f"
+ 621 0dd6 1EFF6600 		.string	"\036\377f"
+ 622 0dda 1EFF6600 		.string	"\036\377f"
+ 623 0dde 1EFF6600 		.string	"\036\377f"
+ 624 0de2 1EFF6600 		.string	"\036\377f"
+ 625 0de6 1EFF6600 		.string	"\036\377f"
+ 626 0dea 1EFF6600 		.string	"\036\377f"
+ 627 0dee 1EFF6600 		.string	"\036\377f"
+ 628 0df2 1EFF6600 		.string	"\036\377f"
+ 629 0df6 1EFF6600 		.string	"\036\377f"
+GAS LISTING /tmp/ccNTHH7d.s 			page 16
+
+
+ 630 0dfa 1EFF6600 		.string	"\036\377f"
+ 631 0dfe 1EFF6600 		.string	"\036\377f"
+ 632 0e02 1EFF6600 		.string	"\036\377f"
+ 633 0e06 1EFF6600 		.string	"\036\377f"
+ 634 0e0a 1EFF6600 		.string	"\036\377f"
+ 635 0e0e 1EFF6600 		.string	"\036\377f"
+ 636 0e12 1EFF6600 		.string	"\036\377f"
+ 637 0e16 1EFF6600 		.string	"\036\377f"
+ 638 0e1a 1EFF6600 		.string	"\036\377f"
+ 639 0e1e 1EFF6600 		.string	"\036\377f"
+ 640 0e22 1EFF6600 		.string	"\036\377f"
+ 641 0e26 1EFF6600 		.string	"\036\377f"
+ 642 0e2a 1EFF6600 		.string	"\036\377f"
+ 643 0e2e 1EFF6600 		.string	"\036\377f"
+ 644 0e32 1EFF6600 		.string	"\036\377f"
+ 645 0e36 1EFF6600 		.string	"\036\377f"
+ 646 0e3a 1EFF6600 		.string	"\036\377f"
+ 647 0e3e 1EFF6600 		.string	"\036\377f"
+ 648 0e42 1EFF6600 		.string	"\036\377f"
+ 649 0e46 1EFF6600 		.string	"\036\377f"
+ 650 0e4a 1EFF6600 		.string	"\036\377f"
+ 651 0e4e 1EFF6600 		.string	"\036\377f"
+ 652 0e52 1EFF6600 		.string	"\036\377f"
+ 653 0e56 1EFF6600 		.string	"\036\377f"
+ 654 0e5a 1EFF6600 		.string	"\036\377f"
+ 655 0e5e 1EFF6600 		.string	"\036\377f"
+ 656 0e62 1EFF6600 		.string	"\036\377f"
+ 657 0e66 1EFF6600 		.string	"\036\377f"
+ 658 0e6a 1EFF6600 		.string	"\036\377f"
+ 659 0e6e 1EFF6600 		.string	"\036\377f"
+ 660 0e72 1EFF6600 		.string	"\036\377f"
+ 661 0e76 1EFF6600 		.string	"\036\377f"
+ 662 0e7a 1EFF6600 		.string	"\036\377f"
+ 663 0e7e 1EFF6600 		.string	"\036\377f"
+ 664 0e82 1EFF6600 		.string	"\036\377f"
+ 665 0e86 1EFF6600 		.string	"\036\377f"
+ 666 0e8a 1EFF6600 		.string	"\036\377f"
+ 667 0e8e 1EFF6600 		.string	"\036\377f"
+ 668 0e92 1EFF6600 		.string	"\036\377f"
+ 669 0e96 1EFF6600 		.string	"\036\377f"
+ 670 0e9a 1EFF6600 		.string	"\036\377f"
+ 671 0e9e 1EFF6600 		.string	"\036\377f"
+ 672 0ea2 1EFF6600 		.string	"\036\377f"
+ 673 0ea6 1EFF6600 		.string	"\036\377f"
+ 674 0eaa 1EFF6600 		.string	"\036\377f"
+ 675 0eae 1EFF6600 		.string	"\036\377f"
+ 676 0eb2 1EFF6600 		.string	"\036\377f"
+ 677 0eb6 1EFF6600 		.string	"\036\377f"
+ 678 0eba 1EFF6600 		.string	"\036\377f"
+ 679 0ebe 1EFF6600 		.string	"\036\377f"
+ 680 0ec2 1EFF6600 		.string	"\036\377f"
+ 681 0ec6 1EFF6600 		.string	"\036\377f"
+ 682 0eca 1EFF6600 		.string	"\036\377f"
+ 683 0ece 1EFF6600 		.string	"\036\377f"
+ 684 0ed2 1EFF6600 		.string	"\036\377f"
+ 685 0ed6 1EFF6600 		.string	"\036\377f"
+ 686 0eda 1EFF6600 		.string	"\036\377f"
+GAS LISTING /tmp/ccNTHH7d.s 			page 17
+
+
+ 687 0ede 1EFF6600 		.string	"\036\377f"
+ 688 0ee2 1EFF6600 		.string	"\036\377f"
+ 689 0ee6 1EFF6600 		.string	"\036\377f"
+ 690 0eea 1EFF6600 		.string	"\036\377f"
+ 691 0eee 1EFF6600 		.string	"\036\377f"
+ 692 0ef2 1EFF6600 		.string	"\036\377f"
+ 693 0ef6 1EFF6600 		.string	"\036\377f"
+ 694 0efa 1EFF6600 		.string	"\036\377f"
+ 695 0efe 1EFF6600 		.string	"\036\377f"
+ 696 0f02 1EFF6600 		.string	"\036\377f"
+ 697 0f06 1EFF6600 		.string	"\036\377f"
+ 698 0f0a 1EFF6600 		.string	"\036\377f"
+ 699 0f0e 1EFF6600 		.string	"\036\377f"
+ 700 0f12 1EFF6600 		.string	"\036\377f"
+ 701 0f16 1EFF6600 		.string	"\036\377f"
+ 702 0f1a 1EFF6600 		.string	"\036\377f"
+ 703 0f1e 1EFF6600 		.string	"\036\377f"
+ 704 0f22 1EFF6600 		.string	"\036\377f"
+ 705 0f26 1EFF6600 		.string	"\036\377f"
+ 706 0f2a 1EFF6600 		.string	"\036\377f"
+ 707 0f2e 1EFF6600 		.string	"\036\377f"
+ 708 0f32 1EFF6600 		.string	"\036\377f"
+ 709 0f36 1EFF6600 		.string	"\036\377f"
+ 710 0f3a 1EFF6600 		.string	"\036\377f"
+ 711 0f3e 1EFF6600 		.string	"\036\377f"
+ 712 0f42 1EFF6600 		.string	"\036\377f"
+ 713 0f46 1EFF6600 		.string	"\036\377f"
+ 714 0f4a 1EFF6600 		.string	"\036\377f"
+ 715 0f4e 1EFF6600 		.string	"\036\377f"
+ 716 0f52 1EFF6600 		.string	"\036\377f"
+ 717 0f56 1EFF6600 		.string	"\036\377f"
+ 718 0f5a 1EFF6600 		.string	"\036\377f"
+ 719 0f5e 1EFF6600 		.string	"\036\377f"
+ 720 0f62 1EFF6600 		.string	"\036\377f"
+ 721 0f66 1EFF6600 		.string	"\036\377f"
+ 722 0f6a 1EFF6600 		.string	"\036\377f"
+ 723 0f6e 1EFF6600 		.string	"\036\377f"
+ 724 0f72 1EFF6600 		.string	"\036\377f"
+ 725 0f76 1EFF6600 		.string	"\036\377f"
+ 726 0f7a 1EFF6600 		.string	"\036\377f"
+ 727 0f7e 1EFF6600 		.string	"\036\377f"
+ 728 0f82 1EFF6600 		.string	"\036\377f"
+ 729 0f86 1EFF6600 		.string	"\036\377f"
+ 730 0f8a 1EFF6600 		.string	"\036\377f"
+ 731 0f8e 1EFF6600 		.string	"\036\377f"
+ 732 0f92 1EFF6600 		.string	"\036\377f"
+ 733 0f96 1EFF6600 		.string	"\036\377f"
+ 734 0f9a 1EFF6600 		.string	"\036\377f"
+ 735 0f9e 1EFF     		.ascii	"\036\377"
+ 736 0fa0 6600     		.string	"f"
+ 737 0fa2 1EFF6600 		.string	"\036\377f"
+ 738 0fa6 1EFF6600 		.string	"\036\377f"
+ 739 0faa 1EFF6600 		.string	"\036\377f"
+ 740 0fae 1EFF6600 		.string	"\036\377f"
+ 741 0fb2 1EFF6600 		.string	"\036\377f"
+ 742 0fb6 1EFF6600 		.string	"\036\377f"
+ 743 0fba 1EFF6600 		.string	"\036\377f"
+GAS LISTING /tmp/ccNTHH7d.s 			page 18
+
+
+ 744 0fbe 1EFF6600 		.string	"\036\377f"
+ 745 0fc2 1EFF6600 		.string	"\036\377f"
+ 746 0fc6 1EFF6600 		.string	"\036\377f"
+ 747 0fca 1EFF6600 		.string	"\036\377f"
+ 748 0fce 1EFF6600 		.string	"\036\377f"
+ 749 0fd2 1EFF6600 		.string	"\036\377f"
+ 750 0fd6 1EFF6600 		.string	"\036\377f"
+ 751 0fda 1EFF6600 		.string	"\036\377f"
+ 752 0fde 1EFF6600 		.string	"\036\377f"
+ 753 0fe2 1EFF6600 		.string	"\036\377f"
+ 754 0fe6 1EFF6600 		.string	"\036\377f"
+ 755 0fea 1EFF6600 		.string	"\036\377f"
+ 756 0fee 1EFF6600 		.string	"\036\377f"
+ 757 0ff2 1EFF6600 		.string	"\036\377f"
+ 758 0ff6 1EFF6600 		.string	"\036\377f"
+ 759 0ffa 1EFF6600 		.string	"\036\377f"
+ 760 0ffe 1EFF6600 		.string	"\036\377f"
+ 761 1002 1EFF     		.ascii	"\036\377"
+ 762              		.globl	heatmap_cs_RdGy_mixed
+ 763              		.section	.data.rel.local
+ 764              		.align 8
+ 765              		.type	heatmap_cs_RdGy_mixed, @object
+ 766              		.size	heatmap_cs_RdGy_mixed, 8
+ 767              	heatmap_cs_RdGy_mixed:
+ 768 0008 00000000 		.quad	mixed
+ 768      00000000 
+ 769              		.section	.data.rel.ro.local
+ 770              		.align 16
+ 771              		.type	mixed, @object
+ 772              		.size	mixed, 16
+ 773              	mixed:
+ 774 0010 00000000 		.quad	mixed_data
+ 774      00000000 
+ 775 0018 01040000 		.quad	1025
+ 775      00000000 
+ 776              		.section	.rodata
+ 777 1004 00000000 		.align 32
+ 777      00000000 
+ 777      00000000 
+ 777      00000000 
+ 777      00000000 
+ 778              		.type	mixed_data, @object
+ 779              		.size	mixed_data, 4100
+ 780              	mixed_data:
+ 781 1020 00       		.string	""
+ 782 1021 00       		.string	""
+ 783 1022 00       		.string	""
+ 784 1023 00       		.string	""
+ 785 1024 1A191A00 		.string	"\032\031\032"
+ 786 1028 1A1A1A07 		.ascii	"\032\032\032\007\032\032\032\016\033\033\033\026\033\033\033"
+ 786      1A1A1A0E 
+ 786      1B1B1B16 
+ 786      1B1B1B
+ 787 1037 1D1B1B1B 		.ascii	"\035\033\033\033%\034\034\034,\034\034\0344\034\034\034;\035"
+ 787      251C1C1C 
+ 787      2C1C1C1C 
+ 787      341C1C1C 
+GAS LISTING /tmp/ccNTHH7d.s 			page 19
+
+
+ 787      3B1D
+ 788 1049 1D1D431D 		.ascii	"\035\035C\035\035\035J\036\036\036R\036\036\036Y\036\036\036"
+ 788      1D1D4A1E 
+ 788      1E1E521E 
+ 788      1E1E591E 
+ 788      1E1E
+ 789 105b 611F1F1F 		.ascii	"a\037\037\037h\037\037\037p\037\037\037w   \177   \206!!!\215"
+ 789      681F1F1F 
+ 789      701F1F1F 
+ 789      77202020 
+ 789      7F202020 
+ 790 1074 21212195 		.ascii	"!!!\225!!!\234\"\"\"\244\"\"\"\253\"\"\"\263###\272###\302$$"
+ 790      2121219C 
+ 790      222222A4 
+ 790      222222AB 
+ 790      222222B3 
+ 791 1092 24C92424 		.ascii	"$\311$$$\321$$$\330%%%\340%%%\347&&&\357&&&\366&&&\376'''\377"
+ 791      24D12424 
+ 791      24D82525 
+ 791      25E02525 
+ 791      25E72626 
+ 792 10b4 272727FF 		.ascii	"'''\377'''\377(((\377(((\377)))\377)))\377)))\377***\377***\377"
+ 792      272727FF 
+ 792      282828FF 
+ 792      282828FF 
+ 792      292929FF 
+ 793 10d8 2B2B2BFF 		.ascii	"+++\377+++\377+++\377,,,\377,,,\377---\377---\377888\377888\377"
+ 793      2B2B2BFF 
+ 793      2B2B2BFF 
+ 793      2C2C2CFF 
+ 793      2C2C2CFF 
+ 794 10fc 383838FF 		.ascii	"888\377999\377999\377:::\377:::\377:::\377;;;\377;;;\377<<<\377"
+ 794      393939FF 
+ 794      393939FF 
+ 794      3A3A3AFF 
+ 794      3A3A3AFF 
+ 795 1120 3C3C3CFF 		.ascii	"<<<\377<<<\377===\377===\377>>>\377>>>\377>>>\377???\377???\377"
+ 795      3C3C3CFF 
+ 795      3D3D3DFF 
+ 795      3D3D3DFF 
+ 795      3E3E3EFF 
+ 796 1144 404040FF 		.ascii	"@@@\377@@@\377AAA\377AAA\377AAA\377BBB\377BBB\377CCC\377CCC\377"
+ 796      404040FF 
+ 796      414141FF 
+ 796      414141FF 
+ 796      414141FF 
+ 797 1168 434343FF 		.ascii	"CCC\377DDD\377DDD\377EEE\377EEE\377FFF\377FFF\377FFF\377GGG\377"
+ 797      444444FF 
+ 797      444444FF 
+ 797      454545FF 
+ 797      454545FF 
+ 798 118c 474747FF 		.ascii	"GGG\377HHH\377HHH\377HHH\377III\377III\377JJJ\377JJJ\377KKK\377"
+ 798      484848FF 
+ 798      484848FF 
+ 798      484848FF 
+ 798      494949FF 
+ 799 11b0 4B4B4BFF 		.ascii	"KKK\377KKK\377LLL\377LLL\377MMM\377MMM\377NNN\377NNN\377NNN\377"
+GAS LISTING /tmp/ccNTHH7d.s 			page 20
+
+
+ 799      4B4B4BFF 
+ 799      4C4C4CFF 
+ 799      4C4C4CFF 
+ 799      4D4D4DFF 
+ 800 11d4 4F4F4FFF 		.ascii	"OOO\377OOO\377PPP\377PPP\377QQQ\377QQQ\377RRR\377RRR\377RRR\377"
+ 800      4F4F4FFF 
+ 800      505050FF 
+ 800      505050FF 
+ 800      515151FF 
+ 801 11f8 535353FF 		.ascii	"SSS\377SSS\377TTT\377TTT\377UUU\377UUU\377UUU\377VVV\377VVV\377"
+ 801      535353FF 
+ 801      545454FF 
+ 801      545454FF 
+ 801      555555FF 
+ 802 121c 575757FF 		.ascii	"WWW\377WWW\377XXX\377XXX\377YYY\377YYY\377YYY\377ZZZ\377ZZZ\377"
+ 802      575757FF 
+ 802      585858FF 
+ 802      585858FF 
+ 802      595959FF 
+ 803 1240 5B5B5BFF 		.ascii	"[[[\377[[[\377\\\\\\\377\\\\\\\377]]]\377]]]\377]]]\377^^^\377"
+ 803      5B5B5BFF 
+ 803      5C5C5CFF 
+ 803      5C5C5CFF 
+ 803      5D5D5DFF 
+ 804 1260 5E5E5EFF 		.ascii	"^^^\377___\377___\377```\377```\377aaa\377aaa\377bbb\377bbb\377"
+ 804      5F5F5FFF 
+ 804      5F5F5FFF 
+ 804      606060FF 
+ 804      606060FF 
+ 805 1284 626262FF 		.ascii	"bbb\377ccc\377ooo\377ooo\377ppp\377ppp\377qqq\377qqq\377rrr\377"
+ 805      636363FF 
+ 805      6F6F6FFF 
+ 805      6F6F6FFF 
+ 805      707070FF 
+ 806 12a8 727272FF 		.ascii	"rrr\377sss\377sss\377sss\377ttt\377ttt\377uuu\377uuu\377vvv\377"
+ 806      737373FF 
+ 806      737373FF 
+ 806      737373FF 
+ 806      747474FF 
+ 807 12cc 767676FF 		.ascii	"vvv\377www\377www\377xxx\377xxx\377yyy\377yyy\377yyy\377zzz\377"
+ 807      777777FF 
+ 807      777777FF 
+ 807      787878FF 
+ 807      787878FF 
+ 808 12f0 7A7A7AFF 		.ascii	"zzz\377{{{\377{{{\377|||\377|||\377}}}\377}}}\377~~~\377~~~\377"
+ 808      7B7B7BFF 
+ 808      7B7B7BFF 
+ 808      7C7C7CFF 
+ 808      7C7C7CFF 
+ 809 1314 7F7F7FFF 		.ascii	"\177\177\177\377\177\177\177\377\200\200\200\377\200\200\200"
+ 809      7F7F7FFF 
+ 809      808080FF 
+ 809      808080
+ 810 1323 FF808080 		.ascii	"\377\200\200\200\377\201\201\201\377\201\201\201\377\202\202"
+ 810      FF818181 
+ 810      FF818181 
+ 810      FF8282
+GAS LISTING /tmp/ccNTHH7d.s 			page 21
+
+
+ 811 1332 82FF8282 		.ascii	"\202\377\202\202\202\377\203\203\203\377\203\203\203\377\204"
+ 811      82FF8383 
+ 811      83FF8383 
+ 811      83FF84
+ 812 1341 8484FF84 		.ascii	"\204\204\377\204\204\204\377\205\205\205\377\205\205\205\377"
+ 812      8484FF85 
+ 812      8585FF85 
+ 812      8585FF
+ 813 1350 868686FF 		.ascii	"\206\206\206\377\206\206\206\377\207\207\207\377\207\207\207"
+ 813      868686FF 
+ 813      878787FF 
+ 813      878787
+ 814 135f FF878787 		.ascii	"\377\207\207\207\377\210\210\210\377\210\210\210\377\211\211"
+ 814      FF888888 
+ 814      FF888888 
+ 814      FF8989
+ 815 136e 89FF8989 		.ascii	"\211\377\211\211\211\377\211\211\211\377\212\212\212\377\212"
+ 815      89FF8989 
+ 815      89FF8A8A 
+ 815      8AFF8A
+ 816 137d 8A8AFF8A 		.ascii	"\212\212\377\212\212\212\377\213\213\213\377\213\213\213\377"
+ 816      8A8AFF8B 
+ 816      8B8BFF8B 
+ 816      8B8BFF
+ 817 138c 8C8C8CFF 		.ascii	"\214\214\214\377\214\214\214\377\214\214\214\377\215\215\215"
+ 817      8C8C8CFF 
+ 817      8C8C8CFF 
+ 817      8D8D8D
+ 818 139b FF8D8D8D 		.ascii	"\377\215\215\215\377\216\216\216\377\216\216\216\377\216\216"
+ 818      FF8E8E8E 
+ 818      FF8E8E8E 
+ 818      FF8E8E
+ 819 13aa 8EFF8F8F 		.ascii	"\216\377\217\217\217\377\217\217\217\377\220\220\220\377\220"
+ 819      8FFF8F8F 
+ 819      8FFF9090 
+ 819      90FF90
+ 820 13b9 9090FF90 		.ascii	"\220\220\377\220\220\220\377\221\221\221\377\221\221\221\377"
+ 820      9090FF91 
+ 820      9191FF91 
+ 820      9191FF
+ 821 13c8 919191FF 		.ascii	"\221\221\221\377\222\222\222\377\222\222\222\377\223\223\223"
+ 821      929292FF 
+ 821      929292FF 
+ 821      939393
+ 822 13d7 FF939393 		.ascii	"\377\223\223\223\377\223\223\223\377\224\224\224\377\224\224"
+ 822      FF939393 
+ 822      FF949494 
+ 822      FF9494
+ 823 13e6 94FF9595 		.ascii	"\224\377\225\225\225\377\225\225\225\377\225\225\225\377\226"
+ 823      95FF9595 
+ 823      95FF9595 
+ 823      95FF96
+ 824 13f5 9696FF96 		.ascii	"\226\226\377\226\226\226\377\227\227\227\377\227\227\227\377"
+ 824      9696FF97 
+ 824      9797FF97 
+ 824      9797FF
+ 825 1404 979797FF 		.ascii	"\227\227\227\377\230\230\230\377\230\230\230\377\231\231\231"
+GAS LISTING /tmp/ccNTHH7d.s 			page 22
+
+
+ 825      989898FF 
+ 825      989898FF 
+ 825      999999
+ 826 1413 FF999999 		.ascii	"\377\231\231\231\377\231\231\231\377\232\232\232\377\232\232"
+ 826      FF999999 
+ 826      FF9A9A9A 
+ 826      FF9A9A
+ 827 1422 9AFFA5A5 		.ascii	"\232\377\245\245\245\377\245\245\245\377\246\246\246\377\246"
+ 827      A5FFA5A5 
+ 827      A5FFA6A6 
+ 827      A6FFA6
+ 828 1431 A6A6FFA6 		.ascii	"\246\246\377\246\246\246\377\247\247\247\377\247\247\247\377"
+ 828      A6A6FFA7 
+ 828      A7A7FFA7 
+ 828      A7A7FF
+ 829 1440 A8A8A8FF 		.ascii	"\250\250\250\377\250\250\250\377\250\250\250\377\251\251\251"
+ 829      A8A8A8FF 
+ 829      A8A8A8FF 
+ 829      A9A9A9
+ 830 144f FFA9A9A9 		.ascii	"\377\251\251\251\377\252\252\252\377\252\252\252\377\252\252"
+ 830      FFAAAAAA 
+ 830      FFAAAAAA 
+ 830      FFAAAA
+ 831 145e AAFFABAB 		.ascii	"\252\377\253\253\253\377\253\253\253\377\254\254\254\377\254"
+ 831      ABFFABAB 
+ 831      ABFFACAC 
+ 831      ACFFAC
+ 832 146d ACACFFAC 		.ascii	"\254\254\377\254\254\254\377\255\255\255\377\255\255\255\377"
+ 832      ACACFFAD 
+ 832      ADADFFAD 
+ 832      ADADFF
+ 833 147c AEAEAEFF 		.ascii	"\256\256\256\377\256\256\256\377\256\256\256\377\257\257\257"
+ 833      AEAEAEFF 
+ 833      AEAEAEFF 
+ 833      AFAFAF
+ 834 148b FFAFAFAF 		.ascii	"\377\257\257\257\377\260\260\260\377\260\260\260\377\260\260"
+ 834      FFB0B0B0 
+ 834      FFB0B0B0 
+ 834      FFB0B0
+ 835 149a B0FFB1B1 		.ascii	"\260\377\261\261\261\377\261\261\261\377\262\262\262\377\262"
+ 835      B1FFB1B1 
+ 835      B1FFB2B2 
+ 835      B2FFB2
+ 836 14a9 B2B2FFB2 		.ascii	"\262\262\377\262\262\262\377\263\263\263\377\263\263\263\377"
+ 836      B2B2FFB3 
+ 836      B3B3FFB3 
+ 836      B3B3FF
+ 837 14b8 B4B4B4FF 		.ascii	"\264\264\264\377\264\264\264\377\265\265\265\377\265\265\265"
+ 837      B4B4B4FF 
+ 837      B5B5B5FF 
+ 837      B5B5B5
+ 838 14c7 FFB5B5B5 		.ascii	"\377\265\265\265\377\266\266\266\377\266\266\266\377\267\267"
+ 838      FFB6B6B6 
+ 838      FFB6B6B6 
+ 838      FFB7B7
+ 839 14d6 B7FFB7B7 		.ascii	"\267\377\267\267\267\377\267\267\267\377\270\270\270\377\270"
+ 839      B7FFB7B7 
+GAS LISTING /tmp/ccNTHH7d.s 			page 23
+
+
+ 839      B7FFB8B8 
+ 839      B8FFB8
+ 840 14e5 B8B8FFB9 		.ascii	"\270\270\377\271\271\271\377\271\271\271\377\271\271\271\377"
+ 840      B9B9FFB9 
+ 840      B9B9FFB9 
+ 840      B9B9FF
+ 841 14f4 BABABAFF 		.ascii	"\272\272\272\377\272\272\272\377\272\272\272\377\273\273\273"
+ 841      BABABAFF 
+ 841      BABABAFF 
+ 841      BBBBBB
+ 842 1503 FFBBBBBB 		.ascii	"\377\273\273\273\377\273\273\273\377\273\273\273\377\274\274"
+ 842      FFBBBBBB 
+ 842      FFBBBBBB 
+ 842      FFBCBC
+ 843 1512 BCFFBCBC 		.ascii	"\274\377\274\274\274\377\274\274\274\377\275\275\275\377\275"
+ 843      BCFFBCBC 
+ 843      BCFFBDBD 
+ 843      BDFFBD
+ 844 1521 BDBDFFBD 		.ascii	"\275\275\377\275\275\275\377\276\276\276\377\276\276\276\377"
+ 844      BDBDFFBE 
+ 844      BEBEFFBE 
+ 844      BEBEFF
+ 845 1530 BEBEBEFF 		.ascii	"\276\276\276\377\276\276\276\377\277\277\277\377\277\277\277"
+ 845      BEBEBEFF 
+ 845      BFBFBFFF 
+ 845      BFBFBF
+ 846 153f FFBFBFBF 		.ascii	"\377\277\277\277\377\300\300\300\377\300\300\300\377\300\300"
+ 846      FFC0C0C0 
+ 846      FFC0C0C0 
+ 846      FFC0C0
+ 847 154e C0FFC0C0 		.ascii	"\300\377\300\300\300\377\301\301\301\377\301\301\301\377\301"
+ 847      C0FFC1C1 
+ 847      C1FFC1C1 
+ 847      C1FFC1
+ 848 155d C1C1FFC2 		.ascii	"\301\301\377\302\302\302\377\302\302\302\377\302\302\302\377"
+ 848      C2C2FFC2 
+ 848      C2C2FFC2 
+ 848      C2C2FF
+ 849 156c C3C3C3FF 		.ascii	"\303\303\303\377\303\303\303\377\303\303\303\377\303\303\303"
+ 849      C3C3C3FF 
+ 849      C3C3C3FF 
+ 849      C3C3C3
+ 850 157b FFC4C4C4 		.ascii	"\377\304\304\304\377\304\304\304\377\304\304\304\377\305\305"
+ 850      FFC4C4C4 
+ 850      FFC4C4C4 
+ 850      FFC5C5
+ 851 158a C5FFC5C5 		.ascii	"\305\377\305\305\305\377\305\305\305\377\305\305\305\377\306"
+ 851      C5FFC5C5 
+ 851      C5FFC5C5 
+ 851      C5FFC6
+ 852 1599 C6C6FFC6 		.ascii	"\306\306\377\306\306\306\377\306\306\306\377\307\307\307\377"
+ 852      C6C6FFC6 
+ 852      C6C6FFC7 
+ 852      C7C7FF
+ 853 15a8 C7C7C7FF 		.ascii	"\307\307\307\377\307\307\307\377\310\310\310\377\310\310\310"
+ 853      C7C7C7FF 
+ 853      C8C8C8FF 
+GAS LISTING /tmp/ccNTHH7d.s 			page 24
+
+
+ 853      C8C8C8
+ 854 15b7 FFC8C8C8 		.ascii	"\377\310\310\310\377\310\310\310\377\320\320\320\377\321\321"
+ 854      FFC8C8C8 
+ 854      FFD0D0D0 
+ 854      FFD1D1
+ 855 15c6 D1FFD1D1 		.ascii	"\321\377\321\321\321\377\321\321\321\377\322\322\322\377\322"
+ 855      D1FFD1D1 
+ 855      D1FFD2D2 
+ 855      D2FFD2
+ 856 15d5 D2D2FFD2 		.ascii	"\322\322\377\322\322\322\377\322\322\322\377\323\323\323\377"
+ 856      D2D2FFD2 
+ 856      D2D2FFD3 
+ 856      D3D3FF
+ 857 15e4 D3D3D3FF 		.ascii	"\323\323\323\377\323\323\323\377\324\324\324\377\324\324\324"
+ 857      D3D3D3FF 
+ 857      D4D4D4FF 
+ 857      D4D4D4
+ 858 15f3 FFD4D4D4 		.ascii	"\377\324\324\324\377\325\325\325\377\325\325\325\377\325\325"
+ 858      FFD5D5D5 
+ 858      FFD5D5D5 
+ 858      FFD5D5
+ 859 1602 D5FFD5D5 		.ascii	"\325\377\325\325\325\377\326\326\326\377\326\326\326\377\326"
+ 859      D5FFD6D6 
+ 859      D6FFD6D6 
+ 859      D6FFD6
+ 860 1611 D6D6FFD7 		.ascii	"\326\326\377\327\327\327\377\327\327\327\377\327\327\327\377"
+ 860      D7D7FFD7 
+ 860      D7D7FFD7 
+ 860      D7D7FF
+ 861 1620 D8D8D8FF 		.ascii	"\330\330\330\377\330\330\330\377\330\330\330\377\330\330\330"
+ 861      D8D8D8FF 
+ 861      D8D8D8FF 
+ 861      D8D8D8
+ 862 162f FFD9D9D9 		.ascii	"\377\331\331\331\377\331\331\331\377\331\331\331\377\332\332"
+ 862      FFD9D9D9 
+ 862      FFD9D9D9 
+ 862      FFDADA
+ 863 163e DAFFDADA 		.ascii	"\332\377\332\332\332\377\332\332\332\377\333\333\333\377\333"
+ 863      DAFFDADA 
+ 863      DAFFDBDB 
+ 863      DBFFDB
+ 864 164d DBDBFFDB 		.ascii	"\333\333\377\333\333\333\377\333\333\333\377\334\334\334\377"
+ 864      DBDBFFDB 
+ 864      DBDBFFDC 
+ 864      DCDCFF
+ 865 165c DCDCDCFF 		.ascii	"\334\334\334\377\334\334\334\377\335\335\335\377\335\335\335"
+ 865      DCDCDCFF 
+ 865      DDDDDDFF 
+ 865      DDDDDD
+ 866 166b FFDDDDDD 		.ascii	"\377\335\335\335\377\336\336\336\377\336\336\336\377\336\336"
+ 866      FFDEDEDE 
+ 866      FFDEDEDE 
+ 866      FFDEDE
+ 867 167a DEFFDEDE 		.ascii	"\336\377\336\336\336\377\337\337\337\377\337\337\337\377\337"
+ 867      DEFFDFDF 
+ 867      DFFFDFDF 
+ 867      DFFFDF
+GAS LISTING /tmp/ccNTHH7d.s 			page 25
+
+
+ 868 1689 DFDFFFE0 		.ascii	"\337\337\377\340\340\340\377\340\340\340\377\340\340\340\377"
+ 868      E0E0FFE0 
+ 868      E0E0FFE0 
+ 868      E0E0FF
+ 869 1698 E0E0E0FF 		.ascii	"\340\340\340\377\341\341\341\377\341\341\341\377\341\341\341"
+ 869      E1E1E1FF 
+ 869      E1E1E1FF 
+ 869      E1E1E1
+ 870 16a7 FFE1E1E1 		.ascii	"\377\341\341\341\377\342\342\342\377\342\342\342\377\342\342"
+ 870      FFE2E2E2 
+ 870      FFE2E2E2 
+ 870      FFE2E2
+ 871 16b6 E2FFE2E2 		.ascii	"\342\377\342\342\342\377\342\342\342\377\343\343\343\377\343"
+ 871      E2FFE2E2 
+ 871      E2FFE3E3 
+ 871      E3FFE3
+ 872 16c5 E3E3FFE3 		.ascii	"\343\343\377\343\343\343\377\343\343\343\377\344\344\344\377"
+ 872      E3E3FFE3 
+ 872      E3E3FFE4 
+ 872      E4E4FF
+ 873 16d4 E4E4E4FF 		.ascii	"\344\344\344\377\344\344\344\377\344\344\344\377\345\345\345"
+ 873      E4E4E4FF 
+ 873      E4E4E4FF 
+ 873      E5E5E5
+ 874 16e3 FFE5E5E5 		.ascii	"\377\345\345\345\377\345\345\345\377\345\345\345\377\346\346"
+ 874      FFE5E5E5 
+ 874      FFE5E5E5 
+ 874      FFE6E6
+ 875 16f2 E6FFE6E6 		.ascii	"\346\377\346\346\346\377\346\346\346\377\346\346\346\377\347"
+ 875      E6FFE6E6 
+ 875      E6FFE6E6 
+ 875      E6FFE7
+ 876 1701 E7E7FFE7 		.ascii	"\347\347\377\347\347\347\377\347\347\347\377\347\347\347\377"
+ 876      E7E7FFE7 
+ 876      E7E7FFE7 
+ 876      E7E7FF
+ 877 1710 E8E8E8FF 		.ascii	"\350\350\350\377\350\350\350\377\350\350\350\377\350\350\350"
+ 877      E8E8E8FF 
+ 877      E8E8E8FF 
+ 877      E8E8E8
+ 878 171f FFE8E8E8 		.ascii	"\377\350\350\350\377\351\351\351\377\351\351\351\377\351\351"
+ 878      FFE9E9E9 
+ 878      FFE9E9E9 
+ 878      FFE9E9
+ 879 172e E9FFE9E9 		.ascii	"\351\377\351\351\351\377\352\352\352\377\352\352\352\377\352"
+ 879      E9FFEAEA 
+ 879      EAFFEAEA 
+ 879      EAFFEA
+ 880 173d EAEAFFEA 		.ascii	"\352\352\377\352\352\352\377\353\353\353\377\353\353\353\377"
+ 880      EAEAFFEB 
+ 880      EBEBFFEB 
+ 880      EBEBFF
+ 881 174c EBEBEBFF 		.ascii	"\353\353\353\377\353\353\353\377\354\354\354\377\362\362\362"
+ 881      EBEBEBFF 
+ 881      ECECECFF 
+ 881      F2F2F2
+ 882 175b FFF2F2F2 		.ascii	"\377\362\362\362\377\363\363\363\377\363\363\363\377\363\363"
+GAS LISTING /tmp/ccNTHH7d.s 			page 26
+
+
+ 882      FFF3F3F3 
+ 882      FFF3F3F3 
+ 882      FFF3F3
+ 883 176a F3FFF3F3 		.ascii	"\363\377\363\363\363\377\364\364\364\377\364\364\364\377\364"
+ 883      F3FFF4F4 
+ 883      F4FFF4F4 
+ 883      F4FFF4
+ 884 1779 F4F4FFF4 		.ascii	"\364\364\377\364\364\364\377\364\364\364\377\365\365\365\377"
+ 884      F4F4FFF4 
+ 884      F4F4FFF5 
+ 884      F5F5FF
+ 885 1788 F5F5F5FF 		.ascii	"\365\365\365\377\365\365\365\377\365\365\365\377\366\366\366"
+ 885      F5F5F5FF 
+ 885      F5F5F5FF 
+ 885      F6F6F6
+ 886 1797 FFF6F6F6 		.ascii	"\377\366\366\366\377\366\366\366\377\366\366\366\377\367\367"
+ 886      FFF6F6F6 
+ 886      FFF6F6F6 
+ 886      FFF7F7
+ 887 17a6 F7FFF7F7 		.ascii	"\367\377\367\367\367\377\367\367\367\377\367\367\367\377\370"
+ 887      F7FFF7F7 
+ 887      F7FFF7F7 
+ 887      F7FFF8
+ 888 17b5 F8F8FFF8 		.ascii	"\370\370\377\370\370\370\377\370\370\370\377\370\370\370\377"
+ 888      F8F8FFF8 
+ 888      F8F8FFF8 
+ 888      F8F8FF
+ 889 17c4 F9F9F9FF 		.ascii	"\371\371\371\377\371\371\371\377\371\371\371\377\371\371\371"
+ 889      F9F9F9FF 
+ 889      F9F9F9FF 
+ 889      F9F9F9
+ 890 17d3 FFFAFAFA 		.ascii	"\377\372\372\372\377\372\372\372\377\372\372\372\377\372\372"
+ 890      FFFAFAFA 
+ 890      FFFAFAFA 
+ 890      FFFAFA
+ 891 17e2 FAFFFBFB 		.ascii	"\372\377\373\373\373\377\373\373\373\377\373\373\373\377"
+ 891      FBFFFBFB 
+ 891      FBFFFBFB 
+ 891      FBFF
+ 892 17f0 FBFBFBFF 		.ascii	"\373\373\373\377\374\374\374\377\374\374\374\377\374\374\374"
+ 892      FCFCFCFF 
+ 892      FCFCFCFF 
+ 892      FCFCFC
+ 893 17ff FFFCFCFC 		.ascii	"\377\374\374\374\377\375\375\375\377\375\375\375\377\375\375"
+ 893      FFFDFDFD 
+ 893      FFFDFDFD 
+ 893      FFFDFD
+ 894 180e FDFFFDFD 		.ascii	"\375\377\375\375\375\377\376\376\376\377\376\376\376\377\376"
+ 894      FDFFFEFE 
+ 894      FEFFFEFE 
+ 894      FEFFFE
+ 895 181d FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\377\376\377\377\377\376\376\377"
+ 895      FEFEFFFF 
+ 895      FEFFFFFF 
+ 895      FEFEFF
+ 896 182c FFFEFEFF 		.ascii	"\377\376\376\377\377\376\376\377\377\375\376\377\377\375\375"
+ 896      FFFEFEFF 
+GAS LISTING /tmp/ccNTHH7d.s 			page 27
+
+
+ 896      FFFDFEFF 
+ 896      FFFDFD
+ 897 183b FFFFFDFD 		.ascii	"\377\377\375\375\377\377\374\375\377\377\374\375\377\377\374"
+ 897      FFFFFCFD 
+ 897      FFFFFCFD 
+ 897      FFFFFC
+ 898 184a FCFFFFFB 		.ascii	"\374\377\377\373\374\377\377\373\374\377\377\373\373\377\377"
+ 898      FCFFFFFB 
+ 898      FCFFFFFB 
+ 898      FBFFFF
+ 899 1859 FAFBFFFF 		.ascii	"\372\373\377\377\372\373\377\377\372\373\377\377\371\372\377"
+ 899      FAFBFFFF 
+ 899      FAFBFFFF 
+ 899      F9FAFF
+ 900 1868 FFF9FAFF 		.ascii	"\377\371\372\377\377\371\372\377\377\371\371\377\377\370\371"
+ 900      FFF9FAFF 
+ 900      FFF9F9FF 
+ 900      FFF8F9
+ 901 1877 FFFFF8F9 		.ascii	"\377\377\370\371\377\377\370\370\377\377\367\370\377\377\367"
+ 901      FFFFF8F8 
+ 901      FFFFF7F8 
+ 901      FFFFF7
+ 902 1886 F8FFFFF7 		.ascii	"\370\377\377\367\367\377\377\366\367\377\377\366\367\377\377"
+ 902      F7FFFFF6 
+ 902      F7FFFFF6 
+ 902      F7FFFF
+ 903 1895 F6F6FFFF 		.ascii	"\366\366\377\377\365\366\377\377\365\365\377\377\365\365\377"
+ 903      F5F6FFFF 
+ 903      F5F5FFFF 
+ 903      F5F5FF
+ 904 18a4 FFF4F5FF 		.ascii	"\377\364\365\377\377\364\364\377\377\364\364\377\377\364\364"
+ 904      FFF4F4FF 
+ 904      FFF4F4FF 
+ 904      FFF4F4
+ 905 18b3 FFFFF3F3 		.ascii	"\377\377\363\363\377\377\363\363\377\377\363\362\377\377\362"
+ 905      FFFFF3F3 
+ 905      FFFFF3F2 
+ 905      FFFFF2
+ 906 18c2 F2FFFFF2 		.ascii	"\362\377\377\362\362\377\377\362\361\377\377\361\361\377\377"
+ 906      F2FFFFF2 
+ 906      F1FFFFF1 
+ 906      F1FFFF
+ 907 18d1 F1F0FFFF 		.ascii	"\361\360\377\377\361\360\377\377\361\357\377\377\360\357\377"
+ 907      F1F0FFFF 
+ 907      F1EFFFFF 
+ 907      F0EFFF
+ 908 18e0 FFF0EFFF 		.ascii	"\377\360\357\377\377\360\356\377\377\357\356\377\377\357\355"
+ 908      FFF0EEFF 
+ 908      FFEFEEFF 
+ 908      FFEFED
+ 909 18ef FFFFEFED 		.ascii	"\377\377\357\355\377\376\347\341\377\376\347\341\377\376\347"
+ 909      FFFEE7E1 
+ 909      FFFEE7E1 
+ 909      FFFEE7
+ 910 18fe E0FFFEE6 		.ascii	"\340\377\376\346\340\377\376\346\337\377\376\346\337\377\376"
+ 910      E0FFFEE6 
+ 910      DFFFFEE6 
+GAS LISTING /tmp/ccNTHH7d.s 			page 28
+
+
+ 910      DFFFFE
+ 911 190d E6DEFFFE 		.ascii	"\346\336\377\376\345\336\377\376\345\335\377\376\345\335\377"
+ 911      E5DEFFFE 
+ 911      E5DDFFFE 
+ 911      E5DDFF
+ 912 191c FEE4DCFF 		.ascii	"\376\344\334\377\376\344\334\377\376\344\333\377\376\344\333"
+ 912      FEE4DCFF 
+ 912      FEE4DBFF 
+ 912      FEE4DB
+ 913 192b FFFEE3DA 		.ascii	"\377\376\343\332\377\376\343\332\377\376\343\331\377\376\343"
+ 913      FFFEE3DA 
+ 913      FFFEE3D9 
+ 913      FFFEE3
+ 914 193a D9FFFEE2 		.ascii	"\331\377\376\342\330\377\376\342\330\377\376\342\327\377\376"
+ 914      D8FFFEE2 
+ 914      D8FFFEE2 
+ 914      D7FFFE
+ 915 1949 E1D7FFFE 		.ascii	"\341\327\377\376\341\326\377\376\341\326\377\376\341\325\377"
+ 915      E1D6FFFE 
+ 915      E1D6FFFE 
+ 915      E1D5FF
+ 916 1958 FEE0D5FF 		.ascii	"\376\340\325\377\376\340\324\377\376\340\323\377\376\340\323"
+ 916      FEE0D4FF 
+ 916      FEE0D3FF 
+ 916      FEE0D3
+ 917 1967 FFFEDFD2 		.ascii	"\377\376\337\322\377\376\337\322\377\376\337\321\377\376\337"
+ 917      FFFEDFD2 
+ 917      FFFEDFD1 
+ 917      FFFEDF
+ 918 1976 D1FFFEDE 		.ascii	"\321\377\376\336\320\377\376\336\320\377\376\336\317\377\376"
+ 918      D0FFFEDE 
+ 918      D0FFFEDE 
+ 918      CFFFFE
+ 919 1985 DECFFFFE 		.ascii	"\336\317\377\376\335\316\377\376\335\315\377\376\335\315\377"
+ 919      DDCEFFFE 
+ 919      DDCDFFFE 
+ 919      DDCDFF
+ 920 1994 FEDDCCFF 		.ascii	"\376\335\314\377\376\335\314\377\376\334\313\377\376\334\313"
+ 920      FEDDCCFF 
+ 920      FEDCCBFF 
+ 920      FEDCCB
+ 921 19a3 FFFEDCCA 		.ascii	"\377\376\334\312\377\375\334\312\377\375\333\311\377\375\333"
+ 921      FFFDDCCA 
+ 921      FFFDDBC9 
+ 921      FFFDDB
+ 922 19b2 C8FFFDDB 		.ascii	"\310\377\375\333\310\377\375\333\307\377\375\333\307\377\374"
+ 922      C8FFFDDB 
+ 922      C7FFFDDB 
+ 922      C7FFFC
+ 923 19c1 DAC6FFFC 		.ascii	"\332\306\377\374\332\306\377\374\331\305\377\374\331\304\377"
+ 923      DAC6FFFC 
+ 923      D9C5FFFC 
+ 923      D9C4FF
+ 924 19d0 FCD9C4FF 		.ascii	"\374\331\304\377\374\330\303\377\374\330\303\377\374\327\302"
+ 924      FCD8C3FF 
+ 924      FCD8C3FF 
+ 924      FCD7C2
+GAS LISTING /tmp/ccNTHH7d.s 			page 29
+
+
+ 925 19df FFFCD7C1 		.ascii	"\377\374\327\301\377\374\327\301\377\374\326\300\377\374\326"
+ 925      FFFCD7C1 
+ 925      FFFCD6C0 
+ 925      FFFCD6
+ 926 19ee C0FFFCD5 		.ascii	"\300\377\374\325\277\377\374\325\277\377\374\324\276\377\374"
+ 926      BFFFFCD5 
+ 926      BFFFFCD4 
+ 926      BEFFFC
+ 927 19fd D4BDFFFC 		.ascii	"\324\275\377\374\324\275\377\373\323\274\377\373\323\274\377"
+ 927      D4BDFFFB 
+ 927      D3BCFFFB 
+ 927      D3BCFF
+ 928 1a0c FBD2BBFF 		.ascii	"\373\322\273\377\373\322\273\377\373\322\272\377\373\321\271"
+ 928      FBD2BBFF 
+ 928      FBD2BAFF 
+ 928      FBD1B9
+ 929 1a1b FFFBD1B9 		.ascii	"\377\373\321\271\377\373\320\270\377\373\320\270\377\373\317"
+ 929      FFFBD0B8 
+ 929      FFFBD0B8 
+ 929      FFFBCF
+ 930 1a2a B7FFFBCF 		.ascii	"\267\377\373\317\267\377\373\317\266\377\373\316\266\377\373"
+ 930      B7FFFBCF 
+ 930      B6FFFBCE 
+ 930      B6FFFB
+ 931 1a39 CEB5FFFB 		.ascii	"\316\265\377\373\315\264\377\373\315\264\377\372\315\263\377"
+ 931      CDB4FFFB 
+ 931      CDB4FFFA 
+ 931      CDB3FF
+ 932 1a48 FACCB3FF 		.ascii	"\372\314\263\377\372\314\262\377\372\313\262\377\372\313\261"
+ 932      FACCB2FF 
+ 932      FACBB2FF 
+ 932      FACBB1
+ 933 1a57 FFFACAB1 		.ascii	"\377\372\312\261\377\372\312\260\377\372\312\257\377\372\311"
+ 933      FFFACAB0 
+ 933      FFFACAAF 
+ 933      FFFAC9
+ 934 1a66 AFFFFAC9 		.ascii	"\257\377\372\311\256\377\372\310\256\377\372\310\255\377\372"
+ 934      AEFFFAC8 
+ 934      AEFFFAC8 
+ 934      ADFFFA
+ 935 1a75 C8ADFFFA 		.ascii	"\310\255\377\372\307\254\377\372\307\254\377\371\306\253\377"
+ 935      C7ACFFFA 
+ 935      C7ACFFF9 
+ 935      C6ABFF
+ 936 1a84 F9C6ABFF 		.ascii	"\371\306\253\377\371\305\252\377\367\272\234\377\367\272\233"
+ 936      F9C5AAFF 
+ 936      F7BA9CFF 
+ 936      F7BA9B
+ 937 1a93 FFF7B99B 		.ascii	"\377\367\271\233\377\367\271\232\377\367\271\232\377\367\270"
+ 937      FFF7B99A 
+ 937      FFF7B99A 
+ 937      FFF7B8
+ 938 1aa2 99FFF7B8 		.ascii	"\231\377\367\270\230\377\367\267\230\377\367\267\227\377\367"
+ 938      98FFF7B7 
+ 938      98FFF7B7 
+ 938      97FFF7
+ 939 1ab1 B697FFF7 		.ascii	"\266\227\377\367\266\226\377\367\266\226\377\367\265\225\377"
+GAS LISTING /tmp/ccNTHH7d.s 			page 30
+
+
+ 939      B696FFF7 
+ 939      B696FFF7 
+ 939      B595FF
+ 940 1ac0 F7B595FF 		.ascii	"\367\265\225\377\366\264\224\377\366\264\224\377\366\263\223"
+ 940      F6B494FF 
+ 940      F6B494FF 
+ 940      F6B393
+ 941 1acf FFF6B393 		.ascii	"\377\366\263\223\377\366\263\222\377\366\262\222\377\366\262"
+ 941      FFF6B392 
+ 941      FFF6B292 
+ 941      FFF6B2
+ 942 1ade 91FFF6B1 		.ascii	"\221\377\366\261\221\377\366\261\220\377\366\260\220\377\366"
+ 942      91FFF6B1 
+ 942      90FFF6B0 
+ 942      90FFF6
+ 943 1aed B08FFFF6 		.ascii	"\260\217\377\366\260\216\377\366\257\216\377\365\257\215\377"
+ 943      B08EFFF6 
+ 943      AF8EFFF5 
+ 943      AF8DFF
+ 944 1afc F5AE8DFF 		.ascii	"\365\256\215\377\365\256\214\377\365\255\214\377\365\255\213"
+ 944      F5AE8CFF 
+ 944      F5AD8CFF 
+ 944      F5AD8B
+ 945 1b0b FFF5AD8B 		.ascii	"\377\365\255\213\377\365\254\212\377\365\254\212\377\365\253"
+ 945      FFF5AC8A 
+ 945      FFF5AC8A 
+ 945      FFF5AB
+ 946 1b1a 89FFF5AB 		.ascii	"\211\377\365\253\211\377\365\252\210\377\365\252\210\377\364"
+ 946      89FFF5AA 
+ 946      88FFF5AA 
+ 946      88FFF4
+ 947 1b29 AA87FFF4 		.ascii	"\252\207\377\364\251\207\377\364\251\206\377\364\250\206\377"
+ 947      A987FFF4 
+ 947      A986FFF4 
+ 947      A886FF
+ 948 1b38 F4A885FF 		.ascii	"\364\250\205\377\364\247\205\377\364\247\204\377\364\247\204"
+ 948      F4A785FF 
+ 948      F4A784FF 
+ 948      F4A784
+ 949 1b47 FFF4A683 		.ascii	"\377\364\246\203\377\364\246\203\377\364\245\202\377\364\245"
+ 949      FFF4A683 
+ 949      FFF4A582 
+ 949      FFF4A5
+ 950 1b56 82FFF3A4 		.ascii	"\202\377\363\244\201\377\363\244\201\377\363\243\200\377\363"
+ 950      81FFF3A4 
+ 950      81FFF3A3 
+ 950      80FFF3
+ 951 1b65 A380FFF3 		.ascii	"\243\200\377\363\242\177\377\362\242\177\377\362\241\177\377"
+ 951      A27FFFF2 
+ 951      A27FFFF2 
+ 951      A17FFF
+ 952 1b74 F2A17EFF 		.ascii	"\362\241~\377\362\240~\377\361\240}\377\361\237}\377\361\237"
+ 952      F2A07EFF 
+ 952      F1A07DFF 
+ 952      F19F7DFF 
+ 952      F19F
+ 953 1b86 7CFFF19E 		.ascii	"|\377\361\236|\377\361\236{\377\360\235{\377\360\235z\377\360"
+GAS LISTING /tmp/ccNTHH7d.s 			page 31
+
+
+ 953      7CFFF19E 
+ 953      7BFFF09D 
+ 953      7BFFF09D 
+ 953      7AFFF0
+ 954 1b99 9C7AFFF0 		.ascii	"\234z\377\360\234y\377\357\233y\377\357\233x\377\357\232x\377"
+ 954      9C79FFEF 
+ 954      9B79FFEF 
+ 954      9B78FFEF 
+ 954      9A78FF
+ 955 1bac EF9978FF 		.ascii	"\357\231x\377\357\231w\377\356\230w\377\356\230v\377\356\227"
+ 955      EF9977FF 
+ 955      EE9877FF 
+ 955      EE9876FF 
+ 955      EE97
+ 956 1bbe 76FFEE97 		.ascii	"v\377\356\227u\377\355\226u\377\355\226t\377\355\225t\377\355"
+ 956      75FFED96 
+ 956      75FFED96 
+ 956      74FFED95 
+ 956      74FFED
+ 957 1bd1 9573FFEC 		.ascii	"\225s\377\354\224s\377\354\224s\377\354\223r\377\354\223r\377"
+ 957      9473FFEC 
+ 957      9473FFEC 
+ 957      9372FFEC 
+ 957      9372FF
+ 958 1be4 EC9271FF 		.ascii	"\354\222q\377\353\222q\377\353\221p\377\353\221p\377\353\220"
+ 958      EB9271FF 
+ 958      EB9170FF 
+ 958      EB9170FF 
+ 958      EB90
+ 959 1bf6 70FFEA8F 		.ascii	"p\377\352\217o\377\352\217o\377\352\216n\377\352\216n\377\351"
+ 959      6FFFEA8F 
+ 959      6FFFEA8E 
+ 959      6EFFEA8E 
+ 959      6EFFE9
+ 960 1c09 8D6DFFE9 		.ascii	"\215m\377\351\215m\377\351\214m\377\351\214l\377\351\213l\377"
+ 960      8D6DFFE9 
+ 960      8C6DFFE9 
+ 960      8C6CFFE9 
+ 960      8B6CFF
+ 961 1c1c E88B6BFF 		.ascii	"\350\213k\377\350\212k\377\342|`\377\342{_\377\341{_\377\341"
+ 961      E88A6BFF 
+ 961      E27C60FF 
+ 961      E27B5FFF 
+ 961      E17B5FFF 
+ 962 1c31 7A5FFFE1 		.ascii	"z_\377\341z^\377\341y^\377\340y]\377\340x]\377\340x]\377\340"
+ 962      7A5EFFE1 
+ 962      795EFFE0 
+ 962      795DFFE0 
+ 962      785DFFE0 
+ 963 1c49 775CFFE0 		.ascii	"w\\\377\340v\\\377\337v[\377\337u[\377\337u[\377\337tZ\377\336"
+ 963      765CFFDF 
+ 963      765BFFDF 
+ 963      755BFFDF 
+ 963      755BFFDF 
+ 964 1c61 745AFFDE 		.ascii	"tZ\377\336sY\377\336sY\377\336rY\377\335rX\377\335qX\377\335"
+ 964      7359FFDE 
+ 964      7359FFDE 
+GAS LISTING /tmp/ccNTHH7d.s 			page 32
+
+
+ 964      7259FFDD 
+ 964      7258FFDD 
+ 965 1c79 7057FFDD 		.ascii	"pW\377\335pW\377\334oW\377\334oV\377\334nV\377\334nV\377\333"
+ 965      7057FFDC 
+ 965      6F57FFDC 
+ 965      6F56FFDC 
+ 965      6E56FFDC 
+ 966 1c91 6D55FFDB 		.ascii	"mU\377\333mU\377\333lT\377\333kT\377\332kT\377\332jS\377\332"
+ 966      6D55FFDB 
+ 966      6C54FFDB 
+ 966      6B54FFDA 
+ 966      6B54FFDA 
+ 967 1ca9 6A53FFDA 		.ascii	"jS\377\332iS\377\332iR\377\331hR\377\331hQ\377\331gQ\377\331"
+ 967      6953FFDA 
+ 967      6952FFD9 
+ 967      6852FFD9 
+ 967      6851FFD9 
+ 968 1cc1 6651FFD8 		.ascii	"fQ\377\330fP\377\330eP\377\330eP\377\330dO\377\327dO\377\327"
+ 968      6650FFD8 
+ 968      6550FFD8 
+ 968      6550FFD8 
+ 968      644FFFD7 
+ 969 1cd9 634FFFD7 		.ascii	"cO\377\327bN\377\327bN\377\326aN\377\326aM\377\326`M\377\326"
+ 969      624EFFD7 
+ 969      624EFFD6 
+ 969      614EFFD6 
+ 969      614DFFD6 
+ 970 1cf1 604DFFD5 		.ascii	"`M\377\325_L\377\325_L\377\325^L\377\324^K\377\324]K\377\324"
+ 970      5F4CFFD5 
+ 970      5F4CFFD5 
+ 970      5E4CFFD4 
+ 970      5E4BFFD4 
+ 971 1d09 5D4BFFD4 		.ascii	"]K\377\324\\J\377\323\\J\377\323[J\377\323[J\377\323[I\377\322"
+ 971      5C4AFFD3 
+ 971      5C4AFFD3 
+ 971      5B4AFFD3 
+ 971      5B4AFFD3 
+ 972 1d21 5A49FFD2 		.ascii	"ZI\377\322ZI\377\322YH\377\321YH\377\321XH\377\321XH\377\321"
+ 972      5A49FFD2 
+ 972      5948FFD1 
+ 972      5948FFD1 
+ 972      5848FFD1 
+ 973 1d39 5747FFD0 		.ascii	"WG\377\320WG\377\320VG\377\320VF\377\320UF\377\317UF\377\317"
+ 973      5747FFD0 
+ 973      5647FFD0 
+ 973      5646FFD0 
+ 973      5546FFCF 
+ 974 1d51 5446FFCF 		.ascii	"TF\377\317TE\377\316SE\377\316SE\377\316RD\377\316RD\377\315"
+ 974      5445FFCE 
+ 974      5345FFCE 
+ 974      5345FFCE 
+ 974      5244FFCE 
+ 975 1d69 5144FFCD 		.ascii	"QD\377\315QD\377\315QC\377\314PC\377\314PC\377\314OB\377\314"
+ 975      5144FFCD 
+ 975      5143FFCC 
+ 975      5043FFCC 
+ 975      5043FFCC 
+GAS LISTING /tmp/ccNTHH7d.s 			page 33
+
+
+ 976 1d81 4F42FFCB 		.ascii	"OB\377\313NB\377\313NB\377\313MA\377\313MA\377\312LA\377\312"
+ 976      4E42FFCB 
+ 976      4E42FFCB 
+ 976      4D41FFCB 
+ 976      4D41FFCA 
+ 977 1d99 4C40FFCA 		.ascii	"L@\377\312K@\377\311K@\377\311J@\377\311J?\377\311I?\377\310"
+ 977      4B40FFC9 
+ 977      4B40FFC9 
+ 977      4A40FFC9 
+ 977      4A3FFFC9 
+ 978 1db1 493FFFC8 		.ascii	"I?\377\310H?\377\310H>\377\307G>\377\30087\377\30087\377\277"
+ 978      483FFFC8 
+ 978      483EFFC7 
+ 978      473EFFC0 
+ 978      3837FFC0 
+ 979 1dc9 3736FFBF 		.ascii	"76\377\27766\377\27766\377\27756\377\27655\377\27645\377\276"
+ 979      3636FFBF 
+ 979      3636FFBF 
+ 979      3536FFBE 
+ 979      3535FFBE 
+ 980 1de1 3435FFBD 		.ascii	"45\377\27535\377\27534\377\27524\377\27524\377\27414\377\274"
+ 980      3335FFBD 
+ 980      3334FFBD 
+ 980      3234FFBD 
+ 980      3234FFBC 
+ 981 1df9 3133FFBC 		.ascii	"13\377\27403\377\273/3\377\273/3\377\273.2\377\273.2\377\272"
+ 981      3033FFBB 
+ 981      2F33FFBB 
+ 981      2F33FFBB 
+ 981      2E32FFBB 
+ 982 1e11 2D32FFBA 		.ascii	"-2\377\272-2\377\272,1\377\271+1\377\271+1\377\271*1\377\271"
+ 982      2D32FFBA 
+ 982      2C31FFB9 
+ 982      2B31FFB9 
+ 982      2B31FFB9 
+ 983 1e29 2A30FFB8 		.ascii	"*0\377\270)0\377\270(0\377\270(0\377\267'/\377\267&/\377\267"
+ 983      2930FFB8 
+ 983      2830FFB8 
+ 983      2830FFB7 
+ 983      272FFFB7 
+ 984 1e41 262FFFB7 		.ascii	"&/\377\267%/\377\266$.\377\266$.\377\266#.\377\265\".\377\265"
+ 984      252FFFB6 
+ 984      242EFFB6 
+ 984      242EFFB6 
+ 984      232EFFB5 
+ 985 1e59 222DFFB5 		.ascii	"\"-\377\265!-\377\265 -\377\264\037-\377\264\037,\377\264\036"
+ 985      212DFFB5 
+ 985      202DFFB4 
+ 985      1F2DFFB4 
+ 985      1F2CFFB4 
+ 986 1e6e 2CFFB31D 		.ascii	",\377\263\035,\377\263\034,\377\263\034,\377\263\033+\377\262"
+ 986      2CFFB31C 
+ 986      2CFFB31C 
+ 986      2CFFB31B 
+ 986      2BFFB2
+ 987 1e81 1A2BFFB2 		.ascii	"\032+\377\262\031+\377\262\030+\377\261\027*\377\261\027*\377"
+ 987      192BFFB2 
+GAS LISTING /tmp/ccNTHH7d.s 			page 34
+
+
+ 987      182BFFB1 
+ 987      172AFFB1 
+ 987      172AFF
+ 988 1e94 B0172AFF 		.ascii	"\260\027*\377\257\027*\377\257\026*\377\256\026*\377\256\026"
+ 988      AF172AFF 
+ 988      AF162AFF 
+ 988      AE162AFF 
+ 988      AE16
+ 989 1ea6 2AFFAD15 		.ascii	"*\377\255\025*\377\255\025*\377\254\025*\377\253\025*\377\253"
+ 989      2AFFAD15 
+ 989      2AFFAC15 
+ 989      2AFFAB15 
+ 989      2AFFAB
+ 990 1eb9 142AFFAA 		.ascii	"\024*\377\252\024*\377\252\024*\377\251\024*\377\250\023*\377"
+ 990      142AFFAA 
+ 990      142AFFA9 
+ 990      142AFFA8 
+ 990      132AFF
+ 991 1ecc A8132AFF 		.ascii	"\250\023*\377\247\023*\377\247\023*\377\246\022)\377\245\022"
+ 991      A7132AFF 
+ 991      A7132AFF 
+ 991      A61229FF 
+ 991      A512
+ 992 1ede 29FFA512 		.ascii	")\377\245\022)\377\244\022)\377\244\021)\377\243\021)\377\242"
+ 992      29FFA412 
+ 992      29FFA411 
+ 992      29FFA311 
+ 992      29FFA2
+ 993 1ef1 1129FFA2 		.ascii	"\021)\377\242\021)\377\241\020)\377\241\020)\377\240\020)\377"
+ 993      1129FFA1 
+ 993      1029FFA1 
+ 993      1029FFA0 
+ 993      1029FF
+ 994 1f04 A01029FF 		.ascii	"\240\020)\377\237\017)\377\236\017)\377\236\017(\377\235\017"
+ 994      9F0F29FF 
+ 994      9E0F29FF 
+ 994      9E0F28FF 
+ 994      9D0F
+ 995 1f16 28FF9D0E 		.ascii	"(\377\235\016(\377\234\016(\377\233\016(\377\233\016(\377\232"
+ 995      28FF9C0E 
+ 995      28FF9B0E 
+ 995      28FF9B0E 
+ 995      28FF9A
+ 996 1f29 0D28FF9A 		.ascii	"\r(\377\232\r(\377\231\r(\377\230\r(\377\230\f(\377\227\f(\377"
+ 996      0D28FF99 
+ 996      0D28FF98 
+ 996      0D28FF98 
+ 996      0C28FF97 
+ 997 1f40 970C27FF 		.ascii	"\227\f'\377\226\f'\377\225\013'\377\225\013'\377\224\013'\377"
+ 997      960C27FF 
+ 997      950B27FF 
+ 997      950B27FF 
+ 997      940B27FF 
+ 998 1f54 940B27FF 		.ascii	"\224\013'\377\204\006$\377\204\005$\377\203\005$\377\202\005"
+ 998      840624FF 
+ 998      840524FF 
+ 998      830524FF 
+GAS LISTING /tmp/ccNTHH7d.s 			page 35
+
+
+ 998      8205
+ 999 1f66 24FF8205 		.ascii	"$\377\202\005$\377\201\005$\377\201\005$\377\200\004$\377\177"
+ 999      24FF8105 
+ 999      24FF8105 
+ 999      24FF8004 
+ 999      24FF7F
+ 1000 1f79 0424FF7F 		.ascii	"\004$\377\177\004$\377~\004#\377~\004#\377}\003#\377}\003#\377"
+ 1000      0424FF7E 
+ 1000      0423FF7E 
+ 1000      0423FF7D 
+ 1000      0323FF7D 
+ 1001 1f90 7C0323FF 		.ascii	"|\003#\377{\003#\377{\003#\377z\003#\377z\003#\377y\002#\377"
+ 1001      7B0323FF 
+ 1001      7B0323FF 
+ 1001      7A0323FF 
+ 1001      7A0323FF 
+ 1002 1fa8 780222FF 		.ascii	"x\002\"\377x\002\"\377w\002\"\377w\002\"\377v\002\"\377v\002"
+ 1002      780222FF 
+ 1002      770222FF 
+ 1002      770222FF 
+ 1002      760222FF 
+ 1003 1fbe 22FF     		.ascii	"\"\377"
+ 1004 1fc0 750222FF 		.string	"u\002\"\377t\001\"\377t\001!\377s\001!\377s\001!\377r\001!\377q\001!\377q\001!\377p\001!\
+ 1004      740122FF 
+ 1004      740121FF 
+ 1004      730121FF 
+ 1004      730121FF 
+ 1005 1fee 20FF6E00 		.string	" \377n"
+ 1006 1ff2 20FF6D00 		.string	" \377m"
+ 1007 1ff6 20FF6D00 		.string	" \377m"
+ 1008 1ffa 20FF6C00 		.string	" \377l"
+ 1009 1ffe 20FF6C00 		.string	" \377l"
+ 1010 2002 20FF6B00 		.string	" \377k"
+ 1011 2006 20FF6B00 		.string	" \377k"
+ 1012 200a 1FFF6A00 		.string	"\037\377j"
+ 1013 200e 1FFF6900 		.string	"\037\377i"
+ 1014 2012 1FFF6900 		.string	"\037\377i"
+ 1015 2016 1FFF6800 		.string	"\037\377h"
+ 1016 201a 1FFF6800 		.string	"\037\377h"
+ 1017 201e 1FFF6700 		.string	"\037\377g"
+ 1018 2022 1FFF     		.ascii	"\037\377"
+ 1019              		.globl	heatmap_cs_RdGy_soft
+ 1020              		.section	.data.rel.local
+ 1021              		.align 8
+ 1022              		.type	heatmap_cs_RdGy_soft, @object
+ 1023              		.size	heatmap_cs_RdGy_soft, 8
+ 1024              	heatmap_cs_RdGy_soft:
+ 1025 0010 00000000 		.quad	soft
+ 1025      00000000 
+ 1026              		.section	.data.rel.ro.local
+ 1027              		.align 16
+ 1028              		.type	soft, @object
+ 1029              		.size	soft, 16
+ 1030              	soft:
+ 1031 0020 00000000 		.quad	soft_data
+ 1031      00000000 
+ 1032 0028 01040000 		.quad	1025
+GAS LISTING /tmp/ccNTHH7d.s 			page 36
+
+
+ 1032      00000000 
+ 1033              		.section	.rodata
+ 1034 2024 00000000 		.align 32
+ 1034      00000000 
+ 1034      00000000 
+ 1034      00000000 
+ 1034      00000000 
+ 1035              		.type	soft_data, @object
+ 1036              		.size	soft_data, 4100
+ 1037              	soft_data:
+ 1038 2040 00       		.string	""
+ 1039 2041 00       		.string	""
+ 1040 2042 00       		.string	""
+ 1041 2043 00       		.string	""
+ 1042 2044 1A191A00 		.string	"\032\031\032"
+ 1043 2048 1A1A1A07 		.ascii	"\032\032\032\007\032\032\032\016\033\033\033\026\033\033\033"
+ 1043      1A1A1A0E 
+ 1043      1B1B1B16 
+ 1043      1B1B1B
+ 1044 2057 1D1C1C1C 		.ascii	"\035\034\034\034%\034\034\034,\035\035\0354\035\035\035;\036"
+ 1044      251C1C1C 
+ 1044      2C1D1D1D 
+ 1044      341D1D1D 
+ 1044      3B1E
+ 1045 2069 1E1E431E 		.ascii	"\036\036C\036\036\036J\037\037\037R\037\037\037Y\037\037\037"
+ 1045      1E1E4A1F 
+ 1045      1F1F521F 
+ 1045      1F1F591F 
+ 1045      1F1F
+ 1046 207b 61202020 		.ascii	"a   h   p!!!w!!!\177\"\"\"\206\"\"\"\215###\225###\234$$$\244"
+ 1046      68202020 
+ 1046      70212121 
+ 1046      77212121 
+ 1046      7F222222 
+ 1047 20a0 242424AB 		.ascii	"$$$\253%%%\263%%%\272&&&\302&&&\311'''\321'''\330(((\340(((\347"
+ 1047      252525B3 
+ 1047      252525BA 
+ 1047      262626C2 
+ 1047      262626C9 
+ 1048 20c4 292929EF 		.ascii	")))\357)))\366)))\376***\377***\377+++\377+++\377,,,\377,,,\377"
+ 1048      292929F6 
+ 1048      292929FE 
+ 1048      2A2A2AFF 
+ 1048      2A2A2AFF 
+ 1049 20e8 2D2D2DFF 		.ascii	"---\377---\377...\377...\377///\377///\377000\377000\377111\377"
+ 1049      2D2D2DFF 
+ 1049      2E2E2EFF 
+ 1049      2E2E2EFF 
+ 1049      2F2F2FFF 
+ 1050 210c 313131FF 		.ascii	"111\377222\377222\377333\377333\377444\377444\377555\377555\377"
+ 1050      323232FF 
+ 1050      323232FF 
+ 1050      333333FF 
+ 1050      333333FF 
+ 1051 2130 363636FF 		.ascii	"666\377666\377777\377777\377888\377888\377999\377999\377:::\377"
+ 1051      363636FF 
+ 1051      373737FF 
+GAS LISTING /tmp/ccNTHH7d.s 			page 37
+
+
+ 1051      373737FF 
+ 1051      383838FF 
+ 1052 2154 3A3A3AFF 		.ascii	":::\377;;;\377<<<\377<<<\377===\377===\377>>>\377>>>\377???\377"
+ 1052      3B3B3BFF 
+ 1052      3C3C3CFF 
+ 1052      3C3C3CFF 
+ 1052      3D3D3DFF 
+ 1053 2178 3F3F3FFF 		.ascii	"???\377@@@\377@@@\377AAA\377AAA\377BBB\377BBB\377CCC\377CCC\377"
+ 1053      404040FF 
+ 1053      404040FF 
+ 1053      414141FF 
+ 1053      414141FF 
+ 1054 219c 444444FF 		.ascii	"DDD\377DDD\377EEE\377EEE\377FFF\377FFF\377GGG\377GGG\377HHH\377"
+ 1054      444444FF 
+ 1054      454545FF 
+ 1054      454545FF 
+ 1054      464646FF 
+ 1055 21c0 494949FF 		.ascii	"III\377III\377JJJ\377JJJ\377KKK\377KKK\377LLL\377LLL\377MMM\377"
+ 1055      494949FF 
+ 1055      4A4A4AFF 
+ 1055      4A4A4AFF 
+ 1055      4B4B4BFF 
+ 1056 21e4 4D4D4DFF 		.ascii	"MMM\377NNN\377NNN\377OOO\377PPP\377PPP\377QQQ\377QQQ\377RRR\377"
+ 1056      4E4E4EFF 
+ 1056      4E4E4EFF 
+ 1056      4F4F4FFF 
+ 1056      505050FF 
+ 1057 2208 525252FF 		.ascii	"RRR\377SSS\377SSS\377TTT\377TTT\377UUU\377VVV\377VVV\377WWW\377"
+ 1057      535353FF 
+ 1057      535353FF 
+ 1057      545454FF 
+ 1057      545454FF 
+ 1058 222c 575757FF 		.ascii	"WWW\377XXX\377XXX\377YYY\377YYY\377ZZZ\377ZZZ\377[[[\377\\\\"
+ 1058      585858FF 
+ 1058      585858FF 
+ 1058      595959FF 
+ 1058      595959FF 
+ 1059 224e 5CFF5C5C 		.ascii	"\\\377\\\\\\\377]]]\377]]]\377^^^\377^^^\377___\377___\377``"
+ 1059      5CFF5D5D 
+ 1059      5DFF5D5D 
+ 1059      5DFF5E5E 
+ 1059      5EFF5E5E 
+ 1060 226e 60FF6161 		.ascii	"`\377aaa\377aaa\377bbb\377bbb\377ccc\377ccc\377ddd\377ddd\377"
+ 1060      61FF6161 
+ 1060      61FF6262 
+ 1060      62FF6262 
+ 1060      62FF6363 
+ 1061 2290 656565FF 		.ascii	"eee\377fff\377fff\377ggg\377ggg\377hhh\377hhh\377iii\377jjj\377"
+ 1061      666666FF 
+ 1061      666666FF 
+ 1061      676767FF 
+ 1061      676767FF 
+ 1062 22b4 6A6A6AFF 		.ascii	"jjj\377kkk\377kkk\377lll\377lll\377mmm\377nnn\377nnn\377ooo\377"
+ 1062      6B6B6BFF 
+ 1062      6B6B6BFF 
+ 1062      6C6C6CFF 
+ 1062      6C6C6CFF 
+GAS LISTING /tmp/ccNTHH7d.s 			page 38
+
+
+ 1063 22d8 6F6F6FFF 		.ascii	"ooo\377ppp\377ppp\377qqq\377rrr\377rrr\377sss\377sss\377ttt\377"
+ 1063      707070FF 
+ 1063      707070FF 
+ 1063      717171FF 
+ 1063      727272FF 
+ 1064 22fc 747474FF 		.ascii	"ttt\377uuu\377vvv\377vvv\377www\377www\377xxx\377yyy\377yyy\377"
+ 1064      757575FF 
+ 1064      767676FF 
+ 1064      767676FF 
+ 1064      777777FF 
+ 1065 2320 7A7A7AFF 		.ascii	"zzz\377zzz\377{{{\377{{{\377|||\377}}}\377}}}\377~~~\377~~~\377"
+ 1065      7A7A7AFF 
+ 1065      7B7B7BFF 
+ 1065      7B7B7BFF 
+ 1065      7C7C7CFF 
+ 1066 2344 7F7F7FFF 		.ascii	"\177\177\177\377\200\200\200\377\200\200\200\377\201\201\201"
+ 1066      808080FF 
+ 1066      808080FF 
+ 1066      818181
+ 1067 2353 FF818181 		.ascii	"\377\201\201\201\377\202\202\202\377\202\202\202\377\203\203"
+ 1067      FF828282 
+ 1067      FF828282 
+ 1067      FF8383
+ 1068 2362 83FF8484 		.ascii	"\203\377\204\204\204\377\204\204\204\377\205\205\205\377\205"
+ 1068      84FF8484 
+ 1068      84FF8585 
+ 1068      85FF85
+ 1069 2371 8585FF86 		.ascii	"\205\205\377\206\206\206\377\207\207\207\377\207\207\207\377"
+ 1069      8686FF87 
+ 1069      8787FF87 
+ 1069      8787FF
+ 1070 2380 888888FF 		.ascii	"\210\210\210\377\210\210\210\377\211\211\211\377\211\211\211"
+ 1070      888888FF 
+ 1070      898989FF 
+ 1070      898989
+ 1071 238f FF8A8A8A 		.ascii	"\377\212\212\212\377\212\212\212\377\212\212\212\377\213\213"
+ 1071      FF8A8A8A 
+ 1071      FF8A8A8A 
+ 1071      FF8B8B
+ 1072 239e 8BFF8B8B 		.ascii	"\213\377\213\213\213\377\214\214\214\377\214\214\214\377\215"
+ 1072      8BFF8C8C 
+ 1072      8CFF8C8C 
+ 1072      8CFF8D
+ 1073 23ad 8D8DFF8D 		.ascii	"\215\215\377\215\215\215\377\216\216\216\377\216\216\216\377"
+ 1073      8D8DFF8E 
+ 1073      8E8EFF8E 
+ 1073      8E8EFF
+ 1074 23bc 8F8F8FFF 		.ascii	"\217\217\217\377\217\217\217\377\220\220\220\377\220\220\220"
+ 1074      8F8F8FFF 
+ 1074      909090FF 
+ 1074      909090
+ 1075 23cb FF919191 		.ascii	"\377\221\221\221\377\221\221\221\377\222\222\222\377\222\222"
+ 1075      FF919191 
+ 1075      FF929292 
+ 1075      FF9292
+ 1076 23da 92FF9393 		.ascii	"\222\377\223\223\223\377\223\223\223\377\224\224\224\377\224"
+ 1076      93FF9393 
+GAS LISTING /tmp/ccNTHH7d.s 			page 39
+
+
+ 1076      93FF9494 
+ 1076      94FF94
+ 1077 23e9 9494FF95 		.ascii	"\224\224\377\225\225\225\377\225\225\225\377\226\226\226\377"
+ 1077      9595FF95 
+ 1077      9595FF96 
+ 1077      9696FF
+ 1078 23f8 969696FF 		.ascii	"\226\226\226\377\227\227\227\377\227\227\227\377\230\230\230"
+ 1078      979797FF 
+ 1078      979797FF 
+ 1078      989898
+ 1079 2407 FF989898 		.ascii	"\377\230\230\230\377\231\231\231\377\231\231\231\377\232\232"
+ 1079      FF999999 
+ 1079      FF999999 
+ 1079      FF9A9A
+ 1080 2416 9AFF9A9A 		.ascii	"\232\377\232\232\232\377\233\233\233\377\233\233\233\377\234"
+ 1080      9AFF9B9B 
+ 1080      9BFF9B9B 
+ 1080      9BFF9C
+ 1081 2425 9C9CFF9C 		.ascii	"\234\234\377\234\234\234\377\235\235\235\377\235\235\235\377"
+ 1081      9C9CFF9D 
+ 1081      9D9DFF9D 
+ 1081      9D9DFF
+ 1082 2434 9E9E9EFF 		.ascii	"\236\236\236\377\236\236\236\377\237\237\237\377\237\237\237"
+ 1082      9E9E9EFF 
+ 1082      9F9F9FFF 
+ 1082      9F9F9F
+ 1083 2443 FFA0A0A0 		.ascii	"\377\240\240\240\377\240\240\240\377\241\241\241\377\241\241"
+ 1083      FFA0A0A0 
+ 1083      FFA1A1A1 
+ 1083      FFA1A1
+ 1084 2452 A1FFA2A2 		.ascii	"\241\377\242\242\242\377\242\242\242\377\243\243\243\377\243"
+ 1084      A2FFA2A2 
+ 1084      A2FFA3A3 
+ 1084      A3FFA3
+ 1085 2461 A3A3FFA4 		.ascii	"\243\243\377\244\244\244\377\244\244\244\377\245\245\245\377"
+ 1085      A4A4FFA4 
+ 1085      A4A4FFA5 
+ 1085      A5A5FF
+ 1086 2470 A5A5A5FF 		.ascii	"\245\245\245\377\246\246\246\377\246\246\246\377\247\247\247"
+ 1086      A6A6A6FF 
+ 1086      A6A6A6FF 
+ 1086      A7A7A7
+ 1087 247f FFA7A7A7 		.ascii	"\377\247\247\247\377\250\250\250\377\250\250\250\377\251\251"
+ 1087      FFA8A8A8 
+ 1087      FFA8A8A8 
+ 1087      FFA9A9
+ 1088 248e A9FFA9A9 		.ascii	"\251\377\251\251\251\377\252\252\252\377\252\252\252\377\253"
+ 1088      A9FFAAAA 
+ 1088      AAFFAAAA 
+ 1088      AAFFAB
+ 1089 249d ABABFFAB 		.ascii	"\253\253\377\253\253\253\377\254\254\254\377\254\254\254\377"
+ 1089      ABABFFAC 
+ 1089      ACACFFAC 
+ 1089      ACACFF
+ 1090 24ac ADADADFF 		.ascii	"\255\255\255\377\255\255\255\377\256\256\256\377\256\256\256"
+ 1090      ADADADFF 
+ 1090      AEAEAEFF 
+GAS LISTING /tmp/ccNTHH7d.s 			page 40
+
+
+ 1090      AEAEAE
+ 1091 24bb FFAFAFAF 		.ascii	"\377\257\257\257\377\257\257\257\377\260\260\260\377\260\260"
+ 1091      FFAFAFAF 
+ 1091      FFB0B0B0 
+ 1091      FFB0B0
+ 1092 24ca B0FFB1B1 		.ascii	"\260\377\261\261\261\377\261\261\261\377\262\262\262\377\262"
+ 1092      B1FFB1B1 
+ 1092      B1FFB2B2 
+ 1092      B2FFB2
+ 1093 24d9 B2B2FFB3 		.ascii	"\262\262\377\263\263\263\377\263\263\263\377\264\264\264\377"
+ 1093      B3B3FFB3 
+ 1093      B3B3FFB4 
+ 1093      B4B4FF
+ 1094 24e8 B4B4B4FF 		.ascii	"\264\264\264\377\265\265\265\377\265\265\265\377\266\266\266"
+ 1094      B5B5B5FF 
+ 1094      B5B5B5FF 
+ 1094      B6B6B6
+ 1095 24f7 FFB6B6B6 		.ascii	"\377\266\266\266\377\267\267\267\377\267\267\267\377\270\270"
+ 1095      FFB7B7B7 
+ 1095      FFB7B7B7 
+ 1095      FFB8B8
+ 1096 2506 B8FFB8B8 		.ascii	"\270\377\270\270\270\377\271\271\271\377\271\271\271\377\272"
+ 1096      B8FFB9B9 
+ 1096      B9FFB9B9 
+ 1096      B9FFBA
+ 1097 2515 BABAFFBA 		.ascii	"\272\272\377\272\272\272\377\273\273\273\377\273\273\273\377"
+ 1097      BABAFFBB 
+ 1097      BBBBFFBB 
+ 1097      BBBBFF
+ 1098 2524 BBBBBBFF 		.ascii	"\273\273\273\377\274\274\274\377\274\274\274\377\274\274\274"
+ 1098      BCBCBCFF 
+ 1098      BCBCBCFF 
+ 1098      BCBCBC
+ 1099 2533 FFBDBDBD 		.ascii	"\377\275\275\275\377\275\275\275\377\275\275\275\377\276\276"
+ 1099      FFBDBDBD 
+ 1099      FFBDBDBD 
+ 1099      FFBEBE
+ 1100 2542 BEFFBEBE 		.ascii	"\276\377\276\276\276\377\277\277\277\377\277\277\277\377\277"
+ 1100      BEFFBFBF 
+ 1100      BFFFBFBF 
+ 1100      BFFFBF
+ 1101 2551 BFBFFFC0 		.ascii	"\277\277\377\300\300\300\377\300\300\300\377\300\300\300\377"
+ 1101      C0C0FFC0 
+ 1101      C0C0FFC0 
+ 1101      C0C0FF
+ 1102 2560 C1C1C1FF 		.ascii	"\301\301\301\377\301\301\301\377\301\301\301\377\302\302\302"
+ 1102      C1C1C1FF 
+ 1102      C1C1C1FF 
+ 1102      C2C2C2
+ 1103 256f FFC2C2C2 		.ascii	"\377\302\302\302\377\303\303\303\377\303\303\303\377\303\303"
+ 1103      FFC3C3C3 
+ 1103      FFC3C3C3 
+ 1103      FFC3C3
+ 1104 257e C3FFC4C4 		.ascii	"\303\377\304\304\304\377\304\304\304\377\304\304\304\377\305"
+ 1104      C4FFC4C4 
+ 1104      C4FFC4C4 
+ 1104      C4FFC5
+GAS LISTING /tmp/ccNTHH7d.s 			page 41
+
+
+ 1105 258d C5C5FFC5 		.ascii	"\305\305\377\305\305\305\377\306\306\306\377\306\306\306\377"
+ 1105      C5C5FFC6 
+ 1105      C6C6FFC6 
+ 1105      C6C6FF
+ 1106 259c C6C6C6FF 		.ascii	"\306\306\306\377\307\307\307\377\307\307\307\377\307\307\307"
+ 1106      C7C7C7FF 
+ 1106      C7C7C7FF 
+ 1106      C7C7C7
+ 1107 25ab FFC8C8C8 		.ascii	"\377\310\310\310\377\310\310\310\377\310\310\310\377\311\311"
+ 1107      FFC8C8C8 
+ 1107      FFC8C8C8 
+ 1107      FFC9C9
+ 1108 25ba C9FFC9C9 		.ascii	"\311\377\311\311\311\377\312\312\312\377\312\312\312\377\312"
+ 1108      C9FFCACA 
+ 1108      CAFFCACA 
+ 1108      CAFFCA
+ 1109 25c9 CACAFFCB 		.ascii	"\312\312\377\313\313\313\377\313\313\313\377\313\313\313\377"
+ 1109      CBCBFFCB 
+ 1109      CBCBFFCB 
+ 1109      CBCBFF
+ 1110 25d8 CCCCCCFF 		.ascii	"\314\314\314\377\314\314\314\377\315\315\315\377\315\315\315"
+ 1110      CCCCCCFF 
+ 1110      CDCDCDFF 
+ 1110      CDCDCD
+ 1111 25e7 FFCDCDCD 		.ascii	"\377\315\315\315\377\316\316\316\377\316\316\316\377\316\316"
+ 1111      FFCECECE 
+ 1111      FFCECECE 
+ 1111      FFCECE
+ 1112 25f6 CEFFCFCF 		.ascii	"\316\377\317\317\317\377\317\317\317\377\320\320\320\377\320"
+ 1112      CFFFCFCF 
+ 1112      CFFFD0D0 
+ 1112      D0FFD0
+ 1113 2605 D0D0FFD0 		.ascii	"\320\320\377\320\320\320\377\321\321\321\377\321\321\321\377"
+ 1113      D0D0FFD1 
+ 1113      D1D1FFD1 
+ 1113      D1D1FF
+ 1114 2614 D1D1D1FF 		.ascii	"\321\321\321\377\322\322\322\377\322\322\322\377\323\323\323"
+ 1114      D2D2D2FF 
+ 1114      D2D2D2FF 
+ 1114      D3D3D3
+ 1115 2623 FFD3D3D3 		.ascii	"\377\323\323\323\377\323\323\323\377\324\324\324\377\324\324"
+ 1115      FFD3D3D3 
+ 1115      FFD4D4D4 
+ 1115      FFD4D4
+ 1116 2632 D4FFD4D4 		.ascii	"\324\377\324\324\324\377\325\325\325\377\325\325\325\377\326"
+ 1116      D4FFD5D5 
+ 1116      D5FFD5D5 
+ 1116      D5FFD6
+ 1117 2641 D6D6FFD6 		.ascii	"\326\326\377\326\326\326\377\326\326\326\377\327\327\327\377"
+ 1117      D6D6FFD6 
+ 1117      D6D6FFD7 
+ 1117      D7D7FF
+ 1118 2650 D7D7D7FF 		.ascii	"\327\327\327\377\327\327\327\377\330\330\330\377\330\330\330"
+ 1118      D7D7D7FF 
+ 1118      D8D8D8FF 
+ 1118      D8D8D8
+ 1119 265f FFD9D9D9 		.ascii	"\377\331\331\331\377\331\331\331\377\331\331\331\377\332\332"
+GAS LISTING /tmp/ccNTHH7d.s 			page 42
+
+
+ 1119      FFD9D9D9 
+ 1119      FFD9D9D9 
+ 1119      FFDADA
+ 1120 266e DAFFDADA 		.ascii	"\332\377\332\332\332\377\332\332\332\377\333\333\333\377\333"
+ 1120      DAFFDADA 
+ 1120      DAFFDBDB 
+ 1120      DBFFDB
+ 1121 267d DBDBFFDC 		.ascii	"\333\333\377\334\334\334\377\334\334\334\377\334\334\334\377"
+ 1121      DCDCFFDC 
+ 1121      DCDCFFDC 
+ 1121      DCDCFF
+ 1122 268c DDDDDDFF 		.ascii	"\335\335\335\377\335\335\335\377\335\335\335\377\336\336\336"
+ 1122      DDDDDDFF 
+ 1122      DDDDDDFF 
+ 1122      DEDEDE
+ 1123 269b FFDEDEDE 		.ascii	"\377\336\336\336\377\337\337\337\377\337\337\337\377\337\337"
+ 1123      FFDFDFDF 
+ 1123      FFDFDFDF 
+ 1123      FFDFDF
+ 1124 26aa DFFFE0E0 		.ascii	"\337\377\340\340\340\377\340\340\340\377\340\340\340\377\341"
+ 1124      E0FFE0E0 
+ 1124      E0FFE0E0 
+ 1124      E0FFE1
+ 1125 26b9 E1E1FFE1 		.ascii	"\341\341\377\341\341\341\377\341\341\341\377\341\341\341\377"
+ 1125      E1E1FFE1 
+ 1125      E1E1FFE1 
+ 1125      E1E1FF
+ 1126 26c8 E2E2E2FF 		.ascii	"\342\342\342\377\342\342\342\377\342\342\342\377\343\343\343"
+ 1126      E2E2E2FF 
+ 1126      E2E2E2FF 
+ 1126      E3E3E3
+ 1127 26d7 FFE3E3E3 		.ascii	"\377\343\343\343\377\343\343\343\377\344\344\344\377\344\344"
+ 1127      FFE3E3E3 
+ 1127      FFE4E4E4 
+ 1127      FFE4E4
+ 1128 26e6 E4FFE4E4 		.ascii	"\344\377\344\344\344\377\344\344\344\377\345\345\345\377\345"
+ 1128      E4FFE4E4 
+ 1128      E4FFE5E5 
+ 1128      E5FFE5
+ 1129 26f5 E5E5FFE5 		.ascii	"\345\345\377\345\345\345\377\346\346\346\377\346\346\346\377"
+ 1129      E5E5FFE6 
+ 1129      E6E6FFE6 
+ 1129      E6E6FF
+ 1130 2704 E6E6E6FF 		.ascii	"\346\346\346\377\347\347\347\377\347\347\347\377\347\347\347"
+ 1130      E7E7E7FF 
+ 1130      E7E7E7FF 
+ 1130      E7E7E7
+ 1131 2713 FFE7E7E7 		.ascii	"\377\347\347\347\377\350\350\350\377\350\350\350\377\350\350"
+ 1131      FFE8E8E8 
+ 1131      FFE8E8E8 
+ 1131      FFE8E8
+ 1132 2722 E8FFE9E9 		.ascii	"\350\377\351\351\351\377\351\351\351\377\351\351\351\377\352"
+ 1132      E9FFE9E9 
+ 1132      E9FFE9E9 
+ 1132      E9FFEA
+ 1133 2731 EAEAFFEA 		.ascii	"\352\352\377\352\352\352\377\352\352\352\377\352\352\352\377"
+ 1133      EAEAFFEA 
+GAS LISTING /tmp/ccNTHH7d.s 			page 43
+
+
+ 1133      EAEAFFEA 
+ 1133      EAEAFF
+ 1134 2740 EBEBEBFF 		.ascii	"\353\353\353\377\353\353\353\377\353\353\353\377\354\354\354"
+ 1134      EBEBEBFF 
+ 1134      EBEBEBFF 
+ 1134      ECECEC
+ 1135 274f FFECECEC 		.ascii	"\377\354\354\354\377\354\354\354\377\355\355\355\377\355\355"
+ 1135      FFECECEC 
+ 1135      FFEDEDED 
+ 1135      FFEDED
+ 1136 275e EDFFEDED 		.ascii	"\355\377\355\355\355\377\355\355\355\377\356\356\356\377\356"
+ 1136      EDFFEDED 
+ 1136      EDFFEEEE 
+ 1136      EEFFEE
+ 1137 276d EEEEFFEE 		.ascii	"\356\356\377\356\356\356\377\357\357\357\377\357\357\357\377"
+ 1137      EEEEFFEF 
+ 1137      EFEFFFEF 
+ 1137      EFEFFF
+ 1138 277c EFEFEFFF 		.ascii	"\357\357\357\377\360\360\360\377\360\360\360\377\360\360\360"
+ 1138      F0F0F0FF 
+ 1138      F0F0F0FF 
+ 1138      F0F0F0
+ 1139 278b FFF0F0F0 		.ascii	"\377\360\360\360\377\361\361\361\377\361\361\361\377\361\361"
+ 1139      FFF1F1F1 
+ 1139      FFF1F1F1 
+ 1139      FFF1F1
+ 1140 279a F1FFF2F2 		.ascii	"\361\377\362\362\362\377\362\362\362\377\362\362\362\377\363"
+ 1140      F2FFF2F2 
+ 1140      F2FFF2F2 
+ 1140      F2FFF3
+ 1141 27a9 F3F3FFF3 		.ascii	"\363\363\377\363\363\363\377\363\363\363\377\364\364\364\377"
+ 1141      F3F3FFF3 
+ 1141      F3F3FFF4 
+ 1141      F4F4FF
+ 1142 27b8 F4F4F4FF 		.ascii	"\364\364\364\377\364\364\364\377\364\364\364\377\365\365\365"
+ 1142      F4F4F4FF 
+ 1142      F4F4F4FF 
+ 1142      F5F5F5
+ 1143 27c7 FFF5F5F5 		.ascii	"\377\365\365\365\377\365\365\365\377\366\366\366\377\366\366"
+ 1143      FFF5F5F5 
+ 1143      FFF6F6F6 
+ 1143      FFF6F6
+ 1144 27d6 F6FFF6F6 		.ascii	"\366\377\366\366\366\377\367\367\367\377\367\367\367\377\367"
+ 1144      F6FFF7F7 
+ 1144      F7FFF7F7 
+ 1144      F7FFF7
+ 1145 27e5 F7F7FFF7 		.ascii	"\367\367\377\367\367\367\377\370\370\370\377\370\370\370\377"
+ 1145      F7F7FFF8 
+ 1145      F8F8FFF8 
+ 1145      F8F8FF
+ 1146 27f4 F8F8F8FF 		.ascii	"\370\370\370\377\371\371\371\377\371\371\371\377\371\371\371"
+ 1146      F9F9F9FF 
+ 1146      F9F9F9FF 
+ 1146      F9F9F9
+ 1147 2803 FFFAFAFA 		.ascii	"\377\372\372\372\377\372\372\372\377\372\372\372\377"
+ 1147      FFFAFAFA 
+ 1147      FFFAFAFA 
+GAS LISTING /tmp/ccNTHH7d.s 			page 44
+
+
+ 1147      FF
+ 1148 2810 FBFBFBFF 		.ascii	"\373\373\373\377\373\373\373\377\373\373\373\377\373\373\373"
+ 1148      FBFBFBFF 
+ 1148      FBFBFBFF 
+ 1148      FBFBFB
+ 1149 281f FFFCFCFC 		.ascii	"\377\374\374\374\377\374\374\374\377\374\374\374\377\375\375"
+ 1149      FFFCFCFC 
+ 1149      FFFCFCFC 
+ 1149      FFFDFD
+ 1150 282e FDFFFDFD 		.ascii	"\375\377\375\375\375\377\375\375\375\377\376\376\376\377\376"
+ 1150      FDFFFDFD 
+ 1150      FDFFFEFE 
+ 1150      FEFFFE
+ 1151 283d FEFEFFFE 		.ascii	"\376\376\377\376\376\376\377\377\376\377\377\377\376\376\377"
+ 1151      FEFEFFFF 
+ 1151      FEFFFFFF 
+ 1151      FEFEFF
+ 1152 284c FFFEFEFF 		.ascii	"\377\376\376\377\377\375\376\377\377\375\375\377\377\375\375"
+ 1152      FFFDFEFF 
+ 1152      FFFDFDFF 
+ 1152      FFFDFD
+ 1153 285b FFFFFCFD 		.ascii	"\377\377\374\375\377\377\374\374\377\377\373\374\377\377\373"
+ 1153      FFFFFCFC 
+ 1153      FFFFFBFC 
+ 1153      FFFFFB
+ 1154 286a FCFFFFFB 		.ascii	"\374\377\377\373\373\377\377\372\373\377\377\372\373\377\377"
+ 1154      FBFFFFFA 
+ 1154      FBFFFFFA 
+ 1154      FBFFFF
+ 1155 2879 F9FAFFFF 		.ascii	"\371\372\377\377\371\372\377\377\371\372\377\377\370\371\377"
+ 1155      F9FAFFFF 
+ 1155      F9FAFFFF 
+ 1155      F8F9FF
+ 1156 2888 FFF8F9FF 		.ascii	"\377\370\371\377\377\367\370\377\377\367\370\377\377\367\370"
+ 1156      FFF7F8FF 
+ 1156      FFF7F8FF 
+ 1156      FFF7F8
+ 1157 2897 FFFFF6F7 		.ascii	"\377\377\366\367\377\377\366\367\377\377\365\366\377\377\365"
+ 1157      FFFFF6F7 
+ 1157      FFFFF5F6 
+ 1157      FFFFF5
+ 1158 28a6 F6FFFFF5 		.ascii	"\366\377\377\365\365\377\377\364\365\377\377\364\365\377\377"
+ 1158      F5FFFFF4 
+ 1158      F5FFFFF4 
+ 1158      F5FFFF
+ 1159 28b5 F4F4FFFF 		.ascii	"\364\364\377\377\363\364\377\377\363\363\377\377\362\363\377"
+ 1159      F3F4FFFF 
+ 1159      F3F3FFFF 
+ 1159      F2F3FF
+ 1160 28c4 FFF2F2FF 		.ascii	"\377\362\362\377\377\362\362\377\377\361\361\377\377\361\361"
+ 1160      FFF2F2FF 
+ 1160      FFF1F1FF 
+ 1160      FFF1F1
+ 1161 28d3 FFFFF0F0 		.ascii	"\377\377\360\360\377\377\360\360\377\377\360\357\377\377\357"
+ 1161      FFFFF0F0 
+ 1161      FFFFF0EF 
+ 1161      FFFFEF
+GAS LISTING /tmp/ccNTHH7d.s 			page 45
+
+
+ 1162 28e2 EFFFFFEF 		.ascii	"\357\377\377\357\356\377\377\357\356\377\377\356\355\377\377"
+ 1162      EEFFFFEF 
+ 1162      EEFFFFEE 
+ 1162      EDFFFF
+ 1163 28f1 EEEDFFFF 		.ascii	"\356\355\377\377\355\354\377\377\355\354\377\377\355\353\377"
+ 1163      EDECFFFF 
+ 1163      EDECFFFF 
+ 1163      EDEBFF
+ 1164 2900 FFECEBFF 		.ascii	"\377\354\353\377\377\354\352\377\377\354\351\377\377\353\351"
+ 1164      FFECEAFF 
+ 1164      FFECE9FF 
+ 1164      FFEBE9
+ 1165 290f FFFFEBE8 		.ascii	"\377\377\353\350\377\377\352\350\377\377\352\347\377\377\352"
+ 1165      FFFFEAE8 
+ 1165      FFFFEAE7 
+ 1165      FFFFEA
+ 1166 291e E7FFFFE9 		.ascii	"\347\377\377\351\346\377\377\351\345\377\377\351\345\377\377"
+ 1166      E6FFFFE9 
+ 1166      E5FFFFE9 
+ 1166      E5FFFF
+ 1167 292d E8E4FFFF 		.ascii	"\350\344\377\377\350\344\377\377\350\343\377\377\347\342\377"
+ 1167      E8E4FFFF 
+ 1167      E8E3FFFF 
+ 1167      E7E2FF
+ 1168 293c FFE7E2FF 		.ascii	"\377\347\342\377\377\347\341\377\377\346\340\377\377\346\340"
+ 1168      FFE7E1FF 
+ 1168      FFE6E0FF 
+ 1168      FFE6E0
+ 1169 294b FFFFE6DF 		.ascii	"\377\377\346\337\377\377\345\337\377\377\345\336\377\377\345"
+ 1169      FFFFE5DF 
+ 1169      FFFFE5DE 
+ 1169      FFFFE5
+ 1170 295a DDFFFFE4 		.ascii	"\335\377\377\344\335\377\377\344\334\377\377\344\333\377\377"
+ 1170      DDFFFFE4 
+ 1170      DCFFFFE4 
+ 1170      DBFFFF
+ 1171 2969 E3DBFFFF 		.ascii	"\343\333\377\377\343\332\377\377\343\331\377\377\342\331\377"
+ 1171      E3DAFFFF 
+ 1171      E3D9FFFF 
+ 1171      E2D9FF
+ 1172 2978 FFE2D8FF 		.ascii	"\377\342\330\377\377\342\327\377\377\341\327\377\377\341\326"
+ 1172      FFE2D7FF 
+ 1172      FFE1D7FF 
+ 1172      FFE1D6
+ 1173 2987 FFFFE1D5 		.ascii	"\377\377\341\325\377\377\340\325\377\377\340\324\377\377\340"
+ 1173      FFFFE0D5 
+ 1173      FFFFE0D4 
+ 1173      FFFFE0
+ 1174 2996 D3FFFFDF 		.ascii	"\323\377\377\337\323\377\377\337\322\377\377\337\321\377\377"
+ 1174      D3FFFFDF 
+ 1174      D2FFFFDF 
+ 1174      D1FFFF
+ 1175 29a5 DFD1FFFF 		.ascii	"\337\321\377\377\336\320\377\377\336\317\377\377\336\317\377"
+ 1175      DED0FFFF 
+ 1175      DECFFFFF 
+ 1175      DECFFF
+ 1176 29b4 FFDDCEFF 		.ascii	"\377\335\316\377\377\335\315\377\376\335\314\377\376\335\314"
+GAS LISTING /tmp/ccNTHH7d.s 			page 46
+
+
+ 1176      FFDDCDFF 
+ 1176      FEDDCCFF 
+ 1176      FEDDCC
+ 1177 29c3 FFFEDCCB 		.ascii	"\377\376\334\313\377\376\334\312\377\376\334\312\377\375\333"
+ 1177      FFFEDCCA 
+ 1177      FFFEDCCA 
+ 1177      FFFDDB
+ 1178 29d2 C9FFFDDB 		.ascii	"\311\377\375\333\310\377\375\333\307\377\375\333\307\377\374"
+ 1178      C8FFFDDB 
+ 1178      C7FFFDDB 
+ 1178      C7FFFC
+ 1179 29e1 DAC6FFFC 		.ascii	"\332\306\377\374\332\305\377\374\331\305\377\374\331\304\377"
+ 1179      DAC5FFFC 
+ 1179      D9C5FFFC 
+ 1179      D9C4FF
+ 1180 29f0 FCD8C3FF 		.ascii	"\374\330\303\377\374\330\302\377\374\327\302\377\374\327\301"
+ 1180      FCD8C2FF 
+ 1180      FCD7C2FF 
+ 1180      FCD7C1
+ 1181 29ff FFFCD6C0 		.ascii	"\377\374\326\300\377\374\326\300\377\374\325\277\377\374\325"
+ 1181      FFFCD6C0 
+ 1181      FFFCD5BF 
+ 1181      FFFCD5
+ 1182 2a0e BEFFFCD4 		.ascii	"\276\377\374\324\275\377\374\323\275\377\373\323\274\377\373"
+ 1182      BDFFFCD3 
+ 1182      BDFFFBD3 
+ 1182      BCFFFB
+ 1183 2a1d D2BBFFFB 		.ascii	"\322\273\377\373\322\272\377\373\321\272\377\373\321\271\377"
+ 1183      D2BAFFFB 
+ 1183      D1BAFFFB 
+ 1183      D1B9FF
+ 1184 2a2c FBD0B8FF 		.ascii	"\373\320\270\377\373\320\270\377\373\317\267\377\373\317\266"
+ 1184      FBD0B8FF 
+ 1184      FBCFB7FF 
+ 1184      FBCFB6
+ 1185 2a3b FFFBCEB6 		.ascii	"\377\373\316\266\377\373\316\265\377\373\315\264\377\373\315"
+ 1185      FFFBCEB5 
+ 1185      FFFBCDB4 
+ 1185      FFFBCD
+ 1186 2a4a B3FFFACC 		.ascii	"\263\377\372\314\263\377\372\314\262\377\372\313\261\377\372"
+ 1186      B3FFFACC 
+ 1186      B2FFFACB 
+ 1186      B1FFFA
+ 1187 2a59 CBB1FFFA 		.ascii	"\313\261\377\372\312\260\377\372\312\257\377\372\311\257\377"
+ 1187      CAB0FFFA 
+ 1187      CAAFFFFA 
+ 1187      C9AFFF
+ 1188 2a68 FAC9AEFF 		.ascii	"\372\311\256\377\372\310\255\377\372\310\254\377\372\307\254"
+ 1188      FAC8ADFF 
+ 1188      FAC8ACFF 
+ 1188      FAC7AC
+ 1189 2a77 FFFAC6AB 		.ascii	"\377\372\306\253\377\371\306\252\377\371\305\252\377\371\305"
+ 1189      FFF9C6AA 
+ 1189      FFF9C5AA 
+ 1189      FFF9C5
+ 1190 2a86 A9FFF9C4 		.ascii	"\251\377\371\304\250\377\371\304\250\377\371\303\247\377\371"
+ 1190      A8FFF9C4 
+GAS LISTING /tmp/ccNTHH7d.s 			page 47
+
+
+ 1190      A8FFF9C3 
+ 1190      A7FFF9
+ 1191 2a95 C3A6FFF9 		.ascii	"\303\246\377\371\302\246\377\371\302\245\377\371\301\244\377"
+ 1191      C2A6FFF9 
+ 1191      C2A5FFF9 
+ 1191      C1A4FF
+ 1192 2aa4 F9C1A4FF 		.ascii	"\371\301\244\377\371\300\243\377\370\300\242\377\370\277\242"
+ 1192      F9C0A3FF 
+ 1192      F8C0A2FF 
+ 1192      F8BFA2
+ 1193 2ab3 FFF8BFA1 		.ascii	"\377\370\277\241\377\370\276\240\377\370\276\240\377\370\275"
+ 1193      FFF8BEA0 
+ 1193      FFF8BEA0 
+ 1193      FFF8BD
+ 1194 2ac2 9FFFF8BC 		.ascii	"\237\377\370\274\236\377\370\274\236\377\370\273\235\377\370"
+ 1194      9EFFF8BC 
+ 1194      9EFFF8BB 
+ 1194      9DFFF8
+ 1195 2ad1 BB9CFFF8 		.ascii	"\273\234\377\370\272\234\377\367\272\233\377\367\271\232\377"
+ 1195      BA9CFFF7 
+ 1195      BA9BFFF7 
+ 1195      B99AFF
+ 1196 2ae0 F7B99AFF 		.ascii	"\367\271\232\377\367\270\231\377\367\270\230\377\367\267\230"
+ 1196      F7B899FF 
+ 1196      F7B898FF 
+ 1196      F7B798
+ 1197 2aef FFF7B797 		.ascii	"\377\367\267\227\377\367\266\226\377\367\266\226\377\367\265"
+ 1197      FFF7B696 
+ 1197      FFF7B696 
+ 1197      FFF7B5
+ 1198 2afe 95FFF7B5 		.ascii	"\225\377\367\265\224\377\366\264\224\377\366\263\223\377\366"
+ 1198      94FFF6B4 
+ 1198      94FFF6B3 
+ 1198      93FFF6
+ 1199 2b0d B392FFF6 		.ascii	"\263\222\377\366\262\222\377\366\262\221\377\366\261\220\377"
+ 1199      B292FFF6 
+ 1199      B291FFF6 
+ 1199      B190FF
+ 1200 2b1c F6B190FF 		.ascii	"\366\261\220\377\366\260\217\377\366\260\217\377\366\257\216"
+ 1200      F6B08FFF 
+ 1200      F6B08FFF 
+ 1200      F6AF8E
+ 1201 2b2b FFF5AF8D 		.ascii	"\377\365\257\215\377\365\256\215\377\365\256\214\377\365\255"
+ 1201      FFF5AE8D 
+ 1201      FFF5AE8C 
+ 1201      FFF5AD
+ 1202 2b3a 8BFFF5AD 		.ascii	"\213\377\365\255\213\377\365\254\212\377\365\253\211\377\365"
+ 1202      8BFFF5AC 
+ 1202      8AFFF5AB 
+ 1202      89FFF5
+ 1203 2b49 AB89FFF5 		.ascii	"\253\211\377\365\252\210\377\365\252\210\377\364\251\207\377"
+ 1203      AA88FFF5 
+ 1203      AA88FFF4 
+ 1203      A987FF
+ 1204 2b58 F4A986FF 		.ascii	"\364\251\206\377\364\250\206\377\364\250\205\377\364\247\204"
+ 1204      F4A886FF 
+ 1204      F4A885FF 
+GAS LISTING /tmp/ccNTHH7d.s 			page 48
+
+
+ 1204      F4A784
+ 1205 2b67 FFF4A784 		.ascii	"\377\364\247\204\377\364\246\203\377\364\245\203\377\364\245"
+ 1205      FFF4A683 
+ 1205      FFF4A583 
+ 1205      FFF4A5
+ 1206 2b76 82FFF3A4 		.ascii	"\202\377\363\244\201\377\363\244\201\377\363\243\200\377\363"
+ 1206      81FFF3A4 
+ 1206      81FFF3A3 
+ 1206      80FFF3
+ 1207 2b85 A280FFF2 		.ascii	"\242\200\377\362\242\177\377\362\241~\377\362\240~\377\361\240"
+ 1207      A27FFFF2 
+ 1207      A17EFFF2 
+ 1207      A07EFFF1 
+ 1207      A0
+ 1208 2b96 7DFFF19F 		.ascii	"}\377\361\237}\377\361\237|\377\361\236{\377\360\235{\377\360"
+ 1208      7DFFF19F 
+ 1208      7CFFF19E 
+ 1208      7BFFF09D 
+ 1208      7BFFF0
+ 1209 2ba9 9D7AFFF0 		.ascii	"\235z\377\360\234z\377\360\233y\377\357\233x\377\357\232x\377"
+ 1209      9C7AFFF0 
+ 1209      9B79FFEF 
+ 1209      9B78FFEF 
+ 1209      9A78FF
+ 1210 2bbc EF9977FF 		.ascii	"\357\231w\377\356\231w\377\356\230v\377\356\227v\377\356\227"
+ 1210      EE9977FF 
+ 1210      EE9876FF 
+ 1210      EE9776FF 
+ 1210      EE97
+ 1211 2bce 75FFED96 		.ascii	"u\377\355\226t\377\355\225t\377\355\225s\377\354\224s\377\354"
+ 1211      74FFED95 
+ 1211      74FFED95 
+ 1211      73FFEC94 
+ 1211      73FFEC
+ 1212 2be1 9372FFEC 		.ascii	"\223r\377\354\223r\377\354\222q\377\353\221q\377\353\221p\377"
+ 1212      9372FFEC 
+ 1212      9271FFEB 
+ 1212      9171FFEB 
+ 1212      9170FF
+ 1213 2bf4 EB906FFF 		.ascii	"\353\220o\377\352\217o\377\352\217n\377\352\216n\377\352\216"
+ 1213      EA8F6FFF 
+ 1213      EA8F6EFF 
+ 1213      EA8E6EFF 
+ 1213      EA8E
+ 1214 2c06 6DFFE98D 		.ascii	"m\377\351\215m\377\351\214l\377\351\214l\377\350\213k\377\350"
+ 1214      6DFFE98C 
+ 1214      6CFFE98C 
+ 1214      6CFFE88B 
+ 1214      6BFFE8
+ 1215 2c19 8A6AFFE8 		.ascii	"\212j\377\350\212j\377\350\211i\377\347\210i\377\347\210h\377"
+ 1215      8A6AFFE8 
+ 1215      8969FFE7 
+ 1215      8869FFE7 
+ 1215      8868FF
+ 1216 2c2c E78768FF 		.ascii	"\347\207h\377\346\206g\377\346\206g\377\346\205f\377\346\204"
+ 1216      E68667FF 
+ 1216      E68667FF 
+GAS LISTING /tmp/ccNTHH7d.s 			page 49
+
+
+ 1216      E68566FF 
+ 1216      E684
+ 1217 2c3e 66FFE584 		.ascii	"f\377\345\204e\377\345\203e\377\345\202d\377\344\202d\377\344"
+ 1217      65FFE583 
+ 1217      65FFE582 
+ 1217      64FFE482 
+ 1217      64FFE4
+ 1218 2c51 8163FFE4 		.ascii	"\201c\377\344\200c\377\343\200b\377\343\177b\377\343~a\377\343"
+ 1218      8063FFE3 
+ 1218      8062FFE3 
+ 1218      7F62FFE3 
+ 1218      7E61FFE3 
+ 1219 2c65 7E61FFE2 		.ascii	"~a\377\342}`\377\342|`\377\342{_\377\341{_\377\341z^\377\341"
+ 1219      7D60FFE2 
+ 1219      7C60FFE2 
+ 1219      7B5FFFE1 
+ 1219      7B5FFFE1 
+ 1220 2c7d 795EFFE1 		.ascii	"y^\377\341y]\377\340x]\377\340w\\\377\340w\\\377\337v[\377\337"
+ 1220      795DFFE0 
+ 1220      785DFFE0 
+ 1220      775CFFE0 
+ 1220      775CFFDF 
+ 1221 2c95 755BFFDF 		.ascii	"u[\377\337uZ\377\336tZ\377\336sY\377\336sY\377\336rX\377\335"
+ 1221      755AFFDE 
+ 1221      745AFFDE 
+ 1221      7359FFDE 
+ 1221      7359FFDE 
+ 1222 2cad 7158FFDD 		.ascii	"qX\377\335qW\377\335pW\377\334oV\377\334nV\377\334nU\377\333"
+ 1222      7157FFDD 
+ 1222      7057FFDC 
+ 1222      6F56FFDC 
+ 1222      6E56FFDC 
+ 1223 2cc5 6D55FFDB 		.ascii	"mU\377\333lU\377\333lT\377\333kT\377\332jS\377\332jS\377\332"
+ 1223      6C55FFDB 
+ 1223      6C54FFDB 
+ 1223      6B54FFDA 
+ 1223      6A53FFDA 
+ 1224 2cdd 6952FFD9 		.ascii	"iR\377\331hR\377\331gQ\377\331gQ\377\330fP\377\330eP\377\330"
+ 1224      6852FFD9 
+ 1224      6751FFD9 
+ 1224      6751FFD8 
+ 1224      6650FFD8 
+ 1225 2cf5 6550FFD7 		.ascii	"eP\377\327dO\377\327cO\377\327cN\377\326bN\377\326aM\377\326"
+ 1225      644FFFD7 
+ 1225      634FFFD7 
+ 1225      634EFFD6 
+ 1225      624EFFD6 
+ 1226 2d0d 604DFFD6 		.ascii	"`M\377\326`M\377\325_L\377\325^L\377\325^K\377\324]K\377\324"
+ 1226      604DFFD5 
+ 1226      5F4CFFD5 
+ 1226      5E4CFFD5 
+ 1226      5E4BFFD4 
+ 1227 2d25 5D4BFFD4 		.ascii	"]K\377\324\\J\377\323\\J\377\323[J\377\322ZI\377\322ZI\377\322"
+ 1227      5C4AFFD3 
+ 1227      5C4AFFD3 
+ 1227      5B4AFFD2 
+ 1227      5A49FFD2 
+GAS LISTING /tmp/ccNTHH7d.s 			page 50
+
+
+ 1228 2d3d 5948FFD1 		.ascii	"YH\377\321YH\377\321XH\377\321WG\377\320WG\377\320VG\377\320"
+ 1228      5948FFD1 
+ 1228      5848FFD1 
+ 1228      5747FFD0 
+ 1228      5747FFD0 
+ 1229 2d55 5646FFCF 		.ascii	"VF\377\317UF\377\317UF\377\317TE\377\316SE\377\316SD\377\316"
+ 1229      5546FFCF 
+ 1229      5546FFCF 
+ 1229      5445FFCE 
+ 1229      5345FFCE 
+ 1230 2d6d 5244FFCD 		.ascii	"RD\377\315RD\377\315QC\377\315PC\377\314PC\377\314OB\377\314"
+ 1230      5244FFCD 
+ 1230      5143FFCD 
+ 1230      5043FFCC 
+ 1230      5043FFCC 
+ 1231 2d85 4F42FFCB 		.ascii	"OB\377\313NB\377\313MA\377\313MA\377\312LA\377\312L@\377\312"
+ 1231      4E42FFCB 
+ 1231      4D41FFCB 
+ 1231      4D41FFCA 
+ 1231      4C41FFCA 
+ 1232 2d9d 4B40FFC9 		.ascii	"K@\377\311J@\377\311J?\377\310I?\377\310H?\377\310H>\377\307"
+ 1232      4A40FFC9 
+ 1232      4A3FFFC8 
+ 1232      493FFFC8 
+ 1232      483FFFC8 
+ 1233 2db5 473EFFC7 		.ascii	"G>\377\307G=\377\307F=\377\306E=\377\306E<\377\306D<\377\305"
+ 1233      473DFFC7 
+ 1233      463DFFC6 
+ 1233      453DFFC6 
+ 1233      453CFFC6 
+ 1234 2dcd 433CFFC5 		.ascii	"C<\377\305C;\377\305B;\377\304B;\377\304A:\377\304@:\377\303"
+ 1234      433BFFC5 
+ 1234      423BFFC4 
+ 1234      423BFFC4 
+ 1234      413AFFC4 
+ 1235 2de5 403AFFC3 		.ascii	"@:\377\303?9\377\303>9\377\302>9\377\302=8\377\301<8\377\301"
+ 1235      3F39FFC3 
+ 1235      3E39FFC2 
+ 1235      3E39FFC2 
+ 1235      3D38FFC1 
+ 1236 2dfd 3C38FFC1 		.ascii	"<8\377\301;7\377\300:7\377\300:7\377\30097\377\27786\377\277"
+ 1236      3B37FFC0 
+ 1236      3A37FFC0 
+ 1236      3A37FFC0 
+ 1236      3937FFBF 
+ 1237 2e15 3736FFBF 		.ascii	"76\377\27776\377\27665\377\27655\377\27655\377\27544\377\275"
+ 1237      3736FFBE 
+ 1237      3635FFBE 
+ 1237      3535FFBE 
+ 1237      3535FFBD 
+ 1238 2e2d 3334FFBD 		.ascii	"34\377\27534\377\27423\377\27413\377\27303\377\27302\377\273"
+ 1238      3334FFBC 
+ 1238      3233FFBC 
+ 1238      3133FFBB 
+ 1238      3033FFBB 
+ 1239 2e45 2F32FFBA 		.ascii	"/2\377\272.2\377\272-1\377\272,1\377\271,1\377\271+1\377\271"
+ 1239      2E32FFBA 
+GAS LISTING /tmp/ccNTHH7d.s 			page 51
+
+
+ 1239      2D31FFBA 
+ 1239      2C31FFB9 
+ 1239      2C31FFB9 
+ 1240 2e5d 2A30FFB8 		.ascii	"*0\377\270)0\377\270(0\377\270(/\377\267'/\377\267&/\377\266"
+ 1240      2930FFB8 
+ 1240      2830FFB8 
+ 1240      282FFFB7 
+ 1240      272FFFB7 
+ 1241 2e75 252EFFB6 		.ascii	"%.\377\266$.\377\266#.\377\265\".\377\265!-\377\265!-\377\264"
+ 1241      242EFFB6 
+ 1241      232EFFB5 
+ 1241      222EFFB5 
+ 1241      212DFFB5 
+ 1242 2e8d 202DFFB4 		.ascii	" -\377\264\037,\377\264\036,\377\263\035,\377\263\034,\377\262"
+ 1242      1F2CFFB4 
+ 1242      1E2CFFB3 
+ 1242      1D2CFFB3 
+ 1242      1C2CFFB2 
+ 1243 2ea1 1A2BFFB2 		.ascii	"\032+\377\262\031+\377\262\030+\377\261\027*\377\260\027*\377"
+ 1243      192BFFB2 
+ 1243      182BFFB1 
+ 1243      172AFFB0 
+ 1243      172AFF
+ 1244 2eb4 B0172AFF 		.ascii	"\260\027*\377\257\026*\377\256\026*\377\256\026*\377\255\025"
+ 1244      AF162AFF 
+ 1244      AE162AFF 
+ 1244      AE162AFF 
+ 1244      AD15
+ 1245 2ec6 2AFFAC15 		.ascii	"*\377\254\025*\377\253\025*\377\253\024*\377\252\024*\377\251"
+ 1245      2AFFAB15 
+ 1245      2AFFAB14 
+ 1245      2AFFAA14 
+ 1245      2AFFA9
+ 1246 2ed9 142AFFA8 		.ascii	"\024*\377\250\023*\377\250\023*\377\247\023*\377\246\022)\377"
+ 1246      132AFFA8 
+ 1246      132AFFA7 
+ 1246      132AFFA6 
+ 1246      1229FF
+ 1247 2eec A51229FF 		.ascii	"\245\022)\377\245\022)\377\244\021)\377\243\021)\377\242\021"
+ 1247      A51229FF 
+ 1247      A41129FF 
+ 1247      A31129FF 
+ 1247      A211
+ 1248 2efe 29FFA210 		.ascii	")\377\242\020)\377\241\020)\377\240\020)\377\237\017)\377\237"
+ 1248      29FFA110 
+ 1248      29FFA010 
+ 1248      29FF9F0F 
+ 1248      29FF9F
+ 1249 2f11 0F29FF9E 		.ascii	"\017)\377\236\017)\377\235\016(\377\234\016(\377\234\016(\377"
+ 1249      0F29FF9D 
+ 1249      0E28FF9C 
+ 1249      0E28FF9C 
+ 1249      0E28FF
+ 1250 2f24 9B0E28FF 		.ascii	"\233\016(\377\232\r(\377\232\r(\377\231\r(\377\230\f(\377\227"
+ 1250      9A0D28FF 
+ 1250      9A0D28FF 
+ 1250      990D28FF 
+GAS LISTING /tmp/ccNTHH7d.s 			page 52
+
+
+ 1250      980C28FF 
+ 1251 2f39 0C28FF97 		.ascii	"\f(\377\227\f(\377\226\013(\377\225\013'\377\224\013'\377\224"
+ 1251      0C28FF96 
+ 1251      0B28FF95 
+ 1251      0B27FF94 
+ 1251      0B27FF94 
+ 1252 2f4d 0A27FF93 		.ascii	"\n'\377\223\n'\377\222\n'\377\221\n'\377\221\t'\377\220\t'\377"
+ 1252      0A27FF92 
+ 1252      0A27FF91 
+ 1252      0A27FF91 
+ 1252      0927FF90 
+ 1253 2f64 8F0927FF 		.ascii	"\217\t'\377\216\b&\377\216\b&\377\215\b&\377\214\b&\377\214\007"
+ 1253      8E0826FF 
+ 1253      8E0826FF 
+ 1253      8D0826FF 
+ 1253      8C0826FF 
+ 1254 2f7a 26FF8B07 		.ascii	"&\377\213\007&\377\212\007&\377\211\006&\377\211\006%\377\210"
+ 1254      26FF8A07 
+ 1254      26FF8906 
+ 1254      26FF8906 
+ 1254      25FF88
+ 1255 2f8d 0625FF87 		.ascii	"\006%\377\207\006%\377\206\006%\377\206\005%\377\205\005%\377"
+ 1255      0625FF86 
+ 1255      0625FF86 
+ 1255      0525FF85 
+ 1255      0525FF
+ 1256 2fa0 840525FF 		.ascii	"\204\005%\377\203\005%\377\203\004$\377\202\004$\377\201\004"
+ 1256      830525FF 
+ 1256      830424FF 
+ 1256      820424FF 
+ 1256      8104
+ 1257 2fb2 24FF8104 		.ascii	"$\377\201\004$\377\200\004$\377\177\004$\377~\003$\377~\003$"
+ 1257      24FF8004 
+ 1257      24FF7F04 
+ 1257      24FF7E03 
+ 1257      24FF7E03 
+ 1258 2fc7 FF7D0323 		.ascii	"\377}\003#\377|\003#\377{\003#\377{\003#\377z\002#\377y\002#"
+ 1258      FF7C0323 
+ 1258      FF7B0323 
+ 1258      FF7B0323 
+ 1258      FF7A0223 
+ 1259 2fdf FF       		.ascii	"\377"
+ 1260 2fe0 790223FF 		.string	"y\002#\377x\002\"\377w\002\"\377v\002\"\377v\002\"\377u\001\"\377t\001\"\377s\001!\377s\0
+ 1260      780222FF 
+ 1260      770222FF 
+ 1260      760222FF 
+ 1260      760222FF 
+ 1261 301a 20FF6E00 		.string	" \377n"
+ 1262 301e 20FF6D00 		.string	" \377m"
+ 1263 3022 20FF6C00 		.string	" \377l"
+ 1264 3026 20FF6C00 		.string	" \377l"
+ 1265 302a 20FF6B00 		.string	" \377k"
+ 1266 302e 20FF6A00 		.string	" \377j"
+ 1267 3032 1FFF6900 		.string	"\037\377i"
+ 1268 3036 1FFF6900 		.string	"\037\377i"
+ 1269 303a 1FFF6800 		.string	"\037\377h"
+ 1270 303e 1FFF6700 		.string	"\037\377g"
+GAS LISTING /tmp/ccNTHH7d.s 			page 53
+
+
+ 1271 3042 1FFF     		.ascii	"\037\377"
+ 1272              		.globl	heatmap_cs_RdGy_discrete
+ 1273              		.section	.data.rel.local
+ 1274              		.align 8
+ 1275              		.type	heatmap_cs_RdGy_discrete, @object
+ 1276              		.size	heatmap_cs_RdGy_discrete, 8
+ 1277              	heatmap_cs_RdGy_discrete:
+ 1278 0018 00000000 		.quad	discrete
+ 1278      00000000 
+ 1279              		.section	.data.rel.ro.local
+ 1280              		.align 16
+ 1281              		.type	discrete, @object
+ 1282              		.size	discrete, 16
+ 1283              	discrete:
+ 1284 0030 00000000 		.quad	discrete_data
+ 1284      00000000 
+ 1285 0038 0C000000 		.quad	12
+ 1285      00000000 
+ 1286              		.section	.rodata
+ 1287 3044 00000000 		.align 32
+ 1287      00000000 
+ 1287      00000000 
+ 1287      00000000 
+ 1287      00000000 
+ 1288              		.type	discrete_data, @object
+ 1289              		.size	discrete_data, 48
+ 1290              	discrete_data:
+ 1291 3060 00       		.string	""
+ 1292 3061 00       		.string	""
+ 1293 3062 00       		.string	""
+ 1294 3063 00       		.string	""
+ 1295 3064 1A1A1AFF 		.string	"\032\032\032\377MMM\377\207\207\207\377\272\272\272\377\340\340\340\377\377\377\377\377\3
+ 1295      4D4D4DFF 
+ 1295      878787FF 
+ 1295      BABABAFF 
+ 1295      E0E0E0FF 
+ 1296 308e 1FFF     		.ascii	"\037\377"
+ 1297              		.text
+ 1298              	.Letext0:
+ 1299              		.file 1 "./heatmap.h"
+ 1300              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1301              		.file 3 "./colorschemes/RdGy.h"
+ 1302              		.file 4 "colorschemes/RdGy.c"
+ 1303              		.section	.debug_info,"",@progbits
+ 1304              	.Ldebug_info0:
+ 1305 0000 E3010000 		.long	0x1e3
+ 1306 0004 0500     		.value	0x5
+ 1307 0006 01       		.byte	0x1
+ 1308 0007 08       		.byte	0x8
+ 1309 0008 00000000 		.long	.Ldebug_abbrev0
+ 1310 000c 0A       		.uleb128 0xa
+ 1311 000d 00000000 		.long	.LASF26
+ 1312 0011 1D       		.byte	0x1d
+ 1313 0012 00000000 		.long	.LASF0
+ 1314 0016 00000000 		.long	.LASF1
+ 1315 001a 00000000 		.long	.Ldebug_line0
+ 1316 001e 01       		.uleb128 0x1
+GAS LISTING /tmp/ccNTHH7d.s 			page 54
+
+
+ 1317 001f 08       		.byte	0x8
+ 1318 0020 05       		.byte	0x5
+ 1319 0021 00000000 		.long	.LASF2
+ 1320 0025 06       		.uleb128 0x6
+ 1321 0026 00000000 		.long	.LASF12
+ 1322 002a 02       		.byte	0x2
+ 1323 002b D6       		.byte	0xd6
+ 1324 002c 17       		.byte	0x17
+ 1325 002d 31000000 		.long	0x31
+ 1326 0031 01       		.uleb128 0x1
+ 1327 0032 08       		.byte	0x8
+ 1328 0033 07       		.byte	0x7
+ 1329 0034 00000000 		.long	.LASF3
+ 1330 0038 0B       		.uleb128 0xb
+ 1331 0039 04       		.byte	0x4
+ 1332 003a 05       		.byte	0x5
+ 1333 003b 696E7400 		.string	"int"
+ 1334 003f 01       		.uleb128 0x1
+ 1335 0040 08       		.byte	0x8
+ 1336 0041 05       		.byte	0x5
+ 1337 0042 00000000 		.long	.LASF4
+ 1338 0046 01       		.uleb128 0x1
+ 1339 0047 10       		.byte	0x10
+ 1340 0048 04       		.byte	0x4
+ 1341 0049 00000000 		.long	.LASF5
+ 1342 004d 01       		.uleb128 0x1
+ 1343 004e 04       		.byte	0x4
+ 1344 004f 04       		.byte	0x4
+ 1345 0050 00000000 		.long	.LASF6
+ 1346 0054 01       		.uleb128 0x1
+ 1347 0055 04       		.byte	0x4
+ 1348 0056 07       		.byte	0x7
+ 1349 0057 00000000 		.long	.LASF7
+ 1350 005b 01       		.uleb128 0x1
+ 1351 005c 02       		.byte	0x2
+ 1352 005d 07       		.byte	0x7
+ 1353 005e 00000000 		.long	.LASF8
+ 1354 0062 0C       		.uleb128 0xc
+ 1355 0063 10       		.byte	0x10
+ 1356 0064 01       		.byte	0x1
+ 1357 0065 BB       		.byte	0xbb
+ 1358 0066 09       		.byte	0x9
+ 1359 0067 84000000 		.long	0x84
+ 1360 006b 07       		.uleb128 0x7
+ 1361 006c 00000000 		.long	.LASF9
+ 1362 0070 BC       		.byte	0xbc
+ 1363 0071 1A       		.byte	0x1a
+ 1364 0072 84000000 		.long	0x84
+ 1365 0076 00       		.byte	0
+ 1366 0077 07       		.uleb128 0x7
+ 1367 0078 00000000 		.long	.LASF10
+ 1368 007c BD       		.byte	0xbd
+ 1369 007d 0C       		.byte	0xc
+ 1370 007e 25000000 		.long	0x25
+ 1371 0082 08       		.byte	0x8
+ 1372 0083 00       		.byte	0
+ 1373 0084 08       		.uleb128 0x8
+GAS LISTING /tmp/ccNTHH7d.s 			page 55
+
+
+ 1374 0085 90000000 		.long	0x90
+ 1375 0089 01       		.uleb128 0x1
+ 1376 008a 01       		.byte	0x1
+ 1377 008b 08       		.byte	0x8
+ 1378 008c 00000000 		.long	.LASF11
+ 1379 0090 03       		.uleb128 0x3
+ 1380 0091 89000000 		.long	0x89
+ 1381 0095 06       		.uleb128 0x6
+ 1382 0096 00000000 		.long	.LASF13
+ 1383 009a 01       		.byte	0x1
+ 1384 009b BE       		.byte	0xbe
+ 1385 009c 03       		.byte	0x3
+ 1386 009d 62000000 		.long	0x62
+ 1387 00a1 03       		.uleb128 0x3
+ 1388 00a2 95000000 		.long	0x95
+ 1389 00a6 08       		.uleb128 0x8
+ 1390 00a7 A1000000 		.long	0xa1
+ 1391 00ab 04       		.uleb128 0x4
+ 1392 00ac 00000000 		.long	.LASF14
+ 1393 00b0 21       		.byte	0x21
+ 1394 00b1 A6000000 		.long	0xa6
+ 1395 00b5 04       		.uleb128 0x4
+ 1396 00b6 00000000 		.long	.LASF15
+ 1397 00ba 23       		.byte	0x23
+ 1398 00bb A6000000 		.long	0xa6
+ 1399 00bf 04       		.uleb128 0x4
+ 1400 00c0 00000000 		.long	.LASF16
+ 1401 00c4 25       		.byte	0x25
+ 1402 00c5 A6000000 		.long	0xa6
+ 1403 00c9 04       		.uleb128 0x4
+ 1404 00ca 00000000 		.long	.LASF17
+ 1405 00ce 28       		.byte	0x28
+ 1406 00cf A6000000 		.long	0xa6
+ 1407 00d3 09       		.uleb128 0x9
+ 1408 00d4 90000000 		.long	0x90
+ 1409 00d8 E3000000 		.long	0xe3
+ 1410 00dc 0D       		.uleb128 0xd
+ 1411 00dd 31000000 		.long	0x31
+ 1412 00e1 2F       		.byte	0x2f
+ 1413 00e2 00       		.byte	0
+ 1414 00e3 03       		.uleb128 0x3
+ 1415 00e4 D3000000 		.long	0xd3
+ 1416 00e8 02       		.uleb128 0x2
+ 1417 00e9 00000000 		.long	.LASF18
+ 1418 00ed 20       		.byte	0x20
+ 1419 00ee 1C       		.byte	0x1c
+ 1420 00ef E3000000 		.long	0xe3
+ 1421 00f3 09       		.uleb128 0x9
+ 1422 00f4 03       		.byte	0x3
+ 1423 00f5 00000000 		.quad	discrete_data
+ 1423      00000000 
+ 1424 00fd 02       		.uleb128 0x2
+ 1425 00fe 00000000 		.long	.LASF19
+ 1426 0102 23       		.byte	0x23
+ 1427 0103 24       		.byte	0x24
+ 1428 0104 A1000000 		.long	0xa1
+ 1429 0108 09       		.uleb128 0x9
+GAS LISTING /tmp/ccNTHH7d.s 			page 56
+
+
+ 1430 0109 03       		.byte	0x3
+ 1431 010a 00000000 		.quad	discrete
+ 1431      00000000 
+ 1432 0112 05       		.uleb128 0x5
+ 1433 0113 AB000000 		.long	0xab
+ 1434 0117 24       		.byte	0x24
+ 1435 0118 09       		.uleb128 0x9
+ 1436 0119 03       		.byte	0x3
+ 1437 011a 00000000 		.quad	heatmap_cs_RdGy_discrete
+ 1437      00000000 
+ 1438 0122 09       		.uleb128 0x9
+ 1439 0123 90000000 		.long	0x90
+ 1440 0127 33010000 		.long	0x133
+ 1441 012b 0E       		.uleb128 0xe
+ 1442 012c 31000000 		.long	0x31
+ 1443 0130 0310     		.value	0x1003
+ 1444 0132 00       		.byte	0
+ 1445 0133 03       		.uleb128 0x3
+ 1446 0134 22010000 		.long	0x122
+ 1447 0138 02       		.uleb128 0x2
+ 1448 0139 00000000 		.long	.LASF20
+ 1449 013d 26       		.byte	0x26
+ 1450 013e 1C       		.byte	0x1c
+ 1451 013f 33010000 		.long	0x133
+ 1452 0143 09       		.uleb128 0x9
+ 1453 0144 03       		.byte	0x3
+ 1454 0145 00000000 		.quad	soft_data
+ 1454      00000000 
+ 1455 014d 02       		.uleb128 0x2
+ 1456 014e 00000000 		.long	.LASF21
+ 1457 0152 29       		.byte	0x29
+ 1458 0153 24       		.byte	0x24
+ 1459 0154 A1000000 		.long	0xa1
+ 1460 0158 09       		.uleb128 0x9
+ 1461 0159 03       		.byte	0x3
+ 1462 015a 00000000 		.quad	soft
+ 1462      00000000 
+ 1463 0162 05       		.uleb128 0x5
+ 1464 0163 B5000000 		.long	0xb5
+ 1465 0167 2A       		.byte	0x2a
+ 1466 0168 09       		.uleb128 0x9
+ 1467 0169 03       		.byte	0x3
+ 1468 016a 00000000 		.quad	heatmap_cs_RdGy_soft
+ 1468      00000000 
+ 1469 0172 02       		.uleb128 0x2
+ 1470 0173 00000000 		.long	.LASF22
+ 1471 0177 2C       		.byte	0x2c
+ 1472 0178 1C       		.byte	0x1c
+ 1473 0179 33010000 		.long	0x133
+ 1474 017d 09       		.uleb128 0x9
+ 1475 017e 03       		.byte	0x3
+ 1476 017f 00000000 		.quad	mixed_data
+ 1476      00000000 
+ 1477 0187 02       		.uleb128 0x2
+ 1478 0188 00000000 		.long	.LASF23
+ 1479 018c 2F       		.byte	0x2f
+ 1480 018d 24       		.byte	0x24
+GAS LISTING /tmp/ccNTHH7d.s 			page 57
+
+
+ 1481 018e A1000000 		.long	0xa1
+ 1482 0192 09       		.uleb128 0x9
+ 1483 0193 03       		.byte	0x3
+ 1484 0194 00000000 		.quad	mixed
+ 1484      00000000 
+ 1485 019c 05       		.uleb128 0x5
+ 1486 019d BF000000 		.long	0xbf
+ 1487 01a1 30       		.byte	0x30
+ 1488 01a2 09       		.uleb128 0x9
+ 1489 01a3 03       		.byte	0x3
+ 1490 01a4 00000000 		.quad	heatmap_cs_RdGy_mixed
+ 1490      00000000 
+ 1491 01ac 02       		.uleb128 0x2
+ 1492 01ad 00000000 		.long	.LASF24
+ 1493 01b1 32       		.byte	0x32
+ 1494 01b2 1C       		.byte	0x1c
+ 1495 01b3 33010000 		.long	0x133
+ 1496 01b7 09       		.uleb128 0x9
+ 1497 01b8 03       		.byte	0x3
+ 1498 01b9 00000000 		.quad	mixed_exp_data
+ 1498      00000000 
+ 1499 01c1 02       		.uleb128 0x2
+ 1500 01c2 00000000 		.long	.LASF25
+ 1501 01c6 35       		.byte	0x35
+ 1502 01c7 24       		.byte	0x24
+ 1503 01c8 A1000000 		.long	0xa1
+ 1504 01cc 09       		.uleb128 0x9
+ 1505 01cd 03       		.byte	0x3
+ 1506 01ce 00000000 		.quad	mixed_exp
+ 1506      00000000 
+ 1507 01d6 05       		.uleb128 0x5
+ 1508 01d7 C9000000 		.long	0xc9
+ 1509 01db 36       		.byte	0x36
+ 1510 01dc 09       		.uleb128 0x9
+ 1511 01dd 03       		.byte	0x3
+ 1512 01de 00000000 		.quad	heatmap_cs_RdGy_mixed_exp
+ 1512      00000000 
+ 1513 01e6 00       		.byte	0
+ 1514              		.section	.debug_abbrev,"",@progbits
+ 1515              	.Ldebug_abbrev0:
+ 1516 0000 01       		.uleb128 0x1
+ 1517 0001 24       		.uleb128 0x24
+ 1518 0002 00       		.byte	0
+ 1519 0003 0B       		.uleb128 0xb
+ 1520 0004 0B       		.uleb128 0xb
+ 1521 0005 3E       		.uleb128 0x3e
+ 1522 0006 0B       		.uleb128 0xb
+ 1523 0007 03       		.uleb128 0x3
+ 1524 0008 0E       		.uleb128 0xe
+ 1525 0009 00       		.byte	0
+ 1526 000a 00       		.byte	0
+ 1527 000b 02       		.uleb128 0x2
+ 1528 000c 34       		.uleb128 0x34
+ 1529 000d 00       		.byte	0
+ 1530 000e 03       		.uleb128 0x3
+ 1531 000f 0E       		.uleb128 0xe
+ 1532 0010 3A       		.uleb128 0x3a
+GAS LISTING /tmp/ccNTHH7d.s 			page 58
+
+
+ 1533 0011 21       		.uleb128 0x21
+ 1534 0012 04       		.sleb128 4
+ 1535 0013 3B       		.uleb128 0x3b
+ 1536 0014 0B       		.uleb128 0xb
+ 1537 0015 39       		.uleb128 0x39
+ 1538 0016 0B       		.uleb128 0xb
+ 1539 0017 49       		.uleb128 0x49
+ 1540 0018 13       		.uleb128 0x13
+ 1541 0019 02       		.uleb128 0x2
+ 1542 001a 18       		.uleb128 0x18
+ 1543 001b 00       		.byte	0
+ 1544 001c 00       		.byte	0
+ 1545 001d 03       		.uleb128 0x3
+ 1546 001e 26       		.uleb128 0x26
+ 1547 001f 00       		.byte	0
+ 1548 0020 49       		.uleb128 0x49
+ 1549 0021 13       		.uleb128 0x13
+ 1550 0022 00       		.byte	0
+ 1551 0023 00       		.byte	0
+ 1552 0024 04       		.uleb128 0x4
+ 1553 0025 34       		.uleb128 0x34
+ 1554 0026 00       		.byte	0
+ 1555 0027 03       		.uleb128 0x3
+ 1556 0028 0E       		.uleb128 0xe
+ 1557 0029 3A       		.uleb128 0x3a
+ 1558 002a 21       		.uleb128 0x21
+ 1559 002b 03       		.sleb128 3
+ 1560 002c 3B       		.uleb128 0x3b
+ 1561 002d 0B       		.uleb128 0xb
+ 1562 002e 39       		.uleb128 0x39
+ 1563 002f 21       		.uleb128 0x21
+ 1564 0030 25       		.sleb128 37
+ 1565 0031 49       		.uleb128 0x49
+ 1566 0032 13       		.uleb128 0x13
+ 1567 0033 3F       		.uleb128 0x3f
+ 1568 0034 19       		.uleb128 0x19
+ 1569 0035 3C       		.uleb128 0x3c
+ 1570 0036 19       		.uleb128 0x19
+ 1571 0037 00       		.byte	0
+ 1572 0038 00       		.byte	0
+ 1573 0039 05       		.uleb128 0x5
+ 1574 003a 34       		.uleb128 0x34
+ 1575 003b 00       		.byte	0
+ 1576 003c 47       		.uleb128 0x47
+ 1577 003d 13       		.uleb128 0x13
+ 1578 003e 3A       		.uleb128 0x3a
+ 1579 003f 21       		.uleb128 0x21
+ 1580 0040 04       		.sleb128 4
+ 1581 0041 3B       		.uleb128 0x3b
+ 1582 0042 0B       		.uleb128 0xb
+ 1583 0043 39       		.uleb128 0x39
+ 1584 0044 21       		.uleb128 0x21
+ 1585 0045 1E       		.sleb128 30
+ 1586 0046 02       		.uleb128 0x2
+ 1587 0047 18       		.uleb128 0x18
+ 1588 0048 00       		.byte	0
+ 1589 0049 00       		.byte	0
+GAS LISTING /tmp/ccNTHH7d.s 			page 59
+
+
+ 1590 004a 06       		.uleb128 0x6
+ 1591 004b 16       		.uleb128 0x16
+ 1592 004c 00       		.byte	0
+ 1593 004d 03       		.uleb128 0x3
+ 1594 004e 0E       		.uleb128 0xe
+ 1595 004f 3A       		.uleb128 0x3a
+ 1596 0050 0B       		.uleb128 0xb
+ 1597 0051 3B       		.uleb128 0x3b
+ 1598 0052 0B       		.uleb128 0xb
+ 1599 0053 39       		.uleb128 0x39
+ 1600 0054 0B       		.uleb128 0xb
+ 1601 0055 49       		.uleb128 0x49
+ 1602 0056 13       		.uleb128 0x13
+ 1603 0057 00       		.byte	0
+ 1604 0058 00       		.byte	0
+ 1605 0059 07       		.uleb128 0x7
+ 1606 005a 0D       		.uleb128 0xd
+ 1607 005b 00       		.byte	0
+ 1608 005c 03       		.uleb128 0x3
+ 1609 005d 0E       		.uleb128 0xe
+ 1610 005e 3A       		.uleb128 0x3a
+ 1611 005f 21       		.uleb128 0x21
+ 1612 0060 01       		.sleb128 1
+ 1613 0061 3B       		.uleb128 0x3b
+ 1614 0062 0B       		.uleb128 0xb
+ 1615 0063 39       		.uleb128 0x39
+ 1616 0064 0B       		.uleb128 0xb
+ 1617 0065 49       		.uleb128 0x49
+ 1618 0066 13       		.uleb128 0x13
+ 1619 0067 38       		.uleb128 0x38
+ 1620 0068 0B       		.uleb128 0xb
+ 1621 0069 00       		.byte	0
+ 1622 006a 00       		.byte	0
+ 1623 006b 08       		.uleb128 0x8
+ 1624 006c 0F       		.uleb128 0xf
+ 1625 006d 00       		.byte	0
+ 1626 006e 0B       		.uleb128 0xb
+ 1627 006f 21       		.uleb128 0x21
+ 1628 0070 08       		.sleb128 8
+ 1629 0071 49       		.uleb128 0x49
+ 1630 0072 13       		.uleb128 0x13
+ 1631 0073 00       		.byte	0
+ 1632 0074 00       		.byte	0
+ 1633 0075 09       		.uleb128 0x9
+ 1634 0076 01       		.uleb128 0x1
+ 1635 0077 01       		.byte	0x1
+ 1636 0078 49       		.uleb128 0x49
+ 1637 0079 13       		.uleb128 0x13
+ 1638 007a 01       		.uleb128 0x1
+ 1639 007b 13       		.uleb128 0x13
+ 1640 007c 00       		.byte	0
+ 1641 007d 00       		.byte	0
+ 1642 007e 0A       		.uleb128 0xa
+ 1643 007f 11       		.uleb128 0x11
+ 1644 0080 01       		.byte	0x1
+ 1645 0081 25       		.uleb128 0x25
+ 1646 0082 0E       		.uleb128 0xe
+GAS LISTING /tmp/ccNTHH7d.s 			page 60
+
+
+ 1647 0083 13       		.uleb128 0x13
+ 1648 0084 0B       		.uleb128 0xb
+ 1649 0085 03       		.uleb128 0x3
+ 1650 0086 1F       		.uleb128 0x1f
+ 1651 0087 1B       		.uleb128 0x1b
+ 1652 0088 1F       		.uleb128 0x1f
+ 1653 0089 10       		.uleb128 0x10
+ 1654 008a 17       		.uleb128 0x17
+ 1655 008b 00       		.byte	0
+ 1656 008c 00       		.byte	0
+ 1657 008d 0B       		.uleb128 0xb
+ 1658 008e 24       		.uleb128 0x24
+ 1659 008f 00       		.byte	0
+ 1660 0090 0B       		.uleb128 0xb
+ 1661 0091 0B       		.uleb128 0xb
+ 1662 0092 3E       		.uleb128 0x3e
+ 1663 0093 0B       		.uleb128 0xb
+ 1664 0094 03       		.uleb128 0x3
+ 1665 0095 08       		.uleb128 0x8
+ 1666 0096 00       		.byte	0
+ 1667 0097 00       		.byte	0
+ 1668 0098 0C       		.uleb128 0xc
+ 1669 0099 13       		.uleb128 0x13
+ 1670 009a 01       		.byte	0x1
+ 1671 009b 0B       		.uleb128 0xb
+ 1672 009c 0B       		.uleb128 0xb
+ 1673 009d 3A       		.uleb128 0x3a
+ 1674 009e 0B       		.uleb128 0xb
+ 1675 009f 3B       		.uleb128 0x3b
+ 1676 00a0 0B       		.uleb128 0xb
+ 1677 00a1 39       		.uleb128 0x39
+ 1678 00a2 0B       		.uleb128 0xb
+ 1679 00a3 01       		.uleb128 0x1
+ 1680 00a4 13       		.uleb128 0x13
+ 1681 00a5 00       		.byte	0
+ 1682 00a6 00       		.byte	0
+ 1683 00a7 0D       		.uleb128 0xd
+ 1684 00a8 21       		.uleb128 0x21
+ 1685 00a9 00       		.byte	0
+ 1686 00aa 49       		.uleb128 0x49
+ 1687 00ab 13       		.uleb128 0x13
+ 1688 00ac 2F       		.uleb128 0x2f
+ 1689 00ad 0B       		.uleb128 0xb
+ 1690 00ae 00       		.byte	0
+ 1691 00af 00       		.byte	0
+ 1692 00b0 0E       		.uleb128 0xe
+ 1693 00b1 21       		.uleb128 0x21
+ 1694 00b2 00       		.byte	0
+ 1695 00b3 49       		.uleb128 0x49
+ 1696 00b4 13       		.uleb128 0x13
+ 1697 00b5 2F       		.uleb128 0x2f
+ 1698 00b6 05       		.uleb128 0x5
+ 1699 00b7 00       		.byte	0
+ 1700 00b8 00       		.byte	0
+ 1701 00b9 00       		.byte	0
+ 1702              		.section	.debug_aranges,"",@progbits
+ 1703 0000 1C000000 		.long	0x1c
+GAS LISTING /tmp/ccNTHH7d.s 			page 61
+
+
+ 1704 0004 0200     		.value	0x2
+ 1705 0006 00000000 		.long	.Ldebug_info0
+ 1706 000a 08       		.byte	0x8
+ 1707 000b 00       		.byte	0
+ 1708 000c 0000     		.value	0
+ 1709 000e 0000     		.value	0
+ 1710 0010 00000000 		.quad	0
+ 1710      00000000 
+ 1711 0018 00000000 		.quad	0
+ 1711      00000000 
+ 1712              		.section	.debug_line,"",@progbits
+ 1713              	.Ldebug_line0:
+ 1714 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1714      05000800 
+ 1714      49000000 
+ 1714      010101FB 
+ 1714      0E0D0001 
+ 1715              	.LASF14:
+ 1716 0000 68656174 		.string	"heatmap_cs_RdGy_discrete"
+ 1716      6D61705F 
+ 1716      63735F52 
+ 1716      6447795F 
+ 1716      64697363 
+ 1717              	.LASF17:
+ 1718 0019 68656174 		.string	"heatmap_cs_RdGy_mixed_exp"
+ 1718      6D61705F 
+ 1718      63735F52 
+ 1718      6447795F 
+ 1718      6D697865 
+ 1719              	.LASF15:
+ 1720 0033 68656174 		.string	"heatmap_cs_RdGy_soft"
+ 1720      6D61705F 
+ 1720      63735F52 
+ 1720      6447795F 
+ 1720      736F6674 
+ 1721              	.LASF12:
+ 1722 0048 73697A65 		.string	"size_t"
+ 1722      5F7400
+ 1723              	.LASF13:
+ 1724 004f 68656174 		.string	"heatmap_colorscheme_t"
+ 1724      6D61705F 
+ 1724      636F6C6F 
+ 1724      72736368 
+ 1724      656D655F 
+ 1725              	.LASF26:
+ 1726 0065 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1726      43313720 
+ 1726      31322E32 
+ 1726      2E30202D 
+ 1726      6D74756E 
+ 1727              	.LASF6:
+ 1728 00c4 666C6F61 		.string	"float"
+ 1728      7400
+ 1729              	.LASF11:
+ 1730 00ca 756E7369 		.string	"unsigned char"
+ 1730      676E6564 
+ 1730      20636861 
+GAS LISTING /tmp/ccNTHH7d.s 			page 62
+
+
+ 1730      7200
+ 1731              	.LASF3:
+ 1732 00d8 6C6F6E67 		.string	"long unsigned int"
+ 1732      20756E73 
+ 1732      69676E65 
+ 1732      6420696E 
+ 1732      7400
+ 1733              	.LASF8:
+ 1734 00ea 73686F72 		.string	"short unsigned int"
+ 1734      7420756E 
+ 1734      7369676E 
+ 1734      65642069 
+ 1734      6E7400
+ 1735              	.LASF25:
+ 1736 00fd 6D697865 		.string	"mixed_exp"
+ 1736      645F6578 
+ 1736      7000
+ 1737              	.LASF23:
+ 1738 0107 6D697865 		.string	"mixed"
+ 1738      6400
+ 1739              	.LASF16:
+ 1740 010d 68656174 		.string	"heatmap_cs_RdGy_mixed"
+ 1740      6D61705F 
+ 1740      63735F52 
+ 1740      6447795F 
+ 1740      6D697865 
+ 1741              	.LASF7:
+ 1742 0123 756E7369 		.string	"unsigned int"
+ 1742      676E6564 
+ 1742      20696E74 
+ 1742      00
+ 1743              	.LASF19:
+ 1744 0130 64697363 		.string	"discrete"
+ 1744      72657465 
+ 1744      00
+ 1745              	.LASF20:
+ 1746 0139 736F6674 		.string	"soft_data"
+ 1746      5F646174 
+ 1746      6100
+ 1747              	.LASF10:
+ 1748 0143 6E636F6C 		.string	"ncolors"
+ 1748      6F727300 
+ 1749              	.LASF4:
+ 1750 014b 6C6F6E67 		.string	"long long int"
+ 1750      206C6F6E 
+ 1750      6720696E 
+ 1750      7400
+ 1751              	.LASF24:
+ 1752 0159 6D697865 		.string	"mixed_exp_data"
+ 1752      645F6578 
+ 1752      705F6461 
+ 1752      746100
+ 1753              	.LASF22:
+ 1754 0168 6D697865 		.string	"mixed_data"
+ 1754      645F6461 
+ 1754      746100
+ 1755              	.LASF2:
+GAS LISTING /tmp/ccNTHH7d.s 			page 63
+
+
+ 1756 0173 6C6F6E67 		.string	"long int"
+ 1756      20696E74 
+ 1756      00
+ 1757              	.LASF5:
+ 1758 017c 6C6F6E67 		.string	"long double"
+ 1758      20646F75 
+ 1758      626C6500 
+ 1759              	.LASF18:
+ 1760 0188 64697363 		.string	"discrete_data"
+ 1760      72657465 
+ 1760      5F646174 
+ 1760      6100
+ 1761              	.LASF21:
+ 1762 0196 736F6674 		.string	"soft"
+ 1762      00
+ 1763              	.LASF9:
+ 1764 019b 636F6C6F 		.string	"colors"
+ 1764      727300
+ 1765              		.section	.debug_line_str,"MS",@progbits,1
+ 1766              	.LASF1:
+ 1767 0000 2F726F6F 		.string	"/root/repo"
+ 1767      742F7265 
+ 1767      706F00
+ 1768              	.LASF0:
+ 1769 000b 636F6C6F 		.string	"colorschemes/RdGy.c"
+ 1769      72736368 
+ 1769      656D6573 
+ 1769      2F526447 
+ 1769      792E6300 
+ 1770              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1771 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1771      742F7265 
+ 1771      706F0063 
+ 1771      6F6C6F72 
+ 1771      73636865 
@@ -0,0 +1,4160 @@
+GAS LISTING /tmp/ccTtNBwq.s 			page 1
+
+
+   1              		.file	"RdPu.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/RdPu.c"
+   5              		.globl	heatmap_cs_RdPu_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_RdPu_mixed_exp, @object
+   9              		.size	heatmap_cs_RdPu_mixed_exp, 8
+  10              	heatmap_cs_RdPu_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 4800     		.string	"H"
+  29 0006 6A00     		.string	"j"
+  30 0008 4C00     		.string	"L"
+  31 000a 6A184F00 		.string	"j\030O"
+  32 000e 6B315200 		.string	"k1R"
+  33 0012 6C4A5500 		.string	"lJU"
+  34 0016 6D635800 		.string	"mcX"
+  35 001a 6E7C5B00 		.string	"n|["
+  36 001e 6F956700 		.string	"o\225g"
+  37 0022 72AE6A00 		.string	"r\256j"
+  38 0026 73C76D00 		.string	"s\307m"
+  39 002a 73E07000 		.string	"s\340p"
+  40 002e 74F97300 		.string	"t\371s"
+  41 0032 75FF7500 		.string	"u\377u"
+  42 0036 76FF7800 		.string	"v\377x"
+  43 003a 76FF7B00 		.string	"v\377{"
+  44 003e 77FF7E00 		.string	"w\377~"
+  45 0042 77FF8100 		.string	"w\377\201"
+  46 0046 78FF8300 		.string	"x\377\203"
+  47 004a 78FF8600 		.string	"x\377\206"
+  48 004e 79FF8900 		.string	"y\377\211"
+  49 0052 79FF8C00 		.string	"y\377\214"
+  50 0056 7AFF8E00 		.string	"z\377\216"
+  51 005a 7AFF9C00 		.string	"z\377\234"
+  52 005e 7CFF9E00 		.string	"|\377\236"
+  53 0062 7CFFA100 		.string	"|\377\241"
+  54 0066 7CFFA300 		.string	"|\377\243"
+GAS LISTING /tmp/ccTtNBwq.s 			page 2
+
+
+  55 006a 7DFFA600 		.string	"}\377\246"
+  56 006e 7DFFA800 		.string	"}\377\250"
+  57 0072 7DFFAB00 		.string	"}\377\253"
+  58 0076 7DFFAD00 		.string	"}\377\255"
+  59 007a 7DFFB004 		.ascii	"}\377\260\004\177\377\262\b\200\377\264\013\201\377\266\016\202"
+  59      7FFFB208 
+  59      80FFB40B 
+  59      81FFB60E 
+  59      82
+  60 008b FFB81183 		.ascii	"\377\270\021\203\377\273\023\205\377\275\026\206\377\277\030"
+  60      FFBB1385 
+  60      FFBD1686 
+  60      FFBF18
+  61 009a 87FFCA24 		.ascii	"\207\377\312$\215\377\314&\216\377\316(\217\377\320*\220\377"
+  61      8DFFCC26 
+  61      8EFFCE28 
+  61      8FFFD02A 
+  61      90FF
+  62 00ac D32B91FF 		.ascii	"\323+\221\377\325-\222\377\327/\223\377\3310\224\377\3332\225"
+  62      D52D92FF 
+  62      D72F93FF 
+  62      D93094FF 
+  62      DB3295
+  63 00bf FFDC3396 		.ascii	"\377\3343\226\377\3366\227\377\3378\227\377\340;\227\377\341"
+  63      FFDE3697 
+  63      FFDF3897 
+  63      FFE03B97 
+  63      FFE1
+  64 00d1 3D98FFE2 		.ascii	"=\230\377\342?\230\377\343A\230\377\344C\231\377\345E\231\377"
+  64      3F98FFE3 
+  64      4198FFE4 
+  64      4399FFE5 
+  64      4599FF
+  65 00e4 E64799FF 		.ascii	"\346G\231\377\347I\232\377\355U\234\377\356W\235\377\357Y\235"
+  65      E7499AFF 
+  65      ED559CFF 
+  65      EE579DFF 
+  65      EF599D
+  66 00f7 FFF05B9D 		.ascii	"\377\360[\235\377\361]\236\377\362^\236\377\363`\237\377\364"
+  66      FFF15D9E 
+  66      FFF25E9E 
+  66      FFF3609F 
+  66      FFF4
+  67 0109 629FFFF4 		.ascii	"b\237\377\364c\237\377\365e\240\377\366g\240\377\371h\227\377"
+  67      639FFFF5 
+  67      65A0FFF6 
+  67      67A0FFF9 
+  67      6897FF
+  68 011c F96A98FF 		.ascii	"\371j\230\377\371l\232\377\371n\233\377\371p\235\377\371r\236"
+  68      F96C9AFF 
+  68      F96E9BFF 
+  68      F9709DFF 
+  68      F9729E
+  69 012f FFF9749F 		.ascii	"\377\371t\237\377\371u\241\377\371w\242\377\371y\243\377\371"
+  69      FFF975A1 
+  69      FFF977A2 
+  69      FFF979A3 
+GAS LISTING /tmp/ccTtNBwq.s 			page 3
+
+
+  69      FFF9
+  70 0141 7BA5FFF9 		.ascii	"{\245\377\371|\246\377\371~\247\377\371\213\254\377\371\214\256"
+  70      7CA6FFF9 
+  70      7EA7FFF9 
+  70      8BACFFF9 
+  70      8CAE
+  71 0153 FFF98EAF 		.ascii	"\377\371\216\257\377\371\217\260\377\371\221\261\377\371\222"
+  71      FFF98FB0 
+  71      FFF991B1 
+  71      FFF992
+  72 0162 B2FFF894 		.ascii	"\262\377\370\224\263\377\370\225\264\377\370\227\265\377\370"
+  72      B3FFF895 
+  72      B4FFF897 
+  72      B5FFF8
+  73 0171 98B6FFF8 		.ascii	"\230\266\377\370\232\270\377\370\233\271\377\370\235\272\377"
+  73      9AB8FFF8 
+  73      9BB9FFF8 
+  73      9DBAFF
+  74 0180 F89EBBFF 		.ascii	"\370\236\273\377\372\237\264\377\372\240\264\377\372\241\264"
+  74      FA9FB4FF 
+  74      FAA0B4FF 
+  74      FAA1B4
+  75 018f FFFAA2B5 		.ascii	"\377\372\242\265\377\372\243\265\377\373\244\265\377\373\244"
+  75      FFFAA3B5 
+  75      FFFBA4B5 
+  75      FFFBA4
+  76 019e B5FFFBA5 		.ascii	"\265\377\373\245\265\377\373\246\265\377\373\247\265\377\373"
+  76      B5FFFBA6 
+  76      B5FFFBA7 
+  76      B5FFFB
+  77 01ad A8B5FFFB 		.ascii	"\250\265\377\373\251\265\377\373\252\266\377\373\253\266\377"
+  77      A9B5FFFB 
+  77      AAB6FFFB 
+  77      ABB6FF
+  78 01bc FBACB6FF 		.ascii	"\373\254\266\377\373\254\266\377\373\255\266\377\374\266\271"
+  78      FBACB6FF 
+  78      FBADB6FF 
+  78      FCB6B9
+  79 01cb FFFCB7B9 		.ascii	"\377\374\267\271\377\374\267\271\377\374\270\272\377\374\271"
+  79      FFFCB7B9 
+  79      FFFCB8BA 
+  79      FFFCB9
+  80 01da BAFFFCBA 		.ascii	"\272\377\374\272\272\377\374\273\272\377\374\273\273\377\374"
+  80      BAFFFCBB 
+  80      BAFFFCBB 
+  80      BBFFFC
+  81 01e9 BCBBFFFC 		.ascii	"\274\273\377\374\275\273\377\374\276\274\377\374\276\274\377"
+  81      BDBBFFFC 
+  81      BEBCFFFC 
+  81      BEBCFF
+  82 01f8 FCBFBDFF 		.ascii	"\374\277\275\377\374\300\275\377\374\301\275\377\374\301\276"
+  82      FCC0BDFF 
+  82      FCC1BDFF 
+  82      FCC1BE
+  83 0207 FFFCC2BE 		.ascii	"\377\374\302\276\377\374\303\276\377\374\303\277\377\374\304"
+  83      FFFCC3BE 
+  83      FFFCC3BF 
+GAS LISTING /tmp/ccTtNBwq.s 			page 4
+
+
+  83      FFFCC4
+  84 0216 BFFFFCC5 		.ascii	"\277\377\374\305\300\377\374\305\300\377\374\306\301\377\374"
+  84      C0FFFCC5 
+  84      C0FFFCC6 
+  84      C1FFFC
+  85 0225 C6C1FFFC 		.ascii	"\306\301\377\374\307\302\377\374\307\302\377\374\310\303\377"
+  85      C7C2FFFC 
+  85      C7C2FFFC 
+  85      C8C3FF
+  86 0234 FCC8C3FF 		.ascii	"\374\310\303\377\374\310\304\377\374\311\304\377\374\311\305"
+  86      FCC8C4FF 
+  86      FCC9C4FF 
+  86      FCC9C5
+  87 0243 FFFCCAC5 		.ascii	"\377\374\312\305\377\374\312\306\377\374\313\306\377\374\313"
+  87      FFFCCAC6 
+  87      FFFCCBC6 
+  87      FFFCCB
+  88 0252 C6FFFCCB 		.ascii	"\306\377\374\313\307\377\374\314\307\377\374\314\310\377\374"
+  88      C7FFFCCC 
+  88      C7FFFCCC 
+  88      C8FFFC
+  89 0261 CDC8FFFC 		.ascii	"\315\310\377\374\315\311\377\374\315\311\377\374\316\311\377"
+  89      CDC9FFFC 
+  89      CDC9FFFC 
+  89      CEC9FF
+  90 0270 FCCECAFF 		.ascii	"\374\316\312\377\374\317\312\377\374\317\313\377\374\325\321"
+  90      FCCFCAFF 
+  90      FCCFCBFF 
+  90      FCD5D1
+  91 027f FFFCD5D1 		.ascii	"\377\374\325\321\377\374\326\322\377\374\326\322\377\374\326"
+  91      FFFCD6D2 
+  91      FFFCD6D2 
+  91      FFFCD6
+  92 028e D2FFFCD7 		.ascii	"\322\377\374\327\323\377\374\327\323\377\374\327\324\377\374"
+  92      D3FFFCD7 
+  92      D3FFFCD7 
+  92      D4FFFC
+  93 029d D8D4FFFC 		.ascii	"\330\324\377\374\330\324\377\374\330\325\377\374\331\325\377"
+  93      D8D4FFFC 
+  93      D8D5FFFC 
+  93      D9D5FF
+  94 02ac FCD9D5FF 		.ascii	"\374\331\325\377\374\331\326\377\374\332\326\377\374\332\326"
+  94      FCD9D6FF 
+  94      FCDAD6FF 
+  94      FCDAD6
+  95 02bb FFFCDAD7 		.ascii	"\377\374\332\327\377\374\333\327\377\374\333\327\377\374\333"
+  95      FFFCDBD7 
+  95      FFFCDBD7 
+  95      FFFCDB
+  96 02ca D8FFFCDC 		.ascii	"\330\377\374\334\330\377\374\334\330\377\374\334\331\377\375"
+  96      D8FFFCDC 
+  96      D8FFFCDC 
+  96      D9FFFD
+  97 02d9 DCD9FFFD 		.ascii	"\334\331\377\375\335\331\377\375\335\332\377\375\335\332\377"
+  97      DDD9FFFD 
+  97      DDDAFFFD 
+  97      DDDAFF
+GAS LISTING /tmp/ccTtNBwq.s 			page 5
+
+
+  98 02e8 FDDEDAFF 		.ascii	"\375\336\332\377\375\336\333\377\375\336\333\377\375\336\333"
+  98      FDDEDBFF 
+  98      FDDEDBFF 
+  98      FDDEDB
+  99 02f7 FFFDDFDC 		.ascii	"\377\375\337\334\377\375\337\334\377\375\337\334\377\375\337"
+  99      FFFDDFDC 
+  99      FFFDDFDC 
+  99      FFFDDF
+ 100 0306 DCFFFDE0 		.ascii	"\334\377\375\340\335\377\375\340\335\377\375\340\335\377\375"
+ 100      DDFFFDE0 
+ 100      DDFFFDE0 
+ 100      DDFFFD
+ 101 0315 E0DDFFFD 		.ascii	"\340\335\377\375\341\335\377\375\341\335\377\375\341\336\377"
+ 101      E1DDFFFD 
+ 101      E1DDFFFD 
+ 101      E1DEFF
+ 102 0324 FDE1DEFF 		.ascii	"\375\341\336\377\375\341\336\377\375\342\336\377\375\342\336"
+ 102      FDE1DEFF 
+ 102      FDE2DEFF 
+ 102      FDE2DE
+ 103 0333 FFFDE2DE 		.ascii	"\377\375\342\336\377\375\342\336\377\375\342\337\377\375\343"
+ 103      FFFDE2DE 
+ 103      FFFDE2DF 
+ 103      FFFDE3
+ 104 0342 DFFFFDE3 		.ascii	"\337\377\375\343\337\377\375\343\337\377\375\343\337\377\375"
+ 104      DFFFFDE3 
+ 104      DFFFFDE3 
+ 104      DFFFFD
+ 105 0351 E3DFFFFD 		.ascii	"\343\337\377\375\344\337\377\375\344\340\377\375\344\340\377"
+ 105      E4DFFFFD 
+ 105      E4E0FFFD 
+ 105      E4E0FF
+ 106 0360 FDE4E0FF 		.ascii	"\375\344\340\377\375\344\340\377\375\344\340\377\375\345\340"
+ 106      FDE4E0FF 
+ 106      FDE4E0FF 
+ 106      FDE5E0
+ 107 036f FFFDE5E0 		.ascii	"\377\375\345\340\377\375\345\341\377\375\345\341\377\375\345"
+ 107      FFFDE5E1 
+ 107      FFFDE5E1 
+ 107      FFFDE5
+ 108 037e E1FFFDE5 		.ascii	"\341\377\375\345\341\377\375\346\341\377\375\346\341\377\375"
+ 108      E1FFFDE6 
+ 108      E1FFFDE6 
+ 108      E1FFFD
+ 109 038d E6E1FFFD 		.ascii	"\346\341\377\375\346\341\377\375\346\342\377\375\346\342\377"
+ 109      E6E1FFFD 
+ 109      E6E2FFFD 
+ 109      E6E2FF
+ 110 039c FDE6E2FF 		.ascii	"\375\346\342\377\375\347\342\377\375\347\342\377\375\347\342"
+ 110      FDE7E2FF 
+ 110      FDE7E2FF 
+ 110      FDE7E2
+ 111 03ab FFFDE7E2 		.ascii	"\377\375\347\342\377\375\347\343\377\375\347\343\377\375\347"
+ 111      FFFDE7E3 
+ 111      FFFDE7E3 
+ 111      FFFDE7
+ 112 03ba E3FFFDE8 		.ascii	"\343\377\375\350\343\377\375\350\343\377\375\350\343\377\375"
+GAS LISTING /tmp/ccTtNBwq.s 			page 6
+
+
+ 112      E3FFFDE8 
+ 112      E3FFFDE8 
+ 112      E3FFFD
+ 113 03c9 E8E3FFFD 		.ascii	"\350\343\377\375\350\343\377\375\350\344\377\375\350\344\377"
+ 113      E8E3FFFD 
+ 113      E8E4FFFD 
+ 113      E8E4FF
+ 114 03d8 FDE9E4FF 		.ascii	"\375\351\344\377\375\351\344\377\375\351\344\377\376\355\350"
+ 114      FDE9E4FF 
+ 114      FDE9E4FF 
+ 114      FEEDE8
+ 115 03e7 FFFEEEE9 		.ascii	"\377\376\356\351\377\376\356\351\377\376\356\351\377\376\356"
+ 115      FFFEEEE9 
+ 115      FFFEEEE9 
+ 115      FFFEEE
+ 116 03f6 E9FFFEEE 		.ascii	"\351\377\376\356\351\377\376\356\351\377\376\356\351\377\376"
+ 116      E9FFFEEE 
+ 116      E9FFFEEE 
+ 116      E9FFFE
+ 117 0405 EEE9FFFE 		.ascii	"\356\351\377\376\356\351\377\376\357\352\377\376\357\352\377"
+ 117      EEE9FFFE 
+ 117      EFEAFFFE 
+ 117      EFEAFF
+ 118 0414 FEEFEAFF 		.ascii	"\376\357\352\377\376\357\352\377\376\357\352\377\376\357\352"
+ 118      FEEFEAFF 
+ 118      FEEFEAFF 
+ 118      FEEFEA
+ 119 0423 FFFEEFEA 		.ascii	"\377\376\357\352\377\376\357\352\377\376\357\352\377\376\357"
+ 119      FFFEEFEA 
+ 119      FFFEEFEA 
+ 119      FFFEEF
+ 120 0432 EAFFFEF0 		.ascii	"\352\377\376\360\353\377\376\360\353\377\376\360\353\377\376"
+ 120      EBFFFEF0 
+ 120      EBFFFEF0 
+ 120      EBFFFE
+ 121 0441 F0EBFFFE 		.ascii	"\360\353\377\376\360\353\377\376\360\353\377\376\360\353\377"
+ 121      F0EBFFFE 
+ 121      F0EBFFFE 
+ 121      F0EBFF
+ 122 0450 FEF0EBFF 		.ascii	"\376\360\353\377\376\360\353\377\376\360\353\377\376\360\354"
+ 122      FEF0EBFF 
+ 122      FEF0EBFF 
+ 122      FEF0EC
+ 123 045f FFFEF1EC 		.ascii	"\377\376\361\354\377\376\361\354\377\376\361\354\377\376\361"
+ 123      FFFEF1EC 
+ 123      FFFEF1EC 
+ 123      FFFEF1
+ 124 046e ECFFFEF1 		.ascii	"\354\377\376\361\354\377\376\361\354\377\376\361\354\377\376"
+ 124      ECFFFEF1 
+ 124      ECFFFEF1 
+ 124      ECFFFE
+ 125 047d F1ECFFFE 		.ascii	"\361\354\377\376\361\354\377\376\361\354\377\376\361\354\377"
+ 125      F1ECFFFE 
+ 125      F1ECFFFE 
+ 125      F1ECFF
+ 126 048c FEF1ECFF 		.ascii	"\376\361\354\377\376\361\355\377\376\362\355\377\376\362\355"
+ 126      FEF1EDFF 
+GAS LISTING /tmp/ccTtNBwq.s 			page 7
+
+
+ 126      FEF2EDFF 
+ 126      FEF2ED
+ 127 049b FFFEF2ED 		.ascii	"\377\376\362\355\377\376\362\355\377\376\362\355\377\376\362"
+ 127      FFFEF2ED 
+ 127      FFFEF2ED 
+ 127      FFFEF2
+ 128 04aa EDFFFEF2 		.ascii	"\355\377\376\362\355\377\376\362\355\377\376\362\355\377\376"
+ 128      EDFFFEF2 
+ 128      EDFFFEF2 
+ 128      EDFFFE
+ 129 04b9 F2EDFFFE 		.ascii	"\362\355\377\376\362\355\377\376\362\355\377\376\362\355\377"
+ 129      F2EDFFFE 
+ 129      F2EDFFFE 
+ 129      F2EDFF
+ 130 04c8 FEF2EEFF 		.ascii	"\376\362\356\377\376\362\356\377\376\362\356\377\376\363\356"
+ 130      FEF2EEFF 
+ 130      FEF2EEFF 
+ 130      FEF3EE
+ 131 04d7 FFFEF3EE 		.ascii	"\377\376\363\356\377\376\363\356\377\376\363\356\377\376\363"
+ 131      FFFEF3EE 
+ 131      FFFEF3EE 
+ 131      FFFEF3
+ 132 04e6 EEFFFEF3 		.ascii	"\356\377\376\363\356\377\376\363\356\377\376\363\356\377\376"
+ 132      EEFFFEF3 
+ 132      EEFFFEF3 
+ 132      EEFFFE
+ 133 04f5 F3EEFFFE 		.ascii	"\363\356\377\376\363\356\377\376\363\356\377\376\363\356\377"
+ 133      F3EEFFFE 
+ 133      F3EEFFFE 
+ 133      F3EEFF
+ 134 0504 FEF3EEFF 		.ascii	"\376\363\356\377\376\363\357\377\376\363\357\377\376\363\357"
+ 134      FEF3EFFF 
+ 134      FEF3EFFF 
+ 134      FEF3EF
+ 135 0513 FFFEF3EF 		.ascii	"\377\376\363\357\377\376\363\357\377\376\363\357\377\376\363"
+ 135      FFFEF3EF 
+ 135      FFFEF3EF 
+ 135      FFFEF3
+ 136 0522 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 136      EFFFFEF4 
+ 136      EFFFFEF4 
+ 136      EFFFFE
+ 137 0531 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 137      F4EFFFFE 
+ 137      F4EFFFFE 
+ 137      F4EFFF
+ 138 0540 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 138      FEF4EFFF 
+ 138      FEF4EFFF 
+ 138      FEF4EF
+ 139 054f FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 139      FFFEF4EF 
+ 139      FFFEF4EF 
+ 139      FFFEF4
+ 140 055e F0FFFEF4 		.ascii	"\360\377\376\364\360\377\376\364\360\377\376\364\360\377\376"
+ 140      F0FFFEF4 
+ 140      F0FFFEF4 
+GAS LISTING /tmp/ccTtNBwq.s 			page 8
+
+
+ 140      F0FFFE
+ 141 056d F4F0FFFE 		.ascii	"\364\360\377\376\364\360\377\376\364\360\377\376\364\360\377"
+ 141      F4F0FFFE 
+ 141      F4F0FFFE 
+ 141      F4F0FF
+ 142 057c FEF4F0FF 		.ascii	"\376\364\360\377\376\364\360\377\376\364\360\377\376\364\360"
+ 142      FEF4F0FF 
+ 142      FEF4F0FF 
+ 142      FEF4F0
+ 143 058b FFFEF4F0 		.ascii	"\377\376\364\360\377\376\364\360\377\376\365\360\377\376\365"
+ 143      FFFEF4F0 
+ 143      FFFEF5F0 
+ 143      FFFEF5
+ 144 059a F0FFFEF5 		.ascii	"\360\377\376\365\360\377\376\365\360\377\376\365\360\377\376"
+ 144      F0FFFEF5 
+ 144      F0FFFEF5 
+ 144      F0FFFE
+ 145 05a9 F5F0FFFE 		.ascii	"\365\360\377\376\365\360\377\376\365\360\377\376\365\360\377"
+ 145      F5F0FFFE 
+ 145      F5F0FFFE 
+ 145      F5F0FF
+ 146 05b8 FEF5F0FF 		.ascii	"\376\365\360\377\376\365\360\377\376\365\360\377\376\365\360"
+ 146      FEF5F0FF 
+ 146      FEF5F0FF 
+ 146      FEF5F0
+ 147 05c7 FFFEF5F1 		.ascii	"\377\376\365\361\377\376\365\361\377\376\365\361\377\376\365"
+ 147      FFFEF5F1 
+ 147      FFFEF5F1 
+ 147      FFFEF5
+ 148 05d6 F1FFFEF5 		.ascii	"\361\377\376\365\361\377\376\365\361\377\376\365\361\377\376"
+ 148      F1FFFEF5 
+ 148      F1FFFEF5 
+ 148      F1FFFE
+ 149 05e5 F5F1FFFE 		.ascii	"\365\361\377\376\365\361\377\376\365\361\377\376\365\361\377"
+ 149      F5F1FFFE 
+ 149      F5F1FFFE 
+ 149      F5F1FF
+ 150 05f4 FEF5F1FF 		.ascii	"\376\365\361\377\376\365\361\377\376\365\361\377\376\365\361"
+ 150      FEF5F1FF 
+ 150      FEF5F1FF 
+ 150      FEF5F1
+ 151 0603 FFFEF5F1 		.ascii	"\377\376\365\361\377\376\365\361\377\376\365\361\377\376\365"
+ 151      FFFEF5F1 
+ 151      FFFEF5F1 
+ 151      FFFEF5
+ 152 0612 F1FFFEF5 		.ascii	"\361\377\376\365\361\377\376\365\361\377\376\365\361\377\376"
+ 152      F1FFFEF5 
+ 152      F1FFFEF5 
+ 152      F1FFFE
+ 153 0621 F5F1FFFE 		.ascii	"\365\361\377\376\365\361\377\376\365\361\377\376\365\361\377"
+ 153      F5F1FFFE 
+ 153      F5F1FFFE 
+ 153      F5F1FF
+ 154 0630 FEF5F1FF 		.ascii	"\376\365\361\377\376\365\361\377\376\365\361\377\376\365\361"
+ 154      FEF5F1FF 
+ 154      FEF5F1FF 
+ 154      FEF5F1
+GAS LISTING /tmp/ccTtNBwq.s 			page 9
+
+
+ 155 063f FFFEF5F1 		.ascii	"\377\376\365\361\377\376\366\361\377\376\366\361\377\376\366"
+ 155      FFFEF6F1 
+ 155      FFFEF6F1 
+ 155      FFFEF6
+ 156 064e F1FFFEF6 		.ascii	"\361\377\376\366\361\377\376\366\361\377\376\366\361\377\376"
+ 156      F1FFFEF6 
+ 156      F1FFFEF6 
+ 156      F1FFFE
+ 157 065d F6F1FFFE 		.ascii	"\366\361\377\376\366\361\377\376\366\361\377\376\366\361\377"
+ 157      F6F1FFFE 
+ 157      F6F1FFFE 
+ 157      F6F1FF
+ 158 066c FEF6F1FF 		.ascii	"\376\366\361\377\376\366\361\377\376\366\361\377\376\366\361"
+ 158      FEF6F1FF 
+ 158      FEF6F1FF 
+ 158      FEF6F1
+ 159 067b FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 159      FFFEF6F2 
+ 159      FFFEF6F2 
+ 159      FFFEF6
+ 160 068a F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 160      F2FFFEF6 
+ 160      F2FFFEF6 
+ 160      F2FFFE
+ 161 0699 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 161      F6F2FFFE 
+ 161      F6F2FFFE 
+ 161      F6F2FF
+ 162 06a8 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 162      FEF6F2FF 
+ 162      FEF6F2FF 
+ 162      FEF6F2
+ 163 06b7 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 163      FFFEF6F2 
+ 163      FFFEF6F2 
+ 163      FFFEF6
+ 164 06c6 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 164      F2FFFEF6 
+ 164      F2FFFEF6 
+ 164      F2FFFE
+ 165 06d5 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 165      F6F2FFFE 
+ 165      F6F2FFFE 
+ 165      F6F2FF
+ 166 06e4 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 166      FEF6F2FF 
+ 166      FEF6F2FF 
+ 166      FEF6F2
+ 167 06f3 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 167      FFFEF6F2 
+ 167      FFFEF6F2 
+ 167      FFFEF6
+ 168 0702 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 168      F2FFFEF6 
+ 168      F2FFFEF6 
+ 168      F2FFFE
+ 169 0711 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+GAS LISTING /tmp/ccTtNBwq.s 			page 10
+
+
+ 169      F6F2FFFE 
+ 169      F6F2FFFE 
+ 169      F6F2FF
+ 170 0720 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 170      FEF6F2FF 
+ 170      FEF6F2FF 
+ 170      FEF6F2
+ 171 072f FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 171      FFFEF6F2 
+ 171      FFFEF6F2 
+ 171      FFFEF6
+ 172 073e F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 172      F2FFFEF6 
+ 172      F2FFFEF6 
+ 172      F2FFFE
+ 173 074d F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 173      F6F2FFFE 
+ 173      F6F2FFFE 
+ 173      F6F2FF
+ 174 075c FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 174      FEF6F2FF 
+ 174      FEF6F2FF 
+ 174      FEF6F2
+ 175 076b FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 175      FFFEF6F2 
+ 175      FFFEF6F2 
+ 175      FFFEF6
+ 176 077a F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 176      F2FFFEF6 
+ 176      F2FFFEF6 
+ 176      F2FFFE
+ 177 0789 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 177      F6F2FFFE 
+ 177      F6F2FFFE 
+ 177      F6F2FF
+ 178 0798 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 178      FEF6F2FF 
+ 178      FEF6F2FF 
+ 178      FEF6F2
+ 179 07a7 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 179      FFFEF6F2 
+ 179      FFFEF6F2 
+ 179      FFFEF6
+ 180 07b6 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 180      F2FFFEF6 
+ 180      F2FFFEF6 
+ 180      F2FFFE
+ 181 07c5 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377"
+ 181      F6F2FFFE 
+ 181      F6F2FF
+ 182 07d0 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 182      FEF6F2FF 
+ 182      FEF6F2FF 
+ 182      FEF6F2
+ 183 07df FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 183      FFFEF6F2 
+ 183      FFFEF6F2 
+GAS LISTING /tmp/ccTtNBwq.s 			page 11
+
+
+ 183      FFFEF6
+ 184 07ee F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 184      F2FFFEF6 
+ 184      F2FFFEF6 
+ 184      F2FFFE
+ 185 07fd F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 185      F6F2FFFE 
+ 185      F6F2FFFE 
+ 185      F6F2FF
+ 186 080c FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 186      FEF6F2FF 
+ 186      FEF6F2FF 
+ 186      FEF6F2
+ 187 081b FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 187      FFFEF6F2 
+ 187      FFFEF6F2 
+ 187      FFFEF6
+ 188 082a F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 188      F2FFFEF6 
+ 188      F2FFFEF6 
+ 188      F2FFFE
+ 189 0839 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 189      F6F2FFFE 
+ 189      F6F2FFFE 
+ 189      F6F2FF
+ 190 0848 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 190      FEF6F2FF 
+ 190      FEF6F2FF 
+ 190      FEF6F2
+ 191 0857 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 191      FFFEF6F2 
+ 191      FFFEF6F2 
+ 191      FFFEF6
+ 192 0866 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 192      F2FFFEF6 
+ 192      F2FFFEF6 
+ 192      F2FFFE
+ 193 0875 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 193      F6F2FFFE 
+ 193      F6F2FFFE 
+ 193      F6F2FF
+ 194 0884 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 194      FEF6F2FF 
+ 194      FEF6F2FF 
+ 194      FEF6F2
+ 195 0893 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 195      FFFEF6F2 
+ 195      FFFEF6F2 
+ 195      FFFEF6
+ 196 08a2 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 196      F2FFFEF6 
+ 196      F2FFFEF6 
+ 196      F2FFFE
+ 197 08b1 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 197      F6F2FFFE 
+ 197      F6F2FFFE 
+ 197      F6F2FF
+GAS LISTING /tmp/ccTtNBwq.s 			page 12
+
+
+ 198 08c0 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 198      FEF6F2FF 
+ 198      FEF6F2FF 
+ 198      FEF6F2
+ 199 08cf FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 199      FFFEF6F2 
+ 199      FFFEF6F2 
+ 199      FFFEF6
+ 200 08de F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 200      F2FFFEF6 
+ 200      F2FFFEF6 
+ 200      F2FFFE
+ 201 08ed F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 201      F6F2FFFE 
+ 201      F6F2FFFE 
+ 201      F6F2FF
+ 202 08fc FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 202      FEF6F2FF 
+ 202      FEF6F2FF 
+ 202      FEF6F2
+ 203 090b FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 203      FFFEF6F2 
+ 203      FFFEF6F2 
+ 203      FFFEF6
+ 204 091a F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 204      F2FFFEF6 
+ 204      F2FFFEF6 
+ 204      F2FFFE
+ 205 0929 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 205      F6F2FFFE 
+ 205      F6F2FFFE 
+ 205      F6F2FF
+ 206 0938 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 206      FEF6F2FF 
+ 206      FEF6F2FF 
+ 206      FEF6F2
+ 207 0947 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 207      FFFEF6F2 
+ 207      FFFEF6F2 
+ 207      FFFEF6
+ 208 0956 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 208      F2FFFEF6 
+ 208      F2FFFEF6 
+ 208      F2FFFE
+ 209 0965 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 209      F6F2FFFE 
+ 209      F6F2FFFE 
+ 209      F6F2FF
+ 210 0974 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 210      FEF6F2FF 
+ 210      FEF6F2FF 
+ 210      FEF6F2
+ 211 0983 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 211      FFFEF6F2 
+ 211      FFFEF6F2 
+ 211      FFFEF6
+ 212 0992 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+GAS LISTING /tmp/ccTtNBwq.s 			page 13
+
+
+ 212      F2FFFEF6 
+ 212      F2FFFEF6 
+ 212      F2FFFE
+ 213 09a1 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 213      F6F2FFFE 
+ 213      F6F2FFFE 
+ 213      F6F2FF
+ 214 09b0 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 214      FEF6F2FF 
+ 214      FEF6F2FF 
+ 214      FEF6F2
+ 215 09bf FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 215      FFFEF6F2 
+ 215      FFFEF6F2 
+ 215      FFFEF6
+ 216 09ce F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 216      F2FFFEF6 
+ 216      F2FFFEF6 
+ 216      F2FFFE
+ 217 09dd F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 217      F6F2FFFE 
+ 217      F6F2FFFE 
+ 217      F6F2FF
+ 218 09ec FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 218      FEF6F2FF 
+ 218      FEF6F2FF 
+ 218      FEF6F2
+ 219 09fb FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 219      FFFEF6F2 
+ 219      FFFEF6F2 
+ 219      FFFEF6
+ 220 0a0a F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 220      F2FFFEF6 
+ 220      F2FFFEF6 
+ 220      F2FFFE
+ 221 0a19 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 221      F6F2FFFE 
+ 221      F6F2FFFE 
+ 221      F6F2FF
+ 222 0a28 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 222      FEF6F2FF 
+ 222      FEF6F2FF 
+ 222      FEF6F2
+ 223 0a37 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 223      FFFEF6F2 
+ 223      FFFEF6F2 
+ 223      FFFEF6
+ 224 0a46 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 224      F2FFFEF6 
+ 224      F2FFFEF6 
+ 224      F2FFFE
+ 225 0a55 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 225      F6F2FFFE 
+ 225      F6F2FFFE 
+ 225      F6F2FF
+ 226 0a64 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 226      FEF6F2FF 
+GAS LISTING /tmp/ccTtNBwq.s 			page 14
+
+
+ 226      FEF6F2FF 
+ 226      FEF6F2
+ 227 0a73 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 227      FFFEF6F2 
+ 227      FFFEF6F2 
+ 227      FFFEF6
+ 228 0a82 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 228      F2FFFEF6 
+ 228      F2FFFEF6 
+ 228      F2FFFE
+ 229 0a91 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 229      F6F2FFFE 
+ 229      F6F2FFFE 
+ 229      F6F2FF
+ 230 0aa0 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 230      FEF6F2FF 
+ 230      FEF6F2FF 
+ 230      FEF6F2
+ 231 0aaf FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 231      FFFEF6F2 
+ 231      FFFEF6F2 
+ 231      FFFEF6
+ 232 0abe F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 232      F2FFFEF6 
+ 232      F2FFFEF6 
+ 232      F2FFFE
+ 233 0acd F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 233      F6F2FFFE 
+ 233      F6F2FFFE 
+ 233      F6F2FF
+ 234 0adc FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 234      FEF6F2FF 
+ 234      FEF6F2FF 
+ 234      FEF6F2
+ 235 0aeb FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 235      FFFEF6F2 
+ 235      FFFEF6F2 
+ 235      FFFEF6
+ 236 0afa F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 236      F2FFFEF6 
+ 236      F2FFFEF6 
+ 236      F2FFFE
+ 237 0b09 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 237      F6F2FFFE 
+ 237      F6F2FFFE 
+ 237      F6F2FF
+ 238 0b18 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 238      FEF6F2FF 
+ 238      FEF6F2FF 
+ 238      FEF6F2
+ 239 0b27 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 239      FFFEF6F2 
+ 239      FFFEF6F2 
+ 239      FFFEF6
+ 240 0b36 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 240      F2FFFEF6 
+ 240      F2FFFEF6 
+GAS LISTING /tmp/ccTtNBwq.s 			page 15
+
+
+ 240      F2FFFE
+ 241 0b45 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 241      F6F2FFFE 
+ 241      F6F2FFFE 
+ 241      F6F2FF
+ 242 0b54 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 242      FEF6F2FF 
+ 242      FEF6F2FF 
+ 242      FEF6F2
+ 243 0b63 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 243      FFFEF6F2 
+ 243      FFFEF6F2 
+ 243      FFFEF6
+ 244 0b72 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 244      F2FFFEF6 
+ 244      F2FFFEF6 
+ 244      F2FFFE
+ 245 0b81 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 245      F6F2FFFE 
+ 245      F6F2FFFE 
+ 245      F6F2FF
+ 246 0b90 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 246      FEF6F2FF 
+ 246      FEF6F2FF 
+ 246      FEF6F2
+ 247 0b9f FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 247      FFFEF6F2 
+ 247      FFFEF6F2 
+ 247      FFFEF6
+ 248 0bae F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 248      F2FFFEF6 
+ 248      F2FFFEF6 
+ 248      F2FFFE
+ 249 0bbd F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 249      F6F2FFFE 
+ 249      F6F2FFFE 
+ 249      F6F2FF
+ 250 0bcc FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 250      FEF6F2FF 
+ 250      FEF6F2FF 
+ 250      FEF6F2
+ 251 0bdb FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 251      FFFEF6F2 
+ 251      FFFEF6F2 
+ 251      FFFEF6
+ 252 0bea F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 252      F2FFFEF6 
+ 252      F2FFFEF6 
+ 252      F2FFFE
+ 253 0bf9 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 253      F6F2FFFE 
+ 253      F6F2FFFE 
+ 253      F6F2FF
+ 254 0c08 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 254      FEF6F2FF 
+ 254      FEF6F2FF 
+ 254      FEF6F2
+GAS LISTING /tmp/ccTtNBwq.s 			page 16
+
+
+ 255 0c17 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 255      FFFEF6F2 
+ 255      FFFEF6F2 
+ 255      FFFEF6
+ 256 0c26 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 256      F2FFFEF6 
+ 256      F2FFFEF6 
+ 256      F2FFFE
+ 257 0c35 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 257      F6F2FFFE 
+ 257      F6F2FFFE 
+ 257      F6F2FF
+ 258 0c44 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 258      FEF6F2FF 
+ 258      FEF6F2FF 
+ 258      FEF6F2
+ 259 0c53 FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 259      FFFEF6F2 
+ 259      FFFEF6F2 
+ 259      FFFEF6
+ 260 0c62 F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 260      F2FFFEF6 
+ 260      F2FFFEF6 
+ 260      F2FFFE
+ 261 0c71 F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 261      F6F2FFFE 
+ 261      F6F2FFFE 
+ 261      F6F2FF
+ 262 0c80 FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 262      FEF6F2FF 
+ 262      FEF6F2FF 
+ 262      FEF6F2
+ 263 0c8f FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\366\362\377\376\366"
+ 263      FFFEF6F2 
+ 263      FFFEF6F2 
+ 263      FFFEF6
+ 264 0c9e F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377\376\366\362\377\376"
+ 264      F2FFFEF6 
+ 264      F2FFFEF6 
+ 264      F2FFFE
+ 265 0cad F6F2FFFE 		.ascii	"\366\362\377\376\366\362\377\376\366\362\377\376\366\362\377"
+ 265      F6F2FFFE 
+ 265      F6F2FFFE 
+ 265      F6F2FF
+ 266 0cbc FEF6F2FF 		.ascii	"\376\366\362\377\376\366\362\377\376\366\362\377\376\366\362"
+ 266      FEF6F2FF 
+ 266      FEF6F2FF 
+ 266      FEF6F2
+ 267 0ccb FFFEF6F2 		.ascii	"\377\376\366\362\377\376\366\362\377\376\367\362\377\376\367"
+ 267      FFFEF6F2 
+ 267      FFFEF7F2 
+ 267      FFFEF7
+ 268 0cda F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 268      F2FFFEF7 
+ 268      F2FFFEF7 
+ 268      F2FFFE
+ 269 0ce9 F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+GAS LISTING /tmp/ccTtNBwq.s 			page 17
+
+
+ 269      F7F2FFFE 
+ 269      F7F2FFFE 
+ 269      F7F2FF
+ 270 0cf8 FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 270      FEF7F2FF 
+ 270      FEF7F2FF 
+ 270      FEF7F2
+ 271 0d07 FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 271      FFFEF7F2 
+ 271      FFFEF7F2 
+ 271      FFFEF7
+ 272 0d16 F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 272      F2FFFEF7 
+ 272      F2FFFEF7 
+ 272      F2FFFE
+ 273 0d25 F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+ 273      F7F2FFFE 
+ 273      F7F2FFFE 
+ 273      F7F2FF
+ 274 0d34 FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 274      FEF7F2FF 
+ 274      FEF7F2FF 
+ 274      FEF7F2
+ 275 0d43 FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 275      FFFEF7F2 
+ 275      FFFEF7F2 
+ 275      FFFEF7
+ 276 0d52 F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 276      F2FFFEF7 
+ 276      F2FFFEF7 
+ 276      F2FFFE
+ 277 0d61 F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+ 277      F7F2FFFE 
+ 277      F7F2FFFE 
+ 277      F7F2FF
+ 278 0d70 FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 278      FEF7F2FF 
+ 278      FEF7F2FF 
+ 278      FEF7F2
+ 279 0d7f FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 279      FFFEF7F2 
+ 279      FFFEF7F2 
+ 279      FFFEF7
+ 280 0d8e F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 280      F2FFFEF7 
+ 280      F2FFFEF7 
+ 280      F2FFFE
+ 281 0d9d F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+ 281      F7F2FFFE 
+ 281      F7F2FFFE 
+ 281      F7F2FF
+ 282 0dac FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 282      FEF7F2FF 
+ 282      FEF7F2FF 
+ 282      FEF7F2
+ 283 0dbb FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 283      FFFEF7F2 
+GAS LISTING /tmp/ccTtNBwq.s 			page 18
+
+
+ 283      FFFEF7F2 
+ 283      FFFEF7
+ 284 0dca F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 284      F2FFFEF7 
+ 284      F2FFFEF7 
+ 284      F2FFFE
+ 285 0dd9 F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+ 285      F7F2FFFE 
+ 285      F7F2FFFE 
+ 285      F7F2FF
+ 286 0de8 FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 286      FEF7F2FF 
+ 286      FEF7F2FF 
+ 286      FEF7F2
+ 287 0df7 FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 287      FFFEF7F2 
+ 287      FFFEF7F2 
+ 287      FFFEF7
+ 288 0e06 F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 288      F2FFFEF7 
+ 288      F2FFFEF7 
+ 288      F2FFFE
+ 289 0e15 F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+ 289      F7F2FFFE 
+ 289      F7F2FFFE 
+ 289      F7F2FF
+ 290 0e24 FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 290      FEF7F2FF 
+ 290      FEF7F2FF 
+ 290      FEF7F2
+ 291 0e33 FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 291      FFFEF7F2 
+ 291      FFFEF7F2 
+ 291      FFFEF7
+ 292 0e42 F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 292      F2FFFEF7 
+ 292      F2FFFEF7 
+ 292      F2FFFE
+ 293 0e51 F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+ 293      F7F2FFFE 
+ 293      F7F2FFFE 
+ 293      F7F2FF
+ 294 0e60 FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 294      FEF7F2FF 
+ 294      FEF7F2FF 
+ 294      FEF7F2
+ 295 0e6f FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 295      FFFEF7F2 
+ 295      FFFEF7F2 
+ 295      FFFEF7
+ 296 0e7e F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 296      F2FFFEF7 
+ 296      F2FFFEF7 
+ 296      F2FFFE
+ 297 0e8d F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+ 297      F7F2FFFE 
+ 297      F7F2FFFE 
+GAS LISTING /tmp/ccTtNBwq.s 			page 19
+
+
+ 297      F7F2FF
+ 298 0e9c FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 298      FEF7F2FF 
+ 298      FEF7F2FF 
+ 298      FEF7F2
+ 299 0eab FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 299      FFFEF7F2 
+ 299      FFFEF7F2 
+ 299      FFFEF7
+ 300 0eba F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 300      F2FFFEF7 
+ 300      F2FFFEF7 
+ 300      F2FFFE
+ 301 0ec9 F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+ 301      F7F2FFFE 
+ 301      F7F2FFFE 
+ 301      F7F2FF
+ 302 0ed8 FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 302      FEF7F2FF 
+ 302      FEF7F2FF 
+ 302      FEF7F2
+ 303 0ee7 FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 303      FFFEF7F2 
+ 303      FFFEF7F2 
+ 303      FFFEF7
+ 304 0ef6 F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 304      F2FFFEF7 
+ 304      F2FFFEF7 
+ 304      F2FFFE
+ 305 0f05 F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+ 305      F7F2FFFE 
+ 305      F7F2FFFE 
+ 305      F7F2FF
+ 306 0f14 FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 306      FEF7F2FF 
+ 306      FEF7F2FF 
+ 306      FEF7F2
+ 307 0f23 FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 307      FFFEF7F2 
+ 307      FFFEF7F2 
+ 307      FFFEF7
+ 308 0f32 F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 308      F2FFFEF7 
+ 308      F2FFFEF7 
+ 308      F2FFFE
+ 309 0f41 F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+ 309      F7F2FFFE 
+ 309      F7F2FFFE 
+ 309      F7F2FF
+ 310 0f50 FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 310      FEF7F2FF 
+ 310      FEF7F2FF 
+ 310      FEF7F2
+ 311 0f5f FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 311      FFFEF7F2 
+ 311      FFFEF7F2 
+ 311      FFFEF7
+GAS LISTING /tmp/ccTtNBwq.s 			page 20
+
+
+ 312 0f6e F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 312      F2FFFEF7 
+ 312      F2FFFEF7 
+ 312      F2FFFE
+ 313 0f7d F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+ 313      F7F2FFFE 
+ 313      F7F2FFFE 
+ 313      F7F2FF
+ 314 0f8c FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 314      FEF7F2FF 
+ 314      FEF7F2FF 
+ 314      FEF7F2
+ 315 0f9b FFFEF7F2 		.ascii	"\377\376\367\362\377"
+ 315      FF
+ 316 0fa0 FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 316      FEF7F2FF 
+ 316      FEF7F2FF 
+ 316      FEF7F2
+ 317 0faf FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 317      FFFEF7F2 
+ 317      FFFEF7F2 
+ 317      FFFEF7
+ 318 0fbe F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377\376\367\362\377\376"
+ 318      F2FFFEF7 
+ 318      F2FFFEF7 
+ 318      F2FFFE
+ 319 0fcd F7F2FFFE 		.ascii	"\367\362\377\376\367\362\377\376\367\362\377\376\367\362\377"
+ 319      F7F2FFFE 
+ 319      F7F2FFFE 
+ 319      F7F2FF
+ 320 0fdc FEF7F2FF 		.ascii	"\376\367\362\377\376\367\362\377\376\367\362\377\376\367\362"
+ 320      FEF7F2FF 
+ 320      FEF7F2FF 
+ 320      FEF7F2
+ 321 0feb FFFEF7F2 		.ascii	"\377\376\367\362\377\376\367\362\377\376\367\362\377\376\367"
+ 321      FFFEF7F2 
+ 321      FFFEF7F2 
+ 321      FFFEF7
+ 322 0ffa F2FFFEF7 		.ascii	"\362\377\376\367\362\377\376\367\362\377"
+ 322      F2FFFEF7 
+ 322      F2FF
+ 323              		.globl	heatmap_cs_RdPu_mixed
+ 324              		.section	.data.rel.local
+ 325              		.align 8
+ 326              		.type	heatmap_cs_RdPu_mixed, @object
+ 327              		.size	heatmap_cs_RdPu_mixed, 8
+ 328              	heatmap_cs_RdPu_mixed:
+ 329 0008 00000000 		.quad	mixed
+ 329      00000000 
+ 330              		.section	.data.rel.ro.local
+ 331              		.align 16
+ 332              		.type	mixed, @object
+ 333              		.size	mixed, 16
+ 334              	mixed:
+ 335 0010 00000000 		.quad	mixed_data
+ 335      00000000 
+ 336 0018 01040000 		.quad	1025
+GAS LISTING /tmp/ccTtNBwq.s 			page 21
+
+
+ 336      00000000 
+ 337              		.section	.rodata
+ 338 1004 00000000 		.align 32
+ 338      00000000 
+ 338      00000000 
+ 338      00000000 
+ 338      00000000 
+ 339              		.type	mixed_data, @object
+ 340              		.size	mixed_data, 4100
+ 341              	mixed_data:
+ 342 1020 00       		.string	""
+ 343 1021 00       		.string	""
+ 344 1022 00       		.string	""
+ 345 1023 00       		.string	""
+ 346 1024 4800     		.string	"H"
+ 347 1026 6A00     		.string	"j"
+ 348 1028 4900     		.string	"I"
+ 349 102a 6A074900 		.string	"j\007I"
+ 350 102e 6A0E4900 		.string	"j\016I"
+ 351 1032 6A164A00 		.string	"j\026J"
+ 352 1036 6A1D4A00 		.string	"j\035J"
+ 353 103a 6A254A00 		.string	"j%J"
+ 354 103e 6A2C4B00 		.string	"j,K"
+ 355 1042 6A344B00 		.string	"j4K"
+ 356 1046 6A3B4B00 		.string	"j;K"
+ 357 104a 6A434C00 		.string	"jCL"
+ 358 104e 6A4A4C00 		.string	"jJL"
+ 359 1052 6B524C00 		.string	"kRL"
+ 360 1056 6B594D00 		.string	"kYM"
+ 361 105a 6B614D00 		.string	"kaM"
+ 362 105e 6B684D00 		.string	"khM"
+ 363 1062 6B704E00 		.string	"kpN"
+ 364 1066 6B774E00 		.string	"kwN"
+ 365 106a 6B7F4E00 		.string	"k\177N"
+ 366 106e 6B864F00 		.string	"k\206O"
+ 367 1072 6B8D4F00 		.string	"k\215O"
+ 368 1076 6B954F00 		.string	"k\225O"
+ 369 107a 6B9C4F00 		.string	"k\234O"
+ 370 107e 6CA45000 		.string	"l\244P"
+ 371 1082 6CAB5000 		.string	"l\253P"
+ 372 1086 6CB35000 		.string	"l\263P"
+ 373 108a 6CBA5100 		.string	"l\272Q"
+ 374 108e 6CC25100 		.string	"l\302Q"
+ 375 1092 6CC95100 		.string	"l\311Q"
+ 376 1096 6CD15200 		.string	"l\321R"
+ 377 109a 6CD85200 		.string	"l\330R"
+ 378 109e 6CE05200 		.string	"l\340R"
+ 379 10a2 6CE75300 		.string	"l\347S"
+ 380 10a6 6CEF5300 		.string	"l\357S"
+ 381 10aa 6CF65300 		.string	"l\366S"
+ 382 10ae 6DFE5400 		.string	"m\376T"
+ 383 10b2 6DFF5400 		.string	"m\377T"
+ 384 10b6 6DFF5400 		.string	"m\377T"
+ 385 10ba 6DFF5400 		.string	"m\377T"
+ 386 10be 6DFF5500 		.string	"m\377U"
+ 387 10c2 6DFF5500 		.string	"m\377U"
+ 388 10c6 6DFF5500 		.string	"m\377U"
+GAS LISTING /tmp/ccTtNBwq.s 			page 22
+
+
+ 389 10ca 6DFF5600 		.string	"m\377V"
+ 390 10ce 6DFF5600 		.string	"m\377V"
+ 391 10d2 6DFF5600 		.string	"m\377V"
+ 392 10d6 6DFF5700 		.string	"m\377W"
+ 393 10da 6EFF5700 		.string	"n\377W"
+ 394 10de 6EFF5700 		.string	"n\377W"
+ 395 10e2 6EFF5800 		.string	"n\377X"
+ 396 10e6 6EFF5800 		.string	"n\377X"
+ 397 10ea 6EFF5800 		.string	"n\377X"
+ 398 10ee 6EFF5800 		.string	"n\377X"
+ 399 10f2 6EFF5900 		.string	"n\377Y"
+ 400 10f6 6EFF5900 		.string	"n\377Y"
+ 401 10fa 6EFF5900 		.string	"n\377Y"
+ 402 10fe 6EFF5A00 		.string	"n\377Z"
+ 403 1102 6EFF5A00 		.string	"n\377Z"
+ 404 1106 6EFF5A00 		.string	"n\377Z"
+ 405 110a 6FFF5B00 		.string	"o\377["
+ 406 110e 6FFF5B00 		.string	"o\377["
+ 407 1112 6FFF5B00 		.string	"o\377["
+ 408 1116 6FFF5C00 		.string	"o\377\\"
+ 409 111a 6FFF5C00 		.string	"o\377\\"
+ 410 111e 6FFF5C00 		.string	"o\377\\"
+ 411 1122 6FFF6600 		.string	"o\377f"
+ 412 1126 72FF6700 		.string	"r\377g"
+ 413 112a 72FF6700 		.string	"r\377g"
+ 414 112e 72FF6700 		.string	"r\377g"
+ 415 1132 72FF6700 		.string	"r\377g"
+ 416 1136 72FF6800 		.string	"r\377h"
+ 417 113a 72FF6800 		.string	"r\377h"
+ 418 113e 72FF6800 		.string	"r\377h"
+ 419 1142 72FF6900 		.string	"r\377i"
+ 420 1146 72FF6900 		.string	"r\377i"
+ 421 114a 72FF6900 		.string	"r\377i"
+ 422 114e 72FF6A00 		.string	"r\377j"
+ 423 1152 73FF6A00 		.string	"s\377j"
+ 424 1156 73FF6A00 		.string	"s\377j"
+ 425 115a 73FF6B00 		.string	"s\377k"
+ 426 115e 73FF6B00 		.string	"s\377k"
+ 427 1162 73FF6B00 		.string	"s\377k"
+ 428 1166 73FF6B00 		.string	"s\377k"
+ 429 116a 73FF6C00 		.string	"s\377l"
+ 430 116e 73FF6C00 		.string	"s\377l"
+ 431 1172 73FF6C00 		.string	"s\377l"
+ 432 1176 73FF6D00 		.string	"s\377m"
+ 433 117a 73FF6D00 		.string	"s\377m"
+ 434 117e 73FF6D00 		.string	"s\377m"
+ 435 1182 74FF6E00 		.string	"t\377n"
+ 436 1186 74FF6E00 		.string	"t\377n"
+ 437 118a 74FF6E00 		.string	"t\377n"
+ 438 118e 74FF6E00 		.string	"t\377n"
+ 439 1192 74FF6F00 		.string	"t\377o"
+ 440 1196 74FF6F00 		.string	"t\377o"
+ 441 119a 74FF6F00 		.string	"t\377o"
+ 442 119e 74FF7000 		.string	"t\377p"
+ 443 11a2 74FF7000 		.string	"t\377p"
+ 444 11a6 74FF7000 		.string	"t\377p"
+ 445 11aa 74FF7100 		.string	"t\377q"
+GAS LISTING /tmp/ccTtNBwq.s 			page 23
+
+
+ 446 11ae 74FF7100 		.string	"t\377q"
+ 447 11b2 74FF7100 		.string	"t\377q"
+ 448 11b6 74FF7100 		.string	"t\377q"
+ 449 11ba 75FF7200 		.string	"u\377r"
+ 450 11be 75FF7200 		.string	"u\377r"
+ 451 11c2 75FF7200 		.string	"u\377r"
+ 452 11c6 75FF7300 		.string	"u\377s"
+ 453 11ca 75FF7300 		.string	"u\377s"
+ 454 11ce 75FF7300 		.string	"u\377s"
+ 455 11d2 75FF7400 		.string	"u\377t"
+ 456 11d6 75FF7400 		.string	"u\377t"
+ 457 11da 75FF7400 		.string	"u\377t"
+ 458 11de 75FF7400 		.string	"u\377t"
+ 459 11e2 75FF7500 		.string	"u\377u"
+ 460 11e6 75FF7500 		.string	"u\377u"
+ 461 11ea 75FF7500 		.string	"u\377u"
+ 462 11ee 76FF7600 		.string	"v\377v"
+ 463 11f2 76FF7600 		.string	"v\377v"
+ 464 11f6 76FF7600 		.string	"v\377v"
+ 465 11fa 76FF7700 		.string	"v\377w"
+ 466 11fe 76FF7700 		.string	"v\377w"
+ 467 1202 76FF7700 		.string	"v\377w"
+ 468 1206 76FF7700 		.string	"v\377w"
+ 469 120a 76FF7800 		.string	"v\377x"
+ 470 120e 76FF7800 		.string	"v\377x"
+ 471 1212 76FF7800 		.string	"v\377x"
+ 472 1216 76FF7900 		.string	"v\377y"
+ 473 121a 76FF7900 		.string	"v\377y"
+ 474 121e 76FF7900 		.string	"v\377y"
+ 475 1222 76FF7901 		.string	"v\377y\001w\377z"
+ 475      77FF7A00 
+ 476 122a 77FF7A00 		.string	"w\377z"
+ 477 122e 77FF7A00 		.string	"w\377z"
+ 478 1232 77FF7B00 		.string	"w\377{"
+ 479 1236 77FF7B00 		.string	"w\377{"
+ 480 123a 77FF7B00 		.string	"w\377{"
+ 481 123e 77FF7C00 		.string	"w\377|"
+ 482 1242 77FF7C00 		.string	"w\377|"
+ 483 1246 77FF7C00 		.string	"w\377|"
+ 484 124a 77FF7D00 		.string	"w\377}"
+ 485 124e 77FF7D00 		.string	"w\377}"
+ 486 1252 77FF7D00 		.string	"w\377}"
+ 487 1256 77FF7E00 		.string	"w\377~"
+ 488 125a 77FF7E00 		.string	"w\377~"
+ 489 125e 77FF7E00 		.string	"w\377~"
+ 490 1262 77FF7F00 		.string	"w\377\177"
+ 491 1266 77FF7F00 		.string	"w\377\177"
+ 492 126a 78FF7F00 		.string	"x\377\177"
+ 493 126e 78FF8000 		.string	"x\377\200"
+ 494 1272 78FF8000 		.string	"x\377\200"
+ 495 1276 78FF8000 		.string	"x\377\200"
+ 496 127a 78FF8100 		.string	"x\377\201"
+ 497 127e 78FF8100 		.string	"x\377\201"
+ 498 1282 78FF8100 		.string	"x\377\201"
+ 499 1286 78FF8200 		.string	"x\377\202"
+ 500 128a 78FF8200 		.string	"x\377\202"
+ 501 128e 78FF8200 		.string	"x\377\202"
+GAS LISTING /tmp/ccTtNBwq.s 			page 24
+
+
+ 502 1292 78FF8300 		.string	"x\377\203"
+ 503 1296 78FF8300 		.string	"x\377\203"
+ 504 129a 78FF8300 		.string	"x\377\203"
+ 505 129e 78FF8400 		.string	"x\377\204"
+ 506 12a2 78FF8400 		.string	"x\377\204"
+ 507 12a6 78FF8400 		.string	"x\377\204"
+ 508 12aa 78FF8500 		.string	"x\377\205"
+ 509 12ae 78FF8500 		.string	"x\377\205"
+ 510 12b2 79FF8500 		.string	"y\377\205"
+ 511 12b6 79FF8600 		.string	"y\377\206"
+ 512 12ba 79FF8600 		.string	"y\377\206"
+ 513 12be 79FF8600 		.string	"y\377\206"
+ 514 12c2 79FF8700 		.string	"y\377\207"
+ 515 12c6 79FF8700 		.string	"y\377\207"
+ 516 12ca 79FF8700 		.string	"y\377\207"
+ 517 12ce 79FF8800 		.string	"y\377\210"
+ 518 12d2 79FF8800 		.string	"y\377\210"
+ 519 12d6 79FF8800 		.string	"y\377\210"
+ 520 12da 79FF8900 		.string	"y\377\211"
+ 521 12de 79FF8900 		.string	"y\377\211"
+ 522 12e2 79FF8900 		.string	"y\377\211"
+ 523 12e6 79FF8A00 		.string	"y\377\212"
+ 524 12ea 79FF8A00 		.string	"y\377\212"
+ 525 12ee 79FF8A00 		.string	"y\377\212"
+ 526 12f2 79FF8B00 		.string	"y\377\213"
+ 527 12f6 79FF8B00 		.string	"y\377\213"
+ 528 12fa 79FF8B00 		.string	"y\377\213"
+ 529 12fe 79FF8C00 		.string	"y\377\214"
+ 530 1302 7AFF8C00 		.string	"z\377\214"
+ 531 1306 7AFF8C00 		.string	"z\377\214"
+ 532 130a 7AFF8D00 		.string	"z\377\215"
+ 533 130e 7AFF8D00 		.string	"z\377\215"
+ 534 1312 7AFF8D00 		.string	"z\377\215"
+ 535 1316 7AFF8E00 		.string	"z\377\216"
+ 536 131a 7AFF8E00 		.string	"z\377\216"
+ 537 131e 7AFF8E00 		.string	"z\377\216"
+ 538 1322 7AFF9900 		.string	"z\377\231"
+ 539 1326 7BFF9900 		.string	"{\377\231"
+ 540 132a 7BFF9A00 		.string	"{\377\232"
+ 541 132e 7BFF9A00 		.string	"{\377\232"
+ 542 1332 7BFF9A00 		.string	"{\377\232"
+ 543 1336 7CFF9B00 		.string	"|\377\233"
+ 544 133a 7CFF9B00 		.string	"|\377\233"
+ 545 133e 7CFF9B00 		.string	"|\377\233"
+ 546 1342 7CFF9C00 		.string	"|\377\234"
+ 547 1346 7CFF9C00 		.string	"|\377\234"
+ 548 134a 7CFF9C00 		.string	"|\377\234"
+ 549 134e 7CFF9D00 		.string	"|\377\235"
+ 550 1352 7CFF9D00 		.string	"|\377\235"
+ 551 1356 7CFF9D00 		.string	"|\377\235"
+ 552 135a 7CFF9D00 		.string	"|\377\235"
+ 553 135e 7CFF9E00 		.string	"|\377\236"
+ 554 1362 7CFF9E00 		.string	"|\377\236"
+ 555 1366 7CFF9E00 		.string	"|\377\236"
+ 556 136a 7CFF9F00 		.string	"|\377\237"
+ 557 136e 7CFF9F00 		.string	"|\377\237"
+ 558 1372 7CFF9F00 		.string	"|\377\237"
+GAS LISTING /tmp/ccTtNBwq.s 			page 25
+
+
+ 559 1376 7CFFA000 		.string	"|\377\240"
+ 560 137a 7CFFA000 		.string	"|\377\240"
+ 561 137e 7CFFA000 		.string	"|\377\240"
+ 562 1382 7CFFA100 		.string	"|\377\241"
+ 563 1386 7CFFA100 		.string	"|\377\241"
+ 564 138a 7CFFA100 		.string	"|\377\241"
+ 565 138e 7CFFA200 		.string	"|\377\242"
+ 566 1392 7CFFA200 		.string	"|\377\242"
+ 567 1396 7CFFA200 		.string	"|\377\242"
+ 568 139a 7CFFA300 		.string	"|\377\243"
+ 569 139e 7DFFA300 		.string	"}\377\243"
+ 570 13a2 7DFFA300 		.string	"}\377\243"
+ 571 13a6 7DFFA400 		.string	"}\377\244"
+ 572 13aa 7DFFA400 		.string	"}\377\244"
+ 573 13ae 7DFFA400 		.string	"}\377\244"
+ 574 13b2 7DFFA500 		.string	"}\377\245"
+ 575 13b6 7DFFA500 		.string	"}\377\245"
+ 576 13ba 7DFFA500 		.string	"}\377\245"
+ 577 13be 7DFFA600 		.string	"}\377\246"
+ 578 13c2 7DFFA600 		.string	"}\377\246"
+ 579 13c6 7DFFA600 		.string	"}\377\246"
+ 580 13ca 7DFFA600 		.string	"}\377\246"
+ 581 13ce 7DFFA700 		.string	"}\377\247"
+ 582 13d2 7DFFA700 		.string	"}\377\247"
+ 583 13d6 7DFFA700 		.string	"}\377\247"
+ 584 13da 7DFFA800 		.string	"}\377\250"
+ 585 13de 7DFFA800 		.string	"}\377\250"
+ 586 13e2 7DFFA800 		.string	"}\377\250"
+ 587 13e6 7DFFA900 		.string	"}\377\251"
+ 588 13ea 7DFFA900 		.string	"}\377\251"
+ 589 13ee 7DFFA900 		.string	"}\377\251"
+ 590 13f2 7DFFAA00 		.string	"}\377\252"
+ 591 13f6 7DFFAA00 		.string	"}\377\252"
+ 592 13fa 7DFFAA00 		.string	"}\377\252"
+ 593 13fe 7DFFAB00 		.string	"}\377\253"
+ 594 1402 7DFFAB00 		.string	"}\377\253"
+ 595 1406 7DFFAB00 		.string	"}\377\253"
+ 596 140a 7DFFAC00 		.string	"}\377\254"
+ 597 140e 7DFFAC00 		.string	"}\377\254"
+ 598 1412 7DFFAC00 		.string	"}\377\254"
+ 599 1416 7DFFAD00 		.string	"}\377\255"
+ 600 141a 7DFFAD00 		.string	"}\377\255"
+ 601 141e 7DFFAD00 		.string	"}\377\255"
+ 602 1422 7DFFAD01 		.ascii	"}\377\255\001}\377\256\001~\377\256\001~\377\256\002~\377\257"
+ 602      7DFFAE01 
+ 602      7EFFAE01 
+ 602      7EFFAE02 
+ 602      7EFFAF
+ 603 1435 027EFFAF 		.ascii	"\002~\377\257\003~\377\257\003~\377\260\004\177\377\260\004\177"
+ 603      037EFFAF 
+ 603      037EFFB0 
+ 603      047FFFB0 
+ 603      047F
+ 604 1447 FFB0057F 		.ascii	"\377\260\005\177\377\260\005\177\377\261\006\177\377\261\006"
+ 604      FFB0057F 
+ 604      FFB1067F 
+ 604      FFB106
+GAS LISTING /tmp/ccTtNBwq.s 			page 26
+
+
+ 605 1456 7FFFB107 		.ascii	"\177\377\261\007\200\377\262\007\200\377\262\b\200\377\262\b"
+ 605      80FFB207 
+ 605      80FFB208 
+ 605      80FFB208 
+ 606 1466 80FFB209 		.ascii	"\200\377\262\t\200\377\263\t\200\377\263\n\200\377\263\n\201"
+ 606      80FFB309 
+ 606      80FFB30A 
+ 606      80FFB30A 
+ 606      81
+ 607 1477 FFB40B81 		.ascii	"\377\264\013\201\377\264\013\201\377\264\013\201\377\264\f\201"
+ 607      FFB40B81 
+ 607      FFB40B81 
+ 607      FFB40C81 
+ 608 1487 FFB50C81 		.ascii	"\377\265\f\201\377\265\r\202\377\265\r\202\377\266\016\202\377"
+ 608      FFB50D82 
+ 608      FFB50D82 
+ 608      FFB60E82 
+ 608      FF
+ 609 1498 B60E82FF 		.ascii	"\266\016\202\377\266\016\202\377\267\017\202\377\267\017\203"
+ 609      B60E82FF 
+ 609      B70F82FF 
+ 609      B70F83
+ 610 14a7 FFB70F83 		.ascii	"\377\267\017\203\377\267\020\203\377\270\020\203\377\270\020"
+ 610      FFB71083 
+ 610      FFB81083 
+ 610      FFB810
+ 611 14b6 83FFB811 		.ascii	"\203\377\270\021\203\377\271\021\203\377\271\021\204\377\271"
+ 611      83FFB911 
+ 611      83FFB911 
+ 611      84FFB9
+ 612 14c5 1284FFB9 		.ascii	"\022\204\377\271\022\204\377\272\022\204\377\272\023\204\377"
+ 612      1284FFBA 
+ 612      1284FFBA 
+ 612      1384FF
+ 613 14d4 BA1384FF 		.ascii	"\272\023\204\377\273\023\205\377\273\024\205\377\273\024\205"
+ 613      BB1385FF 
+ 613      BB1485FF 
+ 613      BB1485
+ 614 14e3 FFBB1485 		.ascii	"\377\273\024\205\377\274\025\205\377\274\025\205\377\274\025"
+ 614      FFBC1585 
+ 614      FFBC1585 
+ 614      FFBC15
+ 615 14f2 86FFBD16 		.ascii	"\206\377\275\026\206\377\275\026\206\377\275\026\206\377\276"
+ 615      86FFBD16 
+ 615      86FFBD16 
+ 615      86FFBE
+ 616 1501 1686FFBE 		.ascii	"\026\206\377\276\027\206\377\276\027\206\377\276\027\207\377"
+ 616      1786FFBE 
+ 616      1786FFBE 
+ 616      1787FF
+ 617 1510 BF1887FF 		.ascii	"\277\030\207\377\277\030\207\377\277\030\207\377\300\031\207"
+ 617      BF1887FF 
+ 617      BF1887FF 
+ 617      C01987
+ 618 151f FFC01987 		.ascii	"\377\300\031\207\377\312#\215\377\312$\215\377\312$\215\377\312"
+ 618      FFCA238D 
+ 618      FFCA248D 
+GAS LISTING /tmp/ccTtNBwq.s 			page 27
+
+
+ 618      FFCA248D 
+ 618      FFCA
+ 619 1531 248DFFCB 		.ascii	"$\215\377\313$\215\377\313%\215\377\313%\215\377\314%\216\377"
+ 619      248DFFCB 
+ 619      258DFFCB 
+ 619      258DFFCC 
+ 619      258EFF
+ 620 1544 CC268EFF 		.ascii	"\314&\216\377\314&\216\377\315&\216\377\315&\216\377\315'\216"
+ 620      CC268EFF 
+ 620      CD268EFF 
+ 620      CD268EFF 
+ 620      CD278E
+ 621 1557 FFCD278F 		.ascii	"\377\315'\217\377\316'\217\377\316'\217\377\316(\217\377\317"
+ 621      FFCE278F 
+ 621      FFCE278F 
+ 621      FFCE288F 
+ 621      FFCF
+ 622 1569 288FFFCF 		.ascii	"(\217\377\317(\217\377\317(\217\377\317)\220\377\320)\220\377"
+ 622      288FFFCF 
+ 622      288FFFCF 
+ 622      2990FFD0 
+ 622      2990FF
+ 623 157c D02990FF 		.ascii	"\320)\220\377\320)\220\377\321*\220\377\321*\220\377\321*\221"
+ 623      D02990FF 
+ 623      D12A90FF 
+ 623      D12A90FF 
+ 623      D12A91
+ 624 158f FFD22A91 		.ascii	"\377\322*\221\377\322+\221\377\322+\221\377\322+\221\377\323"
+ 624      FFD22B91 
+ 624      FFD22B91 
+ 624      FFD22B91 
+ 624      FFD3
+ 625 15a1 2C91FFD3 		.ascii	",\221\377\323,\222\377\323,\222\377\324,\222\377\324-\222\377"
+ 625      2C92FFD3 
+ 625      2C92FFD4 
+ 625      2C92FFD4 
+ 625      2D92FF
+ 626 15b4 D42D92FF 		.ascii	"\324-\222\377\324-\222\377\325-\222\377\325-\223\377\325.\223"
+ 626      D42D92FF 
+ 626      D52D92FF 
+ 626      D52D93FF 
+ 626      D52E93
+ 627 15c7 FFD62E93 		.ascii	"\377\326.\223\377\326.\223\377\326.\223\377\327/\223\377\327"
+ 627      FFD62E93 
+ 627      FFD62E93 
+ 627      FFD72F93 
+ 627      FFD7
+ 628 15d9 2F94FFD7 		.ascii	"/\224\377\327/\224\377\327/\224\377\3300\224\377\3300\224\377"
+ 628      2F94FFD7 
+ 628      2F94FFD8 
+ 628      3094FFD8 
+ 628      3094FF
+ 629 15ec D83094FF 		.ascii	"\3300\224\377\3310\224\377\3311\225\377\3311\225\377\3321\225"
+ 629      D93094FF 
+ 629      D93195FF 
+ 629      D93195FF 
+ 629      DA3195
+GAS LISTING /tmp/ccTtNBwq.s 			page 28
+
+
+ 630 15ff FFDA3195 		.ascii	"\377\3321\225\377\3322\225\377\3322\225\377\3332\226\377\333"
+ 630      FFDA3295 
+ 630      FFDA3295 
+ 630      FFDB3296 
+ 630      FFDB
+ 631 1611 3296FFDB 		.ascii	"2\226\377\3333\226\377\3343\226\377\3343\226\377\3343\226\377"
+ 631      3396FFDC 
+ 631      3396FFDC 
+ 631      3396FFDC 
+ 631      3396FF
+ 632 1624 DC3496FF 		.ascii	"\3344\226\377\3354\227\377\3354\227\377\3355\227\377\3355\227"
+ 632      DD3497FF 
+ 632      DD3497FF 
+ 632      DD3597FF 
+ 632      DD3597
+ 633 1637 FFDD3597 		.ascii	"\377\3355\227\377\3366\227\377\3366\227\377\3367\227\377\336"
+ 633      FFDE3697 
+ 633      FFDE3697 
+ 633      FFDE3797 
+ 633      FFDE
+ 634 1649 3797FFDE 		.ascii	"7\227\377\3367\227\377\3368\227\377\3378\227\377\3378\227\377"
+ 634      3797FFDE 
+ 634      3897FFDF 
+ 634      3897FFDF 
+ 634      3897FF
+ 635 165c DF3997FF 		.ascii	"\3379\227\377\3379\227\377\3379\227\377\340:\227\377\340:\227"
+ 635      DF3997FF 
+ 635      DF3997FF 
+ 635      E03A97FF 
+ 635      E03A97
+ 636 166f FFE03B97 		.ascii	"\377\340;\227\377\340;\227\377\340;\230\377\340<\230\377\341"
+ 636      FFE03B97 
+ 636      FFE03B98 
+ 636      FFE03C98 
+ 636      FFE1
+ 637 1681 3C98FFE1 		.ascii	"<\230\377\341<\230\377\341=\230\377\341=\230\377\341=\230\377"
+ 637      3C98FFE1 
+ 637      3D98FFE1 
+ 637      3D98FFE1 
+ 637      3D98FF
+ 638 1694 E13E98FF 		.ascii	"\341>\230\377\342>\230\377\342>\230\377\342?\230\377\342?\230"
+ 638      E23E98FF 
+ 638      E23E98FF 
+ 638      E23F98FF 
+ 638      E23F98
+ 639 16a7 FFE23F98 		.ascii	"\377\342?\230\377\342@\230\377\343@\230\377\343@\230\377\343"
+ 639      FFE24098 
+ 639      FFE34098 
+ 639      FFE34098 
+ 639      FFE3
+ 640 16b9 4198FFE3 		.ascii	"A\230\377\343A\230\377\343A\230\377\343B\231\377\344B\231\377"
+ 640      4198FFE3 
+ 640      4198FFE3 
+ 640      4299FFE4 
+ 640      4299FF
+ 641 16cc E44299FF 		.ascii	"\344B\231\377\344C\231\377\344C\231\377\344C\231\377\344D\231"
+ 641      E44399FF 
+GAS LISTING /tmp/ccTtNBwq.s 			page 29
+
+
+ 641      E44399FF 
+ 641      E44399FF 
+ 641      E44499
+ 642 16df FFE54499 		.ascii	"\377\345D\231\377\345D\231\377\345E\231\377\345E\231\377\345"
+ 642      FFE54499 
+ 642      FFE54599 
+ 642      FFE54599 
+ 642      FFE5
+ 643 16f1 4599FFE5 		.ascii	"E\231\377\345F\231\377\346F\231\377\346F\231\377\346G\231\377"
+ 643      4699FFE6 
+ 643      4699FFE6 
+ 643      4699FFE6 
+ 643      4799FF
+ 644 1704 E64799FF 		.ascii	"\346G\231\377\346G\232\377\346H\232\377\347H\232\377\347H\232"
+ 644      E6479AFF 
+ 644      E6489AFF 
+ 644      E7489AFF 
+ 644      E7489A
+ 645 1717 FFE7499A 		.ascii	"\377\347I\232\377\347I\232\377\347I\232\377\355T\234\377\355"
+ 645      FFE7499A 
+ 645      FFE7499A 
+ 645      FFED549C 
+ 645      FFED
+ 646 1729 549CFFED 		.ascii	"T\234\377\355U\234\377\355U\234\377\355U\234\377\355V\234\377"
+ 646      559CFFED 
+ 646      559CFFED 
+ 646      559CFFED 
+ 646      569CFF
+ 647 173c EE569CFF 		.ascii	"\356V\234\377\356V\234\377\356W\234\377\356W\234\377\356W\235"
+ 647      EE569CFF 
+ 647      EE579CFF 
+ 647      EE579CFF 
+ 647      EE579D
+ 648 174f FFEE589D 		.ascii	"\377\356X\235\377\357X\235\377\357X\235\377\357X\235\377\357"
+ 648      FFEF589D 
+ 648      FFEF589D 
+ 648      FFEF589D 
+ 648      FFEF
+ 649 1761 599DFFEF 		.ascii	"Y\235\377\357Y\235\377\357Y\235\377\360Z\235\377\360Z\235\377"
+ 649      599DFFEF 
+ 649      599DFFF0 
+ 649      5A9DFFF0 
+ 649      5A9DFF
+ 650 1774 F05A9DFF 		.ascii	"\360Z\235\377\360[\235\377\360[\235\377\360[\235\377\360\\\236"
+ 650      F05B9DFF 
+ 650      F05B9DFF 
+ 650      F05B9DFF 
+ 650      F05C9E
+ 651 1787 FFF15C9E 		.ascii	"\377\361\\\236\377\361\\\236\377\361\\\236\377\361]\236\377\361"
+ 651      FFF15C9E 
+ 651      FFF15C9E 
+ 651      FFF15D9E 
+ 651      FFF1
+ 652 1799 5D9EFFF1 		.ascii	"]\236\377\361]\236\377\362^\236\377\362^\236\377\362^\236\377"
+ 652      5D9EFFF2 
+ 652      5E9EFFF2 
+ 652      5E9EFFF2 
+GAS LISTING /tmp/ccTtNBwq.s 			page 30
+
+
+ 652      5E9EFF
+ 653 17ac F25F9EFF 		.ascii	"\362_\236\377\362_\236\377\362_\236\377\362_\236\377\363`\236"
+ 653      F25F9EFF 
+ 653      F25F9EFF 
+ 653      F25F9EFF 
+ 653      F3609E
+ 654 17bf FFF3609F 		.ascii	"\377\363`\237\377\363`\237\377\363a\237\377\363a\237\377\363"
+ 654      FFF3609F 
+ 654      FFF3619F 
+ 654      FFF3619F 
+ 654      FFF3
+ 655 17d1 619FFFF4 		.ascii	"a\237\377\364b\237\377\364b\237\377\364b\237\377\364b\237\377"
+ 655      629FFFF4 
+ 655      629FFFF4 
+ 655      629FFFF4 
+ 655      629FFF
+ 656 17e4 F4639FFF 		.ascii	"\364c\237\377\364c\237\377\364c\237\377"
+ 656      F4639FFF 
+ 656      F4639FFF 
+ 657 17f0 F5649FFF 		.ascii	"\365d\237\377\365d\240\377\365d\240\377\365e\240\377\365e\240"
+ 657      F564A0FF 
+ 657      F564A0FF 
+ 657      F565A0FF 
+ 657      F565A0
+ 658 1803 FFF565A0 		.ascii	"\377\365e\240\377\365e\240\377\366f\240\377\366f\240\377\366"
+ 658      FFF565A0 
+ 658      FFF666A0 
+ 658      FFF666A0 
+ 658      FFF6
+ 659 1815 66A0FFF6 		.ascii	"f\240\377\366g\240\377\366g\240\377\366g\240\377\366h\240\377"
+ 659      67A0FFF6 
+ 659      67A0FFF6 
+ 659      67A0FFF6 
+ 659      68A0FF
+ 660 1828 F96796FF 		.ascii	"\371g\226\377\371h\227\377\371h\227\377\371i\227\377\371i\227"
+ 660      F96897FF 
+ 660      F96897FF 
+ 660      F96997FF 
+ 660      F96997
+ 661 183b FFF96998 		.ascii	"\377\371i\230\377\371j\230\377\371j\230\377\371j\231\377\371"
+ 661      FFF96A98 
+ 661      FFF96A98 
+ 661      FFF96A99 
+ 661      FFF9
+ 662 184d 6B99FFF9 		.ascii	"k\231\377\371k\231\377\371l\231\377\371l\232\377\371l\232\377"
+ 662      6B99FFF9 
+ 662      6C99FFF9 
+ 662      6C9AFFF9 
+ 662      6C9AFF
+ 663 1860 F96D9AFF 		.ascii	"\371m\232\377\371m\233\377\371m\233\377\371n\233\377\371n\233"
+ 663      F96D9BFF 
+ 663      F96D9BFF 
+ 663      F96E9BFF 
+ 663      F96E9B
+ 664 1873 FFF96F9C 		.ascii	"\377\371o\234\377\371o\234\377\371o\234\377\371p\234\377\371"
+ 664      FFF96F9C 
+ 664      FFF96F9C 
+GAS LISTING /tmp/ccTtNBwq.s 			page 31
+
+
+ 664      FFF9709C 
+ 664      FFF9
+ 665 1885 709DFFF9 		.ascii	"p\235\377\371p\235\377\371q\235\377\371q\236\377\371r\236\377"
+ 665      709DFFF9 
+ 665      719DFFF9 
+ 665      719EFFF9 
+ 665      729EFF
+ 666 1898 F9729EFF 		.ascii	"\371r\236\377\371r\236\377\371s\237\377\371s\237\377\371s\237"
+ 666      F9729EFF 
+ 666      F9739FFF 
+ 666      F9739FFF 
+ 666      F9739F
+ 667 18ab FFF9749F 		.ascii	"\377\371t\237\377\371t\240\377\371t\240\377\371u\240\377\371"
+ 667      FFF974A0 
+ 667      FFF974A0 
+ 667      FFF975A0 
+ 667      FFF9
+ 668 18bd 75A1FFF9 		.ascii	"u\241\377\371v\241\377\371v\241\377\371v\241\377\371w\242\377"
+ 668      76A1FFF9 
+ 668      76A1FFF9 
+ 668      76A1FFF9 
+ 668      77A2FF
+ 669 18d0 F977A2FF 		.ascii	"\371w\242\377\371w\242\377\371x\242\377\371x\243\377\371x\243"
+ 669      F977A2FF 
+ 669      F978A2FF 
+ 669      F978A3FF 
+ 669      F978A3
+ 670 18e3 FFF979A3 		.ascii	"\377\371y\243\377\371y\243\377\371z\244\377\371z\244\377\371"
+ 670      FFF979A3 
+ 670      FFF97AA4 
+ 670      FFF97AA4 
+ 670      FFF9
+ 671 18f5 7AA4FFF9 		.ascii	"z\244\377\371{\245\377\371{\245\377\371{\245\377\371|\245\377"
+ 671      7BA5FFF9 
+ 671      7BA5FFF9 
+ 671      7BA5FFF9 
+ 671      7CA5FF
+ 672 1908 F97CA6FF 		.ascii	"\371|\246\377\371|\246\377\371}\246\377\371}\246\377\371}\247"
+ 672      F97CA6FF 
+ 672      F97DA6FF 
+ 672      F97DA6FF 
+ 672      F97DA7
+ 673 191b FFF97EA7 		.ascii	"\377\371~\247\377\371~\247\377\371\211\253\377\371\212\254\377"
+ 673      FFF97EA7 
+ 673      FFF989AB 
+ 673      FFF98AAC 
+ 673      FF
+ 674 192c F98AACFF 		.ascii	"\371\212\254\377\371\212\254\377\371\213\254\377\371\213\255"
+ 674      F98AACFF 
+ 674      F98BACFF 
+ 674      F98BAD
+ 675 193b FFF98BAD 		.ascii	"\377\371\213\255\377\371\214\255\377\371\214\255\377\371\215"
+ 675      FFF98CAD 
+ 675      FFF98CAD 
+ 675      FFF98D
+ 676 194a AEFFF98D 		.ascii	"\256\377\371\215\256\377\371\215\256\377\371\216\257\377\371"
+ 676      AEFFF98D 
+GAS LISTING /tmp/ccTtNBwq.s 			page 32
+
+
+ 676      AEFFF98E 
+ 676      AFFFF9
+ 677 1959 8EAFFFF9 		.ascii	"\216\257\377\371\216\257\377\371\217\257\377\371\217\260\377"
+ 677      8EAFFFF9 
+ 677      8FAFFFF9 
+ 677      8FB0FF
+ 678 1968 F98FB0FF 		.ascii	"\371\217\260\377\371\220\260\377\371\220\260\377\371\220\261"
+ 678      F990B0FF 
+ 678      F990B0FF 
+ 678      F990B1
+ 679 1977 FFF991B1 		.ascii	"\377\371\221\261\377\371\221\261\377\371\221\261\377\371\222"
+ 679      FFF991B1 
+ 679      FFF991B1 
+ 679      FFF992
+ 680 1986 B2FFF992 		.ascii	"\262\377\371\222\262\377\371\222\262\377\371\223\262\377\371"
+ 680      B2FFF992 
+ 680      B2FFF993 
+ 680      B2FFF9
+ 681 1995 93B3FFF9 		.ascii	"\223\263\377\371\223\263\377\370\224\263\377\370\224\263\377"
+ 681      93B3FFF8 
+ 681      94B3FFF8 
+ 681      94B3FF
+ 682 19a4 F894B4FF 		.ascii	"\370\224\264\377\370\225\264\377\370\225\264\377\370\225\264"
+ 682      F895B4FF 
+ 682      F895B4FF 
+ 682      F895B4
+ 683 19b3 FFF896B4 		.ascii	"\377\370\226\264\377\370\226\265\377\370\226\265\377\370\227"
+ 683      FFF896B5 
+ 683      FFF896B5 
+ 683      FFF897
+ 684 19c2 B5FFF897 		.ascii	"\265\377\370\227\265\377\370\227\266\377\370\230\266\377\370"
+ 684      B5FFF897 
+ 684      B6FFF898 
+ 684      B6FFF8
+ 685 19d1 98B6FFF8 		.ascii	"\230\266\377\370\230\266\377\370\231\267\377\370\231\267\377"
+ 685      98B6FFF8 
+ 685      99B7FFF8 
+ 685      99B7FF
+ 686 19e0 F899B7FF 		.ascii	"\370\231\267\377\370\232\267\377\370\232\270\377\370\232\270"
+ 686      F89AB7FF 
+ 686      F89AB8FF 
+ 686      F89AB8
+ 687 19ef FFF89BB8 		.ascii	"\377\370\233\270\377\370\233\270\377\370\233\271\377\370\234"
+ 687      FFF89BB8 
+ 687      FFF89BB9 
+ 687      FFF89C
+ 688 19fe B9FFF89C 		.ascii	"\271\377\370\234\271\377\370\234\271\377\370\234\272\377\370"
+ 688      B9FFF89C 
+ 688      B9FFF89C 
+ 688      BAFFF8
+ 689 1a0d 9DBAFFF8 		.ascii	"\235\272\377\370\235\272\377\370\235\272\377\370\236\272\377"
+ 689      9DBAFFF8 
+ 689      9DBAFFF8 
+ 689      9EBAFF
+ 690 1a1c F89EBBFF 		.ascii	"\370\236\273\377\367\236\273\377\367\237\273\377\372\237\264"
+ 690      F79EBBFF 
+ 690      F79FBBFF 
+GAS LISTING /tmp/ccTtNBwq.s 			page 33
+
+
+ 690      FA9FB4
+ 691 1a2b FFFA9FB4 		.ascii	"\377\372\237\264\377\372\237\264\377\372\237\264\377\372\240"
+ 691      FFFA9FB4 
+ 691      FFFA9FB4 
+ 691      FFFAA0
+ 692 1a3a B4FFFAA0 		.ascii	"\264\377\372\240\264\377\372\240\264\377\372\240\264\377\372"
+ 692      B4FFFAA0 
+ 692      B4FFFAA0 
+ 692      B4FFFA
+ 693 1a49 A1B4FFFA 		.ascii	"\241\264\377\372\241\265\377\372\241\265\377\372\241\265\377"
+ 693      A1B5FFFA 
+ 693      A1B5FFFA 
+ 693      A1B5FF
+ 694 1a58 FAA2B5FF 		.ascii	"\372\242\265\377\372\242\265\377\372\242\265\377\372\242\265"
+ 694      FAA2B5FF 
+ 694      FAA2B5FF 
+ 694      FAA2B5
+ 695 1a67 FFFAA3B5 		.ascii	"\377\372\243\265\377\372\243\265\377\372\243\265\377\372\243"
+ 695      FFFAA3B5 
+ 695      FFFAA3B5 
+ 695      FFFAA3
+ 696 1a76 B5FFFAA3 		.ascii	"\265\377\372\243\265\377\373\244\265\377\373\244\265\377\373"
+ 696      B5FFFBA4 
+ 696      B5FFFBA4 
+ 696      B5FFFB
+ 697 1a85 A4B5FFFB 		.ascii	"\244\265\377\373\244\265\377\373\245\265\377\373\245\265\377"
+ 697      A4B5FFFB 
+ 697      A5B5FFFB 
+ 697      A5B5FF
+ 698 1a94 FBA5B5FF 		.ascii	"\373\245\265\377\373\245\265\377\373\246\265\377\373\246\265"
+ 698      FBA5B5FF 
+ 698      FBA6B5FF 
+ 698      FBA6B5
+ 699 1aa3 FFFBA6B5 		.ascii	"\377\373\246\265\377\373\246\265\377\373\247\265\377\373\247"
+ 699      FFFBA6B5 
+ 699      FFFBA7B5 
+ 699      FFFBA7
+ 700 1ab2 B5FFFBA7 		.ascii	"\265\377\373\247\265\377\373\247\265\377\373\247\265\377\373"
+ 700      B5FFFBA7 
+ 700      B5FFFBA7 
+ 700      B5FFFB
+ 701 1ac1 A8B5FFFB 		.ascii	"\250\265\377\373\250\265\377\373\250\265\377\373\250\265\377"
+ 701      A8B5FFFB 
+ 701      A8B5FFFB 
+ 701      A8B5FF
+ 702 1ad0 FBA9B5FF 		.ascii	"\373\251\265\377\373\251\265\377\373\251\265\377\373\251\265"
+ 702      FBA9B5FF 
+ 702      FBA9B5FF 
+ 702      FBA9B5
+ 703 1adf FFFBAAB5 		.ascii	"\377\373\252\265\377\373\252\266\377\373\252\266\377\373\252"
+ 703      FFFBAAB6 
+ 703      FFFBAAB6 
+ 703      FFFBAA
+ 704 1aee B6FFFBAB 		.ascii	"\266\377\373\253\266\377\373\253\266\377\373\253\266\377\373"
+ 704      B6FFFBAB 
+ 704      B6FFFBAB 
+ 704      B6FFFB
+GAS LISTING /tmp/ccTtNBwq.s 			page 34
+
+
+ 705 1afd ABB6FFFB 		.ascii	"\253\266\377\373\254\266\377\373\254\266\377\373\254\266\377"
+ 705      ACB6FFFB 
+ 705      ACB6FFFB 
+ 705      ACB6FF
+ 706 1b0c FBACB6FF 		.ascii	"\373\254\266\377\373\254\266\377\373\255\266\377\373\255\266"
+ 706      FBACB6FF 
+ 706      FBADB6FF 
+ 706      FBADB6
+ 707 1b1b FFFBADB6 		.ascii	"\377\373\255\266\377\373\255\266\377\374\265\271\377\374\266"
+ 707      FFFBADB6 
+ 707      FFFCB5B9 
+ 707      FFFCB6
+ 708 1b2a B9FFFCB6 		.ascii	"\271\377\374\266\271\377\374\266\271\377\374\266\271\377\374"
+ 708      B9FFFCB6 
+ 708      B9FFFCB6 
+ 708      B9FFFC
+ 709 1b39 B6B9FFFC 		.ascii	"\266\271\377\374\267\271\377\374\267\271\377\374\267\271\377"
+ 709      B7B9FFFC 
+ 709      B7B9FFFC 
+ 709      B7B9FF
+ 710 1b48 FCB7B9FF 		.ascii	"\374\267\271\377\374\270\271\377\374\270\271\377\374\270\272"
+ 710      FCB8B9FF 
+ 710      FCB8B9FF 
+ 710      FCB8BA
+ 711 1b57 FFFCB8BA 		.ascii	"\377\374\270\272\377\374\271\272\377\374\271\272\377\374\271"
+ 711      FFFCB9BA 
+ 711      FFFCB9BA 
+ 711      FFFCB9
+ 712 1b66 BAFFFCB9 		.ascii	"\272\377\374\271\272\377\374\272\272\377\374\272\272\377\374"
+ 712      BAFFFCBA 
+ 712      BAFFFCBA 
+ 712      BAFFFC
+ 713 1b75 BABAFFFC 		.ascii	"\272\272\377\374\272\272\377\374\273\272\377\374\273\273\377"
+ 713      BABAFFFC 
+ 713      BBBAFFFC 
+ 713      BBBBFF
+ 714 1b84 FCBBBBFF 		.ascii	"\374\273\273\377\374\273\273\377\374\273\273\377\374\274\273"
+ 714      FCBBBBFF 
+ 714      FCBBBBFF 
+ 714      FCBCBB
+ 715 1b93 FFFCBCBB 		.ascii	"\377\374\274\273\377\374\274\273\377\374\274\273\377\374\275"
+ 715      FFFCBCBB 
+ 715      FFFCBCBB 
+ 715      FFFCBD
+ 716 1ba2 BBFFFCBD 		.ascii	"\273\377\374\275\273\377\374\275\274\377\374\275\274\377\374"
+ 716      BBFFFCBD 
+ 716      BCFFFCBD 
+ 716      BCFFFC
+ 717 1bb1 BEBCFFFC 		.ascii	"\276\274\377\374\276\274\377\374\276\274\377\374\276\274\377"
+ 717      BEBCFFFC 
+ 717      BEBCFFFC 
+ 717      BEBCFF
+ 718 1bc0 FCBFBCFF 		.ascii	"\374\277\274\377\374\277\274\377\374\277\274\377\374\277\275"
+ 718      FCBFBCFF 
+ 718      FCBFBCFF 
+ 718      FCBFBD
+ 719 1bcf FFFCC0BD 		.ascii	"\377\374\300\275\377\374\300\275\377\374\300\275\377\374\300"
+GAS LISTING /tmp/ccTtNBwq.s 			page 35
+
+
+ 719      FFFCC0BD 
+ 719      FFFCC0BD 
+ 719      FFFCC0
+ 720 1bde BDFFFCC0 		.ascii	"\275\377\374\300\275\377\374\301\275\377\374\301\275\377\374"
+ 720      BDFFFCC1 
+ 720      BDFFFCC1 
+ 720      BDFFFC
+ 721 1bed C1BEFFFC 		.ascii	"\301\276\377\374\301\276\377\374\302\276\377\374\302\276\377"
+ 721      C1BEFFFC 
+ 721      C2BEFFFC 
+ 721      C2BEFF
+ 722 1bfc FCC2BEFF 		.ascii	"\374\302\276\377\374\302\276\377\374\303\276\377\374\303\277"
+ 722      FCC2BEFF 
+ 722      FCC3BEFF 
+ 722      FCC3BF
+ 723 1c0b FFFCC3BF 		.ascii	"\377\374\303\277\377\374\303\277\377\374\304\277\377\374\304"
+ 723      FFFCC3BF 
+ 723      FFFCC4BF 
+ 723      FFFCC4
+ 724 1c1a BFFFFCC4 		.ascii	"\277\377\374\304\277\377\374\304\277\377\373\305\277\377\374"
+ 724      BFFFFCC4 
+ 724      BFFFFBC5 
+ 724      BFFFFC
+ 725 1c29 C5C0FFFC 		.ascii	"\305\300\377\374\305\300\377\374\305\300\377\374\305\300\377"
+ 725      C5C0FFFC 
+ 725      C5C0FFFC 
+ 725      C5C0FF
+ 726 1c38 FCC5C0FF 		.ascii	"\374\305\300\377\374\306\301\377\374\306\301\377\374\306\301"
+ 726      FCC6C1FF 
+ 726      FCC6C1FF 
+ 726      FCC6C1
+ 727 1c47 FFFCC6C1 		.ascii	"\377\374\306\301\377\374\306\301\377\374\306\301\377\374\307"
+ 727      FFFCC6C1 
+ 727      FFFCC6C1 
+ 727      FFFCC7
+ 728 1c56 C2FFFCC7 		.ascii	"\302\377\374\307\302\377\374\307\302\377\374\307\302\377\374"
+ 728      C2FFFCC7 
+ 728      C2FFFCC7 
+ 728      C2FFFC
+ 729 1c65 C7C2FFFC 		.ascii	"\307\302\377\374\307\303\377\374\310\303\377\374\310\303\377"
+ 729      C7C3FFFC 
+ 729      C8C3FFFC 
+ 729      C8C3FF
+ 730 1c74 FCC8C3FF 		.ascii	"\374\310\303\377\374\310\303\377\374\310\303\377\374\310\304"
+ 730      FCC8C3FF 
+ 730      FCC8C3FF 
+ 730      FCC8C4
+ 731 1c83 FFFCC9C4 		.ascii	"\377\374\311\304\377\374\311\304\377\374\311\304\377\374\311"
+ 731      FFFCC9C4 
+ 731      FFFCC9C4 
+ 731      FFFCC9
+ 732 1c92 C4FFFCC9 		.ascii	"\304\377\374\311\305\377\374\311\305\377\374\312\305\377\374"
+ 732      C5FFFCC9 
+ 732      C5FFFCCA 
+ 732      C5FFFC
+ 733 1ca1 CAC5FFFC 		.ascii	"\312\305\377\374\312\305\377\374\312\305\377\374\312\306\377"
+ 733      CAC5FFFC 
+GAS LISTING /tmp/ccTtNBwq.s 			page 36
+
+
+ 733      CAC5FFFC 
+ 733      CAC6FF
+ 734 1cb0 FCCAC6FF 		.ascii	"\374\312\306\377\374\313\306\377\374\313\306\377\374\313\306"
+ 734      FCCBC6FF 
+ 734      FCCBC6FF 
+ 734      FCCBC6
+ 735 1cbf FFFCCBC6 		.ascii	"\377\374\313\306\377\374\313\307\377\374\313\307\377\374\314"
+ 735      FFFCCBC7 
+ 735      FFFCCBC7 
+ 735      FFFCCC
+ 736 1cce C7FFFCCC 		.ascii	"\307\377\374\314\307\377\374\314\307\377\374\314\310\377\374"
+ 736      C7FFFCCC 
+ 736      C7FFFCCC 
+ 736      C8FFFC
+ 737 1cdd CCC8FFFC 		.ascii	"\314\310\377\374\314\310\377\374\315\310\377\374\315\310\377"
+ 737      CCC8FFFC 
+ 737      CDC8FFFC 
+ 737      CDC8FF
+ 738 1cec FCCDC8FF 		.ascii	"\374\315\310\377\374\315\311\377\374\315\311\377\374\315\311"
+ 738      FCCDC9FF 
+ 738      FCCDC9FF 
+ 738      FCCDC9
+ 739 1cfb FFFCCEC9 		.ascii	"\377\374\316\311\377\374\316\311\377\374\316\312\377\374\316"
+ 739      FFFCCEC9 
+ 739      FFFCCECA 
+ 739      FFFCCE
+ 740 1d0a CAFFFCCE 		.ascii	"\312\377\374\316\312\377\374\316\312\377\374\317\312\377\374"
+ 740      CAFFFCCE 
+ 740      CAFFFCCF 
+ 740      CAFFFC
+ 741 1d19 CFCAFFFC 		.ascii	"\317\312\377\374\317\313\377\374\317\313\377\374\325\321\377"
+ 741      CFCBFFFC 
+ 741      CFCBFFFC 
+ 741      D5D1FF
+ 742 1d28 FCD5D1FF 		.ascii	"\374\325\321\377\374\325\321\377\374\325\321\377\374\325\322"
+ 742      FCD5D1FF 
+ 742      FCD5D1FF 
+ 742      FCD5D2
+ 743 1d37 FFFCD6D2 		.ascii	"\377\374\326\322\377\374\326\322\377\374\326\322\377\374\326"
+ 743      FFFCD6D2 
+ 743      FFFCD6D2 
+ 743      FFFCD6
+ 744 1d46 D2FFFCD6 		.ascii	"\322\377\374\326\322\377\374\326\323\377\374\327\323\377\374"
+ 744      D2FFFCD6 
+ 744      D3FFFCD7 
+ 744      D3FFFC
+ 745 1d55 D7D3FFFC 		.ascii	"\327\323\377\374\327\323\377\374\327\323\377\374\327\324\377"
+ 745      D7D3FFFC 
+ 745      D7D3FFFC 
+ 745      D7D4FF
+ 746 1d64 FCD7D4FF 		.ascii	"\374\327\324\377\374\330\324\377\374\330\324\377\374\330\324"
+ 746      FCD8D4FF 
+ 746      FCD8D4FF 
+ 746      FCD8D4
+ 747 1d73 FFFCD8D4 		.ascii	"\377\374\330\324\377\374\330\325\377\374\330\325\377\374\331"
+ 747      FFFCD8D5 
+ 747      FFFCD8D5 
+GAS LISTING /tmp/ccTtNBwq.s 			page 37
+
+
+ 747      FFFCD9
+ 748 1d82 D5FFFCD9 		.ascii	"\325\377\374\331\325\377\374\331\325\377\374\331\326\377\374"
+ 748      D5FFFCD9 
+ 748      D5FFFCD9 
+ 748      D6FFFC
+ 749 1d91 D9D6FFFC 		.ascii	"\331\326\377\374\331\326\377\374\332\326\377\374\332\326\377"
+ 749      D9D6FFFC 
+ 749      DAD6FFFC 
+ 749      DAD6FF
+ 750 1da0 FCDAD6FF 		.ascii	"\374\332\326\377\374\332\327\377\374\332\327\377\374\332\327"
+ 750      FCDAD7FF 
+ 750      FCDAD7FF 
+ 750      FCDAD7
+ 751 1daf FFFCDBD7 		.ascii	"\377\374\333\327\377\374\333\327\377\374\333\330\377\374\333"
+ 751      FFFCDBD7 
+ 751      FFFCDBD8 
+ 751      FFFCDB
+ 752 1dbe D8FFFCDB 		.ascii	"\330\377\374\333\330\377\374\333\330\377\374\334\330\377\374"
+ 752      D8FFFCDB 
+ 752      D8FFFCDC 
+ 752      D8FFFC
+ 753 1dcd DCD8FFFC 		.ascii	"\334\330\377\374\334\331\377\374\334\331\377\375\334\331\377"
+ 753      DCD9FFFC 
+ 753      DCD9FFFD 
+ 753      DCD9FF
+ 754 1ddc FDDCD9FF 		.ascii	"\375\334\331\377\375\335\331\377\375\335\332\377\375\335\332"
+ 754      FDDDD9FF 
+ 754      FDDDDAFF 
+ 754      FDDDDA
+ 755 1deb FFFDDDDA 		.ascii	"\377\375\335\332\377\375\335\332\377\375\335\332\377\375\336"
+ 755      FFFDDDDA 
+ 755      FFFDDDDA 
+ 755      FFFDDE
+ 756 1dfa DAFFFDDE 		.ascii	"\332\377\375\336\333\377\375\336\333\377\375\336\333\377\375"
+ 756      DBFFFDDE 
+ 756      DBFFFDDE 
+ 756      DBFFFD
+ 757 1e09 DEDBFFFD 		.ascii	"\336\333\377\375\336\333\377\375\337\334\377\375\337\334\377"
+ 757      DEDBFFFD 
+ 757      DFDCFFFD 
+ 757      DFDCFF
+ 758 1e18 FDDFDCFF 		.ascii	"\375\337\334\377\375\337\334\377\375\337\334\377\374\340\334"
+ 758      FDDFDCFF 
+ 758      FDDFDCFF 
+ 758      FCE0DC
+ 759 1e27 FFFDE0DD 		.ascii	"\377\375\340\335\377\375\340\335\377\375\340\335\377\375\340"
+ 759      FFFDE0DD 
+ 759      FFFDE0DD 
+ 759      FFFDE0
+ 760 1e36 DDFFFDE0 		.ascii	"\335\377\375\340\335\377\375\340\335\377\375\341\335\377\375"
+ 760      DDFFFDE0 
+ 760      DDFFFDE1 
+ 760      DDFFFD
+ 761 1e45 E1DDFFFD 		.ascii	"\341\335\377\375\341\335\377\375\341\336\377\375\341\336\377"
+ 761      E1DDFFFD 
+ 761      E1DEFFFD 
+ 761      E1DEFF
+GAS LISTING /tmp/ccTtNBwq.s 			page 38
+
+
+ 762 1e54 FDE1DEFF 		.ascii	"\375\341\336\377\375\341\336\377\375\342\336\377\375\342\336"
+ 762      FDE1DEFF 
+ 762      FDE2DEFF 
+ 762      FDE2DE
+ 763 1e63 FFFDE2DE 		.ascii	"\377\375\342\336\377\375\342\336\377\375\342\336\377\375\342"
+ 763      FFFDE2DE 
+ 763      FFFDE2DE 
+ 763      FFFDE2
+ 764 1e72 DEFFFDE2 		.ascii	"\336\377\375\342\337\377\375\343\337\377\375\343\337\377\375"
+ 764      DFFFFDE3 
+ 764      DFFFFDE3 
+ 764      DFFFFD
+ 765 1e81 E3DFFFFD 		.ascii	"\343\337\377\375\343\337\377\375\343\337\377\375\343\337\377"
+ 765      E3DFFFFD 
+ 765      E3DFFFFD 
+ 765      E3DFFF
+ 766 1e90 FDE3DFFF 		.ascii	"\375\343\337\377\375\344\337\377\375\344\340\377\375\344\340"
+ 766      FDE4DFFF 
+ 766      FDE4E0FF 
+ 766      FDE4E0
+ 767 1e9f FFFDE4E0 		.ascii	"\377\375\344\340\377\375\344\340\377\375\344\340\377\375\344"
+ 767      FFFDE4E0 
+ 767      FFFDE4E0 
+ 767      FFFDE4
+ 768 1eae E0FFFDE5 		.ascii	"\340\377\375\345\340\377\375\345\340\377\375\345\341\377\375"
+ 768      E0FFFDE5 
+ 768      E0FFFDE5 
+ 768      E1FFFD
+ 769 1ebd E5E1FFFD 		.ascii	"\345\341\377\375\345\341\377\375\345\341\377\375\346\341\377"
+ 769      E5E1FFFD 
+ 769      E5E1FFFD 
+ 769      E6E1FF
+ 770 1ecc FDE6E1FF 		.ascii	"\375\346\341\377\375\346\341\377\375\346\341\377\375\346\342"
+ 770      FDE6E1FF 
+ 770      FDE6E1FF 
+ 770      FDE6E2
+ 771 1edb FFFDE6E2 		.ascii	"\377\375\346\342\377\375\346\342\377\375\347\342\377\375\347"
+ 771      FFFDE6E2 
+ 771      FFFDE7E2 
+ 771      FFFDE7
+ 772 1eea E2FFFDE7 		.ascii	"\342\377\375\347\342\377\375\347\342\377\375\347\342\377\375"
+ 772      E2FFFDE7 
+ 772      E2FFFDE7 
+ 772      E2FFFD
+ 773 1ef9 E7E3FFFD 		.ascii	"\347\343\377\375\347\343\377\375\350\343\377\375\350\343\377"
+ 773      E7E3FFFD 
+ 773      E8E3FFFD 
+ 773      E8E3FF
+ 774 1f08 FDE8E3FF 		.ascii	"\375\350\343\377\375\350\343\377\375\350\343\377\375\350\344"
+ 774      FDE8E3FF 
+ 774      FDE8E3FF 
+ 774      FDE8E4
+ 775 1f17 FFFDE8E4 		.ascii	"\377\375\350\344\377\375\351\344\377\375\351\344\377\376\355"
+ 775      FFFDE9E4 
+ 775      FFFDE9E4 
+ 775      FFFEED
+ 776 1f26 E8FFFEEE 		.ascii	"\350\377\376\356\351\377\376\356\351\377\376\356\351\377\376"
+GAS LISTING /tmp/ccTtNBwq.s 			page 39
+
+
+ 776      E9FFFEEE 
+ 776      E9FFFEEE 
+ 776      E9FFFE
+ 777 1f35 EEE9FFFE 		.ascii	"\356\351\377\376\356\351\377\376\356\351\377\376\356\351\377"
+ 777      EEE9FFFE 
+ 777      EEE9FFFE 
+ 777      EEE9FF
+ 778 1f44 FEEFEAFF 		.ascii	"\376\357\352\377\376\357\352\377\376\357\352\377\376\357\352"
+ 778      FEEFEAFF 
+ 778      FEEFEAFF 
+ 778      FEEFEA
+ 779 1f53 FFFEEFEA 		.ascii	"\377\376\357\352\377\376\357\352\377\376\357\352\377\376\360"
+ 779      FFFEEFEA 
+ 779      FFFEEFEA 
+ 779      FFFEF0
+ 780 1f62 EBFFFEF0 		.ascii	"\353\377\376\360\353\377\376\360\353\377\376\360\353\377\376"
+ 780      EBFFFEF0 
+ 780      EBFFFEF0 
+ 780      EBFFFE
+ 781 1f71 F0EBFFFE 		.ascii	"\360\353\377\376\360\353\377\376\360\354\377\376\361\354\377"
+ 781      F0EBFFFE 
+ 781      F0ECFFFE 
+ 781      F1ECFF
+ 782 1f80 FEF1ECFF 		.ascii	"\376\361\354\377\376\361\354\377\376\361\354\377\376\361\354"
+ 782      FEF1ECFF 
+ 782      FEF1ECFF 
+ 782      FEF1EC
+ 783 1f8f FFFEF1EC 		.ascii	"\377\376\361\354\377\376\361\355\377\376\362\355\377\376\362"
+ 783      FFFEF1ED 
+ 783      FFFEF2ED 
+ 783      FFFEF2
+ 784 1f9e EDFFFEF2 		.ascii	"\355\377\376\362\355\377\376\362\355\377\376\362\355\377\376"
+ 784      EDFFFEF2 
+ 784      EDFFFEF2 
+ 784      EDFFFE
+ 785 1fad F2EEFFFE 		.ascii	"\362\356\377\376\362\356\377\376\363\356\377\376\363\356\377"
+ 785      F2EEFFFE 
+ 785      F3EEFFFE 
+ 785      F3EEFF
+ 786 1fbc FEF3EEFF 		.ascii	"\376\363\356\377"
+ 787 1fc0 FEF3EEFF 		.ascii	"\376\363\356\377\376\363\356\377\376\363\357\377\376\363\357"
+ 787      FEF3EEFF 
+ 787      FEF3EFFF 
+ 787      FEF3EF
+ 788 1fcf FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 788      FFFEF4EF 
+ 788      FFFEF4EF 
+ 788      FFFEF4
+ 789 1fde EFFFFEF4 		.ascii	"\357\377\376\364\360\377\376\364\360\377\376\364\360\377\376"
+ 789      F0FFFEF4 
+ 789      F0FFFEF4 
+ 789      F0FFFE
+ 790 1fed F5F0FFFE 		.ascii	"\365\360\377\376\365\360\377\376\365\360\377\376\365\361\377"
+ 790      F5F0FFFE 
+ 790      F5F0FFFE 
+ 790      F5F1FF
+ 791 1ffc FEF5F1FF 		.ascii	"\376\365\361\377\376\365\361\377\376\365\361\377\376\366\361"
+GAS LISTING /tmp/ccTtNBwq.s 			page 40
+
+
+ 791      FEF5F1FF 
+ 791      FEF5F1FF 
+ 791      FEF6F1
+ 792 200b FFFEF6F1 		.ascii	"\377\376\366\361\377\376\366\362\377\376\366\362\377\376\366"
+ 792      FFFEF6F2 
+ 792      FFFEF6F2 
+ 792      FFFEF6
+ 793 201a F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377"
+ 793      F2FFFEF6 
+ 793      F2FF
+ 794              		.globl	heatmap_cs_RdPu_soft
+ 795              		.section	.data.rel.local
+ 796              		.align 8
+ 797              		.type	heatmap_cs_RdPu_soft, @object
+ 798              		.size	heatmap_cs_RdPu_soft, 8
+ 799              	heatmap_cs_RdPu_soft:
+ 800 0010 00000000 		.quad	soft
+ 800      00000000 
+ 801              		.section	.data.rel.ro.local
+ 802              		.align 16
+ 803              		.type	soft, @object
+ 804              		.size	soft, 16
+ 805              	soft:
+ 806 0020 00000000 		.quad	soft_data
+ 806      00000000 
+ 807 0028 01040000 		.quad	1025
+ 807      00000000 
+ 808              		.section	.rodata
+ 809 2024 00000000 		.align 32
+ 809      00000000 
+ 809      00000000 
+ 809      00000000 
+ 809      00000000 
+ 810              		.type	soft_data, @object
+ 811              		.size	soft_data, 4100
+ 812              	soft_data:
+ 813 2040 00       		.string	""
+ 814 2041 00       		.string	""
+ 815 2042 00       		.string	""
+ 816 2043 00       		.string	""
+ 817 2044 4800     		.string	"H"
+ 818 2046 6A00     		.string	"j"
+ 819 2048 4900     		.string	"I"
+ 820 204a 6A074900 		.string	"j\007I"
+ 821 204e 6A0E4A00 		.string	"j\016J"
+ 822 2052 6A164A00 		.string	"j\026J"
+ 823 2056 6A1D4A00 		.string	"j\035J"
+ 824 205a 6A254B00 		.string	"j%K"
+ 825 205e 6A2C4B00 		.string	"j,K"
+ 826 2062 6A344C00 		.string	"j4L"
+ 827 2066 6A3B4C00 		.string	"j;L"
+ 828 206a 6B434C00 		.string	"kCL"
+ 829 206e 6B4A4D00 		.string	"kJM"
+ 830 2072 6B524D00 		.string	"kRM"
+ 831 2076 6B594E00 		.string	"kYN"
+ 832 207a 6B614E00 		.string	"kaN"
+ 833 207e 6B684E00 		.string	"khN"
+GAS LISTING /tmp/ccTtNBwq.s 			page 41
+
+
+ 834 2082 6B704F00 		.string	"kpO"
+ 835 2086 6B774F00 		.string	"kwO"
+ 836 208a 6B7F5000 		.string	"k\177P"
+ 837 208e 6C865000 		.string	"l\206P"
+ 838 2092 6C8D5000 		.string	"l\215P"
+ 839 2096 6C955100 		.string	"l\225Q"
+ 840 209a 6C9C5100 		.string	"l\234Q"
+ 841 209e 6CA45200 		.string	"l\244R"
+ 842 20a2 6CAB5200 		.string	"l\253R"
+ 843 20a6 6CB35200 		.string	"l\263R"
+ 844 20aa 6CBA5300 		.string	"l\272S"
+ 845 20ae 6CC25300 		.string	"l\302S"
+ 846 20b2 6DC95400 		.string	"m\311T"
+ 847 20b6 6DD15400 		.string	"m\321T"
+ 848 20ba 6DD85400 		.string	"m\330T"
+ 849 20be 6DE05500 		.string	"m\340U"
+ 850 20c2 6DE75500 		.string	"m\347U"
+ 851 20c6 6DEF5600 		.string	"m\357V"
+ 852 20ca 6DF65600 		.string	"m\366V"
+ 853 20ce 6DFE5600 		.string	"m\376V"
+ 854 20d2 6DFF5700 		.string	"m\377W"
+ 855 20d6 6EFF5700 		.string	"n\377W"
+ 856 20da 6EFF5700 		.string	"n\377W"
+ 857 20de 6EFF5800 		.string	"n\377X"
+ 858 20e2 6EFF5800 		.string	"n\377X"
+ 859 20e6 6EFF5900 		.string	"n\377Y"
+ 860 20ea 6EFF5900 		.string	"n\377Y"
+ 861 20ee 6EFF5900 		.string	"n\377Y"
+ 862 20f2 6EFF5A00 		.string	"n\377Z"
+ 863 20f6 6EFF5A00 		.string	"n\377Z"
+ 864 20fa 6FFF5B00 		.string	"o\377["
+ 865 20fe 6FFF5B00 		.string	"o\377["
+ 866 2102 6FFF5B00 		.string	"o\377["
+ 867 2106 6FFF5C00 		.string	"o\377\\"
+ 868 210a 6FFF5C00 		.string	"o\377\\"
+ 869 210e 6FFF5C00 		.string	"o\377\\"
+ 870 2112 6FFF5D00 		.string	"o\377]"
+ 871 2116 6FFF5D00 		.string	"o\377]"
+ 872 211a 6FFF5E00 		.string	"o\377^"
+ 873 211e 6FFF5E00 		.string	"o\377^"
+ 874 2122 70FF5E00 		.string	"p\377^"
+ 875 2126 70FF5F00 		.string	"p\377_"
+ 876 212a 70FF5F00 		.string	"p\377_"
+ 877 212e 70FF6000 		.string	"p\377`"
+ 878 2132 70FF6000 		.string	"p\377`"
+ 879 2136 70FF6000 		.string	"p\377`"
+ 880 213a 70FF6100 		.string	"p\377a"
+ 881 213e 70FF6100 		.string	"p\377a"
+ 882 2142 70FF6100 		.string	"p\377a"
+ 883 2146 70FF6200 		.string	"p\377b"
+ 884 214a 71FF6200 		.string	"q\377b"
+ 885 214e 71FF6300 		.string	"q\377c"
+ 886 2152 71FF6300 		.string	"q\377c"
+ 887 2156 71FF6300 		.string	"q\377c"
+ 888 215a 71FF6400 		.string	"q\377d"
+ 889 215e 71FF6400 		.string	"q\377d"
+ 890 2162 71FF6400 		.string	"q\377d"
+GAS LISTING /tmp/ccTtNBwq.s 			page 42
+
+
+ 891 2166 71FF6500 		.string	"q\377e"
+ 892 216a 71FF6500 		.string	"q\377e"
+ 893 216e 71FF6600 		.string	"q\377f"
+ 894 2172 72FF6600 		.string	"r\377f"
+ 895 2176 72FF6600 		.string	"r\377f"
+ 896 217a 72FF6700 		.string	"r\377g"
+ 897 217e 72FF6700 		.string	"r\377g"
+ 898 2182 72FF6800 		.string	"r\377h"
+ 899 2186 72FF6800 		.string	"r\377h"
+ 900 218a 72FF6800 		.string	"r\377h"
+ 901 218e 72FF6900 		.string	"r\377i"
+ 902 2192 72FF6900 		.string	"r\377i"
+ 903 2196 72FF6900 		.string	"r\377i"
+ 904 219a 73FF6A00 		.string	"s\377j"
+ 905 219e 73FF6A00 		.string	"s\377j"
+ 906 21a2 73FF6B00 		.string	"s\377k"
+ 907 21a6 73FF6B00 		.string	"s\377k"
+ 908 21aa 73FF6B00 		.string	"s\377k"
+ 909 21ae 73FF6C00 		.string	"s\377l"
+ 910 21b2 73FF6C00 		.string	"s\377l"
+ 911 21b6 73FF6C00 		.string	"s\377l"
+ 912 21ba 73FF6D00 		.string	"s\377m"
+ 913 21be 73FF6D00 		.string	"s\377m"
+ 914 21c2 74FF6E00 		.string	"t\377n"
+ 915 21c6 74FF6E00 		.string	"t\377n"
+ 916 21ca 74FF6E00 		.string	"t\377n"
+ 917 21ce 74FF6F00 		.string	"t\377o"
+ 918 21d2 74FF6F00 		.string	"t\377o"
+ 919 21d6 74FF6F00 		.string	"t\377o"
+ 920 21da 74FF7000 		.string	"t\377p"
+ 921 21de 74FF7000 		.string	"t\377p"
+ 922 21e2 74FF7100 		.string	"t\377q"
+ 923 21e6 74FF7100 		.string	"t\377q"
+ 924 21ea 74FF7100 		.string	"t\377q"
+ 925 21ee 75FF7200 		.string	"u\377r"
+ 926 21f2 75FF7200 		.string	"u\377r"
+ 927 21f6 75FF7200 		.string	"u\377r"
+ 928 21fa 75FF7300 		.string	"u\377s"
+ 929 21fe 75FF7300 		.string	"u\377s"
+ 930 2202 75FF7400 		.string	"u\377t"
+ 931 2206 75FF7400 		.string	"u\377t"
+ 932 220a 75FF7400 		.string	"u\377t"
+ 933 220e 75FF7500 		.string	"u\377u"
+ 934 2212 75FF7500 		.string	"u\377u"
+ 935 2216 75FF7500 		.string	"u\377u"
+ 936 221a 76FF7600 		.string	"v\377v"
+ 937 221e 76FF7600 		.string	"v\377v"
+ 938 2222 76FF7700 		.string	"v\377w"
+ 939 2226 76FF7700 		.string	"v\377w"
+ 940 222a 76FF7700 		.string	"v\377w"
+ 941 222e 76FF7800 		.string	"v\377x"
+ 942 2232 76FF7800 		.string	"v\377x"
+ 943 2236 76FF7800 		.string	"v\377x"
+ 944 223a 76FF7900 		.string	"v\377y"
+ 945 223e 76FF7900 		.string	"v\377y"
+ 946 2242 76FF7901 		.string	"v\377y\001w\377z"
+ 946      77FF7A00 
+GAS LISTING /tmp/ccTtNBwq.s 			page 43
+
+
+ 947 224a 77FF7A00 		.string	"w\377z"
+ 948 224e 77FF7B00 		.string	"w\377{"
+ 949 2252 77FF7B00 		.string	"w\377{"
+ 950 2256 77FF7C00 		.string	"w\377|"
+ 951 225a 77FF7C00 		.string	"w\377|"
+ 952 225e 77FF7C00 		.string	"w\377|"
+ 953 2262 77FF7D00 		.string	"w\377}"
+ 954 2266 77FF7D00 		.string	"w\377}"
+ 955 226a 77FF7E00 		.string	"w\377~"
+ 956 226e 77FF7E00 		.string	"w\377~"
+ 957 2272 77FF7E00 		.string	"w\377~"
+ 958 2276 77FF7F00 		.string	"w\377\177"
+ 959 227a 77FF7F00 		.string	"w\377\177"
+ 960 227e 78FF8000 		.string	"x\377\200"
+ 961 2282 78FF8000 		.string	"x\377\200"
+ 962 2286 78FF8100 		.string	"x\377\201"
+ 963 228a 78FF8100 		.string	"x\377\201"
+ 964 228e 78FF8100 		.string	"x\377\201"
+ 965 2292 78FF8200 		.string	"x\377\202"
+ 966 2296 78FF8200 		.string	"x\377\202"
+ 967 229a 78FF8300 		.string	"x\377\203"
+ 968 229e 78FF8300 		.string	"x\377\203"
+ 969 22a2 78FF8300 		.string	"x\377\203"
+ 970 22a6 78FF8400 		.string	"x\377\204"
+ 971 22aa 78FF8400 		.string	"x\377\204"
+ 972 22ae 78FF8500 		.string	"x\377\205"
+ 973 22b2 79FF8500 		.string	"y\377\205"
+ 974 22b6 79FF8500 		.string	"y\377\205"
+ 975 22ba 79FF8600 		.string	"y\377\206"
+ 976 22be 79FF8600 		.string	"y\377\206"
+ 977 22c2 79FF8700 		.string	"y\377\207"
+ 978 22c6 79FF8700 		.string	"y\377\207"
+ 979 22ca 79FF8800 		.string	"y\377\210"
+ 980 22ce 79FF8800 		.string	"y\377\210"
+ 981 22d2 79FF8800 		.string	"y\377\210"
+ 982 22d6 79FF8900 		.string	"y\377\211"
+ 983 22da 79FF8900 		.string	"y\377\211"
+ 984 22de 79FF8A00 		.string	"y\377\212"
+ 985 22e2 79FF8A00 		.string	"y\377\212"
+ 986 22e6 79FF8A00 		.string	"y\377\212"
+ 987 22ea 79FF8B00 		.string	"y\377\213"
+ 988 22ee 79FF8B00 		.string	"y\377\213"
+ 989 22f2 7AFF8C00 		.string	"z\377\214"
+ 990 22f6 7AFF8C00 		.string	"z\377\214"
+ 991 22fa 7AFF8C00 		.string	"z\377\214"
+ 992 22fe 7AFF8D00 		.string	"z\377\215"
+ 993 2302 7AFF8D00 		.string	"z\377\215"
+ 994 2306 7AFF8E00 		.string	"z\377\216"
+ 995 230a 7AFF8E00 		.string	"z\377\216"
+ 996 230e 7AFF8E00 		.string	"z\377\216"
+ 997 2312 7AFF8F00 		.string	"z\377\217"
+ 998 2316 7AFF8F00 		.string	"z\377\217"
+ 999 231a 7AFF9000 		.string	"z\377\220"
+ 1000 231e 7AFF9000 		.string	"z\377\220"
+ 1001 2322 7AFF9100 		.string	"z\377\221"
+ 1002 2326 7AFF9100 		.string	"z\377\221"
+ 1003 232a 7AFF9100 		.string	"z\377\221"
+GAS LISTING /tmp/ccTtNBwq.s 			page 44
+
+
+ 1004 232e 7AFF9200 		.string	"z\377\222"
+ 1005 2332 7BFF9200 		.string	"{\377\222"
+ 1006 2336 7BFF9300 		.string	"{\377\223"
+ 1007 233a 7BFF9300 		.string	"{\377\223"
+ 1008 233e 7BFF9300 		.string	"{\377\223"
+ 1009 2342 7BFF9400 		.string	"{\377\224"
+ 1010 2346 7BFF9400 		.string	"{\377\224"
+ 1011 234a 7BFF9500 		.string	"{\377\225"
+ 1012 234e 7BFF9500 		.string	"{\377\225"
+ 1013 2352 7BFF9500 		.string	"{\377\225"
+ 1014 2356 7BFF9600 		.string	"{\377\226"
+ 1015 235a 7BFF9600 		.string	"{\377\226"
+ 1016 235e 7BFF9700 		.string	"{\377\227"
+ 1017 2362 7BFF9700 		.string	"{\377\227"
+ 1018 2366 7BFF9700 		.string	"{\377\227"
+ 1019 236a 7BFF9800 		.string	"{\377\230"
+ 1020 236e 7BFF9800 		.string	"{\377\230"
+ 1021 2372 7BFF9900 		.string	"{\377\231"
+ 1022 2376 7BFF9900 		.string	"{\377\231"
+ 1023 237a 7BFF9900 		.string	"{\377\231"
+ 1024 237e 7CFF9A00 		.string	"|\377\232"
+ 1025 2382 7CFF9A00 		.string	"|\377\232"
+ 1026 2386 7CFF9B00 		.string	"|\377\233"
+ 1027 238a 7CFF9B00 		.string	"|\377\233"
+ 1028 238e 7CFF9B00 		.string	"|\377\233"
+ 1029 2392 7CFF9C00 		.string	"|\377\234"
+ 1030 2396 7CFF9C00 		.string	"|\377\234"
+ 1031 239a 7CFF9D00 		.string	"|\377\235"
+ 1032 239e 7CFF9D00 		.string	"|\377\235"
+ 1033 23a2 7CFF9E00 		.string	"|\377\236"
+ 1034 23a6 7CFF9E00 		.string	"|\377\236"
+ 1035 23aa 7CFF9E00 		.string	"|\377\236"
+ 1036 23ae 7CFF9F00 		.string	"|\377\237"
+ 1037 23b2 7CFF9F00 		.string	"|\377\237"
+ 1038 23b6 7CFFA000 		.string	"|\377\240"
+ 1039 23ba 7CFFA000 		.string	"|\377\240"
+ 1040 23be 7CFFA000 		.string	"|\377\240"
+ 1041 23c2 7CFFA100 		.string	"|\377\241"
+ 1042 23c6 7CFFA100 		.string	"|\377\241"
+ 1043 23ca 7CFFA200 		.string	"|\377\242"
+ 1044 23ce 7CFFA200 		.string	"|\377\242"
+ 1045 23d2 7CFFA200 		.string	"|\377\242"
+ 1046 23d6 7DFFA300 		.string	"}\377\243"
+ 1047 23da 7DFFA300 		.string	"}\377\243"
+ 1048 23de 7DFFA400 		.string	"}\377\244"
+ 1049 23e2 7DFFA400 		.string	"}\377\244"
+ 1050 23e6 7DFFA400 		.string	"}\377\244"
+ 1051 23ea 7DFFA500 		.string	"}\377\245"
+ 1052 23ee 7DFFA500 		.string	"}\377\245"
+ 1053 23f2 7DFFA600 		.string	"}\377\246"
+ 1054 23f6 7DFFA600 		.string	"}\377\246"
+ 1055 23fa 7DFFA600 		.string	"}\377\246"
+ 1056 23fe 7DFFA700 		.string	"}\377\247"
+ 1057 2402 7DFFA700 		.string	"}\377\247"
+ 1058 2406 7DFFA800 		.string	"}\377\250"
+ 1059 240a 7DFFA800 		.string	"}\377\250"
+ 1060 240e 7DFFA800 		.string	"}\377\250"
+GAS LISTING /tmp/ccTtNBwq.s 			page 45
+
+
+ 1061 2412 7DFFA900 		.string	"}\377\251"
+ 1062 2416 7DFFA900 		.string	"}\377\251"
+ 1063 241a 7DFFAA00 		.string	"}\377\252"
+ 1064 241e 7DFFAA00 		.string	"}\377\252"
+ 1065 2422 7DFFAA00 		.string	"}\377\252"
+ 1066 2426 7DFFAB00 		.string	"}\377\253"
+ 1067 242a 7DFFAB00 		.string	"}\377\253"
+ 1068 242e 7DFFAC00 		.string	"}\377\254"
+ 1069 2432 7DFFAC00 		.string	"}\377\254"
+ 1070 2436 7DFFAC00 		.string	"}\377\254"
+ 1071 243a 7DFFAD00 		.string	"}\377\255"
+ 1072 243e 7DFFAD00 		.string	"}\377\255"
+ 1073 2442 7DFFAD01 		.ascii	"}\377\255\001}\377\256\001~\377\256\002~\377\257\002~\377\257"
+ 1073      7DFFAE01 
+ 1073      7EFFAE02 
+ 1073      7EFFAF02 
+ 1073      7EFFAF
+ 1074 2455 037EFFAF 		.ascii	"\003~\377\257\003~\377\260\004\177\377\260\005\177\377\260\005"
+ 1074      037EFFB0 
+ 1074      047FFFB0 
+ 1074      057FFFB0 
+ 1074      05
+ 1075 2466 7FFFB106 		.ascii	"\177\377\261\006\177\377\261\006\177\377\261\007\200\377\262"
+ 1075      7FFFB106 
+ 1075      7FFFB107 
+ 1075      80FFB2
+ 1076 2475 0880FFB2 		.ascii	"\b\200\377\262\b\200\377\263\t\200\377\263\n\200\377\263\n\201"
+ 1076      0880FFB3 
+ 1076      0980FFB3 
+ 1076      0A80FFB3 
+ 1076      0A81
+ 1077 2487 FFB40B81 		.ascii	"\377\264\013\201\377\264\013\201\377\264\f\201\377\265\r\201"
+ 1077      FFB40B81 
+ 1077      FFB40C81 
+ 1077      FFB50D81 
+ 1078 2497 FFB50D82 		.ascii	"\377\265\r\202\377\265\016\202\377\266\016\202\377\266\017\202"
+ 1078      FFB50E82 
+ 1078      FFB60E82 
+ 1078      FFB60F82 
+ 1079 24a7 FFB70F82 		.ascii	"\377\267\017\202\377\267\020\203\377\267\020\203\377\270\021"
+ 1079      FFB71083 
+ 1079      FFB71083 
+ 1079      FFB811
+ 1080 24b6 83FFB811 		.ascii	"\203\377\270\021\203\377\270\022\203\377\271\022\204\377\271"
+ 1080      83FFB812 
+ 1080      83FFB912 
+ 1080      84FFB9
+ 1081 24c5 1384FFB9 		.ascii	"\023\204\377\271\023\204\377\272\024\204\377\272\024\204\377"
+ 1081      1384FFBA 
+ 1081      1484FFBA 
+ 1081      1484FF
+ 1082 24d4 BB1485FF 		.ascii	"\273\024\205\377\273\025\205\377\273\025\205\377\274\026\205"
+ 1082      BB1585FF 
+ 1082      BB1585FF 
+ 1082      BC1685
+ 1083 24e3 FFBC1685 		.ascii	"\377\274\026\205\377\274\027\206\377\275\027\206\377\275\027"
+ 1083      FFBC1786 
+GAS LISTING /tmp/ccTtNBwq.s 			page 46
+
+
+ 1083      FFBD1786 
+ 1083      FFBD17
+ 1084 24f2 86FFBE18 		.ascii	"\206\377\276\030\206\377\276\030\206\377\276\031\207\377\277"
+ 1084      86FFBE18 
+ 1084      86FFBE19 
+ 1084      87FFBF
+ 1085 2501 1987FFBF 		.ascii	"\031\207\377\277\031\207\377\277\032\207\377\300\032\207\377"
+ 1085      1987FFBF 
+ 1085      1A87FFC0 
+ 1085      1A87FF
+ 1086 2510 C01A88FF 		.ascii	"\300\032\210\377\300\033\210\377\301\033\210\377\301\034\210"
+ 1086      C01B88FF 
+ 1086      C11B88FF 
+ 1086      C11C88
+ 1087 251f FFC21C88 		.ascii	"\377\302\034\210\377\302\034\210\377\302\035\211\377\303\035"
+ 1087      FFC21C88 
+ 1087      FFC21D89 
+ 1087      FFC31D
+ 1088 252e 89FFC31D 		.ascii	"\211\377\303\035\211\377\303\036\211\377\304\036\211\377\304"
+ 1088      89FFC31E 
+ 1088      89FFC41E 
+ 1088      89FFC4
+ 1089 253d 1F8AFFC4 		.ascii	"\037\212\377\304\037\212\377\305\037\212\377\305 \212\377\306"
+ 1089      1F8AFFC5 
+ 1089      1F8AFFC5 
+ 1089      208AFFC6 
+ 1090 254d 208AFFC6 		.ascii	" \212\377\306 \213\377\306!\213\377\307!\213\377\307!\213\377"
+ 1090      208BFFC6 
+ 1090      218BFFC7 
+ 1090      218BFFC7 
+ 1090      218BFF
+ 1091 2560 C7228BFF 		.ascii	"\307\"\213\377\310\"\214\377\310\"\214\377\311#\214\377\311#"
+ 1091      C8228CFF 
+ 1091      C8228CFF 
+ 1091      C9238CFF 
+ 1091      C923
+ 1092 2572 8CFFC923 		.ascii	"\214\377\311#\214\377\312$\215\377\312$\215\377\312$\215\377"
+ 1092      8CFFCA24 
+ 1092      8DFFCA24 
+ 1092      8DFFCA24 
+ 1092      8DFF
+ 1093 2584 CB258DFF 		.ascii	"\313%\215\377\313%\215\377\313%\216\377\314&\216\377\314&\216"
+ 1093      CB258DFF 
+ 1093      CB258EFF 
+ 1093      CC268EFF 
+ 1093      CC268E
+ 1094 2597 FFCD268E 		.ascii	"\377\315&\216\377\315'\216\377\315'\217\377\316'\217\377\316"
+ 1094      FFCD278E 
+ 1094      FFCD278F 
+ 1094      FFCE278F 
+ 1094      FFCE
+ 1095 25a9 288FFFCE 		.ascii	"(\217\377\316(\217\377\317(\217\377\317)\220\377\320)\220\377"
+ 1095      288FFFCF 
+ 1095      288FFFCF 
+ 1095      2990FFD0 
+ 1095      2990FF
+ 1096 25bc D02990FF 		.ascii	"\320)\220\377\320*\220\377\321*\220\377\321*\220\377\321*\221"
+GAS LISTING /tmp/ccTtNBwq.s 			page 47
+
+
+ 1096      D02A90FF 
+ 1096      D12A90FF 
+ 1096      D12A90FF 
+ 1096      D12A91
+ 1097 25cf FFD22B91 		.ascii	"\377\322+\221\377\322+\221\377\322+\221\377\323,\221\377\323"
+ 1097      FFD22B91 
+ 1097      FFD22B91 
+ 1097      FFD32C91 
+ 1097      FFD3
+ 1098 25e1 2C92FFD4 		.ascii	",\222\377\324,\222\377\324-\222\377\324-\222\377\325-\222\377"
+ 1098      2C92FFD4 
+ 1098      2D92FFD4 
+ 1098      2D92FFD5 
+ 1098      2D92FF
+ 1099 25f4 D52E93FF 		.ascii	"\325.\223\377\325.\223\377\326.\223\377\326.\223\377\327/\223"
+ 1099      D52E93FF 
+ 1099      D62E93FF 
+ 1099      D62E93FF 
+ 1099      D72F93
+ 1100 2607 FFD72F94 		.ascii	"\377\327/\224\377\327/\224\377\3300\224\377\3300\224\377\330"
+ 1100      FFD72F94 
+ 1100      FFD83094 
+ 1100      FFD83094 
+ 1100      FFD8
+ 1101 2619 3094FFD9 		.ascii	"0\224\377\3311\225\377\3311\225\377\3321\225\377\3321\225\377"
+ 1101      3195FFD9 
+ 1101      3195FFDA 
+ 1101      3195FFDA 
+ 1101      3195FF
+ 1102 262c DA3295FF 		.ascii	"\3322\225\377\3332\226\377\3332\226\377\3333\226\377\3343\226"
+ 1102      DB3296FF 
+ 1102      DB3296FF 
+ 1102      DB3396FF 
+ 1102      DC3396
+ 1103 263f FFDC3396 		.ascii	"\377\3343\226\377\3344\226\377\3354\227\377\3354\227\377\335"
+ 1103      FFDC3496 
+ 1103      FFDD3497 
+ 1103      FFDD3497 
+ 1103      FFDD
+ 1104 2651 3597FFDD 		.ascii	"5\227\377\3355\227\377\3366\227\377\3366\227\377\3367\227\377"
+ 1104      3597FFDE 
+ 1104      3697FFDE 
+ 1104      3697FFDE 
+ 1104      3797FF
+ 1105 2664 DE3797FF 		.ascii	"\3367\227\377\3378\227\377\3378\227\377\3379\227\377\3379\227"
+ 1105      DF3897FF 
+ 1105      DF3897FF 
+ 1105      DF3997FF 
+ 1105      DF3997
+ 1106 2677 FFDF3A97 		.ascii	"\377\337:\227\377\340:\227\377\340;\227\377\340;\227\377\340"
+ 1106      FFE03A97 
+ 1106      FFE03B97 
+ 1106      FFE03B97 
+ 1106      FFE0
+ 1107 2689 3B98FFE0 		.ascii	";\230\377\340<\230\377\341<\230\377\341=\230\377\341=\230\377"
+ 1107      3C98FFE1 
+ 1107      3C98FFE1 
+GAS LISTING /tmp/ccTtNBwq.s 			page 48
+
+
+ 1107      3D98FFE1 
+ 1107      3D98FF
+ 1108 269c E13E98FF 		.ascii	"\341>\230\377\342>\230\377\342?\230\377\342?\230\377\342?\230"
+ 1108      E23E98FF 
+ 1108      E23F98FF 
+ 1108      E23F98FF 
+ 1108      E23F98
+ 1109 26af FFE24098 		.ascii	"\377\342@\230\377\343@\230\377\343A\230\377\343A\230\377\343"
+ 1109      FFE34098 
+ 1109      FFE34198 
+ 1109      FFE34198 
+ 1109      FFE3
+ 1110 26c1 4298FFE4 		.ascii	"B\230\377\344B\230\377\344B\231\377\344C\231\377\344C\231\377"
+ 1110      4298FFE4 
+ 1110      4299FFE4 
+ 1110      4399FFE4 
+ 1110      4399FF
+ 1111 26d4 E44499FF 		.ascii	"\344D\231\377\345D\231\377\345E\231\377\345E\231\377\345E\231"
+ 1111      E54499FF 
+ 1111      E54599FF 
+ 1111      E54599FF 
+ 1111      E54599
+ 1112 26e7 FFE54699 		.ascii	"\377\345F\231\377\346F\231\377\346G\231\377\346G\231\377\346"
+ 1112      FFE64699 
+ 1112      FFE64799 
+ 1112      FFE64799 
+ 1112      FFE6
+ 1113 26f9 4799FFE6 		.ascii	"G\231\377\346H\231\377\347H\232\377\347I\232\377\347I\232\377"
+ 1113      4899FFE7 
+ 1113      489AFFE7 
+ 1113      499AFFE7 
+ 1113      499AFF
+ 1114 270c E74A9AFF 		.ascii	"\347J\232\377\350J\232\377\350J\232\377\350K\232\377\350K\232"
+ 1114      E84A9AFF 
+ 1114      E84A9AFF 
+ 1114      E84B9AFF 
+ 1114      E84B9A
+ 1115 271f FFE84C9A 		.ascii	"\377\350L\232\377\351L\232\377\351L\232\377\351M\232\377\351"
+ 1115      FFE94C9A 
+ 1115      FFE94C9A 
+ 1115      FFE94D9A 
+ 1115      FFE9
+ 1116 2731 4D9AFFE9 		.ascii	"M\232\377\351N\232\377\352N\233\377\352N\233\377\352O\233\377"
+ 1116      4E9AFFEA 
+ 1116      4E9BFFEA 
+ 1116      4E9BFFEA 
+ 1116      4F9BFF
+ 1117 2744 EA4F9BFF 		.ascii	"\352O\233\377\352P\233\377\353P\233\377\353P\233\377\353Q\233"
+ 1117      EA509BFF 
+ 1117      EB509BFF 
+ 1117      EB509BFF 
+ 1117      EB519B
+ 1118 2757 FFEB519B 		.ascii	"\377\353Q\233\377\353R\233\377\354R\233\377\354R\233\377\354"
+ 1118      FFEB529B 
+ 1118      FFEC529B 
+ 1118      FFEC529B 
+ 1118      FFEC
+GAS LISTING /tmp/ccTtNBwq.s 			page 49
+
+
+ 1119 2769 539BFFEC 		.ascii	"S\233\377\354S\234\377\354T\234\377\355T\234\377\355T\234\377"
+ 1119      539CFFEC 
+ 1119      549CFFED 
+ 1119      549CFFED 
+ 1119      549CFF
+ 1120 277c ED559CFF 		.ascii	"\355U\234\377\355U\234\377\355U\234\377\356V\234\377\356V\234"
+ 1120      ED559CFF 
+ 1120      ED559CFF 
+ 1120      EE569CFF 
+ 1120      EE569C
+ 1121 278f FFEE579C 		.ascii	"\377\356W\234\377\356W\234\377\356W\234\377\357X\235\377\357"
+ 1121      FFEE579C 
+ 1121      FFEE579C 
+ 1121      FFEF589D 
+ 1121      FFEF
+ 1122 27a1 589DFFEF 		.ascii	"X\235\377\357Y\235\377\357Y\235\377\357Y\235\377\360Z\235\377"
+ 1122      599DFFEF 
+ 1122      599DFFEF 
+ 1122      599DFFF0 
+ 1122      5A9DFF
+ 1123 27b4 F05A9DFF 		.ascii	"\360Z\235\377\360Z\235\377\360[\235\377\360[\235\377\361\\\235"
+ 1123      F05A9DFF 
+ 1123      F05B9DFF 
+ 1123      F05B9DFF 
+ 1123      F15C9D
+ 1124 27c7 FFF15C9E 		.ascii	"\377\361\\\236\377\361\\\236\377\361]\236\377\361]\236\377\361"
+ 1124      FFF15C9E 
+ 1124      FFF15D9E 
+ 1124      FFF15D9E 
+ 1124      FFF1
+ 1125 27d9 5D9EFFF2 		.ascii	"]\236\377\362^\236\377\362^\236\377\362_\236\377\362_\236\377"
+ 1125      5E9EFFF2 
+ 1125      5E9EFFF2 
+ 1125      5F9EFFF2 
+ 1125      5F9EFF
+ 1126 27ec F25F9EFF 		.ascii	"\362_\236\377\363`\236\377\363`\237\377\363`\237\377\363a\237"
+ 1126      F3609EFF 
+ 1126      F3609FFF 
+ 1126      F3609FFF 
+ 1126      F3619F
+ 1127 27ff FFF3619F 		.ascii	"\377\363a\237\377\364b\237\377\364b\237\377\364b\237\377"
+ 1127      FFF4629F 
+ 1127      FFF4629F 
+ 1127      FFF4629F 
+ 1127      FF
+ 1128 2810 F4639FFF 		.ascii	"\364c\237\377\364c\237\377\364c\237\377\365d\240\377\365d\240"
+ 1128      F4639FFF 
+ 1128      F4639FFF 
+ 1128      F564A0FF 
+ 1128      F564A0
+ 1129 2823 FFF565A0 		.ascii	"\377\365e\240\377\365e\240\377\365e\240\377\366f\240\377\366"
+ 1129      FFF565A0 
+ 1129      FFF565A0 
+ 1129      FFF666A0 
+ 1129      FFF6
+ 1130 2835 66A0FFF6 		.ascii	"f\240\377\366f\240\377\366g\240\377\366g\240\377\366h\240\377"
+ 1130      66A0FFF6 
+GAS LISTING /tmp/ccTtNBwq.s 			page 50
+
+
+ 1130      67A0FFF6 
+ 1130      67A0FFF6 
+ 1130      68A0FF
+ 1131 2848 FA6794FF 		.ascii	"\372g\224\377\372h\224\377\372h\224\377\372i\225\377\372i\225"
+ 1131      FA6894FF 
+ 1131      FA6894FF 
+ 1131      FA6995FF 
+ 1131      FA6995
+ 1132 285b FFFA6A96 		.ascii	"\377\372j\226\377\372j\226\377\372k\226\377\372k\227\377\372"
+ 1132      FFFA6A96 
+ 1132      FFFA6B96 
+ 1132      FFFA6B97 
+ 1132      FFFA
+ 1133 286d 6C97FFFA 		.ascii	"l\227\377\372l\227\377\372m\230\377\372m\230\377\372n\230\377"
+ 1133      6C97FFFA 
+ 1133      6D98FFFA 
+ 1133      6D98FFFA 
+ 1133      6E98FF
+ 1134 2880 FA6E99FF 		.ascii	"\372n\231\377\372o\231\377\372o\231\377\372o\232\377\372p\232"
+ 1134      FA6F99FF 
+ 1134      FA6F99FF 
+ 1134      FA6F9AFF 
+ 1134      FA709A
+ 1135 2893 FFFA709A 		.ascii	"\377\372p\232\377\372q\233\377\372q\233\377\372r\233\377\372"
+ 1135      FFFA719B 
+ 1135      FFFA719B 
+ 1135      FFFA729B 
+ 1135      FFFA
+ 1136 28a5 729CFFFA 		.ascii	"r\234\377\372s\234\377\372s\234\377\372t\235\377\372t\235\377"
+ 1136      739CFFFA 
+ 1136      739CFFFA 
+ 1136      749DFFFA 
+ 1136      749DFF
+ 1137 28b8 FA759EFF 		.ascii	"\372u\236\377\372u\236\377\372u\236\377\372v\237\377\372v\237"
+ 1137      FA759EFF 
+ 1137      FA759EFF 
+ 1137      FA769FFF 
+ 1137      FA769F
+ 1138 28cb FFFA779F 		.ascii	"\377\372w\237\377\372w\240\377\372x\240\377\371x\240\377\371"
+ 1138      FFFA77A0 
+ 1138      FFFA78A0 
+ 1138      FFF978A0 
+ 1138      FFF9
+ 1139 28dd 79A1FFF9 		.ascii	"y\241\377\371y\241\377\371z\241\377\371z\242\377\371z\242\377"
+ 1139      79A1FFF9 
+ 1139      7AA1FFF9 
+ 1139      7AA2FFF9 
+ 1139      7AA2FF
+ 1140 28f0 F97BA2FF 		.ascii	"\371{\242\377\371{\243\377\371|\243\377\371|\243\377\371}\244"
+ 1140      F97BA3FF 
+ 1140      F97CA3FF 
+ 1140      F97CA3FF 
+ 1140      F97DA4
+ 1141 2903 FFF97DA4 		.ascii	"\377\371}\244\377\371~\244\377\371~\245\377\371~\245\377\371"
+ 1141      FFF97EA4 
+ 1141      FFF97EA5 
+ 1141      FFF97EA5 
+GAS LISTING /tmp/ccTtNBwq.s 			page 51
+
+
+ 1141      FFF9
+ 1142 2915 7FA5FFF9 		.ascii	"\177\245\377\371\177\246\377\371\200\246\377\371\200\246\377"
+ 1142      7FA6FFF9 
+ 1142      80A6FFF9 
+ 1142      80A6FF
+ 1143 2924 F981A7FF 		.ascii	"\371\201\247\377\371\201\247\377\371\202\247\377\371\202\250"
+ 1143      F981A7FF 
+ 1143      F982A7FF 
+ 1143      F982A8
+ 1144 2933 FFF982A8 		.ascii	"\377\371\202\250\377\371\203\250\377\371\203\251\377\371\204"
+ 1144      FFF983A8 
+ 1144      FFF983A9 
+ 1144      FFF984
+ 1145 2942 A9FFF984 		.ascii	"\251\377\371\204\251\377\371\205\251\377\371\205\252\377\371"
+ 1145      A9FFF985 
+ 1145      A9FFF985 
+ 1145      AAFFF9
+ 1146 2951 85AAFFF9 		.ascii	"\205\252\377\371\206\252\377\371\206\253\377\371\207\253\377"
+ 1146      86AAFFF9 
+ 1146      86ABFFF9 
+ 1146      87ABFF
+ 1147 2960 F987ABFF 		.ascii	"\371\207\253\377\371\210\254\377\371\210\254\377\371\210\254"
+ 1147      F988ACFF 
+ 1147      F988ACFF 
+ 1147      F988AC
+ 1148 296f FFF989AD 		.ascii	"\377\371\211\255\377\371\211\255\377\371\212\255\377\371\212"
+ 1148      FFF989AD 
+ 1148      FFF98AAD 
+ 1148      FFF98A
+ 1149 297e AEFFF98B 		.ascii	"\256\377\371\213\256\377\371\213\256\377\371\213\257\377\371"
+ 1149      AEFFF98B 
+ 1149      AEFFF98B 
+ 1149      AFFFF9
+ 1150 298d 8CAFFFF9 		.ascii	"\214\257\377\371\214\257\377\371\215\260\377\370\215\260\377"
+ 1150      8CAFFFF9 
+ 1150      8DB0FFF8 
+ 1150      8DB0FF
+ 1151 299c F88EB0FF 		.ascii	"\370\216\260\377\370\216\260\377\370\216\261\377\370\217\261"
+ 1151      F88EB0FF 
+ 1151      F88EB1FF 
+ 1151      F88FB1
+ 1152 29ab FFF88FB1 		.ascii	"\377\370\217\261\377\370\220\262\377\370\220\262\377\370\220"
+ 1152      FFF890B2 
+ 1152      FFF890B2 
+ 1152      FFF890
+ 1153 29ba B2FFF891 		.ascii	"\262\377\370\221\263\377\370\221\263\377\370\222\263\377\370"
+ 1153      B3FFF891 
+ 1153      B3FFF892 
+ 1153      B3FFF8
+ 1154 29c9 92B4FFF8 		.ascii	"\222\264\377\370\223\264\377\370\223\264\377\370\223\264\377"
+ 1154      93B4FFF8 
+ 1154      93B4FFF8 
+ 1154      93B4FF
+ 1155 29d8 F894B5FF 		.ascii	"\370\224\265\377\370\224\265\377\370\225\265\377\370\225\266"
+ 1155      F894B5FF 
+ 1155      F895B5FF 
+ 1155      F895B6
+GAS LISTING /tmp/ccTtNBwq.s 			page 52
+
+
+ 1156 29e7 FFF895B6 		.ascii	"\377\370\225\266\377\370\226\266\377\370\226\267\377\370\227"
+ 1156      FFF896B6 
+ 1156      FFF896B7 
+ 1156      FFF897
+ 1157 29f6 B7FFF897 		.ascii	"\267\377\370\227\267\377\370\230\270\377\370\230\270\377\370"
+ 1157      B7FFF898 
+ 1157      B8FFF898 
+ 1157      B8FFF8
+ 1158 2a05 98B8FFF8 		.ascii	"\230\270\377\370\231\270\377\370\231\271\377\367\232\271\377"
+ 1158      99B8FFF8 
+ 1158      99B9FFF7 
+ 1158      9AB9FF
+ 1159 2a14 F79AB9FF 		.ascii	"\367\232\271\377\367\232\272\377\367\233\272\377\367\233\272"
+ 1159      F79ABAFF 
+ 1159      F79BBAFF 
+ 1159      F79BBA
+ 1160 2a23 FFF79CBA 		.ascii	"\377\367\234\272\377\367\234\273\377\367\234\273\377\367\235"
+ 1160      FFF79CBB 
+ 1160      FFF79CBB 
+ 1160      FFF79D
+ 1161 2a32 BBFFF79D 		.ascii	"\273\377\367\235\274\377\367\236\274\377\367\236\274\377\367"
+ 1161      BCFFF79E 
+ 1161      BCFFF79E 
+ 1161      BCFFF7
+ 1162 2a41 9EBDFFF7 		.ascii	"\236\275\377\367\237\275\377\372\237\264\377\372\237\264\377"
+ 1162      9FBDFFFA 
+ 1162      9FB4FFFA 
+ 1162      9FB4FF
+ 1163 2a50 FA9FB4FF 		.ascii	"\372\237\264\377\372\240\264\377\372\240\264\377\372\240\264"
+ 1163      FAA0B4FF 
+ 1163      FAA0B4FF 
+ 1163      FAA0B4
+ 1164 2a5f FFFAA1B4 		.ascii	"\377\372\241\264\377\372\241\264\377\372\241\264\377\372\241"
+ 1164      FFFAA1B4 
+ 1164      FFFAA1B4 
+ 1164      FFFAA1
+ 1165 2a6e B5FFFAA2 		.ascii	"\265\377\372\242\265\377\372\242\265\377\372\242\265\377\372"
+ 1165      B5FFFAA2 
+ 1165      B5FFFAA2 
+ 1165      B5FFFA
+ 1166 2a7d A3B5FFFA 		.ascii	"\243\265\377\372\243\265\377\372\243\265\377\373\244\265\377"
+ 1166      A3B5FFFA 
+ 1166      A3B5FFFB 
+ 1166      A4B5FF
+ 1167 2a8c FBA4B5FF 		.ascii	"\373\244\265\377\373\244\265\377\373\244\265\377\373\245\265"
+ 1167      FBA4B5FF 
+ 1167      FBA4B5FF 
+ 1167      FBA5B5
+ 1168 2a9b FFFBA5B5 		.ascii	"\377\373\245\265\377\373\245\265\377\373\246\265\377\373\246"
+ 1168      FFFBA5B5 
+ 1168      FFFBA6B5 
+ 1168      FFFBA6
+ 1169 2aaa B5FFFBA6 		.ascii	"\265\377\373\246\265\377\373\246\265\377\373\247\265\377\373"
+ 1169      B5FFFBA6 
+ 1169      B5FFFBA7 
+ 1169      B5FFFB
+ 1170 2ab9 A7B5FFFB 		.ascii	"\247\265\377\373\247\265\377\373\250\265\377\373\250\265\377"
+GAS LISTING /tmp/ccTtNBwq.s 			page 53
+
+
+ 1170      A7B5FFFB 
+ 1170      A8B5FFFB 
+ 1170      A8B5FF
+ 1171 2ac8 FBA8B5FF 		.ascii	"\373\250\265\377\373\251\265\377\373\251\265\377\373\251\265"
+ 1171      FBA9B5FF 
+ 1171      FBA9B5FF 
+ 1171      FBA9B5
+ 1172 2ad7 FFFBA9B5 		.ascii	"\377\373\251\265\377\373\252\265\377\373\252\265\377\373\252"
+ 1172      FFFBAAB5 
+ 1172      FFFBAAB5 
+ 1172      FFFBAA
+ 1173 2ae6 B5FFFCAB 		.ascii	"\265\377\374\253\265\377\374\253\265\377\374\253\266\377\374"
+ 1173      B5FFFCAB 
+ 1173      B5FFFCAB 
+ 1173      B6FFFC
+ 1174 2af5 ACB6FFFC 		.ascii	"\254\266\377\374\254\266\377\374\254\266\377\374\254\266\377"
+ 1174      ACB6FFFC 
+ 1174      ACB6FFFC 
+ 1174      ACB6FF
+ 1175 2b04 FCADB6FF 		.ascii	"\374\255\266\377\374\255\266\377\374\255\266\377\374\256\266"
+ 1175      FCADB6FF 
+ 1175      FCADB6FF 
+ 1175      FCAEB6
+ 1176 2b13 FFFCAEB6 		.ascii	"\377\374\256\266\377\374\256\266\377\374\257\266\377\374\257"
+ 1176      FFFCAEB6 
+ 1176      FFFCAFB6 
+ 1176      FFFCAF
+ 1177 2b22 B6FFFCAF 		.ascii	"\266\377\374\257\266\377\374\257\266\377\374\260\266\377\374"
+ 1177      B6FFFCAF 
+ 1177      B6FFFCB0 
+ 1177      B6FFFC
+ 1178 2b31 B0B7FFFC 		.ascii	"\260\267\377\374\260\267\377\374\261\267\377\374\261\267\377"
+ 1178      B0B7FFFC 
+ 1178      B1B7FFFC 
+ 1178      B1B7FF
+ 1179 2b40 FCB1B7FF 		.ascii	"\374\261\267\377\374\261\267\377\374\262\267\377\374\262\267"
+ 1179      FCB1B7FF 
+ 1179      FCB2B7FF 
+ 1179      FCB2B7
+ 1180 2b4f FFFCB2B7 		.ascii	"\377\374\262\267\377\374\263\267\377\374\263\267\377\374\263"
+ 1180      FFFCB3B7 
+ 1180      FFFCB3B7 
+ 1180      FFFCB3
+ 1181 2b5e B8FFFCB4 		.ascii	"\270\377\374\264\270\377\374\264\270\377\374\264\270\377\374"
+ 1181      B8FFFCB4 
+ 1181      B8FFFCB4 
+ 1181      B8FFFC
+ 1182 2b6d B4B8FFFC 		.ascii	"\264\270\377\374\265\270\377\374\265\270\377\374\265\270\377"
+ 1182      B5B8FFFC 
+ 1182      B5B8FFFC 
+ 1182      B5B8FF
+ 1183 2b7c FCB6B8FF 		.ascii	"\374\266\270\377\374\266\270\377\374\266\271\377\374\267\271"
+ 1183      FCB6B8FF 
+ 1183      FCB6B9FF 
+ 1183      FCB7B9
+ 1184 2b8b FFFCB7B9 		.ascii	"\377\374\267\271\377\374\267\271\377\374\267\271\377\374\270"
+ 1184      FFFCB7B9 
+GAS LISTING /tmp/ccTtNBwq.s 			page 54
+
+
+ 1184      FFFCB7B9 
+ 1184      FFFCB8
+ 1185 2b9a B9FFFCB8 		.ascii	"\271\377\374\270\271\377\374\270\271\377\374\271\271\377\374"
+ 1185      B9FFFCB8 
+ 1185      B9FFFCB9 
+ 1185      B9FFFC
+ 1186 2ba9 B9BAFFFC 		.ascii	"\271\272\377\374\271\272\377\374\272\272\377\374\272\272\377"
+ 1186      B9BAFFFC 
+ 1186      BABAFFFC 
+ 1186      BABAFF
+ 1187 2bb8 FCBABAFF 		.ascii	"\374\272\272\377\374\272\272\377\374\273\272\377\374\273\272"
+ 1187      FCBABAFF 
+ 1187      FCBBBAFF 
+ 1187      FCBBBA
+ 1188 2bc7 FFFCBBBB 		.ascii	"\377\374\273\273\377\374\274\273\377\374\274\273\377\374\274"
+ 1188      FFFCBCBB 
+ 1188      FFFCBCBB 
+ 1188      FFFCBC
+ 1189 2bd6 BBFFFCBD 		.ascii	"\273\377\374\275\273\377\374\275\273\377\374\275\273\377\374"
+ 1189      BBFFFCBD 
+ 1189      BBFFFCBD 
+ 1189      BBFFFC
+ 1190 2be5 BDBCFFFC 		.ascii	"\275\274\377\374\276\274\377\374\276\274\377\374\276\274\377"
+ 1190      BEBCFFFC 
+ 1190      BEBCFFFC 
+ 1190      BEBCFF
+ 1191 2bf4 FCBFBCFF 		.ascii	"\374\277\274\377\374\277\274\377\374\277\274\377\374\277\275"
+ 1191      FCBFBCFF 
+ 1191      FCBFBCFF 
+ 1191      FCBFBD
+ 1192 2c03 FFFCC0BD 		.ascii	"\377\374\300\275\377\374\300\275\377\374\300\275\377\374\301"
+ 1192      FFFCC0BD 
+ 1192      FFFCC0BD 
+ 1192      FFFCC1
+ 1193 2c12 BDFFFCC1 		.ascii	"\275\377\374\301\275\377\374\301\276\377\374\302\276\377\374"
+ 1193      BDFFFCC1 
+ 1193      BEFFFCC2 
+ 1193      BEFFFC
+ 1194 2c21 C2BEFFFC 		.ascii	"\302\276\377\374\302\276\377\374\302\276\377\374\303\276\377"
+ 1194      C2BEFFFC 
+ 1194      C2BEFFFC 
+ 1194      C3BEFF
+ 1195 2c30 FCC3BFFF 		.ascii	"\374\303\277\377\374\303\277\377\374\304\277\377\374\304\277"
+ 1195      FCC3BFFF 
+ 1195      FCC4BFFF 
+ 1195      FCC4BF
+ 1196 2c3f FFFCC4BF 		.ascii	"\377\374\304\277\377\373\305\277\377\374\305\300\377\374\305"
+ 1196      FFFBC5BF 
+ 1196      FFFCC5C0 
+ 1196      FFFCC5
+ 1197 2c4e C0FFFCC5 		.ascii	"\300\377\374\305\300\377\374\305\300\377\374\306\301\377\374"
+ 1197      C0FFFCC5 
+ 1197      C0FFFCC6 
+ 1197      C1FFFC
+ 1198 2c5d C6C1FFFC 		.ascii	"\306\301\377\374\306\301\377\374\306\301\377\374\306\302\377"
+ 1198      C6C1FFFC 
+ 1198      C6C1FFFC 
+GAS LISTING /tmp/ccTtNBwq.s 			page 55
+
+
+ 1198      C6C2FF
+ 1199 2c6c FCC7C2FF 		.ascii	"\374\307\302\377\374\307\302\377\374\307\302\377\374\307\302"
+ 1199      FCC7C2FF 
+ 1199      FCC7C2FF 
+ 1199      FCC7C2
+ 1200 2c7b FFFCC7C3 		.ascii	"\377\374\307\303\377\374\310\303\377\374\310\303\377\374\310"
+ 1200      FFFCC8C3 
+ 1200      FFFCC8C3 
+ 1200      FFFCC8
+ 1201 2c8a C3FFFCC8 		.ascii	"\303\377\374\310\304\377\374\311\304\377\374\311\304\377\374"
+ 1201      C4FFFCC9 
+ 1201      C4FFFCC9 
+ 1201      C4FFFC
+ 1202 2c99 C9C4FFFC 		.ascii	"\311\304\377\374\311\304\377\374\311\305\377\374\312\305\377"
+ 1202      C9C4FFFC 
+ 1202      C9C5FFFC 
+ 1202      CAC5FF
+ 1203 2ca8 FCCAC5FF 		.ascii	"\374\312\305\377\374\312\305\377\374\312\306\377\374\312\306"
+ 1203      FCCAC5FF 
+ 1203      FCCAC6FF 
+ 1203      FCCAC6
+ 1204 2cb7 FFFCCBC6 		.ascii	"\377\374\313\306\377\374\313\306\377\374\313\306\377\374\313"
+ 1204      FFFCCBC6 
+ 1204      FFFCCBC6 
+ 1204      FFFCCB
+ 1205 2cc6 C7FFFCCB 		.ascii	"\307\377\374\313\307\377\374\314\307\377\374\314\307\377\374"
+ 1205      C7FFFCCC 
+ 1205      C7FFFCCC 
+ 1205      C7FFFC
+ 1206 2cd5 CCC8FFFC 		.ascii	"\314\310\377\374\314\310\377\374\315\310\377\374\315\310\377"
+ 1206      CCC8FFFC 
+ 1206      CDC8FFFC 
+ 1206      CDC8FF
+ 1207 2ce4 FCCDC8FF 		.ascii	"\374\315\310\377\374\315\311\377\374\315\311\377\374\316\311"
+ 1207      FCCDC9FF 
+ 1207      FCCDC9FF 
+ 1207      FCCEC9
+ 1208 2cf3 FFFCCEC9 		.ascii	"\377\374\316\311\377\374\316\312\377\374\316\312\377\374\316"
+ 1208      FFFCCECA 
+ 1208      FFFCCECA 
+ 1208      FFFCCE
+ 1209 2d02 CAFFFCCF 		.ascii	"\312\377\374\317\312\377\374\317\312\377\374\317\313\377\374"
+ 1209      CAFFFCCF 
+ 1209      CAFFFCCF 
+ 1209      CBFFFC
+ 1210 2d11 CFCBFFFC 		.ascii	"\317\313\377\374\317\313\377\374\320\313\377\374\320\314\377"
+ 1210      CFCBFFFC 
+ 1210      D0CBFFFC 
+ 1210      D0CCFF
+ 1211 2d20 FCD0CCFF 		.ascii	"\374\320\314\377\374\320\314\377\374\321\314\377\374\321\315"
+ 1211      FCD0CCFF 
+ 1211      FCD1CCFF 
+ 1211      FCD1CD
+ 1212 2d2f FFFCD1CD 		.ascii	"\377\374\321\315\377\374\321\315\377\374\321\315\377\374\322"
+ 1212      FFFCD1CD 
+ 1212      FFFCD1CD 
+ 1212      FFFCD2
+GAS LISTING /tmp/ccTtNBwq.s 			page 56
+
+
+ 1213 2d3e CDFFFCD2 		.ascii	"\315\377\374\322\316\377\374\322\316\377\374\322\316\377\374"
+ 1213      CEFFFCD2 
+ 1213      CEFFFCD2 
+ 1213      CEFFFC
+ 1214 2d4d D2CEFFFC 		.ascii	"\322\316\377\374\323\317\377\374\323\317\377\374\323\317\377"
+ 1214      D3CFFFFC 
+ 1214      D3CFFFFC 
+ 1214      D3CFFF
+ 1215 2d5c FCD3CFFF 		.ascii	"\374\323\317\377\374\323\317\377\374\324\320\377\374\324\320"
+ 1215      FCD3CFFF 
+ 1215      FCD4D0FF 
+ 1215      FCD4D0
+ 1216 2d6b FFFCD4D0 		.ascii	"\377\374\324\320\377\374\324\320\377\374\325\321\377\374\325"
+ 1216      FFFCD4D0 
+ 1216      FFFCD5D1 
+ 1216      FFFCD5
+ 1217 2d7a D1FFFCD5 		.ascii	"\321\377\374\325\321\377\374\325\321\377\374\325\322\377\374"
+ 1217      D1FFFCD5 
+ 1217      D1FFFCD5 
+ 1217      D2FFFC
+ 1218 2d89 D6D2FFFC 		.ascii	"\326\322\377\374\326\322\377\374\326\322\377\374\326\322\377"
+ 1218      D6D2FFFC 
+ 1218      D6D2FFFC 
+ 1218      D6D2FF
+ 1219 2d98 FCD6D3FF 		.ascii	"\374\326\323\377\374\327\323\377\374\327\323\377\374\327\323"
+ 1219      FCD7D3FF 
+ 1219      FCD7D3FF 
+ 1219      FCD7D3
+ 1220 2da7 FFFCD7D4 		.ascii	"\377\374\327\324\377\374\327\324\377\374\330\324\377\374\330"
+ 1220      FFFCD7D4 
+ 1220      FFFCD8D4 
+ 1220      FFFCD8
+ 1221 2db6 D4FFFCD8 		.ascii	"\324\377\374\330\324\377\374\330\325\377\374\331\325\377\374"
+ 1221      D4FFFCD8 
+ 1221      D5FFFCD9 
+ 1221      D5FFFC
+ 1222 2dc5 D9D5FFFC 		.ascii	"\331\325\377\374\331\325\377\374\331\326\377\374\331\326\377"
+ 1222      D9D5FFFC 
+ 1222      D9D6FFFC 
+ 1222      D9D6FF
+ 1223 2dd4 FCDAD6FF 		.ascii	"\374\332\326\377\374\332\326\377\374\332\327\377\374\332\327"
+ 1223      FCDAD6FF 
+ 1223      FCDAD7FF 
+ 1223      FCDAD7
+ 1224 2de3 FFFCDAD7 		.ascii	"\377\374\332\327\377\374\333\327\377\374\333\327\377\374\333"
+ 1224      FFFCDBD7 
+ 1224      FFFCDBD7 
+ 1224      FFFCDB
+ 1225 2df2 D8FFFCDB 		.ascii	"\330\377\374\333\330\377\375\333\330\377\375\334\330\377\375"
+ 1225      D8FFFDDB 
+ 1225      D8FFFDDC 
+ 1225      D8FFFD
+ 1226 2e01 DCD9FFFD 		.ascii	"\334\331\377\375\334\331\377\375\334\331\377\375\335\331\377"
+ 1226      DCD9FFFD 
+ 1226      DCD9FFFD 
+ 1226      DDD9FF
+ 1227 2e10 FDDDDAFF 		.ascii	"\375\335\332\377\375\335\332\377\375\335\332\377\375\335\332"
+GAS LISTING /tmp/ccTtNBwq.s 			page 57
+
+
+ 1227      FDDDDAFF 
+ 1227      FDDDDAFF 
+ 1227      FDDDDA
+ 1228 2e1f FFFDDEDA 		.ascii	"\377\375\336\332\377\375\336\333\377\375\336\333\377\375\336"
+ 1228      FFFDDEDB 
+ 1228      FFFDDEDB 
+ 1228      FFFDDE
+ 1229 2e2e DBFFFDDE 		.ascii	"\333\377\375\336\333\377\375\337\334\377\375\337\334\377\375"
+ 1229      DBFFFDDF 
+ 1229      DCFFFDDF 
+ 1229      DCFFFD
+ 1230 2e3d DFDCFFFD 		.ascii	"\337\334\377\375\337\334\377\374\340\334\377\375\340\335\377"
+ 1230      DFDCFFFC 
+ 1230      E0DCFFFD 
+ 1230      E0DDFF
+ 1231 2e4c FDE0DDFF 		.ascii	"\375\340\335\377\375\340\335\377\375\340\335\377\375\340\335"
+ 1231      FDE0DDFF 
+ 1231      FDE0DDFF 
+ 1231      FDE0DD
+ 1232 2e5b FFFDE1DD 		.ascii	"\377\375\341\335\377\375\341\335\377\375\341\336\377\375\341"
+ 1232      FFFDE1DD 
+ 1232      FFFDE1DE 
+ 1232      FFFDE1
+ 1233 2e6a DEFFFDE1 		.ascii	"\336\377\375\341\336\377\375\342\336\377\375\342\336\377\375"
+ 1233      DEFFFDE2 
+ 1233      DEFFFDE2 
+ 1233      DEFFFD
+ 1234 2e79 E2DEFFFD 		.ascii	"\342\336\377\375\342\336\377\375\342\336\377\375\342\337\377"
+ 1234      E2DEFFFD 
+ 1234      E2DEFFFD 
+ 1234      E2DFFF
+ 1235 2e88 FDE3DFFF 		.ascii	"\375\343\337\377\375\343\337\377\375\343\337\377\375\343\337"
+ 1235      FDE3DFFF 
+ 1235      FDE3DFFF 
+ 1235      FDE3DF
+ 1236 2e97 FFFDE3DF 		.ascii	"\377\375\343\337\377\375\344\337\377\375\344\340\377\375\344"
+ 1236      FFFDE4DF 
+ 1236      FFFDE4E0 
+ 1236      FFFDE4
+ 1237 2ea6 E0FFFDE4 		.ascii	"\340\377\375\344\340\377\375\344\340\377\375\344\340\377\375"
+ 1237      E0FFFDE4 
+ 1237      E0FFFDE4 
+ 1237      E0FFFD
+ 1238 2eb5 E5E0FFFD 		.ascii	"\345\340\377\375\345\340\377\375\345\341\377\375\345\341\377"
+ 1238      E5E0FFFD 
+ 1238      E5E1FFFD 
+ 1238      E5E1FF
+ 1239 2ec4 FDE5E1FF 		.ascii	"\375\345\341\377\375\346\341\377\375\346\341\377\375\346\341"
+ 1239      FDE6E1FF 
+ 1239      FDE6E1FF 
+ 1239      FDE6E1
+ 1240 2ed3 FFFDE6E1 		.ascii	"\377\375\346\341\377\375\346\342\377\375\346\342\377\375\347"
+ 1240      FFFDE6E2 
+ 1240      FFFDE6E2 
+ 1240      FFFDE7
+ 1241 2ee2 E2FFFDE7 		.ascii	"\342\377\375\347\342\377\375\347\342\377\375\347\342\377\375"
+ 1241      E2FFFDE7 
+GAS LISTING /tmp/ccTtNBwq.s 			page 58
+
+
+ 1241      E2FFFDE7 
+ 1241      E2FFFD
+ 1242 2ef1 E7E3FFFD 		.ascii	"\347\343\377\375\350\343\377\375\350\343\377\375\350\343\377"
+ 1242      E8E3FFFD 
+ 1242      E8E3FFFD 
+ 1242      E8E3FF
+ 1243 2f00 FDE8E3FF 		.ascii	"\375\350\343\377\375\350\343\377\375\350\343\377\375\351\344"
+ 1243      FDE8E3FF 
+ 1243      FDE8E3FF 
+ 1243      FDE9E4
+ 1244 2f0f FFFDE9E4 		.ascii	"\377\375\351\344\377\375\351\344\377\375\351\344\377\375\351"
+ 1244      FFFDE9E4 
+ 1244      FFFDE9E4 
+ 1244      FFFDE9
+ 1245 2f1e E4FFFDEA 		.ascii	"\344\377\375\352\344\377\375\352\345\377\375\352\345\377\375"
+ 1245      E4FFFDEA 
+ 1245      E5FFFDEA 
+ 1245      E5FFFD
+ 1246 2f2d EAE5FFFD 		.ascii	"\352\345\377\375\352\345\377\375\352\345\377\375\353\345\377"
+ 1246      EAE5FFFD 
+ 1246      EAE5FFFD 
+ 1246      EBE5FF
+ 1247 2f3c FDEBE6FF 		.ascii	"\375\353\346\377\375\353\346\377\375\353\346\377\375\353\346"
+ 1247      FDEBE6FF 
+ 1247      FDEBE6FF 
+ 1247      FDEBE6
+ 1248 2f4b FFFDECE6 		.ascii	"\377\375\354\346\377\375\354\346\377\376\354\347\377\376\354"
+ 1248      FFFDECE6 
+ 1248      FFFEECE7 
+ 1248      FFFEEC
+ 1249 2f5a E7FFFEEC 		.ascii	"\347\377\376\354\347\377\376\354\347\377\376\355\347\377\376"
+ 1249      E7FFFEEC 
+ 1249      E7FFFEED 
+ 1249      E7FFFE
+ 1250 2f69 EDE8FFFE 		.ascii	"\355\350\377\376\355\350\377\376\355\350\377\376\355\350\377"
+ 1250      EDE8FFFE 
+ 1250      EDE8FFFE 
+ 1250      EDE8FF
+ 1251 2f78 FEEEE8FF 		.ascii	"\376\356\350\377\376\356\350\377\376\356\351\377\376\356\351"
+ 1251      FEEEE8FF 
+ 1251      FEEEE9FF 
+ 1251      FEEEE9
+ 1252 2f87 FFFEEEE9 		.ascii	"\377\376\356\351\377\376\356\351\377\376\357\351\377\376\357"
+ 1252      FFFEEEE9 
+ 1252      FFFEEFE9 
+ 1252      FFFEEF
+ 1253 2f96 EAFFFEEF 		.ascii	"\352\377\376\357\352\377\376\357\352\377\376\357\352\377\376"
+ 1253      EAFFFEEF 
+ 1253      EAFFFEEF 
+ 1253      EAFFFE
+ 1254 2fa5 F0EAFFFE 		.ascii	"\360\352\377\376\360\353\377\376\360\353\377\376\360\353\377"
+ 1254      F0EBFFFE 
+ 1254      F0EBFFFE 
+ 1254      F0EBFF
+ 1255 2fb4 FEF0EBFF 		.ascii	"\376\360\353\377\376\360\353\377\376\361\354\377\376\361\354"
+ 1255      FEF0EBFF 
+ 1255      FEF1ECFF 
+GAS LISTING /tmp/ccTtNBwq.s 			page 59
+
+
+ 1255      FEF1EC
+ 1256 2fc3 FFFEF1EC 		.ascii	"\377\376\361\354\377\376\361\354\377\376\361\354\377\376\361"
+ 1256      FFFEF1EC 
+ 1256      FFFEF1EC 
+ 1256      FFFEF1
+ 1257 2fd2 ECFFFEF2 		.ascii	"\354\377\376\362\355\377\376\362\355\377\376\362\355\377"
+ 1257      EDFFFEF2 
+ 1257      EDFFFEF2 
+ 1257      EDFF
+ 1258 2fe0 FEF2EDFF 		.ascii	"\376\362\355\377\376\362\355\377\376\363\356\377\376\363\356"
+ 1258      FEF2EDFF 
+ 1258      FEF3EEFF 
+ 1258      FEF3EE
+ 1259 2fef FFFEF3EE 		.ascii	"\377\376\363\356\377\376\363\356\377\376\363\356\377\376\363"
+ 1259      FFFEF3EE 
+ 1259      FFFEF3EE 
+ 1259      FFFEF3
+ 1260 2ffe EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 1260      EFFFFEF4 
+ 1260      EFFFFEF4 
+ 1260      EFFFFE
+ 1261 300d F4F0FFFE 		.ascii	"\364\360\377\376\364\360\377\376\364\360\377\376\365\360\377"
+ 1261      F4F0FFFE 
+ 1261      F4F0FFFE 
+ 1261      F5F0FF
+ 1262 301c FEF5F0FF 		.ascii	"\376\365\360\377\376\365\361\377\376\365\361\377\376\365\361"
+ 1262      FEF5F1FF 
+ 1262      FEF5F1FF 
+ 1262      FEF5F1
+ 1263 302b FFFEF5F1 		.ascii	"\377\376\365\361\377\376\366\361\377\376\366\362\377\376\366"
+ 1263      FFFEF6F1 
+ 1263      FFFEF6F2 
+ 1263      FFFEF6
+ 1264 303a F2FFFEF6 		.ascii	"\362\377\376\366\362\377\376\366\362\377"
+ 1264      F2FFFEF6 
+ 1264      F2FF
+ 1265              		.globl	heatmap_cs_RdPu_discrete
+ 1266              		.section	.data.rel.local
+ 1267              		.align 8
+ 1268              		.type	heatmap_cs_RdPu_discrete, @object
+ 1269              		.size	heatmap_cs_RdPu_discrete, 8
+ 1270              	heatmap_cs_RdPu_discrete:
+ 1271 0018 00000000 		.quad	discrete
+ 1271      00000000 
+ 1272              		.section	.data.rel.ro.local
+ 1273              		.align 16
+ 1274              		.type	discrete, @object
+ 1275              		.size	discrete, 16
+ 1276              	discrete:
+ 1277 0030 00000000 		.quad	discrete_data
+ 1277      00000000 
+ 1278 0038 0A000000 		.quad	10
+ 1278      00000000 
+ 1279              		.section	.rodata
+ 1280 3044 00000000 		.align 32
+ 1280      00000000 
+ 1280      00000000 
+GAS LISTING /tmp/ccTtNBwq.s 			page 60
+
+
+ 1280      00000000 
+ 1280      00000000 
+ 1281              		.type	discrete_data, @object
+ 1282              		.size	discrete_data, 40
+ 1283              	discrete_data:
+ 1284 3060 00       		.string	""
+ 1285 3061 00       		.string	""
+ 1286 3062 00       		.string	""
+ 1287 3063 00       		.string	""
+ 1288 3064 4900     		.string	"I"
+ 1289 3066 6AFF7A01 		.ascii	"j\377z\001w\377\256\001~\377\3354\227\377\367h\241\377\372\237"
+ 1289      77FFAE01 
+ 1289      7EFFDD34 
+ 1289      97FFF768 
+ 1289      A1FFFA9F 
+ 1290 307a B5FFFCC5 		.ascii	"\265\377\374\305\300\377\375\340\335\377\377\367\363\377"
+ 1290      C0FFFDE0 
+ 1290      DDFFFFF7 
+ 1290      F3FF
+ 1291              		.text
+ 1292              	.Letext0:
+ 1293              		.file 1 "./heatmap.h"
+ 1294              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1295              		.file 3 "./colorschemes/RdPu.h"
+ 1296              		.file 4 "colorschemes/RdPu.c"
+ 1297              		.section	.debug_info,"",@progbits
+ 1298              	.Ldebug_info0:
+ 1299 0000 E3010000 		.long	0x1e3
+ 1300 0004 0500     		.value	0x5
+ 1301 0006 01       		.byte	0x1
+ 1302 0007 08       		.byte	0x8
+ 1303 0008 00000000 		.long	.Ldebug_abbrev0
+ 1304 000c 0A       		.uleb128 0xa
+ 1305 000d 00000000 		.long	.LASF26
+ 1306 0011 1D       		.byte	0x1d
+ 1307 0012 00000000 		.long	.LASF0
+ 1308 0016 00000000 		.long	.LASF1
+ 1309 001a 00000000 		.long	.Ldebug_line0
+ 1310 001e 01       		.uleb128 0x1
+ 1311 001f 08       		.byte	0x8
+ 1312 0020 05       		.byte	0x5
+ 1313 0021 00000000 		.long	.LASF2
+ 1314 0025 06       		.uleb128 0x6
+ 1315 0026 00000000 		.long	.LASF12
+ 1316 002a 02       		.byte	0x2
+ 1317 002b D6       		.byte	0xd6
+ 1318 002c 17       		.byte	0x17
+ 1319 002d 31000000 		.long	0x31
+ 1320 0031 01       		.uleb128 0x1
+ 1321 0032 08       		.byte	0x8
+ 1322 0033 07       		.byte	0x7
+ 1323 0034 00000000 		.long	.LASF3
+ 1324 0038 0B       		.uleb128 0xb
+ 1325 0039 04       		.byte	0x4
+ 1326 003a 05       		.byte	0x5
+ 1327 003b 696E7400 		.string	"int"
+ 1328 003f 01       		.uleb128 0x1
+GAS LISTING /tmp/ccTtNBwq.s 			page 61
+
+
+ 1329 0040 08       		.byte	0x8
+ 1330 0041 05       		.byte	0x5
+ 1331 0042 00000000 		.long	.LASF4
+ 1332 0046 01       		.uleb128 0x1
+ 1333 0047 10       		.byte	0x10
+ 1334 0048 04       		.byte	0x4
+ 1335 0049 00000000 		.long	.LASF5
+ 1336 004d 01       		.uleb128 0x1
+ 1337 004e 04       		.byte	0x4
+ 1338 004f 04       		.byte	0x4
+ 1339 0050 00000000 		.long	.LASF6
+ 1340 0054 01       		.uleb128 0x1
+ 1341 0055 04       		.byte	0x4
+ 1342 0056 07       		.byte	0x7
+ 1343 0057 00000000 		.long	.LASF7
+ 1344 005b 01       		.uleb128 0x1
+ 1345 005c 02       		.byte	0x2
+ 1346 005d 07       		.byte	0x7
+ 1347 005e 00000000 		.long	.LASF8
+ 1348 0062 0C       		.uleb128 0xc
+ 1349 0063 10       		.byte	0x10
+ 1350 0064 01       		.byte	0x1
+ 1351 0065 BB       		.byte	0xbb
+ 1352 0066 09       		.byte	0x9
+ 1353 0067 84000000 		.long	0x84
+ 1354 006b 07       		.uleb128 0x7
+ 1355 006c 00000000 		.long	.LASF9
+ 1356 0070 BC       		.byte	0xbc
+ 1357 0071 1A       		.byte	0x1a
+ 1358 0072 84000000 		.long	0x84
+ 1359 0076 00       		.byte	0
+ 1360 0077 07       		.uleb128 0x7
+ 1361 0078 00000000 		.long	.LASF10
+ 1362 007c BD       		.byte	0xbd
+ 1363 007d 0C       		.byte	0xc
+ 1364 007e 25000000 		.long	0x25
+ 1365 0082 08       		.byte	0x8
+ 1366 0083 00       		.byte	0
+ 1367 0084 08       		.uleb128 0x8
+ 1368 0085 90000000 		.long	0x90
+ 1369 0089 01       		.uleb128 0x1
+ 1370 008a 01       		.byte	0x1
+ 1371 008b 08       		.byte	0x8
+ 1372 008c 00000000 		.long	.LASF11
+ 1373 0090 03       		.uleb128 0x3
+ 1374 0091 89000000 		.long	0x89
+ 1375 0095 06       		.uleb128 0x6
+ 1376 0096 00000000 		.long	.LASF13
+ 1377 009a 01       		.byte	0x1
+ 1378 009b BE       		.byte	0xbe
+ 1379 009c 03       		.byte	0x3
+ 1380 009d 62000000 		.long	0x62
+ 1381 00a1 03       		.uleb128 0x3
+ 1382 00a2 95000000 		.long	0x95
+ 1383 00a6 08       		.uleb128 0x8
+ 1384 00a7 A1000000 		.long	0xa1
+ 1385 00ab 04       		.uleb128 0x4
+GAS LISTING /tmp/ccTtNBwq.s 			page 62
+
+
+ 1386 00ac 00000000 		.long	.LASF14
+ 1387 00b0 21       		.byte	0x21
+ 1388 00b1 A6000000 		.long	0xa6
+ 1389 00b5 04       		.uleb128 0x4
+ 1390 00b6 00000000 		.long	.LASF15
+ 1391 00ba 23       		.byte	0x23
+ 1392 00bb A6000000 		.long	0xa6
+ 1393 00bf 04       		.uleb128 0x4
+ 1394 00c0 00000000 		.long	.LASF16
+ 1395 00c4 25       		.byte	0x25
+ 1396 00c5 A6000000 		.long	0xa6
+ 1397 00c9 04       		.uleb128 0x4
+ 1398 00ca 00000000 		.long	.LASF17
+ 1399 00ce 28       		.byte	0x28
+ 1400 00cf A6000000 		.long	0xa6
+ 1401 00d3 09       		.uleb128 0x9
+ 1402 00d4 90000000 		.long	0x90
+ 1403 00d8 E3000000 		.long	0xe3
+ 1404 00dc 0D       		.uleb128 0xd
+ 1405 00dd 31000000 		.long	0x31
+ 1406 00e1 27       		.byte	0x27
+ 1407 00e2 00       		.byte	0
+ 1408 00e3 03       		.uleb128 0x3
+ 1409 00e4 D3000000 		.long	0xd3
+ 1410 00e8 02       		.uleb128 0x2
+ 1411 00e9 00000000 		.long	.LASF18
+ 1412 00ed 20       		.byte	0x20
+ 1413 00ee 1C       		.byte	0x1c
+ 1414 00ef E3000000 		.long	0xe3
+ 1415 00f3 09       		.uleb128 0x9
+ 1416 00f4 03       		.byte	0x3
+ 1417 00f5 00000000 		.quad	discrete_data
+ 1417      00000000 
+ 1418 00fd 02       		.uleb128 0x2
+ 1419 00fe 00000000 		.long	.LASF19
+ 1420 0102 23       		.byte	0x23
+ 1421 0103 24       		.byte	0x24
+ 1422 0104 A1000000 		.long	0xa1
+ 1423 0108 09       		.uleb128 0x9
+ 1424 0109 03       		.byte	0x3
+ 1425 010a 00000000 		.quad	discrete
+ 1425      00000000 
+ 1426 0112 05       		.uleb128 0x5
+ 1427 0113 AB000000 		.long	0xab
+ 1428 0117 24       		.byte	0x24
+ 1429 0118 09       		.uleb128 0x9
+ 1430 0119 03       		.byte	0x3
+ 1431 011a 00000000 		.quad	heatmap_cs_RdPu_discrete
+ 1431      00000000 
+ 1432 0122 09       		.uleb128 0x9
+ 1433 0123 90000000 		.long	0x90
+ 1434 0127 33010000 		.long	0x133
+ 1435 012b 0E       		.uleb128 0xe
+ 1436 012c 31000000 		.long	0x31
+ 1437 0130 0310     		.value	0x1003
+ 1438 0132 00       		.byte	0
+ 1439 0133 03       		.uleb128 0x3
+GAS LISTING /tmp/ccTtNBwq.s 			page 63
+
+
+ 1440 0134 22010000 		.long	0x122
+ 1441 0138 02       		.uleb128 0x2
+ 1442 0139 00000000 		.long	.LASF20
+ 1443 013d 26       		.byte	0x26
+ 1444 013e 1C       		.byte	0x1c
+ 1445 013f 33010000 		.long	0x133
+ 1446 0143 09       		.uleb128 0x9
+ 1447 0144 03       		.byte	0x3
+ 1448 0145 00000000 		.quad	soft_data
+ 1448      00000000 
+ 1449 014d 02       		.uleb128 0x2
+ 1450 014e 00000000 		.long	.LASF21
+ 1451 0152 29       		.byte	0x29
+ 1452 0153 24       		.byte	0x24
+ 1453 0154 A1000000 		.long	0xa1
+ 1454 0158 09       		.uleb128 0x9
+ 1455 0159 03       		.byte	0x3
+ 1456 015a 00000000 		.quad	soft
+ 1456      00000000 
+ 1457 0162 05       		.uleb128 0x5
+ 1458 0163 B5000000 		.long	0xb5
+ 1459 0167 2A       		.byte	0x2a
+ 1460 0168 09       		.uleb128 0x9
+ 1461 0169 03       		.byte	0x3
+ 1462 016a 00000000 		.quad	heatmap_cs_RdPu_soft
+ 1462      00000000 
+ 1463 0172 02       		.uleb128 0x2
+ 1464 0173 00000000 		.long	.LASF22
+ 1465 0177 2C       		.byte	0x2c
+ 1466 0178 1C       		.byte	0x1c
+ 1467 0179 33010000 		.long	0x133
+ 1468 017d 09       		.uleb128 0x9
+ 1469 017e 03       		.byte	0x3
+ 1470 017f 00000000 		.quad	mixed_data
+ 1470      00000000 
+ 1471 0187 02       		.uleb128 0x2
+ 1472 0188 00000000 		.long	.LASF23
+ 1473 018c 2F       		.byte	0x2f
+ 1474 018d 24       		.byte	0x24
+ 1475 018e A1000000 		.long	0xa1
+ 1476 0192 09       		.uleb128 0x9
+ 1477 0193 03       		.byte	0x3
+ 1478 0194 00000000 		.quad	mixed
+ 1478      00000000 
+ 1479 019c 05       		.uleb128 0x5
+ 1480 019d BF000000 		.long	0xbf
+ 1481 01a1 30       		.byte	0x30
+ 1482 01a2 09       		.uleb128 0x9
+ 1483 01a3 03       		.byte	0x3
+ 1484 01a4 00000000 		.quad	heatmap_cs_RdPu_mixed
+ 1484      00000000 
+ 1485 01ac 02       		.uleb128 0x2
+ 1486 01ad 00000000 		.long	.LASF24
+ 1487 01b1 32       		.byte	0x32
+ 1488 01b2 1C       		.byte	0x1c
+ 1489 01b3 33010000 		.long	0x133
+ 1490 01b7 09       		.uleb128 0x9
+GAS LISTING /tmp/ccTtNBwq.s 			page 64
+
+
+ 1491 01b8 03       		.byte	0x3
+ 1492 01b9 00000000 		.quad	mixed_exp_data
+ 1492      00000000 
+ 1493 01c1 02       		.uleb128 0x2
+ 1494 01c2 00000000 		.long	.LASF25
+ 1495 01c6 35       		.byte	0x35
+ 1496 01c7 24       		.byte	0x24
+ 1497 01c8 A1000000 		.long	0xa1
+ 1498 01cc 09       		.uleb128 0x9
+ 1499 01cd 03       		.byte	0x3
+ 1500 01ce 00000000 		.quad	mixed_exp
+ 1500      00000000 
+ 1501 01d6 05       		.uleb128 0x5
+ 1502 01d7 C9000000 		.long	0xc9
+ 1503 01db 36       		.byte	0x36
+ 1504 01dc 09       		.uleb128 0x9
+ 1505 01dd 03       		.byte	0x3
+ 1506 01de 00000000 		.quad	heatmap_cs_RdPu_mixed_exp
+ 1506      00000000 
+ 1507 01e6 00       		.byte	0
+ 1508              		.section	.debug_abbrev,"",@progbits
+ 1509              	.Ldebug_abbrev0:
+ 1510 0000 01       		.uleb128 0x1
+ 1511 0001 24       		.uleb128 0x24
+ 1512 0002 00       		.byte	0
+ 1513 0003 0B       		.uleb128 0xb
+ 1514 0004 0B       		.uleb128 0xb
+ 1515 0005 3E       		.uleb128 0x3e
+ 1516 0006 0B       		.uleb128 0xb
+ 1517 0007 03       		.uleb128 0x3
+ 1518 0008 0E       		.uleb128 0xe
+ 1519 0009 00       		.byte	0
+ 1520 000a 00       		.byte	0
+ 1521 000b 02       		.uleb128 0x2
+ 1522 000c 34       		.uleb128 0x34
+ 1523 000d 00       		.byte	0
+ 1524 000e 03       		.uleb128 0x3
+ 1525 000f 0E       		.uleb128 0xe
+ 1526 0010 3A       		.uleb128 0x3a
+ 1527 0011 21       		.uleb128 0x21
+ 1528 0012 04       		.sleb128 4
+ 1529 0013 3B       		.uleb128 0x3b
+ 1530 0014 0B       		.uleb128 0xb
+ 1531 0015 39       		.uleb128 0x39
+ 1532 0016 0B       		.uleb128 0xb
+ 1533 0017 49       		.uleb128 0x49
+ 1534 0018 13       		.uleb128 0x13
+ 1535 0019 02       		.uleb128 0x2
+ 1536 001a 18       		.uleb128 0x18
+ 1537 001b 00       		.byte	0
+ 1538 001c 00       		.byte	0
+ 1539 001d 03       		.uleb128 0x3
+ 1540 001e 26       		.uleb128 0x26
+ 1541 001f 00       		.byte	0
+ 1542 0020 49       		.uleb128 0x49
+ 1543 0021 13       		.uleb128 0x13
+ 1544 0022 00       		.byte	0
+GAS LISTING /tmp/ccTtNBwq.s 			page 65
+
+
+ 1545 0023 00       		.byte	0
+ 1546 0024 04       		.uleb128 0x4
+ 1547 0025 34       		.uleb128 0x34
+ 1548 0026 00       		.byte	0
+ 1549 0027 03       		.uleb128 0x3
+ 1550 0028 0E       		.uleb128 0xe
+ 1551 0029 3A       		.uleb128 0x3a
+ 1552 002a 21       		.uleb128 0x21
+ 1553 002b 03       		.sleb128 3
+ 1554 002c 3B       		.uleb128 0x3b
+ 1555 002d 0B       		.uleb128 0xb
+ 1556 002e 39       		.uleb128 0x39
+ 1557 002f 21       		.uleb128 0x21
+ 1558 0030 25       		.sleb128 37
+ 1559 0031 49       		.uleb128 0x49
+ 1560 0032 13       		.uleb128 0x13
+ 1561 0033 3F       		.uleb128 0x3f
+ 1562 0034 19       		.uleb128 0x19
+ 1563 0035 3C       		.uleb128 0x3c
+ 1564 0036 19       		.uleb128 0x19
+ 1565 0037 00       		.byte	0
+ 1566 0038 00       		.byte	0
+ 1567 0039 05       		.uleb128 0x5
+ 1568 003a 34       		.uleb128 0x34
+ 1569 003b 00       		.byte	0
+ 1570 003c 47       		.uleb128 0x47
+ 1571 003d 13       		.uleb128 0x13
+ 1572 003e 3A       		.uleb128 0x3a
+ 1573 003f 21       		.uleb128 0x21
+ 1574 0040 04       		.sleb128 4
+ 1575 0041 3B       		.uleb128 0x3b
+ 1576 0042 0B       		.uleb128 0xb
+ 1577 0043 39       		.uleb128 0x39
+ 1578 0044 21       		.uleb128 0x21
+ 1579 0045 1E       		.sleb128 30
+ 1580 0046 02       		.uleb128 0x2
+ 1581 0047 18       		.uleb128 0x18
+ 1582 0048 00       		.byte	0
+ 1583 0049 00       		.byte	0
+ 1584 004a 06       		.uleb128 0x6
+ 1585 004b 16       		.uleb128 0x16
+ 1586 004c 00       		.byte	0
+ 1587 004d 03       		.uleb128 0x3
+ 1588 004e 0E       		.uleb128 0xe
+ 1589 004f 3A       		.uleb128 0x3a
+ 1590 0050 0B       		.uleb128 0xb
+ 1591 0051 3B       		.uleb128 0x3b
+ 1592 0052 0B       		.uleb128 0xb
+ 1593 0053 39       		.uleb128 0x39
+ 1594 0054 0B       		.uleb128 0xb
+ 1595 0055 49       		.uleb128 0x49
+ 1596 0056 13       		.uleb128 0x13
+ 1597 0057 00       		.byte	0
+ 1598 0058 00       		.byte	0
+ 1599 0059 07       		.uleb128 0x7
+ 1600 005a 0D       		.uleb128 0xd
+ 1601 005b 00       		.byte	0
+GAS LISTING /tmp/ccTtNBwq.s 			page 66
+
+
+ 1602 005c 03       		.uleb128 0x3
+ 1603 005d 0E       		.uleb128 0xe
+ 1604 005e 3A       		.uleb128 0x3a
+ 1605 005f 21       		.uleb128 0x21
+ 1606 0060 01       		.sleb128 1
+ 1607 0061 3B       		.uleb128 0x3b
+ 1608 0062 0B       		.uleb128 0xb
+ 1609 0063 39       		.uleb128 0x39
+ 1610 0064 0B       		.uleb128 0xb
+ 1611 0065 49       		.uleb128 0x49
+ 1612 0066 13       		.uleb128 0x13
+ 1613 0067 38       		.uleb128 0x38
+ 1614 0068 0B       		.uleb128 0xb
+ 1615 0069 00       		.byte	0
+ 1616 006a 00       		.byte	0
+ 1617 006b 08       		.uleb128 0x8
+ 1618 006c 0F       		.uleb128 0xf
+ 1619 006d 00       		.byte	0
+ 1620 006e 0B       		.uleb128 0xb
+ 1621 006f 21       		.uleb128 0x21
+ 1622 0070 08       		.sleb128 8
+ 1623 0071 49       		.uleb128 0x49
+ 1624 0072 13       		.uleb128 0x13
+ 1625 0073 00       		.byte	0
+ 1626 0074 00       		.byte	0
+ 1627 0075 09       		.uleb128 0x9
+ 1628 0076 01       		.uleb128 0x1
+ 1629 0077 01       		.byte	0x1
+ 1630 0078 49       		.uleb128 0x49
+ 1631 0079 13       		.uleb128 0x13
+ 1632 007a 01       		.uleb128 0x1
+ 1633 007b 13       		.uleb128 0x13
+ 1634 007c 00       		.byte	0
+ 1635 007d 00       		.byte	0
+ 1636 007e 0A       		.uleb128 0xa
+ 1637 007f 11       		.uleb128 0x11
+ 1638 0080 01       		.byte	0x1
+ 1639 0081 25       		.uleb128 0x25
+ 1640 0082 0E       		.uleb128 0xe
+ 1641 0083 13       		.uleb128 0x13
+ 1642 0084 0B       		.uleb128 0xb
+ 1643 0085 03       		.uleb128 0x3
+ 1644 0086 1F       		.uleb128 0x1f
+ 1645 0087 1B       		.uleb128 0x1b
+ 1646 0088 1F       		.uleb128 0x1f
+ 1647 0089 10       		.uleb128 0x10
+ 1648 008a 17       		.uleb128 0x17
+ 1649 008b 00       		.byte	0
+ 1650 008c 00       		.byte	0
+ 1651 008d 0B       		.uleb128 0xb
+ 1652 008e 24       		.uleb128 0x24
+ 1653 008f 00       		.byte	0
+ 1654 0090 0B       		.uleb128 0xb
+ 1655 0091 0B       		.uleb128 0xb
+ 1656 0092 3E       		.uleb128 0x3e
+ 1657 0093 0B       		.uleb128 0xb
+ 1658 0094 03       		.uleb128 0x3
+GAS LISTING /tmp/ccTtNBwq.s 			page 67
+
+
+ 1659 0095 08       		.uleb128 0x8
+ 1660 0096 00       		.byte	0
+ 1661 0097 00       		.byte	0
+ 1662 0098 0C       		.uleb128 0xc
+ 1663 0099 13       		.uleb128 0x13
+ 1664 009a 01       		.byte	0x1
+ 1665 009b 0B       		.uleb128 0xb
+ 1666 009c 0B       		.uleb128 0xb
+ 1667 009d 3A       		.uleb128 0x3a
+ 1668 009e 0B       		.uleb128 0xb
+ 1669 009f 3B       		.uleb128 0x3b
+ 1670 00a0 0B       		.uleb128 0xb
+ 1671 00a1 39       		.uleb128 0x39
+ 1672 00a2 0B       		.uleb128 0xb
+ 1673 00a3 01       		.uleb128 0x1
+ 1674 00a4 13       		.uleb128 0x13
+ 1675 00a5 00       		.byte	0
+ 1676 00a6 00       		.byte	0
+ 1677 00a7 0D       		.uleb128 0xd
+ 1678 00a8 21       		.uleb128 0x21
+ 1679 00a9 00       		.byte	0
+ 1680 00aa 49       		.uleb128 0x49
+ 1681 00ab 13       		.uleb128 0x13
+ 1682 00ac 2F       		.uleb128 0x2f
+ 1683 00ad 0B       		.uleb128 0xb
+ 1684 00ae 00       		.byte	0
+ 1685 00af 00       		.byte	0
+ 1686 00b0 0E       		.uleb128 0xe
+ 1687 00b1 21       		.uleb128 0x21
+ 1688 00b2 00       		.byte	0
+ 1689 00b3 49       		.uleb128 0x49
+ 1690 00b4 13       		.uleb128 0x13
+ 1691 00b5 2F       		.uleb128 0x2f
+ 1692 00b6 05       		.uleb128 0x5
+ 1693 00b7 00       		.byte	0
+ 1694 00b8 00       		.byte	0
+ 1695 00b9 00       		.byte	0
+ 1696              		.section	.debug_aranges,"",@progbits
+ 1697 0000 1C000000 		.long	0x1c
+ 1698 0004 0200     		.value	0x2
+ 1699 0006 00000000 		.long	.Ldebug_info0
+ 1700 000a 08       		.byte	0x8
+ 1701 000b 00       		.byte	0
+ 1702 000c 0000     		.value	0
+ 1703 000e 0000     		.value	0
+ 1704 0010 00000000 		.quad	0
+ 1704      00000000 
+ 1705 0018 00000000 		.quad	0
+ 1705      00000000 
+ 1706              		.section	.debug_line,"",@progbits
+ 1707              	.Ldebug_line0:
+ 1708 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1708      05000800 
+ 1708      49000000 
+ 1708      010101FB 
+ 1708      0E0D0001 
+ 1709              	.LASF20:
+GAS LISTING /tmp/ccTtNBwq.s 			page 68
+
+
+ 1710 0000 736F6674 		.string	"soft_data"
+ 1710      5F646174 
+ 1710      6100
+ 1711              	.LASF12:
+ 1712 000a 73697A65 		.string	"size_t"
+ 1712      5F7400
+ 1713              	.LASF13:
+ 1714 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1714      6D61705F 
+ 1714      636F6C6F 
+ 1714      72736368 
+ 1714      656D655F 
+ 1715              	.LASF17:
+ 1716 0027 68656174 		.string	"heatmap_cs_RdPu_mixed_exp"
+ 1716      6D61705F 
+ 1716      63735F52 
+ 1716      6450755F 
+ 1716      6D697865 
+ 1717              	.LASF26:
+ 1718 0041 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1718      43313720 
+ 1718      31322E32 
+ 1718      2E30202D 
+ 1718      6D74756E 
+ 1719              	.LASF6:
+ 1720 00a0 666C6F61 		.string	"float"
+ 1720      7400
+ 1721              	.LASF11:
+ 1722 00a6 756E7369 		.string	"unsigned char"
+ 1722      676E6564 
+ 1722      20636861 
+ 1722      7200
+ 1723              	.LASF3:
+ 1724 00b4 6C6F6E67 		.string	"long unsigned int"
+ 1724      20756E73 
+ 1724      69676E65 
+ 1724      6420696E 
+ 1724      7400
+ 1725              	.LASF8:
+ 1726 00c6 73686F72 		.string	"short unsigned int"
+ 1726      7420756E 
+ 1726      7369676E 
+ 1726      65642069 
+ 1726      6E7400
+ 1727              	.LASF25:
+ 1728 00d9 6D697865 		.string	"mixed_exp"
+ 1728      645F6578 
+ 1728      7000
+ 1729              	.LASF23:
+ 1730 00e3 6D697865 		.string	"mixed"
+ 1730      6400
+ 1731              	.LASF16:
+ 1732 00e9 68656174 		.string	"heatmap_cs_RdPu_mixed"
+ 1732      6D61705F 
+ 1732      63735F52 
+ 1732      6450755F 
+ 1732      6D697865 
+GAS LISTING /tmp/ccTtNBwq.s 			page 69
+
+
+ 1733              	.LASF15:
+ 1734 00ff 68656174 		.string	"heatmap_cs_RdPu_soft"
+ 1734      6D61705F 
+ 1734      63735F52 
+ 1734      6450755F 
+ 1734      736F6674 
+ 1735              	.LASF7:
+ 1736 0114 756E7369 		.string	"unsigned int"
+ 1736      676E6564 
+ 1736      20696E74 
+ 1736      00
+ 1737              	.LASF19:
+ 1738 0121 64697363 		.string	"discrete"
+ 1738      72657465 
+ 1738      00
+ 1739              	.LASF14:
+ 1740 012a 68656174 		.string	"heatmap_cs_RdPu_discrete"
+ 1740      6D61705F 
+ 1740      63735F52 
+ 1740      6450755F 
+ 1740      64697363 
+ 1741              	.LASF10:
+ 1742 0143 6E636F6C 		.string	"ncolors"
+ 1742      6F727300 
+ 1743              	.LASF4:
+ 1744 014b 6C6F6E67 		.string	"long long int"
+ 1744      206C6F6E 
+ 1744      6720696E 
+ 1744      7400
+ 1745              	.LASF24:
+ 1746 0159 6D697865 		.string	"mixed_exp_data"
+ 1746      645F6578 
+ 1746      705F6461 
+ 1746      746100
+ 1747              	.LASF22:
+ 1748 0168 6D697865 		.string	"mixed_data"
+ 1748      645F6461 
+ 1748      746100
+ 1749              	.LASF2:
+ 1750 0173 6C6F6E67 		.string	"long int"
+ 1750      20696E74 
+ 1750      00
+ 1751              	.LASF5:
+ 1752 017c 6C6F6E67 		.string	"long double"
+ 1752      20646F75 
+ 1752      626C6500 
+ 1753              	.LASF18:
+ 1754 0188 64697363 		.string	"discrete_data"
+ 1754      72657465 
+ 1754      5F646174 
+ 1754      6100
+ 1755              	.LASF21:
+ 1756 0196 736F6674 		.string	"soft"
+ 1756      00
+ 1757              	.LASF9:
+ 1758 019b 636F6C6F 		.string	"colors"
+ 1758      727300
+GAS LISTING /tmp/ccTtNBwq.s 			page 70
+
+
+ 1759              		.section	.debug_line_str,"MS",@progbits,1
+ 1760              	.LASF1:
+ 1761 0000 2F726F6F 		.string	"/root/repo"
+ 1761      742F7265 
+ 1761      706F00
+ 1762              	.LASF0:
+ 1763 000b 636F6C6F 		.string	"colorschemes/RdPu.c"
+ 1763      72736368 
+ 1763      656D6573 
+ 1763      2F526450 
+ 1763      752E6300 
+ 1764              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1765 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1765      742F7265 
+ 1765      706F0063 
+ 1765      6F6C6F72 
+ 1765      73636865 
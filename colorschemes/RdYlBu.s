@@ -0,0 +1,3847 @@
+GAS LISTING /tmp/ccuplHTA.s 			page 1
+
+
+   1              		.file	"RdYlBu.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/RdYlBu.c"
+   5              		.globl	heatmap_cs_RdYlBu_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_RdYlBu_mixed_exp, @object
+   9              		.size	heatmap_cs_RdYlBu_mixed_exp, 8
+  10              	heatmap_cs_RdYlBu_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 31369500 		.string	"16\225"
+  29 0008 303B9818 		.ascii	"0;\230\030/@\2331/E\236J0J\240c1O\243|6`\253\2258d\255\256;i"
+  29      2F409B31 
+  29      2F459E4A 
+  29      304AA063 
+  29      314FA37C 
+  30 0026 AFC73E6D 		.ascii	"\257\307>m\261\340Bq\262\371Ev\264\377Gz\267\377I~\271\377L\202"
+  30      B1E04271 
+  30      B2F94576 
+  30      B4FF477A 
+  30      B7FF497E 
+  31 003e BBFF4F85 		.ascii	"\273\377O\205\275\377R\211\277\377^\230\307\377b\234\311\377"
+  31      BDFF5289 
+  31      BFFF5E98 
+  31      C7FF629C 
+  31      C9FF
+  32 0050 65A0CAFF 		.ascii	"e\240\312\377i\243\314\377m\247\316\377q\252\320\377u\256\321"
+  32      69A3CCFF 
+  32      6DA7CEFF 
+  32      71AAD0FF 
+  32      75AED1
+  33 0063 FF78B0D3 		.ascii	"\377x\260\323\377{\263\324\377~\266\326\377\202\271\327\377\205"
+  33      FF7BB3D4 
+  33      FF7EB6D6 
+  33      FF82B9D7 
+  33      FF85
+  34 0075 BBD8FF88 		.ascii	"\273\330\377\210\276\332\377\226\312\340\377\232\314\342\377"
+GAS LISTING /tmp/ccuplHTA.s 			page 2
+
+
+  34      BEDAFF96 
+  34      CAE0FF9A 
+  34      CCE2FF
+  35 0084 9DCFE3FF 		.ascii	"\235\317\343\377\241\321\344\377\244\324\346\377\247\326\347"
+  35      A1D1E4FF 
+  35      A4D4E6FF 
+  35      A7D6E7
+  36 0093 FFABD9E9 		.ascii	"\377\253\331\351\377\256\332\351\377\261\334\352\377\264\335"
+  36      FFAEDAE9 
+  36      FFB1DCEA 
+  36      FFB4DD
+  37 00a2 EBFFB7DF 		.ascii	"\353\377\267\337\354\377\272\340\354\377\274\341\355\377\277"
+  37      ECFFBAE0 
+  37      ECFFBCE1 
+  37      EDFFBF
+  38 00b1 E3EEFFCD 		.ascii	"\343\356\377\315\351\362\377\317\353\363\377\322\354\363\377"
+  38      E9F2FFCF 
+  38      EBF3FFD2 
+  38      ECF3FF
+  39 00c0 D5EDF4FF 		.ascii	"\325\355\364\377\330\357\365\377\332\360\366\377\335\361\367"
+  39      D8EFF5FF 
+  39      DAF0F6FF 
+  39      DDF1F7
+  40 00cf FFDFF3F8 		.ascii	"\377\337\363\370\377\335\364\370\377\332\365\371\377\330\367"
+  40      FFDDF4F8 
+  40      FFDAF5F9 
+  40      FFD8F7
+  41 00de F8FFD6F8 		.ascii	"\370\377\326\370\367\377\324\371\366\377\323\372\364\377\323"
+  41      F7FFD4F9 
+  41      F6FFD3FA 
+  41      F4FFD3
+  42 00ed FBF1FFD3 		.ascii	"\373\361\377\323\374\356\377\333\377\337\377\335\377\334\377"
+  42      FCEEFFDB 
+  42      FFDFFFDD 
+  42      FFDCFF
+  43 00fc DFFFD8FF 		.ascii	"\337\377\330\377\343\377\324\377\347\377\317\377\353\377\313"
+  43      E3FFD4FF 
+  43      E7FFCFFF 
+  43      EBFFCB
+  44 010b FFF0FFC7 		.ascii	"\377\360\377\307\377\365\377\304\377\373\377\300\377\376\376"
+  44      FFF5FFC4 
+  44      FFFBFFC0 
+  44      FFFEFE
+  45 011a BEFFFEFD 		.ascii	"\276\377\376\375\274\377\376\374\272\377\376\372\270\377\376"
+  45      BCFFFEFC 
+  45      BAFFFEFA 
+  45      B8FFFE
+  46 0129 F9B6FFFE 		.ascii	"\371\266\377\376\370\264\377\376\367\262\377\376\366\260\377"
+  46      F8B4FFFE 
+  46      F7B2FFFE 
+  46      F6B0FF
+  47 0138 FDF4AEFF 		.ascii	"\375\364\256\377\375\363\254\377\375\354\241\377\375\353\237"
+  47      FDF3ACFF 
+  47      FDECA1FF 
+  47      FDEB9F
+  48 0147 FFFDE99D 		.ascii	"\377\375\351\235\377\375\350\234\377\375\347\232\377\375\346"
+  48      FFFDE89C 
+GAS LISTING /tmp/ccuplHTA.s 			page 3
+
+
+  48      FFFDE79A 
+  48      FFFDE6
+  49 0156 98FFFDE5 		.ascii	"\230\377\375\345\227\377\375\344\225\377\375\343\224\377\375"
+  49      97FFFDE4 
+  49      95FFFDE3 
+  49      94FFFD
+  50 0165 E192FFFD 		.ascii	"\341\222\377\375\340\220\377\375\337\217\377\375\335\215\377"
+  50      E090FFFD 
+  50      DF8FFFFD 
+  50      DD8DFF
+  51 0174 FDDC8BFF 		.ascii	"\375\334\213\377\375\332\211\377\375\331\207\377\375\327\206"
+  51      FDDA89FF 
+  51      FDD987FF 
+  51      FDD786
+  52 0183 FFFDD584 		.ascii	"\377\375\325\204\377\375\324\202\377\375\322\201\377\375\321"
+  52      FFFDD482 
+  52      FFFDD281 
+  52      FFFDD1
+  53 0192 7FFFFDCF 		.ascii	"\177\377\375\317~\377\375\316|\377\375\314{\377\375\301p\377"
+  53      7EFFFDCE 
+  53      7CFFFDCC 
+  53      7BFFFDC1 
+  53      70FF
+  54 01a4 FDBF6EFF 		.ascii	"\375\277n\377\375\276m\377\375\274l\377\375\273j\377\375\271"
+  54      FDBE6DFF 
+  54      FDBC6CFF 
+  54      FDBB6AFF 
+  54      FDB9
+  55 01b6 69FFFDB8 		.ascii	"i\377\375\270h\377\375\266g\377\375\265f\377\375\263e\377\375"
+  55      68FFFDB6 
+  55      67FFFDB5 
+  55      66FFFDB3 
+  55      65FFFD
+  56 01c9 B264FFFD 		.ascii	"\262d\377\375\261c\377\375\257b\377\375\256a\377\374\254_\377"
+  56      B163FFFD 
+  56      AF62FFFD 
+  56      AE61FFFC 
+  56      AC5FFF
+  57 01dc FCAB5EFF 		.ascii	"\374\253^\377\374\251]\377\374\247\\\377\374\246[\377\373\244"
+  57      FCA95DFF 
+  57      FCA75CFF 
+  57      FCA65BFF 
+  57      FBA4
+  58 01ee 5AFFFBA3 		.ascii	"Z\377\373\243Y\377\373\241X\377\373\240W\377\373\236V\377\372"
+  58      59FFFBA1 
+  58      58FFFBA0 
+  58      57FFFB9E 
+  58      56FFFA
+  59 0201 9D56FFFA 		.ascii	"\235V\377\372\233U\377\372\232T\377\372\230S\377\372\227R\377"
+  59      9B55FFFA 
+  59      9A54FFFA 
+  59      9853FFFA 
+  59      9752FF
+  60 0214 FA9552FF 		.ascii	"\372\225R\377\370\207K\377\367\206J\377\367\204J\377\367\203"
+  60      F8874BFF 
+  60      F7864AFF 
+  60      F7844AFF 
+GAS LISTING /tmp/ccuplHTA.s 			page 4
+
+
+  60      F783
+  61 0226 49FFF781 		.ascii	"I\377\367\201I\377\367\200H\377\366\177H\377\366}G\377\366|G"
+  61      49FFF780 
+  61      48FFF67F 
+  61      48FFF67D 
+  61      47FFF67C 
+  62 023b FFF67A46 		.ascii	"\377\366zF\377\365yF\377\365xE\377\365vE\377\365uD\377\365tD"
+  62      FFF57946 
+  62      FFF57845 
+  62      FFF57645 
+  62      FFF57544 
+  63 0253 FFF47244 		.ascii	"\377\364rD\377\364qC\377\364oC\377\364nC\377\364mC\377\363lB"
+  63      FFF47143 
+  63      FFF46F43 
+  63      FFF46E43 
+  63      FFF46D43 
+  64 026b FFF36B41 		.ascii	"\377\363kA\377\362jA\377\362i@\377\361h@\377\361g?\377\360f?"
+  64      FFF26A41 
+  64      FFF26940 
+  64      FFF16840 
+  64      FFF1673F 
+  65 0283 FFF0653E 		.ascii	"\377\360e>\377\357d>\377\357c=\377\356b=\377\356a<\377\355a<"
+  65      FFEF643E 
+  65      FFEF633D 
+  65      FFEE623D 
+  65      FFEE613C 
+  66 029b FFED603B 		.ascii	"\377\355`;\377\354_;\377\354^:\377\353]:\377\353\\9\377\353["
+  66      FFEC5F3B 
+  66      FFEC5E3A 
+  66      FFEB5D3A 
+  66      FFEB5C39 
+  67 02b2 39FFEA5A 		.ascii	"9\377\352Z9\377\352Z8\377\351Y8\377\351X7\377\350W7\377\342J"
+  67      39FFEA5A 
+  67      38FFE959 
+  67      38FFE958 
+  67      37FFE857 
+  68 02ca 31FFE249 		.ascii	"1\377\342I0\377\341H0\377\341H0\377\341G/\377\340F/\377\340E"
+  68      30FFE148 
+  68      30FFE148 
+  68      30FFE147 
+  68      2FFFE046 
+  69 02e2 2FFFDF44 		.ascii	"/\377\337D.\377\337D.\377\337C.\377\336B-\377\336A-\377\336@"
+  69      2EFFDF44 
+  69      2EFFDF43 
+  69      2EFFDE42 
+  69      2DFFDE41 
+  70 02fa 2DFFDD40 		.ascii	"-\377\335@,\377\335?,\377\335>,\377\334=+\377\334<+\377\333<"
+  70      2CFFDD3F 
+  70      2CFFDD3E 
+  70      2CFFDC3D 
+  70      2BFFDC3C 
+  71 0312 2BFFDB3B 		.ascii	"+\377\333;*\377\333:*\377\3329*\377\3328)\377\3328)\377\3317"
+  71      2AFFDB3A 
+  71      2AFFDA39 
+  71      2AFFDA38 
+  71      29FFDA38 
+  72 032a 29FFD936 		.ascii	")\377\3316)\377\3315(\377\3315(\377\3304(\377\3303(\377\3302"
+GAS LISTING /tmp/ccuplHTA.s 			page 5
+
+
+  72      29FFD935 
+  72      28FFD935 
+  72      28FFD834 
+  72      28FFD833 
+  73 0342 27FFD732 		.ascii	"'\377\3272'\377\3271'\377\3270'\377\326/'\377\326/'\377\325/"
+  73      27FFD731 
+  73      27FFD730 
+  73      27FFD62F 
+  73      27FFD62F 
+  74 035a 27FFD52E 		.ascii	"'\377\325.'\377\324.'\377\324-'\377\324-'\377\323-'\377\323,"
+  74      27FFD42E 
+  74      27FFD42D 
+  74      27FFD42D 
+  74      27FFD32D 
+  75 0372 27FFD22C 		.ascii	"'\377\322,'\377\322,'\377\321+'\377\321+'\377\321+'\377\320*"
+  75      27FFD22C 
+  75      27FFD12B 
+  75      27FFD12B 
+  75      27FFD12B 
+  76 038a 27FFD02A 		.ascii	"'\377\320*'\377\317)'\377\317)'\377\316)'\377\316('\377\316("
+  76      27FFCF29 
+  76      27FFCF29 
+  76      27FFCE29 
+  76      27FFCE28 
+  77 03a2 27FFCD28 		.ascii	"'\377\315('\377\315('\377\315''\377\314''\377\314''\377\313&"
+  77      27FFCD28 
+  77      27FFCD27 
+  77      27FFCC27 
+  77      27FFCC27 
+  78 03ba 27FFCB26 		.ascii	"'\377\313&'\377\313&'\377\312%'\377\312%'\377\312%'\377\311$"
+  78      27FFCB26 
+  78      27FFCA25 
+  78      27FFCA25 
+  78      27FFCA25 
+  79 03d2 27FFC924 		.ascii	"'\377\311$'\377\311$'\377\310$'\377\310#'\377\310#'\377\307#"
+  79      27FFC924 
+  79      27FFC824 
+  79      27FFC823 
+  79      27FFC823 
+  80 03ea 27FFC723 		.ascii	"'\377\307#'\377\307\"'\377\306\"'\377\306\"'\377\306!'\377\306"
+  80      27FFC722 
+  80      27FFC622 
+  80      27FFC622 
+  80      27FFC621 
+  81 0401 2127FFC5 		.ascii	"!'\377\305!'\377\305!'\377\305 '\377\304 '\377\304 '\377\304"
+  81      2127FFC5 
+  81      2127FFC5 
+  81      2027FFC4 
+  81      2027FFC4 
+  82 0419 2027FFC4 		.ascii	" '\377\304\037'\377\303\037'\377\303\037'\377\303\037'\377\270"
+  82      1F27FFC3 
+  82      1F27FFC3 
+  82      1F27FFC3 
+  82      1F27FFB8 
+  83 042d 1527FFB8 		.ascii	"\025'\377\270\025'\377\270\024'\377\270\024'\377\267\024'\377"
+  83      1527FFB8 
+  83      1427FFB8 
+GAS LISTING /tmp/ccuplHTA.s 			page 6
+
+
+  83      1427FFB7 
+  83      1427FF
+  84 0440 B71427FF 		.ascii	"\267\024'\377\267\024'\377\267\023'\377\266\023'\377\266\023"
+  84      B71427FF 
+  84      B71327FF 
+  84      B61327FF 
+  84      B613
+  85 0452 27FFB613 		.ascii	"'\377\266\023'\377\266\022'\377\266\022'\377\265\022'\377\265"
+  85      27FFB612 
+  85      27FFB612 
+  85      27FFB512 
+  85      27FFB5
+  86 0465 1227FFB5 		.ascii	"\022'\377\265\022'\377\265\021'\377\264\021'\377\264\021'\377"
+  86      1227FFB5 
+  86      1127FFB4 
+  86      1127FFB4 
+  86      1127FF
+  87 0478 B41127FF 		.ascii	"\264\021'\377\264\021'\377\264\020'\377\263\020'\377\263\020"
+  87      B41127FF 
+  87      B41027FF 
+  87      B31027FF 
+  87      B310
+  88 048a 27FFB310 		.ascii	"'\377\263\020'\377\263\020&\377\263\017&\377\262\017&\377\262"
+  88      27FFB310 
+  88      26FFB30F 
+  88      26FFB20F 
+  88      26FFB2
+  89 049d 0F26FFB2 		.ascii	"\017&\377\262\017&\377\262\017&\377\262\016&\377\262\016&\377"
+  89      0F26FFB2 
+  89      0F26FFB2 
+  89      0E26FFB2 
+  89      0E26FF
+  90 04b0 B10E26FF 		.ascii	"\261\016&\377\261\016&\377\261\016&\377\261\016&\377\261\r&\377"
+  90      B10E26FF 
+  90      B10E26FF 
+  90      B10E26FF 
+  90      B10D26FF 
+  91 04c4 B00D26FF 		.ascii	"\260\r&\377\260\r&\377\260\r&\377\260\r&\377\260\r&\377\260\f"
+  91      B00D26FF 
+  91      B00D26FF 
+  91      B00D26FF 
+  91      B00D26FF 
+  92 04da 26FFB00C 		.ascii	"&\377\260\f&\377\257\f&\377\257\f&\377\257\f&\377\257\f&\377"
+  92      26FFAF0C 
+  92      26FFAF0C 
+  92      26FFAF0C 
+  92      26FFAF0C 
+  93 04f0 AF0B26FF 		.ascii	"\257\013&\377\257\013&\377\256\013&\377\256\013&\377\256\013"
+  93      AF0B26FF 
+  93      AE0B26FF 
+  93      AE0B26FF 
+  93      AE0B
+  94 0502 26FFAE0B 		.ascii	"&\377\256\013&\377\256\013&\377\256\n&\377\256\n&\377\256\n&"
+  94      26FFAE0B 
+  94      26FFAE0A 
+  94      26FFAE0A 
+  94      26FFAE0A 
+GAS LISTING /tmp/ccuplHTA.s 			page 7
+
+
+  95 0517 FFAD0A26 		.ascii	"\377\255\n&\377\255\n&\377\255\n&\377\255\t&\377\255\t&\377\255"
+  95      FFAD0A26 
+  95      FFAD0A26 
+  95      FFAD0926 
+  95      FFAD0926 
+  96 052d 0926FFAD 		.ascii	"\t&\377\255\t&\377\255\t&\377\254\t&\377\254\t&\377\254\b&\377"
+  96      0926FFAD 
+  96      0926FFAC 
+  96      0926FFAC 
+  96      0926FFAC 
+  97 0544 AC0826FF 		.ascii	"\254\b&\377\254\b&\377\254\b&\377\254\b&\377\254\b&\377\254\b"
+  97      AC0826FF 
+  97      AC0826FF 
+  97      AC0826FF 
+  97      AC0826FF 
+  98 055a 26FFAB08 		.ascii	"&\377\253\b&\377\253\007&\377\253\007&\377\253\007&\377\253\007"
+  98      26FFAB07 
+  98      26FFAB07 
+  98      26FFAB07 
+  98      26FFAB07 
+  99 056e 26FFAB07 		.ascii	"&\377\253\007&\377\253\007&\377\253\007&\377\253\007&\377\253"
+  99      26FFAB07 
+  99      26FFAB07 
+  99      26FFAB07 
+  99      26FFAB
+ 100 0581 0626FFAB 		.ascii	"\006&\377\253\006&\377\252\006&\377\252\006&\377\252\006&\377"
+ 100      0626FFAA 
+ 100      0626FFAA 
+ 100      0626FFAA 
+ 100      0626FF
+ 101 0594 AA0626FF 		.ascii	"\252\006&\377\252\006&\377\252\006&\377\252\006&\377\252\005"
+ 101      AA0626FF 
+ 101      AA0626FF 
+ 101      AA0626FF 
+ 101      AA05
+ 102 05a6 26FFAA05 		.ascii	"&\377\252\005&\377\252\005&\377\252\005&\377\252\005&\377\251"
+ 102      26FFAA05 
+ 102      26FFAA05 
+ 102      26FFAA05 
+ 102      26FFA9
+ 103 05b9 0526FFA9 		.ascii	"\005&\377\251\005&\377\251\005&\377\251\005&\377\251\005&\377"
+ 103      0526FFA9 
+ 103      0526FFA9 
+ 103      0526FFA9 
+ 103      0526FF
+ 104 05cc A90526FF 		.ascii	"\251\005&\377\251\004&\377\251\004&\377\251\004&\377\251\004"
+ 104      A90426FF 
+ 104      A90426FF 
+ 104      A90426FF 
+ 104      A904
+ 105 05de 26FFA904 		.ascii	"&\377\251\004&\377\251\004&\377\251\004&\377\251\004&\377\250"
+ 105      26FFA904 
+ 105      26FFA904 
+ 105      26FFA904 
+ 105      26FFA8
+ 106 05f1 0426FFA8 		.ascii	"\004&\377\250\004&\377\250\004&\377\250\004&\377\250\004&\377"
+ 106      0426FFA8 
+GAS LISTING /tmp/ccuplHTA.s 			page 8
+
+
+ 106      0426FFA8 
+ 106      0426FFA8 
+ 106      0426FF
+ 107 0604 A80426FF 		.ascii	"\250\004&\377\250\003&\377\250\003&\377\250\003&\377\250\003"
+ 107      A80326FF 
+ 107      A80326FF 
+ 107      A80326FF 
+ 107      A803
+ 108 0616 26FFA803 		.ascii	"&\377\250\003&\377\250\003&\377\250\003&\377\250\003&\377\250"
+ 108      26FFA803 
+ 108      26FFA803 
+ 108      26FFA803 
+ 108      26FFA8
+ 109 0629 0326FFA8 		.ascii	"\003&\377\250\003&\377\250\003&\377\250\003&\377\250\003&\377"
+ 109      0326FFA8 
+ 109      0326FFA8 
+ 109      0326FFA8 
+ 109      0326FF
+ 110 063c A70326FF 		.ascii	"\247\003&\377\247\003&\377\247\003&\377\247"
+ 110      A70326FF 
+ 110      A70326FF 
+ 110      A7
+ 111 0649 0326FFA7 		.string	"\003&\377\247\002&\377\247\002&\377\247\002&\377\247\002&\377\247\002&\377\247\002&\377\2
+ 111      0226FFA7 
+ 111      0226FFA7 
+ 111      0226FFA7 
+ 111      0226FFA7 
+ 112 074a 26FFA500 		.string	"&\377\245"
+ 113 074e 26FFA500 		.string	"&\377\245"
+ 114 0752 26FFA500 		.string	"&\377\245"
+ 115 0756 26FFA500 		.string	"&\377\245"
+ 116 075a 26FFA500 		.string	"&\377\245"
+ 117 075e 26FFA500 		.string	"&\377\245"
+ 118 0762 26FFA500 		.string	"&\377\245"
+ 119 0766 26FFA500 		.string	"&\377\245"
+ 120 076a 26FFA500 		.string	"&\377\245"
+ 121 076e 26FFA500 		.string	"&\377\245"
+ 122 0772 26FFA500 		.string	"&\377\245"
+ 123 0776 26FFA500 		.string	"&\377\245"
+ 124 077a 26FFA500 		.string	"&\377\245"
+ 125 077e 26FFA500 		.string	"&\377\245"
+ 126 0782 26FFA500 		.string	"&\377\245"
+ 127 0786 26FFA500 		.string	"&\377\245"
+ 128 078a 26FFA500 		.string	"&\377\245"
+ 129 078e 26FFA500 		.string	"&\377\245"
+ 130 0792 26FFA500 		.string	"&\377\245"
+ 131 0796 26FFA500 		.string	"&\377\245"
+ 132 079a 26FFA500 		.string	"&\377\245"
+ 133 079e 26FFA500 		.string	"&\377\245"
+ 134 07a2 26FFA500 		.string	"&\377\245"
+ 135 07a6 26FFA500 		.string	"&\377\245"
+ 136 07aa 26FFA500 		.string	"&\377\245"
+ 137 07ae 26FFA500 		.string	"&\377\245"
+ 138 07b2 26FFA500 		.string	"&\377\245"
+ 139 07b6 26FFA500 		.string	"&\377\245"
+ 140 07ba 26FFA500 		.string	"&\377\245"
+ 141 07be 26FFA500 		.string	"&\377\245"
+GAS LISTING /tmp/ccuplHTA.s 			page 9
+
+
+ 142 07c2 26FFA500 		.string	"&\377\245"
+ 143 07c6 26FFA500 		.string	"&\377\245"
+ 144 07ca 26FFA500 		.string	"&\377\245"
+ 145 07ce 26FF     		.ascii	"&\377"
+ 146 07d0 A500     		.string	"\245"
+ 147 07d2 26FFA500 		.string	"&\377\245"
+ 148 07d6 26FFA500 		.string	"&\377\245"
+ 149 07da 26FFA500 		.string	"&\377\245"
+ 150 07de 26FFA500 		.string	"&\377\245"
+ 151 07e2 26FFA500 		.string	"&\377\245"
+ 152 07e6 26FFA500 		.string	"&\377\245"
+ 153 07ea 26FFA500 		.string	"&\377\245"
+ 154 07ee 26FFA500 		.string	"&\377\245"
+ 155 07f2 26FFA500 		.string	"&\377\245"
+ 156 07f6 26FFA500 		.string	"&\377\245"
+ 157 07fa 26FFA500 		.string	"&\377\245"
+ 158 07fe 26FFA500 		.string	"&\377\245"
+ 159 0802 26FFA500 		.string	"&\377\245"
+ 160 0806 26FFA500 		.string	"&\377\245"
+ 161 080a 26FFA500 		.string	"&\377\245"
+ 162 080e 26FFA500 		.string	"&\377\245"
+ 163 0812 26FFA500 		.string	"&\377\245"
+ 164 0816 26FFA500 		.string	"&\377\245"
+ 165 081a 26FFA500 		.string	"&\377\245"
+ 166 081e 26FFA500 		.string	"&\377\245"
+ 167 0822 26FFA500 		.string	"&\377\245"
+ 168 0826 26FFA500 		.string	"&\377\245"
+ 169 082a 26FFA500 		.string	"&\377\245"
+ 170 082e 26FFA500 		.string	"&\377\245"
+ 171 0832 26FFA500 		.string	"&\377\245"
+ 172 0836 26FFA500 		.string	"&\377\245"
+ 173 083a 26FFA500 		.string	"&\377\245"
+ 174 083e 26FFA500 		.string	"&\377\245"
+ 175 0842 26FFA500 		.string	"&\377\245"
+ 176 0846 26FFA500 		.string	"&\377\245"
+ 177 084a 26FFA500 		.string	"&\377\245"
+ 178 084e 26FFA500 		.string	"&\377\245"
+ 179 0852 26FFA500 		.string	"&\377\245"
+ 180 0856 26FFA500 		.string	"&\377\245"
+ 181 085a 26FFA500 		.string	"&\377\245"
+ 182 085e 26FFA500 		.string	"&\377\245"
+ 183 0862 26FFA500 		.string	"&\377\245"
+ 184 0866 26FFA500 		.string	"&\377\245"
+ 185 086a 26FFA500 		.string	"&\377\245"
+ 186 086e 26FFA500 		.string	"&\377\245"
+ 187 0872 26FFA500 		.string	"&\377\245"
+ 188 0876 26FFA500 		.string	"&\377\245"
+ 189 087a 26FFA500 		.string	"&\377\245"
+ 190 087e 26FFA500 		.string	"&\377\245"
+ 191 0882 26FFA500 		.string	"&\377\245"
+ 192 0886 26FFA500 		.string	"&\377\245"
+ 193 088a 26FFA500 		.string	"&\377\245"
+ 194 088e 26FFA500 		.string	"&\377\245"
+ 195 0892 26FFA500 		.string	"&\377\245"
+ 196 0896 26FFA500 		.string	"&\377\245"
+ 197 089a 26FFA500 		.string	"&\377\245"
+ 198 089e 26FFA500 		.string	"&\377\245"
+GAS LISTING /tmp/ccuplHTA.s 			page 10
+
+
+ 199 08a2 26FFA500 		.string	"&\377\245"
+ 200 08a6 26FFA500 		.string	"&\377\245"
+ 201 08aa 26FFA500 		.string	"&\377\245"
+ 202 08ae 26FFA500 		.string	"&\377\245"
+ 203 08b2 26FFA500 		.string	"&\377\245"
+ 204 08b6 26FFA500 		.string	"&\377\245"
+ 205 08ba 26FFA500 		.string	"&\377\245"
+ 206 08be 26FFA500 		.string	"&\377\245"
+ 207 08c2 26FFA500 		.string	"&\377\245"
+ 208 08c6 26FFA500 		.string	"&\377\245"
+ 209 08ca 26FFA500 		.string	"&\377\245"
+ 210 08ce 26FFA500 		.string	"&\377\245"
+ 211 08d2 26FFA500 		.string	"&\377\245"
+ 212 08d6 26FFA500 		.string	"&\377\245"
+ 213 08da 26FFA500 		.string	"&\377\245"
+ 214 08de 26FFA500 		.string	"&\377\245"
+ 215 08e2 26FFA500 		.string	"&\377\245"
+ 216 08e6 26FFA500 		.string	"&\377\245"
+ 217 08ea 26FFA500 		.string	"&\377\245"
+ 218 08ee 26FFA500 		.string	"&\377\245"
+ 219 08f2 26FFA500 		.string	"&\377\245"
+ 220 08f6 26FFA500 		.string	"&\377\245"
+ 221 08fa 26FFA500 		.string	"&\377\245"
+ 222 08fe 26FFA500 		.string	"&\377\245"
+ 223 0902 26FFA500 		.string	"&\377\245"
+ 224 0906 26FFA500 		.string	"&\377\245"
+ 225 090a 26FFA500 		.string	"&\377\245"
+ 226 090e 26FFA500 		.string	"&\377\245"
+ 227 0912 26FFA500 		.string	"&\377\245"
+ 228 0916 26FFA500 		.string	"&\377\245"
+ 229 091a 26FFA500 		.string	"&\377\245"
+ 230 091e 26FFA500 		.string	"&\377\245"
+ 231 0922 26FFA500 		.string	"&\377\245"
+ 232 0926 26FFA500 		.string	"&\377\245"
+ 233 092a 26FFA500 		.string	"&\377\245"
+ 234 092e 26FFA500 		.string	"&\377\245"
+ 235 0932 26FFA500 		.string	"&\377\245"
+ 236 0936 26FFA500 		.string	"&\377\245"
+ 237 093a 26FFA500 		.string	"&\377\245"
+ 238 093e 26FFA500 		.string	"&\377\245"
+ 239 0942 26FFA500 		.string	"&\377\245"
+ 240 0946 26FFA500 		.string	"&\377\245"
+ 241 094a 26FFA500 		.string	"&\377\245"
+ 242 094e 26FFA500 		.string	"&\377\245"
+ 243 0952 26FFA500 		.string	"&\377\245"
+ 244 0956 26FFA500 		.string	"&\377\245"
+ 245 095a 26FFA500 		.string	"&\377\245"
+ 246 095e 26FFA500 		.string	"&\377\245"
+ 247 0962 26FFA500 		.string	"&\377\245"
+ 248 0966 26FFA500 		.string	"&\377\245"
+ 249 096a 26FFA500 		.string	"&\377\245"
+ 250 096e 26FFA500 		.string	"&\377\245"
+ 251 0972 26FFA500 		.string	"&\377\245"
+ 252 0976 26FFA500 		.string	"&\377\245"
+ 253 097a 26FFA500 		.string	"&\377\245"
+ 254 097e 26FFA500 		.string	"&\377\245"
+ 255 0982 26FFA500 		.string	"&\377\245"
+GAS LISTING /tmp/ccuplHTA.s 			page 11
+
+
+ 256 0986 26FFA500 		.string	"&\377\245"
+ 257 098a 26FFA500 		.string	"&\377\245"
+ 258 098e 26FFA500 		.string	"&\377\245"
+ 259 0992 26FFA500 		.string	"&\377\245"
+ 260 0996 26FFA500 		.string	"&\377\245"
+ 261 099a 26FFA500 		.string	"&\377\245"
+ 262 099e 26FFA500 		.string	"&\377\245"
+ 263 09a2 26FFA500 		.string	"&\377\245"
+ 264 09a6 26FFA500 		.string	"&\377\245"
+ 265 09aa 26FFA500 		.string	"&\377\245"
+ 266 09ae 26FFA500 		.string	"&\377\245"
+ 267 09b2 26FFA500 		.string	"&\377\245"
+ 268 09b6 26FFA500 		.string	"&\377\245"
+ 269 09ba 26FFA500 		.string	"&\377\245"
+ 270 09be 26FFA500 		.string	"&\377\245"
+ 271 09c2 26FFA500 		.string	"&\377\245"
+ 272 09c6 26FFA500 		.string	"&\377\245"
+ 273 09ca 26FFA500 		.string	"&\377\245"
+ 274 09ce 26FFA500 		.string	"&\377\245"
+ 275 09d2 26FFA500 		.string	"&\377\245"
+ 276 09d6 26FFA500 		.string	"&\377\245"
+ 277 09da 26FFA500 		.string	"&\377\245"
+ 278 09de 26FFA500 		.string	"&\377\245"
+ 279 09e2 26FFA500 		.string	"&\377\245"
+ 280 09e6 26FFA500 		.string	"&\377\245"
+ 281 09ea 26FFA500 		.string	"&\377\245"
+ 282 09ee 26FFA500 		.string	"&\377\245"
+ 283 09f2 26FFA500 		.string	"&\377\245"
+ 284 09f6 26FFA500 		.string	"&\377\245"
+ 285 09fa 26FFA500 		.string	"&\377\245"
+ 286 09fe 26FFA500 		.string	"&\377\245"
+ 287 0a02 26FFA500 		.string	"&\377\245"
+ 288 0a06 26FFA500 		.string	"&\377\245"
+ 289 0a0a 26FFA500 		.string	"&\377\245"
+ 290 0a0e 26FFA500 		.string	"&\377\245"
+ 291 0a12 26FFA500 		.string	"&\377\245"
+ 292 0a16 26FFA500 		.string	"&\377\245"
+ 293 0a1a 26FFA500 		.string	"&\377\245"
+ 294 0a1e 26FFA500 		.string	"&\377\245"
+ 295 0a22 26FFA500 		.string	"&\377\245"
+ 296 0a26 26FFA500 		.string	"&\377\245"
+ 297 0a2a 26FFA500 		.string	"&\377\245"
+ 298 0a2e 26FFA500 		.string	"&\377\245"
+ 299 0a32 26FFA500 		.string	"&\377\245"
+ 300 0a36 26FFA500 		.string	"&\377\245"
+ 301 0a3a 26FFA500 		.string	"&\377\245"
+ 302 0a3e 26FFA500 		.string	"&\377\245"
+ 303 0a42 26FFA500 		.string	"&\377\245"
+ 304 0a46 26FFA500 		.string	"&\377\245"
+ 305 0a4a 26FFA500 		.string	"&\377\245"
+ 306 0a4e 26FFA500 		.string	"&\377\245"
+ 307 0a52 26FFA500 		.string	"&\377\245"
+ 308 0a56 26FFA500 		.string	"&\377\245"
+ 309 0a5a 26FFA500 		.string	"&\377\245"
+ 310 0a5e 26FFA500 		.string	"&\377\245"
+ 311 0a62 26FFA500 		.string	"&\377\245"
+ 312 0a66 26FFA500 		.string	"&\377\245"
+GAS LISTING /tmp/ccuplHTA.s 			page 12
+
+
+ 313 0a6a 26FFA500 		.string	"&\377\245"
+ 314 0a6e 26FFA500 		.string	"&\377\245"
+ 315 0a72 26FFA500 		.string	"&\377\245"
+ 316 0a76 26FFA500 		.string	"&\377\245"
+ 317 0a7a 26FFA500 		.string	"&\377\245"
+ 318 0a7e 26FFA500 		.string	"&\377\245"
+ 319 0a82 26FFA500 		.string	"&\377\245"
+ 320 0a86 26FFA500 		.string	"&\377\245"
+ 321 0a8a 26FFA500 		.string	"&\377\245"
+ 322 0a8e 26FFA500 		.string	"&\377\245"
+ 323 0a92 26FFA500 		.string	"&\377\245"
+ 324 0a96 26FFA500 		.string	"&\377\245"
+ 325 0a9a 26FFA500 		.string	"&\377\245"
+ 326 0a9e 26FFA500 		.string	"&\377\245"
+ 327 0aa2 26FFA500 		.string	"&\377\245"
+ 328 0aa6 26FFA500 		.string	"&\377\245"
+ 329 0aaa 26FFA500 		.string	"&\377\245"
+ 330 0aae 26FFA500 		.string	"&\377\245"
+ 331 0ab2 26FFA500 		.string	"&\377\245"
+ 332 0ab6 26FFA500 		.string	"&\377\245"
+ 333 0aba 26FFA500 		.string	"&\377\245"
+ 334 0abe 26FFA500 		.string	"&\377\245"
+ 335 0ac2 26FFA500 		.string	"&\377\245"
+ 336 0ac6 26FFA500 		.string	"&\377\245"
+ 337 0aca 26FFA500 		.string	"&\377\245"
+ 338 0ace 26FFA500 		.string	"&\377\245"
+ 339 0ad2 26FFA500 		.string	"&\377\245"
+ 340 0ad6 26FFA500 		.string	"&\377\245"
+ 341 0ada 26FFA500 		.string	"&\377\245"
+ 342 0ade 26FFA500 		.string	"&\377\245"
+ 343 0ae2 26FFA500 		.string	"&\377\245"
+ 344 0ae6 26FFA500 		.string	"&\377\245"
+ 345 0aea 26FFA500 		.string	"&\377\245"
+ 346 0aee 26FFA500 		.string	"&\377\245"
+ 347 0af2 26FFA500 		.string	"&\377\245"
+ 348 0af6 26FFA500 		.string	"&\377\245"
+ 349 0afa 26FFA500 		.string	"&\377\245"
+ 350 0afe 26FFA500 		.string	"&\377\245"
+ 351 0b02 26FFA500 		.string	"&\377\245"
+ 352 0b06 26FFA500 		.string	"&\377\245"
+ 353 0b0a 26FFA500 		.string	"&\377\245"
+ 354 0b0e 26FFA500 		.string	"&\377\245"
+ 355 0b12 26FFA500 		.string	"&\377\245"
+ 356 0b16 26FFA500 		.string	"&\377\245"
+ 357 0b1a 26FFA500 		.string	"&\377\245"
+ 358 0b1e 26FFA500 		.string	"&\377\245"
+ 359 0b22 26FFA500 		.string	"&\377\245"
+ 360 0b26 26FFA500 		.string	"&\377\245"
+ 361 0b2a 26FFA500 		.string	"&\377\245"
+ 362 0b2e 26FFA500 		.string	"&\377\245"
+ 363 0b32 26FFA500 		.string	"&\377\245"
+ 364 0b36 26FFA500 		.string	"&\377\245"
+ 365 0b3a 26FFA500 		.string	"&\377\245"
+ 366 0b3e 26FFA500 		.string	"&\377\245"
+ 367 0b42 26FFA500 		.string	"&\377\245"
+ 368 0b46 26FFA500 		.string	"&\377\245"
+ 369 0b4a 26FFA500 		.string	"&\377\245"
+GAS LISTING /tmp/ccuplHTA.s 			page 13
+
+
+ 370 0b4e 26FFA500 		.string	"&\377\245"
+ 371 0b52 26FFA500 		.string	"&\377\245"
+ 372 0b56 26FFA500 		.string	"&\377\245"
+ 373 0b5a 26FFA500 		.string	"&\377\245"
+ 374 0b5e 26FFA500 		.string	"&\377\245"
+ 375 0b62 26FFA500 		.string	"&\377\245"
+ 376 0b66 26FFA500 		.string	"&\377\245"
+ 377 0b6a 26FFA500 		.string	"&\377\245"
+ 378 0b6e 26FFA500 		.string	"&\377\245"
+ 379 0b72 26FFA500 		.string	"&\377\245"
+ 380 0b76 26FFA500 		.string	"&\377\245"
+ 381 0b7a 26FFA500 		.string	"&\377\245"
+ 382 0b7e 26FFA500 		.string	"&\377\245"
+ 383 0b82 26FFA500 		.string	"&\377\245"
+ 384 0b86 26FFA500 		.string	"&\377\245"
+ 385 0b8a 26FFA500 		.string	"&\377\245"
+ 386 0b8e 26FFA500 		.string	"&\377\245"
+ 387 0b92 26FFA500 		.string	"&\377\245"
+ 388 0b96 26FFA500 		.string	"&\377\245"
+ 389 0b9a 26FFA500 		.string	"&\377\245"
+ 390 0b9e 26FFA500 		.string	"&\377\245"
+ 391 0ba2 26FFA500 		.string	"&\377\245"
+ 392 0ba6 26FFA500 		.string	"&\377\245"
+ 393 0baa 26FFA500 		.string	"&\377\245"
+ 394 0bae 26FFA500 		.string	"&\377\245"
+ 395 0bb2 26FFA500 		.string	"&\377\245"
+ 396 0bb6 26FFA500 		.string	"&\377\245"
+ 397 0bba 26FFA500 		.string	"&\377\245"
+ 398 0bbe 26FFA500 		.string	"&\377\245"
+ 399 0bc2 26FFA500 		.string	"&\377\245"
+ 400 0bc6 26FFA500 		.string	"&\377\245"
+ 401 0bca 26FFA500 		.string	"&\377\245"
+ 402 0bce 26FFA500 		.string	"&\377\245"
+ 403 0bd2 26FFA500 		.string	"&\377\245"
+ 404 0bd6 26FFA500 		.string	"&\377\245"
+ 405 0bda 26FFA500 		.string	"&\377\245"
+ 406 0bde 26FFA500 		.string	"&\377\245"
+ 407 0be2 26FFA500 		.string	"&\377\245"
+ 408 0be6 26FFA500 		.string	"&\377\245"
+ 409 0bea 26FFA500 		.string	"&\377\245"
+ 410 0bee 26FFA500 		.string	"&\377\245"
+ 411 0bf2 26FFA500 		.string	"&\377\245"
+ 412 0bf6 26FFA500 		.string	"&\377\245"
+ 413 0bfa 26FFA500 		.string	"&\377\245"
+ 414 0bfe 26FFA500 		.string	"&\377\245"
+ 415 0c02 26FFA500 		.string	"&\377\245"
+ 416 0c06 26FFA500 		.string	"&\377\245"
+ 417 0c0a 26FFA500 		.string	"&\377\245"
+ 418 0c0e 26FFA500 		.string	"&\377\245"
+ 419 0c12 26FFA500 		.string	"&\377\245"
+ 420 0c16 26FFA500 		.string	"&\377\245"
+ 421 0c1a 26FFA500 		.string	"&\377\245"
+ 422 0c1e 26FFA500 		.string	"&\377\245"
+ 423 0c22 26FFA500 		.string	"&\377\245"
+ 424 0c26 26FFA500 		.string	"&\377\245"
+ 425 0c2a 26FFA500 		.string	"&\377\245"
+ 426 0c2e 26FFA500 		.string	"&\377\245"
+GAS LISTING /tmp/ccuplHTA.s 			page 14
+
+
+ 427 0c32 26FFA500 		.string	"&\377\245"
+ 428 0c36 26FFA500 		.string	"&\377\245"
+ 429 0c3a 26FFA500 		.string	"&\377\245"
+ 430 0c3e 26FFA500 		.string	"&\377\245"
+ 431 0c42 26FFA500 		.string	"&\377\245"
+ 432 0c46 26FFA500 		.string	"&\377\245"
+ 433 0c4a 26FFA500 		.string	"&\377\245"
+ 434 0c4e 26FFA500 		.string	"&\377\245"
+ 435 0c52 26FFA500 		.string	"&\377\245"
+ 436 0c56 26FFA500 		.string	"&\377\245"
+ 437 0c5a 26FFA500 		.string	"&\377\245"
+ 438 0c5e 26FFA500 		.string	"&\377\245"
+ 439 0c62 26FFA500 		.string	"&\377\245"
+ 440 0c66 26FFA500 		.string	"&\377\245"
+ 441 0c6a 26FFA500 		.string	"&\377\245"
+ 442 0c6e 26FFA500 		.string	"&\377\245"
+ 443 0c72 26FFA500 		.string	"&\377\245"
+ 444 0c76 26FFA500 		.string	"&\377\245"
+ 445 0c7a 26FFA500 		.string	"&\377\245"
+ 446 0c7e 26FFA500 		.string	"&\377\245"
+ 447 0c82 26FFA500 		.string	"&\377\245"
+ 448 0c86 26FFA500 		.string	"&\377\245"
+ 449 0c8a 26FFA500 		.string	"&\377\245"
+ 450 0c8e 26FFA500 		.string	"&\377\245"
+ 451 0c92 26FFA500 		.string	"&\377\245"
+ 452 0c96 26FFA500 		.string	"&\377\245"
+ 453 0c9a 26FFA500 		.string	"&\377\245"
+ 454 0c9e 26FFA500 		.string	"&\377\245"
+ 455 0ca2 26FFA500 		.string	"&\377\245"
+ 456 0ca6 26FFA500 		.string	"&\377\245"
+ 457 0caa 26FFA500 		.string	"&\377\245"
+ 458 0cae 26FFA500 		.string	"&\377\245"
+ 459 0cb2 26FFA500 		.string	"&\377\245"
+ 460 0cb6 26FFA500 		.string	"&\377\245"
+ 461 0cba 26FFA500 		.string	"&\377\245"
+ 462 0cbe 25FFA500 		.string	"%\377\245"
+ 463 0cc2 25FFA500 		.string	"%\377\245"
+ 464 0cc6 25FFA500 		.string	"%\377\245"
+ 465 0cca 25FFA500 		.string	"%\377\245"
+ 466 0cce 25FFA500 		.string	"%\377\245"
+ 467 0cd2 25FFA500 		.string	"%\377\245"
+ 468 0cd6 25FFA500 		.string	"%\377\245"
+ 469 0cda 25FFA500 		.string	"%\377\245"
+ 470 0cde 25FFA500 		.string	"%\377\245"
+ 471 0ce2 25FFA500 		.string	"%\377\245"
+ 472 0ce6 25FFA500 		.string	"%\377\245"
+ 473 0cea 25FFA500 		.string	"%\377\245"
+ 474 0cee 25FFA500 		.string	"%\377\245"
+ 475 0cf2 25FFA500 		.string	"%\377\245"
+ 476 0cf6 25FFA500 		.string	"%\377\245"
+ 477 0cfa 25FFA500 		.string	"%\377\245"
+ 478 0cfe 25FFA500 		.string	"%\377\245"
+ 479 0d02 25FFA500 		.string	"%\377\245"
+ 480 0d06 25FFA500 		.string	"%\377\245"
+ 481 0d0a 25FFA500 		.string	"%\377\245"
+ 482 0d0e 25FFA500 		.string	"%\377\245"
+ 483 0d12 25FFA500 		.string	"%\377\245"
+GAS LISTING /tmp/ccuplHTA.s 			page 15
+
+
+ 484 0d16 25FFA500 		.string	"%\377\245"
+ 485 0d1a 25FFA500 		.string	"%\377\245"
+ 486 0d1e 25FFA500 		.string	"%\377\245"
+ 487 0d22 25FFA500 		.string	"%\377\245"
+ 488 0d26 25FFA500 		.string	"%\377\245"
+ 489 0d2a 25FFA500 		.string	"%\377\245"
+ 490 0d2e 25FFA500 		.string	"%\377\245"
+ 491 0d32 25FFA500 		.string	"%\377\245"
+ 492 0d36 25FFA400 		.string	"%\377\244"
+ 493 0d3a 25FFA400 		.string	"%\377\244"
+ 494 0d3e 25FFA400 		.string	"%\377\244"
+ 495 0d42 25FFA400 		.string	"%\377\244"
+ 496 0d46 25FFA400 		.string	"%\377\244"
+ 497 0d4a 25FFA400 		.string	"%\377\244"
+ 498 0d4e 25FFA400 		.string	"%\377\244"
+ 499 0d52 25FFA400 		.string	"%\377\244"
+ 500 0d56 25FFA400 		.string	"%\377\244"
+ 501 0d5a 25FFA400 		.string	"%\377\244"
+ 502 0d5e 25FFA400 		.string	"%\377\244"
+ 503 0d62 25FFA400 		.string	"%\377\244"
+ 504 0d66 25FFA400 		.string	"%\377\244"
+ 505 0d6a 25FFA400 		.string	"%\377\244"
+ 506 0d6e 25FFA400 		.string	"%\377\244"
+ 507 0d72 25FFA400 		.string	"%\377\244"
+ 508 0d76 25FFA400 		.string	"%\377\244"
+ 509 0d7a 25FFA400 		.string	"%\377\244"
+ 510 0d7e 25FFA400 		.string	"%\377\244"
+ 511 0d82 25FFA400 		.string	"%\377\244"
+ 512 0d86 25FFA400 		.string	"%\377\244"
+ 513 0d8a 25FFA400 		.string	"%\377\244"
+ 514 0d8e 25FFA400 		.string	"%\377\244"
+ 515 0d92 25FFA400 		.string	"%\377\244"
+ 516 0d96 25FFA400 		.string	"%\377\244"
+ 517 0d9a 25FFA400 		.string	"%\377\244"
+ 518 0d9e 25FFA400 		.string	"%\377\244"
+ 519 0da2 25FFA400 		.string	"%\377\244"
+ 520 0da6 25FFA400 		.string	"%\377\244"
+ 521 0daa 25FFA400 		.string	"%\377\244"
+ 522 0dae 25FFA400 		.string	"%\377\244"
+ 523 0db2 25FFA400 		.string	"%\377\244"
+ 524 0db6 25FFA400 		.string	"%\377\244"
+ 525 0dba 25FFA400 		.string	"%\377\244"
+ 526 0dbe 25FFA400 		.string	"%\377\244"
+ 527 0dc2 25FFA400 		.string	"%\377\244"
+ 528 0dc6 25FFA400 		.string	"%\377\244"
+ 529 0dca 25FFA400 		.string	"%\377\244"
+ 530 0dce 25FFA400 		.string	"%\377\244"
+ 531 0dd2 25FFA400 		.string	"%\377\244"
+ 532 0dd6 25FFA400 		.string	"%\377\244"
+ 533 0dda 25FFA400 		.string	"%\377\244"
+ 534 0dde 25FFA400 		.string	"%\377\244"
+ 535 0de2 25FFA400 		.string	"%\377\244"
+ 536 0de6 25FFA400 		.string	"%\377\244"
+ 537 0dea 25FFA400 		.string	"%\377\244"
+ 538 0dee 25FFA400 		.string	"%\377\244"
+ 539 0df2 25FFA400 		.string	"%\377\244"
+ 540 0df6 25FFA400 		.string	"%\377\244"
+GAS LISTING /tmp/ccuplHTA.s 			page 16
+
+
+ 541 0dfa 25FFA400 		.string	"%\377\244"
+ 542 0dfe 25FFA400 		.string	"%\377\244"
+ 543 0e02 25FFA400 		.string	"%\377\244"
+ 544 0e06 25FFA400 		.string	"%\377\244"
+ 545 0e0a 25FFA400 		.string	"%\377\244"
+ 546 0e0e 25FFA400 		.string	"%\377\244"
+ 547 0e12 25FFA400 		.string	"%\377\244"
+ 548 0e16 25FFA400 		.string	"%\377\244"
+ 549 0e1a 25FFA400 		.string	"%\377\244"
+ 550 0e1e 25FFA400 		.string	"%\377\244"
+ 551 0e22 25FFA400 		.string	"%\377\244"
+ 552 0e26 25FFA400 		.string	"%\377\244"
+ 553 0e2a 25FFA400 		.string	"%\377\244"
+ 554 0e2e 25FFA400 		.string	"%\377\244"
+ 555 0e32 25FFA400 		.string	"%\377\244"
+ 556 0e36 25FFA400 		.string	"%\377\244"
+ 557 0e3a 25FFA400 		.string	"%\377\244"
+ 558 0e3e 25FFA400 		.string	"%\377\244"
+ 559 0e42 25FFA400 		.string	"%\377\244"
+ 560 0e46 25FFA400 		.string	"%\377\244"
+ 561 0e4a 25FFA400 		.string	"%\377\244"
+ 562 0e4e 25FFA400 		.string	"%\377\244"
+ 563 0e52 25FFA400 		.string	"%\377\244"
+ 564 0e56 25FFA400 		.string	"%\377\244"
+ 565 0e5a 25FFA400 		.string	"%\377\244"
+ 566 0e5e 25FFA400 		.string	"%\377\244"
+ 567 0e62 25FFA400 		.string	"%\377\244"
+ 568 0e66 25FFA400 		.string	"%\377\244"
+ 569 0e6a 25FFA400 		.string	"%\377\244"
+ 570 0e6e 25FFA400 		.string	"%\377\244"
+ 571 0e72 25FFA400 		.string	"%\377\244"
+ 572 0e76 25FFA400 		.string	"%\377\244"
+ 573 0e7a 25FFA400 		.string	"%\377\244"
+ 574 0e7e 25FFA400 		.string	"%\377\244"
+ 575 0e82 25FFA400 		.string	"%\377\244"
+ 576 0e86 25FFA400 		.string	"%\377\244"
+ 577 0e8a 25FFA400 		.string	"%\377\244"
+ 578 0e8e 25FFA400 		.string	"%\377\244"
+ 579 0e92 25FFA400 		.string	"%\377\244"
+ 580 0e96 25FFA400 		.string	"%\377\244"
+ 581 0e9a 25FFA400 		.string	"%\377\244"
+ 582 0e9e 25FFA400 		.string	"%\377\244"
+ 583 0ea2 25FFA400 		.string	"%\377\244"
+ 584 0ea6 25FFA400 		.string	"%\377\244"
+ 585 0eaa 25FFA400 		.string	"%\377\244"
+ 586 0eae 25FFA400 		.string	"%\377\244"
+ 587 0eb2 25FFA400 		.string	"%\377\244"
+ 588 0eb6 25FFA400 		.string	"%\377\244"
+ 589 0eba 25FFA400 		.string	"%\377\244"
+ 590 0ebe 25FFA400 		.string	"%\377\244"
+ 591 0ec2 25FFA400 		.string	"%\377\244"
+ 592 0ec6 25FFA400 		.string	"%\377\244"
+ 593 0eca 25FFA400 		.string	"%\377\244"
+ 594 0ece 25FFA400 		.string	"%\377\244"
+ 595 0ed2 25FFA400 		.string	"%\377\244"
+ 596 0ed6 25FFA400 		.string	"%\377\244"
+ 597 0eda 25FFA400 		.string	"%\377\244"
+GAS LISTING /tmp/ccuplHTA.s 			page 17
+
+
+ 598 0ede 25FFA400 		.string	"%\377\244"
+ 599 0ee2 25FFA400 		.string	"%\377\244"
+ 600 0ee6 25FFA400 		.string	"%\377\244"
+ 601 0eea 25FFA400 		.string	"%\377\244"
+ 602 0eee 25FFA400 		.string	"%\377\244"
+ 603 0ef2 25FFA400 		.string	"%\377\244"
+ 604 0ef6 25FFA400 		.string	"%\377\244"
+ 605 0efa 25FFA400 		.string	"%\377\244"
+ 606 0efe 25FFA400 		.string	"%\377\244"
+ 607 0f02 25FFA400 		.string	"%\377\244"
+ 608 0f06 25FFA400 		.string	"%\377\244"
+ 609 0f0a 25FFA400 		.string	"%\377\244"
+ 610 0f0e 25FFA400 		.string	"%\377\244"
+ 611 0f12 25FFA400 		.string	"%\377\244"
+ 612 0f16 25FFA400 		.string	"%\377\244"
+ 613 0f1a 25FFA400 		.string	"%\377\244"
+ 614 0f1e 25FFA400 		.string	"%\377\244"
+ 615 0f22 25FFA400 		.string	"%\377\244"
+ 616 0f26 25FFA400 		.string	"%\377\244"
+ 617 0f2a 25FFA400 		.string	"%\377\244"
+ 618 0f2e 25FFA400 		.string	"%\377\244"
+ 619 0f32 25FFA400 		.string	"%\377\244"
+ 620 0f36 25FFA400 		.string	"%\377\244"
+ 621 0f3a 25FFA400 		.string	"%\377\244"
+ 622 0f3e 25FFA400 		.string	"%\377\244"
+ 623 0f42 25FFA400 		.string	"%\377\244"
+ 624 0f46 25FFA400 		.string	"%\377\244"
+ 625 0f4a 25FFA400 		.string	"%\377\244"
+ 626 0f4e 25FFA400 		.string	"%\377\244"
+ 627 0f52 25FFA400 		.string	"%\377\244"
+ 628 0f56 25FFA400 		.string	"%\377\244"
+ 629 0f5a 25FFA400 		.string	"%\377\244"
+ 630 0f5e 25FFA400 		.string	"%\377\244"
+ 631 0f62 25FFA400 		.string	"%\377\244"
+ 632 0f66 25FFA400 		.string	"%\377\244"
+ 633 0f6a 25FFA400 		.string	"%\377\244"
+ 634 0f6e 25FFA400 		.string	"%\377\244"
+ 635 0f72 25FFA400 		.string	"%\377\244"
+ 636 0f76 25FFA400 		.string	"%\377\244"
+ 637 0f7a 25FFA400 		.string	"%\377\244"
+ 638 0f7e 25FFA400 		.string	"%\377\244"
+ 639 0f82 25FFA400 		.string	"%\377\244"
+ 640 0f86 25FFA400 		.string	"%\377\244"
+ 641 0f8a 25FFA400 		.string	"%\377\244"
+ 642 0f8e 25FFA400 		.string	"%\377\244"
+ 643 0f92 25FFA400 		.string	"%\377\244"
+ 644 0f96 25FFA400 		.string	"%\377\244"
+ 645 0f9a 25FFA400 		.string	"%\377\244"
+ 646 0f9e 25FF     		.ascii	"%\377"
+ 647 0fa0 A400     		.string	"\244"
+ 648 0fa2 25FFA400 		.string	"%\377\244"
+ 649 0fa6 25FFA400 		.string	"%\377\244"
+ 650 0faa 25FFA400 		.string	"%\377\244"
+ 651 0fae 25FFA400 		.string	"%\377\244"
+ 652 0fb2 25FFA400 		.string	"%\377\244"
+ 653 0fb6 25FFA400 		.string	"%\377\244"
+ 654 0fba 25FFA400 		.string	"%\377\244"
+GAS LISTING /tmp/ccuplHTA.s 			page 18
+
+
+ 655 0fbe 25FFA400 		.string	"%\377\244"
+ 656 0fc2 25FFA400 		.string	"%\377\244"
+ 657 0fc6 25FFA400 		.string	"%\377\244"
+ 658 0fca 25FFA400 		.string	"%\377\244"
+ 659 0fce 25FFA400 		.string	"%\377\244"
+ 660 0fd2 25FFA400 		.string	"%\377\244"
+ 661 0fd6 25FFA400 		.string	"%\377\244"
+ 662 0fda 25FFA400 		.string	"%\377\244"
+ 663 0fde 25FFA400 		.string	"%\377\244"
+ 664 0fe2 25FFA400 		.string	"%\377\244"
+ 665 0fe6 25FFA400 		.string	"%\377\244"
+ 666 0fea 25FFA400 		.string	"%\377\244"
+ 667 0fee 25FFA400 		.string	"%\377\244"
+ 668 0ff2 25FFA400 		.string	"%\377\244"
+ 669 0ff6 25FFA400 		.string	"%\377\244"
+ 670 0ffa 25FFA400 		.string	"%\377\244"
+ 671 0ffe 25FFA400 		.string	"%\377\244"
+ 672 1002 25FF     		.ascii	"%\377"
+ 673              		.globl	heatmap_cs_RdYlBu_mixed
+ 674              		.section	.data.rel.local
+ 675              		.align 8
+ 676              		.type	heatmap_cs_RdYlBu_mixed, @object
+ 677              		.size	heatmap_cs_RdYlBu_mixed, 8
+ 678              	heatmap_cs_RdYlBu_mixed:
+ 679 0008 00000000 		.quad	mixed
+ 679      00000000 
+ 680              		.section	.data.rel.ro.local
+ 681              		.align 16
+ 682              		.type	mixed, @object
+ 683              		.size	mixed, 16
+ 684              	mixed:
+ 685 0010 00000000 		.quad	mixed_data
+ 685      00000000 
+ 686 0018 01040000 		.quad	1025
+ 686      00000000 
+ 687              		.section	.rodata
+ 688 1004 00000000 		.align 32
+ 688      00000000 
+ 688      00000000 
+ 688      00000000 
+ 688      00000000 
+ 689              		.type	mixed_data, @object
+ 690              		.size	mixed_data, 4100
+ 691              	mixed_data:
+ 692 1020 00       		.string	""
+ 693 1021 00       		.string	""
+ 694 1022 00       		.string	""
+ 695 1023 00       		.string	""
+ 696 1024 31369500 		.string	"16\225"
+ 697 1028 30369507 		.ascii	"06\225\00707\225\01607\226\02608\226\03508\226%09\226,09\227"
+ 697      3037950E 
+ 697      30379616 
+ 697      3038961D 
+ 697      30389625 
+ 698 1043 34303A97 		.ascii	"40:\227;0:\227C0;\230J0;\230R/<\230Y/=\231a/=\231h/>\231p/>\232"
+ 698      3B303A97 
+ 698      43303B98 
+GAS LISTING /tmp/ccuplHTA.s 			page 19
+
+
+ 698      4A303B98 
+ 698      522F3C98 
+ 699 1067 772F3F9A 		.ascii	"w/?\232\177/?\232\206/@\233\215/@\233\225/A\233\234/A\233\244"
+ 699      7F2F3F9A 
+ 699      862F409B 
+ 699      8D2F409B 
+ 699      952F419B 
+ 700 1080 2F429CAB 		.ascii	"/B\234\253/B\234\263/C\234\272/C\235\302/D\235\311/D\235\321"
+ 700      2F429CB3 
+ 700      2F439CBA 
+ 700      2F439DC2 
+ 700      2F449DC9 
+ 701 1098 2F459DD8 		.ascii	"/E\235\330/E\236\340/F\236\347/F\236\357/G\237\366/G\237\376"
+ 701      2F459EE0 
+ 701      2F469EE7 
+ 701      2F469EEF 
+ 701      2F479FF6 
+ 702 10b0 2F489FFF 		.ascii	"/H\237\377/H\237\377/I\240\3770I\240\3770J\240\3770J\240\377"
+ 702      2F489FFF 
+ 702      2F49A0FF 
+ 702      3049A0FF 
+ 702      304AA0FF 
+ 703 10c8 304BA1FF 		.ascii	"0K\241\3770K\241\3770L\241\3770L\241\3770M\242\3770M\242\377"
+ 703      304BA1FF 
+ 703      304CA1FF 
+ 703      304CA1FF 
+ 703      304DA2FF 
+ 704 10e0 304EA2FF 		.ascii	"0N\242\3771N\242\3771O\243\3771O\243\3771P\243\3775]\252\377"
+ 704      314EA2FF 
+ 704      314FA3FF 
+ 704      314FA3FF 
+ 704      3150A3FF 
+ 705 10f8 355DAAFF 		.ascii	"5]\252\3775^\252\3776^\252\3776_\252\3776_\253\3776`\253\377"
+ 705      355EAAFF 
+ 705      365EAAFF 
+ 705      365FAAFF 
+ 705      365FABFF 
+ 706 1110 3660ABFF 		.ascii	"6`\253\3777a\253\3777a\254\3777b\254\3777b\254\3778c\254\377"
+ 706      3761ABFF 
+ 706      3761ACFF 
+ 706      3762ACFF 
+ 706      3762ACFF 
+ 707 1128 3863ACFF 		.ascii	"8c\254\3778c\255\3778d\255\3779d\255\3779e\255\3779e\256\377"
+ 707      3863ADFF 
+ 707      3864ADFF 
+ 707      3964ADFF 
+ 707      3965ADFF 
+ 708 1140 3966AEFF 		.ascii	"9f\256\377:f\256\377:g\256\377:g\256\377:h\257\377;h\257\377"
+ 708      3A66AEFF 
+ 708      3A67AEFF 
+ 708      3A67AEFF 
+ 708      3A68AFFF 
+ 709 1158 3B69AFFF 		.ascii	";i\257\377;i\257\377<j\257\377<j\260\377<k\260\377=k\260\377"
+ 709      3B69AFFF 
+ 709      3C6AAFFF 
+ 709      3C6AB0FF 
+ 709      3C6BB0FF 
+GAS LISTING /tmp/ccuplHTA.s 			page 20
+
+
+ 710 1170 3D6CB0FF 		.ascii	"=l\260\377=l\260\377>l\260\377>m\261\377>m\261\377?n\261\377"
+ 710      3D6CB0FF 
+ 710      3E6CB0FF 
+ 710      3E6DB1FF 
+ 710      3E6DB1FF 
+ 711 1188 3F6EB1FF 		.ascii	"?n\261\377@o\261\377@o\262\377@p\262\377Ap\262\377Aq\262\377"
+ 711      406FB1FF 
+ 711      406FB2FF 
+ 711      4070B2FF 
+ 711      4170B2FF 
+ 712 11a0 4171B2FF 		.ascii	"Aq\262\377Br\262\377Br\263\377Cr\263\377Cs\263\377Cs\263\377"
+ 712      4272B2FF 
+ 712      4272B3FF 
+ 712      4372B3FF 
+ 712      4373B3FF 
+ 713 11b8 4474B3FF 		.ascii	"Dt\263\377Dt\263\377Eu\264\377Eu\264\377Ev\264\377Ev\264\377"
+ 713      4474B3FF 
+ 713      4575B4FF 
+ 713      4575B4FF 
+ 713      4576B4FF 
+ 714 11d0 4577B5FF 		.ascii	"Ew\265\377Fw\265\377Fw\265\377Fx\266\377Fx\266\377Gy\266\377"
+ 714      4677B5FF 
+ 714      4677B5FF 
+ 714      4678B6FF 
+ 714      4678B6FF 
+ 715 11e8 4779B6FF 		.ascii	"Gy\266\377Gz\267\377Gz\267\377G{\267\377H{\267\377H{\270\377"
+ 715      477AB7FF 
+ 715      477AB7FF 
+ 715      477BB7FF 
+ 715      487BB7FF 
+ 716 1200 487CB8FF 		.ascii	"H|\270\377I|\270\377I}\270\377I}\271\377I~\271\377J~\271\377"
+ 716      497CB8FF 
+ 716      497DB8FF 
+ 716      497DB9FF 
+ 716      497EB9FF 
+ 717 1218 4A7FB9FF 		.ascii	"J\177\271\377J\177\272\377J\177\272\377K\200\272\377K\200\272"
+ 717      4A7FBAFF 
+ 717      4A7FBAFF 
+ 717      4B80BAFF 
+ 717      4B80BA
+ 718 122b FF4B81BB 		.ascii	"\377K\201\273\377L\201\273\377L\202\273\377L\202\273\377M\203"
+ 718      FF4C81BB 
+ 718      FF4C82BB 
+ 718      FF4C82BB 
+ 718      FF4D83
+ 719 123e BBFF4D83 		.ascii	"\273\377M\203\274\377M\203\274\377M\204\274\377N\204\274\377"
+ 719      BCFF4D83 
+ 719      BCFF4D84 
+ 719      BCFF4E84 
+ 719      BCFF
+ 720 1250 4E85BDFF 		.ascii	"N\205\275\377N\205\275\377O\206\275\377O\206\275\377O\207\276"
+ 720      4E85BDFF 
+ 720      4F86BDFF 
+ 720      4F86BDFF 
+ 720      4F87BE
+ 721 1263 FF5087BE 		.ascii	"\377P\207\276\377P\207\276\377Q\210\276\377Q\210\276\377Q\211"
+ 721      FF5087BE 
+GAS LISTING /tmp/ccuplHTA.s 			page 21
+
+
+ 721      FF5188BE 
+ 721      FF5188BE 
+ 721      FF5189
+ 722 1276 BFFF5289 		.ascii	"\277\377R\211\277\377R\212\277\377R\212\277\377S\212\300\377"
+ 722      BFFF528A 
+ 722      BFFF528A 
+ 722      BFFF538A 
+ 722      C0FF
+ 723 1288 538BC0FF 		.ascii	"S\213\300\377]\227\306\377]\227\306\377^\227\306\377^\230\307"
+ 723      5D97C6FF 
+ 723      5D97C6FF 
+ 723      5E97C6FF 
+ 723      5E98C7
+ 724 129b FF5E98C7 		.ascii	"\377^\230\307\377_\231\307\377_\231\307\377`\232\307\377`\232"
+ 724      FF5F99C7 
+ 724      FF5F99C7 
+ 724      FF609AC7 
+ 724      FF609A
+ 725 12ae C8FF609A 		.ascii	"\310\377`\232\310\377a\233\310\377a\233\310\377b\234\310\377"
+ 725      C8FF619B 
+ 725      C8FF619B 
+ 725      C8FF629C 
+ 725      C8FF
+ 726 12c0 629CC9FF 		.ascii	"b\234\311\377b\235\311\377c\235\311\377c\236\311\377d\236\312"
+ 726      629DC9FF 
+ 726      639DC9FF 
+ 726      639EC9FF 
+ 726      649ECA
+ 727 12d3 FF649ECA 		.ascii	"\377d\236\312\377e\237\312\377e\237\312\377e\240\312\377f\240"
+ 727      FF659FCA 
+ 727      FF659FCA 
+ 727      FF65A0CA 
+ 727      FF66A0
+ 728 12e6 CBFF66A1 		.ascii	"\313\377f\241\313\377g\241\313\377g\241\313\377h\242\313\377"
+ 728      CBFF67A1 
+ 728      CBFF67A1 
+ 728      CBFF68A2 
+ 728      CBFF
+ 729 12f8 68A2CCFF 		.ascii	"h\242\314\377i\243\314\377i\243\314\377i\244\314\377j\244\314"
+ 729      69A3CCFF 
+ 729      69A3CCFF 
+ 729      69A4CCFF 
+ 729      6AA4CC
+ 730 130b FF6AA4CD 		.ascii	"\377j\244\315\377k\245\315\377k\245\315\377l\246\315\377l\246"
+ 730      FF6BA5CD 
+ 730      FF6BA5CD 
+ 730      FF6CA6CD 
+ 730      FF6CA6
+ 731 131e CDFF6DA7 		.ascii	"\315\377m\247\316\377m\247\316\377n\247\316\377n\250\316\377"
+ 731      CEFF6DA7 
+ 731      CEFF6EA7 
+ 731      CEFF6EA8 
+ 731      CEFF
+ 732 1330 6FA8CFFF 		.ascii	"o\250\317\377o\251\317\377p\251\317\377p\252\317\377q\252\317"
+ 732      6FA9CFFF 
+ 732      70A9CFFF 
+ 732      70AACFFF 
+GAS LISTING /tmp/ccuplHTA.s 			page 22
+
+
+ 732      71AACF
+ 733 1343 FF71AAD0 		.ascii	"\377q\252\320\377r\253\320\377r\253\320\377s\254\320\377s\254"
+ 733      FF72ABD0 
+ 733      FF72ABD0 
+ 733      FF73ACD0 
+ 733      FF73AC
+ 734 1356 D0FF74AD 		.ascii	"\320\377t\255\321\377t\255\321\377t\255\321\377u\256\321\377"
+ 734      D1FF74AD 
+ 734      D1FF74AD 
+ 734      D1FF75AE 
+ 734      D1FF
+ 735 1368 75AED1FF 		.ascii	"u\256\321\377u\256\321\377v\257\322\377v\257\322\377w\257\322"
+ 735      75AED1FF 
+ 735      76AFD2FF 
+ 735      76AFD2FF 
+ 735      77AFD2
+ 736 137b FF77B0D2 		.ascii	"\377w\260\322\377w\260\322\377x\260\323\377x\261\323\377y\261"
+ 736      FF77B0D2 
+ 736      FF78B0D3 
+ 736      FF78B1D3 
+ 736      FF79B1
+ 737 138e D3FF79B1 		.ascii	"\323\377y\261\323\377y\262\323\377z\262\323\377z\262\324\377"
+ 737      D3FF79B2 
+ 737      D3FF7AB2 
+ 737      D3FF7AB2 
+ 737      D4FF
+ 738 13a0 7BB3D4FF 		.ascii	"{\263\324\377{\263\324\377{\264\324\377|\264\324\377|\264\325"
+ 738      7BB3D4FF 
+ 738      7BB4D4FF 
+ 738      7CB4D4FF 
+ 738      7CB4D5
+ 739 13b3 FF7DB5D5 		.ascii	"\377}\265\325\377}\265\325\377}\265\325\377~\266\325\377~\266"
+ 739      FF7DB5D5 
+ 739      FF7DB5D5 
+ 739      FF7EB6D5 
+ 739      FF7EB6
+ 740 13c6 D6FF7FB6 		.ascii	"\326\377\177\266\326\377\177\267\326\377\177\267\326\377\200"
+ 740      D6FF7FB7 
+ 740      D6FF7FB7 
+ 740      D6FF80
+ 741 13d5 B7D6FF80 		.ascii	"\267\326\377\200\270\326\377\201\270\327\377\201\270\327\377"
+ 741      B8D6FF81 
+ 741      B8D7FF81 
+ 741      B8D7FF
+ 742 13e4 81B9D7FF 		.ascii	"\201\271\327\377\202\271\327\377\202\271\327\377\203\272\330"
+ 742      82B9D7FF 
+ 742      82B9D7FF 
+ 742      83BAD8
+ 743 13f3 FF83BAD8 		.ascii	"\377\203\272\330\377\204\272\330\377\204\273\330\377\204\273"
+ 743      FF84BAD8 
+ 743      FF84BBD8 
+ 743      FF84BB
+ 744 1402 D8FF85BB 		.ascii	"\330\377\205\273\330\377\205\274\331\377\206\274\331\377\206"
+ 744      D8FF85BC 
+ 744      D9FF86BC 
+ 744      D9FF86
+ 745 1411 BDD9FF87 		.ascii	"\275\331\377\207\275\331\377\207\275\331\377\207\276\332\377"
+GAS LISTING /tmp/ccuplHTA.s 			page 23
+
+
+ 745      BDD9FF87 
+ 745      BDD9FF87 
+ 745      BEDAFF
+ 746 1420 88BEDAFF 		.ascii	"\210\276\332\377\223\307\337\377\224\307\337\377\224\310\337"
+ 746      93C7DFFF 
+ 746      94C7DFFF 
+ 746      94C8DF
+ 747 142f FF95C8DF 		.ascii	"\377\225\310\337\377\225\310\337\377\225\311\340\377\226\311"
+ 747      FF95C8DF 
+ 747      FF95C9E0 
+ 747      FF96C9
+ 748 143e E0FF96C9 		.ascii	"\340\377\226\311\340\377\227\312\340\377\227\312\340\377\230"
+ 748      E0FF97CA 
+ 748      E0FF97CA 
+ 748      E0FF98
+ 749 144d CAE1FF98 		.ascii	"\312\341\377\230\313\341\377\231\313\341\377\231\314\341\377"
+ 749      CBE1FF99 
+ 749      CBE1FF99 
+ 749      CCE1FF
+ 750 145c 99CCE1FF 		.ascii	"\231\314\341\377\232\314\342\377\232\315\342\377\233\315\342"
+ 750      9ACCE2FF 
+ 750      9ACDE2FF 
+ 750      9BCDE2
+ 751 146b FF9BCDE2 		.ascii	"\377\233\315\342\377\234\316\342\377\234\316\342\377\235\316"
+ 751      FF9CCEE2 
+ 751      FF9CCEE2 
+ 751      FF9DCE
+ 752 147a E3FF9DCF 		.ascii	"\343\377\235\317\343\377\235\317\343\377\236\317\343\377\236"
+ 752      E3FF9DCF 
+ 752      E3FF9ECF 
+ 752      E3FF9E
+ 753 1489 D0E3FF9F 		.ascii	"\320\343\377\237\320\344\377\237\320\344\377\240\321\344\377"
+ 753      D0E4FF9F 
+ 753      D0E4FFA0 
+ 753      D1E4FF
+ 754 1498 A0D1E4FF 		.ascii	"\240\321\344\377\241\321\344\377\241\322\345\377\242\322\345"
+ 754      A1D1E4FF 
+ 754      A1D2E5FF 
+ 754      A2D2E5
+ 755 14a7 FFA2D2E5 		.ascii	"\377\242\322\345\377\242\323\345\377\243\323\345\377\243\323"
+ 755      FFA2D3E5 
+ 755      FFA3D3E5 
+ 755      FFA3D3
+ 756 14b6 E6FFA4D4 		.ascii	"\346\377\244\324\346\377\244\324\346\377\245\324\346\377\245"
+ 756      E6FFA4D4 
+ 756      E6FFA5D4 
+ 756      E6FFA5
+ 757 14c5 D5E6FFA6 		.ascii	"\325\346\377\246\325\346\377\246\325\347\377\247\326\347\377"
+ 757      D5E6FFA6 
+ 757      D5E7FFA7 
+ 757      D6E7FF
+ 758 14d4 A7D6E7FF 		.ascii	"\247\326\347\377\250\326\347\377\250\327\347\377\251\327\350"
+ 758      A8D6E7FF 
+ 758      A8D7E7FF 
+ 758      A9D7E8
+ 759 14e3 FFA9D7E8 		.ascii	"\377\251\327\350\377\251\330\350\377\252\330\350\377\252\330"
+ 759      FFA9D8E8 
+GAS LISTING /tmp/ccuplHTA.s 			page 24
+
+
+ 759      FFAAD8E8 
+ 759      FFAAD8
+ 760 14f2 E8FFABD9 		.ascii	"\350\377\253\331\351\377\253\331\351\377\254\331\351\377\254"
+ 760      E9FFABD9 
+ 760      E9FFACD9 
+ 760      E9FFAC
+ 761 1501 D9E9FFAD 		.ascii	"\331\351\377\255\331\351\377\255\332\351\377\255\332\351\377"
+ 761      D9E9FFAD 
+ 761      DAE9FFAD 
+ 761      DAE9FF
+ 762 1510 AEDAE9FF 		.ascii	"\256\332\351\377\256\332\351\377\257\333\352\377\257\333\352"
+ 762      AEDAE9FF 
+ 762      AFDBEAFF 
+ 762      AFDBEA
+ 763 151f FFAFDBEA 		.ascii	"\377\257\333\352\377\260\333\352\377\260\333\352\377\261\334"
+ 763      FFB0DBEA 
+ 763      FFB0DBEA 
+ 763      FFB1DC
+ 764 152e EAFFB1DC 		.ascii	"\352\377\261\334\352\377\261\334\352\377\262\334\352\377\262"
+ 764      EAFFB1DC 
+ 764      EAFFB2DC 
+ 764      EAFFB2
+ 765 153d DCEBFFB3 		.ascii	"\334\353\377\263\335\353\377\263\335\353\377\264\335\353\377"
+ 765      DDEBFFB3 
+ 765      DDEBFFB4 
+ 765      DDEBFF
+ 766 154c B4DDEBFF 		.ascii	"\264\335\353\377\264\335\353\377\265\336\353\377\265\336\353"
+ 766      B4DDEBFF 
+ 766      B5DEEBFF 
+ 766      B5DEEB
+ 767 155b FFB6DEEB 		.ascii	"\377\266\336\353\377\266\336\353\377\266\336\354\377\267\337"
+ 767      FFB6DEEB 
+ 767      FFB6DEEC 
+ 767      FFB7DF
+ 768 156a ECFFB7DF 		.ascii	"\354\377\267\337\354\377\270\337\354\377\270\337\354\377\271"
+ 768      ECFFB8DF 
+ 768      ECFFB8DF 
+ 768      ECFFB9
+ 769 1579 DFECFFB9 		.ascii	"\337\354\377\271\340\354\377\271\340\354\377\272\340\355\377"
+ 769      E0ECFFB9 
+ 769      E0ECFFBA 
+ 769      E0EDFF
+ 770 1588 BAE0EDFF 		.ascii	"\272\340\355\377\273\340\355\377\273\341\355\377\273\341\355"
+ 770      BBE0EDFF 
+ 770      BBE1EDFF 
+ 770      BBE1ED
+ 771 1597 FFBCE1ED 		.ascii	"\377\274\341\355\377\274\341\355\377\275\341\355\377\275\342"
+ 771      FFBCE1ED 
+ 771      FFBDE1ED 
+ 771      FFBDE2
+ 772 15a6 EDFFBEE2 		.ascii	"\355\377\276\342\356\377\276\342\356\377\276\342\356\377\277"
+ 772      EEFFBEE2 
+ 772      EEFFBEE2 
+ 772      EEFFBF
+ 773 15b5 E2EEFFBF 		.ascii	"\342\356\377\277\343\356\377\300\343\356\377\313\350\361\377"
+ 773      E3EEFFC0 
+ 773      E3EEFFCB 
+GAS LISTING /tmp/ccuplHTA.s 			page 25
+
+
+ 773      E8F1FF
+ 774 15c4 CBE8F1FF 		.ascii	"\313\350\361\377\313\351\361\377\314\351\362\377\314\351\362"
+ 774      CBE9F1FF 
+ 774      CCE9F2FF 
+ 774      CCE9F2
+ 775 15d3 FFCDE9F2 		.ascii	"\377\315\351\362\377\315\352\362\377\315\352\362\377\316\352"
+ 775      FFCDEAF2 
+ 775      FFCDEAF2 
+ 775      FFCEEA
+ 776 15e2 F2FFCEEA 		.ascii	"\362\377\316\352\362\377\317\352\362\377\317\353\363\377\320"
+ 776      F2FFCFEA 
+ 776      F2FFCFEB 
+ 776      F3FFD0
+ 777 15f1 EBF3FFD0 		.ascii	"\353\363\377\320\353\363\377\320\353\363\377\321\353\363\377"
+ 777      EBF3FFD0 
+ 777      EBF3FFD1 
+ 777      EBF3FF
+ 778 1600 D1ECF3FF 		.ascii	"\321\354\363\377\322\354\363\377\322\354\363\377\322\354\364"
+ 778      D2ECF3FF 
+ 778      D2ECF3FF 
+ 778      D2ECF4
+ 779 160f FFD3ECF4 		.ascii	"\377\323\354\364\377\323\355\364\377\324\355\364\377\324\355"
+ 779      FFD3EDF4 
+ 779      FFD4EDF4 
+ 779      FFD4ED
+ 780 161e F4FFD5ED 		.ascii	"\364\377\325\355\364\377\325\355\364\377\325\356\364\377\326"
+ 780      F4FFD5ED 
+ 780      F4FFD5EE 
+ 780      F4FFD6
+ 781 162d EEF4FFD6 		.ascii	"\356\364\377\326\356\365\377\327\356\365\377\327\356\365\377"
+ 781      EEF5FFD7 
+ 781      EEF5FFD7 
+ 781      EEF5FF
+ 782 163c D7EFF5FF 		.ascii	"\327\357\365\377\330\357\365\377\330\357\365\377\331\357\365"
+ 782      D8EFF5FF 
+ 782      D8EFF5FF 
+ 782      D9EFF5
+ 783 164b FFD9EFF5 		.ascii	"\377\331\357\365\377\331\360\366\377\332\360\366\377\332\360"
+ 783      FFD9F0F6 
+ 783      FFDAF0F6 
+ 783      FFDAF0
+ 784 165a F6FFDBF0 		.ascii	"\366\377\333\360\366\377\333\360\366\377\334\361\366\377\334"
+ 784      F6FFDBF0 
+ 784      F6FFDCF1 
+ 784      F6FFDC
+ 785 1669 F1F6FFDC 		.ascii	"\361\366\377\334\361\367\377\335\361\367\377\335\361\367\377"
+ 785      F1F7FFDD 
+ 785      F1F7FFDD 
+ 785      F1F7FF
+ 786 1678 DEF2F7FF 		.ascii	"\336\362\367\377\336\362\367\377\336\362\367\377\337\362\367"
+ 786      DEF2F7FF 
+ 786      DEF2F7FF 
+ 786      DFF2F7
+ 787 1687 FFDFF2F7 		.ascii	"\377\337\362\367\377\337\363\370\377\337\363\370\377\336\363"
+ 787      FFDFF3F8 
+ 787      FFDFF3F8 
+ 787      FFDEF3
+GAS LISTING /tmp/ccuplHTA.s 			page 26
+
+
+ 788 1696 F8FFDEF3 		.ascii	"\370\377\336\363\370\377\336\363\370\377\335\364\370\377\335"
+ 788      F8FFDEF3 
+ 788      F8FFDDF4 
+ 788      F8FFDD
+ 789 16a5 F4F8FFDC 		.ascii	"\364\370\377\334\364\370\377\334\364\370\377\333\365\371\377"
+ 789      F4F8FFDC 
+ 789      F4F8FFDB 
+ 789      F5F9FF
+ 790 16b4 DBF5F9FF 		.ascii	"\333\365\371\377\333\365\371\377\332\365\371\377\332\366\371"
+ 790      DBF5F9FF 
+ 790      DAF5F9FF 
+ 790      DAF6F9
+ 791 16c3 FFD9F6F9 		.ascii	"\377\331\366\371\377\331\366\370\377\330\366\370\377\330\366"
+ 791      FFD9F6F8 
+ 791      FFD8F6F8 
+ 791      FFD8F6
+ 792 16d2 F8FFD8F7 		.ascii	"\370\377\330\367\370\377\327\367\370\377\327\367\370\377\327"
+ 792      F8FFD7F7 
+ 792      F8FFD7F7 
+ 792      F8FFD7
+ 793 16e1 F7F8FFD6 		.ascii	"\367\370\377\326\370\370\377\326\370\370\377\326\370\367\377"
+ 793      F8F8FFD6 
+ 793      F8F8FFD6 
+ 793      F8F7FF
+ 794 16f0 D5F8F7FF 		.ascii	"\325\370\367\377\325\370\367\377\325\371\367\377\325\371\366"
+ 794      D5F8F7FF 
+ 794      D5F9F7FF 
+ 794      D5F9F6
+ 795 16ff FFD4F9F6 		.ascii	"\377\324\371\366\377\324\371\366\377\324\371\366\377\324\372"
+ 795      FFD4F9F6 
+ 795      FFD4F9F6 
+ 795      FFD4FA
+ 796 170e F5FFD4FA 		.ascii	"\365\377\324\372\365\377\323\372\365\377\323\372\364\377\323"
+ 796      F5FFD3FA 
+ 796      F5FFD3FA 
+ 796      F4FFD3
+ 797 171d FAF4FFD3 		.ascii	"\372\364\377\323\373\363\377\323\373\363\377\323\373\363\377"
+ 797      FBF3FFD3 
+ 797      FBF3FFD3 
+ 797      FBF3FF
+ 798 172c D3FBF2FF 		.ascii	"\323\373\362\377\323\373\362\377\323\373\361\377\323\374\361"
+ 798      D3FBF2FF 
+ 798      D3FBF1FF 
+ 798      D3FCF1
+ 799 173b FFD3FCF0 		.ascii	"\377\323\374\360\377\323\374\360\377\323\374\357\377\323\374"
+ 799      FFD3FCF0 
+ 799      FFD3FCEF 
+ 799      FFD3FC
+ 800 174a EFFFD3FC 		.ascii	"\357\377\323\374\356\377\323\374\356\377\324\374\355\377\332"
+ 800      EEFFD3FC 
+ 800      EEFFD4FC 
+ 800      EDFFDA
+ 801 1759 FFE1FFDA 		.ascii	"\377\341\377\332\377\341\377\332\377\340\377\333\377\337\377"
+ 801      FFE1FFDA 
+ 801      FFE0FFDB 
+ 801      FFDFFF
+ 802 1768 DBFFDFFF 		.ascii	"\333\377\337\377\333\377\336\377\334\377\335\377\334\377\335"
+GAS LISTING /tmp/ccuplHTA.s 			page 27
+
+
+ 802      DBFFDEFF 
+ 802      DCFFDDFF 
+ 802      DCFFDD
+ 803 1777 FFDCFFDC 		.ascii	"\377\334\377\334\377\335\377\333\377\335\377\333\377\336\377"
+ 803      FFDDFFDB 
+ 803      FFDDFFDB 
+ 803      FFDEFF
+ 804 1786 DAFFDEFF 		.ascii	"\332\377\336\377\331\377\336\377\331\377\337\377\330\377\340"
+ 804      D9FFDEFF 
+ 804      D9FFDFFF 
+ 804      D8FFE0
+ 805 1795 FFD7FFE0 		.ascii	"\377\327\377\340\377\327\377\341\377\326\377\341\377\325\377"
+ 805      FFD7FFE1 
+ 805      FFD6FFE1 
+ 805      FFD5FF
+ 806 17a4 E2FFD4FF 		.ascii	"\342\377\324\377\342\377\324\377\343\377\323\377\344\377\322"
+ 806      E2FFD4FF 
+ 806      E3FFD3FF 
+ 806      E4FFD2
+ 807 17b3 FFE4FFD2 		.ascii	"\377\344\377\322\377\345\377\321\377\346\377\320\377\347\377"
+ 807      FFE5FFD1 
+ 807      FFE6FFD0 
+ 807      FFE7FF
+ 808 17c2 CFFFE7FF 		.ascii	"\317\377\347\377\317\377\350\377\316\377\351\377\315\377\352"
+ 808      CFFFE8FF 
+ 808      CEFFE9FF 
+ 808      CDFFEA
+ 809 17d1 FFCCFFEB 		.ascii	"\377\314\377\353\377\314\377\354\377\313\377\354\377\312\377"
+ 809      FFCCFFEC 
+ 809      FFCBFFEC 
+ 809      FFCAFF
+ 810 17e0 EDFFCAFF 		.ascii	"\355\377\312\377\356\377\311\377\357\377\310\377\360\377\307"
+ 810      EEFFC9FF 
+ 810      EFFFC8FF 
+ 810      F0FFC7
+ 811 17ef FF       		.ascii	"\377"
+ 812 17f0 F1FFC7FF 		.ascii	"\361\377\307\377\362\377\306\377\363\377\305\377\364\377\305"
+ 812      F2FFC6FF 
+ 812      F3FFC5FF 
+ 812      F4FFC5
+ 813 17ff FFF5FFC4 		.ascii	"\377\365\377\304\377\366\377\303\377\367\377\303\377\370\377"
+ 813      FFF6FFC3 
+ 813      FFF7FFC3 
+ 813      FFF8FF
+ 814 180e C2FFF9FF 		.ascii	"\302\377\371\377\301\377\372\377\301\377\373\377\300\377\374"
+ 814      C1FFFAFF 
+ 814      C1FFFBFF 
+ 814      C0FFFC
+ 815 181d FFC0FFFD 		.ascii	"\377\300\377\375\377\277\377\376\377\276\377\376\376\276\377"
+ 815      FFBFFFFE 
+ 815      FFBEFFFE 
+ 815      FEBEFF
+ 816 182c FEFEBEFF 		.ascii	"\376\376\276\377\376\376\275\377\376\376\275\377\376\375\275"
+ 816      FEFEBDFF 
+ 816      FEFEBDFF 
+ 816      FEFDBD
+ 817 183b FFFEFDBC 		.ascii	"\377\376\375\274\377\376\375\274\377\376\375\273\377\376\374"
+GAS LISTING /tmp/ccuplHTA.s 			page 28
+
+
+ 817      FFFEFDBC 
+ 817      FFFEFDBB 
+ 817      FFFEFC
+ 818 184a BBFFFEFC 		.ascii	"\273\377\376\374\273\377\376\374\272\377\376\374\272\377\376"
+ 818      BBFFFEFC 
+ 818      BAFFFEFC 
+ 818      BAFFFE
+ 819 1859 FCB9FFFE 		.ascii	"\374\271\377\376\373\271\377\376\373\271\377\376\373\270\377"
+ 819      FBB9FFFE 
+ 819      FBB9FFFE 
+ 819      FBB8FF
+ 820 1868 FEFBB8FF 		.ascii	"\376\373\270\377\376\372\270\377\376\372\267\377\376\372\267"
+ 820      FEFAB8FF 
+ 820      FEFAB7FF 
+ 820      FEFAB7
+ 821 1877 FFFEFAB6 		.ascii	"\377\376\372\266\377\376\371\266\377\376\371\266\377\376\371"
+ 821      FFFEF9B6 
+ 821      FFFEF9B6 
+ 821      FFFEF9
+ 822 1886 B5FFFEF9 		.ascii	"\265\377\376\371\265\377\376\370\265\377\376\370\264\377\376"
+ 822      B5FFFEF8 
+ 822      B5FFFEF8 
+ 822      B4FFFE
+ 823 1895 F8B4FFFE 		.ascii	"\370\264\377\376\370\263\377\376\370\263\377\376\367\263\377"
+ 823      F8B3FFFE 
+ 823      F8B3FFFE 
+ 823      F7B3FF
+ 824 18a4 FEF7B2FF 		.ascii	"\376\367\262\377\376\367\262\377\376\367\262\377\376\366\261"
+ 824      FEF7B2FF 
+ 824      FEF7B2FF 
+ 824      FEF6B1
+ 825 18b3 FFFEF6B1 		.ascii	"\377\376\366\261\377\376\366\260\377\376\366\260\377\376\365"
+ 825      FFFEF6B0 
+ 825      FFFEF6B0 
+ 825      FFFEF5
+ 826 18c2 B0FFFEF5 		.ascii	"\260\377\376\365\257\377\376\365\257\377\375\365\257\377\375"
+ 826      AFFFFEF5 
+ 826      AFFFFDF5 
+ 826      AFFFFD
+ 827 18d1 F4AEFFFD 		.ascii	"\364\256\377\375\364\256\377\375\364\255\377\375\364\255\377"
+ 827      F4AEFFFD 
+ 827      F4ADFFFD 
+ 827      F4ADFF
+ 828 18e0 FDF3ADFF 		.ascii	"\375\363\255\377\375\363\254\377\375\363\254\377\375\363\254"
+ 828      FDF3ACFF 
+ 828      FDF3ACFF 
+ 828      FDF3AC
+ 829 18ef FFFDF3AB 		.ascii	"\377\375\363\253\377\375\354\241\377\375\354\241\377\375\354"
+ 829      FFFDECA1 
+ 829      FFFDECA1 
+ 829      FFFDEC
+ 830 18fe A1FFFDEB 		.ascii	"\241\377\375\353\240\377\375\353\240\377\375\353\240\377\375"
+ 830      A0FFFDEB 
+ 830      A0FFFDEB 
+ 830      A0FFFD
+ 831 190d EB9FFFFD 		.ascii	"\353\237\377\375\352\237\377\375\352\236\377\375\352\236\377"
+ 831      EA9FFFFD 
+GAS LISTING /tmp/ccuplHTA.s 			page 29
+
+
+ 831      EA9EFFFD 
+ 831      EA9EFF
+ 832 191c FDEA9EFF 		.ascii	"\375\352\236\377\375\351\235\377\375\351\235\377\375\351\235"
+ 832      FDE99DFF 
+ 832      FDE99DFF 
+ 832      FDE99D
+ 833 192b FFFDE99C 		.ascii	"\377\375\351\234\377\375\350\234\377\375\350\234\377\375\350"
+ 833      FFFDE89C 
+ 833      FFFDE89C 
+ 833      FFFDE8
+ 834 193a 9BFFFDE8 		.ascii	"\233\377\375\350\233\377\375\347\232\377\375\347\232\377\375"
+ 834      9BFFFDE7 
+ 834      9AFFFDE7 
+ 834      9AFFFD
+ 835 1949 E79AFFFD 		.ascii	"\347\232\377\375\347\231\377\375\346\231\377\375\346\231\377"
+ 835      E799FFFD 
+ 835      E699FFFD 
+ 835      E699FF
+ 836 1958 FDE698FF 		.ascii	"\375\346\230\377\375\346\230\377\375\345\230\377\375\345\227"
+ 836      FDE698FF 
+ 836      FDE598FF 
+ 836      FDE597
+ 837 1967 FFFDE597 		.ascii	"\377\375\345\227\377\375\345\227\377\375\344\226\377\375\344"
+ 837      FFFDE597 
+ 837      FFFDE496 
+ 837      FFFDE4
+ 838 1976 96FFFDE4 		.ascii	"\226\377\375\344\226\377\375\344\225\377\375\343\225\377\375"
+ 838      96FFFDE4 
+ 838      95FFFDE3 
+ 838      95FFFD
+ 839 1985 E394FFFD 		.ascii	"\343\224\377\375\343\224\377\375\343\224\377\375\342\223\377"
+ 839      E394FFFD 
+ 839      E394FFFD 
+ 839      E293FF
+ 840 1994 FDE293FF 		.ascii	"\375\342\223\377\375\342\223\377\375\342\222\377\375\341\222"
+ 840      FDE293FF 
+ 840      FDE292FF 
+ 840      FDE192
+ 841 19a3 FFFDE192 		.ascii	"\377\375\341\222\377\375\341\221\377\375\341\221\377\375\340"
+ 841      FFFDE191 
+ 841      FFFDE191 
+ 841      FFFDE0
+ 842 19b2 91FFFDE0 		.ascii	"\221\377\375\340\220\377\375\340\220\377\375\340\220\377\375"
+ 842      90FFFDE0 
+ 842      90FFFDE0 
+ 842      90FFFD
+ 843 19c1 DF8FFFFD 		.ascii	"\337\217\377\375\337\217\377\375\337\216\377\375\336\216\377"
+ 843      DF8FFFFD 
+ 843      DF8EFFFD 
+ 843      DE8EFF
+ 844 19d0 FDDE8DFF 		.ascii	"\375\336\215\377\375\335\215\377\375\335\215\377\375\335\214"
+ 844      FDDD8DFF 
+ 844      FDDD8DFF 
+ 844      FDDD8C
+ 845 19df FFFDDC8C 		.ascii	"\377\375\334\214\377\375\334\213\377\375\334\213\377\375\333"
+ 845      FFFDDC8B 
+ 845      FFFDDC8B 
+GAS LISTING /tmp/ccuplHTA.s 			page 30
+
+
+ 845      FFFDDB
+ 846 19ee 8AFFFDDB 		.ascii	"\212\377\375\333\212\377\375\332\212\377\375\332\211\377\375"
+ 846      8AFFFDDA 
+ 846      8AFFFDDA 
+ 846      89FFFD
+ 847 19fd DA89FFFD 		.ascii	"\332\211\377\375\331\210\377\375\331\210\377\375\331\207\377"
+ 847      D988FFFD 
+ 847      D988FFFD 
+ 847      D987FF
+ 848 1a0c FDD887FF 		.ascii	"\375\330\207\377\375\330\207\377\375\327\206\377\375\327\206"
+ 848      FDD887FF 
+ 848      FDD786FF 
+ 848      FDD786
+ 849 1a1b FFFDD785 		.ascii	"\377\375\327\205\377\375\326\205\377\375\326\205\377\375\326"
+ 849      FFFDD685 
+ 849      FFFDD685 
+ 849      FFFDD6
+ 850 1a2a 84FFFDD5 		.ascii	"\204\377\375\325\204\377\375\325\203\377\375\324\203\377\375"
+ 850      84FFFDD5 
+ 850      83FFFDD4 
+ 850      83FFFD
+ 851 1a39 D483FFFD 		.ascii	"\324\203\377\375\324\202\377\375\323\202\377\375\323\201\377"
+ 851      D482FFFD 
+ 851      D382FFFD 
+ 851      D381FF
+ 852 1a48 FDD381FF 		.ascii	"\375\323\201\377\375\322\201\377\375\322\200\377\375\321\200"
+ 852      FDD281FF 
+ 852      FDD280FF 
+ 852      FDD180
+ 853 1a57 FFFDD17F 		.ascii	"\377\375\321\177\377\375\321\177\377\375\320\177\377\375\320"
+ 853      FFFDD17F 
+ 853      FFFDD07F 
+ 853      FFFDD0
+ 854 1a66 7EFFFDCF 		.ascii	"~\377\375\317~\377\375\317}\377\375\317}\377\375\316}\377\375"
+ 854      7EFFFDCF 
+ 854      7DFFFDCF 
+ 854      7DFFFDCE 
+ 854      7DFFFD
+ 855 1a79 CE7CFFFD 		.ascii	"\316|\377\375\315|\377\375\315{\377\375\315{\377\375\314{\377"
+ 855      CD7CFFFD 
+ 855      CD7BFFFD 
+ 855      CD7BFFFD 
+ 855      CC7BFF
+ 856 1a8c FDC271FF 		.ascii	"\375\302q\377\375\302q\377\375\301p\377\375\301p\377\375\300"
+ 856      FDC271FF 
+ 856      FDC170FF 
+ 856      FDC170FF 
+ 856      FDC0
+ 857 1a9e 70FFFDC0 		.ascii	"p\377\375\300o\377\375\300o\377\375\277n\377\375\277n\377\375"
+ 857      6FFFFDC0 
+ 857      6FFFFDBF 
+ 857      6EFFFDBF 
+ 857      6EFFFD
+ 858 1ab1 BE6EFFFD 		.ascii	"\276n\377\375\276m\377\375\276m\377\375\275m\377\375\275l\377"
+ 858      BE6DFFFD 
+ 858      BE6DFFFD 
+ 858      BD6DFFFD 
+GAS LISTING /tmp/ccuplHTA.s 			page 31
+
+
+ 858      BD6CFF
+ 859 1ac4 FDBC6CFF 		.ascii	"\375\274l\377\375\274l\377\375\274k\377\375\273k\377\375\273"
+ 859      FDBC6CFF 
+ 859      FDBC6BFF 
+ 859      FDBB6BFF 
+ 859      FDBB
+ 860 1ad6 6BFFFDBA 		.ascii	"k\377\375\272j\377\375\272j\377\375\272j\377\375\271i\377\375"
+ 860      6AFFFDBA 
+ 860      6AFFFDBA 
+ 860      6AFFFDB9 
+ 860      69FFFD
+ 861 1ae9 B969FFFD 		.ascii	"\271i\377\375\270i\377\375\270h\377\375\270h\377\375\267h\377"
+ 861      B869FFFD 
+ 861      B868FFFD 
+ 861      B868FFFD 
+ 861      B768FF
+ 862 1afc FDB767FF 		.ascii	"\375\267g\377\375\266g\377\375\266g\377\375\266f\377\375\265"
+ 862      FDB667FF 
+ 862      FDB667FF 
+ 862      FDB666FF 
+ 862      FDB5
+ 863 1b0e 66FFFDB5 		.ascii	"f\377\375\265f\377\375\264e\377\375\264e\377\375\264e\377\375"
+ 863      66FFFDB4 
+ 863      65FFFDB4 
+ 863      65FFFDB4 
+ 863      65FFFD
+ 864 1b21 B364FFFD 		.ascii	"\263d\377\375\263d\377\375\262d\377\375\262d\377\375\262c\377"
+ 864      B364FFFD 
+ 864      B264FFFD 
+ 864      B264FFFD 
+ 864      B263FF
+ 865 1b34 FDB163FF 		.ascii	"\375\261c\377\375\261c\377\375\260b\377\375\260b\377\375\257"
+ 865      FDB163FF 
+ 865      FDB062FF 
+ 865      FDB062FF 
+ 865      FDAF
+ 866 1b46 62FFFDAF 		.ascii	"b\377\375\257b\377\375\257a\377\375\256a\377\375\256a\377\374"
+ 866      62FFFDAF 
+ 866      61FFFDAE 
+ 866      61FFFDAE 
+ 866      61FFFC
+ 867 1b59 AD60FFFC 		.ascii	"\255`\377\374\255`\377\374\254`\377\374\254_\377\374\254_\377"
+ 867      AD60FFFC 
+ 867      AC60FFFC 
+ 867      AC5FFFFC 
+ 867      AC5FFF
+ 868 1b6c FCAB5FFF 		.ascii	"\374\253_\377\374\253^\377\374\252^\377\374\252^\377\374\251"
+ 868      FCAB5EFF 
+ 868      FCAA5EFF 
+ 868      FCAA5EFF 
+ 868      FCA9
+ 869 1b7e 5DFFFCA9 		.ascii	"]\377\374\251]\377\374\250]\377\374\250\\\377\374\247\\\377\374"
+ 869      5DFFFCA8 
+ 869      5DFFFCA8 
+ 869      5CFFFCA7 
+ 869      5CFFFC
+ 870 1b91 A75CFFFC 		.ascii	"\247\\\377\374\246[\377\374\246[\377\374\245[\377\373\245Z\377"
+GAS LISTING /tmp/ccuplHTA.s 			page 32
+
+
+ 870      A65BFFFC 
+ 870      A65BFFFC 
+ 870      A55BFFFB 
+ 870      A55AFF
+ 871 1ba4 FBA45AFF 		.ascii	"\373\244Z\377\373\244Z\377\373\243Y\377\373\243Y\377\373\242"
+ 871      FBA45AFF 
+ 871      FBA359FF 
+ 871      FBA359FF 
+ 871      FBA2
+ 872 1bb6 59FFFBA2 		.ascii	"Y\377\373\242Y\377\373\242X\377\373\241X\377\373\241X\377\373"
+ 872      59FFFBA2 
+ 872      58FFFBA1 
+ 872      58FFFBA1 
+ 872      58FFFB
+ 873 1bc9 A057FFFB 		.ascii	"\240W\377\373\240W\377\373\237W\377\373\237W\377\373\236V\377"
+ 873      A057FFFB 
+ 873      9F57FFFB 
+ 873      9F57FFFB 
+ 873      9E56FF
+ 874 1bdc FB9E56FF 		.ascii	"\373\236V\377\373\235V\377\372\235U\377\372\234U\377\372\234"
+ 874      FB9D56FF 
+ 874      FA9D55FF 
+ 874      FA9C55FF 
+ 874      FA9C
+ 875 1bee 55FFFA9B 		.ascii	"U\377\372\233U\377\372\233T\377\372\232T\377\372\232T\377\372"
+ 875      55FFFA9B 
+ 875      54FFFA9A 
+ 875      54FFFA9A 
+ 875      54FFFA
+ 876 1c01 9954FFFA 		.ascii	"\231T\377\372\231S\377\372\230S\377\372\230S\377\372\227S\377"
+ 876      9953FFFA 
+ 876      9853FFFA 
+ 876      9853FFFA 
+ 876      9753FF
+ 877 1c14 FA9752FF 		.ascii	"\372\227R\377\372\226R\377\372\226R\377\371\225R\377\370\210"
+ 877      FA9652FF 
+ 877      FA9652FF 
+ 877      F99552FF 
+ 877      F888
+ 878 1c26 4BFFF887 		.ascii	"K\377\370\207K\377\367\207K\377\367\206K\377\367\206J\377\367"
+ 878      4BFFF787 
+ 878      4BFFF786 
+ 878      4BFFF786 
+ 878      4AFFF7
+ 879 1c39 854AFFF7 		.ascii	"\205J\377\367\205J\377\367\204J\377\367\204J\377\367\203I\377"
+ 879      854AFFF7 
+ 879      844AFFF7 
+ 879      844AFFF7 
+ 879      8349FF
+ 880 1c4c F78349FF 		.ascii	"\367\203I\377\367\202I\377\367\202I\377\367\201H\377\367\201"
+ 880      F78249FF 
+ 880      F78249FF 
+ 880      F78148FF 
+ 880      F781
+ 881 1c5e 48FFF780 		.ascii	"H\377\367\200H\377\366\200H\377\366\177H\377\366~G\377\366~G"
+ 881      48FFF680 
+ 881      48FFF67F 
+GAS LISTING /tmp/ccuplHTA.s 			page 33
+
+
+ 881      48FFF67E 
+ 881      47FFF67E 
+ 882 1c73 FFF67D47 		.ascii	"\377\366}G\377\366}G\377\366|G\377\366|G\377\366{F\377\366{F"
+ 882      FFF67D47 
+ 882      FFF67C47 
+ 882      FFF67C47 
+ 882      FFF67B46 
+ 883 1c8b FFF67A46 		.ascii	"\377\366zF\377\366zF\377\366yF\377\365yF\377\365xE\377\365xE"
+ 883      FFF67A46 
+ 883      FFF67946 
+ 883      FFF57946 
+ 883      FFF57845 
+ 884 1ca3 FFF57745 		.ascii	"\377\365wE\377\365wE\377\365vE\377\365uE\377\365uD\377\365tD"
+ 884      FFF57745 
+ 884      FFF57645 
+ 884      FFF57545 
+ 884      FFF57544 
+ 885 1cbb FFF57444 		.ascii	"\377\365tD\377\365sD\377\365sD\377\364rD\377\364rD\377\364qC"
+ 885      FFF57344 
+ 885      FFF57344 
+ 885      FFF47244 
+ 885      FFF47244 
+ 886 1cd3 FFF47143 		.ascii	"\377\364qC\377\364pC\377\364oC\377\364oC\377\364nC\377\364nC"
+ 886      FFF47043 
+ 886      FFF46F43 
+ 886      FFF46F43 
+ 886      FFF46E43 
+ 887 1ceb FFF46D43 		.ascii	"\377\364mC\377\364mC\377\363lB\377\363lB\377\363kB\377\363kB"
+ 887      FFF46D43 
+ 887      FFF36C42 
+ 887      FFF36C42 
+ 887      FFF36B42 
+ 888 1d03 FFF26B41 		.ascii	"\377\362kA\377\362jA\377\362jA\377\362iA\377\362i@\377\361h@"
+ 888      FFF26A41 
+ 888      FFF26A41 
+ 888      FFF26941 
+ 888      FFF26940 
+ 889 1d1b FFF16840 		.ascii	"\377\361h@\377\361h@\377\361g?\377\360g?\377\360f?\377\360f?"
+ 889      FFF16840 
+ 889      FFF1673F 
+ 889      FFF0673F 
+ 889      FFF0663F 
+ 890 1d33 FFF0653E 		.ascii	"\377\360e>\377\360e>\377\357e>\377\357d>\377\357d=\377\357c="
+ 890      FFF0653E 
+ 890      FFEF653E 
+ 890      FFEF643E 
+ 890      FFEF643D 
+ 891 1d4b FFEE633D 		.ascii	"\377\356c=\377\356b=\377\356b<\377\356b<\377\356a<\377\355a<"
+ 891      FFEE623D 
+ 891      FFEE623C 
+ 891      FFEE623C 
+ 891      FFEE613C 
+ 892 1d63 FFED603C 		.ascii	"\377\355`<\377\355`;\377\355_;\377\354_;\377\354_;\377\354^:"
+ 892      FFED603B 
+ 892      FFED5F3B 
+ 892      FFEC5F3B 
+ 892      FFEC5F3B 
+GAS LISTING /tmp/ccuplHTA.s 			page 34
+
+
+ 893 1d7b FFEC5E3A 		.ascii	"\377\354^:\377\354]:\377\353]:\377\353\\9\377\353\\9\377\353"
+ 893      FFEC5D3A 
+ 893      FFEB5D3A 
+ 893      FFEB5C39 
+ 893      FFEB5C39 
+ 894 1d91 5B39FFEA 		.ascii	"[9\377\352[9\377\352[9\377\352Z8\377\352Z8\377\352Y8\377\351"
+ 894      5B39FFEA 
+ 894      5B39FFEA 
+ 894      5A38FFEA 
+ 894      5A38FFEA 
+ 895 1da9 5938FFE9 		.ascii	"Y8\377\351X7\377\351X7\377\351W7\377\350W7\377\350V7\377\342"
+ 895      5837FFE9 
+ 895      5837FFE9 
+ 895      5737FFE8 
+ 895      5737FFE8 
+ 896 1dc1 4A31FFE2 		.ascii	"J1\377\342I1\377\342I0\377\341H0\377\341H0\377\341H0\377\341"
+ 896      4931FFE2 
+ 896      4930FFE1 
+ 896      4830FFE1 
+ 896      4830FFE1 
+ 897 1dd9 472FFFE1 		.ascii	"G/\377\341G/\377\340F/\377\340F/\377\340E/\377\340E.\377\337"
+ 897      472FFFE0 
+ 897      462FFFE0 
+ 897      462FFFE0 
+ 897      452FFFE0 
+ 898 1df1 442EFFDF 		.ascii	"D.\377\337D.\377\337C.\377\337C.\377\337B-\377\336B-\377\336"
+ 898      442EFFDF 
+ 898      432EFFDF 
+ 898      432EFFDF 
+ 898      422DFFDE 
+ 899 1e09 412DFFDE 		.ascii	"A-\377\336A-\377\336@,\377\335@,\377\335?,\377\335?,\377\335"
+ 899      412DFFDE 
+ 899      402CFFDD 
+ 899      402CFFDD 
+ 899      3F2CFFDD 
+ 900 1e21 3E2CFFDC 		.ascii	">,\377\334>+\377\334=+\377\334=+\377\334<+\377\334<+\377\333"
+ 900      3E2BFFDC 
+ 900      3D2BFFDC 
+ 900      3D2BFFDC 
+ 900      3C2BFFDC 
+ 901 1e39 3B2AFFDB 		.ascii	";*\377\333;*\377\333:*\377\333:*\377\3329*\377\3329)\377\332"
+ 901      3B2AFFDB 
+ 901      3A2AFFDB 
+ 901      3A2AFFDA 
+ 901      392AFFDA 
+ 902 1e51 3829FFDA 		.ascii	"8)\377\3327)\377\3317)\377\3316)\377\3316)\377\3315(\377\331"
+ 902      3729FFD9 
+ 902      3729FFD9 
+ 902      3629FFD9 
+ 902      3629FFD9 
+ 903 1e69 3528FFD8 		.ascii	"5(\377\3304(\377\3303(\377\3303(\377\3302'\377\3272'\377\327"
+ 903      3428FFD8 
+ 903      3328FFD8 
+ 903      3328FFD8 
+ 903      3227FFD7 
+ 904 1e81 3127FFD7 		.ascii	"1'\377\3270'\377\3270'\377\326/'\377\326/'\377\326/'\377\325"
+ 904      3027FFD7 
+GAS LISTING /tmp/ccuplHTA.s 			page 35
+
+
+ 904      3027FFD6 
+ 904      2F27FFD6 
+ 904      2F27FFD6 
+ 905 1e99 2E27FFD5 		.ascii	".'\377\325.'\377\324.'\377\324-'\377\324-'\377\323-'\377\323"
+ 905      2E27FFD4 
+ 905      2E27FFD4 
+ 905      2D27FFD4 
+ 905      2D27FFD3 
+ 906 1eb1 2D27FFD3 		.ascii	"-'\377\323,'\377\322,'\377\322,'\377\321+'\377\321+'\377\321"
+ 906      2C27FFD2 
+ 906      2C27FFD2 
+ 906      2C27FFD1 
+ 906      2B27FFD1 
+ 907 1ec9 2B27FFD0 		.ascii	"+'\377\320*'\377\320*'\377\317*'\377\317)'\377\317)'\377\316"
+ 907      2A27FFD0 
+ 907      2A27FFCF 
+ 907      2A27FFCF 
+ 907      2927FFCF 
+ 908 1ee1 2927FFCE 		.ascii	")'\377\316('\377\316('\377\315('\377\315''\377\314''\377\314"
+ 908      2827FFCE 
+ 908      2827FFCD 
+ 908      2827FFCD 
+ 908      2727FFCC 
+ 909 1ef9 2727FFCC 		.ascii	"''\377\314&'\377\313&'\377\313&'\377\312%'\377\312%'\377\312"
+ 909      2627FFCB 
+ 909      2627FFCB 
+ 909      2627FFCA 
+ 909      2527FFCA 
+ 910 1f11 2527FFC9 		.ascii	"%'\377\311$'\377\311$'\377\310$'\377\310#'\377\310#'\377\307"
+ 910      2427FFC9 
+ 910      2427FFC8 
+ 910      2427FFC8 
+ 910      2327FFC8 
+ 911 1f29 2327FFC7 		.ascii	"#'\377\307\"'\377\307\"'\377\306\"'\377\306!'\377\305!'\377\305"
+ 911      2227FFC7 
+ 911      2227FFC6 
+ 911      2227FFC6 
+ 911      2127FFC5 
+ 912 1f41 2127FFC5 		.ascii	"!'\377\305 '\377\304 '\377\304 '\377\303\037'\377\303\037'\377"
+ 912      2027FFC4 
+ 912      2027FFC4 
+ 912      2027FFC3 
+ 912      1F27FFC3 
+ 913 1f58 B91527FF 		.ascii	"\271\025'\377\270\025'\377\270\024'\377\267\024'\377\267\024"
+ 913      B81527FF 
+ 913      B81427FF 
+ 913      B71427FF 
+ 913      B714
+ 914 1f6a 27FFB713 		.ascii	"'\377\267\023'\377\266\023'\377\266\023'\377\265\022'\377\265"
+ 914      27FFB613 
+ 914      27FFB613 
+ 914      27FFB512 
+ 914      27FFB5
+ 915 1f7d 1227FFB5 		.ascii	"\022'\377\265\021'\377\264\021'\377\264\021'\377\264\020'\377"
+ 915      1127FFB4 
+ 915      1127FFB4 
+ 915      1127FFB4 
+GAS LISTING /tmp/ccuplHTA.s 			page 36
+
+
+ 915      1027FF
+ 916 1f90 B31027FF 		.ascii	"\263\020'\377\263\020&\377\262\017&\377\262\017&\377\262\016"
+ 916      B31026FF 
+ 916      B20F26FF 
+ 916      B20F26FF 
+ 916      B20E
+ 917 1fa2 26FFB10E 		.ascii	"&\377\261\016&\377\261\016&\377\260\r&\377\260\r&\377\260\f&"
+ 917      26FFB10E 
+ 917      26FFB00D 
+ 917      26FFB00D 
+ 917      26FFB00C 
+ 918 1fb7 FFAF0C26 		.ascii	"\377\257\f&\377\257\013&\377"
+ 918      FFAF0B26 
+ 918      FF
+ 919 1fc0 AE0B26FF 		.string	"\256\013&\377\256\013&\377\256\n&\377\255\n&\377\255\t&\377\254\t&\377\254\b&\377\254\b&\
+ 919      AE0B26FF 
+ 919      AE0A26FF 
+ 919      AD0A26FF 
+ 919      AD0926FF 
+ 920 201e 26FFA500 		.string	"&\377\245"
+ 921 2022 26FF     		.ascii	"&\377"
+ 922              		.globl	heatmap_cs_RdYlBu_soft
+ 923              		.section	.data.rel.local
+ 924              		.align 8
+ 925              		.type	heatmap_cs_RdYlBu_soft, @object
+ 926              		.size	heatmap_cs_RdYlBu_soft, 8
+ 927              	heatmap_cs_RdYlBu_soft:
+ 928 0010 00000000 		.quad	soft
+ 928      00000000 
+ 929              		.section	.data.rel.ro.local
+ 930              		.align 16
+ 931              		.type	soft, @object
+ 932              		.size	soft, 16
+ 933              	soft:
+ 934 0020 00000000 		.quad	soft_data
+ 934      00000000 
+ 935 0028 01040000 		.quad	1025
+ 935      00000000 
+ 936              		.section	.rodata
+ 937 2024 00000000 		.align 32
+ 937      00000000 
+ 937      00000000 
+ 937      00000000 
+ 937      00000000 
+ 938              		.type	soft_data, @object
+ 939              		.size	soft_data, 4100
+ 940              	soft_data:
+ 941 2040 00       		.string	""
+ 942 2041 00       		.string	""
+ 943 2042 00       		.string	""
+ 944 2043 00       		.string	""
+ 945 2044 31369500 		.string	"16\225"
+ 946 2048 30369507 		.ascii	"06\225\00707\225\01608\226\02608\226\03509\227%0:\227,0:\227"
+ 946      3037950E 
+ 946      30389616 
+ 946      3038961D 
+ 946      30399725 
+GAS LISTING /tmp/ccuplHTA.s 			page 37
+
+
+ 947 2063 34303B98 		.ascii	"40;\230;/<\230C/<\231J/=\231R/>\231Y/>\232a/?\232h/@\233p/@\233"
+ 947      3B2F3C98 
+ 947      432F3C99 
+ 947      4A2F3D99 
+ 947      522F3E99 
+ 948 2087 772F419B 		.ascii	"w/A\233\177/B\234\206/B\234\215/C\234\225/D\235\234/D\235\244"
+ 948      7F2F429C 
+ 948      862F429C 
+ 948      8D2F439C 
+ 948      952F449D 
+ 949 20a0 2F459EAB 		.ascii	"/E\236\253/E\236\263/F\236\272/G\237\302/G\237\311/H\237\321"
+ 949      2F459EB3 
+ 949      2F469EBA 
+ 949      2F479FC2 
+ 949      2F479FC9 
+ 950 20b8 2F49A0D8 		.ascii	"/I\240\330/I\240\340/J\240\347/J\241\357/K\241\366/L\241\376"
+ 950      2F49A0E0 
+ 950      2F4AA0E7 
+ 950      2F4AA1EF 
+ 950      2F4BA1F6 
+ 951 20d0 2F4CA2FF 		.ascii	"/L\242\377/M\242\377/N\242\377/N\243\377/O\243\377/O\243\377"
+ 951      2F4DA2FF 
+ 951      2F4EA2FF 
+ 951      2F4EA3FF 
+ 951      2F4FA3FF 
+ 952 20e8 3050A4FF 		.ascii	"0P\244\3770Q\244\3770Q\244\3770R\245\3770S\245\3770S\245\377"
+ 952      3051A4FF 
+ 952      3051A4FF 
+ 952      3052A5FF 
+ 952      3053A5FF 
+ 953 2100 3054A6FF 		.ascii	"0T\246\3771T\246\3771U\246\3771V\246\3771V\247\3771W\247\377"
+ 953      3154A6FF 
+ 953      3155A6FF 
+ 953      3156A6FF 
+ 953      3156A7FF 
+ 954 2118 3257A7FF 		.ascii	"2W\247\3772X\250\3772Y\250\3772Y\250\3772Z\251\3773Z\251\377"
+ 954      3258A8FF 
+ 954      3259A8FF 
+ 954      3259A8FF 
+ 954      325AA9FF 
+ 955 2130 335BA9FF 		.ascii	"3[\251\3773\\\251\3773\\\252\3774]\252\3774]\252\3774^\252\377"
+ 955      335CA9FF 
+ 955      335CAAFF 
+ 955      345DAAFF 
+ 955      345DAAFF 
+ 956 2148 355FABFF 		.ascii	"5_\253\3775_\253\3775`\253\3776`\254\3776a\254\3776b\254\377"
+ 956      355FABFF 
+ 956      3560ABFF 
+ 956      3660ACFF 
+ 956      3661ACFF 
+ 957 2160 3762ACFF 		.ascii	"7b\254\3777c\255\3777c\255\3778d\255\3778e\255\3778e\256\377"
+ 957      3763ADFF 
+ 957      3763ADFF 
+ 957      3864ADFF 
+ 957      3865ADFF 
+ 958 2178 3966AEFF 		.ascii	"9f\256\3779f\256\3779g\256\377:h\257\377:h\257\377;i\257\377"
+ 958      3966AEFF 
+GAS LISTING /tmp/ccuplHTA.s 			page 38
+
+
+ 958      3967AEFF 
+ 958      3A68AFFF 
+ 958      3A68AFFF 
+ 959 2190 3B69AFFF 		.ascii	";i\257\377<j\257\377<j\260\377<k\260\377=l\260\377=l\260\377"
+ 959      3C6AAFFF 
+ 959      3C6AB0FF 
+ 959      3C6BB0FF 
+ 959      3D6CB0FF 
+ 960 21a8 3E6DB1FF 		.ascii	">m\261\377>m\261\377?n\261\377?o\261\377@o\262\377@p\262\377"
+ 960      3E6DB1FF 
+ 960      3F6EB1FF 
+ 960      3F6FB1FF 
+ 960      406FB2FF 
+ 961 21c0 4170B2FF 		.ascii	"Ap\262\377Aq\262\377Bq\262\377Br\263\377Cs\263\377Cs\263\377"
+ 961      4171B2FF 
+ 961      4271B2FF 
+ 961      4272B3FF 
+ 961      4373B3FF 
+ 962 21d8 4474B3FF 		.ascii	"Dt\263\377Dt\263\377Eu\264\377Eu\264\377Ev\264\377Ew\265\377"
+ 962      4474B3FF 
+ 962      4575B4FF 
+ 962      4575B4FF 
+ 962      4576B4FF 
+ 963 21f0 4677B5FF 		.ascii	"Fw\265\377Fx\265\377Fx\266\377Fy\266\377Gy\266\377Gz\267\377"
+ 963      4678B5FF 
+ 963      4678B6FF 
+ 963      4679B6FF 
+ 963      4779B6FF 
+ 964 2208 477AB7FF 		.ascii	"Gz\267\377H{\267\377H|\270\377H|\270\377I}\270\377I}\271\377"
+ 964      487BB7FF 
+ 964      487CB8FF 
+ 964      487CB8FF 
+ 964      497DB8FF 
+ 965 2220 497EB9FF 		.ascii	"I~\271\377J~\271\377J\177\272\377J\177\272\377K\200\272\377K"
+ 965      4A7EB9FF 
+ 965      4A7FBAFF 
+ 965      4A7FBAFF 
+ 965      4B80BAFF 
+ 966 2235 81BAFF4B 		.ascii	"\201\272\377K\201\273\377L\202\273\377L\202\273\377L\203\274"
+ 966      81BBFF4C 
+ 966      82BBFF4C 
+ 966      82BBFF4C 
+ 966      83BC
+ 967 2247 FF4D83BC 		.ascii	"\377M\203\274\377M\204\274\377M\204\275\377N\205\275\377N\206"
+ 967      FF4D84BC 
+ 967      FF4D84BD 
+ 967      FF4E85BD 
+ 967      FF4E86
+ 968 225a BDFF4F86 		.ascii	"\275\377O\206\275\377O\207\276\377O\207\276\377P\210\276\377"
+ 968      BDFF4F87 
+ 968      BEFF4F87 
+ 968      BEFF5088 
+ 968      BEFF
+ 969 226c 5088BFFF 		.ascii	"P\210\277\377Q\211\277\377Q\211\277\377Q\212\277\377R\212\300"
+ 969      5189BFFF 
+ 969      5189BFFF 
+ 969      518ABFFF 
+GAS LISTING /tmp/ccuplHTA.s 			page 39
+
+
+ 969      528AC0
+ 970 227f FF528BC0 		.ascii	"\377R\213\300\377S\214\300\377S\214\301\377T\215\301\377T\215"
+ 970      FF538CC0 
+ 970      FF538CC1 
+ 970      FF548DC1 
+ 970      FF548D
+ 971 2292 C1FF548E 		.ascii	"\301\377T\216\301\377U\216\302\377U\217\302\377V\217\302\377"
+ 971      C1FF558E 
+ 971      C2FF558F 
+ 971      C2FF568F 
+ 971      C2FF
+ 972 22a4 5690C3FF 		.ascii	"V\220\303\377W\221\303\377W\221\303\377X\222\303\377X\222\304"
+ 972      5791C3FF 
+ 972      5791C3FF 
+ 972      5892C3FF 
+ 972      5892C4
+ 973 22b7 FF5993C4 		.ascii	"\377Y\223\304\377Y\223\304\377Z\224\305\377Z\224\305\377[\225"
+ 973      FF5993C4 
+ 973      FF5A94C5 
+ 973      FF5A94C5 
+ 973      FF5B95
+ 974 22ca C5FF5B95 		.ascii	"\305\377[\225\305\377\\\226\306\377\\\227\306\377]\227\306\377"
+ 974      C5FF5C96 
+ 974      C6FF5C97 
+ 974      C6FF5D97 
+ 974      C6FF
+ 975 22dc 5D98C6FF 		.ascii	"]\230\306\377^\230\307\377^\231\307\377_\231\307\377_\232\310"
+ 975      5E98C7FF 
+ 975      5E99C7FF 
+ 975      5F99C7FF 
+ 975      5F9AC8
+ 976 22ef FF609AC8 		.ascii	"\377`\232\310\377`\233\310\377a\233\310\377a\234\311\377b\234"
+ 976      FF609BC8 
+ 976      FF619BC8 
+ 976      FF619CC9 
+ 976      FF629C
+ 977 2302 C9FF629D 		.ascii	"\311\377b\235\311\377c\236\311\377d\236\312\377d\237\312\377"
+ 977      C9FF639E 
+ 977      C9FF649E 
+ 977      CAFF649F 
+ 977      CAFF
+ 978 2314 659FCAFF 		.ascii	"e\237\312\377e\240\312\377f\240\313\377f\241\313\377g\241\313"
+ 978      65A0CAFF 
+ 978      66A0CBFF 
+ 978      66A1CBFF 
+ 978      67A1CB
+ 979 2327 FF68A2CB 		.ascii	"\377h\242\313\377h\242\314\377i\243\314\377i\244\314\377j\244"
+ 979      FF68A2CC 
+ 979      FF69A3CC 
+ 979      FF69A4CC 
+ 979      FF6AA4
+ 980 233a CCFF6AA5 		.ascii	"\314\377j\245\315\377k\245\315\377l\246\315\377l\246\316\377"
+ 980      CDFF6BA5 
+ 980      CDFF6CA6 
+ 980      CDFF6CA6 
+ 980      CEFF
+ 981 234c 6DA7CEFF 		.ascii	"m\247\316\377m\247\316\377n\250\316\377o\250\317\377o\251\317"
+GAS LISTING /tmp/ccuplHTA.s 			page 40
+
+
+ 981      6DA7CEFF 
+ 981      6EA8CEFF 
+ 981      6FA8CFFF 
+ 981      6FA9CF
+ 982 235f FF70A9CF 		.ascii	"\377p\251\317\377q\252\317\377q\252\320\377r\253\320\377r\254"
+ 982      FF71AACF 
+ 982      FF71AAD0 
+ 982      FF72ABD0 
+ 982      FF72AC
+ 983 2372 D0FF73AC 		.ascii	"\320\377s\254\320\377t\255\321\377t\255\321\377u\255\321\377"
+ 983      D0FF74AD 
+ 983      D1FF74AD 
+ 983      D1FF75AD 
+ 983      D1FF
+ 984 2384 75AED1FF 		.ascii	"u\256\321\377u\256\321\377v\257\322\377v\257\322\377w\260\322"
+ 984      75AED1FF 
+ 984      76AFD2FF 
+ 984      76AFD2FF 
+ 984      77B0D2
+ 985 2397 FF77B0D2 		.ascii	"\377w\260\322\377x\261\323\377x\261\323\377y\261\323\377y\262"
+ 985      FF78B1D3 
+ 985      FF78B1D3 
+ 985      FF79B1D3 
+ 985      FF79B2
+ 986 23aa D3FF7AB2 		.ascii	"\323\377z\262\324\377z\263\324\377{\263\324\377{\264\324\377"
+ 986      D4FF7AB3 
+ 986      D4FF7BB3 
+ 986      D4FF7BB4 
+ 986      D4FF
+ 987 23bc 7CB4D4FF 		.ascii	"|\264\324\377|\264\325\377}\265\325\377}\265\325\377~\266\325"
+ 987      7CB4D5FF 
+ 987      7DB5D5FF 
+ 987      7DB5D5FF 
+ 987      7EB6D5
+ 988 23cf FF7EB6D6 		.ascii	"\377~\266\326\377\177\267\326\377\177\267\326\377\200\267\326"
+ 988      FF7FB7D6 
+ 988      FF7FB7D6 
+ 988      FF80B7D6 
+ 989 23df FF80B8D7 		.ascii	"\377\200\270\327\377\201\270\327\377\201\271\327\377\202\271"
+ 989      FF81B8D7 
+ 989      FF81B9D7 
+ 989      FF82B9
+ 990 23ee D7FF82BA 		.ascii	"\327\377\202\272\327\377\203\272\330\377\203\272\330\377\204"
+ 990      D7FF83BA 
+ 990      D8FF83BA 
+ 990      D8FF84
+ 991 23fd BBD8FF84 		.ascii	"\273\330\377\204\273\330\377\205\274\331\377\205\274\331\377"
+ 991      BBD8FF85 
+ 991      BCD9FF85 
+ 991      BCD9FF
+ 992 240c 86BDD9FF 		.ascii	"\206\275\331\377\207\275\331\377\207\276\332\377\210\276\332"
+ 992      87BDD9FF 
+ 992      87BEDAFF 
+ 992      88BEDA
+ 993 241b FF88BEDA 		.ascii	"\377\210\276\332\377\211\277\332\377\211\277\332\377\212\300"
+ 993      FF89BFDA 
+ 993      FF89BFDA 
+GAS LISTING /tmp/ccuplHTA.s 			page 41
+
+
+ 993      FF8AC0
+ 994 242a DBFF8AC0 		.ascii	"\333\377\212\300\333\377\213\301\333\377\213\301\333\377\214"
+ 994      DBFF8BC1 
+ 994      DBFF8BC1 
+ 994      DBFF8C
+ 995 2439 C1DCFF8C 		.ascii	"\301\334\377\214\302\334\377\215\302\334\377\215\303\334\377"
+ 995      C2DCFF8D 
+ 995      C2DCFF8D 
+ 995      C3DCFF
+ 996 2448 8EC3DDFF 		.ascii	"\216\303\335\377\217\304\335\377\217\304\335\377\220\304\335"
+ 996      8FC4DDFF 
+ 996      8FC4DDFF 
+ 996      90C4DD
+ 997 2457 FF90C5DD 		.ascii	"\377\220\305\335\377\221\305\336\377\221\306\336\377\222\306"
+ 997      FF91C5DE 
+ 997      FF91C6DE 
+ 997      FF92C6
+ 998 2466 DEFF92C7 		.ascii	"\336\377\222\307\336\377\223\307\337\377\223\307\337\377\224"
+ 998      DEFF93C7 
+ 998      DFFF93C7 
+ 998      DFFF94
+ 999 2475 C8DFFF95 		.ascii	"\310\337\377\225\310\337\377\225\311\340\377\226\311\340\377"
+ 999      C8DFFF95 
+ 999      C9E0FF96 
+ 999      C9E0FF
+ 1000 2484 96CAE0FF 		.ascii	"\226\312\340\377\227\312\340\377\227\312\340\377\230\313\341"
+ 1000      97CAE0FF 
+ 1000      97CAE0FF 
+ 1000      98CBE1
+ 1001 2493 FF98CBE1 		.ascii	"\377\230\313\341\377\231\314\341\377\232\314\341\377\232\315"
+ 1001      FF99CCE1 
+ 1001      FF9ACCE1 
+ 1001      FF9ACD
+ 1002 24a2 E2FF9BCD 		.ascii	"\342\377\233\315\342\377\233\315\342\377\234\316\342\377\234"
+ 1002      E2FF9BCD 
+ 1002      E2FF9CCE 
+ 1002      E2FF9C
+ 1003 24b1 CEE3FF9D 		.ascii	"\316\343\377\235\317\343\377\236\317\343\377\236\320\343\377"
+ 1003      CFE3FF9E 
+ 1003      CFE3FF9E 
+ 1003      D0E3FF
+ 1004 24c0 9FD0E4FF 		.ascii	"\237\320\344\377\237\320\344\377\240\321\344\377\240\321\344"
+ 1004      9FD0E4FF 
+ 1004      A0D1E4FF 
+ 1004      A0D1E4
+ 1005 24cf FFA1D2E5 		.ascii	"\377\241\322\345\377\242\322\345\377\242\322\345\377\243\323"
+ 1005      FFA2D2E5 
+ 1005      FFA2D2E5 
+ 1005      FFA3D3
+ 1006 24de E5FFA3D3 		.ascii	"\345\377\243\323\346\377\244\324\346\377\245\324\346\377\245"
+ 1006      E6FFA4D4 
+ 1006      E6FFA5D4 
+ 1006      E6FFA5
+ 1007 24ed D5E6FFA6 		.ascii	"\325\346\377\246\325\346\377\246\325\347\377\247\326\347\377"
+ 1007      D5E6FFA6 
+ 1007      D5E7FFA7 
+ 1007      D6E7FF
+GAS LISTING /tmp/ccuplHTA.s 			page 42
+
+
+ 1008 24fc A7D6E7FF 		.ascii	"\247\326\347\377\250\327\347\377\251\327\350\377\251\330\350"
+ 1008      A8D7E7FF 
+ 1008      A9D7E8FF 
+ 1008      A9D8E8
+ 1009 250b FFAAD8E8 		.ascii	"\377\252\330\350\377\252\330\350\377\253\331\351\377\253\331"
+ 1009      FFAAD8E8 
+ 1009      FFABD9E9 
+ 1009      FFABD9
+ 1010 251a E9FFACD9 		.ascii	"\351\377\254\331\351\377\254\331\351\377\255\332\351\377\256"
+ 1010      E9FFACD9 
+ 1010      E9FFADDA 
+ 1010      E9FFAE
+ 1011 2529 DAE9FFAE 		.ascii	"\332\351\377\256\332\351\377\257\333\352\377\257\333\352\377"
+ 1011      DAE9FFAF 
+ 1011      DBEAFFAF 
+ 1011      DBEAFF
+ 1012 2538 B0DBEAFF 		.ascii	"\260\333\352\377\260\333\352\377\261\334\352\377\261\334\352"
+ 1012      B0DBEAFF 
+ 1012      B1DCEAFF 
+ 1012      B1DCEA
+ 1013 2547 FFB2DCEA 		.ascii	"\377\262\334\352\377\262\334\352\377\263\335\353\377\263\335"
+ 1013      FFB2DCEA 
+ 1013      FFB3DDEB 
+ 1013      FFB3DD
+ 1014 2556 EBFFB4DD 		.ascii	"\353\377\264\335\353\377\264\335\353\377\265\336\353\377\265"
+ 1014      EBFFB4DD 
+ 1014      EBFFB5DE 
+ 1014      EBFFB5
+ 1015 2565 DEEBFFB6 		.ascii	"\336\353\377\266\336\353\377\266\336\354\377\267\337\354\377"
+ 1015      DEEBFFB6 
+ 1015      DEECFFB7 
+ 1015      DFECFF
+ 1016 2574 B7DFECFF 		.ascii	"\267\337\354\377\270\337\354\377\270\337\354\377\271\340\354"
+ 1016      B8DFECFF 
+ 1016      B8DFECFF 
+ 1016      B9E0EC
+ 1017 2583 FFB9E0EC 		.ascii	"\377\271\340\354\377\272\340\355\377\273\340\355\377\273\341"
+ 1017      FFBAE0ED 
+ 1017      FFBBE0ED 
+ 1017      FFBBE1
+ 1018 2592 EDFFBCE1 		.ascii	"\355\377\274\341\355\377\274\341\355\377\275\341\355\377\275"
+ 1018      EDFFBCE1 
+ 1018      EDFFBDE1 
+ 1018      EDFFBD
+ 1019 25a1 E2EDFFBE 		.ascii	"\342\355\377\276\342\356\377\276\342\356\377\277\342\356\377"
+ 1019      E2EEFFBE 
+ 1019      E2EEFFBF 
+ 1019      E2EEFF
+ 1020 25b0 BFE3EEFF 		.ascii	"\277\343\356\377\300\343\356\377\300\343\356\377\301\343\356"
+ 1020      C0E3EEFF 
+ 1020      C0E3EEFF 
+ 1020      C1E3EE
+ 1021 25bf FFC1E4EF 		.ascii	"\377\301\344\357\377\302\344\357\377\302\344\357\377\303\344"
+ 1021      FFC2E4EF 
+ 1021      FFC2E4EF 
+ 1021      FFC3E4
+ 1022 25ce EFFFC3E5 		.ascii	"\357\377\303\345\357\377\304\345\357\377\304\345\357\377\305"
+GAS LISTING /tmp/ccuplHTA.s 			page 43
+
+
+ 1022      EFFFC4E5 
+ 1022      EFFFC4E5 
+ 1022      EFFFC5
+ 1023 25dd E5F0FFC5 		.ascii	"\345\360\377\305\346\360\377\306\346\360\377\306\346\360\377"
+ 1023      E6F0FFC6 
+ 1023      E6F0FFC6 
+ 1023      E6F0FF
+ 1024 25ec C7E6F0FF 		.ascii	"\307\346\360\377\307\347\360\377\310\347\360\377\310\347\361"
+ 1024      C7E7F0FF 
+ 1024      C8E7F0FF 
+ 1024      C8E7F1
+ 1025 25fb FFC9E8F1 		.ascii	"\377\311\350\361\377\312\350\361\377\312\350\361\377\313\350"
+ 1025      FFCAE8F1 
+ 1025      FFCAE8F1 
+ 1025      FFCBE8
+ 1026 260a F1FFCBE9 		.ascii	"\361\377\313\351\361\377\314\351\361\377\314\351\362\377\315"
+ 1026      F1FFCCE9 
+ 1026      F1FFCCE9 
+ 1026      F2FFCD
+ 1027 2619 E9F2FFCD 		.ascii	"\351\362\377\315\352\362\377\316\352\362\377\316\352\362\377"
+ 1027      EAF2FFCE 
+ 1027      EAF2FFCE 
+ 1027      EAF2FF
+ 1028 2628 CFEAF2FF 		.ascii	"\317\352\362\377\317\353\363\377\320\353\363\377\320\353\363"
+ 1028      CFEBF3FF 
+ 1028      D0EBF3FF 
+ 1028      D0EBF3
+ 1029 2637 FFD1EBF3 		.ascii	"\377\321\353\363\377\321\354\363\377\322\354\363\377\322\354"
+ 1029      FFD1ECF3 
+ 1029      FFD2ECF3 
+ 1029      FFD2EC
+ 1030 2646 F3FFD3EC 		.ascii	"\363\377\323\354\364\377\323\355\364\377\324\355\364\377\324"
+ 1030      F4FFD3ED 
+ 1030      F4FFD4ED 
+ 1030      F4FFD4
+ 1031 2655 EDF4FFD5 		.ascii	"\355\364\377\325\355\364\377\325\356\364\377\326\356\365\377"
+ 1031      EDF4FFD5 
+ 1031      EEF4FFD6 
+ 1031      EEF5FF
+ 1032 2664 D6EEF5FF 		.ascii	"\326\356\365\377\327\356\365\377\327\357\365\377\330\357\365"
+ 1032      D7EEF5FF 
+ 1032      D7EFF5FF 
+ 1032      D8EFF5
+ 1033 2673 FFD8EFF5 		.ascii	"\377\330\357\365\377\331\357\365\377\332\360\366\377\332\360"
+ 1033      FFD9EFF5 
+ 1033      FFDAF0F6 
+ 1033      FFDAF0
+ 1034 2682 F6FFDBF0 		.ascii	"\366\377\333\360\366\377\333\360\366\377\334\361\366\377\334"
+ 1034      F6FFDBF0 
+ 1034      F6FFDCF1 
+ 1034      F6FFDC
+ 1035 2691 F1F6FFDD 		.ascii	"\361\366\377\335\361\367\377\335\361\367\377\336\362\367\377"
+ 1035      F1F7FFDD 
+ 1035      F1F7FFDE 
+ 1035      F2F7FF
+ 1036 26a0 DEF2F7FF 		.ascii	"\336\362\367\377\337\362\367\377\337\362\367\377\337\363\370"
+ 1036      DFF2F7FF 
+GAS LISTING /tmp/ccuplHTA.s 			page 44
+
+
+ 1036      DFF2F7FF 
+ 1036      DFF3F8
+ 1037 26af FFDFF3F8 		.ascii	"\377\337\363\370\377\336\363\370\377\336\363\370\377\335\364"
+ 1037      FFDEF3F8 
+ 1037      FFDEF3F8 
+ 1037      FFDDF4
+ 1038 26be F8FFDDF4 		.ascii	"\370\377\335\364\370\377\334\364\371\377\333\365\371\377\333"
+ 1038      F8FFDCF4 
+ 1038      F9FFDBF5 
+ 1038      F9FFDB
+ 1039 26cd F5F9FFDA 		.ascii	"\365\371\377\332\365\371\377\332\365\371\377\331\366\371\377"
+ 1039      F5F9FFDA 
+ 1039      F5F9FFD9 
+ 1039      F6F9FF
+ 1040 26dc D9F6F9FF 		.ascii	"\331\366\371\377\330\366\371\377\330\367\371\377\327\367\371"
+ 1040      D8F6F9FF 
+ 1040      D8F7F9FF 
+ 1040      D7F7F9
+ 1041 26eb FFD7F7F9 		.ascii	"\377\327\367\371\377\326\367\371\377\326\370\370\377\325\370"
+ 1041      FFD6F7F9 
+ 1041      FFD6F8F8 
+ 1041      FFD5F8
+ 1042 26fa F8FFD5F8 		.ascii	"\370\377\325\370\370\377\324\371\370\377\324\371\370\377\324"
+ 1042      F8FFD4F9 
+ 1042      F8FFD4F9 
+ 1042      F8FFD4
+ 1043 2709 F9F8FFD3 		.ascii	"\371\370\377\323\371\367\377\323\372\367\377\323\372\367\377"
+ 1043      F9F7FFD3 
+ 1043      FAF7FFD3 
+ 1043      FAF7FF
+ 1044 2718 D2FAF6FF 		.ascii	"\322\372\366\377\322\372\366\377\322\373\366\377\321\373\365"
+ 1044      D2FAF6FF 
+ 1044      D2FBF6FF 
+ 1044      D1FBF5
+ 1045 2727 FFD1FBF5 		.ascii	"\377\321\373\365\377\321\373\365\377\321\374\364\377\320\374"
+ 1045      FFD1FBF5 
+ 1045      FFD1FCF4 
+ 1045      FFD0FC
+ 1046 2736 F4FFD0FC 		.ascii	"\364\377\320\374\363\377\320\374\363\377\320\375\362\377\320"
+ 1046      F3FFD0FC 
+ 1046      F3FFD0FD 
+ 1046      F2FFD0
+ 1047 2745 FDF2FFD0 		.ascii	"\375\362\377\320\375\361\377\320\375\361\377\320\375\360\377"
+ 1047      FDF1FFD0 
+ 1047      FDF1FFD0 
+ 1047      FDF0FF
+ 1048 2754 D0FEF0FF 		.ascii	"\320\376\360\377\320\376\357\377\320\376\356\377\320\376\356"
+ 1048      D0FEEFFF 
+ 1048      D0FEEEFF 
+ 1048      D0FEEE
+ 1049 2763 FFD0FEED 		.ascii	"\377\320\376\355\377\320\377\355\377\320\377\354\377\320\377"
+ 1049      FFD0FFED 
+ 1049      FFD0FFEC 
+ 1049      FFD0FF
+ 1050 2772 EBFFD1FF 		.ascii	"\353\377\321\377\352\377\321\377\352\377\321\377\351\377\321"
+ 1050      EAFFD1FF 
+ 1050      EAFFD1FF 
+GAS LISTING /tmp/ccuplHTA.s 			page 45
+
+
+ 1050      E9FFD1
+ 1051 2781 FFE8FFD2 		.ascii	"\377\350\377\322\377\350\377\322\377\347\377\322\377\346\377"
+ 1051      FFE8FFD2 
+ 1051      FFE7FFD2 
+ 1051      FFE6FF
+ 1052 2790 D3FFE5FF 		.ascii	"\323\377\345\377\323\377\344\377\324\377\344\377\324\377\343"
+ 1052      D3FFE4FF 
+ 1052      D4FFE4FF 
+ 1052      D4FFE3
+ 1053 279f FFD5FFE2 		.ascii	"\377\325\377\342\377\325\377\341\377\326\377\340\377\326\377"
+ 1053      FFD5FFE1 
+ 1053      FFD6FFE0 
+ 1053      FFD6FF
+ 1054 27ae DFFFD7FF 		.ascii	"\337\377\327\377\336\377\330\377\336\377\330\377\335\377\331"
+ 1054      DEFFD8FF 
+ 1054      DEFFD8FF 
+ 1054      DDFFD9
+ 1055 27bd FFDCFFDA 		.ascii	"\377\334\377\332\377\333\377\333\377\332\377\333\377\331\377"
+ 1055      FFDBFFDB 
+ 1055      FFDAFFDB 
+ 1055      FFD9FF
+ 1056 27cc DCFFD8FF 		.ascii	"\334\377\330\377\335\377\327\377\336\377\326\377\337\377\325"
+ 1056      DDFFD7FF 
+ 1056      DEFFD6FF 
+ 1056      DFFFD5
+ 1057 27db FFE0FFD5 		.ascii	"\377\340\377\325\377\341\377\324\377\342\377\323\377\343\377"
+ 1057      FFE1FFD4 
+ 1057      FFE2FFD3 
+ 1057      FFE3FF
+ 1058 27ea D2FFE4FF 		.ascii	"\322\377\344\377\321\377\345\377\320\377\346\377\317\377\347"
+ 1058      D1FFE5FF 
+ 1058      D0FFE6FF 
+ 1058      CFFFE7
+ 1059 27f9 FFCEFFE8 		.ascii	"\377\316\377\350\377\315\377\351\377\314\377\352\377\313\377"
+ 1059      FFCDFFE9 
+ 1059      FFCCFFEA 
+ 1059      FFCBFF
+ 1060 2808 EBFFCBFF 		.ascii	"\353\377\313\377\354\377\312\377"
+ 1060      ECFFCAFF 
+ 1061 2810 EEFFC9FF 		.ascii	"\356\377\311\377\357\377\310\377\360\377\307\377\361\377\306"
+ 1061      EFFFC8FF 
+ 1061      F0FFC7FF 
+ 1061      F1FFC6
+ 1062 281f FFF3FFC5 		.ascii	"\377\363\377\305\377\364\377\305\377\365\377\304\377\366\377"
+ 1062      FFF4FFC5 
+ 1062      FFF5FFC4 
+ 1062      FFF6FF
+ 1063 282e C3FFF8FF 		.ascii	"\303\377\370\377\302\377\371\377\301\377\372\377\301\377\374"
+ 1063      C2FFF9FF 
+ 1063      C1FFFAFF 
+ 1063      C1FFFC
+ 1064 283d FFC0FFFD 		.ascii	"\377\300\377\375\377\277\377\376\377\276\377\376\376\276\377"
+ 1064      FFBFFFFE 
+ 1064      FFBEFFFE 
+ 1064      FEBEFF
+ 1065 284c FEFEBEFF 		.ascii	"\376\376\276\377\376\376\275\377\376\375\275\377\376\375\274"
+ 1065      FEFEBDFF 
+GAS LISTING /tmp/ccuplHTA.s 			page 46
+
+
+ 1065      FEFDBDFF 
+ 1065      FEFDBC
+ 1066 285b FFFEFDBC 		.ascii	"\377\376\375\274\377\376\374\273\377\376\374\273\377\376\374"
+ 1066      FFFEFCBB 
+ 1066      FFFEFCBB 
+ 1066      FFFEFC
+ 1067 286a BAFFFEFC 		.ascii	"\272\377\376\374\272\377\376\373\271\377\376\373\271\377\376"
+ 1067      BAFFFEFB 
+ 1067      B9FFFEFB 
+ 1067      B9FFFE
+ 1068 2879 FBB8FFFE 		.ascii	"\373\270\377\376\372\270\377\376\372\267\377\376\372\267\377"
+ 1068      FAB8FFFE 
+ 1068      FAB7FFFE 
+ 1068      FAB7FF
+ 1069 2888 FEFAB6FF 		.ascii	"\376\372\266\377\376\371\266\377\376\371\265\377\376\371\265"
+ 1069      FEF9B6FF 
+ 1069      FEF9B5FF 
+ 1069      FEF9B5
+ 1070 2897 FFFEF8B4 		.ascii	"\377\376\370\264\377\376\370\264\377\376\370\263\377\376\370"
+ 1070      FFFEF8B4 
+ 1070      FFFEF8B3 
+ 1070      FFFEF8
+ 1071 28a6 B3FFFEF7 		.ascii	"\263\377\376\367\263\377\376\367\262\377\376\367\262\377\376"
+ 1071      B3FFFEF7 
+ 1071      B2FFFEF7 
+ 1071      B2FFFE
+ 1072 28b5 F6B1FFFD 		.ascii	"\366\261\377\375\366\261\377\375\366\260\377\375\365\260\377"
+ 1072      F6B1FFFD 
+ 1072      F6B0FFFD 
+ 1072      F5B0FF
+ 1073 28c4 FDF5AFFF 		.ascii	"\375\365\257\377\375\365\257\377\375\365\256\377\375\364\256"
+ 1073      FDF5AFFF 
+ 1073      FDF5AEFF 
+ 1073      FDF4AE
+ 1074 28d3 FFFDF4AD 		.ascii	"\377\375\364\255\377\375\364\255\377\375\363\254\377\375\363"
+ 1074      FFFDF4AD 
+ 1074      FFFDF3AC 
+ 1074      FFFDF3
+ 1075 28e2 ACFFFDF3 		.ascii	"\254\377\375\363\253\377\375\363\253\377\375\362\253\377\375"
+ 1075      ABFFFDF3 
+ 1075      ABFFFDF2 
+ 1075      ABFFFD
+ 1076 28f1 F2AAFFFD 		.ascii	"\362\252\377\375\362\252\377\375\361\251\377\375\361\251\377"
+ 1076      F2AAFFFD 
+ 1076      F1A9FFFD 
+ 1076      F1A9FF
+ 1077 2900 FDF1A8FF 		.ascii	"\375\361\250\377\375\360\250\377\375\360\247\377\375\360\247"
+ 1077      FDF0A8FF 
+ 1077      FDF0A7FF 
+ 1077      FDF0A7
+ 1078 290f FFFDF0A6 		.ascii	"\377\375\360\246\377\375\357\246\377\375\357\245\377\375\357"
+ 1078      FFFDEFA6 
+ 1078      FFFDEFA5 
+ 1078      FFFDEF
+ 1079 291e A5FFFDEE 		.ascii	"\245\377\375\356\245\377\375\356\244\377\375\356\244\377\375"
+ 1079      A5FFFDEE 
+ 1079      A4FFFDEE 
+GAS LISTING /tmp/ccuplHTA.s 			page 47
+
+
+ 1079      A4FFFD
+ 1080 292d EDA3FFFD 		.ascii	"\355\243\377\375\355\243\377\375\355\242\377\375\354\242\377"
+ 1080      EDA3FFFD 
+ 1080      EDA2FFFD 
+ 1080      ECA2FF
+ 1081 293c FDECA1FF 		.ascii	"\375\354\241\377\375\354\241\377\375\354\240\377\375\353\240"
+ 1081      FDECA1FF 
+ 1081      FDECA0FF 
+ 1081      FDEBA0
+ 1082 294b FFFDEB9F 		.ascii	"\377\375\353\237\377\375\353\237\377\375\352\237\377\375\352"
+ 1082      FFFDEB9F 
+ 1082      FFFDEA9F 
+ 1082      FFFDEA
+ 1083 295a 9EFFFDEA 		.ascii	"\236\377\375\352\236\377\375\351\235\377\375\351\235\377\375"
+ 1083      9EFFFDE9 
+ 1083      9DFFFDE9 
+ 1083      9DFFFD
+ 1084 2969 E99CFFFD 		.ascii	"\351\234\377\375\350\234\377\375\350\233\377\375\350\233\377"
+ 1084      E89CFFFD 
+ 1084      E89BFFFD 
+ 1084      E89BFF
+ 1085 2978 FDE89BFF 		.ascii	"\375\350\233\377\375\347\232\377\375\347\232\377\375\347\231"
+ 1085      FDE79AFF 
+ 1085      FDE79AFF 
+ 1085      FDE799
+ 1086 2987 FFFDE699 		.ascii	"\377\375\346\231\377\375\346\230\377\375\346\230\377\375\345"
+ 1086      FFFDE698 
+ 1086      FFFDE698 
+ 1086      FFFDE5
+ 1087 2996 97FFFDE5 		.ascii	"\227\377\375\345\227\377\375\345\227\377\375\344\226\377\375"
+ 1087      97FFFDE5 
+ 1087      97FFFDE4 
+ 1087      96FFFD
+ 1088 29a5 E496FFFD 		.ascii	"\344\226\377\375\344\225\377\375\343\225\377\375\343\224\377"
+ 1088      E495FFFD 
+ 1088      E395FFFD 
+ 1088      E394FF
+ 1089 29b4 FDE394FF 		.ascii	"\375\343\224\377\375\342\224\377\375\342\223\377\375\342\223"
+ 1089      FDE294FF 
+ 1089      FDE293FF 
+ 1089      FDE293
+ 1090 29c3 FFFDE292 		.ascii	"\377\375\342\222\377\375\341\222\377\375\341\221\377\375\341"
+ 1090      FFFDE192 
+ 1090      FFFDE191 
+ 1090      FFFDE1
+ 1091 29d2 91FFFDE0 		.ascii	"\221\377\375\340\221\377\375\340\220\377\375\340\220\377\375"
+ 1091      91FFFDE0 
+ 1091      90FFFDE0 
+ 1091      90FFFD
+ 1092 29e1 DF8FFFFD 		.ascii	"\337\217\377\375\337\217\377\375\336\216\377\375\336\216\377"
+ 1092      DF8FFFFD 
+ 1092      DE8EFFFD 
+ 1092      DE8EFF
+ 1093 29f0 FDDD8DFF 		.ascii	"\375\335\215\377\375\335\214\377\375\334\214\377\375\334\213"
+ 1093      FDDD8CFF 
+ 1093      FDDC8CFF 
+ 1093      FDDC8B
+GAS LISTING /tmp/ccuplHTA.s 			page 48
+
+
+ 1094 29ff FFFDDC8B 		.ascii	"\377\375\334\213\377\375\333\212\377\375\333\212\377\375\332"
+ 1094      FFFDDB8A 
+ 1094      FFFDDB8A 
+ 1094      FFFDDA
+ 1095 2a0e 89FFFDDA 		.ascii	"\211\377\375\332\211\377\375\331\210\377\375\331\210\377\375"
+ 1095      89FFFDD9 
+ 1095      88FFFDD9 
+ 1095      88FFFD
+ 1096 2a1d D887FFFD 		.ascii	"\330\207\377\375\330\206\377\375\327\206\377\375\327\205\377"
+ 1096      D886FFFD 
+ 1096      D786FFFD 
+ 1096      D785FF
+ 1097 2a2c FDD685FF 		.ascii	"\375\326\205\377\375\326\204\377\375\325\204\377\375\325\203"
+ 1097      FDD684FF 
+ 1097      FDD584FF 
+ 1097      FDD583
+ 1098 2a3b FFFDD483 		.ascii	"\377\375\324\203\377\375\324\202\377\375\324\202\377\375\323"
+ 1098      FFFDD482 
+ 1098      FFFDD482 
+ 1098      FFFDD3
+ 1099 2a4a 81FFFDD3 		.ascii	"\201\377\375\323\201\377\375\322\200\377\375\322\200\377\375"
+ 1099      81FFFDD2 
+ 1099      80FFFDD2 
+ 1099      80FFFD
+ 1100 2a59 D17FFFFD 		.ascii	"\321\177\377\375\321\177\377\375\320~\377\375\320~\377\375\317"
+ 1100      D17FFFFD 
+ 1100      D07EFFFD 
+ 1100      D07EFFFD 
+ 1100      CF
+ 1101 2a6a 7DFFFDCF 		.ascii	"}\377\375\317}\377\375\316|\377\375\316|\377\375\315{\377\375"
+ 1101      7DFFFDCE 
+ 1101      7CFFFDCE 
+ 1101      7CFFFDCD 
+ 1101      7BFFFD
+ 1102 2a7d CD7BFFFD 		.ascii	"\315{\377\375\314z\377\375\314z\377\375\313y\377\375\313y\377"
+ 1102      CC7AFFFD 
+ 1102      CC7AFFFD 
+ 1102      CB79FFFD 
+ 1102      CB79FF
+ 1103 2a90 FDCA78FF 		.ascii	"\375\312x\377\375\312x\377\375\311w\377\375\311w\377\375\310"
+ 1103      FDCA78FF 
+ 1103      FDC977FF 
+ 1103      FDC977FF 
+ 1103      FDC8
+ 1104 2aa2 76FFFDC8 		.ascii	"v\377\375\310v\377\375\310v\377\375\307u\377\375\307u\377\375"
+ 1104      76FFFDC8 
+ 1104      76FFFDC7 
+ 1104      75FFFDC7 
+ 1104      75FFFD
+ 1105 2ab5 C674FFFD 		.ascii	"\306t\377\375\306t\377\375\305s\377\375\305s\377\375\304r\377"
+ 1105      C674FFFD 
+ 1105      C573FFFD 
+ 1105      C573FFFD 
+ 1105      C472FF
+ 1106 2ac8 FDC472FF 		.ascii	"\375\304r\377\375\303q\377\375\303q\377\375\302q\377\375\302"
+ 1106      FDC371FF 
+ 1106      FDC371FF 
+GAS LISTING /tmp/ccuplHTA.s 			page 49
+
+
+ 1106      FDC271FF 
+ 1106      FDC2
+ 1107 2ada 70FFFDC1 		.ascii	"p\377\375\301p\377\375\301o\377\375\300o\377\375\300n\377\375"
+ 1107      70FFFDC1 
+ 1107      6FFFFDC0 
+ 1107      6FFFFDC0 
+ 1107      6EFFFD
+ 1108 2aed BF6EFFFD 		.ascii	"\277n\377\375\277n\377\375\276m\377\375\276m\377\375\275l\377"
+ 1108      BF6EFFFD 
+ 1108      BE6DFFFD 
+ 1108      BE6DFFFD 
+ 1108      BD6CFF
+ 1109 2b00 FDBD6CFF 		.ascii	"\375\275l\377\375\274k\377\375\274k\377\375\273k\377\375\273"
+ 1109      FDBC6BFF 
+ 1109      FDBC6BFF 
+ 1109      FDBB6BFF 
+ 1109      FDBB
+ 1110 2b12 6AFFFDBA 		.ascii	"j\377\375\272j\377\375\272i\377\375\271i\377\375\271i\377\375"
+ 1110      6AFFFDBA 
+ 1110      69FFFDB9 
+ 1110      69FFFDB9 
+ 1110      69FFFD
+ 1111 2b25 B868FFFD 		.ascii	"\270h\377\375\270h\377\375\267g\377\375\267g\377\375\266g\377"
+ 1111      B868FFFD 
+ 1111      B767FFFD 
+ 1111      B767FFFD 
+ 1111      B667FF
+ 1112 2b38 FDB666FF 		.ascii	"\375\266f\377\375\265f\377\375\265e\377\375\264e\377\375\264"
+ 1112      FDB566FF 
+ 1112      FDB565FF 
+ 1112      FDB465FF 
+ 1112      FDB4
+ 1113 2b4a 65FFFDB3 		.ascii	"e\377\375\263d\377\375\263d\377\375\262d\377\375\262c\377\375"
+ 1113      64FFFDB3 
+ 1113      64FFFDB2 
+ 1113      64FFFDB2 
+ 1113      63FFFD
+ 1114 2b5d B163FFFD 		.ascii	"\261c\377\375\260c\377\375\260b\377\375\257b\377\375\257a\377"
+ 1114      B063FFFD 
+ 1114      B062FFFD 
+ 1114      AF62FFFD 
+ 1114      AF61FF
+ 1115 2b70 FDAE61FF 		.ascii	"\375\256a\377\375\256a\377\374\255`\377\374\255`\377\374\254"
+ 1115      FDAE61FF 
+ 1115      FCAD60FF 
+ 1115      FCAD60FF 
+ 1115      FCAC
+ 1116 2b82 60FFFCAC 		.ascii	"`\377\374\254_\377\374\253_\377\374\252^\377\374\252^\377\374"
+ 1116      5FFFFCAB 
+ 1116      5FFFFCAA 
+ 1116      5EFFFCAA 
+ 1116      5EFFFC
+ 1117 2b95 A95DFFFC 		.ascii	"\251]\377\374\251]\377\374\250]\377\374\247\\\377\374\247\\\377"
+ 1117      A95DFFFC 
+ 1117      A85DFFFC 
+ 1117      A75CFFFC 
+ 1117      A75CFF
+GAS LISTING /tmp/ccuplHTA.s 			page 50
+
+
+ 1118 2ba8 FCA65BFF 		.ascii	"\374\246[\377\374\246[\377\373\245Z\377\373\245Z\377\373\244"
+ 1118      FCA65BFF 
+ 1118      FBA55AFF 
+ 1118      FBA55AFF 
+ 1118      FBA4
+ 1119 2bba 5AFFFBA3 		.ascii	"Z\377\373\243Y\377\373\243Y\377\373\242Y\377\373\242X\377\373"
+ 1119      59FFFBA3 
+ 1119      59FFFBA2 
+ 1119      59FFFBA2 
+ 1119      58FFFB
+ 1120 2bcd A158FFFB 		.ascii	"\241X\377\373\240W\377\373\240W\377\373\237W\377\373\237V\377"
+ 1120      A057FFFB 
+ 1120      A057FFFB 
+ 1120      9F57FFFB 
+ 1120      9F56FF
+ 1121 2be0 FB9E56FF 		.ascii	"\373\236V\377\373\235U\377\372\235U\377\372\234U\377\372\233"
+ 1121      FB9D55FF 
+ 1121      FA9D55FF 
+ 1121      FA9C55FF 
+ 1121      FA9B
+ 1122 2bf2 54FFFA9B 		.ascii	"T\377\372\233T\377\372\232T\377\372\232S\377\372\231S\377\372"
+ 1122      54FFFA9A 
+ 1122      54FFFA9A 
+ 1122      53FFFA99 
+ 1122      53FFFA
+ 1123 2c05 9853FFFA 		.ascii	"\230S\377\372\230R\377\372\227R\377\372\227R\377\372\226Q\377"
+ 1123      9852FFFA 
+ 1123      9752FFFA 
+ 1123      9752FFFA 
+ 1123      9651FF
+ 1124 2c18 FA9551FF 		.ascii	"\372\225Q\377\371\225Q\377\371\224P\377\371\223P\377\371\223"
+ 1124      F99551FF 
+ 1124      F99450FF 
+ 1124      F99350FF 
+ 1124      F993
+ 1125 2c2a 50FFF992 		.ascii	"P\377\371\222O\377\371\222O\377\371\221O\377\371\220N\377\371"
+ 1125      4FFFF992 
+ 1125      4FFFF991 
+ 1125      4FFFF990 
+ 1125      4EFFF9
+ 1126 2c3d 904EFFF9 		.ascii	"\220N\377\371\217N\377\371\216N\377\371\216M\377\370\215M\377"
+ 1126      8F4EFFF9 
+ 1126      8E4EFFF9 
+ 1126      8E4DFFF8 
+ 1126      8D4DFF
+ 1127 2c50 F88D4DFF 		.ascii	"\370\215M\377\370\214L\377\370\213L\377\370\213L\377\370\212"
+ 1127      F88C4CFF 
+ 1127      F88B4CFF 
+ 1127      F88B4CFF 
+ 1127      F88A
+ 1128 2c62 4CFFF889 		.ascii	"L\377\370\211K\377\370\211K\377\370\210K\377\370\207J\377\370"
+ 1128      4BFFF889 
+ 1128      4BFFF888 
+ 1128      4BFFF887 
+ 1128      4AFFF8
+ 1129 2c75 874AFFF7 		.ascii	"\207J\377\367\206J\377\367\206J\377\367\205I\377\367\204I\377"
+ 1129      864AFFF7 
+GAS LISTING /tmp/ccuplHTA.s 			page 51
+
+
+ 1129      864AFFF7 
+ 1129      8549FFF7 
+ 1129      8449FF
+ 1130 2c88 F78449FF 		.ascii	"\367\204I\377\367\203I\377\367\202H\377\367\202H\377\367\201"
+ 1130      F78349FF 
+ 1130      F78248FF 
+ 1130      F78248FF 
+ 1130      F781
+ 1131 2c9a 48FFF780 		.ascii	"H\377\367\200H\377\367\200H\377\366\177G\377\366~G\377\366~G"
+ 1131      48FFF780 
+ 1131      48FFF67F 
+ 1131      47FFF67E 
+ 1131      47FFF67E 
+ 1132 2caf FFF67D47 		.ascii	"\377\366}G\377\366|F\377\366|F\377\366{F\377\366zF\377\366zF"
+ 1132      FFF67C46 
+ 1132      FFF67C46 
+ 1132      FFF67B46 
+ 1132      FFF67A46 
+ 1133 2cc7 FFF67945 		.ascii	"\377\366yE\377\365xE\377\365xE\377\365wE\377\365vE\377\365vE"
+ 1133      FFF57845 
+ 1133      FFF57845 
+ 1133      FFF57745 
+ 1133      FFF57645 
+ 1134 2cdf FFF57544 		.ascii	"\377\365uD\377\365tD\377\365tD\377\365sD\377\364rD\377\364rD"
+ 1134      FFF57444 
+ 1134      FFF57444 
+ 1134      FFF57344 
+ 1134      FFF47244 
+ 1135 2cf7 FFF47143 		.ascii	"\377\364qC\377\364pC\377\364oC\377\364oC\377\364nC\377\364mC"
+ 1135      FFF47043 
+ 1135      FFF46F43 
+ 1135      FFF46F43 
+ 1135      FFF46E43 
+ 1136 2d0f FFF46D43 		.ascii	"\377\364mC\377\363lB\377\363lB\377\363kB\377\362kA\377\362jA"
+ 1136      FFF36C42 
+ 1136      FFF36C42 
+ 1136      FFF36B42 
+ 1136      FFF26B41 
+ 1137 2d27 FFF26941 		.ascii	"\377\362iA\377\362i@\377\361h@\377\361h@\377\361g?\377\361g?"
+ 1137      FFF26940 
+ 1137      FFF16840 
+ 1137      FFF16840 
+ 1137      FFF1673F 
+ 1138 2d3f FFF0663F 		.ascii	"\377\360f?\377\360f?\377\360e>\377\357e>\377\357d>\377\357d="
+ 1138      FFF0663F 
+ 1138      FFF0653E 
+ 1138      FFEF653E 
+ 1138      FFEF643E 
+ 1139 2d57 FFEF633D 		.ascii	"\377\357c=\377\356c=\377\356b<\377\356b<\377\355a<\377\355`<"
+ 1139      FFEE633D 
+ 1139      FFEE623C 
+ 1139      FFEE623C 
+ 1139      FFED613C 
+ 1140 2d6f FFED603B 		.ascii	"\377\355`;\377\355_;\377\354_;\377\354^:\377\354^:\377\354]:"
+ 1140      FFED5F3B 
+ 1140      FFEC5F3B 
+ 1140      FFEC5E3A 
+GAS LISTING /tmp/ccuplHTA.s 			page 52
+
+
+ 1140      FFEC5E3A 
+ 1141 2d87 FFEB5D39 		.ascii	"\377\353]9\377\353\\9\377\353\\9\377\352[9\377\352[8\377\352"
+ 1141      FFEB5C39 
+ 1141      FFEB5C39 
+ 1141      FFEA5B39 
+ 1141      FFEA5B38 
+ 1142 2d9d 5A38FFEA 		.ascii	"Z8\377\352Y8\377\351Y7\377\351X7\377\351X7\377\350W7\377\350"
+ 1142      5938FFE9 
+ 1142      5937FFE9 
+ 1142      5837FFE9 
+ 1142      5837FFE8 
+ 1143 2db5 5736FFE8 		.ascii	"W6\377\350V6\377\350V6\377\347U6\377\347T5\377\347T5\377\346"
+ 1143      5636FFE8 
+ 1143      5636FFE7 
+ 1143      5536FFE7 
+ 1143      5435FFE7 
+ 1144 2dcd 5335FFE6 		.ascii	"S5\377\346S4\377\346R4\377\346R4\377\345Q4\377\345P3\377\345"
+ 1144      5334FFE6 
+ 1144      5234FFE6 
+ 1144      5234FFE5 
+ 1144      5134FFE5 
+ 1145 2de5 5033FFE4 		.ascii	"P3\377\344O3\377\344O2\377\344N2\377\344N2\377\343M2\377\343"
+ 1145      4F33FFE4 
+ 1145      4F32FFE4 
+ 1145      4E32FFE4 
+ 1145      4E32FFE3 
+ 1146 2dfd 4C31FFE3 		.ascii	"L1\377\343L1\377\342K1\377\342K1\377\342J0\377\342I0\377\341"
+ 1146      4C31FFE2 
+ 1146      4B31FFE2 
+ 1146      4B31FFE2 
+ 1146      4A30FFE2 
+ 1147 2e15 4930FFE1 		.ascii	"I0\377\341H0\377\341H/\377\341G/\377\340F/\377\340F.\377\340"
+ 1147      4830FFE1 
+ 1147      482FFFE1 
+ 1147      472FFFE0 
+ 1147      462FFFE0 
+ 1148 2e2d 452EFFDF 		.ascii	"E.\377\337D.\377\337D.\377\337C-\377\336C-\377\336B-\377\336"
+ 1148      442EFFDF 
+ 1148      442EFFDF 
+ 1148      432DFFDE 
+ 1148      432DFFDE 
+ 1149 2e45 412DFFDE 		.ascii	"A-\377\336A,\377\335@,\377\335?,\377\335?,\377\334>+\377\334"
+ 1149      412CFFDD 
+ 1149      402CFFDD 
+ 1149      3F2CFFDD 
+ 1149      3F2CFFDC 
+ 1150 2e5d 3D2BFFDC 		.ascii	"=+\377\334=+\377\334<+\377\333;*\377\333;*\377\333:*\377\332"
+ 1150      3D2BFFDC 
+ 1150      3C2BFFDB 
+ 1150      3B2AFFDB 
+ 1150      3B2AFFDB 
+ 1151 2e75 392AFFDA 		.ascii	"9*\377\3329)\377\3328)\377\3327)\377\3317)\377\3316)\377\331"
+ 1151      3929FFDA 
+ 1151      3829FFDA 
+ 1151      3729FFD9 
+ 1151      3729FFD9 
+ 1152 2e8d 3528FFD8 		.ascii	"5(\377\3304(\377\3304(\377\3303(\377\3302'\377\3271'\377\327"
+GAS LISTING /tmp/ccuplHTA.s 			page 53
+
+
+ 1152      3428FFD8 
+ 1152      3428FFD8 
+ 1152      3328FFD8 
+ 1152      3227FFD7 
+ 1153 2ea5 3127FFD7 		.ascii	"1'\377\3270'\377\326/'\377\326/'\377\325/'\377\325.'\377\324"
+ 1153      3027FFD6 
+ 1153      2F27FFD6 
+ 1153      2F27FFD5 
+ 1153      2F27FFD5 
+ 1154 2ebd 2E27FFD4 		.ascii	".'\377\324-'\377\323-'\377\323-'\377\322,'\377\322,'\377\322"
+ 1154      2D27FFD3 
+ 1154      2D27FFD3 
+ 1154      2D27FFD2 
+ 1154      2C27FFD2 
+ 1155 2ed5 2B27FFD1 		.ascii	"+'\377\321+'\377\321+'\377\320*'\377\320*'\377\317)'\377\317"
+ 1155      2B27FFD1 
+ 1155      2B27FFD0 
+ 1155      2A27FFD0 
+ 1155      2A27FFCF 
+ 1156 2eed 2927FFCE 		.ascii	")'\377\316)'\377\316('\377\315('\377\315''\377\314''\377\314"
+ 1156      2927FFCE 
+ 1156      2827FFCD 
+ 1156      2827FFCD 
+ 1156      2727FFCC 
+ 1157 2f05 2727FFCB 		.ascii	"''\377\313&'\377\313&'\377\312%'\377\312%'\377\311%'\377\311"
+ 1157      2627FFCB 
+ 1157      2627FFCA 
+ 1157      2527FFCA 
+ 1157      2527FFC9 
+ 1158 2f1d 2427FFC8 		.ascii	"$'\377\310$'\377\310#'\377\307#'\377\307\"'\377\306\"'\377\306"
+ 1158      2427FFC8 
+ 1158      2327FFC7 
+ 1158      2327FFC7 
+ 1158      2227FFC6 
+ 1159 2f35 2227FFC5 		.ascii	"\"'\377\305!'\377\305!'\377\304 '\377\304 '\377\304 '\377\303"
+ 1159      2127FFC5 
+ 1159      2127FFC4 
+ 1159      2027FFC4 
+ 1159      2027FFC4 
+ 1160 2f4d 1F27FFC3 		.ascii	"\037'\377\303\037'\377\302\036'\377\302\036'\377\301\035'\377"
+ 1160      1F27FFC2 
+ 1160      1E27FFC2 
+ 1160      1E27FFC1 
+ 1160      1D27FF
+ 1161 2f60 C11D27FF 		.ascii	"\301\035'\377\300\035'\377\300\034'\377\277\034'\377\277\033"
+ 1161      C01D27FF 
+ 1161      C01C27FF 
+ 1161      BF1C27FF 
+ 1161      BF1B
+ 1162 2f72 27FFBE1B 		.ascii	"'\377\276\033'\377\276\032'\377\275\032'\377\275\032'\377\274"
+ 1162      27FFBE1A 
+ 1162      27FFBD1A 
+ 1162      27FFBD1A 
+ 1162      27FFBC
+ 1163 2f85 1927FFBC 		.ascii	"\031'\377\274\031'\377\273\030'\377\273\030'\377\272\027'\377"
+ 1163      1927FFBB 
+ 1163      1827FFBB 
+GAS LISTING /tmp/ccuplHTA.s 			page 54
+
+
+ 1163      1827FFBA 
+ 1163      1727FF
+ 1164 2f98 BA1727FF 		.ascii	"\272\027'\377\271\026'\377\271\026'\377\270\025'\377\270\025"
+ 1164      B91627FF 
+ 1164      B91627FF 
+ 1164      B81527FF 
+ 1164      B815
+ 1165 2faa 27FFB715 		.ascii	"'\377\267\025'\377\267\024'\377\266\024'\377\266\023'\377\265"
+ 1165      27FFB714 
+ 1165      27FFB614 
+ 1165      27FFB613 
+ 1165      27FFB5
+ 1166 2fbd 1327FFB5 		.ascii	"\023'\377\265\022'\377\264\022'\377\264\021'\377\263\021'\377"
+ 1166      1227FFB4 
+ 1166      1227FFB4 
+ 1166      1127FFB3 
+ 1166      1127FF
+ 1167 2fd0 B31027FF 		.ascii	"\263\020'\377\262\020'\377\262\017'\377\261\016&\377"
+ 1167      B21027FF 
+ 1167      B20F27FF 
+ 1167      B10E26FF 
+ 1168 2fe0 B10E26FF 		.string	"\261\016&\377\260\r&\377\260\r&\377\257\f&\377\257\f&\377\256\013&\377\256\n&\377\255\n&\
+ 1168      B00D26FF 
+ 1168      B00D26FF 
+ 1168      AF0C26FF 
+ 1168      AF0C26FF 
+ 1169 3042 26FF     		.ascii	"&\377"
+ 1170              		.globl	heatmap_cs_RdYlBu_discrete
+ 1171              		.section	.data.rel.local
+ 1172              		.align 8
+ 1173              		.type	heatmap_cs_RdYlBu_discrete, @object
+ 1174              		.size	heatmap_cs_RdYlBu_discrete, 8
+ 1175              	heatmap_cs_RdYlBu_discrete:
+ 1176 0018 00000000 		.quad	discrete
+ 1176      00000000 
+ 1177              		.section	.data.rel.ro.local
+ 1178              		.align 16
+ 1179              		.type	discrete, @object
+ 1180              		.size	discrete, 16
+ 1181              	discrete:
+ 1182 0030 00000000 		.quad	discrete_data
+ 1182      00000000 
+ 1183 0038 0C000000 		.quad	12
+ 1183      00000000 
+ 1184              		.section	.rodata
+ 1185 3044 00000000 		.align 32
+ 1185      00000000 
+ 1185      00000000 
+ 1185      00000000 
+ 1185      00000000 
+ 1186              		.type	discrete_data, @object
+ 1187              		.size	discrete_data, 48
+ 1188              	discrete_data:
+ 1189 3060 00       		.string	""
+ 1190 3061 00       		.string	""
+ 1191 3062 00       		.string	""
+ 1192 3063 00       		.string	""
+GAS LISTING /tmp/ccuplHTA.s 			page 55
+
+
+ 1193 3064 313695FF 		.string	"16\225\377Eu\264\377t\255\321\377\253\331\351\377\340\363\370\377\377\377\277\377\376\340
+ 1193      4575B4FF 
+ 1193      74ADD1FF 
+ 1193      ABD9E9FF 
+ 1193      E0F3F8FF 
+ 1194 308e 26FF     		.ascii	"&\377"
+ 1195              		.text
+ 1196              	.Letext0:
+ 1197              		.file 1 "./heatmap.h"
+ 1198              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1199              		.file 3 "./colorschemes/RdYlBu.h"
+ 1200              		.file 4 "colorschemes/RdYlBu.c"
+ 1201              		.section	.debug_info,"",@progbits
+ 1202              	.Ldebug_info0:
+ 1203 0000 E3010000 		.long	0x1e3
+ 1204 0004 0500     		.value	0x5
+ 1205 0006 01       		.byte	0x1
+ 1206 0007 08       		.byte	0x8
+ 1207 0008 00000000 		.long	.Ldebug_abbrev0
+ 1208 000c 0A       		.uleb128 0xa
+ 1209 000d 00000000 		.long	.LASF26
+ 1210 0011 1D       		.byte	0x1d
+ 1211 0012 00000000 		.long	.LASF0
+ 1212 0016 00000000 		.long	.LASF1
+ 1213 001a 00000000 		.long	.Ldebug_line0
+ 1214 001e 01       		.uleb128 0x1
+ 1215 001f 08       		.byte	0x8
+ 1216 0020 05       		.byte	0x5
+ 1217 0021 00000000 		.long	.LASF2
+ 1218 0025 06       		.uleb128 0x6
+ 1219 0026 00000000 		.long	.LASF12
+ 1220 002a 02       		.byte	0x2
+ 1221 002b D6       		.byte	0xd6
+ 1222 002c 17       		.byte	0x17
+ 1223 002d 31000000 		.long	0x31
+ 1224 0031 01       		.uleb128 0x1
+ 1225 0032 08       		.byte	0x8
+ 1226 0033 07       		.byte	0x7
+ 1227 0034 00000000 		.long	.LASF3
+ 1228 0038 0B       		.uleb128 0xb
+ 1229 0039 04       		.byte	0x4
+ 1230 003a 05       		.byte	0x5
+ 1231 003b 696E7400 		.string	"int"
+ 1232 003f 01       		.uleb128 0x1
+ 1233 0040 08       		.byte	0x8
+ 1234 0041 05       		.byte	0x5
+ 1235 0042 00000000 		.long	.LASF4
+ 1236 0046 01       		.uleb128 0x1
+ 1237 0047 10       		.byte	0x10
+ 1238 0048 04       		.byte	0x4
+ 1239 0049 00000000 		.long	.LASF5
+ 1240 004d 01       		.uleb128 0x1
+ 1241 004e 04       		.byte	0x4
+ 1242 004f 04       		.byte	0x4
+ 1243 0050 00000000 		.long	.LASF6
+ 1244 0054 01       		.uleb128 0x1
+ 1245 0055 04       		.byte	0x4
+GAS LISTING /tmp/ccuplHTA.s 			page 56
+
+
+ 1246 0056 07       		.byte	0x7
+ 1247 0057 00000000 		.long	.LASF7
+ 1248 005b 01       		.uleb128 0x1
+ 1249 005c 02       		.byte	0x2
+ 1250 005d 07       		.byte	0x7
+ 1251 005e 00000000 		.long	.LASF8
+ 1252 0062 0C       		.uleb128 0xc
+ 1253 0063 10       		.byte	0x10
+ 1254 0064 01       		.byte	0x1
+ 1255 0065 BB       		.byte	0xbb
+ 1256 0066 09       		.byte	0x9
+ 1257 0067 84000000 		.long	0x84
+ 1258 006b 07       		.uleb128 0x7
+ 1259 006c 00000000 		.long	.LASF9
+ 1260 0070 BC       		.byte	0xbc
+ 1261 0071 1A       		.byte	0x1a
+ 1262 0072 84000000 		.long	0x84
+ 1263 0076 00       		.byte	0
+ 1264 0077 07       		.uleb128 0x7
+ 1265 0078 00000000 		.long	.LASF10
+ 1266 007c BD       		.byte	0xbd
+ 1267 007d 0C       		.byte	0xc
+ 1268 007e 25000000 		.long	0x25
+ 1269 0082 08       		.byte	0x8
+ 1270 0083 00       		.byte	0
+ 1271 0084 08       		.uleb128 0x8
+ 1272 0085 90000000 		.long	0x90
+ 1273 0089 01       		.uleb128 0x1
+ 1274 008a 01       		.byte	0x1
+ 1275 008b 08       		.byte	0x8
+ 1276 008c 00000000 		.long	.LASF11
+ 1277 0090 03       		.uleb128 0x3
+ 1278 0091 89000000 		.long	0x89
+ 1279 0095 06       		.uleb128 0x6
+ 1280 0096 00000000 		.long	.LASF13
+ 1281 009a 01       		.byte	0x1
+ 1282 009b BE       		.byte	0xbe
+ 1283 009c 03       		.byte	0x3
+ 1284 009d 62000000 		.long	0x62
+ 1285 00a1 03       		.uleb128 0x3
+ 1286 00a2 95000000 		.long	0x95
+ 1287 00a6 08       		.uleb128 0x8
+ 1288 00a7 A1000000 		.long	0xa1
+ 1289 00ab 04       		.uleb128 0x4
+ 1290 00ac 00000000 		.long	.LASF14
+ 1291 00b0 21       		.byte	0x21
+ 1292 00b1 A6000000 		.long	0xa6
+ 1293 00b5 04       		.uleb128 0x4
+ 1294 00b6 00000000 		.long	.LASF15
+ 1295 00ba 23       		.byte	0x23
+ 1296 00bb A6000000 		.long	0xa6
+ 1297 00bf 04       		.uleb128 0x4
+ 1298 00c0 00000000 		.long	.LASF16
+ 1299 00c4 25       		.byte	0x25
+ 1300 00c5 A6000000 		.long	0xa6
+ 1301 00c9 04       		.uleb128 0x4
+ 1302 00ca 00000000 		.long	.LASF17
+GAS LISTING /tmp/ccuplHTA.s 			page 57
+
+
+ 1303 00ce 28       		.byte	0x28
+ 1304 00cf A6000000 		.long	0xa6
+ 1305 00d3 09       		.uleb128 0x9
+ 1306 00d4 90000000 		.long	0x90
+ 1307 00d8 E3000000 		.long	0xe3
+ 1308 00dc 0D       		.uleb128 0xd
+ 1309 00dd 31000000 		.long	0x31
+ 1310 00e1 2F       		.byte	0x2f
+ 1311 00e2 00       		.byte	0
+ 1312 00e3 03       		.uleb128 0x3
+ 1313 00e4 D3000000 		.long	0xd3
+ 1314 00e8 02       		.uleb128 0x2
+ 1315 00e9 00000000 		.long	.LASF18
+ 1316 00ed 20       		.byte	0x20
+ 1317 00ee 1C       		.byte	0x1c
+ 1318 00ef E3000000 		.long	0xe3
+ 1319 00f3 09       		.uleb128 0x9
+ 1320 00f4 03       		.byte	0x3
+ 1321 00f5 00000000 		.quad	discrete_data
+ 1321      00000000 
+ 1322 00fd 02       		.uleb128 0x2
+ 1323 00fe 00000000 		.long	.LASF19
+ 1324 0102 23       		.byte	0x23
+ 1325 0103 24       		.byte	0x24
+ 1326 0104 A1000000 		.long	0xa1
+ 1327 0108 09       		.uleb128 0x9
+ 1328 0109 03       		.byte	0x3
+ 1329 010a 00000000 		.quad	discrete
+ 1329      00000000 
+ 1330 0112 05       		.uleb128 0x5
+ 1331 0113 AB000000 		.long	0xab
+ 1332 0117 24       		.byte	0x24
+ 1333 0118 09       		.uleb128 0x9
+ 1334 0119 03       		.byte	0x3
+ 1335 011a 00000000 		.quad	heatmap_cs_RdYlBu_discrete
+ 1335      00000000 
+ 1336 0122 09       		.uleb128 0x9
+ 1337 0123 90000000 		.long	0x90
+ 1338 0127 33010000 		.long	0x133
+ 1339 012b 0E       		.uleb128 0xe
+ 1340 012c 31000000 		.long	0x31
+ 1341 0130 0310     		.value	0x1003
+ 1342 0132 00       		.byte	0
+ 1343 0133 03       		.uleb128 0x3
+ 1344 0134 22010000 		.long	0x122
+ 1345 0138 02       		.uleb128 0x2
+ 1346 0139 00000000 		.long	.LASF20
+ 1347 013d 26       		.byte	0x26
+ 1348 013e 1C       		.byte	0x1c
+ 1349 013f 33010000 		.long	0x133
+ 1350 0143 09       		.uleb128 0x9
+ 1351 0144 03       		.byte	0x3
+ 1352 0145 00000000 		.quad	soft_data
+ 1352      00000000 
+ 1353 014d 02       		.uleb128 0x2
+ 1354 014e 00000000 		.long	.LASF21
+ 1355 0152 29       		.byte	0x29
+GAS LISTING /tmp/ccuplHTA.s 			page 58
+
+
+ 1356 0153 24       		.byte	0x24
+ 1357 0154 A1000000 		.long	0xa1
+ 1358 0158 09       		.uleb128 0x9
+ 1359 0159 03       		.byte	0x3
+ 1360 015a 00000000 		.quad	soft
+ 1360      00000000 
+ 1361 0162 05       		.uleb128 0x5
+ 1362 0163 B5000000 		.long	0xb5
+ 1363 0167 2A       		.byte	0x2a
+ 1364 0168 09       		.uleb128 0x9
+ 1365 0169 03       		.byte	0x3
+ 1366 016a 00000000 		.quad	heatmap_cs_RdYlBu_soft
+ 1366      00000000 
+ 1367 0172 02       		.uleb128 0x2
+ 1368 0173 00000000 		.long	.LASF22
+ 1369 0177 2C       		.byte	0x2c
+ 1370 0178 1C       		.byte	0x1c
+ 1371 0179 33010000 		.long	0x133
+ 1372 017d 09       		.uleb128 0x9
+ 1373 017e 03       		.byte	0x3
+ 1374 017f 00000000 		.quad	mixed_data
+ 1374      00000000 
+ 1375 0187 02       		.uleb128 0x2
+ 1376 0188 00000000 		.long	.LASF23
+ 1377 018c 2F       		.byte	0x2f
+ 1378 018d 24       		.byte	0x24
+ 1379 018e A1000000 		.long	0xa1
+ 1380 0192 09       		.uleb128 0x9
+ 1381 0193 03       		.byte	0x3
+ 1382 0194 00000000 		.quad	mixed
+ 1382      00000000 
+ 1383 019c 05       		.uleb128 0x5
+ 1384 019d BF000000 		.long	0xbf
+ 1385 01a1 30       		.byte	0x30
+ 1386 01a2 09       		.uleb128 0x9
+ 1387 01a3 03       		.byte	0x3
+ 1388 01a4 00000000 		.quad	heatmap_cs_RdYlBu_mixed
+ 1388      00000000 
+ 1389 01ac 02       		.uleb128 0x2
+ 1390 01ad 00000000 		.long	.LASF24
+ 1391 01b1 32       		.byte	0x32
+ 1392 01b2 1C       		.byte	0x1c
+ 1393 01b3 33010000 		.long	0x133
+ 1394 01b7 09       		.uleb128 0x9
+ 1395 01b8 03       		.byte	0x3
+ 1396 01b9 00000000 		.quad	mixed_exp_data
+ 1396      00000000 
+ 1397 01c1 02       		.uleb128 0x2
+ 1398 01c2 00000000 		.long	.LASF25
+ 1399 01c6 35       		.byte	0x35
+ 1400 01c7 24       		.byte	0x24
+ 1401 01c8 A1000000 		.long	0xa1
+ 1402 01cc 09       		.uleb128 0x9
+ 1403 01cd 03       		.byte	0x3
+ 1404 01ce 00000000 		.quad	mixed_exp
+ 1404      00000000 
+ 1405 01d6 05       		.uleb128 0x5
+GAS LISTING /tmp/ccuplHTA.s 			page 59
+
+
+ 1406 01d7 C9000000 		.long	0xc9
+ 1407 01db 36       		.byte	0x36
+ 1408 01dc 09       		.uleb128 0x9
+ 1409 01dd 03       		.byte	0x3
+ 1410 01de 00000000 		.quad	heatmap_cs_RdYlBu_mixed_exp
+ 1410      00000000 
+ 1411 01e6 00       		.byte	0
+ 1412              		.section	.debug_abbrev,"",@progbits
+ 1413              	.Ldebug_abbrev0:
+ 1414 0000 01       		.uleb128 0x1
+ 1415 0001 24       		.uleb128 0x24
+ 1416 0002 00       		.byte	0
+ 1417 0003 0B       		.uleb128 0xb
+ 1418 0004 0B       		.uleb128 0xb
+ 1419 0005 3E       		.uleb128 0x3e
+ 1420 0006 0B       		.uleb128 0xb
+ 1421 0007 03       		.uleb128 0x3
+ 1422 0008 0E       		.uleb128 0xe
+ 1423 0009 00       		.byte	0
+ 1424 000a 00       		.byte	0
+ 1425 000b 02       		.uleb128 0x2
+ 1426 000c 34       		.uleb128 0x34
+ 1427 000d 00       		.byte	0
+ 1428 000e 03       		.uleb128 0x3
+ 1429 000f 0E       		.uleb128 0xe
+ 1430 0010 3A       		.uleb128 0x3a
+ 1431 0011 21       		.uleb128 0x21
+ 1432 0012 04       		.sleb128 4
+ 1433 0013 3B       		.uleb128 0x3b
+ 1434 0014 0B       		.uleb128 0xb
+ 1435 0015 39       		.uleb128 0x39
+ 1436 0016 0B       		.uleb128 0xb
+ 1437 0017 49       		.uleb128 0x49
+ 1438 0018 13       		.uleb128 0x13
+ 1439 0019 02       		.uleb128 0x2
+ 1440 001a 18       		.uleb128 0x18
+ 1441 001b 00       		.byte	0
+ 1442 001c 00       		.byte	0
+ 1443 001d 03       		.uleb128 0x3
+ 1444 001e 26       		.uleb128 0x26
+ 1445 001f 00       		.byte	0
+ 1446 0020 49       		.uleb128 0x49
+ 1447 0021 13       		.uleb128 0x13
+ 1448 0022 00       		.byte	0
+ 1449 0023 00       		.byte	0
+ 1450 0024 04       		.uleb128 0x4
+ 1451 0025 34       		.uleb128 0x34
+ 1452 0026 00       		.byte	0
+ 1453 0027 03       		.uleb128 0x3
+ 1454 0028 0E       		.uleb128 0xe
+ 1455 0029 3A       		.uleb128 0x3a
+ 1456 002a 21       		.uleb128 0x21
+ 1457 002b 03       		.sleb128 3
+ 1458 002c 3B       		.uleb128 0x3b
+ 1459 002d 0B       		.uleb128 0xb
+ 1460 002e 39       		.uleb128 0x39
+ 1461 002f 21       		.uleb128 0x21
+GAS LISTING /tmp/ccuplHTA.s 			page 60
+
+
+ 1462 0030 25       		.sleb128 37
+ 1463 0031 49       		.uleb128 0x49
+ 1464 0032 13       		.uleb128 0x13
+ 1465 0033 3F       		.uleb128 0x3f
+ 1466 0034 19       		.uleb128 0x19
+ 1467 0035 3C       		.uleb128 0x3c
+ 1468 0036 19       		.uleb128 0x19
+ 1469 0037 00       		.byte	0
+ 1470 0038 00       		.byte	0
+ 1471 0039 05       		.uleb128 0x5
+ 1472 003a 34       		.uleb128 0x34
+ 1473 003b 00       		.byte	0
+ 1474 003c 47       		.uleb128 0x47
+ 1475 003d 13       		.uleb128 0x13
+ 1476 003e 3A       		.uleb128 0x3a
+ 1477 003f 21       		.uleb128 0x21
+ 1478 0040 04       		.sleb128 4
+ 1479 0041 3B       		.uleb128 0x3b
+ 1480 0042 0B       		.uleb128 0xb
+ 1481 0043 39       		.uleb128 0x39
+ 1482 0044 21       		.uleb128 0x21
+ 1483 0045 1E       		.sleb128 30
+ 1484 0046 02       		.uleb128 0x2
+ 1485 0047 18       		.uleb128 0x18
+ 1486 0048 00       		.byte	0
+ 1487 0049 00       		.byte	0
+ 1488 004a 06       		.uleb128 0x6
+ 1489 004b 16       		.uleb128 0x16
+ 1490 004c 00       		.byte	0
+ 1491 004d 03       		.uleb128 0x3
+ 1492 004e 0E       		.uleb128 0xe
+ 1493 004f 3A       		.uleb128 0x3a
+ 1494 0050 0B       		.uleb128 0xb
+ 1495 0051 3B       		.uleb128 0x3b
+ 1496 0052 0B       		.uleb128 0xb
+ 1497 0053 39       		.uleb128 0x39
+ 1498 0054 0B       		.uleb128 0xb
+ 1499 0055 49       		.uleb128 0x49
+ 1500 0056 13       		.uleb128 0x13
+ 1501 0057 00       		.byte	0
+ 1502 0058 00       		.byte	0
+ 1503 0059 07       		.uleb128 0x7
+ 1504 005a 0D       		.uleb128 0xd
+ 1505 005b 00       		.byte	0
+ 1506 005c 03       		.uleb128 0x3
+ 1507 005d 0E       		.uleb128 0xe
+ 1508 005e 3A       		.uleb128 0x3a
+ 1509 005f 21       		.uleb128 0x21
+ 1510 0060 01       		.sleb128 1
+ 1511 0061 3B       		.uleb128 0x3b
+ 1512 0062 0B       		.uleb128 0xb
+ 1513 0063 39       		.uleb128 0x39
+ 1514 0064 0B       		.uleb128 0xb
+ 1515 0065 49       		.uleb128 0x49
+ 1516 0066 13       		.uleb128 0x13
+ 1517 0067 38       		.uleb128 0x38
+ 1518 0068 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccuplHTA.s 			page 61
+
+
+ 1519 0069 00       		.byte	0
+ 1520 006a 00       		.byte	0
+ 1521 006b 08       		.uleb128 0x8
+ 1522 006c 0F       		.uleb128 0xf
+ 1523 006d 00       		.byte	0
+ 1524 006e 0B       		.uleb128 0xb
+ 1525 006f 21       		.uleb128 0x21
+ 1526 0070 08       		.sleb128 8
+ 1527 0071 49       		.uleb128 0x49
+ 1528 0072 13       		.uleb128 0x13
+ 1529 0073 00       		.byte	0
+ 1530 0074 00       		.byte	0
+ 1531 0075 09       		.uleb128 0x9
+ 1532 0076 01       		.uleb128 0x1
+ 1533 0077 01       		.byte	0x1
+ 1534 0078 49       		.uleb128 0x49
+ 1535 0079 13       		.uleb128 0x13
+ 1536 007a 01       		.uleb128 0x1
+ 1537 007b 13       		.uleb128 0x13
+ 1538 007c 00       		.byte	0
+ 1539 007d 00       		.byte	0
+ 1540 007e 0A       		.uleb128 0xa
+ 1541 007f 11       		.uleb128 0x11
+ 1542 0080 01       		.byte	0x1
+ 1543 0081 25       		.uleb128 0x25
+ 1544 0082 0E       		.uleb128 0xe
+ 1545 0083 13       		.uleb128 0x13
+ 1546 0084 0B       		.uleb128 0xb
+ 1547 0085 03       		.uleb128 0x3
+ 1548 0086 1F       		.uleb128 0x1f
+ 1549 0087 1B       		.uleb128 0x1b
+ 1550 0088 1F       		.uleb128 0x1f
+ 1551 0089 10       		.uleb128 0x10
+ 1552 008a 17       		.uleb128 0x17
+ 1553 008b 00       		.byte	0
+ 1554 008c 00       		.byte	0
+ 1555 008d 0B       		.uleb128 0xb
+ 1556 008e 24       		.uleb128 0x24
+ 1557 008f 00       		.byte	0
+ 1558 0090 0B       		.uleb128 0xb
+ 1559 0091 0B       		.uleb128 0xb
+ 1560 0092 3E       		.uleb128 0x3e
+ 1561 0093 0B       		.uleb128 0xb
+ 1562 0094 03       		.uleb128 0x3
+ 1563 0095 08       		.uleb128 0x8
+ 1564 0096 00       		.byte	0
+ 1565 0097 00       		.byte	0
+ 1566 0098 0C       		.uleb128 0xc
+ 1567 0099 13       		.uleb128 0x13
+ 1568 009a 01       		.byte	0x1
+ 1569 009b 0B       		.uleb128 0xb
+ 1570 009c 0B       		.uleb128 0xb
+ 1571 009d 3A       		.uleb128 0x3a
+ 1572 009e 0B       		.uleb128 0xb
+ 1573 009f 3B       		.uleb128 0x3b
+ 1574 00a0 0B       		.uleb128 0xb
+ 1575 00a1 39       		.uleb128 0x39
+GAS LISTING /tmp/ccuplHTA.s 			page 62
+
+
+ 1576 00a2 0B       		.uleb128 0xb
+ 1577 00a3 01       		.uleb128 0x1
+ 1578 00a4 13       		.uleb128 0x13
+ 1579 00a5 00       		.byte	0
+ 1580 00a6 00       		.byte	0
+ 1581 00a7 0D       		.uleb128 0xd
+ 1582 00a8 21       		.uleb128 0x21
+ 1583 00a9 00       		.byte	0
+ 1584 00aa 49       		.uleb128 0x49
+ 1585 00ab 13       		.uleb128 0x13
+ 1586 00ac 2F       		.uleb128 0x2f
+ 1587 00ad 0B       		.uleb128 0xb
+ 1588 00ae 00       		.byte	0
+ 1589 00af 00       		.byte	0
+ 1590 00b0 0E       		.uleb128 0xe
+ 1591 00b1 21       		.uleb128 0x21
+ 1592 00b2 00       		.byte	0
+ 1593 00b3 49       		.uleb128 0x49
+ 1594 00b4 13       		.uleb128 0x13
+ 1595 00b5 2F       		.uleb128 0x2f
+ 1596 00b6 05       		.uleb128 0x5
+ 1597 00b7 00       		.byte	0
+ 1598 00b8 00       		.byte	0
+ 1599 00b9 00       		.byte	0
+ 1600              		.section	.debug_aranges,"",@progbits
+ 1601 0000 1C000000 		.long	0x1c
+ 1602 0004 0200     		.value	0x2
+ 1603 0006 00000000 		.long	.Ldebug_info0
+ 1604 000a 08       		.byte	0x8
+ 1605 000b 00       		.byte	0
+ 1606 000c 0000     		.value	0
+ 1607 000e 0000     		.value	0
+ 1608 0010 00000000 		.quad	0
+ 1608      00000000 
+ 1609 0018 00000000 		.quad	0
+ 1609      00000000 
+ 1610              		.section	.debug_line,"",@progbits
+ 1611              	.Ldebug_line0:
+ 1612 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1612      05000800 
+ 1612      49000000 
+ 1612      010101FB 
+ 1612      0E0D0001 
+ 1613              	.LASF20:
+ 1614 0000 736F6674 		.string	"soft_data"
+ 1614      5F646174 
+ 1614      6100
+ 1615              	.LASF12:
+ 1616 000a 73697A65 		.string	"size_t"
+ 1616      5F7400
+ 1617              	.LASF13:
+ 1618 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1618      6D61705F 
+ 1618      636F6C6F 
+ 1618      72736368 
+ 1618      656D655F 
+ 1619              	.LASF14:
+GAS LISTING /tmp/ccuplHTA.s 			page 63
+
+
+ 1620 0027 68656174 		.string	"heatmap_cs_RdYlBu_discrete"
+ 1620      6D61705F 
+ 1620      63735F52 
+ 1620      64596C42 
+ 1620      755F6469 
+ 1621              	.LASF26:
+ 1622 0042 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1622      43313720 
+ 1622      31322E32 
+ 1622      2E30202D 
+ 1622      6D74756E 
+ 1623              	.LASF6:
+ 1624 00a1 666C6F61 		.string	"float"
+ 1624      7400
+ 1625              	.LASF11:
+ 1626 00a7 756E7369 		.string	"unsigned char"
+ 1626      676E6564 
+ 1626      20636861 
+ 1626      7200
+ 1627              	.LASF3:
+ 1628 00b5 6C6F6E67 		.string	"long unsigned int"
+ 1628      20756E73 
+ 1628      69676E65 
+ 1628      6420696E 
+ 1628      7400
+ 1629              	.LASF8:
+ 1630 00c7 73686F72 		.string	"short unsigned int"
+ 1630      7420756E 
+ 1630      7369676E 
+ 1630      65642069 
+ 1630      6E7400
+ 1631              	.LASF25:
+ 1632 00da 6D697865 		.string	"mixed_exp"
+ 1632      645F6578 
+ 1632      7000
+ 1633              	.LASF23:
+ 1634 00e4 6D697865 		.string	"mixed"
+ 1634      6400
+ 1635              	.LASF17:
+ 1636 00ea 68656174 		.string	"heatmap_cs_RdYlBu_mixed_exp"
+ 1636      6D61705F 
+ 1636      63735F52 
+ 1636      64596C42 
+ 1636      755F6D69 
+ 1637              	.LASF15:
+ 1638 0106 68656174 		.string	"heatmap_cs_RdYlBu_soft"
+ 1638      6D61705F 
+ 1638      63735F52 
+ 1638      64596C42 
+ 1638      755F736F 
+ 1639              	.LASF7:
+ 1640 011d 756E7369 		.string	"unsigned int"
+ 1640      676E6564 
+ 1640      20696E74 
+ 1640      00
+ 1641              	.LASF19:
+ 1642 012a 64697363 		.string	"discrete"
+GAS LISTING /tmp/ccuplHTA.s 			page 64
+
+
+ 1642      72657465 
+ 1642      00
+ 1643              	.LASF16:
+ 1644 0133 68656174 		.string	"heatmap_cs_RdYlBu_mixed"
+ 1644      6D61705F 
+ 1644      63735F52 
+ 1644      64596C42 
+ 1644      755F6D69 
+ 1645              	.LASF10:
+ 1646 014b 6E636F6C 		.string	"ncolors"
+ 1646      6F727300 
+ 1647              	.LASF4:
+ 1648 0153 6C6F6E67 		.string	"long long int"
+ 1648      206C6F6E 
+ 1648      6720696E 
+ 1648      7400
+ 1649              	.LASF24:
+ 1650 0161 6D697865 		.string	"mixed_exp_data"
+ 1650      645F6578 
+ 1650      705F6461 
+ 1650      746100
+ 1651              	.LASF22:
+ 1652 0170 6D697865 		.string	"mixed_data"
+ 1652      645F6461 
+ 1652      746100
+ 1653              	.LASF2:
+ 1654 017b 6C6F6E67 		.string	"long int"
+ 1654      20696E74 
+ 1654      00
+ 1655              	.LASF5:
+ 1656 0184 6C6F6E67 		.string	"long double"
+ 1656      20646F75 
+ 1656      626C6500 
+ 1657              	.LASF18:
+ 1658 0190 64697363 		.string	"discrete_data"
+ 1658      72657465 
+ 1658      5F646174 
+ 1658      6100
+ 1659              	.LASF21:
+ 1660 019e 736F6674 		.string	"soft"
+ 1660      00
+ 1661              	.LASF9:
+ 1662 01a3 636F6C6F 		.string	"colors"
+ 1662      727300
+ 1663              		.section	.debug_line_str,"MS",@progbits,1
+ 1664              	.LASF1:
+ 1665 0000 2F726F6F 		.string	"/root/repo"
+ 1665      742F7265 
+ 1665      706F00
+ 1666              	.LASF0:
+ 1667 000b 636F6C6F 		.string	"colorschemes/RdYlBu.c"
+ 1667      72736368 
+ 1667      656D6573 
+ 1667      2F526459 
+ 1667      6C42752E 
+ 1668              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1669 0021 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+GAS LISTING /tmp/ccuplHTA.s 			page 65
+
+
+ 1669      742F7265 
+ 1669      706F0063 
+ 1669      6F6C6F72 
+ 1669      73636865 
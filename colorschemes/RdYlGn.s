@@ -0,0 +1,3813 @@
+GAS LISTING /tmp/ccTNyrIS.s 			page 1
+
+
+   1              		.file	"RdYlGn.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/RdYlGn.c"
+   5              		.globl	heatmap_cs_RdYlGn_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_RdYlGn_mixed_exp, @object
+   9              		.size	heatmap_cs_RdYlGn_mixed_exp, 8
+  10              	heatmap_cs_RdYlGn_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 00       		.string	""
+  29 0005 683600   		.string	"h6"
+  30 0008 016B3818 		.ascii	"\001k8\030\002o:1\004r<J\006v>c\bz@|\020\207G\225\022\212I\256"
+  30      026F3A31 
+  30      04723C4A 
+  30      06763E63 
+  30      087A407C 
+  31 0024 148E4BC7 		.ascii	"\024\216K\307\026\221L\340\030\225N\371\034\230P\377#\233Q\377"
+  31      16914CE0 
+  31      18954EF9 
+  31      1C9850FF 
+  31      239B51FF 
+  32 0038 2A9D52FF 		.ascii	"*\235R\3770\240T\3775\242U\377:\245V\377N\257[\377R\261]\377"
+  32      30A054FF 
+  32      35A255FF 
+  32      3AA556FF 
+  32      4EAF5BFF 
+  33 0050 57B45EFF 		.ascii	"W\264^\377[\266_\377_\271`\377c\273b\377g\275c\377k\277c\377"
+  33      5BB65FFF 
+  33      5FB960FF 
+  33      63BB62FF 
+  33      67BD63FF 
+  34 0068 70C163FF 		.ascii	"p\301c\377t\303d\377x\304d\377{\306d\377\177\310e\377\220\317"
+  34      74C364FF 
+  34      78C464FF 
+  34      7BC664FF 
+  34      7FC865FF 
+GAS LISTING /tmp/ccTNyrIS.s 			page 2
+
+
+  35 007e 67FF94D1 		.ascii	"g\377\224\321g\377\227\322h\377\233\324h\377\237\326i\377\242"
+  35      67FF97D2 
+  35      68FF9BD4 
+  35      68FF9FD6 
+  35      69FFA2
+  36 0091 D769FFA6 		.ascii	"\327i\377\246\331j\377\251\332k\377\254\333m\377\257\334o\377"
+  36      D96AFFA9 
+  36      DA6BFFAC 
+  36      DB6DFFAF 
+  36      DC6FFF
+  37 00a4 B2DE71FF 		.ascii	"\262\336q\377\265\337r\377\267\340t\377\272\341v\377\307\347"
+  37      B5DF72FF 
+  37      B7E074FF 
+  37      BAE176FF 
+  37      C7E7
+  38 00b6 7EFFCAE8 		.ascii	"~\377\312\350\200\377\314\351\202\377\317\352\203\377\321\353"
+  38      80FFCCE9 
+  38      82FFCFEA 
+  38      83FFD1EB 
+  39 00c6 85FFD4EC 		.ascii	"\205\377\324\354\207\377\326\355\211\377\331\356\212\377\332"
+  39      87FFD6ED 
+  39      89FFD9EE 
+  39      8AFFDA
+  40 00d5 EE8AFFDB 		.ascii	"\356\212\377\333\356\212\377\334\355\212\377\335\355\212\377"
+  40      EE8AFFDC 
+  40      ED8AFFDD 
+  40      ED8AFF
+  41 00e4 DEED89FF 		.ascii	"\336\355\211\377\337\354\211\377\340\354\211\377\341\354\211"
+  41      DFEC89FF 
+  41      E0EC89FF 
+  41      E1EC89
+  42 00f3 FFE2EB89 		.ascii	"\377\342\353\211\377\342\353\211\377\343\353\211\377\344\352"
+  42      FFE2EB89 
+  42      FFE3EB89 
+  42      FFE4EA
+  43 0102 89FFE5EA 		.ascii	"\211\377\345\352\211\377\346\352\210\377\347\351\210\377\350"
+  43      89FFE6EA 
+  43      88FFE7E9 
+  43      88FFE8
+  44 0111 E988FFE8 		.ascii	"\351\210\377\350\351\210\377\361\345\210\377\361\345\210\377"
+  44      E988FFF1 
+  44      E588FFF1 
+  44      E588FF
+  45 0120 F2E588FF 		.ascii	"\362\345\210\377\363\344\211\377\363\344\211\377\364\344\211"
+  45      F3E489FF 
+  45      F3E489FF 
+  45      F4E489
+  46 012f FFF5E489 		.ascii	"\377\365\344\211\377\366\343\211\377\366\343\211\377\367\343"
+  46      FFF6E389 
+  46      FFF6E389 
+  46      FFF7E3
+  47 013e 89FFF7E2 		.ascii	"\211\377\367\342\211\377\370\342\211\377\371\342\211\377\371"
+  47      89FFF8E2 
+  47      89FFF9E2 
+  47      89FFF9
+  48 014d E289FFFA 		.ascii	"\342\211\377\372\341\211\377\372\341\212\377\373\341\212\377"
+  48      E189FFFA 
+GAS LISTING /tmp/ccTNyrIS.s 			page 3
+
+
+  48      E18AFFFB 
+  48      E18AFF
+  49 015c FCE08AFF 		.ascii	"\374\340\212\377\374\340\212\377\375\340\212\377\375\340\212"
+  49      FCE08AFF 
+  49      FDE08AFF 
+  49      FDE08A
+  50 016b FFFDDF8A 		.ascii	"\377\375\337\212\377\375\335\210\377\375\334\206\377\375\332"
+  50      FFFDDD88 
+  50      FFFDDC86 
+  50      FFFDDA
+  51 017a 85FFFDD9 		.ascii	"\205\377\375\331\203\377\375\327\202\377\375\325\200\377\375"
+  51      83FFFDD7 
+  51      82FFFDD5 
+  51      80FFFD
+  52 0189 D47EFFFD 		.ascii	"\324~\377\375\322}\377\375\321|\377\375\317z\377\375\316y\377"
+  52      D27DFFFD 
+  52      D17CFFFD 
+  52      CF7AFFFD 
+  52      CE79FF
+  53 019c FDCC78FF 		.ascii	"\375\314x\377\375\301n\377\375\277m\377\375\276k\377\375\274"
+  53      FDC16EFF 
+  53      FDBF6DFF 
+  53      FDBE6BFF 
+  53      FDBC
+  54 01ae 6AFFFDBB 		.ascii	"j\377\375\273i\377\375\271h\377\375\270g\377\375\266f\377\375"
+  54      69FFFDB9 
+  54      68FFFDB8 
+  54      67FFFDB6 
+  54      66FFFD
+  55 01c1 B565FFFD 		.ascii	"\265e\377\375\263d\377\375\262c\377\375\261b\377\375\257a\377"
+  55      B364FFFD 
+  55      B263FFFD 
+  55      B162FFFD 
+  55      AF61FF
+  56 01d4 FDAE61FF 		.ascii	"\375\256a\377\374\254_\377\374\253^\377\374\251]\377\374\247"
+  56      FCAC5FFF 
+  56      FCAB5EFF 
+  56      FCA95DFF 
+  56      FCA7
+  57 01e6 5CFFFCA6 		.ascii	"\\\377\374\246[\377\373\244Z\377\373\243Y\377\373\241X\377\373"
+  57      5BFFFBA4 
+  57      5AFFFBA3 
+  57      59FFFBA1 
+  57      58FFFB
+  58 01f9 A057FFFB 		.ascii	"\240W\377\373\236V\377\372\235V\377\372\233U\377\372\232T\377"
+  58      9E56FFFA 
+  58      9D56FFFA 
+  58      9B55FFFA 
+  58      9A54FF
+  59 020c FA9853FF 		.ascii	"\372\230S\377\372\227R\377\372\225R\377\370\207K\377\367\206"
+  59      FA9752FF 
+  59      FA9552FF 
+  59      F8874BFF 
+  59      F786
+  60 021e 4AFFF784 		.ascii	"J\377\367\204J\377\367\203I\377\367\201I\377\367\200H\377\366"
+  60      4AFFF783 
+  60      49FFF781 
+GAS LISTING /tmp/ccTNyrIS.s 			page 4
+
+
+  60      49FFF780 
+  60      48FFF6
+  61 0231 7F48FFF6 		.ascii	"\177H\377\366}G\377\366|G\377\366zF\377\365yF\377\365xE\377\365"
+  61      7D47FFF6 
+  61      7C47FFF6 
+  61      7A46FFF5 
+  61      7946FFF5 
+  62 0249 7645FFF5 		.ascii	"vE\377\365uD\377\365tD\377\364rD\377\364qC\377\364oC\377\364"
+  62      7544FFF5 
+  62      7444FFF4 
+  62      7244FFF4 
+  62      7143FFF4 
+  63 0261 6E43FFF4 		.ascii	"nC\377\364mC\377\363lB\377\363kA\377\362jA\377\362i@\377\361"
+  63      6D43FFF3 
+  63      6C42FFF3 
+  63      6B41FFF2 
+  63      6A41FFF2 
+  64 0279 6840FFF1 		.ascii	"h@\377\361g?\377\360f?\377\360e>\377\357d>\377\357c=\377\356"
+  64      673FFFF0 
+  64      663FFFF0 
+  64      653EFFEF 
+  64      643EFFEF 
+  65 0291 623DFFEE 		.ascii	"b=\377\356a<\377\355a<\377\355`;\377\354_;\377\354^:\377\353"
+  65      613CFFED 
+  65      613CFFED 
+  65      603BFFEC 
+  65      5F3BFFEC 
+  66 02a9 5D3AFFEB 		.ascii	"]:\377\353\\9\377\353[9\377\352Z9\377\352Z8\377\351Y8\377\351"
+  66      5C39FFEB 
+  66      5B39FFEA 
+  66      5A39FFEA 
+  66      5A38FFE9 
+  67 02c1 5837FFE8 		.ascii	"X7\377\350W7\377\342J1\377\342I0\377\341H0\377\341H0\377\341"
+  67      5737FFE2 
+  67      4A31FFE2 
+  67      4930FFE1 
+  67      4830FFE1 
+  68 02d9 472FFFE0 		.ascii	"G/\377\340F/\377\340E/\377\337D.\377\337D.\377\337C.\377\336"
+  68      462FFFE0 
+  68      452FFFDF 
+  68      442EFFDF 
+  68      442EFFDF 
+  69 02f1 422DFFDE 		.ascii	"B-\377\336A-\377\336@-\377\335@,\377\335?,\377\335>,\377\334"
+  69      412DFFDE 
+  69      402DFFDD 
+  69      402CFFDD 
+  69      3F2CFFDD 
+  70 0309 3D2BFFDC 		.ascii	"=+\377\334<+\377\333<+\377\333;*\377\333:*\377\3329*\377\332"
+  70      3C2BFFDB 
+  70      3C2BFFDB 
+  70      3B2AFFDB 
+  70      3A2AFFDA 
+  71 0321 3829FFDA 		.ascii	"8)\377\3328)\377\3317)\377\3316)\377\3315(\377\3315(\377\330"
+  71      3829FFD9 
+  71      3729FFD9 
+  71      3629FFD9 
+  71      3528FFD9 
+GAS LISTING /tmp/ccTNyrIS.s 			page 5
+
+
+  72 0339 3428FFD8 		.ascii	"4(\377\3303(\377\3302'\377\3272'\377\3271'\377\3270'\377\326"
+  72      3328FFD8 
+  72      3227FFD7 
+  72      3227FFD7 
+  72      3127FFD7 
+  73 0351 2F27FFD6 		.ascii	"/'\377\326/'\377\325/'\377\325.'\377\324.'\377\324-'\377\324"
+  73      2F27FFD5 
+  73      2F27FFD5 
+  73      2E27FFD4 
+  73      2E27FFD4 
+  74 0369 2D27FFD3 		.ascii	"-'\377\323-'\377\323,'\377\322,'\377\322,'\377\321+'\377\321"
+  74      2D27FFD3 
+  74      2C27FFD2 
+  74      2C27FFD2 
+  74      2C27FFD1 
+  75 0381 2B27FFD1 		.ascii	"+'\377\321+'\377\320*'\377\320*'\377\317)'\377\317)'\377\316"
+  75      2B27FFD0 
+  75      2A27FFD0 
+  75      2A27FFCF 
+  75      2927FFCF 
+  76 0399 2927FFCE 		.ascii	")'\377\316('\377\316('\377\315('\377\315('\377\315''\377\314"
+  76      2827FFCE 
+  76      2827FFCD 
+  76      2827FFCD 
+  76      2827FFCD 
+  77 03b1 2727FFCC 		.ascii	"''\377\314''\377\313&'\377\313&'\377\313&'\377\312%'\377\312"
+  77      2727FFCB 
+  77      2627FFCB 
+  77      2627FFCB 
+  77      2627FFCA 
+  78 03c9 2527FFCA 		.ascii	"%'\377\312%'\377\311$'\377\311$'\377\311$'\377\310$'\377\310"
+  78      2527FFC9 
+  78      2427FFC9 
+  78      2427FFC9 
+  78      2427FFC8 
+  79 03e1 2327FFC8 		.ascii	"#'\377\310#'\377\307#'\377\307#'\377\307\"'\377\306\"'\377\306"
+  79      2327FFC7 
+  79      2327FFC7 
+  79      2327FFC7 
+  79      2227FFC6 
+  80 03f9 2227FFC6 		.ascii	"\"'\377\306!'\377\306!'\377\305!'\377\305!'\377\305 '\377\304"
+  80      2127FFC6 
+  80      2127FFC5 
+  80      2127FFC5 
+  80      2127FFC5 
+  81 0411 2027FFC4 		.ascii	" '\377\304 '\377\304 '\377\304\037'\377\303\037'\377\303\037"
+  81      2027FFC4 
+  81      2027FFC4 
+  81      1F27FFC3 
+  81      1F27FFC3 
+  82 0426 27FFC31F 		.ascii	"'\377\303\037'\377\270\025'\377\270\025'\377\270\024'\377\270"
+  82      27FFB815 
+  82      27FFB815 
+  82      27FFB814 
+  82      27FFB8
+  83 0439 1427FFB7 		.ascii	"\024'\377\267\024'\377\267\024'\377\267\024'\377\267\023'\377"
+  83      1427FFB7 
+GAS LISTING /tmp/ccTNyrIS.s 			page 6
+
+
+  83      1427FFB7 
+  83      1427FFB7 
+  83      1327FF
+  84 044c B61327FF 		.ascii	"\266\023'\377\266\023'\377\266\023'\377\266\022'\377\266\022"
+  84      B61327FF 
+  84      B61327FF 
+  84      B61227FF 
+  84      B612
+  85 045e 27FFB512 		.ascii	"'\377\265\022'\377\265\022'\377\265\022'\377\265\021'\377\264"
+  85      27FFB512 
+  85      27FFB512 
+  85      27FFB511 
+  85      27FFB4
+  86 0471 1127FFB4 		.ascii	"\021'\377\264\021'\377\264\021'\377\264\021'\377\264\020'\377"
+  86      1127FFB4 
+  86      1127FFB4 
+  86      1127FFB4 
+  86      1027FF
+  87 0484 B31027FF 		.ascii	"\263\020'\377\263\020'\377\263\020'\377\263\020&\377\263\017"
+  87      B31027FF 
+  87      B31027FF 
+  87      B31026FF 
+  87      B30F
+  88 0496 26FFB20F 		.ascii	"&\377\262\017&\377\262\017&\377\262\017&\377\262\017&\377\262"
+  88      26FFB20F 
+  88      26FFB20F 
+  88      26FFB20F 
+  88      26FFB2
+  89 04a9 0E26FFB2 		.ascii	"\016&\377\262\016&\377\261\016&\377\261\016&\377\261\016&\377"
+  89      0E26FFB1 
+  89      0E26FFB1 
+  89      0E26FFB1 
+  89      0E26FF
+  90 04bc B10E26FF 		.ascii	"\261\016&\377\261\r&\377\260\r&\377\260\r&\377\260\r&\377\260"
+  90      B10D26FF 
+  90      B00D26FF 
+  90      B00D26FF 
+  90      B00D26FF 
+  91 04d1 0D26FFB0 		.ascii	"\r&\377\260\r&\377\260\f&\377\260\f&\377\257\f&\377\257\f&\377"
+  91      0D26FFB0 
+  91      0C26FFB0 
+  91      0C26FFAF 
+  91      0C26FFAF 
+  92 04e8 AF0C26FF 		.ascii	"\257\f&\377\257\f&\377\257\013&\377\257\013&\377\256\013&\377"
+  92      AF0C26FF 
+  92      AF0B26FF 
+  92      AF0B26FF 
+  92      AE0B26FF 
+  93 04fc AE0B26FF 		.ascii	"\256\013&\377\256\013&\377\256\013&\377\256\013&\377\256\n&\377"
+  93      AE0B26FF 
+  93      AE0B26FF 
+  93      AE0B26FF 
+  93      AE0A26FF 
+  94 0510 AE0A26FF 		.ascii	"\256\n&\377\256\n&\377\255\n&\377\255\n&\377\255\n&\377\255\t"
+  94      AE0A26FF 
+  94      AD0A26FF 
+  94      AD0A26FF 
+GAS LISTING /tmp/ccTNyrIS.s 			page 7
+
+
+  94      AD0A26FF 
+  95 0526 26FFAD09 		.ascii	"&\377\255\t&\377\255\t&\377\255\t&\377\255\t&\377\254\t&\377"
+  95      26FFAD09 
+  95      26FFAD09 
+  95      26FFAD09 
+  95      26FFAC09 
+  96 053c AC0926FF 		.ascii	"\254\t&\377\254\b&\377\254\b&\377\254\b&\377\254\b&\377\254\b"
+  96      AC0826FF 
+  96      AC0826FF 
+  96      AC0826FF 
+  96      AC0826FF 
+  97 0552 26FFAC08 		.ascii	"&\377\254\b&\377\254\b&\377\253\b&\377\253\007&\377\253\007&"
+  97      26FFAC08 
+  97      26FFAB08 
+  97      26FFAB07 
+  97      26FFAB07 
+  98 0567 FFAB0726 		.ascii	"\377\253\007&\377\253\007&\377\253\007&\377\253\007&\377\253"
+  98      FFAB0726 
+  98      FFAB0726 
+  98      FFAB0726 
+  98      FFAB
+  99 0579 0726FFAB 		.ascii	"\007&\377\253\007&\377\253\006&\377\253\006&\377\252\006&\377"
+  99      0726FFAB 
+  99      0626FFAB 
+  99      0626FFAA 
+  99      0626FF
+ 100 058c AA0626FF 		.ascii	"\252\006&\377\252\006&\377\252\006&\377\252\006&\377\252\006"
+ 100      AA0626FF 
+ 100      AA0626FF 
+ 100      AA0626FF 
+ 100      AA06
+ 101 059e 26FFAA06 		.ascii	"&\377\252\006&\377\252\005&\377\252\005&\377\252\005&\377\252"
+ 101      26FFAA05 
+ 101      26FFAA05 
+ 101      26FFAA05 
+ 101      26FFAA
+ 102 05b1 0526FFAA 		.ascii	"\005&\377\252\005&\377\251\005&\377\251\005&\377\251\005&\377"
+ 102      0526FFA9 
+ 102      0526FFA9 
+ 102      0526FFA9 
+ 102      0526FF
+ 103 05c4 A90526FF 		.ascii	"\251\005&\377\251\005&\377\251\005&\377\251\004&\377\251\004"
+ 103      A90526FF 
+ 103      A90526FF 
+ 103      A90426FF 
+ 103      A904
+ 104 05d6 26FFA904 		.ascii	"&\377\251\004&\377\251\004&\377\251\004&\377\251\004&\377\251"
+ 104      26FFA904 
+ 104      26FFA904 
+ 104      26FFA904 
+ 104      26FFA9
+ 105 05e9 0426FFA9 		.ascii	"\004&\377\251\004&\377\250\004&\377\250\004&\377\250\004&\377"
+ 105      0426FFA8 
+ 105      0426FFA8 
+ 105      0426FFA8 
+ 105      0426FF
+ 106 05fc A80426FF 		.ascii	"\250\004&\377\250\004&\377\250\004&\377\250\003&\377\250\003"
+GAS LISTING /tmp/ccTNyrIS.s 			page 8
+
+
+ 106      A80426FF 
+ 106      A80426FF 
+ 106      A80326FF 
+ 106      A803
+ 107 060e 26FFA803 		.ascii	"&\377\250\003&\377\250\003&\377\250\003&\377\250\003&\377\250"
+ 107      26FFA803 
+ 107      26FFA803 
+ 107      26FFA803 
+ 107      26FFA8
+ 108 0621 0326FFA8 		.ascii	"\003&\377\250\003&\377\250\003&\377\250\003&\377\250\003&\377"
+ 108      0326FFA8 
+ 108      0326FFA8 
+ 108      0326FFA8 
+ 108      0326FF
+ 109 0634 A80326FF 		.ascii	"\250\003&\377\250\003&\377\247\003&\377\247\003&\377\247\003"
+ 109      A80326FF 
+ 109      A70326FF 
+ 109      A70326FF 
+ 109      A703
+ 110 0646 26FFA7   		.ascii	"&\377\247"
+ 111 0649 0326FFA7 		.string	"\003&\377\247\002&\377\247\002&\377\247\002&\377\247\002&\377\247\002&\377\247\002&\377\2
+ 111      0226FFA7 
+ 111      0226FFA7 
+ 111      0226FFA7 
+ 111      0226FFA7 
+ 112 074a 26FFA500 		.string	"&\377\245"
+ 113 074e 26FFA500 		.string	"&\377\245"
+ 114 0752 26FFA500 		.string	"&\377\245"
+ 115 0756 26FFA500 		.string	"&\377\245"
+ 116 075a 26FFA500 		.string	"&\377\245"
+ 117 075e 26FFA500 		.string	"&\377\245"
+ 118 0762 26FFA500 		.string	"&\377\245"
+ 119 0766 26FFA500 		.string	"&\377\245"
+ 120 076a 26FFA500 		.string	"&\377\245"
+ 121 076e 26FFA500 		.string	"&\377\245"
+ 122 0772 26FFA500 		.string	"&\377\245"
+ 123 0776 26FFA500 		.string	"&\377\245"
+ 124 077a 26FFA500 		.string	"&\377\245"
+ 125 077e 26FFA500 		.string	"&\377\245"
+ 126 0782 26FFA500 		.string	"&\377\245"
+ 127 0786 26FFA500 		.string	"&\377\245"
+ 128 078a 26FFA500 		.string	"&\377\245"
+ 129 078e 26FFA500 		.string	"&\377\245"
+ 130 0792 26FFA500 		.string	"&\377\245"
+ 131 0796 26FFA500 		.string	"&\377\245"
+ 132 079a 26FFA500 		.string	"&\377\245"
+ 133 079e 26FFA500 		.string	"&\377\245"
+ 134 07a2 26FFA500 		.string	"&\377\245"
+ 135 07a6 26FFA500 		.string	"&\377\245"
+ 136 07aa 26FFA500 		.string	"&\377\245"
+ 137 07ae 26FFA500 		.string	"&\377\245"
+ 138 07b2 26FFA500 		.string	"&\377\245"
+ 139 07b6 26FFA500 		.string	"&\377\245"
+ 140 07ba 26FFA500 		.string	"&\377\245"
+ 141 07be 26FFA500 		.string	"&\377\245"
+ 142 07c2 26FFA500 		.string	"&\377\245"
+ 143 07c6 26FFA500 		.string	"&\377\245"
+GAS LISTING /tmp/ccTNyrIS.s 			page 9
+
+
+ 144 07ca 26FFA500 		.string	"&\377\245"
+ 145 07ce 26FF     		.ascii	"&\377"
+ 146 07d0 A500     		.string	"\245"
+ 147 07d2 26FFA500 		.string	"&\377\245"
+ 148 07d6 26FFA500 		.string	"&\377\245"
+ 149 07da 26FFA500 		.string	"&\377\245"
+ 150 07de 26FFA500 		.string	"&\377\245"
+ 151 07e2 26FFA500 		.string	"&\377\245"
+ 152 07e6 26FFA500 		.string	"&\377\245"
+ 153 07ea 26FFA500 		.string	"&\377\245"
+ 154 07ee 26FFA500 		.string	"&\377\245"
+ 155 07f2 26FFA500 		.string	"&\377\245"
+ 156 07f6 26FFA500 		.string	"&\377\245"
+ 157 07fa 26FFA500 		.string	"&\377\245"
+ 158 07fe 26FFA500 		.string	"&\377\245"
+ 159 0802 26FFA500 		.string	"&\377\245"
+ 160 0806 26FFA500 		.string	"&\377\245"
+ 161 080a 26FFA500 		.string	"&\377\245"
+ 162 080e 26FFA500 		.string	"&\377\245"
+ 163 0812 26FFA500 		.string	"&\377\245"
+ 164 0816 26FFA500 		.string	"&\377\245"
+ 165 081a 26FFA500 		.string	"&\377\245"
+ 166 081e 26FFA500 		.string	"&\377\245"
+ 167 0822 26FFA500 		.string	"&\377\245"
+ 168 0826 26FFA500 		.string	"&\377\245"
+ 169 082a 26FFA500 		.string	"&\377\245"
+ 170 082e 26FFA500 		.string	"&\377\245"
+ 171 0832 26FFA500 		.string	"&\377\245"
+ 172 0836 26FFA500 		.string	"&\377\245"
+ 173 083a 26FFA500 		.string	"&\377\245"
+ 174 083e 26FFA500 		.string	"&\377\245"
+ 175 0842 26FFA500 		.string	"&\377\245"
+ 176 0846 26FFA500 		.string	"&\377\245"
+ 177 084a 26FFA500 		.string	"&\377\245"
+ 178 084e 26FFA500 		.string	"&\377\245"
+ 179 0852 26FFA500 		.string	"&\377\245"
+ 180 0856 26FFA500 		.string	"&\377\245"
+ 181 085a 26FFA500 		.string	"&\377\245"
+ 182 085e 26FFA500 		.string	"&\377\245"
+ 183 0862 26FFA500 		.string	"&\377\245"
+ 184 0866 26FFA500 		.string	"&\377\245"
+ 185 086a 26FFA500 		.string	"&\377\245"
+ 186 086e 26FFA500 		.string	"&\377\245"
+ 187 0872 26FFA500 		.string	"&\377\245"
+ 188 0876 26FFA500 		.string	"&\377\245"
+ 189 087a 26FFA500 		.string	"&\377\245"
+ 190 087e 26FFA500 		.string	"&\377\245"
+ 191 0882 26FFA500 		.string	"&\377\245"
+ 192 0886 26FFA500 		.string	"&\377\245"
+ 193 088a 26FFA500 		.string	"&\377\245"
+ 194 088e 26FFA500 		.string	"&\377\245"
+ 195 0892 26FFA500 		.string	"&\377\245"
+ 196 0896 26FFA500 		.string	"&\377\245"
+ 197 089a 26FFA500 		.string	"&\377\245"
+ 198 089e 26FFA500 		.string	"&\377\245"
+ 199 08a2 26FFA500 		.string	"&\377\245"
+ 200 08a6 26FFA500 		.string	"&\377\245"
+GAS LISTING /tmp/ccTNyrIS.s 			page 10
+
+
+ 201 08aa 26FFA500 		.string	"&\377\245"
+ 202 08ae 26FFA500 		.string	"&\377\245"
+ 203 08b2 26FFA500 		.string	"&\377\245"
+ 204 08b6 26FFA500 		.string	"&\377\245"
+ 205 08ba 26FFA500 		.string	"&\377\245"
+ 206 08be 26FFA500 		.string	"&\377\245"
+ 207 08c2 26FFA500 		.string	"&\377\245"
+ 208 08c6 26FFA500 		.string	"&\377\245"
+ 209 08ca 26FFA500 		.string	"&\377\245"
+ 210 08ce 26FFA500 		.string	"&\377\245"
+ 211 08d2 26FFA500 		.string	"&\377\245"
+ 212 08d6 26FFA500 		.string	"&\377\245"
+ 213 08da 26FFA500 		.string	"&\377\245"
+ 214 08de 26FFA500 		.string	"&\377\245"
+ 215 08e2 26FFA500 		.string	"&\377\245"
+ 216 08e6 26FFA500 		.string	"&\377\245"
+ 217 08ea 26FFA500 		.string	"&\377\245"
+ 218 08ee 26FFA500 		.string	"&\377\245"
+ 219 08f2 26FFA500 		.string	"&\377\245"
+ 220 08f6 26FFA500 		.string	"&\377\245"
+ 221 08fa 26FFA500 		.string	"&\377\245"
+ 222 08fe 26FFA500 		.string	"&\377\245"
+ 223 0902 26FFA500 		.string	"&\377\245"
+ 224 0906 26FFA500 		.string	"&\377\245"
+ 225 090a 26FFA500 		.string	"&\377\245"
+ 226 090e 26FFA500 		.string	"&\377\245"
+ 227 0912 26FFA500 		.string	"&\377\245"
+ 228 0916 26FFA500 		.string	"&\377\245"
+ 229 091a 26FFA500 		.string	"&\377\245"
+ 230 091e 26FFA500 		.string	"&\377\245"
+ 231 0922 26FFA500 		.string	"&\377\245"
+ 232 0926 26FFA500 		.string	"&\377\245"
+ 233 092a 26FFA500 		.string	"&\377\245"
+ 234 092e 26FFA500 		.string	"&\377\245"
+ 235 0932 26FFA500 		.string	"&\377\245"
+ 236 0936 26FFA500 		.string	"&\377\245"
+ 237 093a 26FFA500 		.string	"&\377\245"
+ 238 093e 26FFA500 		.string	"&\377\245"
+ 239 0942 26FFA500 		.string	"&\377\245"
+ 240 0946 26FFA500 		.string	"&\377\245"
+ 241 094a 26FFA500 		.string	"&\377\245"
+ 242 094e 26FFA500 		.string	"&\377\245"
+ 243 0952 26FFA500 		.string	"&\377\245"
+ 244 0956 26FFA500 		.string	"&\377\245"
+ 245 095a 26FFA500 		.string	"&\377\245"
+ 246 095e 26FFA500 		.string	"&\377\245"
+ 247 0962 26FFA500 		.string	"&\377\245"
+ 248 0966 26FFA500 		.string	"&\377\245"
+ 249 096a 26FFA500 		.string	"&\377\245"
+ 250 096e 26FFA500 		.string	"&\377\245"
+ 251 0972 26FFA500 		.string	"&\377\245"
+ 252 0976 26FFA500 		.string	"&\377\245"
+ 253 097a 26FFA500 		.string	"&\377\245"
+ 254 097e 26FFA500 		.string	"&\377\245"
+ 255 0982 26FFA500 		.string	"&\377\245"
+ 256 0986 26FFA500 		.string	"&\377\245"
+ 257 098a 26FFA500 		.string	"&\377\245"
+GAS LISTING /tmp/ccTNyrIS.s 			page 11
+
+
+ 258 098e 26FFA500 		.string	"&\377\245"
+ 259 0992 26FFA500 		.string	"&\377\245"
+ 260 0996 26FFA500 		.string	"&\377\245"
+ 261 099a 26FFA500 		.string	"&\377\245"
+ 262 099e 26FFA500 		.string	"&\377\245"
+ 263 09a2 26FFA500 		.string	"&\377\245"
+ 264 09a6 26FFA500 		.string	"&\377\245"
+ 265 09aa 26FFA500 		.string	"&\377\245"
+ 266 09ae 26FFA500 		.string	"&\377\245"
+ 267 09b2 26FFA500 		.string	"&\377\245"
+ 268 09b6 26FFA500 		.string	"&\377\245"
+ 269 09ba 26FFA500 		.string	"&\377\245"
+ 270 09be 26FFA500 		.string	"&\377\245"
+ 271 09c2 26FFA500 		.string	"&\377\245"
+ 272 09c6 26FFA500 		.string	"&\377\245"
+ 273 09ca 26FFA500 		.string	"&\377\245"
+ 274 09ce 26FFA500 		.string	"&\377\245"
+ 275 09d2 26FFA500 		.string	"&\377\245"
+ 276 09d6 26FFA500 		.string	"&\377\245"
+ 277 09da 26FFA500 		.string	"&\377\245"
+ 278 09de 26FFA500 		.string	"&\377\245"
+ 279 09e2 26FFA500 		.string	"&\377\245"
+ 280 09e6 26FFA500 		.string	"&\377\245"
+ 281 09ea 26FFA500 		.string	"&\377\245"
+ 282 09ee 26FFA500 		.string	"&\377\245"
+ 283 09f2 26FFA500 		.string	"&\377\245"
+ 284 09f6 26FFA500 		.string	"&\377\245"
+ 285 09fa 26FFA500 		.string	"&\377\245"
+ 286 09fe 26FFA500 		.string	"&\377\245"
+ 287 0a02 26FFA500 		.string	"&\377\245"
+ 288 0a06 26FFA500 		.string	"&\377\245"
+ 289 0a0a 26FFA500 		.string	"&\377\245"
+ 290 0a0e 26FFA500 		.string	"&\377\245"
+ 291 0a12 26FFA500 		.string	"&\377\245"
+ 292 0a16 26FFA500 		.string	"&\377\245"
+ 293 0a1a 26FFA500 		.string	"&\377\245"
+ 294 0a1e 26FFA500 		.string	"&\377\245"
+ 295 0a22 26FFA500 		.string	"&\377\245"
+ 296 0a26 26FFA500 		.string	"&\377\245"
+ 297 0a2a 26FFA500 		.string	"&\377\245"
+ 298 0a2e 26FFA500 		.string	"&\377\245"
+ 299 0a32 26FFA500 		.string	"&\377\245"
+ 300 0a36 26FFA500 		.string	"&\377\245"
+ 301 0a3a 26FFA500 		.string	"&\377\245"
+ 302 0a3e 26FFA500 		.string	"&\377\245"
+ 303 0a42 26FFA500 		.string	"&\377\245"
+ 304 0a46 26FFA500 		.string	"&\377\245"
+ 305 0a4a 26FFA500 		.string	"&\377\245"
+ 306 0a4e 26FFA500 		.string	"&\377\245"
+ 307 0a52 26FFA500 		.string	"&\377\245"
+ 308 0a56 26FFA500 		.string	"&\377\245"
+ 309 0a5a 26FFA500 		.string	"&\377\245"
+ 310 0a5e 26FFA500 		.string	"&\377\245"
+ 311 0a62 26FFA500 		.string	"&\377\245"
+ 312 0a66 26FFA500 		.string	"&\377\245"
+ 313 0a6a 26FFA500 		.string	"&\377\245"
+ 314 0a6e 26FFA500 		.string	"&\377\245"
+GAS LISTING /tmp/ccTNyrIS.s 			page 12
+
+
+ 315 0a72 26FFA500 		.string	"&\377\245"
+ 316 0a76 26FFA500 		.string	"&\377\245"
+ 317 0a7a 26FFA500 		.string	"&\377\245"
+ 318 0a7e 26FFA500 		.string	"&\377\245"
+ 319 0a82 26FFA500 		.string	"&\377\245"
+ 320 0a86 26FFA500 		.string	"&\377\245"
+ 321 0a8a 26FFA500 		.string	"&\377\245"
+ 322 0a8e 26FFA500 		.string	"&\377\245"
+ 323 0a92 26FFA500 		.string	"&\377\245"
+ 324 0a96 26FFA500 		.string	"&\377\245"
+ 325 0a9a 26FFA500 		.string	"&\377\245"
+ 326 0a9e 26FFA500 		.string	"&\377\245"
+ 327 0aa2 26FFA500 		.string	"&\377\245"
+ 328 0aa6 26FFA500 		.string	"&\377\245"
+ 329 0aaa 26FFA500 		.string	"&\377\245"
+ 330 0aae 26FFA500 		.string	"&\377\245"
+ 331 0ab2 26FFA500 		.string	"&\377\245"
+ 332 0ab6 26FFA500 		.string	"&\377\245"
+ 333 0aba 26FFA500 		.string	"&\377\245"
+ 334 0abe 26FFA500 		.string	"&\377\245"
+ 335 0ac2 26FFA500 		.string	"&\377\245"
+ 336 0ac6 26FFA500 		.string	"&\377\245"
+ 337 0aca 26FFA500 		.string	"&\377\245"
+ 338 0ace 26FFA500 		.string	"&\377\245"
+ 339 0ad2 26FFA500 		.string	"&\377\245"
+ 340 0ad6 26FFA500 		.string	"&\377\245"
+ 341 0ada 26FFA500 		.string	"&\377\245"
+ 342 0ade 26FFA500 		.string	"&\377\245"
+ 343 0ae2 26FFA500 		.string	"&\377\245"
+ 344 0ae6 26FFA500 		.string	"&\377\245"
+ 345 0aea 26FFA500 		.string	"&\377\245"
+ 346 0aee 26FFA500 		.string	"&\377\245"
+ 347 0af2 26FFA500 		.string	"&\377\245"
+ 348 0af6 26FFA500 		.string	"&\377\245"
+ 349 0afa 26FFA500 		.string	"&\377\245"
+ 350 0afe 26FFA500 		.string	"&\377\245"
+ 351 0b02 26FFA500 		.string	"&\377\245"
+ 352 0b06 26FFA500 		.string	"&\377\245"
+ 353 0b0a 26FFA500 		.string	"&\377\245"
+ 354 0b0e 26FFA500 		.string	"&\377\245"
+ 355 0b12 26FFA500 		.string	"&\377\245"
+ 356 0b16 26FFA500 		.string	"&\377\245"
+ 357 0b1a 26FFA500 		.string	"&\377\245"
+ 358 0b1e 26FFA500 		.string	"&\377\245"
+ 359 0b22 26FFA500 		.string	"&\377\245"
+ 360 0b26 26FFA500 		.string	"&\377\245"
+ 361 0b2a 26FFA500 		.string	"&\377\245"
+ 362 0b2e 26FFA500 		.string	"&\377\245"
+ 363 0b32 26FFA500 		.string	"&\377\245"
+ 364 0b36 26FFA500 		.string	"&\377\245"
+ 365 0b3a 26FFA500 		.string	"&\377\245"
+ 366 0b3e 26FFA500 		.string	"&\377\245"
+ 367 0b42 26FFA500 		.string	"&\377\245"
+ 368 0b46 26FFA500 		.string	"&\377\245"
+ 369 0b4a 26FFA500 		.string	"&\377\245"
+ 370 0b4e 26FFA500 		.string	"&\377\245"
+ 371 0b52 26FFA500 		.string	"&\377\245"
+GAS LISTING /tmp/ccTNyrIS.s 			page 13
+
+
+ 372 0b56 26FFA500 		.string	"&\377\245"
+ 373 0b5a 26FFA500 		.string	"&\377\245"
+ 374 0b5e 26FFA500 		.string	"&\377\245"
+ 375 0b62 26FFA500 		.string	"&\377\245"
+ 376 0b66 26FFA500 		.string	"&\377\245"
+ 377 0b6a 26FFA500 		.string	"&\377\245"
+ 378 0b6e 26FFA500 		.string	"&\377\245"
+ 379 0b72 26FFA500 		.string	"&\377\245"
+ 380 0b76 26FFA500 		.string	"&\377\245"
+ 381 0b7a 26FFA500 		.string	"&\377\245"
+ 382 0b7e 26FFA500 		.string	"&\377\245"
+ 383 0b82 26FFA500 		.string	"&\377\245"
+ 384 0b86 26FFA500 		.string	"&\377\245"
+ 385 0b8a 26FFA500 		.string	"&\377\245"
+ 386 0b8e 26FFA500 		.string	"&\377\245"
+ 387 0b92 26FFA500 		.string	"&\377\245"
+ 388 0b96 26FFA500 		.string	"&\377\245"
+ 389 0b9a 26FFA500 		.string	"&\377\245"
+ 390 0b9e 26FFA500 		.string	"&\377\245"
+ 391 0ba2 26FFA500 		.string	"&\377\245"
+ 392 0ba6 26FFA500 		.string	"&\377\245"
+ 393 0baa 26FFA500 		.string	"&\377\245"
+ 394 0bae 26FFA500 		.string	"&\377\245"
+ 395 0bb2 26FFA500 		.string	"&\377\245"
+ 396 0bb6 26FFA500 		.string	"&\377\245"
+ 397 0bba 26FFA500 		.string	"&\377\245"
+ 398 0bbe 26FFA500 		.string	"&\377\245"
+ 399 0bc2 26FFA500 		.string	"&\377\245"
+ 400 0bc6 26FFA500 		.string	"&\377\245"
+ 401 0bca 26FFA500 		.string	"&\377\245"
+ 402 0bce 26FFA500 		.string	"&\377\245"
+ 403 0bd2 26FFA500 		.string	"&\377\245"
+ 404 0bd6 26FFA500 		.string	"&\377\245"
+ 405 0bda 26FFA500 		.string	"&\377\245"
+ 406 0bde 26FFA500 		.string	"&\377\245"
+ 407 0be2 26FFA500 		.string	"&\377\245"
+ 408 0be6 26FFA500 		.string	"&\377\245"
+ 409 0bea 26FFA500 		.string	"&\377\245"
+ 410 0bee 26FFA500 		.string	"&\377\245"
+ 411 0bf2 26FFA500 		.string	"&\377\245"
+ 412 0bf6 26FFA500 		.string	"&\377\245"
+ 413 0bfa 26FFA500 		.string	"&\377\245"
+ 414 0bfe 26FFA500 		.string	"&\377\245"
+ 415 0c02 26FFA500 		.string	"&\377\245"
+ 416 0c06 26FFA500 		.string	"&\377\245"
+ 417 0c0a 26FFA500 		.string	"&\377\245"
+ 418 0c0e 26FFA500 		.string	"&\377\245"
+ 419 0c12 26FFA500 		.string	"&\377\245"
+ 420 0c16 26FFA500 		.string	"&\377\245"
+ 421 0c1a 26FFA500 		.string	"&\377\245"
+ 422 0c1e 26FFA500 		.string	"&\377\245"
+ 423 0c22 26FFA500 		.string	"&\377\245"
+ 424 0c26 26FFA500 		.string	"&\377\245"
+ 425 0c2a 26FFA500 		.string	"&\377\245"
+ 426 0c2e 26FFA500 		.string	"&\377\245"
+ 427 0c32 26FFA500 		.string	"&\377\245"
+ 428 0c36 26FFA500 		.string	"&\377\245"
+GAS LISTING /tmp/ccTNyrIS.s 			page 14
+
+
+ 429 0c3a 26FFA500 		.string	"&\377\245"
+ 430 0c3e 26FFA500 		.string	"&\377\245"
+ 431 0c42 26FFA500 		.string	"&\377\245"
+ 432 0c46 26FFA500 		.string	"&\377\245"
+ 433 0c4a 26FFA500 		.string	"&\377\245"
+ 434 0c4e 26FFA500 		.string	"&\377\245"
+ 435 0c52 26FFA500 		.string	"&\377\245"
+ 436 0c56 26FFA500 		.string	"&\377\245"
+ 437 0c5a 26FFA500 		.string	"&\377\245"
+ 438 0c5e 26FFA500 		.string	"&\377\245"
+ 439 0c62 26FFA500 		.string	"&\377\245"
+ 440 0c66 26FFA500 		.string	"&\377\245"
+ 441 0c6a 26FFA500 		.string	"&\377\245"
+ 442 0c6e 26FFA500 		.string	"&\377\245"
+ 443 0c72 26FFA500 		.string	"&\377\245"
+ 444 0c76 26FFA500 		.string	"&\377\245"
+ 445 0c7a 26FFA500 		.string	"&\377\245"
+ 446 0c7e 26FFA500 		.string	"&\377\245"
+ 447 0c82 26FFA500 		.string	"&\377\245"
+ 448 0c86 26FFA500 		.string	"&\377\245"
+ 449 0c8a 26FFA500 		.string	"&\377\245"
+ 450 0c8e 26FFA500 		.string	"&\377\245"
+ 451 0c92 26FFA500 		.string	"&\377\245"
+ 452 0c96 26FFA500 		.string	"&\377\245"
+ 453 0c9a 26FFA500 		.string	"&\377\245"
+ 454 0c9e 26FFA500 		.string	"&\377\245"
+ 455 0ca2 26FFA500 		.string	"&\377\245"
+ 456 0ca6 26FFA500 		.string	"&\377\245"
+ 457 0caa 26FFA500 		.string	"&\377\245"
+ 458 0cae 26FFA500 		.string	"&\377\245"
+ 459 0cb2 26FFA500 		.string	"&\377\245"
+ 460 0cb6 26FFA500 		.string	"&\377\245"
+ 461 0cba 26FFA500 		.string	"&\377\245"
+ 462 0cbe 25FFA500 		.string	"%\377\245"
+ 463 0cc2 25FFA500 		.string	"%\377\245"
+ 464 0cc6 25FFA500 		.string	"%\377\245"
+ 465 0cca 25FFA500 		.string	"%\377\245"
+ 466 0cce 25FFA500 		.string	"%\377\245"
+ 467 0cd2 25FFA500 		.string	"%\377\245"
+ 468 0cd6 25FFA500 		.string	"%\377\245"
+ 469 0cda 25FFA500 		.string	"%\377\245"
+ 470 0cde 25FFA500 		.string	"%\377\245"
+ 471 0ce2 25FFA500 		.string	"%\377\245"
+ 472 0ce6 25FFA500 		.string	"%\377\245"
+ 473 0cea 25FFA500 		.string	"%\377\245"
+ 474 0cee 25FFA500 		.string	"%\377\245"
+ 475 0cf2 25FFA500 		.string	"%\377\245"
+ 476 0cf6 25FFA500 		.string	"%\377\245"
+ 477 0cfa 25FFA500 		.string	"%\377\245"
+ 478 0cfe 25FFA500 		.string	"%\377\245"
+ 479 0d02 25FFA500 		.string	"%\377\245"
+ 480 0d06 25FFA500 		.string	"%\377\245"
+ 481 0d0a 25FFA500 		.string	"%\377\245"
+ 482 0d0e 25FFA500 		.string	"%\377\245"
+ 483 0d12 25FFA500 		.string	"%\377\245"
+ 484 0d16 25FFA500 		.string	"%\377\245"
+ 485 0d1a 25FFA500 		.string	"%\377\245"
+GAS LISTING /tmp/ccTNyrIS.s 			page 15
+
+
+ 486 0d1e 25FFA500 		.string	"%\377\245"
+ 487 0d22 25FFA500 		.string	"%\377\245"
+ 488 0d26 25FFA500 		.string	"%\377\245"
+ 489 0d2a 25FFA500 		.string	"%\377\245"
+ 490 0d2e 25FFA500 		.string	"%\377\245"
+ 491 0d32 25FFA500 		.string	"%\377\245"
+ 492 0d36 25FFA400 		.string	"%\377\244"
+ 493 0d3a 25FFA400 		.string	"%\377\244"
+ 494 0d3e 25FFA400 		.string	"%\377\244"
+ 495 0d42 25FFA400 		.string	"%\377\244"
+ 496 0d46 25FFA400 		.string	"%\377\244"
+ 497 0d4a 25FFA400 		.string	"%\377\244"
+ 498 0d4e 25FFA400 		.string	"%\377\244"
+ 499 0d52 25FFA400 		.string	"%\377\244"
+ 500 0d56 25FFA400 		.string	"%\377\244"
+ 501 0d5a 25FFA400 		.string	"%\377\244"
+ 502 0d5e 25FFA400 		.string	"%\377\244"
+ 503 0d62 25FFA400 		.string	"%\377\244"
+ 504 0d66 25FFA400 		.string	"%\377\244"
+ 505 0d6a 25FFA400 		.string	"%\377\244"
+ 506 0d6e 25FFA400 		.string	"%\377\244"
+ 507 0d72 25FFA400 		.string	"%\377\244"
+ 508 0d76 25FFA400 		.string	"%\377\244"
+ 509 0d7a 25FFA400 		.string	"%\377\244"
+ 510 0d7e 25FFA400 		.string	"%\377\244"
+ 511 0d82 25FFA400 		.string	"%\377\244"
+ 512 0d86 25FFA400 		.string	"%\377\244"
+ 513 0d8a 25FFA400 		.string	"%\377\244"
+ 514 0d8e 25FFA400 		.string	"%\377\244"
+ 515 0d92 25FFA400 		.string	"%\377\244"
+ 516 0d96 25FFA400 		.string	"%\377\244"
+ 517 0d9a 25FFA400 		.string	"%\377\244"
+ 518 0d9e 25FFA400 		.string	"%\377\244"
+ 519 0da2 25FFA400 		.string	"%\377\244"
+ 520 0da6 25FFA400 		.string	"%\377\244"
+ 521 0daa 25FFA400 		.string	"%\377\244"
+ 522 0dae 25FFA400 		.string	"%\377\244"
+ 523 0db2 25FFA400 		.string	"%\377\244"
+ 524 0db6 25FFA400 		.string	"%\377\244"
+ 525 0dba 25FFA400 		.string	"%\377\244"
+ 526 0dbe 25FFA400 		.string	"%\377\244"
+ 527 0dc2 25FFA400 		.string	"%\377\244"
+ 528 0dc6 25FFA400 		.string	"%\377\244"
+ 529 0dca 25FFA400 		.string	"%\377\244"
+ 530 0dce 25FFA400 		.string	"%\377\244"
+ 531 0dd2 25FFA400 		.string	"%\377\244"
+ 532 0dd6 25FFA400 		.string	"%\377\244"
+ 533 0dda 25FFA400 		.string	"%\377\244"
+ 534 0dde 25FFA400 		.string	"%\377\244"
+ 535 0de2 25FFA400 		.string	"%\377\244"
+ 536 0de6 25FFA400 		.string	"%\377\244"
+ 537 0dea 25FFA400 		.string	"%\377\244"
+ 538 0dee 25FFA400 		.string	"%\377\244"
+ 539 0df2 25FFA400 		.string	"%\377\244"
+ 540 0df6 25FFA400 		.string	"%\377\244"
+ 541 0dfa 25FFA400 		.string	"%\377\244"
+ 542 0dfe 25FFA400 		.string	"%\377\244"
+GAS LISTING /tmp/ccTNyrIS.s 			page 16
+
+
+ 543 0e02 25FFA400 		.string	"%\377\244"
+ 544 0e06 25FFA400 		.string	"%\377\244"
+ 545 0e0a 25FFA400 		.string	"%\377\244"
+ 546 0e0e 25FFA400 		.string	"%\377\244"
+ 547 0e12 25FFA400 		.string	"%\377\244"
+ 548 0e16 25FFA400 		.string	"%\377\244"
+ 549 0e1a 25FFA400 		.string	"%\377\244"
+ 550 0e1e 25FFA400 		.string	"%\377\244"
+ 551 0e22 25FFA400 		.string	"%\377\244"
+ 552 0e26 25FFA400 		.string	"%\377\244"
+ 553 0e2a 25FFA400 		.string	"%\377\244"
+ 554 0e2e 25FFA400 		.string	"%\377\244"
+ 555 0e32 25FFA400 		.string	"%\377\244"
+ 556 0e36 25FFA400 		.string	"%\377\244"
+ 557 0e3a 25FFA400 		.string	"%\377\244"
+ 558 0e3e 25FFA400 		.string	"%\377\244"
+ 559 0e42 25FFA400 		.string	"%\377\244"
+ 560 0e46 25FFA400 		.string	"%\377\244"
+ 561 0e4a 25FFA400 		.string	"%\377\244"
+ 562 0e4e 25FFA400 		.string	"%\377\244"
+ 563 0e52 25FFA400 		.string	"%\377\244"
+ 564 0e56 25FFA400 		.string	"%\377\244"
+ 565 0e5a 25FFA400 		.string	"%\377\244"
+ 566 0e5e 25FFA400 		.string	"%\377\244"
+ 567 0e62 25FFA400 		.string	"%\377\244"
+ 568 0e66 25FFA400 		.string	"%\377\244"
+ 569 0e6a 25FFA400 		.string	"%\377\244"
+ 570 0e6e 25FFA400 		.string	"%\377\244"
+ 571 0e72 25FFA400 		.string	"%\377\244"
+ 572 0e76 25FFA400 		.string	"%\377\244"
+ 573 0e7a 25FFA400 		.string	"%\377\244"
+ 574 0e7e 25FFA400 		.string	"%\377\244"
+ 575 0e82 25FFA400 		.string	"%\377\244"
+ 576 0e86 25FFA400 		.string	"%\377\244"
+ 577 0e8a 25FFA400 		.string	"%\377\244"
+ 578 0e8e 25FFA400 		.string	"%\377\244"
+ 579 0e92 25FFA400 		.string	"%\377\244"
+ 580 0e96 25FFA400 		.string	"%\377\244"
+ 581 0e9a 25FFA400 		.string	"%\377\244"
+ 582 0e9e 25FFA400 		.string	"%\377\244"
+ 583 0ea2 25FFA400 		.string	"%\377\244"
+ 584 0ea6 25FFA400 		.string	"%\377\244"
+ 585 0eaa 25FFA400 		.string	"%\377\244"
+ 586 0eae 25FFA400 		.string	"%\377\244"
+ 587 0eb2 25FFA400 		.string	"%\377\244"
+ 588 0eb6 25FFA400 		.string	"%\377\244"
+ 589 0eba 25FFA400 		.string	"%\377\244"
+ 590 0ebe 25FFA400 		.string	"%\377\244"
+ 591 0ec2 25FFA400 		.string	"%\377\244"
+ 592 0ec6 25FFA400 		.string	"%\377\244"
+ 593 0eca 25FFA400 		.string	"%\377\244"
+ 594 0ece 25FFA400 		.string	"%\377\244"
+ 595 0ed2 25FFA400 		.string	"%\377\244"
+ 596 0ed6 25FFA400 		.string	"%\377\244"
+ 597 0eda 25FFA400 		.string	"%\377\244"
+ 598 0ede 25FFA400 		.string	"%\377\244"
+ 599 0ee2 25FFA400 		.string	"%\377\244"
+GAS LISTING /tmp/ccTNyrIS.s 			page 17
+
+
+ 600 0ee6 25FFA400 		.string	"%\377\244"
+ 601 0eea 25FFA400 		.string	"%\377\244"
+ 602 0eee 25FFA400 		.string	"%\377\244"
+ 603 0ef2 25FFA400 		.string	"%\377\244"
+ 604 0ef6 25FFA400 		.string	"%\377\244"
+ 605 0efa 25FFA400 		.string	"%\377\244"
+ 606 0efe 25FFA400 		.string	"%\377\244"
+ 607 0f02 25FFA400 		.string	"%\377\244"
+ 608 0f06 25FFA400 		.string	"%\377\244"
+ 609 0f0a 25FFA400 		.string	"%\377\244"
+ 610 0f0e 25FFA400 		.string	"%\377\244"
+ 611 0f12 25FFA400 		.string	"%\377\244"
+ 612 0f16 25FFA400 		.string	"%\377\244"
+ 613 0f1a 25FFA400 		.string	"%\377\244"
+ 614 0f1e 25FFA400 		.string	"%\377\244"
+ 615 0f22 25FFA400 		.string	"%\377\244"
+ 616 0f26 25FFA400 		.string	"%\377\244"
+ 617 0f2a 25FFA400 		.string	"%\377\244"
+ 618 0f2e 25FFA400 		.string	"%\377\244"
+ 619 0f32 25FFA400 		.string	"%\377\244"
+ 620 0f36 25FFA400 		.string	"%\377\244"
+ 621 0f3a 25FFA400 		.string	"%\377\244"
+ 622 0f3e 25FFA400 		.string	"%\377\244"
+ 623 0f42 25FFA400 		.string	"%\377\244"
+ 624 0f46 25FFA400 		.string	"%\377\244"
+ 625 0f4a 25FFA400 		.string	"%\377\244"
+ 626 0f4e 25FFA400 		.string	"%\377\244"
+ 627 0f52 25FFA400 		.string	"%\377\244"
+ 628 0f56 25FFA400 		.string	"%\377\244"
+ 629 0f5a 25FFA400 		.string	"%\377\244"
+ 630 0f5e 25FFA400 		.string	"%\377\244"
+ 631 0f62 25FFA400 		.string	"%\377\244"
+ 632 0f66 25FFA400 		.string	"%\377\244"
+ 633 0f6a 25FFA400 		.string	"%\377\244"
+ 634 0f6e 25FFA400 		.string	"%\377\244"
+ 635 0f72 25FFA400 		.string	"%\377\244"
+ 636 0f76 25FFA400 		.string	"%\377\244"
+ 637 0f7a 25FFA400 		.string	"%\377\244"
+ 638 0f7e 25FFA400 		.string	"%\377\244"
+ 639 0f82 25FFA400 		.string	"%\377\244"
+ 640 0f86 25FFA400 		.string	"%\377\244"
+ 641 0f8a 25FFA400 		.string	"%\377\244"
+ 642 0f8e 25FFA400 		.string	"%\377\244"
+ 643 0f92 25FFA400 		.string	"%\377\244"
+ 644 0f96 25FFA400 		.string	"%\377\244"
+ 645 0f9a 25FFA400 		.string	"%\377\244"
+ 646 0f9e 25FF     		.ascii	"%\377"
+ 647 0fa0 A400     		.string	"\244"
+ 648 0fa2 25FFA400 		.string	"%\377\244"
+ 649 0fa6 25FFA400 		.string	"%\377\244"
+ 650 0faa 25FFA400 		.string	"%\377\244"
+ 651 0fae 25FFA400 		.string	"%\377\244"
+ 652 0fb2 25FFA400 		.string	"%\377\244"
+ 653 0fb6 25FFA400 		.string	"%\377\244"
+ 654 0fba 25FFA400 		.string	"%\377\244"
+ 655 0fbe 25FFA400 		.string	"%\377\244"
+ 656 0fc2 25FFA400 		.string	"%\377\244"
+GAS LISTING /tmp/ccTNyrIS.s 			page 18
+
+
+ 657 0fc6 25FFA400 		.string	"%\377\244"
+ 658 0fca 25FFA400 		.string	"%\377\244"
+ 659 0fce 25FFA400 		.string	"%\377\244"
+ 660 0fd2 25FFA400 		.string	"%\377\244"
+ 661 0fd6 25FFA400 		.string	"%\377\244"
+ 662 0fda 25FFA400 		.string	"%\377\244"
+ 663 0fde 25FFA400 		.string	"%\377\244"
+ 664 0fe2 25FFA400 		.string	"%\377\244"
+ 665 0fe6 25FFA400 		.string	"%\377\244"
+ 666 0fea 25FFA400 		.string	"%\377\244"
+ 667 0fee 25FFA400 		.string	"%\377\244"
+ 668 0ff2 25FFA400 		.string	"%\377\244"
+ 669 0ff6 25FFA400 		.string	"%\377\244"
+ 670 0ffa 25FFA400 		.string	"%\377\244"
+ 671 0ffe 25FFA400 		.string	"%\377\244"
+ 672 1002 25FF     		.ascii	"%\377"
+ 673              		.globl	heatmap_cs_RdYlGn_mixed
+ 674              		.section	.data.rel.local
+ 675              		.align 8
+ 676              		.type	heatmap_cs_RdYlGn_mixed, @object
+ 677              		.size	heatmap_cs_RdYlGn_mixed, 8
+ 678              	heatmap_cs_RdYlGn_mixed:
+ 679 0008 00000000 		.quad	mixed
+ 679      00000000 
+ 680              		.section	.data.rel.ro.local
+ 681              		.align 16
+ 682              		.type	mixed, @object
+ 683              		.size	mixed, 16
+ 684              	mixed:
+ 685 0010 00000000 		.quad	mixed_data
+ 685      00000000 
+ 686 0018 01040000 		.quad	1025
+ 686      00000000 
+ 687              		.section	.rodata
+ 688 1004 00000000 		.align 32
+ 688      00000000 
+ 688      00000000 
+ 688      00000000 
+ 688      00000000 
+ 689              		.type	mixed_data, @object
+ 690              		.size	mixed_data, 4100
+ 691              	mixed_data:
+ 692 1020 00       		.string	""
+ 693 1021 00       		.string	""
+ 694 1022 00       		.string	""
+ 695 1023 00       		.string	""
+ 696 1024 00       		.string	""
+ 697 1025 683600   		.string	"h6"
+ 698 1028 00       		.string	""
+ 699 1029 68370700 		.string	"h7\007"
+ 700 102d 68370E00 		.string	"h7\016"
+ 701 1031 69371600 		.string	"i7\026"
+ 702 1035 69371D00 		.string	"i7\035"
+ 703 1039 69372500 		.string	"i7%"
+ 704 103d 6A382C00 		.string	"j8,"
+ 705 1041 6A383401 		.ascii	"j84\001j8;\001k8C\001k8J\001l9R\001l9Y\001l9a\001m9h\002m9p\002"
+ 705      6A383B01 
+GAS LISTING /tmp/ccTNyrIS.s 			page 19
+
+
+ 705      6B384301 
+ 705      6B384A01 
+ 705      6C395201 
+ 706 1065 6D3A7702 		.ascii	"m:w\002n:\177\002n:\206\002n:\215\002o:\225\003o;\234\003p;\244"
+ 706      6E3A7F02 
+ 706      6E3A8602 
+ 706      6E3A8D02 
+ 706      6F3A9503 
+ 707 1080 03703BAB 		.ascii	"\003p;\253\003p;\263\003q;\272\003q<\302\004q<\311\004r<\321"
+ 707      03703BB3 
+ 707      03713BBA 
+ 707      03713CC2 
+ 707      04713CC9 
+ 708 1098 04723CD8 		.ascii	"\004r<\330\004r<\340\004s=\347\005s=\357\005t=\366\005t=\376"
+ 708      04723CE0 
+ 708      04733DE7 
+ 708      05733DEF 
+ 708      05743DF6 
+ 709 10b0 05743DFF 		.ascii	"\005t=\377\005u>\377\006u>\377\006u>\377\006v>\377\006v>\377"
+ 709      05753EFF 
+ 709      06753EFF 
+ 709      06753EFF 
+ 709      06763EFF 
+ 710 10c8 06773FFF 		.ascii	"\006w?\377\007w?\377\007w?\377\007x?\377\007x?\377\bx?\377\b"
+ 710      07773FFF 
+ 710      07773FFF 
+ 710      07783FFF 
+ 710      07783FFF 
+ 711 10e1 7940FF08 		.ascii	"y@\377\by@\377\bz@\377\tz@\377\tz@\377\016\204F\377\016\205F"
+ 711      7940FF08 
+ 711      7A40FF09 
+ 711      7A40FF09 
+ 711      7A40FF0E 
+ 712 10fb FF0F8546 		.ascii	"\377\017\205F\377\017\205F\377\017\206F\377\017\206G\377\020"
+ 712      FF0F8546 
+ 712      FF0F8646 
+ 712      FF0F8647 
+ 712      FF10
+ 713 110d 8747FF10 		.ascii	"\207G\377\020\207G\377\020\207G\377\020\210G\377\020\210H\377"
+ 713      8747FF10 
+ 713      8747FF10 
+ 713      8847FF10 
+ 713      8848FF
+ 714 1120 118848FF 		.ascii	"\021\210H\377\021\211H\377\021\211H\377\021\212H\377\022\212"
+ 714      118948FF 
+ 714      118948FF 
+ 714      118A48FF 
+ 714      128A
+ 715 1132 49FF128A 		.ascii	"I\377\022\212I\377\022\213I\377\022\213I\377\023\213I\377\023"
+ 715      49FF128B 
+ 715      49FF128B 
+ 715      49FF138B 
+ 715      49FF13
+ 716 1145 8C4AFF13 		.ascii	"\214J\377\023\214J\377\023\215J\377\023\215J\377\024\215J\377"
+ 716      8C4AFF13 
+ 716      8D4AFF13 
+ 716      8D4AFF14 
+GAS LISTING /tmp/ccTNyrIS.s 			page 20
+
+
+ 716      8D4AFF
+ 717 1158 148E4BFF 		.ascii	"\024\216K\377\024\216K\377\024\217K\377\025\217K\377\025\217"
+ 717      148E4BFF 
+ 717      148F4BFF 
+ 717      158F4BFF 
+ 717      158F
+ 718 116a 4BFF1590 		.ascii	"K\377\025\220L\377\025\220L\377\025\220L\377\026\221L\377\026"
+ 718      4CFF1590 
+ 718      4CFF1590 
+ 718      4CFF1691 
+ 718      4CFF16
+ 719 117d 914CFF16 		.ascii	"\221L\377\026\222M\377\026\222M\377\027\222M\377\027\223M\377"
+ 719      924DFF16 
+ 719      924DFF17 
+ 719      924DFF17 
+ 719      934DFF
+ 720 1190 17934DFF 		.ascii	"\027\223M\377\027\223M\377\027\224N\377\030\224N\377\030\225"
+ 720      17934DFF 
+ 720      17944EFF 
+ 720      18944EFF 
+ 720      1895
+ 721 11a2 4EFF1895 		.ascii	"N\377\030\225N\377\030\225N\377\031\226O\377\031\226O\377\031"
+ 721      4EFF1895 
+ 721      4EFF1996 
+ 721      4FFF1996 
+ 721      4FFF19
+ 722 11b5 974FFF19 		.ascii	"\227O\377\031\227O\377\031\227O\377\032\230P\377\033\230P\377"
+ 722      974FFF19 
+ 722      974FFF1A 
+ 722      9850FF1B 
+ 722      9850FF
+ 723 11c8 1C9850FF 		.ascii	"\034\230P\377\035\231P\377\036\231P\377\037\231P\377 \231P\377"
+ 723      1D9950FF 
+ 723      1E9950FF 
+ 723      1F9950FF 
+ 723      209950FF 
+ 724 11dc 209A51FF 		.ascii	" \232Q\377!\232Q\377\"\232Q\377#\233Q\377#\233Q\377$\233Q\377"
+ 724      219A51FF 
+ 724      229A51FF 
+ 724      239B51FF 
+ 724      239B51FF 
+ 725 11f4 259B51FF 		.ascii	"%\233Q\377&\234R\377&\234R\377'\234R\377(\235R\377)\235R\377"
+ 725      269C52FF 
+ 725      269C52FF 
+ 725      279C52FF 
+ 725      289D52FF 
+ 726 120c 299D52FF 		.ascii	")\235R\377*\235R\377+\236S\377+\236S\377,\236S\377-\237S\377"
+ 726      2A9D52FF 
+ 726      2B9E53FF 
+ 726      2B9E53FF 
+ 726      2C9E53FF 
+ 727 1224 2D9F53FF 		.ascii	"-\237S\377.\237S\377.\237S\377/\240T\3770\240T\3770\240T\377"
+ 727      2E9F53FF 
+ 727      2E9F53FF 
+ 727      2FA054FF 
+ 727      30A054FF 
+ 728 123c 31A154FF 		.ascii	"1\241T\3772\241T\3772\241T\3773\241T\3773\242U\3774\242U\377"
+GAS LISTING /tmp/ccTNyrIS.s 			page 21
+
+
+ 728      32A154FF 
+ 728      32A154FF 
+ 728      33A154FF 
+ 728      33A255FF 
+ 729 1254 35A255FF 		.ascii	"5\242U\3775\243U\3776\243U\3776\243U\3777\243U\3777\244V\377"
+ 729      35A355FF 
+ 729      36A355FF 
+ 729      36A355FF 
+ 729      37A355FF 
+ 730 126c 38A456FF 		.ascii	"8\244V\3779\244V\3779\245V\377:\245V\377:\245V\377;\246W\377"
+ 730      39A456FF 
+ 730      39A556FF 
+ 730      3AA556FF 
+ 730      3AA556FF 
+ 731 1284 3BA657FF 		.ascii	";\246W\377<\246W\377L\256[\377L\256[\377M\256[\377M\257[\377"
+ 731      3CA657FF 
+ 731      4CAE5BFF 
+ 731      4CAE5BFF 
+ 731      4DAE5BFF 
+ 732 129c 4EAF5BFF 		.ascii	"N\257[\377N\257\\\377O\260\\\377O\260\\\377P\260\\\377P\260\\"
+ 732      4EAF5CFF 
+ 732      4FB05CFF 
+ 732      4FB05CFF 
+ 732      50B05CFF 
+ 733 12b3 FF51B15C 		.ascii	"\377Q\261\\\377Q\261\\\377R\261]\377S\262]\377S\262]\377T\262"
+ 733      FF51B15C 
+ 733      FF52B15D 
+ 733      FF53B25D 
+ 733      FF53B25D 
+ 734 12ca 5DFF54B2 		.ascii	"]\377T\262]\377U\263]\377U\263]\377V\263^\377V\264^\377W\264"
+ 734      5DFF55B3 
+ 734      5DFF55B3 
+ 734      5DFF56B3 
+ 734      5EFF56B4 
+ 735 12e2 5EFF57B4 		.ascii	"^\377W\264^\377X\264^\377X\265^\377Y\265_\377Y\265_\377Z\266"
+ 735      5EFF58B4 
+ 735      5EFF58B5 
+ 735      5EFF59B5 
+ 735      5FFF59B5 
+ 736 12fa 5FFF5AB6 		.ascii	"_\377Z\266_\377[\266_\377[\266_\377\\\267_\377\\\267`\377]\267"
+ 736      5FFF5BB6 
+ 736      5FFF5BB6 
+ 736      5FFF5CB7 
+ 736      5FFF5CB7 
+ 737 1312 60FF5DB8 		.ascii	"`\377]\270`\377^\270`\377^\270`\377_\270`\377_\271a\377`\271"
+ 737      60FF5EB8 
+ 737      60FF5EB8 
+ 737      60FF5FB8 
+ 737      60FF5FB9 
+ 738 132a 61FF60B9 		.ascii	"a\377`\271a\377a\272a\377a\272a\377b\272a\377b\273a\377c\273"
+ 738      61FF61BA 
+ 738      61FF61BA 
+ 738      61FF62BA 
+ 738      61FF62BB 
+ 739 1342 62FF63BB 		.ascii	"b\377c\273b\377d\273b\377d\274b\377e\274b\377e\274b\377f\275"
+ 739      62FF64BB 
+ 739      62FF64BC 
+GAS LISTING /tmp/ccTNyrIS.s 			page 22
+
+
+ 739      62FF65BC 
+ 739      62FF65BC 
+ 740 135a 63FF66BD 		.ascii	"c\377f\275c\377g\275c\377g\275c\377h\275c\377h\276c\377i\276"
+ 740      63FF67BD 
+ 740      63FF67BD 
+ 740      63FF68BD 
+ 740      63FF68BE 
+ 741 1372 63FF69BE 		.ascii	"c\377i\276c\377j\276c\377j\277c\377k\277c\377k\277c\377l\277"
+ 741      63FF6ABE 
+ 741      63FF6ABF 
+ 741      63FF6BBF 
+ 741      63FF6BBF 
+ 742 138a 63FF6CBF 		.ascii	"c\377l\277c\377m\300c\377m\300c\377n\300c\377n\300c\377o\301"
+ 742      63FF6DC0 
+ 742      63FF6DC0 
+ 742      63FF6EC0 
+ 742      63FF6EC0 
+ 743 13a2 63FF6FC1 		.ascii	"c\377o\301c\377p\301c\377p\301c\377q\301c\377q\302c\377r\302"
+ 743      63FF70C1 
+ 743      63FF70C1 
+ 743      63FF71C1 
+ 743      63FF71C2 
+ 744 13ba 64FF72C2 		.ascii	"d\377r\302d\377s\302d\377s\303d\377t\303d\377t\303d\377u\303"
+ 744      64FF73C2 
+ 744      64FF73C3 
+ 744      64FF74C3 
+ 744      64FF74C3 
+ 745 13d2 64FF75C3 		.ascii	"d\377u\303d\377v\304d\377v\304d\377w\304d\377w\304d\377x\305"
+ 745      64FF76C4 
+ 745      64FF76C4 
+ 745      64FF77C4 
+ 745      64FF77C4 
+ 746 13ea 64FF78C5 		.ascii	"d\377x\305d\377y\305d\377y\305d\377z\305d\377z\306d\377{\306"
+ 746      64FF79C5 
+ 746      64FF79C5 
+ 746      64FF7AC5 
+ 746      64FF7AC6 
+ 747 1402 64FF7BC6 		.ascii	"d\377{\306d\377|\306d\377|\307e\377}\307e\377}\307e\377~\307"
+ 747      64FF7CC6 
+ 747      64FF7CC7 
+ 747      65FF7DC7 
+ 747      65FF7DC7 
+ 748 141a 65FF7EC7 		.ascii	"e\377~\307e\377\177\310e\377\214\315f\377\215\316f\377\215\316"
+ 748      65FF7FC8 
+ 748      65FF8CCD 
+ 748      66FF8DCE 
+ 748      66FF8DCE 
+ 749 142e 66FF8ECE 		.ascii	"f\377\216\316f\377\216\316f\377\217\317g\377\217\317g\377\220"
+ 749      66FF8ECE 
+ 749      66FF8FCF 
+ 749      67FF8FCF 
+ 749      67FF90
+ 750 1441 CF67FF90 		.ascii	"\317g\377\220\317g\377\221\317g\377\221\320g\377\222\320g\377"
+ 750      CF67FF91 
+ 750      CF67FF91 
+ 750      D067FF92 
+ 750      D067FF
+GAS LISTING /tmp/ccTNyrIS.s 			page 23
+
+
+ 751 1454 92D067FF 		.ascii	"\222\320g\377\223\320g\377\223\320g\377\224\321g\377\224\321"
+ 751      93D067FF 
+ 751      93D067FF 
+ 751      94D167FF 
+ 751      94D1
+ 752 1466 67FF95D1 		.ascii	"g\377\225\321g\377\225\321g\377\226\322g\377\226\322g\377\227"
+ 752      67FF95D1 
+ 752      67FF96D2 
+ 752      67FF96D2 
+ 752      67FF97
+ 753 1479 D267FF97 		.ascii	"\322g\377\227\322h\377\230\322h\377\230\323h\377\231\323h\377"
+ 753      D268FF98 
+ 753      D268FF98 
+ 753      D368FF99 
+ 753      D368FF
+ 754 148c 99D368FF 		.ascii	"\231\323h\377\232\323h\377\232\324h\377\233\324h\377\233\324"
+ 754      9AD368FF 
+ 754      9AD468FF 
+ 754      9BD468FF 
+ 754      9BD4
+ 755 149e 68FF9CD4 		.ascii	"h\377\234\324h\377\234\324h\377\235\325h\377\235\325h\377\236"
+ 755      68FF9CD4 
+ 755      68FF9DD5 
+ 755      68FF9DD5 
+ 755      68FF9E
+ 756 14b1 D568FF9E 		.ascii	"\325h\377\236\325h\377\237\325h\377\237\326i\377\237\326i\377"
+ 756      D568FF9F 
+ 756      D568FF9F 
+ 756      D669FF9F 
+ 756      D669FF
+ 757 14c4 A0D669FF 		.ascii	"\240\326i\377\240\326i\377\241\327i\377\241\327i\377\242\327"
+ 757      A0D669FF 
+ 757      A1D769FF 
+ 757      A1D769FF 
+ 757      A2D7
+ 758 14d6 69FFA2D7 		.ascii	"i\377\242\327i\377\243\327i\377\243\330i\377\244\330i\377\244"
+ 758      69FFA3D7 
+ 758      69FFA3D8 
+ 758      69FFA4D8 
+ 758      69FFA4
+ 759 14e9 D869FFA5 		.ascii	"\330i\377\245\330i\377\245\330i\377\246\331j\377\246\331j\377"
+ 759      D869FFA5 
+ 759      D869FFA6 
+ 759      D96AFFA6 
+ 759      D96AFF
+ 760 14fc A7D96AFF 		.ascii	"\247\331j\377\247\331j\377\250\331k\377\250\331k\377\250\332"
+ 760      A7D96AFF 
+ 760      A8D96BFF 
+ 760      A8D96BFF 
+ 760      A8DA
+ 761 150e 6BFFA9DA 		.ascii	"k\377\251\332k\377\251\332l\377\252\332l\377\252\332l\377\252"
+ 761      6BFFA9DA 
+ 761      6CFFAADA 
+ 761      6CFFAADA 
+ 761      6CFFAA
+ 762 1521 DB6CFFAB 		.ascii	"\333l\377\253\333m\377\253\333m\377\254\333m\377\254\333m\377"
+ 762      DB6DFFAB 
+GAS LISTING /tmp/ccTNyrIS.s 			page 24
+
+
+ 762      DB6DFFAC 
+ 762      DB6DFFAC 
+ 762      DB6DFF
+ 763 1534 ADDB6EFF 		.ascii	"\255\333n\377\255\334n\377\255\334n\377\256\334n\377\256\334"
+ 763      ADDC6EFF 
+ 763      ADDC6EFF 
+ 763      AEDC6EFF 
+ 763      AEDC
+ 764 1546 6EFFAFDC 		.ascii	"n\377\257\334o\377\257\334o\377\257\335o\377\260\335o\377\260"
+ 764      6FFFAFDC 
+ 764      6FFFAFDD 
+ 764      6FFFB0DD 
+ 764      6FFFB0
+ 765 1559 DD70FFB1 		.ascii	"\335p\377\261\335p\377\261\335p\377\261\335p\377\262\336q\377"
+ 765      DD70FFB1 
+ 765      DD70FFB1 
+ 765      DD70FFB2 
+ 765      DE71FF
+ 766 156c B2DE71FF 		.ascii	"\262\336q\377\263\336q\377\263\336q\377\264\336r\377\264\336"
+ 766      B3DE71FF 
+ 766      B3DE71FF 
+ 766      B4DE72FF 
+ 766      B4DE
+ 767 157e 72FFB4DF 		.ascii	"r\377\264\337r\377\265\337r\377\265\337s\377\266\337s\377\266"
+ 767      72FFB5DF 
+ 767      72FFB5DF 
+ 767      73FFB6DF 
+ 767      73FFB6
+ 768 1591 DF73FFB6 		.ascii	"\337s\377\266\337s\377\267\340t\377\267\340t\377\270\340t\377"
+ 768      DF73FFB7 
+ 768      E074FFB7 
+ 768      E074FFB8 
+ 768      E074FF
+ 769 15a4 B8E074FF 		.ascii	"\270\340t\377\270\340u\377\271\340u\377\271\341u\377\272\341"
+ 769      B8E075FF 
+ 769      B9E075FF 
+ 769      B9E175FF 
+ 769      BAE1
+ 770 15b6 76FFBAE1 		.ascii	"v\377\272\341v\377\272\341v\377\305\346}\377\305\346}\377\306"
+ 770      76FFBAE1 
+ 770      76FFC5E6 
+ 770      7DFFC5E6 
+ 770      7DFFC6
+ 771 15c9 E67DFFC6 		.ascii	"\346}\377\306\346~\377\307\346~\377\307\347~\377\307\347~\377"
+ 771      E67EFFC7 
+ 771      E67EFFC7 
+ 771      E77EFFC7 
+ 771      E77EFF
+ 772 15dc C8E77FFF 		.ascii	"\310\347\177\377\310\347\177\377\311\347\177\377\311\347\177"
+ 772      C8E77FFF 
+ 772      C9E77FFF 
+ 772      C9E77F
+ 773 15eb FFC9E880 		.ascii	"\377\311\350\200\377\312\350\200\377\312\350\200\377\312\350"
+ 773      FFCAE880 
+ 773      FFCAE880 
+ 773      FFCAE8
+ 774 15fa 81FFCBE8 		.ascii	"\201\377\313\350\201\377\313\351\201\377\314\351\201\377\314"
+GAS LISTING /tmp/ccTNyrIS.s 			page 25
+
+
+ 774      81FFCBE9 
+ 774      81FFCCE9 
+ 774      81FFCC
+ 775 1609 E982FFCC 		.ascii	"\351\202\377\314\351\202\377\315\351\202\377\315\351\202\377"
+ 775      E982FFCD 
+ 775      E982FFCD 
+ 775      E982FF
+ 776 1618 CEEA83FF 		.ascii	"\316\352\203\377\316\352\203\377\316\352\203\377\317\352\203"
+ 776      CEEA83FF 
+ 776      CEEA83FF 
+ 776      CFEA83
+ 777 1627 FFCFEA84 		.ascii	"\377\317\352\204\377\320\352\204\377\320\353\204\377\320\353"
+ 777      FFD0EA84 
+ 777      FFD0EB84 
+ 777      FFD0EB
+ 778 1636 85FFD1EB 		.ascii	"\205\377\321\353\205\377\321\353\205\377\321\353\205\377\322"
+ 778      85FFD1EB 
+ 778      85FFD1EB 
+ 778      85FFD2
+ 779 1645 EB86FFD2 		.ascii	"\353\206\377\322\354\206\377\323\354\206\377\323\354\206\377"
+ 779      EC86FFD3 
+ 779      EC86FFD3 
+ 779      EC86FF
+ 780 1654 D3EC87FF 		.ascii	"\323\354\207\377\324\354\207\377\324\354\207\377\324\355\210"
+ 780      D4EC87FF 
+ 780      D4EC87FF 
+ 780      D4ED88
+ 781 1663 FFD5ED88 		.ascii	"\377\325\355\210\377\325\355\210\377\326\355\210\377\326\355"
+ 781      FFD5ED88 
+ 781      FFD6ED88 
+ 781      FFD6ED
+ 782 1672 89FFD6EE 		.ascii	"\211\377\326\356\211\377\327\356\211\377\327\356\211\377\330"
+ 782      89FFD7EE 
+ 782      89FFD7EE 
+ 782      89FFD8
+ 783 1681 EE8AFFD8 		.ascii	"\356\212\377\330\356\212\377\330\356\212\377\331\356\212\377"
+ 783      EE8AFFD8 
+ 783      EE8AFFD9 
+ 783      EE8AFF
+ 784 1690 D9EE8AFF 		.ascii	"\331\356\212\377\331\356\212\377\331\356\212\377\331\356\212"
+ 784      D9EE8AFF 
+ 784      D9EE8AFF 
+ 784      D9EE8A
+ 785 169f FFD9EE8A 		.ascii	"\377\331\356\212\377\332\356\212\377\332\356\212\377\332\356"
+ 785      FFDAEE8A 
+ 785      FFDAEE8A 
+ 785      FFDAEE
+ 786 16ae 8AFFDAEE 		.ascii	"\212\377\332\356\212\377\332\356\212\377\332\356\212\377\333"
+ 786      8AFFDAEE 
+ 786      8AFFDAEE 
+ 786      8AFFDB
+ 787 16bd EE8AFFDB 		.ascii	"\356\212\377\333\356\212\377\333\356\212\377\333\356\212\377"
+ 787      EE8AFFDB 
+ 787      EE8AFFDB 
+ 787      EE8AFF
+ 788 16cc DBEE8AFF 		.ascii	"\333\356\212\377\333\355\212\377\334\355\212\377\334\355\212"
+ 788      DBED8AFF 
+GAS LISTING /tmp/ccTNyrIS.s 			page 26
+
+
+ 788      DCED8AFF 
+ 788      DCED8A
+ 789 16db FFDCED8A 		.ascii	"\377\334\355\212\377\334\355\212\377\334\355\212\377\334\355"
+ 789      FFDCED8A 
+ 789      FFDCED8A 
+ 789      FFDCED
+ 790 16ea 8AFFDDED 		.ascii	"\212\377\335\355\212\377\335\355\212\377\335\355\212\377\335"
+ 790      8AFFDDED 
+ 790      8AFFDDED 
+ 790      8AFFDD
+ 791 16f9 ED8AFFDD 		.ascii	"\355\212\377\335\355\211\377\335\355\211\377\336\355\211\377"
+ 791      ED89FFDD 
+ 791      ED89FFDE 
+ 791      ED89FF
+ 792 1708 DEED89FF 		.ascii	"\336\355\211\377\336\355\211\377\336\355\211\377\336\355\211"
+ 792      DEED89FF 
+ 792      DEED89FF 
+ 792      DEED89
+ 793 1717 FFDEEC89 		.ascii	"\377\336\354\211\377\337\354\211\377\337\354\211\377\337\354"
+ 793      FFDFEC89 
+ 793      FFDFEC89 
+ 793      FFDFEC
+ 794 1726 89FFDFEC 		.ascii	"\211\377\337\354\211\377\337\354\211\377\337\354\211\377\340"
+ 794      89FFDFEC 
+ 794      89FFDFEC 
+ 794      89FFE0
+ 795 1735 EC89FFE0 		.ascii	"\354\211\377\340\354\211\377\340\354\211\377\340\354\211\377"
+ 795      EC89FFE0 
+ 795      EC89FFE0 
+ 795      EC89FF
+ 796 1744 E0EC89FF 		.ascii	"\340\354\211\377\340\354\211\377\341\354\211\377\341\354\211"
+ 796      E0EC89FF 
+ 796      E1EC89FF 
+ 796      E1EC89
+ 797 1753 FFE1EC89 		.ascii	"\377\341\354\211\377\341\354\211\377\341\353\211\377\341\353"
+ 797      FFE1EC89 
+ 797      FFE1EB89 
+ 797      FFE1EB
+ 798 1762 89FFE2EB 		.ascii	"\211\377\342\353\211\377\342\353\211\377\342\353\211\377\342"
+ 798      89FFE2EB 
+ 798      89FFE2EB 
+ 798      89FFE2
+ 799 1771 EB89FFE2 		.ascii	"\353\211\377\342\353\211\377\342\353\211\377\342\353\211\377"
+ 799      EB89FFE2 
+ 799      EB89FFE2 
+ 799      EB89FF
+ 800 1780 E3EB89FF 		.ascii	"\343\353\211\377\343\353\211\377\343\353\211\377\343\353\211"
+ 800      E3EB89FF 
+ 800      E3EB89FF 
+ 800      E3EB89
+ 801 178f FFE3EB89 		.ascii	"\377\343\353\211\377\343\353\211\377\344\353\211\377\344\353"
+ 801      FFE3EB89 
+ 801      FFE4EB89 
+ 801      FFE4EB
+ 802 179e 89FFE4EA 		.ascii	"\211\377\344\352\211\377\344\352\211\377\344\352\211\377\344"
+ 802      89FFE4EA 
+ 802      89FFE4EA 
+GAS LISTING /tmp/ccTNyrIS.s 			page 27
+
+
+ 802      89FFE4
+ 803 17ad EA89FFE4 		.ascii	"\352\211\377\344\352\211\377\345\352\211\377\345\352\211\377"
+ 803      EA89FFE5 
+ 803      EA89FFE5 
+ 803      EA89FF
+ 804 17bc E5EA89FF 		.ascii	"\345\352\211\377\345\352\211\377\345\352\211\377\345\352\211"
+ 804      E5EA89FF 
+ 804      E5EA89FF 
+ 804      E5EA89
+ 805 17cb FFE6EA89 		.ascii	"\377\346\352\211\377\346\352\210\377\346\352\210\377\346\352"
+ 805      FFE6EA88 
+ 805      FFE6EA88 
+ 805      FFE6EA
+ 806 17da 88FFE6EA 		.ascii	"\210\377\346\352\210\377\346\352\210\377\346\351\210\377\347"
+ 806      88FFE6EA 
+ 806      88FFE6E9 
+ 806      88FFE7
+ 807 17e9 E988FFE7 		.ascii	"\351\210\377\347\351\210\377"
+ 807      E988FF
+ 808 17f0 E7E988FF 		.ascii	"\347\351\210\377\347\351\210\377\347\351\210\377\347\351\210"
+ 808      E7E988FF 
+ 808      E7E988FF 
+ 808      E7E988
+ 809 17ff FFE7E988 		.ascii	"\377\347\351\210\377\350\351\210\377\350\351\210\377\350\351"
+ 809      FFE8E988 
+ 809      FFE8E988 
+ 809      FFE8E9
+ 810 180e 88FFE8E9 		.ascii	"\210\377\350\351\210\377\350\351\210\377\350\351\210\377\351"
+ 810      88FFE8E9 
+ 810      88FFE8E9 
+ 810      88FFE9
+ 811 181d E988FFE9 		.ascii	"\351\210\377\351\351\210\377\360\346\210\377\360\345\210\377"
+ 811      E988FFF0 
+ 811      E688FFF0 
+ 811      E588FF
+ 812 182c F0E588FF 		.ascii	"\360\345\210\377\361\345\210\377\361\345\210\377\361\345\210"
+ 812      F1E588FF 
+ 812      F1E588FF 
+ 812      F1E588
+ 813 183b FFF1E588 		.ascii	"\377\361\345\210\377\361\345\210\377\361\345\210\377\361\345"
+ 813      FFF1E588 
+ 813      FFF1E588 
+ 813      FFF1E5
+ 814 184a 88FFF2E5 		.ascii	"\210\377\362\345\210\377\362\345\210\377\362\345\210\377\362"
+ 814      88FFF2E5 
+ 814      88FFF2E5 
+ 814      88FFF2
+ 815 1859 E588FFF2 		.ascii	"\345\210\377\362\345\210\377\362\345\210\377\362\345\210\377"
+ 815      E588FFF2 
+ 815      E588FFF2 
+ 815      E588FF
+ 816 1868 F3E488FF 		.ascii	"\363\344\210\377\363\344\211\377\363\344\211\377\363\344\211"
+ 816      F3E489FF 
+ 816      F3E489FF 
+ 816      F3E489
+ 817 1877 FFF3E489 		.ascii	"\377\363\344\211\377\363\344\211\377\363\344\211\377\364\344"
+ 817      FFF3E489 
+GAS LISTING /tmp/ccTNyrIS.s 			page 28
+
+
+ 817      FFF3E489 
+ 817      FFF4E4
+ 818 1886 89FFF4E4 		.ascii	"\211\377\364\344\211\377\364\344\211\377\364\344\211\377\364"
+ 818      89FFF4E4 
+ 818      89FFF4E4 
+ 818      89FFF4
+ 819 1895 E489FFF4 		.ascii	"\344\211\377\364\344\211\377\364\344\211\377\365\344\211\377"
+ 819      E489FFF4 
+ 819      E489FFF5 
+ 819      E489FF
+ 820 18a4 F5E489FF 		.ascii	"\365\344\211\377\365\344\211\377\365\343\211\377\365\343\211"
+ 820      F5E489FF 
+ 820      F5E389FF 
+ 820      F5E389
+ 821 18b3 FFF5E389 		.ascii	"\377\365\343\211\377\365\343\211\377\365\343\211\377\366\343"
+ 821      FFF5E389 
+ 821      FFF5E389 
+ 821      FFF6E3
+ 822 18c2 89FFF6E3 		.ascii	"\211\377\366\343\211\377\366\343\211\377\366\343\211\377\366"
+ 822      89FFF6E3 
+ 822      89FFF6E3 
+ 822      89FFF6
+ 823 18d1 E389FFF6 		.ascii	"\343\211\377\366\343\211\377\366\343\211\377\367\343\211\377"
+ 823      E389FFF6 
+ 823      E389FFF7 
+ 823      E389FF
+ 824 18e0 F7E389FF 		.ascii	"\367\343\211\377\367\343\211\377\367\343\211\377\367\343\211"
+ 824      F7E389FF 
+ 824      F7E389FF 
+ 824      F7E389
+ 825 18ef FFF7E289 		.ascii	"\377\367\342\211\377\367\342\211\377\367\342\211\377\370\342"
+ 825      FFF7E289 
+ 825      FFF7E289 
+ 825      FFF8E2
+ 826 18fe 89FFF8E2 		.ascii	"\211\377\370\342\211\377\370\342\211\377\370\342\211\377\370"
+ 826      89FFF8E2 
+ 826      89FFF8E2 
+ 826      89FFF8
+ 827 190d E289FFF8 		.ascii	"\342\211\377\370\342\211\377\370\342\211\377\370\342\211\377"
+ 827      E289FFF8 
+ 827      E289FFF8 
+ 827      E289FF
+ 828 191c F9E289FF 		.ascii	"\371\342\211\377\371\342\211\377\371\342\211\377\371\342\211"
+ 828      F9E289FF 
+ 828      F9E289FF 
+ 828      F9E289
+ 829 192b FFF9E289 		.ascii	"\377\371\342\211\377\371\342\211\377\371\341\211\377\371\341"
+ 829      FFF9E289 
+ 829      FFF9E189 
+ 829      FFF9E1
+ 830 193a 89FFFAE1 		.ascii	"\211\377\372\341\211\377\372\341\211\377\372\341\211\377\372"
+ 830      89FFFAE1 
+ 830      89FFFAE1 
+ 830      89FFFA
+ 831 1949 E18AFFFA 		.ascii	"\341\212\377\372\341\212\377\372\341\212\377\372\341\212\377"
+ 831      E18AFFFA 
+ 831      E18AFFFA 
+GAS LISTING /tmp/ccTNyrIS.s 			page 29
+
+
+ 831      E18AFF
+ 832 1958 FAE18AFF 		.ascii	"\372\341\212\377\373\341\212\377\373\341\212\377\373\341\212"
+ 832      FBE18AFF 
+ 832      FBE18AFF 
+ 832      FBE18A
+ 833 1967 FFFBE18A 		.ascii	"\377\373\341\212\377\373\341\212\377\373\341\212\377\373\341"
+ 833      FFFBE18A 
+ 833      FFFBE18A 
+ 833      FFFBE1
+ 834 1976 8AFFFBE1 		.ascii	"\212\377\373\341\212\377\374\340\212\377\374\340\212\377\374"
+ 834      8AFFFCE0 
+ 834      8AFFFCE0 
+ 834      8AFFFC
+ 835 1985 E08AFFFC 		.ascii	"\340\212\377\374\340\212\377\374\340\212\377\374\340\212\377"
+ 835      E08AFFFC 
+ 835      E08AFFFC 
+ 835      E08AFF
+ 836 1994 FCE08AFF 		.ascii	"\374\340\212\377\374\340\212\377\375\340\212\377\375\340\212"
+ 836      FCE08AFF 
+ 836      FDE08AFF 
+ 836      FDE08A
+ 837 19a3 FFFDE08A 		.ascii	"\377\375\340\212\377\375\340\212\377\375\340\212\377\375\340"
+ 837      FFFDE08A 
+ 837      FFFDE08A 
+ 837      FFFDE0
+ 838 19b2 8AFFFDE0 		.ascii	"\212\377\375\340\212\377\375\340\212\377\375\340\212\377\375"
+ 838      8AFFFDE0 
+ 838      8AFFFDE0 
+ 838      8AFFFD
+ 839 19c1 DF8AFFFD 		.ascii	"\337\212\377\375\337\212\377\375\337\211\377\375\336\211\377"
+ 839      DF8AFFFD 
+ 839      DF89FFFD 
+ 839      DE89FF
+ 840 19d0 FDDE89FF 		.ascii	"\375\336\211\377\375\335\210\377\375\335\210\377\375\335\207"
+ 840      FDDD88FF 
+ 840      FDDD88FF 
+ 840      FDDD87
+ 841 19df FFFDDC87 		.ascii	"\377\375\334\207\377\375\334\207\377\375\334\206\377\375\333"
+ 841      FFFDDC87 
+ 841      FFFDDC86 
+ 841      FFFDDB
+ 842 19ee 86FFFDDB 		.ascii	"\206\377\375\333\205\377\375\332\205\377\375\332\205\377\375"
+ 842      85FFFDDA 
+ 842      85FFFDDA 
+ 842      85FFFD
+ 843 19fd DA84FFFD 		.ascii	"\332\204\377\375\331\204\377\375\331\204\377\375\331\203\377"
+ 843      D984FFFD 
+ 843      D984FFFD 
+ 843      D983FF
+ 844 1a0c FDD883FF 		.ascii	"\375\330\203\377\375\330\202\377\375\327\202\377\375\327\202"
+ 844      FDD882FF 
+ 844      FDD782FF 
+ 844      FDD782
+ 845 1a1b FFFDD781 		.ascii	"\377\375\327\201\377\375\326\201\377\375\326\200\377\375\325"
+ 845      FFFDD681 
+ 845      FFFDD680 
+ 845      FFFDD5
+GAS LISTING /tmp/ccTNyrIS.s 			page 30
+
+
+ 846 1a2a 80FFFDD5 		.ascii	"\200\377\375\325\200\377\375\325\177\377\375\324\177\377\375"
+ 846      80FFFDD5 
+ 846      7FFFFDD4 
+ 846      7FFFFD
+ 847 1a39 D47FFFFD 		.ascii	"\324\177\377\375\324~\377\375\323~\377\375\323~\377\375\322}"
+ 847      D47EFFFD 
+ 847      D37EFFFD 
+ 847      D37EFFFD 
+ 847      D27D
+ 848 1a4b FFFDD27D 		.ascii	"\377\375\322}\377\375\322|\377\375\321|\377\375\321|\377\375"
+ 848      FFFDD27C 
+ 848      FFFDD17C 
+ 848      FFFDD17C 
+ 848      FFFD
+ 849 1a5d D07BFFFD 		.ascii	"\320{\377\375\320{\377\375\320{\377\375\317z\377\375\317z\377"
+ 849      D07BFFFD 
+ 849      D07BFFFD 
+ 849      CF7AFFFD 
+ 849      CF7AFF
+ 850 1a70 FDCF7AFF 		.ascii	"\375\317z\377\375\316y\377\375\316y\377\375\315y\377\375\315"
+ 850      FDCE79FF 
+ 850      FDCE79FF 
+ 850      FDCD79FF 
+ 850      FDCD
+ 851 1a82 78FFFDCD 		.ascii	"x\377\375\315x\377\375\314x\377\375\302o\377\375\301o\377\375"
+ 851      78FFFDCC 
+ 851      78FFFDC2 
+ 851      6FFFFDC1 
+ 851      6FFFFD
+ 852 1a95 C16EFFFD 		.ascii	"\301n\377\375\301n\377\375\300n\377\375\300m\377\375\277m\377"
+ 852      C16EFFFD 
+ 852      C06EFFFD 
+ 852      C06DFFFD 
+ 852      BF6DFF
+ 853 1aa8 FDBF6DFF 		.ascii	"\375\277m\377\375\277l\377\375\276l\377\375\276l\377\375\276"
+ 853      FDBF6CFF 
+ 853      FDBE6CFF 
+ 853      FDBE6CFF 
+ 853      FDBE
+ 854 1aba 6BFFFDBD 		.ascii	"k\377\375\275k\377\375\275k\377\375\274j\377\375\274j\377\375"
+ 854      6BFFFDBD 
+ 854      6BFFFDBC 
+ 854      6AFFFDBC 
+ 854      6AFFFD
+ 855 1acd BC6AFFFD 		.ascii	"\274j\377\375\273j\377\375\273i\377\375\272i\377\375\272i\377"
+ 855      BB6AFFFD 
+ 855      BB69FFFD 
+ 855      BA69FFFD 
+ 855      BA69FF
+ 856 1ae0 FDBA68FF 		.ascii	"\375\272h\377\375\271h\377\375\271h\377\375\270h\377\375\270"
+ 856      FDB968FF 
+ 856      FDB968FF 
+ 856      FDB868FF 
+ 856      FDB8
+ 857 1af2 67FFFDB8 		.ascii	"g\377\375\270g\377\375\267g\377\375\267f\377\375\266f\377\375"
+ 857      67FFFDB7 
+ 857      67FFFDB7 
+GAS LISTING /tmp/ccTNyrIS.s 			page 31
+
+
+ 857      66FFFDB6 
+ 857      66FFFD
+ 858 1b05 B666FFFD 		.ascii	"\266f\377\375\266f\377\375\265e\377\375\265e\377\375\264e\377"
+ 858      B666FFFD 
+ 858      B565FFFD 
+ 858      B565FFFD 
+ 858      B465FF
+ 859 1b18 FDB464FF 		.ascii	"\375\264d\377\375\264d\377\375\263d\377\375\263d\377\375\262"
+ 859      FDB464FF 
+ 859      FDB364FF 
+ 859      FDB364FF 
+ 859      FDB2
+ 860 1b2a 63FFFDB2 		.ascii	"c\377\375\262c\377\375\262c\377\375\261c\377\375\261b\377\375"
+ 860      63FFFDB2 
+ 860      63FFFDB1 
+ 860      63FFFDB1 
+ 860      62FFFD
+ 861 1b3d B062FFFD 		.ascii	"\260b\377\375\260b\377\375\257b\377\375\257a\377\375\257a\377"
+ 861      B062FFFD 
+ 861      AF62FFFD 
+ 861      AF61FFFD 
+ 861      AF61FF
+ 862 1b50 FDAE61FF 		.ascii	"\375\256a\377\375\256a\377\374\255`\377\374\255`\377\374\254"
+ 862      FDAE61FF 
+ 862      FCAD60FF 
+ 862      FCAD60FF 
+ 862      FCAC
+ 863 1b62 60FFFCAC 		.ascii	"`\377\374\254_\377\374\254_\377\374\253_\377\374\253^\377\374"
+ 863      5FFFFCAC 
+ 863      5FFFFCAB 
+ 863      5FFFFCAB 
+ 863      5EFFFC
+ 864 1b75 AA5EFFFC 		.ascii	"\252^\377\374\252^\377\374\251]\377\374\251]\377\374\250]\377"
+ 864      AA5EFFFC 
+ 864      A95DFFFC 
+ 864      A95DFFFC 
+ 864      A85DFF
+ 865 1b88 FCA85CFF 		.ascii	"\374\250\\\377\374\247\\\377\374\247\\\377\374\246[\377\374\246"
+ 865      FCA75CFF 
+ 865      FCA75CFF 
+ 865      FCA65BFF 
+ 865      FCA6
+ 866 1b9a 5BFFFCA5 		.ascii	"[\377\374\245[\377\373\245Z\377\373\244Z\377\373\244Z\377\373"
+ 866      5BFFFBA5 
+ 866      5AFFFBA4 
+ 866      5AFFFBA4 
+ 866      5AFFFB
+ 867 1bad A359FFFB 		.ascii	"\243Y\377\373\243Y\377\373\242Y\377\373\242Y\377\373\242X\377"
+ 867      A359FFFB 
+ 867      A259FFFB 
+ 867      A259FFFB 
+ 867      A258FF
+ 868 1bc0 FBA158FF 		.ascii	"\373\241X\377\373\241X\377\373\240W\377\373\240W\377\373\237"
+ 868      FBA158FF 
+ 868      FBA057FF 
+ 868      FBA057FF 
+ 868      FB9F
+GAS LISTING /tmp/ccTNyrIS.s 			page 32
+
+
+ 869 1bd2 57FFFB9F 		.ascii	"W\377\373\237W\377\373\236V\377\373\236V\377\373\235V\377\372"
+ 869      57FFFB9E 
+ 869      56FFFB9E 
+ 869      56FFFB9D 
+ 869      56FFFA
+ 870 1be5 9D55FFFA 		.ascii	"\235U\377\372\234U\377\372\234U\377\372\233U\377\372\233T\377"
+ 870      9C55FFFA 
+ 870      9C55FFFA 
+ 870      9B55FFFA 
+ 870      9B54FF
+ 871 1bf8 FA9A54FF 		.ascii	"\372\232T\377\372\232T\377\372\231T\377\372\231S\377\372\230"
+ 871      FA9A54FF 
+ 871      FA9954FF 
+ 871      FA9953FF 
+ 871      FA98
+ 872 1c0a 53FFFA98 		.ascii	"S\377\372\230S\377\372\227S\377\372\227R\377\372\226R\377\372"
+ 872      53FFFA97 
+ 872      53FFFA97 
+ 872      52FFFA96 
+ 872      52FFFA
+ 873 1c1d 9652FFF9 		.ascii	"\226R\377\371\225R\377\370\210K\377\370\207K\377\367\207K\377"
+ 873      9552FFF8 
+ 873      884BFFF8 
+ 873      874BFFF7 
+ 873      874BFF
+ 874 1c30 F7864BFF 		.ascii	"\367\206K\377\367\206J\377\367\205J\377\367\205J\377\367\204"
+ 874      F7864AFF 
+ 874      F7854AFF 
+ 874      F7854AFF 
+ 874      F784
+ 875 1c42 4AFFF784 		.ascii	"J\377\367\204J\377\367\203I\377\367\203I\377\367\202I\377\367"
+ 875      4AFFF783 
+ 875      49FFF783 
+ 875      49FFF782 
+ 875      49FFF7
+ 876 1c55 8249FFF7 		.ascii	"\202I\377\367\201H\377\367\201H\377\367\200H\377\366\200H\377"
+ 876      8148FFF7 
+ 876      8148FFF7 
+ 876      8048FFF6 
+ 876      8048FF
+ 877 1c68 F67F48FF 		.ascii	"\366\177H\377\366~G\377\366~G\377\366}G\377\366}G\377\366|G\377"
+ 877      F67E47FF 
+ 877      F67E47FF 
+ 877      F67D47FF 
+ 877      F67D47FF 
+ 878 1c80 F67C47FF 		.ascii	"\366|G\377\366{F\377\366{F\377\366zF\377\366zF\377\366yF\377"
+ 878      F67B46FF 
+ 878      F67B46FF 
+ 878      F67A46FF 
+ 878      F67A46FF 
+ 879 1c98 F57946FF 		.ascii	"\365yF\377\365xE\377\365xE\377\365wE\377\365wE\377\365vE\377"
+ 879      F57845FF 
+ 879      F57845FF 
+ 879      F57745FF 
+ 879      F57745FF 
+ 880 1cb0 F57545FF 		.ascii	"\365uE\377\365uD\377\365tD\377\365tD\377\365sD\377\365sD\377"
+ 880      F57544FF 
+GAS LISTING /tmp/ccTNyrIS.s 			page 33
+
+
+ 880      F57444FF 
+ 880      F57444FF 
+ 880      F57344FF 
+ 881 1cc8 F47244FF 		.ascii	"\364rD\377\364rD\377\364qC\377\364qC\377\364pC\377\364oC\377"
+ 881      F47244FF 
+ 881      F47143FF 
+ 881      F47143FF 
+ 881      F47043FF 
+ 882 1ce0 F46F43FF 		.ascii	"\364oC\377\364nC\377\364nC\377\364mC\377\364mC\377\363lB\377"
+ 882      F46E43FF 
+ 882      F46E43FF 
+ 882      F46D43FF 
+ 882      F46D43FF 
+ 883 1cf8 F36C42FF 		.ascii	"\363lB\377\363kB\377\363kB\377\362kA\377\362jA\377\362jA\377"
+ 883      F36B42FF 
+ 883      F36B42FF 
+ 883      F26B41FF 
+ 883      F26A41FF 
+ 884 1d10 F26941FF 		.ascii	"\362iA\377\362i@\377\361h@\377\361h@\377\361h@\377\361g?\377"
+ 884      F26940FF 
+ 884      F16840FF 
+ 884      F16840FF 
+ 884      F16840FF 
+ 885 1d28 F0673FFF 		.ascii	"\360g?\377\360f?\377\360f?\377\360e>\377\360e>\377\357e>\377"
+ 885      F0663FFF 
+ 885      F0663FFF 
+ 885      F0653EFF 
+ 885      F0653EFF 
+ 886 1d40 EF643EFF 		.ascii	"\357d>\377\357d=\377\357c=\377\356c=\377\356b=\377\356b<\377"
+ 886      EF643DFF 
+ 886      EF633DFF 
+ 886      EE633DFF 
+ 886      EE623DFF 
+ 887 1d58 EE623CFF 		.ascii	"\356b<\377\356a<\377\355a<\377\355`<\377\355`;\377\355_;\377"
+ 887      EE613CFF 
+ 887      ED613CFF 
+ 887      ED603CFF 
+ 887      ED603BFF 
+ 888 1d70 EC5F3BFF 		.ascii	"\354_;\377\354_;\377\354^:\377\354^:\377\354]:\377\353]:\377"
+ 888      EC5F3BFF 
+ 888      EC5E3AFF 
+ 888      EC5E3AFF 
+ 888      EC5D3AFF 
+ 889 1d88 EB5C39FF 		.ascii	"\353\\9\377\353\\9\377\353[9\377\352[9\377\352[9\377\352Z8\377"
+ 889      EB5C39FF 
+ 889      EB5B39FF 
+ 889      EA5B39FF 
+ 889      EA5B39FF 
+ 890 1da0 EA5A38FF 		.ascii	"\352Z8\377\352Y8\377\351Y8\377\351X7\377\351X7\377\351W7\377"
+ 890      EA5938FF 
+ 890      E95938FF 
+ 890      E95837FF 
+ 890      E95837FF 
+ 891 1db8 E85737FF 		.ascii	"\350W7\377\350V7\377\342J1\377\342I1\377\342I0\377\341H0\377"
+ 891      E85637FF 
+ 891      E24A31FF 
+ 891      E24931FF 
+GAS LISTING /tmp/ccTNyrIS.s 			page 34
+
+
+ 891      E24930FF 
+ 892 1dd0 E14830FF 		.ascii	"\341H0\377\341H0\377\341G/\377\341G/\377\340F/\377\340F/\377"
+ 892      E14830FF 
+ 892      E1472FFF 
+ 892      E1472FFF 
+ 892      E0462FFF 
+ 893 1de8 E0452FFF 		.ascii	"\340E/\377\340E.\377\337D.\377\337D.\377\337C.\377\337C.\377"
+ 893      E0452EFF 
+ 893      DF442EFF 
+ 893      DF442EFF 
+ 893      DF432EFF 
+ 894 1e00 DF422DFF 		.ascii	"\337B-\377\336B-\377\336A-\377\336A-\377\336@,\377\335@,\377"
+ 894      DE422DFF 
+ 894      DE412DFF 
+ 894      DE412DFF 
+ 894      DE402CFF 
+ 895 1e18 DD3F2CFF 		.ascii	"\335?,\377\335?,\377\335>,\377\334>+\377\334=+\377\334=+\377"
+ 895      DD3F2CFF 
+ 895      DD3E2CFF 
+ 895      DC3E2BFF 
+ 895      DC3D2BFF 
+ 896 1e30 DC3C2BFF 		.ascii	"\334<+\377\334<+\377\333;*\377\333;*\377\333:*\377\333:*\377"
+ 896      DC3C2BFF 
+ 896      DB3B2AFF 
+ 896      DB3B2AFF 
+ 896      DB3A2AFF 
+ 897 1e48 DA392AFF 		.ascii	"\3329*\377\3329)\377\3328)\377\3327)\377\3317)\377\3316)\377"
+ 897      DA3929FF 
+ 897      DA3829FF 
+ 897      DA3729FF 
+ 897      D93729FF 
+ 898 1e60 D93629FF 		.ascii	"\3316)\377\3315(\377\3315(\377\3304(\377\3303(\377\3303(\377"
+ 898      D93528FF 
+ 898      D93528FF 
+ 898      D83428FF 
+ 898      D83328FF 
+ 899 1e78 D83227FF 		.ascii	"\3302'\377\3272'\377\3271'\377\3270'\377\3270'\377\326/'\377"
+ 899      D73227FF 
+ 899      D73127FF 
+ 899      D73027FF 
+ 899      D73027FF 
+ 900 1e90 D62F27FF 		.ascii	"\326/'\377\326/'\377\325.'\377\325.'\377\324.'\377\324-'\377"
+ 900      D62F27FF 
+ 900      D52E27FF 
+ 900      D52E27FF 
+ 900      D42E27FF 
+ 901 1ea8 D42D27FF 		.ascii	"\324-'\377\323-'\377\323-'\377\323,'\377\322,'\377\322,'\377"
+ 901      D32D27FF 
+ 901      D32D27FF 
+ 901      D32C27FF 
+ 901      D22C27FF 
+ 902 1ec0 D12B27FF 		.ascii	"\321+'\377\321+'\377\321+'\377\320*'\377\320*'\377\317*'\377"
+ 902      D12B27FF 
+ 902      D12B27FF 
+ 902      D02A27FF 
+ 902      D02A27FF 
+ 903 1ed8 CF2927FF 		.ascii	"\317)'\377\317)'\377\316)'\377\316('\377\316('\377\315('\377"
+GAS LISTING /tmp/ccTNyrIS.s 			page 35
+
+
+ 903      CF2927FF 
+ 903      CE2927FF 
+ 903      CE2827FF 
+ 903      CE2827FF 
+ 904 1ef0 CD2727FF 		.ascii	"\315''\377\314''\377\314''\377\314&'\377\313&'\377\313&'\377"
+ 904      CC2727FF 
+ 904      CC2727FF 
+ 904      CC2627FF 
+ 904      CB2627FF 
+ 905 1f08 CA2527FF 		.ascii	"\312%'\377\312%'\377\312%'\377\311$'\377\311$'\377\310$'\377"
+ 905      CA2527FF 
+ 905      CA2527FF 
+ 905      C92427FF 
+ 905      C92427FF 
+ 906 1f20 C82327FF 		.ascii	"\310#'\377\310#'\377\307#'\377\307\"'\377\307\"'\377\306\"'\377"
+ 906      C82327FF 
+ 906      C72327FF 
+ 906      C72227FF 
+ 906      C72227FF 
+ 907 1f38 C62127FF 		.ascii	"\306!'\377\305!'\377\305!'\377\305 '\377\304 '\377\304 '\377"
+ 907      C52127FF 
+ 907      C52127FF 
+ 907      C52027FF 
+ 907      C42027FF 
+ 908 1f50 C31F27FF 		.ascii	"\303\037'\377\303\037'\377\271\025'\377\270\025'\377\270\024"
+ 908      C31F27FF 
+ 908      B91527FF 
+ 908      B81527FF 
+ 908      B814
+ 909 1f62 27FFB714 		.ascii	"'\377\267\024'\377\267\024'\377\267\023'\377\266\023'\377\266"
+ 909      27FFB714 
+ 909      27FFB713 
+ 909      27FFB613 
+ 909      27FFB6
+ 910 1f75 1327FFB5 		.ascii	"\023'\377\265\022'\377\265\022'\377\265\021'\377\264\021'\377"
+ 910      1227FFB5 
+ 910      1227FFB5 
+ 910      1127FFB4 
+ 910      1127FF
+ 911 1f88 B41127FF 		.ascii	"\264\021'\377\264\020'\377\263\020'\377\263\020&\377\262\017"
+ 911      B41027FF 
+ 911      B31027FF 
+ 911      B31026FF 
+ 911      B20F
+ 912 1f9a 26FFB20F 		.ascii	"&\377\262\017&\377\262\016&\377\261\016&\377\261\016&\377\260"
+ 912      26FFB20E 
+ 912      26FFB10E 
+ 912      26FFB10E 
+ 912      26FFB0
+ 913 1fad 0D26FFB0 		.ascii	"\r&\377\260\r&\377\260\f&\377\257\f&\377\257\013&\377"
+ 913      0D26FFB0 
+ 913      0C26FFAF 
+ 913      0C26FFAF 
+ 913      0B26FF
+ 914 1fc0 AE0B26FF 		.string	"\256\013&\377\256\013&\377\256\n&\377\255\n&\377\255\t&\377\254\t&\377\254\b&\377\254\b&\
+ 914      AE0B26FF 
+ 914      AE0A26FF 
+GAS LISTING /tmp/ccTNyrIS.s 			page 36
+
+
+ 914      AD0A26FF 
+ 914      AD0926FF 
+ 915 201e 26FFA500 		.string	"&\377\245"
+ 916 2022 26FF     		.ascii	"&\377"
+ 917              		.globl	heatmap_cs_RdYlGn_soft
+ 918              		.section	.data.rel.local
+ 919              		.align 8
+ 920              		.type	heatmap_cs_RdYlGn_soft, @object
+ 921              		.size	heatmap_cs_RdYlGn_soft, 8
+ 922              	heatmap_cs_RdYlGn_soft:
+ 923 0010 00000000 		.quad	soft
+ 923      00000000 
+ 924              		.section	.data.rel.ro.local
+ 925              		.align 16
+ 926              		.type	soft, @object
+ 927              		.size	soft, 16
+ 928              	soft:
+ 929 0020 00000000 		.quad	soft_data
+ 929      00000000 
+ 930 0028 01040000 		.quad	1025
+ 930      00000000 
+ 931              		.section	.rodata
+ 932 2024 00000000 		.align 32
+ 932      00000000 
+ 932      00000000 
+ 932      00000000 
+ 932      00000000 
+ 933              		.type	soft_data, @object
+ 934              		.size	soft_data, 4100
+ 935              	soft_data:
+ 936 2040 00       		.string	""
+ 937 2041 00       		.string	""
+ 938 2042 00       		.string	""
+ 939 2043 00       		.string	""
+ 940 2044 00       		.string	""
+ 941 2045 683600   		.string	"h6"
+ 942 2048 00       		.string	""
+ 943 2049 68370700 		.string	"h7\007"
+ 944 204d 68370E00 		.string	"h7\016"
+ 945 2051 69371600 		.string	"i7\026"
+ 946 2055 69371D00 		.string	"i7\035"
+ 947 2059 6A382500 		.string	"j8%"
+ 948 205d 6A382C01 		.ascii	"j8,\001k84\001k8;\001l9C\001l9J\001m9R\001m9Y\002m:a\002n:h\002"
+ 948      6B383401 
+ 948      6B383B01 
+ 948      6C394301 
+ 948      6C394A01 
+ 949 2081 6E3A7002 		.ascii	"n:p\002o:w\002o;\177\003p;\206\003p;\215\003q;\225\003q<\234"
+ 949      6F3A7702 
+ 949      6F3B7F03 
+ 949      703B8603 
+ 949      703B8D03 
+ 950 209c 03723CA4 		.ascii	"\003r<\244\004r<\253\004r<\263\004s=\272\004s=\302\005t=\311"
+ 950      04723CAB 
+ 950      04723CB3 
+ 950      04733DBA 
+ 950      04733DC2 
+GAS LISTING /tmp/ccTNyrIS.s 			page 37
+
+
+ 951 20b4 05743DD1 		.ascii	"\005t=\321\005u>\330\005u>\340\006v>\347\006v>\357\006w?\366"
+ 951      05753ED8 
+ 951      05753EE0 
+ 951      06763EE7 
+ 951      06763EEF 
+ 952 20cc 06773FFE 		.ascii	"\006w?\376\007x?\377\007x?\377\007x@\377\007y@\377\by@\377\b"
+ 952      07783FFF 
+ 952      07783FFF 
+ 952      077840FF 
+ 952      077940FF 
+ 953 20e5 7A40FF08 		.ascii	"z@\377\bzA\377\b{A\377\t{A\377\t|A\377\t|A\377\n}B\377\n}B\377"
+ 953      7A41FF08 
+ 953      7B41FF09 
+ 953      7B41FF09 
+ 953      7C41FF09 
+ 954 2104 0A7E42FF 		.ascii	"\n~B\377\n~B\377\013\177C\377\013\177C\377\013\177C\377\f\200"
+ 954      0A7E42FF 
+ 954      0B7F43FF 
+ 954      0B7F43FF 
+ 954      0B7F43FF 
+ 955 211a 43FF0C80 		.ascii	"C\377\f\200D\377\f\201D\377\r\201D\377\r\202D\377\r\202E\377"
+ 955      44FF0C81 
+ 955      44FF0D81 
+ 955      44FF0D82 
+ 955      44FF0D82 
+ 956 2130 0D8345FF 		.ascii	"\r\203E\377\016\203E\377\016\204E\377\016\204F\377\017\205F\377"
+ 956      0E8345FF 
+ 956      0E8445FF 
+ 956      0E8446FF 
+ 956      0F8546FF 
+ 957 2144 0F8546FF 		.ascii	"\017\205F\377\017\206F\377\017\206G\377\020\207G\377\020\207"
+ 957      0F8646FF 
+ 957      0F8647FF 
+ 957      108747FF 
+ 957      1087
+ 958 2156 47FF1088 		.ascii	"G\377\020\210G\377\020\210H\377\021\210H\377\021\211H\377\021"
+ 958      47FF1088 
+ 958      48FF1188 
+ 958      48FF1189 
+ 958      48FF11
+ 959 2169 8948FF12 		.ascii	"\211H\377\022\212I\377\022\212I\377\022\213I\377\022\213I\377"
+ 959      8A49FF12 
+ 959      8A49FF12 
+ 959      8B49FF12 
+ 959      8B49FF
+ 960 217c 138C4AFF 		.ascii	"\023\214J\377\023\214J\377\023\215J\377\024\215J\377\024\216"
+ 960      138C4AFF 
+ 960      138D4AFF 
+ 960      148D4AFF 
+ 960      148E
+ 961 218e 4BFF148E 		.ascii	"K\377\024\216K\377\024\217K\377\025\217K\377\025\220L\377\025"
+ 961      4BFF148F 
+ 961      4BFF158F 
+ 961      4BFF1590 
+ 961      4CFF15
+ 962 21a1 904CFF16 		.ascii	"\220L\377\026\221L\377\026\221L\377\026\222L\377\026\222M\377"
+ 962      914CFF16 
+GAS LISTING /tmp/ccTNyrIS.s 			page 38
+
+
+ 962      914CFF16 
+ 962      924CFF16 
+ 962      924DFF
+ 963 21b4 17924DFF 		.ascii	"\027\222M\377\027\223M\377\027\223M\377\027\224N\377\030\224"
+ 963      17934DFF 
+ 963      17934DFF 
+ 963      17944EFF 
+ 963      1894
+ 964 21c6 4EFF1895 		.ascii	"N\377\030\225N\377\030\225N\377\031\226O\377\031\226O\377\031"
+ 964      4EFF1895 
+ 964      4EFF1996 
+ 964      4FFF1996 
+ 964      4FFF19
+ 965 21d9 974FFF19 		.ascii	"\227O\377\031\227O\377\032\230P\377\033\230P\377\035\230P\377"
+ 965      974FFF1A 
+ 965      9850FF1B 
+ 965      9850FF1D 
+ 965      9850FF
+ 966 21ec 1E9950FF 		.ascii	"\036\231P\377\037\231P\377 \232P\377!\232Q\377\"\232Q\377#\233"
+ 966      1F9950FF 
+ 966      209A50FF 
+ 966      219A51FF 
+ 966      229A51FF 
+ 967 2202 51FF249B 		.ascii	"Q\377$\233Q\377%\233Q\377&\234R\377'\234R\377(\234R\377)\235"
+ 967      51FF259B 
+ 967      51FF269C 
+ 967      52FF279C 
+ 967      52FF289C 
+ 968 221a 52FF2A9D 		.ascii	"R\377*\235R\377+\235R\377+\236S\377,\236S\377-\237S\377.\237"
+ 968      52FF2B9D 
+ 968      52FF2B9E 
+ 968      53FF2C9E 
+ 968      53FF2D9F 
+ 969 2232 53FF2F9F 		.ascii	"S\377/\237S\3770\240T\3770\240T\3771\240T\3772\241T\3773\241"
+ 969      53FF30A0 
+ 969      54FF30A0 
+ 969      54FF31A0 
+ 969      54FF32A1 
+ 970 224a 54FF34A1 		.ascii	"T\3774\241T\3774\242U\3775\242U\3776\243U\3777\243U\3778\243"
+ 970      54FF34A2 
+ 970      55FF35A2 
+ 970      55FF36A3 
+ 970      55FF37A3 
+ 971 2262 55FF38A4 		.ascii	"U\3778\244V\3779\244V\377:\244V\377;\245V\377;\245V\377<\245"
+ 971      56FF39A4 
+ 971      56FF3AA4 
+ 971      56FF3BA5 
+ 971      56FF3BA5 
+ 972 227a 56FF3DA6 		.ascii	"V\377=\246W\377=\246W\377>\246W\377?\247W\377@\247W\377@\250"
+ 972      57FF3DA6 
+ 972      57FF3EA6 
+ 972      57FF3FA7 
+ 972      57FF40A7 
+ 973 2292 58FF41A8 		.ascii	"X\377A\250X\377B\250X\377B\251X\377C\251X\377D\251X\377D\252"
+ 973      58FF42A8 
+ 973      58FF42A9 
+ 973      58FF43A9 
+GAS LISTING /tmp/ccTNyrIS.s 			page 39
+
+
+ 973      58FF44A9 
+ 974 22aa 59FF45AA 		.ascii	"Y\377E\252Y\377F\252Y\377F\253Y\377G\253Y\377H\254Z\377I\254"
+ 974      59FF46AA 
+ 974      59FF46AB 
+ 974      59FF47AB 
+ 974      59FF48AC 
+ 975 22c2 5AFF49AC 		.ascii	"Z\377I\254Z\377J\255Z\377K\255Z\377K\255Z\377L\256[\377L\256"
+ 975      5AFF4AAD 
+ 975      5AFF4BAD 
+ 975      5AFF4BAD 
+ 975      5AFF4CAE 
+ 976 22da 5BFF4DAE 		.ascii	"[\377M\256[\377N\257[\377N\257[\377O\260\\\377P\260\\\377P\260"
+ 976      5BFF4EAF 
+ 976      5BFF4EAF 
+ 976      5BFF4FB0 
+ 976      5CFF50B0 
+ 977 22f2 5CFF51B1 		.ascii	"\\\377Q\261\\\377R\261\\\377R\261]\377S\262]\377T\262]\377T\262"
+ 977      5CFF52B1 
+ 977      5CFF52B1 
+ 977      5DFF53B2 
+ 977      5DFF54B2 
+ 978 230a 5DFF55B3 		.ascii	"]\377U\263]\377V\263^\377V\264^\377W\264^\377W\264^\377X\265"
+ 978      5DFF56B3 
+ 978      5EFF56B4 
+ 978      5EFF57B4 
+ 978      5EFF57B4 
+ 979 2322 5EFF59B5 		.ascii	"^\377Y\265^\377Y\265_\377Z\266_\377[\266_\377[\266_\377\\\267"
+ 979      5EFF59B5 
+ 979      5FFF5AB6 
+ 979      5FFF5BB6 
+ 979      5FFF5BB6 
+ 980 233a 5FFF5CB7 		.ascii	"_\377\\\267`\377]\267`\377^\270`\377^\270`\377_\271`\377_\271"
+ 980      60FF5DB7 
+ 980      60FF5EB8 
+ 980      60FF5EB8 
+ 980      60FF5FB9 
+ 981 2352 61FF60B9 		.ascii	"a\377`\271a\377a\272a\377a\272a\377b\272a\377c\273b\377c\273"
+ 981      61FF61BA 
+ 981      61FF61BA 
+ 981      61FF62BA 
+ 981      61FF63BB 
+ 982 236a 62FF64BB 		.ascii	"b\377d\273b\377d\274b\377e\274b\377f\275c\377f\275c\377g\275"
+ 982      62FF64BC 
+ 982      62FF65BC 
+ 982      62FF66BD 
+ 982      63FF66BD 
+ 983 2382 63FF68BD 		.ascii	"c\377h\275c\377h\276c\377i\276c\377j\276c\377j\277c\377k\277"
+ 983      63FF68BE 
+ 983      63FF69BE 
+ 983      63FF6ABE 
+ 983      63FF6ABF 
+ 984 239a 63FF6BBF 		.ascii	"c\377k\277c\377l\277c\377m\300c\377m\300c\377n\300c\377o\300"
+ 984      63FF6CBF 
+ 984      63FF6DC0 
+ 984      63FF6DC0 
+ 984      63FF6EC0 
+ 985 23b2 63FF6FC1 		.ascii	"c\377o\301c\377p\301c\377q\301c\377q\302c\377r\302c\377r\302"
+GAS LISTING /tmp/ccTNyrIS.s 			page 40
+
+
+ 985      63FF70C1 
+ 985      63FF71C1 
+ 985      63FF71C2 
+ 985      63FF72C2 
+ 986 23ca 64FF73C2 		.ascii	"d\377s\302d\377t\303d\377t\303d\377u\303d\377v\304d\377v\304"
+ 986      64FF74C3 
+ 986      64FF74C3 
+ 986      64FF75C3 
+ 986      64FF76C4 
+ 987 23e2 64FF77C4 		.ascii	"d\377w\304d\377x\304d\377x\305d\377y\305d\377y\305d\377z\305"
+ 987      64FF78C4 
+ 987      64FF78C5 
+ 987      64FF79C5 
+ 987      64FF79C5 
+ 988 23fa 64FF7BC6 		.ascii	"d\377{\306d\377{\306d\377|\306d\377}\307d\377}\307e\377~\307"
+ 988      64FF7BC6 
+ 988      64FF7CC6 
+ 988      64FF7DC7 
+ 988      64FF7DC7 
+ 989 2412 65FF7EC7 		.ascii	"e\377~\307e\377\177\310e\377\200\310e\377\200\310e\377\201\310"
+ 989      65FF7FC8 
+ 989      65FF80C8 
+ 989      65FF80C8 
+ 989      65FF81C8 
+ 990 2426 65FF82C9 		.ascii	"e\377\202\311e\377\202\311e\377\203\311e\377\203\312e\377\204"
+ 990      65FF82C9 
+ 990      65FF83C9 
+ 990      65FF83CA 
+ 990      65FF84
+ 991 2439 CA65FF85 		.ascii	"\312e\377\205\312e\377\205\312e\377\206\313e\377\207\313f\377"
+ 991      CA65FF85 
+ 991      CA65FF86 
+ 991      CB65FF87 
+ 991      CB66FF
+ 992 244c 87CB66FF 		.ascii	"\207\313f\377\210\313f\377\210\314f\377\211\314f\377\212\314"
+ 992      88CB66FF 
+ 992      88CC66FF 
+ 992      89CC66FF 
+ 992      8ACC
+ 993 245e 66FF8ACD 		.ascii	"f\377\212\315f\377\213\315f\377\213\315f\377\214\315f\377\215"
+ 993      66FF8BCD 
+ 993      66FF8BCD 
+ 993      66FF8CCD 
+ 993      66FF8D
+ 994 2471 CE66FF8D 		.ascii	"\316f\377\215\316f\377\216\316f\377\217\316f\377\217\317g\377"
+ 994      CE66FF8E 
+ 994      CE66FF8F 
+ 994      CE66FF8F 
+ 994      CF67FF
+ 995 2484 90CF67FF 		.ascii	"\220\317g\377\220\317g\377\221\320g\377\222\320g\377\222\320"
+ 995      90CF67FF 
+ 995      91D067FF 
+ 995      92D067FF 
+ 995      92D0
+ 996 2496 67FF93D0 		.ascii	"g\377\223\320g\377\224\321g\377\224\321g\377\225\321g\377\225"
+ 996      67FF94D1 
+ 996      67FF94D1 
+GAS LISTING /tmp/ccTNyrIS.s 			page 41
+
+
+ 996      67FF95D1 
+ 996      67FF95
+ 997 24a9 D167FF96 		.ascii	"\321g\377\226\322g\377\227\322g\377\227\322h\377\230\323h\377"
+ 997      D267FF97 
+ 997      D267FF97 
+ 997      D268FF98 
+ 997      D368FF
+ 998 24bc 98D368FF 		.ascii	"\230\323h\377\231\323h\377\232\323h\377\232\324h\377\233\324"
+ 998      99D368FF 
+ 998      9AD368FF 
+ 998      9AD468FF 
+ 998      9BD4
+ 999 24ce 68FF9CD4 		.ascii	"h\377\234\324h\377\234\324h\377\235\325h\377\235\325h\377\236"
+ 999      68FF9CD4 
+ 999      68FF9DD5 
+ 999      68FF9DD5 
+ 999      68FF9E
+ 1000 24e1 D568FF9F 		.ascii	"\325h\377\237\326i\377\237\326i\377\240\326i\377\240\326i\377"
+ 1000      D669FF9F 
+ 1000      D669FFA0 
+ 1000      D669FFA0 
+ 1000      D669FF
+ 1001 24f4 A1D769FF 		.ascii	"\241\327i\377\242\327i\377\242\327i\377\243\327i\377\244\330"
+ 1001      A2D769FF 
+ 1001      A2D769FF 
+ 1001      A3D769FF 
+ 1001      A4D8
+ 1002 2506 69FFA4D8 		.ascii	"i\377\244\330i\377\245\330i\377\245\330i\377\246\331j\377\246"
+ 1002      69FFA5D8 
+ 1002      69FFA5D8 
+ 1002      69FFA6D9 
+ 1002      6AFFA6
+ 1003 2519 D96AFFA7 		.ascii	"\331j\377\247\331j\377\250\331k\377\250\332k\377\251\332k\377"
+ 1003      D96AFFA8 
+ 1003      D96BFFA8 
+ 1003      DA6BFFA9 
+ 1003      DA6BFF
+ 1004 252c A9DA6CFF 		.ascii	"\251\332l\377\252\332l\377\252\332l\377\253\333l\377\253\333"
+ 1004      AADA6CFF 
+ 1004      AADA6CFF 
+ 1004      ABDB6CFF 
+ 1004      ABDB
+ 1005 253e 6DFFACDB 		.ascii	"m\377\254\333m\377\254\333m\377\255\333n\377\255\334n\377\256"
+ 1005      6DFFACDB 
+ 1005      6DFFADDB 
+ 1005      6EFFADDC 
+ 1005      6EFFAE
+ 1006 2551 DC6EFFAE 		.ascii	"\334n\377\256\334o\377\257\334o\377\257\335o\377\260\335o\377"
+ 1006      DC6FFFAF 
+ 1006      DC6FFFAF 
+ 1006      DD6FFFB0 
+ 1006      DD6FFF
+ 1007 2564 B0DD70FF 		.ascii	"\260\335p\377\261\335p\377\261\335p\377\262\336q\377\262\336"
+ 1007      B1DD70FF 
+ 1007      B1DD70FF 
+ 1007      B2DE71FF 
+ 1007      B2DE
+GAS LISTING /tmp/ccTNyrIS.s 			page 42
+
+
+ 1008 2576 71FFB3DE 		.ascii	"q\377\263\336q\377\263\336r\377\264\336r\377\264\337r\377\265"
+ 1008      71FFB3DE 
+ 1008      72FFB4DE 
+ 1008      72FFB4DF 
+ 1008      72FFB5
+ 1009 2589 DF73FFB6 		.ascii	"\337s\377\266\337s\377\266\337s\377\267\337s\377\267\340t\377"
+ 1009      DF73FFB6 
+ 1009      DF73FFB7 
+ 1009      DF73FFB7 
+ 1009      E074FF
+ 1010 259c B8E074FF 		.ascii	"\270\340t\377\270\340t\377\271\340u\377\271\341u\377\272\341"
+ 1010      B8E074FF 
+ 1010      B9E075FF 
+ 1010      B9E175FF 
+ 1010      BAE1
+ 1011 25ae 75FFBAE1 		.ascii	"u\377\272\341v\377\273\341v\377\273\341v\377\274\342w\377\274"
+ 1011      76FFBBE1 
+ 1011      76FFBBE1 
+ 1011      76FFBCE2 
+ 1011      77FFBC
+ 1012 25c1 E277FFBD 		.ascii	"\342w\377\275\342w\377\275\342x\377\276\342x\377\276\343x\377"
+ 1012      E277FFBD 
+ 1012      E278FFBE 
+ 1012      E278FFBE 
+ 1012      E378FF
+ 1013 25d4 BFE379FF 		.ascii	"\277\343y\377\277\343y\377\300\343y\377\300\344y\377\301\344"
+ 1013      BFE379FF 
+ 1013      C0E379FF 
+ 1013      C0E479FF 
+ 1013      C1E4
+ 1014 25e6 7AFFC1E4 		.ascii	"z\377\301\344z\377\302\344z\377\302\344{\377\303\345{\377\303"
+ 1014      7AFFC2E4 
+ 1014      7AFFC2E4 
+ 1014      7BFFC3E5 
+ 1014      7BFFC3
+ 1015 25f9 E57BFFC4 		.ascii	"\345{\377\304\345|\377\304\345|\377\305\345|\377\305\346}\377"
+ 1015      E57CFFC4 
+ 1015      E57CFFC5 
+ 1015      E57CFFC5 
+ 1015      E67DFF
+ 1016 260c C6E67DFF 		.ascii	"\306\346}\377\306\346}\377\306\346~\377\307\347~\377\307\347"
+ 1016      C6E67DFF 
+ 1016      C6E67EFF 
+ 1016      C7E77EFF 
+ 1016      C7E7
+ 1017 261e 7EFFC8E7 		.ascii	"~\377\310\347\177\377\310\347\177\377\311\347\177\377\311\350"
+ 1017      7FFFC8E7 
+ 1017      7FFFC9E7 
+ 1017      7FFFC9E8 
+ 1018 262e 80FFCAE8 		.ascii	"\200\377\312\350\200\377\312\350\200\377\313\350\201\377\313"
+ 1018      80FFCAE8 
+ 1018      80FFCBE8 
+ 1018      81FFCB
+ 1019 263d E981FFCC 		.ascii	"\351\201\377\314\351\201\377\314\351\202\377\315\351\202\377"
+ 1019      E981FFCC 
+ 1019      E982FFCD 
+ 1019      E982FF
+GAS LISTING /tmp/ccTNyrIS.s 			page 43
+
+
+ 1020 264c CDE982FF 		.ascii	"\315\351\202\377\316\352\203\377\316\352\203\377\317\352\203"
+ 1020      CEEA83FF 
+ 1020      CEEA83FF 
+ 1020      CFEA83
+ 1021 265b FFCFEA84 		.ascii	"\377\317\352\204\377\320\352\204\377\320\353\204\377\321\353"
+ 1021      FFD0EA84 
+ 1021      FFD0EB84 
+ 1021      FFD1EB
+ 1022 266a 85FFD1EB 		.ascii	"\205\377\321\353\205\377\322\353\205\377\322\354\206\377\323"
+ 1022      85FFD2EB 
+ 1022      85FFD2EC 
+ 1022      86FFD3
+ 1023 2679 EC86FFD3 		.ascii	"\354\206\377\323\354\206\377\323\354\207\377\324\354\207\377"
+ 1023      EC86FFD3 
+ 1023      EC87FFD4 
+ 1023      EC87FF
+ 1024 2688 D4ED88FF 		.ascii	"\324\355\210\377\325\355\210\377\325\355\210\377\326\355\211"
+ 1024      D5ED88FF 
+ 1024      D5ED88FF 
+ 1024      D6ED89
+ 1025 2697 FFD6ED89 		.ascii	"\377\326\355\211\377\327\356\211\377\327\356\212\377\330\356"
+ 1025      FFD7EE89 
+ 1025      FFD7EE8A 
+ 1025      FFD8EE
+ 1026 26a6 8AFFD8EE 		.ascii	"\212\377\330\356\212\377\331\356\212\377\331\356\212\377\331"
+ 1026      8AFFD9EE 
+ 1026      8AFFD9EE 
+ 1026      8AFFD9
+ 1027 26b5 EE8AFFD9 		.ascii	"\356\212\377\331\356\212\377\331\356\212\377\332\356\212\377"
+ 1027      EE8AFFD9 
+ 1027      EE8AFFDA 
+ 1027      EE8AFF
+ 1028 26c4 DAEE8AFF 		.ascii	"\332\356\212\377\332\356\212\377\332\356\212\377\333\356\212"
+ 1028      DAEE8AFF 
+ 1028      DAEE8AFF 
+ 1028      DBEE8A
+ 1029 26d3 FFDBEE8A 		.ascii	"\377\333\356\212\377\333\356\212\377\333\356\212\377\333\356"
+ 1029      FFDBEE8A 
+ 1029      FFDBEE8A 
+ 1029      FFDBEE
+ 1030 26e2 8AFFDCED 		.ascii	"\212\377\334\355\212\377\334\355\212\377\334\355\212\377\334"
+ 1030      8AFFDCED 
+ 1030      8AFFDCED 
+ 1030      8AFFDC
+ 1031 26f1 ED8AFFDC 		.ascii	"\355\212\377\334\355\212\377\335\355\212\377\335\355\212\377"
+ 1031      ED8AFFDD 
+ 1031      ED8AFFDD 
+ 1031      ED8AFF
+ 1032 2700 DDED89FF 		.ascii	"\335\355\211\377\335\355\211\377\335\355\211\377\336\355\211"
+ 1032      DDED89FF 
+ 1032      DDED89FF 
+ 1032      DEED89
+ 1033 270f FFDEED89 		.ascii	"\377\336\355\211\377\336\355\211\377\336\355\211\377\337\354"
+ 1033      FFDEED89 
+ 1033      FFDEED89 
+ 1033      FFDFEC
+ 1034 271e 89FFDFEC 		.ascii	"\211\377\337\354\211\377\337\354\211\377\337\354\211\377\337"
+GAS LISTING /tmp/ccTNyrIS.s 			page 44
+
+
+ 1034      89FFDFEC 
+ 1034      89FFDFEC 
+ 1034      89FFDF
+ 1035 272d EC89FFE0 		.ascii	"\354\211\377\340\354\211\377\340\354\211\377\340\354\211\377"
+ 1035      EC89FFE0 
+ 1035      EC89FFE0 
+ 1035      EC89FF
+ 1036 273c E0EC89FF 		.ascii	"\340\354\211\377\340\354\211\377\341\354\211\377\341\354\211"
+ 1036      E0EC89FF 
+ 1036      E1EC89FF 
+ 1036      E1EC89
+ 1037 274b FFE1EC89 		.ascii	"\377\341\354\211\377\341\353\211\377\341\353\211\377\342\353"
+ 1037      FFE1EB89 
+ 1037      FFE1EB89 
+ 1037      FFE2EB
+ 1038 275a 89FFE2EB 		.ascii	"\211\377\342\353\211\377\342\353\211\377\342\353\211\377\342"
+ 1038      89FFE2EB 
+ 1038      89FFE2EB 
+ 1038      89FFE2
+ 1039 2769 EB89FFE3 		.ascii	"\353\211\377\343\353\211\377\343\353\211\377\343\353\211\377"
+ 1039      EB89FFE3 
+ 1039      EB89FFE3 
+ 1039      EB89FF
+ 1040 2778 E3EB89FF 		.ascii	"\343\353\211\377\343\353\210\377\344\353\210\377\344\353\210"
+ 1040      E3EB88FF 
+ 1040      E4EB88FF 
+ 1040      E4EB88
+ 1041 2787 FFE4EA88 		.ascii	"\377\344\352\210\377\344\352\210\377\344\352\210\377\345\352"
+ 1041      FFE4EA88 
+ 1041      FFE4EA88 
+ 1041      FFE5EA
+ 1042 2796 88FFE5EA 		.ascii	"\210\377\345\352\210\377\345\352\210\377\345\352\210\377\345"
+ 1042      88FFE5EA 
+ 1042      88FFE5EA 
+ 1042      88FFE5
+ 1043 27a5 EA88FFE6 		.ascii	"\352\210\377\346\352\210\377\346\352\210\377\346\352\210\377"
+ 1043      EA88FFE6 
+ 1043      EA88FFE6 
+ 1043      EA88FF
+ 1044 27b4 E6EA88FF 		.ascii	"\346\352\210\377\346\352\210\377\347\352\210\377\347\351\210"
+ 1044      E6EA88FF 
+ 1044      E7EA88FF 
+ 1044      E7E988
+ 1045 27c3 FFE7E988 		.ascii	"\377\347\351\210\377\347\351\210\377\347\351\210\377\347\351"
+ 1045      FFE7E988 
+ 1045      FFE7E988 
+ 1045      FFE7E9
+ 1046 27d2 88FFE8E9 		.ascii	"\210\377\350\351\210\377\350\351\210\377\350\351\210\377\350"
+ 1046      88FFE8E9 
+ 1046      88FFE8E9 
+ 1046      88FFE8
+ 1047 27e1 E988FFE8 		.ascii	"\351\210\377\350\351\210\377\351\351\210\377\351\351\210\377"
+ 1047      E988FFE9 
+ 1047      E988FFE9 
+ 1047      E988FF
+ 1048 27f0 E9E988FF 		.ascii	"\351\351\210\377\351\350\210\377\351\350\210\377\352\350\210"
+ 1048      E9E888FF 
+GAS LISTING /tmp/ccTNyrIS.s 			page 45
+
+
+ 1048      E9E888FF 
+ 1048      EAE888
+ 1049 27ff FFEAE888 		.ascii	"\377\352\350\210\377\352\350\210\377\352\350\210\377\352\350"
+ 1049      FFEAE888 
+ 1049      FFEAE888 
+ 1049      FFEAE8
+ 1050 280e 88FF     		.ascii	"\210\377"
+ 1051 2810 EBE888FF 		.ascii	"\353\350\210\377\353\350\210\377\353\350\210\377\353\350\210"
+ 1051      EBE888FF 
+ 1051      EBE888FF 
+ 1051      EBE888
+ 1052 281f FFEBE888 		.ascii	"\377\353\350\210\377\353\350\210\377\354\350\210\377\354\347"
+ 1052      FFEBE888 
+ 1052      FFECE888 
+ 1052      FFECE7
+ 1053 282e 88FFECE7 		.ascii	"\210\377\354\347\210\377\354\347\210\377\354\347\210\377\355"
+ 1053      88FFECE7 
+ 1053      88FFECE7 
+ 1053      88FFED
+ 1054 283d E788FFED 		.ascii	"\347\210\377\355\347\210\377\355\347\210\377\355\347\210\377"
+ 1054      E788FFED 
+ 1054      E788FFED 
+ 1054      E788FF
+ 1055 284c EDE788FF 		.ascii	"\355\347\210\377\355\347\210\377\356\347\210\377\356\347\210"
+ 1055      EDE788FF 
+ 1055      EEE788FF 
+ 1055      EEE788
+ 1056 285b FFEEE788 		.ascii	"\377\356\347\210\377\356\346\210\377\356\346\210\377\356\346"
+ 1056      FFEEE688 
+ 1056      FFEEE688 
+ 1056      FFEEE6
+ 1057 286a 88FFEFE6 		.ascii	"\210\377\357\346\210\377\357\346\210\377\357\346\210\377\357"
+ 1057      88FFEFE6 
+ 1057      88FFEFE6 
+ 1057      88FFEF
+ 1058 2879 E688FFEF 		.ascii	"\346\210\377\357\346\210\377\360\346\210\377\360\346\210\377"
+ 1058      E688FFF0 
+ 1058      E688FFF0 
+ 1058      E688FF
+ 1059 2888 F0E688FF 		.ascii	"\360\346\210\377\360\346\210\377\360\346\210\377\360\346\210"
+ 1059      F0E688FF 
+ 1059      F0E688FF 
+ 1059      F0E688
+ 1060 2897 FFF1E588 		.ascii	"\377\361\345\210\377\361\345\210\377\361\345\210\377\361\345"
+ 1060      FFF1E588 
+ 1060      FFF1E588 
+ 1060      FFF1E5
+ 1061 28a6 88FFF1E5 		.ascii	"\210\377\361\345\210\377\361\345\210\377\362\345\210\377\362"
+ 1061      88FFF1E5 
+ 1061      88FFF2E5 
+ 1061      88FFF2
+ 1062 28b5 E588FFF2 		.ascii	"\345\210\377\362\345\210\377\362\345\210\377\362\345\210\377"
+ 1062      E588FFF2 
+ 1062      E588FFF2 
+ 1062      E588FF
+ 1063 28c4 F2E588FF 		.ascii	"\362\345\210\377\363\345\210\377\363\344\210\377\363\344\210"
+ 1063      F3E588FF 
+GAS LISTING /tmp/ccTNyrIS.s 			page 46
+
+
+ 1063      F3E488FF 
+ 1063      F3E488
+ 1064 28d3 FFF3E488 		.ascii	"\377\363\344\210\377\363\344\210\377\363\344\210\377\364\344"
+ 1064      FFF3E488 
+ 1064      FFF3E488 
+ 1064      FFF4E4
+ 1065 28e2 88FFF4E4 		.ascii	"\210\377\364\344\210\377\364\344\210\377\364\344\210\377\364"
+ 1065      88FFF4E4 
+ 1065      88FFF4E4 
+ 1065      88FFF4
+ 1066 28f1 E488FFF4 		.ascii	"\344\210\377\364\344\210\377\365\344\210\377\365\344\210\377"
+ 1066      E488FFF5 
+ 1066      E488FFF5 
+ 1066      E488FF
+ 1067 2900 F5E489FF 		.ascii	"\365\344\211\377\365\343\211\377\365\343\211\377\365\343\211"
+ 1067      F5E389FF 
+ 1067      F5E389FF 
+ 1067      F5E389
+ 1068 290f FFF6E389 		.ascii	"\377\366\343\211\377\366\343\211\377\366\343\211\377\366\343"
+ 1068      FFF6E389 
+ 1068      FFF6E389 
+ 1068      FFF6E3
+ 1069 291e 89FFF6E3 		.ascii	"\211\377\366\343\211\377\366\343\211\377\367\343\211\377\367"
+ 1069      89FFF6E3 
+ 1069      89FFF7E3 
+ 1069      89FFF7
+ 1070 292d E389FFF7 		.ascii	"\343\211\377\367\343\211\377\367\343\211\377\367\343\211\377"
+ 1070      E389FFF7 
+ 1070      E389FFF7 
+ 1070      E389FF
+ 1071 293c F7E289FF 		.ascii	"\367\342\211\377\370\342\211\377\370\342\211\377\370\342\211"
+ 1071      F8E289FF 
+ 1071      F8E289FF 
+ 1071      F8E289
+ 1072 294b FFF8E289 		.ascii	"\377\370\342\211\377\370\342\211\377\370\342\211\377\370\342"
+ 1072      FFF8E289 
+ 1072      FFF8E289 
+ 1072      FFF8E2
+ 1073 295a 89FFF9E2 		.ascii	"\211\377\371\342\211\377\371\342\211\377\371\342\211\377\371"
+ 1073      89FFF9E2 
+ 1073      89FFF9E2 
+ 1073      89FFF9
+ 1074 2969 E289FFF9 		.ascii	"\342\211\377\371\342\211\377\371\341\211\377\372\341\211\377"
+ 1074      E289FFF9 
+ 1074      E189FFFA 
+ 1074      E189FF
+ 1075 2978 FAE189FF 		.ascii	"\372\341\211\377\372\341\211\377\372\341\211\377\372\341\212"
+ 1075      FAE189FF 
+ 1075      FAE189FF 
+ 1075      FAE18A
+ 1076 2987 FFFAE18A 		.ascii	"\377\372\341\212\377\372\341\212\377\373\341\212\377\373\341"
+ 1076      FFFAE18A 
+ 1076      FFFBE18A 
+ 1076      FFFBE1
+ 1077 2996 8AFFFBE1 		.ascii	"\212\377\373\341\212\377\373\341\212\377\373\341\212\377\373"
+ 1077      8AFFFBE1 
+ 1077      8AFFFBE1 
+GAS LISTING /tmp/ccTNyrIS.s 			page 47
+
+
+ 1077      8AFFFB
+ 1078 29a5 E18AFFFC 		.ascii	"\341\212\377\374\340\212\377\374\340\212\377\374\340\212\377"
+ 1078      E08AFFFC 
+ 1078      E08AFFFC 
+ 1078      E08AFF
+ 1079 29b4 FCE08AFF 		.ascii	"\374\340\212\377\374\340\212\377\374\340\212\377\374\340\212"
+ 1079      FCE08AFF 
+ 1079      FCE08AFF 
+ 1079      FCE08A
+ 1080 29c3 FFFDE08A 		.ascii	"\377\375\340\212\377\375\340\212\377\375\340\212\377\375\340"
+ 1080      FFFDE08A 
+ 1080      FFFDE08A 
+ 1080      FFFDE0
+ 1081 29d2 8AFFFDE0 		.ascii	"\212\377\375\340\212\377\375\340\212\377\375\340\212\377\375"
+ 1081      8AFFFDE0 
+ 1081      8AFFFDE0 
+ 1081      8AFFFD
+ 1082 29e1 DF8AFFFD 		.ascii	"\337\212\377\375\337\212\377\375\336\211\377\375\336\211\377"
+ 1082      DF8AFFFD 
+ 1082      DE89FFFD 
+ 1082      DE89FF
+ 1083 29f0 FDDD88FF 		.ascii	"\375\335\210\377\375\335\210\377\375\334\207\377\375\334\207"
+ 1083      FDDD88FF 
+ 1083      FDDC87FF 
+ 1083      FDDC87
+ 1084 29ff FFFDDB86 		.ascii	"\377\375\333\206\377\375\333\206\377\375\333\205\377\375\332"
+ 1084      FFFDDB86 
+ 1084      FFFDDB85 
+ 1084      FFFDDA
+ 1085 2a0e 85FFFDDA 		.ascii	"\205\377\375\332\204\377\375\331\204\377\375\331\203\377\375"
+ 1085      84FFFDD9 
+ 1085      84FFFDD9 
+ 1085      83FFFD
+ 1086 2a1d D883FFFD 		.ascii	"\330\203\377\375\330\202\377\375\327\202\377\375\327\201\377"
+ 1086      D882FFFD 
+ 1086      D782FFFD 
+ 1086      D781FF
+ 1087 2a2c FDD681FF 		.ascii	"\375\326\201\377\375\326\200\377\375\325\200\377\375\325\177"
+ 1087      FDD680FF 
+ 1087      FDD580FF 
+ 1087      FDD57F
+ 1088 2a3b FFFDD47F 		.ascii	"\377\375\324\177\377\375\324~\377\375\323~\377\375\323~\377\375"
+ 1088      FFFDD47E 
+ 1088      FFFDD37E 
+ 1088      FFFDD37E 
+ 1088      FFFD
+ 1089 2a4d D27DFFFD 		.ascii	"\322}\377\375\322}\377\375\322|\377\375\321|\377\375\321{\377"
+ 1089      D27DFFFD 
+ 1089      D27CFFFD 
+ 1089      D17CFFFD 
+ 1089      D17BFF
+ 1090 2a60 FDD07BFF 		.ascii	"\375\320{\377\375\320z\377\375\317z\377\375\317y\377\375\316"
+ 1090      FDD07AFF 
+ 1090      FDCF7AFF 
+ 1090      FDCF79FF 
+ 1090      FDCE
+ 1091 2a72 79FFFDCE 		.ascii	"y\377\375\316y\377\375\315x\377\375\315x\377\375\314w\377\375"
+GAS LISTING /tmp/ccTNyrIS.s 			page 48
+
+
+ 1091      79FFFDCD 
+ 1091      78FFFDCD 
+ 1091      78FFFDCC 
+ 1091      77FFFD
+ 1092 2a85 CC77FFFD 		.ascii	"\314w\377\375\313v\377\375\313v\377\375\312u\377\375\312u\377"
+ 1092      CB76FFFD 
+ 1092      CB76FFFD 
+ 1092      CA75FFFD 
+ 1092      CA75FF
+ 1093 2a98 FDC975FF 		.ascii	"\375\311u\377\375\311t\377\375\310t\377\375\310s\377\375\307"
+ 1093      FDC974FF 
+ 1093      FDC874FF 
+ 1093      FDC873FF 
+ 1093      FDC7
+ 1094 2aaa 73FFFDC7 		.ascii	"s\377\375\307s\377\375\306r\377\375\306r\377\375\305q\377\375"
+ 1094      73FFFDC6 
+ 1094      72FFFDC6 
+ 1094      72FFFDC5 
+ 1094      71FFFD
+ 1095 2abd C571FFFD 		.ascii	"\305q\377\375\304q\377\375\304p\377\375\303p\377\375\303o\377"
+ 1095      C471FFFD 
+ 1095      C470FFFD 
+ 1095      C370FFFD 
+ 1095      C36FFF
+ 1096 2ad0 FDC26FFF 		.ascii	"\375\302o\377\375\302o\377\375\302n\377\375\301n\377\375\301"
+ 1096      FDC26FFF 
+ 1096      FDC26EFF 
+ 1096      FDC16EFF 
+ 1096      FDC1
+ 1097 2ae2 6DFFFDC0 		.ascii	"m\377\375\300m\377\375\300m\377\375\277l\377\375\277l\377\375"
+ 1097      6DFFFDC0 
+ 1097      6DFFFDBF 
+ 1097      6CFFFDBF 
+ 1097      6CFFFD
+ 1098 2af5 BE6BFFFD 		.ascii	"\276k\377\375\276k\377\375\275k\377\375\275j\377\375\274j\377"
+ 1098      BE6BFFFD 
+ 1098      BD6BFFFD 
+ 1098      BD6AFFFD 
+ 1098      BC6AFF
+ 1099 2b08 FDBC6AFF 		.ascii	"\375\274j\377\375\273i\377\375\273i\377\375\272i\377\375\272"
+ 1099      FDBB69FF 
+ 1099      FDBB69FF 
+ 1099      FDBA69FF 
+ 1099      FDBA
+ 1100 2b1a 68FFFDB9 		.ascii	"h\377\375\271h\377\375\271h\377\375\270g\377\375\270g\377\375"
+ 1100      68FFFDB9 
+ 1100      68FFFDB8 
+ 1100      67FFFDB8 
+ 1100      67FFFD
+ 1101 2b2d B766FFFD 		.ascii	"\267f\377\375\267f\377\375\266f\377\375\266e\377\375\265e\377"
+ 1101      B766FFFD 
+ 1101      B666FFFD 
+ 1101      B665FFFD 
+ 1101      B565FF
+ 1102 2b40 FDB565FF 		.ascii	"\375\265e\377\375\264d\377\375\264d\377\375\263d\377\375\263"
+ 1102      FDB464FF 
+ 1102      FDB464FF 
+GAS LISTING /tmp/ccTNyrIS.s 			page 49
+
+
+ 1102      FDB364FF 
+ 1102      FDB3
+ 1103 2b52 64FFFDB2 		.ascii	"d\377\375\262c\377\375\261c\377\375\261c\377\375\260b\377\375"
+ 1103      63FFFDB1 
+ 1103      63FFFDB1 
+ 1103      63FFFDB0 
+ 1103      62FFFD
+ 1104 2b65 B062FFFD 		.ascii	"\260b\377\375\257b\377\375\257a\377\375\256a\377\375\256a\377"
+ 1104      AF62FFFD 
+ 1104      AF61FFFD 
+ 1104      AE61FFFD 
+ 1104      AE61FF
+ 1105 2b78 FCAD60FF 		.ascii	"\374\255`\377\374\255`\377\374\254`\377\374\254_\377\374\253"
+ 1105      FCAD60FF 
+ 1105      FCAC60FF 
+ 1105      FCAC5FFF 
+ 1105      FCAB
+ 1106 2b8a 5FFFFCAA 		.ascii	"_\377\374\252^\377\374\252^\377\374\251]\377\374\251]\377\374"
+ 1106      5EFFFCAA 
+ 1106      5EFFFCA9 
+ 1106      5DFFFCA9 
+ 1106      5DFFFC
+ 1107 2b9d A85DFFFC 		.ascii	"\250]\377\374\247\\\377\374\247\\\377\374\246[\377\374\246[\377"
+ 1107      A75CFFFC 
+ 1107      A75CFFFC 
+ 1107      A65BFFFC 
+ 1107      A65BFF
+ 1108 2bb0 FBA55AFF 		.ascii	"\373\245Z\377\373\245Z\377\373\244Z\377\373\243Y\377\373\243"
+ 1108      FBA55AFF 
+ 1108      FBA45AFF 
+ 1108      FBA359FF 
+ 1108      FBA3
+ 1109 2bc2 59FFFBA2 		.ascii	"Y\377\373\242Y\377\373\242X\377\373\241X\377\373\240W\377\373"
+ 1109      59FFFBA2 
+ 1109      58FFFBA1 
+ 1109      58FFFBA0 
+ 1109      57FFFB
+ 1110 2bd5 A057FFFB 		.ascii	"\240W\377\373\237W\377\373\237V\377\373\236V\377\373\235U\377"
+ 1110      9F57FFFB 
+ 1110      9F56FFFB 
+ 1110      9E56FFFB 
+ 1110      9D55FF
+ 1111 2be8 FA9D55FF 		.ascii	"\372\235U\377\372\234U\377\372\233T\377\372\233T\377\372\232"
+ 1111      FA9C55FF 
+ 1111      FA9B54FF 
+ 1111      FA9B54FF 
+ 1111      FA9A
+ 1112 2bfa 54FFFA9A 		.ascii	"T\377\372\232S\377\372\231S\377\372\230S\377\372\230R\377\372"
+ 1112      53FFFA99 
+ 1112      53FFFA98 
+ 1112      53FFFA98 
+ 1112      52FFFA
+ 1113 2c0d 9752FFFA 		.ascii	"\227R\377\372\227R\377\372\226Q\377\372\225Q\377\371\225Q\377"
+ 1113      9752FFFA 
+ 1113      9651FFFA 
+ 1113      9551FFF9 
+ 1113      9551FF
+GAS LISTING /tmp/ccTNyrIS.s 			page 50
+
+
+ 1114 2c20 F99450FF 		.ascii	"\371\224P\377\371\223P\377\371\223P\377\371\222O\377\371\222"
+ 1114      F99350FF 
+ 1114      F99350FF 
+ 1114      F9924FFF 
+ 1114      F992
+ 1115 2c32 4FFFF991 		.ascii	"O\377\371\221O\377\371\220N\377\371\220N\377\371\217N\377\371"
+ 1115      4FFFF990 
+ 1115      4EFFF990 
+ 1115      4EFFF98F 
+ 1115      4EFFF9
+ 1116 2c45 8E4EFFF9 		.ascii	"\216N\377\371\216M\377\370\215M\377\370\215M\377\370\214L\377"
+ 1116      8E4DFFF8 
+ 1116      8D4DFFF8 
+ 1116      8D4DFFF8 
+ 1116      8C4CFF
+ 1117 2c58 F88B4CFF 		.ascii	"\370\213L\377\370\213L\377\370\212L\377\370\211K\377\370\211"
+ 1117      F88B4CFF 
+ 1117      F88A4CFF 
+ 1117      F8894BFF 
+ 1117      F889
+ 1118 2c6a 4BFFF888 		.ascii	"K\377\370\210K\377\370\207J\377\370\207J\377\367\206J\377\367"
+ 1118      4BFFF887 
+ 1118      4AFFF887 
+ 1118      4AFFF786 
+ 1118      4AFFF7
+ 1119 2c7d 864AFFF7 		.ascii	"\206J\377\367\205I\377\367\204I\377\367\204I\377\367\203I\377"
+ 1119      8549FFF7 
+ 1119      8449FFF7 
+ 1119      8449FFF7 
+ 1119      8349FF
+ 1120 2c90 F78248FF 		.ascii	"\367\202H\377\367\202H\377\367\201H\377\367\200H\377\367\200"
+ 1120      F78248FF 
+ 1120      F78148FF 
+ 1120      F78048FF 
+ 1120      F780
+ 1121 2ca2 48FFF67F 		.ascii	"H\377\366\177G\377\366~G\377\366~G\377\366}G\377\366|F\377\366"
+ 1121      47FFF67E 
+ 1121      47FFF67E 
+ 1121      47FFF67D 
+ 1121      47FFF67C 
+ 1122 2cb9 7C46FFF6 		.ascii	"|F\377\366{F\377\366zF\377\366zF\377\366yE\377\365xE\377\365"
+ 1122      7B46FFF6 
+ 1122      7A46FFF6 
+ 1122      7A46FFF6 
+ 1122      7945FFF5 
+ 1123 2cd1 7845FFF5 		.ascii	"xE\377\365wE\377\365vE\377\365vE\377\365uD\377\365tD\377\365"
+ 1123      7745FFF5 
+ 1123      7645FFF5 
+ 1123      7645FFF5 
+ 1123      7544FFF5 
+ 1124 2ce9 7444FFF5 		.ascii	"tD\377\365sD\377\364rD\377\364rD\377\364qC\377\364pC\377\364"
+ 1124      7344FFF4 
+ 1124      7244FFF4 
+ 1124      7244FFF4 
+ 1124      7143FFF4 
+ 1125 2d01 6F43FFF4 		.ascii	"oC\377\364oC\377\364nC\377\364mC\377\364mC\377\363lB\377\363"
+ 1125      6F43FFF4 
+GAS LISTING /tmp/ccTNyrIS.s 			page 51
+
+
+ 1125      6E43FFF4 
+ 1125      6D43FFF4 
+ 1125      6D43FFF3 
+ 1126 2d19 6C42FFF3 		.ascii	"lB\377\363kB\377\362kA\377\362jA\377\362iA\377\362i@\377\361"
+ 1126      6B42FFF2 
+ 1126      6B41FFF2 
+ 1126      6A41FFF2 
+ 1126      6941FFF2 
+ 1127 2d31 6840FFF1 		.ascii	"h@\377\361h@\377\361g?\377\361g?\377\360f?\377\360f?\377\360"
+ 1127      6840FFF1 
+ 1127      673FFFF1 
+ 1127      673FFFF0 
+ 1127      663FFFF0 
+ 1128 2d49 653EFFEF 		.ascii	"e>\377\357e>\377\357d>\377\357d=\377\357c=\377\356c=\377\356"
+ 1128      653EFFEF 
+ 1128      643EFFEF 
+ 1128      643DFFEF 
+ 1128      633DFFEE 
+ 1129 2d61 623CFFEE 		.ascii	"b<\377\356b<\377\355a<\377\355`<\377\355`;\377\355_;\377\354"
+ 1129      623CFFED 
+ 1129      613CFFED 
+ 1129      603CFFED 
+ 1129      603BFFED 
+ 1130 2d79 5F3BFFEC 		.ascii	"_;\377\354^:\377\354^:\377\354]:\377\353]9\377\353\\9\377\353"
+ 1130      5E3AFFEC 
+ 1130      5E3AFFEC 
+ 1130      5D3AFFEB 
+ 1130      5D39FFEB 
+ 1131 2d91 5C39FFEA 		.ascii	"\\9\377\352[9\377\352[8\377\352Z8\377\352Y8\377\351Y7\377\351"
+ 1131      5B39FFEA 
+ 1131      5B38FFEA 
+ 1131      5A38FFEA 
+ 1131      5938FFE9 
+ 1132 2da9 5837FFE9 		.ascii	"X7\377\351X7\377\350W7\377\350W6\377\350V6\377\350V6\377\347"
+ 1132      5837FFE8 
+ 1132      5737FFE8 
+ 1132      5736FFE8 
+ 1132      5636FFE8 
+ 1133 2dc1 5536FFE7 		.ascii	"U6\377\347T5\377\347T5\377\346S5\377\346S4\377\346R4\377\346"
+ 1133      5435FFE7 
+ 1133      5435FFE6 
+ 1133      5335FFE6 
+ 1133      5334FFE6 
+ 1134 2dd9 5234FFE5 		.ascii	"R4\377\345Q4\377\345P3\377\345P3\377\344O3\377\344O2\377\344"
+ 1134      5134FFE5 
+ 1134      5033FFE5 
+ 1134      5033FFE4 
+ 1134      4F33FFE4 
+ 1135 2df1 4E32FFE4 		.ascii	"N2\377\344N2\377\343M2\377\343L1\377\343L1\377\342K1\377\342"
+ 1135      4E32FFE3 
+ 1135      4D32FFE3 
+ 1135      4C31FFE3 
+ 1135      4C31FFE2 
+ 1136 2e09 4B31FFE2 		.ascii	"K1\377\342J0\377\342I0\377\341I0\377\341H0\377\341H/\377\341"
+ 1136      4A30FFE2 
+ 1136      4930FFE1 
+ 1136      4930FFE1 
+GAS LISTING /tmp/ccTNyrIS.s 			page 52
+
+
+ 1136      4830FFE1 
+ 1137 2e21 472FFFE0 		.ascii	"G/\377\340F/\377\340F.\377\340E.\377\337D.\377\337D.\377\337"
+ 1137      462FFFE0 
+ 1137      462EFFE0 
+ 1137      452EFFDF 
+ 1137      442EFFDF 
+ 1138 2e39 432DFFDE 		.ascii	"C-\377\336C-\377\336B-\377\336A-\377\336A,\377\335@,\377\335"
+ 1138      432DFFDE 
+ 1138      422DFFDE 
+ 1138      412DFFDE 
+ 1138      412CFFDD 
+ 1139 2e51 3F2CFFDD 		.ascii	"?,\377\335?,\377\334>+\377\334=+\377\334=+\377\334<+\377\333"
+ 1139      3F2CFFDC 
+ 1139      3E2BFFDC 
+ 1139      3D2BFFDC 
+ 1139      3D2BFFDC 
+ 1140 2e69 3B2AFFDB 		.ascii	";*\377\333;*\377\333:*\377\3329*\377\3329)\377\3328)\377\332"
+ 1140      3B2AFFDB 
+ 1140      3A2AFFDA 
+ 1140      392AFFDA 
+ 1140      3929FFDA 
+ 1141 2e81 3729FFD9 		.ascii	"7)\377\3317)\377\3316)\377\3315(\377\3304(\377\3304(\377\330"
+ 1141      3729FFD9 
+ 1141      3629FFD9 
+ 1141      3528FFD8 
+ 1141      3428FFD8 
+ 1142 2e99 3328FFD8 		.ascii	"3(\377\3302'\377\3271'\377\3271'\377\3270'\377\326/'\377\326"
+ 1142      3227FFD7 
+ 1142      3127FFD7 
+ 1142      3127FFD7 
+ 1142      3027FFD6 
+ 1143 2eb1 2F27FFD5 		.ascii	"/'\377\325/'\377\325.'\377\324.'\377\324-'\377\323-'\377\323"
+ 1143      2F27FFD5 
+ 1143      2E27FFD4 
+ 1143      2E27FFD4 
+ 1143      2D27FFD3 
+ 1144 2ec9 2D27FFD2 		.ascii	"-'\377\322,'\377\322,'\377\322+'\377\321+'\377\321+'\377\320"
+ 1144      2C27FFD2 
+ 1144      2C27FFD2 
+ 1144      2B27FFD1 
+ 1144      2B27FFD1 
+ 1145 2ee1 2A27FFD0 		.ascii	"*'\377\320*'\377\317)'\377\317)'\377\316)'\377\316('\377\315"
+ 1145      2A27FFCF 
+ 1145      2927FFCF 
+ 1145      2927FFCE 
+ 1145      2927FFCE 
+ 1146 2ef9 2827FFCD 		.ascii	"('\377\315''\377\314''\377\314''\377\313&'\377\313&'\377\312"
+ 1146      2727FFCC 
+ 1146      2727FFCC 
+ 1146      2727FFCB 
+ 1146      2627FFCB 
+ 1147 2f11 2527FFCA 		.ascii	"%'\377\312%'\377\311%'\377\311$'\377\310$'\377\310#'\377\307"
+ 1147      2527FFC9 
+ 1147      2527FFC9 
+ 1147      2427FFC8 
+ 1147      2427FFC8 
+ 1148 2f29 2327FFC7 		.ascii	"#'\377\307\"'\377\306\"'\377\306\"'\377\305!'\377\305!'\377\304"
+GAS LISTING /tmp/ccTNyrIS.s 			page 53
+
+
+ 1148      2227FFC6 
+ 1148      2227FFC6 
+ 1148      2227FFC5 
+ 1148      2127FFC5 
+ 1149 2f41 2027FFC4 		.ascii	" '\377\304 '\377\304 '\377\303\037'\377\303\037'\377\302\036"
+ 1149      2027FFC4 
+ 1149      2027FFC3 
+ 1149      1F27FFC3 
+ 1149      1F27FFC2 
+ 1150 2f56 27FFC21E 		.ascii	"'\377\302\036'\377\301\035'\377\301\035'\377\300\035'\377\300"
+ 1150      27FFC11D 
+ 1150      27FFC11D 
+ 1150      27FFC01D 
+ 1150      27FFC0
+ 1151 2f69 1C27FFBF 		.ascii	"\034'\377\277\034'\377\277\033'\377\276\033'\377\276\032'\377"
+ 1151      1C27FFBF 
+ 1151      1B27FFBE 
+ 1151      1B27FFBE 
+ 1151      1A27FF
+ 1152 2f7c BD1A27FF 		.ascii	"\275\032'\377\275\032'\377\274\031'\377\274\031'\377\273\030"
+ 1152      BD1A27FF 
+ 1152      BC1927FF 
+ 1152      BC1927FF 
+ 1152      BB18
+ 1153 2f8e 27FFBB18 		.ascii	"'\377\273\030'\377\272\027'\377\272\027'\377\271\026'\377\271"
+ 1153      27FFBA17 
+ 1153      27FFBA17 
+ 1153      27FFB916 
+ 1153      27FFB9
+ 1154 2fa1 1627FFB8 		.ascii	"\026'\377\270\025'\377\270\025'\377\267\025'\377\267\024'\377"
+ 1154      1527FFB8 
+ 1154      1527FFB7 
+ 1154      1527FFB7 
+ 1154      1427FF
+ 1155 2fb4 B61427FF 		.ascii	"\266\024'\377\266\023'\377\265\023'\377\265\022'\377\264\022"
+ 1155      B61327FF 
+ 1155      B51327FF 
+ 1155      B51227FF 
+ 1155      B412
+ 1156 2fc6 27FFB411 		.ascii	"'\377\264\021'\377\263\021'\377\263\020'\377\262\020'\377\262"
+ 1156      27FFB311 
+ 1156      27FFB310 
+ 1156      27FFB210 
+ 1156      27FFB2
+ 1157 2fd9 0F27FFB1 		.ascii	"\017'\377\261\016&\377"
+ 1157      0E26FF
+ 1158 2fe0 B10E26FF 		.string	"\261\016&\377\260\r&\377\260\r&\377\257\f&\377\257\f&\377\256\013&\377\256\n&\377\255\n&\
+ 1158      B00D26FF 
+ 1158      B00D26FF 
+ 1158      AF0C26FF 
+ 1158      AF0C26FF 
+ 1159 3042 26FF     		.ascii	"&\377"
+ 1160              		.globl	heatmap_cs_RdYlGn_discrete
+ 1161              		.section	.data.rel.local
+ 1162              		.align 8
+ 1163              		.type	heatmap_cs_RdYlGn_discrete, @object
+ 1164              		.size	heatmap_cs_RdYlGn_discrete, 8
+GAS LISTING /tmp/ccTNyrIS.s 			page 54
+
+
+ 1165              	heatmap_cs_RdYlGn_discrete:
+ 1166 0018 00000000 		.quad	discrete
+ 1166      00000000 
+ 1167              		.section	.data.rel.ro.local
+ 1168              		.align 16
+ 1169              		.type	discrete, @object
+ 1170              		.size	discrete, 16
+ 1171              	discrete:
+ 1172 0030 00000000 		.quad	discrete_data
+ 1172      00000000 
+ 1173 0038 0B000000 		.quad	11
+ 1173      00000000 
+ 1174              		.section	.rodata
+ 1175 3044 00000000 		.align 32
+ 1175      00000000 
+ 1175      00000000 
+ 1175      00000000 
+ 1175      00000000 
+ 1176              		.type	discrete_data, @object
+ 1177              		.size	discrete_data, 44
+ 1178              	discrete_data:
+ 1179 3060 00       		.string	""
+ 1180 3061 00       		.string	""
+ 1181 3062 00       		.string	""
+ 1182 3063 00       		.string	""
+ 1183 3064 00       		.string	""
+ 1184 3065 6837FF1A 		.string	"h7\377\032\230P\377f\275c\377\246\331j\377\331\357\213\377\376\340\213\377\375\256a\377\3
+ 1184      9850FF66 
+ 1184      BD63FFA6 
+ 1184      D96AFFD9 
+ 1184      EF8BFFFE 
+ 1185 308a 26FF     		.ascii	"&\377"
+ 1186              		.text
+ 1187              	.Letext0:
+ 1188              		.file 1 "./heatmap.h"
+ 1189              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1190              		.file 3 "./colorschemes/RdYlGn.h"
+ 1191              		.file 4 "colorschemes/RdYlGn.c"
+ 1192              		.section	.debug_info,"",@progbits
+ 1193              	.Ldebug_info0:
+ 1194 0000 E3010000 		.long	0x1e3
+ 1195 0004 0500     		.value	0x5
+ 1196 0006 01       		.byte	0x1
+ 1197 0007 08       		.byte	0x8
+ 1198 0008 00000000 		.long	.Ldebug_abbrev0
+ 1199 000c 0A       		.uleb128 0xa
+ 1200 000d 00000000 		.long	.LASF26
+ 1201 0011 1D       		.byte	0x1d
+ 1202 0012 00000000 		.long	.LASF0
+ 1203 0016 00000000 		.long	.LASF1
+ 1204 001a 00000000 		.long	.Ldebug_line0
+ 1205 001e 01       		.uleb128 0x1
+ 1206 001f 08       		.byte	0x8
+ 1207 0020 05       		.byte	0x5
+ 1208 0021 00000000 		.long	.LASF2
+ 1209 0025 06       		.uleb128 0x6
+ 1210 0026 00000000 		.long	.LASF12
+GAS LISTING /tmp/ccTNyrIS.s 			page 55
+
+
+ 1211 002a 02       		.byte	0x2
+ 1212 002b D6       		.byte	0xd6
+ 1213 002c 17       		.byte	0x17
+ 1214 002d 31000000 		.long	0x31
+ 1215 0031 01       		.uleb128 0x1
+ 1216 0032 08       		.byte	0x8
+ 1217 0033 07       		.byte	0x7
+ 1218 0034 00000000 		.long	.LASF3
+ 1219 0038 0B       		.uleb128 0xb
+ 1220 0039 04       		.byte	0x4
+ 1221 003a 05       		.byte	0x5
+ 1222 003b 696E7400 		.string	"int"
+ 1223 003f 01       		.uleb128 0x1
+ 1224 0040 08       		.byte	0x8
+ 1225 0041 05       		.byte	0x5
+ 1226 0042 00000000 		.long	.LASF4
+ 1227 0046 01       		.uleb128 0x1
+ 1228 0047 10       		.byte	0x10
+ 1229 0048 04       		.byte	0x4
+ 1230 0049 00000000 		.long	.LASF5
+ 1231 004d 01       		.uleb128 0x1
+ 1232 004e 04       		.byte	0x4
+ 1233 004f 04       		.byte	0x4
+ 1234 0050 00000000 		.long	.LASF6
+ 1235 0054 01       		.uleb128 0x1
+ 1236 0055 04       		.byte	0x4
+ 1237 0056 07       		.byte	0x7
+ 1238 0057 00000000 		.long	.LASF7
+ 1239 005b 01       		.uleb128 0x1
+ 1240 005c 02       		.byte	0x2
+ 1241 005d 07       		.byte	0x7
+ 1242 005e 00000000 		.long	.LASF8
+ 1243 0062 0C       		.uleb128 0xc
+ 1244 0063 10       		.byte	0x10
+ 1245 0064 01       		.byte	0x1
+ 1246 0065 BB       		.byte	0xbb
+ 1247 0066 09       		.byte	0x9
+ 1248 0067 84000000 		.long	0x84
+ 1249 006b 07       		.uleb128 0x7
+ 1250 006c 00000000 		.long	.LASF9
+ 1251 0070 BC       		.byte	0xbc
+ 1252 0071 1A       		.byte	0x1a
+ 1253 0072 84000000 		.long	0x84
+ 1254 0076 00       		.byte	0
+ 1255 0077 07       		.uleb128 0x7
+ 1256 0078 00000000 		.long	.LASF10
+ 1257 007c BD       		.byte	0xbd
+ 1258 007d 0C       		.byte	0xc
+ 1259 007e 25000000 		.long	0x25
+ 1260 0082 08       		.byte	0x8
+ 1261 0083 00       		.byte	0
+ 1262 0084 08       		.uleb128 0x8
+ 1263 0085 90000000 		.long	0x90
+ 1264 0089 01       		.uleb128 0x1
+ 1265 008a 01       		.byte	0x1
+ 1266 008b 08       		.byte	0x8
+ 1267 008c 00000000 		.long	.LASF11
+GAS LISTING /tmp/ccTNyrIS.s 			page 56
+
+
+ 1268 0090 03       		.uleb128 0x3
+ 1269 0091 89000000 		.long	0x89
+ 1270 0095 06       		.uleb128 0x6
+ 1271 0096 00000000 		.long	.LASF13
+ 1272 009a 01       		.byte	0x1
+ 1273 009b BE       		.byte	0xbe
+ 1274 009c 03       		.byte	0x3
+ 1275 009d 62000000 		.long	0x62
+ 1276 00a1 03       		.uleb128 0x3
+ 1277 00a2 95000000 		.long	0x95
+ 1278 00a6 08       		.uleb128 0x8
+ 1279 00a7 A1000000 		.long	0xa1
+ 1280 00ab 04       		.uleb128 0x4
+ 1281 00ac 00000000 		.long	.LASF14
+ 1282 00b0 21       		.byte	0x21
+ 1283 00b1 A6000000 		.long	0xa6
+ 1284 00b5 04       		.uleb128 0x4
+ 1285 00b6 00000000 		.long	.LASF15
+ 1286 00ba 23       		.byte	0x23
+ 1287 00bb A6000000 		.long	0xa6
+ 1288 00bf 04       		.uleb128 0x4
+ 1289 00c0 00000000 		.long	.LASF16
+ 1290 00c4 25       		.byte	0x25
+ 1291 00c5 A6000000 		.long	0xa6
+ 1292 00c9 04       		.uleb128 0x4
+ 1293 00ca 00000000 		.long	.LASF17
+ 1294 00ce 28       		.byte	0x28
+ 1295 00cf A6000000 		.long	0xa6
+ 1296 00d3 09       		.uleb128 0x9
+ 1297 00d4 90000000 		.long	0x90
+ 1298 00d8 E3000000 		.long	0xe3
+ 1299 00dc 0D       		.uleb128 0xd
+ 1300 00dd 31000000 		.long	0x31
+ 1301 00e1 2B       		.byte	0x2b
+ 1302 00e2 00       		.byte	0
+ 1303 00e3 03       		.uleb128 0x3
+ 1304 00e4 D3000000 		.long	0xd3
+ 1305 00e8 02       		.uleb128 0x2
+ 1306 00e9 00000000 		.long	.LASF18
+ 1307 00ed 20       		.byte	0x20
+ 1308 00ee 1C       		.byte	0x1c
+ 1309 00ef E3000000 		.long	0xe3
+ 1310 00f3 09       		.uleb128 0x9
+ 1311 00f4 03       		.byte	0x3
+ 1312 00f5 00000000 		.quad	discrete_data
+ 1312      00000000 
+ 1313 00fd 02       		.uleb128 0x2
+ 1314 00fe 00000000 		.long	.LASF19
+ 1315 0102 23       		.byte	0x23
+ 1316 0103 24       		.byte	0x24
+ 1317 0104 A1000000 		.long	0xa1
+ 1318 0108 09       		.uleb128 0x9
+ 1319 0109 03       		.byte	0x3
+ 1320 010a 00000000 		.quad	discrete
+ 1320      00000000 
+ 1321 0112 05       		.uleb128 0x5
+ 1322 0113 AB000000 		.long	0xab
+GAS LISTING /tmp/ccTNyrIS.s 			page 57
+
+
+ 1323 0117 24       		.byte	0x24
+ 1324 0118 09       		.uleb128 0x9
+ 1325 0119 03       		.byte	0x3
+ 1326 011a 00000000 		.quad	heatmap_cs_RdYlGn_discrete
+ 1326      00000000 
+ 1327 0122 09       		.uleb128 0x9
+ 1328 0123 90000000 		.long	0x90
+ 1329 0127 33010000 		.long	0x133
+ 1330 012b 0E       		.uleb128 0xe
+ 1331 012c 31000000 		.long	0x31
+ 1332 0130 0310     		.value	0x1003
+ 1333 0132 00       		.byte	0
+ 1334 0133 03       		.uleb128 0x3
+ 1335 0134 22010000 		.long	0x122
+ 1336 0138 02       		.uleb128 0x2
+ 1337 0139 00000000 		.long	.LASF20
+ 1338 013d 26       		.byte	0x26
+ 1339 013e 1C       		.byte	0x1c
+ 1340 013f 33010000 		.long	0x133
+ 1341 0143 09       		.uleb128 0x9
+ 1342 0144 03       		.byte	0x3
+ 1343 0145 00000000 		.quad	soft_data
+ 1343      00000000 
+ 1344 014d 02       		.uleb128 0x2
+ 1345 014e 00000000 		.long	.LASF21
+ 1346 0152 29       		.byte	0x29
+ 1347 0153 24       		.byte	0x24
+ 1348 0154 A1000000 		.long	0xa1
+ 1349 0158 09       		.uleb128 0x9
+ 1350 0159 03       		.byte	0x3
+ 1351 015a 00000000 		.quad	soft
+ 1351      00000000 
+ 1352 0162 05       		.uleb128 0x5
+ 1353 0163 B5000000 		.long	0xb5
+ 1354 0167 2A       		.byte	0x2a
+ 1355 0168 09       		.uleb128 0x9
+ 1356 0169 03       		.byte	0x3
+ 1357 016a 00000000 		.quad	heatmap_cs_RdYlGn_soft
+ 1357      00000000 
+ 1358 0172 02       		.uleb128 0x2
+ 1359 0173 00000000 		.long	.LASF22
+ 1360 0177 2C       		.byte	0x2c
+ 1361 0178 1C       		.byte	0x1c
+ 1362 0179 33010000 		.long	0x133
+ 1363 017d 09       		.uleb128 0x9
+ 1364 017e 03       		.byte	0x3
+ 1365 017f 00000000 		.quad	mixed_data
+ 1365      00000000 
+ 1366 0187 02       		.uleb128 0x2
+ 1367 0188 00000000 		.long	.LASF23
+ 1368 018c 2F       		.byte	0x2f
+ 1369 018d 24       		.byte	0x24
+ 1370 018e A1000000 		.long	0xa1
+ 1371 0192 09       		.uleb128 0x9
+ 1372 0193 03       		.byte	0x3
+ 1373 0194 00000000 		.quad	mixed
+ 1373      00000000 
+GAS LISTING /tmp/ccTNyrIS.s 			page 58
+
+
+ 1374 019c 05       		.uleb128 0x5
+ 1375 019d BF000000 		.long	0xbf
+ 1376 01a1 30       		.byte	0x30
+ 1377 01a2 09       		.uleb128 0x9
+ 1378 01a3 03       		.byte	0x3
+ 1379 01a4 00000000 		.quad	heatmap_cs_RdYlGn_mixed
+ 1379      00000000 
+ 1380 01ac 02       		.uleb128 0x2
+ 1381 01ad 00000000 		.long	.LASF24
+ 1382 01b1 32       		.byte	0x32
+ 1383 01b2 1C       		.byte	0x1c
+ 1384 01b3 33010000 		.long	0x133
+ 1385 01b7 09       		.uleb128 0x9
+ 1386 01b8 03       		.byte	0x3
+ 1387 01b9 00000000 		.quad	mixed_exp_data
+ 1387      00000000 
+ 1388 01c1 02       		.uleb128 0x2
+ 1389 01c2 00000000 		.long	.LASF25
+ 1390 01c6 35       		.byte	0x35
+ 1391 01c7 24       		.byte	0x24
+ 1392 01c8 A1000000 		.long	0xa1
+ 1393 01cc 09       		.uleb128 0x9
+ 1394 01cd 03       		.byte	0x3
+ 1395 01ce 00000000 		.quad	mixed_exp
+ 1395      00000000 
+ 1396 01d6 05       		.uleb128 0x5
+ 1397 01d7 C9000000 		.long	0xc9
+ 1398 01db 36       		.byte	0x36
+ 1399 01dc 09       		.uleb128 0x9
+ 1400 01dd 03       		.byte	0x3
+ 1401 01de 00000000 		.quad	heatmap_cs_RdYlGn_mixed_exp
+ 1401      00000000 
+ 1402 01e6 00       		.byte	0
+ 1403              		.section	.debug_abbrev,"",@progbits
+ 1404              	.Ldebug_abbrev0:
+ 1405 0000 01       		.uleb128 0x1
+ 1406 0001 24       		.uleb128 0x24
+ 1407 0002 00       		.byte	0
+ 1408 0003 0B       		.uleb128 0xb
+ 1409 0004 0B       		.uleb128 0xb
+ 1410 0005 3E       		.uleb128 0x3e
+ 1411 0006 0B       		.uleb128 0xb
+ 1412 0007 03       		.uleb128 0x3
+ 1413 0008 0E       		.uleb128 0xe
+ 1414 0009 00       		.byte	0
+ 1415 000a 00       		.byte	0
+ 1416 000b 02       		.uleb128 0x2
+ 1417 000c 34       		.uleb128 0x34
+ 1418 000d 00       		.byte	0
+ 1419 000e 03       		.uleb128 0x3
+ 1420 000f 0E       		.uleb128 0xe
+ 1421 0010 3A       		.uleb128 0x3a
+ 1422 0011 21       		.uleb128 0x21
+ 1423 0012 04       		.sleb128 4
+ 1424 0013 3B       		.uleb128 0x3b
+ 1425 0014 0B       		.uleb128 0xb
+ 1426 0015 39       		.uleb128 0x39
+GAS LISTING /tmp/ccTNyrIS.s 			page 59
+
+
+ 1427 0016 0B       		.uleb128 0xb
+ 1428 0017 49       		.uleb128 0x49
+ 1429 0018 13       		.uleb128 0x13
+ 1430 0019 02       		.uleb128 0x2
+ 1431 001a 18       		.uleb128 0x18
+ 1432 001b 00       		.byte	0
+ 1433 001c 00       		.byte	0
+ 1434 001d 03       		.uleb128 0x3
+ 1435 001e 26       		.uleb128 0x26
+ 1436 001f 00       		.byte	0
+ 1437 0020 49       		.uleb128 0x49
+ 1438 0021 13       		.uleb128 0x13
+ 1439 0022 00       		.byte	0
+ 1440 0023 00       		.byte	0
+ 1441 0024 04       		.uleb128 0x4
+ 1442 0025 34       		.uleb128 0x34
+ 1443 0026 00       		.byte	0
+ 1444 0027 03       		.uleb128 0x3
+ 1445 0028 0E       		.uleb128 0xe
+ 1446 0029 3A       		.uleb128 0x3a
+ 1447 002a 21       		.uleb128 0x21
+ 1448 002b 03       		.sleb128 3
+ 1449 002c 3B       		.uleb128 0x3b
+ 1450 002d 0B       		.uleb128 0xb
+ 1451 002e 39       		.uleb128 0x39
+ 1452 002f 21       		.uleb128 0x21
+ 1453 0030 25       		.sleb128 37
+ 1454 0031 49       		.uleb128 0x49
+ 1455 0032 13       		.uleb128 0x13
+ 1456 0033 3F       		.uleb128 0x3f
+ 1457 0034 19       		.uleb128 0x19
+ 1458 0035 3C       		.uleb128 0x3c
+ 1459 0036 19       		.uleb128 0x19
+ 1460 0037 00       		.byte	0
+ 1461 0038 00       		.byte	0
+ 1462 0039 05       		.uleb128 0x5
+ 1463 003a 34       		.uleb128 0x34
+ 1464 003b 00       		.byte	0
+ 1465 003c 47       		.uleb128 0x47
+ 1466 003d 13       		.uleb128 0x13
+ 1467 003e 3A       		.uleb128 0x3a
+ 1468 003f 21       		.uleb128 0x21
+ 1469 0040 04       		.sleb128 4
+ 1470 0041 3B       		.uleb128 0x3b
+ 1471 0042 0B       		.uleb128 0xb
+ 1472 0043 39       		.uleb128 0x39
+ 1473 0044 21       		.uleb128 0x21
+ 1474 0045 1E       		.sleb128 30
+ 1475 0046 02       		.uleb128 0x2
+ 1476 0047 18       		.uleb128 0x18
+ 1477 0048 00       		.byte	0
+ 1478 0049 00       		.byte	0
+ 1479 004a 06       		.uleb128 0x6
+ 1480 004b 16       		.uleb128 0x16
+ 1481 004c 00       		.byte	0
+ 1482 004d 03       		.uleb128 0x3
+ 1483 004e 0E       		.uleb128 0xe
+GAS LISTING /tmp/ccTNyrIS.s 			page 60
+
+
+ 1484 004f 3A       		.uleb128 0x3a
+ 1485 0050 0B       		.uleb128 0xb
+ 1486 0051 3B       		.uleb128 0x3b
+ 1487 0052 0B       		.uleb128 0xb
+ 1488 0053 39       		.uleb128 0x39
+ 1489 0054 0B       		.uleb128 0xb
+ 1490 0055 49       		.uleb128 0x49
+ 1491 0056 13       		.uleb128 0x13
+ 1492 0057 00       		.byte	0
+ 1493 0058 00       		.byte	0
+ 1494 0059 07       		.uleb128 0x7
+ 1495 005a 0D       		.uleb128 0xd
+ 1496 005b 00       		.byte	0
+ 1497 005c 03       		.uleb128 0x3
+ 1498 005d 0E       		.uleb128 0xe
+ 1499 005e 3A       		.uleb128 0x3a
+ 1500 005f 21       		.uleb128 0x21
+ 1501 0060 01       		.sleb128 1
+ 1502 0061 3B       		.uleb128 0x3b
+ 1503 0062 0B       		.uleb128 0xb
+ 1504 0063 39       		.uleb128 0x39
+ 1505 0064 0B       		.uleb128 0xb
+ 1506 0065 49       		.uleb128 0x49
+ 1507 0066 13       		.uleb128 0x13
+ 1508 0067 38       		.uleb128 0x38
+ 1509 0068 0B       		.uleb128 0xb
+ 1510 0069 00       		.byte	0
+ 1511 006a 00       		.byte	0
+ 1512 006b 08       		.uleb128 0x8
+ 1513 006c 0F       		.uleb128 0xf
+ 1514 006d 00       		.byte	0
+ 1515 006e 0B       		.uleb128 0xb
+ 1516 006f 21       		.uleb128 0x21
+ 1517 0070 08       		.sleb128 8
+ 1518 0071 49       		.uleb128 0x49
+ 1519 0072 13       		.uleb128 0x13
+ 1520 0073 00       		.byte	0
+ 1521 0074 00       		.byte	0
+ 1522 0075 09       		.uleb128 0x9
+ 1523 0076 01       		.uleb128 0x1
+ 1524 0077 01       		.byte	0x1
+ 1525 0078 49       		.uleb128 0x49
+ 1526 0079 13       		.uleb128 0x13
+ 1527 007a 01       		.uleb128 0x1
+ 1528 007b 13       		.uleb128 0x13
+ 1529 007c 00       		.byte	0
+ 1530 007d 00       		.byte	0
+ 1531 007e 0A       		.uleb128 0xa
+ 1532 007f 11       		.uleb128 0x11
+ 1533 0080 01       		.byte	0x1
+ 1534 0081 25       		.uleb128 0x25
+ 1535 0082 0E       		.uleb128 0xe
+ 1536 0083 13       		.uleb128 0x13
+ 1537 0084 0B       		.uleb128 0xb
+ 1538 0085 03       		.uleb128 0x3
+ 1539 0086 1F       		.uleb128 0x1f
+ 1540 0087 1B       		.uleb128 0x1b
+GAS LISTING /tmp/ccTNyrIS.s 			page 61
+
+
+ 1541 0088 1F       		.uleb128 0x1f
+ 1542 0089 10       		.uleb128 0x10
+ 1543 008a 17       		.uleb128 0x17
+ 1544 008b 00       		.byte	0
+ 1545 008c 00       		.byte	0
+ 1546 008d 0B       		.uleb128 0xb
+ 1547 008e 24       		.uleb128 0x24
+ 1548 008f 00       		.byte	0
+ 1549 0090 0B       		.uleb128 0xb
+ 1550 0091 0B       		.uleb128 0xb
+ 1551 0092 3E       		.uleb128 0x3e
+ 1552 0093 0B       		.uleb128 0xb
+ 1553 0094 03       		.uleb128 0x3
+ 1554 0095 08       		.uleb128 0x8
+ 1555 0096 00       		.byte	0
+ 1556 0097 00       		.byte	0
+ 1557 0098 0C       		.uleb128 0xc
+ 1558 0099 13       		.uleb128 0x13
+ 1559 009a 01       		.byte	0x1
+ 1560 009b 0B       		.uleb128 0xb
+ 1561 009c 0B       		.uleb128 0xb
+ 1562 009d 3A       		.uleb128 0x3a
+ 1563 009e 0B       		.uleb128 0xb
+ 1564 009f 3B       		.uleb128 0x3b
+ 1565 00a0 0B       		.uleb128 0xb
+ 1566 00a1 39       		.uleb128 0x39
+ 1567 00a2 0B       		.uleb128 0xb
+ 1568 00a3 01       		.uleb128 0x1
+ 1569 00a4 13       		.uleb128 0x13
+ 1570 00a5 00       		.byte	0
+ 1571 00a6 00       		.byte	0
+ 1572 00a7 0D       		.uleb128 0xd
+ 1573 00a8 21       		.uleb128 0x21
+ 1574 00a9 00       		.byte	0
+ 1575 00aa 49       		.uleb128 0x49
+ 1576 00ab 13       		.uleb128 0x13
+ 1577 00ac 2F       		.uleb128 0x2f
+ 1578 00ad 0B       		.uleb128 0xb
+ 1579 00ae 00       		.byte	0
+ 1580 00af 00       		.byte	0
+ 1581 00b0 0E       		.uleb128 0xe
+ 1582 00b1 21       		.uleb128 0x21
+ 1583 00b2 00       		.byte	0
+ 1584 00b3 49       		.uleb128 0x49
+ 1585 00b4 13       		.uleb128 0x13
+ 1586 00b5 2F       		.uleb128 0x2f
+ 1587 00b6 05       		.uleb128 0x5
+ 1588 00b7 00       		.byte	0
+ 1589 00b8 00       		.byte	0
+ 1590 00b9 00       		.byte	0
+ 1591              		.section	.debug_aranges,"",@progbits
+ 1592 0000 1C000000 		.long	0x1c
+ 1593 0004 0200     		.value	0x2
+ 1594 0006 00000000 		.long	.Ldebug_info0
+ 1595 000a 08       		.byte	0x8
+ 1596 000b 00       		.byte	0
+ 1597 000c 0000     		.value	0
+GAS LISTING /tmp/ccTNyrIS.s 			page 62
+
+
+ 1598 000e 0000     		.value	0
+ 1599 0010 00000000 		.quad	0
+ 1599      00000000 
+ 1600 0018 00000000 		.quad	0
+ 1600      00000000 
+ 1601              		.section	.debug_line,"",@progbits
+ 1602              	.Ldebug_line0:
+ 1603 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1603      05000800 
+ 1603      49000000 
+ 1603      010101FB 
+ 1603      0E0D0001 
+ 1604              	.LASF15:
+ 1605 0000 68656174 		.string	"heatmap_cs_RdYlGn_soft"
+ 1605      6D61705F 
+ 1605      63735F52 
+ 1605      64596C47 
+ 1605      6E5F736F 
+ 1606              	.LASF12:
+ 1607 0017 73697A65 		.string	"size_t"
+ 1607      5F7400
+ 1608              	.LASF13:
+ 1609 001e 68656174 		.string	"heatmap_colorscheme_t"
+ 1609      6D61705F 
+ 1609      636F6C6F 
+ 1609      72736368 
+ 1609      656D655F 
+ 1610              	.LASF16:
+ 1611 0034 68656174 		.string	"heatmap_cs_RdYlGn_mixed"
+ 1611      6D61705F 
+ 1611      63735F52 
+ 1611      64596C47 
+ 1611      6E5F6D69 
+ 1612              	.LASF26:
+ 1613 004c 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1613      43313720 
+ 1613      31322E32 
+ 1613      2E30202D 
+ 1613      6D74756E 
+ 1614              	.LASF6:
+ 1615 00ab 666C6F61 		.string	"float"
+ 1615      7400
+ 1616              	.LASF11:
+ 1617 00b1 756E7369 		.string	"unsigned char"
+ 1617      676E6564 
+ 1617      20636861 
+ 1617      7200
+ 1618              	.LASF3:
+ 1619 00bf 6C6F6E67 		.string	"long unsigned int"
+ 1619      20756E73 
+ 1619      69676E65 
+ 1619      6420696E 
+ 1619      7400
+ 1620              	.LASF8:
+ 1621 00d1 73686F72 		.string	"short unsigned int"
+ 1621      7420756E 
+ 1621      7369676E 
+GAS LISTING /tmp/ccTNyrIS.s 			page 63
+
+
+ 1621      65642069 
+ 1621      6E7400
+ 1622              	.LASF25:
+ 1623 00e4 6D697865 		.string	"mixed_exp"
+ 1623      645F6578 
+ 1623      7000
+ 1624              	.LASF23:
+ 1625 00ee 6D697865 		.string	"mixed"
+ 1625      6400
+ 1626              	.LASF14:
+ 1627 00f4 68656174 		.string	"heatmap_cs_RdYlGn_discrete"
+ 1627      6D61705F 
+ 1627      63735F52 
+ 1627      64596C47 
+ 1627      6E5F6469 
+ 1628              	.LASF7:
+ 1629 010f 756E7369 		.string	"unsigned int"
+ 1629      676E6564 
+ 1629      20696E74 
+ 1629      00
+ 1630              	.LASF19:
+ 1631 011c 64697363 		.string	"discrete"
+ 1631      72657465 
+ 1631      00
+ 1632              	.LASF20:
+ 1633 0125 736F6674 		.string	"soft_data"
+ 1633      5F646174 
+ 1633      6100
+ 1634              	.LASF10:
+ 1635 012f 6E636F6C 		.string	"ncolors"
+ 1635      6F727300 
+ 1636              	.LASF4:
+ 1637 0137 6C6F6E67 		.string	"long long int"
+ 1637      206C6F6E 
+ 1637      6720696E 
+ 1637      7400
+ 1638              	.LASF24:
+ 1639 0145 6D697865 		.string	"mixed_exp_data"
+ 1639      645F6578 
+ 1639      705F6461 
+ 1639      746100
+ 1640              	.LASF17:
+ 1641 0154 68656174 		.string	"heatmap_cs_RdYlGn_mixed_exp"
+ 1641      6D61705F 
+ 1641      63735F52 
+ 1641      64596C47 
+ 1641      6E5F6D69 
+ 1642              	.LASF22:
+ 1643 0170 6D697865 		.string	"mixed_data"
+ 1643      645F6461 
+ 1643      746100
+ 1644              	.LASF2:
+ 1645 017b 6C6F6E67 		.string	"long int"
+ 1645      20696E74 
+ 1645      00
+ 1646              	.LASF5:
+ 1647 0184 6C6F6E67 		.string	"long double"
+GAS LISTING /tmp/ccTNyrIS.s 			page 64
+
+
+ 1647      20646F75 
+ 1647      626C6500 
+ 1648              	.LASF18:
+ 1649 0190 64697363 		.string	"discrete_data"
+ 1649      72657465 
+ 1649      5F646174 
+ 1649      6100
+ 1650              	.LASF21:
+ 1651 019e 736F6674 		.string	"soft"
+ 1651      00
+ 1652              	.LASF9:
+ 1653 01a3 636F6C6F 		.string	"colors"
+ 1653      727300
+ 1654              		.section	.debug_line_str,"MS",@progbits,1
+ 1655              	.LASF1:
+ 1656 0000 2F726F6F 		.string	"/root/repo"
+ 1656      742F7265 
+ 1656      706F00
+ 1657              	.LASF0:
+ 1658 000b 636F6C6F 		.string	"colorschemes/RdYlGn.c"
+ 1658      72736368 
+ 1658      656D6573 
+ 1658      2F526459 
+ 1658      6C476E2E 
+ 1659              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1660 0021 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1660      742F7265 
+ 1660      706F0063 
+ 1660      6F6C6F72 
+ 1660      73636865 
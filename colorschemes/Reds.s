@@ -0,0 +1,4047 @@
+GAS LISTING /tmp/ccmDVY4F.s 			page 1
+
+
+   1              		.file	"Reds.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/Reds.c"
+   5              		.globl	heatmap_cs_Reds_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_Reds_mixed_exp, @object
+   9              		.size	heatmap_cs_Reds_mixed_exp, 8
+  10              	heatmap_cs_Reds_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 6600     		.string	"f"
+  29 0006 0C00     		.string	"\f"
+  30 0008 6A00     		.string	"j"
+  31 000a 0D186E00 		.string	"\r\030n"
+  32 000e 0E317201 		.ascii	"\0161r\001\017Ju\001\017cy\002\020|}\003\020\225\215\007\022"
+  32      0F4A7501 
+  32      0F637902 
+  32      107C7D03 
+  32      10958D07 
+  33 0023 AE910813 		.ascii	"\256\221\b\023\307\224\t\023\340\230\n\024\371\233\013\024\377"
+  33      C7940913 
+  33      E0980A14 
+  33      F99B0B14 
+  33      FF
+  34 0034 9F0C14FF 		.ascii	"\237\f\024\377\242\016\024\377\245\017\025\377\247\017\025\377"
+  34      A20E14FF 
+  34      A50F15FF 
+  34      A70F15FF 
+  35 0044 A91016FF 		.ascii	"\251\020\026\377\253\020\026\377\256\021\026\377\260\021\027"
+  35      AB1016FF 
+  35      AE1116FF 
+  35      B01117
+  36 0053 FFB11217 		.ascii	"\377\261\022\027\377\263\022\030\377\275\024\032\377\277\025"
+  36      FFB31218 
+  36      FFBD141A 
+  36      FFBF15
+  37 0062 1AFFC115 		.ascii	"\032\377\301\025\032\377\303\026\033\377\305\026\033\377\307"
+GAS LISTING /tmp/ccmDVY4F.s 			page 2
+
+
+  37      1AFFC316 
+  37      1BFFC516 
+  37      1BFFC7
+  38 0071 171CFFC9 		.ascii	"\027\034\377\311\027\034\377\312\027\034\377\314\032\035\377"
+  38      171CFFCA 
+  38      171CFFCC 
+  38      1A1DFF
+  39 0080 CE1C1EFF 		.ascii	"\316\034\036\377\320\035\037\377\321\037\037\377\323! \377\325"
+  39      D01D1FFF 
+  39      D11F1FFF 
+  39      D32120FF 
+  39      D5
+  40 0091 2321FFD6 		.ascii	"#!\377\326$!\377\330&\"\377\341.&\377\3420&\377\3441'\377\345"
+  40      2421FFD8 
+  40      2622FFE1 
+  40      2E26FFE2 
+  40      3026FFE4 
+  41 00a9 3328FFE7 		.ascii	"3(\377\3474(\377\3505)\377\3527*\377\3538*\377\3559+\377\356"
+  41      3428FFE8 
+  41      3529FFEA 
+  41      372AFFEB 
+  41      382AFFED 
+  42 00c1 3A2BFFEF 		.ascii	":+\377\357=-\377\360?.\377\360A/\377\361C0\377\361E1\377\361"
+  42      3D2DFFF0 
+  42      3F2EFFF0 
+  42      412FFFF1 
+  42      4330FFF1 
+  43 00d9 4732FFF2 		.ascii	"G2\377\362I3\377\362K5\377\363M6\377\363O7\377\366Z>\377\367"
+  43      4933FFF2 
+  43      4B35FFF3 
+  43      4D36FFF3 
+  43      4F37FFF6 
+  44 00f1 5B3FFFF7 		.ascii	"[?\377\367]@\377\367^A\377\370`B\377\370bC\377\371cE\377\371"
+  44      5D40FFF7 
+  44      5E41FFF8 
+  44      6042FFF8 
+  44      6243FFF9 
+  45 0109 6446FFFA 		.ascii	"dF\377\372fG\377\372gH\377\372iI\377\373jJ\377\373lK\377\373"
+  45      6647FFFA 
+  45      6748FFFA 
+  45      6949FFFB 
+  45      6A4AFFFB 
+  46 0121 6D4DFFFB 		.ascii	"mM\377\373nN\377\373pO\377\373qP\377\373rR\377\373tS\377\373"
+  46      6E4EFFFB 
+  46      704FFFFB 
+  46      7150FFFB 
+  46      7252FFFB 
+  47 0139 7554FFFB 		.ascii	"uT\377\373vU\377\373wV\377\373yX\377\373zY\377\373\203b\377\373"
+  47      7655FFFB 
+  47      7756FFFB 
+  47      7958FFFB 
+  47      7A59FFFB 
+  48 0151 8463FFFC 		.ascii	"\204c\377\374\205d\377\374\206f\377\374\210g\377\374\211h\377"
+  48      8564FFFC 
+  48      8666FFFC 
+  48      8867FFFC 
+  48      8968FF
+GAS LISTING /tmp/ccmDVY4F.s 			page 3
+
+
+  49 0164 FC8A69FF 		.ascii	"\374\212i\377\374\213j\377\374\214k\377\374\215l\377\374\216"
+  49      FC8B6AFF 
+  49      FC8C6BFF 
+  49      FC8D6CFF 
+  49      FC8E
+  50 0176 6DFFFC8F 		.ascii	"m\377\374\217o\377\374\220p\377\374\221q\377\374\222r\377\374"
+  50      6FFFFC90 
+  50      70FFFC91 
+  50      71FFFC92 
+  50      72FFFC
+  51 0189 9373FFFC 		.ascii	"\223s\377\374\224t\377\374\225u\377\374\226v\377\374\227w\377"
+  51      9474FFFC 
+  51      9575FFFC 
+  51      9676FFFC 
+  51      9777FF
+  52 019c FC9879FF 		.ascii	"\374\230y\377\374\231z\377\374\232{\377\374\233|\377\374\234"
+  52      FC997AFF 
+  52      FC9A7BFF 
+  52      FC9B7CFF 
+  52      FC9C
+  53 01ae 7DFFFC9D 		.ascii	"}\377\374\235~\377\374\236\177\377\374\237\200\377\374\240\201"
+  53      7EFFFC9E 
+  53      7FFFFC9F 
+  53      80FFFCA0 
+  53      81
+  54 01bf FFFCA182 		.ascii	"\377\374\241\202\377\374\242\203\377\374\253\216\377\374\254"
+  54      FFFCA283 
+  54      FFFCAB8E 
+  54      FFFCAC
+  55 01ce 8FFFFCAD 		.ascii	"\217\377\374\255\220\377\374\256\221\377\374\256\222\377\374"
+  55      90FFFCAE 
+  55      91FFFCAE 
+  55      92FFFC
+  56 01dd AF93FFFC 		.ascii	"\257\223\377\374\260\224\377\374\261\225\377\374\262\226\377"
+  56      B094FFFC 
+  56      B195FFFC 
+  56      B296FF
+  57 01ec FCB397FF 		.ascii	"\374\263\227\377\374\263\230\377\374\264\231\377\374\265\231"
+  57      FCB398FF 
+  57      FCB499FF 
+  57      FCB599
+  58 01fb FFFCB69A 		.ascii	"\377\374\266\232\377\374\266\233\377\374\267\234\377\374\270"
+  58      FFFCB69B 
+  58      FFFCB79C 
+  58      FFFCB8
+  59 020a 9DFFFCB9 		.ascii	"\235\377\374\271\236\377\374\271\237\377\374\272\240\377\374"
+  59      9EFFFCB9 
+  59      9FFFFCBA 
+  59      A0FFFC
+  60 0219 BBA1FFFC 		.ascii	"\273\241\377\374\273\242\377\374\274\243\377\374\275\243\377"
+  60      BBA2FFFC 
+  60      BCA3FFFC 
+  60      BDA3FF
+  61 0228 FCBDA4FF 		.ascii	"\374\275\244\377\374\276\245\377\374\277\246\377\374\277\247"
+  61      FCBEA5FF 
+  61      FCBFA6FF 
+  61      FCBFA7
+GAS LISTING /tmp/ccmDVY4F.s 			page 4
+
+
+  62 0237 FFFCC0A7 		.ascii	"\377\374\300\247\377\374\301\250\377\374\301\251\377\374\302"
+  62      FFFCC1A8 
+  62      FFFCC1A9 
+  62      FFFCC2
+  63 0246 AAFFFCC2 		.ascii	"\252\377\374\302\252\377\374\303\253\377\374\304\254\377\374"
+  63      AAFFFCC3 
+  63      ABFFFCC4 
+  63      ACFFFC
+  64 0255 C4ADFFFC 		.ascii	"\304\255\377\374\305\255\377\374\305\256\377\374\306\257\377"
+  64      C5ADFFFC 
+  64      C5AEFFFC 
+  64      C6AFFF
+  65 0264 FCC6B0FF 		.ascii	"\374\306\260\377\374\307\260\377\375\307\261\377\375\310\262"
+  65      FCC7B0FF 
+  65      FDC7B1FF 
+  65      FDC8B2
+  66 0273 FFFDC8B2 		.ascii	"\377\375\310\262\377\375\311\263\377\375\321\275\377\375\321"
+  66      FFFDC9B3 
+  66      FFFDD1BD 
+  66      FFFDD1
+  67 0282 BEFFFDD2 		.ascii	"\276\377\375\322\277\377\375\322\277\377\375\323\300\377\375"
+  67      BFFFFDD2 
+  67      BFFFFDD3 
+  67      C0FFFD
+  68 0291 D3C1FFFD 		.ascii	"\323\301\377\375\324\301\377\375\324\302\377\375\325\303\377"
+  68      D4C1FFFD 
+  68      D4C2FFFD 
+  68      D5C3FF
+  69 02a0 FDD5C3FF 		.ascii	"\375\325\303\377\375\326\304\377\375\326\305\377\375\327\305"
+  69      FDD6C4FF 
+  69      FDD6C5FF 
+  69      FDD7C5
+  70 02af FFFDD7C6 		.ascii	"\377\375\327\306\377\375\330\306\377\375\330\307\377\375\330"
+  70      FFFDD8C6 
+  70      FFFDD8C7 
+  70      FFFDD8
+  71 02be C8FFFDD9 		.ascii	"\310\377\375\331\310\377\375\331\311\377\375\332\311\377\375"
+  71      C8FFFDD9 
+  71      C9FFFDDA 
+  71      C9FFFD
+  72 02cd DACAFFFD 		.ascii	"\332\312\377\375\332\312\377\375\333\313\377\375\333\314\377"
+  72      DACAFFFD 
+  72      DBCBFFFD 
+  72      DBCCFF
+  73 02dc FDDCCCFF 		.ascii	"\375\334\314\377\375\334\315\377\375\334\315\377\375\335\316"
+  73      FDDCCDFF 
+  73      FDDCCDFF 
+  73      FDDDCE
+  74 02eb FFFDDDCE 		.ascii	"\377\375\335\316\377\375\336\317\377\375\336\317\377\375\336"
+  74      FFFDDECF 
+  74      FFFDDECF 
+  74      FFFDDE
+  75 02fa D0FFFDDF 		.ascii	"\320\377\375\337\320\377\375\337\321\377\375\337\321\377\376"
+  75      D0FFFDDF 
+  75      D1FFFDDF 
+  75      D1FFFE
+  76 0309 E0D2FFFE 		.ascii	"\340\322\377\376\340\322\377\376\340\322\377\376\340\323\377"
+GAS LISTING /tmp/ccmDVY4F.s 			page 5
+
+
+  76      E0D2FFFE 
+  76      E0D2FFFE 
+  76      E0D3FF
+  77 0318 FEE0D3FF 		.ascii	"\376\340\323\377\376\341\323\377\376\341\323\377\376\341\324"
+  77      FEE1D3FF 
+  77      FEE1D3FF 
+  77      FEE1D4
+  78 0327 FFFEE1D4 		.ascii	"\377\376\341\324\377\376\341\324\377\376\342\324\377\376\342"
+  78      FFFEE1D4 
+  78      FFFEE2D4 
+  78      FFFEE2
+  79 0336 D5FFFEE2 		.ascii	"\325\377\376\342\325\377\376\342\325\377\376\342\325\377\376"
+  79      D5FFFEE2 
+  79      D5FFFEE2 
+  79      D5FFFE
+  80 0345 E2D6FFFE 		.ascii	"\342\326\377\376\343\326\377\376\343\326\377\376\343\326\377"
+  80      E3D6FFFE 
+  80      E3D6FFFE 
+  80      E3D6FF
+  81 0354 FEE3D7FF 		.ascii	"\376\343\327\377\376\343\327\377\376\343\327\377\376\344\327"
+  81      FEE3D7FF 
+  81      FEE3D7FF 
+  81      FEE4D7
+  82 0363 FFFEE4D7 		.ascii	"\377\376\344\327\377\376\344\330\377\376\344\330\377\376\344"
+  82      FFFEE4D8 
+  82      FFFEE4D8 
+  82      FFFEE4
+  83 0372 D8FFFEE4 		.ascii	"\330\377\376\344\330\377\376\344\330\377\376\345\331\377\376"
+  83      D8FFFEE4 
+  83      D8FFFEE5 
+  83      D9FFFE
+  84 0381 E5D9FFFE 		.ascii	"\345\331\377\376\345\331\377\376\345\331\377\376\345\331\377"
+  84      E5D9FFFE 
+  84      E5D9FFFE 
+  84      E5D9FF
+  85 0390 FEE5DAFF 		.ascii	"\376\345\332\377\376\345\332\377\376\346\332\377\376\346\332"
+  85      FEE5DAFF 
+  85      FEE6DAFF 
+  85      FEE6DA
+  86 039f FFFEE6DA 		.ascii	"\377\376\346\332\377\376\346\333\377\376\346\333\377\376\346"
+  86      FFFEE6DB 
+  86      FFFEE6DB 
+  86      FFFEE6
+  87 03ae DBFFFEE6 		.ascii	"\333\377\376\346\333\377\376\347\333\377\376\347\334\377\376"
+  87      DBFFFEE7 
+  87      DBFFFEE7 
+  87      DCFFFE
+  88 03bd E7DCFFFE 		.ascii	"\347\334\377\376\347\334\377\376\347\334\377\376\347\334\377"
+  88      E7DCFFFE 
+  88      E7DCFFFE 
+  88      E7DCFF
+  89 03cc FEE7DCFF 		.ascii	"\376\347\334\377\376\347\335\377\376\347\335\377\376\350\335"
+  89      FEE7DDFF 
+  89      FEE7DDFF 
+  89      FEE8DD
+  90 03db FFFEE8DD 		.ascii	"\377\376\350\335\377\376\350\335\377\376\354\343\377\376\354"
+  90      FFFEE8DD 
+GAS LISTING /tmp/ccmDVY4F.s 			page 6
+
+
+  90      FFFEECE3 
+  90      FFFEEC
+  91 03ea E4FFFEEC 		.ascii	"\344\377\376\354\344\377\376\354\344\377\376\355\344\377\376"
+  91      E4FFFEEC 
+  91      E4FFFEED 
+  91      E4FFFE
+  92 03f9 EDE4FFFE 		.ascii	"\355\344\377\376\355\344\377\376\355\344\377\376\355\345\377"
+  92      EDE4FFFE 
+  92      EDE4FFFE 
+  92      EDE5FF
+  93 0408 FEEDE5FF 		.ascii	"\376\355\345\377\376\355\345\377\376\355\345\377\376\355\345"
+  93      FEEDE5FF 
+  93      FEEDE5FF 
+  93      FEEDE5
+  94 0417 FFFEEDE5 		.ascii	"\377\376\355\345\377\376\356\345\377\376\356\345\377\376\356"
+  94      FFFEEEE5 
+  94      FFFEEEE5 
+  94      FFFEEE
+  95 0426 E6FFFEEE 		.ascii	"\346\377\376\356\346\377\376\356\346\377\376\356\346\377\376"
+  95      E6FFFEEE 
+  95      E6FFFEEE 
+  95      E6FFFE
+  96 0435 EEE6FFFE 		.ascii	"\356\346\377\376\356\346\377\376\356\346\377\376\356\346\377"
+  96      EEE6FFFE 
+  96      EEE6FFFE 
+  96      EEE6FF
+  97 0444 FEEEE7FF 		.ascii	"\376\356\347\377\376\356\347\377\376\357\347\377\376\357\347"
+  97      FEEEE7FF 
+  97      FEEFE7FF 
+  97      FEEFE7
+  98 0453 FFFEEFE7 		.ascii	"\377\376\357\347\377\376\357\347\377\376\357\347\377\376\357"
+  98      FFFEEFE7 
+  98      FFFEEFE7 
+  98      FFFEEF
+  99 0462 E7FFFEEF 		.ascii	"\347\377\376\357\347\377\376\357\350\377\376\357\350\377\376"
+  99      E7FFFEEF 
+  99      E8FFFEEF 
+  99      E8FFFE
+ 100 0471 EFE8FFFE 		.ascii	"\357\350\377\376\357\350\377\376\357\350\377\376\357\350\377"
+ 100      EFE8FFFE 
+ 100      EFE8FFFE 
+ 100      EFE8FF
+ 101 0480 FEF0E8FF 		.ascii	"\376\360\350\377\376\360\350\377\376\360\350\377\376\360\350"
+ 101      FEF0E8FF 
+ 101      FEF0E8FF 
+ 101      FEF0E8
+ 102 048f FFFEF0E9 		.ascii	"\377\376\360\351\377\376\360\351\377\376\360\351\377\376\360"
+ 102      FFFEF0E9 
+ 102      FFFEF0E9 
+ 102      FFFEF0
+ 103 049e E9FFFEF0 		.ascii	"\351\377\376\360\351\377\376\360\351\377\376\360\351\377\376"
+ 103      E9FFFEF0 
+ 103      E9FFFEF0 
+ 103      E9FFFE
+ 104 04ad F0E9FFFE 		.ascii	"\360\351\377\376\360\351\377\376\360\351\377\376\360\351\377"
+ 104      F0E9FFFE 
+ 104      F0E9FFFE 
+GAS LISTING /tmp/ccmDVY4F.s 			page 7
+
+
+ 104      F0E9FF
+ 105 04bc FEF0EAFF 		.ascii	"\376\360\352\377\376\360\352\377\376\361\352\377\376\361\352"
+ 105      FEF0EAFF 
+ 105      FEF1EAFF 
+ 105      FEF1EA
+ 106 04cb FFFEF1EA 		.ascii	"\377\376\361\352\377\376\361\352\377\376\361\352\377\376\361"
+ 106      FFFEF1EA 
+ 106      FFFEF1EA 
+ 106      FFFEF1
+ 107 04da EAFFFEF1 		.ascii	"\352\377\376\361\352\377\376\361\352\377\376\361\352\377\376"
+ 107      EAFFFEF1 
+ 107      EAFFFEF1 
+ 107      EAFFFE
+ 108 04e9 F1EAFFFE 		.ascii	"\361\352\377\376\361\352\377\376\361\353\377\376\361\353\377"
+ 108      F1EAFFFE 
+ 108      F1EBFFFE 
+ 108      F1EBFF
+ 109 04f8 FEF1EBFF 		.ascii	"\376\361\353\377\376\361\353\377\376\361\353\377\376\361\353"
+ 109      FEF1EBFF 
+ 109      FEF1EBFF 
+ 109      FEF1EB
+ 110 0507 FFFEF1EB 		.ascii	"\377\376\361\353\377\376\361\353\377\376\361\353\377\376\362"
+ 110      FFFEF1EB 
+ 110      FFFEF1EB 
+ 110      FFFEF2
+ 111 0516 EBFFFEF2 		.ascii	"\353\377\376\362\353\377\376\362\353\377\376\362\353\377\376"
+ 111      EBFFFEF2 
+ 111      EBFFFEF2 
+ 111      EBFFFE
+ 112 0525 F2EBFFFE 		.ascii	"\362\353\377\376\362\353\377\376\362\353\377\376\362\354\377"
+ 112      F2EBFFFE 
+ 112      F2EBFFFE 
+ 112      F2ECFF
+ 113 0534 FEF2ECFF 		.ascii	"\376\362\354\377\376\362\354\377\376\362\354\377\376\362\354"
+ 113      FEF2ECFF 
+ 113      FEF2ECFF 
+ 113      FEF2EC
+ 114 0543 FFFEF2EC 		.ascii	"\377\376\362\354\377\376\362\354\377\376\362\354\377\376\362"
+ 114      FFFEF2EC 
+ 114      FFFEF2EC 
+ 114      FFFEF2
+ 115 0552 ECFFFEF2 		.ascii	"\354\377\376\362\354\377\376\362\354\377\376\362\354\377\376"
+ 115      ECFFFEF2 
+ 115      ECFFFEF2 
+ 115      ECFFFE
+ 116 0561 F2ECFFFE 		.ascii	"\362\354\377\376\362\354\377\376\362\354\377\376\362\354\377"
+ 116      F2ECFFFE 
+ 116      F2ECFFFE 
+ 116      F2ECFF
+ 117 0570 FEF2ECFF 		.ascii	"\376\362\354\377\376\362\354\377\376\362\354\377\376\362\355"
+ 117      FEF2ECFF 
+ 117      FEF2ECFF 
+ 117      FEF2ED
+ 118 057f FFFEF2ED 		.ascii	"\377\376\362\355\377\376\363\355\377\376\363\355\377\376\363"
+ 118      FFFEF3ED 
+ 118      FFFEF3ED 
+ 118      FFFEF3
+GAS LISTING /tmp/ccmDVY4F.s 			page 8
+
+
+ 119 058e EDFFFEF3 		.ascii	"\355\377\376\363\355\377\376\363\355\377\376\363\355\377\376"
+ 119      EDFFFEF3 
+ 119      EDFFFEF3 
+ 119      EDFFFE
+ 120 059d F3EDFFFE 		.ascii	"\363\355\377\376\363\355\377\376\363\355\377\376\363\355\377"
+ 120      F3EDFFFE 
+ 120      F3EDFFFE 
+ 120      F3EDFF
+ 121 05ac FEF3EDFF 		.ascii	"\376\363\355\377\376\363\355\377\376\363\355\377\376\363\355"
+ 121      FEF3EDFF 
+ 121      FEF3EDFF 
+ 121      FEF3ED
+ 122 05bb FFFEF3ED 		.ascii	"\377\376\363\355\377\376\363\355\377\376\363\355\377\376\363"
+ 122      FFFEF3ED 
+ 122      FFFEF3ED 
+ 122      FFFEF3
+ 123 05ca EDFFFEF3 		.ascii	"\355\377\376\363\355\377\376\363\355\377\376\363\355\377\376"
+ 123      EDFFFEF3 
+ 123      EDFFFEF3 
+ 123      EDFFFE
+ 124 05d9 F3EDFFFE 		.ascii	"\363\355\377\376\363\355\377\376\363\355\377\376\363\355\377"
+ 124      F3EDFFFE 
+ 124      F3EDFFFE 
+ 124      F3EDFF
+ 125 05e8 FEF3EEFF 		.ascii	"\376\363\356\377\376\363\356\377\376\363\356\377\376\363\356"
+ 125      FEF3EEFF 
+ 125      FEF3EEFF 
+ 125      FEF3EE
+ 126 05f7 FFFEF3EE 		.ascii	"\377\376\363\356\377\376\363\356\377\376\363\356\377\376\363"
+ 126      FFFEF3EE 
+ 126      FFFEF3EE 
+ 126      FFFEF3
+ 127 0606 EEFFFEF3 		.ascii	"\356\377\376\363\356\377\376\363\356\377\376\363\356\377\376"
+ 127      EEFFFEF3 
+ 127      EEFFFEF3 
+ 127      EEFFFE
+ 128 0615 F3EEFFFE 		.ascii	"\363\356\377\376\363\356\377\376\363\356\377\376\363\356\377"
+ 128      F3EEFFFE 
+ 128      F3EEFFFE 
+ 128      F3EEFF
+ 129 0624 FEF3EEFF 		.ascii	"\376\363\356\377\376\363\356\377\376\363\356\377\376\363\356"
+ 129      FEF3EEFF 
+ 129      FEF3EEFF 
+ 129      FEF3EE
+ 130 0633 FFFEF3EE 		.ascii	"\377\376\363\356\377\376\364\356\377\376\364\356\377\376\364"
+ 130      FFFEF4EE 
+ 130      FFFEF4EE 
+ 130      FFFEF4
+ 131 0642 EEFFFEF4 		.ascii	"\356\377\376\364\356\377\376\364\356\377\376\364\356\377\376"
+ 131      EEFFFEF4 
+ 131      EEFFFEF4 
+ 131      EEFFFE
+ 132 0651 F4EEFFFE 		.ascii	"\364\356\377\376\364\356\377\376\364\356\377\376\364\356\377"
+ 132      F4EEFFFE 
+ 132      F4EEFFFE 
+ 132      F4EEFF
+ 133 0660 FEF4EEFF 		.ascii	"\376\364\356\377\376\364\356\377\376\364\356\377\376\364\356"
+GAS LISTING /tmp/ccmDVY4F.s 			page 9
+
+
+ 133      FEF4EEFF 
+ 133      FEF4EEFF 
+ 133      FEF4EE
+ 134 066f FFFEF4EE 		.ascii	"\377\376\364\356\377\376\364\356\377\376\364\356\377\376\364"
+ 134      FFFEF4EE 
+ 134      FFFEF4EE 
+ 134      FFFEF4
+ 135 067e EEFFFEF4 		.ascii	"\356\377\376\364\356\377\376\364\356\377\376\364\356\377\376"
+ 135      EEFFFEF4 
+ 135      EEFFFEF4 
+ 135      EEFFFE
+ 136 068d F4EEFFFE 		.ascii	"\364\356\377\376\364\356\377\376\364\356\377\376\364\357\377"
+ 136      F4EEFFFE 
+ 136      F4EEFFFE 
+ 136      F4EFFF
+ 137 069c FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 137      FEF4EFFF 
+ 137      FEF4EFFF 
+ 137      FEF4EF
+ 138 06ab FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 138      FFFEF4EF 
+ 138      FFFEF4EF 
+ 138      FFFEF4
+ 139 06ba EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 139      EFFFFEF4 
+ 139      EFFFFEF4 
+ 139      EFFFFE
+ 140 06c9 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 140      F4EFFFFE 
+ 140      F4EFFFFE 
+ 140      F4EFFF
+ 141 06d8 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 141      FEF4EFFF 
+ 141      FEF4EFFF 
+ 141      FEF4EF
+ 142 06e7 FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 142      FFFEF4EF 
+ 142      FFFEF4EF 
+ 142      FFFEF4
+ 143 06f6 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 143      EFFFFEF4 
+ 143      EFFFFEF4 
+ 143      EFFFFE
+ 144 0705 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 144      F4EFFFFE 
+ 144      F4EFFFFE 
+ 144      F4EFFF
+ 145 0714 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 145      FEF4EFFF 
+ 145      FEF4EFFF 
+ 145      FEF4EF
+ 146 0723 FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 146      FFFEF4EF 
+ 146      FFFEF4EF 
+ 146      FFFEF4
+ 147 0732 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 147      EFFFFEF4 
+GAS LISTING /tmp/ccmDVY4F.s 			page 10
+
+
+ 147      EFFFFEF4 
+ 147      EFFFFE
+ 148 0741 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 148      F4EFFFFE 
+ 148      F4EFFFFE 
+ 148      F4EFFF
+ 149 0750 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 149      FEF4EFFF 
+ 149      FEF4EFFF 
+ 149      FEF4EF
+ 150 075f FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 150      FFFEF4EF 
+ 150      FFFEF4EF 
+ 150      FFFEF4
+ 151 076e EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 151      EFFFFEF4 
+ 151      EFFFFEF4 
+ 151      EFFFFE
+ 152 077d F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 152      F4EFFFFE 
+ 152      F4EFFFFE 
+ 152      F4EFFF
+ 153 078c FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 153      FEF4EFFF 
+ 153      FEF4EFFF 
+ 153      FEF4EF
+ 154 079b FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 154      FFFEF4EF 
+ 154      FFFEF4EF 
+ 154      FFFEF4
+ 155 07aa EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 155      EFFFFEF4 
+ 155      EFFFFEF4 
+ 155      EFFFFE
+ 156 07b9 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 156      F4EFFFFE 
+ 156      F4EFFFFE 
+ 156      F4EFFF
+ 157 07c8 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377"
+ 157      FEF4EFFF 
+ 158 07d0 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 158      FEF4EFFF 
+ 158      FEF4EFFF 
+ 158      FEF4EF
+ 159 07df FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 159      FFFEF4EF 
+ 159      FFFEF4EF 
+ 159      FFFEF4
+ 160 07ee EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 160      EFFFFEF4 
+ 160      EFFFFEF4 
+ 160      EFFFFE
+ 161 07fd F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 161      F4EFFFFE 
+ 161      F4EFFFFE 
+ 161      F4EFFF
+ 162 080c FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+GAS LISTING /tmp/ccmDVY4F.s 			page 11
+
+
+ 162      FEF4EFFF 
+ 162      FEF4EFFF 
+ 162      FEF4EF
+ 163 081b FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 163      FFFEF4EF 
+ 163      FFFEF4EF 
+ 163      FFFEF4
+ 164 082a EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 164      EFFFFEF4 
+ 164      EFFFFEF4 
+ 164      EFFFFE
+ 165 0839 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 165      F4EFFFFE 
+ 165      F4EFFFFE 
+ 165      F4EFFF
+ 166 0848 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 166      FEF4EFFF 
+ 166      FEF4EFFF 
+ 166      FEF4EF
+ 167 0857 FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 167      FFFEF4EF 
+ 167      FFFEF4EF 
+ 167      FFFEF4
+ 168 0866 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 168      EFFFFEF4 
+ 168      EFFFFEF4 
+ 168      EFFFFE
+ 169 0875 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 169      F4EFFFFE 
+ 169      F4EFFFFE 
+ 169      F4EFFF
+ 170 0884 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 170      FEF4EFFF 
+ 170      FEF4EFFF 
+ 170      FEF4EF
+ 171 0893 FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 171      FFFEF4EF 
+ 171      FFFEF4EF 
+ 171      FFFEF4
+ 172 08a2 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 172      EFFFFEF4 
+ 172      EFFFFEF4 
+ 172      EFFFFE
+ 173 08b1 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 173      F4EFFFFE 
+ 173      F4EFFFFE 
+ 173      F4EFFF
+ 174 08c0 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 174      FEF4EFFF 
+ 174      FEF4EFFF 
+ 174      FEF4EF
+ 175 08cf FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 175      FFFEF4EF 
+ 175      FFFEF4EF 
+ 175      FFFEF4
+ 176 08de EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 176      EFFFFEF4 
+GAS LISTING /tmp/ccmDVY4F.s 			page 12
+
+
+ 176      EFFFFEF4 
+ 176      EFFFFE
+ 177 08ed F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 177      F4EFFFFE 
+ 177      F4EFFFFE 
+ 177      F4EFFF
+ 178 08fc FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 178      FEF4EFFF 
+ 178      FEF4EFFF 
+ 178      FEF4EF
+ 179 090b FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 179      FFFEF4EF 
+ 179      FFFEF4EF 
+ 179      FFFEF4
+ 180 091a EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 180      EFFFFEF4 
+ 180      EFFFFEF4 
+ 180      EFFFFE
+ 181 0929 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 181      F4EFFFFE 
+ 181      F4EFFFFE 
+ 181      F4EFFF
+ 182 0938 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 182      FEF4EFFF 
+ 182      FEF4EFFF 
+ 182      FEF4EF
+ 183 0947 FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 183      FFFEF4EF 
+ 183      FFFEF4EF 
+ 183      FFFEF4
+ 184 0956 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 184      EFFFFEF4 
+ 184      EFFFFEF4 
+ 184      EFFFFE
+ 185 0965 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 185      F4EFFFFE 
+ 185      F4EFFFFE 
+ 185      F4EFFF
+ 186 0974 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 186      FEF4EFFF 
+ 186      FEF4EFFF 
+ 186      FEF4EF
+ 187 0983 FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 187      FFFEF4EF 
+ 187      FFFEF4EF 
+ 187      FFFEF4
+ 188 0992 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 188      EFFFFEF4 
+ 188      EFFFFEF4 
+ 188      EFFFFE
+ 189 09a1 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 189      F4EFFFFE 
+ 189      F4EFFFFE 
+ 189      F4EFFF
+ 190 09b0 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 190      FEF4EFFF 
+ 190      FEF4EFFF 
+GAS LISTING /tmp/ccmDVY4F.s 			page 13
+
+
+ 190      FEF4EF
+ 191 09bf FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 191      FFFEF4EF 
+ 191      FFFEF4EF 
+ 191      FFFEF4
+ 192 09ce EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 192      EFFFFEF4 
+ 192      EFFFFEF4 
+ 192      EFFFFE
+ 193 09dd F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 193      F4EFFFFE 
+ 193      F4EFFFFE 
+ 193      F4EFFF
+ 194 09ec FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 194      FEF4EFFF 
+ 194      FEF4EFFF 
+ 194      FEF4EF
+ 195 09fb FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 195      FFFEF4EF 
+ 195      FFFEF4EF 
+ 195      FFFEF4
+ 196 0a0a EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 196      EFFFFEF4 
+ 196      EFFFFEF4 
+ 196      EFFFFE
+ 197 0a19 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 197      F4EFFFFE 
+ 197      F4EFFFFE 
+ 197      F4EFFF
+ 198 0a28 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 198      FEF4EFFF 
+ 198      FEF4EFFF 
+ 198      FEF4EF
+ 199 0a37 FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 199      FFFEF4EF 
+ 199      FFFEF4EF 
+ 199      FFFEF4
+ 200 0a46 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 200      EFFFFEF4 
+ 200      EFFFFEF4 
+ 200      EFFFFE
+ 201 0a55 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 201      F4EFFFFE 
+ 201      F4EFFFFE 
+ 201      F4EFFF
+ 202 0a64 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 202      FEF4EFFF 
+ 202      FEF4EFFF 
+ 202      FEF4EF
+ 203 0a73 FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 203      FFFEF4EF 
+ 203      FFFEF4EF 
+ 203      FFFEF4
+ 204 0a82 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 204      EFFFFEF4 
+ 204      EFFFFEF4 
+ 204      EFFFFE
+GAS LISTING /tmp/ccmDVY4F.s 			page 14
+
+
+ 205 0a91 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 205      F4EFFFFE 
+ 205      F4EFFFFE 
+ 205      F4EFFF
+ 206 0aa0 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 206      FEF4EFFF 
+ 206      FEF4EFFF 
+ 206      FEF4EF
+ 207 0aaf FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 207      FFFEF4EF 
+ 207      FFFEF4EF 
+ 207      FFFEF4
+ 208 0abe EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 208      EFFFFEF4 
+ 208      EFFFFEF4 
+ 208      EFFFFE
+ 209 0acd F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 209      F4EFFFFE 
+ 209      F4EFFFFE 
+ 209      F4EFFF
+ 210 0adc FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 210      FEF4EFFF 
+ 210      FEF4EFFF 
+ 210      FEF4EF
+ 211 0aeb FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 211      FFFEF4EF 
+ 211      FFFEF4EF 
+ 211      FFFEF4
+ 212 0afa EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 212      EFFFFEF4 
+ 212      EFFFFEF4 
+ 212      EFFFFE
+ 213 0b09 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 213      F4EFFFFE 
+ 213      F4EFFFFE 
+ 213      F4EFFF
+ 214 0b18 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 214      FEF4EFFF 
+ 214      FEF4EFFF 
+ 214      FEF4EF
+ 215 0b27 FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 215      FFFEF4EF 
+ 215      FFFEF4EF 
+ 215      FFFEF4
+ 216 0b36 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 216      EFFFFEF4 
+ 216      EFFFFEF4 
+ 216      EFFFFE
+ 217 0b45 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 217      F4EFFFFE 
+ 217      F4EFFFFE 
+ 217      F4EFFF
+ 218 0b54 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 218      FEF4EFFF 
+ 218      FEF4EFFF 
+ 218      FEF4EF
+ 219 0b63 FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+GAS LISTING /tmp/ccmDVY4F.s 			page 15
+
+
+ 219      FFFEF4EF 
+ 219      FFFEF4EF 
+ 219      FFFEF4
+ 220 0b72 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 220      EFFFFEF4 
+ 220      EFFFFEF4 
+ 220      EFFFFE
+ 221 0b81 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 221      F4EFFFFE 
+ 221      F4EFFFFE 
+ 221      F4EFFF
+ 222 0b90 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 222      FEF4EFFF 
+ 222      FEF4EFFF 
+ 222      FEF4EF
+ 223 0b9f FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 223      FFFEF4EF 
+ 223      FFFEF4EF 
+ 223      FFFEF4
+ 224 0bae EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 224      EFFFFEF4 
+ 224      EFFFFEF4 
+ 224      EFFFFE
+ 225 0bbd F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 225      F4EFFFFE 
+ 225      F4EFFFFE 
+ 225      F4EFFF
+ 226 0bcc FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 226      FEF4EFFF 
+ 226      FEF4EFFF 
+ 226      FEF4EF
+ 227 0bdb FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 227      FFFEF4EF 
+ 227      FFFEF4EF 
+ 227      FFFEF4
+ 228 0bea EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 228      EFFFFEF4 
+ 228      EFFFFEF4 
+ 228      EFFFFE
+ 229 0bf9 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 229      F4EFFFFE 
+ 229      F4EFFFFE 
+ 229      F4EFFF
+ 230 0c08 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 230      FEF4EFFF 
+ 230      FEF4EFFF 
+ 230      FEF4EF
+ 231 0c17 FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 231      FFFEF4EF 
+ 231      FFFEF4EF 
+ 231      FFFEF4
+ 232 0c26 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 232      EFFFFEF4 
+ 232      EFFFFEF4 
+ 232      EFFFFE
+ 233 0c35 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 233      F4EFFFFE 
+GAS LISTING /tmp/ccmDVY4F.s 			page 16
+
+
+ 233      F4EFFFFE 
+ 233      F4EFFF
+ 234 0c44 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 234      FEF4EFFF 
+ 234      FEF4EFFF 
+ 234      FEF4EF
+ 235 0c53 FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 235      FFFEF4EF 
+ 235      FFFEF4EF 
+ 235      FFFEF4
+ 236 0c62 EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 236      EFFFFEF4 
+ 236      EFFFFEF4 
+ 236      EFFFFE
+ 237 0c71 F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 237      F4EFFFFE 
+ 237      F4EFFFFE 
+ 237      F4EFFF
+ 238 0c80 FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 238      FEF4EFFF 
+ 238      FEF4EFFF 
+ 238      FEF4EF
+ 239 0c8f FFFEF4EF 		.ascii	"\377\376\364\357\377\376\364\357\377\376\364\357\377\376\364"
+ 239      FFFEF4EF 
+ 239      FFFEF4EF 
+ 239      FFFEF4
+ 240 0c9e EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377\376\364\357\377\376"
+ 240      EFFFFEF4 
+ 240      EFFFFEF4 
+ 240      EFFFFE
+ 241 0cad F4EFFFFE 		.ascii	"\364\357\377\376\364\357\377\376\364\357\377\376\364\357\377"
+ 241      F4EFFFFE 
+ 241      F4EFFFFE 
+ 241      F4EFFF
+ 242 0cbc FEF4EFFF 		.ascii	"\376\364\357\377\376\364\357\377\376\364\357\377\376\364\357"
+ 242      FEF4EFFF 
+ 242      FEF4EFFF 
+ 242      FEF4EF
+ 243 0ccb FFFEF4EF 		.ascii	"\377\376\364\357\377\376\365\357\377\376\365\357\377\376\365"
+ 243      FFFEF5EF 
+ 243      FFFEF5EF 
+ 243      FFFEF5
+ 244 0cda EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+ 244      EFFFFEF5 
+ 244      EFFFFEF5 
+ 244      EFFFFE
+ 245 0ce9 F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 245      F5EFFFFE 
+ 245      F5EFFFFE 
+ 245      F5EFFF
+ 246 0cf8 FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 246      FEF5EFFF 
+ 246      FEF5EFFF 
+ 246      FEF5EF
+ 247 0d07 FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 247      FFFEF5EF 
+ 247      FFFEF5EF 
+GAS LISTING /tmp/ccmDVY4F.s 			page 17
+
+
+ 247      FFFEF5
+ 248 0d16 EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+ 248      EFFFFEF5 
+ 248      EFFFFEF5 
+ 248      EFFFFE
+ 249 0d25 F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 249      F5EFFFFE 
+ 249      F5EFFFFE 
+ 249      F5EFFF
+ 250 0d34 FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 250      FEF5EFFF 
+ 250      FEF5EFFF 
+ 250      FEF5EF
+ 251 0d43 FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 251      FFFEF5EF 
+ 251      FFFEF5EF 
+ 251      FFFEF5
+ 252 0d52 EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+ 252      EFFFFEF5 
+ 252      EFFFFEF5 
+ 252      EFFFFE
+ 253 0d61 F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 253      F5EFFFFE 
+ 253      F5EFFFFE 
+ 253      F5EFFF
+ 254 0d70 FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 254      FEF5EFFF 
+ 254      FEF5EFFF 
+ 254      FEF5EF
+ 255 0d7f FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 255      FFFEF5EF 
+ 255      FFFEF5EF 
+ 255      FFFEF5
+ 256 0d8e EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+ 256      EFFFFEF5 
+ 256      EFFFFEF5 
+ 256      EFFFFE
+ 257 0d9d F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 257      F5EFFFFE 
+ 257      F5EFFFFE 
+ 257      F5EFFF
+ 258 0dac FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 258      FEF5EFFF 
+ 258      FEF5EFFF 
+ 258      FEF5EF
+ 259 0dbb FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 259      FFFEF5EF 
+ 259      FFFEF5EF 
+ 259      FFFEF5
+ 260 0dca EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+ 260      EFFFFEF5 
+ 260      EFFFFEF5 
+ 260      EFFFFE
+ 261 0dd9 F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 261      F5EFFFFE 
+ 261      F5EFFFFE 
+ 261      F5EFFF
+GAS LISTING /tmp/ccmDVY4F.s 			page 18
+
+
+ 262 0de8 FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 262      FEF5EFFF 
+ 262      FEF5EFFF 
+ 262      FEF5EF
+ 263 0df7 FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 263      FFFEF5EF 
+ 263      FFFEF5EF 
+ 263      FFFEF5
+ 264 0e06 EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+ 264      EFFFFEF5 
+ 264      EFFFFEF5 
+ 264      EFFFFE
+ 265 0e15 F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 265      F5EFFFFE 
+ 265      F5EFFFFE 
+ 265      F5EFFF
+ 266 0e24 FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 266      FEF5EFFF 
+ 266      FEF5EFFF 
+ 266      FEF5EF
+ 267 0e33 FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 267      FFFEF5EF 
+ 267      FFFEF5EF 
+ 267      FFFEF5
+ 268 0e42 EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+ 268      EFFFFEF5 
+ 268      EFFFFEF5 
+ 268      EFFFFE
+ 269 0e51 F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 269      F5EFFFFE 
+ 269      F5EFFFFE 
+ 269      F5EFFF
+ 270 0e60 FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 270      FEF5EFFF 
+ 270      FEF5EFFF 
+ 270      FEF5EF
+ 271 0e6f FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 271      FFFEF5EF 
+ 271      FFFEF5EF 
+ 271      FFFEF5
+ 272 0e7e EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+ 272      EFFFFEF5 
+ 272      EFFFFEF5 
+ 272      EFFFFE
+ 273 0e8d F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 273      F5EFFFFE 
+ 273      F5EFFFFE 
+ 273      F5EFFF
+ 274 0e9c FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 274      FEF5EFFF 
+ 274      FEF5EFFF 
+ 274      FEF5EF
+ 275 0eab FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 275      FFFEF5EF 
+ 275      FFFEF5EF 
+ 275      FFFEF5
+ 276 0eba EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+GAS LISTING /tmp/ccmDVY4F.s 			page 19
+
+
+ 276      EFFFFEF5 
+ 276      EFFFFEF5 
+ 276      EFFFFE
+ 277 0ec9 F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 277      F5EFFFFE 
+ 277      F5EFFFFE 
+ 277      F5EFFF
+ 278 0ed8 FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 278      FEF5EFFF 
+ 278      FEF5EFFF 
+ 278      FEF5EF
+ 279 0ee7 FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 279      FFFEF5EF 
+ 279      FFFEF5EF 
+ 279      FFFEF5
+ 280 0ef6 EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+ 280      EFFFFEF5 
+ 280      EFFFFEF5 
+ 280      EFFFFE
+ 281 0f05 F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 281      F5EFFFFE 
+ 281      F5EFFFFE 
+ 281      F5EFFF
+ 282 0f14 FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 282      FEF5EFFF 
+ 282      FEF5EFFF 
+ 282      FEF5EF
+ 283 0f23 FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 283      FFFEF5EF 
+ 283      FFFEF5EF 
+ 283      FFFEF5
+ 284 0f32 EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+ 284      EFFFFEF5 
+ 284      EFFFFEF5 
+ 284      EFFFFE
+ 285 0f41 F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 285      F5EFFFFE 
+ 285      F5EFFFFE 
+ 285      F5EFFF
+ 286 0f50 FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 286      FEF5EFFF 
+ 286      FEF5EFFF 
+ 286      FEF5EF
+ 287 0f5f FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 287      FFFEF5EF 
+ 287      FFFEF5EF 
+ 287      FFFEF5
+ 288 0f6e EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+ 288      EFFFFEF5 
+ 288      EFFFFEF5 
+ 288      EFFFFE
+ 289 0f7d F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 289      F5EFFFFE 
+ 289      F5EFFFFE 
+ 289      F5EFFF
+ 290 0f8c FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 290      FEF5EFFF 
+GAS LISTING /tmp/ccmDVY4F.s 			page 20
+
+
+ 290      FEF5EFFF 
+ 290      FEF5EF
+ 291 0f9b FFFEF5EF 		.ascii	"\377\376\365\357\377"
+ 291      FF
+ 292 0fa0 FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 292      FEF5EFFF 
+ 292      FEF5EFFF 
+ 292      FEF5EF
+ 293 0faf FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 293      FFFEF5EF 
+ 293      FFFEF5EF 
+ 293      FFFEF5
+ 294 0fbe EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377\376\365\357\377\376"
+ 294      EFFFFEF5 
+ 294      EFFFFEF5 
+ 294      EFFFFE
+ 295 0fcd F5EFFFFE 		.ascii	"\365\357\377\376\365\357\377\376\365\357\377\376\365\357\377"
+ 295      F5EFFFFE 
+ 295      F5EFFFFE 
+ 295      F5EFFF
+ 296 0fdc FEF5EFFF 		.ascii	"\376\365\357\377\376\365\357\377\376\365\357\377\376\365\357"
+ 296      FEF5EFFF 
+ 296      FEF5EFFF 
+ 296      FEF5EF
+ 297 0feb FFFEF5EF 		.ascii	"\377\376\365\357\377\376\365\357\377\376\365\357\377\376\365"
+ 297      FFFEF5EF 
+ 297      FFFEF5EF 
+ 297      FFFEF5
+ 298 0ffa EFFFFEF5 		.ascii	"\357\377\376\365\357\377\376\365\357\377"
+ 298      EFFFFEF5 
+ 298      EFFF
+ 299              		.globl	heatmap_cs_Reds_mixed
+ 300              		.section	.data.rel.local
+ 301              		.align 8
+ 302              		.type	heatmap_cs_Reds_mixed, @object
+ 303              		.size	heatmap_cs_Reds_mixed, 8
+ 304              	heatmap_cs_Reds_mixed:
+ 305 0008 00000000 		.quad	mixed
+ 305      00000000 
+ 306              		.section	.data.rel.ro.local
+ 307              		.align 16
+ 308              		.type	mixed, @object
+ 309              		.size	mixed, 16
+ 310              	mixed:
+ 311 0010 00000000 		.quad	mixed_data
+ 311      00000000 
+ 312 0018 01040000 		.quad	1025
+ 312      00000000 
+ 313              		.section	.rodata
+ 314 1004 00000000 		.align 32
+ 314      00000000 
+ 314      00000000 
+ 314      00000000 
+ 314      00000000 
+ 315              		.type	mixed_data, @object
+ 316              		.size	mixed_data, 4100
+ 317              	mixed_data:
+GAS LISTING /tmp/ccmDVY4F.s 			page 21
+
+
+ 318 1020 00       		.string	""
+ 319 1021 00       		.string	""
+ 320 1022 00       		.string	""
+ 321 1023 00       		.string	""
+ 322 1024 6600     		.string	"f"
+ 323 1026 0C00     		.string	"\f"
+ 324 1028 6700     		.string	"g"
+ 325 102a 0D076700 		.string	"\r\007g"
+ 326 102e 0D0E6800 		.string	"\r\016h"
+ 327 1032 0D166800 		.string	"\r\026h"
+ 328 1036 0D1D6800 		.string	"\r\035h"
+ 329 103a 0D256900 		.string	"\r%i"
+ 330 103e 0D2C6900 		.string	"\r,i"
+ 331 1042 0D346A00 		.string	"\r4j"
+ 332 1046 0D3B6A00 		.string	"\r;j"
+ 333 104a 0D436A00 		.string	"\rCj"
+ 334 104e 0D4A6B00 		.string	"\rJk"
+ 335 1052 0D526B00 		.string	"\rRk"
+ 336 1056 0E596B00 		.string	"\016Yk"
+ 337 105a 0E616C00 		.string	"\016al"
+ 338 105e 0E686C00 		.string	"\016hl"
+ 339 1062 0E706D00 		.string	"\016pm"
+ 340 1066 0E776D00 		.string	"\016wm"
+ 341 106a 0E7F6D00 		.string	"\016\177m"
+ 342 106e 0E866E00 		.string	"\016\206n"
+ 343 1072 0E8D6E00 		.string	"\016\215n"
+ 344 1076 0E956E00 		.string	"\016\225n"
+ 345 107a 0E9C6F00 		.string	"\016\234o"
+ 346 107e 0EA46F00 		.string	"\016\244o"
+ 347 1082 0EAB7001 		.ascii	"\016\253p\001\016\263p\001\017\272p\001\017\302q\001\017\311"
+ 347      0EB37001 
+ 347      0FBA7001 
+ 347      0FC27101 
+ 347      0FC9
+ 348 1094 71010FD1 		.ascii	"q\001\017\321q\001\017\330r\001\017\340r\001\017\347s\001\017"
+ 348      71010FD8 
+ 348      72010FE0 
+ 348      72010FE7 
+ 348      73010F
+ 349 10a7 EF73010F 		.ascii	"\357s\001\017\366s\001\017\376t\001\017\377t\001\017\377u\001"
+ 349      F673010F 
+ 349      FE74010F 
+ 349      FF74010F 
+ 349      FF7501
+ 350 10ba 0FFF7501 		.ascii	"\017\377u\001\017\377u\001\017\377v\001\017\377v\002\020\377"
+ 350      0FFF7501 
+ 350      0FFF7601 
+ 350      0FFF7602 
+ 350      10FF
+ 351 10cc 760210FF 		.ascii	"v\002\020\377w\002\020\377w\002\020\377x\002\020\377x\002\020"
+ 351      770210FF 
+ 351      770210FF 
+ 351      780210FF 
+ 351      780210
+ 352 10df FF780210 		.ascii	"\377x\002\020\377y\002\020\377y\002\020\377z\002\020\377z\002"
+ 352      FF790210 
+ 352      FF790210 
+GAS LISTING /tmp/ccmDVY4F.s 			page 22
+
+
+ 352      FF7A0210 
+ 352      FF7A02
+ 353 10f2 10FF7A02 		.ascii	"\020\377z\002\020\377{\002\020\377{\002\020\377{\003\020\377"
+ 353      10FF7B02 
+ 353      10FF7B02 
+ 353      10FF7B03 
+ 353      10FF
+ 354 1104 7C0310FF 		.ascii	"|\003\020\377|\003\020\377}\003\020\377}\003\020\377}\003\020"
+ 354      7C0310FF 
+ 354      7D0310FF 
+ 354      7D0310FF 
+ 354      7D0310
+ 355 1117 FF7E0311 		.ascii	"\377~\003\021\377~\003\021\377\177\003\021\377\213\006\022\377"
+ 355      FF7E0311 
+ 355      FF7F0311 
+ 355      FF8B0612 
+ 355      FF
+ 356 1128 8C0612FF 		.ascii	"\214\006\022\377\214\006\022\377\215\007\022\377\215\007\022"
+ 356      8C0612FF 
+ 356      8D0712FF 
+ 356      8D0712
+ 357 1137 FF8D0712 		.ascii	"\377\215\007\022\377\216\007\023\377\216\007\023\377\216\007"
+ 357      FF8E0713 
+ 357      FF8E0713 
+ 357      FF8E07
+ 358 1146 13FF8F07 		.ascii	"\023\377\217\007\023\377\217\007\023\377\220\007\023\377\220"
+ 358      13FF8F07 
+ 358      13FF9007 
+ 358      13FF90
+ 359 1155 0713FF90 		.ascii	"\007\023\377\220\b\023\377\221\b\023\377\221\b\023\377\222\b"
+ 359      0813FF91 
+ 359      0813FF91 
+ 359      0813FF92 
+ 359      08
+ 360 1166 13FF9208 		.ascii	"\023\377\222\b\023\377\222\b\023\377\223\b\023\377\223\b\023"
+ 360      13FF9208 
+ 360      13FF9308 
+ 360      13FF9308 
+ 360      13
+ 361 1177 FF940913 		.ascii	"\377\224\t\023\377\224\t\023\377\224\t\023\377\225\t\023\377"
+ 361      FF940913 
+ 361      FF940913 
+ 361      FF950913 
+ 361      FF
+ 362 1188 950913FF 		.ascii	"\225\t\023\377\225\t\023\377\226\t\023\377\226\t\023\377\227"
+ 362      950913FF 
+ 362      960913FF 
+ 362      960913FF 
+ 362      97
+ 363 1199 0A13FF97 		.ascii	"\n\023\377\227\n\023\377\227\n\023\377\230\n\024\377\230\n\024"
+ 363      0A13FF97 
+ 363      0A13FF98 
+ 363      0A14FF98 
+ 363      0A14
+ 364 11ab FF990A14 		.ascii	"\377\231\n\024\377\231\n\024\377\231\n\024\377\232\013\024\377"
+ 364      FF990A14 
+ 364      FF990A14 
+GAS LISTING /tmp/ccmDVY4F.s 			page 23
+
+
+ 364      FF9A0B14 
+ 364      FF
+ 365 11bc 9A0B14FF 		.ascii	"\232\013\024\377\233\013\024\377\233\013\024\377\233\013\024"
+ 365      9B0B14FF 
+ 365      9B0B14FF 
+ 365      9B0B14
+ 366 11cb FF9C0B14 		.ascii	"\377\234\013\024\377\234\013\024\377\235\f\024\377\235\f\024"
+ 366      FF9C0B14 
+ 366      FF9D0C14 
+ 366      FF9D0C14 
+ 367 11db FF9D0C14 		.ascii	"\377\235\f\024\377\236\f\024\377\236\f\024\377\237\f\024\377"
+ 367      FF9E0C14 
+ 367      FF9E0C14 
+ 367      FF9F0C14 
+ 367      FF
+ 368 11ec 9F0C14FF 		.ascii	"\237\f\024\377\237\r\024\377\240\r\024\377\240\r\024\377\241"
+ 368      9F0D14FF 
+ 368      A00D14FF 
+ 368      A00D14FF 
+ 368      A1
+ 369 11fd 0D14FFA1 		.ascii	"\r\024\377\241\r\024\377\241\r\024\377\242\r\024\377\242\016"
+ 369      0D14FFA1 
+ 369      0D14FFA2 
+ 369      0D14FFA2 
+ 369      0E
+ 370 120e 14FFA30E 		.ascii	"\024\377\243\016\024\377\243\016\024\377\243\016\024\377\244"
+ 370      14FFA30E 
+ 370      14FFA30E 
+ 370      14FFA4
+ 371 121d 0E14FFA4 		.ascii	"\016\024\377\244\016\024\377\244\017\024\377\245\017\025\377"
+ 371      0E14FFA4 
+ 371      0F14FFA5 
+ 371      0F15FF
+ 372 122c A50F15FF 		.ascii	"\245\017\025\377\245\017\025\377\245\017\025\377\246\017\025"
+ 372      A50F15FF 
+ 372      A50F15FF 
+ 372      A60F15
+ 373 123b FFA60F15 		.ascii	"\377\246\017\025\377\246\017\025\377\246\017\025\377\247\017"
+ 373      FFA60F15 
+ 373      FFA60F15 
+ 373      FFA70F
+ 374 124a 15FFA70F 		.ascii	"\025\377\247\017\025\377\247\017\025\377\247\017\025\377\250"
+ 374      15FFA70F 
+ 374      15FFA70F 
+ 374      15FFA8
+ 375 1259 0F15FFA8 		.ascii	"\017\025\377\250\017\025\377\250\017\025\377\250\017\025\377"
+ 375      0F15FFA8 
+ 375      0F15FFA8 
+ 375      0F15FF
+ 376 1268 A80F15FF 		.ascii	"\250\017\025\377\251\017\025\377\251\020\025\377\251\020\025"
+ 376      A90F15FF 
+ 376      A91015FF 
+ 376      A91015
+ 377 1277 FFA91016 		.ascii	"\377\251\020\026\377\252\020\026\377\252\020\026\377\252\020"
+ 377      FFAA1016 
+ 377      FFAA1016 
+ 377      FFAA10
+GAS LISTING /tmp/ccmDVY4F.s 			page 24
+
+
+ 378 1286 16FFAA10 		.ascii	"\026\377\252\020\026\377\253\020\026\377\253\020\026\377\253"
+ 378      16FFAB10 
+ 378      16FFAB10 
+ 378      16FFAB
+ 379 1295 1016FFAB 		.ascii	"\020\026\377\253\020\026\377\254\020\026\377\254\020\026\377"
+ 379      1016FFAC 
+ 379      1016FFAC 
+ 379      1016FF
+ 380 12a4 AC1016FF 		.ascii	"\254\020\026\377\254\020\026\377\254\020\026\377\255\020\026"
+ 380      AC1016FF 
+ 380      AC1016FF 
+ 380      AD1016
+ 381 12b3 FFAD1116 		.ascii	"\377\255\021\026\377\255\021\026\377\255\021\026\377\256\021"
+ 381      FFAD1116 
+ 381      FFAD1116 
+ 381      FFAE11
+ 382 12c2 16FFAE11 		.ascii	"\026\377\256\021\026\377\256\021\027\377\256\021\027\377\257"
+ 382      16FFAE11 
+ 382      17FFAE11 
+ 382      17FFAF
+ 383 12d1 1117FFAF 		.ascii	"\021\027\377\257\021\027\377\257\021\027\377\257\021\027\377"
+ 383      1117FFAF 
+ 383      1117FFAF 
+ 383      1117FF
+ 384 12e0 B01117FF 		.ascii	"\260\021\027\377\260\021\027\377\260\021\027\377\260\021\027"
+ 384      B01117FF 
+ 384      B01117FF 
+ 384      B01117
+ 385 12ef FFB01117 		.ascii	"\377\260\021\027\377\261\021\027\377\261\021\027\377\261\022"
+ 385      FFB11117 
+ 385      FFB11117 
+ 385      FFB112
+ 386 12fe 17FFB112 		.ascii	"\027\377\261\022\027\377\262\022\027\377\262\022\027\377\262"
+ 386      17FFB212 
+ 386      17FFB212 
+ 386      17FFB2
+ 387 130d 1217FFB2 		.ascii	"\022\027\377\262\022\027\377\263\022\027\377\263\022\030\377"
+ 387      1217FFB3 
+ 387      1217FFB3 
+ 387      1218FF
+ 388 131c B31218FF 		.ascii	"\263\022\030\377\263\022\030\377\273\024\031\377\273\024\031"
+ 388      B31218FF 
+ 388      BB1419FF 
+ 388      BB1419
+ 389 132b FFBC1419 		.ascii	"\377\274\024\031\377\274\024\031\377\274\024\031\377\274\024"
+ 389      FFBC1419 
+ 389      FFBC1419 
+ 389      FFBC14
+ 390 133a 1AFFBD14 		.ascii	"\032\377\275\024\032\377\275\024\032\377\275\024\032\377\275"
+ 390      1AFFBD14 
+ 390      1AFFBD14 
+ 390      1AFFBD
+ 391 1349 141AFFBE 		.ascii	"\024\032\377\276\024\032\377\276\024\032\377\276\025\032\377"
+ 391      141AFFBE 
+ 391      141AFFBE 
+ 391      151AFF
+ 392 1358 BE151AFF 		.ascii	"\276\025\032\377\276\025\032\377\277\025\032\377\277\025\032"
+GAS LISTING /tmp/ccmDVY4F.s 			page 25
+
+
+ 392      BE151AFF 
+ 392      BF151AFF 
+ 392      BF151A
+ 393 1367 FFBF151A 		.ascii	"\377\277\025\032\377\277\025\032\377\300\025\032\377\300\025"
+ 393      FFBF151A 
+ 393      FFC0151A 
+ 393      FFC015
+ 394 1376 1AFFC015 		.ascii	"\032\377\300\025\032\377\300\025\032\377\301\025\032\377\301"
+ 394      1AFFC015 
+ 394      1AFFC115 
+ 394      1AFFC1
+ 395 1385 151AFFC1 		.ascii	"\025\032\377\301\025\033\377\301\025\033\377\302\025\033\377"
+ 395      151BFFC1 
+ 395      151BFFC2 
+ 395      151BFF
+ 396 1394 C2151BFF 		.ascii	"\302\025\033\377\302\026\033\377\302\026\033\377\303\026\033"
+ 396      C2161BFF 
+ 396      C2161BFF 
+ 396      C3161B
+ 397 13a3 FFC3161B 		.ascii	"\377\303\026\033\377\303\026\033\377\303\026\033\377\304\026"
+ 397      FFC3161B 
+ 397      FFC3161B 
+ 397      FFC416
+ 398 13b2 1BFFC416 		.ascii	"\033\377\304\026\033\377\304\026\033\377\304\026\033\377\304"
+ 398      1BFFC416 
+ 398      1BFFC416 
+ 398      1BFFC4
+ 399 13c1 161BFFC5 		.ascii	"\026\033\377\305\026\033\377\305\026\033\377\305\026\033\377"
+ 399      161BFFC5 
+ 399      161BFFC5 
+ 399      161BFF
+ 400 13d0 C5161BFF 		.ascii	"\305\026\033\377\306\026\033\377\306\026\034\377\306\026\034"
+ 400      C6161BFF 
+ 400      C6161CFF 
+ 400      C6161C
+ 401 13df FFC6171C 		.ascii	"\377\306\027\034\377\307\027\034\377\307\027\034\377\307\027"
+ 401      FFC7171C 
+ 401      FFC7171C 
+ 401      FFC717
+ 402 13ee 1CFFC717 		.ascii	"\034\377\307\027\034\377\310\027\034\377\310\027\034\377\310"
+ 402      1CFFC817 
+ 402      1CFFC817 
+ 402      1CFFC8
+ 403 13fd 171CFFC8 		.ascii	"\027\034\377\310\027\034\377\311\027\034\377\311\027\034\377"
+ 403      171CFFC9 
+ 403      171CFFC9 
+ 403      171CFF
+ 404 140c C9171CFF 		.ascii	"\311\027\034\377\311\027\034\377\312\027\034\377\312\027\034"
+ 404      C9171CFF 
+ 404      CA171CFF 
+ 404      CA171C
+ 405 141b FFCA171C 		.ascii	"\377\312\027\034\377\312\027\034\377\312\030\034\377\313\030"
+ 405      FFCA171C 
+ 405      FFCA181C 
+ 405      FFCB18
+ 406 142a 1DFFCB18 		.ascii	"\035\377\313\030\035\377\313\030\035\377\313\031\035\377\314"
+ 406      1DFFCB18 
+GAS LISTING /tmp/ccmDVY4F.s 			page 26
+
+
+ 406      1DFFCB19 
+ 406      1DFFCC
+ 407 1439 191DFFCC 		.ascii	"\031\035\377\314\031\035\377\314\031\035\377\314\032\035\377"
+ 407      191DFFCC 
+ 407      191DFFCC 
+ 407      1A1DFF
+ 408 1448 CD1A1DFF 		.ascii	"\315\032\035\377\315\032\035\377\315\032\036\377\315\033\036"
+ 408      CD1A1DFF 
+ 408      CD1A1EFF 
+ 408      CD1B1E
+ 409 1457 FFCD1B1E 		.ascii	"\377\315\033\036\377\316\033\036\377\316\034\036\377\316\034"
+ 409      FFCE1B1E 
+ 409      FFCE1C1E 
+ 409      FFCE1C
+ 410 1466 1EFFCE1C 		.ascii	"\036\377\316\034\036\377\317\034\036\377\317\035\036\377\317"
+ 410      1EFFCF1C 
+ 410      1EFFCF1D 
+ 410      1EFFCF
+ 411 1475 1D1EFFCF 		.ascii	"\035\036\377\317\035\036\377\317\035\037\377\320\036\037\377"
+ 411      1D1EFFCF 
+ 411      1D1FFFD0 
+ 411      1E1FFF
+ 412 1484 D01E1FFF 		.ascii	"\320\036\037\377\320\036\037\377\320\036\037\377\321\036\037"
+ 412      D01E1FFF 
+ 412      D01E1FFF 
+ 412      D11E1F
+ 413 1493 FFD11F1F 		.ascii	"\377\321\037\037\377\321\037\037\377\321\037\037\377\321\037"
+ 413      FFD11F1F 
+ 413      FFD11F1F 
+ 413      FFD11F
+ 414 14a2 1FFFD220 		.ascii	"\037\377\322 \037\377\322  \377\322  \377\322  \377\323! \377"
+ 414      1FFFD220 
+ 414      20FFD220 
+ 414      20FFD220 
+ 414      20FFD321 
+ 415 14b8 D32120FF 		.ascii	"\323! \377\323! \377\323! \377\323\" \377\324\" \377\324\" \377"
+ 415      D32120FF 
+ 415      D32120FF 
+ 415      D32220FF 
+ 415      D42220FF 
+ 416 14d0 D42220FF 		.ascii	"\324\" \377\324\"!\377\325#!\377\325#!\377\325#!\377\325#!\377"
+ 416      D42221FF 
+ 416      D52321FF 
+ 416      D52321FF 
+ 416      D52321FF 
+ 417 14e8 D52421FF 		.ascii	"\325$!\377\326$!\377\326$!\377\326$!\377\326$!\377\327%\"\377"
+ 417      D62421FF 
+ 417      D62421FF 
+ 417      D62421FF 
+ 417      D62421FF 
+ 418 1500 D72522FF 		.ascii	"\327%\"\377\327%\"\377\327%\"\377\327%\"\377\330&\"\377\330&"
+ 418      D72522FF 
+ 418      D72522FF 
+ 418      D72522FF 
+ 418      D82622FF 
+ 419 1516 22FFD826 		.ascii	"\"\377\330&\"\377\330&\"\377\331'\"\377\340.%\377\340.&\377\340"
+ 419      22FFD826 
+GAS LISTING /tmp/ccmDVY4F.s 			page 27
+
+
+ 419      22FFD927 
+ 419      22FFE02E 
+ 419      25FFE02E 
+ 420 152d 2E26FFE1 		.ascii	".&\377\341.&\377\341/&\377\341/&\377\341/&\377\342/&\377\342"
+ 420      2E26FFE1 
+ 420      2F26FFE1 
+ 420      2F26FFE1 
+ 420      2F26FFE2 
+ 421 1545 2F26FFE2 		.ascii	"/&\377\3420&\377\3420&\377\3430&\377\3430'\377\3430'\377\343"
+ 421      3026FFE2 
+ 421      3026FFE3 
+ 421      3026FFE3 
+ 421      3027FFE3 
+ 422 155d 3127FFE3 		.ascii	"1'\377\3431'\377\3441'\377\3441'\377\3441'\377\3442'\377\345"
+ 422      3127FFE4 
+ 422      3127FFE4 
+ 422      3127FFE4 
+ 422      3127FFE4 
+ 423 1575 3227FFE5 		.ascii	"2'\377\3452'\377\3452(\377\3452(\377\3453(\377\3463(\377\346"
+ 423      3227FFE5 
+ 423      3228FFE5 
+ 423      3228FFE5 
+ 423      3328FFE6 
+ 424 158d 3328FFE6 		.ascii	"3(\377\3463(\377\3463(\377\3474(\377\3474(\377\3474(\377\347"
+ 424      3328FFE6 
+ 424      3328FFE7 
+ 424      3428FFE7 
+ 424      3428FFE7 
+ 425 15a5 3428FFE7 		.ascii	"4(\377\3474)\377\3505)\377\3505)\377\3505)\377\3505)\377\351"
+ 425      3429FFE8 
+ 425      3529FFE8 
+ 425      3529FFE8 
+ 425      3529FFE8 
+ 426 15bd 3529FFE9 		.ascii	"5)\377\3516)\377\3516)\377\3516)\377\3526)\377\3526*\377\352"
+ 426      3629FFE9 
+ 426      3629FFE9 
+ 426      3629FFEA 
+ 426      3629FFEA 
+ 427 15d5 372AFFEA 		.ascii	"7*\377\3527*\377\3527*\377\3537*\377\3537*\377\3538*\377\353"
+ 427      372AFFEA 
+ 427      372AFFEB 
+ 427      372AFFEB 
+ 427      372AFFEB 
+ 428 15ed 382AFFEC 		.ascii	"8*\377\3548*\377\3548*\377\3548*\377\3549+\377\3549+\377\355"
+ 428      382AFFEC 
+ 428      382AFFEC 
+ 428      382AFFEC 
+ 428      392BFFEC 
+ 429 1605 392BFFED 		.ascii	"9+\377\3559+\377\3559+\377\355:+\377\356:+\377\356:+\377\356"
+ 429      392BFFED 
+ 429      392BFFED 
+ 429      3A2BFFEE 
+ 429      3A2BFFEE 
+ 430 161d 3A2BFFEE 		.ascii	":+\377\356:+\377\356;+\377\357;,\377\357;,\377\357<,\377\357"
+ 430      3A2BFFEE 
+ 430      3B2BFFEF 
+ 430      3B2CFFEF 
+GAS LISTING /tmp/ccmDVY4F.s 			page 28
+
+
+ 430      3B2CFFEF 
+ 431 1635 3C2CFFEF 		.ascii	"<,\377\357<,\377\357=-\377\357=-\377\357=-\377\357>-\377\357"
+ 431      3C2CFFEF 
+ 431      3D2DFFEF 
+ 431      3D2DFFEF 
+ 431      3D2DFFEF 
+ 432 164d 3E2DFFEF 		.ascii	">-\377\357>-\377\357?.\377\360?.\377\360?.\377\360@.\377\360"
+ 432      3E2DFFEF 
+ 432      3F2EFFF0 
+ 432      3F2EFFF0 
+ 432      3F2EFFF0 
+ 433 1665 402EFFF0 		.ascii	"@.\377\360@/\377\360A/\377\360A/\377\360A/\377\360B/\377\360"
+ 433      402FFFF0 
+ 433      412FFFF0 
+ 433      412FFFF0 
+ 433      412FFFF0 
+ 434 167d 422FFFF0 		.ascii	"B/\377\360B0\377\360C0\377\360C0\377\361C0\377\361D0\377\361"
+ 434      4230FFF0 
+ 434      4330FFF0 
+ 434      4330FFF1 
+ 434      4330FFF1 
+ 435 1695 4431FFF1 		.ascii	"D1\377\361D1\377\361E1\377\361E1\377\361E1\377\361F1\377\361"
+ 435      4431FFF1 
+ 435      4531FFF1 
+ 435      4531FFF1 
+ 435      4531FFF1 
+ 436 16ad 4632FFF1 		.ascii	"F2\377\361F2\377\361G2\377\361G2\377\361G2\377\362H3\377\362"
+ 436      4632FFF1 
+ 436      4732FFF1 
+ 436      4732FFF1 
+ 436      4732FFF2 
+ 437 16c5 4833FFF2 		.ascii	"H3\377\362H3\377\362H3\377\362I3\377\362I3\377\362I4\377\362"
+ 437      4833FFF2 
+ 437      4833FFF2 
+ 437      4933FFF2 
+ 437      4933FFF2 
+ 438 16dd 4A34FFF2 		.ascii	"J4\377\362J4\377\362J4\377\362K4\377\362K5\377\362K5\377\363"
+ 438      4A34FFF2 
+ 438      4A34FFF2 
+ 438      4B34FFF2 
+ 438      4B35FFF2 
+ 439 16f5 4B35FFF3 		.ascii	"K5\377\363L5\377\363L5\377\363L5\377\363M6\377\363M6\377\363"
+ 439      4C35FFF3 
+ 439      4C35FFF3 
+ 439      4C35FFF3 
+ 439      4D36FFF3 
+ 440 170d 4D36FFF3 		.ascii	"M6\377\363N6\377\363N6\377\363N7\377\363N7\377\363O7\377\366"
+ 440      4E36FFF3 
+ 440      4E36FFF3 
+ 440      4E37FFF3 
+ 440      4E37FFF3 
+ 441 1725 583DFFF6 		.ascii	"X=\377\366Y=\377\366Y>\377\366Y>\377\366Z>\377\366Z>\377\366"
+ 441      593DFFF6 
+ 441      593EFFF6 
+ 441      593EFFF6 
+ 441      5A3EFFF6 
+ 442 173d 5A3EFFF6 		.ascii	"Z>\377\366Z>\377\366[?\377\367[?\377\367[?\377\367[?\377\367"
+GAS LISTING /tmp/ccmDVY4F.s 			page 29
+
+
+ 442      5A3EFFF6 
+ 442      5B3FFFF7 
+ 442      5B3FFFF7 
+ 442      5B3FFFF7 
+ 443 1755 5C3FFFF7 		.ascii	"\\?\377\367\\@\377\367\\@\377\367]@\377\367]@\377\367]@\377\367"
+ 443      5C40FFF7 
+ 443      5C40FFF7 
+ 443      5D40FFF7 
+ 443      5D40FFF7 
+ 444 176d 5D41FFF7 		.ascii	"]A\377\367^A\377\367^A\377\367^A\377\367_A\377\370_B\377\370"
+ 444      5E41FFF7 
+ 444      5E41FFF7 
+ 444      5E41FFF7 
+ 444      5F41FFF8 
+ 445 1785 5F42FFF8 		.ascii	"_B\377\370_B\377\370`B\377\370`B\377\370`B\377\370`C\377\370"
+ 445      5F42FFF8 
+ 445      6042FFF8 
+ 445      6042FFF8 
+ 445      6042FFF8 
+ 446 179d 6143FFF8 		.ascii	"aC\377\370aC\377\370aC\377\370aC\377\370bD\377\370bD\377\371"
+ 446      6143FFF8 
+ 446      6143FFF8 
+ 446      6143FFF8 
+ 446      6244FFF8 
+ 447 17b5 6244FFF9 		.ascii	"bD\377\371cD\377\371cD\377\371cE\377\371cE\377\371dE\377\371"
+ 447      6344FFF9 
+ 447      6344FFF9 
+ 447      6345FFF9 
+ 447      6345FFF9 
+ 448 17cd 6445FFF9 		.ascii	"dE\377\371dE\377\371dF\377\371eF\377\371eF\377\371eF\377\371"
+ 448      6445FFF9 
+ 448      6446FFF9 
+ 448      6546FFF9 
+ 448      6546FFF9 
+ 449 17e5 6546FFF9 		.ascii	"eF\377\371fG\377\372fG\377"
+ 449      6647FFFA 
+ 449      6647FF
+ 450 17f0 FA6647FF 		.ascii	"\372fG\377\372fG\377\372gG\377\372gH\377\372gH\377\372gH\377"
+ 450      FA6647FF 
+ 450      FA6747FF 
+ 450      FA6748FF 
+ 450      FA6748FF 
+ 451 1808 FA6848FF 		.ascii	"\372hH\377\372hH\377\372hI\377\372hI\377\372iI\377\372iI\377"
+ 451      FA6848FF 
+ 451      FA6849FF 
+ 451      FA6849FF 
+ 451      FA6949FF 
+ 452 1820 FA6949FF 		.ascii	"\372iI\377\372jI\377\373jJ\377\373jJ\377\373jJ\377\373kJ\377"
+ 452      FA6A49FF 
+ 452      FB6A4AFF 
+ 452      FB6A4AFF 
+ 452      FB6A4AFF 
+ 453 1838 FB6B4BFF 		.ascii	"\373kK\377\373kK\377\373kK\377\373lK\377\373lL\377\373lL\377"
+ 453      FB6B4BFF 
+ 453      FB6B4BFF 
+ 453      FB6C4BFF 
+ 453      FB6C4CFF 
+GAS LISTING /tmp/ccmDVY4F.s 			page 30
+
+
+ 454 1850 FB6C4CFF 		.ascii	"\373lL\377\373mL\377\373mM\377\373mM\377\373nM\377\373nM\377"
+ 454      FB6D4CFF 
+ 454      FB6D4DFF 
+ 454      FB6D4DFF 
+ 454      FB6E4DFF 
+ 455 1868 FB6E4EFF 		.ascii	"\373nN\377\373nN\377\373oN\377\373oN\377\373oO\377\373oO\377"
+ 455      FB6E4EFF 
+ 455      FB6F4EFF 
+ 455      FB6F4EFF 
+ 455      FB6F4FFF 
+ 456 1880 FB704FFF 		.ascii	"\373pO\377\373pO\377\373pP\377\373pP\377\373qP\377\373qP\377"
+ 456      FB704FFF 
+ 456      FB7050FF 
+ 456      FB7050FF 
+ 456      FB7150FF 
+ 457 1898 FB7150FF 		.ascii	"\373qP\377\373rQ\377\373rQ\377\373rQ\377\373rQ\377\373sR\377"
+ 457      FB7251FF 
+ 457      FB7251FF 
+ 457      FB7251FF 
+ 457      FB7251FF 
+ 458 18b0 FB7352FF 		.ascii	"\373sR\377\373sR\377\373sR\377\373tS\377\373tS\377\373tS\377"
+ 458      FB7352FF 
+ 458      FB7352FF 
+ 458      FB7453FF 
+ 458      FB7453FF 
+ 459 18c8 FB7453FF 		.ascii	"\373tS\377\373uT\377\373uT\377\373uT\377\373uT\377\373vU\377"
+ 459      FB7554FF 
+ 459      FB7554FF 
+ 459      FB7554FF 
+ 459      FB7554FF 
+ 460 18e0 FB7655FF 		.ascii	"\373vU\377\373vU\377\373vU\377\373wV\377\373wV\377\373wV\377"
+ 460      FB7655FF 
+ 460      FB7655FF 
+ 460      FB7756FF 
+ 460      FB7756FF 
+ 461 18f8 FB7756FF 		.ascii	"\373wV\377\373xW\377\373xW\377\373xW\377\373xW\377\373yX\377"
+ 461      FB7857FF 
+ 461      FB7857FF 
+ 461      FB7857FF 
+ 461      FB7857FF 
+ 462 1910 FB7958FF 		.ascii	"\373yX\377\373yX\377\373yX\377\373zY\377\373zY\377\373\202a\377"
+ 462      FB7958FF 
+ 462      FB7958FF 
+ 462      FB7A59FF 
+ 462      FB7A59FF 
+ 463 1928 FB8261FF 		.ascii	"\373\202a\377\373\203b\377\373\203b\377\373\203b\377\373\203"
+ 463      FB8362FF 
+ 463      FB8362FF 
+ 463      FB8362FF 
+ 463      FB83
+ 464 193a 62FFFB84 		.ascii	"b\377\373\204c\377\373\204c\377\373\204c\377\373\204c\377\373"
+ 464      63FFFB84 
+ 464      63FFFB84 
+ 464      63FFFB84 
+ 464      63FFFB
+ 465 194d 8564FFFB 		.ascii	"\205d\377\373\205d\377\373\205d\377\374\205d\377\374\206e\377"
+ 465      8564FFFB 
+GAS LISTING /tmp/ccmDVY4F.s 			page 31
+
+
+ 465      8564FFFC 
+ 465      8564FFFC 
+ 465      8665FF
+ 466 1960 FC8665FF 		.ascii	"\374\206e\377\374\206e\377\374\206e\377\374\207f\377\374\207"
+ 466      FC8665FF 
+ 466      FC8665FF 
+ 466      FC8766FF 
+ 466      FC87
+ 467 1972 66FFFC87 		.ascii	"f\377\374\207f\377\374\207f\377\374\210g\377\374\210g\377\374"
+ 467      66FFFC87 
+ 467      66FFFC88 
+ 467      67FFFC88 
+ 467      67FFFC
+ 468 1985 8867FFFC 		.ascii	"\210g\377\374\210g\377\374\211h\377\374\211h\377\374\211h\377"
+ 468      8867FFFC 
+ 468      8968FFFC 
+ 468      8968FFFC 
+ 468      8968FF
+ 469 1998 FC8968FF 		.ascii	"\374\211h\377\374\211i\377\374\212i\377\374\212i\377\374\212"
+ 469      FC8969FF 
+ 469      FC8A69FF 
+ 469      FC8A69FF 
+ 469      FC8A
+ 470 19aa 69FFFC8A 		.ascii	"i\377\374\212j\377\374\213j\377\374\213j\377\374\213j\377\374"
+ 470      6AFFFC8B 
+ 470      6AFFFC8B 
+ 470      6AFFFC8B 
+ 470      6AFFFC
+ 471 19bd 8B6BFFFC 		.ascii	"\213k\377\374\214k\377\374\214k\377\374\214l\377\374\214l\377"
+ 471      8C6BFFFC 
+ 471      8C6BFFFC 
+ 471      8C6CFFFC 
+ 471      8C6CFF
+ 472 19d0 FC8D6CFF 		.ascii	"\374\215l\377\374\215l\377\374\215m\377\374\215m\377\374\216"
+ 472      FC8D6CFF 
+ 472      FC8D6DFF 
+ 472      FC8D6DFF 
+ 472      FC8E
+ 473 19e2 6DFFFC8E 		.ascii	"m\377\374\216m\377\374\216n\377\374\216n\377\374\216n\377\374"
+ 473      6DFFFC8E 
+ 473      6EFFFC8E 
+ 473      6EFFFC8E 
+ 473      6EFFFC
+ 474 19f5 8F6EFFFC 		.ascii	"\217n\377\374\217o\377\374\217o\377\374\217o\377\374\220o\377"
+ 474      8F6FFFFC 
+ 474      8F6FFFFC 
+ 474      8F6FFFFC 
+ 474      906FFF
+ 475 1a08 FC9070FF 		.ascii	"\374\220p\377\374\220p\377\374\220p\377\374\221p\377\374\221"
+ 475      FC9070FF 
+ 475      FC9070FF 
+ 475      FC9170FF 
+ 475      FC91
+ 476 1a1a 71FFFC91 		.ascii	"q\377\374\221q\377\374\221q\377\373\222q\377\374\222r\377\374"
+ 476      71FFFC91 
+ 476      71FFFB92 
+ 476      71FFFC92 
+GAS LISTING /tmp/ccmDVY4F.s 			page 32
+
+
+ 476      72FFFC
+ 477 1a2d 9272FFFC 		.ascii	"\222r\377\374\222r\377\374\223s\377\374\223s\377\374\223s\377"
+ 477      9272FFFC 
+ 477      9373FFFC 
+ 477      9373FFFC 
+ 477      9373FF
+ 478 1a40 FC9373FF 		.ascii	"\374\223s\377\374\224t\377\374\224t\377\374\224t\377\374\224"
+ 478      FC9474FF 
+ 478      FC9474FF 
+ 478      FC9474FF 
+ 478      FC94
+ 479 1a52 75FFFC95 		.ascii	"u\377\374\225u\377\374\225u\377\374\225u\377\374\226v\377\374"
+ 479      75FFFC95 
+ 479      75FFFC95 
+ 479      75FFFC96 
+ 479      76FFFC
+ 480 1a65 9676FFFC 		.ascii	"\226v\377\374\226v\377\374\226v\377\374\227w\377\374\227w\377"
+ 480      9676FFFC 
+ 480      9676FFFC 
+ 480      9777FFFC 
+ 480      9777FF
+ 481 1a78 FC9777FF 		.ascii	"\374\227w\377\374\227x\377\374\230x\377\374\230x\377\374\230"
+ 481      FC9778FF 
+ 481      FC9878FF 
+ 481      FC9878FF 
+ 481      FC98
+ 482 1a8a 78FFFC98 		.ascii	"x\377\374\230y\377\374\231y\377\374\231y\377\374\231z\377\374"
+ 482      79FFFC99 
+ 482      79FFFC99 
+ 482      79FFFC99 
+ 482      7AFFFC
+ 483 1a9d 997AFFFC 		.ascii	"\231z\377\374\232z\377\374\232z\377\374\232{\377\374\233{\377"
+ 483      9A7AFFFC 
+ 483      9A7AFFFC 
+ 483      9A7BFFFC 
+ 483      9B7BFF
+ 484 1ab0 FC9B7BFF 		.ascii	"\374\233{\377\374\233{\377\374\233|\377\374\234|\377\374\234"
+ 484      FC9B7BFF 
+ 484      FC9B7CFF 
+ 484      FC9C7CFF 
+ 484      FC9C
+ 485 1ac2 7CFFFC9C 		.ascii	"|\377\374\234}\377\374\234}\377\374\235}\377\374\235}\377\374"
+ 485      7DFFFC9C 
+ 485      7DFFFC9D 
+ 485      7DFFFC9D 
+ 485      7DFFFC
+ 486 1ad5 9D7EFFFC 		.ascii	"\235~\377\374\235~\377\374\236~\377\374\236\177\377\374\236\177"
+ 486      9D7EFFFC 
+ 486      9E7EFFFC 
+ 486      9E7FFFFC 
+ 486      9E7F
+ 487 1ae7 FFFC9E7F 		.ascii	"\377\374\236\177\377\374\237\200\377\374\237\200\377\374\237"
+ 487      FFFC9F80 
+ 487      FFFC9F80 
+ 487      FFFC9F
+ 488 1af6 80FFFC9F 		.ascii	"\200\377\374\237\200\377\374\240\201\377\374\240\201\377\374"
+ 488      80FFFCA0 
+GAS LISTING /tmp/ccmDVY4F.s 			page 33
+
+
+ 488      81FFFCA0 
+ 488      81FFFC
+ 489 1b05 A081FFFC 		.ascii	"\240\201\377\374\240\202\377\374\241\202\377\374\241\202\377"
+ 489      A082FFFC 
+ 489      A182FFFC 
+ 489      A182FF
+ 490 1b14 FCA182FF 		.ascii	"\374\241\202\377\374\241\203\377\374\242\203\377\374\242\203"
+ 490      FCA183FF 
+ 490      FCA283FF 
+ 490      FCA283
+ 491 1b23 FFFCAA8D 		.ascii	"\377\374\252\215\377\374\253\215\377\374\253\216\377\374\253"
+ 491      FFFCAB8D 
+ 491      FFFCAB8E 
+ 491      FFFCAB
+ 492 1b32 8EFFFCAB 		.ascii	"\216\377\374\253\216\377\374\254\216\377\374\254\217\377\374"
+ 492      8EFFFCAC 
+ 492      8EFFFCAC 
+ 492      8FFFFC
+ 493 1b41 AC8FFFFC 		.ascii	"\254\217\377\374\254\217\377\374\255\220\377\374\255\220\377"
+ 493      AC8FFFFC 
+ 493      AD90FFFC 
+ 493      AD90FF
+ 494 1b50 FCAD90FF 		.ascii	"\374\255\220\377\374\256\221\377\374\256\221\377\374\256\221"
+ 494      FCAE91FF 
+ 494      FCAE91FF 
+ 494      FCAE91
+ 495 1b5f FFFCAE91 		.ascii	"\377\374\256\221\377\374\257\222\377\374\257\222\377\374\257"
+ 495      FFFCAF92 
+ 495      FFFCAF92 
+ 495      FFFCAF
+ 496 1b6e 92FFFCAF 		.ascii	"\222\377\374\257\223\377\374\260\223\377\374\260\223\377\374"
+ 496      93FFFCB0 
+ 496      93FFFCB0 
+ 496      93FFFC
+ 497 1b7d B094FFFC 		.ascii	"\260\224\377\374\260\224\377\374\261\224\377\374\261\224\377"
+ 497      B094FFFC 
+ 497      B194FFFC 
+ 497      B194FF
+ 498 1b8c FCB195FF 		.ascii	"\374\261\225\377\374\261\225\377\374\262\225\377\374\262\226"
+ 498      FCB195FF 
+ 498      FCB295FF 
+ 498      FCB296
+ 499 1b9b FFFCB296 		.ascii	"\377\374\262\226\377\374\262\226\377\374\263\227\377\374\263"
+ 499      FFFCB296 
+ 499      FFFCB397 
+ 499      FFFCB3
+ 500 1baa 97FFFCB3 		.ascii	"\227\377\374\263\227\377\374\263\227\377\374\264\230\377\374"
+ 500      97FFFCB3 
+ 500      97FFFCB4 
+ 500      98FFFC
+ 501 1bb9 B498FFFC 		.ascii	"\264\230\377\374\264\230\377\374\264\231\377\374\265\231\377"
+ 501      B498FFFC 
+ 501      B499FFFC 
+ 501      B599FF
+ 502 1bc8 FCB599FF 		.ascii	"\374\265\231\377\374\265\232\377\374\265\232\377\374\266\232"
+ 502      FCB59AFF 
+ 502      FCB59AFF 
+GAS LISTING /tmp/ccmDVY4F.s 			page 34
+
+
+ 502      FCB69A
+ 503 1bd7 FFFCB69B 		.ascii	"\377\374\266\233\377\374\266\233\377\374\266\233\377\374\267"
+ 503      FFFCB69B 
+ 503      FFFCB69B 
+ 503      FFFCB7
+ 504 1be6 9BFFFCB7 		.ascii	"\233\377\374\267\234\377\374\267\234\377\374\267\234\377\374"
+ 504      9CFFFCB7 
+ 504      9CFFFCB7 
+ 504      9CFFFC
+ 505 1bf5 B89DFFFC 		.ascii	"\270\235\377\374\270\235\377\374\270\235\377\374\270\236\377"
+ 505      B89DFFFC 
+ 505      B89DFFFC 
+ 505      B89EFF
+ 506 1c04 FCB99EFF 		.ascii	"\374\271\236\377\374\271\236\377\374\271\237\377\374\271\237"
+ 506      FCB99EFF 
+ 506      FCB99FFF 
+ 506      FCB99F
+ 507 1c13 FFFCBA9F 		.ascii	"\377\374\272\237\377\374\272\240\377\374\272\240\377\374\272"
+ 507      FFFCBAA0 
+ 507      FFFCBAA0 
+ 507      FFFCBA
+ 508 1c22 A0FFFBBB 		.ascii	"\240\377\373\273\240\377\374\273\241\377\374\273\241\377\374"
+ 508      A0FFFCBB 
+ 508      A1FFFCBB 
+ 508      A1FFFC
+ 509 1c31 BBA1FFFC 		.ascii	"\273\241\377\374\273\242\377\374\274\242\377\374\274\242\377"
+ 509      BBA2FFFC 
+ 509      BCA2FFFC 
+ 509      BCA2FF
+ 510 1c40 FCBCA3FF 		.ascii	"\374\274\243\377\374\274\243\377\374\275\243\377\374\275\243"
+ 510      FCBCA3FF 
+ 510      FCBDA3FF 
+ 510      FCBDA3
+ 511 1c4f FFFCBDA4 		.ascii	"\377\374\275\244\377\374\275\244\377\374\276\244\377\374\276"
+ 511      FFFCBDA4 
+ 511      FFFCBEA4 
+ 511      FFFCBE
+ 512 1c5e A5FFFCBE 		.ascii	"\245\377\374\276\245\377\374\276\245\377\374\276\245\377\374"
+ 512      A5FFFCBE 
+ 512      A5FFFCBE 
+ 512      A5FFFC
+ 513 1c6d BFA6FFFC 		.ascii	"\277\246\377\374\277\246\377\374\277\246\377\374\277\247\377"
+ 513      BFA6FFFC 
+ 513      BFA6FFFC 
+ 513      BFA7FF
+ 514 1c7c FCC0A7FF 		.ascii	"\374\300\247\377\374\300\247\377\374\300\250\377\374\300\250"
+ 514      FCC0A7FF 
+ 514      FCC0A8FF 
+ 514      FCC0A8
+ 515 1c8b FFFCC1A8 		.ascii	"\377\374\301\250\377\374\301\250\377\374\301\251\377\374\301"
+ 515      FFFCC1A8 
+ 515      FFFCC1A9 
+ 515      FFFCC1
+ 516 1c9a A9FFFCC2 		.ascii	"\251\377\374\302\251\377\374\302\252\377\374\302\252\377\374"
+ 516      A9FFFCC2 
+ 516      AAFFFCC2 
+ 516      AAFFFC
+GAS LISTING /tmp/ccmDVY4F.s 			page 35
+
+
+ 517 1ca9 C2AAFFFC 		.ascii	"\302\252\377\374\302\252\377\374\303\253\377\374\303\253\377"
+ 517      C2AAFFFC 
+ 517      C3ABFFFC 
+ 517      C3ABFF
+ 518 1cb8 FCC3ABFF 		.ascii	"\374\303\253\377\374\303\254\377\374\304\254\377\374\304\254"
+ 518      FCC3ACFF 
+ 518      FCC4ACFF 
+ 518      FCC4AC
+ 519 1cc7 FFFCC4AD 		.ascii	"\377\374\304\255\377\374\304\255\377\374\305\255\377\374\305"
+ 519      FFFCC4AD 
+ 519      FFFCC5AD 
+ 519      FFFCC5
+ 520 1cd6 ADFFFCC5 		.ascii	"\255\377\374\305\256\377\374\305\256\377\374\305\256\377\374"
+ 520      AEFFFCC5 
+ 520      AEFFFCC5 
+ 520      AEFFFC
+ 521 1ce5 C6AFFFFC 		.ascii	"\306\257\377\374\306\257\377\374\306\257\377\374\306\260\377"
+ 521      C6AFFFFC 
+ 521      C6AFFFFC 
+ 521      C6B0FF
+ 522 1cf4 FCC7B0FF 		.ascii	"\374\307\260\377\374\307\260\377\374\307\261\377\375\307\261"
+ 522      FCC7B0FF 
+ 522      FCC7B1FF 
+ 522      FDC7B1
+ 523 1d03 FFFDC8B1 		.ascii	"\377\375\310\261\377\375\310\261\377\375\310\262\377\375\310"
+ 523      FFFDC8B1 
+ 523      FFFDC8B2 
+ 523      FFFDC8
+ 524 1d12 B2FFFDC8 		.ascii	"\262\377\375\310\262\377\375\311\263\377\375\311\263\377\375"
+ 524      B2FFFDC9 
+ 524      B3FFFDC9 
+ 524      B3FFFD
+ 525 1d21 C9B3FFFD 		.ascii	"\311\263\377\375\321\275\377\375\321\276\377\375\321\276\377"
+ 525      D1BDFFFD 
+ 525      D1BEFFFD 
+ 525      D1BEFF
+ 526 1d30 FDD2BEFF 		.ascii	"\375\322\276\377\375\322\277\377\375\322\277\377\375\322\277"
+ 526      FDD2BFFF 
+ 526      FDD2BFFF 
+ 526      FDD2BF
+ 527 1d3f FFFDD2C0 		.ascii	"\377\375\322\300\377\375\323\300\377\375\323\300\377\375\323"
+ 527      FFFDD3C0 
+ 527      FFFDD3C0 
+ 527      FFFDD3
+ 528 1d4e C0FFFDD3 		.ascii	"\300\377\375\323\301\377\375\324\301\377\375\324\301\377\375"
+ 528      C1FFFDD4 
+ 528      C1FFFDD4 
+ 528      C1FFFD
+ 529 1d5d D4C2FFFD 		.ascii	"\324\302\377\375\324\302\377\375\325\302\377\375\325\303\377"
+ 529      D4C2FFFD 
+ 529      D5C2FFFD 
+ 529      D5C3FF
+ 530 1d6c FDD5C3FF 		.ascii	"\375\325\303\377\375\325\303\377\375\325\304\377\375\326\304"
+ 530      FDD5C3FF 
+ 530      FDD5C4FF 
+ 530      FDD6C4
+ 531 1d7b FFFDD6C4 		.ascii	"\377\375\326\304\377\375\326\304\377\375\326\305\377\375\327"
+GAS LISTING /tmp/ccmDVY4F.s 			page 36
+
+
+ 531      FFFDD6C4 
+ 531      FFFDD6C5 
+ 531      FFFDD7
+ 532 1d8a C5FFFDD7 		.ascii	"\305\377\375\327\305\377\375\327\306\377\375\327\306\377\375"
+ 532      C5FFFDD7 
+ 532      C6FFFDD7 
+ 532      C6FFFD
+ 533 1d99 D7C6FFFD 		.ascii	"\327\306\377\375\330\307\377\375\330\307\377\375\330\307\377"
+ 533      D8C7FFFD 
+ 533      D8C7FFFD 
+ 533      D8C7FF
+ 534 1da8 FDD8C8FF 		.ascii	"\375\330\310\377\375\331\310\377\375\331\310\377\375\331\311"
+ 534      FDD9C8FF 
+ 534      FDD9C8FF 
+ 534      FDD9C9
+ 535 1db7 FFFDD9C9 		.ascii	"\377\375\331\311\377\375\332\311\377\375\332\312\377\375\332"
+ 535      FFFDDAC9 
+ 535      FFFDDACA 
+ 535      FFFDDA
+ 536 1dc6 CAFFFDDA 		.ascii	"\312\377\375\332\312\377\375\332\312\377\375\333\313\377\375"
+ 536      CAFFFDDA 
+ 536      CAFFFDDB 
+ 536      CBFFFD
+ 537 1dd5 DBCBFFFD 		.ascii	"\333\313\377\375\333\313\377\375\333\314\377\375\334\314\377"
+ 537      DBCBFFFD 
+ 537      DBCCFFFD 
+ 537      DCCCFF
+ 538 1de4 FDDCCCFF 		.ascii	"\375\334\314\377\375\334\315\377\375\334\315\377\375\335\315"
+ 538      FDDCCDFF 
+ 538      FDDCCDFF 
+ 538      FDDDCD
+ 539 1df3 FFFDDDCE 		.ascii	"\377\375\335\316\377\375\335\316\377\375\335\316\377\375\335"
+ 539      FFFDDDCE 
+ 539      FFFDDDCE 
+ 539      FFFDDD
+ 540 1e02 CFFFFDDE 		.ascii	"\317\377\375\336\317\377\375\336\317\377\375\336\320\377\375"
+ 540      CFFFFDDE 
+ 540      CFFFFDDE 
+ 540      D0FFFD
+ 541 1e11 DED0FFFD 		.ascii	"\336\320\377\375\337\320\377\375\337\321\377\375\337\321\377"
+ 541      DFD0FFFD 
+ 541      DFD1FFFD 
+ 541      DFD1FF
+ 542 1e20 FDDFD1FF 		.ascii	"\375\337\321\377\375\340\321\377\376\340\322\377\376\340\322"
+ 542      FDE0D1FF 
+ 542      FEE0D2FF 
+ 542      FEE0D2
+ 543 1e2f FFFEE0D2 		.ascii	"\377\376\340\322\377\376\340\322\377\376\340\322\377\376\340"
+ 543      FFFEE0D2 
+ 543      FFFEE0D2 
+ 543      FFFEE0
+ 544 1e3e D3FFFEE0 		.ascii	"\323\377\376\340\323\377\376\341\323\377\376\341\323\377\376"
+ 544      D3FFFEE1 
+ 544      D3FFFEE1 
+ 544      D3FFFE
+ 545 1e4d E1D3FFFE 		.ascii	"\341\323\377\376\341\324\377\376\341\324\377\376\341\324\377"
+ 545      E1D4FFFE 
+GAS LISTING /tmp/ccmDVY4F.s 			page 37
+
+
+ 545      E1D4FFFE 
+ 545      E1D4FF
+ 546 1e5c FEE1D4FF 		.ascii	"\376\341\324\377\376\341\324\377\376\342\324\377\376\342\325"
+ 546      FEE1D4FF 
+ 546      FEE2D4FF 
+ 546      FEE2D5
+ 547 1e6b FFFEE2D5 		.ascii	"\377\376\342\325\377\376\342\325\377\376\342\325\377\376\342"
+ 547      FFFEE2D5 
+ 547      FFFEE2D5 
+ 547      FFFEE2
+ 548 1e7a D5FFFEE2 		.ascii	"\325\377\376\342\326\377\376\343\326\377\376\343\326\377\376"
+ 548      D6FFFEE3 
+ 548      D6FFFEE3 
+ 548      D6FFFE
+ 549 1e89 E3D6FFFE 		.ascii	"\343\326\377\376\343\326\377\376\343\326\377\376\343\327\377"
+ 549      E3D6FFFE 
+ 549      E3D6FFFE 
+ 549      E3D7FF
+ 550 1e98 FEE3D7FF 		.ascii	"\376\343\327\377\376\343\327\377\376\344\327\377\376\344\327"
+ 550      FEE3D7FF 
+ 550      FEE4D7FF 
+ 550      FEE4D7
+ 551 1ea7 FFFEE4D8 		.ascii	"\377\376\344\330\377\376\344\330\377\376\344\330\377\376\344"
+ 551      FFFEE4D8 
+ 551      FFFEE4D8 
+ 551      FFFEE4
+ 552 1eb6 D8FFFEE4 		.ascii	"\330\377\376\344\330\377\376\345\330\377\376\345\331\377\376"
+ 552      D8FFFEE5 
+ 552      D8FFFEE5 
+ 552      D9FFFE
+ 553 1ec5 E5D9FFFE 		.ascii	"\345\331\377\376\345\331\377\376\345\331\377\376\345\331\377"
+ 553      E5D9FFFE 
+ 553      E5D9FFFE 
+ 553      E5D9FF
+ 554 1ed4 FEE5DAFF 		.ascii	"\376\345\332\377\376\345\332\377\376\346\332\377\376\346\332"
+ 554      FEE5DAFF 
+ 554      FEE6DAFF 
+ 554      FEE6DA
+ 555 1ee3 FFFEE6DA 		.ascii	"\377\376\346\332\377\376\346\333\377\376\346\333\377\376\346"
+ 555      FFFEE6DB 
+ 555      FFFEE6DB 
+ 555      FFFEE6
+ 556 1ef2 DBFFFEE6 		.ascii	"\333\377\376\346\333\377\376\346\333\377\376\347\333\377\376"
+ 556      DBFFFEE6 
+ 556      DBFFFEE7 
+ 556      DBFFFE
+ 557 1f01 E7DCFFFE 		.ascii	"\347\334\377\376\347\334\377\376\347\334\377\376\347\334\377"
+ 557      E7DCFFFE 
+ 557      E7DCFFFE 
+ 557      E7DCFF
+ 558 1f10 FEE7DCFF 		.ascii	"\376\347\334\377\376\347\335\377\376\350\335\377\376\350\335"
+ 558      FEE7DDFF 
+ 558      FEE8DDFF 
+ 558      FEE8DD
+ 559 1f1f FFFEE8DD 		.ascii	"\377\376\350\335\377\376\354\343\377\376\354\344\377\376\354"
+ 559      FFFEECE3 
+ 559      FFFEECE4 
+GAS LISTING /tmp/ccmDVY4F.s 			page 38
+
+
+ 559      FFFEEC
+ 560 1f2e E4FFFEED 		.ascii	"\344\377\376\355\344\377\376\355\344\377\376\355\344\377\376"
+ 560      E4FFFEED 
+ 560      E4FFFEED 
+ 560      E4FFFE
+ 561 1f3d EDE4FFFE 		.ascii	"\355\344\377\376\355\345\377\376\355\345\377\376\355\345\377"
+ 561      EDE5FFFE 
+ 561      EDE5FFFE 
+ 561      EDE5FF
+ 562 1f4c FEEDE5FF 		.ascii	"\376\355\345\377\376\356\345\377\376\356\346\377\376\356\346"
+ 562      FEEEE5FF 
+ 562      FEEEE6FF 
+ 562      FEEEE6
+ 563 1f5b FFFEEEE6 		.ascii	"\377\376\356\346\377\376\356\346\377\376\356\346\377\376\356"
+ 563      FFFEEEE6 
+ 563      FFFEEEE6 
+ 563      FFFEEE
+ 564 1f6a E7FFFEEE 		.ascii	"\347\377\376\356\347\377\376\357\347\377\376\357\347\377\376"
+ 564      E7FFFEEF 
+ 564      E7FFFEEF 
+ 564      E7FFFE
+ 565 1f79 EFE7FFFE 		.ascii	"\357\347\377\376\357\347\377\376\357\350\377\376\357\350\377"
+ 565      EFE7FFFE 
+ 565      EFE8FFFE 
+ 565      EFE8FF
+ 566 1f88 FEEFE8FF 		.ascii	"\376\357\350\377\376\360\350\377\376\360\350\377\376\360\351"
+ 566      FEF0E8FF 
+ 566      FEF0E8FF 
+ 566      FEF0E9
+ 567 1f97 FFFEF0E9 		.ascii	"\377\376\360\351\377\376\360\351\377\376\360\351\377\376\360"
+ 567      FFFEF0E9 
+ 567      FFFEF0E9 
+ 567      FFFEF0
+ 568 1fa6 E9FFFEF0 		.ascii	"\351\377\376\360\352\377\376\361\352\377\376\361\352\377\376"
+ 568      EAFFFEF1 
+ 568      EAFFFEF1 
+ 568      EAFFFE
+ 569 1fb5 F1EAFFFE 		.ascii	"\361\352\377\376\361\352\377\376\361\353\377"
+ 569      F1EAFFFE 
+ 569      F1EBFF
+ 570 1fc0 FEF1EBFF 		.ascii	"\376\361\353\377\376\361\353\377\376\361\353\377\376\362\353"
+ 570      FEF1EBFF 
+ 570      FEF1EBFF 
+ 570      FEF2EB
+ 571 1fcf FFFEF2EB 		.ascii	"\377\376\362\353\377\376\362\354\377\376\362\354\377\376\362"
+ 571      FFFEF2EC 
+ 571      FFFEF2EC 
+ 571      FFFEF2
+ 572 1fde ECFFFEF2 		.ascii	"\354\377\376\362\354\377\376\362\354\377\376\363\355\377\376"
+ 572      ECFFFEF2 
+ 572      ECFFFEF3 
+ 572      EDFFFE
+ 573 1fed F3EDFFFE 		.ascii	"\363\355\377\376\363\355\377\376\363\355\377\376\363\355\377"
+ 573      F3EDFFFE 
+ 573      F3EDFFFE 
+ 573      F3EDFF
+ 574 1ffc FEF3EEFF 		.ascii	"\376\363\356\377\376\363\356\377\376\363\356\377\376\364\356"
+GAS LISTING /tmp/ccmDVY4F.s 			page 39
+
+
+ 574      FEF3EEFF 
+ 574      FEF3EEFF 
+ 574      FEF4EE
+ 575 200b FFFEF4EE 		.ascii	"\377\376\364\356\377\376\364\357\377\376\364\357\377\376\364"
+ 575      FFFEF4EF 
+ 575      FFFEF4EF 
+ 575      FFFEF4
+ 576 201a EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377"
+ 576      EFFFFEF4 
+ 576      EFFF
+ 577              		.globl	heatmap_cs_Reds_soft
+ 578              		.section	.data.rel.local
+ 579              		.align 8
+ 580              		.type	heatmap_cs_Reds_soft, @object
+ 581              		.size	heatmap_cs_Reds_soft, 8
+ 582              	heatmap_cs_Reds_soft:
+ 583 0010 00000000 		.quad	soft
+ 583      00000000 
+ 584              		.section	.data.rel.ro.local
+ 585              		.align 16
+ 586              		.type	soft, @object
+ 587              		.size	soft, 16
+ 588              	soft:
+ 589 0020 00000000 		.quad	soft_data
+ 589      00000000 
+ 590 0028 01040000 		.quad	1025
+ 590      00000000 
+ 591              		.section	.rodata
+ 592 2024 00000000 		.align 32
+ 592      00000000 
+ 592      00000000 
+ 592      00000000 
+ 592      00000000 
+ 593              		.type	soft_data, @object
+ 594              		.size	soft_data, 4100
+ 595              	soft_data:
+ 596 2040 00       		.string	""
+ 597 2041 00       		.string	""
+ 598 2042 00       		.string	""
+ 599 2043 00       		.string	""
+ 600 2044 6600     		.string	"f"
+ 601 2046 0C00     		.string	"\f"
+ 602 2048 6700     		.string	"g"
+ 603 204a 0D076700 		.string	"\r\007g"
+ 604 204e 0D0E6800 		.string	"\r\016h"
+ 605 2052 0D166800 		.string	"\r\026h"
+ 606 2056 0D1D6900 		.string	"\r\035i"
+ 607 205a 0D256900 		.string	"\r%i"
+ 608 205e 0D2C6A00 		.string	"\r,j"
+ 609 2062 0D346A00 		.string	"\r4j"
+ 610 2066 0D3B6B00 		.string	"\r;k"
+ 611 206a 0E436B00 		.string	"\016Ck"
+ 612 206e 0E4A6C00 		.string	"\016Jl"
+ 613 2072 0E526C00 		.string	"\016Rl"
+ 614 2076 0E596D00 		.string	"\016Ym"
+ 615 207a 0E616D00 		.string	"\016am"
+ 616 207e 0E686E00 		.string	"\016hn"
+GAS LISTING /tmp/ccmDVY4F.s 			page 40
+
+
+ 617 2082 0E706E00 		.string	"\016pn"
+ 618 2086 0E776F00 		.string	"\016wo"
+ 619 208a 0E7F6F00 		.string	"\016\177o"
+ 620 208e 0E866F00 		.string	"\016\206o"
+ 621 2092 0F8D7001 		.ascii	"\017\215p\001\017\225p\001\017\234q\001\017\244q\001\017\253"
+ 621      0F957001 
+ 621      0F9C7101 
+ 621      0FA47101 
+ 621      0FAB
+ 622 20a4 72010FB3 		.ascii	"r\001\017\263r\001\017\272s\001\017\302s\001\017\311t\001\017"
+ 622      72010FBA 
+ 622      73010FC2 
+ 622      73010FC9 
+ 622      74010F
+ 623 20b7 D174010F 		.ascii	"\321t\001\017\330u\001\017\340u\001\020\347v\001\020\357v\001"
+ 623      D875010F 
+ 623      E0750110 
+ 623      E7760110 
+ 623      EF7601
+ 624 20ca 10F67701 		.ascii	"\020\366w\001\020\376w\002\020\377x\002\020\377x\002\020\377"
+ 624      10FE7702 
+ 624      10FF7802 
+ 624      10FF7802 
+ 624      10FF
+ 625 20dc 790210FF 		.ascii	"y\002\020\377y\002\020\377y\002\020\377z\002\020\377z\002\020"
+ 625      790210FF 
+ 625      790210FF 
+ 625      7A0210FF 
+ 625      7A0210
+ 626 20ef FF7B0210 		.ascii	"\377{\002\020\377{\002\020\377|\002\021\377|\002\021\377}\003"
+ 626      FF7B0210 
+ 626      FF7C0211 
+ 626      FF7C0211 
+ 626      FF7D03
+ 627 2102 11FF7D03 		.ascii	"\021\377}\003\021\377~\003\021\377~\003\021\377\177\003\021\377"
+ 627      11FF7E03 
+ 627      11FF7E03 
+ 627      11FF7F03 
+ 627      11FF
+ 628 2114 7F0311FF 		.ascii	"\177\003\021\377\200\003\021\377\200\003\021\377\201\003\021"
+ 628      800311FF 
+ 628      800311FF 
+ 628      810311
+ 629 2123 FF810311 		.ascii	"\377\201\003\021\377\202\004\021\377\202\004\021\377\203\004"
+ 629      FF820411 
+ 629      FF820411 
+ 629      FF8304
+ 630 2132 11FF8304 		.ascii	"\021\377\203\004\021\377\204\004\022\377\204\004\022\377\205"
+ 630      11FF8404 
+ 630      12FF8404 
+ 630      12FF85
+ 631 2141 0412FF85 		.ascii	"\004\022\377\205\004\022\377\206\004\022\377\206\004\022\377"
+ 631      0412FF86 
+ 631      0412FF86 
+ 631      0412FF
+ 632 2150 870512FF 		.ascii	"\207\005\022\377\207\005\022\377\207\005\022\377\210\005\022"
+ 632      870512FF 
+GAS LISTING /tmp/ccmDVY4F.s 			page 41
+
+
+ 632      870512FF 
+ 632      880512
+ 633 215f FF880512 		.ascii	"\377\210\005\022\377\211\005\022\377\211\005\022\377\212\005"
+ 633      FF890512 
+ 633      FF890512 
+ 633      FF8A05
+ 634 216e 12FF8A06 		.ascii	"\022\377\212\006\022\377\213\006\022\377\213\006\022\377\214"
+ 634      12FF8B06 
+ 634      12FF8B06 
+ 634      12FF8C
+ 635 217d 0612FF8C 		.ascii	"\006\022\377\214\006\022\377\215\006\023\377\215\006\023\377"
+ 635      0612FF8D 
+ 635      0613FF8D 
+ 635      0613FF
+ 636 218c 8E0713FF 		.ascii	"\216\007\023\377\216\007\023\377\217\007\023\377\217\007\023"
+ 636      8E0713FF 
+ 636      8F0713FF 
+ 636      8F0713
+ 637 219b FF900713 		.ascii	"\377\220\007\023\377\220\007\023\377\221\007\023\377\221\b\023"
+ 637      FF900713 
+ 637      FF910713 
+ 637      FF910813 
+ 638 21ab FF920813 		.ascii	"\377\222\b\023\377\222\b\023\377\223\b\023\377\223\b\023\377"
+ 638      FF920813 
+ 638      FF930813 
+ 638      FF930813 
+ 638      FF
+ 639 21bc 940813FF 		.ascii	"\224\b\023\377\224\t\023\377\225\t\023\377\225\t\023\377\226"
+ 639      940913FF 
+ 639      950913FF 
+ 639      950913FF 
+ 639      96
+ 640 21cd 0913FF96 		.ascii	"\t\023\377\226\t\023\377\227\t\023\377\227\n\023\377\230\n\024"
+ 640      0913FF97 
+ 640      0913FF97 
+ 640      0A13FF98 
+ 640      0A14
+ 641 21df FF980A14 		.ascii	"\377\230\n\024\377\231\n\024\377\231\n\024\377\232\013\024\377"
+ 641      FF990A14 
+ 641      FF990A14 
+ 641      FF9A0B14 
+ 641      FF
+ 642 21f0 9A0B14FF 		.ascii	"\232\013\024\377\233\013\024\377\233\013\024\377\234\013\024"
+ 642      9B0B14FF 
+ 642      9B0B14FF 
+ 642      9C0B14
+ 643 21ff FF9C0B14 		.ascii	"\377\234\013\024\377\235\f\024\377\235\f\024\377\236\f\024\377"
+ 643      FF9D0C14 
+ 643      FF9D0C14 
+ 643      FF9E0C14 
+ 643      FF
+ 644 2210 9E0C14FF 		.ascii	"\236\f\024\377\237\f\024\377\237\r\024\377\240\r\024\377\240"
+ 644      9F0C14FF 
+ 644      9F0D14FF 
+ 644      A00D14FF 
+ 644      A0
+ 645 2221 0D14FFA1 		.ascii	"\r\024\377\241\r\024\377\241\r\024\377\242\r\024\377\242\016"
+GAS LISTING /tmp/ccmDVY4F.s 			page 42
+
+
+ 645      0D14FFA1 
+ 645      0D14FFA2 
+ 645      0D14FFA2 
+ 645      0E
+ 646 2232 14FFA30E 		.ascii	"\024\377\243\016\024\377\243\016\024\377\244\016\024\377\244"
+ 646      14FFA30E 
+ 646      14FFA40E 
+ 646      14FFA4
+ 647 2241 0E14FFA4 		.ascii	"\016\024\377\244\017\024\377\245\017\025\377\245\017\025\377"
+ 647      0F14FFA5 
+ 647      0F15FFA5 
+ 647      0F15FF
+ 648 2250 A50F15FF 		.ascii	"\245\017\025\377\246\017\025\377\246\017\025\377\246\017\025"
+ 648      A60F15FF 
+ 648      A60F15FF 
+ 648      A60F15
+ 649 225f FFA70F15 		.ascii	"\377\247\017\025\377\247\017\025\377\247\017\025\377\247\017"
+ 649      FFA70F15 
+ 649      FFA70F15 
+ 649      FFA70F
+ 650 226e 15FFA80F 		.ascii	"\025\377\250\017\025\377\250\017\025\377\250\017\025\377\251"
+ 650      15FFA80F 
+ 650      15FFA80F 
+ 650      15FFA9
+ 651 227d 0F15FFA9 		.ascii	"\017\025\377\251\020\025\377\251\020\025\377\251\020\026\377"
+ 651      1015FFA9 
+ 651      1015FFA9 
+ 651      1016FF
+ 652 228c AA1016FF 		.ascii	"\252\020\026\377\252\020\026\377\252\020\026\377\253\020\026"
+ 652      AA1016FF 
+ 652      AA1016FF 
+ 652      AB1016
+ 653 229b FFAB1016 		.ascii	"\377\253\020\026\377\253\020\026\377\254\020\026\377\254\020"
+ 653      FFAB1016 
+ 653      FFAC1016 
+ 653      FFAC10
+ 654 22aa 16FFAC10 		.ascii	"\026\377\254\020\026\377\254\020\026\377\255\020\026\377\255"
+ 654      16FFAC10 
+ 654      16FFAD10 
+ 654      16FFAD
+ 655 22b9 1116FFAD 		.ascii	"\021\026\377\255\021\026\377\256\021\026\377\256\021\026\377"
+ 655      1116FFAE 
+ 655      1116FFAE 
+ 655      1116FF
+ 656 22c8 AE1117FF 		.ascii	"\256\021\027\377\256\021\027\377\257\021\027\377\257\021\027"
+ 656      AE1117FF 
+ 656      AF1117FF 
+ 656      AF1117
+ 657 22d7 FFAF1117 		.ascii	"\377\257\021\027\377\260\021\027\377\260\021\027\377\260\021"
+ 657      FFB01117 
+ 657      FFB01117 
+ 657      FFB011
+ 658 22e6 17FFB111 		.ascii	"\027\377\261\021\027\377\261\021\027\377\261\021\027\377\261"
+ 658      17FFB111 
+ 658      17FFB111 
+ 658      17FFB1
+ 659 22f5 1217FFB2 		.ascii	"\022\027\377\262\022\027\377\262\022\027\377\262\022\027\377"
+GAS LISTING /tmp/ccmDVY4F.s 			page 43
+
+
+ 659      1217FFB2 
+ 659      1217FFB2 
+ 659      1217FF
+ 660 2304 B31217FF 		.ascii	"\263\022\027\377\263\022\030\377\263\022\030\377\263\022\030"
+ 660      B31218FF 
+ 660      B31218FF 
+ 660      B31218
+ 661 2313 FFB41218 		.ascii	"\377\264\022\030\377\264\022\030\377\264\022\030\377\265\022"
+ 661      FFB41218 
+ 661      FFB41218 
+ 661      FFB512
+ 662 2322 18FFB512 		.ascii	"\030\377\265\022\030\377\265\022\030\377\266\023\030\377\266"
+ 662      18FFB512 
+ 662      18FFB613 
+ 662      18FFB6
+ 663 2331 1318FFB6 		.ascii	"\023\030\377\266\023\030\377\266\023\030\377\267\023\030\377"
+ 663      1318FFB6 
+ 663      1318FFB7 
+ 663      1318FF
+ 664 2340 B71318FF 		.ascii	"\267\023\030\377\267\023\030\377\270\023\031\377\270\023\031"
+ 664      B71318FF 
+ 664      B81319FF 
+ 664      B81319
+ 665 234f FFB81319 		.ascii	"\377\270\023\031\377\271\023\031\377\271\023\031\377\271\023"
+ 665      FFB91319 
+ 665      FFB91319 
+ 665      FFB913
+ 666 235e 19FFB913 		.ascii	"\031\377\271\023\031\377\272\024\031\377\272\024\031\377\272"
+ 666      19FFBA14 
+ 666      19FFBA14 
+ 666      19FFBA
+ 667 236d 1419FFBB 		.ascii	"\024\031\377\273\024\031\377\273\024\031\377\273\024\031\377"
+ 667      1419FFBB 
+ 667      1419FFBB 
+ 667      1419FF
+ 668 237c BB1419FF 		.ascii	"\273\024\031\377\274\024\031\377\274\024\031\377\274\024\032"
+ 668      BC1419FF 
+ 668      BC1419FF 
+ 668      BC141A
+ 669 238b FFBD141A 		.ascii	"\377\275\024\032\377\275\024\032\377\275\024\032\377\276\024"
+ 669      FFBD141A 
+ 669      FFBD141A 
+ 669      FFBE14
+ 670 239a 1AFFBE15 		.ascii	"\032\377\276\025\032\377\276\025\032\377\276\025\032\377\277"
+ 670      1AFFBE15 
+ 670      1AFFBE15 
+ 670      1AFFBF
+ 671 23a9 151AFFBF 		.ascii	"\025\032\377\277\025\032\377\277\025\032\377\300\025\032\377"
+ 671      151AFFBF 
+ 671      151AFFC0 
+ 671      151AFF
+ 672 23b8 C0151AFF 		.ascii	"\300\025\032\377\300\025\032\377\301\025\032\377\301\025\032"
+ 672      C0151AFF 
+ 672      C1151AFF 
+ 672      C1151A
+ 673 23c7 FFC1151B 		.ascii	"\377\301\025\033\377\301\025\033\377\302\025\033\377\302\026"
+ 673      FFC1151B 
+GAS LISTING /tmp/ccmDVY4F.s 			page 44
+
+
+ 673      FFC2151B 
+ 673      FFC216
+ 674 23d6 1BFFC216 		.ascii	"\033\377\302\026\033\377\303\026\033\377\303\026\033\377\303"
+ 674      1BFFC316 
+ 674      1BFFC316 
+ 674      1BFFC3
+ 675 23e5 161BFFC4 		.ascii	"\026\033\377\304\026\033\377\304\026\033\377\304\026\033\377"
+ 675      161BFFC4 
+ 675      161BFFC4 
+ 675      161BFF
+ 676 23f4 C4161BFF 		.ascii	"\304\026\033\377\305\026\033\377\305\026\033\377\305\026\033"
+ 676      C5161BFF 
+ 676      C5161BFF 
+ 676      C5161B
+ 677 2403 FFC6161B 		.ascii	"\377\306\026\033\377\306\026\034\377\306\027\034\377\307\027"
+ 677      FFC6161C 
+ 677      FFC6171C 
+ 677      FFC717
+ 678 2412 1CFFC717 		.ascii	"\034\377\307\027\034\377\307\027\034\377\307\027\034\377\310"
+ 678      1CFFC717 
+ 678      1CFFC717 
+ 678      1CFFC8
+ 679 2421 171CFFC8 		.ascii	"\027\034\377\310\027\034\377\310\027\034\377\311\027\034\377"
+ 679      171CFFC8 
+ 679      171CFFC9 
+ 679      171CFF
+ 680 2430 C9171CFF 		.ascii	"\311\027\034\377\311\027\034\377\312\027\034\377\312\027\034"
+ 680      C9171CFF 
+ 680      CA171CFF 
+ 680      CA171C
+ 681 243f FFCA171C 		.ascii	"\377\312\027\034\377\312\030\034\377\313\030\035\377\313\030"
+ 681      FFCA181C 
+ 681      FFCB181D 
+ 681      FFCB18
+ 682 244e 1DFFCB19 		.ascii	"\035\377\313\031\035\377\314\031\035\377\314\031\035\377\314"
+ 682      1DFFCC19 
+ 682      1DFFCC19 
+ 682      1DFFCC
+ 683 245d 1A1DFFCC 		.ascii	"\032\035\377\314\032\035\377\315\032\035\377\315\033\036\377"
+ 683      1A1DFFCD 
+ 683      1A1DFFCD 
+ 683      1B1EFF
+ 684 246c CD1B1EFF 		.ascii	"\315\033\036\377\316\033\036\377\316\034\036\377\316\034\036"
+ 684      CE1B1EFF 
+ 684      CE1C1EFF 
+ 684      CE1C1E
+ 685 247b FFCE1C1E 		.ascii	"\377\316\034\036\377\317\035\036\377\317\035\036\377\317\035"
+ 685      FFCF1D1E 
+ 685      FFCF1D1E 
+ 685      FFCF1D
+ 686 248a 1EFFD01D 		.ascii	"\036\377\320\035\037\377\320\036\037\377\320\036\037\377\320"
+ 686      1FFFD01E 
+ 686      1FFFD01E 
+ 686      1FFFD0
+ 687 2499 1E1FFFD1 		.ascii	"\036\037\377\321\037\037\377\321\037\037\377\321\037\037\377"
+ 687      1F1FFFD1 
+ 687      1F1FFFD1 
+GAS LISTING /tmp/ccmDVY4F.s 			page 45
+
+
+ 687      1F1FFF
+ 688 24a8 D1201FFF 		.ascii	"\321 \037\377\322  \377\322  \377\322! \377\323! \377\323! \377"
+ 688      D22020FF 
+ 688      D22020FF 
+ 688      D22120FF 
+ 688      D32120FF 
+ 689 24c0 D32120FF 		.ascii	"\323! \377\323\" \377\324\" \377\324\" \377\324#!\377\325#!\377"
+ 689      D32220FF 
+ 689      D42220FF 
+ 689      D42220FF 
+ 689      D42321FF 
+ 690 24d8 D52321FF 		.ascii	"\325#!\377\325#!\377\325$!\377\326$!\377\326$!\377\326%!\377"
+ 690      D52321FF 
+ 690      D52421FF 
+ 690      D62421FF 
+ 690      D62421FF 
+ 691 24f0 D72521FF 		.ascii	"\327%!\377\327%\"\377\327%\"\377\327&\"\377\330&\"\377\330&\""
+ 691      D72522FF 
+ 691      D72522FF 
+ 691      D72622FF 
+ 691      D82622FF 
+ 692 2507 FFD82722 		.ascii	"\377\330'\"\377\330'\"\377\331'\"\377\331'#\377\331(#\377\332"
+ 692      FFD82722 
+ 692      FFD92722 
+ 692      FFD92723 
+ 692      FFD92823 
+ 693 251d 2823FFDA 		.ascii	"(#\377\332(#\377\332(#\377\332)#\377\333)#\377\333)#\377\333"
+ 693      2823FFDA 
+ 693      2823FFDA 
+ 693      2923FFDB 
+ 693      2923FFDB 
+ 694 2535 2A23FFDC 		.ascii	"*#\377\334*$\377\334*$\377\334*$\377\334+$\377\335+$\377\335"
+ 694      2A24FFDC 
+ 694      2A24FFDC 
+ 694      2A24FFDC 
+ 694      2B24FFDD 
+ 695 254d 2B24FFDD 		.ascii	"+$\377\335+$\377\336,$\377\336,%\377\336,%\377\336,%\377\337"
+ 695      2B24FFDE 
+ 695      2C24FFDE 
+ 695      2C25FFDE 
+ 695      2C25FFDE 
+ 696 2565 2D25FFDF 		.ascii	"-%\377\337-%\377\337-%\377\340-%\377\340.%\377\340.%\377\340"
+ 696      2D25FFDF 
+ 696      2D25FFE0 
+ 696      2D25FFE0 
+ 696      2E25FFE0 
+ 697 257d 2E26FFE1 		.ascii	".&\377\341.&\377\341/&\377\341/&\377\341/&\377\342/&\377\342"
+ 697      2E26FFE1 
+ 697      2F26FFE1 
+ 697      2F26FFE1 
+ 697      2F26FFE2 
+ 698 2595 3026FFE2 		.ascii	"0&\377\3420&\377\3430'\377\3430'\377\3431'\377\3431'\377\344"
+ 698      3026FFE3 
+ 698      3027FFE3 
+ 698      3027FFE3 
+ 698      3127FFE3 
+ 699 25ad 3127FFE4 		.ascii	"1'\377\3441'\377\3442'\377\3452'\377\3452'\377\3452(\377\345"
+GAS LISTING /tmp/ccmDVY4F.s 			page 46
+
+
+ 699      3127FFE4 
+ 699      3227FFE5 
+ 699      3227FFE5 
+ 699      3227FFE5 
+ 700 25c5 3328FFE6 		.ascii	"3(\377\3463(\377\3463(\377\3463(\377\3474(\377\3474(\377\347"
+ 700      3328FFE6 
+ 700      3328FFE6 
+ 700      3328FFE7 
+ 700      3428FFE7 
+ 701 25dd 3428FFE7 		.ascii	"4(\377\3474)\377\3505)\377\3505)\377\3505)\377\3515)\377\351"
+ 701      3429FFE8 
+ 701      3529FFE8 
+ 701      3529FFE8 
+ 701      3529FFE9 
+ 702 25f5 3629FFE9 		.ascii	"6)\377\3516)\377\3516)\377\3526)\377\3527*\377\3527*\377\353"
+ 702      3629FFE9 
+ 702      3629FFEA 
+ 702      3629FFEA 
+ 702      372AFFEA 
+ 703 260d 372AFFEB 		.ascii	"7*\377\3537*\377\3538*\377\3538*\377\3548*\377\3548*\377\354"
+ 703      372AFFEB 
+ 703      382AFFEB 
+ 703      382AFFEC 
+ 703      382AFFEC 
+ 704 2625 392BFFED 		.ascii	"9+\377\3559+\377\3559+\377\3559+\377\355:+\377\356:+\377\356"
+ 704      392BFFED 
+ 704      392BFFED 
+ 704      392BFFED 
+ 704      3A2BFFEE 
+ 705 263d 3A2BFFEE 		.ascii	":+\377\356:+\377\356;+\377\357;,\377\357;,\377\357<,\377\357"
+ 705      3A2BFFEE 
+ 705      3B2BFFEF 
+ 705      3B2CFFEF 
+ 705      3B2CFFEF 
+ 706 2655 3C2CFFEF 		.ascii	"<,\377\357=-\377\357=-\377\357>-\377\357>-\377\357?-\377\357"
+ 706      3D2DFFEF 
+ 706      3D2DFFEF 
+ 706      3E2DFFEF 
+ 706      3E2DFFEF 
+ 707 266d 3F2EFFF0 		.ascii	"?.\377\360?.\377\360@.\377\360@.\377\360A/\377\360A/\377\360"
+ 707      3F2EFFF0 
+ 707      402EFFF0 
+ 707      402EFFF0 
+ 707      412FFFF0 
+ 708 2685 422FFFF0 		.ascii	"B/\377\360B/\377\360B0\377\360C0\377\360C0\377\361D0\377\361"
+ 708      422FFFF0 
+ 708      4230FFF0 
+ 708      4330FFF0 
+ 708      4330FFF1 
+ 709 269d 4430FFF1 		.ascii	"D0\377\361D1\377\361E1\377\361E1\377\361F1\377\361F2\377\361"
+ 709      4431FFF1 
+ 709      4531FFF1 
+ 709      4531FFF1 
+ 709      4631FFF1 
+ 710 26b5 4632FFF1 		.ascii	"F2\377\361G2\377\361G2\377\362H2\377\362H3\377\362H3\377\362"
+ 710      4732FFF1 
+ 710      4732FFF2 
+GAS LISTING /tmp/ccmDVY4F.s 			page 47
+
+
+ 710      4832FFF2 
+ 710      4833FFF2 
+ 711 26cd 4933FFF2 		.ascii	"I3\377\362I3\377\362J4\377\362J4\377\362J4\377\362K4\377\362"
+ 711      4933FFF2 
+ 711      4A34FFF2 
+ 711      4A34FFF2 
+ 711      4A34FFF2 
+ 712 26e5 4B34FFF3 		.ascii	"K4\377\363L5\377\363L5\377\363L5\377\363M5\377\363M6\377\363"
+ 712      4C35FFF3 
+ 712      4C35FFF3 
+ 712      4C35FFF3 
+ 712      4D35FFF3 
+ 713 26fd 4D36FFF3 		.ascii	"M6\377\363N6\377\363N6\377\363O7\377\363O7\377\363O7\377\364"
+ 713      4E36FFF3 
+ 713      4E36FFF3 
+ 713      4F37FFF3 
+ 713      4F37FFF3 
+ 714 2715 5037FFF4 		.ascii	"P7\377\364P7\377\364P8\377\364Q8\377\364Q8\377\364R8\377\364"
+ 714      5037FFF4 
+ 714      5038FFF4 
+ 714      5138FFF4 
+ 714      5138FFF4 
+ 715 272d 5239FFF4 		.ascii	"R9\377\364R9\377\364S9\377\364S9\377\365S:\377\365T:\377\365"
+ 715      5239FFF4 
+ 715      5339FFF4 
+ 715      5339FFF5 
+ 715      533AFFF5 
+ 716 2745 543AFFF5 		.ascii	"T:\377\365T:\377\365U;\377\365U;\377\365V;\377\365V;\377\365"
+ 716      543AFFF5 
+ 716      553BFFF5 
+ 716      553BFFF5 
+ 716      563BFFF5 
+ 717 275d 563BFFF5 		.ascii	"V;\377\365W<\377\365W<\377\366W<\377\366X<\377\366X=\377\366"
+ 717      573CFFF5 
+ 717      573CFFF6 
+ 717      573CFFF6 
+ 717      583CFFF6 
+ 718 2775 583DFFF6 		.ascii	"X=\377\366Y=\377\366Y=\377\366Y>\377\366Z>\377\366Z>\377\366"
+ 718      593DFFF6 
+ 718      593DFFF6 
+ 718      593EFFF6 
+ 718      5A3EFFF6 
+ 719 278d 5A3EFFF6 		.ascii	"Z>\377\366[?\377\367[?\377\367[?\377\367\\?\377\367\\@\377\367"
+ 719      5B3FFFF7 
+ 719      5B3FFFF7 
+ 719      5B3FFFF7 
+ 719      5C3FFFF7 
+ 720 27a5 5C40FFF7 		.ascii	"\\@\377\367]@\377\367]@\377\367]@\377\367^A\377\367^A\377\367"
+ 720      5D40FFF7 
+ 720      5D40FFF7 
+ 720      5D40FFF7 
+ 720      5E41FFF7 
+ 721 27bd 5E41FFF8 		.ascii	"^A\377\370_A\377\370_B\377\370_B\377\370`B\377\370`B\377\370"
+ 721      5F41FFF8 
+ 721      5F42FFF8 
+ 721      5F42FFF8 
+ 721      6042FFF8 
+GAS LISTING /tmp/ccmDVY4F.s 			page 48
+
+
+ 722 27d5 6043FFF8 		.ascii	"`C\377\370aC\377\370aC\377\370aC\377\370bD\377\370bD\377\371"
+ 722      6143FFF8 
+ 722      6143FFF8 
+ 722      6143FFF8 
+ 722      6244FFF8 
+ 723 27ed 6244FFF9 		.ascii	"bD\377\371cD\377\371cE\377\371cE\377\371dE\377\371dE\377\371"
+ 723      6344FFF9 
+ 723      6345FFF9 
+ 723      6345FFF9 
+ 723      6445FFF9 
+ 724 2805 6446FFF9 		.ascii	"dF\377\371eF\377\371eF\377"
+ 724      6546FFF9 
+ 724      6546FF
+ 725 2810 F96546FF 		.ascii	"\371eF\377\371fG\377\372fG\377\372fG\377\372gG\377\372gH\377"
+ 725      F96647FF 
+ 725      FA6647FF 
+ 725      FA6647FF 
+ 725      FA6747FF 
+ 726 2828 FA6748FF 		.ascii	"\372gH\377\372hH\377\372hH\377\372hI\377\372iI\377\372iI\377"
+ 726      FA6848FF 
+ 726      FA6848FF 
+ 726      FA6849FF 
+ 726      FA6949FF 
+ 727 2840 FA6949FF 		.ascii	"\372iI\377\372jI\377\373jJ\377\373jJ\377\373kJ\377\373kK\377"
+ 727      FA6A49FF 
+ 727      FB6A4AFF 
+ 727      FB6A4AFF 
+ 727      FB6B4AFF 
+ 728 2858 FB6B4BFF 		.ascii	"\373kK\377\373lK\377\373lL\377\373lL\377\373mL\377\373mL\377"
+ 728      FB6C4BFF 
+ 728      FB6C4CFF 
+ 728      FB6C4CFF 
+ 728      FB6D4CFF 
+ 729 2870 FB6D4DFF 		.ascii	"\373mM\377\373nM\377\373nM\377\373nN\377\373oN\377\373oN\377"
+ 729      FB6E4DFF 
+ 729      FB6E4DFF 
+ 729      FB6E4EFF 
+ 729      FB6F4EFF 
+ 730 2888 FB6F4FFF 		.ascii	"\373oO\377\373pO\377\373pO\377\373pP\377\373qP\377\373qP\377"
+ 730      FB704FFF 
+ 730      FB704FFF 
+ 730      FB7050FF 
+ 730      FB7150FF 
+ 731 28a0 FB7150FF 		.ascii	"\373qP\377\373rQ\377\373rQ\377\373rQ\377\373sR\377\373sR\377"
+ 731      FB7251FF 
+ 731      FB7251FF 
+ 731      FB7251FF 
+ 731      FB7352FF 
+ 732 28b8 FB7352FF 		.ascii	"\373sR\377\373tS\377\373tS\377\373tS\377\373tS\377\373uT\377"
+ 732      FB7453FF 
+ 732      FB7453FF 
+ 732      FB7453FF 
+ 732      FB7453FF 
+ 733 28d0 FB7554FF 		.ascii	"\373uT\377\373uT\377\373vU\377\373vU\377\373vU\377\373wV\377"
+ 733      FB7554FF 
+ 733      FB7655FF 
+ 733      FB7655FF 
+GAS LISTING /tmp/ccmDVY4F.s 			page 49
+
+
+ 733      FB7655FF 
+ 734 28e8 FB7756FF 		.ascii	"\373wV\377\373wV\377\373xW\377\373xW\377\373xW\377\373yW\377"
+ 734      FB7756FF 
+ 734      FB7857FF 
+ 734      FB7857FF 
+ 734      FB7857FF 
+ 735 2900 FB7958FF 		.ascii	"\373yX\377\373yX\377\373zX\377\373zY\377\373zY\377\373{Y\377"
+ 735      FB7958FF 
+ 735      FB7A58FF 
+ 735      FB7A59FF 
+ 735      FB7A59FF 
+ 736 2918 FB7B5AFF 		.ascii	"\373{Z\377\373{Z\377\373{Z\377\373|[\377\373|[\377\373|[\377"
+ 736      FB7B5AFF 
+ 736      FB7B5AFF 
+ 736      FB7C5BFF 
+ 736      FB7C5BFF 
+ 737 2930 FB7D5BFF 		.ascii	"\373}[\377\373}\\\377\373}\\\377\373~\\\377\373~]\377\373~]\377"
+ 737      FB7D5CFF 
+ 737      FB7D5CFF 
+ 737      FB7E5CFF 
+ 737      FB7E5DFF 
+ 738 2948 FB7F5DFF 		.ascii	"\373\177]\377\373\177^\377\373\177^\377\373\200^\377\373\200"
+ 738      FB7F5EFF 
+ 738      FB7F5EFF 
+ 738      FB805EFF 
+ 738      FB80
+ 739 295a 5FFFFB80 		.ascii	"_\377\373\200_\377\373\200_\377\373\201`\377\373\201`\377\373"
+ 739      5FFFFB80 
+ 739      5FFFFB81 
+ 739      60FFFB81 
+ 739      60FFFB
+ 740 296d 8160FFFB 		.ascii	"\201`\377\373\202`\377\373\202a\377\374\202a\377\374\203a\377"
+ 740      8260FFFB 
+ 740      8261FFFC 
+ 740      8261FFFC 
+ 740      8361FF
+ 741 2980 FC8362FF 		.ascii	"\374\203b\377\374\203b\377\374\204b\377\374\204c\377\374\204"
+ 741      FC8362FF 
+ 741      FC8462FF 
+ 741      FC8463FF 
+ 741      FC84
+ 742 2992 63FFFC84 		.ascii	"c\377\374\204c\377\374\205d\377\374\205d\377\374\205d\377\374"
+ 742      63FFFC85 
+ 742      64FFFC85 
+ 742      64FFFC85 
+ 742      64FFFC
+ 743 29a5 8665FFFC 		.ascii	"\206e\377\374\206e\377\374\206e\377\374\207f\377\374\207f\377"
+ 743      8665FFFC 
+ 743      8665FFFC 
+ 743      8766FFFC 
+ 743      8766FF
+ 744 29b8 FC8766FF 		.ascii	"\374\207f\377\374\207f\377\374\210g\377\374\210g\377\374\210"
+ 744      FC8766FF 
+ 744      FC8867FF 
+ 744      FC8867FF 
+ 744      FC88
+ 745 29ca 67FFFC89 		.ascii	"g\377\374\211h\377\374\211h\377\374\211h\377\374\212i\377\374"
+GAS LISTING /tmp/ccmDVY4F.s 			page 50
+
+
+ 745      68FFFC89 
+ 745      68FFFC89 
+ 745      68FFFC8A 
+ 745      69FFFC
+ 746 29dd 8A69FFFC 		.ascii	"\212i\377\374\212i\377\374\212j\377\374\213j\377\374\213j\377"
+ 746      8A69FFFC 
+ 746      8A6AFFFC 
+ 746      8B6AFFFC 
+ 746      8B6AFF
+ 747 29f0 FC8B6BFF 		.ascii	"\374\213k\377\374\214k\377\374\214k\377\374\214l\377\374\215"
+ 747      FC8C6BFF 
+ 747      FC8C6BFF 
+ 747      FC8C6CFF 
+ 747      FC8D
+ 748 2a02 6CFFFC8D 		.ascii	"l\377\374\215l\377\374\215m\377\374\215m\377\374\216m\377\374"
+ 748      6CFFFC8D 
+ 748      6DFFFC8D 
+ 748      6DFFFC8E 
+ 748      6DFFFC
+ 749 2a15 8E6EFFFC 		.ascii	"\216n\377\374\216n\377\374\217n\377\374\217o\377\374\217o\377"
+ 749      8E6EFFFC 
+ 749      8F6EFFFC 
+ 749      8F6FFFFC 
+ 749      8F6FFF
+ 750 2a28 FC8F6FFF 		.ascii	"\374\217o\377\374\220p\377\374\220p\377\374\220p\377\374\221"
+ 750      FC9070FF 
+ 750      FC9070FF 
+ 750      FC9070FF 
+ 750      FC91
+ 751 2a3a 71FFFC91 		.ascii	"q\377\374\221q\377\374\221q\377\373\222q\377\374\222r\377\374"
+ 751      71FFFC91 
+ 751      71FFFB92 
+ 751      71FFFC92 
+ 751      72FFFC
+ 752 2a4d 9272FFFC 		.ascii	"\222r\377\374\223s\377\374\223s\377\374\223s\377\374\224t\377"
+ 752      9373FFFC 
+ 752      9373FFFC 
+ 752      9373FFFC 
+ 752      9474FF
+ 753 2a60 FC9474FF 		.ascii	"\374\224t\377\374\224t\377\374\225u\377\374\225u\377\374\225"
+ 753      FC9474FF 
+ 753      FC9575FF 
+ 753      FC9575FF 
+ 753      FC95
+ 754 2a72 75FFFC96 		.ascii	"u\377\374\226v\377\374\226v\377\374\226v\377\374\227w\377\374"
+ 754      76FFFC96 
+ 754      76FFFC96 
+ 754      76FFFC97 
+ 754      77FFFC
+ 755 2a85 9777FFFC 		.ascii	"\227w\377\374\227w\377\374\230x\377\374\230x\377\374\230x\377"
+ 755      9777FFFC 
+ 755      9878FFFC 
+ 755      9878FFFC 
+ 755      9878FF
+ 756 2a98 FC9879FF 		.ascii	"\374\230y\377\374\231y\377\374\231y\377\374\231z\377\374\232"
+ 756      FC9979FF 
+ 756      FC9979FF 
+GAS LISTING /tmp/ccmDVY4F.s 			page 51
+
+
+ 756      FC997AFF 
+ 756      FC9A
+ 757 2aaa 7AFFFC9A 		.ascii	"z\377\374\232z\377\374\232{\377\374\233{\377\374\233|\377\374"
+ 757      7AFFFC9A 
+ 757      7BFFFC9B 
+ 757      7BFFFC9B 
+ 757      7CFFFC
+ 758 2abd 9B7CFFFC 		.ascii	"\233|\377\374\234|\377\374\234}\377\374\234}\377\374\235}\377"
+ 758      9C7CFFFC 
+ 758      9C7DFFFC 
+ 758      9C7DFFFC 
+ 758      9D7DFF
+ 759 2ad0 FC9D7EFF 		.ascii	"\374\235~\377\374\235~\377\374\236~\377\374\236\177\377\374\236"
+ 759      FC9D7EFF 
+ 759      FC9E7EFF 
+ 759      FC9E7FFF 
+ 759      FC9E
+ 760 2ae2 7FFFFC9F 		.ascii	"\177\377\374\237\177\377\374\237\200\377\374\237\200\377\374"
+ 760      7FFFFC9F 
+ 760      80FFFC9F 
+ 760      80FFFC
+ 761 2af1 A080FFFC 		.ascii	"\240\200\377\374\240\201\377\374\240\201\377\374\241\202\377"
+ 761      A081FFFC 
+ 761      A081FFFC 
+ 761      A182FF
+ 762 2b00 FCA182FF 		.ascii	"\374\241\202\377\374\241\202\377\374\242\203\377\374\242\203"
+ 762      FCA182FF 
+ 762      FCA283FF 
+ 762      FCA283
+ 763 2b0f FFFCA283 		.ascii	"\377\374\242\203\377\374\243\204\377\374\243\204\377\374\243"
+ 763      FFFCA384 
+ 763      FFFCA384 
+ 763      FFFCA3
+ 764 2b1e 84FFFCA4 		.ascii	"\204\377\374\244\205\377\374\244\205\377\374\244\206\377\374"
+ 764      85FFFCA4 
+ 764      85FFFCA4 
+ 764      86FFFC
+ 765 2b2d A586FFFC 		.ascii	"\245\206\377\374\245\206\377\374\245\207\377\374\245\207\377"
+ 765      A586FFFC 
+ 765      A587FFFC 
+ 765      A587FF
+ 766 2b3c FCA687FF 		.ascii	"\374\246\207\377\374\246\210\377\374\246\210\377\374\247\210"
+ 766      FCA688FF 
+ 766      FCA688FF 
+ 766      FCA788
+ 767 2b4b FFFCA789 		.ascii	"\377\374\247\211\377\374\247\211\377\374\250\212\377\374\250"
+ 767      FFFCA789 
+ 767      FFFCA88A 
+ 767      FFFCA8
+ 768 2b5a 8AFFFCA8 		.ascii	"\212\377\374\250\212\377\374\251\213\377\374\251\213\377\374"
+ 768      8AFFFCA9 
+ 768      8BFFFCA9 
+ 768      8BFFFC
+ 769 2b69 A98BFFFC 		.ascii	"\251\213\377\374\252\214\377\374\252\214\377\374\252\215\377"
+ 769      AA8CFFFC 
+ 769      AA8CFFFC 
+ 769      AA8DFF
+GAS LISTING /tmp/ccmDVY4F.s 			page 52
+
+
+ 770 2b78 FCAB8DFF 		.ascii	"\374\253\215\377\374\253\215\377\374\253\216\377\374\254\216"
+ 770      FCAB8DFF 
+ 770      FCAB8EFF 
+ 770      FCAC8E
+ 771 2b87 FFFCAC8E 		.ascii	"\377\374\254\216\377\374\254\217\377\374\254\217\377\374\255"
+ 771      FFFCAC8F 
+ 771      FFFCAC8F 
+ 771      FFFCAD
+ 772 2b96 90FFFCAD 		.ascii	"\220\377\374\255\220\377\374\255\220\377\374\256\221\377\374"
+ 772      90FFFCAD 
+ 772      90FFFCAE 
+ 772      91FFFC
+ 773 2ba5 AE91FFFC 		.ascii	"\256\221\377\374\256\221\377\374\257\222\377\374\257\222\377"
+ 773      AE91FFFC 
+ 773      AF92FFFC 
+ 773      AF92FF
+ 774 2bb4 FCAF93FF 		.ascii	"\374\257\223\377\374\260\223\377\374\260\223\377\374\260\224"
+ 774      FCB093FF 
+ 774      FCB093FF 
+ 774      FCB094
+ 775 2bc3 FFFCB194 		.ascii	"\377\374\261\224\377\374\261\224\377\374\261\225\377\374\261"
+ 775      FFFCB194 
+ 775      FFFCB195 
+ 775      FFFCB1
+ 776 2bd2 95FFFCB2 		.ascii	"\225\377\374\262\226\377\374\262\226\377\374\262\226\377\374"
+ 776      96FFFCB2 
+ 776      96FFFCB2 
+ 776      96FFFC
+ 777 2be1 B397FFFC 		.ascii	"\263\227\377\374\263\227\377\374\263\230\377\374\264\230\377"
+ 777      B397FFFC 
+ 777      B398FFFC 
+ 777      B498FF
+ 778 2bf0 FCB498FF 		.ascii	"\374\264\230\377\374\264\231\377\374\265\231\377\374\265\231"
+ 778      FCB499FF 
+ 778      FCB599FF 
+ 778      FCB599
+ 779 2bff FFFCB59A 		.ascii	"\377\374\265\232\377\374\266\232\377\374\266\233\377\374\266"
+ 779      FFFCB69A 
+ 779      FFFCB69B 
+ 779      FFFCB6
+ 780 2c0e 9BFFFCB6 		.ascii	"\233\377\374\266\233\377\374\267\234\377\374\267\234\377\374"
+ 780      9BFFFCB7 
+ 780      9CFFFCB7 
+ 780      9CFFFC
+ 781 2c1d B79DFFFC 		.ascii	"\267\235\377\374\270\235\377\374\270\235\377\374\270\236\377"
+ 781      B89DFFFC 
+ 781      B89DFFFC 
+ 781      B89EFF
+ 782 2c2c FCB99EFF 		.ascii	"\374\271\236\377\374\271\237\377\374\271\237\377\374\272\237"
+ 782      FCB99FFF 
+ 782      FCB99FFF 
+ 782      FCBA9F
+ 783 2c3b FFFCBAA0 		.ascii	"\377\374\272\240\377\374\272\240\377\373\273\240\377\374\273"
+ 783      FFFCBAA0 
+ 783      FFFBBBA0 
+ 783      FFFCBB
+ 784 2c4a A1FFFCBB 		.ascii	"\241\377\374\273\241\377\374\273\242\377\374\274\242\377\374"
+GAS LISTING /tmp/ccmDVY4F.s 			page 53
+
+
+ 784      A1FFFCBB 
+ 784      A2FFFCBC 
+ 784      A2FFFC
+ 785 2c59 BCA2FFFC 		.ascii	"\274\242\377\374\274\243\377\374\275\243\377\374\275\243\377"
+ 785      BCA3FFFC 
+ 785      BDA3FFFC 
+ 785      BDA3FF
+ 786 2c68 FCBDA4FF 		.ascii	"\374\275\244\377\374\275\244\377\374\276\245\377\374\276\245"
+ 786      FCBDA4FF 
+ 786      FCBEA5FF 
+ 786      FCBEA5
+ 787 2c77 FFFCBEA5 		.ascii	"\377\374\276\245\377\374\277\246\377\374\277\246\377\374\277"
+ 787      FFFCBFA6 
+ 787      FFFCBFA6 
+ 787      FFFCBF
+ 788 2c86 A6FFFCBF 		.ascii	"\246\377\374\277\247\377\374\300\247\377\374\300\247\377\374"
+ 788      A7FFFCC0 
+ 788      A7FFFCC0 
+ 788      A7FFFC
+ 789 2c95 C0A8FFFC 		.ascii	"\300\250\377\374\301\250\377\374\301\251\377\374\301\251\377"
+ 789      C1A8FFFC 
+ 789      C1A9FFFC 
+ 789      C1A9FF
+ 790 2ca4 FCC2A9FF 		.ascii	"\374\302\251\377\374\302\252\377\374\302\252\377\374\302\252"
+ 790      FCC2AAFF 
+ 790      FCC2AAFF 
+ 790      FCC2AA
+ 791 2cb3 FFFCC3AB 		.ascii	"\377\374\303\253\377\374\303\253\377\374\303\254\377\374\304"
+ 791      FFFCC3AB 
+ 791      FFFCC3AC 
+ 791      FFFCC4
+ 792 2cc2 ACFFFCC4 		.ascii	"\254\377\374\304\254\377\374\304\255\377\374\304\255\377\374"
+ 792      ACFFFCC4 
+ 792      ADFFFCC4 
+ 792      ADFFFC
+ 793 2cd1 C5ADFFFC 		.ascii	"\305\255\377\374\305\256\377\374\305\256\377\374\306\256\377"
+ 793      C5AEFFFC 
+ 793      C5AEFFFC 
+ 793      C6AEFF
+ 794 2ce0 FCC6AFFF 		.ascii	"\374\306\257\377\374\306\257\377\375\306\260\377\375\307\260"
+ 794      FCC6AFFF 
+ 794      FDC6B0FF 
+ 794      FDC7B0
+ 795 2cef FFFDC7B0 		.ascii	"\377\375\307\260\377\375\307\261\377\375\310\261\377\375\310"
+ 795      FFFDC7B1 
+ 795      FFFDC8B1 
+ 795      FFFDC8
+ 796 2cfe B1FFFDC8 		.ascii	"\261\377\375\310\262\377\375\311\262\377\375\311\263\377\375"
+ 796      B2FFFDC9 
+ 796      B2FFFDC9 
+ 796      B3FFFD
+ 797 2d0d C9B3FFFD 		.ascii	"\311\263\377\375\311\263\377\375\312\264\377\375\312\264\377"
+ 797      C9B3FFFD 
+ 797      CAB4FFFD 
+ 797      CAB4FF
+ 798 2d1c FDCAB5FF 		.ascii	"\375\312\265\377\375\313\265\377\375\313\265\377\375\313\266"
+ 798      FDCBB5FF 
+GAS LISTING /tmp/ccmDVY4F.s 			page 54
+
+
+ 798      FDCBB5FF 
+ 798      FDCBB6
+ 799 2d2b FFFDCBB6 		.ascii	"\377\375\313\266\377\375\314\266\377\375\314\267\377\375\314"
+ 799      FFFDCCB6 
+ 799      FFFDCCB7 
+ 799      FFFDCC
+ 800 2d3a B7FFFDCD 		.ascii	"\267\377\375\315\270\377\375\315\270\377\375\315\270\377\375"
+ 800      B8FFFDCD 
+ 800      B8FFFDCD 
+ 800      B8FFFD
+ 801 2d49 CDB9FFFD 		.ascii	"\315\271\377\375\316\271\377\375\316\271\377\375\316\272\377"
+ 801      CEB9FFFD 
+ 801      CEB9FFFD 
+ 801      CEBAFF
+ 802 2d58 FDCFBAFF 		.ascii	"\375\317\272\377\375\317\273\377\375\317\273\377\375\317\273"
+ 802      FDCFBBFF 
+ 802      FDCFBBFF 
+ 802      FDCFBB
+ 803 2d67 FFFDD0BC 		.ascii	"\377\375\320\274\377\375\320\274\377\375\320\275\377\375\321"
+ 803      FFFDD0BC 
+ 803      FFFDD0BD 
+ 803      FFFDD1
+ 804 2d76 BDFFFDD1 		.ascii	"\275\377\375\321\275\377\375\321\276\377\375\321\276\377\375"
+ 804      BDFFFDD1 
+ 804      BEFFFDD1 
+ 804      BEFFFD
+ 805 2d85 D2BFFFFD 		.ascii	"\322\277\377\375\322\277\377\375\322\277\377\375\323\300\377"
+ 805      D2BFFFFD 
+ 805      D2BFFFFD 
+ 805      D3C0FF
+ 806 2d94 FDD3C0FF 		.ascii	"\375\323\300\377\375\323\300\377\375\323\301\377\375\324\301"
+ 806      FDD3C0FF 
+ 806      FDD3C1FF 
+ 806      FDD4C1
+ 807 2da3 FFFDD4C2 		.ascii	"\377\375\324\302\377\375\324\302\377\375\325\302\377\375\325"
+ 807      FFFDD4C2 
+ 807      FFFDD5C2 
+ 807      FFFDD5
+ 808 2db2 C3FFFDD5 		.ascii	"\303\377\375\325\303\377\375\325\304\377\375\326\304\377\375"
+ 808      C3FFFDD5 
+ 808      C4FFFDD6 
+ 808      C4FFFD
+ 809 2dc1 D6C4FFFD 		.ascii	"\326\304\377\375\326\305\377\375\327\305\377\375\327\306\377"
+ 809      D6C5FFFD 
+ 809      D7C5FFFD 
+ 809      D7C6FF
+ 810 2dd0 FDD7C6FF 		.ascii	"\375\327\306\377\375\327\306\377\375\330\307\377\375\330\307"
+ 810      FDD7C6FF 
+ 810      FDD8C7FF 
+ 810      FDD8C7
+ 811 2ddf FFFDD8C8 		.ascii	"\377\375\330\310\377\375\331\310\377\375\331\310\377\375\331"
+ 811      FFFDD9C8 
+ 811      FFFDD9C8 
+ 811      FFFDD9
+ 812 2dee C9FFFDDA 		.ascii	"\311\377\375\332\311\377\375\332\311\377\375\332\312\377\375"
+ 812      C9FFFDDA 
+ 812      C9FFFDDA 
+GAS LISTING /tmp/ccmDVY4F.s 			page 55
+
+
+ 812      CAFFFD
+ 813 2dfd DACAFFFD 		.ascii	"\332\312\377\375\333\313\377\375\333\313\377\375\333\313\377"
+ 813      DBCBFFFD 
+ 813      DBCBFFFD 
+ 813      DBCBFF
+ 814 2e0c FDDCCCFF 		.ascii	"\375\334\314\377\375\334\314\377\375\334\315\377\375\334\315"
+ 814      FDDCCCFF 
+ 814      FDDCCDFF 
+ 814      FDDCCD
+ 815 2e1b FFFDDDCD 		.ascii	"\377\375\335\315\377\375\335\316\377\375\335\316\377\375\336"
+ 815      FFFDDDCE 
+ 815      FFFDDDCE 
+ 815      FFFDDE
+ 816 2e2a CFFFFDDE 		.ascii	"\317\377\375\336\317\377\375\336\317\377\375\336\320\377\375"
+ 816      CFFFFDDE 
+ 816      CFFFFDDE 
+ 816      D0FFFD
+ 817 2e39 DFD0FFFD 		.ascii	"\337\320\377\375\337\321\377\375\337\321\377\375\340\321\377"
+ 817      DFD1FFFD 
+ 817      DFD1FFFD 
+ 817      E0D1FF
+ 818 2e48 FEE0D2FF 		.ascii	"\376\340\322\377\376\340\322\377\376\340\322\377\376\340\322"
+ 818      FEE0D2FF 
+ 818      FEE0D2FF 
+ 818      FEE0D2
+ 819 2e57 FFFEE0D3 		.ascii	"\377\376\340\323\377\376\340\323\377\376\341\323\377\376\341"
+ 819      FFFEE0D3 
+ 819      FFFEE1D3 
+ 819      FFFEE1
+ 820 2e66 D3FFFEE1 		.ascii	"\323\377\376\341\324\377\376\341\324\377\376\341\324\377\376"
+ 820      D4FFFEE1 
+ 820      D4FFFEE1 
+ 820      D4FFFE
+ 821 2e75 E1D4FFFE 		.ascii	"\341\324\377\376\342\324\377\376\342\325\377\376\342\325\377"
+ 821      E2D4FFFE 
+ 821      E2D5FFFE 
+ 821      E2D5FF
+ 822 2e84 FEE2D5FF 		.ascii	"\376\342\325\377\376\342\325\377\376\342\326\377\376\343\326"
+ 822      FEE2D5FF 
+ 822      FEE2D6FF 
+ 822      FEE3D6
+ 823 2e93 FFFEE3D6 		.ascii	"\377\376\343\326\377\376\343\326\377\376\343\327\377\376\343"
+ 823      FFFEE3D6 
+ 823      FFFEE3D7 
+ 823      FFFEE3
+ 824 2ea2 D7FFFEE3 		.ascii	"\327\377\376\343\327\377\376\344\327\377\376\344\327\377\376"
+ 824      D7FFFEE4 
+ 824      D7FFFEE4 
+ 824      D7FFFE
+ 825 2eb1 E4D8FFFE 		.ascii	"\344\330\377\376\344\330\377\376\344\330\377\376\344\330\377"
+ 825      E4D8FFFE 
+ 825      E4D8FFFE 
+ 825      E4D8FF
+ 826 2ec0 FEE5D9FF 		.ascii	"\376\345\331\377\376\345\331\377\376\345\331\377\376\345\331"
+ 826      FEE5D9FF 
+ 826      FEE5D9FF 
+ 826      FEE5D9
+GAS LISTING /tmp/ccmDVY4F.s 			page 56
+
+
+ 827 2ecf FFFEE5DA 		.ascii	"\377\376\345\332\377\376\345\332\377\376\346\332\377\376\346"
+ 827      FFFEE5DA 
+ 827      FFFEE6DA 
+ 827      FFFEE6
+ 828 2ede DAFFFEE6 		.ascii	"\332\377\376\346\332\377\376\346\333\377\376\346\333\377\376"
+ 828      DAFFFEE6 
+ 828      DBFFFEE6 
+ 828      DBFFFE
+ 829 2eed E6DBFFFE 		.ascii	"\346\333\377\376\347\333\377\376\347\334\377\376\347\334\377"
+ 829      E7DBFFFE 
+ 829      E7DCFFFE 
+ 829      E7DCFF
+ 830 2efc FEE7DCFF 		.ascii	"\376\347\334\377\376\347\334\377\376\347\335\377\376\350\335"
+ 830      FEE7DCFF 
+ 830      FEE7DDFF 
+ 830      FEE8DD
+ 831 2f0b FFFEE8DD 		.ascii	"\377\376\350\335\377\376\350\335\377\376\350\335\377\376\350"
+ 831      FFFEE8DD 
+ 831      FFFEE8DD 
+ 831      FFFEE8
+ 832 2f1a DEFFFEE8 		.ascii	"\336\377\376\350\336\377\376\351\336\377\376\351\336\377\376"
+ 832      DEFFFEE9 
+ 832      DEFFFEE9 
+ 832      DEFFFE
+ 833 2f29 E9DFFFFE 		.ascii	"\351\337\377\376\351\337\377\376\351\337\377\376\351\337\377"
+ 833      E9DFFFFE 
+ 833      E9DFFFFE 
+ 833      E9DFFF
+ 834 2f38 FEEAE0FF 		.ascii	"\376\352\340\377\376\352\340\377\376\352\340\377\376\352\340"
+ 834      FEEAE0FF 
+ 834      FEEAE0FF 
+ 834      FEEAE0
+ 835 2f47 FFFEEAE1 		.ascii	"\377\376\352\341\377\376\352\341\377\376\353\341\377\376\353"
+ 835      FFFEEAE1 
+ 835      FFFEEBE1 
+ 835      FFFEEB
+ 836 2f56 E1FFFEEB 		.ascii	"\341\377\376\353\341\377\376\353\342\377\376\353\342\377\376"
+ 836      E1FFFEEB 
+ 836      E2FFFEEB 
+ 836      E2FFFE
+ 837 2f65 EBE2FFFE 		.ascii	"\353\342\377\376\354\342\377\376\354\343\377\376\354\343\377"
+ 837      ECE2FFFE 
+ 837      ECE3FFFE 
+ 837      ECE3FF
+ 838 2f74 FEECE3FF 		.ascii	"\376\354\343\377\376\354\343\377\376\354\344\377\376\354\344"
+ 838      FEECE3FF 
+ 838      FEECE4FF 
+ 838      FEECE4
+ 839 2f83 FFFEEDE4 		.ascii	"\377\376\355\344\377\376\355\344\377\376\355\345\377\376\355"
+ 839      FFFEEDE4 
+ 839      FFFEEDE5 
+ 839      FFFEED
+ 840 2f92 E5FFFEED 		.ascii	"\345\377\376\355\345\377\376\355\345\377\376\356\345\377\376"
+ 840      E5FFFEED 
+ 840      E5FFFEEE 
+ 840      E5FFFE
+ 841 2fa1 EEE6FFFE 		.ascii	"\356\346\377\376\356\346\377\376\356\346\377\376\356\346\377"
+GAS LISTING /tmp/ccmDVY4F.s 			page 57
+
+
+ 841      EEE6FFFE 
+ 841      EEE6FFFE 
+ 841      EEE6FF
+ 842 2fb0 FEEEE7FF 		.ascii	"\376\356\347\377\376\357\347\377\376\357\347\377\376\357\347"
+ 842      FEEFE7FF 
+ 842      FEEFE7FF 
+ 842      FEEFE7
+ 843 2fbf FFFEEFE8 		.ascii	"\377\376\357\350\377\376\357\350\377\376\357\350\377\376\360"
+ 843      FFFEEFE8 
+ 843      FFFEEFE8 
+ 843      FFFEF0
+ 844 2fce E8FFFEF0 		.ascii	"\350\377\376\360\351\377\376\360\351\377\376\360\351\377\376"
+ 844      E9FFFEF0 
+ 844      E9FFFEF0 
+ 844      E9FFFE
+ 845 2fdd F0E9FF   		.ascii	"\360\351\377"
+ 846 2fe0 FEF0EAFF 		.ascii	"\376\360\352\377\376\361\352\377\376\361\352\377\376\361\352"
+ 846      FEF1EAFF 
+ 846      FEF1EAFF 
+ 846      FEF1EA
+ 847 2fef FFFEF1EA 		.ascii	"\377\376\361\352\377\376\361\353\377\376\361\353\377\376\362"
+ 847      FFFEF1EB 
+ 847      FFFEF1EB 
+ 847      FFFEF2
+ 848 2ffe EBFFFEF2 		.ascii	"\353\377\376\362\353\377\376\362\354\377\376\362\354\377\376"
+ 848      EBFFFEF2 
+ 848      ECFFFEF2 
+ 848      ECFFFE
+ 849 300d F2ECFFFE 		.ascii	"\362\354\377\376\362\354\377\376\363\355\377\376\363\355\377"
+ 849      F2ECFFFE 
+ 849      F3EDFFFE 
+ 849      F3EDFF
+ 850 301c FEF3EDFF 		.ascii	"\376\363\355\377\376\363\355\377\376\363\356\377\376\363\356"
+ 850      FEF3EDFF 
+ 850      FEF3EEFF 
+ 850      FEF3EE
+ 851 302b FFFEF4EE 		.ascii	"\377\376\364\356\377\376\364\356\377\376\364\357\377\376\364"
+ 851      FFFEF4EE 
+ 851      FFFEF4EF 
+ 851      FFFEF4
+ 852 303a EFFFFEF4 		.ascii	"\357\377\376\364\357\377\376\364\357\377"
+ 852      EFFFFEF4 
+ 852      EFFF
+ 853              		.globl	heatmap_cs_Reds_discrete
+ 854              		.section	.data.rel.local
+ 855              		.align 8
+ 856              		.type	heatmap_cs_Reds_discrete, @object
+ 857              		.size	heatmap_cs_Reds_discrete, 8
+ 858              	heatmap_cs_Reds_discrete:
+ 859 0018 00000000 		.quad	discrete
+ 859      00000000 
+ 860              		.section	.data.rel.ro.local
+ 861              		.align 16
+ 862              		.type	discrete, @object
+ 863              		.size	discrete, 16
+ 864              	discrete:
+ 865 0030 00000000 		.quad	discrete_data
+GAS LISTING /tmp/ccmDVY4F.s 			page 58
+
+
+ 865      00000000 
+ 866 0038 0A000000 		.quad	10
+ 866      00000000 
+ 867              		.section	.rodata
+ 868 3044 00000000 		.align 32
+ 868      00000000 
+ 868      00000000 
+ 868      00000000 
+ 868      00000000 
+ 869              		.type	discrete_data, @object
+ 870              		.size	discrete_data, 40
+ 871              	discrete_data:
+ 872 3060 00       		.string	""
+ 873 3061 00       		.string	""
+ 874 3062 00       		.string	""
+ 875 3063 00       		.string	""
+ 876 3064 6700     		.string	"g"
+ 877 3066 0DFFA50F 		.ascii	"\r\377\245\017\025\377\313\030\035\377\357;,\377\373jJ\377\374"
+ 877      15FFCB18 
+ 877      1DFFEF3B 
+ 877      2CFFFB6A 
+ 877      4AFFFC
+ 878 3079 9272FFFC 		.ascii	"\222r\377\374\273\241\377\376\340\322\377\377\365\360\377"
+ 878      BBA1FFFE 
+ 878      E0D2FFFF 
+ 878      F5F0FF
+ 879              		.text
+ 880              	.Letext0:
+ 881              		.file 1 "./heatmap.h"
+ 882              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 883              		.file 3 "./colorschemes/Reds.h"
+ 884              		.file 4 "colorschemes/Reds.c"
+ 885              		.section	.debug_info,"",@progbits
+ 886              	.Ldebug_info0:
+ 887 0000 E3010000 		.long	0x1e3
+ 888 0004 0500     		.value	0x5
+ 889 0006 01       		.byte	0x1
+ 890 0007 08       		.byte	0x8
+ 891 0008 00000000 		.long	.Ldebug_abbrev0
+ 892 000c 0A       		.uleb128 0xa
+ 893 000d 00000000 		.long	.LASF26
+ 894 0011 1D       		.byte	0x1d
+ 895 0012 00000000 		.long	.LASF0
+ 896 0016 00000000 		.long	.LASF1
+ 897 001a 00000000 		.long	.Ldebug_line0
+ 898 001e 01       		.uleb128 0x1
+ 899 001f 08       		.byte	0x8
+ 900 0020 05       		.byte	0x5
+ 901 0021 00000000 		.long	.LASF2
+ 902 0025 06       		.uleb128 0x6
+ 903 0026 00000000 		.long	.LASF12
+ 904 002a 02       		.byte	0x2
+ 905 002b D6       		.byte	0xd6
+ 906 002c 17       		.byte	0x17
+ 907 002d 31000000 		.long	0x31
+ 908 0031 01       		.uleb128 0x1
+ 909 0032 08       		.byte	0x8
+GAS LISTING /tmp/ccmDVY4F.s 			page 59
+
+
+ 910 0033 07       		.byte	0x7
+ 911 0034 00000000 		.long	.LASF3
+ 912 0038 0B       		.uleb128 0xb
+ 913 0039 04       		.byte	0x4
+ 914 003a 05       		.byte	0x5
+ 915 003b 696E7400 		.string	"int"
+ 916 003f 01       		.uleb128 0x1
+ 917 0040 08       		.byte	0x8
+ 918 0041 05       		.byte	0x5
+ 919 0042 00000000 		.long	.LASF4
+ 920 0046 01       		.uleb128 0x1
+ 921 0047 10       		.byte	0x10
+ 922 0048 04       		.byte	0x4
+ 923 0049 00000000 		.long	.LASF5
+ 924 004d 01       		.uleb128 0x1
+ 925 004e 04       		.byte	0x4
+ 926 004f 04       		.byte	0x4
+ 927 0050 00000000 		.long	.LASF6
+ 928 0054 01       		.uleb128 0x1
+ 929 0055 04       		.byte	0x4
+ 930 0056 07       		.byte	0x7
+ 931 0057 00000000 		.long	.LASF7
+ 932 005b 01       		.uleb128 0x1
+ 933 005c 02       		.byte	0x2
+ 934 005d 07       		.byte	0x7
+ 935 005e 00000000 		.long	.LASF8
+ 936 0062 0C       		.uleb128 0xc
+ 937 0063 10       		.byte	0x10
+ 938 0064 01       		.byte	0x1
+ 939 0065 BB       		.byte	0xbb
+ 940 0066 09       		.byte	0x9
+ 941 0067 84000000 		.long	0x84
+ 942 006b 07       		.uleb128 0x7
+ 943 006c 00000000 		.long	.LASF9
+ 944 0070 BC       		.byte	0xbc
+ 945 0071 1A       		.byte	0x1a
+ 946 0072 84000000 		.long	0x84
+ 947 0076 00       		.byte	0
+ 948 0077 07       		.uleb128 0x7
+ 949 0078 00000000 		.long	.LASF10
+ 950 007c BD       		.byte	0xbd
+ 951 007d 0C       		.byte	0xc
+ 952 007e 25000000 		.long	0x25
+ 953 0082 08       		.byte	0x8
+ 954 0083 00       		.byte	0
+ 955 0084 08       		.uleb128 0x8
+ 956 0085 90000000 		.long	0x90
+ 957 0089 01       		.uleb128 0x1
+ 958 008a 01       		.byte	0x1
+ 959 008b 08       		.byte	0x8
+ 960 008c 00000000 		.long	.LASF11
+ 961 0090 03       		.uleb128 0x3
+ 962 0091 89000000 		.long	0x89
+ 963 0095 06       		.uleb128 0x6
+ 964 0096 00000000 		.long	.LASF13
+ 965 009a 01       		.byte	0x1
+ 966 009b BE       		.byte	0xbe
+GAS LISTING /tmp/ccmDVY4F.s 			page 60
+
+
+ 967 009c 03       		.byte	0x3
+ 968 009d 62000000 		.long	0x62
+ 969 00a1 03       		.uleb128 0x3
+ 970 00a2 95000000 		.long	0x95
+ 971 00a6 08       		.uleb128 0x8
+ 972 00a7 A1000000 		.long	0xa1
+ 973 00ab 04       		.uleb128 0x4
+ 974 00ac 00000000 		.long	.LASF14
+ 975 00b0 21       		.byte	0x21
+ 976 00b1 A6000000 		.long	0xa6
+ 977 00b5 04       		.uleb128 0x4
+ 978 00b6 00000000 		.long	.LASF15
+ 979 00ba 23       		.byte	0x23
+ 980 00bb A6000000 		.long	0xa6
+ 981 00bf 04       		.uleb128 0x4
+ 982 00c0 00000000 		.long	.LASF16
+ 983 00c4 25       		.byte	0x25
+ 984 00c5 A6000000 		.long	0xa6
+ 985 00c9 04       		.uleb128 0x4
+ 986 00ca 00000000 		.long	.LASF17
+ 987 00ce 28       		.byte	0x28
+ 988 00cf A6000000 		.long	0xa6
+ 989 00d3 09       		.uleb128 0x9
+ 990 00d4 90000000 		.long	0x90
+ 991 00d8 E3000000 		.long	0xe3
+ 992 00dc 0D       		.uleb128 0xd
+ 993 00dd 31000000 		.long	0x31
+ 994 00e1 27       		.byte	0x27
+ 995 00e2 00       		.byte	0
+ 996 00e3 03       		.uleb128 0x3
+ 997 00e4 D3000000 		.long	0xd3
+ 998 00e8 02       		.uleb128 0x2
+ 999 00e9 00000000 		.long	.LASF18
+ 1000 00ed 20       		.byte	0x20
+ 1001 00ee 1C       		.byte	0x1c
+ 1002 00ef E3000000 		.long	0xe3
+ 1003 00f3 09       		.uleb128 0x9
+ 1004 00f4 03       		.byte	0x3
+ 1005 00f5 00000000 		.quad	discrete_data
+ 1005      00000000 
+ 1006 00fd 02       		.uleb128 0x2
+ 1007 00fe 00000000 		.long	.LASF19
+ 1008 0102 23       		.byte	0x23
+ 1009 0103 24       		.byte	0x24
+ 1010 0104 A1000000 		.long	0xa1
+ 1011 0108 09       		.uleb128 0x9
+ 1012 0109 03       		.byte	0x3
+ 1013 010a 00000000 		.quad	discrete
+ 1013      00000000 
+ 1014 0112 05       		.uleb128 0x5
+ 1015 0113 AB000000 		.long	0xab
+ 1016 0117 24       		.byte	0x24
+ 1017 0118 09       		.uleb128 0x9
+ 1018 0119 03       		.byte	0x3
+ 1019 011a 00000000 		.quad	heatmap_cs_Reds_discrete
+ 1019      00000000 
+ 1020 0122 09       		.uleb128 0x9
+GAS LISTING /tmp/ccmDVY4F.s 			page 61
+
+
+ 1021 0123 90000000 		.long	0x90
+ 1022 0127 33010000 		.long	0x133
+ 1023 012b 0E       		.uleb128 0xe
+ 1024 012c 31000000 		.long	0x31
+ 1025 0130 0310     		.value	0x1003
+ 1026 0132 00       		.byte	0
+ 1027 0133 03       		.uleb128 0x3
+ 1028 0134 22010000 		.long	0x122
+ 1029 0138 02       		.uleb128 0x2
+ 1030 0139 00000000 		.long	.LASF20
+ 1031 013d 26       		.byte	0x26
+ 1032 013e 1C       		.byte	0x1c
+ 1033 013f 33010000 		.long	0x133
+ 1034 0143 09       		.uleb128 0x9
+ 1035 0144 03       		.byte	0x3
+ 1036 0145 00000000 		.quad	soft_data
+ 1036      00000000 
+ 1037 014d 02       		.uleb128 0x2
+ 1038 014e 00000000 		.long	.LASF21
+ 1039 0152 29       		.byte	0x29
+ 1040 0153 24       		.byte	0x24
+ 1041 0154 A1000000 		.long	0xa1
+ 1042 0158 09       		.uleb128 0x9
+ 1043 0159 03       		.byte	0x3
+ 1044 015a 00000000 		.quad	soft
+ 1044      00000000 
+ 1045 0162 05       		.uleb128 0x5
+ 1046 0163 B5000000 		.long	0xb5
+ 1047 0167 2A       		.byte	0x2a
+ 1048 0168 09       		.uleb128 0x9
+ 1049 0169 03       		.byte	0x3
+ 1050 016a 00000000 		.quad	heatmap_cs_Reds_soft
+ 1050      00000000 
+ 1051 0172 02       		.uleb128 0x2
+ 1052 0173 00000000 		.long	.LASF22
+ 1053 0177 2C       		.byte	0x2c
+ 1054 0178 1C       		.byte	0x1c
+ 1055 0179 33010000 		.long	0x133
+ 1056 017d 09       		.uleb128 0x9
+ 1057 017e 03       		.byte	0x3
+ 1058 017f 00000000 		.quad	mixed_data
+ 1058      00000000 
+ 1059 0187 02       		.uleb128 0x2
+ 1060 0188 00000000 		.long	.LASF23
+ 1061 018c 2F       		.byte	0x2f
+ 1062 018d 24       		.byte	0x24
+ 1063 018e A1000000 		.long	0xa1
+ 1064 0192 09       		.uleb128 0x9
+ 1065 0193 03       		.byte	0x3
+ 1066 0194 00000000 		.quad	mixed
+ 1066      00000000 
+ 1067 019c 05       		.uleb128 0x5
+ 1068 019d BF000000 		.long	0xbf
+ 1069 01a1 30       		.byte	0x30
+ 1070 01a2 09       		.uleb128 0x9
+ 1071 01a3 03       		.byte	0x3
+ 1072 01a4 00000000 		.quad	heatmap_cs_Reds_mixed
+GAS LISTING /tmp/ccmDVY4F.s 			page 62
+
+
+ 1072      00000000 
+ 1073 01ac 02       		.uleb128 0x2
+ 1074 01ad 00000000 		.long	.LASF24
+ 1075 01b1 32       		.byte	0x32
+ 1076 01b2 1C       		.byte	0x1c
+ 1077 01b3 33010000 		.long	0x133
+ 1078 01b7 09       		.uleb128 0x9
+ 1079 01b8 03       		.byte	0x3
+ 1080 01b9 00000000 		.quad	mixed_exp_data
+ 1080      00000000 
+ 1081 01c1 02       		.uleb128 0x2
+ 1082 01c2 00000000 		.long	.LASF25
+ 1083 01c6 35       		.byte	0x35
+ 1084 01c7 24       		.byte	0x24
+ 1085 01c8 A1000000 		.long	0xa1
+ 1086 01cc 09       		.uleb128 0x9
+ 1087 01cd 03       		.byte	0x3
+ 1088 01ce 00000000 		.quad	mixed_exp
+ 1088      00000000 
+ 1089 01d6 05       		.uleb128 0x5
+ 1090 01d7 C9000000 		.long	0xc9
+ 1091 01db 36       		.byte	0x36
+ 1092 01dc 09       		.uleb128 0x9
+ 1093 01dd 03       		.byte	0x3
+ 1094 01de 00000000 		.quad	heatmap_cs_Reds_mixed_exp
+ 1094      00000000 
+ 1095 01e6 00       		.byte	0
+ 1096              		.section	.debug_abbrev,"",@progbits
+ 1097              	.Ldebug_abbrev0:
+ 1098 0000 01       		.uleb128 0x1
+ 1099 0001 24       		.uleb128 0x24
+ 1100 0002 00       		.byte	0
+ 1101 0003 0B       		.uleb128 0xb
+ 1102 0004 0B       		.uleb128 0xb
+ 1103 0005 3E       		.uleb128 0x3e
+ 1104 0006 0B       		.uleb128 0xb
+ 1105 0007 03       		.uleb128 0x3
+ 1106 0008 0E       		.uleb128 0xe
+ 1107 0009 00       		.byte	0
+ 1108 000a 00       		.byte	0
+ 1109 000b 02       		.uleb128 0x2
+ 1110 000c 34       		.uleb128 0x34
+ 1111 000d 00       		.byte	0
+ 1112 000e 03       		.uleb128 0x3
+ 1113 000f 0E       		.uleb128 0xe
+ 1114 0010 3A       		.uleb128 0x3a
+ 1115 0011 21       		.uleb128 0x21
+ 1116 0012 04       		.sleb128 4
+ 1117 0013 3B       		.uleb128 0x3b
+ 1118 0014 0B       		.uleb128 0xb
+ 1119 0015 39       		.uleb128 0x39
+ 1120 0016 0B       		.uleb128 0xb
+ 1121 0017 49       		.uleb128 0x49
+ 1122 0018 13       		.uleb128 0x13
+ 1123 0019 02       		.uleb128 0x2
+ 1124 001a 18       		.uleb128 0x18
+ 1125 001b 00       		.byte	0
+GAS LISTING /tmp/ccmDVY4F.s 			page 63
+
+
+ 1126 001c 00       		.byte	0
+ 1127 001d 03       		.uleb128 0x3
+ 1128 001e 26       		.uleb128 0x26
+ 1129 001f 00       		.byte	0
+ 1130 0020 49       		.uleb128 0x49
+ 1131 0021 13       		.uleb128 0x13
+ 1132 0022 00       		.byte	0
+ 1133 0023 00       		.byte	0
+ 1134 0024 04       		.uleb128 0x4
+ 1135 0025 34       		.uleb128 0x34
+ 1136 0026 00       		.byte	0
+ 1137 0027 03       		.uleb128 0x3
+ 1138 0028 0E       		.uleb128 0xe
+ 1139 0029 3A       		.uleb128 0x3a
+ 1140 002a 21       		.uleb128 0x21
+ 1141 002b 03       		.sleb128 3
+ 1142 002c 3B       		.uleb128 0x3b
+ 1143 002d 0B       		.uleb128 0xb
+ 1144 002e 39       		.uleb128 0x39
+ 1145 002f 21       		.uleb128 0x21
+ 1146 0030 25       		.sleb128 37
+ 1147 0031 49       		.uleb128 0x49
+ 1148 0032 13       		.uleb128 0x13
+ 1149 0033 3F       		.uleb128 0x3f
+ 1150 0034 19       		.uleb128 0x19
+ 1151 0035 3C       		.uleb128 0x3c
+ 1152 0036 19       		.uleb128 0x19
+ 1153 0037 00       		.byte	0
+ 1154 0038 00       		.byte	0
+ 1155 0039 05       		.uleb128 0x5
+ 1156 003a 34       		.uleb128 0x34
+ 1157 003b 00       		.byte	0
+ 1158 003c 47       		.uleb128 0x47
+ 1159 003d 13       		.uleb128 0x13
+ 1160 003e 3A       		.uleb128 0x3a
+ 1161 003f 21       		.uleb128 0x21
+ 1162 0040 04       		.sleb128 4
+ 1163 0041 3B       		.uleb128 0x3b
+ 1164 0042 0B       		.uleb128 0xb
+ 1165 0043 39       		.uleb128 0x39
+ 1166 0044 21       		.uleb128 0x21
+ 1167 0045 1E       		.sleb128 30
+ 1168 0046 02       		.uleb128 0x2
+ 1169 0047 18       		.uleb128 0x18
+ 1170 0048 00       		.byte	0
+ 1171 0049 00       		.byte	0
+ 1172 004a 06       		.uleb128 0x6
+ 1173 004b 16       		.uleb128 0x16
+ 1174 004c 00       		.byte	0
+ 1175 004d 03       		.uleb128 0x3
+ 1176 004e 0E       		.uleb128 0xe
+ 1177 004f 3A       		.uleb128 0x3a
+ 1178 0050 0B       		.uleb128 0xb
+ 1179 0051 3B       		.uleb128 0x3b
+ 1180 0052 0B       		.uleb128 0xb
+ 1181 0053 39       		.uleb128 0x39
+ 1182 0054 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccmDVY4F.s 			page 64
+
+
+ 1183 0055 49       		.uleb128 0x49
+ 1184 0056 13       		.uleb128 0x13
+ 1185 0057 00       		.byte	0
+ 1186 0058 00       		.byte	0
+ 1187 0059 07       		.uleb128 0x7
+ 1188 005a 0D       		.uleb128 0xd
+ 1189 005b 00       		.byte	0
+ 1190 005c 03       		.uleb128 0x3
+ 1191 005d 0E       		.uleb128 0xe
+ 1192 005e 3A       		.uleb128 0x3a
+ 1193 005f 21       		.uleb128 0x21
+ 1194 0060 01       		.sleb128 1
+ 1195 0061 3B       		.uleb128 0x3b
+ 1196 0062 0B       		.uleb128 0xb
+ 1197 0063 39       		.uleb128 0x39
+ 1198 0064 0B       		.uleb128 0xb
+ 1199 0065 49       		.uleb128 0x49
+ 1200 0066 13       		.uleb128 0x13
+ 1201 0067 38       		.uleb128 0x38
+ 1202 0068 0B       		.uleb128 0xb
+ 1203 0069 00       		.byte	0
+ 1204 006a 00       		.byte	0
+ 1205 006b 08       		.uleb128 0x8
+ 1206 006c 0F       		.uleb128 0xf
+ 1207 006d 00       		.byte	0
+ 1208 006e 0B       		.uleb128 0xb
+ 1209 006f 21       		.uleb128 0x21
+ 1210 0070 08       		.sleb128 8
+ 1211 0071 49       		.uleb128 0x49
+ 1212 0072 13       		.uleb128 0x13
+ 1213 0073 00       		.byte	0
+ 1214 0074 00       		.byte	0
+ 1215 0075 09       		.uleb128 0x9
+ 1216 0076 01       		.uleb128 0x1
+ 1217 0077 01       		.byte	0x1
+ 1218 0078 49       		.uleb128 0x49
+ 1219 0079 13       		.uleb128 0x13
+ 1220 007a 01       		.uleb128 0x1
+ 1221 007b 13       		.uleb128 0x13
+ 1222 007c 00       		.byte	0
+ 1223 007d 00       		.byte	0
+ 1224 007e 0A       		.uleb128 0xa
+ 1225 007f 11       		.uleb128 0x11
+ 1226 0080 01       		.byte	0x1
+ 1227 0081 25       		.uleb128 0x25
+ 1228 0082 0E       		.uleb128 0xe
+ 1229 0083 13       		.uleb128 0x13
+ 1230 0084 0B       		.uleb128 0xb
+ 1231 0085 03       		.uleb128 0x3
+ 1232 0086 1F       		.uleb128 0x1f
+ 1233 0087 1B       		.uleb128 0x1b
+ 1234 0088 1F       		.uleb128 0x1f
+ 1235 0089 10       		.uleb128 0x10
+ 1236 008a 17       		.uleb128 0x17
+ 1237 008b 00       		.byte	0
+ 1238 008c 00       		.byte	0
+ 1239 008d 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccmDVY4F.s 			page 65
+
+
+ 1240 008e 24       		.uleb128 0x24
+ 1241 008f 00       		.byte	0
+ 1242 0090 0B       		.uleb128 0xb
+ 1243 0091 0B       		.uleb128 0xb
+ 1244 0092 3E       		.uleb128 0x3e
+ 1245 0093 0B       		.uleb128 0xb
+ 1246 0094 03       		.uleb128 0x3
+ 1247 0095 08       		.uleb128 0x8
+ 1248 0096 00       		.byte	0
+ 1249 0097 00       		.byte	0
+ 1250 0098 0C       		.uleb128 0xc
+ 1251 0099 13       		.uleb128 0x13
+ 1252 009a 01       		.byte	0x1
+ 1253 009b 0B       		.uleb128 0xb
+ 1254 009c 0B       		.uleb128 0xb
+ 1255 009d 3A       		.uleb128 0x3a
+ 1256 009e 0B       		.uleb128 0xb
+ 1257 009f 3B       		.uleb128 0x3b
+ 1258 00a0 0B       		.uleb128 0xb
+ 1259 00a1 39       		.uleb128 0x39
+ 1260 00a2 0B       		.uleb128 0xb
+ 1261 00a3 01       		.uleb128 0x1
+ 1262 00a4 13       		.uleb128 0x13
+ 1263 00a5 00       		.byte	0
+ 1264 00a6 00       		.byte	0
+ 1265 00a7 0D       		.uleb128 0xd
+ 1266 00a8 21       		.uleb128 0x21
+ 1267 00a9 00       		.byte	0
+ 1268 00aa 49       		.uleb128 0x49
+ 1269 00ab 13       		.uleb128 0x13
+ 1270 00ac 2F       		.uleb128 0x2f
+ 1271 00ad 0B       		.uleb128 0xb
+ 1272 00ae 00       		.byte	0
+ 1273 00af 00       		.byte	0
+ 1274 00b0 0E       		.uleb128 0xe
+ 1275 00b1 21       		.uleb128 0x21
+ 1276 00b2 00       		.byte	0
+ 1277 00b3 49       		.uleb128 0x49
+ 1278 00b4 13       		.uleb128 0x13
+ 1279 00b5 2F       		.uleb128 0x2f
+ 1280 00b6 05       		.uleb128 0x5
+ 1281 00b7 00       		.byte	0
+ 1282 00b8 00       		.byte	0
+ 1283 00b9 00       		.byte	0
+ 1284              		.section	.debug_aranges,"",@progbits
+ 1285 0000 1C000000 		.long	0x1c
+ 1286 0004 0200     		.value	0x2
+ 1287 0006 00000000 		.long	.Ldebug_info0
+ 1288 000a 08       		.byte	0x8
+ 1289 000b 00       		.byte	0
+ 1290 000c 0000     		.value	0
+ 1291 000e 0000     		.value	0
+ 1292 0010 00000000 		.quad	0
+ 1292      00000000 
+ 1293 0018 00000000 		.quad	0
+ 1293      00000000 
+ 1294              		.section	.debug_line,"",@progbits
+GAS LISTING /tmp/ccmDVY4F.s 			page 66
+
+
+ 1295              	.Ldebug_line0:
+ 1296 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1296      05000800 
+ 1296      49000000 
+ 1296      010101FB 
+ 1296      0E0D0001 
+ 1297              	.LASF20:
+ 1298 0000 736F6674 		.string	"soft_data"
+ 1298      5F646174 
+ 1298      6100
+ 1299              	.LASF12:
+ 1300 000a 73697A65 		.string	"size_t"
+ 1300      5F7400
+ 1301              	.LASF13:
+ 1302 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1302      6D61705F 
+ 1302      636F6C6F 
+ 1302      72736368 
+ 1302      656D655F 
+ 1303              	.LASF26:
+ 1304 0027 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1304      43313720 
+ 1304      31322E32 
+ 1304      2E30202D 
+ 1304      6D74756E 
+ 1305              	.LASF6:
+ 1306 0086 666C6F61 		.string	"float"
+ 1306      7400
+ 1307              	.LASF11:
+ 1308 008c 756E7369 		.string	"unsigned char"
+ 1308      676E6564 
+ 1308      20636861 
+ 1308      7200
+ 1309              	.LASF3:
+ 1310 009a 6C6F6E67 		.string	"long unsigned int"
+ 1310      20756E73 
+ 1310      69676E65 
+ 1310      6420696E 
+ 1310      7400
+ 1311              	.LASF8:
+ 1312 00ac 73686F72 		.string	"short unsigned int"
+ 1312      7420756E 
+ 1312      7369676E 
+ 1312      65642069 
+ 1312      6E7400
+ 1313              	.LASF25:
+ 1314 00bf 6D697865 		.string	"mixed_exp"
+ 1314      645F6578 
+ 1314      7000
+ 1315              	.LASF23:
+ 1316 00c9 6D697865 		.string	"mixed"
+ 1316      6400
+ 1317              	.LASF17:
+ 1318 00cf 68656174 		.string	"heatmap_cs_Reds_mixed_exp"
+ 1318      6D61705F 
+ 1318      63735F52 
+ 1318      6564735F 
+GAS LISTING /tmp/ccmDVY4F.s 			page 67
+
+
+ 1318      6D697865 
+ 1319              	.LASF15:
+ 1320 00e9 68656174 		.string	"heatmap_cs_Reds_soft"
+ 1320      6D61705F 
+ 1320      63735F52 
+ 1320      6564735F 
+ 1320      736F6674 
+ 1321              	.LASF7:
+ 1322 00fe 756E7369 		.string	"unsigned int"
+ 1322      676E6564 
+ 1322      20696E74 
+ 1322      00
+ 1323              	.LASF19:
+ 1324 010b 64697363 		.string	"discrete"
+ 1324      72657465 
+ 1324      00
+ 1325              	.LASF14:
+ 1326 0114 68656174 		.string	"heatmap_cs_Reds_discrete"
+ 1326      6D61705F 
+ 1326      63735F52 
+ 1326      6564735F 
+ 1326      64697363 
+ 1327              	.LASF10:
+ 1328 012d 6E636F6C 		.string	"ncolors"
+ 1328      6F727300 
+ 1329              	.LASF4:
+ 1330 0135 6C6F6E67 		.string	"long long int"
+ 1330      206C6F6E 
+ 1330      6720696E 
+ 1330      7400
+ 1331              	.LASF24:
+ 1332 0143 6D697865 		.string	"mixed_exp_data"
+ 1332      645F6578 
+ 1332      705F6461 
+ 1332      746100
+ 1333              	.LASF22:
+ 1334 0152 6D697865 		.string	"mixed_data"
+ 1334      645F6461 
+ 1334      746100
+ 1335              	.LASF2:
+ 1336 015d 6C6F6E67 		.string	"long int"
+ 1336      20696E74 
+ 1336      00
+ 1337              	.LASF5:
+ 1338 0166 6C6F6E67 		.string	"long double"
+ 1338      20646F75 
+ 1338      626C6500 
+ 1339              	.LASF16:
+ 1340 0172 68656174 		.string	"heatmap_cs_Reds_mixed"
+ 1340      6D61705F 
+ 1340      63735F52 
+ 1340      6564735F 
+ 1340      6D697865 
+ 1341              	.LASF18:
+ 1342 0188 64697363 		.string	"discrete_data"
+ 1342      72657465 
+ 1342      5F646174 
+GAS LISTING /tmp/ccmDVY4F.s 			page 68
+
+
+ 1342      6100
+ 1343              	.LASF21:
+ 1344 0196 736F6674 		.string	"soft"
+ 1344      00
+ 1345              	.LASF9:
+ 1346 019b 636F6C6F 		.string	"colors"
+ 1346      727300
+ 1347              		.section	.debug_line_str,"MS",@progbits,1
+ 1348              	.LASF1:
+ 1349 0000 2F726F6F 		.string	"/root/repo"
+ 1349      742F7265 
+ 1349      706F00
+ 1350              	.LASF0:
+ 1351 000b 636F6C6F 		.string	"colorschemes/Reds.c"
+ 1351      72736368 
+ 1351      656D6573 
+ 1351      2F526564 
+ 1351      732E6300 
+ 1352              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1353 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1353      742F7265 
+ 1353      706F0063 
+ 1353      6F6C6F72 
+ 1353      73636865 
@@ -0,0 +1,3956 @@
+GAS LISTING /tmp/ccaf4gN6.s 			page 1
+
+
+   1              		.file	"Spectral.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/Spectral.c"
+   5              		.globl	heatmap_cs_Spectral_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_Spectral_mixed_exp, @object
+   9              		.size	heatmap_cs_Spectral_mixed_exp, 8
+  10              	heatmap_cs_Spectral_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 5E4FA200 		.string	"^O\242"
+  29 0008 5954A518 		.ascii	"YT\245\030TY\2511O]\254JKb\257cFf\261|9v\270\2256z\272\2563~"
+  29      5459A931 
+  29      4F5DAC4A 
+  29      4B62AF63 
+  29      4666B17C 
+  30 0026 BBC73281 		.ascii	"\273\3072\201\274\3401\205\274\371.\211\275\377!\216\276\377"
+  30      BCE03185 
+  30      BCF92E89 
+  30      BDFF218E 
+  30      BEFF
+  31 0038 0F93BFFF 		.ascii	"\017\223\277\377\n\227\276\377\n\233\275\377\n\237\274\377\036"
+  31      0A97BEFF 
+  31      0A9BBDFF 
+  31      0A9FBCFF 
+  31      1E
+  32 0049 AFB5FF2F 		.ascii	"\257\265\377/\263\262\377<\266\257\377I\272\254\377T\275\251"
+  32      B3B2FF3C 
+  32      B6AFFF49 
+  32      BAACFF54 
+  32      BDA9
+  33 005b FF5FC0A6 		.ascii	"\377_\300\246\377g\302\244\377l\304\244\377p\306\244\377t\310"
+  33      FF67C2A4 
+  33      FF6CC4A4 
+  33      FF70C6A4 
+  33      FF74C8
+  34 006e A4FF79C9 		.ascii	"\244\377y\311\244\377}\313\244\377\201\315\243\377\223\324\243"
+GAS LISTING /tmp/ccaf4gN6.s 			page 2
+
+
+  34      A4FF7DCB 
+  34      A4FF81CD 
+  34      A3FF93D4 
+  34      A3
+  35 007f FF97D5A3 		.ascii	"\377\227\325\243\377\233\327\243\377\237\330\243\377\243\332"
+  35      FF9BD7A3 
+  35      FF9FD8A3 
+  35      FFA3DA
+  36 008e A3FFA7DB 		.ascii	"\243\377\247\333\243\377\253\335\243\377\256\336\243\377\260"
+  36      A3FFABDD 
+  36      A3FFAEDE 
+  36      A3FFB0
+  37 009d E0A2FFB3 		.ascii	"\340\242\377\263\341\242\377\266\343\241\377\271\344\240\377"
+  37      E1A2FFB6 
+  37      E3A1FFB9 
+  37      E4A0FF
+  38 00ac BCE5A0FF 		.ascii	"\274\345\240\377\277\347\237\377\316\355\234\377\322\356\233"
+  38      BFE79FFF 
+  38      CEED9CFF 
+  38      D2EE9B
+  39 00bb FFD5EF9A 		.ascii	"\377\325\357\232\377\330\360\232\377\333\361\231\377\337\362"
+  39      FFD8F09A 
+  39      FFDBF199 
+  39      FFDFF2
+  40 00ca 99FFE2F3 		.ascii	"\231\377\342\363\230\377\346\364\230\377\346\364\230\377\347"
+  40      98FFE6F4 
+  40      98FFE6F4 
+  40      98FFE7
+  41 00d9 F499FFE7 		.ascii	"\364\231\377\347\364\232\377\350\364\232\377\350\364\233\377"
+  41      F49AFFE8 
+  41      F49AFFE8 
+  41      F49BFF
+  42 00e8 E9F49CFF 		.ascii	"\351\364\234\377\352\364\234\377\352\364\235\377\355\363\241"
+  42      EAF49CFF 
+  42      EAF49DFF 
+  42      EDF3A1
+  43 00f7 FFEDF3A1 		.ascii	"\377\355\363\241\377\356\363\242\377\356\363\243\377\357\363"
+  43      FFEEF3A2 
+  43      FFEEF3A3 
+  43      FFEFF3
+  44 0106 A3FFEFF3 		.ascii	"\243\377\357\363\244\377\357\363\245\377\360\363\245\377\360"
+  44      A4FFEFF3 
+  44      A5FFF0F3 
+  44      A5FFF0
+  45 0115 F3A6FFF1 		.ascii	"\363\246\377\361\362\246\377\361\361\245\377\362\361\244\377"
+  45      F2A6FFF1 
+  45      F1A5FFF2 
+  45      F1A4FF
+  46 0124 F2F0A3FF 		.ascii	"\362\360\243\377\363\357\242\377\363\356\241\377\364\356\240"
+  46      F3EFA2FF 
+  46      F3EEA1FF 
+  46      F4EEA0
+  47 0133 FFF4ED9F 		.ascii	"\377\364\355\237\377\365\354\236\377\365\354\235\377\370\347"
+  47      FFF5EC9E 
+  47      FFF5EC9D 
+  47      FFF8E7
+  48 0142 98FFF9E6 		.ascii	"\230\377\371\346\227\377\371\346\226\377\372\345\225\377\372"
+GAS LISTING /tmp/ccaf4gN6.s 			page 3
+
+
+  48      97FFF9E6 
+  48      96FFFAE5 
+  48      95FFFA
+  49 0151 E494FFFB 		.ascii	"\344\224\377\373\343\223\377\373\343\223\377\374\342\222\377"
+  49      E393FFFB 
+  49      E393FFFC 
+  49      E292FF
+  50 0160 FCE191FF 		.ascii	"\374\341\221\377\375\341\221\377\375\340\220\377\375\337\217"
+  50      FDE191FF 
+  50      FDE090FF 
+  50      FDDF8F
+  51 016f FFFDDD8D 		.ascii	"\377\375\335\215\377\375\334\213\377\375\332\211\377\375\331"
+  51      FFFDDC8B 
+  51      FFFDDA89 
+  51      FFFDD9
+  52 017e 87FFFDD7 		.ascii	"\207\377\375\327\206\377\375\325\204\377\375\324\202\377\375"
+  52      86FFFDD5 
+  52      84FFFDD4 
+  52      82FFFD
+  53 018d D281FFFD 		.ascii	"\322\201\377\375\321\177\377\375\317~\377\375\316|\377\375\314"
+  53      D17FFFFD 
+  53      CF7EFFFD 
+  53      CE7CFFFD 
+  53      CC
+  54 019e 7BFFFDC1 		.ascii	"{\377\375\301p\377\375\277n\377\375\276m\377\375\274l\377\375"
+  54      70FFFDBF 
+  54      6EFFFDBE 
+  54      6DFFFDBC 
+  54      6CFFFD
+  55 01b1 BB6AFFFD 		.ascii	"\273j\377\375\271i\377\375\270h\377\375\266g\377\375\265f\377"
+  55      B969FFFD 
+  55      B868FFFD 
+  55      B667FFFD 
+  55      B566FF
+  56 01c4 FDB365FF 		.ascii	"\375\263e\377\375\262d\377\375\261c\377\375\257b\377\375\256"
+  56      FDB264FF 
+  56      FDB163FF 
+  56      FDAF62FF 
+  56      FDAE
+  57 01d6 61FFFCAC 		.ascii	"a\377\374\254_\377\374\253^\377\374\251]\377\374\247\\\377\374"
+  57      5FFFFCAB 
+  57      5EFFFCA9 
+  57      5DFFFCA7 
+  57      5CFFFC
+  58 01e9 A65BFFFB 		.ascii	"\246[\377\373\244Z\377\373\243Y\377\373\241X\377\373\240W\377"
+  58      A45AFFFB 
+  58      A359FFFB 
+  58      A158FFFB 
+  58      A057FF
+  59 01fc FB9E56FF 		.ascii	"\373\236V\377\372\235V\377\372\233U\377\372\232T\377\372\230"
+  59      FA9D56FF 
+  59      FA9B55FF 
+  59      FA9A54FF 
+  59      FA98
+  60 020e 53FFFA97 		.ascii	"S\377\372\227R\377\372\225R\377\370\207K\377\367\206J\377\367"
+  60      52FFFA95 
+  60      52FFF887 
+GAS LISTING /tmp/ccaf4gN6.s 			page 4
+
+
+  60      4BFFF786 
+  60      4AFFF7
+  61 0221 844AFFF7 		.ascii	"\204J\377\367\203I\377\367\201I\377\367\200H\377\366\177H\377"
+  61      8349FFF7 
+  61      8149FFF7 
+  61      8048FFF6 
+  61      7F48FF
+  62 0234 F67D47FF 		.ascii	"\366}G\377\366|G\377\366zF\377\365yF\377\365xE\377\365vE\377"
+  62      F67C47FF 
+  62      F67A46FF 
+  62      F57946FF 
+  62      F57845FF 
+  63 024c F57544FF 		.ascii	"\365uD\377\365tD\377\364rD\377\364qC\377\364oC\377\364nC\377"
+  63      F57444FF 
+  63      F47244FF 
+  63      F47143FF 
+  63      F46F43FF 
+  64 0264 F46D43FF 		.ascii	"\364mC\377\363lC\377\363kC\377\362jC\377\362iC\377\361hD\377"
+  64      F36C43FF 
+  64      F36B43FF 
+  64      F26A43FF 
+  64      F26943FF 
+  65 027c F16744FF 		.ascii	"\361gD\377\360gD\377\360fD\377\360eD\377\357dE\377\357cE\377"
+  65      F06744FF 
+  65      F06644FF 
+  65      F06544FF 
+  65      EF6445FF 
+  66 0294 EE6345FF 		.ascii	"\356cE\377\356bE\377\355aF\377\355`F\377\354`F\377\354_F\377"
+  66      EE6245FF 
+  66      ED6146FF 
+  66      ED6046FF 
+  66      EC6046FF 
+  67 02ac EC5E46FF 		.ascii	"\354^F\377\353]F\377\353]G\377\352\\G\377\352[G\377\351[G\377"
+  67      EB5D46FF 
+  67      EB5D47FF 
+  67      EA5C47FF 
+  67      EA5B47FF 
+  68 02c4 E95A47FF 		.ascii	"\351ZG\377\342PJ\377\342OJ\377\341OJ\377\341NJ\377\340MK\377"
+  68      E2504AFF 
+  68      E24F4AFF 
+  68      E14F4AFF 
+  68      E14E4AFF 
+  69 02dc E04D4BFF 		.ascii	"\340MK\377\340LK\377\337KK\377\337KK\377\336JK\377\336JL\377"
+  69      E04C4BFF 
+  69      DF4B4BFF 
+  69      DF4B4BFF 
+  69      DE4A4BFF 
+  70 02f4 DD494CFF 		.ascii	"\335IL\377\335HL\377\335HL\377\334GL\377\334GL\377\333FL\377"
+  70      DD484CFF 
+  70      DD484CFF 
+  70      DC474CFF 
+  70      DC474CFF 
+  71 030c DB464DFF 		.ascii	"\333FM\377\333EM\377\332EM\377\332DM\377\331DM\377\331CM\377"
+  71      DB454DFF 
+  71      DA454DFF 
+  71      DA444DFF 
+  71      D9444DFF 
+GAS LISTING /tmp/ccaf4gN6.s 			page 5
+
+
+  72 0324 D9434DFF 		.ascii	"\331CM\377\330BM\377\330BN\377\327AN\377\327AN\377\327@N\377"
+  72      D8424DFF 
+  72      D8424EFF 
+  72      D7414EFF 
+  72      D7414EFF 
+  73 033c D6404EFF 		.ascii	"\326@N\377\326?N\377\325?N\377\325>N\377\325>N\377\324=N\377"
+  73      D63F4EFF 
+  73      D53F4EFF 
+  73      D53E4EFF 
+  73      D53E4EFF 
+  74 0354 D43D4EFF 		.ascii	"\324=N\377\323<N\377\323<N\377\322;N\377\322;N\377\321:N\377"
+  74      D33C4EFF 
+  74      D33C4EFF 
+  74      D23B4EFF 
+  74      D23B4EFF 
+  75 036c D13A4EFF 		.ascii	"\321:N\377\320:N\377\3209N\377\3179M\377\3178M\377\3168M\377"
+  75      D03A4EFF 
+  75      D0394EFF 
+  75      CF394DFF 
+  75      CF384DFF 
+  76 0384 CE374DFF 		.ascii	"\3167M\377\3157M\377\3157M\377\3156M\377\3146M\377\3145M\377"
+  76      CD374DFF 
+  76      CD374DFF 
+  76      CD364DFF 
+  76      CC364DFF 
+  77 039c CB354DFF 		.ascii	"\3135M\377\3135L\377\3124L\377\3124L\377\3123L\377\3113L\377"
+  77      CB354CFF 
+  77      CA344CFF 
+  77      CA344CFF 
+  77      CA334CFF 
+  78 03b4 C9334CFF 		.ascii	"\3113L\377\3102L\377\3102L\377\3101L\377\3071L\377\3071L\377"
+  78      C8324CFF 
+  78      C8324CFF 
+  78      C8314CFF 
+  78      C7314CFF 
+  79 03cc C6304BFF 		.ascii	"\3060K\377\3060K\377\3060K\377\305/K\377\305/K\377\305/K\377"
+  79      C6304BFF 
+  79      C6304BFF 
+  79      C52F4BFF 
+  79      C52F4BFF 
+  80 03e4 C42E4BFF 		.ascii	"\304.K\377\304.K\377\304.K\377\303-K\377\303-K\377\302-K\377"
+  80      C42E4BFF 
+  80      C42E4BFF 
+  80      C32D4BFF 
+  80      C32D4BFF 
+  81 03fc C22C4AFF 		.ascii	"\302,J\377\302,J\377\302,J\377\301+J\377\301+J\377\301+J\377"
+  81      C22C4AFF 
+  81      C22C4AFF 
+  81      C12B4AFF 
+  81      C12B4AFF 
+  82 0414 C02B4AFF 		.ascii	"\300+J\377\300*J\377\300*J\377\277*J\377\277)J\377\277)J\377"
+  82      C02A4AFF 
+  82      C02A4AFF 
+  82      BF2A4AFF 
+  82      BF294AFF 
+  83 042c B31D47FF 		.ascii	"\263\035G\377\263\034G\377\263\034G\377\263\034G\377\262\033"
+  83      B31C47FF 
+GAS LISTING /tmp/ccaf4gN6.s 			page 6
+
+
+  83      B31C47FF 
+  83      B31C47FF 
+  83      B21B
+  84 043e 47FFB21B 		.ascii	"G\377\262\033G\377\262\033G\377\262\033G\377\261\032F\377\261"
+  84      47FFB21B 
+  84      47FFB21B 
+  84      47FFB11A 
+  84      46FFB1
+  85 0451 1A46FFB1 		.ascii	"\032F\377\261\032F\377\260\032F\377\260\031F\377\260\031F\377"
+  85      1A46FFB0 
+  85      1A46FFB0 
+  85      1946FFB0 
+  85      1946FF
+  86 0464 B01946FF 		.ascii	"\260\031F\377\260\031F\377\257\030F\377\257\030F\377\257\030"
+  86      B01946FF 
+  86      AF1846FF 
+  86      AF1846FF 
+  86      AF18
+  87 0476 46FFAF18 		.ascii	"F\377\257\030F\377\256\027F\377\256\027F\377\256\027F\377\256"
+  87      46FFAE17 
+  87      46FFAE17 
+  87      46FFAE17 
+  87      46FFAE
+  88 0489 1746FFAD 		.ascii	"\027F\377\255\026F\377\255\026F\377\255\026E\377\255\026E\377"
+  88      1646FFAD 
+  88      1646FFAD 
+  88      1645FFAD 
+  88      1645FF
+  89 049c AD1545FF 		.ascii	"\255\025E\377\254\025E\377\254\025E\377\254\025E\377\254\025"
+  89      AC1545FF 
+  89      AC1545FF 
+  89      AC1545FF 
+  89      AC15
+  90 04ae 45FFAC14 		.ascii	"E\377\254\024E\377\253\024E\377\253\024E\377\253\024E\377\253"
+  90      45FFAB14 
+  90      45FFAB14 
+  90      45FFAB14 
+  90      45FFAB
+  91 04c1 1445FFAB 		.ascii	"\024E\377\253\023E\377\252\023E\377\252\023E\377\252\023E\377"
+  91      1345FFAA 
+  91      1345FFAA 
+  91      1345FFAA 
+  91      1345FF
+  92 04d4 AA1345FF 		.ascii	"\252\023E\377\252\022E\377\252\022E\377\251\022E\377\251\022"
+  92      AA1245FF 
+  92      AA1245FF 
+  92      A91245FF 
+  92      A912
+  93 04e6 45FFA912 		.ascii	"E\377\251\022E\377\251\021D\377\251\021D\377\251\021D\377\250"
+  93      45FFA911 
+  93      44FFA911 
+  93      44FFA911 
+  93      44FFA8
+  94 04f9 1144FFA8 		.ascii	"\021D\377\250\021D\377\250\020D\377\250\020D\377\250\020D\377"
+  94      1144FFA8 
+  94      1044FFA8 
+  94      1044FFA8 
+GAS LISTING /tmp/ccaf4gN6.s 			page 7
+
+
+  94      1044FF
+  95 050c A81044FF 		.ascii	"\250\020D\377\250\020D\377\247\020D\377\247\017D\377\247\017"
+  95      A81044FF 
+  95      A71044FF 
+  95      A70F44FF 
+  95      A70F
+  96 051e 44FFA70F 		.ascii	"D\377\247\017D\377\247\017D\377\247\017D\377\247\016D\377\246"
+  96      44FFA70F 
+  96      44FFA70F 
+  96      44FFA70E 
+  96      44FFA6
+  97 0531 0E44FFA6 		.ascii	"\016D\377\246\016D\377\246\016D\377\246\016D\377\246\016D\377"
+  97      0E44FFA6 
+  97      0E44FFA6 
+  97      0E44FFA6 
+  97      0E44FF
+  98 0544 A60D44FF 		.ascii	"\246\rD\377\246\rD\377\246\rD\377\246\rD\377\245\rD\377\245\r"
+  98      A60D44FF 
+  98      A60D44FF 
+  98      A60D44FF 
+  98      A50D44FF 
+  99 055a 44FFA50D 		.ascii	"D\377\245\rD\377\245\fC\377\245\fC\377\245\fC\377\245\fC\377"
+  99      44FFA50C 
+  99      43FFA50C 
+  99      43FFA50C 
+  99      43FFA50C 
+ 100 0570 A50C43FF 		.ascii	"\245\fC\377\245\fC\377\244\013C\377\244\013C\377\244\013C\377"
+ 100      A50C43FF 
+ 100      A40B43FF 
+ 100      A40B43FF 
+ 100      A40B43FF 
+ 101 0584 A40B43FF 		.ascii	"\244\013C\377\244\013C\377\244\013C\377\244\013C\377\244\nC\377"
+ 101      A40B43FF 
+ 101      A40B43FF 
+ 101      A40B43FF 
+ 101      A40A43FF 
+ 102 0598 A40A43FF 		.ascii	"\244\nC\377\244\nC\377\243\nC\377\243\nC\377\243\nC\377\243\n"
+ 102      A40A43FF 
+ 102      A30A43FF 
+ 102      A30A43FF 
+ 102      A30A43FF 
+ 103 05ae 43FFA30A 		.ascii	"C\377\243\nC\377\243\tC\377\243\tC\377\243\tC\377\243\tC\377"
+ 103      43FFA309 
+ 103      43FFA309 
+ 103      43FFA309 
+ 103      43FFA309 
+ 104 05c4 A30943FF 		.ascii	"\243\tC\377\243\tC\377\243\tC\377\242\bC\377\242\bC\377\242\b"
+ 104      A30943FF 
+ 104      A30943FF 
+ 104      A20843FF 
+ 104      A20843FF 
+ 105 05da 43FFA208 		.ascii	"C\377\242\bC\377\242\bC\377\242\bC\377\242\bC\377\242\bC\377"
+ 105      43FFA208 
+ 105      43FFA208 
+ 105      43FFA208 
+ 105      43FFA208 
+ 106 05f0 A20843FF 		.ascii	"\242\bC\377\242\007C\377\242\007C\377\242\007C\377\242\007C\377"
+GAS LISTING /tmp/ccaf4gN6.s 			page 8
+
+
+ 106      A20743FF 
+ 106      A20743FF 
+ 106      A20743FF 
+ 106      A20743FF 
+ 107 0604 A20743FF 		.ascii	"\242\007C\377\242\007C\377\241\007C\377\241\007C\377\241\007"
+ 107      A20743FF 
+ 107      A10743FF 
+ 107      A10743FF 
+ 107      A107
+ 108 0616 43FFA106 		.ascii	"C\377\241\006B\377\241\006B\377\241\006B\377\241\006B\377\241"
+ 108      42FFA106 
+ 108      42FFA106 
+ 108      42FFA106 
+ 108      42FFA1
+ 109 0629 0642FFA1 		.ascii	"\006B\377\241\006B\377\241\006B\377\241\006B\377\241\006B\377"
+ 109      0642FFA1 
+ 109      0642FFA1 
+ 109      0642FFA1 
+ 109      0642FF
+ 110 063c A10642FF 		.ascii	"\241\006B\377\241\006B\377\241\005B\377\241\005B\377\241\005"
+ 110      A10642FF 
+ 110      A10542FF 
+ 110      A10542FF 
+ 110      A105
+ 111 064e 42FFA105 		.ascii	"B\377\241\005B\377\240\005B\377\240\005B\377\240\005B\377\240"
+ 111      42FFA005 
+ 111      42FFA005 
+ 111      42FFA005 
+ 111      42FFA0
+ 112 0661 0542FFA0 		.ascii	"\005B\377\240\005B\377\240\005B\377\240\005B\377\240\005B\377"
+ 112      0542FFA0 
+ 112      0542FFA0 
+ 112      0542FFA0 
+ 112      0542FF
+ 113 0674 A00542FF 		.ascii	"\240\005B\377\240\004B\377\240\004B\377\240\004B\377\240\004"
+ 113      A00442FF 
+ 113      A00442FF 
+ 113      A00442FF 
+ 113      A004
+ 114 0686 42FFA004 		.ascii	"B\377\240\004B\377\240\004B\377\240\004B\377\240\004B\377\240"
+ 114      42FFA004 
+ 114      42FFA004 
+ 114      42FFA004 
+ 114      42FFA0
+ 115 0699 0442FFA0 		.ascii	"\004B\377\240\004B\377\240\004B\377\240\004B\377\240\004B\377"
+ 115      0442FFA0 
+ 115      0442FFA0 
+ 115      0442FFA0 
+ 115      0442FF
+ 116 06ac A00442FF 		.ascii	"\240\004B\377\240\004B\377\237\004B\377\237\004B\377\237\003"
+ 116      A00442FF 
+ 116      9F0442FF 
+ 116      9F0442FF 
+ 116      9F03
+ 117 06be 42FF9F03 		.ascii	"B\377\237\003B\377\237\003B\377\237\003B\377\237\003B\377\237"
+ 117      42FF9F03 
+ 117      42FF9F03 
+GAS LISTING /tmp/ccaf4gN6.s 			page 9
+
+
+ 117      42FF9F03 
+ 117      42FF9F
+ 118 06d1 0342FF9F 		.ascii	"\003B\377\237\003B\377\237\003B\377\237\003B\377\237\003B\377"
+ 118      0342FF9F 
+ 118      0342FF9F 
+ 118      0342FF9F 
+ 118      0342FF
+ 119 06e4 9F0342FF 		.ascii	"\237\003B\377\237\003B\377\237\003B\377\237\003B\377\237\003"
+ 119      9F0342FF 
+ 119      9F0342FF 
+ 119      9F0342FF 
+ 119      9F03
+ 120 06f6 42FF9F03 		.ascii	"B\377\237\003B\377\237\003B\377\237\003B\377\237\003B\377\237"
+ 120      42FF9F03 
+ 120      42FF9F03 
+ 120      42FF9F03 
+ 120      42FF9F
+ 121 0709 0342FF9F 		.ascii	"\003B\377\237\003B\377\237\003B\377\237\003B\377\237\002B\377"
+ 121      0342FF9F 
+ 121      0342FF9F 
+ 121      0342FF9F 
+ 121      0242FF
+ 122 071c 9F0242FF 		.ascii	"\237\002B\377\237\002B\377\237\002B\377\237\002B\377\237\002"
+ 122      9F0242FF 
+ 122      9F0242FF 
+ 122      9F0242FF 
+ 122      9F02
+ 123 072e 42FF9F02 		.ascii	"B\377\237\002B\377\237\002B\377\237\002B\377\237\002B\377\237"
+ 123      42FF9F02 
+ 123      42FF9F02 
+ 123      42FF9F02 
+ 123      42FF9F
+ 124 0741 0242FF9F 		.ascii	"\002B\377\237\002B\377\237\002B\377\237\002B\377\237\002B\377"
+ 124      0242FF9F 
+ 124      0242FF9F 
+ 124      0242FF9F 
+ 124      0242FF
+ 125 0754 9E0242FF 		.ascii	"\236\002B\377\236\002B\377\236\002B\377\236\002B\377\236\002"
+ 125      9E0242FF 
+ 125      9E0242FF 
+ 125      9E0242FF 
+ 125      9E02
+ 126 0766 42FF9E02 		.ascii	"B\377\236\002B\377\236\002B\377\236\002B\377\236\002B\377\236"
+ 126      42FF9E02 
+ 126      42FF9E02 
+ 126      42FF9E02 
+ 126      42FF9E
+ 127 0779 0242FF9E 		.ascii	"\002B\377\236\002B\377\236\002B\377\236\002B\377\236\002B\377"
+ 127      0242FF9E 
+ 127      0242FF9E 
+ 127      0242FF9E 
+ 127      0242FF
+ 128 078c 9E0242FF 		.ascii	"\236\002B\377\236\002B\377\236\002B\377\236\002B\377\236\002"
+ 128      9E0242FF 
+ 128      9E0242FF 
+ 128      9E0242FF 
+ 128      9E02
+GAS LISTING /tmp/ccaf4gN6.s 			page 10
+
+
+ 129 079e 42FF9E02 		.ascii	"B\377\236\002B\377\236\002B\377\236\002B\377\236\001B\377\236"
+ 129      42FF9E02 
+ 129      42FF9E02 
+ 129      42FF9E01 
+ 129      42FF9E
+ 130 07b1 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 130      0142FF9E 
+ 130      0142FF9E 
+ 130      0142FF9E 
+ 130      0142FF
+ 131 07c4 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377"
+ 131      9E0142FF 
+ 131      9E0142FF 
+ 132 07d0 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 132      9E0142FF 
+ 132      9E0142FF 
+ 132      9E0142FF 
+ 132      9E01
+ 133 07e2 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 133      42FF9E01 
+ 133      42FF9E01 
+ 133      42FF9E01 
+ 133      42FF9E
+ 134 07f5 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 134      0142FF9E 
+ 134      0142FF9E 
+ 134      0142FF9E 
+ 134      0142FF
+ 135 0808 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 135      9E0142FF 
+ 135      9E0142FF 
+ 135      9E0142FF 
+ 135      9E01
+ 136 081a 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 136      42FF9E01 
+ 136      42FF9E01 
+ 136      42FF9E01 
+ 136      42FF9E
+ 137 082d 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 137      0142FF9E 
+ 137      0142FF9E 
+ 137      0142FF9E 
+ 137      0142FF
+ 138 0840 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 138      9E0142FF 
+ 138      9E0142FF 
+ 138      9E0142FF 
+ 138      9E01
+ 139 0852 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 139      42FF9E01 
+ 139      42FF9E01 
+ 139      42FF9E01 
+ 139      42FF9E
+ 140 0865 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 140      0142FF9E 
+ 140      0142FF9E 
+ 140      0142FF9E 
+GAS LISTING /tmp/ccaf4gN6.s 			page 11
+
+
+ 140      0142FF
+ 141 0878 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 141      9E0142FF 
+ 141      9E0142FF 
+ 141      9E0142FF 
+ 141      9E01
+ 142 088a 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 142      42FF9E01 
+ 142      42FF9E01 
+ 142      42FF9E01 
+ 142      42FF9E
+ 143 089d 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 143      0142FF9E 
+ 143      0142FF9E 
+ 143      0142FF9E 
+ 143      0142FF
+ 144 08b0 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 144      9E0142FF 
+ 144      9E0142FF 
+ 144      9E0142FF 
+ 144      9E01
+ 145 08c2 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 145      42FF9E01 
+ 145      42FF9E01 
+ 145      42FF9E01 
+ 145      42FF9E
+ 146 08d5 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 146      0142FF9E 
+ 146      0142FF9E 
+ 146      0142FF9E 
+ 146      0142FF
+ 147 08e8 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 147      9E0142FF 
+ 147      9E0142FF 
+ 147      9E0142FF 
+ 147      9E01
+ 148 08fa 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 148      42FF9E01 
+ 148      42FF9E01 
+ 148      42FF9E01 
+ 148      42FF9E
+ 149 090d 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 149      0142FF9E 
+ 149      0142FF9E 
+ 149      0142FF9E 
+ 149      0142FF
+ 150 0920 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 150      9E0142FF 
+ 150      9E0142FF 
+ 150      9E0142FF 
+ 150      9E01
+ 151 0932 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 151      42FF9E01 
+ 151      42FF9E01 
+ 151      42FF9E01 
+ 151      42FF9E
+ 152 0945 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+GAS LISTING /tmp/ccaf4gN6.s 			page 12
+
+
+ 152      0142FF9E 
+ 152      0142FF9E 
+ 152      0142FF9E 
+ 152      0142FF
+ 153 0958 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 153      9E0142FF 
+ 153      9E0142FF 
+ 153      9E0142FF 
+ 153      9E01
+ 154 096a 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 154      42FF9E01 
+ 154      42FF9E01 
+ 154      42FF9E01 
+ 154      42FF9E
+ 155 097d 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 155      0142FF9E 
+ 155      0142FF9E 
+ 155      0142FF9E 
+ 155      0142FF
+ 156 0990 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 156      9E0142FF 
+ 156      9E0142FF 
+ 156      9E0142FF 
+ 156      9E01
+ 157 09a2 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 157      42FF9E01 
+ 157      42FF9E01 
+ 157      42FF9E01 
+ 157      42FF9E
+ 158 09b5 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 158      0142FF9E 
+ 158      0142FF9E 
+ 158      0142FF9E 
+ 158      0142FF
+ 159 09c8 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 159      9E0142FF 
+ 159      9E0142FF 
+ 159      9E0142FF 
+ 159      9E01
+ 160 09da 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 160      42FF9E01 
+ 160      42FF9E01 
+ 160      42FF9E01 
+ 160      42FF9E
+ 161 09ed 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 161      0142FF9E 
+ 161      0142FF9E 
+ 161      0142FF9E 
+ 161      0142FF
+ 162 0a00 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 162      9E0142FF 
+ 162      9E0142FF 
+ 162      9E0142FF 
+ 162      9E01
+ 163 0a12 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 163      42FF9E01 
+ 163      42FF9E01 
+GAS LISTING /tmp/ccaf4gN6.s 			page 13
+
+
+ 163      42FF9E01 
+ 163      42FF9E
+ 164 0a25 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 164      0142FF9E 
+ 164      0142FF9E 
+ 164      0142FF9E 
+ 164      0142FF
+ 165 0a38 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 165      9E0142FF 
+ 165      9E0142FF 
+ 165      9E0142FF 
+ 165      9E01
+ 166 0a4a 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 166      42FF9E01 
+ 166      42FF9E01 
+ 166      42FF9E01 
+ 166      42FF9E
+ 167 0a5d 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 167      0142FF9E 
+ 167      0142FF9E 
+ 167      0142FF9E 
+ 167      0142FF
+ 168 0a70 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 168      9E0142FF 
+ 168      9E0142FF 
+ 168      9E0142FF 
+ 168      9E01
+ 169 0a82 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 169      42FF9E01 
+ 169      42FF9E01 
+ 169      42FF9E01 
+ 169      42FF9E
+ 170 0a95 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 170      0142FF9E 
+ 170      0142FF9E 
+ 170      0142FF9E 
+ 170      0142FF
+ 171 0aa8 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 171      9E0142FF 
+ 171      9E0142FF 
+ 171      9E0142FF 
+ 171      9E01
+ 172 0aba 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 172      42FF9E01 
+ 172      42FF9E01 
+ 172      42FF9E01 
+ 172      42FF9E
+ 173 0acd 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 173      0142FF9E 
+ 173      0142FF9E 
+ 173      0142FF9E 
+ 173      0142FF
+ 174 0ae0 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 174      9E0142FF 
+ 174      9E0142FF 
+ 174      9E0142FF 
+ 174      9E01
+GAS LISTING /tmp/ccaf4gN6.s 			page 14
+
+
+ 175 0af2 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 175      42FF9E01 
+ 175      42FF9E01 
+ 175      42FF9E01 
+ 175      42FF9E
+ 176 0b05 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 176      0142FF9E 
+ 176      0142FF9E 
+ 176      0142FF9E 
+ 176      0142FF
+ 177 0b18 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 177      9E0142FF 
+ 177      9E0142FF 
+ 177      9E0142FF 
+ 177      9E01
+ 178 0b2a 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 178      42FF9E01 
+ 178      42FF9E01 
+ 178      42FF9E01 
+ 178      42FF9E
+ 179 0b3d 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 179      0142FF9E 
+ 179      0142FF9E 
+ 179      0142FF9E 
+ 179      0142FF
+ 180 0b50 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 180      9E0142FF 
+ 180      9E0142FF 
+ 180      9E0142FF 
+ 180      9E01
+ 181 0b62 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 181      42FF9E01 
+ 181      42FF9E01 
+ 181      42FF9E01 
+ 181      42FF9E
+ 182 0b75 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 182      0142FF9E 
+ 182      0142FF9E 
+ 182      0142FF9E 
+ 182      0142FF
+ 183 0b88 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 183      9E0142FF 
+ 183      9E0142FF 
+ 183      9E0142FF 
+ 183      9E01
+ 184 0b9a 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 184      42FF9E01 
+ 184      42FF9E01 
+ 184      42FF9E01 
+ 184      42FF9E
+ 185 0bad 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 185      0142FF9E 
+ 185      0142FF9E 
+ 185      0142FF9E 
+ 185      0142FF
+ 186 0bc0 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 186      9E0142FF 
+GAS LISTING /tmp/ccaf4gN6.s 			page 15
+
+
+ 186      9E0142FF 
+ 186      9E0142FF 
+ 186      9E01
+ 187 0bd2 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 187      42FF9E01 
+ 187      42FF9E01 
+ 187      42FF9E01 
+ 187      42FF9E
+ 188 0be5 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 188      0142FF9E 
+ 188      0142FF9E 
+ 188      0142FF9E 
+ 188      0142FF
+ 189 0bf8 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 189      9E0142FF 
+ 189      9E0142FF 
+ 189      9E0142FF 
+ 189      9E01
+ 190 0c0a 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 190      42FF9E01 
+ 190      42FF9E01 
+ 190      42FF9E01 
+ 190      42FF9E
+ 191 0c1d 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 191      0142FF9E 
+ 191      0142FF9E 
+ 191      0142FF9E 
+ 191      0142FF
+ 192 0c30 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 192      9E0142FF 
+ 192      9E0142FF 
+ 192      9E0142FF 
+ 192      9E01
+ 193 0c42 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 193      42FF9E01 
+ 193      42FF9E01 
+ 193      42FF9E01 
+ 193      42FF9E
+ 194 0c55 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 194      0142FF9E 
+ 194      0142FF9E 
+ 194      0142FF9E 
+ 194      0142FF
+ 195 0c68 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 195      9E0142FF 
+ 195      9E0142FF 
+ 195      9E0142FF 
+ 195      9E01
+ 196 0c7a 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 196      42FF9E01 
+ 196      42FF9E01 
+ 196      42FF9E01 
+ 196      42FF9E
+ 197 0c8d 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 197      0142FF9E 
+ 197      0142FF9E 
+ 197      0142FF9E 
+GAS LISTING /tmp/ccaf4gN6.s 			page 16
+
+
+ 197      0142FF
+ 198 0ca0 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 198      9E0142FF 
+ 198      9E0142FF 
+ 198      9E0142FF 
+ 198      9E01
+ 199 0cb2 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 199      42FF9E01 
+ 199      42FF9E01 
+ 199      42FF9E01 
+ 199      42FF9E
+ 200 0cc5 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 200      0142FF9E 
+ 200      0142FF9E 
+ 200      0142FF9E 
+ 200      0142FF
+ 201 0cd8 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 201      9E0142FF 
+ 201      9E0142FF 
+ 201      9E0142FF 
+ 201      9E01
+ 202 0cea 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 202      42FF9E01 
+ 202      42FF9E01 
+ 202      42FF9E01 
+ 202      42FF9E
+ 203 0cfd 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377"
+ 203      0142FF9E 
+ 203      0142FF9E 
+ 203      0142FF9E 
+ 203      0142FF
+ 204 0d10 9E0142FF 		.ascii	"\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236\001"
+ 204      9E0142FF 
+ 204      9E0142FF 
+ 204      9E0142FF 
+ 204      9E01
+ 205 0d22 42FF9E01 		.ascii	"B\377\236\001B\377\236\001B\377\236\001B\377\236\001B\377\236"
+ 205      42FF9E01 
+ 205      42FF9E01 
+ 205      42FF9E01 
+ 205      42FF9E
+ 206 0d35 0142FF9E 		.ascii	"\001B\377\236\001B\377\236\001B\377\236\001B\377\235\001B\377"
+ 206      0142FF9E 
+ 206      0142FF9E 
+ 206      0142FF9D 
+ 206      0142FF
+ 207 0d48 9D0142FF 		.ascii	"\235\001B\377\235\001B\377\235\001B\377\235\001B\377\235\001"
+ 207      9D0142FF 
+ 207      9D0142FF 
+ 207      9D0142FF 
+ 207      9D01
+ 208 0d5a 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+ 208      41FF9D01 
+ 208      41FF9D01 
+ 208      41FF9D01 
+ 208      41FF9D
+ 209 0d6d 0141FF9D 		.ascii	"\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377"
+GAS LISTING /tmp/ccaf4gN6.s 			page 17
+
+
+ 209      0141FF9D 
+ 209      0141FF9D 
+ 209      0141FF9D 
+ 209      0141FF
+ 210 0d80 9D0141FF 		.ascii	"\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001"
+ 210      9D0141FF 
+ 210      9D0141FF 
+ 210      9D0141FF 
+ 210      9D01
+ 211 0d92 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+ 211      41FF9D01 
+ 211      41FF9D01 
+ 211      41FF9D01 
+ 211      41FF9D
+ 212 0da5 0141FF9D 		.ascii	"\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377"
+ 212      0141FF9D 
+ 212      0141FF9D 
+ 212      0141FF9D 
+ 212      0141FF
+ 213 0db8 9D0141FF 		.ascii	"\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001"
+ 213      9D0141FF 
+ 213      9D0141FF 
+ 213      9D0141FF 
+ 213      9D01
+ 214 0dca 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+ 214      41FF9D01 
+ 214      41FF9D01 
+ 214      41FF9D01 
+ 214      41FF9D
+ 215 0ddd 0141FF9D 		.ascii	"\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377"
+ 215      0141FF9D 
+ 215      0141FF9D 
+ 215      0141FF9D 
+ 215      0141FF
+ 216 0df0 9D0141FF 		.ascii	"\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001"
+ 216      9D0141FF 
+ 216      9D0141FF 
+ 216      9D0141FF 
+ 216      9D01
+ 217 0e02 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+ 217      41FF9D01 
+ 217      41FF9D01 
+ 217      41FF9D01 
+ 217      41FF9D
+ 218 0e15 0141FF9D 		.ascii	"\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377"
+ 218      0141FF9D 
+ 218      0141FF9D 
+ 218      0141FF9D 
+ 218      0141FF
+ 219 0e28 9D0141FF 		.ascii	"\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001"
+ 219      9D0141FF 
+ 219      9D0141FF 
+ 219      9D0141FF 
+ 219      9D01
+ 220 0e3a 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+ 220      41FF9D01 
+ 220      41FF9D01 
+GAS LISTING /tmp/ccaf4gN6.s 			page 18
+
+
+ 220      41FF9D01 
+ 220      41FF9D
+ 221 0e4d 0141FF9D 		.ascii	"\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377"
+ 221      0141FF9D 
+ 221      0141FF9D 
+ 221      0141FF9D 
+ 221      0141FF
+ 222 0e60 9D0141FF 		.ascii	"\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001"
+ 222      9D0141FF 
+ 222      9D0141FF 
+ 222      9D0141FF 
+ 222      9D01
+ 223 0e72 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+ 223      41FF9D01 
+ 223      41FF9D01 
+ 223      41FF9D01 
+ 223      41FF9D
+ 224 0e85 0141FF9D 		.ascii	"\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377"
+ 224      0141FF9D 
+ 224      0141FF9D 
+ 224      0141FF9D 
+ 224      0141FF
+ 225 0e98 9D0141FF 		.ascii	"\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001"
+ 225      9D0141FF 
+ 225      9D0141FF 
+ 225      9D0141FF 
+ 225      9D01
+ 226 0eaa 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+ 226      41FF9D01 
+ 226      41FF9D01 
+ 226      41FF9D01 
+ 226      41FF9D
+ 227 0ebd 0141FF9D 		.ascii	"\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377"
+ 227      0141FF9D 
+ 227      0141FF9D 
+ 227      0141FF9D 
+ 227      0141FF
+ 228 0ed0 9D0141FF 		.ascii	"\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001"
+ 228      9D0141FF 
+ 228      9D0141FF 
+ 228      9D0141FF 
+ 228      9D01
+ 229 0ee2 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+ 229      41FF9D01 
+ 229      41FF9D01 
+ 229      41FF9D01 
+ 229      41FF9D
+ 230 0ef5 0141FF9D 		.ascii	"\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377"
+ 230      0141FF9D 
+ 230      0141FF9D 
+ 230      0141FF9D 
+ 230      0141FF
+ 231 0f08 9D0141FF 		.ascii	"\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001"
+ 231      9D0141FF 
+ 231      9D0141FF 
+ 231      9D0141FF 
+ 231      9D01
+GAS LISTING /tmp/ccaf4gN6.s 			page 19
+
+
+ 232 0f1a 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+ 232      41FF9D01 
+ 232      41FF9D01 
+ 232      41FF9D01 
+ 232      41FF9D
+ 233 0f2d 0141FF9D 		.ascii	"\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377"
+ 233      0141FF9D 
+ 233      0141FF9D 
+ 233      0141FF9D 
+ 233      0141FF
+ 234 0f40 9D0141FF 		.ascii	"\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001"
+ 234      9D0141FF 
+ 234      9D0141FF 
+ 234      9D0141FF 
+ 234      9D01
+ 235 0f52 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+ 235      41FF9D01 
+ 235      41FF9D01 
+ 235      41FF9D01 
+ 235      41FF9D
+ 236 0f65 0141FF9D 		.ascii	"\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377"
+ 236      0141FF9D 
+ 236      0141FF9D 
+ 236      0141FF9D 
+ 236      0141FF
+ 237 0f78 9D0141FF 		.ascii	"\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001"
+ 237      9D0141FF 
+ 237      9D0141FF 
+ 237      9D0141FF 
+ 237      9D01
+ 238 0f8a 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+ 238      41FF9D01 
+ 238      41FF9D01 
+ 238      41FF9D01 
+ 238      41FF9D
+ 239 0f9d 0141FF   		.ascii	"\001A\377"
+ 240 0fa0 9D0141FF 		.ascii	"\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001"
+ 240      9D0141FF 
+ 240      9D0141FF 
+ 240      9D0141FF 
+ 240      9D01
+ 241 0fb2 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+ 241      41FF9D01 
+ 241      41FF9D01 
+ 241      41FF9D01 
+ 241      41FF9D
+ 242 0fc5 0141FF9D 		.ascii	"\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377"
+ 242      0141FF9D 
+ 242      0141FF9D 
+ 242      0141FF9D 
+ 242      0141FF
+ 243 0fd8 9D0141FF 		.ascii	"\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235\001"
+ 243      9D0141FF 
+ 243      9D0141FF 
+ 243      9D0141FF 
+ 243      9D01
+ 244 0fea 41FF9D01 		.ascii	"A\377\235\001A\377\235\001A\377\235\001A\377\235\001A\377\235"
+GAS LISTING /tmp/ccaf4gN6.s 			page 20
+
+
+ 244      41FF9D01 
+ 244      41FF9D01 
+ 244      41FF9D01 
+ 244      41FF9D
+ 245 0ffd 0141FF9D 		.ascii	"\001A\377\235\001A\377"
+ 245      0141FF
+ 246              		.globl	heatmap_cs_Spectral_mixed
+ 247              		.section	.data.rel.local
+ 248              		.align 8
+ 249              		.type	heatmap_cs_Spectral_mixed, @object
+ 250              		.size	heatmap_cs_Spectral_mixed, 8
+ 251              	heatmap_cs_Spectral_mixed:
+ 252 0008 00000000 		.quad	mixed
+ 252      00000000 
+ 253              		.section	.data.rel.ro.local
+ 254              		.align 16
+ 255              		.type	mixed, @object
+ 256              		.size	mixed, 16
+ 257              	mixed:
+ 258 0010 00000000 		.quad	mixed_data
+ 258      00000000 
+ 259 0018 01040000 		.quad	1025
+ 259      00000000 
+ 260              		.section	.rodata
+ 261 1004 00000000 		.align 32
+ 261      00000000 
+ 261      00000000 
+ 261      00000000 
+ 261      00000000 
+ 262              		.type	mixed_data, @object
+ 263              		.size	mixed_data, 4100
+ 264              	mixed_data:
+ 265 1020 00       		.string	""
+ 266 1021 00       		.string	""
+ 267 1022 00       		.string	""
+ 268 1023 00       		.string	""
+ 269 1024 5E4FA200 		.string	"^O\242"
+ 270 1028 5D4FA207 		.ascii	"]O\242\007]P\242\016\\P\243\026\\Q\243\035[Q\244%[R\244,ZR\244"
+ 270      5D50A20E 
+ 270      5C50A316 
+ 270      5C51A31D 
+ 270      5B51A425 
+ 271 1043 345A53A5 		.ascii	"4ZS\245;YS\245CYT\246JXT\246RXU\246YWU\247aWV\247hVV\247pVW\250"
+ 271      3B5953A5 
+ 271      435954A6 
+ 271      4A5854A6 
+ 271      525855A6 
+ 272 1067 775557A8 		.ascii	"wUW\250\177UX\250\206TX\251\215TY\251\225SY\251\234SZ\252\244"
+ 272      7F5558A8 
+ 272      865458A9 
+ 272      8D5459A9 
+ 272      955359A9 
+ 273 1080 535AAAAB 		.ascii	"SZ\252\253R[\252\263R[\253\272Q\\\253\302Q\\\253\311P]\254\321"
+ 273      525BAAB3 
+ 273      525BABBA 
+ 273      515CABC2 
+ 273      515CABC9 
+GAS LISTING /tmp/ccaf4gN6.s 			page 21
+
+
+ 274 1098 505DACD8 		.ascii	"P]\254\330O^\254\340O^\254\347N_\255\357N_\255\366M_\255\376"
+ 274      4F5EACE0 
+ 274      4F5EACE7 
+ 274      4E5FADEF 
+ 274      4E5FADF6 
+ 275 10b0 4D60AEFF 		.ascii	"M`\256\377L`\256\377La\256\377Ka\256\377Kb\257\377Jb\257\377"
+ 275      4C60AEFF 
+ 275      4C61AEFF 
+ 275      4B61AEFF 
+ 275      4B62AFFF 
+ 276 10c8 4A63AFFF 		.ascii	"Jc\257\377Ic\257\377Id\260\377Hd\260\377He\260\377He\260\377"
+ 276      4963AFFF 
+ 276      4964B0FF 
+ 276      4864B0FF 
+ 276      4865B0FF 
+ 277 10e0 4765B0FF 		.ascii	"Ge\260\377Gf\261\377Ff\261\377Fg\261\377Eg\261\377<s\267\377"
+ 277      4766B1FF 
+ 277      4666B1FF 
+ 277      4667B1FF 
+ 277      4567B1FF 
+ 278 10f8 3C73B7FF 		.ascii	"<s\267\377;t\267\377;t\267\377:u\270\377:u\270\377:v\270\377"
+ 278      3B74B7FF 
+ 278      3B74B7FF 
+ 278      3A75B8FF 
+ 278      3A75B8FF 
+ 279 1110 3976B8FF 		.ascii	"9v\270\3779v\270\3778w\270\3778w\271\3778x\271\3777x\271\377"
+ 279      3976B8FF 
+ 279      3877B8FF 
+ 279      3877B9FF 
+ 279      3878B9FF 
+ 280 1128 3779B9FF 		.ascii	"7y\271\3777y\271\3776y\271\3776z\272\3776z\272\3775{\272\377"
+ 280      3779B9FF 
+ 280      3679B9FF 
+ 280      367ABAFF 
+ 280      367ABAFF 
+ 281 1140 357BBAFF 		.ascii	"5{\272\3775|\272\3774|\272\3774|\272\3774}\272\3774}\273\377"
+ 281      357CBAFF 
+ 281      347CBAFF 
+ 281      347CBAFF 
+ 281      347DBAFF 
+ 282 1158 337EBBFF 		.ascii	"3~\273\3773~\273\3773~\273\3773\177\273\3772\177\273\3772\200"
+ 282      337EBBFF 
+ 282      337EBBFF 
+ 282      337FBBFF 
+ 282      327FBBFF 
+ 283 116e BBFF3280 		.ascii	"\273\3772\200\273\3772\200\273\3772\201\273\3772\201\274\377"
+ 283      BBFF3280 
+ 283      BBFF3281 
+ 283      BBFF3281 
+ 283      BCFF
+ 284 1180 3282BCFF 		.ascii	"2\202\274\3771\202\274\3771\202\274\3771\203\274\3771\203\274"
+ 284      3182BCFF 
+ 284      3182BCFF 
+ 284      3183BCFF 
+ 284      3183BC
+ 285 1193 FF3184BC 		.ascii	"\3771\204\274\3771\204\274\3771\204\274\3771\205\274\3771\205"
+ 285      FF3184BC 
+GAS LISTING /tmp/ccaf4gN6.s 			page 22
+
+
+ 285      FF3184BC 
+ 285      FF3185BC 
+ 285      FF3185
+ 286 11a6 BCFF3185 		.ascii	"\274\3771\205\274\3771\206\274\3771\206\274\3771\207\274\377"
+ 286      BCFF3186 
+ 286      BCFF3186 
+ 286      BCFF3187 
+ 286      BCFF
+ 287 11b8 3187BCFF 		.ascii	"1\207\274\3771\207\274\3771\210\275\377/\210\275\377.\211\275"
+ 287      3187BCFF 
+ 287      3188BDFF 
+ 287      2F88BDFF 
+ 287      2E89BD
+ 288 11cb FF2D8ABD 		.ascii	"\377-\212\275\377+\212\275\377*\213\276\377)\213\276\377'\214"
+ 288      FF2B8ABD 
+ 288      FF2A8BBE 
+ 288      FF298BBE 
+ 288      FF278C
+ 289 11de BEFF268C 		.ascii	"\276\377&\214\276\377$\215\276\377#\215\276\377!\216\276\377"
+ 289      BEFF248D 
+ 289      BEFF238D 
+ 289      BEFF218E 
+ 289      BEFF
+ 290 11f0 1F8EBEFF 		.ascii	"\037\216\276\377\036\217\276\377\034\217\276\377\032\220\277"
+ 290      1E8FBEFF 
+ 290      1C8FBEFF 
+ 290      1A90BF
+ 291 11ff FF1891BF 		.ascii	"\377\030\221\277\377\026\221\277\377\024\222\277\377\021\222"
+ 291      FF1691BF 
+ 291      FF1492BF 
+ 291      FF1192
+ 292 120e BFFF0F93 		.ascii	"\277\377\017\223\277\377\f\223\277\377\n\224\277\377\n\224\277"
+ 292      BFFF0C93 
+ 292      BFFF0A94 
+ 292      BFFF0A94 
+ 292      BF
+ 293 121f FF0A95BF 		.ascii	"\377\n\225\277\377\n\225\277\377\n\226\277\377\n\226\276\377"
+ 293      FF0A95BF 
+ 293      FF0A96BF 
+ 293      FF0A96BE 
+ 293      FF
+ 294 1230 0A97BEFF 		.ascii	"\n\227\276\377\n\227\276\377\n\230\276\377\n\230\276\377\n\231"
+ 294      0A97BEFF 
+ 294      0A98BEFF 
+ 294      0A98BEFF 
+ 294      0A99
+ 295 1242 BEFF0A99 		.ascii	"\276\377\n\231\276\377\n\232\276\377\n\232\276\377\n\233\276"
+ 295      BEFF0A9A 
+ 295      BEFF0A9A 
+ 295      BEFF0A9B 
+ 295      BE
+ 296 1253 FF0A9BBD 		.ascii	"\377\n\233\275\377\n\234\275\377\n\234\275\377\n\235\275\377"
+ 296      FF0A9CBD 
+ 296      FF0A9CBD 
+ 296      FF0A9DBD 
+ 296      FF
+ 297 1264 0A9DBDFF 		.ascii	"\n\235\275\377\n\236\275\377\n\236\274\377\n\236\274\377\n\237"
+GAS LISTING /tmp/ccaf4gN6.s 			page 23
+
+
+ 297      0A9EBDFF 
+ 297      0A9EBCFF 
+ 297      0A9EBCFF 
+ 297      0A9F
+ 298 1276 BCFF0A9F 		.ascii	"\274\377\n\237\274\377\n\240\274\377\n\240\273\377\n\241\273"
+ 298      BCFF0AA0 
+ 298      BCFF0AA0 
+ 298      BBFF0AA1 
+ 298      BB
+ 299 1287 FF0AA1BB 		.ascii	"\377\n\241\273\377\024\255\266\377\026\256\266\377\031\256\265"
+ 299      FF14ADB6 
+ 299      FF16AEB6 
+ 299      FF19AEB5 
+ 300 1297 FF1CAFB5 		.ascii	"\377\034\257\265\377\036\257\265\377!\260\264\377#\260\264\377"
+ 300      FF1EAFB5 
+ 300      FF21B0B4 
+ 300      FF23B0B4 
+ 300      FF
+ 301 12a8 25B0B4FF 		.ascii	"%\260\264\377'\261\264\377)\261\263\377+\262\263\377-\262\263"
+ 301      27B1B4FF 
+ 301      29B1B3FF 
+ 301      2BB2B3FF 
+ 301      2DB2B3
+ 302 12bb FF2EB3B2 		.ascii	"\377.\263\262\3770\263\262\3772\263\262\3773\264\261\3775\264"
+ 302      FF30B3B2 
+ 302      FF32B3B2 
+ 302      FF33B4B1 
+ 302      FF35B4
+ 303 12ce B1FF36B5 		.ascii	"\261\3776\265\261\3778\265\260\377:\266\260\377;\266\260\377"
+ 303      B1FF38B5 
+ 303      B0FF3AB6 
+ 303      B0FF3BB6 
+ 303      B0FF
+ 304 12e0 3DB6AFFF 		.ascii	"=\266\257\377>\267\257\377@\267\257\377A\270\256\377B\270\256"
+ 304      3EB7AFFF 
+ 304      40B7AFFF 
+ 304      41B8AEFF 
+ 304      42B8AE
+ 305 12f3 FF44B8AE 		.ascii	"\377D\270\256\377E\271\255\377G\271\255\377H\272\255\377J\272"
+ 305      FF45B9AD 
+ 305      FF47B9AD 
+ 305      FF48BAAD 
+ 305      FF4ABA
+ 306 1306 ACFF4BBA 		.ascii	"\254\377K\272\254\377L\273\253\377N\273\253\377O\273\253\377"
+ 306      ACFF4CBB 
+ 306      ABFF4EBB 
+ 306      ABFF4FBB 
+ 306      ABFF
+ 307 1318 50BCAAFF 		.ascii	"P\274\252\377R\274\252\377S\275\252\377U\275\251\377V\275\251"
+ 307      52BCAAFF 
+ 307      53BDAAFF 
+ 307      55BDA9FF 
+ 307      56BDA9
+ 308 132b FF57BEA9 		.ascii	"\377W\276\251\377Y\276\250\377Z\276\250\377[\277\247\377]\277"
+ 308      FF59BEA8 
+ 308      FF5ABEA8 
+ 308      FF5BBFA7 
+GAS LISTING /tmp/ccaf4gN6.s 			page 24
+
+
+ 308      FF5DBF
+ 309 133e A7FF5EBF 		.ascii	"\247\377^\277\247\377_\300\246\377a\300\246\377b\301\246\377"
+ 309      A7FF5FC0 
+ 309      A6FF61C0 
+ 309      A6FF62C1 
+ 309      A6FF
+ 310 1350 63C1A5FF 		.ascii	"c\301\245\377d\301\245\377f\302\244\377f\302\244\377g\302\244"
+ 310      64C1A5FF 
+ 310      66C2A4FF 
+ 310      66C2A4FF 
+ 310      67C2A4
+ 311 1363 FF67C2A4 		.ascii	"\377g\302\244\377h\302\244\377h\303\244\377i\303\244\377i\303"
+ 311      FF68C2A4 
+ 311      FF68C3A4 
+ 311      FF69C3A4 
+ 311      FF69C3
+ 312 1376 A4FF6AC3 		.ascii	"\244\377j\303\244\377j\304\244\377k\304\244\377l\304\244\377"
+ 312      A4FF6AC4 
+ 312      A4FF6BC4 
+ 312      A4FF6CC4 
+ 312      A4FF
+ 313 1388 6CC4A4FF 		.ascii	"l\304\244\377m\304\244\377m\305\244\377n\305\244\377n\305\244"
+ 313      6DC4A4FF 
+ 313      6DC5A4FF 
+ 313      6EC5A4FF 
+ 313      6EC5A4
+ 314 139b FF6FC5A4 		.ascii	"\377o\305\244\377o\306\244\377p\306\244\377p\306\244\377q\306"
+ 314      FF6FC6A4 
+ 314      FF70C6A4 
+ 314      FF70C6A4 
+ 314      FF71C6
+ 315 13ae A4FF71C6 		.ascii	"\244\377q\306\244\377r\307\244\377s\307\244\377s\307\244\377"
+ 315      A4FF72C7 
+ 315      A4FF73C7 
+ 315      A4FF73C7 
+ 315      A4FF
+ 316 13c0 74C7A4FF 		.ascii	"t\307\244\377t\310\244\377u\310\244\377u\310\244\377v\310\244"
+ 316      74C8A4FF 
+ 316      75C8A4FF 
+ 316      75C8A4FF 
+ 316      76C8A4
+ 317 13d3 FF76C8A4 		.ascii	"\377v\310\244\377w\311\244\377w\311\244\377x\311\244\377x\311"
+ 317      FF77C9A4 
+ 317      FF77C9A4 
+ 317      FF78C9A4 
+ 317      FF78C9
+ 318 13e6 A4FF79C9 		.ascii	"\244\377y\311\244\377z\312\244\377z\312\244\377{\312\244\377"
+ 318      A4FF7ACA 
+ 318      A4FF7ACA 
+ 318      A4FF7BCA 
+ 318      A4FF
+ 319 13f8 7BCAA4FF 		.ascii	"{\312\244\377|\313\244\377|\313\244\377}\313\244\377}\313\244"
+ 319      7CCBA4FF 
+ 319      7CCBA4FF 
+ 319      7DCBA4FF 
+ 319      7DCBA4
+ 320 140b FF7ECBA4 		.ascii	"\377~\313\244\377~\314\244\377\177\314\244\377\177\314\243\377"
+GAS LISTING /tmp/ccaf4gN6.s 			page 25
+
+
+ 320      FF7ECCA4 
+ 320      FF7FCCA4 
+ 320      FF7FCCA3 
+ 320      FF
+ 321 141c 80CCA3FF 		.ascii	"\200\314\243\377\201\314\243\377\217\322\243\377\217\322\243"
+ 321      81CCA3FF 
+ 321      8FD2A3FF 
+ 321      8FD2A3
+ 322 142b FF90D2A3 		.ascii	"\377\220\322\243\377\220\323\243\377\221\323\243\377\222\323"
+ 322      FF90D3A3 
+ 322      FF91D3A3 
+ 322      FF92D3
+ 323 143a A3FF92D3 		.ascii	"\243\377\222\323\243\377\223\324\243\377\223\324\243\377\224"
+ 323      A3FF93D4 
+ 323      A3FF93D4 
+ 323      A3FF94
+ 324 1449 D4A3FF94 		.ascii	"\324\243\377\224\324\243\377\225\324\243\377\225\325\243\377"
+ 324      D4A3FF95 
+ 324      D4A3FF95 
+ 324      D5A3FF
+ 325 1458 96D5A3FF 		.ascii	"\226\325\243\377\226\325\243\377\227\325\243\377\227\325\243"
+ 325      96D5A3FF 
+ 325      97D5A3FF 
+ 325      97D5A3
+ 326 1467 FF98D6A3 		.ascii	"\377\230\326\243\377\231\326\243\377\231\326\243\377\232\326"
+ 326      FF99D6A3 
+ 326      FF99D6A3 
+ 326      FF9AD6
+ 327 1476 A3FF9AD6 		.ascii	"\243\377\232\326\243\377\233\327\243\377\233\327\243\377\234"
+ 327      A3FF9BD7 
+ 327      A3FF9BD7 
+ 327      A3FF9C
+ 328 1485 D7A3FF9C 		.ascii	"\327\243\377\234\327\243\377\235\327\243\377\235\330\243\377"
+ 328      D7A3FF9D 
+ 328      D7A3FF9D 
+ 328      D8A3FF
+ 329 1494 9ED8A3FF 		.ascii	"\236\330\243\377\236\330\243\377\237\330\243\377\240\330\243"
+ 329      9ED8A3FF 
+ 329      9FD8A3FF 
+ 329      A0D8A3
+ 330 14a3 FFA0D9A3 		.ascii	"\377\240\331\243\377\241\331\243\377\241\331\243\377\242\331"
+ 330      FFA1D9A3 
+ 330      FFA1D9A3 
+ 330      FFA2D9
+ 331 14b2 A3FFA2D9 		.ascii	"\243\377\242\331\243\377\243\332\243\377\243\332\243\377\244"
+ 331      A3FFA3DA 
+ 331      A3FFA3DA 
+ 331      A3FFA4
+ 332 14c1 DAA3FFA4 		.ascii	"\332\243\377\244\332\243\377\245\332\243\377\246\333\243\377"
+ 332      DAA3FFA5 
+ 332      DAA3FFA6 
+ 332      DBA3FF
+ 333 14d0 A6DBA3FF 		.ascii	"\246\333\243\377\247\333\243\377\247\333\243\377\250\333\243"
+ 333      A7DBA3FF 
+ 333      A7DBA3FF 
+ 333      A8DBA3
+ 334 14df FFA8DCA3 		.ascii	"\377\250\334\243\377\251\334\243\377\251\334\243\377\252\334"
+GAS LISTING /tmp/ccaf4gN6.s 			page 26
+
+
+ 334      FFA9DCA3 
+ 334      FFA9DCA3 
+ 334      FFAADC
+ 335 14ee A3FFAADC 		.ascii	"\243\377\252\334\243\377\253\335\243\377\253\335\243\377\254"
+ 335      A3FFABDD 
+ 335      A3FFABDD 
+ 335      A3FFAC
+ 336 14fd DDA3FFAC 		.ascii	"\335\243\377\254\335\243\377\254\336\243\377\255\336\243\377"
+ 336      DDA3FFAC 
+ 336      DEA3FFAD 
+ 336      DEA3FF
+ 337 150c ADDEA3FF 		.ascii	"\255\336\243\377\255\336\243\377\256\336\243\377\256\337\243"
+ 337      ADDEA3FF 
+ 337      AEDEA3FF 
+ 337      AEDFA3
+ 338 151b FFAFDFA3 		.ascii	"\377\257\337\243\377\257\337\243\377\257\337\242\377\260\337"
+ 338      FFAFDFA3 
+ 338      FFAFDFA2 
+ 338      FFB0DF
+ 339 152a A2FFB0E0 		.ascii	"\242\377\260\340\242\377\261\340\242\377\261\340\242\377\261"
+ 339      A2FFB1E0 
+ 339      A2FFB1E0 
+ 339      A2FFB1
+ 340 1539 E0A2FFB2 		.ascii	"\340\242\377\262\340\242\377\262\341\242\377\263\341\242\377"
+ 340      E0A2FFB2 
+ 340      E1A2FFB3 
+ 340      E1A2FF
+ 341 1548 B3E1A2FF 		.ascii	"\263\341\242\377\263\341\242\377\264\341\241\377\264\342\241"
+ 341      B3E1A2FF 
+ 341      B4E1A1FF 
+ 341      B4E2A1
+ 342 1557 FFB5E2A1 		.ascii	"\377\265\342\241\377\265\342\241\377\266\342\241\377\266\342"
+ 342      FFB5E2A1 
+ 342      FFB6E2A1 
+ 342      FFB6E2
+ 343 1566 A1FFB6E3 		.ascii	"\241\377\266\343\241\377\267\343\241\377\267\343\241\377\270"
+ 343      A1FFB7E3 
+ 343      A1FFB7E3 
+ 343      A1FFB8
+ 344 1575 E3A1FFB8 		.ascii	"\343\241\377\270\343\240\377\271\344\240\377\271\344\240\377"
+ 344      E3A0FFB9 
+ 344      E4A0FFB9 
+ 344      E4A0FF
+ 345 1584 B9E4A0FF 		.ascii	"\271\344\240\377\272\344\240\377\272\344\240\377\273\345\240"
+ 345      BAE4A0FF 
+ 345      BAE4A0FF 
+ 345      BBE5A0
+ 346 1593 FFBBE5A0 		.ascii	"\377\273\345\240\377\274\345\240\377\274\345\240\377\275\345"
+ 346      FFBCE5A0 
+ 346      FFBCE5A0 
+ 346      FFBDE5
+ 347 15a2 9FFFBDE6 		.ascii	"\237\377\275\346\237\377\275\346\237\377\276\346\237\377\276"
+ 347      9FFFBDE6 
+ 347      9FFFBEE6 
+ 347      9FFFBE
+ 348 15b1 E69FFFBF 		.ascii	"\346\237\377\277\346\237\377\277\347\237\377\300\347\237\377"
+ 348      E69FFFBF 
+GAS LISTING /tmp/ccaf4gN6.s 			page 27
+
+
+ 348      E79FFFC0 
+ 348      E79FFF
+ 349 15c0 CCEC9CFF 		.ascii	"\314\354\234\377\315\354\234\377\315\354\234\377\315\354\234"
+ 349      CDEC9CFF 
+ 349      CDEC9CFF 
+ 349      CDEC9C
+ 350 15cf FFCEEC9C 		.ascii	"\377\316\354\234\377\316\355\234\377\317\355\234\377\317\355"
+ 350      FFCEED9C 
+ 350      FFCFED9C 
+ 350      FFCFED
+ 351 15de 9CFFD0ED 		.ascii	"\234\377\320\355\234\377\320\355\233\377\321\356\233\377\321"
+ 351      9CFFD0ED 
+ 351      9BFFD1EE 
+ 351      9BFFD1
+ 352 15ed EE9BFFD2 		.ascii	"\356\233\377\322\356\233\377\322\356\233\377\323\356\233\377"
+ 352      EE9BFFD2 
+ 352      EE9BFFD3 
+ 352      EE9BFF
+ 353 15fc D3EE9BFF 		.ascii	"\323\356\233\377\324\357\233\377\324\357\233\377\325\357\233"
+ 353      D4EF9BFF 
+ 353      D4EF9BFF 
+ 353      D5EF9B
+ 354 160b FFD5EF9A 		.ascii	"\377\325\357\232\377\326\357\232\377\326\360\232\377\327\360"
+ 354      FFD6EF9A 
+ 354      FFD6F09A 
+ 354      FFD7F0
+ 355 161a 9AFFD7F0 		.ascii	"\232\377\327\360\232\377\330\360\232\377\330\360\232\377\331"
+ 355      9AFFD8F0 
+ 355      9AFFD8F0 
+ 355      9AFFD9
+ 356 1629 F09AFFD9 		.ascii	"\360\232\377\331\361\232\377\332\361\232\377\332\361\231\377"
+ 356      F19AFFDA 
+ 356      F19AFFDA 
+ 356      F199FF
+ 357 1638 DBF199FF 		.ascii	"\333\361\231\377\333\361\231\377\334\361\231\377\334\362\231"
+ 357      DBF199FF 
+ 357      DCF199FF 
+ 357      DCF299
+ 358 1647 FFDDF299 		.ascii	"\377\335\362\231\377\335\362\231\377\336\362\231\377\336\362"
+ 358      FFDDF299 
+ 358      FFDEF299 
+ 358      FFDEF2
+ 359 1656 99FFDFF2 		.ascii	"\231\377\337\362\231\377\337\363\231\377\340\363\230\377\340"
+ 359      99FFDFF3 
+ 359      99FFE0F3 
+ 359      98FFE0
+ 360 1665 F398FFE1 		.ascii	"\363\230\377\341\363\230\377\341\363\230\377\342\363\230\377"
+ 360      F398FFE1 
+ 360      F398FFE2 
+ 360      F398FF
+ 361 1674 E3F498FF 		.ascii	"\343\364\230\377\343\364\230\377\344\364\230\377\344\364\230"
+ 361      E3F498FF 
+ 361      E4F498FF 
+ 361      E4F498
+ 362 1683 FFE5F498 		.ascii	"\377\345\364\230\377\345\364\230\377\346\364\230\377\346\364"
+ 362      FFE5F498 
+ 362      FFE6F498 
+GAS LISTING /tmp/ccaf4gN6.s 			page 28
+
+
+ 362      FFE6F4
+ 363 1692 98FFE6F4 		.ascii	"\230\377\346\364\230\377\346\364\230\377\346\364\230\377\346"
+ 363      98FFE6F4 
+ 363      98FFE6F4 
+ 363      98FFE6
+ 364 16a1 F498FFE6 		.ascii	"\364\230\377\346\364\230\377\346\364\230\377\346\364\230\377"
+ 364      F498FFE6 
+ 364      F498FFE6 
+ 364      F498FF
+ 365 16b0 E6F499FF 		.ascii	"\346\364\231\377\347\364\231\377\347\364\231\377\347\364\231"
+ 365      E7F499FF 
+ 365      E7F499FF 
+ 365      E7F499
+ 366 16bf FFE7F499 		.ascii	"\377\347\364\231\377\347\364\231\377\347\364\231\377\347\364"
+ 366      FFE7F499 
+ 366      FFE7F499 
+ 366      FFE7F4
+ 367 16ce 99FFE7F4 		.ascii	"\231\377\347\364\231\377\347\364\232\377\347\364\232\377\347"
+ 367      99FFE7F4 
+ 367      9AFFE7F4 
+ 367      9AFFE7
+ 368 16dd F49AFFE8 		.ascii	"\364\232\377\350\364\232\377\350\364\232\377\350\364\232\377"
+ 368      F49AFFE8 
+ 368      F49AFFE8 
+ 368      F49AFF
+ 369 16ec E8F49AFF 		.ascii	"\350\364\232\377\350\364\232\377\350\364\232\377\350\364\233"
+ 369      E8F49AFF 
+ 369      E8F49AFF 
+ 369      E8F49B
+ 370 16fb FFE8F49B 		.ascii	"\377\350\364\233\377\350\364\233\377\350\364\233\377\351\364"
+ 370      FFE8F49B 
+ 370      FFE8F49B 
+ 370      FFE9F4
+ 371 170a 9BFFE9F4 		.ascii	"\233\377\351\364\233\377\351\364\233\377\351\364\233\377\351"
+ 371      9BFFE9F4 
+ 371      9BFFE9F4 
+ 371      9BFFE9
+ 372 1719 F49CFFE9 		.ascii	"\364\234\377\351\364\234\377\351\364\234\377\351\364\234\377"
+ 372      F49CFFE9 
+ 372      F49CFFE9 
+ 372      F49CFF
+ 373 1728 E9F49CFF 		.ascii	"\351\364\234\377\351\364\234\377\351\364\234\377\351\364\234"
+ 373      E9F49CFF 
+ 373      E9F49CFF 
+ 373      E9F49C
+ 374 1737 FFEAF49C 		.ascii	"\377\352\364\234\377\352\364\235\377\352\364\235\377\352\364"
+ 374      FFEAF49D 
+ 374      FFEAF49D 
+ 374      FFEAF4
+ 375 1746 9DFFEAF4 		.ascii	"\235\377\352\364\235\377\352\364\235\377\352\364\235\377\352"
+ 375      9DFFEAF4 
+ 375      9DFFEAF4 
+ 375      9DFFEA
+ 376 1755 F49DFFEC 		.ascii	"\364\235\377\354\363\240\377\355\363\240\377\355\363\241\377"
+ 376      F3A0FFED 
+ 376      F3A0FFED 
+ 376      F3A1FF
+GAS LISTING /tmp/ccaf4gN6.s 			page 29
+
+
+ 377 1764 EDF3A1FF 		.ascii	"\355\363\241\377\355\363\241\377\355\363\241\377\355\363\241"
+ 377      EDF3A1FF 
+ 377      EDF3A1FF 
+ 377      EDF3A1
+ 378 1773 FFEDF3A1 		.ascii	"\377\355\363\241\377\355\363\241\377\355\363\241\377\355\363"
+ 378      FFEDF3A1 
+ 378      FFEDF3A1 
+ 378      FFEDF3
+ 379 1782 A2FFEDF3 		.ascii	"\242\377\355\363\242\377\355\363\242\377\356\363\242\377\356"
+ 379      A2FFEDF3 
+ 379      A2FFEEF3 
+ 379      A2FFEE
+ 380 1791 F3A2FFEE 		.ascii	"\363\242\377\356\363\242\377\356\363\242\377\356\363\242\377"
+ 380      F3A2FFEE 
+ 380      F3A2FFEE 
+ 380      F3A2FF
+ 381 17a0 EEF3A3FF 		.ascii	"\356\363\243\377\356\363\243\377\356\363\243\377\356\363\243"
+ 381      EEF3A3FF 
+ 381      EEF3A3FF 
+ 381      EEF3A3
+ 382 17af FFEEF3A3 		.ascii	"\377\356\363\243\377\356\363\243\377\356\363\243\377\357\363"
+ 382      FFEEF3A3 
+ 382      FFEEF3A3 
+ 382      FFEFF3
+ 383 17be A3FFEFF3 		.ascii	"\243\377\357\363\243\377\357\363\244\377\357\363\244\377\357"
+ 383      A3FFEFF3 
+ 383      A4FFEFF3 
+ 383      A4FFEF
+ 384 17cd F3A4FFEF 		.ascii	"\363\244\377\357\363\244\377\357\363\244\377\357\363\244\377"
+ 384      F3A4FFEF 
+ 384      F3A4FFEF 
+ 384      F3A4FF
+ 385 17dc EFF3A4FF 		.ascii	"\357\363\244\377\357\363\244\377\357\363\245\377\357\363\245"
+ 385      EFF3A4FF 
+ 385      EFF3A5FF 
+ 385      EFF3A5
+ 386 17eb FFEFF3A5 		.ascii	"\377\357\363\245\377"
+ 386      FF
+ 387 17f0 F0F3A5FF 		.ascii	"\360\363\245\377\360\363\245\377\360\363\245\377\360\363\245"
+ 387      F0F3A5FF 
+ 387      F0F3A5FF 
+ 387      F0F3A5
+ 388 17ff FFF0F3A5 		.ascii	"\377\360\363\245\377\360\363\246\377\360\363\246\377\360\363"
+ 388      FFF0F3A6 
+ 388      FFF0F3A6 
+ 388      FFF0F3
+ 389 180e A6FFF0F3 		.ascii	"\246\377\360\363\246\377\360\363\246\377\360\363\246\377\360"
+ 389      A6FFF0F3 
+ 389      A6FFF0F3 
+ 389      A6FFF0
+ 390 181d F3A6FFF0 		.ascii	"\363\246\377\360\363\246\377\360\363\246\377\361\362\246\377"
+ 390      F3A6FFF0 
+ 390      F3A6FFF1 
+ 390      F2A6FF
+ 391 182c F1F2A6FF 		.ascii	"\361\362\246\377\361\362\246\377\361\362\246\377\361\362\245"
+ 391      F1F2A6FF 
+ 391      F1F2A6FF 
+GAS LISTING /tmp/ccaf4gN6.s 			page 30
+
+
+ 391      F1F2A5
+ 392 183b FFF1F2A5 		.ascii	"\377\361\362\245\377\361\362\245\377\361\361\245\377\361\361"
+ 392      FFF1F2A5 
+ 392      FFF1F1A5 
+ 392      FFF1F1
+ 393 184a A5FFF1F1 		.ascii	"\245\377\361\361\244\377\362\361\244\377\362\361\244\377\362"
+ 393      A4FFF2F1 
+ 393      A4FFF2F1 
+ 393      A4FFF2
+ 394 1859 F1A4FFF2 		.ascii	"\361\244\377\362\361\244\377\362\360\243\377\362\360\243\377"
+ 394      F1A4FFF2 
+ 394      F0A3FFF2 
+ 394      F0A3FF
+ 395 1868 F2F0A3FF 		.ascii	"\362\360\243\377\362\360\243\377\362\360\243\377\362\360\242"
+ 395      F2F0A3FF 
+ 395      F2F0A3FF 
+ 395      F2F0A2
+ 396 1877 FFF3F0A2 		.ascii	"\377\363\360\242\377\363\357\242\377\363\357\242\377\363\357"
+ 396      FFF3EFA2 
+ 396      FFF3EFA2 
+ 396      FFF3EF
+ 397 1886 A2FFF3EF 		.ascii	"\242\377\363\357\241\377\363\357\241\377\363\357\241\377\363"
+ 397      A1FFF3EF 
+ 397      A1FFF3EF 
+ 397      A1FFF3
+ 398 1895 EFA1FFF3 		.ascii	"\357\241\377\363\356\241\377\363\356\241\377\364\356\240\377"
+ 398      EEA1FFF3 
+ 398      EEA1FFF4 
+ 398      EEA0FF
+ 399 18a4 F4EEA0FF 		.ascii	"\364\356\240\377\364\356\240\377\364\356\240\377\364\356\240"
+ 399      F4EEA0FF 
+ 399      F4EEA0FF 
+ 399      F4EEA0
+ 400 18b3 FFF4ED9F 		.ascii	"\377\364\355\237\377\364\355\237\377\364\355\237\377\364\355"
+ 400      FFF4ED9F 
+ 400      FFF4ED9F 
+ 400      FFF4ED
+ 401 18c2 9FFFF4ED 		.ascii	"\237\377\364\355\237\377\365\355\236\377\365\354\236\377\365"
+ 401      9FFFF5ED 
+ 401      9EFFF5EC 
+ 401      9EFFF5
+ 402 18d1 EC9EFFF5 		.ascii	"\354\236\377\365\354\236\377\365\354\236\377\365\354\235\377"
+ 402      EC9EFFF5 
+ 402      EC9EFFF5 
+ 402      EC9DFF
+ 403 18e0 F5EC9DFF 		.ascii	"\365\354\235\377\365\354\235\377\365\353\235\377\365\353\235"
+ 403      F5EC9DFF 
+ 403      F5EB9DFF 
+ 403      F5EB9D
+ 404 18ef FFF6EB9D 		.ascii	"\377\366\353\235\377\370\347\230\377\370\347\230\377\370\347"
+ 404      FFF8E798 
+ 404      FFF8E798 
+ 404      FFF8E7
+ 405 18fe 97FFF9E7 		.ascii	"\227\377\371\347\227\377\371\347\227\377\371\346\227\377\371"
+ 405      97FFF9E7 
+ 405      97FFF9E6 
+ 405      97FFF9
+GAS LISTING /tmp/ccaf4gN6.s 			page 31
+
+
+ 406 190d E697FFF9 		.ascii	"\346\227\377\371\346\227\377\371\346\226\377\371\346\226\377"
+ 406      E697FFF9 
+ 406      E696FFF9 
+ 406      E696FF
+ 407 191c F9E696FF 		.ascii	"\371\346\226\377\371\346\226\377\371\345\226\377\372\345\226"
+ 407      F9E696FF 
+ 407      F9E596FF 
+ 407      FAE596
+ 408 192b FFFAE595 		.ascii	"\377\372\345\225\377\372\345\225\377\372\345\225\377\372\345"
+ 408      FFFAE595 
+ 408      FFFAE595 
+ 408      FFFAE5
+ 409 193a 95FFFAE5 		.ascii	"\225\377\372\345\225\377\372\344\224\377\372\344\224\377\372"
+ 409      95FFFAE4 
+ 409      94FFFAE4 
+ 409      94FFFA
+ 410 1949 E494FFFB 		.ascii	"\344\224\377\373\344\224\377\373\344\224\377\373\344\224\377"
+ 410      E494FFFB 
+ 410      E494FFFB 
+ 410      E494FF
+ 411 1958 FBE393FF 		.ascii	"\373\343\223\377\373\343\223\377\373\343\223\377\373\343\223"
+ 411      FBE393FF 
+ 411      FBE393FF 
+ 411      FBE393
+ 412 1967 FFFBE393 		.ascii	"\377\373\343\223\377\373\343\223\377\373\343\223\377\374\342"
+ 412      FFFBE393 
+ 412      FFFBE393 
+ 412      FFFCE2
+ 413 1976 92FFFCE2 		.ascii	"\222\377\374\342\222\377\374\342\222\377\374\342\222\377\374"
+ 413      92FFFCE2 
+ 413      92FFFCE2 
+ 413      92FFFC
+ 414 1985 E292FFFC 		.ascii	"\342\222\377\374\342\222\377\374\341\221\377\374\341\221\377"
+ 414      E292FFFC 
+ 414      E191FFFC 
+ 414      E191FF
+ 415 1994 FCE191FF 		.ascii	"\374\341\221\377\375\341\221\377\375\341\221\377\375\341\221"
+ 415      FDE191FF 
+ 415      FDE191FF 
+ 415      FDE191
+ 416 19a3 FFFDE190 		.ascii	"\377\375\341\220\377\375\340\220\377\375\340\220\377\375\340"
+ 416      FFFDE090 
+ 416      FFFDE090 
+ 416      FFFDE0
+ 417 19b2 90FFFDE0 		.ascii	"\220\377\375\340\220\377\375\340\220\377\375\340\220\377\375"
+ 417      90FFFDE0 
+ 417      90FFFDE0 
+ 417      90FFFD
+ 418 19c1 DF8FFFFD 		.ascii	"\337\217\377\375\337\217\377\375\337\216\377\375\336\216\377"
+ 418      DF8FFFFD 
+ 418      DF8EFFFD 
+ 418      DE8EFF
+ 419 19d0 FDDE8DFF 		.ascii	"\375\336\215\377\375\335\215\377\375\335\215\377\375\335\214"
+ 419      FDDD8DFF 
+ 419      FDDD8DFF 
+ 419      FDDD8C
+ 420 19df FFFDDC8C 		.ascii	"\377\375\334\214\377\375\334\213\377\375\334\213\377\375\333"
+GAS LISTING /tmp/ccaf4gN6.s 			page 32
+
+
+ 420      FFFDDC8B 
+ 420      FFFDDC8B 
+ 420      FFFDDB
+ 421 19ee 8AFFFDDB 		.ascii	"\212\377\375\333\212\377\375\332\212\377\375\332\211\377\375"
+ 421      8AFFFDDA 
+ 421      8AFFFDDA 
+ 421      89FFFD
+ 422 19fd DA89FFFD 		.ascii	"\332\211\377\375\331\210\377\375\331\210\377\375\331\207\377"
+ 422      D988FFFD 
+ 422      D988FFFD 
+ 422      D987FF
+ 423 1a0c FDD887FF 		.ascii	"\375\330\207\377\375\330\207\377\375\327\206\377\375\327\206"
+ 423      FDD887FF 
+ 423      FDD786FF 
+ 423      FDD786
+ 424 1a1b FFFDD785 		.ascii	"\377\375\327\205\377\375\326\205\377\375\326\205\377\375\326"
+ 424      FFFDD685 
+ 424      FFFDD685 
+ 424      FFFDD6
+ 425 1a2a 84FFFDD5 		.ascii	"\204\377\375\325\204\377\375\325\203\377\375\324\203\377\375"
+ 425      84FFFDD5 
+ 425      83FFFDD4 
+ 425      83FFFD
+ 426 1a39 D483FFFD 		.ascii	"\324\203\377\375\324\202\377\375\323\202\377\375\323\201\377"
+ 426      D482FFFD 
+ 426      D382FFFD 
+ 426      D381FF
+ 427 1a48 FDD381FF 		.ascii	"\375\323\201\377\375\322\201\377\375\322\200\377\375\321\200"
+ 427      FDD281FF 
+ 427      FDD280FF 
+ 427      FDD180
+ 428 1a57 FFFDD17F 		.ascii	"\377\375\321\177\377\375\321\177\377\375\320\177\377\375\320"
+ 428      FFFDD17F 
+ 428      FFFDD07F 
+ 428      FFFDD0
+ 429 1a66 7EFFFDCF 		.ascii	"~\377\375\317~\377\375\317}\377\375\317}\377\375\316}\377\375"
+ 429      7EFFFDCF 
+ 429      7DFFFDCF 
+ 429      7DFFFDCE 
+ 429      7DFFFD
+ 430 1a79 CE7CFFFD 		.ascii	"\316|\377\375\315|\377\375\315{\377\375\315{\377\375\314{\377"
+ 430      CD7CFFFD 
+ 430      CD7BFFFD 
+ 430      CD7BFFFD 
+ 430      CC7BFF
+ 431 1a8c FDC271FF 		.ascii	"\375\302q\377\375\302q\377\375\301p\377\375\301p\377\375\300"
+ 431      FDC271FF 
+ 431      FDC170FF 
+ 431      FDC170FF 
+ 431      FDC0
+ 432 1a9e 70FFFDC0 		.ascii	"p\377\375\300o\377\375\300o\377\375\277n\377\375\277n\377\375"
+ 432      6FFFFDC0 
+ 432      6FFFFDBF 
+ 432      6EFFFDBF 
+ 432      6EFFFD
+ 433 1ab1 BE6EFFFD 		.ascii	"\276n\377\375\276m\377\375\276m\377\375\275m\377\375\275l\377"
+ 433      BE6DFFFD 
+GAS LISTING /tmp/ccaf4gN6.s 			page 33
+
+
+ 433      BE6DFFFD 
+ 433      BD6DFFFD 
+ 433      BD6CFF
+ 434 1ac4 FDBC6CFF 		.ascii	"\375\274l\377\375\274l\377\375\274k\377\375\273k\377\375\273"
+ 434      FDBC6CFF 
+ 434      FDBC6BFF 
+ 434      FDBB6BFF 
+ 434      FDBB
+ 435 1ad6 6BFFFDBA 		.ascii	"k\377\375\272j\377\375\272j\377\375\272j\377\375\271i\377\375"
+ 435      6AFFFDBA 
+ 435      6AFFFDBA 
+ 435      6AFFFDB9 
+ 435      69FFFD
+ 436 1ae9 B969FFFD 		.ascii	"\271i\377\375\270i\377\375\270h\377\375\270h\377\375\267h\377"
+ 436      B869FFFD 
+ 436      B868FFFD 
+ 436      B868FFFD 
+ 436      B768FF
+ 437 1afc FDB767FF 		.ascii	"\375\267g\377\375\266g\377\375\266g\377\375\266f\377\375\265"
+ 437      FDB667FF 
+ 437      FDB667FF 
+ 437      FDB666FF 
+ 437      FDB5
+ 438 1b0e 66FFFDB5 		.ascii	"f\377\375\265f\377\375\264e\377\375\264e\377\375\264e\377\375"
+ 438      66FFFDB4 
+ 438      65FFFDB4 
+ 438      65FFFDB4 
+ 438      65FFFD
+ 439 1b21 B364FFFD 		.ascii	"\263d\377\375\263d\377\375\262d\377\375\262d\377\375\262c\377"
+ 439      B364FFFD 
+ 439      B264FFFD 
+ 439      B264FFFD 
+ 439      B263FF
+ 440 1b34 FDB163FF 		.ascii	"\375\261c\377\375\261c\377\375\260b\377\375\260b\377\375\257"
+ 440      FDB163FF 
+ 440      FDB062FF 
+ 440      FDB062FF 
+ 440      FDAF
+ 441 1b46 62FFFDAF 		.ascii	"b\377\375\257b\377\375\257a\377\375\256a\377\375\256a\377\374"
+ 441      62FFFDAF 
+ 441      61FFFDAE 
+ 441      61FFFDAE 
+ 441      61FFFC
+ 442 1b59 AD60FFFC 		.ascii	"\255`\377\374\255`\377\374\254`\377\374\254_\377\374\254_\377"
+ 442      AD60FFFC 
+ 442      AC60FFFC 
+ 442      AC5FFFFC 
+ 442      AC5FFF
+ 443 1b6c FCAB5FFF 		.ascii	"\374\253_\377\374\253^\377\374\252^\377\374\252^\377\374\251"
+ 443      FCAB5EFF 
+ 443      FCAA5EFF 
+ 443      FCAA5EFF 
+ 443      FCA9
+ 444 1b7e 5DFFFCA9 		.ascii	"]\377\374\251]\377\374\250]\377\374\250\\\377\374\247\\\377\374"
+ 444      5DFFFCA8 
+ 444      5DFFFCA8 
+ 444      5CFFFCA7 
+GAS LISTING /tmp/ccaf4gN6.s 			page 34
+
+
+ 444      5CFFFC
+ 445 1b91 A75CFFFC 		.ascii	"\247\\\377\374\246[\377\374\246[\377\374\245[\377\373\245Z\377"
+ 445      A65BFFFC 
+ 445      A65BFFFC 
+ 445      A55BFFFB 
+ 445      A55AFF
+ 446 1ba4 FBA45AFF 		.ascii	"\373\244Z\377\373\244Z\377\373\243Y\377\373\243Y\377\373\242"
+ 446      FBA45AFF 
+ 446      FBA359FF 
+ 446      FBA359FF 
+ 446      FBA2
+ 447 1bb6 59FFFBA2 		.ascii	"Y\377\373\242Y\377\373\242X\377\373\241X\377\373\241X\377\373"
+ 447      59FFFBA2 
+ 447      58FFFBA1 
+ 447      58FFFBA1 
+ 447      58FFFB
+ 448 1bc9 A057FFFB 		.ascii	"\240W\377\373\240W\377\373\237W\377\373\237W\377\373\236V\377"
+ 448      A057FFFB 
+ 448      9F57FFFB 
+ 448      9F57FFFB 
+ 448      9E56FF
+ 449 1bdc FB9E56FF 		.ascii	"\373\236V\377\373\235V\377\372\235U\377\372\234U\377\372\234"
+ 449      FB9D56FF 
+ 449      FA9D55FF 
+ 449      FA9C55FF 
+ 449      FA9C
+ 450 1bee 55FFFA9B 		.ascii	"U\377\372\233U\377\372\233T\377\372\232T\377\372\232T\377\372"
+ 450      55FFFA9B 
+ 450      54FFFA9A 
+ 450      54FFFA9A 
+ 450      54FFFA
+ 451 1c01 9954FFFA 		.ascii	"\231T\377\372\231S\377\372\230S\377\372\230S\377\372\227S\377"
+ 451      9953FFFA 
+ 451      9853FFFA 
+ 451      9853FFFA 
+ 451      9753FF
+ 452 1c14 FA9752FF 		.ascii	"\372\227R\377\372\226R\377\372\226R\377\371\225R\377\370\210"
+ 452      FA9652FF 
+ 452      FA9652FF 
+ 452      F99552FF 
+ 452      F888
+ 453 1c26 4BFFF887 		.ascii	"K\377\370\207K\377\367\207K\377\367\206K\377\367\206J\377\367"
+ 453      4BFFF787 
+ 453      4BFFF786 
+ 453      4BFFF786 
+ 453      4AFFF7
+ 454 1c39 854AFFF7 		.ascii	"\205J\377\367\205J\377\367\204J\377\367\204J\377\367\203I\377"
+ 454      854AFFF7 
+ 454      844AFFF7 
+ 454      844AFFF7 
+ 454      8349FF
+ 455 1c4c F78349FF 		.ascii	"\367\203I\377\367\202I\377\367\202I\377\367\201H\377\367\201"
+ 455      F78249FF 
+ 455      F78249FF 
+ 455      F78148FF 
+ 455      F781
+ 456 1c5e 48FFF780 		.ascii	"H\377\367\200H\377\366\200H\377\366\177H\377\366~G\377\366~G"
+GAS LISTING /tmp/ccaf4gN6.s 			page 35
+
+
+ 456      48FFF680 
+ 456      48FFF67F 
+ 456      48FFF67E 
+ 456      47FFF67E 
+ 457 1c73 FFF67D47 		.ascii	"\377\366}G\377\366}G\377\366|G\377\366|G\377\366{F\377\366{F"
+ 457      FFF67D47 
+ 457      FFF67C47 
+ 457      FFF67C47 
+ 457      FFF67B46 
+ 458 1c8b FFF67A46 		.ascii	"\377\366zF\377\366zF\377\366yF\377\365yF\377\365xE\377\365xE"
+ 458      FFF67A46 
+ 458      FFF67946 
+ 458      FFF57946 
+ 458      FFF57845 
+ 459 1ca3 FFF57745 		.ascii	"\377\365wE\377\365wE\377\365vE\377\365uE\377\365uD\377\365tD"
+ 459      FFF57745 
+ 459      FFF57645 
+ 459      FFF57545 
+ 459      FFF57544 
+ 460 1cbb FFF57444 		.ascii	"\377\365tD\377\365sD\377\365sD\377\364rD\377\364rD\377\364qC"
+ 460      FFF57344 
+ 460      FFF57344 
+ 460      FFF47244 
+ 460      FFF47244 
+ 461 1cd3 FFF47143 		.ascii	"\377\364qC\377\364pC\377\364oC\377\364oC\377\364nC\377\364nC"
+ 461      FFF47043 
+ 461      FFF46F43 
+ 461      FFF46F43 
+ 461      FFF46E43 
+ 462 1ceb FFF46D43 		.ascii	"\377\364mC\377\364mC\377\363lC\377\363lC\377\363kC\377\363kC"
+ 462      FFF46D43 
+ 462      FFF36C43 
+ 462      FFF36C43 
+ 462      FFF36B43 
+ 463 1d03 FFF36B43 		.ascii	"\377\363kC\377\362jC\377\362jC\377\362jC\377\362iC\377\362iC"
+ 463      FFF26A43 
+ 463      FFF26A43 
+ 463      FFF26A43 
+ 463      FFF26943 
+ 464 1d1b FFF16844 		.ascii	"\377\361hD\377\361hD\377\361hD\377\361gD\377\361gD\377\360fD"
+ 464      FFF16844 
+ 464      FFF16844 
+ 464      FFF16744 
+ 464      FFF16744 
+ 465 1d33 FFF06644 		.ascii	"\377\360fD\377\360fD\377\360eD\377\360eD\377\357eE\377\357dE"
+ 465      FFF06644 
+ 465      FFF06544 
+ 465      FFF06544 
+ 465      FFEF6545 
+ 466 1d4b FFEF6445 		.ascii	"\377\357dE\377\357cE\377\356cE\377\356cE\377\356bE\377\356bE"
+ 466      FFEF6345 
+ 466      FFEE6345 
+ 466      FFEE6345 
+ 466      FFEE6245 
+ 467 1d63 FFEE6245 		.ascii	"\377\356bE\377\355aE\377\355aF\377\355`F\377\355`F\377\354`F"
+ 467      FFED6145 
+ 467      FFED6146 
+GAS LISTING /tmp/ccaf4gN6.s 			page 36
+
+
+ 467      FFED6046 
+ 467      FFED6046 
+ 468 1d7b FFEC5F46 		.ascii	"\377\354_F\377\354_F\377\354_F\377\354^F\377\353^F\377\353^F"
+ 468      FFEC5F46 
+ 468      FFEC5F46 
+ 468      FFEC5E46 
+ 468      FFEB5E46 
+ 469 1d93 FFEB5D47 		.ascii	"\377\353]G\377\353]G\377\352\\G\377\352\\G\377\352\\G\377\352"
+ 469      FFEB5D47 
+ 469      FFEA5C47 
+ 469      FFEA5C47 
+ 469      FFEA5C47 
+ 470 1da9 5B47FFE9 		.ascii	"[G\377\351[G\377\351[G\377\351ZG\377\351ZG\377\351YH\377\342"
+ 470      5B47FFE9 
+ 470      5B47FFE9 
+ 470      5A47FFE9 
+ 470      5A47FFE9 
+ 471 1dc1 504AFFE2 		.ascii	"PJ\377\342OJ\377\342OJ\377\341OJ\377\341NJ\377\341NJ\377\341"
+ 471      4F4AFFE2 
+ 471      4F4AFFE1 
+ 471      4F4AFFE1 
+ 471      4E4AFFE1 
+ 472 1dd9 4D4BFFE0 		.ascii	"MK\377\340MK\377\340MK\377\340LK\377\340LK\377\337LK\377\337"
+ 472      4D4BFFE0 
+ 472      4D4BFFE0 
+ 472      4C4BFFE0 
+ 472      4C4BFFDF 
+ 473 1df1 4B4BFFDF 		.ascii	"KK\377\337KK\377\337KK\377\336JK\377\336JK\377\336IL\377\336"
+ 473      4B4BFFDF 
+ 473      4B4BFFDE 
+ 473      4A4BFFDE 
+ 473      4A4BFFDE 
+ 474 1e09 494CFFDD 		.ascii	"IL\377\335IL\377\335HL\377\335HL\377\334HL\377\334GL\377\334"
+ 474      494CFFDD 
+ 474      484CFFDD 
+ 474      484CFFDC 
+ 474      484CFFDC 
+ 475 1e21 474CFFDC 		.ascii	"GL\377\334GL\377\333FL\377\333FL\377\333FM\377\333EM\377\332"
+ 475      474CFFDB 
+ 475      464CFFDB 
+ 475      464CFFDB 
+ 475      464DFFDB 
+ 476 1e39 454DFFDA 		.ascii	"EM\377\332DM\377\332DM\377\331DM\377\331CM\377\331CM\377\331"
+ 476      444DFFDA 
+ 476      444DFFD9 
+ 476      444DFFD9 
+ 476      434DFFD9 
+ 477 1e51 434DFFD8 		.ascii	"CM\377\330BM\377\330BM\377\330BN\377\330AN\377\327AN\377\327"
+ 477      424DFFD8 
+ 477      424DFFD8 
+ 477      424EFFD8 
+ 477      414EFFD7 
+ 478 1e69 414EFFD7 		.ascii	"AN\377\327@N\377\326@N\377\326?N\377\326?N\377\326?N\377\325"
+ 478      404EFFD6 
+ 478      404EFFD6 
+ 478      3F4EFFD6 
+ 478      3F4EFFD6 
+GAS LISTING /tmp/ccaf4gN6.s 			page 37
+
+
+ 479 1e81 3E4EFFD5 		.ascii	">N\377\325>N\377\325>N\377\324=N\377\324=N\377\323=N\377\323"
+ 479      3E4EFFD5 
+ 479      3E4EFFD4 
+ 479      3D4EFFD4 
+ 479      3D4EFFD3 
+ 480 1e99 3C4EFFD3 		.ascii	"<N\377\323<N\377\322;N\377\322;N\377\321;N\377\321:N\377\321"
+ 480      3C4EFFD2 
+ 480      3B4EFFD2 
+ 480      3B4EFFD1 
+ 480      3B4EFFD1 
+ 481 1eb1 3A4EFFD0 		.ascii	":N\377\3209N\377\3209M\377\3179M\377\3178M\377\3168M\377\316"
+ 481      394EFFD0 
+ 481      394DFFCF 
+ 481      394DFFCF 
+ 481      384DFFCE 
+ 482 1ec9 384DFFCE 		.ascii	"8M\377\3167M\377\3157M\377\3156M\377\3146M\377\3146M\377\313"
+ 482      374DFFCD 
+ 482      374DFFCD 
+ 482      364DFFCC 
+ 482      364DFFCC 
+ 483 1ee1 354DFFCB 		.ascii	"5M\377\3135L\377\3134L\377\3124L\377\3124L\377\3113L\377\311"
+ 483      354CFFCB 
+ 483      344CFFCA 
+ 483      344CFFCA 
+ 483      344CFFC9 
+ 484 1ef9 334CFFC8 		.ascii	"3L\377\3102L\377\3102L\377\3102L\377\3071L\377\3071L\377\306"
+ 484      324CFFC8 
+ 484      324CFFC8 
+ 484      324CFFC7 
+ 484      314CFFC7 
+ 485 1f11 304BFFC6 		.ascii	"0K\377\3060K\377\3060K\377\305/K\377\305/K\377\304.K\377\304"
+ 485      304BFFC6 
+ 485      304BFFC5 
+ 485      2F4BFFC5 
+ 485      2F4BFFC4 
+ 486 1f29 2E4BFFC3 		.ascii	".K\377\303.K\377\303-K\377\303-K\377\302,J\377\302,J\377\301"
+ 486      2E4BFFC3 
+ 486      2D4BFFC3 
+ 486      2D4BFFC2 
+ 486      2C4AFFC2 
+ 487 1f41 2B4AFFC1 		.ascii	"+J\377\301+J\377\300+J\377\300*J\377\300*J\377\277)J\377\264"
+ 487      2B4AFFC0 
+ 487      2B4AFFC0 
+ 487      2A4AFFC0 
+ 487      2A4AFFBF 
+ 488 1f59 1D47FFB3 		.ascii	"\035G\377\263\034G\377\263\034G\377\262\033G\377\262\033G\377"
+ 488      1C47FFB3 
+ 488      1C47FFB2 
+ 488      1B47FFB2 
+ 488      1B47FF
+ 489 1f6c B11B47FF 		.ascii	"\261\033G\377\261\032F\377\261\032F\377\260\031F\377\260\031"
+ 489      B11A46FF 
+ 489      B11A46FF 
+ 489      B01946FF 
+ 489      B019
+ 490 1f7e 46FFAF18 		.ascii	"F\377\257\030F\377\257\030F\377\256\027F\377\256\027F\377\256"
+ 490      46FFAF18 
+GAS LISTING /tmp/ccaf4gN6.s 			page 38
+
+
+ 490      46FFAE17 
+ 490      46FFAE17 
+ 490      46FFAE
+ 491 1f91 1746FFAD 		.ascii	"\027F\377\255\026F\377\255\026E\377\254\025E\377\254\025E\377"
+ 491      1646FFAD 
+ 491      1645FFAC 
+ 491      1545FFAC 
+ 491      1545FF
+ 492 1fa4 AB1445FF 		.ascii	"\253\024E\377\253\024E\377\253\023E\377\252\023E\377\252\022"
+ 492      AB1445FF 
+ 492      AB1345FF 
+ 492      AA1345FF 
+ 492      AA12
+ 493 1fb6 45FFA912 		.ascii	"E\377\251\022E\377\251\021D\377"
+ 493      45FFA911 
+ 493      44FF
+ 494 1fc0 A81144FF 		.ascii	"\250\021D\377\250\020D\377\250\020D\377\247\017D\377\247\016"
+ 494      A81044FF 
+ 494      A81044FF 
+ 494      A70F44FF 
+ 494      A70E
+ 495 1fd2 44FFA60E 		.ascii	"D\377\246\016D\377\246\rD\377\245\rD\377\245\fC\377\244\fC\377"
+ 495      44FFA60D 
+ 495      44FFA50D 
+ 495      44FFA50C 
+ 495      43FFA40C 
+ 496 1fe8 A40B43FF 		.ascii	"\244\013C\377\244\nC\377\243\nC\377\243\tC\377\242\bC\377\242"
+ 496      A40A43FF 
+ 496      A30A43FF 
+ 496      A30943FF 
+ 496      A20843FF 
+ 497 1ffd 0743FFA1 		.ascii	"\007C\377\241\007C\377\241\006B\377\241\005B\377\240\005B\377"
+ 497      0743FFA1 
+ 497      0642FFA1 
+ 497      0542FFA0 
+ 497      0542FF
+ 498 2010 A00442FF 		.ascii	"\240\004B\377\237\003B\377\237\002B\377\236\002B\377\236\001"
+ 498      9F0342FF 
+ 498      9F0242FF 
+ 498      9E0242FF 
+ 498      9E01
+ 499 2022 42FF     		.ascii	"B\377"
+ 500              		.globl	heatmap_cs_Spectral_soft
+ 501              		.section	.data.rel.local
+ 502              		.align 8
+ 503              		.type	heatmap_cs_Spectral_soft, @object
+ 504              		.size	heatmap_cs_Spectral_soft, 8
+ 505              	heatmap_cs_Spectral_soft:
+ 506 0010 00000000 		.quad	soft
+ 506      00000000 
+ 507              		.section	.data.rel.ro.local
+ 508              		.align 16
+ 509              		.type	soft, @object
+ 510              		.size	soft, 16
+ 511              	soft:
+ 512 0020 00000000 		.quad	soft_data
+ 512      00000000 
+GAS LISTING /tmp/ccaf4gN6.s 			page 39
+
+
+ 513 0028 01040000 		.quad	1025
+ 513      00000000 
+ 514              		.section	.rodata
+ 515 2024 00000000 		.align 32
+ 515      00000000 
+ 515      00000000 
+ 515      00000000 
+ 515      00000000 
+ 516              		.type	soft_data, @object
+ 517              		.size	soft_data, 4100
+ 518              	soft_data:
+ 519 2040 00       		.string	""
+ 520 2041 00       		.string	""
+ 521 2042 00       		.string	""
+ 522 2043 00       		.string	""
+ 523 2044 5E4FA200 		.string	"^O\242"
+ 524 2048 5D4FA207 		.ascii	"]O\242\007\\P\243\016\\Q\243\026[Q\244\035[R\244%ZR\245,YS\245"
+ 524      5C50A30E 
+ 524      5C51A316 
+ 524      5B51A41D 
+ 524      5B52A425 
+ 525 2063 345954A6 		.ascii	"4YT\246;XT\246CXU\247JWV\247RVV\247YVW\250aUX\250hUX\251pTY\251"
+ 525      3B5854A6 
+ 525      435855A7 
+ 525      4A5756A7 
+ 525      525656A7 
+ 526 2087 775359AA 		.ascii	"wSY\252\177SZ\252\206R[\253\215R[\253\225Q\\\253\234P]\254\244"
+ 526      7F535AAA 
+ 526      86525BAB 
+ 526      8D525BAB 
+ 526      95515CAB 
+ 527 20a0 505DACAB 		.ascii	"P]\254\253O^\255\263O^\255\272N_\255\302M`\256\311M`\256\321"
+ 527      4F5EADB3 
+ 527      4F5EADBA 
+ 527      4E5FADC2 
+ 527      4D60AEC9 
+ 528 20b8 4C61AED8 		.ascii	"La\256\330La\257\340Kb\257\347Jc\260\357Jc\260\366Id\260\376"
+ 528      4C61AFE0 
+ 528      4B62AFE7 
+ 528      4A63B0EF 
+ 528      4A63B0F6 
+ 529 20d0 4864B1FF 		.ascii	"Hd\261\377He\261\377Ge\261\377Gf\262\377Fg\262\377Fg\262\377"
+ 529      4865B1FF 
+ 529      4765B1FF 
+ 529      4766B2FF 
+ 529      4667B2FF 
+ 530 20e8 4568B2FF 		.ascii	"Eh\262\377Dh\263\377Di\263\377Ci\263\377Cj\264\377Bk\264\377"
+ 530      4468B3FF 
+ 530      4469B3FF 
+ 530      4369B3FF 
+ 530      436AB4FF 
+ 531 2100 416BB4FF 		.ascii	"Ak\264\377Al\264\377@l\265\377@m\265\377?m\265\377?n\265\377"
+ 531      416CB4FF 
+ 531      406CB5FF 
+ 531      406DB5FF 
+ 531      3F6DB5FF 
+ 532 2118 3E6EB6FF 		.ascii	">n\266\377>o\266\377=p\266\377=p\266\377<q\267\377<q\267\377"
+GAS LISTING /tmp/ccaf4gN6.s 			page 40
+
+
+ 532      3E6FB6FF 
+ 532      3D70B6FF 
+ 532      3D70B6FF 
+ 532      3C71B7FF 
+ 533 2130 3B72B7FF 		.ascii	";r\267\377;r\267\377"
+ 533      3B72B7FF 
+ 534 2138 3A73B7FF 		.string	":s\267\377:s\270\3779t\270\3779t\270\3778u\270\3778u\270\3777v\271\3777v\271\3777w\271\37
+ 534      3A73B8FF 
+ 534      3974B8FF 
+ 534      3974B8FF 
+ 534      3875B8FF 
+ 535 2239 97BFFF00 		.string	"\227\277\377"
+ 536 223d 97BFFF00 		.string	"\227\277\377"
+ 537 2241 98BFFF00 		.string	"\230\277\377"
+ 538 2245 99BFFF00 		.string	"\231\277\377"
+ 539 2249 99BFFF00 		.string	"\231\277\377"
+ 540 224d 9ABFFF00 		.string	"\232\277\377"
+ 541 2251 9BBFFF00 		.string	"\233\277\377"
+ 542 2255 9BBFFF00 		.string	"\233\277\377"
+ 543 2259 9CBFFF00 		.string	"\234\277\377"
+ 544 225d 9CBFFF00 		.string	"\234\277\377"
+ 545 2261 9DBEFF00 		.string	"\235\276\377"
+ 546 2265 9EBEFF00 		.string	"\236\276\377"
+ 547 2269 9EBEFF00 		.string	"\236\276\377"
+ 548 226d 9FBEFF00 		.string	"\237\276\377"
+ 549 2271 9FBEFF00 		.string	"\237\276\377"
+ 550 2275 A0BEFF00 		.string	"\240\276\377"
+ 551 2279 A1BDFF00 		.string	"\241\275\377"
+ 552 227d A1BDFF00 		.string	"\241\275\377"
+ 553 2281 A2BDFF00 		.string	"\242\275\377"
+ 554 2285 A2BDFF00 		.string	"\242\275\377"
+ 555 2289 A3BDFF00 		.string	"\243\275\377"
+ 556 228d A4BCFF00 		.string	"\244\274\377"
+ 557 2291 A4BCFF00 		.string	"\244\274\377"
+ 558 2295 A5BCFF00 		.string	"\245\274\377"
+ 559 2299 A5BCFF00 		.string	"\245\274\377"
+ 560 229d A6BBFF00 		.string	"\246\273\377"
+ 561 22a1 A7BBFF00 		.string	"\247\273\377"
+ 562 22a5 A7BBFF00 		.string	"\247\273\377"
+ 563 22a9 A8BAFF00 		.string	"\250\272\377"
+ 564 22ad A8BAFF03 		.ascii	"\250\272\377\003\251\272\377\006\251\271\377\t\252\271\377\r"
+ 564      A9BAFF06 
+ 564      A9B9FF09 
+ 564      AAB9FF0D 
+ 565 22bd AAB9FF10 		.ascii	"\252\271\377\020\253\270\377\022\254\270\377\025\254\270\377"
+ 565      ABB8FF12 
+ 565      ACB8FF15 
+ 565      ACB8FF
+ 566 22cc 17ADB7FF 		.ascii	"\027\255\267\377\032\255\267\377\034\256\267\377\036\256\266"
+ 566      1AADB7FF 
+ 566      1CAEB7FF 
+ 566      1EAEB6
+ 567 22db FF21AFB6 		.ascii	"\377!\257\266\377#\257\265\377%\260\265\377'\260\265\377)\261"
+ 567      FF23AFB5 
+ 567      FF25B0B5 
+ 567      FF27B0B5 
+ 567      FF29B1
+GAS LISTING /tmp/ccaf4gN6.s 			page 41
+
+
+ 568 22ee B4FF2BB1 		.ascii	"\264\377+\261\264\377-\262\263\377/\263\263\3770\263\263\377"
+ 568      B4FF2DB2 
+ 568      B3FF2FB3 
+ 568      B3FF30B3 
+ 568      B3FF
+ 569 2300 32B4B2FF 		.ascii	"2\264\262\3774\264\262\3776\265\261\3778\265\261\377:\266\260"
+ 569      34B4B2FF 
+ 569      36B5B1FF 
+ 569      38B5B1FF 
+ 569      3AB6B0
+ 570 2313 FF3BB6B0 		.ascii	"\377;\266\260\377=\267\260\377?\267\257\377A\270\257\377C\270"
+ 570      FF3DB7B0 
+ 570      FF3FB7AF 
+ 570      FF41B8AF 
+ 570      FF43B8
+ 571 2326 AEFF44B9 		.ascii	"\256\377D\271\256\377F\271\255\377H\271\255\377I\272\254\377"
+ 571      AEFF46B9 
+ 571      ADFF48B9 
+ 571      ADFF49BA 
+ 571      ACFF
+ 572 2338 4BBAACFF 		.ascii	"K\272\254\377M\273\253\377O\273\253\377P\274\252\377R\274\252"
+ 572      4DBBABFF 
+ 572      4FBBABFF 
+ 572      50BCAAFF 
+ 572      52BCAA
+ 573 234b FF54BDAA 		.ascii	"\377T\275\252\377U\275\251\377W\276\251\377Y\276\250\377Z\277"
+ 573      FF55BDA9 
+ 573      FF57BEA9 
+ 573      FF59BEA8 
+ 573      FF5ABF
+ 574 235e A8FF5CBF 		.ascii	"\250\377\\\277\247\377^\277\247\377_\300\246\377a\300\246\377"
+ 574      A7FF5EBF 
+ 574      A7FF5FC0 
+ 574      A6FF61C0 
+ 574      A6FF
+ 575 2370 63C1A5FF 		.ascii	"c\301\245\377d\301\245\377f\302\244\377f\302\244\377g\302\244"
+ 575      64C1A5FF 
+ 575      66C2A4FF 
+ 575      66C2A4FF 
+ 575      67C2A4
+ 576 2383 FF68C2A4 		.ascii	"\377h\302\244\377h\303\244\377i\303\244\377j\303\244\377j\304"
+ 576      FF68C3A4 
+ 576      FF69C3A4 
+ 576      FF6AC3A4 
+ 576      FF6AC4
+ 577 2396 A4FF6BC4 		.ascii	"\244\377k\304\244\377l\304\244\377l\304\244\377m\305\244\377"
+ 577      A4FF6CC4 
+ 577      A4FF6CC4 
+ 577      A4FF6DC5 
+ 577      A4FF
+ 578 23a8 6EC5A4FF 		.ascii	"n\305\244\377n\305\244\377o\305\244\377p\306\244\377p\306\244"
+ 578      6EC5A4FF 
+ 578      6FC5A4FF 
+ 578      70C6A4FF 
+ 578      70C6A4
+ 579 23bb FF71C6A4 		.ascii	"\377q\306\244\377r\307\244\377r\307\244\377s\307\244\377t\307"
+ 579      FF72C7A4 
+GAS LISTING /tmp/ccaf4gN6.s 			page 42
+
+
+ 579      FF72C7A4 
+ 579      FF73C7A4 
+ 579      FF74C7
+ 580 23ce A4FF74C8 		.ascii	"\244\377t\310\244\377u\310\244\377v\310\244\377v\310\244\377"
+ 580      A4FF75C8 
+ 580      A4FF76C8 
+ 580      A4FF76C8 
+ 580      A4FF
+ 581 23e0 77C9A4FF 		.ascii	"w\311\244\377x\311\244\377x\311\244\377y\312\244\377z\312\244"
+ 581      78C9A4FF 
+ 581      78C9A4FF 
+ 581      79CAA4FF 
+ 581      7ACAA4
+ 582 23f3 FF7BCAA4 		.ascii	"\377{\312\244\377{\312\244\377|\313\244\377}\313\244\377}\313"
+ 582      FF7BCAA4 
+ 582      FF7CCBA4 
+ 582      FF7DCBA4 
+ 582      FF7DCB
+ 583 2406 A3FF7ECB 		.ascii	"\243\377~\313\243\377\177\314\243\377\177\314\243\377\200\314"
+ 583      A3FF7FCC 
+ 583      A3FF7FCC 
+ 583      A3FF80CC 
+ 584 2416 A3FF81CD 		.ascii	"\243\377\201\315\243\377\201\315\243\377\202\315\243\377\203"
+ 584      A3FF81CD 
+ 584      A3FF82CD 
+ 584      A3FF83
+ 585 2425 CDA3FF83 		.ascii	"\315\243\377\203\316\243\377\204\316\243\377\205\316\243\377"
+ 585      CEA3FF84 
+ 585      CEA3FF85 
+ 585      CEA3FF
+ 586 2434 85CEA3FF 		.ascii	"\205\316\243\377\206\317\243\377\207\317\243\377\207\317\243"
+ 586      86CFA3FF 
+ 586      87CFA3FF 
+ 586      87CFA3
+ 587 2443 FF88CFA3 		.ascii	"\377\210\317\243\377\211\320\243\377\211\320\243\377\212\320"
+ 587      FF89D0A3 
+ 587      FF89D0A3 
+ 587      FF8AD0
+ 588 2452 A3FF8BD1 		.ascii	"\243\377\213\321\243\377\213\321\243\377\214\321\243\377\215"
+ 588      A3FF8BD1 
+ 588      A3FF8CD1 
+ 588      A3FF8D
+ 589 2461 D1A3FF8D 		.ascii	"\321\243\377\215\322\243\377\216\322\243\377\217\322\243\377"
+ 589      D2A3FF8E 
+ 589      D2A3FF8F 
+ 589      D2A3FF
+ 590 2470 8FD2A3FF 		.ascii	"\217\322\243\377\220\323\243\377\221\323\243\377\221\323\243"
+ 590      90D3A3FF 
+ 590      91D3A3FF 
+ 590      91D3A3
+ 591 247f FF92D3A3 		.ascii	"\377\222\323\243\377\223\324\243\377\223\324\243\377\224\324"
+ 591      FF93D4A3 
+ 591      FF93D4A3 
+ 591      FF94D4
+ 592 248e A3FF95D4 		.ascii	"\243\377\225\324\243\377\225\325\243\377\226\325\243\377\227"
+ 592      A3FF95D5 
+ 592      A3FF96D5 
+GAS LISTING /tmp/ccaf4gN6.s 			page 43
+
+
+ 592      A3FF97
+ 593 249d D5A3FF97 		.ascii	"\325\243\377\227\325\243\377\230\326\243\377\231\326\243\377"
+ 593      D5A3FF98 
+ 593      D6A3FF99 
+ 593      D6A3FF
+ 594 24ac 99D6A3FF 		.ascii	"\231\326\243\377\232\326\243\377\233\327\243\377\233\327\243"
+ 594      9AD6A3FF 
+ 594      9BD7A3FF 
+ 594      9BD7A3
+ 595 24bb FF9CD7A3 		.ascii	"\377\234\327\243\377\235\327\243\377\235\330\243\377\236\330"
+ 595      FF9DD7A3 
+ 595      FF9DD8A3 
+ 595      FF9ED8
+ 596 24ca A3FF9FD8 		.ascii	"\243\377\237\330\243\377\240\330\243\377\240\331\243\377\241"
+ 596      A3FFA0D8 
+ 596      A3FFA0D9 
+ 596      A3FFA1
+ 597 24d9 D9A3FFA2 		.ascii	"\331\243\377\242\331\243\377\242\331\243\377\243\332\243\377"
+ 597      D9A3FFA2 
+ 597      D9A3FFA3 
+ 597      DAA3FF
+ 598 24e8 A4DAA3FF 		.ascii	"\244\332\243\377\244\332\243\377\245\332\243\377\246\333\243"
+ 598      A4DAA3FF 
+ 598      A5DAA3FF 
+ 598      A6DBA3
+ 599 24f7 FFA6DBA3 		.ascii	"\377\246\333\243\377\247\333\243\377\250\333\243\377\250\334"
+ 599      FFA7DBA3 
+ 599      FFA8DBA3 
+ 599      FFA8DC
+ 600 2506 A3FFA9DC 		.ascii	"\243\377\251\334\243\377\252\334\243\377\252\334\243\377\253"
+ 600      A3FFAADC 
+ 600      A3FFAADC 
+ 600      A3FFAB
+ 601 2515 DDA3FFAB 		.ascii	"\335\243\377\253\335\243\377\254\335\243\377\254\336\243\377"
+ 601      DDA3FFAC 
+ 601      DDA3FFAC 
+ 601      DEA3FF
+ 602 2524 ADDEA3FF 		.ascii	"\255\336\243\377\255\336\243\377\256\336\243\377\256\337\243"
+ 602      ADDEA3FF 
+ 602      AEDEA3FF 
+ 602      AEDFA3
+ 603 2533 FFAFDFA3 		.ascii	"\377\257\337\243\377\257\337\242\377\260\337\242\377\260\340"
+ 603      FFAFDFA2 
+ 603      FFB0DFA2 
+ 603      FFB0E0
+ 604 2542 A2FFB1E0 		.ascii	"\242\377\261\340\242\377\261\340\242\377\262\340\242\377\262"
+ 604      A2FFB1E0 
+ 604      A2FFB2E0 
+ 604      A2FFB2
+ 605 2551 E1A2FFB3 		.ascii	"\341\242\377\263\341\242\377\263\341\242\377\264\341\241\377"
+ 605      E1A2FFB3 
+ 605      E1A2FFB4 
+ 605      E1A1FF
+ 606 2560 B4E2A1FF 		.ascii	"\264\342\241\377\265\342\241\377\265\342\241\377\266\342\241"
+ 606      B5E2A1FF 
+ 606      B5E2A1FF 
+ 606      B6E2A1
+GAS LISTING /tmp/ccaf4gN6.s 			page 44
+
+
+ 607 256f FFB6E3A1 		.ascii	"\377\266\343\241\377\267\343\241\377\267\343\241\377\270\343"
+ 607      FFB7E3A1 
+ 607      FFB7E3A1 
+ 607      FFB8E3
+ 608 257e A1FFB8E4 		.ascii	"\241\377\270\344\240\377\271\344\240\377\271\344\240\377\272"
+ 608      A0FFB9E4 
+ 608      A0FFB9E4 
+ 608      A0FFBA
+ 609 258d E4A0FFBA 		.ascii	"\344\240\377\272\345\240\377\273\345\240\377\274\345\240\377"
+ 609      E5A0FFBB 
+ 609      E5A0FFBC 
+ 609      E5A0FF
+ 610 259c BCE5A0FF 		.ascii	"\274\345\240\377\275\346\237\377\275\346\237\377\276\346\237"
+ 610      BDE69FFF 
+ 610      BDE69FFF 
+ 610      BEE69F
+ 611 25ab FFBEE69F 		.ascii	"\377\276\346\237\377\277\347\237\377\277\347\237\377\300\347"
+ 611      FFBFE79F 
+ 611      FFBFE79F 
+ 611      FFC0E7
+ 612 25ba 9FFFC1E7 		.ascii	"\237\377\301\347\237\377\301\350\236\377\302\350\236\377\302"
+ 612      9FFFC1E8 
+ 612      9EFFC2E8 
+ 612      9EFFC2
+ 613 25c9 E89EFFC3 		.ascii	"\350\236\377\303\350\236\377\303\351\236\377\304\351\236\377"
+ 613      E89EFFC3 
+ 613      E99EFFC4 
+ 613      E99EFF
+ 614 25d8 C5E99EFF 		.ascii	"\305\351\236\377\305\351\236\377\306\351\236\377\306\352\235"
+ 614      C5E99EFF 
+ 614      C6E99EFF 
+ 614      C6EA9D
+ 615 25e7 FFC7EA9D 		.ascii	"\377\307\352\235\377\307\352\235\377\310\352\235\377\311\353"
+ 615      FFC7EA9D 
+ 615      FFC8EA9D 
+ 615      FFC9EB
+ 616 25f6 9DFFC9EB 		.ascii	"\235\377\311\353\235\377\312\353\235\377\312\353\235\377\313"
+ 616      9DFFCAEB 
+ 616      9DFFCAEB 
+ 616      9DFFCB
+ 617 2605 EC9CFFCC 		.ascii	"\354\234\377\314\354\234\377\314\354\234\377\315\354\234\377"
+ 617      EC9CFFCC 
+ 617      EC9CFFCD 
+ 617      EC9CFF
+ 618 2614 CDEC9CFF 		.ascii	"\315\354\234\377\316\355\234\377\317\355\234\377\317\355\234"
+ 618      CEED9CFF 
+ 618      CFED9CFF 
+ 618      CFED9C
+ 619 2623 FFD0ED9B 		.ascii	"\377\320\355\233\377\320\356\233\377\321\356\233\377\322\356"
+ 619      FFD0EE9B 
+ 619      FFD1EE9B 
+ 619      FFD2EE
+ 620 2632 9BFFD2EE 		.ascii	"\233\377\322\356\233\377\323\356\233\377\324\357\233\377\324"
+ 620      9BFFD3EE 
+ 620      9BFFD4EF 
+ 620      9BFFD4
+ 621 2641 EF9BFFD5 		.ascii	"\357\233\377\325\357\232\377\325\357\232\377\326\360\232\377"
+GAS LISTING /tmp/ccaf4gN6.s 			page 45
+
+
+ 621      EF9AFFD5 
+ 621      EF9AFFD6 
+ 621      F09AFF
+ 622 2650 D7F09AFF 		.ascii	"\327\360\232\377\327\360\232\377\330\360\232\377\331\360\232"
+ 622      D7F09AFF 
+ 622      D8F09AFF 
+ 622      D9F09A
+ 623 265f FFD9F19A 		.ascii	"\377\331\361\232\377\332\361\231\377\333\361\231\377\333\361"
+ 623      FFDAF199 
+ 623      FFDBF199 
+ 623      FFDBF1
+ 624 266e 99FFDCF2 		.ascii	"\231\377\334\362\231\377\334\362\231\377\335\362\231\377\336"
+ 624      99FFDCF2 
+ 624      99FFDDF2 
+ 624      99FFDE
+ 625 267d F299FFDE 		.ascii	"\362\231\377\336\362\231\377\337\363\231\377\340\363\230\377"
+ 625      F299FFDF 
+ 625      F399FFE0 
+ 625      F398FF
+ 626 268c E0F398FF 		.ascii	"\340\363\230\377\341\363\230\377\342\363\230\377\342\364\230"
+ 626      E1F398FF 
+ 626      E2F398FF 
+ 626      E2F498
+ 627 269b FFE3F498 		.ascii	"\377\343\364\230\377\344\364\230\377\344\364\230\377\345\364"
+ 627      FFE4F498 
+ 627      FFE4F498 
+ 627      FFE5F4
+ 628 26aa 98FFE6F4 		.ascii	"\230\377\346\364\230\377\346\364\230\377\346\364\230\377\346"
+ 628      98FFE6F4 
+ 628      98FFE6F4 
+ 628      98FFE6
+ 629 26b9 F498FFE6 		.ascii	"\364\230\377\346\364\230\377\346\364\230\377\346\364\230\377"
+ 629      F498FFE6 
+ 629      F498FFE6 
+ 629      F498FF
+ 630 26c8 E6F499FF 		.ascii	"\346\364\231\377\347\364\231\377\347\364\231\377\347\364\231"
+ 630      E7F499FF 
+ 630      E7F499FF 
+ 630      E7F499
+ 631 26d7 FFE7F499 		.ascii	"\377\347\364\231\377\347\364\231\377\347\364\231\377\347\364"
+ 631      FFE7F499 
+ 631      FFE7F499 
+ 631      FFE7F4
+ 632 26e6 9AFFE7F4 		.ascii	"\232\377\347\364\232\377\350\364\232\377\350\364\232\377\350"
+ 632      9AFFE8F4 
+ 632      9AFFE8F4 
+ 632      9AFFE8
+ 633 26f5 F49AFFE8 		.ascii	"\364\232\377\350\364\232\377\350\364\232\377\350\364\233\377"
+ 633      F49AFFE8 
+ 633      F49AFFE8 
+ 633      F49BFF
+ 634 2704 E8F49BFF 		.ascii	"\350\364\233\377\350\364\233\377\350\364\233\377\351\364\233"
+ 634      E8F49BFF 
+ 634      E8F49BFF 
+ 634      E9F49B
+ 635 2713 FFE9F49B 		.ascii	"\377\351\364\233\377\351\364\233\377\351\364\234\377\351\364"
+ 635      FFE9F49B 
+GAS LISTING /tmp/ccaf4gN6.s 			page 46
+
+
+ 635      FFE9F49C 
+ 635      FFE9F4
+ 636 2722 9CFFE9F4 		.ascii	"\234\377\351\364\234\377\351\364\234\377\351\364\234\377\351"
+ 636      9CFFE9F4 
+ 636      9CFFE9F4 
+ 636      9CFFE9
+ 637 2731 F49CFFEA 		.ascii	"\364\234\377\352\364\234\377\352\364\235\377\352\364\235\377"
+ 637      F49CFFEA 
+ 637      F49DFFEA 
+ 637      F49DFF
+ 638 2740 EAF49DFF 		.ascii	"\352\364\235\377\352\364\235\377\352\364\235\377\352\364\235"
+ 638      EAF49DFF 
+ 638      EAF49DFF 
+ 638      EAF49D
+ 639 274f FFEAF49D 		.ascii	"\377\352\364\235\377\352\364\236\377\353\364\236\377\353\364"
+ 639      FFEAF49E 
+ 639      FFEBF49E 
+ 639      FFEBF4
+ 640 275e 9EFFEBF4 		.ascii	"\236\377\353\364\236\377\353\364\236\377\353\363\236\377\353"
+ 640      9EFFEBF4 
+ 640      9EFFEBF3 
+ 640      9EFFEB
+ 641 276d F39EFFEB 		.ascii	"\363\236\377\353\363\237\377\353\363\237\377\353\363\237\377"
+ 641      F39FFFEB 
+ 641      F39FFFEB 
+ 641      F39FFF
+ 642 277c ECF39FFF 		.ascii	"\354\363\237\377\354\363\237\377\354\363\237\377\354\363\237"
+ 642      ECF39FFF 
+ 642      ECF39FFF 
+ 642      ECF39F
+ 643 278b FFECF3A0 		.ascii	"\377\354\363\240\377\354\363\240\377\354\363\240\377\354\363"
+ 643      FFECF3A0 
+ 643      FFECF3A0 
+ 643      FFECF3
+ 644 279a A0FFECF3 		.ascii	"\240\377\354\363\240\377\355\363\240\377\355\363\240\377\355"
+ 644      A0FFEDF3 
+ 644      A0FFEDF3 
+ 644      A0FFED
+ 645 27a9 F3A1FFED 		.ascii	"\363\241\377\355\363\241\377\355\363\241\377\355\363\241\377"
+ 645      F3A1FFED 
+ 645      F3A1FFED 
+ 645      F3A1FF
+ 646 27b8 EDF3A1FF 		.ascii	"\355\363\241\377\355\363\241\377\355\363\242\377\355\363\242"
+ 646      EDF3A1FF 
+ 646      EDF3A2FF 
+ 646      EDF3A2
+ 647 27c7 FFEEF3A2 		.ascii	"\377\356\363\242\377\356\363\242\377\356\363\242\377\356\363"
+ 647      FFEEF3A2 
+ 647      FFEEF3A2 
+ 647      FFEEF3
+ 648 27d6 A2FFEEF3 		.ascii	"\242\377\356\363\242\377\356\363\243\377\356\363\243\377\356"
+ 648      A2FFEEF3 
+ 648      A3FFEEF3 
+ 648      A3FFEE
+ 649 27e5 F3A3FFEE 		.ascii	"\363\243\377\356\363\243\377\356\363\243\377\357\363\243\377"
+ 649      F3A3FFEE 
+ 649      F3A3FFEF 
+GAS LISTING /tmp/ccaf4gN6.s 			page 47
+
+
+ 649      F3A3FF
+ 650 27f4 EFF3A3FF 		.ascii	"\357\363\243\377\357\363\244\377\357\363\244\377\357\363\244"
+ 650      EFF3A4FF 
+ 650      EFF3A4FF 
+ 650      EFF3A4
+ 651 2803 FFEFF3A4 		.ascii	"\377\357\363\244\377\357\363\244\377\357\363\244\377"
+ 651      FFEFF3A4 
+ 651      FFEFF3A4 
+ 651      FF
+ 652 2810 EFF3A5FF 		.ascii	"\357\363\245\377\357\363\245\377\357\363\245\377\360\363\245"
+ 652      EFF3A5FF 
+ 652      EFF3A5FF 
+ 652      F0F3A5
+ 653 281f FFF0F3A5 		.ascii	"\377\360\363\245\377\360\363\245\377\360\363\245\377\360\363"
+ 653      FFF0F3A5 
+ 653      FFF0F3A5 
+ 653      FFF0F3
+ 654 282e A6FFF0F3 		.ascii	"\246\377\360\363\246\377\360\363\246\377\360\363\246\377\360"
+ 654      A6FFF0F3 
+ 654      A6FFF0F3 
+ 654      A6FFF0
+ 655 283d F3A6FFF0 		.ascii	"\363\246\377\360\363\246\377\360\363\246\377\361\362\246\377"
+ 655      F3A6FFF0 
+ 655      F3A6FFF1 
+ 655      F2A6FF
+ 656 284c F1F2A6FF 		.ascii	"\361\362\246\377\361\362\246\377\361\362\245\377\361\362\245"
+ 656      F1F2A6FF 
+ 656      F1F2A5FF 
+ 656      F1F2A5
+ 657 285b FFF1F1A5 		.ascii	"\377\361\361\245\377\361\361\245\377\361\361\244\377\362\361"
+ 657      FFF1F1A5 
+ 657      FFF1F1A4 
+ 657      FFF2F1
+ 658 286a A4FFF2F1 		.ascii	"\244\377\362\361\244\377\362\361\244\377\362\360\243\377\362"
+ 658      A4FFF2F1 
+ 658      A4FFF2F0 
+ 658      A3FFF2
+ 659 2879 F0A3FFF2 		.ascii	"\360\243\377\362\360\243\377\362\360\243\377\362\360\242\377"
+ 659      F0A3FFF2 
+ 659      F0A3FFF2 
+ 659      F0A2FF
+ 660 2888 F3EFA2FF 		.ascii	"\363\357\242\377\363\357\242\377\363\357\242\377\363\357\241"
+ 660      F3EFA2FF 
+ 660      F3EFA2FF 
+ 660      F3EFA1
+ 661 2897 FFF3EFA1 		.ascii	"\377\363\357\241\377\363\357\241\377\363\356\241\377\363\356"
+ 661      FFF3EFA1 
+ 661      FFF3EEA1 
+ 661      FFF3EE
+ 662 28a6 A0FFF4EE 		.ascii	"\240\377\364\356\240\377\364\356\240\377\364\356\240\377\364"
+ 662      A0FFF4EE 
+ 662      A0FFF4EE 
+ 662      A0FFF4
+ 663 28b5 EE9FFFF4 		.ascii	"\356\237\377\364\355\237\377\364\355\237\377\364\355\237\377"
+ 663      ED9FFFF4 
+ 663      ED9FFFF4 
+ 663      ED9FFF
+GAS LISTING /tmp/ccaf4gN6.s 			page 48
+
+
+ 664 28c4 F4ED9FFF 		.ascii	"\364\355\237\377\365\355\236\377\365\354\236\377\365\354\236"
+ 664      F5ED9EFF 
+ 664      F5EC9EFF 
+ 664      F5EC9E
+ 665 28d3 FFF5EC9E 		.ascii	"\377\365\354\236\377\365\354\235\377\365\354\235\377\365\354"
+ 665      FFF5EC9D 
+ 665      FFF5EC9D 
+ 665      FFF5EC
+ 666 28e2 9DFFF5EB 		.ascii	"\235\377\365\353\235\377\366\353\234\377\366\353\234\377\366"
+ 666      9DFFF6EB 
+ 666      9CFFF6EB 
+ 666      9CFFF6
+ 667 28f1 EB9CFFF6 		.ascii	"\353\234\377\366\353\234\377\366\352\233\377\366\352\233\377"
+ 667      EB9CFFF6 
+ 667      EA9BFFF6 
+ 667      EA9BFF
+ 668 2900 F6EA9BFF 		.ascii	"\366\352\233\377\366\352\233\377\367\352\233\377\367\351\232"
+ 668      F6EA9BFF 
+ 668      F7EA9BFF 
+ 668      F7E99A
+ 669 290f FFF7E99A 		.ascii	"\377\367\351\232\377\367\351\232\377\367\351\232\377\367\351"
+ 669      FFF7E99A 
+ 669      FFF7E99A 
+ 669      FFF7E9
+ 670 291e 99FFF7E9 		.ascii	"\231\377\367\351\231\377\367\350\231\377\370\350\231\377\370"
+ 670      99FFF7E8 
+ 670      99FFF8E8 
+ 670      99FFF8
+ 671 292d E899FFF8 		.ascii	"\350\231\377\370\350\230\377\370\350\230\377\370\347\230\377"
+ 671      E898FFF8 
+ 671      E898FFF8 
+ 671      E798FF
+ 672 293c F8E798FF 		.ascii	"\370\347\230\377\370\347\227\377\370\347\227\377\371\347\227"
+ 672      F8E797FF 
+ 672      F8E797FF 
+ 672      F9E797
+ 673 294b FFF9E797 		.ascii	"\377\371\347\227\377\371\346\227\377\371\346\226\377\371\346"
+ 673      FFF9E697 
+ 673      FFF9E696 
+ 673      FFF9E6
+ 674 295a 96FFF9E6 		.ascii	"\226\377\371\346\226\377\371\346\226\377\372\345\226\377\372"
+ 674      96FFF9E6 
+ 674      96FFFAE5 
+ 674      96FFFA
+ 675 2969 E595FFFA 		.ascii	"\345\225\377\372\345\225\377\372\345\225\377\372\345\225\377"
+ 675      E595FFFA 
+ 675      E595FFFA 
+ 675      E595FF
+ 676 2978 FAE494FF 		.ascii	"\372\344\224\377\372\344\224\377\372\344\224\377\373\344\224"
+ 676      FAE494FF 
+ 676      FAE494FF 
+ 676      FBE494
+ 677 2987 FFFBE494 		.ascii	"\377\373\344\224\377\373\343\223\377\373\343\223\377\373\343"
+ 677      FFFBE393 
+ 677      FFFBE393 
+ 677      FFFBE3
+ 678 2996 93FFFBE3 		.ascii	"\223\377\373\343\223\377\373\343\223\377\373\342\222\377\374"
+GAS LISTING /tmp/ccaf4gN6.s 			page 49
+
+
+ 678      93FFFBE3 
+ 678      93FFFBE2 
+ 678      92FFFC
+ 679 29a5 E292FFFC 		.ascii	"\342\222\377\374\342\222\377\374\342\222\377\374\342\222\377"
+ 679      E292FFFC 
+ 679      E292FFFC 
+ 679      E292FF
+ 680 29b4 FCE291FF 		.ascii	"\374\342\221\377\374\341\221\377\374\341\221\377\375\341\221"
+ 680      FCE191FF 
+ 680      FCE191FF 
+ 680      FDE191
+ 681 29c3 FFFDE191 		.ascii	"\377\375\341\221\377\375\341\221\377\375\340\220\377\375\340"
+ 681      FFFDE191 
+ 681      FFFDE090 
+ 681      FFFDE0
+ 682 29d2 90FFFDE0 		.ascii	"\220\377\375\340\220\377\375\340\220\377\375\340\220\377\375"
+ 682      90FFFDE0 
+ 682      90FFFDE0 
+ 682      90FFFD
+ 683 29e1 DF8FFFFD 		.ascii	"\337\217\377\375\337\217\377\375\336\216\377\375\336\216\377"
+ 683      DF8FFFFD 
+ 683      DE8EFFFD 
+ 683      DE8EFF
+ 684 29f0 FDDD8DFF 		.ascii	"\375\335\215\377\375\335\214\377\375\334\214\377\375\334\213"
+ 684      FDDD8CFF 
+ 684      FDDC8CFF 
+ 684      FDDC8B
+ 685 29ff FFFDDC8B 		.ascii	"\377\375\334\213\377\375\333\212\377\375\333\212\377\375\332"
+ 685      FFFDDB8A 
+ 685      FFFDDB8A 
+ 685      FFFDDA
+ 686 2a0e 89FFFDDA 		.ascii	"\211\377\375\332\211\377\375\331\210\377\375\331\210\377\375"
+ 686      89FFFDD9 
+ 686      88FFFDD9 
+ 686      88FFFD
+ 687 2a1d D887FFFD 		.ascii	"\330\207\377\375\330\206\377\375\327\206\377\375\327\205\377"
+ 687      D886FFFD 
+ 687      D786FFFD 
+ 687      D785FF
+ 688 2a2c FDD685FF 		.ascii	"\375\326\205\377\375\326\204\377\375\325\204\377\375\325\203"
+ 688      FDD684FF 
+ 688      FDD584FF 
+ 688      FDD583
+ 689 2a3b FFFDD483 		.ascii	"\377\375\324\203\377\375\324\202\377\375\324\202\377\375\323"
+ 689      FFFDD482 
+ 689      FFFDD482 
+ 689      FFFDD3
+ 690 2a4a 81FFFDD3 		.ascii	"\201\377\375\323\201\377\375\322\200\377\375\322\200\377\375"
+ 690      81FFFDD2 
+ 690      80FFFDD2 
+ 690      80FFFD
+ 691 2a59 D17FFFFD 		.ascii	"\321\177\377\375\321\177\377\375\320~\377\375\320~\377\375\317"
+ 691      D17FFFFD 
+ 691      D07EFFFD 
+ 691      D07EFFFD 
+ 691      CF
+ 692 2a6a 7DFFFDCF 		.ascii	"}\377\375\317}\377\375\316|\377\375\316|\377\375\315{\377\375"
+GAS LISTING /tmp/ccaf4gN6.s 			page 50
+
+
+ 692      7DFFFDCE 
+ 692      7CFFFDCE 
+ 692      7CFFFDCD 
+ 692      7BFFFD
+ 693 2a7d CD7BFFFD 		.ascii	"\315{\377\375\314z\377\375\314z\377\375\313y\377\375\313y\377"
+ 693      CC7AFFFD 
+ 693      CC7AFFFD 
+ 693      CB79FFFD 
+ 693      CB79FF
+ 694 2a90 FDCA78FF 		.ascii	"\375\312x\377\375\312x\377\375\311w\377\375\311w\377\375\310"
+ 694      FDCA78FF 
+ 694      FDC977FF 
+ 694      FDC977FF 
+ 694      FDC8
+ 695 2aa2 76FFFDC8 		.ascii	"v\377\375\310v\377\375\310v\377\375\307u\377\375\307u\377\375"
+ 695      76FFFDC8 
+ 695      76FFFDC7 
+ 695      75FFFDC7 
+ 695      75FFFD
+ 696 2ab5 C674FFFD 		.ascii	"\306t\377\375\306t\377\375\305s\377\375\305s\377\375\304r\377"
+ 696      C674FFFD 
+ 696      C573FFFD 
+ 696      C573FFFD 
+ 696      C472FF
+ 697 2ac8 FDC472FF 		.ascii	"\375\304r\377\375\303q\377\375\303q\377\375\302q\377\375\302"
+ 697      FDC371FF 
+ 697      FDC371FF 
+ 697      FDC271FF 
+ 697      FDC2
+ 698 2ada 70FFFDC1 		.ascii	"p\377\375\301p\377\375\301o\377\375\300o\377\375\300n\377\375"
+ 698      70FFFDC1 
+ 698      6FFFFDC0 
+ 698      6FFFFDC0 
+ 698      6EFFFD
+ 699 2aed BF6EFFFD 		.ascii	"\277n\377\375\277n\377\375\276m\377\375\276m\377\375\275l\377"
+ 699      BF6EFFFD 
+ 699      BE6DFFFD 
+ 699      BE6DFFFD 
+ 699      BD6CFF
+ 700 2b00 FDBD6CFF 		.ascii	"\375\275l\377\375\274k\377\375\274k\377\375\273k\377\375\273"
+ 700      FDBC6BFF 
+ 700      FDBC6BFF 
+ 700      FDBB6BFF 
+ 700      FDBB
+ 701 2b12 6AFFFDBA 		.ascii	"j\377\375\272j\377\375\272i\377\375\271i\377\375\271i\377\375"
+ 701      6AFFFDBA 
+ 701      69FFFDB9 
+ 701      69FFFDB9 
+ 701      69FFFD
+ 702 2b25 B868FFFD 		.ascii	"\270h\377\375\270h\377\375\267g\377\375\267g\377\375\266g\377"
+ 702      B868FFFD 
+ 702      B767FFFD 
+ 702      B767FFFD 
+ 702      B667FF
+ 703 2b38 FDB666FF 		.ascii	"\375\266f\377\375\265f\377\375\265e\377\375\264e\377\375\264"
+ 703      FDB566FF 
+ 703      FDB565FF 
+GAS LISTING /tmp/ccaf4gN6.s 			page 51
+
+
+ 703      FDB465FF 
+ 703      FDB4
+ 704 2b4a 65FFFDB3 		.ascii	"e\377\375\263d\377\375\263d\377\375\262d\377\375\262c\377\375"
+ 704      64FFFDB3 
+ 704      64FFFDB2 
+ 704      64FFFDB2 
+ 704      63FFFD
+ 705 2b5d B163FFFD 		.ascii	"\261c\377\375\260c\377\375\260b\377\375\257b\377\375\257a\377"
+ 705      B063FFFD 
+ 705      B062FFFD 
+ 705      AF62FFFD 
+ 705      AF61FF
+ 706 2b70 FDAE61FF 		.ascii	"\375\256a\377\375\256a\377\374\255`\377\374\255`\377\374\254"
+ 706      FDAE61FF 
+ 706      FCAD60FF 
+ 706      FCAD60FF 
+ 706      FCAC
+ 707 2b82 60FFFCAC 		.ascii	"`\377\374\254_\377\374\253_\377\374\252^\377\374\252^\377\374"
+ 707      5FFFFCAB 
+ 707      5FFFFCAA 
+ 707      5EFFFCAA 
+ 707      5EFFFC
+ 708 2b95 A95DFFFC 		.ascii	"\251]\377\374\251]\377\374\250]\377\374\247\\\377\374\247\\\377"
+ 708      A95DFFFC 
+ 708      A85DFFFC 
+ 708      A75CFFFC 
+ 708      A75CFF
+ 709 2ba8 FCA65BFF 		.ascii	"\374\246[\377\374\246[\377\373\245Z\377\373\245Z\377\373\244"
+ 709      FCA65BFF 
+ 709      FBA55AFF 
+ 709      FBA55AFF 
+ 709      FBA4
+ 710 2bba 5AFFFBA3 		.ascii	"Z\377\373\243Y\377\373\243Y\377\373\242Y\377\373\242X\377\373"
+ 710      59FFFBA3 
+ 710      59FFFBA2 
+ 710      59FFFBA2 
+ 710      58FFFB
+ 711 2bcd A158FFFB 		.ascii	"\241X\377\373\240W\377\373\240W\377\373\237W\377\373\237V\377"
+ 711      A057FFFB 
+ 711      A057FFFB 
+ 711      9F57FFFB 
+ 711      9F56FF
+ 712 2be0 FB9E56FF 		.ascii	"\373\236V\377\373\235U\377\372\235U\377\372\234U\377\372\233"
+ 712      FB9D55FF 
+ 712      FA9D55FF 
+ 712      FA9C55FF 
+ 712      FA9B
+ 713 2bf2 54FFFA9B 		.ascii	"T\377\372\233T\377\372\232T\377\372\232S\377\372\231S\377\372"
+ 713      54FFFA9A 
+ 713      54FFFA9A 
+ 713      53FFFA99 
+ 713      53FFFA
+ 714 2c05 9853FFFA 		.ascii	"\230S\377\372\230R\377\372\227R\377\372\227R\377\372\226Q\377"
+ 714      9852FFFA 
+ 714      9752FFFA 
+ 714      9752FFFA 
+ 714      9651FF
+GAS LISTING /tmp/ccaf4gN6.s 			page 52
+
+
+ 715 2c18 FA9551FF 		.ascii	"\372\225Q\377\371\225Q\377\371\224P\377\371\223P\377\371\223"
+ 715      F99551FF 
+ 715      F99450FF 
+ 715      F99350FF 
+ 715      F993
+ 716 2c2a 50FFF992 		.ascii	"P\377\371\222O\377\371\222O\377\371\221O\377\371\220N\377\371"
+ 716      4FFFF992 
+ 716      4FFFF991 
+ 716      4FFFF990 
+ 716      4EFFF9
+ 717 2c3d 904EFFF9 		.ascii	"\220N\377\371\217N\377\371\216N\377\371\216M\377\370\215M\377"
+ 717      8F4EFFF9 
+ 717      8E4EFFF9 
+ 717      8E4DFFF8 
+ 717      8D4DFF
+ 718 2c50 F88D4DFF 		.ascii	"\370\215M\377\370\214L\377\370\213L\377\370\213L\377\370\212"
+ 718      F88C4CFF 
+ 718      F88B4CFF 
+ 718      F88B4CFF 
+ 718      F88A
+ 719 2c62 4CFFF889 		.ascii	"L\377\370\211K\377\370\211K\377\370\210K\377\370\207J\377\370"
+ 719      4BFFF889 
+ 719      4BFFF888 
+ 719      4BFFF887 
+ 719      4AFFF8
+ 720 2c75 874AFFF7 		.ascii	"\207J\377\367\206J\377\367\206J\377\367\205I\377\367\204I\377"
+ 720      864AFFF7 
+ 720      864AFFF7 
+ 720      8549FFF7 
+ 720      8449FF
+ 721 2c88 F78449FF 		.ascii	"\367\204I\377\367\203I\377\367\202H\377\367\202H\377\367\201"
+ 721      F78349FF 
+ 721      F78248FF 
+ 721      F78248FF 
+ 721      F781
+ 722 2c9a 48FFF780 		.ascii	"H\377\367\200H\377\367\200H\377\366\177G\377\366~G\377\366~G"
+ 722      48FFF780 
+ 722      48FFF67F 
+ 722      47FFF67E 
+ 722      47FFF67E 
+ 723 2caf FFF67D47 		.ascii	"\377\366}G\377\366|F\377\366|F\377\366{F\377\366zF\377\366zF"
+ 723      FFF67C46 
+ 723      FFF67C46 
+ 723      FFF67B46 
+ 723      FFF67A46 
+ 724 2cc7 FFF67945 		.ascii	"\377\366yE\377\365xE\377\365xE\377\365wE\377\365vE\377\365vE"
+ 724      FFF57845 
+ 724      FFF57845 
+ 724      FFF57745 
+ 724      FFF57645 
+ 725 2cdf FFF57544 		.ascii	"\377\365uD\377\365tD\377\365tD\377\365sD\377\364rD\377\364rD"
+ 725      FFF57444 
+ 725      FFF57444 
+ 725      FFF57344 
+ 725      FFF47244 
+ 726 2cf7 FFF47143 		.ascii	"\377\364qC\377\364pC\377\364oC\377\364oC\377\364nC\377\364mC"
+ 726      FFF47043 
+GAS LISTING /tmp/ccaf4gN6.s 			page 53
+
+
+ 726      FFF46F43 
+ 726      FFF46F43 
+ 726      FFF46E43 
+ 727 2d0f FFF46D43 		.ascii	"\377\364mC\377\363lC\377\363lC\377\363kC\377\363kC\377\362jC"
+ 727      FFF36C43 
+ 727      FFF36C43 
+ 727      FFF36B43 
+ 727      FFF36B43 
+ 728 2d27 FFF26A43 		.ascii	"\377\362jC\377\362iC\377\362iC\377\361hD\377\361hD\377\361gD"
+ 728      FFF26943 
+ 728      FFF26943 
+ 728      FFF16844 
+ 728      FFF16844 
+ 729 2d3f FFF16744 		.ascii	"\377\361gD\377\360fD\377\360fD\377\360eD\377\360eD\377\357eE"
+ 729      FFF06644 
+ 729      FFF06644 
+ 729      FFF06544 
+ 729      FFF06544 
+ 730 2d57 FFEF6445 		.ascii	"\377\357dE\377\357dE\377\357cE\377\356cE\377\356bE\377\356bE"
+ 730      FFEF6445 
+ 730      FFEF6345 
+ 730      FFEE6345 
+ 730      FFEE6245 
+ 731 2d6f FFED6145 		.ascii	"\377\355aE\377\355aF\377\355`F\377\355`F\377\354_F\377\354_F"
+ 731      FFED6146 
+ 731      FFED6046 
+ 731      FFED6046 
+ 731      FFEC5F46 
+ 732 2d87 FFEC5E46 		.ascii	"\377\354^F\377\354^F\377\353]F\377\353]G\377\353]G\377\352\\"
+ 732      FFEC5E46 
+ 732      FFEB5D46 
+ 732      FFEB5D47 
+ 732      FFEB5D47 
+ 733 2d9e 47FFEA5C 		.ascii	"G\377\352\\G\377\352[G\377\352[G\377\351ZG\377\351ZG\377\351"
+ 733      47FFEA5B 
+ 733      47FFEA5B 
+ 733      47FFE95A 
+ 733      47FFE95A 
+ 734 2db5 5948FFE8 		.ascii	"YH\377\350YH\377\350XH\377\350XH\377\350WH\377\347WH\377\347"
+ 734      5948FFE8 
+ 734      5848FFE8 
+ 734      5848FFE8 
+ 734      5748FFE7 
+ 735 2dcd 5748FFE7 		.ascii	"WH\377\347VH\377\346VI\377\346UI\377\346UI\377\345TI\377\345"
+ 735      5648FFE6 
+ 735      5649FFE6 
+ 735      5549FFE6 
+ 735      5549FFE5 
+ 736 2de5 5449FFE5 		.ascii	"TI\377\345SI\377\345SI\377\344RI\377\344RI\377\344QJ\377\343"
+ 736      5349FFE5 
+ 736      5349FFE4 
+ 736      5249FFE4 
+ 736      5249FFE4 
+ 737 2dfd 514AFFE3 		.ascii	"QJ\377\343QJ\377\343PJ\377\342PJ\377\342OJ\377\342OJ\377\341"
+ 737      514AFFE3 
+ 737      504AFFE2 
+ 737      504AFFE2 
+GAS LISTING /tmp/ccaf4gN6.s 			page 54
+
+
+ 737      4F4AFFE2 
+ 738 2e15 4E4AFFE1 		.ascii	"NJ\377\341NK\377\341MK\377\340MK\377\340LK\377\340LK\377\337"
+ 738      4E4BFFE1 
+ 738      4D4BFFE0 
+ 738      4D4BFFE0 
+ 738      4C4BFFE0 
+ 739 2e2d 4C4BFFDF 		.ascii	"LK\377\337KK\377\337KK\377\336JK\377\336JL\377\336IL\377\335"
+ 739      4B4BFFDF 
+ 739      4B4BFFDE 
+ 739      4A4BFFDE 
+ 739      4A4CFFDE 
+ 740 2e45 494CFFDD 		.ascii	"IL\377\335HL\377\335HL\377\334HL\377\334GL\377\334GL\377\333"
+ 740      484CFFDD 
+ 740      484CFFDC 
+ 740      484CFFDC 
+ 740      474CFFDC 
+ 741 2e5d 464CFFDB 		.ascii	"FL\377\333FM\377\333EM\377\332EM\377\332DM\377\332DM\377\331"
+ 741      464DFFDB 
+ 741      454DFFDA 
+ 741      454DFFDA 
+ 741      444DFFDA 
+ 742 2e75 444DFFD9 		.ascii	"DM\377\331CM\377\331CM\377\330BM\377\330BN\377\330AN\377\327"
+ 742      434DFFD9 
+ 742      434DFFD8 
+ 742      424DFFD8 
+ 742      424EFFD8 
+ 743 2e8d 414EFFD7 		.ascii	"AN\377\327@N\377\327@N\377\326@N\377\326?N\377\325?N\377\325"
+ 743      404EFFD7 
+ 743      404EFFD6 
+ 743      404EFFD6 
+ 743      3F4EFFD5 
+ 744 2ea5 3E4EFFD5 		.ascii	">N\377\325>N\377\324=N\377\324=N\377\323<N\377\323<N\377\322"
+ 744      3E4EFFD4 
+ 744      3D4EFFD4 
+ 744      3D4EFFD3 
+ 744      3C4EFFD3 
+ 745 2ebd 3B4EFFD2 		.ascii	";N\377\322;N\377\321:N\377\321:N\377\3209N\377\3209M\377\317"
+ 745      3B4EFFD1 
+ 745      3A4EFFD1 
+ 745      3A4EFFD0 
+ 745      394EFFD0 
+ 746 2ed5 384DFFCF 		.ascii	"8M\377\3178M\377\3167M\377\3157M\377\3157M\377\3146M\377\314"
+ 746      384DFFCE 
+ 746      374DFFCD 
+ 746      374DFFCD 
+ 746      374DFFCC 
+ 747 2eed 364DFFCB 		.ascii	"6M\377\3135M\377\3135L\377\3124L\377\3124L\377\3113L\377\311"
+ 747      354DFFCB 
+ 747      354CFFCA 
+ 747      344CFFCA 
+ 747      344CFFC9 
+ 748 2f05 334CFFC8 		.ascii	"3L\377\3102L\377\3102L\377\3071L\377\3071L\377\3060K\377\305"
+ 748      324CFFC8 
+ 748      324CFFC7 
+ 748      314CFFC7 
+ 748      314CFFC6 
+ 749 2f1d 304BFFC5 		.ascii	"0K\377\305/K\377\304/K\377\304.K\377\303.K\377\303-K\377\302"
+GAS LISTING /tmp/ccaf4gN6.s 			page 55
+
+
+ 749      2F4BFFC4 
+ 749      2F4BFFC4 
+ 749      2E4BFFC3 
+ 749      2E4BFFC3 
+ 750 2f35 2D4BFFC2 		.ascii	"-K\377\302,J\377\301,J\377\301+J\377\300+J\377\300*J\377\277"
+ 750      2C4AFFC1 
+ 750      2C4AFFC1 
+ 750      2B4AFFC0 
+ 750      2B4AFFC0 
+ 751 2f4d 2A4AFFBF 		.ascii	"*J\377\277)J\377\276)J\377\275(I\377\275'I\377\274'I\377\274"
+ 751      294AFFBE 
+ 751      294AFFBD 
+ 751      2849FFBD 
+ 751      2749FFBC 
+ 752 2f65 2649FFBB 		.ascii	"&I\377\273&I\377\273%I\377\272%I\377\272$I\377\271$H\377\271"
+ 752      2649FFBB 
+ 752      2549FFBA 
+ 752      2549FFBA 
+ 752      2449FFB9 
+ 753 2f7d 2348FFB8 		.ascii	"#H\377\270#H\377\270\"H\377\267\"H\377\266!H\377\266!H\377\265"
+ 753      2348FFB8 
+ 753      2248FFB7 
+ 753      2248FFB6 
+ 753      2148FFB6 
+ 754 2f95 2048FFB5 		.ascii	" H\377\265\037G\377\264\037G\377\264\036G\377\263\036G\377\263"
+ 754      1F47FFB4 
+ 754      1F47FFB4 
+ 754      1E47FFB3 
+ 754      1E47FFB3 
+ 755 2fa9 1D47FFB2 		.ascii	"\035G\377\262\035G\377\262\034G\377\261\033G\377\261\033F\377"
+ 755      1D47FFB2 
+ 755      1C47FFB1 
+ 755      1B47FFB1 
+ 755      1B46FF
+ 756 2fbc B01A46FF 		.ascii	"\260\032F\377\257\032F\377\257\031F\377\256\031F\377\256\030"
+ 756      AF1A46FF 
+ 756      AF1946FF 
+ 756      AE1946FF 
+ 756      AE18
+ 757 2fce 46FFAD17 		.ascii	"F\377\255\027F\377\255\027E\377\254\026E\377\254\025E\377"
+ 757      46FFAD17 
+ 757      45FFAC16 
+ 757      45FFAC15 
+ 757      45FF
+ 758 2fe0 AB1545FF 		.ascii	"\253\025E\377\253\024E\377\252\023E\377\251\023E\377\251\022"
+ 758      AB1445FF 
+ 758      AA1345FF 
+ 758      A91345FF 
+ 758      A912
+ 759 2ff2 44FFA811 		.ascii	"D\377\250\021D\377\250\021D\377\247\020D\377\247\017D\377\246"
+ 759      44FFA811 
+ 759      44FFA710 
+ 759      44FFA70F 
+ 759      44FFA6
+ 760 3005 0E44FFA6 		.ascii	"\016D\377\246\016D\377\245\rD\377\245\fC\377\244\013C\377\244"
+ 760      0E44FFA5 
+ 760      0D44FFA5 
+GAS LISTING /tmp/ccaf4gN6.s 			page 56
+
+
+ 760      0C43FFA4 
+ 760      0B43FFA4 
+ 761 3019 0A43FFA3 		.ascii	"\nC\377\243\tC\377\242\bC\377\242\007C\377\241\006C\377\241\006"
+ 761      0943FFA2 
+ 761      0843FFA2 
+ 761      0743FFA1 
+ 761      0643FFA1 
+ 762 302e 42FFA005 		.ascii	"B\377\240\005B\377\240\004B\377\237\003B\377\237\002B\377\236"
+ 762      42FFA004 
+ 762      42FF9F03 
+ 762      42FF9F02 
+ 762      42FF9E
+ 763 3041 0142FF   		.ascii	"\001B\377"
+ 764              		.globl	heatmap_cs_Spectral_discrete
+ 765              		.section	.data.rel.local
+ 766              		.align 8
+ 767              		.type	heatmap_cs_Spectral_discrete, @object
+ 768              		.size	heatmap_cs_Spectral_discrete, 8
+ 769              	heatmap_cs_Spectral_discrete:
+ 770 0018 00000000 		.quad	discrete
+ 770      00000000 
+ 771              		.section	.data.rel.ro.local
+ 772              		.align 16
+ 773              		.type	discrete, @object
+ 774              		.size	discrete, 16
+ 775              	discrete:
+ 776 0030 00000000 		.quad	discrete_data
+ 776      00000000 
+ 777 0038 0C000000 		.quad	12
+ 777      00000000 
+ 778              		.section	.rodata
+ 779 3044 00000000 		.align 32
+ 779      00000000 
+ 779      00000000 
+ 779      00000000 
+ 779      00000000 
+ 780              		.type	discrete_data, @object
+ 781              		.size	discrete_data, 48
+ 782              	discrete_data:
+ 783 3060 00       		.string	""
+ 784 3061 00       		.string	""
+ 785 3062 00       		.string	""
+ 786 3063 00       		.string	""
+ 787 3064 5E4FA2FF 		.ascii	"^O\242\3772\210\275\377f\302\245\377\253\335\244\377\346\365"
+ 787      3288BDFF 
+ 787      66C2A5FF 
+ 787      ABDDA4FF 
+ 787      E6F5
+ 788 3076 98FFF1F3 		.ascii	"\230\377\361\363\247\377\376\340\220\377\375\256a\377\364mC\377"
+ 788      A7FFFEE0 
+ 788      90FFFDAE 
+ 788      61FFF46D 
+ 788      43FF
+ 789 3088 D53E4FFF 		.ascii	"\325>O\377\236\001B\377"
+ 789      9E0142FF 
+ 790              		.text
+ 791              	.Letext0:
+GAS LISTING /tmp/ccaf4gN6.s 			page 57
+
+
+ 792              		.file 1 "./heatmap.h"
+ 793              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 794              		.file 3 "./colorschemes/Spectral.h"
+ 795              		.file 4 "colorschemes/Spectral.c"
+ 796              		.section	.debug_info,"",@progbits
+ 797              	.Ldebug_info0:
+ 798 0000 E3010000 		.long	0x1e3
+ 799 0004 0500     		.value	0x5
+ 800 0006 01       		.byte	0x1
+ 801 0007 08       		.byte	0x8
+ 802 0008 00000000 		.long	.Ldebug_abbrev0
+ 803 000c 0A       		.uleb128 0xa
+ 804 000d 00000000 		.long	.LASF26
+ 805 0011 1D       		.byte	0x1d
+ 806 0012 00000000 		.long	.LASF0
+ 807 0016 00000000 		.long	.LASF1
+ 808 001a 00000000 		.long	.Ldebug_line0
+ 809 001e 01       		.uleb128 0x1
+ 810 001f 08       		.byte	0x8
+ 811 0020 05       		.byte	0x5
+ 812 0021 00000000 		.long	.LASF2
+ 813 0025 06       		.uleb128 0x6
+ 814 0026 00000000 		.long	.LASF12
+ 815 002a 02       		.byte	0x2
+ 816 002b D6       		.byte	0xd6
+ 817 002c 17       		.byte	0x17
+ 818 002d 31000000 		.long	0x31
+ 819 0031 01       		.uleb128 0x1
+ 820 0032 08       		.byte	0x8
+ 821 0033 07       		.byte	0x7
+ 822 0034 00000000 		.long	.LASF3
+ 823 0038 0B       		.uleb128 0xb
+ 824 0039 04       		.byte	0x4
+ 825 003a 05       		.byte	0x5
+ 826 003b 696E7400 		.string	"int"
+ 827 003f 01       		.uleb128 0x1
+ 828 0040 08       		.byte	0x8
+ 829 0041 05       		.byte	0x5
+ 830 0042 00000000 		.long	.LASF4
+ 831 0046 01       		.uleb128 0x1
+ 832 0047 10       		.byte	0x10
+ 833 0048 04       		.byte	0x4
+ 834 0049 00000000 		.long	.LASF5
+ 835 004d 01       		.uleb128 0x1
+ 836 004e 04       		.byte	0x4
+ 837 004f 04       		.byte	0x4
+ 838 0050 00000000 		.long	.LASF6
+ 839 0054 01       		.uleb128 0x1
+ 840 0055 04       		.byte	0x4
+ 841 0056 07       		.byte	0x7
+ 842 0057 00000000 		.long	.LASF7
+ 843 005b 01       		.uleb128 0x1
+ 844 005c 02       		.byte	0x2
+ 845 005d 07       		.byte	0x7
+ 846 005e 00000000 		.long	.LASF8
+ 847 0062 0C       		.uleb128 0xc
+ 848 0063 10       		.byte	0x10
+GAS LISTING /tmp/ccaf4gN6.s 			page 58
+
+
+ 849 0064 01       		.byte	0x1
+ 850 0065 BB       		.byte	0xbb
+ 851 0066 09       		.byte	0x9
+ 852 0067 84000000 		.long	0x84
+ 853 006b 07       		.uleb128 0x7
+ 854 006c 00000000 		.long	.LASF9
+ 855 0070 BC       		.byte	0xbc
+ 856 0071 1A       		.byte	0x1a
+ 857 0072 84000000 		.long	0x84
+ 858 0076 00       		.byte	0
+ 859 0077 07       		.uleb128 0x7
+ 860 0078 00000000 		.long	.LASF10
+ 861 007c BD       		.byte	0xbd
+ 862 007d 0C       		.byte	0xc
+ 863 007e 25000000 		.long	0x25
+ 864 0082 08       		.byte	0x8
+ 865 0083 00       		.byte	0
+ 866 0084 08       		.uleb128 0x8
+ 867 0085 90000000 		.long	0x90
+ 868 0089 01       		.uleb128 0x1
+ 869 008a 01       		.byte	0x1
+ 870 008b 08       		.byte	0x8
+ 871 008c 00000000 		.long	.LASF11
+ 872 0090 03       		.uleb128 0x3
+ 873 0091 89000000 		.long	0x89
+ 874 0095 06       		.uleb128 0x6
+ 875 0096 00000000 		.long	.LASF13
+ 876 009a 01       		.byte	0x1
+ 877 009b BE       		.byte	0xbe
+ 878 009c 03       		.byte	0x3
+ 879 009d 62000000 		.long	0x62
+ 880 00a1 03       		.uleb128 0x3
+ 881 00a2 95000000 		.long	0x95
+ 882 00a6 08       		.uleb128 0x8
+ 883 00a7 A1000000 		.long	0xa1
+ 884 00ab 04       		.uleb128 0x4
+ 885 00ac 00000000 		.long	.LASF14
+ 886 00b0 21       		.byte	0x21
+ 887 00b1 A6000000 		.long	0xa6
+ 888 00b5 04       		.uleb128 0x4
+ 889 00b6 00000000 		.long	.LASF15
+ 890 00ba 23       		.byte	0x23
+ 891 00bb A6000000 		.long	0xa6
+ 892 00bf 04       		.uleb128 0x4
+ 893 00c0 00000000 		.long	.LASF16
+ 894 00c4 25       		.byte	0x25
+ 895 00c5 A6000000 		.long	0xa6
+ 896 00c9 04       		.uleb128 0x4
+ 897 00ca 00000000 		.long	.LASF17
+ 898 00ce 28       		.byte	0x28
+ 899 00cf A6000000 		.long	0xa6
+ 900 00d3 09       		.uleb128 0x9
+ 901 00d4 90000000 		.long	0x90
+ 902 00d8 E3000000 		.long	0xe3
+ 903 00dc 0D       		.uleb128 0xd
+ 904 00dd 31000000 		.long	0x31
+ 905 00e1 2F       		.byte	0x2f
+GAS LISTING /tmp/ccaf4gN6.s 			page 59
+
+
+ 906 00e2 00       		.byte	0
+ 907 00e3 03       		.uleb128 0x3
+ 908 00e4 D3000000 		.long	0xd3
+ 909 00e8 02       		.uleb128 0x2
+ 910 00e9 00000000 		.long	.LASF18
+ 911 00ed 20       		.byte	0x20
+ 912 00ee 1C       		.byte	0x1c
+ 913 00ef E3000000 		.long	0xe3
+ 914 00f3 09       		.uleb128 0x9
+ 915 00f4 03       		.byte	0x3
+ 916 00f5 00000000 		.quad	discrete_data
+ 916      00000000 
+ 917 00fd 02       		.uleb128 0x2
+ 918 00fe 00000000 		.long	.LASF19
+ 919 0102 23       		.byte	0x23
+ 920 0103 24       		.byte	0x24
+ 921 0104 A1000000 		.long	0xa1
+ 922 0108 09       		.uleb128 0x9
+ 923 0109 03       		.byte	0x3
+ 924 010a 00000000 		.quad	discrete
+ 924      00000000 
+ 925 0112 05       		.uleb128 0x5
+ 926 0113 AB000000 		.long	0xab
+ 927 0117 24       		.byte	0x24
+ 928 0118 09       		.uleb128 0x9
+ 929 0119 03       		.byte	0x3
+ 930 011a 00000000 		.quad	heatmap_cs_Spectral_discrete
+ 930      00000000 
+ 931 0122 09       		.uleb128 0x9
+ 932 0123 90000000 		.long	0x90
+ 933 0127 33010000 		.long	0x133
+ 934 012b 0E       		.uleb128 0xe
+ 935 012c 31000000 		.long	0x31
+ 936 0130 0310     		.value	0x1003
+ 937 0132 00       		.byte	0
+ 938 0133 03       		.uleb128 0x3
+ 939 0134 22010000 		.long	0x122
+ 940 0138 02       		.uleb128 0x2
+ 941 0139 00000000 		.long	.LASF20
+ 942 013d 26       		.byte	0x26
+ 943 013e 1C       		.byte	0x1c
+ 944 013f 33010000 		.long	0x133
+ 945 0143 09       		.uleb128 0x9
+ 946 0144 03       		.byte	0x3
+ 947 0145 00000000 		.quad	soft_data
+ 947      00000000 
+ 948 014d 02       		.uleb128 0x2
+ 949 014e 00000000 		.long	.LASF21
+ 950 0152 29       		.byte	0x29
+ 951 0153 24       		.byte	0x24
+ 952 0154 A1000000 		.long	0xa1
+ 953 0158 09       		.uleb128 0x9
+ 954 0159 03       		.byte	0x3
+ 955 015a 00000000 		.quad	soft
+ 955      00000000 
+ 956 0162 05       		.uleb128 0x5
+ 957 0163 B5000000 		.long	0xb5
+GAS LISTING /tmp/ccaf4gN6.s 			page 60
+
+
+ 958 0167 2A       		.byte	0x2a
+ 959 0168 09       		.uleb128 0x9
+ 960 0169 03       		.byte	0x3
+ 961 016a 00000000 		.quad	heatmap_cs_Spectral_soft
+ 961      00000000 
+ 962 0172 02       		.uleb128 0x2
+ 963 0173 00000000 		.long	.LASF22
+ 964 0177 2C       		.byte	0x2c
+ 965 0178 1C       		.byte	0x1c
+ 966 0179 33010000 		.long	0x133
+ 967 017d 09       		.uleb128 0x9
+ 968 017e 03       		.byte	0x3
+ 969 017f 00000000 		.quad	mixed_data
+ 969      00000000 
+ 970 0187 02       		.uleb128 0x2
+ 971 0188 00000000 		.long	.LASF23
+ 972 018c 2F       		.byte	0x2f
+ 973 018d 24       		.byte	0x24
+ 974 018e A1000000 		.long	0xa1
+ 975 0192 09       		.uleb128 0x9
+ 976 0193 03       		.byte	0x3
+ 977 0194 00000000 		.quad	mixed
+ 977      00000000 
+ 978 019c 05       		.uleb128 0x5
+ 979 019d BF000000 		.long	0xbf
+ 980 01a1 30       		.byte	0x30
+ 981 01a2 09       		.uleb128 0x9
+ 982 01a3 03       		.byte	0x3
+ 983 01a4 00000000 		.quad	heatmap_cs_Spectral_mixed
+ 983      00000000 
+ 984 01ac 02       		.uleb128 0x2
+ 985 01ad 00000000 		.long	.LASF24
+ 986 01b1 32       		.byte	0x32
+ 987 01b2 1C       		.byte	0x1c
+ 988 01b3 33010000 		.long	0x133
+ 989 01b7 09       		.uleb128 0x9
+ 990 01b8 03       		.byte	0x3
+ 991 01b9 00000000 		.quad	mixed_exp_data
+ 991      00000000 
+ 992 01c1 02       		.uleb128 0x2
+ 993 01c2 00000000 		.long	.LASF25
+ 994 01c6 35       		.byte	0x35
+ 995 01c7 24       		.byte	0x24
+ 996 01c8 A1000000 		.long	0xa1
+ 997 01cc 09       		.uleb128 0x9
+ 998 01cd 03       		.byte	0x3
+ 999 01ce 00000000 		.quad	mixed_exp
+ 999      00000000 
+ 1000 01d6 05       		.uleb128 0x5
+ 1001 01d7 C9000000 		.long	0xc9
+ 1002 01db 36       		.byte	0x36
+ 1003 01dc 09       		.uleb128 0x9
+ 1004 01dd 03       		.byte	0x3
+ 1005 01de 00000000 		.quad	heatmap_cs_Spectral_mixed_exp
+ 1005      00000000 
+ 1006 01e6 00       		.byte	0
+ 1007              		.section	.debug_abbrev,"",@progbits
+GAS LISTING /tmp/ccaf4gN6.s 			page 61
+
+
+ 1008              	.Ldebug_abbrev0:
+ 1009 0000 01       		.uleb128 0x1
+ 1010 0001 24       		.uleb128 0x24
+ 1011 0002 00       		.byte	0
+ 1012 0003 0B       		.uleb128 0xb
+ 1013 0004 0B       		.uleb128 0xb
+ 1014 0005 3E       		.uleb128 0x3e
+ 1015 0006 0B       		.uleb128 0xb
+ 1016 0007 03       		.uleb128 0x3
+ 1017 0008 0E       		.uleb128 0xe
+ 1018 0009 00       		.byte	0
+ 1019 000a 00       		.byte	0
+ 1020 000b 02       		.uleb128 0x2
+ 1021 000c 34       		.uleb128 0x34
+ 1022 000d 00       		.byte	0
+ 1023 000e 03       		.uleb128 0x3
+ 1024 000f 0E       		.uleb128 0xe
+ 1025 0010 3A       		.uleb128 0x3a
+ 1026 0011 21       		.uleb128 0x21
+ 1027 0012 04       		.sleb128 4
+ 1028 0013 3B       		.uleb128 0x3b
+ 1029 0014 0B       		.uleb128 0xb
+ 1030 0015 39       		.uleb128 0x39
+ 1031 0016 0B       		.uleb128 0xb
+ 1032 0017 49       		.uleb128 0x49
+ 1033 0018 13       		.uleb128 0x13
+ 1034 0019 02       		.uleb128 0x2
+ 1035 001a 18       		.uleb128 0x18
+ 1036 001b 00       		.byte	0
+ 1037 001c 00       		.byte	0
+ 1038 001d 03       		.uleb128 0x3
+ 1039 001e 26       		.uleb128 0x26
+ 1040 001f 00       		.byte	0
+ 1041 0020 49       		.uleb128 0x49
+ 1042 0021 13       		.uleb128 0x13
+ 1043 0022 00       		.byte	0
+ 1044 0023 00       		.byte	0
+ 1045 0024 04       		.uleb128 0x4
+ 1046 0025 34       		.uleb128 0x34
+ 1047 0026 00       		.byte	0
+ 1048 0027 03       		.uleb128 0x3
+ 1049 0028 0E       		.uleb128 0xe
+ 1050 0029 3A       		.uleb128 0x3a
+ 1051 002a 21       		.uleb128 0x21
+ 1052 002b 03       		.sleb128 3
+ 1053 002c 3B       		.uleb128 0x3b
+ 1054 002d 0B       		.uleb128 0xb
+ 1055 002e 39       		.uleb128 0x39
+ 1056 002f 21       		.uleb128 0x21
+ 1057 0030 25       		.sleb128 37
+ 1058 0031 49       		.uleb128 0x49
+ 1059 0032 13       		.uleb128 0x13
+ 1060 0033 3F       		.uleb128 0x3f
+ 1061 0034 19       		.uleb128 0x19
+ 1062 0035 3C       		.uleb128 0x3c
+ 1063 0036 19       		.uleb128 0x19
+ 1064 0037 00       		.byte	0
+GAS LISTING /tmp/ccaf4gN6.s 			page 62
+
+
+ 1065 0038 00       		.byte	0
+ 1066 0039 05       		.uleb128 0x5
+ 1067 003a 34       		.uleb128 0x34
+ 1068 003b 00       		.byte	0
+ 1069 003c 47       		.uleb128 0x47
+ 1070 003d 13       		.uleb128 0x13
+ 1071 003e 3A       		.uleb128 0x3a
+ 1072 003f 21       		.uleb128 0x21
+ 1073 0040 04       		.sleb128 4
+ 1074 0041 3B       		.uleb128 0x3b
+ 1075 0042 0B       		.uleb128 0xb
+ 1076 0043 39       		.uleb128 0x39
+ 1077 0044 21       		.uleb128 0x21
+ 1078 0045 1E       		.sleb128 30
+ 1079 0046 02       		.uleb128 0x2
+ 1080 0047 18       		.uleb128 0x18
+ 1081 0048 00       		.byte	0
+ 1082 0049 00       		.byte	0
+ 1083 004a 06       		.uleb128 0x6
+ 1084 004b 16       		.uleb128 0x16
+ 1085 004c 00       		.byte	0
+ 1086 004d 03       		.uleb128 0x3
+ 1087 004e 0E       		.uleb128 0xe
+ 1088 004f 3A       		.uleb128 0x3a
+ 1089 0050 0B       		.uleb128 0xb
+ 1090 0051 3B       		.uleb128 0x3b
+ 1091 0052 0B       		.uleb128 0xb
+ 1092 0053 39       		.uleb128 0x39
+ 1093 0054 0B       		.uleb128 0xb
+ 1094 0055 49       		.uleb128 0x49
+ 1095 0056 13       		.uleb128 0x13
+ 1096 0057 00       		.byte	0
+ 1097 0058 00       		.byte	0
+ 1098 0059 07       		.uleb128 0x7
+ 1099 005a 0D       		.uleb128 0xd
+ 1100 005b 00       		.byte	0
+ 1101 005c 03       		.uleb128 0x3
+ 1102 005d 0E       		.uleb128 0xe
+ 1103 005e 3A       		.uleb128 0x3a
+ 1104 005f 21       		.uleb128 0x21
+ 1105 0060 01       		.sleb128 1
+ 1106 0061 3B       		.uleb128 0x3b
+ 1107 0062 0B       		.uleb128 0xb
+ 1108 0063 39       		.uleb128 0x39
+ 1109 0064 0B       		.uleb128 0xb
+ 1110 0065 49       		.uleb128 0x49
+ 1111 0066 13       		.uleb128 0x13
+ 1112 0067 38       		.uleb128 0x38
+ 1113 0068 0B       		.uleb128 0xb
+ 1114 0069 00       		.byte	0
+ 1115 006a 00       		.byte	0
+ 1116 006b 08       		.uleb128 0x8
+ 1117 006c 0F       		.uleb128 0xf
+ 1118 006d 00       		.byte	0
+ 1119 006e 0B       		.uleb128 0xb
+ 1120 006f 21       		.uleb128 0x21
+ 1121 0070 08       		.sleb128 8
+GAS LISTING /tmp/ccaf4gN6.s 			page 63
+
+
+ 1122 0071 49       		.uleb128 0x49
+ 1123 0072 13       		.uleb128 0x13
+ 1124 0073 00       		.byte	0
+ 1125 0074 00       		.byte	0
+ 1126 0075 09       		.uleb128 0x9
+ 1127 0076 01       		.uleb128 0x1
+ 1128 0077 01       		.byte	0x1
+ 1129 0078 49       		.uleb128 0x49
+ 1130 0079 13       		.uleb128 0x13
+ 1131 007a 01       		.uleb128 0x1
+ 1132 007b 13       		.uleb128 0x13
+ 1133 007c 00       		.byte	0
+ 1134 007d 00       		.byte	0
+ 1135 007e 0A       		.uleb128 0xa
+ 1136 007f 11       		.uleb128 0x11
+ 1137 0080 01       		.byte	0x1
+ 1138 0081 25       		.uleb128 0x25
+ 1139 0082 0E       		.uleb128 0xe
+ 1140 0083 13       		.uleb128 0x13
+ 1141 0084 0B       		.uleb128 0xb
+ 1142 0085 03       		.uleb128 0x3
+ 1143 0086 1F       		.uleb128 0x1f
+ 1144 0087 1B       		.uleb128 0x1b
+ 1145 0088 1F       		.uleb128 0x1f
+ 1146 0089 10       		.uleb128 0x10
+ 1147 008a 17       		.uleb128 0x17
+ 1148 008b 00       		.byte	0
+ 1149 008c 00       		.byte	0
+ 1150 008d 0B       		.uleb128 0xb
+ 1151 008e 24       		.uleb128 0x24
+ 1152 008f 00       		.byte	0
+ 1153 0090 0B       		.uleb128 0xb
+ 1154 0091 0B       		.uleb128 0xb
+ 1155 0092 3E       		.uleb128 0x3e
+ 1156 0093 0B       		.uleb128 0xb
+ 1157 0094 03       		.uleb128 0x3
+ 1158 0095 08       		.uleb128 0x8
+ 1159 0096 00       		.byte	0
+ 1160 0097 00       		.byte	0
+ 1161 0098 0C       		.uleb128 0xc
+ 1162 0099 13       		.uleb128 0x13
+ 1163 009a 01       		.byte	0x1
+ 1164 009b 0B       		.uleb128 0xb
+ 1165 009c 0B       		.uleb128 0xb
+ 1166 009d 3A       		.uleb128 0x3a
+ 1167 009e 0B       		.uleb128 0xb
+ 1168 009f 3B       		.uleb128 0x3b
+ 1169 00a0 0B       		.uleb128 0xb
+ 1170 00a1 39       		.uleb128 0x39
+ 1171 00a2 0B       		.uleb128 0xb
+ 1172 00a3 01       		.uleb128 0x1
+ 1173 00a4 13       		.uleb128 0x13
+ 1174 00a5 00       		.byte	0
+ 1175 00a6 00       		.byte	0
+ 1176 00a7 0D       		.uleb128 0xd
+ 1177 00a8 21       		.uleb128 0x21
+ 1178 00a9 00       		.byte	0
+GAS LISTING /tmp/ccaf4gN6.s 			page 64
+
+
+ 1179 00aa 49       		.uleb128 0x49
+ 1180 00ab 13       		.uleb128 0x13
+ 1181 00ac 2F       		.uleb128 0x2f
+ 1182 00ad 0B       		.uleb128 0xb
+ 1183 00ae 00       		.byte	0
+ 1184 00af 00       		.byte	0
+ 1185 00b0 0E       		.uleb128 0xe
+ 1186 00b1 21       		.uleb128 0x21
+ 1187 00b2 00       		.byte	0
+ 1188 00b3 49       		.uleb128 0x49
+ 1189 00b4 13       		.uleb128 0x13
+ 1190 00b5 2F       		.uleb128 0x2f
+ 1191 00b6 05       		.uleb128 0x5
+ 1192 00b7 00       		.byte	0
+ 1193 00b8 00       		.byte	0
+ 1194 00b9 00       		.byte	0
+ 1195              		.section	.debug_aranges,"",@progbits
+ 1196 0000 1C000000 		.long	0x1c
+ 1197 0004 0200     		.value	0x2
+ 1198 0006 00000000 		.long	.Ldebug_info0
+ 1199 000a 08       		.byte	0x8
+ 1200 000b 00       		.byte	0
+ 1201 000c 0000     		.value	0
+ 1202 000e 0000     		.value	0
+ 1203 0010 00000000 		.quad	0
+ 1203      00000000 
+ 1204 0018 00000000 		.quad	0
+ 1204      00000000 
+ 1205              		.section	.debug_line,"",@progbits
+ 1206              	.Ldebug_line0:
+ 1207 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1207      05000800 
+ 1207      49000000 
+ 1207      010101FB 
+ 1207      0E0D0001 
+ 1208              	.LASF20:
+ 1209 0000 736F6674 		.string	"soft_data"
+ 1209      5F646174 
+ 1209      6100
+ 1210              	.LASF12:
+ 1211 000a 73697A65 		.string	"size_t"
+ 1211      5F7400
+ 1212              	.LASF13:
+ 1213 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1213      6D61705F 
+ 1213      636F6C6F 
+ 1213      72736368 
+ 1213      656D655F 
+ 1214              	.LASF16:
+ 1215 0027 68656174 		.string	"heatmap_cs_Spectral_mixed"
+ 1215      6D61705F 
+ 1215      63735F53 
+ 1215      70656374 
+ 1215      72616C5F 
+ 1216              	.LASF15:
+ 1217 0041 68656174 		.string	"heatmap_cs_Spectral_soft"
+ 1217      6D61705F 
+GAS LISTING /tmp/ccaf4gN6.s 			page 65
+
+
+ 1217      63735F53 
+ 1217      70656374 
+ 1217      72616C5F 
+ 1218              	.LASF26:
+ 1219 005a 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1219      43313720 
+ 1219      31322E32 
+ 1219      2E30202D 
+ 1219      6D74756E 
+ 1220              	.LASF6:
+ 1221 00b9 666C6F61 		.string	"float"
+ 1221      7400
+ 1222              	.LASF11:
+ 1223 00bf 756E7369 		.string	"unsigned char"
+ 1223      676E6564 
+ 1223      20636861 
+ 1223      7200
+ 1224              	.LASF3:
+ 1225 00cd 6C6F6E67 		.string	"long unsigned int"
+ 1225      20756E73 
+ 1225      69676E65 
+ 1225      6420696E 
+ 1225      7400
+ 1226              	.LASF8:
+ 1227 00df 73686F72 		.string	"short unsigned int"
+ 1227      7420756E 
+ 1227      7369676E 
+ 1227      65642069 
+ 1227      6E7400
+ 1228              	.LASF25:
+ 1229 00f2 6D697865 		.string	"mixed_exp"
+ 1229      645F6578 
+ 1229      7000
+ 1230              	.LASF23:
+ 1231 00fc 6D697865 		.string	"mixed"
+ 1231      6400
+ 1232              	.LASF17:
+ 1233 0102 68656174 		.string	"heatmap_cs_Spectral_mixed_exp"
+ 1233      6D61705F 
+ 1233      63735F53 
+ 1233      70656374 
+ 1233      72616C5F 
+ 1234              	.LASF7:
+ 1235 0120 756E7369 		.string	"unsigned int"
+ 1235      676E6564 
+ 1235      20696E74 
+ 1235      00
+ 1236              	.LASF19:
+ 1237 012d 64697363 		.string	"discrete"
+ 1237      72657465 
+ 1237      00
+ 1238              	.LASF10:
+ 1239 0136 6E636F6C 		.string	"ncolors"
+ 1239      6F727300 
+ 1240              	.LASF4:
+ 1241 013e 6C6F6E67 		.string	"long long int"
+ 1241      206C6F6E 
+GAS LISTING /tmp/ccaf4gN6.s 			page 66
+
+
+ 1241      6720696E 
+ 1241      7400
+ 1242              	.LASF24:
+ 1243 014c 6D697865 		.string	"mixed_exp_data"
+ 1243      645F6578 
+ 1243      705F6461 
+ 1243      746100
+ 1244              	.LASF14:
+ 1245 015b 68656174 		.string	"heatmap_cs_Spectral_discrete"
+ 1245      6D61705F 
+ 1245      63735F53 
+ 1245      70656374 
+ 1245      72616C5F 
+ 1246              	.LASF22:
+ 1247 0178 6D697865 		.string	"mixed_data"
+ 1247      645F6461 
+ 1247      746100
+ 1248              	.LASF2:
+ 1249 0183 6C6F6E67 		.string	"long int"
+ 1249      20696E74 
+ 1249      00
+ 1250              	.LASF5:
+ 1251 018c 6C6F6E67 		.string	"long double"
+ 1251      20646F75 
+ 1251      626C6500 
+ 1252              	.LASF18:
+ 1253 0198 64697363 		.string	"discrete_data"
+ 1253      72657465 
+ 1253      5F646174 
+ 1253      6100
+ 1254              	.LASF21:
+ 1255 01a6 736F6674 		.string	"soft"
+ 1255      00
+ 1256              	.LASF9:
+ 1257 01ab 636F6C6F 		.string	"colors"
+ 1257      727300
+ 1258              		.section	.debug_line_str,"MS",@progbits,1
+ 1259              	.LASF1:
+ 1260 0000 2F726F6F 		.string	"/root/repo"
+ 1260      742F7265 
+ 1260      706F00
+ 1261              	.LASF0:
+ 1262 000b 636F6C6F 		.string	"colorschemes/Spectral.c"
+ 1262      72736368 
+ 1262      656D6573 
+ 1262      2F537065 
+ 1262      63747261 
+ 1263              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1264 0023 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1264      742F7265 
+ 1264      706F0063 
+ 1264      6F6C6F72 
+ 1264      73636865 
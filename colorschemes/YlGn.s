@@ -0,0 +1,3966 @@
+GAS LISTING /tmp/ccRZCsvR.s 			page 1
+
+
+   1              		.file	"YlGn.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/YlGn.c"
+   5              		.globl	heatmap_cs_YlGn_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_YlGn_mixed_exp, @object
+   9              		.size	heatmap_cs_YlGn_mixed_exp, 8
+  10              	heatmap_cs_YlGn_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 00       		.string	""
+  29 0005 452800   		.string	"E("
+  30 0008 00       		.string	""
+  31 0009 47291800 		.string	"G)\030"
+  32 000d 492A3100 		.string	"I*1"
+  33 0011 4B2B4A00 		.string	"K+J"
+  34 0015 4D2C6300 		.string	"M,c"
+  35 0019 4F2D7C00 		.string	"O-|"
+  36 001d 512E9500 		.string	"Q.\225"
+  37 0021 5A32AE00 		.string	"Z2\256"
+  38 0025 5C32C700 		.string	"\\2\307"
+  39 0029 5E33E000 		.string	"^3\340"
+  40 002d 6034F900 		.string	"`4\371"
+  41 0031 6235FF00 		.string	"b5\377"
+  42 0035 6435FF00 		.string	"d5\377"
+  43 0039 6636FF00 		.string	"f6\377"
+  44 003d 6837FF02 		.ascii	"h7\377\002j7\377\004k8\377\007m9\377\tn9\377\013p:\377\rq;\377"
+  44      6A37FF04 
+  44      6B38FF07 
+  44      6D39FF09 
+  44      6E39FF0B 
+  45 0058 0F733BFF 		.ascii	"\017s;\377\030z>\377\031{?\377\033|@\377\034~@\377\036\177A\377"
+  45      187A3EFF 
+  45      197B3FFF 
+  45      1B7C40FF 
+  45      1C7E40FF 
+  46 0070 208141FF 		.ascii	" \201A\377!\202B\377\"\203B\377$\205D\377%\207E\377'\211F\377"
+GAS LISTING /tmp/ccRZCsvR.s 			page 2
+
+
+  46      218242FF 
+  46      228342FF 
+  46      248544FF 
+  46      258745FF 
+  47 0088 288B47FF 		.ascii	"(\213G\377*\214H\377+\216J\377,\220K\377.\222L\3775\233R\377"
+  47      2A8C48FF 
+  47      2B8E4AFF 
+  47      2C904BFF 
+  47      2E924CFF 
+  48 00a0 369D54FF 		.ascii	"6\235T\3778\237U\3779\240V\377:\242W\377<\244X\377=\246Y\377"
+  48      389F55FF 
+  48      39A056FF 
+  48      3AA257FF 
+  48      3CA458FF 
+  49 00b8 3EA75AFF 		.ascii	">\247Z\377?\251[\377@\252\\\377C\254^\377F\255_\377H\256`\377"
+  49      3FA95BFF 
+  49      40AA5CFF 
+  49      43AC5EFF 
+  49      46AD5FFF 
+  50 00d0 4AAF61FF 		.ascii	"J\257a\377M\260b\377O\261c\377Q\262d\377S\263e\377U\264f\377"
+  50      4DB062FF 
+  50      4FB163FF 
+  50      51B264FF 
+  50      53B365FF 
+  51 00e8 57B567FF 		.ascii	"W\265g\377d\273n\377f\274o\377h\275p\377j\276q\377l\277r\377"
+  51      64BB6EFF 
+  51      66BC6FFF 
+  51      68BD70FF 
+  51      6ABE71FF 
+  52 0100 6EC073FF 		.ascii	"n\300s\377p\301t\377q\302u\377s\303v\377u\304w\377w\305x\377"
+  52      70C174FF 
+  52      71C275FF 
+  52      73C376FF 
+  52      75C477FF 
+  53 0118 78C679FF 		.ascii	"x\306y\377z\307y\377|\307z\377~\310{\377\200\311{\377\201\312"
+  53      7AC779FF 
+  53      7CC77AFF 
+  53      7EC87BFF 
+  53      80C97BFF 
+  54 012e 7CFF83CA 		.ascii	"|\377\203\312|\377\205\313}\377\207\314~\377\210\314~\377\212"
+  54      7CFF85CB 
+  54      7DFF87CC 
+  54      7EFF88CC 
+  54      7EFF8A
+  55 0141 CD7FFF8B 		.ascii	"\315\177\377\213\316\200\377\215\317\200\377\231\324\205\377"
+  55      CE80FF8D 
+  55      CF80FF99 
+  55      D485FF
+  56 0150 9BD486FF 		.ascii	"\233\324\206\377\234\325\206\377\236\326\207\377\237\326\207"
+  56      9CD586FF 
+  56      9ED687FF 
+  56      9FD687
+  57 015f FFA1D788 		.ascii	"\377\241\327\210\377\242\330\211\377\244\330\211\377\245\331"
+  57      FFA2D889 
+  57      FFA4D889 
+  57      FFA5D9
+  58 016e 8AFFA6DA 		.ascii	"\212\377\246\332\213\377\250\332\213\377\251\333\214\377\252"
+GAS LISTING /tmp/ccRZCsvR.s 			page 3
+
+
+  58      8BFFA8DA 
+  58      8BFFA9DB 
+  58      8CFFAA
+  59 017d DB8CFFAC 		.ascii	"\333\214\377\254\334\215\377\255\335\216\377\256\335\216\377"
+  59      DC8DFFAD 
+  59      DD8EFFAE 
+  59      DD8EFF
+  60 018c AFDE8FFF 		.ascii	"\257\336\217\377\260\336\217\377\262\337\220\377\263\337\220"
+  60      B0DE8FFF 
+  60      B2DF90FF 
+  60      B3DF90
+  61 019b FFB4E091 		.ascii	"\377\264\340\221\377\265\340\221\377\266\340\221\377\267\341"
+  61      FFB5E091 
+  61      FFB6E091 
+  61      FFB7E1
+  62 01aa 92FFB8E1 		.ascii	"\222\377\270\341\222\377\271\342\223\377\272\342\223\377\273"
+  62      92FFB9E2 
+  62      93FFBAE2 
+  62      93FFBB
+  63 01b9 E394FFBC 		.ascii	"\343\224\377\274\343\224\377\275\343\225\377\276\344\225\377"
+  63      E394FFBD 
+  63      E395FFBE 
+  63      E495FF
+  64 01c8 C8E89AFF 		.ascii	"\310\350\232\377\311\351\232\377\312\351\233\377\313\351\233"
+  64      C9E99AFF 
+  64      CAE99BFF 
+  64      CBE99B
+  65 01d7 FFCCEA9C 		.ascii	"\377\314\352\234\377\314\352\234\377\315\353\235\377\316\353"
+  65      FFCCEA9C 
+  65      FFCDEB9D 
+  65      FFCEEB
+  66 01e6 9DFFCFEB 		.ascii	"\235\377\317\353\235\377\320\354\236\377\321\354\236\377\322"
+  66      9DFFD0EC 
+  66      9EFFD1EC 
+  66      9EFFD2
+  67 01f5 EC9FFFD3 		.ascii	"\354\237\377\323\355\237\377\323\355\240\377\324\356\240\377"
+  67      ED9FFFD3 
+  67      EDA0FFD4 
+  67      EEA0FF
+  68 0204 D5EEA1FF 		.ascii	"\325\356\241\377\326\356\241\377\327\357\241\377\327\357\242"
+  68      D6EEA1FF 
+  68      D7EFA1FF 
+  68      D7EFA2
+  69 0213 FFD8EFA2 		.ascii	"\377\330\357\242\377\331\360\243\377\331\360\243\377\332\360"
+  69      FFD9F0A3 
+  69      FFD9F0A3 
+  69      FFDAF0
+  70 0222 A3FFDAF0 		.ascii	"\243\377\332\360\244\377\333\360\244\377\334\361\244\377\334"
+  70      A4FFDBF0 
+  70      A4FFDCF1 
+  70      A4FFDC
+  71 0231 F1A5FFDD 		.ascii	"\361\245\377\335\361\245\377\335\361\245\377\336\361\246\377"
+  71      F1A5FFDD 
+  71      F1A5FFDE 
+  71      F1A6FF
+  72 0240 DEF2A6FF 		.ascii	"\336\362\246\377\337\362\247\377\337\362\247\377\340\362\247"
+  72      DFF2A7FF 
+GAS LISTING /tmp/ccRZCsvR.s 			page 4
+
+
+  72      DFF2A7FF 
+  72      E0F2A7
+  73 024f FFE0F2A8 		.ascii	"\377\340\362\250\377\341\363\250\377\341\363\250\377\341\363"
+  73      FFE1F3A8 
+  73      FFE1F3A8 
+  73      FFE1F3
+  74 025e A8FFE2F3 		.ascii	"\250\377\342\363\251\377\342\363\251\377\343\363\251\377\343"
+  74      A9FFE2F3 
+  74      A9FFE3F3 
+  74      A9FFE3
+  75 026d F4AAFFE4 		.ascii	"\364\252\377\344\364\252\377\344\364\252\377\345\364\253\377"
+  75      F4AAFFE4 
+  75      F4AAFFE5 
+  75      F4ABFF
+  76 027c EBF7AFFF 		.ascii	"\353\367\257\377\353\367\260\377\354\367\260\377\354\367\260"
+  76      EBF7B0FF 
+  76      ECF7B0FF 
+  76      ECF7B0
+  77 028b FFEDF7B1 		.ascii	"\377\355\367\261\377\355\367\261\377\355\370\261\377\356\370"
+  77      FFEDF7B1 
+  77      FFEDF8B1 
+  77      FFEEF8
+  78 029a B1FFEEF8 		.ascii	"\261\377\356\370\262\377\356\370\262\377\357\370\262\377\357"
+  78      B2FFEEF8 
+  78      B2FFEFF8 
+  78      B2FFEF
+  79 02a9 F8B3FFF0 		.ascii	"\370\263\377\360\371\263\377\360\371\263\377\360\371\263\377"
+  79      F9B3FFF0 
+  79      F9B3FFF0 
+  79      F9B3FF
+  80 02b8 F1F9B4FF 		.ascii	"\361\371\264\377\361\371\264\377\361\371\264\377\362\371\265"
+  80      F1F9B4FF 
+  80      F1F9B4FF 
+  80      F2F9B5
+  81 02c7 FFF2FAB5 		.ascii	"\377\362\372\265\377\362\372\265\377\363\372\265\377\363\372"
+  81      FFF2FAB5 
+  81      FFF3FAB5 
+  81      FFF3FA
+  82 02d6 B6FFF3FA 		.ascii	"\266\377\363\372\266\377\364\372\266\377\364\372\266\377\364"
+  82      B6FFF4FA 
+  82      B6FFF4FA 
+  82      B6FFF4
+  83 02e5 FAB7FFF4 		.ascii	"\372\267\377\364\373\267\377\365\373\267\377\365\373\267\377"
+  83      FBB7FFF5 
+  83      FBB7FFF5 
+  83      FBB7FF
+  84 02f4 F5FBB8FF 		.ascii	"\365\373\270\377\366\373\270\377\366\373\270\377\366\373\270"
+  84      F6FBB8FF 
+  84      F6FBB8FF 
+  84      F6FBB8
+  85 0303 FFF6FBB8 		.ascii	"\377\366\373\270\377\367\374\271\377\367\374\271\377\367\374"
+  85      FFF7FCB9 
+  85      FFF7FCB9 
+  85      FFF7FC
+  86 0312 BAFFF7FC 		.ascii	"\272\377\367\374\272\377\367\374\272\377\367\374\273\377\367"
+  86      BAFFF7FC 
+  86      BAFFF7FC 
+GAS LISTING /tmp/ccRZCsvR.s 			page 5
+
+
+  86      BBFFF7
+  87 0321 FCBBFFF7 		.ascii	"\374\273\377\367\374\274\377\367\374\274\377\367\374\274\377"
+  87      FCBCFFF7 
+  87      FCBCFFF7 
+  87      FCBCFF
+  88 0330 F7FCBDFF 		.ascii	"\367\374\275\377\370\374\275\377\370\374\276\377\370\374\276"
+  88      F8FCBDFF 
+  88      F8FCBEFF 
+  88      F8FCBE
+  89 033f FFF8FCBE 		.ascii	"\377\370\374\276\377\370\374\277\377\370\374\277\377\370\374"
+  89      FFF8FCBF 
+  89      FFF8FCBF 
+  89      FFF8FC
+  90 034e BFFFF8FC 		.ascii	"\277\377\370\374\300\377\370\374\300\377\370\374\300\377\370"
+  90      C0FFF8FC 
+  90      C0FFF8FC 
+  90      C0FFF8
+  91 035d FCC1FFF8 		.ascii	"\374\301\377\370\374\301\377\370\374\301\377\371\374\302\377"
+  91      FCC1FFF8 
+  91      FCC1FFF9 
+  91      FCC2FF
+  92 036c F9FCC2FF 		.ascii	"\371\374\302\377\371\374\302\377\371\374\303\377\371\374\303"
+  92      F9FCC2FF 
+  92      F9FCC3FF 
+  92      F9FCC3
+  93 037b FFF9FCC3 		.ascii	"\377\371\374\303\377\371\374\304\377\371\374\304\377\371\374"
+  93      FFF9FCC4 
+  93      FFF9FCC4 
+  93      FFF9FC
+  94 038a C4FFF9FC 		.ascii	"\304\377\371\374\304\377\371\374\305\377\371\374\305\377\371"
+  94      C4FFF9FC 
+  94      C5FFF9FC 
+  94      C5FFF9
+  95 0399 FCC5FFF9 		.ascii	"\374\305\377\371\374\306\377\371\374\306\377\371\374\306\377"
+  95      FCC6FFF9 
+  95      FCC6FFF9 
+  95      FCC6FF
+  96 03a8 FAFCC6FF 		.ascii	"\372\374\306\377\372\374\307\377\372\374\307\377\372\374\307"
+  96      FAFCC7FF 
+  96      FAFCC7FF 
+  96      FAFCC7
+  97 03b7 FFFAFCC7 		.ascii	"\377\372\374\307\377\372\374\310\377\372\374\310\377\372\375"
+  97      FFFAFCC8 
+  97      FFFAFCC8 
+  97      FFFAFD
+  98 03c6 C8FFFAFD 		.ascii	"\310\377\372\375\310\377\372\375\311\377\372\375\311\377\372"
+  98      C8FFFAFD 
+  98      C9FFFAFD 
+  98      C9FFFA
+  99 03d5 FDC9FFFA 		.ascii	"\375\311\377\372\375\311\377\372\375\312\377\372\375\312\377"
+  99      FDC9FFFA 
+  99      FDCAFFFA 
+  99      FDCAFF
+ 100 03e4 FCFDD3FF 		.ascii	"\374\375\323\377\374\375\323\377\374\375\323\377\374\375\324"
+ 100      FCFDD3FF 
+ 100      FCFDD3FF 
+ 100      FCFDD4
+GAS LISTING /tmp/ccRZCsvR.s 			page 6
+
+
+ 101 03f3 FFFCFDD4 		.ascii	"\377\374\375\324\377\374\375\324\377\374\375\324\377\374\375"
+ 101      FFFCFDD4 
+ 101      FFFCFDD4 
+ 101      FFFCFD
+ 102 0402 D4FFFCFD 		.ascii	"\324\377\374\375\325\377\374\375\325\377\374\375\325\377\374"
+ 102      D5FFFCFD 
+ 102      D5FFFCFD 
+ 102      D5FFFC
+ 103 0411 FDD5FFFC 		.ascii	"\375\325\377\374\375\325\377\374\375\326\377\374\375\326\377"
+ 103      FDD5FFFC 
+ 103      FDD6FFFC 
+ 103      FDD6FF
+ 104 0420 FCFDD6FF 		.ascii	"\374\375\326\377\374\375\326\377\374\375\326\377\374\375\327"
+ 104      FCFDD6FF 
+ 104      FCFDD6FF 
+ 104      FCFDD7
+ 105 042f FFFCFDD7 		.ascii	"\377\374\375\327\377\375\376\327\377\375\376\327\377\375\376"
+ 105      FFFDFED7 
+ 105      FFFDFED7 
+ 105      FFFDFE
+ 106 043e D7FFFDFE 		.ascii	"\327\377\375\376\327\377\375\376\330\377\375\376\330\377\375"
+ 106      D7FFFDFE 
+ 106      D8FFFDFE 
+ 106      D8FFFD
+ 107 044d FED8FFFD 		.ascii	"\376\330\377\375\376\330\377\375\376\330\377\375\376\330\377"
+ 107      FED8FFFD 
+ 107      FED8FFFD 
+ 107      FED8FF
+ 108 045c FDFED9FF 		.ascii	"\375\376\331\377\375\376\331\377\375\376\331\377\375\376\331"
+ 108      FDFED9FF 
+ 108      FDFED9FF 
+ 108      FDFED9
+ 109 046b FFFDFED9 		.ascii	"\377\375\376\331\377\375\376\331\377\375\376\332\377\375\376"
+ 109      FFFDFED9 
+ 109      FFFDFEDA 
+ 109      FFFDFE
+ 110 047a DAFFFDFE 		.ascii	"\332\377\375\376\332\377\375\376\332\377\375\376\332\377\375"
+ 110      DAFFFDFE 
+ 110      DAFFFDFE 
+ 110      DAFFFD
+ 111 0489 FEDAFFFD 		.ascii	"\376\332\377\375\376\332\377\375\376\333\377\375\376\333\377"
+ 111      FEDAFFFD 
+ 111      FEDBFFFD 
+ 111      FEDBFF
+ 112 0498 FDFEDBFF 		.ascii	"\375\376\333\377\375\376\333\377\375\376\333\377\375\376\333"
+ 112      FDFEDBFF 
+ 112      FDFEDBFF 
+ 112      FDFEDB
+ 113 04a7 FFFDFEDB 		.ascii	"\377\375\376\333\377\375\376\333\377\375\376\334\377\375\376"
+ 113      FFFDFEDB 
+ 113      FFFDFEDC 
+ 113      FFFDFE
+ 114 04b6 DCFFFDFE 		.ascii	"\334\377\375\376\334\377\375\376\334\377\375\376\334\377\375"
+ 114      DCFFFDFE 
+ 114      DCFFFDFE 
+ 114      DCFFFD
+ 115 04c5 FEDCFFFD 		.ascii	"\376\334\377\375\376\334\377\375\376\334\377\375\376\334\377"
+GAS LISTING /tmp/ccRZCsvR.s 			page 7
+
+
+ 115      FEDCFFFD 
+ 115      FEDCFFFD 
+ 115      FEDCFF
+ 116 04d4 FDFEDDFF 		.ascii	"\375\376\335\377\375\376\335\377\375\376\335\377\375\376\335"
+ 116      FDFEDDFF 
+ 116      FDFEDDFF 
+ 116      FDFEDD
+ 117 04e3 FFFDFEDD 		.ascii	"\377\375\376\335\377\376\376\335\377\376\376\335\377\376\376"
+ 117      FFFEFEDD 
+ 117      FFFEFEDD 
+ 117      FFFEFE
+ 118 04f2 DDFFFEFE 		.ascii	"\335\377\376\376\335\377\376\376\336\377\376\376\336\377\376"
+ 118      DDFFFEFE 
+ 118      DEFFFEFE 
+ 118      DEFFFE
+ 119 0501 FEDEFFFE 		.ascii	"\376\336\377\376\376\336\377\376\376\336\377\376\376\336\377"
+ 119      FEDEFFFE 
+ 119      FEDEFFFE 
+ 119      FEDEFF
+ 120 0510 FEFEDEFF 		.ascii	"\376\376\336\377\376\376\336\377\376\376\336\377\376\376\336"
+ 120      FEFEDEFF 
+ 120      FEFEDEFF 
+ 120      FEFEDE
+ 121 051f FFFEFEDE 		.ascii	"\377\376\376\336\377\376\376\337\377\376\376\337\377\376\376"
+ 121      FFFEFEDF 
+ 121      FFFEFEDF 
+ 121      FFFEFE
+ 122 052e DFFFFEFE 		.ascii	"\337\377\376\376\337\377\376\376\337\377\376\376\337\377\376"
+ 122      DFFFFEFE 
+ 122      DFFFFEFE 
+ 122      DFFFFE
+ 123 053d FEDFFFFE 		.ascii	"\376\337\377\376\376\337\377\376\376\337\377\376\376\337\377"
+ 123      FEDFFFFE 
+ 123      FEDFFFFE 
+ 123      FEDFFF
+ 124 054c FEFEDFFF 		.ascii	"\376\376\337\377\376\376\337\377\376\376\340\377\376\376\340"
+ 124      FEFEDFFF 
+ 124      FEFEE0FF 
+ 124      FEFEE0
+ 125 055b FFFEFEE0 		.ascii	"\377\376\376\340\377\376\376\340\377\376\376\340\377\376\376"
+ 125      FFFEFEE0 
+ 125      FFFEFEE0 
+ 125      FFFEFE
+ 126 056a E0FFFEFE 		.ascii	"\340\377\376\376\340\377\376\376\340\377\376\376\340\377\376"
+ 126      E0FFFEFE 
+ 126      E0FFFEFE 
+ 126      E0FFFE
+ 127 0579 FEE0FFFE 		.ascii	"\376\340\377\376\376\340\377\376\376\340\377\376\376\340\377"
+ 127      FEE0FFFE 
+ 127      FEE0FFFE 
+ 127      FEE0FF
+ 128 0588 FEFEE0FF 		.ascii	"\376\376\340\377\376\376\340\377\376\376\340\377\376\376\341"
+ 128      FEFEE0FF 
+ 128      FEFEE0FF 
+ 128      FEFEE1
+ 129 0597 FFFEFEE1 		.ascii	"\377\376\376\341\377\376\376\341\377\376\376\341\377\376\376"
+ 129      FFFEFEE1 
+GAS LISTING /tmp/ccRZCsvR.s 			page 8
+
+
+ 129      FFFEFEE1 
+ 129      FFFEFE
+ 130 05a6 E1FFFEFE 		.ascii	"\341\377\376\376\341\377\376\376\341\377\376\376\341\377\376"
+ 130      E1FFFEFE 
+ 130      E1FFFEFE 
+ 130      E1FFFE
+ 131 05b5 FEE1FFFE 		.ascii	"\376\341\377\376\376\341\377\376\376\341\377\376\376\341\377"
+ 131      FEE1FFFE 
+ 131      FEE1FFFE 
+ 131      FEE1FF
+ 132 05c4 FEFEE1FF 		.ascii	"\376\376\341\377\376\376\341\377\376\376\341\377\376\376\341"
+ 132      FEFEE1FF 
+ 132      FEFEE1FF 
+ 132      FEFEE1
+ 133 05d3 FFFEFEE1 		.ascii	"\377\376\376\341\377\376\376\341\377\376\376\341\377\376\376"
+ 133      FFFEFEE1 
+ 133      FFFEFEE1 
+ 133      FFFEFE
+ 134 05e2 E2FFFEFE 		.ascii	"\342\377\376\376\342\377\376\376\342\377\376\376\342\377\376"
+ 134      E2FFFEFE 
+ 134      E2FFFEFE 
+ 134      E2FFFE
+ 135 05f1 FEE2FFFE 		.ascii	"\376\342\377\376\376\342\377\376\376\342\377\376\376\342\377"
+ 135      FEE2FFFE 
+ 135      FEE2FFFE 
+ 135      FEE2FF
+ 136 0600 FEFEE2FF 		.ascii	"\376\376\342\377\376\376\342\377\376\376\342\377\376\376\342"
+ 136      FEFEE2FF 
+ 136      FEFEE2FF 
+ 136      FEFEE2
+ 137 060f FFFEFEE2 		.ascii	"\377\376\376\342\377\376\376\342\377\376\376\342\377\376\376"
+ 137      FFFEFEE2 
+ 137      FFFEFEE2 
+ 137      FFFEFE
+ 138 061e E2FFFEFE 		.ascii	"\342\377\376\376\342\377\376\376\342\377\376\376\342\377\376"
+ 138      E2FFFEFE 
+ 138      E2FFFEFE 
+ 138      E2FFFE
+ 139 062d FEE2FFFE 		.ascii	"\376\342\377\376\376\342\377\376\376\342\377\376\376\342\377"
+ 139      FEE2FFFE 
+ 139      FEE2FFFE 
+ 139      FEE2FF
+ 140 063c FEFEE2FF 		.ascii	"\376\376\342\377\376\376\342\377\376\376\343\377\376\376\343"
+ 140      FEFEE2FF 
+ 140      FEFEE3FF 
+ 140      FEFEE3
+ 141 064b FFFEFEE3 		.ascii	"\377\376\376\343\377\376\376\343\377\376\376\343\377\376\376"
+ 141      FFFEFEE3 
+ 141      FFFEFEE3 
+ 141      FFFEFE
+ 142 065a E3FFFEFE 		.ascii	"\343\377\376\376\343\377\376\376\343\377\376\376\343\377\376"
+ 142      E3FFFEFE 
+ 142      E3FFFEFE 
+ 142      E3FFFE
+ 143 0669 FEE3FFFE 		.ascii	"\376\343\377\376\376\343\377\376\376\343\377\376\376\343\377"
+ 143      FEE3FFFE 
+ 143      FEE3FFFE 
+GAS LISTING /tmp/ccRZCsvR.s 			page 9
+
+
+ 143      FEE3FF
+ 144 0678 FEFEE3FF 		.ascii	"\376\376\343\377\376\376\343\377\376\376\343\377\376\376\343"
+ 144      FEFEE3FF 
+ 144      FEFEE3FF 
+ 144      FEFEE3
+ 145 0687 FFFEFEE3 		.ascii	"\377\376\376\343\377\376\376\343\377\376\376\343\377\376\376"
+ 145      FFFEFEE3 
+ 145      FFFEFEE3 
+ 145      FFFEFE
+ 146 0696 E3FFFEFE 		.ascii	"\343\377\376\376\343\377\376\376\343\377\376\376\343\377\376"
+ 146      E3FFFEFE 
+ 146      E3FFFEFE 
+ 146      E3FFFE
+ 147 06a5 FEE3FFFE 		.ascii	"\376\343\377\376\376\343\377\376\376\343\377\376\376\343\377"
+ 147      FEE3FFFE 
+ 147      FEE3FFFE 
+ 147      FEE3FF
+ 148 06b4 FEFEE3FF 		.ascii	"\376\376\343\377\376\376\343\377\376\376\343\377\376\376\343"
+ 148      FEFEE3FF 
+ 148      FEFEE3FF 
+ 148      FEFEE3
+ 149 06c3 FFFEFEE3 		.ascii	"\377\376\376\343\377\376\376\343\377\376\376\343\377\376\376"
+ 149      FFFEFEE3 
+ 149      FFFEFEE3 
+ 149      FFFEFE
+ 150 06d2 E3FFFEFE 		.ascii	"\343\377\376\376\343\377\376\376\343\377\376\376\343\377\376"
+ 150      E3FFFEFE 
+ 150      E3FFFEFE 
+ 150      E3FFFE
+ 151 06e1 FEE3FFFE 		.ascii	"\376\343\377\376\376\343\377\376\376\343\377\376\376\344\377"
+ 151      FEE3FFFE 
+ 151      FEE3FFFE 
+ 151      FEE4FF
+ 152 06f0 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 152      FEFEE4FF 
+ 152      FEFEE4FF 
+ 152      FEFEE4
+ 153 06ff FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 153      FFFEFEE4 
+ 153      FFFEFEE4 
+ 153      FFFEFE
+ 154 070e E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 154      E4FFFEFE 
+ 154      E4FFFEFE 
+ 154      E4FFFE
+ 155 071d FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 155      FEE4FFFE 
+ 155      FEE4FFFE 
+ 155      FEE4FF
+ 156 072c FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 156      FEFEE4FF 
+ 156      FEFEE4FF 
+ 156      FEFEE4
+ 157 073b FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 157      FFFEFEE4 
+ 157      FFFEFEE4 
+ 157      FFFEFE
+GAS LISTING /tmp/ccRZCsvR.s 			page 10
+
+
+ 158 074a E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 158      E4FFFEFE 
+ 158      E4FFFEFE 
+ 158      E4FFFE
+ 159 0759 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 159      FEE4FFFE 
+ 159      FEE4FFFE 
+ 159      FEE4FF
+ 160 0768 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 160      FEFEE4FF 
+ 160      FEFEE4FF 
+ 160      FEFEE4
+ 161 0777 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 161      FFFEFEE4 
+ 161      FFFEFEE4 
+ 161      FFFEFE
+ 162 0786 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 162      E4FFFEFE 
+ 162      E4FFFEFE 
+ 162      E4FFFE
+ 163 0795 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 163      FEE4FFFE 
+ 163      FEE4FFFE 
+ 163      FEE4FF
+ 164 07a4 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 164      FEFEE4FF 
+ 164      FEFEE4FF 
+ 164      FEFEE4
+ 165 07b3 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 165      FFFEFEE4 
+ 165      FFFEFEE4 
+ 165      FFFEFE
+ 166 07c2 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 166      E4FFFEFE 
+ 166      E4FFFEFE 
+ 166      E4FF
+ 167 07d0 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 167      FEFEE4FF 
+ 167      FEFEE4FF 
+ 167      FEFEE4
+ 168 07df FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 168      FFFEFEE4 
+ 168      FFFEFEE4 
+ 168      FFFEFE
+ 169 07ee E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 169      E4FFFEFE 
+ 169      E4FFFEFE 
+ 169      E4FFFE
+ 170 07fd FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 170      FEE4FFFE 
+ 170      FEE4FFFE 
+ 170      FEE4FF
+ 171 080c FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 171      FEFEE4FF 
+ 171      FEFEE4FF 
+ 171      FEFEE4
+ 172 081b FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+GAS LISTING /tmp/ccRZCsvR.s 			page 11
+
+
+ 172      FFFEFEE4 
+ 172      FFFEFEE4 
+ 172      FFFEFE
+ 173 082a E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 173      E4FFFEFE 
+ 173      E4FFFEFE 
+ 173      E4FFFE
+ 174 0839 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 174      FEE4FFFE 
+ 174      FEE4FFFE 
+ 174      FEE4FF
+ 175 0848 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 175      FEFEE4FF 
+ 175      FEFEE4FF 
+ 175      FEFEE4
+ 176 0857 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 176      FFFEFEE4 
+ 176      FFFEFEE4 
+ 176      FFFEFE
+ 177 0866 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 177      E4FFFEFE 
+ 177      E4FFFEFE 
+ 177      E4FFFE
+ 178 0875 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 178      FEE4FFFE 
+ 178      FEE4FFFE 
+ 178      FEE4FF
+ 179 0884 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 179      FEFEE4FF 
+ 179      FEFEE4FF 
+ 179      FEFEE4
+ 180 0893 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 180      FFFEFEE4 
+ 180      FFFEFEE4 
+ 180      FFFEFE
+ 181 08a2 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 181      E4FFFEFE 
+ 181      E4FFFEFE 
+ 181      E4FFFE
+ 182 08b1 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 182      FEE4FFFE 
+ 182      FEE4FFFE 
+ 182      FEE4FF
+ 183 08c0 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 183      FEFEE4FF 
+ 183      FEFEE4FF 
+ 183      FEFEE4
+ 184 08cf FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 184      FFFEFEE4 
+ 184      FFFEFEE4 
+ 184      FFFEFE
+ 185 08de E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 185      E4FFFEFE 
+ 185      E4FFFEFE 
+ 185      E4FFFE
+ 186 08ed FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 186      FEE4FFFE 
+GAS LISTING /tmp/ccRZCsvR.s 			page 12
+
+
+ 186      FEE4FFFE 
+ 186      FEE4FF
+ 187 08fc FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 187      FEFEE4FF 
+ 187      FEFEE4FF 
+ 187      FEFEE4
+ 188 090b FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 188      FFFEFEE4 
+ 188      FFFEFEE4 
+ 188      FFFEFE
+ 189 091a E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 189      E4FFFEFE 
+ 189      E4FFFEFE 
+ 189      E4FFFE
+ 190 0929 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 190      FEE4FFFE 
+ 190      FEE4FFFE 
+ 190      FEE4FF
+ 191 0938 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 191      FEFEE4FF 
+ 191      FEFEE4FF 
+ 191      FEFEE4
+ 192 0947 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 192      FFFEFEE4 
+ 192      FFFEFEE4 
+ 192      FFFEFE
+ 193 0956 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 193      E4FFFEFE 
+ 193      E4FFFEFE 
+ 193      E4FFFE
+ 194 0965 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 194      FEE4FFFE 
+ 194      FEE4FFFE 
+ 194      FEE4FF
+ 195 0974 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 195      FEFEE4FF 
+ 195      FEFEE4FF 
+ 195      FEFEE4
+ 196 0983 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 196      FFFEFEE4 
+ 196      FFFEFEE4 
+ 196      FFFEFE
+ 197 0992 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 197      E4FFFEFE 
+ 197      E4FFFEFE 
+ 197      E4FFFE
+ 198 09a1 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 198      FEE4FFFE 
+ 198      FEE4FFFE 
+ 198      FEE4FF
+ 199 09b0 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 199      FEFEE4FF 
+ 199      FEFEE4FF 
+ 199      FEFEE4
+ 200 09bf FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 200      FFFEFEE4 
+ 200      FFFEFEE4 
+GAS LISTING /tmp/ccRZCsvR.s 			page 13
+
+
+ 200      FFFEFE
+ 201 09ce E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 201      E4FFFEFE 
+ 201      E4FFFEFE 
+ 201      E4FFFE
+ 202 09dd FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 202      FEE4FFFE 
+ 202      FEE4FFFE 
+ 202      FEE4FF
+ 203 09ec FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 203      FEFEE4FF 
+ 203      FEFEE4FF 
+ 203      FEFEE4
+ 204 09fb FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 204      FFFEFEE4 
+ 204      FFFEFEE4 
+ 204      FFFEFE
+ 205 0a0a E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 205      E4FFFEFE 
+ 205      E4FFFEFE 
+ 205      E4FFFE
+ 206 0a19 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 206      FEE4FFFE 
+ 206      FEE4FFFE 
+ 206      FEE4FF
+ 207 0a28 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 207      FEFEE4FF 
+ 207      FEFEE4FF 
+ 207      FEFEE4
+ 208 0a37 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 208      FFFEFEE4 
+ 208      FFFEFEE4 
+ 208      FFFEFE
+ 209 0a46 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 209      E4FFFEFE 
+ 209      E4FFFEFE 
+ 209      E4FFFE
+ 210 0a55 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 210      FEE4FFFE 
+ 210      FEE4FFFE 
+ 210      FEE4FF
+ 211 0a64 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 211      FEFEE4FF 
+ 211      FEFEE4FF 
+ 211      FEFEE4
+ 212 0a73 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 212      FFFEFEE4 
+ 212      FFFEFEE4 
+ 212      FFFEFE
+ 213 0a82 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 213      E4FFFEFE 
+ 213      E4FFFEFE 
+ 213      E4FFFE
+ 214 0a91 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 214      FEE4FFFE 
+ 214      FEE4FFFE 
+ 214      FEE4FF
+GAS LISTING /tmp/ccRZCsvR.s 			page 14
+
+
+ 215 0aa0 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 215      FEFEE4FF 
+ 215      FEFEE4FF 
+ 215      FEFEE4
+ 216 0aaf FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 216      FFFEFEE4 
+ 216      FFFEFEE4 
+ 216      FFFEFE
+ 217 0abe E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 217      E4FFFEFE 
+ 217      E4FFFEFE 
+ 217      E4FFFE
+ 218 0acd FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 218      FEE4FFFE 
+ 218      FEE4FFFE 
+ 218      FEE4FF
+ 219 0adc FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 219      FEFEE4FF 
+ 219      FEFEE4FF 
+ 219      FEFEE4
+ 220 0aeb FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 220      FFFEFEE4 
+ 220      FFFEFEE4 
+ 220      FFFEFE
+ 221 0afa E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 221      E4FFFEFE 
+ 221      E4FFFEFE 
+ 221      E4FFFE
+ 222 0b09 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 222      FEE4FFFE 
+ 222      FEE4FFFE 
+ 222      FEE4FF
+ 223 0b18 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 223      FEFEE4FF 
+ 223      FEFEE4FF 
+ 223      FEFEE4
+ 224 0b27 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 224      FFFEFEE4 
+ 224      FFFEFEE4 
+ 224      FFFEFE
+ 225 0b36 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 225      E4FFFEFE 
+ 225      E4FFFEFE 
+ 225      E4FFFE
+ 226 0b45 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 226      FEE4FFFE 
+ 226      FEE4FFFE 
+ 226      FEE4FF
+ 227 0b54 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 227      FEFEE4FF 
+ 227      FEFEE4FF 
+ 227      FEFEE4
+ 228 0b63 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 228      FFFEFEE4 
+ 228      FFFEFEE4 
+ 228      FFFEFE
+ 229 0b72 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+GAS LISTING /tmp/ccRZCsvR.s 			page 15
+
+
+ 229      E4FFFEFE 
+ 229      E4FFFEFE 
+ 229      E4FFFE
+ 230 0b81 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 230      FEE4FFFE 
+ 230      FEE4FFFE 
+ 230      FEE4FF
+ 231 0b90 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 231      FEFEE4FF 
+ 231      FEFEE4FF 
+ 231      FEFEE4
+ 232 0b9f FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 232      FFFEFEE4 
+ 232      FFFEFEE4 
+ 232      FFFEFE
+ 233 0bae E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 233      E4FFFEFE 
+ 233      E4FFFEFE 
+ 233      E4FFFE
+ 234 0bbd FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 234      FEE4FFFE 
+ 234      FEE4FFFE 
+ 234      FEE4FF
+ 235 0bcc FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 235      FEFEE4FF 
+ 235      FEFEE4FF 
+ 235      FEFEE4
+ 236 0bdb FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 236      FFFEFEE4 
+ 236      FFFEFEE4 
+ 236      FFFEFE
+ 237 0bea E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 237      E4FFFEFE 
+ 237      E4FFFEFE 
+ 237      E4FFFE
+ 238 0bf9 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 238      FEE4FFFE 
+ 238      FEE4FFFE 
+ 238      FEE4FF
+ 239 0c08 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 239      FEFEE4FF 
+ 239      FEFEE4FF 
+ 239      FEFEE4
+ 240 0c17 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 240      FFFEFEE4 
+ 240      FFFEFEE4 
+ 240      FFFEFE
+ 241 0c26 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\377\344\377\376\377\344\377\376"
+ 241      E4FFFEFF 
+ 241      E4FFFEFF 
+ 241      E4FFFE
+ 242 0c35 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 242      FFE4FFFE 
+ 242      FFE4FFFE 
+ 242      FFE4FF
+ 243 0c44 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 243      FEFFE4FF 
+GAS LISTING /tmp/ccRZCsvR.s 			page 16
+
+
+ 243      FEFFE4FF 
+ 243      FEFFE4
+ 244 0c53 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 244      FFFEFFE4 
+ 244      FFFEFFE4 
+ 244      FFFEFF
+ 245 0c62 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 245      E4FFFEFF 
+ 245      E4FFFEFF 
+ 245      E4FFFE
+ 246 0c71 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 246      FFE4FFFE 
+ 246      FFE4FFFE 
+ 246      FFE4FF
+ 247 0c80 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 247      FEFFE4FF 
+ 247      FEFFE4FF 
+ 247      FEFFE4
+ 248 0c8f FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 248      FFFEFFE4 
+ 248      FFFEFFE4 
+ 248      FFFEFF
+ 249 0c9e E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 249      E4FFFEFF 
+ 249      E4FFFEFF 
+ 249      E4FFFE
+ 250 0cad FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 250      FFE4FFFE 
+ 250      FFE4FFFE 
+ 250      FFE4FF
+ 251 0cbc FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 251      FEFFE4FF 
+ 251      FEFFE4FF 
+ 251      FEFFE4
+ 252 0ccb FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 252      FFFEFFE4 
+ 252      FFFEFFE4 
+ 252      FFFEFF
+ 253 0cda E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 253      E4FFFEFF 
+ 253      E4FFFEFF 
+ 253      E4FFFE
+ 254 0ce9 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 254      FFE4FFFE 
+ 254      FFE4FFFE 
+ 254      FFE4FF
+ 255 0cf8 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 255      FEFFE4FF 
+ 255      FEFFE4FF 
+ 255      FEFFE4
+ 256 0d07 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 256      FFFEFFE4 
+ 256      FFFEFFE4 
+ 256      FFFEFF
+ 257 0d16 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 257      E4FFFEFF 
+ 257      E4FFFEFF 
+GAS LISTING /tmp/ccRZCsvR.s 			page 17
+
+
+ 257      E4FFFE
+ 258 0d25 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 258      FFE4FFFE 
+ 258      FFE4FFFE 
+ 258      FFE4FF
+ 259 0d34 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 259      FEFFE4FF 
+ 259      FEFFE4FF 
+ 259      FEFFE4
+ 260 0d43 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 260      FFFEFFE4 
+ 260      FFFEFFE4 
+ 260      FFFEFF
+ 261 0d52 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 261      E4FFFEFF 
+ 261      E4FFFEFF 
+ 261      E4FFFE
+ 262 0d61 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 262      FFE4FFFE 
+ 262      FFE4FFFE 
+ 262      FFE4FF
+ 263 0d70 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 263      FEFFE4FF 
+ 263      FEFFE4FF 
+ 263      FEFFE4
+ 264 0d7f FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 264      FFFEFFE4 
+ 264      FFFEFFE4 
+ 264      FFFEFF
+ 265 0d8e E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 265      E4FFFEFF 
+ 265      E4FFFEFF 
+ 265      E4FFFE
+ 266 0d9d FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 266      FFE4FFFE 
+ 266      FFE4FFFE 
+ 266      FFE4FF
+ 267 0dac FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 267      FEFFE4FF 
+ 267      FEFFE4FF 
+ 267      FEFFE4
+ 268 0dbb FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 268      FFFEFFE4 
+ 268      FFFEFFE4 
+ 268      FFFEFF
+ 269 0dca E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 269      E4FFFEFF 
+ 269      E4FFFEFF 
+ 269      E4FFFE
+ 270 0dd9 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 270      FFE4FFFE 
+ 270      FFE4FFFE 
+ 270      FFE4FF
+ 271 0de8 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 271      FEFFE4FF 
+ 271      FEFFE4FF 
+ 271      FEFFE4
+GAS LISTING /tmp/ccRZCsvR.s 			page 18
+
+
+ 272 0df7 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 272      FFFEFFE4 
+ 272      FFFEFFE4 
+ 272      FFFEFF
+ 273 0e06 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 273      E4FFFEFF 
+ 273      E4FFFEFF 
+ 273      E4FFFE
+ 274 0e15 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 274      FFE4FFFE 
+ 274      FFE4FFFE 
+ 274      FFE4FF
+ 275 0e24 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 275      FEFFE4FF 
+ 275      FEFFE4FF 
+ 275      FEFFE4
+ 276 0e33 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 276      FFFEFFE4 
+ 276      FFFEFFE4 
+ 276      FFFEFF
+ 277 0e42 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 277      E4FFFEFF 
+ 277      E4FFFEFF 
+ 277      E4FFFE
+ 278 0e51 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 278      FFE4FFFE 
+ 278      FFE4FFFE 
+ 278      FFE4FF
+ 279 0e60 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 279      FEFFE4FF 
+ 279      FEFFE4FF 
+ 279      FEFFE4
+ 280 0e6f FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 280      FFFEFFE4 
+ 280      FFFEFFE4 
+ 280      FFFEFF
+ 281 0e7e E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 281      E4FFFEFF 
+ 281      E4FFFEFF 
+ 281      E4FFFE
+ 282 0e8d FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 282      FFE4FFFE 
+ 282      FFE4FFFE 
+ 282      FFE4FF
+ 283 0e9c FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 283      FEFFE4FF 
+ 283      FEFFE4FF 
+ 283      FEFFE4
+ 284 0eab FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 284      FFFEFFE4 
+ 284      FFFEFFE4 
+ 284      FFFEFF
+ 285 0eba E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 285      E4FFFEFF 
+ 285      E4FFFEFF 
+ 285      E4FFFE
+ 286 0ec9 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+GAS LISTING /tmp/ccRZCsvR.s 			page 19
+
+
+ 286      FFE4FFFE 
+ 286      FFE4FFFE 
+ 286      FFE4FF
+ 287 0ed8 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 287      FEFFE4FF 
+ 287      FEFFE4FF 
+ 287      FEFFE4
+ 288 0ee7 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 288      FFFEFFE4 
+ 288      FFFEFFE4 
+ 288      FFFEFF
+ 289 0ef6 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 289      E4FFFEFF 
+ 289      E4FFFEFF 
+ 289      E4FFFE
+ 290 0f05 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 290      FFE4FFFE 
+ 290      FFE4FFFE 
+ 290      FFE4FF
+ 291 0f14 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 291      FEFFE4FF 
+ 291      FEFFE4FF 
+ 291      FEFFE4
+ 292 0f23 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 292      FFFEFFE4 
+ 292      FFFEFFE4 
+ 292      FFFEFF
+ 293 0f32 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 293      E4FFFEFF 
+ 293      E4FFFEFF 
+ 293      E4FFFE
+ 294 0f41 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 294      FFE4FFFE 
+ 294      FFE4FFFE 
+ 294      FFE4FF
+ 295 0f50 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 295      FEFFE4FF 
+ 295      FEFFE4FF 
+ 295      FEFFE4
+ 296 0f5f FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 296      FFFEFFE4 
+ 296      FFFEFFE4 
+ 296      FFFEFF
+ 297 0f6e E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 297      E4FFFEFF 
+ 297      E4FFFEFF 
+ 297      E4FFFE
+ 298 0f7d FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 298      FFE4FFFE 
+ 298      FFE4FFFE 
+ 298      FFE4FF
+ 299 0f8c FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 299      FEFFE4FF 
+ 299      FEFFE4FF 
+ 299      FEFFE4
+ 300 0f9b FFFEFFE4 		.ascii	"\377\376\377\344\377"
+ 300      FF
+GAS LISTING /tmp/ccRZCsvR.s 			page 20
+
+
+ 301 0fa0 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 301      FEFFE4FF 
+ 301      FEFFE4FF 
+ 301      FEFFE4
+ 302 0faf FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 302      FFFEFFE4 
+ 302      FFFEFFE4 
+ 302      FFFEFF
+ 303 0fbe E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 303      E4FFFEFF 
+ 303      E4FFFEFF 
+ 303      E4FFFE
+ 304 0fcd FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 304      FFE4FFFE 
+ 304      FFE4FFFE 
+ 304      FFE4FF
+ 305 0fdc FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 305      FEFFE4FF 
+ 305      FEFFE4FF 
+ 305      FEFFE4
+ 306 0feb FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 306      FFFEFFE4 
+ 306      FFFEFFE4 
+ 306      FFFEFF
+ 307 0ffa E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377"
+ 307      E4FFFEFF 
+ 307      E4FF
+ 308              		.globl	heatmap_cs_YlGn_mixed
+ 309              		.section	.data.rel.local
+ 310              		.align 8
+ 311              		.type	heatmap_cs_YlGn_mixed, @object
+ 312              		.size	heatmap_cs_YlGn_mixed, 8
+ 313              	heatmap_cs_YlGn_mixed:
+ 314 0008 00000000 		.quad	mixed
+ 314      00000000 
+ 315              		.section	.data.rel.ro.local
+ 316              		.align 16
+ 317              		.type	mixed, @object
+ 318              		.size	mixed, 16
+ 319              	mixed:
+ 320 0010 00000000 		.quad	mixed_data
+ 320      00000000 
+ 321 0018 01040000 		.quad	1025
+ 321      00000000 
+ 322              		.section	.rodata
+ 323 1004 00000000 		.align 32
+ 323      00000000 
+ 323      00000000 
+ 323      00000000 
+ 323      00000000 
+ 324              		.type	mixed_data, @object
+ 325              		.size	mixed_data, 4100
+ 326              	mixed_data:
+ 327 1020 00       		.string	""
+ 328 1021 00       		.string	""
+ 329 1022 00       		.string	""
+ 330 1023 00       		.string	""
+GAS LISTING /tmp/ccRZCsvR.s 			page 21
+
+
+ 331 1024 00       		.string	""
+ 332 1025 452800   		.string	"E("
+ 333 1028 00       		.string	""
+ 334 1029 45290700 		.string	"E)\007"
+ 335 102d 45290E00 		.string	"E)\016"
+ 336 1031 45291600 		.string	"E)\026"
+ 337 1035 45291D00 		.string	"E)\035"
+ 338 1039 46292500 		.string	"F)%"
+ 339 103d 46292C00 		.string	"F),"
+ 340 1041 46293400 		.string	"F)4"
+ 341 1045 46293B00 		.string	"F);"
+ 342 1049 46294300 		.string	"F)C"
+ 343 104d 47294A00 		.string	"G)J"
+ 344 1051 472A5200 		.string	"G*R"
+ 345 1055 472A5900 		.string	"G*Y"
+ 346 1059 472A6100 		.string	"G*a"
+ 347 105d 472A6800 		.string	"G*h"
+ 348 1061 482A7000 		.string	"H*p"
+ 349 1065 482A7700 		.string	"H*w"
+ 350 1069 482A7F00 		.string	"H*\177"
+ 351 106d 482A8600 		.string	"H*\206"
+ 352 1071 492A8D00 		.string	"I*\215"
+ 353 1075 492A9500 		.string	"I*\225"
+ 354 1079 492B9C00 		.string	"I+\234"
+ 355 107d 492BA400 		.string	"I+\244"
+ 356 1081 492BAB00 		.string	"I+\253"
+ 357 1085 4A2BB300 		.string	"J+\263"
+ 358 1089 4A2BBA00 		.string	"J+\272"
+ 359 108d 4A2BC200 		.string	"J+\302"
+ 360 1091 4A2BC900 		.string	"J+\311"
+ 361 1095 4A2BD100 		.string	"J+\321"
+ 362 1099 4B2BD800 		.string	"K+\330"
+ 363 109d 4B2BE000 		.string	"K+\340"
+ 364 10a1 4B2BE700 		.string	"K+\347"
+ 365 10a5 4B2CEF00 		.string	"K,\357"
+ 366 10a9 4C2CF600 		.string	"L,\366"
+ 367 10ad 4C2CFE00 		.string	"L,\376"
+ 368 10b1 4C2CFF00 		.string	"L,\377"
+ 369 10b5 4C2CFF00 		.string	"L,\377"
+ 370 10b9 4C2CFF00 		.string	"L,\377"
+ 371 10bd 4D2CFF00 		.string	"M,\377"
+ 372 10c1 4D2CFF00 		.string	"M,\377"
+ 373 10c5 4D2CFF00 		.string	"M,\377"
+ 374 10c9 4D2CFF00 		.string	"M,\377"
+ 375 10cd 4E2CFF00 		.string	"N,\377"
+ 376 10d1 4E2DFF00 		.string	"N-\377"
+ 377 10d5 4E2DFF00 		.string	"N-\377"
+ 378 10d9 4E2DFF00 		.string	"N-\377"
+ 379 10dd 4E2DFF00 		.string	"N-\377"
+ 380 10e1 4F2DFF00 		.string	"O-\377"
+ 381 10e5 4F2DFF00 		.string	"O-\377"
+ 382 10e9 4F2DFF00 		.string	"O-\377"
+ 383 10ed 4F2DFF00 		.string	"O-\377"
+ 384 10f1 4F2DFF00 		.string	"O-\377"
+ 385 10f5 502DFF00 		.string	"P-\377"
+ 386 10f9 502DFF00 		.string	"P-\377"
+ 387 10fd 502EFF00 		.string	"P.\377"
+GAS LISTING /tmp/ccRZCsvR.s 			page 22
+
+
+ 388 1101 502EFF00 		.string	"P.\377"
+ 389 1105 512EFF00 		.string	"Q.\377"
+ 390 1109 512EFF00 		.string	"Q.\377"
+ 391 110d 512EFF00 		.string	"Q.\377"
+ 392 1111 512EFF00 		.string	"Q.\377"
+ 393 1115 512EFF00 		.string	"Q.\377"
+ 394 1119 522EFF00 		.string	"R.\377"
+ 395 111d 522EFF00 		.string	"R.\377"
+ 396 1121 522EFF00 		.string	"R.\377"
+ 397 1125 5931FF00 		.string	"Y1\377"
+ 398 1129 5A31FF00 		.string	"Z1\377"
+ 399 112d 5A31FF00 		.string	"Z1\377"
+ 400 1131 5A31FF00 		.string	"Z1\377"
+ 401 1135 5A32FF00 		.string	"Z2\377"
+ 402 1139 5A32FF00 		.string	"Z2\377"
+ 403 113d 5B32FF00 		.string	"[2\377"
+ 404 1141 5B32FF00 		.string	"[2\377"
+ 405 1145 5B32FF00 		.string	"[2\377"
+ 406 1149 5B32FF00 		.string	"[2\377"
+ 407 114d 5B32FF00 		.string	"[2\377"
+ 408 1151 5C32FF00 		.string	"\\2\377"
+ 409 1155 5C32FF00 		.string	"\\2\377"
+ 410 1159 5C32FF00 		.string	"\\2\377"
+ 411 115d 5C32FF00 		.string	"\\2\377"
+ 412 1161 5D33FF00 		.string	"]3\377"
+ 413 1165 5D33FF00 		.string	"]3\377"
+ 414 1169 5D33FF00 		.string	"]3\377"
+ 415 116d 5D33FF00 		.string	"]3\377"
+ 416 1171 5D33FF00 		.string	"]3\377"
+ 417 1175 5E33FF00 		.string	"^3\377"
+ 418 1179 5E33FF00 		.string	"^3\377"
+ 419 117d 5E33FF00 		.string	"^3\377"
+ 420 1181 5E33FF00 		.string	"^3\377"
+ 421 1185 5F33FF00 		.string	"_3\377"
+ 422 1189 5F33FF00 		.string	"_3\377"
+ 423 118d 5F33FF00 		.string	"_3\377"
+ 424 1191 5F34FF00 		.string	"_4\377"
+ 425 1195 5F34FF00 		.string	"_4\377"
+ 426 1199 6034FF00 		.string	"`4\377"
+ 427 119d 6034FF00 		.string	"`4\377"
+ 428 11a1 6034FF00 		.string	"`4\377"
+ 429 11a5 6034FF00 		.string	"`4\377"
+ 430 11a9 6134FF00 		.string	"a4\377"
+ 431 11ad 6134FF00 		.string	"a4\377"
+ 432 11b1 6134FF00 		.string	"a4\377"
+ 433 11b5 6134FF00 		.string	"a4\377"
+ 434 11b9 6134FF00 		.string	"a4\377"
+ 435 11bd 6234FF00 		.string	"b4\377"
+ 436 11c1 6235FF00 		.string	"b5\377"
+ 437 11c5 6235FF00 		.string	"b5\377"
+ 438 11c9 6235FF00 		.string	"b5\377"
+ 439 11cd 6335FF00 		.string	"c5\377"
+ 440 11d1 6335FF00 		.string	"c5\377"
+ 441 11d5 6335FF00 		.string	"c5\377"
+ 442 11d9 6335FF00 		.string	"c5\377"
+ 443 11dd 6335FF00 		.string	"c5\377"
+ 444 11e1 6435FF00 		.string	"d5\377"
+GAS LISTING /tmp/ccRZCsvR.s 			page 23
+
+
+ 445 11e5 6435FF00 		.string	"d5\377"
+ 446 11e9 6435FF00 		.string	"d5\377"
+ 447 11ed 6435FF00 		.string	"d5\377"
+ 448 11f1 6535FF00 		.string	"e5\377"
+ 449 11f5 6536FF00 		.string	"e6\377"
+ 450 11f9 6536FF00 		.string	"e6\377"
+ 451 11fd 6536FF00 		.string	"e6\377"
+ 452 1201 6536FF00 		.string	"e6\377"
+ 453 1205 6636FF00 		.string	"f6\377"
+ 454 1209 6636FF00 		.string	"f6\377"
+ 455 120d 6636FF00 		.string	"f6\377"
+ 456 1211 6636FF00 		.string	"f6\377"
+ 457 1215 6736FF00 		.string	"g6\377"
+ 458 1219 6736FF00 		.string	"g6\377"
+ 459 121d 6736FF00 		.string	"g6\377"
+ 460 1221 6736FF00 		.string	"g6\377"
+ 461 1225 6836FF00 		.string	"h6\377"
+ 462 1229 6837FF00 		.string	"h7\377"
+ 463 122d 6837FF00 		.string	"h7\377"
+ 464 1231 6837FF00 		.string	"h7\377"
+ 465 1235 6837FF01 		.ascii	"h7\377\001h7\377\001i7\377\001i7\377\001i7\377\001i7\377\002"
+ 465      6837FF01 
+ 465      6937FF01 
+ 465      6937FF01 
+ 465      6937FF01 
+ 466 124d 6937FF02 		.ascii	"i7\377\002i7\377\002j7\377\002j8\377\003j8\377\003j8\377\003"
+ 466      6937FF02 
+ 466      6A37FF02 
+ 466      6A38FF03 
+ 466      6A38FF03 
+ 467 1265 6A38FF03 		.ascii	"j8\377\003j8\377\004k8\377\004k8\377\004k8\377\004k8\377\005"
+ 467      6A38FF04 
+ 467      6B38FF04 
+ 467      6B38FF04 
+ 467      6B38FF04 
+ 468 127d 6B38FF05 		.ascii	"k8\377\005k8\377\005l8\377\005l8\377\006l9\377\006l9\377\006"
+ 468      6B38FF05 
+ 468      6C38FF05 
+ 468      6C38FF06 
+ 468      6C39FF06 
+ 469 1295 6C39FF06 		.ascii	"l9\377\006m9\377\007m9\377\007m9\377\007m9\377\007m9\377\bm9"
+ 469      6D39FF07 
+ 469      6D39FF07 
+ 469      6D39FF07 
+ 469      6D39FF07 
+ 470 12af FF086E39 		.ascii	"\377\bn9\377\bn9\377\tn9\377\tn9\377\tn:\377\tn:\377\no:\377"
+ 470      FF086E39 
+ 470      FF096E39 
+ 470      FF096E39 
+ 470      FF096E3A 
+ 471 12cc 0A6F3AFF 		.ascii	"\no:\377\no:\377\no:\377\013o:\377\013o:\377\013p:\377\013p:"
+ 471      0A6F3AFF 
+ 471      0A6F3AFF 
+ 471      0B6F3AFF 
+ 471      0B6F3AFF 
+ 472 12e7 FF0C703A 		.ascii	"\377\fp:\377\fp:\377\fp:\377\fq;\377\fq;\377\rq;\377\rq;\377"
+ 472      FF0C703A 
+GAS LISTING /tmp/ccRZCsvR.s 			page 24
+
+
+ 472      FF0C703A 
+ 472      FF0C713B 
+ 472      FF0C713B 
+ 473 1304 0D713BFF 		.ascii	"\rq;\377\rq;\377\016r;\377\016r;\377\016r;\377\016r;\377\016"
+ 473      0D713BFF 
+ 473      0E723BFF 
+ 473      0E723BFF 
+ 473      0E723BFF 
+ 474 131d 723BFF0F 		.ascii	"r;\377\017r;\377\026x>\377\026x>\377\026y>\377\027y>\377\027"
+ 474      723BFF16 
+ 474      783EFF16 
+ 474      783EFF16 
+ 474      793EFF17 
+ 475 1335 793EFF17 		.ascii	"y>\377\027y>\377\027y>\377\027y>\377\030z>\377\030z>\377\030"
+ 475      793EFF17 
+ 475      793EFF17 
+ 475      793EFF18 
+ 475      7A3EFF18 
+ 476 134d 7A3FFF18 		.ascii	"z?\377\030z?\377\030z?\377\031z?\377\031{?\377\031{?\377\031"
+ 476      7A3FFF18 
+ 476      7A3FFF19 
+ 476      7A3FFF19 
+ 476      7B3FFF19 
+ 477 1365 7B3FFF19 		.ascii	"{?\377\031{?\377\032{?\377\032|?\377\032|?\377\032|?\377\032"
+ 477      7B3FFF1A 
+ 477      7B3FFF1A 
+ 477      7C3FFF1A 
+ 477      7C3FFF1A 
+ 478 137d 7C3FFF1B 		.ascii	"|?\377\033|@\377\033|@\377\033}@\377\033}@\377\033}@\377\034"
+ 478      7C40FF1B 
+ 478      7C40FF1B 
+ 478      7D40FF1B 
+ 478      7D40FF1B 
+ 479 1395 7D40FF1C 		.ascii	"}@\377\034}@\377\034}@\377\034~@\377\034~@\377\035~@\377\035"
+ 479      7D40FF1C 
+ 479      7D40FF1C 
+ 479      7E40FF1C 
+ 479      7E40FF1D 
+ 480 13ad 7E40FF1D 		.ascii	"~@\377\035~@\377\035\177@\377\035\177A\377\036\177A\377\036\177"
+ 480      7E40FF1D 
+ 480      7F40FF1D 
+ 480      7F41FF1E 
+ 480      7F41FF1E 
+ 481 13c2 41FF1E7F 		.ascii	"A\377\036\177A\377\036\177A\377\036\200A\377\037\200A\377\037"
+ 481      41FF1E7F 
+ 481      41FF1E80 
+ 481      41FF1F80 
+ 481      41FF1F
+ 482 13d5 8041FF1F 		.ascii	"\200A\377\037\200A\377\037\200A\377\037\200A\377\037\201A\377"
+ 482      8041FF1F 
+ 482      8041FF1F 
+ 482      8041FF1F 
+ 482      8141FF
+ 483 13e8 208141FF 		.ascii	" \201A\377 \201A\377 \201B\377 \201B\377 \202B\377!\202B\377"
+ 483      208141FF 
+ 483      208142FF 
+ 483      208142FF 
+GAS LISTING /tmp/ccRZCsvR.s 			page 25
+
+
+ 483      208242FF 
+ 484 1400 218242FF 		.ascii	"!\202B\377!\202B\377!\202B\377!\202B\377\"\203B\377\"\203B\377"
+ 484      218242FF 
+ 484      218242FF 
+ 484      218242FF 
+ 484      228342FF 
+ 485 1418 228342FF 		.ascii	"\"\203B\377\"\203B\377\"\203B\377#\204B\377#\204C\377#\204C\377"
+ 485      228342FF 
+ 485      228342FF 
+ 485      238442FF 
+ 485      238443FF 
+ 486 1430 238443FF 		.ascii	"#\204C\377#\204C\377#\205C\377$\205C\377$\205D\377$\205D\377"
+ 486      238443FF 
+ 486      238543FF 
+ 486      248543FF 
+ 486      248544FF 
+ 487 1448 248644FF 		.ascii	"$\206D\377$\206D\377%\206D\377%\206D\377%\207E\377%\207E\377"
+ 487      248644FF 
+ 487      258644FF 
+ 487      258644FF 
+ 487      258745FF 
+ 488 1460 258745FF 		.ascii	"%\207E\377&\207E\377&\210E\377&\210E\377&\210F\377&\210F\377"
+ 488      268745FF 
+ 488      268845FF 
+ 488      268845FF 
+ 488      268846FF 
+ 489 1478 278946FF 		.ascii	"'\211F\377'\211F\377'\211F\377'\211F\377'\211F\377'\212G\377"
+ 489      278946FF 
+ 489      278946FF 
+ 489      278946FF 
+ 489      278946FF 
+ 490 1490 288A47FF 		.ascii	"(\212G\377(\212G\377(\212G\377(\213G\377(\213G\377)\213H\377"
+ 490      288A47FF 
+ 490      288A47FF 
+ 490      288B47FF 
+ 490      288B47FF 
+ 491 14a8 298B48FF 		.ascii	")\213H\377)\214H\377)\214H\377)\214H\377*\214H\377*\215I\377"
+ 491      298C48FF 
+ 491      298C48FF 
+ 491      298C48FF 
+ 491      2A8C48FF 
+ 492 14c0 2A8D49FF 		.ascii	"*\215I\377*\215I\377*\215I\377+\216I\377+\216I\377+\216J\377"
+ 492      2A8D49FF 
+ 492      2A8D49FF 
+ 492      2B8E49FF 
+ 492      2B8E49FF 
+ 493 14d8 2B8E4AFF 		.ascii	"+\216J\377+\217J\377+\217J\377,\217J\377,\217J\377,\220K\377"
+ 493      2B8F4AFF 
+ 493      2B8F4AFF 
+ 493      2C8F4AFF 
+ 493      2C8F4AFF 
+ 494 14f0 2C904BFF 		.ascii	",\220K\377,\220K\377-\220K\377-\220K\377-\221K\377-\221K\377"
+ 494      2C904BFF 
+ 494      2D904BFF 
+ 494      2D904BFF 
+ 494      2D914BFF 
+ 495 1508 2D914CFF 		.ascii	"-\221L\377.\221L\377.\222L\377.\222L\377.\222L\377.\222L\377"
+GAS LISTING /tmp/ccRZCsvR.s 			page 26
+
+
+ 495      2E914CFF 
+ 495      2E924CFF 
+ 495      2E924CFF 
+ 495      2E924CFF 
+ 496 1520 2E934DFF 		.ascii	".\223M\3775\233R\3775\233R\3775\233R\3775\233R\3775\234S\377"
+ 496      359B52FF 
+ 496      359B52FF 
+ 496      359B52FF 
+ 496      359B52FF 
+ 497 1538 369C53FF 		.ascii	"6\234S\3776\234S\3776\234S\3776\235S\3776\235S\3776\235T\377"
+ 497      369C53FF 
+ 497      369C53FF 
+ 497      369D53FF 
+ 497      369D53FF 
+ 498 1550 379D54FF 		.ascii	"7\235T\3777\236T\3777\236T\3777\236T\3777\236T\3778\237U\377"
+ 498      379E54FF 
+ 498      379E54FF 
+ 498      379E54FF 
+ 498      379E54FF 
+ 499 1568 389F55FF 		.ascii	"8\237U\3778\237U\3778\237U\3778\240U\3779\240U\3779\240V\377"
+ 499      389F55FF 
+ 499      389F55FF 
+ 499      38A055FF 
+ 499      39A055FF 
+ 500 1580 39A056FF 		.ascii	"9\240V\3779\241V\3779\241V\3779\241V\377:\241V\377:\242W\377"
+ 500      39A156FF 
+ 500      39A156FF 
+ 500      39A156FF 
+ 500      3AA156FF 
+ 501 1598 3AA257FF 		.ascii	":\242W\377:\242W\377:\242W\377;\243W\377;\243W\377;\243X\377"
+ 501      3AA257FF 
+ 501      3AA257FF 
+ 501      3BA357FF 
+ 501      3BA357FF 
+ 502 15b0 3BA358FF 		.ascii	";\243X\377;\244X\377<\244X\377<\244X\377<\244X\377<\245Y\377"
+ 502      3BA458FF 
+ 502      3CA458FF 
+ 502      3CA458FF 
+ 502      3CA458FF 
+ 503 15c8 3CA559FF 		.ascii	"<\245Y\377<\245Y\377=\245Y\377=\246Y\377=\246Y\377=\246Z\377"
+ 503      3CA559FF 
+ 503      3DA559FF 
+ 503      3DA659FF 
+ 503      3DA659FF 
+ 504 15e0 3DA65AFF 		.ascii	"=\246Z\377>\247Z\377>\247Z\377>\247Z\377>\247Z\377>\250[\377"
+ 504      3EA75AFF 
+ 504      3EA75AFF 
+ 504      3EA75AFF 
+ 504      3EA75AFF 
+ 505 15f8 3EA85BFF 		.ascii	">\250[\377?\250[\377?\250[\377?\251[\377?\251[\377?\251\\\377"
+ 505      3FA85BFF 
+ 505      3FA85BFF 
+ 505      3FA95BFF 
+ 505      3FA95BFF 
+ 506 1610 40A95CFF 		.ascii	"@\251\\\377@\252\\\377@\252\\\377@\252\\\377@\252\\\377A\253"
+ 506      40AA5CFF 
+ 506      40AA5CFF 
+GAS LISTING /tmp/ccRZCsvR.s 			page 27
+
+
+ 506      40AA5CFF 
+ 506      40AA5CFF 
+ 507 1626 5CFF41AB 		.ascii	"\\\377A\253]\377A\253]\377B\253]\377B\253]\377C\253]\377C\254"
+ 507      5DFF41AB 
+ 507      5DFF42AB 
+ 507      5DFF42AB 
+ 507      5DFF43AB 
+ 508 163e 5DFF43AC 		.ascii	"]\377C\254^\377D\254^\377D\254^\377E\254^\377E\254^\377E\255"
+ 508      5EFF44AC 
+ 508      5EFF44AC 
+ 508      5EFF45AC 
+ 508      5EFF45AC 
+ 509 1656 5EFF46AD 		.ascii	"^\377F\255_\377F\255_\377F\255_\377G\255_\377G\255_\377H\256"
+ 509      5FFF46AD 
+ 509      5FFF46AD 
+ 509      5FFF47AD 
+ 509      5FFF47AD 
+ 510 166e 5FFF48AE 		.ascii	"_\377H\256`\377H\256`\377I\256`\377I\256`\377I\256`\377J\257"
+ 510      60FF48AE 
+ 510      60FF49AE 
+ 510      60FF49AE 
+ 510      60FF49AE 
+ 511 1686 61FF4AAF 		.ascii	"a\377J\257a\377K\257a\377K\257a\377K\257a\377L\257a\377L\260"
+ 511      61FF4BAF 
+ 511      61FF4BAF 
+ 511      61FF4BAF 
+ 511      61FF4CAF 
+ 512 169e 62FF4CB0 		.ascii	"b\377L\260b\377M\260b\377M\260b\377N\260b\377N\260b\377N\261"
+ 512      62FF4DB0 
+ 512      62FF4DB0 
+ 512      62FF4EB0 
+ 512      62FF4EB0 
+ 513 16b6 63FF4FB1 		.ascii	"c\377O\261c\377O\261c\377O\261c\377P\261c\377P\261c\377P\262"
+ 513      63FF4FB1 
+ 513      63FF4FB1 
+ 513      63FF50B1 
+ 513      63FF50B1 
+ 514 16ce 64FF51B2 		.ascii	"d\377Q\262d\377Q\262d\377Q\262d\377R\262d\377R\262d\377R\263"
+ 514      64FF51B2 
+ 514      64FF51B2 
+ 514      64FF52B2 
+ 514      64FF52B2 
+ 515 16e6 65FF53B3 		.ascii	"e\377S\263e\377S\263e\377T\263e\377T\263e\377T\263e\377U\264"
+ 515      65FF53B3 
+ 515      65FF54B3 
+ 515      65FF54B3 
+ 515      65FF54B3 
+ 516 16fe 66FF55B4 		.ascii	"f\377U\264f\377U\264f\377V\264f\377V\264f\377V\264g\377W\265"
+ 516      66FF55B4 
+ 516      66FF56B4 
+ 516      66FF56B4 
+ 516      66FF56B4 
+ 517 1716 67FF57B5 		.ascii	"g\377W\265g\377W\265g\377X\265g\377c\273m\377c\273m\377d\273"
+ 517      67FF57B5 
+ 517      67FF58B5 
+ 517      67FF63BB 
+ 517      6DFF63BB 
+GAS LISTING /tmp/ccRZCsvR.s 			page 28
+
+
+ 518 172e 6DFF64BB 		.ascii	"m\377d\273n\377d\273n\377e\274n\377e\274n\377e\274n\377f\274"
+ 518      6EFF64BB 
+ 518      6EFF65BC 
+ 518      6EFF65BC 
+ 518      6EFF65BC 
+ 519 1746 6EFF66BC 		.ascii	"n\377f\274o\377f\274o\377g\275o\377g\275o\377g\275o\377h\275"
+ 519      6FFF66BC 
+ 519      6FFF67BD 
+ 519      6FFF67BD 
+ 519      6FFF67BD 
+ 520 175e 6FFF68BD 		.ascii	"o\377h\275p\377h\275p\377i\276p\377i\276p\377i\276p\377j\276"
+ 520      70FF68BD 
+ 520      70FF69BE 
+ 520      70FF69BE 
+ 520      70FF69BE 
+ 521 1776 71FF6ABE 		.ascii	"q\377j\276q\377j\276q\377k\277q\377k\277q\377k\277q\377l\277"
+ 521      71FF6ABE 
+ 521      71FF6BBF 
+ 521      71FF6BBF 
+ 521      71FF6BBF 
+ 522 178e 72FF6CBF 		.ascii	"r\377l\277r\377l\277r\377l\300r\377m\300r\377m\300r\377m\300"
+ 522      72FF6CBF 
+ 522      72FF6CC0 
+ 522      72FF6DC0 
+ 522      72FF6DC0 
+ 523 17a6 73FF6EC0 		.ascii	"s\377n\300s\377n\300s\377n\301s\377o\301s\377o\301t\377o\301"
+ 523      73FF6EC0 
+ 523      73FF6EC1 
+ 523      73FF6FC1 
+ 523      73FF6FC1 
+ 524 17be 74FF70C1 		.ascii	"t\377p\301t\377p\301t\377p\302t\377q\302t\377q\302u\377q\302"
+ 524      74FF70C1 
+ 524      74FF70C2 
+ 524      74FF71C2 
+ 524      74FF71C2 
+ 525 17d6 75FF72C2 		.ascii	"u\377r\302u\377r\302u\377r\303u\377s\303v\377s\303v\377s\303"
+ 525      75FF72C2 
+ 525      75FF72C3 
+ 525      75FF73C3 
+ 525      76FF73C3 
+ 526 17ee 76FF     		.ascii	"v\377"
+ 527 17f0 73C376FF 		.ascii	"s\303v\377t\303v\377t\304v\377t\304w\377u\304w\377u\304w\377"
+ 527      74C376FF 
+ 527      74C476FF 
+ 527      74C477FF 
+ 527      75C477FF 
+ 528 1808 75C477FF 		.ascii	"u\304w\377v\304w\377v\305x\377v\305x\377w\305x\377w\305x\377"
+ 528      76C477FF 
+ 528      76C578FF 
+ 528      76C578FF 
+ 528      77C578FF 
+ 529 1820 77C578FF 		.ascii	"w\305x\377w\306x\377x\306y\377x\306y\377y\306y\377y\306y\377"
+ 529      77C678FF 
+ 529      78C679FF 
+ 529      78C679FF 
+ 529      79C679FF 
+ 530 1838 79C679FF 		.ascii	"y\306y\377z\306y\377z\307y\377z\307y\377{\307z\377{\307z\377"
+GAS LISTING /tmp/ccRZCsvR.s 			page 29
+
+
+ 530      7AC679FF 
+ 530      7AC779FF 
+ 530      7AC779FF 
+ 530      7BC77AFF 
+ 531 1850 7BC77AFF 		.ascii	"{\307z\377|\307z\377|\307z\377|\310z\377}\310z\377}\310z\377"
+ 531      7CC77AFF 
+ 531      7CC77AFF 
+ 531      7CC87AFF 
+ 531      7DC87AFF 
+ 532 1868 7DC87AFF 		.ascii	"}\310z\377~\310{\377~\310{\377\177\310{\377\177\311{\377\177"
+ 532      7EC87BFF 
+ 532      7EC87BFF 
+ 532      7FC87BFF 
+ 532      7FC97BFF 
+ 533 187d C97BFF80 		.ascii	"\311{\377\200\311{\377\200\311{\377\200\311{\377\201\311|\377"
+ 533      C97BFF80 
+ 533      C97BFF80 
+ 533      C97BFF81 
+ 533      C97CFF
+ 534 1890 81C97CFF 		.ascii	"\201\311|\377\201\312|\377\202\312|\377\202\312|\377\202\312"
+ 534      81CA7CFF 
+ 534      82CA7CFF 
+ 534      82CA7CFF 
+ 534      82CA
+ 535 18a2 7CFF83CA 		.ascii	"|\377\203\312|\377\203\312|\377\203\312}\377\204\313}\377\204"
+ 535      7CFF83CA 
+ 535      7CFF83CA 
+ 535      7DFF84CB 
+ 535      7DFF84
+ 536 18b5 CB7DFF84 		.ascii	"\313}\377\204\313}\377\205\313}\377\205\313}\377\205\313}\377"
+ 536      CB7DFF85 
+ 536      CB7DFF85 
+ 536      CB7DFF85 
+ 536      CB7DFF
+ 537 18c8 86CB7DFF 		.ascii	"\206\313}\377\206\314~\377\206\314~\377\207\314~\377\207\314"
+ 537      86CC7EFF 
+ 537      86CC7EFF 
+ 537      87CC7EFF 
+ 537      87CC
+ 538 18da 7EFF87CC 		.ascii	"~\377\207\314~\377\210\314~\377\210\314~\377\210\315~\377\211"
+ 538      7EFF88CC 
+ 538      7EFF88CC 
+ 538      7EFF88CD 
+ 538      7EFF89
+ 539 18ed CD7FFF89 		.ascii	"\315\177\377\211\315\177\377\211\315\177\377\212\315\177\377"
+ 539      CD7FFF89 
+ 539      CD7FFF8A 
+ 539      CD7FFF
+ 540 18fc 8ACD7FFF 		.ascii	"\212\315\177\377\212\315\177\377\213\316\177\377\213\316\177"
+ 540      8ACD7FFF 
+ 540      8BCE7FFF 
+ 540      8BCE7F
+ 541 190b FF8BCE80 		.ascii	"\377\213\316\200\377\214\316\200\377\214\316\200\377\214\316"
+ 541      FF8CCE80 
+ 541      FF8CCE80 
+ 541      FF8CCE
+ 542 191a 80FF8DCE 		.ascii	"\200\377\215\316\200\377\215\317\200\377\230\323\205\377\230"
+GAS LISTING /tmp/ccRZCsvR.s 			page 30
+
+
+ 542      80FF8DCF 
+ 542      80FF98D3 
+ 542      85FF98
+ 543 1929 D385FF99 		.ascii	"\323\205\377\231\324\205\377\231\324\205\377\231\324\205\377"
+ 543      D485FF99 
+ 543      D485FF99 
+ 543      D485FF
+ 544 1938 9AD485FF 		.ascii	"\232\324\205\377\232\324\205\377\232\324\205\377\233\324\206"
+ 544      9AD485FF 
+ 544      9AD485FF 
+ 544      9BD486
+ 545 1947 FF9BD586 		.ascii	"\377\233\325\206\377\233\325\206\377\234\325\206\377\234\325"
+ 545      FF9BD586 
+ 545      FF9CD586 
+ 545      FF9CD5
+ 546 1956 86FF9CD5 		.ascii	"\206\377\234\325\206\377\235\325\206\377\235\325\207\377\235"
+ 546      86FF9DD5 
+ 546      86FF9DD5 
+ 546      87FF9D
+ 547 1965 D687FF9E 		.ascii	"\326\207\377\236\326\207\377\236\326\207\377\236\326\207\377"
+ 547      D687FF9E 
+ 547      D687FF9E 
+ 547      D687FF
+ 548 1974 9FD687FF 		.ascii	"\237\326\207\377\237\326\207\377\237\326\207\377\237\327\210"
+ 548      9FD687FF 
+ 548      9FD687FF 
+ 548      9FD788
+ 549 1983 FFA0D788 		.ascii	"\377\240\327\210\377\240\327\210\377\240\327\210\377\241\327"
+ 549      FFA0D788 
+ 549      FFA0D788 
+ 549      FFA1D7
+ 550 1992 88FFA1D7 		.ascii	"\210\377\241\327\210\377\241\327\210\377\242\330\211\377\242"
+ 550      88FFA1D7 
+ 550      88FFA2D8 
+ 550      89FFA2
+ 551 19a1 D889FFA2 		.ascii	"\330\211\377\242\330\211\377\243\330\211\377\243\330\211\377"
+ 551      D889FFA3 
+ 551      D889FFA3 
+ 551      D889FF
+ 552 19b0 A3D889FF 		.ascii	"\243\330\211\377\244\330\211\377\244\331\212\377\244\331\212"
+ 552      A4D889FF 
+ 552      A4D98AFF 
+ 552      A4D98A
+ 553 19bf FFA5D98A 		.ascii	"\377\245\331\212\377\245\331\212\377\245\331\212\377\246\331"
+ 553      FFA5D98A 
+ 553      FFA5D98A 
+ 553      FFA6D9
+ 554 19ce 8AFFA6D9 		.ascii	"\212\377\246\331\212\377\246\332\213\377\247\332\213\377\247"
+ 554      8AFFA6DA 
+ 554      8BFFA7DA 
+ 554      8BFFA7
+ 555 19dd DA8BFFA7 		.ascii	"\332\213\377\247\332\213\377\247\332\213\377\250\332\213\377"
+ 555      DA8BFFA7 
+ 555      DA8BFFA8 
+ 555      DA8BFF
+ 556 19ec A8DA8BFF 		.ascii	"\250\332\213\377\250\333\214\377\251\333\214\377\251\333\214"
+ 556      A8DB8CFF 
+GAS LISTING /tmp/ccRZCsvR.s 			page 31
+
+
+ 556      A9DB8CFF 
+ 556      A9DB8C
+ 557 19fb FFA9DB8C 		.ascii	"\377\251\333\214\377\252\333\214\377\252\333\214\377\252\333"
+ 557      FFAADB8C 
+ 557      FFAADB8C 
+ 557      FFAADB
+ 558 1a0a 8CFFABDC 		.ascii	"\214\377\253\334\215\377\253\334\215\377\253\334\215\377\254"
+ 558      8DFFABDC 
+ 558      8DFFABDC 
+ 558      8DFFAC
+ 559 1a19 DC8DFFAC 		.ascii	"\334\215\377\254\334\215\377\254\334\215\377\254\335\215\377"
+ 559      DC8DFFAC 
+ 559      DC8DFFAC 
+ 559      DD8DFF
+ 560 1a28 ADDD8EFF 		.ascii	"\255\335\216\377\255\335\216\377\255\335\216\377\256\335\216"
+ 560      ADDD8EFF 
+ 560      ADDD8EFF 
+ 560      AEDD8E
+ 561 1a37 FFAEDD8E 		.ascii	"\377\256\335\216\377\256\335\216\377\257\335\216\377\257\335"
+ 561      FFAEDD8E 
+ 561      FFAFDD8E 
+ 561      FFAFDD
+ 562 1a46 8EFFAFDE 		.ascii	"\216\377\257\336\217\377\257\336\217\377\260\336\217\377\260"
+ 562      8FFFAFDE 
+ 562      8FFFB0DE 
+ 562      8FFFB0
+ 563 1a55 DE8FFFB0 		.ascii	"\336\217\377\260\336\217\377\261\336\217\377\261\336\217\377"
+ 563      DE8FFFB1 
+ 563      DE8FFFB1 
+ 563      DE8FFF
+ 564 1a64 B1DE8FFF 		.ascii	"\261\336\217\377\261\337\217\377\262\337\220\377\262\337\220"
+ 564      B1DF8FFF 
+ 564      B2DF90FF 
+ 564      B2DF90
+ 565 1a73 FFB2DF90 		.ascii	"\377\262\337\220\377\262\337\220\377\263\337\220\377\263\337"
+ 565      FFB2DF90 
+ 565      FFB3DF90 
+ 565      FFB3DF
+ 566 1a82 90FFB3DF 		.ascii	"\220\377\263\337\220\377\264\337\220\377\264\340\221\377\264"
+ 566      90FFB4DF 
+ 566      90FFB4E0 
+ 566      91FFB4
+ 567 1a91 E091FFB4 		.ascii	"\340\221\377\264\340\221\377\265\340\221\377\265\340\221\377"
+ 567      E091FFB5 
+ 567      E091FFB5 
+ 567      E091FF
+ 568 1aa0 B5E091FF 		.ascii	"\265\340\221\377\266\340\221\377\266\340\221\377\266\341\222"
+ 568      B6E091FF 
+ 568      B6E091FF 
+ 568      B6E192
+ 569 1aaf FFB6E192 		.ascii	"\377\266\341\222\377\267\341\222\377\267\341\222\377\267\341"
+ 569      FFB7E192 
+ 569      FFB7E192 
+ 569      FFB7E1
+ 570 1abe 92FFB8E1 		.ascii	"\222\377\270\341\222\377\270\341\222\377\270\341\222\377\270"
+ 570      92FFB8E1 
+ 570      92FFB8E1 
+GAS LISTING /tmp/ccRZCsvR.s 			page 32
+
+
+ 570      92FFB8
+ 571 1acd E193FFB9 		.ascii	"\341\223\377\271\342\223\377\271\342\223\377\271\342\223\377"
+ 571      E293FFB9 
+ 571      E293FFB9 
+ 571      E293FF
+ 572 1adc B9E293FF 		.ascii	"\271\342\223\377\272\342\223\377\272\342\223\377\272\342\223"
+ 572      BAE293FF 
+ 572      BAE293FF 
+ 572      BAE293
+ 573 1aeb FFBBE294 		.ascii	"\377\273\342\224\377\273\343\224\377\273\343\224\377\273\343"
+ 573      FFBBE394 
+ 573      FFBBE394 
+ 573      FFBBE3
+ 574 1afa 94FFBCE3 		.ascii	"\224\377\274\343\224\377\274\343\224\377\274\343\224\377\275"
+ 574      94FFBCE3 
+ 574      94FFBCE3 
+ 574      94FFBD
+ 575 1b09 E394FFBD 		.ascii	"\343\224\377\275\343\225\377\275\343\225\377\275\344\225\377"
+ 575      E395FFBD 
+ 575      E395FFBD 
+ 575      E495FF
+ 576 1b18 BEE495FF 		.ascii	"\276\344\225\377\276\344\225\377\276\344\225\377\307\350\232"
+ 576      BEE495FF 
+ 576      BEE495FF 
+ 576      C7E89A
+ 577 1b27 FFC8E89A 		.ascii	"\377\310\350\232\377\310\350\232\377\310\350\232\377\310\350"
+ 577      FFC8E89A 
+ 577      FFC8E89A 
+ 577      FFC8E8
+ 578 1b36 9AFFC9E8 		.ascii	"\232\377\311\350\232\377\311\351\232\377\311\351\233\377\311"
+ 578      9AFFC9E9 
+ 578      9AFFC9E9 
+ 578      9BFFC9
+ 579 1b45 E99BFFCA 		.ascii	"\351\233\377\312\351\233\377\312\351\233\377\312\351\233\377"
+ 579      E99BFFCA 
+ 579      E99BFFCA 
+ 579      E99BFF
+ 580 1b54 CBE99BFF 		.ascii	"\313\351\233\377\313\351\233\377\313\352\233\377\313\352\234"
+ 580      CBE99BFF 
+ 580      CBEA9BFF 
+ 580      CBEA9C
+ 581 1b63 FFCCEA9C 		.ascii	"\377\314\352\234\377\314\352\234\377\314\352\234\377\314\352"
+ 581      FFCCEA9C 
+ 581      FFCCEA9C 
+ 581      FFCCEA
+ 582 1b72 9CFFCDEA 		.ascii	"\234\377\315\352\234\377\315\352\234\377\315\352\235\377\316"
+ 582      9CFFCDEA 
+ 582      9CFFCDEA 
+ 582      9DFFCE
+ 583 1b81 EB9DFFCE 		.ascii	"\353\235\377\316\353\235\377\316\353\235\377\316\353\235\377"
+ 583      EB9DFFCE 
+ 583      EB9DFFCE 
+ 583      EB9DFF
+ 584 1b90 CFEB9DFF 		.ascii	"\317\353\235\377\317\353\235\377\317\353\235\377\317\353\236"
+ 584      CFEB9DFF 
+ 584      CFEB9DFF 
+ 584      CFEB9E
+GAS LISTING /tmp/ccRZCsvR.s 			page 33
+
+
+ 585 1b9f FFD0EC9E 		.ascii	"\377\320\354\236\377\320\354\236\377\320\354\236\377\321\354"
+ 585      FFD0EC9E 
+ 585      FFD0EC9E 
+ 585      FFD1EC
+ 586 1bae 9EFFD1EC 		.ascii	"\236\377\321\354\236\377\321\354\236\377\321\354\237\377\322"
+ 586      9EFFD1EC 
+ 586      9EFFD1EC 
+ 586      9FFFD2
+ 587 1bbd EC9FFFD2 		.ascii	"\354\237\377\322\355\237\377\322\355\237\377\322\355\237\377"
+ 587      ED9FFFD2 
+ 587      ED9FFFD2 
+ 587      ED9FFF
+ 588 1bcc D3ED9FFF 		.ascii	"\323\355\237\377\323\355\237\377\323\355\240\377\323\355\240"
+ 588      D3ED9FFF 
+ 588      D3EDA0FF 
+ 588      D3EDA0
+ 589 1bdb FFD4EDA0 		.ascii	"\377\324\355\240\377\324\355\240\377\324\356\240\377\325\356"
+ 589      FFD4EDA0 
+ 589      FFD4EEA0 
+ 589      FFD5EE
+ 590 1bea A0FFD5EE 		.ascii	"\240\377\325\356\240\377\325\356\241\377\325\356\241\377\326"
+ 590      A0FFD5EE 
+ 590      A1FFD5EE 
+ 590      A1FFD6
+ 591 1bf9 EEA1FFD6 		.ascii	"\356\241\377\326\356\241\377\326\356\241\377\326\357\241\377"
+ 591      EEA1FFD6 
+ 591      EEA1FFD6 
+ 591      EFA1FF
+ 592 1c08 D7EFA1FF 		.ascii	"\327\357\241\377\327\357\242\377\327\357\242\377\327\357\242"
+ 592      D7EFA2FF 
+ 592      D7EFA2FF 
+ 592      D7EFA2
+ 593 1c17 FFD8EFA2 		.ascii	"\377\330\357\242\377\330\357\242\377\330\357\242\377\330\360"
+ 593      FFD8EFA2 
+ 593      FFD8EFA2 
+ 593      FFD8F0
+ 594 1c26 A2FFD9F0 		.ascii	"\242\377\331\360\243\377\331\360\243\377\331\360\243\377\331"
+ 594      A3FFD9F0 
+ 594      A3FFD9F0 
+ 594      A3FFD9
+ 595 1c35 F0A3FFD9 		.ascii	"\360\243\377\331\360\243\377\332\360\243\377\332\360\243\377"
+ 595      F0A3FFDA 
+ 595      F0A3FFDA 
+ 595      F0A3FF
+ 596 1c44 DAF0A4FF 		.ascii	"\332\360\244\377\332\360\244\377\332\360\244\377\333\360\244"
+ 596      DAF0A4FF 
+ 596      DAF0A4FF 
+ 596      DBF0A4
+ 597 1c53 FFDBF0A4 		.ascii	"\377\333\360\244\377\333\360\244\377\333\361\244\377\333\361"
+ 597      FFDBF0A4 
+ 597      FFDBF1A4 
+ 597      FFDBF1
+ 598 1c62 A4FFDCF1 		.ascii	"\244\377\334\361\245\377\334\361\245\377\334\361\245\377\334"
+ 598      A5FFDCF1 
+ 598      A5FFDCF1 
+ 598      A5FFDC
+ 599 1c71 F1A5FFDC 		.ascii	"\361\245\377\334\361\245\377\335\361\245\377\335\361\245\377"
+GAS LISTING /tmp/ccRZCsvR.s 			page 34
+
+
+ 599      F1A5FFDD 
+ 599      F1A5FFDD 
+ 599      F1A5FF
+ 600 1c80 DDF1A5FF 		.ascii	"\335\361\245\377\335\361\246\377\335\361\246\377\336\361\246"
+ 600      DDF1A6FF 
+ 600      DDF1A6FF 
+ 600      DEF1A6
+ 601 1c8f FFDEF1A6 		.ascii	"\377\336\361\246\377\336\362\246\377\336\362\246\377\336\362"
+ 601      FFDEF2A6 
+ 601      FFDEF2A6 
+ 601      FFDEF2
+ 602 1c9e A6FFDFF2 		.ascii	"\246\377\337\362\246\377\337\362\247\377\337\362\247\377\337"
+ 602      A6FFDFF2 
+ 602      A7FFDFF2 
+ 602      A7FFDF
+ 603 1cad F2A7FFDF 		.ascii	"\362\247\377\337\362\247\377\340\362\247\377\340\362\247\377"
+ 603      F2A7FFE0 
+ 603      F2A7FFE0 
+ 603      F2A7FF
+ 604 1cbc E0F2A7FF 		.ascii	"\340\362\247\377\340\362\250\377\340\362\250\377\341\363\250"
+ 604      E0F2A8FF 
+ 604      E0F2A8FF 
+ 604      E1F3A8
+ 605 1ccb FFE1F3A8 		.ascii	"\377\341\363\250\377\341\363\250\377\341\363\250\377\341\363"
+ 605      FFE1F3A8 
+ 605      FFE1F3A8 
+ 605      FFE1F3
+ 606 1cda A8FFE1F3 		.ascii	"\250\377\341\363\250\377\342\363\251\377\342\363\251\377\342"
+ 606      A8FFE2F3 
+ 606      A9FFE2F3 
+ 606      A9FFE2
+ 607 1ce9 F3A9FFE2 		.ascii	"\363\251\377\342\363\251\377\342\363\251\377\343\363\251\377"
+ 607      F3A9FFE2 
+ 607      F3A9FFE3 
+ 607      F3A9FF
+ 608 1cf8 E3F3A9FF 		.ascii	"\343\363\251\377\343\363\252\377\343\364\252\377\343\364\252"
+ 608      E3F3AAFF 
+ 608      E3F4AAFF 
+ 608      E3F4AA
+ 609 1d07 FFE4F4AA 		.ascii	"\377\344\364\252\377\344\364\252\377\344\364\252\377\344\364"
+ 609      FFE4F4AA 
+ 609      FFE4F4AA 
+ 609      FFE4F4
+ 610 1d16 AAFFE4F4 		.ascii	"\252\377\344\364\253\377\345\364\253\377\345\364\253\377\353"
+ 610      ABFFE5F4 
+ 610      ABFFE5F4 
+ 610      ABFFEB
+ 611 1d25 F7AFFFEB 		.ascii	"\367\257\377\353\367\257\377\353\367\260\377\353\367\260\377"
+ 611      F7AFFFEB 
+ 611      F7B0FFEB 
+ 611      F7B0FF
+ 612 1d34 ECF7B0FF 		.ascii	"\354\367\260\377\354\367\260\377\354\367\260\377\354\367\260"
+ 612      ECF7B0FF 
+ 612      ECF7B0FF 
+ 612      ECF7B0
+ 613 1d43 FFECF7B0 		.ascii	"\377\354\367\260\377\355\367\261\377\355\367\261\377\355\367"
+ 613      FFEDF7B1 
+GAS LISTING /tmp/ccRZCsvR.s 			page 35
+
+
+ 613      FFEDF7B1 
+ 613      FFEDF7
+ 614 1d52 B1FFEDF8 		.ascii	"\261\377\355\370\261\377\355\370\261\377\356\370\261\377\356"
+ 614      B1FFEDF8 
+ 614      B1FFEEF8 
+ 614      B1FFEE
+ 615 1d61 F8B1FFEE 		.ascii	"\370\261\377\356\370\262\377\356\370\262\377\356\370\262\377"
+ 615      F8B2FFEE 
+ 615      F8B2FFEE 
+ 615      F8B2FF
+ 616 1d70 EEF8B2FF 		.ascii	"\356\370\262\377\357\370\262\377\357\370\262\377\357\370\262"
+ 616      EFF8B2FF 
+ 616      EFF8B2FF 
+ 616      EFF8B2
+ 617 1d7f FFEFF8B3 		.ascii	"\377\357\370\263\377\357\370\263\377\360\371\263\377\360\371"
+ 617      FFEFF8B3 
+ 617      FFF0F9B3 
+ 617      FFF0F9
+ 618 1d8e B3FFF0F9 		.ascii	"\263\377\360\371\263\377\360\371\263\377\360\371\263\377\360"
+ 618      B3FFF0F9 
+ 618      B3FFF0F9 
+ 618      B3FFF0
+ 619 1d9d F9B4FFF1 		.ascii	"\371\264\377\361\371\264\377\361\371\264\377\361\371\264\377"
+ 619      F9B4FFF1 
+ 619      F9B4FFF1 
+ 619      F9B4FF
+ 620 1dac F1F9B4FF 		.ascii	"\361\371\264\377\361\371\264\377\362\371\264\377\362\371\265"
+ 620      F1F9B4FF 
+ 620      F2F9B4FF 
+ 620      F2F9B5
+ 621 1dbb FFF2FAB5 		.ascii	"\377\362\372\265\377\362\372\265\377\362\372\265\377\362\372"
+ 621      FFF2FAB5 
+ 621      FFF2FAB5 
+ 621      FFF2FA
+ 622 1dca B5FFF3FA 		.ascii	"\265\377\363\372\265\377\363\372\265\377\363\372\266\377\363"
+ 622      B5FFF3FA 
+ 622      B5FFF3FA 
+ 622      B6FFF3
+ 623 1dd9 FAB6FFF3 		.ascii	"\372\266\377\363\372\266\377\363\372\266\377\364\372\266\377"
+ 623      FAB6FFF3 
+ 623      FAB6FFF4 
+ 623      FAB6FF
+ 624 1de8 F4FAB6FF 		.ascii	"\364\372\266\377\364\372\266\377\364\372\267\377\364\373\267"
+ 624      F4FAB6FF 
+ 624      F4FAB7FF 
+ 624      F4FBB7
+ 625 1df7 FFF5FBB7 		.ascii	"\377\365\373\267\377\365\373\267\377\365\373\267\377\365\373"
+ 625      FFF5FBB7 
+ 625      FFF5FBB7 
+ 625      FFF5FB
+ 626 1e06 B7FFF5FB 		.ascii	"\267\377\365\373\267\377\365\373\270\377\366\373\270\377\366"
+ 626      B7FFF5FB 
+ 626      B8FFF6FB 
+ 626      B8FFF6
+ 627 1e15 FBB8FFF6 		.ascii	"\373\270\377\366\373\270\377\366\373\270\377\366\373\270\377"
+ 627      FBB8FFF6 
+ 627      FBB8FFF6 
+GAS LISTING /tmp/ccRZCsvR.s 			page 36
+
+
+ 627      FBB8FF
+ 628 1e24 F6FCB8FF 		.ascii	"\366\374\270\377\367\374\271\377\367\374\271\377\367\374\271"
+ 628      F7FCB9FF 
+ 628      F7FCB9FF 
+ 628      F7FCB9
+ 629 1e33 FFF7FCBA 		.ascii	"\377\367\374\272\377\367\374\272\377\367\374\272\377\367\374"
+ 629      FFF7FCBA 
+ 629      FFF7FCBA 
+ 629      FFF7FC
+ 630 1e42 BAFFF7FC 		.ascii	"\272\377\367\374\273\377\367\374\273\377\367\374\273\377\367"
+ 630      BBFFF7FC 
+ 630      BBFFF7FC 
+ 630      BBFFF7
+ 631 1e51 FCBCFFF7 		.ascii	"\374\274\377\367\374\274\377\367\374\274\377\367\374\274\377"
+ 631      FCBCFFF7 
+ 631      FCBCFFF7 
+ 631      FCBCFF
+ 632 1e60 F7FCBDFF 		.ascii	"\367\374\275\377\370\374\275\377\370\374\275\377\370\374\275"
+ 632      F8FCBDFF 
+ 632      F8FCBDFF 
+ 632      F8FCBD
+ 633 1e6f FFF8FCBE 		.ascii	"\377\370\374\276\377\370\374\276\377\370\374\276\377\370\374"
+ 633      FFF8FCBE 
+ 633      FFF8FCBE 
+ 633      FFF8FC
+ 634 1e7e BFFFF8FC 		.ascii	"\277\377\370\374\277\377\370\374\277\377\370\374\277\377\370"
+ 634      BFFFF8FC 
+ 634      BFFFF8FC 
+ 634      BFFFF8
+ 635 1e8d FCC0FFF8 		.ascii	"\374\300\377\370\374\300\377\370\374\300\377\370\374\300\377"
+ 635      FCC0FFF8 
+ 635      FCC0FFF8 
+ 635      FCC0FF
+ 636 1e9c F8FCC1FF 		.ascii	"\370\374\301\377\370\374\301\377\370\374\301\377\371\374\302"
+ 636      F8FCC1FF 
+ 636      F8FCC1FF 
+ 636      F9FCC2
+ 637 1eab FFF9FCC2 		.ascii	"\377\371\374\302\377\371\374\302\377\371\374\302\377\371\374"
+ 637      FFF9FCC2 
+ 637      FFF9FCC2 
+ 637      FFF9FC
+ 638 1eba C3FFF9FC 		.ascii	"\303\377\371\374\303\377\371\374\303\377\371\374\303\377\371"
+ 638      C3FFF9FC 
+ 638      C3FFF9FC 
+ 638      C3FFF9
+ 639 1ec9 FCC4FFF9 		.ascii	"\374\304\377\371\374\304\377\371\374\304\377\371\374\305\377"
+ 639      FCC4FFF9 
+ 639      FCC4FFF9 
+ 639      FCC5FF
+ 640 1ed8 F9FCC5FF 		.ascii	"\371\374\305\377\371\374\305\377\371\374\305\377\371\374\306"
+ 640      F9FCC5FF 
+ 640      F9FCC5FF 
+ 640      F9FCC6
+ 641 1ee7 FFF9FCC6 		.ascii	"\377\371\374\306\377\371\374\306\377\372\374\306\377\372\374"
+ 641      FFF9FCC6 
+ 641      FFFAFCC6 
+ 641      FFFAFC
+GAS LISTING /tmp/ccRZCsvR.s 			page 37
+
+
+ 642 1ef6 C7FFFAFC 		.ascii	"\307\377\372\374\307\377\372\374\307\377\372\374\310\377\372"
+ 642      C7FFFAFC 
+ 642      C7FFFAFC 
+ 642      C8FFFA
+ 643 1f05 FCC8FFFA 		.ascii	"\374\310\377\372\374\310\377\372\375\310\377\372\375\311\377"
+ 643      FCC8FFFA 
+ 643      FDC8FFFA 
+ 643      FDC9FF
+ 644 1f14 FAFDC9FF 		.ascii	"\372\375\311\377\372\375\311\377\372\375\312\377\372\375\312"
+ 644      FAFDC9FF 
+ 644      FAFDCAFF 
+ 644      FAFDCA
+ 645 1f23 FFFCFDD3 		.ascii	"\377\374\375\323\377\374\375\323\377\374\375\323\377\374\375"
+ 645      FFFCFDD3 
+ 645      FFFCFDD3 
+ 645      FFFCFD
+ 646 1f32 D4FFFCFD 		.ascii	"\324\377\374\375\324\377\374\375\324\377\374\375\325\377\374"
+ 646      D4FFFCFD 
+ 646      D4FFFCFD 
+ 646      D5FFFC
+ 647 1f41 FDD5FFFC 		.ascii	"\375\325\377\374\375\325\377\374\375\325\377\374\375\326\377"
+ 647      FDD5FFFC 
+ 647      FDD5FFFC 
+ 647      FDD6FF
+ 648 1f50 FCFDD6FF 		.ascii	"\374\375\326\377\374\375\326\377\374\375\326\377\374\375\327"
+ 648      FCFDD6FF 
+ 648      FCFDD6FF 
+ 648      FCFDD7
+ 649 1f5f FFFDFED7 		.ascii	"\377\375\376\327\377\375\376\327\377\375\376\330\377\375\376"
+ 649      FFFDFED7 
+ 649      FFFDFED8 
+ 649      FFFDFE
+ 650 1f6e D8FFFDFE 		.ascii	"\330\377\375\376\330\377\375\376\330\377\375\376\331\377\375"
+ 650      D8FFFDFE 
+ 650      D8FFFDFE 
+ 650      D9FFFD
+ 651 1f7d FED9FFFD 		.ascii	"\376\331\377\375\376\331\377\375\376\331\377\375\376\332\377"
+ 651      FED9FFFD 
+ 651      FED9FFFD 
+ 651      FEDAFF
+ 652 1f8c FDFEDAFF 		.ascii	"\375\376\332\377\375\376\332\377\375\376\333\377\375\376\333"
+ 652      FDFEDAFF 
+ 652      FDFEDBFF 
+ 652      FDFEDB
+ 653 1f9b FFFDFEDB 		.ascii	"\377\375\376\333\377\375\376\333\377\375\376\334\377\375\376"
+ 653      FFFDFEDB 
+ 653      FFFDFEDC 
+ 653      FFFDFE
+ 654 1faa DCFFFDFE 		.ascii	"\334\377\375\376\334\377\375\376\334\377\375\376\335\377\375"
+ 654      DCFFFDFE 
+ 654      DCFFFDFE 
+ 654      DDFFFD
+ 655 1fb9 FEDDFFFE 		.ascii	"\376\335\377\376\376\335\377"
+ 655      FEDDFF
+ 656 1fc0 FEFEDEFF 		.ascii	"\376\376\336\377\376\376\336\377\376\376\336\377\376\376\336"
+ 656      FEFEDEFF 
+ 656      FEFEDEFF 
+GAS LISTING /tmp/ccRZCsvR.s 			page 38
+
+
+ 656      FEFEDE
+ 657 1fcf FFFEFEDF 		.ascii	"\377\376\376\337\377\376\376\337\377\376\376\337\377\376\376"
+ 657      FFFEFEDF 
+ 657      FFFEFEDF 
+ 657      FFFEFE
+ 658 1fde E0FFFEFE 		.ascii	"\340\377\376\376\340\377\376\376\340\377\376\376\340\377\376"
+ 658      E0FFFEFE 
+ 658      E0FFFEFE 
+ 658      E0FFFE
+ 659 1fed FEE1FFFE 		.ascii	"\376\341\377\376\376\341\377\376\376\341\377\376\376\341\377"
+ 659      FEE1FFFE 
+ 659      FEE1FFFE 
+ 659      FEE1FF
+ 660 1ffc FEFEE2FF 		.ascii	"\376\376\342\377\376\376\342\377\376\376\342\377\376\376\343"
+ 660      FEFEE2FF 
+ 660      FEFEE2FF 
+ 660      FEFEE3
+ 661 200b FFFEFEE3 		.ascii	"\377\376\376\343\377\376\376\343\377\376\376\343\377\376\376"
+ 661      FFFEFEE3 
+ 661      FFFEFEE3 
+ 661      FFFEFE
+ 662 201a E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377"
+ 662      E4FFFEFE 
+ 662      E4FF
+ 663              		.globl	heatmap_cs_YlGn_soft
+ 664              		.section	.data.rel.local
+ 665              		.align 8
+ 666              		.type	heatmap_cs_YlGn_soft, @object
+ 667              		.size	heatmap_cs_YlGn_soft, 8
+ 668              	heatmap_cs_YlGn_soft:
+ 669 0010 00000000 		.quad	soft
+ 669      00000000 
+ 670              		.section	.data.rel.ro.local
+ 671              		.align 16
+ 672              		.type	soft, @object
+ 673              		.size	soft, 16
+ 674              	soft:
+ 675 0020 00000000 		.quad	soft_data
+ 675      00000000 
+ 676 0028 01040000 		.quad	1025
+ 676      00000000 
+ 677              		.section	.rodata
+ 678 2024 00000000 		.align 32
+ 678      00000000 
+ 678      00000000 
+ 678      00000000 
+ 678      00000000 
+ 679              		.type	soft_data, @object
+ 680              		.size	soft_data, 4100
+ 681              	soft_data:
+ 682 2040 00       		.string	""
+ 683 2041 00       		.string	""
+ 684 2042 00       		.string	""
+ 685 2043 00       		.string	""
+ 686 2044 00       		.string	""
+ 687 2045 452800   		.string	"E("
+ 688 2048 00       		.string	""
+GAS LISTING /tmp/ccRZCsvR.s 			page 39
+
+
+ 689 2049 45290700 		.string	"E)\007"
+ 690 204d 45290E00 		.string	"E)\016"
+ 691 2051 45291600 		.string	"E)\026"
+ 692 2055 46291D00 		.string	"F)\035"
+ 693 2059 46292500 		.string	"F)%"
+ 694 205d 46292C00 		.string	"F),"
+ 695 2061 46293400 		.string	"F)4"
+ 696 2065 47293B00 		.string	"G);"
+ 697 2069 472A4300 		.string	"G*C"
+ 698 206d 472A4A00 		.string	"G*J"
+ 699 2071 472A5200 		.string	"G*R"
+ 700 2075 482A5900 		.string	"H*Y"
+ 701 2079 482A6100 		.string	"H*a"
+ 702 207d 482A6800 		.string	"H*h"
+ 703 2081 482A7000 		.string	"H*p"
+ 704 2085 492A7700 		.string	"I*w"
+ 705 2089 492B7F00 		.string	"I+\177"
+ 706 208d 492B8600 		.string	"I+\206"
+ 707 2091 4A2B8D00 		.string	"J+\215"
+ 708 2095 4A2B9500 		.string	"J+\225"
+ 709 2099 4A2B9C00 		.string	"J+\234"
+ 710 209d 4A2BA400 		.string	"J+\244"
+ 711 20a1 4B2BAB00 		.string	"K+\253"
+ 712 20a5 4B2BB300 		.string	"K+\263"
+ 713 20a9 4B2BBA00 		.string	"K+\272"
+ 714 20ad 4B2CC200 		.string	"K,\302"
+ 715 20b1 4C2CC900 		.string	"L,\311"
+ 716 20b5 4C2CD100 		.string	"L,\321"
+ 717 20b9 4C2CD800 		.string	"L,\330"
+ 718 20bd 4D2CE000 		.string	"M,\340"
+ 719 20c1 4D2CE700 		.string	"M,\347"
+ 720 20c5 4D2CEF00 		.string	"M,\357"
+ 721 20c9 4D2CF600 		.string	"M,\366"
+ 722 20cd 4E2DFE00 		.string	"N-\376"
+ 723 20d1 4E2DFF00 		.string	"N-\377"
+ 724 20d5 4E2DFF00 		.string	"N-\377"
+ 725 20d9 4E2DFF00 		.string	"N-\377"
+ 726 20dd 4F2DFF00 		.string	"O-\377"
+ 727 20e1 4F2DFF00 		.string	"O-\377"
+ 728 20e5 4F2DFF00 		.string	"O-\377"
+ 729 20e9 4F2DFF00 		.string	"O-\377"
+ 730 20ed 502DFF00 		.string	"P-\377"
+ 731 20f1 502EFF00 		.string	"P.\377"
+ 732 20f5 502EFF00 		.string	"P.\377"
+ 733 20f9 512EFF00 		.string	"Q.\377"
+ 734 20fd 512EFF00 		.string	"Q.\377"
+ 735 2101 512EFF00 		.string	"Q.\377"
+ 736 2105 512EFF00 		.string	"Q.\377"
+ 737 2109 522EFF00 		.string	"R.\377"
+ 738 210d 522EFF00 		.string	"R.\377"
+ 739 2111 522EFF00 		.string	"R.\377"
+ 740 2115 522FFF00 		.string	"R/\377"
+ 741 2119 532FFF00 		.string	"S/\377"
+ 742 211d 532FFF00 		.string	"S/\377"
+ 743 2121 532FFF00 		.string	"S/\377"
+ 744 2125 542FFF00 		.string	"T/\377"
+ 745 2129 542FFF00 		.string	"T/\377"
+GAS LISTING /tmp/ccRZCsvR.s 			page 40
+
+
+ 746 212d 542FFF00 		.string	"T/\377"
+ 747 2131 542FFF00 		.string	"T/\377"
+ 748 2135 552FFF00 		.string	"U/\377"
+ 749 2139 5530FF00 		.string	"U0\377"
+ 750 213d 5530FF00 		.string	"U0\377"
+ 751 2141 5530FF00 		.string	"U0\377"
+ 752 2145 5630FF00 		.string	"V0\377"
+ 753 2149 5630FF00 		.string	"V0\377"
+ 754 214d 5630FF00 		.string	"V0\377"
+ 755 2151 5730FF00 		.string	"W0\377"
+ 756 2155 5730FF00 		.string	"W0\377"
+ 757 2159 5730FF00 		.string	"W0\377"
+ 758 215d 5731FF00 		.string	"W1\377"
+ 759 2161 5831FF00 		.string	"X1\377"
+ 760 2165 5831FF00 		.string	"X1\377"
+ 761 2169 5831FF00 		.string	"X1\377"
+ 762 216d 5831FF00 		.string	"X1\377"
+ 763 2171 5931FF00 		.string	"Y1\377"
+ 764 2175 5931FF00 		.string	"Y1\377"
+ 765 2179 5931FF00 		.string	"Y1\377"
+ 766 217d 5A31FF00 		.string	"Z1\377"
+ 767 2181 5A32FF00 		.string	"Z2\377"
+ 768 2185 5A32FF00 		.string	"Z2\377"
+ 769 2189 5A32FF00 		.string	"Z2\377"
+ 770 218d 5B32FF00 		.string	"[2\377"
+ 771 2191 5B32FF00 		.string	"[2\377"
+ 772 2195 5B32FF00 		.string	"[2\377"
+ 773 2199 5C32FF00 		.string	"\\2\377"
+ 774 219d 5C32FF00 		.string	"\\2\377"
+ 775 21a1 5C32FF00 		.string	"\\2\377"
+ 776 21a5 5C32FF00 		.string	"\\2\377"
+ 777 21a9 5D33FF00 		.string	"]3\377"
+ 778 21ad 5D33FF00 		.string	"]3\377"
+ 779 21b1 5D33FF00 		.string	"]3\377"
+ 780 21b5 5D33FF00 		.string	"]3\377"
+ 781 21b9 5E33FF00 		.string	"^3\377"
+ 782 21bd 5E33FF00 		.string	"^3\377"
+ 783 21c1 5E33FF00 		.string	"^3\377"
+ 784 21c5 5F33FF00 		.string	"_3\377"
+ 785 21c9 5F33FF00 		.string	"_3\377"
+ 786 21cd 5F34FF00 		.string	"_4\377"
+ 787 21d1 5F34FF00 		.string	"_4\377"
+ 788 21d5 6034FF00 		.string	"`4\377"
+ 789 21d9 6034FF00 		.string	"`4\377"
+ 790 21dd 6034FF00 		.string	"`4\377"
+ 791 21e1 6134FF00 		.string	"a4\377"
+ 792 21e5 6134FF00 		.string	"a4\377"
+ 793 21e9 6134FF00 		.string	"a4\377"
+ 794 21ed 6134FF00 		.string	"a4\377"
+ 795 21f1 6234FF00 		.string	"b4\377"
+ 796 21f5 6235FF00 		.string	"b5\377"
+ 797 21f9 6235FF00 		.string	"b5\377"
+ 798 21fd 6235FF00 		.string	"b5\377"
+ 799 2201 6335FF00 		.string	"c5\377"
+ 800 2205 6335FF00 		.string	"c5\377"
+ 801 2209 6335FF00 		.string	"c5\377"
+ 802 220d 6435FF00 		.string	"d5\377"
+GAS LISTING /tmp/ccRZCsvR.s 			page 41
+
+
+ 803 2211 6435FF00 		.string	"d5\377"
+ 804 2215 6435FF00 		.string	"d5\377"
+ 805 2219 6435FF00 		.string	"d5\377"
+ 806 221d 6536FF00 		.string	"e6\377"
+ 807 2221 6536FF00 		.string	"e6\377"
+ 808 2225 6536FF00 		.string	"e6\377"
+ 809 2229 6636FF00 		.string	"f6\377"
+ 810 222d 6636FF00 		.string	"f6\377"
+ 811 2231 6636FF00 		.string	"f6\377"
+ 812 2235 6636FF00 		.string	"f6\377"
+ 813 2239 6736FF00 		.string	"g6\377"
+ 814 223d 6736FF00 		.string	"g6\377"
+ 815 2241 6736FF00 		.string	"g6\377"
+ 816 2245 6836FF00 		.string	"h6\377"
+ 817 2249 6837FF00 		.string	"h7\377"
+ 818 224d 6837FF00 		.string	"h7\377"
+ 819 2251 6837FF01 		.ascii	"h7\377\001h7\377\001i7\377\001i7\377\001i7\377\002i7\377\002"
+ 819      6837FF01 
+ 819      6937FF01 
+ 819      6937FF01 
+ 819      6937FF02 
+ 820 2269 6937FF02 		.ascii	"i7\377\002j7\377\003j8\377\003j8\377\003j8\377\003k8\377\004"
+ 820      6A37FF03 
+ 820      6A38FF03 
+ 820      6A38FF03 
+ 820      6A38FF03 
+ 821 2281 6B38FF04 		.ascii	"k8\377\004k8\377\004k8\377\005k8\377\005l8\377\005l8\377\006"
+ 821      6B38FF04 
+ 821      6B38FF05 
+ 821      6B38FF05 
+ 821      6C38FF05 
+ 822 2299 6C39FF06 		.ascii	"l9\377\006l9\377\006l9\377\006m9\377\007m9\377\007m9\377\007"
+ 822      6C39FF06 
+ 822      6C39FF06 
+ 822      6D39FF07 
+ 822      6D39FF07 
+ 823 22b1 6D39FF08 		.ascii	"m9\377\bn9\377\bn9\377\bn9\377\tn:\377\tn:\377\to:\377\no:\377"
+ 823      6E39FF08 
+ 823      6E39FF08 
+ 823      6E39FF09 
+ 823      6E3AFF09 
+ 824 22d0 0A6F3AFF 		.ascii	"\no:\377\no:\377\013p:\377\013p:\377\013p:\377\fp:\377\fp:\377"
+ 824      0A6F3AFF 
+ 824      0B703AFF 
+ 824      0B703AFF 
+ 824      0B703AFF 
+ 825 22ec 0C713BFF 		.ascii	"\fq;\377\rq;\377\rq;\377\rq;\377\016q;\377\016r;\377\016r;\377"
+ 825      0D713BFF 
+ 825      0D713BFF 
+ 825      0D713BFF 
+ 825      0E713BFF 
+ 826 2308 0F723BFF 		.ascii	"\017r;\377\017r;\377\017s;\377\017s<\377\020s<\377\020s<\377"
+ 826      0F723BFF 
+ 826      0F733BFF 
+ 826      0F733CFF 
+ 826      10733CFF 
+ 827 2320 10733CFF 		.ascii	"\020s<\377\021t<\377\021t<\377\021t<\377\021t<\377\022u<\377"
+GAS LISTING /tmp/ccRZCsvR.s 			page 42
+
+
+ 827      11743CFF 
+ 827      11743CFF 
+ 827      11743CFF 
+ 827      11743CFF 
+ 828 2338 12753CFF 		.ascii	"\022u<\377\022u<\377\022u=\377\023u=\377\023v=\377\023v=\377"
+ 828      12753CFF 
+ 828      12753DFF 
+ 828      13753DFF 
+ 828      13763DFF 
+ 829 2350 14763DFF 		.ascii	"\024v=\377\024v=\377\024v=\377\024w=\377\025w=\377\025w=\377"
+ 829      14763DFF 
+ 829      14763DFF 
+ 829      14773DFF 
+ 829      15773DFF 
+ 830 2368 15773DFF 		.ascii	"\025w=\377\025x>\377\026x>\377\026x>\377\026x>\377\026x>\377"
+ 830      15783EFF 
+ 830      16783EFF 
+ 830      16783EFF 
+ 830      16783EFF 
+ 831 2380 17793EFF 		.ascii	"\027y>\377\027y>\377\027y>\377\027y>\377\030z>\377\030z?\377"
+ 831      17793EFF 
+ 831      17793EFF 
+ 831      17793EFF 
+ 831      187A3EFF 
+ 832 2398 187A3FFF 		.ascii	"\030z?\377\030z?\377\031z?\377\031{?\377\031{?\377\031{?\377"
+ 832      187A3FFF 
+ 832      197A3FFF 
+ 832      197B3FFF 
+ 832      197B3FFF 
+ 833 23b0 1A7B3FFF 		.ascii	"\032{?\377\032|?\377\032|?\377\032|?\377\033|@\377\033|@\377"
+ 833      1A7C3FFF 
+ 833      1A7C3FFF 
+ 833      1A7C3FFF 
+ 833      1B7C40FF 
+ 834 23c8 1B7D40FF 		.ascii	"\033}@\377\033}@\377\034}@\377\034}@\377\034~@\377\034~@\377"
+ 834      1B7D40FF 
+ 834      1C7D40FF 
+ 834      1C7D40FF 
+ 834      1C7E40FF 
+ 835 23e0 1D7E40FF 		.ascii	"\035~@\377\035~@\377\035~@\377\035\177A\377\036\177A\377\036"
+ 835      1D7E40FF 
+ 835      1D7E40FF 
+ 835      1D7F41FF 
+ 835      1E7F41FF 
+ 836 23f5 7F41FF1E 		.ascii	"\177A\377\036\177A\377\036\200A\377\037\200A\377\037\200A\377"
+ 836      7F41FF1E 
+ 836      8041FF1F 
+ 836      8041FF1F 
+ 836      8041FF
+ 837 2408 1F8041FF 		.ascii	"\037\200A\377\037\200A\377\037\201A\377 \201A\377 \201B\377 "
+ 837      1F8041FF 
+ 837      1F8141FF 
+ 837      208141FF 
+ 837      208142FF 
+ 838 241d 8142FF20 		.ascii	"\201B\377 \202B\377!\202B\377!\202B\377!\202B\377!\202B\377\""
+ 838      8242FF21 
+ 838      8242FF21 
+GAS LISTING /tmp/ccRZCsvR.s 			page 43
+
+
+ 838      8242FF21 
+ 838      8242FF21 
+ 839 2435 8342FF22 		.ascii	"\203B\377\"\203B\377\"\203B\377\"\203B\377#\204B\377#\204C\377"
+ 839      8342FF22 
+ 839      8342FF22 
+ 839      8342FF23 
+ 839      8442FF23 
+ 840 244c 238443FF 		.ascii	"#\204C\377#\204C\377#\205C\377$\205C\377$\205D\377$\206D\377"
+ 840      238443FF 
+ 840      238543FF 
+ 840      248543FF 
+ 840      248544FF 
+ 841 2464 248644FF 		.ascii	"$\206D\377%\206D\377%\206D\377%\207E\377%\207E\377&\207E\377"
+ 841      258644FF 
+ 841      258644FF 
+ 841      258745FF 
+ 841      258745FF 
+ 842 247c 268845FF 		.ascii	"&\210E\377&\210E\377&\210F\377'\211F\377'\211F\377'\211F\377"
+ 842      268845FF 
+ 842      268846FF 
+ 842      278946FF 
+ 842      278946FF 
+ 843 2494 278946FF 		.ascii	"'\211F\377(\212G\377(\212G\377(\212G\377(\213G\377)\213G\377"
+ 843      288A47FF 
+ 843      288A47FF 
+ 843      288A47FF 
+ 843      288B47FF 
+ 844 24ac 298B48FF 		.ascii	")\213H\377)\214H\377)\214H\377)\214H\377*\214H\377*\215I\377"
+ 844      298C48FF 
+ 844      298C48FF 
+ 844      298C48FF 
+ 844      2A8C48FF 
+ 845 24c4 2A8D49FF 		.ascii	"*\215I\377*\215I\377+\216I\377+\216I\377+\216J\377+\217J\377"
+ 845      2A8D49FF 
+ 845      2B8E49FF 
+ 845      2B8E49FF 
+ 845      2B8E4AFF 
+ 846 24dc 2C8F4AFF 		.ascii	",\217J\377,\217J\377,\217K\377,\220K\377-\220K\377-\220K\377"
+ 846      2C8F4AFF 
+ 846      2C8F4BFF 
+ 846      2C904BFF 
+ 846      2D904BFF 
+ 847 24f4 2D914BFF 		.ascii	"-\221K\377-\221L\377-\221L\377.\222L\377.\222L\377.\222L\377"
+ 847      2D914CFF 
+ 847      2D914CFF 
+ 847      2E924CFF 
+ 847      2E924CFF 
+ 848 250c 2E934DFF 		.ascii	".\223M\377/\223M\377/\223M\377/\223M\377/\224M\3770\224N\377"
+ 848      2F934DFF 
+ 848      2F934DFF 
+ 848      2F934DFF 
+ 848      2F944DFF 
+ 849 2524 30944EFF 		.ascii	"0\224N\3770\225N\3770\225N\3771\225N\3771\226O\3771\226O\377"
+ 849      30954EFF 
+ 849      30954EFF 
+ 849      31954EFF 
+ 849      31964FFF 
+GAS LISTING /tmp/ccRZCsvR.s 			page 44
+
+
+ 850 253c 31964FFF 		.ascii	"1\226O\3771\226O\3772\227O\3772\227P\3772\227P\3772\230P\377"
+ 850      31964FFF 
+ 850      32974FFF 
+ 850      329750FF 
+ 850      329750FF 
+ 851 2554 339850FF 		.ascii	"3\230P\3773\230P\3773\231Q\3773\231Q\3774\231Q\3774\232Q\377"
+ 851      339850FF 
+ 851      339951FF 
+ 851      339951FF 
+ 851      349951FF 
+ 852 256c 349A51FF 		.ascii	"4\232Q\3774\232R\3774\232R\3775\233R\3775\233R\3775\233R\377"
+ 852      349A52FF 
+ 852      349A52FF 
+ 852      359B52FF 
+ 852      359B52FF 
+ 853 2584 359C53FF 		.ascii	"5\234S\3776\234S\3776\234S\3776\235S\3776\235S\3777\235T\377"
+ 853      369C53FF 
+ 853      369C53FF 
+ 853      369D53FF 
+ 853      369D53FF 
+ 854 259c 379E54FF 		.ascii	"7\236T\3777\236T\3777\236T\3777\236T\3778\237U\3778\237U\377"
+ 854      379E54FF 
+ 854      379E54FF 
+ 854      379E54FF 
+ 854      389F55FF 
+ 855 25b4 389F55FF 		.ascii	"8\237U\3778\240U\3779\240U\3779\240V\3779\241V\3779\241V\377"
+ 855      38A055FF 
+ 855      39A055FF 
+ 855      39A056FF 
+ 855      39A156FF 
+ 856 25cc 3AA156FF 		.ascii	":\241V\377:\242W\377:\242W\377:\242W\377:\242W\377;\243W\377"
+ 856      3AA257FF 
+ 856      3AA257FF 
+ 856      3AA257FF 
+ 856      3AA257FF 
+ 857 25e4 3BA358FF 		.ascii	";\243X\377;\243X\377;\244X\377<\244X\377<\244X\377<\245Y\377"
+ 857      3BA358FF 
+ 857      3BA458FF 
+ 857      3CA458FF 
+ 857      3CA458FF 
+ 858 25fc 3CA559FF 		.ascii	"<\245Y\377=\245Y\377=\246Y\377=\246Y\377=\246Z\377=\246Z\377"
+ 858      3DA559FF 
+ 858      3DA659FF 
+ 858      3DA659FF 
+ 858      3DA65AFF 
+ 859 2614 3EA75AFF 		.ascii	">\247Z\377>\247Z\377>\247Z\377>\250[\377?\250[\377?\250[\377"
+ 859      3EA75AFF 
+ 859      3EA75AFF 
+ 859      3EA85BFF 
+ 859      3FA85BFF 
+ 860 262c 3FA95BFF 		.ascii	"?\251[\377?\251[\377@\251\\\377@\252\\\377@\252\\\377@\252\\"
+ 860      3FA95BFF 
+ 860      40A95CFF 
+ 860      40AA5CFF 
+ 860      40AA5CFF 
+ 861 2643 FF41AB5C 		.ascii	"\377A\253\\\377A\253]\377B\253]\377B\253]\377C\253]\377C\254"
+ 861      FF41AB5D 
+GAS LISTING /tmp/ccRZCsvR.s 			page 45
+
+
+ 861      FF42AB5D 
+ 861      FF42AB5D 
+ 861      FF43AB5D 
+ 862 265a 5EFF44AC 		.ascii	"^\377D\254^\377D\254^\377E\254^\377E\254^\377F\255_\377F\255"
+ 862      5EFF44AC 
+ 862      5EFF45AC 
+ 862      5EFF45AC 
+ 862      5EFF46AD 
+ 863 2672 5FFF46AD 		.ascii	"_\377F\255_\377G\255_\377G\255_\377H\256`\377H\256`\377I\256"
+ 863      5FFF47AD 
+ 863      5FFF47AD 
+ 863      5FFF48AE 
+ 863      60FF48AE 
+ 864 268a 60FF49AE 		.ascii	"`\377I\256`\377J\256`\377J\257a\377K\257a\377K\257a\377L\257"
+ 864      60FF4AAE 
+ 864      60FF4AAF 
+ 864      61FF4BAF 
+ 864      61FF4BAF 
+ 865 26a2 61FF4CB0 		.ascii	"a\377L\260b\377M\260b\377M\260b\377N\260b\377N\260b\377N\261"
+ 865      62FF4DB0 
+ 865      62FF4DB0 
+ 865      62FF4EB0 
+ 865      62FF4EB0 
+ 866 26ba 63FF4FB1 		.ascii	"c\377O\261c\377O\261c\377P\261c\377P\261c\377Q\262d\377Q\262"
+ 866      63FF4FB1 
+ 866      63FF50B1 
+ 866      63FF50B1 
+ 866      63FF51B2 
+ 867 26d2 64FF52B2 		.ascii	"d\377R\262d\377R\262d\377S\262d\377S\263e\377S\263e\377T\263"
+ 867      64FF52B2 
+ 867      64FF53B2 
+ 867      64FF53B3 
+ 867      65FF53B3 
+ 868 26ea 65FF54B3 		.ascii	"e\377T\263e\377U\264f\377U\264f\377V\264f\377V\264f\377W\264"
+ 868      65FF55B4 
+ 868      66FF55B4 
+ 868      66FF56B4 
+ 868      66FF56B4 
+ 869 2702 66FF57B5 		.ascii	"f\377W\265g\377W\265g\377X\265g\377X\265g\377Y\265g\377Y\266"
+ 869      67FF57B5 
+ 869      67FF58B5 
+ 869      67FF58B5 
+ 869      67FF59B5 
+ 870 271a 68FF5AB6 		.ascii	"h\377Z\266h\377Z\266h\377Z\266h\377[\266i\377[\267i\377\\\267"
+ 870      68FF5AB6 
+ 870      68FF5AB6 
+ 870      68FF5BB6 
+ 870      69FF5BB7 
+ 871 2732 69FF5CB7 		.ascii	"i\377\\\267i\377]\267i\377]\270j\377]\270j\377^\270j\377^\270"
+ 871      69FF5DB7 
+ 871      69FF5DB8 
+ 871      6AFF5DB8 
+ 871      6AFF5EB8 
+ 872 274a 6AFF5FB8 		.ascii	"j\377_\270k\377_\271k\377`\271k\377`\271k\377`\271k\377a\271"
+ 872      6BFF5FB9 
+ 872      6BFF60B9 
+ 872      6BFF60B9 
+GAS LISTING /tmp/ccRZCsvR.s 			page 46
+
+
+ 872      6BFF60B9 
+ 873 2762 6CFF61BA 		.ascii	"l\377a\272l\377b\272l\377b\272l\377b\272m\377c\272m\377c\273"
+ 873      6CFF62BA 
+ 873      6CFF62BA 
+ 873      6CFF62BA 
+ 873      6DFF63BA 
+ 874 277a 6DFF64BB 		.ascii	"m\377d\273m\377d\273m\377d\273n\377e\274n\377e\274n\377f\274"
+ 874      6DFF64BB 
+ 874      6DFF64BB 
+ 874      6EFF65BC 
+ 874      6EFF65BC 
+ 875 2792 6EFF66BC 		.ascii	"n\377f\274o\377g\274o\377g\275o\377g\275o\377h\275o\377h\275"
+ 875      6FFF67BC 
+ 875      6FFF67BD 
+ 875      6FFF67BD 
+ 875      6FFF68BD 
+ 876 27aa 70FF69BD 		.ascii	"p\377i\275p\377i\276p\377i\276p\377j\276q\377j\276q\377k\277"
+ 876      70FF69BE 
+ 876      70FF69BE 
+ 876      70FF6ABE 
+ 876      71FF6ABE 
+ 877 27c2 71FF6BBF 		.ascii	"q\377k\277q\377k\277q\377l\277r\377l\277r\377m\300r\377m\300"
+ 877      71FF6BBF 
+ 877      71FF6CBF 
+ 877      72FF6CBF 
+ 877      72FF6DC0 
+ 878 27da 72FF6DC0 		.ascii	"r\377m\300s\377n\300s\377n\300s\377o\301s\377o\301s\377o\301"
+ 878      73FF6EC0 
+ 878      73FF6EC0 
+ 878      73FF6FC1 
+ 878      73FF6FC1 
+ 879 27f2 74FF70C1 		.ascii	"t\377p\301t\377p\301t\377p\302t\377q\302u\377q\302u\377r\302"
+ 879      74FF70C1 
+ 879      74FF70C2 
+ 879      74FF71C2 
+ 879      75FF71C2 
+ 880 280a 75FF72C3 		.ascii	"u\377r\303u\377"
+ 880      75FF
+ 881 2810 72C376FF 		.ascii	"r\303v\377s\303v\377s\303v\377t\303v\377t\304v\377t\304w\377"
+ 881      73C376FF 
+ 881      73C376FF 
+ 881      74C376FF 
+ 881      74C476FF 
+ 882 2828 75C477FF 		.ascii	"u\304w\377u\304w\377v\304w\377v\305x\377v\305x\377w\305x\377"
+ 882      75C477FF 
+ 882      76C477FF 
+ 882      76C578FF 
+ 882      76C578FF 
+ 883 2840 77C578FF 		.ascii	"w\305x\377w\306x\377x\306y\377x\306y\377y\306y\377y\306y\377"
+ 883      77C678FF 
+ 883      78C679FF 
+ 883      78C679FF 
+ 883      79C679FF 
+ 884 2858 7AC679FF 		.ascii	"z\306y\377z\307y\377{\307y\377{\307z\377{\307z\377|\307z\377"
+ 884      7AC779FF 
+ 884      7BC779FF 
+ 884      7BC77AFF 
+GAS LISTING /tmp/ccRZCsvR.s 			page 47
+
+
+ 884      7BC77AFF 
+ 885 2870 7CC77AFF 		.ascii	"|\307z\377}\310z\377}\310z\377~\310{\377~\310{\377\177\310{\377"
+ 885      7DC87AFF 
+ 885      7DC87AFF 
+ 885      7EC87BFF 
+ 885      7EC87BFF 
+ 886 2888 7FC97BFF 		.ascii	"\177\311{\377\177\311{\377\200\311{\377\200\311{\377\201\311"
+ 886      7FC97BFF 
+ 886      80C97BFF 
+ 886      80C97BFF 
+ 886      81C9
+ 887 289a 7CFF81C9 		.ascii	"|\377\201\311|\377\202\312|\377\202\312|\377\202\312|\377\203"
+ 887      7CFF82CA 
+ 887      7CFF82CA 
+ 887      7CFF82CA 
+ 887      7CFF83
+ 888 28ad CA7CFF83 		.ascii	"\312|\377\203\312|\377\204\313}\377\204\313}\377\205\313}\377"
+ 888      CA7CFF84 
+ 888      CB7DFF84 
+ 888      CB7DFF85 
+ 888      CB7DFF
+ 889 28c0 85CB7DFF 		.ascii	"\205\313}\377\205\313}\377\206\313}\377\206\314~\377\207\314"
+ 889      85CB7DFF 
+ 889      86CB7DFF 
+ 889      86CC7EFF 
+ 889      87CC
+ 890 28d2 7EFF87CC 		.ascii	"~\377\207\314~\377\210\314~\377\210\314~\377\210\315~\377\211"
+ 890      7EFF88CC 
+ 890      7EFF88CC 
+ 890      7EFF88CD 
+ 890      7EFF89
+ 891 28e5 CD7EFF89 		.ascii	"\315~\377\211\315\177\377\212\315\177\377\212\315\177\377\213"
+ 891      CD7FFF8A 
+ 891      CD7FFF8A 
+ 891      CD7FFF8B 
+ 892 28f5 CD7FFF8B 		.ascii	"\315\177\377\213\316\177\377\213\316\177\377\214\316\200\377"
+ 892      CE7FFF8B 
+ 892      CE7FFF8C 
+ 892      CE80FF
+ 893 2904 8CCE80FF 		.ascii	"\214\316\200\377\215\316\200\377\215\316\200\377\215\317\200"
+ 893      8DCE80FF 
+ 893      8DCE80FF 
+ 893      8DCF80
+ 894 2913 FF8ECF80 		.ascii	"\377\216\317\200\377\216\317\200\377\217\317\201\377\217\317"
+ 894      FF8ECF80 
+ 894      FF8FCF81 
+ 894      FF8FCF
+ 895 2922 81FF90D0 		.ascii	"\201\377\220\320\201\377\220\320\201\377\220\320\201\377\221"
+ 895      81FF90D0 
+ 895      81FF90D0 
+ 895      81FF91
+ 896 2931 D081FF91 		.ascii	"\320\201\377\221\320\202\377\222\320\202\377\222\321\202\377"
+ 896      D082FF92 
+ 896      D082FF92 
+ 896      D182FF
+ 897 2940 92D182FF 		.ascii	"\222\321\202\377\223\321\202\377\223\321\202\377\224\321\203"
+ 897      93D182FF 
+GAS LISTING /tmp/ccRZCsvR.s 			page 48
+
+
+ 897      93D182FF 
+ 897      94D183
+ 898 294f FF94D283 		.ascii	"\377\224\322\203\377\225\322\203\377\225\322\203\377\225\322"
+ 898      FF95D283 
+ 898      FF95D283 
+ 898      FF95D2
+ 899 295e 83FF96D2 		.ascii	"\203\377\226\322\203\377\226\322\204\377\227\323\204\377\227"
+ 899      83FF96D2 
+ 899      84FF97D3 
+ 899      84FF97
+ 900 296d D384FF97 		.ascii	"\323\204\377\227\323\204\377\230\323\204\377\230\323\204\377"
+ 900      D384FF98 
+ 900      D384FF98 
+ 900      D384FF
+ 901 297c 99D485FF 		.ascii	"\231\324\205\377\231\324\205\377\231\324\205\377\232\324\205"
+ 901      99D485FF 
+ 901      99D485FF 
+ 901      9AD485
+ 902 298b FF9AD485 		.ascii	"\377\232\324\205\377\233\324\205\377\233\325\206\377\233\325"
+ 902      FF9BD485 
+ 902      FF9BD586 
+ 902      FF9BD5
+ 903 299a 86FF9CD5 		.ascii	"\206\377\234\325\206\377\234\325\206\377\235\325\206\377\235"
+ 903      86FF9CD5 
+ 903      86FF9DD5 
+ 903      86FF9D
+ 904 29a9 D586FF9D 		.ascii	"\325\206\377\235\326\207\377\236\326\207\377\236\326\207\377"
+ 904      D687FF9E 
+ 904      D687FF9E 
+ 904      D687FF
+ 905 29b8 9FD687FF 		.ascii	"\237\326\207\377\237\326\207\377\237\327\210\377\240\327\210"
+ 905      9FD687FF 
+ 905      9FD788FF 
+ 905      A0D788
+ 906 29c7 FFA0D788 		.ascii	"\377\240\327\210\377\241\327\210\377\241\327\210\377\241\327"
+ 906      FFA1D788 
+ 906      FFA1D788 
+ 906      FFA1D7
+ 907 29d6 88FFA2D8 		.ascii	"\210\377\242\330\211\377\242\330\211\377\243\330\211\377\243"
+ 907      89FFA2D8 
+ 907      89FFA3D8 
+ 907      89FFA3
+ 908 29e5 D889FFA3 		.ascii	"\330\211\377\243\330\211\377\244\331\211\377\244\331\212\377"
+ 908      D889FFA4 
+ 908      D989FFA4 
+ 908      D98AFF
+ 909 29f4 A5D98AFF 		.ascii	"\245\331\212\377\245\331\212\377\245\331\212\377\246\331\212"
+ 909      A5D98AFF 
+ 909      A5D98AFF 
+ 909      A6D98A
+ 910 2a03 FFA6DA8B 		.ascii	"\377\246\332\213\377\247\332\213\377\247\332\213\377\247\332"
+ 910      FFA7DA8B 
+ 910      FFA7DA8B 
+ 910      FFA7DA
+ 911 2a12 8BFFA8DA 		.ascii	"\213\377\250\332\213\377\250\333\213\377\251\333\214\377\251"
+ 911      8BFFA8DB 
+ 911      8BFFA9DB 
+GAS LISTING /tmp/ccRZCsvR.s 			page 49
+
+
+ 911      8CFFA9
+ 912 2a21 DB8CFFA9 		.ascii	"\333\214\377\251\333\214\377\252\333\214\377\252\333\214\377"
+ 912      DB8CFFAA 
+ 912      DB8CFFAA 
+ 912      DB8CFF
+ 913 2a30 ABDC8DFF 		.ascii	"\253\334\215\377\253\334\215\377\253\334\215\377\254\334\215"
+ 913      ABDC8DFF 
+ 913      ABDC8DFF 
+ 913      ACDC8D
+ 914 2a3f FFACDC8D 		.ascii	"\377\254\334\215\377\254\335\215\377\255\335\216\377\255\335"
+ 914      FFACDD8D 
+ 914      FFADDD8E 
+ 914      FFADDD
+ 915 2a4e 8EFFAEDD 		.ascii	"\216\377\256\335\216\377\256\335\216\377\256\335\216\377\257"
+ 915      8EFFAEDD 
+ 915      8EFFAEDD 
+ 915      8EFFAF
+ 916 2a5d DD8EFFAF 		.ascii	"\335\216\377\257\336\217\377\257\336\217\377\260\336\217\377"
+ 916      DE8FFFAF 
+ 916      DE8FFFB0 
+ 916      DE8FFF
+ 917 2a6c B0DE8FFF 		.ascii	"\260\336\217\377\260\336\217\377\261\336\217\377\261\336\217"
+ 917      B0DE8FFF 
+ 917      B1DE8FFF 
+ 917      B1DE8F
+ 918 2a7b FFB2DF90 		.ascii	"\377\262\337\220\377\262\337\220\377\262\337\220\377\263\337"
+ 918      FFB2DF90 
+ 918      FFB2DF90 
+ 918      FFB3DF
+ 919 2a8a 90FFB3DF 		.ascii	"\220\377\263\337\220\377\263\337\220\377\264\337\220\377\264"
+ 919      90FFB3DF 
+ 919      90FFB4DF 
+ 919      90FFB4
+ 920 2a99 E091FFB4 		.ascii	"\340\221\377\264\340\221\377\265\340\221\377\265\340\221\377"
+ 920      E091FFB5 
+ 920      E091FFB5 
+ 920      E091FF
+ 921 2aa8 B5E091FF 		.ascii	"\265\340\221\377\266\340\221\377\266\340\221\377\266\341\222"
+ 921      B6E091FF 
+ 921      B6E091FF 
+ 921      B6E192
+ 922 2ab7 FFB7E192 		.ascii	"\377\267\341\222\377\267\341\222\377\270\341\222\377\270\341"
+ 922      FFB7E192 
+ 922      FFB8E192 
+ 922      FFB8E1
+ 923 2ac6 92FFB8E1 		.ascii	"\222\377\270\341\222\377\271\342\223\377\271\342\223\377\271"
+ 923      92FFB9E2 
+ 923      93FFB9E2 
+ 923      93FFB9
+ 924 2ad5 E293FFBA 		.ascii	"\342\223\377\272\342\223\377\272\342\223\377\272\342\223\377"
+ 924      E293FFBA 
+ 924      E293FFBA 
+ 924      E293FF
+ 925 2ae4 BBE294FF 		.ascii	"\273\342\224\377\273\343\224\377\273\343\224\377\274\343\224"
+ 925      BBE394FF 
+ 925      BBE394FF 
+ 925      BCE394
+GAS LISTING /tmp/ccRZCsvR.s 			page 50
+
+
+ 926 2af3 FFBCE394 		.ascii	"\377\274\343\224\377\274\343\224\377\275\343\224\377\275\343"
+ 926      FFBCE394 
+ 926      FFBDE394 
+ 926      FFBDE3
+ 927 2b02 95FFBDE4 		.ascii	"\225\377\275\344\225\377\276\344\225\377\276\344\225\377\276"
+ 927      95FFBEE4 
+ 927      95FFBEE4 
+ 927      95FFBE
+ 928 2b11 E495FFBF 		.ascii	"\344\225\377\277\344\225\377\277\344\226\377\300\344\226\377"
+ 928      E495FFBF 
+ 928      E496FFC0 
+ 928      E496FF
+ 929 2b20 C0E596FF 		.ascii	"\300\345\226\377\300\345\226\377\301\345\226\377\301\345\226"
+ 929      C0E596FF 
+ 929      C1E596FF 
+ 929      C1E596
+ 930 2b2f FFC1E597 		.ascii	"\377\301\345\227\377\302\345\227\377\302\346\227\377\302\346"
+ 930      FFC2E597 
+ 930      FFC2E697 
+ 930      FFC2E6
+ 931 2b3e 97FFC3E6 		.ascii	"\227\377\303\346\227\377\303\346\227\377\303\346\230\377\304"
+ 931      97FFC3E6 
+ 931      97FFC3E6 
+ 931      98FFC4
+ 932 2b4d E698FFC4 		.ascii	"\346\230\377\304\346\230\377\304\347\230\377\305\347\230\377"
+ 932      E698FFC4 
+ 932      E798FFC5 
+ 932      E798FF
+ 933 2b5c C5E798FF 		.ascii	"\305\347\230\377\305\347\231\377\306\347\231\377\306\347\231"
+ 933      C5E799FF 
+ 933      C6E799FF 
+ 933      C6E799
+ 934 2b6b FFC6E799 		.ascii	"\377\306\347\231\377\307\350\231\377\307\350\231\377\307\350"
+ 934      FFC7E899 
+ 934      FFC7E899 
+ 934      FFC7E8
+ 935 2b7a 9AFFC8E8 		.ascii	"\232\377\310\350\232\377\310\350\232\377\310\350\232\377\311"
+ 935      9AFFC8E8 
+ 935      9AFFC8E8 
+ 935      9AFFC9
+ 936 2b89 E99AFFC9 		.ascii	"\351\232\377\311\351\232\377\311\351\233\377\312\351\233\377"
+ 936      E99AFFC9 
+ 936      E99BFFCA 
+ 936      E99BFF
+ 937 2b98 CAE99BFF 		.ascii	"\312\351\233\377\312\351\233\377\313\351\233\377\313\352\233"
+ 937      CAE99BFF 
+ 937      CBE99BFF 
+ 937      CBEA9B
+ 938 2ba7 FFCBEA9C 		.ascii	"\377\313\352\234\377\314\352\234\377\314\352\234\377\314\352"
+ 938      FFCCEA9C 
+ 938      FFCCEA9C 
+ 938      FFCCEA
+ 939 2bb6 9CFFCDEA 		.ascii	"\234\377\315\352\234\377\315\352\234\377\316\353\235\377\316"
+ 939      9CFFCDEA 
+ 939      9CFFCEEB 
+ 939      9DFFCE
+ 940 2bc5 EB9DFFCE 		.ascii	"\353\235\377\316\353\235\377\317\353\235\377\317\353\235\377"
+GAS LISTING /tmp/ccRZCsvR.s 			page 51
+
+
+ 940      EB9DFFCF 
+ 940      EB9DFFCF 
+ 940      EB9DFF
+ 941 2bd4 CFEB9DFF 		.ascii	"\317\353\235\377\320\353\236\377\320\354\236\377\320\354\236"
+ 941      D0EB9EFF 
+ 941      D0EC9EFF 
+ 941      D0EC9E
+ 942 2be3 FFD1EC9E 		.ascii	"\377\321\354\236\377\321\354\236\377\321\354\237\377\322\354"
+ 942      FFD1EC9E 
+ 942      FFD1EC9F 
+ 942      FFD2EC
+ 943 2bf2 9FFFD2ED 		.ascii	"\237\377\322\355\237\377\322\355\237\377\323\355\237\377\323"
+ 943      9FFFD2ED 
+ 943      9FFFD3ED 
+ 943      9FFFD3
+ 944 2c01 ED9FFFD3 		.ascii	"\355\237\377\323\355\240\377\324\355\240\377\324\355\240\377"
+ 944      EDA0FFD4 
+ 944      EDA0FFD4 
+ 944      EDA0FF
+ 945 2c10 D4EEA0FF 		.ascii	"\324\356\240\377\325\356\240\377\325\356\240\377\325\356\241"
+ 945      D5EEA0FF 
+ 945      D5EEA0FF 
+ 945      D5EEA1
+ 946 2c1f FFD6EEA1 		.ascii	"\377\326\356\241\377\326\356\241\377\326\356\241\377\327\357"
+ 946      FFD6EEA1 
+ 946      FFD6EEA1 
+ 946      FFD7EF
+ 947 2c2e A1FFD7EF 		.ascii	"\241\377\327\357\242\377\327\357\242\377\330\357\242\377\330"
+ 947      A2FFD7EF 
+ 947      A2FFD8EF 
+ 947      A2FFD8
+ 948 2c3d EFA2FFD8 		.ascii	"\357\242\377\330\357\242\377\330\360\242\377\331\360\243\377"
+ 948      EFA2FFD8 
+ 948      F0A2FFD9 
+ 948      F0A3FF
+ 949 2c4c D9F0A3FF 		.ascii	"\331\360\243\377\331\360\243\377\331\360\243\377\332\360\243"
+ 949      D9F0A3FF 
+ 949      D9F0A3FF 
+ 949      DAF0A3
+ 950 2c5b FFDAF0A3 		.ascii	"\377\332\360\243\377\332\360\244\377\332\360\244\377\333\360"
+ 950      FFDAF0A4 
+ 950      FFDAF0A4 
+ 950      FFDBF0
+ 951 2c6a A4FFDBF0 		.ascii	"\244\377\333\360\244\377\333\361\244\377\333\361\244\377\334"
+ 951      A4FFDBF1 
+ 951      A4FFDBF1 
+ 951      A4FFDC
+ 952 2c79 F1A5FFDC 		.ascii	"\361\245\377\334\361\245\377\334\361\245\377\334\361\245\377"
+ 952      F1A5FFDC 
+ 952      F1A5FFDC 
+ 952      F1A5FF
+ 953 2c88 DDF1A5FF 		.ascii	"\335\361\245\377\335\361\245\377\335\361\246\377\335\361\246"
+ 953      DDF1A5FF 
+ 953      DDF1A6FF 
+ 953      DDF1A6
+ 954 2c97 FFDEF1A6 		.ascii	"\377\336\361\246\377\336\362\246\377\336\362\246\377\336\362"
+ 954      FFDEF2A6 
+GAS LISTING /tmp/ccRZCsvR.s 			page 52
+
+
+ 954      FFDEF2A6 
+ 954      FFDEF2
+ 955 2ca6 A6FFDFF2 		.ascii	"\246\377\337\362\247\377\337\362\247\377\337\362\247\377\337"
+ 955      A7FFDFF2 
+ 955      A7FFDFF2 
+ 955      A7FFDF
+ 956 2cb5 F2A7FFE0 		.ascii	"\362\247\377\340\362\247\377\340\362\247\377\340\362\247\377"
+ 956      F2A7FFE0 
+ 956      F2A7FFE0 
+ 956      F2A7FF
+ 957 2cc4 E0F2A8FF 		.ascii	"\340\362\250\377\341\363\250\377\341\363\250\377\341\363\250"
+ 957      E1F3A8FF 
+ 957      E1F3A8FF 
+ 957      E1F3A8
+ 958 2cd3 FFE1F3A8 		.ascii	"\377\341\363\250\377\342\363\250\377\342\363\251\377\342\363"
+ 958      FFE2F3A8 
+ 958      FFE2F3A9 
+ 958      FFE2F3
+ 959 2ce2 A9FFE2F3 		.ascii	"\251\377\342\363\251\377\343\363\251\377\343\363\251\377\343"
+ 959      A9FFE3F3 
+ 959      A9FFE3F3 
+ 959      A9FFE3
+ 960 2cf1 F3A9FFE3 		.ascii	"\363\251\377\343\364\252\377\343\364\252\377\344\364\252\377"
+ 960      F4AAFFE3 
+ 960      F4AAFFE4 
+ 960      F4AAFF
+ 961 2d00 E4F4AAFF 		.ascii	"\344\364\252\377\344\364\252\377\344\364\253\377\345\364\253"
+ 961      E4F4AAFF 
+ 961      E4F4ABFF 
+ 961      E5F4AB
+ 962 2d0f FFE5F4AB 		.ascii	"\377\345\364\253\377\345\364\253\377\345\364\253\377\346\364"
+ 962      FFE5F4AB 
+ 962      FFE5F4AB 
+ 962      FFE6F4
+ 963 2d1e ABFFE6F5 		.ascii	"\253\377\346\365\254\377\346\365\254\377\346\365\254\377\347"
+ 963      ACFFE6F5 
+ 963      ACFFE6F5 
+ 963      ACFFE7
+ 964 2d2d F5ACFFE7 		.ascii	"\365\254\377\347\365\254\377\347\365\254\377\347\365\255\377"
+ 964      F5ACFFE7 
+ 964      F5ACFFE7 
+ 964      F5ADFF
+ 965 2d3c E8F5ADFF 		.ascii	"\350\365\255\377\350\365\255\377\350\365\255\377\350\366\255"
+ 965      E8F5ADFF 
+ 965      E8F5ADFF 
+ 965      E8F6AD
+ 966 2d4b FFE8F6AD 		.ascii	"\377\350\366\255\377\351\366\256\377\351\366\256\377\351\366"
+ 966      FFE9F6AE 
+ 966      FFE9F6AE 
+ 966      FFE9F6
+ 967 2d5a AEFFE9F6 		.ascii	"\256\377\351\366\256\377\352\366\256\377\352\366\256\377\352"
+ 967      AEFFEAF6 
+ 967      AEFFEAF6 
+ 967      AEFFEA
+ 968 2d69 F6AFFFEA 		.ascii	"\366\257\377\352\366\257\377\353\366\257\377\353\367\257\377"
+ 968      F6AFFFEB 
+ 968      F6AFFFEB 
+GAS LISTING /tmp/ccRZCsvR.s 			page 53
+
+
+ 968      F7AFFF
+ 969 2d78 EBF7AFFF 		.ascii	"\353\367\257\377\353\367\257\377\353\367\260\377\354\367\260"
+ 969      EBF7AFFF 
+ 969      EBF7B0FF 
+ 969      ECF7B0
+ 970 2d87 FFECF7B0 		.ascii	"\377\354\367\260\377\354\367\260\377\354\367\260\377\355\367"
+ 970      FFECF7B0 
+ 970      FFECF7B0 
+ 970      FFEDF7
+ 971 2d96 B1FFEDF7 		.ascii	"\261\377\355\367\261\377\355\367\261\377\355\370\261\377\356"
+ 971      B1FFEDF7 
+ 971      B1FFEDF8 
+ 971      B1FFEE
+ 972 2da5 F8B1FFEE 		.ascii	"\370\261\377\356\370\261\377\356\370\262\377\356\370\262\377"
+ 972      F8B1FFEE 
+ 972      F8B2FFEE 
+ 972      F8B2FF
+ 973 2db4 EEF8B2FF 		.ascii	"\356\370\262\377\357\370\262\377\357\370\262\377\357\370\262"
+ 973      EFF8B2FF 
+ 973      EFF8B2FF 
+ 973      EFF8B2
+ 974 2dc3 FFEFF8B3 		.ascii	"\377\357\370\263\377\360\371\263\377\360\371\263\377\360\371"
+ 974      FFF0F9B3 
+ 974      FFF0F9B3 
+ 974      FFF0F9
+ 975 2dd2 B3FFF0F9 		.ascii	"\263\377\360\371\263\377\361\371\264\377\361\371\264\377\361"
+ 975      B3FFF1F9 
+ 975      B4FFF1F9 
+ 975      B4FFF1
+ 976 2de1 F9B4FFF1 		.ascii	"\371\264\377\361\371\264\377\361\371\264\377\362\371\264\377"
+ 976      F9B4FFF1 
+ 976      F9B4FFF2 
+ 976      F9B4FF
+ 977 2df0 F2F9B5FF 		.ascii	"\362\371\265\377\362\372\265\377\362\372\265\377\363\372\265"
+ 977      F2FAB5FF 
+ 977      F2FAB5FF 
+ 977      F3FAB5
+ 978 2dff FFF3FAB5 		.ascii	"\377\363\372\265\377\363\372\266\377\363\372\266\377\363\372"
+ 978      FFF3FAB6 
+ 978      FFF3FAB6 
+ 978      FFF3FA
+ 979 2e0e B6FFF4FA 		.ascii	"\266\377\364\372\266\377\364\372\266\377\364\372\266\377\364"
+ 979      B6FFF4FA 
+ 979      B6FFF4FA 
+ 979      B6FFF4
+ 980 2e1d FBB7FFF5 		.ascii	"\373\267\377\365\373\267\377\365\373\267\377\365\373\267\377"
+ 980      FBB7FFF5 
+ 980      FBB7FFF5 
+ 980      FBB7FF
+ 981 2e2c F5FBB7FF 		.ascii	"\365\373\267\377\365\373\270\377\366\373\270\377\366\373\270"
+ 981      F5FBB8FF 
+ 981      F6FBB8FF 
+ 981      F6FBB8
+ 982 2e3b FFF6FBB8 		.ascii	"\377\366\373\270\377\366\373\270\377\366\374\270\377\367\374"
+ 982      FFF6FBB8 
+ 982      FFF6FCB8 
+ 982      FFF7FC
+GAS LISTING /tmp/ccRZCsvR.s 			page 54
+
+
+ 983 2e4a B9FFF7FC 		.ascii	"\271\377\367\374\271\377\367\374\272\377\367\374\272\377\367"
+ 983      B9FFF7FC 
+ 983      BAFFF7FC 
+ 983      BAFFF7
+ 984 2e59 FCBAFFF7 		.ascii	"\374\272\377\367\374\273\377\367\374\273\377\367\374\273\377"
+ 984      FCBBFFF7 
+ 984      FCBBFFF7 
+ 984      FCBBFF
+ 985 2e68 F7FCBCFF 		.ascii	"\367\374\274\377\367\374\274\377\367\374\274\377\367\374\275"
+ 985      F7FCBCFF 
+ 985      F7FCBCFF 
+ 985      F7FCBD
+ 986 2e77 FFF8FCBD 		.ascii	"\377\370\374\275\377\370\374\275\377\370\374\276\377\370\374"
+ 986      FFF8FCBD 
+ 986      FFF8FCBE 
+ 986      FFF8FC
+ 987 2e86 BEFFF8FC 		.ascii	"\276\377\370\374\276\377\370\374\277\377\370\374\277\377\370"
+ 987      BEFFF8FC 
+ 987      BFFFF8FC 
+ 987      BFFFF8
+ 988 2e95 FCBFFFF8 		.ascii	"\374\277\377\370\374\300\377\370\374\300\377\370\374\300\377"
+ 988      FCC0FFF8 
+ 988      FCC0FFF8 
+ 988      FCC0FF
+ 989 2ea4 F8FCC1FF 		.ascii	"\370\374\301\377\370\374\301\377\371\374\301\377\371\374\302"
+ 989      F8FCC1FF 
+ 989      F9FCC1FF 
+ 989      F9FCC2
+ 990 2eb3 FFF9FCC2 		.ascii	"\377\371\374\302\377\371\374\302\377\371\374\303\377\371\374"
+ 990      FFF9FCC2 
+ 990      FFF9FCC3 
+ 990      FFF9FC
+ 991 2ec2 C3FFF9FC 		.ascii	"\303\377\371\374\303\377\371\374\304\377\371\374\304\377\371"
+ 991      C3FFF9FC 
+ 991      C4FFF9FC 
+ 991      C4FFF9
+ 992 2ed1 FCC5FFF9 		.ascii	"\374\305\377\371\374\305\377\371\374\305\377\371\374\306\377"
+ 992      FCC5FFF9 
+ 992      FCC5FFF9 
+ 992      FCC6FF
+ 993 2ee0 F9FCC6FF 		.ascii	"\371\374\306\377\372\374\306\377\372\374\307\377\372\374\307"
+ 993      FAFCC6FF 
+ 993      FAFCC7FF 
+ 993      FAFCC7
+ 994 2eef FFFAFCC7 		.ascii	"\377\372\374\307\377\372\374\310\377\372\374\310\377\372\374"
+ 994      FFFAFCC8 
+ 994      FFFAFCC8 
+ 994      FFFAFC
+ 995 2efe C8FFFAFD 		.ascii	"\310\377\372\375\311\377\372\375\311\377\372\375\311\377\372"
+ 995      C9FFFAFD 
+ 995      C9FFFAFD 
+ 995      C9FFFA
+ 996 2f0d FDCAFFFA 		.ascii	"\375\312\377\372\375\312\377\372\375\312\377\372\375\313\377"
+ 996      FDCAFFFA 
+ 996      FDCAFFFA 
+ 996      FDCBFF
+ 997 2f1c FAFDCBFF 		.ascii	"\372\375\313\377\373\375\313\377\373\375\314\377\373\375\314"
+GAS LISTING /tmp/ccRZCsvR.s 			page 55
+
+
+ 997      FBFDCBFF 
+ 997      FBFDCCFF 
+ 997      FBFDCC
+ 998 2f2b FFFBFDCC 		.ascii	"\377\373\375\314\377\373\375\315\377\373\375\315\377\373\375"
+ 998      FFFBFDCD 
+ 998      FFFBFDCD 
+ 998      FFFBFD
+ 999 2f3a CDFFFBFD 		.ascii	"\315\377\373\375\316\377\373\375\316\377\373\375\316\377\373"
+ 999      CEFFFBFD 
+ 999      CEFFFBFD 
+ 999      CEFFFB
+ 1000 2f49 FDCFFFFB 		.ascii	"\375\317\377\373\375\317\377\373\375\317\377\373\375\320\377"
+ 1000      FDCFFFFB 
+ 1000      FDCFFFFB 
+ 1000      FDD0FF
+ 1001 2f58 FBFDD0FF 		.ascii	"\373\375\320\377\374\375\321\377\374\375\321\377\374\375\321"
+ 1001      FCFDD1FF 
+ 1001      FCFDD1FF 
+ 1001      FCFDD1
+ 1002 2f67 FFFCFDD2 		.ascii	"\377\374\375\322\377\374\375\322\377\374\375\322\377\374\375"
+ 1002      FFFCFDD2 
+ 1002      FFFCFDD2 
+ 1002      FFFCFD
+ 1003 2f76 D3FFFCFD 		.ascii	"\323\377\374\375\323\377\374\375\323\377\374\375\324\377\374"
+ 1003      D3FFFCFD 
+ 1003      D3FFFCFD 
+ 1003      D4FFFC
+ 1004 2f85 FDD4FFFC 		.ascii	"\375\324\377\374\375\324\377\374\375\325\377\374\375\325\377"
+ 1004      FDD4FFFC 
+ 1004      FDD5FFFC 
+ 1004      FDD5FF
+ 1005 2f94 FCFDD5FF 		.ascii	"\374\375\325\377\374\375\326\377\374\375\326\377\374\375\326"
+ 1005      FCFDD6FF 
+ 1005      FCFDD6FF 
+ 1005      FCFDD6
+ 1006 2fa3 FFFDFDD7 		.ascii	"\377\375\375\327\377\375\376\327\377\375\376\327\377\375\376"
+ 1006      FFFDFED7 
+ 1006      FFFDFED7 
+ 1006      FFFDFE
+ 1007 2fb2 D8FFFDFE 		.ascii	"\330\377\375\376\330\377\375\376\330\377\375\376\331\377\375"
+ 1007      D8FFFDFE 
+ 1007      D8FFFDFE 
+ 1007      D9FFFD
+ 1008 2fc1 FED9FFFD 		.ascii	"\376\331\377\375\376\331\377\375\376\332\377\375\376\332\377"
+ 1008      FED9FFFD 
+ 1008      FEDAFFFD 
+ 1008      FEDAFF
+ 1009 2fd0 FDFEDAFF 		.ascii	"\375\376\332\377\375\376\333\377\375\376\333\377\375\376\334"
+ 1009      FDFEDBFF 
+ 1009      FDFEDBFF 
+ 1009      FDFEDC
+ 1010 2fdf FF       		.ascii	"\377"
+ 1011 2fe0 FDFEDCFF 		.ascii	"\375\376\334\377\375\376\334\377\375\376\335\377\375\376\335"
+ 1011      FDFEDCFF 
+ 1011      FDFEDDFF 
+ 1011      FDFEDD
+ 1012 2fef FFFEFEDD 		.ascii	"\377\376\376\335\377\376\376\336\377\376\376\336\377\376\376"
+GAS LISTING /tmp/ccRZCsvR.s 			page 56
+
+
+ 1012      FFFEFEDE 
+ 1012      FFFEFEDE 
+ 1012      FFFEFE
+ 1013 2ffe DEFFFEFE 		.ascii	"\336\377\376\376\337\377\376\376\337\377\376\376\337\377\376"
+ 1013      DFFFFEFE 
+ 1013      DFFFFEFE 
+ 1013      DFFFFE
+ 1014 300d FEE0FFFE 		.ascii	"\376\340\377\376\376\340\377\376\376\340\377\376\376\341\377"
+ 1014      FEE0FFFE 
+ 1014      FEE0FFFE 
+ 1014      FEE1FF
+ 1015 301c FEFEE1FF 		.ascii	"\376\376\341\377\376\376\341\377\376\376\342\377\376\376\342"
+ 1015      FEFEE1FF 
+ 1015      FEFEE2FF 
+ 1015      FEFEE2
+ 1016 302b FFFEFEE2 		.ascii	"\377\376\376\342\377\376\376\343\377\376\376\343\377\376\376"
+ 1016      FFFEFEE3 
+ 1016      FFFEFEE3 
+ 1016      FFFEFE
+ 1017 303a E3FFFEFE 		.ascii	"\343\377\376\376\344\377\376\376\344\377"
+ 1017      E4FFFEFE 
+ 1017      E4FF
+ 1018              		.globl	heatmap_cs_YlGn_discrete
+ 1019              		.section	.data.rel.local
+ 1020              		.align 8
+ 1021              		.type	heatmap_cs_YlGn_discrete, @object
+ 1022              		.size	heatmap_cs_YlGn_discrete, 8
+ 1023              	heatmap_cs_YlGn_discrete:
+ 1024 0018 00000000 		.quad	discrete
+ 1024      00000000 
+ 1025              		.section	.data.rel.ro.local
+ 1026              		.align 16
+ 1027              		.type	discrete, @object
+ 1028              		.size	discrete, 16
+ 1029              	discrete:
+ 1030 0030 00000000 		.quad	discrete_data
+ 1030      00000000 
+ 1031 0038 0A000000 		.quad	10
+ 1031      00000000 
+ 1032              		.section	.rodata
+ 1033 3044 00000000 		.align 32
+ 1033      00000000 
+ 1033      00000000 
+ 1033      00000000 
+ 1033      00000000 
+ 1034              		.type	discrete_data, @object
+ 1035              		.size	discrete_data, 40
+ 1036              	discrete_data:
+ 1037 3060 00       		.string	""
+ 1038 3061 00       		.string	""
+ 1039 3062 00       		.string	""
+ 1040 3063 00       		.string	""
+ 1041 3064 00       		.string	""
+ 1042 3065 4529FF00 		.string	"E)\377"
+ 1043 3069 6837FF23 		.ascii	"h7\377#\204C\377A\253]\377x\306y\377\255\335\216\377\331\360"
+ 1043      8443FF41 
+ 1043      AB5DFF78 
+GAS LISTING /tmp/ccRZCsvR.s 			page 57
+
+
+ 1043      C679FFAD 
+ 1043      DD8EFFD9 
+ 1044 307e A3FFF7FC 		.ascii	"\243\377\367\374\271\377\377\377\345\377"
+ 1044      B9FFFFFF 
+ 1044      E5FF
+ 1045              		.text
+ 1046              	.Letext0:
+ 1047              		.file 1 "./heatmap.h"
+ 1048              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1049              		.file 3 "./colorschemes/YlGn.h"
+ 1050              		.file 4 "colorschemes/YlGn.c"
+ 1051              		.section	.debug_info,"",@progbits
+ 1052              	.Ldebug_info0:
+ 1053 0000 E3010000 		.long	0x1e3
+ 1054 0004 0500     		.value	0x5
+ 1055 0006 01       		.byte	0x1
+ 1056 0007 08       		.byte	0x8
+ 1057 0008 00000000 		.long	.Ldebug_abbrev0
+ 1058 000c 0A       		.uleb128 0xa
+ 1059 000d 00000000 		.long	.LASF26
+ 1060 0011 1D       		.byte	0x1d
+ 1061 0012 00000000 		.long	.LASF0
+ 1062 0016 00000000 		.long	.LASF1
+ 1063 001a 00000000 		.long	.Ldebug_line0
+ 1064 001e 01       		.uleb128 0x1
+ 1065 001f 08       		.byte	0x8
+ 1066 0020 05       		.byte	0x5
+ 1067 0021 00000000 		.long	.LASF2
+ 1068 0025 06       		.uleb128 0x6
+ 1069 0026 00000000 		.long	.LASF12
+ 1070 002a 02       		.byte	0x2
+ 1071 002b D6       		.byte	0xd6
+ 1072 002c 17       		.byte	0x17
+ 1073 002d 31000000 		.long	0x31
+ 1074 0031 01       		.uleb128 0x1
+ 1075 0032 08       		.byte	0x8
+ 1076 0033 07       		.byte	0x7
+ 1077 0034 00000000 		.long	.LASF3
+ 1078 0038 0B       		.uleb128 0xb
+ 1079 0039 04       		.byte	0x4
+ 1080 003a 05       		.byte	0x5
+ 1081 003b 696E7400 		.string	"int"
+ 1082 003f 01       		.uleb128 0x1
+ 1083 0040 08       		.byte	0x8
+ 1084 0041 05       		.byte	0x5
+ 1085 0042 00000000 		.long	.LASF4
+ 1086 0046 01       		.uleb128 0x1
+ 1087 0047 10       		.byte	0x10
+ 1088 0048 04       		.byte	0x4
+ 1089 0049 00000000 		.long	.LASF5
+ 1090 004d 01       		.uleb128 0x1
+ 1091 004e 04       		.byte	0x4
+ 1092 004f 04       		.byte	0x4
+ 1093 0050 00000000 		.long	.LASF6
+ 1094 0054 01       		.uleb128 0x1
+ 1095 0055 04       		.byte	0x4
+ 1096 0056 07       		.byte	0x7
+GAS LISTING /tmp/ccRZCsvR.s 			page 58
+
+
+ 1097 0057 00000000 		.long	.LASF7
+ 1098 005b 01       		.uleb128 0x1
+ 1099 005c 02       		.byte	0x2
+ 1100 005d 07       		.byte	0x7
+ 1101 005e 00000000 		.long	.LASF8
+ 1102 0062 0C       		.uleb128 0xc
+ 1103 0063 10       		.byte	0x10
+ 1104 0064 01       		.byte	0x1
+ 1105 0065 BB       		.byte	0xbb
+ 1106 0066 09       		.byte	0x9
+ 1107 0067 84000000 		.long	0x84
+ 1108 006b 07       		.uleb128 0x7
+ 1109 006c 00000000 		.long	.LASF9
+ 1110 0070 BC       		.byte	0xbc
+ 1111 0071 1A       		.byte	0x1a
+ 1112 0072 84000000 		.long	0x84
+ 1113 0076 00       		.byte	0
+ 1114 0077 07       		.uleb128 0x7
+ 1115 0078 00000000 		.long	.LASF10
+ 1116 007c BD       		.byte	0xbd
+ 1117 007d 0C       		.byte	0xc
+ 1118 007e 25000000 		.long	0x25
+ 1119 0082 08       		.byte	0x8
+ 1120 0083 00       		.byte	0
+ 1121 0084 08       		.uleb128 0x8
+ 1122 0085 90000000 		.long	0x90
+ 1123 0089 01       		.uleb128 0x1
+ 1124 008a 01       		.byte	0x1
+ 1125 008b 08       		.byte	0x8
+ 1126 008c 00000000 		.long	.LASF11
+ 1127 0090 03       		.uleb128 0x3
+ 1128 0091 89000000 		.long	0x89
+ 1129 0095 06       		.uleb128 0x6
+ 1130 0096 00000000 		.long	.LASF13
+ 1131 009a 01       		.byte	0x1
+ 1132 009b BE       		.byte	0xbe
+ 1133 009c 03       		.byte	0x3
+ 1134 009d 62000000 		.long	0x62
+ 1135 00a1 03       		.uleb128 0x3
+ 1136 00a2 95000000 		.long	0x95
+ 1137 00a6 08       		.uleb128 0x8
+ 1138 00a7 A1000000 		.long	0xa1
+ 1139 00ab 04       		.uleb128 0x4
+ 1140 00ac 00000000 		.long	.LASF14
+ 1141 00b0 21       		.byte	0x21
+ 1142 00b1 A6000000 		.long	0xa6
+ 1143 00b5 04       		.uleb128 0x4
+ 1144 00b6 00000000 		.long	.LASF15
+ 1145 00ba 23       		.byte	0x23
+ 1146 00bb A6000000 		.long	0xa6
+ 1147 00bf 04       		.uleb128 0x4
+ 1148 00c0 00000000 		.long	.LASF16
+ 1149 00c4 25       		.byte	0x25
+ 1150 00c5 A6000000 		.long	0xa6
+ 1151 00c9 04       		.uleb128 0x4
+ 1152 00ca 00000000 		.long	.LASF17
+ 1153 00ce 28       		.byte	0x28
+GAS LISTING /tmp/ccRZCsvR.s 			page 59
+
+
+ 1154 00cf A6000000 		.long	0xa6
+ 1155 00d3 09       		.uleb128 0x9
+ 1156 00d4 90000000 		.long	0x90
+ 1157 00d8 E3000000 		.long	0xe3
+ 1158 00dc 0D       		.uleb128 0xd
+ 1159 00dd 31000000 		.long	0x31
+ 1160 00e1 27       		.byte	0x27
+ 1161 00e2 00       		.byte	0
+ 1162 00e3 03       		.uleb128 0x3
+ 1163 00e4 D3000000 		.long	0xd3
+ 1164 00e8 02       		.uleb128 0x2
+ 1165 00e9 00000000 		.long	.LASF18
+ 1166 00ed 20       		.byte	0x20
+ 1167 00ee 1C       		.byte	0x1c
+ 1168 00ef E3000000 		.long	0xe3
+ 1169 00f3 09       		.uleb128 0x9
+ 1170 00f4 03       		.byte	0x3
+ 1171 00f5 00000000 		.quad	discrete_data
+ 1171      00000000 
+ 1172 00fd 02       		.uleb128 0x2
+ 1173 00fe 00000000 		.long	.LASF19
+ 1174 0102 23       		.byte	0x23
+ 1175 0103 24       		.byte	0x24
+ 1176 0104 A1000000 		.long	0xa1
+ 1177 0108 09       		.uleb128 0x9
+ 1178 0109 03       		.byte	0x3
+ 1179 010a 00000000 		.quad	discrete
+ 1179      00000000 
+ 1180 0112 05       		.uleb128 0x5
+ 1181 0113 AB000000 		.long	0xab
+ 1182 0117 24       		.byte	0x24
+ 1183 0118 09       		.uleb128 0x9
+ 1184 0119 03       		.byte	0x3
+ 1185 011a 00000000 		.quad	heatmap_cs_YlGn_discrete
+ 1185      00000000 
+ 1186 0122 09       		.uleb128 0x9
+ 1187 0123 90000000 		.long	0x90
+ 1188 0127 33010000 		.long	0x133
+ 1189 012b 0E       		.uleb128 0xe
+ 1190 012c 31000000 		.long	0x31
+ 1191 0130 0310     		.value	0x1003
+ 1192 0132 00       		.byte	0
+ 1193 0133 03       		.uleb128 0x3
+ 1194 0134 22010000 		.long	0x122
+ 1195 0138 02       		.uleb128 0x2
+ 1196 0139 00000000 		.long	.LASF20
+ 1197 013d 26       		.byte	0x26
+ 1198 013e 1C       		.byte	0x1c
+ 1199 013f 33010000 		.long	0x133
+ 1200 0143 09       		.uleb128 0x9
+ 1201 0144 03       		.byte	0x3
+ 1202 0145 00000000 		.quad	soft_data
+ 1202      00000000 
+ 1203 014d 02       		.uleb128 0x2
+ 1204 014e 00000000 		.long	.LASF21
+ 1205 0152 29       		.byte	0x29
+ 1206 0153 24       		.byte	0x24
+GAS LISTING /tmp/ccRZCsvR.s 			page 60
+
+
+ 1207 0154 A1000000 		.long	0xa1
+ 1208 0158 09       		.uleb128 0x9
+ 1209 0159 03       		.byte	0x3
+ 1210 015a 00000000 		.quad	soft
+ 1210      00000000 
+ 1211 0162 05       		.uleb128 0x5
+ 1212 0163 B5000000 		.long	0xb5
+ 1213 0167 2A       		.byte	0x2a
+ 1214 0168 09       		.uleb128 0x9
+ 1215 0169 03       		.byte	0x3
+ 1216 016a 00000000 		.quad	heatmap_cs_YlGn_soft
+ 1216      00000000 
+ 1217 0172 02       		.uleb128 0x2
+ 1218 0173 00000000 		.long	.LASF22
+ 1219 0177 2C       		.byte	0x2c
+ 1220 0178 1C       		.byte	0x1c
+ 1221 0179 33010000 		.long	0x133
+ 1222 017d 09       		.uleb128 0x9
+ 1223 017e 03       		.byte	0x3
+ 1224 017f 00000000 		.quad	mixed_data
+ 1224      00000000 
+ 1225 0187 02       		.uleb128 0x2
+ 1226 0188 00000000 		.long	.LASF23
+ 1227 018c 2F       		.byte	0x2f
+ 1228 018d 24       		.byte	0x24
+ 1229 018e A1000000 		.long	0xa1
+ 1230 0192 09       		.uleb128 0x9
+ 1231 0193 03       		.byte	0x3
+ 1232 0194 00000000 		.quad	mixed
+ 1232      00000000 
+ 1233 019c 05       		.uleb128 0x5
+ 1234 019d BF000000 		.long	0xbf
+ 1235 01a1 30       		.byte	0x30
+ 1236 01a2 09       		.uleb128 0x9
+ 1237 01a3 03       		.byte	0x3
+ 1238 01a4 00000000 		.quad	heatmap_cs_YlGn_mixed
+ 1238      00000000 
+ 1239 01ac 02       		.uleb128 0x2
+ 1240 01ad 00000000 		.long	.LASF24
+ 1241 01b1 32       		.byte	0x32
+ 1242 01b2 1C       		.byte	0x1c
+ 1243 01b3 33010000 		.long	0x133
+ 1244 01b7 09       		.uleb128 0x9
+ 1245 01b8 03       		.byte	0x3
+ 1246 01b9 00000000 		.quad	mixed_exp_data
+ 1246      00000000 
+ 1247 01c1 02       		.uleb128 0x2
+ 1248 01c2 00000000 		.long	.LASF25
+ 1249 01c6 35       		.byte	0x35
+ 1250 01c7 24       		.byte	0x24
+ 1251 01c8 A1000000 		.long	0xa1
+ 1252 01cc 09       		.uleb128 0x9
+ 1253 01cd 03       		.byte	0x3
+ 1254 01ce 00000000 		.quad	mixed_exp
+ 1254      00000000 
+ 1255 01d6 05       		.uleb128 0x5
+ 1256 01d7 C9000000 		.long	0xc9
+GAS LISTING /tmp/ccRZCsvR.s 			page 61
+
+
+ 1257 01db 36       		.byte	0x36
+ 1258 01dc 09       		.uleb128 0x9
+ 1259 01dd 03       		.byte	0x3
+ 1260 01de 00000000 		.quad	heatmap_cs_YlGn_mixed_exp
+ 1260      00000000 
+ 1261 01e6 00       		.byte	0
+ 1262              		.section	.debug_abbrev,"",@progbits
+ 1263              	.Ldebug_abbrev0:
+ 1264 0000 01       		.uleb128 0x1
+ 1265 0001 24       		.uleb128 0x24
+ 1266 0002 00       		.byte	0
+ 1267 0003 0B       		.uleb128 0xb
+ 1268 0004 0B       		.uleb128 0xb
+ 1269 0005 3E       		.uleb128 0x3e
+ 1270 0006 0B       		.uleb128 0xb
+ 1271 0007 03       		.uleb128 0x3
+ 1272 0008 0E       		.uleb128 0xe
+ 1273 0009 00       		.byte	0
+ 1274 000a 00       		.byte	0
+ 1275 000b 02       		.uleb128 0x2
+ 1276 000c 34       		.uleb128 0x34
+ 1277 000d 00       		.byte	0
+ 1278 000e 03       		.uleb128 0x3
+ 1279 000f 0E       		.uleb128 0xe
+ 1280 0010 3A       		.uleb128 0x3a
+ 1281 0011 21       		.uleb128 0x21
+ 1282 0012 04       		.sleb128 4
+ 1283 0013 3B       		.uleb128 0x3b
+ 1284 0014 0B       		.uleb128 0xb
+ 1285 0015 39       		.uleb128 0x39
+ 1286 0016 0B       		.uleb128 0xb
+ 1287 0017 49       		.uleb128 0x49
+ 1288 0018 13       		.uleb128 0x13
+ 1289 0019 02       		.uleb128 0x2
+ 1290 001a 18       		.uleb128 0x18
+ 1291 001b 00       		.byte	0
+ 1292 001c 00       		.byte	0
+ 1293 001d 03       		.uleb128 0x3
+ 1294 001e 26       		.uleb128 0x26
+ 1295 001f 00       		.byte	0
+ 1296 0020 49       		.uleb128 0x49
+ 1297 0021 13       		.uleb128 0x13
+ 1298 0022 00       		.byte	0
+ 1299 0023 00       		.byte	0
+ 1300 0024 04       		.uleb128 0x4
+ 1301 0025 34       		.uleb128 0x34
+ 1302 0026 00       		.byte	0
+ 1303 0027 03       		.uleb128 0x3
+ 1304 0028 0E       		.uleb128 0xe
+ 1305 0029 3A       		.uleb128 0x3a
+ 1306 002a 21       		.uleb128 0x21
+ 1307 002b 03       		.sleb128 3
+ 1308 002c 3B       		.uleb128 0x3b
+ 1309 002d 0B       		.uleb128 0xb
+ 1310 002e 39       		.uleb128 0x39
+ 1311 002f 21       		.uleb128 0x21
+ 1312 0030 25       		.sleb128 37
+GAS LISTING /tmp/ccRZCsvR.s 			page 62
+
+
+ 1313 0031 49       		.uleb128 0x49
+ 1314 0032 13       		.uleb128 0x13
+ 1315 0033 3F       		.uleb128 0x3f
+ 1316 0034 19       		.uleb128 0x19
+ 1317 0035 3C       		.uleb128 0x3c
+ 1318 0036 19       		.uleb128 0x19
+ 1319 0037 00       		.byte	0
+ 1320 0038 00       		.byte	0
+ 1321 0039 05       		.uleb128 0x5
+ 1322 003a 34       		.uleb128 0x34
+ 1323 003b 00       		.byte	0
+ 1324 003c 47       		.uleb128 0x47
+ 1325 003d 13       		.uleb128 0x13
+ 1326 003e 3A       		.uleb128 0x3a
+ 1327 003f 21       		.uleb128 0x21
+ 1328 0040 04       		.sleb128 4
+ 1329 0041 3B       		.uleb128 0x3b
+ 1330 0042 0B       		.uleb128 0xb
+ 1331 0043 39       		.uleb128 0x39
+ 1332 0044 21       		.uleb128 0x21
+ 1333 0045 1E       		.sleb128 30
+ 1334 0046 02       		.uleb128 0x2
+ 1335 0047 18       		.uleb128 0x18
+ 1336 0048 00       		.byte	0
+ 1337 0049 00       		.byte	0
+ 1338 004a 06       		.uleb128 0x6
+ 1339 004b 16       		.uleb128 0x16
+ 1340 004c 00       		.byte	0
+ 1341 004d 03       		.uleb128 0x3
+ 1342 004e 0E       		.uleb128 0xe
+ 1343 004f 3A       		.uleb128 0x3a
+ 1344 0050 0B       		.uleb128 0xb
+ 1345 0051 3B       		.uleb128 0x3b
+ 1346 0052 0B       		.uleb128 0xb
+ 1347 0053 39       		.uleb128 0x39
+ 1348 0054 0B       		.uleb128 0xb
+ 1349 0055 49       		.uleb128 0x49
+ 1350 0056 13       		.uleb128 0x13
+ 1351 0057 00       		.byte	0
+ 1352 0058 00       		.byte	0
+ 1353 0059 07       		.uleb128 0x7
+ 1354 005a 0D       		.uleb128 0xd
+ 1355 005b 00       		.byte	0
+ 1356 005c 03       		.uleb128 0x3
+ 1357 005d 0E       		.uleb128 0xe
+ 1358 005e 3A       		.uleb128 0x3a
+ 1359 005f 21       		.uleb128 0x21
+ 1360 0060 01       		.sleb128 1
+ 1361 0061 3B       		.uleb128 0x3b
+ 1362 0062 0B       		.uleb128 0xb
+ 1363 0063 39       		.uleb128 0x39
+ 1364 0064 0B       		.uleb128 0xb
+ 1365 0065 49       		.uleb128 0x49
+ 1366 0066 13       		.uleb128 0x13
+ 1367 0067 38       		.uleb128 0x38
+ 1368 0068 0B       		.uleb128 0xb
+ 1369 0069 00       		.byte	0
+GAS LISTING /tmp/ccRZCsvR.s 			page 63
+
+
+ 1370 006a 00       		.byte	0
+ 1371 006b 08       		.uleb128 0x8
+ 1372 006c 0F       		.uleb128 0xf
+ 1373 006d 00       		.byte	0
+ 1374 006e 0B       		.uleb128 0xb
+ 1375 006f 21       		.uleb128 0x21
+ 1376 0070 08       		.sleb128 8
+ 1377 0071 49       		.uleb128 0x49
+ 1378 0072 13       		.uleb128 0x13
+ 1379 0073 00       		.byte	0
+ 1380 0074 00       		.byte	0
+ 1381 0075 09       		.uleb128 0x9
+ 1382 0076 01       		.uleb128 0x1
+ 1383 0077 01       		.byte	0x1
+ 1384 0078 49       		.uleb128 0x49
+ 1385 0079 13       		.uleb128 0x13
+ 1386 007a 01       		.uleb128 0x1
+ 1387 007b 13       		.uleb128 0x13
+ 1388 007c 00       		.byte	0
+ 1389 007d 00       		.byte	0
+ 1390 007e 0A       		.uleb128 0xa
+ 1391 007f 11       		.uleb128 0x11
+ 1392 0080 01       		.byte	0x1
+ 1393 0081 25       		.uleb128 0x25
+ 1394 0082 0E       		.uleb128 0xe
+ 1395 0083 13       		.uleb128 0x13
+ 1396 0084 0B       		.uleb128 0xb
+ 1397 0085 03       		.uleb128 0x3
+ 1398 0086 1F       		.uleb128 0x1f
+ 1399 0087 1B       		.uleb128 0x1b
+ 1400 0088 1F       		.uleb128 0x1f
+ 1401 0089 10       		.uleb128 0x10
+ 1402 008a 17       		.uleb128 0x17
+ 1403 008b 00       		.byte	0
+ 1404 008c 00       		.byte	0
+ 1405 008d 0B       		.uleb128 0xb
+ 1406 008e 24       		.uleb128 0x24
+ 1407 008f 00       		.byte	0
+ 1408 0090 0B       		.uleb128 0xb
+ 1409 0091 0B       		.uleb128 0xb
+ 1410 0092 3E       		.uleb128 0x3e
+ 1411 0093 0B       		.uleb128 0xb
+ 1412 0094 03       		.uleb128 0x3
+ 1413 0095 08       		.uleb128 0x8
+ 1414 0096 00       		.byte	0
+ 1415 0097 00       		.byte	0
+ 1416 0098 0C       		.uleb128 0xc
+ 1417 0099 13       		.uleb128 0x13
+ 1418 009a 01       		.byte	0x1
+ 1419 009b 0B       		.uleb128 0xb
+ 1420 009c 0B       		.uleb128 0xb
+ 1421 009d 3A       		.uleb128 0x3a
+ 1422 009e 0B       		.uleb128 0xb
+ 1423 009f 3B       		.uleb128 0x3b
+ 1424 00a0 0B       		.uleb128 0xb
+ 1425 00a1 39       		.uleb128 0x39
+ 1426 00a2 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccRZCsvR.s 			page 64
+
+
+ 1427 00a3 01       		.uleb128 0x1
+ 1428 00a4 13       		.uleb128 0x13
+ 1429 00a5 00       		.byte	0
+ 1430 00a6 00       		.byte	0
+ 1431 00a7 0D       		.uleb128 0xd
+ 1432 00a8 21       		.uleb128 0x21
+ 1433 00a9 00       		.byte	0
+ 1434 00aa 49       		.uleb128 0x49
+ 1435 00ab 13       		.uleb128 0x13
+ 1436 00ac 2F       		.uleb128 0x2f
+ 1437 00ad 0B       		.uleb128 0xb
+ 1438 00ae 00       		.byte	0
+ 1439 00af 00       		.byte	0
+ 1440 00b0 0E       		.uleb128 0xe
+ 1441 00b1 21       		.uleb128 0x21
+ 1442 00b2 00       		.byte	0
+ 1443 00b3 49       		.uleb128 0x49
+ 1444 00b4 13       		.uleb128 0x13
+ 1445 00b5 2F       		.uleb128 0x2f
+ 1446 00b6 05       		.uleb128 0x5
+ 1447 00b7 00       		.byte	0
+ 1448 00b8 00       		.byte	0
+ 1449 00b9 00       		.byte	0
+ 1450              		.section	.debug_aranges,"",@progbits
+ 1451 0000 1C000000 		.long	0x1c
+ 1452 0004 0200     		.value	0x2
+ 1453 0006 00000000 		.long	.Ldebug_info0
+ 1454 000a 08       		.byte	0x8
+ 1455 000b 00       		.byte	0
+ 1456 000c 0000     		.value	0
+ 1457 000e 0000     		.value	0
+ 1458 0010 00000000 		.quad	0
+ 1458      00000000 
+ 1459 0018 00000000 		.quad	0
+ 1459      00000000 
+ 1460              		.section	.debug_line,"",@progbits
+ 1461              	.Ldebug_line0:
+ 1462 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1462      05000800 
+ 1462      49000000 
+ 1462      010101FB 
+ 1462      0E0D0001 
+ 1463              	.LASF20:
+ 1464 0000 736F6674 		.string	"soft_data"
+ 1464      5F646174 
+ 1464      6100
+ 1465              	.LASF12:
+ 1466 000a 73697A65 		.string	"size_t"
+ 1466      5F7400
+ 1467              	.LASF13:
+ 1468 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1468      6D61705F 
+ 1468      636F6C6F 
+ 1468      72736368 
+ 1468      656D655F 
+ 1469              	.LASF14:
+ 1470 0027 68656174 		.string	"heatmap_cs_YlGn_discrete"
+GAS LISTING /tmp/ccRZCsvR.s 			page 65
+
+
+ 1470      6D61705F 
+ 1470      63735F59 
+ 1470      6C476E5F 
+ 1470      64697363 
+ 1471              	.LASF26:
+ 1472 0040 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1472      43313720 
+ 1472      31322E32 
+ 1472      2E30202D 
+ 1472      6D74756E 
+ 1473              	.LASF6:
+ 1474 009f 666C6F61 		.string	"float"
+ 1474      7400
+ 1475              	.LASF11:
+ 1476 00a5 756E7369 		.string	"unsigned char"
+ 1476      676E6564 
+ 1476      20636861 
+ 1476      7200
+ 1477              	.LASF3:
+ 1478 00b3 6C6F6E67 		.string	"long unsigned int"
+ 1478      20756E73 
+ 1478      69676E65 
+ 1478      6420696E 
+ 1478      7400
+ 1479              	.LASF8:
+ 1480 00c5 73686F72 		.string	"short unsigned int"
+ 1480      7420756E 
+ 1480      7369676E 
+ 1480      65642069 
+ 1480      6E7400
+ 1481              	.LASF25:
+ 1482 00d8 6D697865 		.string	"mixed_exp"
+ 1482      645F6578 
+ 1482      7000
+ 1483              	.LASF23:
+ 1484 00e2 6D697865 		.string	"mixed"
+ 1484      6400
+ 1485              	.LASF7:
+ 1486 00e8 756E7369 		.string	"unsigned int"
+ 1486      676E6564 
+ 1486      20696E74 
+ 1486      00
+ 1487              	.LASF19:
+ 1488 00f5 64697363 		.string	"discrete"
+ 1488      72657465 
+ 1488      00
+ 1489              	.LASF17:
+ 1490 00fe 68656174 		.string	"heatmap_cs_YlGn_mixed_exp"
+ 1490      6D61705F 
+ 1490      63735F59 
+ 1490      6C476E5F 
+ 1490      6D697865 
+ 1491              	.LASF16:
+ 1492 0118 68656174 		.string	"heatmap_cs_YlGn_mixed"
+ 1492      6D61705F 
+ 1492      63735F59 
+ 1492      6C476E5F 
+GAS LISTING /tmp/ccRZCsvR.s 			page 66
+
+
+ 1492      6D697865 
+ 1493              	.LASF10:
+ 1494 012e 6E636F6C 		.string	"ncolors"
+ 1494      6F727300 
+ 1495              	.LASF15:
+ 1496 0136 68656174 		.string	"heatmap_cs_YlGn_soft"
+ 1496      6D61705F 
+ 1496      63735F59 
+ 1496      6C476E5F 
+ 1496      736F6674 
+ 1497              	.LASF4:
+ 1498 014b 6C6F6E67 		.string	"long long int"
+ 1498      206C6F6E 
+ 1498      6720696E 
+ 1498      7400
+ 1499              	.LASF24:
+ 1500 0159 6D697865 		.string	"mixed_exp_data"
+ 1500      645F6578 
+ 1500      705F6461 
+ 1500      746100
+ 1501              	.LASF22:
+ 1502 0168 6D697865 		.string	"mixed_data"
+ 1502      645F6461 
+ 1502      746100
+ 1503              	.LASF2:
+ 1504 0173 6C6F6E67 		.string	"long int"
+ 1504      20696E74 
+ 1504      00
+ 1505              	.LASF5:
+ 1506 017c 6C6F6E67 		.string	"long double"
+ 1506      20646F75 
+ 1506      626C6500 
+ 1507              	.LASF18:
+ 1508 0188 64697363 		.string	"discrete_data"
+ 1508      72657465 
+ 1508      5F646174 
+ 1508      6100
+ 1509              	.LASF21:
+ 1510 0196 736F6674 		.string	"soft"
+ 1510      00
+ 1511              	.LASF9:
+ 1512 019b 636F6C6F 		.string	"colors"
+ 1512      727300
+ 1513              		.section	.debug_line_str,"MS",@progbits,1
+ 1514              	.LASF0:
+ 1515 0000 636F6C6F 		.string	"colorschemes/YlGn.c"
+ 1515      72736368 
+ 1515      656D6573 
+ 1515      2F596C47 
+ 1515      6E2E6300 
+ 1516              	.LASF1:
+ 1517 0014 2F726F6F 		.string	"/root/repo"
+ 1517      742F7265 
+ 1517      706F00
+ 1518              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1519 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1519      742F7265 
+GAS LISTING /tmp/ccRZCsvR.s 			page 67
+
+
+ 1519      706F0063 
+ 1519      6F6C6F72 
+ 1519      73636865 
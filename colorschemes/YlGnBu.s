@@ -0,0 +1,4103 @@
+GAS LISTING /tmp/ccjrIsGY.s 			page 1
+
+
+   1              		.file	"YlGnBu.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/YlGnBu.c"
+   5              		.globl	heatmap_cs_YlGnBu_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_YlGnBu_mixed_exp, @object
+   9              		.size	heatmap_cs_YlGnBu_mixed_exp, 8
+  10              	heatmap_cs_YlGnBu_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 081C5800 		.string	"\b\034X"
+  29 0008 091E5B18 		.ascii	"\t\036[\030\013\037_1\f!bJ\016\"fc\017#i|\021%m\225\031+}\256"
+  29      0B1F5F31 
+  29      0C21624A 
+  29      0E226663 
+  29      0F23697C 
+  30 0024 1A2C80C7 		.ascii	"\032,\200\307\034.\204\340\036/\207\371 0\213\377\"1\216\377"
+  30      1C2E84E0 
+  30      1E2F87F9 
+  30      20308BFF 
+  30      22318EFF 
+  31 0038 233391FF 		.ascii	"#3\221\377$5\224\377#7\226\377!:\227\377 <\230\377\037>\231\377"
+  31      243594FF 
+  31      233796FF 
+  31      213A97FF 
+  31      203C98FF 
+  32 0050 1F419BFF 		.ascii	"\037A\233\377\036C\234\377\036E\235\377\035P\242\377\035R\243"
+  32      1E439CFF 
+  32      1E459DFF 
+  32      1D50A2FF 
+  32      1D52A3
+  33 0063 FF1D54A4 		.ascii	"\377\035T\244\377\036V\244\377\036X\245\377\037Z\246\377 \\\247"
+  33      FF1E56A4 
+  33      FF1E58A5 
+  33      FF1F5AA6 
+  33      FF205CA7 
+  34 0077 FF215DA7 		.ascii	"\377!]\247\377\037`\251\377\034c\253\377\030e\254\377\025g\256"
+GAS LISTING /tmp/ccjrIsGY.s 			page 2
+
+
+  34      FF1F60A9 
+  34      FF1C63AB 
+  34      FF1865AC 
+  34      FF1567AE 
+  35 008b FF126AAF 		.ascii	"\377\022j\257\377\017l\260\377\fo\261\377\nq\262\377\007}\270"
+  35      FF0F6CB0 
+  35      FF0C6FB1 
+  35      FF0A71B2 
+  35      FF077DB8 
+  36 009f FF0780B9 		.ascii	"\377\007\200\271\377\b\202\272\377\t\204\273\377\f\206\274\377"
+  36      FF0882BA 
+  36      FF0984BB 
+  36      FF0C86BC 
+  36      FF
+  37 00b0 0F88BDFF 		.ascii	"\017\210\275\377\022\212\275\377\026\214\276\377\031\216\277"
+  37      128ABDFF 
+  37      168CBEFF 
+  37      198EBF
+  38 00bf FF1C90BF 		.ascii	"\377\034\220\277\377\034\222\300\377\033\224\300\377\033\225"
+  38      FF1C92C0 
+  38      FF1B94C0 
+  38      FF1B95
+  39 00ce C1FF1B97 		.ascii	"\301\377\033\227\301\377\033\230\301\377\034\232\302\377\035"
+  39      C1FF1B98 
+  39      C1FF1C9A 
+  39      C2FF1D
+  40 00dd 9BC2FF1E 		.ascii	"\233\302\377\036\235\302\377\037\236\302\377!\237\302\377*\250"
+  40      9DC2FF1F 
+  40      9EC2FF21 
+  40      9FC2FF2A 
+  40      A8
+  41 00ee C3FF2CAA 		.ascii	"\303\377,\252\303\377.\253\304\3770\254\304\3772\255\304\377"
+  41      C3FF2EAB 
+  41      C4FF30AC 
+  41      C4FF32AD 
+  41      C4FF
+  42 0100 34AFC4FF 		.ascii	"4\257\304\3776\260\304\3778\261\304\377;\262\304\377=\264\304"
+  42      36B0C4FF 
+  42      38B1C4FF 
+  42      3BB2C4FF 
+  42      3DB4C4
+  43 0113 FF3FB5C4 		.ascii	"\377?\265\304\377A\266\303\377C\267\303\377E\267\303\377G\270"
+  43      FF41B6C3 
+  43      FF43B7C3 
+  43      FF45B7C3 
+  43      FF47B8
+  44 0126 C2FF49B9 		.ascii	"\302\377I\271\302\377K\272\302\377M\273\301\377O\273\301\377"
+  44      C2FF4BBA 
+  44      C2FF4DBB 
+  44      C1FF4FBB 
+  44      C1FF
+  45 0138 51BCC1FF 		.ascii	"Q\274\301\377S\275\301\377U\276\300\377W\276\300\377Y\277\300"
+  45      53BDC1FF 
+  45      55BEC0FF 
+  45      57BEC0FF 
+  45      59BFC0
+  46 014b FF67C4BE 		.ascii	"\377g\304\276\377i\305\275\377k\306\275\377l\306\275\377n\307"
+GAS LISTING /tmp/ccjrIsGY.s 			page 3
+
+
+  46      FF69C5BD 
+  46      FF6BC6BD 
+  46      FF6CC6BD 
+  46      FF6EC7
+  47 015e BCFF70C7 		.ascii	"\274\377p\307\274\377r\310\274\377s\311\274\377u\311\274\377"
+  47      BCFF72C8 
+  47      BCFF73C9 
+  47      BCFF75C9 
+  47      BCFF
+  48 0170 77CABBFF 		.ascii	"w\312\273\377y\312\273\377z\313\273\377|\314\273\377}\314\273"
+  48      79CABBFF 
+  48      7ACBBBFF 
+  48      7CCCBBFF 
+  48      7DCCBB
+  49 0183 FF7FCDBA 		.ascii	"\377\177\315\272\377\201\316\272\377\202\316\272\377\204\317"
+  49      FF81CEBA 
+  49      FF82CEBA 
+  49      FF84CF
+  50 0192 BAFF85D0 		.ascii	"\272\377\205\320\272\377\207\321\271\377\211\321\271\377\212"
+  50      BAFF87D1 
+  50      B9FF89D1 
+  50      B9FF8A
+  51 01a1 D2B9FF8C 		.ascii	"\322\271\377\214\323\271\377\215\324\270\377\217\324\270\377"
+  51      D3B9FF8D 
+  51      D4B8FF8F 
+  51      D4B8FF
+  52 01b0 91D5B8FF 		.ascii	"\221\325\270\377\222\326\270\377\224\326\270\377\225\327\267"
+  52      92D6B8FF 
+  52      94D6B8FF 
+  52      95D7B7
+  53 01bf FF97D8B7 		.ascii	"\377\227\330\267\377\231\330\267\377\251\336\265\377\252\337"
+  53      FF99D8B7 
+  53      FFA9DEB5 
+  53      FFAADF
+  54 01ce B5FFACE0 		.ascii	"\265\377\254\340\265\377\255\340\265\377\257\341\265\377\261"
+  54      B5FFADE0 
+  54      B5FFAFE1 
+  54      B5FFB1
+  55 01dd E1B5FFB2 		.ascii	"\341\265\377\262\342\265\377\264\342\264\377\265\343\264\377"
+  55      E2B5FFB4 
+  55      E2B4FFB5 
+  55      E3B4FF
+  56 01ec B7E3B4FF 		.ascii	"\267\343\264\377\270\344\264\377\272\345\264\377\273\345\264"
+  56      B8E4B4FF 
+  56      BAE5B4FF 
+  56      BBE5B4
+  57 01fb FFBDE5B4 		.ascii	"\377\275\345\264\377\276\346\264\377\300\346\264\377\301\347"
+  57      FFBEE6B4 
+  57      FFC0E6B4 
+  57      FFC1E7
+  58 020a B4FFC3E7 		.ascii	"\264\377\303\347\264\377\304\350\264\377\306\350\264\377\307"
+  58      B4FFC4E8 
+  58      B4FFC6E8 
+  58      B4FFC7
+  59 0219 E9B3FFC7 		.ascii	"\351\263\377\307\351\263\377\310\351\263\377\311\351\263\377"
+  59      E9B3FFC8 
+  59      E9B3FFC9 
+GAS LISTING /tmp/ccjrIsGY.s 			page 4
+
+
+  59      E9B3FF
+  60 0228 C9EAB3FF 		.ascii	"\311\352\263\377\312\352\263\377\312\352\263\377\313\353\263"
+  60      CAEAB3FF 
+  60      CAEAB3FF 
+  60      CBEBB3
+  61 0237 FFCCEBB3 		.ascii	"\377\314\353\263\377\314\353\263\377\315\353\263\377\315\354"
+  61      FFCCEBB3 
+  61      FFCDEBB3 
+  61      FFCDEC
+  62 0246 B3FFCEEC 		.ascii	"\263\377\316\354\263\377\316\354\263\377\317\354\263\377\320"
+  62      B3FFCEEC 
+  62      B3FFCFEC 
+  62      B3FFD0
+  63 0255 EDB3FFD0 		.ascii	"\355\263\377\320\355\263\377\321\355\263\377\321\355\262\377"
+  63      EDB3FFD1 
+  63      EDB3FFD1 
+  63      EDB2FF
+  64 0264 D2EEB2FF 		.ascii	"\322\356\262\377\322\356\262\377\323\356\262\377\323\356\262"
+  64      D2EEB2FF 
+  64      D3EEB2FF 
+  64      D3EEB2
+  65 0273 FFD4EEB2 		.ascii	"\377\324\356\262\377\324\357\262\377\335\362\262\377\335\362"
+  65      FFD4EFB2 
+  65      FFDDF2B2 
+  65      FFDDF2
+  66 0282 B2FFDEF2 		.ascii	"\262\377\336\362\261\377\336\362\261\377\337\363\261\377\337"
+  66      B1FFDEF2 
+  66      B1FFDFF3 
+  66      B1FFDF
+  67 0291 F3B1FFE0 		.ascii	"\363\261\377\340\363\261\377\340\363\261\377\341\363\261\377"
+  67      F3B1FFE0 
+  67      F3B1FFE1 
+  67      F3B1FF
+  68 02a0 E1F4B1FF 		.ascii	"\341\364\261\377\342\364\261\377\342\364\261\377\343\364\261"
+  68      E2F4B1FF 
+  68      E2F4B1FF 
+  68      E3F4B1
+  69 02af FFE3F4B1 		.ascii	"\377\343\364\261\377\344\364\261\377\344\365\261\377\345\365"
+  69      FFE4F4B1 
+  69      FFE4F5B1 
+  69      FFE5F5
+  70 02be B1FFE5F5 		.ascii	"\261\377\345\365\261\377\345\365\261\377\346\365\261\377\346"
+  70      B1FFE5F5 
+  70      B1FFE6F5 
+  70      B1FFE6
+  71 02cd F5B1FFE7 		.ascii	"\365\261\377\347\366\261\377\347\366\261\377\350\366\261\377"
+  71      F6B1FFE7 
+  71      F6B1FFE8 
+  71      F6B1FF
+  72 02dc E8F6B1FF 		.ascii	"\350\366\261\377\351\366\261\377\351\366\261\377\351\367\261"
+  72      E9F6B1FF 
+  72      E9F6B1FF 
+  72      E9F7B1
+  73 02eb FFEAF7B1 		.ascii	"\377\352\367\261\377\352\367\261\377\353\367\261\377\353\367"
+  73      FFEAF7B1 
+  73      FFEBF7B1 
+  73      FFEBF7
+GAS LISTING /tmp/ccjrIsGY.s 			page 5
+
+
+  74 02fa B1FFECF7 		.ascii	"\261\377\354\367\261\377\354\367\261\377\354\367\261\377\355"
+  74      B1FFECF7 
+  74      B1FFECF7 
+  74      B1FFED
+  75 0309 F8B1FFED 		.ascii	"\370\261\377\355\370\261\377\355\370\262\377\355\370\262\377"
+  75      F8B1FFED 
+  75      F8B2FFED 
+  75      F8B2FF
+  76 0318 EDF8B2FF 		.ascii	"\355\370\262\377\356\370\263\377\356\370\263\377\356\370\263"
+  76      EEF8B3FF 
+  76      EEF8B3FF 
+  76      EEF8B3
+  77 0327 FFEEF8B4 		.ascii	"\377\356\370\264\377\356\370\264\377\357\370\264\377\357\370"
+  77      FFEEF8B4 
+  77      FFEFF8B4 
+  77      FFEFF8
+  78 0336 B5FFEFF8 		.ascii	"\265\377\357\370\265\377\357\370\265\377\357\370\266\377\357"
+  78      B5FFEFF8 
+  78      B5FFEFF8 
+  78      B6FFEF
+  79 0345 F8B6FFF0 		.ascii	"\370\266\377\360\370\266\377\360\370\267\377\360\371\267\377"
+  79      F8B6FFF0 
+  79      F8B7FFF0 
+  79      F9B7FF
+  80 0354 F0F9B7FF 		.ascii	"\360\371\267\377\360\371\267\377\360\371\270\377\361\371\270"
+  80      F0F9B7FF 
+  80      F0F9B8FF 
+  80      F1F9B8
+  81 0363 FFF1F9B8 		.ascii	"\377\361\371\270\377\361\371\271\377\361\371\271\377\361\371"
+  81      FFF1F9B9 
+  81      FFF1F9B9 
+  81      FFF1F9
+  82 0372 B9FFF1F9 		.ascii	"\271\377\361\371\272\377\361\371\272\377\362\371\272\377\362"
+  82      BAFFF1F9 
+  82      BAFFF2F9 
+  82      BAFFF2
+  83 0381 F9BAFFF2 		.ascii	"\371\272\377\362\371\273\377\362\371\273\377\362\371\273\377"
+  83      F9BBFFF2 
+  83      F9BBFFF2 
+  83      F9BBFF
+  84 0390 F2F9BBFF 		.ascii	"\362\371\273\377\362\371\274\377\362\371\274\377\363\371\274"
+  84      F2F9BCFF 
+  84      F2F9BCFF 
+  84      F3F9BC
+  85 039f FFF3F9BC 		.ascii	"\377\363\371\274\377\363\372\275\377\363\372\275\377\363\372"
+  85      FFF3FABD 
+  85      FFF3FABD 
+  85      FFF3FA
+  86 03ae BDFFF3FA 		.ascii	"\275\377\363\372\275\377\363\372\276\377\363\372\276\377\364"
+  86      BDFFF3FA 
+  86      BEFFF3FA 
+  86      BEFFF4
+  87 03bd FABEFFF4 		.ascii	"\372\276\377\364\372\276\377\364\372\277\377\364\372\277\377"
+  87      FABEFFF4 
+  87      FABFFFF4 
+  87      FABFFF
+  88 03cc F4FABFFF 		.ascii	"\364\372\277\377\364\372\277\377\364\372\277\377\364\372\300"
+GAS LISTING /tmp/ccjrIsGY.s 			page 6
+
+
+  88      F4FABFFF 
+  88      F4FABFFF 
+  88      F4FAC0
+  89 03db FFF4FAC0 		.ascii	"\377\364\372\300\377\364\372\300\377\370\374\310\377\370\374"
+  89      FFF4FAC0 
+  89      FFF8FCC8 
+  89      FFF8FC
+  90 03ea C8FFF8FC 		.ascii	"\310\377\370\374\311\377\370\374\311\377\370\374\311\377\371"
+  90      C9FFF8FC 
+  90      C9FFF8FC 
+  90      C9FFF9
+  91 03f9 FCC9FFF9 		.ascii	"\374\311\377\371\374\311\377\371\374\312\377\371\374\312\377"
+  91      FCC9FFF9 
+  91      FCCAFFF9 
+  91      FCCAFF
+  92 0408 F9FCCAFF 		.ascii	"\371\374\312\377\371\374\312\377\371\374\312\377\371\374\313"
+  92      F9FCCAFF 
+  92      F9FCCAFF 
+  92      F9FCCB
+  93 0417 FFF9FCCB 		.ascii	"\377\371\374\313\377\371\374\313\377\371\374\313\377\371\374"
+  93      FFF9FCCB 
+  93      FFF9FCCB 
+  93      FFF9FC
+  94 0426 CBFFFAFC 		.ascii	"\313\377\372\374\313\377\372\374\314\377\372\374\314\377\372"
+  94      CBFFFAFC 
+  94      CCFFFAFC 
+  94      CCFFFA
+  95 0435 FCCCFFFA 		.ascii	"\374\314\377\372\374\314\377\372\374\314\377\372\374\314\377"
+  95      FCCCFFFA 
+  95      FCCCFFFA 
+  95      FCCCFF
+  96 0444 FAFCCDFF 		.ascii	"\372\374\315\377\372\374\315\377\372\374\315\377\372\374\315"
+  96      FAFCCDFF 
+  96      FAFCCDFF 
+  96      FAFCCD
+  97 0453 FFFAFCCD 		.ascii	"\377\372\374\315\377\372\374\315\377\372\374\316\377\372\374"
+  97      FFFAFCCD 
+  97      FFFAFCCE 
+  97      FFFAFC
+  98 0462 CEFFFAFD 		.ascii	"\316\377\372\375\316\377\373\375\316\377\373\375\316\377\373"
+  98      CEFFFBFD 
+  98      CEFFFBFD 
+  98      CEFFFB
+  99 0471 FDCEFFFB 		.ascii	"\375\316\377\373\375\316\377\373\375\316\377\373\375\317\377"
+  99      FDCEFFFB 
+  99      FDCEFFFB 
+  99      FDCFFF
+ 100 0480 FBFDCFFF 		.ascii	"\373\375\317\377\373\375\317\377\373\375\317\377\373\375\317"
+ 100      FBFDCFFF 
+ 100      FBFDCFFF 
+ 100      FBFDCF
+ 101 048f FFFBFDCF 		.ascii	"\377\373\375\317\377\373\375\317\377\373\375\320\377\373\375"
+ 101      FFFBFDCF 
+ 101      FFFBFDD0 
+ 101      FFFBFD
+ 102 049e D0FFFBFD 		.ascii	"\320\377\373\375\320\377\373\375\320\377\373\375\320\377\373"
+ 102      D0FFFBFD 
+GAS LISTING /tmp/ccjrIsGY.s 			page 7
+
+
+ 102      D0FFFBFD 
+ 102      D0FFFB
+ 103 04ad FDD0FFFB 		.ascii	"\375\320\377\373\375\320\377\374\375\320\377\374\375\320\377"
+ 103      FDD0FFFC 
+ 103      FDD0FFFC 
+ 103      FDD0FF
+ 104 04bc FCFDD1FF 		.ascii	"\374\375\321\377\374\375\321\377\374\375\321\377\374\375\321"
+ 104      FCFDD1FF 
+ 104      FCFDD1FF 
+ 104      FCFDD1
+ 105 04cb FFFCFDD1 		.ascii	"\377\374\375\321\377\374\375\321\377\374\375\321\377\374\375"
+ 105      FFFCFDD1 
+ 105      FFFCFDD1 
+ 105      FFFCFD
+ 106 04da D1FFFCFD 		.ascii	"\321\377\374\375\321\377\374\375\321\377\374\375\322\377\374"
+ 106      D1FFFCFD 
+ 106      D1FFFCFD 
+ 106      D2FFFC
+ 107 04e9 FDD2FFFC 		.ascii	"\375\322\377\374\375\322\377\374\375\322\377\374\375\322\377"
+ 107      FDD2FFFC 
+ 107      FDD2FFFC 
+ 107      FDD2FF
+ 108 04f8 FCFDD2FF 		.ascii	"\374\375\322\377\374\375\322\377\374\375\322\377\374\375\322"
+ 108      FCFDD2FF 
+ 108      FCFDD2FF 
+ 108      FCFDD2
+ 109 0507 FFFCFDD2 		.ascii	"\377\374\375\322\377\374\375\322\377\374\375\323\377\374\375"
+ 109      FFFCFDD2 
+ 109      FFFCFDD3 
+ 109      FFFCFD
+ 110 0516 D3FFFCFD 		.ascii	"\323\377\374\375\323\377\374\375\323\377\374\375\323\377\375"
+ 110      D3FFFCFD 
+ 110      D3FFFCFD 
+ 110      D3FFFD
+ 111 0525 FDD3FFFD 		.ascii	"\375\323\377\375\375\323\377\375\375\323\377\375\376\323\377"
+ 111      FDD3FFFD 
+ 111      FDD3FFFD 
+ 111      FED3FF
+ 112 0534 FDFED3FF 		.ascii	"\375\376\323\377\375\376\323\377\375\376\323\377\375\376\324"
+ 112      FDFED3FF 
+ 112      FDFED3FF 
+ 112      FDFED4
+ 113 0543 FFFDFED4 		.ascii	"\377\375\376\324\377\375\376\324\377\375\376\324\377\375\376"
+ 113      FFFDFED4 
+ 113      FFFDFED4 
+ 113      FFFDFE
+ 114 0552 D4FFFDFE 		.ascii	"\324\377\375\376\324\377\375\376\324\377\375\376\324\377\375"
+ 114      D4FFFDFE 
+ 114      D4FFFDFE 
+ 114      D4FFFD
+ 115 0561 FED4FFFD 		.ascii	"\376\324\377\375\376\324\377\375\376\324\377\375\376\324\377"
+ 115      FED4FFFD 
+ 115      FED4FFFD 
+ 115      FED4FF
+ 116 0570 FDFED4FF 		.ascii	"\375\376\324\377\375\376\324\377\375\376\324\377\375\376\324"
+ 116      FDFED4FF 
+ 116      FDFED4FF 
+GAS LISTING /tmp/ccjrIsGY.s 			page 8
+
+
+ 116      FDFED4
+ 117 057f FFFDFED5 		.ascii	"\377\375\376\325\377\375\376\325\377\375\376\325\377\375\376"
+ 117      FFFDFED5 
+ 117      FFFDFED5 
+ 117      FFFDFE
+ 118 058e D5FFFDFE 		.ascii	"\325\377\375\376\325\377\375\376\325\377\375\376\325\377\375"
+ 118      D5FFFDFE 
+ 118      D5FFFDFE 
+ 118      D5FFFD
+ 119 059d FED5FFFD 		.ascii	"\376\325\377\375\376\325\377\375\376\325\377\375\376\325\377"
+ 119      FED5FFFD 
+ 119      FED5FFFD 
+ 119      FED5FF
+ 120 05ac FDFED5FF 		.ascii	"\375\376\325\377\375\376\325\377\375\376\325\377\375\376\325"
+ 120      FDFED5FF 
+ 120      FDFED5FF 
+ 120      FDFED5
+ 121 05bb FFFDFED5 		.ascii	"\377\375\376\325\377\375\376\325\377\375\376\325\377\375\376"
+ 121      FFFDFED5 
+ 121      FFFDFED5 
+ 121      FFFDFE
+ 122 05ca D5FFFDFE 		.ascii	"\325\377\375\376\326\377\375\376\326\377\375\376\326\377\376"
+ 122      D6FFFDFE 
+ 122      D6FFFDFE 
+ 122      D6FFFE
+ 123 05d9 FED6FFFE 		.ascii	"\376\326\377\376\376\326\377\376\376\326\377\376\376\326\377"
+ 123      FED6FFFE 
+ 123      FED6FFFE 
+ 123      FED6FF
+ 124 05e8 FEFED6FF 		.ascii	"\376\376\326\377\376\376\326\377\376\376\326\377\376\376\326"
+ 124      FEFED6FF 
+ 124      FEFED6FF 
+ 124      FEFED6
+ 125 05f7 FFFEFED6 		.ascii	"\377\376\376\326\377\376\376\326\377\376\376\326\377\376\376"
+ 125      FFFEFED6 
+ 125      FFFEFED6 
+ 125      FFFEFE
+ 126 0606 D6FFFEFE 		.ascii	"\326\377\376\376\326\377\376\376\326\377\376\376\326\377\376"
+ 126      D6FFFEFE 
+ 126      D6FFFEFE 
+ 126      D6FFFE
+ 127 0615 FED6FFFE 		.ascii	"\376\326\377\376\376\326\377\376\376\326\377\376\376\326\377"
+ 127      FED6FFFE 
+ 127      FED6FFFE 
+ 127      FED6FF
+ 128 0624 FEFED6FF 		.ascii	"\376\376\326\377\376\376\326\377\376\376\326\377\376\376\326"
+ 128      FEFED6FF 
+ 128      FEFED6FF 
+ 128      FEFED6
+ 129 0633 FFFEFED7 		.ascii	"\377\376\376\327\377\376\376\327\377\376\376\327\377\376\376"
+ 129      FFFEFED7 
+ 129      FFFEFED7 
+ 129      FFFEFE
+ 130 0642 D7FFFEFE 		.ascii	"\327\377\376\376\327\377\376\376\327\377\376\376\327\377\376"
+ 130      D7FFFEFE 
+ 130      D7FFFEFE 
+ 130      D7FFFE
+GAS LISTING /tmp/ccjrIsGY.s 			page 9
+
+
+ 131 0651 FED7FFFE 		.ascii	"\376\327\377\376\376\327\377\376\376\327\377\376\376\327\377"
+ 131      FED7FFFE 
+ 131      FED7FFFE 
+ 131      FED7FF
+ 132 0660 FEFED7FF 		.ascii	"\376\376\327\377\376\376\327\377\376\376\327\377\376\376\327"
+ 132      FEFED7FF 
+ 132      FEFED7FF 
+ 132      FEFED7
+ 133 066f FFFEFED7 		.ascii	"\377\376\376\327\377\376\376\327\377\376\376\327\377\376\376"
+ 133      FFFEFED7 
+ 133      FFFEFED7 
+ 133      FFFEFE
+ 134 067e D7FFFEFE 		.ascii	"\327\377\376\376\327\377\376\376\327\377\376\376\327\377\376"
+ 134      D7FFFEFE 
+ 134      D7FFFEFE 
+ 134      D7FFFE
+ 135 068d FED7FFFE 		.ascii	"\376\327\377\376\376\327\377\376\376\327\377\376\376\327\377"
+ 135      FED7FFFE 
+ 135      FED7FFFE 
+ 135      FED7FF
+ 136 069c FEFED7FF 		.ascii	"\376\376\327\377\376\376\327\377\376\376\327\377\376\376\327"
+ 136      FEFED7FF 
+ 136      FEFED7FF 
+ 136      FEFED7
+ 137 06ab FFFEFED7 		.ascii	"\377\376\376\327\377\376\376\327\377\376\376\327\377\376\376"
+ 137      FFFEFED7 
+ 137      FFFEFED7 
+ 137      FFFEFE
+ 138 06ba D7FFFEFE 		.ascii	"\327\377\376\376\327\377\376\376\327\377\376\376\327\377\376"
+ 138      D7FFFEFE 
+ 138      D7FFFEFE 
+ 138      D7FFFE
+ 139 06c9 FED7FFFE 		.ascii	"\376\327\377\376\376\327\377\376\376\327\377\376\376\327\377"
+ 139      FED7FFFE 
+ 139      FED7FFFE 
+ 139      FED7FF
+ 140 06d8 FEFED7FF 		.ascii	"\376\376\327\377\376\376\330\377\376\376\330\377\376\376\330"
+ 140      FEFED8FF 
+ 140      FEFED8FF 
+ 140      FEFED8
+ 141 06e7 FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 141      FFFEFED8 
+ 141      FFFEFED8 
+ 141      FFFEFE
+ 142 06f6 D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 142      D8FFFEFE 
+ 142      D8FFFEFE 
+ 142      D8FFFE
+ 143 0705 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 143      FED8FFFE 
+ 143      FED8FFFE 
+ 143      FED8FF
+ 144 0714 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 144      FEFED8FF 
+ 144      FEFED8FF 
+ 144      FEFED8
+ 145 0723 FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+GAS LISTING /tmp/ccjrIsGY.s 			page 10
+
+
+ 145      FFFEFED8 
+ 145      FFFEFED8 
+ 145      FFFEFE
+ 146 0732 D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 146      D8FFFEFE 
+ 146      D8FFFEFE 
+ 146      D8FFFE
+ 147 0741 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 147      FED8FFFE 
+ 147      FED8FFFE 
+ 147      FED8FF
+ 148 0750 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 148      FEFED8FF 
+ 148      FEFED8FF 
+ 148      FEFED8
+ 149 075f FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 149      FFFEFED8 
+ 149      FFFEFED8 
+ 149      FFFEFE
+ 150 076e D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 150      D8FFFEFE 
+ 150      D8FFFEFE 
+ 150      D8FFFE
+ 151 077d FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 151      FED8FFFE 
+ 151      FED8FFFE 
+ 151      FED8FF
+ 152 078c FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 152      FEFED8FF 
+ 152      FEFED8FF 
+ 152      FEFED8
+ 153 079b FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 153      FFFEFED8 
+ 153      FFFEFED8 
+ 153      FFFEFE
+ 154 07aa D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 154      D8FFFEFE 
+ 154      D8FFFEFE 
+ 154      D8FFFE
+ 155 07b9 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 155      FED8FFFE 
+ 155      FED8FFFE 
+ 155      FED8FF
+ 156 07c8 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377"
+ 156      FEFED8FF 
+ 157 07d0 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 157      FEFED8FF 
+ 157      FEFED8FF 
+ 157      FEFED8
+ 158 07df FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 158      FFFEFED8 
+ 158      FFFEFED8 
+ 158      FFFEFE
+ 159 07ee D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 159      D8FFFEFE 
+ 159      D8FFFEFE 
+ 159      D8FFFE
+GAS LISTING /tmp/ccjrIsGY.s 			page 11
+
+
+ 160 07fd FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 160      FED8FFFE 
+ 160      FED8FFFE 
+ 160      FED8FF
+ 161 080c FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 161      FEFED8FF 
+ 161      FEFED8FF 
+ 161      FEFED8
+ 162 081b FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 162      FFFEFED8 
+ 162      FFFEFED8 
+ 162      FFFEFE
+ 163 082a D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 163      D8FFFEFE 
+ 163      D8FFFEFE 
+ 163      D8FFFE
+ 164 0839 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 164      FED8FFFE 
+ 164      FED8FFFE 
+ 164      FED8FF
+ 165 0848 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 165      FEFED8FF 
+ 165      FEFED8FF 
+ 165      FEFED8
+ 166 0857 FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 166      FFFEFED8 
+ 166      FFFEFED8 
+ 166      FFFEFE
+ 167 0866 D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 167      D8FFFEFE 
+ 167      D8FFFEFE 
+ 167      D8FFFE
+ 168 0875 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 168      FED8FFFE 
+ 168      FED8FFFE 
+ 168      FED8FF
+ 169 0884 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 169      FEFED8FF 
+ 169      FEFED8FF 
+ 169      FEFED8
+ 170 0893 FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 170      FFFEFED8 
+ 170      FFFEFED8 
+ 170      FFFEFE
+ 171 08a2 D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 171      D8FFFEFE 
+ 171      D8FFFEFE 
+ 171      D8FFFE
+ 172 08b1 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 172      FED8FFFE 
+ 172      FED8FFFE 
+ 172      FED8FF
+ 173 08c0 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 173      FEFED8FF 
+ 173      FEFED8FF 
+ 173      FEFED8
+ 174 08cf FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+GAS LISTING /tmp/ccjrIsGY.s 			page 12
+
+
+ 174      FFFEFED8 
+ 174      FFFEFED8 
+ 174      FFFEFE
+ 175 08de D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 175      D8FFFEFE 
+ 175      D8FFFEFE 
+ 175      D8FFFE
+ 176 08ed FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 176      FED8FFFE 
+ 176      FED8FFFE 
+ 176      FED8FF
+ 177 08fc FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 177      FEFED8FF 
+ 177      FEFED8FF 
+ 177      FEFED8
+ 178 090b FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 178      FFFEFED8 
+ 178      FFFEFED8 
+ 178      FFFEFE
+ 179 091a D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 179      D8FFFEFE 
+ 179      D8FFFEFE 
+ 179      D8FFFE
+ 180 0929 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 180      FED8FFFE 
+ 180      FED8FFFE 
+ 180      FED8FF
+ 181 0938 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 181      FEFED8FF 
+ 181      FEFED8FF 
+ 181      FEFED8
+ 182 0947 FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 182      FFFEFED8 
+ 182      FFFEFED8 
+ 182      FFFEFE
+ 183 0956 D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 183      D8FFFEFE 
+ 183      D8FFFEFE 
+ 183      D8FFFE
+ 184 0965 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 184      FED8FFFE 
+ 184      FED8FFFE 
+ 184      FED8FF
+ 185 0974 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 185      FEFED8FF 
+ 185      FEFED8FF 
+ 185      FEFED8
+ 186 0983 FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 186      FFFEFED8 
+ 186      FFFEFED8 
+ 186      FFFEFE
+ 187 0992 D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 187      D8FFFEFE 
+ 187      D8FFFEFE 
+ 187      D8FFFE
+ 188 09a1 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 188      FED8FFFE 
+GAS LISTING /tmp/ccjrIsGY.s 			page 13
+
+
+ 188      FED8FFFE 
+ 188      FED8FF
+ 189 09b0 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 189      FEFED8FF 
+ 189      FEFED8FF 
+ 189      FEFED8
+ 190 09bf FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 190      FFFEFED8 
+ 190      FFFEFED8 
+ 190      FFFEFE
+ 191 09ce D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 191      D8FFFEFE 
+ 191      D8FFFEFE 
+ 191      D8FFFE
+ 192 09dd FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 192      FED8FFFE 
+ 192      FED8FFFE 
+ 192      FED8FF
+ 193 09ec FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 193      FEFED8FF 
+ 193      FEFED8FF 
+ 193      FEFED8
+ 194 09fb FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 194      FFFEFED8 
+ 194      FFFEFED8 
+ 194      FFFEFE
+ 195 0a0a D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 195      D8FFFEFE 
+ 195      D8FFFEFE 
+ 195      D8FFFE
+ 196 0a19 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 196      FED8FFFE 
+ 196      FED8FFFE 
+ 196      FED8FF
+ 197 0a28 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 197      FEFED8FF 
+ 197      FEFED8FF 
+ 197      FEFED8
+ 198 0a37 FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 198      FFFEFED8 
+ 198      FFFEFED8 
+ 198      FFFEFE
+ 199 0a46 D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 199      D8FFFEFE 
+ 199      D8FFFEFE 
+ 199      D8FFFE
+ 200 0a55 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 200      FED8FFFE 
+ 200      FED8FFFE 
+ 200      FED8FF
+ 201 0a64 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 201      FEFED8FF 
+ 201      FEFED8FF 
+ 201      FEFED8
+ 202 0a73 FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 202      FFFEFED8 
+ 202      FFFEFED8 
+GAS LISTING /tmp/ccjrIsGY.s 			page 14
+
+
+ 202      FFFEFE
+ 203 0a82 D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 203      D8FFFEFE 
+ 203      D8FFFEFE 
+ 203      D8FFFE
+ 204 0a91 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 204      FED8FFFE 
+ 204      FED8FFFE 
+ 204      FED8FF
+ 205 0aa0 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 205      FEFED8FF 
+ 205      FEFED8FF 
+ 205      FEFED8
+ 206 0aaf FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 206      FFFEFED8 
+ 206      FFFEFED8 
+ 206      FFFEFE
+ 207 0abe D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 207      D8FFFEFE 
+ 207      D8FFFEFE 
+ 207      D8FFFE
+ 208 0acd FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 208      FED8FFFE 
+ 208      FED8FFFE 
+ 208      FED8FF
+ 209 0adc FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 209      FEFED8FF 
+ 209      FEFED8FF 
+ 209      FEFED8
+ 210 0aeb FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 210      FFFEFED8 
+ 210      FFFEFED8 
+ 210      FFFEFE
+ 211 0afa D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 211      D8FFFEFE 
+ 211      D8FFFEFE 
+ 211      D8FFFE
+ 212 0b09 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 212      FED8FFFE 
+ 212      FED8FFFE 
+ 212      FED8FF
+ 213 0b18 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 213      FEFED8FF 
+ 213      FEFED8FF 
+ 213      FEFED8
+ 214 0b27 FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 214      FFFEFED8 
+ 214      FFFEFED8 
+ 214      FFFEFE
+ 215 0b36 D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 215      D8FFFEFE 
+ 215      D8FFFEFE 
+ 215      D8FFFE
+ 216 0b45 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 216      FED8FFFE 
+ 216      FED8FFFE 
+ 216      FED8FF
+GAS LISTING /tmp/ccjrIsGY.s 			page 15
+
+
+ 217 0b54 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 217      FEFED8FF 
+ 217      FEFED8FF 
+ 217      FEFED8
+ 218 0b63 FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 218      FFFEFED8 
+ 218      FFFEFED8 
+ 218      FFFEFE
+ 219 0b72 D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 219      D8FFFEFE 
+ 219      D8FFFEFE 
+ 219      D8FFFE
+ 220 0b81 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 220      FED8FFFE 
+ 220      FED8FFFE 
+ 220      FED8FF
+ 221 0b90 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 221      FEFED8FF 
+ 221      FEFED8FF 
+ 221      FEFED8
+ 222 0b9f FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 222      FFFEFED8 
+ 222      FFFEFED8 
+ 222      FFFEFE
+ 223 0bae D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 223      D8FFFEFE 
+ 223      D8FFFEFE 
+ 223      D8FFFE
+ 224 0bbd FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 224      FED8FFFE 
+ 224      FED8FFFE 
+ 224      FED8FF
+ 225 0bcc FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 225      FEFED8FF 
+ 225      FEFED8FF 
+ 225      FEFED8
+ 226 0bdb FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 226      FFFEFED8 
+ 226      FFFEFED8 
+ 226      FFFEFE
+ 227 0bea D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 227      D8FFFEFE 
+ 227      D8FFFEFE 
+ 227      D8FFFE
+ 228 0bf9 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 228      FED8FFFE 
+ 228      FED8FFFE 
+ 228      FED8FF
+ 229 0c08 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 229      FEFED8FF 
+ 229      FEFED8FF 
+ 229      FEFED8
+ 230 0c17 FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 230      FFFEFED8 
+ 230      FFFEFED8 
+ 230      FFFEFE
+ 231 0c26 D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+GAS LISTING /tmp/ccjrIsGY.s 			page 16
+
+
+ 231      D8FFFEFE 
+ 231      D8FFFEFE 
+ 231      D8FFFE
+ 232 0c35 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\376\330\377"
+ 232      FED8FFFE 
+ 232      FED8FFFE 
+ 232      FED8FF
+ 233 0c44 FEFED8FF 		.ascii	"\376\376\330\377\376\376\330\377\376\376\330\377\376\376\330"
+ 233      FEFED8FF 
+ 233      FEFED8FF 
+ 233      FEFED8
+ 234 0c53 FFFEFED8 		.ascii	"\377\376\376\330\377\376\376\330\377\376\376\330\377\376\376"
+ 234      FFFEFED8 
+ 234      FFFEFED8 
+ 234      FFFEFE
+ 235 0c62 D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377\376\376\330\377\376"
+ 235      D8FFFEFE 
+ 235      D8FFFEFE 
+ 235      D8FFFE
+ 236 0c71 FED8FFFE 		.ascii	"\376\330\377\376\376\330\377\376\376\330\377\376\377\330\377"
+ 236      FED8FFFE 
+ 236      FED8FFFE 
+ 236      FFD8FF
+ 237 0c80 FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 237      FEFFD8FF 
+ 237      FEFFD8FF 
+ 237      FEFFD8
+ 238 0c8f FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 238      FFFEFFD8 
+ 238      FFFEFFD8 
+ 238      FFFEFF
+ 239 0c9e D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 239      D8FFFEFF 
+ 239      D8FFFEFF 
+ 239      D8FFFE
+ 240 0cad FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 240      FFD8FFFE 
+ 240      FFD8FFFE 
+ 240      FFD8FF
+ 241 0cbc FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 241      FEFFD8FF 
+ 241      FEFFD8FF 
+ 241      FEFFD8
+ 242 0ccb FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 242      FFFEFFD8 
+ 242      FFFEFFD8 
+ 242      FFFEFF
+ 243 0cda D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 243      D8FFFEFF 
+ 243      D8FFFEFF 
+ 243      D8FFFE
+ 244 0ce9 FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 244      FFD8FFFE 
+ 244      FFD8FFFE 
+ 244      FFD8FF
+ 245 0cf8 FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 245      FEFFD8FF 
+GAS LISTING /tmp/ccjrIsGY.s 			page 17
+
+
+ 245      FEFFD8FF 
+ 245      FEFFD8
+ 246 0d07 FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 246      FFFEFFD8 
+ 246      FFFEFFD8 
+ 246      FFFEFF
+ 247 0d16 D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 247      D8FFFEFF 
+ 247      D8FFFEFF 
+ 247      D8FFFE
+ 248 0d25 FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 248      FFD8FFFE 
+ 248      FFD8FFFE 
+ 248      FFD8FF
+ 249 0d34 FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 249      FEFFD8FF 
+ 249      FEFFD8FF 
+ 249      FEFFD8
+ 250 0d43 FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 250      FFFEFFD8 
+ 250      FFFEFFD8 
+ 250      FFFEFF
+ 251 0d52 D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 251      D8FFFEFF 
+ 251      D8FFFEFF 
+ 251      D8FFFE
+ 252 0d61 FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 252      FFD8FFFE 
+ 252      FFD8FFFE 
+ 252      FFD8FF
+ 253 0d70 FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 253      FEFFD8FF 
+ 253      FEFFD8FF 
+ 253      FEFFD8
+ 254 0d7f FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 254      FFFEFFD8 
+ 254      FFFEFFD8 
+ 254      FFFEFF
+ 255 0d8e D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 255      D8FFFEFF 
+ 255      D8FFFEFF 
+ 255      D8FFFE
+ 256 0d9d FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 256      FFD8FFFE 
+ 256      FFD8FFFE 
+ 256      FFD8FF
+ 257 0dac FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 257      FEFFD8FF 
+ 257      FEFFD8FF 
+ 257      FEFFD8
+ 258 0dbb FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 258      FFFEFFD8 
+ 258      FFFEFFD8 
+ 258      FFFEFF
+ 259 0dca D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 259      D8FFFEFF 
+ 259      D8FFFEFF 
+GAS LISTING /tmp/ccjrIsGY.s 			page 18
+
+
+ 259      D8FFFE
+ 260 0dd9 FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 260      FFD8FFFE 
+ 260      FFD8FFFE 
+ 260      FFD8FF
+ 261 0de8 FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 261      FEFFD8FF 
+ 261      FEFFD8FF 
+ 261      FEFFD8
+ 262 0df7 FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 262      FFFEFFD8 
+ 262      FFFEFFD8 
+ 262      FFFEFF
+ 263 0e06 D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 263      D8FFFEFF 
+ 263      D8FFFEFF 
+ 263      D8FFFE
+ 264 0e15 FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 264      FFD8FFFE 
+ 264      FFD8FFFE 
+ 264      FFD8FF
+ 265 0e24 FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 265      FEFFD8FF 
+ 265      FEFFD8FF 
+ 265      FEFFD8
+ 266 0e33 FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 266      FFFEFFD8 
+ 266      FFFEFFD8 
+ 266      FFFEFF
+ 267 0e42 D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 267      D8FFFEFF 
+ 267      D8FFFEFF 
+ 267      D8FFFE
+ 268 0e51 FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 268      FFD8FFFE 
+ 268      FFD8FFFE 
+ 268      FFD8FF
+ 269 0e60 FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 269      FEFFD8FF 
+ 269      FEFFD8FF 
+ 269      FEFFD8
+ 270 0e6f FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 270      FFFEFFD8 
+ 270      FFFEFFD8 
+ 270      FFFEFF
+ 271 0e7e D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 271      D8FFFEFF 
+ 271      D8FFFEFF 
+ 271      D8FFFE
+ 272 0e8d FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 272      FFD8FFFE 
+ 272      FFD8FFFE 
+ 272      FFD8FF
+ 273 0e9c FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 273      FEFFD8FF 
+ 273      FEFFD8FF 
+ 273      FEFFD8
+GAS LISTING /tmp/ccjrIsGY.s 			page 19
+
+
+ 274 0eab FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 274      FFFEFFD8 
+ 274      FFFEFFD8 
+ 274      FFFEFF
+ 275 0eba D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 275      D8FFFEFF 
+ 275      D8FFFEFF 
+ 275      D8FFFE
+ 276 0ec9 FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 276      FFD8FFFE 
+ 276      FFD8FFFE 
+ 276      FFD8FF
+ 277 0ed8 FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 277      FEFFD8FF 
+ 277      FEFFD8FF 
+ 277      FEFFD8
+ 278 0ee7 FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 278      FFFEFFD8 
+ 278      FFFEFFD8 
+ 278      FFFEFF
+ 279 0ef6 D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 279      D8FFFEFF 
+ 279      D8FFFEFF 
+ 279      D8FFFE
+ 280 0f05 FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 280      FFD8FFFE 
+ 280      FFD8FFFE 
+ 280      FFD8FF
+ 281 0f14 FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 281      FEFFD8FF 
+ 281      FEFFD8FF 
+ 281      FEFFD8
+ 282 0f23 FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 282      FFFEFFD8 
+ 282      FFFEFFD8 
+ 282      FFFEFF
+ 283 0f32 D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 283      D8FFFEFF 
+ 283      D8FFFEFF 
+ 283      D8FFFE
+ 284 0f41 FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 284      FFD8FFFE 
+ 284      FFD8FFFE 
+ 284      FFD8FF
+ 285 0f50 FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 285      FEFFD8FF 
+ 285      FEFFD8FF 
+ 285      FEFFD8
+ 286 0f5f FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 286      FFFEFFD8 
+ 286      FFFEFFD8 
+ 286      FFFEFF
+ 287 0f6e D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 287      D8FFFEFF 
+ 287      D8FFFEFF 
+ 287      D8FFFE
+ 288 0f7d FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+GAS LISTING /tmp/ccjrIsGY.s 			page 20
+
+
+ 288      FFD8FFFE 
+ 288      FFD8FFFE 
+ 288      FFD8FF
+ 289 0f8c FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 289      FEFFD8FF 
+ 289      FEFFD8FF 
+ 289      FEFFD8
+ 290 0f9b FFFEFFD8 		.ascii	"\377\376\377\330\377"
+ 290      FF
+ 291 0fa0 FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 291      FEFFD8FF 
+ 291      FEFFD8FF 
+ 291      FEFFD8
+ 292 0faf FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 292      FFFEFFD8 
+ 292      FFFEFFD8 
+ 292      FFFEFF
+ 293 0fbe D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377\376\377\330\377\376"
+ 293      D8FFFEFF 
+ 293      D8FFFEFF 
+ 293      D8FFFE
+ 294 0fcd FFD8FFFE 		.ascii	"\377\330\377\376\377\330\377\376\377\330\377\376\377\330\377"
+ 294      FFD8FFFE 
+ 294      FFD8FFFE 
+ 294      FFD8FF
+ 295 0fdc FEFFD8FF 		.ascii	"\376\377\330\377\376\377\330\377\376\377\330\377\376\377\330"
+ 295      FEFFD8FF 
+ 295      FEFFD8FF 
+ 295      FEFFD8
+ 296 0feb FFFEFFD8 		.ascii	"\377\376\377\330\377\376\377\330\377\376\377\330\377\376\377"
+ 296      FFFEFFD8 
+ 296      FFFEFFD8 
+ 296      FFFEFF
+ 297 0ffa D8FFFEFF 		.ascii	"\330\377\376\377\330\377\376\377\330\377"
+ 297      D8FFFEFF 
+ 297      D8FF
+ 298              		.globl	heatmap_cs_YlGnBu_mixed
+ 299              		.section	.data.rel.local
+ 300              		.align 8
+ 301              		.type	heatmap_cs_YlGnBu_mixed, @object
+ 302              		.size	heatmap_cs_YlGnBu_mixed, 8
+ 303              	heatmap_cs_YlGnBu_mixed:
+ 304 0008 00000000 		.quad	mixed
+ 304      00000000 
+ 305              		.section	.data.rel.ro.local
+ 306              		.align 16
+ 307              		.type	mixed, @object
+ 308              		.size	mixed, 16
+ 309              	mixed:
+ 310 0010 00000000 		.quad	mixed_data
+ 310      00000000 
+ 311 0018 01040000 		.quad	1025
+ 311      00000000 
+ 312              		.section	.rodata
+ 313 1004 00000000 		.align 32
+ 313      00000000 
+ 313      00000000 
+GAS LISTING /tmp/ccjrIsGY.s 			page 21
+
+
+ 313      00000000 
+ 313      00000000 
+ 314              		.type	mixed_data, @object
+ 315              		.size	mixed_data, 4100
+ 316              	mixed_data:
+ 317 1020 00       		.string	""
+ 318 1021 00       		.string	""
+ 319 1022 00       		.string	""
+ 320 1023 00       		.string	""
+ 321 1024 081C5800 		.string	"\b\034X"
+ 322 1028 081D5807 		.ascii	"\b\035X\007\b\035X\016\b\035Y\026\b\035Y\035\b\035Y%\b\035Z,"
+ 322      081D580E 
+ 322      081D5916 
+ 322      081D591D 
+ 322      081D5925 
+ 323 1040 081D5A34 		.ascii	"\b\035Z4\t\036Z;\t\036[C\t\036[J\t\036[R\t\036\\Y\t\036\\a\n"
+ 323      091E5A3B 
+ 323      091E5B43 
+ 323      091E5B4A 
+ 323      091E5B52 
+ 324 105d 1E5D680A 		.ascii	"\036]h\n\037]p\n\037]w\n\037^\177\n\037^\206\n\037^\215\013\037"
+ 324      1F5D700A 
+ 324      1F5D770A 
+ 324      1F5E7F0A 
+ 324      1F5E860A 
+ 325 1076 5F950B1F 		.ascii	"_\225\013\037_\234\013 `\244\013 `\253\013 `\263\013 a\272\f"
+ 325      5F9C0B20 
+ 325      60A40B20 
+ 325      60AB0B20 
+ 325      60B30B20 
+ 326 108d 2061C20C 		.ascii	" a\302\f a\311\f b\321\f!b\330\f!b\340\f!c\347\r!c\357\r!d\366"
+ 326      2061C90C 
+ 326      2062D10C 
+ 326      2162D80C 
+ 326      2162E00C 
+ 327 10ac 0D2164FE 		.ascii	"\r!d\376\r!d\377\r\"e\377\r\"e\377\016\"e\377\016\"f\377\016"
+ 327      0D2164FF 
+ 327      0D2265FF 
+ 327      0D2265FF 
+ 327      0E2265FF 
+ 328 10c5 2266FF0E 		.ascii	"\"f\377\016\"g\377\016\"g\377\016#g\377\017#h\377\017#h\377\017"
+ 328      2267FF0E 
+ 328      2267FF0E 
+ 328      2367FF0F 
+ 328      2368FF0F 
+ 329 10dd 2368FF0F 		.ascii	"#h\377\017#i\377\017#i\377\017$i\377\020$j\377\020$j\377\020"
+ 329      2369FF0F 
+ 329      2369FF0F 
+ 329      2469FF10 
+ 329      246AFF10 
+ 330 10f5 246BFF10 		.ascii	"$k\377\020$k\377\020$k\377\020$l\377\021%l\377\021%l\377\021"
+ 330      246BFF10 
+ 330      246BFF10 
+ 330      246CFF11 
+ 330      256CFF11 
+ 331 110d 256DFF11 		.ascii	"%m\377\021%m\377\021%n\377\022%n\377\022%n\377\022&o\377\030"
+ 331      256DFF11 
+GAS LISTING /tmp/ccjrIsGY.s 			page 22
+
+
+ 331      256EFF12 
+ 331      256EFF12 
+ 331      256EFF12 
+ 332 1125 2A7BFF18 		.ascii	"*{\377\030*{\377\030+|\377\030+|\377\031+}\377\031+}\377\031"
+ 332      2A7BFF18 
+ 332      2B7CFF18 
+ 332      2B7CFF19 
+ 332      2B7DFF19 
+ 333 113d 2B7DFF19 		.ascii	"+}\377\031+~\377\031+~\377\032,~\377\032,\177\377\032,\177\377"
+ 333      2B7EFF19 
+ 333      2B7EFF1A 
+ 333      2C7EFF1A 
+ 333      2C7FFF1A 
+ 334 1154 1A2C80FF 		.ascii	"\032,\200\377\032,\200\377\033,\200\377\033,\201\377\033-\201"
+ 334      1A2C80FF 
+ 334      1B2C80FF 
+ 334      1B2C81FF 
+ 334      1B2D81
+ 335 1167 FF1B2D82 		.ascii	"\377\033-\202\377\033-\202\377\033-\202\377\034-\203\377\034"
+ 335      FF1B2D82 
+ 335      FF1B2D82 
+ 335      FF1C2D83 
+ 335      FF1C
+ 336 1179 2D83FF1C 		.ascii	"-\203\377\034-\203\377\034.\204\377\034.\204\377\035.\205\377"
+ 336      2D83FF1C 
+ 336      2E84FF1C 
+ 336      2E84FF1D 
+ 336      2E85FF
+ 337 118c 1D2E85FF 		.ascii	"\035.\205\377\035.\205\377\035.\206\377\035.\206\377\036/\206"
+ 337      1D2E85FF 
+ 337      1D2E86FF 
+ 337      1D2E86FF 
+ 337      1E2F86
+ 338 119f FF1E2F87 		.ascii	"\377\036/\207\377\036/\207\377\036/\210\377\036/\210\377\037"
+ 338      FF1E2F87 
+ 338      FF1E2F88 
+ 338      FF1E2F88 
+ 338      FF1F
+ 339 11b1 2F88FF1F 		.ascii	"/\210\377\037/\211\377\0370\211\377\0370\211\377\0370\212\377"
+ 339      2F89FF1F 
+ 339      3089FF1F 
+ 339      3089FF1F 
+ 339      308AFF
+ 340 11c4 20308AFF 		.ascii	" 0\212\377 0\213\377 0\213\377 0\213\377 1\214\377!1\214\377"
+ 340      20308BFF 
+ 340      20308BFF 
+ 340      20308BFF 
+ 340      20318CFF 
+ 341 11dc 21318DFF 		.ascii	"!1\215\377!1\215\377!1\215\377!1\216\377\"1\216\377\"2\216\377"
+ 341      21318DFF 
+ 341      21318DFF 
+ 341      21318EFF 
+ 341      22318EFF 
+ 342 11f4 22328FFF 		.ascii	"\"2\217\377\"2\217\377\"2\220\377#2\220\377#2\220\377#2\221\377"
+ 342      22328FFF 
+ 342      223290FF 
+ 342      233290FF 
+GAS LISTING /tmp/ccjrIsGY.s 			page 23
+
+
+ 342      233290FF 
+ 343 120c 233391FF 		.ascii	"#3\221\377#3\222\377$3\222\377$3\222\377$3\223\377$3\223\377"
+ 343      233392FF 
+ 343      243392FF 
+ 343      243392FF 
+ 343      243393FF 
+ 344 1224 253394FF 		.ascii	"%3\224\377$4\224\377$4\224\377$4\224\377$5\224\377$5\224\377"
+ 344      243494FF 
+ 344      243494FF 
+ 344      243494FF 
+ 344      243594FF 
+ 345 123c 243594FF 		.ascii	"$5\224\377#6\225\377#6\225\377#6\225\377#6\225\377#7\225\377"
+ 345      233695FF 
+ 345      233695FF 
+ 345      233695FF 
+ 345      233695FF 
+ 346 1254 233795FF 		.ascii	"#7\225\377#7\226\377\"8\226\377\"8\226\377\"8\226\377\"8\226"
+ 346      233796FF 
+ 346      223896FF 
+ 346      223896FF 
+ 346      223896FF 
+ 347 126b FF223996 		.ascii	"\377\"9\226\377\"9\227\377\"9\227\377\":\227\377!:\227\377!:"
+ 347      FF223997 
+ 347      FF223997 
+ 347      FF223A97 
+ 347      FF213A97 
+ 348 1282 97FF213A 		.ascii	"\227\377!:\227\377!;\227\377!;\230\377!;\230\377!;\230\377 <"
+ 348      97FF213B 
+ 348      97FF213B 
+ 348      98FF213B 
+ 348      98FF213B 
+ 349 129a 98FF203C 		.ascii	"\230\377 <\230\377 <\230\377 =\231\377 =\231\377 =\231\377 ="
+ 349      98FF203C 
+ 349      98FF203D 
+ 349      99FF203D 
+ 349      99FF203D 
+ 350 12b2 99FF203E 		.ascii	"\231\377 >\231\377 >\231\377\037>\231\377\037>\232\377\037?\232"
+ 350      99FF203E 
+ 350      99FF1F3E 
+ 350      99FF1F3E 
+ 350      9AFF1F3F 
+ 351 12c7 FF1F3F9A 		.ascii	"\377\037?\232\377\037?\232\377\037@\232\377\037@\232\377\037"
+ 351      FF1F3F9A 
+ 351      FF1F409A 
+ 351      FF1F409A 
+ 351      FF1F
+ 352 12d9 409AFF1F 		.ascii	"@\232\377\037@\232\377\037A\233\377\037A\233\377\036A\233\377"
+ 352      409AFF1F 
+ 352      419BFF1F 
+ 352      419BFF1E 
+ 352      419BFF
+ 353 12ec 1E419BFF 		.ascii	"\036A\233\377\036B\233\377\036B\233\377\036B\233\377\036B\234"
+ 353      1E429BFF 
+ 353      1E429BFF 
+ 353      1E429BFF 
+ 353      1E429C
+ 354 12ff FF1E439C 		.ascii	"\377\036C\234\377\036C\234\377\036C\234\377\036C\234\377\036"
+GAS LISTING /tmp/ccjrIsGY.s 			page 24
+
+
+ 354      FF1E439C 
+ 354      FF1E439C 
+ 354      FF1E439C 
+ 354      FF1E
+ 355 1311 449CFF1E 		.ascii	"D\234\377\036D\234\377\036D\234\377\036E\235\377\036E\235\377"
+ 355      449CFF1E 
+ 355      449CFF1E 
+ 355      459DFF1E 
+ 355      459DFF
+ 356 1324 1D4DA1FF 		.ascii	"\035M\241\377\035N\241\377\035N\241\377\035N\241\377\035N\241"
+ 356      1D4EA1FF 
+ 356      1D4EA1FF 
+ 356      1D4EA1FF 
+ 356      1D4EA1
+ 357 1337 FF1D4FA1 		.ascii	"\377\035O\241\377\035O\242\377\035O\242\377\035P\242\377\035"
+ 357      FF1D4FA2 
+ 357      FF1D4FA2 
+ 357      FF1D50A2 
+ 357      FF1D
+ 358 1349 50A2FF1D 		.ascii	"P\242\377\035P\242\377\035P\242\377\035Q\242\377\035Q\242\377"
+ 358      50A2FF1D 
+ 358      50A2FF1D 
+ 358      51A2FF1D 
+ 358      51A2FF
+ 359 135c 1D51A2FF 		.ascii	"\035Q\242\377\035Q\243\377\035R\243\377\035R\243\377\035R\243"
+ 359      1D51A3FF 
+ 359      1D52A3FF 
+ 359      1D52A3FF 
+ 359      1D52A3
+ 360 136f FF1D52A3 		.ascii	"\377\035R\243\377\035S\243\377\035S\243\377\035S\243\377\035"
+ 360      FF1D53A3 
+ 360      FF1D53A3 
+ 360      FF1D53A3 
+ 360      FF1D
+ 361 1381 53A3FF1D 		.ascii	"S\243\377\035T\244\377\035T\244\377\035T\244\377\035T\244\377"
+ 361      54A4FF1D 
+ 361      54A4FF1D 
+ 361      54A4FF1D 
+ 361      54A4FF
+ 362 1394 1D55A4FF 		.ascii	"\035U\244\377\035U\244\377\035U\244\377\035U\244\377\036V\244"
+ 362      1D55A4FF 
+ 362      1D55A4FF 
+ 362      1D55A4FF 
+ 362      1E56A4
+ 363 13a7 FF1E56A5 		.ascii	"\377\036V\245\377\036V\245\377\036V\245\377\036W\245\377\036"
+ 363      FF1E56A5 
+ 363      FF1E56A5 
+ 363      FF1E57A5 
+ 363      FF1E
+ 364 13b9 57A5FF1E 		.ascii	"W\245\377\036W\245\377\036W\245\377\036X\245\377\036X\245\377"
+ 364      57A5FF1E 
+ 364      57A5FF1E 
+ 364      58A5FF1E 
+ 364      58A5FF
+ 365 13cc 1E58A5FF 		.ascii	"\036X\245\377\037X\246\377\037Y\246\377\037Y\246\377\037Y\246"
+ 365      1F58A6FF 
+ 365      1F59A6FF 
+GAS LISTING /tmp/ccjrIsGY.s 			page 25
+
+
+ 365      1F59A6FF 
+ 365      1F59A6
+ 366 13df FF1F59A6 		.ascii	"\377\037Y\246\377\037Z\246\377\037Z\246\377\037Z\246\377 Z\246"
+ 366      FF1F5AA6 
+ 366      FF1F5AA6 
+ 366      FF1F5AA6 
+ 366      FF205AA6 
+ 367 13f3 FF205BA6 		.ascii	"\377 [\246\377 [\247\377 [\247\377 [\247\377 \\\247\377 \\\247"
+ 367      FF205BA7 
+ 367      FF205BA7 
+ 367      FF205BA7 
+ 367      FF205CA7 
+ 368 140b FF215CA7 		.ascii	"\377!\\\247\377!\\\247\377!]\247\377!]\247\377!]\247\377!]\247"
+ 368      FF215CA7 
+ 368      FF215DA7 
+ 368      FF215DA7 
+ 368      FF215DA7 
+ 369 1423 FF225DA8 		.ascii	"\377\"]\250\377!^\250\377!^\250\377 _\250\377 _\250\377 _\251"
+ 369      FF215EA8 
+ 369      FF215EA8 
+ 369      FF205FA8 
+ 369      FF205FA8 
+ 370 143b FF1F60A9 		.ascii	"\377\037`\251\377\037`\251\377\036`\251\377\036a\251\377\036"
+ 370      FF1F60A9 
+ 370      FF1E60A9 
+ 370      FF1E61A9 
+ 370      FF1E
+ 371 144d 61AAFF1D 		.ascii	"a\252\377\035a\252\377\035b\252\377\034b\252\377\034b\252\377"
+ 371      61AAFF1D 
+ 371      62AAFF1C 
+ 371      62AAFF1C 
+ 371      62AAFF
+ 372 1460 1C63ABFF 		.ascii	"\034c\253\377\033c\253\377\033c\253\377\032d\253\377\032d\253"
+ 372      1B63ABFF 
+ 372      1B63ABFF 
+ 372      1A64ABFF 
+ 372      1A64AB
+ 373 1473 FF1A64AC 		.ascii	"\377\032d\254\377\031e\254\377\031e\254\377\030e\254\377\030"
+ 373      FF1965AC 
+ 373      FF1965AC 
+ 373      FF1865AC 
+ 373      FF18
+ 374 1485 66ACFF17 		.ascii	"f\254\377\027f\255\377\027f\255\377\027f\255\377\026g\255\377"
+ 374      66ADFF17 
+ 374      66ADFF17 
+ 374      66ADFF16 
+ 374      67ADFF
+ 375 1498 1667ADFF 		.ascii	"\026g\255\377\025g\256\377\025h\256\377\024h\256\377\024h\256"
+ 375      1567AEFF 
+ 375      1568AEFF 
+ 375      1468AEFF 
+ 375      1468AE
+ 376 14ab FF1469AE 		.ascii	"\377\024i\256\377\023i\257\377\023i\257\377\022j\257\377\022"
+ 376      FF1369AF 
+ 376      FF1369AF 
+ 376      FF126AAF 
+ 376      FF12
+GAS LISTING /tmp/ccjrIsGY.s 			page 26
+
+
+ 377 14bd 6AAFFF11 		.ascii	"j\257\377\021j\257\377\021k\257\377\020k\260\377\020k\260\377"
+ 377      6AAFFF11 
+ 377      6BAFFF10 
+ 377      6BB0FF10 
+ 377      6BB0FF
+ 378 14d0 106CB0FF 		.ascii	"\020l\260\377\017l\260\377\017l\260\377\016m\260\377\016m\261"
+ 378      0F6CB0FF 
+ 378      0F6CB0FF 
+ 378      0E6DB0FF 
+ 378      0E6DB1
+ 379 14e3 FF0D6DB1 		.ascii	"\377\rm\261\377\rn\261\377\rn\261\377\fn\261\377\fo\261\377\013"
+ 379      FF0D6EB1 
+ 379      FF0D6EB1 
+ 379      FF0C6EB1 
+ 379      FF0C6FB1 
+ 380 14f9 6FB2FF0B 		.ascii	"o\262\377\013o\262\377\013p\262\377\013p\262\377\np\262\377\n"
+ 380      6FB2FF0B 
+ 380      70B2FF0B 
+ 380      70B2FF0A 
+ 380      70B2FF0A 
+ 381 150d 71B2FF0A 		.ascii	"q\262\377\nq\262\377\nq\263\377\tr\263\377\tr\263\377\tr\263"
+ 381      71B2FF0A 
+ 381      71B3FF09 
+ 381      72B3FF09 
+ 381      72B3FF09 
+ 382 1523 FF087DB8 		.ascii	"\377\b}\270\377\b}\270\377\b}\270\377\007~\270\377\007~\271\377"
+ 382      FF087DB8 
+ 382      FF087DB8 
+ 382      FF077EB8 
+ 382      FF077EB9 
+ 383 1538 077EB9FF 		.ascii	"\007~\271\377\007\177\271\377\007\177\271\377\007\177\271\377"
+ 383      077FB9FF 
+ 383      077FB9FF 
+ 383      077FB9FF 
+ 384 1548 0780B9FF 		.ascii	"\007\200\271\377\007\200\271\377\007\200\272\377\007\200\272"
+ 384      0780B9FF 
+ 384      0780BAFF 
+ 384      0780BA
+ 385 1557 FF0781BA 		.ascii	"\377\007\201\272\377\007\201\272\377\007\201\272\377\b\202\272"
+ 385      FF0781BA 
+ 385      FF0781BA 
+ 385      FF0882BA 
+ 386 1567 FF0882BA 		.ascii	"\377\b\202\272\377\b\202\272\377\b\203\273\377\b\203\273\377"
+ 386      FF0882BA 
+ 386      FF0883BB 
+ 386      FF0883BB 
+ 386      FF
+ 387 1578 0983BBFF 		.ascii	"\t\203\273\377\t\204\273\377\t\204\273\377\t\204\273\377\n\205"
+ 387      0984BBFF 
+ 387      0984BBFF 
+ 387      0984BBFF 
+ 387      0A85
+ 388 158a BBFF0A85 		.ascii	"\273\377\n\205\273\377\n\205\274\377\013\205\274\377\013\206"
+ 388      BBFF0A85 
+ 388      BCFF0B85 
+ 388      BCFF0B86 
+ 389 159a BCFF0B86 		.ascii	"\274\377\013\206\274\377\f\206\274\377\f\207\274\377\r\207\274"
+GAS LISTING /tmp/ccjrIsGY.s 			page 27
+
+
+ 389      BCFF0C86 
+ 389      BCFF0C87 
+ 389      BCFF0D87 
+ 389      BC
+ 390 15ab FF0D87BC 		.ascii	"\377\r\207\274\377\016\210\275\377\016\210\275\377\017\210\275"
+ 390      FF0E88BD 
+ 390      FF0E88BD 
+ 390      FF0F88BD 
+ 391 15bb FF0F89BD 		.ascii	"\377\017\211\275\377\020\211\275\377\020\211\275\377\021\211"
+ 391      FF1089BD 
+ 391      FF1089BD 
+ 391      FF1189
+ 392 15ca BDFF118A 		.ascii	"\275\377\021\212\275\377\022\212\275\377\022\212\276\377\023"
+ 392      BDFF128A 
+ 392      BDFF128A 
+ 392      BEFF13
+ 393 15d9 8BBEFF13 		.ascii	"\213\276\377\023\213\276\377\024\213\276\377\024\214\276\377"
+ 393      8BBEFF14 
+ 393      8BBEFF14 
+ 393      8CBEFF
+ 394 15e8 158CBEFF 		.ascii	"\025\214\276\377\025\214\276\377\026\215\276\377\026\215\276"
+ 394      158CBEFF 
+ 394      168DBEFF 
+ 394      168DBE
+ 395 15f7 FF178DBE 		.ascii	"\377\027\215\276\377\027\215\277\377\030\216\277\377\030\216"
+ 395      FF178DBF 
+ 395      FF188EBF 
+ 395      FF188E
+ 396 1606 BFFF198E 		.ascii	"\277\377\031\216\277\377\031\217\277\377\032\217\277\377\032"
+ 396      BFFF198F 
+ 396      BFFF1A8F 
+ 396      BFFF1A
+ 397 1615 8FBFFF1B 		.ascii	"\217\277\377\033\220\277\377\033\220\277\377\034\220\277\377"
+ 397      90BFFF1B 
+ 397      90BFFF1C 
+ 397      90BFFF
+ 398 1624 1D91C0FF 		.ascii	"\035\221\300\377\034\221\300\377\034\221\300\377\034\221\300"
+ 398      1C91C0FF 
+ 398      1C91C0FF 
+ 398      1C91C0
+ 399 1633 FF1C91C0 		.ascii	"\377\034\221\300\377\034\222\300\377\034\222\300\377\033\222"
+ 399      FF1C92C0 
+ 399      FF1C92C0 
+ 399      FF1B92
+ 400 1642 C0FF1B92 		.ascii	"\300\377\033\222\300\377\033\223\300\377\033\223\300\377\033"
+ 400      C0FF1B93 
+ 400      C0FF1B93 
+ 400      C0FF1B
+ 401 1651 93C0FF1B 		.ascii	"\223\300\377\033\223\300\377\033\224\300\377\033\224\300\377"
+ 401      93C0FF1B 
+ 401      94C0FF1B 
+ 401      94C0FF
+ 402 1660 1B94C1FF 		.ascii	"\033\224\301\377\033\224\301\377\033\225\301\377\033\225\301"
+ 402      1B94C1FF 
+ 402      1B95C1FF 
+ 402      1B95C1
+ 403 166f FF1B95C1 		.ascii	"\377\033\225\301\377\033\225\301\377\033\226\301\377\033\226"
+GAS LISTING /tmp/ccjrIsGY.s 			page 28
+
+
+ 403      FF1B95C1 
+ 403      FF1B96C1 
+ 403      FF1B96
+ 404 167e C1FF1B96 		.ascii	"\301\377\033\226\301\377\033\226\301\377\033\227\301\377\033"
+ 404      C1FF1B96 
+ 404      C1FF1B97 
+ 404      C1FF1B
+ 405 168d 97C1FF1B 		.ascii	"\227\301\377\033\227\301\377\033\227\301\377\033\230\301\377"
+ 405      97C1FF1B 
+ 405      97C1FF1B 
+ 405      98C1FF
+ 406 169c 1B98C1FF 		.ascii	"\033\230\301\377\033\230\301\377\033\230\301\377\033\230\301"
+ 406      1B98C1FF 
+ 406      1B98C1FF 
+ 406      1B98C1
+ 407 16ab FF1B99C2 		.ascii	"\377\033\231\302\377\033\231\302\377\033\231\302\377\033\231"
+ 407      FF1B99C2 
+ 407      FF1B99C2 
+ 407      FF1B99
+ 408 16ba C2FF1C9A 		.ascii	"\302\377\034\232\302\377\034\232\302\377\034\232\302\377\034"
+ 408      C2FF1C9A 
+ 408      C2FF1C9A 
+ 408      C2FF1C
+ 409 16c9 9AC2FF1C 		.ascii	"\232\302\377\034\233\302\377\034\233\302\377\034\233\302\377"
+ 409      9BC2FF1C 
+ 409      9BC2FF1C 
+ 409      9BC2FF
+ 410 16d8 1D9BC2FF 		.ascii	"\035\233\302\377\035\234\302\377\035\234\302\377\035\234\302"
+ 410      1D9CC2FF 
+ 410      1D9CC2FF 
+ 410      1D9CC2
+ 411 16e7 FF1D9CC2 		.ascii	"\377\035\234\302\377\036\234\302\377\036\235\302\377\036\235"
+ 411      FF1E9CC2 
+ 411      FF1E9DC2 
+ 411      FF1E9D
+ 412 16f6 C2FF1E9D 		.ascii	"\302\377\036\235\302\377\037\235\302\377\037\236\302\377\037"
+ 412      C2FF1F9D 
+ 412      C2FF1F9E 
+ 412      C2FF1F
+ 413 1705 9EC2FF1F 		.ascii	"\236\302\377\037\236\302\377 \236\302\377 \237\302\377 \237\302"
+ 413      9EC2FF20 
+ 413      9EC2FF20 
+ 413      9FC2FF20 
+ 413      9FC2
+ 414 1717 FF209FC2 		.ascii	"\377 \237\302\377!\237\302\377!\240\302\377(\247\303\377)\247"
+ 414      FF219FC2 
+ 414      FF21A0C2 
+ 414      FF28A7C3 
+ 414      FF29A7
+ 415 172a C3FF29A8 		.ascii	"\303\377)\250\303\377)\250\303\377*\250\303\377*\250\303\377"
+ 415      C3FF29A8 
+ 415      C3FF2AA8 
+ 415      C3FF2AA8 
+ 415      C3FF
+ 416 173c 2AA9C3FF 		.ascii	"*\251\303\377+\251\303\377+\251\303\377+\251\303\377,\251\303"
+ 416      2BA9C3FF 
+ 416      2BA9C3FF 
+GAS LISTING /tmp/ccjrIsGY.s 			page 29
+
+
+ 416      2BA9C3FF 
+ 416      2CA9C3
+ 417 174f FF2CAAC3 		.ascii	"\377,\252\303\377,\252\303\377-\252\304\377-\252\304\377-\253"
+ 417      FF2CAAC3 
+ 417      FF2DAAC4 
+ 417      FF2DAAC4 
+ 417      FF2DAB
+ 418 1762 C4FF2EAB 		.ascii	"\304\377.\253\304\377.\253\304\377.\253\304\377/\253\304\377"
+ 418      C4FF2EAB 
+ 418      C4FF2EAB 
+ 418      C4FF2FAB 
+ 418      C4FF
+ 419 1774 2FACC4FF 		.ascii	"/\254\304\377/\254\304\3770\254\304\3770\254\304\3770\255\304"
+ 419      2FACC4FF 
+ 419      30ACC4FF 
+ 419      30ACC4FF 
+ 419      30ADC4
+ 420 1787 FF31ADC4 		.ascii	"\3771\255\304\3771\255\304\3772\255\304\3772\256\304\3772\256"
+ 420      FF31ADC4 
+ 420      FF32ADC4 
+ 420      FF32AEC4 
+ 420      FF32AE
+ 421 179a C4FF33AE 		.ascii	"\304\3773\256\304\3773\256\304\3774\256\304\3774\257\304\377"
+ 421      C4FF33AE 
+ 421      C4FF34AE 
+ 421      C4FF34AF 
+ 421      C4FF
+ 422 17ac 34AFC4FF 		.ascii	"4\257\304\3775\257\304\3775\257\304\3775\260\304\3776\260\304"
+ 422      35AFC4FF 
+ 422      35AFC4FF 
+ 422      35B0C4FF 
+ 422      36B0C4
+ 423 17bf FF36B0C4 		.ascii	"\3776\260\304\3777\260\304\3777\260\304\3777\261\304\3778\261"
+ 423      FF37B0C4 
+ 423      FF37B0C4 
+ 423      FF37B1C4 
+ 423      FF38B1
+ 424 17d2 C4FF38B1 		.ascii	"\304\3778\261\304\3779\261\304\3779\262\304\3779\262\304\377"
+ 424      C4FF39B1 
+ 424      C4FF39B2 
+ 424      C4FF39B2 
+ 424      C4FF
+ 425 17e4 3AB2C4FF 		.ascii	":\262\304\377:\262\304\377;\262\304\377"
+ 425      3AB2C4FF 
+ 425      3BB2C4FF 
+ 426 17f0 3BB3C4FF 		.ascii	";\263\304\377<\263\304\377<\263\304\377<\263\304\377=\264\304"
+ 426      3CB3C4FF 
+ 426      3CB3C4FF 
+ 426      3CB3C4FF 
+ 426      3DB4C4
+ 427 1803 FF3DB4C4 		.ascii	"\377=\264\304\377>\264\304\377>\264\304\377>\264\304\377?\265"
+ 427      FF3EB4C4 
+ 427      FF3EB4C4 
+ 427      FF3EB4C4 
+ 427      FF3FB5
+ 428 1816 C4FF3FB5 		.ascii	"\304\377?\265\304\377@\265\304\377@\265\304\377A\266\303\377"
+ 428      C4FF40B5 
+GAS LISTING /tmp/ccjrIsGY.s 			page 30
+
+
+ 428      C4FF40B5 
+ 428      C4FF41B6 
+ 428      C3FF
+ 429 1828 41B6C3FF 		.ascii	"A\266\303\377A\266\303\377B\266\303\377B\266\303\377B\266\303"
+ 429      41B6C3FF 
+ 429      42B6C3FF 
+ 429      42B6C3FF 
+ 429      42B6C3
+ 430 183b FF43B6C3 		.ascii	"\377C\266\303\377C\267\303\377D\267\303\377D\267\303\377D\267"
+ 430      FF43B7C3 
+ 430      FF44B7C3 
+ 430      FF44B7C3 
+ 430      FF44B7
+ 431 184e C3FF45B7 		.ascii	"\303\377E\267\303\377E\267\303\377E\270\303\377F\270\303\377"
+ 431      C3FF45B7 
+ 431      C3FF45B8 
+ 431      C3FF46B8 
+ 431      C3FF
+ 432 1860 46B8C3FF 		.ascii	"F\270\303\377G\270\303\377G\270\302\377G\270\302\377H\270\302"
+ 432      47B8C3FF 
+ 432      47B8C2FF 
+ 432      47B8C2FF 
+ 432      48B8C2
+ 433 1873 FF48B9C2 		.ascii	"\377H\271\302\377I\271\302\377I\271\302\377I\271\302\377J\271"
+ 433      FF49B9C2 
+ 433      FF49B9C2 
+ 433      FF49B9C2 
+ 433      FF4AB9
+ 434 1886 C2FF4AB9 		.ascii	"\302\377J\271\302\377J\272\302\377K\272\302\377K\272\302\377"
+ 434      C2FF4ABA 
+ 434      C2FF4BBA 
+ 434      C2FF4BBA 
+ 434      C2FF
+ 435 1898 4CBAC2FF 		.ascii	"L\272\302\377L\272\302\377L\272\302\377M\272\302\377M\273\301"
+ 435      4CBAC2FF 
+ 435      4CBAC2FF 
+ 435      4DBAC2FF 
+ 435      4DBBC1
+ 436 18ab FF4EBBC1 		.ascii	"\377N\273\301\377N\273\301\377N\273\301\377O\273\301\377O\273"
+ 436      FF4EBBC1 
+ 436      FF4EBBC1 
+ 436      FF4FBBC1 
+ 436      FF4FBB
+ 437 18be C1FF50BB 		.ascii	"\301\377P\273\301\377P\274\301\377P\274\301\377Q\274\301\377"
+ 437      C1FF50BC 
+ 437      C1FF50BC 
+ 437      C1FF51BC 
+ 437      C1FF
+ 438 18d0 51BCC1FF 		.ascii	"Q\274\301\377Q\274\301\377R\274\301\377R\274\301\377S\275\301"
+ 438      51BCC1FF 
+ 438      52BCC1FF 
+ 438      52BCC1FF 
+ 438      53BDC1
+ 439 18e3 FF53BDC1 		.ascii	"\377S\275\301\377S\275\300\377T\275\300\377T\275\300\377U\275"
+ 439      FF53BDC0 
+ 439      FF54BDC0 
+ 439      FF54BDC0 
+GAS LISTING /tmp/ccjrIsGY.s 			page 31
+
+
+ 439      FF55BD
+ 440 18f6 C0FF55BE 		.ascii	"\300\377U\276\300\377U\276\300\377V\276\300\377V\276\300\377"
+ 440      C0FF55BE 
+ 440      C0FF56BE 
+ 440      C0FF56BE 
+ 440      C0FF
+ 441 1908 57BEC0FF 		.ascii	"W\276\300\377W\276\300\377W\276\300\377X\277\300\377X\277\300"
+ 441      57BEC0FF 
+ 441      57BEC0FF 
+ 441      58BFC0FF 
+ 441      58BFC0
+ 442 191b FF58BFC0 		.ascii	"\377X\277\300\377Y\277\300\377f\304\276\377f\304\276\377f\304"
+ 442      FF59BFC0 
+ 442      FF66C4BE 
+ 442      FF66C4BE 
+ 442      FF66C4
+ 443 192e BEFF67C4 		.ascii	"\276\377g\304\276\377g\304\276\377h\304\275\377h\305\275\377"
+ 443      BEFF67C4 
+ 443      BEFF68C4 
+ 443      BDFF68C5 
+ 443      BDFF
+ 444 1940 68C5BDFF 		.ascii	"h\305\275\377i\305\275\377i\305\275\377j\305\275\377j\305\275"
+ 444      69C5BDFF 
+ 444      69C5BDFF 
+ 444      6AC5BDFF 
+ 444      6AC5BD
+ 445 1953 FF6AC5BD 		.ascii	"\377j\305\275\377k\306\275\377k\306\275\377l\306\275\377l\306"
+ 445      FF6BC6BD 
+ 445      FF6BC6BD 
+ 445      FF6CC6BD 
+ 445      FF6CC6
+ 446 1966 BDFF6CC6 		.ascii	"\275\377l\306\275\377m\306\275\377m\306\275\377m\307\275\377"
+ 446      BDFF6DC6 
+ 446      BDFF6DC6 
+ 446      BDFF6DC7 
+ 446      BDFF
+ 447 1978 6EC7BDFF 		.ascii	"n\307\275\377n\307\274\377o\307\274\377o\307\274\377o\307\274"
+ 447      6EC7BCFF 
+ 447      6FC7BCFF 
+ 447      6FC7BCFF 
+ 447      6FC7BC
+ 448 198b FF70C7BC 		.ascii	"\377p\307\274\377p\310\274\377q\310\274\377q\310\274\377q\310"
+ 448      FF70C8BC 
+ 448      FF71C8BC 
+ 448      FF71C8BC 
+ 448      FF71C8
+ 449 199e BCFF72C8 		.ascii	"\274\377r\310\274\377r\310\274\377s\310\274\377s\310\274\377"
+ 449      BCFF72C8 
+ 449      BCFF73C8 
+ 449      BCFF73C8 
+ 449      BCFF
+ 450 19b0 73C9BCFF 		.ascii	"s\311\274\377t\311\274\377t\311\274\377t\311\274\377u\311\274"
+ 450      74C9BCFF 
+ 450      74C9BCFF 
+ 450      74C9BCFF 
+ 450      75C9BC
+ 451 19c3 FF75C9BC 		.ascii	"\377u\311\274\377v\311\274\377v\312\273\377v\312\273\377w\312"
+GAS LISTING /tmp/ccjrIsGY.s 			page 32
+
+
+ 451      FF76C9BC 
+ 451      FF76CABB 
+ 451      FF76CABB 
+ 451      FF77CA
+ 452 19d6 BBFF77CA 		.ascii	"\273\377w\312\273\377x\312\273\377x\312\273\377x\312\273\377"
+ 452      BBFF78CA 
+ 452      BBFF78CA 
+ 452      BBFF78CA 
+ 452      BBFF
+ 453 19e8 79CBBBFF 		.ascii	"y\313\273\377y\313\273\377y\313\273\377z\313\273\377z\313\273"
+ 453      79CBBBFF 
+ 453      79CBBBFF 
+ 453      7ACBBBFF 
+ 453      7ACBBB
+ 454 19fb FF7BCBBB 		.ascii	"\377{\313\273\377{\313\273\377{\313\273\377|\314\273\377|\314"
+ 454      FF7BCBBB 
+ 454      FF7BCBBB 
+ 454      FF7CCCBB 
+ 454      FF7CCC
+ 455 1a0e BBFF7DCC 		.ascii	"\273\377}\314\273\377}\314\273\377}\314\273\377~\314\273\377"
+ 455      BBFF7DCC 
+ 455      BBFF7DCC 
+ 455      BBFF7ECC 
+ 455      BBFF
+ 456 1a20 7ECCBBFF 		.ascii	"~\314\273\377\177\315\272\377\177\315\272\377\177\315\272\377"
+ 456      7FCDBAFF 
+ 456      7FCDBAFF 
+ 456      7FCDBAFF 
+ 457 1a30 80CDBAFF 		.ascii	"\200\315\272\377\200\315\272\377\200\315\272\377\201\316\272"
+ 457      80CDBAFF 
+ 457      80CDBAFF 
+ 457      81CEBA
+ 458 1a3f FF81CEBA 		.ascii	"\377\201\316\272\377\202\316\272\377\202\316\272\377\202\316"
+ 458      FF82CEBA 
+ 458      FF82CEBA 
+ 458      FF82CE
+ 459 1a4e BAFF83CF 		.ascii	"\272\377\203\317\272\377\203\317\272\377\204\317\272\377\204"
+ 459      BAFF83CF 
+ 459      BAFF84CF 
+ 459      BAFF84
+ 460 1a5d CFBAFF84 		.ascii	"\317\272\377\204\317\272\377\205\320\272\377\205\320\272\377"
+ 460      CFBAFF85 
+ 460      D0BAFF85 
+ 460      D0BAFF
+ 461 1a6c 86D0BAFF 		.ascii	"\206\320\272\377\206\320\271\377\206\320\271\377\207\321\271"
+ 461      86D0B9FF 
+ 461      86D0B9FF 
+ 461      87D1B9
+ 462 1a7b FF87D1B9 		.ascii	"\377\207\321\271\377\210\321\271\377\210\321\271\377\210\321"
+ 462      FF88D1B9 
+ 462      FF88D1B9 
+ 462      FF88D1
+ 463 1a8a B9FF89D2 		.ascii	"\271\377\211\322\271\377\211\322\271\377\212\322\271\377\212"
+ 463      B9FF89D2 
+ 463      B9FF8AD2 
+ 463      B9FF8A
+ 464 1a99 D2B9FF8A 		.ascii	"\322\271\377\212\322\271\377\213\322\271\377\213\323\271\377"
+GAS LISTING /tmp/ccjrIsGY.s 			page 33
+
+
+ 464      D2B9FF8B 
+ 464      D2B9FF8B 
+ 464      D3B9FF
+ 465 1aa8 8CD3B9FF 		.ascii	"\214\323\271\377\214\323\271\377\215\323\271\377\215\323\270"
+ 465      8CD3B9FF 
+ 465      8DD3B9FF 
+ 465      8DD3B8
+ 466 1ab7 FF8DD4B8 		.ascii	"\377\215\324\270\377\216\324\270\377\216\324\270\377\217\324"
+ 466      FF8ED4B8 
+ 466      FF8ED4B8 
+ 466      FF8FD4
+ 467 1ac6 B8FF8FD4 		.ascii	"\270\377\217\324\270\377\220\325\270\377\220\325\270\377\220"
+ 467      B8FF90D5 
+ 467      B8FF90D5 
+ 467      B8FF90
+ 468 1ad5 D5B8FF91 		.ascii	"\325\270\377\221\325\270\377\221\325\270\377\222\325\270\377"
+ 468      D5B8FF91 
+ 468      D5B8FF92 
+ 468      D5B8FF
+ 469 1ae4 92D6B8FF 		.ascii	"\222\326\270\377\223\326\270\377\223\326\270\377\224\326\270"
+ 469      93D6B8FF 
+ 469      93D6B8FF 
+ 469      94D6B8
+ 470 1af3 FF94D6B8 		.ascii	"\377\224\326\270\377\224\327\270\377\225\327\267\377\225\327"
+ 470      FF94D7B8 
+ 470      FF95D7B7 
+ 470      FF95D7
+ 471 1b02 B7FF96D7 		.ascii	"\267\377\226\327\267\377\226\327\267\377\227\327\267\377\227"
+ 471      B7FF96D7 
+ 471      B7FF97D7 
+ 471      B7FF97
+ 472 1b11 D8B7FF98 		.ascii	"\330\267\377\230\330\267\377\230\330\267\377\230\330\267\377"
+ 472      D8B7FF98 
+ 472      D8B7FF98 
+ 472      D8B7FF
+ 473 1b20 99D8B7FF 		.ascii	"\231\330\267\377\250\336\266\377\250\336\265\377\251\336\265"
+ 473      A8DEB6FF 
+ 473      A8DEB5FF 
+ 473      A9DEB5
+ 474 1b2f FFA9DFB5 		.ascii	"\377\251\337\265\377\252\337\265\377\252\337\265\377\253\337"
+ 474      FFAADFB5 
+ 474      FFAADFB5 
+ 474      FFABDF
+ 475 1b3e B5FFABDF 		.ascii	"\265\377\253\337\265\377\253\337\265\377\254\340\265\377\254"
+ 475      B5FFABDF 
+ 475      B5FFACE0 
+ 475      B5FFAC
+ 476 1b4d E0B5FFAD 		.ascii	"\340\265\377\255\340\265\377\255\340\265\377\256\340\265\377"
+ 476      E0B5FFAD 
+ 476      E0B5FFAE 
+ 476      E0B5FF
+ 477 1b5c AEE0B5FF 		.ascii	"\256\340\265\377\257\341\265\377\257\341\265\377\260\341\265"
+ 477      AFE1B5FF 
+ 477      AFE1B5FF 
+ 477      B0E1B5
+ 478 1b6b FFB0E1B5 		.ascii	"\377\260\341\265\377\261\341\265\377\261\341\265\377\262\342"
+ 478      FFB1E1B5 
+GAS LISTING /tmp/ccjrIsGY.s 			page 34
+
+
+ 478      FFB1E1B5 
+ 478      FFB2E2
+ 479 1b7a B5FFB2E2 		.ascii	"\265\377\262\342\265\377\262\342\264\377\263\342\264\377\263"
+ 479      B5FFB2E2 
+ 479      B4FFB3E2 
+ 479      B4FFB3
+ 480 1b89 E2B4FFB4 		.ascii	"\342\264\377\264\342\264\377\264\343\264\377\265\343\264\377"
+ 480      E2B4FFB4 
+ 480      E3B4FFB5 
+ 480      E3B4FF
+ 481 1b98 B5E3B4FF 		.ascii	"\265\343\264\377\266\343\264\377\266\343\264\377\267\343\264"
+ 481      B6E3B4FF 
+ 481      B6E3B4FF 
+ 481      B7E3B4
+ 482 1ba7 FFB7E4B4 		.ascii	"\377\267\344\264\377\270\344\264\377\270\344\264\377\271\344"
+ 482      FFB8E4B4 
+ 482      FFB8E4B4 
+ 482      FFB9E4
+ 483 1bb6 B4FFB9E4 		.ascii	"\264\377\271\344\264\377\272\344\264\377\272\345\264\377\273"
+ 483      B4FFBAE4 
+ 483      B4FFBAE5 
+ 483      B4FFBB
+ 484 1bc5 E5B4FFBB 		.ascii	"\345\264\377\273\345\264\377\274\345\264\377\274\345\264\377"
+ 484      E5B4FFBC 
+ 484      E5B4FFBC 
+ 484      E5B4FF
+ 485 1bd4 BDE5B4FF 		.ascii	"\275\345\264\377\275\346\264\377\276\346\264\377\276\346\264"
+ 485      BDE6B4FF 
+ 485      BEE6B4FF 
+ 485      BEE6B4
+ 486 1be3 FFBFE6B4 		.ascii	"\377\277\346\264\377\277\346\264\377\300\346\264\377\300\347"
+ 486      FFBFE6B4 
+ 486      FFC0E6B4 
+ 486      FFC0E7
+ 487 1bf2 B4FFC1E7 		.ascii	"\264\377\301\347\264\377\301\347\264\377\302\347\264\377\302"
+ 487      B4FFC1E7 
+ 487      B4FFC2E7 
+ 487      B4FFC2
+ 488 1c01 E7B4FFC3 		.ascii	"\347\264\377\303\347\264\377\303\347\264\377\304\350\264\377"
+ 488      E7B4FFC3 
+ 488      E7B4FFC4 
+ 488      E8B4FF
+ 489 1c10 C4E8B4FF 		.ascii	"\304\350\264\377\305\350\264\377\305\350\264\377\306\350\264"
+ 489      C5E8B4FF 
+ 489      C5E8B4FF 
+ 489      C6E8B4
+ 490 1c1f FFC6E8B4 		.ascii	"\377\306\350\264\377\306\351\263\377\307\351\263\377\307\351"
+ 490      FFC6E9B3 
+ 490      FFC7E9B3 
+ 490      FFC7E9
+ 491 1c2e B3FFC7E9 		.ascii	"\263\377\307\351\263\377\307\351\263\377\310\351\263\377\310"
+ 491      B3FFC7E9 
+ 491      B3FFC8E9 
+ 491      B3FFC8
+ 492 1c3d E9B3FFC8 		.ascii	"\351\263\377\310\351\263\377\310\351\263\377\310\351\263\377"
+ 492      E9B3FFC8 
+ 492      E9B3FFC8 
+GAS LISTING /tmp/ccjrIsGY.s 			page 35
+
+
+ 492      E9B3FF
+ 493 1c4c C9EAB3FF 		.ascii	"\311\352\263\377\311\352\263\377\311\352\263\377\311\352\263"
+ 493      C9EAB3FF 
+ 493      C9EAB3FF 
+ 493      C9EAB3
+ 494 1c5b FFCAEAB3 		.ascii	"\377\312\352\263\377\312\352\263\377\312\352\263\377\312\352"
+ 494      FFCAEAB3 
+ 494      FFCAEAB3 
+ 494      FFCAEA
+ 495 1c6a B3FFCAEA 		.ascii	"\263\377\312\352\263\377\313\352\263\377\313\353\263\377\313"
+ 495      B3FFCBEA 
+ 495      B3FFCBEB 
+ 495      B3FFCB
+ 496 1c79 EBB3FFCB 		.ascii	"\353\263\377\313\353\263\377\313\353\263\377\314\353\263\377"
+ 496      EBB3FFCB 
+ 496      EBB3FFCC 
+ 496      EBB3FF
+ 497 1c88 CCEBB3FF 		.ascii	"\314\353\263\377\314\353\263\377\314\353\263\377\315\353\263"
+ 497      CCEBB3FF 
+ 497      CCEBB3FF 
+ 497      CDEBB3
+ 498 1c97 FFCDEBB3 		.ascii	"\377\315\353\263\377\315\354\263\377\315\354\263\377\315\354"
+ 498      FFCDECB3 
+ 498      FFCDECB3 
+ 498      FFCDEC
+ 499 1ca6 B3FFCEEC 		.ascii	"\263\377\316\354\263\377\316\354\263\377\316\354\263\377\316"
+ 499      B3FFCEEC 
+ 499      B3FFCEEC 
+ 499      B3FFCE
+ 500 1cb5 ECB3FFCF 		.ascii	"\354\263\377\317\354\263\377\317\354\263\377\317\354\263\377"
+ 500      ECB3FFCF 
+ 500      ECB3FFCF 
+ 500      ECB3FF
+ 501 1cc4 CFECB3FF 		.ascii	"\317\354\263\377\320\355\263\377\320\355\263\377\320\355\263"
+ 501      D0EDB3FF 
+ 501      D0EDB3FF 
+ 501      D0EDB3
+ 502 1cd3 FFD0EDB3 		.ascii	"\377\320\355\263\377\320\355\263\377\321\355\263\377\321\355"
+ 502      FFD0EDB3 
+ 502      FFD1EDB3 
+ 502      FFD1ED
+ 503 1ce2 B3FFD1ED 		.ascii	"\263\377\321\355\262\377\321\355\262\377\322\355\262\377\322"
+ 503      B2FFD1ED 
+ 503      B2FFD2ED 
+ 503      B2FFD2
+ 504 1cf1 EEB2FFD2 		.ascii	"\356\262\377\322\356\262\377\322\356\262\377\323\356\262\377"
+ 504      EEB2FFD2 
+ 504      EEB2FFD3 
+ 504      EEB2FF
+ 505 1d00 D3EEB2FF 		.ascii	"\323\356\262\377\323\356\262\377\323\356\262\377\323\356\262"
+ 505      D3EEB2FF 
+ 505      D3EEB2FF 
+ 505      D3EEB2
+ 506 1d0f FFD4EEB2 		.ascii	"\377\324\356\262\377\324\356\262\377\324\356\262\377\324\357"
+ 506      FFD4EEB2 
+ 506      FFD4EEB2 
+ 506      FFD4EF
+GAS LISTING /tmp/ccjrIsGY.s 			page 36
+
+
+ 507 1d1e B2FFD5EF 		.ascii	"\262\377\325\357\262\377\335\362\262\377\335\362\262\377\335"
+ 507      B2FFDDF2 
+ 507      B2FFDDF2 
+ 507      B2FFDD
+ 508 1d2d F2B2FFDD 		.ascii	"\362\262\377\335\362\262\377\335\362\261\377\336\362\261\377"
+ 508      F2B2FFDD 
+ 508      F2B1FFDE 
+ 508      F2B1FF
+ 509 1d3c DEF2B1FF 		.ascii	"\336\362\261\377\336\362\261\377\336\363\261\377\337\363\261"
+ 509      DEF2B1FF 
+ 509      DEF3B1FF 
+ 509      DFF3B1
+ 510 1d4b FFDFF3B1 		.ascii	"\377\337\363\261\377\337\363\261\377\337\363\261\377\340\363"
+ 510      FFDFF3B1 
+ 510      FFDFF3B1 
+ 510      FFE0F3
+ 511 1d5a B1FFE0F3 		.ascii	"\261\377\340\363\261\377\340\363\261\377\340\363\261\377\341"
+ 511      B1FFE0F3 
+ 511      B1FFE0F3 
+ 511      B1FFE1
+ 512 1d69 F3B1FFE1 		.ascii	"\363\261\377\341\363\261\377\341\364\261\377\341\364\261\377"
+ 512      F3B1FFE1 
+ 512      F4B1FFE1 
+ 512      F4B1FF
+ 513 1d78 E2F4B1FF 		.ascii	"\342\364\261\377\342\364\261\377\342\364\261\377\342\364\261"
+ 513      E2F4B1FF 
+ 513      E2F4B1FF 
+ 513      E2F4B1
+ 514 1d87 FFE3F4B1 		.ascii	"\377\343\364\261\377\343\364\261\377\343\364\261\377\343\364"
+ 514      FFE3F4B1 
+ 514      FFE3F4B1 
+ 514      FFE3F4
+ 515 1d96 B1FFE4F4 		.ascii	"\261\377\344\364\261\377\344\365\261\377\344\365\261\377\344"
+ 515      B1FFE4F5 
+ 515      B1FFE4F5 
+ 515      B1FFE4
+ 516 1da5 F5B1FFE5 		.ascii	"\365\261\377\345\365\261\377\345\365\261\377\345\365\261\377"
+ 516      F5B1FFE5 
+ 516      F5B1FFE5 
+ 516      F5B1FF
+ 517 1db4 E5F5B1FF 		.ascii	"\345\365\261\377\346\365\261\377\346\365\261\377\346\365\261"
+ 517      E6F5B1FF 
+ 517      E6F5B1FF 
+ 517      E6F5B1
+ 518 1dc3 FFE6F5B1 		.ascii	"\377\346\365\261\377\347\366\261\377\347\366\261\377\347\366"
+ 518      FFE7F6B1 
+ 518      FFE7F6B1 
+ 518      FFE7F6
+ 519 1dd2 B1FFE7F6 		.ascii	"\261\377\347\366\261\377\350\366\261\377\350\366\261\377\350"
+ 519      B1FFE8F6 
+ 519      B1FFE8F6 
+ 519      B1FFE8
+ 520 1de1 F6B1FFE8 		.ascii	"\366\261\377\350\366\261\377\351\366\261\377\351\366\261\377"
+ 520      F6B1FFE9 
+ 520      F6B1FFE9 
+ 520      F6B1FF
+ 521 1df0 E9F6B1FF 		.ascii	"\351\366\261\377\351\366\261\377\352\367\261\377\352\367\261"
+GAS LISTING /tmp/ccjrIsGY.s 			page 37
+
+
+ 521      E9F6B1FF 
+ 521      EAF7B1FF 
+ 521      EAF7B1
+ 522 1dff FFEAF7B1 		.ascii	"\377\352\367\261\377\352\367\261\377\353\367\261\377\353\367"
+ 522      FFEAF7B1 
+ 522      FFEBF7B1 
+ 522      FFEBF7
+ 523 1e0e B1FFEBF7 		.ascii	"\261\377\353\367\261\377\353\367\261\377\354\367\261\377\354"
+ 523      B1FFEBF7 
+ 523      B1FFECF7 
+ 523      B1FFEC
+ 524 1e1d F7B1FFEC 		.ascii	"\367\261\377\354\367\261\377\354\370\260\377\355\370\261\377"
+ 524      F7B1FFEC 
+ 524      F8B0FFED 
+ 524      F8B1FF
+ 525 1e2c EDF8B1FF 		.ascii	"\355\370\261\377\355\370\261\377\355\370\261\377\355\370\262"
+ 525      EDF8B1FF 
+ 525      EDF8B1FF 
+ 525      EDF8B2
+ 526 1e3b FFEDF8B2 		.ascii	"\377\355\370\262\377\355\370\262\377\356\370\262\377\356\370"
+ 526      FFEDF8B2 
+ 526      FFEEF8B2 
+ 526      FFEEF8
+ 527 1e4a B3FFEEF8 		.ascii	"\263\377\356\370\263\377\356\370\263\377\356\370\263\377\356"
+ 527      B3FFEEF8 
+ 527      B3FFEEF8 
+ 527      B3FFEE
+ 528 1e59 F8B4FFEE 		.ascii	"\370\264\377\356\370\264\377\357\370\264\377\357\370\264\377"
+ 528      F8B4FFEF 
+ 528      F8B4FFEF 
+ 528      F8B4FF
+ 529 1e68 EFF8B5FF 		.ascii	"\357\370\265\377\357\370\265\377\357\370\265\377\357\370\265"
+ 529      EFF8B5FF 
+ 529      EFF8B5FF 
+ 529      EFF8B5
+ 530 1e77 FFEFF8B6 		.ascii	"\377\357\370\266\377\357\370\266\377\360\370\266\377\360\370"
+ 530      FFEFF8B6 
+ 530      FFF0F8B6 
+ 530      FFF0F8
+ 531 1e86 B6FFF0F8 		.ascii	"\266\377\360\370\267\377\360\371\267\377\360\371\267\377\360"
+ 531      B7FFF0F9 
+ 531      B7FFF0F9 
+ 531      B7FFF0
+ 532 1e95 F9B7FFF0 		.ascii	"\371\267\377\360\371\270\377\360\371\270\377\361\371\270\377"
+ 532      F9B8FFF0 
+ 532      F9B8FFF1 
+ 532      F9B8FF
+ 533 1ea4 F1F9B8FF 		.ascii	"\361\371\270\377\361\371\271\377\361\371\271\377\361\371\271"
+ 533      F1F9B9FF 
+ 533      F1F9B9FF 
+ 533      F1F9B9
+ 534 1eb3 FFF1F9B9 		.ascii	"\377\361\371\271\377\361\371\272\377\361\371\272\377\362\371"
+ 534      FFF1F9BA 
+ 534      FFF1F9BA 
+ 534      FFF2F9
+ 535 1ec2 BAFFF2F9 		.ascii	"\272\377\362\371\272\377\362\371\273\377\362\371\273\377\362"
+ 535      BAFFF2F9 
+GAS LISTING /tmp/ccjrIsGY.s 			page 38
+
+
+ 535      BBFFF2F9 
+ 535      BBFFF2
+ 536 1ed1 F9BBFFF2 		.ascii	"\371\273\377\362\371\273\377\362\371\274\377\362\371\274\377"
+ 536      F9BBFFF2 
+ 536      F9BCFFF2 
+ 536      F9BCFF
+ 537 1ee0 F3F9BCFF 		.ascii	"\363\371\274\377\363\371\274\377\363\371\275\377\363\372\275"
+ 537      F3F9BCFF 
+ 537      F3F9BDFF 
+ 537      F3FABD
+ 538 1eef FFF3FABD 		.ascii	"\377\363\372\275\377\363\372\275\377\363\372\276\377\363\372"
+ 538      FFF3FABD 
+ 538      FFF3FABE 
+ 538      FFF3FA
+ 539 1efe BEFFF3FA 		.ascii	"\276\377\363\372\276\377\364\372\276\377\364\372\277\377\364"
+ 539      BEFFF4FA 
+ 539      BEFFF4FA 
+ 539      BFFFF4
+ 540 1f0d FABFFFF4 		.ascii	"\372\277\377\364\372\277\377\364\372\277\377\364\372\300\377"
+ 540      FABFFFF4 
+ 540      FABFFFF4 
+ 540      FAC0FF
+ 541 1f1c F4FAC0FF 		.ascii	"\364\372\300\377\364\372\300\377\370\374\310\377\370\374\311"
+ 541      F4FAC0FF 
+ 541      F8FCC8FF 
+ 541      F8FCC9
+ 542 1f2b FFF8FCC9 		.ascii	"\377\370\374\311\377\370\374\311\377\371\374\311\377\371\374"
+ 542      FFF8FCC9 
+ 542      FFF9FCC9 
+ 542      FFF9FC
+ 543 1f3a CAFFF9FC 		.ascii	"\312\377\371\374\312\377\371\374\312\377\371\374\312\377\371"
+ 543      CAFFF9FC 
+ 543      CAFFF9FC 
+ 543      CAFFF9
+ 544 1f49 FCCBFFF9 		.ascii	"\374\313\377\371\374\313\377\371\374\313\377\371\374\313\377"
+ 544      FCCBFFF9 
+ 544      FCCBFFF9 
+ 544      FCCBFF
+ 545 1f58 FAFCCCFF 		.ascii	"\372\374\314\377\372\374\314\377\372\374\314\377\372\374\314"
+ 545      FAFCCCFF 
+ 545      FAFCCCFF 
+ 545      FAFCCC
+ 546 1f67 FFFAFCCD 		.ascii	"\377\372\374\315\377\372\374\315\377\372\374\315\377\372\374"
+ 546      FFFAFCCD 
+ 546      FFFAFCCD 
+ 546      FFFAFC
+ 547 1f76 CDFFFAFC 		.ascii	"\315\377\372\374\316\377\372\375\316\377\373\375\316\377\373"
+ 547      CEFFFAFD 
+ 547      CEFFFBFD 
+ 547      CEFFFB
+ 548 1f85 FDCEFFFB 		.ascii	"\375\316\377\373\375\317\377\373\375\317\377\373\375\317\377"
+ 548      FDCFFFFB 
+ 548      FDCFFFFB 
+ 548      FDCFFF
+ 549 1f94 FBFDCFFF 		.ascii	"\373\375\317\377\373\375\320\377\373\375\320\377\373\375\320"
+ 549      FBFDD0FF 
+ 549      FBFDD0FF 
+GAS LISTING /tmp/ccjrIsGY.s 			page 39
+
+
+ 549      FBFDD0
+ 550 1fa3 FFFCFDD0 		.ascii	"\377\374\375\320\377\374\375\321\377\374\375\321\377\374\375"
+ 550      FFFCFDD1 
+ 550      FFFCFDD1 
+ 550      FFFCFD
+ 551 1fb2 D1FFFCFD 		.ascii	"\321\377\374\375\321\377\374\375\322\377\374\375\322\377"
+ 551      D1FFFCFD 
+ 551      D2FFFCFD 
+ 551      D2FF
+ 552 1fc0 FCFDD2FF 		.ascii	"\374\375\322\377\374\375\322\377\374\375\323\377\374\375\323"
+ 552      FCFDD2FF 
+ 552      FCFDD3FF 
+ 552      FCFDD3
+ 553 1fcf FFFDFDD3 		.ascii	"\377\375\375\323\377\375\376\323\377\375\376\324\377\375\376"
+ 553      FFFDFED3 
+ 553      FFFDFED4 
+ 553      FFFDFE
+ 554 1fde D4FFFDFE 		.ascii	"\324\377\375\376\324\377\375\376\324\377\375\376\325\377\375"
+ 554      D4FFFDFE 
+ 554      D4FFFDFE 
+ 554      D5FFFD
+ 555 1fed FED5FFFD 		.ascii	"\376\325\377\375\376\325\377\375\376\325\377\376\376\326\377"
+ 555      FED5FFFD 
+ 555      FED5FFFE 
+ 555      FED6FF
+ 556 1ffc FEFED6FF 		.ascii	"\376\376\326\377\376\376\326\377\376\376\326\377\376\376\327"
+ 556      FEFED6FF 
+ 556      FEFED6FF 
+ 556      FEFED7
+ 557 200b FFFEFED7 		.ascii	"\377\376\376\327\377\376\376\327\377\376\376\327\377\376\376"
+ 557      FFFEFED7 
+ 557      FFFEFED7 
+ 557      FFFEFE
+ 558 201a D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377"
+ 558      D8FFFEFE 
+ 558      D8FF
+ 559              		.globl	heatmap_cs_YlGnBu_soft
+ 560              		.section	.data.rel.local
+ 561              		.align 8
+ 562              		.type	heatmap_cs_YlGnBu_soft, @object
+ 563              		.size	heatmap_cs_YlGnBu_soft, 8
+ 564              	heatmap_cs_YlGnBu_soft:
+ 565 0010 00000000 		.quad	soft
+ 565      00000000 
+ 566              		.section	.data.rel.ro.local
+ 567              		.align 16
+ 568              		.type	soft, @object
+ 569              		.size	soft, 16
+ 570              	soft:
+ 571 0020 00000000 		.quad	soft_data
+ 571      00000000 
+ 572 0028 01040000 		.quad	1025
+ 572      00000000 
+ 573              		.section	.rodata
+ 574 2024 00000000 		.align 32
+ 574      00000000 
+ 574      00000000 
+GAS LISTING /tmp/ccjrIsGY.s 			page 40
+
+
+ 574      00000000 
+ 574      00000000 
+ 575              		.type	soft_data, @object
+ 576              		.size	soft_data, 4100
+ 577              	soft_data:
+ 578 2040 00       		.string	""
+ 579 2041 00       		.string	""
+ 580 2042 00       		.string	""
+ 581 2043 00       		.string	""
+ 582 2044 081C5800 		.string	"\b\034X"
+ 583 2048 081D5807 		.ascii	"\b\035X\007\b\035X\016\b\035Y\026\b\035Y\035\b\035Z%\t\036Z,"
+ 583      081D580E 
+ 583      081D5916 
+ 583      081D591D 
+ 583      081D5A25 
+ 584 2060 091E5B34 		.ascii	"\t\036[4\t\036[;\t\036\\C\t\036\\J\t\036\\R\n\037]Y\n\037]a\n"
+ 584      091E5B3B 
+ 584      091E5C43 
+ 584      091E5C4A 
+ 584      091E5C52 
+ 585 207d 1F5E680A 		.ascii	"\037^h\n\037^p\n\037_w\013 _\177\013 `\206\013 `\215\013 a\225"
+ 585      1F5E700A 
+ 585      1F5F770B 
+ 585      205F7F0B 
+ 585      2060860B 
+ 586 2098 0B20619C 		.ascii	"\013 a\234\f b\244\f!b\253\f!b\263\f!c\272\r!c\302\r!d\311\r"
+ 586      0C2062A4 
+ 586      0C2162AB 
+ 586      0C2162B3 
+ 586      0C2163BA 
+ 587 20b5 2164D10D 		.ascii	"!d\321\r\"e\330\r\"e\340\016\"f\347\016\"f\357\016\"g\366\016"
+ 587      2265D80D 
+ 587      2265E00E 
+ 587      2266E70E 
+ 587      2266EF0E 
+ 588 20cd 2367FE0E 		.ascii	"#g\376\016#g\377\017#h\377\017#h\377\017#i\377\017#i\377\017"
+ 588      2367FF0F 
+ 588      2368FF0F 
+ 588      2368FF0F 
+ 588      2369FF0F 
+ 589 20e5 246AFF10 		.ascii	"$j\377\020$j\377\020$k\377\020$k\377\020$l\377\021%l\377\021"
+ 589      246AFF10 
+ 589      246BFF10 
+ 589      246BFF10 
+ 589      246CFF11 
+ 590 20fd 256DFF11 		.ascii	"%m\377\021%m\377\021%n\377\021%n\377\022%n\377\022&o\377\022"
+ 590      256DFF11 
+ 590      256EFF11 
+ 590      256EFF12 
+ 590      256EFF12 
+ 591 2115 266FFF12 		.ascii	"&o\377\022&p\377\023&p\377\023&q\377\023'q\377\023'r\377\023"
+ 591      2670FF13 
+ 591      2670FF13 
+ 591      2671FF13 
+ 591      2771FF13 
+ 592 212d 2772FF14 		.ascii	"'r\377\024's\377\024's\377\024't\377\024(t\377\025(u\377\025"
+ 592      2773FF14 
+GAS LISTING /tmp/ccjrIsGY.s 			page 41
+
+
+ 592      2773FF14 
+ 592      2774FF14 
+ 592      2874FF15 
+ 593 2145 2875FF15 		.ascii	"(u\377\025(u\377\025(v\377\025(v\377\026)w\377\026)w\377\026"
+ 593      2875FF15 
+ 593      2876FF15 
+ 593      2876FF16 
+ 593      2977FF16 
+ 594 215d 2978FF16 		.ascii	")x\377\026)x\377\027)y\377\027*y\377\027*z\377\027*z\377\030"
+ 594      2978FF17 
+ 594      2979FF17 
+ 594      2A79FF17 
+ 594      2A7AFF17 
+ 595 2175 2A7BFF18 		.ascii	"*{\377\030*{\377\030*|\377\030+|\377\030+}\377\031+}\377\031"
+ 595      2A7BFF18 
+ 595      2A7CFF18 
+ 595      2B7CFF18 
+ 595      2B7DFF19 
+ 596 218d 2B7DFF19 		.ascii	"+}\377\031+~\377\031,~\377\032,\177\377\032,\177\377\032,\200"
+ 596      2B7EFF19 
+ 596      2C7EFF1A 
+ 596      2C7FFF1A 
+ 596      2C7FFF1A 
+ 597 21a3 FF1A2C80 		.ascii	"\377\032,\200\377\033,\201\377\033-\201\377\033-\202\377\033"
+ 597      FF1B2C81 
+ 597      FF1B2D81 
+ 597      FF1B2D82 
+ 597      FF1B
+ 598 21b5 2D82FF1C 		.ascii	"-\202\377\034-\203\377\034-\203\377\034.\204\377\034.\204\377"
+ 598      2D83FF1C 
+ 598      2D83FF1C 
+ 598      2E84FF1C 
+ 598      2E84FF
+ 599 21c8 1D2E85FF 		.ascii	"\035.\205\377\035.\205\377\035.\206\377\035.\206\377\036/\207"
+ 599      1D2E85FF 
+ 599      1D2E86FF 
+ 599      1D2E86FF 
+ 599      1E2F87
+ 600 21db FF1E2F87 		.ascii	"\377\036/\207\377\036/\207\377\036/\210\377\037/\210\377\037"
+ 600      FF1E2F87 
+ 600      FF1E2F88 
+ 600      FF1F2F88 
+ 600      FF1F
+ 601 21ed 3089FF1F 		.ascii	"0\211\377\0370\211\377\0370\212\377 0\212\377 0\213\377 0\213"
+ 601      3089FF1F 
+ 601      308AFF20 
+ 601      308AFF20 
+ 601      308BFF20 
+ 602 2203 FF20318C 		.ascii	"\377 1\214\377!1\214\377!1\215\377!1\215\377!1\216\377\"2\216"
+ 602      FF21318C 
+ 602      FF21318D 
+ 602      FF21318D 
+ 602      FF21318E 
+ 603 221b FF22328F 		.ascii	"\377\"2\217\377\"2\217\377\"2\220\377#2\220\377#2\221\377#3\221"
+ 603      FF22328F 
+ 603      FF223290 
+ 603      FF233290 
+GAS LISTING /tmp/ccjrIsGY.s 			page 42
+
+
+ 603      FF233291 
+ 604 2233 FF233392 		.ascii	"\377#3\222\377$3\222\377$3\223\377$3\223\377%3\224\377$4\224"
+ 604      FF243392 
+ 604      FF243393 
+ 604      FF243393 
+ 604      FF253394 
+ 605 224b FF243494 		.ascii	"\377$4\224\377$5\224\377$5\224\377$5\225\377#6\225\377#6\225"
+ 605      FF243594 
+ 605      FF243594 
+ 605      FF243595 
+ 605      FF233695 
+ 606 2263 FF233695 		.ascii	"\377#6\225\377#7\225\377#7\226\377\"7\226\377\"8\226\377\"8\226"
+ 606      FF233795 
+ 606      FF233796 
+ 606      FF223796 
+ 606      FF223896 
+ 607 227b FF223996 		.ascii	"\377\"9\226\377\"9\227\377\"9\227\377!:\227\377!:\227\377!:\227"
+ 607      FF223997 
+ 607      FF223997 
+ 607      FF213A97 
+ 607      FF213A97 
+ 608 2293 FF213B98 		.ascii	"\377!;\230\377!;\230\377!;\230\377 <\230\377 <\230\377 <\230"
+ 608      FF213B98 
+ 608      FF213B98 
+ 608      FF203C98 
+ 608      FF203C98 
+ 609 22ab FF203D99 		.ascii	"\377 =\231\377 =\231\377 =\231\377\037>\231\377\037>\231\377"
+ 609      FF203D99 
+ 609      FF203D99 
+ 609      FF1F3E99 
+ 609      FF1F3E99 
+ 610 22c0 1F3E9AFF 		.ascii	"\037>\232\377\037?\232\377\037?\232\377\037@\232\377\037@\232"
+ 610      1F3F9AFF 
+ 610      1F3F9AFF 
+ 610      1F409AFF 
+ 610      1F409A
+ 611 22d3 FF1F409A 		.ascii	"\377\037@\232\377\036A\233\377\036A\233\377\036A\233\377\036"
+ 611      FF1E419B 
+ 611      FF1E419B 
+ 611      FF1E419B 
+ 611      FF1E
+ 612 22e5 429BFF1E 		.ascii	"B\233\377\036B\233\377\036B\234\377\036C\234\377\036C\234\377"
+ 612      429BFF1E 
+ 612      429CFF1E 
+ 612      439CFF1E 
+ 612      439CFF
+ 613 22f8 1D439CFF 		.ascii	"\035C\234\377\035D\234\377\035D\234\377\035D\235\377\035E\235"
+ 613      1D449CFF 
+ 613      1D449CFF 
+ 613      1D449DFF 
+ 613      1D459D
+ 614 230b FF1D459D 		.ascii	"\377\035E\235\377\035E\235\377\035F\235\377\035F\235\377\035"
+ 614      FF1D459D 
+ 614      FF1D469D 
+ 614      FF1D469D 
+ 614      FF1D
+ 615 231d 469EFF1C 		.ascii	"F\236\377\034G\236\377\034G\236\377\034G\236\377\034G\236\377"
+GAS LISTING /tmp/ccjrIsGY.s 			page 43
+
+
+ 615      479EFF1C 
+ 615      479EFF1C 
+ 615      479EFF1C 
+ 615      479EFF
+ 616 2330 1C489EFF 		.ascii	"\034H\236\377\034H\237\377\034H\237\377\034I\237\377\034I\237"
+ 616      1C489FFF 
+ 616      1C489FFF 
+ 616      1C499FFF 
+ 616      1C499F
+ 617 2343 FF1C499F 		.ascii	"\377\034I\237\377\034J\237\377\034J\237\377\034J\240\377\034"
+ 617      FF1C4A9F 
+ 617      FF1C4A9F 
+ 617      FF1C4AA0 
+ 617      FF1C
+ 618 2355 4BA0FF1C 		.ascii	"K\240\377\034K\240\377\034K\240\377\034L\240\377\034L\240\377"
+ 618      4BA0FF1C 
+ 618      4BA0FF1C 
+ 618      4CA0FF1C 
+ 618      4CA0FF
+ 619 2368 1C4CA1FF 		.ascii	"\034L\241\377\034M\241\377\034M\241\377\034M\241\377\034N\241"
+ 619      1C4DA1FF 
+ 619      1C4DA1FF 
+ 619      1C4DA1FF 
+ 619      1C4EA1
+ 620 237b FF1C4EA1 		.ascii	"\377\034N\241\377\034N\241\377\034O\242\377\034O\242\377\034"
+ 620      FF1C4EA1 
+ 620      FF1C4FA2 
+ 620      FF1C4FA2 
+ 620      FF1C
+ 621 238d 4FA2FF1C 		.ascii	"O\242\377\034P\242\377\034P\242\377\034P\242\377\034P\242\377"
+ 621      50A2FF1C 
+ 621      50A2FF1C 
+ 621      50A2FF1C 
+ 621      50A2FF
+ 622 23a0 1C51A2FF 		.ascii	"\034Q\242\377\034Q\243\377\034Q\243\377\034R\243\377\034R\243"
+ 622      1C51A3FF 
+ 622      1C51A3FF 
+ 622      1C52A3FF 
+ 622      1C52A3
+ 623 23b3 FF1C52A3 		.ascii	"\377\034R\243\377\034S\243\377\034S\243\377\034S\244\377\035"
+ 623      FF1C53A3 
+ 623      FF1C53A3 
+ 623      FF1C53A4 
+ 623      FF1D
+ 624 23c5 54A4FF1D 		.ascii	"T\244\377\035T\244\377\035T\244\377\035U\244\377\035U\244\377"
+ 624      54A4FF1D 
+ 624      54A4FF1D 
+ 624      55A4FF1D 
+ 624      55A4FF
+ 625 23d8 1D55A4FF 		.ascii	"\035U\244\377\035V\244\377\035V\245\377\035V\245\377\036V\245"
+ 625      1D56A4FF 
+ 625      1D56A5FF 
+ 625      1D56A5FF 
+ 625      1E56A5
+ 626 23eb FF1E57A5 		.ascii	"\377\036W\245\377\036W\245\377\036W\245\377\036X\245\377\036"
+ 626      FF1E57A5 
+ 626      FF1E57A5 
+GAS LISTING /tmp/ccjrIsGY.s 			page 44
+
+
+ 626      FF1E58A5 
+ 626      FF1E
+ 627 23fd 58A5FF1E 		.ascii	"X\245\377\036X\246\377\037Y\246\377\037Y\246\377\037Y\246\377"
+ 627      58A6FF1F 
+ 627      59A6FF1F 
+ 627      59A6FF1F 
+ 627      59A6FF
+ 628 2410 1F5AA6FF 		.ascii	"\037Z\246\377\037Z\246\377\037Z\246\377 Z\246\377 [\247\377 "
+ 628      1F5AA6FF 
+ 628      1F5AA6FF 
+ 628      205AA6FF 
+ 628      205BA7FF 
+ 629 2425 5BA7FF20 		.ascii	"[\247\377 [\247\377 \\\247\377 \\\247\377!\\\247\377!]\247\377"
+ 629      5BA7FF20 
+ 629      5CA7FF20 
+ 629      5CA7FF21 
+ 629      5CA7FF21 
+ 630 243c 215DA7FF 		.ascii	"!]\247\377!]\247\377\"]\250\377!^\250\377!^\250\377 _\250\377"
+ 630      215DA7FF 
+ 630      225DA8FF 
+ 630      215EA8FF 
+ 630      215EA8FF 
+ 631 2454 205FA9FF 		.ascii	" _\251\377\037`\251\377\037`\251\377\036`\251\377\036a\252\377"
+ 631      1F60A9FF 
+ 631      1F60A9FF 
+ 631      1E60A9FF 
+ 631      1E61AAFF 
+ 632 2468 1D61AAFF 		.ascii	"\035a\252\377\035b\252\377\034b\252\377\034c\253\377\033c\253"
+ 632      1D62AAFF 
+ 632      1C62AAFF 
+ 632      1C63ABFF 
+ 632      1B63AB
+ 633 247b FF1B63AB 		.ascii	"\377\033c\253\377\032d\253\377\032d\254\377\031e\254\377\031"
+ 633      FF1A64AB 
+ 633      FF1A64AC 
+ 633      FF1965AC 
+ 633      FF19
+ 634 248d 65ACFF18 		.ascii	"e\254\377\030e\254\377\030f\255\377\027f\255\377\026g\255\377"
+ 634      65ACFF18 
+ 634      66ADFF17 
+ 634      66ADFF16 
+ 634      67ADFF
+ 635 24a0 1667ADFF 		.ascii	"\026g\255\377\025h\256\377\025h\256\377\024h\256\377\024i\256"
+ 635      1568AEFF 
+ 635      1568AEFF 
+ 635      1468AEFF 
+ 635      1469AE
+ 636 24b3 FF1369AF 		.ascii	"\377\023i\257\377\023j\257\377\022j\257\377\022j\257\377\021"
+ 636      FF136AAF 
+ 636      FF126AAF 
+ 636      FF126AAF 
+ 636      FF11
+ 637 24c5 6BB0FF11 		.ascii	"k\260\377\021k\260\377\020l\260\377\017l\260\377\017l\260\377"
+ 637      6BB0FF10 
+ 637      6CB0FF0F 
+ 637      6CB0FF0F 
+ 637      6CB0FF
+GAS LISTING /tmp/ccjrIsGY.s 			page 45
+
+
+ 638 24d8 0E6DB1FF 		.ascii	"\016m\261\377\016m\261\377\rn\261\377\rn\261\377\fn\262\377\f"
+ 638      0E6DB1FF 
+ 638      0D6EB1FF 
+ 638      0D6EB1FF 
+ 638      0C6EB2FF 
+ 639 24ed 6FB2FF0B 		.ascii	"o\262\377\013o\262\377\np\262\377\np\262\377\tp\263\377\tq\263"
+ 639      6FB2FF0A 
+ 639      70B2FF0A 
+ 639      70B2FF09 
+ 639      70B3FF09 
+ 640 2503 FF0871B3 		.ascii	"\377\bq\263\377\br\263\377\007r\263\377\007r\264\377\006s\264"
+ 640      FF0872B3 
+ 640      FF0772B3 
+ 640      FF0772B4 
+ 640      FF0673B4 
+ 641 2517 FF0673B4 		.ascii	"\377\006s\264\377\006t\264\377\005t\264\377\005u\265\377\004"
+ 641      FF0674B4 
+ 641      FF0574B4 
+ 641      FF0575B5 
+ 641      FF04
+ 642 2529 75B5FF04 		.ascii	"u\265\377\004u\265\377\004v\265\377\004v\265\377\003w\266\377"
+ 642      75B5FF04 
+ 642      76B5FF04 
+ 642      76B5FF03 
+ 642      77B6FF
+ 643 253c 0377B6FF 		.ascii	"\003w\266\377\003w\266\377\003x\266\377\002x\266\377\002x\266"
+ 643      0377B6FF 
+ 643      0378B6FF 
+ 643      0278B6FF 
+ 643      0278B6
+ 644 254f FF0279B7 		.ascii	"\377\002y\267\377\002y\267\377\002z\267\377\002z\267\377\002"
+ 644      FF0279B7 
+ 644      FF027AB7 
+ 644      FF027AB7 
+ 644      FF02
+ 645 2561 7AB7FF02 		.ascii	"z\267\377\002{\270\377\002{\270\377\002|\270\377\002|\270\377"
+ 645      7BB8FF02 
+ 645      7BB8FF02 
+ 645      7CB8FF02 
+ 645      7CB8FF
+ 646 2574 027CB8FF 		.ascii	"\002|\270\377\002}\270\377\002}\271\377\002~\271\377\002~\271"
+ 646      027DB8FF 
+ 646      027DB9FF 
+ 646      027EB9FF 
+ 646      027EB9
+ 647 2587 FF037EB9 		.ascii	"\377\003~\271\377\003\177\271\377\003\177\271\377\003\200\272"
+ 647      FF037FB9 
+ 647      FF037FB9 
+ 647      FF0380BA 
+ 648 2597 FF0480BA 		.ascii	"\377\004\200\272\377\004\200\272\377\004\201\272\377\005\201"
+ 648      FF0480BA 
+ 648      FF0481BA 
+ 648      FF0581
+ 649 25a6 BAFF0582 		.ascii	"\272\377\005\202\272\377\005\202\272\377\006\202\273\377\006"
+ 649      BAFF0582 
+ 649      BAFF0682 
+ 649      BBFF06
+GAS LISTING /tmp/ccjrIsGY.s 			page 46
+
+
+ 650 25b5 83BBFF07 		.ascii	"\203\273\377\007\203\273\377\007\203\273\377\b\204\273\377\b"
+ 650      83BBFF07 
+ 650      83BBFF08 
+ 650      84BBFF08 
+ 651 25c5 84BBFF09 		.ascii	"\204\273\377\t\205\273\377\t\205\274\377\n\205\274\377\013\206"
+ 651      85BBFF09 
+ 651      85BCFF0A 
+ 651      85BCFF0B 
+ 651      86
+ 652 25d6 BCFF0B86 		.ascii	"\274\377\013\206\274\377\f\207\274\377\f\207\274\377\r\207\274"
+ 652      BCFF0C87 
+ 652      BCFF0C87 
+ 652      BCFF0D87 
+ 652      BC
+ 653 25e7 FF0E88BD 		.ascii	"\377\016\210\275\377\016\210\275\377\017\210\275\377\020\211"
+ 653      FF0E88BD 
+ 653      FF0F88BD 
+ 653      FF1089
+ 654 25f6 BDFF1089 		.ascii	"\275\377\020\211\275\377\021\212\275\377\022\212\275\377\022"
+ 654      BDFF118A 
+ 654      BDFF128A 
+ 654      BDFF12
+ 655 2605 8ABEFF13 		.ascii	"\212\276\377\023\213\276\377\024\213\276\377\024\214\276\377"
+ 655      8BBEFF14 
+ 655      8BBEFF14 
+ 655      8CBEFF
+ 656 2614 158CBEFF 		.ascii	"\025\214\276\377\025\214\276\377\026\215\276\377\027\215\276"
+ 656      158CBEFF 
+ 656      168DBEFF 
+ 656      178DBE
+ 657 2623 FF178DBF 		.ascii	"\377\027\215\277\377\030\216\277\377\031\216\277\377\031\217"
+ 657      FF188EBF 
+ 657      FF198EBF 
+ 657      FF198F
+ 658 2632 BFFF1A8F 		.ascii	"\277\377\032\217\277\377\033\217\277\377\033\220\277\377\034"
+ 658      BFFF1B8F 
+ 658      BFFF1B90 
+ 658      BFFF1C
+ 659 2641 90BFFF1D 		.ascii	"\220\277\377\035\221\300\377\034\221\300\377\034\221\300\377"
+ 659      91C0FF1C 
+ 659      91C0FF1C 
+ 659      91C0FF
+ 660 2650 1C91C0FF 		.ascii	"\034\221\300\377\034\222\300\377\034\222\300\377\033\222\300"
+ 660      1C92C0FF 
+ 660      1C92C0FF 
+ 660      1B92C0
+ 661 265f FF1B93C0 		.ascii	"\377\033\223\300\377\033\223\300\377\033\223\300\377\033\224"
+ 661      FF1B93C0 
+ 661      FF1B93C0 
+ 661      FF1B94
+ 662 266e C0FF1B94 		.ascii	"\300\377\033\224\300\377\033\224\301\377\032\224\301\377\032"
+ 662      C0FF1B94 
+ 662      C1FF1A94 
+ 662      C1FF1A
+ 663 267d 95C1FF1A 		.ascii	"\225\301\377\032\225\301\377\032\225\301\377\032\226\301\377"
+ 663      95C1FF1A 
+ 663      95C1FF1A 
+GAS LISTING /tmp/ccjrIsGY.s 			page 47
+
+
+ 663      96C1FF
+ 664 268c 1A96C1FF 		.ascii	"\032\226\301\377\032\226\301\377\032\227\301\377\032\227\301"
+ 664      1A96C1FF 
+ 664      1A97C1FF 
+ 664      1A97C1
+ 665 269b FF1A97C1 		.ascii	"\377\032\227\301\377\032\227\301\377\032\230\301\377\032\230"
+ 665      FF1A97C1 
+ 665      FF1A98C1 
+ 665      FF1A98
+ 666 26aa C1FF1A98 		.ascii	"\301\377\032\230\302\377\032\231\302\377\032\231\302\377\032"
+ 666      C2FF1A99 
+ 666      C2FF1A99 
+ 666      C2FF1A
+ 667 26b9 99C2FF1A 		.ascii	"\231\302\377\032\232\302\377\032\232\302\377\032\232\302\377"
+ 667      9AC2FF1A 
+ 667      9AC2FF1A 
+ 667      9AC2FF
+ 668 26c8 1B9AC2FF 		.ascii	"\033\232\302\377\033\233\302\377\033\233\302\377\033\233\302"
+ 668      1B9BC2FF 
+ 668      1B9BC2FF 
+ 668      1B9BC2
+ 669 26d7 FF1B9CC2 		.ascii	"\377\033\234\302\377\033\234\302\377\033\234\302\377\034\235"
+ 669      FF1B9CC2 
+ 669      FF1B9CC2 
+ 669      FF1C9D
+ 670 26e6 C2FF1C9D 		.ascii	"\302\377\034\235\302\377\034\235\302\377\034\235\302\377\034"
+ 670      C2FF1C9D 
+ 670      C2FF1C9D 
+ 670      C2FF1C
+ 671 26f5 9EC3FF1D 		.ascii	"\236\303\377\035\236\303\377\035\236\303\377\035\237\303\377"
+ 671      9EC3FF1D 
+ 671      9EC3FF1D 
+ 671      9FC3FF
+ 672 2704 1D9FC3FF 		.ascii	"\035\237\303\377\036\237\303\377\036\237\303\377\036\240\303"
+ 672      1E9FC3FF 
+ 672      1E9FC3FF 
+ 672      1EA0C3
+ 673 2713 FF1EA0C3 		.ascii	"\377\036\240\303\377\037\240\303\377\037\241\303\377\037\241"
+ 673      FF1FA0C3 
+ 673      FF1FA1C3 
+ 673      FF1FA1
+ 674 2722 C3FF20A1 		.ascii	"\303\377 \241\303\377 \242\303\377 \242\303\377!\242\303\377"
+ 674      C3FF20A2 
+ 674      C3FF20A2 
+ 674      C3FF21A2 
+ 674      C3FF
+ 675 2734 21A2C3FF 		.ascii	"!\242\303\377!\243\303\377\"\243\303\377\"\243\303\377\"\244"
+ 675      21A3C3FF 
+ 675      22A3C3FF 
+ 675      22A3C3FF 
+ 675      22A4
+ 676 2746 C3FF23A4 		.ascii	"\303\377#\244\303\377#\244\303\377$\244\303\377$\245\303\377"
+ 676      C3FF23A4 
+ 676      C3FF24A4 
+ 676      C3FF24A5 
+ 676      C3FF
+ 677 2758 24A5C3FF 		.ascii	"$\245\303\377%\245\303\377%\246\303\377&\246\303\377&\246\303"
+GAS LISTING /tmp/ccjrIsGY.s 			page 48
+
+
+ 677      25A5C3FF 
+ 677      25A6C3FF 
+ 677      26A6C3FF 
+ 677      26A6C3
+ 678 276b FF26A6C3 		.ascii	"\377&\246\303\377'\247\303\377'\247\303\377(\247\304\377(\250"
+ 678      FF27A7C3 
+ 678      FF27A7C3 
+ 678      FF28A7C4 
+ 678      FF28A8
+ 679 277e C4FF28A8 		.ascii	"\304\377(\250\304\377)\250\304\377)\250\304\377*\251\304\377"
+ 679      C4FF29A8 
+ 679      C4FF29A8 
+ 679      C4FF2AA9 
+ 679      C4FF
+ 680 2790 2AA9C4FF 		.ascii	"*\251\304\377+\251\304\377+\252\304\377,\252\304\377,\252\304"
+ 680      2BA9C4FF 
+ 680      2BAAC4FF 
+ 680      2CAAC4FF 
+ 680      2CAAC4
+ 681 27a3 FF2CAAC4 		.ascii	"\377,\252\304\377-\253\304\377-\253\304\377.\253\304\377.\254"
+ 681      FF2DABC4 
+ 681      FF2DABC4 
+ 681      FF2EABC4 
+ 681      FF2EAC
+ 682 27b6 C4FF2FAC 		.ascii	"\304\377/\254\304\377/\254\304\3770\254\304\3770\255\304\377"
+ 682      C4FF2FAC 
+ 682      C4FF30AC 
+ 682      C4FF30AD 
+ 682      C4FF
+ 683 27c8 31ADC4FF 		.ascii	"1\255\304\3771\255\304\3772\255\304\3772\256\304\3773\256\304"
+ 683      31ADC4FF 
+ 683      32ADC4FF 
+ 683      32AEC4FF 
+ 683      33AEC4
+ 684 27db FF33AEC4 		.ascii	"\3773\256\304\3774\257\304\3774\257\304\3775\257\304\3775\257"
+ 684      FF34AFC4 
+ 684      FF34AFC4 
+ 684      FF35AFC4 
+ 684      FF35AF
+ 685 27ee C4FF36B0 		.ascii	"\304\3776\260\304\3776\260\304\3777\260\304\3777\261\304\377"
+ 685      C4FF36B0 
+ 685      C4FF37B0 
+ 685      C4FF37B1 
+ 685      C4FF
+ 686 2800 38B1C4FF 		.ascii	"8\261\304\3778\261\304\3779\261\304\3779\262\304\377"
+ 686      38B1C4FF 
+ 686      39B1C4FF 
+ 686      39B2C4FF 
+ 687 2810 3AB2C4FF 		.ascii	":\262\304\377:\262\304\377;\262\304\377;\263\304\377<\263\304"
+ 687      3AB2C4FF 
+ 687      3BB2C4FF 
+ 687      3BB3C4FF 
+ 687      3CB3C4
+ 688 2823 FF3CB3C4 		.ascii	"\377<\263\304\377=\264\304\377=\264\304\377>\264\304\377>\264"
+ 688      FF3DB4C4 
+ 688      FF3DB4C4 
+ 688      FF3EB4C4 
+GAS LISTING /tmp/ccjrIsGY.s 			page 49
+
+
+ 688      FF3EB4
+ 689 2836 C4FF3FB5 		.ascii	"\304\377?\265\304\377?\265\304\377@\265\304\377A\266\303\377"
+ 689      C4FF3FB5 
+ 689      C4FF40B5 
+ 689      C4FF41B6 
+ 689      C3FF
+ 690 2848 41B6C3FF 		.ascii	"A\266\303\377A\266\303\377B\266\303\377B\266\303\377C\266\303"
+ 690      41B6C3FF 
+ 690      42B6C3FF 
+ 690      42B6C3FF 
+ 690      43B6C3
+ 691 285b FF43B7C3 		.ascii	"\377C\267\303\377D\267\303\377D\267\303\377E\267\303\377E\267"
+ 691      FF44B7C3 
+ 691      FF44B7C3 
+ 691      FF45B7C3 
+ 691      FF45B7
+ 692 286e C3FF46B8 		.ascii	"\303\377F\270\303\377F\270\303\377G\270\303\377G\270\302\377"
+ 692      C3FF46B8 
+ 692      C3FF47B8 
+ 692      C3FF47B8 
+ 692      C2FF
+ 693 2880 48B8C2FF 		.ascii	"H\270\302\377H\271\302\377I\271\302\377I\271\302\377J\271\302"
+ 693      48B9C2FF 
+ 693      49B9C2FF 
+ 693      49B9C2FF 
+ 693      4AB9C2
+ 694 2893 FF4AB9C2 		.ascii	"\377J\271\302\377K\272\302\377K\272\302\377L\272\302\377L\272"
+ 694      FF4BBAC2 
+ 694      FF4BBAC2 
+ 694      FF4CBAC2 
+ 694      FF4CBA
+ 695 28a6 C2FF4DBA 		.ascii	"\302\377M\272\302\377M\273\302\377M\273\301\377N\273\301\377"
+ 695      C2FF4DBB 
+ 695      C2FF4DBB 
+ 695      C1FF4EBB 
+ 695      C1FF
+ 696 28b8 4EBBC1FF 		.ascii	"N\273\301\377O\273\301\377O\273\301\377P\274\301\377P\274\301"
+ 696      4FBBC1FF 
+ 696      4FBBC1FF 
+ 696      50BCC1FF 
+ 696      50BCC1
+ 697 28cb FF51BCC1 		.ascii	"\377Q\274\301\377Q\274\301\377R\274\301\377R\275\301\377S\275"
+ 697      FF51BCC1 
+ 697      FF52BCC1 
+ 697      FF52BDC1 
+ 697      FF53BD
+ 698 28de C1FF53BD 		.ascii	"\301\377S\275\300\377T\275\300\377T\275\300\377U\276\300\377"
+ 698      C0FF54BD 
+ 698      C0FF54BD 
+ 698      C0FF55BE 
+ 698      C0FF
+ 699 28f0 55BEC0FF 		.ascii	"U\276\300\377V\276\300\377V\276\300\377W\276\300\377W\276\300"
+ 699      56BEC0FF 
+ 699      56BEC0FF 
+ 699      57BEC0FF 
+ 699      57BEC0
+ 700 2903 FF58BFC0 		.ascii	"\377X\277\300\377X\277\300\377Y\277\300\377Y\277\300\377Z\277"
+GAS LISTING /tmp/ccjrIsGY.s 			page 50
+
+
+ 700      FF58BFC0 
+ 700      FF59BFC0 
+ 700      FF59BFC0 
+ 700      FF5ABF
+ 701 2916 BFFF5AC0 		.ascii	"\277\377Z\300\277\377[\300\277\377[\300\277\377\\\300\277\377"
+ 701      BFFF5BC0 
+ 701      BFFF5BC0 
+ 701      BFFF5CC0 
+ 701      BFFF
+ 702 2928 5CC0BFFF 		.ascii	"\\\300\277\377]\300\277\377]\301\277\377^\301\277\377^\301\277"
+ 702      5DC0BFFF 
+ 702      5DC1BFFF 
+ 702      5EC1BFFF 
+ 702      5EC1BF
+ 703 293b FF5EC1BF 		.ascii	"\377^\301\277\377_\301\277\377_\302\277\377`\302\277\377`\302"
+ 703      FF5FC1BF 
+ 703      FF5FC2BF 
+ 703      FF60C2BF 
+ 703      FF60C2
+ 704 294e BEFF61C2 		.ascii	"\276\377a\302\276\377a\302\276\377b\302\276\377b\303\276\377"
+ 704      BEFF61C2 
+ 704      BEFF62C2 
+ 704      BEFF62C3 
+ 704      BEFF
+ 705 2960 63C3BEFF 		.ascii	"c\303\276\377c\303\276\377d\303\276\377d\303\276\377e\303\276"
+ 705      63C3BEFF 
+ 705      64C3BEFF 
+ 705      64C3BEFF 
+ 705      65C3BE
+ 706 2973 FF65C4BE 		.ascii	"\377e\304\276\377f\304\276\377f\304\276\377g\304\275\377g\304"
+ 706      FF66C4BE 
+ 706      FF66C4BE 
+ 706      FF67C4BD 
+ 706      FF67C4
+ 707 2986 BDFF68C5 		.ascii	"\275\377h\305\275\377h\305\275\377i\305\275\377i\305\275\377"
+ 707      BDFF68C5 
+ 707      BDFF69C5 
+ 707      BDFF69C5 
+ 707      BDFF
+ 708 2998 6AC5BDFF 		.ascii	"j\305\275\377j\305\275\377k\306\275\377k\306\275\377l\306\275"
+ 708      6AC5BDFF 
+ 708      6BC6BDFF 
+ 708      6BC6BDFF 
+ 708      6CC6BD
+ 709 29ab FF6CC6BD 		.ascii	"\377l\306\275\377m\306\275\377m\306\275\377n\307\275\377n\307"
+ 709      FF6DC6BD 
+ 709      FF6DC6BD 
+ 709      FF6EC7BD 
+ 709      FF6EC7
+ 710 29be BCFF6FC7 		.ascii	"\274\377o\307\274\377o\307\274\377p\307\274\377p\307\274\377"
+ 710      BCFF6FC7 
+ 710      BCFF70C7 
+ 710      BCFF70C7 
+ 710      BCFF
+ 711 29d0 70C8BCFF 		.ascii	"p\310\274\377q\310\274\377q\310\274\377r\310\274\377r\310\274"
+ 711      71C8BCFF 
+ 711      71C8BCFF 
+GAS LISTING /tmp/ccjrIsGY.s 			page 51
+
+
+ 711      72C8BCFF 
+ 711      72C8BC
+ 712 29e3 FF73C8BC 		.ascii	"\377s\310\274\377s\311\274\377t\311\274\377t\311\274\377u\311"
+ 712      FF73C9BC 
+ 712      FF74C9BC 
+ 712      FF74C9BC 
+ 712      FF75C9
+ 713 29f6 BCFF75C9 		.ascii	"\274\377u\311\274\377v\312\273\377v\312\273\377w\312\273\377"
+ 713      BCFF76CA 
+ 713      BBFF76CA 
+ 713      BBFF77CA 
+ 713      BBFF
+ 714 2a08 77CABBFF 		.ascii	"w\312\273\377x\312\273\377x\312\273\377y\313\273\377y\313\273"
+ 714      78CABBFF 
+ 714      78CABBFF 
+ 714      79CBBBFF 
+ 714      79CBBB
+ 715 2a1b FF7ACBBB 		.ascii	"\377z\313\273\377z\313\273\377{\313\273\377{\313\273\377|\314"
+ 715      FF7ACBBB 
+ 715      FF7BCBBB 
+ 715      FF7BCBBB 
+ 715      FF7CCC
+ 716 2a2e BBFF7CCC 		.ascii	"\273\377|\314\273\377}\314\273\377}\314\273\377~\314\273\377"
+ 716      BBFF7DCC 
+ 716      BBFF7DCC 
+ 716      BBFF7ECC 
+ 716      BBFF
+ 717 2a40 7ECCBBFF 		.ascii	"~\314\273\377\177\315\272\377\177\315\272\377\177\315\272\377"
+ 717      7FCDBAFF 
+ 717      7FCDBAFF 
+ 717      7FCDBAFF 
+ 718 2a50 80CDBAFF 		.ascii	"\200\315\272\377\200\315\272\377\201\316\272\377\201\316\272"
+ 718      80CDBAFF 
+ 718      81CEBAFF 
+ 718      81CEBA
+ 719 2a5f FF82CEBA 		.ascii	"\377\202\316\272\377\202\316\272\377\203\317\272\377\203\317"
+ 719      FF82CEBA 
+ 719      FF83CFBA 
+ 719      FF83CF
+ 720 2a6e BAFF84CF 		.ascii	"\272\377\204\317\272\377\204\317\272\377\205\320\272\377\205"
+ 720      BAFF84CF 
+ 720      BAFF85D0 
+ 720      BAFF85
+ 721 2a7d D0BAFF86 		.ascii	"\320\272\377\206\320\271\377\206\320\271\377\207\321\271\377"
+ 721      D0B9FF86 
+ 721      D0B9FF87 
+ 721      D1B9FF
+ 722 2a8c 87D1B9FF 		.ascii	"\207\321\271\377\210\321\271\377\210\321\271\377\211\322\271"
+ 722      88D1B9FF 
+ 722      88D1B9FF 
+ 722      89D2B9
+ 723 2a9b FF89D2B9 		.ascii	"\377\211\322\271\377\212\322\271\377\212\322\271\377\213\323"
+ 723      FF8AD2B9 
+ 723      FF8AD2B9 
+ 723      FF8BD3
+ 724 2aaa B9FF8BD3 		.ascii	"\271\377\213\323\271\377\214\323\271\377\214\323\271\377\215"
+ 724      B9FF8CD3 
+GAS LISTING /tmp/ccjrIsGY.s 			page 52
+
+
+ 724      B9FF8CD3 
+ 724      B9FF8D
+ 725 2ab9 D3B8FF8D 		.ascii	"\323\270\377\215\324\270\377\216\324\270\377\217\324\270\377"
+ 725      D4B8FF8E 
+ 725      D4B8FF8F 
+ 725      D4B8FF
+ 726 2ac8 8FD4B8FF 		.ascii	"\217\324\270\377\220\325\270\377\220\325\270\377\221\325\270"
+ 726      90D5B8FF 
+ 726      90D5B8FF 
+ 726      91D5B8
+ 727 2ad7 FF91D5B8 		.ascii	"\377\221\325\270\377\222\326\270\377\222\326\270\377\223\326"
+ 727      FF92D6B8 
+ 727      FF92D6B8 
+ 727      FF93D6
+ 728 2ae6 B8FF93D6 		.ascii	"\270\377\223\326\270\377\224\327\270\377\224\327\267\377\225"
+ 728      B8FF94D7 
+ 728      B8FF94D7 
+ 728      B7FF95
+ 729 2af5 D7B7FF95 		.ascii	"\327\267\377\225\327\267\377\226\327\267\377\227\330\267\377"
+ 729      D7B7FF96 
+ 729      D7B7FF97 
+ 729      D8B7FF
+ 730 2b04 97D8B7FF 		.ascii	"\227\330\267\377\230\330\267\377\230\330\267\377\231\331\267"
+ 730      98D8B7FF 
+ 730      98D8B7FF 
+ 730      99D9B7
+ 731 2b13 FF99D9B7 		.ascii	"\377\231\331\267\377\232\331\267\377\232\331\267\377\233\331"
+ 731      FF9AD9B7 
+ 731      FF9AD9B7 
+ 731      FF9BD9
+ 732 2b22 B7FF9CDA 		.ascii	"\267\377\234\332\267\377\234\332\267\377\235\332\266\377\235"
+ 732      B7FF9CDA 
+ 732      B7FF9DDA 
+ 732      B6FF9D
+ 733 2b31 DAB6FF9E 		.ascii	"\332\266\377\236\333\266\377\236\333\266\377\237\333\266\377"
+ 733      DBB6FF9E 
+ 733      DBB6FF9F 
+ 733      DBB6FF
+ 734 2b40 A0DBB6FF 		.ascii	"\240\333\266\377\240\333\266\377\241\334\266\377\241\334\266"
+ 734      A0DBB6FF 
+ 734      A1DCB6FF 
+ 734      A1DCB6
+ 735 2b4f FFA2DCB6 		.ascii	"\377\242\334\266\377\242\334\266\377\243\335\266\377\244\335"
+ 735      FFA2DCB6 
+ 735      FFA3DDB6 
+ 735      FFA4DD
+ 736 2b5e B6FFA4DD 		.ascii	"\266\377\244\335\266\377\245\335\266\377\245\335\266\377\246"
+ 736      B6FFA5DD 
+ 736      B6FFA5DD 
+ 736      B6FFA6
+ 737 2b6d DEB5FFA6 		.ascii	"\336\265\377\246\336\265\377\247\336\265\377\250\336\265\377"
+ 737      DEB5FFA7 
+ 737      DEB5FFA8 
+ 737      DEB5FF
+ 738 2b7c A8DEB5FF 		.ascii	"\250\336\265\377\251\337\265\377\251\337\265\377\252\337\265"
+ 738      A9DFB5FF 
+ 738      A9DFB5FF 
+GAS LISTING /tmp/ccjrIsGY.s 			page 53
+
+
+ 738      AADFB5
+ 739 2b8b FFABDFB5 		.ascii	"\377\253\337\265\377\253\340\265\377\254\340\265\377\254\340"
+ 739      FFABE0B5 
+ 739      FFACE0B5 
+ 739      FFACE0
+ 740 2b9a B5FFADE0 		.ascii	"\265\377\255\340\265\377\255\340\265\377\256\341\265\377\257"
+ 740      B5FFADE0 
+ 740      B5FFAEE1 
+ 740      B5FFAF
+ 741 2ba9 E1B5FFAF 		.ascii	"\341\265\377\257\341\265\377\260\341\265\377\260\341\265\377"
+ 741      E1B5FFB0 
+ 741      E1B5FFB0 
+ 741      E1B5FF
+ 742 2bb8 B1E2B4FF 		.ascii	"\261\342\264\377\262\342\264\377\262\342\264\377\263\342\264"
+ 742      B2E2B4FF 
+ 742      B2E2B4FF 
+ 742      B3E2B4
+ 743 2bc7 FFB3E2B4 		.ascii	"\377\263\342\264\377\264\343\264\377\265\343\264\377\265\343"
+ 743      FFB4E3B4 
+ 743      FFB5E3B4 
+ 743      FFB5E3
+ 744 2bd6 B4FFB6E3 		.ascii	"\264\377\266\343\264\377\266\343\264\377\267\344\264\377\270"
+ 744      B4FFB6E3 
+ 744      B4FFB7E4 
+ 744      B4FFB8
+ 745 2be5 E4B4FFB8 		.ascii	"\344\264\377\270\344\264\377\271\344\264\377\272\344\264\377"
+ 745      E4B4FFB9 
+ 745      E4B4FFBA 
+ 745      E4B4FF
+ 746 2bf4 BAE5B4FF 		.ascii	"\272\345\264\377\273\345\264\377\273\345\264\377\274\345\264"
+ 746      BBE5B4FF 
+ 746      BBE5B4FF 
+ 746      BCE5B4
+ 747 2c03 FFBDE5B4 		.ascii	"\377\275\345\264\377\275\346\264\377\276\346\264\377\276\346"
+ 747      FFBDE6B4 
+ 747      FFBEE6B4 
+ 747      FFBEE6
+ 748 2c12 B4FFBFE6 		.ascii	"\264\377\277\346\264\377\300\346\264\377\300\347\264\377\301"
+ 748      B4FFC0E6 
+ 748      B4FFC0E7 
+ 748      B4FFC1
+ 749 2c21 E7B4FFC2 		.ascii	"\347\264\377\302\347\264\377\302\347\264\377\303\347\264\377"
+ 749      E7B4FFC2 
+ 749      E7B4FFC3 
+ 749      E7B4FF
+ 750 2c30 C3E8B4FF 		.ascii	"\303\350\264\377\304\350\264\377\305\350\264\377\305\350\264"
+ 750      C4E8B4FF 
+ 750      C5E8B4FF 
+ 750      C5E8B4
+ 751 2c3f FFC6E8B4 		.ascii	"\377\306\350\264\377\306\351\263\377\307\351\263\377\307\351"
+ 751      FFC6E9B3 
+ 751      FFC7E9B3 
+ 751      FFC7E9
+ 752 2c4e B3FFC7E9 		.ascii	"\263\377\307\351\263\377\310\351\263\377\310\351\263\377\310"
+ 752      B3FFC8E9 
+ 752      B3FFC8E9 
+ 752      B3FFC8
+GAS LISTING /tmp/ccjrIsGY.s 			page 54
+
+
+ 753 2c5d E9B3FFC8 		.ascii	"\351\263\377\310\351\263\377\311\352\263\377\311\352\263\377"
+ 753      E9B3FFC9 
+ 753      EAB3FFC9 
+ 753      EAB3FF
+ 754 2c6c C9EAB3FF 		.ascii	"\311\352\263\377\311\352\263\377\312\352\263\377\312\352\263"
+ 754      C9EAB3FF 
+ 754      CAEAB3FF 
+ 754      CAEAB3
+ 755 2c7b FFCAEAB3 		.ascii	"\377\312\352\263\377\313\352\263\377\313\353\263\377\313\353"
+ 755      FFCBEAB3 
+ 755      FFCBEBB3 
+ 755      FFCBEB
+ 756 2c8a B3FFCBEB 		.ascii	"\263\377\313\353\263\377\314\353\263\377\314\353\263\377\314"
+ 756      B3FFCCEB 
+ 756      B3FFCCEB 
+ 756      B3FFCC
+ 757 2c99 EBB3FFCC 		.ascii	"\353\263\377\314\353\263\377\315\353\263\377\315\354\263\377"
+ 757      EBB3FFCD 
+ 757      EBB3FFCD 
+ 757      ECB3FF
+ 758 2ca8 CDECB3FF 		.ascii	"\315\354\263\377\316\354\263\377\316\354\263\377\316\354\263"
+ 758      CEECB3FF 
+ 758      CEECB3FF 
+ 758      CEECB3
+ 759 2cb7 FFCEECB3 		.ascii	"\377\316\354\263\377\317\354\263\377\317\354\263\377\317\355"
+ 759      FFCFECB3 
+ 759      FFCFECB3 
+ 759      FFCFED
+ 760 2cc6 B3FFD0ED 		.ascii	"\263\377\320\355\263\377\320\355\263\377\320\355\263\377\320"
+ 760      B3FFD0ED 
+ 760      B3FFD0ED 
+ 760      B3FFD0
+ 761 2cd5 EDB3FFD1 		.ascii	"\355\263\377\321\355\263\377\321\355\262\377\321\355\262\377"
+ 761      EDB3FFD1 
+ 761      EDB2FFD1 
+ 761      EDB2FF
+ 762 2ce4 D2EDB2FF 		.ascii	"\322\355\262\377\322\356\262\377\322\356\262\377\322\356\262"
+ 762      D2EEB2FF 
+ 762      D2EEB2FF 
+ 762      D2EEB2
+ 763 2cf3 FFD3EEB2 		.ascii	"\377\323\356\262\377\323\356\262\377\323\356\262\377\324\356"
+ 763      FFD3EEB2 
+ 763      FFD3EEB2 
+ 763      FFD4EE
+ 764 2d02 B2FFD4EE 		.ascii	"\262\377\324\356\262\377\324\357\262\377\324\357\262\377\325"
+ 764      B2FFD4EF 
+ 764      B2FFD4EF 
+ 764      B2FFD5
+ 765 2d11 EFB2FFD5 		.ascii	"\357\262\377\325\357\262\377\325\357\262\377\326\357\262\377"
+ 765      EFB2FFD5 
+ 765      EFB2FFD6 
+ 765      EFB2FF
+ 766 2d20 D6EFB2FF 		.ascii	"\326\357\262\377\326\357\262\377\326\360\262\377\327\360\262"
+ 766      D6EFB2FF 
+ 766      D6F0B2FF 
+ 766      D7F0B2
+ 767 2d2f FFD7F0B2 		.ascii	"\377\327\360\262\377\327\360\262\377\330\360\262\377\330\360"
+GAS LISTING /tmp/ccjrIsGY.s 			page 55
+
+
+ 767      FFD7F0B2 
+ 767      FFD8F0B2 
+ 767      FFD8F0
+ 768 2d3e B2FFD8F0 		.ascii	"\262\377\330\360\262\377\331\360\262\377\331\360\262\377\331"
+ 768      B2FFD9F0 
+ 768      B2FFD9F0 
+ 768      B2FFD9
+ 769 2d4d F1B2FFD9 		.ascii	"\361\262\377\331\361\262\377\332\361\262\377\332\361\262\377"
+ 769      F1B2FFDA 
+ 769      F1B2FFDA 
+ 769      F1B2FF
+ 770 2d5c DAF1B2FF 		.ascii	"\332\361\262\377\333\361\262\377\333\361\262\377\333\361\262"
+ 770      DBF1B2FF 
+ 770      DBF1B2FF 
+ 770      DBF1B2
+ 771 2d6b FFDCF2B2 		.ascii	"\377\334\362\262\377\334\362\262\377\334\362\262\377\334\362"
+ 771      FFDCF2B2 
+ 771      FFDCF2B2 
+ 771      FFDCF2
+ 772 2d7a B2FFDDF2 		.ascii	"\262\377\335\362\261\377\335\362\261\377\335\362\261\377\336"
+ 772      B1FFDDF2 
+ 772      B1FFDDF2 
+ 772      B1FFDE
+ 773 2d89 F2B1FFDE 		.ascii	"\362\261\377\336\362\261\377\336\363\261\377\337\363\261\377"
+ 773      F2B1FFDE 
+ 773      F3B1FFDF 
+ 773      F3B1FF
+ 774 2d98 DFF3B1FF 		.ascii	"\337\363\261\377\337\363\261\377\337\363\261\377\340\363\261"
+ 774      DFF3B1FF 
+ 774      DFF3B1FF 
+ 774      E0F3B1
+ 775 2da7 FFE0F3B1 		.ascii	"\377\340\363\261\377\340\363\261\377\341\363\261\377\341\364"
+ 775      FFE0F3B1 
+ 775      FFE1F3B1 
+ 775      FFE1F4
+ 776 2db6 B1FFE1F4 		.ascii	"\261\377\341\364\261\377\342\364\261\377\342\364\261\377\342"
+ 776      B1FFE2F4 
+ 776      B1FFE2F4 
+ 776      B1FFE2
+ 777 2dc5 F4B1FFE3 		.ascii	"\364\261\377\343\364\261\377\343\364\261\377\343\364\261\377"
+ 777      F4B1FFE3 
+ 777      F4B1FFE3 
+ 777      F4B1FF
+ 778 2dd4 E4F4B1FF 		.ascii	"\344\364\261\377\344\365\261\377\344\365\261\377\344\365\261"
+ 778      E4F5B1FF 
+ 778      E4F5B1FF 
+ 778      E4F5B1
+ 779 2de3 FFE5F5B1 		.ascii	"\377\345\365\261\377\345\365\261\377\345\365\261\377\346\365"
+ 779      FFE5F5B1 
+ 779      FFE5F5B1 
+ 779      FFE6F5
+ 780 2df2 B1FFE6F5 		.ascii	"\261\377\346\365\261\377\346\365\261\377\347\366\261\377\347"
+ 780      B1FFE6F5 
+ 780      B1FFE7F6 
+ 780      B1FFE7
+ 781 2e01 F6B1FFE7 		.ascii	"\366\261\377\347\366\261\377\350\366\261\377\350\366\261\377"
+ 781      F6B1FFE8 
+GAS LISTING /tmp/ccjrIsGY.s 			page 56
+
+
+ 781      F6B1FFE8 
+ 781      F6B1FF
+ 782 2e10 E8F6B1FF 		.ascii	"\350\366\261\377\351\366\261\377\351\366\261\377\351\366\261"
+ 782      E9F6B1FF 
+ 782      E9F6B1FF 
+ 782      E9F6B1
+ 783 2e1f FFEAF7B1 		.ascii	"\377\352\367\261\377\352\367\261\377\352\367\261\377\353\367"
+ 783      FFEAF7B1 
+ 783      FFEAF7B1 
+ 783      FFEBF7
+ 784 2e2e B1FFEBF7 		.ascii	"\261\377\353\367\261\377\353\367\261\377\354\367\261\377\354"
+ 784      B1FFEBF7 
+ 784      B1FFECF7 
+ 784      B1FFEC
+ 785 2e3d F7B1FFEC 		.ascii	"\367\261\377\354\367\261\377\354\370\260\377\355\370\261\377"
+ 785      F7B1FFEC 
+ 785      F8B0FFED 
+ 785      F8B1FF
+ 786 2e4c EDF8B1FF 		.ascii	"\355\370\261\377\355\370\261\377\355\370\262\377\355\370\262"
+ 786      EDF8B1FF 
+ 786      EDF8B2FF 
+ 786      EDF8B2
+ 787 2e5b FFEEF8B2 		.ascii	"\377\356\370\262\377\356\370\263\377\356\370\263\377\356\370"
+ 787      FFEEF8B3 
+ 787      FFEEF8B3 
+ 787      FFEEF8
+ 788 2e6a B3FFEEF8 		.ascii	"\263\377\356\370\264\377\356\370\264\377\357\370\264\377\357"
+ 788      B4FFEEF8 
+ 788      B4FFEFF8 
+ 788      B4FFEF
+ 789 2e79 F8B4FFEF 		.ascii	"\370\264\377\357\370\265\377\357\370\265\377\357\370\265\377"
+ 789      F8B5FFEF 
+ 789      F8B5FFEF 
+ 789      F8B5FF
+ 790 2e88 EFF8B6FF 		.ascii	"\357\370\266\377\360\370\266\377\360\370\266\377\360\370\267"
+ 790      F0F8B6FF 
+ 790      F0F8B6FF 
+ 790      F0F8B7
+ 791 2e97 FFF0F9B7 		.ascii	"\377\360\371\267\377\360\371\267\377\360\371\270\377\360\371"
+ 791      FFF0F9B7 
+ 791      FFF0F9B8 
+ 791      FFF0F9
+ 792 2ea6 B8FFF1F9 		.ascii	"\270\377\361\371\270\377\361\371\270\377\361\371\271\377\361"
+ 792      B8FFF1F9 
+ 792      B8FFF1F9 
+ 792      B9FFF1
+ 793 2eb5 F9B9FFF1 		.ascii	"\371\271\377\361\371\271\377\361\371\272\377\362\371\272\377"
+ 793      F9B9FFF1 
+ 793      F9BAFFF2 
+ 793      F9BAFF
+ 794 2ec4 F2F9BAFF 		.ascii	"\362\371\272\377\362\371\273\377\362\371\273\377\362\371\273"
+ 794      F2F9BBFF 
+ 794      F2F9BBFF 
+ 794      F2F9BB
+ 795 2ed3 FFF2F9BC 		.ascii	"\377\362\371\274\377\363\371\274\377\363\371\274\377\363\371"
+ 795      FFF3F9BC 
+ 795      FFF3F9BC 
+GAS LISTING /tmp/ccjrIsGY.s 			page 57
+
+
+ 795      FFF3F9
+ 796 2ee2 BCFFF3FA 		.ascii	"\274\377\363\372\275\377\363\372\275\377\363\372\275\377\363"
+ 796      BDFFF3FA 
+ 796      BDFFF3FA 
+ 796      BDFFF3
+ 797 2ef1 FABEFFF4 		.ascii	"\372\276\377\364\372\276\377\364\372\276\377\364\372\277\377"
+ 797      FABEFFF4 
+ 797      FABEFFF4 
+ 797      FABFFF
+ 798 2f00 F4FABFFF 		.ascii	"\364\372\277\377\364\372\277\377\364\372\300\377\364\372\300"
+ 798      F4FABFFF 
+ 798      F4FAC0FF 
+ 798      F4FAC0
+ 799 2f0f FFF5FAC0 		.ascii	"\377\365\372\300\377\365\372\300\377\365\372\301\377\365\372"
+ 799      FFF5FAC0 
+ 799      FFF5FAC1 
+ 799      FFF5FA
+ 800 2f1e C1FFF5FA 		.ascii	"\301\377\365\372\301\377\365\372\302\377\366\372\302\377\366"
+ 800      C1FFF5FA 
+ 800      C2FFF6FA 
+ 800      C2FFF6
+ 801 2f2d FAC2FFF6 		.ascii	"\372\302\377\366\373\303\377\366\373\303\377\366\373\303\377"
+ 801      FBC3FFF6 
+ 801      FBC3FFF6 
+ 801      FBC3FF
+ 802 2f3c F6FBC4FF 		.ascii	"\366\373\304\377\366\373\304\377\366\373\304\377\367\373\305"
+ 802      F6FBC4FF 
+ 802      F6FBC4FF 
+ 802      F7FBC5
+ 803 2f4b FFF7FBC5 		.ascii	"\377\367\373\305\377\367\373\305\377\367\373\305\377\367\373"
+ 803      FFF7FBC5 
+ 803      FFF7FBC5 
+ 803      FFF7FB
+ 804 2f5a C6FFF7FB 		.ascii	"\306\377\367\373\306\377\367\373\306\377\370\373\307\377\370"
+ 804      C6FFF7FB 
+ 804      C6FFF8FB 
+ 804      C7FFF8
+ 805 2f69 FBC7FFF8 		.ascii	"\373\307\377\370\373\307\377\370\373\310\377\370\373\310\377"
+ 805      FBC7FFF8 
+ 805      FBC8FFF8 
+ 805      FBC8FF
+ 806 2f78 F8FCC8FF 		.ascii	"\370\374\310\377\370\374\311\377\371\374\311\377\371\374\311"
+ 806      F8FCC9FF 
+ 806      F9FCC9FF 
+ 806      F9FCC9
+ 807 2f87 FFF9FCCA 		.ascii	"\377\371\374\312\377\371\374\312\377\371\374\312\377\371\374"
+ 807      FFF9FCCA 
+ 807      FFF9FCCA 
+ 807      FFF9FC
+ 808 2f96 CAFFF9FC 		.ascii	"\312\377\371\374\313\377\371\374\313\377\372\374\313\377\372"
+ 808      CBFFF9FC 
+ 808      CBFFFAFC 
+ 808      CBFFFA
+ 809 2fa5 FCCCFFFA 		.ascii	"\374\314\377\372\374\314\377\372\374\314\377\372\374\315\377"
+ 809      FCCCFFFA 
+ 809      FCCCFFFA 
+ 809      FCCDFF
+GAS LISTING /tmp/ccjrIsGY.s 			page 58
+
+
+ 810 2fb4 FAFCCDFF 		.ascii	"\372\374\315\377\372\374\315\377\373\374\316\377\373\375\316"
+ 810      FAFCCDFF 
+ 810      FBFCCEFF 
+ 810      FBFDCE
+ 811 2fc3 FFFBFDCE 		.ascii	"\377\373\375\316\377\373\375\317\377\373\375\317\377\373\375"
+ 811      FFFBFDCF 
+ 811      FFFBFDCF 
+ 811      FFFBFD
+ 812 2fd2 CFFFFBFD 		.ascii	"\317\377\373\375\320\377\373\375\320\377\373\375\320\377"
+ 812      D0FFFBFD 
+ 812      D0FFFBFD 
+ 812      D0FF
+ 813 2fe0 FCFDD0FF 		.ascii	"\374\375\320\377\374\375\321\377\374\375\321\377\374\375\321"
+ 813      FCFDD1FF 
+ 813      FCFDD1FF 
+ 813      FCFDD1
+ 814 2fef FFFCFDD2 		.ascii	"\377\374\375\322\377\374\375\322\377\374\375\322\377\374\375"
+ 814      FFFCFDD2 
+ 814      FFFCFDD2 
+ 814      FFFCFD
+ 815 2ffe D3FFFDFD 		.ascii	"\323\377\375\375\323\377\375\376\323\377\375\376\324\377\375"
+ 815      D3FFFDFE 
+ 815      D3FFFDFE 
+ 815      D4FFFD
+ 816 300d FED4FFFD 		.ascii	"\376\324\377\375\376\324\377\375\376\325\377\375\376\325\377"
+ 816      FED4FFFD 
+ 816      FED5FFFD 
+ 816      FED5FF
+ 817 301c FDFED5FF 		.ascii	"\375\376\325\377\375\376\326\377\376\376\326\377\376\376\326"
+ 817      FDFED6FF 
+ 817      FEFED6FF 
+ 817      FEFED6
+ 818 302b FFFEFED7 		.ascii	"\377\376\376\327\377\376\376\327\377\376\376\327\377\376\376"
+ 818      FFFEFED7 
+ 818      FFFEFED7 
+ 818      FFFEFE
+ 819 303a D8FFFEFE 		.ascii	"\330\377\376\376\330\377\376\376\330\377"
+ 819      D8FFFEFE 
+ 819      D8FF
+ 820              		.globl	heatmap_cs_YlGnBu_discrete
+ 821              		.section	.data.rel.local
+ 822              		.align 8
+ 823              		.type	heatmap_cs_YlGnBu_discrete, @object
+ 824              		.size	heatmap_cs_YlGnBu_discrete, 8
+ 825              	heatmap_cs_YlGnBu_discrete:
+ 826 0018 00000000 		.quad	discrete
+ 826      00000000 
+ 827              		.section	.data.rel.ro.local
+ 828              		.align 16
+ 829              		.type	discrete, @object
+ 830              		.size	discrete, 16
+ 831              	discrete:
+ 832 0030 00000000 		.quad	discrete_data
+ 832      00000000 
+ 833 0038 0A000000 		.quad	10
+ 833      00000000 
+ 834              		.section	.rodata
+GAS LISTING /tmp/ccjrIsGY.s 			page 59
+
+
+ 835 3044 00000000 		.align 32
+ 835      00000000 
+ 835      00000000 
+ 835      00000000 
+ 835      00000000 
+ 836              		.type	discrete_data, @object
+ 837              		.size	discrete_data, 40
+ 838              	discrete_data:
+ 839 3060 00       		.string	""
+ 840 3061 00       		.string	""
+ 841 3062 00       		.string	""
+ 842 3063 00       		.string	""
+ 843 3064 081D58FF 		.ascii	"\b\035X\377%4\224\377\"^\250\377\035\221\300\377A\266\304\377"
+ 843      253494FF 
+ 843      225EA8FF 
+ 843      1D91C0FF 
+ 843      41B6C4FF 
+ 844 3078 7FCDBBFF 		.ascii	"\177\315\273\377\307\351\264\377\355\370\261\377\377\377\331"
+ 844      C7E9B4FF 
+ 844      EDF8B1FF 
+ 844      FFFFD9
+ 845 3087 FF       		.ascii	"\377"
+ 846              		.text
+ 847              	.Letext0:
+ 848              		.file 1 "./heatmap.h"
+ 849              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 850              		.file 3 "./colorschemes/YlGnBu.h"
+ 851              		.file 4 "colorschemes/YlGnBu.c"
+ 852              		.section	.debug_info,"",@progbits
+ 853              	.Ldebug_info0:
+ 854 0000 E3010000 		.long	0x1e3
+ 855 0004 0500     		.value	0x5
+ 856 0006 01       		.byte	0x1
+ 857 0007 08       		.byte	0x8
+ 858 0008 00000000 		.long	.Ldebug_abbrev0
+ 859 000c 0A       		.uleb128 0xa
+ 860 000d 00000000 		.long	.LASF26
+ 861 0011 1D       		.byte	0x1d
+ 862 0012 00000000 		.long	.LASF0
+ 863 0016 00000000 		.long	.LASF1
+ 864 001a 00000000 		.long	.Ldebug_line0
+ 865 001e 01       		.uleb128 0x1
+ 866 001f 08       		.byte	0x8
+ 867 0020 05       		.byte	0x5
+ 868 0021 00000000 		.long	.LASF2
+ 869 0025 06       		.uleb128 0x6
+ 870 0026 00000000 		.long	.LASF12
+ 871 002a 02       		.byte	0x2
+ 872 002b D6       		.byte	0xd6
+ 873 002c 17       		.byte	0x17
+ 874 002d 31000000 		.long	0x31
+ 875 0031 01       		.uleb128 0x1
+ 876 0032 08       		.byte	0x8
+ 877 0033 07       		.byte	0x7
+ 878 0034 00000000 		.long	.LASF3
+ 879 0038 0B       		.uleb128 0xb
+ 880 0039 04       		.byte	0x4
+GAS LISTING /tmp/ccjrIsGY.s 			page 60
+
+
+ 881 003a 05       		.byte	0x5
+ 882 003b 696E7400 		.string	"int"
+ 883 003f 01       		.uleb128 0x1
+ 884 0040 08       		.byte	0x8
+ 885 0041 05       		.byte	0x5
+ 886 0042 00000000 		.long	.LASF4
+ 887 0046 01       		.uleb128 0x1
+ 888 0047 10       		.byte	0x10
+ 889 0048 04       		.byte	0x4
+ 890 0049 00000000 		.long	.LASF5
+ 891 004d 01       		.uleb128 0x1
+ 892 004e 04       		.byte	0x4
+ 893 004f 04       		.byte	0x4
+ 894 0050 00000000 		.long	.LASF6
+ 895 0054 01       		.uleb128 0x1
+ 896 0055 04       		.byte	0x4
+ 897 0056 07       		.byte	0x7
+ 898 0057 00000000 		.long	.LASF7
+ 899 005b 01       		.uleb128 0x1
+ 900 005c 02       		.byte	0x2
+ 901 005d 07       		.byte	0x7
+ 902 005e 00000000 		.long	.LASF8
+ 903 0062 0C       		.uleb128 0xc
+ 904 0063 10       		.byte	0x10
+ 905 0064 01       		.byte	0x1
+ 906 0065 BB       		.byte	0xbb
+ 907 0066 09       		.byte	0x9
+ 908 0067 84000000 		.long	0x84
+ 909 006b 07       		.uleb128 0x7
+ 910 006c 00000000 		.long	.LASF9
+ 911 0070 BC       		.byte	0xbc
+ 912 0071 1A       		.byte	0x1a
+ 913 0072 84000000 		.long	0x84
+ 914 0076 00       		.byte	0
+ 915 0077 07       		.uleb128 0x7
+ 916 0078 00000000 		.long	.LASF10
+ 917 007c BD       		.byte	0xbd
+ 918 007d 0C       		.byte	0xc
+ 919 007e 25000000 		.long	0x25
+ 920 0082 08       		.byte	0x8
+ 921 0083 00       		.byte	0
+ 922 0084 08       		.uleb128 0x8
+ 923 0085 90000000 		.long	0x90
+ 924 0089 01       		.uleb128 0x1
+ 925 008a 01       		.byte	0x1
+ 926 008b 08       		.byte	0x8
+ 927 008c 00000000 		.long	.LASF11
+ 928 0090 03       		.uleb128 0x3
+ 929 0091 89000000 		.long	0x89
+ 930 0095 06       		.uleb128 0x6
+ 931 0096 00000000 		.long	.LASF13
+ 932 009a 01       		.byte	0x1
+ 933 009b BE       		.byte	0xbe
+ 934 009c 03       		.byte	0x3
+ 935 009d 62000000 		.long	0x62
+ 936 00a1 03       		.uleb128 0x3
+ 937 00a2 95000000 		.long	0x95
+GAS LISTING /tmp/ccjrIsGY.s 			page 61
+
+
+ 938 00a6 08       		.uleb128 0x8
+ 939 00a7 A1000000 		.long	0xa1
+ 940 00ab 04       		.uleb128 0x4
+ 941 00ac 00000000 		.long	.LASF14
+ 942 00b0 21       		.byte	0x21
+ 943 00b1 A6000000 		.long	0xa6
+ 944 00b5 04       		.uleb128 0x4
+ 945 00b6 00000000 		.long	.LASF15
+ 946 00ba 23       		.byte	0x23
+ 947 00bb A6000000 		.long	0xa6
+ 948 00bf 04       		.uleb128 0x4
+ 949 00c0 00000000 		.long	.LASF16
+ 950 00c4 25       		.byte	0x25
+ 951 00c5 A6000000 		.long	0xa6
+ 952 00c9 04       		.uleb128 0x4
+ 953 00ca 00000000 		.long	.LASF17
+ 954 00ce 28       		.byte	0x28
+ 955 00cf A6000000 		.long	0xa6
+ 956 00d3 09       		.uleb128 0x9
+ 957 00d4 90000000 		.long	0x90
+ 958 00d8 E3000000 		.long	0xe3
+ 959 00dc 0D       		.uleb128 0xd
+ 960 00dd 31000000 		.long	0x31
+ 961 00e1 27       		.byte	0x27
+ 962 00e2 00       		.byte	0
+ 963 00e3 03       		.uleb128 0x3
+ 964 00e4 D3000000 		.long	0xd3
+ 965 00e8 02       		.uleb128 0x2
+ 966 00e9 00000000 		.long	.LASF18
+ 967 00ed 20       		.byte	0x20
+ 968 00ee 1C       		.byte	0x1c
+ 969 00ef E3000000 		.long	0xe3
+ 970 00f3 09       		.uleb128 0x9
+ 971 00f4 03       		.byte	0x3
+ 972 00f5 00000000 		.quad	discrete_data
+ 972      00000000 
+ 973 00fd 02       		.uleb128 0x2
+ 974 00fe 00000000 		.long	.LASF19
+ 975 0102 23       		.byte	0x23
+ 976 0103 24       		.byte	0x24
+ 977 0104 A1000000 		.long	0xa1
+ 978 0108 09       		.uleb128 0x9
+ 979 0109 03       		.byte	0x3
+ 980 010a 00000000 		.quad	discrete
+ 980      00000000 
+ 981 0112 05       		.uleb128 0x5
+ 982 0113 AB000000 		.long	0xab
+ 983 0117 24       		.byte	0x24
+ 984 0118 09       		.uleb128 0x9
+ 985 0119 03       		.byte	0x3
+ 986 011a 00000000 		.quad	heatmap_cs_YlGnBu_discrete
+ 986      00000000 
+ 987 0122 09       		.uleb128 0x9
+ 988 0123 90000000 		.long	0x90
+ 989 0127 33010000 		.long	0x133
+ 990 012b 0E       		.uleb128 0xe
+ 991 012c 31000000 		.long	0x31
+GAS LISTING /tmp/ccjrIsGY.s 			page 62
+
+
+ 992 0130 0310     		.value	0x1003
+ 993 0132 00       		.byte	0
+ 994 0133 03       		.uleb128 0x3
+ 995 0134 22010000 		.long	0x122
+ 996 0138 02       		.uleb128 0x2
+ 997 0139 00000000 		.long	.LASF20
+ 998 013d 26       		.byte	0x26
+ 999 013e 1C       		.byte	0x1c
+ 1000 013f 33010000 		.long	0x133
+ 1001 0143 09       		.uleb128 0x9
+ 1002 0144 03       		.byte	0x3
+ 1003 0145 00000000 		.quad	soft_data
+ 1003      00000000 
+ 1004 014d 02       		.uleb128 0x2
+ 1005 014e 00000000 		.long	.LASF21
+ 1006 0152 29       		.byte	0x29
+ 1007 0153 24       		.byte	0x24
+ 1008 0154 A1000000 		.long	0xa1
+ 1009 0158 09       		.uleb128 0x9
+ 1010 0159 03       		.byte	0x3
+ 1011 015a 00000000 		.quad	soft
+ 1011      00000000 
+ 1012 0162 05       		.uleb128 0x5
+ 1013 0163 B5000000 		.long	0xb5
+ 1014 0167 2A       		.byte	0x2a
+ 1015 0168 09       		.uleb128 0x9
+ 1016 0169 03       		.byte	0x3
+ 1017 016a 00000000 		.quad	heatmap_cs_YlGnBu_soft
+ 1017      00000000 
+ 1018 0172 02       		.uleb128 0x2
+ 1019 0173 00000000 		.long	.LASF22
+ 1020 0177 2C       		.byte	0x2c
+ 1021 0178 1C       		.byte	0x1c
+ 1022 0179 33010000 		.long	0x133
+ 1023 017d 09       		.uleb128 0x9
+ 1024 017e 03       		.byte	0x3
+ 1025 017f 00000000 		.quad	mixed_data
+ 1025      00000000 
+ 1026 0187 02       		.uleb128 0x2
+ 1027 0188 00000000 		.long	.LASF23
+ 1028 018c 2F       		.byte	0x2f
+ 1029 018d 24       		.byte	0x24
+ 1030 018e A1000000 		.long	0xa1
+ 1031 0192 09       		.uleb128 0x9
+ 1032 0193 03       		.byte	0x3
+ 1033 0194 00000000 		.quad	mixed
+ 1033      00000000 
+ 1034 019c 05       		.uleb128 0x5
+ 1035 019d BF000000 		.long	0xbf
+ 1036 01a1 30       		.byte	0x30
+ 1037 01a2 09       		.uleb128 0x9
+ 1038 01a3 03       		.byte	0x3
+ 1039 01a4 00000000 		.quad	heatmap_cs_YlGnBu_mixed
+ 1039      00000000 
+ 1040 01ac 02       		.uleb128 0x2
+ 1041 01ad 00000000 		.long	.LASF24
+ 1042 01b1 32       		.byte	0x32
+GAS LISTING /tmp/ccjrIsGY.s 			page 63
+
+
+ 1043 01b2 1C       		.byte	0x1c
+ 1044 01b3 33010000 		.long	0x133
+ 1045 01b7 09       		.uleb128 0x9
+ 1046 01b8 03       		.byte	0x3
+ 1047 01b9 00000000 		.quad	mixed_exp_data
+ 1047      00000000 
+ 1048 01c1 02       		.uleb128 0x2
+ 1049 01c2 00000000 		.long	.LASF25
+ 1050 01c6 35       		.byte	0x35
+ 1051 01c7 24       		.byte	0x24
+ 1052 01c8 A1000000 		.long	0xa1
+ 1053 01cc 09       		.uleb128 0x9
+ 1054 01cd 03       		.byte	0x3
+ 1055 01ce 00000000 		.quad	mixed_exp
+ 1055      00000000 
+ 1056 01d6 05       		.uleb128 0x5
+ 1057 01d7 C9000000 		.long	0xc9
+ 1058 01db 36       		.byte	0x36
+ 1059 01dc 09       		.uleb128 0x9
+ 1060 01dd 03       		.byte	0x3
+ 1061 01de 00000000 		.quad	heatmap_cs_YlGnBu_mixed_exp
+ 1061      00000000 
+ 1062 01e6 00       		.byte	0
+ 1063              		.section	.debug_abbrev,"",@progbits
+ 1064              	.Ldebug_abbrev0:
+ 1065 0000 01       		.uleb128 0x1
+ 1066 0001 24       		.uleb128 0x24
+ 1067 0002 00       		.byte	0
+ 1068 0003 0B       		.uleb128 0xb
+ 1069 0004 0B       		.uleb128 0xb
+ 1070 0005 3E       		.uleb128 0x3e
+ 1071 0006 0B       		.uleb128 0xb
+ 1072 0007 03       		.uleb128 0x3
+ 1073 0008 0E       		.uleb128 0xe
+ 1074 0009 00       		.byte	0
+ 1075 000a 00       		.byte	0
+ 1076 000b 02       		.uleb128 0x2
+ 1077 000c 34       		.uleb128 0x34
+ 1078 000d 00       		.byte	0
+ 1079 000e 03       		.uleb128 0x3
+ 1080 000f 0E       		.uleb128 0xe
+ 1081 0010 3A       		.uleb128 0x3a
+ 1082 0011 21       		.uleb128 0x21
+ 1083 0012 04       		.sleb128 4
+ 1084 0013 3B       		.uleb128 0x3b
+ 1085 0014 0B       		.uleb128 0xb
+ 1086 0015 39       		.uleb128 0x39
+ 1087 0016 0B       		.uleb128 0xb
+ 1088 0017 49       		.uleb128 0x49
+ 1089 0018 13       		.uleb128 0x13
+ 1090 0019 02       		.uleb128 0x2
+ 1091 001a 18       		.uleb128 0x18
+ 1092 001b 00       		.byte	0
+ 1093 001c 00       		.byte	0
+ 1094 001d 03       		.uleb128 0x3
+ 1095 001e 26       		.uleb128 0x26
+ 1096 001f 00       		.byte	0
+GAS LISTING /tmp/ccjrIsGY.s 			page 64
+
+
+ 1097 0020 49       		.uleb128 0x49
+ 1098 0021 13       		.uleb128 0x13
+ 1099 0022 00       		.byte	0
+ 1100 0023 00       		.byte	0
+ 1101 0024 04       		.uleb128 0x4
+ 1102 0025 34       		.uleb128 0x34
+ 1103 0026 00       		.byte	0
+ 1104 0027 03       		.uleb128 0x3
+ 1105 0028 0E       		.uleb128 0xe
+ 1106 0029 3A       		.uleb128 0x3a
+ 1107 002a 21       		.uleb128 0x21
+ 1108 002b 03       		.sleb128 3
+ 1109 002c 3B       		.uleb128 0x3b
+ 1110 002d 0B       		.uleb128 0xb
+ 1111 002e 39       		.uleb128 0x39
+ 1112 002f 21       		.uleb128 0x21
+ 1113 0030 25       		.sleb128 37
+ 1114 0031 49       		.uleb128 0x49
+ 1115 0032 13       		.uleb128 0x13
+ 1116 0033 3F       		.uleb128 0x3f
+ 1117 0034 19       		.uleb128 0x19
+ 1118 0035 3C       		.uleb128 0x3c
+ 1119 0036 19       		.uleb128 0x19
+ 1120 0037 00       		.byte	0
+ 1121 0038 00       		.byte	0
+ 1122 0039 05       		.uleb128 0x5
+ 1123 003a 34       		.uleb128 0x34
+ 1124 003b 00       		.byte	0
+ 1125 003c 47       		.uleb128 0x47
+ 1126 003d 13       		.uleb128 0x13
+ 1127 003e 3A       		.uleb128 0x3a
+ 1128 003f 21       		.uleb128 0x21
+ 1129 0040 04       		.sleb128 4
+ 1130 0041 3B       		.uleb128 0x3b
+ 1131 0042 0B       		.uleb128 0xb
+ 1132 0043 39       		.uleb128 0x39
+ 1133 0044 21       		.uleb128 0x21
+ 1134 0045 1E       		.sleb128 30
+ 1135 0046 02       		.uleb128 0x2
+ 1136 0047 18       		.uleb128 0x18
+ 1137 0048 00       		.byte	0
+ 1138 0049 00       		.byte	0
+ 1139 004a 06       		.uleb128 0x6
+ 1140 004b 16       		.uleb128 0x16
+ 1141 004c 00       		.byte	0
+ 1142 004d 03       		.uleb128 0x3
+ 1143 004e 0E       		.uleb128 0xe
+ 1144 004f 3A       		.uleb128 0x3a
+ 1145 0050 0B       		.uleb128 0xb
+ 1146 0051 3B       		.uleb128 0x3b
+ 1147 0052 0B       		.uleb128 0xb
+ 1148 0053 39       		.uleb128 0x39
+ 1149 0054 0B       		.uleb128 0xb
+ 1150 0055 49       		.uleb128 0x49
+ 1151 0056 13       		.uleb128 0x13
+ 1152 0057 00       		.byte	0
+ 1153 0058 00       		.byte	0
+GAS LISTING /tmp/ccjrIsGY.s 			page 65
+
+
+ 1154 0059 07       		.uleb128 0x7
+ 1155 005a 0D       		.uleb128 0xd
+ 1156 005b 00       		.byte	0
+ 1157 005c 03       		.uleb128 0x3
+ 1158 005d 0E       		.uleb128 0xe
+ 1159 005e 3A       		.uleb128 0x3a
+ 1160 005f 21       		.uleb128 0x21
+ 1161 0060 01       		.sleb128 1
+ 1162 0061 3B       		.uleb128 0x3b
+ 1163 0062 0B       		.uleb128 0xb
+ 1164 0063 39       		.uleb128 0x39
+ 1165 0064 0B       		.uleb128 0xb
+ 1166 0065 49       		.uleb128 0x49
+ 1167 0066 13       		.uleb128 0x13
+ 1168 0067 38       		.uleb128 0x38
+ 1169 0068 0B       		.uleb128 0xb
+ 1170 0069 00       		.byte	0
+ 1171 006a 00       		.byte	0
+ 1172 006b 08       		.uleb128 0x8
+ 1173 006c 0F       		.uleb128 0xf
+ 1174 006d 00       		.byte	0
+ 1175 006e 0B       		.uleb128 0xb
+ 1176 006f 21       		.uleb128 0x21
+ 1177 0070 08       		.sleb128 8
+ 1178 0071 49       		.uleb128 0x49
+ 1179 0072 13       		.uleb128 0x13
+ 1180 0073 00       		.byte	0
+ 1181 0074 00       		.byte	0
+ 1182 0075 09       		.uleb128 0x9
+ 1183 0076 01       		.uleb128 0x1
+ 1184 0077 01       		.byte	0x1
+ 1185 0078 49       		.uleb128 0x49
+ 1186 0079 13       		.uleb128 0x13
+ 1187 007a 01       		.uleb128 0x1
+ 1188 007b 13       		.uleb128 0x13
+ 1189 007c 00       		.byte	0
+ 1190 007d 00       		.byte	0
+ 1191 007e 0A       		.uleb128 0xa
+ 1192 007f 11       		.uleb128 0x11
+ 1193 0080 01       		.byte	0x1
+ 1194 0081 25       		.uleb128 0x25
+ 1195 0082 0E       		.uleb128 0xe
+ 1196 0083 13       		.uleb128 0x13
+ 1197 0084 0B       		.uleb128 0xb
+ 1198 0085 03       		.uleb128 0x3
+ 1199 0086 1F       		.uleb128 0x1f
+ 1200 0087 1B       		.uleb128 0x1b
+ 1201 0088 1F       		.uleb128 0x1f
+ 1202 0089 10       		.uleb128 0x10
+ 1203 008a 17       		.uleb128 0x17
+ 1204 008b 00       		.byte	0
+ 1205 008c 00       		.byte	0
+ 1206 008d 0B       		.uleb128 0xb
+ 1207 008e 24       		.uleb128 0x24
+ 1208 008f 00       		.byte	0
+ 1209 0090 0B       		.uleb128 0xb
+ 1210 0091 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccjrIsGY.s 			page 66
+
+
+ 1211 0092 3E       		.uleb128 0x3e
+ 1212 0093 0B       		.uleb128 0xb
+ 1213 0094 03       		.uleb128 0x3
+ 1214 0095 08       		.uleb128 0x8
+ 1215 0096 00       		.byte	0
+ 1216 0097 00       		.byte	0
+ 1217 0098 0C       		.uleb128 0xc
+ 1218 0099 13       		.uleb128 0x13
+ 1219 009a 01       		.byte	0x1
+ 1220 009b 0B       		.uleb128 0xb
+ 1221 009c 0B       		.uleb128 0xb
+ 1222 009d 3A       		.uleb128 0x3a
+ 1223 009e 0B       		.uleb128 0xb
+ 1224 009f 3B       		.uleb128 0x3b
+ 1225 00a0 0B       		.uleb128 0xb
+ 1226 00a1 39       		.uleb128 0x39
+ 1227 00a2 0B       		.uleb128 0xb
+ 1228 00a3 01       		.uleb128 0x1
+ 1229 00a4 13       		.uleb128 0x13
+ 1230 00a5 00       		.byte	0
+ 1231 00a6 00       		.byte	0
+ 1232 00a7 0D       		.uleb128 0xd
+ 1233 00a8 21       		.uleb128 0x21
+ 1234 00a9 00       		.byte	0
+ 1235 00aa 49       		.uleb128 0x49
+ 1236 00ab 13       		.uleb128 0x13
+ 1237 00ac 2F       		.uleb128 0x2f
+ 1238 00ad 0B       		.uleb128 0xb
+ 1239 00ae 00       		.byte	0
+ 1240 00af 00       		.byte	0
+ 1241 00b0 0E       		.uleb128 0xe
+ 1242 00b1 21       		.uleb128 0x21
+ 1243 00b2 00       		.byte	0
+ 1244 00b3 49       		.uleb128 0x49
+ 1245 00b4 13       		.uleb128 0x13
+ 1246 00b5 2F       		.uleb128 0x2f
+ 1247 00b6 05       		.uleb128 0x5
+ 1248 00b7 00       		.byte	0
+ 1249 00b8 00       		.byte	0
+ 1250 00b9 00       		.byte	0
+ 1251              		.section	.debug_aranges,"",@progbits
+ 1252 0000 1C000000 		.long	0x1c
+ 1253 0004 0200     		.value	0x2
+ 1254 0006 00000000 		.long	.Ldebug_info0
+ 1255 000a 08       		.byte	0x8
+ 1256 000b 00       		.byte	0
+ 1257 000c 0000     		.value	0
+ 1258 000e 0000     		.value	0
+ 1259 0010 00000000 		.quad	0
+ 1259      00000000 
+ 1260 0018 00000000 		.quad	0
+ 1260      00000000 
+ 1261              		.section	.debug_line,"",@progbits
+ 1262              	.Ldebug_line0:
+ 1263 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1263      05000800 
+ 1263      49000000 
+GAS LISTING /tmp/ccjrIsGY.s 			page 67
+
+
+ 1263      010101FB 
+ 1263      0E0D0001 
+ 1264              	.LASF19:
+ 1265 0000 64697363 		.string	"discrete"
+ 1265      72657465 
+ 1265      00
+ 1266              	.LASF20:
+ 1267 0009 736F6674 		.string	"soft_data"
+ 1267      5F646174 
+ 1267      6100
+ 1268              	.LASF12:
+ 1269 0013 73697A65 		.string	"size_t"
+ 1269      5F7400
+ 1270              	.LASF13:
+ 1271 001a 68656174 		.string	"heatmap_colorscheme_t"
+ 1271      6D61705F 
+ 1271      636F6C6F 
+ 1271      72736368 
+ 1271      656D655F 
+ 1272              	.LASF14:
+ 1273 0030 68656174 		.string	"heatmap_cs_YlGnBu_discrete"
+ 1273      6D61705F 
+ 1273      63735F59 
+ 1273      6C476E42 
+ 1273      755F6469 
+ 1274              	.LASF26:
+ 1275 004b 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1275      43313720 
+ 1275      31322E32 
+ 1275      2E30202D 
+ 1275      6D74756E 
+ 1276              	.LASF6:
+ 1277 00aa 666C6F61 		.string	"float"
+ 1277      7400
+ 1278              	.LASF11:
+ 1279 00b0 756E7369 		.string	"unsigned char"
+ 1279      676E6564 
+ 1279      20636861 
+ 1279      7200
+ 1280              	.LASF3:
+ 1281 00be 6C6F6E67 		.string	"long unsigned int"
+ 1281      20756E73 
+ 1281      69676E65 
+ 1281      6420696E 
+ 1281      7400
+ 1282              	.LASF17:
+ 1283 00d0 68656174 		.string	"heatmap_cs_YlGnBu_mixed_exp"
+ 1283      6D61705F 
+ 1283      63735F59 
+ 1283      6C476E42 
+ 1283      755F6D69 
+ 1284              	.LASF8:
+ 1285 00ec 73686F72 		.string	"short unsigned int"
+ 1285      7420756E 
+ 1285      7369676E 
+ 1285      65642069 
+ 1285      6E7400
+GAS LISTING /tmp/ccjrIsGY.s 			page 68
+
+
+ 1286              	.LASF25:
+ 1287 00ff 6D697865 		.string	"mixed_exp"
+ 1287      645F6578 
+ 1287      7000
+ 1288              	.LASF23:
+ 1289 0109 6D697865 		.string	"mixed"
+ 1289      6400
+ 1290              	.LASF7:
+ 1291 010f 756E7369 		.string	"unsigned int"
+ 1291      676E6564 
+ 1291      20696E74 
+ 1291      00
+ 1292              	.LASF16:
+ 1293 011c 68656174 		.string	"heatmap_cs_YlGnBu_mixed"
+ 1293      6D61705F 
+ 1293      63735F59 
+ 1293      6C476E42 
+ 1293      755F6D69 
+ 1294              	.LASF10:
+ 1295 0134 6E636F6C 		.string	"ncolors"
+ 1295      6F727300 
+ 1296              	.LASF4:
+ 1297 013c 6C6F6E67 		.string	"long long int"
+ 1297      206C6F6E 
+ 1297      6720696E 
+ 1297      7400
+ 1298              	.LASF24:
+ 1299 014a 6D697865 		.string	"mixed_exp_data"
+ 1299      645F6578 
+ 1299      705F6461 
+ 1299      746100
+ 1300              	.LASF22:
+ 1301 0159 6D697865 		.string	"mixed_data"
+ 1301      645F6461 
+ 1301      746100
+ 1302              	.LASF15:
+ 1303 0164 68656174 		.string	"heatmap_cs_YlGnBu_soft"
+ 1303      6D61705F 
+ 1303      63735F59 
+ 1303      6C476E42 
+ 1303      755F736F 
+ 1304              	.LASF2:
+ 1305 017b 6C6F6E67 		.string	"long int"
+ 1305      20696E74 
+ 1305      00
+ 1306              	.LASF5:
+ 1307 0184 6C6F6E67 		.string	"long double"
+ 1307      20646F75 
+ 1307      626C6500 
+ 1308              	.LASF18:
+ 1309 0190 64697363 		.string	"discrete_data"
+ 1309      72657465 
+ 1309      5F646174 
+ 1309      6100
+ 1310              	.LASF21:
+ 1311 019e 736F6674 		.string	"soft"
+ 1311      00
+GAS LISTING /tmp/ccjrIsGY.s 			page 69
+
+
+ 1312              	.LASF9:
+ 1313 01a3 636F6C6F 		.string	"colors"
+ 1313      727300
+ 1314              		.section	.debug_line_str,"MS",@progbits,1
+ 1315              	.LASF1:
+ 1316 0000 2F726F6F 		.string	"/root/repo"
+ 1316      742F7265 
+ 1316      706F00
+ 1317              	.LASF0:
+ 1318 000b 636F6C6F 		.string	"colorschemes/YlGnBu.c"
+ 1318      72736368 
+ 1318      656D6573 
+ 1318      2F596C47 
+ 1318      6E42752E 
+ 1319              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1320 0021 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1320      742F7265 
+ 1320      706F0063 
+ 1320      6F6C6F72 
+ 1320      73636865 
@@ -0,0 +1,4147 @@
+GAS LISTING /tmp/ccoFiSH1.s 			page 1
+
+
+   1              		.file	"YlOrBr.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/YlOrBr.c"
+   5              		.globl	heatmap_cs_YlOrBr_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_YlOrBr_mixed_exp, @object
+   9              		.size	heatmap_cs_YlOrBr_mixed_exp, 8
+  10              	heatmap_cs_YlOrBr_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 65250500 		.string	"e%\005"
+  29 0008 69250618 		.ascii	"i%\006\030l&\0061o'\006Jr(\006cu)\006|x*\006\225\205.\005\256"
+  29      6C260631 
+  29      6F27064A 
+  29      72280663 
+  29      7529067C 
+  30 0024 882F05C7 		.ascii	"\210/\005\307\2130\005\340\2160\004\371\2211\004\377\2242\004"
+  30      8B3005E0 
+  30      8E3004F9 
+  30      913104FF 
+  30      943204
+  31 0037 FF973304 		.ascii	"\377\2273\004\377\2324\004\377\2345\003\377\2377\003\377\242"
+  31      FF9A3404 
+  31      FF9C3503 
+  31      FF9F3703 
+  31      FFA2
+  32 0049 3803FFA5 		.ascii	"8\003\377\2459\003\377\247:\003\377\252<\003\377\255=\003\377"
+  32      3903FFA7 
+  32      3A03FFAA 
+  32      3C03FFAD 
+  32      3D03FF
+  33 005c B94303FF 		.ascii	"\271C\003\377\274D\003\377\277E\002\377\301G\002\377\304H\002"
+  33      BC4403FF 
+  33      BF4502FF 
+  33      C14702FF 
+  33      C44802
+  34 006f FFC64902 		.ascii	"\377\306I\002\377\311J\002\377\313K\002\377\315M\002\377\317"
+GAS LISTING /tmp/ccoFiSH1.s 			page 2
+
+
+  34      FFC94A02 
+  34      FFCB4B02 
+  34      FFCD4D02 
+  34      FFCF
+  35 0081 4F03FFD0 		.ascii	"O\003\377\320Q\004\377\322R\004\377\323T\005\377\325V\006\377"
+  35      5104FFD2 
+  35      5204FFD3 
+  35      5405FFD5 
+  35      5606FF
+  36 0094 D65707FF 		.ascii	"\326W\007\377\327Y\b\377\337b\f\377\341c\r\377\342e\016\377\343"
+  36      D75908FF 
+  36      DF620CFF 
+  36      E1630DFF 
+  36      E2650EFF 
+  37 00a9 660FFFE5 		.ascii	"f\017\377\345h\020\377\346i\020\377\350k\021\377\351m\022\377"
+  37      6810FFE6 
+  37      6910FFE8 
+  37      6B11FFE9 
+  37      6D12FF
+  38 00bc EA6E13FF 		.ascii	"\352n\023\377\353o\023\377\354q\024\377\355s\025\377\356u\026"
+  38      EB6F13FF 
+  38      EC7114FF 
+  38      ED7315FF 
+  38      EE7516
+  39 00cf FFEF7616 		.ascii	"\377\357v\026\377\357x\027\377\360y\030\377\361{\031\377\361"
+  39      FFEF7817 
+  39      FFF07918 
+  39      FFF17B19 
+  39      FFF1
+  40 00e1 7D19FFF2 		.ascii	"}\031\377\362~\032\377\363\200\033\377\367\211 \377\370\213!"
+  40      7E1AFFF3 
+  40      801BFFF7 
+  40      8920FFF8 
+  40      8B21
+  41 00f3 FFF88C22 		.ascii	"\377\370\214\"\377\371\216\"\377\372\217#\377\372\221$\377\373"
+  41      FFF98E22 
+  41      FFFA8F23 
+  41      FFFA9124 
+  41      FFFB
+  42 0105 9225FFFB 		.ascii	"\222%\377\373\224&\377\374\225&\377\375\226'\377\375\230(\377"
+  42      9426FFFC 
+  42      9526FFFD 
+  42      9627FFFD 
+  42      9828FF
+  43 0118 FE9929FF 		.ascii	"\376\231)\377\376\233*\377\376\234+\377\376\236,\377\376\237"
+  43      FE9B2AFF 
+  43      FE9C2BFF 
+  43      FE9E2CFF 
+  43      FE9F
+  44 012a 2DFFFEA0 		.ascii	"-\377\376\240.\377\376\242/\377\376\2430\377\376\2452\377\376"
+  44      2EFFFEA2 
+  44      2FFFFEA3 
+  44      30FFFEA5 
+  44      32FFFE
+  45 013d A633FFFE 		.ascii	"\2463\377\376\2474\377\376\2515\377\376\2526\377\376\264?\377"
+  45      A734FFFE 
+  45      A935FFFE 
+GAS LISTING /tmp/ccoFiSH1.s 			page 3
+
+
+  45      AA36FFFE 
+  45      B43FFF
+  46 0150 FEB540FF 		.ascii	"\376\265@\377\376\266A\377\376\267B\377\376\271C\377\376\272"
+  46      FEB641FF 
+  46      FEB742FF 
+  46      FEB943FF 
+  46      FEBA
+  47 0162 45FFFEBB 		.ascii	"E\377\376\273F\377\376\274G\377\376\275H\377\376\276I\377\376"
+  47      46FFFEBC 
+  47      47FFFEBD 
+  47      48FFFEBE 
+  47      49FFFE
+  48 0175 C04AFFFE 		.ascii	"\300J\377\376\301K\377\375\302M\377\375\303N\377\375\304O\377"
+  48      C14BFFFD 
+  48      C24DFFFD 
+  48      C34EFFFD 
+  48      C44FFF
+  49 0188 FDC551FF 		.ascii	"\375\305Q\377\375\305S\377\375\306T\377\375\307V\377\375\310"
+  49      FDC553FF 
+  49      FDC654FF 
+  49      FDC756FF 
+  49      FDC8
+  50 019a 58FFFDC9 		.ascii	"X\377\375\311Y\377\375\311[\377\375\312\\\377\375\313^\377\375"
+  50      59FFFDC9 
+  50      5BFFFDCA 
+  50      5CFFFDCB 
+  50      5EFFFD
+  51 01ad CC5FFFFD 		.ascii	"\314_\377\375\314a\377\375\315c\377\375\316d\377\375\317e\377"
+  51      CC61FFFD 
+  51      CD63FFFD 
+  51      CE64FFFD 
+  51      CF65FF
+  52 01c0 FDCF67FF 		.ascii	"\375\317g\377\375\320h\377\375\327w\377\375\330x\377\375\330"
+  52      FDD068FF 
+  52      FDD777FF 
+  52      FDD878FF 
+  52      FDD8
+  53 01d2 7AFFFDD9 		.ascii	"z\377\375\331{\377\375\332}\377\375\332~\377\375\333\177\377"
+  53      7BFFFDDA 
+  53      7DFFFDDA 
+  53      7EFFFDDB 
+  53      7FFF
+  54 01e4 FDDB81FF 		.ascii	"\375\333\201\377\375\334\202\377\375\335\203\377\375\335\205"
+  54      FDDC82FF 
+  54      FDDD83FF 
+  54      FDDD85
+  55 01f3 FFFDDE86 		.ascii	"\377\375\336\206\377\375\336\207\377\375\337\211\377\375\340"
+  55      FFFDDE87 
+  55      FFFDDF89 
+  55      FFFDE0
+  56 0202 8AFFFDE0 		.ascii	"\212\377\375\340\213\377\375\341\214\377\375\341\215\377\375"
+  56      8BFFFDE1 
+  56      8CFFFDE1 
+  56      8DFFFD
+  57 0211 E28FFFFD 		.ascii	"\342\217\377\375\342\220\377\375\343\221\377\375\343\222\377"
+  57      E290FFFD 
+  57      E391FFFD 
+GAS LISTING /tmp/ccoFiSH1.s 			page 4
+
+
+  57      E392FF
+  58 0220 FDE392FF 		.ascii	"\375\343\222\377\375\344\223\377\375\344\224\377\375\345\225"
+  58      FDE493FF 
+  58      FDE494FF 
+  58      FDE595
+  59 022f FFFDE595 		.ascii	"\377\375\345\225\377\375\345\226\377\375\346\227\377\375\346"
+  59      FFFDE596 
+  59      FFFDE697 
+  59      FFFDE6
+  60 023e 97FFFDE6 		.ascii	"\227\377\375\346\230\377\375\347\231\377\375\347\231\377\375"
+  60      98FFFDE7 
+  60      99FFFDE7 
+  60      99FFFD
+  61 024d E79AFFFD 		.ascii	"\347\232\377\375\350\233\377\375\350\233\377\375\350\234\377"
+  61      E89BFFFD 
+  61      E89BFFFD 
+  61      E89CFF
+  62 025c FDE89DFF 		.ascii	"\375\350\235\377\375\351\235\377\375\351\236\377\375\351\237"
+  62      FDE99DFF 
+  62      FDE99EFF 
+  62      FDE99F
+  63 026b FFFDEA9F 		.ascii	"\377\375\352\237\377\375\352\240\377\375\352\240\377\375\353"
+  63      FFFDEAA0 
+  63      FFFDEAA0 
+  63      FFFDEB
+  64 027a A1FFFEEF 		.ascii	"\241\377\376\357\252\377\376\357\253\377\376\357\253\377\376"
+  64      AAFFFEEF 
+  64      ABFFFEEF 
+  64      ABFFFE
+  65 0289 F0ACFFFE 		.ascii	"\360\254\377\376\360\255\377\376\360\255\377\376\360\256\377"
+  65      F0ADFFFE 
+  65      F0ADFFFE 
+  65      F0AEFF
+  66 0298 FEF1AEFF 		.ascii	"\376\361\256\377\376\361\257\377\376\361\257\377\376\361\260"
+  66      FEF1AFFF 
+  66      FEF1AFFF 
+  66      FEF1B0
+  67 02a7 FFFEF2B0 		.ascii	"\377\376\362\260\377\376\362\261\377\376\362\262\377\376\362"
+  67      FFFEF2B1 
+  67      FFFEF2B2 
+  67      FFFEF2
+  68 02b6 B2FFFEF3 		.ascii	"\262\377\376\363\263\377\376\363\263\377\376\363\264\377\376"
+  68      B3FFFEF3 
+  68      B3FFFEF3 
+  68      B4FFFE
+  69 02c5 F3B4FFFE 		.ascii	"\363\264\377\376\363\265\377\376\364\265\377\376\364\266\377"
+  69      F3B5FFFE 
+  69      F4B5FFFE 
+  69      F4B6FF
+  70 02d4 FEF4B6FF 		.ascii	"\376\364\266\377\376\364\266\377\376\365\267\377\376\365\267"
+  70      FEF4B6FF 
+  70      FEF5B7FF 
+  70      FEF5B7
+  71 02e3 FFFEF5B8 		.ascii	"\377\376\365\270\377\376\365\270\377\376\365\271\377\376\366"
+  71      FFFEF5B8 
+  71      FFFEF5B9 
+  71      FFFEF6
+GAS LISTING /tmp/ccoFiSH1.s 			page 5
+
+
+  72 02f2 B9FFFEF6 		.ascii	"\271\377\376\366\272\377\376\366\272\377\376\366\273\377\376"
+  72      BAFFFEF6 
+  72      BAFFFEF6 
+  72      BBFFFE
+  73 0301 F6BBFFFE 		.ascii	"\366\273\377\376\366\273\377\376\367\274\377\376\367\274\377"
+  73      F6BBFFFE 
+  73      F7BCFFFE 
+  73      F7BCFF
+  74 0310 FEF7BDFF 		.ascii	"\376\367\275\377\376\367\275\377\376\367\275\377\376\367\276"
+  74      FEF7BDFF 
+  74      FEF7BDFF 
+  74      FEF7BE
+  75 031f FFFEF7BE 		.ascii	"\377\376\367\276\377\376\367\276\377\376\367\277\377\376\367"
+  75      FFFEF7BE 
+  75      FFFEF7BF 
+  75      FFFEF7
+  76 032e BFFFFEF7 		.ascii	"\277\377\376\367\300\377\376\367\300\377\376\370\300\377\376"
+  76      C0FFFEF7 
+  76      C0FFFEF8 
+  76      C0FFFE
+  77 033d F8C1FFFE 		.ascii	"\370\301\377\376\370\301\377\376\370\301\377\376\370\302\377"
+  77      F8C1FFFE 
+  77      F8C1FFFE 
+  77      F8C2FF
+  78 034c FEF8C2FF 		.ascii	"\376\370\302\377\376\370\302\377\376\370\303\377\376\370\303"
+  78      FEF8C2FF 
+  78      FEF8C3FF 
+  78      FEF8C3
+  79 035b FFFEF8C3 		.ascii	"\377\376\370\303\377\376\370\304\377\376\370\304\377\376\370"
+  79      FFFEF8C4 
+  79      FFFEF8C4 
+  79      FFFEF8
+  80 036a C4FFFEF8 		.ascii	"\304\377\376\370\304\377\376\370\305\377\376\371\305\377\376"
+  80      C4FFFEF8 
+  80      C5FFFEF9 
+  80      C5FFFE
+  81 0379 F9C5FFFE 		.ascii	"\371\305\377\376\371\306\377\376\371\306\377\376\371\306\377"
+  81      F9C6FFFE 
+  81      F9C6FFFE 
+  81      F9C6FF
+  82 0388 FEF9C6FF 		.ascii	"\376\371\306\377\376\371\307\377\376\371\307\377\376\371\307"
+  82      FEF9C7FF 
+  82      FEF9C7FF 
+  82      FEF9C7
+  83 0397 FFFEF9C8 		.ascii	"\377\376\371\310\377\376\371\310\377\376\371\310\377\376\371"
+  83      FFFEF9C8 
+  83      FFFEF9C8 
+  83      FFFEF9
+  84 03a6 C8FFFEF9 		.ascii	"\310\377\376\371\311\377\376\371\311\377\376\371\311\377\376"
+  84      C9FFFEF9 
+  84      C9FFFEF9 
+  84      C9FFFE
+  85 03b5 F9C9FFFE 		.ascii	"\371\311\377\376\371\312\377\376\371\312\377\376\372\312\377"
+  85      F9CAFFFE 
+  85      F9CAFFFE 
+  85      FACAFF
+  86 03c4 FEFACAFF 		.ascii	"\376\372\312\377\376\372\313\377\376\372\313\377\376\372\313"
+GAS LISTING /tmp/ccoFiSH1.s 			page 6
+
+
+  86      FEFACBFF 
+  86      FEFACBFF 
+  86      FEFACB
+  87 03d3 FFFEFACB 		.ascii	"\377\376\372\313\377\376\372\313\377\376\372\314\377\376\372"
+  87      FFFEFACB 
+  87      FFFEFACC 
+  87      FFFEFA
+  88 03e2 CCFFFEFC 		.ascii	"\314\377\376\374\324\377\376\374\324\377\376\374\325\377\376"
+  88      D4FFFEFC 
+  88      D4FFFEFC 
+  88      D5FFFE
+  89 03f1 FCD5FFFE 		.ascii	"\374\325\377\376\374\325\377\376\374\325\377\376\374\325\377"
+  89      FCD5FFFE 
+  89      FCD5FFFE 
+  89      FCD5FF
+  90 0400 FEFCD6FF 		.ascii	"\376\374\326\377\376\374\326\377\376\374\326\377\376\374\326"
+  90      FEFCD6FF 
+  90      FEFCD6FF 
+  90      FEFCD6
+  91 040f FFFEFCD6 		.ascii	"\377\376\374\326\377\376\374\327\377\376\374\327\377\376\374"
+  91      FFFEFCD7 
+  91      FFFEFCD7 
+  91      FFFEFC
+  92 041e D7FFFEFC 		.ascii	"\327\377\376\374\327\377\376\374\327\377\376\374\330\377\376"
+  92      D7FFFEFC 
+  92      D7FFFEFC 
+  92      D8FFFE
+  93 042d FCD8FFFE 		.ascii	"\374\330\377\376\374\330\377\376\374\330\377\376\374\330\377"
+  93      FCD8FFFE 
+  93      FCD8FFFE 
+  93      FCD8FF
+  94 043c FEFCD8FF 		.ascii	"\376\374\330\377\376\374\331\377\376\374\331\377\376\374\331"
+  94      FEFCD9FF 
+  94      FEFCD9FF 
+  94      FEFCD9
+  95 044b FFFEFCD9 		.ascii	"\377\376\374\331\377\376\374\331\377\376\374\331\377\376\375"
+  95      FFFEFCD9 
+  95      FFFEFCD9 
+  95      FFFEFD
+  96 045a D9FFFEFD 		.ascii	"\331\377\376\375\332\377\376\375\332\377\376\375\332\377\376"
+  96      DAFFFEFD 
+  96      DAFFFEFD 
+  96      DAFFFE
+  97 0469 FDDAFFFE 		.ascii	"\375\332\377\376\375\332\377\376\375\332\377\376\375\332\377"
+  97      FDDAFFFE 
+  97      FDDAFFFE 
+  97      FDDAFF
+  98 0478 FEFDDBFF 		.ascii	"\376\375\333\377\376\375\333\377\376\375\333\377\376\375\333"
+  98      FEFDDBFF 
+  98      FEFDDBFF 
+  98      FEFDDB
+  99 0487 FFFEFDDB 		.ascii	"\377\376\375\333\377\376\375\333\377\376\375\333\377\376\375"
+  99      FFFEFDDB 
+  99      FFFEFDDB 
+  99      FFFEFD
+ 100 0496 DBFFFEFD 		.ascii	"\333\377\376\375\334\377\376\375\334\377\376\375\334\377\376"
+ 100      DCFFFEFD 
+GAS LISTING /tmp/ccoFiSH1.s 			page 7
+
+
+ 100      DCFFFEFD 
+ 100      DCFFFE
+ 101 04a5 FDDCFFFE 		.ascii	"\375\334\377\376\375\334\377\376\375\334\377\376\375\334\377"
+ 101      FDDCFFFE 
+ 101      FDDCFFFE 
+ 101      FDDCFF
+ 102 04b4 FEFDDCFF 		.ascii	"\376\375\334\377\376\375\335\377\376\375\335\377\376\375\335"
+ 102      FEFDDDFF 
+ 102      FEFDDDFF 
+ 102      FEFDDD
+ 103 04c3 FFFEFDDD 		.ascii	"\377\376\375\335\377\376\375\335\377\376\375\335\377\376\375"
+ 103      FFFEFDDD 
+ 103      FFFEFDDD 
+ 103      FFFEFD
+ 104 04d2 DDFFFEFD 		.ascii	"\335\377\376\375\335\377\376\375\335\377\376\375\335\377\376"
+ 104      DDFFFEFD 
+ 104      DDFFFEFD 
+ 104      DDFFFE
+ 105 04e1 FDDEFFFE 		.ascii	"\375\336\377\376\375\336\377\376\375\336\377\376\375\336\377"
+ 105      FDDEFFFE 
+ 105      FDDEFFFE 
+ 105      FDDEFF
+ 106 04f0 FEFDDEFF 		.ascii	"\376\375\336\377\376\375\336\377\376\375\336\377\376\375\336"
+ 106      FEFDDEFF 
+ 106      FEFDDEFF 
+ 106      FEFDDE
+ 107 04ff FFFEFDDE 		.ascii	"\377\376\375\336\377\376\375\336\377\376\375\336\377\376\375"
+ 107      FFFEFDDE 
+ 107      FFFEFDDE 
+ 107      FFFEFD
+ 108 050e DFFFFEFD 		.ascii	"\337\377\376\375\337\377\376\375\337\377\376\376\337\377\376"
+ 108      DFFFFEFD 
+ 108      DFFFFEFE 
+ 108      DFFFFE
+ 109 051d FEDFFFFE 		.ascii	"\376\337\377\376\376\337\377\376\376\337\377\376\376\337\377"
+ 109      FEDFFFFE 
+ 109      FEDFFFFE 
+ 109      FEDFFF
+ 110 052c FEFEDFFF 		.ascii	"\376\376\337\377\376\376\337\377\376\376\337\377\376\376\337"
+ 110      FEFEDFFF 
+ 110      FEFEDFFF 
+ 110      FEFEDF
+ 111 053b FFFEFEE0 		.ascii	"\377\376\376\340\377\376\376\340\377\376\376\340\377\376\376"
+ 111      FFFEFEE0 
+ 111      FFFEFEE0 
+ 111      FFFEFE
+ 112 054a E0FFFEFE 		.ascii	"\340\377\376\376\340\377\376\376\340\377\376\376\340\377\376"
+ 112      E0FFFEFE 
+ 112      E0FFFEFE 
+ 112      E0FFFE
+ 113 0559 FEE0FFFE 		.ascii	"\376\340\377\376\376\340\377\376\376\340\377\376\376\340\377"
+ 113      FEE0FFFE 
+ 113      FEE0FFFE 
+ 113      FEE0FF
+ 114 0568 FEFEE0FF 		.ascii	"\376\376\340\377\376\376\340\377\376\376\340\377\376\376\340"
+ 114      FEFEE0FF 
+ 114      FEFEE0FF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 8
+
+
+ 114      FEFEE0
+ 115 0577 FFFEFEE1 		.ascii	"\377\376\376\341\377\376\376\341\377\376\376\341\377\376\376"
+ 115      FFFEFEE1 
+ 115      FFFEFEE1 
+ 115      FFFEFE
+ 116 0586 E1FFFEFE 		.ascii	"\341\377\376\376\341\377\376\376\341\377\376\376\341\377\376"
+ 116      E1FFFEFE 
+ 116      E1FFFEFE 
+ 116      E1FFFE
+ 117 0595 FEE1FFFE 		.ascii	"\376\341\377\376\376\341\377\376\376\341\377\376\376\341\377"
+ 117      FEE1FFFE 
+ 117      FEE1FFFE 
+ 117      FEE1FF
+ 118 05a4 FEFEE1FF 		.ascii	"\376\376\341\377\376\376\341\377\376\376\341\377\376\376\341"
+ 118      FEFEE1FF 
+ 118      FEFEE1FF 
+ 118      FEFEE1
+ 119 05b3 FFFEFEE1 		.ascii	"\377\376\376\341\377\376\376\341\377\376\376\341\377\376\376"
+ 119      FFFEFEE1 
+ 119      FFFEFEE1 
+ 119      FFFEFE
+ 120 05c2 E1FFFEFE 		.ascii	"\341\377\376\376\342\377\376\376\342\377\376\376\342\377\376"
+ 120      E2FFFEFE 
+ 120      E2FFFEFE 
+ 120      E2FFFE
+ 121 05d1 FEE2FFFE 		.ascii	"\376\342\377\376\376\342\377\376\376\342\377\376\376\342\377"
+ 121      FEE2FFFE 
+ 121      FEE2FFFE 
+ 121      FEE2FF
+ 122 05e0 FEFEE2FF 		.ascii	"\376\376\342\377\376\376\342\377\376\376\342\377\376\376\342"
+ 122      FEFEE2FF 
+ 122      FEFEE2FF 
+ 122      FEFEE2
+ 123 05ef FFFEFEE2 		.ascii	"\377\376\376\342\377\376\376\342\377\376\376\342\377\376\376"
+ 123      FFFEFEE2 
+ 123      FFFEFEE2 
+ 123      FFFEFE
+ 124 05fe E2FFFEFE 		.ascii	"\342\377\376\376\342\377\376\376\342\377\376\376\342\377\376"
+ 124      E2FFFEFE 
+ 124      E2FFFEFE 
+ 124      E2FFFE
+ 125 060d FEE2FFFE 		.ascii	"\376\342\377\376\376\342\377\376\376\342\377\376\376\342\377"
+ 125      FEE2FFFE 
+ 125      FEE2FFFE 
+ 125      FEE2FF
+ 126 061c FEFEE2FF 		.ascii	"\376\376\342\377\376\376\342\377\376\376\342\377\376\376\342"
+ 126      FEFEE2FF 
+ 126      FEFEE2FF 
+ 126      FEFEE2
+ 127 062b FFFEFEE2 		.ascii	"\377\376\376\342\377\376\376\343\377\376\376\343\377\376\376"
+ 127      FFFEFEE3 
+ 127      FFFEFEE3 
+ 127      FFFEFE
+ 128 063a E3FFFEFE 		.ascii	"\343\377\376\376\343\377\376\376\343\377\376\376\343\377\376"
+ 128      E3FFFEFE 
+ 128      E3FFFEFE 
+ 128      E3FFFE
+GAS LISTING /tmp/ccoFiSH1.s 			page 9
+
+
+ 129 0649 FEE3FFFE 		.ascii	"\376\343\377\376\376\343\377\376\376\343\377\376\376\343\377"
+ 129      FEE3FFFE 
+ 129      FEE3FFFE 
+ 129      FEE3FF
+ 130 0658 FEFEE3FF 		.ascii	"\376\376\343\377\376\376\343\377\376\376\343\377\376\376\343"
+ 130      FEFEE3FF 
+ 130      FEFEE3FF 
+ 130      FEFEE3
+ 131 0667 FFFEFEE3 		.ascii	"\377\376\376\343\377\376\376\343\377\376\376\343\377\376\376"
+ 131      FFFEFEE3 
+ 131      FFFEFEE3 
+ 131      FFFEFE
+ 132 0676 E3FFFEFE 		.ascii	"\343\377\376\376\343\377\376\376\343\377\376\376\343\377\376"
+ 132      E3FFFEFE 
+ 132      E3FFFEFE 
+ 132      E3FFFE
+ 133 0685 FEE3FFFE 		.ascii	"\376\343\377\376\376\343\377\376\376\343\377\376\376\343\377"
+ 133      FEE3FFFE 
+ 133      FEE3FFFE 
+ 133      FEE3FF
+ 134 0694 FEFEE3FF 		.ascii	"\376\376\343\377\376\376\343\377\376\376\343\377\376\376\343"
+ 134      FEFEE3FF 
+ 134      FEFEE3FF 
+ 134      FEFEE3
+ 135 06a3 FFFEFEE3 		.ascii	"\377\376\376\343\377\376\376\343\377\376\376\343\377\376\376"
+ 135      FFFEFEE3 
+ 135      FFFEFEE3 
+ 135      FFFEFE
+ 136 06b2 E3FFFEFE 		.ascii	"\343\377\376\376\343\377\376\376\343\377\376\376\343\377\376"
+ 136      E3FFFEFE 
+ 136      E3FFFEFE 
+ 136      E3FFFE
+ 137 06c1 FEE3FFFE 		.ascii	"\376\343\377\376\376\343\377\376\376\343\377\376\376\343\377"
+ 137      FEE3FFFE 
+ 137      FEE3FFFE 
+ 137      FEE3FF
+ 138 06d0 FEFEE3FF 		.ascii	"\376\376\343\377\376\376\343\377\376\376\344\377\376\376\344"
+ 138      FEFEE3FF 
+ 138      FEFEE4FF 
+ 138      FEFEE4
+ 139 06df FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 139      FFFEFEE4 
+ 139      FFFEFEE4 
+ 139      FFFEFE
+ 140 06ee E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 140      E4FFFEFE 
+ 140      E4FFFEFE 
+ 140      E4FFFE
+ 141 06fd FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 141      FEE4FFFE 
+ 141      FEE4FFFE 
+ 141      FEE4FF
+ 142 070c FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 142      FEFEE4FF 
+ 142      FEFEE4FF 
+ 142      FEFEE4
+ 143 071b FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+GAS LISTING /tmp/ccoFiSH1.s 			page 10
+
+
+ 143      FFFEFEE4 
+ 143      FFFEFEE4 
+ 143      FFFEFE
+ 144 072a E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 144      E4FFFEFE 
+ 144      E4FFFEFE 
+ 144      E4FFFE
+ 145 0739 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 145      FEE4FFFE 
+ 145      FEE4FFFE 
+ 145      FEE4FF
+ 146 0748 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 146      FEFEE4FF 
+ 146      FEFEE4FF 
+ 146      FEFEE4
+ 147 0757 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 147      FFFEFEE4 
+ 147      FFFEFEE4 
+ 147      FFFEFE
+ 148 0766 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 148      E4FFFEFE 
+ 148      E4FFFEFE 
+ 148      E4FFFE
+ 149 0775 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 149      FEE4FFFE 
+ 149      FEE4FFFE 
+ 149      FEE4FF
+ 150 0784 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 150      FEFEE4FF 
+ 150      FEFEE4FF 
+ 150      FEFEE4
+ 151 0793 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 151      FFFEFEE4 
+ 151      FFFEFEE4 
+ 151      FFFEFE
+ 152 07a2 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 152      E4FFFEFE 
+ 152      E4FFFEFE 
+ 152      E4FFFE
+ 153 07b1 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 153      FEE4FFFE 
+ 153      FEE4FFFE 
+ 153      FEE4FF
+ 154 07c0 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 154      FEFEE4FF 
+ 154      FEFEE4FF 
+ 154      FEFEE4
+ 155 07cf FF       		.ascii	"\377"
+ 156 07d0 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 156      FEFEE4FF 
+ 156      FEFEE4FF 
+ 156      FEFEE4
+ 157 07df FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 157      FFFEFEE4 
+ 157      FFFEFEE4 
+ 157      FFFEFE
+ 158 07ee E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+GAS LISTING /tmp/ccoFiSH1.s 			page 11
+
+
+ 158      E4FFFEFE 
+ 158      E4FFFEFE 
+ 158      E4FFFE
+ 159 07fd FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 159      FEE4FFFE 
+ 159      FEE4FFFE 
+ 159      FEE4FF
+ 160 080c FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 160      FEFEE4FF 
+ 160      FEFEE4FF 
+ 160      FEFEE4
+ 161 081b FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 161      FFFEFEE4 
+ 161      FFFEFEE4 
+ 161      FFFEFE
+ 162 082a E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 162      E4FFFEFE 
+ 162      E4FFFEFE 
+ 162      E4FFFE
+ 163 0839 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 163      FEE4FFFE 
+ 163      FEE4FFFE 
+ 163      FEE4FF
+ 164 0848 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 164      FEFEE4FF 
+ 164      FEFEE4FF 
+ 164      FEFEE4
+ 165 0857 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 165      FFFEFEE4 
+ 165      FFFEFEE4 
+ 165      FFFEFE
+ 166 0866 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 166      E4FFFEFE 
+ 166      E4FFFEFE 
+ 166      E4FFFE
+ 167 0875 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 167      FEE4FFFE 
+ 167      FEE4FFFE 
+ 167      FEE4FF
+ 168 0884 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 168      FEFEE4FF 
+ 168      FEFEE4FF 
+ 168      FEFEE4
+ 169 0893 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 169      FFFEFEE4 
+ 169      FFFEFEE4 
+ 169      FFFEFE
+ 170 08a2 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 170      E4FFFEFE 
+ 170      E4FFFEFE 
+ 170      E4FFFE
+ 171 08b1 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 171      FEE4FFFE 
+ 171      FEE4FFFE 
+ 171      FEE4FF
+ 172 08c0 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 172      FEFEE4FF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 12
+
+
+ 172      FEFEE4FF 
+ 172      FEFEE4
+ 173 08cf FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 173      FFFEFEE4 
+ 173      FFFEFEE4 
+ 173      FFFEFE
+ 174 08de E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 174      E4FFFEFE 
+ 174      E4FFFEFE 
+ 174      E4FFFE
+ 175 08ed FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 175      FEE4FFFE 
+ 175      FEE4FFFE 
+ 175      FEE4FF
+ 176 08fc FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 176      FEFEE4FF 
+ 176      FEFEE4FF 
+ 176      FEFEE4
+ 177 090b FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 177      FFFEFEE4 
+ 177      FFFEFEE4 
+ 177      FFFEFE
+ 178 091a E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 178      E4FFFEFE 
+ 178      E4FFFEFE 
+ 178      E4FFFE
+ 179 0929 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 179      FEE4FFFE 
+ 179      FEE4FFFE 
+ 179      FEE4FF
+ 180 0938 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 180      FEFEE4FF 
+ 180      FEFEE4FF 
+ 180      FEFEE4
+ 181 0947 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 181      FFFEFEE4 
+ 181      FFFEFEE4 
+ 181      FFFEFE
+ 182 0956 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 182      E4FFFEFE 
+ 182      E4FFFEFE 
+ 182      E4FFFE
+ 183 0965 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 183      FEE4FFFE 
+ 183      FEE4FFFE 
+ 183      FEE4FF
+ 184 0974 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 184      FEFEE4FF 
+ 184      FEFEE4FF 
+ 184      FEFEE4
+ 185 0983 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 185      FFFEFEE4 
+ 185      FFFEFEE4 
+ 185      FFFEFE
+ 186 0992 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 186      E4FFFEFE 
+ 186      E4FFFEFE 
+GAS LISTING /tmp/ccoFiSH1.s 			page 13
+
+
+ 186      E4FFFE
+ 187 09a1 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 187      FEE4FFFE 
+ 187      FEE4FFFE 
+ 187      FEE4FF
+ 188 09b0 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 188      FEFEE4FF 
+ 188      FEFEE4FF 
+ 188      FEFEE4
+ 189 09bf FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 189      FFFEFEE4 
+ 189      FFFEFEE4 
+ 189      FFFEFE
+ 190 09ce E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 190      E4FFFEFE 
+ 190      E4FFFEFE 
+ 190      E4FFFE
+ 191 09dd FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 191      FEE4FFFE 
+ 191      FEE4FFFE 
+ 191      FEE4FF
+ 192 09ec FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 192      FEFEE4FF 
+ 192      FEFEE4FF 
+ 192      FEFEE4
+ 193 09fb FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 193      FFFEFEE4 
+ 193      FFFEFEE4 
+ 193      FFFEFE
+ 194 0a0a E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 194      E4FFFEFE 
+ 194      E4FFFEFE 
+ 194      E4FFFE
+ 195 0a19 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 195      FEE4FFFE 
+ 195      FEE4FFFE 
+ 195      FEE4FF
+ 196 0a28 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 196      FEFEE4FF 
+ 196      FEFEE4FF 
+ 196      FEFEE4
+ 197 0a37 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 197      FFFEFEE4 
+ 197      FFFEFEE4 
+ 197      FFFEFE
+ 198 0a46 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 198      E4FFFEFE 
+ 198      E4FFFEFE 
+ 198      E4FFFE
+ 199 0a55 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 199      FEE4FFFE 
+ 199      FEE4FFFE 
+ 199      FEE4FF
+ 200 0a64 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 200      FEFEE4FF 
+ 200      FEFEE4FF 
+ 200      FEFEE4
+GAS LISTING /tmp/ccoFiSH1.s 			page 14
+
+
+ 201 0a73 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 201      FFFEFEE4 
+ 201      FFFEFEE4 
+ 201      FFFEFE
+ 202 0a82 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 202      E4FFFEFE 
+ 202      E4FFFEFE 
+ 202      E4FFFE
+ 203 0a91 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 203      FEE4FFFE 
+ 203      FEE4FFFE 
+ 203      FEE4FF
+ 204 0aa0 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 204      FEFEE4FF 
+ 204      FEFEE4FF 
+ 204      FEFEE4
+ 205 0aaf FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 205      FFFEFEE4 
+ 205      FFFEFEE4 
+ 205      FFFEFE
+ 206 0abe E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 206      E4FFFEFE 
+ 206      E4FFFEFE 
+ 206      E4FFFE
+ 207 0acd FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 207      FEE4FFFE 
+ 207      FEE4FFFE 
+ 207      FEE4FF
+ 208 0adc FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 208      FEFEE4FF 
+ 208      FEFEE4FF 
+ 208      FEFEE4
+ 209 0aeb FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 209      FFFEFEE4 
+ 209      FFFEFEE4 
+ 209      FFFEFE
+ 210 0afa E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 210      E4FFFEFE 
+ 210      E4FFFEFE 
+ 210      E4FFFE
+ 211 0b09 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 211      FEE4FFFE 
+ 211      FEE4FFFE 
+ 211      FEE4FF
+ 212 0b18 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 212      FEFEE4FF 
+ 212      FEFEE4FF 
+ 212      FEFEE4
+ 213 0b27 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 213      FFFEFEE4 
+ 213      FFFEFEE4 
+ 213      FFFEFE
+ 214 0b36 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 214      E4FFFEFE 
+ 214      E4FFFEFE 
+ 214      E4FFFE
+ 215 0b45 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+GAS LISTING /tmp/ccoFiSH1.s 			page 15
+
+
+ 215      FEE4FFFE 
+ 215      FEE4FFFE 
+ 215      FEE4FF
+ 216 0b54 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 216      FEFEE4FF 
+ 216      FEFEE4FF 
+ 216      FEFEE4
+ 217 0b63 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 217      FFFEFEE4 
+ 217      FFFEFEE4 
+ 217      FFFEFE
+ 218 0b72 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 218      E4FFFEFE 
+ 218      E4FFFEFE 
+ 218      E4FFFE
+ 219 0b81 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 219      FEE4FFFE 
+ 219      FEE4FFFE 
+ 219      FEE4FF
+ 220 0b90 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 220      FEFEE4FF 
+ 220      FEFEE4FF 
+ 220      FEFEE4
+ 221 0b9f FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 221      FFFEFEE4 
+ 221      FFFEFEE4 
+ 221      FFFEFE
+ 222 0bae E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 222      E4FFFEFE 
+ 222      E4FFFEFE 
+ 222      E4FFFE
+ 223 0bbd FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 223      FEE4FFFE 
+ 223      FEE4FFFE 
+ 223      FEE4FF
+ 224 0bcc FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 224      FEFEE4FF 
+ 224      FEFEE4FF 
+ 224      FEFEE4
+ 225 0bdb FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 225      FFFEFEE4 
+ 225      FFFEFEE4 
+ 225      FFFEFE
+ 226 0bea E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 226      E4FFFEFE 
+ 226      E4FFFEFE 
+ 226      E4FFFE
+ 227 0bf9 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 227      FEE4FFFE 
+ 227      FEE4FFFE 
+ 227      FEE4FF
+ 228 0c08 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 228      FEFEE4FF 
+ 228      FEFEE4FF 
+ 228      FEFEE4
+ 229 0c17 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 229      FFFEFEE4 
+GAS LISTING /tmp/ccoFiSH1.s 			page 16
+
+
+ 229      FFFEFEE4 
+ 229      FFFEFE
+ 230 0c26 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 230      E4FFFEFE 
+ 230      E4FFFEFE 
+ 230      E4FFFE
+ 231 0c35 FEE4FFFE 		.ascii	"\376\344\377\376\376\344\377\376\376\344\377\376\376\344\377"
+ 231      FEE4FFFE 
+ 231      FEE4FFFE 
+ 231      FEE4FF
+ 232 0c44 FEFEE4FF 		.ascii	"\376\376\344\377\376\376\344\377\376\376\344\377\376\376\344"
+ 232      FEFEE4FF 
+ 232      FEFEE4FF 
+ 232      FEFEE4
+ 233 0c53 FFFEFEE4 		.ascii	"\377\376\376\344\377\376\376\344\377\376\376\344\377\376\376"
+ 233      FFFEFEE4 
+ 233      FFFEFEE4 
+ 233      FFFEFE
+ 234 0c62 E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377\376\376\344\377\376"
+ 234      E4FFFEFE 
+ 234      E4FFFEFE 
+ 234      E4FFFE
+ 235 0c71 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 235      FFE4FFFE 
+ 235      FFE4FFFE 
+ 235      FFE4FF
+ 236 0c80 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 236      FEFFE4FF 
+ 236      FEFFE4FF 
+ 236      FEFFE4
+ 237 0c8f FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 237      FFFEFFE4 
+ 237      FFFEFFE4 
+ 237      FFFEFF
+ 238 0c9e E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 238      E4FFFEFF 
+ 238      E4FFFEFF 
+ 238      E4FFFE
+ 239 0cad FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 239      FFE4FFFE 
+ 239      FFE4FFFE 
+ 239      FFE4FF
+ 240 0cbc FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 240      FEFFE4FF 
+ 240      FEFFE4FF 
+ 240      FEFFE4
+ 241 0ccb FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 241      FFFEFFE4 
+ 241      FFFEFFE4 
+ 241      FFFEFF
+ 242 0cda E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 242      E4FFFEFF 
+ 242      E4FFFEFF 
+ 242      E4FFFE
+ 243 0ce9 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 243      FFE4FFFE 
+ 243      FFE4FFFE 
+GAS LISTING /tmp/ccoFiSH1.s 			page 17
+
+
+ 243      FFE4FF
+ 244 0cf8 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 244      FEFFE4FF 
+ 244      FEFFE4FF 
+ 244      FEFFE4
+ 245 0d07 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 245      FFFEFFE4 
+ 245      FFFEFFE4 
+ 245      FFFEFF
+ 246 0d16 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 246      E4FFFEFF 
+ 246      E4FFFEFF 
+ 246      E4FFFE
+ 247 0d25 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 247      FFE4FFFE 
+ 247      FFE4FFFE 
+ 247      FFE4FF
+ 248 0d34 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 248      FEFFE4FF 
+ 248      FEFFE4FF 
+ 248      FEFFE4
+ 249 0d43 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 249      FFFEFFE4 
+ 249      FFFEFFE4 
+ 249      FFFEFF
+ 250 0d52 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 250      E4FFFEFF 
+ 250      E4FFFEFF 
+ 250      E4FFFE
+ 251 0d61 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 251      FFE4FFFE 
+ 251      FFE4FFFE 
+ 251      FFE4FF
+ 252 0d70 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 252      FEFFE4FF 
+ 252      FEFFE4FF 
+ 252      FEFFE4
+ 253 0d7f FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 253      FFFEFFE4 
+ 253      FFFEFFE4 
+ 253      FFFEFF
+ 254 0d8e E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 254      E4FFFEFF 
+ 254      E4FFFEFF 
+ 254      E4FFFE
+ 255 0d9d FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 255      FFE4FFFE 
+ 255      FFE4FFFE 
+ 255      FFE4FF
+ 256 0dac FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 256      FEFFE4FF 
+ 256      FEFFE4FF 
+ 256      FEFFE4
+ 257 0dbb FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 257      FFFEFFE4 
+ 257      FFFEFFE4 
+ 257      FFFEFF
+GAS LISTING /tmp/ccoFiSH1.s 			page 18
+
+
+ 258 0dca E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 258      E4FFFEFF 
+ 258      E4FFFEFF 
+ 258      E4FFFE
+ 259 0dd9 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 259      FFE4FFFE 
+ 259      FFE4FFFE 
+ 259      FFE4FF
+ 260 0de8 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 260      FEFFE4FF 
+ 260      FEFFE4FF 
+ 260      FEFFE4
+ 261 0df7 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 261      FFFEFFE4 
+ 261      FFFEFFE4 
+ 261      FFFEFF
+ 262 0e06 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 262      E4FFFEFF 
+ 262      E4FFFEFF 
+ 262      E4FFFE
+ 263 0e15 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 263      FFE4FFFE 
+ 263      FFE4FFFE 
+ 263      FFE4FF
+ 264 0e24 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 264      FEFFE4FF 
+ 264      FEFFE4FF 
+ 264      FEFFE4
+ 265 0e33 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 265      FFFEFFE4 
+ 265      FFFEFFE4 
+ 265      FFFEFF
+ 266 0e42 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 266      E4FFFEFF 
+ 266      E4FFFEFF 
+ 266      E4FFFE
+ 267 0e51 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 267      FFE4FFFE 
+ 267      FFE4FFFE 
+ 267      FFE4FF
+ 268 0e60 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 268      FEFFE4FF 
+ 268      FEFFE4FF 
+ 268      FEFFE4
+ 269 0e6f FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 269      FFFEFFE4 
+ 269      FFFEFFE4 
+ 269      FFFEFF
+ 270 0e7e E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 270      E4FFFEFF 
+ 270      E4FFFEFF 
+ 270      E4FFFE
+ 271 0e8d FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 271      FFE4FFFE 
+ 271      FFE4FFFE 
+ 271      FFE4FF
+ 272 0e9c FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+GAS LISTING /tmp/ccoFiSH1.s 			page 19
+
+
+ 272      FEFFE4FF 
+ 272      FEFFE4FF 
+ 272      FEFFE4
+ 273 0eab FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 273      FFFEFFE4 
+ 273      FFFEFFE4 
+ 273      FFFEFF
+ 274 0eba E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 274      E4FFFEFF 
+ 274      E4FFFEFF 
+ 274      E4FFFE
+ 275 0ec9 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 275      FFE4FFFE 
+ 275      FFE4FFFE 
+ 275      FFE4FF
+ 276 0ed8 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 276      FEFFE4FF 
+ 276      FEFFE4FF 
+ 276      FEFFE4
+ 277 0ee7 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 277      FFFEFFE4 
+ 277      FFFEFFE4 
+ 277      FFFEFF
+ 278 0ef6 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 278      E4FFFEFF 
+ 278      E4FFFEFF 
+ 278      E4FFFE
+ 279 0f05 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 279      FFE4FFFE 
+ 279      FFE4FFFE 
+ 279      FFE4FF
+ 280 0f14 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 280      FEFFE4FF 
+ 280      FEFFE4FF 
+ 280      FEFFE4
+ 281 0f23 FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 281      FFFEFFE4 
+ 281      FFFEFFE4 
+ 281      FFFEFF
+ 282 0f32 E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 282      E4FFFEFF 
+ 282      E4FFFEFF 
+ 282      E4FFFE
+ 283 0f41 FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 283      FFE4FFFE 
+ 283      FFE4FFFE 
+ 283      FFE4FF
+ 284 0f50 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 284      FEFFE4FF 
+ 284      FEFFE4FF 
+ 284      FEFFE4
+ 285 0f5f FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 285      FFFEFFE4 
+ 285      FFFEFFE4 
+ 285      FFFEFF
+ 286 0f6e E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 286      E4FFFEFF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 20
+
+
+ 286      E4FFFEFF 
+ 286      E4FFFE
+ 287 0f7d FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 287      FFE4FFFE 
+ 287      FFE4FFFE 
+ 287      FFE4FF
+ 288 0f8c FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 288      FEFFE4FF 
+ 288      FEFFE4FF 
+ 288      FEFFE4
+ 289 0f9b FFFEFFE4 		.ascii	"\377\376\377\344\377"
+ 289      FF
+ 290 0fa0 FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 290      FEFFE4FF 
+ 290      FEFFE4FF 
+ 290      FEFFE4
+ 291 0faf FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 291      FFFEFFE4 
+ 291      FFFEFFE4 
+ 291      FFFEFF
+ 292 0fbe E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377\376\377\344\377\376"
+ 292      E4FFFEFF 
+ 292      E4FFFEFF 
+ 292      E4FFFE
+ 293 0fcd FFE4FFFE 		.ascii	"\377\344\377\376\377\344\377\376\377\344\377\376\377\344\377"
+ 293      FFE4FFFE 
+ 293      FFE4FFFE 
+ 293      FFE4FF
+ 294 0fdc FEFFE4FF 		.ascii	"\376\377\344\377\376\377\344\377\376\377\344\377\376\377\344"
+ 294      FEFFE4FF 
+ 294      FEFFE4FF 
+ 294      FEFFE4
+ 295 0feb FFFEFFE4 		.ascii	"\377\376\377\344\377\376\377\344\377\376\377\344\377\376\377"
+ 295      FFFEFFE4 
+ 295      FFFEFFE4 
+ 295      FFFEFF
+ 296 0ffa E4FFFEFF 		.ascii	"\344\377\376\377\344\377\376\377\344\377"
+ 296      E4FFFEFF 
+ 296      E4FF
+ 297              		.globl	heatmap_cs_YlOrBr_mixed
+ 298              		.section	.data.rel.local
+ 299              		.align 8
+ 300              		.type	heatmap_cs_YlOrBr_mixed, @object
+ 301              		.size	heatmap_cs_YlOrBr_mixed, 8
+ 302              	heatmap_cs_YlOrBr_mixed:
+ 303 0008 00000000 		.quad	mixed
+ 303      00000000 
+ 304              		.section	.data.rel.ro.local
+ 305              		.align 16
+ 306              		.type	mixed, @object
+ 307              		.size	mixed, 16
+ 308              	mixed:
+ 309 0010 00000000 		.quad	mixed_data
+ 309      00000000 
+ 310 0018 01040000 		.quad	1025
+ 310      00000000 
+ 311              		.section	.rodata
+GAS LISTING /tmp/ccoFiSH1.s 			page 21
+
+
+ 312 1004 00000000 		.align 32
+ 312      00000000 
+ 312      00000000 
+ 312      00000000 
+ 312      00000000 
+ 313              		.type	mixed_data, @object
+ 314              		.size	mixed_data, 4100
+ 315              	mixed_data:
+ 316 1020 00       		.string	""
+ 317 1021 00       		.string	""
+ 318 1022 00       		.string	""
+ 319 1023 00       		.string	""
+ 320 1024 65250500 		.string	"e%\005"
+ 321 1028 66250607 		.ascii	"f%\006\007f%\006\016f%\006\026g%\006\035g%\006%g%\006,h%\006"
+ 321      6625060E 
+ 321      66250616 
+ 321      6725061D 
+ 321      67250625 
+ 322 1043 34682506 		.ascii	"4h%\006;h%\006Ci%\006Ji&\006Ri&\006Yi&\006aj&\006hj&\006pj&\006"
+ 322      3B682506 
+ 322      43692506 
+ 322      4A692606 
+ 322      52692606 
+ 323 1067 776B2606 		.ascii	"wk&\006\177k&\006\206k&\006\215l&\006\225l&\006\234l'\006\244"
+ 323      7F6B2606 
+ 323      866B2606 
+ 323      8D6C2606 
+ 323      956C2606 
+ 324 1080 6D2706AB 		.ascii	"m'\006\253m'\006\263m'\006\272n'\006\302n'\006\311n'\006\321"
+ 324      6D2706B3 
+ 324      6D2706BA 
+ 324      6E2706C2 
+ 324      6E2706C9 
+ 325 1098 6E2706D8 		.ascii	"n'\006\330o'\006\340o'\006\347o(\006\357p(\006\366p(\006\376"
+ 325      6F2706E0 
+ 325      6F2706E7 
+ 325      6F2806EF 
+ 325      702806F6 
+ 326 10b0 702806FF 		.ascii	"p(\006\377q(\006\377q(\006\377q(\006\377r(\006\377r(\006\377"
+ 326      712806FF 
+ 326      712806FF 
+ 326      712806FF 
+ 326      722806FF 
+ 327 10c8 722806FF 		.ascii	"r(\006\377s(\006\377s)\006\377s)\006\377s)\006\377t)\006\377"
+ 327      732806FF 
+ 327      732906FF 
+ 327      732906FF 
+ 327      732906FF 
+ 328 10e0 742906FF 		.ascii	"t)\006\377t)\006\377u)\006\377u)\006\377u)\006\377v)\006\377"
+ 328      742906FF 
+ 328      752906FF 
+ 328      752906FF 
+ 328      752906FF 
+ 329 10f8 762906FF 		.ascii	"v)\006\377v*\006\377w*\006\377w*\006\377w*\006\377x*\006\377"
+ 329      762A06FF 
+ 329      772A06FF 
+ 329      772A06FF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 22
+
+
+ 329      772A06FF 
+ 330 1110 782A06FF 		.ascii	"x*\006\377x*\006\377y*\006\377y*\006\377y*\005\377\204.\005\377"
+ 330      782A06FF 
+ 330      792A06FF 
+ 330      792A06FF 
+ 330      792A05FF 
+ 331 1128 842E05FF 		.ascii	"\204.\005\377\204.\005\377\205.\005\377\205.\005\377\205.\005"
+ 331      842E05FF 
+ 331      852E05FF 
+ 331      852E05FF 
+ 331      852E05
+ 332 113b FF862E05 		.ascii	"\377\206.\005\377\206.\005\377\206.\005\377\207.\005\377\207"
+ 332      FF862E05 
+ 332      FF862E05 
+ 332      FF872E05 
+ 332      FF87
+ 333 114d 2E05FF87 		.ascii	".\005\377\207/\005\377\210/\005\377\210/\005\377\210/\005\377"
+ 333      2F05FF88 
+ 333      2F05FF88 
+ 333      2F05FF88 
+ 333      2F05FF
+ 334 1160 892F05FF 		.ascii	"\211/\005\377\211/\005\377\211/\005\377\211/\005\377\212/\005"
+ 334      892F05FF 
+ 334      892F05FF 
+ 334      892F05FF 
+ 334      8A2F05
+ 335 1173 FF8A2F05 		.ascii	"\377\212/\005\377\212/\005\377\2130\005\377\2130\005\377\213"
+ 335      FF8A2F05 
+ 335      FF8B3005 
+ 335      FF8B3005 
+ 335      FF8B
+ 336 1185 3005FF8C 		.ascii	"0\005\377\2140\005\377\2140\005\377\2140\005\377\2150\005\377"
+ 336      3005FF8C 
+ 336      3005FF8C 
+ 336      3005FF8D 
+ 336      3005FF
+ 337 1198 8D3004FF 		.ascii	"\2150\004\377\2150\004\377\2160\004\377\2161\004\377\2161\004"
+ 337      8D3004FF 
+ 337      8E3004FF 
+ 337      8E3104FF 
+ 337      8E3104
+ 338 11ab FF8F3104 		.ascii	"\377\2171\004\377\2171\004\377\2171\004\377\2201\004\377\220"
+ 338      FF8F3104 
+ 338      FF8F3104 
+ 338      FF903104 
+ 338      FF90
+ 339 11bd 3104FF90 		.ascii	"1\004\377\2201\004\377\2211\004\377\2211\004\377\2211\004\377"
+ 339      3104FF91 
+ 339      3104FF91 
+ 339      3104FF91 
+ 339      3104FF
+ 340 11d0 923204FF 		.ascii	"\2222\004\377\2222\004\377\2222\004\377\2232\004\377\2232\004"
+ 340      923204FF 
+ 340      923204FF 
+ 340      933204FF 
+ 340      933204
+ 341 11e3 FF933204 		.ascii	"\377\2232\004\377\2242\004\377\2242\004\377\2242\004\377\225"
+GAS LISTING /tmp/ccoFiSH1.s 			page 23
+
+
+ 341      FF943204 
+ 341      FF943204 
+ 341      FF943204 
+ 341      FF95
+ 342 11f5 3204FF95 		.ascii	"2\004\377\2252\004\377\2253\004\377\2263\004\377\2263\004\377"
+ 342      3204FF95 
+ 342      3304FF96 
+ 342      3304FF96 
+ 342      3304FF
+ 343 1208 963304FF 		.ascii	"\2263\004\377\2273\004\377\2273\004\377\2273\004\377\2303\004"
+ 343      973304FF 
+ 343      973304FF 
+ 343      973304FF 
+ 343      983304
+ 344 121b FF983304 		.ascii	"\377\2303\004\377\2303\004\377\2304\003\377\2314\004\377\231"
+ 344      FF983304 
+ 344      FF983403 
+ 344      FF993404 
+ 344      FF99
+ 345 122d 3404FF99 		.ascii	"4\004\377\2314\004\377\2324\004\377\2324\004\377\2324\004\377"
+ 345      3404FF9A 
+ 345      3404FF9A 
+ 345      3404FF9A 
+ 345      3404FF
+ 346 1240 9B3503FF 		.ascii	"\2335\003\377\2335\003\377\2335\003\377\2345\003\377\2345\003"
+ 346      9B3503FF 
+ 346      9B3503FF 
+ 346      9C3503FF 
+ 346      9C3503
+ 347 1253 FF9C3503 		.ascii	"\377\2345\003\377\2355\003\377\2356\003\377\2356\003\377\236"
+ 347      FF9D3503 
+ 347      FF9D3603 
+ 347      FF9D3603 
+ 347      FF9E
+ 348 1265 3603FF9E 		.ascii	"6\003\377\2366\003\377\2366\003\377\2366\003\377\2376\003\377"
+ 348      3603FF9E 
+ 348      3603FF9E 
+ 348      3603FF9F 
+ 348      3603FF
+ 349 1278 9F3703FF 		.ascii	"\2377\003\377\2377\003\377\2407\003\377\2407\003\377\2407\003"
+ 349      9F3703FF 
+ 349      A03703FF 
+ 349      A03703FF 
+ 349      A03703
+ 350 128b FFA13703 		.ascii	"\377\2417\003\377\2417\003\377\2418\003\377\2428\003\377\242"
+ 350      FFA13703 
+ 350      FFA13803 
+ 350      FFA23803 
+ 350      FFA2
+ 351 129d 3803FFA2 		.ascii	"8\003\377\2428\003\377\2438\003\377\2438\003\377\2438\003\377"
+ 351      3803FFA3 
+ 351      3803FFA3 
+ 351      3803FFA3 
+ 351      3803FF
+ 352 12b0 A43903FF 		.ascii	"\2449\003\377\2449\003\377\2449\003\377\2449\003\377\2459\003"
+ 352      A43903FF 
+ 352      A43903FF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 24
+
+
+ 352      A43903FF 
+ 352      A53903
+ 353 12c3 FFA53903 		.ascii	"\377\2459\003\377\2459\003\377\246:\003\377\246:\003\377\246"
+ 353      FFA53903 
+ 353      FFA63A03 
+ 353      FFA63A03 
+ 353      FFA6
+ 354 12d5 3A03FFA7 		.ascii	":\003\377\247:\003\377\247:\003\377\247:\003\377\250:\003\377"
+ 354      3A03FFA7 
+ 354      3A03FFA7 
+ 354      3A03FFA8 
+ 354      3A03FF
+ 355 12e8 A83B03FF 		.ascii	"\250;\003\377\250;\003\377\251;\003\377\251;\003\377\251;\003"
+ 355      A83B03FF 
+ 355      A93B03FF 
+ 355      A93B03FF 
+ 355      A93B03
+ 356 12fb FFAA3B03 		.ascii	"\377\252;\003\377\252<\003\377\252<\003\377\252<\003\377\253"
+ 356      FFAA3C03 
+ 356      FFAA3C03 
+ 356      FFAA3C03 
+ 356      FFAB
+ 357 130d 3C03FFAB 		.ascii	"<\003\377\253<\003\377\253<\003\377\254<\003\377\254=\003\377"
+ 357      3C03FFAB 
+ 357      3C03FFAC 
+ 357      3C03FFAC 
+ 357      3D03FF
+ 358 1320 AC3D03FF 		.ascii	"\254=\003\377\267B\003\377\267B\003\377\270B\003\377\270B\003"
+ 358      B74203FF 
+ 358      B74203FF 
+ 358      B84203FF 
+ 358      B84203
+ 359 1333 FFB84203 		.ascii	"\377\270B\003\377\271B\003\377\271C\003\377\271C\003\377\271"
+ 359      FFB94203 
+ 359      FFB94303 
+ 359      FFB94303 
+ 359      FFB9
+ 360 1345 4303FFBA 		.ascii	"C\003\377\272C\003\377\272C\003\377\272C\003\377\273C\003\377"
+ 360      4303FFBA 
+ 360      4303FFBA 
+ 360      4303FFBB 
+ 360      4303FF
+ 361 1358 BB4403FF 		.ascii	"\273D\003\377\273D\003\377\274D\003\377\274D\003\377\274D\003"
+ 361      BB4403FF 
+ 361      BC4403FF 
+ 361      BC4403FF 
+ 361      BC4403
+ 362 136b FFBD4403 		.ascii	"\377\275D\003\377\275E\003\377\275E\002\377\276E\002\377\276"
+ 362      FFBD4503 
+ 362      FFBD4502 
+ 362      FFBE4502 
+ 362      FFBE
+ 363 137d 4502FFBE 		.ascii	"E\002\377\276E\002\377\277E\002\377\277E\002\377\277F\002\377"
+ 363      4502FFBF 
+ 363      4502FFBF 
+ 363      4502FFBF 
+ 363      4602FF
+GAS LISTING /tmp/ccoFiSH1.s 			page 25
+
+
+ 364 1390 C04602FF 		.ascii	"\300F\002\377\300F\002\377\300F\002\377\301F\002\377\301F\002"
+ 364      C04602FF 
+ 364      C04602FF 
+ 364      C14602FF 
+ 364      C14602
+ 365 13a3 FFC14702 		.ascii	"\377\301G\002\377\301G\002\377\302G\002\377\302G\002\377\302"
+ 365      FFC14702 
+ 365      FFC24702 
+ 365      FFC24702 
+ 365      FFC2
+ 366 13b5 4702FFC3 		.ascii	"G\002\377\303G\002\377\303G\002\377\303H\002\377\304H\002\377"
+ 366      4702FFC3 
+ 366      4702FFC3 
+ 366      4802FFC4 
+ 366      4802FF
+ 367 13c8 C44802FF 		.ascii	"\304H\002\377\304H\002\377\305H\002\377\305H\002\377\305I\002"
+ 367      C44802FF 
+ 367      C54802FF 
+ 367      C54802FF 
+ 367      C54902
+ 368 13db FFC64902 		.ascii	"\377\306I\002\377\306I\002\377\306I\002\377\307I\002\377\307"
+ 368      FFC64902 
+ 368      FFC64902 
+ 368      FFC74902 
+ 368      FFC7
+ 369 13ed 4902FFC7 		.ascii	"I\002\377\307I\002\377\310J\002\377\310J\002\377\310J\002\377"
+ 369      4902FFC8 
+ 369      4A02FFC8 
+ 369      4A02FFC8 
+ 369      4A02FF
+ 370 1400 C94A02FF 		.ascii	"\311J\002\377\311J\002\377\311J\002\377\312K\002\377\312K\002"
+ 370      C94A02FF 
+ 370      C94A02FF 
+ 370      CA4B02FF 
+ 370      CA4B02
+ 371 1413 FFCA4B02 		.ascii	"\377\312K\002\377\313K\002\377\313K\002\377\313K\002\377\313"
+ 371      FFCB4B02 
+ 371      FFCB4B02 
+ 371      FFCB4B02 
+ 371      FFCB
+ 372 1425 4C01FFCC 		.ascii	"L\001\377\314L\002\377\314L\002\377\314L\002\377\314L\002\377"
+ 372      4C02FFCC 
+ 372      4C02FFCC 
+ 372      4C02FFCC 
+ 372      4C02FF
+ 373 1438 CD4D02FF 		.ascii	"\315M\002\377\315M\002\377\315M\002\377\315M\002\377\315N\002"
+ 373      CD4D02FF 
+ 373      CD4D02FF 
+ 373      CD4D02FF 
+ 373      CD4E02
+ 374 144b FFCE4E02 		.ascii	"\377\316N\002\377\316N\002\377\316N\003\377\316N\003\377\316"
+ 374      FFCE4E02 
+ 374      FFCE4E03 
+ 374      FFCE4E03 
+ 374      FFCE
+ 375 145d 4F03FFCF 		.ascii	"O\003\377\317O\003\377\317O\003\377\317O\003\377\317P\003\377"
+ 375      4F03FFCF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 26
+
+
+ 375      4F03FFCF 
+ 375      4F03FFCF 
+ 375      5003FF
+ 376 1470 CF5003FF 		.ascii	"\317P\003\377\320P\003\377\320P\003\377\320Q\003\377\320Q\004"
+ 376      D05003FF 
+ 376      D05003FF 
+ 376      D05103FF 
+ 376      D05104
+ 377 1483 FFD05104 		.ascii	"\377\320Q\004\377\321Q\004\377\321Q\004\377\321R\004\377\321"
+ 377      FFD15104 
+ 377      FFD15104 
+ 377      FFD15204 
+ 377      FFD1
+ 378 1495 5204FFD1 		.ascii	"R\004\377\321R\004\377\322R\004\377\322S\004\377\322S\004\377"
+ 378      5204FFD2 
+ 378      5204FFD2 
+ 378      5304FFD2 
+ 378      5304FF
+ 379 14a8 D25305FF 		.ascii	"\322S\005\377\322S\005\377\323S\005\377\323T\005\377\323T\005"
+ 379      D25305FF 
+ 379      D35305FF 
+ 379      D35405FF 
+ 379      D35405
+ 380 14bb FFD35405 		.ascii	"\377\323T\005\377\323T\005\377\324U\005\377\324U\005\377\324"
+ 380      FFD35405 
+ 380      FFD45505 
+ 380      FFD45505 
+ 380      FFD4
+ 381 14cd 5506FFD4 		.ascii	"U\006\377\324U\006\377\324U\006\377\325V\006\377\325V\006\377"
+ 381      5506FFD4 
+ 381      5506FFD5 
+ 381      5606FFD5 
+ 381      5606FF
+ 382 14e0 D55606FF 		.ascii	"\325V\006\377\325V\006\377\325W\006\377\326W\006\377\326W\007"
+ 382      D55606FF 
+ 382      D55706FF 
+ 382      D65706FF 
+ 382      D65707
+ 383 14f3 FFD65707 		.ascii	"\377\326W\007\377\326W\007\377\326X\007\377\327X\007\377\327"
+ 383      FFD65707 
+ 383      FFD65807 
+ 383      FFD75807 
+ 383      FFD7
+ 384 1505 5807FFD7 		.ascii	"X\007\377\327X\007\377\327Y\007\377\327Y\b\377\330Y\b\377\330"
+ 384      5807FFD7 
+ 384      5907FFD7 
+ 384      5908FFD8 
+ 384      5908FFD8 
+ 385 1519 5908FFD8 		.ascii	"Y\b\377\330Z\b\377\330Z\b\377\337a\f\377\337a\f\377\337b\f\377"
+ 385      5A08FFD8 
+ 385      5A08FFDF 
+ 385      610CFFDF 
+ 385      610CFFDF 
+ 386 1530 DF620CFF 		.ascii	"\337b\f\377\340b\f\377\340b\f\377\340c\r\377\340c\r\377\340c"
+ 386      E0620CFF 
+ 386      E0620CFF 
+ 386      E0630DFF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 27
+
+
+ 386      E0630DFF 
+ 387 1546 0DFFE163 		.ascii	"\r\377\341c\r\377\341c\r\377\341d\r\377\341d\r\377\341d\r\377"
+ 387      0DFFE163 
+ 387      0DFFE164 
+ 387      0DFFE164 
+ 387      0DFFE164 
+ 388 155c E2640EFF 		.ascii	"\342d\016\377\342e\016\377\342e\016\377\342e\016\377\342e\016"
+ 388      E2650EFF 
+ 388      E2650EFF 
+ 388      E2650EFF 
+ 388      E2650E
+ 389 156f FFE3650E 		.ascii	"\377\343e\016\377\343f\016\377\343f\016\377\343f\017\377\343"
+ 389      FFE3660E 
+ 389      FFE3660E 
+ 389      FFE3660F 
+ 389      FFE3
+ 390 1581 660FFFE4 		.ascii	"f\017\377\344g\017\377\344g\017\377\344g\017\377\344g\017\377"
+ 390      670FFFE4 
+ 390      670FFFE4 
+ 390      670FFFE4 
+ 390      670FFF
+ 391 1594 E4670FFF 		.ascii	"\344g\017\377\345h\017\377\345h\020\377\345h\020\377\345h\020"
+ 391      E5680FFF 
+ 391      E56810FF 
+ 391      E56810FF 
+ 391      E56810
+ 392 15a7 FFE56910 		.ascii	"\377\345i\020\377\346i\020\377\346i\020\377\346i\020\377\346"
+ 392      FFE66910 
+ 392      FFE66910 
+ 392      FFE66910 
+ 392      FFE6
+ 393 15b9 6910FFE6 		.ascii	"i\020\377\346j\020\377\347j\021\377\347j\021\377\347j\021\377"
+ 393      6A10FFE7 
+ 393      6A11FFE7 
+ 393      6A11FFE7 
+ 393      6A11FF
+ 394 15cc E76B11FF 		.ascii	"\347k\021\377\347k\021\377\350k\021\377\350k\021\377\350k\021"
+ 394      E76B11FF 
+ 394      E86B11FF 
+ 394      E86B11FF 
+ 394      E86B11
+ 395 15df FFE86C12 		.ascii	"\377\350l\022\377\350l\022\377\351l\022\377\351l\022\377\351"
+ 395      FFE86C12 
+ 395      FFE96C12 
+ 395      FFE96C12 
+ 395      FFE9
+ 396 15f1 6D12FFE9 		.ascii	"m\022\377\351m\022\377\351m\022\377\352m\022\377\352m\022\377"
+ 396      6D12FFE9 
+ 396      6D12FFEA 
+ 396      6D12FFEA 
+ 396      6D12FF
+ 397 1604 EA6E13FF 		.ascii	"\352n\023\377\352n\023\377\352n\023\377\353n\023\377\353o\023"
+ 397      EA6E13FF 
+ 397      EA6E13FF 
+ 397      EB6E13FF 
+ 397      EB6F13
+ 398 1617 FFEB6F13 		.ascii	"\377\353o\023\377\353o\023\377\353o\023\377\353p\023\377\354"
+GAS LISTING /tmp/ccoFiSH1.s 			page 28
+
+
+ 398      FFEB6F13 
+ 398      FFEB6F13 
+ 398      FFEB7013 
+ 398      FFEC
+ 399 1629 7014FFEC 		.ascii	"p\024\377\354p\024\377\354p\024\377\354q\024\377\354q\024\377"
+ 399      7014FFEC 
+ 399      7014FFEC 
+ 399      7114FFEC 
+ 399      7114FF
+ 400 163c EC7114FF 		.ascii	"\354q\024\377\354q\024\377\354r\024\377\355r\024\377\355r\025"
+ 400      EC7114FF 
+ 400      EC7214FF 
+ 400      ED7214FF 
+ 400      ED7215
+ 401 164f FFED7215 		.ascii	"\377\355r\025\377\355s\025\377\355s\025\377\355s\025\377\355"
+ 401      FFED7315 
+ 401      FFED7315 
+ 401      FFED7315 
+ 401      FFED
+ 402 1661 7315FFED 		.ascii	"s\025\377\355t\025\377\356t\025\377\356t\025\377\356t\026\377"
+ 402      7415FFEE 
+ 402      7415FFEE 
+ 402      7415FFEE 
+ 402      7416FF
+ 403 1674 EE7516FF 		.ascii	"\356u\026\377\356u\026\377\356u\026\377\356v\026\377\356v\026"
+ 403      EE7516FF 
+ 403      EE7516FF 
+ 403      EE7616FF 
+ 403      EE7616
+ 404 1687 FFEE7616 		.ascii	"\377\356v\026\377\357v\026\377\357w\027\377\357w\027\377\357"
+ 404      FFEF7616 
+ 404      FFEF7717 
+ 404      FFEF7717 
+ 404      FFEF
+ 405 1699 7717FFEF 		.ascii	"w\027\377\357w\027\377\357x\027\377\357x\027\377\357x\027\377"
+ 405      7717FFEF 
+ 405      7817FFEF 
+ 405      7817FFEF 
+ 405      7817FF
+ 406 16ac EF7817FF 		.ascii	"\357x\027\377\360y\030\377\360y\030\377\360y\030\377\360y\030"
+ 406      F07918FF 
+ 406      F07918FF 
+ 406      F07918FF 
+ 406      F07918
+ 407 16bf FFF07A18 		.ascii	"\377\360z\030\377\360z\030\377\360z\030\377\360z\030\377\361"
+ 407      FFF07A18 
+ 407      FFF07A18 
+ 407      FFF07A18 
+ 407      FFF1
+ 408 16d1 7B18FFF1 		.ascii	"{\030\377\361{\031\377\361{\031\377\361{\031\377\361|\031\377"
+ 408      7B19FFF1 
+ 408      7B19FFF1 
+ 408      7B19FFF1 
+ 408      7C19FF
+ 409 16e4 F17C19FF 		.ascii	"\361|\031\377\361|\031\377\361}\031\377\361}\031\377\362}\032"
+ 409      F17C19FF 
+ 409      F17D19FF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 29
+
+
+ 409      F17D19FF 
+ 409      F27D1A
+ 410 16f7 FFF27D1A 		.ascii	"\377\362}\032\377\362~\032\377\362~\032\377\362~\032\377\362"
+ 410      FFF27E1A 
+ 410      FFF27E1A 
+ 410      FFF27E1A 
+ 410      FFF2
+ 411 1709 7E1AFFF2 		.ascii	"~\032\377\362\177\032\377\362\177\033\377\362\177\033\377\363"
+ 411      7F1AFFF2 
+ 411      7F1BFFF2 
+ 411      7F1BFFF3 
+ 412 1719 7F1BFFF3 		.ascii	"\177\033\377\363\200\033\377\363\200\033\377\367\210\037\377"
+ 412      801BFFF3 
+ 412      801BFFF7 
+ 412      881FFF
+ 413 1728 F78920FF 		.ascii	"\367\211 \377\367\211 \377\367\211 \377\367\211 \377\367\212"
+ 413      F78920FF 
+ 413      F78920FF 
+ 413      F78920FF 
+ 413      F78A
+ 414 173a 20FFF78A 		.ascii	" \377\367\212 \377\367\212 \377\367\212 \377\370\213!\377\370"
+ 414      20FFF78A 
+ 414      20FFF78A 
+ 414      20FFF88B 
+ 414      21FFF8
+ 415 174d 8B21FFF8 		.ascii	"\213!\377\370\213!\377\370\213!\377\370\214!\377\370\214!\377"
+ 415      8B21FFF8 
+ 415      8B21FFF8 
+ 415      8C21FFF8 
+ 415      8C21FF
+ 416 1760 F88C21FF 		.ascii	"\370\214!\377\370\214\"\377\370\215\"\377\371\215\"\377\371\215"
+ 416      F88C22FF 
+ 416      F88D22FF 
+ 416      F98D22FF 
+ 416      F98D
+ 417 1772 22FFF98D 		.ascii	"\"\377\371\215\"\377\371\216\"\377\371\216\"\377\371\216#\377"
+ 417      22FFF98E 
+ 417      22FFF98E 
+ 417      22FFF98E 
+ 417      23FF
+ 418 1784 F98E23FF 		.ascii	"\371\216#\377\371\217#\377\371\217#\377\372\217#\377\372\217"
+ 418      F98F23FF 
+ 418      F98F23FF 
+ 418      FA8F23FF 
+ 418      FA8F
+ 419 1796 23FFFA90 		.ascii	"#\377\372\220#\377\372\220#\377\372\220$\377\372\220$\377\372"
+ 419      23FFFA90 
+ 419      23FFFA90 
+ 419      24FFFA90 
+ 419      24FFFA
+ 420 17a9 9124FFFA 		.ascii	"\221$\377\372\221$\377\372\221$\377\372\221$\377\373\222$\377"
+ 420      9124FFFA 
+ 420      9124FFFA 
+ 420      9124FFFB 
+ 420      9224FF
+ 421 17bc FB9225FF 		.ascii	"\373\222%\377\373\222%\377\373\222%\377\373\223%\377\373\223"
+ 421      FB9225FF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 30
+
+
+ 421      FB9225FF 
+ 421      FB9325FF 
+ 421      FB93
+ 422 17ce 25FFFB93 		.ascii	"%\377\373\223%\377\373\223&\377\373\224&\377\374\224&\377\374"
+ 422      25FFFB93 
+ 422      26FFFB94 
+ 422      26FFFC94 
+ 422      26FFFC
+ 423 17e1 9426FFFC 		.ascii	"\224&\377\374\224&\377\374\225&\377\374\225&\377"
+ 423      9426FFFC 
+ 423      9526FFFC 
+ 423      9526FF
+ 424 17f0 FC9527FF 		.ascii	"\374\225'\377\374\225'\377\374\226'\377\374\226'\377\375\226"
+ 424      FC9527FF 
+ 424      FC9627FF 
+ 424      FC9627FF 
+ 424      FD96
+ 425 1802 27FFFD96 		.ascii	"'\377\375\226'\377\375\227'\377\375\227(\377\375\227(\377\375"
+ 425      27FFFD97 
+ 425      27FFFD97 
+ 425      28FFFD97 
+ 425      28FFFD
+ 426 1815 9728FFFD 		.ascii	"\227(\377\375\230(\377\375\230(\377\375\230(\377\375\231(\377"
+ 426      9828FFFD 
+ 426      9828FFFD 
+ 426      9828FFFD 
+ 426      9928FF
+ 427 1828 FE9929FF 		.ascii	"\376\231)\377\376\231)\377\376\231)\377\376\232)\377\376\232"
+ 427      FE9929FF 
+ 427      FE9929FF 
+ 427      FE9A29FF 
+ 427      FE9A
+ 428 183a 29FFFE9A 		.ascii	")\377\376\232*\377\376\232*\377\376\233*\377\376\233*\377\376"
+ 428      2AFFFE9A 
+ 428      2AFFFE9B 
+ 428      2AFFFE9B 
+ 428      2AFFFE
+ 429 184d 9B2AFFFE 		.ascii	"\233*\377\376\234+\377\376\234+\377\376\234+\377\376\234+\377"
+ 429      9C2BFFFE 
+ 429      9C2BFFFE 
+ 429      9C2BFFFE 
+ 429      9C2BFF
+ 430 1860 FE9D2BFF 		.ascii	"\376\235+\377\376\235,\377\376\235,\377\376\236,\377\376\236"
+ 430      FE9D2CFF 
+ 430      FE9D2CFF 
+ 430      FE9E2CFF 
+ 430      FE9E
+ 431 1872 2CFFFE9E 		.ascii	",\377\376\236-\377\376\236-\377\376\237-\377\376\237-\377\376"
+ 431      2DFFFE9E 
+ 431      2DFFFE9F 
+ 431      2DFFFE9F 
+ 431      2DFFFE
+ 432 1885 9F2DFFFE 		.ascii	"\237-\377\376\240.\377\376\240.\377\376\240.\377\376\240.\377"
+ 432      A02EFFFE 
+ 432      A02EFFFE 
+ 432      A02EFFFE 
+ 432      A02EFF
+GAS LISTING /tmp/ccoFiSH1.s 			page 31
+
+
+ 433 1898 FEA12EFF 		.ascii	"\376\241.\377\376\241/\377\376\241/\377\376\241/\377\376\242"
+ 433      FEA12FFF 
+ 433      FEA12FFF 
+ 433      FEA12FFF 
+ 433      FEA2
+ 434 18aa 2FFFFEA2 		.ascii	"/\377\376\2420\377\376\2420\377\376\2430\377\376\2430\377\376"
+ 434      30FFFEA2 
+ 434      30FFFEA3 
+ 434      30FFFEA3 
+ 434      30FFFE
+ 435 18bd A330FFFE 		.ascii	"\2430\377\376\2431\377\376\2441\377\376\2441\377\376\2441\377"
+ 435      A331FFFE 
+ 435      A431FFFE 
+ 435      A431FFFE 
+ 435      A431FF
+ 436 18d0 FEA532FF 		.ascii	"\376\2452\377\376\2452\377\376\2452\377\376\2452\377\376\246"
+ 436      FEA532FF 
+ 436      FEA532FF 
+ 436      FEA532FF 
+ 436      FEA6
+ 437 18e2 32FFFEA6 		.ascii	"2\377\376\2463\377\376\2463\377\376\2463\377\376\2473\377\376"
+ 437      33FFFEA6 
+ 437      33FFFEA6 
+ 437      33FFFEA7 
+ 437      33FFFE
+ 438 18f5 A734FFFE 		.ascii	"\2474\377\376\2474\377\376\2504\377\376\2504\377\376\2505\377"
+ 438      A734FFFE 
+ 438      A834FFFE 
+ 438      A834FFFE 
+ 438      A835FF
+ 439 1908 FEA835FF 		.ascii	"\376\2505\377\376\2515\377\376\2515\377\376\2515\377\376\251"
+ 439      FEA935FF 
+ 439      FEA935FF 
+ 439      FEA935FF 
+ 439      FEA9
+ 440 191a 36FFFEAA 		.ascii	"6\377\376\2526\377\376\2526\377\376\263>\377\376\263>\377\376"
+ 440      36FFFEAA 
+ 440      36FFFEB3 
+ 440      3EFFFEB3 
+ 440      3EFFFE
+ 441 192d B33EFFFE 		.ascii	"\263>\377\376\264?\377\376\264?\377\376\264?\377\376\264?\377"
+ 441      B43FFFFE 
+ 441      B43FFFFE 
+ 441      B43FFFFE 
+ 441      B43FFF
+ 442 1940 FEB540FF 		.ascii	"\376\265@\377\376\265@\377\376\265@\377\376\265@\377\376\266"
+ 442      FEB540FF 
+ 442      FEB540FF 
+ 442      FEB540FF 
+ 442      FEB6
+ 443 1952 41FFFEB6 		.ascii	"A\377\376\266A\377\376\266A\377\376\267A\377\376\267B\377\376"
+ 443      41FFFEB6 
+ 443      41FFFEB7 
+ 443      41FFFEB7 
+ 443      42FFFE
+ 444 1965 B742FFFE 		.ascii	"\267B\377\376\267B\377\376\270B\377\376\270C\377\376\270C\377"
+ 444      B742FFFE 
+GAS LISTING /tmp/ccoFiSH1.s 			page 32
+
+
+ 444      B842FFFE 
+ 444      B843FFFE 
+ 444      B843FF
+ 445 1978 FEB843FF 		.ascii	"\376\270C\377\376\271C\377\376\271D\377\376\271D\377\376\271"
+ 445      FEB943FF 
+ 445      FEB944FF 
+ 445      FEB944FF 
+ 445      FEB9
+ 446 198a 44FFFEBA 		.ascii	"D\377\376\272D\377\376\272E\377\376\272E\377\376\272E\377\376"
+ 446      44FFFEBA 
+ 446      45FFFEBA 
+ 446      45FFFEBA 
+ 446      45FFFE
+ 447 199d BB45FFFE 		.ascii	"\273E\377\376\273F\377\376\273F\377\376\274F\377\376\274F\377"
+ 447      BB46FFFE 
+ 447      BB46FFFE 
+ 447      BC46FFFE 
+ 447      BC46FF
+ 448 19b0 FEBC47FF 		.ascii	"\376\274G\377\376\274G\377\376\275G\377\376\275H\377\376\275"
+ 448      FEBC47FF 
+ 448      FEBD47FF 
+ 448      FEBD48FF 
+ 448      FEBD
+ 449 19c2 48FFFEBD 		.ascii	"H\377\376\275H\377\376\276H\377\376\276I\377\376\276I\377\376"
+ 449      48FFFEBE 
+ 449      48FFFEBE 
+ 449      49FFFEBE 
+ 449      49FFFE
+ 450 19d5 BE49FFFE 		.ascii	"\276I\377\376\277I\377\376\277J\377\376\277J\377\376\277J\377"
+ 450      BF49FFFE 
+ 450      BF4AFFFE 
+ 450      BF4AFFFE 
+ 450      BF4AFF
+ 451 19e8 FEC04AFF 		.ascii	"\376\300J\377\376\300K\377\376\300K\377\376\300K\377\376\301"
+ 451      FEC04BFF 
+ 451      FEC04BFF 
+ 451      FEC04BFF 
+ 451      FEC1
+ 452 19fa 4CFFFEC1 		.ascii	"L\377\376\301L\377\376\301L\377\375\301L\377\375\302M\377\375"
+ 452      4CFFFEC1 
+ 452      4CFFFDC1 
+ 452      4CFFFDC2 
+ 452      4DFFFD
+ 453 1a0d C24DFFFD 		.ascii	"\302M\377\375\302M\377\375\302M\377\375\303N\377\375\303N\377"
+ 453      C24DFFFD 
+ 453      C24DFFFD 
+ 453      C34EFFFD 
+ 453      C34EFF
+ 454 1a20 FDC34EFF 		.ascii	"\375\303N\377\375\304N\377\375\304O\377\375\304O\377\375\304"
+ 454      FDC44EFF 
+ 454      FDC44FFF 
+ 454      FDC44FFF 
+ 454      FDC4
+ 455 1a32 50FFFDC4 		.ascii	"P\377\375\304P\377\375\305Q\377\375\305Q\377\375\305Q\377\375"
+ 455      50FFFDC5 
+ 455      51FFFDC5 
+ 455      51FFFDC5 
+GAS LISTING /tmp/ccoFiSH1.s 			page 33
+
+
+ 455      51FFFD
+ 456 1a45 C552FFFD 		.ascii	"\305R\377\375\305R\377\375\306S\377\375\306S\377\375\306T\377"
+ 456      C552FFFD 
+ 456      C653FFFD 
+ 456      C653FFFD 
+ 456      C654FF
+ 457 1a58 FDC654FF 		.ascii	"\375\306T\377\375\306T\377\375\307U\377\375\307U\377\375\307"
+ 457      FDC654FF 
+ 457      FDC755FF 
+ 457      FDC755FF 
+ 457      FDC7
+ 458 1a6a 56FFFDC7 		.ascii	"V\377\375\307V\377\375\307V\377\375\310W\377\375\310W\377\375"
+ 458      56FFFDC7 
+ 458      56FFFDC8 
+ 458      57FFFDC8 
+ 458      57FFFD
+ 459 1a7d C858FFFD 		.ascii	"\310X\377\375\310X\377\375\310Y\377\375\311Y\377\375\311Y\377"
+ 459      C858FFFD 
+ 459      C859FFFD 
+ 459      C959FFFD 
+ 459      C959FF
+ 460 1a90 FDC95AFF 		.ascii	"\375\311Z\377\375\311Z\377\375\311[\377\375\312[\377\375\312"
+ 460      FDC95AFF 
+ 460      FDC95BFF 
+ 460      FDCA5BFF 
+ 460      FDCA
+ 461 1aa2 5BFFFDCA 		.ascii	"[\377\375\312\\\377\375\312\\\377\375\312]\377\375\313]\377\375"
+ 461      5CFFFDCA 
+ 461      5CFFFDCA 
+ 461      5DFFFDCB 
+ 461      5DFFFD
+ 462 1ab5 CB5EFFFD 		.ascii	"\313^\377\375\313^\377\375\313^\377\375\313_\377\375\314_\377"
+ 462      CB5EFFFD 
+ 462      CB5EFFFD 
+ 462      CB5FFFFD 
+ 462      CC5FFF
+ 463 1ac8 FDCC60FF 		.ascii	"\375\314`\377\375\314`\377\375\314`\377\375\314a\377\375\315"
+ 463      FDCC60FF 
+ 463      FDCC60FF 
+ 463      FDCC61FF 
+ 463      FDCD
+ 464 1ada 61FFFDCD 		.ascii	"a\377\375\315b\377\375\315b\377\375\315b\377\375\315c\377\375"
+ 464      62FFFDCD 
+ 464      62FFFDCD 
+ 464      62FFFDCD 
+ 464      63FFFD
+ 465 1aed CE63FFFD 		.ascii	"\316c\377\375\316d\377\375\316d\377\375\316e\377\375\316e\377"
+ 465      CE64FFFD 
+ 465      CE64FFFD 
+ 465      CE65FFFD 
+ 465      CE65FF
+ 466 1b00 FDCF65FF 		.ascii	"\375\317e\377\375\317f\377\375\317f\377\375\317g\377\375\317"
+ 466      FDCF66FF 
+ 466      FDCF66FF 
+ 466      FDCF67FF 
+ 466      FDCF
+ 467 1b12 67FFFDD0 		.ascii	"g\377\375\320g\377\375\320h\377\375\320h\377\375\320i\377\375"
+GAS LISTING /tmp/ccoFiSH1.s 			page 34
+
+
+ 467      67FFFDD0 
+ 467      68FFFDD0 
+ 467      68FFFDD0 
+ 467      69FFFD
+ 468 1b25 D776FFFD 		.ascii	"\327v\377\375\327w\377\375\327w\377\375\327w\377\375\327x\377"
+ 468      D777FFFD 
+ 468      D777FFFD 
+ 468      D777FFFD 
+ 468      D778FF
+ 469 1b38 FDD778FF 		.ascii	"\375\327x\377\375\330y\377\375\330y\377\375\330z\377\375\330"
+ 469      FDD879FF 
+ 469      FDD879FF 
+ 469      FDD87AFF 
+ 469      FDD8
+ 470 1b4a 7AFFFDD8 		.ascii	"z\377\375\330z\377\375\331{\377\375\331{\377\375\331|\377\375"
+ 470      7AFFFDD9 
+ 470      7BFFFDD9 
+ 470      7BFFFDD9 
+ 470      7CFFFD
+ 471 1b5d D97CFFFD 		.ascii	"\331|\377\375\331|\377\375\332}\377\375\332}\377\375\332~\377"
+ 471      D97CFFFD 
+ 471      DA7DFFFD 
+ 471      DA7DFFFD 
+ 471      DA7EFF
+ 472 1b70 FDDA7EFF 		.ascii	"\375\332~\377\375\332~\377\375\333\177\377\375\333\177\377\375"
+ 472      FDDA7EFF 
+ 472      FDDB7FFF 
+ 472      FDDB7FFF 
+ 472      FD
+ 473 1b81 DB80FFFD 		.ascii	"\333\200\377\375\333\200\377\375\333\200\377\375\333\201\377"
+ 473      DB80FFFD 
+ 473      DB80FFFD 
+ 473      DB81FF
+ 474 1b90 FDDC81FF 		.ascii	"\375\334\201\377\375\334\202\377\375\334\202\377\375\334\203"
+ 474      FDDC82FF 
+ 474      FDDC82FF 
+ 474      FDDC83
+ 475 1b9f FFFDDC83 		.ascii	"\377\375\334\203\377\375\335\203\377\375\335\204\377\375\335"
+ 475      FFFDDD83 
+ 475      FFFDDD84 
+ 475      FFFDDD
+ 476 1bae 84FFFDDD 		.ascii	"\204\377\375\335\205\377\375\335\205\377\375\336\205\377\375"
+ 476      85FFFDDD 
+ 476      85FFFDDE 
+ 476      85FFFD
+ 477 1bbd DE86FFFD 		.ascii	"\336\206\377\375\336\206\377\375\336\207\377\375\336\207\377"
+ 477      DE86FFFD 
+ 477      DE87FFFD 
+ 477      DE87FF
+ 478 1bcc FDDE87FF 		.ascii	"\375\336\207\377\375\337\210\377\375\337\210\377\375\337\211"
+ 478      FDDF88FF 
+ 478      FDDF88FF 
+ 478      FDDF89
+ 479 1bdb FFFDDF89 		.ascii	"\377\375\337\211\377\375\337\212\377\375\340\212\377\375\340"
+ 479      FFFDDF8A 
+ 479      FFFDE08A 
+ 479      FFFDE0
+GAS LISTING /tmp/ccoFiSH1.s 			page 35
+
+
+ 480 1bea 8AFFFDE0 		.ascii	"\212\377\375\340\213\377\375\340\213\377\375\340\214\377\375"
+ 480      8BFFFDE0 
+ 480      8BFFFDE0 
+ 480      8CFFFD
+ 481 1bf9 E18CFFFD 		.ascii	"\341\214\377\375\341\214\377\375\341\215\377\375\341\215\377"
+ 481      E18CFFFD 
+ 481      E18DFFFD 
+ 481      E18DFF
+ 482 1c08 FDE18EFF 		.ascii	"\375\341\216\377\375\341\216\377\375\342\216\377\375\342\217"
+ 482      FDE18EFF 
+ 482      FDE28EFF 
+ 482      FDE28F
+ 483 1c17 FFFDE28F 		.ascii	"\377\375\342\217\377\375\342\220\377\375\342\220\377\375\343"
+ 483      FFFDE290 
+ 483      FFFDE290 
+ 483      FFFDE3
+ 484 1c26 90FFFDE3 		.ascii	"\220\377\375\343\221\377\375\343\221\377\375\343\221\377\375"
+ 484      91FFFDE3 
+ 484      91FFFDE3 
+ 484      91FFFD
+ 485 1c35 E392FFFD 		.ascii	"\343\222\377\375\343\222\377\375\343\222\377\375\343\222\377"
+ 485      E392FFFD 
+ 485      E392FFFD 
+ 485      E392FF
+ 486 1c44 FDE493FF 		.ascii	"\375\344\223\377\375\344\223\377\375\344\223\377\375\344\223"
+ 486      FDE493FF 
+ 486      FDE493FF 
+ 486      FDE493
+ 487 1c53 FFFDE494 		.ascii	"\377\375\344\224\377\375\344\224\377\375\344\224\377\375\344"
+ 487      FFFDE494 
+ 487      FFFDE494 
+ 487      FFFDE4
+ 488 1c62 94FFFDE5 		.ascii	"\224\377\375\345\225\377\375\345\225\377\375\345\225\377\375"
+ 488      95FFFDE5 
+ 488      95FFFDE5 
+ 488      95FFFD
+ 489 1c71 E596FFFD 		.ascii	"\345\226\377\375\345\226\377\375\345\226\377\375\345\226\377"
+ 489      E596FFFD 
+ 489      E596FFFD 
+ 489      E596FF
+ 490 1c80 FDE697FF 		.ascii	"\375\346\227\377\375\346\227\377\375\346\227\377\375\346\227"
+ 490      FDE697FF 
+ 490      FDE697FF 
+ 490      FDE697
+ 491 1c8f FFFDE698 		.ascii	"\377\375\346\230\377\375\346\230\377\375\346\230\377\375\346"
+ 491      FFFDE698 
+ 491      FFFDE698 
+ 491      FFFDE6
+ 492 1c9e 98FFFDE7 		.ascii	"\230\377\375\347\231\377\375\347\231\377\375\347\231\377\375"
+ 492      99FFFDE7 
+ 492      99FFFDE7 
+ 492      99FFFD
+ 493 1cad E79AFFFD 		.ascii	"\347\232\377\375\347\232\377\375\347\232\377\375\347\232\377"
+ 493      E79AFFFD 
+ 493      E79AFFFD 
+ 493      E79AFF
+ 494 1cbc FDE79BFF 		.ascii	"\375\347\233\377\375\350\233\377\375\350\233\377\375\350\233"
+GAS LISTING /tmp/ccoFiSH1.s 			page 36
+
+
+ 494      FDE89BFF 
+ 494      FDE89BFF 
+ 494      FDE89B
+ 495 1ccb FFFDE89C 		.ascii	"\377\375\350\234\377\375\350\234\377\375\350\234\377\375\350"
+ 495      FFFDE89C 
+ 495      FFFDE89C 
+ 495      FFFDE8
+ 496 1cda 9CFFFDE8 		.ascii	"\234\377\375\350\235\377\375\351\235\377\375\351\235\377\375"
+ 496      9DFFFDE9 
+ 496      9DFFFDE9 
+ 496      9DFFFD
+ 497 1ce9 E99EFFFD 		.ascii	"\351\236\377\375\351\236\377\375\351\236\377\375\351\236\377"
+ 497      E99EFFFD 
+ 497      E99EFFFD 
+ 497      E99EFF
+ 498 1cf8 FDE99FFF 		.ascii	"\375\351\237\377\375\351\237\377\375\352\237\377\375\352\237"
+ 498      FDE99FFF 
+ 498      FDEA9FFF 
+ 498      FDEA9F
+ 499 1d07 FFFDEAA0 		.ascii	"\377\375\352\240\377\375\352\240\377\375\352\240\377\375\352"
+ 499      FFFDEAA0 
+ 499      FFFDEAA0 
+ 499      FFFDEA
+ 500 1d16 A0FFFDEA 		.ascii	"\240\377\375\352\241\377\375\352\241\377\375\353\241\377\376"
+ 500      A1FFFDEA 
+ 500      A1FFFDEB 
+ 500      A1FFFE
+ 501 1d25 EFAAFFFE 		.ascii	"\357\252\377\376\357\252\377\376\357\253\377\376\357\253\377"
+ 501      EFAAFFFE 
+ 501      EFABFFFE 
+ 501      EFABFF
+ 502 1d34 FEEFABFF 		.ascii	"\376\357\253\377\376\357\254\377\376\357\254\377\376\360\254"
+ 502      FEEFACFF 
+ 502      FEEFACFF 
+ 502      FEF0AC
+ 503 1d43 FFFEF0AC 		.ascii	"\377\376\360\254\377\376\360\255\377\376\360\255\377\376\360"
+ 503      FFFEF0AD 
+ 503      FFFEF0AD 
+ 503      FFFEF0
+ 504 1d52 ADFFFEF0 		.ascii	"\255\377\376\360\255\377\376\360\256\377\376\360\256\377\376"
+ 504      ADFFFEF0 
+ 504      AEFFFEF0 
+ 504      AEFFFE
+ 505 1d61 F1AEFFFE 		.ascii	"\361\256\377\376\361\256\377\376\361\257\377\376\361\257\377"
+ 505      F1AEFFFE 
+ 505      F1AFFFFE 
+ 505      F1AFFF
+ 506 1d70 FEF1AFFF 		.ascii	"\376\361\257\377\376\361\260\377\376\361\260\377\376\361\260"
+ 506      FEF1B0FF 
+ 506      FEF1B0FF 
+ 506      FEF1B0
+ 507 1d7f FFFEF2B0 		.ascii	"\377\376\362\260\377\376\362\261\377\376\362\261\377\376\362"
+ 507      FFFEF2B1 
+ 507      FFFEF2B1 
+ 507      FFFEF2
+ 508 1d8e B1FFFEF2 		.ascii	"\261\377\376\362\261\377\376\362\262\377\376\362\262\377\376"
+ 508      B1FFFEF2 
+GAS LISTING /tmp/ccoFiSH1.s 			page 37
+
+
+ 508      B2FFFEF2 
+ 508      B2FFFE
+ 509 1d9d F2B2FFFE 		.ascii	"\362\262\377\376\363\263\377\376\363\263\377\376\363\263\377"
+ 509      F3B3FFFE 
+ 509      F3B3FFFE 
+ 509      F3B3FF
+ 510 1dac FEF3B3FF 		.ascii	"\376\363\263\377\376\363\264\377\376\363\264\377\376\363\264"
+ 510      FEF3B4FF 
+ 510      FEF3B4FF 
+ 510      FEF3B4
+ 511 1dbb FFFEF3B4 		.ascii	"\377\376\363\264\377\376\364\265\377\376\364\265\377\376\364"
+ 511      FFFEF4B5 
+ 511      FFFEF4B5 
+ 511      FFFEF4
+ 512 1dca B5FFFEF4 		.ascii	"\265\377\376\364\266\377\376\364\266\377\376\364\266\377\376"
+ 512      B6FFFEF4 
+ 512      B6FFFEF4 
+ 512      B6FFFE
+ 513 1dd9 F4B6FFFE 		.ascii	"\364\266\377\376\364\267\377\376\364\267\377\376\365\267\377"
+ 513      F4B7FFFE 
+ 513      F4B7FFFE 
+ 513      F5B7FF
+ 514 1de8 FEF5B7FF 		.ascii	"\376\365\267\377\376\365\270\377\376\365\270\377\376\365\270"
+ 514      FEF5B8FF 
+ 514      FEF5B8FF 
+ 514      FEF5B8
+ 515 1df7 FFFEF5B9 		.ascii	"\377\376\365\271\377\376\365\271\377\376\365\271\377\376\366"
+ 515      FFFEF5B9 
+ 515      FFFEF5B9 
+ 515      FFFEF6
+ 516 1e06 B9FFFEF6 		.ascii	"\271\377\376\366\272\377\376\366\272\377\376\366\272\377\376"
+ 516      BAFFFEF6 
+ 516      BAFFFEF6 
+ 516      BAFFFE
+ 517 1e15 F6BAFFFE 		.ascii	"\366\272\377\376\366\273\377\376\366\273\377\376\366\273\377"
+ 517      F6BBFFFE 
+ 517      F6BBFFFE 
+ 517      F6BBFF
+ 518 1e24 FEF7BBFF 		.ascii	"\376\367\273\377\376\367\274\377\376\367\274\377\376\367\274"
+ 518      FEF7BCFF 
+ 518      FEF7BCFF 
+ 518      FEF7BC
+ 519 1e33 FFFEF7BD 		.ascii	"\377\376\367\275\377\376\367\275\377\376\367\275\377\376\367"
+ 519      FFFEF7BD 
+ 519      FFFEF7BD 
+ 519      FFFEF7
+ 520 1e42 BDFFFEF7 		.ascii	"\275\377\376\367\276\377\376\367\276\377\376\367\276\377\376"
+ 520      BEFFFEF7 
+ 520      BEFFFEF7 
+ 520      BEFFFE
+ 521 1e51 F7BEFFFE 		.ascii	"\367\276\377\376\367\277\377\376\367\277\377\376\367\277\377"
+ 521      F7BFFFFE 
+ 521      F7BFFFFE 
+ 521      F7BFFF
+ 522 1e60 FEF7BFFF 		.ascii	"\376\367\277\377\376\367\300\377\376\367\300\377\376\370\300"
+ 522      FEF7C0FF 
+ 522      FEF7C0FF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 38
+
+
+ 522      FEF8C0
+ 523 1e6f FFFEF8C0 		.ascii	"\377\376\370\300\377\376\370\301\377\376\370\301\377\376\370"
+ 523      FFFEF8C1 
+ 523      FFFEF8C1 
+ 523      FFFEF8
+ 524 1e7e C1FFFEF8 		.ascii	"\301\377\376\370\301\377\376\370\302\377\376\370\302\377\376"
+ 524      C1FFFEF8 
+ 524      C2FFFEF8 
+ 524      C2FFFE
+ 525 1e8d F8C2FFFE 		.ascii	"\370\302\377\376\370\303\377\376\370\303\377\376\370\303\377"
+ 525      F8C3FFFE 
+ 525      F8C3FFFE 
+ 525      F8C3FF
+ 526 1e9c FEF8C3FF 		.ascii	"\376\370\303\377\376\370\304\377\376\370\304\377\376\370\304"
+ 526      FEF8C4FF 
+ 526      FEF8C4FF 
+ 526      FEF8C4
+ 527 1eab FFFEF8C4 		.ascii	"\377\376\370\304\377\376\370\305\377\376\370\305\377\376\371"
+ 527      FFFEF8C5 
+ 527      FFFEF8C5 
+ 527      FFFEF9
+ 528 1eba C5FFFEF9 		.ascii	"\305\377\376\371\305\377\376\371\306\377\376\371\306\377\376"
+ 528      C5FFFEF9 
+ 528      C6FFFEF9 
+ 528      C6FFFE
+ 529 1ec9 F9C6FFFE 		.ascii	"\371\306\377\376\371\306\377\376\371\307\377\376\371\307\377"
+ 529      F9C6FFFE 
+ 529      F9C7FFFE 
+ 529      F9C7FF
+ 530 1ed8 FEF9C7FF 		.ascii	"\376\371\307\377\376\371\307\377\376\371\310\377\376\371\310"
+ 530      FEF9C7FF 
+ 530      FEF9C8FF 
+ 530      FEF9C8
+ 531 1ee7 FFFEF9C8 		.ascii	"\377\376\371\310\377\376\371\310\377\376\371\311\377\376\371"
+ 531      FFFEF9C8 
+ 531      FFFEF9C9 
+ 531      FFFEF9
+ 532 1ef6 C9FFFEF9 		.ascii	"\311\377\376\371\311\377\376\371\311\377\376\371\312\377\376"
+ 532      C9FFFEF9 
+ 532      C9FFFEF9 
+ 532      CAFFFE
+ 533 1f05 FACAFFFE 		.ascii	"\372\312\377\376\372\312\377\376\372\313\377\376\372\313\377"
+ 533      FACAFFFE 
+ 533      FACBFFFE 
+ 533      FACBFF
+ 534 1f14 FEFACBFF 		.ascii	"\376\372\313\377\376\372\313\377\376\372\314\377\376\372\314"
+ 534      FEFACBFF 
+ 534      FEFACCFF 
+ 534      FEFACC
+ 535 1f23 FFFEFCD4 		.ascii	"\377\376\374\324\377\376\374\325\377\376\374\325\377\376\374"
+ 535      FFFEFCD5 
+ 535      FFFEFCD5 
+ 535      FFFEFC
+ 536 1f32 D5FFFEFC 		.ascii	"\325\377\376\374\325\377\376\374\326\377\376\374\326\377\376"
+ 536      D5FFFEFC 
+ 536      D6FFFEFC 
+ 536      D6FFFE
+GAS LISTING /tmp/ccoFiSH1.s 			page 39
+
+
+ 537 1f41 FCD6FFFE 		.ascii	"\374\326\377\376\374\326\377\376\374\327\377\376\374\327\377"
+ 537      FCD6FFFE 
+ 537      FCD7FFFE 
+ 537      FCD7FF
+ 538 1f50 FEFCD7FF 		.ascii	"\376\374\327\377\376\374\327\377\376\374\330\377\376\374\330"
+ 538      FEFCD7FF 
+ 538      FEFCD8FF 
+ 538      FEFCD8
+ 539 1f5f FFFEFCD8 		.ascii	"\377\376\374\330\377\376\374\330\377\376\374\331\377\376\374"
+ 539      FFFEFCD8 
+ 539      FFFEFCD9 
+ 539      FFFEFC
+ 540 1f6e D9FFFEFC 		.ascii	"\331\377\376\374\331\377\376\375\331\377\376\375\332\377\376"
+ 540      D9FFFEFD 
+ 540      D9FFFEFD 
+ 540      DAFFFE
+ 541 1f7d FDDAFFFE 		.ascii	"\375\332\377\376\375\332\377\376\375\332\377\376\375\333\377"
+ 541      FDDAFFFE 
+ 541      FDDAFFFE 
+ 541      FDDBFF
+ 542 1f8c FEFDDBFF 		.ascii	"\376\375\333\377\376\375\333\377\376\375\333\377\376\375\334"
+ 542      FEFDDBFF 
+ 542      FEFDDBFF 
+ 542      FEFDDC
+ 543 1f9b FFFEFDDC 		.ascii	"\377\376\375\334\377\376\375\334\377\376\375\334\377\376\375"
+ 543      FFFEFDDC 
+ 543      FFFEFDDC 
+ 543      FFFEFD
+ 544 1faa DDFFFEFD 		.ascii	"\335\377\376\375\335\377\376\375\335\377\376\375\335\377\376"
+ 544      DDFFFEFD 
+ 544      DDFFFEFD 
+ 544      DDFFFE
+ 545 1fb9 FDDEFFFE 		.ascii	"\375\336\377\376\375\336\377"
+ 545      FDDEFF
+ 546 1fc0 FEFDDEFF 		.ascii	"\376\375\336\377\376\375\336\377\376\375\337\377\376\376\337"
+ 546      FEFDDEFF 
+ 546      FEFDDFFF 
+ 546      FEFEDF
+ 547 1fcf FFFEFEDF 		.ascii	"\377\376\376\337\377\376\376\337\377\376\376\340\377\376\376"
+ 547      FFFEFEDF 
+ 547      FFFEFEE0 
+ 547      FFFEFE
+ 548 1fde E0FFFEFE 		.ascii	"\340\377\376\376\340\377\376\376\340\377\376\376\341\377\376"
+ 548      E0FFFEFE 
+ 548      E0FFFEFE 
+ 548      E1FFFE
+ 549 1fed FEE1FFFE 		.ascii	"\376\341\377\376\376\341\377\376\376\341\377\376\376\342\377"
+ 549      FEE1FFFE 
+ 549      FEE1FFFE 
+ 549      FEE2FF
+ 550 1ffc FEFEE2FF 		.ascii	"\376\376\342\377\376\376\342\377\376\376\342\377\376\376\343"
+ 550      FEFEE2FF 
+ 550      FEFEE2FF 
+ 550      FEFEE3
+ 551 200b FFFEFEE3 		.ascii	"\377\376\376\343\377\376\376\343\377\376\376\343\377\376\376"
+ 551      FFFEFEE3 
+ 551      FFFEFEE3 
+GAS LISTING /tmp/ccoFiSH1.s 			page 40
+
+
+ 551      FFFEFE
+ 552 201a E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377"
+ 552      E4FFFEFE 
+ 552      E4FF
+ 553              		.globl	heatmap_cs_YlOrBr_soft
+ 554              		.section	.data.rel.local
+ 555              		.align 8
+ 556              		.type	heatmap_cs_YlOrBr_soft, @object
+ 557              		.size	heatmap_cs_YlOrBr_soft, 8
+ 558              	heatmap_cs_YlOrBr_soft:
+ 559 0010 00000000 		.quad	soft
+ 559      00000000 
+ 560              		.section	.data.rel.ro.local
+ 561              		.align 16
+ 562              		.type	soft, @object
+ 563              		.size	soft, 16
+ 564              	soft:
+ 565 0020 00000000 		.quad	soft_data
+ 565      00000000 
+ 566 0028 01040000 		.quad	1025
+ 566      00000000 
+ 567              		.section	.rodata
+ 568 2024 00000000 		.align 32
+ 568      00000000 
+ 568      00000000 
+ 568      00000000 
+ 568      00000000 
+ 569              		.type	soft_data, @object
+ 570              		.size	soft_data, 4100
+ 571              	soft_data:
+ 572 2040 00       		.string	""
+ 573 2041 00       		.string	""
+ 574 2042 00       		.string	""
+ 575 2043 00       		.string	""
+ 576 2044 65250500 		.string	"e%\005"
+ 577 2048 66250607 		.ascii	"f%\006\007f%\006\016g%\006\026g%\006\035g%\006%h%\006,h%\006"
+ 577      6625060E 
+ 577      67250616 
+ 577      6725061D 
+ 577      67250625 
+ 578 2063 34692506 		.ascii	"4i%\006;i&\006Ci&\006Jj&\006Rj&\006Yj&\006ak&\006hk&\006pl&\006"
+ 578      3B692606 
+ 578      43692606 
+ 578      4A6A2606 
+ 578      526A2606 
+ 579 2087 776C2706 		.ascii	"wl'\006\177l'\006\206m'\006\215m'\006\225n'\006\234n'\006\244"
+ 579      7F6C2706 
+ 579      866D2706 
+ 579      8D6D2706 
+ 579      956E2706 
+ 580 20a0 6E2706AB 		.ascii	"n'\006\253o'\006\263o'\006\272p(\006\302p(\006\311p(\006\321"
+ 580      6F2706B3 
+ 580      6F2706BA 
+ 580      702806C2 
+ 580      702806C9 
+ 581 20b8 712806D8 		.ascii	"q(\006\330q(\006\340q(\006\347r(\006\357r(\006\366s(\006\376"
+ 581      712806E0 
+GAS LISTING /tmp/ccoFiSH1.s 			page 41
+
+
+ 581      712806E7 
+ 581      722806EF 
+ 581      722806F6 
+ 582 20d0 732906FF 		.ascii	"s)\006\377s)\006\377t)\006\377t)\006\377u)\006\377u)\006\377"
+ 582      732906FF 
+ 582      742906FF 
+ 582      742906FF 
+ 582      752906FF 
+ 583 20e8 752906FF 		.ascii	"u)\006\377v)\006\377v*\006\377w*\006\377w*\006\377w*\006\377"
+ 583      762906FF 
+ 583      762A06FF 
+ 583      772A06FF 
+ 583      772A06FF 
+ 584 2100 782A06FF 		.ascii	"x*\006\377x*\006\377y*\006\377y*\006\377y*\006\377z+\006\377"
+ 584      782A06FF 
+ 584      792A06FF 
+ 584      792A06FF 
+ 584      792A06FF 
+ 585 2118 7A2B06FF 		.ascii	"z+\006\377{+\006\377{+\006\377{+\006\377|+\006\377|+\006\377"
+ 585      7B2B06FF 
+ 585      7B2B06FF 
+ 585      7B2B06FF 
+ 585      7C2B06FF 
+ 586 2130 7D2B06FF 		.ascii	"}+\006\377},\006\377},\006\377~,\006\377~,\005\377\177,\005\377"
+ 586      7D2C06FF 
+ 586      7D2C06FF 
+ 586      7E2C06FF 
+ 586      7E2C05FF 
+ 587 2148 7F2C05FF 		.ascii	"\177,\005\377\177,\005\377\200,\005\377\200,\005\377\201-\005"
+ 587      7F2C05FF 
+ 587      802C05FF 
+ 587      802C05FF 
+ 587      812D05
+ 588 215b FF812D05 		.ascii	"\377\201-\005\377\201-\005\377\202-\005\377\202-\005\377\203"
+ 588      FF812D05 
+ 588      FF822D05 
+ 588      FF822D05 
+ 588      FF83
+ 589 216d 2D05FF83 		.ascii	"-\005\377\203-\005\377\203-\005\377\204.\005\377\204.\005\377"
+ 589      2D05FF83 
+ 589      2D05FF84 
+ 589      2E05FF84 
+ 589      2E05FF
+ 590 2180 852E05FF 		.ascii	"\205.\005\377\205.\005\377\205.\005\377\206.\005\377\206.\005"
+ 590      852E05FF 
+ 590      852E05FF 
+ 590      862E05FF 
+ 590      862E05
+ 591 2193 FF872E05 		.ascii	"\377\207.\005\377\207.\005\377\207/\005\377\210/\005\377\210"
+ 591      FF872E05 
+ 591      FF872F05 
+ 591      FF882F05 
+ 591      FF88
+ 592 21a5 2F05FF89 		.ascii	"/\005\377\211/\005\377\211/\005\377\211/\005\377\212/\005\377"
+ 592      2F05FF89 
+ 592      2F05FF89 
+ 592      2F05FF8A 
+GAS LISTING /tmp/ccoFiSH1.s 			page 42
+
+
+ 592      2F05FF
+ 593 21b8 8A2F05FF 		.ascii	"\212/\005\377\2130\005\377\2130\005\377\2130\005\377\2140\005"
+ 593      8B3005FF 
+ 593      8B3005FF 
+ 593      8B3005FF 
+ 593      8C3005
+ 594 21cb FF8C3005 		.ascii	"\377\2140\005\377\2150\005\377\2150\005\377\2150\004\377\216"
+ 594      FF8D3005 
+ 594      FF8D3005 
+ 594      FF8D3004 
+ 594      FF8E
+ 595 21dd 3004FF8E 		.ascii	"0\004\377\2161\004\377\2171\004\377\2171\004\377\2171\004\377"
+ 595      3104FF8F 
+ 595      3104FF8F 
+ 595      3104FF8F 
+ 595      3104FF
+ 596 21f0 903104FF 		.ascii	"\2201\004\377\2201\004\377\2211\004\377\2211\004\377\2222\004"
+ 596      903104FF 
+ 596      913104FF 
+ 596      913104FF 
+ 596      923204
+ 597 2203 FF923204 		.ascii	"\377\2222\004\377\2222\004\377\2232\004\377\2232\004\377\224"
+ 597      FF923204 
+ 597      FF933204 
+ 597      FF933204 
+ 597      FF94
+ 598 2215 3204FF94 		.ascii	"2\004\377\2242\004\377\2242\004\377\2252\004\377\2253\004\377"
+ 598      3204FF94 
+ 598      3204FF95 
+ 598      3204FF95 
+ 598      3304FF
+ 599 2228 963304FF 		.ascii	"\2263\004\377\2263\004\377\2263\004\377\2273\004\377\2273\004"
+ 599      963304FF 
+ 599      963304FF 
+ 599      973304FF 
+ 599      973304
+ 600 223b FF983304 		.ascii	"\377\2303\004\377\2303\004\377\2304\003\377\2314\004\377\231"
+ 600      FF983304 
+ 600      FF983403 
+ 600      FF993404 
+ 600      FF99
+ 601 224d 3404FF9A 		.ascii	"4\004\377\2324\004\377\2324\004\377\2324\004\377\2335\004\377"
+ 601      3404FF9A 
+ 601      3404FF9A 
+ 601      3404FF9B 
+ 601      3504FF
+ 602 2260 9B3503FF 		.ascii	"\2335\003\377\2345\003\377\2345\003\377\2345\003\377\2355\003"
+ 602      9C3503FF 
+ 602      9C3503FF 
+ 602      9C3503FF 
+ 602      9D3503
+ 603 2273 FF9D3603 		.ascii	"\377\2356\003\377\2366\003\377\2366\003\377\2366\003\377\237"
+ 603      FF9E3603 
+ 603      FF9E3603 
+ 603      FF9E3603 
+ 603      FF9F
+ 604 2285 3603FF9F 		.ascii	"6\003\377\2377\003\377\2407\003\377\2407\003\377\2407\003\377"
+GAS LISTING /tmp/ccoFiSH1.s 			page 43
+
+
+ 604      3703FFA0 
+ 604      3703FFA0 
+ 604      3703FFA0 
+ 604      3703FF
+ 605 2298 A13703FF 		.ascii	"\2417\003\377\2417\003\377\2428\003\377\2428\003\377\2428\003"
+ 605      A13703FF 
+ 605      A23803FF 
+ 605      A23803FF 
+ 605      A23803
+ 606 22ab FFA33803 		.ascii	"\377\2438\003\377\2438\003\377\2439\003\377\2449\003\377\244"
+ 606      FFA33803 
+ 606      FFA33903 
+ 606      FFA43903 
+ 606      FFA4
+ 607 22bd 3903FFA5 		.ascii	"9\003\377\2459\003\377\2459\003\377\2459\003\377\246:\003\377"
+ 607      3903FFA5 
+ 607      3903FFA5 
+ 607      3903FFA6 
+ 607      3A03FF
+ 608 22d0 A63A03FF 		.ascii	"\246:\003\377\247:\003\377\247:\003\377\247:\003\377\250;\003"
+ 608      A73A03FF 
+ 608      A73A03FF 
+ 608      A73A03FF 
+ 608      A83B03
+ 609 22e3 FFA83B03 		.ascii	"\377\250;\003\377\251;\003\377\251;\003\377\251;\003\377\252"
+ 609      FFA93B03 
+ 609      FFA93B03 
+ 609      FFA93B03 
+ 609      FFAA
+ 610 22f5 3B03FFAA 		.ascii	";\003\377\252<\003\377\253<\003\377\253<\003\377\253<\003\377"
+ 610      3C03FFAB 
+ 610      3C03FFAB 
+ 610      3C03FFAB 
+ 610      3C03FF
+ 611 2308 AC3C03FF 		.ascii	"\254<\003\377\254=\003\377\255=\003\377\255=\003\377\255=\003"
+ 611      AC3D03FF 
+ 611      AD3D03FF 
+ 611      AD3D03FF 
+ 611      AD3D03
+ 612 231b FFAE3D03 		.ascii	"\377\256=\003\377\256>\003\377\257>\003\377\257>\003\377\257"
+ 612      FFAE3E03 
+ 612      FFAF3E03 
+ 612      FFAF3E03 
+ 612      FFAF
+ 613 232d 3E03FFB0 		.ascii	">\003\377\260>\003\377\260>\003\377\261?\003\377\261?\003\377"
+ 613      3E03FFB0 
+ 613      3E03FFB1 
+ 613      3F03FFB1 
+ 613      3F03FF
+ 614 2340 B13F03FF 		.ascii	"\261?\003\377\262?\003\377\262?\003\377\263@\003\377\263@\003"
+ 614      B23F03FF 
+ 614      B23F03FF 
+ 614      B34003FF 
+ 614      B34003
+ 615 2353 FFB34003 		.ascii	"\377\263@\003\377\264@\003\377\264@\003\377\265A\003\377\265"
+ 615      FFB44003 
+ 615      FFB44003 
+GAS LISTING /tmp/ccoFiSH1.s 			page 44
+
+
+ 615      FFB54103 
+ 615      FFB5
+ 616 2365 4103FFB5 		.ascii	"A\003\377\265A\003\377\266A\003\377\266A\003\377\267A\003\377"
+ 616      4103FFB6 
+ 616      4103FFB6 
+ 616      4103FFB7 
+ 616      4103FF
+ 617 2378 B74203FF 		.ascii	"\267B\003\377\267B\003\377\270B\003\377\270B\003\377\271B\003"
+ 617      B74203FF 
+ 617      B84203FF 
+ 617      B84203FF 
+ 617      B94203
+ 618 238b FFB94303 		.ascii	"\377\271C\003\377\271C\003\377\272C\003\377\272C\003\377\273"
+ 618      FFB94303 
+ 618      FFBA4303 
+ 618      FFBA4303 
+ 618      FFBB
+ 619 239d 4303FFBB 		.ascii	"C\003\377\273D\003\377\273D\003\377\274D\003\377\274D\003\377"
+ 619      4403FFBB 
+ 619      4403FFBC 
+ 619      4403FFBC 
+ 619      4403FF
+ 620 23b0 BD4403FF 		.ascii	"\275D\003\377\275E\003\377\275E\003\377\276E\003\377\276E\002"
+ 620      BD4503FF 
+ 620      BD4503FF 
+ 620      BE4503FF 
+ 620      BE4502
+ 621 23c3 FFBF4502 		.ascii	"\377\277E\002\377\277E\002\377\277F\002\377\300F\002\377\300"
+ 621      FFBF4502 
+ 621      FFBF4602 
+ 621      FFC04602 
+ 621      FFC0
+ 622 23d5 4602FFC1 		.ascii	"F\002\377\301F\002\377\301F\002\377\301G\002\377\302G\002\377"
+ 622      4602FFC1 
+ 622      4602FFC1 
+ 622      4702FFC2 
+ 622      4702FF
+ 623 23e8 C24702FF 		.ascii	"\302G\002\377\303G\002\377\303G\002\377\303H\002\377\304H\002"
+ 623      C34702FF 
+ 623      C34702FF 
+ 623      C34802FF 
+ 623      C44802
+ 624 23fb FFC44802 		.ascii	"\377\304H\002\377\305H\002\377\305H\002\377\305I\002\377\306"
+ 624      FFC54802 
+ 624      FFC54802 
+ 624      FFC54902 
+ 624      FFC6
+ 625 240d 4902FFC6 		.ascii	"I\002\377\306I\002\377\307I\002\377\307I\002\377\307J\002\377"
+ 625      4902FFC7 
+ 625      4902FFC7 
+ 625      4902FFC7 
+ 625      4A02FF
+ 626 2420 C84A02FF 		.ascii	"\310J\002\377\310J\002\377\311J\002\377\311J\002\377\311K\002"
+ 626      C84A02FF 
+ 626      C94A02FF 
+ 626      C94A02FF 
+ 626      C94B02
+GAS LISTING /tmp/ccoFiSH1.s 			page 45
+
+
+ 627 2433 FFCA4B02 		.ascii	"\377\312K\002\377\312K\002\377\313K\002\377\313K\002\377\313"
+ 627      FFCA4B02 
+ 627      FFCB4B02 
+ 627      FFCB4B02 
+ 627      FFCB
+ 628 2445 4C01FFCC 		.ascii	"L\001\377\314L\002\377\314L\002\377\314L\002\377\315M\002\377"
+ 628      4C02FFCC 
+ 628      4C02FFCC 
+ 628      4C02FFCD 
+ 628      4D02FF
+ 629 2458 CD4D02FF 		.ascii	"\315M\002\377\315M\002\377\315M\002\377\316N\002\377\316N\002"
+ 629      CD4D02FF 
+ 629      CD4D02FF 
+ 629      CE4E02FF 
+ 629      CE4E02
+ 630 246b FFCE4E03 		.ascii	"\377\316N\003\377\316O\003\377\317O\003\377\317O\003\377\317"
+ 630      FFCE4F03 
+ 630      FFCF4F03 
+ 630      FFCF4F03 
+ 630      FFCF
+ 631 247d 4F03FFCF 		.ascii	"O\003\377\317P\003\377\320P\003\377\320P\003\377\320Q\003\377"
+ 631      5003FFD0 
+ 631      5003FFD0 
+ 631      5003FFD0 
+ 631      5103FF
+ 632 2490 D05104FF 		.ascii	"\320Q\004\377\321Q\004\377\321Q\004\377\321R\004\377\321R\004"
+ 632      D15104FF 
+ 632      D15104FF 
+ 632      D15204FF 
+ 632      D15204
+ 633 24a3 FFD25204 		.ascii	"\377\322R\004\377\322S\004\377\322S\004\377\322S\005\377\323"
+ 633      FFD25304 
+ 633      FFD25304 
+ 633      FFD25305 
+ 633      FFD3
+ 634 24b5 5305FFD3 		.ascii	"S\005\377\323T\005\377\323T\005\377\323T\005\377\324U\005\377"
+ 634      5405FFD3 
+ 634      5405FFD3 
+ 634      5405FFD4 
+ 634      5505FF
+ 635 24c8 D45505FF 		.ascii	"\324U\005\377\324U\005\377\324U\006\377\325V\006\377\325V\006"
+ 635      D45505FF 
+ 635      D45506FF 
+ 635      D55606FF 
+ 635      D55606
+ 636 24db FFD55606 		.ascii	"\377\325V\006\377\325W\006\377\326W\006\377\326W\006\377\326"
+ 636      FFD55706 
+ 636      FFD65706 
+ 636      FFD65706 
+ 636      FFD6
+ 637 24ed 5707FFD6 		.ascii	"W\007\377\326X\007\377\327X\007\377\327X\007\377\327Y\007\377"
+ 637      5807FFD7 
+ 637      5807FFD7 
+ 637      5807FFD7 
+ 637      5907FF
+ 638 2500 D75907FF 		.ascii	"\327Y\007\377\330Y\007\377\330Y\b\377\330Z\b\377\330Z\b\377\331"
+ 638      D85907FF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 46
+
+
+ 638      D85908FF 
+ 638      D85A08FF 
+ 638      D85A08FF 
+ 639 2515 5A08FFD9 		.ascii	"Z\b\377\331Z\b\377\331[\b\377\331[\b\377\332[\t\377\332\\\t\377"
+ 639      5A08FFD9 
+ 639      5B08FFD9 
+ 639      5B08FFDA 
+ 639      5B09FFDA 
+ 640 252c DA5C09FF 		.ascii	"\332\\\t\377\332\\\t\377\333\\\t\377\333]\t\377\333]\n\377\333"
+ 640      DA5C09FF 
+ 640      DB5C09FF 
+ 640      DB5D09FF 
+ 640      DB5D0AFF 
+ 641 2541 5D0AFFDC 		.ascii	"]\n\377\334^\n\377\334^\n\377\334^\n\377\334^\n\377\335_\013"
+ 641      5E0AFFDC 
+ 641      5E0AFFDC 
+ 641      5E0AFFDC 
+ 641      5E0AFFDD 
+ 642 2557 FFDD5F0B 		.ascii	"\377\335_\013\377\335_\013\377\335`\013\377\336`\013\377\336"
+ 642      FFDD5F0B 
+ 642      FFDD600B 
+ 642      FFDE600B 
+ 642      FFDE
+ 643 2569 600BFFDE 		.ascii	"`\013\377\336`\013\377\336a\f\377\337a\f\377\337a\f\377\337b"
+ 643      600BFFDE 
+ 643      610CFFDF 
+ 643      610CFFDF 
+ 643      610CFFDF 
+ 644 257e 0CFFDF62 		.ascii	"\f\377\337b\f\377\340b\f\377\340b\r\377\340c\r\377\340c\r\377"
+ 644      0CFFE062 
+ 644      0CFFE062 
+ 644      0DFFE063 
+ 644      0DFFE063 
+ 645 2594 E1630DFF 		.ascii	"\341c\r\377\341c\r\377\341d\r\377\341d\r\377\342d\016\377\342"
+ 645      E1630DFF 
+ 645      E1640DFF 
+ 645      E1640DFF 
+ 645      E2640EFF 
+ 646 25a9 650EFFE2 		.ascii	"e\016\377\342e\016\377\342e\016\377\343e\016\377\343f\016\377"
+ 646      650EFFE2 
+ 646      650EFFE3 
+ 646      650EFFE3 
+ 646      660EFF
+ 647 25bc E3660FFF 		.ascii	"\343f\017\377\343f\017\377\344g\017\377\344g\017\377\344g\017"
+ 647      E3660FFF 
+ 647      E4670FFF 
+ 647      E4670FFF 
+ 647      E4670F
+ 648 25cf FFE4670F 		.ascii	"\377\344g\017\377\345h\017\377\345h\020\377\345h\020\377\345"
+ 648      FFE5680F 
+ 648      FFE56810 
+ 648      FFE56810 
+ 648      FFE5
+ 649 25e1 6910FFE6 		.ascii	"i\020\377\346i\020\377\346i\020\377\346i\020\377\346j\020\377"
+ 649      6910FFE6 
+ 649      6910FFE6 
+ 649      6910FFE6 
+GAS LISTING /tmp/ccoFiSH1.s 			page 47
+
+
+ 649      6A10FF
+ 650 25f4 E76A11FF 		.ascii	"\347j\021\377\347j\021\377\347j\021\377\347k\021\377\350k\021"
+ 650      E76A11FF 
+ 650      E76A11FF 
+ 650      E76B11FF 
+ 650      E86B11
+ 651 2607 FFE86B11 		.ascii	"\377\350k\021\377\350l\021\377\350l\022\377\351l\022\377\351"
+ 651      FFE86C11 
+ 651      FFE86C12 
+ 651      FFE96C12 
+ 651      FFE9
+ 652 2619 6C12FFE9 		.ascii	"l\022\377\351m\022\377\351m\022\377\352m\022\377\352n\022\377"
+ 652      6D12FFE9 
+ 652      6D12FFEA 
+ 652      6D12FFEA 
+ 652      6E12FF
+ 653 262c EA6E13FF 		.ascii	"\352n\023\377\352n\023\377\353n\023\377\353o\023\377\353o\023"
+ 653      EA6E13FF 
+ 653      EB6E13FF 
+ 653      EB6F13FF 
+ 653      EB6F13
+ 654 263f FFEB6F13 		.ascii	"\377\353o\023\377\353p\023\377\354p\024\377\354p\024\377\354"
+ 654      FFEB7013 
+ 654      FFEC7014 
+ 654      FFEC7014 
+ 654      FFEC
+ 655 2651 7014FFEC 		.ascii	"p\024\377\354q\024\377\354q\024\377\354q\024\377\355r\024\377"
+ 655      7114FFEC 
+ 655      7114FFEC 
+ 655      7114FFED 
+ 655      7214FF
+ 656 2664 ED7215FF 		.ascii	"\355r\025\377\355r\025\377\355s\025\377\355s\025\377\355s\025"
+ 656      ED7215FF 
+ 656      ED7315FF 
+ 656      ED7315FF 
+ 656      ED7315
+ 657 2677 FFED7415 		.ascii	"\377\355t\025\377\356t\025\377\356t\026\377\356u\026\377\356"
+ 657      FFEE7415 
+ 657      FFEE7416 
+ 657      FFEE7516 
+ 657      FFEE
+ 658 2689 7516FFEE 		.ascii	"u\026\377\356u\026\377\356v\026\377\356v\026\377\357v\026\377"
+ 658      7516FFEE 
+ 658      7616FFEE 
+ 658      7616FFEF 
+ 658      7616FF
+ 659 269c EF7717FF 		.ascii	"\357w\027\377\357w\027\377\357w\027\377\357x\027\377\357x\027"
+ 659      EF7717FF 
+ 659      EF7717FF 
+ 659      EF7817FF 
+ 659      EF7817
+ 660 26af FFEF7817 		.ascii	"\377\357x\027\377\360y\027\377\360y\030\377\360y\030\377\360"
+ 660      FFF07917 
+ 660      FFF07918 
+ 660      FFF07918 
+ 660      FFF0
+ 661 26c1 7A18FFF0 		.ascii	"z\030\377\360z\030\377\360z\030\377\360{\030\377\361{\031\377"
+GAS LISTING /tmp/ccoFiSH1.s 			page 48
+
+
+ 661      7A18FFF0 
+ 661      7A18FFF0 
+ 661      7B18FFF1 
+ 661      7B19FF
+ 662 26d4 F17B19FF 		.ascii	"\361{\031\377\361|\031\377\361|\031\377\361|\031\377\361}\031"
+ 662      F17C19FF 
+ 662      F17C19FF 
+ 662      F17C19FF 
+ 662      F17D19
+ 663 26e7 FFF17D19 		.ascii	"\377\361}\031\377\362}\032\377\362~\032\377\362~\032\377\362"
+ 663      FFF27D1A 
+ 663      FFF27E1A 
+ 663      FFF27E1A 
+ 663      FFF2
+ 664 26f9 7E1AFFF2 		.ascii	"~\032\377\362~\032\377\362\177\032\377\362\177\033\377\363\177"
+ 664      7E1AFFF2 
+ 664      7F1AFFF2 
+ 664      7F1BFFF3 
+ 664      7F
+ 665 270a 1BFFF380 		.ascii	"\033\377\363\200\033\377\363\200\033\377\363\200\033\377\363"
+ 665      1BFFF380 
+ 665      1BFFF380 
+ 665      1BFFF3
+ 666 2719 811BFFF3 		.ascii	"\201\033\377\363\201\033\377\363\201\034\377\364\202\034\377"
+ 666      811BFFF3 
+ 666      811CFFF4 
+ 666      821CFF
+ 667 2728 F4821CFF 		.ascii	"\364\202\034\377\364\202\034\377\364\203\034\377\364\203\034"
+ 667      F4821CFF 
+ 667      F4831CFF 
+ 667      F4831C
+ 668 2737 FFF4831D 		.ascii	"\377\364\203\035\377\364\204\035\377\365\204\035\377\365\204"
+ 668      FFF4841D 
+ 668      FFF5841D 
+ 668      FFF584
+ 669 2746 1DFFF585 		.ascii	"\035\377\365\205\035\377\365\205\035\377\365\205\036\377\365"
+ 669      1DFFF585 
+ 669      1DFFF585 
+ 669      1EFFF5
+ 670 2755 861EFFF5 		.ascii	"\206\036\377\365\206\036\377\366\206\036\377\366\206\036\377"
+ 670      861EFFF6 
+ 670      861EFFF6 
+ 670      861EFF
+ 671 2764 F6871EFF 		.ascii	"\366\207\036\377\366\207\037\377\366\207\037\377\366\210\037"
+ 671      F6871FFF 
+ 671      F6871FFF 
+ 671      F6881F
+ 672 2773 FFF6881F 		.ascii	"\377\366\210\037\377\367\210\037\377\367\211\037\377\367\211"
+ 672      FFF7881F 
+ 672      FFF7891F 
+ 672      FFF789
+ 673 2782 20FFF789 		.ascii	" \377\367\211 \377\367\212 \377\367\212 \377\367\212 \377\370"
+ 673      20FFF78A 
+ 673      20FFF78A 
+ 673      20FFF78A 
+ 673      20FFF8
+ 674 2795 8B20FFF8 		.ascii	"\213 \377\370\213!\377\370\213!\377\370\214!\377\370\214!\377"
+GAS LISTING /tmp/ccoFiSH1.s 			page 49
+
+
+ 674      8B21FFF8 
+ 674      8B21FFF8 
+ 674      8C21FFF8 
+ 674      8C21FF
+ 675 27a8 F88C21FF 		.ascii	"\370\214!\377\370\215\"\377\371\215\"\377\371\215\"\377\371\215"
+ 675      F88D22FF 
+ 675      F98D22FF 
+ 675      F98D22FF 
+ 675      F98D
+ 676 27ba 22FFF98E 		.ascii	"\"\377\371\216\"\377\371\216\"\377\371\216#\377\371\217#\377"
+ 676      22FFF98E 
+ 676      22FFF98E 
+ 676      23FFF98F 
+ 676      23FF
+ 677 27cc F98F23FF 		.ascii	"\371\217#\377\372\217#\377\372\220#\377\372\220#\377\372\220"
+ 677      FA8F23FF 
+ 677      FA9023FF 
+ 677      FA9023FF 
+ 677      FA90
+ 678 27de 24FFFA91 		.ascii	"$\377\372\221$\377\372\221$\377\372\221$\377\373\222$\377\373"
+ 678      24FFFA91 
+ 678      24FFFA91 
+ 678      24FFFB92 
+ 678      24FFFB
+ 679 27f1 9225FFFB 		.ascii	"\222%\377\373\222%\377\373\223%\377\373\223%\377\373\223%\377"
+ 679      9225FFFB 
+ 679      9325FFFB 
+ 679      9325FFFB 
+ 679      9325FF
+ 680 2804 FB9326FF 		.ascii	"\373\223&\377\373\224&\377\374\224&\377"
+ 680      FB9426FF 
+ 680      FC9426FF 
+ 681 2810 FC9426FF 		.ascii	"\374\224&\377\374\225&\377\374\225&\377\374\225'\377\374\226"
+ 681      FC9526FF 
+ 681      FC9526FF 
+ 681      FC9527FF 
+ 681      FC96
+ 682 2822 27FFFC96 		.ascii	"'\377\374\226'\377\375\226'\377\375\227'\377\375\227(\377\375"
+ 682      27FFFD96 
+ 682      27FFFD97 
+ 682      27FFFD97 
+ 682      28FFFD
+ 683 2835 9728FFFD 		.ascii	"\227(\377\375\230(\377\375\230(\377\375\230(\377\375\231(\377"
+ 683      9828FFFD 
+ 683      9828FFFD 
+ 683      9828FFFD 
+ 683      9928FF
+ 684 2848 FE9929FF 		.ascii	"\376\231)\377\376\231)\377\376\232)\377\376\232)\377\376\232"
+ 684      FE9929FF 
+ 684      FE9A29FF 
+ 684      FE9A29FF 
+ 684      FE9A
+ 685 285a 2AFFFE9B 		.ascii	"*\377\376\233*\377\376\233*\377\376\233*\377\376\234+\377\376"
+ 685      2AFFFE9B 
+ 685      2AFFFE9B 
+ 685      2AFFFE9C 
+ 685      2BFFFE
+GAS LISTING /tmp/ccoFiSH1.s 			page 50
+
+
+ 686 286d 9C2BFFFE 		.ascii	"\234+\377\376\234+\377\376\235+\377\376\235,\377\376\235,\377"
+ 686      9C2BFFFE 
+ 686      9D2BFFFE 
+ 686      9D2CFFFE 
+ 686      9D2CFF
+ 687 2880 FE9E2CFF 		.ascii	"\376\236,\377\376\236,\377\376\237-\377\376\237-\377\376\237"
+ 687      FE9E2CFF 
+ 687      FE9F2DFF 
+ 687      FE9F2DFF 
+ 687      FE9F
+ 688 2892 2DFFFEA0 		.ascii	"-\377\376\240.\377\376\240.\377\376\240.\377\376\241.\377\376"
+ 688      2EFFFEA0 
+ 688      2EFFFEA0 
+ 688      2EFFFEA1 
+ 688      2EFFFE
+ 689 28a5 A12FFFFE 		.ascii	"\241/\377\376\241/\377\376\242/\377\376\242/\377\376\2420\377"
+ 689      A12FFFFE 
+ 689      A22FFFFE 
+ 689      A22FFFFE 
+ 689      A230FF
+ 690 28b8 FEA330FF 		.ascii	"\376\2430\377\376\2430\377\376\2430\377\376\2441\377\376\244"
+ 690      FEA330FF 
+ 690      FEA330FF 
+ 690      FEA431FF 
+ 690      FEA4
+ 691 28ca 31FFFEA4 		.ascii	"1\377\376\2441\377\376\2452\377\376\2452\377\376\2452\377\376"
+ 691      31FFFEA5 
+ 691      32FFFEA5 
+ 691      32FFFEA5 
+ 691      32FFFE
+ 692 28dd A632FFFE 		.ascii	"\2462\377\376\2463\377\376\2463\377\376\2473\377\376\2473\377"
+ 692      A633FFFE 
+ 692      A633FFFE 
+ 692      A733FFFE 
+ 692      A733FF
+ 693 28f0 FEA834FF 		.ascii	"\376\2504\377\376\2504\377\376\2504\377\376\2515\377\376\251"
+ 693      FEA834FF 
+ 693      FEA834FF 
+ 693      FEA935FF 
+ 693      FEA9
+ 694 2902 35FFFEA9 		.ascii	"5\377\376\2515\377\376\2525\377\376\2526\377\376\2526\377\376"
+ 694      35FFFEAA 
+ 694      35FFFEAA 
+ 694      36FFFEAA 
+ 694      36FFFE
+ 695 2915 AB36FFFE 		.ascii	"\2536\377\376\2537\377\376\2537\377\376\2547\377\376\2548\377"
+ 695      AB37FFFE 
+ 695      AB37FFFE 
+ 695      AC37FFFE 
+ 695      AC38FF
+ 696 2928 FEAC38FF 		.ascii	"\376\2548\377\376\2558\377\376\2558\377\376\2559\377\376\256"
+ 696      FEAD38FF 
+ 696      FEAD38FF 
+ 696      FEAD39FF 
+ 696      FEAE
+ 697 293a 39FFFEAE 		.ascii	"9\377\376\2569\377\376\256:\377\376\257:\377\376\257:\377\376"
+ 697      39FFFEAE 
+GAS LISTING /tmp/ccoFiSH1.s 			page 51
+
+
+ 697      3AFFFEAF 
+ 697      3AFFFEAF 
+ 697      3AFFFE
+ 698 294d AF3AFFFE 		.ascii	"\257:\377\376\260;\377\376\260;\377\376\260;\377\376\261<\377"
+ 698      B03BFFFE 
+ 698      B03BFFFE 
+ 698      B03BFFFE 
+ 698      B13CFF
+ 699 2960 FEB13CFF 		.ascii	"\376\261<\377\376\261<\377\376\262=\377\376\262=\377\376\262"
+ 699      FEB13CFF 
+ 699      FEB23DFF 
+ 699      FEB23DFF 
+ 699      FEB2
+ 700 2972 3DFFFEB3 		.ascii	"=\377\376\263>\377\376\263>\377\376\263>\377\376\264>\377\376"
+ 700      3EFFFEB3 
+ 700      3EFFFEB3 
+ 700      3EFFFEB4 
+ 700      3EFFFE
+ 701 2985 B43FFFFE 		.ascii	"\264?\377\376\264?\377\376\265?\377\376\265@\377\376\265@\377"
+ 701      B43FFFFE 
+ 701      B53FFFFE 
+ 701      B540FFFE 
+ 701      B540FF
+ 702 2998 FEB640FF 		.ascii	"\376\266@\377\376\266A\377\376\266A\377\376\267A\377\376\267"
+ 702      FEB641FF 
+ 702      FEB641FF 
+ 702      FEB741FF 
+ 702      FEB7
+ 703 29aa 42FFFEB7 		.ascii	"B\377\376\267B\377\376\270B\377\376\270C\377\376\270C\377\376"
+ 703      42FFFEB8 
+ 703      42FFFEB8 
+ 703      43FFFEB8 
+ 703      43FFFE
+ 704 29bd B943FFFE 		.ascii	"\271C\377\376\271D\377\376\271D\377\376\272D\377\376\272D\377"
+ 704      B944FFFE 
+ 704      B944FFFE 
+ 704      BA44FFFE 
+ 704      BA44FF
+ 705 29d0 FEBA45FF 		.ascii	"\376\272E\377\376\273E\377\376\273E\377\376\273F\377\376\273"
+ 705      FEBB45FF 
+ 705      FEBB45FF 
+ 705      FEBB46FF 
+ 705      FEBB
+ 706 29e2 46FFFEBC 		.ascii	"F\377\376\274F\377\376\274G\377\376\274G\377\376\275G\377\376"
+ 706      46FFFEBC 
+ 706      47FFFEBC 
+ 706      47FFFEBD 
+ 706      47FFFE
+ 707 29f5 BD48FFFE 		.ascii	"\275H\377\376\275H\377\376\276H\377\376\276I\377\376\276I\377"
+ 707      BD48FFFE 
+ 707      BE48FFFE 
+ 707      BE49FFFE 
+ 707      BE49FF
+ 708 2a08 FEBF49FF 		.ascii	"\376\277I\377\376\277J\377\376\277J\377\376\300J\377\376\300"
+ 708      FEBF4AFF 
+ 708      FEBF4AFF 
+ 708      FEC04AFF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 52
+
+
+ 708      FEC0
+ 709 2a1a 4BFFFEC0 		.ascii	"K\377\376\300K\377\376\301K\377\375\301L\377\375\301L\377\375"
+ 709      4BFFFEC1 
+ 709      4BFFFDC1 
+ 709      4CFFFDC1 
+ 709      4CFFFD
+ 710 2a2d C24CFFFD 		.ascii	"\302L\377\375\302M\377\375\302M\377\375\303M\377\375\303N\377"
+ 710      C24DFFFD 
+ 710      C24DFFFD 
+ 710      C34DFFFD 
+ 710      C34EFF
+ 711 2a40 FDC34EFF 		.ascii	"\375\303N\377\375\304N\377\375\304O\377\375\304P\377\375\304"
+ 711      FDC44EFF 
+ 711      FDC44FFF 
+ 711      FDC450FF 
+ 711      FDC4
+ 712 2a52 50FFFDC5 		.ascii	"P\377\375\305Q\377\375\305Q\377\375\305R\377\375\305R\377\375"
+ 712      51FFFDC5 
+ 712      51FFFDC5 
+ 712      52FFFDC5 
+ 712      52FFFD
+ 713 2a65 C653FFFD 		.ascii	"\306S\377\375\306S\377\375\306T\377\375\306T\377\375\307U\377"
+ 713      C653FFFD 
+ 713      C654FFFD 
+ 713      C654FFFD 
+ 713      C755FF
+ 714 2a78 FDC755FF 		.ascii	"\375\307U\377\375\307V\377\375\307V\377\375\310W\377\375\310"
+ 714      FDC756FF 
+ 714      FDC756FF 
+ 714      FDC857FF 
+ 714      FDC8
+ 715 2a8a 57FFFDC8 		.ascii	"W\377\375\310X\377\375\310X\377\375\311Y\377\375\311Z\377\375"
+ 715      58FFFDC8 
+ 715      58FFFDC9 
+ 715      59FFFDC9 
+ 715      5AFFFD
+ 716 2a9d C95AFFFD 		.ascii	"\311Z\377\375\311[\377\375\312[\377\375\312\\\377\375\312\\\377"
+ 716      C95BFFFD 
+ 716      CA5BFFFD 
+ 716      CA5CFFFD 
+ 716      CA5CFF
+ 717 2ab0 FDCA5DFF 		.ascii	"\375\312]\377\375\313]\377\375\313^\377\375\313^\377\375\313"
+ 717      FDCB5DFF 
+ 717      FDCB5EFF 
+ 717      FDCB5EFF 
+ 717      FDCB
+ 718 2ac2 5FFFFDCC 		.ascii	"_\377\375\314_\377\375\314`\377\375\314`\377\375\314a\377\375"
+ 718      5FFFFDCC 
+ 718      60FFFDCC 
+ 718      60FFFDCC 
+ 718      61FFFD
+ 719 2ad5 CD61FFFD 		.ascii	"\315a\377\375\315b\377\375\315b\377\375\315c\377\375\316c\377"
+ 719      CD62FFFD 
+ 719      CD62FFFD 
+ 719      CD63FFFD 
+ 719      CE63FF
+ 720 2ae8 FDCE64FF 		.ascii	"\375\316d\377\375\316d\377\375\316e\377\375\317e\377\375\317"
+GAS LISTING /tmp/ccoFiSH1.s 			page 53
+
+
+ 720      FDCE64FF 
+ 720      FDCE65FF 
+ 720      FDCF65FF 
+ 720      FDCF
+ 721 2afa 66FFFDCF 		.ascii	"f\377\375\317f\377\375\317g\377\375\320g\377\375\320h\377\375"
+ 721      66FFFDCF 
+ 721      67FFFDD0 
+ 721      67FFFDD0 
+ 721      68FFFD
+ 722 2b0d D069FFFD 		.ascii	"\320i\377\375\320i\377\375\321j\377\375\321j\377\375\321k\377"
+ 722      D069FFFD 
+ 722      D16AFFFD 
+ 722      D16AFFFD 
+ 722      D16BFF
+ 723 2b20 FDD16BFF 		.ascii	"\375\321k\377\375\322l\377\375\322l\377\375\322m\377\375\322"
+ 723      FDD26CFF 
+ 723      FDD26CFF 
+ 723      FDD26DFF 
+ 723      FDD2
+ 724 2b32 6DFFFDD3 		.ascii	"m\377\375\323n\377\375\323n\377\375\323o\377\375\323o\377\375"
+ 724      6EFFFDD3 
+ 724      6EFFFDD3 
+ 724      6FFFFDD3 
+ 724      6FFFFD
+ 725 2b45 D470FFFD 		.ascii	"\324p\377\375\324p\377\375\324q\377\375\324q\377\375\325r\377"
+ 725      D470FFFD 
+ 725      D471FFFD 
+ 725      D471FFFD 
+ 725      D572FF
+ 726 2b58 FDD572FF 		.ascii	"\375\325r\377\375\325s\377\375\325s\377\375\325t\377\375\326"
+ 726      FDD573FF 
+ 726      FDD573FF 
+ 726      FDD574FF 
+ 726      FDD6
+ 727 2b6a 74FFFDD6 		.ascii	"t\377\375\326u\377\375\326u\377\375\326v\377\375\327v\377\375"
+ 727      75FFFDD6 
+ 727      75FFFDD6 
+ 727      76FFFDD7 
+ 727      76FFFD
+ 728 2b7d D777FFFD 		.ascii	"\327w\377\375\327w\377\375\327x\377\375\330x\377\375\330y\377"
+ 728      D777FFFD 
+ 728      D778FFFD 
+ 728      D878FFFD 
+ 728      D879FF
+ 729 2b90 FDD879FF 		.ascii	"\375\330y\377\375\330z\377\375\331z\377\375\331{\377\375\331"
+ 729      FDD87AFF 
+ 729      FDD97AFF 
+ 729      FDD97BFF 
+ 729      FDD9
+ 730 2ba2 7BFFFDD9 		.ascii	"{\377\375\331|\377\375\332|\377\375\332}\377\375\332~\377\375"
+ 730      7CFFFDDA 
+ 730      7CFFFDDA 
+ 730      7DFFFDDA 
+ 730      7EFFFD
+ 731 2bb5 DA7EFFFD 		.ascii	"\332~\377\375\332\177\377\375\333\177\377\375\333\200\377\375"
+ 731      DA7FFFFD 
+ 731      DB7FFFFD 
+GAS LISTING /tmp/ccoFiSH1.s 			page 54
+
+
+ 731      DB80FFFD 
+ 732 2bc5 DB80FFFD 		.ascii	"\333\200\377\375\333\201\377\375\334\201\377\375\334\202\377"
+ 732      DB81FFFD 
+ 732      DC81FFFD 
+ 732      DC82FF
+ 733 2bd4 FDDC82FF 		.ascii	"\375\334\202\377\375\334\203\377\375\335\203\377\375\335\204"
+ 733      FDDC83FF 
+ 733      FDDD83FF 
+ 733      FDDD84
+ 734 2be3 FFFDDD84 		.ascii	"\377\375\335\204\377\375\335\205\377\375\335\205\377\375\336"
+ 734      FFFDDD85 
+ 734      FFFDDD85 
+ 734      FFFDDE
+ 735 2bf2 86FFFDDE 		.ascii	"\206\377\375\336\206\377\375\336\207\377\375\336\207\377\375"
+ 735      86FFFDDE 
+ 735      87FFFDDE 
+ 735      87FFFD
+ 736 2c01 DF88FFFD 		.ascii	"\337\210\377\375\337\210\377\375\337\211\377\375\337\211\377"
+ 736      DF88FFFD 
+ 736      DF89FFFD 
+ 736      DF89FF
+ 737 2c10 FDE08AFF 		.ascii	"\375\340\212\377\375\340\212\377\375\340\213\377\375\340\213"
+ 737      FDE08AFF 
+ 737      FDE08BFF 
+ 737      FDE08B
+ 738 2c1f FFFDE08C 		.ascii	"\377\375\340\214\377\375\341\214\377\375\341\215\377\375\341"
+ 738      FFFDE18C 
+ 738      FFFDE18D 
+ 738      FFFDE1
+ 739 2c2e 8DFFFDE1 		.ascii	"\215\377\375\341\216\377\375\342\216\377\375\342\217\377\375"
+ 739      8EFFFDE2 
+ 739      8EFFFDE2 
+ 739      8FFFFD
+ 740 2c3d E28FFFFD 		.ascii	"\342\217\377\375\342\220\377\375\343\220\377\375\343\221\377"
+ 740      E290FFFD 
+ 740      E390FFFD 
+ 740      E391FF
+ 741 2c4c FDE391FF 		.ascii	"\375\343\221\377\375\343\221\377\375\343\222\377\375\343\222"
+ 741      FDE391FF 
+ 741      FDE392FF 
+ 741      FDE392
+ 742 2c5b FFFDE392 		.ascii	"\377\375\343\222\377\375\344\223\377\375\344\223\377\375\344"
+ 742      FFFDE493 
+ 742      FFFDE493 
+ 742      FFFDE4
+ 743 2c6a 93FFFDE4 		.ascii	"\223\377\375\344\224\377\375\344\224\377\375\344\224\377\375"
+ 743      94FFFDE4 
+ 743      94FFFDE4 
+ 743      94FFFD
+ 744 2c79 E595FFFD 		.ascii	"\345\225\377\375\345\225\377\375\345\225\377\375\345\226\377"
+ 744      E595FFFD 
+ 744      E595FFFD 
+ 744      E596FF
+ 745 2c88 FDE596FF 		.ascii	"\375\345\226\377\375\345\226\377\375\346\227\377\375\346\227"
+ 745      FDE596FF 
+ 745      FDE697FF 
+ 745      FDE697
+GAS LISTING /tmp/ccoFiSH1.s 			page 55
+
+
+ 746 2c97 FFFDE697 		.ascii	"\377\375\346\227\377\375\346\230\377\375\346\230\377\375\346"
+ 746      FFFDE698 
+ 746      FFFDE698 
+ 746      FFFDE6
+ 747 2ca6 98FFFDE7 		.ascii	"\230\377\375\347\231\377\375\347\231\377\375\347\231\377\375"
+ 747      99FFFDE7 
+ 747      99FFFDE7 
+ 747      99FFFD
+ 748 2cb5 E79AFFFD 		.ascii	"\347\232\377\375\347\232\377\375\347\232\377\375\350\233\377"
+ 748      E79AFFFD 
+ 748      E79AFFFD 
+ 748      E89BFF
+ 749 2cc4 FDE89BFF 		.ascii	"\375\350\233\377\375\350\233\377\375\350\234\377\375\350\234"
+ 749      FDE89BFF 
+ 749      FDE89CFF 
+ 749      FDE89C
+ 750 2cd3 FFFDE89C 		.ascii	"\377\375\350\234\377\375\351\235\377\375\351\235\377\375\351"
+ 750      FFFDE99D 
+ 750      FFFDE99D 
+ 750      FFFDE9
+ 751 2ce2 9DFFFDE9 		.ascii	"\235\377\375\351\236\377\375\351\236\377\375\351\236\377\375"
+ 751      9EFFFDE9 
+ 751      9EFFFDE9 
+ 751      9EFFFD
+ 752 2cf1 E99FFFFD 		.ascii	"\351\237\377\375\352\237\377\375\352\237\377\375\352\240\377"
+ 752      EA9FFFFD 
+ 752      EA9FFFFD 
+ 752      EAA0FF
+ 753 2d00 FDEAA0FF 		.ascii	"\375\352\240\377\375\352\240\377\375\352\241\377\375\353\241"
+ 753      FDEAA0FF 
+ 753      FDEAA1FF 
+ 753      FDEBA1
+ 754 2d0f FFFDEBA1 		.ascii	"\377\375\353\241\377\375\353\242\377\375\353\242\377\375\353"
+ 754      FFFDEBA2 
+ 754      FFFDEBA2 
+ 754      FFFDEB
+ 755 2d1e A2FFFDEB 		.ascii	"\242\377\375\353\243\377\375\354\243\377\375\354\243\377\375"
+ 755      A3FFFDEC 
+ 755      A3FFFDEC 
+ 755      A3FFFD
+ 756 2d2d ECA4FFFD 		.ascii	"\354\244\377\375\354\244\377\375\354\244\377\375\354\245\377"
+ 756      ECA4FFFD 
+ 756      ECA4FFFD 
+ 756      ECA5FF
+ 757 2d3c FDECA5FF 		.ascii	"\375\354\245\377\375\355\246\377\375\355\246\377\375\355\246"
+ 757      FDEDA6FF 
+ 757      FDEDA6FF 
+ 757      FDEDA6
+ 758 2d4b FFFDEDA7 		.ascii	"\377\375\355\247\377\375\355\247\377\375\355\247\377\375\356"
+ 758      FFFDEDA7 
+ 758      FFFDEDA7 
+ 758      FFFDEE
+ 759 2d5a A8FFFDEE 		.ascii	"\250\377\375\356\250\377\375\356\250\377\375\356\251\377\375"
+ 759      A8FFFDEE 
+ 759      A8FFFDEE 
+ 759      A9FFFD
+ 760 2d69 EEA9FFFD 		.ascii	"\356\251\377\375\356\251\377\375\357\252\377\375\357\252\377"
+GAS LISTING /tmp/ccoFiSH1.s 			page 56
+
+
+ 760      EEA9FFFD 
+ 760      EFAAFFFD 
+ 760      EFAAFF
+ 761 2d78 FDEFAAFF 		.ascii	"\375\357\252\377\375\357\253\377\376\357\253\377\376\357\253"
+ 761      FDEFABFF 
+ 761      FEEFABFF 
+ 761      FEEFAB
+ 762 2d87 FFFEEFAC 		.ascii	"\377\376\357\254\377\376\360\254\377\376\360\254\377\376\360"
+ 762      FFFEF0AC 
+ 762      FFFEF0AC 
+ 762      FFFEF0
+ 763 2d96 ADFFFEF0 		.ascii	"\255\377\376\360\255\377\376\360\255\377\376\360\256\377\376"
+ 763      ADFFFEF0 
+ 763      ADFFFEF0 
+ 763      AEFFFE
+ 764 2da5 F1AEFFFE 		.ascii	"\361\256\377\376\361\256\377\376\361\257\377\376\361\257\377"
+ 764      F1AEFFFE 
+ 764      F1AFFFFE 
+ 764      F1AFFF
+ 765 2db4 FEF1AFFF 		.ascii	"\376\361\257\377\376\361\260\377\376\361\260\377\376\362\260"
+ 765      FEF1B0FF 
+ 765      FEF1B0FF 
+ 765      FEF2B0
+ 766 2dc3 FFFEF2B1 		.ascii	"\377\376\362\261\377\376\362\261\377\376\362\261\377\376\362"
+ 766      FFFEF2B1 
+ 766      FFFEF2B1 
+ 766      FFFEF2
+ 767 2dd2 B2FFFEF2 		.ascii	"\262\377\376\362\262\377\376\362\262\377\376\363\263\377\376"
+ 767      B2FFFEF2 
+ 767      B2FFFEF3 
+ 767      B3FFFE
+ 768 2de1 F3B3FFFE 		.ascii	"\363\263\377\376\363\263\377\376\363\264\377\376\363\264\377"
+ 768      F3B3FFFE 
+ 768      F3B4FFFE 
+ 768      F3B4FF
+ 769 2df0 FEF3B4FF 		.ascii	"\376\363\264\377\376\364\265\377\376\364\265\377\376\364\265"
+ 769      FEF4B5FF 
+ 769      FEF4B5FF 
+ 769      FEF4B5
+ 770 2dff FFFEF4B6 		.ascii	"\377\376\364\266\377\376\364\266\377\376\364\266\377\376\364"
+ 770      FFFEF4B6 
+ 770      FFFEF4B6 
+ 770      FFFEF4
+ 771 2e0e B7FFFEF5 		.ascii	"\267\377\376\365\267\377\376\365\267\377\376\365\270\377\376"
+ 771      B7FFFEF5 
+ 771      B7FFFEF5 
+ 771      B8FFFE
+ 772 2e1d F5B8FFFE 		.ascii	"\365\270\377\376\365\270\377\376\365\271\377\376\365\271\377"
+ 772      F5B8FFFE 
+ 772      F5B9FFFE 
+ 772      F5B9FF
+ 773 2e2c FEF6B9FF 		.ascii	"\376\366\271\377\376\366\272\377\376\366\272\377\376\366\272"
+ 773      FEF6BAFF 
+ 773      FEF6BAFF 
+ 773      FEF6BA
+ 774 2e3b FFFEF6BB 		.ascii	"\377\376\366\273\377\376\366\273\377\376\367\273\377\376\367"
+ 774      FFFEF6BB 
+GAS LISTING /tmp/ccoFiSH1.s 			page 57
+
+
+ 774      FFFEF7BB 
+ 774      FFFEF7
+ 775 2e4a BCFFFEF7 		.ascii	"\274\377\376\367\274\377\376\367\274\377\376\367\275\377\376"
+ 775      BCFFFEF7 
+ 775      BCFFFEF7 
+ 775      BDFFFE
+ 776 2e59 F7BDFFFE 		.ascii	"\367\275\377\376\367\275\377\376\367\276\377\376\367\276\377"
+ 776      F7BDFFFE 
+ 776      F7BEFFFE 
+ 776      F7BEFF
+ 777 2e68 FEF7BEFF 		.ascii	"\376\367\276\377\376\367\277\377\376\367\277\377\376\367\277"
+ 777      FEF7BFFF 
+ 777      FEF7BFFF 
+ 777      FEF7BF
+ 778 2e77 FFFEF7C0 		.ascii	"\377\376\367\300\377\376\367\300\377\376\370\300\377\376\370"
+ 778      FFFEF7C0 
+ 778      FFFEF8C0 
+ 778      FFFEF8
+ 779 2e86 C1FFFEF8 		.ascii	"\301\377\376\370\301\377\376\370\301\377\376\370\302\377\376"
+ 779      C1FFFEF8 
+ 779      C1FFFEF8 
+ 779      C2FFFE
+ 780 2e95 F8C2FFFE 		.ascii	"\370\302\377\376\370\302\377\376\370\303\377\376\370\303\377"
+ 780      F8C2FFFE 
+ 780      F8C3FFFE 
+ 780      F8C3FF
+ 781 2ea4 FEF8C3FF 		.ascii	"\376\370\303\377\376\370\304\377\376\370\304\377\376\370\304"
+ 781      FEF8C4FF 
+ 781      FEF8C4FF 
+ 781      FEF8C4
+ 782 2eb3 FFFEF8C5 		.ascii	"\377\376\370\305\377\376\371\305\377\376\371\305\377\376\371"
+ 782      FFFEF9C5 
+ 782      FFFEF9C5 
+ 782      FFFEF9
+ 783 2ec2 C6FFFEF9 		.ascii	"\306\377\376\371\306\377\376\371\306\377\376\371\307\377\376"
+ 783      C6FFFEF9 
+ 783      C6FFFEF9 
+ 783      C7FFFE
+ 784 2ed1 F9C7FFFE 		.ascii	"\371\307\377\376\371\307\377\376\371\307\377\376\371\310\377"
+ 784      F9C7FFFE 
+ 784      F9C7FFFE 
+ 784      F9C8FF
+ 785 2ee0 FEF9C8FF 		.ascii	"\376\371\310\377\376\371\310\377\376\371\311\377\376\371\311"
+ 785      FEF9C8FF 
+ 785      FEF9C9FF 
+ 785      FEF9C9
+ 786 2eef FFFEF9C9 		.ascii	"\377\376\371\311\377\376\372\312\377\376\372\312\377\376\372"
+ 786      FFFEFACA 
+ 786      FFFEFACA 
+ 786      FFFEFA
+ 787 2efe CAFFFEFA 		.ascii	"\312\377\376\372\313\377\376\372\313\377\376\372\313\377\376"
+ 787      CBFFFEFA 
+ 787      CBFFFEFA 
+ 787      CBFFFE
+ 788 2f0d FACCFFFE 		.ascii	"\372\314\377\376\372\314\377\376\372\314\377\376\372\315\377"
+ 788      FACCFFFE 
+ 788      FACCFFFE 
+GAS LISTING /tmp/ccoFiSH1.s 			page 58
+
+
+ 788      FACDFF
+ 789 2f1c FEFACDFF 		.ascii	"\376\372\315\377\376\372\315\377\376\372\316\377\376\372\316"
+ 789      FEFACDFF 
+ 789      FEFACEFF 
+ 789      FEFACE
+ 790 2f2b FFFEFACE 		.ascii	"\377\376\372\316\377\376\372\317\377\376\373\317\377\376\373"
+ 790      FFFEFACF 
+ 790      FFFEFBCF 
+ 790      FFFEFB
+ 791 2f3a CFFFFEFB 		.ascii	"\317\377\376\373\320\377\376\373\320\377\376\373\320\377\376"
+ 791      D0FFFEFB 
+ 791      D0FFFEFB 
+ 791      D0FFFE
+ 792 2f49 FBD1FFFE 		.ascii	"\373\321\377\376\373\321\377\376\373\321\377\376\373\321\377"
+ 792      FBD1FFFE 
+ 792      FBD1FFFE 
+ 792      FBD1FF
+ 793 2f58 FEFBD2FF 		.ascii	"\376\373\322\377\376\373\322\377\376\373\322\377\376\373\323"
+ 793      FEFBD2FF 
+ 793      FEFBD2FF 
+ 793      FEFBD3
+ 794 2f67 FFFEFBD3 		.ascii	"\377\376\373\323\377\376\373\323\377\376\373\324\377\376\374"
+ 794      FFFEFBD3 
+ 794      FFFEFBD4 
+ 794      FFFEFC
+ 795 2f76 D4FFFEFC 		.ascii	"\324\377\376\374\324\377\376\374\325\377\376\374\325\377\376"
+ 795      D4FFFEFC 
+ 795      D5FFFEFC 
+ 795      D5FFFE
+ 796 2f85 FCD5FFFE 		.ascii	"\374\325\377\376\374\326\377\376\374\326\377\376\374\326\377"
+ 796      FCD6FFFE 
+ 796      FCD6FFFE 
+ 796      FCD6FF
+ 797 2f94 FEFCD7FF 		.ascii	"\376\374\327\377\376\374\327\377\376\374\327\377\376\374\330"
+ 797      FEFCD7FF 
+ 797      FEFCD7FF 
+ 797      FEFCD8
+ 798 2fa3 FFFEFCD8 		.ascii	"\377\376\374\330\377\376\374\330\377\376\374\330\377\376\374"
+ 798      FFFEFCD8 
+ 798      FFFEFCD8 
+ 798      FFFEFC
+ 799 2fb2 D9FFFEFC 		.ascii	"\331\377\376\374\331\377\376\375\331\377\376\375\332\377\376"
+ 799      D9FFFEFD 
+ 799      D9FFFEFD 
+ 799      DAFFFE
+ 800 2fc1 FDDAFFFE 		.ascii	"\375\332\377\376\375\332\377\376\375\333\377\376\375\333\377"
+ 800      FDDAFFFE 
+ 800      FDDBFFFE 
+ 800      FDDBFF
+ 801 2fd0 FEFDDBFF 		.ascii	"\376\375\333\377\376\375\334\377\376\375\334\377\376\375\334"
+ 801      FEFDDCFF 
+ 801      FEFDDCFF 
+ 801      FEFDDC
+ 802 2fdf FF       		.ascii	"\377"
+ 803 2fe0 FEFDDDFF 		.ascii	"\376\375\335\377\376\375\335\377\376\375\335\377\376\375\336"
+ 803      FEFDDDFF 
+ 803      FEFDDDFF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 59
+
+
+ 803      FEFDDE
+ 804 2fef FFFEFDDE 		.ascii	"\377\376\375\336\377\376\375\336\377\376\375\337\377\376\376"
+ 804      FFFEFDDE 
+ 804      FFFEFDDF 
+ 804      FFFEFE
+ 805 2ffe DFFFFEFE 		.ascii	"\337\377\376\376\337\377\376\376\337\377\376\376\340\377\376"
+ 805      DFFFFEFE 
+ 805      DFFFFEFE 
+ 805      E0FFFE
+ 806 300d FEE0FFFE 		.ascii	"\376\340\377\376\376\340\377\376\376\341\377\376\376\341\377"
+ 806      FEE0FFFE 
+ 806      FEE1FFFE 
+ 806      FEE1FF
+ 807 301c FEFEE1FF 		.ascii	"\376\376\341\377\376\376\342\377\376\376\342\377\376\376\342"
+ 807      FEFEE2FF 
+ 807      FEFEE2FF 
+ 807      FEFEE2
+ 808 302b FFFEFEE3 		.ascii	"\377\376\376\343\377\376\376\343\377\376\376\343\377\376\376"
+ 808      FFFEFEE3 
+ 808      FFFEFEE3 
+ 808      FFFEFE
+ 809 303a E4FFFEFE 		.ascii	"\344\377\376\376\344\377\376\376\344\377"
+ 809      E4FFFEFE 
+ 809      E4FF
+ 810              		.globl	heatmap_cs_YlOrBr_discrete
+ 811              		.section	.data.rel.local
+ 812              		.align 8
+ 813              		.type	heatmap_cs_YlOrBr_discrete, @object
+ 814              		.size	heatmap_cs_YlOrBr_discrete, 8
+ 815              	heatmap_cs_YlOrBr_discrete:
+ 816 0018 00000000 		.quad	discrete
+ 816      00000000 
+ 817              		.section	.data.rel.ro.local
+ 818              		.align 16
+ 819              		.type	discrete, @object
+ 820              		.size	discrete, 16
+ 821              	discrete:
+ 822 0030 00000000 		.quad	discrete_data
+ 822      00000000 
+ 823 0038 0A000000 		.quad	10
+ 823      00000000 
+ 824              		.section	.rodata
+ 825 3044 00000000 		.align 32
+ 825      00000000 
+ 825      00000000 
+ 825      00000000 
+ 825      00000000 
+ 826              		.type	discrete_data, @object
+ 827              		.size	discrete_data, 40
+ 828              	discrete_data:
+ 829 3060 00       		.string	""
+ 830 3061 00       		.string	""
+ 831 3062 00       		.string	""
+ 832 3063 00       		.string	""
+ 833 3064 662506FF 		.ascii	"f%\006\377\2314\004\377\314L\002\377\354p\024\377\376\231)\377"
+ 833      993404FF 
+ 833      CC4C02FF 
+GAS LISTING /tmp/ccoFiSH1.s 			page 60
+
+
+ 833      EC7014FF 
+ 833      FE9929FF 
+ 834 3078 FEC44FFF 		.ascii	"\376\304O\377\376\343\221\377\377\367\274\377\377\377\345\377"
+ 834      FEE391FF 
+ 834      FFF7BCFF 
+ 834      FFFFE5FF 
+ 835              		.text
+ 836              	.Letext0:
+ 837              		.file 1 "./heatmap.h"
+ 838              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 839              		.file 3 "./colorschemes/YlOrBr.h"
+ 840              		.file 4 "colorschemes/YlOrBr.c"
+ 841              		.section	.debug_info,"",@progbits
+ 842              	.Ldebug_info0:
+ 843 0000 E3010000 		.long	0x1e3
+ 844 0004 0500     		.value	0x5
+ 845 0006 01       		.byte	0x1
+ 846 0007 08       		.byte	0x8
+ 847 0008 00000000 		.long	.Ldebug_abbrev0
+ 848 000c 0A       		.uleb128 0xa
+ 849 000d 00000000 		.long	.LASF26
+ 850 0011 1D       		.byte	0x1d
+ 851 0012 00000000 		.long	.LASF0
+ 852 0016 00000000 		.long	.LASF1
+ 853 001a 00000000 		.long	.Ldebug_line0
+ 854 001e 01       		.uleb128 0x1
+ 855 001f 08       		.byte	0x8
+ 856 0020 05       		.byte	0x5
+ 857 0021 00000000 		.long	.LASF2
+ 858 0025 06       		.uleb128 0x6
+ 859 0026 00000000 		.long	.LASF12
+ 860 002a 02       		.byte	0x2
+ 861 002b D6       		.byte	0xd6
+ 862 002c 17       		.byte	0x17
+ 863 002d 31000000 		.long	0x31
+ 864 0031 01       		.uleb128 0x1
+ 865 0032 08       		.byte	0x8
+ 866 0033 07       		.byte	0x7
+ 867 0034 00000000 		.long	.LASF3
+ 868 0038 0B       		.uleb128 0xb
+ 869 0039 04       		.byte	0x4
+ 870 003a 05       		.byte	0x5
+ 871 003b 696E7400 		.string	"int"
+ 872 003f 01       		.uleb128 0x1
+ 873 0040 08       		.byte	0x8
+ 874 0041 05       		.byte	0x5
+ 875 0042 00000000 		.long	.LASF4
+ 876 0046 01       		.uleb128 0x1
+ 877 0047 10       		.byte	0x10
+ 878 0048 04       		.byte	0x4
+ 879 0049 00000000 		.long	.LASF5
+ 880 004d 01       		.uleb128 0x1
+ 881 004e 04       		.byte	0x4
+ 882 004f 04       		.byte	0x4
+ 883 0050 00000000 		.long	.LASF6
+ 884 0054 01       		.uleb128 0x1
+ 885 0055 04       		.byte	0x4
+GAS LISTING /tmp/ccoFiSH1.s 			page 61
+
+
+ 886 0056 07       		.byte	0x7
+ 887 0057 00000000 		.long	.LASF7
+ 888 005b 01       		.uleb128 0x1
+ 889 005c 02       		.byte	0x2
+ 890 005d 07       		.byte	0x7
+ 891 005e 00000000 		.long	.LASF8
+ 892 0062 0C       		.uleb128 0xc
+ 893 0063 10       		.byte	0x10
+ 894 0064 01       		.byte	0x1
+ 895 0065 BB       		.byte	0xbb
+ 896 0066 09       		.byte	0x9
+ 897 0067 84000000 		.long	0x84
+ 898 006b 07       		.uleb128 0x7
+ 899 006c 00000000 		.long	.LASF9
+ 900 0070 BC       		.byte	0xbc
+ 901 0071 1A       		.byte	0x1a
+ 902 0072 84000000 		.long	0x84
+ 903 0076 00       		.byte	0
+ 904 0077 07       		.uleb128 0x7
+ 905 0078 00000000 		.long	.LASF10
+ 906 007c BD       		.byte	0xbd
+ 907 007d 0C       		.byte	0xc
+ 908 007e 25000000 		.long	0x25
+ 909 0082 08       		.byte	0x8
+ 910 0083 00       		.byte	0
+ 911 0084 08       		.uleb128 0x8
+ 912 0085 90000000 		.long	0x90
+ 913 0089 01       		.uleb128 0x1
+ 914 008a 01       		.byte	0x1
+ 915 008b 08       		.byte	0x8
+ 916 008c 00000000 		.long	.LASF11
+ 917 0090 03       		.uleb128 0x3
+ 918 0091 89000000 		.long	0x89
+ 919 0095 06       		.uleb128 0x6
+ 920 0096 00000000 		.long	.LASF13
+ 921 009a 01       		.byte	0x1
+ 922 009b BE       		.byte	0xbe
+ 923 009c 03       		.byte	0x3
+ 924 009d 62000000 		.long	0x62
+ 925 00a1 03       		.uleb128 0x3
+ 926 00a2 95000000 		.long	0x95
+ 927 00a6 08       		.uleb128 0x8
+ 928 00a7 A1000000 		.long	0xa1
+ 929 00ab 04       		.uleb128 0x4
+ 930 00ac 00000000 		.long	.LASF14
+ 931 00b0 21       		.byte	0x21
+ 932 00b1 A6000000 		.long	0xa6
+ 933 00b5 04       		.uleb128 0x4
+ 934 00b6 00000000 		.long	.LASF15
+ 935 00ba 23       		.byte	0x23
+ 936 00bb A6000000 		.long	0xa6
+ 937 00bf 04       		.uleb128 0x4
+ 938 00c0 00000000 		.long	.LASF16
+ 939 00c4 25       		.byte	0x25
+ 940 00c5 A6000000 		.long	0xa6
+ 941 00c9 04       		.uleb128 0x4
+ 942 00ca 00000000 		.long	.LASF17
+GAS LISTING /tmp/ccoFiSH1.s 			page 62
+
+
+ 943 00ce 28       		.byte	0x28
+ 944 00cf A6000000 		.long	0xa6
+ 945 00d3 09       		.uleb128 0x9
+ 946 00d4 90000000 		.long	0x90
+ 947 00d8 E3000000 		.long	0xe3
+ 948 00dc 0D       		.uleb128 0xd
+ 949 00dd 31000000 		.long	0x31
+ 950 00e1 27       		.byte	0x27
+ 951 00e2 00       		.byte	0
+ 952 00e3 03       		.uleb128 0x3
+ 953 00e4 D3000000 		.long	0xd3
+ 954 00e8 02       		.uleb128 0x2
+ 955 00e9 00000000 		.long	.LASF18
+ 956 00ed 20       		.byte	0x20
+ 957 00ee 1C       		.byte	0x1c
+ 958 00ef E3000000 		.long	0xe3
+ 959 00f3 09       		.uleb128 0x9
+ 960 00f4 03       		.byte	0x3
+ 961 00f5 00000000 		.quad	discrete_data
+ 961      00000000 
+ 962 00fd 02       		.uleb128 0x2
+ 963 00fe 00000000 		.long	.LASF19
+ 964 0102 23       		.byte	0x23
+ 965 0103 24       		.byte	0x24
+ 966 0104 A1000000 		.long	0xa1
+ 967 0108 09       		.uleb128 0x9
+ 968 0109 03       		.byte	0x3
+ 969 010a 00000000 		.quad	discrete
+ 969      00000000 
+ 970 0112 05       		.uleb128 0x5
+ 971 0113 AB000000 		.long	0xab
+ 972 0117 24       		.byte	0x24
+ 973 0118 09       		.uleb128 0x9
+ 974 0119 03       		.byte	0x3
+ 975 011a 00000000 		.quad	heatmap_cs_YlOrBr_discrete
+ 975      00000000 
+ 976 0122 09       		.uleb128 0x9
+ 977 0123 90000000 		.long	0x90
+ 978 0127 33010000 		.long	0x133
+ 979 012b 0E       		.uleb128 0xe
+ 980 012c 31000000 		.long	0x31
+ 981 0130 0310     		.value	0x1003
+ 982 0132 00       		.byte	0
+ 983 0133 03       		.uleb128 0x3
+ 984 0134 22010000 		.long	0x122
+ 985 0138 02       		.uleb128 0x2
+ 986 0139 00000000 		.long	.LASF20
+ 987 013d 26       		.byte	0x26
+ 988 013e 1C       		.byte	0x1c
+ 989 013f 33010000 		.long	0x133
+ 990 0143 09       		.uleb128 0x9
+ 991 0144 03       		.byte	0x3
+ 992 0145 00000000 		.quad	soft_data
+ 992      00000000 
+ 993 014d 02       		.uleb128 0x2
+ 994 014e 00000000 		.long	.LASF21
+ 995 0152 29       		.byte	0x29
+GAS LISTING /tmp/ccoFiSH1.s 			page 63
+
+
+ 996 0153 24       		.byte	0x24
+ 997 0154 A1000000 		.long	0xa1
+ 998 0158 09       		.uleb128 0x9
+ 999 0159 03       		.byte	0x3
+ 1000 015a 00000000 		.quad	soft
+ 1000      00000000 
+ 1001 0162 05       		.uleb128 0x5
+ 1002 0163 B5000000 		.long	0xb5
+ 1003 0167 2A       		.byte	0x2a
+ 1004 0168 09       		.uleb128 0x9
+ 1005 0169 03       		.byte	0x3
+ 1006 016a 00000000 		.quad	heatmap_cs_YlOrBr_soft
+ 1006      00000000 
+ 1007 0172 02       		.uleb128 0x2
+ 1008 0173 00000000 		.long	.LASF22
+ 1009 0177 2C       		.byte	0x2c
+ 1010 0178 1C       		.byte	0x1c
+ 1011 0179 33010000 		.long	0x133
+ 1012 017d 09       		.uleb128 0x9
+ 1013 017e 03       		.byte	0x3
+ 1014 017f 00000000 		.quad	mixed_data
+ 1014      00000000 
+ 1015 0187 02       		.uleb128 0x2
+ 1016 0188 00000000 		.long	.LASF23
+ 1017 018c 2F       		.byte	0x2f
+ 1018 018d 24       		.byte	0x24
+ 1019 018e A1000000 		.long	0xa1
+ 1020 0192 09       		.uleb128 0x9
+ 1021 0193 03       		.byte	0x3
+ 1022 0194 00000000 		.quad	mixed
+ 1022      00000000 
+ 1023 019c 05       		.uleb128 0x5
+ 1024 019d BF000000 		.long	0xbf
+ 1025 01a1 30       		.byte	0x30
+ 1026 01a2 09       		.uleb128 0x9
+ 1027 01a3 03       		.byte	0x3
+ 1028 01a4 00000000 		.quad	heatmap_cs_YlOrBr_mixed
+ 1028      00000000 
+ 1029 01ac 02       		.uleb128 0x2
+ 1030 01ad 00000000 		.long	.LASF24
+ 1031 01b1 32       		.byte	0x32
+ 1032 01b2 1C       		.byte	0x1c
+ 1033 01b3 33010000 		.long	0x133
+ 1034 01b7 09       		.uleb128 0x9
+ 1035 01b8 03       		.byte	0x3
+ 1036 01b9 00000000 		.quad	mixed_exp_data
+ 1036      00000000 
+ 1037 01c1 02       		.uleb128 0x2
+ 1038 01c2 00000000 		.long	.LASF25
+ 1039 01c6 35       		.byte	0x35
+ 1040 01c7 24       		.byte	0x24
+ 1041 01c8 A1000000 		.long	0xa1
+ 1042 01cc 09       		.uleb128 0x9
+ 1043 01cd 03       		.byte	0x3
+ 1044 01ce 00000000 		.quad	mixed_exp
+ 1044      00000000 
+ 1045 01d6 05       		.uleb128 0x5
+GAS LISTING /tmp/ccoFiSH1.s 			page 64
+
+
+ 1046 01d7 C9000000 		.long	0xc9
+ 1047 01db 36       		.byte	0x36
+ 1048 01dc 09       		.uleb128 0x9
+ 1049 01dd 03       		.byte	0x3
+ 1050 01de 00000000 		.quad	heatmap_cs_YlOrBr_mixed_exp
+ 1050      00000000 
+ 1051 01e6 00       		.byte	0
+ 1052              		.section	.debug_abbrev,"",@progbits
+ 1053              	.Ldebug_abbrev0:
+ 1054 0000 01       		.uleb128 0x1
+ 1055 0001 24       		.uleb128 0x24
+ 1056 0002 00       		.byte	0
+ 1057 0003 0B       		.uleb128 0xb
+ 1058 0004 0B       		.uleb128 0xb
+ 1059 0005 3E       		.uleb128 0x3e
+ 1060 0006 0B       		.uleb128 0xb
+ 1061 0007 03       		.uleb128 0x3
+ 1062 0008 0E       		.uleb128 0xe
+ 1063 0009 00       		.byte	0
+ 1064 000a 00       		.byte	0
+ 1065 000b 02       		.uleb128 0x2
+ 1066 000c 34       		.uleb128 0x34
+ 1067 000d 00       		.byte	0
+ 1068 000e 03       		.uleb128 0x3
+ 1069 000f 0E       		.uleb128 0xe
+ 1070 0010 3A       		.uleb128 0x3a
+ 1071 0011 21       		.uleb128 0x21
+ 1072 0012 04       		.sleb128 4
+ 1073 0013 3B       		.uleb128 0x3b
+ 1074 0014 0B       		.uleb128 0xb
+ 1075 0015 39       		.uleb128 0x39
+ 1076 0016 0B       		.uleb128 0xb
+ 1077 0017 49       		.uleb128 0x49
+ 1078 0018 13       		.uleb128 0x13
+ 1079 0019 02       		.uleb128 0x2
+ 1080 001a 18       		.uleb128 0x18
+ 1081 001b 00       		.byte	0
+ 1082 001c 00       		.byte	0
+ 1083 001d 03       		.uleb128 0x3
+ 1084 001e 26       		.uleb128 0x26
+ 1085 001f 00       		.byte	0
+ 1086 0020 49       		.uleb128 0x49
+ 1087 0021 13       		.uleb128 0x13
+ 1088 0022 00       		.byte	0
+ 1089 0023 00       		.byte	0
+ 1090 0024 04       		.uleb128 0x4
+ 1091 0025 34       		.uleb128 0x34
+ 1092 0026 00       		.byte	0
+ 1093 0027 03       		.uleb128 0x3
+ 1094 0028 0E       		.uleb128 0xe
+ 1095 0029 3A       		.uleb128 0x3a
+ 1096 002a 21       		.uleb128 0x21
+ 1097 002b 03       		.sleb128 3
+ 1098 002c 3B       		.uleb128 0x3b
+ 1099 002d 0B       		.uleb128 0xb
+ 1100 002e 39       		.uleb128 0x39
+ 1101 002f 21       		.uleb128 0x21
+GAS LISTING /tmp/ccoFiSH1.s 			page 65
+
+
+ 1102 0030 25       		.sleb128 37
+ 1103 0031 49       		.uleb128 0x49
+ 1104 0032 13       		.uleb128 0x13
+ 1105 0033 3F       		.uleb128 0x3f
+ 1106 0034 19       		.uleb128 0x19
+ 1107 0035 3C       		.uleb128 0x3c
+ 1108 0036 19       		.uleb128 0x19
+ 1109 0037 00       		.byte	0
+ 1110 0038 00       		.byte	0
+ 1111 0039 05       		.uleb128 0x5
+ 1112 003a 34       		.uleb128 0x34
+ 1113 003b 00       		.byte	0
+ 1114 003c 47       		.uleb128 0x47
+ 1115 003d 13       		.uleb128 0x13
+ 1116 003e 3A       		.uleb128 0x3a
+ 1117 003f 21       		.uleb128 0x21
+ 1118 0040 04       		.sleb128 4
+ 1119 0041 3B       		.uleb128 0x3b
+ 1120 0042 0B       		.uleb128 0xb
+ 1121 0043 39       		.uleb128 0x39
+ 1122 0044 21       		.uleb128 0x21
+ 1123 0045 1E       		.sleb128 30
+ 1124 0046 02       		.uleb128 0x2
+ 1125 0047 18       		.uleb128 0x18
+ 1126 0048 00       		.byte	0
+ 1127 0049 00       		.byte	0
+ 1128 004a 06       		.uleb128 0x6
+ 1129 004b 16       		.uleb128 0x16
+ 1130 004c 00       		.byte	0
+ 1131 004d 03       		.uleb128 0x3
+ 1132 004e 0E       		.uleb128 0xe
+ 1133 004f 3A       		.uleb128 0x3a
+ 1134 0050 0B       		.uleb128 0xb
+ 1135 0051 3B       		.uleb128 0x3b
+ 1136 0052 0B       		.uleb128 0xb
+ 1137 0053 39       		.uleb128 0x39
+ 1138 0054 0B       		.uleb128 0xb
+ 1139 0055 49       		.uleb128 0x49
+ 1140 0056 13       		.uleb128 0x13
+ 1141 0057 00       		.byte	0
+ 1142 0058 00       		.byte	0
+ 1143 0059 07       		.uleb128 0x7
+ 1144 005a 0D       		.uleb128 0xd
+ 1145 005b 00       		.byte	0
+ 1146 005c 03       		.uleb128 0x3
+ 1147 005d 0E       		.uleb128 0xe
+ 1148 005e 3A       		.uleb128 0x3a
+ 1149 005f 21       		.uleb128 0x21
+ 1150 0060 01       		.sleb128 1
+ 1151 0061 3B       		.uleb128 0x3b
+ 1152 0062 0B       		.uleb128 0xb
+ 1153 0063 39       		.uleb128 0x39
+ 1154 0064 0B       		.uleb128 0xb
+ 1155 0065 49       		.uleb128 0x49
+ 1156 0066 13       		.uleb128 0x13
+ 1157 0067 38       		.uleb128 0x38
+ 1158 0068 0B       		.uleb128 0xb
+GAS LISTING /tmp/ccoFiSH1.s 			page 66
+
+
+ 1159 0069 00       		.byte	0
+ 1160 006a 00       		.byte	0
+ 1161 006b 08       		.uleb128 0x8
+ 1162 006c 0F       		.uleb128 0xf
+ 1163 006d 00       		.byte	0
+ 1164 006e 0B       		.uleb128 0xb
+ 1165 006f 21       		.uleb128 0x21
+ 1166 0070 08       		.sleb128 8
+ 1167 0071 49       		.uleb128 0x49
+ 1168 0072 13       		.uleb128 0x13
+ 1169 0073 00       		.byte	0
+ 1170 0074 00       		.byte	0
+ 1171 0075 09       		.uleb128 0x9
+ 1172 0076 01       		.uleb128 0x1
+ 1173 0077 01       		.byte	0x1
+ 1174 0078 49       		.uleb128 0x49
+ 1175 0079 13       		.uleb128 0x13
+ 1176 007a 01       		.uleb128 0x1
+ 1177 007b 13       		.uleb128 0x13
+ 1178 007c 00       		.byte	0
+ 1179 007d 00       		.byte	0
+ 1180 007e 0A       		.uleb128 0xa
+ 1181 007f 11       		.uleb128 0x11
+ 1182 0080 01       		.byte	0x1
+ 1183 0081 25       		.uleb128 0x25
+ 1184 0082 0E       		.uleb128 0xe
+ 1185 0083 13       		.uleb128 0x13
+ 1186 0084 0B       		.uleb128 0xb
+ 1187 0085 03       		.uleb128 0x3
+ 1188 0086 1F       		.uleb128 0x1f
+ 1189 0087 1B       		.uleb128 0x1b
+ 1190 0088 1F       		.uleb128 0x1f
+ 1191 0089 10       		.uleb128 0x10
+ 1192 008a 17       		.uleb128 0x17
+ 1193 008b 00       		.byte	0
+ 1194 008c 00       		.byte	0
+ 1195 008d 0B       		.uleb128 0xb
+ 1196 008e 24       		.uleb128 0x24
+ 1197 008f 00       		.byte	0
+ 1198 0090 0B       		.uleb128 0xb
+ 1199 0091 0B       		.uleb128 0xb
+ 1200 0092 3E       		.uleb128 0x3e
+ 1201 0093 0B       		.uleb128 0xb
+ 1202 0094 03       		.uleb128 0x3
+ 1203 0095 08       		.uleb128 0x8
+ 1204 0096 00       		.byte	0
+ 1205 0097 00       		.byte	0
+ 1206 0098 0C       		.uleb128 0xc
+ 1207 0099 13       		.uleb128 0x13
+ 1208 009a 01       		.byte	0x1
+ 1209 009b 0B       		.uleb128 0xb
+ 1210 009c 0B       		.uleb128 0xb
+ 1211 009d 3A       		.uleb128 0x3a
+ 1212 009e 0B       		.uleb128 0xb
+ 1213 009f 3B       		.uleb128 0x3b
+ 1214 00a0 0B       		.uleb128 0xb
+ 1215 00a1 39       		.uleb128 0x39
+GAS LISTING /tmp/ccoFiSH1.s 			page 67
+
+
+ 1216 00a2 0B       		.uleb128 0xb
+ 1217 00a3 01       		.uleb128 0x1
+ 1218 00a4 13       		.uleb128 0x13
+ 1219 00a5 00       		.byte	0
+ 1220 00a6 00       		.byte	0
+ 1221 00a7 0D       		.uleb128 0xd
+ 1222 00a8 21       		.uleb128 0x21
+ 1223 00a9 00       		.byte	0
+ 1224 00aa 49       		.uleb128 0x49
+ 1225 00ab 13       		.uleb128 0x13
+ 1226 00ac 2F       		.uleb128 0x2f
+ 1227 00ad 0B       		.uleb128 0xb
+ 1228 00ae 00       		.byte	0
+ 1229 00af 00       		.byte	0
+ 1230 00b0 0E       		.uleb128 0xe
+ 1231 00b1 21       		.uleb128 0x21
+ 1232 00b2 00       		.byte	0
+ 1233 00b3 49       		.uleb128 0x49
+ 1234 00b4 13       		.uleb128 0x13
+ 1235 00b5 2F       		.uleb128 0x2f
+ 1236 00b6 05       		.uleb128 0x5
+ 1237 00b7 00       		.byte	0
+ 1238 00b8 00       		.byte	0
+ 1239 00b9 00       		.byte	0
+ 1240              		.section	.debug_aranges,"",@progbits
+ 1241 0000 1C000000 		.long	0x1c
+ 1242 0004 0200     		.value	0x2
+ 1243 0006 00000000 		.long	.Ldebug_info0
+ 1244 000a 08       		.byte	0x8
+ 1245 000b 00       		.byte	0
+ 1246 000c 0000     		.value	0
+ 1247 000e 0000     		.value	0
+ 1248 0010 00000000 		.quad	0
+ 1248      00000000 
+ 1249 0018 00000000 		.quad	0
+ 1249      00000000 
+ 1250              		.section	.debug_line,"",@progbits
+ 1251              	.Ldebug_line0:
+ 1252 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1252      05000800 
+ 1252      49000000 
+ 1252      010101FB 
+ 1252      0E0D0001 
+ 1253              	.LASF20:
+ 1254 0000 736F6674 		.string	"soft_data"
+ 1254      5F646174 
+ 1254      6100
+ 1255              	.LASF12:
+ 1256 000a 73697A65 		.string	"size_t"
+ 1256      5F7400
+ 1257              	.LASF13:
+ 1258 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1258      6D61705F 
+ 1258      636F6C6F 
+ 1258      72736368 
+ 1258      656D655F 
+ 1259              	.LASF24:
+GAS LISTING /tmp/ccoFiSH1.s 			page 68
+
+
+ 1260 0027 6D697865 		.string	"mixed_exp_data"
+ 1260      645F6578 
+ 1260      705F6461 
+ 1260      746100
+ 1261              	.LASF26:
+ 1262 0036 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1262      43313720 
+ 1262      31322E32 
+ 1262      2E30202D 
+ 1262      6D74756E 
+ 1263              	.LASF6:
+ 1264 0095 666C6F61 		.string	"float"
+ 1264      7400
+ 1265              	.LASF11:
+ 1266 009b 756E7369 		.string	"unsigned char"
+ 1266      676E6564 
+ 1266      20636861 
+ 1266      7200
+ 1267              	.LASF15:
+ 1268 00a9 68656174 		.string	"heatmap_cs_YlOrBr_soft"
+ 1268      6D61705F 
+ 1268      63735F59 
+ 1268      6C4F7242 
+ 1268      725F736F 
+ 1269              	.LASF3:
+ 1270 00c0 6C6F6E67 		.string	"long unsigned int"
+ 1270      20756E73 
+ 1270      69676E65 
+ 1270      6420696E 
+ 1270      7400
+ 1271              	.LASF8:
+ 1272 00d2 73686F72 		.string	"short unsigned int"
+ 1272      7420756E 
+ 1272      7369676E 
+ 1272      65642069 
+ 1272      6E7400
+ 1273              	.LASF25:
+ 1274 00e5 6D697865 		.string	"mixed_exp"
+ 1274      645F6578 
+ 1274      7000
+ 1275              	.LASF23:
+ 1276 00ef 6D697865 		.string	"mixed"
+ 1276      6400
+ 1277              	.LASF7:
+ 1278 00f5 756E7369 		.string	"unsigned int"
+ 1278      676E6564 
+ 1278      20696E74 
+ 1278      00
+ 1279              	.LASF19:
+ 1280 0102 64697363 		.string	"discrete"
+ 1280      72657465 
+ 1280      00
+ 1281              	.LASF14:
+ 1282 010b 68656174 		.string	"heatmap_cs_YlOrBr_discrete"
+ 1282      6D61705F 
+ 1282      63735F59 
+ 1282      6C4F7242 
+GAS LISTING /tmp/ccoFiSH1.s 			page 69
+
+
+ 1282      725F6469 
+ 1283              	.LASF10:
+ 1284 0126 6E636F6C 		.string	"ncolors"
+ 1284      6F727300 
+ 1285              	.LASF4:
+ 1286 012e 6C6F6E67 		.string	"long long int"
+ 1286      206C6F6E 
+ 1286      6720696E 
+ 1286      7400
+ 1287              	.LASF17:
+ 1288 013c 68656174 		.string	"heatmap_cs_YlOrBr_mixed_exp"
+ 1288      6D61705F 
+ 1288      63735F59 
+ 1288      6C4F7242 
+ 1288      725F6D69 
+ 1289              	.LASF16:
+ 1290 0158 68656174 		.string	"heatmap_cs_YlOrBr_mixed"
+ 1290      6D61705F 
+ 1290      63735F59 
+ 1290      6C4F7242 
+ 1290      725F6D69 
+ 1291              	.LASF22:
+ 1292 0170 6D697865 		.string	"mixed_data"
+ 1292      645F6461 
+ 1292      746100
+ 1293              	.LASF2:
+ 1294 017b 6C6F6E67 		.string	"long int"
+ 1294      20696E74 
+ 1294      00
+ 1295              	.LASF5:
+ 1296 0184 6C6F6E67 		.string	"long double"
+ 1296      20646F75 
+ 1296      626C6500 
+ 1297              	.LASF18:
+ 1298 0190 64697363 		.string	"discrete_data"
+ 1298      72657465 
+ 1298      5F646174 
+ 1298      6100
+ 1299              	.LASF21:
+ 1300 019e 736F6674 		.string	"soft"
+ 1300      00
+ 1301              	.LASF9:
+ 1302 01a3 636F6C6F 		.string	"colors"
+ 1302      727300
+ 1303              		.section	.debug_line_str,"MS",@progbits,1
+ 1304              	.LASF1:
+ 1305 0000 2F726F6F 		.string	"/root/repo"
+ 1305      742F7265 
+ 1305      706F00
+ 1306              	.LASF0:
+ 1307 000b 636F6C6F 		.string	"colorschemes/YlOrBr.c"
+ 1307      72736368 
+ 1307      656D6573 
+ 1307      2F596C4F 
+ 1307      7242722E 
+ 1308              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1309 0021 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+GAS LISTING /tmp/ccoFiSH1.s 			page 70
+
+
+ 1309      742F7265 
+ 1309      706F0063 
+ 1309      6F6C6F72 
+ 1309      73636865 
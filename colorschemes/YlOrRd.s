@@ -0,0 +1,4079 @@
+GAS LISTING /tmp/ccPN994e.s 			page 1
+
+
+   1              		.file	"YlOrRd.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/YlOrRd.c"
+   5              		.globl	heatmap_cs_YlOrRd_mixed_exp
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_YlOrRd_mixed_exp, @object
+   9              		.size	heatmap_cs_YlOrRd_mixed_exp, 8
+  10              	heatmap_cs_YlOrRd_mixed_exp:
+  11 0000 00000000 		.quad	mixed_exp
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	mixed_exp, @object
+  15              		.size	mixed_exp, 16
+  16              	mixed_exp:
+  17 0000 00000000 		.quad	mixed_exp_data
+  17      00000000 
+  18 0008 01040000 		.quad	1025
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	mixed_exp_data, @object
+  22              		.size	mixed_exp_data, 4100
+  23              	mixed_exp_data:
+  24 0000 00       		.string	""
+  25 0001 00       		.string	""
+  26 0002 00       		.string	""
+  27 0003 00       		.string	""
+  28 0004 7F00     		.string	"\177"
+  29 0006 2500     		.string	"%"
+  30 0008 8300     		.string	"\203"
+  31 000a 26188700 		.string	"&\030\207"
+  32 000e 26318B00 		.string	"&1\213"
+  33 0012 264A8F00 		.string	"&J\217"
+  34 0016 27639200 		.string	"'c\222"
+  35 001a 277C9600 		.string	"'|\226"
+  36 001e 2795A600 		.string	"'\225\246"
+  37 0022 27AEA900 		.string	"'\256\251"
+  38 0026 27C7AD00 		.string	"'\307\255"
+  39 002a 27E0B000 		.string	"'\340\260"
+  40 002e 26F9B400 		.string	"&\371\264"
+  41 0032 26FFB700 		.string	"&\377\267"
+  42 0036 26FFBB00 		.string	"&\377\273"
+  43 003a 26FFBD00 		.string	"&\377\275"
+  44 003e 25FFC001 		.ascii	"%\377\300\001%\377\302\002%\377\304\003$\377\306\004$\377\310"
+  44      25FFC202 
+  44      25FFC403 
+  44      24FFC604 
+  44      24FFC8
+  45 0051 0623FFCA 		.ascii	"\006#\377\312\007#\377\314\t#\377\325\020 \377\327\021\037\377"
+  45      0723FFCC 
+  45      0923FFD5 
+  45      1020FFD7 
+  45      111FFF
+  46 0064 D9131FFF 		.ascii	"\331\023\037\377\333\024\036\377\335\025\036\377\337\027\035"
+GAS LISTING /tmp/ccPN994e.s 			page 2
+
+
+  46      DB141EFF 
+  46      DD151EFF 
+  46      DF171D
+  47 0073 FFE1181C 		.ascii	"\377\341\030\034\377\342\031\034\377\344\035\034\377\345 \035"
+  47      FFE2191C 
+  47      FFE41D1C 
+  47      FFE5201D 
+  48 0083 FFE6241D 		.ascii	"\377\346$\035\377\347&\036\377\350)\037\377\352+\037\377\353"
+  48      FFE7261E 
+  48      FFE8291F 
+  48      FFEA2B1F 
+  48      FFEB
+  49 0095 2E20FFEC 		.ascii	". \377\3540 \377\362=$\377\363?$\377\364A%\377\365C&\377\366"
+  49      3020FFF2 
+  49      3D24FFF3 
+  49      3F24FFF4 
+  49      4125FFF5 
+  50 00ad 4526FFF7 		.ascii	"E&\377\367G'\377\370H(\377\371J(\377\372L)\377\373M)\377\374"
+  50      4727FFF8 
+  50      4828FFF9 
+  50      4A28FFFA 
+  50      4C29FFFB 
+  51 00c5 512AFFFC 		.ascii	"Q*\377\374T*\377\374W*\377\374Z+\377\374\\+\377\374_+\377\374"
+  51      542AFFFC 
+  51      572AFFFC 
+  51      5A2BFFFC 
+  51      5C2BFFFC 
+  52 00dd 612CFFFC 		.ascii	"a,\377\374d,\377\374f-\377\374i.\377\374w2\377\374z3\377\374"
+  52      642CFFFC 
+  52      662DFFFC 
+  52      692EFFFC 
+  52      7732FFFC 
+  53 00f5 7C33FFFC 		.ascii	"|3\377\374~4\377\374\2005\377\374\2026\377\375\2047\377\375\206"
+  53      7E34FFFC 
+  53      8035FFFC 
+  53      8236FFFD 
+  53      8437FFFD 
+  54 010a 38FFFD88 		.ascii	"8\377\375\2109\377\375\212:\377\375\213;\377\375\215<\377\375"
+  54      39FFFD8A 
+  54      3AFFFD8B 
+  54      3BFFFD8D 
+  54      3CFFFD
+  55 011d 8E3CFFFD 		.ascii	"\216<\377\375\220<\377\375\221=\377\375\222=\377\375\223=\377"
+  55      903CFFFD 
+  55      913DFFFD 
+  55      923DFFFD 
+  55      933DFF
+  56 0130 FD943EFF 		.ascii	"\375\224>\377\375\226>\377\375\227?\377\375\230?\377\375\231"
+  56      FD963EFF 
+  56      FD973FFF 
+  56      FD983FFF 
+  56      FD99
+  57 0142 40FFFD9A 		.ascii	"@\377\375\232@\377\375\233@\377\375\244D\377\375\245E\377\375"
+  57      40FFFD9B 
+  57      40FFFDA4 
+  57      44FFFDA5 
+  57      45FFFD
+GAS LISTING /tmp/ccPN994e.s 			page 3
+
+
+  58 0155 A645FFFD 		.ascii	"\246E\377\375\247F\377\375\250F\377\375\251G\377\375\252G\377"
+  58      A746FFFD 
+  58      A846FFFD 
+  58      A947FFFD 
+  58      AA47FF
+  59 0168 FDAB48FF 		.ascii	"\375\253H\377\375\254H\377\375\255I\377\375\256I\377\376\257"
+  59      FDAC48FF 
+  59      FDAD49FF 
+  59      FDAE49FF 
+  59      FEAF
+  60 017a 4AFFFEB0 		.ascii	"J\377\376\260K\377\376\261K\377\375\262L\377\375\263M\377\375"
+  60      4BFFFEB1 
+  60      4BFFFDB2 
+  60      4CFFFDB3 
+  60      4DFFFD
+  61 018d B44EFFFD 		.ascii	"\264N\377\375\265O\377\375\266P\377\375\267P\377\375\270Q\377"
+  61      B54FFFFD 
+  61      B650FFFD 
+  61      B750FFFD 
+  61      B851FF
+  62 01a0 FDB952FF 		.ascii	"\375\271R\377\375\272S\377\375\273T\377\375\274U\377\375\275"
+  62      FDBA53FF 
+  62      FDBB54FF 
+  62      FDBC55FF 
+  62      FDBD
+  63 01b2 56FFFDBE 		.ascii	"V\377\375\276W\377\375\276X\377\375\277Y\377\375\300Z\377\375"
+  63      57FFFDBE 
+  63      58FFFDBF 
+  63      59FFFDC0 
+  63      5AFFFD
+  64 01c5 C15BFFFD 		.ascii	"\301[\377\375\312d\377\375\313e\377\375\313f\377\375\314g\377"
+  64      CA64FFFD 
+  64      CB65FFFD 
+  64      CB66FFFD 
+  64      CC67FF
+  65 01d8 FDCD68FF 		.ascii	"\375\315h\377\375\316i\377\375\317j\377\375\317k\377\375\320"
+  65      FDCE69FF 
+  65      FDCF6AFF 
+  65      FDCF6BFF 
+  65      FDD0
+  66 01ea 6BFFFDD1 		.ascii	"k\377\375\321l\377\375\322m\377\375\322n\377\375\323o\377\375"
+  66      6CFFFDD2 
+  66      6DFFFDD2 
+  66      6EFFFDD3 
+  66      6FFFFD
+  67 01fd D470FFFD 		.ascii	"\324p\377\375\325q\377\375\325r\377\375\326r\377\375\327s\377"
+  67      D571FFFD 
+  67      D572FFFD 
+  67      D672FFFD 
+  67      D773FF
+  68 0210 FDD774FF 		.ascii	"\375\327t\377\375\330u\377\375\331v\377\375\331w\377\375\331"
+  68      FDD875FF 
+  68      FDD976FF 
+  68      FDD977FF 
+  68      FDD9
+  69 0222 77FFFDDA 		.ascii	"w\377\375\332x\377\375\332y\377\375\332y\377\375\333z\377\375"
+  69      78FFFDDA 
+GAS LISTING /tmp/ccPN994e.s 			page 4
+
+
+  69      79FFFDDA 
+  69      79FFFDDB 
+  69      7AFFFD
+  70 0235 DB7BFFFD 		.ascii	"\333{\377\375\334|\377\375\334|\377\375\334}\377\375\335~\377"
+  70      DC7CFFFD 
+  70      DC7CFFFD 
+  70      DC7DFFFD 
+  70      DD7EFF
+  71 0248 FDDD7EFF 		.ascii	"\375\335~\377\375\335\177\377\375\335\200\377\375\336\200\377"
+  71      FDDD7FFF 
+  71      FDDD80FF 
+  71      FDDE80FF 
+  72 0258 FEDE81FF 		.ascii	"\376\336\201\377\376\336\201\377\376\337\202\377\376\337\203"
+  72      FEDE81FF 
+  72      FEDF82FF 
+  72      FEDF83
+  73 0267 FFFEDF83 		.ascii	"\377\376\337\203\377\376\340\204\377\376\340\205\377\376\340"
+  73      FFFEE084 
+  73      FFFEE085 
+  73      FFFEE0
+  74 0276 85FFFEE0 		.ascii	"\205\377\376\340\206\377\376\345\217\377\376\345\217\377\376"
+  74      86FFFEE5 
+  74      8FFFFEE5 
+  74      8FFFFE
+  75 0285 E590FFFE 		.ascii	"\345\220\377\376\346\220\377\376\346\221\377\376\346\222\377"
+  75      E690FFFE 
+  75      E691FFFE 
+  75      E692FF
+  76 0294 FEE692FF 		.ascii	"\376\346\222\377\376\347\223\377\376\347\223\377\376\347\224"
+  76      FEE793FF 
+  76      FEE793FF 
+  76      FEE794
+  77 02a3 FFFEE794 		.ascii	"\377\376\347\224\377\376\350\225\377\376\350\225\377\376\350"
+  77      FFFEE895 
+  77      FFFEE895 
+  77      FFFEE8
+  78 02b2 96FFFEE8 		.ascii	"\226\377\376\350\226\377\376\351\227\377\376\351\227\377\376"
+  78      96FFFEE9 
+  78      97FFFEE9 
+  78      97FFFE
+  79 02c1 E998FFFE 		.ascii	"\351\230\377\376\351\230\377\376\351\231\377\376\352\231\377"
+  79      E998FFFE 
+  79      E999FFFE 
+  79      EA99FF
+  80 02d0 FEEA9AFF 		.ascii	"\376\352\232\377\376\352\232\377\376\352\233\377\376\352\233"
+  80      FEEA9AFF 
+  80      FEEA9BFF 
+  80      FEEA9B
+  81 02df FFFEEB9C 		.ascii	"\377\376\353\234\377\376\353\234\377\376\353\234\377\376\353"
+  81      FFFEEB9C 
+  81      FFFEEB9C 
+  81      FFFEEB
+  82 02ee 9DFFFEEC 		.ascii	"\235\377\376\354\235\377\376\354\236\377\376\354\236\377\376"
+  82      9DFFFEEC 
+  82      9EFFFEEC 
+  82      9EFFFE
+  83 02fd EC9FFFFE 		.ascii	"\354\237\377\376\354\237\377\376\354\237\377\376\355\240\377"
+GAS LISTING /tmp/ccPN994e.s 			page 5
+
+
+  83      EC9FFFFE 
+  83      EC9FFFFE 
+  83      EDA0FF
+  84 030c FEEDA0FF 		.ascii	"\376\355\240\377\376\355\241\377\376\355\241\377\376\355\241"
+  84      FEEDA1FF 
+  84      FEEDA1FF 
+  84      FEEDA1
+  85 031b FFFEEEA2 		.ascii	"\377\376\356\242\377\376\356\242\377\376\356\243\377\376\356"
+  85      FFFEEEA2 
+  85      FFFEEEA3 
+  85      FFFEEE
+  86 032a A3FFFEEE 		.ascii	"\243\377\376\356\243\377\376\356\244\377\376\357\244\377\376"
+  86      A3FFFEEE 
+  86      A4FFFEEF 
+  86      A4FFFE
+  87 0339 EFA4FFFE 		.ascii	"\357\244\377\376\357\245\377\376\357\245\377\376\357\246\377"
+  87      EFA5FFFE 
+  87      EFA5FFFE 
+  87      EFA6FF
+  88 0348 FEEFA6FF 		.ascii	"\376\357\246\377\376\357\246\377\376\360\247\377\376\360\247"
+  88      FEEFA6FF 
+  88      FEF0A7FF 
+  88      FEF0A7
+  89 0357 FFFEF0A7 		.ascii	"\377\376\360\247\377\376\360\250\377\376\360\250\377\376\360"
+  89      FFFEF0A8 
+  89      FFFEF0A8 
+  89      FFFEF0
+  90 0366 A8FFFEF0 		.ascii	"\250\377\376\360\251\377\376\361\251\377\376\361\251\377\376"
+  90      A9FFFEF1 
+  90      A9FFFEF1 
+  90      A9FFFE
+  91 0375 F1AAFFFE 		.ascii	"\361\252\377\376\361\252\377\376\361\252\377\376\361\252\377"
+  91      F1AAFFFE 
+  91      F1AAFFFE 
+  91      F1AAFF
+  92 0384 FEF1ABFF 		.ascii	"\376\361\253\377\376\362\253\377\376\362\253\377\376\362\254"
+  92      FEF2ABFF 
+  92      FEF2ABFF 
+  92      FEF2AC
+  93 0393 FFFEF2AC 		.ascii	"\377\376\362\254\377\376\362\254\377\376\362\255\377\376\362"
+  93      FFFEF2AC 
+  93      FFFEF2AD 
+  93      FFFEF2
+  94 03a2 ADFFFEF2 		.ascii	"\255\377\376\362\255\377\376\362\255\377\376\363\256\377\376"
+  94      ADFFFEF2 
+  94      ADFFFEF3 
+  94      AEFFFE
+  95 03b1 F3AEFFFE 		.ascii	"\363\256\377\376\363\256\377\376\363\256\377\376\363\257\377"
+  95      F3AEFFFE 
+  95      F3AEFFFE 
+  95      F3AFFF
+  96 03c0 FEF3AFFF 		.ascii	"\376\363\257\377\376\363\257\377\376\363\257\377\376\363\260"
+  96      FEF3AFFF 
+  96      FEF3AFFF 
+  96      FEF3B0
+  97 03cf FFFEF4B0 		.ascii	"\377\376\364\260\377\376\364\260\377\376\364\260\377\376\364"
+  97      FFFEF4B0 
+GAS LISTING /tmp/ccPN994e.s 			page 6
+
+
+  97      FFFEF4B0 
+  97      FFFEF4
+  98 03de B1FFFEF4 		.ascii	"\261\377\376\364\261\377\376\370\272\377\376\370\272\377\376"
+  98      B1FFFEF8 
+  98      BAFFFEF8 
+  98      BAFFFE
+  99 03ed F8BAFFFE 		.ascii	"\370\272\377\376\370\273\377\376\370\273\377\376\370\273\377"
+  99      F8BBFFFE 
+  99      F8BBFFFE 
+  99      F8BBFF
+ 100 03fc FEF8BBFF 		.ascii	"\376\370\273\377\376\370\273\377\376\370\274\377\376\370\274"
+ 100      FEF8BBFF 
+ 100      FEF8BCFF 
+ 100      FEF8BC
+ 101 040b FFFEF8BC 		.ascii	"\377\376\370\274\377\376\371\274\377\376\371\274\377\376\371"
+ 101      FFFEF9BC 
+ 101      FFFEF9BC 
+ 101      FFFEF9
+ 102 041a BDFFFEF9 		.ascii	"\275\377\376\371\275\377\376\371\275\377\376\371\275\377\376"
+ 102      BDFFFEF9 
+ 102      BDFFFEF9 
+ 102      BDFFFE
+ 103 0429 F9BDFFFE 		.ascii	"\371\275\377\376\371\276\377\376\371\276\377\376\371\276\377"
+ 103      F9BEFFFE 
+ 103      F9BEFFFE 
+ 103      F9BEFF
+ 104 0438 FEF9BEFF 		.ascii	"\376\371\276\377\376\371\276\377\376\371\276\377\376\372\277"
+ 104      FEF9BEFF 
+ 104      FEF9BEFF 
+ 104      FEFABF
+ 105 0447 FFFEFABF 		.ascii	"\377\376\372\277\377\376\372\277\377\376\372\277\377\376\372"
+ 105      FFFEFABF 
+ 105      FFFEFABF 
+ 105      FFFEFA
+ 106 0456 BFFFFEFA 		.ascii	"\277\377\376\372\277\377\376\372\300\377\376\372\300\377\376"
+ 106      BFFFFEFA 
+ 106      C0FFFEFA 
+ 106      C0FFFE
+ 107 0465 FAC0FFFE 		.ascii	"\372\300\377\376\372\300\377\376\372\300\377\376\372\300\377"
+ 107      FAC0FFFE 
+ 107      FAC0FFFE 
+ 107      FAC0FF
+ 108 0474 FEFAC1FF 		.ascii	"\376\372\301\377\376\372\301\377\376\372\301\377\376\372\301"
+ 108      FEFAC1FF 
+ 108      FEFAC1FF 
+ 108      FEFAC1
+ 109 0483 FFFEFBC1 		.ascii	"\377\376\373\301\377\376\373\301\377\376\373\301\377\376\373"
+ 109      FFFEFBC1 
+ 109      FFFEFBC1 
+ 109      FFFEFB
+ 110 0492 C2FFFEFB 		.ascii	"\302\377\376\373\302\377\376\373\302\377\376\373\302\377\376"
+ 110      C2FFFEFB 
+ 110      C2FFFEFB 
+ 110      C2FFFE
+ 111 04a1 FBC2FFFE 		.ascii	"\373\302\377\376\373\302\377\376\373\302\377\376\373\302\377"
+ 111      FBC2FFFE 
+ 111      FBC2FFFE 
+GAS LISTING /tmp/ccPN994e.s 			page 7
+
+
+ 111      FBC2FF
+ 112 04b0 FEFBC3FF 		.ascii	"\376\373\303\377\376\373\303\377\376\373\303\377\376\373\303"
+ 112      FEFBC3FF 
+ 112      FEFBC3FF 
+ 112      FEFBC3
+ 113 04bf FFFEFBC3 		.ascii	"\377\376\373\303\377\376\373\303\377\376\373\303\377\376\373"
+ 113      FFFEFBC3 
+ 113      FFFEFBC3 
+ 113      FFFEFB
+ 114 04ce C3FFFEFB 		.ascii	"\303\377\376\373\304\377\376\373\304\377\376\374\304\377\376"
+ 114      C4FFFEFB 
+ 114      C4FFFEFC 
+ 114      C4FFFE
+ 115 04dd FCC4FFFE 		.ascii	"\374\304\377\376\374\304\377\376\374\304\377\376\374\304\377"
+ 115      FCC4FFFE 
+ 115      FCC4FFFE 
+ 115      FCC4FF
+ 116 04ec FEFCC4FF 		.ascii	"\376\374\304\377\376\374\304\377\376\374\304\377\376\374\305"
+ 116      FEFCC4FF 
+ 116      FEFCC4FF 
+ 116      FEFCC5
+ 117 04fb FFFEFCC5 		.ascii	"\377\376\374\305\377\376\374\305\377\376\374\305\377\376\374"
+ 117      FFFEFCC5 
+ 117      FFFEFCC5 
+ 117      FFFEFC
+ 118 050a C5FFFEFC 		.ascii	"\305\377\376\374\305\377\376\374\305\377\376\374\305\377\376"
+ 118      C5FFFEFC 
+ 118      C5FFFEFC 
+ 118      C5FFFE
+ 119 0519 FCC5FFFE 		.ascii	"\374\305\377\376\374\305\377\376\374\305\377\376\374\306\377"
+ 119      FCC5FFFE 
+ 119      FCC5FFFE 
+ 119      FCC6FF
+ 120 0528 FEFCC6FF 		.ascii	"\376\374\306\377\376\374\306\377\376\374\306\377\376\374\306"
+ 120      FEFCC6FF 
+ 120      FEFCC6FF 
+ 120      FEFCC6
+ 121 0537 FFFEFCC6 		.ascii	"\377\376\374\306\377\376\374\306\377\376\374\306\377\376\374"
+ 121      FFFEFCC6 
+ 121      FFFEFCC6 
+ 121      FFFEFC
+ 122 0546 C6FFFEFD 		.ascii	"\306\377\376\375\306\377\376\375\306\377\376\375\306\377\376"
+ 122      C6FFFEFD 
+ 122      C6FFFEFD 
+ 122      C6FFFE
+ 123 0555 FDC7FFFE 		.ascii	"\375\307\377\376\375\307\377\376\375\307\377\376\375\307\377"
+ 123      FDC7FFFE 
+ 123      FDC7FFFE 
+ 123      FDC7FF
+ 124 0564 FEFDC7FF 		.ascii	"\376\375\307\377\376\375\307\377\376\375\307\377\376\375\307"
+ 124      FEFDC7FF 
+ 124      FEFDC7FF 
+ 124      FEFDC7
+ 125 0573 FFFEFDC7 		.ascii	"\377\376\375\307\377\376\375\307\377\376\375\307\377\376\375"
+ 125      FFFEFDC7 
+ 125      FFFEFDC7 
+ 125      FFFEFD
+GAS LISTING /tmp/ccPN994e.s 			page 8
+
+
+ 126 0582 C7FFFEFD 		.ascii	"\307\377\376\375\307\377\376\375\307\377\376\375\307\377\376"
+ 126      C7FFFEFD 
+ 126      C7FFFEFD 
+ 126      C7FFFE
+ 127 0591 FDC8FFFE 		.ascii	"\375\310\377\376\375\310\377\376\375\310\377\376\375\310\377"
+ 127      FDC8FFFE 
+ 127      FDC8FFFE 
+ 127      FDC8FF
+ 128 05a0 FEFDC8FF 		.ascii	"\376\375\310\377\376\375\310\377\376\375\310\377\376\375\310"
+ 128      FEFDC8FF 
+ 128      FEFDC8FF 
+ 128      FEFDC8
+ 129 05af FFFEFDC8 		.ascii	"\377\376\375\310\377\376\375\310\377\376\375\310\377\376\375"
+ 129      FFFEFDC8 
+ 129      FFFEFDC8 
+ 129      FFFEFD
+ 130 05be C8FFFEFD 		.ascii	"\310\377\376\375\310\377\376\375\310\377\376\375\310\377\376"
+ 130      C8FFFEFD 
+ 130      C8FFFEFD 
+ 130      C8FFFE
+ 131 05cd FDC8FFFE 		.ascii	"\375\310\377\376\375\310\377\376\375\310\377\376\375\310\377"
+ 131      FDC8FFFE 
+ 131      FDC8FFFE 
+ 131      FDC8FF
+ 132 05dc FEFDC9FF 		.ascii	"\376\375\311\377\376\375\311\377\376\375\311\377\376\375\311"
+ 132      FEFDC9FF 
+ 132      FEFDC9FF 
+ 132      FEFDC9
+ 133 05eb FFFEFDC9 		.ascii	"\377\376\375\311\377\376\375\311\377\376\375\311\377\376\375"
+ 133      FFFEFDC9 
+ 133      FFFEFDC9 
+ 133      FFFEFD
+ 134 05fa C9FFFEFE 		.ascii	"\311\377\376\376\311\377\376\376\311\377\376\376\311\377\376"
+ 134      C9FFFEFE 
+ 134      C9FFFEFE 
+ 134      C9FFFE
+ 135 0609 FEC9FFFE 		.ascii	"\376\311\377\376\376\311\377\376\376\311\377\376\376\311\377"
+ 135      FEC9FFFE 
+ 135      FEC9FFFE 
+ 135      FEC9FF
+ 136 0618 FEFEC9FF 		.ascii	"\376\376\311\377\376\376\311\377\376\376\311\377\376\376\311"
+ 136      FEFEC9FF 
+ 136      FEFEC9FF 
+ 136      FEFEC9
+ 137 0627 FFFEFEC9 		.ascii	"\377\376\376\311\377\376\376\311\377\376\376\311\377\376\376"
+ 137      FFFEFEC9 
+ 137      FFFEFEC9 
+ 137      FFFEFE
+ 138 0636 C9FFFEFE 		.ascii	"\311\377\376\376\311\377\376\376\311\377\376\376\311\377\376"
+ 138      C9FFFEFE 
+ 138      C9FFFEFE 
+ 138      C9FFFE
+ 139 0645 FECAFFFE 		.ascii	"\376\312\377\376\376\312\377\376\376\312\377\376\376\312\377"
+ 139      FECAFFFE 
+ 139      FECAFFFE 
+ 139      FECAFF
+ 140 0654 FEFECAFF 		.ascii	"\376\376\312\377\376\376\312\377\376\376\312\377\376\376\312"
+GAS LISTING /tmp/ccPN994e.s 			page 9
+
+
+ 140      FEFECAFF 
+ 140      FEFECAFF 
+ 140      FEFECA
+ 141 0663 FFFEFECA 		.ascii	"\377\376\376\312\377\376\376\312\377\376\376\312\377\376\376"
+ 141      FFFEFECA 
+ 141      FFFEFECA 
+ 141      FFFEFE
+ 142 0672 CAFFFEFE 		.ascii	"\312\377\376\376\312\377\376\376\312\377\376\376\312\377\376"
+ 142      CAFFFEFE 
+ 142      CAFFFEFE 
+ 142      CAFFFE
+ 143 0681 FECAFFFE 		.ascii	"\376\312\377\376\376\312\377\376\376\312\377\376\376\312\377"
+ 143      FECAFFFE 
+ 143      FECAFFFE 
+ 143      FECAFF
+ 144 0690 FEFECAFF 		.ascii	"\376\376\312\377\376\376\312\377\376\376\312\377\376\376\312"
+ 144      FEFECAFF 
+ 144      FEFECAFF 
+ 144      FEFECA
+ 145 069f FFFEFECA 		.ascii	"\377\376\376\312\377\376\376\312\377\376\376\312\377\376\376"
+ 145      FFFEFECA 
+ 145      FFFEFECA 
+ 145      FFFEFE
+ 146 06ae CAFFFEFE 		.ascii	"\312\377\376\376\312\377\376\376\312\377\376\376\312\377\376"
+ 146      CAFFFEFE 
+ 146      CAFFFEFE 
+ 146      CAFFFE
+ 147 06bd FECAFFFE 		.ascii	"\376\312\377\376\376\312\377\376\376\312\377\376\376\312\377"
+ 147      FECAFFFE 
+ 147      FECAFFFE 
+ 147      FECAFF
+ 148 06cc FEFECAFF 		.ascii	"\376\376\312\377\376\376\312\377\376\376\312\377\376\376\312"
+ 148      FEFECAFF 
+ 148      FEFECAFF 
+ 148      FEFECA
+ 149 06db FFFEFECA 		.ascii	"\377\376\376\312\377\376\376\312\377\376\376\312\377\376\376"
+ 149      FFFEFECA 
+ 149      FFFEFECA 
+ 149      FFFEFE
+ 150 06ea CAFFFEFE 		.ascii	"\312\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 150      CBFFFEFE 
+ 150      CBFFFEFE 
+ 150      CBFFFE
+ 151 06f9 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 151      FECBFFFE 
+ 151      FECBFFFE 
+ 151      FECBFF
+ 152 0708 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 152      FEFECBFF 
+ 152      FEFECBFF 
+ 152      FEFECB
+ 153 0717 FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 153      FFFEFECB 
+ 153      FFFEFECB 
+ 153      FFFEFE
+ 154 0726 CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 154      CBFFFEFE 
+GAS LISTING /tmp/ccPN994e.s 			page 10
+
+
+ 154      CBFFFEFE 
+ 154      CBFFFE
+ 155 0735 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 155      FECBFFFE 
+ 155      FECBFFFE 
+ 155      FECBFF
+ 156 0744 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 156      FEFECBFF 
+ 156      FEFECBFF 
+ 156      FEFECB
+ 157 0753 FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 157      FFFEFECB 
+ 157      FFFEFECB 
+ 157      FFFEFE
+ 158 0762 CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 158      CBFFFEFE 
+ 158      CBFFFEFE 
+ 158      CBFFFE
+ 159 0771 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 159      FECBFFFE 
+ 159      FECBFFFE 
+ 159      FECBFF
+ 160 0780 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 160      FEFECBFF 
+ 160      FEFECBFF 
+ 160      FEFECB
+ 161 078f FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 161      FFFEFECB 
+ 161      FFFEFECB 
+ 161      FFFEFE
+ 162 079e CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 162      CBFFFEFE 
+ 162      CBFFFEFE 
+ 162      CBFFFE
+ 163 07ad FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 163      FECBFFFE 
+ 163      FECBFFFE 
+ 163      FECBFF
+ 164 07bc FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 164      FEFECBFF 
+ 164      FEFECBFF 
+ 164      FEFECB
+ 165 07cb FFFEFECB 		.ascii	"\377\376\376\313\377"
+ 165      FF
+ 166 07d0 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 166      FEFECBFF 
+ 166      FEFECBFF 
+ 166      FEFECB
+ 167 07df FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 167      FFFEFECB 
+ 167      FFFEFECB 
+ 167      FFFEFE
+ 168 07ee CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 168      CBFFFEFE 
+ 168      CBFFFEFE 
+ 168      CBFFFE
+ 169 07fd FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+GAS LISTING /tmp/ccPN994e.s 			page 11
+
+
+ 169      FECBFFFE 
+ 169      FECBFFFE 
+ 169      FECBFF
+ 170 080c FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 170      FEFECBFF 
+ 170      FEFECBFF 
+ 170      FEFECB
+ 171 081b FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 171      FFFEFECB 
+ 171      FFFEFECB 
+ 171      FFFEFE
+ 172 082a CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 172      CBFFFEFE 
+ 172      CBFFFEFE 
+ 172      CBFFFE
+ 173 0839 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 173      FECBFFFE 
+ 173      FECBFFFE 
+ 173      FECBFF
+ 174 0848 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 174      FEFECBFF 
+ 174      FEFECBFF 
+ 174      FEFECB
+ 175 0857 FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 175      FFFEFECB 
+ 175      FFFEFECB 
+ 175      FFFEFE
+ 176 0866 CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 176      CBFFFEFE 
+ 176      CBFFFEFE 
+ 176      CBFFFE
+ 177 0875 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 177      FECBFFFE 
+ 177      FECBFFFE 
+ 177      FECBFF
+ 178 0884 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 178      FEFECBFF 
+ 178      FEFECBFF 
+ 178      FEFECB
+ 179 0893 FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 179      FFFEFECB 
+ 179      FFFEFECB 
+ 179      FFFEFE
+ 180 08a2 CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 180      CBFFFEFE 
+ 180      CBFFFEFE 
+ 180      CBFFFE
+ 181 08b1 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 181      FECBFFFE 
+ 181      FECBFFFE 
+ 181      FECBFF
+ 182 08c0 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 182      FEFECBFF 
+ 182      FEFECBFF 
+ 182      FEFECB
+ 183 08cf FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 183      FFFEFECB 
+GAS LISTING /tmp/ccPN994e.s 			page 12
+
+
+ 183      FFFEFECB 
+ 183      FFFEFE
+ 184 08de CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 184      CBFFFEFE 
+ 184      CBFFFEFE 
+ 184      CBFFFE
+ 185 08ed FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 185      FECBFFFE 
+ 185      FECBFFFE 
+ 185      FECBFF
+ 186 08fc FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 186      FEFECBFF 
+ 186      FEFECBFF 
+ 186      FEFECB
+ 187 090b FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 187      FFFEFECB 
+ 187      FFFEFECB 
+ 187      FFFEFE
+ 188 091a CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 188      CBFFFEFE 
+ 188      CBFFFEFE 
+ 188      CBFFFE
+ 189 0929 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 189      FECBFFFE 
+ 189      FECBFFFE 
+ 189      FECBFF
+ 190 0938 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 190      FEFECBFF 
+ 190      FEFECBFF 
+ 190      FEFECB
+ 191 0947 FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 191      FFFEFECB 
+ 191      FFFEFECB 
+ 191      FFFEFE
+ 192 0956 CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 192      CBFFFEFE 
+ 192      CBFFFEFE 
+ 192      CBFFFE
+ 193 0965 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 193      FECBFFFE 
+ 193      FECBFFFE 
+ 193      FECBFF
+ 194 0974 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 194      FEFECBFF 
+ 194      FEFECBFF 
+ 194      FEFECB
+ 195 0983 FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 195      FFFEFECB 
+ 195      FFFEFECB 
+ 195      FFFEFE
+ 196 0992 CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 196      CBFFFEFE 
+ 196      CBFFFEFE 
+ 196      CBFFFE
+ 197 09a1 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 197      FECBFFFE 
+ 197      FECBFFFE 
+GAS LISTING /tmp/ccPN994e.s 			page 13
+
+
+ 197      FECBFF
+ 198 09b0 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 198      FEFECBFF 
+ 198      FEFECBFF 
+ 198      FEFECB
+ 199 09bf FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 199      FFFEFECB 
+ 199      FFFEFECB 
+ 199      FFFEFE
+ 200 09ce CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 200      CBFFFEFE 
+ 200      CBFFFEFE 
+ 200      CBFFFE
+ 201 09dd FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 201      FECBFFFE 
+ 201      FECBFFFE 
+ 201      FECBFF
+ 202 09ec FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 202      FEFECBFF 
+ 202      FEFECBFF 
+ 202      FEFECB
+ 203 09fb FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 203      FFFEFECB 
+ 203      FFFEFECB 
+ 203      FFFEFE
+ 204 0a0a CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 204      CBFFFEFE 
+ 204      CBFFFEFE 
+ 204      CBFFFE
+ 205 0a19 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 205      FECBFFFE 
+ 205      FECBFFFE 
+ 205      FECBFF
+ 206 0a28 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 206      FEFECBFF 
+ 206      FEFECBFF 
+ 206      FEFECB
+ 207 0a37 FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 207      FFFEFECB 
+ 207      FFFEFECB 
+ 207      FFFEFE
+ 208 0a46 CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 208      CBFFFEFE 
+ 208      CBFFFEFE 
+ 208      CBFFFE
+ 209 0a55 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 209      FECBFFFE 
+ 209      FECBFFFE 
+ 209      FECBFF
+ 210 0a64 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 210      FEFECBFF 
+ 210      FEFECBFF 
+ 210      FEFECB
+ 211 0a73 FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 211      FFFEFECB 
+ 211      FFFEFECB 
+ 211      FFFEFE
+GAS LISTING /tmp/ccPN994e.s 			page 14
+
+
+ 212 0a82 CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 212      CBFFFEFE 
+ 212      CBFFFEFE 
+ 212      CBFFFE
+ 213 0a91 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 213      FECBFFFE 
+ 213      FECBFFFE 
+ 213      FECBFF
+ 214 0aa0 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 214      FEFECBFF 
+ 214      FEFECBFF 
+ 214      FEFECB
+ 215 0aaf FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 215      FFFEFECB 
+ 215      FFFEFECB 
+ 215      FFFEFE
+ 216 0abe CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 216      CBFFFEFE 
+ 216      CBFFFEFE 
+ 216      CBFFFE
+ 217 0acd FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 217      FECBFFFE 
+ 217      FECBFFFE 
+ 217      FECBFF
+ 218 0adc FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 218      FEFECBFF 
+ 218      FEFECBFF 
+ 218      FEFECB
+ 219 0aeb FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 219      FFFEFECB 
+ 219      FFFEFECB 
+ 219      FFFEFE
+ 220 0afa CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 220      CBFFFEFE 
+ 220      CBFFFEFE 
+ 220      CBFFFE
+ 221 0b09 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 221      FECBFFFE 
+ 221      FECBFFFE 
+ 221      FECBFF
+ 222 0b18 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 222      FEFECBFF 
+ 222      FEFECBFF 
+ 222      FEFECB
+ 223 0b27 FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 223      FFFEFECB 
+ 223      FFFEFECB 
+ 223      FFFEFE
+ 224 0b36 CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 224      CBFFFEFE 
+ 224      CBFFFEFE 
+ 224      CBFFFE
+ 225 0b45 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 225      FECBFFFE 
+ 225      FECBFFFE 
+ 225      FECBFF
+ 226 0b54 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+GAS LISTING /tmp/ccPN994e.s 			page 15
+
+
+ 226      FEFECBFF 
+ 226      FEFECBFF 
+ 226      FEFECB
+ 227 0b63 FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 227      FFFEFECB 
+ 227      FFFEFECB 
+ 227      FFFEFE
+ 228 0b72 CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 228      CBFFFEFE 
+ 228      CBFFFEFE 
+ 228      CBFFFE
+ 229 0b81 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 229      FECBFFFE 
+ 229      FECBFFFE 
+ 229      FECBFF
+ 230 0b90 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 230      FEFECBFF 
+ 230      FEFECBFF 
+ 230      FEFECB
+ 231 0b9f FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 231      FFFEFECB 
+ 231      FFFEFECB 
+ 231      FFFEFE
+ 232 0bae CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 232      CBFFFEFE 
+ 232      CBFFFEFE 
+ 232      CBFFFE
+ 233 0bbd FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 233      FECBFFFE 
+ 233      FECBFFFE 
+ 233      FECBFF
+ 234 0bcc FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 234      FEFECBFF 
+ 234      FEFECBFF 
+ 234      FEFECB
+ 235 0bdb FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 235      FFFEFECB 
+ 235      FFFEFECB 
+ 235      FFFEFE
+ 236 0bea CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 236      CBFFFEFE 
+ 236      CBFFFEFE 
+ 236      CBFFFE
+ 237 0bf9 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 237      FECBFFFE 
+ 237      FECBFFFE 
+ 237      FECBFF
+ 238 0c08 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 238      FEFECBFF 
+ 238      FEFECBFF 
+ 238      FEFECB
+ 239 0c17 FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 239      FFFEFECB 
+ 239      FFFEFECB 
+ 239      FFFEFE
+ 240 0c26 CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 240      CBFFFEFE 
+GAS LISTING /tmp/ccPN994e.s 			page 16
+
+
+ 240      CBFFFEFE 
+ 240      CBFFFE
+ 241 0c35 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 241      FECBFFFE 
+ 241      FECBFFFE 
+ 241      FECBFF
+ 242 0c44 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 242      FEFECBFF 
+ 242      FEFECBFF 
+ 242      FEFECB
+ 243 0c53 FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 243      FFFEFECB 
+ 243      FFFEFECB 
+ 243      FFFEFE
+ 244 0c62 CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 244      CBFFFEFE 
+ 244      CBFFFEFE 
+ 244      CBFFFE
+ 245 0c71 FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 245      FECBFFFE 
+ 245      FECBFFFE 
+ 245      FECBFF
+ 246 0c80 FEFECBFF 		.ascii	"\376\376\313\377\376\376\313\377\376\376\313\377\376\376\313"
+ 246      FEFECBFF 
+ 246      FEFECBFF 
+ 246      FEFECB
+ 247 0c8f FFFEFECB 		.ascii	"\377\376\376\313\377\376\376\313\377\376\376\313\377\376\376"
+ 247      FFFEFECB 
+ 247      FFFEFECB 
+ 247      FFFEFE
+ 248 0c9e CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377\376\376\313\377\376"
+ 248      CBFFFEFE 
+ 248      CBFFFEFE 
+ 248      CBFFFE
+ 249 0cad FECBFFFE 		.ascii	"\376\313\377\376\376\313\377\376\376\313\377\376\376\313\377"
+ 249      FECBFFFE 
+ 249      FECBFFFE 
+ 249      FECBFF
+ 250 0cbc FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 250      FEFFCBFF 
+ 250      FEFFCBFF 
+ 250      FEFFCB
+ 251 0ccb FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 251      FFFEFFCB 
+ 251      FFFEFFCB 
+ 251      FFFEFF
+ 252 0cda CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 252      CBFFFEFF 
+ 252      CBFFFEFF 
+ 252      CBFFFE
+ 253 0ce9 FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 253      FFCBFFFE 
+ 253      FFCBFFFE 
+ 253      FFCBFF
+ 254 0cf8 FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 254      FEFFCBFF 
+ 254      FEFFCBFF 
+GAS LISTING /tmp/ccPN994e.s 			page 17
+
+
+ 254      FEFFCB
+ 255 0d07 FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 255      FFFEFFCB 
+ 255      FFFEFFCB 
+ 255      FFFEFF
+ 256 0d16 CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 256      CBFFFEFF 
+ 256      CBFFFEFF 
+ 256      CBFFFE
+ 257 0d25 FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 257      FFCBFFFE 
+ 257      FFCBFFFE 
+ 257      FFCBFF
+ 258 0d34 FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 258      FEFFCBFF 
+ 258      FEFFCBFF 
+ 258      FEFFCB
+ 259 0d43 FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 259      FFFEFFCB 
+ 259      FFFEFFCB 
+ 259      FFFEFF
+ 260 0d52 CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 260      CBFFFEFF 
+ 260      CBFFFEFF 
+ 260      CBFFFE
+ 261 0d61 FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 261      FFCBFFFE 
+ 261      FFCBFFFE 
+ 261      FFCBFF
+ 262 0d70 FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 262      FEFFCBFF 
+ 262      FEFFCBFF 
+ 262      FEFFCB
+ 263 0d7f FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 263      FFFEFFCB 
+ 263      FFFEFFCB 
+ 263      FFFEFF
+ 264 0d8e CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 264      CBFFFEFF 
+ 264      CBFFFEFF 
+ 264      CBFFFE
+ 265 0d9d FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 265      FFCBFFFE 
+ 265      FFCBFFFE 
+ 265      FFCBFF
+ 266 0dac FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 266      FEFFCBFF 
+ 266      FEFFCBFF 
+ 266      FEFFCB
+ 267 0dbb FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 267      FFFEFFCB 
+ 267      FFFEFFCB 
+ 267      FFFEFF
+ 268 0dca CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 268      CBFFFEFF 
+ 268      CBFFFEFF 
+ 268      CBFFFE
+GAS LISTING /tmp/ccPN994e.s 			page 18
+
+
+ 269 0dd9 FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 269      FFCBFFFE 
+ 269      FFCBFFFE 
+ 269      FFCBFF
+ 270 0de8 FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 270      FEFFCBFF 
+ 270      FEFFCBFF 
+ 270      FEFFCB
+ 271 0df7 FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 271      FFFEFFCB 
+ 271      FFFEFFCB 
+ 271      FFFEFF
+ 272 0e06 CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 272      CBFFFEFF 
+ 272      CBFFFEFF 
+ 272      CBFFFE
+ 273 0e15 FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 273      FFCBFFFE 
+ 273      FFCBFFFE 
+ 273      FFCBFF
+ 274 0e24 FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 274      FEFFCBFF 
+ 274      FEFFCBFF 
+ 274      FEFFCB
+ 275 0e33 FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 275      FFFEFFCB 
+ 275      FFFEFFCB 
+ 275      FFFEFF
+ 276 0e42 CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 276      CBFFFEFF 
+ 276      CBFFFEFF 
+ 276      CBFFFE
+ 277 0e51 FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 277      FFCBFFFE 
+ 277      FFCBFFFE 
+ 277      FFCBFF
+ 278 0e60 FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 278      FEFFCBFF 
+ 278      FEFFCBFF 
+ 278      FEFFCB
+ 279 0e6f FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 279      FFFEFFCB 
+ 279      FFFEFFCB 
+ 279      FFFEFF
+ 280 0e7e CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 280      CBFFFEFF 
+ 280      CBFFFEFF 
+ 280      CBFFFE
+ 281 0e8d FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 281      FFCBFFFE 
+ 281      FFCBFFFE 
+ 281      FFCBFF
+ 282 0e9c FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 282      FEFFCBFF 
+ 282      FEFFCBFF 
+ 282      FEFFCB
+ 283 0eab FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+GAS LISTING /tmp/ccPN994e.s 			page 19
+
+
+ 283      FFFEFFCB 
+ 283      FFFEFFCB 
+ 283      FFFEFF
+ 284 0eba CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 284      CBFFFEFF 
+ 284      CBFFFEFF 
+ 284      CBFFFE
+ 285 0ec9 FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 285      FFCBFFFE 
+ 285      FFCBFFFE 
+ 285      FFCBFF
+ 286 0ed8 FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 286      FEFFCBFF 
+ 286      FEFFCBFF 
+ 286      FEFFCB
+ 287 0ee7 FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 287      FFFEFFCB 
+ 287      FFFEFFCB 
+ 287      FFFEFF
+ 288 0ef6 CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 288      CBFFFEFF 
+ 288      CBFFFEFF 
+ 288      CBFFFE
+ 289 0f05 FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 289      FFCBFFFE 
+ 289      FFCBFFFE 
+ 289      FFCBFF
+ 290 0f14 FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 290      FEFFCBFF 
+ 290      FEFFCBFF 
+ 290      FEFFCB
+ 291 0f23 FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 291      FFFEFFCB 
+ 291      FFFEFFCB 
+ 291      FFFEFF
+ 292 0f32 CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 292      CBFFFEFF 
+ 292      CBFFFEFF 
+ 292      CBFFFE
+ 293 0f41 FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 293      FFCBFFFE 
+ 293      FFCBFFFE 
+ 293      FFCBFF
+ 294 0f50 FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 294      FEFFCBFF 
+ 294      FEFFCBFF 
+ 294      FEFFCB
+ 295 0f5f FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 295      FFFEFFCB 
+ 295      FFFEFFCB 
+ 295      FFFEFF
+ 296 0f6e CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 296      CBFFFEFF 
+ 296      CBFFFEFF 
+ 296      CBFFFE
+ 297 0f7d FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 297      FFCBFFFE 
+GAS LISTING /tmp/ccPN994e.s 			page 20
+
+
+ 297      FFCBFFFE 
+ 297      FFCBFF
+ 298 0f8c FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 298      FEFFCBFF 
+ 298      FEFFCBFF 
+ 298      FEFFCB
+ 299 0f9b FFFEFFCB 		.ascii	"\377\376\377\313\377"
+ 299      FF
+ 300 0fa0 FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 300      FEFFCBFF 
+ 300      FEFFCBFF 
+ 300      FEFFCB
+ 301 0faf FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 301      FFFEFFCB 
+ 301      FFFEFFCB 
+ 301      FFFEFF
+ 302 0fbe CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377\376\377\313\377\376"
+ 302      CBFFFEFF 
+ 302      CBFFFEFF 
+ 302      CBFFFE
+ 303 0fcd FFCBFFFE 		.ascii	"\377\313\377\376\377\313\377\376\377\313\377\376\377\313\377"
+ 303      FFCBFFFE 
+ 303      FFCBFFFE 
+ 303      FFCBFF
+ 304 0fdc FEFFCBFF 		.ascii	"\376\377\313\377\376\377\313\377\376\377\313\377\376\377\313"
+ 304      FEFFCBFF 
+ 304      FEFFCBFF 
+ 304      FEFFCB
+ 305 0feb FFFEFFCB 		.ascii	"\377\376\377\313\377\376\377\313\377\376\377\313\377\376\377"
+ 305      FFFEFFCB 
+ 305      FFFEFFCB 
+ 305      FFFEFF
+ 306 0ffa CBFFFEFF 		.ascii	"\313\377\376\377\313\377\376\377\313\377"
+ 306      CBFFFEFF 
+ 306      CBFF
+ 307              		.globl	heatmap_cs_YlOrRd_mixed
+ 308              		.section	.data.rel.local
+ 309              		.align 8
+ 310              		.type	heatmap_cs_YlOrRd_mixed, @object
+ 311              		.size	heatmap_cs_YlOrRd_mixed, 8
+ 312              	heatmap_cs_YlOrRd_mixed:
+ 313 0008 00000000 		.quad	mixed
+ 313      00000000 
+ 314              		.section	.data.rel.ro.local
+ 315              		.align 16
+ 316              		.type	mixed, @object
+ 317              		.size	mixed, 16
+ 318              	mixed:
+ 319 0010 00000000 		.quad	mixed_data
+ 319      00000000 
+ 320 0018 01040000 		.quad	1025
+ 320      00000000 
+ 321              		.section	.rodata
+ 322 1004 00000000 		.align 32
+ 322      00000000 
+ 322      00000000 
+ 322      00000000 
+GAS LISTING /tmp/ccPN994e.s 			page 21
+
+
+ 322      00000000 
+ 323              		.type	mixed_data, @object
+ 324              		.size	mixed_data, 4100
+ 325              	mixed_data:
+ 326 1020 00       		.string	""
+ 327 1021 00       		.string	""
+ 328 1022 00       		.string	""
+ 329 1023 00       		.string	""
+ 330 1024 7F00     		.string	"\177"
+ 331 1026 2500     		.string	"%"
+ 332 1028 8000     		.string	"\200"
+ 333 102a 26078000 		.string	"&\007\200"
+ 334 102e 260E8100 		.string	"&\016\201"
+ 335 1032 26168100 		.string	"&\026\201"
+ 336 1036 261D8100 		.string	"&\035\201"
+ 337 103a 26258200 		.string	"&%\202"
+ 338 103e 262C8200 		.string	"&,\202"
+ 339 1042 26348300 		.string	"&4\203"
+ 340 1046 263B8300 		.string	"&;\203"
+ 341 104a 26438300 		.string	"&C\203"
+ 342 104e 264A8400 		.string	"&J\204"
+ 343 1052 26528400 		.string	"&R\204"
+ 344 1056 26598400 		.string	"&Y\204"
+ 345 105a 26618500 		.string	"&a\205"
+ 346 105e 26688500 		.string	"&h\205"
+ 347 1062 26708600 		.string	"&p\206"
+ 348 1066 26778600 		.string	"&w\206"
+ 349 106a 267F8600 		.string	"&\177\206"
+ 350 106e 26868700 		.string	"&\206\207"
+ 351 1072 268D8700 		.string	"&\215\207"
+ 352 1076 26958800 		.string	"&\225\210"
+ 353 107a 269C8800 		.string	"&\234\210"
+ 354 107e 26A48800 		.string	"&\244\210"
+ 355 1082 26AB8900 		.string	"&\253\211"
+ 356 1086 26B38900 		.string	"&\263\211"
+ 357 108a 26BA8900 		.string	"&\272\211"
+ 358 108e 26C28A00 		.string	"&\302\212"
+ 359 1092 26C98A00 		.string	"&\311\212"
+ 360 1096 26D18B00 		.string	"&\321\213"
+ 361 109a 26D88B00 		.string	"&\330\213"
+ 362 109e 26E08B00 		.string	"&\340\213"
+ 363 10a2 26E78C00 		.string	"&\347\214"
+ 364 10a6 26EF8C00 		.string	"&\357\214"
+ 365 10aa 26F68D00 		.string	"&\366\215"
+ 366 10ae 26FE8D00 		.string	"&\376\215"
+ 367 10b2 26FF8D00 		.string	"&\377\215"
+ 368 10b6 27FF8E00 		.string	"'\377\216"
+ 369 10ba 27FF8E00 		.string	"'\377\216"
+ 370 10be 27FF8E00 		.string	"'\377\216"
+ 371 10c2 27FF8F00 		.string	"'\377\217"
+ 372 10c6 27FF8F00 		.string	"'\377\217"
+ 373 10ca 27FF9000 		.string	"'\377\220"
+ 374 10ce 27FF9000 		.string	"'\377\220"
+ 375 10d2 27FF9000 		.string	"'\377\220"
+ 376 10d6 27FF9100 		.string	"'\377\221"
+ 377 10da 27FF9100 		.string	"'\377\221"
+ 378 10de 27FF9100 		.string	"'\377\221"
+GAS LISTING /tmp/ccPN994e.s 			page 22
+
+
+ 379 10e2 27FF9200 		.string	"'\377\222"
+ 380 10e6 27FF9200 		.string	"'\377\222"
+ 381 10ea 27FF9300 		.string	"'\377\223"
+ 382 10ee 27FF9300 		.string	"'\377\223"
+ 383 10f2 27FF9300 		.string	"'\377\223"
+ 384 10f6 27FF9400 		.string	"'\377\224"
+ 385 10fa 27FF9400 		.string	"'\377\224"
+ 386 10fe 27FF9500 		.string	"'\377\225"
+ 387 1102 27FF9500 		.string	"'\377\225"
+ 388 1106 27FF9500 		.string	"'\377\225"
+ 389 110a 27FF9600 		.string	"'\377\226"
+ 390 110e 27FF9600 		.string	"'\377\226"
+ 391 1112 27FF9600 		.string	"'\377\226"
+ 392 1116 27FF9700 		.string	"'\377\227"
+ 393 111a 27FF9700 		.string	"'\377\227"
+ 394 111e 27FF9800 		.string	"'\377\230"
+ 395 1122 27FFA400 		.string	"'\377\244"
+ 396 1126 27FFA500 		.string	"'\377\245"
+ 397 112a 27FFA500 		.string	"'\377\245"
+ 398 112e 27FFA500 		.string	"'\377\245"
+ 399 1132 27FFA600 		.string	"'\377\246"
+ 400 1136 27FFA600 		.string	"'\377\246"
+ 401 113a 27FFA600 		.string	"'\377\246"
+ 402 113e 27FFA700 		.string	"'\377\247"
+ 403 1142 27FFA700 		.string	"'\377\247"
+ 404 1146 27FFA800 		.string	"'\377\250"
+ 405 114a 27FFA800 		.string	"'\377\250"
+ 406 114e 27FFA800 		.string	"'\377\250"
+ 407 1152 27FFA900 		.string	"'\377\251"
+ 408 1156 27FFA900 		.string	"'\377\251"
+ 409 115a 27FFAA00 		.string	"'\377\252"
+ 410 115e 27FFAA00 		.string	"'\377\252"
+ 411 1162 27FFAA00 		.string	"'\377\252"
+ 412 1166 27FFAB00 		.string	"'\377\253"
+ 413 116a 27FFAB00 		.string	"'\377\253"
+ 414 116e 27FFAB00 		.string	"'\377\253"
+ 415 1172 27FFAC00 		.string	"'\377\254"
+ 416 1176 27FFAC00 		.string	"'\377\254"
+ 417 117a 27FFAD00 		.string	"'\377\255"
+ 418 117e 27FFAD00 		.string	"'\377\255"
+ 419 1182 27FFAD00 		.string	"'\377\255"
+ 420 1186 27FFAE00 		.string	"'\377\256"
+ 421 118a 27FFAE00 		.string	"'\377\256"
+ 422 118e 27FFAE00 		.string	"'\377\256"
+ 423 1192 27FFAF00 		.string	"'\377\257"
+ 424 1196 27FFAF00 		.string	"'\377\257"
+ 425 119a 27FFB000 		.string	"'\377\260"
+ 426 119e 27FFB000 		.string	"'\377\260"
+ 427 11a2 27FFB000 		.string	"'\377\260"
+ 428 11a6 26FFB100 		.string	"&\377\261"
+ 429 11aa 26FFB100 		.string	"&\377\261"
+ 430 11ae 26FFB200 		.string	"&\377\262"
+ 431 11b2 26FFB200 		.string	"&\377\262"
+ 432 11b6 26FFB200 		.string	"&\377\262"
+ 433 11ba 26FFB300 		.string	"&\377\263"
+ 434 11be 26FFB300 		.string	"&\377\263"
+ 435 11c2 26FFB300 		.string	"&\377\263"
+GAS LISTING /tmp/ccPN994e.s 			page 23
+
+
+ 436 11c6 26FFB400 		.string	"&\377\264"
+ 437 11ca 26FFB400 		.string	"&\377\264"
+ 438 11ce 26FFB500 		.string	"&\377\265"
+ 439 11d2 26FFB500 		.string	"&\377\265"
+ 440 11d6 26FFB500 		.string	"&\377\265"
+ 441 11da 26FFB600 		.string	"&\377\266"
+ 442 11de 26FFB600 		.string	"&\377\266"
+ 443 11e2 26FFB600 		.string	"&\377\266"
+ 444 11e6 26FFB700 		.string	"&\377\267"
+ 445 11ea 26FFB700 		.string	"&\377\267"
+ 446 11ee 26FFB800 		.string	"&\377\270"
+ 447 11f2 26FFB800 		.string	"&\377\270"
+ 448 11f6 26FFB800 		.string	"&\377\270"
+ 449 11fa 26FFB900 		.string	"&\377\271"
+ 450 11fe 26FFB900 		.string	"&\377\271"
+ 451 1202 26FFB900 		.string	"&\377\271"
+ 452 1206 26FFBA00 		.string	"&\377\272"
+ 453 120a 26FFBA00 		.string	"&\377\272"
+ 454 120e 26FFBB00 		.string	"&\377\273"
+ 455 1212 26FFBB00 		.string	"&\377\273"
+ 456 1216 26FFBB00 		.string	"&\377\273"
+ 457 121a 26FFBC00 		.string	"&\377\274"
+ 458 121e 26FFBC00 		.string	"&\377\274"
+ 459 1222 26FFBC00 		.string	"&\377\274"
+ 460 1226 25FFBD00 		.string	"%\377\275"
+ 461 122a 25FFBD00 		.string	"%\377\275"
+ 462 122e 25FFBD00 		.string	"%\377\275"
+ 463 1232 25FFBD00 		.string	"%\377\275"
+ 464 1236 25FFBE00 		.string	"%\377\276"
+ 465 123a 25FFBE00 		.string	"%\377\276"
+ 466 123e 25FFBE00 		.string	"%\377\276"
+ 467 1242 25FFBE00 		.string	"%\377\276"
+ 468 1246 25FFBF00 		.string	"%\377\277"
+ 469 124a 25FFBF01 		.ascii	"%\377\277\001%\377\277\001%\377\277\001%\377\300\001%\377\300"
+ 469      25FFBF01 
+ 469      25FFBF01 
+ 469      25FFC001 
+ 469      25FFC0
+ 470 125d 0125FFC0 		.ascii	"\001%\377\300\001%\377\300\001%\377\301\001%\377\301\001%\377"
+ 470      0125FFC0 
+ 470      0125FFC1 
+ 470      0125FFC1 
+ 470      0125FF
+ 471 1270 C10225FF 		.ascii	"\301\002%\377\301\002%\377\302\002%\377\302\002%\377\302\002"
+ 471      C10225FF 
+ 471      C20225FF 
+ 471      C20225FF 
+ 471      C202
+ 472 1282 25FFC202 		.ascii	"%\377\302\002%\377\303\002%\377\303\003$\377\303\003$\377\303"
+ 472      25FFC302 
+ 472      25FFC303 
+ 472      24FFC303 
+ 472      24FFC3
+ 473 1295 0324FFC4 		.ascii	"\003$\377\304\003$\377\304\003$\377\304\003$\377\304\003$\377"
+ 473      0324FFC4 
+ 473      0324FFC4 
+ 473      0324FFC4 
+GAS LISTING /tmp/ccPN994e.s 			page 24
+
+
+ 473      0324FF
+ 474 12a8 C50424FF 		.ascii	"\305\004$\377\305\004$\377\305\004$\377\305\004$\377\305\004"
+ 474      C50424FF 
+ 474      C50424FF 
+ 474      C50424FF 
+ 474      C504
+ 475 12ba 24FFC604 		.ascii	"$\377\306\004$\377\306\004$\377\306\005$\377\306\005$\377\307"
+ 475      24FFC604 
+ 475      24FFC605 
+ 475      24FFC605 
+ 475      24FFC7
+ 476 12cd 0524FFC7 		.ascii	"\005$\377\307\005$\377\307\005$\377\307\005$\377\310\006$\377"
+ 476      0524FFC7 
+ 476      0524FFC7 
+ 476      0524FFC8 
+ 476      0624FF
+ 477 12e0 C80623FF 		.ascii	"\310\006#\377\310\006#\377\310\006#\377\311\006#\377\311\007"
+ 477      C80623FF 
+ 477      C80623FF 
+ 477      C90623FF 
+ 477      C907
+ 478 12f2 23FFC907 		.ascii	"#\377\311\007#\377\311\007#\377\312\007#\377\312\007#\377\312"
+ 478      23FFC907 
+ 478      23FFCA07 
+ 478      23FFCA07 
+ 478      23FFCA
+ 479 1305 0723FFCA 		.ascii	"\007#\377\312\b#\377\312\b#\377\313\b#\377\313\b#\377\313\b#"
+ 479      0823FFCA 
+ 479      0823FFCB 
+ 479      0823FFCB 
+ 479      0823FFCB 
+ 480 131b FFCB0923 		.ascii	"\377\313\t#\377\314\t#\377\324\016!\377\324\016 \377\324\017"
+ 480      FFCC0923 
+ 480      FFD40E21 
+ 480      FFD40E20 
+ 480      FFD40F
+ 481 132e 20FFD40F 		.ascii	" \377\324\017 \377\324\017 \377\325\017 \377\325\017 \377\325"
+ 481      20FFD40F 
+ 481      20FFD50F 
+ 481      20FFD50F 
+ 481      20FFD5
+ 482 1341 0F20FFD5 		.ascii	"\017 \377\325\020 \377\326\020 \377\326\020 \377\326\020 \377"
+ 482      1020FFD6 
+ 482      1020FFD6 
+ 482      1020FFD6 
+ 482      1020FF
+ 483 1354 D61020FF 		.ascii	"\326\020 \377\327\021 \377\327\021 \377\327\021 \377\327\021"
+ 483      D71120FF 
+ 483      D71120FF 
+ 483      D71120FF 
+ 483      D711
+ 484 1366 20FFD811 		.ascii	" \377\330\021\037\377\330\021\037\377\330\022\037\377\330\022"
+ 484      1FFFD811 
+ 484      1FFFD812 
+ 484      1FFFD812 
+ 485 1376 1FFFD812 		.ascii	"\037\377\330\022\037\377\331\022\037\377\331\022\037\377\331"
+ 485      1FFFD912 
+GAS LISTING /tmp/ccPN994e.s 			page 25
+
+
+ 485      1FFFD912 
+ 485      1FFFD9
+ 486 1385 121FFFD9 		.ascii	"\022\037\377\331\023\037\377\332\023\037\377\332\023\037\377"
+ 486      131FFFDA 
+ 486      131FFFDA 
+ 486      131FFF
+ 487 1394 DA131FFF 		.ascii	"\332\023\037\377\332\023\037\377\333\024\036\377\333\024\036"
+ 487      DA131FFF 
+ 487      DB141EFF 
+ 487      DB141E
+ 488 13a3 FFDB141E 		.ascii	"\377\333\024\036\377\333\024\036\377\334\024\036\377\334\024"
+ 488      FFDB141E 
+ 488      FFDC141E 
+ 488      FFDC14
+ 489 13b2 1EFFDC15 		.ascii	"\036\377\334\025\036\377\334\025\036\377\334\025\036\377\335"
+ 489      1EFFDC15 
+ 489      1EFFDC15 
+ 489      1EFFDD
+ 490 13c1 151EFFDD 		.ascii	"\025\036\377\335\025\036\377\335\025\036\377\335\026\036\377"
+ 490      151EFFDD 
+ 490      151EFFDD 
+ 490      161EFF
+ 491 13d0 DE161DFF 		.ascii	"\336\026\035\377\336\026\035\377\336\026\035\377\336\026\035"
+ 491      DE161DFF 
+ 491      DE161DFF 
+ 491      DE161D
+ 492 13df FFDF171D 		.ascii	"\377\337\027\035\377\337\027\035\377\337\027\035\377\337\027"
+ 492      FFDF171D 
+ 492      FFDF171D 
+ 492      FFDF17
+ 493 13ee 1DFFDF17 		.ascii	"\035\377\337\027\035\377\340\027\035\377\340\030\035\377\340"
+ 493      1DFFE017 
+ 493      1DFFE018 
+ 493      1DFFE0
+ 494 13fd 181CFFE0 		.ascii	"\030\034\377\340\030\034\377\341\030\034\377\341\030\034\377"
+ 494      181CFFE1 
+ 494      181CFFE1 
+ 494      181CFF
+ 495 140c E1181CFF 		.ascii	"\341\030\034\377\341\031\034\377\342\031\034\377\342\031\034"
+ 495      E1191CFF 
+ 495      E2191CFF 
+ 495      E2191C
+ 496 141b FFE2191C 		.ascii	"\377\342\031\034\377\342\031\034\377\342\032\033\377\343\032"
+ 496      FFE2191C 
+ 496      FFE21A1B 
+ 496      FFE31A
+ 497 142a 1CFFE31B 		.ascii	"\034\377\343\033\034\377\343\033\034\377\343\034\034\377\343"
+ 497      1CFFE31B 
+ 497      1CFFE31C 
+ 497      1CFFE3
+ 498 1439 1C1CFFE3 		.ascii	"\034\034\377\343\034\034\377\344\035\034\377\344\035\034\377"
+ 498      1C1CFFE4 
+ 498      1D1CFFE4 
+ 498      1D1CFF
+ 499 1448 E41E1CFF 		.ascii	"\344\036\034\377\344\036\034\377\344\037\034\377\344\037\034"
+ 499      E41E1CFF 
+ 499      E41F1CFF 
+GAS LISTING /tmp/ccPN994e.s 			page 26
+
+
+ 499      E41F1C
+ 500 1457 FFE5201D 		.ascii	"\377\345 \035\377\345 \035\377\345 \035\377\345!\035\377\345"
+ 500      FFE5201D 
+ 500      FFE5201D 
+ 500      FFE5211D 
+ 500      FFE5
+ 501 1469 211DFFE5 		.ascii	"!\035\377\345\"\035\377\346\"\035\377\346#\035\377\346#\035\377"
+ 501      221DFFE6 
+ 501      221DFFE6 
+ 501      231DFFE6 
+ 501      231DFF
+ 502 147c E6231DFF 		.ascii	"\346#\035\377\346$\035\377\346$\035\377\346$\036\377\347%\036"
+ 502      E6241DFF 
+ 502      E6241DFF 
+ 502      E6241EFF 
+ 502      E7251E
+ 503 148f FFE7251E 		.ascii	"\377\347%\036\377\347&\036\377\347&\036\377\347&\036\377\347"
+ 503      FFE7261E 
+ 503      FFE7261E 
+ 503      FFE7261E 
+ 503      FFE7
+ 504 14a1 271EFFE8 		.ascii	"'\036\377\350'\036\377\350'\036\377\350(\036\377\350(\036\377"
+ 504      271EFFE8 
+ 504      271EFFE8 
+ 504      281EFFE8 
+ 504      281EFF
+ 505 14b4 E8281EFF 		.ascii	"\350(\036\377\350)\037\377\350)\037\377\351*\037\377\351*\037"
+ 505      E8291FFF 
+ 505      E8291FFF 
+ 505      E92A1FFF 
+ 505      E92A1F
+ 506 14c7 FFE92A1F 		.ascii	"\377\351*\037\377\351+\037\377\351+\037\377\351+\037\377\352"
+ 506      FFE92B1F 
+ 506      FFE92B1F 
+ 506      FFE92B1F 
+ 506      FFEA
+ 507 14d9 2C1FFFEA 		.ascii	",\037\377\352,\037\377\352,\037\377\352-\037\377\352- \377\352"
+ 507      2C1FFFEA 
+ 507      2C1FFFEA 
+ 507      2D1FFFEA 
+ 507      2D20FFEA 
+ 508 14ed 2D20FFEB 		.ascii	"- \377\353. \377\353. \377\353. \377\353. \377\353/ \377\353"
+ 508      2E20FFEB 
+ 508      2E20FFEB 
+ 508      2E20FFEB 
+ 508      2E20FFEB 
+ 509 1505 2F20FFEB 		.ascii	"/ \377\353/ \377\3540 \377\3540 \377\3540 \377\3541!\377\354"
+ 509      2F20FFEC 
+ 509      3020FFEC 
+ 509      3020FFEC 
+ 509      3020FFEC 
+ 510 151d 3121FFEC 		.ascii	"1!\377\3541!\377\362<$\377\362<$\377\362=$\377\362=$\377\362"
+ 510      3121FFF2 
+ 510      3C24FFF2 
+ 510      3C24FFF2 
+ 510      3D24FFF2 
+ 511 1535 3D24FFF2 		.ascii	"=$\377\362=$\377\363>$\377\363>$\377\363>$\377\363?$\377\363"
+GAS LISTING /tmp/ccPN994e.s 			page 27
+
+
+ 511      3D24FFF3 
+ 511      3E24FFF3 
+ 511      3E24FFF3 
+ 511      3E24FFF3 
+ 512 154d 3F25FFF3 		.ascii	"?%\377\363?%\377\363@%\377\364@%\377\364@%\377\364@%\377\364"
+ 512      3F25FFF3 
+ 512      4025FFF4 
+ 512      4025FFF4 
+ 512      4025FFF4 
+ 513 1565 4125FFF4 		.ascii	"A%\377\364A%\377\364A%\377\365B%\377\365B%\377\365B%\377\365"
+ 513      4125FFF4 
+ 513      4125FFF5 
+ 513      4225FFF5 
+ 513      4225FFF5 
+ 514 157d 4226FFF5 		.ascii	"B&\377\365C&\377\365C&\377\365C&\377\366C&\377\366D&\377\366"
+ 514      4326FFF5 
+ 514      4326FFF5 
+ 514      4326FFF6 
+ 514      4326FFF6 
+ 515 1595 4426FFF6 		.ascii	"D&\377\366D&\377\366E&\377\366E&\377\367E&\377\367E'\377\367"
+ 515      4426FFF6 
+ 515      4526FFF6 
+ 515      4526FFF7 
+ 515      4526FFF7 
+ 516 15ad 4627FFF7 		.ascii	"F'\377\367F'\377\367F'\377\367F'\377\367G'\377\370G'\377\370"
+ 516      4627FFF7 
+ 516      4627FFF7 
+ 516      4627FFF7 
+ 516      4727FFF8 
+ 517 15c5 4727FFF8 		.ascii	"G'\377\370H'\377\370H'\377\370H(\377\370H(\377\371I(\377\371"
+ 517      4827FFF8 
+ 517      4827FFF8 
+ 517      4828FFF8 
+ 517      4828FFF9 
+ 518 15dd 4928FFF9 		.ascii	"I(\377\371I(\377\371I(\377\371J(\377\371J(\377\371J(\377\372"
+ 518      4928FFF9 
+ 518      4928FFF9 
+ 518      4A28FFF9 
+ 518      4A28FFF9 
+ 519 15f5 4A28FFFA 		.ascii	"J(\377\372K(\377\372K)\377\372K)\377\372K)\377\372L)\377\373"
+ 519      4B28FFFA 
+ 519      4B29FFFA 
+ 519      4B29FFFA 
+ 519      4B29FFFA 
+ 520 160d 4C29FFFB 		.ascii	"L)\377\373L)\377\373L)\377\373M)\377\373M)\377\373M)\377\373"
+ 520      4C29FFFB 
+ 520      4C29FFFB 
+ 520      4D29FFFB 
+ 520      4D29FFFB 
+ 521 1625 4E29FFFC 		.ascii	"N)\377\374N*\377\374O*\377\374O*\377\374O*\377\374P*\377\374"
+ 521      4E2AFFFC 
+ 521      4F2AFFFC 
+ 521      4F2AFFFC 
+ 521      4F2AFFFC 
+ 522 163d 502AFFFC 		.ascii	"P*\377\374Q*\377\374Q*\377\374R*\377\374R*\377\374S*\377\374"
+ 522      512AFFFC 
+ 522      512AFFFC 
+GAS LISTING /tmp/ccPN994e.s 			page 28
+
+
+ 522      522AFFFC 
+ 522      522AFFFC 
+ 523 1655 532AFFFC 		.ascii	"S*\377\374T*\377\374T*\377\374U*\377\374U*\377\374V*\377\374"
+ 523      542AFFFC 
+ 523      542AFFFC 
+ 523      552AFFFC 
+ 523      552AFFFC 
+ 524 166d 562AFFFC 		.ascii	"V*\377\374W*\377\374W*\377\374W*\377\374X*\377\374X*\377\374"
+ 524      572AFFFC 
+ 524      572AFFFC 
+ 524      572AFFFC 
+ 524      582AFFFC 
+ 525 1685 592AFFFC 		.ascii	"Y*\377\374Y*\377\374Z+\377\374Z+\377\374[+\377\374[+\377\374"
+ 525      592AFFFC 
+ 525      5A2BFFFC 
+ 525      5A2BFFFC 
+ 525      5B2BFFFC 
+ 526 169d 5B2BFFFC 		.ascii	"[+\377\374\\+\377\374\\+\377\374]+\377\374]+\377\374^+\377\374"
+ 526      5C2BFFFC 
+ 526      5C2BFFFC 
+ 526      5D2BFFFC 
+ 526      5D2BFFFC 
+ 527 16b5 5E2BFFFC 		.ascii	"^+\377\374^+\377\374_+\377\374_+\377\374`+\377\374`,\377\374"
+ 527      5E2BFFFC 
+ 527      5F2BFFFC 
+ 527      5F2BFFFC 
+ 527      602BFFFC 
+ 528 16cd 602CFFFC 		.ascii	"`,\377\374a,\377\374a,\377\374b,\377\374b,\377\374c,\377\374"
+ 528      612CFFFC 
+ 528      612CFFFC 
+ 528      622CFFFC 
+ 528      622CFFFC 
+ 529 16e5 632CFFFC 		.ascii	"c,\377\374c,\377\374d,\377\374d,\377\374e-\377\374e-\377\374"
+ 529      632CFFFC 
+ 529      642CFFFC 
+ 529      642CFFFC 
+ 529      652DFFFC 
+ 530 16fd 652DFFFC 		.ascii	"e-\377\374f-\377\374f-\377\374f-\377\374g-\377\374g-\377\374"
+ 530      662DFFFC 
+ 530      662DFFFC 
+ 530      662DFFFC 
+ 530      672DFFFC 
+ 531 1715 682DFFFC 		.ascii	"h-\377\374h-\377\374h.\377\374i.\377\374v1\377\374v2\377\374"
+ 531      682DFFFC 
+ 531      682EFFFC 
+ 531      692EFFFC 
+ 531      7631FFFC 
+ 532 172d 7732FFFC 		.ascii	"w2\377\374w2\377\374w2\377\374x2\377\374x2\377\374x2\377\374"
+ 532      7732FFFC 
+ 532      7732FFFC 
+ 532      7832FFFC 
+ 532      7832FFFC 
+ 533 1745 7932FFFC 		.ascii	"y2\377\374y2\377\374z3\377\374z3\377\374z3\377\374{3\377\374"
+ 533      7932FFFC 
+ 533      7A33FFFC 
+ 533      7A33FFFC 
+ 533      7A33FFFC 
+GAS LISTING /tmp/ccPN994e.s 			page 29
+
+
+ 534 175d 7B33FFFC 		.ascii	"{3\377\374{3\377\374|3\377\374|4\377\374}4\377\374}4\377\374"
+ 534      7B33FFFC 
+ 534      7C33FFFC 
+ 534      7C34FFFC 
+ 534      7D34FFFC 
+ 535 1775 7D34FFFC 		.ascii	"}4\377\374~4\377\374~4\377\374~4\377\374\1775\377\374\1775\377"
+ 535      7E34FFFC 
+ 535      7E34FFFC 
+ 535      7E34FFFC 
+ 535      7F35FFFC 
+ 536 178c FC7F35FF 		.ascii	"\374\1775\377\374\2005\377\374\2005\377\374\2005\377\374\201"
+ 536      FC8035FF 
+ 536      FC8035FF 
+ 536      FC8035FF 
+ 536      FC81
+ 537 179e 35FFFC81 		.ascii	"5\377\374\2016\377\374\2026\377\374\2026\377\374\2026\377\375"
+ 537      36FFFC82 
+ 537      36FFFC82 
+ 537      36FFFC82 
+ 537      36FFFD
+ 538 17b1 8336FFFD 		.ascii	"\2036\377\375\2036\377\375\2037\377\375\2047\377\375\2047\377"
+ 538      8336FFFD 
+ 538      8337FFFD 
+ 538      8437FFFD 
+ 538      8437FF
+ 539 17c4 FD8437FF 		.ascii	"\375\2047\377\375\2057\377\375\2057\377\375\2058\377\375\206"
+ 539      FD8537FF 
+ 539      FD8537FF 
+ 539      FD8538FF 
+ 539      FD86
+ 540 17d6 38FFFD86 		.ascii	"8\377\375\2068\377\375\2068\377\375\2078\377\375\2078\377\375"
+ 540      38FFFD86 
+ 540      38FFFD87 
+ 540      38FFFD87 
+ 540      38FFFD
+ 541 17e9 8739FFFD 		.ascii	"\2079\377\375\2109\377"
+ 541      8839FF
+ 542 17f0 FD8839FF 		.ascii	"\375\2109\377\375\2109\377\375\2119\377\375\211:\377\375\211"
+ 542      FD8839FF 
+ 542      FD8939FF 
+ 542      FD893AFF 
+ 542      FD89
+ 543 1802 3AFFFD8A 		.ascii	":\377\375\212:\377\375\212:\377\375\212:\377\375\213;\377\375"
+ 543      3AFFFD8A 
+ 543      3AFFFD8A 
+ 543      3AFFFD8B 
+ 543      3BFFFD
+ 544 1815 8B3BFFFD 		.ascii	"\213;\377\375\214;\377\375\214;\377\375\214;\377\374\215;\377"
+ 544      8C3BFFFD 
+ 544      8C3BFFFD 
+ 544      8C3BFFFC 
+ 544      8D3BFF
+ 545 1828 FD8D3CFF 		.ascii	"\375\215<\377\375\215<\377\375\215<\377\375\215<\377\375\216"
+ 545      FD8D3CFF 
+ 545      FD8D3CFF 
+ 545      FD8D3CFF 
+ 545      FD8E
+GAS LISTING /tmp/ccPN994e.s 			page 30
+
+
+ 546 183a 3CFFFD8E 		.ascii	"<\377\375\216<\377\375\216<\377\375\216<\377\375\217<\377\375"
+ 546      3CFFFD8E 
+ 546      3CFFFD8E 
+ 546      3CFFFD8F 
+ 546      3CFFFD
+ 547 184d 8F3CFFFD 		.ascii	"\217<\377\375\217<\377\375\217<\377\375\220<\377\375\220<\377"
+ 547      8F3CFFFD 
+ 547      8F3CFFFD 
+ 547      903CFFFD 
+ 547      903CFF
+ 548 1860 FD903CFF 		.ascii	"\375\220<\377\375\220=\377\375\221=\377\375\221=\377\375\221"
+ 548      FD903DFF 
+ 548      FD913DFF 
+ 548      FD913DFF 
+ 548      FD91
+ 549 1872 3DFFFD91 		.ascii	"=\377\375\221=\377\375\222=\377\375\222=\377\375\222=\377\375"
+ 549      3DFFFD92 
+ 549      3DFFFD92 
+ 549      3DFFFD92 
+ 549      3DFFFD
+ 550 1885 923DFFFD 		.ascii	"\222=\377\375\222=\377\375\223=\377\375\223=\377\375\223=\377"
+ 550      923DFFFD 
+ 550      933DFFFD 
+ 550      933DFFFD 
+ 550      933DFF
+ 551 1898 FD933DFF 		.ascii	"\375\223=\377\375\224>\377\375\224>\377\375\224>\377\375\224"
+ 551      FD943EFF 
+ 551      FD943EFF 
+ 551      FD943EFF 
+ 551      FD94
+ 552 18aa 3EFFFD95 		.ascii	">\377\375\225>\377\375\225>\377\375\225>\377\375\225>\377\375"
+ 552      3EFFFD95 
+ 552      3EFFFD95 
+ 552      3EFFFD95 
+ 552      3EFFFD
+ 553 18bd 963EFFFD 		.ascii	"\226>\377\375\226>\377\375\226>\377\375\226>\377\375\226?\377"
+ 553      963EFFFD 
+ 553      963EFFFD 
+ 553      963EFFFD 
+ 553      963FFF
+ 554 18d0 FD973FFF 		.ascii	"\375\227?\377\375\227?\377\375\227?\377\375\227?\377\375\230"
+ 554      FD973FFF 
+ 554      FD973FFF 
+ 554      FD973FFF 
+ 554      FD98
+ 555 18e2 3FFFFD98 		.ascii	"?\377\375\230?\377\375\230?\377\375\230?\377\375\231?\377\375"
+ 555      3FFFFD98 
+ 555      3FFFFD98 
+ 555      3FFFFD99 
+ 555      3FFFFD
+ 556 18f5 993FFFFD 		.ascii	"\231?\377\375\231@\377\375\231@\377\375\232@\377\375\232@\377"
+ 556      9940FFFD 
+ 556      9940FFFD 
+ 556      9A40FFFD 
+ 556      9A40FF
+ 557 1908 FD9A40FF 		.ascii	"\375\232@\377\375\232@\377\375\232@\377\375\233@\377\375\233"
+ 557      FD9A40FF 
+GAS LISTING /tmp/ccPN994e.s 			page 31
+
+
+ 557      FD9A40FF 
+ 557      FD9B40FF 
+ 557      FD9B
+ 558 191a 40FFFD9B 		.ascii	"@\377\375\233@\377\375\233@\377\375\243D\377\375\243D\377\375"
+ 558      40FFFD9B 
+ 558      40FFFDA3 
+ 558      44FFFDA3 
+ 558      44FFFD
+ 559 192d A344FFFD 		.ascii	"\243D\377\375\244D\377\375\244D\377\375\244D\377\375\244D\377"
+ 559      A444FFFD 
+ 559      A444FFFD 
+ 559      A444FFFD 
+ 559      A444FF
+ 560 1940 FDA544FF 		.ascii	"\375\245D\377\375\245E\377\375\245E\377\375\245E\377\375\246"
+ 560      FDA545FF 
+ 560      FDA545FF 
+ 560      FDA545FF 
+ 560      FDA6
+ 561 1952 45FFFDA6 		.ascii	"E\377\375\246E\377\375\246E\377\375\246E\377\375\246E\377\375"
+ 561      45FFFDA6 
+ 561      45FFFDA6 
+ 561      45FFFDA6 
+ 561      45FFFD
+ 562 1965 A745FFFD 		.ascii	"\247E\377\375\247F\377\375\247F\377\375\247F\377\375\250F\377"
+ 562      A746FFFD 
+ 562      A746FFFD 
+ 562      A746FFFD 
+ 562      A846FF
+ 563 1978 FDA846FF 		.ascii	"\375\250F\377\375\250F\377\375\250F\377\375\251F\377\375\251"
+ 563      FDA846FF 
+ 563      FDA846FF 
+ 563      FDA946FF 
+ 563      FDA9
+ 564 198a 46FFFDA9 		.ascii	"F\377\375\251G\377\375\251G\377\375\251G\377\375\252G\377\375"
+ 564      47FFFDA9 
+ 564      47FFFDA9 
+ 564      47FFFDAA 
+ 564      47FFFD
+ 565 199d AA47FFFD 		.ascii	"\252G\377\375\252G\377\375\252G\377\375\253G\377\375\253H\377"
+ 565      AA47FFFD 
+ 565      AA47FFFD 
+ 565      AB47FFFD 
+ 565      AB48FF
+ 566 19b0 FDAB48FF 		.ascii	"\375\253H\377\375\253H\377\375\253H\377\375\254H\377\375\254"
+ 566      FDAB48FF 
+ 566      FDAB48FF 
+ 566      FDAC48FF 
+ 566      FDAC
+ 567 19c2 48FFFDAC 		.ascii	"H\377\375\254H\377\375\254H\377\375\255I\377\375\255I\377\375"
+ 567      48FFFDAC 
+ 567      48FFFDAD 
+ 567      49FFFDAD 
+ 567      49FFFD
+ 568 19d5 AD49FFFD 		.ascii	"\255I\377\375\255I\377\375\255I\377\375\256I\377\375\256I\377"
+ 568      AD49FFFD 
+ 568      AD49FFFD 
+ 568      AE49FFFD 
+GAS LISTING /tmp/ccPN994e.s 			page 32
+
+
+ 568      AE49FF
+ 569 19e8 FDAE49FF 		.ascii	"\375\256I\377\375\256J\377\375\257J\377\376\257J\377\376\257"
+ 569      FDAE4AFF 
+ 569      FDAF4AFF 
+ 569      FEAF4AFF 
+ 569      FEAF
+ 570 19fa 4AFFFEAF 		.ascii	"J\377\376\257J\377\376\257J\377\376\260J\377\376\260K\377\376"
+ 570      4AFFFEAF 
+ 570      4AFFFEB0 
+ 570      4AFFFEB0 
+ 570      4BFFFE
+ 571 1a0d B04BFFFE 		.ascii	"\260K\377\376\260K\377\376\261K\377\376\261K\377\376\261K\377"
+ 571      B04BFFFE 
+ 571      B14BFFFE 
+ 571      B14BFFFE 
+ 571      B14BFF
+ 572 1a20 FEB14BFF 		.ascii	"\376\261K\377\375\262K\377\375\262L\377\375\262L\377\375\262"
+ 572      FDB24BFF 
+ 572      FDB24CFF 
+ 572      FDB24CFF 
+ 572      FDB2
+ 573 1a32 4CFFFDB3 		.ascii	"L\377\375\263L\377\375\263M\377\375\263M\377\375\263M\377\375"
+ 573      4CFFFDB3 
+ 573      4DFFFDB3 
+ 573      4DFFFDB3 
+ 573      4DFFFD
+ 574 1a45 B44DFFFD 		.ascii	"\264M\377\375\264N\377\375\264N\377\375\264N\377\375\265N\377"
+ 574      B44EFFFD 
+ 574      B44EFFFD 
+ 574      B44EFFFD 
+ 574      B54EFF
+ 575 1a58 FDB54EFF 		.ascii	"\375\265N\377\375\265O\377\375\265O\377\375\266O\377\375\266"
+ 575      FDB54FFF 
+ 575      FDB54FFF 
+ 575      FDB64FFF 
+ 575      FDB6
+ 576 1a6a 4FFFFDB6 		.ascii	"O\377\375\266P\377\375\266P\377\375\267P\377\375\267P\377\375"
+ 576      50FFFDB6 
+ 576      50FFFDB7 
+ 576      50FFFDB7 
+ 576      50FFFD
+ 577 1a7d B751FFFD 		.ascii	"\267Q\377\375\267Q\377\375\270Q\377\375\270Q\377\375\270R\377"
+ 577      B751FFFD 
+ 577      B851FFFD 
+ 577      B851FFFD 
+ 577      B852FF
+ 578 1a90 FDB852FF 		.ascii	"\375\270R\377\375\271R\377\375\271R\377\375\271S\377\375\271"
+ 578      FDB952FF 
+ 578      FDB952FF 
+ 578      FDB953FF 
+ 578      FDB9
+ 579 1aa2 53FFFDBA 		.ascii	"S\377\375\272S\377\375\272S\377\375\272T\377\375\272T\377\375"
+ 579      53FFFDBA 
+ 579      53FFFDBA 
+ 579      54FFFDBA 
+ 579      54FFFD
+ 580 1ab5 BB54FFFD 		.ascii	"\273T\377\375\273T\377\375\273U\377\375\273U\377\375\274U\377"
+GAS LISTING /tmp/ccPN994e.s 			page 33
+
+
+ 580      BB54FFFD 
+ 580      BB55FFFD 
+ 580      BB55FFFD 
+ 580      BC55FF
+ 581 1ac8 FDBC55FF 		.ascii	"\375\274U\377\375\274V\377\375\274V\377\375\275V\377\375\275"
+ 581      FDBC56FF 
+ 581      FDBC56FF 
+ 581      FDBD56FF 
+ 581      FDBD
+ 582 1ada 56FFFDBD 		.ascii	"V\377\375\275W\377\375\275W\377\375\276W\377\375\276W\377\375"
+ 582      57FFFDBD 
+ 582      57FFFDBE 
+ 582      57FFFDBE 
+ 582      57FFFD
+ 583 1aed BE58FFFD 		.ascii	"\276X\377\375\276X\377\375\277X\377\375\277X\377\375\277Y\377"
+ 583      BE58FFFD 
+ 583      BF58FFFD 
+ 583      BF58FFFD 
+ 583      BF59FF
+ 584 1b00 FDBF59FF 		.ascii	"\375\277Y\377\375\300Y\377\375\300Y\377\375\300Z\377\375\300"
+ 584      FDC059FF 
+ 584      FDC059FF 
+ 584      FDC05AFF 
+ 584      FDC0
+ 585 1b12 5AFFFDC1 		.ascii	"Z\377\375\301Z\377\375\301Z\377\375\301[\377\375\301[\377\375"
+ 585      5AFFFDC1 
+ 585      5AFFFDC1 
+ 585      5BFFFDC1 
+ 585      5BFFFD
+ 586 1b25 C964FFFD 		.ascii	"\311d\377\375\312d\377\375\312d\377\375\312d\377\375\312e\377"
+ 586      CA64FFFD 
+ 586      CA64FFFD 
+ 586      CA64FFFD 
+ 586      CA65FF
+ 587 1b38 FDCB65FF 		.ascii	"\375\313e\377\375\313e\377\375\313e\377\375\313f\377\375\313"
+ 587      FDCB65FF 
+ 587      FDCB65FF 
+ 587      FDCB66FF 
+ 587      FDCB
+ 588 1b4a 66FFFDCC 		.ascii	"f\377\375\314f\377\375\314g\377\375\314g\377\375\314g\377\375"
+ 588      66FFFDCC 
+ 588      67FFFDCC 
+ 588      67FFFDCC 
+ 588      67FFFD
+ 589 1b5d CD67FFFD 		.ascii	"\315g\377\375\315h\377\375\315h\377\375\315h\377\375\316h\377"
+ 589      CD68FFFD 
+ 589      CD68FFFD 
+ 589      CD68FFFD 
+ 589      CE68FF
+ 590 1b70 FDCE69FF 		.ascii	"\375\316i\377\375\316i\377\375\316i\377\375\317j\377\375\317"
+ 590      FDCE69FF 
+ 590      FDCE69FF 
+ 590      FDCF6AFF 
+ 590      FDCF
+ 591 1b82 6AFFFDCF 		.ascii	"j\377\375\317j\377\375\317j\377\375\320k\377\375\320k\377\375"
+ 591      6AFFFDCF 
+ 591      6AFFFDD0 
+GAS LISTING /tmp/ccPN994e.s 			page 34
+
+
+ 591      6BFFFDD0 
+ 591      6BFFFD
+ 592 1b95 D06BFFFD 		.ascii	"\320k\377\375\320k\377\375\321l\377\375\321l\377\375\321l\377"
+ 592      D06BFFFD 
+ 592      D16CFFFD 
+ 592      D16CFFFD 
+ 592      D16CFF
+ 593 1ba8 FDD16DFF 		.ascii	"\375\321m\377\375\321m\377\375\322m\377\375\322m\377\375\322"
+ 593      FDD16DFF 
+ 593      FDD26DFF 
+ 593      FDD26DFF 
+ 593      FDD2
+ 594 1bba 6EFFFDD2 		.ascii	"n\377\375\322n\377\375\323n\377\375\323o\377\375\323o\377\375"
+ 594      6EFFFDD3 
+ 594      6EFFFDD3 
+ 594      6FFFFDD3 
+ 594      6FFFFD
+ 595 1bcd D36FFFFD 		.ascii	"\323o\377\375\324o\377\375\324p\377\375\324p\377\375\324p\377"
+ 595      D46FFFFD 
+ 595      D470FFFD 
+ 595      D470FFFD 
+ 595      D470FF
+ 596 1be0 FDD571FF 		.ascii	"\375\325q\377\375\325q\377\375\325q\377\375\325q\377\375\325"
+ 596      FDD571FF 
+ 596      FDD571FF 
+ 596      FDD571FF 
+ 596      FDD5
+ 597 1bf2 72FFFDD6 		.ascii	"r\377\375\326r\377\375\326r\377\375\326s\377\375\326s\377\375"
+ 597      72FFFDD6 
+ 597      72FFFDD6 
+ 597      73FFFDD6 
+ 597      73FFFD
+ 598 1c05 D773FFFD 		.ascii	"\327s\377\375\327s\377\375\327t\377\375\327t\377\375\330t\377"
+ 598      D773FFFD 
+ 598      D774FFFD 
+ 598      D774FFFD 
+ 598      D874FF
+ 599 1c18 FDD875FF 		.ascii	"\375\330u\377\375\330u\377\375\330u\377\375\331u\377\375\331"
+ 599      FDD875FF 
+ 599      FDD875FF 
+ 599      FDD975FF 
+ 599      FDD9
+ 600 1c2a 76FFFDD9 		.ascii	"v\377\375\331v\377\375\331v\377\375\331w\377\375\331w\377\375"
+ 600      76FFFDD9 
+ 600      76FFFDD9 
+ 600      77FFFDD9 
+ 600      77FFFD
+ 601 1c3d D977FFFD 		.ascii	"\331w\377\375\331w\377\375\332x\377\375\332x\377\375\332x\377"
+ 601      D977FFFD 
+ 601      DA78FFFD 
+ 601      DA78FFFD 
+ 601      DA78FF
+ 602 1c50 FDDA78FF 		.ascii	"\375\332x\377\375\332y\377\375\332y\377\375\332y\377\375\332"
+ 602      FDDA79FF 
+ 602      FDDA79FF 
+ 602      FDDA79FF 
+ 602      FDDA
+GAS LISTING /tmp/ccPN994e.s 			page 35
+
+
+ 603 1c62 79FFFDDB 		.ascii	"y\377\375\333z\377\375\333z\377\375\333z\377\375\333z\377\375"
+ 603      7AFFFDDB 
+ 603      7AFFFDDB 
+ 603      7AFFFDDB 
+ 603      7AFFFD
+ 604 1c75 DB7BFFFD 		.ascii	"\333{\377\375\333{\377\375\333{\377\375\333{\377\375\334|\377"
+ 604      DB7BFFFD 
+ 604      DB7BFFFD 
+ 604      DB7BFFFD 
+ 604      DC7CFF
+ 605 1c88 FDDC7CFF 		.ascii	"\375\334|\377\375\334|\377\375\334}\377\375\334}\377\375\334"
+ 605      FDDC7CFF 
+ 605      FDDC7DFF 
+ 605      FDDC7DFF 
+ 605      FDDC
+ 606 1c9a 7DFFFDDC 		.ascii	"}\377\375\334}\377\375\335~\377\375\335~\377\375\335~\377\375"
+ 606      7DFFFDDD 
+ 606      7EFFFDDD 
+ 606      7EFFFDDD 
+ 606      7EFFFD
+ 607 1cad DD7EFFFD 		.ascii	"\335~\377\375\335\177\377\375\335\177\377\375\335\177\377\375"
+ 607      DD7FFFFD 
+ 607      DD7FFFFD 
+ 607      DD7FFFFD 
+ 608 1cbd DD7FFFFD 		.ascii	"\335\177\377\375\336\200\377\375\336\200\377\375\336\200\377"
+ 608      DE80FFFD 
+ 608      DE80FFFD 
+ 608      DE80FF
+ 609 1ccc FDDE80FF 		.ascii	"\375\336\200\377\376\336\201\377\376\336\201\377\376\336\201"
+ 609      FEDE81FF 
+ 609      FEDE81FF 
+ 609      FEDE81
+ 610 1cdb FFFEDE82 		.ascii	"\377\376\336\202\377\376\337\202\377\376\337\202\377\376\337"
+ 610      FFFEDF82 
+ 610      FFFEDF82 
+ 610      FFFEDF
+ 611 1cea 82FFFEDF 		.ascii	"\202\377\376\337\203\377\376\337\203\377\376\337\203\377\376"
+ 611      83FFFEDF 
+ 611      83FFFEDF 
+ 611      83FFFE
+ 612 1cf9 DF83FFFE 		.ascii	"\337\203\377\376\337\204\377\376\340\204\377\376\340\204\377"
+ 612      DF84FFFE 
+ 612      E084FFFE 
+ 612      E084FF
+ 613 1d08 FEE084FF 		.ascii	"\376\340\204\377\376\340\205\377\376\340\205\377\376\340\205"
+ 613      FEE085FF 
+ 613      FEE085FF 
+ 613      FEE085
+ 614 1d17 FFFEE085 		.ascii	"\377\376\340\205\377\376\340\206\377\376\341\206\377\376\345"
+ 614      FFFEE086 
+ 614      FFFEE186 
+ 614      FFFEE5
+ 615 1d26 8FFFFEE5 		.ascii	"\217\377\376\345\217\377\376\345\217\377\376\345\217\377\376"
+ 615      8FFFFEE5 
+ 615      8FFFFEE5 
+ 615      8FFFFE
+ 616 1d35 E590FFFE 		.ascii	"\345\220\377\376\345\220\377\376\345\220\377\376\346\220\377"
+GAS LISTING /tmp/ccPN994e.s 			page 36
+
+
+ 616      E590FFFE 
+ 616      E590FFFE 
+ 616      E690FF
+ 617 1d44 FEE691FF 		.ascii	"\376\346\221\377\376\346\221\377\376\346\221\377\376\346\222"
+ 617      FEE691FF 
+ 617      FEE691FF 
+ 617      FEE692
+ 618 1d53 FFFEE692 		.ascii	"\377\376\346\222\377\376\346\222\377\376\346\222\377\376\347"
+ 618      FFFEE692 
+ 618      FFFEE692 
+ 618      FFFEE7
+ 619 1d62 93FFFEE7 		.ascii	"\223\377\376\347\223\377\376\347\223\377\376\347\223\377\376"
+ 619      93FFFEE7 
+ 619      93FFFEE7 
+ 619      93FFFE
+ 620 1d71 E794FFFE 		.ascii	"\347\224\377\376\347\224\377\376\347\224\377\376\347\224\377"
+ 620      E794FFFE 
+ 620      E794FFFE 
+ 620      E794FF
+ 621 1d80 FEE895FF 		.ascii	"\376\350\225\377\376\350\225\377\376\350\225\377\376\350\225"
+ 621      FEE895FF 
+ 621      FEE895FF 
+ 621      FEE895
+ 622 1d8f FFFEE896 		.ascii	"\377\376\350\226\377\376\350\226\377\376\350\226\377\376\350"
+ 622      FFFEE896 
+ 622      FFFEE896 
+ 622      FFFEE8
+ 623 1d9e 97FFFEE9 		.ascii	"\227\377\376\351\227\377\376\351\227\377\376\351\227\377\376"
+ 623      97FFFEE9 
+ 623      97FFFEE9 
+ 623      97FFFE
+ 624 1dad E998FFFE 		.ascii	"\351\230\377\376\351\230\377\376\351\230\377\376\351\230\377"
+ 624      E998FFFE 
+ 624      E998FFFE 
+ 624      E998FF
+ 625 1dbc FEE999FF 		.ascii	"\376\351\231\377\376\351\231\377\376\352\231\377\376\352\231"
+ 625      FEE999FF 
+ 625      FEEA99FF 
+ 625      FEEA99
+ 626 1dcb FFFEEA9A 		.ascii	"\377\376\352\232\377\376\352\232\377\376\352\232\377\376\352"
+ 626      FFFEEA9A 
+ 626      FFFEEA9A 
+ 626      FFFEEA
+ 627 1dda 9AFFFEEA 		.ascii	"\232\377\376\352\233\377\376\352\233\377\376\353\233\377\376"
+ 627      9BFFFEEA 
+ 627      9BFFFEEB 
+ 627      9BFFFE
+ 628 1de9 EB9CFFFE 		.ascii	"\353\234\377\376\353\234\377\376\353\234\377\376\353\234\377"
+ 628      EB9CFFFE 
+ 628      EB9CFFFE 
+ 628      EB9CFF
+ 629 1df8 FEEB9DFF 		.ascii	"\376\353\235\377\376\353\235\377\376\353\235\377\376\354\235"
+ 629      FEEB9DFF 
+ 629      FEEB9DFF 
+ 629      FEEC9D
+ 630 1e07 FFFEEC9E 		.ascii	"\377\376\354\236\377\376\354\236\377\376\354\236\377\376\354"
+ 630      FFFEEC9E 
+GAS LISTING /tmp/ccPN994e.s 			page 37
+
+
+ 630      FFFEEC9E 
+ 630      FFFEEC
+ 631 1e16 9EFFFEEC 		.ascii	"\236\377\376\354\237\377\376\354\237\377\376\354\237\377\376"
+ 631      9FFFFEEC 
+ 631      9FFFFEEC 
+ 631      9FFFFE
+ 632 1e25 ED9FFFFE 		.ascii	"\355\237\377\376\355\240\377\376\355\240\377\376\355\240\377"
+ 632      EDA0FFFE 
+ 632      EDA0FFFE 
+ 632      EDA0FF
+ 633 1e34 FEEDA1FF 		.ascii	"\376\355\241\377\376\355\241\377\376\355\241\377\376\355\241"
+ 633      FEEDA1FF 
+ 633      FEEDA1FF 
+ 633      FEEDA1
+ 634 1e43 FFFEEDA2 		.ascii	"\377\376\355\242\377\376\356\242\377\376\356\242\377\376\356"
+ 634      FFFEEEA2 
+ 634      FFFEEEA2 
+ 634      FFFEEE
+ 635 1e52 A2FFFEEE 		.ascii	"\242\377\376\356\243\377\376\356\243\377\376\356\243\377\376"
+ 635      A3FFFEEE 
+ 635      A3FFFEEE 
+ 635      A3FFFE
+ 636 1e61 EEA4FFFE 		.ascii	"\356\244\377\376\356\244\377\376\357\244\377\376\357\244\377"
+ 636      EEA4FFFE 
+ 636      EFA4FFFE 
+ 636      EFA4FF
+ 637 1e70 FEEFA5FF 		.ascii	"\376\357\245\377\376\357\245\377\376\357\245\377\376\357\246"
+ 637      FEEFA5FF 
+ 637      FEEFA5FF 
+ 637      FEEFA6
+ 638 1e7f FFFEEFA6 		.ascii	"\377\376\357\246\377\376\357\246\377\376\360\246\377\376\360"
+ 638      FFFEEFA6 
+ 638      FFFEF0A6 
+ 638      FFFEF0
+ 639 1e8e A7FFFEF0 		.ascii	"\247\377\376\360\247\377\376\360\247\377\376\360\247\377\376"
+ 639      A7FFFEF0 
+ 639      A7FFFEF0 
+ 639      A7FFFE
+ 640 1e9d F0A8FFFE 		.ascii	"\360\250\377\376\360\250\377\376\360\250\377\376\360\251\377"
+ 640      F0A8FFFE 
+ 640      F0A8FFFE 
+ 640      F0A9FF
+ 641 1eac FEF1A9FF 		.ascii	"\376\361\251\377\376\361\251\377\376\361\251\377\376\361\252"
+ 641      FEF1A9FF 
+ 641      FEF1A9FF 
+ 641      FEF1AA
+ 642 1ebb FFFEF1AA 		.ascii	"\377\376\361\252\377\376\361\252\377\376\361\252\377\376\361"
+ 642      FFFEF1AA 
+ 642      FFFEF1AA 
+ 642      FFFEF1
+ 643 1eca ABFFFEF1 		.ascii	"\253\377\376\361\253\377\376\362\253\377\376\362\254\377\376"
+ 643      ABFFFEF2 
+ 643      ABFFFEF2 
+ 643      ACFFFE
+ 644 1ed9 F2ACFFFE 		.ascii	"\362\254\377\376\362\254\377\376\362\254\377\376\362\255\377"
+ 644      F2ACFFFE 
+ 644      F2ACFFFE 
+GAS LISTING /tmp/ccPN994e.s 			page 38
+
+
+ 644      F2ADFF
+ 645 1ee8 FEF2ADFF 		.ascii	"\376\362\255\377\376\362\255\377\376\363\255\377\376\363\256"
+ 645      FEF2ADFF 
+ 645      FEF3ADFF 
+ 645      FEF3AE
+ 646 1ef7 FFFEF3AE 		.ascii	"\377\376\363\256\377\376\363\256\377\376\363\257\377\376\363"
+ 646      FFFEF3AE 
+ 646      FFFEF3AF 
+ 646      FFFEF3
+ 647 1f06 AFFFFEF3 		.ascii	"\257\377\376\363\257\377\376\363\257\377\376\363\260\377\376"
+ 647      AFFFFEF3 
+ 647      AFFFFEF3 
+ 647      B0FFFE
+ 648 1f15 F4B0FFFE 		.ascii	"\364\260\377\376\364\260\377\376\364\260\377\376\364\261\377"
+ 648      F4B0FFFE 
+ 648      F4B0FFFE 
+ 648      F4B1FF
+ 649 1f24 FEF8BAFF 		.ascii	"\376\370\272\377\376\370\272\377\376\370\272\377\376\370\273"
+ 649      FEF8BAFF 
+ 649      FEF8BAFF 
+ 649      FEF8BB
+ 650 1f33 FFFEF8BB 		.ascii	"\377\376\370\273\377\376\370\273\377\376\370\274\377\376\370"
+ 650      FFFEF8BB 
+ 650      FFFEF8BC 
+ 650      FFFEF8
+ 651 1f42 BCFFFEF9 		.ascii	"\274\377\376\371\274\377\376\371\274\377\376\371\275\377\376"
+ 651      BCFFFEF9 
+ 651      BCFFFEF9 
+ 651      BDFFFE
+ 652 1f51 F9BDFFFE 		.ascii	"\371\275\377\376\371\275\377\376\371\275\377\376\371\276\377"
+ 652      F9BDFFFE 
+ 652      F9BDFFFE 
+ 652      F9BEFF
+ 653 1f60 FEF9BEFF 		.ascii	"\376\371\276\377\376\371\276\377\376\371\277\377\376\372\277"
+ 653      FEF9BEFF 
+ 653      FEF9BFFF 
+ 653      FEFABF
+ 654 1f6f FFFEFABF 		.ascii	"\377\376\372\277\377\376\372\277\377\376\372\300\377\376\372"
+ 654      FFFEFABF 
+ 654      FFFEFAC0 
+ 654      FFFEFA
+ 655 1f7e C0FFFEFA 		.ascii	"\300\377\376\372\300\377\376\372\300\377\376\372\301\377\376"
+ 655      C0FFFEFA 
+ 655      C0FFFEFA 
+ 655      C1FFFE
+ 656 1f8d FAC1FFFE 		.ascii	"\372\301\377\376\373\301\377\376\373\302\377\376\373\302\377"
+ 656      FBC1FFFE 
+ 656      FBC2FFFE 
+ 656      FBC2FF
+ 657 1f9c FEFBC2FF 		.ascii	"\376\373\302\377\376\373\302\377\376\373\303\377\376\373\303"
+ 657      FEFBC2FF 
+ 657      FEFBC3FF 
+ 657      FEFBC3
+ 658 1fab FFFEFBC3 		.ascii	"\377\376\373\303\377\376\373\304\377\376\374\304\377\376\374"
+ 658      FFFEFBC4 
+ 658      FFFEFCC4 
+ 658      FFFEFC
+GAS LISTING /tmp/ccPN994e.s 			page 39
+
+
+ 659 1fba C4FFFEFC 		.ascii	"\304\377\376\374\304\377"
+ 659      C4FF
+ 660 1fc0 FEFCC5FF 		.ascii	"\376\374\305\377\376\374\305\377\376\374\305\377\376\374\305"
+ 660      FEFCC5FF 
+ 660      FEFCC5FF 
+ 660      FEFCC5
+ 661 1fcf FFFEFCC6 		.ascii	"\377\376\374\306\377\376\374\306\377\376\375\306\377\376\375"
+ 661      FFFEFCC6 
+ 661      FFFEFDC6 
+ 661      FFFEFD
+ 662 1fde C7FFFEFD 		.ascii	"\307\377\376\375\307\377\376\375\307\377\376\375\307\377\376"
+ 662      C7FFFEFD 
+ 662      C7FFFEFD 
+ 662      C7FFFE
+ 663 1fed FDC8FFFE 		.ascii	"\375\310\377\376\375\310\377\376\375\310\377\376\375\310\377"
+ 663      FDC8FFFE 
+ 663      FDC8FFFE 
+ 663      FDC8FF
+ 664 1ffc FEFDC9FF 		.ascii	"\376\375\311\377\376\376\311\377\376\376\311\377\376\376\312"
+ 664      FEFEC9FF 
+ 664      FEFEC9FF 
+ 664      FEFECA
+ 665 200b FFFEFECA 		.ascii	"\377\376\376\312\377\376\376\312\377\376\376\312\377\376\376"
+ 665      FFFEFECA 
+ 665      FFFEFECA 
+ 665      FFFEFE
+ 666 201a CBFFFEFE 		.ascii	"\313\377\376\376\313\377\376\376\313\377"
+ 666      CBFFFEFE 
+ 666      CBFF
+ 667              		.globl	heatmap_cs_YlOrRd_soft
+ 668              		.section	.data.rel.local
+ 669              		.align 8
+ 670              		.type	heatmap_cs_YlOrRd_soft, @object
+ 671              		.size	heatmap_cs_YlOrRd_soft, 8
+ 672              	heatmap_cs_YlOrRd_soft:
+ 673 0010 00000000 		.quad	soft
+ 673      00000000 
+ 674              		.section	.data.rel.ro.local
+ 675              		.align 16
+ 676              		.type	soft, @object
+ 677              		.size	soft, 16
+ 678              	soft:
+ 679 0020 00000000 		.quad	soft_data
+ 679      00000000 
+ 680 0028 01040000 		.quad	1025
+ 680      00000000 
+ 681              		.section	.rodata
+ 682 2024 00000000 		.align 32
+ 682      00000000 
+ 682      00000000 
+ 682      00000000 
+ 682      00000000 
+ 683              		.type	soft_data, @object
+ 684              		.size	soft_data, 4100
+ 685              	soft_data:
+ 686 2040 00       		.string	""
+ 687 2041 00       		.string	""
+GAS LISTING /tmp/ccPN994e.s 			page 40
+
+
+ 688 2042 00       		.string	""
+ 689 2043 00       		.string	""
+ 690 2044 7F00     		.string	"\177"
+ 691 2046 2500     		.string	"%"
+ 692 2048 8000     		.string	"\200"
+ 693 204a 26078000 		.string	"&\007\200"
+ 694 204e 260E8100 		.string	"&\016\201"
+ 695 2052 26168100 		.string	"&\026\201"
+ 696 2056 261D8200 		.string	"&\035\202"
+ 697 205a 26258200 		.string	"&%\202"
+ 698 205e 262C8300 		.string	"&,\203"
+ 699 2062 26348300 		.string	"&4\203"
+ 700 2066 263B8400 		.string	"&;\204"
+ 701 206a 26438400 		.string	"&C\204"
+ 702 206e 264A8500 		.string	"&J\205"
+ 703 2072 26528500 		.string	"&R\205"
+ 704 2076 26598600 		.string	"&Y\206"
+ 705 207a 26618600 		.string	"&a\206"
+ 706 207e 26688700 		.string	"&h\207"
+ 707 2082 26708700 		.string	"&p\207"
+ 708 2086 26778800 		.string	"&w\210"
+ 709 208a 267F8800 		.string	"&\177\210"
+ 710 208e 26868900 		.string	"&\206\211"
+ 711 2092 268D8900 		.string	"&\215\211"
+ 712 2096 26958A00 		.string	"&\225\212"
+ 713 209a 269C8A00 		.string	"&\234\212"
+ 714 209e 26A48A00 		.string	"&\244\212"
+ 715 20a2 26AB8B00 		.string	"&\253\213"
+ 716 20a6 26B38B00 		.string	"&\263\213"
+ 717 20aa 26BA8C00 		.string	"&\272\214"
+ 718 20ae 27C28C00 		.string	"'\302\214"
+ 719 20b2 27C98D00 		.string	"'\311\215"
+ 720 20b6 27D18D00 		.string	"'\321\215"
+ 721 20ba 27D88E00 		.string	"'\330\216"
+ 722 20be 27E08E00 		.string	"'\340\216"
+ 723 20c2 27E78F00 		.string	"'\347\217"
+ 724 20c6 27EF8F00 		.string	"'\357\217"
+ 725 20ca 27F69000 		.string	"'\366\220"
+ 726 20ce 27FE9000 		.string	"'\376\220"
+ 727 20d2 27FF9100 		.string	"'\377\221"
+ 728 20d6 27FF9100 		.string	"'\377\221"
+ 729 20da 27FF9200 		.string	"'\377\222"
+ 730 20de 27FF9200 		.string	"'\377\222"
+ 731 20e2 27FF9300 		.string	"'\377\223"
+ 732 20e6 27FF9300 		.string	"'\377\223"
+ 733 20ea 27FF9400 		.string	"'\377\224"
+ 734 20ee 27FF9400 		.string	"'\377\224"
+ 735 20f2 27FF9500 		.string	"'\377\225"
+ 736 20f6 27FF9500 		.string	"'\377\225"
+ 737 20fa 27FF9600 		.string	"'\377\226"
+ 738 20fe 27FF9600 		.string	"'\377\226"
+ 739 2102 27FF9600 		.string	"'\377\226"
+ 740 2106 27FF9700 		.string	"'\377\227"
+ 741 210a 27FF9700 		.string	"'\377\227"
+ 742 210e 27FF9800 		.string	"'\377\230"
+ 743 2112 27FF9800 		.string	"'\377\230"
+ 744 2116 27FF9900 		.string	"'\377\231"
+GAS LISTING /tmp/ccPN994e.s 			page 41
+
+
+ 745 211a 27FF9900 		.string	"'\377\231"
+ 746 211e 27FF9A00 		.string	"'\377\232"
+ 747 2122 27FF9A00 		.string	"'\377\232"
+ 748 2126 27FF9B00 		.string	"'\377\233"
+ 749 212a 27FF9B00 		.string	"'\377\233"
+ 750 212e 27FF9C00 		.string	"'\377\234"
+ 751 2132 27FF9C00 		.string	"'\377\234"
+ 752 2136 27FF9D00 		.string	"'\377\235"
+ 753 213a 27FF9D00 		.string	"'\377\235"
+ 754 213e 27FF9E00 		.string	"'\377\236"
+ 755 2142 27FF9E00 		.string	"'\377\236"
+ 756 2146 27FF9F00 		.string	"'\377\237"
+ 757 214a 27FF9F00 		.string	"'\377\237"
+ 758 214e 27FFA000 		.string	"'\377\240"
+ 759 2152 27FFA000 		.string	"'\377\240"
+ 760 2156 27FFA100 		.string	"'\377\241"
+ 761 215a 27FFA100 		.string	"'\377\241"
+ 762 215e 27FFA100 		.string	"'\377\241"
+ 763 2162 27FFA200 		.string	"'\377\242"
+ 764 2166 27FFA200 		.string	"'\377\242"
+ 765 216a 27FFA300 		.string	"'\377\243"
+ 766 216e 27FFA300 		.string	"'\377\243"
+ 767 2172 27FFA400 		.string	"'\377\244"
+ 768 2176 27FFA400 		.string	"'\377\244"
+ 769 217a 27FFA500 		.string	"'\377\245"
+ 770 217e 27FFA500 		.string	"'\377\245"
+ 771 2182 27FFA600 		.string	"'\377\246"
+ 772 2186 27FFA600 		.string	"'\377\246"
+ 773 218a 27FFA700 		.string	"'\377\247"
+ 774 218e 27FFA700 		.string	"'\377\247"
+ 775 2192 27FFA800 		.string	"'\377\250"
+ 776 2196 27FFA800 		.string	"'\377\250"
+ 777 219a 27FFA900 		.string	"'\377\251"
+ 778 219e 27FFA900 		.string	"'\377\251"
+ 779 21a2 27FFAA00 		.string	"'\377\252"
+ 780 21a6 27FFAA00 		.string	"'\377\252"
+ 781 21aa 27FFAB00 		.string	"'\377\253"
+ 782 21ae 27FFAB00 		.string	"'\377\253"
+ 783 21b2 27FFAB00 		.string	"'\377\253"
+ 784 21b6 27FFAC00 		.string	"'\377\254"
+ 785 21ba 27FFAC00 		.string	"'\377\254"
+ 786 21be 27FFAD00 		.string	"'\377\255"
+ 787 21c2 27FFAD00 		.string	"'\377\255"
+ 788 21c6 27FFAE00 		.string	"'\377\256"
+ 789 21ca 27FFAE00 		.string	"'\377\256"
+ 790 21ce 27FFAF00 		.string	"'\377\257"
+ 791 21d2 27FFAF00 		.string	"'\377\257"
+ 792 21d6 27FFB000 		.string	"'\377\260"
+ 793 21da 27FFB000 		.string	"'\377\260"
+ 794 21de 27FFB100 		.string	"'\377\261"
+ 795 21e2 27FFB100 		.string	"'\377\261"
+ 796 21e6 27FFB200 		.string	"'\377\262"
+ 797 21ea 26FFB200 		.string	"&\377\262"
+ 798 21ee 26FFB300 		.string	"&\377\263"
+ 799 21f2 26FFB300 		.string	"&\377\263"
+ 800 21f6 26FFB400 		.string	"&\377\264"
+ 801 21fa 26FFB400 		.string	"&\377\264"
+GAS LISTING /tmp/ccPN994e.s 			page 42
+
+
+ 802 21fe 26FFB400 		.string	"&\377\264"
+ 803 2202 26FFB500 		.string	"&\377\265"
+ 804 2206 26FFB500 		.string	"&\377\265"
+ 805 220a 26FFB600 		.string	"&\377\266"
+ 806 220e 26FFB600 		.string	"&\377\266"
+ 807 2212 26FFB700 		.string	"&\377\267"
+ 808 2216 26FFB700 		.string	"&\377\267"
+ 809 221a 26FFB800 		.string	"&\377\270"
+ 810 221e 26FFB800 		.string	"&\377\270"
+ 811 2222 26FFB900 		.string	"&\377\271"
+ 812 2226 26FFB900 		.string	"&\377\271"
+ 813 222a 26FFBA00 		.string	"&\377\272"
+ 814 222e 26FFBA00 		.string	"&\377\272"
+ 815 2232 26FFBB00 		.string	"&\377\273"
+ 816 2236 26FFBB00 		.string	"&\377\273"
+ 817 223a 26FFBC00 		.string	"&\377\274"
+ 818 223e 26FFBC00 		.string	"&\377\274"
+ 819 2242 26FFBC00 		.string	"&\377\274"
+ 820 2246 25FFBD00 		.string	"%\377\275"
+ 821 224a 25FFBD00 		.string	"%\377\275"
+ 822 224e 25FFBD00 		.string	"%\377\275"
+ 823 2252 25FFBE00 		.string	"%\377\276"
+ 824 2256 25FFBE00 		.string	"%\377\276"
+ 825 225a 25FFBE00 		.string	"%\377\276"
+ 826 225e 25FFBF00 		.string	"%\377\277"
+ 827 2262 25FFBF01 		.ascii	"%\377\277\001%\377\277\001%\377\300\001%\377\300\001%\377\300"
+ 827      25FFBF01 
+ 827      25FFC001 
+ 827      25FFC001 
+ 827      25FFC0
+ 828 2275 0125FFC0 		.ascii	"\001%\377\300\001%\377\301\001%\377\301\002%\377\301\002%\377"
+ 828      0125FFC1 
+ 828      0125FFC1 
+ 828      0225FFC1 
+ 828      0225FF
+ 829 2288 C20225FF 		.ascii	"\302\002%\377\302\002%\377\302\002%\377\303\002%\377\303\002"
+ 829      C20225FF 
+ 829      C20225FF 
+ 829      C30225FF 
+ 829      C302
+ 830 229a 25FFC303 		.ascii	"%\377\303\003$\377\303\003$\377\304\003$\377\304\003$\377\304"
+ 830      24FFC303 
+ 830      24FFC403 
+ 830      24FFC403 
+ 830      24FFC4
+ 831 22ad 0324FFC5 		.ascii	"\003$\377\305\003$\377\305\004$\377\305\004$\377\306\004$\377"
+ 831      0324FFC5 
+ 831      0424FFC5 
+ 831      0424FFC6 
+ 831      0424FF
+ 832 22c0 C60424FF 		.ascii	"\306\004$\377\306\004$\377\307\005$\377\307\005$\377\307\005"
+ 832      C60424FF 
+ 832      C70524FF 
+ 832      C70524FF 
+ 832      C705
+ 833 22d2 24FFC705 		.ascii	"$\377\307\005$\377\310\005$\377\310\006$\377\310\006#\377\311"
+ 833      24FFC805 
+GAS LISTING /tmp/ccPN994e.s 			page 43
+
+
+ 833      24FFC806 
+ 833      24FFC806 
+ 833      23FFC9
+ 834 22e5 0623FFC9 		.ascii	"\006#\377\311\006#\377\311\006#\377\312\007#\377\312\007#\377"
+ 834      0623FFC9 
+ 834      0623FFCA 
+ 834      0723FFCA 
+ 834      0723FF
+ 835 22f8 CA0723FF 		.ascii	"\312\007#\377\312\007#\377\313\007#\377\313\b#\377\313\b#\377"
+ 835      CA0723FF 
+ 835      CB0723FF 
+ 835      CB0823FF 
+ 835      CB0823FF 
+ 836 230c CC0823FF 		.ascii	"\314\b#\377\314\b#\377\314\b#\377\315\t#\377\315\t#\377\315\t"
+ 836      CC0823FF 
+ 836      CC0823FF 
+ 836      CD0923FF 
+ 836      CD0923FF 
+ 837 2322 22FFCD09 		.ascii	"\"\377\315\t\"\377\316\n\"\377\316\n\"\377\316\n\"\377\317\n"
+ 837      22FFCE0A 
+ 837      22FFCE0A 
+ 837      22FFCE0A 
+ 837      22FFCF0A 
+ 838 2336 22FFCF0B 		.ascii	"\"\377\317\013\"\377\317\013\"\377\317\013\"\377\320\013\"\377"
+ 838      22FFCF0B 
+ 838      22FFCF0B 
+ 838      22FFD00B 
+ 838      22FF
+ 839 2348 D00C22FF 		.ascii	"\320\f\"\377\320\f\"\377\321\f\"\377\321\f!\377\321\f!\377\322"
+ 839      D00C22FF 
+ 839      D10C22FF 
+ 839      D10C21FF 
+ 839      D10C21FF 
+ 840 235d 0D21FFD2 		.ascii	"\r!\377\322\r!\377\322\r!\377\322\r!\377\323\016!\377\323\016"
+ 840      0D21FFD2 
+ 840      0D21FFD2 
+ 840      0D21FFD3 
+ 840      0E21FFD3 
+ 841 2372 21FFD30E 		.ascii	"!\377\323\016!\377\324\016!\377\324\017!\377\324\017!\377\325"
+ 841      21FFD40E 
+ 841      21FFD40F 
+ 841      21FFD40F 
+ 841      21FFD5
+ 842 2385 0F21FFD5 		.ascii	"\017!\377\325\017 \377\325\017 \377\325\020 \377\326\020 \377"
+ 842      0F20FFD5 
+ 842      0F20FFD5 
+ 842      1020FFD6 
+ 842      1020FF
+ 843 2398 D61020FF 		.ascii	"\326\020 \377\326\020 \377\327\021 \377\327\021 \377\327\021"
+ 843      D61020FF 
+ 843      D71120FF 
+ 843      D71120FF 
+ 843      D711
+ 844 23aa 20FFD711 		.ascii	" \377\327\021 \377\330\021 \377\330\022\037\377\330\022\037\377"
+ 844      20FFD811 
+ 844      20FFD812 
+ 844      1FFFD812 
+GAS LISTING /tmp/ccPN994e.s 			page 44
+
+
+ 844      1FFF
+ 845 23bc D9121FFF 		.ascii	"\331\022\037\377\331\022\037\377\331\023\037\377\332\023\037"
+ 845      D9121FFF 
+ 845      D9131FFF 
+ 845      DA131F
+ 846 23cb FFDA131F 		.ascii	"\377\332\023\037\377\332\023\037\377\332\023\037\377\333\024"
+ 846      FFDA131F 
+ 846      FFDA131F 
+ 846      FFDB14
+ 847 23da 1FFFDB14 		.ascii	"\037\377\333\024\036\377\333\024\036\377\334\024\036\377\334"
+ 847      1EFFDB14 
+ 847      1EFFDC14 
+ 847      1EFFDC
+ 848 23e9 141EFFDC 		.ascii	"\024\036\377\334\025\036\377\334\025\036\377\335\025\036\377"
+ 848      151EFFDC 
+ 848      151EFFDD 
+ 848      151EFF
+ 849 23f8 DD151EFF 		.ascii	"\335\025\036\377\335\026\036\377\336\026\035\377\336\026\035"
+ 849      DD161EFF 
+ 849      DE161DFF 
+ 849      DE161D
+ 850 2407 FFDE161D 		.ascii	"\377\336\026\035\377\336\026\035\377\337\027\035\377\337\027"
+ 850      FFDE161D 
+ 850      FFDF171D 
+ 850      FFDF17
+ 851 2416 1DFFDF17 		.ascii	"\035\377\337\027\035\377\340\027\035\377\340\030\035\377\340"
+ 851      1DFFE017 
+ 851      1DFFE018 
+ 851      1DFFE0
+ 852 2425 181CFFE0 		.ascii	"\030\034\377\340\030\034\377\341\030\034\377\341\030\034\377"
+ 852      181CFFE1 
+ 852      181CFFE1 
+ 852      181CFF
+ 853 2434 E1191CFF 		.ascii	"\341\031\034\377\342\031\034\377\342\031\034\377\342\031\034"
+ 853      E2191CFF 
+ 853      E2191CFF 
+ 853      E2191C
+ 854 2443 FFE21A1B 		.ascii	"\377\342\032\033\377\343\032\034\377\343\033\034\377\343\033"
+ 854      FFE31A1C 
+ 854      FFE31B1C 
+ 854      FFE31B
+ 855 2452 1CFFE31C 		.ascii	"\034\377\343\034\034\377\343\035\034\377\344\035\034\377\344"
+ 855      1CFFE31D 
+ 855      1CFFE41D 
+ 855      1CFFE4
+ 856 2461 1E1CFFE4 		.ascii	"\036\034\377\344\036\034\377\344\037\034\377\344 \034\377\345"
+ 856      1E1CFFE4 
+ 856      1F1CFFE4 
+ 856      201CFFE5 
+ 857 2471 201DFFE5 		.ascii	" \035\377\345!\035\377\345!\035\377\345\"\035\377\345\"\035\377"
+ 857      211DFFE5 
+ 857      211DFFE5 
+ 857      221DFFE5 
+ 857      221DFF
+ 858 2484 E6231DFF 		.ascii	"\346#\035\377\346#\035\377\346$\035\377\346$\035\377\346%\035"
+ 858      E6231DFF 
+ 858      E6241DFF 
+GAS LISTING /tmp/ccPN994e.s 			page 45
+
+
+ 858      E6241DFF 
+ 858      E6251D
+ 859 2497 FFE7251E 		.ascii	"\377\347%\036\377\347&\036\377\347&\036\377\347'\036\377\347"
+ 859      FFE7261E 
+ 859      FFE7261E 
+ 859      FFE7271E 
+ 859      FFE7
+ 860 24a9 271EFFE8 		.ascii	"'\036\377\350(\036\377\350(\036\377\350)\036\377\350)\036\377"
+ 860      281EFFE8 
+ 860      281EFFE8 
+ 860      291EFFE8 
+ 860      291EFF
+ 861 24bc E82A1FFF 		.ascii	"\350*\037\377\351*\037\377\351*\037\377\351+\037\377\351+\037"
+ 861      E92A1FFF 
+ 861      E92A1FFF 
+ 861      E92B1FFF 
+ 861      E92B1F
+ 862 24cf FFE92C1F 		.ascii	"\377\351,\037\377\352,\037\377\352-\037\377\352-\037\377\352"
+ 862      FFEA2C1F 
+ 862      FFEA2D1F 
+ 862      FFEA2D1F 
+ 862      FFEA
+ 863 24e1 2E1FFFEA 		.ascii	".\037\377\352. \377\353. \377\353/ \377\353/ \377\3530 \377\353"
+ 863      2E20FFEB 
+ 863      2E20FFEB 
+ 863      2F20FFEB 
+ 863      2F20FFEB 
+ 864 24f9 3020FFEC 		.ascii	"0 \377\3540 \377\3541 \377\3541 \377\3542!\377\3542!\377\355"
+ 864      3020FFEC 
+ 864      3120FFEC 
+ 864      3120FFEC 
+ 864      3221FFEC 
+ 865 2511 3321FFED 		.ascii	"3!\377\3553!\377\3553!\377\3554!\377\3554!\377\3565!\377\356"
+ 865      3321FFED 
+ 865      3321FFED 
+ 865      3421FFED 
+ 865      3421FFEE 
+ 866 2529 3521FFEE 		.ascii	"5!\377\3565!\377\3566\"\377\3566\"\377\3566\"\377\3577\"\377"
+ 866      3521FFEE 
+ 866      3622FFEE 
+ 866      3622FFEE 
+ 866      3622FFEF 
+ 867 2540 EF3722FF 		.ascii	"\3577\"\377\3578\"\377\3578\"\377\3578\"\377\3609\"\377\3609"
+ 867      EF3822FF 
+ 867      EF3822FF 
+ 867      EF3822FF 
+ 867      F03922FF 
+ 868 2556 23FFF039 		.ascii	"#\377\3609#\377\360:#\377\360:#\377\361;#\377\361;#\377\361;"
+ 868      23FFF03A 
+ 868      23FFF03A 
+ 868      23FFF13B 
+ 868      23FFF13B 
+ 869 256e 23FFF13C 		.ascii	"#\377\361<#\377\361<#\377\362<$\377\362=$\377\362=$\377\362="
+ 869      23FFF13C 
+ 869      23FFF23C 
+ 869      24FFF23D 
+ 869      24FFF23D 
+GAS LISTING /tmp/ccPN994e.s 			page 46
+
+
+ 870 2586 24FFF23E 		.ascii	"$\377\362>$\377\363>$\377\363?$\377\363?$\377\363?$\377\363@"
+ 870      24FFF33E 
+ 870      24FFF33F 
+ 870      24FFF33F 
+ 870      24FFF33F 
+ 871 259e 25FFF440 		.ascii	"%\377\364@%\377\364@%\377\364A%\377\364A%\377\364A%\377\365B"
+ 871      25FFF440 
+ 871      25FFF441 
+ 871      25FFF441 
+ 871      25FFF441 
+ 872 25b6 25FFF542 		.ascii	"%\377\365B%\377\365B&\377\365C&\377\365C&\377\366C&\377\366D"
+ 872      25FFF542 
+ 872      26FFF543 
+ 872      26FFF543 
+ 872      26FFF643 
+ 873 25ce 26FFF644 		.ascii	"&\377\366D&\377\366D&\377\366E&\377\366E&\377\367E'\377\367F"
+ 873      26FFF644 
+ 873      26FFF645 
+ 873      26FFF645 
+ 873      26FFF745 
+ 874 25e6 27FFF746 		.ascii	"'\377\367F'\377\367F'\377\367G'\377\370G'\377\370G'\377\370H"
+ 874      27FFF746 
+ 874      27FFF747 
+ 874      27FFF847 
+ 874      27FFF847 
+ 875 25fe 27FFF848 		.ascii	"'\377\370H'\377\370H(\377\371I(\377\371I(\377\371I(\377\371J"
+ 875      27FFF848 
+ 875      28FFF949 
+ 875      28FFF949 
+ 875      28FFF949 
+ 876 2616 28FFF94A 		.ascii	"(\377\371J(\377\372J(\377\372K(\377\372K)\377\372K)\377\372L"
+ 876      28FFFA4A 
+ 876      28FFFA4B 
+ 876      28FFFA4B 
+ 876      29FFFA4B 
+ 877 262e 29FFFB4C 		.ascii	")\377\373L)\377\373L)\377\373M)\377\373M)\377\373M)\377\373N"
+ 877      29FFFB4C 
+ 877      29FFFB4D 
+ 877      29FFFB4D 
+ 877      29FFFB4D 
+ 878 2646 29FFFC4E 		.ascii	")\377\374N*\377\374O*\377\374O*\377\374P*\377\374Q*\377\374Q"
+ 878      2AFFFC4F 
+ 878      2AFFFC4F 
+ 878      2AFFFC50 
+ 878      2AFFFC51 
+ 879 265e 2AFFFC52 		.ascii	"*\377\374R*\377\374R*\377\374S*\377\374T*\377\374T*\377\374U"
+ 879      2AFFFC52 
+ 879      2AFFFC53 
+ 879      2AFFFC54 
+ 879      2AFFFC54 
+ 880 2676 2AFFFC55 		.ascii	"*\377\374U*\377\374V*\377\374W*\377\374W*\377\374X*\377\374X"
+ 880      2AFFFC56 
+ 880      2AFFFC57 
+ 880      2AFFFC57 
+ 880      2AFFFC58 
+ 881 268e 2AFFFC59 		.ascii	"*\377\374Y*\377\374Y*\377\374Z*\377\374[+\377\374[+\377\374\\"
+ 881      2AFFFC59 
+GAS LISTING /tmp/ccPN994e.s 			page 47
+
+
+ 881      2AFFFC5A 
+ 881      2AFFFC5B 
+ 881      2BFFFC5B 
+ 882 26a6 2BFFFC5C 		.ascii	"+\377\374\\+\377\374]+\377\374]+\377\374^+\377\374^+\377\374"
+ 882      2BFFFC5D 
+ 882      2BFFFC5D 
+ 882      2BFFFC5E 
+ 882      2BFFFC5E 
+ 883 26bd 5F2BFFFC 		.ascii	"_+\377\374_+\377\374`+\377\374a+\377\374a+\377\374b,\377\374"
+ 883      5F2BFFFC 
+ 883      602BFFFC 
+ 883      612BFFFC 
+ 883      612BFFFC 
+ 884 26d5 622CFFFC 		.ascii	"b,\377\374c,\377\374c,\377\374d,\377\374d,\377\374e,\377\374"
+ 884      632CFFFC 
+ 884      632CFFFC 
+ 884      642CFFFC 
+ 884      642CFFFC 
+ 885 26ed 652CFFFC 		.ascii	"e,\377\374f,\377\374f,\377\374g-\377\374g-\377\374h-\377\374"
+ 885      662CFFFC 
+ 885      662CFFFC 
+ 885      672DFFFC 
+ 885      672DFFFC 
+ 886 2705 682DFFFC 		.ascii	"h-\377\374i-\377\374i-\377\374j-\377\374j-\377\374k-\377\374"
+ 886      692DFFFC 
+ 886      692DFFFC 
+ 886      6A2DFFFC 
+ 886      6A2DFFFC 
+ 887 271d 6B2EFFFC 		.ascii	"k.\377\374l.\377\374l.\377\374m.\377\374m.\377\374n.\377\374"
+ 887      6C2EFFFC 
+ 887      6C2EFFFC 
+ 887      6D2EFFFC 
+ 887      6D2EFFFC 
+ 888 2735 6E2EFFFC 		.ascii	"n.\377\374o.\377\374o/\377\374p/\377\374p/\377\374q/\377\374"
+ 888      6F2EFFFC 
+ 888      6F2FFFFC 
+ 888      702FFFFC 
+ 888      702FFFFC 
+ 889 274d 712FFFFC 		.ascii	"q/\377\374r/\377\374r/\377\374r0\377\374s0\377\374s0\377\374"
+ 889      722FFFFC 
+ 889      722FFFFC 
+ 889      7230FFFC 
+ 889      7330FFFC 
+ 890 2765 7430FFFC 		.ascii	"t0\377\374t0\377\374u0\377\374u1\377\374v1\377\374v1\377\374"
+ 890      7430FFFC 
+ 890      7530FFFC 
+ 890      7531FFFC 
+ 890      7631FFFC 
+ 891 277d 7731FFFC 		.ascii	"w1\377\374w1\377\374x1\377\374x2\377\374y2\377\374y2\377\374"
+ 891      7731FFFC 
+ 891      7831FFFC 
+ 891      7832FFFC 
+ 891      7932FFFC 
+ 892 2795 7932FFFC 		.ascii	"y2\377\374z2\377\374z2\377\374{3\377\374{3\377\374|3\377\374"
+ 892      7A32FFFC 
+ 892      7A32FFFC 
+ 892      7B33FFFC 
+GAS LISTING /tmp/ccPN994e.s 			page 48
+
+
+ 892      7B33FFFC 
+ 893 27ad 7C33FFFC 		.ascii	"|3\377\374}3\377\374}4\377\374}4\377\374~4\377\374~4\377\374"
+ 893      7D33FFFC 
+ 893      7D34FFFC 
+ 893      7D34FFFC 
+ 893      7E34FFFC 
+ 894 27c5 7F34FFFC 		.ascii	"\1774\377\374\1775\377\374\2005\377\375\2005\377\375\2015\377"
+ 894      7F35FFFC 
+ 894      8035FFFD 
+ 894      8035FFFD 
+ 894      8135FF
+ 895 27d8 FD8135FF 		.ascii	"\375\2015\377\375\2016\377\375\2026\377\375\2026\377\375\203"
+ 895      FD8136FF 
+ 895      FD8236FF 
+ 895      FD8236FF 
+ 895      FD83
+ 896 27ea 36FFFD83 		.ascii	"6\377\375\2036\377\375\2047\377\375\2047\377\375\2047\377\375"
+ 896      36FFFD84 
+ 896      37FFFD84 
+ 896      37FFFD84 
+ 896      37FFFD
+ 897 27fd 8537FFFD 		.ascii	"\2057\377\375\2057\377\375\2068\377\375\2068\377\375\2078\377"
+ 897      8537FFFD 
+ 897      8638FFFD 
+ 897      8638FFFD 
+ 897      8738FF
+ 898 2810 FD8738FF 		.ascii	"\375\2078\377\375\2079\377\375\2109\377\375\2109\377\375\211"
+ 898      FD8739FF 
+ 898      FD8839FF 
+ 898      FD8839FF 
+ 898      FD89
+ 899 2822 39FFFD89 		.ascii	"9\377\375\211:\377\375\212:\377\375\212:\377\375\212:\377\375"
+ 899      3AFFFD8A 
+ 899      3AFFFD8A 
+ 899      3AFFFD8A 
+ 899      3AFFFD
+ 900 2835 8B3BFFFD 		.ascii	"\213;\377\375\213;\377\375\214;\377\375\214;\377\374\215;\377"
+ 900      8B3BFFFD 
+ 900      8C3BFFFD 
+ 900      8C3BFFFC 
+ 900      8D3BFF
+ 901 2848 FD8D3CFF 		.ascii	"\375\215<\377\375\215<\377\375\215<\377\375\216<\377\375\216"
+ 901      FD8D3CFF 
+ 901      FD8D3CFF 
+ 901      FD8E3CFF 
+ 901      FD8E
+ 902 285a 3CFFFD8E 		.ascii	"<\377\375\216<\377\375\217<\377\375\217<\377\375\217<\377\375"
+ 902      3CFFFD8F 
+ 902      3CFFFD8F 
+ 902      3CFFFD8F 
+ 902      3CFFFD
+ 903 286d 903CFFFD 		.ascii	"\220<\377\375\220<\377\375\220<\377\375\220=\377\375\221=\377"
+ 903      903CFFFD 
+ 903      903CFFFD 
+ 903      903DFFFD 
+ 903      913DFF
+ 904 2880 FD913DFF 		.ascii	"\375\221=\377\375\221=\377\375\222=\377\375\222=\377\375\222"
+GAS LISTING /tmp/ccPN994e.s 			page 49
+
+
+ 904      FD913DFF 
+ 904      FD923DFF 
+ 904      FD923DFF 
+ 904      FD92
+ 905 2892 3DFFFD93 		.ascii	"=\377\375\223=\377\375\223=\377\375\223=\377\375\223=\377\375"
+ 905      3DFFFD93 
+ 905      3DFFFD93 
+ 905      3DFFFD93 
+ 905      3DFFFD
+ 906 28a5 943DFFFD 		.ascii	"\224=\377\375\224>\377\375\224>\377\375\225>\377\375\225>\377"
+ 906      943EFFFD 
+ 906      943EFFFD 
+ 906      953EFFFD 
+ 906      953EFF
+ 907 28b8 FD953EFF 		.ascii	"\375\225>\377\375\225>\377\375\226>\377\375\226>\377\375\226"
+ 907      FD953EFF 
+ 907      FD963EFF 
+ 907      FD963EFF 
+ 907      FD96
+ 908 28ca 3EFFFD97 		.ascii	">\377\375\227>\377\375\227?\377\375\227?\377\375\230?\377\375"
+ 908      3EFFFD97 
+ 908      3FFFFD97 
+ 908      3FFFFD98 
+ 908      3FFFFD
+ 909 28dd 983FFFFD 		.ascii	"\230?\377\375\230?\377\375\230?\377\375\231?\377\375\231?\377"
+ 909      983FFFFD 
+ 909      983FFFFD 
+ 909      993FFFFD 
+ 909      993FFF
+ 910 28f0 FD993FFF 		.ascii	"\375\231?\377\375\232?\377\375\232@\377\375\232@\377\375\232"
+ 910      FD9A3FFF 
+ 910      FD9A40FF 
+ 910      FD9A40FF 
+ 910      FD9A
+ 911 2902 40FFFD9B 		.ascii	"@\377\375\233@\377\375\233@\377\375\233@\377\375\234@\377\375"
+ 911      40FFFD9B 
+ 911      40FFFD9B 
+ 911      40FFFD9C 
+ 911      40FFFD
+ 912 2915 9C40FFFD 		.ascii	"\234@\377\375\234A\377\375\234A\377\375\235A\377\375\235A\377"
+ 912      9C41FFFD 
+ 912      9C41FFFD 
+ 912      9D41FFFD 
+ 912      9D41FF
+ 913 2928 FD9D41FF 		.ascii	"\375\235A\377\375\236A\377\375\236A\377\375\236A\377\375\237"
+ 913      FD9E41FF 
+ 913      FD9E41FF 
+ 913      FD9E41FF 
+ 913      FD9F
+ 914 293a 41FFFD9F 		.ascii	"A\377\375\237B\377\375\237B\377\375\237B\377\375\240B\377\375"
+ 914      42FFFD9F 
+ 914      42FFFD9F 
+ 914      42FFFDA0 
+ 914      42FFFD
+ 915 294d A042FFFD 		.ascii	"\240B\377\375\240B\377\375\241B\377\375\241B\377\375\241C\377"
+ 915      A042FFFD 
+ 915      A142FFFD 
+GAS LISTING /tmp/ccPN994e.s 			page 50
+
+
+ 915      A142FFFD 
+ 915      A143FF
+ 916 2960 FDA143FF 		.ascii	"\375\241C\377\375\242C\377\375\242C\377\375\242C\377\375\243"
+ 916      FDA243FF 
+ 916      FDA243FF 
+ 916      FDA243FF 
+ 916      FDA3
+ 917 2972 43FFFDA3 		.ascii	"C\377\375\243C\377\375\243D\377\375\243D\377\375\244D\377\375"
+ 917      43FFFDA3 
+ 917      44FFFDA3 
+ 917      44FFFDA4 
+ 917      44FFFD
+ 918 2985 A444FFFD 		.ascii	"\244D\377\375\244D\377\375\245D\377\375\245D\377\375\245E\377"
+ 918      A444FFFD 
+ 918      A544FFFD 
+ 918      A544FFFD 
+ 918      A545FF
+ 919 2998 FDA545FF 		.ascii	"\375\245E\377\375\246E\377\375\246E\377\375\246E\377\375\247"
+ 919      FDA645FF 
+ 919      FDA645FF 
+ 919      FDA645FF 
+ 919      FDA7
+ 920 29aa 45FFFDA7 		.ascii	"E\377\375\247E\377\375\247F\377\375\247F\377\375\250F\377\375"
+ 920      45FFFDA7 
+ 920      46FFFDA7 
+ 920      46FFFDA8 
+ 920      46FFFD
+ 921 29bd A846FFFD 		.ascii	"\250F\377\375\250F\377\375\251F\377\375\251F\377\375\251G\377"
+ 921      A846FFFD 
+ 921      A946FFFD 
+ 921      A946FFFD 
+ 921      A947FF
+ 922 29d0 FDA947FF 		.ascii	"\375\251G\377\375\252G\377\375\252G\377\375\252G\377\375\253"
+ 922      FDAA47FF 
+ 922      FDAA47FF 
+ 922      FDAA47FF 
+ 922      FDAB
+ 923 29e2 47FFFDAB 		.ascii	"G\377\375\253H\377\375\253H\377\375\253H\377\375\254H\377\375"
+ 923      48FFFDAB 
+ 923      48FFFDAB 
+ 923      48FFFDAC 
+ 923      48FFFD
+ 924 29f5 AC48FFFD 		.ascii	"\254H\377\375\254H\377\375\254H\377\375\255I\377\375\255I\377"
+ 924      AC48FFFD 
+ 924      AC48FFFD 
+ 924      AD49FFFD 
+ 924      AD49FF
+ 925 2a08 FDAD49FF 		.ascii	"\375\255I\377\375\256I\377\375\256I\377\376\256I\377\376\256"
+ 925      FDAE49FF 
+ 925      FDAE49FF 
+ 925      FEAE49FF 
+ 925      FEAE
+ 926 2a1a 4AFFFEAF 		.ascii	"J\377\376\257J\377\376\257J\377\376\257J\377\376\260J\377\376"
+ 926      4AFFFEAF 
+ 926      4AFFFEAF 
+ 926      4AFFFEB0 
+ 926      4AFFFE
+GAS LISTING /tmp/ccPN994e.s 			page 51
+
+
+ 927 2a2d B04AFFFE 		.ascii	"\260J\377\376\260K\377\376\260K\377\376\261K\377\376\261K\377"
+ 927      B04BFFFE 
+ 927      B04BFFFE 
+ 927      B14BFFFE 
+ 927      B14BFF
+ 928 2a40 FEB14BFF 		.ascii	"\376\261K\377\375\262K\377\375\262L\377\375\262L\377\375\262"
+ 928      FDB24BFF 
+ 928      FDB24CFF 
+ 928      FDB24CFF 
+ 928      FDB2
+ 929 2a52 4CFFFDB3 		.ascii	"L\377\375\263M\377\375\263M\377\375\263M\377\375\264M\377\375"
+ 929      4DFFFDB3 
+ 929      4DFFFDB3 
+ 929      4DFFFDB4 
+ 929      4DFFFD
+ 930 2a65 B44EFFFD 		.ascii	"\264N\377\375\264N\377\375\265N\377\375\265O\377\375\265O\377"
+ 930      B44EFFFD 
+ 930      B54EFFFD 
+ 930      B54FFFFD 
+ 930      B54FFF
+ 931 2a78 FDB64FFF 		.ascii	"\375\266O\377\375\266P\377\375\266P\377\375\267P\377\375\267"
+ 931      FDB650FF 
+ 931      FDB650FF 
+ 931      FDB750FF 
+ 931      FDB7
+ 932 2a8a 50FFFDB7 		.ascii	"P\377\375\267Q\377\375\270Q\377\375\270Q\377\375\270R\377\375"
+ 932      51FFFDB8 
+ 932      51FFFDB8 
+ 932      51FFFDB8 
+ 932      52FFFD
+ 933 2a9d B852FFFD 		.ascii	"\270R\377\375\271R\377\375\271R\377\375\271S\377\375\272S\377"
+ 933      B952FFFD 
+ 933      B952FFFD 
+ 933      B953FFFD 
+ 933      BA53FF
+ 934 2ab0 FDBA53FF 		.ascii	"\375\272S\377\375\272T\377\375\273T\377\375\273T\377\375\273"
+ 934      FDBA54FF 
+ 934      FDBB54FF 
+ 934      FDBB54FF 
+ 934      FDBB
+ 935 2ac2 55FFFDBC 		.ascii	"U\377\375\274U\377\375\274U\377\375\274V\377\375\275V\377\375"
+ 935      55FFFDBC 
+ 935      55FFFDBC 
+ 935      56FFFDBD 
+ 935      56FFFD
+ 936 2ad5 BD56FFFD 		.ascii	"\275V\377\375\275V\377\375\276W\377\375\276W\377\375\276W\377"
+ 936      BD56FFFD 
+ 936      BE57FFFD 
+ 936      BE57FFFD 
+ 936      BE57FF
+ 937 2ae8 FDBE58FF 		.ascii	"\375\276X\377\375\277X\377\375\277X\377\375\277Y\377\375\300"
+ 937      FDBF58FF 
+ 937      FDBF58FF 
+ 937      FDBF59FF 
+ 937      FDC0
+ 938 2afa 59FFFDC0 		.ascii	"Y\377\375\300Y\377\375\300Z\377\375\301Z\377\375\301Z\377\375"
+ 938      59FFFDC0 
+GAS LISTING /tmp/ccPN994e.s 			page 52
+
+
+ 938      5AFFFDC1 
+ 938      5AFFFDC1 
+ 938      5AFFFD
+ 939 2b0d C15BFFFD 		.ascii	"\301[\377\375\302[\377\375\302[\377\375\302\\\377\375\302\\\377"
+ 939      C25BFFFD 
+ 939      C25BFFFD 
+ 939      C25CFFFD 
+ 939      C25CFF
+ 940 2b20 FDC35CFF 		.ascii	"\375\303\\\377\375\303]\377\375\303]\377\375\304]\377\375\304"
+ 940      FDC35DFF 
+ 940      FDC35DFF 
+ 940      FDC45DFF 
+ 940      FDC4
+ 941 2b32 5DFFFDC4 		.ascii	"]\377\375\304^\377\375\305^\377\375\305^\377\375\305_\377\375"
+ 941      5EFFFDC5 
+ 941      5EFFFDC5 
+ 941      5EFFFDC5 
+ 941      5FFFFD
+ 942 2b45 C55FFFFD 		.ascii	"\305_\377\375\306_\377\375\306`\377\375\306`\377\375\307`\377"
+ 942      C65FFFFD 
+ 942      C660FFFD 
+ 942      C660FFFD 
+ 942      C760FF
+ 943 2b58 FDC761FF 		.ascii	"\375\307a\377\375\307a\377\375\310a\377\375\310b\377\375\310"
+ 943      FDC761FF 
+ 943      FDC861FF 
+ 943      FDC862FF 
+ 943      FDC8
+ 944 2b6a 62FFFDC9 		.ascii	"b\377\375\311b\377\375\311c\377\375\311c\377\375\311c\377\375"
+ 944      62FFFDC9 
+ 944      63FFFDC9 
+ 944      63FFFDC9 
+ 944      63FFFD
+ 945 2b7d CA64FFFD 		.ascii	"\312d\377\375\312d\377\375\312d\377\375\313e\377\375\313e\377"
+ 945      CA64FFFD 
+ 945      CA64FFFD 
+ 945      CB65FFFD 
+ 945      CB65FF
+ 946 2b90 FDCB66FF 		.ascii	"\375\313f\377\375\314f\377\375\314f\377\375\314g\377\375\314"
+ 946      FDCC66FF 
+ 946      FDCC66FF 
+ 946      FDCC67FF 
+ 946      FDCC
+ 947 2ba2 67FFFDCD 		.ascii	"g\377\375\315g\377\375\315h\377\375\315h\377\375\316h\377\375"
+ 947      67FFFDCD 
+ 947      68FFFDCD 
+ 947      68FFFDCE 
+ 947      68FFFD
+ 948 2bb5 CE69FFFD 		.ascii	"\316i\377\375\316i\377\375\317i\377\375\317j\377\375\317j\377"
+ 948      CE69FFFD 
+ 948      CF69FFFD 
+ 948      CF6AFFFD 
+ 948      CF6AFF
+ 949 2bc8 FDCF6AFF 		.ascii	"\375\317j\377\375\320k\377\375\320k\377\375\320k\377\375\321"
+ 949      FDD06BFF 
+ 949      FDD06BFF 
+ 949      FDD06BFF 
+GAS LISTING /tmp/ccPN994e.s 			page 53
+
+
+ 949      FDD1
+ 950 2bda 6CFFFDD1 		.ascii	"l\377\375\321l\377\375\321l\377\375\321m\377\375\322m\377\375"
+ 950      6CFFFDD1 
+ 950      6CFFFDD1 
+ 950      6DFFFDD2 
+ 950      6DFFFD
+ 951 2bed D26EFFFD 		.ascii	"\322n\377\375\322n\377\375\323n\377\375\323o\377\375\323o\377"
+ 951      D26EFFFD 
+ 951      D36EFFFD 
+ 951      D36FFFFD 
+ 951      D36FFF
+ 952 2c00 FDD46FFF 		.ascii	"\375\324o\377\375\324p\377\375\324p\377\375\324p\377\375\325"
+ 952      FDD470FF 
+ 952      FDD470FF 
+ 952      FDD470FF 
+ 952      FDD5
+ 953 2c12 71FFFDD5 		.ascii	"q\377\375\325q\377\375\325q\377\375\326r\377\375\326r\377\375"
+ 953      71FFFDD5 
+ 953      71FFFDD6 
+ 953      72FFFDD6 
+ 953      72FFFD
+ 954 2c25 D673FFFD 		.ascii	"\326s\377\375\326s\377\375\327s\377\375\327t\377\375\327t\377"
+ 954      D673FFFD 
+ 954      D773FFFD 
+ 954      D774FFFD 
+ 954      D774FF
+ 955 2c38 FDD874FF 		.ascii	"\375\330t\377\375\330u\377\375\330u\377\375\331u\377\375\331"
+ 955      FDD875FF 
+ 955      FDD875FF 
+ 955      FDD975FF 
+ 955      FDD9
+ 956 2c4a 76FFFDD9 		.ascii	"v\377\375\331v\377\375\331v\377\375\331w\377\375\331w\377\375"
+ 956      76FFFDD9 
+ 956      76FFFDD9 
+ 956      77FFFDD9 
+ 956      77FFFD
+ 957 2c5d D977FFFD 		.ascii	"\331w\377\375\332x\377\375\332x\377\375\332x\377\375\332y\377"
+ 957      DA78FFFD 
+ 957      DA78FFFD 
+ 957      DA78FFFD 
+ 957      DA79FF
+ 958 2c70 FDDA79FF 		.ascii	"\375\332y\377\375\332y\377\375\333z\377\375\333z\377\375\333"
+ 958      FDDA79FF 
+ 958      FDDB7AFF 
+ 958      FDDB7AFF 
+ 958      FDDB
+ 959 2c82 7AFFFDDB 		.ascii	"z\377\375\333{\377\375\333{\377\375\333{\377\375\334|\377\375"
+ 959      7BFFFDDB 
+ 959      7BFFFDDB 
+ 959      7BFFFDDC 
+ 959      7CFFFD
+ 960 2c95 DC7CFFFD 		.ascii	"\334|\377\375\334|\377\375\334}\377\375\334}\377\375\334}\377"
+ 960      DC7CFFFD 
+ 960      DC7DFFFD 
+ 960      DC7DFFFD 
+ 960      DC7DFF
+ 961 2ca8 FDDD7EFF 		.ascii	"\375\335~\377\375\335~\377\375\335~\377\375\335\177\377\375\335"
+GAS LISTING /tmp/ccPN994e.s 			page 54
+
+
+ 961      FDDD7EFF 
+ 961      FDDD7EFF 
+ 961      FDDD7FFF 
+ 961      FDDD
+ 962 2cba 7FFFFDDD 		.ascii	"\177\377\375\335\177\377\375\336\200\377\375\336\200\377\375"
+ 962      7FFFFDDE 
+ 962      80FFFDDE 
+ 962      80FFFD
+ 963 2cc9 DE80FFFD 		.ascii	"\336\200\377\375\336\201\377\375\336\201\377\375\336\201\377"
+ 963      DE81FFFD 
+ 963      DE81FFFD 
+ 963      DE81FF
+ 964 2cd8 FDDE82FF 		.ascii	"\375\336\202\377\375\337\202\377\375\337\202\377\375\337\203"
+ 964      FDDF82FF 
+ 964      FDDF82FF 
+ 964      FDDF83
+ 965 2ce7 FFFDDF83 		.ascii	"\377\375\337\203\377\375\337\203\377\376\337\204\377\376\340"
+ 965      FFFDDF83 
+ 965      FFFEDF84 
+ 965      FFFEE0
+ 966 2cf6 84FFFEE0 		.ascii	"\204\377\376\340\204\377\376\340\205\377\376\340\205\377\376"
+ 966      84FFFEE0 
+ 966      85FFFEE0 
+ 966      85FFFE
+ 967 2d05 E085FFFE 		.ascii	"\340\205\377\376\340\205\377\376\341\206\377\376\341\206\377"
+ 967      E085FFFE 
+ 967      E186FFFE 
+ 967      E186FF
+ 968 2d14 FEE186FF 		.ascii	"\376\341\206\377\376\341\207\377\376\341\207\377\376\341\207"
+ 968      FEE187FF 
+ 968      FEE187FF 
+ 968      FEE187
+ 969 2d23 FFFEE188 		.ascii	"\377\376\341\210\377\376\342\210\377\376\342\210\377\376\342"
+ 969      FFFEE288 
+ 969      FFFEE288 
+ 969      FFFEE2
+ 970 2d32 89FFFEE2 		.ascii	"\211\377\376\342\211\377\376\342\211\377\376\342\212\377\376"
+ 970      89FFFEE2 
+ 970      89FFFEE2 
+ 970      8AFFFE
+ 971 2d41 E38AFFFE 		.ascii	"\343\212\377\376\343\212\377\376\343\213\377\376\343\213\377"
+ 971      E38AFFFE 
+ 971      E38BFFFE 
+ 971      E38BFF
+ 972 2d50 FEE38BFF 		.ascii	"\376\343\213\377\376\343\214\377\376\344\214\377\376\344\214"
+ 972      FEE38CFF 
+ 972      FEE48CFF 
+ 972      FEE48C
+ 973 2d5f FFFEE48D 		.ascii	"\377\376\344\215\377\376\344\215\377\376\344\215\377\376\344"
+ 973      FFFEE48D 
+ 973      FFFEE48D 
+ 973      FFFEE4
+ 974 2d6e 8EFFFEE4 		.ascii	"\216\377\376\344\216\377\376\345\216\377\376\345\217\377\376"
+ 974      8EFFFEE5 
+ 974      8EFFFEE5 
+ 974      8FFFFE
+ 975 2d7d E58FFFFE 		.ascii	"\345\217\377\376\345\217\377\376\345\220\377\376\345\220\377"
+GAS LISTING /tmp/ccPN994e.s 			page 55
+
+
+ 975      E58FFFFE 
+ 975      E590FFFE 
+ 975      E590FF
+ 976 2d8c FEE690FF 		.ascii	"\376\346\220\377\376\346\221\377\376\346\221\377\376\346\221"
+ 976      FEE691FF 
+ 976      FEE691FF 
+ 976      FEE691
+ 977 2d9b FFFEE692 		.ascii	"\377\376\346\222\377\376\346\222\377\376\346\222\377\376\347"
+ 977      FFFEE692 
+ 977      FFFEE692 
+ 977      FFFEE7
+ 978 2daa 93FFFEE7 		.ascii	"\223\377\376\347\223\377\376\347\223\377\376\347\224\377\376"
+ 978      93FFFEE7 
+ 978      93FFFEE7 
+ 978      94FFFE
+ 979 2db9 E794FFFE 		.ascii	"\347\224\377\376\347\224\377\376\350\225\377\376\350\225\377"
+ 979      E794FFFE 
+ 979      E895FFFE 
+ 979      E895FF
+ 980 2dc8 FEE895FF 		.ascii	"\376\350\225\377\376\350\226\377\376\350\226\377\376\350\226"
+ 980      FEE896FF 
+ 980      FEE896FF 
+ 980      FEE896
+ 981 2dd7 FFFEE897 		.ascii	"\377\376\350\227\377\376\351\227\377\376\351\227\377\376\351"
+ 981      FFFEE997 
+ 981      FFFEE997 
+ 981      FFFEE9
+ 982 2de6 98FFFEE9 		.ascii	"\230\377\376\351\230\377\376\351\230\377\376\351\231\377\376"
+ 982      98FFFEE9 
+ 982      98FFFEE9 
+ 982      99FFFE
+ 983 2df5 E999FFFE 		.ascii	"\351\231\377\376\352\231\377\376\352\232\377\376\352\232\377"
+ 983      EA99FFFE 
+ 983      EA9AFFFE 
+ 983      EA9AFF
+ 984 2e04 FEEA9AFF 		.ascii	"\376\352\232\377\376\352\233\377\376\352\233\377\376\353\233"
+ 984      FEEA9BFF 
+ 984      FEEA9BFF 
+ 984      FEEB9B
+ 985 2e13 FFFEEB9C 		.ascii	"\377\376\353\234\377\376\353\234\377\376\353\234\377\376\353"
+ 985      FFFEEB9C 
+ 985      FFFEEB9C 
+ 985      FFFEEB
+ 986 2e22 9DFFFEEB 		.ascii	"\235\377\376\353\235\377\376\353\235\377\376\354\236\377\376"
+ 986      9DFFFEEB 
+ 986      9DFFFEEC 
+ 986      9EFFFE
+ 987 2e31 EC9EFFFE 		.ascii	"\354\236\377\376\354\236\377\376\354\237\377\376\354\237\377"
+ 987      EC9EFFFE 
+ 987      EC9FFFFE 
+ 987      EC9FFF
+ 988 2e40 FEEC9FFF 		.ascii	"\376\354\237\377\376\355\237\377\376\355\240\377\376\355\240"
+ 988      FEED9FFF 
+ 988      FEEDA0FF 
+ 988      FEEDA0
+ 989 2e4f FFFEEDA1 		.ascii	"\377\376\355\241\377\376\355\241\377\376\355\241\377\376\355"
+ 989      FFFEEDA1 
+GAS LISTING /tmp/ccPN994e.s 			page 56
+
+
+ 989      FFFEEDA1 
+ 989      FFFEED
+ 990 2e5e A2FFFEEE 		.ascii	"\242\377\376\356\242\377\376\356\242\377\376\356\243\377\376"
+ 990      A2FFFEEE 
+ 990      A2FFFEEE 
+ 990      A3FFFE
+ 991 2e6d EEA3FFFE 		.ascii	"\356\243\377\376\356\243\377\376\356\244\377\376\356\244\377"
+ 991      EEA3FFFE 
+ 991      EEA4FFFE 
+ 991      EEA4FF
+ 992 2e7c FEEFA4FF 		.ascii	"\376\357\244\377\376\357\245\377\376\357\245\377\376\357\245"
+ 992      FEEFA5FF 
+ 992      FEEFA5FF 
+ 992      FEEFA5
+ 993 2e8b FFFEEFA6 		.ascii	"\377\376\357\246\377\376\357\246\377\376\360\246\377\376\360"
+ 993      FFFEEFA6 
+ 993      FFFEF0A6 
+ 993      FFFEF0
+ 994 2e9a A7FFFEF0 		.ascii	"\247\377\376\360\247\377\376\360\247\377\376\360\250\377\376"
+ 994      A7FFFEF0 
+ 994      A7FFFEF0 
+ 994      A8FFFE
+ 995 2ea9 F0A8FFFE 		.ascii	"\360\250\377\376\360\250\377\376\361\251\377\376\361\251\377"
+ 995      F0A8FFFE 
+ 995      F1A9FFFE 
+ 995      F1A9FF
+ 996 2eb8 FEF1A9FF 		.ascii	"\376\361\251\377\376\361\252\377\376\361\252\377\376\361\252"
+ 996      FEF1AAFF 
+ 996      FEF1AAFF 
+ 996      FEF1AA
+ 997 2ec7 FFFEF1AB 		.ascii	"\377\376\361\253\377\376\362\253\377\376\362\253\377\376\362"
+ 997      FFFEF2AB 
+ 997      FFFEF2AB 
+ 997      FFFEF2
+ 998 2ed6 ACFFFEF2 		.ascii	"\254\377\376\362\254\377\376\362\254\377\376\362\255\377\376"
+ 998      ACFFFEF2 
+ 998      ACFFFEF2 
+ 998      ADFFFE
+ 999 2ee5 F2ADFFFE 		.ascii	"\362\255\377\376\363\256\377\376\363\256\377\376\363\256\377"
+ 999      F3AEFFFE 
+ 999      F3AEFFFE 
+ 999      F3AEFF
+ 1000 2ef4 FEF3AFFF 		.ascii	"\376\363\257\377\376\363\257\377\376\363\257\377\376\363\260"
+ 1000      FEF3AFFF 
+ 1000      FEF3AFFF 
+ 1000      FEF3B0
+ 1001 2f03 FFFEF4B0 		.ascii	"\377\376\364\260\377\376\364\260\377\376\364\261\377\376\364"
+ 1001      FFFEF4B0 
+ 1001      FFFEF4B1 
+ 1001      FFFEF4
+ 1002 2f12 B1FFFEF4 		.ascii	"\261\377\376\364\261\377\376\364\262\377\376\364\262\377\376"
+ 1002      B1FFFEF4 
+ 1002      B2FFFEF4 
+ 1002      B2FFFE
+ 1003 2f21 F5B2FFFE 		.ascii	"\365\262\377\376\365\263\377\376\365\263\377\376\365\263\377"
+ 1003      F5B3FFFE 
+ 1003      F5B3FFFE 
+GAS LISTING /tmp/ccPN994e.s 			page 57
+
+
+ 1003      F5B3FF
+ 1004 2f30 FEF5B4FF 		.ascii	"\376\365\264\377\376\365\264\377\376\365\264\377\376\366\265"
+ 1004      FEF5B4FF 
+ 1004      FEF5B4FF 
+ 1004      FEF6B5
+ 1005 2f3f FFFEF6B5 		.ascii	"\377\376\366\265\377\376\366\265\377\376\366\266\377\376\366"
+ 1005      FFFEF6B5 
+ 1005      FFFEF6B6 
+ 1005      FFFEF6
+ 1006 2f4e B6FFFEF6 		.ascii	"\266\377\376\366\266\377\376\366\267\377\376\367\267\377\376"
+ 1006      B6FFFEF6 
+ 1006      B7FFFEF7 
+ 1006      B7FFFE
+ 1007 2f5d F7B8FFFE 		.ascii	"\367\270\377\376\367\270\377\376\367\270\377\376\367\271\377"
+ 1007      F7B8FFFE 
+ 1007      F7B8FFFE 
+ 1007      F7B9FF
+ 1008 2f6c FEF7B9FF 		.ascii	"\376\367\271\377\376\367\271\377\376\370\272\377\376\370\272"
+ 1008      FEF7B9FF 
+ 1008      FEF8BAFF 
+ 1008      FEF8BA
+ 1009 2f7b FFFEF8BA 		.ascii	"\377\376\370\272\377\376\370\273\377\376\370\273\377\376\370"
+ 1009      FFFEF8BB 
+ 1009      FFFEF8BB 
+ 1009      FFFEF8
+ 1010 2f8a BBFFFEF8 		.ascii	"\273\377\376\370\274\377\376\371\274\377\376\371\274\377\376"
+ 1010      BCFFFEF9 
+ 1010      BCFFFEF9 
+ 1010      BCFFFE
+ 1011 2f99 F9BDFFFE 		.ascii	"\371\275\377\376\371\275\377\376\371\275\377\376\371\276\377"
+ 1011      F9BDFFFE 
+ 1011      F9BDFFFE 
+ 1011      F9BEFF
+ 1012 2fa8 FEF9BEFF 		.ascii	"\376\371\276\377\376\371\276\377\376\372\277\377\376\372\277"
+ 1012      FEF9BEFF 
+ 1012      FEFABFFF 
+ 1012      FEFABF
+ 1013 2fb7 FFFEFABF 		.ascii	"\377\376\372\277\377\376\372\300\377\376\372\300\377\376\372"
+ 1013      FFFEFAC0 
+ 1013      FFFEFAC0 
+ 1013      FFFEFA
+ 1014 2fc6 C0FFFEFA 		.ascii	"\300\377\376\372\301\377\376\373\301\377\376\373\302\377\376"
+ 1014      C1FFFEFB 
+ 1014      C1FFFEFB 
+ 1014      C2FFFE
+ 1015 2fd5 FBC2FFFE 		.ascii	"\373\302\377\376\373\302\377\376\373\303\377"
+ 1015      FBC2FFFE 
+ 1015      FBC3FF
+ 1016 2fe0 FEFBC3FF 		.ascii	"\376\373\303\377\376\373\303\377\376\373\304\377\376\374\304"
+ 1016      FEFBC3FF 
+ 1016      FEFBC4FF 
+ 1016      FEFCC4
+ 1017 2fef FFFEFCC4 		.ascii	"\377\376\374\304\377\376\374\305\377\376\374\305\377\376\374"
+ 1017      FFFEFCC5 
+ 1017      FFFEFCC5 
+ 1017      FFFEFC
+ 1018 2ffe C5FFFEFC 		.ascii	"\305\377\376\374\306\377\376\374\306\377\376\375\306\377\376"
+GAS LISTING /tmp/ccPN994e.s 			page 58
+
+
+ 1018      C6FFFEFC 
+ 1018      C6FFFEFD 
+ 1018      C6FFFE
+ 1019 300d FDC7FFFE 		.ascii	"\375\307\377\376\375\307\377\376\375\307\377\376\375\310\377"
+ 1019      FDC7FFFE 
+ 1019      FDC7FFFE 
+ 1019      FDC8FF
+ 1020 301c FEFDC8FF 		.ascii	"\376\375\310\377\376\375\310\377\376\375\311\377\376\376\311"
+ 1020      FEFDC8FF 
+ 1020      FEFDC9FF 
+ 1020      FEFEC9
+ 1021 302b FFFEFEC9 		.ascii	"\377\376\376\311\377\376\376\312\377\376\376\312\377\376\376"
+ 1021      FFFEFECA 
+ 1021      FFFEFECA 
+ 1021      FFFEFE
+ 1022 303a CAFFFEFE 		.ascii	"\312\377\376\376\313\377\376\376\313\377"
+ 1022      CBFFFEFE 
+ 1022      CBFF
+ 1023              		.globl	heatmap_cs_YlOrRd_discrete
+ 1024              		.section	.data.rel.local
+ 1025              		.align 8
+ 1026              		.type	heatmap_cs_YlOrRd_discrete, @object
+ 1027              		.size	heatmap_cs_YlOrRd_discrete, 8
+ 1028              	heatmap_cs_YlOrRd_discrete:
+ 1029 0018 00000000 		.quad	discrete
+ 1029      00000000 
+ 1030              		.section	.data.rel.ro.local
+ 1031              		.align 16
+ 1032              		.type	discrete, @object
+ 1033              		.size	discrete, 16
+ 1034              	discrete:
+ 1035 0030 00000000 		.quad	discrete_data
+ 1035      00000000 
+ 1036 0038 0A000000 		.quad	10
+ 1036      00000000 
+ 1037              		.section	.rodata
+ 1038 3044 00000000 		.align 32
+ 1038      00000000 
+ 1038      00000000 
+ 1038      00000000 
+ 1038      00000000 
+ 1039              		.type	discrete_data, @object
+ 1040              		.size	discrete_data, 40
+ 1041              	discrete_data:
+ 1042 3060 00       		.string	""
+ 1043 3061 00       		.string	""
+ 1044 3062 00       		.string	""
+ 1045 3063 00       		.string	""
+ 1046 3064 8000     		.string	"\200"
+ 1047 3066 26FFBD00 		.string	"&\377\275"
+ 1048 306a 26FFE31A 		.ascii	"&\377\343\032\034\377\374N*\377\375\215<\377\376\262L\377\376"
+ 1048      1CFFFC4E 
+ 1048      2AFFFD8D 
+ 1048      3CFFFEB2 
+ 1048      4CFFFE
+ 1049 307d D976FFFF 		.ascii	"\331v\377\377\355\240\377\377\377\314\377"
+ 1049      EDA0FFFF 
+GAS LISTING /tmp/ccPN994e.s 			page 59
+
+
+ 1049      FFCCFF
+ 1050              		.text
+ 1051              	.Letext0:
+ 1052              		.file 1 "./heatmap.h"
+ 1053              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 1054              		.file 3 "./colorschemes/YlOrRd.h"
+ 1055              		.file 4 "colorschemes/YlOrRd.c"
+ 1056              		.section	.debug_info,"",@progbits
+ 1057              	.Ldebug_info0:
+ 1058 0000 E3010000 		.long	0x1e3
+ 1059 0004 0500     		.value	0x5
+ 1060 0006 01       		.byte	0x1
+ 1061 0007 08       		.byte	0x8
+ 1062 0008 00000000 		.long	.Ldebug_abbrev0
+ 1063 000c 0A       		.uleb128 0xa
+ 1064 000d 00000000 		.long	.LASF26
+ 1065 0011 1D       		.byte	0x1d
+ 1066 0012 00000000 		.long	.LASF0
+ 1067 0016 00000000 		.long	.LASF1
+ 1068 001a 00000000 		.long	.Ldebug_line0
+ 1069 001e 01       		.uleb128 0x1
+ 1070 001f 08       		.byte	0x8
+ 1071 0020 05       		.byte	0x5
+ 1072 0021 00000000 		.long	.LASF2
+ 1073 0025 06       		.uleb128 0x6
+ 1074 0026 00000000 		.long	.LASF12
+ 1075 002a 02       		.byte	0x2
+ 1076 002b D6       		.byte	0xd6
+ 1077 002c 17       		.byte	0x17
+ 1078 002d 31000000 		.long	0x31
+ 1079 0031 01       		.uleb128 0x1
+ 1080 0032 08       		.byte	0x8
+ 1081 0033 07       		.byte	0x7
+ 1082 0034 00000000 		.long	.LASF3
+ 1083 0038 0B       		.uleb128 0xb
+ 1084 0039 04       		.byte	0x4
+ 1085 003a 05       		.byte	0x5
+ 1086 003b 696E7400 		.string	"int"
+ 1087 003f 01       		.uleb128 0x1
+ 1088 0040 08       		.byte	0x8
+ 1089 0041 05       		.byte	0x5
+ 1090 0042 00000000 		.long	.LASF4
+ 1091 0046 01       		.uleb128 0x1
+ 1092 0047 10       		.byte	0x10
+ 1093 0048 04       		.byte	0x4
+ 1094 0049 00000000 		.long	.LASF5
+ 1095 004d 01       		.uleb128 0x1
+ 1096 004e 04       		.byte	0x4
+ 1097 004f 04       		.byte	0x4
+ 1098 0050 00000000 		.long	.LASF6
+ 1099 0054 01       		.uleb128 0x1
+ 1100 0055 04       		.byte	0x4
+ 1101 0056 07       		.byte	0x7
+ 1102 0057 00000000 		.long	.LASF7
+ 1103 005b 01       		.uleb128 0x1
+ 1104 005c 02       		.byte	0x2
+ 1105 005d 07       		.byte	0x7
+GAS LISTING /tmp/ccPN994e.s 			page 60
+
+
+ 1106 005e 00000000 		.long	.LASF8
+ 1107 0062 0C       		.uleb128 0xc
+ 1108 0063 10       		.byte	0x10
+ 1109 0064 01       		.byte	0x1
+ 1110 0065 BB       		.byte	0xbb
+ 1111 0066 09       		.byte	0x9
+ 1112 0067 84000000 		.long	0x84
+ 1113 006b 07       		.uleb128 0x7
+ 1114 006c 00000000 		.long	.LASF9
+ 1115 0070 BC       		.byte	0xbc
+ 1116 0071 1A       		.byte	0x1a
+ 1117 0072 84000000 		.long	0x84
+ 1118 0076 00       		.byte	0
+ 1119 0077 07       		.uleb128 0x7
+ 1120 0078 00000000 		.long	.LASF10
+ 1121 007c BD       		.byte	0xbd
+ 1122 007d 0C       		.byte	0xc
+ 1123 007e 25000000 		.long	0x25
+ 1124 0082 08       		.byte	0x8
+ 1125 0083 00       		.byte	0
+ 1126 0084 08       		.uleb128 0x8
+ 1127 0085 90000000 		.long	0x90
+ 1128 0089 01       		.uleb128 0x1
+ 1129 008a 01       		.byte	0x1
+ 1130 008b 08       		.byte	0x8
+ 1131 008c 00000000 		.long	.LASF11
+ 1132 0090 03       		.uleb128 0x3
+ 1133 0091 89000000 		.long	0x89
+ 1134 0095 06       		.uleb128 0x6
+ 1135 0096 00000000 		.long	.LASF13
+ 1136 009a 01       		.byte	0x1
+ 1137 009b BE       		.byte	0xbe
+ 1138 009c 03       		.byte	0x3
+ 1139 009d 62000000 		.long	0x62
+ 1140 00a1 03       		.uleb128 0x3
+ 1141 00a2 95000000 		.long	0x95
+ 1142 00a6 08       		.uleb128 0x8
+ 1143 00a7 A1000000 		.long	0xa1
+ 1144 00ab 04       		.uleb128 0x4
+ 1145 00ac 00000000 		.long	.LASF14
+ 1146 00b0 21       		.byte	0x21
+ 1147 00b1 A6000000 		.long	0xa6
+ 1148 00b5 04       		.uleb128 0x4
+ 1149 00b6 00000000 		.long	.LASF15
+ 1150 00ba 23       		.byte	0x23
+ 1151 00bb A6000000 		.long	0xa6
+ 1152 00bf 04       		.uleb128 0x4
+ 1153 00c0 00000000 		.long	.LASF16
+ 1154 00c4 25       		.byte	0x25
+ 1155 00c5 A6000000 		.long	0xa6
+ 1156 00c9 04       		.uleb128 0x4
+ 1157 00ca 00000000 		.long	.LASF17
+ 1158 00ce 28       		.byte	0x28
+ 1159 00cf A6000000 		.long	0xa6
+ 1160 00d3 09       		.uleb128 0x9
+ 1161 00d4 90000000 		.long	0x90
+ 1162 00d8 E3000000 		.long	0xe3
+GAS LISTING /tmp/ccPN994e.s 			page 61
+
+
+ 1163 00dc 0D       		.uleb128 0xd
+ 1164 00dd 31000000 		.long	0x31
+ 1165 00e1 27       		.byte	0x27
+ 1166 00e2 00       		.byte	0
+ 1167 00e3 03       		.uleb128 0x3
+ 1168 00e4 D3000000 		.long	0xd3
+ 1169 00e8 02       		.uleb128 0x2
+ 1170 00e9 00000000 		.long	.LASF18
+ 1171 00ed 20       		.byte	0x20
+ 1172 00ee 1C       		.byte	0x1c
+ 1173 00ef E3000000 		.long	0xe3
+ 1174 00f3 09       		.uleb128 0x9
+ 1175 00f4 03       		.byte	0x3
+ 1176 00f5 00000000 		.quad	discrete_data
+ 1176      00000000 
+ 1177 00fd 02       		.uleb128 0x2
+ 1178 00fe 00000000 		.long	.LASF19
+ 1179 0102 23       		.byte	0x23
+ 1180 0103 24       		.byte	0x24
+ 1181 0104 A1000000 		.long	0xa1
+ 1182 0108 09       		.uleb128 0x9
+ 1183 0109 03       		.byte	0x3
+ 1184 010a 00000000 		.quad	discrete
+ 1184      00000000 
+ 1185 0112 05       		.uleb128 0x5
+ 1186 0113 AB000000 		.long	0xab
+ 1187 0117 24       		.byte	0x24
+ 1188 0118 09       		.uleb128 0x9
+ 1189 0119 03       		.byte	0x3
+ 1190 011a 00000000 		.quad	heatmap_cs_YlOrRd_discrete
+ 1190      00000000 
+ 1191 0122 09       		.uleb128 0x9
+ 1192 0123 90000000 		.long	0x90
+ 1193 0127 33010000 		.long	0x133
+ 1194 012b 0E       		.uleb128 0xe
+ 1195 012c 31000000 		.long	0x31
+ 1196 0130 0310     		.value	0x1003
+ 1197 0132 00       		.byte	0
+ 1198 0133 03       		.uleb128 0x3
+ 1199 0134 22010000 		.long	0x122
+ 1200 0138 02       		.uleb128 0x2
+ 1201 0139 00000000 		.long	.LASF20
+ 1202 013d 26       		.byte	0x26
+ 1203 013e 1C       		.byte	0x1c
+ 1204 013f 33010000 		.long	0x133
+ 1205 0143 09       		.uleb128 0x9
+ 1206 0144 03       		.byte	0x3
+ 1207 0145 00000000 		.quad	soft_data
+ 1207      00000000 
+ 1208 014d 02       		.uleb128 0x2
+ 1209 014e 00000000 		.long	.LASF21
+ 1210 0152 29       		.byte	0x29
+ 1211 0153 24       		.byte	0x24
+ 1212 0154 A1000000 		.long	0xa1
+ 1213 0158 09       		.uleb128 0x9
+ 1214 0159 03       		.byte	0x3
+ 1215 015a 00000000 		.quad	soft
+GAS LISTING /tmp/ccPN994e.s 			page 62
+
+
+ 1215      00000000 
+ 1216 0162 05       		.uleb128 0x5
+ 1217 0163 B5000000 		.long	0xb5
+ 1218 0167 2A       		.byte	0x2a
+ 1219 0168 09       		.uleb128 0x9
+ 1220 0169 03       		.byte	0x3
+ 1221 016a 00000000 		.quad	heatmap_cs_YlOrRd_soft
+ 1221      00000000 
+ 1222 0172 02       		.uleb128 0x2
+ 1223 0173 00000000 		.long	.LASF22
+ 1224 0177 2C       		.byte	0x2c
+ 1225 0178 1C       		.byte	0x1c
+ 1226 0179 33010000 		.long	0x133
+ 1227 017d 09       		.uleb128 0x9
+ 1228 017e 03       		.byte	0x3
+ 1229 017f 00000000 		.quad	mixed_data
+ 1229      00000000 
+ 1230 0187 02       		.uleb128 0x2
+ 1231 0188 00000000 		.long	.LASF23
+ 1232 018c 2F       		.byte	0x2f
+ 1233 018d 24       		.byte	0x24
+ 1234 018e A1000000 		.long	0xa1
+ 1235 0192 09       		.uleb128 0x9
+ 1236 0193 03       		.byte	0x3
+ 1237 0194 00000000 		.quad	mixed
+ 1237      00000000 
+ 1238 019c 05       		.uleb128 0x5
+ 1239 019d BF000000 		.long	0xbf
+ 1240 01a1 30       		.byte	0x30
+ 1241 01a2 09       		.uleb128 0x9
+ 1242 01a3 03       		.byte	0x3
+ 1243 01a4 00000000 		.quad	heatmap_cs_YlOrRd_mixed
+ 1243      00000000 
+ 1244 01ac 02       		.uleb128 0x2
+ 1245 01ad 00000000 		.long	.LASF24
+ 1246 01b1 32       		.byte	0x32
+ 1247 01b2 1C       		.byte	0x1c
+ 1248 01b3 33010000 		.long	0x133
+ 1249 01b7 09       		.uleb128 0x9
+ 1250 01b8 03       		.byte	0x3
+ 1251 01b9 00000000 		.quad	mixed_exp_data
+ 1251      00000000 
+ 1252 01c1 02       		.uleb128 0x2
+ 1253 01c2 00000000 		.long	.LASF25
+ 1254 01c6 35       		.byte	0x35
+ 1255 01c7 24       		.byte	0x24
+ 1256 01c8 A1000000 		.long	0xa1
+ 1257 01cc 09       		.uleb128 0x9
+ 1258 01cd 03       		.byte	0x3
+ 1259 01ce 00000000 		.quad	mixed_exp
+ 1259      00000000 
+ 1260 01d6 05       		.uleb128 0x5
+ 1261 01d7 C9000000 		.long	0xc9
+ 1262 01db 36       		.byte	0x36
+ 1263 01dc 09       		.uleb128 0x9
+ 1264 01dd 03       		.byte	0x3
+ 1265 01de 00000000 		.quad	heatmap_cs_YlOrRd_mixed_exp
+GAS LISTING /tmp/ccPN994e.s 			page 63
+
+
+ 1265      00000000 
+ 1266 01e6 00       		.byte	0
+ 1267              		.section	.debug_abbrev,"",@progbits
+ 1268              	.Ldebug_abbrev0:
+ 1269 0000 01       		.uleb128 0x1
+ 1270 0001 24       		.uleb128 0x24
+ 1271 0002 00       		.byte	0
+ 1272 0003 0B       		.uleb128 0xb
+ 1273 0004 0B       		.uleb128 0xb
+ 1274 0005 3E       		.uleb128 0x3e
+ 1275 0006 0B       		.uleb128 0xb
+ 1276 0007 03       		.uleb128 0x3
+ 1277 0008 0E       		.uleb128 0xe
+ 1278 0009 00       		.byte	0
+ 1279 000a 00       		.byte	0
+ 1280 000b 02       		.uleb128 0x2
+ 1281 000c 34       		.uleb128 0x34
+ 1282 000d 00       		.byte	0
+ 1283 000e 03       		.uleb128 0x3
+ 1284 000f 0E       		.uleb128 0xe
+ 1285 0010 3A       		.uleb128 0x3a
+ 1286 0011 21       		.uleb128 0x21
+ 1287 0012 04       		.sleb128 4
+ 1288 0013 3B       		.uleb128 0x3b
+ 1289 0014 0B       		.uleb128 0xb
+ 1290 0015 39       		.uleb128 0x39
+ 1291 0016 0B       		.uleb128 0xb
+ 1292 0017 49       		.uleb128 0x49
+ 1293 0018 13       		.uleb128 0x13
+ 1294 0019 02       		.uleb128 0x2
+ 1295 001a 18       		.uleb128 0x18
+ 1296 001b 00       		.byte	0
+ 1297 001c 00       		.byte	0
+ 1298 001d 03       		.uleb128 0x3
+ 1299 001e 26       		.uleb128 0x26
+ 1300 001f 00       		.byte	0
+ 1301 0020 49       		.uleb128 0x49
+ 1302 0021 13       		.uleb128 0x13
+ 1303 0022 00       		.byte	0
+ 1304 0023 00       		.byte	0
+ 1305 0024 04       		.uleb128 0x4
+ 1306 0025 34       		.uleb128 0x34
+ 1307 0026 00       		.byte	0
+ 1308 0027 03       		.uleb128 0x3
+ 1309 0028 0E       		.uleb128 0xe
+ 1310 0029 3A       		.uleb128 0x3a
+ 1311 002a 21       		.uleb128 0x21
+ 1312 002b 03       		.sleb128 3
+ 1313 002c 3B       		.uleb128 0x3b
+ 1314 002d 0B       		.uleb128 0xb
+ 1315 002e 39       		.uleb128 0x39
+ 1316 002f 21       		.uleb128 0x21
+ 1317 0030 25       		.sleb128 37
+ 1318 0031 49       		.uleb128 0x49
+ 1319 0032 13       		.uleb128 0x13
+ 1320 0033 3F       		.uleb128 0x3f
+ 1321 0034 19       		.uleb128 0x19
+GAS LISTING /tmp/ccPN994e.s 			page 64
+
+
+ 1322 0035 3C       		.uleb128 0x3c
+ 1323 0036 19       		.uleb128 0x19
+ 1324 0037 00       		.byte	0
+ 1325 0038 00       		.byte	0
+ 1326 0039 05       		.uleb128 0x5
+ 1327 003a 34       		.uleb128 0x34
+ 1328 003b 00       		.byte	0
+ 1329 003c 47       		.uleb128 0x47
+ 1330 003d 13       		.uleb128 0x13
+ 1331 003e 3A       		.uleb128 0x3a
+ 1332 003f 21       		.uleb128 0x21
+ 1333 0040 04       		.sleb128 4
+ 1334 0041 3B       		.uleb128 0x3b
+ 1335 0042 0B       		.uleb128 0xb
+ 1336 0043 39       		.uleb128 0x39
+ 1337 0044 21       		.uleb128 0x21
+ 1338 0045 1E       		.sleb128 30
+ 1339 0046 02       		.uleb128 0x2
+ 1340 0047 18       		.uleb128 0x18
+ 1341 0048 00       		.byte	0
+ 1342 0049 00       		.byte	0
+ 1343 004a 06       		.uleb128 0x6
+ 1344 004b 16       		.uleb128 0x16
+ 1345 004c 00       		.byte	0
+ 1346 004d 03       		.uleb128 0x3
+ 1347 004e 0E       		.uleb128 0xe
+ 1348 004f 3A       		.uleb128 0x3a
+ 1349 0050 0B       		.uleb128 0xb
+ 1350 0051 3B       		.uleb128 0x3b
+ 1351 0052 0B       		.uleb128 0xb
+ 1352 0053 39       		.uleb128 0x39
+ 1353 0054 0B       		.uleb128 0xb
+ 1354 0055 49       		.uleb128 0x49
+ 1355 0056 13       		.uleb128 0x13
+ 1356 0057 00       		.byte	0
+ 1357 0058 00       		.byte	0
+ 1358 0059 07       		.uleb128 0x7
+ 1359 005a 0D       		.uleb128 0xd
+ 1360 005b 00       		.byte	0
+ 1361 005c 03       		.uleb128 0x3
+ 1362 005d 0E       		.uleb128 0xe
+ 1363 005e 3A       		.uleb128 0x3a
+ 1364 005f 21       		.uleb128 0x21
+ 1365 0060 01       		.sleb128 1
+ 1366 0061 3B       		.uleb128 0x3b
+ 1367 0062 0B       		.uleb128 0xb
+ 1368 0063 39       		.uleb128 0x39
+ 1369 0064 0B       		.uleb128 0xb
+ 1370 0065 49       		.uleb128 0x49
+ 1371 0066 13       		.uleb128 0x13
+ 1372 0067 38       		.uleb128 0x38
+ 1373 0068 0B       		.uleb128 0xb
+ 1374 0069 00       		.byte	0
+ 1375 006a 00       		.byte	0
+ 1376 006b 08       		.uleb128 0x8
+ 1377 006c 0F       		.uleb128 0xf
+ 1378 006d 00       		.byte	0
+GAS LISTING /tmp/ccPN994e.s 			page 65
+
+
+ 1379 006e 0B       		.uleb128 0xb
+ 1380 006f 21       		.uleb128 0x21
+ 1381 0070 08       		.sleb128 8
+ 1382 0071 49       		.uleb128 0x49
+ 1383 0072 13       		.uleb128 0x13
+ 1384 0073 00       		.byte	0
+ 1385 0074 00       		.byte	0
+ 1386 0075 09       		.uleb128 0x9
+ 1387 0076 01       		.uleb128 0x1
+ 1388 0077 01       		.byte	0x1
+ 1389 0078 49       		.uleb128 0x49
+ 1390 0079 13       		.uleb128 0x13
+ 1391 007a 01       		.uleb128 0x1
+ 1392 007b 13       		.uleb128 0x13
+ 1393 007c 00       		.byte	0
+ 1394 007d 00       		.byte	0
+ 1395 007e 0A       		.uleb128 0xa
+ 1396 007f 11       		.uleb128 0x11
+ 1397 0080 01       		.byte	0x1
+ 1398 0081 25       		.uleb128 0x25
+ 1399 0082 0E       		.uleb128 0xe
+ 1400 0083 13       		.uleb128 0x13
+ 1401 0084 0B       		.uleb128 0xb
+ 1402 0085 03       		.uleb128 0x3
+ 1403 0086 1F       		.uleb128 0x1f
+ 1404 0087 1B       		.uleb128 0x1b
+ 1405 0088 1F       		.uleb128 0x1f
+ 1406 0089 10       		.uleb128 0x10
+ 1407 008a 17       		.uleb128 0x17
+ 1408 008b 00       		.byte	0
+ 1409 008c 00       		.byte	0
+ 1410 008d 0B       		.uleb128 0xb
+ 1411 008e 24       		.uleb128 0x24
+ 1412 008f 00       		.byte	0
+ 1413 0090 0B       		.uleb128 0xb
+ 1414 0091 0B       		.uleb128 0xb
+ 1415 0092 3E       		.uleb128 0x3e
+ 1416 0093 0B       		.uleb128 0xb
+ 1417 0094 03       		.uleb128 0x3
+ 1418 0095 08       		.uleb128 0x8
+ 1419 0096 00       		.byte	0
+ 1420 0097 00       		.byte	0
+ 1421 0098 0C       		.uleb128 0xc
+ 1422 0099 13       		.uleb128 0x13
+ 1423 009a 01       		.byte	0x1
+ 1424 009b 0B       		.uleb128 0xb
+ 1425 009c 0B       		.uleb128 0xb
+ 1426 009d 3A       		.uleb128 0x3a
+ 1427 009e 0B       		.uleb128 0xb
+ 1428 009f 3B       		.uleb128 0x3b
+ 1429 00a0 0B       		.uleb128 0xb
+ 1430 00a1 39       		.uleb128 0x39
+ 1431 00a2 0B       		.uleb128 0xb
+ 1432 00a3 01       		.uleb128 0x1
+ 1433 00a4 13       		.uleb128 0x13
+ 1434 00a5 00       		.byte	0
+ 1435 00a6 00       		.byte	0
+GAS LISTING /tmp/ccPN994e.s 			page 66
+
+
+ 1436 00a7 0D       		.uleb128 0xd
+ 1437 00a8 21       		.uleb128 0x21
+ 1438 00a9 00       		.byte	0
+ 1439 00aa 49       		.uleb128 0x49
+ 1440 00ab 13       		.uleb128 0x13
+ 1441 00ac 2F       		.uleb128 0x2f
+ 1442 00ad 0B       		.uleb128 0xb
+ 1443 00ae 00       		.byte	0
+ 1444 00af 00       		.byte	0
+ 1445 00b0 0E       		.uleb128 0xe
+ 1446 00b1 21       		.uleb128 0x21
+ 1447 00b2 00       		.byte	0
+ 1448 00b3 49       		.uleb128 0x49
+ 1449 00b4 13       		.uleb128 0x13
+ 1450 00b5 2F       		.uleb128 0x2f
+ 1451 00b6 05       		.uleb128 0x5
+ 1452 00b7 00       		.byte	0
+ 1453 00b8 00       		.byte	0
+ 1454 00b9 00       		.byte	0
+ 1455              		.section	.debug_aranges,"",@progbits
+ 1456 0000 1C000000 		.long	0x1c
+ 1457 0004 0200     		.value	0x2
+ 1458 0006 00000000 		.long	.Ldebug_info0
+ 1459 000a 08       		.byte	0x8
+ 1460 000b 00       		.byte	0
+ 1461 000c 0000     		.value	0
+ 1462 000e 0000     		.value	0
+ 1463 0010 00000000 		.quad	0
+ 1463      00000000 
+ 1464 0018 00000000 		.quad	0
+ 1464      00000000 
+ 1465              		.section	.debug_line,"",@progbits
+ 1466              	.Ldebug_line0:
+ 1467 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 1467      05000800 
+ 1467      49000000 
+ 1467      010101FB 
+ 1467      0E0D0001 
+ 1468              	.LASF20:
+ 1469 0000 736F6674 		.string	"soft_data"
+ 1469      5F646174 
+ 1469      6100
+ 1470              	.LASF12:
+ 1471 000a 73697A65 		.string	"size_t"
+ 1471      5F7400
+ 1472              	.LASF13:
+ 1473 0011 68656174 		.string	"heatmap_colorscheme_t"
+ 1473      6D61705F 
+ 1473      636F6C6F 
+ 1473      72736368 
+ 1473      656D655F 
+ 1474              	.LASF17:
+ 1475 0027 68656174 		.string	"heatmap_cs_YlOrRd_mixed_exp"
+ 1475      6D61705F 
+ 1475      63735F59 
+ 1475      6C4F7252 
+ 1475      645F6D69 
+GAS LISTING /tmp/ccPN994e.s 			page 67
+
+
+ 1476              	.LASF15:
+ 1477 0043 68656174 		.string	"heatmap_cs_YlOrRd_soft"
+ 1477      6D61705F 
+ 1477      63735F59 
+ 1477      6C4F7252 
+ 1477      645F736F 
+ 1478              	.LASF14:
+ 1479 005a 68656174 		.string	"heatmap_cs_YlOrRd_discrete"
+ 1479      6D61705F 
+ 1479      63735F59 
+ 1479      6C4F7252 
+ 1479      645F6469 
+ 1480              	.LASF26:
+ 1481 0075 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 1481      43313720 
+ 1481      31322E32 
+ 1481      2E30202D 
+ 1481      6D74756E 
+ 1482              	.LASF6:
+ 1483 00d4 666C6F61 		.string	"float"
+ 1483      7400
+ 1484              	.LASF11:
+ 1485 00da 756E7369 		.string	"unsigned char"
+ 1485      676E6564 
+ 1485      20636861 
+ 1485      7200
+ 1486              	.LASF3:
+ 1487 00e8 6C6F6E67 		.string	"long unsigned int"
+ 1487      20756E73 
+ 1487      69676E65 
+ 1487      6420696E 
+ 1487      7400
+ 1488              	.LASF8:
+ 1489 00fa 73686F72 		.string	"short unsigned int"
+ 1489      7420756E 
+ 1489      7369676E 
+ 1489      65642069 
+ 1489      6E7400
+ 1490              	.LASF25:
+ 1491 010d 6D697865 		.string	"mixed_exp"
+ 1491      645F6578 
+ 1491      7000
+ 1492              	.LASF23:
+ 1493 0117 6D697865 		.string	"mixed"
+ 1493      6400
+ 1494              	.LASF16:
+ 1495 011d 68656174 		.string	"heatmap_cs_YlOrRd_mixed"
+ 1495      6D61705F 
+ 1495      63735F59 
+ 1495      6C4F7252 
+ 1495      645F6D69 
+ 1496              	.LASF7:
+ 1497 0135 756E7369 		.string	"unsigned int"
+ 1497      676E6564 
+ 1497      20696E74 
+ 1497      00
+ 1498              	.LASF19:
+GAS LISTING /tmp/ccPN994e.s 			page 68
+
+
+ 1499 0142 64697363 		.string	"discrete"
+ 1499      72657465 
+ 1499      00
+ 1500              	.LASF10:
+ 1501 014b 6E636F6C 		.string	"ncolors"
+ 1501      6F727300 
+ 1502              	.LASF4:
+ 1503 0153 6C6F6E67 		.string	"long long int"
+ 1503      206C6F6E 
+ 1503      6720696E 
+ 1503      7400
+ 1504              	.LASF24:
+ 1505 0161 6D697865 		.string	"mixed_exp_data"
+ 1505      645F6578 
+ 1505      705F6461 
+ 1505      746100
+ 1506              	.LASF22:
+ 1507 0170 6D697865 		.string	"mixed_data"
+ 1507      645F6461 
+ 1507      746100
+ 1508              	.LASF2:
+ 1509 017b 6C6F6E67 		.string	"long int"
+ 1509      20696E74 
+ 1509      00
+ 1510              	.LASF5:
+ 1511 0184 6C6F6E67 		.string	"long double"
+ 1511      20646F75 
+ 1511      626C6500 
+ 1512              	.LASF18:
+ 1513 0190 64697363 		.string	"discrete_data"
+ 1513      72657465 
+ 1513      5F646174 
+ 1513      6100
+ 1514              	.LASF21:
+ 1515 019e 736F6674 		.string	"soft"
+ 1515      00
+ 1516              	.LASF9:
+ 1517 01a3 636F6C6F 		.string	"colors"
+ 1517      727300
+ 1518              		.section	.debug_line_str,"MS",@progbits,1
+ 1519              	.LASF1:
+ 1520 0000 2F726F6F 		.string	"/root/repo"
+ 1520      742F7265 
+ 1520      706F00
+ 1521              	.LASF0:
+ 1522 000b 636F6C6F 		.string	"colorschemes/YlOrRd.c"
+ 1522      72736368 
+ 1522      656D6573 
+ 1522      2F596C4F 
+ 1522      7252642E 
+ 1523              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+ 1524 0021 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 1524      742F7265 
+ 1524      706F0063 
+ 1524      6F6C6F72 
+ 1524      73636865 
@@ -0,0 +1,1568 @@
+GAS LISTING /tmp/ccUIsTvF.s 			page 1
+
+
+   1              		.file	"gray.c"
+   2              		.text
+   3              	.Ltext0:
+   4              		.file 0 "/root/repo" "colorschemes/gray.c"
+   5              		.globl	heatmap_cs_w2b_opaque
+   6              		.section	.data.rel.local,"aw"
+   7              		.align 8
+   8              		.type	heatmap_cs_w2b_opaque, @object
+   9              		.size	heatmap_cs_w2b_opaque, 8
+  10              	heatmap_cs_w2b_opaque:
+  11 0000 00000000 		.quad	w2b_o
+  11      00000000 
+  12              		.section	.data.rel.ro.local,"aw"
+  13              		.align 16
+  14              		.type	w2b_o, @object
+  15              		.size	w2b_o, 16
+  16              	w2b_o:
+  17 0000 00000000 		.quad	w2b_o_data
+  17      00000000 
+  18 0008 00010000 		.quad	256
+  18      00000000 
+  19              		.section	.rodata
+  20              		.align 32
+  21              		.type	w2b_o_data, @object
+  22              		.size	w2b_o_data, 1024
+  23              	w2b_o_data:
+  24 0000 FFFFFFFF 		.ascii	"\377\377\377\377\376\376\376\377\375\375\375\377\374\374\374"
+  24      FEFEFEFF 
+  24      FDFDFDFF 
+  24      FCFCFC
+  25 000f FFFBFBFB 		.ascii	"\377\373\373\373\377\372\372\372\377\371\371\371\377\370\370"
+  25      FFFAFAFA 
+  25      FFF9F9F9 
+  25      FFF8F8
+  26 001e F8FFF7F7 		.ascii	"\370\377\367\367\367\377\366\366\366\377\365\365\365\377\364"
+  26      F7FFF6F6 
+  26      F6FFF5F5 
+  26      F5FFF4
+  27 002d F4F4FFF3 		.ascii	"\364\364\377\363\363\363\377\362\362\362\377\361\361\361\377"
+  27      F3F3FFF2 
+  27      F2F2FFF1 
+  27      F1F1FF
+  28 003c F0F0F0FF 		.ascii	"\360\360\360\377\357\357\357\377\356\356\356\377\355\355\355"
+  28      EFEFEFFF 
+  28      EEEEEEFF 
+  28      EDEDED
+  29 004b FFECECEC 		.ascii	"\377\354\354\354\377\353\353\353\377\352\352\352\377\351\351"
+  29      FFEBEBEB 
+  29      FFEAEAEA 
+  29      FFE9E9
+  30 005a E9FFE8E8 		.ascii	"\351\377\350\350\350\377\347\347\347\377\346\346\346\377\345"
+  30      E8FFE7E7 
+  30      E7FFE6E6 
+  30      E6FFE5
+  31 0069 E5E5FFE4 		.ascii	"\345\345\377\344\344\344\377\343\343\343\377\342\342\342\377"
+  31      E4E4FFE3 
+  31      E3E3FFE2 
+GAS LISTING /tmp/ccUIsTvF.s 			page 2
+
+
+  31      E2E2FF
+  32 0078 E1E1E1FF 		.ascii	"\341\341\341\377\340\340\340\377\337\337\337\377\336\336\336"
+  32      E0E0E0FF 
+  32      DFDFDFFF 
+  32      DEDEDE
+  33 0087 FFDDDDDD 		.ascii	"\377\335\335\335\377\334\334\334\377\333\333\333\377\332\332"
+  33      FFDCDCDC 
+  33      FFDBDBDB 
+  33      FFDADA
+  34 0096 DAFFD9D9 		.ascii	"\332\377\331\331\331\377\330\330\330\377\327\327\327\377\326"
+  34      D9FFD8D8 
+  34      D8FFD7D7 
+  34      D7FFD6
+  35 00a5 D6D6FFD5 		.ascii	"\326\326\377\325\325\325\377\324\324\324\377\323\323\323\377"
+  35      D5D5FFD4 
+  35      D4D4FFD3 
+  35      D3D3FF
+  36 00b4 D2D2D2FF 		.ascii	"\322\322\322\377\321\321\321\377\320\320\320\377\317\317\317"
+  36      D1D1D1FF 
+  36      D0D0D0FF 
+  36      CFCFCF
+  37 00c3 FFCECECE 		.ascii	"\377\316\316\316\377\315\315\315\377\314\314\314\377\313\313"
+  37      FFCDCDCD 
+  37      FFCCCCCC 
+  37      FFCBCB
+  38 00d2 CBFFCACA 		.ascii	"\313\377\312\312\312\377\311\311\311\377\310\310\310\377\307"
+  38      CAFFC9C9 
+  38      C9FFC8C8 
+  38      C8FFC7
+  39 00e1 C7C7FFC6 		.ascii	"\307\307\377\306\306\306\377\305\305\305\377\304\304\304\377"
+  39      C6C6FFC5 
+  39      C5C5FFC4 
+  39      C4C4FF
+  40 00f0 C3C3C3FF 		.ascii	"\303\303\303\377\302\302\302\377\301\301\301\377\300\300\300"
+  40      C2C2C2FF 
+  40      C1C1C1FF 
+  40      C0C0C0
+  41 00ff FFBFBFBF 		.ascii	"\377\277\277\277\377\276\276\276\377\275\275\275\377\274\274"
+  41      FFBEBEBE 
+  41      FFBDBDBD 
+  41      FFBCBC
+  42 010e BCFFBBBB 		.ascii	"\274\377\273\273\273\377\272\272\272\377\271\271\271\377\270"
+  42      BBFFBABA 
+  42      BAFFB9B9 
+  42      B9FFB8
+  43 011d B8B8FFB7 		.ascii	"\270\270\377\267\267\267\377\266\266\266\377\265\265\265\377"
+  43      B7B7FFB6 
+  43      B6B6FFB5 
+  43      B5B5FF
+  44 012c B4B4B4FF 		.ascii	"\264\264\264\377\263\263\263\377\262\262\262\377\261\261\261"
+  44      B3B3B3FF 
+  44      B2B2B2FF 
+  44      B1B1B1
+  45 013b FFB0B0B0 		.ascii	"\377\260\260\260\377\257\257\257\377\256\256\256\377\255\255"
+  45      FFAFAFAF 
+  45      FFAEAEAE 
+  45      FFADAD
+GAS LISTING /tmp/ccUIsTvF.s 			page 3
+
+
+  46 014a ADFFACAC 		.ascii	"\255\377\254\254\254\377\253\253\253\377\252\252\252\377\251"
+  46      ACFFABAB 
+  46      ABFFAAAA 
+  46      AAFFA9
+  47 0159 A9A9FFA8 		.ascii	"\251\251\377\250\250\250\377\247\247\247\377\246\246\246\377"
+  47      A8A8FFA7 
+  47      A7A7FFA6 
+  47      A6A6FF
+  48 0168 A5A5A5FF 		.ascii	"\245\245\245\377\244\244\244\377\243\243\243\377\242\242\242"
+  48      A4A4A4FF 
+  48      A3A3A3FF 
+  48      A2A2A2
+  49 0177 FFA1A1A1 		.ascii	"\377\241\241\241\377\240\240\240\377\237\237\237\377\236\236"
+  49      FFA0A0A0 
+  49      FF9F9F9F 
+  49      FF9E9E
+  50 0186 9EFF9D9D 		.ascii	"\236\377\235\235\235\377\234\234\234\377\233\233\233\377\232"
+  50      9DFF9C9C 
+  50      9CFF9B9B 
+  50      9BFF9A
+  51 0195 9A9AFF99 		.ascii	"\232\232\377\231\231\231\377\230\230\230\377\227\227\227\377"
+  51      9999FF98 
+  51      9898FF97 
+  51      9797FF
+  52 01a4 969696FF 		.ascii	"\226\226\226\377\225\225\225\377\224\224\224\377\223\223\223"
+  52      959595FF 
+  52      949494FF 
+  52      939393
+  53 01b3 FF929292 		.ascii	"\377\222\222\222\377\221\221\221\377\220\220\220\377\217\217"
+  53      FF919191 
+  53      FF909090 
+  53      FF8F8F
+  54 01c2 8FFF8E8E 		.ascii	"\217\377\216\216\216\377\215\215\215\377\214\214\214\377\213"
+  54      8EFF8D8D 
+  54      8DFF8C8C 
+  54      8CFF8B
+  55 01d1 8B8BFF8A 		.ascii	"\213\213\377\212\212\212\377\211\211\211\377\210\210\210\377"
+  55      8A8AFF89 
+  55      8989FF88 
+  55      8888FF
+  56 01e0 878787FF 		.ascii	"\207\207\207\377\206\206\206\377\205\205\205\377\204\204\204"
+  56      868686FF 
+  56      858585FF 
+  56      848484
+  57 01ef FF838383 		.ascii	"\377\203\203\203\377\202\202\202\377\201\201\201\377\200\200"
+  57      FF828282 
+  57      FF818181 
+  57      FF8080
+  58 01fe 80FF7F7F 		.ascii	"\200\377\177\177\177\377~~~\377}}}\377|||\377{{{\377zzz\377y"
+  58      7FFF7E7E 
+  58      7EFF7D7D 
+  58      7DFF7C7C 
+  58      7CFF7B7B 
+  59 0219 7979FF78 		.ascii	"yy\377xxx\377www\377vvv\377uuu\377ttt\377sss\377rrr\377qqq\377"
+  59      7878FF77 
+  59      7777FF76 
+  59      7676FF75 
+GAS LISTING /tmp/ccUIsTvF.s 			page 4
+
+
+  59      7575FF74 
+  60 023c 707070FF 		.ascii	"ppp\377ooo\377nnn\377mmm\377lll\377kkk\377jjj\377iii\377hhh\377"
+  60      6F6F6FFF 
+  60      6E6E6EFF 
+  60      6D6D6DFF 
+  60      6C6C6CFF 
+  61 0260 676767FF 		.ascii	"ggg\377fff\377eee\377ddd\377ccc\377bbb\377aaa\377```\377___\377"
+  61      666666FF 
+  61      656565FF 
+  61      646464FF 
+  61      636363FF 
+  62 0284 5E5E5EFF 		.ascii	"^^^\377]]]\377\\\\\\\377[[[\377ZZZ\377YYY\377XXX\377WWW\377V"
+  62      5D5D5DFF 
+  62      5C5C5CFF 
+  62      5B5B5BFF 
+  62      5A5A5AFF 
+  63 02a5 5656FF55 		.ascii	"VV\377UUU\377TTT\377SSS\377RRR\377QQQ\377PPP\377OOO\377NNN\377"
+  63      5555FF54 
+  63      5454FF53 
+  63      5353FF52 
+  63      5252FF51 
+  64 02c8 4D4D4DFF 		.ascii	"MMM\377LLL\377KKK\377JJJ\377III\377HHH\377GGG\377FFF\377EEE\377"
+  64      4C4C4CFF 
+  64      4B4B4BFF 
+  64      4A4A4AFF 
+  64      494949FF 
+  65 02ec 444444FF 		.ascii	"DDD\377CCC\377BBB\377AAA\377"
+  65      434343FF 
+  65      424242FF 
+  65      414141FF 
+  66 02fc 404040FF 		.string	"@@@\377???\377>>>\377===\377<<<\377;;;\377:::\377999\377888\377777\377666\377555\377444\3
+  66      3F3F3FFF 
+  66      3E3E3EFF 
+  66      3D3D3DFF 
+  66      3C3C3CFF 
+  67 03fd 00       		.string	""
+  68 03fe 00       		.string	""
+  69 03ff FF       		.ascii	"\377"
+  70              		.globl	heatmap_cs_w2b
+  71              		.section	.data.rel.local
+  72              		.align 8
+  73              		.type	heatmap_cs_w2b, @object
+  74              		.size	heatmap_cs_w2b, 8
+  75              	heatmap_cs_w2b:
+  76 0008 00000000 		.quad	w2b
+  76      00000000 
+  77              		.section	.data.rel.ro.local
+  78              		.align 16
+  79              		.type	w2b, @object
+  80              		.size	w2b, 16
+  81              	w2b:
+  82 0010 00000000 		.quad	w2b_data
+  82      00000000 
+  83 0018 01010000 		.quad	257
+  83      00000000 
+  84              		.section	.rodata
+  85              		.align 32
+GAS LISTING /tmp/ccUIsTvF.s 			page 5
+
+
+  86              		.type	w2b_data, @object
+  87              		.size	w2b_data, 1028
+  88              	w2b_data:
+  89 0400 FFFFFF00 		.string	"\377\377\377"
+  90 0404 FFFFFFFF 		.ascii	"\377\377\377\377\376\376\376\377\375\375\375\377\374\374\374"
+  90      FEFEFEFF 
+  90      FDFDFDFF 
+  90      FCFCFC
+  91 0413 FFFBFBFB 		.ascii	"\377\373\373\373\377\372\372\372\377\371\371\371\377\370\370"
+  91      FFFAFAFA 
+  91      FFF9F9F9 
+  91      FFF8F8
+  92 0422 F8FFF7F7 		.ascii	"\370\377\367\367\367\377\366\366\366\377\365\365\365\377\364"
+  92      F7FFF6F6 
+  92      F6FFF5F5 
+  92      F5FFF4
+  93 0431 F4F4FFF3 		.ascii	"\364\364\377\363\363\363\377\362\362\362\377\361\361\361\377"
+  93      F3F3FFF2 
+  93      F2F2FFF1 
+  93      F1F1FF
+  94 0440 F0F0F0FF 		.ascii	"\360\360\360\377\357\357\357\377\356\356\356\377\355\355\355"
+  94      EFEFEFFF 
+  94      EEEEEEFF 
+  94      EDEDED
+  95 044f FFECECEC 		.ascii	"\377\354\354\354\377\353\353\353\377\352\352\352\377\351\351"
+  95      FFEBEBEB 
+  95      FFEAEAEA 
+  95      FFE9E9
+  96 045e E9FFE8E8 		.ascii	"\351\377\350\350\350\377\347\347\347\377\346\346\346\377\345"
+  96      E8FFE7E7 
+  96      E7FFE6E6 
+  96      E6FFE5
+  97 046d E5E5FFE4 		.ascii	"\345\345\377\344\344\344\377\343\343\343\377\342\342\342\377"
+  97      E4E4FFE3 
+  97      E3E3FFE2 
+  97      E2E2FF
+  98 047c E1E1E1FF 		.ascii	"\341\341\341\377\340\340\340\377\337\337\337\377\336\336\336"
+  98      E0E0E0FF 
+  98      DFDFDFFF 
+  98      DEDEDE
+  99 048b FFDDDDDD 		.ascii	"\377\335\335\335\377\334\334\334\377\333\333\333\377\332\332"
+  99      FFDCDCDC 
+  99      FFDBDBDB 
+  99      FFDADA
+ 100 049a DAFFD9D9 		.ascii	"\332\377\331\331\331\377\330\330\330\377\327\327\327\377\326"
+ 100      D9FFD8D8 
+ 100      D8FFD7D7 
+ 100      D7FFD6
+ 101 04a9 D6D6FFD5 		.ascii	"\326\326\377\325\325\325\377\324\324\324\377\323\323\323\377"
+ 101      D5D5FFD4 
+ 101      D4D4FFD3 
+ 101      D3D3FF
+ 102 04b8 D2D2D2FF 		.ascii	"\322\322\322\377\321\321\321\377\320\320\320\377\317\317\317"
+ 102      D1D1D1FF 
+ 102      D0D0D0FF 
+ 102      CFCFCF
+ 103 04c7 FFCECECE 		.ascii	"\377\316\316\316\377\315\315\315\377\314\314\314\377\313\313"
+GAS LISTING /tmp/ccUIsTvF.s 			page 6
+
+
+ 103      FFCDCDCD 
+ 103      FFCCCCCC 
+ 103      FFCBCB
+ 104 04d6 CBFFCACA 		.ascii	"\313\377\312\312\312\377\311\311\311\377\310\310\310\377\307"
+ 104      CAFFC9C9 
+ 104      C9FFC8C8 
+ 104      C8FFC7
+ 105 04e5 C7C7FFC6 		.ascii	"\307\307\377\306\306\306\377\305\305\305\377\304\304\304\377"
+ 105      C6C6FFC5 
+ 105      C5C5FFC4 
+ 105      C4C4FF
+ 106 04f4 C3C3C3FF 		.ascii	"\303\303\303\377\302\302\302\377\301\301\301\377\300\300\300"
+ 106      C2C2C2FF 
+ 106      C1C1C1FF 
+ 106      C0C0C0
+ 107 0503 FFBFBFBF 		.ascii	"\377\277\277\277\377\276\276\276\377\275\275\275\377\274\274"
+ 107      FFBEBEBE 
+ 107      FFBDBDBD 
+ 107      FFBCBC
+ 108 0512 BCFFBBBB 		.ascii	"\274\377\273\273\273\377\272\272\272\377\271\271\271\377\270"
+ 108      BBFFBABA 
+ 108      BAFFB9B9 
+ 108      B9FFB8
+ 109 0521 B8B8FFB7 		.ascii	"\270\270\377\267\267\267\377\266\266\266\377\265\265\265\377"
+ 109      B7B7FFB6 
+ 109      B6B6FFB5 
+ 109      B5B5FF
+ 110 0530 B4B4B4FF 		.ascii	"\264\264\264\377\263\263\263\377\262\262\262\377\261\261\261"
+ 110      B3B3B3FF 
+ 110      B2B2B2FF 
+ 110      B1B1B1
+ 111 053f FFB0B0B0 		.ascii	"\377\260\260\260\377\257\257\257\377\256\256\256\377\255\255"
+ 111      FFAFAFAF 
+ 111      FFAEAEAE 
+ 111      FFADAD
+ 112 054e ADFFACAC 		.ascii	"\255\377\254\254\254\377\253\253\253\377\252\252\252\377\251"
+ 112      ACFFABAB 
+ 112      ABFFAAAA 
+ 112      AAFFA9
+ 113 055d A9A9FFA8 		.ascii	"\251\251\377\250\250\250\377\247\247\247\377\246\246\246\377"
+ 113      A8A8FFA7 
+ 113      A7A7FFA6 
+ 113      A6A6FF
+ 114 056c A5A5A5FF 		.ascii	"\245\245\245\377\244\244\244\377\243\243\243\377\242\242\242"
+ 114      A4A4A4FF 
+ 114      A3A3A3FF 
+ 114      A2A2A2
+ 115 057b FFA1A1A1 		.ascii	"\377\241\241\241\377\240\240\240\377\237\237\237\377\236\236"
+ 115      FFA0A0A0 
+ 115      FF9F9F9F 
+ 115      FF9E9E
+ 116 058a 9EFF9D9D 		.ascii	"\236\377\235\235\235\377\234\234\234\377\233\233\233\377\232"
+ 116      9DFF9C9C 
+ 116      9CFF9B9B 
+ 116      9BFF9A
+ 117 0599 9A9AFF99 		.ascii	"\232\232\377\231\231\231\377\230\230\230\377\227\227\227\377"
+ 117      9999FF98 
+GAS LISTING /tmp/ccUIsTvF.s 			page 7
+
+
+ 117      9898FF97 
+ 117      9797FF
+ 118 05a8 969696FF 		.ascii	"\226\226\226\377\225\225\225\377\224\224\224\377\223\223\223"
+ 118      959595FF 
+ 118      949494FF 
+ 118      939393
+ 119 05b7 FF929292 		.ascii	"\377\222\222\222\377\221\221\221\377\220\220\220\377\217\217"
+ 119      FF919191 
+ 119      FF909090 
+ 119      FF8F8F
+ 120 05c6 8FFF8E8E 		.ascii	"\217\377\216\216\216\377\215\215\215\377\214\214\214\377\213"
+ 120      8EFF8D8D 
+ 120      8DFF8C8C 
+ 120      8CFF8B
+ 121 05d5 8B8BFF8A 		.ascii	"\213\213\377\212\212\212\377\211\211\211\377\210\210\210\377"
+ 121      8A8AFF89 
+ 121      8989FF88 
+ 121      8888FF
+ 122 05e4 878787FF 		.ascii	"\207\207\207\377\206\206\206\377\205\205\205\377\204\204\204"
+ 122      868686FF 
+ 122      858585FF 
+ 122      848484
+ 123 05f3 FF838383 		.ascii	"\377\203\203\203\377\202\202\202\377\201\201\201\377\200\200"
+ 123      FF828282 
+ 123      FF818181 
+ 123      FF8080
+ 124 0602 80FF7F7F 		.ascii	"\200\377\177\177\177\377~~~\377}}}\377|||\377{{{\377zzz\377y"
+ 124      7FFF7E7E 
+ 124      7EFF7D7D 
+ 124      7DFF7C7C 
+ 124      7CFF7B7B 
+ 125 061d 7979FF78 		.ascii	"yy\377xxx\377www\377vvv\377uuu\377ttt\377sss\377rrr\377qqq\377"
+ 125      7878FF77 
+ 125      7777FF76 
+ 125      7676FF75 
+ 125      7575FF74 
+ 126 0640 707070FF 		.ascii	"ppp\377ooo\377nnn\377mmm\377lll\377kkk\377jjj\377iii\377hhh\377"
+ 126      6F6F6FFF 
+ 126      6E6E6EFF 
+ 126      6D6D6DFF 
+ 126      6C6C6CFF 
+ 127 0664 676767FF 		.ascii	"ggg\377fff\377eee\377ddd\377ccc\377bbb\377aaa\377```\377___\377"
+ 127      666666FF 
+ 127      656565FF 
+ 127      646464FF 
+ 127      636363FF 
+ 128 0688 5E5E5EFF 		.ascii	"^^^\377]]]\377\\\\\\\377[[[\377ZZZ\377YYY\377XXX\377WWW\377V"
+ 128      5D5D5DFF 
+ 128      5C5C5CFF 
+ 128      5B5B5BFF 
+ 128      5A5A5AFF 
+ 129 06a9 5656FF55 		.ascii	"VV\377UUU\377TTT\377SSS\377RRR\377QQQ\377PPP\377OOO\377NNN\377"
+ 129      5555FF54 
+ 129      5454FF53 
+ 129      5353FF52 
+ 129      5252FF51 
+ 130 06cc 4D4D4DFF 		.ascii	"MMM\377LLL\377KKK\377JJJ\377III\377HHH\377GGG\377FFF\377EEE\377"
+GAS LISTING /tmp/ccUIsTvF.s 			page 8
+
+
+ 130      4C4C4CFF 
+ 130      4B4B4BFF 
+ 130      4A4A4AFF 
+ 130      494949FF 
+ 131 06f0 444444FF 		.ascii	"DDD\377CCC\377BBB\377AAA\377"
+ 131      434343FF 
+ 131      424242FF 
+ 131      414141FF 
+ 132 0700 404040FF 		.string	"@@@\377???\377>>>\377===\377<<<\377;;;\377:::\377999\377888\377777\377666\377555\377444\3
+ 132      3F3F3FFF 
+ 132      3E3E3EFF 
+ 132      3D3D3DFF 
+ 132      3C3C3CFF 
+ 133 0801 00       		.string	""
+ 134 0802 00       		.string	""
+ 135 0803 FF       		.ascii	"\377"
+ 136              		.globl	heatmap_cs_b2w_opaque
+ 137              		.section	.data.rel.local
+ 138              		.align 8
+ 139              		.type	heatmap_cs_b2w_opaque, @object
+ 140              		.size	heatmap_cs_b2w_opaque, 8
+ 141              	heatmap_cs_b2w_opaque:
+ 142 0010 00000000 		.quad	b2w_o
+ 142      00000000 
+ 143              		.section	.data.rel.ro.local
+ 144              		.align 16
+ 145              		.type	b2w_o, @object
+ 146              		.size	b2w_o, 16
+ 147              	b2w_o:
+ 148 0020 00000000 		.quad	b2w_o_data
+ 148      00000000 
+ 149 0028 00010000 		.quad	256
+ 149      00000000 
+ 150              		.section	.rodata
+ 151 0804 00000000 		.align 32
+ 151      00000000 
+ 151      00000000 
+ 151      00000000 
+ 151      00000000 
+ 152              		.type	b2w_o_data, @object
+ 153              		.size	b2w_o_data, 1024
+ 154              	b2w_o_data:
+ 155 0820 00       		.string	""
+ 156 0821 00       		.string	""
+ 157 0822 00       		.string	""
+ 158 0823 FF010101 		.ascii	"\377\001\001\001\377\002\002\002\377\003\003\003\377\004\004"
+ 158      FF020202 
+ 158      FF030303 
+ 158      FF0404
+ 159 0832 04FF0505 		.ascii	"\004\377\005\005\005\377\006\006\006\377\007\007\007\377\b\b"
+ 159      05FF0606 
+ 159      06FF0707 
+ 159      07FF0808 
+ 160 0842 08FF0909 		.ascii	"\b\377\t\t\t\377\n\n\n\377\013\013\013\377\f\f\f\377\r\r\r\377"
+ 160      09FF0A0A 
+ 160      0AFF0B0B 
+ 160      0BFF0C0C 
+GAS LISTING /tmp/ccUIsTvF.s 			page 9
+
+
+ 160      0CFF0D0D 
+ 161 0858 0E0E0EFF 		.ascii	"\016\016\016\377\017\017\017\377\020\020\020\377\021\021\021"
+ 161      0F0F0FFF 
+ 161      101010FF 
+ 161      111111
+ 162 0867 FF121212 		.ascii	"\377\022\022\022\377\023\023\023\377\024\024\024\377\025\025"
+ 162      FF131313 
+ 162      FF141414 
+ 162      FF1515
+ 163 0876 15FF1616 		.ascii	"\025\377\026\026\026\377\027\027\027\377\030\030\030\377\031"
+ 163      16FF1717 
+ 163      17FF1818 
+ 163      18FF19
+ 164 0885 1919FF1A 		.ascii	"\031\031\377\032\032\032\377\033\033\033\377\034\034\034\377"
+ 164      1A1AFF1B 
+ 164      1B1BFF1C 
+ 164      1C1CFF
+ 165 0894 1D1D1DFF 		.ascii	"\035\035\035\377\036\036\036\377\037\037\037\377   \377!!!\377"
+ 165      1E1E1EFF 
+ 165      1F1F1FFF 
+ 165      202020FF 
+ 165      212121FF 
+ 166 08a8 222222FF 		.ascii	"\"\"\"\377###\377$$$\377%%%\377&&&\377'''\377(((\377)))\377*"
+ 166      232323FF 
+ 166      242424FF 
+ 166      252525FF 
+ 166      262626FF 
+ 167 08c9 2A2AFF2B 		.ascii	"**\377+++\377,,,\377---\377...\377///\377000\377111\377222\377"
+ 167      2B2BFF2C 
+ 167      2C2CFF2D 
+ 167      2D2DFF2E 
+ 167      2E2EFF2F 
+ 168 08ec 333333FF 		.ascii	"333\377444\377555\377666\377777\377888\377999\377:::\377;;;\377"
+ 168      343434FF 
+ 168      353535FF 
+ 168      363636FF 
+ 168      373737FF 
+ 169 0910 3C3C3CFF 		.ascii	"<<<\377===\377>>>\377???\377@@@\377AAA\377BBB\377CCC\377DDD\377"
+ 169      3D3D3DFF 
+ 169      3E3E3EFF 
+ 169      3F3F3FFF 
+ 169      404040FF 
+ 170 0934 454545FF 		.ascii	"EEE\377FFF\377GGG\377HHH\377III\377JJJ\377KKK\377LLL\377MMM\377"
+ 170      464646FF 
+ 170      474747FF 
+ 170      484848FF 
+ 170      494949FF 
+ 171 0958 4E4E4EFF 		.ascii	"NNN\377OOO\377PPP\377QQQ\377RRR\377SSS\377TTT\377UUU\377VVV\377"
+ 171      4F4F4FFF 
+ 171      505050FF 
+ 171      515151FF 
+ 171      525252FF 
+ 172 097c 575757FF 		.ascii	"WWW\377XXX\377YYY\377ZZZ\377[[[\377\\\\\\\377]]]\377^^^\377_"
+ 172      585858FF 
+ 172      595959FF 
+ 172      5A5A5AFF 
+ 172      5B5B5BFF 
+GAS LISTING /tmp/ccUIsTvF.s 			page 10
+
+
+ 173 099d 5F5FFF60 		.ascii	"__\377```\377aaa\377bbb\377ccc\377ddd\377eee\377fff\377ggg\377"
+ 173      6060FF61 
+ 173      6161FF62 
+ 173      6262FF63 
+ 173      6363FF64 
+ 174 09c0 686868FF 		.ascii	"hhh\377iii\377jjj\377kkk\377lll\377mmm\377nnn\377ooo\377ppp\377"
+ 174      696969FF 
+ 174      6A6A6AFF 
+ 174      6B6B6BFF 
+ 174      6C6C6CFF 
+ 175 09e4 717171FF 		.ascii	"qqq\377rrr\377sss\377ttt\377uuu\377vvv\377www\377xxx\377yyy\377"
+ 175      727272FF 
+ 175      737373FF 
+ 175      747474FF 
+ 175      757575FF 
+ 176 0a08 7A7A7AFF 		.ascii	"zzz\377{{{\377|||\377}}}\377~~~\377\177\177\177\377\200\200\200"
+ 176      7B7B7BFF 
+ 176      7C7C7CFF 
+ 176      7D7D7DFF 
+ 176      7E7E7EFF 
+ 177 0a23 FF818181 		.ascii	"\377\201\201\201\377\202\202\202\377\203\203\203\377\204\204"
+ 177      FF828282 
+ 177      FF838383 
+ 177      FF8484
+ 178 0a32 84FF8585 		.ascii	"\204\377\205\205\205\377\206\206\206\377\207\207\207\377\210"
+ 178      85FF8686 
+ 178      86FF8787 
+ 178      87FF88
+ 179 0a41 8888FF89 		.ascii	"\210\210\377\211\211\211\377\212\212\212\377\213\213\213\377"
+ 179      8989FF8A 
+ 179      8A8AFF8B 
+ 179      8B8BFF
+ 180 0a50 8C8C8CFF 		.ascii	"\214\214\214\377\215\215\215\377\216\216\216\377\217\217\217"
+ 180      8D8D8DFF 
+ 180      8E8E8EFF 
+ 180      8F8F8F
+ 181 0a5f FF909090 		.ascii	"\377\220\220\220\377\221\221\221\377\222\222\222\377\223\223"
+ 181      FF919191 
+ 181      FF929292 
+ 181      FF9393
+ 182 0a6e 93FF9494 		.ascii	"\223\377\224\224\224\377\225\225\225\377\226\226\226\377\227"
+ 182      94FF9595 
+ 182      95FF9696 
+ 182      96FF97
+ 183 0a7d 9797FF98 		.ascii	"\227\227\377\230\230\230\377\231\231\231\377\232\232\232\377"
+ 183      9898FF99 
+ 183      9999FF9A 
+ 183      9A9AFF
+ 184 0a8c 9B9B9BFF 		.ascii	"\233\233\233\377\234\234\234\377\235\235\235\377\236\236\236"
+ 184      9C9C9CFF 
+ 184      9D9D9DFF 
+ 184      9E9E9E
+ 185 0a9b FF9F9F9F 		.ascii	"\377\237\237\237\377\240\240\240\377\241\241\241\377\242\242"
+ 185      FFA0A0A0 
+ 185      FFA1A1A1 
+ 185      FFA2A2
+ 186 0aaa A2FFA3A3 		.ascii	"\242\377\243\243\243\377\244\244\244\377\245\245\245\377\246"
+GAS LISTING /tmp/ccUIsTvF.s 			page 11
+
+
+ 186      A3FFA4A4 
+ 186      A4FFA5A5 
+ 186      A5FFA6
+ 187 0ab9 A6A6FFA7 		.ascii	"\246\246\377\247\247\247\377\250\250\250\377\251\251\251\377"
+ 187      A7A7FFA8 
+ 187      A8A8FFA9 
+ 187      A9A9FF
+ 188 0ac8 AAAAAAFF 		.ascii	"\252\252\252\377\253\253\253\377\254\254\254\377\255\255\255"
+ 188      ABABABFF 
+ 188      ACACACFF 
+ 188      ADADAD
+ 189 0ad7 FFAEAEAE 		.ascii	"\377\256\256\256\377\257\257\257\377\260\260\260\377\261\261"
+ 189      FFAFAFAF 
+ 189      FFB0B0B0 
+ 189      FFB1B1
+ 190 0ae6 B1FFB2B2 		.ascii	"\261\377\262\262\262\377\263\263\263\377\264\264\264\377\265"
+ 190      B2FFB3B3 
+ 190      B3FFB4B4 
+ 190      B4FFB5
+ 191 0af5 B5B5FFB6 		.ascii	"\265\265\377\266\266\266\377\267\267\267\377\270\270\270\377"
+ 191      B6B6FFB7 
+ 191      B7B7FFB8 
+ 191      B8B8FF
+ 192 0b04 B9B9B9FF 		.ascii	"\271\271\271\377\272\272\272\377\273\273\273\377\274\274\274"
+ 192      BABABAFF 
+ 192      BBBBBBFF 
+ 192      BCBCBC
+ 193 0b13 FFBDBDBD 		.ascii	"\377\275\275\275\377\276\276\276\377\277\277\277\377\300\300"
+ 193      FFBEBEBE 
+ 193      FFBFBFBF 
+ 193      FFC0C0
+ 194 0b22 C0FFC1C1 		.ascii	"\300\377\301\301\301\377\302\302\302\377\303\303\303\377\304"
+ 194      C1FFC2C2 
+ 194      C2FFC3C3 
+ 194      C3FFC4
+ 195 0b31 C4C4FFC5 		.ascii	"\304\304\377\305\305\305\377\306\306\306\377\307\307\307\377"
+ 195      C5C5FFC6 
+ 195      C6C6FFC7 
+ 195      C7C7FF
+ 196 0b40 C8C8C8FF 		.ascii	"\310\310\310\377\311\311\311\377\312\312\312\377\313\313\313"
+ 196      C9C9C9FF 
+ 196      CACACAFF 
+ 196      CBCBCB
+ 197 0b4f FFCCCCCC 		.ascii	"\377\314\314\314\377\315\315\315\377\316\316\316\377\317\317"
+ 197      FFCDCDCD 
+ 197      FFCECECE 
+ 197      FFCFCF
+ 198 0b5e CFFFD0D0 		.ascii	"\317\377\320\320\320\377\321\321\321\377\322\322\322\377\323"
+ 198      D0FFD1D1 
+ 198      D1FFD2D2 
+ 198      D2FFD3
+ 199 0b6d D3D3FFD4 		.ascii	"\323\323\377\324\324\324\377\325\325\325\377\326\326\326\377"
+ 199      D4D4FFD5 
+ 199      D5D5FFD6 
+ 199      D6D6FF
+ 200 0b7c D7D7D7FF 		.ascii	"\327\327\327\377\330\330\330\377\331\331\331\377\332\332\332"
+ 200      D8D8D8FF 
+GAS LISTING /tmp/ccUIsTvF.s 			page 12
+
+
+ 200      D9D9D9FF 
+ 200      DADADA
+ 201 0b8b FFDBDBDB 		.ascii	"\377\333\333\333\377\334\334\334\377\335\335\335\377\336\336"
+ 201      FFDCDCDC 
+ 201      FFDDDDDD 
+ 201      FFDEDE
+ 202 0b9a DEFFDFDF 		.ascii	"\336\377\337\337\337\377\340\340\340\377\341\341\341\377\342"
+ 202      DFFFE0E0 
+ 202      E0FFE1E1 
+ 202      E1FFE2
+ 203 0ba9 E2E2FFE3 		.ascii	"\342\342\377\343\343\343\377\344\344\344\377\345\345\345\377"
+ 203      E3E3FFE4 
+ 203      E4E4FFE5 
+ 203      E5E5FF
+ 204 0bb8 E6E6E6FF 		.ascii	"\346\346\346\377\347\347\347\377\350\350\350\377\351\351\351"
+ 204      E7E7E7FF 
+ 204      E8E8E8FF 
+ 204      E9E9E9
+ 205 0bc7 FFEAEAEA 		.ascii	"\377\352\352\352\377\353\353\353\377\354\354\354\377\355\355"
+ 205      FFEBEBEB 
+ 205      FFECECEC 
+ 205      FFEDED
+ 206 0bd6 EDFFEEEE 		.ascii	"\355\377\356\356\356\377\357\357\357\377\360\360\360\377\361"
+ 206      EEFFEFEF 
+ 206      EFFFF0F0 
+ 206      F0FFF1
+ 207 0be5 F1F1FFF2 		.ascii	"\361\361\377\362\362\362\377\363\363\363\377\364\364\364\377"
+ 207      F2F2FFF3 
+ 207      F3F3FFF4 
+ 207      F4F4FF
+ 208 0bf4 F5F5F5FF 		.ascii	"\365\365\365\377\366\366\366\377\367\367\367\377\370\370\370"
+ 208      F6F6F6FF 
+ 208      F7F7F7FF 
+ 208      F8F8F8
+ 209 0c03 FFF9F9F9 		.ascii	"\377\371\371\371\377\372\372\372\377\373\373\373\377\374\374"
+ 209      FFFAFAFA 
+ 209      FFFBFBFB 
+ 209      FFFCFC
+ 210 0c12 FCFFFDFD 		.ascii	"\374\377\375\375\375\377\376\376\376\377\377\377\377\377"
+ 210      FDFFFEFE 
+ 210      FEFFFFFF 
+ 210      FFFF
+ 211              		.globl	heatmap_cs_b2w
+ 212              		.section	.data.rel.local
+ 213              		.align 8
+ 214              		.type	heatmap_cs_b2w, @object
+ 215              		.size	heatmap_cs_b2w, 8
+ 216              	heatmap_cs_b2w:
+ 217 0018 00000000 		.quad	b2w
+ 217      00000000 
+ 218              		.section	.data.rel.ro.local
+ 219              		.align 16
+ 220              		.type	b2w, @object
+ 221              		.size	b2w, 16
+ 222              	b2w:
+ 223 0030 00000000 		.quad	b2w_data
+ 223      00000000 
+GAS LISTING /tmp/ccUIsTvF.s 			page 13
+
+
+ 224 0038 01010000 		.quad	257
+ 224      00000000 
+ 225              		.section	.rodata
+ 226              		.align 32
+ 227              		.type	b2w_data, @object
+ 228              		.size	b2w_data, 1028
+ 229              	b2w_data:
+ 230 0c20 00       		.string	""
+ 231 0c21 00       		.string	""
+ 232 0c22 00       		.string	""
+ 233 0c23 00       		.string	""
+ 234 0c24 00       		.string	""
+ 235 0c25 00       		.string	""
+ 236 0c26 00       		.string	""
+ 237 0c27 FF010101 		.ascii	"\377\001\001\001\377\002\002\002\377\003\003\003\377\004\004"
+ 237      FF020202 
+ 237      FF030303 
+ 237      FF0404
+ 238 0c36 04FF0505 		.ascii	"\004\377\005\005\005\377\006\006\006\377\007\007\007\377\b\b"
+ 238      05FF0606 
+ 238      06FF0707 
+ 238      07FF0808 
+ 239 0c46 08FF0909 		.ascii	"\b\377\t\t\t\377\n\n\n\377\013\013\013\377\f\f\f\377\r\r\r\377"
+ 239      09FF0A0A 
+ 239      0AFF0B0B 
+ 239      0BFF0C0C 
+ 239      0CFF0D0D 
+ 240 0c5c 0E0E0EFF 		.ascii	"\016\016\016\377\017\017\017\377\020\020\020\377\021\021\021"
+ 240      0F0F0FFF 
+ 240      101010FF 
+ 240      111111
+ 241 0c6b FF121212 		.ascii	"\377\022\022\022\377\023\023\023\377\024\024\024\377\025\025"
+ 241      FF131313 
+ 241      FF141414 
+ 241      FF1515
+ 242 0c7a 15FF1616 		.ascii	"\025\377\026\026\026\377\027\027\027\377\030\030\030\377\031"
+ 242      16FF1717 
+ 242      17FF1818 
+ 242      18FF19
+ 243 0c89 1919FF1A 		.ascii	"\031\031\377\032\032\032\377\033\033\033\377\034\034\034\377"
+ 243      1A1AFF1B 
+ 243      1B1BFF1C 
+ 243      1C1CFF
+ 244 0c98 1D1D1DFF 		.ascii	"\035\035\035\377\036\036\036\377\037\037\037\377   \377!!!\377"
+ 244      1E1E1EFF 
+ 244      1F1F1FFF 
+ 244      202020FF 
+ 244      212121FF 
+ 245 0cac 222222FF 		.ascii	"\"\"\"\377###\377$$$\377%%%\377&&&\377'''\377(((\377)))\377*"
+ 245      232323FF 
+ 245      242424FF 
+ 245      252525FF 
+ 245      262626FF 
+ 246 0ccd 2A2AFF2B 		.ascii	"**\377+++\377,,,\377---\377...\377///\377000\377111\377222\377"
+ 246      2B2BFF2C 
+ 246      2C2CFF2D 
+ 246      2D2DFF2E 
+GAS LISTING /tmp/ccUIsTvF.s 			page 14
+
+
+ 246      2E2EFF2F 
+ 247 0cf0 333333FF 		.ascii	"333\377444\377555\377666\377777\377888\377999\377:::\377;;;\377"
+ 247      343434FF 
+ 247      353535FF 
+ 247      363636FF 
+ 247      373737FF 
+ 248 0d14 3C3C3CFF 		.ascii	"<<<\377===\377>>>\377???\377@@@\377AAA\377BBB\377CCC\377DDD\377"
+ 248      3D3D3DFF 
+ 248      3E3E3EFF 
+ 248      3F3F3FFF 
+ 248      404040FF 
+ 249 0d38 454545FF 		.ascii	"EEE\377FFF\377GGG\377HHH\377III\377JJJ\377KKK\377LLL\377MMM\377"
+ 249      464646FF 
+ 249      474747FF 
+ 249      484848FF 
+ 249      494949FF 
+ 250 0d5c 4E4E4EFF 		.ascii	"NNN\377OOO\377PPP\377QQQ\377RRR\377SSS\377TTT\377UUU\377VVV\377"
+ 250      4F4F4FFF 
+ 250      505050FF 
+ 250      515151FF 
+ 250      525252FF 
+ 251 0d80 575757FF 		.ascii	"WWW\377XXX\377YYY\377ZZZ\377[[[\377\\\\\\\377]]]\377^^^\377_"
+ 251      585858FF 
+ 251      595959FF 
+ 251      5A5A5AFF 
+ 251      5B5B5BFF 
+ 252 0da1 5F5FFF60 		.ascii	"__\377```\377aaa\377bbb\377ccc\377ddd\377eee\377fff\377ggg\377"
+ 252      6060FF61 
+ 252      6161FF62 
+ 252      6262FF63 
+ 252      6363FF64 
+ 253 0dc4 686868FF 		.ascii	"hhh\377iii\377jjj\377kkk\377lll\377mmm\377nnn\377ooo\377ppp\377"
+ 253      696969FF 
+ 253      6A6A6AFF 
+ 253      6B6B6BFF 
+ 253      6C6C6CFF 
+ 254 0de8 717171FF 		.ascii	"qqq\377rrr\377sss\377ttt\377uuu\377vvv\377www\377xxx\377yyy\377"
+ 254      727272FF 
+ 254      737373FF 
+ 254      747474FF 
+ 254      757575FF 
+ 255 0e0c 7A7A7AFF 		.ascii	"zzz\377{{{\377|||\377}}}\377~~~\377\177\177\177\377\200\200\200"
+ 255      7B7B7BFF 
+ 255      7C7C7CFF 
+ 255      7D7D7DFF 
+ 255      7E7E7EFF 
+ 256 0e27 FF818181 		.ascii	"\377\201\201\201\377\202\202\202\377\203\203\203\377\204\204"
+ 256      FF828282 
+ 256      FF838383 
+ 256      FF8484
+ 257 0e36 84FF8585 		.ascii	"\204\377\205\205\205\377\206\206\206\377\207\207\207\377\210"
+ 257      85FF8686 
+ 257      86FF8787 
+ 257      87FF88
+ 258 0e45 8888FF89 		.ascii	"\210\210\377\211\211\211\377\212\212\212\377\213\213\213\377"
+ 258      8989FF8A 
+ 258      8A8AFF8B 
+GAS LISTING /tmp/ccUIsTvF.s 			page 15
+
+
+ 258      8B8BFF
+ 259 0e54 8C8C8CFF 		.ascii	"\214\214\214\377\215\215\215\377\216\216\216\377\217\217\217"
+ 259      8D8D8DFF 
+ 259      8E8E8EFF 
+ 259      8F8F8F
+ 260 0e63 FF909090 		.ascii	"\377\220\220\220\377\221\221\221\377\222\222\222\377\223\223"
+ 260      FF919191 
+ 260      FF929292 
+ 260      FF9393
+ 261 0e72 93FF9494 		.ascii	"\223\377\224\224\224\377\225\225\225\377\226\226\226\377\227"
+ 261      94FF9595 
+ 261      95FF9696 
+ 261      96FF97
+ 262 0e81 9797FF98 		.ascii	"\227\227\377\230\230\230\377\231\231\231\377\232\232\232\377"
+ 262      9898FF99 
+ 262      9999FF9A 
+ 262      9A9AFF
+ 263 0e90 9B9B9BFF 		.ascii	"\233\233\233\377\234\234\234\377\235\235\235\377\236\236\236"
+ 263      9C9C9CFF 
+ 263      9D9D9DFF 
+ 263      9E9E9E
+ 264 0e9f FF9F9F9F 		.ascii	"\377\237\237\237\377\240\240\240\377\241\241\241\377\242\242"
+ 264      FFA0A0A0 
+ 264      FFA1A1A1 
+ 264      FFA2A2
+ 265 0eae A2FFA3A3 		.ascii	"\242\377\243\243\243\377\244\244\244\377\245\245\245\377\246"
+ 265      A3FFA4A4 
+ 265      A4FFA5A5 
+ 265      A5FFA6
+ 266 0ebd A6A6FFA7 		.ascii	"\246\246\377\247\247\247\377\250\250\250\377\251\251\251\377"
+ 266      A7A7FFA8 
+ 266      A8A8FFA9 
+ 266      A9A9FF
+ 267 0ecc AAAAAAFF 		.ascii	"\252\252\252\377\253\253\253\377\254\254\254\377\255\255\255"
+ 267      ABABABFF 
+ 267      ACACACFF 
+ 267      ADADAD
+ 268 0edb FFAEAEAE 		.ascii	"\377\256\256\256\377\257\257\257\377\260\260\260\377\261\261"
+ 268      FFAFAFAF 
+ 268      FFB0B0B0 
+ 268      FFB1B1
+ 269 0eea B1FFB2B2 		.ascii	"\261\377\262\262\262\377\263\263\263\377\264\264\264\377\265"
+ 269      B2FFB3B3 
+ 269      B3FFB4B4 
+ 269      B4FFB5
+ 270 0ef9 B5B5FFB6 		.ascii	"\265\265\377\266\266\266\377\267\267\267\377\270\270\270\377"
+ 270      B6B6FFB7 
+ 270      B7B7FFB8 
+ 270      B8B8FF
+ 271 0f08 B9B9B9FF 		.ascii	"\271\271\271\377\272\272\272\377\273\273\273\377\274\274\274"
+ 271      BABABAFF 
+ 271      BBBBBBFF 
+ 271      BCBCBC
+ 272 0f17 FFBDBDBD 		.ascii	"\377\275\275\275\377\276\276\276\377\277\277\277\377\300\300"
+ 272      FFBEBEBE 
+ 272      FFBFBFBF 
+ 272      FFC0C0
+GAS LISTING /tmp/ccUIsTvF.s 			page 16
+
+
+ 273 0f26 C0FFC1C1 		.ascii	"\300\377\301\301\301\377\302\302\302\377\303\303\303\377\304"
+ 273      C1FFC2C2 
+ 273      C2FFC3C3 
+ 273      C3FFC4
+ 274 0f35 C4C4FFC5 		.ascii	"\304\304\377\305\305\305\377\306\306\306\377\307\307\307\377"
+ 274      C5C5FFC6 
+ 274      C6C6FFC7 
+ 274      C7C7FF
+ 275 0f44 C8C8C8FF 		.ascii	"\310\310\310\377\311\311\311\377\312\312\312\377\313\313\313"
+ 275      C9C9C9FF 
+ 275      CACACAFF 
+ 275      CBCBCB
+ 276 0f53 FFCCCCCC 		.ascii	"\377\314\314\314\377\315\315\315\377\316\316\316\377\317\317"
+ 276      FFCDCDCD 
+ 276      FFCECECE 
+ 276      FFCFCF
+ 277 0f62 CFFFD0D0 		.ascii	"\317\377\320\320\320\377\321\321\321\377\322\322\322\377\323"
+ 277      D0FFD1D1 
+ 277      D1FFD2D2 
+ 277      D2FFD3
+ 278 0f71 D3D3FFD4 		.ascii	"\323\323\377\324\324\324\377\325\325\325\377\326\326\326\377"
+ 278      D4D4FFD5 
+ 278      D5D5FFD6 
+ 278      D6D6FF
+ 279 0f80 D7D7D7FF 		.ascii	"\327\327\327\377\330\330\330\377\331\331\331\377\332\332\332"
+ 279      D8D8D8FF 
+ 279      D9D9D9FF 
+ 279      DADADA
+ 280 0f8f FFDBDBDB 		.ascii	"\377\333\333\333\377\334\334\334\377\335\335\335\377\336\336"
+ 280      FFDCDCDC 
+ 280      FFDDDDDD 
+ 280      FFDEDE
+ 281 0f9e DEFFDFDF 		.ascii	"\336\377\337\337\337\377\340\340\340\377\341\341\341\377\342"
+ 281      DFFFE0E0 
+ 281      E0FFE1E1 
+ 281      E1FFE2
+ 282 0fad E2E2FFE3 		.ascii	"\342\342\377\343\343\343\377\344\344\344\377\345\345\345\377"
+ 282      E3E3FFE4 
+ 282      E4E4FFE5 
+ 282      E5E5FF
+ 283 0fbc E6E6E6FF 		.ascii	"\346\346\346\377\347\347\347\377\350\350\350\377\351\351\351"
+ 283      E7E7E7FF 
+ 283      E8E8E8FF 
+ 283      E9E9E9
+ 284 0fcb FFEAEAEA 		.ascii	"\377\352\352\352\377\353\353\353\377\354\354\354\377\355\355"
+ 284      FFEBEBEB 
+ 284      FFECECEC 
+ 284      FFEDED
+ 285 0fda EDFFEEEE 		.ascii	"\355\377\356\356\356\377\357\357\357\377\360\360\360\377\361"
+ 285      EEFFEFEF 
+ 285      EFFFF0F0 
+ 285      F0FFF1
+ 286 0fe9 F1F1FFF2 		.ascii	"\361\361\377\362\362\362\377\363\363\363\377\364\364\364\377"
+ 286      F2F2FFF3 
+ 286      F3F3FFF4 
+ 286      F4F4FF
+ 287 0ff8 F5F5F5FF 		.ascii	"\365\365\365\377\366\366\366\377\367\367\367\377\370\370\370"
+GAS LISTING /tmp/ccUIsTvF.s 			page 17
+
+
+ 287      F6F6F6FF 
+ 287      F7F7F7FF 
+ 287      F8F8F8
+ 288 1007 FFF9F9F9 		.ascii	"\377\371\371\371\377\372\372\372\377\373\373\373\377\374\374"
+ 288      FFFAFAFA 
+ 288      FFFBFBFB 
+ 288      FFFCFC
+ 289 1016 FCFFFDFD 		.ascii	"\374\377\375\375\375\377\376\376\376\377\377\377\377\377"
+ 289      FDFFFEFE 
+ 289      FEFFFFFF 
+ 289      FFFF
+ 290              		.text
+ 291              	.Letext0:
+ 292              		.file 1 "./heatmap.h"
+ 293              		.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+ 294              		.file 3 "./colorschemes/gray.h"
+ 295              		.file 4 "colorschemes/gray.c"
+ 296              		.section	.debug_info,"",@progbits
+ 297              	.Ldebug_info0:
+ 298 0000 E2010000 		.long	0x1e2
+ 299 0004 0500     		.value	0x5
+ 300 0006 01       		.byte	0x1
+ 301 0007 08       		.byte	0x8
+ 302 0008 00000000 		.long	.Ldebug_abbrev0
+ 303 000c 0C       		.uleb128 0xc
+ 304 000d 00000000 		.long	.LASF24
+ 305 0011 1D       		.byte	0x1d
+ 306 0012 00000000 		.long	.LASF0
+ 307 0016 00000000 		.long	.LASF1
+ 308 001a 00000000 		.long	.Ldebug_line0
+ 309 001e 01       		.uleb128 0x1
+ 310 001f 08       		.byte	0x8
+ 311 0020 05       		.byte	0x5
+ 312 0021 00000000 		.long	.LASF2
+ 313 0025 06       		.uleb128 0x6
+ 314 0026 00000000 		.long	.LASF12
+ 315 002a 02       		.byte	0x2
+ 316 002b D6       		.byte	0xd6
+ 317 002c 17       		.byte	0x17
+ 318 002d 31000000 		.long	0x31
+ 319 0031 01       		.uleb128 0x1
+ 320 0032 08       		.byte	0x8
+ 321 0033 07       		.byte	0x7
+ 322 0034 00000000 		.long	.LASF3
+ 323 0038 0D       		.uleb128 0xd
+ 324 0039 04       		.byte	0x4
+ 325 003a 05       		.byte	0x5
+ 326 003b 696E7400 		.string	"int"
+ 327 003f 01       		.uleb128 0x1
+ 328 0040 08       		.byte	0x8
+ 329 0041 05       		.byte	0x5
+ 330 0042 00000000 		.long	.LASF4
+ 331 0046 01       		.uleb128 0x1
+ 332 0047 10       		.byte	0x10
+ 333 0048 04       		.byte	0x4
+ 334 0049 00000000 		.long	.LASF5
+ 335 004d 01       		.uleb128 0x1
+GAS LISTING /tmp/ccUIsTvF.s 			page 18
+
+
+ 336 004e 04       		.byte	0x4
+ 337 004f 04       		.byte	0x4
+ 338 0050 00000000 		.long	.LASF6
+ 339 0054 01       		.uleb128 0x1
+ 340 0055 04       		.byte	0x4
+ 341 0056 07       		.byte	0x7
+ 342 0057 00000000 		.long	.LASF7
+ 343 005b 01       		.uleb128 0x1
+ 344 005c 02       		.byte	0x2
+ 345 005d 07       		.byte	0x7
+ 346 005e 00000000 		.long	.LASF8
+ 347 0062 0E       		.uleb128 0xe
+ 348 0063 10       		.byte	0x10
+ 349 0064 01       		.byte	0x1
+ 350 0065 BB       		.byte	0xbb
+ 351 0066 09       		.byte	0x9
+ 352 0067 84000000 		.long	0x84
+ 353 006b 07       		.uleb128 0x7
+ 354 006c 00000000 		.long	.LASF9
+ 355 0070 BC       		.byte	0xbc
+ 356 0071 1A       		.byte	0x1a
+ 357 0072 84000000 		.long	0x84
+ 358 0076 00       		.byte	0
+ 359 0077 07       		.uleb128 0x7
+ 360 0078 00000000 		.long	.LASF10
+ 361 007c BD       		.byte	0xbd
+ 362 007d 0C       		.byte	0xc
+ 363 007e 25000000 		.long	0x25
+ 364 0082 08       		.byte	0x8
+ 365 0083 00       		.byte	0
+ 366 0084 08       		.uleb128 0x8
+ 367 0085 90000000 		.long	0x90
+ 368 0089 01       		.uleb128 0x1
+ 369 008a 01       		.byte	0x1
+ 370 008b 08       		.byte	0x8
+ 371 008c 00000000 		.long	.LASF11
+ 372 0090 03       		.uleb128 0x3
+ 373 0091 89000000 		.long	0x89
+ 374 0095 06       		.uleb128 0x6
+ 375 0096 00000000 		.long	.LASF13
+ 376 009a 01       		.byte	0x1
+ 377 009b BE       		.byte	0xbe
+ 378 009c 03       		.byte	0x3
+ 379 009d 62000000 		.long	0x62
+ 380 00a1 03       		.uleb128 0x3
+ 381 00a2 95000000 		.long	0x95
+ 382 00a6 08       		.uleb128 0x8
+ 383 00a7 A1000000 		.long	0xa1
+ 384 00ab 04       		.uleb128 0x4
+ 385 00ac 00000000 		.long	.LASF14
+ 386 00b0 21       		.byte	0x21
+ 387 00b1 A6000000 		.long	0xa6
+ 388 00b5 04       		.uleb128 0x4
+ 389 00b6 00000000 		.long	.LASF15
+ 390 00ba 23       		.byte	0x23
+ 391 00bb A6000000 		.long	0xa6
+ 392 00bf 04       		.uleb128 0x4
+GAS LISTING /tmp/ccUIsTvF.s 			page 19
+
+
+ 393 00c0 00000000 		.long	.LASF16
+ 394 00c4 25       		.byte	0x25
+ 395 00c5 A6000000 		.long	0xa6
+ 396 00c9 04       		.uleb128 0x4
+ 397 00ca 00000000 		.long	.LASF17
+ 398 00ce 27       		.byte	0x27
+ 399 00cf A6000000 		.long	0xa6
+ 400 00d3 09       		.uleb128 0x9
+ 401 00d4 90000000 		.long	0x90
+ 402 00d8 E4000000 		.long	0xe4
+ 403 00dc 0A       		.uleb128 0xa
+ 404 00dd 31000000 		.long	0x31
+ 405 00e1 0304     		.value	0x403
+ 406 00e3 00       		.byte	0
+ 407 00e4 03       		.uleb128 0x3
+ 408 00e5 D3000000 		.long	0xd3
+ 409 00e9 02       		.uleb128 0x2
+ 410 00ea 00000000 		.long	.LASF18
+ 411 00ee 1C       		.byte	0x1c
+ 412 00ef 1C       		.byte	0x1c
+ 413 00f0 E4000000 		.long	0xe4
+ 414 00f4 09       		.uleb128 0x9
+ 415 00f5 03       		.byte	0x3
+ 416 00f6 00000000 		.quad	b2w_data
+ 416      00000000 
+ 417 00fe 0B       		.uleb128 0xb
+ 418 00ff 62327700 		.string	"b2w"
+ 419 0103 1F       		.byte	0x1f
+ 420 0104 A1000000 		.long	0xa1
+ 421 0108 09       		.uleb128 0x9
+ 422 0109 03       		.byte	0x3
+ 423 010a 00000000 		.quad	b2w
+ 423      00000000 
+ 424 0112 05       		.uleb128 0x5
+ 425 0113 AB000000 		.long	0xab
+ 426 0117 20       		.byte	0x20
+ 427 0118 09       		.uleb128 0x9
+ 428 0119 03       		.byte	0x3
+ 429 011a 00000000 		.quad	heatmap_cs_b2w
+ 429      00000000 
+ 430 0122 09       		.uleb128 0x9
+ 431 0123 90000000 		.long	0x90
+ 432 0127 33010000 		.long	0x133
+ 433 012b 0A       		.uleb128 0xa
+ 434 012c 31000000 		.long	0x31
+ 435 0130 FF03     		.value	0x3ff
+ 436 0132 00       		.byte	0
+ 437 0133 03       		.uleb128 0x3
+ 438 0134 22010000 		.long	0x122
+ 439 0138 02       		.uleb128 0x2
+ 440 0139 00000000 		.long	.LASF19
+ 441 013d 22       		.byte	0x22
+ 442 013e 1C       		.byte	0x1c
+ 443 013f 33010000 		.long	0x133
+ 444 0143 09       		.uleb128 0x9
+ 445 0144 03       		.byte	0x3
+ 446 0145 00000000 		.quad	b2w_o_data
+GAS LISTING /tmp/ccUIsTvF.s 			page 20
+
+
+ 446      00000000 
+ 447 014d 02       		.uleb128 0x2
+ 448 014e 00000000 		.long	.LASF20
+ 449 0152 25       		.byte	0x25
+ 450 0153 24       		.byte	0x24
+ 451 0154 A1000000 		.long	0xa1
+ 452 0158 09       		.uleb128 0x9
+ 453 0159 03       		.byte	0x3
+ 454 015a 00000000 		.quad	b2w_o
+ 454      00000000 
+ 455 0162 05       		.uleb128 0x5
+ 456 0163 B5000000 		.long	0xb5
+ 457 0167 26       		.byte	0x26
+ 458 0168 09       		.uleb128 0x9
+ 459 0169 03       		.byte	0x3
+ 460 016a 00000000 		.quad	heatmap_cs_b2w_opaque
+ 460      00000000 
+ 461 0172 02       		.uleb128 0x2
+ 462 0173 00000000 		.long	.LASF21
+ 463 0177 28       		.byte	0x28
+ 464 0178 1C       		.byte	0x1c
+ 465 0179 E4000000 		.long	0xe4
+ 466 017d 09       		.uleb128 0x9
+ 467 017e 03       		.byte	0x3
+ 468 017f 00000000 		.quad	w2b_data
+ 468      00000000 
+ 469 0187 0B       		.uleb128 0xb
+ 470 0188 77326200 		.string	"w2b"
+ 471 018c 2B       		.byte	0x2b
+ 472 018d A1000000 		.long	0xa1
+ 473 0191 09       		.uleb128 0x9
+ 474 0192 03       		.byte	0x3
+ 475 0193 00000000 		.quad	w2b
+ 475      00000000 
+ 476 019b 05       		.uleb128 0x5
+ 477 019c BF000000 		.long	0xbf
+ 478 01a0 2C       		.byte	0x2c
+ 479 01a1 09       		.uleb128 0x9
+ 480 01a2 03       		.byte	0x3
+ 481 01a3 00000000 		.quad	heatmap_cs_w2b
+ 481      00000000 
+ 482 01ab 02       		.uleb128 0x2
+ 483 01ac 00000000 		.long	.LASF22
+ 484 01b0 2E       		.byte	0x2e
+ 485 01b1 1C       		.byte	0x1c
+ 486 01b2 33010000 		.long	0x133
+ 487 01b6 09       		.uleb128 0x9
+ 488 01b7 03       		.byte	0x3
+ 489 01b8 00000000 		.quad	w2b_o_data
+ 489      00000000 
+ 490 01c0 02       		.uleb128 0x2
+ 491 01c1 00000000 		.long	.LASF23
+ 492 01c5 31       		.byte	0x31
+ 493 01c6 24       		.byte	0x24
+ 494 01c7 A1000000 		.long	0xa1
+ 495 01cb 09       		.uleb128 0x9
+ 496 01cc 03       		.byte	0x3
+GAS LISTING /tmp/ccUIsTvF.s 			page 21
+
+
+ 497 01cd 00000000 		.quad	w2b_o
+ 497      00000000 
+ 498 01d5 05       		.uleb128 0x5
+ 499 01d6 C9000000 		.long	0xc9
+ 500 01da 32       		.byte	0x32
+ 501 01db 09       		.uleb128 0x9
+ 502 01dc 03       		.byte	0x3
+ 503 01dd 00000000 		.quad	heatmap_cs_w2b_opaque
+ 503      00000000 
+ 504 01e5 00       		.byte	0
+ 505              		.section	.debug_abbrev,"",@progbits
+ 506              	.Ldebug_abbrev0:
+ 507 0000 01       		.uleb128 0x1
+ 508 0001 24       		.uleb128 0x24
+ 509 0002 00       		.byte	0
+ 510 0003 0B       		.uleb128 0xb
+ 511 0004 0B       		.uleb128 0xb
+ 512 0005 3E       		.uleb128 0x3e
+ 513 0006 0B       		.uleb128 0xb
+ 514 0007 03       		.uleb128 0x3
+ 515 0008 0E       		.uleb128 0xe
+ 516 0009 00       		.byte	0
+ 517 000a 00       		.byte	0
+ 518 000b 02       		.uleb128 0x2
+ 519 000c 34       		.uleb128 0x34
+ 520 000d 00       		.byte	0
+ 521 000e 03       		.uleb128 0x3
+ 522 000f 0E       		.uleb128 0xe
+ 523 0010 3A       		.uleb128 0x3a
+ 524 0011 21       		.uleb128 0x21
+ 525 0012 04       		.sleb128 4
+ 526 0013 3B       		.uleb128 0x3b
+ 527 0014 0B       		.uleb128 0xb
+ 528 0015 39       		.uleb128 0x39
+ 529 0016 0B       		.uleb128 0xb
+ 530 0017 49       		.uleb128 0x49
+ 531 0018 13       		.uleb128 0x13
+ 532 0019 02       		.uleb128 0x2
+ 533 001a 18       		.uleb128 0x18
+ 534 001b 00       		.byte	0
+ 535 001c 00       		.byte	0
+ 536 001d 03       		.uleb128 0x3
+ 537 001e 26       		.uleb128 0x26
+ 538 001f 00       		.byte	0
+ 539 0020 49       		.uleb128 0x49
+ 540 0021 13       		.uleb128 0x13
+ 541 0022 00       		.byte	0
+ 542 0023 00       		.byte	0
+ 543 0024 04       		.uleb128 0x4
+ 544 0025 34       		.uleb128 0x34
+ 545 0026 00       		.byte	0
+ 546 0027 03       		.uleb128 0x3
+ 547 0028 0E       		.uleb128 0xe
+ 548 0029 3A       		.uleb128 0x3a
+ 549 002a 21       		.uleb128 0x21
+ 550 002b 03       		.sleb128 3
+ 551 002c 3B       		.uleb128 0x3b
+GAS LISTING /tmp/ccUIsTvF.s 			page 22
+
+
+ 552 002d 0B       		.uleb128 0xb
+ 553 002e 39       		.uleb128 0x39
+ 554 002f 21       		.uleb128 0x21
+ 555 0030 25       		.sleb128 37
+ 556 0031 49       		.uleb128 0x49
+ 557 0032 13       		.uleb128 0x13
+ 558 0033 3F       		.uleb128 0x3f
+ 559 0034 19       		.uleb128 0x19
+ 560 0035 3C       		.uleb128 0x3c
+ 561 0036 19       		.uleb128 0x19
+ 562 0037 00       		.byte	0
+ 563 0038 00       		.byte	0
+ 564 0039 05       		.uleb128 0x5
+ 565 003a 34       		.uleb128 0x34
+ 566 003b 00       		.byte	0
+ 567 003c 47       		.uleb128 0x47
+ 568 003d 13       		.uleb128 0x13
+ 569 003e 3A       		.uleb128 0x3a
+ 570 003f 21       		.uleb128 0x21
+ 571 0040 04       		.sleb128 4
+ 572 0041 3B       		.uleb128 0x3b
+ 573 0042 0B       		.uleb128 0xb
+ 574 0043 39       		.uleb128 0x39
+ 575 0044 21       		.uleb128 0x21
+ 576 0045 1E       		.sleb128 30
+ 577 0046 02       		.uleb128 0x2
+ 578 0047 18       		.uleb128 0x18
+ 579 0048 00       		.byte	0
+ 580 0049 00       		.byte	0
+ 581 004a 06       		.uleb128 0x6
+ 582 004b 16       		.uleb128 0x16
+ 583 004c 00       		.byte	0
+ 584 004d 03       		.uleb128 0x3
+ 585 004e 0E       		.uleb128 0xe
+ 586 004f 3A       		.uleb128 0x3a
+ 587 0050 0B       		.uleb128 0xb
+ 588 0051 3B       		.uleb128 0x3b
+ 589 0052 0B       		.uleb128 0xb
+ 590 0053 39       		.uleb128 0x39
+ 591 0054 0B       		.uleb128 0xb
+ 592 0055 49       		.uleb128 0x49
+ 593 0056 13       		.uleb128 0x13
+ 594 0057 00       		.byte	0
+ 595 0058 00       		.byte	0
+ 596 0059 07       		.uleb128 0x7
+ 597 005a 0D       		.uleb128 0xd
+ 598 005b 00       		.byte	0
+ 599 005c 03       		.uleb128 0x3
+ 600 005d 0E       		.uleb128 0xe
+ 601 005e 3A       		.uleb128 0x3a
+ 602 005f 21       		.uleb128 0x21
+ 603 0060 01       		.sleb128 1
+ 604 0061 3B       		.uleb128 0x3b
+ 605 0062 0B       		.uleb128 0xb
+ 606 0063 39       		.uleb128 0x39
+ 607 0064 0B       		.uleb128 0xb
+ 608 0065 49       		.uleb128 0x49
+GAS LISTING /tmp/ccUIsTvF.s 			page 23
+
+
+ 609 0066 13       		.uleb128 0x13
+ 610 0067 38       		.uleb128 0x38
+ 611 0068 0B       		.uleb128 0xb
+ 612 0069 00       		.byte	0
+ 613 006a 00       		.byte	0
+ 614 006b 08       		.uleb128 0x8
+ 615 006c 0F       		.uleb128 0xf
+ 616 006d 00       		.byte	0
+ 617 006e 0B       		.uleb128 0xb
+ 618 006f 21       		.uleb128 0x21
+ 619 0070 08       		.sleb128 8
+ 620 0071 49       		.uleb128 0x49
+ 621 0072 13       		.uleb128 0x13
+ 622 0073 00       		.byte	0
+ 623 0074 00       		.byte	0
+ 624 0075 09       		.uleb128 0x9
+ 625 0076 01       		.uleb128 0x1
+ 626 0077 01       		.byte	0x1
+ 627 0078 49       		.uleb128 0x49
+ 628 0079 13       		.uleb128 0x13
+ 629 007a 01       		.uleb128 0x1
+ 630 007b 13       		.uleb128 0x13
+ 631 007c 00       		.byte	0
+ 632 007d 00       		.byte	0
+ 633 007e 0A       		.uleb128 0xa
+ 634 007f 21       		.uleb128 0x21
+ 635 0080 00       		.byte	0
+ 636 0081 49       		.uleb128 0x49
+ 637 0082 13       		.uleb128 0x13
+ 638 0083 2F       		.uleb128 0x2f
+ 639 0084 05       		.uleb128 0x5
+ 640 0085 00       		.byte	0
+ 641 0086 00       		.byte	0
+ 642 0087 0B       		.uleb128 0xb
+ 643 0088 34       		.uleb128 0x34
+ 644 0089 00       		.byte	0
+ 645 008a 03       		.uleb128 0x3
+ 646 008b 08       		.uleb128 0x8
+ 647 008c 3A       		.uleb128 0x3a
+ 648 008d 21       		.uleb128 0x21
+ 649 008e 04       		.sleb128 4
+ 650 008f 3B       		.uleb128 0x3b
+ 651 0090 0B       		.uleb128 0xb
+ 652 0091 39       		.uleb128 0x39
+ 653 0092 21       		.uleb128 0x21
+ 654 0093 24       		.sleb128 36
+ 655 0094 49       		.uleb128 0x49
+ 656 0095 13       		.uleb128 0x13
+ 657 0096 02       		.uleb128 0x2
+ 658 0097 18       		.uleb128 0x18
+ 659 0098 00       		.byte	0
+ 660 0099 00       		.byte	0
+ 661 009a 0C       		.uleb128 0xc
+ 662 009b 11       		.uleb128 0x11
+ 663 009c 01       		.byte	0x1
+ 664 009d 25       		.uleb128 0x25
+ 665 009e 0E       		.uleb128 0xe
+GAS LISTING /tmp/ccUIsTvF.s 			page 24
+
+
+ 666 009f 13       		.uleb128 0x13
+ 667 00a0 0B       		.uleb128 0xb
+ 668 00a1 03       		.uleb128 0x3
+ 669 00a2 1F       		.uleb128 0x1f
+ 670 00a3 1B       		.uleb128 0x1b
+ 671 00a4 1F       		.uleb128 0x1f
+ 672 00a5 10       		.uleb128 0x10
+ 673 00a6 17       		.uleb128 0x17
+ 674 00a7 00       		.byte	0
+ 675 00a8 00       		.byte	0
+ 676 00a9 0D       		.uleb128 0xd
+ 677 00aa 24       		.uleb128 0x24
+ 678 00ab 00       		.byte	0
+ 679 00ac 0B       		.uleb128 0xb
+ 680 00ad 0B       		.uleb128 0xb
+ 681 00ae 3E       		.uleb128 0x3e
+ 682 00af 0B       		.uleb128 0xb
+ 683 00b0 03       		.uleb128 0x3
+ 684 00b1 08       		.uleb128 0x8
+ 685 00b2 00       		.byte	0
+ 686 00b3 00       		.byte	0
+ 687 00b4 0E       		.uleb128 0xe
+ 688 00b5 13       		.uleb128 0x13
+ 689 00b6 01       		.byte	0x1
+ 690 00b7 0B       		.uleb128 0xb
+ 691 00b8 0B       		.uleb128 0xb
+ 692 00b9 3A       		.uleb128 0x3a
+ 693 00ba 0B       		.uleb128 0xb
+ 694 00bb 3B       		.uleb128 0x3b
+ 695 00bc 0B       		.uleb128 0xb
+ 696 00bd 39       		.uleb128 0x39
+ 697 00be 0B       		.uleb128 0xb
+ 698 00bf 01       		.uleb128 0x1
+ 699 00c0 13       		.uleb128 0x13
+ 700 00c1 00       		.byte	0
+ 701 00c2 00       		.byte	0
+ 702 00c3 00       		.byte	0
+ 703              		.section	.debug_aranges,"",@progbits
+ 704 0000 1C000000 		.long	0x1c
+ 705 0004 0200     		.value	0x2
+ 706 0006 00000000 		.long	.Ldebug_info0
+ 707 000a 08       		.byte	0x8
+ 708 000b 00       		.byte	0
+ 709 000c 0000     		.value	0
+ 710 000e 0000     		.value	0
+ 711 0010 00000000 		.quad	0
+ 711      00000000 
+ 712 0018 00000000 		.quad	0
+ 712      00000000 
+ 713              		.section	.debug_line,"",@progbits
+ 714              	.Ldebug_line0:
+ 715 0000 51000000 		.section	.debug_str,"MS",@progbits,1
+ 715      05000800 
+ 715      49000000 
+ 715      010101FB 
+ 715      0E0D0001 
+ 716              	.LASF18:
+GAS LISTING /tmp/ccUIsTvF.s 			page 25
+
+
+ 717 0000 6232775F 		.string	"b2w_data"
+ 717      64617461 
+ 717      00
+ 718              	.LASF12:
+ 719 0009 73697A65 		.string	"size_t"
+ 719      5F7400
+ 720              	.LASF16:
+ 721 0010 68656174 		.string	"heatmap_cs_w2b"
+ 721      6D61705F 
+ 721      63735F77 
+ 721      326200
+ 722              	.LASF13:
+ 723 001f 68656174 		.string	"heatmap_colorscheme_t"
+ 723      6D61705F 
+ 723      636F6C6F 
+ 723      72736368 
+ 723      656D655F 
+ 724              	.LASF19:
+ 725 0035 6232775F 		.string	"b2w_o_data"
+ 725      6F5F6461 
+ 725      746100
+ 726              	.LASF24:
+ 727 0040 474E5520 		.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fopenmp -fPIC -fasynchronous-unwind-t
+ 727      43313720 
+ 727      31322E32 
+ 727      2E30202D 
+ 727      6D74756E 
+ 728              	.LASF6:
+ 729 009f 666C6F61 		.string	"float"
+ 729      7400
+ 730              	.LASF11:
+ 731 00a5 756E7369 		.string	"unsigned char"
+ 731      676E6564 
+ 731      20636861 
+ 731      7200
+ 732              	.LASF3:
+ 733 00b3 6C6F6E67 		.string	"long unsigned int"
+ 733      20756E73 
+ 733      69676E65 
+ 733      6420696E 
+ 733      7400
+ 734              	.LASF23:
+ 735 00c5 7732625F 		.string	"w2b_o"
+ 735      6F00
+ 736              	.LASF8:
+ 737 00cb 73686F72 		.string	"short unsigned int"
+ 737      7420756E 
+ 737      7369676E 
+ 737      65642069 
+ 737      6E7400
+ 738              	.LASF22:
+ 739 00de 7732625F 		.string	"w2b_o_data"
+ 739      6F5F6461 
+ 739      746100
+ 740              	.LASF21:
+ 741 00e9 7732625F 		.string	"w2b_data"
+ 741      64617461 
+GAS LISTING /tmp/ccUIsTvF.s 			page 26
+
+
+ 741      00
+ 742              	.LASF7:
+ 743 00f2 756E7369 		.string	"unsigned int"
+ 743      676E6564 
+ 743      20696E74 
+ 743      00
+ 744              	.LASF20:
+ 745 00ff 6232775F 		.string	"b2w_o"
+ 745      6F00
+ 746              	.LASF10:
+ 747 0105 6E636F6C 		.string	"ncolors"
+ 747      6F727300 
+ 748              	.LASF4:
+ 749 010d 6C6F6E67 		.string	"long long int"
+ 749      206C6F6E 
+ 749      6720696E 
+ 749      7400
+ 750              	.LASF17:
+ 751 011b 68656174 		.string	"heatmap_cs_w2b_opaque"
+ 751      6D61705F 
+ 751      63735F77 
+ 751      32625F6F 
+ 751      70617175 
+ 752              	.LASF15:
+ 753 0131 68656174 		.string	"heatmap_cs_b2w_opaque"
+ 753      6D61705F 
+ 753      63735F62 
+ 753      32775F6F 
+ 753      70617175 
+ 754              	.LASF2:
+ 755 0147 6C6F6E67 		.string	"long int"
+ 755      20696E74 
+ 755      00
+ 756              	.LASF5:
+ 757 0150 6C6F6E67 		.string	"long double"
+ 757      20646F75 
+ 757      626C6500 
+ 758              	.LASF14:
+ 759 015c 68656174 		.string	"heatmap_cs_b2w"
+ 759      6D61705F 
+ 759      63735F62 
+ 759      327700
+ 760              	.LASF9:
+ 761 016b 636F6C6F 		.string	"colors"
+ 761      727300
+ 762              		.section	.debug_line_str,"MS",@progbits,1
+ 763              	.LASF1:
+ 764 0000 2F726F6F 		.string	"/root/repo"
+ 764      742F7265 
+ 764      706F00
+ 765              	.LASF0:
+ 766 000b 636F6C6F 		.string	"colorschemes/gray.c"
+ 766      72736368 
+ 766      656D6573 
+ 766      2F677261 
+ 766      792E6300 
+ 767              		.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+GAS LISTING /tmp/ccUIsTvF.s 			page 27
+
+
+ 768 001f 2F726F6F 		.section	.note.GNU-stack,"",@progbits
+ 768      742F7265 
+ 768      706F0063 
+ 768      6F6C6F72 
+ 768      73636865 
@@ -109,7 +109,7 @@ int main(int argc, char* argv[])
             auto* hm = hms[i];
 
             for(auto point : points) {
-                heatmap_add_point_with_stamp(hm, point.first, point.second, stamps[i]);
+                heatmap_add_pointf_with_stamp(hm, point.first, point.second, stamps[i]);
             }
 
             vector<unsigned char> image(w*h*4);
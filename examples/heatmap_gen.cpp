@@ -23,12 +23,17 @@
  */
 
 #include <algorithm>
+#include <chrono>
+#include <future>
 #include <iostream>
 #include <string>
 #include <map>
+#include <thread>
 
-#include "lodepng.h"
 #include "heatmap.h"
+#include "pipeline.hpp"
+#include "pngwriter.hpp"
+#include "pointio.hpp"
 
 #include "colorschemes/gray.h"
 #include "colorschemes/Blues.h"
@@ -175,8 +180,356 @@ std::map<std::string, const heatmap_colorscheme_t*> g_schemes = {
     {"YlOrRd_mixed_exp", heatmap_cs_YlOrRd_mixed_exp},
 };
 
+#ifdef WEIGHTED
+static const bool g_weighted = true;
+#else
+static const bool g_weighted = false;
+#endif // WEIGHTED
+
+static void add_batch(heatmap_t* hm, const unsigned* xy, const float* ws, size_t n, const heatmap_stamp_t* stamp)
+{
+    if(ws) heatmap_add_weighted_points_with_stamp(hm, xy, ws, n, stamp);
+    else heatmap_add_points_with_stamp(hm, xy, n, stamp);
+}
+
+static void add_batch(heatmap_t* hm, const float* xy, const float* ws, size_t n, const heatmap_stamp_t* stamp)
+{
+    if(ws) heatmap_add_weighted_pointsf_with_stamp(hm, xy, ws, n, stamp);
+    else heatmap_add_pointsf_with_stamp(hm, xy, n, stamp);
+}
+
+template<typename T>
+static size_t count_outside(const T* xy, size_t n, size_t w, size_t h)
+{
+    size_t outside = 0;
+    for(size_t i = 0 ; i < n ; ++i) {
+        outside += !(T(0) <= xy[2*i] && xy[2*i] < T(w) && T(0) <= xy[2*i+1] && xy[2*i+1] < T(h));
+    }
+    return outside;
+}
+
+// Adds those of the `n` points which lie on the heatmap using the multi-point
+// calls, and returns how many didn't. Input files can hold any garbage, so
+// points outside the heatmap never even reach the library. They are rare, so
+// only if there are any, the others get copied out first.
+template<typename T>
+static size_t add_inside(heatmap_t* hm, const T* xy, const float* ws, size_t n, const heatmap_stamp_t* stamp)
+{
+    const size_t outside = count_outside(xy, n, hm->w, hm->h);
+    if(outside == 0) {
+        add_batch(hm, xy, ws, n, stamp);
+        return 0;
+    }
+
+    std::vector<T> inxy;
+    std::vector<float> inws;
+    inxy.reserve(2*(n - outside));
+    inws.reserve(ws ? n - outside : 0);
+    for(size_t i = 0 ; i < n ; ++i) {
+        if(count_outside(xy + 2*i, 1, hm->w, hm->h) == 0) {
+            inxy.push_back(xy[2*i]);
+            inxy.push_back(xy[2*i+1]);
+            if(ws)
+                inws.push_back(ws[i]);
+        }
+    }
+    if(!inxy.empty())
+        add_batch(hm, &inxy[0], ws ? &inws[0] : nullptr, n - outside, stamp);
+    return outside;
+}
+
+// Adds `n` binary records of coordinate type `T` using the multi-point calls.
+// Unweighted records are laid out exactly like those calls expect them, so
+// they're handed over straight from the mapped file. Weighted ones need to be
+// split into coordinates and weights first, which happens in small batches
+// that stay in the cache. Returns how many points were outside the heatmap.
+template<typename T>
+static size_t add_records(heatmap_t* hm, const unsigned char* data, size_t n, const heatmap_stamp_t* stamp)
+{
+    if(!g_weighted)
+        return add_inside(hm, reinterpret_cast<const T*>(data), nullptr, n, stamp);
+
+    static const size_t batch = 4096;
+    T xy[2*batch];
+    float ws[batch];
+    size_t outside = 0;
+    for(size_t i0 = 0 ; i0 < n ; i0 += batch) {
+        const size_t m = std::min(batch, n - i0);
+        for(size_t i = 0 ; i < m ; ++i) {
+            const unsigned char* rec = data + (i0 + i)*point_record_size(true);
+            std::memcpy(&xy[2*i], rec, 2*sizeof(T));
+            std::memcpy(&ws[i], rec + 2*sizeof(T), sizeof(float));
+        }
+        outside += add_inside(hm, xy, ws, m, stamp);
+    }
+    return outside;
+}
+
+// What reading the input amounted to, for the warnings and `-v`.
+struct input_stats {
+    size_t npoints = 0, nlines = 0, nbytes = 0, outside = 0;
+    bool complete = true, invalid = false;
+};
+
+// Reads all points from stdin and adds them to the heatmap, one after another.
+static input_stats add_input(heatmap_t* hm, const heatmap_stamp_t* stamp, point_format format, bool verbose)
+{
+    input_stats stats;
+    if(format == point_format::text) {
+        stats.complete = for_each_text_chunk(STDIN_FILENO, [&](const char* lo, const char* data, size_t size, bool last) {
+            // After an invalid token, just drain the input.
+            if(stats.invalid)
+                return size;
+            const size_t done = parse_text_points(lo, data, size, last, g_weighted,
+                [&](const unsigned* xy, const float* ws, size_t n) {
+                    stats.outside += add_inside(hm, xy, ws, n, stamp);
+                    stats.npoints += n;
+                }, &stats.invalid);
+            if(verbose)
+                stats.nlines += std::count(data, data + done, '\n');
+            stats.nbytes += done;
+            return stats.invalid ? size : done;
+        });
+    } else {
+        stats.complete = for_each_record_chunk(STDIN_FILENO, point_record_size(g_weighted),
+            [&](const unsigned char* data, size_t n) {
+                stats.outside += format == point_format::u32 ? add_records<unsigned>(hm, data, n, stamp)
+                                                             : add_records<float>(hm, data, n, stamp);
+                stats.npoints += n;
+                stats.nbytes += n*point_record_size(g_weighted);
+            });
+    }
+    return stats;
+}
+
+// A piece of input after parsing. Binary pieces don't need any.
+struct parsed_piece {
+    input_piece piece;
+    std::vector<unsigned> xy;
+    std::vector<float> ws;
+    size_t done = 0, nlines = 0;
+    bool invalid = false;
+};
+
+static void parse_piece(parsed_piece& r, const char* lo, const char* data, size_t size)
+{
+    r.xy.clear();
+    r.ws.clear();
+    r.done = parse_text_points(lo, data, size, true, g_weighted,
+        [&](const unsigned* xy, const float* ws, size_t n) {
+            r.xy.insert(r.xy.end(), xy, xy + 2*n);
+            if(ws)
+                r.ws.insert(r.ws.end(), ws, ws + n);
+        }, &r.invalid);
+}
+
+struct parse_job {
+    input_piece piece;
+    std::promise<parsed_piece> result;
+};
+
+struct pipeline_times {
+    stage_timer read, parse, order, splat, merge;
+};
+
+// Does the same as `add_input`, but in a pipeline of threads:
+//
+//   reader -> nthreads parsers -> sequencer -> nthreads splatters -> merge
+//
+// The reader cuts the input into pieces of about 1MB. Text pieces end after a
+// newline, and are parsed in parallel assuming each starts with a new point.
+// That's the case unless a point is split over several lines; the sequencer
+// checks it in input order, and if a piece ends in an unfinished point, it
+// parses the next one again with that point's beginning in front. Binary
+// pieces hold whole records and go straight to the splatters.
+//
+// Each splatter adds points to a shard of its own, which are merged into the
+// heatmap at the end. The shards are sparse, so that they only take memory
+// where they got points, instead of a whole map per thread. All queues are
+// bounded, so only a few pieces per thread are in flight at any time, no
+// matter how large the input.
+static input_stats add_input_pipelined(heatmap_t* hm, const heatmap_stamp_t* stamp, point_format format, unsigned nthreads, bool verbose, pipeline_times& times)
+{
+    typedef stage_timer::clock clock;
+
+    const bool text = format == point_format::text;
+    const size_t recsize = text ? 0 : point_record_size(g_weighted);
+    input_stats stats;
+
+    bounded_queue<parse_job> parse_q(2*nthreads);
+    bounded_queue<std::future<parsed_piece>> order_q(4*nthreads);
+    bounded_queue<parsed_piece> splat_q(2*nthreads);
+
+    const mapped_input in(STDIN_FILENO);
+    std::thread reader([&]{
+        clock::time_point t = clock::now();
+        stats.complete = read_pieces(STDIN_FILENO, in, recsize, [&](input_piece&& piece) {
+            times.read.add_since(t);
+            if(text) {
+                parse_job job;
+                job.piece = std::move(piece);
+                order_q.push(job.result.get_future());
+                parse_q.push(std::move(job));
+            } else {
+                parsed_piece r;
+                r.piece = std::move(piece);
+                splat_q.push(std::move(r));
+            }
+            t = clock::now();
+        });
+        times.read.add_since(t);
+        parse_q.close();
+        order_q.close();
+        if(!text)
+            splat_q.close();
+    });
+
+    std::vector<std::thread> parsers;
+    for(unsigned i = 0 ; text && i < nthreads ; ++i) {
+        parsers.emplace_back([&]{
+            parse_job job;
+            while(parse_q.pop(job)) {
+                const clock::time_point t = clock::now();
+                parsed_piece r;
+                r.piece = std::move(job.piece);
+                parse_piece(r, r.piece.lo, r.piece.data, r.piece.size);
+                if(verbose)
+                    r.nlines = std::count(r.piece.data, r.piece.data + r.piece.size, '\n');
+                times.parse.add_since(t);
+                job.result.set_value(std::move(r));
+            }
+        });
+    }
+
+    std::vector<heatmap_t*> shards(nthreads);
+    std::vector<size_t> outside(nthreads), npoints(nthreads);
+    std::vector<std::thread> splatters;
+    for(unsigned i = 0 ; i < nthreads ; ++i) {
+        shards[i] = heatmap_new_ex(hm->w, hm->h, hm->flags | HEATMAP_SPARSE | HEATMAP_LAZY_MAX);
+        splatters.emplace_back([&, i]{
+            parsed_piece r;
+            while(splat_q.pop(r)) {
+                const clock::time_point t = clock::now();
+                if(text) {
+                    const size_t n = r.xy.size()/2;
+                    if(n > 0)
+                        outside[i] += add_inside(shards[i], &r.xy[0], g_weighted ? &r.ws[0] : nullptr, n, stamp);
+                    npoints[i] += n;
+                } else {
+                    const unsigned char* data = reinterpret_cast<const unsigned char*>(r.piece.data);
+                    const size_t n = r.piece.size / recsize;
+                    outside[i] += format == point_format::u32 ? add_records<unsigned>(shards[i], data, n, stamp)
+                                                              : add_records<float>(shards[i], data, n, stamp);
+                    npoints[i] += n;
+                }
+                times.splat.add_since(t);
+            }
+        });
+    }
+
+    // The sequencer runs right here.
+    if(text) {
+        std::vector<char> carry;
+        std::future<parsed_piece> f;
+        while(order_q.pop(f)) {
+            parsed_piece r = f.get();
+            // After an invalid token, just drain the input.
+            if(stats.invalid)
+                continue;
+            const clock::time_point t = clock::now();
+            stats.nlines += r.nlines;
+            stats.nbytes += r.piece.size;
+
+            if(carry.empty()) {
+                carry.assign(r.piece.data + r.done, r.piece.data + r.piece.size);
+            } else {
+                // Leave room in front for the parser's look-behind.
+                std::vector<char> buf(8);
+                buf.insert(buf.end(), carry.begin(), carry.end());
+                buf.insert(buf.end(), r.piece.data, r.piece.data + r.piece.size);
+                parse_piece(r, &buf[0], &buf[8], buf.size() - 8);
+                carry.assign(buf.begin() + 8 + r.done, buf.end());
+            }
+            stats.invalid = r.invalid;
+            times.order.add_since(t);
+            if(!r.xy.empty())
+                splat_q.push(std::move(r));
+        }
+        splat_q.close();
+    }
+
+    reader.join();
+    for(auto& t : parsers)
+        t.join();
+    for(auto& t : splatters)
+        t.join();
+
+    const clock::time_point t = clock::now();
+    heatmap_merge_shards(hm, &shards[0], nthreads, nthreads);
+    for(heatmap_t* shard : shards)
+        heatmap_free(shard);
+    times.merge.add_since(t);
+
+    for(unsigned i = 0 ; i < nthreads ; ++i) {
+        stats.outside += outside[i];
+        stats.npoints += npoints[i];
+    }
+    if(!text)
+        stats.nbytes = stats.npoints*recsize;
+    return stats;
+}
+
+// Hands the bands of the rendered image over to the PNG writer, timing the
+// rendering in between; the writer times its encoders itself.
+struct band_sink {
+    png_writer* png;
+    stage_timer render;
+    stage_timer::clock::time_point t;
+};
+
+static int add_band(const unsigned char* band, unsigned, unsigned nlines, size_t stride, void* userdata)
+{
+    band_sink* sink = static_cast<band_sink*>(userdata);
+    sink->render.add_since(sink->t);
+    sink->png->add_rows(band, nlines, stride);
+    sink->t = stage_timer::clock::now();
+    return sink->png->good() ? 0 : 1;
+}
+
 int main(int argc, char* argv[])
 {
+    const char* prog = argv[0];
+
+    // Options come first, after them we shift argv such that the positional
+    // arguments start at argv[1] again.
+    point_format format = point_format::text;
+    bool verbose = false;
+    unsigned nthreads = std::max(1u, std::thread::hardware_concurrency());
+    int level = 2;
+    int argi = 1;
+    for(;;) {
+        if(argi < argc && std::string(argv[argi]) == "-v") {
+            verbose = true;
+            argi += 1;
+        } else if(argi + 1 < argc && std::string(argv[argi]) == "-j") {
+            nthreads = std::max(1, atoi(argv[argi + 1]));
+            argi += 2;
+        } else if(argi + 1 < argc && std::string(argv[argi]) == "-f") {
+            if(!parse_point_format(argv[argi + 1], &format)) {
+                std::cerr << "Unknown input format " << argv[argi + 1] << ", use one of text, u32 or f32." << std::endl;
+                return 1;
+            }
+            argi += 2;
+        } else if(argi + 1 < argc && std::string(argv[argi]) == "-z") {
+            level = std::min(std::max(atoi(argv[argi + 1]), 0), 2);
+            argi += 2;
+        } else {
+            break;
+        }
+    }
+    argv += argi - 1;
+    argc -= argi - 1;
+
     if(argc == 2 && std::string(argv[1]) == "-l") {
         for(auto& scheme : g_schemes) {
             std::cout << "  " << scheme.first << std::endl;
@@ -187,7 +540,7 @@ int main(int argc, char* argv[])
     if(argc < 3 || 6 < argc) {
         std::cerr << "Invalid number of arguments!" << std::endl;
         std::cout << "Usage:" << std::endl;
-        std::cout << "  " << argv[0] << " WIDTH HEIGHT [STAMP_RADIUS [COLORSCHEME]] < points.txt > heatmap.png" << std::endl;
+        std::cout << "  " << prog << " [-v] [-j N] [-f FORMAT] [-z LEVEL] WIDTH HEIGHT [STAMP_RADIUS [COLORSCHEME]] < points.txt > heatmap.png" << std::endl;
         std::cout << std::endl;
 #ifdef WEIGHTED
         std::cout << "  points.txt should contain a list of space-separated triplets of x, y and w" << std::endl;
@@ -204,12 +557,31 @@ int main(int argc, char* argv[])
 #endif // WEIGHTED
         std::cout << "  Note that a newline counts as a space, so you may input one point per line." << std::endl;
         std::cout << std::endl;
+        std::cout << "  FORMAT is text by default. Much faster are packed binary records in native" << std::endl;
+        std::cout << "  byte order: -f u32 reads 32-bit unsigned integer coordinates and -f f32" << std::endl;
+#ifdef WEIGHTED
+        std::cout << "  32-bit float coordinates, both followed by a 32-bit float weight." << std::endl;
+#else
+        std::cout << "  32-bit float coordinates." << std::endl;
+#endif // WEIGHTED
+        std::cout << "  Redirect a file (instead of piping it) to have it memory-mapped." << std::endl;
+        std::cout << "  With -v, the throughput of reading and adding points is reported on stderr." << std::endl;
+        std::cout << std::endl;
+        std::cout << "  N threads (default: one per core) each parse and add points; with more than" << std::endl;
+        std::cout << "  one, the input is read, parsed and added by a pipeline of threads. Each one" << std::endl;
+        std::cout << "  adding points needs up to WIDTHxHEIGHT floats of memory of its own, for the" << std::endl;
+        std::cout << "  parts of the map its points land on." << std::endl;
+        std::cout << std::endl;
+        std::cout << "  LEVEL is the PNG compression level: 0 stores the pixels uncompressed, 1 is" << std::endl;
+        std::cout << "  fast and 2 (the default) compresses best. N threads compress bands of rows" << std::endl;
+        std::cout << "  in parallel, while the next ones are being rendered." << std::endl;
+        std::cout << std::endl;
         std::cout << "  The default STAMP_RADIUS is a twentieth of the smallest heatmap dimension." << std::endl;
         std::cout << "  For instance, for a 512x1024 heatmap, the default stamp_radius is 25," << std::endl;
         std::cout << "  resulting in a stamp of 51x51 pixels." << std::endl;
         std::cout << std::endl;
         std::cout << "  To get a list of available colorschemes, run" << std::endl;
-        std::cout << "  " << argv[0] << " -l" << std::endl;
+        std::cout << "  " << prog << " -l" << std::endl;
         std::cout << "  The default colorscheme is Spectral_mixed." << std::endl;
 
         return 1;
@@ -222,39 +594,71 @@ int main(int argc, char* argv[])
     heatmap_stamp_t* stamp = heatmap_stamp_gen(r);
 
     if(argc >= 5 && g_schemes.find(argv[4]) == g_schemes.end()) {
-        std::cerr << "Unknown colorscheme. Run " << argv[0] << " -l for a list of valid ones." << std::endl;
+        std::cerr << "Unknown colorscheme. Run " << prog << " -l for a list of valid ones." << std::endl;
         return 1;
     }
     const heatmap_colorscheme_t* colorscheme = argc == 5 ? g_schemes[argv[4]] : heatmap_cs_default;
 
-    unsigned int x, y;
-    float weight = 1.0f;
-#ifdef WEIGHTED
-    while(std::cin >> x >> y >> weight) {
-#else
-    while(std::cin >> x >> y) {
-#endif // WEIGHTED
-        if(x < w && y < h) {
-            // Always using the weighted one even on unweighted data is not a
-            // drama for this example and keeps the code somewhat clearer.
-            heatmap_add_weighted_point_with_stamp(hm, x, y, weight, stamp);
-        } else {
-            std::cerr << "Warning: Skipping out-of-bound input coordinate: (" << x << "," << y << ")." << std::endl;
-        }
-    }
+    typedef stage_timer::clock clock;
+    const clock::time_point t0 = clock::now();
+    pipeline_times times;
+    const input_stats stats = nthreads > 1 ? add_input_pipelined(hm, stamp, format, nthreads, verbose, times)
+                                           : add_input(hm, stamp, format, verbose);
+    const double secs = std::chrono::duration<double>(clock::now() - t0).count();
     heatmap_stamp_free(stamp);
 
-    std::vector<unsigned char> image(w*h*4);
-    heatmap_render_to(hm, colorscheme, &image[0]);
-    heatmap_free(hm);
+    if(stats.invalid) {
+        std::cerr << "Warning: Stopped reading at a token which isn't a valid number." << std::endl;
+    }
+    if(!stats.complete) {
+        std::cerr << "Warning: The input could not be read completely or ends in a partial record." << std::endl;
+    }
+    if(stats.outside > 0) {
+        std::cerr << "Warning: Skipped " << stats.outside << " out-of-bound input coordinates." << std::endl;
+    }
+    if(verbose) {
+        std::cerr << "Read " << stats.npoints << " points";
+        if(format == point_format::text)
+            std::cerr << " (" << stats.nlines << " lines)";
+        std::cerr << " from " << stats.nbytes/1e6 << "MB in " << secs << "s: " << stats.npoints/secs << " points/s";
+        if(format == point_format::text)
+            std::cerr << ", " << stats.nlines/secs << " lines/s";
+        std::cerr << ", " << stats.nbytes/1e6/secs << "MB/s." << std::endl;
+        std::cerr << "Added " << stats.npoints - stats.outside << " of them to the heatmap." << std::endl;
+    }
 
-    std::vector<unsigned char> png;
-    if(unsigned error = lodepng::encode(png, image, w, h)) {
-        std::cerr << "encoder error " << error << ": "<< lodepng_error_text(error) << std::endl;
+    // The image is rendered band by band, each of which the PNG writer hands
+    // to its encoder threads, so the next band renders while earlier ones are
+    // compressed, and the whole image is never in memory at once.
+    png_writer png(std::cout, w, h, level, nthreads);
+    band_sink sink;
+    sink.png = &png;
+    sink.t = clock::now();
+    heatmap_render_bands_parallel(hm, colorscheme, 0, nullptr, add_band, &sink, nthreads);
+    heatmap_free(hm);
+    const bool written = png.finish();
+    if(!written) {
+        std::cerr << "Error: Could not write the PNG image." << std::endl;
         return 1;
     }
 
-    std::cout.write((char*)&png[0], png.size());
+    if(verbose) {
+        std::cerr << "Seconds busy per stage, summed over its threads:" << std::endl;
+        if(nthreads > 1) {
+            std::cerr << "  read   " << times.read.seconds() << std::endl;
+            if(format == point_format::text) {
+                std::cerr << "  parse  " << times.parse.seconds() << " (" << nthreads << " threads)" << std::endl;
+                std::cerr << "  order  " << times.order.seconds() << std::endl;
+            }
+            std::cerr << "  splat  " << times.splat.seconds() << " (" << nthreads << " threads)" << std::endl;
+            std::cerr << "  merge  " << times.merge.seconds() << std::endl;
+        } else {
+            std::cerr << "  input  " << secs << std::endl;
+        }
+        std::cerr << "  render " << sink.render.seconds() << std::endl;
+        std::cerr << "  encode " << png.encode_seconds() << " (level " << level << ", " << nthreads << " threads)" << std::endl;
+        std::cerr << "  total  " << std::chrono::duration<double>(clock::now() - t0).count() << " (wall)" << std::endl;
+    }
 
     return 0;
 }